@@ -4,9 +4,16 @@ INCLUDE_DIRS    := $(INCLUDE_DIRS) \
 
 MCU_COMMON_SRC  := $(ROOT)/lib/main/dyad/dyad.c
 
+# CMSIS-DSP C sources for gyroanalyse, the assembly bit reversal is replaced by target/SITL/dsp.c
+DSP_LIB         := $(ROOT)/lib/main/CMSIS/DSP
+INCLUDE_DIRS    := $(INCLUDE_DIRS) \
+                   $(ROOT)/lib/main/CMSIS/Core/Include
+
 #Flags
 ARCH_FLAGS      =
-DEVICE_FLAGS    =
+# ARM_MATH_CM0 selects the plain C paths of CMSIS-DSP, the host has no Cortex-M DSP instructions. The header is a
+# system one here as its unused circular buffer helpers keep pointers in int32_t, which doesn't fit on a 64 bit host.
+DEVICE_FLAGS    = -DARM_MATH_CM0 -isystem $(DSP_LIB)/Include
 LD_SCRIPT       = src/main/target/SITL/pg.ld
 STARTUP_SRC     =
 
@@ -44,6 +44,8 @@ COMMON_SRC = \
             fc/runtime_config.c \
             interface/msp.c \
             interface/msp_box.c \
+            interface/msp_dataflash_bulk.c \
+            interface/msp_settings.c \
             interface/tramp_protocol.c \
             interface/smartaudio_protocol.c \
             io/beeper.c \
@@ -185,6 +187,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             common/encoding.c \
             common/filter.c \
             common/maths.c \
+            common/ring_buffer.c \
             common/typeconversion.c \
             drivers/accgyro/accgyro_fake.c \
             drivers/accgyro/accgyro_mpu.c \
@@ -337,8 +340,10 @@ SRC += $(DSP_LIB)/Source/CommonTables/arm_common_tables.c
 SRC += $(DSP_LIB)/Source/ComplexMathFunctions/arm_cmplx_mag_f32.c
 SRC += $(DSP_LIB)/Source/StatisticsFunctions/arm_max_f32.c
 
+ifneq ($(SIMULATOR_BUILD),yes)
 SRC += $(wildcard $(DSP_LIB)/Source/*/*.S)
 endif
+endif
 
 ifneq ($(filter ONBOARDFLASH,$(FEATURES)),)
 SRC += \
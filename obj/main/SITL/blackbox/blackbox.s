@@ -0,0 +1,4393 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\274\nU$"
+	.string	"\346h\233G`\026Sc\343/\236X9\303\325\026\352\242\212@\370\352(\t\337y}\\X\242\020\312\242^\302V)\301'>\235\305\300\235\003\354C\336\260\2356\343\366\222j\340)c\n\372\207Hbih\255k\271\215\310\275e35\031|"
+	.string	"\200"
+	.string	"\220"
+	.string	"9;\257c\336<\f\363\371/\177\001\320\023_Eu\021\306\300\264\177\326\355\357\362\374\345\367\376\276\3161\352H\237\031\023\251\2742\365\347\367\242|V^\177\307L\350\326\004]\226q\362\310#]\253\265\253<e\234D\302F\370\260\361\307\033\277\377\376}S\302 \334\334~76\260H\237\253[\367\356\365u\373\277\370?\206\331\302\356\250~\264^\263\\D\342\363\233E\275&NL9)\303B\002\017\372>\363\370\004L\313m\372\036\350\371@9\301\343\327\212\003\314K\032-z\377\272zy\367\313\b\311\303\266\255.\"\237\236\237\377 \3209>\317?\360|\003\317/\240y\b<\353\254\263\316:k\350\007<\237\347\371;\337\002\3566s\200\347\234k\234\343\310\334<?\177\276\344 \034\331`\016N\3146\004\013x\263s\315mj.Cs\232\231\313P_9 U"
+	.string	"\237\373\333\335q9\232\202\330\320\020\003\357\236T\2262\022\020\316<\342\275-\261\216p>\267D=>\2541\021!\212ukp{ \234F+jX\271\017\036:p\030\322\022\264\333"
+	.ascii	"\037~\360\fE\036V\263~\03224\177\206f\226\205AcQ\311\252\272"
+	.ascii	"`a\273\373\220\253\032VAz\351\243\217F\265\364\217^)I\230\007"
+	.ascii	"\305\213\302\204\242\277\350\032\252\254Ss\242#\211\350\256\203"
+	.ascii	"\277\301\237\f\026\f\375\251\363\347\216\202?\245\233\351oK\222"
+	.ascii	"\243 \3446,\374!fD\025\272\320{\241?\007\371h\275f\271n\330\320"
+	.ascii	"S\330\035]5\212Oe\205w4\376C\225U<\274\263%\342!\231\025\335"
+	.ascii	"\214#\343\244\232\006el-,\253\226\030J;=1)0\332\264+\324\224"
+	.ascii	"\027E\036nsX\027\355\025\311SU\013\3700\322\221\220\276\217n"
+	.ascii	"\264\004C\221\t~\261 V\337\214|\255x\337\f\321\242(\265zl\256"
+	.ascii	"G\230\2126\033\370D$\305\217wJ\250\344P\344m\350\224\346w\302"
+	.ascii	"9\023\267ai\363a\202z\352\341\303\3248\351\266\225\345Tb\372"
+	.ascii	"\351\247\337\307\201%\250\32159\"SA\222\2440l\006\361\004\016"
+	.ascii	"2\310\330\231\007\022@\324\025\213\244\210\024\315H\220"
+	.string	"\222\224\024\244V\20614\216'\274D\375\375\020\344]5\235\372\242\002\327h\211\356\230@D\374\210\255\274\242y\334;\377\313+\302S\224\035\341\223\362\350\315\006\220Ox\315\254\310g\310\372\332\236p\307\205\342\023o\342>\n\270\035:\3773\240\314G\317\006\316;p\340\024\031\360kRy\321\034\212\274\275\364\373\036\353\244I^\315ziJ\022\b\304\017\360f\262Y\266x\231[\024\232\244U\235\f\nkjkhy\\\215\341\305\0373\373\0018\301O\264\271:\"\220?F\326\230b\346\323M \225\377\3519\327h\256\033\203\007B\t\004\370h\357\361\365X\223\263m\001\021\302\322h~\376\345c\253\210\333\324\360\344\2252\003\352\370\274\201\023\354t]\007\320J\340 \342k\2615{7\320\321\243V[/\337\341Q\204>\343\253\377\232\250\2619\374\026!k\276\223s\221\033N\300l\307&w\233\224W\305Vp\214\303\201"
+	.string	"\025m5c\334i\320\346<>V\322\215\323p\276\343\220\350\207\333\206\311\224&\017\323\200y\267\305\271\344\337\013-\213\030\212/\246\315\301}\376@\027y\240\303\r\257\233\\\036\234jH\316r\033\032\227\t\203:\372\243\341\3758K\220\337l"
+	.ascii	"\245]\342\332\343\f=\216\213\345\301\217v\305(\312\370\225j\035"
+	.ascii	"\364Q\366\360Y\354\342\230qF\207\337q\203\307\232\215$\255<~"
+	.ascii	"\221\357GF.\3750+\312\333I\275,\337#r\336\351~\301\266b\005\303"
+	.ascii	"k2\251N\023u\3319\267\340\306..NN\311\327\262\177\034WZ\301&"
+	.ascii	"\2222KG1\363\227m\261Y\206g\214h\206\034\f\265O2+\226T\205\340"
+	.ascii	"\f\021\3607\021\275\331\274\002\320\337\246\275X\346\225\003"
+	.ascii	"\2757PJ\3369\341\037}\255%f\025f\365\235;\215\245Pe\213W\340"
+	.ascii	"\233a\236=w\214#3\346F7\031\365\336\347\303\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\302\002%\b"
+	.string	"r\207\027\034p\273\214\001\374\377\377\315"
+	.string	"v\316\335\3569\033Z\033_"
+	.string	"\245DI\235\315\266\2252\245\356\256N\325\231\332E\025\024\320\332\036x\360\323\232\266t\222\316\221\310\020\3503\300\243\035\316F\223Y\314y\321R\241L$\032\021\262\303X&p\231j\340\0334\030.V\234@\274\031\324\t\247\335>\274WS\250\300\3308\035p\202)\263\332\006\022\200T)\001\222\032G\215Mf2[X\255\377\006\021\324\032?\301\005r\017\351\351\031\005lu!E\372%\242\376K\t"
+	.ascii	"\201+\310\034KR\246\343\237?\225\3077\035\013$\342\t~\026e;M"
+	.ascii	"mo(\251\002`\211N*\3541\307\013\2540\020\266\204\324\325x\310"
+	.ascii	"\341\226<\321fX\251\024\336\022\267\304{\255\367\247\352\271"
+	.ascii	"\3501\271fA\277\366\r\247\227\372X\264\260v9\007a\342}YL\232"
+	.ascii	"\274\024\2062T\203p\310A6\2312\307\3311\n\017\310\211\253w}\221"
+	.ascii	"\346?"
+	.text
+	.section	.gnu.lto_.inline.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\257\026\0358"
+	.string	"F}\323I\200\030R:\377\377\227K\212\030\377 \305:\306\300\203b\250\223\216\006\340\303\323\006K:N\256\005}\345\231RP\252?3H\332T\357\235g\332;\020\240\215\252j\357\226\262\355\347\340\013S\233\326\033\321f\355\177R\362\311\226;\005\247"
+	.string	"\307"
+	.string	"\303"
+	.string	"\267F\027G\022.Z\202\007\360\253;\376\317>\377\224\310@w\025~\025\332\276e >\211O\327 \316\375\257\300V\227\342\220.\203A+\260\322s\267\306\333\326\335\007\236\376o\364/\336-h\3125\036~\2206\2612\300\363\231\376L\2572\325\231\352B\373\363vE[\344\332_\205}!w\237\317\356\237O\273\177\230\354\212L\213\257v\277x\273\273\035\234\317B\334\335H\364_\352\356\343\357\373?d\373_@"
+	.ascii	"\235`\016\020G\005\340\353\361\376\235N\351\177\212\364\337\332"
+	.ascii	"%1\350\220\223~skd\033Wd;\024\374\b\256\243\f\026\315\300\226"
+	.ascii	"\314\356\360\211\013\350\016+\335\226\324P\f\254ds\267G\327+"
+	.ascii	"\213\355\212=\276\200\345]\243"
+	.string	"\333\311\2470@\022\214\242\305\0236\365\004V{\336\375\177\2659\005\r*K\335\327\257\302\013\325\313,\343\364C'Bm \356\021\203I\373\210w\314\327\323R\275\355\006b)'\257-\336Ek;\323\347od\nA\267\331lr\375\302H\224\b\003\373R\222\004\311\317\253\313\0169\211\353\210\021-\233es\266\210\0352\022\021\233\003v\234\301\3644\327\031\342'j]`\f\212.\233\026\323j\301\201?\217\350r\351\356\233\377vt}\231\251\374\377\002\333\333'2h\312\336o\356\203\264\277\335\261-\272gPb\\<l\201\3559W\"\360\245\326\260\2620\270\207\313\303f\335\235\363\016>dw\353\316\3418\246\305\254\002\016],\245\232\327\357\033~\262\032\020$M8i\345d\225\264^\r|z\347\031-]\272\211\021\377\366\210\201,\303\242>\366\036{\304QV\240\304l\214\243\213f\005J\354i\247\360_\030\335\307"
+	.string	"\351\004#\016\363\350\356 O\302\356/2Uw\347\030Jw\253\217\340\203\264g!e,\314\032]63/Y\354\215C\270=\337P{\024\367\377\374\337&\r}\026\032&t\t\377\227\350\246Y\203\345\t\327\"\201\201\337\233\365A\376L\304_\230\240\274P\207\270)\231\214r\n\335&>q\332\024\025m\2238\fl\355\355\377\016\007'b\024\313\032e\303\036iC\224\bnB\350&m\225\270\315%\235\224E-\231y\334j\nc\333\244D\367A\252A\377\224\177\246CkJ\367!\233\002\375\f\262\2533\365\306\264\313T\225$\356\305\240\343\271\244M\314\214\252A\005\263jM\357BE\356\240\021\307\034U\2340\205E\266H%\037\034\350\277\017\272\260\362Q\025L\211\266Y\315\331\2212\234+!J\226\277\363\307\252\351z\362y>\177\354\210\3359=\247\304\266\233zV\327\363z^\211T\\\344\255\356\036"
+	.string	"f\367\277\207m\263\200\257\227\206\366\260\322\321\337\"\216j6\331<\270\b\026\202\246\364\242*\3050\031\242>\204\361v\020ob\221&\213\206\257\321L\231\351\375\203\215\222\261\206\025\201\312\250qA23C#IR\220\fs\341\004\2041\306 C\363\022\240\342H\206\303,S\204\03034\"\"\022DR\036\005I!\035Fa\340\021\362\354\245\244\207\r5ZN$\215\251~fe\0306\023\277g\303BK\230\313\001d\031\244\177\220\370'\323\007\346ozo\024\250TE\205\025[d\026\325\374\373\303\220\002\247\027Y\231~h\005&\312\361\241Z\230\213$tvuLZ\376_\255-\177\036\263"
+	.string	"M$/\342+\362\357\204!47\013\223\3574\242O\007,3m'\261"
+	.ascii	"!8w\020QN#B\261\205\rW+\017[HDD\203.\254?\237\323\214\377\346"
+	.ascii	"*n\r[\033\330\202\013\020o|\307\377N0\244z\241\177\027f\350\373"
+	.ascii	"x>\334$\223J\223\370\210D9\275\037+\301\266.\235v{\201)\\\310"
+	.string	"\025\251mA\1771\304\242u\300\216\360\272\241t\027\027e\300\300\016\275\333I\003\234\026\003_.V\024J*\302<)5\243:[nv\321 v\271\214\252\335\007\005+L\275\244\217\212G\222\305\354A\362J\260F\002x3\255\246\257\r\365\\i18\005h\272\274\031R\300 \272\357\036\232\221\250\335\211\360\246F\301\325\311\365\210\274\362&\334i\354\375E\f\301e4\203n\0273-\233\013?\227\311'\036\374~\371\247\255_x\3561\366#@\274:\210P}\020\267 \327\240\236\252\353\350=\034g\207\n\020\321A\005\272\001\323\250\344\350\"Qe\201J\201Q\340\214\211\2764z$d\311\207\311\234\334\240\207\223\204NA\177Q25\201ctMD8\t\307\275>.P\310\325@\217\336\300A\342\013\f4\246\336\360'\366\244\204^\313f\264\023\245\364kc\200K\2514\302\256h\322\277\202\322\246.N\205\227\301q\035"
+	.string	"\320\020\304uaA\b\244\371\315\005\326\350\254\233\347Q\035qx\234z\215N\351U\371\007\307q\202\024}S\025\036\205\374\306\005\034+\352\204\365\277\236cH\203\232&\r\t\304\026\207\302\0235r\244Q\005*8\204\256\202\265*\310hZ\313\016\032l|`\020\201\232\fs\331`A\277\262\254\320\230\346\327\2028 Hw\313\311+\232\230l\037\221\300)\321t\251%\377\207L\224aPR\032m\273F2\302?\366\0208\f\224\255H\331o\302\235\365u4\200\307\f\311\313\243\256\240\006Di*\037z|\325\215\365\336BE\023\020\031\367,y\0134e0\211p\210\266"
+	.string	"2L\f\0232"
+	.ascii	"\b\353\024$\267\241\026\330\200\322\311\326\255@\026\320r\355"
+	.ascii	"\251\007\373!mt\221\340\373\302\356X\350\232S!T\241\271\247\235"
+	.ascii	"\342TOIE\"1.?,\020.\270\036\211\214\214%Y\343V\214(\226\326\204"
+	.ascii	"\r\377\020+\321\272C\272s\230\206\206i\322\306\016\310\344\267"
+	.ascii	"\022\325R8N\224 \214\207\233d\020\202b\025\037\305\325\234;J"
+	.ascii	"*\302\277\377\351\363\356\363q\203W\001\372\266X\256\353;\322"
+	.ascii	"Aj\246a\230\\\257X\236\256W\333\352\367'A\267\355\215R5\240\364"
+	.ascii	"\317Nj0\037XZB\231\376\372\001\366\263\263\211\217\347\312\027"
+	.ascii	"B\376\251B\205\313u\323\t\235&u\032\212\272\b\263\315\002\330"
+	.ascii	"\013\275I\220\016#\320\324%\262\333\203p4e \2060\353\327\327"
+	.ascii	"qu\274\"A5\320\360e\r\372\177\206K\341*\345\207\036\347p\330"
+	.ascii	"\214g2\211\2559`\373\031v\366\222\034\223F\303#\3671wd\214\304"
+	.ascii	"\r\366'\324\f\020.\346U\242\372-]\375&\341M\bhz\364\243V+\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\2055}b"
+	.ascii	"\352s\330\030=`\3566\007\200b\265\201\007\024\020\004?Qz;\273"
+	.ascii	";]5\005\367\350g\034\"b\023i\333\275\360m\333B\233L\332\"\312"
+	.ascii	"\242\360\253\224\007\262\033\366\001:\357\345\333\332\332\310"
+	.ascii	"\310\022)e\n\213\001\212\001o\001\263G\201\344\314\310\220Z\344"
+	.ascii	"be\026e\246d&\204\324\263P:(\313D\352\232\354\221\f\221\035\331"
+	.ascii	"\031Y\026&\262\037\230FG\243\240\257\021\314X\205\324\342x$\006"
+	.ascii	"*\246)\026)F(6'\306&\306%\266D\f5f|EI\244\026\305DvH={,\236\021"
+	.ascii	"\261\210L\304\267\023\214\022l\021\314O\033X\0272\343\013\213"
+	.ascii	"\002\013\022n\"\265\bI\007u\320\314\370\206\212B<\300\320\215"
+	.ascii	"\230\360J\310D\177\262\324\007\315\370\3522\372\212N\242f|\263"
+	.ascii	"\247|)\033\312{H-\256\031\337,\247\315\370f1\371\t\251\3057\343"
+	.ascii	"\213\2038\210\203q\306\027O\"\365\030\001g\314H\316\370\342/"
+	.ascii	"R\2179\003\347\214/\346Rg|\361\224;\343\213\221\344\031_\354"
+	.ascii	"\265g"
+	.string	"|y\220\272%\265\330g|s\374\031_\034\201\306\267\005\251\007\215\357\006R\327\n\215o\005R_\221\332\320\370\"h\200h|i\244\026\255\276\0200+\032_\030\251C\034\007c<\030\337\301\030\210\361\217\221\230\361\003\363\317\321\370bR\207\377V8\347\331\fA\006\"\310\300\022'Ld 0\210c\013\0200P\360\343\030\2069\343\337#1\347\021\004\356\334\301R\301 \206\203\361\033\374@|\374@\314X\007\203*\002\374?\036<\300\377\257z\034\304\232\322\301`\017\257\037\370\013\211\031\003q\370\3658\374\302\377\271D\006\226\310@)\214\263\024\211\361?\217\310@\215\361\223\037\033\360?\301\f\270\221\241_\020\"\277!=\360\270IP\350\252\366+\242\007\375\216\204\030\376\337\352\347\344\227$\324\200a:\346\006\007\372-q\362c\"b#Zw\360\227\376\2033\226\230\037\006\003\240\371\350>\277'\241\224_\024\021\033\3010"
+	.string	"\3701\211\030\246q\264Yk38\337\376\037\267\"c|\273i88g\374\274\177 0\f=d\214\"\343\031\306y\367\337\313T\202\301\327\375\363\024\347\277\3714\032\376m\312\3720\314\030\3570\324\221\265\026\027,\300\361\253T~\276\035!u\016\326\251\343!?\212\033\030\377\262\210\330\013{\275\215\377\257A\343\177\300"
+	.ascii	"\374\323\"\006\b\320\313j\216\361\377/\376]\374\212\327kp\316"
+	.ascii	"c8f\340\030\366\210\305p\017:t\364\350\001\004(\302\241C\241"
+	.ascii	"\2124\265\232(\242\301\242(\242\370\277\302\021T\204\310\257"
+	.ascii	"H\314\\9\374\3724k\361\377A\f\032\324#\177\370\177\013\035>O"
+	.ascii	"\236\034J\005?yyyy\341\007\242\306Y\213\t\006?\030\304\031\230"
+	.ascii	"\365\025\016\3036\030\263\301\031\0039i\361\301i\013\207\374"
+	.ascii	"\365e\033E\352L\244\026-\331\n=0\333\374\330\342\220z\374\205"
+	.ascii	"W\266/\244\026)\350+?/\217\301\374\357\313/L\306F0L_]q\002\264"
+	.ascii	"\021\031\265\351\017\366\372\317B\274\274\2008\310\271\326HP"
+	.ascii	"\255N\355M\255\306\245\006\245\326\244V\204\324\"\355\023\251"
+	.ascii	"GM4G4>\2649\2645a\262\320\236\f\361\204)VgN|\236\351\262+\325"
+	.ascii	"\357\340\225\272^J3\315mc\373\316\272=\357{\353\354\233W\356"
+	.ascii	"\266j{\265\357\322m;\252+W\266L\267Y\262\275k7\340\247>\335Z"
+	.ascii	"+\213\272;e{\235\273+Z\232\375\300\363\324u\331\316sK\356\356"
+	.ascii	"\216\356\003\337\371\211jq\365t\243\235\267T\177rs\355jW_\311"
+	.ascii	"[\337\324\247\254\311\272l\357U=ww/\325\255^\331Y\227U\245\236"
+	.ascii	"\373\322\255U\362\364DK\227\345\265\347\324\363\223Ui\337\362"
+	.ascii	"\356s7\327\311\250\276E\271v\271\363e\361S\300\363^\227[v\356"
+	.ascii	"\246\250\316\200\325\231\213}\253\323\261\256\317,\271\026\352"
+	.ascii	"\232;\301\363\335\356\\k\227\\\275\334\255(\317eY\265-\315^\340"
+	.ascii	"u\340\322\224\355\265\327\201\343\231.\332\263\275\016\334\326"
+	.ascii	"\356\242\375\231\303\205\277\205\033\021#\005V\354-T\220`A\002"
+	.ascii	"\205\330\273\274\035\232\216\360\251\"f\337\346p\020\332\334"
+	.ascii	"\003\\\233\303\265\271\333w\236\245\372T\340:\227\201K\267\317"
+	.ascii	"5?\f\370u\253:\235\2177~\233\323\277\262h\333\362\336SY\023\267"
+	.ascii	"\335\035b\3527\2649\234\231\303\235)GG\340JH\275\2153W\003\366"
+	.ascii	"gN\367\376\331\365\377\265\326_pV b\254@\314\030/ht\363\341I"
+	.ascii	"/\372\341\003\024\005\n\210|\210\n\177\370\b\2128\264.\203\363"
+	.ascii	"\315N\016\277cS\234\216\305\235\253\b\232n\335<\005AAB\006\t"
+	.ascii	"\027\304G\265x\247z\361\325\216\216\340\356>qn\337n\213\333\261"
+	.ascii	"(\252\236\253{\305\271\272\335A`\321p,h\337q,\306\025Uk\\[\255"
+	.ascii	"=W\216\213\002\214\366\256\257\347\372V\324\236D\205\330\363"
+	.ascii	"t\233mI{+_N\346\246\254"
+	.string	"V\232r\023\300\373r\372u\274\217\337\331v\345/\334\225\367\3563o\317U\324\355\261l*S\331\225\237e\333r\363D{T\177\242\352\330y\256\354{\250K{wE\331^\216\315{V\271{\256\324\367\320\223\326C\313\335k\245\2765\273\354\331\036\027/\315>~+\216\262\255\335\025\373\031+P\324\276\004\t\254\022!\260X\244\\\213\247\266\017\201\305b\267\325\330\224\324\357\340I\235U\337\363\235+\272e\373\332\024\327Ny/\325\316]\264\312\335YZ7\030+\232\302\375\320\236h\347<\251\237}\255\364\251\374\346\266,\233\005\340\273\266\311\317\022\035\377LY^\313;\317%\320\345\242Z\273\357J\324]7\325\243\355\272\273K@\306\267\312\263\357\255\316\352N\316uU\277\242{W\246lwW\326,\333\254=u\356\252n?{\333o\355\256\322EU4-U_{\242\275)\331\237\353\316:7?\313\255\335e{*"
+	.string	"U\026\332v\367\266\330t\352w\360n\177\346\002\202\310\250\242\022#r\320\314\210\210\210\202$I\322\001\362\t\020\bFy\032\347\255\342\001\022 \342h\b#)\216\302 b\b!\210\030D\030\021\210D\"22\"2\254\003\243\322\275\312QfJ\241\336:\213\005(\227\255\252\225}.\022\313~\347]\271\030V\244"
+	.string	"/\363SR\311\365\333\007\375\231\361|\371\221\033R*t\265\370>\304\241\276\377\"\tTH\206-5\217+\fX@\370)\347\f9p\007\374\371_\371\255to\232 |`\f\214\351\036\216w\237p\344\210\277\360v\204w\363\331\037\271wW\216\030`]\320x1\016\\\236__\3138\375Gi\nwF\230"
+	.string	"\004\327K\337\007O\262\006=\b\264z\200\231M\371#\312@\271\251\247\327\016/\377\260\273\217\f\251\330\276\265\002\222\214qiL~d\210/\350\215AU\001\256\200\315\023y6\316:\227\347J\320\022x\251Q\327\002\365\267\235\235\025gE{\0312\"\207\200g\360u\275\261B\3112k\313\245V\274\312\207ys\202R\216\215d\3121d\237&\335\317\021$\0061x\017;\225#\024\2168%;\f\357\201\201\026\274\340W\261\337\373=\337_ \342\022\335^\t\323h\341\017}\370\212\340i\t0hcx\366\274\262\220\274~\326\035f\237N,N/'Y\035\266M\177m\371$\225\273n\306\3441\350\200\337\364^\177\277\354\3349Dp\0224>\016P\315\013\344"
+	.ascii	"\344$&\023\303A\203"
+	.ascii	"\254\006\024\334\210\3007\364\210\221\214@\027\276=e>v\\\035"
+	.ascii	"\343)\036g\020Q\203I[\271\357\350h\220\3014\233\250\235\307\304"
+	.ascii	"E+5\3032\343P\334\257\264)y\316LW\370X\304dAe+\f'R\336\020\267"
+	.ascii	"K\261\3274^[\001\033de\356H\020\232\252\025\367\204<g\030x\374"
+	.ascii	"\016\310\002\245%#\025\004\376* \rY\343U\267\206\214&\200\355"
+	.ascii	"S>\016&\007\0056\375\322-\017\344\021KZ|+)\372\326Hn\220O\216"
+	.ascii	"o\301E\016\320\251\200\225\371\356\335:\225\224\006\311\204\220"
+	.ascii	"6\021B\277\261J6\252\341\204\026\003\347\227\335F\020E\004d\037"
+	.ascii	"fl\256n\234+\002\270\267\200':\336H\213\225Rc3z\262\331\023="
+	.ascii	"H\370\321S\0204\353\023r\035\377\354\255U\f`s\264\361_\206>n"
+	.ascii	"_%\005\006+\033\302\303kgo\2135i\032\230L\244p\2329y\360Rl\336"
+	.ascii	"\004\377\300\231\336\016\351x_\362\223\340\266hs2D\360\267\343"
+	.ascii	"acXa?<C\314\352ldR\360k\372\217\027\242y\003y\333)\025\327\023"
+	.ascii	"\231\324u\363\265Ty\032nlw]P \205nB\254\230t\317\367(l\021S\335"
+	.ascii	"8C\300\246&2\325\240\207\244f\373\360\024\304\223\267\027\002"
+	.ascii	"\244\207Rc\030\004@W\032\305?|\325\304 \260\316\247!\335\333"
+	.ascii	"<\206\206eUb\376\016\270a3`\026\356\251\214\222\372P\305\376"
+	.ascii	"\244u\003\375\220\205\327\270\366\021\b\201\025\202\277\331\224"
+	.ascii	"\272wQfn^b\356\fp1\036\341\371'\362\330Y\334\204B:\216\377g\317"
+	.ascii	",f\352\030\025N\327\376\027\020\312\266\230\274A\343\203\256"
+	.ascii	"\213oM\244\224GrmO\302\241\215\304\3540>\222\374\352\337W\322"
+	.ascii	"\240W\337P\206\326\360+\264\002\244~\257F\302}{\215\373\017<"
+	.ascii	"\377-p\230\365\236}\266#"
+	.string	"\330X*{\223\006\343\030\322\372n\344\025\257bf\314D|\252\336\206@^8\211\373\r@o\331S\n\326\274:\317\340\023\305r\242\244\302\214\213\251\246\305\266z\2519\365S\003vp\300A\362\234\304\262}r9:Y\252c\335Q\305\340\375\323\274\306\371\225\245\301\342\001\250\345\024\033<\"\326k\306s \330D\237\"@\346\360\355\305\037r\206,\264\017\177A\220\367\274^\006\274\225\267\303\\S\337BR!\341\242o\250\346\217Z\240\007A\260\311\236mVs\214r\3502\2262@\363\317\335\310\313\n\027\272\312\200Ex\344\324Ot\345\344\303\321b\277|\243\351\360\214d\212\333}{\321\246\277\265\344\236;\321S\360\327D\327DB8 \353\t\254\257\362\317^!\316\362\374\305%\265\341\334\202\275\001x\325\363w\3448\020\nr:\b k}\217fQ-N\201\r\267\361\205\340\320J\260\177h\030\016`\260\315\344\373"
+	.string	"wN;\231\263C\2369\307\2530\356\224ht\250LZ\322S\304\bG?Hx\343\271S\22566ua;\310f\023\026#\030\210\260\241\370\234\305f\021!D\024\005\227c\360\275\207\303\342\0222p\0015\243~\004x\377\336\201(!v\254@dS\322\262\376|0\216\fN\\\220>\\\"US\353k/\241B\203q\221d\377\t{#G(\322AR\220\235aw\363\216#Xat\\\025\223z"
+	.ascii	"mm\245#\373<\224\323oZ}\227\317\313\020\003\266\360O\370\355"
+	.ascii	"n\034\005\224\224\265*c(\213\270\374\017s7\354MD\251\235r\367"
+	.ascii	"\364\3468;4u\335\267\317\221\020\333a\024f\026F]\261\374D\226"
+	.ascii	"\f]\351O\375\241\3714\306\246h\244\022fW\230\375\243\032\036"
+	.ascii	"\013x\f\313\256p\264\341\216\230\242L\001\214&t\005\021\220#"
+	.ascii	"Z\037yK\341\345\341\034M\347}\272\317p\3468\210\332\037\203R"
+	.ascii	"\351\250\305\004e\320\032x\252\227\331-\026T\021/\266\271\275"
+	.ascii	"y\036\357J\260F\021\317t\262T\245\212\225\004V8\221IDQrI\345"
+	.ascii	"![\207Q\bg\365\033\034\256k\036\340\001\3036\311\202xK\024Y\347"
+	.ascii	"\373\262\373\312-\0011J@\271_\342\013g\331\365\270\334\"\352"
+	.ascii	"^\220\025pB\212'G\\\201}\304Mh\367\026\007\033fH2\322\223\242"
+	.ascii	"\211\223\037tK\273c\324\204\345 Y\324\377\024o\261i\324\"\237"
+	.ascii	"i\265hcH!{\254:\033\330\252\t hN\232\277\272%\203\3405"
+	.text
+	.section	.gnu.lto_.pureconst.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 z=\003"
+	.string	"\242\307\030!pO\241\003\251\352\t\273\325\343\305\021\251\345\244\327\307\020\207\317\032<Uqd~\214 \325t\"u\007\027\364}>\317\355\\\316\335\\\315\227\3710\367r-g\345R\306\311\225\334\310\205\234\217\353\270\215\313\030\027\247\342L\234\210{8\rca\034<\022,\n\214\200\361\272\326\255F\352N\237\364\031\301\314B\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\203\005\315\023"
+	.string	"\026\025I;0SZ9\300\300\300\300\300@\003\330b\334\375\357\356\377\330\335\377_s\375W\255\266\257\337\370\"\301.B\327\254\322p#\bt\001\367\272Y\033\303EN\3345\251h\267d{\023)S5"
+	.string	"A"
+	.string	"7"
+	.string	"40\001\023%\374\252\345\362\364\f I\271\221\b\250J\264\277\264\"\2554\300\246|C\242\363j\347\210\326u\244&9n\333FtR+\247\247Q\023\f\340%\017\001\345\264h\226H\n\250#\007\216\0336j\320\230!\243\363R~AA\211\001\343\205\213\026,V\25081\3515\222\302\363Z"
+	.string	"A\006\312Dt\035\364Eq\242[xI\377\364\341L\237\351\303\371\351@\237\001S\302G\021\236+\366\005Ax.D\013\342\001\341~\370\350\341y\036\017\221\007\013\262\247\203\327R\312\006\377\375]Q\231yEY\223)\265\254\347\2544\204\f\272\316\333q\022k0\r\326\301L[X\007c\3418M\333\240\020\203\370\263)\353\207\016\0346<5\374\323\307\f?;c\330$\272P\013W\324\337\344\237\325\251\242R\266B)Lh\200\307\250!qV3)H\241\315\200\002\241\251\252n\021\360\031\"dE\013\222\2442\034"
+	.string	"\2406ow=\300\315V\340ry\256\002\016m\220s%,_rA\203\200\315\221\316\344\312/\257\376b\253\230\272&\177\377<'\221cj\325L2\031\215 >R\244$\311\276\f\314\003\306\355}\007O\036:\2332\211_\331(H o-\352E\260\335\005\300\367\237\207\030\204\233l\3541\315\312d\276u{\242\023g\375\343hk+\255\254S\"\300\177!\314UP\340\212\324.m\276X\032>\213\202@\214\345\021&H:\373\307\261z\003\316\207\212NP\302\335\240\016lv\356\255\023\205\034\341\356\241\361\365\231t\001JD\261\205G@\355\210#R\3013\203\023\263,\200\r\032N0 h\335\237\364Y\204\221\206\027\207%\235\007\"\211s+\006\007\036\035\344a\307\214\271\3770\225\022$\003\330\202\255\2451d\224v\365!\252\262g,\023U\005\022'D\255bi<E%\027\240\036-M\255\367\264\333"
+	.ascii	"\3007\352PS\374\362\376-&3\002\220\247\347)\320\320Gj8w\330\361"
+	.ascii	"\002\330\355,\373\372\331\357b\215\213\376C\365Y\303\202\022"
+	.ascii	"|\3433\213@\275\030S\022\027\251\\\020\243\246"
+	.text
+	.section	.gnu.lto_.lto.1c3cb0b27440c682,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.12.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375``\001\025\016"
+	.string	"\326\031]E\360\260(\035{;\226\"f\364\026\\\007\237\t\233!\304@\262\200\215\301\216\315/\005\023]\266\n+x\373_Ad\bD\255\330\231\036I\231\232\315\005Ods\233\321\374\006\016\265#\234\002\342\331,\330\354\336R\246\024H"
+	.string	"C"
+	.string	"N"
+	.string	"\273\037\002/\310\036\215\262e\374\203\355\203\024-\230\032\273\253)\207\243\036\241&\312\177\354\034\235\227z|\035\002\360^W\350\341\362\320ux,x\300F\005\215\307\236\030\274U\246\247\301\356:;/\303\335\271m\007\266A\366I\0046A\311w\217>J\347\361\nb\261\021B\2259\366\227J\335`\037\256\256\330o\371\263L\307LCM\253\246S\323\017\360y\341\021\263\353\312\271\2614q\305\007\333\377\330\316\264\023(@\275%\305\272\253\302B&\366\311Q\244\024\250\331]\0066\351'D\006\300\036M\274t\320\240P=.Z8\252%L 51\357f\374\246\316UU"
+	.string	"\314\314\005\225U\316Xp\201P\275\212\\Z\260\362\3066\311_\\RA1\314}\204)\333]\020_\304\277\022\237\3451\233\311H\350$Z\302GH\211\024\201\033\2256\b\0258\221\310(4\"\322J\244\020\2116:\225h\037\006\314M\330N\032\005\216;i\237o\017WW\034c4*]\305\216\214jo!\371\316\004X\232r\246Q\365\005\243\205\243:\354\306F\006f\352\036"
+	.ascii	"`\251'\023\272\231\006\306\203\265\254\275C\325\0068\370a\"f"
+	.ascii	"&\032\b\004V=\256j\263tq\037\026\301{\253\220\241`\230\002/:"
+	.ascii	"\026\220\231U\001,\224\222\004\242\302\3205\034t&@\225\032'\356"
+	.ascii	"\\\317v\236\322Q\243UP"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.104.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 \233=\004"
+	.string	"D\007b"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\024\205\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\006"
+	.ascii	"\305RP\253\303)\315\303T\236\242\332\303@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.106.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 VU\002"
+	.string	"\304\003="
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	"\005\001\006\035\001"
+	.string	"\005\001'\002\002\177\001\003\005\001\006'\001 ?\202\210\200\300\001}{\277\001y\276\001w\275\001u\273\001s\273\001q\273\001o\274\001m\273\001"
+	.string	"\013\001\004"
+	.ascii	"\301mIi\342E\244\001\024\001"
+	.text
+	.section	.gnu.lto_blackboxProfileRateDiv.107.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 `}\002"
+	.string	"\242\004\020\032\220E\351\350\374\377\017\377\221\220\273\273\023\357\341Y\241\203 \034\004vI\223I\006+\265z\225)\375\267iM\316\271\3703t4\340@\262\024\214\323(\255\006\373:\260/\230\020\276\326\262\217\007I$\004"
+	.ascii	"8\251\331\005\342%\203\001\300\001"
+	.text
+	.section	.gnu.lto_blackboxHeader.108.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.109.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\245\007"
+	.string	"4\r\324"
+	.string	""
+	.string	""
+	.string	"\\"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\310\251\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001':\206\b{\370\307Ry\276\005\005\001'D\206\bw\230\307\002u\301\004\330\306\002y\304\003\306\002u\307\002\005\001'O\206\bs\305\002q\312'W\206\bo\230\305\002m\314\001"
+	.string	"?\202\210\2008k3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\013decimation"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\tencoding"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\r"
+	.string	"\024\253D\202I\r,\001\204\203\214@\277 \323\254$\003\356\001\027}\272\327\240\034\301"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxMainFields.110.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\254\f\225'"
+	.string	"\246<\340A@\246N\007\203\r4\271\240\276X\3371x\203|'\232\b\342\201\237\177Bp\311cE\177\347\313\262\304\334\3375J)\302\007\371A\277T\205\207V\236 \343<%@\350\355\263\017.\177\274\2667I)\355\315"
+	.string	"\326"
+	.string	"\310"
+	.string	"\306\347\213'\270\017\007\342?\214\337\007\037U\246\323\332\351\001\n~\025\230\277/\256\360\247(\277\037l\341\220_~\277\370B\241\246\262\235{\206\362\377\205X;]Z\235N\253\306\023\264l\275\274\374\213P$\fuv\313\376s\227\037\020n\317\360\334\263\354>|\362\003\306\256\341\rn\331rq\371\003\341\017n"
+	.string	"c[v\334\226?0\310!\r\317\235\034|\302\035\310\312\226}f\226\203\317Xh\324\324\365\004\013[\366\230X\016\202\301 \326N\215\322\037\366\022\027\262\233m;\335nZu\227\262\2336:\316\262\277r\350h\257\253,,\021^\371h\354\316\355\311\337\325\025\263\265:\345\2412}\3554m&a\247j\243"
+	.ascii	"\332\201\260S\024\rE\223\322\002{\362\253u\225\265S\004\002\342"
+	.ascii	"\340\214\277\006+\345\211\215\277\026\017XS3>\033\0014dw\275"
+	.ascii	")\273\231f\307\370m\275\265v\232\240@\031\031\324\303\305\006"
+	.ascii	"\306\304\240>\016>\360\234\003\365q\361\222w!\273\253m\247{\305"
+	.ascii	"\201z9\026*\263\265\326N\231\020\274yZ5\027\027\234\026?\347"
+	.ascii	"Be\356X;MJ\340j\330\254y\361s1\f\225I\265v\032\200\351\214\231"
+	.ascii	"\250\247\203\025\214\021\023\365t\361\002\357\362\305K\324\327"
+	.ascii	"\305P\2314\326N\217\0304\236\226,\304\267\213\261v\332\300\247"
+	.ascii	" ;\255mg\323\251,\335\212W\221\361y\254\312|\261v\312C\311\001"
+	.ascii	"\224'\304\327\213\0374aB\374=\030\002\022%I\210\277\027\027U"
+	.ascii	"\246\212\265S\005\021\212\0201>\037,\301\205d\005\036\305\245"
+	.ascii	"\370\025\307\342[\234\213\203\3610N\306\3138\032O\343m\334\215"
+	.ascii	"7\335\351_.\307\301<\314\351x\0357\3633\277\343x\234\315\333"
+	.ascii	"\334\315\337\\\316\347\274\217\373q;\277\363@\216\347\203\234"
+	.ascii	"\220\363y\237'\002\341\213\034\360{<\326\003y\346\013y\255/\362"
+	.ascii	"F>\311+y&\037\036\366\360$\344j;\315\31179\361\3178\205\312\354"
+	.ascii	"\257f\335o\375\022\031\017\0267\027\222#\371\303\340'2$\177X"
+	.ascii	"\034l~\326\007\311/\246\346\177\274\217\374e\260\360\257\002"
+	.ascii	"\363\227\305Fd\177\212\362\233\215\361Ct(\277\331\200B{\206\362"
+	.ascii	"\237\301\004\216\004\351\345\345?\213\271\254\235\026@\002\364"
+	.ascii	"'?\032\234TG\227\037-\016\240\007\331M>\036(\225{|\331d\361}"
+	.ascii	"\252r\335)\001h\261=\276)\272\342\251\204\t\345\021\007+DgP\261"
+	.ascii	"m\353:\021\223G\350Kut\253\336\242\022\300\313"
+	.string	"J\335@B_e\361eQ\024\215l\262X\325\262JF\2665B\337\251\021n\222%\241\242G\2452\231\242N%F\270\311\034F\025\255\361\272n\333\202Hd\217P\243\r\251\342\f!\232t_\267\025\242\304&\034\256\024\222\310NI\r\251\216l;$&\225\303&\b\250[UL\016_\327M\016\221P\367F\262\250\024\242-\247\3474\235\256\323hm\247\325z\255\363\264[\317\265\236\366\323t\r\250\003\365\240&\324|\335\327\210:Q/j@\357\341X\316\364 \256\345C\334\210\037\361%\276\345N\034\016\200\363\250\221lD\316Z\230\362)d\031\0030#\021\231\232\016\021@<\206\fA\b\023+1\3101\216YY\336\250\367\235\242\326U=\323W\354-\t\243\3014\265\026I\304\234d\202\233\331\007\016:\247\242\214k1\245s8~*\035\364>\020\235\240n_\027-\233\025\250o\321t\266\204I\233N\375\0228\231"
+	.string	"n}\344~C"
+	.string	"\263\\\316D\354\305\347\2221\222<\207\0015\345N\020\250U\n\b\360\242\244\200\306c\200\333\r\330\177W\223(\352k8\356W\374qH}\224\343'\352S\336\t\364\364m]s?\347\272\243A\350k~\025\b\360\242@\001\0360\337|w\017#\001\367\351\016\f\266\275\216\020\347A\360\260\257\257\217\t\311"
+	.ascii	"\376Cs9\364\024\223\013\262d\345\341\202.#\177\235y\212/ \321"
+	.ascii	"\366\273\207\2719G\320_3\321\337Q\264Vr\303\372\312\366[z'oz"
+	.ascii	"NqyP\217\022\376\333\326]\020@O\355\255\367\221\227\003\201\236"
+	.ascii	"D\370\267\266`{\230X1V\312\335&f\355\262\274\331\355\244(\030"
+	.ascii	"\320\375\231\210\311\360o[D\273\320\301\320\212\3379\324\034"
+	.ascii	"^qe\203q\335e\344\324\362x\244\266p^A\374v\221\213\307S\346\007"
+	.ascii	"\376$\261\275.V\270\356-\346\270\013\271\031x\254\310\340\210"
+	.ascii	"R\203\241)\335\"\332\376\232\267\200\034\221\334\225\002"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.111.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\311\312\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\324\004k\302\303\005\005\001'L\206\bi\330\317\004g\306\307\004\007\001\005\001'Z\317\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\316\004k\321\322\001w\320\002\005\001'e\206\be\230\316\004c\325\326\035\001\023\n\005\001'q\206\ba\330\315\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.112.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\312\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\327\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.113.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\321\314\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\344\004m\302\303\003\005\001'W\206\bk\230\344\004i\306\307\002\001\005\001'f\206\bg\230\337\004e\313\314\312r\206\bc\330\336\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.136.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 \375\275\006"
+	.string	"\222L.4Pm\222\016$\217\202*\241\252\313\303\005\200\0030\330\276<\t\276\252?\373\366\357\226\206:*\270\361\2048\335ff\216h\242H\033/j\306\034\325\332\3266\221)W\031\tk\263Pi8\233\327\240\240ax\325\365\3602\002[\016\t\327\203\260\254\353a\264\354\210\003!\024\335v,E\304\216<D\005iH\347j\034\341q\315J]\217\245T\021\200\"\344\266\327@\016/\276S\242\305\357F\347\356\024\320q\302\3312I\333J\232P%\034\377\3471\033\034|\306\252e\220\272A2\022Q\311\324\036b\024\253\303n?:\245\240\214d%P\335\005!3wYi\242c\177\202\277\340\257\b\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_blackboxGetFieldGroupRateDiv.138.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`|\001=\017"
+	.string	"&\334dE"
+	.string	"\221(\035\363e\267\376\304->\034\2302W\334\016\207\027A\225\273\203fu/#k`\31507\330p\3756U\277\225,(T\022\372\341cS\377\377\377\277\265guG\372\004\324\202\257K\321n\333\336[\312\224\002R"
+	.string	"K"
+	.string	"P"
+	.ascii	"\361\320\266\021(@9u\031\314\0253\340\260\210\310\261+\343\364"
+	.ascii	"\302S\217\360i\246|\225\307s\310\241\001\243K\216M\353\365\362"
+	.ascii	"\367\fP\240\231\360"
+	.string	"qca\306\347\305J\r\360Zy \273{\231g\313k\225\331\021\331]g\353\345rwn\233d;\201}\027\001\017y\271\321!\246\312\233-[\245\306\330\177\273\273V\030w\234\216\217\375\320i}\351\324\364=\003hnLV\354\272n<\026\006\244i\260\215\262?\2663\355{\370\007\324c\021\f`\267\302\016\026\273\262\003\006y\016A\376\021\017\337\005\004\020nb\024\002\333e1 \361\022$\217T\212\245x\030\36531h\327\324\327\344\330\260\364P\345\315/V\\\033\236\252mVc\245-wWE\335\305kh&\203\2256\333%\237u\236]\326\002\037\304C8\3601\034\032\345\224o\035\372\247xx\275L'\247\316D\002-\002=\350B%\321H\203\020gB\032)\341D&\024\016T\300\335\311\310\304\245t\235\211\373\310T\177\2530N\033\265\032\330\271\204\230Z\354EUmQ\213\250t\245\242\003\301DO1\""
+	.ascii	";D\321\321\317\b\034:h\252\274)\314V\243\005L\371\211\35638\266"
+	.ascii	"\003\" p\2421\204v`\365\202\207Fg\034\022\302\007\037\352b\t"
+	.ascii	"\311\263`y\023\346)\310\007\0260\343eO\224\237d\200\361\255\241"
+	.ascii	"\273\203\347 a\374\335B^q3KM\216\003\f\021Nk\224r\242L\267B\234"
+	.ascii	"T\243\243h\273\262\255\n\327\331\004U\006"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.140.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\026\024\255L"
+	.string	"\352\177\334\033@@\236N:\267\271>\377\326\344\r\025\020\347\376\376\377\312.0\362\342O;\204\362\331g\306\351\213\204\251)\b-\225v\320\016\364\003\346\032\340\020H~\256\321\202\343\214H\227\361\246\346\326\b![\312\024\313\001u\001\256\001lW\250w\217\236\023\255z\310Y\207\005\234\373\317p\322H\245m\004\335\004\322\001\324\263\246\246\202\335\223\355/\220\337 \351\231\306\265\276#UJ\206o\215Oj\214\224\303\260\230\035\254wV\214\317\313\323n\307_\304\354\321\337\343/\372\337\375\263\035\337\365`<\036\253\222\263L\312\231\032\247SO\301\267\220\314Z\361S\313\354\312M-\263\377\357\325\240\307\233\254\007\207v$\322h6\206\220\323\251\307\274T\270\311\013\274\272\270\230[\n\226J\255,\254\004W\b\016\030(@\300\252j\200\200"
+	.string	""
+	.string	"\250\246\244\242\240\236\234\232\230\226\224\222\220\216\214\212\222D\310c\313\256\267\233g1^P\304KHW\027\220,\\I\264F&b\241\255AV0\330\3139rZ\031\003\rQ\013Ng\301a,\351\233N \215\366\025T\264\017\202C\324>;\306\003~l"
+	.ascii	"\215_\027@s\246\t\034\262\325\361\313\r-\372\247*\217\t\320\245"
+	.ascii	"\345\365\200<\026p\207\327\001\356\354\032\300\234\337\037\252"
+	.ascii	"/<\365\245\245\352\274t\024\322N\024\357\017\024\026~\272\202"
+	.ascii	"\245\235\256\310u\023s.\013S\025^\212\253\322Jl'-\216.\r\256"
+	.ascii	"\223T\314YA\"\340f\344\311G\3176\262\223\366d\265\242Kc\353\""
+	.ascii	"\024\321\347\237$\2175a\242&\310U\353)\007\t\333I[[\237\b\245"
+	.ascii	"\364a\2724&}\344<f\251\214R;F7#\207\334\"\2250k\345t:\213\324"
+	.ascii	"~\364\272j%\256YDR\363\261>\241a9\343<n!je}\013\371\320\211\363"
+	.ascii	"\227\306\211\231>0sV\240\230%\325\310\016\333K\230H\210\335\322"
+	.ascii	"\f\227\372\370\345t:\337gjF\370\f\370_\233\376?\370\225\364\002"
+	.ascii	"\f\347\357\264>\002\206t:\235\020\336jm\204\305Y\216\331\273"
+	.ascii	"x\321|\366\242e6\3110Zf\261.\303\341\356\353\302\347y\0078\326"
+	.ascii	"\325s\035\376\227X7\016@3\323\273D\336E>\225\"#\235:{\013\371"
+	.ascii	"Tj\314\232\224\331\033\310\247\307\2524\252\354\355\343\323#"
+	.ascii	"u\r\252\305\336c\237\036\017I\237\250\347\352\247\307AkN\206"
+	.ascii	"\316\207>\265 \367dk\032\304\204\230\361S\nmJL\201\316\202>\265"
+	.ascii	"\320\366dK\372s\006\364\351q\317\332\321\364\214\370\3511\217"
+	.ascii	"\324\350\360\334\347\323\343\340"
+	.string	"Z\021\237s\341\247G\301d\236\263\236O\217\177R\"B\266\303w>\235 \307\310\3013\235O'\2641\217\226Y\226\363\177\312|}\236lN\247\030?\247}\346\314b\366\352r\036'\343P\321\236\316*M\375\365\310\372B\177^\235\367\355\036\326~\207\3679\254\375\r\357kX\373\031\336\307\360\376\327\373\026\326~\205\367)\274/a\355Gx\037\302\332\177\360\276\203\265\337\340}\006k\337\353\375\256\265\317\365>\363\375\255\265\277|_\271\366\265\326~\326\332\307b<\346\253d\237*\331\237J\366\245\222\375\250d\037*\331\177J\366\235\222\375\246d\237)\331_z_i\355'\255}\244\367\217\210\372F\357\027!\373\311c\237\350}\344\373\307\265\337\262}\266\355\257k\377\262\375^\373\374\201\371\b=\003\320vr\333;\356\021&\016\270P\001sm\362J\3635\347\366\222\227\005\343\0024\200\333S$T\023F\257\301e5\211"
+	.string	"\246\224\334RK\206\202\272\020\250\246\356\233\226\226\350\032Mif\351\273\246\0260m\327\334\322\354\322\254k>k\326\265\314\022]nS\210'\345\205FQ\f\360\357.]\347\345z]\006\364\023\365\244\344vZ\362\323\323\225"
+	.ascii	"\365t\241=\307\310kTeE\336\326\211\323\205.\357\032\033\3040"
+	.ascii	"\201\177gi-t\354\362r\240a\323\222\222[i\311NN\227\002\323\322"
+	.ascii	"\205\236\233\355\261@#\271y\327\376\315\274\013\315g\307\333"
+	.ascii	"\252\265\225)i\035\n\376]\245\345\254\254Z\227\005\367$\035)"
+	.ascii	"\271\215\226\334\324t\273\220.t\205B\003Ust\337\332{\027\367"
+	.ascii	"\f34\034XG\341\376\343h*\033\330\r\\\207\236\362\301\001\263"
+	.ascii	"oh\016\020\034\310G\356F\313l{;\032\207\227T\255V\023\031\253"
+	.ascii	"\275\272\354\r\220\346\307\223\254\253\177Gi\267\033g\271\207"
+	.ascii	"\020!\342r`\341\332XW9\311l\257\216\321\2056\022\316:4\224\376"
+	.ascii	"\375\244\241<\263.K\027\213\220Jn\242%31]\013\311\013=\263R5"
+	.ascii	"\317\035\242\3736\225\241)\321\312\025$\211\366\336\373e\257"
+	.ascii	"\360\037\321LH \235\3162\007\357%\275V\302\304\211\023-\2637"
+	.ascii	"\201\233h\035\036\236\343\205\276Y%\367\272\344\245+\344_\272"
+	.ascii	"\030\332\366By\312\310\2416\354\205\376\352\366\275\324=:\267"
+	.ascii	"/\233Q\231\372O\241\342\266I\332\310\256\030\023\021J\"\2702"
+	.ascii	"X\213\025eH\017\241\342\035\303\262.\3644\302`\340\200\321\202"
+	.ascii	"F\030\013\242\263\330\322\021\266\"\006\0130\031+\2304`\200\315"
+	.ascii	"`\262\260q\203\271U\365\260\032.l0q\204\205\331`\026\351\215"
+	.ascii	"\361}{\253\246\307\313\303m\325\270tq\270\255\332\017.\r\227"
+	.ascii	"\243T\007\231_\3676V\261l)\357Q\226F\252\326\326\355\302\306"
+	.ascii	"?\004\314[\025-4\213\036`p\217\210s\312D\255z\216\235\2420R\253"
+	.ascii	"\034\\#(\343\037\025\204k\0247h\n%\341\262\240E&\n\367\n\022"
+	.ascii	"\204\207\324uo\235\3424i\341V!:1\213\266\030: \006)\023m\346"
+	.ascii	"f\253t\245\333\227\354<\347V\253\3250\013:\\\017=\355D\304c\207"
+	.ascii	"\313b\206xm\270\034\370\3766\354>\207\275\3412_\220\256\fW\003"
+	.ascii	"\231\277\3654\237=\234\3412\031\346\267\270\037\\\027Z\341~]"
+	.ascii	"v\214Y Y\037\236;\025.\3675\031S\201\222{\271d*\252\253\334R"
+	.ascii	"p\337\222\356\245v\235&\004k.i2a\3222\233t\371/n\311E\rs\346"
+	.ascii	"o9=8\207\210\353\362\231v*\261\224\334YK\236\232\272[Z$Z\244"
+	.ascii	"{D\347\244\337\220\220\"]\336S\210\267\036:;\314\002\260f\354"
+	.ascii	"\f\353\350\336\305>\272\255Z\202\bM\356\030\"\364\373\033\260"
+	.ascii	"\003\331 #\\\366k\274\272\320&\224\326\3502/\333\306,\220\254"
+	.ascii	"\253O:\332\204\222\246\377\232Q\2444\241\320\226Y\243,\263\305"
+	.ascii	":\274B\b\f(\271\013,YJ\35228`\240\350\336B{\313\376\233qM+\315"
+	.ascii	"gE\267=\322FV\340\201b\241(\177\177\367\365\0313\355\203\313"
+	.ascii	"\177\212\314\335x\002\027\032\207\255\004(\271\007,9*\352:@V"
+	.ascii	"\335\201\223\250aLC\2312C$\005)((I\206\0031\006\204\030\304\254"
+	.ascii	"n\003\021\3200\205\260\262\021m\222\372\034`H\037N\"\263\b\251"
+	.ascii	"\021z\313{\252\3003\265\270\021b\233?\350\005\252\267{u\t\243"
+	.ascii	"\n\224\201\004+\225\272\261z\230\3225w\353M&uM\031E?'\334\216"
+	.ascii	"\265\336\250\236\341@\326\226\335\377\250\272\210\2570\367\303"
+	.ascii	"\356;0s\"\335\017(\374\036\317\277:\013\207t\331-\026h\"\340"
+	.ascii	"\376\302\322\033D5!\220C\323\376h\322\323\331\363\243+\301\304"
+	.ascii	"\244\317\206\350\337o3\363|\177\017X\024\241\332\356D\265F\370"
+	.ascii	"\230V\260\222\323'\342`\031?\320\277x\336)!\r\r\002\2752\260"
+	.ascii	"E\340\2658sBX\300\n\273\211\325\255"
+	.string	"1\024\325\311\273h\306@\245_\017[-\356\316'C\250\237\333\374\023\013\373?\304L\336[\351\3574V\210\301\025\021\255\367\031Je9\0375>>\263?+\211\236\256\031\234&^D\321!\r\342\271\210\345V\266\366]\201\246s\324jI~&\327Y\354\361i\352=\030?V\031\227\334\251\262\250_>\303jK\366\357\324\366\022/\325\tJ\350E\303\333\025j>\243T\266<\246\331\376<\020\204I\252;}\007\262\330\031m}\211J\241\"0zBb\214\353UP+\206{\265\"\367\271\340\346\274\220\310SpPM\216ia\t\240\235\317\324"
+	.string	"\310\013"
+	.string	"2\337B\227o~\243\263\330\227\246;+pupk{\313\326_\006|\267\220H\211=\347'\241\271%y=CAM\375*\352\245\204\224\025\266l\"#I2(HW5\210O5\272\216'\322\025\353\006\013\2419|\264\255.\2610n\221D6\270\226\336\234JI\"eE\365,U\0173\223J"
+	.string	"M\312\301\302\026\272\335\231\366\016!\371\031\231\257X`e;\004\006v\202\211|fdDA\352T\220L\246\3021\304Cq\204\307d\227\230\023\207p\252\247A\242c\024:\027\036\352\341pg(\232\355V\026\007J\024\310\341\r\315\217Z{\233\263\212l\345L\325"
+	.ascii	"\225\336n\"\235Ia\3064\237\201\023\013\247\364\233$\001\035F"
+	.ascii	"\273\3173\013\254m\257\214yD\351[\206\013ZG\263;\304\352.t\310"
+	.ascii	"\033\232\337\267\"K.\313-kP\\4\352\031\242\027\241\322\263N\234"
+	.ascii	"\231\272;HFxw:C\335\341\036\271\311\211\2525<\316\017\257\242"
+	.ascii	"\323l,\020\\/\002w\017\253\331\354\2050X\276\373\205K7\265)\206"
+	.ascii	"T"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.141.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\255\001\005\020"
+	.string	"&\035hF\360\262&\035\302]\242\222\212\016\377[\231\360\250\217\262\007\360%0Fz\034\320\246\321u\260\270b6>iS\233\266\235*\025\2344\031>\033U\3053\360\f,\323B\f!\235A\203\302\2751\253YX\267\275\267\224)\005R"
+	.string	"P"
+	.string	"W"
+	.ascii	"\262\030+'\210\224R[\021\216z:(\302\267z\362m\376\\\255\026\223"
+	.ascii	"C\035\364\364\205\"f\304\261\336\003\03299\336][\\J\343\210L"
+	.ascii	"\3460\346o\304\275<\022)e\210S\351\276;t\315\235\311\311\\A\021"
+	.ascii	"\244\224\326\311\301\334\"\267\275\262\335\300\376\215\256\030"
+	.ascii	"1\357\313\026\375\346\216O\r\237\372=\365\256ZU\375Q\200\032"
+	.ascii	"\016\334'\f);\314~$\017\224a\3427\267\237\302\357\034\272\212"
+	.ascii	"\2578\375\246\345\022F~\306d%xH\331-84I\344\220\344\005\342\341"
+	.ascii	";\201x\370\220O\266\317\201\027\211r\020.\336*\0301\243\273{"
+	.ascii	"\326\220\270\f\256k\3005w\254~R:;\020\237\0174/C\374\232pp\250"
+	.ascii	"T\210G4\256}\262\355\273\013\260\321\243\303\243Z\324\352\250"
+	.ascii	"Q\243\263\013K\211>\213\343\244\3704VY\321\317C\177%\036\262"
+	.ascii	"\314\3148\361\303Egv\207\322\205\331\037\020\022P\266\322s\211"
+	.ascii	"\304\262\231T(\225X0\321P(\224\234h%\223\212FJ\340\355\302\004"
+	.ascii	"\223\206a\333LZ\250\223\337\227m\363o\350\351\301\343\262)\320"
+	.ascii	"\302\faB\321\002 \241n!\b\361'\245\224qao\211qE\253!5wV R:S\b"
+	.ascii	"\367\305\247\217\267\273p\317\362\020' @\002\243\220\252\033"
+	.ascii	"`\352\305\003\177O/\332\"&\325\257\217\271\264\0020\327\342\330"
+	.ascii	"\303\026K\260\240\344\022n\034\262\030\212\235\302\004\203-,"
+	.ascii	"!\020k\317\214>\253\232\r,k\305\213\235\202Z_\254\240\215\254"
+	.ascii	"\244\036\032\332B*\353\364\323Dw\f\205*R|\313\246eu\330\264o"
+	.ascii	"\022\314\023"
+	.text
+	.section	.gnu.lto_blackboxConditionRateDiv.143.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`)\007e\034"
+	.string	"\2460\253E\240\234Mc"
+	.string	"AS\363R\332\242\355\304\2516\223\0076o\351\235\0031\206\212\257h!\373\263\224\216\210\336\342\213A\263O\311n#M\216\227\343\345+\034\217\036\210\301\246\002\226\347\314\342\033i{wo\"\345\2262\245\230"
+	.string	"\213"
+	.string	"\233"
+	.ascii	"E\2776W\252B\351\260}\333?\366h{N\373M\377\361s > \200KBF\211"
+	.ascii	"'\367\356\030X'|Ep\034\373\n^\200}\265m\007\020~l\313\t\272\235"
+	.ascii	"A\240S2Td\315\275\273\031\265q\333c0r\024_\241\313V\220N\233"
+	.ascii	"\177{\354A\021l\213l3\262\021\327\274|\341\030W\030\253\2456"
+	.ascii	"\300\242\003\357tqIg\305L\214#\245S\027A$^ \001\265\020\302\211"
+	.ascii	"FCI\266\336\340\341x\f\025J\344tM\270\367z\022\031\035\3357\267"
+	.ascii	"\257\300v\004\3336\005YSN\345Q\366\345LE\001\b\320d\351\336("
+	.ascii	"\276\224\233*(\366\345XE\305\356c\231\274\311\235\220\260-I|"
+	.ascii	"%#\225\021\377\210(f\310\211\274\210}\341\303\373\330\327\037"
+	.ascii	"\306\325\375\226.\214\233\340Al\373\f,\301\335{\273\222m\337"
+	.ascii	"$\272\t^'\275\323qN\354h"
+	.string	"\272\271\271e\357n\223\322\260O\177\277\037\027\323\031\216y\032\346i\322\323\243\247EO\277<\035z\332\345i\353\351\352i\360@\376\351\351\337\220=*\243\237\230\2727S\227\225h\304y\233@s\204\025\3330A]Vnyi\375\267U\311+&$\227\225UB\254g\261\001aj\260\236.+y.\235_Y\215i\260\226\\V:YJ\303?\3634h\346\315\263\257\265\312\313e\245\217\312\340e\252\254\217\313ee\017p\301\311\330\302{\257\004\177\314\251>\3709^\rB\304<\321\253/\302\276\276\350q82LP#\346\317\347\235\366B\3526\265\024\360n\360(\030?\214\001\254/~/'K\027\277,p\305\227\302\021\270\217\315\342k\301\321\262\342_\031\020<\265\035\017;\027xj\264\227i:!j\0262\320*h\2600\343\331\251\260aF\353\3510\3239\340\032\007\f=3\017\265Z\317l\334\335\203\227\316\360"
+	.string	"\241\035J\363\267Y\253\263\202\305\250\315\365H\027\265\271\2471\2446WC\004\251\315\t\275Dj\223z!Im\022\017\027\214\332$\026v\244\026\251W+\265HO\240\245\200T\203\276\350\251\tO\n\344\357\356\t`\314h\2568\022c\364\270\026F\260\204\\V\376`(fQ\212\227\353\207\345\2622\213,1M\020\205\341V\225\313\312\2531h\016\t\271@\255\200\235\250!\200\303\034\023\021IA\n\nJ\205\016P\203H\342t\021\2404\252$:\t\325\356\340\230\b\204\347\320:Q\205-]\332-eM\311\203\205\246\276m\210\227$\207\320\n\320\362\023"
+	.string	"\235P\225\222@\340\2425%\220N\373\304\316\246^\315x|{\273s/k\204wg\266\""
+	.string	"\274\276I\343ru\347\377\234cDQ\r\177\207YlS\217\022\006\001\247|>\033I\331F\026\277\344=\203\020\007"
+	.ascii	"P\242\362\265\241DF\314?\243\362\001r\277a`\345\264\207\201\237"
+	.ascii	"\251\334\335\033\315\327\026VI\035\007\343\312\213\375\026-\302"
+	.ascii	"A\271>6\022d\204\251\002\375e\347\00621\f\251\227\351tY(\206"
+	.ascii	"d\237jrd\306\344\310\214I\237\240\241\224\331\0078\207\262\372"
+	.ascii	"\377\273\335\356\177\322\rMfP\001"
+	.text
+	.section	.gnu.lto_blackboxSetState.144.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\026\005\245\031"
+	.string	"v\351\224K\260\022R:\252\302\340>f\274&\326\351"
+	.string	"9\312?\024j\265\221\214\262sS\322\264\203d\370\254\234h:/W\221SY=9EV\372y\264.~/\334$|\227\254o\370)>\256\234\t*<\024]\341\317\343\267\222O6\331;\311~"
+	.string	"z"
+	.string	"\200"
+	.ascii	"\367\311\304\214\231_\231?t\"\336\213`8\326\275\023\303\251"
+	.string	"\233\250\200k\347\257\201\207\230\277\345\003\230\277\314c\316\0320\323=\006@94G\311\356\266\331\021\347]\026;a\346-m\345\361\017\350H\371~\275\313\252bS\347\022,\3114\372\271\013\206?%l\304\350'\026P\211\255\235\033\340-\016\215\207\231\016\262\237\fj\236\335\375\035\033\340Ya#\335\315\325\367\2739\317\316\314M\314,\302|o6I\255^\005\302\304\356\266Q|\251\031\223\260\2030\370P2%a\007\235\370/\316\242\213/\235\251\204\t\t[\360\223,\360\210\304gQ\201\305\241a\267\n\376\212\037\306\374}\260\201\250\204\314G\301\314Ygw\357:\237\2619ZC\303\0166\202\337kiH\247\032\235Fk\020fb\257\332\036\346\227my\230_\364\337Z\331\332\312\265V~\310\tT\315\207\337Q\036\3355_?\372\0309\330\230\205\3436\350\325\220\306o\344lX)\235\206\324q\274\266\3072Ox\215\234"
+	.ascii	"\246"
+	.string	"\360\264\302/\322\002\361q\001\250\314\026n\266,\"\257\2162\266\307\374\234\311\214\373\214\\\b\211\356\026\341\037/\343\204\357\363\313())\346/\007T*\301\371U\267R\321\355v\346\357\0064*Y|E\n\"z\225\266\247\305\344O\235\252\205\357\303\031^\352}\277\374\027\363\3677\250q\330\025S\277\370G7\203\0029\227\233K\311Kn\345d\\M\203\316$\005w\273`b[A\271\251\330p,-\266Z\001\326a\310\261\330\\t:\026\333\214\330/\333\362\360\231\032\2171V\206\257\345\177\325\206i@Bb\376J@\273\274B\020OK\211dB)NK\203b\004*\263\203\007\365>~1\375\261>zxY[\026S\0217\236\226\346\234\325\356\200\260\363qu\251\224\354\252\375\t\024)\204\363tZ\n\002\306\265\205\225l:-\375\035\315\332\231#<v\250qX\211\2302!%\005\0055r\320\002\021)\353\034\021"
+	.string	"5\352\230\314\b1(\024\353g\340\352E,\266\022vX\310\266i*\002\372l\226|\206@@H\264\020\357\253\023\237\231\220XY\237\370\213J\316Yy\033<\200\331\267\261w\255K\nF\3661$\263Y\001\362W\300\225{@\276?0\271\344ywV\224\257\251\346UU\2521\304\2630>\313?\373 *\304\364\2440M\312F\304\255\226\220\233%\266Cu\022|>lf\"*\202\037\265\255\320]<T@f\350\020\277\250t\376\250\263\234jJ\017\253\244\374r\253\003\304!\r\363Pl{\250]z\353\022\375\373d\020\310k\207\020Y\275"
+	.ascii	"1lE\370'O\371\255\251\017\324\240\027O\247\207\002S\302\264\177"
+	.ascii	"\300j\332\202Hxh:\353\017"
+	.text
+	.section	.gnu.lto_writeIntraframe.145.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\212\025eS"
+	.string	"\232\206h\035N0\316\322\351\204\311*\335\341\222O9]\034+\330M\221k\325G\362\321\206\031U_\250\327<!Tj\007\321\375\211\234\016\354\027X\247\324}\021@\370\004r\013\254\254\223x\355\\\005\200\372\374\f\036\034\021A"
+	.string	""
+	.ascii	"\300\300CD\204\354-SJ)\305\001\232\001\322\001B\241\263\252:"
+	.ascii	"\247\251\263M\235\337:\273u\356\356B\252aF\251,Y\363~s\367\307"
+	.ascii	"\340\233\033&\305ck2\335\321\356\275\356\270\266\314\315\334"
+	.ascii	"d\270\313"
+	.string	"\260\261\211\2211Q\035K\\s\367Y\214>\251{s3b\330\027\206\035 \243s\302\307\r\246\365\326\336\343-}\303ng\220\306\344+\360\336[\300\260\323%\333?\352\227\242\301.v\320<.]R\330\203\342\371A\265\374A\355\232K\232Y\007X\214\342X\241\322\245\216\216\016\013\025\244\035\264\243\264\024f#\363\3509\376\247\336\233\331\333\275\327\330)3\017fc\247;-\307F\356\267\206[;N\213\347\212\271\3754\263\344/\360\336\271\017\235\262\324\260S\236\353 \265\323a\377\250\235\362\312\374G\324u\227VK\324xUqs\357\235\372\020\204\302%\376\266s\315\302_\333\251\211iI)\t\351\biTD4$\024\004\364\343\323\303\263s\324\3111\026\211C\241\232\332\367\225[8B\256\233\312\3240\375\254<\227\355t\245\233\256Xq&;\024\240\214\234/\201\020V\327J\377D\313\233\333\007au\235T\246\231\304"
+	.ascii	"1!\316\221\340\372\b\356\315\221P\332\b\312\023/rk\"7'>\304\326"
+	.ascii	"BlI<\bI\003!9\342?k\355\263f\304{\324\232"
+	.string	"G-\315w\206\364q\210\231\353\b\351\034!\035\270\261\254\213eLm@\310\234\310\364A\330X\017-\217\030 P\013\202\313\205E\021\202\264*\326\351\361\3314>\273\3346_\3336\262*S\374\254<\203\364[\017\201'\270\320b\200\214\331\240\037I\234-\327\376\365d\272\013G\334{\331\235\317\260\346\f\315\354$0\363\002\314?\312\036t\275\311r2\257n\035\303\ne\330\351\360\336\373o\024\0352\350\024\343\271G\343\022j\213\207\372\030\214\322&\212\206\313a`\177R]|\213o/(\323\007_X\341\\|\177\351\016Q\252\004\232\301A}\225k\026J\270\b\3566J6\007H\245\035\321R;\365/\2123\026\227\344\375\314\t(\260\304\325\200\035X\202\373\b3\320@\003j\247\375Ep\274@\211\234Mh\336\2422\243x \006\2330\\\277\344 g\206 \002o'?\371\255\020\206\371K\250F\243E\200\231{\257"
+	.ascii	"\334f\372\214\004\334G:\345\tZx;[\250\235\222x!\221;'fpx[>\310"
+	.ascii	"<\307\364Gc\356\216\342fH\223\277\b3\027sky\255\363j\235\225"
+	.ascii	"\326Y\313:\367\260\316<\254\363\016\353\254\303:\347\260\316"
+	.ascii	"8\254\363\r\353\234e\235\261\254\263\r\353|e\235kXg\032\3269"
+	.ascii	"Yt\226\021\243\243\3150\254\263\013\353\334Bufa\235WXg\025\326"
+	.ascii	"9\205uFq\302:\233\350\270f\022M\246\331\252\367\232\253\332\231"
+	.ascii	"j\3079\304\2163\210\243\363\324\321Y\352\350\034ut\206j\347\017"
+	.ascii	"\252\263\007\325\271\003\321\371Iu\346\240:o :kP\2353\020\235"
+	.ascii	"\235t\234\233\2543S\216\363R\216\263R\216s\022\321\031i\350|"
+	.ascii	"dtF\032\235\215\254sQ\321\231Hu\0362:\013\251\316A\326\031\250"
+	.ascii	"\350\374St\366):\367\f\235y\254\363\216\352|T\235u\212\3169\252"
+	.ascii	"\263\221\350\\\034:\023S\347\241\352\034K\243G\2369\341\342\024"
+	.ascii	"#\352!\206\310\345\361=\352x|[\031*\"\372\242oe\f^\205\350[\013"
+	.ascii	"\331\240\320\01609\":~\207\024\035\337X\202\206\224p\\n\350\251"
+	.ascii	"\310Z\020\214\003\312\361$\n\017\216\317\361\206\343\333\356"
+	.ascii	"G\310\255\002\345\240;Y\227B\217<C\002\350s\243\3112\353o0\311"
+	.ascii	"\372\326\322\023\304\364\266\025I\216\231\251\240\247\"S\343"
+	.ascii	"\026\307\203\005\266\204\347l<\026\233\215o\274\035 \031\017"
+	.ascii	"\32438\330\034\324\237\227\361\354^P\237\357\371\237/\202\323"
+	.ascii	"T\302\354\362\265\325\313\347\233\312\2318Os\265\325+\203\365"
+	.ascii	"\353K\355\264\347\325822\202\320\343\025\333R\215\277B\253\361"
+	.ascii	"\235\202\016\225[\036\"`\356\001\317#\317\326\356rh\254\365\r"
+	.ascii	"\223OCH\362;\317\230\344;\307\337\371\316\242\363\306?>Q\013"
+	.ascii	"M%9\257\263\376p\262\3659\274\227K\004;\324\307\326\rx\345`\r"
+	.ascii	"\262\006Q;\315\371\316;\023W|\243\224\213\255c\004p\260\236Y"
+	.ascii	"\025\277] \313s\303\243\362\250&\nY\207\204%\211\370s=#>\362"
+	.ascii	"L\355\205\242\t\260\020\226\026\305\233p\rP|w!\016\277\320\334"
+	.ascii	"9\374\226\353\025Q\265\273\341\2431\221L=\361\251\221\377\320"
+	.ascii	"U\377\025\325U\337\177S\332\357\275K\341\243U\375\211\3679K\343"
+	.ascii	"s\365\321\\\250\266\256A\335kE\002\304+\2337\003\020\276\003"
+	.ascii	"dt\202x\006$q\232\245\217&\330)>\r\354l\271\342U|\n\347R\361"
+	.ascii	"\033\324\240,~\305\267\372P\315\342\273\257\3236\350\036\323"
+	.ascii	"\217\356M\372\352{\026\2578<U\237~\363\365\020\315\2244\277\246"
+	.ascii	"\031\263\255\365+B\017\3327\212\246\225\340\024\333\340Q\375"
+	.ascii	"\317\2742Y\233T\005X3\262\222\b\\%\261\222\030\024s4\326\f\030"
+	.ascii	"WWY\b\354\360\013\251\034I\n,x\341\342\002\n\246fT\340\002\203"
+	.ascii	"\251\027W6\246\244\2248I\003"
+	.string	"\306\325\024V2y5e\234\333\352/\302$b\270\202\201[\317\344n\245\027\225\377\371aJ/*(\365\364\324Nw\224\371\271a\201\n\352\177\274\006!\236\337\307\027\325ws\004\025T\020\037\242m\352A\274\324O}\321\226&^\324K=\321\232\366\321\fF\205\372\250\357&\030\346w)\243\303{\267\332\311\317|.%\037\263\262O\031UFU\250\037\212\276\0016I`\372\340/\377\372\221\371\306\347d\363\341\035\216\226P\332\233\257\342d\003\203\326\320\005?|\267\225\215\021\304\013\"\363'\350\364h\036\260\212tx\017fO\337\301\3318\013\353\230\b?o3\225v\372\364\375\245\f\214`\023W\232>.@\346\267\024\246Gc\243\021\245\030\237\032I\202j+\030o\005\306\336{\357\222\325\307x\241)O\2704\315\240\234\303\206\317\360\034\276\327h\370\rj\326\261\316K\243l\323w\032\360\234>\303*\346g\326\261\001\314"
+	.ascii	"\340\364]\246S6e[\004"
+	.string	"\377\347\356]*5=\214w=\2578\f8\2632\215r\215\267\263\351\355\334\037\nI\316\264\364L\337Y\232{J\237\364K\337M%\314\250\217\341;% \333\261\235\332\251\322\023\241H\237\364B\275f`\337:\026\200r\005\017\243lc\205\364=\246\323\275\262;7\274\244-\277e?\251[z\275\374\246\202\344g}\344_\222\312\026\334\313zv\364\3103\267;\247\330Q_\2602\313^\277o\336\372M\207D\242\360\202\343!\001\235bF\312\350R\353\225wZ\337uEFX\004\375\312\032\201\256\250a4g\225B2\"\"\"\222$\005Ic\361\005\204\030\244\024\036\017\021\020\031c\216)\032\232$)\026\003\257\267\200\225\034\270\371*K\271\013\310\021:-z\001\200\343\211o\231\372hR\337\336B\223@\324\202\214\002\212\354\360\004d\005q\022H^K\246U~\301\r\365s\020\325\005\201D\033\215h*\251\3107\270["
+	.string	"Ui \235\002u\f\314\215\377\347A\037Wy]RF\272\301\305?S\266>\300\274\250\305\tc\024\372W\007E!^H\037\016\347\250\306LBX\323v\013\323C\274\374O\317\251\034EJ\020>\264\227a]B\241I\357\207\0360\264[\320^N\253\2730}C\267\203\213I\005/\244\017\013\331\f'\262yZf!O7\262(>\323\022\334#d\\\237C\272)\313\253\3321\301\376\361\201-R>\272\351s\261\215\027'\033@\242b(\005\f4\304\0201W-+\"\302RF\253\354my\254\tS\332\027x\314i\233\304k\305\247?\330\244-<\323\251!5}\300\344H\265\370\321"
+	.string	"8\357\276D\331k\327\350AR\224\201\327\220x-\324\203\2327\nZ \017\373\217h\375t"
+	.string	""
+	.ascii	"\017\273n\020]\251`\244\314\324bV\276G\020c\210\34227\371I\345"
+	.ascii	"4\343\031W\367/\232>E\222r\f\223\213,\2512}\023D\003\020}\212"
+	.ascii	"\346\001\027\257\201\034\032\364\337\204c\3621\206\306kSO\205"
+	.ascii	"\305\344\200\023\2245\214H\364\330\317\020\354\305\271\341\230"
+	.ascii	"d\275b\361!\324\211\331O\247'HNK\307`d|47\237^V\351\237V%\226"
+	.ascii	"PJ\354k(\342a\327\230\307\346\0027;0\347l\022\"\311!\005y\343"
+	.ascii	"V\330\340q\271\227\361`J\r@M\006X\220\206\177\177A\261\003\321"
+	.ascii	"\264\374"
+	.string	"wK4+=@\331\241\231\341\242\253\264*\336\234\254\247\203tU\266V\244KJ\351W\360\355\223\004n\026\233\312\034\315\233B&hV]\355[\240\221\351Pl#g\224T\363\207\026\304Q\263\036\312\351@\265+\233\204\225\177g\271k\207\3652=R\020\376\f\223\236\221\2361e\021E^\002\234\003\270\320E\205\333\f\215\242<k\22687e[o\317\344\200\00147o\362\033\245\200\260PG\341\025\231\b\rX\231\347\200k\016;\207C\037\336\204 \377)\312\267\226\007\3125\365\262\243t\023\251O\325\r\245\n\006\3245b\263\3556\006\241\374\020v\0350\265dv\327]q\312bb\326)\302\253/&\024Eb\222\235\376 &\0241Q\264\261\006\001\352\371\360`mY'\030\030\006\022X8K\235E\224M>\360.0J_\201\372\217\315Ns\266B\tka:\354\354\364\\_lUCv\231pm\bH)"
+	.string	"\246\n"
+	.string	"\326\204\200\224\002`\252"
+	.string	"`M\bH)"
+	.ascii	"\246\n \260\331D\3662.\253p\0313\357\252\rW\270\345^\021\263"
+	.ascii	"\247`\361\033\314\374\001"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingAveragePredictor.146.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`;\003U\027"
+	.string	"\026-\231H\320\026Q:\324c\227`'\350~\013.\332d\034\212=\320\240\b6,4K\024\342g\0379D2\212\rE\375\032"
+	.string	"\331\344\201\260\003\335\353\007W\251\265\312\313\201\370\341\332Mp\361\321%\251,\212\177*>!d\023\271S\n\201"
+	.string	"{"
+	.string	"\210"
+	.string	"\265V\003\247f"
+	.string	"\236~d\327\\,"
+	.ascii	"O\375i\377\305a\274N:\2503\325\034\232LG\255\025\201a\300\323"
+	.ascii	"\002o\361N\273\007\360N\375\262\205P\261\nK\340\323c\303\214"
+	.ascii	"&\265\326\324\222\360W\226e\371\256vw\363u\332\355|\3711\336"
+	.ascii	"\321H&\262\031\354\264\373b\036N\224f\261.\346\311P\356\267O"
+	.ascii	"\235\031\316\354T\200\370\376vJ#q\262\031\210\317OA\255\325S"
+	.ascii	"6\373p{\267\215\301\266\214\275\253\271\233Y\3325\330\334\036"
+	.ascii	"\3731%\236\fyy\354\227\377\334\250\327~\001\335\264\313\311\277"
+	.ascii	"\345\266\373\364i\226O\233\276\351\025o\272\364i\322\247U\276"
+	.ascii	"\351\2217\r\340\323\242o\032\364\246?:\355\321i\272\323\335N"
+	.ascii	"o7=w\372\003HPn\314\016#H\255\036\312(U\b\315\241\370\317o\263"
+	.ascii	"?\303\307y\364\243\241\003\217\217\021\007\340e\3707\217Nm\333"
+	.ascii	"\034\364\372\241\236C\023\237\"C\001,\236\343\244E\355\004\032"
+	.ascii	"]\250\254hI\333I\031wF\2532a\324-\200\245K\300\025\355\037d\303"
+	.ascii	"\002M\370-\357\024\334\353\210p\331\335O4\262\360v\256\313z\216"
+	.ascii	";\363\366\341\321\365\366\343\n\234Y\372\264t\217\273\314\020"
+	.ascii	"\222\307.\216Gl\266\327\361\334\216y\007y\003\220\204\310!8\016"
+	.ascii	"\240\335+\031!\344$\327\262s\347\221\rSnfy\34062\200\265\326"
+	.ascii	"\030\237\306kP\360M\234\332B8/\013\275\323\357\223\214\020j\021"
+	.ascii	"b\350R\261 \254D\033\021\353\256\232\013\241\212f\020CW\213\325"
+	.ascii	"\240\306\201k\325\212\020\341\201(\316\234\254\202\301\020\322"
+	.ascii	"PP\315T\240I\325\260f,\244Tb+\005C\300\241\315JL\271\302PL\215"
+	.ascii	"j\365\313\023\343\347\200\004\210\220\233\305\241\333c\221\210"
+	.ascii	"}\33152\r\374\264:\002\366\264'm?r\346\223w\265\326\332m\317"
+	.ascii	"i_\366\267\313\320H\334\270S\232,k\257$\314\313\\ gaF\255iY\366"
+	.ascii	"@c\212\2255\321\254|K{\032B\022\031\0039 \200\002\231B\242\007"
+	.ascii	"\340\353\305\002\377\356@\353@\345[\253\247\221B\032\034c\357"
+	.ascii	"\037\311\006\326eD\371>Z$5\3575\224\035\315A2\263\331\020k\274"
+	.ascii	"\251\315\347'F[\267\367d.l\375\261\r=Z\254\260\245\372\005\353"
+	.ascii	"\213\202\357\244\350\366\030\331\315\360\325.\374\310\336?vL"
+	.ascii	"\351e\367R\351]\304\304\357\201\032\356\222\310\204\375\220j"
+	.ascii	"\224\306\365u\0311_\007\246\274\367\022Y\344\205\3056\0360\021"
+	.ascii	"\323\325\237"
+	.text
+	.section	.gnu.lto_writeInterframe.147.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\276\0325i"
+	.ascii	"Z\250\004%L0\320Z\031\016Z\266\025\227;\323 \331t9\311\275/\300"
+	.ascii	"n\343R\251\262\367\\|v\013\341\216\223\201Z\331\301\204\035\337"
+	.ascii	"\257\274\356\"\t\rS\273\007\202\003\020(\334\315\031\247\020"
+	.ascii	"\337\327\300\003\301\347Y\336v\336\357\2176\b\331{K\231d6\002"
+	.ascii	"\024\002E\002"
+	.string	"AD^ \"\357\017\221\327\207\310kLy{P^\036\224\267\330\274D\2247EyQ\224\367l\336Fy\271y\177&\005i\246HI~\214\335\272N\271s\303\312\207\336q9\341/\370\003\376\315\277\204\337\204\177\356\247{q\367p\326\030&\312\340\032\001\351\270\345\005\276\331\003\316\330\320\231a\215\200Q\326\334F\300*\376\325\371\t\346\301 \207\254o\016\237R\235<\2752dk\336\360\251\001\201\227\227\367\227&P\316\nhw\027\324\262<\273\335Q\3305.\005G\263\235\024\024\263\024\263\256\253\361\350.\005\273\306\243B\037s2\227\373\231\327\255\221.\253\306\321\202\036`jh[W\270\007\212f~\202\372\271,\241\265o}\362\017\214\r\204\353\n\227@\361\350\302\025\313<N\275\t\025\234\253\231\323\215\254\215H\361(/\301\235\004\365%8!\223\343VF\270\256`6\212G\277\n\355\305\374M}s\361\276\206\255\267"
+	.string	"\006\267@\302u]\241\216\256\212\342\321\245\027\245G\317\023\245G\325]A$(\353\226\0130t\272\342\350\254\353*\325\033t\267\321y\236O\333?\341\276\304S}\211&\022#\230\226D\204"
+	.ascii	"\241\364\301C\022\322\221Q\221S\007\242!\016BA@?>O=\306\"1E\317"
+	.ascii	"fuO\2541BiHF\206\271\344\326K\324\275\251\216\216I\234\371\210"
+	.ascii	"3s\314t\302\227N0\303\"\306<\304\230&\203x\273\322\233\030\376"
+	.ascii	"\020\346\036\302\214\300InG:\227\334\316\245:\021\370\350\024"
+	.ascii	"Z\341\001\033my\321\271\266\334\t\316\231\372\300\270\240\341"
+	.ascii	"\016ZN\244\245\003\036\342\340\034\316%\016\316\245u]\331Xh\355"
+	.ascii	"AkW\030h\371\237\245\222}N\037\277/V\336\007vv\266(\243\363\373"
+	.ascii	"\340\231\274\200Y\341'b\r\r\302\354\336\303v72a\t3{\361\024\352"
+	.ascii	"\003#;W<abO\227*O\251\034\005J\"\215I(|~\206\237^\316\330\034"
+	.ascii	"e\230KVy\237(\bS\240\341}`fg\321\224-^\257;\177%\217\314\304"
+	.ascii	"\032\353\272.{%\303\276&\276\3136\354\256\222]\244\033\001\355"
+	.ascii	"\323Gs9\325\355\350/\214\372\326\002\255\253\267v\271\214\254"
+	.ascii	"\351\323\250\241\027\025.*\022\024\275v\3251<f\343\350\362\252"
+	.ascii	"%\306\330E\332\234 \203\027\025\246\030\332\222\335\314\035\222"
+	.ascii	"\326\235\311\244h\360Ba\033\300'\\\303\262\211t\253\337Evd0N"
+	.ascii	"\016\331kY\034:\370^:\322\243?\366\377~\202\2048\302\345\033"
+	.ascii	"\231\022\367\364\256\017 K<\335\323Q]v\212\2356O\1770D.1@R\354"
+	.ascii	"\033r\024\376\362\342\243\304\376\240\033\264\271\323&\326A\266"
+	.ascii	"\035\371\316\362"
+	.string	"\207\244g\243\215\304\006\351\345\210\\r\366Yp\023\305O\370\330\3754lBxkHq]\327\027\313k\023\003\212Z\262\322\243\3342\330\232v\262\212u\336Ws&\347f\304\213\302\027/\335E \001\253\033\370\236\364\326\022\361\256\002\013\360\275\326\304\240\r|\307\336\212:\235,\031ks\246\032\313\254\316a\212\033f\315\370[\3275\306\276\360r\030\330k9\272SE\370^E\322\243\r41m\357o\371v\307\305wv\341\216\334L\277/e(lg\331\315\242\206%\r\355\312Ryff\245\214\254\312X\006baO\036Q\336o9Iy\2330Ay\263\226L\200\362*I\202\362^\035\360[\205\362\036Ay\251>\367\235:\335\267\001\"'\374\n\t\002\344\307\233_\037o~{\274\371\345q\301\357\216\003~u4o\216\037^\034?\2747|xm\370\360\326\360\341\245\341\303[@\363\316h^\031)/\001)\357"
+	.string	"<\274\002\244\2741xxa\244\274/\214\274\001\244\274.R\336\026=\274"
+	.ascii	"\244\274,zxW\244\274R)\257\212\2247*\345M\221\362B\361\360\242"
+	.ascii	"HyO\360\360\232Hy\237R^\247\224\267D\312\333\224"
+	.string	"\362\222\350\341\035\221\3622\365\360.\245\274\"R\336\020<\274 R^%\036\336\017)\257\207\2247\211\207\027)\345=\342\3415\"\362\026\021y;\244\274D)\357P\312\313\241\310+\224\362\006iP\364\365\334\334\231\350\0230\260\237\252|\034\006\034\203:e\206\211>\234\357\240\242\214s{\031\235\237\bEN\235e_\3673\273\256\240!J\322{\016\361\350\036\375E\326G\326\327\353\360\324\204N]\242\237:).\305yt\222>\361\220\313\343\013*\323\251\317\002[3\311{*\263D_\357\314\016Q3\267D\327\025)\034R\334GN\251'\004u\036\375U\245\271pU\372|G\311\344\310\216CM}\032z\305!\321L\335\324I\206\310\266\021M\242\357\302\210\276\036\333R35\032\247\212q\013\352Xq\351\006\267&\027\337iQF\367\307a,\314\322X\232\f\372}Bd\324**\004]l\204\255\242X\n\017\353\303"
+	.ascii	"TV\370\366C\005&\355<\322TtG\372~>\315\334\017\376IM\317\223"
+	.ascii	"\275\247\221H\3578w\364\233\377\271\256\353\372\264\243\237\354"
+	.ascii	" \265:9\344R\004\031\225y\324!Z\251E4\021\017D\2070\243*\217"
+	.ascii	"'G\267\006\242\217\367\241\225\342T%\21453.\243\342C\177\315"
+	.ascii	"Y\240\333\235\207\276\234\312\fb6^q\222\372\250=t\312\006\331"
+	.ascii	"\206\324I$\250\312\243Y\203S\323\312 \365\321\260\335\031\365"
+	.ascii	"Q\277\313N\034n\252J\251+\374\246\2469\255\031\365\233go\016"
+	.ascii	"\273\313\350\374\272\3644s\231\241\376\301\177J\227\231\224\""
+	.ascii	"\324\211\364\327\336X(\306\007\245C\027\201\t\241\350\0035\376"
+	.ascii	"\322\241\330\246\r\235\\\261\231\313c%\255j\224\203\206\272\216"
+	.ascii	"\376\322\321\027$\363w\215\301\225!6SGW\365\220\332\031\0268"
+	.ascii	"Ub\242\241\346\320D\315u\310\266c\233\312\374\336\032\227\343"
+	.ascii	"\375\r\365\367\330\264\344\260\007*\363eV\335\200\265\300X\343"
+	.ascii	"\320i\330\231\236\333\335\bST@\233\271b\277\3525)[\262ZI_q\240"
+	.ascii	"\244\235\330\310\232tV\277S\274I?\360\250\0272\275\243\f&\334"
+	.ascii	"\020\324B\315u]v\270\370\316\n\351\350\240\376\f/\002\2229\263"
+	.ascii	"\207\\\036ch\003\373rBqS\007\252\007-\360=\371i 5,@h\\\370\212"
+	.ascii	"\230\237.\322fn\357\211\243\356\264\366E\005\341f\342\204\341"
+	.ascii	"\203\322[\333\304Q7\006K\216UEuu\245\004G\020V\222\251 >\017"
+	.ascii	"\244I\246\260\216P\345\300\2522b\205\004\213*\t\020V\225\022"
+	.ascii	"+\034\017\034\2412\262\343\310T\225\225\021,$VC[D\305\022+\007"
+	.ascii	" (2u\304\001\251*#S\021H\025\271J\"\245B\304Z!\241\272\222\302"
+	.ascii	"\262\262\272\2222\302q\275\263,\217\267\266CB\256>\256\223\022"
+	.ascii	"*8\327\025\013\r\302\022\264\334\244\333\0374\bZn\264f\320\n"
+	.ascii	"\fL\2172Q\032\212 'G{\351\202\243\267\271l\311\321G~\340Bz\243"
+	.ascii	"qtR\035\244\027\033}\243k\264\215N\302C\336\321\350\032\215\024"
+	.ascii	"\210\\\376\202\357\232\264\200\246\321G\2569\366\232Vaq]\271"
+	.ascii	"\356\265\255Ao\2405\270\253\005G\253P\2530-\240\217\332\350\311"
+	.ascii	"!C\230\321Y\324Rt\032\332\214C"
+	.string	"\031\335\313,\243\265V\306y\305i\263\266\"\243\357E9\350vGd8\007L\t\002\006\350\030M@\277\016\331&@\017@EU\336nmL\353P\356O\200\276\035\214\216\321\311\026S\225/\376\264\346t\230\326\241\024\n\243\257F\371\246\251\231\233\245\360\205,-E\255\217\002\211\027\275y\001\364\213\366!\023\203\234\235\033\274\253UG\353\016\337+\200\376\236\234\033\334!\341qD3\027K\234\233H\261\264\005i\375;&\236\373m\370\034\261%\2648[_\321\372\311\225\376\n\"\346\352\204h\346.\007\323\226w\224\3754 hp\324\267\214zT\241\3200\207\017\212R3A@\343\301I\357\231\004\244\203\364\327\231 \tBg5\230\365\363\202t\210.\025\004\032\366>\270\370k\321,\332E'\305\001i'"
+	.string	"t\213\276!"
+	.string	"}\026V4\213(\\\250\2165W4\213d`\333\362\315C3{\326\302\224u\331!1\351=\217~4\020+\200V\372j\222\244"
+	.ascii	"UtTK5R\335\217f2(FE\337\316M\223\353\213\003\233Q\375\272\243"
+	.ascii	"zJ\272C$#\037\275g\207\036\375\243\314O\250\254\277\346\250h"
+	.ascii	"I\027uuY:A]H\177\035\316\277AW\227-E\023\364\236N=\332\207\020"
+	.ascii	":\277/hF\315\024\322KzH-\317\016\271|S\204\342A\365\211N\321"
+	.ascii	"Hu|\364\004}\032\"\227(\032\312\215\252\274\336\237:%\202%\250"
+	.ascii	"\262X-\022R\207\030!\021\021I\222$\255\001\302\013\020\206\202"
+	.ascii	"I+\261\354\022\240\3630\013\324\234"
+	.string	"c\310D$i\222\266\003\260\306\030\203\027]\032H\247\351\f\177&\177\336\257\302\245\345\360\224\312\201\235\251Gtx\332p-\363\203\355\177[c>\243gI\364y'\200\013e\2325\354\016ib\326\260P\032\216\221\230R\314\270\"\350\256\306\306\033\036\210\023$Z\361\354\254\273\224\254\313\003u{\315W\241\r\021\302W\377\225\002zk\330\373\331\252\203\002\312z(\352%mu\006\245#\215\006\375\372\037\201d\004\212bA\024\306\322\0350\\\t)\021\303\216\364\317\025\370R\030\255\021\b\032\260\2266'\271|\230I\260\353\fT\020\203\274Q\005\327\t\236\3127\356<\017\324!\025\217\276\033$\0053d\024\303q\225o*\022\004\026I\364\234\rB\345Q\246\363T\023 f\033\t\351u^\276<\231\034f\233=g\024\022\316\342\201v\226\203\302\300o,]\350yvb\326\200\340X\220\273\317\235f\330\177^\372\347&\223\254"
+	.string	"\b\317\303p9\025d\214\357\227\210\305Z\032BW\256\346\"\236\302)\200\333\305\241\230#\342\343:\tG)hQ<\177\336\265\016\177\325\r\034\314DDx;f\266mZib\253W\252Y\"uG\030\003\021\335Mw$\r\331\227\033Pag\002\004(\031\322\236z@\013\233\316C\310f\264\361Y\256\333\272\025)s'\002\344KV\033=B\030\033CNR\360v\272W\261\2637::\333\237\323ne\036\016@\266\335P\377\2448"
+	.string	"\037d\2034\2100\351\213\226n\nmj\261\271p\326\322.s\024\3017\016\232\264\033\361\253-!\216=\t\222cpmC/\252\220<\272(tq\034\241i6\030\356]\334\245\f#\005\275\315\306\234\377\346]\351p\002\027d1\344\203!\271\035s\364sEl,\307\377!\016.\021>\013\261\244\231\026\243\262\207\032\002\234r\315\362\250\240\215\225\325\311\312uwkJn\250\232xy\247#E\003\261 \251e\026\313A\222\233\255l\323\223-\204\367]\240\002\322Br\2721|\232\017\276\371\330\220F\032\330\230\027\205\301HM\243\003"
+	.ascii	"\003\250\267\221\t!Ul\267\311\032\307\0254\244w\230\006\fsa~"
+	.ascii	"6r\013\366,\240\t7H\"\006I\256\230\212\t\323wK\245\345%wR{\345"
+	.ascii	"{\356\217xoz\204\n\355\024\311%\302\037nP\3310[-j\202]i\315\213"
+	.ascii	"\033p\005\246P\326\347I>\232\243\266[;7L!Kl\311\361i\327\013"
+	.ascii	"\361u\301r\003eV\216$\210\034\262\252\372\363\327\204s\236\314"
+	.ascii	"\235pb0\213\357\3770R\020#I\210\327\217\264\371D\020\036\346"
+	.ascii	"\033J\313\345}\022$R\016\003\013\273&\320Z\252\034H\301\026;"
+	.ascii	".\030\335_\f\360\273.\354P9+I.nK~\026cu\200O\024|~S\374v\022"
+	.ascii	"\244\356\203\300\314a\f\006\203\343&~\272A\3200\251)\372\354"
+	.ascii	"\212x\350\271$\254\366ptZ%\250\222\204\324\261\024w\001\361|"
+	.ascii	"\312)8x@\362\341b\270\026\200\361\356\204\377w\230\246\036\257"
+	.ascii	"V\232\350f\354DQS\2032\276\271\250%\r\204\r\326\354$jx\322\342"
+	.ascii	"\202v\261\032 t\222\217\nW\375a\376\024\003\t\002\375\274\202"
+	.ascii	"'U\034\337\251\306\254iN{\267\013\344\204|C\270h\374U\240\370"
+	.ascii	"\005\257<\007\253X\034\367\204\005\346\234cBlaf\256\005j=\345"
+	.ascii	"\352\351\2643\307q\354\321\254+\374^4\203@D\353\303\b\222\326"
+	.ascii	"%\226\355\334\324\224)\2025\030\005\026\321\031\003O\217\006"
+	.ascii	"\342\\\b\363\313<\225y\013oK:h\324\344s};\313\264\001"
+	.text
+	.section	.gnu.lto_writeSlowFrame.148.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`!\002\325\020"
+	.string	"\246\236lG\340\264&\035x\327\027\tN\314\233\001\200\375PQ!\347<\362p(\370\302\b\013\214\335q\234\036\b\260G\333\332xi\224\272\2530\322f+\034\234\213\3618\206\205<\312\327\024\216\253\273\266#\330\216VM\032\331D\312\224\002T"
+	.string	"P"
+	.string	"\\"
+	.string	"[\"4\262`\004z\361\331o\3774\227\374\030\227\341\372,f\333\032\233\316\020\316\256\t\223G\233\272G\203\037\300=\0028\t\367h\227\035\244\300\210}\241\350\b\241\341\021\332]Om\356z\272\374\323N\372b\257\347\350\301\356:\277\330\211[o;\201m\024;g\001,\371\357\321g\341\036\257%!\212\031,C\227\322:\356\032g\267\274\210\020\002g\364\345.\355\017\254\374g\005AA\240\214\276\354\235Wj\013\373\333\356\256\265\306\336\322\244\230\356\266\364(\246\271-\0355\275eZ5\235\231>\001\0016$b\377\341\263\001\217\235\222\224+\242\360\035\265N[2\237\234\321\t\247#\345j\025\016\004\223\203\033\232E\265\275\3404\225"
+	.ascii	"@v\267\301\213>\"\233F\275\205\343\370\331\264%\353\311\321T"
+	.ascii	"\325\023\232#\366\205\337\300`#\3658*\302!\222\274\332\0314 "
+	.ascii	"\230\361\206\367\234\272\335e\340\3238\017\312\277yt*\254\024"
+	.ascii	"\214\313)\004g\224\251\245ZiA\235\\V\274\016\034N/\036j\305\362"
+	.ascii	"L\007\254\362\220Zy T\252\225W\332\331o\2535\356\210r@\230\312"
+	.ascii	"8f\333e\341`\310\214\fmr\277\307}\250\3707v\321RRR\310~\204\212"
+	.ascii	"\3002\204@\004\243$\277sZ\004\003.>[\302\004\242\025 Iy\344]"
+	.ascii	"\343\002- \260\202\021\032\\\007 \325\023C\223\030\030\026\025"
+	.ascii	"\222\204;\272\024T\343\033\0236\335m\031F\326\343$q\177\213\266"
+	.ascii	"OA\210,FR\220y\273e!g\300\236&\364%\215-\302Q\306\325\r\023\353"
+	.ascii	"ynX \312\322\275I\211i\260*\355\372\245\021\020n\02485\017\b"
+	.ascii	"\211\340\215iL\3472\312\026p\346E\273\310"
+	.text
+	.section	.gnu.lto_loadSlowState.149.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`H\001=\r"
+	.string	"\026\331XC"
+	.string	"s\233\016\233\\\213`\214?'\203b\352\200\333\357f\274.\332K\016\352\236O\322B\2512\202\344BK\210X\304nI\027\266\341?\366\032%a\013"
+	.string	"\n\320V\004\001*\0055JS\250D\232\354-eJ\001D"
+	.string	"B"
+	.string	"H"
+	.string	">\213\243hO)\371f\327\004Cc\327K\340N\365h\357\034\352\261:\001\352\321\232\315\243"
+	.string	"\207\335\026\240\2408Y\371\261\273\226\232\270\366\324\374\267x"
+	.string	"\256\264=\0014\330]'W\002q\353m\037\260\255\300\276\216\335=\f\003\202\023\273\244s\217\376HO\"\346\245\203\bR\316\330\336\226Z\302>\334\335\265\232\354\230\256\236\362S0\035a\032fZ5\235\231\376f@\n\017\245\307\330\330\3750\003dO\261E\205\306\366\323\0018T\355\t\227\221\252\252,'A6iW\360\344\271Tu\371n\234Lt\363\325\276\036#T\355.\003\037F\006\022"
+	.string	"\323\225p2+\177\021\362;\207\210RD=^)\214\250\261\242R_%\033\361\273\334\021\342*w\241\301\017$\230\310\b\372\352l\300>\242\313#\362\261,\204xF\254+\033Y\035\003\306.\2002+\003\206e\226\306\333\303U\223\253\317\307\211\244&\216j;x\013dy\020\025\272|/Pm\b\237A\24298\031N\332\021$\3449\250\332\343\013\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\rB\363>K{D\230\245\036 \270\330\320\254"
+	.ascii	"\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.150.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\342\002\035\025"
+	.string	"\206%\205I\320\360(\035\260\b\326er\236\301\251\376\375\230\264\372\007&\257$\2731B\263l|M\177\360,\342\331\216\301\3366j\003\302\375;\375\310\203\317\236\215\003\361\213\247O\201\305;o\022\013"
+	.string	" B\031\206\\7~B\b!r\247\024q"
+	.string	"i"
+	.string	"o"
+	.string	"\341m\031\177g\325\201f\"%ooD\036\033H@$\017]B>\364\002\0062\236\035\230)\233DvF5E:vy+\005\361\331S\344(\206\240\316\231?\232@\250\341\370\335p\345S:'c\340\350\214\210\300\311\315Q\034\331\311\311=\244\351\315L\320\003\247\341\n\202\263\201\"\273\373\335\247\r\2566\347h\262\273\2367\\\316\355q\333\034l?\260\247S&`SS'z\021\006\337\307./\363\267\207\376\213\370\360\372\221\343\311\307\303.G\233?\233WN\325\331\007W?\330!\340t\352@\367\250\323\252\323S\247/"
+	.string	"\301\216\332\022\321\356\204\312\340\355\315o\307\372\302\243\020\027\372\201>\355\333\017\362{V\371%\316\223\271P\314\227f\217s\332!1\355\3424\340\275\200\370\220\374"
+	.string	"\361\001w\001\343\373(\350\331]\n\342\303\224\216<7~6\033\036\252\316$W\215\r\325\260M(\007\230\344\235$~\350,\216X\255\371\233\352gD\375\370h\264\034z\357E\336z'\243F\200\037\363AW\361\"wi(\236\"\306\367y\350\224\327K|h\253\260\314\337|\243\250\016>\233\226swKU\235\226O$\206\224l\023\312S\257\243~EMP-.\031Kv\002\003[9\201q\265"
+	.ascii	"p\311^\261\b\025V^`\026\\Tn\225d\200\241\250\264X+(\253\226\027"
+	.ascii	"\213e\325\212\271\254J\022\030v\301\025[\311`\260\330J\305\333"
+	.ascii	"\223\377L48\036\306C\324\306v\210\336\027\245\344\243i\rL\021"
+	.ascii	"\230\266\204\tI\276\032o\267$U\347\2318j\356\346\247lZ\322Q\214"
+	.ascii	"\001ww\034\\\350g\352\315\237S\372\"\345e\240g\227\006B\243E"
+	.ascii	"? \240\002\031A[\007\240\365>\003\316\260e\030\330\223\354\246"
+	.ascii	"\265\"7\342\366q\024\202\344\242X\2156\270\276%V\016\317\026"
+	.ascii	"\263i\r\\\002\200&\244\3056\224f`M\013\307ytc(\b\243\241m\334"
+	.ascii	"\273\034\210\257\312\305K]\020\013\205&Y\"\231\303@\305\311\333"
+	.ascii	"\242\016\336Z\003qM)\3552x\370\370x\356\341\016\024\304i\300"
+	.ascii	"\202\021\26760e\372c\0057\337\227\032\007z\031\354\030\017\244"
+	.ascii	"^\313-\0305\037\303\0167\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.151.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"u\t"
+	.string	"\246\320?9 \261\322\001\204\216\223K\206\344\235jgS\327\003'\310Oa\251\374\244\3400\200N\031\033n\263\277\3616#\304"
+	.string	"\023 \004\300!!#\b\bX\234#\007<\244\311\336r\247\024."
+	.string	"-"
+	.string	"/"
+	.string	"?]j<\371Oy\300*\354\270\024\bYWY`\033\271yB\225\\h\301\260\006\302T\214"
+	.string	"\016\273\353\270\nA\356y\333\017\266\031l\347\002\250\270\263g\251\250/\373r\325e?\372\223@\346\026\276&f\367c\227\263\265\371bb\373\036\237l\232\317`{\020\313y\260\340v\367S\222-8\233\350rc\023Q}\351\021\274\253\001mF\025s\266KW\301\350\354\252\032\374\330e\031~\311\2477L\361\253O\337\344}^9Z:\034Y\026}4\300\220\204\b4\021\372*\"@\024\237\210T\372>\t\006- H\337\005\b\222>\317\fu\271\352\352\350Pj(MI}\215<\332H\001\266\273+?\t\t\021"
+	.ascii	"`\2517\023\032\200\002cx\r\343w\004\321X\t\313@\270I\310\002"
+	.ascii	"\305\343\357\007\001]\303\355C\360\227q\305\245\213\331N\274"
+	.ascii	"0\241"
+	.text
+	.section	.gnu.lto_blackboxStart.153.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\245\001]\020"
+	.string	"\026\034jH\360\262\2501 \327\007L\005\035\026\0059\\\013\273j\0043\335\004O\236\237M\225a\023G/U\326\362\263\026\325\334m\021(\257v}\3431}t3l\276\310&r\214`_e:\300\241.\357\335\0323\321\232\224[\312\224\002W"
+	.string	"P"
+	.string	"Z"
+	.string	"\rZ\254\210\311\361\271\367z\264\204j\252.\262\225\243S\345\207\027\215jnM\310\037\"\020\031c\315+7\342\"o\335\b\303!\330a\213y\371)3\276L\2164\322\234r\004|\214\030\322\215,\216\304\206\007M\200Q\234ST\272\367z\266F\016\367\350\266Ul3\260\017\024\257\226\236v\356\307F\350&[\315!{&N\372\322q\023\203\231\272ln\332\322\351\223.\302\303\214\314\370\";\367\316\f\001][\305\201\302\366\375\331i-\217\231D\366P\321b\237\305e.\217\331\204\334\351^m\027\273{\235\235U6\217\201\227\033\006\365\262\223^\224\266\033\221p\006-\250a\202D\325`OO5!"
+	.string	"\246M\001\205\276\274"
+	.ascii	"\035\241 \233HC\216\276P6\006*\001\316\275\027\306S\2204|z\036"
+	.ascii	"\314\370PR\372\242?`--P\013\302\232?>\315)\317\001G\367\262\034"
+	.ascii	"\370\265\273\270\340\303^\275\3022\337b\261\001\376J2\200'\324"
+	.ascii	"g\252p\362,\240\230R\274/\265\342\225\214\030T\231\220\3620\200"
+	.ascii	"`\312\353f\253S\227]ZQ\361\204h\300\264#H\230o\371\345K\"\rI"
+	.ascii	"rt\200\261\364\345\023\353\353\374\306\211\017\263\351\373\354"
+	.ascii	"+\004\020=\267\020\2539d\203g\204s7\334\233\253\340\001( @\002"
+	.ascii	"c\224\303\033\240\352\211\003\326F\313\007\342s\341\303[\332"
+	.ascii	"\232C]j\216\247\021{xZQ\037@10*\322\356\224\016\354\326\320\335"
+	.ascii	"\202`\245\210p\004\026\254\354\314\366&\311B\371\031\035\221"
+	.ascii	"\002\216 \274qn\nm\210\242\344\024\221\303a\\F~\356\025\314\217"
+	.ascii	"\237\207\223!@\272\027\337\006("
+	.text
+	.section	.gnu.lto_blackboxFinish.154.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`e\001\335\r"
+	.string	"\366\230YD\020\221\232\016_\237*\t\004\307\326\006\262\017m\326G\312\267X\304_\343\376\366\332h\242Q\374\354\303n\"\307lc\365\321t\3341\257\0065\254D\260\202\n"
+	.string	"\004 \224\316\017\362AlTP>[\332d\313\224\002B"
+	.string	"E"
+	.string	"H"
+	.ascii	"k}\332(\266\365y\313\036[<\350\262\002T\260L\230\251\331\335"
+	.ascii	"Kn\270\347s\222\352\361/:G\347m\237\035\237*\257\302%\210\243"
+	.ascii	":\276\220C\345I\220\272\301v\327\332y+7u\333!\266\013\330w\021"
+	.ascii	"z\303>x\017\232\377b\b'\372\356\323?\241>/CH1B2,\037\035m\020"
+	.ascii	"\244R\203}9\216#\r\313\f\266\252\277y\313\013\025\n+OI\261\253"
+	.ascii	"2\326\330\322\\\321\301\366}\231\217P\036c\003.!\314n\016L\364"
+	.ascii	"\235?:\306\311\315\037qc\233\332\370\027~-\244\375\023\026=P"
+	.ascii	"\320X\327(\022/q\023\026=X\320pT3\017q\021\026\225$#t\341\332"
+	.ascii	"5\352S\273\3758\b\333\"\200\335\355!nv\245\030\230\305\260\037"
+	.ascii	"\004\270\346\200D\310F\024pD\026\214\\\fHDJ.N\307\344\002\031"
+	.ascii	"\340\254\001\202\316\365 \313:\227\005~>\255\350Oi\201Q\372H"
+	.ascii	"\220O\272\261iww\006P;\001\211\374\360\213~\300\002X3C\303/|"
+	.ascii	"\231*\365K\250\217\317(\177\024# `\202Qf\221\007`\324\023\n\r"
+	.ascii	"O\304\333\006p\230\260Py]\345\355v-\232\n\357\356\241\313\333"
+	.ascii	"\275\314/\336#\244z\370v\005ve4r\032xx\005\2661\326<\2644\224"
+	.ascii	"\365\205\205\022>{h\210\377\025\243\351\202\355l\031\347\253"
+	.ascii	"\317\254\313\036\031"
+	.text
+	.section	.gnu.lto_startInTestMode.156.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`g\001M\017"
+	.string	"\306\034hF"
+	.string	"\221(\035;&\314X\327\301\214\250CC\321m\304\0034\341\334\r+\270s-\250\247\234A\004z-\242\375\237\f\346\216 \306\032\304`\035\033\372\255\252T\020Z\362_{!H\373\331N\232\370j\263\023D6\221;\245V"
+	.string	"O"
+	.string	"S"
+	.string	"\"\252\r\033\320\304ZV\344\354\256\247#n:77\225&?\200\030\236\353@|n\006Zz\230"
+	.ascii	"\021U[\202\234\260\246#\262\310m[\360\"\303\303G\325\0262\303"
+	.ascii	"\205\323\021SR;\"\313\206`w\017\273t\021QR~|v\327r%\266\356\217"
+	.ascii	"\333.\261\035\301"
+	.string	"~\211\"^fB\234d\315\036QR_\366\267U\030\373\262\273Si\225\322\007p\027\n\226K\353\035j\273\254\032\217\265\23152\227\335~\n\177\374\314c\246\313V\004,\215\275\210C\343\002\307\356\310\340\323\236\356\323\343C\270\317\356\004\270\317wl\262o\004\253N?\276@\016\327\007\033\225\206\216\241b\235\330\364e=\211S\005g6Rr\307[\220\272\335\224\003\237v\026\237\037\363i\f\245\022\367\251\272\201D\r\0351\271\273\241\352\313*\33454\273I\311\035\366U|\246\342\3078C\212\374\352\323O\321\303\256\240E\013(\3407\341\244$a\304\344\001\204\221\021\b\262P\022\261\310\243\341\013\225\210@\027B\236\t\t\210\344\211\300\222\3479\340\357d\004z(\337\007z\235\361t\205\361\347\244(n\200\264)\200\344W>\354\037\224\206\177\021\343\020\316\025\256\323y\242\311\314n@\344?\342\2767\f\316\256@\"\037\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\256\211(\231"
+	.ascii	"\320\272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.158.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`y\001\215\017"
+	.string	"\326\\hG\360\320&\035\220z\250\250\246n8\336\031\240\002&\371\233\222t\310\333\303\303!K\334\366/\222\3217\002\303i\007R\353\353\355\037\225TO\232\302\226\340\031x\006V$\223}\263\n\226a\036\330\200},N\220\275\267\224)\005Z"
+	.string	"K"
+	.string	"U"
+	.string	"\366\207\025,`\261\252\200\313\352F\002\236\036-\034\035s\316\270\rq\325e\204\253*\177u\251\"\313\241E\0062\034\031\0315W\207C(\"\304\223\003\004\206\204\367\341j\321\205 @25F.\027(\002k\301\3415\327\027W\247\272\221\3149\255\236K\303\275\335\366\211m\004\366}\0026\277\231\340\217p\312\212\336{\364W\344\343\3675\017\031R\021\203\331\274X\372\331\263\225.\215\375\375\276\357\363\316\330V\223V=\262z\203j\t\325\021\252!T\257\325\272\352\017\b\211\231\2418\016\2379a\276\242\371\023Y\224P\275\315\022:\r*\230L\362Q]xC\007.\374$w\341.\221\005X\247\237\005\250\375\300D\357\355j\020\210\r?\335\256l\033)^\304\200*\251\253\"h4\002\250\215\202\322{\272\367\020\353vu\345!\002\212\355\322\370%9\002"
+	.string	"\203\026\324\242<\374\227\344w\264\326\326\253{>\215P@\225\234\234L\020J\270\b&&\024\356\224J\341F\f\030%\301A\212SA\241R\334l~g\374\031=\030Z;\221T\324\343\351\354\300_%\267}\261\275\255IX\333\3019\347\224r\343\222\366\255\0235\271%\331\213\025\227@\315\304\212\035B\233\341\346CL\204\353\347<\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.159.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`[\001m\f"
+	.string	"\206TL@ o5\034\2409\016\024\027w\235\356K\316u\0346\236\215\005\224\311l\007i\020\360u\362\253\255\235\363.\270\250\356\273;\202\310\032\b"
+	.string	"\231\232\0133[\227'\311\363*\205\036\204v\323\354\336R\246\0246"
+	.string	"4"
+	.string	"<"
+	.string	"\252\257R\354B\030_\254\310\205\030l\277\342\222]\343h\260\237H,\202\003X\213\335\355\224\302K\317\222\177\327)`\352{N\002\354\256\023L\251n\275m\020\333\030\373cz\221\255BS\216\236\244=\3343\211=R\360\226\006\021\245\237\267\264\031\220\362\240/-\227x\322\317~}\251\023\354o\253,\373\351\355i}:\237~\306F\355A\032\3119E\001\2620\345\b\342\203\352%X\240e\330\220LX21\357"
+	.string	"K\275\310NX\362j{\n|\240\364\0139\207\017\306\356\002\360_\337"
+	.ascii	"\362/\234s\310\313\203\347|Or\356\001\356d\026x\034Pgc\200\323"
+	.ascii	"\035\370lB]G4\3522\036\366\020xD]\002\317\023u\225\327^Y\246"
+	.ascii	"\264V\210&=ySZ\211Y,\334\\\204\252$>\035\025,\340#@\032*vw$\304"
+	.ascii	"E\f \240\t& \220\002\031\"\364\001\240\353\r\r8\265!F\004f\357"
+	.ascii	"a0\0161\347P\001\035\343\332XR\260\013\016\030\370\347\210\221"
+	.ascii	"\355\215E\306\030\267\354\013\006k\023\321b\217\0308)\260\362"
+	.ascii	"a'.\327t\200EG\352A\302\217\203 \t\001\253\016\316\017\327Z\241"
+	.ascii	"\374\r\001\230n\321\256'"
+	.text
+	.section	.gnu.lto_writeGPSFrame.160.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`u\005\r\035"
+	.string	"\026\362\260H\220\234M:\220G\007\t\204\345Bb\274\377\024\341\364\363\276\327HI\225|tb\335_"
+	.string	"$\327\331\373\332\361\223\346\247S\241e\263\237\001\221\353\222\020\221\235\224\033"
+	.string	"\324#\032\017\307\273>\327Q\330&\013\263vo\"\245L\001\222"
+	.string	"\217"
+	.string	"\242"
+	.string	"\263\311\237#_J\3768\362{\344s\363\267\300\017\033,\033\253\003L\2554\312\332T.\251u\344\033e\245\244X\253'\020\222\261\255\374S\374\266\225k\373\277\374/\224\245\242[\265\342\265Z\177`e\325j\245;\021me\320\002\230+\307\365\231+O\1770 \026\225I\001\026'NWkj\255\273\216Z\272c3\375\356pk\301'\246\035ol\217\007\302\256\214\351<5\215"
+	.ascii	"h\030\t\356p\031\306\023\220y\006\241\326z\016>\331\330\313\375"
+	.ascii	"o\364\337\301/\273\002\\\266D\310\302\262\372G3\327P7\322\370"
+	.ascii	"H\023\246L\023\223=\250\32650\205:\327\353\004\005\344\262\177"
+	.ascii	"\247,\225\243\257\324\221x\274\301\225_\336\\)\324+e\207\242"
+	.ascii	"\\\205\361\240\202\372q\331o\374){-\363\377\240\264C\310\270"
+	.ascii	"\232\232\3518\374/\365x\203\037\032R\344\0026\323o\005\344\026"
+	.ascii	"\362\357X;\310?\362s#_h\253v\003L\376\317\344\373H~\317\310\347"
+	.ascii	"\231\361wF>n\306\327\031\371\267\311\317\231|\333\344\343L~m"
+	.ascii	"\362i\223\037c\304\204\251\201MU\r1\255\177z\204&\231\365lZ\353"
+	.ascii	"\216`\271\350\360\001\361t\311\202\241L\030\020\331\332/\264"
+	.ascii	"\t\235\242O\350\223\271r\326\017\274\250\326\013\035\346\210"
+	.ascii	"\217\260]\212\b\020Wr\231\2759\204_E \226c\313\3269\275\371I"
+	.ascii	"\330-FYV\313\204S\250\300\033\2540W\216\2758\204_S#\020w\377"
+	.ascii	"\026.\004q\007\350\356\255\322\002\t0\303^9Z\360\315R\241\201"
+	.ascii	"&\205b\256\344\336+\257\252\037\227\351\326\n\nZ\255\265\301"
+	.ascii	"\027k\253l\370J\255<\207\016\035\346\312\355YC\330U\324\372\005"
+	.ascii	"$2$-)a(!\"\311\3473\301\273\235Gt\242\347\001\004\017)\204\207"
+	.ascii	"\235\b%\244\245\035\317GbG4\340\275\021I\276]\211^\317\267\263"
+	.ascii	"Y\375v\254\035\344\265\250-\256_\003\377\243\343\0312b\024\341"
+	.ascii	"\340\013\027?E\237\346\026t(`\007\263\240LpDn\372\n\212Q\361"
+	.ascii	"\217\016\0210SQ\216\253O\257\022\341\330TO\217}c\204#\272"
+	.string	"\351\255\240\030\033#\262\0365E\352c\243\264\200\230g\247y\200\354\230\232\235\"N\247qBV\214F\321\320\350\234\231\272\345\364M\270`tX\340\253H\310LN/\017!X\321\206\323\265\266y\021\273p\212lm\250QD&\225B6#IAQA\322\001\260\002\021\031+\333\021`1a\n\t\311lH{\007`GC\327\006\t\304q.\221=\273\372mGr\315\2378HkB\327\357pM_N\032\243\362\254\327\246\334\377<\245\265\033\244\247\036\261\265\246\373B@+\372\336\272\347\253\276\037X\325\334\0340\277\324|\204\t\221\326\335\004\302\225\221\024\330\355\254\222\313Tz\005/Xv\251\233\276B\261\321'\211\236\234\341\003)!_0\"m..\242b`\021\343\bs\365L\250\351/Q\363d\340q\274\327&\212\360\334h\370V$\203\221\004\026\nn\227n`F\226H&\253mX.:X\375\316\347\266\240@"
+	.ascii	"\373\331\374V\025\r\222\313>\223\364j\262\004CW\252'^\377bOS"
+	.ascii	"\216\237B\n5"
+	.text
+	.section	.gnu.lto_loadMainState.161.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`X\r\245;"
+	.ascii	"zfP\026AP\246N\007\217\372\3065h\\\365s\320\013W\255\376J=?\210"
+	.ascii	"\243\357\031\351\223\200\006\371\307\256\326C>e5&\020\3214\243"
+	.ascii	"%\242\022\013\337/\007\310\\\3657g\323\177\021b\321\020\262\267"
+	.ascii	"\224)\245\024O\0019\001V\001n]\344o]w\004\036Z\345\334\275e7"
+	.ascii	"\273\311t\343u\213\351\276\353fv\177\351\224\271\365\360\312"
+	.ascii	"\324\345Y\031c\3270\024\234J(\r\206;\f\017\357\330I\310\271\006"
+	.ascii	"\"\330\3676\227\266\343a\227\366\242\366\227\031I+\235\265\333"
+	.ascii	"\372\316\004\002\256+\323\0023\330K(\223F\257nk\3378\344\034"
+	.ascii	"\003\270\256kV_\206\020\354\313\314\355\314\235\245\265\250]"
+	.ascii	"W\203\205\353\212$Oo]\231\tX+\330W\252\233\320\276\266\227\320"
+	.ascii	"\276*3\037\001hk\031\327\231Cjv\204\326u\335z&\314\301 \222\265"
+	.ascii	"v\370\377Ak-\312\337\226\331lQ\265\211HGF\303\"a0MB\257\222"
+	.string	"}W\271\355\332\036\227\177\306\266\262&\332\024m\307\223\246\303V\304:(\004\270\327zD\034)\256\217\364\332:\361\346\220\270\305\265\321\2202=\025\205-\210\017\247\226\270\t\351\242\264\253L[g\335\034\0227!-\204\263\n\362\324<\230v-q\003\322i\233\001\351$ktGJ\220\246\303\206\264\013\340\362\356\364\0304G\213\346|\364\r\372h%\233D\207\255\211U\340km6\334\316\361\350\3570}\217H>c\033\217\366\264k]Wvc\233[3\200fn\"\314\034\202\331\bDyt{A@\025\372O\372A\013\335\007\360/}\242{.\264\236\373(\206\366\303\323w\357\350\354\035\rm\347\337r\350:t\346\374w\232$\230g\235?\337\227U\037s\207\216\363!\330\367\251\215~\372\375-\242\2648 \372\r7\031\364Yi7\"\270\220l\272\315\b&Q\302\333X\002\355\333\237&\t\206\256\316\314\003\277\221\205"
+	.string	"\365\236\267\236\331D\253\001\013\256\353\332\200;\215\212$\314\t)7\003\355\033#\371\3459\304\314\003\0214\232\031\021\372\326uu\300\275\327gPp\313\365\345\024*\274\215}\271U\240}\265\236\254I\340s\317\314\003\231\231e\376G\346v\200,\004\310\257\204YC\005\257.\t\315l\346\352\272\356\255\376\322\254\325\315f\254&\323|\325x\315V-\246\271\252\357\232\251R\347\003B\347\251\353,u\235\243\204\316P\251\263\001\353\374\024t.\220:\023H\235\007\240\316\002\254s"
+	.string	"\353\354\224:7\241\316L\326y)u\006`\235\225R\347$\353LL\235\221P\347#\353l\224:\017Q\347\"\353,\274\316A\353\234^g\324:\337\353l\255\363_g\267\316\275\241i\213\\\205\230\351l]\315\250\234>\300[;iQ$8\263\212\246\252y\033\235\276\355\272\211M\362)\307\306\227\t\377\310i\233\324\353\337/)\253\255\254\202V\357\365\304\243\362\256i\212\013Q\227VH\034\036D}c\372\246\267\201\226\230\036\270U\016u\207\267q\351;\257\233\270$\377\3109\373\2624\351V\370\367S\312\352\252_c'Z\345pyw\220h\325Wx\3421\t\340{\250K\2536\347\241\276)="
+	.ascii	"*\356\306\315\240\263y\233\332\343\207\n\007\207\366U\372\036"
+	.ascii	"\323\027M2\r\335^\225\373Gn\245W\302i\233\327\360\357\347YM\365"
+	.ascii	"k\t\232\352\273\316\213\337\231\027\3529I\3620\355\037\251^\303"
+	.ascii	"\023\217H\276\2648\033\036\310I:\204x\016U\n\024\361\223\376"
+	.ascii	"\332\255q\263\001\0217\252Z\264\372\374\206\343P\213\034Q\223"
+	.ascii	"$A\373\022\277\327$\233H\236\246.\257\220GG\203:z\244\277vFG"
+	.ascii	"n\306\315\004H&^\246ji\020\350\253\332DU\252N\274\215\252\023"
+	.ascii	"\264\257\321\367\224$\231\347\336\360\021\251\313\252\271>\244"
+	.ascii	"J)\372\341\333=j\211\254\\\370\314j\025\225\016mc\321K\235}\031"
+	.ascii	"?\271\211\245biB\252\026\006HA=H\335\302<\301\313\333\350\205"
+	.ascii	"\366\025~\307%\003)\232\254E\330\330\030\f/\"Y\013\030b^cbdb"
+	.ascii	",\212^|\bc\221\302\003Y\213\260\2611\030`G\f\246%C\354\204\n"
+	.ascii	"0\023+Nl\265Ha\202\305\026\330\330\213-\255(\026s\0216\266E&"
+	.ascii	"&6\2665d\256\375JX\2504$\307\354m\360\201\277\273s0\305?\347"
+	.ascii	"\342_\272\270\227\342\237\230\"\036\036\332"
+	.string	"\367\366=0\350\2717E\306\267<\234\346\324?\036\245\032)3\236\345\353\311i\364S<\343W\276\334\212\323\025\235j\212l\330\240}\245\276\241$\367<\353\242\3348\225\257=_|\3059\336\306\250\267O\345\034\3243\027\353\270\224\242\035'2F?\031\360\024\363x\033\241\230\330(\213\020\377\310B\277#\t\377~FY\215\305\365Xo,\022\326K\370%;9>\003\017E]F\025\367\370\262\370\367\364\006\336\302I\213\003\305\235pS\351r\305>\177\212\201\212\201\320\276O\337zw\350\376\357\324\240\265\035\025x\256oDj\211(8s\361Y4\344m,\2604G\331\303\250\250\353\337O\230\325W\277\346>\372jx\365]O<*\007\245\305\021x\244\272\214\352+\"r&\352\233\205c\364\023\305\217\3522\211+Q\337\212\201jY\031\332\227\300w\231\276S\222|\317\242\001Z~D]F\031Q\337\234\004\374\200\267\316"
+	.string	"\002^\352\254\331\001\201\004\250A4#\031sfDdDF\222$\205\016\321\005\204\030\347\\\231\007\0210\241t\016\315\204\231\024\224\244Vk\241\245S\360GE_\320`\356\240\n\2338*\326'K5\036D\324\n=h\352\220\235\314\2445\240.\201A\354(S,C\262\024\332\262S\215\307\307`\377\331\037\224\313\342SP$\257~\3752\177\312\202\363~,R)\r\314\203w\364\235\360\354\335\b\237\004C\335D\f\321O\fdv\330\027'\263?b\034\246\231\030\0272\374\325J\225\242&\b\364\367\335\320x\r`\016d\205B\020\223@\300\021m\322\212n\332\370\224\005\214\326\r\376#n\212\271\tgt\320-a\312\t\211z\002'\370\327Xf\277 \225+\200\213\346\353<\034\254\355\266\302Rp"
+	.ascii	"\241X\025\\\246O\34606\244$\030\032^\177#\3747@n\216\313=\370"
+	.ascii	"f\234@\3538\240\301\335\205\361\240\344\b)\250}\352\020\330\303"
+	.ascii	"M\203)~\214@\223 '\032c9\252\210\024\"\321\217l\206>l\345_!\322"
+	.ascii	"Y\234\311\013<\177\325Q\f|R3\023\013\340x\335#\335\036\324\275"
+	.ascii	"\205\370\353\274P\216\032\363\356\334}\367\035\376A\365\306\235"
+	.ascii	"\334\023Y!{\331j\315\273\317\205/\021\233\220\1773:\232%0\024"
+	.ascii	"\333\361\023A9\256\306=?\320.\230X\313\204\241a\314\240w\221"
+	.ascii	"\250\365\313\365\230\244=\020\370\377\275\374'\225X\261\303J"
+	.ascii	"\340\0366\251$~\251x\245\301\267\023\017\303\201E9\203}\203?"
+	.ascii	"\254\032\322\020Hy=\310\222%l\tgM\325\n\027\330\342\256\305\275"
+	.ascii	"\222[]\315\242\271\312\207Nm\210\364\272\022\032_Pn +\"\fs*t"
+	.ascii	"s\023\362a\034Q\333_\f7\265\216\212,\013\177\327\212\200@\317"
+	.ascii	"\024\327T"
+	.text
+	.section	.gnu.lto_holdDecimatedFieldGroups.163.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`]\r57"
+	.string	"\372Y"
+	.string	"\024?@\244N\007\323BA\201\242\244\007\027\217\032\212\3600 T\2522)\005\260\231\340\205\250Q\"i\251\020\260\267\323\016p!`\001,t\322\351\367\240\271\023jq\262\273{k\275\244\355\275\367\226)\2450\001\025\001,\001\356\031G\363\372]\363yVf\017\242\b\372F(\347l\242u\325@\272\243\335L\273U\022vx\231\036\236\311r\217&tH\210\326U\367:\037\323\256\323\353\254\017t\355B\353j{\030\027\363:\335\217\244\374\227]\331\006e#\224\263S\312\325\236j]m\2477\255\256\266\316\264\272\332o\267\240"
+	.string	"c\371\313\n\332\004\210\235\242\2343\022Oi\327S\247w\323\277\356\324tdZRJB:2\026]\342\260eW5\305\377\266\217\361ty7(y\366\345N\251ZEK\026\3773\203K-\360\251\321\363g\3307\035\220\242\264\342\307\025A\230\b\227\026)\rJ\002\204\344\347\250\317\230W\274sS\210!\246P\271,\303*T\336\234\260\255\2515Is73&\253\332\307oH\037p3c\272m\027\264J\240\233\262\351l\332\200P\233D\256\305lI\332d\004.\351O\377\"g@~Es\325@\316\331=#\3734}b\233\203\344\350l,Mp\007\n \317\363/;\023{\354O?\001}\013tSZ\361g7\344\234\373\223gJo"
+	.string	"\336\355}\335\255\242\273x q\\N\211\366f\233@\201bu\025\211)PY\362H\0201\001S\357\261>a\026l\316\2272t\304~Q;^\267\017\207\246\260\342s8+X\264h\261\272\372\204=\317S8\3143G\354\330\237\376\301NN\017H!\346k\002\032\304\017\334\215\227\206\267=\001\330\315\230zq\016\234\215W\206>9\347\n\355k\\\317E{\323\325\306\312zO\272\332\236\265\272\032"
+	.string	"w1\327\f\356\201}\264\333\031\366x\331\355\r\334(\0175\216\322=\374\2160\374\256\032~S\r\277!\264\337\310)\343\367\002\343\267\002\343w\201\342\367"
+	.string	"\307\363~r:o\001\356\364\016\340w\336G\367\233\211\370\275\344~+\021\277\223\332o\244\341\367\221\373m$~\027\207\337n\373Md\277\207\353w\313~\263\353\367\312~\253\353w\312~\343\365\373\325o\267r\202\322Tz\034\237\234\215D\033e;\352\336\025\307s\277s\247swz\332\355\355v\216\327\236\327nw\225\204w\207\247i\2517}N\246\375\331\001o\334\352\352\002\314.\347\370\224\2459\035\367'\234 \261\305C%hC$s\177\244\325[1kf\204%\"\346\207\2548jl\016\315\207y\212U!A\324'{\353~,\305Qcr\321\250/z\313Y\037c\334\315\301\303{\262/\264\221\341\257\356\377\272\361\371C\233s\216\216"
+	.ascii	"\341\265\272\212q\352\227D#\304\341\311\356\020\336HD\233\263"
+	.ascii	"\330\004FW$\332\346\217\325\325\307Qcr\202I4\260\217\266\317"
+	.ascii	"q\207\213c\347\353\t\t\340\251E\207\212\332\007\211\205\210\332"
+	.ascii	"\023\r\031\025j7\324*\032\324N\210\r\004\250=\320\n\350\247\035"
+	.ascii	"P\215\263\247\235O\272&OO=\357\264\377\2757\337\352*]\235~0\207"
+	.ascii	"%\267e\006~\335-\250\315\371\313\331\334\3332\324\n\226\2343"
+	.ascii	"\003W\217X@\222?jY\355\013\345\346\350\376Z\265$\200a\3302vs"
+	.ascii	"O\013\204S\302\342e\277*\345\236\347\256\226\f\244\223:\360\b"
+	.ascii	"\270,\002\0022~SV\274LSH\211\230\212\243\264\224Wa\377+\003H"
+	.ascii	"\205!\340*\354d{a\037\355'L\205\304\020\260\003)\3646rlq\301"
+	.ascii	"Pu\304\350\240\325\205\305\305v\325\320\342\342\312\301\001\251"
+	.ascii	"\013\007\326U\261\263\246xl\275\220\221\2055\343\005\262F\f,"
+	.ascii	"\032\310,.\034\310\251\250\336\262\241\305\205\354\332\332\342"
+	.ascii	"B\272N0\307Q\306\270\013\321\322\304\016\030\016;\022\304\t/"
+	.ascii	"\233\252\312q\nc\300\227\362#.\353#\366BO\233\360\362\210\247"
+	.ascii	"\332?;94dl\237\314\2717|=\341\007\"r\034\200\373\237#`<\257`"
+	.ascii	"\364\r\210\226\245\t2\025\300\375g\316\\i\261)\200\331e\035\237"
+	.ascii	"\262\264C\202KK\230\251\f\031&\347\223\257[\302P\313:\275\300"
+	.ascii	"@%8O\302Ja\346\224\342\240<\230$\feG"
+	.string	"'\230D\023$'\t\t{)\341\267|.\357\027$\354{LD\203\177\370\220\216\260\226\367J\212h\312cy\267\034a\357c\n\212\243\353\323\345(\352\327\"66c0_*F*2\230\377\366Z)b\250e\230h\022M\317\232\021/\261\224\367J\240,\037\345\335\342bO\304\3243H\304n%\240\336\324$\013\365\333\345\333\336/D\354t\230z\342\350\360\270?\257\034)*\300\375kk\030\024D\355\020\272\013p\177\332\210\341\222\264+\255\366\246\225\007\201\023\250\201L\345\024\"\032\021\tRP\220$i\f\021\006\304\030\346\252\314\001\021\3204\247\240\261\tJ\n\2224\007\300\330_\201\001\327(\030~Fv\264\237\"6\322\202-%\247\3755\031*H\364}\033\2769\n\366\024\312wC\231\320@\3157PI\216\260\346\025\357\005\022\374\fGa\237~\203\317s\207\002\006^*I\202\026\217P\326\263\242\322ri\251"
+	.string	"\304\221\236\337m0 \n\305\254L\275reaG8\350\272\371L\274\334\224\3608nCr\214\346m\026\306\236\036\335jAB\350cF\030\031\345fs\260\211<KhV\226p;y\345\f'X~\221\fn<\307\036B\251\241)\365\021\377o\362Y\246\330\241\005\300D\376\0170\271\037r\211\001:t\013t\334P\343\003\020\207\260\031qd\360\351l2\264p2\001*\312r\023\031\340ER\240\004|"
+	.string	"\354\366\001Vd\005J\300\007@\327\211\024\341\265\226\243\336\235\222\274\220\t\354\034`\017\314\217\f*\345`s7x%#\032\315\373\342\200\251\255}\230\276P\017\205\240c%\003\037\372\233G\305\345Cw\363\250\340\b'\367\253}\020H\326\246\270~(wM\225gj\330\316J\213.'\027\002\237\255\032\005\201"
+	.ascii	"pzl\316pQ\212\2165\253I\027k\251F\007\305\002r\272v/\036#\216"
+	.ascii	"\247\312H\274>\002\225\314\357\350i\002v>\371\363\336v+M\212"
+	.ascii	"\371\252R\034\0205=u5\251\317\231\366tP\337\362\377\320\322\333"
+	.ascii	"e\004\b\341dJ\b,\371\244\004N0\txr\347\022\314\316\337\025\200"
+	.ascii	"\327\004;un\367\260\366\225\013a\202\310\bCH\201 \234\020\004"
+	.ascii	"f\004B>\230\245\b\234\032\334\242\225\f.\"80\b\214\243\007W\233"
+	.ascii	"\210\263\266\002.\346\324T0T"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.164.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\026\022MZ"
+	.string	"\272\230\330!N \020\323\032\003[\200\023\353\266R\177\3421\007\224\365?A\345*\324\373\262\350\330\374XR\327\335\023\363\304\337\265\256\207\0321'\026Il\326\303HT\204\352\216\204\241\b"
+	.string	"M\006x\272Lz"
+	.ascii	"\360r\314a\204\231\031Ycj#R\312\224R\n\020\002\320\001\021\002"
+	.ascii	"\374<\316\316\343\334BN\364m\245\341\"\267\345\355\322^$}9\274"
+	.ascii	"ul\\\2256\323M\246\373\255;L\013\275\343\272\305\364\217\271"
+	.ascii	"\351\314\b\021B\345\352\3369`\217\341\236c!\031\345[\336\027"
+	.ascii	" \f\035\003\263\220\253z\f\377\324\360\324<\317\336\367\025V"
+	.ascii	"1\013\233}f\"\334p\355B\277\320T\026\212\251\300\370V\337\376"
+	.ascii	"2\223c\203\343%\216\304\221+\355\365\nvqc;\313\313\022\346j\306"
+	.ascii	"\326\021\034r`\254\210\275]\255/X\332\373\3653\342Vwf\242Yn0"
+	.ascii	"\267\267>\302~\261\240\t\221\366\322kD\232\215\251\274\363\276"
+	.ascii	"awV\300f\217k\377\264\\\230\006 o{\251 '\205\363\300\352\314"
+	.ascii	"\235\326,\020i5\246\201\310\370rM\243a\3367\355\004\353H\353"
+	.ascii	"\240\266Y`\377\264R=\031\357}\266\001\377\373>[\b\363\276\357"
+	.ascii	"\tn\0026\233\202\005\021v\211\214d\305A!\207\306\354\222\367"
+	.ascii	"\276i\310\227\302G\356\266\3221\311\003\322Q\007\243\"\242!\241"
+	.ascii	" \240\037\237\036c\2218\344\021\006w\200\277\226]\337]\356\254"
+	.ascii	"V\372\315\bN\231\253\023'\354\253\255\217l\235\304\266\305=\254"
+	.ascii	"*\214\344\211\320U'"
+	.string	"\333\312\263\307T\323dN\251#u\325\211Fu\342G%|\235u\007\243\242,X\234HK\017U\235Z\232\314Y\305\205\314\350\250x\020P\264\177\326\022p\\\260\241\253\316\2615\b\t\225f\2239Op\237U\006\232\231XW\235&\254\257\266\006C\217X\033\305\246x\221\256\225\252N-\353\221\2702\261I\201IW\235\317\365g\211\033\233\246>\361\241\2375\217\b-T\n\376f\204}5\351\235\252\223\311\022\007\266V[\377\300\204^Lo\327\244(O\364\210^\313\3658W\307\354\271V\"s\2669\273\226x\226I\322U\247\bk\020\032\022\360\214\370\232\244\237\350\265\265\036\337\367mj{\227\027\227\373o\306\373\276\354M\257\257\346\017\315\354<\230\273\231\213e\001X\274\233\301?\352\370\235\377A\341\340\204\255l\201\257\343\235\272|\376\036\370?3L\276\017\336>\263\213\346n\361n\376\276q\030\201\353\263.\350\031\b"
+	.ascii	"\276/\227\013n\031\032\217\306j\343\251\355\346S\333l\373-\324"
+	.ascii	"\354\316\236hq;wcd\355C\371\305\257o5=\223\243\333(\201w\353"
+	.ascii	"\367\\\257e\306\350\350I\265\274\017\250\0316"
+	.string	"\002\373P\0266Q\362k\223h\205\300,\341\363_\223h_|WS\377\003\231\266a\326\321j\230*\304l@\247\201\n\232\362\276\257\023\232\256\356\340\036k\226y\364\360n\366h\233\375g`\214\016\026\251\326\372P\244\251\035\007\337\033\2649\376\265\330h\231\272\341\362=\366\307\361\3647\336\277\303\0327\273e\277\215\3575L>-\357\343\032O\343\373\233\332\354\336\330\232\251\235\227\262-\357cN\333\362\2072w\f\346\233\027\177\024\346\241\263\004Cg\252w\236\202`\350\374\243\3054?\300\316>\232\255\273\307;\357xg\250w>\240\317\272\rh2\315:Z\332\235\243\337\232q\364\227\356\247v\353\276\321a\232m\264Zw\215\346\322M\343\235e\260s\2146\323\f\243\343\232_\f\235]\f\235[\f\235\235\336\231\305;\2570:\253x\347\024\357\034\300;\243xgd\217s\323\320\371\304;3\3658\233\360q.\321\343\f"
+	.string	"\353L\242\350<\242\350,\342\235\227\3369\004\2203\b\242\363\207\241\263\022;\037\3379\351\235=\030\235\221~\234\217~\234\215\212\316EDg\242\241\363\220\217\263P\217s\020\353\fTt\376):\373\024\235{\336\331\370\316\305w&\276\363\220\350\3143t\026\032\235\203\357\2743t\006\026\235\177D\347\366\235\331\241\363\372\036OA\024O\357\205\177@\342z\361\030\373\360m%j'\244d\202\230\322\377\302\336\250\360D\223\006\271m\t\027D\325\344\315YC\202\246\r\310\311\231\232\251-\263\013\202\033\202w\223\275\255\254\217\253\034\214\201\362\363P\366\016\372\030v|\004\242g\260\200%\215"
+	.string	"\343=|\322\323\303\357\204\315"
+	.ascii	"\347\211\006&\266\344\212\033\237\025\312\212\337B\332\244\256"
+	.ascii	"\025<0B\3600\276+N#}\207\301@zo+;S\307\365Y=\017}\b\330n\240"
+	.ascii	"5\372\243\357\2427\372\247CT\364\375\201\273\304\301\234\330"
+	.ascii	"C(\342\305mRA\333,\321wYT\f\226v\362\344\214\023\243\177\365"
+	.ascii	"\320w\330\264\215\203\220d\350\233\256\3279Q8=i\226-R-Ee+\301"
+	.ascii	"cQ\302\006\212\2344n\250\376\307K\360\315\004s\247{)\235\270"
+	.ascii	"O\236\264\315R\275\b1\260\251\377\361\315\344\023z\246\236\372"
+	.ascii	"\216\241Y20\272-;/9\004\275\320\277{\240\200\013\0058\026\364"
+	.ascii	"\335\305\344\347\237\036\350\177kp|\317\377|\021\235%\331\226"
+	.ascii	"\307\305p\304\t\261-h\237\376\325\360\354\246m|\276\306?\360"
+	.ascii	"=\303R\005\033\337\363>\177\264fI\226\342{\236\342\242kS\273"
+	.ascii	"5\276O#\203\032\333\360D\026.Gx\036\312\036<\340C\200yB\267\003"
+	.ascii	"\3652\276\253eoz\227K\345\222@B\333\254\002Q.fs\214\177\304\231"
+	.ascii	"\276d\352\342\033\377\3538\227o\271V\361\031\030\353\323\223"
+	.ascii	"\022\237\273\216\277\335\254"
+	.string	"a\307\017\237\370\275\264\322u\232O\b\367\030\273PW\212\273R\332f\207\237$\006f\302y^\306w\231\306\301=\001\370\276\313n\272Q\340\262\357F\270U\\\024\274\233;\376\270\374\254Uh\300\037\340\301\207>\324w\377\323\255k\347[\331\n\337K\230\322q\371^\220\276\301\006\236\3777bqZ\3367G\216\360\211T\355\346<\321\244-\032\230\022\340C\031\310\005&x\277\207\272)\264\301\267\232\272Y\362\235+n<\265\364\374cj\311\007\3130\256\226\216RK\307#\216b\262*\201\253$V\006@x\206$\261\260\250\254\026H\026P\225\300\225UT\020)c\004\311\251\267JNE%\203\b\247\214\311)*+,\036F\032\305 \326\020\013\252h\004oL\r\251\222J^\005]\r\251\242\302\242\032B\025A\262\306\324\004I\252\b\214QX\023$\247\210VQAh$\225QV7\206,\325\204A\025\020!RQ\023"
+	.string	"A\016\241\212R\"\245\254\256\220MI\\EA\322\n\211UUe\205\024\246i\365Ga&\334\321\3077\260\267\266\366s)\335s\2753&\207\267\006\307z\007\035#\306\363\f\255\337\372@\351\241.\336\307\257T\246\031\033%p\215\213w \312\247w|h\032\257\242ig\264\216\331\234\026\177F\0314\205\256[\331:}\213\177:9|N\t$\343\364\tDs\320\223:y\260\333\256\304\251c1\306m!\355\212g\361\275|\276\260\3425\210\336\240\007\006\247\216\231\364PV\361\2767m\303\324*~\005\030\264:=8\\\237\325\254\\\027>\017\017\345>\233\363\200\tw\224\342\331\357b\237H\t\016,\310Is\224\004\315\f\351\241\334\343S\274S\231\226\341\362\2750L\035\272\203\203\022\272{K\361Cm\244\335\353\373\276\357Q"
+	.string	"nL\035"
+	.string	"\f\224"
+	.string	"_P|"
+	.ascii	"O\304\306\324\001\326\240\004\360\202\002\251\206g"
+	.ascii	"\366q]\264\344u@rizd\024g\301\205\202\234\302En\360\264\"z\315"
+	.ascii	"2\3355=R,\256\330\327\327\327w\342\245\240tk[+\330\360\201\021"
+	.ascii	"\023Z\021\034B\024\251\003\\6\237\211gzo\201\3117\303Kd\271["
+	.ascii	"\336M\023\177\004\340K\374J\307\245\002\300\210\177z\022_\324"
+	.ascii	"\202\210\037\361\035\314,\311\226^\304\267\2331\265\361\256@"
+	.ascii	"\265]\331\322\377\254D\337\360TN\206+Em+[\245gkx#\207\310\204"
+	.ascii	"\207\370>\343)\270FDLa\002\227\235\307G#\237\305 >\304\013\241"
+	.ascii	"f``\362!\363\236J\206\036\352\266\333\325\202\370&\343\300\253"
+	.ascii	"\270] \002\201d\250\221,\345\020S\210HDD\222$IsA\005\304 &%\264"
+	.ascii	"\016\021@-DP\315H\214\n\031\366\016\213\256$51\200 D\343V\357"
+	.ascii	"m\220\030\024_\006A\240^\302\251\234T0\351n4x\036<\212>Ee\367"
+	.ascii	"W\022\025*9\334j\317\253R\262^\224\302Z\306n*\037\201\203\350"
+	.ascii	"\264\252\013\350&\260\271\325Hw\224Mn\313\354\351\344#\020 \227"
+	.ascii	"\266\022NE?m8\342\311\0310\204p\036q\202IG\007(\004\020\256\274"
+	.ascii	"\243~\311\031\201Y|\362\274A\r\213\210\232G\370\324\021-=T\300"
+	.ascii	"\024\240\311x\006\t&\367Mb\240\221\333\363\024U\277$\213\316"
+	.ascii	"ms\352b\247X\226\250Wd\026\026QG\351Xh\345\254\373\206\3675\353"
+	.ascii	"\336}\250)\335\210\201\215\272\336\023\2267T\013\007\024EL\n"
+	.ascii	"\005AX*HiIN(\240oC0v\211\325N\024\253x\021\332\323\302^\024\n"
+	.ascii	"\333\220\314~\315\327\033\344`\023?tY$\024\365=s\253\023\323"
+	.ascii	"\307A\260\355!=5aw\307n\024Q\270\247|#\343F\264}\216-@\257\263"
+	.ascii	"x\362v\327j`\001^j\200\201\341\340\236G$\263\030ez4\013c\246"
+	.ascii	"\240\031.8\3367\2451\200\002\201\352\300\206\345Y=\276\227\325"
+	.ascii	"G\\#)C\242X\003\256\257\2440\177P\363\242\303/\210\016\314[8"
+	.ascii	"\030@G\1778\267\354\350\214\035pm\215?T\343\330\003p\313\201"
+	.ascii	"\007\230\265\2313\277\337\240\340\216\017\322\031\350\f\274H"
+	.ascii	"`k\313U\230\277\224\211\254\337\003\226e\222w\237\332a\332\355"
+	.ascii	"K\356\275\203\231\2477\255j\212\341\312\370\2338\030J0K\234\345"
+	.ascii	"u\267\274\371\231\030\207q<\326\212\364\371\323\211\t\347\237"
+	.ascii	"\337;\215\024\b\367\247R\275s\344\326\027`pe\035\\\002\317s\215"
+	.ascii	"W\305\340wl\236\256g\323\003\3570\322\340I\357\301\322\303?@"
+	.ascii	"Ta~\362&\301\336;\017Q6_\366\320|\016\241\2376\274\330I\237\204"
+	.ascii	"F\354\206?\347\221\211R\214\337\260\271\200\0315\2764\232C_j"
+	.ascii	"\222\374\376\373S\263\rJ8\324z\206\240\265\004<=\254\213\335"
+	.ascii	"\317\031s>5yMJ\016\272\303\007R\220\212u\234~B.\013A\2340\256"
+	.ascii	".R\306Da\233\232\\\021\314Q1W\262\313c\337&\220OX\323\3020\322"
+	.ascii	"u\033V\342v\227p\033\242\001\215'\020\241\364(\310\357\332\254"
+	.ascii	"\255}'\273\367\231d\331\317\013\320V\216y\320eC\016\227b\254"
+	.ascii	"/:MH\353\0207%b\212\3039\221\233~\260.\312aZ\360`}\264\177\376"
+	.ascii	"w\202\212\272\330S\346\277\266\027\237g\314\033lxs\235\206\251"
+	.ascii	"\333\0336)*J\202\267\035\207\032"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.166.1c3cb0b27440c682,"e",@progbits
+	.ascii	"(\265/\375`\363{\305p\001zjB\210P\020 Fm\215\001\027\001\031"
+	.ascii	"\017XO\320\340\002=T\024t\025\267\024\270\004\304u\234\334h0"
+	.ascii	";p\346-\202\365\311zR\241yR\243\003;\202\033g\334\035\003v\316"
+	.ascii	"\210\335WYGg\240T\371\377\230&\231\346\2518\225\211itD\250~%"
+	.ascii	"I)\245\326\0078\b\272\bF^g\247\276\316>}\235\035\353u\366\"\256"
+	.ascii	"\263\023y\235}\210\353\354B^g\017\342:;\220\327\331\257\\g\267"
+	.ascii	"z\235\275\312u\366\037\257\263\373p\235\235\212\306\331{\274"
+	.ascii	"\316\316\303u\366\251\327\331\245l\234}\307\353\354:l\234=\307"
+	.ascii	"\353\354Q\256\263\343x\235\375\206\353\3546^g\207r\235\375\351"
+	.ascii	"u\366\032\256\263\323x\235\335\311u\366\246\327\331g\270\316"
+	.ascii	".\343uv&\327\331\227^gWr\235=\351uv$\327\331\217^g7r\235]\372"
+	.ascii	":w\342\321\271\021\217\316}\370:w\031\033\347&\363:\367\030\033"
+	.ascii	"\3476|\235[\214\215s\027\276\316\035\306\306\271\t_\347\036\264"
+	.ascii	"qn\301\327\271\301\3308\367\227\327\271\003]\347\366\362:w\326"
+	.ascii	"\306\271\001_\347\356\342:7\227\327\271\267\270\316\215}\235"
+	.ascii	"\373\352:\367\337\353\334Z\\\347\366{\235\273\317\306\271\263"
+	.ascii	"(\235\233\357un,6\316\275\247tn\275\327\271\363l\234\033O\351"
+	.ascii	"\334W^\347\276\263qn+J\347\256\362:\267\235\353\334uJ\347\246"
+	.ascii	"{\235\333\352:\367\234\322\271\251\274\316=\305\306\271\245\274"
+	.ascii	"\316\035\305\306\271\345^\347\206\263q\3567\245s\273\275\316"
+	.ascii	"\r\305u\3566\245s?y\235\233\315\306\271\253J\347^{\235[\315\306"
+	.ascii	"\271\323\224\316\355\344un4\327\271\317\224\316\335\344un3\327"
+	.ascii	"\271\313\224\316M\366:\367\230\353\334L\224\316-\366:w\230\215"
+	.ascii	"s\203)\235{\311\353\334_\256s+Q:\267\327\353\334Il\234\273K\351"
+	.ascii	"\334\\\257so\271\316\255\245t\356\254\327\271\221\270\316}D\351"
+	.ascii	"\334F^\347\246\272\316=U:7\326\353\334E\\\347&\242t\356!\257"
+	.ascii	"s\013q\235;\210\322\271\201\274"
+	.string	"\316}\345:\267\225\322\271\253^\347\376\341:\267\017\245sS\275\316\335\303\306\271y(\235{\352un)\033\347\336\241tn\035\257s\347\260q\356(\245s\343x\235\373\206\215s\333P:7\324\353\334O6\316]C\351\3344^\347vr\235\273I\351\3343^\347\226\341:7\223\322\271\227^\347Vr\235;\351un$\327\271\217^\3476r\235[\252t\216\276\316P\327\371\371:\027\271\316D\257s\r\256s\214\327\231\006\033g\030J\347\031^\347\027\256\263\363u\036r\235\233\257\263\f\256\263\220\3229\350u\006r\235\177^g\037\327\371\002\257\263\005\\\347\036\245\263\213\327\271\205\353\314\342uf\272\316<\257\363\216\353\274B\351\274|\235+\340:\353\274\316\024p\235'\360:K\300u\216\300\353\f\001\327\371\001\257\263\003\\\347\030^\347\006\270\3160\274\316\fp\235\027\360:+\300uN\300\353\374\202\353\214\200\327\371"
+	.string	"\256\263\001\224\316.\274\316\005p\235\t\240tn\341u\036\200\353\314\202\322y\205\327Y\005\3279\005\245\263"
+	.string	"^\347"
+	.string	"\270\3169Jg\025\257s\n\327\031\005\245\363\t\2573\n\033g\023^\347\022\\\347\023\257\263\t\327\271\304\353L\302u&\341u\036\301u\026\341u\036\341:\207\360:\203\340:\213x\235C\270\31684\316 ^\347\01768{\360:w\260\301\231\003\016\316\033\274\316"
+	.string	"\260q\376\360:k\340:g\360:c\340:_\360:\337\270\316\026\3208W\360:S\340:O\360:K`\343\034\301\353\f\301\353\374"
+	.ascii	"\215\263\003\257s\0036\316\036^g\006l\234;\274\316J\033g\016"
+	.ascii	"\257\263\315\006\347\r\257s\315\006g\232\032\347\267\306\331"
+	.ascii	"\255qN\3268#i\234\217\257\363\214\353lL:\267H\347\342\321\371"
+	.ascii	"\221\316~t\356Wr\3420-\213\032\236\331\377\235I\241\022\313H"
+	.ascii	"\367\332)[-\327m\326\355\244[\255\213\314\3152t\22578\ts\345"
+	.ascii	"\216k9\356(\3542s\303=\207p\204)"
+	.string	"3\304\r\307.\224v\033\352\267\0277GgR\243\244\322u/\206c\267\034%\331l\375\204\331e\030]\345\026L\341`\025\231T*u\273e\206\301\354v\373\314O\356&\235\326k\354\252\305(J\247*\360\236p\251p<k\264g;\211qst&\265\341*uyB&F*=\373\240[\036q\354\326\306\271\311\272\354\331fD7FgR#\343\032\340\031\231\030\251\324\306\007\335r\210c\267\035\330\036\214\335V\320\035\214\335\362\b\022\236\034}@\311\350\013\bxeLkb\244\3223\021\217\325\321\346A\026d0\374\205\003\331\013g\031\220\2730\027\336\302X\276\362\037ka?\356\343,\314\307Xx\217\3658\217\361\370\n\337\261\025\256\302v\\\307tl\3459\246\302SX\nGa9\216c8~c7\206\302m\374\204\331\270\312k\254\306i\354\204\321\370,\005\n'\2400\241\204\023&J\220 a\004\021F\204"
+	.string	"\202\210\0208 >\360\240\003\0166"
+	.ascii	"\300\007\r2\300\340\202\033\013*\240`\002\t\"\200\340\001\007"
+	.string	"\032\360\300@\007%\007\233\r54\257\233D\036g\214m\361=\312m\324<X\\\"v(\344\017\312\215\250fA\006\323@\020\244-\316_\374\312\323\230V\340\225\247\261'/b\210Y\261,\340\004\034\b\3021\311u\361\267'03.\017\367\004\266\345+\fVK\334W\336\365+\356\357\313LK\337\323\227\237\027b_\026\257<\276l\234W\034\026/\263=/-\2750q^Uya\236\274\236\360\342\272\020\257<ue\357\272\314\254X!V\261\262\263\322\252\303{\372\221\245s\271\247\037q\326\247\037fs\200O?\250\374\250\232\362cI\312\023\225V\224'\252'\271\274'\036\210qqp<\226\274\371=\361\320r\353\022\307\243\n\212T\266MJ\353\211\037>\351\310\262=\351\310\253\016>\3510[+\214\323\241\245\246\243*\355J\234\216''OQ\210hZ\370,*/\205\336ST\034\nqQf'\324D-\241"
+	.string	"\214\273\201h\002a\334\215\270\022\342n\230\235\320\022wC\313\204S\"b\211\304,\211D:\022\022\343F0\023\001\320-QkD\326-\261*\204\326sK|\002\201\315\3510O\304\003\272\035V\205"
+	.ascii	"t#\223\305!t#c\006\302\213\033\231\247\017\312\270\031\346y\340"
+	.ascii	"\211N\206Z\035\374\232S!\"\007Z6\240\003@\334\207\302%\032\024"
+	.ascii	"\026\311\240\213Sa\025\006^\334\n\237.\bsC\250\305\202\274\n"
+	.ascii	"\374\334\b\343(\350s#4\233\300\215PK\002-N\204U\021p\260\272"
+	.ascii	"\021>A\360@Q\004%1>&\b\202\304\245\370\216a\352\353$6\302\334"
+	.ascii	"\201\216s\022|j@\231\350\364\305C\221\001\006\202\b\341\322\035"
+	.ascii	"\212\036\004J\t\323|6\220\024=@i5u\022\033G\\9\347\244\247\305"
+	.ascii	"\001\320\t\017\321&\317\r/\273\201\256&\317\t/\216\246\316\r"
+	.ascii	"\317\354u\361\212\270V'\274\252$\235\023\336\023\362\317\351"
+	.ascii	"\016\361\330xnw\331\031\257\272\335\345\031{\255\275\207\006"
+	.ascii	"xW\230\344r\004\021\302\245[\354U/\017\357\312\235\225*vrqpo"
+	.ascii	"nP\332\23641+#\033c\"\026\266\245\225\205\344\210\021\352\324"
+	.ascii	"\252\352\207\017\252\036<\246\240\236j\320pj\232!#\021\361\260"
+	.ascii	"\f\2311\206b\274d\001\273p\331\202\275\352\345\341]\271"
+	.string	"\263R\305N.\016\356\315\rJ\333\223&fedcL\304\266\264\262\214P\247VU?|P\365\340at\201-K\007\2611\305\264dt\201-K\362\206\222\321\005\266,\f\004A\352r\201\242\215\220.\375E\017\252\256\344\250\271\221T\364\200EH\227^kw\272\201\344>\243B*\225\2627\335\300\321\374\242\231\335\0060\3174\231-`Ax\317\3036\355\231\210\326:\201\0321\022TI\311\330-\007\357\211,\345\252\367@Cg\0307\370f\222\206M\3621\314\fej\315\2403\3126\370^\353\326\307\026\234\230\331\016\007"
+	.string	"0\026\245\226\230\266b\320:\234k\231\017\017\200\257v\t\324\tZ\243\206\261\333\017\357\201:\025\325\335f\326\265\327\300\315c\360\032|W[/(T\n\350\215\343\222\203\351\202F\341\3508.9\226\2517\342\f^\003\251V++\203\357+\330\013\036\003\036\355\021#\027|'R-\370\233w+U;-\322bA\177\260\025\024\b\020c\267\026|\257u\001\252\266\252\206f6\232Ux\250\340\231\243_\355\220(\330\307][!M`"
+	.string	"\373\370\025\274\t\326\245*$Ot\177\342R\307"
+	.string	"\005\337\325\026H\224\332e\246VP\301\006\234Z'x\n>\002!\255\217\234\266GK\005%r\224J\245XP\352\021c\267\023\274g\261fG\236\330J^6:<\221\277v\265\357\265v-\251&@\004\263lI\3621|#m\016\214\356\344]\355\233i\n\251\335\321JE\301\262\240[[\306n\335\311\367\223\356"
+	.ascii	"m-\260\252l\312k(%\370\256\2669\242T\024.\245\305\001\355\022"
+	.ascii	"q\365:.y[\004/\301;\341W\013\005\005k6f\250X\373\004\035\353"
+	.ascii	"\265\251T*%\321-\2674\332\032\320\262&P44c\267\021|\263Q\315"
+	.ascii	"\232\272\261c\204{\034\036x\b\276\253mS\024\352\204\251;ieD\211"
+	.ascii	"\340\\\277|\354!\370&\373\007\336\255L\210L\335mcz{6\016|W[%"
+	.ascii	"h\032\212+t\355\270\344[-\022T\020\347\352B$\340,\327RfO\222"
+	.ascii	"J\2172`\206\266A\335\274\233\034x\030\256\222"
+	.string	"\336\210=\251\273m\fooC\003\210evx\370\006\340\212\206b<\030\272Q\r\003a\242T\024\203Q\"8S\237\321\341\031\220+~\361R\f\204J\241\002\265Z\215\335v\b\323\n#\206\330\254\202F\t\030\245\222\270r\201\326U9.\271\224\303+\337\341\030zW\274\3068J\245I$\270\250\245\370\007\305\323\203b\301b\354\226\303\367Z\257\260D\213\320\320\214L\263\212\327\246\217op\303\333\350e\201b7\210\261\2725\337\325\"^\224\212\242\003\357\372\226\336\210i\276\346\233\t\261\256h\007\365\343F\302\320?(\326\241Xc\2674\204\335mcT\366\222\\\264B\271x71\b\3059( 7\222n\031\352\005\372\305\273iJ\224\212\"\nT\220\360\270\324v\310\261({K`\220\f\\\213oQj\253M\241@\013\241\206\307\245V\353\265\356\034nw\201\206\201Ko\304/\212Ri\220\024-\327\035\350\304\0239"
+	.ascii	"\n\030\334\253\"\353j7\201\036B\023\243FL\270\366\224\336\210"
+	.ascii	"Q\360\226\322Q\242JG\251T\332M\334rQ\246\350\f\357&\356(\235"
+	.ascii	"t\223\022h\030\230\364F\334^\232U\034\335\177\277\253E\264(\324"
+	.ascii	"\teM\242Y8S\255\033&2\247\227I\r\267K\331\f\362\223\337\325b"
+	.ascii	"X\024\252\363\2567\216K\215\265$\032\325sS\035\307\245\366\241"
+	.ascii	"$\232\225\342\3325\222D\245x\034\227j(Jy\274\321\026U\362\221"
+	.ascii	"\\DR\314\212\376(6\022\216ZE\201\030\201\030\273E>\003\330\251"
+	.ascii	"#O\344\306v\267\215\215\355\031CxW\213F\242DZ\r\353\270\3643"
+	.ascii	"\215RO\270\0369.\365l\320mW\213E\242Y8S\251t\251\233\242[\307"
+	.ascii	"%\bl\320-s\264+\352\345\335\304\013\270Zz#n-\355\336\235\211"
+	.ascii	"\t4\362C\3463\244\376\034U\177\355\023)\006\341\242\020\316\236"
+	.ascii	"\310Na\213V\\\274\272\nZ\t\364\301\305\037\234=\321e\352\217"
+	.ascii	"\007\027{p\366\304\237\226\035\\\224\342\354\211\277)\277(.\346"
+	.ascii	"\340\354\307)\251\362\321g\203\2137\262\214qI\257\2125\270\370"
+	.ascii	"\304'(\306%\275j\342\242\023gO\324aa\342\242\f\273\275$.*q\366"
+	.ascii	"\004\335\224^\321\210\213G\234-A\314*&\017\221?\221\263'\346"
+	.ascii	"\360\310\360\227\341\354\t\271+b\370\r9{B\356\216\220?\fgO\304"
+	.ascii	"Y\001\303/\310\331\023qU\274\360\007r\366\004\234]\027~@\316"
+	.ascii	"\236\200\233\252\303\362o\341\354\2117:-\374\177\234=\3616e\315"
+	.ascii	"\302\337\307\331\023ls{\374X8;B\214-\214\n\036\177\036gO\254"
+	.ascii	"\331M\261\302\177\307Y\023\211vR\352\370\3558k\342\320.\312\034"
+	.ascii	"\277\225"
+	.string	"\263%\204\035\206\311I\341\237\302Y\023\205qq\374r\2345\021f\n\316\215\377\315\356\355\t\177\033gM\020N\271\255\361W\355\2408\341O\343\254\211\301\266&\374g\2345\001\370\204\214\277\214\263&\272L\261\211\3613\341\254\211?\273\352\022~\260\2657/~%jn\\\\\374]iP\270\262\370\265\234\264\005\032\341?\202\366\305\354\261\370\247gL\002\207\360\023I\241\005\204?\b\nYU\374V'\034\241\342\367\201\302\310\024?\017\023\250:\370w\2240\305\301\037u\302\n\212\337\206\211*\032\3745J\374\340\372\031\374M$|p\375\022?\023\tT\217\304\2374\302\324K\371\215D\350\373\002\025x\310\2168\202\006\327\030v2!|q\342\222^\025\262\213\001\341KS\340 ;\241\210\304/\354`B f\331\275\340\034ra\357\002\242\314\225\035\373\001\031?v-\036\214\341c\317\322\201\241\036\373\036\007b\256\260\343m"
+	.string	"X\205\335\n"
+	.string	"\260t\354u\037\362\250\260\317ip\027\205]J\006vp\354q\030\300Aaw\273"
+	.ascii	"\n\033\373\223\233&j\354k\026\230\241\261;\251\240\314\214\275"
+	.ascii	"\t\005dd\023\214\205\261\213I\300\344\213}I\004bI\330\275 \b"
+	.ascii	"\333b\347z`\013\t{\226\003ZTv#\rd\025a\307\362\200\204Kz%\204"
+	.ascii	"}\b\003G\270\244W~\305\016\204\263\"\254S\035~\260WqV\304\234"
+	.ascii	"\235\262\007;\025\207\251\024\373\024gE\300M\331\344`\327\261"
+	.ascii	"Ao\212\353\006;\016\316\212\250\332\325<\261Cqv\204\026\242\030"
+	.ascii	"\032wb\247\301\331\343{\201\n\351 \336\230@\351\225\313`\237"
+	.ascii	"\341zq%\366\245d\226Kz\345G\354Hv\310Dv)gC\2049\226\341>\344"
+	.ascii	"l\b\302\031C\3561\306-a\270\013[,\227\364J\220{\220\263!\006"
+	.ascii	"\247\212\201\334_8\033\302\213\335{\223T*\225\002rg=o\0137\227"
+	.ascii	"\356\276\222\342\341qI\257\244\035t\313\334\177\334W\316\036"
+	.ascii	"\245R\243\256\342\216\202\031\371\311\234m\245\026p\217,L*\225"
+	.ascii	"v\320-s\3731s\366\243\344\270\252\310\244R\243\256bff~2g\275"
+	.ascii	"I*\225J\245\035t{\374\006\316\220\2568\"3G\277:K\024\354(\225"
+	.ascii	"JIpci\276\250\0307\222n9:\026-\363n\352\226;Zf\354\366\370\022"
+	.ascii	"\320\00244;\362D6\376\314\317\3701!\036y\"3G\233\264^\316Q*M"
+	.ascii	"\"\301\215\327y\002\340F\322-\253\300\202wS\267\334,\030\273"
+	.ascii	"5~\t\2760\327\2522\263#Od>Cj\227B\210\005H\361\2110s\367\227"
+	.ascii	"\341\262'\375'\302\314\314\334-\030\333"
+	.ascii	"_\221\266%\311\307p\004\316g"
+	.string	"\315V#\263\001\020\340\335\324~\267\215\361\330Kz#.\276\223\275\3731!\036y\"7\340\377\3140\304`\354\246\342\337$\275\021sS\351:\226\343F\302\t\3408\357\246n\377;\211V\237\341\324\221'\262\277\217\275\3731!\036y\"7\340\375\3140\304`\354&\377\233\2447bn*=\307r\334H\370\001\034\347\335\324-7\307\031\273\355\357\265\376\340(\314UU\331\324\221'2\237!uQ*\225J\375\2110wQ*\225J\371\2070\3238\273\032\215\263;i'\315N\326j\315>\306\316\016F\343\354Kh\234\375\313uv%5\316\356U\343\354I^g\357\262qv\256\327\331\267l\234]\353u\366,\033gG\362:\373\021\033g\017U\214\335\266\237Y\330\237\241YX\263\212\003\364}W\2237\242\324\024I\250g\024\016r,\313w\337\273\265\350.I\003\nV\304$K\262\211\357\273\216\372_\335mYx\030"
+	.ascii	"\313w5)#\271\204\314\332\373\306\202\227D\202\202\025\235\355"
+	.ascii	"%\215\364\276\255\324$\335mY\244\\\310KD\036\"\203\340}\347\351"
+	.ascii	"!\307@\301\212\252xH1W\276\345\260[\335mYt\024\340\356\273\212"
+	.ascii	"\f\203\034DFY\371\276+\302\202\374\002\005+z\263\202\364R\345"
+	.ascii	"\221t\267e\211\"\200\335w\025\t\210\344rL\254\373\266+\312\202"
+	.ascii	"\274\026M\251Cj\241{\352a\013\326\357*\262\017\311w\004\234\373"
+	.ascii	"\266\276\023\372!\365\236hvsxT\276\361\250E\272\261|\204\003"
+	.ascii	"\200\373\216\362=\345\273\212\274\203B\265\032\262\n\264\020"
+	.ascii	"\347XE\312\367\024:(Xg\257 \220\326'V\373\315\265\236\224\357"
+	.ascii	",V\356;\312\024(\230[\221R\242\254\311\275[\251o\337pV\3108("
+	.ascii	"\230\207\271\"\341\236X\236\235\"\337\212\256\3174\377\273\276"
+	.ascii	"\275\207\301Bq{\377\023\202\307\002\224'U\264\266o(\177\310\264"
+	.ascii	"'Z\266\r\355\311\325\335\nlM\312\264\252\337lX$\023(X\321`\025"
+	.ascii	"\031\266\366]\207\375Q\247\202\332w\025\271$J\355*RI\021\227"
+	.ascii	"\"\300\343\322qG\332\267Z\221\027dW\321\2304\344\226\223\357"
+	.ascii	"\274\357\321\335\306gM\001\355\273\212\314B\0369\"\235}\243}"
+	.ascii	"AN\237h\3223d\221&\337uRT\004`\366]E\016\211RKL\221Af\306\224"
+	.ascii	"}\233\t\"\255\226\312\220?\310\276\343\2609\244\004`\354\273"
+	.ascii	"\212\244\212RSL\221<\240P,\223\3571B\344\016\032L\2209\304\276"
+	.ascii	"\351\2607\232\344\204}W\2218\2206\254\200}\207\275[\213\n\221"
+	.ascii	"5\240`8\300\220NK\276\255\330\177\352n\343+S\361\365]E\316\210"
+	.ascii	"RO@2E\211\340\314\300)\371\3762D&M)A\036y}\317a\235\306R$\371"
+	.ascii	"\256\"\245Q*\n\304h\024\316u\306I\327w\222\"2G2U]\206\\\337r"
+	.ascii	"\330\227\321\335\306'\206\302V!\341L\022\255\357\255wk\321\341"
+	.ascii	"\021\314\020\255\300\254o\272W\352n\343\003;\001\311w\365\230"
+	.ascii	"\215RStyF\341\314\\\035\371F\362n-J<b\215\034\3713\362]\367G"
+	.ascii	"\335m|](\250~Q*\nY\242Y8\327\231\033\323o\252\321q\217k\232\207"
+	.ascii	"\365m\305&v\267\361Y\231P\344J\224\332U+\320B\021\207D\276\213"
+	.ascii	" \035\353\226\020\261\016\371\316+\303\243\004!\337\325#\225"
+	.ascii	"(\265\327\244<\243D\030\271\004\371\026\362N\250t\214#\013\362"
+	.ascii	"\006\344\033\317\260\033\313'u\342\352\273z\204\022\245\246\230"
+	.ascii	"\036\237D\211\2100\346Y}_\275\0232\035\327\236hN\254\322\252"
+	.ascii	"\276\351\260a\272\261|:L\374@\213RO861F\361\361\375c\306\221"
+	.ascii	"\354\211\366\304\007\023\252o\253`b\211\036\337\325cX\224\332"
+	.ascii	"j\307%\320B\234\253\221\214\307w\017\247\243W\034\217\256\251"
+	.ascii	"\357+\201\207$\244\266\262\220\354\370\226\252q42\267c\252\343"
+	.ascii	"\233\216\nH\206\204\034\337\325c\221\343\020\243\217\250\357"
+	.ascii	"\034PG V\242\254p|\323m1\034\341\306\017*\343\f\033\3377n\034"
+	.ascii	"\247\366l\354\200\372\256\303\376\025\212\360\364]=\346\210R"
+	.ascii	"S\\q<\243\236:\216Kma\215\357'\251#\024\024LK\215\0324\276\353"
+	.ascii	"\250}\204#\234\276\253G\247\343\214\266\257\351\333\211\307q"
+	.ascii	"\351\331\345\231vlz\3441i\306w\035\026\213`\b2\276\253\307\243"
+	.ascii	"(\225\304\365(\275\302\364-\343\360\211\326x\32313e\236X=G\346"
+	.ascii	"\t\346\231\326q-\3237\036uFL/}\307Q=\257\273\255\311\027\020"
+	.ascii	"\214\276\221\276\225\302@\241N\270\016>\251\236?\216Km\\'}+}"
+	.ascii	"y\242u6\360\211\325y^\372J\322w\366\350\033\t\360\211\346u]\236"
+	.ascii	"X\316\306e\255\217\336\353\260f\322o#\354\023\355\325\2563Zf"
+	.ascii	"\256O,\037\274\376I\237i\236\235\026[\372\257\206\355\213\276"
+	.ascii	"g\251Sww\"h\370\032\276\350\241|P\250\023\2463{-\332\363\241"
+	.ascii	"xO\264\006\274^yb"
+	.string	"u\336\364\256\353\256\317o@,\321\027Uy\2429\335\324\356\211\345\325k\235\332\224\350\235.\306\327`}\2429\342u\356\211\345^\246T\274K\214wD\030O\203\325\214\024(\330\377\205\230\211\362\304\372:9\034\317\264\267\302\370\207\233\341\337jG%\204\f?\364/\334\240P$f\332\240]8\255\230\363_T\237h\3357]{bu\335U\315\352\374\356k\376\220\223'\232\257]\321\236X}8=\3530\315\3675\241\227\301\354\211\346\177eO,\317#\273z\246\371\025\241\367?&A\357W\254e8\026x\237\007\n\203B\225\270.\201B\341l\375<\220\327\023\255\265L\223<\261\372\312\265\213n\372\363\255\345\002\357\263\365D\363\267\253\326\023\253\023\247Y]\346\002\357o\330\236\267\300\221'\232{1\362\304r\277+U\353\231\346z\323\236w/X.\336\365\250SS\300@\354<\363[|Wg\210\314\b)\302\342["
+	.string	"\231\271z\242\265\237\325\023\253\257TYY|\373\361<S\310\214\217'\232\263Q=\261\032\261G\027\362\274\263\255\370\235w\353\223\310\314\324\023\315\001\245\236X\3367\345'uf\307\363\310\321\030\004J\366Ls\274\353\212w@\352L\216\345;\036vJ\256\353\003\t<\005\276\002\337\325\031\034P(\022\323\031\033\321\250\225\316W"
+	.string	"\304L\215\234\356\243\201\003Q\311\214\323L\223\316w\037u\002O\201\031\0319\3766e\302\201\250dfiFi\002\357o\021x\t\314 \345\370\3405k\346(\b\242\222\031\243\031i\004\336\007\261oT\0364\340\035\360\020@\204B\225\230\032\313\264;\036\360\0200\314i\277\253\230$\210\323\3020\017\370\366\213\341\0350\230\343q\202N\020\247`\276\304\360\036G\205\341\033\340%\307\013\267\214\331\247\227K\300\20785\002\032\273\300\360^H\235\322\326\335\326DG\007/\274\002\236\001\337U\343\026(T\t\032\306k{\264\200g"
+	.string	"\b\243_Nk\351{z\265\003N\262\360-\340[K\002^\0018\306\275\034\227\273\352=\275\234\003_\036^\002\336\345\260\b\370\027\330Xg\274\313\361\303\251T\232d\202\371\331e\264\362\364r\np\034\226i\215U\214v\336l5v\213\200\367C\352\224j\"\007\007\260R\001c\200?\300\2271\212\026\003\304\271\220v\270A\001\336\240\360\021\340\013"
+	.string	"fd\353B\200\265\026\276\351\316\310"
+	.string	"`"
+	.ascii	"ihSX\370\001\210\031\315\300\260@\266\3027]\231\341\007\025\230"
+	.ascii	"\204US"
+	.string	"x\025\306\214_bR\360\022"
+	.ascii	"\223B\r\002\320\265\305$\347\003PfD\002E\3141\242\002\2140\203"
+	.ascii	"\024\323\"Z(|\212&F!O4c\220h\3223\255#`\354\026\205G\232\031"
+	.ascii	"\255\214W\021\340F\302\317\265'\033\233\261\333\023\276\347\250"
+	.ascii	"SJ\0041@\361#JE\201\352\331\366t;.\025\253Lx\024p\306\251\030"
+	.ascii	"\355\200\223\303=\251\035&|\347u}\271\240\204\0348p\234\370\022"
+	.ascii	"\344\214PdO5Nh\351\335\230p\232Q\\*\361&\244\030\227\302\214"
+	.ascii	"J\306\244\022G\360, \361]5\036E\251(\214R\250 \316\365\307\220"
+	.ascii	"\360$\250\264\2079\355\300\321\241\2222dH\370\276B\235v\267\231"
+	.ascii	"\335\355U0\202aa\240\b?\202\265\035\314i\017|\207\\\202`D\370"
+	.ascii	"\256\243\022\251B\301\210\357j\033\030\245\226\310\376_\b?\242"
+	.ascii	"\256\345\222\323\036\246\034\"\251\"\223J\223H\364\024f\241v"
+	.ascii	"\313\263\312\214\036\031T\023\231T*5\321-\267\327\026\373"
+	.string	"\274\303{\352a1v\033\3027\0356H\335\004 |W[-m_T\n\347\372[\"\036\204w\3533K\213%\247\325k\367\236~\317\277'\366\2115v+b\312\226\325\255$\b\361]m\361\242\324\024\323\273\257\302\371\020\357\326'\227\326.\247\245k\353\236\200O/\317/\317/\306nq\242l\315\031\232\371hV\021\001\210\357j;\027\245\226h\247@\241p\256\237\203\371)\330\312E\301\216-\\\033\367$|\026>\r\237\206\306nA\274\007\252\031\017)\020t\360\037|W[\267(T#^\333\242Y\235}%\017\376\0032mu\315\203\367<,\007\337\301G\020\f\264\374a\301\342\205\213\343\020\263)\364\023\264s\263t.S\340\300#B\b1\"\004\b3\334d\256\370yq\200\033\240\240\236\241&\263\0017>\313\027\316\235\234\006\030\306\f\313p\003c\031\303e\031nh\230\347\303M\221e\270\361\361\tj\336\254"
+	.string	"\203\001Zx\231\331b\331d\316\260\324\241\241\311\234"
+	.string	"\002\346\371p\003\202\347\303\f\017y\340\241\036\032\226\017\264"
+	.string	"\352q\341\f\n\372\031\322\331i*y\210\331|\341\\2Y [\274X\301\344q\231\371\302g9\203\016\323\207\247G\307\031\344b\210\207\0033\235\313\346\006\366\t\332\tr\0065\205t~`\b\351t\340\037\030B:<\314\035\240\030C@/t\230C/8p\223\311\3233CPSH\207\206\246\317\262\247\311\034R\3520\235\313\031z\234;K\035&O\320O\263g\031\201N\004K\237 \241\346N\223\003\3774\227:\316\241f\017\013\035\240 \035\237\345N\003-\226?4\274\\Q\303;;K\032\256\301\205\016\013!WY\303aD\007\256\301\205\r\013!\037\035fs\t\203\247\271t\241\324\201\261\214A\303<@\313\025<K&\017\362\347\305\020O\217\020\r'wv\2265L\347\262\331\202\351\004\352\321a\016\275\350\2403\264b\311\201\t\243\003\003\005\3658{\206\200\226M\247\016Os\t\243\031\304\202\207\311d\341"
+	.string	"\217O\220\213!f\323\205\323\001f\362\004\375\350\304p\366\314\260l\266\320\351q\002-\225\034c\271\303\344\321\3519\332\324\260\263\347\247\307G\347e\347PP\320\n\235\027?\314$\017\361\364\b\351\3600\233L\027\316%\223\305\006\006"
+	.string	"\365\030\300\231\303\323#\304\201\201z\226-txz\204jz:p`\032\226>\314\346\313B/x\200z`\364\3200\013\026A\316\027;\035\270\006\027:.v\234A@\033`,cl\340\032\\\350\214\250\301\205\316\320\320R\bF\220\017\007\235&\323\351\323\303B\347\247\311t\362(9\205\026^h\261\374\231\341\001\260\320\302"
+	.ascii	"h8\006\004\270\220B\013/\3700g`\372\274\234B\013/\300X\306\230"
+	.ascii	"\341\024Zx\301\305\216\263G\b\311)"
+	.string	"\264\360\202\217OP\363h\334i\036\231\347\003\b$\017\3554\221<=0\2261t\20460O\317\220\313N\240\236 \241\013,\231\315\025\033\230\247Gg)\344t9H\210\006\246N\323\205\023\311<=?:M\027\316#\273\b\301\364\351a\021\324\024\322a:\227M\237\240\246\023(hG\304\016\013\r\206\206\230;AM!\035\236\036!%\377\004\0011ytv\200b\330\b\005\005\371 \271\0314\004\304\\\200\023\210\331l\276\330\251a\026\314\246s\271b\206#\203x\361\001\311\314\026K\247O\320\f>>\314\035\347r\305\f6\316\345\212\031\\~\361\341\231\205\020tvv\2263\314\363\001\004\317\007#\277L\303\007\032@h\231\351\263\334\031\322\tj\306h\341\322\260\374y\231\351\343t\0065]8\201z~^\016\352q.\2337/\034_p\231\347\303\263\317r\206&\323\t\324s\323\202\313\314\237%\320\215\223\305\262)"
+	.string	"\227\231?=Ngs\351\034\272i\021\344B\00762\323\271\344a\020B\224\b!\202q\205\027?*$y\350\303M\007C\0378\270\031\372p3\364\241\206\201\202z\206zf`6\225\354t\321\242\307\207\005\320\222\351#\200\227\207><3\205b8o\230\315%\214\237f\317\n5N\036w\002\265"
+	.ascii	"#\310\005\016N\240\026\\\264\350\031\200\363\205\220\363\005"
+	.ascii	"\002\232A\316\240\037%\213\027+\236wB\320\020\264\342\002;K\237"
+	.ascii	"\025\"\200z\226?\"v\232C\"BX\300AB\314\246\bgPPS\204\313\314"
+	.ascii	"|v\324?\204\033\211  \233\\\261;j\354\265>\226\301\203c\223{"
+	.ascii	"\356\250\321\301\336\211\231\035\354Y\305\321#1\221Y\367Zs\350"
+	.ascii	"\276f\025\211\211\210\177N_\362T\242`\033\246\357\224-\355_\357"
+	.ascii	"K\376\255KUH\321\2577J\024\354\370\312\371\327\177\026\271\275"
+	.ascii	"\2522"
+	.string	"\217\303\202v5\364\302A\353<nZ\263\305-Ju\266\267\355\031\325\204\323\032;\243\340\325\322\033u3\307\350J\276\315\210\232\274k9\257\232\222\226K,\013D\206$\357^\337\325\327\t\264\253\375\256Q\336\263hT\327\275f\321\254\256\276dE<BLk\304\304\250\274^0O\362\036\260SU\335m\177_{B]_Dl'xA\273F\230\326tq\275w\241\275\\[\\]\304\250\202\266\276\253o\026\021[\212\367\bTp\204i\r\021\255\367\255\264w\212\2455E\354\317p\n(\353\273\372\022!bk\265\351+\344I5\302\264F\312\221\274g\275\037\022\255\275W1^+G\"\366'\246\243Y\305\217\037\371\256\276?\210\330R\\\211\332\216K58^\252(\221\021\2465JF\336\217\274\037\022\271\275S\257\224\033\371^\353\342\227\2208%Ue8|\250\337\325W\307\033E\323\305HG\205\352\306j)\334\273"
+	.ascii	"\326\373\364\273\372BA\273Zn\372\326 \202\223;.\321\310}0\375"
+	.ascii	"\033)\007\321\314DT\210\254\336M\216\365\023(\322\350\306j\021"
+	.ascii	"\334\263\300\220\367\"\337\325W\006\264\253\341\336%\242\272"
+	.ascii	"*\307%\232/\"\357E\356^\244\367\210\310\267\036\326\205\274\017"
+	.ascii	"\301{\245\211B\b0%V7\243\347\352=\310w\325=\204v5\033M\026\031"
+	.ascii	"\"=\",\307%\032)& \357A\262\270b\n\201|\343a\337\257\336\t\211"
+	.ascii	"\374\\\302A+\002\344\020\2433,.\271\250\002\023\2456\\ \321\237"
+	.ascii	"\b\"\354q\351E\374\361^\365NH\304\305\005\354\362cP\214N\254"
+	.ascii	"\210\324\302\307\226(\265\253\327\250\224\210\227\013\325\273"
+	.ascii	"\217wB\"@\327\257\217\312jX\224\262\360\036\337U\227\317\335"
+	.ascii	"{\261\300pE\344"
+	.string	"\305\305#\372r\347^!\022$\"$*$*4v\353=\302\304\346\304\016\231\316\343\273\352V\211RQ\270uPA\234\327:\365\316\343\335Jd\350\316\271T\004\240\002\013SL\304\344\f\307\360HI\221K\363\035\357RDd\334\267\030n\276cNL\256\260Y\305\216\353\370\256\272m.\333\353\225\343]\307\241\253\026\243\351\322\212\224z\316\211\347\260\"\0267\270\302\243\276\253\356\231k\366Z\341x\217\"Jt\307r\372\n\223\"\245\246\023\303\001F,\356\313\362\006\330\327[\303m\274\3370r\223\344t\335\225\213\220\334\256\"\245\266N\271\350\305\345\262\221'\006g\230\255"
+	.ascii	"\224V\224\332j.\022w\314\323;\024\223K\235>E\021\203\023\343"
+	.ascii	"\242S\243\310"
+	.string	"\020=\032\3575f\270@\256h\030^)\340\364]u\253\242\324~\233\372(r*\252q\\r\325\232\336\235\240\\\036SMo~\023\360\031\337Uw\207\233\303M\"\343}\306\273\365\206{\303\205rm\024E\351(\222\222\222a&\306\306'\001\246\357\252[#J\355\252\353T\304\003\247\210\352\270\344R-\2753\275[\177\2702\334%\227\251\310\nH\221\020!K\201blbz\021P\372\256\272I\356\221[#\351]\211H2\3610\211X\204E-:r$\311Nl\355\n\004\220\276\253I2\206\321,\021\210G\357H\357\204Y\31109\203I\302\242\255\256\"//c\267~\224\027\226hX\345\001n\004&JM\021\370\244\022\221\ft\351\273\321;\341W\0220\247\213K\007\303\016\r\351\034\220\370]Mn\211RQH^\241\202\"\222}\210\337\211\357\204Kyr\375\244\246\017\277\021\277\227\222 y\"w\231\357\303\247"
+	.ascii	"o)\360\273\3147X\262/\006_2K\221\330XQY\231\261\333&\263B\231"
+	.ascii	"\260C*1\210\371\036\363]M\356E\241Z"
+	.string	"-/)\305\360{L\223\344\235\025\303.\374\026\203\226\264\253+daLX\241X\224\006\f~\207\371\256&\255Q(\024\222T\222N\230\b\277\303\244%\243\304\220#\374\236\303\n~\017\256%\341b\274\t\262`%,\f\034\f`\240D\251)\256O\236O\256/\337`\330\222kj_\246\204\021Ba@\240\223k\362,\351\303\313w`[\262\214\314\013![\263\212\005d\277\253I&\311\260\244\023\340w\326-\371\025C\t`\224\260AC5\005tI\302%\206\313w\027\270d\026\022.\203h\315*\022\260\345\273\2324\222\234\"\375\260\337[\212\344\222D\222C\260sa\200bf\315*^\270\006\271\252\373\373\276JI\376\360\321\177ta]\304\306\020\240\245G\224Zb\n\n\205sE\302\371}k\241\222\324\221\223\214J\346(\262\026\325\025U)\n\210\215\250tA\034\f\t\317\324=g\035\002\022\021\0016\t(\243\033"
+	.string	""
+	.string	"\007r8+\241q\003\024\200\r<x\226h8<\235\017\246\211\n\006z\312\244\204\204\007\006\327b\375~\0247\004\216\2113K?\027\207N\2505\370\031\332\331\335.)&\364\314\2451\300\0137'\247\321\213\030\245\321\237\223\235\364nA)\267c\211^\3324*\016\021RKr\213\360\253fY\316#F \346"
+	.string	"d\r\262E\201ra\033Y\r\030p\246A\222\"\335\n\275:\351\240\335\316\205\315\034\234\376\304\034\254T.\221\320W.a\n\032\363\320\f\003\343\226\250\257"
+	.ascii	"y$C@\341\221\b\002\236\324\376\354o\foW\235\244\332\354\336\031"
+	.ascii	"\317\364\034]\364\253F1\236\267\372\217B\236\351\225\364\366"
+	.ascii	"\007\016JH\233\250n\326\304l\t\334\333\320E\235\224\346p\244"
+	.ascii	"\245y\254\322)A\251\214:\343\221\302\271\tDl_F\265`S\264ZW\006"
+	.ascii	"\231\316\377\301&\370\363\205\374f4\273O\f\241\022\2715C\204"
+	.ascii	"\335\345\327\020\231\234\350\215\376\364\257\246\304>?\340\212"
+	.ascii	"\020)\366\306QOu\333L\256/\037\201 s\350i\244\356\335h\335\215"
+	.ascii	"\351K\257\251`\232\213\351>\262\230n\007?\247[\365q7\377\241"
+	.ascii	"]\002}l\241\237chz\340jWt\025<\030]\340`K\347\b\366\021/\257"
+	.ascii	"\355\360\256t\234\324(S\253\227\022\221Kn\301\362\325\316\221"
+	.ascii	"\200\376\3568A\020\233\323\235\331\321\b\201\351\306\0360\024"
+	.ascii	"\037c=E%O3\025\"@q\316\344\002\246g2[dj&5\315<\t\220\036t\207"
+	.ascii	"0*\313>>vh\342.\272\262\033\0274\003,\332\013\300\313\033X\250"
+	.ascii	"ac0\234\227HH\032\n\300/\030\234g\307\270\320\250\243\251Z*2"
+	.ascii	"\203\277\227\223N\362{\274\236\351\245Zd\217*\331J.\002\333\271"
+	.ascii	"\341!p\267\203.\023\322\302\r\340\311D\213\315\245\214l\032t"
+	.ascii	"\204\266\031\314\270&\241HNFUJ\263\271<\314\007\030\235Z#X\022"
+	.ascii	"\310y\256\026OL\025\315M\347\321n\3610`/\016\302\350x\\\2426"
+	.ascii	"\304\244{FP:\021\203\252\242\232k\362\025\344\270\021\206>\214"
+	.ascii	"(\304~\241\221\233\353X\250\2720]RQ\232\242\t\003\223\231,1\221"
+	.ascii	"G\013J1\006\250x/\355\035M;\254\013\354\231?i\322\221`\304{?"
+	.ascii	"\007\240e\365j\251\373l\365\250\036\023\233\250q\")\253\021\004"
+	.ascii	"\313=.\"w\261w\351\211RS\024\360\365\225c\264\255\032\251\366"
+	.ascii	"\337\234\375_\347\223\226FM\274v\330\333\332r]\n\225\351\221"
+	.ascii	"JF\275\2367\215A\271\265y\2479(h\r5\206\310x\206g*\315A&\334"
+	.ascii	"$\343k\363\247\007\217\032\005\024Y\201,\324Y|\226\226\331\200"
+	.ascii	"\327 \230\314\227(\203\275#\374\375\317\237\371\336\346\316%"
+	.ascii	"\227&/\215@\006\220U\027B\346v\322\240E\007f\313(\230!\330:\351"
+	.ascii	"<$eZ<\022\335F\247\200<\330\252\251\302Sx\315r\224\007V\224G"
+	.ascii	"t\b\nU\352b\320[\227Rh\017\312s\374\006\203\343\\:7>.\337\352"
+	.ascii	"g';\213BT\005\263\307\223\364\217\3138\330Rm\245\276s\300\335"
+	.ascii	")\307Bu\212.{i\r\003\021\367\177T\364\317\262\364P\224\213\026"
+	.ascii	"\305i\262z0\230\320<IDw\2149\263\265\007\231\367]\223t\273K\004"
+	.ascii	"\220\223\241\367\305P[a\352a\360\220\331\344\3220X\325\307\b"
+	.ascii	"Y\345da\021\025\314\342#l\376D\007\334\330!g\370j\236o\325\177"
+	.ascii	"o\313\253`W\232\034{8\234N1\225\0317h7I[\315s7i\354\020\204\016"
+	.ascii	"\350G\327\216\313!w%\234\261\304\3507su\360\352\307K\017\250"
+	.ascii	"\322\307\271\n\355\225\024V\005\322\201\376\361\030\004\233w"
+	.ascii	"|a\375\334\211#\345X\305B\224\004\231\021\270XbC\227\252\221"
+	.ascii	",\2423k\210\036R \351\037\261q^\330\316\252*\232f\251\025\315"
+	.ascii	"`\027\223\337\336\365\236|\027\343u\t\315\237B9\207\250\253\234"
+	.ascii	"\"\223\213_$R\346\n\350Q\214\227\205r\201\237\265\242\326Hbs"
+	.ascii	"^w_\357\225!Wyp\323S\310\350%\211\245\017\330\f\273\024<\242"
+	.ascii	"WG\217\020h\235\303\026\257]\006\222\246\260\325\324\302\020"
+	.ascii	"f\013\375\016\240\032\355j\224\260Wy=\360\250\254<\301\030\035"
+	.ascii	"\270\335\352\\\354\254w\341\222\306:\375\266u\215z\232\031j\237"
+	.ascii	"\216\025\302\037\241+\306^\347Bh\352a\260'\004\002\376\031pJ"
+	.ascii	"\353H\251\357\001P\244\024\312M\034z\221\305\201Z\257\303\n\341"
+	.ascii	"\017\310\225\034\227\300\266\264\255&\356,!\276v*\345\"\013\233"
+	.ascii	"\275\252\367]\332\371X\323\002\305(\340\344\305\267*g\022\200"
+	.ascii	"\354l\035i\3661\300N#z\310?\375\363\272\005"
+	.string	"f\"b\027\200\261\302/{\0327\346S\241\320\275\034\375gY~\254V\3453n\223\202\242e\t\265Cj\317\337B\245\3165H\331l#\366\375\004!\311\360\367\021F|\200\021\021\202\246\345|\314\340\356APQ{D\204\3109\344;\2109\\\t\025\250\f\266&\310\350\346\264\302\313\f\234"
+	.string	"I\375@\033\241\212\230\035\003\246\212\327\n\263V\017\374\341\321\013\243\324\025w\233\224\265i\252{\021\004\312\363\313\0173/\302\\\321\225O}\035\2347\rvH\265m\031\342p\361\262\207\342\210y@\304\337\261\025cV\t \244\326K>\357\226v7IZ\271\264\240\330\274\351\210(S]0\031\212\224\364\021\312\316\223\3728\307~\247\255N\232\361\340\202\2608<\204;\023\212\tl\200\030\343\272\271j\212\235\031;/h1\005\234\326\221\274\234Y\272\357m~\345c\275\207\233-\313\350\367\022\345\372\254w\002f"
+	.string	"R\221d\032k9\334b&0\241(r\002\224\357xe\247\346\254\001x\357\374\001\246\334\206\340\253\007G\216qF\333\375\351\177\301;f\254\230\246rb.*\201\013\206\210ZI\233&\026\227\006\260V{@@\373\353\254\t\002\270\r+-YO{|\001\324F\224M\262?\272\300\260\265l\312\025\017\213\371\0063\017\230\240\3463,d\252"
+	.string	"\325~D]h\021<\272\022\245H!\333C\273!\343\367\336\231\355\026K6\227)Rg\031G\\\037\377\217\322\357$\rk\240\204\342kl0#\t\240\235i\200=\261\352N|\035\365\217F\006t\212\"\366\020\265\214\027\005u\350\245g\231\013\371\204Ui\322\376mqt\302\031+\021\231\354}%\216\003C\353\204E\363\267\304\r\204hGUMb\240\017B\003\342\310\255\\\363&\031\024\270\005*\251[\202r=\364Cv\256T\223\027\332\243\001|+A\0259\251"
+	.string	"\247I$6_5\003\245i(gJ\322M\003\017H)\002\324@;\325\001\256\f\257\323\\\317'\005\001\225\254P\275\024\313D\206_X\310\002\234\277\024\304\032\r:PE\004\250\321v"
+	.string	"'C\376\224\335*/\022f\037\327F\255G\033%\312;x\026\364\263\275D\213\005'\356\021?kLi\035\375\016'\301\377\204\210\336*\344\240(Z\017\343|\034\233\341`m\350Gr\222\026a\213\370\374\363G\272w\301\211C\032\326\277t~\361\n\327\302Bl\210\274\212\227@\001"
+	.string	"\337>\250\001\227\264\020p^P\340\225\313\r\273\003\206u[m\246\0256\213kZ\267\2337\277sbUI<\361\r\200\2538\235\344\252\210_=(\r+iE]\253\251\376&\3316\273L\237\352\2237\377\363\341h9<\252d<\224\024\3170e\263\022P\372\306\016\334\314t\302\350\225\342\307\322\256\177\203\036\003K\031d\3749|\037o\240\360\342\035X3\027\371ghp\007h,\260\211[\025\216-\205\25181(\277\346\364S+\033o\207*[\355\201\214W\270U\"v\357\022g\207\326P\300n\351S\243\200\346\026\236\210\372,n"
+	.ascii	"\364\336j\226pNR\333r\217\267\177\2724\230g\224\3268{t\264\350"
+	.ascii	".b6\210]\323Q\201\234\321\241\030\376\177\3600\004\210\335\025"
+	.ascii	"S\226\220\313\022\276\035\331\374\226\267\330\257H\372Q\367%"
+	.ascii	"\220\317 n_\020\313\267My\276B\253$C\344\366.\257'Mu\332T\376"
+	.ascii	"K\224\370\025Q'%\321|\005z4CYS\217S\251\224\310j\260+|)\206\212"
+	.ascii	"m\370\376o\223pk\341\260+.vO\017\301;\271\024\315)K\356\236?"
+	.ascii	"\217\254\216\022$\374\371[u\036\221\306u,\213e\202\334\003X\023"
+	.ascii	"\202\207W\325\213\021\210\004>\007\337e!\344\266(\226\r\304\023"
+	.ascii	"%8\374\330\200\036\242\323[e\366&\317\267\fN\3768"
+	.string	"\303\242Z:\221\004\233\303u\335\212J\341\036\226\214\nc\237\331\224M\2652\035\273\030\340\225D\210@!^P\306|ry=7\021O\322\263b\306\362T0e\317\004\023\321\324\360q\201o\304gVq\020U<\257\337G\351/\262:\006\240?9)\007\342\r\235\t\025\r\350r/\245!\203U\027\005\037\2570\351\347B\326a\020<\037\226K\254D\013\\\274N)/T\023[\222\221\027Hk\253\267~\305\377\207D\025?\210ny\372\313\347.\327]>\277\334~\371x^\356\215i0y\006\026{e\022\025N\026\301\033\217\245\037\246\321C\346h,\355\032\272f\244\256\313st\337\237\367-\331]\262/G\005\262\306)\275\372\007\200\\\023nB%\336\262\252\375\255F2\276\017T\366\340\213\205k\032\327\316P\306\264\375\274\023\315\322\223\305\231\330\303\257T\241O\374\227@\007\233&\251*@\270\341\020o\375\207e\337"
+	.string	"3\215u\0246\231\240\301\306\034{\354\240\263\3201%p%-Z\327V\030p\237\354\325\377\214U\nS\342\211a\214\374\313&t\324\023{\227\240\223\f&Y\3039\022\227\376\363GI\224\3107\206q<\330\352\245\007~\341\267\205\332\334\034\310*\246'\271\324\317a`1$\370V\205\257\212\256\357\262op\340\212\372)\370\343\316\311Q\\\271\262M\247'b\305\324\341o0\245\315\337\"fI8a\255\314\336\341\322\013\004\261\206#\256\24487Q\231\350R\033\321\311Q\274\335\331\245\335P!\235\241\0324\346I4I\275m\363 #\277\2037\300\027q^K\036\323\212^\203AS\177)\275"
+	.string	"\2631\016WbM2W5\357\335\213\310\237\332)\001 \020<\371\207\2631\n\007\351@\300\257\315n\276\371\345\017\2032\006\036^\"\263\210qT0rg\214d\262*\357N\267o\213hn!'#(\272\361[_\326\243(6f\020\304\341zxO\364\016!\323\334nf\017\262\342c!\2227T\305&\255*\0224R\030n\324.\304:\\\022,h\372\206\2231wh\316\031\344\001\037lSt\362\020\261\255\306\363\224\326\376,\243\305\024\b\017N\257X\212\371\027\242\350,\204(6\335\342\340EQ\230\200\2401\320\030\013\373d\306\233q\301f\031\277\033:O6x\337\036\202\215\006\256j\271M\3003\371\326\200\003\214\021\316\033\223G>jG\\\226!\027\362\210\310\376\375J\320W\322\031\341\030\236\277B\232\373\341q\313n\337Af\304$\250\257\317\211\3561\036\226\364\363[\013\275\""
+	.string	"\"P\202E\224s\204\216c\221\275\242,\243\256sAt\322\212=W\030O;NQ\007\035\310\201\247\336\006\013\310\031\214b\016\244X\tb\026\332\024\b\"\3060:\023\220fB\250\322\346=2\210\251\030\200\214\361(&(\212\205\360f \266\200"
+	.string	"\362\f\243\270"
+	.ascii	")\326\204\232\241\030\370\372\301`\324A\376V\026\311\230\302"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.167.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\335\013"
+	.string	"&\326P@\020S\224\016"
+	.string	"f/\""
+	.string	"\007\004\b\330r"
+	.string	"1\240$f\317y\027\3437\034\004\215\250\220d\264\031j\370Oam\350L\215,\374\022"
+	.string	""
+	.string	"\021\364"
+	.string	"!`^N\340\305w\215r\177\244\222\275\245L)>"
+	.string	"@"
+	.string	";"
+	.string	"\207\316\354\034\337Nk\321\321\201C\307cw-E\361\354O3\363)\332\350\257\nq}\007JHt\0024\322[\320\302\344\305\271g\210V\312\004\220\331]\247I\373p\303\333~`\333\201}\b\001\232~\205\200\205\b\210\237j\354z\210'k\002o\244\260\375\212\355\334.#;I\006\013\201-q!\r\252Co\325\323>\214\307\310>\242\301\001vK\320\260\261\27310\246:Tp\003\324\341{\001*\032\016G)}x@\214q\307/\3245\365\033F\220\336\275\304\202/b\220(o\022Q\207\327s\177+\\t=D\200d\264\267Q\352\t\373ow\327j\302>\311O}\344\207/\235\001W\350\212\360B\036\316\005\016\364\006\203\001\323L\330\\\0244\226G\302\325\2616\037\220\205I`\254\002\347c\2050\354cU\266}\006DI\032c\374\361(I)T\273\203\345M\206:\372\f\025''\375\205J\r\025"
+	.string	"`\251'3\240\316p\347\205\315*\b\270\222\250\266@J\213"
+	.ascii	"$L8ICa\230\320\3205\240\030F\003\34175\005\356\005SS\304]n\252"
+	.ascii	"=\032\230\332\003"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.168.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\317\001\025\021"
+	.string	"\366\337qG\360\320&\035\270\277\254C\360\373\345\265\2739\3464.k\246i\367\320\370%R\027)\321\214\221\021\002\257P:\344\210\327\025\205\211\001\\\242\331\325\033&\007\236!\032\003\312J\243\364\245\333\375\236\260\367A\370\307\222\275\245L)\\"
+	.string	"X"
+	.string	"^"
+	.string	"\332\245-co\227\337\274\262s\020\260\2313\ff5pbIsNnI|uM\306\325\225\177\327?\274o\346Z\200\017\304\345\207\307X@h'\026\362\325\304\004*d\256\2036\272\321\204H\206\023\362\335\304\022\236\035\245\273\256\033>\226\252\t\302\234\323\352}9\267\351\266Ul;\260\365@\336\367/\214\200d\254\235\261_,\335\036\373q.\217\275j\220\250\336V\275\253\326U_\304\200\253\345\341&t\314\311!\3541er\006\212\277~\373\376\212\2032\017\362\002\237\331\366\037\037v\026\007Z\375\025\363\2313\357\265fEGsvPpi\024"
+	.ascii	"\227&'\321.\343G\002!\217\237h\333\202\354oB\2604\264\037\343"
+	.ascii	"2R\252\224\024\355r\333\203\217)|bJ:V9l\205\244\304\234\263A"
+	.ascii	"\b\316\t\032\036\322.\214\030\363\220v\017\373\200!\243\241/"
+	.ascii	"\211\b]\354\366X\367\213\002q\324\350\222}\241\267X\361[f\351"
+	.ascii	"\244\337i\227\272\b\212th4\264I\355\227\013\372'\230S\004\230"
+	.ascii	"\026\025\006\325\207S(\031:\324J\352T\001\305\265\250\234X\270"
+	.ascii	"\224\313\013\207R\342\316\202\312\205\203\351:\027n{\321<\316"
+	.ascii	"\345q\375\032\214\210d4\313\322b\342\234#\036\374\365\303.\340"
+	.ascii	"(HC9\242\017:L\202\366\3433K\362\374\t\232\017R8\351=K\337\330"
+	.ascii	"\321\243\025\267\347'\032\310\242@\033\"a\030# @\002c\230\312"
+	.ascii	"\036\240\352I\241\255\003\2267\320\210{\023\2655\274\325J\202"
+	.ascii	"\235PI\315\021*\023\0235\360C\373p\256\327\004\361\255i\211\007"
+	.ascii	"\216X\2353Eq`\214\367\007bM4\210bk\304\236\b\306\031\237\t+@"
+	.ascii	"\035|\032\003t$\026Y\340>\233e'\003\263\007"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.169.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`K\002\215\023"
+	.string	"V\243}H\340\360&\035\302\307u\341\253T\3544\37598&\351\t5\323^\350\261\006\277\032\0062\002{\247\244h\242g\354\326\352\271\032Pj\270\261\336\330&\016\f\317a\304\361\001\333\340\223\336\211\365\2019\366\353\\(\177\354\275\367N)e"
+	.string	"`"
+	.string	"o"
+	.string	"\033\302\344\324' \247\306}\244\236\202|@=\265e\354\357\364\237e6S\001\232\235-p\202\362`\004\265\273\240\354\271\354\225N\031e\376GJHh\233\275\252l$Nq>'\311\221\216\221\210mf*H\301\273}G\023\245\210\255f&\330\335\337\036ml\265\030?Rv\3271\264\335\334\037\267\275b\273\201\035u\002\017\375\243\263X\361\177N\315\002\243>\254\3064\304\207\227w\261\343\211W#g6\256\026%\217\375\271\273k\271c\317\350\257F\253ht\235\321QF_\304\300\r$\021\007J\332\005\321\233Z\036U\002:\356\267\357\253\370N\346:\243\334\212\202v\367\373\220\237;\321W\310\216\213\371\336\354oP8M5m\025T\242J=UI!\243\245\0310\317\275\214\"\324\213\252R\206\353E"
+	.string	"@\216\034\245\307\200\321\261\300@\237]\232\205zZe\355\001z\262)\021\245}\341\271\326\210\317\3562x\310#\251\345\377D\371\334\247\224P\217\250\034Z\354\305\335\235I\311c\223_\262v:f\242\224\003\304y\327\250\037:\322\353\305a\264\\\257W=\375\320[\300@vi\001\253\227\325\203\227\026\027\007W\210['\035b,\226\326\n\003\013lYY\301\300\226\313\006\360\004\201c\031\\.\340K,\346\002~8\332\347\312\235\333\377\201\t\207G\223\265\0323wO8\310]@\223\216\222\304\353\236\203P\211nEA\341\201G\250\376N\302\204\370\320T\316\214#\247\307\210)y^R?\311\332\331\350\365zO/\251*\371\311\327\230\250-\235\006\2052 P\0021\b%=\240\352\t\241-\003\226u`0{\311\272\254o\325c6B\232\266\224\005\344/\3422'\206{\225\254\263j\215\324c\031\221\035"
+	.ascii	"\303zAH\202\b\035\3022\206\003\022\007|\262\314\002_tRD\3540"
+	.ascii	"@t\320\246\221\002\330\343@;N\262\003w(\235d\272<6\bv\342F\244"
+	.ascii	"N\250.\302\004z\360\331\230\240##,j\317n\265\031\346\266V\351"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.172.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`^\002\305\022"
+	.string	"v\341uF\360N%\035#\365%{\235\366Y\304\224\261\362a\036\253\035D\021\215,\223\204o\351\327\357\022A\256\201am\277\035s\001\352O\354w\306\352_\360D6\341;g\264\026\215\342\262\354~\255u\313\031\214\220\275\267\224)\005e"
+	.string	"V"
+	.string	"f"
+	.string	"@\2659oj3fSD\332`\373\305\356|"
+	.string	"\301\213[\001d\\0<\2424\300B\304\230Sh\265\031\336\372&#\\m\371\256o\rfL;-\212>\f\227\021\022\320Y\272\320\361\301 "
+	.string	"\025;.\272OFaL\367\315\350v|/\3501\347\374\354Z\363\315\250n\"sN+\315\207ss\267\355\262\255\262\225'\037:AQQ\221\217\272\252'\003\367\340qs\316\005~\320;\254\370?\217nq\321\323<\372.\362\361\373\331?r\230\232t\202\220`\264f\013\271te\366\341\\\036\333j\216Uw\253\336P\265\006TsP\275\251Z\256:\252\032\252zU\255\252~\307_H\335\330\344<\033\201\350\211[\r\275"
+	.ascii	"\271-\267\237\001z\231\370\211\007\020FF\344\343\266\n|bq\345"
+	.ascii	"\0366u\243\227 \361\177\3142\321\323\230\310\307\270\307\231"
+	.ascii	"-\311\210\035\256\314pwu\212\204\367\244\236\242\225\0339\215"
+	.ascii	"\200\373$\037\325i\"v\031\370\\\347\234\256\335o\t\021T\214J"
+	.ascii	"\201\360TN\226p\242\225\217\2369g\202\017\001f\205X\360JPX$)"
+	.ascii	"%\253\t'$*+\026K\313*d\200=\n&,\253\n\236\307\262\352\204\346"
+	.ascii	"\341\\\036k\274\322S\2428\320\216\240\337\222\237\235\233\021"
+	.ascii	"\005D;\222\177Krl\215m\216\265\b\314\276\266\225ymXL\255\220"
+	.ascii	" \262\333\205r\355 rc\273=,\366B\341`c\237\342)V`\210\246\024"
+	.ascii	"Wf\215\225\0017 \220\002\031);\017\240\365.\037\272\006\023\212"
+	.ascii	"z77\267B'\rVd\025\311\370KF\023~\261\nd`R3\032G\334\216\036\245"
+	.ascii	"\037qX\274<\t2\303\177\253e+\375\027\242%\256\nH\200\236\241"
+	.ascii	"\001\020mc\277\362\361\034aA@(\276mE\262@\363:@\221|\332\336"
+	.ascii	"Z\204\030\307$\343X(\021Zh\207\027\265\343\230Fd\201\373T\324"
+	.ascii	"\360\270P\007\236\025Bu\212~\323\233`\312"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.173.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\001\002\275\017"
+	.string	"v\332^D\020\221\223\016"
+	.string	"\275\036\346\244K\222\022\036@\261A\023\300w\351\344\002\205\302\355\371\203\035\201\251\037\007\205\326\214\257=c>\024\035\255\234\005\332\330FD"
+	.string	"XEh]i"
+	.string	"\r\246\030\342B#\304\026\367\336R\246\024J"
+	.string	"B"
+	.string	"P"
+	.string	"\273\032nn,\ft\001a\373\231K\266\214"
+	.string	"\027\326\204\200\206%\265R\263\273\232~x\351\360i\226|\216\217K\2652\035rJ\376\260U\311\025\300\212\344\025\330\335w\317\f+T&\307\307\356:U\253\rw\274m\005\266\r\330I\n\251\307\340\001u\021\037\021\342\237Xd$\257:\364G\342\341\025\353^\324`\235\362\306N1\245\266\354\277U\023[\323\035MgOc/}=\315\321t\3244\314\364\313\264>\235O\277C"
+	.ascii	"\315\t\207\207x\t&\325\026\246\034\375\250\270 I\033\276\024"
+	.ascii	"\323\247lN)\256\342\201g\333\342\341\245\003b\2608\372\226\224"
+	.ascii	"M\324\226\257\200\"\324\310\362\023 \b\241P<\204z\240\213Ayj"
+	.ascii	"B\024U\237\312K\210@8.\036\252&\200\321\201\225J\342*\032\177"
+	.ascii	"H\274\006\336<H\334G\264y\"|4\t!\017\210\266\215D4\017\002\346"
+	.ascii	"&\200F\032\005\216\033iY\312\376\255\232\\3:\230\223\242`G\332"
+	.ascii	"\013\030\344UV5\355\323\326\212\267h`\241\223\251\231\351\350"
+	.ascii	"\013\212g\332a\341 SR'\203\302\002E\227\n]L\315L\356n7 \300\002"
+	.ascii	"\0311\243\007\340\2527\"t\252\004>\3765q\356\345\262\366#M\t"
+	.ascii	"\204\206\030\263\211BQ\2632\304r\312\314\022\360\350\223\024"
+	.ascii	"\343|\331xl\304A\003&+\1777\244\270\321\263;{\341l\334\371\260"
+	.ascii	"<\ro\261\225\267\311\273y\026;H\324l\374b\325\265K\035\310\030"
+	.ascii	"n\220\243\266\370\225\251\331Q\033e)KL\023\rE\207\370\032,\224"
+	.ascii	"\211\006lO\036~zki\031"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.174.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\233\006\005$"
+	.string	"&{\325H\200XN:}\001\225\212\256O5\317\327\315\375\001\244\221\313\334!<\022N\347\337\336\355\037\257*p\247\325,\332\301\306!\2139\2463&\331\023\356\034C\304s\201\377'\361\263a\310\237\307\264\032\373\277Y#\226\020\262e\222\001\300"
+	.string	"\263"
+	.string	"\306"
+	.ascii	"\374f\376\330\311\326\227\311`\337\275XZ\330\356={\300A\352Q"
+	.ascii	"\237\353\244G\317\013H\217\362\312<"
+	.string	"\267\323t\207\021\312xqJ3s\357\r\332\255\257\317\301\271\261\251\001\376|j/EO\333+\2777\3443\"\207\317\301Q\336\234:p=\302<\356\230<\033$\337n\330\234>Z\226N\217;Z\235=YWx\367:^uMo\b\030w\254\272\327\221\252\177\312\323\307\353\250\243}\007\260\240\246\256z\035\245\272\027w\234:}\320\234:\275\331\017`A)\217\342\370y\203l\002\"\213mO\235\247 \306\033\344\214\263A\335\02427{\323@\022\273{C\367^n#\022\352\f\340\314_\300\314\025\230S\007\001|)_3\342\3778\312G&L\244Gy\354\323\336c_wI\262\262\276\322\3644\3042R\272c\245\254\362\340\354\270\310\025;\217\371N\376\004\211\377\203O$\365\215I\351\321\035\373&W\300\345-L\222L\212\251\233\314g\304\266Z\314\267\315f\263\3116\213\031m\006B\233\177\320f\036\264y\347e\177"
+	.string	"\265\371\2476\373\324fUm\356\365\232\323^3\2326\237i\263E\233\033m>\002\003^5\242^\266v\357S\023\315]\242mB\370L\336\244\305\317\030\202\330\0303-\226<\355\305\317\270\002\032\251\027\314Or4\030?c\nc\300\243\3140\230\201G-\2209jL+\313\002uG\262"
+	.string	"/\367\323\036k=r\332VcR\371-\245\326\n\201\372\367\253X\312\274\222\255f}\243\265g\262-\213>\fH2\0201\303\332v12\177\244\364\266\355g$\211\335d8\373\344X\024<f\021\263\337\306Z\324\305\253S\247\034\350\013\032\223\370\2267 k\201\253\214\251\233\\\205\fL\331\373\261\375\245$\213\206\037{\2643 \276\201%\311\24460\2418\020\2511\221W\346\325\261\245V\013\312\335:\\J\254\tvG\240\231=\020\321\345\r\350"
+	.ascii	"\226\031D\b5:\274e\321\016\273P\001\315,bD\337\310\227\243\263"
+	.ascii	"[\022\355\220\305\350\030V\235E)O\225U\232\341\323\230\304\331"
+	.ascii	"\212\324{\213B\001K \216\222\220>\254Hq$\024\2620\262a\243 \027"
+	.ascii	"J%N\030\025\241(\021L\201T\224\0244\022.\005\203zXI\305\2210"
+	.ascii	"\270BII\030\004\2361\375\2746\213}v\310%\223%\"\0310\233\347"
+	.ascii	"\275\367\346\210\221\260c\316\f\347g}\017\272\330\304"
+	.string	"f\372E\365m\246\361]\t\363\201Ib\271Qm\317\376\213\035\034\315Jua\002\363\212\343g\326\034By\252\275\300\3256u3+U\002%\257V/\263^\365(\217\222\351\331\337\030s\303\343)\323\266\264\261Z\234Z\324\276\214\307\357\230\267[{h\255[[\351\321\324J\220\343z\335\352C\275\367\n\361\347N\267\002Y\205\254]kWz\024\2651\306\334\302&D\271RjV\"n\004\214t\200\230\250\221,\b\215cjD\244$)H!\035\220\002\221\251\262n\020H\210h&I\032\003\340\3031\031\245)%\260\003\024\004Sa1\335\337\302?H\267\376\266\217\315\266FZ\"V\310\331 R\007\201\017'K\217\322\024\026\312\200\311$D\367@\006\314\034\005\224\177\200W\377}(\001\301\251\225\303\342v\021\031\264\331\007\035\252C\372kb\023\036KH\331\201\250\320\341\242\031)\230\244Z\351\007H\366\202\013:\241_"
+	.string	"\305M\030'R\r\3565\037>\017F)y\027\270)T\342xV"
+	.ascii	"= \266g\310\005?\006/pB\207\245{r\330_\022\331\334\237\225f\367"
+	.ascii	"\260\272\363x9.\013\037kb\353\264\255*g@\fp\267\312\221\257\230"
+	.ascii	"L':!\035\347\271Q\313-\232\202\001\320#\331|q\321\233\251\034"
+	.ascii	"\341\240/)}\321\313L\013\231\374\317\257*\266\202\331*3a\252"
+	.ascii	"bOj\026D~]\211X\374\023\376O\006\300\025t\307\246\357\237\265"
+	.ascii	"\020\235\0072b|#u\224\020\263\274\347\274.\345\257\260\006\245"
+	.ascii	"\270\345\no\363\\\245O\r"
+	.text
+	.section	.gnu.lto_blackboxUpdate.175.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`y \205x"
+	.ascii	"\212\265\204(P0\222\322\032\003ww\335\t \001\022\004#\340p\310"
+	.ascii	"2\336j4\207\254b\240\226\343\216\310<%\241\202\333L\367C\224"
+	.ascii	"\264M\352/\206\330M\327\034s\023\377\270\343\356\356@\020\004"
+	.ascii	"Q\325\005\0013&\252ZM\304P\341\241\203\355\033\331\232\2242\245"
+	.ascii	"\224\002"
+	.string	"\201\002>\002w\002\316l\320y\r:\253@\347\3779\273\317\271\033\212F\23118(R+/\307|\245\246i^\347\232\226\244\275t\267\311}a\005\232V\\:\216\205\376\3022\224jp\316\356\342\266\027\035AN\314\227\252\007\352\351\024\273{\337\242\002\277^\231\371k\035\226\005f\2676n\366K\365vT\230<\"\364}_\244^y\306OK\007\311\262;\266&\333\332\013Us`j\tpI\243\0233f\241\311H\326Y\261@I\006\366\276/\225\376\241\205fr+\225U\300Z`6S\340\215\255\fM\2351\353}_(\035\345\205f\362_I\363\002s\373\320O`h&\257W\364\356\214b\357\373\326\364\312\f\003sM\25795\314\334\316\334b\235t[)\003\003\337wK\211\366\276\314$~\361\3535\250w\330^\325\326a{e\227\231\256\231\\o\ti\025\250(w\357\373*}\021f\253\314\346\240\273-\343"
+	.string	"\003b\0200"
+	.string	"\f\001\002"
+	.string	"@\351E\222\013\244#\243\026E,\210V\f\251\020\nJ\001\364\343\203\342\204\211\022=<;$tF\210\b\221\203scS\023\004\"\360\363\261\253\372\356r\373\262\314\030\334\224)a\3138@\352\006\304xB\347\004\250;]\210\22092\266\365\230\363\001`\340\215q\001\310\210\361"
+	.string	"\330\235;v\347\311\356\340="
+	.ascii	"x\255\204\307\305_\204y\363\2442\027nH[\332\374\350\253\250\305"
+	.ascii	"\215\310\240\265(2k\225\210\021\215\255YXq\242\263*\276\342\354"
+	.ascii	"\007\037\362\325\200\240\310\030\246\230T\205\257\306\026\325"
+	.ascii	"\224\0262\353 \325\004\231\220(\355\245(Ee\201t\206u\234\231"
+	.ascii	"\247\230\262t\240)J\377\261\342#\326(T\030OwY\355\245(\246\332"
+	.ascii	"\340A}\351\257b\230\237p\342&\220^\002\255'\211\363\244\355\350"
+	.ascii	"\340$\324t\216\370\2105\021l\335S!\214py\316\227\227\242\020"
+	.ascii	"\307\361\325\320\322CF41\344\3152\210\333\250\377\244\f\313\214"
+	.ascii	"$\230\221\376*^y\215\332\366\210j/\305,\225\206p\214]\273ay\320"
+	.ascii	"W#\007* \r\354& \215@\320\373\276\375U\314\363\237\320W\321\312"
+	.ascii	"}\354\016_\205\266\250\334ZU\217\240@\240i/E7uGj\007b/\333yL"
+	.ascii	"9\371g\241\222\004\333\001I\227\021\352)85d\327\256\346\221\336"
+	.ascii	"*\272\331\270\257\306\373\276\354\304)\252\346\031\315\254:\231"
+	.ascii	"\331\001f\037\t\002rlXj\336H\023\317\270\355b\261\301\257\371"
+	.ascii	"\336a<z\016.\226\033\304\025\"\204\3555\370\375\225$CZ)9\360"
+	.ascii	"\231]\"\3561\310\351\205\374{\340\373\034\324^\316\377\276\335"
+	.ascii	"\272\203\"l\\\240\366\232|\252\362\233\017g\026\340\037\271\333"
+	.ascii	"\367$\265\003\002\217\203[\204\365}o\215=\221\234\231\315M\226"
+	.ascii	"\331=\342\352\340M\364\275\233\241\251r:\375\376\310\354\253"
+	.ascii	"\3174\366\306_\332\365b\327g\177\rb\207q\350\323$nt\275\210\230"
+	.ascii	"\335%\036\304e\262\"\314\373\2761ze\307\362,\267\t7\222^\331"
+	.ascii	"E\272an\030\333\353\372DO\245\2203\273\313\005\274\211\352\367"
+	.ascii	"\023\315T\003f\321h\264\215\242f|?\336u\315\374B\004[\234Nl\016"
+	.ascii	"\366\237\t\2053O@\2017\361\277\237\321,\rm"
+	.string	"\243(\026\347ZA\264\207\036g\276 \003o\"\3673\312\3049|!\016\321\330\246\376\2608\276\227\375;3&\306\311\361\270\373\207\365\307\361\354PVC\227\362\342\006\034x\340\001\333\253\377\nbd\244=\3279X\357\035T\350zG\315\256\346\377\321i`\257\241\206J\024;1\210T\262\203\035\n\250g\345Cv\247\337\033\233\030\230\277\354B_\336\026=\356=\266\rM\f\f\217;oub\307}\247\346e\325q\007\361wf\270\317xk\275\3221J^-:\3562L\367\353\376\340\311W\205)\006F\206\231\351>\r\227\260\215N|\215\3247\210\3571\367\263\305|\300\215\204C\020\301\233(\002\333k\377\005`\304\214I\253&\23723\207\376G\346\376\351t\232\205\037\007\346\2373\016\240s\tAg\022|\3167l\234G\300q\266a\343\274\264A+\273gt[s\222\317\331\205\317\031\311\347|\004t6\3729\267"
+	.string	":\027\001\235Y"
+	.string	"\235\211\202\316+\202\316CAg\025@g!\033\347 \240s\n\2403\020\320\371\007\350\354\023tF\001t>\361s6\001t.\001t\356\001:\363"
+	.string	"\235w\200\316$\200\316:@\347\0217\316\"\202\316!n\234s\202\3168A\347\233\240\263\215\215s\215\215s\320\306\031\370s\376\3258\373\202\001\375\304c\342tz\272\362\376\374\221\277\312\322Si\253\274\231\213\325\236\271B|\351\333J#MYQbLZ\371\364"
+	.ascii	"\341O\274\252\356\301k\211\342\217\355\nY\023\355\225\217\342"
+	.ascii	"\n\177\374c\017\245m2\2266\213ga{5\361\rD\t\345D\211\357\255"
+	.ascii	"-%\336\315\354\364\234C\023=\255[\317\367\323\316\214sh\227\305"
+	.ascii	"\233\222JJ\370\360\225hb\037\366\345\221h\035$C\276=<?\354\265"
+	.ascii	"\207\026\216\311/i\341\336\353\277Z.]Z8\270+<\017d\264k\263C"
+	.ascii	"N\303\224\360 I\353J3\302\225\226\3031mg\347\267\206$\275V+\307"
+	.ascii	"f\t\371 `\342>\353\261Z\271\266J\312\001\361\375h\347||\217v"
+	.ascii	"\356\251\276\252}\216i\347\346\312v\036\310\030\265\373\221\006"
+	.ascii	"IB\357k\220z\036K\236\370Qj\354^=\324\357P\333\351jv\351\220"
+	.ascii	"\370as\267z\254\277\260\215\346p\251\375K\203k\257\215\246q\275"
+	.ascii	"\266\214\332\232i\243l\033e{Ej\226B\342\201\214e\304\354\244"
+	.ascii	"M\264F\374\221\355\326\202X\253\213\256\231\201\256us\201\211"
+	.ascii	":E\340\315\261\215a\023\363t(\335lr`\330B\350|o=\340\3752\267"
+	.ascii	"v\255\324\233\250\323\314\371\243\373\350\021\fx3\275\213\323"
+	.ascii	"\025\366\017I\316\305\035\262Yom\255\336\214\344\331\035\267"
+	.ascii	"S\337\342\n\213\302\274\257S\fv\341Z\334a[%\325\300z\315\302"
+	.ascii	"\002\320L_s\243r\270\324\274\331P\270\336wG\363\034\323\323\334"
+	.ascii	"\250\337\373\356h\";\232\003\341>A\271QQhf<\334\032\274\211#"
+	.ascii	"\036\310(\227\346\005\202&\fM\367\262\203gK\230R(\316\037\271"
+	.ascii	"\271\237>E\203\253:i\326\213\226r)\334\344\341\322R\3462\331"
+	.ascii	"\341\"\353\342\025\027\260\3262\346z\355p=i\257\336\356\352\232"
+	.ascii	"|\312\244\373q\275\305W\3535\352\265\265t\220\254IQz\003\326"
+	.ascii	"\"\276\277\306\236 \2702)\342\211\236iMaNB\254N\222eH\233?N\261"
+	.ascii	"9K\336\304\235\372\275\257\223\001\354L\274\007\267J\275\301"
+	.ascii	"\375\301\376`{\315\371\031\317\264\246%_8\337Q\236\017\247\246"
+	.ascii	"C\223\232?r\001N\200\033\274\257\013\001\244Nz\036C:\351\335"
+	.ascii	"K\307aA\241\2027\257\304\365j2\\I\332\346o\036(\356\312\221\270"
+	.ascii	"^\277#6\337d\214(]t\322o\360(\0047r\260\240\343\006\023kB\353"
+	.ascii	"\310\340F\016\0230X\001\205\033LL,\330\270a\033/\\Ha\351\004"
+	.ascii	"\033\"\340XRB\301\004\021r(\331`\322\241\364\"\005\247\240"
+	.string	"\302\r&\245\025RH\201I\251\206\331\324\352\3738p\324t\351l\372!\253\305\346\032\252\f\263)V\017\325\022'\007\270\370\336\"\342\342cX\202A\252=Z\252D\n5`H\017\256:\260\272'm\024\221\245\r2z$F\t\277d,\341\373I\017Q\221\335\021\275\275<\020\200$&\013\351m"
+	.string	"\036{A\324\230]\271\3018R\257\216\276{,\333\244V\007\370\370\021\025\300\350{\253\006\243w\263=3*U\367^\233\223\317 I\022\027\300\r\254\372\370\231RQ\253\330\251\246;(Q\247h\314Y\301\320r\362=)UJ\265\241\305\003\253\364x0&\225\216\345I\352\b"
+	.ascii	"\177\244\241yX\252\335\325\251%\301\212(\025}o\251\304\"\242"
+	.string	"*=-cr\206(R\344\220Nf\365)\212Vs\341A\255\274`\361KS,\232\20633P)tLs\r\241\353I\223\376H\2476uY[U\326M\003Y\030S\n\035\276\360\206g\0362X\206\345\311\005\321\3438!z\337\022G\372#\257x\025\377t-e\350W\274O\224O\343z\365\332\347\271L\272\031\346\361\206\276\327T|O\265\206/\354#\241\025<\350\252\305\362&\n}P\212\017\372F\023$\305\313P\316Iy\264Q\336\017#\263\274\252\026K,P\242\256fW\321\2163P\263\016\222\2059\245P\026@\177\243\244\313!\244%\002\364\355f\304\211~\376\277\376\254\177\276\315h9\275\260W\370<\323\230\0301?&\307\220\226\b\021\266W\237\227\241|CZ\315\320FxQ\247\320\365\206\216\031,[\204\031\036\027\025:\324\367\335\242\001}\342S\306\3413\214\264G\340\272m8k2\245P\247\027\306\215"
+	.string	"\327e\204o9!\023\274\2774\\\233\244{\206A\340`\024#\342t\353\305r\307\265KZ&\253:\344iHP\013\226\204_\032{\313\231N\247v\335\202\275\361$\274\226\033\337q=T\245\206\304\230\264\232\321\244\250<\223f\241x\346\026\331p\256\327N\230o\376\232\353\025\326&\223l\257(\276\341z\245R\236!\255\202\315\256f\212v\311\332\3706!9\370\020\205{>\020\237\326.}h\307\306\330^m|\377\320Epmd\200N|\340<\335\226\231\265T\274\211'>\202\246\250\022A-NR\250\320\214\210\210$I\222\341\242\013\020\206BIRkh\007\022\200\0235It\2221C#$2\n\222\244Ti\016`\220\346\270\331\177\326!\323{(\253\223\217\210\017I\274\215*\226L.w\216\004A\226\245\376\267"
+	.ascii	"n\312^\315\243\254\347\347\247\330\3767#\032\220\3141@\205\221"
+	.ascii	"\313\367\226\341\362iO\371x53\211\021+\324 kIG\233\310g\377 "
+	.ascii	"\324jMO\247\255M\320\2555\304S\343\220\303\305\036\237\265\331"
+	.ascii	"\312$\255+A;\335\022Z\007\007"
+	.string	"1\004Z\2003+\034\276d\222\333\264@\2744B\231\274C\331Ta\031\350%h\206\\\231\237\315p\206\366\256_\002\244K\005\270\210jt\2546y\2245\343\315\033V\232w\250F\274IP\271\332C\\BGe\235\314\260\275U\313\322\tL\177g&\237\243\201\365Cs\306\017R\325~\257\335\320! T_\244\034\027\320\\\345c\035`\300\377\307\337gti\234)\213\306oMq\232o0\024\020zW\254\024\314w\tXUg'\345\036:\035\314\376\246\2773\fO\0315\200\251\331\217o]\036\342\200\2479\235\322W\b\332W\357\025\350\023T\343\0213\004D\353\224z4\275\322\366\206B\207k\322\347\256\371\341\360\2769\331HP\2038\034\244\364\320(\003\251>\303w\226]\373R(VT}/\376\266\253'\274\210=R\244\305\212\352\006Q\221\234[\226\r\033zn\332\237\206.\026V\277\350,\020\013]$2\307"
+	.string	"\210'\020\342\322\251\033\013\212\177\3036Uo\325RI\310\314\222\007&\r\333\rO\\\320\312\334~\360a\\\305q\252k@B\246cC}'E0\333\355\323tq\225\253\003==\027\t\2033\264>0\215+\f'\250D\314\246\232\364\t\227\341\376\210!\222_\004&$\334:\375x\353\353\030[\247\3447\252\027\200\266\235\340\365F\250\223\300N\222\"\024\332X\274\013\203\243\367\325\261\207oE:H!$,\002\026\231w\013\201R\250!\007K`\230\254\324\toYh+j\243\016\312\221\213\302i\345'\253\324a\317\016\0229\312\266\314\276+\341\320\362\260w/\331<\261\252\200'\271vS\246h\200\336=\034\235\265\210&\316\243\372z\027]2r@\206^\240\3453\330\367^\343l\372\334\313`\2618\02104R\"\222E"
+	.string	"\033d\314@l\203\264Z'\252LHYp\222\351pc\227\350\354r\343\227n\337\354\246\355G\370\264wea\023\022\t\312\300\221\246\305@f(\375\300\370\227`\374\301\013\307\237T\257\217\215\257L\343%\2563&\354\304\035U\234`\333D)>t\327\333\tP\216L0H\367v\352\337\333k\3019U\214\335\241\370\355\235>8\274\321\b\337\353'\206O\265\013\276\323\260]"
+	.string	"Ck>\f{,\334\242\255\224\272W\273\263{\273\222\270\2626%\273\023\004r\360i@\002O\361\307\261\345}\256\007\004\263r\262\250\0357\340\340\273j\025\025Bo\335"
+	.string	"J\202JM\031\226]\215\026\306a\225Y\002\336\2535"
+	.string	" =\027\322\301\373\272]\347\337h\212S$\022\311\032BC\021\036\3673F&\252\013C\020o\025ye\233\263\305\322\317l\222\227\\\350[\2552\270Tir\353hu\275\233\223\030\373\302N\020\323\033\007\212c\021mK\324\343c\237\200\032U=\370\201Ly\262\027\3171U\001\225\215|]5\357\031\253\\\304\036\300_;\350\f\005\002Q\224\276\024\3570\262\212a}uf\b\030\275\\&eI\312w\"\333\326\327\275\263\267\311\365\267\345E2\376"
+	.string	"\203&n\347\260\205\030\305\324\277\001d\231\361\033N\032\360u\033p\374\257\032\003XQ\005\206\036\237y\205\0169T\233\024<\326\373\223D\261\025?xv\306a[\310%D8s\363\204\027S\332<\373\363\313\034\021\226C\236zLQ\262iDLvg!{l\356\1772\323=\025\314\022\032\347\2552A\322\300\027\031\357tnVd@\221\202\260\306k\324\016\342?\314\003\354\2666\342\324ts3\373\246\304\021\220\177v\272\023\300]\220\224\354\006O:\301\213\036\307\230\231\007\300\373\024\177'\377 gK\036/a\030+\027+,\025E\035\035\323Y\324\231H\206\312S\254?>\302b\031G\352{\247\020\024`\360\326\001\213\217\317\f+\031\232K-\330\326\205\fXCR\br\207\245Z\335\201\2673dR\036X((\262so\200$\307\334\006\033\326.C\306/\004\3558"
+	.ascii	"V\177\343\213\027Kq-\332\273j\375m\205\261Lo\202\240y_.R\351"
+	.ascii	"\277\273 8\026H\363\274\027\311J\003z\274\376\030\207\370\025"
+	.ascii	"\270nL\032:\004"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.176.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\325\t"
+	.string	"\246\322B;0\305*\035\bp\373\245pa\260\275D^\254z\227\360\366\302i\022\203\341bq\304q\227\221e\360\261\033\214x\334.z\027\013Y\244\254SU(#\240\344\333\001\264O\310&R\246\0242"
+	.string	"0"
+	.string	"."
+	.string	"\206e \007\213 \024\240z\r\330]n\363\214\366\230}@{\324\215\177\317\317?\311\031T1"
+	.string	"+\226\351\271%\354\256s\305\262\270\365\266\013l#\330\317\004\361i}:3}\213\206"
+	.string	"\305\305c*\273\025a\201\r\020S>l\1776\306\006W\016\236w\031\346\313n\306\t\312\356\032\230cy\264\355\213|\344sQSU\237\002Ae\350k\352U\261\227\334\204\344{X\242\224_\225\264\307\253\246\003\343\224\241\r\232R5\354g\253-\373\351\355\340\257\335\365\007\241N\004R\270\204H\013\240Q\307\333\374\341Lt\036\207O\347\301\303\211\032:!\356\343Ep\034\215;\b\220\307\215\272\316\3430\340>[mm\2729)\312\232\252n\032_\251\220\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.177.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375 \373\265\006"
+	.string	"r\314-2PO\323\001\244\213\313\020\341\032\205R\023\301\325@*\020\034F\251H\031K\b;\202\021\"\033\222\03440\343\226h\242?IBE\022\213\2301\322\244L)\256$\013H5T\223\003\365 \030\246\207WY\022O\212\f#\026\2547\001\241\365 n\257\033\325\201\214^\370\252z\255\373\310I(|\020W\\\371\355\217\177]\376\\\00382\031m.K\365\260\357\254nl\2475\323w\242\356d\343]\334\315\210-\233\362\240\204\330\306\330\220\017\0200\306\0040\262\025\202\250\242\225\260\354rO?\216=1\377\"W\320\242\311\246\311\236"
+	.string	"\t\273\353\3344\032\267\336v\201m\003\333\035\001\n"
+	.ascii	"`\251'\0230\2013\3348T\204\272\3175<e\304[B\220p\347L\355|\002"
+	.text
+	.section	.gnu.lto_blackboxInit.178.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\373\005e!"
+	.string	"V\367\305I\220\330Q:\206\232\002\017]\201W\026\364\n'O\340f\312\333\233\005p:mp0\024\001-{\320\362\237\251i\375[\034Ic\241]\310\200^%\321\265\311\200\255)\022\001\221\0051\231\020\0377\031\037l\317\332O6\331r'\031\262"
+	.string	"\253"
+	.string	"\261"
+	.ascii	"/^\312\305\2438\3021\313\371\222\331\005\363\371\262O\3561\217"
+	.ascii	"\271\221\351\022H&\211\252\306\356\275\271\356\361\336oljp\267"
+	.ascii	"\323V\243\231\266\254M{\374\343\326\257\213\023\241\3577R\277"
+	.ascii	"\320\306\370\252D\224\022E\226d\304\364\232\332 \354\352\314"
+	.ascii	"\273\202GU@Q\020 \221\342\016\334\314\0341\302\037e\316\034\324"
+	.ascii	"\246\243\032h\n\342\24053'\311h\307i]\301\033\325\300\275\367"
+	.ascii	"P?\320\024\034R\323\306m9t\na\320j\346\334{mB\033\357\332\200"
+	.ascii	"\230\245F\215P\250\n\340\242\004v\250\323\031\302\037\245f\316"
+	.ascii	"\275\227)Pht\006p\346\027`\346\007\314e\217S_B\264\214\253\350"
+	.ascii	"@\354\372P_P\204\312\211X\034:8\237\312\261B\210\330\331\301"
+	.ascii	"qT\305\351j\304\203GYcV<8Y\303?y\024\037\336\021\326\330\217"
+	.ascii	"\3457\271\223\037\022@@\366%\016\326\360:\313\257\372\022\035"
+	.ascii	"\037\b\233\330\321\003w\366\345\247\256\240\214\231\0311J,\210"
+	.ascii	"&\231\215?\332K\314\357d2\231\344\346\301l)\343,\345[\245|\232"
+	.ascii	"\224m\225r\315R\246Y\312f\245l-\345\262\244\\+\345n\312\264)"
+	.ascii	"\037A\002!4j<\006\223{\213\222f\227\253\234\"\204\231\317W\362"
+	.ascii	"\251\026\217b\333\221\252\005\263\021\203\226\225f\323z\300\027"
+	.ascii	"\320k\b\311\357\267\223\311rb\343\275\367\324\261\266\273\354"
+	.ascii	"\267\365\022\233]\366\213\251-\333f\237(\r\230\355\007>\206\265"
+	.ascii	"\313\016 \003hE\224\246\326K:\366\313\002\226\023\275\367\372"
+	.ascii	"h\031l\345\013\007\223\201v\257\220\004\276\227\177\321\300\007"
+	.ascii	"\362\2227p\340`_\326\346\035\255\310\244\202h\262\336{\257\331"
+	.ascii	"\335\325Z\200H\332\335-\206(M\277\354^gi\017h\"c\313\020\222"
+	.ascii	"\037M~\313\257\030\305\326-(\214D*M)'\264\030U\027ze\206\013"
+	.ascii	"R\245\335\353X\376"
+	.string	"\225c\321\351\340\301\203}\271\342\310d\354A\200D\256\356%\234\353\354\273'\354\003\201\305\256G\347\303S\242'w\002\210\307D\316\207\227\"\007\001\207w(~x9\025\273\035/w\032\203^o\363`[\022\031WP\377\030\327|*\224(\004\221\035z\006D\322{\316\262\267\306\365\207\232\316\276Q\241\323A\221*0bqx\303\324\227d\362*r\371\350\031\325\202Q4\304\246g\304\362\321\334\254g\244w\244\367\324{\262/?\334\020#\323\201\200\362\215\275b/\t=\220\177\364z\342\372\265ol\f\215\351\006/\322e\360\362\306\333\226@!\221\205\371\350\331\231\312\302\244\324T\260\266\356\231\nC\341f*\210\331\232w\324z\222\252\270Z#\017D\322\272\326\255\245\354\200\217\250q<\347\230QjDD\244 I\n\351\260\002\021\252\252m\022 \3061\217\250\232\242e\3777`\243#Jn)A\323\236&\340`\307\372"
+	.ascii	"\356\222\004\373Mx\370\260,\205\024\355\2021x\316\261;\317\022"
+	.ascii	"\3016\205\022A\306\bb\276\305L{7Sb\250-i\204\342\002\224V!\232"
+	.ascii	"\003\234z\300\230_u26P)\303A+l\276\330\030\366?\004Y\221\351"
+	.ascii	"\271O\tD\\\212\377\221L\b\237\315$\326\376\320\210\r\305E\020"
+	.ascii	"\2031R\3152\366s\2606\270\034\001\232\216*\225\246\324\3460\314"
+	.ascii	"\206\226\2251\020\033 \357adHw&\021\206\330X\225\373\316\315"
+	.ascii	"x\022\034^\020\372R\227\257\210G8eEpl\t\211\212M<\006\357\207"
+	.ascii	"\t\177\232\245\336\031C\017\252\370\314\347\301\016\375B<}N\235"
+	.ascii	"\t\343\252;'W\336\020\036\347\341\273\006\341~\013\202vtE`\223"
+	.ascii	"{\006$Z\016f-\312w\266\300\362I\263\250x\332}wvz1T\306\342\337"
+	.ascii	"\274\324"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.279.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\265\013"
+	.string	"\346\024K@ \213*\035H\304B\224\027\b\033\310\022\241\005S\270\226\022\300\230j\234N\304\231\301\311\245\340D[\245C( \2656\006\332;\303\004\0305\200\205\234m\3103\334\317}\306\t<>>\331[\312\224\0028"
+	.string	"5"
+	.string	":"
+	.string	";\302\3200\341\344\212\355\356\366\250\t.:\324\214\"_b\231t\336\3500;\257\3005\3023\301\212\335\375\352)\300+eJ<J,\273\353\007\003\267v\333\032\266/\354o\002(R\316RU\326x\270\232\2625\035a\032jZ3\235\231>D~\031\017v\007\3148,\202H\241\201\375U\310\246P\036\377\331\016\331\260\263\024,\001\213l\330\004\200\246\334`\250Q\177\222\221\\\217\240\341p\234\366\b\325b\001J5]'Yj\353\035:\f\177G\273\246>\300\201R\316\354C8\253\3433\360\007\224\357\036}\220\366x\335\370^\016\002\316TB8\214&s\331`6\217\216\013g\313x>[\205\302\334\007\207g\003\3418\317F\261\235\207\253)O.|\026HZ\202\252rG\223 \362\275b\031\364\271\273#U\225\243\252\216\264*\004\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.376.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\201\007U+"
+	.string	"\272H,\020Gp\032R:\3072Az.B\006%\350Qn4>\321\320\016\0059,\343\250\344\016\232W\325}\314\360\250\365s.`n\020\230\201*0\321\225\017E2\244\353\332\024\004\202\004\366\256\nc!|\367j\337\032!d\313$\003\352"
+	.string	"\353"
+	.string	"\355"
+	.ascii	"b8\fh\330\\\217:\347\334\227V\320S\026\332=\005z\001\365)\372"
+	.ascii	"\001\352\231\314J\314]\357R\343[\334K\216Q\251\301\274\305\036"
+	.ascii	"\367\310e\271\363\306\267\370\301\226\252\033|\2567s|\213I<\341"
+	.ascii	" \265\326u\315\221\362\231K\314>\337\323_a\346%\346\2647\227"
+	.ascii	"k\024_\346\264\003Mk\360\002\227\225\247-o\353\272\376\236\332"
+	.ascii	"#\354;\332<\357\372\276\307\333\351\324\024\265\355\273\374&"
+	.ascii	"\036\203\357\351\206\234G\257\220_ZpD\244\254\316C\323$P"
+	.string	"\260\356&\312\007\272!,\214\327\277\204\275[`D\252\352:\335\020\2254;\304#\325U\n=\334\234r\274\034\251\236\242\021\220kx\024hsE\307wlj\364\347\350\204\002\201\275\213\307a\333\177\335\004\027\332\032\021\251\252\267\200\373tC\353\272\362\231~\234}\316\314a\314l\201Y\027#bD\266\004\315\354\341\203m\263g\0242\241\r2\237mM\215\316\323\352\3649L}\242\235\231Mx\234\262<\3747$\020\270\001\361#{\233\020\"F\214P%|\214\204\201\345\272\256\032\370k.V\342\004\n\024\352\323\037\241\234\035b\017\246~\362\200&pV\243\006\375[O\263\342g\271\256Lg\216&\005\177\311SV\261\242O\\\241\262(\352\023\371\314\367\272\340\236\300\2519\331`[%[\337#\220\231rb[\204\031@\263\217O\263\317\327\334\343\361\232w\274f\035\257Y\3555\247\274ft\327l[\327|\006\350\230b"
+	.ascii	"\344\272\032\237r\253\220\024\314\311\275^\206+`X\342$\240`s"
+	.ascii	"i\324]\351\0316\203*`P\342\2447\227\306\niM\255\267um\376\236"
+	.ascii	"6\363\371^\016\246\3641|d\322\355\313\267\370_^K\034\005\346"
+	.ascii	"a\356\003B(\236U2\205$:\236\265h\035\364\266\305\266\\\3068,"
+	.ascii	"w\336\240\241\353\272\256;\253\344^\023\033Su\366`\337\271a2"
+	.ascii	"\347\311+U\355\316\026\333\362,\221s\356\214\023R\330O\336Yf"
+	.ascii	"\306\321:\222\022\230q?5\324\275R\336#G\324\247V^\330tM7Khy\221"
+	.ascii	"\364\360*I\220\341\255\205:\353\343\202\007\016\254\251\013\016"
+	.ascii	"\031\325F\007o\326\265\230\321\350\365*q\260\\\327\241\206\271"
+	.ascii	"?/\023\324\311\305R\261\324\247\252\275\22630\324\246\366cil"
+	.ascii	"\236\330\253\f\312Hjm\234S\314\376hf\244h\2417KE-\221\023m\330"
+	.ascii	"q|0\276Q\036w\263v\353:\314\300\177;\334\235r\253\334+\367\212"
+	.ascii	"\2552e\211dn\265\265\366_O\221I7\247\234\2569{\033\266\204\316"
+	.ascii	"\233\265J\313w;\236\313\344/\341\313\305\241O\344\240>\3553\224"
+	.ascii	"\216\220\\\244\\$d\343\210\350E\021\013\030D?\031F,b\374\212"
+	.ascii	"\220"
+	.string	"\222~B\n\370hF\013\244\037\215\243#\244\237\017\352CLV\330\353\003\313Tn&\335\004X\006\224\003<\003\236ay\025A2\201\030\251I\214\346\334)\347!\034\303,\221Zm>vY\347\032\177\372\254\252\225m\244\305\026\320\016pm\002\360\216\372\324\307^\t\325U\264\362\331\253[t\273F[Fd\353\320\314@8\240\236>\321g\223OO58\265\240s'[\bp\017\360y\203A\253\244\031*A\204\217J\206\275\375h\n\253j\243\272\217'\244d\2317\246\312w\353\036\227\251\203\203\2022UmL\375,\252\334R=u\213;\256\321\330|\203599\244V[\317r\033;\312\350x\247\246\324\247i\031\221\rC\033\370\245R\231\257\217\373\243O\354\331T\355\311\206lh\203L\241\231o\362\016\371\362\251\206,\200\262\250\2014\006\031BS$\"IZH\007\200\002\0212\253y\020H\210\212$Ik \356"
+	.string	"\273\274\264\020\270\3136\240\213}z\003x65`\214\321}\366\363)\247\330\236#\200\026!\315\205\006s\223'z\263\226\\\202\372\030\204\253\272-\304\304\245\341\244\003\300MU\270\245\333\013\006\206 \245]\360\251\021f\340\225\b5`\344G\316\360\002\354\026\034(<\262\243\032D\036\247\246\017\317\\|I\254\257\224\363\024Ae\023\007K\344\003\025\265\\\353\347\203R\211\224\364\367fz\334*\272Bb-\255$(\342\357 \202\262\343+w\2058\371\345-`\007PD\267\031o\324\006\276`\335]!k\245\256\214=O\313\344\345C\034\255\242\023E\310K;(\316\320d\004\215\f\215\307m\212n,u\261i\210\037\033\241.\b\177S\233\270r\02387g:\t\263v\326\226UE:\221\017\027\320\bG\266U\203#Tr\326+\001\205M1\025"
+	.ascii	"\177X\377\316\201gt\337P\002\2502\226\020\026;\003\300\336\035"
+	.ascii	"}G\350+\t\223m\314\t\"p>\356\365\332\261\245|\226]\221BF\330"
+	.ascii	"\276G\372\3653\347\305\224\322;\201S\020\240\0330\312\230\f>"
+	.ascii	"Q\006\265\240S\327\003U\037\206\\x\235^O&\260\032"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.378.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\"\001\355\f"
+	.string	"v\027VC O\225\016\240&\027\021eZ\001\013\301\006\347\0011&\036NV\231\322T\346\230<\3572\303\276 \336\3266\214\265\203\267\030\300\240x~|\201\200\f\220>`\256G\272)\203\360\263\271@b\021\331d\357\224\002<"
+	.string	"B"
+	.string	"I"
+	.string	"\333I?f\262\273\356\364#l\233l\221W\330\262,\332\"\024\325\236\022\320d\025@j\273\353\235\316\017\027?\345&\372\247\317\214\226\206K\001\337$\227\335\365D\343\246\267\215\300\266\003\373b\036\f\2648Aa\243\266[\275Si\337\377\270\314\007q\347az\007IR\352\272X\217\371\036\365%\304w\220\002,\213}+\2046\033wk\345\324\226\311\251\353\tp\247\223\017\340N]\272\314\007\\\250\330\r\334\3515`!\"^\240\344\210%\322\016#\310\257\374\330\217a\306a\2041\246\346I\316\227\347\366m'\207\275m\264\025"
+	.string	"6v3\214\304\330\0164E\210\177\334\204G\333n\2500\227\344ua$Q\333\t\265R\362hZP\241\002\356\210\300\257A(d\260\001)X\260\341\200\230NH\261\306\"\341\313x4\030\b\031\017\364"
+	.string	"\363\3614`\350Y\n\370\013q@O\364}\240\327\331\226\237\034\276\240fj\316\327=\234?;\n\217\017\302\237O~u\352\177\001\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\366g\002\004D\3010W\270.+\004\004A\211\0214\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.379.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\034\007\275!"
+	.string	"\026y\307H\220XN:\301k\206\177F790\337G\367\265\261\016[\344h\351\302\216r\005=\353\341M\024M\333B\261\316\234\0137\234\367\302\224\310"
+	.string	"\022\223\210\t\2273]@Q\213\244\214\246\360*\237\301\251\253\255\031\261D\332\226)\005\256"
+	.string	"\234"
+	.string	"\273"
+	.string	"\246\373\257$b\235A\225\334\353\374\022\02786\225\311+F\003\363\244\211\346\356\211I\357B\272\021+\324\223w\355'9\327\371.$\347j\255\n\213R+\221\301I\363\230's>\240<y{\200\362\244\375#\266\223\236|\332k'^U\0346\030\302/2\265V\340I\352\343\347w\272\234\211+\311\033]\336\351\353\240\224\276\273q\035\224\334\215\255\211\226y"
+	.ascii	"W\366\240\204\267\234Z\353\016\252i\311\025@\264n\007\273\211"
+	.string	"\306v\025\246j\206\324i\024\223\215\027:\250`\251+f\025_\365$U.\200\363p\021j\255\376\022\216\273\346\266\311lS\260K\266>R)\245\236\252\262M\r\251\265\376\304\374)\373a&\261\376N\236\3368<\023n\233}Ki\316RJ\017\366\035\2541a\333\322\036\375\343\221\312\323\245^\241\215\340\036\355[\177\335\305\322\016\0222\0229c\242J\346\255]bh\357\344\203\375XF\255\263 UZje\312\373\255\322\036v\271\276)\3276\344\332G\256{\346\272&\267\346\221\353\235\271\326\231\353\034nm\226k\\\271.\3135\371\257\377F\256\351m\275'\376G\260\303\007Hj\225qDS\251\310)Bl\337>X\222\275\333\005tG\017F\330V/\241\314Q\035\305I\3234\025\334c\327\307Hp\300\366c G_eHV\206^A1\213JI\255\234\2424\251\221\227\221i\315\330\236p1)t*<\314\217"
+	.ascii	"\223^jHV\374\317x\205\304Y\370\032\030\034\365)\226\021\330\362"
+	.ascii	"\302\215\030\376%CI{\206\305-\263\377\214c7\002KR[\303\006\233"
+	.ascii	"\303\275t\340\331\036\336\345\203NZ\255\365\001\032\013\020>"
+	.ascii	"\220\223\276\213\362$I{\206be\270\244\374F$gJ\233\306\364.f\025"
+	.ascii	"\257(\265\262\271\370O\2668\311\342k)`\206e\305\277\322+\343"
+	.ascii	"\252\342\223\325\024\251\202\f\251T\3657\305\037\363\232Y\253"
+	.ascii	"\322\247\002&Qd\"gDQ\216\b\242\n;\240# \021\267#\"!\026B\244"
+	.ascii	"\203xZ\024\205\030\n\0022\021\002HT\002\350\0040\310H\005\220"
+	.ascii	"\307\200\213P\b\031\001\217\212\212\214\200;\333{\332\303\021"
+	.ascii	"\226hpwF\r\375\324\264\316\202a?=\036\217at\276]\360\250\236"
+	.ascii	"=\223\225q\346(\220Vk\323\235N\035f\023\204\235s\307\311\243"
+	.ascii	"\211Z\215\263o\371O\215F\356\306jc8\235?n\250\017Z\224\215\217"
+	.ascii	"\025\236X\333t\376\320I\263\241"
+	.string	"=C-e\377\031\323\230\277\365\t9\265\212l\3604\262K?;i>\352cV\326\253\241\275c[\215\331\026.\301\362\250}n\235G\316$?c\261\236\231\037\235+\036\365\301\022\305\265\264\243\272\200\216\250aH\002\035D#\"\201\210$IA\322\001\340\002\021\032Z7\021\320D\306\234\232))L\332\357\244N\204\252\317\306\312\316\3437\276\2224SJ\313:\244\306v\375\270\267\315]\347}]\22465r\227\220\231\207R8{\377\217\r/-\243\037\227X\332\002~\027\307\232\246G\004\305\020w\205\374\t\2108\316\274\004\017\306\020\207Pd:\207\036Y\253\260L\273\223\266\023\213\353C\205\177M\362\224\234\215\356,&'\005\207\230\223~5Aci\252\315\t\263\003\337\363(\355\346?\b\210\220\003\275\233\345\205\242\225\223\\\302\261\350\026`\361\321X=\020\301y\025\020\301y\025\020\301\217$\004%a\332s\257\257."
+	.string	"\274\2359kd\2629\252\265|GO9x%\215\\\322\312\235\237\312\024\360\266L\227rT*\304\n71c\035\020\334\330\022\026\n\230g\237\005\327\216.\f"
+	.ascii	"\3633\225M\352{V4\350\r\004>Rs.\274\332\004\003D\375Aa\240\346"
+	.ascii	"p6\203P>Y!\322"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.381.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"-\t"
+	.string	"\242\01667Po\322\001 Zn\205"
+	.string	"\353\264\026\300l\344W\233\365\230\321~\355\261\367S\034!\202Z;\020\002\b\307\232\005\37533\261[Wd\301/\255\027DD\230\265{\313\235R\276>\025\230\210\341\n5\210\346\303B\310a^Y\304\374\024\030\203P\310\246\004\206e\323\262\r\357\375\033\035\314w\241\030*\2203H\365d{\003\255Oll\n\013x\316_\351^\276\f\335P:\246\365\\z:\227o\2034PO\326\370\270*bk\\\245\004Bv9jf\326$YR\376\311U\243\233\370"
+	.ascii	"\325B\262\273\243\373\036\311\266\254\313\227\330&uX\263c\256"
+	.ascii	"B-\301\nD#Efw\347\245\216\\\273\302\250\371\367\016\300\225\266"
+	.ascii	"k@\311\343p\340\221\003\332]w>ny\333\t\266\r\354#\004! p\202"
+	.ascii	"\241Du\244\3457\227\"\002Q\201\210\243\210\250\017n\001J\031"
+	.ascii	"\221\005*\026c\311\274\270\214!\212\0064\354E\310&\210z\230\021"
+	.ascii	"\316*qo\305\023\307\\O\214\032/\310PB\031y\233\026\200\355\305"
+	.ascii	"\344\024O\277\326\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`t\033\225P"
+	.ascii	"j\177\020\033G\200XN:7\233J\335 \240:u\206\352(\212#\006\203"
+	.ascii	"\007\240t(\245\364\307\354\241\262a\214e\256\330\377\027[\rF"
+	.ascii	"\377\226\347#\224\200R\375'\241T\377\021\3747\345\376\253\354"
+	.ascii	"\\\004va~\004}k\206\033\224;\311\230\001\234\001\252\001\337"
+	.ascii	"\312a?\004\207\275\220*\304eR0\031\027\f\307\263<\346\006\207"
+	.ascii	"\341\245U\033\366ZN\366Uhj\223\275\016&{\034K\366H\025h~)\331"
+	.ascii	"\037%\331\232\246\326\032\366Y4\354\201\324\031\366V\365\312"
+	.ascii	"\260\265"
+	.string	"\256\"\331\363\210\361\035\n\216lU\242E!\301\252F\366O\325\004\233)b9\242\033\361\352e0\n\232\212*\f[\223\025\310h\206\354\203T\323V\034\313\312t\367\260\345\323\330CUv\343z\242r;\373\246Z\307v\016\316\230\314\\i?U\321T\031\311\032\203\256\032\315\325\2423\025\206\231\n\344\311\325\2418{\251Z\306\376F\210_8{\247J\346v\274\022\2372\306\336\206\230\023\205\341\344\311\222>\212\016\306~\251~\271\031/?\203|\231\267\303\271\235L\227\217I/\206\313\335\216\017c\374\\\333S\266\203)\036\270\366/[\316E\313\343\324\370\356\303\275\244\335\230\345mhg\303\362\"\361rW\276\345\354jV\354\251\252<\215\n\213\341\001\031\r\227>\305\376\254:SU\254>\264\247!\345Wx<\364(\334\005\312\261<y\025\236\223\023yM\354g09\335\022\236\343)\261\217\252\250\275\217jv$ev"
+	.string	"\331\213$X)\341>f\317T\3058.\354f\022^\"\3413`\347\372\372\320\021{\245j\204\353\2748\r\257\213\225<\021\207\241\340E\252\022"
+	.string	"\3234\315\023\261\307\252\315\374k\236\213\351x\314\\c\002\201\346\021f\313<Tz/\227K\343\267\354\223*3\037(\021o'\250\267\337\237\233?\375\323B\214\237>\001\374\341\332\214r~=\"=/M\311\335\207\364\207Qd\256)\355\020<\233\245\201\361\342_g8\017!\t\025t\036\370\353\004\300\3631\006\026\251\234_\373\234\257_ba`\006\356\337\303\007[\217\233\373\232$9n|\350\327=\363'"
+	.ascii	"\211\265u\030\277\256\360\026\263%+\255\007Ag\370\241w=\255\223"
+	.ascii	"\342\3344=\375\363\002\2226\260\360\262\247qP%O\343\2347h\352"
+	.ascii	"\353]\236\266\271v<v<<\315\240\216\247\237*w\372\350or\247+\344"
+	.ascii	"\3544\203\0030\353v\272\346\374\255\224pT\030MN3A#Z\342$N\373"
+	.ascii	"P\337\235\013\320=\364\351y\214.@_\261\027;\263\037\263bOV\305"
+	.ascii	"^\t\025\373%S\354\231\f\355Q)\366M\242\330;\201bo\366\304>\351"
+	.ascii	"\304\336H\023[\233\230\330?Yb?Tb/\005\265\207bf\353R\231\255"
+	.ascii	"4\310l\255"
+	.string	"1fk\222\230\2553\302l\275Il%Bb\037\005\314\326\243/[\221\216\330\327\031\261\325\364\262O\323e\177W\304~I\304\036\r\227\275r\313^\313\020\3737!\366H-\373c\226}\227 \366kX\366hW\366_B\373,@\354\313\254\354\251T\331\237Q\331[\371a\357u\332wM\331\203\005\355\223H\331\037\211\262'r\3234\231\023\370\260/r\250\256=\330\215\307\274\342\004\n!\017\035x0\222\307\214\001\005\006\r(6\bm8q\241C\211\007\374KTw\360\227\252\243:\361\236l|\326JaROL\206\254\350\306t<\245V9c\214\272\016\236\322\027*\205h\222*\370\251\224\227A\373\342\210\303\303n\221\342\340ag\b\2729x\330=\267@\272s\376\347+\351\214\223h\022\017\373\346|Be\360\360\247\213\220\245?\361\260m\322$\017\373\300\034\036\266\006\256\343a\377|n\0014\275\271\276\263\207\376"
+	.ascii	"\024\036\313\337\340(\035\264\20421\332\t\336\304h\373\360\222"
+	.ascii	"\321\356\271\005P'F{G'\265\301h\373z\3671\030m\233\262W\262\364"
+	.ascii	"Je\017\276\232\24694\201\315\272\307d\335;\237\224\3762\031\223"
+	.ascii	"1Y\327\2403&t\315\2451\001\200YcB\267@\225@\335\"E\372\0363\315"
+	.ascii	"!!^\002\365\211\021(\210\363\303\345\220f8\203\356/\365A{\n\\"
+	.ascii	"\235\023\t\250q.\205,$(N\002\265\r\312c2\200\372\351O;\240\016"
+	.ascii	"\312\001j\013\\\007\324\003\256\256\260\212jj@py\323\273\363"
+	.ascii	"\356\246D?\335u']:'\027w\222\031\003\346\313\233\033\227\243"
+	.ascii	"X\030\330\227W\027\272\225j\235W\302*\252\251\016.\357\322:T"
+	.ascii	"y\322]\2714\016%s\202\271o\251\033\312\345<\336\260\024\f\375"
+	.ascii	":\275.W\272\205j\235YW\230V\241T"
+	.string	"g\235\272\313\364\016\255;\225w.\225C\343\3161\367\355\344r\303\322\257\256\255,\364\352\024^\252t*x\332\027-X\\\0257\305\025:Ab\304y\256\202d\373\320!(\375\211\270\224\022\334\337\365\271\006\322\242\2376\320S`G\347\3049o\322\233\323\350\247o\356\321O\373z6h\214\203\3161\\\177+\370\036&\256/^\323\002~\300\021\271+v\273:\336\347\344i\215\327\204\307s\034\226V\027\236\302\310!\317Q\335O\235<7u\337c\202F\3643\210\336\206()\353?P:F\266\275T\214\354\027\300\026\3077\020\022\205,\316\023\020\022\205*\202wp\306\310Nq|\317\310\310\026:\036\200\024\221\024\027\031\331$\316*F\366\210\373w\r\021\273\025#\033\304\375Q\366\303\310\376pr\340\020\024\364;\376\320\236`\360\307\310\356\271\276\343\271x\243--\207\221\3353S\246\003\302\310\266\t\200\022/dd\327"
+	.string	"Y\215\2217HP[~\305\310(C\354\254\270\310oD!\021\213\217\354v!Q\210\205\213\354\026\200\217\275\203J\261\261w\202\217\0205F\354\310\303F\0378/\265\0356\366\r\360|%\211\021\253\212\006\203C6\266/\n\033\273\007\2649\336\001\324\026'6+k\0132\333\021\210\215hDIC\030e#\227\3211\304\203\315\330\3305\307\263[\216;'.r\233\022\267uM\331\231\213\234\035\026\027\231\355J\251e\223\367`\266bWx\260\346\2746\250/\350K\037\305\305\276)\313\341\"Qx\205\223\\l\234\364d;.\266Nz \360L\024\022\255r\270\330;h\031Vr\261\177\374\251\204\035\r\261\026^c4\242$!\367\301k\275\340"
+	.string	"\324XK\327"
+	.string	"\231\310j\375{(Vk\006;\230\330?\213\336\204\200\211\355\343\301\304\306\271G\357\301\304\356\035_M+\001\202\016\250\202\270h\222\265\f\315\314h\n\2224\007B\f\020\232\245\022\026\325\001\022\200\302P\312alL\002\221@D\"\221y\223\272\303#$F\301K\354vD\023$\016\353\214W+\352\315"
+	.ascii	"\031\315\314\237`5\345\370\372u\215\347\374\023\351\216\252X"
+	.ascii	";\303\302\324\254\263\206\025\224Z\r\2706\302\233\026J\343~\215"
+	.ascii	"\267\275\351\016%{\215K\003\323U\317\260\355\022zD\320\306Z\355"
+	.ascii	"/\2658\242JE?&\t\276\030\0173MR}\223\227-\260\335h\343\377\332"
+	.ascii	"?~\202]\030\324\262\307\275\313\002|\317\352\263\250\317\374"
+	.ascii	"9H\0076\310\263\027 \265p\353\\\273J\365n\252<\340\004K>%\272"
+	.ascii	"\331N\306r(O*LC\201=^\001\032\300(B\300\215F/|\214\\\272\321"
+	.ascii	"\312Uo\231I\352p{A\tp\332\t\f\335\346tM\330\022\310\321\361\250"
+	.ascii	"\205\214\242\237_l\275\366\035\037\006\316UG\352\177\037"
+	.string	"\343\035o\364\337\242\347\217\324\243"
+	.string	"N\311c??\230\373-\215\366\007\347\342\307e\220\252dG7L\037\367\357\022\341g\265,m\2509\3116l\235U\342\024\274\260\224\251\003y\337\210\272\215k\206\235/};\250\247\353\364\004\210\375\207\302\343\017\311\353\037Xc\316\013W\337\251\363\344S\320\263(7\327\231\253\251,'\357)%e\345\313\323\372"
+	.string	"\"\365\312\313HA\n\177E\364\243pr\013q\275htIX\370cl8\3754\312\265\326\224\266e\212n\253/\277\233K]j\277\320.t\353]\246\367\365\357j-df\365u\315\221V^\311\270\305Y"
+	.string	"\343\204'%\2163\342Z\336\270\007Q\312\323\321\327\242.\337z\362:\315\365\360i.'\r\313\025\215\233\375d\023\355 J\341\222\201\002\257P\374\361\032\311\3002/:\370\023l\325\351\355\255;x\252\336\215\246\216S\375\006\230X\273\306\366\304Q@*\002\326x\374K\033b"
+	.string	"+{\270\035\022}\312\007\314q\211\270k;\307\347\246\3505\356\020\216\365\323W\261\005\261\357(+\356\213y\020\274\334\243\026\\.\276\342\372[\235_;\313o?|\324F\217f}l\257\257\365\344\247\335\376\212\303{y\370\264\303\357v\372\256l\276\335\035\217"
+	.string	"\364pI2\252\222E\036*\234\365\225d\026Vy\371\224\373\177x\315\347c5CA\205\032"
+	.string	"\323\037\270\236R\325B\343\352\302!\017\303;\035\022\275vHM\303\210\r\021I\3349\031\274\003\341\336\b\345\241\325tE\b\317\244\201c\374\243g\323E\351\223\320@\206\366#l\352\226n\255\273D( \016/\246\031\241\224\377\355#\203\330J8\322_.1\003\261\320K\275\277\355\353\223\321U\273\243\213\"\245X\264\321\214\nc\253$\024\263\311\007\315Y\240\364\352\350\254j\350y\262\341\331\313\t\027]\304O<\343\230\330\330\342\303\343\360\210\246\260\244\262\004\253\3441\022\227\2250M\341i\030:o\337\253M~\220\275#\020dK\220\310\270\036\3264\361X\277#@\266\344_\217"
+	.ascii	"\226\325\036\022\\\032\t91\251\016\ro\234\252\255&&\342u\253"
+	.ascii	"{LNh\322\255yJel\005"
+	.text
+	.section	.gnu.lto_.refs.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`\330\007\265'"
+	.string	"\212Z\270\017C\200\252I\032\003\263\327\243\335\377\217\364\302Y\267f\244\211\272!\206\\1\377\253\376\337_\365\237\204sUA\252\246\215;\034\323B\022%\262\366\321/\340$\031\021\323#[\202\"\020D\373\273\265\326\b!{\313\024\313"
+	.string	"\013\001\346"
+	.ascii	"MN{\200\272\003\250_\342\366%\334\353\232\376\250~m\372[\375"
+	.ascii	"Z=@\271\215\334C\362\227\\&\372g\316\310\210\031\003\360w\331"
+	.ascii	"?\254\374\277\366\271\312w\260\177\305{\253\375\036\357\t\354"
+	.ascii	"?\355\363\366uKo\244\224\204\264\324\267G\355\036\352\333\237"
+	.ascii	"v\357\364\355M\273/w\257\264{r\367G\337\033\355^\374>\267{\334"
+	.ascii	"\356Cr\244\361\372\3558\372\267o\267\321\007\351S\272.\274v\264"
+	.ascii	"\203G\373<\372=\332\350\373\033\237\216\277\343Et%q\327\325}"
+	.ascii	"\314\355ED\237\253{\255;\256\356\266\272\207u\007q;\275\255\255"
+	.ascii	"\236\253\375-\374\032\370\340\367\037\375\371\375\322g\355\244"
+	.ascii	"}r_\267o\264_\264\237\333\277\355\327\366\301}\272_\337V\026"
+	.ascii	"\344"
+	.string	"\027 _\212\352\231\310\327\221o#\377\313\212\300\373\373Q\367\257\253\376\307\243\374/\207\200\377pL\375G#\306\325\177-\f\365\331\203\307\216\0347k <M\223zzV\026\306\013\325S-Y\274\252<xJ\305\301\323)XO\2434x\372d\t\203\247I\216\f\t\322\265\343\306\f\030WOY\024Z\3603P\237<t\336\2501#\363\"\366e\205\212\024(N\224\034\021\322\245\243F\214\245\237,\b\001\342\203g\216\0333`\302\254L\211\002\345I\023&J\220\030!\242\340\367\007\217\0332\226~]\030Z\372\007\375\341\223\247N\034\005\177\233\004\177\232\253\377\f\002+\253\177\f\230\252-<\336\017v\345\300o\221\017\301\300[Q=\025\325\017(?\252\367M\3413\025\230\223\004\036i\300\033\t\370q\352k\375\233\324\177Q\277P?]\350\341\274q\303F\rn\037\r\356/cVV\177\261\372[\365\265\234v\bN\377"
+	.ascii	"\267c\341\376@\375\036\371\001?\211\273\323mo\032m\017\300u\266"
+	.ascii	"\227\271\235\367\330\276\004\356J\265=i\227\265\223\227\331\213"
+	.ascii	"v\317\225fo+?\254\332?\255\3717\356TkN\307}j\315\34775(}\004"
+	.ascii	"\356F\265\275\250\366b\r\313\312>\314Z\232\333\fu\033\270\203"
+	.ascii	"\275\247\340\276\340\030\276q\223\221\355{\230/\320\027\311\021"
+	.ascii	"#@\264\346\373\303GW\017\032/V\020\n\004\246E\376H~\035\2776"
+	.ascii	">8ZH:|\354\277\3759V\370>\313]~\257\271|\203\267\274\325Z\236"
+	.ascii	"i\261O:\354u\006\276\b\301\023\335\302\301\300(\344\306\375\265"
+	.ascii	"\327\376\232\363I\364\233{\002\270.\267\213\325\006\376\365\364"
+	.ascii	"\257%\204\323\275~\271\336\232o\213\333\276,\306}W\f\322\232"
+	.ascii	"/(\320\270\017h\374\365\254\201\372\317\230\221y!\311\377\n\371"
+	.ascii	"Y\344c\221\177U\365U\001\317g\356g\226S\005}\212h\207\no\022"
+	.ascii	"\367\262|^oO\352\355\272\360\215z{Q\371b\270\337\302=\037\346"
+	.ascii	"v\360\003wZ\333\347fm\n\244\2677\212}\303O\024\021\002D\024\177"
+	.ascii	"u\3448m\337\033kC\3347\306\241z\373\377\3649\3552\177\035:s\210"
+	.ascii	"\304\237M\326efr\373hD\345\227\272]\3063_\213\270/\026V\027\313"
+	.ascii	"w\346{\211;W\335\267\352F\330\316\334\201\270c\325\275A\335\027"
+	.ascii	"\210\273"
+	.string	"\202\272'\250{\340:\363\236\270\027\250;\201\272OI\325\207\232\316?\325y\270]\t\367c\375\3570\233\370J\211%1b\036\226f\213\240\257x\210=\352{\250\231\276\007\260{\235\321cWp\254l\020\271m\342\207 \027\032\332|\271\346\207\360\232\370\340\374l\017tZ\376\236v\207\371<m9\3545q\247\345\276\345\033h\200\274\2501xe\310\030\021\021\221@d\244 I:\360\242\242\331\266\001\021\220S![sB\021\277\324\336\246\326AQC\016\256\235\320\370q\266\273D\334\355G\314K]\275e\233C\310\302\"\364tL\371c\332\272\262\036_+Y\330\002\322\n\223lR\313\027fu\262\324\207\367\024\270Q\\\036=\"\211\321\302\307\366\033\013\344\037\320\005a\312r\277\320\023\242C\004\200\035\250`\333?1\221\001\370'\"\024B\036*\224:\261y\276-\004-\030\225\204\004\320\2047\b\305\026\024V\276\255\020"
+	.string	"\3170d)B\237\344\345\223\214\177\304\002g\234?Z\371\231YL\362\344G\334\316(\330\036\272@9|\034\201\031\373\311"
+	.ascii	"\243\236\033(\306\265p8\302\213\301w\331]\266\0078\363\276\361"
+	.ascii	"J\250\370>h#\223\241!#\346\374\227\246\352\3776\253\340\305\244"
+	.ascii	"\nB\370\\\264\360\236\360y\202\307i\254\334\266\0358\377~P\326"
+	.ascii	"\212{\330\024"
+	.text
+	.section	.gnu.lto_.decls.1c3cb0b27440c682,"e",@progbits
+	.string	"(\265/\375`<\375\r\373\003\316?\206\001\026T\020(\205%5\006\304;\235\021\013\217\371q)\231\303\306\360\202H\\\334\347\264\351\304Qu\364\210\207z6\227C\337o\207\277X\002f\345"
+	.string	"\326\213\350m\267"
+	.ascii	" \260\255(\2010x\032\214B\200\345l\301\351\331\275:\302 \231"
+	.ascii	"\241\304\265f$M\356\275\222H\231\002\331\022a\026\037\027y\323"
+	.ascii	"-hS(\034rB\244\306\226\232\24401Q\201\206\315!\361\250z\242\303"
+	.ascii	"\013\n\255\003\315PWWP;\200@\275\270d\364\324\350W+\351$\r\243"
+	.ascii	"G\2467\247\217\264T/\216\246\321\213\323/z_zm\272F\257L\317\215"
+	.ascii	"\246\352\215\321K=:\332F\257N?\351\246^\233\036\236v\32284\224"
+	.ascii	"\316\321\223\353\241\351\271\365\350zu\264Q\357\256\367F\313"
+	.ascii	"\350\255\321:zb\364\r=\243\027\246\007G3\365\322\364\344h\244"
+	.ascii	"\336\034\035\325\263\353\261\351M{p=/\275\274\236\231\336\231"
+	.ascii	"\036\030=\325{\303R\035\243\327\345\275\265\036\333\016#xP\246"
+	.ascii	"\033_\323\367\215*\241A\231f8\201\036\261A\221\222\326\240;\220"
+	.ascii	"\320M\3377\272T\005\332%\235\321{\177\214g\344\005\352\344\313"
+	.ascii	"\224\217'(\252!\037\374yG\0225P(\253\256\351\017\247i\336qd\215"
+	.ascii	"\330\237\257\224\240\201\366b\374\231I\306\224\035E\346@\345"
+	.ascii	"\b\222\247\2004A{H5\224@U\375\200^-\321:s5ff\232\247\202\304"
+	.ascii	"\230\346\251\036R*\214\227\361r\236R\333t\007\330\035\f+[9\324"
+	.ascii	"\240\260\001\351\030\275'\275,\275h\232\tHm\323<\032K\240\271"
+	.ascii	"\356\307x/\256L\241\264\224t@3\323\2244\f?q:\3331di\007\021:"
+	.ascii	"\323\367\215^1\001\003\325\262\006\345re\n\305\325$O\351\030"
+	.ascii	"=.)\216\351\373F\243\344\230\364\236\376|\245c\364\232\274A\337"
+	.ascii	"7\332\241C\007\365+\216\2266\234\244w\032\366Yq\f\334\263\236"
+	.ascii	"\210\264?|\263?\214\333\037j\331\037>\331\177\017\312{Y\376|"
+	.ascii	"\325\213\366\260`_\233!k\220\262N\373\021VaBs\227\365\207J\366"
+	.ascii	"\377\236\225^\225\036\225\336\225\336\024,\355\241\365\316\316"
+	.ascii	"\242\354\200\346I\271\232b\264\036Z\257\314j*\215\253\202\366"
+	.ascii	"\320zf\035\020q#\025vc\212\004#\250?\264\332\037\336\330\037"
+	.ascii	"\332\330\037\322\330\037F\355\017\237v\217\f\350=(f\242\260\330"
+	.ascii	"\310Z\305=\353\2072v\357\225\263/\f\263/\334\262/\214"
+	.string	"\262/<\262/\344\332\267\303>\353\205:\366\205L\373\301\272\375\240\333~\260\312~\360\310~\020k?\030\265\037d\332\017\276\373\300\272}`\231}`\227}`\331>\020\311>pk\037hc\037\230\264\377s\263\377\363\262\377C\333\377A\331\377\r\331\377\345\330\377\275\330\367M\367}n\373\276\263}\037\330\276\257j\337\367b\177\257\331\337`\366\267\226\375M\266\277\203\354\357\252\375=c\237\265\333g\317\354\263k\373g\330g=+\335g\305\366Y\254}vi\337\f\366Y\277\302\331_\335\366W*\373\253\330\376\312c\177\235\2619\310\331W\311\354\020\330g\315s2\035,\375\311u\304 \315\330\221\365U0;\004/\376Y\237\207\177\326\253fwv\301\267)m\230d}L\207\r\223i\226\223\343d8X\232\355\362\233g\034\271\356\370\20368\016\303Q\275Fl.H\022\235\013\263{\337\250]v\203\315\206F\321\367\351"
+	.ascii	"\320\271\260\260\016j\227\255'a[\377`\237\365\252\325\276Zc_"
+	.ascii	"}\367\265\231\375\347\351\232!_\230\250\311\372\177\246\313h"
+	.ascii	"\262\232\234&\317ai^\223\317\320\311k2\0336\353E\241\254\231"
+	.ascii	"\226\224i\233[~Br\002\005\372\002\245\t\320\232\374\226\315\364"
+	.ascii	"\236@9 \216\311tM\366\002\345l\372\276\321\237\315\244\206-)"
+	.ascii	"\250\257\271\224\t:}\315i\223\365\365\331\376\237\345r\\\036"
+	.ascii	"\203\245\231L\016#F\f\n\247\365E&\203\301i\030\356\354=\212\362"
+	.ascii	" \311\033\307\305\356}\337\237\016\035:`*=\202\274\331\372\372"
+	.ascii	"k_\363\330\327U\373\032\307\276\266\261\257\231\366{s\366\247"
+	.ascii	"\330g}/\316~o\272\377\274\246\005K\2211\027\315\372\035\244\345"
+	.ascii	"\247\241\372\276XM0\235\037HKF\313O\030\256K\2041'\323\367\215"
+	.ascii	"f-\231J\27624\212\3463+\253\260-\231K\356\202\245YK\306\362\234"
+	.ascii	"%\253=G\3377\251\303O\366A\206\307\220\255w\260\260\317\232\223"
+	.ascii	"\210\354\367\200\354\367\266\366\237\255<_\371\263\224<E\253"
+	.ascii	"92\204)\353\\\005\350\331J0F\f\"o\262\306y\270g}\357j\357\274"
+	.ascii	"\330g\315\357\231\222\346\"re\211Y\224!\0254]^\262.\313\322L"
+	.ascii	"\026\324I|0E\311\032G\261\317\372\003\205\354\027\346\246\203"
+	.ascii	"K\326\177&\313O\300\020\201\322&\353\350\217\257\254kkF\326\357"
+	.ascii	"\311\330x0vL\335p\302x\357\025\232U\214|\305#\353\240\262\004"
+	.ascii	"E$Ke\033\303\243\2357in\0064\357 \222\253\362\213\341\321\316"
+	.ascii	"\373"
+	.string	"z\311\300h?P\027\036S\f\234\346\205\003\232\265\225\271zO\240L\370Qg\232\211\344\037R\344\344\245\036t2\221\354#s\275?\346\344\245?_a1\345!\231Iv\222\223dhV\222\233\344\257,\226\307r\221\274$#\311`\331H\016\313G\2604\023\311@\236\275r\220\314$#?\365\242i\033\006\025\252\351\373F\337\301\237\247\210d\252\254\243\027M\363\301\360j\232\276\357\213\361\236\211d!\371ix\024}\241X*A`\274\331\275o\264\303O\207\016\035zHc\360\244.\320\357\275\330\033\016\373\254\270\251\315~V\263\237\343\3663\333~F\343\372\263V^\302i9\2306\347\305T\326\317\322\035\304=k\005K\366s\221\315\001\220\375\254\265\037\315\361\254\343lHC\032\226#\353\214\003\3509\207\002\274\266\224d\335\253\332\3177\366\323r\215g\033?V\313QU\336\367\315@\2543:#\223u\246\001\364\\\003"
+	.ascii	"V\266`\311\232\305=\353s\324\306/\366Y\017\207{"
+	.string	"\326\334\224\235\260\024\203<#J\314^t\244@\311\372yi\037c\260\366\362\3620\006\3531\235}L\267?\305=\353\341\260\317zLf\377\331\350\371\305\217\353\340\274\254\204\261X)-O\262d\235\2172\022\226j\310I\307s0\235\253G\3217\332\246\013)*\353\343\267\r\202\367\305\032V\234\227\2075\254x\016\320\263Q/\215\313\2139Y\037w\331\034`\237u\305=\353\016\366Y3\356Y\361\213{\326\247a\237\365\307r\354\256\030YEe\215\355p\034M\206%\364\261]\211\335\310\372X\312\3761\034\272<\006\307\017\032un\230\260qq\222\3651Z\031L\207\341\316H\230[3}\337\367?~\203\333`)vs\035u\203\331\3404T\300L\3377\332\341\247\203p\316\313-l\325\307L\266\232o\351=\201\332f^j\246@\307t\330\fN3L\212\276Q?*t0\336\354\326\340)\226b\272\353\350\373\226i"
+	.ascii	"\276\221)\261[\365q\221\215\317`4X\312\001\317E\211>2n\252\316"
+	.ascii	"\262>\376\261\2179\254D\016\353\361\325>\256\332?&\303A(\207"
+	.ascii	"\fR\230\\\334\022.ZgY\343\270\214\305\3401\307q8\314A|\360`\022"
+	.ascii	"\216\323\357{\204\261\005C\214-P\267\b9\202\262\352\343\033\373"
+	.ascii	"\307p\032\330$X\256z\200\301`'\251Q\031{k\003&\221[K\222\365"
+	.ascii	";\340\202\261\f\223v\336$*a\320\367}\337\301\217"
+	.string	"\325~\020\037\3406\254\005\233\r\215v^\2449%\320\367\215\376\307n\330\013\376\202\245\270\rw9^\303l\327\321\343\261\037\250\ro\301XzO\240\336$([<\360\210c\226\304\356}\337\016\035~:\2544\232\220\t\2625\306\302>+\006\334\263~\002\373+\354\223\260\217\200\275\223\005\213\n1b\320e\215\261\340\264\214\365f"
+	.string	"~Mm\241\313\032S\301U\260\364[\260\225\343+\030\355\276\244\350[\366\276/\021\377\350b\364#\353\n\260\317\252q\317z\020\273\305\373\276/\376\226\225\315\313\313\313\303\337\262\202"
+	.string	":\236\242\205\207\034)\370L\230\005\310\027\232\254\177\354\344\370\354\307Q\374\004\233i\340}\223\336\367\315`BN\221\261\2541\031\206\202\245\024\340(\007\361\301{Fd\357\330\373F\211\302:bu\360\262~\207}\\v\236\254\367\203\347}L\301\212\3630\005\353\327\260\317\n\304=+n\002t\354\244g\205\242\212\276g\357\373\022\327\260%<%Y\3770\223\037/\301c\024\364\226\232\260\336\263\367\215\026\211\321)\247\255\254\037\305>\353\306=\353\277&\300\207A\017\373\0171`\235\324\020~\025\0045\303\376\340\003\341W%\370\325\037\r\277\212\200_\245@\275\340W\017\360\253\005P\023\240.@\005\025~\225\001\367\340\037\366L\037\340\373`\016\236\n\266\312Y\325P\360\373:\254C\021\260\210\237\255\341\367}\370\367\013b^"
+	.string	"V\203\317\303T\030g\343gE#\354\242\242`\203\325`}\0131\207\302\347\201\3550l\301\006\313a\b\201\377\260\004x\300\317\362\254b6\b!\376\275"
+	.string	"\237\006\377\312\2005\316\3771\353\005|\027\3702\350\340W=\330\033\266\b\277\257\303\036\341\317\306\215"
+	.ascii	"5\312\031\333\0270?\373\202\007\376\314\314Cj\0349>\003\344\366"
+	.ascii	"g\003\360\263\025\374>\016\377"
+	.string	"\331\314\255\t\370}\030\354\022\326\351>\341\337\033Hb\260\001\204\237\335\276\002P\360\337\003\3770\001\377\006\361\343\024io\343`{\360\357\024\253\033+\\\337\226\\\300w\301z\345\337*P\370\006\360\373,\370}\001\370\325\026\036\342\037\006`\235[;P\363\357\242\027`E\363?\202_\270\345_C\230\320\301\335\376s1G\n\324\001\374\254\234\n\246B\367\013j\001~v_\202\1778\201o\303\257\256\240\032@\316\016\200o\202\377qT\r\200\303\f?\313b\2402`\017\213\1776\376=\037\177O\311\337\013\362\373$\350e\375>\rl\327\317\376\370}?\277/\303\257~\340\327;~M\343\367E\240s\374\332\306\357\363\321\357\257\253~\275\345\303\360g\247?\227\375\031\311\237\303\376\274\344\317O~_\317\257\217~\375\364\373x\264\325\257\247\222\374\276\242\266\300\277N\340\333\371\265\n\377\252\301G\3745\b\377\232\3017\374\365"
+	.ascii	"~m\301\277\372\370\204\177o\311\337\003\373{\320\277\027\366"
+	.ascii	"\367~\374\275#\177O\310\337\343\361\367\242\177\357\315\337k"
+	.ascii	"\363\257=\276\340\217\327\374\030\314\237\377c9\177\356\375\030"
+	.ascii	"\315\237\203?\256\373}\300\274\177<\367g\341\237\177\177\226"
+	.ascii	"\340\307t?\016\363c\270\037O\377\374\363g\365\307n?\026\363c"
+	.ascii	"\266\037\233\371\361\333\217\277\3748.\373\374\270\016\246\362"
+	.ascii	"c)?\266\322\213\373{b\376\236\334\357\373\375\031\303\217\337"
+	.ascii	"\374y\370g\340\217\331\374\370\356\177\224\036\231\277\027\346"
+	.ascii	"\357\201\371{p\177\317\355\357\231\371\327\037\377\n\304\347"
+	.ascii	"\253\362\257E\337\376{D\037\373\367\\\364\236\177\317\351[\263"
+	.ascii	"\003\376L\302"
+	.string	"\237O\350m\340\357\r\371\324\277\307\354\251\320;\376=\013\260A~V\310\357\323\177\216\376Y\232)`c\005\301\327\363e\366\310\257\275|\370g\305~\337w\236Zg\327\371\331\255\177\323\371\325'\313\365\3579Y\306\372\215\2672\25502\310*,p\367o7\377^\363\357%\220\177U\262\340\027\002\377\314\342\337t\377V\363\253\021\370\327\016;Mn\361\357\271\237u\332hr\321\237_\370\030\226\211\215\361\3573?\233\364\263J?\373\342\337f~\366j\227YC\260\311\254\311\240:\200=\312*,p\264\275d\255\316\\?@\302\037\304S\267\334\177\264\255\345\307\037t\020\334\301\036\363o\374\3577,\302\376\362\253\276\267\177\027m\267\275\266\271\374*\004\376\255\366\347\241\3379\370\205b?\016A\335\354\031\265\367\257\004\330X\330\271\237M\363\3574\326\314\317\322\375\033Mw\321k+\027v\272\257\260o~\266\356\337V~\214"
+	.string	"\235\366\257\003\330Uz)\376u\335Tp\002\366\224\237%\373\267\224\277\327\201?\237\375\253p\237i3-\325Q\376\243\351\262_O\3715\225\177-\300\017\026\241\266p\f\374B\036\377\331\376\267-\177\354\002N\3768\305\3230r\003?\016\372\361\220Jg\233\315\025"
+	.ascii	"\213P[8\210?\270\344\277\333\257\362\330Q~\226\003O;\026\n\004"
+	.ascii	"\215\374\237c\203\366\360Q\330\021b\376\213\021JW:;\203\255\301"
+	.ascii	"\277"
+	.string	"\245\037\263\313\376u\216P\016\333\303\262\277z\204\365\375[\351\303\177H\200\225\215\212\302\026\300\277UL0\375\217\341\027\206\311\030\330\360\375\017\017\360\257\023\330\033`\345~\226\314\277\223\376\365\354W\2556\022\332>\372\217\342\212\317/\254b\257\254\037\266\nV\313\317n\371w\b\364\222)\033\004\373\003\373\005\026\213\036\273\206_H\343_K`9\240\233\350$\277\006\323G~\215\344\177\024-\246\227\350\261\213\301\027\334\202_\210\003cHa\273\370wo\253X\263k?\313\366\357\026\033\270\203\377f\341\001\026Au\200\n\374U\341\277\302\375G\341\027>\301\032\233\300s\264U\205`\325\372d\257\370Y\016\3748\004\214=\3748\304\217\023\360\343\r~\314\200\037+\340\307\352\217A\370\361\207\037\017w\321\217\201\376,\325\333e\243\374\254\331\277\237?F\300\217%\370\361\007?\273\334N\334\301\217A\374,\225\237\255\362o\016\374\370"
+	.string	"?\276"
+	.ascii	"{\300\256\370Y\026\377&b\262\236\330\016xb\022\376\325\304+\360"
+	.ascii	"\337\002W\341\337\315\377\250\016\320M6\363\337\313u\211\220"
+	.ascii	"\305:\201\237m\377\275\201\257\371O\367\337\r+\364\263\312\177"
+	.ascii	"+\377\263\371?\267\216\200\246\325\374"
+	.string	"\027\3631\030(\340?\005\177\320\305\003\036%(\201\177Mn\241\377s;\b\205\372\200\003\377`\031v\304\237/\360g\n\374\253\005\353\207\237\375\300\277U\374Y\204\177\267\177V\300\277\223\377\2727\362g_\370?\267S\374x\312\217\323~\\\346\307XV\027\212\376,\264\217?\213\301\317\206\340\337\032\370\037e\335@=Q\200?g\360g\n\216\3016\256\355\007\177\220\312\237-\260\276\331C\315\243P5\374\217\322\301\257\242\260+\360?\316\317\372\374\027\363a\006\233\002\277\n5\201_=J\340\305\037\370\324\344W\243\277:\366\253O~\225\311\257J\357\373\201L~u-\002\277\312\0015\355W\263\374\352\225_U\373U\264\335\302y~\240\221\215\342W7\260O\374*\006X\370\325\024l~u\315\257\316\375\352\364W\325\374j\233_\245\333\020\370\206\037\310\346_C\360o\023{\205\255\302Na\002\277*\201\377\300_\210\1776"
+	.ascii	"\377\361?\024\361\257o\376\325\315\377\374\013\347\376,\201?"
+	.ascii	"[\340\317\031\370\263\361\317\025\370\363\005\376\214\201?S\340"
+	.ascii	"gC\3747\373\377\373\207\317\237\245\300\317^\340g-\360\263\023"
+	.ascii	"\370\331\b\374l\005~6\003\377\332\374\331\343\277Q\370Y\022?"
+	.ascii	"\333\302\317\236\370\331\020\376\375\200\377\304\177\350"
+	.string	"\344_O\374l\363\337\016\3701\212\037\247\360\343\026~\034\201\037\017\177\025\357_#\360\357\022\377\013\360\037\305\377(\377\212\342?\361\017\376\370\367\t\377.\341\337$\376=\302\277E\3707\003\376\215\200\177\207\3707\b\377\366\340\337 \376\315\301\2775\370\267"
+	.ascii	"\376]\301\277)\370\267\206\177\017\377\035\374\267\372\357\336"
+	.ascii	"\277\361\317\326\375,\233\237\245\373\3314?{\346g\311\374,\333"
+	.ascii	"\317n\371\331\264\237\275\362\263U~\326\354g\311~V\311\317\""
+	.ascii	"\371Y!?\373\343g\271~\026\353gg\374l\214\237}\361\263!\370\331"
+	.ascii	"\017\374l\007~\226\305\317>\177\226\003?\333\374\331\241\237"
+	.ascii	"U\376l\373\263\310\237=\376\254\361gC\370Y\r~\266\303\317r\370"
+	.ascii	"Y\002\374l\005?K\301\317\356\237\345\371\331\t~V\303\317\372"
+	.ascii	"\374l\317\317\022\177V\370\263\300\237\365\375\353\234\177\315"
+	.ascii	"\373W:\377:\375W9\377\032\347_\353\376\225\315\277\252\371W4"
+	.ascii	"\377:\367\257e\376u\314\277\212\371W\270\177}\373W\267\177\365"
+	.ascii	"\362\257l\377\332\345_\271\374\353\226\177\325\362\257Y\3765"
+	.ascii	"\355_\257\374k\225\177\235\362\257R\376\225\354_\231\374\353"
+	.ascii	"\222\177\025\373\327$\377z\344_\215\374+\221\177\375\372W!\377"
+	.ascii	"\352\365\257>\376\225\353_\265\376\225\307\277^\375k\325\277"
+	.ascii	"\342\370\327\033\377j\343_i\374k\324\277>\375\253\323\277\312"
+	.ascii	"\370W\246\177\205\361\257J\377\212\364\257\357\277~\340_\237"
+	.ascii	"\377\312\201\177m\376\353\320\277\272\360\257\312\177m\377\365"
+	.ascii	"\370\257\306\177\305\300\277R\340_#\360\257(\376\325\304\277"
+	.ascii	"\252\360\257%\376\265\204\177%\361\257#\374\253\b\377\312\200"
+	.ascii	"\177U\300\277\206\370W\020\376\265\203\177\005\372W\016\376u"
+	.ascii	"\203\177\315\340W\027\360c\f\377J\200_w\371\261\004\277V\373"
+	.ascii	"\327\001\374\232\312\257\227\374\253\005\377Z\301\277\006\340"
+	.ascii	"_)\370\327\t\376U\303\277f\370W\237\177\355\371\263\357\357\241"
+	.ascii	"\371\327\342\277\022\377U\370\257\300\177\375\375\353\376{C\377"
+	.ascii	"\272\376\253\376\327\374\257\377\257\302\257\326\371\363\013"
+	.ascii	"\277J\347\307\"\374*\336\217I\370\257\346\177\233\377b~\254\177"
+	.ascii	"<\374U\036\377\321\376\247\375j\232_\205\363\253q~U\316\257\332"
+	.ascii	"\375\352\227_\005\363\253o\277\212\345\317C\277\332\345W\327"
+	.ascii	"~\325\313\257\262\375j\224_=\373U\263_=\362\253`\277J\344W\273"
+	.ascii	"~\225\353W\263~\325\352Ww\374\252\216_\305\361\2534~\025\352"
+	.ascii	"\317 \370\325\031\277\032\343W_\374j\322\257\276\277\372\201"
+	.ascii	"_u\361\253+~\365\371\253\034\370U\t\374j\363W\231\277:\364\253"
+	.ascii	"\033\370\325\240_M\361\253\307_\305\300\257V\340W'\360\253\021"
+	.ascii	"\370?\367\253-\374\352\211_]\341?\363\317\311\377Q\376\243\370"
+	.ascii	"U\024~\365\001"
+	.string	"\277z\302\257\232\360\253\"~U\204_m\300\2572\340Ww~u\370\253\301_\375\375\352\376U\366\327k\277\336\362k-\277\316\362\353*\277n\362k&\277\036\373u\220_{\375\232\353\327X\277\276\300\257O\374Z\001\277&\300\337\263\373{s\177\317\312\337#\373{\036\370{E\177\217\371\367\220\177\216\362\347\255?\323\370\237\302\237=\360\347\016\374\231\371\347\345\237\203\376\254\201?\247\360g\024\376\f\200?O\360\347\r?v\361\343\346\217E\374X\002?6\341\307%\374x\204\377v\377\353\376\277\371/\367\177\314\1770\377\337\376\177\371\217\345\377\211\377g\377\307~\334\302\377\266\377@yyyy\177\005\313\037D\222\337\313\027\253\004\270g\375\315\001:\260\tm\t\230-\340\322\2012~ \0230\206\2157\353E\326\230\n\373\254=\270g\005\"\001\035\270\344\223r\327\243\013\360\305\2010\376_\232\336\023\020\0334\300d\215\227"
+	.ascii	"\035\370\""
+	.string	"\016\255n\b\360\350@\245\037\210\004L\272\"#\243\312\032Ca\237\225\007\367\254?8\240\003\217\206Qb\322)y\007\032\375\2771\3007\212\364hL\326\270\013\373\254x\r\350\277\274:\\f\374\370\341\375W\347\377\315\371\321\021s\004\004H\326\370\f\373\254\032p\317\232\313\200\376\303\013\252I\221u\221\363\337\335\201Lb\354jd\375\263\003\372O\016\013\204\007\023\257\254'\200\363_\034\266\n\334\232\250\254\177u@\377\301\331XH\222he\235\301\315\177o.\334Qd\213+k\034\005\372\317\r\2166\036^l\376k\363\377\316\364b\274\220G'N\326Y\013\350?6o\\\246N\246r\032x\337\262+]@\246\2775\177\246\321{\223\202rW\332t\251\371\217\356k\336\327\233\246\254\177i\200\376S\003L\2521eH\326>4\377\315\275I\007\325\232\254\177g\200\376C\223\277\316\332\332\262\026\376\344\3763\363\377\310\374\312"
+	.string	"\237\200\231#\2265\206b\2375\002\334\263\376\306"
+	.ascii	"\375'G\254\032bD\225\265\017\356Y\3434@G\210\f0?0\377\211\371"
+	.ascii	"\177p\2770Z\016\016\t\0222Y\343%\354\263\026q\317\212\325\200"
+	.ascii	"\376\003\363\2732]\362\344\366\337\333\377\373\322\023kc\213"
+	.ascii	"\303\313\232\210{V\225\t\350?\267\235\227\247\366\303\313\177"
+	.ascii	"m\327r\032\270\362E\332#k|\005\350?/z\013\316S\021\266\265\340"
+	.ascii	"\223'\032`N\376[\003\321\364\303\307\257\213\226\343\262Bs\225"
+	.ascii	"\365oK\360h\352J\230\036jq\230\224\240\262\276\002"
+	.string	"\242v\226\037\226\325*\211\233U\326O@\235\r\244\023\245\262B\373]\371M!!\275Y?\001k\366\320J\030.lQ\332\210\240\375\250\374\246\200M\355\200\223\365\023\320e\377?)F\206ln(\271\235\231\371\362\270\302x\374\312\3763\373\177\322_\024-\207\235\f\t\203%k\215\206{\326\037\024\240\377\312\324\034Ly5\262\376\225\037\031\tHt\314\375\236\374\264x\204\211\233\023\365\252\361e\246\344\344\327\244\253\316\nY\326L\364\025\264\315\224L\354\327\365\023\322{\002\265\321\344\252\246?\261\237\324\317\252\367\004*\002\\W\323\257_\222\336\023(\037\r\245\256\351\373\276J~K~a\2771,\375\211\375\206\374\304~W?\037\275'P>).\253\251\206\016\230\256*\216\215\237F\242.\201Bu\225\365\023\240\265\337\001\224k\306\317\310\257\210\325\223\017\2600\260\337\021,\375\031\371\021\021\322\231\332I\255\372\t\270\261\217"
+	.ascii	"\273}\004\314\355#\340\313>\002\316\202\224\021\271\240aOY\037"
+	.ascii	"\001C\200`\351\317\353\367\303+\377\240\203\262Z\322(+Z\037\001"
+	.ascii	"5\366\021 c\367\360\031\241is\222\365CX\263\337\001\026Ns\007"
+	.ascii	"\375i\375\262p\0323(x\277"
+	.string	"\255\037\027\226\376\264~<\326*2^\312\254\372!\310\355\207 e?\004(\373!\204U\251S\350x\255\311\372!\324\330\377\1779~8~:~TX\372\333\361\233\3225\216\266\201\351}\327t\374\240n\324x\362\001f\367\333\361\243\301\364\333\361\263\201\323\330:O>\300\302zt`ld\374\364C\300\355\207\030\333\017ad?\004\327~\b\251\375\003\344\355\377\027\005\005\234\303\006\343\f\324\361\331P\211H\027\235\337\323o\006\256\202\006\006\3647\243\312\236\262\022\303\211\323\257\t\351\353N\372k\302i\275\367\016\316\214\237\214_\f\240\034#c\250\206Qn\234u\3711e\0338L\236\024\225\337\322OI\030\304-\n\346E\016\324\327\206\323\354\240?\030\277\027\277\244\037\022\226\376\224~\357\177F\277\243\035?\245\f\203\204\2225\323\237\222\352\345\313\333\200\264\364\276Q\013ps\242{\353@D\203\242q\362\323\352\032\356Y\177"
+	.ascii	"\273]"
+	.string	"GK\271\332J\312\372\007\240\333\276;_\2325j\003\322\222\316\342d\372\276\357\0165\2767W\246h\362\223\024\350\034\237\235/\216\257\316\007\307\207\347\223\343\243\203\245\276;\037\230\373\334|_\376s\347\233;\233\276Y\271*S\345\214\217\314\320\250\370\276[S\240\276;\237\031\037\231\254\r\246f\324\241\262{\337(1/H\327\030\217n\343s\303f\f\224\024N\326?\300W\0336B\263\266\034G\323\373\330\004\341\274\2303%k\337\232\036\030:=\216\350\376\373\204M\240e\270\320}\315\370\252\313\372\007\340\332?\200\325\376\001l\354\037\240i\377"
+	.ascii	"H\373 \314\331\007\301\215O\016\027a\202e#\353\203 \347\033\343"
+	.ascii	"\213\333@\262\274\274|b\356\213\3330\303kI\326\257\363\205\371"
+	.ascii	"\357\373\301\221\352\222\023\306\007\207\347\302\214\261\363"
+	.ascii	"\301\371\300\230\035\035!e}\020\332\366A\320\262\365\031\356"
+	.ascii	"Y\017B\331>\bI\366\357c\363\255m\240&\244G\215\373\326\376\234"
+	.ascii	"\345\353r\264\214%\227\243J\217\254\363}\\\262\216\025TTM\266"
+	.ascii	"h\201qU\006&k\237\226\243\345\315TG\347N-\255\311\027(U\322|"
+	.ascii	"W\2166\364\275\357Z\033\324\227\226_U\3120)\372\032a0\247\273"
+	.ascii	"\"a\276,>,X\352K\363\241\375\b\231D\255\245Y\365A \262\017B\325"
+	.ascii	"\376}V|"
+	.string	"U\250\370@\003\223\265\257\312\357\213\372\236\370\250\3447G\214\242YO\331_f\230\326\262>\bO\373\277\257\314w\346\213\3423\363I\261\324'\305GV\026\003-\312\022T\n\203\t\3323;\3320i\347\225\241\224\007\365I\361A9\232\322\023\r\330<q#\025d\263c\314[P\037\004\031\373\037\320\331=8\354\263*\300I\346\312\322\030G7\232\370\304\362\246ZN|c\321\265\270*Y/\221\212\322\262\226\365?8\263\305|Dp\232aT\364\215b\2518\201\361\026\346;\342C\342K\342S\202\245>1_\021\237\021\274\004\217\235\275`T`\274\331A\317\276\244\300x\263\363\211\371\206xM\201\361f\247\203\313WWP\377\003\265\375\201\223\375\017\276\366?\330\332\377`j\377\003\245\375\373\204\310-E\2138\351\253\nY\020/\2427L\320d\375\373\272\356\363\372}?|@\264\234\006\324\344h\002$k<\305>+"
+	.ascii	"p\317\352\363\001t\337P\314\250jH\326\024\370z\370\266\266\260"
+	.ascii	" y\313\332\267\345\313\272\233Q\006\352\343\302R\337\226OK\250"
+	.ascii	"\205\3054E\353{\260\266\357\301\331\376}<\220\332\304\301\312"
+	.ascii	"\232\314\\\232\270,0wX\r\315\233\030\2407U\306\344<\fG\245\200"
+	.ascii	"05S_\r_\225\317\3107\345\323\341\263\362\341\360%\371\260|G>"
+	.ascii	"%\037\224o\207\217\206\357\312\367\302w\303\007\303g\303\027"
+	.ascii	"\303\027\345\233\341\313\341\223\341c\362-\371\236|R\276&\037"
+	.ascii	"\222\317\tK}T\273\316w\236\357}\036\243\313\nc\2076]\233f\275"
+	.ascii	"\341\315}\271\223\203\315\234|\320\006\253\235\001\363\304\356"
+	.ascii	"\314\215\217j\317\331t\206\275\367\335\032\203\3365i\253\303"
+	.ascii	"fT\246l\320\246p\246@\343\250`R\246k\330\324`53g\344\360\230"
+	.ascii	"\344,\037\325.\343\243\332pmf\304\255\205\275o\024\223\221\363"
+	.ascii	"\342\206\b:\303a\237U\003\334\263\336\203\037{\323\301f\254"
+	.string	"\221\274\031m\262\276\007Z\373\036D\355w\220\267\337\301\233\375\016\324\366;P\262\337A\327~\007M\373 \362\366A\274\331\007af\037\204\230}\020l\373 \322\366AD\367At\355\203\200\332\007\242\263\0174\335\007\352\262\017De\037\310\311>\320\327>\020\216} \247}\016\360\3669\b\263\317\001\331>\007@\3669\220\332\377P\267\377\375e\263\035YC3\312\372\035t\371\200\313\357\316i\210\027\273\315\266\267\314q\032\342\305n{\331m\333\rK7\333^\023\232\311\"\006\266\365?\220\331\377\220\266\377\241\311\376\007\037\373\337Zv\026,O=\340d\235e\233\211\240\344\f\226=e\247\355+\233\312\266\262\253l\264-e\253a\351\316\262\317\262\354&\032\016\3364FT\005\2233&}b\007\205B\007-S\003%\313\262\235\250`w\323\235eGQ\261H\001qq\272+\"\304!V5&\002}\017r\366=\234\331\367"
+	.string	"f\337C\226}\017Q\366=$\331\367\340c\337\003\325\276\207\246\375\r\362\3667\210\263\377\315d\207\255\3611\306*\353\343\273.0S!A\332\246>\314L\305\366\3306\262\301v\222\255d/\331Hv\221}\004Kw\330&\202\3445D\005\353"
+	.ascii	"\212\006\004h\207\355\037o\323\260\375\365\001\324\211\356\315"
+	.ascii	"N\356\314\\S\004\372\033H\3677\b\333\337\240k\177\003\035\373"
+	.ascii	"\033\310\330\327\340n_\2034\373\032x\331\327\200\312\276\006"
+	.ascii	"N\36650\262\377\335c_a\361\242\023\303\336m\0314.8\202\204\367"
+	.ascii	"\306n\353\300f\036\030Q\303{cw\265\233v\016\f\327\365\276440"
+	.ascii	"\342\006\357\215\335\276\332U:\246W{\207\212\005\303\235\275"
+	.ascii	"GR\034\030\201\202\367\006h_\031\211\303{c\267\271\266\326\306"
+	.ascii	"\332[\233\307\316\302\322}\265\255V4sm\256\206\372\032T\355k"
+	.ascii	" \265\257\301\322~\006x\033\307:D\356nK\326\317@n\327\33160\\"
+	.ascii	"\227\256\3236\245\332SX\272ol\247}\203\305\313"
+	.string	"/\206\352\373\036y\201\002\257\266\242\230V]\243g\307\226\001\225}L\307\310\nt?e\245+R\233\306\206\302\322\035\265g$E}@\345\264D\211\ng*\207\315\326\317\340\307~\006N\373\035\342\354wX\263ch\b\266\221\231\362f\375\016m{i\303\300\322\315\304\322\251\263_\364\242i\033Mk\306t3\261x\354\034-'\350\373\276\032:t\370\265\001\222c\325J>\260\216\\e\375\016P\3661\235m\304\264\223\366\021\226n\244\375n$6/+y@\004\t\357\215\335\373\276\035~:\364\344\224}\231\256\372\035\230\354w\370\261\337ak\277C\325~\007\246\315\316y\031\r\27038\262~\007\245}\003\264\331?+\207\265\223.\361\222c\343\260p\3307l\035\353\006KY;\266\315{d=$58\016\307\017\314i\210\027;:\034\320\351\323\0329*;\226\315\016\247!^\302\330)H\312\360\b\352\033\200l\337"
+	.string	"b\373\006\b\262o\200\034\373\006P\332\3470\335?\233\206\235{\271\214y\313\032\215p\354I\025\227\254\317\301m\277\003/lhs\254\034\233\206f\332\305\r\312\276\261f\3302\254\030\026\216\r\303\216a\343X2,\030\366\013{\006KY9\266\355I\313\033\024\210\225c\271\260[\206\275\367=\372\322\206\345\fT\r\f\024(\213\031\350\232\232[\032\250\034\313\206\301\234\264\336\302\3367\372c#IJ&\201>\007\254}\016M\373\034\222\3661\300\333\307`\272\217\201\231}\f\302lv\313\261\231\363\013G\224\254\217A\333>\006j\373\030P\331\307"
+	.ascii	"\312>\006`\373\030`]\231\342C\302R\202\227\365;0\343\232\233"
+	.ascii	"\302J\325L\243\244\201Ja\253\260TX+X\312Na\317\330)l\031\006"
+	.ascii	"\302\270\221R\251\350xg\374\3641\250\261\217\301\321~\001\312"
+	.ascii	"\354\027 \312~\001\262\366\317B9\373%\207\316\210G\326YJv\320"
+	.ascii	"\034c@UbP1\030t\320\027Kj\246RVM^wak\336\216'\031Qy\211)\r\022"
+	.ascii	"\225\023h\023\230\351\373F\241\246\244@\363n\234As\326\021\336"
+	.ascii	"\224\306\214\266)\353\203\355b\227\260Z\254\020\266\b\313\203"
+	.ascii	"\375"
+	.string	"\301\222\261MX',\0236\214\345b\225\260H\330,\026\312z\261GX1v\214%\302\002a\207\260`\254\0216\t\273\305>a\203\260=\330(\226\262_\254\325\331+\026\353\331\306T\223\327]\330\230\021U\223\327\235\235\016\265\247\254\244\345e\nT#+\251M\223\327]X\326Z\347iz\325\373\302f?h\223\327\335\016\254\026\003\r\216\273&\257;\273\273\367\227\243\311\353\316\216\375b\235\336\246\357\033\315Y\354\027\213\224\2376(\275/\226\025\373\246\311\353.\212\2331%\022\272\007\205}V\020\270g}\001l\354\027 \306>\001\316\354\023\200m\237"
+	.string	"f\373\004\370\332'"
+	.string	"\217}\002H\355\023\340\305\376\005p\366/\220\333\277 m\377\202$\373\027d\355_\300\264?"
+	.string	"9\373\003\230\333\037"
+	.string	"\333\376"
+	.string	"\242\354\017"
+	.string	"l\177"
+	.string	"<\366\007\300\264/\2008\373\002"
+	.string	"\263/"
+	.string	"\264}\001\214\355\013\240k_"
+	.string	"7\366\005\200\264o\001\234}\013\320\354["
+	.string	"f\337\2025:xmssD\262\306[\343\330M\337\367\235\263\336a\351\212\267\312\321+\336j\207\323\204\360\326\344ug\327[\n\003\205\310\252o\001\222}\013|\354[`\265\377\025\316\353\240/\032\\~\263\272\301\322\265nmS6\315J9\240\357\373\256u+\233\254T\244\t\bT\230\005\332\322\310Y\365+(\263_A\230\375\n\274\354\177]\263\322)\215\2651\223\265\232\250\214)<:Y\277\202'\373\037\310\r\201\222\021\002]\317\254i\3269,]\321\254e\200\320\254f\260\331\006\244\367\265\252Z\337\232\264\246\226eCxl\375\nf\354\007\240n?"
+	.string	"s\373\001\370\262\377u\314\032\346\251\214\214\261\254\217\307\3260\271J\225\202\341\3164\0229\323)*\2255\214\352\265\272\r\215\242\257\021\213\206\204\007\267\306\255b\260t\r\263~\371\372\266\202IbZ\303\250gZxo\204Y\264\330\335\330\232\215b\237\365v\270g}"
+	.string	"\300\332\2007\246Rxd\375"
+	.string	"x\261\255ZV,+\2275m\315\262\242\255j\353\332\272e\355\202\245\253\227\225\306jC\235\242RY\257h9\016L\220\356r\330]\255R\353\216\265\351\373F\275\254\\\253\225^\031\364\001ZV2\224\027\365\212\212\245W\006\335T\220\276L\263\326\2525K\213\203\230\233\273\034vU\334\334\345\260[\275\250qkT\257\f\352"
+	.string	"-\266\351\373\276\253\0275L~\201\305P\275o\224\007K\214\334\345\260\203Z\275\250V\226\304\335\345\260\363\242fQ\341zeP\337\f(n\323\367}\275\250b\362\023\026C\365\036\031\205X\242u\227\303\216h\006\306&\372\243\017"
+	.string	"\273\275V\321@\334\362q$\227\365\001`f\367X\177\364\242\320\022\220fL\317V*\253\024,]\247$\255SV k\223\020/\240V@r\232NY\315\356\266\001i\351=\342\301\001\021<7^\354t\224.\266\253\255\017"
+	.ascii	"!\3738\017\211\006\f\327%B\021*K\304\246k\223\325k=\262\001i"
+	.ascii	"\t\205\265*a\3372\364\275o\326\031T\211\222\251\030\007\fwF\""
+	.ascii	"ml\372\276\321\265\311:\366-C\302\246k\2235\211\206\365\207\327"
+	.ascii	"\2327vek\224\325\311\ne}\262\222\255\3225\212\245k\223\225\311"
+	.ascii	"\177\324(R;<\036}\n\314\354S\020f\237\002\266}\n\260\354Sp\266"
+	.ascii	"O\301\223}\n\304\366)\370\002\253b\264F\314S\326\247\300\212"
+	.ascii	"\310Z\004KW#\253\220 \353\327\226\032\350jd\205\256_<j\346\312"
+	.ascii	"P\331\365\256\314\275\221\256\372\033\276|\r\001\326aRUg\310"
+	.ascii	"*d\330\344\253i+\353o\220\356oh\262\277!\311\376\006\350\376"
+	.ascii	"\327.\255uK\225\302\324\006#\353\325\007\320\327.\245\256&\251"
+	.ascii	"\2541\300=\3537\374\330\337\260\265s\024\373\254\034p\317\212"
+	.ascii	"\265\362\270\372\211AB\007J\326\337\360\204u5,b\006\013j\365"
+	.ascii	"\365\352t\031F\f8\272\rK\253\016 N\250\326\262\376\004n\366\261"
+	.ascii	"t\315\261\342hC\347\r\215"
+	.string	"\352+\216\270\340\006\234\346\005\025W\326\257[o\374\367i-\256.a7\326\2518ZgS+\215\325\306\322{\225%\265\226\365\277\326\370}\277/qp@\263\376\004i\366'\210\333\237\300m\205\312sLnD\311\372\023\244\355\377\253\323:\003K\327'\325\314Ot}R\307\250e0\334\031\211&U\236\3243\253\f\fG\265\363&\321\311\231\342(\\\352\264Y\365\234u\311\ft\215\2612\255MX\272\312\270Z\216Ze\250hT7C\243\342\373\366\260\203\312P\337\250w\030\356\354\004$i\246\357\373v\320\320\241\003\260\211\253\312h\353\377\353\213\025\006\226\256K\253\322\372\256I\033\220\226Nx\203\266.\251t\324\274\rHK'hi\233n5 Z~\254\372\023\224\355\177M\372\212\304\204f\244L\326\353\321\317\006\025\234\226\254?A\330^\215\216g\020Qj\313\372\023|\355c\351\325\250uN\347\3456\305$\353O"
+	.string	"d\177\002\255\375\t\256\356\364\0265\016\206;#\361\206F\225\243\342a\251z\247\332i\214\246\336\251s^\346\246\303/#K\230\254\372\023\320\330:I\222\331\027\025\216Z\367\n\205tU[\300\262\376\004L\373\023(\355\377*\033\265\r\226\252n\324\251\0335\215\272f\003\322R\t+:\325\215:\007\024\342&\t\022;v+\213\023 \253\276\004^\366\257\2528\226\254\314\211\252]\250\306\b\301RU\215j&\372\376"
+	.ascii	"\321\304x\351\262\276\004j\373\022P\331\227\200l_\002\261}\t"
+	.ascii	"\204l9\225\214YV\223\260\254/\201\226\234\004:\366%\270\261/"
+	.ascii	"\001\324\276\004L\033\214&\322\2502[\312\372\032\336\354w\240"
+	.ascii	"\246r\351=\201\332"
+	.string	"S|PqS\337\260T\375\242vQ\277\250kj\033\215\013\344@\031\002f'\234b\2077\265j6\325\013Q\206\020\030^H\330\274\3665LiQ\267d))\020\r1\264h@\332\377\231\252iqp\356\230\262\376O\030\025\355gm\377\347\312\376\317\223\275\206a\237\365ep\317\252J9Z\006\303\306\312.\353\377\3700\203\322U\266$/\353\037V\200\200T\361\021U\313\324'j\024U\252\222a\251\nEu\242BQ\275\324&\275h\332\003\240P\231\252P\324.\025\212\332#\001\357\034;\275\"K\032\352\377\340\330L~\3303FvqY\377gi\037\243\t1\003U\221\250E\324#C\243\2357I\212\246n\210\034\230/\2717\025\211\032\344\214\212D\205\276GF!\332\262\344Y\331-Q\303\3241U\211*\246&\301R\025\211J\344G\273a\262\3532\324\352\0210\rl\252\244\246)\325\210\236\372\3025$\353g"
+	.string	"\263\237am?\203\331~\006%\373\031~\354g\270\261\237ai?\202\273\375\b\340\354G"
+	.string	"f?\002\265\375\b\314\366#\030\333\217@\310\376U.\265*\212\333\r\252\0319n\330\3301\305\321\244V\251:\226\246j\225:\225\325\206K\030\017\325J\315R\267T,UK\275\302R\265J\335q\334\004\337\365\3408\3112\335\321\217"
+	.ascii	"\306~\004G\373>s\366}\354\366}\332\354\373\240\331\367\021\263"
+	.ascii	"\357\323\266\177\265\206*\003\212\251\016\f+yFmP\244#/IkJh\252"
+	.ascii	"\f]G\347a8*\r\366e\372\342\nTuRc\250R*\224\032\245>\2513\324"
+	.ascii	"&\225\006\226\2522\324\245\253L\271\355\270\367\2522\324\227"
+	.ascii	"\214n\252\347\245\006\224<\fz\210{\326\373\200\355\373l\355\373"
+	.ascii	"H\355\373\300\330\307\020g\037C\230"
+	.ascii	"}\fj\373\030\306\3661\b\321yZN\003\353RR\026X\326\307P\265\177"
+	.ascii	"M\347gn\316\227\2679x\253\221:HdY\337E\253\274\357\373\203\355"
+	.ascii	"\256\264\300\310\372\030\220\366\361\330\364j\372\276/P\034\355"
+	.ascii	"F\327\001\321vZ\216\206\203\245:\216n\363\237\350\373V\321q4"
+	.ascii	"\033]\006\303QE_\251\037W\325O\207\255f\t\022\214\255\177\375"
+	.ascii	"\346\272\356\007\361\301\330\226\267M[\326@@\327o\260\023\274"
+	.ascii	"']\262~O\336~\217\334~\017\334~\017\2265t1\230\274A\213\006\237"
+	.ascii	"\236\274\260\264\032\235\006iL\032\2253\327i~\215F\317\3512\301"
+	.ascii	",\006\344E\230\254{Q\354\263\206\300=+\256\003t}&3\351\261\004"
+	.ascii	"\304L\031l\006Z\345VF\223YR\243G\220\350\330\373\276D\037\026"
+	.ascii	"\274#6\262\326qz\314\265\234\026\243\345<\300z\337#-G\234\363"
+	.ascii	"\276GD\214-\300\330\002\255D\353k\312\252\337Se\377:\f[o\213"
+	.ascii	"\027\271\246\254\337C\312\242$\017\313\022\350\226/\250\2260"
+	.ascii	" \315\246\323\360\331\320h\347}\265\306\324\304\246l\232\313"
+	.ascii	"\220\351\232v\323`4\234n\323_\364\233\366\202\245\232Mw\311\232"
+	.ascii	"M\243eY\002\334rw$\207G\277G\307~\017\215\375\236\246\375\036"
+	.ascii	"\243}\2369\373<\323}\0363\373<l\373<fW\202X\321R\257\254\244"
+	.ascii	"#Yc\265, )#E\302\200\216(@\311\0275-\325@\324L\221\270A\213\b"
+	.ascii	"9\252\353\222\242\003&\306H\021;\rE;\321U\364\230^\242\311t\023"
+	.ascii	"\035\325f\272LO\321O4\023}\246\225\350(\232\212\226\202\245Z"
+	.ascii	"\252\223\\\207i\261\0378n\375:z\202\025'\203+\213\221\"v^z\b"
+	.ascii	"\231\221\"vh>\260\331\260\367\276Vw\320;\0361\260Z\217\257\""
+	.ascii	"Z\252\2774\221\241\025)#E\354\264\226\240j[\330\f\303Q\275\275"
+	.ascii	"5m\214\024\t\323Rm\204\365jc\244\210\335\217\026\303v\204G\001"
+	.ascii	"4\206\303>\353\006\334\263\236\007\307>\317\213\375\242\233\375"
+	.ascii	"\242\333~\221l\277\bf\245\241B\270\033g\246d\375\342\325~\261"
+	.ascii	"I\013\301No\270\220d\375\2358;\310\316\230\375\035-\373;Q\366"
+	.ascii	"w\210\354\357\324\330\337Q\332'\262\331'\266\355\023\255\354"
+	.ascii	"\023\235\354\023\273\366\211P\373\327W\332J\205\342E\311\221"
+	.ascii	"\266z\357h\352\013Z\225\336\241E\206\222\034Y\377z\207\216\341"
+	.ascii	"\206\307\327\213\254\247\2040M\321\262\344\260\254l\210}\005"
+	.ascii	"\337q\023\326m+f]\332\2544\001\243E\212\027`\024\231\036M\336"
+	.ascii	"\330~b\304le\221[3CT\302\265\005\243K\033`\017\351\024\033\\"
+	.ascii	"\200JZ*%\002\265\3457\027|\341z\210\321\362{\013jA\235\341R\373"
+	.ascii	"\305\031\243\210\310e\321y\302:4Z0\260\264\001\313Dq\223\222"
+	.ascii	"\266F\327\215\371B\003\355G\007T\202rS\272\002\204\241>Y\202"
+	.ascii	"3\305J\020i\373h\373a\243\312P,\rm\214\022\225\240\026;/rLS\200"
+	.ascii	"s\316d\255E\311\372\354,\310\246\001\tF\222e\345+\353\037eD\211"
+	.ascii	"\022\204\372L\327'0*c\262\276\006\336\224\225\005\331V\251*m"
+	.ascii	"h`Y_\003\\v\310v\310\324XY\3456d\322\244e}\r0\211Fw\252\330\273"
+	.ascii	"'\272\260a\\\217\0302\262\276\006\274\306\306v\232\264\251Q\346"
+	.ascii	"-\f\030\204\006^\026\223\3574\251\242v\225\004\307\305\220R\263"
+	.ascii	"\312\372\032\230R\242$K\2152oA#K\210\264\241\023\026\246\201"
+	.ascii	"K\2152oC!Q\236\302\234A\202$\b\205\243\251\222|\241\221\365\215"
+	.ascii	"Zv\300v\300V\252\031e\240v`\244\320\242\262\276\261\312N\221"
+	.ascii	"\235\"A\266\264\274&\207\356G\3267\206\355\f\331\031\262\003"
+	.ascii	"\235\321+\222\345\315\234\235\257\357@\363X\331\030'#\327\316"
+	.ascii	"\326\316\326N\220+V\311\215;%\372\013\026\226\030;=\276\023d"
+	.ascii	"\307K\013R\0261;^;@zk3\332\274\262\376\221\203\212\026\266\254"
+	.ascii	"o|\367N\327\216\217\240\025W\2162Y?\003n\366\016W~\032Sf\254"
+	.ascii	"\013\370#h%L\024+Y?\003o;Y;YA\250\226\032e\336\336\324\361\322"
+	.ascii	"%\353g\200\312\316\325\316\325\016\026;u\303\r\027\225IJ*\316"
+	.ascii	"\016V\232\036\232$p_Y?\003:vt\354\350\330\251\242z\242\013\263"
+	.ascii	"\363\232B\213\333\331\361\235*\244#A\254d\375:`\21705r8\356v"
+	.ascii	"\240\276#\265\003\265\203\243G\006\357\211\214'al|\007\307w\250"
+	.ascii	"@|p5aH\310\034e\275scgj\247\006\230\232&6Y\357\320\370\226 U"
+	.ascii	"\031;\037;Qnvf\354\314\bB10\231\316\205\331\275H\272\312\372"
+	.ascii	"\030\020\263\003c\007\306N"
+	.string	"\323O\313\r:\2530!\232,&-;2\276\3234\305\224\225\225\365N\f\037\035\221\214\231#D\262\336a\362\321u\001\331\201$\353\235%1%%\"\033\336\211\"\305\311\200^Q\253\013\223\3651\220\265\203\264\203D\254\322dee\247\343\t\233\231\254\217\001\031qN\224\023g\307\250\027\207\243/\025\226\021\233\020\222\fe\254\311\342\232\363\035\243\357\274 >\270\032f\217(Q\262&\346\325\241\203w5\331)\313\221\252\254\211wv\276,V\\YY\237\235BF\0074\353c \311\215\033b\035&{\237\\D\271\221\n\3735\301\320\272{sb\035\332\024&yk\027PC\234\022\247D6\230\354}\332\240\026\235\013\353Q\211A\202Dds4*/\250\254\177\201-tt\3043K\216\214\024\261\213\276y\202\222\365/\300\2048G\234#\246Y\"\306H\021#\032A\226\244\301iJM\272\304\274\210f\210f\210gr"
+	.string	"\213L\325\031\303cQ\344\3209\223\237\274\236\274\340\221\365/\240\325v\342[\033\221\fqi\307\032\005\024C\203DK\230\023\311\234(\007\342\203o\251b\006\332\2255q\314\361\0177Q\226\262>1\316G$M\225:Y\023\305\344\252;\036s\262&\302}\215\027,v:\262&\202\371\032a\225'];\210W\2757\2558\244\254\211_\210n\027\330\321\245\013\221\r\n\223\225\225\335V\"\305\t\226\265\023\331\364\334\227\272,\027P\362}\371\276\210[~\260S7\234X\331\315\330\362\202D\334\242e\273\275\271\275e!\252\255P\004\211\005\272d!\246\021\323~p\264\234#N\026\200r\345J\020\372\203eT\367\263\233\25236\347\212\023]\326\267"
+	.string	"\020)R\210U\352@\211/\342\324`\243rb\225`\033\022\225Q\326\304)>:8E\336\324\261\300SY\031\321,\357\027%\362\244&\312\211f\333\354\315\316H\326Di>\353\322\206\345m3vbt\214H\306j\371\371\321\203w\003I\r\273wi\007\207\240\036WnON$\273\333\232'M\313\":a\313\310\265\221eMl\242\352\2401\007\306\344\367\005\273\334\336\332d\375\n\214\355W\340HX\030Q\t&{\237B\220j\303%\254\247d\246\315\212\330\211J\3422P\"UV\201\036\304/\342\027\021\t&{\2370\034\221j\303\205\270%\tM\024\342\221\023\221\250`]fDeM\004\373\221\245\t\233\001\226\365\353\210F\376\373Z8\262\226\305\b\261H\230:,5\262&\022\331\321\226F$\353W@\307&B\325\035\372\252\352\306Z\326\257"
+	.ascii	"\f//\242\220\037,#6\034\332\334\370*b\307\222aa*\022\344D!8\315"
+	.ascii	"\013%gu\216\206\217\\\021\233\222\365)\260\205\350\203\350\203"
+	.ascii	"\370\003\223\275O>i7"
+	.ascii	"\274\346\3400:\202\200!v\235\370C\007WT\022\220\254?\213\310"
+	.ascii	"\365\203\325Ksge\205CF\021#['r}\213Y\362\246*k\242\226.\243%"
+	.ascii	"\305\n\024\005\242\240N\234\202\"b\021\317\360\373R\275HI\257"
+	.ascii	"\325\225\004`n\370xc\367.Qq\020Z\311!\206u\343D\254\023u\200"
+	.ascii	"\370\200x5cK\026\234\254\211;\210UX\3726\242\325\nE\025%\016"
+	.ascii	"\263\300\220\322\226\365'\340f\037\277m\r\001~\333J\314\361!"
+	.ascii	"\325\227,\323\254O\244\"\342\370}?#\\eI\262\376\004\346\3667"
+	.ascii	"\370\357\333dSQQ\304\032'\332\370}\300&[^\304e\375\t\304m\242"
+	.ascii	"\324\2114~\037\3561\003NL\326\237\300\333\376\211Q\277/\310&"
+	.string	"\310\024\220\254?\001\266\375\td!6\021\233\2103\360X\2152o\3037f6\346\020\235N\234\261%\016\330\033 Y\277\216\230\004O\006\231&KK\304\030?X=4r\254\254\356\272\266\324!2\235\030c}jC\303$\353\3532c_e\336\262\376\004\276\210FD#\342\013'k\215\032e\336\354|1\222\234iB<:\361\005Q\351\207R\217\266\254\211Il\323\020)o\326\237@\024\021i\232\2277\354\372\3012bs\001\223\264\271\2605I\025\22751t\350\004\241\230\354}\002\"\231\2523\206\201\032\227:Y_\002L\344\310\031\342\375`\031\325\261sl\314\255\365\2240\221\271\272\373\020OX'\205kr\244\256n\030\007\223\001`N0\217\312\030\"p>\214\243\343\234\2201\223\346\355i\316]\225\0337fT\036vG8\262\276\004b\260a\023d{/\351\265:\003\365Y\031\323E&g\315\232\240\026L\006"
+	.string	"+VVaxMt\274)377T\363\203\325KC\307\312*\004\2567n\322|\250\006Oy\251\202\244\375\367\255g\300x\300\300\242\332Pm\f\317\374`\031\2611"
+	.ascii	"\324\224\0337\355\343\216\t\2323?\210\017\206f|rp`\321\031\226"
+	.ascii	"Ir\231i\311\372\021\0202\224\223\013\262\375`\365\322\320YY\331"
+	.ascii	"\275/\025\207fZYZ\326\217\300T\\\034N\343{\337\254\034\277\351"
+	.ascii	"\324\032/v/\324Z\006=</=\264d\375\026\344\366?\f3\f\023D\342"
+	.ascii	"\260\363"
+	.string	"\276Zvi/\024U\006\304\263\2649bY\277\005,K>$[\265\326-,\035.\031\202\351-Q\2754:\304-\311R9\274\216d\375\306\312\300A\345,\353\267P\266\217\307\240\f\245sQ\206ech\316\206S0\\\227\bH\300\f\253\f\265\\Y3\035\256\251s\303\2623P/\303/C\267!\333\260\313\260\rK\207kC*t\206kC32u_pC\r\345j6 -\235\320d\250ehe\250\026\202\333\324\\\232\335p\313\220\013\226\016\265\374G\203\020\357\214]\223U\377C\265a\226\264\030:`d=\304R\326&c+\353\267\260\265\377!\032\226\016\323\350`\024\2413$\353\341\225\253\321LF1d\264\300c\277\005\035\373-\314\330C)[nZ\365\226\365[X\332o!i\037E\336>\212\273\375\017\245\303\2622/o\336\312p\334\227&\244\254\217\002\316\036:\031>!*I\353A%\353\017U"
+	.ascii	"\002\206J\326\272In\373\202:e\375!\223\241\231!R\236d\375\341"
+	.ascii	"\030\225\27478\262\376\265\331/P\230\301\340Wu\345JG\326G\221"
+	.ascii	"6\344\303\260\341\220\241X~\0225\032\"1\331\221\201/I\210\016"
+	.ascii	"\271\254\361\03460\310d=\004\033\"\031&\371}>\265\246\270\035"
+	.ascii	"Y\037\305\331\376\360H\227\030!G\262\316\370[\326a\221\017\215"
+	.ascii	"\374>v\f*IJ\326G\001e\177\b\035\022\371}=:njLY\037\305\222\375"
+	.ascii	"\341\327\177_\b\346x\210e\375\233\333/P\004\301\300\207\206L"
+	.ascii	"\215W\326G\341\264\377a\220a\020\234\346\004\254#\251\013\334"
+	.ascii	"\020q#5\334\001\303\t\017\017\b\220 [~\337\367\205\262kyy\332"
+	.ascii	"\312G\031\226\254\177\202\316\207\217aW\306\032\223G7}\251\250"
+	.ascii	"8\370\322|A\242\226\365\260\313\354LT\030\023\266\254\254!\327"
+	.ascii	"\t/\206\2743I\033?\264l}\310\265\2058\006\225\"\227\365P\353"
+	.ascii	"\304\223\341\025\226\016\257\206X\2778:d\340\214\364\240\312"
+	.ascii	"\372'\212TU\271\260\002\343-\354\245\242\3420\214\203\306\346"
+	.ascii	")\353\237\320\322\241#"
+	.string	"\310\266\215~\230\334\005\333\260\314\210d\375\023M\373\306\215!\216\023V!f\324(-E\276P}\210\003\337\250\242;\362\323\242\006\r\242%\353\263\260f\333\260\021\204\236\360b!W\262\032\235\270\267\254\317\002[\324\220FT\220MJ*\310\206\205\312\313\034\244\256\254\317\302\224}\026\300\206O\303\247\340\027\026f`\274\205]\r\235\206NA\266:;(\013F2.#\310V\301\373\276/\336\026o\352\334\246qC\243!\323\320h\2704<\032\036\r\227\266\321O\335\022\025\007\340\213318\030\037.\261?\334h\271e=|\361K\3735\241\215q\033*\225y\022\353\222\365?T\032&\t1\222\206\211\311\356\332!ej\210\364\033\242A\253\321\301\303I\326\207@\226}\b(\311\313\303q?c\020\340\201'\244\2037g\016\226&\020\210\3327q'G(\247-.\2160\216\024\023cB7n\204u@(n\3027\032"
+	.ascii	"\223sE\323Y\201U\341\310\372&\270\326\b\331\254\231N\235(1qc"
+	.ascii	"\337\304\221\03252\246g\204sg\202l\353\373\342(\326\023\324K"
+	.ascii	"\005\305\001\r\232 \033~\241<\210#e\005,\373+x\355\003\213`!"
+	.ascii	"\031a\234\260\fN\243\337\263\367H\312\003,uV\340\261\277\302"
+	.ascii	"\030\341\2309D8H\252\274\262\376\nLb\304\004\241\034`\241#\007"
+	.ascii	"\016.\211\335\231\267\267'\025\256\270\271\005\331\272\350P\341"
+	.ascii	"\310\376\263\224T\266\241&\275=\272~P\033m\332X\300\016\351\f"
+	.ascii	"\333\261T\310\026\354\321[\302z\243\026`\247\323\226$\021\311"
+	.ascii	"\372*\324\330\177\276\221o\370\326N\300z\243B0y\347\302\330\254"
+	.ascii	"\2519:\2502U\326\301\001\353(\253\202\251\215,$vB\"J\244H\231"
+	.ascii	"G\346\341\323\242\311^\032l\030U\006\254\233#6:\264h\tn\235\200"
+	.ascii	"\365F\20506\354\241F-F\326W\001j\377\302,X*\314\342\253r\002"
+	.ascii	"\326+\025\302\215\217\355N\007\230\254\257\302\2220M\230\026"
+	.ascii	"\3742\347n\013\257\b"
+	.string	"\257\004\241\230\311Y\334\256R%\310\266dM\nZ\366\357\203\372\240\330\254\227\364Zu\261ml\314\255\251hPn\020\311\272\254L(\205\311\017\030ov\302\263\013\245\254\371pC&\353\327\t\315\252L\221\323%4\023F\241\002\306\007\325\022\275#\b\0332B\251\257\210\317\bPJ\213\016L\326O\241\307\376\205N\260T\350DHvB\3645\":\215\t\311~aT\370$?\311Nu\246xe-\001\026\366Y{[\270g}\nR\373\0272\0212\021\022#\205W\270D\270\304H\032\024\246bbA,_\322\233\025\266B\315(\003m\263\244\213Q\326G\241m\377\302$\307Ra\222\240\025\007\254Wj\20393\342\326@\034)\351\310\372(P9r$\270\243\227\364\036}\001\245\234\206x\331j\202\300\231e}\024\222\0301\022\314q\002\326K\303\2029NwE\222p\\\271\312\372(d\021!\022\244\342\200\365\3220"
+	.ascii	"\027'\2727/TW\266\262>\n2\366/\374\022~\005\247N\300zi\2048b"
+	.ascii	"\004\357\r\326\024(nY\377\001\323\375\013"
+	.string	"\205\374=\262\036\022\226\n\205\004k\364\222\336\243%?%NC\274L\325\224\274Y\377\001k?~\b\2758`\2754\200\246NZoz+\211\213\227\254\205^B x\013\254\f\232\030 l\262\376\003\302\366/\364q,\025\372\bJq\300z\2458"
+	.string	"\023\345F*\007\001\003\225f\375\007\370\330\277\220\353X*\344\nB\251I\357\221\220\037\222&\257;0;.\037Y\377\0016\366/\324\222\n\265\2023N\300z\243\026"
+	.string	"\247\311\353nS\305eA\222\365\037"
+	.ascii	"\305\203GP\206\232\364fIY\2254\001\201\372A\321\312\212\221\365"
+	.ascii	"\035\320f\377\302+\341\325\020\007\214\331\277P\207P\207\260"
+	.ascii	"\252\227\364\036IY\3374iMM%\2612\313\302\252\013wh\240\254\006"
+	.ascii	"\232\034aL\270\230\311\372"
+	.string	"\016x\262\261T\210#\bC\223\275F,\232\032\336\033\341\025%L\206d}\0070\331\277\360\206\360FP\211\003\326+\025b\tt.\314\216\313\025%^\262\276\003\200\bm\bmd%\247\035\016\240\242AcM8E\n\236\223\031QQm\3018o\0345Y\337\001IOO\300<\\Lz\267\254@\337\327-\203\037\032+^o\326/\341f\377B'\241\0230\257\267\204u\244e\200\0326\206\274\331\275\257[\006\276*.$\252\254_\242\312\376\2052\216\245B\031A#L\366\032\001\325\034\321M\331\371\276\310II\022\306\304t\264\373\222\3365\2534 ^\22771Y\277D\327\376\2050\2040\216v\002\226\022\024\0050\301\352\315\360r\025\225\365K\340\020*\t\225\202P\016\2760)\221\264\217\343\260\360\350\007\361A\260\216\020\t\307i\266)'\334\355\237@\267\217\305p0\017K\203y\302\367\204\350k4\2242\325\310"
+	.string	"\230\347#\210[\225-uuA:\034\2601\231\363 \035\240R\2335VY\007\361(\340%\311-\353\340\235\226#\236\341\222\006\232uPNP\214S\225-Y\007\355\276\346G\367\204J\224\254\203q\276\245\007%\t\032:Y\007\341\004\311\354@\263%\353\327\3515\377}@\255/c\276d\375\023\236\270qC\244\353\004.6l\260\331\017\226Q\233\n\332\330\310B\242\351\254!\363#\353\237`\264fM\020I]z\337\250\016HK\2502\310]dL\251e}\023\346\366\037T\203\245A5A\246\n\210\2101R\204\f\23368\262\276\t\\\346\346\364\216\037\262W\212(\244\310Z\006\275\243*/)Y\337\204\262\375\007\313H\203e\202g~\260^\251\020b\357\\\230*7\203ML\326A3b`ZJ\262\276\tH\366M\320\212\213\013\312\355\367}\215\350\214yP.N\225\262\325f\311\004\245\375\007\303\004\303"
+	.ascii	"\353\234\200\365\322\340\240\226\026\307%\310\303I\023\252\254"
+	.ascii	"_B\235\375\007\301\200\301it\364\215\372y\341\225P\246\255-\370"
+	.ascii	"\005+@M\t\324\355\301/\303\261-S9\\\376\373\214[\200\260\255"
+	.ascii	"\255\005\331\324t\260\211\001\0332%\353\227`\266\377 \227?g\311"
+	.ascii	"jX\032\344\002\234\303a\277Is\250\020i\304`b\227\365K0\222%K"
+	.ascii	"P\213\357}_\243\350\3734\0014++5,\rjQ\227d\211\336\310\372u\330"
+	.ascii	"\354\277O\325\202\223\006-\353\227\300\265\377`\332\2614\230"
+	.ascii	"\226\243p\210\276FD!NJ\260A\205J\360\n~\337$^\254<x\3457\345"
+	.ascii	"\007\033^\326\301*l\333\233\326\325\267\330\300\262\344K\326"
+	.ascii	"'a\314~\320\f\007\245H\371Y\301P\233\n\0256\022\270\354\343\237"
+	.ascii	"\225\365\017F\211\202\323\364\316\233$\304\n\212d?\003\034,+"
+	.ascii	"\303i\030jOq\252\232n\355?H\026$\303n~\242\257\224\013v0\336"
+	.ascii	"\354H\310\261\377`4\030\305i'`\035IYP\244F\231\267\004<\371\022"
+	.ascii	"\263\377`\223\037\304\007X\032l\202\343p\364}b\235\256HLQ\242"
+	.ascii	"$8\206_\250\367\255\n\216\235.\310\344I\215\025+\377}\032\r\220"
+	.ascii	"\351\\\326'!\266\377`XX~2\261c\bq\232\222\340\332\017\202\341"
+	.ascii	" \022$Y\311\304\216\341\224c\372B\275\031\234\004\215}\234\225"
+	.ascii	"\326?h\004K\203F\362S\216\276P?!M\321\f>\"o\377\230\013\346\202"
+	.ascii	"\261\234\200u\224U\201\223h\034\227!\234:.\261\254\277\276\202"
+	.ascii	"P7\025\304\031\362\272\007\241q>\"F\264\232\262\376\2100\373"
+	.ascii	"\017\n\221\006\205\340\263\336\322\273\301\022\214\267\260\021"
+	.ascii	"U\366\203>\202]\017\376x\360G\320\313\367\276\357K\365\032\265"
+	.ascii	"\251\200\b\025\024\207?\b\344A/\263\261'D\244\262~\335\257\312"
+	.ascii	"\177\237\357\311\030%/Y\177\204\221\375\037?\377\353{\004\365"
+	.ascii	"\276\257\224\032}\241\220\202\353\217\217U\2149\374B\334\303"
+	.ascii	"\002\370\257{?\004\324\230x\337.8]\357\373\3427\333\b\332\221"
+	.ascii	"\216\n\336\377\177\206\367}\243\226\222^#\274T\226\025\265T\226"
+	.ascii	"\005U\\r\313\212z\223\242\302\222\262\260\360RR\026\024T\322"
+	.ascii	"kT|\313\262\240\226\336\254\250\235\267\354\275\261Tvd\204\227"
+	.ascii	"\222\336\250\367\315zw\336\245\243\250\267,\nU\\*\313\202Z*\313"
+	.ascii	"\212*.\225\035E-\275X\357\316Rt\013\352\215f\031\025e\224\035"
+	.ascii	"E\275eXQ\305\267,+\212Ik\013\017\016ui\270flI\302r\006\207YJ"
+	.ascii	"zg8\3558\202\332\201[\212b\275f\336\027\237\275x\241^\270\367"
+	.ascii	"\025\300\373\356\300\2022st\003\247!\301\315@\252r\204\205\243"
+	.ascii	"\357\373jpB\322\302z\223\340\214\360\013\267\004\206\365\276"
+	.ascii	"`HB\257\323\373\276\257\007FQ\270\367\007\2063\332\332\3616\275"
+	.ascii	"x_\t\336\350\373:\275\257\021~\341\336\3675z"
+	.string	"\337\227\205\332\021}\337\034;KP'\247\367\245\372qzw\030ay\361\276\371\fMZ\324R\231\026\026\020\226(e\320\027F\324\b/5a\275\320\327L\026\324.3z\3626\275\357\213\335lh\024\2156Y\007\271\250\244`6\262\376\b\030;\250%'.J4\353\2170\332Q`\232\225\224\032YG1P%\231\221u\360J\257A\214,\t\313\372#\260\331\301\252$Y\264\244Y\177\0042;\250\243\211Y4G\326\037\241\313\016\342\210\022seG\326\037\301l\007o\324hS\027\315\372#\034\331A\033Njd\356\262\376\bW;H\343\330\216\207\225\226\254?B\323\016F\t\251|\201\242\226\365Gxw\360\to\335\230\001\225\365E\270\331A\247\341V\023\035Z\326\027\221fG\243wqOq\2021\206Y\264\200a\223\365E\250\355\340\322\025\261\271\264\254/\002\312\016\276\030\200\230\327V\326\027\301d\007\223|Zz"
+	.ascii	"\371\222\365E|\355\340Q\r\036I\312d}\021V;\370\256?\272,\271"
+	.ascii	"e}\021O;\n\244Z\262\322\004H\3477\203nIS\326\027\201\316\006"
+	.ascii	"\342\t\201J\263\225\365E(sg\027\244\343!\005\027\006K\201a\200"
+	.ascii	"v<P\022\340\312\213#\001\217\0324HH\232\232\222;\020\316\017"
+	.ascii	"\024\003\214\003\326y\020\006j*\3537?$P\330\254e}\021\316\346"
+	.ascii	"\300\220Q\003=\203f\251L\232\2717%g\254\320\315\001\315\314\251"
+	.ascii	"\001\266\001N\201i\200l\200t@7\3005X\n\234\003\242\261\221$\314"
+	.ascii	"\022\217\276\b?\366E\300\332\027\201j_\204\247}\021`l\340\030"
+	.ascii	"\240\003\3458\260\205\365#\353\017\270g\345\340\305>\353\332"
+	.ascii	"\2007po=)L>\302\334\244@7\340\033\017\224\004\244\b\211\022\304"
+	.ascii	"j\263&\007\221\374\005X\026\304\372!C\210Z\326o@\2306\266\025"
+	.ascii	"+N"
+	.string	"\235\216)X\n\234\002d\343\201\252\300\231\034k\031\207\220h\023\331\226*\300.\177f\002R\001r\t\212u\335 \223\365\226\341\216\250(K\262~\003\306\254\210Y\271\302v\245\n\360\nP\t0\013\020\013P\r\210\006\324\002L\303R\340\025`\025\2576Kf\206\372\r(\262\337"
+	.string	"\247\315\336\355\037(\005h\206\245JNH\326\307b\030\230\004K\201I\200f<P\022\22026}\241jd\020e\227\025\021\253\021,#\345\253\n(\375\363\0240\fX\026\374\251q\362\305*k(/+u\307D,\3533\300\313\330\364N\f\350\004\370\004\310\004H\006l\202\245\300(p\311\223\261\250f\243\313\204x\001\345\213\301\265d\372\004\214\002\225p5\201\361\226i\\Y\373\n\3523@m\237\001F\366\031"
+	.string	"d\237\001Y[e\300\323\376\201H~K\234\274\300\262>\260\b\006\202I\201`8\r\206\332S\274\334\246/TZ\006_\200\233}\214\323\254?\020\b\020 \021M\366J\001\275\320\2502\350M5\231Q\313\032\212\327\214\244\211\313\372\013 \263\377\003\207`)\360\013\350u\006\374\002\006\001\n\331\300\364\276[k\353\333\023]\030q\315\r\03754PH\232\354\324\243\314R\326_\200\331\376\002\224\354/\200\013\3305\204#\243\256K\326_"
+	.string	"\024\320\007\220\013+\007\224\243\254\277\200\245\r\334\002b\035K\201X\300\254\037\224\nj\302\246/\024T\006@\036\3042&[\306\262\276\002\352\366\025\200f\377@+)\320\3127\366\023}\245\210Nb0\336\354^(\250\f\256\200\267M\346\252\216*\215\216c)P\007\020\307\317~\223\334\246L\337\227*\203\340\234\217$WY_\001T\366\017\314\001\304\261\345\013\316Y\326TY\242\212x\311\372\n`\262\201S\232\315O\314j\326\206n\312\016x\003K\201S@\033\307?@\351\222\271\036Z_\001_\373\007J\035X\343\377\325\001i"
+	.string	"\251q%N\3268\f\373\254?2@\007J\t\273\202 A\003B\035\030U\345\252\206\0161Y\377\276"
+	.ascii	"\035\b\265\326\221#\343\254\351\300\247\037\350\004\234\221\205"
+	.ascii	"8\001\231\2225N\303>\001AJ\025\314\346\210\rDM\3679,\341b\311"
+	.ascii	"\\\341Y\302iBr\331\236\020\201\362\027\201\235v\231\342\210b"
+	.ascii	"\305\332\032\235M\242_k\\\301u6\211\204\317&\333\272G\026\222"
+	.ascii	"E\307\024\333\271\335\013y0\0061\225\316\245\362\350\352 \246"
+	.ascii	"\322\031L\261\272\360<\016\351"
+	.string	"\344\261\025\322\356\376\3719]\023%|\332eR\031<\272G\022. \217)\226\313\343\210\026\316\241\313T\366|\236J\036fK\264BP\023\005\241\247\222\331.\211Z\026( !\002%P\214\020a$\201\304\n)\030G\260`<Q\242HB\213t6Kh\237\315\345\210\345\262\350\251\304\300\n=\213\226%\270Oc\360D\262u\036\205N$\231J\025\030\230-\321\n\027\362\340l\211\3326\305\207\246\262\351D*Sh\207\224(\332\240\fOe\005n\373\034j\207\326 \246\222\311,b\341\331:\217B\356q\bD\007.\263D\212\242\023.\216N\347Q\b\002\320\t\017F\210\300\211\020\306\020.\210N<\213\232\312\025\255\323\204\333\232\220T\022E\340\266&d\210\200\333\006e\020\341\266AE\345\363\311\202\333\006\261DC\310\241vh\005\321\301\211\016\214 \202\216(Z#1\210\251|\226h\341l\235\"Z8\177F\210"
+	.string	"\b@\313#R\310=\016}p\237\314&R]\256$\334\326\004\244\353\034\272\306\337\362\210l\242\340\036\207\234\315\022z\\f\211&\212g\353\272\030\301=6\221N#R\305\007\244\212\bZ\023N \235=-S\211\202\220\207g\004\256\261}A\371\\\227\313\"&\263\311dY4\235Bn\223\311\2528\266K\335:\213\2104\263]:\335\347\032\304T:\335\023=*\\\246\322i\302\370,r\217\356\211\026y$:\261\302\331>[\026HT\340\266A\302\026\316d\353,R>\237,<\225;\354\223\331\002S\031\324\216\220d\222 \201\021\"\340\032\237)$\231$\214\270\220\007\024P\2248\361\301\005ds9\242u6G\020]\0205G\270\027\362\020D\204d\026\225"
+	.ascii	"d\252\310\352\323\030D\024t\215\314 \""
+	.string	"\225\031D\324k_P>\265\013\242&R;]\242\336\205.\234\356S\031\324\262`L\266l\262}\026\351'\373\243{L\032\203\210<\f\215\255{\\\022\r\265(\334\366\331\262\020D\004\200\244\322D\321U2K\004\207\232\314\326mM\030j2[\022&\"p[\0236(\223$\2708\2460\024z*\231\312\022P\bj\242\220d\212p\001\331\n\215@!\331\376\020\231%\" j\333\021\334\347\021\005\023\005\020\272\316\243{\002\003Q\263\211\002\007\036\\\347\221\310\303\263E2\217+\222\"\b\340\343\300C;\244D\001\004>[\024\316\246\333L\201\251$:\333\026\311T\236xJ\360L\266\356qH\211lI$\227M\241\237\013yx~h:\217)t\320q\250wt\217$\222J\"6\331&\333V\005\025%\"\030\032\333!\245\313,r~@\252H\036\233Ka\020S\311\302\321\3512K\0201\020{0D A\206g"
+	.string	"v\212M\247\213 MA\213d\266\316VE\313\202"
+	.string	"\220\310c\217\307\004\211vH\211\302\307\202\2534\301u6\205\236;\027\3620A;tT\341\327#\024\244<\201\310\242\211\302\nM\025L\345\323\305\t\037\220\207d\3332\201\317v\350\250B\222\331>{\224E#\\\310CPQ\2126\371!\271T\026\245h\223\315\024|\030L\024]\236d+\204<\"\231-\270\317\326\245`m\205\220\307\021\021\bO\2300\241u\225N\026E!\321\3314\261B\204\213\243\323)\242u\225N\tp t\266CJ\024,\232\313\023\0018QT\016\265\360]\310CS\351\266A\311\242\021Nx\272`\212H\266AAM\0242\270\355\211\235\022%\212&\332\241\346\tO\"\023\202\232($\227EM\241\023\024`X\241$\321\272G\026~\216T:[f\033\264\357\001\b\033\200\020\242\005\373\020\b\340"
+	.string	"\001\034\254\017\201"
+	.string	"  \004\200"
+	.string	"\264\017\002P\317u]\327u\213\256\353\272\256\353\272\256\353\343\036\335eK\002"
+	.ascii	"%J\260&\266\t\366\311T\036S\3409\001\351[\036/0\341Id\202\333"
+	.ascii	"\256\355\222hH\031\200d\313\fR\236x*\267\213T&['\021\373d\321"
+	.ascii	"\\\236@a\002\027\351\374\200T\341*S\350!W9B\213f\212\240\013"
+	.ascii	"\317c\n\314\246\022\351\304\320\032\235M\023\030Zc\262D\213f"
+	.ascii	"\n\326\345y\022\005\375\\8\233\356Sy\002\213\346\362\t\034j\335"
+	.ascii	"\247\213\023<\256\333\\>[h\207\224\356n\215\030\210\212\232N"
+	.ascii	"\023x\206IfsD\t\031\334vH\211\002\3704\002\240uK\0045\227\301"
+	.ascii	"v\250\350\331\262\020\304T\006\0055\227\302\"\f\356\323\250\201"
+	.ascii	"\250mG@2]<\267\373<.}O\343\004\317\240\343R\205\372s/\344\341"
+	.ascii	"\251\242M\032\203\216\313\022\334cs\251\302\3674\032]f\273\202"
+	.ascii	"\204\240&\n\003`\3212\367\261\271,\201E\313\0242\213J8\362\270"
+	.ascii	"\314v\310}\026m )\202\251\344y\032W\367B\036\216)0\264\356qY"
+	.ascii	"\204\\\036\221\276\325-\332DE\333u\211\212\214\256\363\350>7"
+	.ascii	"\321\nM\3471\205\217\250\310\350\266Ak\353,r[\024\255\263\350"
+	.ascii	"\371l\235&T\022H\245\3332\203\216C=\356"
+	.ascii	"P\321\211\336S\331BDRI$t\223\312\3451\002%\264p\372<Y4\227'\222"
+	.ascii	"\315\024\210\317"
+	.string	"\240\343\262\204\326=\272\317_\373<\n\231hU\034\237K\345Q\2050\331\256P\266\310\226\205\345\221\031\244<\321\302\271s!\017\0376\250 >[g\221{lKH\266\313\024GfK\274\220\207\026\316\017AD=-\234?\242\343\020\322\251:\333\244rE\323I\224l[8\227G\245\263}\026[\264K\242\"\022*\226G\241_\233T:\231\312\n\214AEK\242\237\242\333>[g\323-:\032\223Le\n\243{|\032\207\212\234\256\013-\321s\202`\273<\"\177\256\263]\301T\"\235I\345\220\312T\016\355\026\307\241M|\216X\036W,\233D\316\326e\226@:3<\333\326\031\324\222\030:\216XA\244\202\207\305\221\002H\245{\034j\231JdP\204\362\370\303T\"\333g\221\261\305q\310\330\302\t\\\266L\346Q\bilQt4\2668\016\021\237\355\320\321\251\302\210t>}\224\317\247\023\330\022\271p\213\032"
+	.ascii	"\340\026\0211\225\031\332\025J\367\270B\351l\223F\244s\303q8"
+	.ascii	"\344<\032\335\247S\251\302\310l\032\227G\244\317\220\363\370"
+	.ascii	"T&\213\316f\tO\027\220J\367D\020S\371l\341\251\214\340B\036("
+	.ascii	"x\036\211\206\232H\"S\271D\266\311\240\343P\320q(\b\034\006\035"
+	.ascii	"\207\210\303\240\343\0200\350\210\"\330t\266\025\b:\016\261\027"
+	.ascii	"\362@d>\221F%\3213H4\"A(w\204Oe\2239\\\266+\334\345\321\250\002"
+	.ascii	"il:\217)\200>/\b\031U\020-\215H\344\361\207D\036}\256kT\321&"
+	.ascii	"5\\\310\003\213\243\213\336s\202'R9td\272 \341\323t\266\025@"
+	.ascii	"\"\217\254\253\242M\032\335\f\352s\271l:\365\263-Z\036W\254E"
+	.ascii	"F!\244\2534\221d\212X.\233"
+	.string	"\316\036\026Gg\3579\244t\242p\266n;\324\344\271\220\207'\322\271\3419\002\351\344\331,\216.\202I\3461E\362\330&\213m\020\363(\2044\272\317\243\ncr\331\0242\272\313#\006\026G\027\030\334\013yh\335\243s\331t\272\027D\320\272G\026zB$\225)8\205\\6D\223\250\005\tN!w\377\236\255{d\001\351d\233D-H@:\327g\353\036\235\252\211\022$\234B(\230.\222\254\013\307\326\231\302x$r\207-\221\013\267'\251$\002>\237-\262\351$2&\225DEfS\3512\333\025\255\223H\202\n\214\255{l\223F\025*\232\255\013G\327\350\342\310\342\310,r\016\340i\f\376P\270\314v\250]\321L\241\351t\021T\301P\223\331&\215H\246\213'Q\005\321\322\330:\217,\222\316\243\220Q\370\202\220\013 :0\266\317\242a\373,26]\340\013B\304\027\204v\200\200@\030_\020\302"
+	.string	"\302\350\252h>\177X\034]\030\211,\232K\025\316v\305\n. [!\244\260\330\022\271py\212,\216.x\230)\224\313\343\210\246\323EP\006\027\256ry,\342@Q\310M*Yd \272*T\360\274 dl\227DC\307g\317\013BF\246r\210\351\"\271\203d\272x\032]\242\"\247\263u\231\312\036\016\030\205\220\256\222(\310\001\343r\331t\0029`dqt\361caTQ4\244\\/\344\241\351t\021\324t\272\bZ\333!\245K\324l\242\340\266A\316\243;T\261/\344Am\256\356\205<8[\345\222H\351.\213\2060\214 q\342\247]\036\221O\367\230b\205oy\\\261B\231|\266\316\013y`6\225G\001<\215H\344Qu/\344\201"
+	.string	"m\2629bE\353\f\272D#{!\017.\262\310\351>A<\215-Z\267h\250\350\002\262\2714\032\215\254\263e\262h\032\215\354\323\331>\213\230F\343N2\225.\030\215\353\223\251$z\032\215,\263\251|*\227\255\321\350s\215\356S\271\334\271\220\207gK\344\302\335 \331:\217B\317\r><]e\212\017E\314\240\rZ\0241\225\313\r<"
+	.string	"\301\bB\210\026\037\332d\321\022\311T~p>\213>\204\340\266h\231\313#\323\231<\266N!\227\310h\314\260\242u\022\031\215\253\373T.\215\306\365\350\036\223F\343\332\276\240|\032\215\253\013\310\346R\273Jf\tf\t\256\222\251\\\235\256\t$\263\250\204\344\261e\001\211\024\201!\331\272\200<\022\255O\343\212\226\004\022y\334\314\022\222\307\326\271\272O\243\222\350\204\212\226DK\344\002\205\261\204\211\023\300\026\311<\272O\246r\273\306\025Jh\246\322\004\363\211\\\225D\317\336\3238\002D\t\340\b\020%|H\020\312\336\205<<\213R\244\260\343l\335\347qh}>[g2yd\333\025\307\345\211\"\242\241]d\\\321&\237E)\366\323H\342Y\224\002\330\032[\"\027(\236E)|-\221\013\367Y\224\202}\026\245\350\231"
+	.ascii	"dD\"\217+\213#\013#H\210X\335\013y(\"\03226\235.\202\220\310"
+	.ascii	"\243\001Z#\013\034|\300\001\bEDC=\317\326\371{\0321\264\306\023"
+	.ascii	"EDC\300\325]\026=[\026\230M\245\213l\335\226D\021\321\020Okd"
+	.ascii	"\006)\227G\343\220\031\244\\\212@\"\217\333E\362\330\262pt\217"
+	.ascii	"I\237\363\251\302(\024\244\0242\"\221\307`\213d\256\340>\217"
+	.ascii	"-\n\256\210d\353\036\223D-<\225\032\204\356\205<\f\261 \372\360"
+	.ascii	"t\266+\224\316d\005\256\221}\006\035Q4\225\353\212\226D\353\036"
+	.ascii	"Y\b.\233\310\246\333t\232\330a6\225Og\273\202Yb\210Eq\210\205"
+	.ascii	"\211d\213d\272x2[h\237"
+	.string	"EC\267)\364$\341>\235E#\264\317\"\341\2126\331k\213\226\307\b\270\355S\205\212\025\332e\262\304\362\350*\203\224\311\b\230\312!`\213\343\020\020\311T\016\375\332e\323\304\360B\036\332!\245\373\201\331\034\032j\"5<\215\3561i\004:\217\255\013-\3442\233C\252\213c\262\367t\0265\205\324g\353\0261\225C\3543\311l\"\333'\373T.\227\312\241\365B\036\220\037\220*2\f\265\356\323\305sHd\241]\241t\221\307b\233l\016\375\236H\245\373T\272G\367it\341yt\211BHW\311\342\304\263i\002\204\326=:}\\@6\227Hg\273\242i,\"B\n\333!%\212\026yt\232\020\304T\0169E0Wp\266,\232D\0218\333eQ\262\025B>\207\316V\251B\3512\333d\211\244\363\330LAt\235N%S\251\242%\221\\\266\312\0224\264CG\246n\207\216*\f\235G!\244\276P"
+	.ascii	"v\232J\266E*W\264\311\025\211<\032\223\316&\262u\376\332dsH3"
+	.ascii	"\233\312\347\263u\022\r5\221@v\2052i$*j:\203\206\306\366yt\266"
+	.ascii	"F\241\347q\251\242x!\017\037\236\316\346\223\331>)hqd*\207xX"
+	.ascii	"D\3402\333g\353$r\233L\367\230b\205\006\344\212\245\2605\362"
+	.ascii	"\264F\f-\322Y\324<\341l\3356\005\227\331:\235EH\036\027\256\022"
+	.ascii	"y$:\246 \272\307\021\"\320>\213\204O\327\331.E\214h\237E\030"
+	.ascii	"\332\240#\263\251t\211\206\212\236\314&r\303S\371l\235\255\373"
+	.ascii	"t!\344\036S\254\030\266AGw\331\\\261\\\266\310\345\262H\205{"
+	.ascii	"L\261\242\307e\0265G,\227\355\b\027\316\326u\217#\264HgS\205"
+	.ascii	"\317\na\262\251t\266&T\020\241\340\036S(\205AL%\323y\224@\004"
+	.ascii	"\313#R\351*\235#\234\315\022\234E$\334c\212\025\031\236&\222"
+	.ascii	"J"
+	.ascii	"\242\340\013BF\026G\027\303\027\204\214;/\b\t!\335&\223\307\275"
+	.ascii	"\220\207\244\222\350\007)\201\3744\252H*\211V\023\270\004&\201"
+	.ascii	"K\300I%Q\317\331\272K\245\n\023DEI\246R\002\031\200CE'\222J\242"
+	.ascii	"!S\231\202+\"\251$\332i\227AL\021\313vE\273$6\211Z\220\340+\272"
+	.ascii	"\310V\205\212\2366\331\0342\272\316\226\250Ekt\227J\327\310l"
+	.ascii	"\276\240t6\205~\332d3\005\027\256r\305\321i\202\322e\036\211"
+	.ascii	"(PD\300T\036Mp6\335\243\263\305\360L*\211\214\311\326\331\n\271"
+	.ascii	"\307V\305\320\305\021\331&\215J\326\025\nR\266,\214\316\375c"
+	.ascii	"q\244\200\220\310\342H\001\367\331l\216\300\323&\233C\316\026"
+	.ascii	"yt\032[\025L!\013,\216.\212\313\026\211\024\321\272G\3470\031"
+	.ascii	"\264\223\\6\205\236\255S\3105\376\264CJ\367\347\342\270l\223"
+	.ascii	"@\f\255{t\032{\236\314\226h\2509\"\2514\341\036S\254\350I:\217"
+	.ascii	",\234\315\022\222m\253\302\307D\t\022=&JP\200\331T\272\312'\363"
+	.ascii	"\350DA\302e*\233&\334\366\031\001\213\243\013#\321U\016)Q\370"
+	.ascii	"\275 d\004\361|\036\211X4\227\305 \246R\310m6\207\236I\243\353"
+	.ascii	"<\016=}\\8\333\025Md\3534\016\207\356\263\331Lal\227\256\333"
+	.ascii	"t\n\271>ns\330\022\271pwT\250h\272EH\343\220\263u\225\300v\031"
+	.ascii	"\304<\376<\225-\216\306\fL\3451\250\370\0342&\217\255\320\321"
+	.ascii	"\205fsit\266L\345\321\351\032\233N\344Q\003Sy\f\332):\233Ngk"
+	.ascii	"\\6\235.\263\2114>S\0343\030\333g\021O\213\343\262u\032Y\034"
+	.ascii	"]\030\223\255{t\006\265.S\211\301\350\026\021\271EM\236\325e"
+	.ascii	"\0265\221\306\345\262E\032\333\245RE\323Idl\272E\307\f\027\362"
+	.ascii	"\360\301\025\nR.UH\3604\006)U0\233#\204m\262\231\202\263m\241"
+	.string	"\034\362%\333\247\263]\321:\215O\026G\027=.\263E:[\"\243\221H\271T!\364<:\221\031\236\306\243{$\301l*\335\242e\363\304\223(\250\350^\310\303\223(\350CS\211\301]\036{O#\263\251t\217\310&\nO\242 \241{\\\366\230\315eOh\271\354%\333\226\350\004\260}:\213\232#\222\314\242\2463(H\324L\n\351\365B\036\202\230\312d\023\311l\215\034\236Fg\253BE\321\b\355\320\321Y\202\217\220\033\304l\227\253\253\034R.\325\243{LjW\371|:\365\323\310T\036S\350i\207\224\2566Q\202D\tF\022%L<\225-\216\276$\36384\324\034\201t\372\\\246\262I\344\266\317=\202\204\210\246\323E\020;\202\204\b$\362\270\006\025\245h\223\252\263\3516\207\324\346\ng\373T]#\b@\3561\305\212\237\373l\335#\nm\320\321\331\022\r\035\207\356RD\323y\034\201u\215 "
+	.string	"\271L%;\202\204\210\240\343\320:\202\320\331&\217\255\020\260E\233d\226H.[\245\212\242\335\016)Q\270\316\243\373\364\025\341e\2639\202Q}"
+	.string	"\336$j\235\037\334f\323\371\001\3704\266\356\321=\361$2\201\247\035j\n\031O\2300a'\235\315&\322x\302\204\t>\367xb\250\210i<a\302\204\237k\004\321\201\313T\262\2561\204\313T\026\261\007\002\032QA\013*\230\260\221\036Z4S\270\200<.S|`*\217C\037\220\316\347\007\017"
+	.string	"\370\317\223d\007J\205'\205\207\b\017\021\236#]\032\210\035-\t\3439\302\003\226\245\352\035\002\306c\304D\031%\273\340\321O)\017o\007O\021\335EjI\032\256\254\337\376\330?\017t\007\007\234\223\274\037Y\363\f\341\031\022d\333\r\250j\233\366\317#d\247\311\333T\225\024$\tV\022\227e\345\265S%d\243\004N\020 A:>7:\224|\375\030b\005\3174\211#\243+8&g\216\017\255\254yz\360\364\300\342F\207+\370\245N\033)\226\254\265\264p\310m\036\036<<\202\320\266\262\315s\305s\005\325\224\f\262\177\036+\037k\0263U8\252~B\206a\234\354x\263c\007\213\311\212\016O\307o\232\203\007W\214\034\277;\341\2347vrp\020\177\004\307\310\340XQ\375\352h,\254\25327\200F7\266\234M\375\342d:\255,sl`\305\250\342t#\353\325J\2337@h"
+	.ascii	"\237\346\232\344\256H\005\255\334x\030E\355(\206\241\361\005"
+	.ascii	"*\230#\217\275\\/\317S\220\252\355\315\020/<3\202S:J\224\332"
+	.ascii	"\f\036\247`\r+6pM\300\0329\346\272\200eM\247\001*K\300\232xb"
+	.ascii	"\b\275\210[G\214\224\3610\005\245ht\031\211\302\263\004\305\204"
+	.ascii	"\246\t\214\3400\354\212\331\223\027\302*M\367#j\214\022Q\b\223"
+	.ascii	"1\351\233T\365\334\262v\205\007\t(#J\310\2301<GD$xdtjx\214\212"
+	.ascii	"\323\"C\300t\360\274J\306\334\304\232\344\001\363\206d\246s\254"
+	.ascii	"\324\371\275\231Rz\202\243H\207K\343P\323\302\2438'h\244fMU\234"
+	.ascii	"\272\327\025\357\316s\364\276H\357k\025$\004\252\032\034\376"
+	.ascii	"\"\234\027\357\344\374x\333J\"\247h\247\265e\264\206&\252\244"
+	.ascii	"I\230b\034\266\255\211\327\027\221$\325.\262)\262)\272\t\361"
+	.ascii	"\205\251\330\346E7dk\3324A\373\221\331\235E\251\222\365\221"
+	.string	"y\233H$LJf\2325\035\013\343\013\236\r\272_\227\234\344\311\326\0135^T\336\264\256\262\326H^h\354(\316\021g\020\247vueE4\304\030\332nN\223\255\342\031\342\213|EN\324]\321\f\021kM{r\022\245XF\370\312\t\203\341%k\341\353\305\t\232\342\230\027\345\332L\361\320\221uQL1.\tt\312\231\254\351\214\244\311\322$\353\"\\1L\027T\212\332\327|\ne\007f\207\006\214\321\214%x=\262\216\256\361B\222\2255\007]Q\254*\357\033%\372\204h=I\311\272\330\226\213^\212n/\266\375\007\325\025}\253\274o\264\330\326s#\366\260\005\304#+so+[qM\311\227\230\034Y\007\2330\236\026t\255\313\271\240\261\273\332\312\272\270%\351\007&G\232X\020\315\0240uY\027\325\212j;`|/T\227\030H3\373/f\t\366P@\f\2733,\3044MjL\222\244\235)"
+	.string	"\214\246\264\"\032\221\315\031\225[\361J\335\246\263\"2\246h%\270\005\224b\343E\224b\225 \214\244\244\250V\024\314,\214\314\024\"Y\024\273+RR\2023Z8c\302\345\254\216\020\353\212\223$3`V\026C\206\345M\224\235 l\\\225\031\034\322\262\251\2178d\262\376QG6\207-\353\034E\037!^@9"
+	.ascii	"JU\336A\243\210#\304\013(\337\023\224\253i\021HQH\334S\361\007"
+	.ascii	"\016\250\242X1\314\213H\361H\210\027P>\032HMKE\251\020/\240|"
+	.ascii	"3\342\272\246bE\030W\023\342\005\224\357E\334\217\351\373F\305"
+	.ascii	"\264Z\021\332{\002\265\247 \315(\212\025\273\212>zQ\"\357{\004"
+	.ascii	"d\r\333\321\004\211\335[tR\034+2)\222\025\241\024\225\024\243"
+	.ascii	"\305'\305%\305&XZ\024\333\361\361\"\222b\222\377\364\230\266"
+	.ascii	"\220\260\"\320GF\367\032\305>\353\315\340\236\365/\036\001;{"
+	.ascii	"\222\006M\264H\031\264\257\242\221b\221\265I\\\227\227\254\217"
+	.ascii	"\374\332Gv\025\277\210q\234\336\220\311\372\310\252\342\220b"
+	.ascii	"\220 \230\324\323\220\254\217|*z!a\354\247\250\263\237\242n\367"
+	.ascii	"0J\233;\313\372)\314\354\343\261*"
+	.ascii	"\234\006\303\235\221\030\3632\325Q\3341\364\275oV\033\364}\303"
+	.ascii	"\374/f\025\267\212\\E\036XZ\324*^\025\265\212X\305\035\030\356"
+	.ascii	"\214\304\233\333\364}\303\024\265\212V\3032\036!\024\331\201"
+	.ascii	"\304J\257!\342\304\312O?\005\331~\212#\373)\206\354\247\370\001"
+	.ascii	"G\304]mc\360\262~\212\255\375\024:n\024\251\246\264\222\232Z"
+	.ascii	"W\326Oqt\2438%\206\311\033\245h\343\305)!W\302le]\254\221\237"
+	.ascii	"\200yW\334\266\304)F\205I\263%\353\037\303\354ci\021\252\370"
+	.ascii	"t5\346\312Uq\306\213O\303$E\330\336\254\213NzM\234\">\246d]l"
+	.ascii	"\312Oyoh\272d]\224\241\327La\202\303\312\272\030#?\025\251Qe"
+	.ascii	"J\326E\246\037\227\\$M\r\307\325t\001\242\365\226\365\217Z\366"
+	.ascii	"\217\322\375\027_\f\227\326\26500PJD2D1[GC\212IB)0vx\331\222"
+	.ascii	"u\321\250x\364\2639\007TQ,\225\313\224j+\353\343\263YC\200\317"
+	.ascii	"f\375\213/qK\230'$$Y\367\222\242XeU\220\224\344\250\003$r\365"
+	.ascii	"f\243*\353\035\274^\b\362\362\362\362\346\274\357\321\016^\336"
+	.ascii	"\241\2633"
+	.string	"\347;x'\262f\302\226\216\326\273\340\225\256.Wr\210l\3046c@\262\354v\232T)a\224\344\304\021\222\005i\224\325a\201\223\237\326\033JxT\352\202J\3007XW\272\274!\232\375\232\344\230\275q3T\323\213\323%\313\2136\304*\277\034H;\326\330\f\343\350\2624r\350L\363\013g\325\232\335\016\335[\0312f\262\376\361\311N\232\2354A\271\023\214\200\224\034\275\366\261tg.\310\246\245\340\350\322B3<\323kC;\222\344\214\234\332&G\221.f\244\320\301\311\310\372X\272S&\b\035\241M\023W\326;\t\021\037xYG\247\344p\3631&\310\304.a\271\241\212\033\342\021\315`q5\211\t\236Y\337\240\260y\205\031v\r\211fQ\312z\347\313\316\227\0350'\030\331\355\274}\007L\\\217\016\234\037p\216T\373\001\222\252\250\224\205O\225%T\272$\306\022%\0072\346\224RU4\t\0023\025"
+	.string	"0X@\036\017\311\204eu\r\024\200\fU\300\206|T(M\244\244D\212\231\001"
+	.string	"\001"
+	.string	""
+	.string	"@"
+	.string	"\020"
+	.string	"\002}\"\304\005\257\\\226\343\357'\265:\347k\217#\236\257\274\267F\356\225\215\3255\305\t\016\226\364r\214\225\365\333{\314\231\233|\251\024/3kx\332\210\306\230\376ov\257\013=\223\323\223\310@\025D\330\3167\251\270\204l\272\005\313\202=1\rz\351*\311\337\357\025@\204\343 \002\037\236DG\023\206VB\263\332\244\271>\204\270\244\364W\225k\323\221\257\005UP5#\224`5\277\0020\f\204\227YV\35150<\335\234\231\371\026Hh\"\331\361\366\335\240\300\004@\240X\375tQ\016\003\334\267o\343twh_\276*\253+xP\2179\020H\333`\304\253\350O\\C\330\034\251\253\254*\352kW\370\033h\327#"
+	.string	"Z\370\021\030\312\273\245\364\310D\006x\035\257\207\025\217\344\206\352\201\004\334\\k\325\002\252-&d\233\307\314\222\272\206Z]9~\344\371X>\243\335\310"
+	.string	"\330\"\232\2553M\327=s\020\326-\373uT\001\224Dr\351\202\235H\034g@7\034D\202)\334\215/,\007\f\240\243\023\001\021_\251\005\204\263\032\013\032\331a\2368V\r\335\365F|H\2069\\G\030\016\267D\021\335\005\345\250p\275~7\205\216\324\035\222\224\250Y"
+	.string	"\001M\362\037\231&2(%e\276q\343\254\035o\201\bm\200w\206\301\013AHmF\022\212\257\210O\026\t\224\337\250\273\314Q>\002\371\253rz\204\211^\0260\326\320\312w\037\331\0230\251sw#\237\332\245PA\217\r\346\320\330@\3344B\345\216\370\367\377\200\230"
+	.ascii	"\245\020a\2233\353\037\274\202\206\003\256t\r\305\0071\375s\235"
+	.ascii	"k@\222+\272\360Fr\033'I\352v5\277\234\267V\206 \023\250q\321"
+	.ascii	"G>\3571\234\341\257\024\206\267\022\2110\006\354&9\200\020\253"
+	.ascii	"\202\326$\252\246\032wGP\311\316\315\370\212r%g\232\367\357L"
+	.ascii	"\245\372w\270A(\304Py\034\264\326\n~\n&\274I\271\234\326$\374"
+	.ascii	"\206Vvs65g\347\264\365#:\264@o>AD\024*`\027.\017F*_C#\304\005"
+	.ascii	"4L\r^\332m\323`0\" \247\363$L\231|\227\314\261\362\247;\300\370"
+	.ascii	"\322\366\200\360\232\225\3409\341\273\332\367#\021s\253\372,"
+	.ascii	"\315\375D\374d\341$_\252\003\277K\230\237\f\3500I\313\242\314"
+	.ascii	"Y\304\002\b\250\320\345\232\305\222\007\213O\271"
+	.string	"\306\277\321\001\376\f0\237\247\200\271\213\365\"\361\277k6m\027\263\306\366\030\036\355\264=\227\3201qW\037g\240\247&\336X7\211\272\026\305\257djv\355\265\377\214\331\357'\370*~\005G\022\\\025\340\025\311K!\241\f8\211\202V\261\3148#Q\224`\017\224t\272\027~Xbsg36\3538\325\033V\b\245\324\355<oP\210\246\023\020d!\220la\037E\n\275\345\301b\231\227`\247\337Hq\006\342>b\266\346R\216 \001a\306\362\fe\335\252I\r\n\325m^\241\222\233p\320\016\337\034g\302b\360*\231@\257r\337\b\306[\025\323#\204\242\305\242\275\322\234`\276\356\233\336\021i\303\252\250\273\346x\326\200\210Z\202\246c\026o\n\006\3321\206!<\310\232\377\323\013\303\303\316p;\210\270\0226\265\034K\251\025O\327\n\b\021\r\314\003,}\301\206\355\031Cj\351B@N\006t\037;$"
+	.string	"\200\240}/bwL\370\2371\374j\314F\204^\230\233\204,\203\301~\3141b\223,=e]s\034\035\350J\247\213\330\243\203\2729M0I\013\246\277M\304\352\255K\b/f\016\264Yop\375\255\267\205!\232<\223N&\203\333\006\357*\013\025?\347\\\237\020!\013\270{F\302rlOk\306\2515n\362\221N=\220\352\016Z\322"
+	.ascii	"v\207\242\256Y\313\f`{7'\247\336\3115\357}Ug\320\243*\214\223"
+	.ascii	"vX\307\240\257\242R\206\206\002\311\363\344\312\233\"\214\215"
+	.ascii	",V&\023\325\f]\325\n\324NJ\004\001\361l\372\353\240\030\034\207"
+	.ascii	"\211\232b\367\3055\177V#1\r\302\351 \266\252\334\223\352\007"
+	.ascii	"\337~\326\3766\352\372\376\277\216\276\016\272=\r#\232+N{\024"
+	.ascii	"\252\350]\311\264\221\261\324Ih\016\220v\366\201\275\001\241"
+	.ascii	"\215\321f\360\235\003\233V\256\374\035,\201<\252\255RHzO\001"
+	.ascii	"\277\254d\220)\300P\247\325{d9\031U\227\277\310rI\232\034<\276"
+	.ascii	"U\277\333\247\324\0061O\321\024\315p\t\355\205\374\357PtM*\325"
+	.ascii	"\035\3744\n\276N\364\322]\f\177\262\206\003\300i\267\255)y7\305"
+	.ascii	"(\254V\344i$\346iT~\223\2321 \247\317!\\\370K\337\b\353n/\220"
+	.ascii	"\331\200\r\350\205\350A\035\204<)\021\263\221\347\273L\037_n"
+	.ascii	"\265LE\323\363\376\0224\255i\246i\316\233.h\372\332\023}\275"
+	.ascii	"\006 \t\3565\210)\250\372\353\270Dbz\340\255\025\002\221\225"
+	.ascii	"n2z\366\375J\376\3570\227\236\251\242q\222\004*\3600R\257\241"
+	.ascii	"\005\236\020\225\322\223\373-:\340\\\032\240kx\356yg`\246\205"
+	.ascii	"%3|6\016\364\251F\272+0\246R-\2430\273\305\351\367\333^`&E+0"
+	.ascii	"\210\320\013\321\311|\363W,\371\257n \347\177\244_\266\243\244"
+	.ascii	"\016"
+	.string	"\211\316\245\302\237\002\244yu\217KC\300A\356\f4\3479A~\242\223v\362Q\034E\375\261\250At\035&V5j\313K\264\246\334JXE}\027\232"
+	.string	"z\"\215\337\033\341\0221\376\367vm\037<\tLE\257\277>\244C\325<\322\260D\277VB\277kE\344\321\352\310\bH\222\240tj\rL\241\233\270\276\235\024\221\346\007\"\237 \033\364\321>\2510\b0\215_\304\210\340.y\350\266\326\2152\255<\200\352\250\303\f\005\331\026#\036N\313\306E\221q\364m\314e+\007T\270\206\021\001\336p}\323Q5\365\035b)\332.a\377\221\216\252|\330\322Y\340\253k%\242WL\033\237b\271S@\223\371\333\022\377{\326e\2713h|\221\274\261\377\006D\32636\204\317b\320\251{:\231GW\352\233\332\026\303f3*\350l\253\254\201\210di'\352@:\025"
+	.string	"\236\333\233\364\375\245y\017\372kv_\"_\364(\353\364G\\\347!\203\212\246\3176\234\225\247\244\f.\017\246\360\342ww\377\206\303@z\206\236\377\260\306u\036\221\353>[\021\312\234\375\362\241\303\325/\200\217\177d\235\302\004PV\263\227\322~k\354\003\313\272\250}9\263\314\333"
+	.string	"N\315>c\275\246\036\366\312\374\2530\230$#\0036?2) \007}n5\201 :\001\374\fh\341\326\374>\3665g\331L\363\fQ\354\374]>\364\017'rKK\341\2070\272aE\247=\235\016EGfT\310\234\310\325q\256ty$\026r\035\210\024\206\330\2019\351\003\203H\031\211\007\004\204\241\254\310x\276F\307\313\2320\352\026\260\217\342^\305\221\311\266\025}^\177\366\245@M9\335\361\225\260\367\372\327\")8RZ\355K\321\310\366\332\224dT\255\225\323\365\0322%\256M_\371_b"
+	.string	"\257\323s\013\315\246\221y \022\317Z3\312_!\033x)\355\303\262\230\035\3774\201\034j\217\364t\314\365\324q@\037C\206\304,\264M\304(\032\213\377\016\205\366\251)\324\254q\361\252\201\244\353\250\255\220\333\372\027\347\305\370\211\263\304V\254\247\364\306?\315nNC\203`/\3018\363\332%\231\212\254\210I\235\004\376\234\301+\214\007\353J2\256\313\307\007\t\372(\275:UjQ\300\2543\\\203\344\326\260\3730\241\310\271(I\214]\247\275\310\377!\235Gc+\317G\036\305\235O\3116\233\324X\323>\242\216\212\264\373\365\311ad,1\020\230\263K\317\214\245LN\034\016\276"
+	.ascii	"\346\264\304#e\200?\202!\037 \205)\342\206g\246\357F\232Z\310"
+	.ascii	"6\027\216\f\276\346E\343\222Y\3122y\217\363IS\021{\373T7\005"
+	.ascii	"]v\261\225\177O\334\363\204\025u\357\373\376\025o\265\217\245"
+	.ascii	"\265\206\"\343\344R&5v?}\334\"\320\321\237\342[\3407\203\250"
+	.ascii	"\302\253\327t\250\352\305\363m\216\005\347]\273*\333\251J\204"
+	.ascii	"\204\035\001G6l\224tp\257M\003/\324J<\227\177\266\030\237\265"
+	.ascii	"a\340\373,"
+	.string	"\323]\027\371\342r\007\264\200V\037qh\351\027\213\341\325aT\016\215\245g\224\243?\360\261\017n\330\245\002\357[\343\227\024\255\236\311\226v\233\202z\316\242\350\027\355$\245\310\025\377\246:\332\273Qe,#E\036\274\224\240\020*\013\350\nP\263(\200bJ\334\302\327\242L+\255\230\275C\212!\245O.\333\264\004b\374+\336\344\244\200\032\003\232\274\241\245\202\336\341\265\244\210\301\237\351\202\277*g\024*\\\323\352\020 %\301\247\301\226\233\253*`\222r\003uN\376\030\316\n\350\267\032\301\245\214\247TYO7\210`\215\317\026\366\337as\341\250\333\341\334\320I\340l$\371G\345\276v\306\3674\232\360dGe}s+\270\035h\371m\366+\220\237\306\304A[\316\357f;Z\216\352\034\372@G\250\216\020]\265B-\350\261\216\361\004\303H9\232\321\267K\376;:[\025t(O#\330\374\320},5n\177"
+	.ascii	"\332\313L\371&%\3324^;\372U#\024\234p\233z3[\273a\246\276\036"
+	.ascii	"\364.G\267$\202\251\303\300\2776\030\352*\361\214\250\037\244"
+	.ascii	"\005q\265\262\177\366F\264\340\3615\213?\200\233\301\273VX\240"
+	.ascii	"%eL\274\252C\344\032X\212i^49\247\272\035\277$\236p\250\206V"
+	.ascii	"\243\3634\266M\202\252z\276\272x\340cf\267\b\031\n\376\317@\312"
+	.ascii	"\356\252y-\005N{\275\361\205D\t9\355ImJ\341E\202\360\036\353"
+	.ascii	"B\204\007\247\r\023\216\343W1#\332Hg\300\307\270<Ub\243\227K"
+	.ascii	"\314\336\364\343\371\222\017V\376\260\201\250\312L\223\360E8"
+	.ascii	"\034i\326\216Z\347\002}\352\032\341r\351\321\177\013\251'l$+"
+	.ascii	"\307\035{\274B\243\301\031\311\376\220\001\022X\273\276\252b"
+	.ascii	"P\355\347\001\325\324\255\373r~\316b\032i\314\265\004y\032\225"
+	.ascii	"~\021\201}\240\r\\\363#\032*E\034\f\342\027\355\340\254\213\304"
+	.ascii	"8\n\rY\372\234\367\004>Pb\202\335\332\001\004*wQ\017)J\201\025"
+	.ascii	"\f9T2U\203\222\222\270AZc\373\222DQ\335\305D\363l{\253\224\235"
+	.ascii	"!\214\300M\343\2004\017\b\324\267W'\250|\325m\335\261\343^^="
+	.ascii	"\334\003\264\2479\203\0373\365M\254\272\347/v\353<!\350k\201"
+	.ascii	"\241\nPA\255\214\204vz\"\366\t\311\321u\264"
+	.string	"\250,x\256<\211q\023\326$\001\330\2620A^Qt\210\016$\226\243\247.\001\326\352\203\270\302\324S\206\370 /\360\325\341\2400\006\020\016\1778E\316\346u\355\316\232\205<\035\277\276\030=\376\346)\320KjGY^\231T\300\251\251\005\251Fs\252\222\3525\326=\357h\3413\267\365l;#\f \265\001,\226\037\341b\t\311f!\321\337\310\032\022\375\353k\336(E\361<\\\2312\311\270\330\277c\246<\007\3649g\251\204\f\013\254\305;\210\301\305\206\225\375\221UR\365\2758\350\235\350N\266W\214k\"[\230\332\377&\222\036\311V\233\257}\222\203Q\331G\277\246\350\"\262\0224E0#\332y\021x\337\300&\330\273<\b\203J\215\231QDP\344{\246z,@\352\335\337\230\253\033\377\0045\343\342\244\352L\230\352j\224B.0-@8,M\324\3775u\3036\236ME\002S\347\n[\307T\035"
+	.string	"\304\316\373\235\250q\342'(\306\230\201!\354(\020sgu.\304\3420p?\345\f<\"M\222\361\276a\032\017M\240$?\201\300\2224\257\300\317J\207H\202\341f\323\201\243\257\214(Nt\3704H-M\200\257V\24286\365M%\215\367\036\214u=\374\372\200w\255\306\001Z\035\206\312\201\211\256\324\\\347o`\3721\370\232\326E\222\224"
+	.string	"\205C)\273\313\013\bw\bc\tQ\rx\367T\321\177\272\364\352\305V\320\314\271\0132V\244P\t\335\203.\303S\013\034G\344p\251\0371\244\006T\360\376\243\366(`.\031\021\212F\244v\271\260z1\246\3569\300Me\241\274\255U\306]\016!\236o\306ha\350\237f)\340>\037A\275\320\206bvJ'\357)Y\337\335U\374\210\224=\312V\017K@~\264\326>\bA\257\224\223&\226\222YO6\264\b\2003\311g\224\250\232\023\253\211j\3009\265\326\207\312\353\263\300ts\020\023\225\230\365\330\355\310\177\016x)Dv\301\255r\312\244\213\210\305W\265\205 \210"
+	.string	"xY\273d\001\bT\007\274\207\313O[\264"
+	.ascii	"^\320\224\370\"d\013!\032\234u\250\005"
+	.string	")\363\310^\240\261\335.\243\240W\n\374JV\021T0\345\366_W\326s\307\371-\365(s&\321F\273z\217?#\327\017\260\374\351R\213\222\312\324\351L\024\373\207\320bZ\016\004#d\t1\345\347Hg+\311\032\022*\n,\2337\274\003\335@xT\224d"
+	.string	"\222TB\242F\320\325m\221e\224r\205\230\211\247UV\270`P\022\2121\217\334\366\241\342K2\035'\261\221\225\2629mgq[\302\030\371\200\016\316n\005\237\021\355\230I\002/\374\303\224BeT\2341{H\353\224\262\375\337\177\374\300R\336\244\313\377`8N\036\367\354\343\024#\017'\225"
+	.string	"\b(w\300V\222\367\272 vj\024'3\367\274];\342sw*|\"93\361J\013\016r+|\211\275\217U\034_NP{\243'\317\246\036\340a\215H\241\371\306\231\243\371\201\302fn5~\241\326\037\334u\253}\004R\2368\017K\254\202(\323!\371\313+\306\023\256\217\024\224\232\265\026!\341\3318Ko/\306\005.\240\301h\027\221GA\225\264\035\304]H\360\266\214\274 .4.\211V\340L\034^i"
+	.ascii	"=\306'\200\267\364[\306\302\305\321\244\267\031\027\317&\342"
+	.ascii	"K\322ar\210\275!.M\263\211\223\217&O\217\002\230&\216-[\302\237"
+	.ascii	"v\007\342\226U\272\305\201\016\201\363\005C\035v\375\327\307"
+	.ascii	"\333\035\217\274\031i\332\211\276\340W\263\347z\210\037}\250"
+	.ascii	"\232wX\007\3343m\210\250\237l\346\342\022\336S\027i J\364\220"
+	.ascii	"\027t\274\236\345q\252\257l\0323\261b\254S\030;\024L\241\327"
+	.ascii	"\344<\226\305\240\211-\201\004)L\371\237\266\214\200\r\241\222"
+	.ascii	"\301[;\273~Dm\333\213\326\017\336r\225#\330\177\235a@\034\017"
+	.ascii	"z\371\213\2324\204pw\247\345\217\031@\"\246\254\313$rX}\365\024"
+	.ascii	"\366M\037(\331t?\230\206.g\217e\242W\310p\341K\027\235\033\317"
+	.ascii	"\351\360\344f\354\260\376\302_\266`m\023_\330K\373VU\213\001"
+	.ascii	"\b\233\311$a^\034a\327+H\330/\264\313\213\326\337\0316x\3254"
+	.ascii	"\f\312\035\360\017\374n\233\263\226,q\td\377\241r\334\240M\354"
+	.ascii	"\0218\326IK\007O\021\333p\235\340\306>\226\244\360\341\3701\217"
+	.ascii	"\b\334\264\b5\371S\025\317\200\006\214\224\351\365\230\213\201"
+	.ascii	"\272\215h\245\244\201\213\345\352N\035\251\353\235{\002\242\316"
+	.ascii	"\t\004~B\tU\360\243\200X\214\243UW\342\367Bb\3637=:\243,\231"
+	.ascii	"\246\365\275\265\230\240\340\254\021p\222\372u\306\032\237\357"
+	.ascii	"\324T\344A\243\364\307q]@C \351\351$O\322\274\304\202~\213)"
+	.string	"\316\257\305\321$\3402\261\311\207\364\035\003F{\201\265\020\351X\323\362\021\314\252M\351c\267\023<\333X\242\001w\212\374\033\033\346w=\236B\002s\344i\2148jM\247\344\340\312\020\251\304\323\365\256[v\033\n\371\023\346$\fyN\310\274\216t\227Dt\250\002\2436\213\251\351e>\342Z\006\374\3541&a\"\330EUL\023+T]\260q\b\212\024\254(d\276>\374]\307\016\204\326\211\023\320y\0319\337\324F\210\202\004J>\036v0\327\225\204\031\347\313\305\375`\202=\333M@\334PJ\225\r\2063\207\276H\315\327\355\203\337\236\304\250o+J\337a\357e`\274\374\342\027*\261\023\302=YTt:N\013%\035pD\2418\206K\316\336\2427\001c\275\224b\036S\325\301\020p%\316\216\3761A\212Y\267\016\300\312\022-\226\276YXn\f.\3103\346\375<\333]\367?\340\217\037\241/\007h\353"
+	.string	"\254pG\335\037\005\353;O\220~\001\311\326v|0']\310.\370\365\271\"Q2\232\322\026\241H\344\235p\016\024\313`\2052\006\262:\200\334\216\214\276\350F\230\222\034}\211r\327=\263\361\227g\210\t\3116\234\203\312\232\203\220K&\202\200h\322O\2226K\301\223iB\260G\265T\371\343+\304\004\0060,\270\022\315\352O\227\263#K\375"
+	.string	"\201\001`)\022\200VD\033\274\360C\365\205Uw\355\037\351\306\223dC2\376DaGFQO\230N$\276\334\253=\372\246\247e \250+\026?\354\267{\234?$\316Oh\341\211mhs3\251BD\226\212\035\332\266L1\342r/f\006t\257\322\346l\355\305gz\272\3774\241\033\267B^\\=\264\203\025\030\032X2\265D\253DB\317\261\017<A\330\273t\351%\316i\326\203\004G%\215\002V\242m\016\373(\222\022w\035Az\200\2074\255\226\371\355\356D\2550\256\t\326\354\333*^\252\2421R\335\237q\2247\3369\207\351\\F\342\373`\267\302s\324H\023C\253\240\267\341\266\3308-\n\226\332\303\226D\321\263\016Sz\360\t\206\2617\336\241\220\001\024\314S\377\273\271\3257\304n\316\201\270`\342\334l>\372"
+	.string	"6Q\214JWGJ|H\230\310R\023D\207\2431 \260)2j\317\037\222z\350\003\210\272\244\002\247\3046v\301\3551\335\211\356(\2734\264*\027Y\261\214q\336$K\343\001!q\220\006+\351\376_\304\274O\223:\254\202\f\267x\352\357\336\335~\231u\323\357\022w\t\005\026&}G\024\033\212\270Y\347\266\264\266\003\220\361\027$\030\022\366\3028\365\264\250`L)\005\f\324V\256y\243\316B\366\251,G\242\262\370"
+	.string	"\251\375m\2116uN\030\321FP\375\005\236\215\017i_\"2i\324\337\341\360\310\037*W\200iD\377/\260/\207\250;S\213\216\371\217\220+\211\305\257\002`X \246w\253}PoR\206\356^r\002O\020=\324\033U\246T\374\252\027\250\021\202{{\222\226A\313\255&>\334$I\324AH\367\223\3344\370z\r\243\267\271\20311\312\206\324\206\246\233\002\016\301\326J\266\227JtI\034t@|\225U\306\303}UC\240\267\005\354J\344\031\255\233"
+	.string	"\357\0200)\333\334\376"
+	.string	""
+	.string	"\345\372]\323h\324`?\270]]Vt\327\206\005\202\325o\320\201o\016\247\266N\027\224\351B\242e6QA\247\375\227\024\007)"
+	.string	"~v\207\240\342~2!\2547\017\032_In\263tE\177\345\216i\342\020\340\3556Vk)~\333\001\210O\020\353\341\337\030\312|\277y\204=G\351\374\367Z\376&\301\233\034\025\310\203\026\235t\rmai\331\036ZC\353Mp\212rf\265\324\311B\001\003\271\016kJf\317$\262!\354\205f\007\350\260U\362[\332 M+\306\024I\240\343\330\357\347\036\204S:\362\241qm\2478\335\033\323@\215i\255\177\322\021\212\263\353\005\326G\004'G\366!\241\021%\035=\300\227\264>\035;oO\325\235f\307\371\037`\240\367\363\266\303\336cu\274G\301h\217I\204\226[\245\277\215\023w\2419x\310\032"
+	.string	"\2073\204\377#\260bF"
+	.string	"\307D\226a>\305\221C:\222\244\362\271\t\376\372\233\261h\3675v94\007\321\245\021\r\bv\342\204C$\221\220\006\201\273\214\257k\277H\226=$\240jq\033\260\354\024\252\033f\313\354\271\226\021\b\374$\331"
+	.ascii	"a\352\016(\035\ri\037\032;1\345\372\032\221\265\371\3214\267"
+	.ascii	"\034\224\325]\333\333K\201\341U\036\230\203?\245\241\375\023"
+	.ascii	"'&8~\211\224\232\205F\225<\262BhI\305#\202\332\211\272\243\372"
+	.ascii	"\250\200\022\321\240\323\374p\037\323\327o\237Y7\020\021\302"
+	.ascii	"]\005\207\200-\203\323\230z}g\033\002\021\344\206\277\233\207"
+	.ascii	"*\021&\214"
+	.ascii	"\222\314(u\224w`\344\034:\033A\241\303\350c\0014\024\r\035B\317"
+	.ascii	"\013\225\202\324\201a^\357\\|\220\033\204p\340g\032p\221\035"
+	.ascii	"\005\367 \316\3701f&\364\274d\002\211^\361\243\254\274k\273\200"
+	.ascii	"\n\242\340\317\244\203\326+\277\355W@j"
+	.string	"2\r\300XK\017&\321\204\031\023\253Q{\\\244\2609\202\265\235\327\202G\022\251\246BF\301nAQ\242BB>\013\363x\227\031;\017\366E\253mO\201\233\320\240\016C;\350\327\021\300\204\370b\204\214\213\301\314+\020*\331\b\316\223`5\022\223W\366W\036Q\316\351D\335\303B;\323c\006\270$\023\223t\351\211\304\310\217X\331\263\243\230t\205\205bQ\214b9\314{+=\217d\2573\007}\207E\361\204\nHx0\225\031\346\230=/?9:e\314\230[\274\t\261Y1\244-\243l\334\377\263\266\3266\274\006=\017!z5\032\200\374\202\032\311\367\245H\330\261\345\360\212-\024f\264\021C\343\007D\271V\016\351fE\236\307c\263\210jE\002x\240gI\317\260\314\342\245w\257\361-\214\244\2070\217i1\021\254\021\024\266\005,\266\213\t_\373XO\222&*\005\205\302b\234'\304\314\007o(,"
+	.string	"\364\225\312\\\035\331,\035\231\256\271P\335\f\224\212>\241\354\213^c!\177\205*\025\323A\211\325G\375c\213\250rC\tp\212\360m\266\030\221\217\263 \377\277\377`Fup=\256\201\257\003\365\013\035\023\203J\214\264\344\237{[\311\016\261\262*\232\024\357h!g\245\302\377\023\251\013\332\260$\247\266%d5\266\001&\032/\"\3010\235\317\335$\362-\031\340\226m\321`\246H\"\004:U\212,\020E}}\325b|\f\003\2027\250\231\234\277\233\343\262\n"
+	.string	"\003\203\204w\005\363\263\227\316gD:\357\246n"
+	.string	"\234\247\250GpTj\026\201\216\217~\001\202\237=a\004\265X\247d\264\021K\265GW\305\251q|\022_w,\222q\332\265\323"
+	.string	"A\363\006%\275\366\006\311\331\020\037\355M\377\2408\213\312\346qE\223+z\356\210\356\213\227b\250\254Aj\200A\004e\211\347;Lg\202^e\201\330\025^ \026%@\036\002\230\307\013\225\305\254&'"
+	.string	"\361\"rk\352\024\221b]\374\227O\035\21461\0226~(\350\276Ow\025\340h\247\201$\244\317\224\220\2361\227\246\252\024\255A'\347\260\034j'\317\005\375\022a\335\b\b\372\242e,|5J\276\021\276i\225\325Vo2{\357\304\330\222\365m\225\362>\244\210\265~\024\352\300\353\204\333\273RE\212\340\261#h\033_\323'\t\025%\313\303W\031\022\206\240\033qB)\032l\022~?\203\235\276\006\342\353\312X\247\221\227\r|\001BK\352\242\212ou\367\037u\254\220\307\201\320\323\n\306(\220\373,\262J\223\254\300}\261\002\347\342.z?\364\312\261\315n\017\340@n\364\301Z\031\353e\352\271X\024E/7/\257~\360\345\272}\226\257\325\362B\017`\020wuN\353\211*\322B\365\204.\007\243\251\031c$%"
+	.string	"\207\223\034\317\274\032\313\360^\361\216E\361(\022\220\373G\0273\313\375\275\254\305J;B\264YaGP\345(\255\315\317\271\232\303\221\337\n[Ws-@\322\032\317f\t\226\023\374U:mF\273\277i7\245$\244\373\357\323\267\341'1\211\262sB\372m)\314\026\367\313\273$\333=\277\311A^\255\215>1\323<\362\310\207\343\311!"
+	.ascii	"\353\322\351e\262\347tH\265\n\3173L1\252\246i)\235ci*/\300\013"
+	.ascii	"t\034\3227\366\234\n`\330,\224\302\263Eb\b\322\327\211\363&:"
+	.ascii	"\317\006\300\022zz\305\233\372\333\200\2169jw\272\266h\273\214"
+	.ascii	"r\241h\311\307\315dVC\242G1)k\217S\2539X\375\366\226G\036?p\350"
+	.ascii	"1{\3157\371w\374\r\274A\267I\b$r!&$\341\254\007Q\303\311\324"
+	.ascii	"\356V\330F\f\031\301\352\227\226\367#\033W\321\220\306\217\353"
+	.ascii	"\021\346\222\n\322y\316\364\200\025\354\212\r\037\034h\345i\362"
+	.ascii	"\352\210[\236\231c6\2166\353\274\224g\326)'8b~H\242\311$B\265"
+	.ascii	"]A\3236eO\003\311\035\345\257\032x\376+\032\217\026\211\224\314"
+	.ascii	"x\260\251\032\275GF\315(\t\322r\241V\261\241<F\237\004\026D("
+	.ascii	"\331{\242\254\251\256\265Q\352J\234\205\244\331\344\177=%l\252"
+	.ascii	"\035\341\035\266\303&\341\324\032Va\344\206\301\224gE\377\374"
+	.ascii	"\016U\026\260\003\026\271\274YJ\030\234\327\341\204\341\277`"
+	.ascii	"\030\2676\224\237r\021\3178U\230\275~g\024\306\345T\273(\002"
+	.ascii	"I\2714)\256\207r\352\202\024\337\211\027\004\300\013\375'E\242"
+	.ascii	"\027L\207.\202\036w\372\377\177\317x\352\007\371a#\3446\331K"
+	.ascii	"\033C\035p\232\331:\344-d\240\227\027\r\250\242\363\b0s\177\221"
+	.ascii	"gj\300\371.7\207\372]r0\220\352\201\2749\322gv\002\332\261;\340"
+	.ascii	"c\312\266\366\177K\213\017a#\250C6\354&\031\224s\316\035\032"
+	.ascii	"\210\226\362?#\210\315Sj\\\3317E\037\207\243\002C^\227\271T`"
+	.ascii	"\016\303\272\214\215csD\357\347\250\242\223\246dR\222\003\276"
+	.ascii	"k\306\227q\222\321{m-\366=\222\353\003\t\352D\n)C\206\031\027"
+	.ascii	"\222 \340K\221\037\201\336\002\272\306WS\327\312\"8q\347bW\300"
+	.ascii	"\3066\364\3336\221.n\333\302\261\005@\361\377^\240\355\326\325"
+	.ascii	".\222*\356d\377\354\003\264\022\252\324|dC\2561]5\002\241CI>"
+	.ascii	"\346UM\022O\341\001\025kk:\301\"\316x\256)\215\024\032A\t\331"
+	.ascii	"f\020q\350\0345\331r\332n\212\363\007R\007\226(\302\305\303\275"
+	.ascii	"\304J]\b\261\262\016\237\347c\004]\244\321\221\270\247\003u\234"
+	.ascii	"\037d1\275\021:Sx\233\304\213\217\2241\005d\210\t\3723;\214\225"
+	.ascii	"\025\366\026\0037\237\362\202\354dwF\215K\031\335I\263\264(S"
+	.ascii	"\254\377\005\325\006\304b|\320Yu|\370uI\335e1\362#\272\022\211"
+	.ascii	"5\332\367\313\020\3515|[\373\327YAE#R\312\b\"\366\257\302\346"
+	.ascii	"\"S\231WS\033\245\331\007\311\206\257\271D\013Qc\275\257\204"
+	.ascii	"o\2603>\315\004\322\221<{\372\233\3713\024\022lY\366\016/R\233"
+	.ascii	"\322\021\315]M\202\336\216\221'\266\201\210C\376k;\326\204\243"
+	.ascii	"\342\330\345\312`l\232\245\354l_\203\f\263A\025\354\"\017f\r"
+	.ascii	"P$\326>\342+n\201\266\203OF\006\203xJ\3338(\"vqm\251\336\007"
+	.ascii	"\342u\213\330\214\\\265\335\252R\022c.\2558\027\3143\374\200"
+	.ascii	"O\327\206o)\335\024\235\026\203aA6n\270\346.=;\250\270\220\365"
+	.ascii	"\211\334\332\227![\352\004\232\246\366\220\311\360\324\263wC"
+	.ascii	"KY;\004\212h\261\335\354vK\326\273>\262|$MDe\346\333.\262A\362"
+	.ascii	"\201\2563\325\250M\225\200\242\351\366\007\340\224\272`\233\320"
+	.ascii	"\027\315\345\314\t\350\311\035\2362+\f\n;pR\261u|\"}\221\254"
+	.ascii	"y/U`\340\274\335\332\242\254\360\245\250\225\264O\366\034\206"
+	.ascii	"\210!\235\300\213\\\274]\025\240J\020\276x \271\346wD\n\234\261"
+	.ascii	"\221\351\342C\202\016\315\002[\326s2z\177q\tl\354}%x\251:\240"
+	.ascii	"\307\330\377\323\306\024\231\030o~\033`\200\245\035\316,\213"
+	.ascii	"-\233%\376|\020\310\017H\337\350\032_\325\333\032B\276\025\013"
+	.ascii	"\372\300\322\206\247\227[\255\242\251\214\374\324\272\334\234"
+	.ascii	"\273b>\335wa\354."
+	.string	"\342h{d\334f\321q7\221\033P6\332H\326f\271\301\313\305\002\024\317'\200L \007\277\242\027\212\356\315\216u\342\177:\275\363\037?\033lP;\230\206\363\022\340\314;\232\362}\354\2624\375z<\036\237\035\037o\373<z;[ \027\230\234\2217\324=\r^\205\211xI\356\"\207p\257UG\215\b\320\336\274\313\367VA\032\035\2434$\245\231\251\037\321f(+2\273L)\340\253\354p\310\t\276V&\234\311i\277\305\373e\312\315\351\177\257\266\007 \343N\242\026q\263\333\333\244\351^\340\321^\006\374 \223O*\034\354C\312\035\001\021Rm\013\226\355LPs&+nT\261\220e\272\r\324"
+	.string	"T\\\351N\353w\300\316\213aJ\306ff\206\335\314\203\347\316\020\233{\372\033t7~\315\003\016w\252<Xy\311|(\252\321\352\350;\263?\362\207\236\343\2469\376\345\fvO\t\t\252@\274 .\023eq\211\304r9Z\027}`$\305\334\031\247\031\323\240\315h\235\305\224\306\362]>\351u\365\210\265I\200\3652/\312\362QT\270\231!\232L9\013"
+	.string	"\023f\313\215\023\277\312\215\002#\353\227\362E\315\327\207\346"
+	.string	"D\006"
+	.string	"\235\2419~(W\354&;\267\020U\216\220n)\347]\f\351+s\366*\r#$_\331\034\214h\266\b\246\036U\202e\221\304\036\243~\337\264\370\245\024I* \203\322sh5S\215\3455\355j\231/&\345SD\0235\3138\\\273g\277 \\\017\364\323\035\376Z!7\243\024\223]\244Q\302\316\224\273\272&\371\216\225\345H9\206O\356_1\347\215[\211g/h\316\373$\250\344\243.9*WB\262C\276MM\376b\324\203\016\262\221\233\322\236t,<\305\344\202\031\020\212/\025\212k\006\272\366"
+	.ascii	"\215\313\0302\b*c$\376:\032\007\311\\\365\023\326\277ce-a\020"
+	.ascii	"\264\260\363\236\312\004\260phC\303\241\001\306&\351d\225\274"
+	.ascii	"\264\215\030\322\340\245\307\255\277\2015\202\243\030\264\215"
+	.ascii	"k\307@G\350/\345\263\360\016&\033?"
+	.string	"\006|\220\216`\331\033\257D\241\\T\037fZ\035|\313\02251`\321\216\204i\215\272\254.\025\016S\240\235\362U\220\273\2254\315\017\025\006\331\216\230w\2376$\262\275\313\360:\277\255\211\311\273\225#\002\254D\363\307\334P\357\336\314\360\357W\366X{\364'F\200\266L\177@\244\332\214pWi\366\275\217w\334\377\0021\371D\030h9&\371Dh\274\366\036\306b\t/\261i\324\261`uQ\"\302\b5\037\372\275Od1\365\341\"\236\375\024qY\205\357\3628WQ\330\002\275\205\361\243X\347\277\355B`\267\311\357\202|\242\025\230\320\363\274\227\302\035\310\356n\260\314\277\361\254S\216\ts\204=BR\244\020\314s\023\bG\020\336\262}s\344\341_\255\003\222\020\347+\\h\223^io\b\020\353\343f\257\255\342\353 t\036\340\3104.J\3723\342\032\222mY\261l\013\246\327\307g\357em\326\tp2"
+	.string	"T\\\202\276TK\240$o\274\243\304Y9\203\262\007\026\rB\354\304\225\364\017\223\371\177F\223C\235\352\206|\034\243\202X\007z\031\301:\002\351\022\336\322\334\365\260R\b\216}\364\217I\202o)\347\336\277E`R\356\217\277\332\0244\327N\213\021$\301\245\340\363\361\337\2511|\371u\221\003\377\237\373\376\022\346\330!\260\353\257\216\030/\r\366T\342eTk\032\266\207`\365%\177\276F&P\306,\026\202]\231\365\321\013-\243\274\351\204L\300\237\261I\206!\314^\304\323\363\334\032`\370\210O\220\225\027\200\376\021\017f\346\021\331\210(\372\202\036\301d\355\307L6\305"
+	.string	"wCG\344\324\016e\276v{\233\007J\373\313\265\200\354\026,\365\213\352\377\312E\0177\007OoV\bo\031\305.\325\326\031r\350w5\2457V\"\301_W\030\271*\306\033\232E8\027\310\225\356\017i\374\023s\336\366*\323\232{\340\345\312\225\355\035\317A\247\303~\352\2073\251\313"
+	.string	"\300\242\0011\375N\3328[\254\006\2003\"\211\240\255\f\rG\321W\244\235\225X\326\214!K3\317`$\b\216@h\361\017\330\226k\235W(\267\005\253\026\t\314\214\326.\237\330\005%\210\202\376T\250\367E\314\257)d\032\337\225DL\316\226\244A\270\214\247\334\2770\007#\320\033E\312\257\240\314\253\236\241\374\225^\376\365+"
+	.string	"O\260{(\261\bN\206P\312;KH\204\325x#:\247\366\272&1\314\246\364\021\214O\257RQ\340&J\032\261\367/IkN\276\320dY\325\223\247*\357\021\013h\246\277\263\355\317m\017\300Kf\3558\n\027w\351\036\262\353\273\005X\267\242H;]*\002"
+	.string	"fuDp\276\231\256;fg\215\211\003$\317\343j\205OE\272h(@1\244>%J\3244\236\307\037}d\336\217 ~\334\357\345\201\262\036\204Suck\342N\351sVS\366\373\225?!%\256u]\3537\352\260\037\336~\r&\376\255L\372\272\227i\347\232\376OO\355Cm\223\206\374\377\n\222\323w\3209\005[\037\233\301\335`\003\350\277.\3058\217\245\277\251X\231\204\315\315\364f\360\347\034\316\330\335\205^\244m\342\252m\336"
+	.ascii	"\261i\024\3468\205\3676\226rCQ\306b\313\251\341\277g\351+\204"
+	.ascii	"\272\036\236\377C\230\317\332a\335M\366\213a\247\247\371v\377"
+	.ascii	"^\024\346\366\266\005\242v\333\316Oe\212\247aX\\\347\331\334"
+	.ascii	"\016\225yW\372\277\352\374\262\350\233\250\036\201\031\213O\262"
+	.ascii	"\2032v^\037qp\226\342\\\215\372\251\354\033\257M\233\242Of^\367"
+	.ascii	"\216\350~A\376G}\251\\\t\027,\370\225a\373a\304\250\006\315]"
+	.ascii	"\321\345\007\252k(\271\245\277(\275Q\2303\252\221\013-\372\273"
+	.ascii	"\306WE|W\372\277\263\261\022d\354\027\353\177%Z\261\002Uz\273"
+	.ascii	"\326\200\f\330\203)^\276\342\023K\335\260U\246\205\257\032\363"
+	.ascii	"|\206\317:`~/\211\272\274\034\275\006\300\277\"\330\376\033\340"
+	.ascii	"\371\232\364\240PtW.>\002,\257J\232\3033\336\177"
+	.string	"$\371r1\217\b\357\360\032\363\374}.^\260\302\273\310\327\337\344yKz\267\312wX\324r\231\"~\364\375x\252\316\325\317;B\277n;J\016u\237\310\363o\215\373FWQh\007\202\346}Z\177f`B\216{\252y\301\326\026\223\257\t\317+\361g\03262\277G\226\247\224\262%\311Z\246\230\253/\262\027a\006\307\330&7'j\377R6\217\375x\365\n\034\3271J\326\256\334\261\231\177O-[\366l\326w\306:Tw\276^hC'\254\326A\335\210\031\330\317\367\2248=\247\370\361,E\344v\032=\017\316\345\3068\252u\177\3343\377\276m\271\356\353\213\313]\210\034w\275'\212\373\252q\257\211\377\352/Q\300\357\031\2605\211\375\310\230\203Z[\230\3709\373\242\003O\233uB\355?Z\375\0239q\354\177Wm\007\201\257Q|\232\324\306;\373\356\222\267\357;\335RlwF\360\247\372\3613\3616"
+	.ascii	"\365\357wp\024\314vl\370euf\353\357K\020\365J\0201\214\3008\033"
+	.ascii	"<\327\016~\"\361\025?\016\265}\036.O\266\354N\223\213@\031\230"
+	.ascii	"g\016`\302\177T6FM\372\2147\207\032\375?z\332\366\244Y\013\310"
+	.ascii	"\237I\354\361\036P\025\302M\n\356\331\3657pl\337\320hd\017\343"
+	.ascii	"Y\233\231\274\\\225\347\322\347\001=\317\326\217\3079"
+	.ascii	"p\300\224d\177\222|\207\207\221\316\223\202\310\365\205}\255"
+	.ascii	"\312\024\341\373\217\3773(a\263\321\235\254\276\374\277\256\007"
+	.ascii	"\341\353\346\035\244`\005\312\247\003B\255D\333\242\035\277\357"
+	.ascii	"\364zA/\214\364\340\332\246+\336\277%q\256dn-\371\254\312'-\371"
+	.ascii	"4\342\342\225\306(\2557\325\341\320\nSp\212;\257?\265\354)\237"
+	.ascii	"7[s\320\303\267$I_e\242\237\261\302\235B\352:\227\347\367\267"
+	.ascii	"\016du\203\260\351\277\260\267\217j\256\n\370\2334\355Y/,\253"
+	.ascii	"0\347yr\312\312\021"
+	.string	"\312\331\355v\201\341o~\307G\323\331\210{\225W\007P\311U'j\360\337\001\334?\332b\271\"\373P\347Enp\243\256\275\320\271\233\351\023\t\366\264\351\312\227\376\017\253f\334o\373ju\271\274\375\264\230\213~\233\242\347~\307Ga\261\213\205\341\221\326\037Vy\352\r\335UG'D%\265\372m\023\013\007\023*\275\231\337\242p\262\252\2672\343\203\305\\\246\304\021\342f\303\203\213\360\004\364sR\363\\ \3545h1\373\240\364\210\266\3715\236U\316g\270\306\345n\250\256Q\273C\2017\233\376J3\263\327\007b\321\337\n\217Vz\025\213\0273\017\353m\215\332\3751\227\317\274Y\306#\347oh\3561\340g!\177X\231\356A\212\007\372\232O\217\206i]2'\233>\0138\377\364\244\365h\227\376~\356\375\300\211>\300i\265\215Ev\207\343\251\n3Dct\217(.\365\315YK\377\334*\223\234\026\247\240\374"
+	.ascii	"\261V\356\261\034\344\343 \340\030`~\007Z\371\217\374\241m\177"
+	.ascii	"\344\372#\003\013#\026\275B;\234:\247\021\235\205\271\207\222"
+	.ascii	"/|S\326\275\374\030\234\016\367\224\370\224\250s\365\321\320"
+	.ascii	"\024~\242\327\233-\317\274yA\360\016)\373\255\274R\362\357P\371"
+	.ascii	"gy\036\331\326\264g\336\257\021\f\247E\265\364\234\312[\"\235"
+	.ascii	"\371\222\356\273\370\003\275\023\335M[_v\275\301\374\372\362"
+	.ascii	"\323\223X\006\356\3336O\033\347\261\307WX\247\231\214\346\204"
+	.ascii	"\266\271l\374=\201\023w\351\260Ji\307u?E\204]s\370\211\316\200"
+	.ascii	"\335\371U\032\311}\224\245T\266\217\346\346\313DP\003u|\325W"
+	.ascii	"\236a\030\027\03592\033=\225\026\r\002r\206\376\367\fh!U\317"
+	.ascii	"\201\030G- \312W\222\001\365\017"
+	.text
+	.section	.gnu.lto_.symtab.1c3cb0b27440c682,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\007"
+	.string	""
+	.string	"blackboxGetFieldGroupRateDiv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\007"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\007"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\007"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\007"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\007"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\007"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\007"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\007"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\007"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\007"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\007"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\007"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\006"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"blackboxFrameBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\006"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\006"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\005"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\006"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\006"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\005"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\006"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\006"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\006"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\006"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\006"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\006"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\007"
+	.string	""
+	.string	"blackboxCompressionEnd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\007"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\007"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\007"
+	.string	""
+	.string	"blackboxWriteSlow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\007"
+	.string	""
+	.string	"blackboxFrameEnd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\007"
+	.string	""
+	.string	"blackboxFrameBegin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\007"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\007"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\007"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\007"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\007"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\007"
+	.string	""
+	.string	"rcSmoothingGetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\007"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\007"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\007"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\007"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\007"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\007"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\007"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\007"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\007"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\007"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\007"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\007"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\007"
+	.string	""
+	.string	"mixerGetLoggingThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\007"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\b"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\b"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\b"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\b"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \b"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\b"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\b"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\b"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\b"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\b"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\b"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\b"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\b"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\b"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\b"
+	.string	""
+	.string	"blackboxCompressionBegin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\b"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\b"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\b"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1c3cb0b27440c682,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1328 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.a051db850553e998,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`[\001}\t"
+	.string	"\024\017O\002"
+	.string	"\036"
+	.string	"\205\301\271\373\016\016\002"
+	.string	"\001\002\001\002\002"
+	.string	"\262\245\306\300\017\006\002\003\002\003\002\004\002\004\003\240\342\234\212\n\004\323\347\247\373\006"
+	.string	"\005\006\236\376\250\313\b\002\002\004\002\004\007\267\344\272\254\r\b\350\300\306\254\005\t\233\226\323\235\r\n\252\245\243\035\022\002\005\002\006\003\002\006\013\f\361\304\326\306\016\b\003\002\006\r\342\203\351\365\f"
+	.string	"\016\310\337\226\335\r\004\017\366\332\262\341\005\020\357\350\332\204\n\002\002\007\002\007\021\346\371\265\305\006\006\002\b\007\002\007\023\363\323\275\211\n"
+	.string	"\024\216\243\313\354\001\002\002\t\002\t\025\252\212\212\215\003"
+	.string	"\026\242\247\237\212\013\027\213\215\316\230\r\002\002\n\002\n\030\353\206\240\252\016"
+	.string	"\031\340\253\276\213\016*\032\245\277\256\207\b.\033\311\305\223\252\f\026\034\253\356\273\246\004\004\035\324\230\357\263\006"
+	.string	"\036\274\320\320\213\f"
+	.string	"\037\240\342\234\212\n"
+	.string	"\031"
+	.string	"H\021\006D\200S6\220\301b\001\265\316!H\2525TS\020yv\273p\340\240\b"
+	.ascii	"\325-\\\306\0069\032\002\273\233\bH\001W\272\264\005\246(+AA"
+	.ascii	"\276 \353\\F\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"\265\005"
+	.string	"\342\205\022\035\240)\215\001\377\377\377\017\377\377\377\377\233\366\277u\277\3757k\373\204l\262\t\221R\246\024>v\254\007\371\253\301\330\\\374\212SB\204\177X\317\021>Q5\365\206\302`\005'\001"
+	.ascii	"\243_\217\314\345\254\262\255\326\355\226i&\217\0044 \300\002"
+	.ascii	"\251Zm\006\013p/e\230u\213\322o/5\360V#D`\270\275\220\221=\n"
+	.ascii	"\021\022\006`\001\200\216\253\341\026{\317\n\230!\316j\032\226"
+	.ascii	"\375^\350\302\001\3063\273\"\022\022\214\222x\264Dw|Hq\005(\236"
+	.ascii	"\313\005Q\357j\206\261\302-(\334\253\r\367\202\326\355\0300\222"
+	.ascii	"~b^:\207 \303\b\341\031R\270!"
+	.text
+	.section	.gnu.lto_.inline.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`6\b\215\033"
+	.string	"6%\202H\260TN:\371;G(\206Kg2y\006\375\2359\006\324DCw\036\333\374\272\267\276'\\\f\215\256\350|\033\n\177\202\207E\257!\347Px\203v\033S\370S\372Sz\343\250;\033\204#\026(\232\255\366\267\344\357\235d\nf"
+	.string	"x"
+	.string	"n"
+	.ascii	"k;\366K\237\346\346)nWL\240\254H\210\013I\213a?\273\335\216\032"
+	.ascii	"e\3026\214\336\315{rVE/\277\036F{4\306\330\354h\357\354$\347"
+	.ascii	":\236\222L\300&\304&OIA\237\245\275\216\266Cy{q\346\336\266\261"
+	.ascii	"\\\337\017_k\255\236\255s\250\333\221T\203\333\246\337\257W\347"
+	.ascii	"Q\267#)\030\233\305(\n\002VFCt\213\347H\317B\325b\007\037MEK"
+	.ascii	"\302\005d\\!\220\023?\340j\350(\235B\201\345b\346\0016\013\250"
+	.ascii	"\371\312\030\212\003,\020\026\356\306\274m\212\303\216\230\001"
+	.ascii	"\330\265S\325ZYVTv\275N\361\326\213\023s\324Z\351\312G;\210\037"
+	.ascii	"\234\017\314\351v5#\346\024\332\353\354B\255\225\307\236}7\250"
+	.ascii	"\326zb\031-\016\321\260\301\343\373M\354\311\252\272\311Lcl\001"
+	.ascii	"\240\204\270\302\310\b\022\365\004=\301\231\023i\341(\342\342"
+	.ascii	"\371\3529s!XMJ\250\247gx\244,\"K^\374\351O\232k1\t\321\345\371"
+	.ascii	"\325a\\\252\265\276\374W\277fu\266Z7\203LF\214G%\030\337\312"
+	.ascii	"x.\373b7i\351)\370ue<\177g\360\035\303\035\343ne<\372\035\277"
+	.ascii	"x\226\242\266\026g\026\357zH1\022\221K\022s\001\216\bh\221\346"
+	.ascii	"\250\370\300\224\337\336\362\263\374j\007\332\3004\344\305\362"
+	.ascii	"\003-?\232X\245k\241tK\320\322\3468\237\023T\322\240C\351YX\033"
+	.ascii	"f\351+\254\275`\351w"
+	.string	"Vzk\021i\204\323Q\002\267x\243\223\020W\325\226\310\021\375\3209\210\r\200s\327\237 \204\250\202\005.+\372w\360\327\007\227\202\332u\311\255\021\336C\003\220\237\026O0\200\251\250AIfd\306F\013R\2174\006p\002!\"\"\353\022 45\006\262\030S\f\005#\"\024\215\214\226g\235\034\\\305`\336\317T\nNdev\240{G\263\035B9 \\\325~\242#\226\350\303\241j\210\006\245\370\206\212/$\313\342E\341t\2671\004\021\016\243\307\345\204\351\022\262\220\355\001\307\220]'\222c\243\023\215\366\200uX\332\344\354:\002\004\331\260\034\312\224\032\331J\370\003\220\215\274\3178\037\310\267d\240;\021\314v\220\027Y\225\006]\323\205$\346\023\030\221\374\313\246qp|\274\220\357\317`_@B\323\212\336\370\256\263\362\245CwQ\207\315\331w\241\274\304\005\027\306\017W\033\b\344aao}\262\026\322i\267"
+	.ascii	"\375\n\304%\024\300A#\201\364\257;8\035\320\3259:\263\302\022"
+	.ascii	"\177U\277\366 ,\351\376\236\361\361\277x\316)od`\352\233\223"
+	.ascii	"X$ N\273\200\230\n@\360Eas\237\360\351\227\232\343`\346>\323"
+	.ascii	"\213vH5\006\205\362\355\256\003n\240a6\360Y\230\267\363f\226"
+	.ascii	"y\232}\t\204\201\336\314\300Q\245f\231I\016\\{!\034\025\340\027"
+	.ascii	"\370]\003\036V\224\204\223\301%$\272\302\320 \263xg0\327\313"
+	.ascii	"\204\305Es\274\bJ\235\220\3514'\024\325\224\201\3253\323\320"
+	.ascii	"Fu\202\241\242s\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\257\006\305\017"
+	.string	"\346\223=6P\205(\3510AWUU`\370\bA\326_\\Z\243\252\235\231\231\336\373\307E"
+	.string	"@`\214\332B\244b\314\"X\251"
+	.string	"\005\376\201\327\031\242\325\036\241\366#\217\220\235d*"
+	.string	"-"
+	.string	"/"
+	.string	"W\366\213\267\030o\304\004\231\253\036[9c\016r\017rx\023\333\325\333u\207pW\202\337\326\342\003s\314bz~\326K\t*\002\005\217\256\332H\004\223\202}<B\036\354\275wk\203\303C\031X\353\017!\230\354\251\346\331\332lmj\033\255k\336\320\272\006\034g\234\275[\357\345\204eo\360\326\357\267\306u\rfB\"m6\235\316\031\217q)\n+8\365(\251B([\376q\377\021Y\220\265\024\013c#\204\025\034?m\333\314`\302\204\223h\317\241\311\034\300\\`\322\227&\360\200/\036"
+	.string	"\343\236\322U\032\005\030-\340\257\311\322\337U\345\367D\2265EiN\b\315\035\007\255^o\250\021Y\205pH\223l\354\031`\"!Vv\033\022\200\322\211\006!Q\224\"##\221\004\022N \321LfiRm\256l\257\250\033\371\032N\264a\270\007\312\266\250L\260\247\276\310\265k\252\372:\300D>\005>L\273\202\373\b\203\261\327\260\243=\034l\003\324\253x\006|\034v\024k\f\310\350\340-\300\262\260\300\021\375\002\276!\331!\225\244\375^\353?\323(2j)\362G \2104\304\005\2678\350\253\3766\360\3334\347\260\242\306\033F\305\206N[\003\n'\327.Y\337E\352\314\365^0\245\3457z\216K\217B\004A\371O\213\324\250\241v\234n\037\t\311\376\3111\t|\220R\213"
+	.ascii	"\2501q\346\212\354\212\327b\021w\240\220\025{\211\340\342\337"
+	.ascii	"\365\315\356\224\267s\333\036\374\026\251\324\02762x\031\315"
+	.ascii	"\330g\3710\312\315:\323\272~\222>\324\226\271\3608\361W\373\277"
+	.ascii	"\375sf\253)\031\310\003"
+	.text
+	.section	.gnu.lto_.pureconst.a051db850553e998,"e",@progbits
+	.string	"(\265/\375 SM\002"
+	.string	"2E\021\034\2407\215\001\3778-_\375\377\317\252\352\272\375\377\375\377\377Nj\"r\"\"\211\024\031\216\360\203g\360\n\236\362\b>\360\004^\300\001\336\344\222<r\310\037w\274q\306\027WT$\216\370\341\322\r\027\246\314,\021"
+	.text
+	.section	.gnu.lto_.ipa_modref.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\215\006"
+	.ascii	"\202\306\030%\220+\303\001x\367\345\256\203\361g\377_\3562{\250"
+	.ascii	"?\277\273\272\355\370\301\242\255\353\0066\260h\215l\377K\231"
+	.ascii	"\002?\013\206\262\336]\335\b\344B\352\261cj\2642^\274\307\033"
+	.ascii	"[\025R\206\2052QAL\037\376\032$WNI\271k\t\003\301Gl\302\361t"
+	.ascii	"4l\323@U~\311\025\212@\200\251\331\363\0232 p\202Bwv\224 y\202"
+	.ascii	"\361\246\335\233\026y\232\017\300\253\243\026\341\016\273\301"
+	.ascii	"t%x\001\325\005\03352\375\373b1I\013S%pI\267\304\324|\217\215"
+	.ascii	"\320\220-h\2577\302@\342\031/,\344#$9L_\004:(\300\253\337\016"
+	.ascii	"\332u\004\347\314\312\263\263t\302t\n\006.\231\027\214\253p\031"
+	.ascii	"aY\255\231\031q\0063\200\""
+	.text
+	.section	.gnu.lto_.lto.a051db850553e998,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.15.a051db850553e998,"e",@progbits
+	.string	"(\265/\375``\001\025\016"
+	.string	"\326\031]E\360\260(\035{;\226\"f\364\026\\\007\237\t\233!\304@\262\200\215\301\216\315/\005\023]\266\n+x\373_Ad\bD\255\330\231\036I\231\232\315\005Ods\233\321\374\006\016\265#\234\002\342\331,\330\354\336R\246\024H"
+	.string	"C"
+	.string	"N"
+	.string	"\273\037\002/\310\036\215\262e\374\203\355\203\024-\230\032\273\253)\207\243\036\241&\312\177\354\034\235\227z|\035\002\360^W\350\341\362\320ux,x\300F\005\215\307\236\030\274U\246\247\301\356:;/\303\335\271m\007\266A\366I\0046A\311w\217>J\347\361\nb\261\021B\2259\366\227J\335`\037\256\256\330o\371\263L\307LCM\253\246S\323\017\360y\341\021\263\353\312\271\2614q\305\007\333\377\330\316\264\023(@\275%\305\272\253\302B&\366\311Q\244\024\250\331]\0066\351'D\006\300\036M\274t\320\240P=.Z8\252%L 51\357f\374\246\316UU"
+	.string	"\314\314\005\225U\316Xp\201P\275\212\\Z\260\362\3066\311_\\RA1\314}\204)\333]\020_\304\277\022\237\3451\233\311H\350$Z\302GH\211\024\201\033\2256\b\0258\221\310(4\"\322J\244\020\2116:\225h\037\006\314M\330N\032\005\216;i\237o\017WW\034c4*]\305\216\214jo!\371\316\004X\232r\246Q\365\005\243\205\243:\354\306F\006f\352\036"
+	.ascii	"`\251'\023\272\231\006\306\203\265\254\275C\325\0068\370a\"f"
+	.ascii	"&\032\b\004V=\256j\263tq\037\026\301{\253\220\241`\230\002/:"
+	.ascii	"\026\220\231U\001,\224\222\004\242\302\3205\034t&@\225\032'\356"
+	.ascii	"\\\317v\236\322Q\243UP"
+	.text
+	.section	.gnu.lto_blackboxCompressBlock.21.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`9\b=/"
+	.string	"jT<\022Gp\230N:[\373\343?+\221>+\347\026;\3224\351\0366\313\215&\242\262\333:*\246\254F\344\022\"\336\032\216\020\333l\357\r\226\357\3459I\371\263\235f0\357\234\261\025\231\r\001v\260\311\f\255YB\b!iK\031\032\001\372"
+	.ascii	"\020\001N6-\266\323f\016\343n\322N\372I\337\261\020\n;\321\266"
+	.ascii	"\316\352\307\337\005\273#\2739\026\025\352J4\231[\232i\333\346"
+	.ascii	"\004:v\262)\314X\272653m\333\026;e\b\354o/a'\212\323\216\265"
+	.ascii	"\251\345\265m\233\304TW\211\211'T_\346\226k$a\335D\3219m[\303"
+	.ascii	"J^\3336\223\270\211\355\224\233l\033\351#a\314N\264\371v\346"
+	.ascii	"\344G\306dM\333"
+	.string	"\266JA\335\243v\212\366\216\332\351o\360\363\371\364c\203\274>\237\317g\243\315f\024\r\353\341\2150\bdW5E\177\303\270\343\330\300\224\235\245\350!\r4\031}\203\3760\257\2445\0273\031(\021_\333\230\276k\241\037f1\256\220-/y\203k\rl.fjzd\227\025\262\201\266\354U\257!t\301q\206\006\332\262\325\274N\333\330\316\320@[\353\024]W\300\340A<[\201:\365\231\221\322w}\225gb\027\205K\353\367]\243C\226{egi}W\252\266m\371\226\235\2415\023\233\271\03503\007\346u,K0\311?\364\334S\300\272\210o;\270Q8\313\320t\333@j\037\375\277\220\245\3357\375\357/\311 E\277oc\027\335\3527M\222)v\237\214\364>\330R\213\323[\237\231\363\202/\235\302\022\217\354O\305}27S\334\2731\267\332\367\354\301\257\301\374\300\252A\025\325\224TT+\351f"
+	.string	"\365\324\315\356&\246\245^\322\275\240\361\232\217I\306\"\222\202#\243\242\3642Q_N\240^F\320t\315C\353e\241_\016Z/\037\370e\003\277\f\224^.\320\227\t\250\227\177\326\313\003\332\256Y\200\317z9\300/\367\3742\317NCi\326\371\345\034\3662\316z\031\300/\023\323\313\303_\276I/\013\357\345\240z\031\230^f\373\362\252^V\273\2569M/\243}\371\352\345\233^n\bMT|\312\264-\214\247_\273%\225\322\243\361\272\351\272\353\272\355\272\241\3501\013\231;\nw\036\013;\305\343\306?\271\270\201\266m\333\262\005\"t\361\fx\201\377\347M'\360k\364\037\2437\370\235If\325\243>\340\275\266\246%\371\007f|\3251\254\355\275\311\336\212\263\225\223N\274\324)\250=\223\314"
+	.ascii	"\007\360\250w\032\262\264"
+	.string	"\236\007\340y\316{\2762I\376\211\3414;U\236\257m\222>p\236s\241\271d\030\236\361m\301\371\222\0309\342\213\007\3407<\2215t\226\017+\037\036\0233sh,W\303$Q\342\332v\314\311J_\311B{\307\226\332e\235rs\251\235\016\277\362\341\025\221\023\376\206\273\212\207\017\254\t\265S\341[\271\006<\203\007\337\311 \307\003\337z\235\242Q\003\243\242H\027p%\243h\321u\330\020]7]\206F\300\331\3374\352\233\276\276\231\350\\\3259\323),\325$\231b\351\335\370\004\\\224?x\277\3011\357\322\221\256\35488\271[]\355A\346\026\273\350J~\366\221\212t\244\026:\346\262\214\335\276\251\266\276\031\350\335\232\235*\322\037\\*\\\335\001\271\345\245%\001I\342\013\230\225\216@ra\241H/\022_\016\220\\Xl\007\344\226\227\026\b\365\ny\265\001E\222\370:g\035\267\274\2706|eyii"
+	.ascii	"\373\302\372\220u\005\002K\311\213\353\252K)K\304\b\245\343\021"
+	.ascii	"\177\205\320\022\241\204\374\372\022\241$l\266\375\032\034G\204"
+	.ascii	"y\363tF\205>W\240\340\352\232-*.6d\242\260!]D\241\023\375N\004"
+	.ascii	"oz\002\237#\360\371S\320\323\013\371A\235\rJ\231lxI\037\250\213"
+	.ascii	"=67\301\244C]\311\301\342\323\340\321}\212\r\365\245\213.\302"
+	.ascii	"\27310\007P.-\366q\310\013\020fZ\354$T\b\025\340\024\273\006"
+	.ascii	"\310\213\224\273\204Z\004\356\274\357\032\370\006G&e\372\321"
+	.ascii	"\225||\3475Pn\356\312\330\355\353 k\374\020k\364\235+\231\215"
+	.ascii	"}<\325\323\324\264D\375\300\247\226\006~\340\330@7p\364n\350"
+	.ascii	"\306\006\272\205\2652\027x7\3568!<\326\252\367\033\220?U\352"
+	.ascii	"\306+[\257\201"
+	.string	"a\204\310\255\r\316\250zt\243+\235\035\200\254\250Q4#\221R\310\314\314\214hR\322t\200\002\031\262*n\021\360\2513U[\320\354o\364\303\007?5c\330>\201t8\354[M\b\337\337\032R\240\305\222&N\327(\207\002Dk\244\260&\023\002\020|l+d*\350\224\362\350\342s\2760\216\230+\202\263\265\334\304\227T\017\225:\277;\223\242\367\"\270\031H\274H|\270\2157\302d\033\324P\24193-\307' \300r\327E\355\025>\342a$MK\272\027[c|E\305\325\202em\344\304z\032*\277|\002h\321\240\375\214L\037(\274\376{\327\372 \023\243\212\211u\243M\215\013\306\206\344\213%\240y\232\254\205\220\212\225\224\240\033\261\2600\371a\271\003\264\211\003\"\375\206\351\247\305?\257\265\235\b\267\323\027.8|t1\354\031Q\322\r\374N\225\212'\234\300\3534h\r.\024\243a\263\024\252t"
+	.ascii	"\005(gS4\3124(nX\201\0245\023\005T\362\005\227\306?\267d\342"
+	.ascii	"{\222\215\206\232dG1\260\020\2257\0346I\211\0230\360T\013\366"
+	.ascii	"3%0\202\206`\002\347R(\300\334N\336\340`{Lo\252\211\037\342\303"
+	.ascii	"\007#q\372o\221`@\3630\362\030j\355`\027\225J\354:\001!\231\026"
+	.ascii	"J\005"
+	.text
+	.section	.gnu.lto_blackboxCompressionBegin.22.a051db850553e998,"e",@progbits
+	.string	"(\265/\375 \367\265\006"
+	.string	"2\214.4@O\324\001x\211e~Eh\201f\377n\217bJ\315\037\331\237\261\364!\nB\345\245L\016[(\f\b\027:\f\303\317\221\b\352e\214\250@:\320\266\275S\n\246\322\302e)TzU\t\022\225b\240S\0035/kr\230\024\203\230\022\201\353C\205\315\210Z\261\031\205{\211q>2.+\235\244\360\237A\276\310G2\237\303\023Z\274\367\307\327\240?\007\026\036\030!-]\334\330!\027e\206}g%\306\226\006\031\r\213"
+	.string	"\312\356\305\346eS\236\223\016\333\217\274\331*\0177\366$&\025%\232\335\235R\343\333\343\346\037\344\001\336\307=\002 \354\256\243\367\201\267\274\355\001\333\005\266\301\t"
+	.string	"`\2517\023\260\2003b\305\027\272\206\247\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_blackboxCompressionEnd.23.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\025\t"
+	.string	"6\020>: \345*\035\340\034#\311B\306q\001\204\203bl\201\201\250\bJ+1o\221R\016\213\343Ww:\360\240\304k \177\210^\001\210$\210\210\313m\017\bs\001do\264dK\231R,"
+	.string	"+"
+	.string	"-"
+	.string	"I\362\317\372\200\367\225\016\005>\2560A\266\022C\360\241`A\252\304;\353\311\361\2352\003\030v\327\351}\036\367v\333\r\266\025l\303\002\245T\021\373pUe?\375m!6\2039H\331M\325\002llc1\261}\215I\366\313]\253\375\013\266\2012\333\335\250#'\035j\276\300\310{V-}E\223\251\250G\231k\347\345\202J\232\375\326OF>\2115Dy\357\233/\312|\273\032t\264\204\264@LY\263]\001\3466\020\240\317C\307\201<\016\031]'\202\343Ht\"\350\303\231\210\\\250\"n\020\334QxB\321\242\353BQ\343\332\303U\225!+\006@f\322\023\314\244\003\017"
+	.ascii	"`\2517\023\272\372bd\r\034\206e\201j\037\244\210\210\033c\b\320"
+	.ascii	"5<0\004\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_blackboxCompressionIsActive.24.a051db850553e998,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"\202\f/5@o\222\016\230\016\217\267u\200R\003Ds-6\177\200\017|>\276$\342o7{\bQA\227 \037,7c\034Eg\b\365\247Jgau\217n\255}\262e\nW\233\005\353\243pU\226'A\342\3520T\234\206\316\263>\034\207Wa\020oC\360\365\340\301^\304uaO\263e\235\t\235\300\310Q|E:\222]\217'@X\255\324\005aJ\241\003\300\030\341\3517\021\272\215\357%3sg\372qt\231\023\225\200\222L\322\251%S(\223\217?\364\232\013\fBg\335:H\325X\251 a\311\334\236\343hV\314nCz\001\311@\321J\242b\006!3G\255t\321]\377\201\377\340\267\b\b"
+	.ascii	"`\251'\0230\2013b\342P\356\032\262\204\310\341\316\231\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_blackboxWriteBuf.25.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\t\001\345\f"
+	.string	"v\330WC\020\217(\035 \364\b%G\350W\317H2(\326\375G\355"
+	.string	"\314\021\335\275\t`\332l\271ox\r\335\320O\2232\252\236\314\035\320\217\376\""
+	.string	"\020\240k\324\335"
+	.string	"|\243`\037\001\326E\326\020!{o)S\nB"
+	.string	"B"
+	.string	"C"
+	.string	"\330\005\304Cs\366\313\273\225\375\312\302\311\312\305\356f\312\201K\356\360ir\276\3500cJ\371\303R\256\217\300I\003\f"
+	.string	"\323\350m\\X'W=K&\223\314\213cw\235$\023\312\035o{\201m\005\366\265\267\036u\247\246\257\311\240H\221\321\332\275\320z\261,h\302\203\355klgw\026\356)\2370\306\356\006\025-\273\253\341\004\330\341\346=\355\203x\b\356\250\t\017\260{*\321\262\333i\370"
+	.string	"v\350\356\003\342aZ\262\261\2744\252\rA$O2T\021\202\225\230\026j\222x\355\250V\2142\306\376\352\"H\374\016\2160\222'\215\304\303\353U/\200B\002&CI\266\354N\224\252\362\202a\364\301z\262\237\372\257\243\376\370T\rB\036\332\007$rB\234\216g\317\206\207\366\321\261y\264\017\003\t[\307\201\207\003\322\311\264\017NH\346\001\211d\033\031\336\036|@Yh\333@\231\246\333\353\311\346(Q\023\250*\016\271\352\231\021.,\n\006XT`yy\251j\311/\243f\027"
+	.ascii	"`\251'3`\235\321.\006\302y\233\300\336\254\032\007\256#u\275"
+	.ascii	"\"D\215\b&\036\201?L\270.\343*k\330c\230\027\b\f\256HSS\200\273"
+	.ascii	"\244%]S\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_blackboxWriteSlow.27.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`b\003\025\027"
+	.string	"\306\350\217J\240\024R:\005\316\273p\257\244\210\203n\322\264\202\234<,\373\373^\214\246(\270\345\203sc\035\273\304Bso\373;]L_\355\360Q\367/+\254\235g\347Sxl\030Q\343\235kA\036\271-\230\r\354\326\377\215\220M\344N)y"
+	.string	"o"
+	.string	"\200"
+	.string	"\216\235\316\230\3559m\027\005\271+\371xk-r\202\252\025\212\305\013\\\247\316\331?N\f\3267=\365\232\212\324Ze\013\342\271\277\\%I\307\2359\277\234\275|?\335_*\256rV\346\3300\024\373\365&Y\316T>"
+	.string	";\234r\3708&"
+	.ascii	"\002\203\b\311\017h\034 4\302\367\342\317\\\222_\320\230Rk\275"
+	.ascii	"\360S\303\2177g9\253\265z\372~\300\033v\333\036l7\260\267\006"
+	.ascii	"\276\221\337\231\"\217\237i\3046\315Y\334\\\265\326\027\277\351"
+	.ascii	"+j|\244S\337\340\346}8\362\364[.\355\310\032\356\346\226M\344"
+	.ascii	"\315=\262?\3265\262\313i\2239]B\247as\272$\247Ir\232\316\351"
+	.ascii	"\221N/\235\236t\372\002b(\252V\256j\025\332:R\251h\024\t\333"
+	.ascii	"\367\227^\344\371\320\013\274\342\261\257\342\304\236\017Mw="
+	.ascii	"\222N\355\036\007>\006\260j\255\f\354\230K\311\240\004o(\235"
+	.ascii	"\356\231B\020\315\035\267\264\352i\355\332\270\275`\325\270/"
+	.ascii	"\310\177#\347\356\226VAE<\333Nc\306\334\013\317\022u\225E\367"
+	.ascii	"(\306\r%\030\365Z\232J\032r2K\366L\207\232\340\252uw\337\213"
+	.ascii	"\216\371\013\231\026\254S\027EZm\336\347\024\240\325\031\266"
+	.ascii	"%\353\"\002GO\3132\204I\301q\217\234\016{\321\266?\265\200\355"
+	.ascii	"\213?\260$ub\326Zu\0336\f6\264\035\352Z\013\r\316\215\002\256"
+	.ascii	"\206c\223\311\200\233\251\251\321lfd87\332\215\254\246cA\326"
+	.ascii	"\202\300\270\n6\035\331\005\034NG\026#\356>~\215\034\244\240"
+	.ascii	"\332-o|\021\230\345\332\017 \374\254\316\344\226\373\236\026"
+	.ascii	"\271\013\364\221E\264\233[\256\223\271\362\017/\214P \350\263"
+	.ascii	"\001<\225\240\002Z\335\313\034\322$@\226\t\235\020\035\247zU"
+	.ascii	"\216\217d\t00\344\251\311\236\370I$\024,\022\016\221tm\357|*"
+	.ascii	"H\250Q4C\025a\210\031\251 I\223\244\031\003\220\002\031\261Z"
+	.ascii	"\017\021\260-5T\224\324\260\033\240IS\261\036\354@p\234tj*$\255"
+	.ascii	"\256\224\304?\0014\277\307\323U\030\231\217\357\337[p\2133!\361"
+	.ascii	"<\023^\232\231\253gGT\377\363R\310\004W\340u\326+7\201\f\t~*"
+	.ascii	"7F\207\212\346f\034WW\215\231\336\2240 \222T\250\031c\263c\231"
+	.ascii	"\222\033\363l\310\223KF!p\2619E8%\274\020][\201\262\241v\025"
+	.ascii	"L*\354O\314q\212\317\210\332\031\262\207^\254\2756{\361\366="
+	.ascii	"5"
+	.text
+	.section	.gnu.lto_blackboxFrameBegin.28.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"u\007"
+	.string	"\202M25`\215\032\003@\303W\0378\240a\261\302\377wE\005ju\023\006\352L\233\277\311\342\r\360\307n\324p\265\265m^\360\022\320J\215\026,\005\362\305\266\266\267\224)\005\3150\003\255S03\215C\32007\007\231\006a#\265\216&Af\233Gb\001\235\n\234M.\314\271\311\353\273\253\307\321\200\210\251\213\020\205\367\330\243\303rrB\371Si\031\314\361\301\220\376gj\ro8\324\026\266\372"
+	.string	"\202\366l\325\240\212\255Kw\302@\351`\252\375B0R\264\256\036Gmu\205\220`#\277D*\345&\013\344\242\255\257r\255\211?\322]*\211(\241\376\313Xa\316\220\253\235\341\213'\n\031Z\004\376\027z\242\t7\272-@\333L\333\217\r"
+	.ascii	"`\2517\023\272\371\201E\346\016h\003\342\373\224$T\025\206\256"
+	.ascii	"\341d!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_blackboxFrameEnd.29.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\037\001\315\f"
+	.string	"6\027UC\020q\224\016;\0212\200\020+\006\310\001i\263\\&\022\r\"\006Kb\207\365\264FP\fR\004,\002P\311\353\317J\255I\234\331z\345;\233"
+	.string	"\"T\212\003H\003\256\036m\3175B\362\224}l{\313\235R@"
+	.string	"<"
+	.string	"B"
+	.string	"\363\227S\266\214\203\254}I\350Q\022\356.\246\027\236\272\324\230\362?rL\347\251.+\\e\201\023\02542^\207\004\360\241\241\373\3678\301[\305\310q`w\035;\217\302=o\033\201m\216}\013\001\323?Y>U\377]\323b\301\341\343\342\212\r\256\242\206\330\227\273\273V\020[\243e\214\326\313\025\276\300P\354~\254\330X\223\271b\203\355\373\036\376\241\336\301\nTDv\367\372\264Q\366\365\372\017\037\361\271\354r\357\376\031t\021\241\r\214\317\020\237h\024\337y\200\004UYU\252\001\f.<n\234\225r\222B\275YT=$1:b\212\377Y{k\273\354.\307\007\017\302\344g\3704\204S|\367\3166 R\210\201\226\221>\013\"h\036Q\326i\340\301H\241\316\b\313J&lC\300\232\203O\t{\240i%\354\002\271\313U\020'\250a\302\351\312\356\374\304\026\300\304G\256\231\241\022\242H\r!y\211M"
+	.string	"\213\004\246\325B\004%\023e\032"
+	.string	"`\2517\023\232\223b<?\n\020\202Aq\203\220\371\326n4,\260\305\034me"
+	.ascii	"\254\333U4 \343\321\205m\260\212[@\f\250\250\210\013\354\020"
+	.ascii	"N\270\314\006T\210\227+\304\245\233\252\235)\232\202\002"
+	.text
+	.section	.gnu.lto__putc.30.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\305\b"
+	.string	"\246Q>7@\217\322\001\t\214\032\343\\J\030\377\rn\376\337x\310k\023\245\226\226\263\326,\025\b\374\264A\256w;2\306)\215\216\204,x7\366\\@\216\f\372\023B\210\224)\005-"
+	.string	"."
+	.string	","
+	.string	"\3174'\320\236\371\263c\036Ev[\271N*2\273\0135\344\337\363\363\237r"
+	.string	"T\252\364\334\034v\327\211Ju\334z\333\007\266\033l\277\0043\333\312ZFl\177c[\323NP\370\0363\254\273 +\254\335\345\230\341i\337\344'\337Q\f\363\201]U\tk7r\274\240y\346\370\002-\244\213<\312\006\033Z\3625\365\252\327"
+	.string	"\022\226\223\313\224/;\226RW\366\261\335]\253\312~\374U\323\211\245\257\tx\270\300\327.\307+\334E7\327\221\350B\021\036\327\201 0\274\317\004\347\241\370\300.\344\251\200\334\210\004;\b\366D\240\021\264\360\274\021\334\304=\266\252\362\303G\313\244\032\3362\325\016\n"
+	.ascii	"`\251'\023Z\375\002\213\013\016\314\261\3025\340U\230\241\240"
+	.ascii	"B\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxPrintf.32.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\335\f"
+	.string	"\306\030YD\020q\233\016\b\205 \"\r\n\204\210<\022\231\030A\350\231\t\n \344E\321\0245\210\365\257\256\0014Z#\307\351q\373\317\323\355\177\376\347\306\f\200\n\"\270\366\021\n\340\356\317g\341\355\034\276\033\250\221\275S\nB"
+	.string	"C"
+	.string	"E"
+	.ascii	"\343\311n]`\006\327+\327\313\266\277\342#\235-\203\252(J\017"
+	.ascii	"Kx\210*\273"
+	.string	"\233!8\001\353\025\365\001\326+\032\276\373\354\374\213\247N*h\200%\357\023@\204\335\365\004K$nz\333\tl?\260\037\"#Vn|(U\214\024/\371\355\373/>\332\230I7q\203\020\223\310\310\356b$\033{u\273\363Ec6\311]t/\341\370\202\370\220\020\206\220\273\037\227Wvp\275z\201O\373,\336\242{\355p\001\273\246\207\261\341\\\273\337\301\354\376\330\361\314\203\026\375\370\213\254\201R\222\036\324\3635/\277\311\305\f\007D\200\266H\303<h\213\r\225\222\374@=\273vLz\302>\265\324dS\323\326\353O/\003'\021\220\020\204\316\250\033\332\2069\362\\\240\3360\233\017\307\002\267}4\0258p\231\316\246a\310d\037\216\346\311\266\220(\303(0\007\322\204\262\021\307\2052\254~\267-\nJ9)\311\217v\230\203\3325\001\201$\231+\266Lm\273\370\t)\247\222\364@=\007\230\024(\r\024"
+	.ascii	"`\251'3 \f\033\263\260:\023l\020\254\013L\267\312qL\004\300z"
+	.ascii	"0\302\262\3145\274\345\026p\033b\355T\030`\b\237\"\007w\237T"
+	.ascii	"+&a\222\001"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.33.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\341\001\325\020"
+	.string	"\266\337nE"
+	.string	"\321f8\374\370\250s\002{\001\336Xh+\233\177\036\017&\364O\261\317-"
+	.string	"\f\210\376\313Z\271\253\231t\360\317\031\307\326Z\3404\r\277\204ndr\253-\217(8.3\305z\312\336o\363\305\350M\366\2262\245W"
+	.string	"S"
+	.string	"b"
+	.string	";S\023A\247G\334\255\021\371\346\022\322\267\037\bw8x\332\177\235\207\365\036\020\037\260\2333\004c7\034\361\002\3227\207/0\372F\372\307\350\233Y6\321\303\025\373\240\027\r\254hw=\3259\353\311\362\017;"
+	.ascii	"\320&\346\311\225\354\256\023\264\271\271\365\266\023\330\206"
+	.ascii	"`\347Jy\320 \343\216b\b\215\261C\231T\025\366\265\335]k\216\255"
+	.ascii	"\245K\017\377\356=?\247\245UK\247\226>\201\220\"\327\t\035\036"
+	.ascii	"\255\021.\211\231\216\226l\213\321\342?\277}?\3501\273\363\313"
+	.ascii	"\201\314\300\365r\275"
+	.string	"v\267{\261\273o?\314\235\357s\027\254\377\300<&'y\360d\364\355\312\245 \032qZ93\227\036 9v\f$\205\n\207}B\016\234Q\374H\f\235\376\205\205\013\244\335\326A\357~\f\305\224\007K\372\330I\342\r\331(\322h\214\003\244\310\017t\030*d\004h\253\244J\243\214Q\024\321\300\204Grj\253\276\022\b\004\334\310\270t\354\026\032\331-\035\002&\017\351\242\322\240(\225i\245\371D\242\262Je\370N+\024\312\207/e\303\311\304!\305[\245L*\357\304\322\342\221(\360\267\202b\361\\\276\217\305\353\302\326\265\325\034\233\360\310Z*c\030m\027\305\203\377\374\242O\316\254J\343 \216\324\253\252\n\315\354\214\274\244\251\232\215\031\227L\316\354\317\370\220\004\237\205\003' p\202\021d\306\003 \352\215B\337\033\003\352\305(\020\327<\202\f\025i\316o\254@1w\205\241QZ\027\2160V\333\027)P"
+	.ascii	"\300<\b8\323\253\025k\273\201\027\313\265\036\327X\356\n\235"
+	.ascii	"\007L\255k\306\230 b\027(H\024\334\343\230sh\216\2035\"\300\243"
+	.ascii	"\200\227\027\355#\003"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.34.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`3\001\215\r"
+	.string	"6Z\\B \217\223\016}\306\251\006\236\242\232A"
+	.string	"\231\253\215\005\321\240\023i\b\213\355\fp9\314\026\345\210\375m[_\205\301\313\216\325f\272\321\213\201\220"
+	.string	"hb8Yb\273\301\270ha\363\r'\"B\366\2262\245G"
+	.string	"G"
+	.string	"G"
+	.string	"\006\331,nZ\331\237Vh\"^\354.\246\031\f\023\364\b5A~z(6.\364\b-R\212\006\r\216\004=P/,\367\236(\334(!\207\322\365\336a\207\016f\343JO\013\301\356:7\256\302]\335v\210\355\003\366\2656\205\322c\005\365b\305`k`:s\275\373\255ww\3244\324\264f:3}\r"
+	.string	".R|\250\330M\371b\326%\262l\270l?\355\1778\b\320;\023g\354^ Qb\327T\300\0060\0367.\240z\204\017P=\006j\230\226FE\361w\223**\207\005\017!N\234$\n\356\356B[\267\211*\352\245\037\336iB\312JU\233\244$\277y\343DCNU\375\210\357\007T\327\324k\245Q~\216zU\320}ZJ\224\237\236ZH\234\252\212\003\235\222\221M\204hN\007\003\217HH\306\361t\026H\310@\032p6# \230Gd\343"
+	.string	"\343|H\260\016\002\316\036t>\030\204,\373`\227i\017aTM\002\030\027\221\216l%\314(\324{\347\360Z\264\224F3\352\334Z\210\362\213\252\342{\307\210\371(\350\025\031"
+	.string	"`\251\2473\020\216\315\315\276,\206>0\222^\314\353\030mpV\241a/l\r\325\022"
+	.ascii	"\205\031f\243@D\313\035\026\323k\261r\261\226XM\t\356\305-U\252"
+	.ascii	"\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.35.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\355\007"
+	.string	"\242\31776@s\322\001\030L\3023:\362\373g\331V\366Z\263{\235W\324GDF%\240p|\224\317 \226>\344\t Q\026\"\346\317\266\034\323\342\017\253\226Z%\233H\231R\031\305\350\252\200\306@\016\232\250a\303\264\214\341b\013=`\327(\0245\321\005\0211\216\024A\005\336\"2.Nl\033\027=\250}\265j\362\302HJC7\314\311\253-A\312\177\376\300T\265-0\362\3375eBR\034\352\331(/\265\304~\265\273k5\331?\375\232\351[\001\"3\n0\273\03776\233\2022(\036\333O\373)W\351~\312pg\227\344%fw\r|\3009\374|\300:\254.`\035\272\263i\216:\331\273xt\264\324\354nT\223w\317\316\377\312;_\311{\002$\354\256\363+\201\334z\333\004\266\021l\263\004\n"
+	.ascii	"`\251'\023\332\370\002\307\005\003g\030\001\243.a\021\253\321"
+	.ascii	"\340./\332I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.36.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\307\001\365\020"
+	.string	"V\341qE\360\320&\035\372I\376:j\343\342\016\201\026\317#\363\233\016^\037\222\305\220\177:G\354\260\367\234U%\320\r\225\354\347z\205#\235\255\210\226\340\031xf*o\026\344\205\356k\224\211\003\243_\204Zi\264\275\245L)]"
+	.string	"\\"
+	.string	"Z"
+	.string	"N\200=\232;\001\321#\366\001\242G\253l\033\347r\366\036\006\230\236\033\273\253i\007w|\337\367\035r7L\325#\324T\371</\340\311h\271X\036a\207\213\314\007\017\227\013\034\031\022z\275{\306\270X\tC\320\\\337\375\200\327\265\\4\317\216\005\273\353l\271fn\321m_\260\335\300\316\007V\230N\230\276\207"
+	.ascii	"\0223\034|\2732\037\216\r\212/\020\367\371\355\373=\367T\256"
+	.ascii	"\302J\363\363\024~\347\314>n\201\261d\300:\257FhwA\036\315\300"
+	.ascii	"*v\366\370\314vrG\241\372\216[x\264\313\241\006\320\356\206X"
+	.ascii	"\001\366\370\001\237\366M\374\204\352:+\017\260{\363\002h\227"
+	.ascii	"\013\t\t\325\367\266\n\371V\246\367Nzi\bjQ\026\373?)'\230\007"
+	.ascii	"\177E\364\02516\253\374\234:R\325\277\214\2007\f\3215\365/\""
+	.ascii	"X\3719\352\365\335c\215\307\002&\307*?\325\316\205\213K\025\307"
+	.ascii	"\346X\371\221\234!!\353\215\035\323\031\351:\377\350;?v\237;"
+	.ascii	"f\032>\003\247\243\240,l\246\250RJ\245J\321&\221\b\250\023\204"
+	.ascii	"\315\204*y\220\262\221\230\230J\022H4\324\2514A3\245N4\021\003"
+	.ascii	"\336(\224\2444\224mKi\031\267\272\336\370<\307^%\202V\312\212"
+	.ascii	"\212\343\221\215\222Ti$\310\243\306`\032\365:<1Zr\350pw\027\032"
+	.ascii	"\301\243\222f\274\356e\003\200\314N&\371\226?F\001# `\002!\310"
+	.ascii	"\214\007`\365\304\300\276#\353\026}\266\226\313\"9J\306Qn\234"
+	.ascii	"\266\266Q\232\231gnrM\007\314Vf{@\313\366UW\261|a\2635W\0270"
+	.ascii	"\304\b\302]Ia;\342\250{\3310M\244\025\313\322.\343D\246\031j"
+	.ascii	"\343}\211t.\361\004"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.37.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\326\001M\021"
+	.string	"\366!tF\360\320&\035\372\305\275\177\322\345A|\235m\346\232\314o:x\315$\213!\377\3248\224\376\327\262\336\204\0307T\262\237+V\307+{\025F\312&\262\033r\177\230\ne\301s\020\233a\352\303:\324\2324\262\211\224)\005`"
+	.string	"]"
+	.string	"["
+	.string	"\036\210\031l\217\366~@{\334n@{4\313\246q\357f\017zx\331\271\261\273&\025\341Q\030\206\3413\357\316\222\365\230i\262|\235#\350\tz\301V\036\263QK\f\211"
+	.ascii	"\260\226L\244\210(\366\357\t\003sefb\346\372\357\n\300\360\005"
+	.ascii	"\233y\216\034\354\256\363\005\223\271\265\333\326`\033\202\235"
+	.ascii	"\003\002\326,\235Y\372\002\n\374\310\210`c7&\304\261C1V\342<"
+	.ascii	"\277}\177\347`\312]Xg~R\354\356[\370\2379\363\030h[\331\260}"
+	.ascii	" \b\242\335\375x\364\003\247\330\334\3439\333\351\235\005\353"
+	.ascii	"9\0062i7D\r\237\335\005q\203\355\321#{\332W\361\025\254\343\250"
+	.ascii	"\234\300n\215\220\317n\007M\272\374\253C\017\276\024\3430\304"
+	.ascii	"\242+\3164\352a\330\177\201ra\033\341\253h\207\241iiIU\357\202"
+	.ascii	"\"\357\030\3325\365.'\\\031Z\323\353\277\307\016=\337K\216V\206"
+	.ascii	"\252_P\013L\325\306\366\\y\221\233\"\"k\215\255\245;\270\343"
+	.ascii	"\374\245\347\374\244\363\334Z\246cLg\317\251\237\2502t\250\230"
+	.ascii	"rZ\255N\321\250\220\022UjB\207R\221H@\351F(\240N\025FL\252\324"
+	.ascii	"\311\304\204Za0\205$pg\201de:\351\272\225\211\363Z\327\032_\347"
+	.ascii	"[\fh\250\245\256\2506&\321(\247:#?\256)\fI5=\216\216\020K\026"
+	.ascii	"=\333\335\315\274\340\232r2`\350\362\001@v\224\244\362/{\224"
+	.ascii	"2\252\003$ `\002!\310\214\007`\365\304\300\276#\353\026\325\266"
+	.ascii	"V\317\"9\n\311\242\b8\035\336Fif\326\334\362m,\263zpK\300\345"
+	.ascii	"\031\367\301VB\256\032\n\310\3034\213i\335\222-[MvK\304\021\367"
+	.ascii	"\302\360\233H#\226\240]\306\211L3\324\306\373\022\351\\\342\t"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.38.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"M\t"
+	.string	"vRA90\345(\035\r\360\217.\bK.\270\314T^s\326\202I\217\234B\030\247N\307\377\206#\220\341\r\370\034/\026\354g\216C\rB\023(\366\020`!\371\242\252?\331\233H\231R."
+	.string	"/"
+	.string	"."
+	.string	"7\210\207\371\202x\350\317f9\fdo\022\242*\211\331]N?\376=?\377\257\007\254X\247\347\326\260\273\316\025\213\343\326\333F\260\315`_ 1\323P\323\232\226\326L\247\246\257!pY\351\264\354n\314\002l\f\246\210\330\376\306v\246\375\221\223|wa\030\356v\274PvW\301\013\231\303\201\267J\214\252\332\001\240!K\345\314[\246\332%S~\345\203\f=\371\232\372\250W\315\t\214J\206\312\231\r;\245z\330\327vw\255-\373\256? \223\310c\001\335q\"F!\b\257\033\201\036.\274\217D\347\021}\270Q\3103\301u\244\022\307I\260G\001\"q\025\236G\3426\260\275\266\354\360\022Ci\312[BM\241\252\226\t\f"
+	.ascii	"`\251'\0230\217g\340\002\277\225\034.o\034\252\367\300\304\253"
+	.ascii	"]\006$VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.39.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`|\022\355Q"
+	.string	"\252\214\370\035J \224RI\007\035\303u"
+	.ascii	"\200.\0268\260\267\277\317\364\327nB\253\177\226n\304\266\361"
+	.ascii	"\247\351\345\247\357?\324\201e\254N\351\243\376_\236Ss\375\300"
+	.ascii	"{\037\370\336\327\277\3519\257G\267\322\357cgg\356vw\373[#\204"
+	.ascii	"$\231d\321\001\226\001\324\001\272D\256*\221\253I_E\"W\217\310"
+	.ascii	"U#r\265\350\253D_\035\"W\205\310\325 r\025\350\253?_\365\031"
+	.ascii	"W{\306\325\240\313X\201\343j9\256\222_\035\275\372]\335]\265"
+	.ascii	"Y\260\361E\rK\033\334\343\304\315\026\376\362\3147\244\021^<"
+	.ascii	"\204\235\306\246\263\313\330f\324\020M2-y\276\b\001D\217\215"
+	.ascii	"\372\214\032\r\235\332I\221\305\3153\034u}nU\370\b\232\274\345"
+	.ascii	"<\247?f\324N\252g\316\265+l&\b\3069\2100\227Q\273\240\230Y\260"
+	.ascii	"NJ\237\2359\347\224Im hRj\364\252\332\315oa\206\373r\321\234"
+	.ascii	"7\020\301f\316\270*\275\0214\251qN*M\006}T\232T\rS\245\343\270"
+	.ascii	",\323i\336\206sU\3149\257\236\003T\222\336c\234\265g\fs\013\250"
+	.ascii	"''\026MLKJIHGFEDCBA@?Q>=A`I\216\3370\365\0139q\312\316\304\334"
+	.ascii	"\002N\215\227\205z\363\023\rNWX\004M\001\323\304\203K\224(\326"
+	.ascii	"\320\334\314\344\003\231\222\310lLI4\347\374a\\R\343\345{\343"
+	.ascii	"Ff\r\355\315J#Q\227\221\206\332&\001\261p@\343b\244##-:l\021"
+	.ascii	"\020k\rm\213\211\332\302\230e\331!\032F)!\354\"\214\331\226\025"
+	.ascii	"r\013\002by\001\003\004\304\232\263\016-Z\242XC\203\363\017\027"
+	.ascii	"G\0011\003\026\257\231\311P\0025\261C\232\272X3\203#}F\242\264"
+	.ascii	"\221\306\022\317\306\266\307\005\016hW\034\004\216RK\230Y\031"
+	.ascii	"n\271VL\n\235\tG\2519\347\317\331\n;\2168\336\306\264\t\235\221"
+	.ascii	"\215/Cw\3470fi{\243\361\214\272>7+\326\320\256x\201XsN\335\262"
+	.ascii	"34\253\224Uw\252\352\017U\"\265c\231u\317\001S$/\370\007'\016"
+	.ascii	"\371\221\033K\335\006\251\234u\036\357\201w'\244B\363\224\250"
+	.ascii	"\362\006<\233\336M\312\236\273\313\366\3340\340\325\t\325\312"
+	.ascii	"\265\332\225Y\277\340?\332\334\021Ra\036\306d\271\202\034r\223"
+	.ascii	"2\030\f\336I\233:B\265\261\225c\247\b*\306\263i\0167)\3133\221"
+	.ascii	"\333#[<*\345&%\371\362\026\252\235\374"
+	.string	"\347\f\213\352:'&\004\267\250\277nb\332\236\353\277\205bF\253\233\322\337[\030fl\377t\310}\2431\f1\177rq\350\212P\366\357sN\261\237M5Nl\355\027Z\350\022E\177\203*\225)\3042)_u\024\213y\206\201}=Q\341\253K\276\252\344\253I\306U$G\306\325\022\276j\304p6\327WI\370\352\226\207\260j9\215\225\210\351\254C\204\004\t\001\004\233\261f\331\214\365\203\257z\360\325\016\276\312\301W7\370*\220\257j\340\325\037\273\352cW{|5\203\257b\360\325\013\276j\301W+\370*\217\257R\340\325\tvu\307\256\352\370\252\004_\215\340\253\020x\365\201]u`W\261\276\232\303\253\r\354*\003\273\212\343\253\013|U\201r5\001r\025\001r\365\306\270z\300\270jc\\5`\\-\340\2535\274J\300\256\322\330\325\253\257Z}\265\352\253T\345\352\024\271:\203\\\225A\256\306\370\352"
+	.string	"_\025\240\\\205A\256\006@\256\002@\256\276\370\252\013rU\352\253Q_m\361U(r\365\211\\u\"WY|\265\351\253L\344\006rz\323\306-F\357O\250F\265\227V\304\320\331\232\224\006\334krzd\213\247IY\300\r\250\361\002>\326\205a\251A\343\\'\300k|u\032D~\365 O\004\371\327-\204aL1G.\316\231<xn<\330 D\345\216\255n*}V|\236\3429\217;\324\340\277\252{\312u\207V\306\340T\335X\334\334QM\235j\306\247\356\260i\257R\306g\344\260W\031\3432\006x\214\001n6n\352\364\274ID\021$"
+	.string	"\214\013\020\300a"
+	.string	"p\251\007Pe\f\n\2778"
+	.ascii	".\376\342e\237\213\227k\242.urnX\\\302-\036\365\321N\230g\fN"
+	.ascii	"\213?\311\273CL\363Y\250\247C\331\253t\372\323\307!{\225,\356"
+	.ascii	"\324t\026/\233n6yu\210in\274I\340\001\371,\323U\223t\255\313"
+	.ascii	"T\212\354b\272t\246{\315\260\250\364\243/\335\311oX\345\366*"
+	.ascii	"\223\256\204\364\244C\301\031\026\241\364\005\221\0165gt\241"
+	.ascii	"\037\235IoX\005\310^e\321\215\210^d$<t\242;\255\201\003\366e"
+	.ascii	"\034z\323\034bZ\320\205>\372\225IA\303^%\320\203\356\241\225"
+	.ascii	"\237\003\335\303\"\024\237\377\0348G\230g\f\354\213\317mD\336"
+	.ascii	"\0351\315x>\342\215\330\372\375\234\215\317^?\265\241\234p\353"
+	.ascii	"!j\354\311:\0310,\274\312 \234\370F\255\224\016\271\327f\313"
+	.ascii	"\346\334S\333\215QB\253\266|\2315\344)\225\322\t\316)\246[6\211"
+	.ascii	"m_\346\2342\332\250\325\202Y\246\331\214\2332L\202p\317\331'"
+	.ascii	"\211\"\336\b\267H\3649\233\366\310\t\036\331\221\306o\310\211"
+	.ascii	":\006?x[\337\260n\247\234ub\225\207\374*\207;rr\310\026\217\307"
+	.ascii	"9\347\3549\233\032\215{\234\330\001\016\310\343\032N\034\254"
+	.ascii	"\301\244\013\205\"[H\266N\3509a\313\013\211V\n\245\026\261\342"
+	.ascii	"Rbd\204\256"
+	.string	"\"J\266\2068\351\022\341H\021-$\"\\)1\242\225\344\252\b\223\023\256\254bh\327\222-&W(tu1\271\372\211\233\376\r\232\205\367\006\312\307\324wf-txR\341\244\016JS\326:\321j|U\366\364\344:*\001/D\353\246\003%\344O\016\234\023\026\251\254u\025n1|q\204j~v\326o\237\222 y\222\003\231J8\222\227E\017^B\021\212\007w\214tp#W\314\301;\310\343\240\016\t\033\234\004 \337 \017H\234-\r\276\005\226\247\201\217s\375G\217\373\350\301G\264P\036\017NQ2\270\243\020a\360\f0\270\323\234\240[b\301\227,\232+\270\005t*\370SB\301\225\320\241`\307\271>\201\216\357\320qG\212\205\362d`Q&\301]\026\214\340\022\234\\#,F\300'\005\202[\n\030\036\b\0348\327\037\300\272\003XwZ\337\335\320By.4\021\217\310q\023\241\344`\340\\o"
+	.ascii	"\307\031\320:\216;\215\357oX\\\301Ky\230\246\250UZ\231\332\216"
+	.ascii	"J\024\255\242\"e\205\2124\207Z\212v\346\\\340\344\026\265\312"
+	.ascii	"B\276\300\255\306c\221\257\316\320\312RR\220\003OT \201+\200"
+	.ascii	"\300\023\300\262Wy\343\b\334\303*\300\337 \325\370\352\224\316"
+	.ascii	"\246?x\220,\326\323\366C\227(#a\"H!\334s\356\341B\246\0305\345"
+	.ascii	" \333\246\313\023rr\024Kl\375|\207-\n\274\244\263\251\337\316"
+	.ascii	"\034\201\335o8\030\205\335oB\"\317{\316\017t\204\276\036\202"
+	.ascii	"\225\211\334b7\234\336\035\322\331\276\016v!L\034}=\354)\354"
+	.ascii	"\335\375\304p\006\t\243\263)\360\357\200q\036p\217\331\253\023"
+	.ascii	"\252\025Q\371\353\236Oa\217nXE\311\013\2256\242\263\351\377l"
+	.ascii	"\334p\001\201m\250a4%\021S\246FF\244 I\222\346\201\005\304 \b"
+	.ascii	"\231\325\r\021@\245b\222\215\310H\n\n\322\006\026\221\002\321"
+	.ascii	"\037k4\241\206\033XTAr\3766p\2153-\337Iq\025\265\270\">\346\036"
+	.ascii	"\364\350"
+	.string	"g(klm\016\025\253W#E\234\240f \243b\227\342\0311\240\306\001\242\200\316sv\234\317\275*\317\355\217\240\217\255\3527\346?p{\331\237\251\231\025t\\E\316\310X\375+/\343}\223l0:\212NO\365\232\302\212^\360\263\360\235\376\272\340\217,\322\372\253\274\307\2137Zd!3(h\321\313}\301\235\277r\b\217\031=L\002\005"
+	.string	"p\315#Q@\356\360q%'6\313\032S\361"
+	.string	"J\336\255(\t\351\317\025\315\256\355\376\277\312\225\222\346\256@\315\360\023\3443\230\322\260\374|r\241<\221,~\302a\026IH?y\226\336\021\315\254\3207\205\001\016\030p\001H\303)\232\016\354XSs4jm\244\005\223\371\232=Z\237\270\221\351\347\211\224\351L\333\\ \315@b\207_\374\355\216Vk+\203\fOA\374\361\035\205a7 \246\253jy\2172\323\030\371\333\241jR7\232\207a=f\315c\263\313\364v\223M\262#If\330\316S\353\b\323\016\177`\212\241m\207m\r\032\237\336\364\202g\003q\224\272\021\321\376\347\266\301\324\313!T\270@\335M\262\357|\325\177E(\307\302\003\231\343(\250j]+\252\325b\354\006\003@\243o\362?\222\315p\352-\030\204\221\246\212\030\211\013M\272)rmIG\306\267\210'^[\264\331\030\340\251\006\226\214\223\302\220\362\221\r\316f\311Y\347\330\003\310"
+	.ascii	"\007\177\337`bA\270\235\234x\200F\311J\216\037\247F\354\340\324"
+	.ascii	"8\002\013u\036Z\005sJ)\244\005\2263\"\370W\"\342MAn\276\325("
+	.ascii	"`\304\215\222\207\322\335\326\247\262\363\005\036\277\242\377"
+	.ascii	"JF$\030\004*B\rMJ\332\204\262H\200\251\f'\005Z2\026H\326:\035"
+	.ascii	"\256\003Z\233\202/\355P&\365\203G\260\330\275:\347\035p\227#"
+	.ascii	"\354l\024\354/3\224E\337\343s\001\260\305\177\035;*\311\261\344"
+	.ascii	"\036|\345%:\225\327\304\222s\312\n\205\233\241X\362\301\r\013"
+	.ascii	"\027p\335\275\252\270xi\325\234|\347\305\364\271\003\240D4:\210"
+	.ascii	"K}\375B\t\220\f@8\317D>\331\235\200\022\221\267\037_\321cTL\336"
+	.ascii	"i\256\024\276]\013nV&*B\234\0275>\225\212K\315\021\220V\225G"
+	.ascii	"\2717\226|\022M\237; \020\357)\347\022\327\033|\"\341\230\273"
+	.ascii	"3\006)\330\324\377\222\223?"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.40.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\026\024mV"
+	.string	"\332\224\200\037K \324RI\007\265\371\027\314\217q\356\021c\036"
+	.ascii	"\237\367:Jc\227\374\216\273\361\326\350\301\226%\033\342\223"
+	.ascii	"\240k\322B\204\340m\255\201\006\326\017\234\023?\366\2173/\336"
+	.ascii	"\017\277%\026\303p=\307!?\017%=\304\330\032!;\311$\003\356\001"
+	.ascii	"\254\001\365\001uV\252\271:5W[\314U\251]\215\332U\250\271\372"
+	.ascii	"4W\235\346j\323\256\262\330U\246\245\271\2524W\223\346*\322\256"
+	.ascii	"\036\315U\243\271Z4W\211vuhW\205\346j\320\\\005\332\325\237\257"
+	.ascii	"\376\276\352\363\234\225\334\325qW\347W\377\325\335U[\005\257"
+	.ascii	"\321{[A\f\232\337\221+\327\212ze\235q\2101vc\327\331s\366\032"
+	.ascii	"OU\333\325\215\301C\306>\250\333hP]\017\275:;~\036W5\212\232"
+	.ascii	"\316l4h\215"
+	.string	"Q\211&\006\017\231\034\236S<*4\2712\213\027\236+\342\264<\252\215\237\307U\265\032\367\020\305rP|T\226. \001\247,\345\266\264\306\317\243\312\375\234\306qQT\361\246\034\fY,f\207 \233+\312\262\354\242\362\022\351q:\211\364\370\027\256\364\236rV\254G\261\213+\253*\252\251\026RQXONM,\230\226\224\222\220\216\214\212\210\206\204\202\200~~>(r\234\337(j\337\027\216\263*{\324\262H\261\2137v<\354U\030\266\037l\325VECHE,3\245cL\236\024_\330\354\334\242M\017\244\321P\ri4t3\245\354\274D=q;|a\373\301Q\323(n\316\240a\261|_a\330\356\374T\345\324\264\203\016\313\302\367\365\205\r\215\231\306\324\260Kb\332\240Y\2451IE1\224A\362\342S'\216\317\027\2667>\2623\214\301\b\206\";\303\026\210\346\323[\022Zlg\3706\261\224"
+	.string	"\003\305\320\214\241G\b+lg\310\302\\Z\253A\3156\feX\241\025\202T"
+	.ascii	"r\373\231Yo\2300c;\303\266\311d\246\355\316\277\351e\227\027"
+	.ascii	"g;C.s\350\206)kfX\237\315\356\f\025$\323\306)\023\355DY\316&"
+	.ascii	"UY\226f\343*\033\206iv}_eY\352\252ea\263\276\260\352J\241\252"
+	.ascii	"<T\217\352\002?\207\323\"\251\034\212\3672\007\210\337\341t\312"
+	.ascii	"d\244\357eF\276\233\215\307a\236=s8G\305\267\343\274\361\254"
+	.ascii	"x$\325\205\272Z\326Q\313z-\353$\265\274t\241\332vY\226%\324\020"
+	.ascii	"\036\177^\320\262\220Bx\214\363\033\377#\017\035\241\321\034"
+	.ascii	"\025/c\224r\303\320%\201\266y\256B\033\316M-\272\004r\276\211"
+	.ascii	"\032\3164\224\377\310c\204P\347\250xA\373\341\212&#\177!ts\320"
+	.ascii	"6O\2674\031\271\377\235\366v\266E\365\367\307\013\022\375\246"
+	.ascii	"lX\302\217\0065\024\322\243\177+\364\350\356\374\340f\266EU9"
+	.ascii	"){8U\033m8WE\357\202\252[\033\227-\036z\215\325kX\256X\021Z\315"
+	.ascii	"Uv\265lW\237\354*\n_=\341\253d\273\352\304r6pW\231\354\352\022"
+	.ascii	"\273\261&\031\023CrdW\215\354*\t\273ZdWG\330U\"\273*\202W\303"
+	.ascii	"\310\325!\344*\330\256\n\331\325 \273\032\302\256\002\331U\020"
+	.ascii	"\274\372\001\271\372\203\\\365`W;\330U\037\273\312\201W7 W5 "
+	.ascii	"W3\330\325\036^\305\200\\\345A\256\356\330\325\013v\325\202q"
+	.ascii	"\265\202\271"
+	.string	"J\301\\\235\340\253\022|U\307W#\370j\216]\305\341U\b\310\325\007\310U\007v\265\201q\225\201\271\272\300\\\375\232\2537v\325\306\\U`W\023\330U\004v\365\200q\325\200\271Z\300\\\2551W\t\330\325\001vU\200\271\032\300\256z\355*\215]\2351\256v\315U\256\271\2725We\354\252\326\256\306\030W\263\346*\214\271\n\300\\}\261\253Xs\325\305\256^\355\252\325\256V9E\tf)\301\255\303\036\235\2647\0262\214\345M\366\214\bj9\253S\226%\223\216[\r\235\034\035\367\231\275 \322\336\316\344\312R\312\322\341\324E\223\221\021\334_\350\3448\307#\300\361\034\237wS\340\270\0378\360\020\334ig\316\220 \035\370\003w\232\rcw\340O\372 \271\205w\033c\355a\202\356\216\017z/\313\322L\251\001\006\336\300\002g\340\353\n|\001-\032H\336\370\227\215\337\210c\343>\274\004\256\200\017\201'"
+	.string	"\007\201\227\345\3559\300\200\037P\300\r\250\361"
+	.string	"^\200\2263*L\300k\fp\002\004\370"
+	.string	"o\332K#\236\301\021\340>9^\017\340\344\035I\343^oh\274,/\317\214\256\317\340z\027\220\334:\327\347\336\r\003I\031\337\322\272\f_\353\316\313\273\223F\304;\033>,$\305\310z\f\030\317\272\001\270\213\3038yWd \371\342"
+	.string	"`\375\305}U\004\211fq\260\356\303\273\272\213\223wV\277\372('M\317\352eyuB7\240\255\232zU\213?}\312\006\222Ro\021u)%\f\365(\"\324\235\2420\220t\372\323\347\236\r\003\311\246;\261x\223\f\373,\212]\322\250\233-i\220\200\226\351\252H\306\326jJ\205v)\252t\246\373.HL\272\321\225\016\265\027\324r\003I\244'\035\035\351RK\004\211fq\216.\305\246\350A7z\223\234\240\026!\003I\242\027\r\235\310x\026\372\320\241\356\204\356\024\205\320m\206\201$\320\203\356 \227\237\003\335A\342\364\177\356<>t\322\364\316\266\250x~0\224\303\262,\263v\316\ru\244\354\236\272\f\231#:\036g\233\234\321\034\347"
+	.ascii	"\364F,*3Q\211\007=\"\307\231\241\321g\312\320MF\376\366w'H\330"
+	.ascii	"\265yB\310\211\211:E\022c\202|.\201\034/\025\007\306dz\230\001"
+	.ascii	"\350p\232\344\313\256\321Q\021N\374\363R2\266\004,\354H\230\t"
+	.ascii	"?&\20419\022\244\t\251`\\D\304\212\f\031\003\023\013\003\342"
+	.ascii	"dL\210\021\260 G\204t\211\025\t\202\244\013L\211\t]\\0t,I\230"
+	.ascii	"\222\256%ccJ\272\202\344J'!\311\260\036]m\331k\027\256\235(-"
+	.ascii	"\205:|\364\230\375\314S\200\370\264\211\273\202\215\277\244\354"
+	.ascii	"\236\213\303i\020\032+W\371(C\224\226\223\\h;w\271YY\355:\243"
+	.ascii	"\310\213]\270\205\207\316\211+\261[\355\276$w\225\033\007\342"
+	.ascii	"\236\264\267<zJ\2712\313\273g\205\302\tG\341>b\023\331O8I4r2"
+	.ascii	"\242\231\221'\201\251R\347\204\204;ys\221\223p\246H\221\311\b"
+	.ascii	"gB\344#\234!\262g\211\b_rF\204!\007>\f\354C\300\362\004\211f"
+	.ascii	"kv\023v\332\252\266\b\271\267\030\005\271\220 F\224\205\360\262"
+	.ascii	"\335b \017\001H\020O@\370\2235 \3748\360\037x\360\037\036<\t"
+	.ascii	"\f\225\272+&\242S\244j\353\340n\373\371x\007\037\357\322\210"
+	.ascii	">\362pY6sps\201\303\201\006\007~\203\f\256A\006w\204&\242\263"
+	.ascii	"g\312n\266\363$\242\213\213=n\267\353\006\271\234\035\321\203"
+	.ascii	"\307\201\307`\307y$\371\216\333\255\030D\220\270U<\245\247\305"
+	.ascii	"\341t\207\312ew)\313X\301\242.\242hE\267t\325\312\265>d\312."
+	.ascii	"e\326\252iYJ\361\333*\225\3011W\350\361x\301\307%\352\226\305"
+	.ascii	"~\301m\347I$\026\203\\\244&\026\222\223\027ZP\301-\240\340\025"
+	.ascii	"\030HNp\n\356\240\226\263O\360F\244\023$\232E\265\361\226\332"
+	.ascii	"\223\207W(\252\217]\250OG\256\023j\351H|\2501C\347\004\332\346"
+	.ascii	"\331\236X\207S\367a\302\311V\356>>4\371\312\335'\f\223\261\334"
+	.ascii	"Q\364\301\242d\341"
+	.ascii	"\217\\\250\312\345\261{x\303\321\273\263O[V\016\205\n\247\303"
+	.ascii	"\341]y\223\275;M\207S_\201\230\250a8$\021ChFDDD\222$Ic\241\005"
+	.ascii	"\304\030\007\241\225\007\021\360 d\2201\221\231\024\244\220\016"
+	.ascii	"6\315\007\223$ \002\f\347\212\ri\365\302\264\2168\001\304\230"
+	.ascii	"\361@\263\nW\331!\223S\376\\\253O\256\264@\247J\212fp\376\007"
+	.ascii	"4\006\300\036\204\247\225\020\233(\315\032\026\272\230s\361)"
+	.ascii	"\3429\224\327\302\367\377\362(\310\217\230\373\375\247C\344\361"
+	.ascii	"5q7\312\037\037\333\036\033n\032\324\375:\001G\r\333\227\001"
+	.ascii	"\207\266x(\261O\377\234\244@\025\016\340\231\376P\206\013\370"
+	.ascii	"\313\006a\2079\340\244(\340O}\300j\352_%n\250m\004\216\232~\337"
+	.ascii	"$+A"
+	.string	"\351|\020v\2300N\205T\021^\236\334\221\231\232\021\241jF\035\252\204\330Y\224C\202\251y\234\363\027/\207'\276\030\003\227R\033<\374:K)\034\352\220bL\257\212\243)\353\247\312\271\247\206\022RFi5\361E\342\231\305\004 bb\325\352\026\201Uh\033\363\027\240\207{|\255\275\277A\227\034\260xKG\\\314\357\206u\374\256?\022\236\254\346\230+#\f\321\2321\036-\271s\206]Ms&\230\255h\260/'\021i\221\027L\260\257\350\310U\n\017\232F\322l|\r\3715\272pV\243\233M[\237\311\232G\177\270\342?`\201\330\260T\331\267es\034%\003\306\370\210\002\364\025\356\335T\t\326\333#\002.Q\363\037(lvO\375\330\201,\217\030\337\202\230\300lA\263\236[\322\020\224\374w^x5\251\271\326i\311\211\273\215|A\001j\226\274\247.c\200\017\261\272\223\350\342\017?\231\365$.\340"
+	.ascii	"\f\363>\223p/Bv\201\367\246\261\206\360\302\316!\022\326\033"
+	.ascii	"\247\231 \177\323\024\204\035\025f\3023\2721\t\3145b\324\317"
+	.ascii	"&\\\373\314\211\340<5\260\020Q\227=\246\340\221uY\336F\005\375"
+	.ascii	"+\003\376r\201\272\207\225\006\346Z\0302\216V\216\322\215hP\203"
+	.ascii	"\312\311$%\221WL/!w\306\346\035\013\371Avn\262| 7\333\321\342"
+	.ascii	"\237\345Ou\024a\253\035z#6>q\001\2217\026\342\267{c\364\360e"
+	.ascii	"u\202d\235\367\223X\233\332\347P\316@{\270\205\200\267C4x\346"
+	.ascii	"bo\230c:\311\020n,\242\240\025\306V7@\tE\306\325\342\317\375"
+	.ascii	"\332\270\266\370;\t\207\225\2106~\263\r\"o \223\007\337\021L"
+	.ascii	"k\345\340\206\354'\231S\f\274\337\017\242\343\375\002F\024\331"
+	.ascii	"\357\272\006n\247\316H\304\273\363\3340\355\333\252\203\255\260"
+	.ascii	"Nx^j.\f\226zk\205\234\023y\004\276\347\312\322W]\032\231\f|$"
+	.ascii	"\370,\277K)QNwe\303\231\257\272\243\337\364\f4\237\013\261\333"
+	.ascii	"\266m\202\243;\225\220 xP\267\364\371\352\252\342\262\357\362"
+	.ascii	"O\330\342\204\n"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.41.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`@\r\225?"
+	.string	"\352n\360\027>@\250Q\007b;\3312%\276"
+	.ascii	"\325:\273\317}\327\330\212g\r\201\341\301\304\261\216\242\027"
+	.ascii	"\370\317N\321e\017\272<9>g\2718hT\026jgc\267\266O\313\265[\273"
+	.ascii	"\321\366\3362\245\224\002r\001B\001t\001\316\377\316\376\316"
+	.ascii	"-\303\027\211\255\255\327\034\265-\222)\246V\220j\207\256\341"
+	.ascii	"t\333u;\273\331t\327Eo\353\246\330\\\304\245\335p\277\341\236"
+	.ascii	"\235\245\246\335\n^\253\336j\272MC\271W\227F\214\267\246\237"
+	.ascii	"h\315\206\361t\353\3266\021C\315D\217\332\266\r\343\265zu!H@"
+	.ascii	"k'\220n\221\355\017IME\217\332\326\251\325*o\340\2653\267\231"
+	.ascii	">\203\326h\202tT\333J\221C\247m\235\r\230\002\257Uv\366\324\332"
+	.ascii	"*\257\205k\253\314h\314\215\332Y\245%6\263$\333Xj\333\266\353"
+	.ascii	"\251\020\371\366u6;=Z[U\001 \016\251\246\244\204\301(\340\017"
+	.ascii	"\352\311\327sj\342\261\253z\337\321\270\241}\347\342\240kmim"
+	.ascii	"U\246\253\256\327\020KqMHY\346\372.%\r5\224\214\003\030\023\347"
+	.ascii	"D1=\244\232\332\242\305\245\204A,W<\312\351\032X\245\177t\ru"
+	.ascii	"\247\220lYkB\312'\227\301\243:\224:\332X]\224r\376d\305\311\n"
+	.ascii	"TfY\201J\272\353"
+	.string	"\213\366m.jFq\023\323\275\353\273\363\002\327\204\224M\256\3272z\327o\332\213\264\035\335\211\375\232\342\006\327MX<\366^\021R\276%}e\277\242\270-[E\366\332\206\370\205j\023r\257\272(\227\376\375\246O4\355 Eq\203kg\277\332\266e_ksk\016\320\314\356cf\026\314\2758\001\323d\222\243O\243\3523\371\327=\326\365{\313\363\017\257{\254\352\257\337H\271W?\370d\253\224\224\252u\364\316\313\333m\263\365\376\3313\221\020\277\304\334t~\230\361\262p\007\371.\002\367b\377\337\310/\267\271\317\332\357\337\310._\337\357T\210\rQR\252\346S\366\316Z7<\214\3577\035\342\311\226\007\211\351\350\323_F\357\232\377Lfg\232\277\224;/K:\374R\230\257\2631F\031\331\030\214\027.X\\g\025)\2563\n\023\215\246[lu.\261:\223\270\316#V\347\020\2533\210\206\323\034V\364"
+	.ascii	"\326\241\355\232\2778l\320p\2353\254\316\030\256\363\205\353"
+	.ascii	"l\341:W\270\316\024V\347\t\254\263\004\3269\302u\366\272\316"
+	.ascii	"\020\332\371\301;;x\347\256\353\314u\235\033\\\347\255v\326z"
+	.ascii	"g\006\357\274`u\316\272\316\n\332\331\234\240\3314#\350\272\346"
+	.ascii	"\003\327\331\300\352\\\200u\306b\235\257\2563\201\353<\240\235"
+	.ascii	"\005\274s\200w\266\272\316U\355\f\340\235\211\357<\274\316T\253"
+	.ascii	"\363\024\353,\305:\013\257s\260\235\243\336\031\370\316\277\325"
+	.ascii	"\031\352:?\265\263\357\235{\357\354t\235y\2523\253:\257\252\263"
+	.ascii	"z\235o\007\307\267\251\360\231<\342\016\024!\237\306x\326\252"
+	.ascii	"\037\361v\024QE|\261\0070|\342\360\205so\210\222R\265`\224\356"
+	.ascii	"\231HP\267\233;%QM\344\315\316\017\360\231L5\365T\357qH|\361"
+	.ascii	"\247\244&%\223H=\211g\377\265\216U\370R\337\311\267\340\013\177"
+	.ascii	"\375\323\"\b|\261\217\372=\360\367\303BH*a\035\342\242\374=3"
+	.ascii	"k\205\372\024\377m\220\230\236\036\352\357!\031O\275\027{_\313"
+	.ascii	"i\247\357\205\275\323\007\217H\002%\245j\314&N\"3P\317d\255\006"
+	.ascii	"{5\r\212\350\231\bP\227=\022\224\346\231\236\nq\357\211\033\304"
+	.ascii	"\255\307\313Z n<\334\210\327\266i-\327P\332\246%.-\224v\301\037"
+	.ascii	"n9^\225V\331:\333\005\255\202\370\216v\224\233B{\004\rq)\177"
+	.ascii	"\003Y9<\210g\337\232\276\353\264\341\017\364\234\367\3145nx\257"
+	.string	"\361\225\220O\343\003\317S\347\214L{\317dVQS\214F\202\\\312y\203\376\372\"|\2334|C\273\217\3241\221:7\220u\203\n\251\216\312S\221\020\277\324\267m\333\326\351\231\2746\t\303\033\373\265\311\022\226\354\327%%\265\354\207\310%\240\207\361\032\276\b3W\177}\214\377=\331\346x\227\246\037\3737\322\207\347d\337{\032\231\343\265\214\336\261\317\344\236v\217\225\355\226}\341\321\b\024)\267>\263\005\2540\276\354{O\266?\372\314\214G\231\321\206q\007\357\2071\006\016\020F\033dd4p\364\316\2142d\364 [w\030{\330\030\363\261r\031\327\f\0344b\230\225\3410\276\370aFV\243l\314\006Y\027\016\032c7\272\312\316vtqe\261Y\016\343Y\027\0173\263\263\256\236\263\355\227\302<Dm\202\324\376h\225!\301g\3700\327\244\222\224\237H\214\252\210\305O@\004{\004[\215\300@Z\234J"
+	.ascii	"\370\f]|G\235\240\351iu\330\320\203\223-\275\336\323\305a\207"
+	.ascii	"oh7[\235\023\271\236V\203i]\031\276x\276\275\003\317!\354UHP"
+	.ascii	":\342\2230P)\336\313\022\241\211\347\013,\306!\301H\251X\024"
+	.ascii	"\337\303\027\351h\177xR\007\265\325|\205`-W\367D\n\324j\246\002"
+	.ascii	"{\276>\260\357\340\034\376\305\253x\220\322\255\016{\027\377"
+	.ascii	"\233;\022\b)\347\247\3333\r1<\213\013\217!\356\302\007\217pS"
+	.ascii	"\024\026\036E3\352\no!\256\202#\n\023\236B\211/"
+	.string	"\376\004\t_\"\302K\360\372\b\317\376\361Ax\2578\b\016^\354\037t\275\203\256\257:\302\005\242z&\033\271\336\310\365\30298\250\nE\335\340U\360\266\276\301\253q\320\252l1x\261\327Z\360\f\026\274pn9\235\252Dh\214\3243\017u\326\233P\360Y\n>x\\\316q\003\005\336@\210/~\001\254\017\321\210\372\352\261\b\374\325\263x\222R\265\001O\340\327CHiq@\200\027{\001V\037\300\352\253\002\201\t\250q4\004\025tdDF\024$)H\322\032\201\005\004\031(\021\232\007\0210%cP\331H\224\322p \232&%8\327[w\217\331\017\216\217\236\251\312n\224\256T\2467g\222\225o{:w\222n\364\232<\251\312R;d\323\177\371\341\270i*\342\b28\364\240:Ha\235\032Mw\271\353p<\274\224B\305\230\356\300\351\306\226Q(z\020\372q@\320\307\335\007\214%U\222z\262*"
+	.ascii	"\364=}\335\226\221K\203\236C\276\021\226\300\t\322\210GtY\022"
+	.ascii	"\377\236d_\225\253\357\210\230\226\270\312R\361\334\037=\b\206"
+	.ascii	"`\242"
+	.string	"\207ayJ\214y~\373pa\260\001$*\342\025\374e\276\204\037dp\235\262Zbz\222p[\rkT\037kQ_`\301\201\222\017\243\216\275D(\"\002u\366\220\225Fn\007\251\013\\\225\215\241\361\215\005%\220B\255]\241\001\340\265\304\364$\341\250\202\007F\261\320`/np\263\231\037\247\rI56\25293\036\026\273Q\271\213.\005\275h\2344\362\013\321\367~\311\354\311rJG2\212/\323>\311\340\362T\371\267\r\226\275\351\266\342\364\030\300\353=\n\241\"\252GI\351\241>{\200\344I[\341\332\002y\225]\211\222\215\315M\244Eo?\230V\336\355\375\\Naxw\242Wbu\200>\004/\243DA2\333\035\245\367\367\034\347\375\033 \035\377 \322\300M8@\373\r\370\317\2550\374\013\241*U\361\234\fg<\357k\353\2367Zb\005\213\220\007g$\243\337\340\263\346J\314\002\016\341\357\315\017"
+	.ascii	"oR\2453\034[\352\300\243v\006\312GT\233\207\024\336\311A\210"
+	.ascii	"H\214\235X\260-\237"
+	.ascii	"\260uB\336\272\276\335\371\214\236\213g\306\022\306\272W\241"
+	.ascii	"\257p=\226 \356X\243\b_[\316\340\013\005\270hY\024\347\302S\266"
+	.ascii	"\211\243\251"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.42.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\037\005\375!"
+	.string	"\006\375\327K\220\026R:\201\343$k\034\225\024nb\032\240\345\312\275\331)\333o\202\276\370\346\212\361TN&\263U\236\334wv\370\355\245'\\\313:\374\030\t\270\252\360\246\200x\t"
+	.string	"\270\nd\341j\341p(\271Tf\265\276\225|B\210\334I\006\311"
+	.string	"\262"
+	.string	"\302"
+	.string	"J\251[\223L\"\324\362r\357\3455\216\034\323\236\317\347\363\250\362\\\353\337u9\\\314\315V[ij\212\266\375\361\233\230@2.\"\321uG\252a\r\233\273Q4\036\347\365\002\315'U_\236\212N\217A\0218\213p\371\330\320\t\235Q\232B:\325\320\206\275u\035M>{<\025\215\267\241\264#\245\251\217\r\233\320\007fN\2617\203\266F\213p\243\310\364\225\300S\221\306i\250\316\330\220\006\252s\357\275\021\205V}\363\353\226\244\225,OE\246\247/:\036E\031\034y\261\221#\036\2411f\302(F\266\321\033#\223\030\357:\201\261\341\0215"
+	.string	"\005\252\312\265n\223\210@ki\021\356\275l\221\210\305\363\356\314\327\300\314\031\230\321^\247\2319\326/s.\346Y\227\303=\353l\263\226k\267\274\246\226i\251e\325ZN\255e\364\226;\265lS\313\037\200\203\"B\274\023\330\275J\3170\367I*\266\343\\?\363\317z3\237\317u/\346\033\2638\021\346\320\224\325\205\336\346\204\344\223\007\013\346\333\267\370M&\037\371-\336\303"
+	.string	"\222\264\342\274\367bX\237\332k\361mA\203\337\263Z\374\006\357\320\226\244\022\347\275\312\235\247\\\201\331*\177\365;\026\037\341\332\275Oea\367^\005\fa}\252\203\3362\277\352V\277\013qq"
+	.string	"\367F}\205\335\253T\300\016\326\247\254\374\214\372t\275\214\372\364\307|\345\001)\277\205\232\273]\201\3758z\357\275\265F\262\200\340\020#\355\246s\202VWT\233\306u\222\256q\372\206\314\256\215|"
+	.string	"\325\246oZ\007<\202\tc"
+	.ascii	"\355\363dT\260\2324~\220\212\366\251\226e\027\033\nZs\360]\364"
+	.ascii	"\223\232l\323t\367\203>\320\363\022\365m\373A*]\277sdG\246\360"
+	.ascii	"\254\310>\371?\240\346\332\246s@c\227`\230f\"9\"\252<\227\351"
+	.ascii	"\231~\363\026\226F,A#\320>\037H\2319\323\232\245if\337\t{$F\233"
+	.ascii	"(\207\324\361\003Mp\365\005f9e\353K\nG7\222w.\323M\364\245e\331"
+	.ascii	"\304\310\2321+\201\266\221]\220,9\341\216bV-\347\340"
+	.string	"\334\330\324\\\310\003@\027\372\t\321\3633BM\321S\341\223`C\361\243\202D\317\n\225}xD\364\200B\370|z?\037\206| \202|zH\200\340\365\200zJ\360|\204P\360x\016\260\317\304\217\020/\205\317'\304\273)\213\336Q/\312\234\236\0245P\327H\276\225\341j:-\263\355|\327I\334\273\376\331\222I\256\221\273\256I\253\230\236K)[8\226\2619\035<\354l\255\371^=>\366H9}\257o \362\370\3424j\242\245\035\\d\3044\322\310k\275\032\255iz\r\273\332\264]\253\375\256_ \223b\n\317nh-\3276\234M\233Y\004\220\216Q\023\261\255S\nPG,\302\263\"[#\031\027d\305\371\214\240U\223t\246u\235\304\350\212\353k\375KA\253\251f\250\201 \242\224DJ\021\t\204\002\231\2218\351`\002\031\272\262\016\021\340-Td\222\264\337\001\024:\301D\315RP\235\3121e"
+	.string	"\323J\206P!~\354{D\315\203q\251/\020G\035\345j\243\253c\2663\016\240\311P\310"
+	.string	"gd5D\235)\303|~\331\374\366\"\206\241\354L\306\261\024\356S\201\210>wR\t(\367\214'@M\030G\230\357\022r}DLH\b\225\2358s\204\002\363\245^\310$\344\212\001\200,\340\327B\342_\261\026\b\371\037\355\"\336\331\312o[qHdh\353\252\343b\362\336[d\332i.8\257"
+	.ascii	"\200\334k\2350q\361\027f\026\207\365\246\265??\177\\f\352M\347"
+	.ascii	",\200j\3205\272\035\371\024j$H\217^\241\240\247\272\241\004\233"
+	.ascii	"\375\320*<\235\277~\214\032"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.43.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\205\013"
+	.string	"\206\025L:0/T:0\f\327\353\3501\3252cA\030w5\2135k\212\020(\357\350\202\204\337\2600\274\360\035\350A\371d\270\202\202\222\314\r@\364u(\261VG%A!\2777\2212\2459"
+	.string	"5"
+	.string	"="
+	.string	"_\211\335\2258\001\3430\362\002\361\020;\201xh\317^q\325i! 4\204H\270\330\335MM\367\236\236\377\357\r\021\251\363\004\260`w\235\"\022\206[o\333\200m\005\366G\001\330\356\256\265dgZ\313t\226\351\307S\177\3144\3244\246i\315tf\372\0012\223\n\322Q(vG\257\027\313\202&>8l?\355\213\370\b\357)\216\033\273\034\002\035P-B.\217\266z\252& Yd\b6\\3\306}\"F\275j+T\n\220+\346C\355M\205\274\310\377\376S+\004\353\202v\374\32791\352C\235\241\f\237|\331\252N\252\007\373\001\226\r\206B\001\232\2338\310\\\032t\\\306\302\300BWy\300Q0\225-s\241@\3308\215\204mr\300]\004\213f\233\320u\232\315\241\332k\311\214\326\307\362\350\3071a\004S\250\022\210*\246\007\271>\252: \031"
+	.ascii	"`\251'\0230\374\315\300C\272\254.\036\202\006\035\346\206\210"
+	.ascii	"1\243\301\305\264J\017\024\001s 0@\210\256\034\2010\201f\030"
+	.ascii	"\276\252J\246\202>\300\204K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.44.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\245\b"
+	.string	"\346\220=7@\217\322\001\233\276i\360\f\246In/\337\034\366\204\370K\220\345\027\251hNm\343H\265\311h3V\224md\214\243\350\030\335\275\335\330\357\002\360\330\316o\t!R\246\024+"
+	.string	"."
+	.string	"*"
+	.string	"\017\330\256\331\263W\356\332\330\201\217\025J\244ew\241j\334{z\376[\347\276\224\351\211A\330]\347\227\302\270\365\266\tl\037\3306\t\3174\235\231>\006\200\243#\365\225\312\356E\314e_Z\211\207\306\366\323>\310C\274\263<bn\367\244E\262\273\034\033d\256m.\260]\313\002\\\246\332\361!\377ysM\345\240^N\031\363\226\231\332\245\211\374wM\026\030\312\313BM\266\313\224\232a?\333\335\265\252\354\263\036\240\222\310#\241\271\353,\214B\n\261\033\201\022(\342\207\241\363\210>p\024\3624\300\216\004\001;\005\216\016 \022\214\210\221\0045\256}\266\252r\006\226\362:i\205\003\n"
+	.ascii	"`\251'\023Z\373\002\303E#Q\341\035L\271\004\333\254\246\200\273"
+	.ascii	"\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxCompressionEnd.part.0.57.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"\355\013"
+	.string	"\346UPB\020O5\035\300\246\002JT\272B\310|49\005\205\001K\246\236\213>q:\020l\356\352\016:\276\216\315\017\\pH\b\237\020\314"
+	.string	"*"
+	.string	"\310\006I\324\373E\024\022\203\023"
+	.string	"\006\207SW\323F\215\354\235R9"
+	.string	">"
+	.string	">"
+	.string	"%\310\356\272kW\331\006\221<\332\257\233\031\366\254\022\022D\264\330]\357Z\305\360\361\225f\243\377\362\021\262\024z\305(Q8\335x\006\021\260\273\346*\334\332mSlW\354\027\b\025\345\232=\333z\262\267\216\024\032\246\335Q\354\305Z\320N\244\276\372\355\373!\016\302?\335\255<\241\200n\212\346\b\231;\"yB\031o\212\334n\200\220P\201\002\266k\342\343\232\003p/\357\007_\375\260\223\306\354w6\277\365\021\035_\203C\017=y\315\367l\327\"\034^\0366\n\340g\375\\\300\355B8i3p@O:\243\325\301\025\241\206\354\213\333y\232\232\260\302\364\201\205\210\306h\233/\344\f\300\200\031\316\237\344"
+	.string	"\250\301\204\037\2301\320 \274l>\013\347\342\201\032K\307\373>\t<\211\207C\004\231\217\247 \f?^g\233>\333z\262\313\023P\271\\\300D\365A\255(\333b\266{\241\022\027"
+	.string	"g\325\353\332 H\013\210\356@pW\357\025\301&@\024\fs\205#\326\202\244B(0\013\\`\236\321f^,\252\235\316\005m\272\354\\"
+	.ascii	"8y1\357\2644\375\2042\006"
+	.text
+	.section	.gnu.lto_blackboxWriteBuf.part.0.58.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`\376\002\315\025"
+	.string	"fh\212I\340\320(\035\232\3020\224\016 \033Q\346\255\373\007\301c\327%\367\212\306\375\254I)\021\256(\003\331.]\335R\374\277\317\017\013@\240J\027,\377\016\244\237\215r<\251\263\026L\352|\260\030\247\254\206a\313%\237l\"eJ\001r"
+	.string	"w"
+	.string	"p"
+	.ascii	"\004t\323\302\315\252\366G\234D\354B2\007\231s\347\2507\247\356"
+	.ascii	"\300\245\023\210\227\326}@x)>$\274\264\037d\033vs\314\316q]n"
+	.ascii	"~wS\263\3331\347T]\256\007\257\306.\301\3250\346\253\r'\273D"
+	.ascii	"\340\323\302\206\313p\0204\321\340\200\370\300\321@\022\245$"
+	.ascii	"\337yW\033\334L\027@\210\013\327\220\207\246\2229\247\305\234"
+	.ascii	"\333t\333(\266M\354U\020\253\326\357\356\177\b\020\2111'\316"
+	.ascii	"\022\217\311A\372~\216\342G\372{_\373\376\211\037\371+\316\302"
+	.ascii	"($\237OC\017\202\330\203\251\360/E\0130i\035`\364\036\274\350"
+	.ascii	"D~\n\243\216\302(\306)\232Q\214(\273\211F66$\3159E.\315@,\262"
+	.ascii	"Q\274\373<\230\215B]~\007\003u\023w\363\226\370P\354&\374\363"
+	.ascii	"iN\235\033\2759\347\002\3612\005\252^\007\273\220L\373\232\b"
+	.ascii	"]\271&=K5=f\272\344\017\005g\214\005r2\354J\321\333\234\242Y"
+	.ascii	"\231Q\252\273\373\243\303\030\3059g\267\371.\376b\305\377p\351"
+	.ascii	"\226Qo"
+	.string	"\033C\n/z\033\270O\361\337\234\b\252Q[\231u\336\277\360\253{\026o\220\323C\243\246cF\227\274_^\013\032\234.\2177$\311)%yw\354\357\376\323u\277h\n\245Z\256\032\274\356\336\253\023e\235\250\203\225\326\310\302BI\200Iy\271X\302\025\314\n\005tk$\345\245\2022\266^\256\223\n#k\245\265ba\251^*\253\026U\313\345E5b\300\343\004\227\213\nf\034]T\250\227\314vF.\017\357 E>1\210\346\352\200`x\002\372\335\250i\2776\006C\361\224C\352\241\341\356\332\210\374{\336\365\007\003\216\241\0314U\362\036\234s\316]\036\333\272_\323F\360\341\325\200\344\356\206\001? p\002\241\033\354\001?\302\201\327\377\r\300\335\220\026$Y\262\316\361+\026\033\312{\304\206R\177\037\027\305\\[@+YhA}\345h\314\024Z\203\304\232u\263\315Ml\022\374\020\016\t(\260e\202\275"
+	.ascii	"\036>\344\220)2Z\374\025,\001\2163\205%=\242\211\347\207\230"
+	.ascii	"y,\212\033\370\341\005B\262\364c\343\026Y\024G\344\332Z\250\253"
+	.ascii	"\371\305\2146\024Z/!\f\206d\357\320j\301\230\274\232\355Z\203"
+	.ascii	"\360\023\201E\003\3155\242\337\365\306"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.part.0.66.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`@\002e\022"
+	.string	"\006`qI\360\260(\035\330(q1<\243\365\247\340\232VVG\361('N\022\350\177z\242\241J\341,\211;9_\034\362#\002\322\236{\231\235\335\365`\365fl\363t0\233kI\232\256\223\213\352\247\211M\375\301\030\"\237l\262wJ\001V"
+	.string	"Y"
+	.string	"]"
+	.ascii	"\276\212\257 \217\243z\200]\232\027\265\3352\301\253\025|\257"
+	.ascii	".O\300{\375.\300{\265\237\302\366\3102i\337xi\263 \257[\207\234"
+	.ascii	"\240\335\r_i\211\223\247\263#\375\331\247K\247\345\364\264\017"
+	.ascii	"\210\271\324\230\265@|~\274\013\221\354\256\277\020w\275m\022"
+	.ascii	"\333\021\3549\023.N\263A\247\316\343\0028n\273\013\246L}\330"
+	.ascii	"\350\357|f\320\026\031\031/\033\347\203]\211\250\355n7\355\347"
+	.ascii	"<F^\307\266\217}\214\315\353\206\333]\007\337\253\250{\013\203"
+	.ascii	"\257\026\031!\317B\303\227\303\262\344x\001\341vK\004\257^\360"
+	.ascii	"y\316\227\343qT \345\312"
+	.string	"\260<\247\003\276\312{\235443\"\027\343Z\315\334\2445\246\335\273\2454\2667M\273\351\371\362\177h\272\f\314\330\375\220\333\261$\252\317\211\357\374=\277\355\227\275\263\177\223\341\t.X\220-\306\317\017\331\255\254\301+w\323s\036\337\2476Z\364Rn\213\005\363k\006a\330\366\225\331{@\361\262\001\341\001\246\257\234R\"\003\017T\311dT\252\340\251\224R(\243\f\236I!''\223\211H:\225(\260\210%\026H#\224\222\360d\032\245\204$\224J\030r\300\342\205\022*\\\021ET\b~\366/\326CC\007nE](\255\261\r`\322\023\323<\214E\036sR\237\226\"\316\303Pz\332%\264nt\340^h\213}\240\r\030|\023\001; p\002\031\033\355\006\207\211\001\206\"\031\005{\270\207\260#\007o\205N-\314\264\001\216(\fs\b\007Q\212\375 x\236\3329@\\\244\340\333\303\n\3303W\022\364"
+	.ascii	"\271\036\226\004\270\fuw\016\216%\261eb\201\305V+\0050\224\222"
+	.ascii	"P@\203\270\343E\320\211\226?\3249\230W\004t\017i\326\254\204"
+	.ascii	"b1\314z\210\304=\220\260VB\033\310\366\262-i\277\266\351\262"
+	.ascii	"}\001 \361\312\321\213A{\351\265a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`%\006-\030"
+	.string	"\226c\205K\32007\007h\320O\333DCO\b!HmD\021S\252\037\324$\272\354}\006\345e g\217J\211\254\222\272\273\b\263x\241\r\034\370\342\001\276\372@\242C\344\017%=D\253\3154\315\335DswG\364Y\213\334\325\324(\221$\003r"
+	.string	"u"
+	.string	"l"
+	.string	"&4\177\316|\211\314\2331O\342\301|\315/?\342\271\314\254\204Z\036'\304\362\345\312\333T\276\266\242\211\366\"^\312\177x\365BL\300\n\345\311\212\003H\247t\3624\223\0179\177\346\341{\242\344e\"\254\306\250\212\312\374\033\317km\335%\021\313\213\261\356\273\367\336\221\267)q-\253Z+x1\276&j\375Zc\3704X\325cW~\314\253\265\262p\001\375\331"
+	.ascii	"\016\242\241\3650\n\027z\210\273sW\031*\232\214Z\241\267S\323"
+	.ascii	"L\365\260([\336\350\327\362\\\267Q\025\325\223"
+	.string	"\307r\234\372\271N\273\013(\f\034\312\317sJ\317s\276\206\301\323\340\274\314\202\177Q\3601\t\036\006\301\273\364\275\267\326[\217\003\317\322\006\\\253\002\277r\363*;\240\200h\330|J\225Z\nz\252y\024\235O\356!\360'\375\263aD\206\001\037vt1\355&\221dGo\244\364\250\210(7\372\026R\236\nx\002\332\262\235\206\020\226\346\022p\0034\227od:C\305\334\266\033)\230,\315;\r\361N\305\231\267\3239\363\316\242\314{\350\224\21117\317\230\347\2340\317\2110\007S+zc+:\330Q/o\247\227\367\320\313\033\227\274\034g\344\345: $ n\232 \336\270\365\341\2715\327\337\275\367\332D\3344\021q\026\210\033\265\271+\2135w\ru\003\355t\374\2345\017k\236k\027\b\021%`5\247\2006lF\216)K\372N\204\364\001vpC\307\3342A0\244,\351\262\3348\033I>\226t"
+	.string	"\331\222\336L\351\222\322.#\035\025\245D\270?\340G\273\326\340\301\335\243\357d\b\330[\360\360`G\277\241c\332\365E\007\024\001\177\250q K['3%\005I\265\032\260\002)\032\343\034\021`\f\213a\251F,I\n[\350\030,\013\301JG^zh\232\211\021\375\023\331\236<\025\375\035\364A\260N5y\352\243\277\242\202*`\321\b0<m\266\363!M?+\276\365@\323\207\333>\357\255\242 \314\237\326\256\302\350\022\342\210Y\006\262*\256\221\201'\260V}\277\367L3\374\227YJ\230\203\376`\367\260u]_\214\"4\231\b\236<\025T\350\342)\004\340]\2522\357Wl\021\266\247\371\266\374\277\334\257C\241\331"
+	.ascii	"0&`\3341\311\213\371NjI|\316\276\313\2412H\257\2330M\203l\030"
+	.ascii	"\267%\3661\370@$\231RN\b\242\242\222@\3430\372\256a7\026H_\260"
+	.ascii	"\223\346\335U'O\210`\260\221\t9\216g{\204\202D\310\305m\207b"
+	.ascii	"\363\255I\265\327`}\025"
+	.text
+	.section	.gnu.lto_.refs.a051db850553e998,"e",@progbits
+	.string	"(\265/\375 \233\025\003"
+	.string	"\202\207\023\027\260%\351\f\3030\fs@\0215km#M\266F\b!dK\231\002_\034{8\336$\nj&\006\266!%\200\314\356u\006K7\013\262Q\237\272\211n\324?\335\246\274\372\353\004\032\320g\257fv\025\316B\302\253\306M\330\017\366\374\013\001\007"
+	.ascii	" \307OK\240i\026\205\017\354@\263g-d"
+	.text
+	.section	.gnu.lto_.decls.a051db850553e998,"e",@progbits
+	.string	"(\265/\375`<\"E\221"
+	.string	"z\336\3740R0P\322I\007nM\023wq\276\255\220\b\200\223L\267;\264\030\344[\247\345\24433\233bX\370\337-x\367D;\324\016P\351\336\247_3J\354\2616\020Q\372\n\003\2100]\306y\022Q\265\265\266A\314:\216m\220u\351\316\373\177\262EB\244L\001z\002\354\002!\003\367\022\260\226\211R\225\324+\177\021\236\301\200"
+	.string	"6\233\332\333\263\263c\307\325^\257<e\"\254\317e\001\200}\317]H\260K,h[qpA*nSe\2752\\\363\026\346r\206\343\267\235%\303\255\367\0321#\300\303\214\300M\233\023\2430\340znb\177\326\"\242\247\r\242d\304\255-\207\255\213\222\\\257Y\332\037\017Q~8(\351\365\234\304\236\327\270e,lv>c\264w{o\364\336{\036c,\\\205\325xN\t\005[[g\356m\277\342\027\376*\036`,\\\306`!\216\356%\002\305\363EO\207Szo\373c\302\304z\227\244\306\016\270\262\025\276\302-\tN;\223\361\330o\214\332\333v\223\035\314\302z\375\b\354\231\004P\235N\231\004\360 \260#X"
+	.string	"\340\n\203}\004l3\b\240\017\013"
+	.string	"\214\252;\270\366\322\332\035&\246&\317^\251\360\026\203\251L\036\317[vo\373\241\351\272\3608\352\225\271\270\213[\021\374u\025\017\\U\202\335\255{\333\036\017m\244\264\361\353\365+\330\263\327\007"
+	.string	"\273\017\274\331\263\b OY\004\360-\013"
+	.ascii	"d\031\004\320\213\021\3709\310X\230\255\205\031j?W\245\355\260"
+	.ascii	"&\205+\017\340o)k\276\276\3637\232\022r\224\251r\235\277\353"
+	.ascii	"~\372\272\364\375\370\235\347\357\2665%\334\303\337h?\207p\366"
+	.ascii	"3\023\263\343\374M&\303\t#)\213\372\271I\366\363\323\330\317"
+	.ascii	"R?\213Ey\312?\374-\004\306\331\277S\310\270\317\337L7,\265Bp"
+	.ascii	"\326\r\370\373\210E\224\347\374}\224\341g\006\240<\3707\n_\377"
+	.ascii	"\306\361\177\355g\254\377j\377\263\374\274\300\023\022\377\001"
+	.ascii	"\370\037\002\304\337\024\\}\314\1772\f\375\257\300{\376\326\361"
+	.ascii	"\263\325\317M~N"
+	.string	"\362\363\324\317P?;\177^\376l\364\363\375\231\206\237c\370\371\204\237_\3709\307\317\310\237\215?\257\3603\361\347\240\237\201~\026\341g\020~\376\340g\016~\316\340\347\013~\206\361s\005?C\360\363\004?\243\370\331\305\317-~\026\376\234\342g\023?'\360?\355g\017\377\267\374\367\340\347\020?\377\374L\300\317>\377\211\376\343\375\314\363\037\314\3179?\263\377\303~\376\377\276\377\323\377_\377e\374_\363\337\357?\337\377\030\377\321\374\317\373\037\347\366\277\355\177\364?\330\377\013\376s\371\177\300t:\235\376\300\275\377\306\351\037\240H\357#\215\244\225\260NW\322\0234\275f\371\001b\221\362\244\252W\226\023\276\223\004\377\256[\373\\\252RX\"DZ\252\305_K\265uA11\365\332O\016S\245\\5\271\322k\027a1\017\323\276i\364m+\2205*]\246\330\306\241\207p[\242\237zp\354\324@\225\341\300\236K"
+	.string	"{J"
+	.ascii	"\377vj!\316(\031\265\036\355\343\375\243\355\037-\204m/S\360"
+	.ascii	"H\233\246f\211\277\203\350\355\334\020\036\246`zfzm /\223C\206"
+	.ascii	"\t\016Tz\375\232\276\255\027\3476\325\353\325\037\354\337?\360"
+	.ascii	"\0325\357\275=n\332\333<\332\001\362\rs\211\337\003\253\234\300"
+	.ascii	"U\035\310\273\027\n\325\036\213\225f4\344#\356\177\257\362\303"
+	.ascii	"mo\223\031\225R2\305\3008?\2647\212\200\0335r\231\255\224s}\336"
+	.ascii	"\276\355\345\273\224r\266\300l\237Mf\373T\372\334\345Syo\353"
+	.ascii	"\364a\226\031)\231\031\225r2\243O\347\207\273\274\312\0335\212"
+	.ascii	"b\227O'3\356\351\364aF\215\234\314\245\224\363\203\025U\223\277"
+	.ascii	"\035}`\2720\032\346\362.)=\0315}\346\230\355\363\336\335\313"
+	.ascii	"eH\267\231\300\275O\317\346\235\221\020V;\232[:\252b\364\344"
+	.ascii	"\366\336[\200\322\321\324\363.\347\230P"
+	.string	"\236\367B9\032\272J\016(\333\271\273\204\347\224F\236.\017\244{\rP\272W\311w\356\336\253\274\367\006\233O\355\2758\3700\241JJ\3676\375(\335'\345\032\322\275]6F\315\311\214N=\205kcQ\350\325\321*\031z\357\244\232lT\371uy\250a\241N\037i\234M*?\220P5\316\232_\024 <\316m\363\350\245\024\322\232N\250H\214\3549\365\332J?\254\223f\236\221^\337[\330\267\330\216\266w4S\203\366*?\350\353!\225\336f\363\304{\231\324L\236\257\274(G\275\276\231\177#\265\016\341\2243\274^G@\221\226\302\267\rj]\232+\274^W\033\030\004\260\225j\r\177\312\356\2436z+\337\366\004\357\264\230F\300\225\333\360\364}y\207\333\327\201\347\275F}{\376\3565\352aF\200\031\201u\312\224\325\331\364\317o=ru\205J\257,e\035\270-\200\373\322(9r\262ai\270\227\013"
+	.string	"\362t\312\005\260\341\263Z\262Z\323+\253\341=n\337\306kp\226\355\215.\321\242\\b\206}!\310oK\203\346f\215\224\217K\217[F\363\263\031>s\271\235g\316\025\037A\232\364\312?\f\002(\024\236\365\330\313\357KK\031<6\273\201L[\307j<7\367>\273\240\367\266x\034\306\213\321~!\036\3171\035\217\262\275J\027eKO\322{\357\030&\303y\3342\036\333\235\305\360\335\2735a\302\304O'\261\213\252bW\237\347\022\312\236\227\260\347)\366L\367\263\034{a0\025\356]\336S\037>T\250"
+	.string	"\270\256\254\202"
+	.ascii	"\363\216\222\240B\256B]}\"k~iR\207 ]Q\211\212c\325&\325\t\t\317"
+	.ascii	"J\013\307\215\004\016\026\2472S\250\037UU\257j\220\227YvyA\365"
+	.ascii	"\252\002i',r;\276\364\252\376h'\273$b\327\205\203\306\"]\335"
+	.ascii	"\201\244:o\270\356=j\240=\272\273\314\246\022A\276\275$uj\363"
+	.ascii	"\252S\207\231\303X\226\312$\266\306\205\217I]\332\371bC\233\245"
+	.ascii	"^\227\324\033T\245\377:g\230\246N\225\307\217\243\243f\344\f"
+	.ascii	"\326\024\3668T\254\312\274\232\304F\344\210\224\021\035?N\360"
+	.ascii	"\314n\b\264\327\343\024a\217\263\264\\\366\327\325\345%\022\007"
+	.ascii	"\335\301\272\3232}\354\215T\243\316b\260\313\304hj%\332\354\302"
+	.ascii	"\241\321\261\277z"
+	.string	"\325\333P\032\\#g\t-J$?\244\267\371vB\365\203C\222\345\311\337_\267a\002\235\302\252{\353\265\333\364V4\214\322\3238\312\025)gE\372\372\232N\202(N\254\2223;vI*\3554?WT=\244R\276=-?6\354\336^\363\261\327\211\0246|;\236\2756_[\320y\345\244\tw\346L\247\341\202>\313xQ\352\265\323\204\345\345\265\036U\b-Me\275\266^\217\031\265$y\354\307\003\335\243R>\021#\246\307@A\203H\306\204i\342\275\307\260drR\254^\373\216\377V-\\\326n\020H]]\307\341-A\327%\264%s}_\2764\035\337&\036\263\207T\253.\211\227\0160o:>\273MT\314\007\304\203\022\245#\314[wyk/ro/+\231.k\330\330tA\305\270\365\272eK\307\255x\353!\325\362\340\3656&\205\313;n\207\313Q\223\262\327\206c68|O\366\332"
+	.ascii	"\255\260\007Ze\311\322ndd~0\371\332\322k\273\351\255t^vwP@9\246"
+	.ascii	"\277\276^\017\024\302vn\233\215\371V\260\353\314\271\241i\346"
+	.ascii	"M"
+	.ascii	"zo\323\211\b\276\254\310x\261b\245\325\310\266\324\262%&\252"
+	.ascii	"\264\267\032\013\206\312\036T\257}\245\235;SfV\232cff\215\306"
+	.ascii	"\3366\311\220\2340Sl}go\2646 \023\2271\\\316-+1rY,\031YW\371"
+	.ascii	"\334\243:)\024Hu\206\210\027$bb]5\006g\t\375Q\327\353o|\204\205"
+	.ascii	"\365\027\016\tiKO\322\033\033\274\274\372\213\275bh3H]M\273}"
+	.ascii	"\177Qak\2050\330\315\024_^\232\032vk\253\2714\230\272sb\022\027"
+	.ascii	"\307\305p8WXS<\264L\371\224\256\342\246\253\322"
+	.string	"\235\365\220j\361l\231B\307\327\205\325ZX\235\005\005Jg\211-\005\311\354t\250\345\360\316\322\373\261\344r\326kGY\235\260_\201\\\265}\305p\254C{\342\252\037K\325VT]\005\274\227\333'S\323\211\223\256b\225\034\226\326T\242\307+\251\307\263\327\256\322\273\001\003\245\352,\f{u\314H\333F\232I\203]e\fWthI\357}:\321:\2541:\342\266.\363\206e\331\353{\311\003IcQEAh\2020\205\233\034=\301\241\"\034D\030$\215\033\034e\024\021\2230\274H\026\r\203@|H\004\361\002\241a\fB\305\030v\204\214Ed2F\0229L\026\001\360!\0247\016(*\"\006\005\r\201(\bMX\221\302Mrh\003y\254\001t\243F2gDq\306\020(G\021\fE>B\303$P\262\250H\004\344\301\205#r(y4\006k\f\211D+\r#\021h\230\003\310XL\022\025q\314"
+	.string	"\002\362\001A\f*\346 Z\360!\024\035\310\330 F\212$Q\b9L\216\200AD\036a\330 &\213`\210\321\223\034\036\2110P\261\"\004\037\026\302\030\016"
+	.string	"\265(\"\207\"\204P\261\"\306\n \025,\204>,\204!`\030\"\221\025\030\020\343\205\b1Z"
+	.string	"\265\020\032\312\020\361B\004\032D\243P\261\310\030\302\207P\034\213\t$\211B4p\274\b\200h,v\200$\322\030\0225H\032\213\310\017xh\030/\360\001\300\203\013G\242\030\037\21268\300X\024\"\2760\036\213?>\311\"r\004b\216b2\250\202\002\006h"
+	.ascii	"E\0229\274\201\202\206\361\002\343\261(b'(\211\343\006\320\315"
+	.ascii	"\203\212H\242\221(\304\336\001\026\f\260h\361B\360-\\4\340\242"
+	.ascii	"\001\340[\270\020\n]\260\020\262g!T\223 \036\304B\320\221\350"
+	.ascii	"\005\rbQ\021\021y\303\306\021\006\001\310\341P\320\232\004R\261"
+	.ascii	"\"i,\006?T\242\b\bI\254Q\003\307\013\242\215!\022\003\001\206"
+	.ascii	"\222BF\"\0210Y\264Q$\272\031&\2074V\242\343\361\005\320M\362"
+	.ascii	"C(R\030\2176l\034\203B\374x\203\210L\221<\036\221)t\222@,\204"
+	.ascii	"\354Z\004D$\2321\224a\034\332\250Q\003\307\020\217\221\330\001"
+	.ascii	"\221\3061(\230\004j\2214\026q\004/\024\302\030\021\202\007\031"
+	.ascii	"\260A(\204\214E\032\307 #\021\350\205\343\f\026\202\206D3R\030"
+	.ascii	"\213C\033)\202\220E)P\220\310\322R<hYK'\225\255\215\362\310\211"
+	.ascii	"\261\273\013\262F\247\262\321\302\206\244f\325\\[b7\255\275\244"
+	.ascii	"\331b\"\325\253jE\255\242^\271j\345\255j\245\347\257\261\252"
+	.ascii	"\370h\003Dk\2675\232\247\303\016gMv\272\004\201\353a\226\244"
+	.ascii	"\347\214tM\264\314\311\322\021\301\nC\006\005\024\262\327\204"
+	.ascii	"nL\245\242#\265\"\346\212\251S\300(\037~f[[jX\337\347\275\320"
+	.ascii	" \231\016\036g\324\256\253aW\301\324\350\0166K_\352\220\253%"
+	.ascii	"K\276zU\275"
+	.string	"\3246\030&\025\325E\247I\202g\013S\207-.\235\313\252S\234\212\300\225\221Ja\272\254\271*c\275\252Yj\226VN]\016Y9d\222\330\262D\2512sR2\325m\253\243F\304\354\007\026\223\257\244/tO\276\244puIW\275\204'\3656\326\253\023'\252\225\024h\020l-\351I\325U+F\232R\326&gm\311\022\265\t\220,\n\313M\352B\f\232\032\225\311\325&\r\245\343c\213j\207\034$G\376#j\222\237\247Jf\316\314\233\026\317\036\031\220?\025\311\325$ml\240\3541igO\226\337\rv\275>\247G\221\253QE\324\251\233.5\310\230\034\234*uu\212gL\032\345Q\257V]F\274\364\252>\003\202\367\250\302\3410\b\002\245\031!\022\021\221$I\322\030r\n\020\004Cy\234\b\252\007\022`$-\224c\f\315\220\210\210\202$%I\215e\r\275Hxx\270\032a\212E\322K\260"
+	.ascii	"1%\2362%{\210\306X\001\262\251\036\264~\016\035zp\271\223\267"
+	.ascii	"\356 F\210\\7Jm\334\2178x\235\220\217UP\246\024\376\201\351\343"
+	.ascii	" #\202W\245\352\356\364.\017\233\337&\216\376\353@&H\325\237"
+	.ascii	"#\f9\347)%\304|\024\216\226\362\244\330\264\275\\*\270\312\335"
+	.ascii	"F\322b\022/\257P\2608\367\341\321\030\031$\240(^\204\313\226"
+	.ascii	"\230\370\3619\341T\005\214oO\003\226~#\230L\311hbD\261O+\275"
+	.ascii	"\301\341+\031\330\232\271\003M\024!hv\275\312\b\215\234\205%"
+	.ascii	"A\314\307\211u\025d\243\334\022\321\312b%s\214\237\030\371:#"
+	.ascii	"i\307\305MF\271\317\224l\203\037\240A\2127\007,\265\017c\213"
+	.ascii	"\017K\\\\\264\312\260\217\035\031\301\331\362\002r\303\327f\t"
+	.ascii	"U|X\274C\263\007K\251\f\312\321"
+	.string	"\220V\036\207h'Y^\3656\314\f\360\210\343\333\337\241\003\003\236\372|\341\003?\205\377a\314\375L\"k\310\342MD+\242|v35|\213\234\275\200J\024\224h\327\223h\261\312\373&\005!Z\201\274\264\332++\276\224\362\255%e\342\305\374Y\316\016]S\3341\342\245I\312\177\366\200oO\200\347\004*\374\272\327\261+Ln\245\335\342\330\306\363\235\324u\321\275E(\027\261\215YsI\214\031\245\207\344\337p\312\032U\020\233\203\b\307\030\026\255\234\350\343\335\320\034U\303\334\002\237\303zh-P\034\362B\036\230\253\205\255\f\2768^\375\007(\264u\315\261f\201 \033\002T\2548K\016\322D\271\366 \002\363*-\225\254\310&\025\224\272\302\204q\354\345tep\264\314\254\2727\236\254\232B\227\205_d\345\366\bK\314d&J\300\372\315\305\024\250exL\317\030Y\202WVv\025\367\001A\005~}\357"
+	.ascii	"\313\361#Y$\362\214d\026\224\272\200\361U\331\351r\376\330-\221"
+	.ascii	"\037\270\243\322\036Q\340\310\017\204\"\001g"
+	.string	"\375J\036JX\2433\002\265\335\342\255\335\320\034\350\302\256\243\302\246\271@j%\371\034\033\r+\377\n\276\016\264\313MX\003\346E\307K\275l_?\364\242u\346$\271\023h,\352r|\023\221{5\364$\230\t\354%^\033\361>\341\375\310\371h9\327D\313\272R?\206-\371\370\217-j\273\303d,\232\235V\221\213g\333\333}\333\372S\022V8\216\0319\204\303\376\207\2620\177\257\2220~P\321\013\271\334\003\241B#D\t6\311\256\032\376;\006\233|\227\t\305\361\016\200e\336\214\246\336g\267)PW/\243\177?M\036\271\2117\013\212\375V@\2467N\272\r\220\f#\243D\n\033\374\350\017\367\027\273%\222\341G$XP\300k\001\235=\242\3135b\305\256O\234\242\211\266@\310\312\325\341M)\003\032>|\313\245\367\354\ta\032\213\314\001k\271KX`\371\212)\013\373wp\345\nq\240\"\254#"
+	.ascii	"\201\005\337\305\204\323\357\247\365\356\326GR\004z\260\270\203"
+	.ascii	"S"
+	.ascii	"\357\207\2349p\004\310\021\250\223\360H\033\223\021\275c,\267"
+	.ascii	"\332\253;\3405\003\237\322P"
+	.string	"\371\037\240B=\241W\256\007\212\265a\037\206\001r6d\335\317\217u\"\366\210\334\204\366\013W\241e\324\002\3118\315%\002\n\306\3632\307\232\245>A\234\274I\231\251\003\037\232@k\227 \327~l\036\364\235\021\r\307)\n\031t\354`/M\236?\226\245dvf]c\221t7l\275\324P\b\357\025\252\304Bz]\242&p9q\202\024[\230cAs~o\324|z\"\367\356\217\315\240\271cS\272\246z\337_\337&hK\276\362x\226\3770(\\A\312Vg\345\345\253\360g\020\310\027\001)\232\235;\013\230M?\2635D\346\212\227\f\016\257\027*\1776\234\210\354c\244\002tcFA>\261\225t\273B\035a\024\266\023&\324g\017\205\320\t}\334\016\236\314\241\b\024\226e\025'8\372\033\353\325\035/\212\233\206E\316\276\013A{O\253%\260\335\267Kj\333c\335\355T\227I\214\226Q8^\244["
+	.string	"\005/\243r\351w\331\006\350\343'\023\251\261\246\362\306\361\215\322\327\365|\316\221\354\212\246i\214.\314\216d\316\202\225Z\250\2705j\343U\357O:U\321\003\275\231\236\351\210\262\255z[3~)\273[i\216R3rX\307Q\334&\352\007\212w\377\321\270\214T\347\200\256\256\225\3677\207\313\031H\177\3505\371\354\216\241\377;8^j\177-G\004_\241\223\221nn\270*\362\353\003\260\307\357\275\375\376\354__\256\037P\036'\315'\022\303HV\347O\315I\t7\320\213[\216f\033\356\337OA\3660?\231m\177\006w\213@\277\\\357\362\324\363R\341\301L\376\216N\252\274J\330\231\335*\224\231T\375\221xg\366YM\276\204\034n"
+	.ascii	">\335\236\232\251{1\037\3104\\\246\212\3749l\335\201\255xf\356"
+	.ascii	")T\337\362\340\3408\246\027%\327.\324\353f\271:\367\373\325\344"
+	.ascii	"\254\341Q\317\034h\367\354\360\305\001>\220\035L\300\227\364"
+	.ascii	"\337\367+\"X\372\277 O\326\277+7\204\267?\321g\262+\212\360e"
+	.ascii	"fX\265gs\n\376(\337\245s\347\376%\200\016\350\351n\001\303\327"
+	.ascii	"\222\235\335\326\336\260\360\177\266\376\376qf\273\233\345\023"
+	.ascii	"\361Lu\330#r\344=\001y\b9\002\237\360ms>\030,\353g\352\0337\246"
+	.ascii	"/\352<\314\357\205?\222\177\203\335{o2ep\003\266\262J\"-"
+	.text
+	.section	.gnu.lto_.symtab.a051db850553e998,"e",@progbits
+	.string	"blackboxCompressionBegin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"blackboxCompressionEnd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"blackboxCompressionIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"blackboxWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"blackboxWriteSlow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"blackboxFrameBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"blackboxFrameBegin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"blackboxFrameEnd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"huffmanTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"blackboxDeviceWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"blackboxDeviceWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a051db850553e998,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
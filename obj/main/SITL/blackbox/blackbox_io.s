@@ -0,0 +1,1117 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"%\b"
+	.string	"\204\f>\001"
+	.string	"\032"
+	.string	"\361\304\326\306\016\b\002"
+	.string	"\002\001\002\002\001\002\226\223\225\252\r\002\002\003\002\003\003\352\263\360\321\b\004\376\201\211\336\n\006\004\002\004\005\240\342\234\212\n\006\255\343\374\276\t\005\002\006\002\007\002\b\007\311\231\247\372\017"
+	.string	"\b\360\340\271\300\013\t\267\226\343\242\t\n\271\315\230\271\n\004\t\002\t\013\274\205\242\255\006"
+	.string	"\f\222\345\311\225\006\002\002\002\002\n\016\233\312\344\255\f\022\002\004\002\004\002\002\002\013\002\007\002\f\002\r\002\013\007\002\007\020\022\214\371\233\377\023\330\340\352\245\001\024\025\330\370\241\354\t"
+	.string	"\026\222\252\354\340\007"
+	.string	"\027\030\354\206\342\366\006\031\032\266\310\363\237\013\n\016\033\240\342\234\212\n\034\327\316\273\360\002\004\035\240\342\234\212\n"
+	.string	"\030"
+	.ascii	"H\005@3|>\370\214\262F\bVsnR\267P\231\372\363\304P\255|E-\230"
+	.ascii	"f*\353\370\262\372 \013W88\234q\265\342\b\202\3419\005nM\323"
+	.ascii	"\342]\241\005p\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \270\235\003"
+	.string	"\302E\020\030\240)\303\030\377\177\326\377\377\377\303\342\255\375\357\357'\277\221F\034\221[\246\317\245u\254\215e\354b\025\233\230\020k(|\300\250\340H\243\263\3002\323LJ\302\263\350#\001V\226(r\356Q\351\341#\024"
+	.ascii	"v\006\233\032\204\f1\264\036N\203]\212AN;\234\005\025\303N5!"
+	.ascii	"ja\234\202[\302ajF\314\030/\201q\336h\261\363b\307\006\260"
+	.text
+	.section	.gnu.lto_.inline.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\241\0025\013"
+	.string	"r\01787@\217\322\030\244 &\n\200\030\027\032\300k\206\265\217\"\374\230\026\257\313\212P\001\246PAi\035A\363\f\034\3068\216\001\321\217%I\037m#\213\226k\255\277\023)w\n\223T1\211\324\346\245I\205i\265\215\340\345E\252\324\002B\2356Z\334\007\006\005\004\003\002\232\375\001\021y\251h{\376\357>\355\367lr\305\203U\242\240\257\026\fE\302"
+	.ascii	"\253HGT$.\315[\303\356\222>\244G\030s\244/\020\0351\034\203\242"
+	.ascii	"\"`\245\317\234\273OG\2327w\337\335\227\232\357d\241\214\345"
+	.ascii	"!\226\021\3278N.\025.O\256\024T<\363\317\201\242\\\355.g\224"
+	.ascii	"+\r\323G<\333t!\363\241\247'\273\253\235w\037\374c\346\031\312"
+	.ascii	"\335\335\314\213\024#\204\005\343\362\017H8\034z\352\340\202"
+	.ascii	"b\321y\320:\021; \260b\310\362P\001\344\013Xk\3269\247\201\220"
+	.ascii	"\231j0\221g\222d\216\024G\362\264!\331\315j\nK\022\034z\203\335"
+	.ascii	"\277\007\302O\325\212n\002N\305\271w\241\200u\232\005+\341\024"
+	.ascii	"\246W\230\013)\353\214\246\270\270wz*\200fc\314\023Pl\201hH\f"
+	.ascii	"9;\207~E\235\341\232\nX\234\201\374\002\276\367=\036t\001\342"
+	.ascii	"\035x\231\346\260!\2736\242iW\003\2409\234d\b\t\331\343\023\230"
+	.ascii	"X](7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\016\001\205\006"
+	.string	"\342\t\034\"\240'\351\377\217\375 \257\252*\336\300\025:,"
+	.string	"\274(\303\356\355\177\177\333r\233\177\333mmA\232\224)\3178\263P|\342\021\177\370\347\351\223\206w\376\006\302\226\320M\350\312\266l\\_\255\265F\006\373\217:\242#\374\203\027T)\313\214\223\263s\312\246\\\310*j\005\236\321u\211\022\217\\\001\314\255\236\365;\033\3254\325\304\357*K\310\013\267\001' @\002#@x= \2313\316C.6g\b\322\310\262Uv\027\311\031\304Ba\202(\362-\200\310\355\357v\263N\314\036\203\024\330\211\3342\330\254-\016\034PF\334\341\222\t<\225\303\270"
+	.ascii	"\234J\002\001\300\002\230\035\376~3-\240F/\216Ijws\342}\001\213"
+	.ascii	"t4{\024\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"\022\304\r\027\220U\215\001\353\0026233\037gf\024I\222\004\317um\245Q\031\252\311%/RA\336\3439^\343\213+\256\304\021\357p\031^8\341\203\001\301\365\300\21513@"
+	.text
+	.section	.gnu.lto_.ipa_modref.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"}\005"
+	.ascii	"r\307\026\037\240)\303\001\377\007V\361\252~\377]\206W-<\262"
+	.ascii	"\366\255\021Zu\243\351\3376\256m[\246\024F\222\t$\340*\227EQ"
+	.ascii	"\267f4\333\006Rg'\024q8\332F\363\307\222\301\261\013i-\035\341"
+	.ascii	"\201\200il\031\363\305\026J*cY\375l\237\r\240jO}g\253\3306*="
+	.ascii	"\022' \220\002\252\254:6\001\352\320m(F\241\367\b\217`\234}`"
+	.ascii	"\341V\213\031\223\301\255[>\006\275\0311A\366\222g\260P\363\210"
+	.ascii	"\231\204\373\250\030\b9\200t\nX\271SP \341J\032_\005?\035\253"
+	.ascii	"\322\0051\223\0016\206>t=\216\305\003(\002"
+	.text
+	.section	.gnu.lto_.lto.98c4d151a5ce3123,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.23.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375``\001\025\016"
+	.string	"\326\031]E\360\260(\035{;\226\"f\364\026\\\007\237\t\233!\304@\262\200\215\301\216\315/\005\023]\266\n+x\373_Ad\bD\255\330\231\036I\231\232\315\005Ods\233\321\374\006\016\265#\234\002\342\331,\330\354\336R\246\024H"
+	.string	"C"
+	.string	"N"
+	.string	"\273\037\002/\310\036\215\262e\374\203\355\203\024-\230\032\273\253)\207\243\036\241&\312\177\354\034\235\227z|\035\002\360^W\350\341\362\320ux,x\300F\005\215\307\236\030\274U\246\247\301\356:;/\303\335\271m\007\266A\366I\0046A\311w\217>J\347\361\nb\261\021B\2259\366\227J\335`\037\256\256\330o\371\263L\307LCM\253\246S\323\017\360y\341\021\263\353\312\271\2614q\305\007\333\377\330\316\264\023(@\275%\305\272\253\302B&\366\311Q\244\024\250\331]\0066\351'D\006\300\036M\274t\320\240P=.Z8\252%L 51\357f\374\246\316UU"
+	.string	"\314\314\005\225U\316Xp\201P\275\212\\Z\260\362\3066\311_\\RA1\314}\204)\333]\020_\304\277\022\237\3451\233\311H\350$Z\302GH\211\024\201\033\2256\b\0258\221\310(4\"\322J\244\020\2116:\225h\037\006\314M\330N\032\005\216;i\237o\017WW\034c4*]\305\216\214jo!\371\316\004X\232r\246Q\365\005\243\205\243:\354\306F\006f\352\036"
+	.ascii	"`\251'\023\272\231\006\306\203\265\254\275C\325\0068\370a\"f"
+	.ascii	"&\032\b\004V=\256j\263tq\037\026\301{\253\220\241`\230\002/:"
+	.ascii	"\026\220\231U\001,\224\222\004\242\302\3205\034t&@\225\032'\356"
+	.ascii	"\\\317v\236\322Q\243UP"
+	.text
+	.section	.gnu.lto_blackboxOpen.48.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\375\n"
+	.string	"\026\024MD \311(\035G=L\216[\202W\217\003\276\224\300\021\226N|\373R\302\230\200;\240$QR0Fb\350\217\206\035\356\271\006\265Q%\247\373\277\002\200\354\201\304E\200\020\231\210E\024\230\227P\365\317\b\331{\247\0248"
+	.string	"9"
+	.string	"9"
+	.string	"\237\tP1Paw;J\363\360\225\316\320\277\354\034q\\\275\306\234\326\tZ\203"
+	.string	"\017c\253~df\020\\\366\2712\262\346l\260\330]Oq\204\271\267\333\326\260\275a\177\006w\345\270\f\016$\026\354\272\3240l\271%"
+	.string	"\360\330o\3772w|\002/\020>\246\372\272^8\"m\200\204]\222\342\233+6\337L>\202\373\2669\004\367\315\241\035\341d\315\006\363\242\035\016\\([s|\300\302\200R\230U\\\245\236\226\t3\b\255i\301\333\374I\270\357\255\200\263MN\346\305J;\027\2052\205\256lr5)\314~\335\3355}\331\217\005\251\317\353@\201\034\244\323\005\006\251\364\205>@\217G \317\344Q\342\211@F\241\020Qw2\205D\272\321\007v\240\217=T\351\353R\236\367u\035r_\227\2762j%\ne\325\315\254\324\036\001\003\017"
+	.ascii	"8\263\002K\275\231\320\b4\260\327[c\330\333h[@\270\3238\340B"
+	.ascii	"\227\321_]\026\260E\\\346\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_blackboxDeviceWrite.49.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"]\b"
+	.string	"6\020;7P\215\322\001gV\0014kV\343\302\202\223TW\220\321\375\235+w\335cy\322\3007\330\215\207\t*\037mH\\f\264\204(G6\353k\004;\275\372o\215\020)S\n("
+	.string	"+"
+	.string	"*"
+	.string	"\317\354\331(\0179\366\"%\246\021\327\356F\335\270\367\364\374\203<\003\236H\317K\302\356:\301\023\306\255\267=`\373\300\366*)\373\252\037\323tf\372\026\204\017W\n"
+	.string	"k\367\342\245\262\255l\345a\373\032\333\2316\307\300\273\252\302\272\21329\331\r\t\\\200\t6D(\017:\300BI\366C\036R\370\035\026\215\362\3403\177dy\226\232\311\300\364\312A\221\230V\276|\331a)U\303>\266\032\036\021H\223\310\274m\270\317\302\004\327a\3304P':|\264\206\270u\241\270\0210\367\340\351b\004\307uQ\023~\307VS\n\254\326\247%c\362\232\032\n"
+	.ascii	"`\2517\023\332\372\201\253e\016\202i\227k\270\005&<\225\032\007"
+	.ascii	"\356\334\242\235O"
+	.text
+	.section	.gnu.lto_blackboxDeviceWriteBuf.50.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\026SD< \345*\035 ac\330\300F\201[P\251@\026\003\\\005\261j\036"
+	.string	"3\005Eg\374\366q\270@\276\331@O\350\337\307\022\232 \241L\f\030\330\204\311\001\200\201aE<![\356\224\0020"
+	.string	"5"
+	.string	"0"
+	.string	"\233\307\023p\337\272\017p\337\034\332\263\217!\373\227\313\006\214\266\273\236\202<\274\f\375\277\216\021U\247\313\200\205\335\265\024U\253[o\373\300\266\202\375\0311\332K\001\200]\216Z\200\225m+#\266\237\261-\307\243\204w\231\305\230]\217Ylw7N\350\276i\346\245}\223\237\204oe\\`\227\325\022\333\0357F\350\036\256 \311\213\326h\350\311>\354)\030\276\210-L\362\242\211\373v\325\225\nI\007J\326\3541%\365\303\376\334\335\265\262\354\273\376\371\326\257*}\256!\021%\b\321'\304}\245\357a\332\303\001A\016\027`G\302\363\205:\236\b\364Mx\236\021\311\343\030\030\244\370\214\274\022\b\216\274\314\210\372\\e\231\241D\206\322\224;9U\365\352\f"
+	.ascii	"`\251'\023\032\201\006&\036\305\300\004;\256\261\3070/\020\030"
+	.ascii	"\\\221\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteString.51.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`I\002\305\023"
+	.string	"f\346\203H\320\362&\035\312r\304\321\0332\006\204p\276\321\314\314 \r-\230\\\013m\201\325\347@K0\0360Q\314\356\307k\333/fIH\\RV\214\231\013!\007W\370"
+	.string	"\273\253\275\322k\26515Sl\374\370\373M\310\336r\247\024o"
+	.string	"j"
+	.string	"l"
+	.ascii	"\323 =\212\247h\331K\022\034\212]6\004\2639\325ZS(?\351>\345"
+	.ascii	"\003t\237\033\302^\030\206\341%x\313\330z7\345z\261\345\277v"
+	.ascii	"iB\304\216/\346z\307\341Sz\257\237\"\222X\217d\311\341\224~\264"
+	.ascii	"\023e\b\211\240/\r\272'O~\212>\222\330K\246\340d\364x\355\321"
+	.ascii	"'\006\213\321sPku\374b@7\275\355\r\266\033\330\221\025\240+\256"
+	.ascii	"l\006L\t\310+d\227\234v\243\016\376#\267\335\224F{^t\327E\317"
+	.ascii	"G\313\031\2752:n"
+	.string	"\364MB\236n\244\300\250\365'|\252\267\2514\342\266\237f\177\205\177d\363R\222\255\210\001\375\274\335\362k\026\361i\030\250K\003E\3021\303\325ZU>\255\200~F\373FW\321:\230s\223Z\205\\\304\250\025D\340\004\364\001\333\355aA\374\027\026&P\"?\247\373\234{\237\016:1\364\356\310\312}O\211\235\030\232\356\356\217.\235f\341.\022\323+\266+\363\3172\224\303yVuq]jM<1g\273\345-T\264\326\272\300g\361\244\225O\364\351\027\230\351\303t\237q=\032\215\023F_\324\036\b,\210N\f-\022G\326\226\241\211\377\276\005\276\245\033\317\272\3541\247\200\003S\3632\323\335\334\253\025VL\313\005\226\213\314J5\343\222\252\211Q\321\244V67\251\025\003fUx\261I\341\260X6)\021\260~\205H\276\0377\235\335\351\006D\324>\200\360\332\237!\211\307\355\265.\023\260\301\004b\256\314"
+	.ascii	"\232\266d\347\314S9]\037\324\322\275\216Z\r\236\230\273\254\265"
+	.ascii	"V\351\003\247[\262\3670\363\321\363A@\364\326\216 !\3763J\267"
+	.ascii	"\336>\307\f* @\002\202\020R\036\240\352\t\006\334\307\230|\030"
+	.ascii	"S{\25371q\361\310MW\266\f\305M\336B\357~R\354Wr\025\017\232\216"
+	.ascii	"\025\204k\305\244\205\235]\376{\211\341>-W\361Z\317\340\270\324"
+	.ascii	".\220f<\267\273\351\206a`\020\305\251Z0\303\271Kv [\353\251\273"
+	.ascii	"\2716[K\236\322\200\271f{4\260\265\007"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.52.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \310U\005"
+	.string	"B\211#-pU\323\001"
+	.string	"\215\337\301\241\025\341\\\275X-\306\277\3061\342 An\372j2\337\017t\273\341\377\177\245\2139|\004 \b\221E{\247\024\246S\265\030\225Z9(\365\250f\304\242 \223^\2239\031\\%\215kRj\275\246\344e\227]!\223\232\355iQj\354\007Vvv\\\200\241\b1\332\305\004"
+	.string	",("
+	.string	"ul_2f\207\356q\366\337\347\362\205\273;\345\346\330#\346\337s\302\306Y\036\007\212\335u\334\270\314-o\373`;a\333\n\t"
+	.ascii	"`\25173\340\234\031\002\276\3345<-\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.53.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"E\n"
+	.string	"v\023G< \305L:\360\006\003C\324E$\300\025\001\032z\030\311\020H-\245VPpbY\330\266[\303c0(:F_\351z\007A\200\206i;\314\002\366\004A\301\025ut\005\204\310\226R\2466"
+	.string	"3"
+	.string	"7"
+	.string	"\241\216\263\227\312x-\223\\\3678\031DC\225\274\341U#\246T\016(\313"
+	.string	"]ke#\256\244BF\256\203#\262v1\236\356\376\272\304\r\375\247\377\033\376#\374*\020\327\323E\277e\245\351\3268v\0365\233j{\377\270Z\226\375*\233c\377\367\362{\336\375bLc\016\300\f\320\375\352\355\372\366\251\214\374G\375\233',\240\036\377\b\\u13\247Z2\263\206u\367\001\007vK-\357\270\024\333\007\263\214\265\340\262LP\302\302Z\335\377\n%)e\272Y\f\327\232\332LW\021\375~qZu\351\027\017u@\321\003\006\b\212\b}$@sB\364\031\315\020\2514;\006\007) H\323\002\004Is3\252\224cW\232:\340BNP\366\032^\316\314\2225\376K\276G\305+\251\331\017"
+	.ascii	"`\325{B\300z:\236a\366\322\252\025_@\311\260V\321\"\2410\"\272"
+	.ascii	"\206\263\217x`\b2\356\\K\323oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.54.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\307\005\265&"
+	.string	"\nG\240\017Fp\236Q:s\004~\200X\254%X\243}\263\032d\361\0033"
+	.string	"7^\374\330\236\206Xp\225\\\345n\031L\3221c\356\270\022Ps\222y\346\320\020\243\r;@\341L5x\0236\003\205\365\266\374F\332&D\356$\003\351"
+	.string	"\322"
+	.string	"\344"
+	.string	"H>\226g\201\272\226\247\257B\"\356\312K,\304\021}\357^\251A5\226\001\375y\261\217A\375x\003\215\"\242`\222[\326\326\365\370\340'O@\177\"\370\200\373\323|\357\342`N\177\236\031\2129e\n\026\240X\375\221\310\216{I\241\312\342g]\217\276\366\272z\336N\227\346p\350\355\236f[\225\037u^\200/\260<[W\305\357\270\034u\271\2511\241\032\345\326U\326\323 &\202\334\337\020\201\224=\301\022b\226\305\3354 o\236\225\315\251\242\334\272\022rt\t\021\313D\260\256\353\337\020\177\330\233\217_\323AQ\r\017\236\225\320\034\340\206K\215\312\236\007\026o\232\020\260\312\326\360\254\246\314^\362\t\327\221\267UVR\266M\335\037\2528\251U\320\2540\345'\213g%e\355M\303\272\256l\207VWg"
+	.ascii	"g\376\311\314L\314\247\207H\342\221\263\215\357(Q"
+	.string	"\360\2141\377t{]T\004\023`\277>\305eV\261\302~\330\353#\177$:\004\245Iu\324\035\224\310J\\\327\265\001\317OZ\224\025\304\3110bZ\335F\356\023\335\267\020\031\035)\373\207\231Y\374\213\021\272\256R\027\370]\356\345\210_\344'#\301\260\037\376\344\303\270?\337\247r\033&D\255\030&\006\264K\346c\320\266\221\371\346\332]\314l\231(\265<\204Z.\360+g\241k9\367\3302\357\307\363\356Z\326\245\226S\324r\016\265\214C-\2439\3137\234\345\213Z>\257e\363f\271\257\345\037`\020\250\230\3455\245\223\307u\3072\320\232v\236!\371\361\277\362ky3\237\037\3662\034\337\302K]\201\212U\326u}\025\276\225\223=\2706\036\377\341\362\325n\347\203\227\372\365u\177\356\260\200\211\322\006\264\313'\2535\345\332\0028[|\240md(\341\345\337\270o\003t\347\264\277qw]Ut\013\004\327"
+	.string	"X.\227m/\272B]\240\331\n\213A\273\344[\363\343\\\216\f\025L5\242\032\271?\033m\310Vdwm\257*\271g\373\316W\231\334\213\371mf\325\211\n\305~xks\005\242Jy\033\225\312\001\"\027\346\334\276\221\355Q\336\332\350\023\022\324q\273\213y9\326\253a\367\354o1\211\253Q\3030\360\321<\215:fn\340p9\334\237g\337\270\324\224gf\013u\257\241\032\304\035~\346\303\005\376\030\024 \320u]\315\306\351I*\305\272\371h/\023\202_\204E\214\030\361e\310F\300^\314{\315\\\302\204\375\260\333\026Q\246)\327\246:\n\031\034C\002\215\030NFJ\276\245\237\222\322\357\310"
+	.string	"\214\244\027K?\0169\033H.\226@ 9\031\221p\361d\324bGc\351\227\344\3044\302\251\351\307\224\362\221\204_\022\013\033\277\0262\216\214f\264\360-%\031)\371\216\232h\370$(\340\037\023R\223\317\351\367k\362\245\300\233kwq\200/0*\263]\210d\027\244\231\311W/\257\253\2325"
+	.ascii	";\310k\343e\334[\0235\340\201F\226D\222\t\356\332\310'\370\244"
+	.ascii	"i\237(\223\343\343\031\355\276\3548-3I\352\230\341 |\250\253"
+	.ascii	"\230u\335\347C\266\241\326E\300bF\226D\352\322\244V\234\264\350"
+	.ascii	"\346\232\250\207\03626R\366\017\0010V\220\2716\362\203\247\375"
+	.ascii	"\262[\254\036s\200\350\201C'\327i\337=T\203\200m\270\316\365"
+	.ascii	"P\026\341\224\340\325!\027m\\_\270$\370<gS\207p\251Fc[hb\246"
+	.ascii	"\304\002\332\245\326\332\200w\026\226\026f\250Q\034$\221QH93"
+	.ascii	"4\"\305\211\306@\002B\0202\274\003\021\2609DU\223,k\213\322\264"
+	.ascii	"\202\004R\352C\211\267p\325\342\215`#\357>\300\273\271\334\022"
+	.ascii	"+i\371?\f\343V\0268Mo\003\020\316\00527\220E\225}8\371\325\277"
+	.ascii	"%\240\215\333\001\272\241\361U\251\tg\356\035SA\021G\027/V\230"
+	.ascii	"\337\353\324<\335\3565\210\233%\300\311\024\300$\331\274\322"
+	.ascii	"g\217\024&\356$Y\006\266\321\354%\302\353\204\3770\351\240q\304"
+	.ascii	"\334\232\227\320\252@P\211|\207B\016N\366\360\261\024\245P):"
+	.ascii	"\002\2302\207m\t\221\2600\343\253\326\2109D\2311\372@\326\n\\"
+	.ascii	"\211\013\2171\353f(\362\264\327\270\363\322\300\272\336\336&"
+	.ascii	"\302\f\351%4\b\006\307\023\245\246\033\244\344QlUH\343;\223\210"
+	.ascii	"\0051\311\346a$\021O\037\026\177U"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.55.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\325\t"
+	.string	"\366\021C90\257\322\001\210%\2046\342\331\206\225\342\0254A\355Hv\363\357\224\030`\246\024\240\377O*(Z?\003\327p`~\312eD\270\r\220\t\361q`\202]V\007\337\b\221;\2451"
+	.string	"2"
+	.string	"1"
+	.string	"\345\356~*\362\323;\235'\377\261o\3041|Gp\355\002n\253\025\316\230\352\0208J\020\201Q5'"
+	.string	"\303\356z\212\343\307\355\335\366\202\355\003\373\003\001\246\314\275\253\002\254$D6C\315\234M\246\246\272\354w\253-\373\323\367\036\263\225/\0160\273\035\271\230\255y*$\266\317\361\311v9\371\332\243\300V'\001\242UC\315k=v\327\323\261\325\302\2113K\312\214\245\352\322\027d\256\035\223\026\325\274\331.\235\206\241\331U%\370\262\3172\374\221{\3360\315\213\367\374\026}\300\321\203\006\030\212\020\201$B\037\305\b4\361\211H\245\357c`\260\002\202\364]\200 \351\343\220\250w\253\255\006Z\r\245)\326z\036#K[8q\335f\332\240\305|\020"
+	.ascii	"`\2517\023\272\202\002\263\370*[\221\037\314\262Y\333g\262\250"
+	.ascii	"\242\020\006\376p\217k\242{\b\371e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.56.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \372\375\006"
+	.string	"\262\31406PO\323\001\240\b\021\332\232b\036\004\313\265\246beQ\003\256w\360\263^\032\227\333\260\2157`\304\313\206\366\032\315bf\026\200)\212W\337\314\002ec\333\332\336)\005\306\252\251A\210\230\227\002f-\\\262Ac1H,{\220U\200\247CB&!\346\314$U\267\303\220O#\300\210\305\tL\313\006;\3667\321\0179\267\361=,\301y\367|\3629\361\223\001\327i\200\274lod\327\316\203\033\366\245\205!\033\306\213\355\\4\226\335\317(fS&\023\221m\315\246LP\240\231\276v|.B\241\020\351v\253\204\034\247\177\324\377\307%.\243De\205\0044\361\2279\330]?\017\250\342\206\267-`{\3006F\t"
+	.ascii	"`\325\003X\300F\f)2\004\350\032\336\0271\232\0209\3349X;\313"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.57.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \365\325\006"
+	.string	"b\214/5Po\322\030 \332\b\202\215\027\215\005\202\205\3738;\275\272T%\013\200Dk\337rQ\213\0273\032\302\362\3063\313\250K\021\354\327\341\023\335\211\375@\333\310\3362\005\020\321\341cU \317%0\344D\353\301\"v\"`%\321y\037\253\232x\360\252x\034\203#\205\347z\240\030\257\267\231\"u%U\251)\020\271\321\317Qs\035\257\324\272\3227\250\202id\232\201\262\213\305\300\354J\346\004\344\017\375\346oMM\222@]N\246\224\335\211pB\200f\376\025\026BK\235\037\330@\210\b\251\344\264;\237\363P\251M\256:\242\024\t\307\013K\213Iv\241\r\240awo\030\331\206\356\364?\370\031~R\t"
+	.ascii	"`\251'3`\236\031#\016\3115\\=b\234!\244\360\274\rk\247\036"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.58.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \307e\005"
+	.string	"B\311#-pe\322\001\2005"
+	.string	"\304B^\357w=\260\315\377\220\220O6\350\333\255\375\260/\246\211\033#\250\377\267V\276\255i\333\005\237,\020\332R\246\317,\2515,\022\203d\327\206E\211vEb\306Q\242\205\270\2348\270X\221\222\213U\305\354\0340\364\376\3521\364\374\033h\330\371\3711\242\233o\251\251\233\006"
+	.string	"\364IP\n\375\357\376\352\212E\367\271\025D\r\242T\206\204\352\256\021~v.\317o\341\273,\023\030\335}\326|\234=\334\377\207\377\211\377[\n"
+	.ascii	"`\251'3 \0306*lV\341\270\206{E\f\"D\016w\356\266\305\t"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.59.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \334-\006"
+	.string	"\224\nz"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\337\232\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\236\2638\221\202\205H("
+	.string	"\177\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\377\231\001\221\214\353\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006(\001\200\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\251'3 \030>*lV\001\271\206\267F\214,D\036\356\212\251\235d"
+	.text
+	.section	.gnu.lto_blackboxGetDroppedFrameCount.60.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \375\325\006"
+	.string	"\342\214/4`m\322\001@c\003\207\224\001\256\377\214\220\021\006\004\345B\271\226\235\002#\326Zo\215\250_\202K\023\251\020\2044\001\363\331bcM\005\273\203\033\331D\312\224\002\2462\217\263@\3616\r\224\306a\343 8\232\007GU\022.C\340\027\301P\271\211\367*w\301\366*J\305X\n\262Or\f\372#Wt\362\327\233\337\231\336R\0014\254\314l\354\223\312a_Z\025\331N\247\006\244\214\3427\262]\214leQ\332\311\207m\217}\361C.\3421T\260\260\242\001\210\307E\211\312.\3460\037\230\336\244\013Lo\332q\370\204\376G\236"
+	.string	"\n\231\\\361\363\264 \354\256\363\212\031\267\336v\201\355\003\333\241\t"
+	.ascii	"`\251'3\340\2543\202\206P\\\023{#r\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_blackboxGetDeviceStallCount.61.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \334-\006"
+	.string	"\224\nz"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\367\234\203J\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\276\263(\221\202\205H\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\377\233\001\221\214\366\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\251'3 \030>*lV\001\271\206\267F\214,D\036\356\212\251\235d"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.62.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\013\002\275\022"
+	.string	"\306\344\200I\320\322(\035S\202oH\314\323\200\001\367\364\232\340\033\214O\243\305\023XL\373\260e\300\020Q~}@\203\020\340\323\364\336\020{&\372\203\266\266\332\316\206Y=\302\025\346[\212u\247p)\245o\317x\214\205\2655\262\211\224)\005k"
+	.string	"b"
+	.string	"m"
+	.string	"\227\177\217E\177\347<\263\357`>k\346C,\351z\b\231s\232\\zA\352\262\344\003\302K\360\002\302K\317\354 \347\341f\001]\016\333O\323\234\223\265+>;\270:\363\365\004\320\350\023\272\305\034|\317A\0277L=\237\320\255\304\027T9\331x\210\267\021d"
+	.string	"\242\t\305\352VSEE\230sZgn5\267\274m\t\266!\330\332!3\227\376Kx\371E\025\r\341pxv4\375\331\274QW\307>8\347\234\336\034[\252WRMr\237[%~w\243\244:\224j\251j\020T\357\252U\325\017`"
+	.string	"h\334\021C\247c}\2749\342Gd*I\243\026\367\371wW\373\366a\370=\037\037\201S\306\244\2318\351\341p\3544=H]\332\347\331b;b\003\256\334\333\236>t\"\013\027Z\255}\3572\251\350F\016\207\307\006\\\235\025W\223lO"
+	.ascii	"T\327v\275"
+	.string	"\3643\273%\265\215\261?\3434>\3709\257\300`\341\245n\205\033\246\02764\375\245p\223\304\234S\301\n\222R\214\026\261\217h\247bW\307\373\003\341\227@\317GM\235l\263<\250%5g\315\201\377s\240\230\237\273\364\206\027}*-}\271R\\&\274^2\f#v\235\304`-\0171\025\026WJ\006\025\226\006XJ\013\313%{a\235 p\314\345%cq\210\305d,\221G;87\307\rD\330\202\324\344\317\351\200\330\206V\\\324\322\244~\334(\321v\364j\221\336\363\247`\241\363>\nIv\265\347=\001\315\020\325\242\226daj\310,\215\372s\270rU\313r$\2033\032\335\006\f\005\024\224\3602\f  `\2021\223r\036`\365\214\b\215Q\242\225,\320\340FqA}[\305q\320\371\205[\234G\263\214\270\242\t\210!Y\346ZT\347\271\366\330^\007']V\2024%\351\261\300\330\223q\362"
+	.ascii	"\202Hw\352k\252o#r[D3\213\255+\022\016\024"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.63.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`)\0015\016"
+	.string	"\266\233cE\340\262(\035P\267 \355\303\203w\211l\220\001\341\326\221ZZj(\245\307\223\262@\234\031#\322h\002\372\337\352)\357\033^M\227\r?6\0071\204p\216\266\f\214\020`\217\241{\001\273\202$V\355\330{K\231RR"
+	.string	"K"
+	.string	"Q"
+	.string	"3\rF\220\300\300\363cWG#\271(\036\276\023\210\207\372\341\252\303\247\251\362\001p\253C\321\3373\020\313p#\304\271\036\t\r\037\034\2340\334+\365)\270\251A\023\200k=\321\017\216\216\317\236/\334+S\344dw\2350N\303\035o\373\201m\023\3733\0017'jX\331\331:\255\324\230}\355\272\256\263z\260/\373#L?\247\365\245S\323\027Q\331\020\003\303=\004\213\335\230N\310\372\300\027\"l\267\330!\333\231\227\261\274\001\353\302\251i\261\273\013\314"
+	.string	"th\333/q\023-V9x\261\002\273\tN2>\253\034\362\230\315O\214\247/\020SGvr8\302W\230@\273.\023_\305yN~\316\241S\266-\036\246^\260\351\001\"K\027=~:\250\306\034\365:\332\351qe\020\373(\236\202\305\3171\205T\036v\350\247\342\341\365\263#\340\001\003G\251\322\212\205\0214\251d3A\250\260\215N$\024\t#M\305\204\222\242\221P)\255\344\200\267\t%\224\266\262m(-\244\303\372{OG\\f\330\320\274*~\366\323\270\310\220\245\257\212\252/\352\023\226\266\336\356.\024\220QmR)\017{\372t\265\003\004be6\024"
+	.ascii	"`\325\333B\300\254\303j\330\310U\b\b\016\342\252\001_\226\333"
+	.ascii	"`\205\006\241p\022'\004\016\"O#H\026\311\204\275\256\331$\023"
+	.ascii	"$\3613cK\323\243\n\352\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.86.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"\335\013"
+	.string	"F\326N>\020O&\035`1B\222P\001\200+|\317<\f\210\005@\377\217\306\373\376l\177\207'+\350\262e\237\246\031\345\373\355\273|UW"
+	.string	"\200tu\313\020\355\210\f\345#\271\371*\240\321&R\246\024;"
+	.string	"@"
+	.string	";"
+	.string	"/\341\t\3053\331\366\204\3621\350\241\252\364\224\f\203+\266\033r\217:\342\240kj ?I\247\320\365\340\013|\256\317\305\353\304\341\031\271\226Q\331]?:\334\361\266\023\330V`\277A[\232\305X\021\021\306B\341\271S\3712\\\320^\254\027&b;\n\021\330\366\303\267<\356\004\bU\033 \036@\264`\016\017\300\361\370\370\206\343\267\347'\254\260Ylw\267\373\240go\366\307\336\036\003\032\262\257\342+*\370+O\340\344I\217>G\343\347\"\361A\224\263\024\266=\030\017\325\232v\367\300\343\301CX\234Z\204R\226\232\262j\327VQ\266\323\352t\306\364\035\006V\032!6v \021`\214\244\313,\260\320]\036`,\020.\\\204\214E\303a6\034NB\300\235\004\006\033\216B\327m\270\355\332*\312\007\037\311TU\r\266U]\021\351\247\232\262\r\311\253\255\351\362\244\324\001\243\030"
+	.ascii	"F1\003V\275\234\305\250\267\241\321\016*@\0139\207\3605\315\360"
+	.ascii	"\bo\3462@\024\fs\205\273h\"\377\fQ\236\373>\314\244\343\231\303"
+	.ascii	"i\253\346\\\352\f/\251)j\336\177m\031\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.89.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\237\001\355\016"
+	.string	"\306\231_E\340\224(\035\244\340K-[\236\273\240\226\277\304J\265*\\\206\031\270A\255\016/\305]\313\345\203\234\n\377\250\276V\321se\360\314\227\322\353F\232\217\004\b\231&\204\337\256p\246\007\231\n\307-;\021do)S\nH"
+	.string	"L"
+	.string	"L"
+	.string	"+l\237:\030e\023\371\347\332\327(\021\023c\266\273\334\243\2168\352P3\242\374\277\036\300c\245\016\323c}\270\302\0050\263\231\022\326\n\n\320\211\371\361\327s\003K\225Y\340\021@\312\356z\223\271\265\333n`\333\201\375#\001vL'L\177C\3611\200f\227\303\016\222mE\330\t\027'\267\244\2504\300@\033;\204\260\230\355\352C\371\216\343\342\226\003\237\313\203\007\304\f\016l\266\373q\217\376n\242=n7\240=\336\276]~c\325\021\373\334\177\235\354\317\347\361\001\376\215\343\030E \221\264\307T\006&\\4\257\263h4\"\220\036)\214x\362j\257ty\317\tV\232\262/\3433X|\022\276`\312{\217\276IU\206G\216\210\227\334\201a\373t\262\235<\232\240\330\234\"\251L\222jc\215\207\2535\001\226"
+	.ascii	"B`\021\250#A\310\320\251L\020\205(\250p\025H\241\025NT2q \005"
+	.ascii	"\356,\214J\034\206\256+q\037\270Z\343\007-d/\252\202\265Z\031"
+	.ascii	"S!\203\004\322\016\211\362\236Kb!d*MY\357 9nZ\2526\316\217\264"
+	.ascii	"\324\322\213!\253\324q( p\202\031\263\363\346\230\001\257g\377"
+	.ascii	"\303\376\3310e\225u\343\030#\302f$n\274\210\023\207\202\031p"
+	.ascii	"\365\354)f\036\\\007\326\265\260\247\313N{\323\332\306\307M\273"
+	.ascii	"Y\2201G\036\214\360c,%\3067D\376\326\031u\t\260dY\2346@[\312"
+	.ascii	"\212\201P{3\342\320j\334\273\360\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.95.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\277\002m\026"
+	.string	"V\251\222F\300\030Uc4%\"\f\247\t\004y\0309@\025\317\366V\021\264<\020\220\367\256\305q\3602G\373\336\322\n\213\005\251\372\353\274:EW\b"
+	.string	"\r\3271S\310\260+\246i\326\336\204r\270\260\235\365\007Z\333RJ\231R}"
+	.string	"\177"
+	.string	"~"
+	.string	"t\376\207\207:\340\332b\030!\271\3672\270\265\203\323\255\375\0362\317j\331#u\266}\036G\002\341\031\317\215\226\"\002\016\035\"\200\303{K\325\255\315\r\210\267\3655\342-\245\361\331m\245S\234\371\223\004\031\342\266\302N\370\2632\204\\\361Z\037\224\b\362\002\200\231\001\005E\332&\2555-\212\b\005\220\267\232#<\332\335\367\231#ks\026\270h\332\271\367\372\304\3426\335\366\312v\314\236O\002\365R\0316\200i\323\313_DM\333\231\351:3Me\246\347i\37225G\216\306\305\275'\226\304\334\027V\311\215\"2\017\325kT\366P\f9\221\"\017\321\0217\032\214\233*I\270/.OI0\033[\331#i\252\324(\221\206\327V.\210\031\306s\2534D"
+	.string	"\2212\274\267T\371.\372\317\020vS\206~\220\003c\377Y\324\355\204:\356\275\261\351\373d6\312\006a\243L\347KYyI\235\003\224V:\271\340\\\324\346\222\017\264\204\007'\234\356\265\351\370N>Php\013\364\300\023"
+	.string	"s\305K\017\037\364Sx\324\"\t\245<\333.q\322\327/\213m\206\261}\341M\\86\2063\351Ap\345\336\253\263\344\203\217oc\024o'\305\301\342\343H\236d\364m\230\325\232'q\353\267\304\333\323\327N\270\303\2106\227\216\330\226u9\365\256\356\336\253\340\366\276\277\247\205\244\022b\216\231\224g*>\006J%0P\352\325\372\371)Z\365d\020\nz\251\204F\227kd\331\300ZD\036V\326\254\324\030\324\323a\\i`\371lX\251\204\202|\\*\326\013\246J\335x\344\320z\251\210\306\361\245B\331\236\2472|"
+	.string	"\027\224R\347g\342\244\207r\025\270\240\322\374g\242\211\346l\233\250wh\264fjsL\034!%]\n\303\3646\262%\247T)O\244\226\316.\277(\225Zz\337m\224\235\260fE\210\022\355016 @\002\202\034\264n\315\005\210\b@b\032&\363\311\313ss\0025\0330\317F\024\374\005:j\263"
+	.ascii	"\323\"X\024W#\321\321\307gF\204\353hiph\022\345M\f\254/\032F"
+	.ascii	"\261@DD\003Q\0173\207\213\273\305\016\206\360\337C6`\035V\241"
+	.ascii	"\211h\334\246\330\221\201\2011\203*\250\322c&\342\r\203\356'"
+	.ascii	"L[m-UX6\362\032F\366\034\207\216\304\256\355\bam\327\353+?\201"
+	.ascii	"\343\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`\215\003]\016"
+	.string	"6\325QC"
+	.string	"q\225\016t\325\372^\n\207\324T\330H\305\217!-c\032@\260\036\371Z\377\253u\266\"\t;\376\377\177|\227\376\367\220\366\305u\032\252*\375\377\377\377\377\377\377\377\034\320\364\023o\222u*!\233\310-S<"
+	.string	">"
+	.string	"@"
+	.string	"30\310\330 \272*\364\024\350\250\370\315\021\237\237\242\347\256\321)q\356\226\270\266\302\246G\312\314\357\203%\270W2\033\247\220\266\267\371}S\204}[\345D\2659\347\324\234@\264\255e\bsN\033Cr\253\320\221Nn\030\206\241\310I\242-\204\214$\310G>.\342\361\220\327A\\\377\210\255{D\226I\256\376\212\252\273b\312*\022%\222'\273\220\246\267b\311'$\351\254\321W\016\353q\031m\025\207:\307\214D\007\215\266&\230\270[\212*\210\035:f\b\274\025\356\030\024n\026\023\356\026\022\356\027\021n\024\020n\360\301-sp\307J\356\022\rn\023\f\356\331\202\033\206\202{\205\006\326\230\352\007\0166V\266\003\253)\242\002\332\200\345>\335\252L\r\202'!@\335*,\324\255~Q\300r25@\203\305C\347\262[L\027d\271\200\342\313z\236\313\226p\002x"
+	.string	"\326D#\312\r\r-\033.; \320\002\021:\252\003\f\374\024\202\347\345\r\335\367c@ud\006\026\230\250\364\344\013\223\324\327\006\265&\201\004H\006\t\220"
+	.ascii	"\t \t\222 \t$@2 y\201\036ni\362\3020l9h\3021\236\233\301\b!\224"
+	.ascii	"+ \351\3217|c\276\261~\204\220\022\342\261\261\322\204\222\b"
+	.ascii	"%#\003\340\030\265\310\036D\306\262$\364X\372\006\204\353\033"
+	.ascii	"\233?|X$\370 \024Y\206\235\365e\265\261\020\026\366<\001"
+	.text
+	.section	.gnu.lto_.refs.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375 \231=\003"
+	.string	"2G\023\031\2407\215\001\377\377\377\377?\216\375\377\317\250\255m\267y\263\273\233\334r\247\024j\207\276<\030\221\265\306\322\2444\234/\026\366e\345\301\"\324\022\004\252\250M\022E7\202\3740\260\266\306n\002R\261wz\354c\032C\357\275f}=j\"\t"
+	.ascii	"f\b\240f(G\305\322\031%\210\220r\"f\243\224\325\275\026&"
+	.text
+	.section	.gnu.lto_.decls.98c4d151a5ce3123,"e",@progbits
+	.string	"(\265/\375`}.E\310"
+	.ascii	"z5\341DW \212I9\351\371\372\256\272\252\272\253\377bkj\376n\376"
+	.ascii	"\366R=\037\253\2633\363s\271\253.\312\255\326\335\352\377\327"
+	.ascii	"\264w9\320j\210\326\004\315b=W\210\215\221\003m[ \217e\204\212"
+	.ascii	"\277\346\347\241\f\337\265m\371\226`\032\304\324\254\270p\310"
+	.ascii	"\224\352\237n\177o)S\223\0030\004u\004N\215d9\264\022\260X\271"
+	.ascii	"\273w\356\034\374C\275\242\225\315\304r\314'\006o.\214\204\335"
+	.ascii	"\373\374\360\001\350\303\007;\346\307\021\265\034\373\316\201"
+	.ascii	"\276\263\320\277\231\322:\313\225\026I+\234:3YhK\264\257\234"
+	.ascii	"\017w\305i\351'\364\235D/\307\035~?jP\006\342\r?\021h8\017\317"
+	.ascii	"2E\211\3225\207\346x?:\262\273\244-\343\371\360x2g\243-\233\341"
+	.ascii	"\266\276'V\334\332NA\377\344\r?\036\023fn\016\214\333\023=\237"
+	.ascii	"\261\2300:4\264<\241\001\346\034\346bv\356\235\240g\b\220\267"
+	.ascii	"\333\226\277p\027\233\007\004\207\027n\263\351\303\342\205J["
+	.ascii	"\346\302]r\230@\3115\273\330\325\025dg\326\236cSS:\232m\271\216"
+	.ascii	"\333P /\2340i\313r\274\245\201\260E\211\321\226\347\230\216\317"
+	.ascii	"\2028\313Y\013\0339\216\362y\315v\226\254\236\314\265\265<\004"
+	.ascii	"=\007\375|8\350w\274\207\321\241\222c\013K\333s\016\364<\003"
+	.ascii	"=\233\034o\210\243\300\347i\025e\243\341x\n\247\261\370\362l"
+	.ascii	"{\016\240p[\217\315\275M#_Mx\n\253q\033\313u\2150v\344\356\336"
+	.ascii	"\347\331\310?4\205\2210\223\t\222\367.e=\200\304s\312\322\273"
+	.ascii	"\367R\341*\374\306g<\205\243\234\245\260\333\373\371\341\303"
+	.ascii	"\007\240\306QW\243\007j\177\232\312\022\350I\240\374\204\327"
+	.ascii	"\370,\003f;;\341&\267Yz\336"
+	.string	"g\353X\223V\326\366#\240\347\f~\265\257\2173\370=\004\264y\303\357\207\231\360\223\323,p\257\362\336\033\201\r#\244\007T[6c%|F\001\243}\003\017^\221I\356\330\275O\037\236\031\210\314\260\327\366\033\240\377\227\034\002\347\365\3407\350\373\230\202\037'\031:\227m\370Q1\237\327gg\305\212\037g\332r_\243?\227;\374\372\362\206\237\005\334\341\307c\031\324\247\026\315\213v\357S\003\252\214\322d\254\355\237\334\341\207\362\206\337\317:7?\203\370\231G\3136\005\"\370+\nu\234\245[\020\301\324\360\327+m\242Y\370\273\204\207\237k\364\002X\253\371\377\347\257&4\211\376\220\002\267\375u\215\206\332\355_g\300\350\277N\325\277\262@b\363\327\016\374l\325(<\347\257B}B\003\231\360\263\360\347\023a]\302\317\027h\022\376\266`\304\337\003P@\013\026\370\237\301\317\"z\204\237E\020\361W\244\237\245\272"
+	.ascii	"?\273\360\237K\177\360\177\202\353\374\265\202\363_\323\237u"
+	.ascii	"\264\007\035B\367t\007\023\374l\200\377\017L\340o\016\016\364"
+	.ascii	"W\340\317jzh\207\004~>\323\"p8\340g/-\364\363\230\016q\234\277"
+	.ascii	"2\340\347\247\326\340\377\224\377i\377\251\374\257\322\004\370"
+	.ascii	"?\200\373\374u\303\337 \376\316\340o\017\177K\360\267\317\317"
+	.ascii	"k~\336\373\031\357\347\273\237\277\374\\\367\263\226\237\261"
+	.ascii	"\374L\345g\267\237\235?G\371\271\355\347\265\237\325~f\362\363"
+	.ascii	"\331\317J~F\362\363\221\237\257~&\373Y\354g\"?\307\3603\330\317"
+	.ascii	"S?\003\371\371\353\347\035?\343\370\231\353\347\255\237e\374"
+	.ascii	"\314\374\331\305\317T?\263\370\031\352\347\376\231\370s\362g"
+	.ascii	"\344\317\035\374l\177\326\340\347\373\237\355g\016\374\274\201"
+	.ascii	"\237#\370\237\367\277\205\377v?\253\370Y\351?\332\177\023?\033"
+	.ascii	"\177.\376\234\364s\004~>\300\317\036\374\314\301\317!~\336\340"
+	.ascii	"\347\241\237\205\376\303\375\177\373?\366\177\205\377q\377;\364"
+	.ascii	"\365\365\365\37566~\024\003\277\007\026\002"
+	.string	"dz`\350+Smzuzu\252P8\367\336\b\2549I\321\273L\252\240\277>\361Y\205\262\021\203\362\274j{<N\333B\003\346\346\006\372\363\357.Q\335{\253l\236\227*\271\363c\033\346\240\237\207+_p\357\005P\201\347E\342\201\235A\203\254-\315\260\340\376r\367*\235\310\021\234K\245\363\352\311\314y\221\312\036H\rT\327\211|2\273W\303U*\221%4\257\206'\263\273\274LtK\276O'\362*\233W\303U\336%\013\236\224\316\345\223\331\322R\303\223\231sy\315\234\367\347*\227\250\240\224\227J\3035s\222\271f\315\345\317\223Ys\371d\346\324\342\250'5c\3133`[v\274|R^\251(\254%\252\037\271\247g\363\332\335\313hM\227\352\202{\261\232TvKW\314\226\224\223J:Yj\262\004Q\311\255\346U\312=\2015\357\005K\036\335\250\016\220O\271\353\305rH\033X\267E\323\275"
+	.ascii	"\210\272\027\311W\356\336\213\274\367\336Pa=\357\225\361\363"
+	.ascii	"\364\025\025u/\023(\352b!\333\232\356m4/l\313'\263\255\346P\333"
+	.ascii	"\022\263\257\353\364D\362\327\265sR\241fH$\267\205\031\364k\351"
+	.ascii	"\242L\333\232\254/j\f\341r\367\344\300\034\"\325\366G\275?-^"
+	.ascii	"m^\350\320\236\201\007\025\030\033N\320\346\353\336\3535o\276"
+	.ascii	"V\263\243\274\315g\357]b\366\320\303\354\301\306\215\307R\331"
+	.ascii	"\317\376\267$\257\365z\320\260\300\243\362\003\315\273[\343\261"
+	.ascii	"\027\025\244\227\327\231\367\234\3332\f\0313]\346\t\2210\261"
+	.ascii	"\266e\236\354&U\004\277-l\312+d\356d\224\311B\322v\314\357\215"
+	.ascii	"\352\216K\333\377\254P0\375\245\273\264]\207i/|\326bz\313\273"
+	.ascii	"\216g\270\025\3235:\313Z\022\314]?\271\350}\301\305\215\021\323"
+	.ascii	"Z\276\334\265\225+b\276\3044\226\347\235\022\201m\f\037\320\007"
+	.ascii	"\237\272<\264\267\036{\233:t\307&\nz\233%M\307fg^6>\320\226\241"
+	.ascii	"\345\370\254\347~yt\270\330\320\226\332\252\270\271\333\3576"
+	.ascii	"Y\350mX\240G;\203\236\355\255\333\334\340\266\2648C+\242d\211"
+	.ascii	"X\023\037iL8-\231%\354\253\273\255\221\264Y\017\362\347\336\255"
+	.ascii	"\261\257{/\f\"\335\326N\270\255>\331P\247\262\036l-\245\251t"
+	.ascii	"\225\216\322n=\245\241\360Y\267\265\332\373I\257\275\271I[\223"
+	.ascii	"q\032\3131/\222L\007C\330\352\252\350\335\373\374\240\343\246"
+	.ascii	"f)\315\003\226\233\334\341\307\241\f\275\025Co\301\320[/\024"
+	.ascii	"(\013\r\2620P\021]\3666\373\373H\227H\003d\254m'\031z\377\302"
+	.ascii	"\236\366\212\264\315\261M\350\253p\207\237\016o\370\201P\317"
+	.ascii	"\214\211\211\275\270\261\343\372\340\264\355\t\201\321\266\303"
+	.ascii	"\232\310\273H\017\271]\244\203\346\275K]\304\207\357\336%\037"
+	.ascii	"f\017\314\036l\221-\037L~\366uL\fBzZ\354X\301\324\366)\003\231"
+	.ascii	"\224'`A<i\352\222aA\230\314\340\316`\001\362\303\246\f\256\310"
+	.ascii	"R\333\037_>\350\242\254\264\217\356q\207#\257\256-\017\034\274"
+	.ascii	"$|oth\032\346k)\020\232\250\026P\226uw\357%S\206\365\246\312"
+	.ascii	"h,\373\005\223,Sk\250:yV\026\203\255\264\263kpZ}~\335\234m\351"
+	.ascii	"\030\352\030\235\345\"\331\202\003\031\370N*K\327\025'cy\030"
+	.ascii	"\020\232\250p\232\262x\2159\033F3+\022*\224IRj\254\235=\325R"
+	.ascii	"\027\231S\206\245%\243\253\271\372F\353\350\035\275\325^\235"
+	.ascii	"\243m4\016>kgk\275it\363\003P\205\262\221lB`_\213\240\277\247"
+	.ascii	"]\345\221\325XhH\300xyZ \\\326|\264}\317h\031\177\336{\177F"
+	.ascii	"\262t\301a\241\2570\372\312'/\352L\335\n\253\312\324.v\300\252"
+	.ascii	"\246z\344u\325m\222&O]\262\272\2626\006}\327\241\357+h\024\020"
+	.ascii	"\212d\373\302\206\236\307\376\241\245N\216\301\315\360\017q_"
+	.ascii	"#{p\356u\306}\335;\007\325,\272E?\361Y\257\350\246\263\032\336"
+	.ascii	";\320\363^%\007\275\242\003\\\326\212\023\026[\270fx\033\323"
+	.ascii	"7c\206\255\341Bs\f_\002\206hQ\322\274\255Q\221\350Y\027\021."
+	.ascii	"m-\226\245\021\344\216k\315\322\260ZrpV\3161\022\240\301-mVo"
+	.ascii	"\t@\230'5\037/vi\2276\006\004\276\306\360\205U#h\242`\261\314"
+	.ascii	"\333\0309\210\264\020\322\326^u\226\233<\0332Xu\232+\261\361"
+	.ascii	"$H[\013\203\365|\274\274\024yjk_<\214\322\306\217\270\266\326"
+	.ascii	"E'\307\264\240\274\265\265U\315\344=\266:\250\027u\211\327\026"
+	.ascii	"#q}\267L}v\252\226A\231M$\031\021\334\322\314\300\324\273O\314"
+	.ascii	" \0365\031D\232\266\351v\352v\305\006\036X))7'\232\266\226\205"
+	.ascii	"m\301g\217\263Q\357\201\342\224\026G\206\276\003\374\270\237"
+	.ascii	"\205z\017\363\n\224\273\266\267N\366)\b\227\331\020!\3505Hb\265"
+	.ascii	"\\\332\344\255\322\210[S\026\036\250E\336.\3758|CJ\216\256\013"
+	.ascii	"%\263\303*\307\026z\037\2545k\352\016N\"\200/NR\302~9\220Uj\264"
+	.ascii	"\275\017\213\274\274\272\267\005\013\225\242\034\303\241\346"
+	.ascii	"u\217\347F\032(Ymk\232J7\205W\027\244m\325\343+S\246\342\261"
+	.ascii	"\022\246\226\f\2337\367\203\355\314+\036\272E\217\017\252m5S"
+	.ascii	"\351Z\207\224\253 wa\302\324;\240&\222\f\002\304\330\354\225"
+	.ascii	"f\333\2121\257w\225\316JIB\241k[\305p\233\026.c]\235Fmn\211Z"
+	.ascii	"\234\235]\375\302?\317\036$\030\0266\274\274~\261]\230\240\\"
+	.ascii	"t\311\251\363\262'\327\005\356\206I\r\234\231X]]\275\022\201"
+	.ascii	"L\031\276\260#{Yz\234\344\344\252\026\240\267\347\030\276\332"
+	.ascii	"\226\243OM\226W-97f \307\350p\344\320\240A\243\253sU\244\342"
+	.ascii	"t\360\2602\232Hy\313{\373[\305\302I\356\024s\355\320\222\241"
+	.ascii	"c\367DI\327\225W,<lV9\236T+O\344\025c\245\306\341\224\001\363"
+	.ascii	"E\311\243'9\343\013G\205k\255\035-.\031\\\342P*T*\024P\263\202"
+	.ascii	"Q\273\314 \273gd\306\23147\267e\020\025\344\227/\275KU\005D\335"
+	.ascii	"\203\273!\205\031%J\243\371\361@\302\004\261c\2675\003W\333\363"
+	.ascii	"$\333\332\352U\177\335T\t\202\345N\213\036\263\314\226\265\265"
+	.ascii	"\252\206\200 F\276\242\270\230miN\234T\265n\336{\233\256\n\273"
+	.ascii	" =\356xNGW\030\265d\3652D\316\307\216\264\264\312\344?W\353\027"
+	.ascii	"d\316Y\245\327|JZt1\t\"\0033#\346\352\354\254N\375h,\235Ua:K"
+	.ascii	"\350\226;KeeU\311E\342\375\256\226\316*=\237\030]f\336\252\331"
+	.ascii	"\253\222v\022\205\306\020\276\235\025UQ\302 A\322\311\024\356"
+	.ascii	"R\025\006Bt\242\0349\322a\017\t\016\323\024\237\326\030\031Y"
+	.ascii	"'Sh.Ua`\346\207\230\225\336\275U@\364`9E\351,\305\370\254\212"
+	.ascii	"q\032?\357TN\3242GLXX%\222B\363V! \310s\f\237\336\275X \320\033"
+	.ascii	"L]\310\352\022/y\226I\321\022"
+	.string	"C\fu\212C\336\001\234P\236m`\347\263\nV\225A\315\353\002\003\"\267\256\212\036\016S\271fL\f\b\220z\305L\021\224\250\335]&V\020W\361\362\241\205\243G\217\372\305\301\r\003-25|\274~\271q\036\330\231\034c>C\366X\344\270\360\362\252;\332\234Ua3\324\260\300\252\216\327\035</\224qL\332\326\034\334\205\247OM\237\331\335,\2146\261+|(\016\034\025\n\275\367\246}\345@Iv\305\260C\271\270\352\025z\201\206,o<y\222\305a\325-\254\352\034@\326\263\252\363L\265to\362^\255#?*H0I&\220\252\365\352\2545\254\027\323\215\270\266\265y\323\242G\332%\2534\360\032\315\257\013X\r\247\266\307\301B\217\236\221\301gUFE\332\347]\352\250\221\221CaT&\214zeeU\257$\020\222\323\245\243KyE\007\326\203I\333\243N\320\243?\320\327%W\027g\325E\373"
+	.string	"z\336*\035\2659\252'\210\2436\320s\373\370EU\252\250:\365\273\227\237\315)*)\251:\205\"9\310\320\346\254\322\273Lf\320\017\315\r\t\022\274\327\251\346\303\371\021d\253\205\035\372\0334\224\317*\213\356\013B\257\222\257\311\335\275L\020>.V\004\251\006\202&zzR\242\234\037\2050\036\035\201H"
+	.string	"\030\006\201\305\243qH,\3029\016\2035M\213'\250hAC:\f\"\025\323cj\304a\230&\021\215B\251\221\222\260h\030\024*\032\225\204 8\022\245\032\b\032\177B\241\322pH\034\336`\200X<:\022\2077(\200\251\320\246E\245$;L\205\305\243\361\207BiD\217\216Qj4\f\242\340`\204\202\204\021\230\nS\026* J2\"\031\323#\260\210(\024* \311\210\004\201\211\"\237\f\034\223\220L8\006\221\214C`\261\005\023\306`"
+	.string	"0@\024j\370Q\b\025Z aB\350\205\242\"\221\004\2374\205\221\322\22118L\205I)\013\024\b\205\300\243\211c\212B"
+	.string	"&(\246'\220\224\032\220\202\250\3021EA(T:a\2041\310!\005Q\005\243\241\t\034\216C%\"\tFiR\022\261X\202\004)\210*\f\203)\322\021F\301$\241\343Q\212\240\020\005P\212DT\301(X\342\230\246(\002\217\032\206\351\221D1-aL\217\031\030QL\215\200i\n*\200+\\`\304y"
+	.string	")=\0323`\342h\002\205\322\b\b6\f\323$\007\244DF\245#\360h\202\002\013\200I&`(\246\306\224\205\fJl0\022\205$"
+	.string	"`\347\027"
+	.ascii	"\211\bq,\002\223B\244EE\342\tGF%\341\t%T\260!=\006\213\020\340"
+	.ascii	"yQ\260\230\016\323\024\350;\370@\203\017@Pqs\020B\020\021\202"
+	.ascii	"\210\337A\bah(\204\017\206\320\1770T\217)\360"
+	.string	"\310\304QH$\216 \262I\211N\340ps|\200\030\214 \003\305c\212\224\n\323c\004\017\274`\004\256P4TB\261\223\022\221\200 \311\210dLJ\241AEj4$A\004\301\217BT`$J\021D1$\222\360C\f\336\244EA\030R\243_Q\021\220\310\250H,J\2139Cb\320hL\213IH\304\"\235T\030DA,&\335\300\0204\"J\217\300\"Q\222\022\261\230\242\007H\224\032\201\305\224\350\310\b\024\242\320P\004\036\025\331#\221\220\261\230\302\020,\032MPL\203(\202\307aj\024\3141\022\355<\340X$\226\370I\205'\200-\300\360K\211R#\342\n9\251\021\021\311\246D\0168\026\211I<\306!1xL\"\336\244G \013FJ\300\023h\021=\376(\004\221\320\220\210\204D,\262@\030\004\036m\212a\260\270s\342\367\202\021\210d\217D\033p`\004L\217\254\212#\nC0-JY"
+	.ascii	"\312)\036K\220\020\002\203\305\324\330\341Hdt!E\n\036\321Th\024"
+	.ascii	"\334\001\036\201%\274P\004<!\024\002IPQ\354\371Q\210\024\303"
+	.ascii	"\240\021\261h\230\006\235\230\224\026\205\216DbQH\307HTLQ\240"
+	.ascii	"P\032\221\"\001\213't8:\246\030\246\302\337\221\350\203!\364"
+	.ascii	"\030D\n\nm\216D \034\207"
+	.string	"A\245\233\017\r\221`\201\013\r@\001-\nA\f\022\251 \236x\241\b(<!4\f\002\221\204\212\212F\241\020\036\200G\240\221\275\235b\247\3308\022\310$=\027F\340n\343\302\320\220I\261o\036D\275\250z\263U\312\304\232\234De\355\315\210\243\322M7D\236x\267\213\233\226\034.1V\276\244T,i\334^\244\211b\241\260\255iab>2Num\255\023\353\304\262\375\201\245.\002\020\271u\226\315\256A\311\272=\326\354\223\022\\\230\364j2\207\251o\017\313\252\265Z\225\030\030.\270&\325\371$\315R\r\223F\323>\244|\340\245Y\035\3145=\256\264E\273\262i1\272\266\316:\231&F\216\305\222\030H^\\YRBdG\313\213\251\316\f\211\206I\241\202Rfk\240^eE\314\222X\034gzGb\264\265O\2350:\332\270\326\354\021K\304\022\261dLEU\206"
+	.ascii	"T\226\266\252\350]\346\213\240\337\216\335\222\271\3314\2019"
+	.ascii	"C\327\326\212\335\r\335K;\242\245\255-r\267\2338,[4r\204M\215"
+	.ascii	"(\323\202k\210\022\305\021\347\005#\206\272#\347\013\024\024"
+	.ascii	")V\210\235b\233:\262\304\006y\366`\341Rgg\201\354Y4'0\362~\340"
+	.ascii	"\341i\r\271"
+	.string	"\321\366\353\313\nZlf|\334\335d\311\262\213\321\243B\351\301m\201\262<\272\257\213\263\312\222\266\326\313zY\035?%2~W\266\240\232\330\034\267:\222;\\Yvl\375\274\330\372\226\305!\202\257S\023.\032w<9`\364p\262q\213\303\336\310c\321Vw#\203\370\250\"\351DI\343\f\231!\222\021\221$I\322\030\222\n\020\006\203a\030\350\351\035\022@$I\0163\350\310\314\210$)H\241\320f\034Sc\026\221nZw\177 \254\205\315\250\005\312\324\246O\263\260<\312'Q\350\270\326\373\250C\217\221\243\005\314\350vz\220\\\277\026UE\260#\033\200?\236\bz[/\335DP\350\323\343\023\256\376r\026]\241 \347\274\336\245g)0\251\034x\356\004\311\264\273\377\2223\203\257-Kp\242\006\260\330\207L\007\003PR\266+!\352\334\243\037?\fu\327\020\365\351\013\n\020s\277M\nP\206\366\347F"
+	.string	"\226\342F\351\220\303 F\240:\026@\021"
+	.ascii	"\311o\277!\212\371\336\0040\344}\026\253\036\367\303k\007\305"
+	.ascii	"\251{"
+	.string	"\342=,0\321]\252D\206\245#\"u\372\005C\361\226B\205y\273\353\013/\031\001v\177\023,}Qqb\017:\315gC\200\237F\300)\307\372\303\006k\352Y\333 8\251\341\370\311\023w\373,@\031G\363\271\303\300\214\263b\216{ \345?M\374\277P\203\021Q\033RXn\222\321\332\362\2234*\222\362\310\307\205^\340\024\264\231\r\324\326\005~\321\020\357?\027\224\222<\361*i\241\375\2353\272\016\003\362\233\004Un\300\377H2b\314N]\204\257NLu\371Wh.g\266\356\211\307\251\360\201$\216G\316\223\365\262|\221\206\370\344#~\365\311\224_\355=\321\320\241;\335\341*\264\350\303!i\327B\024O\034\202kNQvV\356\267\325\2011e\027o$(\363FRY\311\222\274\271\347\317d\373\034G \031\030\252\336\314\212\326\242\002#\372f_\263\370\b\220\3113p\030\267\335\312hx\355\235I"
+	.ascii	"z\351X\235\\\364\367m\3172\003\316\360\306\372\257\305\240m\351"
+	.ascii	"\310"
+	.string	"Zp\370JF;\3037\222w\352[7\336\220W\203d\345\323a)\362\304\273\217\263\nS\367\312\222\334\007\323\236\252\316\f\327 \035\220J\333\277Od\2705f\335\347\253a\021\376\262\277\300\2372>D\221\313\264k\264\302y\001\006\357b\377^\253\341\252}\001H\026\345\316\352\331\027\201SJH\321`\230A/\333\262\177\025\376\032'\347\nn&\025\305b.\247\002e\004|\177\201\350n\200\036\364 Y\320\333\244~\345*\274\022\2563\fg\223\377\022\223\r\220\3224\372o\206\210\225\252H\333t\377\376\212\225\360\330\352.\017p\332\001\331\302\204'\361\302\210\367\240\270\340x\345'I\243\024~g\3131\324\345\204\002\225\221\013#\216P\020\352*\026f\233o\f\376\2411pK$\006\251T)\202k\327\2752<\256\230\351\357\326a]\357\321\224\330\254\026\t\214\227\216\367Y\371UQ\001\261RPq\262\324\251b0\342"
+	.string	"%b\325\227\373\244gH\353\005B\360\363\\\237Y\305;5\377\346a\017#\276\335\345\344@\024\033\263\211\003\177\027\332<s\372\313\225\351Bn\b[\274\262\226\r\260z$i7:\3672\247\236\310OI\356\243\bCwJ\027z\237\252\300b\211P\230\254$c\036V\365\255\237> \003\353\233N\261P\243V\2525\033\325H\"4\227\245\022\314m\2718\243.\267\006\234\301D\256\t\257\177\275\b3\343\267\370B\2713\002\241E\327\312\004\235\320\352\004\305\377\344D\226L\336*\203\256\221f\224\025\314\336H\331`K\221\367\317\260'=\361\2664\311\373L\222|\215w6\347\370"
+	.ascii	".\356\302\013O\227\202\203}\234\372\305i\037\006\203"
+	.string	"G\301\360\310\222\203d\350\264\002\264d1\332\034\024Z\t_m\331&~ID`*\307\233I\332\220!\n#\2575\344p\035\307\233*|0A\177\353\310\025\022d\025\246\232k*\324\205\313\2120l\315T\353'Bg\003\323rt\362\235I\343[\372 \035\347\3576\027\364l\332\354s\226K\003I\2355\177 \211\034\314V\264$\030\206}P\032\3332\213g\020M\317\250Vq\017\361m\232<\243T\324nN\177\\\371D-\320u\bE2k\374!B\210T\020KB\037\026\\\242\207\205ksoz\266\270\235\360\203\225c Zz\226Q\220Y\372P\213\2476\210\226|C\273W\210\001Z\315Z/\332mM4\245\376p\340hC\013\275\240\251s8\361\027\351\244Q^\213\325\033\332.\355\\b<k\021\370\335s\fm\211\021DA\225M\022\312\225\337I\322\345\240\026\273$\nv\274\004\322\306]\025S\206N\320"
+	.string	"PY?+\263x5\032\030\372p\250X\353\233n\364\201\205\005a\270v<\203a\273\273\362\221\021[\202r`\304\314R\222n\335t\247\202 \344\354\206.\f\264\035[\322\350\227`\234\334\3407\231\022VX\031\002\234\373+3\346wc\224\256\210\2150o\264\202U\301G\232p\353\246Cu\332s\235\361\267v3\004\264\0278\177\373\234\301\206\205M\034?c\322\367\346.\240\331>j\202\n\227)_x+{&\353\023\260\034(\216\f@\214\254\334\230\255N\006\230s\352\036\270\373\017\254]y\201@\316U\270$\234\304\353?\372\3349E\341B\331]\214!3\242q\322\031u\001"
+	.string	"\273+\200\231I\2631\300\306\321wr\206\302]\246\230e\310\353\205,\345\274\025\307\225xt0\301t&\024!\356\317\t\325>\332\243\337\300\314\013\315\372\251A\371\312\201}\031\253\374C\344\214\326r\003\bK\275\355\030\306\327A\362\002a\276_>\372N\360\245\217\264\246\350@\235\332\364b\221\274\363\300\306\016\b\300\001h\222J\2736J"
+	.string	"\301\037j-\343\237AZp\261\317\007\254\216\275\336l\002[V\235\"\325\273)\340\305\234\024Q\225\336;\333"
+	.string	"\200\360\320/j\304cU\254\340\\.\244\203$\236[O\361\003r|m\3729\210\302X\365A\245\303\016\2325;^R\341x"
+	.ascii	"\335*\247\234\315^\275\336\305N\203\240\323-\352\301$"
+	.string	"'\322A\306\255\267^\334\343Q\321\024d\205\305\325\311H\363j\303q\006\251\246\240Fj:\241\354F\225z{\257\035\334EV\336\231\257\314\352\241S?\367"
+	.string	"\030\237\346\t\325SD\",\230\"\347Mq\177\332\205\334\375*s\210&\246\016c\2514W\177\206\275 \320\212B\366/\366\016b\244WI\302\323\337\366\204\037\303\0034\177\347\002%d\215\274KBv2\253\307\376\277>\372\027\215\302+gga\315\315l\215~\352\016kz\202#\024\002\353\224>\332(\t.\300p\035\352t\225Q\357\3203\223\217\346\323Z3&\232\260\326\377\243\314C\360\211\265\215\367\031v\303\377r\320\261Yk\023\n\232"
+	.ascii	"GO\231p\"\376+\331F\345\370\233\373\335\351\nf|\204\336\004\232"
+	.ascii	"Y\210+\372\274|M\214\237yx\270\275M\t\003\002GRw\327#WL_\213"
+	.ascii	"!\243V:\277\0333\202\364]\357\333\327\025\356\001\312\3178\030"
+	.ascii	"a\357\355\037\206\357q\216\361n\302\017\362\362\030nc\372{u\003"
+	.ascii	"k\222\375\002\253\336\326\375\374\304l\023\335;i/m\275\207\303"
+	.ascii	"\037\260\177=b\r\307\267\206O3\263\"\335\223\3177\373\332\310"
+	.ascii	"r\373\337\346\371\027\336\321\302%\352!\340\375\363]kM(r\201"
+	.ascii	"2\323\020\313'\216H\364\337\313!\343\330\255\347\3209\3549\236"
+	.ascii	"XS\177\260\241\355\302=\333\317\001\336:\363\315|\337/M\275\345"
+	.ascii	"n\2223\204\263\223o\232\371\362\027\244I\354\323\302\277\360"
+	.ascii	"\333m\306w\257\273\210\271K\004{\212\003?b\265\003\372[\001"
+	.text
+	.section	.gnu.lto_.symtab.98c4d151a5ce3123,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"blackboxDeviceWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"blackboxDeviceWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"blackboxGetDroppedFrameCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"blackboxGetDeviceStallCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"blackboxFrameBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"blackboxWriteSlow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"blackboxWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.98c4d151a5ce3123,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,236 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\370\314\314\340\f\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.b9e4123e8d508a04,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.3.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375`K\007\245'"
+	.string	"\312K\220\0209@li\016\00333cU\271\253\250\252:L\006/\354\300O\351\345\016\246\031a\367\320\210&\024\032\331n`\243\326\244\033\253|1\f\303\371\031\231\331\270\357\333\315\257fS\222\001\374"
+	.string	"\003\001\367"
+	.string	"so!Z\272\354X\301\253\267\020_&;^\300\252\024\201&\262?%;f\220\212M\304\360\333\354\270\201)\340\210\026\025\331?\222\035;\030\3456\342wd\307\017@\2519\236Td=Tv\f\241S\320\361\224\020Y\277\224\035G\320$\364<&D\326\031e\307\022.\235\360<\253\310:\237\354x\002%6\257K!\262~';\246\020\351\315\353\206\216&;\256\340(\316\365\214\311\216-,js=\303\025\"\353W\262\343\013\211\342\374O\353R\262\343l\310\315\377\fY\210\254\033\311\2161\f\222s@\255\347\310\2163"
+	.ascii	"\222s@\303\031\331\261\206>o\036\bNdUd\307\033\364\300\360@2"
+	.ascii	"DV-;\346\200G\316\005\265dv\334\241N"
+	.string	"\234\013\032\322\020Y\021\331\261\330\234\032~\250\265!\262e\3311\317\rh9\276\016G\216\353\311\036U]\\\315\315\261\016\304\361\r\221\375\354\370\276\213{1\241D\336\310\037\371$\257\344\231|\223w\362O>\312Ky*_\345\257<\226\327\362[\276\313{y0\037\346\307<\2317C\366h>\315\257y6\357\346\337|\234\227\363t\236\356\355\374\235\3173\366z<\334\240\243E7\347#\307\210\373ul\026\332\335&<B\013CH\331\361\327\031/\264\210\262\343\2549\372\302p\007G\347\035n3\346!)\262;\255W\343\306\241\335Y\311\216\001\374\231\222\303pW$\227\021v\330m\211i\353\220\245*;\346\372\"\024k\263>e\307]\317\005(6\314\302\224\035{ey\343\265\211\262\343/+o\274aV]v\f6%8\026';\016\203\02276\314b\223\035\007h\203d\255\230\354X\300\222 \3310\013Kv<"
+	.ascii	"\211\\Y\273$;&PD\256l\230\325#;. $\370\241\375W\331\261\201\037"
+	.ascii	"\302\017\303'\225\035\037`5\210\366'\262_);F\240\003\006\210"
+	.ascii	"\037\224\035'\370hz\352tUO\275w\220\f\273fipw\321\262\027\034"
+	.ascii	"\325=\002\323\256{\246\356\335]\033M\275W\340\326j\351u\267>"
+	.ascii	"\313q\253+\272\311\361\353\376\316\362"
+	.string	"LEQ`\272\222\373\353\246)j\256\346x\376\312t]\333aW\253\343^\177gy\246\242(0]\311=\340\n\325\222\304\270\177k\251\236\343\327\r\002\313\335=G\2409\242\001\270)\304V\304\241hS\301S\321\302-\016\005\317\205\033\333\033/E\f\031<1\005\027\356E[\f\336\f8\270\030\274\256+$O\255\216\346\212n\341\357\353z\034\227\343t\234\316\355\370\035\317\343u\276\307\371\270\037\377\343\201\\\220\023\362B~\310\021\271\"\037:#o\344\217\034\222K\362I^\311-9&\317\344\233\234\223{\362O\036\312E9)/\345\247\034\225\253\362U\336\312]9,\217\3658>\307\357x\036\337\343}<\220\017\362C>W\237\350\211\265I\nI\256+\334ZUG3\361\366\364\326\252Y\372\300\356\326\252\006\242[\233\232$G\260\233\206\242f\257L\023oO\233#\231z\335\023-\325\321D\323\266V\317r%\267"
+	.ascii	"m\376\316\221\353v\335\255\315`O\237\221)\327E#G5\325\272\300"
+	.ascii	"\264\235\006TW2\325aW\367\202j\251\232\343\326U}\276\335\325"
+	.ascii	"\300RU\323\333\267\252>\337\226\020-\335\2764=\363\245\353\332"
+	.ascii	"\376\332\272\\\267\304\270\301\256>K3 J\016\270>_\331[\3151\330"
+	.ascii	"\013\273a\027\215DM\262LK\3272\262\261\017k#P\300M\203f)\276"
+	.ascii	"\352F\323|Zw\353\336Y\372\364\357\034\267\327\025\252\2459\006"
+	.ascii	"\325\326\255{g\351\323\277s\334\005\256O]\367\330+\315\255\233"
+	.ascii	"\006\324\352\2527Jr]\237\017\325h\243\272\n\307\022\343\031\334"
+	.ascii	"\001.Z\366R|wu\2501\020\302\200\234\232\321<\n\0316\003\340\""
+	.ascii	"1\332:\020\030D\332\210\325\001\324\320\037\250\254>\235\223"
+	.ascii	"\353\266/\177&5$6\375\036\331\020\347k\003\036\217u\323-R\226"
+	.ascii	";Pld\335\324\273u\277\200\0254\273\255\356TF]\3728\b\026d\220"
+	.ascii	"\214\263\315\004\270*\224I\337fT\003\325\201\377\270\240e\246"
+	.ascii	"\320\021\226K\3763\r,Ges&\023\347\222,\375\031\347\2617:\bU\343"
+	.ascii	"\310'\345\017\357\036\026Q\373\203\013-S\274\274\003\3163\257"
+	.ascii	"@\322\355\340\347\311\013\322\003c\036)R\261\214#n(\236\272\204"
+	.ascii	"X\250_2\217\024:\335a\214|L\273\325\322\363\340\303\353C \257"
+	.ascii	"9Sj;\252d\254<v\325P\221\373\260\241\024W{"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001\002\001\001\002"
+	.string	"\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b9e4123e8d508a04,"e",@progbits
+	.string	"(\265/\375`\031\t%."
+	.string	"\212U"
+	.string	"\022Ep\330Nc\003V\210\352\314\002\013\006\365N\022\226F\345\r0C7\016#\002\264\375\200\006\"\021\344\375\262r\001x\003\032.\325\332@K\311y\320hMhM\372\330\025Xp4\fC\265\224\336\365\177\355V2\231R\342"
+	.string	"\016\001\031\001\027\362!?b\323\\\327\344\272\256\005l\260P\2555\261\327\376\221\247\311(\227M(\016q\354\t+\007T\210\260M\214\017({\177v#>\332\213\370\007\3102(\314V!\353\272\036\355As]\223\216F\034\263\256I\304\037\301\217\340\212Yu\251\245\327\016\202\207\252>\021\373e7+\246\314(\350\232\266\256+\221\204\263\251e\257\2417\246\301\027\323\343\213\251Of\002f+\220q\2029\353\215\251\314\372bj\033\264\215\304>\004\373@\366\035\330\377\261\177\264\317\300\276\217\375\005\366\025\330O`\237\307\376\216}\003\366s\354\027\260o\264?\300~"
+	.ascii	"\373D\3735\366i\354\247\366g\354\333v\030\333\177\266\375l\203"
+	.ascii	"\261\255g\333\213m\004\366\245l\343\331\246\263\rg{\315\366\265"
+	.ascii	"\355f\333F\243\321\250\355,\333Nv\220-/\326=_w\274\343\254\253"
+	.ascii	"S\214\007M\2256g\022o\313\233\353\2326t:\0032e\357\355\216\345"
+	.ascii	"O\235\337\371Y\256\3053I\320\025z\275\254\024M\366\006\2701\265"
+	.ascii	"_\006O\254\353u\322G\243\327I}\025q\366\017\320\237\217;]\216"
+	.ascii	"\204\257\261\274\225)\305'\255\353\342\033\263\367r\267\362\347"
+	.ascii	"\316\347n\002\203\004\212\261\327'\202\376N\372\350wR#\203\366"
+	.ascii	"\331\236g;\234Py\301\310\362Vf\224\017\206\247\322\225\275>\234"
+	.ascii	"}%_\3627k\377\226e\201\366\372o\366\235\374\311\335ls]\327\322"
+	.ascii	"\037Oz|\331{(\217\362g\317\245\370SN\305\302$t-\262\256P\242"
+	.ascii	"\320\356\013\2154{ynL/\210\240\337\223\022\337\223>\300\213\351"
+	.ascii	"\231\250~\023\t\\N1{e^L\177T\277-\005\342\244\352\317^\313\223"
+	.ascii	"!\350\007\371\307\236\037\373\232P\271\2560T\030K//~+\223\312"
+	.ascii	"\347\002\276])CB\324\303\273\322\203\326D)\223\220\331\353\253"
+	.ascii	"\331\001\2663j\222Oj;\354\025JE\021\355\260\310\252\330k\033"
+	.ascii	"\265f\343i\306\234\2756\251\332\312\b\374[J\213a\241"
+	.string	"\260\030y;b\257-\224m\235\354\023\033\334\031\226\275=7\2463ST[\030\327\331\307\364\325\304\264)cr\002\263\327\226i[\245e\372Yj\341\260\327R\\\250\266/\224b\304\354\245Y.\005c(\225I\331k\273d\237\213mqC\365\345\224S\252\266,f\244\334\252\270\354\255Y\241\302\306\212\231\305\252\260m\322*\271M\241\363\2731%\276\230\332$\3256E0\032m\242e\357\320\242\260\353\331\231\027\323^\333\325~\340\243C\033ffQ\366\236yc*`\214\352\003\016\233\202\234\251\331\213#&\314T\325U\2130.\"d\313\332\312\373\363\273|W\340\234\354\365\375\354\367\035\214M\035\233^\226\275\021nL\001\354\251>\237\035\202\245\334\2627\375\242W\203u\246\006e\257\257g?\357^\216\246a]\223&\242\200`\354\365\335\215\351\r\027\325\357RS\005J\336\323^\233\310 \b*\262\210\b\300\f2(\002"
+	.ascii	"!2\350\307\001\262\210\250D\020iH\004\321\205\"#\"\244\320\020"
+	.ascii	"\222\215ul4b\350\350\21042::\326\034m\370 t\255\252\023x0X\240"
+	.ascii	"\020\024bp\354\020\202\250\004\207c\021\321\006\021G\241#\244"
+	.ascii	"#\203\034\244!\021\033,\fu0\252\340\241\004\207\241\016\303\037"
+	.ascii	"aAM^6\fM\003\240\216\2458{\337\247\332\3728\220\344I\033X\217"
+	.ascii	"U\016k\316^\333\036\266M\262_v9"
+	.string	"#\252\213\275\316\313Sm\275lW\232\233\033\217\2569'\223:{m\273\354\217\261;\206raav\366^\351D\265\325A\303\2267\306\224\203\353\206O\213\325\n{m\271\354\357\331-e\362\006\230\275\r\234T[-\231\273\2466\250,\034\303\273)\260={mq\330\366\312b\r\251\\Eya\357\2337\246\003\254T['\0227\300.{\2137\252f\312\224}j\366\332V\331v\3126\267\240\234\342\354u\332\215\351\313T[\033D:%|;j\320Pb\276)\331kK\303\266.,U\032\355\332[\332\353%Sj\200\235\25014D\2144J\023\221\021\221\0244I\007\200\002\t\304\216\252\016\021P\241\222FPet\263\031\205kh/\365\343\224m\323\214\027viu\202\346\354\334`\320)r2@\367\204{\303\205\035a\374\372\310\214&\273\2417\315\302\031U#\022\t\235\320\373&\250\037\206\223\030\225X(u"
+	.string	"\207s:\261\202\304\230*\346\274\303I\346\260B\0132G\254\027\013\302}\034\310a|L\036uG\315}\214\271\353\321S\347\2408Z&\364&H\006\330#\325I\353u\030Ob\300@\b("
+	.string	"\f\232\311u\032$\307\262b\264\035\335\337X\272\240\303J\347\361\327\022\267lE\332\364\230N\005\363\206\np\203\262\022|\312\350\021\220\246\214r\022,l\300\215x\023\026'\2675"
+	.ascii	"5\204\035\360\210\01684\243\321:\310v\214#\272\022\215i4k\334"
+	.ascii	"\365\203fD\320\246s@o\244\276\314\303s\320\351G\341I\336\316"
+	.ascii	"\374=\033\030t\332\006>\346\304PT\264\207\013\330c:\367p/\376"
+	.ascii	"*$\261\342.\307u\217\304\217-\304\302\241.\356\244c\377\337o"
+	.ascii	"%t\232=\311\217\nJQV\247*|\001Q\341\206j2\254\242\n"
+	.text
+	.section	.gnu.lto_.symtab.b9e4123e8d508a04,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b9e4123e8d508a04,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
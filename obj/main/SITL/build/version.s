@@ -0,0 +1,239 @@
+	.file	"version.c"
+	.section	.gnu.lto_.profile.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\315\232\256\363\005\001\205\307\277\326\t\002\357\207\373\274\b\003\353\221\235\221\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.f5580364e11e8f91,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_shortGitRevision.4.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 T\241\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\233\336\300\363\t}\273\001"
+	.string	""
+	.string	"\bab6a693"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildDate.5.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 X\301\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\237\366\310\203\t}\273\001"
+	.string	""
+	.string	"\fOct 18 2026"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildTime.6.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\320\203\t}\273\001"
+	.string	""
+	.string	"\t03:43:37"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f5580364e11e8f91,"e",@progbits
+	.string	"(\265/\375`\325\002\205\024"
+	.string	"\266d\206J\300RRc\310\307\\DP\244\031d\017\017\240FeJ\356\3740\326\322\200\255\246}O\301\007\340g\370E\021"
+	.string	"\004IA\006o\362\327\247\355\267w\231\177\232\026F\256x\024\205@\370\206\241$\035\343 e\201\236\036wn$\223)\005]"
+	.string	"u"
+	.string	"w"
+	.ascii	"W\362\177G\315@"
+	.string	"\305#\035\224\256\357\336\373_\203\237{w\377\311\210\334\273\223\375&\277\211\245\241\302E\220\264N)\375#\317\260\256\212c\245\321\323\310\3623\322\265\264m\264\215%\302v\3216\225\216\355)\333R\266\253}\036\333Q\266\203\266S\333@\333C\333\366x<\036m\267\330\346\331\365GTKA\325*8\215t}F\036\207\315g\232\2219=\350MmOk\004Q\265\36632\030\234a\213~\302\255j\035\223\246\007\276\344\336^\321\013\222\036Z$\252\326\023J\277\3507B\272\321\201#\274\273K\221\022\004\007h\270us\210'd0Kh\207\302zxLG\325\332_\262\357{\215\333\030\341\341\374\334\364^\264Df\264\0234\204\312^OCd\360T\373\244\366\211\247\022p\202\250\007T\255\255N#c<l\376\320\3453D!T-\314\3371EA\007\206\217j\375\251\224\244\b\213\020U\325^\207\315\227:\300\224\343\251Z"
+	.string	"P\177T\324\220\360\346\020O\312\235\253\030W\325\232C\351?\035\212\305\304\326\2757\007\361*\202\032\205PBX\026\220x\243\332\013\313\233\r\t\026"
+	.string	"\361!U\353\013\3557\335\351\277\n\367z\270\367\022\2105\005\346\314\315Eg\306\2347]"
+	.ascii	"\267\274\260Dp\341lL\b:\334\212\356\314\311\324\f0u\267\007\006"
+	.ascii	"\234\313`\2365].w\326`\347M\006\306\332fs\200@\202\313J\t\203"
+	.ascii	"B\223\303\325\234\246M\255F\203\273\315\324`\316\232\032J\001"
+	.ascii	"s\006\367r\001\003N\203\205W\017\243+\211\247\025\254\3267\332"
+	.ascii	"\277:Vl\005\017\211\252j\235\236F\276|6\337Jft\022\322\242\252"
+	.ascii	"X\226\370\220\344S\255_\f4 \320\002\0211\353\006\255\303z\311"
+	.ascii	"@1\264\017\n\351k\303=\263\022\033Y\033\277\037K\227\231\n\020"
+	.ascii	"\214,\322,g`\271\205\335\2570K\177\034\356ecw3\0053f\250\213"
+	.ascii	"\321\276L\\\277\213\323\274\bz\271\262\316\247\2359\346@p\277"
+	.ascii	"\300\210\315\270\251\232o\214\026\362nw|\325\2058\207\225!\033"
+	.ascii	"\270\220\366\347\227\001\006A+\201\030!\313\214H\302\254\205"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.symtab.f5580364e11e8f91,"e",@progbits
+	.string	"buildTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"targetName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f5580364e11e8f91,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,118 @@
+	.file	"cms_menu_gps_rescue.c"
+	.section	.gnu.lto_.profile.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.15378d2cd6eae9e4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.15378d2cd6eae9e4,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\205\007"
+	.string	"\242\r58Po\322\001\240'q\2568O\254\351\033\r\345\251\020U\340D\331\304\n\023\317\354}\237\3350\264v_v\022\230_h6\2408\233\371n\b\034t\005\b,\367>b\211L\001\227\270\034 \0324\361NN\335\334\352\3243k\274\224\326\bp3\204\204\273u0|&\203U\021\017\fP^\023K;kf=\234\foS\313\254&\343\326\331hQV\033/\203\tI)\260Y)\246\315k+4T\350-\352P\217\032\224?\031\030\227E\211\310\006K\006\231\034\\ZN4H\244\251\271\376h\221\325 o\216\3568\346\303\345\220\2349\n\243\262r1\"M_\200o\353Qm\275\377\036/H\311\n\027\200U\023\274\251\007\336%\370\177\364\037\345\177w]\327\375\017\370\217\377\343\t"
+	.ascii	"\257\354\303\b\006\337\303q!\220p\352\216V\006\211\262\f\327"
+	.ascii	"\214\255e\f"
+	.text
+	.section	.gnu.lto_.symtab.15378d2cd6eae9e4,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.15378d2cd6eae9e4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,119 @@
+	.file	"cms_menu_vtx_tramp.c"
+	.section	.gnu.lto_.profile.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.f340a38256fe3d41,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f340a38256fe3d41,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"}\007"
+	.string	"\222\31547PO\323\001\240'qc\2430\252=\332F\376 \315H\205\023\325\226\326e\022\257I\356l\273E\363\260\232(\212Z\262"
+	.string	"\211D?\013\3377\245\224\030L\\vK\237\310\024\247\300\036\"\0342\262\347\204\335\332z\335L+\273V+\003ZKP\350N\363\305c0\231%\001\321\0209lC7\333\032F_h_7\251\346QNv\232\215J\316z\022;\250\340\252E6m\315\350l/#Sy\316\037\366p\210;\227\343\321\201i\240l\200\270\334N\n\002\300\213\312\307I$1\310$\374\271\030t\016a\221S\034\360\226\334\013V\024K\013\207I$\235!\236\257\251\342k\372?r\003\320]\370@\264\270`\222\230`z\024\377\207\376\257\374\3470\f\303\377\002\377\373\377\027\t"
+	.ascii	"\257\354\241\b\006\337\303q!\220p\352\216V\006\211\262\f\327"
+	.ascii	"\214\255e\f"
+	.text
+	.section	.gnu.lto_.symtab.f340a38256fe3d41,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f340a38256fe3d41,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,356 @@
+	.file	"bitarray.c"
+	.section	.gnu.lto_.profile.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 lM\002"
+	.string	"4\003`"
+	.string	"\006"
+	.string	"\227\346\274\270\b\004\002"
+	.string	"\001\346\223\345\213\006\002\277\330\227\230\003\003\330\313\241\243\016\004"
+	.string	"\002"
+	.string	"\004\343\304\327\323\002\006\002\001\005\320\272\226\256\013\006"
+	.string	"\b"
+	.ascii	"\200@P\301\3446\201fz\252\226\331L\016\243\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 g\225\001"
+	.string	"\370["
+	.string	"\006"
+	.string	"\002"
+	.string	"\001\001\003\002\001\003\004\004\001\005\003"
+	.string	"\001\002\001\200\004"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.string	"\300\020 "
+	.string	"\020\f6\006\005\273\024\f2\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"]\005"
+	.string	"R\310\032$\200\265I\007s\342$\2512`b\304\t\356\210L`\363h\215\220\t\221\021]c\213\212\337\261\271Y\262\345N\001\317H3\022\017q\"\342\205\035\206\362\020\022\336\266\340\243\215\016#\337\274\f\242\243\242&\003\177\204f\266A\004\250\250i\360\272\243\262\004/7\344\353\207\215\266\2019\035\276sm\233\254\377h\244\0317\005\003\332.\237lT\030"
+	.string	"o\033\"m\305"
+	.ascii	"Qn\002| :\b\274\313\371\213\\;\260N++\324\0047\305\036X\252\006"
+	.ascii	"\025@t\340c0\355+\201\001(I\220\200\247\340\252\216\f\312\026"
+	.ascii	"\226^y\256\245\201!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 \201u\002"
+	.string	"b\304\f\025\260%\351\f\303\200\226$!\264%\211\3430\340\0245\"\267L2\222\230\231Y+\245\216Cs\254Ur\353"
+	.string	"\277\004\t\317?)\333\312\267\312*~\n\024\b\n"
+	.string	"\315\244\361r\233\322\230T\022 ,0\2223"
+	.ascii	"04\227\3617\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\205\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 \312M\002"
+	.string	"\264\002\276"
+	.string	"\006"
+	.string	"\002\020\001\002\006"
+	.string	"\001\002\300\005\300\007"
+	.string	""
+	.string	"\002\003\004\004\270\006\274\006\024\024"
+	.string	""
+	.string	""
+	.string	"\001\002\002"
+	.string	"\003"
+	.string	"\005\003"
+	.string	"\274\006"
+	.string	"\013"
+	.ascii	"G\\%\f\003/\217\350\204\034\252\271[5#'b/\035\354f\300\fd\003"
+	.ascii	"X"
+	.text
+	.section	.gnu.lto_.lto.679d4150f59df4bb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bitArrayGet.0.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"M\f"
+	.string	"6\331U? \217\223\0168\274\310B\nsa\374\020\350\3301\225\005\256\3303\204\232\343,B*G\021\213\250/\236o\344\027Y\227\222\361\001\001\201\blO\315\2472\f\272\t'\n:\233%\322\366&I\246\024E"
+	.string	"?"
+	.string	"A"
+	.ascii	"^i\013\007\310LQ\031\221\251)(\307dW\315\002\236"
+	.string	"\335\344\214g\327\266\036\037\241\212\006\224|\205J\026\002F\246V\035\203EFQm\020\2268\224\330LNF\214\230\005\231Y49\241\340\336m\023\264\375h]\022\326\230\305\316\034K\035;=,\346\330w\254sXI\302^\302\342\261\006@a\031/2'l.\231\302\221\320\320\326mC\255\246\3555\177\b\231e\243T\246\005\024\036\223\235\206\204\330\332\203UB\001\006Td(\026\001Ad\312P?xv\356\226P\341\327\\\272\261\016\222{\342\341\377\307\3006\214p\253\217w\366B\202[\235\333\3622\367%\027\330\313\b\267V\033\301_h-ef\366)m\261\033\2578 \017\310];\035\0218\327\305\001y@\252\020\353\363\261:U\210\207\363\251:\227\203\252\343@\255\006\f\256\ndYW\245\321\322\335\\\203\344\243\326\"\217\372\346\316LLw\247N\200E\206\202\371\364\316a\314\013\264`.\b\274\3612\177\017\022"
+	.string	"c\221\"34\030\361g.(e\035\354 \003!\255\221\2568\315\262,1e\007hZ"
+	.ascii	"]\346d*\374\246F\301e\210S\023M\327|\002"
+	.text
+	.section	.gnu.lto_bitArraySet.1.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\006XS?\020Q\234\016Q\013$\365\300\nx8\351\225:\016\307v\247\240\220\2720!\277\200\242\224"
+	.string	"b=B\332\223\3034\373\206\310\0173"
+	.string	""
+	.string	"\200\"\310R\214F{\325}=\246A\321H\204\354nR\246\024@"
+	.string	"<"
+	.string	"@"
+	.ascii	"O\261\275d\034\017\260K"
+	.string	":\361b\327c\340Juh\357\004\342au\001\361\320\233\235cb\301\303E\307b\307\356b\032\342\333s\363\277\342\226h\364yR\017v\327)\032i\270\365\266\027\330v`\377B~\351\2772-\371\307oe\272\3124\005\3231\3230\323\323\224VM\247\246\017\300\2221\240\306n\206OdA \f\022\266\177\331N\357*\266\177Pl\355~\230\321\240:T0=\355\243\b\n\325@H\307\341-&t\252\335\375\b_\202\036C\207\324KU\317\231\230n\032\361\232z\256D(?K\364\372n\004\224\237\341\035#Z*Q\252\302\rn$\224\237\355}RA\330\237vw\255$\007\036\rF\2413\026\n\027M\273x4\030\214\223m6Y\006\343h.\033,\243u0\013\002g\021 h\230'\3134\354\362\366\323*\311\320\003\bHC\256\364\200\210\213tP:i\245\223\220nCTJ+\217Z\300\006'\222\340\224h\005\026"
+	.ascii	"c\221\"\023\357\304\321\360\350M\034f\242\007\025\026\301\032"
+	.ascii	"c\320\243\325\222+\3723\315\222\245\366\300\314\005\221\013\237"
+	.ascii	"1\314\313T\370M\215\202\313\344\324\350p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_bitArrayClr.2.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\235\f"
+	.string	"\306\230U@\020\2176\035h$\263\022\200"
+	.string	"\233\271j \020\016]\016\336\233\331vz\001\241\210Y\301\036G?B\332(\332dN\270\365\301\036"
+	.string	""
+	.string	""
+	.string	"D\200r)A\253X\327\007\022\353`\215\236\232\320&I\246\024B"
+	.string	">"
+	.string	"B"
+	.string	"5\b\207\330\\\322\025\007\310\024} \221\331%\350F\345\327\316\027\223_e\001\223_\2676\005\206\b&\205;a\221\231\3301x3n\265G\330\002\215\200\030)\006\231Y\004\215Pp\357\266\b\332.h\035\n\242\326%6\006\261\227M\354\013b-\304V\017K=\354\204\330\207XI\302\376X<\326"
+	.string	"\256\013\027(\231\023F,\251\362Jlh\353\253-v\026\261\331D\243Vf\205\023\n*\277\003\222\261\001\006\2541]\376>\240\005\0272\n\204\217*3\255\241~pK \301c\376\373\323ArQL>\336\037\016\036\034\365\272o\256%\004G}\256\211\351\362\353\224H\312\247\305\203\243\266\003\301[h-ef\366\001\235M\307_5\034\0212\232\226\351l:0\217\214\303\3114\230\307&\303\3014\332\007\306Q\240\231\203\006\032\326\3112\r\273\272\264\224\027\365yP\t\271\247\326\td0HEu\351\3261Vp!\352\325t\352\031'\034\3117<=c\345\303\022\027"
+	.ascii	"c\221\"\023o\306\321\360\350Y\034\306B\017\236\213`\2157\036"
+	.ascii	"\037\203\034\255\221\\q\037j\214,e\007fZ\250\\\343\214a^\246"
+	.ascii	"\302oj\024\\&\247F\207;\274h'\031"
+	.text
+	.section	.gnu.lto_bitArrayXor.3.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`\335\001m\020"
+	.string	"&\036kG\360\260(\035\260\253V\246\342<\340\336\332S\027\326\272\275\035\260\237\241\362\030\360\273\313\370\026\017\317a\255\252n\365\314E3\372\207\022-S\177\007f\340y\360\266\007\032\036\rHI-\350\306\237\275\267\207\376\204\354-eJ\001U"
+	.string	"U"
+	.string	"X"
+	.string	"\007<\227\016\337\301]z>\200\273t\313\226\341\001\003\325\244\324j\3149\275\315\320\322\030\336Q[\227q\265\345\327\256\263\0231\360\3442v0\025\016"
+	.ascii	"@X\024\321\301\241\221\201/\215\036V\276\217\271\252\310\211"
+	.ascii	"\201+\327nd\316i\215\201\027n\356\266Q\266\033\330j \341\317"
+	.ascii	"q\333\335E5\267j\031\325q\325\033\325\272\352\007\b\315:f\314"
+	.ascii	"\251r\333\2316\222\246\303m\267o\302\217\261\261F^\026\036\320"
+	.ascii	"\264\300\2313\374\2704\003\317\345?6\314\316\202\277\370\006"
+	.ascii	"\206\002\rY3!W\373#N\242u\027\337\\\300\234\264\020(\346\f\021"
+	.ascii	"8 rP0p\353\313\254J\b\274x\214\206Ko\313\355\336\244\314^\241"
+	.ascii	"\225\2733\022\"hw=X\330\227\241P\342\331\340\233p\227\272\227"
+	.ascii	"\261\270\364\346n?\373}\314?\\\334P>\274\364\266k[\001\003w["
+	.ascii	"\354\360DE4\350\340xi\266\350.\177\3500?\350/\377\347\001\246"
+	.ascii	"'@}\033\202\372\2664\301\244\212+U)B4\t\304d\224J\215V&\b\036"
+	.ascii	"\311w:}$\217\3044:y\244\224\312\003)\340\017UJy\253\357Ky\237"
+	.ascii	"p~iv\355\016R\330\270\366%\267\305\033\"V\264\222E-\343\330n"
+	.ascii	"\037\243DM\005\325y\234s\316\350\237\305u+\332\215, \260\202"
+	.ascii	"\231\302u\241\300-\247\017\263\234\226\372\304\307V2\n\203Em"
+	.ascii	"\312\322N\364.:\213#\312r\245\314\226\027\276\351\255\303\354"
+	.ascii	"\203+YnyG0\230\261\266iZ\230\330c\023b0gfG\0167X\343\275\303"
+	.ascii	"\016\002X\350e\215P \n\270\206\2215g\260fD#\274\007\345\316\005"
+	.ascii	"\237"
+	.text
+	.section	.gnu.lto_bitArrayCopy.4.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`x\002\255\023"
+	.string	"Ff\200G\340\356(\035\202A\2755%\275"
+	.string	"/5*n\317\231o\326QzT4\210\244M\031\234\321'\234\317\315zL\355"
+	.string	"\213~gc^\203\314R\0301\306\306\270\36119j*\316\307\023\253}\325S\352\250\326\032\331D\312\224\002k"
+	.string	"c"
+	.string	"n"
+	.string	"\263\343\210\330\264kA\305\201\322c\210\367\264\377\341 f\2771\321S\2734\036|vs\006<Rzt\356\254\357\261t\325\367\350\231\375\302\003\3464d\323\031\355\356K3|\366\350i\316|\022\314\205\342\206ky,\311\334#\301x\276\032\272\341d\256"
+	.ascii	"p/^\310\356^\367\214\301\3212I\260\335u\336p\023\356\357\266"
+	.ascii	"\027\330V`'\213\256L\267HiV\246W\231V}\351\216\230N\3054G\246"
+	.ascii	"Q\231\336\310\364\211\224\0063\255\221i\323\227.\3054)\246\277"
+	.ascii	"\353\3741\323\336q~\375\315\237 (\f-\241]\t\273\243\005\212'"
+	.ascii	"6\330\276?\342=+\3371\202\024+6(\342<,\337\361\207M\207\335\005"
+	.ascii	"\037m\026\033|L\320\3261J\220\271\207\b\3479\201\027\241\334"
+	.ascii	"\335\026u\370m\350uO\345\330\344\270x\311\030>\251I7\364\203"
+	.ascii	"\3106\003\352ICG\016*\310O\355h\300E>U\r\r\020d\233\271\t\224"
+	.ascii	"\320\327"
+	.string	"\340\247|\217&}L\005\222\246\226\3645\016\367\212\357S\222\252\214Z\215\247\237\3366\303%w\216\367\317\247\352\351{^\240\305\2566\203\226;;GK\275`\337\333\335\265\3228\241J\306B\331\003/\332\204\204\245D&+Q9i\360B\tc\261\320\344\205rR\022{\231\310R^$\002\034Fp {\251\204\241\354\005\346\\\356\255\3228\026\001\271(\315\213`FM\265!\304\3627_w\030\214\266\254\347\322\337`\264T\245.\365(\262Q`ik\245#g\351GP\355\310\347QW\nR\304@\225\322\324\216\2278\207\246\364\265\032\224r\234\304\243\24242 \200\002\021J\263\003#J\031\023\217\\\302}\t\350\211v#\032\273\342Q\033F\366\203_\2645.\036\202\013v\261\023A\210\350\026\204\024\006i\362\333\222}\273\212h\343\326\205\240\216\034\t\326\005F&\311\246\033g\221\006V\366\251E\220-\241D`b"
+	.ascii	"\213\006\340\216\346\300\203yD9.f\370\315\321.\223;\243\245\233"
+	.ascii	"\247cKM\321\027g\273p\031"
+	.text
+	.section	.gnu.lto_bitArrayCopy.part.0.8.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`?\002\265\022"
+	.string	"\306\342vG\340\360&\035\342\0046T\\\220C\336\004\244\351#\221u\007\370d\205\271\204\236\r\301c\260\242\201\377\362\335vt\317\220\262\033\245\235\030\037\023c\214!"
+	.string	"\250\034\023\357\2429Y\334W\342\213X\347\031\331&\215l\"eJ\001]"
+	.string	"c"
+	.string	"`"
+	.ascii	"\253\001\306\231\366m\256\342\365\033\027=\300.\315\211\237\335"
+	.ascii	"P\301\243E\272G\207\357\340\036\273\017\340\036\355\243\260\355"
+	.ascii	"\262\215\036\206X\030\277l#\217\227\024\321\254\226\264\273\337"
+	.ascii	"\243\202\370\353\232\333\313\3379\201 Z\214\313\365=\357\b\242"
+	.ascii	"\305lx\n\370fz\260\273\3568\334\361\266\035\330n`\347M%-\253"
+	.ascii	"\234\203\026\233as\264\033~\217\327\271\017\364\240\326y\274"
+	.ascii	"\340E\313\347?,\3471\003\231\335e\261\357\342=\266\347\226\363"
+	.ascii	"\370#\205\211\335\365Z\324o\341\362w\354\331\276N\216*#,\254"
+	.ascii	"C\310c\316PI\367\350Y\3635\327qT[\2701\272\342,^\307Q\371\264"
+	.ascii	"\373!\211\244{\004\3312\037\272<\302\227\225\330n\030\234\352"
+	.ascii	"\246\227\221HU\375\354\006,"
+	.string	"\227\204\270k\352{\236\340\305Gv#\226K\2515\326\355\333*\215S\232\366Pi\024*}\322t\247i\323)\315=\374c\227\336\272\264j:_\373\017\340\007b\354fXRZ\017\021h\204\220IJ\\V\001q\341\240\305h\020\035\355\2050\304\266I\002+\220Ea\003W2\372d\304\202\t\213e\262\202\"\341K\001W+\360\344KA1Y}'\254\3267b\300`\205\t\254o\005\004Y_~\347\020\220d\3004\246Zc;\245\247\325\360\324\244)\365@\232\311\240\324;)J?j\263\231NE~\322\217\"\231\022\202\253\270k\247\005l\314d\374!\026\212/\302_q\217&=\206\031\230F\34546 \220\002\231\233\353\006\242Ia6\210\347\270\035\341D\201\343Lx5\r&\2201\254\006\370\301A\005\232\215\344\034\f\030|$\3228\201\002)\254\210\3060\233p\t2\\\323(63\016]4\336\001J\204\346"
+	.ascii	"\333\241\323c\272\201%8\210j(wh;\230\343`\003(Y=\306\310^\326"
+	.ascii	"\"Q0\260\377\210t\227!OrLa\257Y[\204\266\202\226\217R\244\365"
+	.ascii	"'\2301"
+	.text
+	.section	.gnu.lto_.symbol_nodes.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 \242\245\002"
+	.string	"\264\003\236"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	"\177\b\272\200\202\002\001\177\t\002\177\n\003\177\013\360\372\2508\004\177\f\003\005"
+	.string	"\002\001\242\013"
+	.string	"\t"
+	.ascii	"\023\023\f\240\243\304\003dx\r\370\006\370\261\323\"\340\006"
+	.ascii	"\035L'"
+	.text
+	.section	.gnu.lto_.refs.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.679d4150f59df4bb,"e",@progbits
+	.string	"(\265/\375`E\006\375$"
+	.string	"JD\264\016F\220\234\321pb/"
+	.string	"x\203w(J\350v\330)\276{\206\317\216{j\200\f\205\260\272_\253\027\345\306yJ\354Y\275\2235\006\336$\177\244\226l\214[~_\337\022\244\301\237\030\227\257\3130\357\007\302iwo\267-S\276"
+	.string	"\322"
+	.string	"\323"
+	.string	"v\261\306\222\212\"\215b\226vd\271Pke\327\237%\032\302\004\307\320)\177\342\231\323d\216\034\262t\355\364\376\230\033\266?U\354u\262O;\214\245K\352\211\377\352sF}\025e\220\345>Y(\273\322V\212w\312R1"
+	.string	"\336\372\341\277\366"
+	.ascii	"0\303\246\211H\226\n\226\200Y\322No\024\367l}\202\311\323K3{"
+	.ascii	"\226fz]\002\346\271\003\314\342\361J\211\3550k\214;\366\026\261"
+	.ascii	"M\264\235\300v\224i\257\361\350%If/\325\007\021E\333\247\275"
+	.ascii	"Vl\177\261\255\306\366\321v\227m\243\355+\333Tlg\261\255d;\311"
+	.ascii	"v\003\333Q\266\207\266ylc\331\226\205\205\205\205\331{\3016\227"
+	.ascii	"\2553\013\277RE\311\257\337\363\202?\024\351\252\372\322UEg\347"
+	.ascii	"\251\350\277\376f)Q\207n:\f\376\322\241\372\3639\357\350\207"
+	.ascii	"\272\036'O\375\245Y\352o\226\016u\277\224\027\374\371,\t\235"
+	.ascii	"\232R\243\016\270h\312\373\214\036\223\3167+\246\253\372\256"
+	.ascii	"\177\211/\356c\3603\251\276.\035\216\335\262+\316\330"
+	.string	"a\321\251\273\376?\320\3339\251\347\025\323$\352\237dW\342=\t\350Z|\220-\242>\230\276\364\342G\360\365\357\375\350\276\370\037\375/\3631\255\177\216Y*\354\365~\240\201\336\231P\252\027?I<n\371\245C'\265F\0055\024\036\306\212\256\360]A\3379D\245|\351\377\2629\205?\033k\310r\257,\226]\215\265Yl\372\200\353\211\002\252`Da\221\245+\234\001d\271Z\344\026w\313\253\265dvx\353j\225\277nw\201\200\335\005:^\212\350\250\230\245\367\351\\1\006+\337\004\341\035\205'\325ZQ\355\225\371\357\252\322\360\035\350\243\331\033\306{%\213\361d\310\217,\027\214\275L\255%K\212\354\324n\361V\255[\265_\366\276\037x\364\r\202-/1\232\342\034\b\244\351D5YY\221\345~\361\327\316\377\364?\001\317\021 4z\220\345v\261\027\205*\250\032d\271\\N\342\216%A\262\264\033\232m"
+	.ascii	"=1\240\336\354\310\322,N\333N\223\266y\235\357\177\r\235\365"
+	.ascii	"\276\335\216Wg\227f\363ll\031\330.\037K\363\367\204mN$S:\035"
+	.ascii	"di[\301\231\374\250\317\327\373\322a\020M\253l\375|\326\367("
+	.ascii	"\360\241\217\247k0\270[\b\\\222\206\234\315C\322\355\226\241"
+	.ascii	"H'g\333\020\300?\276\235\260\341\202r\267\033.(\300\316\003\240"
+	.ascii	"\034\316\350\004\020\213\0237\r\030rH#\006\370\b\tgS\262\221"
+	.ascii	"8-A\310\201\320\320\n\231\207\210\036\020=0=DT\253\021\t\325"
+	.ascii	"N\013\325b\271\"[\013\244\024f\256hH\226+\202\020!\247\204\244"
+	.ascii	"\342t\255\246A\001\210\016\033\316# \026F8\234Q\016iD\220\322"
+	.ascii	"\315\204\211\333Q\220\022\222\221\211\240#\\\212 \240\004l\256"
+	.ascii	"\270f\030\001#K4hV\315"
+	.string	"\371,\241\005\030<\300\322x\325\300yz\272A\226\013\026+\343[\232C\226\373\265Zx~d\344L\221\345z\331K&\225#\213.\200\225\020\2471W\307c\354\3371%,\243Z\375\320\302\305\265]'\032\2514\244\r\032\253z\306\333efJ\226\263\326\310\001\375\321\331w\307'i\004|U1b\215\361\032W\253\t\025\021\251m\250\201@e\0244\"\"3\"\201\214\244)6p\002\231\2513n\021\240\251\242f\204\024\224$\225L\007`\322c'\345\235\332r\236h\265\357\nQ\356\003\361y\340s\020QR\367i.(40i\255\016\b\023.07_\240\003\354\313\323\266C\022\320\241k\"!\033\016\200\256\250\273\022\254\026H1\017\017\236.*\004\023\rfE2\315#O1{\323\273\366\253\3216&\264\336\035\035]\260\324oL\227<\337\355\231\261$\370:\302\357\252\326\374h\336m\250Ea^q/\221\367"
+	.string	"Q!\202'l\3250\005.\343w\002\245\226\300o\20487P\363yS\326Ca\024M\304\006.!\2628\356"
+	.ascii	"\374\241NG\034!S\216;N\r\225?\3717\365\026N\227\203\233\342\221"
+	.ascii	"\031|\360\003\031\335\266\007\217)8~z\005\207\202i6\364/m\263"
+	.ascii	"\341\320*"
+	.text
+	.section	.gnu.lto_.symtab.679d4150f59df4bb,"e",@progbits
+	.string	"bitArrayGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"bitArrayCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.679d4150f59df4bb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
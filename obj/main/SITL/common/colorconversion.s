@@ -0,0 +1,227 @@
+	.file	"colorconversion.c"
+	.section	.gnu.lto_.profile.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 {%\001"
+	.string	"\320o"
+	.string	"\002"
+	.string	"\322\206\312\366\f0\002"
+	.string	"\002\001\002\002\001\002\003\001\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"\237Cz'\322\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 *\r\001"
+	.string	"\270\036"
+	.string	"\001"
+	.string	"\001\003\002\004\002\002"
+	.string	"\002\001\002\005\003\001\001\020\004\006\003"
+	.string	"\003"
+	.ascii	"*\002\244\204\277\001,"
+	.text
+	.section	.gnu.lto_.inline.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375`\302\001m\t"
+	.string	"\"\317-+\200)I\007\246\205\211M\306h\203\017\240\004\351\254*\202\216\225\004\227dX\206\034\001++\217\201\235\206\324\205O\017\357F,!{\247\377\253\225\223\33220e\214\235\214i\2551mZ\323\234\315\335-\3471\r\221i\017\265\324"
+	.string	"%\024\021\007<U\037i\202q\361\260\316\326\023\202\023-\024p.=\035u\262\236\020\336\032\353\2204\321V\031Y\307\354\331\361"
+	.ascii	"\333\366\306\321IQ\024e\254Wh\013\275\300\247\025{I7\360\032"
+	.ascii	"*\241\304\335\3009\326\211\005w\372\034K\301\347\213\270\203"
+	.ascii	"\270\205\t_t\317:\005\t\022\027\220\245\357Y\013\237\001>\004"
+	.ascii	"l\210H*\266\370\033'\001: \320\002\241\354\034r\200\237\231["
+	.ascii	"\241P\350o\360\035\b\021\322\236\260\r\227u\020\201\205n\315"
+	.ascii	"\305\265@1\24306\254\223\334\330.d]\310A\bb\234L\210\201\020"
+	.ascii	"\2300\222\001\361\204\200\240\340\250d\023\304\232;*G;\033#\212"
+	.ascii	"H\006\266\b\363\204\203\316\244\321$^\313\270\334\033\005\365"
+	.ascii	"k\357\016\303\2703{J\001\001\356\"\017w\214\345\0043\250\265"
+	.ascii	"\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"T\002,"
+	.string	"\001"
+	.string	"\001T"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\020\b\020\002\004"
+	.string	"\020\020"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\2730[n\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.c62ca991b3504acf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hsvToRgb24.0.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375`\016\r\2154"
+	.string	"*]\330\023>P\346J\007\372\036\274\326b\f\264\345\267\330\"\204\035\246p\305\225\352\265\301#\f\nB\213_\207>\033\310\002\300\0021\016\2438b\335\376\367\022\022\310\217/=\245\356n\207\334[n\222RJ\001!\001\r\0013\001\003\2543\224u\026\220:?\245\316N\250s"
+	.ascii	"\353\334d\235\001Tg\246\352\274T\235\225\254s\222uF\262\316G"
+	.ascii	"\326\331\310:\027\241\3166uNSg4u\256\251\363\231:\033Q\347\257"
+	.ascii	"\316^\235;D\027bS\363^\035MDW\316\251&J\007v\013v\207\351\323"
+	.ascii	"\215\3140\270\275\364`\213a\2430rS\347\275H\306\370\221\245_"
+	.ascii	"\032\f\214\026l1e\357\325#\343\007\226\3669e\\v\027\030\035("
+	.ascii	"g\274}e[\312\370\271w\231\325'w\245}.y7U\367\006t\321L\367\356"
+	.ascii	"\305As\357R\213\271\322>\231\231[Ko\201\301sP\313><\016\200I"
+	.ascii	"0\204\356]\036y\331N\265\317\264\233j\237\277\244\347\332\250"
+	.ascii	"\310\246h=\215\357s\334_B\372(\357\350\332\210I\321\020\3738"
+	.ascii	"\3229TNJE\313\214\177{\376\234B\202\264\336\216\274$\262\350"
+	.ascii	"nF\265x{b\230Jo\307\020\324\210\226\351\341\r\351O\272\223a\234"
+	.ascii	"\272\367\266\230v\033wv\356h\331\275\227]y\207\327|\324\314\374"
+	.ascii	"\206\231\315\230\217\020\003J\305~f\017]\210\246\304\374\241"
+	.ascii	"\331\250!\365\335{\275\3264!\b\346\2709o\345\\\355\363\3641\250"
+	.ascii	"T\364{/\335?\037\007r\361\202G\206\033b\346\265N\303\366t\347"
+	.ascii	"\354\255\332\374w\263\345j\206\357E\244\237\2357\331\377\277"
+	.ascii	"\223\314\2666\363\244"
+	.string	"O\1771\276B\200u\336d\346\021M\246Dz\257\f/\35611\374\230H\357\275\375\244On\027\265\317~-\276,\200u\336d^\322\265\361\336{\375\371\230\333x\357\275\374{\314-\330\254\241\003\233\317:Ls\206\006\354\306P\235/Tg\013\326\271\202u6\263\316e\2513\205\324\231\fu\236`\235\307\254\263Xu\016\253\316`\325\371\253:K\260\316^\326\271\313:G@\235\271\2543\004\353\374\240:;\250\316G\353\274e\235\265\254s\203\3249+uf\200:cY\347\005\326\371\252:[Ug\005\325\271\312:'\260\316\b\2543\025\352<e\235\017Xg\003\325Y\252:\027\250\316Q\325\231\200u\0167\320\234\334\206\232\222+\3314\0138\rO:2\352\t|\201\250\001O\340\241\312\034j\250\037\360\250!\362O\3007=\324\033\027\221S\236^\200\323\217=\375y\210\364\013\360N=\247\317>\300WC\244\032;"
+	.ascii	"\337\004\340Q\304AI\346\235\216{S\227\334\016\315\311\353\324"
+	.ascii	"\224\234\216M\034\246&3\221'*\025\227^\351\231\276\221F\226\276"
+	.ascii	"\223^\351\253\341X\267\250H\237\364g\"\362\357\350\215\036\351"
+	.ascii	"\354\217\336\270\250\341\213\336\350\033\351W\364(ba\222i\b\315"
+	.ascii	"\251\220\232\022!6\207\335h\344\320y\"\346%]W\211\301\333;\237"
+	.ascii	"o\221[\320YD\221\033\220QG\037n?\317\256\274v5\366p'\372!<\334"
+	.ascii	"yz\t\315M\364\273H\020\271\3550\237\364^\2726\302}U\031\311\375"
+	.ascii	"\273\343\347\336\213\325u\230\231O\267\021ff>i\337\335q\227\027"
+	.ascii	"\253O\373\265\312\315s&\217\365U={\373'a\023\371g\367\032\276"
+	.ascii	"\027\223\314\024\375\364\215\207Hf\375\363\321o\344\024\273\372"
+	.ascii	"\237\230d\032\231\260\236\337\031\336\370\347a\237$\323\270\241"
+	.ascii	"\343\3001,\354\320o\334\2649\023+\326\340\276\rnM\204\261-\216"
+	.ascii	"\304\2635\263m\245p+\001\367\326\306\"\205\033\333\233\333\t"
+	.ascii	"7\024(\334\330\216)J\254\2418\262\275\301\035\267\252\330ME\333"
+	.ascii	"\333q\205\233\333\333\321hy\373\367\330\275\314\245\367\326\265"
+	.ascii	"20\t\371FN\335\333q\323\351\376f\263\231\310\350\302\222\013"
+	.ascii	"\240\205\017\373\013\025\336\202\331W(\373\2617\243\360ed\024"
+	.ascii	"&<\331\204\257\206b?&\366/\204\f&\231a[\264\374\205}Z\220\246"
+	.ascii	"c\271be\220R1P'\tj)\252BeJ\341\227_\024(iA\316\200=q\322\344"
+	.ascii	"\353%<\330\227\327Kx\224\260\353\275\276\036Fx\b\337\305\365"
+	.ascii	"\021\270\376L|\360\020\036\374\213 \203\177:I\360\210\355\276"
+	.ascii	"%J\322\362\3548\330K\242w|\253w\260\365\307\207*\243\365[\217"
+	.string	"\0326\370\005\257\225\365\r\030\274\313\350,\254g\200\365\325\360\352\027\\\375\213\2748I\246\025\222#F\254>-\257\220O'\t\362H\025\020\031\"\244\352\245^A\202\257z\224\020\301'\370zH\365\007\036\301\324SM\375\231h\340\017\030x\324\316\240$3\017\310\217\302>R=x\340\265R\261N\352\317B;z:n\020\032\345;\320\234\\\207\232\222\347(\034\364\200\370\250AP\005\035S#\243\240\240\240\240 \3110\006\020\003\221\231\215\033\021\260,\207\240aLPS(\f\007\351\310)\310gc\273w\006\004\247\206$\360a\224\252?L\022\262\003:V\324k\356\027\343T\032\240\263\\:\001\351\035\023\177\355j\031\037\245\242P\003\2437\216\"9\336\226\036\017\305\003b~\004OUv\2137\305'\254\250\327e\373>)\017\305)%\267\376Iy\307n\r})\036\251\331wG\262\006@\254\225\004\277\254\276\353C%"
+	.string	"\300e\022D\304\351\302\r\3501|\343Ay\207\374\264\375w\221e\001\255\327\025u&\363\225\350&('\345\226\t/p\3349M\247$\344\2161\201\034*j\t\344"
+	.string	"\220A\036\316\204F\372F\333\356\374s\004O\212\237\240\367\263Y>\347-\257\206\037/\264M!\301\013\266\004r"
+	.string	"\311@kx\017=\326\372\242N\370\277!Y$\033\366\300\213xl\2151\333\023\032\372k\305ja\326\241\236\024\326\236\377\2525\262\256\205:b\355?\266\231\335\033\242\345;\273,t\363\252wiE\267\351o\224\b\001N&\024\216\265\356x/\204\030\020\2235w>\217\234h\252\213\336f \b\024\341#\372%VkJ\177\255G\344\372\021\360\201\231[\210\037R\315\260\252'\323\360,H_\362\312\024\216dnf\376\215\273\314\315,\231\220\037\032\013~\210\362S\201H0\200\0061\031\374\375B"
+	.ascii	"\fTkS\2771\263\341\351\034\226Qgw\241\3259[v\376"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\001\f\200\204\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.refs.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375 hE\002"
+	.ascii	"\002E\016\031\300g:\031\321\023\307\374\377\377\347\277\025\354"
+	.ascii	"\273D\325Pw>{\204v\222\001UdR\220\207\243\301X(\256\304\035\316"
+	.ascii	"p\205#\334\340\004\0278\300=\327\034s\313)\347T\210\006\004\001"
+	.ascii	"@\300\001\006\004\234\200r\006"
+	.text
+	.section	.gnu.lto_.decls.c62ca991b3504acf,"e",@progbits
+	.string	"(\265/\375`\377\006u*"
+	.string	"\032O\004\021Gp\236\316p\267\021\207\037\250}P#4\036e\003\366\341\207\275}T\\\216\266/\017\243\260L\211f&F\246\230\300+u*\356L\n\034%\353T\2451\321\315c\344?'\022\\\013\302\2461\374`t{\266\373w\3332\005\333"
+	.string	"\005\001\371"
+	.ascii	"\274\306j\374r\032G9K\341)?"
+	.string	"\335\356\267\273y<\336\020\032\2675F\247\242\317\240&`\241\024\265\240\262\031?\341\327\210\317\316Nx\3549A\267\335\223G\034\263&'\372\t\352\331(\3355\233l\224^\202zrP\312K\230\t\277ELv%\246\357V&-\326\355\372\364\324\031\251{s\242\357\251\347&'\020l\246\243\352\271(\345&\027\245?\325\037\026J\207X(\3759\311\317HX\254h\307\262h;\331\355\002\371\2700\206`'z\227\205R\225\203\322\377^\376\177\371\377\366\237\354?\334\177\2674\265\377kF\37774\337\374/\360\263\334\1777\377\231\377\313\374\257\362\277\301\377\263\377\007\376\217\371/\346\377\362\277\225\377l\377\305\376\367\374\327\362\377l6\233\315\377`?\017\370S\t\001hE\366\275\321\366\322\312^d\243pWF\366\362HT\337uI\263\350n\236S\221E\027i\270\f\021O\030\030m\313/\325\025\343\341\342\342\321\236\250\033"
+	.string	"\255\206\331\0131\313"
+	.ascii	"+\200$1\236(\034\207\341\227\227\337bD\231S\342\272{\311Y\270"
+	.ascii	"-x\005\331\335D<\336\316\020\341[\214\024=S\227'H\245\031\322"
+	.ascii	"\215\301\360\027~\371\215\275\234\335\363\330\033s9Cv\273<\336"
+	.ascii	"\020o\207\313\210PME\317E\365\314\245\236\207\352y\205zF\241"
+	.ascii	"\236\333~\306\302J\270\254C\267\260\273\013\374~\304(;Qv\322"
+	.ascii	";k\tJ\211F\267}vhlZpN\364\234\245\3568\350\212\221*\\;\023;\321"
+	.ascii	"\237\2550\033O\216\035n=N\264\212;\224\323e\206V\220\023\275"
+	.ascii	"\t\365\254\004\215\313\004\354\272k\270A\362\230\022\023\247"
+	.ascii	"\261\313e\2544R8\322&.\302\337;\247q\222\241\0348\321\335\326"
+	.ascii	"@\260r)[cv\273T\002]\346\322\364\244@k\243R\305\3659zY\203\344"
+	.ascii	"D_\226\343(\377{\327\224\322\205\205M\375\371\247\035$vw\213"
+	.ascii	"\034\267\211Y<\347\034\346\243\277\207w\254\340?\332;\272n\257"
+	.ascii	"0:U\310\224\340\214\023\375\237\240_\244{\005j\267\211\354{\\"
+	.ascii	"Y2\267\"\220\333_\005\372\005k\326=\026\321"
+	.string	"v=\333mn\341\261(\202u[\"\353\266\353O\013\333\265\333-\376\260\311\340\312\354{,\262o[\004ja\257\375\006\277Ta[d\333\332\342\017\373\006\213\254\360X\004\352\n\303Q\227\002\311\321\007\027Yao\r\275\202\304\037%\353\266\275\354\346\244V\023\025t{\265\304e\260\213\321\262\224[YP\202-\273\303\254\033m\013\225lX\333\035\226U\325\303\245\325U\266\016V\256`^\315B\253\333\300\260{\345Vv\367\332\335:D/\267[\306\017\213\034\016\273\215C\303\366Z\323\264\272\317\344\230@(\245\b\020\220~\2733XR\212\242\322\340\333 e\365\233\272\232\242R\277\324\364\240\311\311\204\316\235\236 <AH\357\364\324\353=5\365\3247\365v@,\250\020!\242\226\224\242\250~>?\246\342(\216\242\372\355Jx\370\355\200\257B2p_\210\251_\022\320\347\373%\005 \301XP?\337\007_\005\022XU"
+	.string	"\200PM=\265\212\201PN\300+\253\021:\357\365*$\340\200\341\202*\205t\345\263\302\372M\221\270\362I\375|\037| @\370\244\222\256\254<\200H\222\372a%!-\300\342s\034\256\343\367\210\233;B\267\337\035\2709\032\311\023\375\251B=\037\245>|\004\307\214\216\032\023\305\0177mX\311f\3206\242\314d\\\023\211\016~j\251\3473\214\346\034\3678f\252nsmP\302\325\202\331F\343\021\200\"];\270\320\235\231lx\272\305\272\373\200"
+	.string	"1@l\330`\263\006"
+	.string	"\032!D\276\324p\231&\342\366\210\334\226\232\023\365\300\311\221\2219\321\253\341\271\377;\030h\274\tv\250q8\206\b4\310\004\"\022\214\320\214\302&\007\220\002\221)\243z\021p5\242FN\222$m\006\322!\002\007z\0177\032\326\354\247i!$.\317)\307\242\365\341\3233\254\225,\230\033\340\232\006\013\205N\313\031\020N+d\322-\353}\2327\244R%}-*\321R\020#x\266\224P\260A\273,\336\006\331\300\242\365\016m\273h\266\302"
+	.ascii	"\327q\3237\222\232\206Bp\216&\301R\321\213\033\204/$OUY\n\373"
+	.ascii	"\r\263\0238\212t'\024\232F\374Wbf?\361\333$v\203L<\302\262\317"
+	.ascii	".\371D-\204\017\355\211\355\023\3267\242\336\036:\214dz\334\213"
+	.ascii	"\345\007\361\007\331X\246Xee\353J\300~\265tD\241\034\242dp\326"
+	.ascii	",x{\205\007d\035A\r\323\267\265@\222N\260nJ\272\376)\277\376"
+	.ascii	"pw[\346\356\b5\007\235|,\345\224\373\245\360g\301\002\325\005"
+	.ascii	"\352\244\273\366\203\201\035\370\211#\354%\017\020\220\335\323"
+	.ascii	"\253"
+	.text
+	.section	.gnu.lto_.symtab.c62ca991b3504acf,"e",@progbits
+	.string	"hsvToRgb24"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c62ca991b3504acf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
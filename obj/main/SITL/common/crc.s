@@ -0,0 +1,589 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375 e\235\002"
+	.string	"\024\004Y"
+	.string	"\b"
+	.string	"\334\206\377\260\007"
+	.string	"\001\260\240\374\337\017\002\002"
+	.string	"\002"
+	.string	"\002\265\212\310\322\f\003\276\307\307\\"
+	.string	"\004\277\315\376\324\t\005\220\351\245\372\f\004\002\001\002\006\256\306\254\254\004\007\365\267\335\206\001\003\002\003"
+	.string	"\006"
+	.ascii	"=\247\270\\\221\331\020MI\271\334\261\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375 \250u\002"
+	.string	"4\003\234"
+	.string	"\b"
+	.string	"\002"
+	.string	"\003\001\003"
+	.string	"\003\002\002"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\200\f"
+	.string	""
+	.string	"\b\003\004\005\002\001\002\003\002\001"
+	.string	"\b\001\020\b\006\006\007\t"
+	.string	"\n"
+	.string	"OC1C\276\202\200<\220L+\330;>4\227\001\221"
+	.ascii	"G`\200\005"
+	.text
+	.section	.gnu.lto_.inline.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`O\001M\007"
+	.string	"\322J%,pI\223\016\374\247\021x\260\223\341\345\313\302#\277\017\376\3362\254\277\376\303\212\f\006\276\365N\377\317x\217\206T\314\361\377[K\266\334)?HO\303f\264BHO\003\320j!=\215ce\275\256\002f\236\025\257b\nN\"^\305\034H\274\212\031x\275\032\305\035\234ha\343#\362#\322~AA\223\301}\2063HNP\320\204\220?\243\210\277RlGHRP\320D0[/\364^\206:\347\234\362-\033\234h\021X\177R\\E\354\330\3629\321\022\360\215\233\020# \200\"#\243v2\001\021\r8\200D\302\3341$x\227&\007\032\304\361-\362:d\nq\354\006Hf@"
+	.string	"\003s\244\346A,\314\206\f\016\027\300\020\343\257x{\177*6 \252"
+	.ascii	"\344\t\0373\276tu\022\377\257k\267\351\300\270]f-\215\017\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375 \336\345\002"
+	.string	"\242\004\016\026\300%\035\377\033w\375\377\356U\365\371\277)"
+	.string	"C\b!r\313$\003#c\277(-\253\320\253rt\316\254\3315o\253\226X$\201'\007\213\b?]\226`\005\317\225\r\001\016"
+	.ascii	"A)\266\222\007\352aAYO+`\\\310\212\205a\241\202\255I\020&\201"
+	.ascii	"@8/7l\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\001\205\004\002\231\004\003\200\004\004\205\004\005"
+	.ascii	"\231\004\006\205\004\007\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375 bU\001"
+	.string	"\300V"
+	.string	"\006\001\003\200\007\300\004\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\002\002"
+	.string	"\024\004\005\006\007"
+	.string	"\007"
+	.ascii	"\300\020\320\017\030\354g\027/D\200\3607\200\005"
+	.text
+	.section	.gnu.lto_.lto.9e599dcbb6fd81b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt.0.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`k\002=\024"
+	.string	"\246f\205I\320\360(\035B\3016\017\254i\353\200Fg\001'\331\001\337&\263\0257@\035]\bk\fY\331\372\261?\221\363\230\336\267\330$\3203\365\034\276\360\202+h\204\017\251\316\002H3\033\257\035\031\334\356T\332\032!\204\220-eJ\001u"
+	.string	"h"
+	.string	"p"
+	.ascii	"\007\302{'q\235\227a\212\3730\243 \007FwcN\334\b\340\002\276"
+	.ascii	"{\372\325woq\034^\342nPa\017\301\317\223\2530\177\347\"=4bh-"
+	.ascii	"\017%(33\343E3\030\344\211\022\222\206\031-\246\240\210\232\177"
+	.ascii	"\265{'Z\355R\032\220\341\241F\212FA\022\260\031\242A\321^t\357"
+	.ascii	"s\rB\212\241\325\\A\006sNk\f\355\302-\336\366\006\333\243\255"
+	.ascii	"4\001\366\nD\365!\325)\217\337\376\216\343~\324u\367\351\267"
+	.ascii	"\333\035\256\032\\\365\247jO\325r\325\253jU\365\003\210/V1\346"
+	.ascii	"\264\260k\232D\236\013\020\327\335>\217\357c\224s\357y]g!9O4"
+	.ascii	"\320)\2214\347\034\271\347\222\360^\210\274\375\262Qv\202\005"
+	.ascii	"\257\343\nx\347\2649\032Q\375\rfoN\016&X\314\211"
+	.string	"+qG\360\211\253Z\231B\326\024\323\n<#\222<pAV\201B:\234\345\373\026\334{\373\355\332 \271\\o/\256\\0\266{\216\212\\\221\\\233Y\276]Wn\350E\231,\356\356}.\022\264\264?28Z\254S\333\261\036\373\235\253\200`j\272\251\265\206\267\320\367\325]\235\254)\246;\243\366\273F09\\tg\343Ztm\366O\224d!\2747\001))\212r\226\213\265f\231\260\\\254q\245\245\242\322b\215+)(*#\313%a4\031\340V\004\b\256qB\253\345\032Q\270\371\275\261%(\356\307G\250\224\201\310ec\341\332\f\036}\253\007?0t\344\247\235Y~\241\003\234\025\352\261\342\316\374\363\323.\212\245\334\321\2132]\3169'\2706\2135O\265'\234\034\022d\303\235\331$?\355jA#$\231MLw\032\364=/ P\002A\314i\007\023\005>\035\006\352\013o\031\253(\007_\373"
+	.ascii	"\032\302\224}|hK(j\205\357\277,\002Z\371b\364(\267\303\354\036"
+	.ascii	"&j\237\365\006c\332b\251)m\001\360y\332U5\223\332A\3068{\356"
+	.ascii	"\315J\\\262-\326\177\337\306\"P\337\361\267\f/\200\305\377\f"
+	.ascii	"J\336\022x\bh3\270g\f\207\227\030y_\343\367Z\247\245O"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.1.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`\214\004\035\037"
+	.string	"v\271\307K\240\024R:\203\370\347\330^\320;qt\242\233\205\026\322\017\275\005Z \\\020\217\315\213\351\315X>\022\337\375\320w\275<Z\357\246\276\226\353%\310\361r\3769y=y\214z]xm\030\231\335\370\330[\177\303\022B\b![\356$\003\266"
+	.string	"\252"
+	.string	"\262"
+	.ascii	"\305\357\030z\024\203\335vo\0130\234\342\311\265\036\352\307"
+	.ascii	"\344\275)\262\200\334[D\3007\347\311\3378\216!\376\325\342\213"
+	.ascii	"$\006Z"
+	.string	"GSS\356-\352j\307\225'\353]\312\223\355\304\347\317_\265\305s\332\277\317R\3644K\322v\375\361{\352\bb\350\3413k\032\211\210q$I'l\316X\030\327\257\2005\025\340B\211\351\2505\221\222\226\034I\222\t\233#\006\306$\034\026\325\323\205R\211\233$^\246C\022'-\201#,\234\320\206A\233k\372\0321\033\032Uk|\315Ac\205R\211\367\257n\340Kl\205\022\323\253\271\273\367r\0051T:\257\234\231\2270\363\216\331Z\b6\264r\255Vn\241\261|\353\274r\250?}\325\031}\217\377|\324o\336\352L\036\352lk\345>+W\263\362\001\260\004qT\367\2128\222]#$\227\214{\375[\177\325ou\313|>\220{\361\215<\323\032:\326\273\230\201\376\203\317\025 \306\224{\357\354\344\226\275/vOZ@\207\372\025\330\225\331\b;\026_\213g@\317b\243\275U\021p\344\b\273\367>"
+	.ascii	"b\236\235<\363\020\337\307\257x\306\314VB6\036\206\314pP%\264"
+	.ascii	"\003~\240 \204H\330\275E\234\223\334\300\362\370\324\320{t\260"
+	.ascii	"\265[\304\002I\301y\322\306ve~\267\236i{\025$\003\326\020Q5\302"
+	.ascii	"\312\230\226\351\212e\243\342\032J\230\216\351\037-\341\032\246"
+	.ascii	";\312\201\2774\256\177\353\2276\201\307\333\370!u\204\324P\272"
+	.ascii	"\264O\352\253\250\216\361\255]\372\306\017\350\222\322THT\266"
+	.ascii	"l\255m\333lXGK-]k\256GeDgc\331\335\322\357\372\r\220I\220\254"
+	.ascii	"v\367\253<H\020\317\t\203/T\236\254\215\032\201\t\231\210\352"
+	.ascii	"\261\346\210\005gt\023\333l\264\253\222\340\023\260\036\371\354"
+	.ascii	"\267i\frTFT\217\314E`m\"\363M\340\023'\334-\230kh\356u\316\315"
+	.ascii	"\310\244\225c\322\3120\2652\256V~I+\273\334\002<<\365\347\027"
+	.ascii	"|v~l\206 \f>;\033J\235 \235\013\226\347\3435\363"
+	.string	"\022\360|<\235O\257\247\247\307\323\371\360\350\364\350x> ]\002\031\356\375\354\370tA\275\236O7+\022\335\246\266i\264\346\240\303\bQ\003gMd\2320\013e\251 l\252f\223-dt\245\331\326\264m\013\321&\317\261C\2002\206\"\265\347\255W\026\234l\226\376\325o\214\230\004\237\320&\262\331\304\244\351\033?\201\252H\343<\327B\266f\215\004\247\254\266\365\255\205,\344\271n\037R\244\232\024\3251{\357\275g\023\031]*g:u*#e\272\246\205\314\007\236k\2326\223\200\005\233\200f\023_\240\f[\250q4\243\210s\210\220\004#22%i5`\002\231:\354\006\020pg\223\244\335\320x\307EH\213\232\300\004\352\007-&\303\325JY\007a\250\024\204\\\3435;1\005\030\302L\335&\341\207 m\266rR8\374U~\334\255\342/kD\004h1WEj5e\f\022\2168\3111\026\202V"
+	.string	"\3660j\312\032h\325\362\002\200\224lD6\025\027nYPy\033?\033\301\374\235H/\302\202\311=\270\377\030\037\334\212\005\300]\356\302BH\211Z\202 \342\301nr\266\264\276\256R\326\035\362\330p\362\tn\377;S\331k\263"
+	.ascii	"q\236\013c\354x\2370\323\370\226sD\032CC\227u|\3553\244#\372"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.2.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`\272\0045 "
+	.string	"\006\373\314J\240VN:\204\344\323\f\3337\340\362uN\372\030\351\345\201\177/\370\017=\211\373\b\177\016E\354\303H\250\306\347\233\006\315\206My\260\257a\035^\207\267\340\203\234 \251A{\343\202+\253\037\273nh\237]D\032!\204l\271\223\f\272"
+	.string	"\262"
+	.string	"\266"
+	.string	"\025\25081\273\227\250\363\221\0330W\242\0072\235W\346S\275\352\367\033\037\216\2737\212\313\353^\342\0026`~d\342c\310\217\346s\344\307\037s\231\016\t\300XR\216*\367\336]O\261y\363W-\361|\366\357\350Y3Kr\264]\177\374\254W\247 J\302\242\243\266D\032\361\342I\226N\330\2354\263\257{\245\365\034 \305\364\364\232-E,-y\222%\023v\347\354\311SPxTM)\246\022/\235N\236B\247\217\266"
+	.ascii	"\222\025d-B\240\255IQ\204\004*D\2526\354\265J\006\024S\211\367"
+	.ascii	"\275\236\240\354\f\212\351\351\265\344\271\367rU\0222\235\001"
+	.ascii	"\234\231\2330s\004f\013\f2e\345\230\2632L\356\245V\031WV\276"
+	.ascii	"\271\264\374\353l;\361Gou>\177\3437\337u\036\217u\266e\345.+"
+	.ascii	"W\263\362\003\270H\311\034\271wD\361\312\025\033\277`\034\354"
+	.ascii	"\377\372\273~\253\037\213\317u0~\030\243[?{uH\240\2522\273\367"
+	.ascii	"\352h\035\b\363\320}\360\177\b\250\201~\374\3121\272\335\243"
+	.ascii	"\020ce\035:\026\321\001\236,6\314t\360\275"
+	.string	"\030\355\022\202R\006\301\274\026\177\213\277\343<\206\336\203\301rj\367BU\305\270\367>0?\346\330\347\310!f\364\343\177\365,Fq<\307\357XD\366\262\340\241\"s`~\274\325\347H\253\016<)\210O\200)\322\262\207?@\346\272\246-\017\340\225\264\206\260\242aF\352\232\246\353V\216\212o gZ\327Oj\222\351\231\356)\n\036\3232\375\\\307t\231\026o\243\307\025\222q\003\t\323\275\253\"G5\215s\r\323\017;\201\037h\235%\302\212\017\213k\333/\270\255\244\246[\343\232\253y\006#k\337\372@n e\002\274\222\326\"\277k\037KR\026\243Zd\276\020\037\317l\301\027\"?\276\357u\004\300b\360\311\250\026{\347\f\030\243\331V\315f\326\340S\257tv\035\022\021;\352\"fbZ{\310\3742\215B\306\035\305\214ss\260\263M\r\315YYwV\236)+\007=\037\207\366\361\251\274\036\2571"
+	.string	"eh_\257\307'4\372\20404\363\030\360z\274\035P\320\317O\020o\007\344\323\363\263\343\365\204v\ft\034\304!Co\347\013\n\352\355P\242\321;\212\331\236\266]\306)bF\2352\256v_\350\251W\342\034\244.b\227\356\032\244\013\355!\333\236j-\026\\\224U\264\307\232\255\237u\n[\\\225OD\332\016\236=\236c\217 %\r\305i\315\\\333\032|\354\226\005Mh\300\031\265\036r9V\336P\3102\322:\267\351 \333\022g\302\024W\277t\256\203<\3446\335ZhWcG5\315\336{\257\331C\2565\2215}Ne\031i\032\247\203\314\nn\3237]*\tc\250a \306\214t\310\b\311\210\210D)f\f`\002\2312\254\007\020xg\232\f\007*T"
+	.string	"2\254\312\t\021Q4\236\024\353@\f\245\246\373g\"W\343K\326\353\016C\026\201y\204r\b\233\267\016\374\033"
+	.ascii	"x\f\201m\026R(\306.F7\212\263\277\340\261K\351\337H\274Ee\317"
+	.ascii	"| \005\222\017\367\177\220\326=\311\377^9R2TZayA@\266l\207\300"
+	.ascii	"\324iB@\270,\375\232\271\332\020\202\272\354\237\346*\206K*\252"
+	.ascii	"H\200\266xxv\255\333\252\241^p\262\361\326\271\"<\225\n\330`"
+	.ascii	"A\222c\n\273\370\257\333\0030\260\023\350\217\26367@\253\276"
+	.ascii	"(F@\177\0368\323\202\361\276M\244y'\017\by\306\203\226\263}\353"
+	.ascii	"\311\353\344N\005"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.3.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`)\002\375\022"
+	.string	"&\344}G\340\360&\035\302\257*\004&b\004\037\3020\366\332\362/\017\333\337\347f\336T\367.\367\361\254\270\214_v\247}\263\271k\250\033\3356\347\350\006s\250\301|0\002yh\234\343\312\004\013\326)\031|\233\r\2627\331R\246\024n"
+	.string	"a"
+	.string	"l"
+	.ascii	"7\022#\360\336\235(x1\353\267\r5'M/\0215\346\274}\253\301\336"
+	.ascii	"\341\355\226\312\272'c\007WY\276\317\341\207\331\322L\f\346\036"
+	.ascii	"\22446.nd3\203(JH\030`\261\226\312\235\233G\331\273\216\230\354"
+	.ascii	"\020\036h\221!\006*F\001\022\240\021]8\305dt\017t]\221\233\211"
+	.ascii	"\335\\\345\2029\247u&f\341\346\270m\034\333\237\255\017\002\336"
+	.ascii	"\034\033\344\003\345qz\317\337q\333\317q\334\355\311\333\356"
+	.ascii	"\270\352n\325P\325\253j]\365\001\230\320\030\2004gM\256i\026"
+	.ascii	"u)t\216\273\375\233\017\344\223\037\342?/\307y\b\316\021\fl\271"
+	.ascii	"\2449\247\310;\223x\357\f\\@|\007\037 \276\273\375b\237\354\236"
+	.ascii	"\0020DTocy\347\244\20181g#\367\026d\345\213\234\213\326\322\234"
+	.ascii	"\252\210[{\202(\027\265!,\\M-\255\360\323!\251\353\366c\325\004"
+	.ascii	"\204\273D\270\335\376%\333\205\2733F\256\273{W\223\\\335\226"
+	.ascii	"\231\320yJ\340\214\340\326\354\022\277+\034\221\2142Y\356\367"
+	.ascii	"@\207<\263\240\327\215\230\r\242\261\201b\335\261\034{\332\275"
+	.ascii	"Yz\311Z\232\263o0\2725\373(J.\016\001**\232\362\324*\265N\225"
+	.ascii	"\244V\251\217E\265\262\242J},*)+_j%\341+\t\261\252%\302\352\233"
+	.ascii	"\240R\255\276\323m~sl(\345zx\234\306\205S\024\263-ok\226G\021"
+	.ascii	"\304\201\320\r\025\271\2670\303\030\367>o\240#CO+\027\346\335"
+	.ascii	"C\321\333%\221\303\035\311(\323\341\234s\312\255\331\304C\207"
+	.ascii	"\332\347\354\320\340\307\306\205\331\001+ `\202Ag\346\001\331"
+	.ascii	"\201Q\017\005\364\215gq\227(W\216\r\300\031\310GV\207J\271>\244"
+	.ascii	"g\021\324\212\027=k\013\3639]\202\221\334\247\037c\004'\f\300"
+	.ascii	"\354\326\325t\245=^\206V\270\355\"p\213\333\016-\026D\361\215"
+	.ascii	"\205\302ix\333\301\356\272\b\013\300fu\2311\020^f\344\215\032"
+	.ascii	"\337k\235v=\001"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.4.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`P\004\345\035"
+	.string	"\306\367\300K\240\226U:*\276\002\023:\212\034P\261ZM\\_\247\226\331\001Vi\232O\322o\333\240\243\205\177\017\215=\3171\2173 \310\332Q[\356\204\360:\214\016\343\3058q\340\325\263c\376\t?\340\337\316\316\326e#\210\020B\310\226;\311\257"
+	.string	"\242"
+	.string	"\254"
+	.string	"CV\362\225{\203\220\314\f\377R\236<\337R\236\344Z?d\343\2767\250\324\343\336a\0026p\236l\340\240\306\266\017Y\370\224@\277\036\035O\356\035\276z\005\237?m\325\016\317\252\266=U\241\247Y\222\266\253\215O\003$\212\340\201xj\315\020>..dw\302\322\030\213MG\272U\325"
+	.ascii	"\025=\340Qk\222\330\021\271\220\335\317\322H)\001\352x\270z\252"
+	.ascii	"\350\371n\376\274T\361~N\332\002Q@GV\274\234\005\020\fR\"\345"
+	.ascii	"\205\250\326\351\365\b#E\317\367>\322I\240\240T\212\036\360\325"
+	.ascii	"\234p\357\345*\202\327;\247\234\231\2130\363\004f\033 \234\222"
+	.ascii	"~\350G_t>\237\3437?\374\313\037\235\355\207\316}V\256f\345\003"
+	.ascii	"(}D\311\374\270\327\3478u\241\310\246\027o\372\211\177\321\177"
+	.ascii	"t\313|>\2177\361\2358]\252=\351L\314\264\357\340\367h)\342\223"
+	.ascii	"{\357\211\347\0252\213\200~\264\017\331\\\020\214S\305'\361\227"
+	.ascii	"8\245]\211\237\354=\2420t,\336{#\320\230\323\223g\256\361\215"
+	.ascii	"\216\304\351\321\216\275\276\326\305\021\235\020\202P\264\363"
+	.ascii	"\233\333\241\272\033\212\342\275\303\231\223\374\300\3428Q\355"
+	.ascii	"9<\330\326\305\001\215Xp\236\024`\2732\337\306o\324\036f\013"
+	.ascii	"\177\240d5L\273\200\344\246nu\004\216\031\305\322\245_\272.]"
+	.ascii	"x\254li\227~\217\t\226n\351n\202\340+\315\322\317M\261z\245s"
+	.ascii	"|\304\327P\"\212\"ce\253gDAp\325\310\254n\365\235nk\370\214\332"
+	.ascii	"\210\004\024&\333]{\325g:\201\037'=&n\177\352\260\341\274\367"
+	.ascii	"\276\005\177\247<Y\373\273\337Q\007\344\251\307J#\225\023\352"
+	.ascii	"\026v\331g\327!9\031\267zd\263\337\037~Ez\242\360\324#\363\360"
+	.ascii	"V[\310|\363\266\344\bw\020\263\214\353M\347\030\230\027\264\262"
+	.ascii	"\013Z\271\245Vf\251\225W\320\312-\326J\345\304\007775\347\030"
+	.ascii	"plr\254"
+	.string	"\006\235\f86\034\312\032\235\032\f\0266\2035\303\024\300f\260\027\216,\026\223\301^875\261\027lF{)p\261,\307f\366\322\221\311f\257t\310s\253\352N\323^\345\234\240x\372\226\266\220\017\025#\t\252\202\n\305\260Q\313\266\255c4\245\331V\264\273\355i\274\004&F\024*{\262:\205\301m\253\364\221n\213?'9\031h\013\3314b\272,\020\243\364\314cZ\307\326\224\251\360\"I\257\232\325\272\363\374T\306t'\035\211\214\340\252\321\336{\357\331Bf@\243\204\351\007\301\b\222/-\323:f\004\217iW\233E\216\271\340-T\250q(d\004\314!\202\314\310\004&3\324V\003`\002\231\272\263\r\020pg\223\244\335=\210\177\005\0219\211\360\275\002\371N\333K\331\216\3564\307oLw\206\003\247i\345-\017\b\177x\333\211\377\241\213k\266\371\247L\035\"7\235\265\220\001\214\\\216a\313\247\316"
+	.ascii	"QH&\261]9Ij\274X\314\020$\177!\334\272\231$\n\\\255\037:\275"
+	.ascii	"\211\034\361\300\2050\200\322\foF\362\203\033\270:\350\327mc"
+	.ascii	"g\363Eo\202\b>;t\f\346\251\n\310\242C\222-\\/\256\255\251\215"
+	.ascii	"\205h\214{\306`<J\250\336\374H\357#\026\354C2*~\367\034\247\231"
+	.ascii	"\204Q\003"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.5.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`\226\004]\037"
+	.string	"\026y\307L\240\324U:\n\351\335\352\017g\2361Q8\262\266\007\347vaA\360\206\\s\221\241;\235W\257UA\n2\344b\317}/\301\2143\312\307\373\207&\307Ux\035\300'\376\325\277\262\257n\326\031\337\312\n\366\300\342o\204\020B\210\334I\006\263"
+	.string	"\254"
+	.string	"\265"
+	.ascii	"4\2525v\260\232\271e\276\214\317\320=\311\303W\356-JB\335kT\300"
+	.ascii	"\006\324\237l\274\013\372S}\f\375\311:\346\253\033S\334\037\215"
+	.ascii	"zLK\356\275\263F\301\352U"
+	.string	"\2355\215gW\353\376r\255j\212\236f[\035\237\351\002\210E\200\200\037\3762\323\237\020*\036\344G4k\264\260\224O\356\254+\300\211\340\360\253\231\006\375\210<\310\217\204Y\223ed\350\003\372X\365DP\370T\350\250\013(\364\323$@Ed\225\002\344\2312CS\"^\300\037kJ\335.\221L\004\205\357'\177\022\301\3102\021\034\336\246\023\356\275l\201\200\301\363\311\231\271\212\231%0\2336\001-\253\345Xj\231%\265\274\262ZV\201\245\240\234\334\370\273\256t^\237\364\253\207:\243w:\233_:wj\331\252\226/\203.\241\2221ro\210\345\326\005r*\217\036\365C\375N\277\322\277\304\307\361(\276\024\277\232tG^\311\274\363'~\216\316\232z\375\2042\2570\302\321(\265;_\342\221A\320\332R@\203\237\344\227\023\216\b\006\004\365H~\023\277\306m\354\374\006\3530o\r\n2\226X\367\336\007\352O"
+	.ascii	"\346c\350\016\363\353\347\177<\023\277\230A\003\335\227x\324"
+	.ascii	"\273\"E\022\251h\240\304\341"
+	.string	"\227\367[\203\204\034a\335k\234\371\311\001EHC\247K\307\264\2179\301aZ\326i\221%oh\227v\361\007PX\277\264\314\007okgA(\265\300B[\332\245\255\323\205\327\320X\267\364{#X:\326\235$\301W\232\245\317\333\332\331%\303z\245u\204O\217\201\343Hu\326P\225\276\035\247|\254\026\303Z\245/u3\206\020\331k\322\310 &9\314\356wJ_\371\001BJz#v\357\261!\203\312\307\241?\337?\342\223o\330c\227]\223\305[\321]\3049\217\016\352\275\327\001\177G\216\206\002)\214<\240?\327N\221x0I\352\261Kf\343\316v\221\371\351\356\210\025w\021s\214\354Qg\230\027\227\325r\267\234N\343\340X\332\215\326\030rn:w\263\311\341\316\034\016C3m\001\355F\233\345\330j5\033m\226\203cS\233\321n\270\331\002\031\333tnn\263\234\315v\233\275\214=7]\335'\025\230"
+	.ascii	"\351\351\035\303\254m\265\231i7\366@\f\340\247?\360I[\004\304"
+	.ascii	"\037\275&\257.2\312pEY\207\274\b\262\2566W\264\317t\025I\213"
+	.ascii	"+\313\347A{m\263\237\274\253\352\022\220h\225p\231*\254Q\232"
+	.ascii	"\233\215\242$\"y,\326.rZ\225\312,<5\351\231\303\264\217\3154"
+	.ascii	"\246\302\321U\2474\254}\352Y\007\n\323\335\264<V\371X-\363\336"
+	.ascii	"{\325.2\215\013\364\245\037_\250a4\205\bt\206HD$\030QI\322\030"
+	.ascii	"`\002\021:4\017\020xW\232\024\332\f\032^\030\322\347F\244\324"
+	.ascii	"\375{\215\231\034\360\345-\037e\344~8\026\303s\024f\367gQ\214"
+	.ascii	"\313\377\036\340\373\335\310\316\344\037\352\243.@\330\3040\216"
+	.ascii	"\026\207\305<DL\272\305\221$\257!\016\f\367\006i\357=h\311\316"
+	.ascii	"ExD\022\312\302\026u\252\026 \027P\311\240qi\271\212\320*{\322"
+	.ascii	"{\b|\354\245x%\265\212\303)d@\354\2216+\275B\260\230X\206\237"
+	.ascii	"\366\3345X\370\237\347\242\352-\343\rPw\227\030k\370`x\206\274"
+	.ascii	"\311W\200\320\034\240\276\030\020\007+2-0\302\267\201d\334\321"
+	.ascii	"/\202\3376N\346\216o\366\007\245\233N\370\003"
+	.text
+	.section	.gnu.lto_crc8_xor_update.6.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`\306\001\365\020"
+	.string	"\306\240rF\360\320&\035\372\305Z\206\201r\020ap'\222m\177-\342\377\351\327\336\t\306\354\321rK\355\331R\366\250\306\321\244\300\365\314\030\331K\247\343\207\305\307\3420\324\005\241\205H\266A\262/>?\311\234%\204\354-eJ\001^"
+	.string	"`"
+	.string	"["
+	.string	"\316<N\312\272\033\003s\261\373%\360\201\355\221A\003\224S\377j^2\231\234\225\212\033\273\037\247\"R\t\277\033f\352\021j\246|\021\227\r\227V\312#\324X^Hx\264X\240\310\220\220\317aOVK\225\320\004\314\365\260#p\375\270\264`\236Z\204\335u\272\264:\334\331m\223lC\260\363#\206\307\271UKg\226>"
+	.string	"-\006F\201\330\356K\f\307\002E\237\022\347\371_O\033\345\367\034\346\321\353\004\356\207\217]\321y\331<\3409\371\266p\020\261T0\241\335\017\344\321\016`\212\353\240\276\223\001~\354\212\214\006\005\333\243\001\250i?\347(P\377L\343\001vg\202@\276\017\310\036\267\013\310\036\003+9t\270\273\013\027\034j\207\232\\?\252\251#\375\214\225\007\325W`\360\266\021\376I\366\230*\301%\203\005B%c\251=/XZ\352kTM3F\313\tU\306\234\351\025\305\325b\225C%c\366\227\222Jc_\244fH\310:cw\214D\307\371\267\363\334\332w\376\354\337\037\377z\246\223\224JL\220\202\311\204R\211\205l\304d\204\004v\247N\335\205t\247\216+y$\222\327q\245\n#$\256;]\340B\b\3303\225\2348\023\317;q\243o\25736\204\252\"\221z\254B"
+	.ascii	"\251\250**\215\017t\223\243\035z\233\233\r\031\025*\353\260o"
+	.ascii	"5nX\350H\rsSU\226mk\n\025E'(\" `\002!\265\316\001\226\300\304"
+	.ascii	"C\237\265c\263)\324\312\362v\024\320'fZ\264\026Z\2033\267\274"
+	.ascii	"\273\232Z\301= \324\236#\255X\2348!\300\340\003\tt#\260\303\257"
+	.ascii	"2\372\262N\303:\302Z\324\355\263\335\330c\310\232\t\224m\371"
+	.ascii	"\371rG\240O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.7.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\355\021"
+	.string	"\026\342vG\340\322&\035\222\247\221\357\353SH\354k}lu\223\321\243\023\025\234d\267\2618u=\025\337\254\253\377#\275\216\321f\310\224\235\244=\300Es\021c\214\261\202\3400*\245\301\333v\210\036DD_S>!do\271S\na"
+	.string	"`"
+	.string	"e"
+	.string	"{\363\003\264\033.\260\002\356\323\341\th\237\334\007h\237N\331E\017s\366=0d`=v\327S\017\251(\303[\306\324\247\324\230\362aO`\343\202\345z\371\224\333j\346C"
+	.ascii	"\327J\236\034\031\005]\366\330r\251\242\024As\275\354\"5:X.\232"
+	.ascii	"\307\r\302\356:\262\\\032n\355\266M\266\037\330QB7\367\327\277"
+	.ascii	"\315\307ny\237[\265\3508\243\017`\013\242a@hwf\346c\211f\020"
+	.ascii	"\210\307~\236\337\347j\337\376\n_\346.\206b\325\220\341\200\373"
+	.ascii	"\374{\016sg\006&\251\373\264p\033b\213u\210a\302s\341\033\223"
+	.ascii	"\001\244\245\0322\332\rG>]b\307\020\205c\344\321>\212\247H\375"
+	.ascii	"\345r\001\033\332\342Tj\034\3213\204!\036]\356\356\312\222K\r"
+	.ascii	"\321\227\250\321\021CB\025gV\275v\372\0342\033Toa\241\205\363"
+	.ascii	"Q\332\347\365\262K\240\032\036-\0160q\246\032\023Z\271Tq\\\372"
+	.ascii	"\017\212\333\335\006>\013S\205\0037t\\t\252(2\361\202\2113;|"
+	.ascii	"\211\212c\377$\347\310\310zc\207t\017\177\220\363\004\340\311"
+	.ascii	"\244\037\370i\312\212\212\236@\224\023\313<\261\244\250?\222"
+	.ascii	"\017\374\274\225\022\211T\372\274\225\t($\357\003Y<\222\002."
+	.ascii	"\231T@\357T*\201^\027\356\245T\235\021^\020\301\250\312]\214"
+	.ascii	"\272\251M\201\024\3172\202\225\276xj\024\261\211\311\374\230"
+	.ascii	"\212\343\356\204\316\316\214\b\242R[;6\264\323\303\316\355\330"
+	.ascii	"yE\277E\323) \220\202\231\301\333\001z`\217a\310\276\310'\317"
+	.ascii	"\013\036\023\206\212MZ\267\313fT\203Co\314\261^\217\\\236\021"
+	.ascii	"\203\001\360\022\262\260q\245d|\365j`\023nme\2650\303\334\321"
+	.ascii	"\004\351La\200\302O\230d\330\003\024\004\301Y\315+\315\r J\275"
+	.ascii	"\307\2235f\200\312\203\374R\356\\\353\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"E\004"
+	.string	"\364\0052\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\t\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\n\354\363\203\007\002\177\013\003\177\f\004\177\r\005\177\016\006\177\017\360\372\250\007\177\020\001\t\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001\b\177\022\n\177\023\003\002\t$\003\002\b\344\016\003\005\204\016\003\007\n\360\372\2508\001\304\006"
+	.string	"\020"
+	.ascii	"\007k\b\353\b\335\264\003\324\303\007\310\357-\265J0\\\366t&"
+	.ascii	"\016\314\020\320\016h\207\004\332\001\332\001\334i0\307"
+	.text
+	.section	.gnu.lto_.refs.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9e599dcbb6fd81b,"e",@progbits
+	.string	"(\265/\375`\302\nm8"
+	.string	"\332aT\025G`^R\007\373e\370\365\211\242~Wx\270\306D\212E\236:\213\1771\033\222_|,"
+	.string	"y\377<{\255]\f\377\020\246\356\325m\374P&\216\365\205e\252\310\302KA\205\006:\226\007\\\300\0371\331\343\355n\333D\246\024\037\0017\001O\001.\225&\f.\253\035d\263\370\227\303\256\305\237\355W\034K\013\301\377_\377\337\276\345\345\316"
+	.string	"\355\317\277\017.\346?\334\027\272}Z\334\212;\021\024\335'\366(z\213\322\212\363\366\017\013E\210\240\026\273\242c\253\332?\326\337\203\326\036\021\333\022\330n\257\342\324\305c\332\3148\343LV&\252\370>qZqu\262\332\355]\335\036\305\267\274\231s\243\336\177\376\303?\271\031\\m`Yu.\227\342p\002\247\322\0262t\256m\302[\3770\257gj\212\310\233\325v\300\266O\351"
+	.string	"\315\317\320\231mO\260\372\324\023\254\r{\320\312\272\2005\353\272\263w;\257\333\017\264Ww\203\271\301\271I\347t\273\220\332\355m\272}%"
+	.ascii	" h\204\017p*@\321\236n\017\353\356\007\335\376\323\335#t\335"
+	.ascii	"n\245\333{\335\316\323\355\273n\317\335\336\335\035\327\335\322"
+	.ascii	"\356v\353\3567\335\035\355n\262\356\356\352n\244\356\036\353"
+	.ascii	"n0\335\215\240\273\343\356\336\322\335\316\356nv\367\200\356"
+	.ascii	"&\323\335;\323\351t\332\355o\335\236\324\315\202\bl\026\030\261"
+	.ascii	"*\253\335\275\340\373\311\177\373\363\360#\335x\331\272\3164"
+	.ascii	"\311\037\370{\024\370\330\307\273\3602\251\276\237\037~\177\343"
+	.ascii	"2\371\302\205_\244\013\277m\357\215o\373\017'{\356\223\330\272"
+	.ascii	"\033/\223n\374&\177\336\370\355\307\304\036\254\361M\272co\262"
+	.ascii	"\347\306\304\244k\\&\177j\004\371Q\365\264l\362p4\256\361\245"
+	.ascii	"\216VDd\017\352\302\357\237\375\373\263\351\221\r\376\255^\344"
+	.ascii	"\031\021\207o)B\245\212_\304\327\341\3777p,b\275o\204\272K\336"
+	.ascii	"\377%E\026\177\304\320\302\320\027\342\320\326\207\325G5\375"
+	.ascii	"\0378\376\267\376\320\377o\377\177\207\264\202\377u\364\\\346"
+	.ascii	"\361\370\257\024:\276U\313\245\351??\321\266$\335\030\353\365"
+	.ascii	"q\251\0223\337\tn\235\371gK$\033\267T>\352\377\235\215e&i\300"
+	.ascii	"\311\252\207q1\016\017\371\230v2>\326;F\370\343\0355lW\317\254"
+	.ascii	".\360\240Ueb\333\207V\336t:\235\372\320\352]<\314a\b\356\245"
+	.ascii	"\375\213\203i\035\021~\370\037\346e\"pW\272\262\332\363\2405"
+	.ascii	"\267`\333!\254\271\351\324!\254\335\316e\213\217\221\254f1\253"
+	.ascii	"`B\001\256\266\323$ZE\207\230:%K\t\004,\0233Q\f\257\312\314\313"
+	.ascii	"\033\224\374\371]\n\304\334U\301\222\342Ob\227;$.\316\337\270"
+	.ascii	"\222CW\2215\037\256(;>\253\235\251\336\336\\\372\201,\307N\251"
+	.ascii	"E$Z\247]\352\303\004Y\306\225U\247\023\201\311\f\313\252\317"
+	.ascii	"\231\262\261\271\233?\362_\271A\211tm\335\201\2666\026\247\335"
+	.ascii	"-f\307\252\270\240e\325\333<\376\225\035\301\260\261i6\376\206"
+	.ascii	"\355}1\rmMG&\215\233\266\326\376\246\335\344\2464\330\340\262"
+	.ascii	"\352i\256\026}\265\256\250\271\341a\352`\203\003\333\335(\322"
+	.ascii	"\021\313j\033\177^Q\025\231\342\3145\267\342L!cf\346\321\017"
+	.ascii	"\377\237\373\337\001\306|\245r(\027\305\f\312\353\254=\272\223"
+	.ascii	"\244\316\325SV}\215\213\351b\036c\350d\325\325\264\332\320\370"
+	.ascii	"D\313\313\254f\246\244t\236l\273\031?\323\016\205\035\352dl\373"
+	.ascii	"\337\302?\205\001\n\224\224\267WZ\r\361n`y\237\244i'\353\266"
+	.ascii	"\220\301\305z\376\267\376\037\201O\315\220\343&\253\216\306\305"
+	.ascii	"\002\\%\t\213f\265\343$\360a\243\245\354LV\333\261\330\316\335"
+	.ascii	"\353\023\221\377O\245\203\037Y\354Y]\347>\324\355\3439o\360\271"
+	.ascii	"\016:\373\267\021\244-E<\302\241\210\335\317G\"8<\022\226\350"
+	.ascii	"\031 L\212\301\003\262\260d\204\002F\n\243\"\240\020\250\244"
+	.ascii	"t\242@px\"\205\022\223\021P\013\r\207G@\240\321\317\007\024\002"
+	.ascii	"y\032x$\f\"\005W\260\215\3417\341W\024c\327E\032*h\250\260v\221"
+	.ascii	"\006\237O\303\317\307\366\317\227\033\032Y\270\360\363\261\303"
+	.ascii	"fAA\005\023\n\027'\202\302\341\222\202NR\n\n\211\206IIB\"\236"
+	.ascii	"\024H\301\334\222\221\n&\024K\253p\250\224\033\032\025\r\221"
+	.ascii	"\216\230v\355\363uX@\"\204\007\026H\001(\004\022!%\271p\221\004"
+	.ascii	"$B::\341\202\b(\\\"\242P\240*#\335\256\220d5\347\300\360*\263"
+	.ascii	"\216\3169\032\3169x\322\177\242;\203\234\365E#n\305\221\235\244"
+	.ascii	"\234\2509\345\033\031J5r\005\332\326\325\204w\320\024\351q&\253"
+	.ascii	"\231\312\247S)\025\317\215\337\177b\256\221it\246jg\340\316\200"
+	.ascii	"g\"\n+jU\217\307\214\364\036\\L\303\262\346p\226ZOy\2523\222"
+	.ascii	"\210\231\037TY\315R\256&#K\372\306Xni`eOO\031J\210\375\255%h"
+	.ascii	"k;e\312\276\270ft\206r\347\256\331v\326\2160C;3\306f\2431;yS"
+	.ascii	"\201W\223\325\223\177\345\020\217\017\257\330-7uv\322\035\231"
+	.ascii	"\223\005\232\325,#\200\345\250\261<F\230#\"33\"IA\222t\240\002"
+	.ascii	"\221\2512n\021\240-\223Jf\223,\333\001H\024\364\337O\337\325"
+	.ascii	" f\267\316\201\341\213l\350\334\303-\342\335\357\202\006V\237"
+	.ascii	"(5,``l\225\322\204yi\226h\026\307\255\261p\tdY=\fdW\2174\355"
+	.ascii	"\335D\007\265\316\006\317\303\306Q\240\345\367m\305\b\210\022"
+	.ascii	"\217&\227\276\304\265\242\272\215jV\252)\216\0301\226%\004\246"
+	.ascii	"\370\364h\312\252S\r\3352\236\016\356\210o*\351\020E\221\275"
+	.ascii	"e\240\013\026l \275/\032r#\367\035\\j\236\317|\024\224G$]\371"
+	.ascii	"\"!\2048\313\036\223\200\006Ym*Y\324\013\364\324\316\304\222"
+	.ascii	"[`\327\3648\023j\346\311\204\021rj\206\256\314\324\3740\025\006"
+	.ascii	"\032\315\f\340\1771\030\"Th\325kR%$\025`\351\360=\201)\b+\312"
+	.ascii	"\274>\202\023p\260\335|Qy\201\322Au\255\246ojY>\226\375\240\256"
+	.ascii	"\024]\213_}9A6\350\365\356\016\001\263@p\234%s\344\311&\3151"
+	.ascii	"\271$\017)^\034\235\211\200WK\227\232\320\307P}\216@\335\250"
+	.ascii	"\276\231\222\227*X\245+tI5\3514\220\016\266\374_\243\257DJ\244"
+	.ascii	"\307I[\220x_Jz\211\276\253\340\230\327\235tV\216\377\002\322"
+	.ascii	"\001\005\367\365W\306%c\203r\203\361\377\270\374\2668\266\204"
+	.ascii	"\315P\334\276\354\252\371\321\335\301\354\363{\202\354o7o\206"
+	.ascii	"\030\352\b\027r\351^\344C\247\340\370\216W\222\207\325%\272\033"
+	.ascii	"\353\203/\007\361V\231\231-\007\361\306I\037\306\351-\344\257"
+	.ascii	"\341\024\335\215\337\335\331\025\037\244\257\002"
+	.text
+	.section	.gnu.lto_.symtab.9e599dcbb6fd81b,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9e599dcbb6fd81b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,205 @@
+	.file	"encoding.c"
+	.section	.gnu.lto_.profile.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\350\335\352\372\n"
+	.string	"\001\277\261\216\273\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"$\003b"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	"\001"
+	.string	"\001\002\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\300\002e\001"
+	.string	""
+	.string	""
+	.string	"\003\003d"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"Y\t"
+	.ascii	"P\355\024\216\231=6\327\365\211\036O\2736\200\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\001\003\177\001\003\177\002\001"
+	.string	"\002"
+	.string	")\241l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.8023c5d6e7958a30,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_castFloatBytesToInt.0.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\222N45Po\322\001\240\362\3154\\\356\024@*\351\370\250\310\"%32x\3071\330Z\312\332\207\210{r\223\206bf\206 \032\326\266\r\237\203\232\213\231{4B\344N)\f\356\345i\310@\013\361\312>0\213\030\026/\230\201\0240xi\017\320#\320\350\360\321 D\214\032\324tw\365,eZ\345\3424J\211\272\2130\300\374G\310\344dx\244\214^\252\355D/1ZW\317R\233\257i\223\375\252\314\312\006\365W\244Z~\262N8\332\206ZM\333\367ljI3?\n\211\311\377N9\030[m\353\017\203\204\272U\335\006w\020B1\302\362wp\300\001\027[\2257\027[\251\341\315o\253-\342\202\t\024\211\023\371\001$\374\357#q\026n\272-A\333N\333\216\b"
+	.string	"2\241k\037\030"
+	.ascii	"\023\236k\370\r\013W\207p\001Pi:\355$\003"
+	.text
+	.section	.gnu.lto_zigzagEncode.1.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\315\b"
+	.string	"\366\320=8@\305(\035\235j~8\324M\210\367j\213y\262A\204B\250\311\342\247B\362Dm\257\356=\243|,\225\203\237\211\242(\2063\304Y%\361L\215\\\214f\264\177o)S\n-"
+	.string	"-"
+	.string	","
+	.string	"\252\006\026\324H\200\335\rj^p\371s'\270\374i\307G\317\221\377\326\023HRR*\322\023\343\260\273\316\224*\343\326\333V\260\315`[%\232NM\0373"
+	.string	"bP\262\213\021{\355\312;\371\260-\2623\2663\317\272\260\300\356F\313dw\027\274\t\370\263\355\207\\D\344\221\333<\002.\024\254\2241\247:\027J\003\341F\2718M}-'\330\346N\257\n\340\3642e\314\336H\251\034\366\335\356\256u\345w\326\3574\255\001\236\212\210\216\305s\306\201\320>\0171\323<P\213 P\314\240\366\351\200`\026\232\200\234\003G\tO\bR\304\030\202\231m\357VWO5%5Y\365\351\003\013"
+	.ascii	"2\241\307\037\230\313\004#*4\232\361\307\f\213\313\250R\215G"
+	.ascii	"\207p\300\3174\235v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\003"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8023c5d6e7958a30,"e",@progbits
+	.string	"(\265/\375`\311\002}\027"
+	.string	"v\256\242G\260\032q\341\360oj\306\241\315\233\341\330\204\202\266\333gQPs\001\352`\307<7{\246\373\333\267\234\004\332\310\351\303\231E\212\253M|\273\315\351=gf\250\347W@\035\333:\356^%4\234R\327\351K\323\311\022\231\002\202"
+	.string	"\211"
+	.string	"\214"
+	.ascii	"\177\201*q\265\332\357\242@\355\266\221I\316\357\351\252,9K\265"
+	.ascii	"\006\332bRD\305]'\035\267\334A\217{\321\315\f\3251\350;\377\027"
+	.ascii	"K\210;Y\\\361\276\005\262?\013\344&+\304\233n\220K\264\364\352"
+	.ascii	"\377\323\3668\031{\274O\265\004\300o\007\200^\205\336 >I\371"
+	.ascii	"%\330\013M\374?i\335\004\264\335a"
+	.string	"\206m\006B\313c\233\310\366\220\355 \333\034l\177\266\241\330\036\255\353\272\332\336`\373\206\355\345\002\237\220\232\247\245\350\210z\224\233Y\322H\023u\365cy\364\252R%W<\275\235\2512\275\235\245z;Q\245\212\216?z\256\231\222cI\273\361\240J\225<\257\336\306T\251\346\b\002\312=i\261cI\273\212\232\2154Q\2732E_\364\257.\347\346\202\337\206\232E$\317.\231\355T\314\220\220\350\246\377\r\324f5\320\323v\245\017\372\373\314B\274\026aLw\357\331\335h\303\366\235\234\377\300\323\277\366\217\373\335\377\361?\311\264\245\017\366\002mn\207\214\372?\373e\2748\321Xu\232l\271\013\333\252\224\203\313\024!\257\210w\310~ a\217\230\376\237\377\b6\347\207\356\213\367\255\221\325-\320j\205\322Si\n\226\030:\3573,\364\256\300\323\272\256\353\256@k)-\017%>\216x\237=\204\236\r\2364\377\257"
+	.string	"\220\336\234\231@{\275"
+	.string	"vW\266\200\035\355\202\337\366\310d\345\337\301e\tw\020\2210<\325an\0015O#\317\024\211R5Q\271\335\231\342\244\231*\323\007/\020\242+v\241\206\006E\r\f\205\311\t,\216x\335\260d\242x\303\nP\"\224\3054\210\035p^\262\023\024d4\242\b\f2\034\032\327"
+	.string	"\273`7\257\330\253&t\204\230\00612&H\226\231q0\343"
+	.ascii	"\264\314L\2535\023\323\n\035\323\032\311><\200 \213\301Hn\265"
+	.ascii	"*\250<p\310\020\272`jb0\020\242+\366b\305D\033\033\321\305\212"
+	.ascii	"\301hlX\256\033\034\026\f\002'I\262Da\252\240H\247K\0170\205"
+	.ascii	"\216\221\246\304K\024\200\305\017\016/\336g-;\004\244\342CC\307"
+	.ascii	"\373\274\266\320KdUo\316\016' @\002C\212\341\354\377\354\325"
+	.ascii	"\342\371\230\205VI,\304\312\231\246%\337\211\277F0\024\226\254"
+	.ascii	"\317k\336P\241;\302\230\245T\020r\n\240\261\274\200F\216\315"
+	.ascii	"\215\300m\004V\004h\212\201\370R\331\314\002\033\220if\211\226"
+	.ascii	"\233X\247\234\302$\334\034\354\361\275W\226\3576\226\026\330"
+	.ascii	"B\007Y\334\335\365b\252\f"
+	.text
+	.section	.gnu.lto_.symtab.8023c5d6e7958a30,"e",@progbits
+	.string	"castFloatBytesToInt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8023c5d6e7958a30,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
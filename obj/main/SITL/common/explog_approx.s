@@ -0,0 +1,301 @@
+	.file	"explog_approx.c"
+	.section	.gnu.lto_.profile.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\005"
+	.string	"\255\350\377\267\003\004\002"
+	.string	"\001\315\266\304\242\016\002\240\342\234\212\n\003\261\252\331\243\006"
+	.string	"\004\266\245\265c"
+	.string	""
+	.string	"\002"
+	.ascii	"\271\2016\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 35\001"
+	.string	"\320'"
+	.string	"\003"
+	.string	"\001\003\003\004\002"
+	.string	""
+	.string	"\001\003\001\001\001"
+	.string	""
+	.string	"\002\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"5\005Q\031\374\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 \323\205\003"
+	.string	"\022F\022\033\220)\351{\333\363S\025\3538\331\366\"\341\371\310\335I\330 \351\303o\216l\271S\"\026\022\230\030\325\343\017h"
+	.string	"\2369\376\003\343o\250D\235\201\266p\220\177`\031\215s\212\375+z\266\374\205Ri$Yg\223\237\240e$\017"
+	.ascii	",;)\006\240M\300\b\367U`\254\320\202\346`=p\254\b\tz\232\307"
+	.ascii	"\312\214W\026\313e\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 4]\001"
+	.string	"\004\002("
+	.string	"\003"
+	.string	"\001\001\003\177\002\001\003\004\002\001\001\016\001\002\001\177\002\001\002\002\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"G\205\2442\316\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\003\200\004\004\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 0%\001"
+	.string	"\300$"
+	.string	"\002"
+	.string	"\001\200\007"
+	.string	""
+	.string	""
+	.string	"\001\002\001\001\004\002\200\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"9\205x\336\335Y\277\001,"
+	.text
+	.section	.gnu.lto_.lto.5ff72a425c23d8c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_exp_approx.2.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375`$\003\345\025"
+	.string	"\026(\215J\300\020)\03522\256\022kq\023\230\345z\3029\001\307J\355\273v\001\212\356n\217\343\023!\347\270)@M\344\372e1\243W\355\252*\b;\334\"\b\202B\241\207ai\341\037\202\343\235\034 \370\260\336\203\376\204}k\233\310\235dw"
+	.string	"k"
+	.string	"|"
+	.string	"\272=\214\037=\351J_\332\021(\002\302o\307\001\322\232'(\232\026\030\255)6\360AUO*>\rb\003\037\254\240!\325\335\003^W\201\353\225\276h\315}u;\t5u7\2015\340z\335\335=\321]\350v\315\b\034F\033'\232\244\035\335M\236\\\306z\025\037c\275\262\317u\247\272\375\227\216\3423\254\301\2319m5\350\356\24558\037\276\374\335\025\260\273\022v\271D6Q\275\0056t\357PF\370\254\362\303\033\376z<z\356\372f(\217\330\275\330\334cr\243\357\354\276\257\354H\337\222\377\276\261\003\277$/\372GNW\344tCN\027v\272 \247;\236\356\307\351\276N\327u\272-\246\313b\272\225\351\212\247\313\247KO\367"
+	.string	"\304\024\036\254\246.T\352\2769\257:\252\312"
+	.ascii	"\272\3577\372\221\376\337\017\f\\y\224AP\035\210x\030\234'\325"
+	.ascii	"\214]\fcq"
+	.string	"\226=^\256\305*R:/\236\036\003\267\246\253\273Wf\\U\f=\355*\263\230u\320\200\340\363<+W\022f\353j\205,\031\213\\K%\232\234\022\2261\2078K\250\0303\227T5a`f\001\032\312\331\321sI\230r\214\352L\017\256\271?\261\0316H_\363\272\337 \353\2252\313\217U\316\256Gw\257\234I\370I\245\216y!a\007j\264\234\210@\244\360\227\0045Z\256\326h9\336\226\024\031\033\356v\243M\250`\253\335d\\\310\030\033\f\214\255\205\214y\241\301\220-8\013dJ\200\265\335\\p\344\005\233\rG\216\276\276\330\334c\302';\346\255\b\267\330\204/,{\273\243\026-\206\260\bW&\030\207\3608c\270c\003\207\257\007\b\303\270\nG\006\341q\230\243\354\231\b\336\210\272\372\340\221k\215Rg\306/\376\340\326T\331\273\001\362H\271\370\025D\250aHE 2\310\206\202\004iAAa\341"
+	.string	"#\231\0337\020H\246\316\2445\310"
+	.ascii	"\274\344\013\300O\033\364^ \272\261\341%\026\371F\024u\355\241"
+	.ascii	"\365\365\274\305\314\206\246\356FOc\337\273ZL\374\370#-\326\\"
+	.ascii	"\243\355 \022\"\203\211\374\305\"\b\026bw\207\202cP\356\033\251"
+	.ascii	"\2279\322\342\3359}n\222\337\331\024C\004\037\370\324gQD\271"
+	.ascii	"\021\230\264\\\320Hd\025'Zq\2531\271\022\200h\355<H\005"
+	.text
+	.section	.gnu.lto_log_approx.3.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375`\260\002]\025"
+	.string	"\226(\216J\300\020)\035cP{"
+	.string	"H\275\261%y\340\bG"
+	.string	"\022\375\331\b\242\200\366\344X|\316q*\243*\264]\030\001d\277\216--jWe\006b\2001Ea\317u\033'\352l\203U\rV\300\244\235\330\377\347q\361\337\032!r\247\024w"
+	.string	"l"
+	.string	"\201"
+	.ascii	"\266\320\246I\316\221\202\322f+\006\207\244f\230\023Uk=\360\321"
+	.ascii	"\tZ\037\351\207l\332U\253\013\240\243Z+\212\021\264>\332\366"
+	.ascii	"O<(g\233b\031b\304a\334\314\024M\325Zi&\237\255>\212\217\255"
+	.ascii	">.\210\347..\315\371\037\336\200\017\212\206\027s\261\367\025"
+	.ascii	"K~J=\030o'\022p\342\241\361\341i\rO\206R\226\203Z\253)\r\217"
+	.ascii	"\303=\3366\004\333\013\354\025\020\373\225\220\303DV\355\350"
+	.ascii	"\351\243\240`\244V\255\225AlKld\374\204\222t\364\264\313\030"
+	.ascii	"\272=\366\305\272\300\331\313[F\251c\027\336#\037\372EN\035r"
+	.ascii	"j\330\251AN\375q\352\327\251=N\355:u\353\324\254S\257N=\236Z"
+	.ascii	"\244\324K\251)\245>\311\003\252\233\237P\200\263\326\233\223"
+	.ascii	"\2526\215,H\274\374\205\247v\316'\372\320/\007\007\362\265 }"
+	.ascii	"X\333\332\033\221A\034%\017\225\256\226\265kD\376d;\356j\267"
+	.ascii	"\006\031\3540\303\306N\225\270\343>\310\307D\372\354\314W\305"
+	.ascii	"\220*\253\033\234\247\224L\255\272\023\331\212\273?K\273\247"
+	.ascii	"\024A\234M\331N0s$\351\250\214\264\242\273+\026\315\364\366<"
+	.ascii	"O\272#\221\271{R\361aGOQ\334\036\372\0257\234vv\2016m\323\023"
+	.ascii	"\221\215`\203c\270$Cu\370;\262*d\024\200\033i\025\0136\\\313"
+	.ascii	"\342\356\262\242a\315\222\202\253\335l\266\225\n\026j.6\\\013"
+	.ascii	"\r\246\366\362Rc\241\301\\Xy\241\261\3340\320R\006\270fk\271"
+	.ascii	"\3212\324j7\332\253\254\027\353\002M\267@\214Gg\306\2446_b\212"
+	.ascii	"\250\t\006\f\331\032\333\2635\321\355\316\260\375\330\331\242"
+	.ascii	"\220\277\220\005Y\330~\007\371\3731A\326\221\005\331\367|Pd\360"
+	.ascii	"\265\037\253\342\024\265\301c_Kw\220?\327z\354\276\320\021\212"
+	.ascii	"(\305\326\27262 \240\002\021I\353\001\300\t=\267\241\262\351"
+	.ascii	"\330\316\376'\326bMn\321L\020X@ CW\214Hrp\271\220y'\rE0w&\353"
+	.ascii	"\274T\315\013,\304\021\360\242\210g>L\352\227}\006\304\236a\333"
+	.ascii	"\275\215\371sKH\031\337D\221l\004\217olA\253\355\211K\212\266"
+	.ascii	"\006}\021\254\365&b\fH\346\207e\242&\205+@yjmN\321\352\036"
+	.text
+	.section	.gnu.lto_pow_approx.4.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\375\b"
+	.string	"\006\022?7Po\322\001\220\354,Q\021*\312'\200B\375`\340 \201D<\230\252-\206\332'\202\021\226F"
+	.string	"m^\250\327)ff\2115\264\257\346\317Y\263\255\217,![\312\224\002/"
+	.string	"/"
+	.string	"+"
+	.string	"]\210\310cR2Pfv\027r>\200\375z\027\300~)\310\267\347\346\377\344/\325\321b:qO\315\302\356:M\247\215[o\333\300\266\202mV\357\351|\372\032\r\007\f\301jW\243\305\332\227\213e\304\366fo\354N%\341y\225W\016\330uI\255\354\356\201\021"
+	.string	"~\331\366Kn\262\331\253\027\230rJ\312\371\322k\352e0HH\331\362\313\247v\205E\336t\245\360()gw\\\352\207\375\267\273kE\331Oc\357\376\353\252?\r\367\334\237\316(jY\346ap\210\020\331\b\004E1\024\212\037(z\360\204\340G\213\200\235\002\307\f\244A\211\0305\270\351\366o\025\205)\347BI~\231jO\004\f"
+	.ascii	"2\241\001(\260\344\013\265\241BI\327l\213\t\020\030\001\371\300"
+	.ascii	"\260\240B\033\200\312hj\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 tm\002"
+	.string	"\304\003p"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\003\201\204\001\001\004\002\003\177\005\002\004\177\006\003\004\003\"\003\004"
+	.string	"\200\200\200\200\004\001b"
+	.string	"\005"
+	.ascii	":\207\261\223&MQ\002\020\217Vy\002"
+	.text
+	.section	.gnu.lto_.refs.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5ff72a425c23d8c,"e",@progbits
+	.string	"(\265/\375`\271\003\005\033"
+	.string	"f3\262H\260X\325p\314u=o\322\001\314\234$94\212\\#&\335-\200|YY?U\313G\024\262\375s\005\350\224\177\333\247\334\002\371\277\272dK\312\306\036\306\303\307\316\313Ux\366\206v\003\304\025\270|8\374\204\363\273\355\226)\214"
+	.string	"\226"
+	.string	"\245"
+	.string	"A\314t\325\377\tn\265\031\351m\3023(\375\203j ~\n\245*<\320\nK\032\272\373\354\374\n\256\376\267\277\334\013\377\227\377S\250N\375]\274\234\274\333\355\317!\270]W*\355\374\242/J\020w\2563R\227\222\321\312;\217Z\356\351\223\236\367\246\035J\256e\357>\377\267\n\311\303\251\240\"\216*SP\306\311\336\237\r\266\227P\366\326l\007m\377l#\3316\262\335\263\255\301v\006\333)\333Il\217\303\341ph\273\204m\036\366i\026v@Z\264Q7\321\377)"
+	.string	"\250Gk\002\274"
+	.string	"ve\354\001{\332\230\237\\\324\227BVH\034@\363\2058\332\206\271m\257\3547qW\217\262X=\353\016\367\027\375|\245q\326\327\335oK/\232W\217{\271m\207#Us\312\251\246(\353\252\211\336\226\226\373\035z\372\314\222u\256\273\222u\252;\334m/\367\264\025\375\264\2458\226\220\272C\317\325\304\275\234\353\016\307;j\302\204\301i\373\211\233\316D_\204\247\232\276\351_\337\316\321\230_\227\242M\346\317\006k\302\023\265\342\270I.I\275&\033@\344\357\267\275=9A\301sC\3509\235\314\312\305\023$=1H\357\321.\022\322\217\200\025\037\214\037\013Rl\260J\262\230\200R\264\273\332\373c\215\226hW\003\255\372\217"
+	.ascii	"\341\035\315=pI\207:z\304\021f\r\240\306-\200\362\372\220\006"
+	.ascii	"\356\320\266`\373\315\006*\337\216)\025G/\217\035\362\366X\242"
+	.ascii	"\355\261=U\356e\226\003\245\024\243-Z\236\313\311\234\226,aY"
+	.ascii	"\261\252\267g\317T0P\300?\364\177\301\036EaBD\034}\305@\333\252"
+	.ascii	"\315\221\264\003\2108\332\207"
+	.string	"C\230\177\005\317\220\001:\035f&\350\344\334\244H\304d\253\325\214Kg\304\213t\214c2\330\254\245\023\213\315Z\001\354r]\200\341\240\001\003\371\212\360!&BF\203\265rb88\261W+\347\306\003N\3535\033\321\212\300\200\026\233\311d\036:\310h\260\225_73X\016\354\003i\n4\020hjh)\327\330H\260\221\200r\215\215\313eC\343\"M\343:\035\261\327\3102m\357\344\373U\326\ni8E\2128Z]\003(r\013\240v\310\022Y\"\027\331%\253l\352\327\377.\013\304T\002\005\221\264\324\272\bJ\210\220\r\252|<7\204\006\f!Q\322\002\364\006G\031M-j\004A\250\2410E\034$C\"\221\004#\022\310\220\324\001`\002\221\242l\036\021@\036j\223T\332\377\r\345Oj1\235\342\350\215\243\355$#U\300\355o\032#\201*\373\211\207\rUu\216\204\376\363\212\204\367\360\353'\007\0357"
+	.ascii	"\243\360]\211\227\031\026\333\344\240\345\344B>\246kqX\3305a"
+	.ascii	"LS\262)W\361\365ELak\200\231\373$\353\233)b\226}\027\242\326"
+	.ascii	"T\222\3030x\252|v\354/)\255\362\332\207\2267\374\371w\365r\220"
+	.ascii	"S\363Vv:\364\227/\r"
+	.text
+	.section	.gnu.lto_.symtab.5ff72a425c23d8c,"e",@progbits
+	.string	"exp_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"exp_cst1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"exp_cst2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"log_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5ff72a425c23d8c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2172 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`}\004m\022"
+	.string	"D\031q\005"
+	.string	"/"
+	.string	"\321\257\303\271\007\n\002"
+	.string	"\002\001\001\203\255\266\373\b"
+	.string	"\002\226\230\315\365\005"
+	.string	"\003\321\307\201\370\r\004\002"
+	.string	"\002\002\004\353\220\276\200\006\005\263\311\277\326\001\006\006\211\337\230\303\003\007\217\364\362\333\n\020\b\271\373\304\327\005"
+	.string	"\t\322\340\271\313\003\036\002"
+	.string	"\002\005\005\004\002\004\n\311\276\204\302\004"
+	.string	"\013\245\233\254\343\013\f\344\247\274\230\005\r\302\265\230\372\n\032\016\243\352\335\360\007\022\017\222\355\333\035\b\002\006\002\007\b\002\007\002\t\002\007\020\346\270\370\237\007\n\021\260\263\225\257"
+	.string	"\022\337\327\302\372\017\026\013\004\002\004\023\256\275\203\223\017\b\013\013\024\341\274\244\351\t\022\002"
+	.string	"\002\f\r\004\002\004\025\243\351\306\344\f\004\002\r\002\016\002"
+	.string	"\002\016\026\307\334\375\317\002\016\013\027\312\345\217\372\013"
+	.string	""
+	.string	"\030\207\350\254\365\t\036"
+	.string	"\031\360\270\247\200\017\004\002\017\002\020\032\352\206\264\241\f\002\033\351\362\202\312\007\006\034\200\304\221\240\f\035\324\307\301\321\017\002\021\004\002\004\036\255\343\356\213\f\b\037\371\246\311\203\002 !\337\242\366\261\006\032\"\223\235\261\274\002\022#\225\255\234\250\013\032$\265\372\304\207\005"
+	.string	"%\266\273\273\317\003\n\002\006\002\022\017\002\022\002\023\002\022\002\t\002\022&\211\262\332\266\004\"\024\002\024\017\t'(\275\321\333\306\013\002\002\025\002\026)\227\272\370\231\r\n\027\002\027\002\n*\374\270\241\253\b\006+\352\325\231\214\020,\277\344\205\366\t\016\021-\274\262\321\315\005\025\002\026.\240\342\234\212\n"
+	.string	"U\250a\265\300\b\020\243$L\230\322V\003\220\002SU\324\006\022"
+	.ascii	"\343,\213r\214a\016!jD\024\315\0043\023g\341r\031p\2248\177\277"
+	.ascii	"\025\244\347_\261\340\005\366\345\"\"\316 I7\216\023\207{\303"
+	.ascii	"\254\362\307I\2242(&T(+\001\274R\353D\211S7\352\034\021\006\305"
+	.ascii	",\254(%\367\206ZfZ\004Z8\rZ\306\302\213\027\\&F\201\235\306\005"
+	.ascii	"\354@\310N\202zl\317\001\254\220\005\357\004t\326\217R\331\324"
+	.ascii	"\250\222\243z8>\346\305\262\3220\261\235S\323\343-\3071\267\n"
+	.ascii	"\325\317-\320\266\377\341\300\362\277\356NLH\333\255vk#j#\002"
+	.ascii	"\325d\317];"
+	.text
+	.section	.gnu.lto_.ipa_sra.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`<\003\235\t"
+	.ascii	"\002\212\036\037@E\247\003WEQ\024EQ\024]\225x\213C-\016\305\204"
+	.ascii	"\334\237\302j\243&B\266L)\245,\371\251\207\244;o\034oZM\006\323"
+	.ascii	"\013\345\333R\241\234\236H\"\220\366\270\343l0H\326\031\266("
+	.ascii	"\331\273\036\025\227\256^e9sO\2421\373\211\"\240C\311\006\031"
+	.ascii	"Z\350U\302\007V+\301T\t\2645\342\305S%\257d\3336]z\324Co\327"
+	.ascii	"\337>9\340\266l\004\340\005\004a\250\221\271w\\\217\315\320\002"
+	.ascii	"\222\251\325\003\022\200\002\031\212\3670R$\001ER\033\331c\r"
+	.ascii	"oA\257\016\017\"\221%\332a\340x\234\347{\032\205yh%2\242\b\022"
+	.ascii	"\376fU\237\322A\361\247\0204\307\224\245X\211\226\367\376(\341"
+	.ascii	"Q\022#\034\243\367\017 \036W\315?\027*\245/\034\204\375\2321"
+	.ascii	"\255\017\337\0224z\207,\244\213FQ\220\334E\304[M\031\030\213"
+	.ascii	"\374AFX\320\310\330^g\371b-\310ay\327H\026\276\315\337nhF\241"
+	.ascii	"\214\254\310\224 -\352\017\323\246\001{\236_@\302\247\355\272"
+	.ascii	"\204?\327\031\310\331/9\3161\211y\243\030\311\314\365xQ\302K"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_.inline.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\336\02452"
+	.string	"f\272\271H\300\226M\032\003V^\022\245\321\344\003\334\211\213\313}Qq\003)s\365?"
+	.string	"\267dY\373a\326\312<\313\357\253\324\267\034mk\253\365J\026\241\231%\270\250\f\3456 '\210\020\374\021\003Gm\214_\026\0132\321{\313\235\002\216"
+	.string	"\242"
+	.string	"\254"
+	.string	"\336\n\244\257\226\311\356\356\230M\316%\303\244\221\213K\322$\210][\315,\3411)CnV\327\255\363\271v\240<G\345rI\323\226W\302a\032\345\312\231\256,\237\323\024JG\343\272\254I\226ez\207\335\265\275\276\224\251<\376\334Vr>c\032\356\256\352\356\016&\271\275\275Xw\334g\336\257es\360\230\356\356\352\272\316\324hw]>HN\355\356L\367\2674\346h\214?\216F}\215\177\244\300\265T\303\344\226B2\305\356*x\006\323\b\t\217A\243\204\254"
+	.string	"\322\222\252\313\fR\206\022(P:,Vk\2505\304}\364Xh\252\257\311 BJd\327F\363\314L\303\231\204\332\321\030mX2\177\030\244M\273\333\232q\031\244RvWf"
+	.string	"\3775\335\320\373grc\270\242Y$\342\230r\260\340\003\2029\307\364\346\270!\330\321\f\363M\331\254\267\273\273\262Lq\273\273\352\256q*\214\033\327\345\212\320`uLu\326}\035U7\277\254@\320\203\305U\255\013\025F#"
+	.string	"\273\324\364\246Z\371cd\314\3234I\177\262\273\001X-\261{p\2145l\356\255\001=\027\370\303\220\300\313\224M\t5"
+	.ascii	"\214\272\243Z\362,@&9\231\344\270\357\373zd\222\373\276\357\373"
+	.ascii	"\276\357\373\276X\2238\363\200\337?\267 \273\373\362\216\336"
+	.ascii	"\244\224\210(\004\0219`\351\310UL[\006\243\314\231i\247\240\324"
+	.ascii	"\030\277H\323\020'\032\265d\222\213I75}\332\265\315\274\220\214"
+	.ascii	"\261\273\023.(\210\335]\260\215-\346\205\224\311\356B\320\221"
+	.ascii	"v\227\300\001\300\234i\322f/\246\362\326\"_\347\322\356\372\\"
+	.ascii	"\323\340X\267\367K\221\234`\n\343\253\316%\267\301y\311of\362"
+	.ascii	"\205\224R\221\3134\037\213b\f'\215\204\264D\022(\032\253\353"
+	.ascii	"\313\244\251\213\037RO.MJDU*\310\020RJM\022^`\240F\254\351\r"
+	.ascii	")%\024\254\031G\323\026E\206H\254\324\304\022\322\224o\005\377"
+	.ascii	"\334\342JzS'\230fp6v\370\030\002\343\024%\352\250\343\321dG\217"
+	.ascii	"\233\023L\230>;\251\250\021N3\342\210\312\302\346\204\304\033"
+	.ascii	"\001M\352\2401\345i5e\363\331=g\312t\2244\245c\371k4\336#\243"
+	.ascii	"\007\033\034\217fX\2660\222\343\210\314\007~\351c\340\025m+\317"
+	.ascii	"\327\023\246\323\365\204}\220\353t\201\340:\275'\220\315['\220"
+	.ascii	"\306\273\265\353\021\245\302\t\f\214%$*52/Y\240\207\034\034\250"
+	.ascii	"\033^9\006\351\321\022\022\225\201\234\250\021Q\346\320\214$"
+	.ascii	")H\262\254\001!\005D\031\245\034Uv\003\022\300\"1\310\303(B\306"
+	.ascii	"\020\"\022\220\210\210\210\004\022\212\004\005I\222\244\003\200"
+	.ascii	"'X\234\217\373\335\021O\273_\rUq\243\033\370\026\331\337\222"
+	.ascii	"\261\246q*A\326\304\221\031\204\313p\302k\016g\302\177O\255\203"
+	.ascii	"\201\027\362cj\016\261M Y\233\230b\025\270\377\217\2268\350\254"
+	.ascii	"?\342OPv\312j\322\337\016\377C\242\232\352\363\221b\363E\335"
+	.ascii	"\024\364\266\211\366\314w\200 \240\357\323\201\276\234\261P\317"
+	.ascii	"\217\211Y \362\004i\337\320\202\367\212<\347\244\030U\315\354"
+	.ascii	"\374\322T\244\266\337@q\207+\202\033\350\376\373\027\337F\302"
+	.ascii	"\263\222)\326\267\215\337\020L-!\327\024\272\0032\313qi2x\364"
+	.ascii	"O\340\025:\334\314X\343\0232\264\260\310/\244W\033\212\005;v"
+	.ascii	"\036\224$\t\035\021\203\221\034\204\334\005o4\234\"N\255:\205"
+	.ascii	"mf\340\354\031\225\316\310\334\2769Y\252\347\302vRozX\216\346"
+	.ascii	"C\316\314\347\364\001pzc\336\245z\204\002T\020\370W\273\222\347"
+	.ascii	"\233\362\352\037\212i\236k?\203\\\367:\361;\335N\360>\305\346"
+	.ascii	"\331c\270]\246\260\371\240\346\271{\356\211A\327Y`\341\372#\237"
+	.ascii	"h@\330\266\316\216\025;o\333\335\f\n\307 \004\250Z\317i\002\371"
+	.ascii	":f\311\026\226\240m\206\371\302\0043\223\320H\211/S:1\013\311"
+	.ascii	"\r\3702"
+	.string	"\343\237\262\211\322b8U@\020\303\215\362\023O8\370\322-\333\320\342\r\032)DU\220\377A\343\254_\263;\376\204`jaM\223\353U\0066\275\310\302\210#\267\003\243O8A3\230DBX\307\376\232\254\177\230\250\227\265\037\331\rT\251\240\377\202d$\020H\357\371\343\321\005m\210@\325E\035Wl0\202\276\217\223\203?\344\263\356\240{\313\357\342\356\302b2\347#\003\226\031\"E\201\361\376\371\233\204a+@\262[\022\2149l\361\271\306\007\352\b\227\276\243\271\007H\217\005w4VT\327\236Vm)\r\007\355\332\243\320-.\0058\023\025~kv\363\345X\212nT\253\347\270\366\2526\320?T\326\310\32483\325-_\334p\227\371\310\325\007\260\210\027\013L\363\2409\232\002\253\230\224\356\317\342\305GI\230\261>dsP\307\261 )\304D\362j\367A@\237l\316\354\273\230\001\202\212\r\336\b1\217c"
+	.string	"\f\225\237\336\231w\324#\037m\362\033\366\246S]s\222W\212\rsa\021t\304:\312\214\013\005$\347\2355\351\266\302\255F[\033"
+	.string	"\367[\366\331\024\320 \261\226\217X\230$\264\217\201mF$)\220\214\270\034\034f6\326\003a*\255\367\235jM\301\222p\206\013<\245W\302\264\211\022\2210S1\360=\231i9j^\357\241\334n"
+	.string	"\257Y"
+	.string	"\251H\216(\026\312\264Lm"
+	.ascii	"E\256\212\217h\325\206r\214\021%\2778F`\034jP\25537w\312\036"
+	.ascii	"\365\2667\302u\225\317\222&r\262\354\234\034\211\b\004\002\013"
+	.ascii	"z\341\310Q;\242-*\307\372\214\243%ER\004.'\215\f1S\305\262d\301"
+	.ascii	"\215\204\225z^a\210R\302y38\267\026\372\360\337F\034;\267\354"
+	.ascii	"\356\275*\240\200\334*U\002N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`m\006\035\020"
+	.string	"\366\323?4p7\032\016\374\177\254FT\037\"\3504jUU\021(\202@\365)\352\005V\024\256\246D\210\210\200\331\377%\224&DX#\177\227\324\320\336\375\177\357-wJ2,"
+	.string	"1"
+	.string	"2"
+	.string	"\351F~d"
+	.string	"!}\351\273\326\007SB~\246-$E\230\276\241\364%>\243\265\323\257\370\254\3265$\342\247_\177\332\032]\200\233\006\004\375\305\252\356*@\362\247\b:\013\032p\356\220\303\351T|\367\216T-\024B\307cl\333\266\325\307\036\337\215\324n$\367\b\030=W\364\364\216\202D\334\r\f\347W\013Y\314\026\276Gk90\275\324\205zG\253R\210\020\252\2026A'~\345?\016\264\022v>u\245O5n\3623\214E\372Q\302]\031\004w\030"
+	.ascii	"\227g\226\364\263\212\314\207Z\nlB\3631\t\007\346g\"\356\305"
+	.ascii	"\354\2425\304y\252Ag\205\242\371\327C-\016\227vM.\311}J)\240"
+	.ascii	"\301\324\"\220Fu\250\001Y\211\250&I\262u\200\002\231\231\252"
+	.ascii	"\363\022`\024Q\004Q\340\030\022\f\305H \023\220$\345\231\202"
+	.ascii	"\264\003a&\314\\Os\t\341.\244\347\035\323\235n\372\307\235\354"
+	.ascii	"\013\242v\310Z\036\254\211z\272\331\343X\234O\213\200\334Z\357"
+	.ascii	"_5\320\2471n\205Hj\363\270\237\247\267\2611^\215\231>\237lP\204"
+	.ascii	"F\201}\226\227I\312NtW~\253z8&\004N\230\374`\364\300\3454j\314"
+	.ascii	"\266 XsA\343\020vU\303\307\017\213\215\nh\005\221\f\247\240\310"
+	.ascii	"\347\236t@\222\0047\221\327\206\270\371\270\206\260\37564\321"
+	.ascii	"\227\250\334\003\323H\200;8C\210\244S\204n,i\370$\275i\306\234"
+	.ascii	"\337\255\033l\371r\315#\004\352\214\363\351`m\267\020\332\261"
+	.ascii	"\375\202.'\264'\244/\tv]6[\031\257\305.\005\327\306i\314g\r\273"
+	.ascii	"\312I\005\270\207\001sb\246\255p\337\354\257\370X\226w\226\356"
+	.ascii	"\255\274O"
+	.text
+	.section	.gnu.lto_.pureconst.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375 \217=\003"
+	.string	"\362\310\030\035@W\032\003\323\244"
+	.string	"4EQ\024EQ\024\305\262\210"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0301Dd\256\362\224\243\374\344&/\331H>r\221-\344 \377\270\307\326q\216o\\\343\031\307\370\305-^q\212OdI<\342\020\177\270\303\033\316\360\205+<\341\b\333\301\r\262\202\023|\340\002\327\0032\200\354\362[\335]+"
+	.text
+	.section	.gnu.lto_.ipa_modref.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\030\007E\023"
+	.string	"\226\325B5PI\233t\210Q\325\030\231\241\203\323\330f\246WT\341\006\365%73S\021UU\036\034h1\220\205\375\377\217\331\236.*^g\240\252m\b\3251\264f\211\334)-"
+	.string	"7"
+	.string	"4"
+	.string	"\001nk\353\004\240\316\347b\241\211\177\277')\316\2323\227P\346\314\314\314\345\335\316E\212e\267\370\330\362q\034*\016)\336@0W;\212oRl \232\003\377\260O\r<\365|\304\021\273\254\343\340\225\335\335|\242\262\031\212\263\002\330\360\021h\233\006<L1^xa\303+\261M\017#\340q\301]\255\251\300\002\016r0\220\212W\r\313b\354\222\275\316\264\021Z\320];\2438\245\270X\024\374\216\321F;%\341\022\216q,\301s\324J\274\336P{\303\342\255do\202\340YO-\025\276\n\243T\r\337';\312\302#\224]j\307\201PD\206\351\3479b;HQV2>\340\003.\232\231\322\262C\244\024\334\325&\024\362xPq\220R\203J\024\200\255\250AU\246\250\250i\337\220\002\2211\"v\022"
+	.ascii	"cI\n\3058\232DH\271\221@DZZ\230\275\016\030\206\256\033\301\""
+	.ascii	"`eZ\277\305\352\221\373\224\206pa\222<t\254\004\270\326\370\241"
+	.ascii	"\373\322\236\274\351\264\301I\342\200\346`\216D:\223p\264@\n"
+	.ascii	"\002\020\346\031kt\177\266\b$5\334\3101H\250=8~\226b\345<\320"
+	.ascii	"H\024\\\3534,\336\377K\305\303\0334\001\302y_b\342\275Gk\001"
+	.ascii	"\331\255\301z\023\036YN4\2101\367\220\013\030!\326\214\032\367"
+	.ascii	"\235\224|I\3537\247\276.\217\335\024[\240\3449zu\363\221\313"
+	.ascii	"\221[\007(\304\201vx<\025\246\b\b\"%\307\205L:\233R\305\206\005"
+	.ascii	"\216\007\025s\341\3275\021C\255`\230V3\336\327\255\3330-\225"
+	.ascii	"\244\312e\323\320 \373\\ \251\230\f\303\270\r\bd\216\335y\230"
+	.ascii	"vC\021\250 \265\031\320\237K\256\245\330\317\231\233>\3264\256"
+	.ascii	"\354\306\200\230\r\354n\002\2405\316\"!\320N\260\332\357\326"
+	.ascii	"\036\222u/\"\336\225\242\312\304.\261;\315\2652\350\316\017\205"
+	.ascii	"L\245\254\262r>\226\001\bx\260j\364\375eM\031\261\342\205\016"
+	.ascii	"\347~\300}`\032\311\334S\357\342\261G\305\255S\372\204\237\300"
+	.ascii	"\255\315\235\220\003\n\320\023\240\007"
+	.text
+	.section	.gnu.lto_.lto.607338cdc71157dc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.6.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56@\215\222\016<\214\013\243\343\261$\354\302!R\027\357\227\372\313\321\315\020\244\353@\253\345\377\256/\022\013\003v\025\305\205\305i2\002ea=|B\261\255\2555Bd\n!\b\320\247c]o4\032'\344\320i\200\237\314\343\3116\360\323a\360\300\215\366"
+	.string	"5\004g \216\006CY\246A\354?f\253|\245\037F\342M|\024\271w\361\255\362\225\276\246\266\017\343\270\210dV\254\250\344\211E\262\361o\217\375\316\3254\352\200L\023\224TffN\250\373~\024dk\214\250@fi$\225\0313\037Xj\035-\377\355\250\307\366\250*fh \240(N)\231\t1\275\\\265\252\016\\\265\036F\267\272\3556\244\005\247\222\021IT\007\260\220\231\273\021\311\242\277\376\006\277\302o\n\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_pt1FilterGain.7.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\215\013"
+	.string	"\346\326P?\020Q\225\016\253\020T)\004\301\347C\016\360\244\220\376\227\330\024\300\240\371w\002\0046\361\215\322\315\242\233\311&\220ih\021\""
+	.string	"^\021J\353\031\206uBV\321\217\322\273\020\246\265\204l\"eJ\001>"
+	.string	"?"
+	.string	":"
+	.string	"\373Ul"
+	.string	"\362\b m\373(\236\242\263A\007\034$\035d\200N5v7\233\\\300\365h=\300\365\250$\336=;\377\247Shx\204D\235'\306`w\235!\321\207[o\273\200m\005\366#\004\021\216\025\003\300]\017\341jU1U\342\246\337\356\374\223%\266M\031\254eq\023\251\031\037\273{\340\321\t \232/\031td\027F\f\324\356V\214"
+	.string	"\362\350L\373\244\253\350\376ip\334\rABm\340E\254T\252\365\2020\\m\330\365P\242f\013\257\343\223\241\257\251\367>,\275b'^\200nx2\264\277N\352\b\373\326\356\256u\204\275\364_7\335\361\337oiZ5\235\231~\r\036$\004\n\311\301\240I\300Dk\026\356\302\251\220\301d\233M\243\331\264l\223\231\240\3114\356Bf!\340\315\302\205\3138\333\306e\222oo\255\2160\235x\364c\325K1\275\r\257\343\322\250\252\321\205\207\007\"\325\001\020"
+	.ascii	"2\241\267(\360\336\213%3\274\321@\023\341\006\230\026t\215\n"
+	.ascii	"2\016\002\215=\213R`\3426IBn\320D\217\222\322\271&\031"
+	.text
+	.section	.gnu.lto_pt1FilterInit.8.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\215\t"
+	.string	"VRB:0\345\2521"
+	.string	">\267\347\037~"
+	.string	"\230\213]\035\247\255\367\244\n\t\316\204\204\267p@\366_\336P\337\004\326\2071\"\006\006\006\f[2\357\225\204\031v\324\024\320\336\326{o)S\n/"
+	.string	"0"
+	.string	"2"
+	.string	"\\G#t\346<\037t\346*\266\263\005\217\201\331\207\213\366\377\233%\026-\305\332+\306\240R&K\001\212\377\225\250T\210;\335V\323V\242\265B\t\265\037\2446\3402\256\345\244\2553m\345h\025\321\255\302\212\371]^b\3777\215\360\3149l\226\255WN\021\315*\331\340W\275b\377\270\351\203\347\r+\001\"\260\266R\323j\230\2450\357\377D\355\342\330 "
+	.string	"`R\352\314A\254Ph'YkG\223\234#\255\267\377\357T\265n\331\233Y\266\354\nH\002\026\016=\244\020\350\323\265\303\t=\244\020\350\363\215@\221\b\354|#P\205\350\353\204\030\037\207\241\340\205'\374H \030~\231\361\336>U\345\002\310N\263\243\333l3\374\n\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.9.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\b"
+	.string	"fQ?9@\305\2521\330Uwf\371\314\3533\027>\315$\303\021\332K\327%L\203\220\t\255\221\013\202\371\255p}v\023\271\242(\206\217\030/\205\263:\001\0368\341\342\215&\277\224)\005-"
+	.string	"-"
+	.string	"/"
+	.string	"\b\232\345\346\003\315\262^\013S\340\030\220u\260\006\374\237Q\304\236\241W[\305\230\023\252d(0\361\277\360\204\372p\243\333:\264\215h\013\013/\311B\322\326\231\266\360s\212\347U[\305\374-1\327\177M!6\313\206\213ak\023\237xV\221l\360\247"
+	.string	"\270\376O\323\207\315\262\237\003\030^ik\373/Q\26342\b\002\214\2204K\006\224\022\020\023\234\265_\t\306\220\326\227\377oL\265^\331\321*\033\312\002\001\t\261\337c&{\025\356:#\320\307\243\225\263\351:#\320\3073E\\(\304q\246\350C\021\232\234\356bn\026\312Yt\2729\342\270nf\276\373\362\230\252\234\275Lq\2431\266\001\f"
+	.ascii	"2C+\025\003\b_Z\\z\b\265\256\241\3070/\020\030\\\221\246\246"
+	.ascii	"\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.10.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"u\013"
+	.string	"6\226M;01P:\250\242\225\344\234\273B\004-jHk\222\322\003\325Vg\3130\331M\332\350\240\265X\213'\233\316\230\367S\037\026\006\006\351\350\030\362\235\t\341\211{\032\225\020\262\267\224)\005;"
+	.string	";"
+	.string	":"
+	.string	"\321\235e\333\027\361\021\232M\202]\207\020\265Q\230\340\321\330\335\353\300\037\324#<\001\352Q9\\{j\376K\034\256\270\360\302\363\341<\253\005\273\353\364|,\334z\333\blK\354K\b1\3230\323\232\351\314\364\003P\031\\\024`\261[\341\263\261\247\250\302\203m\315v\330\316\374\310$\003\330m!\243\264\273\020+x\332\027\235\204\366n\363\001\273\240\024\245\335\016\342\004\326\003P\343\r.\304\226\237\257\226\252V\036\367a\323\374D*$\206!\334\204I\022\337\303D\260v\367\241\r\365x\255@x5D\235\374\354\216\223\272\301>\\\005\331\037\375\326\273\277\312t\031\r\346R\211\224'\221\214\222qPip]0\213\005\233\\\227\n\003\3135\311\036\\\021\003\3060\224\354\312`Xv9\272\275\035\365\301a8utsT\024\002`\230<3:\371\031\3525*4q\032TS\003\025"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\322\262\304`lpM,\250\305\026Y\220\225\220@\240,\203&\236"
+	.ascii	"\224\024\3235\311"
+	.text
+	.section	.gnu.lto_slewFilterInit.11.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"=\013"
+	.string	"\326\224LC \2138\035H\261\3302\bq*\230\nP\217\373\262\025\023\214.2\216\240ZBIs F\251\037!\266)0&\214\223\021e16\003\020Fcr\352\226\032\3579,\rL\246\266\\\343\223\"m\262wJ\0016"
+	.string	";"
+	.string	"9"
+	.string	"KR\234\221\275\232|\005\366\232\235\002{\365hs8\311`/\001\001\201\023kw7\272\340\343\347\350\377t\355\003\342|Bt\354\256\347\007t\340\246\267=\261\355a\237\013\244\177f\230(\203\305\205]\003\255\017\273\252\026\034\330\276\3046\271\274$\266\200\347\3031\311G\030_rim\027\303\006\325\356R\254\221\275b\\\237\366E\037\215'm>\261\033B\2516Oy\270\250\035\340\250\332\241\002\204\004\245\3559\2615\247\3402\333\335\r\177\302"
+	.string	"\001\021\032\032l\260\327\372 \305buf\313&9\223*\260\177\355\356\232\206\354\233~\354\245\377z\"\230\357\022r\340E\324\304\316\353@4\034&\3240[* 'b\272\221-\363y\336g\3312]\210\267Y\300p\253\\\370\003\300\201\233\370}\340&!\367\327\322\220?F\253\016\365\030\243v\030\024"
+	.ascii	"i\231\"\023/\307\321\342\202\n\200@J0M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.12.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\274\002M\021"
+	.string	"V\236jF\360\260(\035p\227\243\366N\2260\030\222tF7!\354\315(&\376<i\316,g\332\203QesV{?\026\353\023\307\343\243\033\345\326\211+6\221Md\357\305\307*i\374\222uP\253\334\354\340\260d\357\275\245\224)Y"
+	.string	"N"
+	.string	"X"
+	.ascii	"1\370\261\264\310\024KJ\214\215\356\346@\352!5B\025 5r\007=\251"
+	.ascii	"G\2332B\336\323u\206 \315\205\031*+\224zfH\233)++\2506\026\330"
+	.ascii	"\300ZQ\370\202\302\312\266BY\356XE\200\240\356V\230\256\204U"
+	.ascii	"jw\206\272\373\253\262b\3519\364?\207\377!\377\332\004\272\351"
+	.ascii	"\247\312\261\373\271{\271\373\270{\270{\336\375\356^\001H\035"
+	.ascii	"\027\003b\335\023vt\272E\234\371\360\377\364o\377w\025\346\261"
+	.ascii	"{\272U\310\220u\367\307\021\350\376\372R\022'\375L4@wKF\326\375"
+	.ascii	"}\374\200\246\361\237\366\377*BG\234\376\354B\341\021c\206H\341"
+	.ascii	"\202A\341\306\220=\330\r\2632d\bC\005\"E\242'\230\267\227\232"
+	.ascii	"\331v7\212\331\365ee\0050\034\224\275\361\277DM,\033\360p\007"
+	.ascii	"Z\3421\255\273C\2561\f\036h-&R\2432\347\324\270\274Nv\347\377"
+	.ascii	"P\313\256_aw\367\271\365Q\030\r\246\222\221\322(\312\213@<\021"
+	.ascii	"S\203\321\002\256\324\221H\235\210+\215\022\2208\221G\302\201"
+	.ascii	"\020x7\"\342q\246\256\363\270\355k\205\312\255\017\203N8E\363"
+	.ascii	"\341\250\201\305\3143\363\211973M\266\342_w\317\311\036\fG\262"
+	.ascii	"\362\314 #y{\261\231\275dde\b\313\221\225e\241\206\212F\f9 \260"
+	.ascii	"\002\031\261\363)\235\"G&\006}\243\216u\335\\\323\325\234<1\233"
+	.ascii	"\213\b\032/\357\230\255bX\252\306T\313\"\304k\332<\267\254C\016"
+	.ascii	"\250\300M\366\340\326\225\301\361S\326\210\345\016\3424\221\314"
+	.ascii	"\227\264c(-\353P\036\255UL\311\006\334}\355\222\220\r\315Q\272"
+	.ascii	"\314\301\217\354\2514\227\2409\333\305\004\001\371\307[\"\n\302"
+	.ascii	"a\260\034\344\fDd\006\366\243\370\316(\235\336\332^\006"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.13.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\355\007"
+	.string	"\342\01666Po\322\001\243\336,(h-\336\311\002\200\241\222\353\303\310\033\251\252\266,\267&\351!:\2136S_\373\200\231\261=,^\030\263\361}7\244\242\376\255%{\357\224\002\242YAUE\261\007\271\021\315\n\252\023\273\246\334X~\352\304\030BU\274\250eQ\031\257\320\202\025eu\210\037\002\323\206Y#Fi\215\034m\017\367\235\274}\003\346e\327p\227\344\351\220\036\204\255\215\334\253\260\017\367\235l\347\331\276r\262+\021\343\262)TI\206\355\314\346\330\032\n\302\335?\2749`\327\304\203dw\017l"
+	.string	"p\312\266\317\361\216\314\336\240v\201q\225\221\b\221\226\335\215\235\017dN\301\013dN=\213gw\231\177\220C\r\n\226\222it\247Q\330]\273\222i\342~\267]`;\301vH\r"
+	.ascii	"3\241\221\037\003b\302\030\352*\327\360&\213f1\241\2009\220\031"
+	.ascii	"\030\021T\300\001\250<\246v\222\001"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.14.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"=\n"
+	.string	"\246\323F<@\305\2521\340\271s\355\002P?\373D\017\274mk\273\375\027\315{\300\n\276l\020\362\206\332?*\304\b\323\\\223\350\356\362\303\351\202\005\214\372\323~\236-)a6\303\315\356\275\245L)2"
+	.string	"6"
+	.string	"3"
+	.string	"\030s\035\235\320\231\303\030\2413W\2615\340\021\345\0160\373\200\325\376{\363\304\242\245X\033\346LJu\262\274H\374\257L\251B\334\351\266\233\266\236\326\n\001\007I\200\3404N@J[k\332\316\327\306fp\217\022\222\b9\032\200hWc\315\374\003j\262\377\234B`\3145l\226\255Yn\021\335\342\360\301\277\232\311\376\221\323\207\245\2561\253\240X\264w\373Q\233m\316)g\233\241!\235\252\303\201\221\213\314S;\236\3444i\275\375\177\347\252\365\313\336\354\262\247[\266\354.+\005\030\b<\237\351CQQ\372\302\320\027j0\276p\242\240+\250\023~&\013Q\310#\201\243\021\b\362H\242\317\310\003\205%\257\263P\360\342\013=\023\b\206\236f\274\267\317U=,4\324\354\350E\326\001\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterCoefficients.15.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`#\b\005&"
+	.string	"*C\214\016I\220\230U:\212\353\337\"\033\233S\035\177\200/\034\244g\367W\r\200\351)r>c\350a\336\350KP\231\002Fo'\022\354\333e\276X\303\213\263\315\276\t\361\nP\025I\200]\206\255]\235\270}-%\344\2125D\b\221;\311\333"
+	.string	"\276"
+	.string	"\330"
+	.string	"Q\276|\363RN\345Un\345W\236\205eX\266~N3\310\336\225\n\332P\rrg\245\202\270c\r\227\210)8BT\035q\314\"\037\250\236x\200\302K\032\316\275WW\230\035\230\247x\t\013\316\bp#\253\r\327\275W\301S\2761\243NV\360\260\201A\212\314\205^\322\002\355\271\303\035H&X\345\223"
+	.string	"\257\204\227h\317-\no0\357\275\f\370\001\354)\r\275e\276\221\037\001>\312\305}\356u\352b\336\253d\300I\260\247\254<\220\372\024v"
+	.ascii	"\352S\0062o]\371t_;\264`0Qs\357\255\265\217\003\257\246h[ \337"
+	.ascii	"B5!6\005\257&\245Hm\320g9\232|z\022\233j\274_\f\205j\317\275"
+	.ascii	"7\326\264\242\366U\341\336\313\226\330D\343\374:3\243`f\026\314"
+	.ascii	"\260\006\001\273\240~q\301\354O3\243\370\331\023\201:\b\306\026"
+	.ascii	"\254a\007\231\227\257\"\023\003\3532\205\347S\313\360^\246#\333"
+	.ascii	"?m\243\370\364\333\366\327\244\320>\271\247\337\352\rc\232\225"
+	.ascii	"\213\311>\231\225\301\243\267y0\037\275\355\304\374\250\037\301"
+	.ascii	"\001\003G\005\b\320\214\212\210\206\204\356\344\037p\253\363"
+	.ascii	"\354R\277\200_\235\203\356<\003\035\313\371\347J~\237/\371{>"
+	.ascii	"u\3469\224\363\316\251\316:g\236s^u\226}\3129f-\343X\3130k\371"
+	.ascii	"e-\253\326rj-\243\326r[\313\326Z\376\002\331\f.Ea\356\225\361"
+	.ascii	"\354\272Xi\225\220O\375P~\252\237\371W\375S~\253\377\352w\376"
+	.ascii	"X\036c\376\237<\254\373\233\234~\265\322\321\214\332\314\"\336"
+	.ascii	"%k\265\225\216aVg\332\314$\316\206\227\260{o\004\376\032`\262"
+	.ascii	"\204\216\030(\027\352S\313\204\250\323\261N[\351\270euv\371Q"
+	.ascii	"\265\250\223\320\254H\242N\322Z\223C\235\224\265\032g-\324\022"
+	.ascii	"\200lY\3170\221\271\235j\246\004\032\t\315\212\2445R\326j4j\t"
+	.ascii	"?\252\254\3110\267SC\320Y\037\350\004hV\244SP\033\350\004Z\263"
+	.ascii	">\352\004Y\253\261@\377\313\232\fj;D{\303\323rE\336\313_]XA\353"
+	.ascii	"\246\233\007_\213_\306>\211\341\217\371\013\033\310\253\343\013"
+	.ascii	"\037\fo\301\356\r\336\310_\241>eK\274\3027\310g\361\215\260\247"
+	.ascii	";\343*/\322\323\001m\233\264\301za\337\260\200\356\2369\205\366"
+	.ascii	"\211\002u7\213\034\3138\021\272\035/=\361\263\277\234\305\215"
+	.ascii	"\350\231\300\245\016@\330\007 ,\004\020\326\001\316>\300Y\b"
+	.string	"8\253\353\265\340\240\341\272\024\270\r#~:\337\222\316'C\241\363Y\210\375\226\226t\274\234\312\271\006>]\n\023$\226j'x\273\035/W;A\002\267\253\345|\277Z\003!\346\365t\276Z\n\036\317W\223)\357\321\333N|\003\223\026\265\r\fJ\240{\315\255>\320\r\305\323\305\233UJ\3246+-m\240\355N\027oR\351P\333\244PZ\367\232T}\324V\247\2137\"\251P\333\210D\225\311\351\342\255Gj\353\201\032u\257\031\244\321>\224\254\213\267\032\351\254m5\320^\323\330\005\332\004\222(\313Kf\266G\261.fh\302bj!\34343\3162\3614N+\035\237\260f\316\331\273\323\260V:\246y5\007\200\223\250aTF\020RLdDDA\222$i\f\320\002\221)\2436\021@%\243JH$\260\214X\252u\003X\326\003)U\2671\2739H\334}\313cLv\304}\214Q\241\204N\265\321"
+	.string	"~z0a\221\3509\267S\227$5\223\257l\316u\032t\2674k\0164)\002s\262\362i\006\250\321\240\242\027\202\315VY\265\212[\371\301\034\323\207\205"
+	.string	"\263=U\365\366\334s\344\301\263\177"
+	.ascii	"\337!f\253p\262DL\365\202h\345\204\034\334n\247^\371\375\273"
+	.ascii	"\250\230X\232`\322\350\350`\232<\007\333k\350R\031\001r\320N"
+	.ascii	"\226\3575\272\330\323\277\034Yf\024C\254\271\343\334\211\352"
+	.ascii	"\320\246\222h)\220\351\343\356\260\375RT\224<K\235i\3121\232"
+	.ascii	"_\272\316\007V \034\177Ze\277G8\224.\345\274\300/G\177\022\013"
+	.ascii	"\310\035F)x\267ge?Ht\007\004\t\005\3630\366\035@O1\312+\354;"
+	.ascii	"\270\003\335R)\"S\337\322 \177@\2428Y>\361\353$`v\273\300\272"
+	.ascii	"nYT"
+	.text
+	.section	.gnu.lto_biquadFilterInit.16.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\375\002=\022"
+	.string	"\206\341tF\340\324f8d,\200e\343w&\370\b=8=b\241\314\241\317\231\020t9\215N\020\216\203\261R\004\330\210e\b\n\335!/\023xX\205\271pW+tEA\006\\\302mx\340\372\317ei\246-\331\335\366\2262\245["
+	.string	"^"
+	.string	"`"
+	.ascii	".V@\310\330k\214\3771\315\250\335\035KE\273\213b\007\336\271"
+	.ascii	"\004\333\323~\317}\306\303l.`W\207V\264\033C\361\002\357\234"
+	.ascii	"c/p:\347}\300\351\234G\273\310c;{\331\220\tYmw?\205\361\3619"
+	.ascii	"\372\237\035\365\312i=;\t\273\353|\345\244\270\365\266Ol\263"
+	.ascii	"\330\312\n\333\356\256U\307>\354\007p\241\277\344A?\352@\277"
+	.ascii	"\367\237\277\3134\227\351-\323\232\351\314\364\r\244\212\222"
+	.ascii	"\032\034\355\242H\202d\2218#\031'\372\355\177\346\224?t\033\343"
+	.ascii	"\211h\274\026\316\005\031\021\323.\016\203s^\361\316\235\005"
+	.ascii	"\201M\210\304\220\nA\246m&{\342\306\207\202\002\325l&[\"\346"
+	.ascii	"\360\243\016\\\323\2466\313{x\330\264s-\361\250\332\037\316\243"
+	.ascii	"E\233Rm\325u\200\251\235\213\b\017\354j\203x\016\337h\345\022"
+	.ascii	" H\f\233\323\271\224\275\216\330\">3\315\333\335\007\327\316"
+	.ascii	"\245\324\004se\022\243\262DQ\352i\247\277\361Y\350\275l\031V"
+	.ascii	"\376e\0053zV\205\266\354X+\365\205\375\254\325\n\fU'0\246f\203"
+	.ascii	"\312\301\231\226\f!X\240\270\002\305\224\f(N(9Y\225\"\2023#\\"
+	.ascii	"V\037L\370\362\022\252>\030\227\226\227O%\262\276\224\003\016"
+	.ascii	"c@\361\233\tC\361K\305\366\333\252\216-\340@r\351\215i\266\335"
+	.ascii	"\026\021\230~\224nc\270\020\225\003\251\325|\334\326\360\037"
+	.ascii	"4\333yb\257<\t\301Ngd\204F\215S\0076 \020\003\231\251\311\003"
+	.ascii	"\230s\320\r\221\336\224a\274\341\035\356\234\024_\312\300\002"
+	.ascii	"\263\236!\031\300>$\230\210\350\217c\n\251Y\266\235bB\270L\273"
+	.ascii	"\252\270L;\305\204\300e~\002\301/\3412-\301\254\244\375\260;"
+	.ascii	"F\306\257\264go-S\366c\322\355r0\177\355b\037\253M\023\330\225"
+	.ascii	"<\017\317\226\201%\306\210\"nc\374\212\2648\005\340\362\242\255"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.17.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\264\002\345\021"
+	.string	"V\237pH\340\262(\035bI\201E\276f\362\256\001\330\277q\264\252PJ\243\216t\340i\244\367\214\030\203I\221\256o\300\177M\363\"\376S\217\253\274\213]\261\215\253"
+	.string	"\332C(\203P\330\3417\364@\365\0201\257\252\355I#\204\310\235RU"
+	.string	"b"
+	.string	"V"
+	.ascii	"\277q\351\322\356\217\221mwI\254\372\336\215p\237\366a<F\354"
+	.ascii	"5\226\017\330\245\001\262\355\222$f\360\2753\371\002\336\273"
+	.ascii	"\357\004\274w\216\331E'k\366D>J\3140\332]PY<\366\031\363\357"
+	.ascii	"\363\322K\214\354\223\004aw=_bdn\275\355\004\2669\330\252 \356"
+	.ascii	"\336ss\267\325\376\211\022 3\224\n\3325qDd\205:\033.\276\363"
+	.ascii	"\363\374=\277\355\234\375\323x\215\227\367\361\311\366cCO\221"
+	.ascii	"\006\036\227#.\250\205\031\001\344E\006{\307\345';a\200\004\221"
+	.ascii	"Q\220\335m\360\316\030lN'D\321\204\034\227\034jaZt$(\016\214"
+	.ascii	"C\255\213\212\024\017&y\031\261$\235j\263<\314\277xAM\307\316"
+	.ascii	"\250\314v\353@\236\252\r\021\232\370\237\356\246\362\034\234"
+	.ascii	"\252\315\020\232]\307\341\362\333]\007\376\r\021 \016\324\264"
+	.ascii	"`\361\336\251\252\215\220[m6\217lR6u\205}nw\327Jc_\3477=\347"
+	.ascii	"/\035\347\377~\363\223\276s{\347y\252\225Y\2622U\260Y\002\233"
+	.ascii	"a\n\354B\205\207/\023\013\035\\\341x\022\216'\225p\214`\362\274"
+	.ascii	"J\215\341\353\003\353\004D\021[-q\005\242\260LZ\340jt\201)\004"
+	.ascii	"\026S\302\021|\211\342\b\236\310=\267Jc\n(\204f\332bOy\264\340"
+	.ascii	"\320:\035\272q\032tDS\335\021\240\307\254\310m\006\3004iI?\r"
+	.ascii	"8 \360\002\031\261\321\003\370r\020\f\221\346)\363xG2\034\214"
+	.ascii	"\204\214\035\210t =\214\265\330\200@\024\214\035\260jC*-6\020"
+	.ascii	"\303\361\031D\342\030\274\277\220\215\277\226)s\350\0179\035"
+	.ascii	"[\316\020\"%\204r\316f)\203\034\271\215a\210$\216d\237x/\245"
+	.ascii	"\223\316x\265a\274\355.W[Mb7y^\274,\003\226\b#\212\270\211\301"
+	.ascii	"+\322\330\024\020\227\027\355!\003"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.18.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\007\003\r\023"
+	.string	"\226\341vG\32005\035\342\354\305\305\231\004H\366R?\320\033F\274\215\321#\321c\236\036\355`LR\300r\201\310:?C\302d`\205\007'\231\373\013\210\245^\376\343\207\360VX\r'@H\363\336R\032\313i]%K\233\354\235R\\"
+	.string	"f"
+	.string	"]"
+	.ascii	"8\"~\030\314\361*\302\013\231\364\307\356\013\036\345\356\226"
+	.ascii	"\370d{\035\311>\355\007=E\370W\315\003\354\372<\225\273c\211"
+	.ascii	"\021l\257\036?@{"
+	.string	"\335.@{uhS}\374\331G\355p \252\332\335\216\222x\370\031\372'\372\207\016\217\315'\253\301\356z\352\360|\270\351m\223\330N\261iN\237!! f,\210\332\355pe\265P\025f\342M?\354g\372\313g\366}\362\245\317t\330\233\356dnIi*\t\211\352(\274Q(\363\"\247\024q2\276\321\217\236\364%sJS\022\220\250\"\26009\202#\262;98N@\260e\276\302\344f\343\201\300\006\033U9v7\301\253\037l\257\347l\323!\232Ld\003\224N\352\227-\026\346u|\340%c{\250M\353O\033\245@V\256\3571X\261\227\303\320(\005\332\341zi\230\2730Y\340gw\025\370-4d\360K\274\3725\332k\245w:\t\220\216\330K\234W\366x3\351\b\373\331R\037\373\345\275\235\351f\035vko\272\353\207\376\354B?\375\353\001'3\023ef\236\320L\024\232\351\305\250L\250"
+	.string	"\343\201,\036\310\275x\240\003"
+	.string	"\232WL@/\346B\013K\347\362\265Z\337J\347\322\242\322\352V@\230\316\304\200?\f\036\330\305|\037\330q\243x\242oK!\240Dz\343\215J\335\f\271X\364FL\2435\256\\\225\3220\t\"U\305\036\261\036\220\351S\320L\036\205\030\004\265\316vE\222\214\006? \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.ascii	"\b\212\354}]r\230\036\366\264L/\314\r{\0056\332\314\322z\276"
+	.ascii	"\236\006y9f\n%q\202\321\027\304\340\327\262\bg\354\360\2175\355"
+	.ascii	"\214\361\372\320\202e\262@\256a\263\210\034h\314K8f\350a \244"
+	.ascii	"a\005\006B\tW$\204m\220\316%\f!\345y\214W$\235\2243E\253\325"
+	.ascii	"@\fx{\200\2163\242\03071\272\"\315O\001qy\321B2"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.19.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\374\002\035\023"
+	.string	"\226\243zF\360\320h8\370c\325\304\316\213\026\033.\022\\\325`\277\327XHn\377\266k0\212\336y\205\322\371\223\321l\200u\374&\342L\nP''cg\033\270\2149{\250\315\260\032\334l\256\005V`g\354\266{o)S\na"
+	.string	"Z"
+	.string	"m"
+	.string	"\273\t\356y\001\230\371\035\343\\\332\025\312\341\263\273%V\360\264o{\211\330G\230\247vk\206|v\307\022#"
+	.string	"\357y\004m\373#N\"f\343\272\361\003\316'\303A\346\206cw\303\002W}\367\272\213|\367\324\346\261g\314\377\355\235\b\235\033\264\231\230'\311\301\356:i3\032n\275m\003\266\033\330j!\231\263\307\230T\017\366\273\325\032\373<\267\352;\377\310\307_$\323\251L\207d\032$\323\250L\2372\375\221iS\246=2]\3124\230iR\246\277L{\231\3562\255\231\316L\237\004E\004\203\001\213]\f9\035[\344\375\2008\317o\307\374\233M\266y*\2001\031"
+	.string	"\320lhjl\263\020\037j\322\223\022\260\301:\320\207\376\306\204\377\230\3644J\372\251\207\006\330\001*IKJ\022c\226#\266\356\003\352\211nl2\327{Hz\234\247\251\237zF\263\016b\346\334\251\252\247\244\025\263\034\261\345):\375\355\306&s9\n\325\223\031#zM\355\214f9\242_~\3028pwO|\023\017(\20080\337\275kI\354\251\331d\0010\225\027\227\325\353\203\275\260\254\260\274\317)&\257\025L\205\025!\\q\265Z\256\224p\205\005\241\025\246\274\\B\023\001v\261\254^!\314\345z\205\246q\337\255\326\250\024ua\250H\246\242UZ\024T\333 #B\321yA;\262[\356\302\023\201j4\262\026'\031(\265\034\355(\245(Ui\206(\210\246\364\300mu\241\020M \t\017\002\321\274\235\324CQ:@E5 \340\"\021\253y\351\232\"\"\236\224\024\r^\202N0\020\315T\022\243"
+	.ascii	"Cpe\250\323\324\3024\302\027W\033\fX\357\3568.\220:kf\216\030"
+	.ascii	"P\362\035(\211\b\313\023\003%\337\001%\301\274<^\3270\251\271"
+	.ascii	"0\004R\022\t\307[g\320Ma\314R\262!~C\254P\307\005F!x\023[\025"
+	.ascii	"\212HD8\313)4\273\255r\002A\226k\342)K1]\202\f"
+	.text
+	.section	.gnu.lto_biquadFilterApply.20.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`b\002\325\020"
+	.string	"\266\237lD\020\257h8\300&\017\023\217H\345>\250\205\222\323du\374>\307\315l\211\364\267'"
+	.string	"8\214\2400g?\365\367O\351\216X\002H\332*\002"
+	.string	""
+	.string	"(aQf\332\177:\020\224\353\214\233\221mv\357\275\267\224)\005W"
+	.string	"Q"
+	.string	"Z"
+	.string	"\273/-Zvw\303\006\236\366U\276\201\365\361\343\030\273\257\022-\273\343\206\tx\337<z\266}\224\247\260l\026m\264`\302\205h\b\221\265\330\335O\300\001p\337\264\207\270oZr\326\223\345_v-\003\312\3145\322zv\nv\327\351\032\241p\353m\017\260\235\300N\026\001+\177\306\307\037#\323\240L\1772\355\311t'\323\234Lo2\255\311\264\227\351.\323\\\246\267Lk\231\326Lg\246\257\001\0229\201 fw\302\354\305\312l.\027\036\373m\226/3\307v,\202\327\022\321p\225\244\250\330\335\002\337|\300\313\374\212Y\254\t\233z\252\315\210\030\302\2349\244\234v\312\215\020a\340Cp*\322tS\235\021a\017\376A\323.\204q\241\232\032\322\004!\222\244\356A\225#E\206^S\265\031\021\026z\365\016f\361v\227\303\347\260"
+	.ascii	"\202g\362\301}\273jB\230\023\025\220\234\331c+\265\202}m\365"
+	.ascii	"e?v\207\036\252\216U\212\204\342T+\217Si\343<\022\241H\252\216"
+	.ascii	"R\203\357\004\232L\340\350;\225\030\230\276\021*\365\211\002"
+	.ascii	"\030\364 \241>\025\b\242>\316\270\327V_!\375H\230\311\200hh\220"
+	.ascii	"\276|\264\243 \217~J'\341\341h\307\301Ep\264\013cN6\352\342A"
+	.ascii	"\2212\327\n\215z\272\321\316\204Hbz\213F/\3534, \260\"\231\263"
+	.ascii	"z\251M\021\212\007L\242YI\320c\003\271\264`\320\233\321\030\350"
+	.ascii	"5\034d\0024\214\254\264`\024\2446`\004\343M\316\214E\037\206"
+	.ascii	"<%\004\341\341\340\240\256\354E1W\243P\321\033\306\234\222\035"
+	.ascii	"\361\333cu\024\027\326\206`O,E\024\221\350p\026)4\275\255B\002"
+	.ascii	"\201\226o\342\311\245\230\256N\006"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.21.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\305\013"
+	.string	"V\325N@\020O&\035\200\203[o\322O\r@\345\343\256\254"
+	.string	"\205\277To\0278\311\025\350\336gb\223\326\360O[EPA\002\214\306\307"
+	.string	"\250\b\200\304\357\335 =\210\240\334\214\206\\7\272\004mB\366N)9"
+	.string	"="
+	.string	"<"
+	.string	"$v\313\002&\320\235sy"
+	.string	"\365\\\367\215z\316\244\275\342e\206\375\013D\004\327lw=\212\341\344'\351\337\365\307\210\364\371t \330]\317\021\251\302Mo{\200m\212}\t\001\257_\375\333U\377|\214;k11\261K\241\366bOp%6\330>\304\366\3262,@dE,\324\204\226\367@~5\316\310\212B\023\ft\347\"\363\323~\352\035\310\253<\327\330=\251\bvx\021\206q\026b\250\322Fm\b\017\341\b\241\240\225>V;\363\017c\267\273\007\374Wg\223\221bw\257\301S\317QL\034L)\031h\326\354\3623\351\005\373\333\356\256\351\311~\353\001\227\315\002j\351|\t8!\003\314\307\301\250\256HD\213\306\301w\3610!\b\206\025\017\363)"
+	.string	"\275\212\230\361$\002\034>\260\210\236&\fE\017R\356],\215\005\210\206\354\203\325n\360\021 +6\223U\032\027"
+	.string	"i\231\"34\030!Z"
+	.string	"o\023\004@\031)\366\034MM\205\300$E\265Pe\004\231"
+	.ascii	"\31056\300\306SB\2210\222\204\270@\370L\215\202\313\322\324h"
+	.ascii	"p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pt1FilterXyzInit.22.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`t\001\365\016"
+	.string	"f\034cC"
+	.string	"\223\324\030\270\255\374\0274\256\255\031T\330\334!W\322\033[\305\252\254\262?\255\227\274\2048\2041\234\255M\024\250\002\233E\311\025\351\220\364\256\252\350l\331\214m\254\366\r\236\202\224NzA\031\267\224R\246\024N"
+	.string	"O"
+	.string	"L"
+	.ascii	"\323\0046\313\226Z\036\356f\356\330\215\020/\332\177\016\232"
+	.ascii	"(t\354\334\370J\226\021\276R-\222\342r\202V\215"
+	.string	"\224\312d\031\005\374\017\240\372\020\031\274\027\025\352\305\0240\206\206\331\204\225\223R\301\370\211\244\374\357K\251H\270\233\333\216\332Bh\275\"$4rH\300\371E\324\206\374F\312@\341\227[\267\250a\257\332L\323\210\031\213\341\350\361\377\304\262\016\246\245G\332\276\316,J\246\251\254\235\337\306\216\232\377\2366\230\226\b\242_k\025f\225\334r\361\200\177%\253\371;OM\246e;\027\330,\003\216\261\013l8\241cX9 J\240^\255\225\265}%m;\030Fe\006f\376Gh1\370\205\206\371\377\201\213\f\034Ht\234p\331,\r\263\202\03184\332\351\325 \374o\202P\246\355L\317\377_\270j\247il\351\226\035\375r\335\t$\320\006\225X\301[?(\243\225\026\013 \n\034\213(\024\022}8\026\220J\210\373\214H\034\312\201\212.\254\214\270\026\221h\304\215t\267\017W\235`ss\202\250J\330\222\034\2432"
+	.string	"v\271\304\307\217 1\247W\223P\246\235\031\234\020\316\336\211\r_<64\020\327\314\303\023\022! `\2021\211\354\006iS\306x/\205\003\021`\330\231\215!\376\346M"
+	.ascii	"\234gJr\205\177o\220-\f\270*\3232\303\027@\026u\024\256\321D"
+	.ascii	"\366\251e\313\005\330\2466\352t\266\201&\322\212e\265\213b\021"
+	.ascii	"m\260\332\333\016\370R\356\\\342\t"
+	.text
+	.section	.gnu.lto_pt1FilterXyzApply.23.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`z\002\265\023"
+	.string	"\206%\200H\340\322&\035\222\224\311\374\002:-\023\340v\227\035\031j\224\227di\325\217\272\373\032\t\036\301\214\203r\247Yf\215\323v7\022jp\341\3409\214\033f\230A\311\236N\r\035q\300z9\"\2662\325\334&\215\354-wJ\001h"
+	.string	"e"
+	.string	"k"
+	.ascii	"\017\036\355\243x\212\327m4_\355\352\324\200\261\013\232\230"
+	.ascii	"\304\3734x\002\335\247\367\001\335\247_v\322\301\236\375\216"
+	.ascii	"\0365\267\246\335\375\224\307z\t\3362\276>\245\306\227\177B\271"
+	.ascii	"}\001\020\016Z\r\366)\003\354\256\252\326A:\21065Y\224&p\256"
+	.ascii	"\037:\211-\244\325p\036O(\273\353H\253}\270\273\333v\331\246"
+	.ascii	"`G\025\001\272c\377\273\273V\035{u\360W]\350N\335\366\0038\356"
+	.ascii	"F\311hOF\237dt'\243g\214\2263Zgt\224\321\0270\262\224\243\202"
+	.ascii	"\322\256\2070\310\032\315\"\022\307\375B\366Y\370C8\323\360`"
+	.ascii	"7\036\016\247$\301\373\374o\026\361W<\350u\241\031\017vS\200"
+	.ascii	"\306\223\344cwK>\r\301\373T #h\242\246>\327\251\235\036\3201"
+	.ascii	"+!{\f\r\316y\276\211\272\317\251\267\t\241\252R\251\237\235\220"
+	.ascii	"\267\215.\252\352g>\262\030\032\245QOH5Cb1t9\221s'=\273;\301"
+	.ascii	"f\375E\353\223\301\365C/\t\n\362S\024\213\241\352\356\302Tw\234"
+	.ascii	"\341.\234\363v7\202\337\202\005&\001\217\335\375\b\232\3563\245"
+	.ascii	"\023\004\323\217-\026C\033\204\3050-2)\362\3027\314\310hg\225"
+	.ascii	"\023\327J\214K\013\313\367\322b\261Z*\337KK\n\353Sq\301|'\b\334"
+	.ascii	"\302\260\342\372bZ-\327'\002\356U\347v/\307d\024S\331\324\035"
+	.ascii	"\243\216t\245z\024K\216R\033\223\243\364KAG\034\"\220\313\335"
+	.ascii	"]\331\340(]\351E\330\302Y\216L\325c\001(\347\351\f\347\f\310"
+	.ascii	"\030Q$\332\217\223^=\355n\314rR\332\351I;!\2632 p\202\221\223"
+	.ascii	"\254\003)\246\210\241\375\033\316D\032\362\235\026\254m\024\030"
+	.ascii	"<\241\366+\021\354\006\327\356\260\031\334\245\025\207\303F\244"
+	.ascii	"\234$P\030H/<\222(\032/\261\330yl\343\221\001\336\326\020\202"
+	.ascii	"\236T\237\340I4\177\022\002c\200r\216\210\3402\355\203\330I\027"
+	.ascii	"(H\024\356{\315\204\005\227\353\312s\003\032%\334K\030\"\260"
+	.ascii	"\301jo?\340\227r\3472O"
+	.text
+	.section	.gnu.lto_biquadFilterXyzInit.24.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\231\002\345\022"
+	.string	"\346\"zH\320\224M:$% HR$TEL\337\254gx\350\b\006e\027(\226.\303\002t,i#@\035\352\260a\232\036\266\304\330wY\352\302\037Hj\022G\003Pi`\3203\277q\221\201p\251\317\363:#ido\271S\na"
+	.string	"f"
+	.string	"d"
+	.string	"\367\251\371\311.\217\216\244\335\332\212S\274O\327\216\322}z\027\320}\372e\373x\215\266':BB\b\267\273\237\262\260^\326n\031_\237R\343\313G\265\030\275@\021\017\331\f\366)MvW5\023!\025D\234Y,\312\0279\327#=\345''\233\345<\242Zv\327Q6;qw\267\035\332\276`G\240\336\207~\324\203\376\356@\377\274\317/o\273_\022"
+	.string	"\305\216\007BvK\344\214\254\323Trq\333\355\037\371H63y0\023\036\021Q\356\307\356\252|\332\202\367\371\224mY\364a\210\204!\337\244\311\342\304l\0214\210F\232\354\315\n\232\203X\373\214\327\201|3\311nS\221\244\335]\361\002\357\223\200|\264\037\3432^\001\340q4a\270\r!\030\270+\235\3117\224\036\253/\225\364P&\031\020\337lG\003\266C\274\206o\bh\273\333\300\326\360$\226\267\273\fn\036Z\007h-j\272\317\324R\020\016g\023sFEOQ\332\351\324\253T\333\325!^\346#\375\344H\305\316\352(Luwa\252=v\r\026\277\273k\345\261U/\372\003\256\025\b\027\t\312\320T\230pp\306\205B\006\027\030\302\200a\212\003\030B"
+	.ascii	"\320\371\205%\004g6\254`\276\230\026\213\325z\371bV.\254\357"
+	.ascii	"%t},\003\334\222\001\303o\246\325\n\277Tm\377U\036\337\350\236"
+	.ascii	"\222\216\223\215\306\246\366\230\344IU\252OQ\345W\234\225_\037"
+	.ascii	"\204\306\323M$r\271\273+\235\340W\225~\347'7\"E\354F\2165 \320"
+	.ascii	"\002\2312\352\370r\220\f\221j\312<\036\013\341\230B\277\265]"
+	.ascii	"\235[\252\025$L\333k0\233;\024\330\0066\0026x\334k\020\272ax"
+	.ascii	"\360\326$\020`/`\212+cO\222i\310\322\032a\017I\250\006\245\331"
+	.ascii	"b\003\321\377\332\256\320\024\272\354A \317\207\227e\240\022"
+	.ascii	"3\242\030\2671tE\332)\335\275\320\020\261\r\026\366v\006|S\356"
+	.ascii	"\\\376\t"
+	.text
+	.section	.gnu.lto_biquadFilterXyzUpdate.25.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\322\002=\022"
+	.string	"\026auH\320\224M:\244\322hnAn\270\320\265ye\002A\374\022q\243\202_\034\225\264\201\215$eOM\226~~[\311\234\320\360O\305XP\242\325_)\304\033VD\326"
+	.string	"{\253\270\233\300\001\234:[!\3076\"m\023\271S\n\\"
+	.string	"a"
+	.string	"^"
+	.ascii	"9-rv\033\257\377\370\310\250]\235%D\273\273b\005\335\347\201"
+	.ascii	"\355\322~\215\373\274.\233\271\200\335\235\032\321\356l\305*"
+	.ascii	"\335\247g/p\372\354N\340\364\351\227}\3443\031{#6)n(\331]Oc\374"
+	.ascii	"u\371\362?\036\025\303\201]r\rv\3272\206\303\342\326\333F`\373"
+	.ascii	"\203\255\017\002\377\311e?\200\017\375\251\013\375\250\007\375"
+	.ascii	"\335\201~N\245\247Jo*\255*-U\372)\003\212\222\"\340\330\265i"
+	.ascii	"Z\262H\263\210\306i\277\375\2176\361u|\307\3534\261\203\335L"
+	.ascii	"\310\321bi\367&\301\2477t\237w\2212\207H\360\254\240 T\223\260"
+	.ascii	"\005\225\330P\026\305\013\037\007\n\344qCY\0255\001A:\250rJc"
+	.ascii	"\217\374\341\341>T\222Iv\265\r\342=<\006\250\355\356\002{\365"
+	.ascii	"\243o\372F\254\020'\265\0313\247O\231$\206\304n}\364\330\355"
+	.ascii	"n\313\225S\242\365\310hd\223S2\245(\355\224\323\023}tu1\033\214"
+	.ascii	"\221\217Y\005\006\220\315Q\230=\203I\345\261\277\355\356Zw\354"
+	.ascii	"\377\004\"\213\365\201\253\323\007s\342B\205\1772*\027\021\342"
+	.ascii	"\027\262\276\320$\346\013!\244\304\226\t\325v\362\212%\374dF"
+	.ascii	"\264X\336\013\350r\201+\357\245\245ry\253P\364X\f\030\204\371"
+	.ascii	"BO\006\004C\317d\266\337Vw\354\302\003\211Fk,n\273:\fN\373\227"
+	.ascii	"~d\223g\021\013'\202a*\247d\324\263\r\311\360$\r\033\223\n\341"
+	.ascii	"\3609 0\003\231\341\264\001xr8\017\230\362\350\231xp2\334\022"
+	.ascii	"\203\030\3026\360\245\265\035f7\007\013\275\306\232\300\3276"
+	.ascii	"\360\255\325\016f\260y\203\266\234]\211\251\201\361\017\255a"
+	.ascii	"\370\1770\303\215x\325 <7\334\3145\361`\037\t\346\267\335\323"
+	.ascii	"c\332\330f\020\362:\206\202\366z,\214\036&\210\224\0131\247\b"
+	.ascii	"\326\300\277\"-N\001\277\274h5\031"
+	.text
+	.section	.gnu.lto_biquadNotchTableInit.26.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`Z\004=\034"
+	.string	"Vt\264I\240\230Q:"
+	.string	"\365\003\324\017|\251\362N\331\276=| ~\331\t\270V4\323\324\021W\256'\256\240\331\371\253\277\377-#\255j+E\034[v\300c\362-\340\274"
+	.string	"-\275\202\323\030\343\202\247\306)\004Z=@>!D\356\224\002\237"
+	.string	"\225"
+	.string	"\242"
+	.string	"\265\326\005/]\301LU|v\311\n2@\355\355\bJH\342\"\031\240\022\r\341\200@\207?\242\373\222\213\256\251uJ\032c\255\265\201\037\234/\r\220\247\366\213\334\210\356B\026\027Pk\022\225\261\326a\003+8_z\370\001\346\313\363:\346K\353\354/\037*\3257\375x\241\244L\255\025\266=\206'\2077Iu/\311\245:\237\370\003M\250~\300\335K\262\205Q\f"
+	.ascii	"@\027d\317\216\013\231C\235\022\001\207(9\304\350{\250+ b\375"
+	.ascii	"\200F\247\255\t\265V\323\037\220\306m\336v\316\266\007\233l\021"
+	.ascii	"\364h\017wty\330o\201Ab\362&\331<_\362\357\234\351\317\271\360"
+	.ascii	"\307\271\323}C\251_\177\272]_\372m\236\344\257\271\361nQj\223"
+	.ascii	"R\227\224\232\244\324K\251)\245~\001\235\032X*`\325:\343\230"
+	.ascii	"\246V\225O\202<\3527\376O\277\323I\373\366\237\370Rv\371P\036"
+	.ascii	"E\367(\024\347\256\310B\2230\253\326\"\r\347\313#\355\\\307\204"
+	.ascii	"\262\353\245\321Q\347\256\350d\322d$\303\233\370N\236\\4\320"
+	.ascii	"\223a\274p\276\244'\332e\333)\305\271+\"\360\363\001$+8\364\227"
+	.ascii	"\2319\273#\345R\263\363g\217\240\321\377L\326\033\273\263\315"
+	.ascii	"\356\222\373'_\216\233\245\273{\037\221\326\322\275\324\313)"
+	.ascii	"\342\321\227\305\243\307\33522\250\202\353\235\265K<"
+	.string	"\313\212V\317\212\231\234\265k\257Z++\301\243\257m\373\025*\346\027\206G\217~\255\213Gs<V\275\276B\304\242o\312>q*.\236\265V\b\376T\b\334\215\322\017\026\346\3132\251J\360\210\307\353\301@\3529\036\307\274\366fO|\316\223\217H\361\246\275Zy\b\\\373\332\004J|cl\266f]{'\247p\344D\306'd(\270\237\237\231Mf\322\036\003A\205|\202f9\234y\341\263\\\f\003\t\334\354\3663\273\271\204|T\304j\245\220\017\020\255V\316L\210\210\345J\313\034\334f9\023\264\037\030\220\255V\263\311`@\264X\r&\273\341`\016\n\330\0264\273\301r6\333\r\346\252\337\244\023\177B\261Q\305\333\241ry\270u\265<\273Wt\301[K4\274\243\314\326^\210\344\252G\317\234$\031\274\265<{\250\223i\210X(\310Zu\364d-\321\243M/\033\336\205\203i\246\\\333A\337\342\342"
+	.ascii	"\245Zk\004\273\303\265|x\211c\020\227*\267ee\025\024\006N\250"
+	.ascii	"A4d\030C\212\020\222@\002\"\322&\215\001\200\002\221A#\017\021"
+	.ascii	"P\275dDZ\240\032\305\372\031[\016\256\306\266\343\2315\256ee"
+	.ascii	"\330h2,\243\371\354\007\202\202\336\371\323\013b\024\032=GP9"
+	.ascii	"\347\330\262\210Sh\313z\"\304G\217\023\\\217}\206\204\352H\201"
+	.ascii	"\f\356\207*\035\215\215Hk:CdHO-\tF\"Z\223\004\234\351\210\025"
+	.ascii	"/\302\354\b\232\275Q!\364>-\215\314M\252\030U^\3137{\202\226"
+	.ascii	"{\232\374D\n,\275\027\221\rsO \344\\+\274<s\224p\216BL\211\033"
+	.ascii	"\r\021\322N\255\270\023\034\0060\247b\351\215\243\323\231?"
+	.text
+	.section	.gnu.lto_biquadNotchTableMatches.27.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`z\001}\017"
+	.string	"6\236iE\360\320&\035\372\355\252\363\331\376\371\305\024~\315\362:-}K|;,qb\222\016\037\323\377\376\305j\247\030\371m\221OI\251\035\331\3632\t='\033$<n,\272\344}\036\030\007G}\266 \203\354-eJ\001U"
+	.string	"T"
+	.string	"T"
+	.string	"\321\336?\260\307\354\036\330\243m'P\240r\312=\232\227\327\354\260\274\204v=MA<\345\021j\246\370\177=\336\254\370Z\\*\217\036\016I\273;riH\205 0>\035"
+	.string	"\270Z\360\003(\346\305_O\027\027+s\003\302\356:[\\\034n\354\266)\330n`\337E\034\317\371\263\343\374\033X:\3024\204i\205\351\214\351\217<l\200\"\314\330}\371h\354Ol1\302\266\312\036\331\206:\346\201\035\353\302\"\321\263\273!f\240\336M\250\236\223\001vl+\346\005A\366H\202\231\366o^Bu\034\224\007\330\225\211\321\263\353\205\030${\037\214\326\356\252"
+	.string	"\364Q\205\212\355\254\bqh\252\352\200\327\212\r\313\247\253\270\220\352\240\346\027\321\002\363\243:\343L\2579t\"\250\225C\266QO\301e\273\255\005>\n\023\fY\210G\037\005{\274\n\b\302Y\345g{*\2513\366\341\356\256U\306vZt\235?\022\276\245J\023,\234l\335\310\326\2156\222\n\245T\264I\244\333R$\247\021\255\204C\2418\223Vr*\2414Sw\242\211\0200g\262uZ\212\343:m\344\355\341\252\214\023\032x\352\201Gu\261-R\322JY\216*\322\263\324X\345\207E\235\201J3$\203\005\3449k\303\207\237\365\203/\034"
+	.ascii	"L\204\236\324\302\013Z\0218\242~\026\300\2150+s\016\306\266\260"
+	.ascii	"h\207M4\254\027\004O0v\004\213\342\2263,{\025\327\304\271\t\\"
+	.ascii	"\320\332$\304\005\302gj\024\\\3064\235\210\204\233\256\252Y9"
+	.ascii	"\220eM("
+	.text
+	.section	.gnu.lto_biquadFilterXyzUpdateNotchFromTable.28.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\337\004\335\033"
+	.string	"\3462\260H\260\326M:4\233P\002k\311\204\027\036\207{\240-\026,\312\026\245o\310\007\240\340)\371\330\361\245\020\322\256yN\254\304G\272\003\013\036\235k\331h\241'\276\030\376\356\235O\351f{%}\320\300\037\351\237 B\266\224)\005\235"
+	.string	"\206"
+	.string	"\236"
+	.string	"o\361D\353j\203x\3607\362#\3579F\325\004\303\024\316\300N6_\270\320r\272 \205\023W\304\320Qj\252\3025\347Tp\320\025lI\304>)\233/tX\"\254\020\024<\262\271\013\242\344Gy\377\221t \376I\331\334\341\260Q5\347d\340\007\342A\003\362j\277\307}$=J\305o\346\\\372R5'\217\201\023\210\007\315{NxP<\200\360\240\223\354\255\363\230\346\265\226\260\030\322e\316I[\035O\272&\371\357=FI\306\212+\f\2059\247UI\306\214{o\333\3076\007\033\344\020s\367\343[m8\022w\240\b\017~m\226\266\300\242r\032f\363t\2729\354\313\271K\366\201\374\003\036\365\013\270\324\335\363\251{v\252\233G\325;\367\335:'\362\347\\\310\037@\252q\244\372F\252eRm#\3255RM#\3253R\035\223j\031\251\216\221jQ\3250R\035J5(\325R\252W\252U\252\177"
+	.string	"\200\026'\030\250\314\t#\314\313\304\002\255x\334\367K\375S?\325\245}\373H\374*\307|\376}\316\230\001\307\232Y\230./\250\330\206;\273\301\2632\033\333\3607>\205+\256\314\316~\243S\211_\341\200\230\230H`\022\027\250i\301w\026fy\256\2147t\032\226\341Kp\005\262\346\334A\260G\\I\321A\002Y\341\302tu\201Y\201K\263<\253\275\321ig\301}\357\240\215^\330\3105\341\376\205:\273\263\bz4\253\263\257z\020\215\036\227\361*g[}b\226f\303/\337\275xf7g\316Gn\314Z\307.\235\206yWW\356J\031\237l\377\355\276\327\364\315Y\335\220\311\350\244\263\211'\301\2113\265\017jd#B\022\252\335B\210\016@\350\203\232\232\030\272\005\311\f\221"
+	.string	"QC\002\217\210N\324dh\241\006\267!$\022D!hF\266\242\"\233\020\315\210\250VD\023\272\035\321\032\b\260\255\304\320\215\206d\263\335h1^\356r\356\2225l\301\312\255\3168_\035\356\245^JZrz\2638+\177\243\323\224\263\275\331\024\276\"\343\223.\213\207s\201\315\266>\374\n\027\250\036+\265W\001\2531[\333A\317\262\317&k\316\t\301\026:\225!q\316\3713\305\202\b\232,\025\341A0\312\027T\r\331\316l\217\315\312f\266fm\242\340\200\230\240\3248!\n[\250QP\005\211#RR#)HI\322\032\340\002\2211\342\006\021 \265T\252j\202\244\240\240Z8\005%\245\262\016\244Ry\003\327_6\372\372\213o\224k\226\333I\266:\007\355&r\025\257\205We\004\327\255Dw\220MvF>C@\025f\231!1r\224\"\337+2\355\365j\314\345\363Kd"
+	.string	"\251h\237smD\b\330\004\326\263\221&\373\367\265\323\231\216\013A\267\227\227/BD\211##\031\201$\237)\237\016\326\234\307\306\025\362A0\221[\326C\372\264\325\034\"\030?\002W\002\"\t\360g\254"
+	.ascii	"\210|\354D\315\317\240#\330Pr\003\005,\315\257\302F-h\370\007"
+	.text
+	.section	.gnu.lto_biquadFilterXyzApply.29.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\177\004-\032"
+	.string	"\346\357\243H\300\226M:\025\034\213Dxb:/\032\027Rerr\350T\261yg\201j\317obv\221\372l~}h[\f\355\236\332{\262\363\b\022\312\242\366\177v\303\246\374|&V\270q\006N\341@\253\007=\2324\262\211\224)\005\212"
+	.string	"\201"
+	.string	"\224"
+	.string	"\322\017\362%\334}\216\022sG\242\220!a\260\3149\027\\:\202xI"
+	.string	"\374\313\266\366\374\224\005\341j\237\307{\340\356\303\304i\346D\202bd\316^\003+\020/\335\273Mx)~\026^\032g[y/i\336\352\013\n\037\2279'mgx\017\366nPq\227\340*\316o]\370\361\002K\250\214x\271KP6\347\204\361N\200\017t\307#R\020\007\213\357\231\256`\274b\304cqm]\230sZ\215x+\356\360\266o\2663\330\340\216C\372\333\235s\346ve\330\275\234~.\222\255\363\246;\347>~"
+	.ascii	"w\272q\336\373o\356\273gR]#\3254R-\223\352\230T\303\244zF\252"
+	.ascii	"e\244\372%\3251R\355\222jQ\252[R\035J\265\224jP\325\013\252\025"
+	.ascii	"T\177\300M\213(\033\250\346T\361\0033\247$\224\2157\375N\277"
+	.ascii	"\357k\337\276\020\177\310\211\370\345$D\240H6w)\262n`\020\233"
+	.ascii	"\204\304\334\321\315\216\306\217\202x >\223_\017O\356Df/\025"
+	.ascii	"\263\342\2766\304\322\335\310Y\327\306l\216O\247\324\304\343"
+	.ascii	"\227jgR\301\265_j\255\270\022k\211\307\004 \256\344@k]T\226t"
+	.ascii	"\204+7g\025K\027#\312\343}U=Gb\241*\334\373\254p\026\\\2712\214"
+	.ascii	"N\211\310\346p(\217\f&\330\266\037\031!\3169%\030\321\360\203"
+	.ascii	"\300D\370*\372u\201\362\237\202<\032H\252\341\373)\274\304Y\305"
+	.ascii	"\332\275\030\322\237uov\367\272\034\340\335$\374\352^\247D\244"
+	.ascii	"?\317\366{\"\227G\343\026\024Y\001@$D\370\324$P\b\022?<\267\360"
+	.ascii	"\247\026\324\001,!\024\264\241w\034\334x\200B\324<\320|l==\266"
+	.ascii	"\035\232O\255C\017m\347\366Cs \3006\021<7\032\220\315v\243\275"
+	.ascii	"z\363\213\364\343b\022\027SCK$W\206]W\253\263{\245\013>\333]"
+	.ascii	"\203\317\366Z\202\\\025\251\227\203s\316\t\232\301g\253\263g"
+	.ascii	"\272\2041^\321\305\200%I\237\213\0265W\036m\254h6\2665\262\245"
+	.ascii	"\241\332y\025\031lcSx.\005\326ef\243x\264\231\212m\224Q\026\231"
+	.ascii	"}\355\314\006(\"\345\361RU\037\036V\25014\b\241R\202\031\222"
+	.ascii	"\211\243\005i\326\320\002\221\"\0327\021@)ELM\205Z\317r\351H"
+	.ascii	"\216x\221\203A\376\327\242(\243\210\327\371&\227c4\274\0219\377"
+	.ascii	"\315@\002\210`\345@\036\020\036C E\377lZ\033\317B\347\\\023\302"
+	.ascii	"\323\323c\f\332\207\304\n\336>\303\370\275W(<\002\324\321b\326"
+	.ascii	";\033\277v\346\017{\370\240\350\246\321(\241\017\227iz\345E\034"
+	.ascii	"p5\030\263\2065XX\340\344\002\204\317\340\017HPz\332\330\026"
+	.ascii	"\005\323\205\263\243\2728\316\237W{y\204%\225\212\330\265K\350"
+	.ascii	"\372\322\n0\252\t\240J\210\331\355\305\226\355\305\332\341\304"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_biquadFilterXyzApplyDF1.30.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`Y\005=\036"
+	.string	"\2066\273I\260\326M:4g\017\341\303\343\007\233\212MA\353\254\\\330\370H\374\373W\020E\355\323\276!\271BU\312\350m\037e\351j\315m\022\204\007}\363\003\377\007\351.\243\257U\f\313v\321\002VN:b\327\337hH#\233\310\235R\242"
+	.string	"\222"
+	.string	"\256"
+	.string	"\022H*\"\322(\211\306\367b\305\003\362:|)\313N\375\250\357(:\320B\322(\211\234\262ZjRkEpj\006\344\351"
+	.string	"\3612\333\363\347\253\232Z=\212\"\261\340\323\276\215\337(:\216\020\207\251\225\251\313G\255\277\004>@\236\372w\333xJ^f<u\221\315\344?\247\372%%F"
+	.string	"\245\324Zo\353\302{\361w\213\263\350T\334Y\344\307\"\3448\201,0$%\243S\261Vk\235)\211\020\025L\237\022o\2123P|/\365\003\303)$%\024\237\261\b\265VO$\245\023\367x\3339\333\023l\232\"\236[\263\273\357\321\020o\255\361;\367=(\336\f\263m\277\267:M\032\226#\256\354f\330n\255\325h\267\311\376\031\315\327e\262qNu\337\034\307\017\340U\267\315\177\177\315\201\267\215N\317\320i\031:\035C\247a\350t\215N\323\350\364\214N\277\320i\027:-\243\323-t\232\205N\223t:F\247G:M\351\2648\247W\234\236\342\364\t\320d\025\261\020V\253\211\260*u\213\006c\234\352\257\372\201_\373\366\247|\036\267\262\254\212h\300Q\255\372|*d\004\273S\333\227\205\331\177\365d\320v\266\265\025\201=(\336\021\227:=7\222C[\235\247\340\256\210\313"
+	.ascii	">\337\242\231m,E\217).\313\262/{\363%\333\226uY\001@\".\177E"
+	.ascii	"\303\207T\221\355\257<\005wZ.\357\305\365\363,$-{/r\351\262\354"
+	.ascii	"h\245\327\"\266\343\222k#\354A\361\204\270<\326\206c]\030\333"
+	.ascii	"c=\005wB\227\007r\001\035\310\016\327\270\007*\261Yq\351R+=("
+	.ascii	"\236]\341A\2279\016l\334\177x k\255\r|P\0202\020b\224\211\350"
+	.ascii	"Q#\350_\r\271,\340\004\303\367\325xj\263\363\313\267b7\303\002"
+	.ascii	"\272\017\035\202~\250\216\303\007!\237\334(\3643\304#\202 \032"
+	.ascii	"\332\321=:9\037\035\207\237\f\267 \034\020\020\256\347\026\364"
+	.ascii	"\303\003t\353\311\t\335tn\214\353\340\223\273\351p\270\334M\366"
+	.ascii	"\253\177]\246\034'\203hm\355\226G\267\311,]\213\263\3335\021"
+	.ascii	"\334\266\276\004\267\355\243Du\035M*\027k\255U\334&\3339\267"
+	.ascii	"-\316^\352\224\305p\252\327\2027s\242\302\341\322M\024(@\246"
+	.ascii	",\321\2368\321eM!9\261i\002\326T\326X\332}\271\264qy\321tC0$"
+	.ascii	"'3\013\2637{a\210%\2631;\2635PzP\274.\227\027:a\270\222Rf/L\342"
+	.ascii	"r\207\347H \304\004i\250Q<\346\230S24\263()HZ\003\300\002\021"
+	.ascii	"\"*n\0210\241U\232\310\204\232\2551)\245\"\330ZV\312\223\036"
+	.ascii	"\024\275\200v\211\376\330\222T\251\005\225\f\025\320C=\256\372"
+	.ascii	"\257\305\177\215\355\350\304\240\205b\t2\376\275{\202\300\242"
+	.ascii	"\311\255\"\260\\\352\035\300}\264\320\340\316x\266\036\346\b"
+	.ascii	"\234\220\022\275\037\210\351\314B\341\352\\BC*\007\341\354X."
+	.ascii	"\366=\300\230\272R\245\202\016\233Hj\364\212\212k\024\002\304"
+	.ascii	"vxx\362\316\363\331\300\t\025\001C\246\205\330\265\205Nw\364"
+	.ascii	"\312\216\361\303\311.\035\025D\013\367\263\002)\315\310\207/"
+	.ascii	"\367L\2053\177\022\376*_\214\2139h\275\303\231*%#\221*\357\332"
+	.ascii	"q\003!e\001@\0356\235\036\202\230\254\350=\363s\277\216!\376"
+	.text
+	.section	.gnu.lto_pt1FilterQ15Init.34.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\036\0015\r"
+	.string	"\366\331YB0\255$\035;\306\321 ?\016\206\305D\bE\355fFh`M\246~k\317\301\300\257\034\203\210m\021K|l\347\233\234\321~l\272\342\250\201A\007\223a\202\326\r\224mZ\214\206\024\262\311\336D\312\224\002C"
+	.string	"D"
+	.string	"G"
+	.string	"O\373\035n\262\375\344\343"
+	.ascii	"vK\272\225]\316\302\005\342\237\271\013\200\177\361\001\340\237"
+	.ascii	"7;\346\\"
+	.string	"\205\275\b\022#*3\273{)\205o\317\315\177\312\253\021\t\310\223R\260\273\316\021\211\204[o\233c\033\201}\223S:f\232\3124\314\364;\312?\375\344Ok\300\006\023\fZv#\224R\254\313c\271`\373\276\312I\036\377\340\0051\032v\327\372\263=l\353\357\226\355\344\356a;\212;W\273#`Vv\327\302\007\342\337f\n\033\250\224\236\364\211\245D'\202\301vr\236B\205(D\335\235!\273!\316\244O\235\"2\242,\331\300\355\354!8\342\356&\360A@\350\320\274X\370\200\177/\003\314\214L(K6'J\235`\177\332\335\265\226\330/]\005\031\327< \215\017\006t\347B\363\2004>\030\327F\206aY\347\332\3704\300\256\216\326q]\020p\366\300\243]\240,\323.\213\013=\345\261\205\203KHE\256\364$;x\307\241y\361G'\242Vz\025#+\254\244\324'e`\360\243\250\233\020\005\t\030"
+	.ascii	"2\003\302p\332\302\276\330\300\026\253\25311^\301YL\020@\013"
+	.ascii	"Y\265O\203\251\301\206x\013\257B^`\343r\231\260\207\313\030@"
+	.ascii	"C\214\341^\3000h\"Ma\001\327\362B\230d"
+	.text
+	.section	.gnu.lto_pt1FilterQ15UpdateCutoff.35.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\245\013"
+	.string	"\246VO>0O\224\016+\201s<\021\0064\316\210\356\2718f\020\316\303\20758\273\024`3F\273V\362\2619\305Oc\244l\337m}7\005\005$XD\223{\036&\327\262\210?H\354&[\312\224\002<"
+	.string	"<"
+	.string	"<"
+	.string	"\002vM\033\031\273\337\304\007\254W\376N \276\262> \2762g\237\370Wa\017b\203\304a\305\356bJ\341\334\223\363\217\361\313+\201\236\217\005\273\353\364J\022n\275m\211\355\004\366!\004\327O\377\343\027\177\204i\250i\315tf\372"
+	.string	"\n\204(\321\240\303n\204\024\213\345\2504.\330>\304v~\337\300\375\302(_\273#:2vwb\004\326\253\b|\332\317p\r\334O\237\007\367P\250B}\007\251E\227)?2\325\356<\210\367T#\"\005E\256\251\3078\324 \201\032a\220\\z\215*Pw\212v;I\324K\235\243\024\241L\331_(u\202}\270\273k5\005\231o\026\217\006s\211\256P6\213G\203\271`\033-\313\264\n\266\3018\310\260\312\326\301(\006\254q,\033\346\321\264\r\203|\335\341\252\311\fDpt\0322T;\363\017\231\265\273\n|\017\034-\200\t\013\237\370*\025"
+	.ascii	"2C'\025\030<\334j\343\n\2540\275\004\016\372\312\252=\r\006\302"
+	.ascii	"33TC\234\004K\335\306e\324\277\3362\206y\201\300\340\21245\005"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_pt1FilterQ15ApplyFixed.36.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`8\001\255\r"
+	.string	"\206\032\\A"
+	.string	"\221(\035\371\274\035j\027\rU\244\351H\3322\344\232\254N\357P}A\204W\242K\234\243\260\332T}0\250Q\320v\204\b\376\210"
+	.string	"UU\002\254:G\315\003,2\246y\343\272\266\222\277\311N2\245H"
+	.string	"D"
+	.string	"I"
+	.string	"\336P, \223\005\243%s\003i\202\314X\267\254m\035\302\"H-\271-\303\352\235\210\221Z\261\221\231\332\001{<c\316\003\236\261cp\311X\252M\302N\005\213\227j\225b\314,\310\314\242j5\301\275\333\"h+\322\272%\254\326*6\307\233\r\340\330\315\261\032\207\315\0346\343\260\317a\261c\235\303\376X<\326\035\004f\270` #S\302\353F\302`)8\264%\265\034m\213V)\271"
+	.string	"\t\301B\204\226\314\004\251\002\304\326-\217 \005\357\231\033\210AU\300\376\277\027pAy8\341\253\356\330\235r\231\036\330\204\273Y4\264\360\277cI\271|\316\361\217\005\325\341T\023\227(e\231)R\257\220\234d\033\214\325(\317\230\377\0175@\264L\370j\267\024\374\205\326.\037\243\223\022\220\007{\355\204\210FF\016<$\032(\364\371\204:\032\310\323\340\243uD&Z\310GC%#\"m\024\n\2114\216-}\326\346\036\024Z\300\230~\352\346(8/\254\242\241\271\2779\276d\327\034cR\256\016\327\345e\236\375\343\005\345:e\272+^\032"
+	.ascii	"i\231\"\023\332\376\307U\255\240\020\204\315\f\316C\216\236\226"
+	.ascii	"O\035N\214P\272\020J\314h\340\032_ey\t\256UxLc\325\233\320\\"
+	.ascii	"\303\211\330\342\200,HIH P\226A\023FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_pt1FilterQ15Apply.37.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375` \002E\022"
+	.string	"&cxF\360\356&\035q\317\352~\332O@x\233\276\330\374w\335\217\215\003\314\003\fp\202\273\021x<\276\264\351\031\267\021+>`\301\233\rw\246\336\201g\340\231\204\247(\234W\017T\373\3376`3oH\255\021\262\304J\231R^"
+	.string	"]"
+	.string	"i"
+	.string	"\366g;\3638\376qi\227\304\021\320\356\206X\301\323\276\315o\\\017Y\216\332\215)\001\264\033\2068\201w\316\241g\333\337p\016.\373\207\024b\230\211\023`\310v\216v\027\004\271G<G:\200xN/\334\365t\371\3179\2116D4{iyv\fv\3279{\251p\353m#\260=b'-'\355\356Zc\354\230\356\350\322\250Ls\304\364FLkt\351S\227\316\350\322_\2276\305t\251K{1\335\305t\3144\367\360'eZ\217\363g"
+	.string	"\0010P4\030\332\245p\213\261'\270\0204\376\207\367\244\244x8\217\312u\354\251\330\337\316k+\327\261\356\330h\273\373\255\330\3379\265]\001\004\214b00\365\364\323\001A\261\232\222\232R\027Q\322\373d\260\351\324S\222\217\314\026\265C;\215>1\r\3471\311A\224\214\370@\022T\376\fK<\027\365<O\01344\230\0166(\355\320\313l\257\274\331\224\034\352\327V\254\370\031JA\\\264\305\376\271\013\270\354\276\f\244r\350k\367\020\312QQ\253\201\345\315\016a\2512v()'&*.:%\322\"A\201\240z"
+	.ascii	"\232\260V+V\n4Q9X\201\251V\004P\344\303\254\023\222\026\210\302"
+	.ascii	"b\265\300/|\335V}\316\275\0267\341\213\242\227\302\026\334n)"
+	.ascii	"8U}\254\006\306\351{~@f\005\214\250V\244#JN,>s\241\241Q74\205"
+	.ascii	"b0'\325\3204\222\3316\356\240\230\241'\375\020\212\331vo\023"
+	.ascii	"\361\323\f\r* `\002\231:\335\001i\246\210\241\361\b\201\t\226"
+	.ascii	"\3146yI\343\265d\317\273\262ZrSF\317(`9\220\365\245,\265AHd8"
+	.ascii	"\375k\035FO,7x'\220\3340\215\343@b\305*\236\035\030J\033\246"
+	.ascii	"\003#\fSZ\314\\ \307k\265\200H\222\030A$\334!T\224@\260e6\361"
+	.ascii	"t)\246\313\220\001"
+	.text
+	.section	.gnu.lto_biquadFilterQ30InitLPF.38.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`B\001e\r"
+	.string	"\326\030YD\020o\234\016c\365\242\220*\3305\030\234*Q2\253\360xlF#Y!\22670"
+	.string	"Q\324,"
+	.string	"-\007Q\375\356A\031zo\330\b\324NT\371\272\272\215\n\211`&\333"
+	.string	"\333\347"
+	.string	"\363\002j\337\2106\331;\245B"
+	.string	"E"
+	.string	"D"
+	.string	"\017y\t\360\"\032\027\260\373\221\222\332\0357F\200\275z<\201\353\025\373\200\353\325\240\r\343\343i\217b\225\201\\\331]\215\2028\370\t\372'\177\021;6>-\rv\327S\354\330p\323\333\326\330~`\277$\267>\362\323\213\374\023S\200\303\213\017\311\256\206\225\214UU\024\021\266\357\223\2744\375\204#\240\262W\333dg\257\317lS\224\005+\300b\360"
+	.string	"a0\307\233"
+	.string	"?\342\023_vY\314H\355\356\306\n\260\327\003\326\247\035\240\247\beN\273\273\3007\271\320\371!4\256W\313\212\222\025\225p\256\214M\177t\371\344#\302\020\325\332\332\r5\026\245tR\277$U\230\027\375\362\007\361p\261\036\350\206=rL\372\301\276\265\273k\372a\037\365\\\251\003\341C\342>\017\367e#\356s\200\271\274q>\2564\001\344\321D^\327y\233&\002u:m\373H\032\307\200=\n\334\247\225<\357\323\2621<y\254E\007UH9\266\253\340\216\022\312\234LH\250Hx*\004 e\222b\214\004\177\351\034"
+	.string	"*C\244e\212\314\320`Dm\001\022V80\214\021>"
+	.string	"E\025e\300\004;@Q\210\022r)\267\341f\rf%\b\272\314\006\032\360cA\001\346>\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterQ30Init.39.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`b\001U\r"
+	.string	"\346\027XD"
+	.string	"S\225\016p\261)}@P\374\267\260\375b\2269\3368\036\223\233)\341IZ\213\377\316\006\036}\374\321G\326"
+	.string	"E2\203\204\0173s\346\256\2224$ \205\242!\202\361\235o\300O:"
+	.string	"K\032\331{\357\224\002@"
+	.string	"H"
+	.string	"A"
+	.string	"\337AP\037\260\353\262q\262\033n\274@;u\370\002\331\251v\002\331\251?[\307\303\327\036\006\302\303\210\312\356n\262\304\277\307\317\277\213_@V\352\321\362`w\035A\226\210[\336\266\002\333\035\3737\002\237\017\371\345A\376\030\300"
+	.string	"\n\034\241\035\273!V~,\n\215q\302\3661\266g\311\206\036\022H\034\233\231\375\260z\021A\212\234ff;\264^\016b\370\026\337C\034\363e\227\206\217\223\335\335\230\201v\232`>\332_q\026\001 \017\315\355\013\207q\332\3566\360M8t\b^&P\331\251e\206\211J\212*\256\330\0223I\345\224RFi\2274\304\203\326\264j\354\b\231\262\303T\224$\354\317\335]K\227\375\222?;\311O/\362\225t\352Lx5y(\204J\325\003U\017\223\241z\020"
+	.ascii	"d\376p\274j\302 \002m\243\216\343\272\3176\022y\270\355\343\225"
+	.ascii	"6\316\001w\244\352m\246\256\3636L\270\237+]\256\220\002E%W\365"
+	.ascii	"2,\034\006LE\212\3501\0019\342H  \340\202\2411z\270r\320\207"
+	.ascii	"Ha\212x\274\tECl\327 |\224:\200\266#\0316\330\234D\213\306S\261"
+	.ascii	"\313\377\332\322\376\330;\343U\355\025\303\205<\017\357\226\001"
+	.ascii	"%\316\2102n\307\340\212\264\230\002{y\321V2"
+	.text
+	.section	.gnu.lto_biquadFilterQ30Update.40.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`6\bM$"
+	.string	"V?\336J\200VR:a=N\235q\370\253\252:\3527\267.\356vb\342\005F\207\020s\003\222\323\035]\336i@\027#\213\377'4\231\205\276\001\210\250\0269F,\327SiH\315\004\250Q\322\317\021\021\201rl\377\333\377\345\267\204l\231d\315"
+	.string	"\274"
+	.string	"\313"
+	.ascii	"\355\222\006\016\004\355\274\221\344\253\030\312\272\266e\262"
+	.ascii	"\205\253m\333\0356\300~\305Q"
+	.string	"\337\314\237z\221\344\251H\\\330\266\3155\256\266u\356\260\016\373\225\235\177\301}e\357\202\373\312If\266;\245\332Gy:\201\004K\333\266\303[\343\311\013\203\300\237\257\307\333\351\330\034nUo'\371\271\236\347\233IL\251\226\305<\272\320\306\203R@\030i6\372\367t\337\213\236\213\262\247\3469}\207\266\324Bw\264%\026aN\315\ng\244hz\356\304q&\244\317\361\261\324\324k\004\035XA\222d1W\\\3751\227*N\333\266<f\211\276\252\316\223\230\212\037S\251\276\234\321\200r\257\267\022\263Dw\256\247m[\356$f\2123\2003\177\0013\207`\316\025\005M\367\210\331\251\354\013\305|\265\275Mf\2669\247\233q\272\371\206m\266\351\346\232n\246a\233g\272Y\246\233c\330f\230n~\351f\027\266Y\330\315\300S\375\276n\356\035\353\337\375\352\327\375\310\317\276\352\317u\363\332\315j7\337n\356n\276"
+	.string	"\234X\223\016\030W\315\331\242\230ji\315\326%<\256\3654\264\263\2512\2621!aM\300~H\277\242:@z@\357\305\314c\344\227\360\316\016!OS\\\357b.\372\026\257Q\321\"f$3\357\353\372'\363\236u%\311k\201`\217\226\036<\245\332\332v\251\300W\266\300~}\214"
+	.string	"*\226\b-\016\256\030\252\006[%\345V\203{d\204\032\f\367>\354\336\230{0\342\315bs\231}>\345KYsm\356\243l\3566\331\311\013\334\205b\037&\365\346\022\335\256\327u1\300\310\232\241\357i\342\\\245\265\367\275\364j\357Ks\037\315\320w\215\372\032B\225s\2315\034\312\017\377\311\006 \337Z\016\022\270\257\177\236\200\211\250\225Z\026\025\234\2333"
+	.ascii	"\t\031RO\327\013u\251\2676.\3656\247\323\251Y/k\230\210X\221"
+	.ascii	"-\373\255\273\254\234\311\270\027Jm\336\353\335\304\324\303)"
+	.ascii	"-Ml\331o\314\320s\202e\333\"\r\370\275\271\357:\201\250\232R"
+	.ascii	"\355\312\207\262\247\314\\\374\223\241l\333\266\007~\327\250"
+	.ascii	"h\026*\244\236r\257wWw\331\233\273\337\372s\210Mb\346@\324O\342"
+	.ascii	"\0027\246\332,\304\203\0242\372!\222A\006\005\025\215@\270\342"
+	.ascii	"\207\021\025$\274h\3643A\bY<\006\025\217"
+	.string	"\274\242\342\221\301\016\307@<\307\242Q\207\241\240\241\007#\021\221\021h\350a\350\207h\btD\016yf\330\370\241x\034\032\031\215\307!\317\211t\265\275M\366a\n\276\\\242\0330\215K\n\212\337\331\356r\2250L1C\272J\006\241\266\355\f\005\327\372\333\252z\312\302\313\f\341oV.Wx\177&\f\002}\300Kt\353\225\361\316\366\336z\237\266\336\227\3733\tk\026\230\313L\341W\244\312\336\205\271\037\373\371z\273\230Kt\323\205\261g\273\214z_\246^\340\375\230\005\365\256Q\322!3\227\371\302\253X\311\334\231{0\336N\227\243\271D7\334\245\374\322\365l\257\t\200\244\250q\\\244\2201C\"\242\240 )H!\035@\003\221\241\352\021\3004\311\024#A\311\210\244\240\245\003\221\371\211u\020\263\221\262\324}\232\344'\316`\315\250x\257\312\026\t\2459\261X\200G#A\036\n\016\305\353\007\374\366tb\261"
+	.string	"\217F\202<X\214S\341\222V\367\374\023?\006\266\361t\025\234QL\322vv}\277 "
+	.string	"\372\005`\251\013m\3155\310\\\226,\300E\026\366\032\264\267\333\302d\371\270\021\270\320\311\227Q\3412\302\033X\230\\\312\200U\016\257\300\2762\350%\353\304\312\246\200\255_\201\242H\025"
+	.string	"\264VU\264\2041\353.P\236\350\323o\276\335>\351\204Z\322\t\265\244[\222\372\317b\365fe(\223M\306\207\340\252y\224I/\f\335\352\020\273N2\344)\372\3762\270\217Q d\215,-\216*%\225\340u\230\257\356\244\035"
+	.ascii	"\227\371\352N\332\005\220?\213\214\341\257\352\351\253#\275\335"
+	.ascii	"\355e\207\022n\362J\035\217z1\373\003"
+	.text
+	.section	.gnu.lto_biquadFilterQ30UpdateLPF.41.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"]\n"
+	.string	"\246\323G> \345*\035"
+	.string	"\234G\200q\t\021\027 \263\002A-\201\021\300\363\032\230\024\321\320\201|zE\r\207\005CL\223A\311\234 \b(\206\314\361"
+	.string	"y\357E\325\355(`\242\307\372\237\220\275wJ\0013"
+	.string	"8"
+	.string	"4"
+	.string	"\233s\016\177\320\235\333\334\240;g\320\006\3600e?\303\362A\013\260\273T\242\034|\004\375\323>\300j\245\0365\020\273\353\310j\215\334\362\266=\266%\354#\004+R\200\300\336\270\227\227\355sl\313\031\307\354\254\207\211\312C\f\357\002^\346\332\354l\310\n\304\266\273\037;l\316-\314G\373\260\267\200\217u\274`\327%c\333\r?f\b\247\316\265\257\250`\267\365\334Uy\246\2242J[c#\236\345\206W\311\222\310\224\035\246\242<\261?ww-]\366g\377\274\354\227\217\375\261K\020\020c\001\263\001\036*4Qq\362\352\310\253\234\f\257F\020t\026\201\252\207\272 \215\250\351+\225>\0215\221B%*\252'\nR\360\207\341U\212\372\276J9\341~^\272L1\340\246\222+k\242\037\020"
+	.ascii	"*C\244e\212\314\310C\305\200\2136U\327\215k@\200\031\032\250"
+	.ascii	"\3020L\t!\0021\300\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_biquadFilterQ30ApplyDF1Fixed.42.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\363\003e\030"
+	.string	"\266\255\233F\300\326Mc5\013v!\3672\002\361w\304\313xG\007\002\025g,\371R$\001\005\267)f\362\241\321F**\004\335\330<6\331\330v\273\202 H\246\255\376\255Rc\0364\322\017+\214@\323D\333M\312\235dJ\001\206"
+	.string	"y"
+	.string	"\206"
+	.ascii	"L\266\223a;T7\371\251\256\266N\031\274\031\0026"
+	.string	";\350\240Z,\370\2304|D\037>\250\035\216#s\316\002\216U\360A\327\260y\260\331\301\204\210\2509\247\201\"\200\260\365\222i\f9\267\301-s\"5\211\2323g\240\004>\307\346\276\266\265\f\317\030\252\315\313\2518\222:\033EMK\346\234\262\034\307HG\317/\322\361)l3\264\325~\262\007cWetDd\330b0\347,4:\002\341\336m\005\264m\320z3\276\013WDi\351\006\263\332\034\021\374\211\326\336\234s\366H\255\231\334\035;\271:\256a\3478g\007\220\2608\022\366F\302\306$\254M\204\255\221\2604\021vF\302\312H\330\030\t\013\023a_$\254K\204m\221\2600\t\313\"aW\"\354K\302\252DX\227\204M\221\260(\022\366\213\260-\t+#l\224\260\236\204\275\204\205\021\326\003b1\204\374\350\230\323C\226\223I\025w\260p\326\341Z\300\334\3451\377\023\234\213\227\303\3343\367x\371"
+	.string	"\253\226\273\334S=\346\321\362\026\212\"LX\236r\330cM+W9\313q\222\274\2762\301;^\267\222$\327U\036\223\362q\224\353\276\262B\271\367\224\313\035\256\304wy\224\327L\265\376\335\024\234\243uKY-\305\313\313'@\306\021\357\247\244\245\037\336\273q.8\300\254\346\374\217\273\",\037\376\272\"\254\322\fe\373\346\234\t\352\033\f,|+\034\353\r\3221\263\031\317\205~0\\\350\251I!\f\025\202|\242\354\354@\255G\350\307G\202,\210\006\004D\233\311\202|x\200d\263\332\005\331\201Xi\025zj2!\032\255&s\345\246\275#\355|e\204\022\325\355\034\272s\";\245\020\267!;\035FHnT\270*&$nA^F\034\\)1B\202\363\235\303\251\","
+	.string	"\256\224\2749\316[M8,8!H\235\337\334/\256\252p%b\227\271\316\037\\\371\2609\315c\247\221\252\271M\004\003\251\271uI3\247yL\302\343\0373_\020s\330e\036E\250a\030\205!\350\004&4\2434I!\255\001\240\"!;\356\021P9D)\030\005\345:\034\351+\351\247\021\t\361\355\304\262f\361\274\246"
+	.string	"y\002\013Eg\266!H\253#\255\206`\333\235\265\021\223,:\374\207\375r\332\227\364\234B>\021Hs4\027\346\207 \317#\340\022\2270\030+\370\006\205%\207.\342\300?\362\032\004\344\037^\201\352\021\302z\355\2676:"
+	.ascii	"?(\243\311\344\370\016,\3677[\323\230\177-\037qd\211\241\311"
+	.ascii	"\306\300r\207\251\025\222\241\002BB0R\252i\246\177"
+	.text
+	.section	.gnu.lto_biquadFilterQ30ApplyFixed.43.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`{\003\305\026"
+	.string	"\026\253\222H\300\360*\035\344\270\211\216\271\334P\271n0(\316\277\260y\241\371<7\347/\243\331\333\005\323qy\343\002\031\376\330}\016\346\316?\240\377\337U\024EQ\024\235\277\372\3353\354\252R\276\357\273\271\317\227my\223O6IR\246\200"
+	.string	"n"
+	.string	"\201"
+	.ascii	"K9\246\ni\204A\203T\355\031+\320'\333A\016F\032\b\343P\022\214"
+	.ascii	"\031s\316\001*m`\\\005\332\205\253\371`\002N\321\234\023\305"
+	.ascii	"\004vm\365)\207\031\375\311(k\316\035\031Es\376P,`T\351\337h"
+	.ascii	"\333\272A\177f\274\013\177\026rD\"\027=\340\2159\247\r\200\272"
+	.ascii	"D\225\241\266D\225\257\240;\335\235U\201\032j\210!\343&\207F"
+	.ascii	"\327\204`\316\351\275\311\211\240\276\332>\261}\300\016Q\001"
+	.ascii	">\276\232]\262\1774{\n\266\206s\316\351\357\330\032\2446Q \325"
+	.ascii	"\022\375\251\006\b\327$r]\223k\232\\\317\344Z&\327\261p\r\223"
+	.ascii	"\353\227\\\217\204k\221p\355\n\327!\341\272%\327 r\315\222\353"
+	.ascii	"\225\\\177\310\265J\256S\341\032%\327'\271\366\b\327\035\341"
+	.ascii	"z\f\327&\271\026\345Z\312u(\327\227\353\r\327z\"C\261\242E\304"
+	.ascii	"\2348\0012 O\347\343\247\257n\"\342eP=\365\017\223\253\016S\352"
+	.ascii	"\005QO\335\204\304@\213PW\"\036\217\377\247\213D\274\236\216"
+	.ascii	"{\374I\275`\r\213\206\350\370I\250\006\216\361\246\233|s\nb\274"
+	.ascii	"\246x\341\023o\372Y\324\324G\242\274\370\030\220\027\334i\024"
+	.ascii	"bx\371\027\022O\347W^\217\315.\271\344\277\t\251\027\324\357"
+	.ascii	"C\245^\320\r\324\303n\234s\026\260v\330\375\274\214\027TZeD\225"
+	.ascii	"\372T\213\032\0010+1/7\235\b\023\343\322\202\223\242URt7\230"
+	.ascii	"\025\234\002[K\216\205%\247bk\301%`\261\251\350^l)2\347\\n:\033"
+	.ascii	"L.\247\263\235~S-\341\204\212\232\333\230\344&j'\241\2756;M\366"
+	.ascii	"\327g\261\253.;L\t\366\330MK\300F\376\277D>\262@I\210\374$d\303"
+	.ascii	"\307\347\372\210\224\213\005\336\320\by\353\256\323X\360tlpj"
+	.ascii	"\024r\265\301\343\003y\353{\324\013\326\f)\353 \237%\361\202"
+	.ascii	"6\037tu\326\003> \200\");zi\246\210\241\251\021b\211\353G\234"
+	.ascii	"\302\006\247e\203\301\230\033\363\301\242\027T8\360\030\031#"
+	.ascii	"\275j\2752\026\r\3305\262\311\0342\212te\234\360\266\271\314"
+	.ascii	"\024\363\327\216\001T(\361\221\256\027\321\"\307\",\315\316s"
+	.ascii	"\371*\276\0030\325\301\005\005\212\363k\324\321B\025\303\b\260"
+	.ascii	"k\364\203\312c\205@\374\270\341\306\346Pc\270\0062,nk\020\217"
+	.ascii	",\021s\020\tc\3452\261\214\206\220\234K\020s\3325\242\024\323"
+	.ascii	"\205\311"
+	.text
+	.section	.gnu.lto_biquadFilterQ30ApplyDF1.44.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\n\005\255\035"
+	.string	"\006\367\273H\260TN:\373\037\026UR\201A2\232\307\356X\315m,\325\245\255\177\361Rc\376<\204V%\301PU\331Z\331r\345r\373\370?\177 \337\361\206;\245?\343\326\337;\216y\213C\261\274\305\241\026\336\020\221F\244I\231R\243"
+	.string	"\223"
+	.string	"\253"
+	.string	"~\327\207\276\371\350\365\350\361x~\217\373\360\215w.\247\332D\0213\243\204\\1\020\360\316\243\003\tE\202\344\"\373Q6\347\fp\321\007\264\276\345\341:\274[g3\346\2347\017\366\355\342\332=\373f[\3659<\254\305\314\020?\020@\346\234\003\\\340j\037\3538z\017~\270\314\234UO\200\314\031\034`"
+	.ascii	"\344E\007I\333~\215\333\350\331\303Z\320\305\213Q\204\025)-+"
+	.ascii	"s\316\034\320m\306\213\265\323\214\027\267\305{\327\236\377\254"
+	.ascii	"\327f@\001\233*\001u\265)\230sZ\247J\230\270\367\266\215l/\260"
+	.ascii	"\305\023\001\267\t\313R\262u\365\3234;\370\323]a\2776\347\234"
+	.ascii	"\336*\233T\037\225j#U\027]x\023\225\352\241R-\364\256;\250T\003"
+	.ascii	"\225\352\037R\355S\252{H5O\251\306\225\352\235R\255C\252sJ5\016"
+	.ascii	"\251\276)\3256\245\272\246T\323\220\352\231R-C\252cJ5L\251~)"
+	.ascii	"\325.\244\272\245T\337H5K\251.K5Y\252m\244zT\265\370\340_S\365"
+	.ascii	">\307\257\002pT\220\354\206s\216H\2732\217\210^0\336\365\013"
+	.ascii	"\375 \367\332\260\301\276\375\27009\253\263\207p%9{t\2638\373"
+	.ascii	"0\tGr\2636\026L\314j\026fm\026\247E\2632[\263=Sf\226f\302\215"
+	.ascii	"\314\354\253X\305\254\314\342\276(<,f?\346\344e\313\205\331\221"
+	.ascii	"\fH\345\262\267}Y\2350\340\325o]\366\025^\244e\377\345\004\213"
+	.ascii	"eo;\236Y8\021\226\375\016+,rm[\356\201GK\256H6\256mW(\205v\241"
+	.ascii	"\221\016\246#\347\234\006|!\034\222\374\027\037\306\213\343~"
+	.ascii	"x\035\"\303\005\325\r,\243=\332K\241\3714\315-Z\264\376\226\022"
+	.ascii	"\206\361SF\013\024\265P\366\360\026\212"
+	.string	"\232\3237\244[\264\337\n:\035\322>e\3409%5\215O<\rLJ\342h\035\201\246\244\247\fJ\027rL\273\245\245\235.\307\244\204\264\224\32359\345\b\340\274\323\220\324\224{\332\355\232r\267\240\357\265\255\332}\326\311(FT\230\225\371\366\227 --\211\270+\356\275^\264b\311Ol\253\214h\243\220\321@\341\203\322\200l8%\345\250\302\311D\240\230Y\n\337\023\235K\223\006cU\246\244\f-\321j\230\024\232\357\376\032\205vhmZ@4\235\f\306\240\025\332\313\030\023\003R\001-n\2036\302\030\330\317\366,\320\346|\371\354\217\203\213\371\354\205V<\333\263\342\224\007g\302\263\bv\366B`\f\235\305\331\235\3353\340UZ\250a$\243)\347\004%#$\005IA\322\032\240\002\221\251\2639\021p\311#R\201$\231\323\001\251U!\377\336\324fI\242[J\251R\376T\322\252\216%\221\325\274;.\255"
+	.ascii	"\205+y\273\215]di\246b\2149}\t\375\227\203\213I\351)\231'\200"
+	.ascii	":\241ai\275\314)Y\317%\3238[\301\260\315Z\354l\216t\030\360\321"
+	.ascii	"\254\304\232\304tF\371Z\254-{=f\273>\346\221\275UE\2700OE\023"
+	.ascii	"\277?\236\340S\"\321\330\370<k\270\234\006m\365\001:\374\351"
+	.ascii	"o\237\364\001\212Cd\355\330\022\221kVt\376i\007V\221F\003\231"
+	.ascii	"\336\256$\326\311\300\340\023\3076U\034\025\024'\361\004\253"
+	.ascii	"&\257\377\001"
+	.text
+	.section	.gnu.lto_biquadFilterQ30Apply.45.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\036\001M\r"
+	.string	"\026\032ZA"
+	.string	"\2216\035\344\f\337\330\245\206+\250\021\002\3019Qc\204\330|_#\357\236K_N|\204\226\361\377\345\003\004\333e\245\333\325\325\005"
+	.string	""
+	.string	""
+	.string	"Tj\02535\337<)\351\315%GFM\310\336R\246\024G"
+	.string	"D"
+	.string	"E"
+	.string	"\025\036`7\024\203e\227\363p\002\352\321\034e\333\037q\022\233=\202\\\007\017\022\206\033%*.\273{u\234Cz\204\027 =*\207o\317\315\277\350P\204\214\017d\322yN\rv\327\t2\331p\353m#\260\275\300~\210\347\376\230ix\224_c\372\026\001\r,2\032\273\031>\033\273\"\242\370\340\237\370\212\310SL\211\330\226\312\273\221\247X\273\317\032\261\255\307\2647\333\262\235y\024\217\\\355\246xa\331]\017+x\332/q\023\333\271y\320\365\242\307\026\317\305\263\240\035W\212\321\227\274x\362s\225\224\372]&A:\250\322\016\022\355\330\243\273"
+	.string	"\311\256\307\200*\245\357\316\241B\344\242\003\361\311\317\346>\251'\366\341j\310\216i\214\224\2562Mez\n\034\n!\033,J\316|h \234\b\330\203k\223i4Y\346\332`\0164WF\233p}\fp\026\002\242]\234,\323.\213\363\034\256\206l\033R3Z\274\032\236G?\f\276\257\305\244P\177\341:\351W~\340\344\305\007F\347\001H\214F\2651\b\001\030"
+	.ascii	"i\231\"\023O\227bO\030\034\030\233\264\330\212\031\213\342\244"
+	.ascii	"\002p\027\206\252\r\027F{X\333\024c\357\247}B)'!F\3200<\342\342"
+	.ascii	"\"\204JH P\226A\023OJ\212\351\232d"
+	.text
+	.section	.gnu.lto_laggedMovingAverageQ16Init.46.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\032\001-\f"
+	.string	"\026\226QA"
+	.string	"Q5\035\360\006\372\244^\b\332\003\224S\346\2379@,\023\030\345\206b\205\214\272\r\220>\001\036_\345D\213\2408;2\200\004\013\377]U\225\223\376\003v\230\022\210\254\376>\221i7\332d\357\224\002:"
+	.string	"?"
+	.string	"A"
+	.string	"\213\242\241b\227L\340\003\334\253\311\017\320^\271\013\320^=\3320Nz\330\303H\243\227\307\356v\264\303\307\317\321\377\353\033$\323\347sk\260\273\236$S\206\233\336\266\001\333\024\373\251(\373\256\177{\353\317\316\372'\344\034%\017\031\027Z\354b\370\250\261.*\213\017\266\037\261\235\271D\002\222\025\2150\301\200\222\0271\276\325\231\222\025\205N\n\270W\311\374\264\277z\210\361,\317\003l\035\033\265'\034&j(c'\004\267\277\247"
+	.string	"\353\214R\225Q\333\302Ol#\022\261\323;\232\235y\211\016\267\273\013\374\222\263\001\360\"\345\321^)+\020\033V\035\240\371a\223\237I9\330\317vwM\003\227\r\004j\341x\016D0\002\306\023!\232+\223\320\242\241\340]:\f\370}`\245\303x\017\276\256\022f\272I\001\203\025,a\247\001\301\260\213\220\373l)\312\225\243\024\213\001\242!\373\236fK\370\n\257D\241\n\031"
+	.string	"i\231\"\023\357\367\242\301\005\027P\006,\007D"
+	.string	"\313\217&\241\302e\222\242:Ta\272\305\r2a\225k\300?\f\r\n\303\260$\204"
+	.ascii	"\302gj\024\\\226\246F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_laggedMovingAverageQ16UpdateFixed.47.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\216\004%\032"
+	.string	"\346m\237H\300\226M:\024"
+	.string	"H!T\212o\210\360\027\246\306Z\307\333\204B\304\004\032\204\206\016;\231\n\224\t\227\266Fc\211\244G\225R\016\016=X\026A\020\373\215\342\272\245\322\021\327>\2028,\264\217\326\243\266m\204l\262\223\224)\215"
+	.string	"}"
+	.string	"\215"
+	.string	"$T8\3159\017\030\301\256\255JZ#Hw\023\002\274&\321\222\005\2479w\007l"
+	.ascii	"T\317;\320\266u\206\322\br\030w'r\262\351C\021\023\325\234S\026"
+	.ascii	"\2431\251^\324\027\251\336Mh\250+\360\223^\374\206\326\317&F"
+	.ascii	"\201\322\204\313\t\351J\006\374lFd\350\240\237\021\f\034\212"
+	.ascii	"VnP/\032\320\005\321\300\222\273\305X\021\022K*l\324\240g\311"
+	.ascii	"\021\305\2309\247.\351\032\345l\273\237\315\234\323\213\313e"
+	.ascii	"P\263\324v\b\333\013\354\230\"z\243\006\3169\027X\231\032\320"
+	.ascii	"@\024\352Y'H\365\364\003hH\351\222\224\206\266\312\336\t\355"
+	.ascii	"\217l\215\363%h\342z&\256e\324\206*\214\356T\005\304uL\256a_"
+	.ascii	"\277\310\265\213\\\267\304\365+\256]\336\232\345[\257|k\025\271"
+	.ascii	"nykV\\\257\342\032\364\326\337\267\226\337\332\223\353\350\255"
+	.ascii	"\037\327\373\265\022\320)\021TLjH\346\274P\025eBy=V\330\016\262"
+	.ascii	"[\2536\302\370\232D\0013\030\023\256\311\220\316d\353-O\360\204"
+	.ascii	"\310\013\310\212\353\257\257\224\233\356G\350r\242\004s\253\323"
+	.ascii	"M\b;Q\203\004b\345\254\263(\017U\371\312\227\251u\225\247\326"
+	.ascii	"\001D\371`\375/|\304\210\253\367\b]I\024\327\004\374~\365\013"
+	.ascii	"\271\261\260\251SOh\005\272\032y\220\377\277\353\315\205\032"
+	.ascii	"\210\364.\357\355\270\265\260m\225\343\275k\321\224\034\3351"
+	.ascii	"\213W\240\243:\200\376\002H\206\2409\302\375\247\232b\354\234"
+	.ascii	"S\350\256I\375\315\222\022\242}b{'?@=<:\2364N\215O\316O\004\235"
+	.ascii	"\0072\036\332\316\016\rG\306\243\343`G\206\343#AV\003cZO\216"
+	.ascii	"\217\354\207F\363\221\265vS\343|\t/(\363K\231\262\360\315<v#"
+	.ascii	"\3334\217\031\272\315\261\277Ns\nP\232n2l[\025W\260\313\374\223"
+	.ascii	"\242d\006\273\342\210Z\360G3\372)\016}\371\247$\251\275\234A"
+	.ascii	"\022\224.I\376Hk\362H\355+z\242\222\032\232I#\256\325\213'\030"
+	.ascii	"R\252\002\247\203\362~d\227\267\374f)\nG\241f.\227!)\265|H[\250"
+	.ascii	"1<I\035SB$e\224$\205\016\240\"\221\262\343\001\021`%E\350h\024"
+	.ascii	"\024=\351\276\363\215\372\233\317\021\005(\277\250\360\273\003"
+	.ascii	"j9\221\274yf\304\205!\030\313\024\233g\023DK\030mP\n\277\264"
+	.ascii	"\236\325\313\350\220t\307.:\362\302\020#\002%\363R\204\003\316"
+	.ascii	"U\230 :\217\375\220\243\f\001]\203\334n\031\232\2012\032r\364"
+	.ascii	"\316\352#~\212\272\320\357Er\3252\301\352;\033\306\2738)\250"
+	.ascii	"\254\211\306N\366Q\314\"\033!%wG\022f!\374\\T\022\244\252\226"
+	.ascii	"\027\210\006\n\036\262\344\223\021o\343\033\333\214n\346\n$v"
+	.ascii	"\0224~\354\020W8nMW\343\267\360\234\177\254>t{\n\035\262\321"
+	.ascii	"\357\017"
+	.text
+	.section	.gnu.lto_laggedMovingAverageQ16Update.48.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\036\001u\r"
+	.string	"V\332[C \217\223\016\200s\276mS\005\267/\001\341\030\031c\0044\026T\004\252\340\303\244\020h\020\006c:\3106\354\t\200\372\326'\327q\242\b\030"
+	.string	"\230\006\0318\343\261\252\025pal\004\236l#\204\354-eJ\001G"
+	.string	"G"
+	.string	"F"
+	.ascii	"\235\205\007\330%}-\273\035\207\023\\\217\356.\333\276\210\243"
+	.ascii	"l\266\tv\035<T$(#+.\273\233m\\S=\302"
+	.string	"\013\250\036\225\303\267\347\346\277tx\"#5*\t=\255\006\273\353\034\225h\270\365\266\021\330^`?D\177\3144|\312\2571}\214\300\213\212\n/vI\276\031{\212'>\370&\316\002r\025_ 6\266r/\344*\326\022)Nv\027\013\261\261\307\2647\033\263\235\371\024\233 \200\315\300mh\331]\016+x\332\037q\022\333\003\037]_zL\235\\P\0274d\214f\364#/\242\374\214\311K}O\223P}\204\321\r\021\r\331\246\273\200\310\256\310\200\352\245\367\256AQb\341\201\340\362\263;.\325\304>\\%\3311\235\251\322\230L_\231\266\336\005 \n\037\036N\254\274\351\370x\200\"p\036d\036\255\323\3216\231\207\343\240\223m>\023\262\216\001\326><>\031H\323>\031\326\211\016WI\266\r/\030\251S\f\224H9\006\337\267\302R\250\307p\265\364,?`\322\202s\341\24142\243Qm\016\204\f\027"
+	.ascii	"i\231\"\023O\227bO\030\034\030\233\264\330\212\031\213\342\244"
+	.ascii	"\002p\027\206\252\r\027F{X\333\024c\357\247}B)'!F\320H\270\b"
+	.ascii	"\241\022\022\b\224e\320\304\223\222b\272&\031"
+	.text
+	.section	.gnu.lto_filterChainInit.49.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\275\007"
+	.string	"\202\01775`o\032\003T\271F0n"
+	.string	"(\036?\235\275\213\320\302\267\013\2252\344\332\020\262\216\2271\271\207\233\230\305\344\252"
+	.string	""
+	.string	"E\204\256>u\227q\261\3507\332rK\231R\035m\363\220\311f\232\216\343\201\320\034f\207\3336.\233\035m\263\315\254\223\230\032\203r\021\234nz8\256\233\231\357\266\036K\r\034)Q\274h\375\271\332\t\227|\260\377\0135\tE\205\200\351\303\262\006]\226\022\206E\365\"\202\253\366\013\301\330\321\332\372\377\306R\353\223\r\255\203\215\025\213\226?c\025\363\224T\001\311\2645l\035b\021\317'\220\007\376\322I\312\377)4\001\263\354\347\202\313\0223\301eY\257u\361g\272QL0P\252\3773z\3303\364j\2178`D\n\031\0020\374/\034\2214\334\350\266\bmg[T\t"
+	.ascii	"2C/\025887d,+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_filterChainAddPt1.50.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\337\003\r\031"
+	.string	"\006m\234F\300\330*\035\242G\314Z,\\\216\340Z\001\3709\363\371\323)\024\024\230`\023\"\212\b\233T~mx\232\002\340-\355\344i\340\016%l\344\034\3012\005\001\025\304a@\3226z\374\204EX$'_\375O6\331;\245\206"
+	.string	"z"
+	.string	"\223"
+	.string	"Fv\027\307\021J\257\013D\317\371]\213\023\330\305\t\215\354\2268nPz}\217\347`\216!(\177b"
+	.string	""
+	.ascii	"jR\013*\332-Q.o`|-\275\300\370J}"
+	.string	"L/\226w\235\261\223\306*\322\031\363o.N\342\375\246GD\343\2438`w\003\334^\210\021h\263\352\220q\361C>\221\fgC\277\233\214SqB\030\033>\002\334f\242i\347\312\217\363>a\334js\2220\354\256\247\355\026\343.\335v\r\333\024l\221\006AR\267\223\315#\273\234M\332c\3775\310\b\3410\305\3316\377\335\247\003\371M\337\375%OWO\213\3434\255\323\263N\237\300\005\034\311\003\344\204\016\225\273sd\264U\352\021\240\377~\373\276\220\377\374!6\365`\017\272\317:\017\342\2723\"s\273\373 \277g\223u.d%\013h\345\336,\350\302\344\212v\327\301\253%\350\330\246\327\3330\3334\355\227\377\001;\020\003]\263\333\344(\034\256\245\203\202,X\256XYi\330\021\221\271*\261\361UG\032\221\271\"\031\335]\027\"\355\361\224\330\f\332l\017\227\362\201\301\017\210G\tA\352\r\241<\021)"
+	.ascii	"4G\266\031W\215v\352LT\324g\310\303f"
+	.string	"\361%9\017\202\273[\201\304\225\254j|\300\024%i\245\260\211\361\265\322\030\362 \242\224\222\244\324\322Lz\004\025\274M\314'\025\260\003\foH\210\234\355\356\322\273\306S\021\274)\264y\3066\353E\\\245\335\245\340\023i\245(\345h1\276\236\222\273*V,R\242\211\267V\251\022\252j\025\204W\316\212\023\253\021\250\226\213\305r\251P\255U\212\205R\275T\240 $\260\013E\316\013\265\302\345z\241L\245\354\024g\322N\260\006\034Ez\3363\f\241\364\200\363T^+5\006\031\235\221L\364>o\370\027\003\023\334\300y\351\"\344r\337o\306\020\231\341\221\215\264\3075B\321\206R!u\360\023\205a\3338?\321\223\341\ti\363\214X\037\374Dm\350yte^\2203\240\355ys\237=\342[\f<\360\343sO\250\201Dc\224!\216\220\004ci\026\244-\034\220\002\231);\017\021\200\301C$3j\251\331E"
+	.ascii	"I\356<:\230(\302H\250\2617j2\022\324!\243r8\246\004\235:M\f\317"
+	.ascii	"\305\361\233\340\246`q3\227g\353\375@\005\255\317\252\204\211"
+	.ascii	"\320+\356II!6\265,\242\240s~\211\037\332\210\245\377\\\001\""
+	.ascii	"\f\364g\342\230\030\254\224\313B}\320\344\212D;W\222z<\020\007"
+	.ascii	"%\255m\007\r|\273\371\345\021\270\2413\237\215\0238\241\376\231"
+	.ascii	"\331x'n\027\303\253\325\214\333\371I\347\202\032\0242\346-h\251"
+	.ascii	"+\267\261\306s1\272\027\002\325"
+	.text
+	.section	.gnu.lto_filterChainAddBiquad.51.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375``\002]\023"
+	.string	"Fc~I\300\226M:\242N\022\200\020\351D\322\004\037\033\202\020S\001\215C\334Y\263\227\324\003A\200\367\006\242\265\255W\317\345\312/\022\370d\034\351D\273\336\210z\006"
+	.string	"%c\373\251H>?\001\331\234\274\231\3014V\3316\262\267\334)\005f"
+	.string	"d"
+	.string	"p"
+	.ascii	"\265V\030+`\235\036\230\226\362I<\027PkQ\016\252\326\021\306"
+	.ascii	"\tX\247\266}\244\307\3501\255\300\250b\250%"
+	.string	"\204$\310F\256\326\361\363\370\001\336)\353.\336\351\036\235\366\271\222\346\373|.\330\025\261\341H|\347K\022\034\n\027\2566]F(\231\272\323\345\r\007$\345j\246\326ji\303\r\335\364\266il\333\330\022)w\272$\232\321\202HF\322\217\334\331\243\217\\#\373\263n\221\375\246\337u\246\237\345K\377\312\225\376\326\223~\226\245\251\245\347Jz=i\351I\277\345\2731\307\004\004U\255B;]5B\243X\330\356\261[\266i\023\007\243[\003&\251\232\271\324a\266T\240\0240\030\254\264?\236F\317\225\3744[\352\255&\002*\266\204\013\231\200@\206\302\203TX=\221\002\344\307\\\225\235\017[\211\227g[x\217\327\036\351r\266\207\363\200\275T\201\337\201\001\300\221\356E\324,t\314;\245&t9'\273\273\222\n\232\"\027\352\253\272\255\311\345\006p\241\253Q1\021\325\344\324\221\020:v\215\274\227y\337\0135\210"
+	.ascii	"I(\2663<\207L\306\3071\013Y\265\326\2578\365y\274\323o`\316\007"
+	.ascii	"\b\016\016\356\274\036\340\350\200\342\r(\2666\200\"\215\312"
+	.ascii	",\366\302\201Q\303bDpGC\354\346\233\2052Y\b\373f\261\227\354"
+	.ascii	"\203\211:_\214\001\2079\240\370\355\204\241\370\265\306\372Y"
+	.ascii	"\267\310+\241(AO;k\226(\271\361$}\232G\367f\233\256g~\2666\t"
+	.ascii	"H\327\262\354\312\266v\256m\023A\336\346YO\254\217\375!4Ye\013"
+	.ascii	"1 \240\002\031\261\233\007\230\346\360\341\350\251\342\025}\333"
+	.ascii	"B\203\271\027\352G\301\262eX\213\342\"\3418X\222\277\367\231"
+	.ascii	"TB\307\002b\241\227\214\021h\241fI\002s\242g\n\206ZF\311\264"
+	.ascii	"\211t\242M\234\033z\264s\374\262\327\326\263\310\006\326\354"
+	.ascii	"dh\243\325\206\306 \313\223c\036\n\355\005\027n\230J\221=a\350"
+	.ascii	"6\304\323\031\271:4m\336\003"
+	.text
+	.section	.gnu.lto_filterChainAddPt1Q15.52.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\306\003E\031"
+	.string	"f-\235G\260XQ:\361\215\217\233\220\355\237\027\216\t;/\324-\3344\370C\236\311N\222IxY\007+\222cXj\024\026[x\217\332\370\031|M\274Q\030kc\215\007\225\017\247\347\347\202\2621\203D\223\265\026\366\223\275\345N)\202"
+	.string	"\177"
+	.string	"\222"
+	.ascii	"?\374\363\313\256\022+Dv7\307\bR\2376\362\321~\356=d'Bq\232]"
+	.ascii	"\240%Dvu96\220\372\264\356\002\300\317\324\001\200\237\226\331"
+	.ascii	"U\256\263\261\3779\2450j\332\335PkX/u\367\214\262\203Sj\224\371"
+	.ascii	"<\007\345\314\356\256l5\211\200\026\247\016\030\227\007\362I"
+	.ascii	"\303\307\312\217\r\306U\032\3005y\261\262\315\244\200(4\230\276"
+	.ascii	"{Ta\253\305\210j\260\273\216?6\0277\352\266k\266\027\330\352"
+	.ascii	"\024\372\335e\356V\304\203\250'>\331\272Y\324 \373\367\321$\243"
+	.ascii	"f\005\262\301h\032T\364L\214\226\211\321\253\030\035\003\363"
+	.ascii	"\037\277\352D\177\352\275[\202\321:\243\343\214~\200\001\276"
+	.ascii	"\233\320\223&\351\226\305\023\227\2052\213\b\275\367\333\367"
+	.ascii	"\215\356;q!\2369\256\340r\274\037\225x\020'\270\365\206v\367"
+	.ascii	"E>\020\367|\344\353b\357\323\244c\305\225\335\275\371t\202T\t"
+	.ascii	"\373\204\255\372\274\312v\324\335\207\354\001\216"
+	.string	"\265,\263\370\344\233\377\310\021\036EB\r\211C\241\020V\370\023\01386.\034\t\303[\334zCN\232tx\231Q\204\003\227c\002\2139\303\321\343\215\034L\270\234\352\356\362H\r:\013\2645\\\tK\301\2157d\233x\222\026\216\322\3562\3209\222\016\177q3j:\002\213\331\005~N\270\361\206\262\250*\312I\n\247\250FB\245\377`yT\002R|\236\324p\263\335]\325\240\027x\335\260C\242\305-\266?\374\367J\355\356\002\177\b,\226\302\201\002\374|\"\\&X\362\303a.\226\207\326t\353\300\216\316\b\020.\016!,\366z\305Z!\314\305z\205\255\035\021\341\201\032\307B\350\354\204#b\261\235P\245\353y\203\036\235\201\032\344\227%\t\243\272\2447\227\252\"\347R\257e\267D\213[.'\316\245\302h\214\033o\227\304\303\321\350}vp&\t5B@T\226\246(%\315(\215\276KM\224Q\337\367"
+	.ascii	"\002\370\237\031\265\241)\217\315Je\364\276\313\"H\277\332\216"
+	.ascii	"\0021\272RP\313\354wG\332nO\001\225\306hO\250\221Hc\2201\006"
+	.ascii	"\261@f\"\031M\223\003\200\002\2311\253\016\021\260-E5[`\030\306"
+	.ascii	"\"*\360\025f\004\3259\2458$h\254\262\323h\264\341\277\334E\034"
+	.ascii	"\361D\241jJ\352\024\377t\021+j9\034f\302\250Z\357\265\303\255"
+	.ascii	"\tl\021#\357pEP@\0246r#\371\374\215u!>5\235\323\356\023\r\030"
+	.ascii	"\267\333\245\250'\377\203\216\302G<.\002+\243\005\236\036/\325"
+	.ascii	"\300\241\t\021\207\373\002\331\372\026d\211\3664\246*\255bf\366"
+	.ascii	"\320\200\023d\322\276qR\366\001o\207\273\021K\343\313H\233\277"
+	.ascii	"\263\0041\360~\260\341ZM@\255S\254@Z\005"
+	.text
+	.section	.gnu.lto_filterChainAddBiquadQ30.53.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\037\005\355\033"
+	.string	"\3260\255G\240ZQ:\034\274\005\0044\256k)\"\213\\\263R\030e\261\345N\263\340\342GG'Ul.\344\333\036\212\340>\016\033\313\335\307\327_\363\034 Cp\227e,\220\310"
+	.string	"\023\241\3038\320\003\272\r\347\212\326\310\336{\247\024\217"
+	.string	"\213"
+	.string	"\237"
+	.string	"/hl\221\224xH\220\302\037\321\035\211\207\316\331\245\242\365dw}\354\340\365\252\200^\332w\272\021\335\237`|\300\256\217,Ov\205>^\360z\265\360\005\306\327\327\t\214\257\326\331f.\004\262\007\230t\304HR\334]\331\374\341y*\274\253\324}\254tJ\235o\364\221\306vw\307\307\243\016\220de\302qz\252W\245\336\260\347\303\361I\027"
+	.string	"\261\334\330\361\355h\201.Je\276\3442\311\307\223\3225aw-{>\033\267\353\266y\266A\3305B\257\335\375\361\241\b\335^C`\214\257\237_r\352\364sR\344\351Hn\331\302\235\234K\366\177\244\310\203\347\351\303\216]\311/\340R\377\316\243\376"
+	.string	"G\362\353\374\351\317\371\324]_\322\324%=Gi9J\337\200\216\020\032\276\317\330\262[c\353\315r\251Q\210|\352\267\3577\371\220\305\235\370\301\317*\270\273g\342S\031\346)[}m\354e\024\231\202\240\331\335\236Ww0\013\033\366z\230m\252\244E\021\203\224\2074\266I;&\027fT@\2470\270\361\325%e\252\230\205@\n\230;3\300\324\231t\372\303\f\032\344{\376\360"
+	.ascii	"\254\354\250\001\334\3374\262\377\005\247C\354\331.\272\027\016"
+	.ascii	"?\036\336\345\203\317O\210s\021\361\034?\253\340\026-t\236\352"
+	.ascii	"\026\224zSz9\216\344\326\234\273kD\347\022\211\321\036\361+$"
+	.ascii	" \374\252\202\266\213[\2311 \356.\020\355Uj\277\361\033\026\251"
+	.ascii	"\b\335|b|\335\360\253\nf\3159]Yb\304\221S\212\214\370\036\326"
+	.ascii	"\345L\360e\306\026\017\270\333\335\235s)\305\370Y\002J\013\222"
+	.ascii	"\324\262m{\224\024\001D6\0273ZS\361\242\203\206\327\212f\033"
+	.ascii	"P\020\325r&j9\330\212Z\316\002\200!\333\f\005\255\232\326 W+"
+	.ascii	"\022\262\231\220\r\341n7\034M6d\233\335d\264\034\221\254\001"
+	.ascii	"\217q*j9Y\021\016\227\223\301\204G\237p4w\343\\r\316\025\215"
+	.ascii	"\315y5{^g\222\317\353<\033\250+$\251uZ\315\340u\306\346\216_"
+	.ascii	"\025\224\030)\340\216\2024\n\342i\"\312\335\212\003\347M\205"
+	.ascii	"k\005\0015\021\335\024\333\260YC\025\314\272p5A<Xi\320\2341#"
+	.ascii	"\223\364\260z\376\2411\274L\020P\023\030\240\023\231\2531D1\265"
+	.ascii	"\234\036Qo\002c\250aXd\220\021\024\262@FD\222$\305\034\300\002"
+	.ascii	"\021)\253m\021P\251#\210\031\021UZJsxE\377,_~\346\300w\230\264"
+	.ascii	"`\317[\026=m)e\323\335\013\233\212#\030\335\232\266\354\255V"
+	.ascii	"@\203x\3376\355\274\305\202\237\017\261\026\033\307\235\354\n"
+	.ascii	"\366\304o\275\212E\304\330\313\223\223q\215\377\214\376{\234"
+	.ascii	"rY\304\241\377~\331\220\334N\037\364\345>\217)\375\245iu\210"
+	.ascii	"F\031@\370\024Q\024\234\345&\351Ij@\362fJ\2163\"\305]\363\344"
+	.ascii	"PExb\222\232\200\253\207\031L\r\034\\&\304\016n\307\003\355\376"
+	.ascii	"\241\323\253\343\200\375T\320\205\272:\255\251\327\320\355\001"
+	.ascii	"\244\036c\216\036\260\251\rAVGV\003"
+	.text
+	.section	.gnu.lto_filterChainApply.54.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\330\nU4"
+	.string	"\252X`\023CP\244N\007\203\350\007\370mlV7\212\"\271A\241\200\342Xi\216Y\006\355\032c+\214\305\001Q\265\252}\224\026\376\204\361\261B\351\340\035\327\b)\024A\025\346Y/\271G\0343\263\275\2447\331{'\231R \001\022\001,\001q]a\211\367\3149\273p\335\356\226\366\267\327\303t\235\232\275d\265\351\025]{Zp\267\366/^\272\256\305J\266nnq\004'\264:\332\333\332u6\347\242\303\273\3608\332\212f\264\022P\3015\243\257-\241\365\365H}\267\273q\264\343"
+	.string	"\0378\356\3665\307\362:\324\207\017\345\214D*\227s\324\251\231Z_;\352"
+	.string	"X_[/b}\355~\273\003=\352\314\006\324\234tu\031\3149C\275\022v\330\335\357\266\352SW\243\336?\353\353@?E\2278l\205\354\252\006\t=~\333\265\270\332\004\022\007\251\304r u/\311T#\210\275\365\371\233\026\376)\342E\2731\354\022q\342\030W"
+	.string	"%\271\304C\005I\300\304\274\025f\200s\017\315\257\350Z\036302\027\252B{I2\365\001\366RraV-\314W:/\302\303\306\007F\031\346\252\230\007a\".\344t\263dY\027Q\271\305\026\373\242\214\265\002\263$\331\372\376\346'\324\236r\314\300\2128\026f\31097F*\301\274\207\274\333\301\272\373B\367\260Ok\312`\214\334k\347shZ6\242\246=\257\003\333\234\261\234\331\336\302\215d\265+i9\347\245\273vf\353\314\311\034\315K\021\214\034q\237\356^\341hZ\270X\336=\273\333\205\237y\361\344\227s\246"
+	.string	"\303\315H9\3312\315`\316yB\231\020S\355h1X_\375\035\316\3254\313;+\320,<}\261\267>\265\377\263\356\250\026~$}Q\304\266\364#\351vjq7\265\270\215-n\246\026\367\022\306\355@\210\273\201\020\267R\213;\311\347\274\221\\\352\315`\301\321\001\217\272\0339\324\235\200\327y\027\271\030o\"\017\343=T\304-\344\342\016jq\003\021q\377\264\270\213\030\267+\304M\024\342\036\266\270\333!na\213\233\305\270W!nU\210\373Y\334x\305\355\020\212U\320\224\216\234\346,d\272'\347\255tO\\\352>\347^\347.\306=\214]\273^8\250I\323\342\332\307\264\373*]\266/\271\265A0>\327N\327\356\227\327\335\\\332.\327\256\257m\257\016\017\216\354#\256\307\352\306?p"
+	.string	"\371!\273;\340.\017\022\234\370\030\345iK5\203\230\013o\341\0276\275\246\3100=\377j\033\222\227GP\370g=\374[\235\376\377T\243#\275\227\223#\275\337a\373\333\302z\260\033\031\256%\333\344H\357\364N\006\235\036\231Z(\262H\233\036c\265T"
+	.string	"\316 \022L\373\360\331\363\200\3109\306O\372\246g\357\216L\246g\360\306g\371\034\241$\375\3223\375"
+	.ascii	"6\307\264v=\257\223\226\266\243\265w\034\353\353\322\273\327"
+	.ascii	"X\2037z\007\357G)\2527\032V\351\033\274\037\241h\341i#\275\322"
+	.ascii	"\013\001\273\372d\341i\277T\034OK\237\234\322\376\340w@\210("
+	.ascii	"\313c\256\331\251CgN\322;\235\033\331\366X\241\313\302S\267\243"
+	.ascii	"\327\234\263J[\204\013\266\324B\331\223\2716\302\343\220\230"
+	.ascii	"`\302\003\243|l\211\367\004\204#5\324\353\262\206\271\366&\005"
+	.ascii	"\353+\203w9\307K\312\236L,\216\347\016\347\355\336\235<,\314"
+	.ascii	"G]"
+	.string	"\343\036\364gm\2743`a>\355\336sv\364\222\b\371\265\273\351\300\001m\226\317\246\275\257\003\007\004T\216\203j\207\224J\303{\360\330\3616\250\244fL\255=\365t\025#G\r*\031P6\254\252\252\254\246\240lPIUAM]\341\200z*\320V7b\\A\345\260\262\272\202r\243Yr\256\305\375\007\337\225\274\254\327\222\003:S\\\360\377\207\215>4\004e\303\013z\241\367&6{\317\332\306GBL\2659g\037\254\257A\237`\t4\013O]\375\031\372\005\357o\236\242\351\345vdj\245\301\320\"\361\300\257\177BF/*z\267s\213\376\300\024hF\023.\376\317\222\227\tv$\020\031\r\025\230\310\333\304\341\236\340\261W\315\2718\305\242\\p\t\347\271\034\3623\243H|\243w\207O,\372\341\273\235\267o\232@\334\210\177\326\356_{\364\353_\220\321\211\210\210T|H\364G/\200\355\213\314\221\331~"
+	.string	"\347\337!\347(a\366\205S\336*\330\221\355+\253\0204\013\234|\255x\233\363\275\202\205\274X0\370\005\211\3623K6@\276\204\357\310\260\254\034-m\321\330\177@\365\215~\365A\377W\211\376\337\307x\333\206\357K\315\267G\330\350\361wk\330\200\003\200\324\250a,\306\030B\006\241\231\031\031I\2224\006\260\002\221\241\251\332\006\022`\205=G!3bCaA\n[\377\r2\005\001oa\001\333\371\326\033\035N\307\371\326\326O\211k\332e\222\375Hs\200\311\261[MMh\272N\225\031\t\215\b:\254W\032Nno}O\210c\220\356\272\273\214\304\027\226\037q\034Z\306_\007kp<xt\221\366\353\342\017\327\317\230\021\033\222\331\247\300uk\361\233\217V\302S\266S\322\311\200\223_uK,\343u\266(yr\257+.\354\032\377\231\225\246\333\257\320\375w\375\224(\335\020\220I\032\013|]H\253\305\006"
+	.string	"\261\257\001<?\351\300dBv4\204\026A.&\264\300=\330x\235g\2210\353\366!E\003R\262\232\016\275\377\305z\250\344\231\354<;1XG\202-M\332\310q\245\351\307\256\342\262\021j\033\313\037\3348^\357\352\326\240\230\333\200d\313\261&Q\351\255y.\235\335\246\t\315K%\352tX0\304i v\006\234\001M\365\270\177\300K\204\315\255B\314\353\276\346\b.9="
+	.string	"Ci\233\366\205\321\217\200v\3359\251\346C*\003\235)A\027\242\224\214C\324z\272\231\n\330\026\204\023\022\027\270W\254"
+	.ascii	"1qu\323t}*\"\016\016\005\035\343\244\261{K/\035\340\304\372\360"
+	.ascii	"2JvA\335\177\361}\352\270\353W\2011F\265\001U\273SM\273\003\214"
+	.ascii	"\321\213\024(FQ\372h\357`Q\373o\310\006\333\3106\362\235D\226"
+	.ascii	"\233\255\204\215\3324\213=\224\362S\366\254E\307\316\211m\325"
+	.ascii	"XS2i\350\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`\316\004\305\016"
+	.string	"\304\025\312\005"
+	.string	""
+	.string	""
+	.string	"\002\017\1772\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006\006\1773\272\200\202\002\007\1774\b\1775\t\1776\n\1777\013\1778\f\1779\r\177:\020\177;\016\177<\021\177=\022\177>\023\177?\024\177@\025\177A\026\177B\001\027\177C\031\177D\004\030\177E\001\032\177F\310\240\361\007\033\177G\034\177H\035\177I\001\036\177J\001\"\177K#\177L$\177M%\177N(\177O'\177P&\177Q)\177R*\177S+\177T,\177U\004-\177V\004.\177W/\177X\0040\177Y1\177Z2\177[\253\306\366\232\0013\177\\\0044\177]\206\237\370\3015\177^6\177_\302\231\263\346"
+	.string	"\005\003`\201\204\001"
+	.string	""
+	.string	""
+	.string	"\0018\177a\377\037"
+	.string	""
+	.string	"\200\200\200\0017\177b9\177c\003"
+	.string	"0\204\001\003"
+	.string	"/\244\001\003\t"
+	.string	"\"\003\n\t\"\003\013\242\001\003\f\022"
+	.string	"\"\003\023\022\201\200\200\200\003\001\"\003\024"
+	.string	"\271\337\216\370\003\001\202\007\003\0311\0321\204\001\003\034D\003\035\036\035\037 #1D\003$\"\202\001\003''&\202\001\003*\023\321\211\341\346\002\001\202\006\003+1\344\006\003,\035\202\006\003-\027\246\341\365\321"
+	.string	"\001\302\013\003-\034\362\243\341\365\001\001\202\017\003-$\342\023"
+	.ascii	"U\2501(\3455\n[\2470\035P\203\314$\315\001\021\240\210d\2202"
+	.ascii	"B# \220\204=\034\003\225\007%\237|A/\"\213\224\"\372\360:\270"
+	.ascii	"`}\315\360(\353\002\335\242\236\244c\"r\240x\230\200\230*y\254"
+	.ascii	"1\"\005\302\354\020`P\351\032G\001\371\265`,o\231\265S\3707P"
+	.ascii	"\222\017\031dPwDr/Qyo\221'\252/x\037\352\330c\217=\266\323;0"
+	.ascii	"14\200\252"
+	.text
+	.section	.gnu.lto_.refs.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.607338cdc71157dc,"e",@progbits
+	.string	"(\265/\375`#Dm"
+	.ascii	"\001j\236\235YT \fQ*\351\276j=\243\311@tzw\r=v0\300n\232\231"
+	.ascii	"\304O\301\003\317\211\307<u\372k\325\273u\355[w\360\316D\241"
+	.ascii	"\340\374\354\230\0265\242\227+\"\006:\320\024\227\234F/\363\342"
+	.ascii	"\336\255jY\253)\276\302!\035\201zR\255\032\251m\357-e\n\253\004"
+	.ascii	"n\005\277\005]\304\220L\254\353{\311y\366\200H\017\017\331\003"
+	.ascii	"\342\033\353l\r\304\367\217\363\275\343\374\271\214\007\347\021"
+	.ascii	"\0263.\303\302*h\250\245IW\302\363\214H\225\223\256\357\031g"
+	.ascii	"O\330[3\217\271~\356\302\363\322\354{\333\n\323|\363\322T6yk"
+	.ascii	"r\327\335\232\227f\231\224?&\303\201,\310c\030\220\007\231\217"
+	.ascii	"\375x\311}\254w\336c1},v&\303\215\361\226\327[\363\336k\203D"
+	.ascii	"S\262\313P\337KgO\261\006b\007\203\347\031\360<\2239\317|\347"
+	.ascii	"\006\314C\374\331\356,\005^kA\272\376\\G\207\334\253\222\321"
+	.ascii	"un\213\360p\020L\227-Y\230[\367\3368\206\343\262\365\205\301"
+	.ascii	"\260\034/9\216\337\316^89Sf\216\020\312Y\317l\347\r\363\020\317"
+	.ascii	"g\347Y\314\255\315F+\013\262\257+\333\006\024\352\274pt="
+	.string	";9\317_kf[Z8\313\2319G\311kdD\231\214\277@.\274\205\227\254\205\325\3066\320@\001\362\004\211X\3179\316s\323yN:\2450\027_\241J3\246\356\330\275I\f,\350$\016G\327\264\r\224\t\223\340\217\256':\317\\aE\320\356\275=`Zh=\312\035?Wa&\243\261\031[\341%\2371\225\363\030\223\275&\357=\n\361sW\331\23194\367n\221\202v\357=\177\375=?{\361\027\237\261\330\231\024\f\3522\031\3615\300\250\005\211I\340\275\267C\207\016\033:t`'\2634\270\233\372\013\234<\305\032\210\031\230\207x\020\347y\312\003@uE<\347\274\315\371\363\274=\337\347\341X\003q\003\326@\254\314C\334a\036\342\223\254\201x2\017\261\225\006\233\205`\233\350\300\016\030\213\351\357\001\f\271\207\337.5\021\362\347\032<\004\343\003\370\355\nX\307\3176|B\240\3025\370\355\320\337 "
+	.string	"\177\336\3613\003\222|\303o\177~\346\200\307\217\237s\374\334\343\347&\253\237\251~\306\372\211\306`\bw`Q\370\271\212\257\332\312j\340od\377\371\200"
+	.string	"1\306\017\360\023.p\n6\304\3170\210~.:\301\317,\274h)\004\374ml\2778&k\201\320\261\343\226,OP\213\237\237\340\024,\315\337d\200Z\004\255\020\032\363\267\230#"
+	.string	"~kU@\3703P\213\240\025,\366\376\316+\252u0\360~V\3613\t~\376\371\271\004?\247\320D?k\3211\211F\001`\317u\\\2134\026\301C\340\303)T*?\253\240B\327\317*\374\335\305\355g\021\360\bB\360\267\n-\002( D("
+	.string	"\204\023\3771\374\025K\001\"\330C\n!\\\347\257V,\202A\340\ft\033\n\334\201\363\374u\307\317&l"
+	.ascii	"\205{\320\001\316i\3729\003\032\3709\002\254\305\033\370\331"
+	.ascii	"\204\237G\370\231\204\2379P\344\204k\370\253\n~\006\301\"X\001"
+	.ascii	"\f\002\367\204p\013\376\352\201\237\027\360\363\007?{\370\371"
+	.ascii	"\303\317\031t\0076\022\035\202\005\007O\241\bw\360\232\277J\340"
+	.ascii	"g\016~\036\300\317\031\374\\\200\306\240\212\370yG\303\317<?"
+	.ascii	"g a\303m\376j\200\377}\200\315\337\374\225\247\357O\260\311E"
+	.ascii	"ft\372\317\371\253\375\031\360~\200\204\307\371+\377\037\363"
+	.ascii	"\337\357?\340\377\276?\301&\231\377\204\234l.Z\277\340\247|\377"
+	.ascii	"\315\376[\371\317\374_\366\377\354\177\032\331\026\255+\337\371"
+	.ascii	"\251\321\317\200?k\265\226\237I\024\376\374\251\341\377\022h"
+	.ascii	"[\234]\332\377\270\377r\377\277\374\237\243\373\314O\251\260"
+	.ascii	"1\371\277E\255\310\377-\377\265\374g{\333\211?\275z\t\267?\305"
+	.ascii	"\261\344\364\247M\177\257\375]\345\357\262\277\227\177+\377\376"
+	.ascii	"\372\333\311\337I\376&\362\267\325\337>\376\316\361\267\324\337"
+	.ascii	"L\177/\375}\364\367\361o\025\374\215\202\277a\374]\364w\213\277"
+	.ascii	"S\374\255\302\337\"\370\373\304\337\034\370\233\204\277K\374"
+	.ascii	"\035\201\277C\374\235\200\277\007\3607\006\177\003\340o\232\277"
+	.ascii	"g\376\356\277\377s\231\237\003\177\326\373\331\356g\271\237\331"
+	.ascii	"~V\373\031\313\317f?/\177\006\373\031\310\317W?\307\370Y\350"
+	.ascii	"\347\021\374\214\302\317\034\370\231\001?\027\340g\013\376\023"
+	.ascii	"\376\237\373\317\366?\355\347%?\033\375\317\340\347\234\237S"
+	.ascii	"\370\177\342g\342\377\022~&\361\263\326\317F~.\3623\326\317C"
+	.ascii	"~N\301\317/~F\301\317.\374<\364\263\317\377\023~\356\300\317"
+	.ascii	"'~>\341\347\020~\356\340g\f~\276\340\347\r\377\r\377\027\376"
+	.ascii	"\257\373Ow\345?\t\377U\374o\373\357\341\360\360\360\360\307Q"
+	.ascii	"\372\317\017\277\207\020\004SPvG\034\214f\004\347dT\3458uA\223"
+	.ascii	"Q\325\324=\2023\362\205SZ2u\357\022\243\026\267\351\336{A0&\341"
+	.ascii	".\026\303\031\203\360\2703\220\356\305\340&\357m\272\327\310"
+	.ascii	"\027\356\336k\274\367\316@\361H\336\253cGi"
+	.string	"\253\251\351^\344\206\246\313\303\230\206to\217\335\241E))\253\246z\322\226\312\255\233\2244\262\322\214\251\273u\355\250\240N\245\021\354\316\270\367\362\230s+\252F\037eB\227\374)\221Q\272*\261q\302uE\252\353\211\311\363?/i\022\212$y\357M\302Zk\322\365D'YT\213\362\341\345\250\352zb\220\254d\006\244\023\247\256LZ\004l\353\336\273ssG\346l\254\353\211>\316\237\022\241\272\371\022\263w\354\372S,:d\253\371cG\327+\235,\257-B(+\252D\253(\030T\006\344\274\b\241AxI\255\350\013\247H4\t\204\bjE/=\242\311\255\031*Uo:}jIV\210\365\2472N\253\376.\323\207\224\252*\237\362\366\272\002\251AZ\372\230\353z\342\361<\177\375\2404\250\016\206\033\263r\314)\352\203\227\364\007}:\205\242Q\364\007e\242N\024\f\3524\223#k\336\233\354\260\241\203"
+	.ascii	"tl\211!V\252\203\";\210Y\023G?\241`P%\310UiR\035\324\006\275"
+	.ascii	"A\301\240J0:k\322\034t\007\345A{\360\222\3528\325AkP\251\234"
+	.ascii	"\243\3445\346\310Y\221\361\027xA\207\021\374\350\216j\352m\231"
+	.ascii	"\363\026\360\306;\216H\026E\020I\327\333&\225z\213\311\231\273"
+	.ascii	"Q\304\253\353-\335y\353\345\234i\246\321\246\033\252*)A\272\336"
+	.ascii	"~\321\031\257aS8\364x\243\013\263\353m\224\223.\365\234\312x"
+	.ascii	"@\221 Q\272\322%g\006S\254\201H\225\314C\274\025rR#=\362R\003"
+	.ascii	"jt\020\"N\215a:8e\240\224!\354z\353\343<k@\344C\326\200x[\343"
+	.ascii	"\314\340\262\006\"M\032j\240\223\274\321\024\244\220O\2479\345"
+	.ascii	"\024E8(\001C(]\272\n\336Hq\022\213\352\372:x\372\025\372\265"
+	.ascii	"Q'\345\034\223\027jF\3140\351g\245$\343/\360\257\3074\231\006"
+	.ascii	"\354@^\266_\367\371\365-\323\274\367\372\361a\3631\0342yi\314"
+	.ascii	"\210\035\022{\344P\302vS_\343\316\277\371\332Z\313I\313\257)"
+	.ascii	"\346\213\036\221\300\256{3S\230w~]_\231gO\330\021\274n\243\302"
+	.ascii	"BkZ\251\312j\226u\033U\027X\267QAQ\212\225U\035i~\345u[\016\315"
+	.ascii	"\275T=\320\300\360\235YUV\023\257\347:\257\351\372\256\303\264"
+	.ascii	"^\327\265\035/\033L\313\235"
+	.string	"\367XL\007\234\301\257B\260\f\365\265\353\374\373K\234\213\034M\313\256p\033j\2564\031\323\354\372\232u\236\277\326\272-\347h\347\036Uay\351.\274\354\267v\033{\343,\335V5\244\005\303\364U\021\353\353\217\263\2674\027^^\255\331\260\264\030\261\272\276\3428[\270\367^\276\032q\346j\304\277\265\254\3454\261\363\233\221\304Q\222\325X\242\306\001G\220\316\350I\026,4M\270\230\272^\261!3(\244L\327\327\243\363\3145%"
+	.ascii	"HrL\315d\262\225\024\f\352\244\"6\303\254\2534Z\247\365Y[\341"
+	.ascii	"e3{\354M\326eT\226\266\230\275<3\347h\3472\031\311\330R\366W"
+	.ascii	"\316\321\316\275UM[Q\232\311`\375E\301\240J\3109\3211\266\036"
+	.ascii	"`r*\007\2275\020+\024\337y\212w\236\306\235\247^\316\006\353"
+	.ascii	"0^rh\261\323\034%\257\362\336\244\016\r\335\230\036c]O\327\316"
+	.ascii	"3\007\242\316\341\341\341!s \236\226\235\177{\265\224"
+	.string	"\346\322!\006\214\217\256\335\325\363\366b*R\310\270\256\022`\036\342\316e\r\304\276\314Cl((Oj\260@qjvu\302DK\256u=}rr\03001\255\316j$\275\325J\272I\037i&\235\204\227\275\244\211\274\213\264\021\2542&\232R\260\331C\360\210\2405V^\3678\356h!\3151\264\276\272\353\036\307\301\255%\034\326'\330\274\367\332\031J\216\315\f\225\b\307\032\210\317c\036\342\251\220\363\003\017\361h\314C<\\[u\020\032nB\216]\253,U\021\246\250\256\2478\316s\262\201\360\232\336VS\365\024/\033H\3738w\365\217\006\302Y\272\007\303\215\325&y\033:\324\024\032\222I!V\276\254\201x\252t\376\315\343\335\343\314\236\262\240\275\360\371\b\354\332\307\2367\017\036\"\0242yu(\332\032R\341\216~\232\221\262V5\246\343V\236\272\002\351\272\376\235\003I\214RF\355\253+\016\"\024$?"
+	.ascii	"\373\272\006\037\336J\bHP4IF{!\224:)\347\270s\217\214\360\266"
+	.ascii	"\356M\276\215\177\317\273F\033u\022M\242\235Iby\315{\223\377"
+	.ascii	";\252o4\215\226j\033\274\354\032\275\364\226\321L\337\3205\372"
+	.ascii	"\022\345\364d\374\005\202\020\3215zF?\345\030\223\367\211X%F"
+	.ascii	"\306_\340\275\311\033\300.[Q7\265\237\272\235\032\352\375\324"
+	.ascii	"M\007!\3427G\227\353\336d?\325{\217\314\034\3440s`\325\216\034"
+	.ascii	"\305\210\365\235w\276\347NN\262\006\342\006\346!\276\231\347"
+	.ascii	"\273\353\354\243~\201\227\0364\322\373\330\306\333c\362&\357"
+	.ascii	"M\352\004\025\260\002VB\274C%sR\315:\370JH\f\f\314\"\323\265"
+	.ascii	"\nV>\034\256\246\213\326\265\006\332\270\371\371\3251g3\310|"
+	.ascii	"\231r\324\3656c\365\256\336\3251z>\232\226\006\223\300f\337\353"
+	.ascii	"\030\232.9#\221\256u\257\362\315u\221qT\371j\223\fX\223.{6L0"
+	.ascii	"iRbZ\216\270\344\211RF\327\252\227\207g\223dn\256\3321\r\352"
+	.ascii	"\310\023\334\353Z\355\2304^h\b~\351Z\351l\246\340\340\252\\\337"
+	.ascii	")3-%l^_^\345\272\255M\314\225\250\2565\256\262\331d\020*7\272"
+	.ascii	"\215\030f\t\220\244\256\267Yz{\253n\247\021\317\313\016\346\022"
+	.ascii	"\331\\[\253n\247\321\214\013\222[ \205\302\365\245\256\355\325"
+	.ascii	"\315rA\322l\352Z\265T6%WWdT\266\312%\b\\\223\035\234\016a\031"
+	.ascii	"#\221-\355\006\345\310\026\224\227,Y\360\234\370r<y\353\372\032"
+	.ascii	"*Lf\275B\330E\005N\255k\275\2223e\n\030e\327\212V\261t\300\354"
+	.ascii	"\340;\253I26V\317\302\264\365\220,6\246\252\274\236\345\2205"
+	.ascii	"\375\352\272V3.|T`\272\3262\232\27065,]+YU\332\220\251\205\235"
+	.ascii	"\3258\325dM\326%\006\030\353\f\311\301\0054\255\033S^\227\375"
+	.ascii	"4\223gE\247\324\265\206Ue\0272>\376\224b\375v\205\206\227\274"
+	.ascii	"zgWU\272V\260?&L\252W\030#7W\177Z\016\273V\257=\262\345\217\253"
+	.ascii	"\256\025J\345b{\272\002\204\253J\231\343\033\023u\305\032a\372"
+	.ascii	"\302\024\245\307jd\200i\002\244k}r\346\314\223$7\251kurf\216"
+	.ascii	"+#c]k\223V\362\360\023\003\213;r\244*1l\346d\371\005\n&yU\302"
+	.ascii	"\364Rx\273V$\025KG\f\215&c\272\326-\255\2543 @j\2210O[\335&D"
+	.ascii	"I\203\310k\221\032+WIa]\253\220\212\225\023eUE\tk\210\265B\305"
+	.ascii	"4rr\243\274Ri\365\252\21109\351\025v\255VW\013\303*\304\321\265"
+	.ascii	"\006\251U\225\312\t\017\036\365\007_\250\272<\342\230 \020->"
+	.ascii	"^\177\264\221\035/\340u\255=*\262\206\216\220"
+	.string	"\260\007\215\225\224T\325qi\235\033\222\333\223\032B\f\367r\274\3528\253\242\330\215\351ZmT$%;2\"\006\211c\003K\254\250TY\251E\371\273\321>*\026!:\272h\244*Se\2524\250P\"O\313\247\032\365J\003\251\311\207V\327\332T\241\376\323\330A,\035g\025\252>\025A\312\200\302\241\003\346\210\323\220\352\324K-\3005\347\272\326\031\235\304Jcj\264Y9\221\254-5)\\Z\252IQj\352\220\374\t\351\372\363\256\036\325\243\232\224\224\243\331VPr\330\250H\257I\314\033\245\243_W\327\372\002\375\253\"\013sC\255\036\353\261\216\t\314]\225\256?\277\352\255\227\006\362\205\272\027\t\201\271\273\346\214Q\b\016\261\256?\215\f\016\3222rl[:\311@0X\206\247e\302f\260\tv\245\205\364OG\313\322\227aWJX\267\204\2355[I|{*\034D\212\021C\003\247\224\325\272\3020_"
+	.ascii	"O\003\367z\370P\346u\245c\350\337\177\032\007\034\265\315\321"
+	.ascii	"?\352\227\026d\310\221\360\246pG_\035\031\326\243K\250\242\300"
+	.ascii	"u\245}|\3153\351\356\216\352\311\2251\022-\253\260\274S=&\020"
+	.ascii	"\273\034W])\036\340\334\034\265\033B\251Dy)\325\235\332Q&\034"
+	.ascii	"k9\272R:\032w\223\0066\343\252\316\315\215\312A@,\007\261M\f"
+	.ascii	"\211\222/\247r6Nt\200\267+}\243qm\200<\220qp\\\310z\314\230\233"
+	.ascii	"\341\262a\b\305\013\277\225\361\022\023\353J\273\234i\005\314"
+	.ascii	"\256\310\026-Z([\337{\357\326\314\322h)\2070\211\204\216\313"
+	.ascii	")[\315\224B\253\274\256t\013\231\232\032\305r\336{\351\275>\n"
+	.ascii	"\267.\022\311\201\246\t\324\217,%gg\024K\336^\363\"\221\034p"
+	.ascii	"\n\221\334t\\9\305\242\363\244\214\231\215\256\324\nM\273\251"
+	.ascii	"\001$\220\231\206\206\344\210\023\0166?){FLVk='1\205Vcc\324l"
+	.ascii	"\347\032\355\331\331\277#]Xe\247f:gr^F\272R\262N\262Q\212R\246"
+	.ascii	"\020\207\230\030]\362\275\367\"\037\260\305l^$\017\0164\201Z"
+	.ascii	"xSN\227L\034\256\267\032J]\251\222F\347\210gh\243\353\375\230"
+	.ascii	"\211\025(e]?\223t\2366\241NN\237\374\t\005;\357\275\306\344}"
+	.ascii	"\232\251\302Cr\013\274H(\016?M\236\202\375 D|\357\346^\256{o"
+	.ascii	"\006\365\216P\320\260+\345\242_T_\276\212|y\321A%\302e\032[\205"
+	.ascii	")\255u1\225\234A\261\031r]\251\024\034\270\344\215\246\2564\n"
+	.ascii	"M\216\021+\257\033])\024\232\231\037e\205~]\357G\267\376\323"
+	.ascii	"\264\362\213\024\270\256'\356\235\377\371\375\023\357\021\352"
+	.ascii	"\336K\303&/\224\321\r\361\347\263e\346\360\3430e\002\374\257"
+	.ascii	"\367j\260\"y\215"
+	.string	"zd\356\275L\346T\302<\356\350\372\177\203k\341\356=\2422N\200*\352\210\n\207\222\222*\n\203\222\222\352\032\217\262\214\030\240.\225QIy/\206\243#\243\005\246\242\224\224\307\213AIy\243\356\013_\242\370&\251\214\367h\352b\270G\367x\225SQ\033(\035QE))\217Q\030\224\224TQWIuw\356\321\021j\351\350Ba\270J*\276\253\234\212\332QRNE))\251zp\017\245?\267\250<2U\\8J\351\350:5\3618B\355\300)%\247\256\335\275<\206t\241.\334\275\004\270\227GE\024 \214(\n\001\315|\b\261B\b\310\207\250f\350\304\210\036\023#zL\f\235(\372\f\005\225x\213\017\212\202\202|R\024\025\201V\360"
+	.string	"C\210\305\002Z\200!\004\024\264"
+	.string	"\020F\240\030\021B\013\036~T\300\bJ!\004\344\201\250\b\206\007\017,\f\021\265(\016\t\315\254\360\371\t\252\305\"\241\241\024vEQ\b\210(\210(\004TT\363\026\037\024\265(\372\270ha\210\350\305\013\037\024EC)j\336\342\203\021N\210p\202\207\342\017\013\"\237\342\006%H1\024D\342\207h\210\204\213\237bQ\214\023tb\004\275x\261S\001\013L\250@\206\236\242\t*TP@'\003\016\212@B\"\214\3501\201\301\207\020&zJX\300\202\0132(a\302\b%L\030!"
+	.string	"\037B\230\370\020\302\204\212\237\026\200J\210\3501\021"
+	.ascii	"\021=&6\210\3501a\201\213"
+	.string	"!\242\022\005(\372i\221\242\350C\202\005E !\0212\360\270\020\343\003\030\212@B\"\270\020\343\003;E !\021,\350)a\201\f%L\030AC\t\023F\340)\002\t\211\260c\242\370s\001\035\235\"\220\220\b9+V\f\025a\220\370)\372\250x\201\202\206\"\220\220\bB@>\027\300\211\021\364\342\005\005\202\202`\b\351lx\n \242\037\241\037\026\347A\030\261\200\021!\2640\363\020\032\360\241\001\037\210\017\241\001==\r\030\321s~D\017-\026\2418\001P\364\031\nZa\213=\305\027\224(\242\307DO\361\005\361C\b\0234\304\"\0248?(~^\3048\361\303\302\247x\002\206\237\0271\212\325\026\241\020\002\362iA\002\247\210\"\204\242\020\020\214\231\242\020\214!\022?,|\212E5\305\"\024#zLl(\242\370\020\302\304\207\020&D\364\230\020\321cb\246X\204\342'h\005\237\023-R\024\207J"
+	.string	"\200\013\030\020\002ra\207N\270\320\202\306\004\027Q\200\bQ\364\341@\213\242\037\242\025?D6E\f\305\"\024.\304\370@N1hh\250\002(\254\212\037\027@D/\210E(~X\370\020\375\234\200\002$\250\370a\301\302'HC\013?*\204D\360"
+	.string	"\206\"\212\021=E! \030\347\217\013@'\2600\244B\b\210\205\032\0270N`!\004t\202!\0274+`\254@\213 btNO\013\r\242\205\356\211\321E\025AC-\212~\210Z\024iX\370\t*\272)\002\271"
+	.string	"\032\201\205\237\240\"\232\342[\224\200\213P\224\350)\276\260\371)\372\024\213lQ"
+	.string	"\037z\361C\344\24184D\344\301\006\204O\027\241(*\n\375"
+	.string	"\245"
+	.string	"Z\261\342g\210\204\n\037\030&"
+	.string	"Z!\303{zHl\200B\t\0278S|@\364S\f\002Z\341Ah\310\205\213\241\024\036\204\200|\\xHAT\344\341\003\f>\254\320=+4\210\025\272\307\247\377[\302%\3011+\031v\320.\271\203\017\316\n^\311:~i\nTRS\245\324U\007hs\340}12\372\263G-Q\203b\336zV\340~t\265|\266\217\227w\263c\236\2648t"
+	.ascii	"y\322\365;X\347\n\334\210w#^\235\233\2732/~]\367\366\314v\220"
+	.ascii	"\326\316\332\331<\2062\366\201\300\005\b\340\037\336m\336\331"
+	.ascii	"DL/\255\253\275;\023\314*\355KW\033f\247\351\374m]\035\3035\230"
+	.ascii	"\326\324\325\312Y9;G\305\314\253\t\346v\316\360k\353N\247\320"
+	.ascii	"z\261^l\334i\254a\202\"\305\341\267p\267q5)\212\324\225\016\336"
+	.ascii	"\231\\B\345\t\235\355b\327\226\201Vht\245Fp\310\332\272\364\265"
+	.ascii	"\325\"\025KR\353\n\033\005;\227\310\f\221\343b\313\310\016\371"
+	.ascii	"\362\266\320\300**8\272\256Vn\263X\261k\354\307\311\213\2342"
+	.ascii	"\366\031\340\007\027\302\277\300\253\304\203\003\013!?\334\324"
+	.ascii	"n\327\334\210\207S\320\250\354\225[,?\315L\335\\[X\327\353(9"
+	.ascii	"-\332m\332Ocw\324\300[\322\365:Y\347o\231?\315\315\020\267\267"
+	.ascii	"!\347u\200T\251b\313x'i$w"
+	.string	"\270u/\222\003\b\302\262\372\272^\347\30696f\3138\354>e\220f\004\374\013\274\027\311\3414\202I-!\273-c*wqX\232\347o\227\274\264\313Vb\340\036\2438h1\376y\005^\250-\t\240\204lB\262t}\316\027\030\230U\272!\311j\236NH\244\256\025\273U\332\310H2\306\250\253\r\263UH+:\277\234,\013\305B\261_Htl\3415\345\205y\335~\325 i\313\273\256\266\213KJ\224\234\033v\211]b\235\234\3142Hn\2014V@\216/\330&\267NN*S\372\230t\265Lr\214F\214\330$6OxHn\2019fF\2513$\267I*V\\\236\216\276\256v\313V\301\221\001#\354j\265l\226=\202\223wue\211\224im\241RtzVX\267D*\222\020\t\332\226\256v\210\255\342!\210\304\30465e\255\314 \300WG\304\006\271\265\262y\273hr]\357g\253h\330"
+	.ascii	"\333\262U\226\352\036\331\f\257\212`e\205\001B_\220\342$\n\215"
+	.ascii	"\262\035;\254\217'.$\267\300\036M\220J\333\343\326G\016\231."
+	.ascii	"\257$]-\017K\243\371\206\304\n\316\021{\303\336\2609\210\314"
+	.ascii	"\035Hn\2019TX_\362\220\2679l\222$\345eu\2658,\215\306\201\374"
+	.ascii	":\302a\262M\266\311J1e4k\252\354d0\331\032\267Rb\264\f\"\273"
+	.ascii	"\332'K\303I\027\237\021K\303Fe\241{\322\023,\202\021\271\262"
+	.ascii	"P\335w"
+	.string	"\002\362}\331\353j\235:\211\356\260!\206\206\327V\335Z\327\3374-\223e\262Kz\206\037l\234\021v\375M\233E\262Hv\251)\220\177\374\355\241Y\245\333\245\231\346\025e\215\2566\251\362y\t\242Vx#f\217\354\221=\352\331m%\221{\343\353\372\033\254\303C{<\033\343.7\234\264Y\343\355\221\252a5\331\322\325\336\312we\244\317\355f\206\241a%\344{\365\242\344\274\320\0067\326\3656c\002\205\004\250#\"t\212T\231B\310Ah\206fdH\222\244\003s\026@ HD*\027\f\243\257\007\023\300D\312\251\305i\236\006!UD\212DD\024$IA%\315\001p\201>8\233\227\2721\220\262m\312\240'\372+\270o\021^a~\353\036[\234A\320.\nDp(\220\264\210nY\270w\202\341\370\242w\276Q\002\264\206\243\334\233\317\221\363\236\362U\262\\\001,M\033\003^\031\035\220w\n/\237"
+	.ascii	"B\210f}r\265 \231HQ\003\005\225\222\375T\n\217:=|N\355m'n\361"
+	.ascii	"\034\240\234\260\037|\370\231\367&j\rh\330\002\350\270\201\023"
+	.ascii	"\370\333O$\342\377\375U\357D\203Z\347$\301\002\254!UXK\346\314"
+	.ascii	"\250\247\2322\361\377#^@B@\301p\242\304 Q\375T\3645B\370=9\t"
+	.ascii	"\222\306\3237\254\007\t\263\367\312\021{\027\025\345\365\206"
+	.ascii	"!\262\2025E:}{^{"
+	.ascii	"#\224?\022M<\021G4o\341c\216<$\233L\304(\311\364_rmY\301*hD\261"
+	.ascii	"\350\033\316l6r\345\250\316\307z\226F\007\312G\362\245\235\247"
+	.ascii	" \"Q\247\355g\314\177\276\260]\357\f\277\275\256+1\274p\357P"
+	.ascii	"-\216\370^\363\332 #\374\334$\foA\252-u\341S\251$2\204\367\334"
+	.ascii	">\2259\nT\376!'\372"
+	.string	"\035\255\3030\013#\317?\021\277\217\311\225g\224\234|\n\017\270!\211\241\253 7\033\306e\270\026\2353\355\313\t\344\260)\224Y\353\224\020\202x\341\323\357\344\003(\342\374\332w4\034I\264*\322^\355\001\322hEc\301\316\026\266\206q\f\304e\200=\251\320\216 \270rv\205\344\253`<\343\322\227\204\027:qf\350\3507\033\277\321i\300\375\200\001\363\255V\031\357=\2246jrp\225\323#;\021\274<\222\034\021\264\031\231\n\270\203\350\263pq\026\272\313\360T\2418\307s\033\t\005\211\241\373c \246\301V\275\2116'8\226t:\246F$\256q\276\3143N\217\016w\b\001\223\230\374T\231*p\262\200\212\307w\377g\001\003\257\316\353QE\312<k\354m\353\026\200\b\304\234C\351Ui\224\325\314M\245\226\"\240\255~\ns\013\224Gb$\031\345F\035(\344Q\214\304Q~P`A\002\002\305l\362"
+	.string	"\331g\227\211\240P\230\334\031C\260\177\360h4\340912\006/"
+	.string	"\364\270\353\033fb\n(\030?6b\257\233\200\200\005\322\375\255q\224\327\234\030L\377\003\352\021\300\016\212(\247\212\340\266\205\366+\360BV\324\272-\024\345"
+	.ascii	"8\365E\370\223\257\370dN \266\016\312\210\203\245y\325{\023\017"
+	.ascii	"\0200\0238\022\225\334BiU\320\246D\204C\212\374\357\023\034M"
+	.ascii	"t\0276\205\341\016\373\003\275\325\211L\364Q\"\247\325~\016\321"
+	.ascii	"A\036\200\362~\322.ah\313\204\r\277\274\256\232x\022L\275\356"
+	.ascii	"af\201\037k\362\033\237\374\234\213s\361\256\206\307\002[Z\343"
+	.ascii	"i\310\263\215\b\030\225\316\273\b\002\3643P\001\362F\257\304"
+	.ascii	",i\260\007?k\312\370\313\267\266\023\262EgG&\3608\00223\234u"
+	.ascii	"3!x\026B\263\013\213\345A\006\342\354\227\204E\032\362\017H\364"
+	.ascii	";\b\312\034Z\225 \204\237\224n\177\377f==\ty\312\030\332\003"
+	.ascii	"#\306\031{\216Q\177\233\352\035Zu\003\240\013\257d\377\275\322"
+	.ascii	"\200\314\360\336B\276\222\007(\326|&\024\313roI\267M\224\337"
+	.ascii	"\024\217(]\256\252\347\2078\372\256cF\203:\231\307QlPb9\220\036"
+	.string	"\001\312\221\214\362\235\226\356\332o\t\232H*\365b\337\322\345\221\330\233q|\262\333\301\321\347\024\230f&\336\255\231h\005\177M!\374\207\213\004nU\254\262\246\345\236\205\002\003N=\026px\017\031\301n$\254R\321C\374\217\022\026\210\313\224\341\230\337\233\307fj\r\234\351\3451\023`\216C\207>\036\371\357\025~\370S\212\032\260\232\264\027\301\372N\224Z\031S\200\006\315\357\216e4\204\200|\027%0$\261j\351\022\226\020\310\t*tIVD\357W\327\235\334\326\324\334\245\301\r\337X\343@[\223\202$>\036\262!\230c^Q\355\374c\001\372\300I\250\317\330\305\r\024\330\245aj\235\262\3147\260\027\224\230\2419\0245\376\221\006^\340\020I\322b\200S\3523<\262\002`8Ri\363\327k\326k\262A\215\035\337\004\251\025\244}\316\024vOD\231\031O\022\036\n\236\312U\271\002\262\210\304O5\022,\022"
+	.string	"\261\204`\330\277@C$V\2248$>X$9\320H\001\035/\240"
+	.ascii	"\215\240\350R\310\032\272\342\350\350\006\254\2650\327\370\252"
+	.ascii	"\254;\003\002\211\013\205|\021<NDo\034\322M\256\013E\006\221"
+	.ascii	"\217w\032\365P\244g\003\bA\270)p@\215V\201\214\016>\020\210T"
+	.ascii	"\022\207\035\3667-S"
+	.string	"l\221\021ogc$0\342\n\271\336Lqf\255.0FS|\323/\260\346\306C\027\354\3344\202e\376\264\004Y\376\250$V\323\032\b\212\321\247\f\201\2663\301\304\372\223\3702\016\f\311t\360C\324\274+9\272\rC\372\261Li0\301,\036\365\016\021\230\013*4\360\365~\257A\b8Gz\253\353\031D)>\271\204\331\361x\253\371\246EM\322%\340t\b\225\307\376\006H'a\363\344\236\001\013\377\303\"N\002kL\350A\276\201\251\031\247\242\316fl&U\246\201\027\032\340\212\300\004\327\267\332\232\002\206~V\205!\331\373\003N\030\302\320\2614\274 r\242G\237\004\017s\215\364\377\t\r\272;74obA*B\363[j\347S\344\262y\357\373B\367\301Z\351\301\241\305\025\333\376\375\346\325#L\362<\313'\275\377\243\027,\227\235\365\306\331\255\216M\202\364\317\350\254\304\035\324\310\335\352\205\335:\236\t"
+	.string	"\n\314!\363\\~l'X\334R\027\002\371\200\001\213\274K\365\230\272\222\273\024\024\361;>\273\265)2\210\205\262\020\025\005\265*H\225\017\240\0317\325e\033eX\342\267\026o\002\037\311\313\r\020\252jt\263\003\260\303\240\360\357\216]\032U\314\026+\242Ol9h\317\016\001X\321\301_y\217\323\222\233\317"
+	.string	"\203\240$)\250\315\335\325\006E/AV\311J\361\261\027\272\375\006r\375\215n\261\207k\374i\336\344Xe!,3\305F\025\234\025\001\022\360\nsk\304\300\363\r\261X\342\263\230\276\235\033\251\023h\377"
+	.string	"x\223\257\231\031"
+	.ascii	"\260\342\2709\036\322Q\036\374\035\304\334I\217&\312\340\350"
+	.ascii	"Z/\305\260\353\377{|\260\213\027\275\036i\200\0244\367;\320\376"
+	.ascii	"\031\264\217' \246\322\213\263\307\026\310\235)LJ\373\365\352"
+	.ascii	"\024\033y\342+"
+	.string	"\334\253A\001\371\013l'\237|\230R\353?\344R\346\357\330C\330\230)\262\200\206\272bG\033|\b\277\215\275f|\275\356}\202\355\004\021\370\370\271m\210\257\205\007\r\317\212\n\\\343\325\346\312\t\306\301iK|>\307\374\331\247\215!\252\361F\323\347\2744\323\035#\313\335\240\341Y\025+\323G\021\346\344\267\277\205\267`b\331\217R\213\314\351\233\216\0175\3072\001g\213\202X^/\211\375!\220I/.(FS\326\017\016\335\r\336\267/>\376\3213\314:\216\366\201j\373}\240\271\261\306)\035z\3635\257tx\314'=\232\257\235\345\323\317\245\372\236\346SA\346@\217\247\333\343@\376)9\226\b{\242\030\366\314\350\327O\331\264\324g\327\251\030,?\360\223\254\353S\305\360\254,\217t\355\311\362\367A\245\324\246r\376\231^f\322y\250\3429\036|Ly\307\363\375K-\034\212\245/\t\363]\207\177\347\325"
+	.string	"e\233\302\303\250\231s"
+	.string	"Y\037*\344\321\377cl\036\211\330\356\335\231\302\356\242\361tJ\267\023\371w~%\337\243\025'G-\272\276~\251\275\323\373>\033\347\307U\313I\353e\374\\\230\024x\306/yg\222\275~k\211\023\330\006\311\217\340\t\322{\200\266\310^\251\327`\375\255\364\312\031\357\t_/\006B\216Z\260)\361\214#\246\251\231\016\374\313`\352Y\330\244!>\305"
+	.string	"\007\024\377s\316;\277\256\212\326\247$i?\376\005\034\n\276\365l\210\213\372\267\265\302\371'm\330\311\224\372g\224\247s\3068\330\374m\260W\373'\032g\305\307T&\235m\243K\320\255(\233s\307\225\257\037\017\343\347\254\246\243\307\3562\b,7\f\313\263\374\366\331O+\327\350\347\f\2647\274\237\270\220|"
+	.ascii	"#{\222\177gu\264\310d\236\351\357B\363\213\350a\361\317\220\236"
+	.ascii	"\032\227rC|\224\375\364\037cd_4y\350\300A\343\377\3347m\r/\370"
+	.ascii	"=T\256eg\273hx\342\370{\220?\376\035\277\3224@\362\265\261\301"
+	.ascii	"\346\221\222\257\200/6\243\226\361\305\316/-r\276lxKN\tii\337"
+	.ascii	"\242`\2338\300\220\312\300\322\213\326\303\322[\354\256n\220"
+	.ascii	"\262'\256\331\260b\246o\200\333O\360'\376\357\300\326s)\275C"
+	.ascii	"\357\031\026\356\233\223\013t\232\360\030z`\375\224\231C\252"
+	.ascii	"9\\\367\033>\"\260c\333\302\200\305\342\337\3709\325\260\311"
+	.ascii	"\340Q\315\303#\273\3005f\211\362\350|\026q\364\240#\277\327\017"
+	.ascii	"\177\347;6\006\305]\344\227\345\037z\371V\316\220\222\212\317"
+	.ascii	"\356\256\314Y\210K"
+	.text
+	.section	.gnu.lto_.symtab.607338cdc71157dc,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"pt1FilterXyzInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"pt1FilterXyzApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"biquadFilterXyzUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"biquadFilterXyzInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"biquadNotchTableInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"biquadNotchTableMatches"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"biquadFilterXyzUpdateNotchFromTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"biquadFilterXyzApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"biquadFilterXyzApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"pt1FilterQ15Init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"pt1FilterQ15UpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"pt1FilterQ15ApplyFixed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"pt1FilterQ15Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"biquadFilterQ30Update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"biquadFilterQ30Init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"biquadFilterQ30InitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"biquadFilterQ30UpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"biquadFilterQ30ApplyDF1Fixed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"biquadFilterQ30ApplyFixed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"biquadFilterQ30ApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"biquadFilterQ30Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"laggedMovingAverageQ16Init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"laggedMovingAverageQ16UpdateFixed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"laggedMovingAverageQ16Update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"filterChainInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"filterChainAddPt1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"filterChainAddBiquad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"filterChainAddPt1Q15"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"filterChainAddBiquadQ30"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"filterChainApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.607338cdc71157dc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,717 @@
+	.file	"kalman.c"
+	.section	.gnu.lto_.profile.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"=\004"
+	.string	"\364\0044\001"
+	.string	"\013"
+	.string	"\372\307\243U\b\002"
+	.string	"\002\001\001\304\223\305\274\006(\002"
+	.string	"\002\003\004\002\005\003\240\342\234\212\n\005\006\007\b\264\221\234\354\003\006\t\210\366\316\221\017\n\246\353\305\356\017\024\013\347\345\206\363\017*\003\007\002\007\b\002\t"
+	.string	"\016\240\342\234\212\n"
+	.string	"\030"
+	.string	" \310j\300\302\334"
+	.ascii	"\355\274ph)\227#1\263\001\337\233\rj`\017\363w\317\371\332\204"
+	.ascii	"Y\005\344\300\261\224v\271i\002\b@)>v5p\001\337q_\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375 \324\235\002"
+	.string	"\304\002\310"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\003\001"
+	.string	"\001\001"
+	.string	"\b\001"
+	.string	"\020"
+	.string	"\007\001\001\001\200\f"
+	.string	""
+	.string	"\t\n\003"
+	.string	""
+	.string	""
+	.string	"\003\013\002\001\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	"*s"
+	.string	"\002z\002x\361\"\316\002\330\022\204\202\333:\021\004"
+	.string	"\024\006"
+	.string	"_\242\206\311\231\0016\001\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`\336\001\r\n"
+	.string	"\302\215+/`k\222\0163\037\243\232\351\037D\271\207\f\035\340,l\204 \034\320 0\232\217/5\250kP\254\230\263"
+	.string	"x\320<\262\377\267t\240F\266\334)\233D\ns\027\034\215\306$\203\243\3318\350\210\370\340HX\032\244r\235\031.CvZgc\265\316i\232\024\202-\320\221\2535\004\315\365\232\n\226i+=\002S\236\270e\356\210\275\003\276\006n\332\016\034\3216R\230\310\021\243m\345\201\022! \036\bC\223\347\257"
+	.string	"\376r\023m\r\370\347@\212\026\242\300\236\302\334/Y\320z\201sZ\242\257\330\266k\375\021\315~\243\315\357\302\212\266\222\177\246EA\250\361H\351\224Q\230Bac\016P\002q\250l\036\021"
+	.ascii	"5\205\240U\nZ\222\326;\313\230/T\265\241\213\005\025\305\021"
+	.ascii	"\222g%\355*\315\211\220y\306\372\363Gi\026,1-\022\336\006\332"
+	.ascii	"\357\246\307N\342\342.\370o\234\361\f\334\244\330$\027\025\030"
+	.ascii	"b\333w\342\206\313\020\324}*\026<+@p\347\333\227\325(\357\245"
+	.ascii	"X5?4\3552\312\355\263Lh*\266K=wGt\211u\251\307\341\372\227N\244"
+	.ascii	"q'\\\225\340\024i\023\253dn%\035\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`X\003\005\f"
+	.string	"\006\22032@\305&\351\377\360%\217\344\320\306\200N"
+	.string	"\274H\312\226\206ax\200\037(\201;\243\360=2\347\327\314\346T2Y\022\266\034h\242i\310v\266%D&\031\""
+	.string	"%"
+	.string	","
+	.string	"\357\271N\211b\252.\344\231\314D\271\222+\\\262u}\370\372LF\027\334\303:\326v\033\301\227\026.\210\035O\307\330\302\216\251r[\324\tT-i\3151\340\347\370\215)\312p5\267*\326\\W\3234\333'\256m\317\005&Q4\362Ed\ny\220I.I\210\242\005Z\352\264\302\246"
+	.string	"\022+AkH\344\300\205$Y \374\004 \205u\305=\376\340\360\f\006l?\271m\225\233\203\005\203P\207\303\006ulc\307\2606\207_\261\331\326f\206\310\217Xe\357_8\350L\250\341h\305HFbPX\332\f\240\002\021\252\"z\022"
+	.string	"\202a\210\tA\204$\022\220\t(\230`B\232\260\260\264\r\306\230'\230\261\037\355\003 Qc>\202\266\204\220%\200\305)\371,\244O2M\026\303\302\214\312\nL`n\210\326\372\372\270\035\266\\\372\325*DJ\311\230!z\274\237\032[\206\267\002\020\343\246\302\020\207\"\037*\227\313p"
+	.ascii	"\374\231\363\251g#\"\251\017v\206I\3636i\272v\307\250@\034\222"
+	.ascii	"\253e!\233\201=6/\016\001\024\022\221\201\034\222\332e\321\211"
+	.ascii	"\206+\032\277O`\334F\b\037\247\231\337\340JQ\017Mf%\205'"
+	.text
+	.section	.gnu.lto_.pureconst.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\232\004\001\232\004\b\230\004\n\232\004\013\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\305\004"
+	.string	"\202\007\030\"\240)\303\001s!P\rEO`\320\3541\207\342\325>"
+	.string	"\313\341\304]\373\345\333\034l\243\021BdJ\0016\034\020\306\263b\233\330\0139\004'\360\351\351i\271Rk\351\321@\"6\024XP\"\322D\367\303<\332Fkt\303\266\260w,\031IR\261Zk\312\265Z\272\023\332\016\366e>\002TL\025"
+	.ascii	"z\013&\t3\020Na$\364P\227\251{XC\004\026\260\211\021\020Vh\200"
+	.ascii	"\231\244\305\315Mw\243\342\363\304\340G\bfU03\013\227y\333K&"
+	.ascii	"\003(\002"
+	.text
+	.section	.gnu.lto_.lto.a3a4d632c76e81c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_init_kalman.98.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`J\001\335\f"
+	.string	"\326WUA \2574c\244P\273\2336?wh\f\356f\330\374qE\3416\364g-\362\215+\304?\357\207Hg\265\013\b\242n\367\036\177\273@\001A`"
+	.string	"\t'F\356*#\004\212\305\341&T\212D6)S\n@"
+	.string	"="
+	.string	"F"
+	.ascii	"-.\241\331\305\304\003~Q\213\314\357uT"
+	.string	"\301\344Y\317\005$\317\311\033\222g\265\366\205\001\f\235\230\f'\300\377\226L\261\346\250\325\2061\247C\t9j@\370\337\330\241lp\245\333r\264m\320\332E\215\334\312I\f[/\024%\210\326\233\377\257\024\225\362\213=\355b\313\030\353\252\342@\200\305\257!\224\361\321\234\t\321\326U\333\350\331\204\346\227~\345\374*hd\376w\224\301\344\231`\343\330:a-\333\021\307\364\233\376;\250QT \001\320B\305D\362\364\214.\306\366\231\363P\363\341}\020\2064\027\376\215cJ\313\271R\303\215\230Q\200\273BZ`J\266\024,Dw5\214#t\030q2\324\2167$))\031#\316>JD@$H\375x\200<\227\210'\304\002a\327\205},\020\210\347\262>\031\211\345q\240\330\204\217\314*\301\260\314\252\274{s)\352$1\332\344\311c\210gTX`P\227?\020\024\361?@\2139\005\202\024\026p\213\001\034"
+	.string	"2\241\231/0.\f\204\003\233\201\314\001\325"
+	.ascii	"\021\260/\310FV\025\203\2431\3345\203\240;\372N\262v\247f\207"
+	.ascii	"\n3\271\320\001\240Z\273\013\253\270\260d\f\363\002\201\301\025"
+	.ascii	"ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_kalman_init.99.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`B\006\345\033"
+	.string	"\306\256\243F\240ZQ:\274\177=Mz\035IR^|6&\375\267W\353<\323+\rw\234\240\341\272\277\307\332w\355\267\r9\022\256U<\177\250\340\273\374\b9\215WONp\374\2362\261A='\301=\335\367-!D\312\224\002\201"
+	.string	"\215"
+	.string	"\226"
+	.string	"j\241U\007\255\032HT\363\210\352\227\252]\253&U=\256ZT\365\256ZU\375\004,rM\004l\315\031cXgj\215T\210\330>\020\302\323\257(\313\223\334\267\342=\217T\2749g\317G{\205\335\363q{\\\332k\b\264\360\341\222c\022\234s\3026\352\345Gq\265\364]\023xt;\332G\247\213"
+	.string	"vN\337\237\335M\034\232s\376\352\352bgSuM\230sZu\273\0317y\333\031l\023\331\344U>\367\026\222\301\375.J[\316E\303\006%\237[\r\351\343\320A\257\363}\037\237\264pK\363W\327\001\216\215=<K\3545\347\255\310\277r,K B\204 ?~UPY\371>\345U\250\350m\205\374H\204\204\347\340R\242\020M\005\263l+\002\333\r\016\305Y?f\346\234\021|'\177\"\302\227\372\350\0212\031\371q\301\024/X\373\214\364\227\234\211\211\241K\371D\n\275.\005\371Q\265\004u\364\336"
+	.ascii	"uh\377l\272P\366\305\271>\354\r{\240\223T\206\302\320\030\021"
+	.ascii	"\310\025\322\027J\252S\027K\200\300q\311\013\232S\334Xe\345\333"
+	.ascii	"2\322\233-\315\221\322\204:\313\374?#\375\216\235\240\375\317"
+	.ascii	"I\247#\374\034\003\377rq\203\356\345r\340<\316\202\337oW\304"
+	.ascii	"p7mv\177u\rR\t}S\215\276F\215\024\217\r\200\243\2439\023\f\026"
+	.ascii	"\231s\376\334g\244\223\031s \212\027\004\332\373\234t1\316\n"
+	.ascii	"P\344\203y\030%;:7\307\341\330\3321-a8\324r\233\263\206@\027"
+	.ascii	"h\307\251-\234\021\233\016=@\003^z\300\024\223\221\210\215\200"
+	.ascii	"1\315d\262\331\022\214IDL\006[j:\001{P\300\263\022 \232`(f\263"
+	.ascii	"&X\317\257vq\256\017\230\226\220Mmm#\354<\253B\202\360\354\332"
+	.ascii	"(#*\320\3674\252\254\372\025 P\372\243<\202\244\254\252\"?\276"
+	.ascii	"\366/\255\310\367\264G\211\365\232\263\266Cy\224We\222\022K\257"
+	.ascii	"+\261H\n\025\206rK\263k_\2736\260\344\356\324t\316I\333\205\022"
+	.ascii	"\347c\244k?(\351r\3239\266-h\016\034\256!=\241\221\336x:\322"
+	.ascii	"\032N@#)\215\031B\001{\250A@\246\225BB2\212\222$Ic\360\002\021"
+	.ascii	"\261\215\016\021\300 \223\3140\301\211QR\032\306\003\324]\271"
+	.ascii	"\214\177\225w\322\310LR\225\021\230L\222V$\326\355j\344\364\007"
+	.ascii	"\213\254\243{\027\005\202\345&\3104t\021(\265\027m\242a\303\214"
+	.ascii	"-\317\007\026\251\347\244\356P\235y\375\365d~\277;F\315q\230"
+	.ascii	"y\262GVa\0166u<\341\360M\247\245\351\346\305\256Q.\243\201\322"
+	.ascii	"\034=~\021 Q[\227\201\240\346}B=+h\204\fV5\210\350\003$\310a"
+	.ascii	"\005\004@\363\261Xgi1\216)\006\220\241\353\331i\361Xz\261\371"
+	.ascii	"\255\005\374C\264\366\313\236\005\033\301\341\037R\031\333n>"
+	.ascii	"B\304\232;l=\332\037>\217D\271\376\315\230\220\017\255\371\352"
+	.ascii	"\316@H\377{x*\034\302D\3027p\340\347\006\002\244\314\363\355"
+	.ascii	"`l\266\"\253\001"
+	.text
+	.section	.gnu.lto_update_kalman_covariance.100.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`\335\006E#"
+	.string	"\266\377\334F\220\234M:\254\305:\305<\f"
+	.string	"\021\277\005-C\021\303\032\223UW\221\220\022\300\340"
+	.string	"\bD\352Di\334\360;_\2654M\265\213\330q"
+	.string	"\277d\303\202m-_'hH5\263c\305\362\265\312(\032\322\b\331r\247\024\307"
+	.string	"\266"
+	.string	"\313"
+	.string	"`S\377\362.\273\346\246sy\204W\255\311\256}$\217u\255s\271\027\327\272\354\350\260u\243\b\212@\025\376\246\236h\310\272\021<\002\344Byu-N\337b\257\362\211\207\020pM\225\234Zk\204\217\256P~,\242\237\366\257\334\312\351XL\274\255V$\304b\255W\023\f\241\374\350\253\007\221\037\313\003\221\037\355d\303\371\325\222z,a\224\226Y\255\025\267J\356\364\222F\216t\247\223\357\345s(\206E\3065|zi3\322c\352\264\253\3411U\214\232dp\370\343#\220\210c\322[\240R\3255%\212k\350\343K{br\b\030BQ\fRJ\314\336\365)\034\376\346\244e\250\265z\006\207=n\237\333\366a\273\206Mj\005\037\343\035-Ac\027J\363\301\001{\003\016\371\231"
+	.string	"\366\\7\303+k\365=\350\223y\031\235\337\344\243w\274\371 \217\234Ac>\350\271\025d\f\307>\331W\277\271I\354\323\272H\354\006\f\026|\313mD\247\025\320\351\004t\272\210N\337\036v\023\321\351\002\017s\017\321i\241\177\335A\317\272\201\276u\333\336\345\036p,?"
+	.ascii	":\375C\247}\350tI\247it\232\244\323#\235\246tz\351\364\244\323"
+	.ascii	"w@\236I3DV\353\2163=ul\374r\362\260?\314\377\365o\371\263\376"
+	.ascii	"\255\277\313i\366\305\204\200\005y\002\306\265/{\275\366\250"
+	.ascii	"s\254\316\021*\020e1L\f\361\001tm\017\323g\257\003e\265V\n\266"
+	.ascii	"%\314"
+	.string	"\247\017\006\226\324Z-\234\315\n\"\304\210\021ZA:F\273K\367\300(\276\236\357\261\227\337\304H&\232H~\334\035#E\244\312j\3127\317h\320\234\353w\2318A>\250`\021H\221YI\025\221\003\265fm\262h\331Mb\024\266\247\321\334w\335F \b\221\t\025\326\0324P3\217\013\354w\356\004\241\035\260\337{9=\003\344\fX\365\233g&\332\333\024\363;v\210\366bU\206\266\300\303Ng\316\320\036\214J\320\n\255\2047@3\337<\263m\372*\310\207\371\033\336\314*s\223K\232\017\006\355\301\334\366fk\312\274\301\310s\275\214\fho@)\022\330\254\261\355\r\b%\300\214\360s\005~q\364\202)\247S\241\353\345p-X\320\210\221\264\344\001'\002i\003\016\311\003\022\b\r+\224b\340\216\036\324P1{\271\0225\232h/W\302\006e\352)\321\340\315 sL\271\r-\230r$v\275&\027"
+	.ascii	"\234t\264\224\323\305\310\301\300-\355t\272]\022nI)\247\303%"
+	.ascii	"\365f\340\216\210\274\223\321\242\207c\332\355z\270\332\225\357"
+	.ascii	"\213\204,\322\212\226\301\n9\240\031\363\355\317?Ro3u\b\031\354"
+	.ascii	"\356\217\330\257\364Y\277X\264/\322\350\374\375\3041\301.\360"
+	.ascii	"\331\027\313\365\271-\320\226\233\202*\016-\307\204\031\005\\"
+	.ascii	"\260\273\264\bC0,\262\255(?\222\\\237\230`\016\221\"\263\032"
+	.ascii	"\0337\211\227\254\302\246\275\312\340X)k\263c\025\254\321\n\361"
+	.ascii	"\234\334\023o;.i\333qSP\211\001\253\002~\250A<\346\230Bdhdd\202"
+	.ascii	"\2224I\007\340\002\021\251\261m\021P!d\312\f\rMKm\305\030\r\220"
+	.ascii	"\252\366\001_Q\375B\277\276yA\033\017uq\251t~f\220\225+c\372"
+	.ascii	"K\356\257O\244\333}\214\210w\007\311\256\216\320}\021m\347\001"
+	.ascii	"\200\274\340\273~\261\356;\370\307\032Z\316^_sHxXn)x2\035\375"
+	.ascii	"t#\264\206\274\210\345C\3540'I\006\241_Vq\307o\357\351\022&V"
+	.ascii	"vR=\314\027s^\262\234\375\213U\351\021y&t\356\0263\307\303\221"
+	.ascii	"F\205\230\353\2449f?\b\373J:z\264 \223\226lMtR\374A\002\216\022"
+	.ascii	"%\270\242}\207\377\bZ\213\307m\016\364S\031\317\215R\2462F\224"
+	.ascii	"q\267qu\202\237L\327\344c\350 |\330\253M\262gq>\033\023\364\246"
+	.ascii	"\304\230,`\023l\225\257\303\365H\330\346\2377\315\360\017"
+	.text
+	.section	.gnu.lto_kalman_process.101.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`\273\003\315\027"
+	.string	"&+\225J\260\226Q:\266c8\016\256g\305\241\213]\310\334\341Q\2148\306\304cE\251\037\361L\352?b="
+	.string	"\204\264m[Z\f[\212\275}}A\317\306\006<;{\241\374\322\211\251\332h6\364\320\330\017\330\336\305\257\366I#dK)S}"
+	.string	"t"
+	.string	"\207"
+	.string	"'\314\217Y{\"\t\017B\222\016lx\007\343\206\374\353\376\325\317\342'u\325 \236\206\005\314\253\364\363\251Zm\020i\252\265\306|f\371\337\337\246\320\255\331\263\257Z\213\230\232j5cn`\334\360\346\370\377{b\223t\377IM\243\236\310C\312\260\344\244\326:\203\331"
+	.string	"\342\206t\001\210\033v\210\325-\353\276\273\264t\007\021\020H\310g\031\325\240\326z\006\022\352\260\357\375O\340?\204\237>\b\027\306^\217\270\341v\201\rGJ\024\277\035\007\177\323\207\033\304\277\264v\321e\313\264\177a~l\201{\227U\332\205-\213\335\2265wY\230\277\302\374\027\363]\314o1_\205\371,\346\2470\177\305|\025\363S\314\037\231\217b\276\310\374\220\371\224\371\315|f\376\302\264~\224C\037Lt\020\263r\bB\251=\302\031#\226i\027\370\302U\2030\234M\333\342\353\002\370\345\330b\247Z|\"\217x\267\2751v\202!\277]\316\326@uJH\311\223\237\330\277\316\322"
+	.string	"\"\353X\213\275K\313DNd\371\322\262V\340\304 \030\214\002\353\227\336\027\313\275'\227\216\265"
+	.ascii	"\035\244\223\335\271\247?\265\356\006\204\355\3221\032\344\021"
+	.ascii	"\254[:\354u\261\264\204O\221\025AZ\370h\313`1\302\031:\201\222"
+	.ascii	"to\323f d\311\343\340\271\267\273\351\023\351\343\355\354\311"
+	.ascii	"=#\342\0266\306\317\261\326:\363\205!!<\0238WC\001G\313\211\271"
+	.ascii	"\035\034\233MX\223\243\345\"\254N#c\243\325*\320nf\266[\255v"
+	.ascii	"\243\231\331"
+	.string	"lh\265\031\rNg&#\373\r\247\0067\313\335n\270\331\312\254K\267\213\\\r\003\"\351\261k\336W\372\317Y\037\257V\365J\207K\310#~5O\331\204\364\271\232\307\266\232\266K\245Y\335j\272\204<\202\265J\357\2574B\372X\375\337\254\216\224V5\013\307\252U\235R\362j\233c\325\bT0AJ5\252UM\235\310E\250q(\306\020S\212\214I \"\246$i\f\200\002\021AV\036\021\240\2714#\201H\230\250`\2469)\256\344\242L\224~#\334\032\305\3547LV\013\3559\"\3031x*\0271\326\301\245\232\362%3'+5\304`\030\263l\035\250\026\342\"\250\210\004\342\231\301Vdk\301u}\260l\335\347y\017\235\037\0051p\242\034\347,+\214<i\356\200\322\261\2279\226\347\035\252\265\207K\304\276\301P\n\342\017\364\202\362\026\0235.\271\017\313a^\316\267\023\212i|\205l\250\320)"
+	.ascii	"\222\341I\240\232\354\367\007"
+	.text
+	.section	.gnu.lto_kalman_update.102.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`U\006\035 "
+	.string	"\306\366\276G\240VN:\244\327\004\263\310\001\217\354\023#\220\376\275B\241\216\255(1m\376\236\322.\377\344\205\241y\321-\336-x\272c\017\371\272\364\0368\301\025q\334\336\013~p\373\303\213B\315\017z(\351X[\263\204l)S\n\246"
+	.string	"\226"
+	.string	"\261"
+	.ascii	"\366\037f\335\275\376\325;\030\212\333,\273Ae]\245\3159\177."
+	.ascii	"\232\301\355\242\215\006\225$\270\332\357q\037\275w\231\3547"
+	.ascii	"sb\361(\2333\bd\237\333E\007\2773^\274=g\274\350\236\235\345"
+	.ascii	"A\255\371\2570Pa^\346\234\273\265\361\336s\270\233m\024\345j"
+	.ascii	"\317\177\330q? \323sV\307Y\365\344\220\222\241\267\036\032SU"
+	.ascii	"\267\035\212T\025\224\2161.J\237\253%T4\300'\271\363\244\306"
+	.ascii	"\225\024"
+	.string	"*\251\276\322'\255H\027\032\240\223\334qq\343\367\260k\024\260I\325\366`\316i\375\001\247n\335m\353\260\355\300\036;\004'\3621!\177\353\242\207\210\210\260\374\324|:\264\214\376\334.\032\241\377\351\362\004\031\2369-\323\265\326\322\312\326'\306\357\200\257*N\272f?\310\205\030\025\370\226y%\364\277\022\343\305\3572\r\271\252\274th\007\231t\263\354\313\271X\366\301\356\237\007\377\003\357\372{F\265\216T\347H5\216T\337\214j\033\251\256\021\3254R=#\3252R\255\223\352\234T\343\244\372&\3256\251\036\245Z\224j)\325+\325\272\352\007\345\314\236\020\3202\247\213a\230y&\232\3418\330\037T\306|(\301\337\362\004\n\372\037\205\361\"\315\212^d\\U3\353w\321\255\f\230\265/3]n2\\\266\350V\234\032\343\312\255o\345\266\2704-YrV$\216\n\332\355\213\231mwX8\203v1?\265"
+	.string	"*\356\270\007\362)\027|\377I\301\300@\013\312\243d\320\260a\003\007\017\372\237m\013<-\223}'\275\036\026\336\266|\223\215\027\307}\224\025\023\013oK\304\025\247\210p\231\341h\317\332\037@\350\177V\261\031r\263\206\\\211\250\026\346\205\213\334#O\202D\357#\243\\\036\261\027\013t\263\"\bvy\304\200\272\266\021\234\314B\035\2649g\003\007GEB\",\210JKHJK\274Qi\t\351\250H\364P\320\221\220\021\t\241\021\273#\236\221\021ohwT$d\264\033J2\261\013\022`\036\022Q\322N\211\307K\332\351\202\363r.\226+\0309\363mSNg\025(\225\263:;r\3266%\312\n\007\243\306\355g\265\005\013\005T\252l\233e\235\247Y"
+	.string	"TC\234\375\331cyj\342\023~\315:Ns\372\f\334,\316\216cO9\232t\350CWX\270\323\232s.P\025\030\200\320\024\352fuP\204\\]>\035\2166\232\002E\020\232\265I\235z? D\210\360S\253Y\233\035\231<5\361\351\260fmL~\343wu&\006]\302H\263!\276\002\200\210\250\201D\347\024C\"\"\023\024$)H\322\001\300\002\021\231\252z\021@\265C\f\021\025\327\0163\255\262\301S\333\263\177\355\004A\300\257\207\237\251D\017Q\320\341T\345\ry\375j\300A8PX\374u\302\013R3;\304\321+"
+	.string	"\"A+e6\374\2155\002\212\357\251\205\316\214\"\224\r\001~\025p\211\325,\367S\013"
+	.string	"|\273\356\336\340\366\235\342L\212\257sF=\r\213\362\247\257\367\333\336L\314v\343\235\361D\261A3\206P\222)E\177\344D*\346\\\035N>+6\355&\004\023\254\213v\266\362kU\"Y\304\216\004\032}\2323|:&\356\322\245\013\2357\371\227\357\327\374q\016Z\205\356-(\330PS\232"
+	.ascii	"\231\3619\306\351\317\360\007v\210\215\353p\223_\325m\367\220"
+	.ascii	"G\0172T><;j\006\351\304\256\fY\210^\325\353\274\034>\007W!\363"
+	.ascii	"\223\206\242\321\365\317Jd~\223\023\007\375\256\260Ly\204\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`\233\001\025\t"
+	.string	"\"\r15@s\322\030?\256\357\370\324\037\020\352\264{\214\210<\311B\002\204o;\0260\214\304c\230[0G\001\303e\b\324\313\037\355}\362\031\004\376\273\301M\2104\271e\n\303\216\245\321\201Z}<\250\271\2456\312\334\2609\205\030@\365h\320*\245\326\230:<\006\236V\332\246]O3\033\211\b\236\206\n\236^\245+KL \025Z\271\245\212<\253\305>S\261\277P\3540\023{\214\304.\023\261\273d\214\361?7\241\235%!\026y\230\206\372/\034>\201\366\025\367\331U\334X\303#\024\211a\337\234F\200O\340%\001\223,l\312\fS\330\204\372A\t\267P\b{\nF\344\370}\020Rrb\214\361`Gq\277\313\b, \320\002\301Z\007l\341\033o\350\322\241\355\202\253\244r\265\337\315\274[0C/\254\026\341A\b\206\366\326\b\017\372f\366n\225\354\360\007w\235\203\004H"
+	.ascii	"IA\362\003]\323Rp\022\ff\3708n~\315\377\367\214\240\301\336\005"
+	.ascii	"\321Z\312\205\221\317\r\270Q\313\320A\035\315\262\020\307"
+	.text
+	.section	.gnu.lto_.refs.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375 \337\215\004"
+	.string	"\362\314 !\2205I\007\377\377\377\377\377\377\377\377\377"
+	.string	"\241\205\361m4\374\350\361\375!\266\241\326\332\226dK\231\002op\366rv\243\3178[A\370D9\202\376P^\240?\345\n}\302\215\320.\332f\305\360bH>)~\024oqS\234\212\263\370\212\210rA\361\345\340Kq\002\363\215nF\367\242{\240[Q\2360/\320\215\350\016\350>t\027\312\217yB\267\322\r\320\235t\037\3455oh\023m\322\036\267\305\177\020\003"
+	.ascii	"\033\023M\"\204G\226\005)"
+	.text
+	.section	.gnu.lto_.decls.a3a4d632c76e81c,"e",@progbits
+	.string	"(\265/\375`\033$\005\244"
+	.string	"\212\fq;Z0JQI\035j\006\3026\nd\244I\340\301\330\016\305\273^\250\300Q8&\017\3201\3700\227^\006\302.\025oy\311f\315\374\371\214.\t\263\322a\277=Q\266\273\373\267\355\257\241*\034H\332\"E\333*\266&hL\347\321E\321\026\265\250\304\316I\327\203Br7)SJ\001C\003\226\003\304\003\177\343e\364G=\n\375\237l"
+	.ascii	"\323\rj\213\353\255\351\006\025U\372`\376x\024\217Du\006\315"
+	.ascii	"9\377\274\223C\2170\267D\035\232cl\346d\004\222nP[j\\\034j\233"
+	.ascii	"dXI\210\223\025\277\322\314N\"\262\033\324\026\0070<-\247\270"
+	.ascii	"\223\221\254\364`\306=R\216q'\037\221\326Zx\232?\225\271\330"
+	.ascii	"e\203\035^\276\224\221\271AE_\t\210\203\277\361HO\263M\246\216"
+	.ascii	"\b\025\0324\347\346Z\377\r\027\343P\177\326\310\306\"\210 K7"
+	.ascii	"\250h\316M\236\013t\206|\341:\341\301\265I\317\220\002\345\226"
+	.ascii	"\340\316\025\301\235\263\201;\007\003wN\t\363\270\341\276Tp\317"
+	.ascii	"5\303}\207\340\276Z\270o\025\356\233\304m\305\340\266Up\3330"
+	.ascii	"\334\226\007n{\205\333\302\300 l\022\356\177\303\355\364\f\351"
+	.ascii	"\347/\272S\303\033\335K\r\244\247\277\375\\p\brv\r\251\307\305"
+	.ascii	"\271\206\264\377\t\356\357\302\375,\340\376\027\270\243\257\204"
+	.ascii	"\333\337p\373\023\267\217\341v\0378\003\034\270}\n7\231\277\300"
+	.ascii	"\316\346m\356\264\300\335\332\245\370\226\316\031\233\271\371"
+	.ascii	"Wpa_\177\333\233p\273"
+	.string	"\005\251\215\213s\013\322v%\274\343\031R\016P\317\220:\026\317\342N\n\\\213-z\351\340\234\341q\246\314\337\026\001n\247 \3658\247 \355\0218\203*\026\340c\022#\\\177\237@\230` \035m\212{\365\330/'\370)]\244\242\177o\034C\352R~\332\3210\244Ie3\353X2&If\376\276G9\323\371`B\345\374\353g\357O\034J\373\231;i \016\372\346\230\271rn\372\331\315\331\350^A\216{\005\271%#0~\245\267\213\260\017\347r&\026\251b\231\23597/8\026\023/1\376.\341\311\021\302\206B\355o\017\341v\257\257\025\204\324\b\322\274\001f\203\331u\205\304\315\234\314\225x\231'q1w\372\230\207\265\027q#}\2339\0375\350\376\031\322c949;I\201\231sn\347\002\342A|\314\217\364\230?\235\371D\327\002\316T\260\305Es\316\027\360\\p\301M\022\232\221\354\334~"
+	.string	"\366\r\037p;\221\236`*s\320\022\340\336\301\235\203\373\006w\r\356\247gH\033\343~\314\3013\244\3271\244;M\317\220b\307\220\266\226/@\267\267\360\004\350\366\253\247\340\3737\360\264\001\272m\222\262\356\036\323\"\372\001\274"
+	.string	"\272\377\246\333\335^C\267\277=O\267\233\371\t>"
+	.ascii	"\335\036\355\r\335\326\003\335\376\354\366\342\353L|\372\271"
+	.ascii	"nG@\2673\240\333\025\320^\200\277O\336v7\t\t\350\236n\373\323"
+	.ascii	"\335G\272\233\254\273\315\272\033\t\223\377\266\351\266\035\272"
+	.ascii	"\337\273\035\256\333\301t;\264\333\325\272\235J\2677\351v!\335"
+	.ascii	"\336\325\355A\272\375G\267ku;\216n\277\321\355R\335\036\325\355"
+	.ascii	"1\272]\331\355"
+	.string	"-\272\375\273\375\203n\237@wO\351\366\024\335\216\242\333\227\272]\251\273\227t\373\261\333\215\335>\324\355 \350n\021\272\035\204n\247@\267{\320\355!\272=\002\335M\245\273\237L\272;\204\356\356\320\335P\272;\215\213\213\213\353~\262\356\364\002\335\003p\013`h\274\0051\036E\3766\216\201;\315\306d\316yE\256\231\223H7\3559\367\236n\034\267n\200\356\276\331\222\320\314F\260+oX\307\230QFs\310\235{\346|\234*J`\352\3518\365\002\t6\225\213G\034\305\013\311<UD\202\345|!\037\217E\017\226\371\002\022,?\345\023U\236<7\247\212\371\270\314\027\3621\0339 \217SOH0\343\323\005$\330\324S\006\233\312;\371hL.\035s\362B\006\233\352\222\301\226O;H\260\345\023\022l*\005\037\2634\005\365\024w\205\352\214\227!\217\271\211)\312\230\334y\"\233\313\234\226\263;\223r\322"
+	.string	"9G-\223i\306\027N\206\364lB:b\\z3\347\254\201\t\211j\231\217Od\3262\347,$_f\332\240\330|f\033\376,\322\210\312*\222r\026"
+	.ascii	"S\316E\317\317\234s1\347\254KF5s\216\261\203d21\345\254\344a"
+	.ascii	"\312Q\305\262\244\234\337\271F\366\204\004\243Z\376\224\r\001"
+	.ascii	"cf\245f\321\2319m*\211\301\212]YE\316\331\277`\346\023\013/\177"
+	.ascii	"\23796JcTF\3766m\310\244\302\240\376\332%\247\361\242)\231f\225"
+	.ascii	"tE\254-%QlR\333\243\323\036\377\213\006y\263x@u/`\264\360\032"
+	.ascii	"\002\347\316\207\263F\032\344%\003\002\315\311d\207\266\306\356"
+	.ascii	"?\363qG\253\"a2\376\332\374\323\266\250\263B\302%\307_\233\270"
+	.ascii	"f\366\f)Ov\fi\353x\030iw\276\221/\363A3\027!\320#I+\232\223\312"
+	.ascii	"\0168\r\231\026\345/\231&JH\214W\270\035\f\025\267)c\240/\026"
+	.ascii	"\346\327\336m\003\022\022\004+Kb\376\355\275|\364\273\374\230"
+	.ascii	"\377\362`\334\371a^\255\377\310#i\036+\237\346O\247\007flP+e"
+	.ascii	"p\3200_\245\355\303<\332KqB\006\372a\376\351L\255h\316G\363Y"
+	.ascii	"&\301\335\362\\@$%iP|!\241\337\346\316wk\236f\316N\267gk\261"
+	.ascii	"\rH\310\017\310\342.\320pA\216iJ\223Rz[g\203\013R\025\226\230"
+	.ascii	"\017*\334\272(\334\272\246\327\202\003%b\206\364\267uF\374W\036"
+	.ascii	"\213;?K_\257e\006\313\271\211c\215.\244\214\365\244:\336\223"
+	.ascii	"v\n\207;\365\202;\335\202;\255\202;\215\202;U\022EGiV$\362\267"
+	.ascii	"S!\330\3117\371\263\177\342\316\207\362K\372\307\236\254o\022"
+	.ascii	"\177\372\323y\265\320\240P^\211\004\270\244@\231\370\323\230"
+	.ascii	"\366P\336\314\2379\307f.\246[\240_\262\242\327\f\ne_jn\247*\340"
+	.ascii	"N\225\270S\027\270\323'\334i\023\356T\t\177\317\3231\244i3\r"
+	.ascii	"\016w\177\221\260\021J%\220\277\375aH\276\314\331\231\303B\310"
+	.ascii	"V\214\277O\344\247\337\351\200+\032=\376\332!\032t;\312R\260"
+	.ascii	"\022B\201N\323\005\023\215\007\373\257\333\005\352D\217\377\352"
+	.ascii	"\376\256\367r&5R\307\031I\177sK%\337\374\033wL[q\306\337\346"
+	.ascii	"\300\307D\231.\272\177\376\005\327\317\307\340\301\3642f\332"
+	.ascii	"\230kN\306\215\351plP&\250W\227\247\033T\364\217'\324~\250p\302"
+	.ascii	"\364\3623\\X@\005ar}\322\024\350\226\024O\240OaL0+\234\3145\017"
+	.ascii	"S\246\311\241_bP\007\263\004\005\332\3754\276\352\267~\371+<"
+	.ascii	"\013/\365V\037\344}<\327\367\370\026~\352w\274\216O\341G\360"
+	.ascii	"5>\307k=\217\307\361*\374\325c=\363\263~\306\003y\033O\365?\334"
+	.ascii	"\031dY\234j(}\031\335\22573$IT,\214\263\035\306\023(\220Kk@\356"
+	.ascii	"Q\305R\224\270\213\324$\347\031$\316\306\337\270\270[t5,\253"
+	.ascii	"\3442\223=\375\355[\034+\362#\316\311\0251b,\034\017\316?\276"
+	.ascii	"\230\240:+.%13m\341\332\376\312\310\2142v\nt+G\0232\351[\331"
+	.ascii	"\026\032\2311-N \371\333c6\332\265s\263\366\206\304\211\206\333"
+	.ascii	"F\314K\267\027\013\306w\232HV\234\230\326\b\214\256\025\336\332"
+	.ascii	"\202\2714\316\222S\177\355\027\333\326N-G\242\275\344\266(\363"
+	.ascii	"!\245\307\226-\026\272AG\316\205\2259\031\343\326\026:V\263U"
+	.ascii	"\305\311\353\257\345b\333h\330\242h\tic\243\311\322\202\001\327"
+	.ascii	"l\221\237\260`\221\026\332\025\303\206\206\225\266Z\254X\265"
+	.ascii	"\207z3+\227\305. \222\214\331\341$\232\221Q=\271\2533 -\322\332"
+	.ascii	"\252\215\021Y\243\222\304fi[D\013\026(^\177-\226\266N\031,\266"
+	.ascii	"d]\251\021\005\315K\033\356\232\264'O,\025\036\254\346\227\254"
+	.ascii	"\236\232%\2463\251g[*9\034;\226\224\376\332(v\212.N\b\024\347"
+	.ascii	"\024\264\032\030LO,258dtA\245\274Z\272\304\005\033\323_\013\345"
+	.ascii	"\323r\326\202\370\200\373k\317\034\032'\026e\t\233M\223\025\250"
+	.ascii	"\320\234\340&\322\326\b\021\333\304f\271\311E\257\354\244\033"
+	.ascii	"{\242\265\"\232\221\312\036\233\256\024]T\314\3326i\313\004\210"
+	.ascii	"\203f\303[ZY\214\177\355\222\316QJ1\203&\261J\272ijtT\201\355"
+	.ascii	"\340\201\033\003\354\345\342\351\351\257-k\266\317bS\321\345"
+	.ascii	"\257%\353%7J-Q\025\354\230E\243\262\202\364\327\036\261H\334"
+	.ascii	"\331P\254X\347\230)\205A\311\201[\004\336PR\033\326\266\210\231"
+	.ascii	"T\325\324\n\316n\032]\221,2\230\177\273\246\nw\215\324\227\375"
+	.ascii	"\262B>\310\306\247\236&E\026\310Ds\322I\007[\346\314J\311\337"
+	.ascii	"\036\013Fslf0\232,_Pp\276\341\246\271\322\345\264]\037\326\271"
+	.ascii	"c\246\261\305\304\301\352!\004\t-H\020O\253Qz\302\241\214\346"
+	.ascii	"\354\244\303\205s\313b\243\007\336j\333c\313\3760\223\244\025"
+	.ascii	"\255y^\205yq\265\375\341\265\242\312\332_\353\243\305.\017/1"
+	.ascii	"Q<n`f\333\034L\253\225\"\361(2C\353I\013m\265\306>pJ\202\365"
+	.ascii	"\327fY\0264(l9\223\377Z\035=\246#\326\225v\205\205\002n;\002"
+	.ascii	"\367+N\277\322c\037d\233&\031o*\254\232\177{\314\257\274\210"
+	.ascii	"<s>\300\215\216\344X\215\345\214\266+\314\2607\374+E\222V\224"
+	.ascii	"&\212\005-\312^\265\275\341S\220bab\030\213\311\222\326\337\266"
+	.ascii	"5\254\215n\232\034\213\256!e\177\233\006\n\267U\341\303\210u"
+	.ascii	"I\372k\255p\022M\322\202\037\262$\"\306Zu?\221wa\253>p\253\244"
+	.ascii	"\326R\370k\251,\215\266Uv\252j\203e\316F"
+	.string	"[\245c&g\243\216{\005\356\025\334\036T,\024Io\323\244\300\215\275\340\243\261\251#F6\265&\325\356\264R\026E\3172\257\330 \tS\331\301&+Z\245\3023*\312\237\026\231=\370\030\322\304M\255\t\356\2661\334icX\025\356\225\235l\264t\261JFs\036\323\301\202\245$;r\274xa\2258\347ls\226\212\302\274UUep4\230\266\312\\\225,\034V\270-\223mj\353\324N\266\005.\346\314\245\b4+\225=8\217\035\243\240\332\266\350\266\233\2347\334`\221q\342\354\257MZ\026\251\031(\n7\026v\005\016\327\031\027Krx\020\311\241\343\257\323>y\030\r\334T\212\270\277\035\355\363\340[yD \370\214 \302\003\037\021 \210\b!D\t?\240\217\207\036\242\321\312[kh\324\340\017\030\374\355\210%xG@\036\016\220\006B\273\035\321\220w\263\252C:+O\b\024\312\371\210F#\350l"
+	.string	"C\210\f@ \257\347[yD>\304\365W\202\217Qp\b\003\022F\301\037\020\203\r>\354>\200 \341\263\022\203\302^Nh\035\236@\314\255\277 \b:\301\337p%\372\250AF\300^\360\3473$\032\371\004"
+	.string	"\b4\n\006\205A\335\272K\217\204C\337*\f\352\204x*\360\256*\221H%J\333\347\341\002$\200 \302gU\207\206\274\225\303\272\003\322\300\204\236\020\030B\035\nC\350\344\332\347\301'\b\3703*A\303\220Q\tj\020\r\016\221\250\366\204\303\242\034\325\304\217\350\267\026\tqk\200\001;\344\371zW\355\005y\277!o\204\260\267SW^P\221\021\017\221\272\022K\210\2700\302\252\022q\373<\364\206\273\236\220OO("
+	.string	"G\252\bk\360',ZU\021\304\037\316\316f\267\376\202?\233\356\375\206jP\035\302\275\301\007\f>\200 \241k\020\035d\320A\006i\203\350\340\347\247\203\017?\270?\374\330U\335\r\177\274\021V^\006\324\241\272\002\177\025\310\300\201\233U\310\203T\022?\241\334\221\220\270\023A\304S\207+\021G\335\251A\302\020l\324 !\321UM\374D\034\tkH\250A\301\337Q*\202J\034\252#\202?\314\363\025\001y\271\241\340/\0304\032\352\326\366y"
+	.string	"\352=qG\024\206@\\y+1'\350A\236Jt\201\210\376H\030\304\363\021\323\265g4\\E\fy#h\332\347\301\2078\024\022\203*\221\270\033\372\t\005\205!n\202C? oWC\302\032T\211\324\021\302\0208\020\t\203j\320NG\250\b\270S\207\274\243\240!\317\267\033\022\205v\276\241\237\017\307\204\317\004 \rv*\321(G%\032\355\204\253\215\t\237\216\t\337\316\317\017\320\316\204\017"
+	.ascii	"@;!!\341j\324[\205\204D\236U%\n\t\tu\216\204@\241\241:\002\003"
+	.ascii	"&\364T_\017\347\202ZTb\335\001\021\211\274\242#!p'A\211\241:"
+	.ascii	"B\330S\207\027tA@\241\217\250\016}\353.\370+\"J`\344AP\370[y"
+	.ascii	"\303\022~@^\b\341\260\304\320\004%\326\037\220gt\302\2055\250"
+	.ascii	"\366\206j\321\316\267\006\375\216&X\203F\302\236\216j\342G\334"
+	.ascii	"\255BB\022\230\360\355T`\021\021\217\210\301\204o\027\374\021"
+	.ascii	"\t\203\273`\211\240\235^\260\004q\267\026\031\r\207\352\032\374"
+	.ascii	"\355\204\303\022C\030N\330\371z\353\257\350\346\204\035\020("
+	.ascii	"\034\332\234\260;\342\225\250Yw\037~\360\321N\310\210\350\227"
+	.ascii	"\256;\020k\360g\244[}C?\365h7\304@\241p\002\273\334\272\303="
+	.ascii	"\200\026\026\251C\237U(\034\372\330\250\236\366\317O\b\016\032"
+	.ascii	"\020\301\002\270\347!\310#\002\362L\360\t"
+	.string	"\n\211\210\204=\237\340\217G\344\323\033\022}<\b\340\004\037z\221\233\340$\274\003+\221\007\314-=\355\255HQ\201\224\202\226[\225\271a\221\272\241\343\"\312\225$(\334b\233\024\326\225\346\233\032\0136d\250\325\204\305u\341\022\003\372M\236ZI0\300\244OZW5\224\026\356\205\0277\031\177\357R\337\024w\351\272\310qX\346\314\314HnX\036v\250YQF\2632\331\323}\223}]\334\026:\312g\331\217\277\027\312\205\264`\222\001\003\337\247\273\302\235\227Eg\034\233*2\247\361/\t]/I\257\323e\272A\314\214(n\223m;\202\265\3436]\246\234\033?\242_WE\221F\213\021\034[\234PD}y\245\370\3337E\3346o\270\373\"\255\021\007\202\316\2502\t=F\302\0302F)\031\231\021i\223t\222\n\020\210\244Y\036\250\324\003\022\200DEN:\250hDD$\005\005\005\005\365\253\320\030K"
+	.string	"\366\346\252\260\031\031|\320\200Tp\302d\203\216ikM\363%>\203\313H\377\274\277b\200\354\355\366`\343S\017\354\314 \274\336x\274\240\244\221\225\237Y.\321\2139H\330\031\214H\373b\016\252\263N\207\303}\260LM\222\241a\352\225\225%gM-F\321e\025\260\201 s\204\252A\005 \210\242(\251\352'"
+	.string	"\004\310\203"
+	.ascii	"k9\212o\244\234\005\246:^\341p8O\213\317\216&\200\302\\\3319"
+	.ascii	"\017,]\327*\343"
+	.string	"\025Y\304S\347y\307\f\201\250\375wu.\224A\007\021)\345\026\025\210\262#9\311\0011\203\022K\032\214\342\212\256b\355\2100\346\251\007\246\003\207\227\315MeA\372\300\273\006%\037\210$\334\324p\022\336\177\274\317t\303\210\033\224\216\002G\217\252\216\235\031\272d \275\330@\216\355\234\240\255\376.pf\230\006\307s\301(\226\236:\244\346\316\362\272"
+	.string	"\324\352&\272w\t\r\321\324\031\306\305\362U.\377O\020f\350\213\370\340\352\001M\005\3610\276\331\002o6\210\343i\202\300_\217Z\301\202'TCkVo\027^a&/1\031\267\n\334\364\327f\037\213\034bL\225A\245\214g\356\337\247\244\021\362\355\017\036R\021@9\373\017\237\211[tVI8\020\275~h/-a\355@\020i\351\220C~\317i>\267\013`s\200\371F\361z\025\022d\322\243^6\320v\305f\204V\325j\023s\217\261\315\250p\262R\177 \267\354\350\200~\262\321\0273`\231\372Y\005\202\346\371\270\370\346F\0206"
+	.string	"\334\235\377\356m3BM\200F0%\337@\257\362+\343\322\"k\237J\001\032B\232)\275\b\017\tm\332\350\306?\373\200\330\030)A\364\326\036SZ\002VN,D\310\307<D={(\2744bs\233i\300\257\007o\200\270&\303+\033\313\300\003\025\323\005\345i\235:\245\362{\213\345\277\314S`:\255\317\325\021\357\235\372\373)\274a\331d\257\357\216\364\342\017\261\022"
+	.ascii	"\356S9\330\030\342s}.\001\205\004\f\256-\023\354\311R\024\200"
+	.ascii	"\035\240\272\222\371(\303\0221/E\207\215\204\004\333c7*\232\264"
+	.ascii	"2t\265N\200R\232$/2\2510"
+	.string	"\247\315\244\315\031\301\273\303\026\347D\320^p\307\222\336G\330\374'\247hC\255\257\254_t\212v;\230\275/P:\225\n$\237O\024\275\006\304\200\026\274\f\200\343rNx\3125g\n^:\371+\242\201\257\277\301\247{\214\252\236IF-T\264:\201\236L\352\317e\003{]\357\325\223\263\223M\360\031\017\320\307mW\013\r\006\364~\0375'f\257\300Q{\020\352\304a\214K\351\265\243p\275I\266\261\232'*\317q\264\245\275\233\373\037_7\231\344\332\036\032\361(\302\374\026J_\226\325\3626\267\352#\264l[?7\305\003\200\2459\323eRHX\330E\001W\337\002*!x\251\033\204h\216\311\232\364$\r\016\367\\>/8dQ\235\340D\354\206\034\265h\305t\f8\211#N\334\316\217\261u\257\025!\323\242\3742\r\251\375L]!\331\361\346\006\206\333\024iQ\230\004b\323|wPw\345\275B2"
+	.string	"\274;hY\2474\247>\337\230\bM\2607\017\217x$)#\224\030\337;\363\021\225\333<s\2509\003\353\007\2435a\026\316\271\034op\013\350\333E@N\246"
+	.ascii	"\340Vz9\332\237\354\261\331s\254\351\177\314'l\260\224\037\333"
+	.ascii	"\201\036\303\220\0254~\330##\303\216\331\024Nc\272BI\254\371"
+	.ascii	"\326\305\244\\\231\n\032X\244\377\347\225c\327\207\363.\033&"
+	.ascii	"5X\205I\331\373\325 \016\325R\277\347M\343\324\231;\225|2`\343"
+	.ascii	"|)C\250\331\363_\300\306\2266\372\230\227\r\312]$\203\252\233"
+	.ascii	"\233\241\250\355\365\030\251[3I\177p\374\336]j6\372\026,N\361"
+	.ascii	"\2617;{\ra:\033\226\005\222\"oi\277E)j\360\365v\304e@\315\302"
+	.ascii	"\244\257\032\371\347.7\343\261\217vH\342\bq!\302\347o\310l\n"
+	.ascii	"\270%s\006m23\276.\236\335\345\331T~R`\331i\341G\035e\332\342"
+	.ascii	"1\373\3327\363&\326\376\226\266\025N\016\220C\344\f\037\265D"
+	.ascii	"\242@A/\337I\0171\310|[5%S\322\310\276\232\260\203\017$\b)H\237"
+	.ascii	"B\360\373\355\304)h)0\207\227\231\234@\203\352/\020\363\276\262"
+	.ascii	"\340\247w\214TT0@\201\005\354?\336\003\277\247kZ\264\304\322"
+	.ascii	"\216t\316j'>\035\207N\344\344t\251\256\241\034\324\201sd\022"
+	.ascii	"\215\0046z_\377\223\276\3331\244\215\003Xy\307\237\331\257,\001"
+	.ascii	".\326\320\235\032\260\242!u\237(\200hB\260\205(8\020\333'\352"
+	.ascii	"\253\253\340\204\364M\330\235Q?c\301\244\376[\341{\343\031OO"
+	.ascii	"\231\320\306\334\316\234e\036F\310\257\253\343\370+`H}=\362U"
+	.ascii	"\326/\354\202\315\316\364\323\223\216\256\376\206\314\253\254"
+	.ascii	"\025\340\257h4l\307\177\355c\256~K\364\223\323\317\020{D\017"
+	.ascii	"\216P\016\254|\005/\325\267\217\264\227\320\035\311\030\312P"
+	.ascii	"S\236\364f\335q\016p\341+\3477\363\353\356\321\374\3243p\274"
+	.ascii	"\223\316\346\241\263\003\237\303\314I\0327\367\262\274\245a\246"
+	.ascii	"K\272\225\261\330\302\001"
+	.text
+	.section	.gnu.lto_.symtab.a3a4d632c76e81c,"e",@progbits
+	.string	"init_kalman"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"kalman_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"setPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"kalmanFilterStateRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"varStruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"update_kalman_covariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"r_weight"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"kalman_process"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"kalman_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"isSetpointNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"streamStatsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"streamStatsCovariance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"streamStatsVariance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"streamStatsPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a3a4d632c76e81c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1827 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\034\b\005\020"
+	.string	"$\026\020\t"
+	.string	","
+	.string	"\341\333\245\345\002"
+	.string	"\001\337\352\303g"
+	.string	"\002\203\270\227\357\001"
+	.string	"\003\264\245\347\210\r"
+	.string	"\004\346\353\250\236\002"
+	.string	"\005\246\240\335\225\r"
+	.string	"\006\347\231\311\265\t"
+	.string	"\007\267\332\206\371\013"
+	.string	"\b\271\225\217\236\002"
+	.string	"\t\352\222\314\276\016\002\002"
+	.string	"\002\001\n\223\242\326\261\005\026\002\013\326\331\347\361\r\004\f\350\355\231\037\r\231\274\327\315\004"
+	.string	"\016\202\362\202\320\006"
+	.string	"\017\326\360\230_"
+	.string	"\020\244\330\372\372\n\f\002\002\002\003\021\360\232\325\316\b\030\002\004\002\002\005\022\257\324\327\335\f \006\003\006\002\006\023\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\024\242\333\255\257\0038\t\t\002\t\025\333\332\376\205\007d\n\n\002\n\026\234\341\340\262\001\220\001\013\013\002\013\027\005\002\005\030\f\002\f\031\r\r\002\r\032\016\016\002\016\033\244\246\246\251\f\006\034\275\305\343\240\f"
+	.string	"\035\354\261\352\343\013"
+	.string	"\036\364\207\213\233\001"
+	.string	"\037\220\262\215F\034\002\002\002\017\002\002\002\020 \241\354\264\375\003\030!\234\325\321\326\t$\021\021\021\021\021\"\300\240\244\243\001#\307\212\350\224\n\030\017\017\017\017\017\017$\340\271\316\307\007\017\017%\256\364\252\325\004&\311\201\222\322\t'\335\224\351\336\001\b(\372\377\372\373)\352\303\240\316\006\020*\274\206\303\265+\265\367\305\326\t\b"
+	.string	"D\250!Q\301(D\030DuJ\255\001\320\202\034m\322\001\022\340P@\254\216#p\004F`\234"
+	.ascii	"\n\214\021n\304\2143\341L8\263\036\360\020\210\345\252\304\325"
+	.ascii	"p\226/Z\241\274\321nm\304=\333\216t\027\223\324\252\233d\266"
+	.ascii	"M3\215\3029\235\020\200\303\266Vy}\251\304i$9X\005u\2773\003"
+	.ascii	"\326P\1772\3121\254\205\265\351#\324&[X\2005O\342\2141-\245\033"
+	.ascii	"\260~\246\330\r\302\324\304\3750:5\375jY]\331\235\373\273\374"
+	.ascii	"\376\253\376\241c\331!\367e\001\221\177\3159&"
+	.text
+	.section	.gnu.lto_.ipa_sra.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\252\002u\b"
+	.string	"b\312\037\"PO\222\01603\265\022UUUUUU\364\341\007\t$\220@\002i\333!\236 kI#vK\231d{\333\346\330\330\257\301.\031c\364bZTP\274\211+\367\255<\276$\032\261I\351BE\210\207\322\241\341bXPH@\350\007\335\240\027P\"\033\252\314\227\245I\235\252\"\3306(]\247\256\225i\240\020\201\006\020\325\234t\245\221\302\013\221\023r\200%\0379\013\r\204\253\262\344}\035\353GG\250\3410\027[Xh\357\240\202!\272\331\001\022\3404Y\201b\2201\321\304\314L\274\332Z;!r\243T=\246w\\\0063\334QC\353r!\375\2457\020Jk\204\325\031\013\323#M\030i\341\261PHC\275\372\323\212\240)\323\245\275\017I\236\232"
+	.string	"\021\236\204J-\243\177\320\233>\277H\362\304"
+	.ascii	"\007e\234o\343v\212\235\362\002%\322)\262*\327\231\203^\2403"
+	.ascii	"\214\255\b\037\004\337\027y\032\310\235\366\002r\352\002|4v\266"
+	.ascii	"\3415\003"
+	.text
+	.section	.gnu.lto_.inline.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\242\024\355/"
+	.string	"\266<\303G\260\326M:\240\017\302fBiN~\354N\205\320u\364|\f\314\337\330\376\210\202\357F\226E#d\242f\367?\r\016\243\350\346\233\221\365\315\336~\324o\270\201\377\204\377Gp4X\2413\375\006A\002\223ee\321\336I\246\253"
+	.string	"\256"
+	.string	"\260"
+	.ascii	"L@\346m\307\\U\225\250\230\200\260\270\025K\334\326\241\210\304"
+	.ascii	"\324CJ\313+rZN\333\036\223\276E\025NQ\037<\313)-\301\370\002"
+	.ascii	"\312\216\334\275c\241\213\330\r\033\370\353\f\024Y\364\351\306"
+	.ascii	"{\005\225\216B\037\342\024\025\342s\314\355\256Km\250\237\364"
+	.ascii	"G\210)J\326\276\321.\321\215\275\367Hk\rE\322\264D\305\305\267"
+	.ascii	"\017N-\355W\234\016\232\035v7\264\243m\357\352O\177Z\206\275"
+	.ascii	"\007v\0172\377\211vN\177Z\336-\370\216\266\210\243i\311\312e"
+	.ascii	"\275\017\364\335\335\226=\364p\205\222U\316\3558\364\021+\224"
+	.ascii	"\254fl\035\313\250\b~\321X\006\235\212\020'"
+	.string	"4^\223\226\235/;_\202g:j\261\004h\205\246\263\013\216)\232\226\262\\v\361\245/i\377p\202\t\027=uJW\327\237\376\364gMIzf\360\264\035\205ST\321\364\354f\236\264{~\376\374\374\t\036\252j\211\013}\347w\226EO7n\260\216:\346=\252\033u4\346\032\334r\274\375\tT\025\023\032\273Xl\332\025(\266\314\314\350\320\231\2318w,\301h\"\311\214\252{\356x\202OQ\342(\b\320\345\227\256\246\240Za+v\315i\354\025TB+v\f\226\326\240\230C\n\t\207\313,v\355R\205\216\202*OYYW\236\202\023k\242\024ew]\304F\3461\252\220(\232\360\031UH\024=\200\301l\373\330\335\007B7\262\2736\257\030\265}pwG\273\322\2561\347[d\261\273\020&\016\216'g\367\311t[0k[\347\327\272v\312\330\335\030\177J\271\266\235\310\356\312\370\337\240\230\264\273"
+	.string	"\354\240'\275d\262\357\323\033\032\265\206\2668\016E\030G-\216x\210\003\330\370\366\244]\242\227\273\3565kQ\311n\330b\323\210\242\313\262/:\362\330%\212\271\363<\317\363\""
+	.string	"\0163\236\235\227k\377\325\321\226+\326\333q\273\333b\030\032\307\240\357\313\221\024R\356%v`\373\336\006\237\301\020\f\301\020\f\301\020\f\301\020\f]\366\355S\273a\347\022\naf\020\3009<6\361e\201\355\332k\257\361\254\240\026c-\306Z\214\021\306\tl\253\313\366\034\216m\325X\322\215\332>8\004j\037\334\213Ty\027\333\026eL\317d\237\325\356\026\370\016X\304\n\325LqFIR\021V\220$N\215\342b\345X\260Z+\025+\247+\223\361\354\320\256\264\253~\031x6\223i\024r\340o'\207\006\347\373`\271\316\263\333"
+	.ascii	"\033\260='\325\026\223\n\274\364\004j\324&\312.\210\330\225j"
+	.ascii	"\027\004\214\007\b\2105\221&\316Px\220\254\254+uB\341\001\201"
+	.ascii	"n\250\001Y\247HDD\222\224\024\244\320\030Q\205"
+	.string	"\b!\346\030\\\017\022\300#1F\002\2352\204(\"\"#\"\"\"\242\244$%\005I:N*\20421\316T\2048\332\024\236I\fYg\221\332\301\221\023a\177\340n\005;\234\033T\005\304!\307\310yS\224$v\312X\364l+\265 \"D\241\307\b\373\317\375\304\270G0\2061i\362\037\241\360\030\360\342\023\373\277\255KM\324<\3141\374\347C\247\247\035\347a7\270e\202\2378\036\037\265\213d\357\371CC\366\236!\217\260\f\360UJ\226l\003\271l\303\020r\266\f\364k\361\320\322\0262\360\362\205\024\267\034\261\220`\3032\331\224\205\031O!\b\221\0275L\253R\327=%\311\210\310\234\320\034\356\310\325\211]\027\360\350\266:x{\206\246*Y\2108O\257{\036\212g\321\bf\3061\271?\022\"a\304i\330S\275\206\356\305hEM6\241\314\367\244 G\2740\344\247n\264\327\342\034\231\317\354\212o"
+	.ascii	"v@`\252*\317G\272\336_\0309\216:p>\300\302`\344\332\007F\323"
+	.ascii	"$H\214/\036\037\371`\261uY\302Kq\b1\331phqO\326\b\3164=\371Y"
+	.ascii	"e\\B\352\357E\225\305Q\255X\240\246DM\311)\2014\003\206n\206"
+	.ascii	"w\203\305,\212\265\337\365\265P\205#&6\260\351\030\316@\332u"
+	.ascii	"0\363\23019@.|\367?\301\332\322\276\315E\033\206\361)|\255\317"
+	.ascii	"\312\002\307\372\\\0360\017\327\354q~\273\023\323\364\261\232"
+	.ascii	"]~Q<lB-\304\200\256(ph:{\305\271\263:\372f/\352%%\352 Kp\215"
+	.ascii	"?\023\001\2465\231=\371\230]:\332y\354\200&\037\216):\320\207"
+	.ascii	">"
+	.string	"\033\336L\025\246o\205d:\302\301G\ti\243\240\263\237\364\225\352\00635\305L\337A\316@\230DJ%\003:I\t\333\200\322\255\217H\340\270\362e\245\330\335\352)\307\346\210\233*El\211\2741^\262<\356\304\035>ML[\361\362$\371\n\024\206\225\364\024\221G\022\204\230yP\204\242M5\264\370\005\315r2\304\244B\221\302\016\337\307>k\217\t\231Bu\240\306\214\263\013`\367\026\303_\254\013D\202\365\340Vd%\254\001\270ou\266\366\250E\305@o\016L\377\b\375\266G\261\027\023\363\027t\275\303\251\270(\341\206\205\272\230_\331\022\016\376\377\022`Hy\277\376\240\341\t\211\240'\270e'\032JOkp\252\224 \217\316*\334\214\276K:<\006C\366\335\3530\353\006\376\3462\337/\203\f\017n\237\037!\031\022\201\206\206\201\234\342!\250\260\r\bp\302z!\t\037\251\254\266_\220\036E%\305+"
+	.ascii	"\024\001\354U\364a\261\360s\036k|\355\360o\302\243R\322\237;"
+	.ascii	":tU\230S\313@\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\024\003-\f"
+	.string	"F\22050pM\322\001\374\252\257\017\373^\001\017"
+	.string	""
+	.string	" x\\\341\352\347\233\\\325aS\203\354$\211!\276F\020\021!\360?\373W\210(B\215\020\"wJ))"
+	.string	"%"
+	.string	")"
+	.ascii	"\001\006\240\236\024ezN\221\004IO\351\271\366lO\264\317\3321"
+	.ascii	"\311\207I\311"
+	.string	"\246\275\307f\323qi<\357nOf\027\243G\t\326@w9~\234\3728\256\235ww\263g\305~{\236W\300\236\354\2654\214N\374\020T\003\002~\231]iO\007u\210\rb\bot\3007\3036\273X\236\3706T\317\212\241zZ\317\005KA\212\236\276\004\004\253:5\035\030DRZ\0039\305'\263/,\260\242\0248\201\257D\004B\\#\017\026q\263\235\313m\367\325yP\233\316d\332\215\301\264{\203]\332\315\002P\250\001=m\312d$\205i\335\240\202\251\"\342\006\022 \303\361L2$\030D\301\314\004\223\231\334\362q1{\242g\211\3343W\311\351$J~<3%\325\022\004\322\310U\207@\354\315\333Z\001\261G\314B\255\376\352]\364\324\313\rH\031\271Q\361\354\242\016o\332\357d\\\335\031\310B\333#\333\252\323\365\243JQWR:\243\251\306z\021m\366\336{'\276\202\341\026\"\303R\003"
+	.string	"]q\254\ty\237I\313\n&\246\214\376\263\300\362\375\351\237\007\252\245\240\3234(w\177I\335ReL\277\373% K\305\211s\371\274\217#"
+	.ascii	"\235\370\030"
+	.text
+	.section	.gnu.lto_.pureconst.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375 \211m\003"
+	.string	"\222H\032!Pee80\023bgRt233333\263\367\f\364\177(\351\241\244\207\222\036J\372\210q\0077\340\002\334\324D\315\3234\335\322%\335\321\025\335\320\005\335\317\363\274\316\343\334\315\324\314\314\304\314\313\264\314\312\244\314\311\225\334\310\205\274\307s\274\306d\314\305U\334\304C\274\3033\274\302\373\021\256\006W\202\007\226\300Z\213\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\217\0035\n"
+	.ascii	"\262\013$(\200K2\0343\300>\304\300\300@\361\013\205L\310\304"
+	.ascii	"\020\r\344\373\276o\177\333$B$\020#\331$\335\300a\273\335\244"
+	.ascii	"L\001SL(J\374\021$\304\217\\\037\034\330\234\006\206\205\177"
+	.ascii	"\214-U\307lllu\272\032\354\272\272\272\247\234\315y\330\224\261"
+	.ascii	"V\212\240\206A8H\f\n\226\365\213R\214w\001\371\375\256PM\276"
+	.ascii	"\020\205\004\202\371xS\256\252\007\007\376\207\034\005\330\350"
+	.ascii	"\346\214=\357I\253\0320cls\256\2243\345)B\200\0377\335\331\035"
+	.ascii	"#\213U\2501a\207\210\026&\323\030\260\002\231\261)n\022\240B"
+	.ascii	"Q\234\003)\213\0202\002\203\004+\2408i\231\345v\346\266\005@"
+	.ascii	"\241\013\200\202D\273Siy\357\366\260#\350S\322\227<-q#\321\227"
+	.ascii	"%\005\261\005\351\272\352\243\304\350\313U9\225\241\244\330\325"
+	.ascii	"4\n{\301#\220*\233\350\271\326\032\362\031\017\005\350\177\013"
+	.ascii	"Y\246\016e\027\031\231f|\301t\230\215\315\367\243\032z\302Dh"
+	.ascii	"V\260(uD\273\303\246!\017FU\205\305\346\251\260T'\372J\242\361"
+	.ascii	"\035\304\207`th\325\023\224\317\224\203\263A\347\324\002\327"
+	.ascii	"\224\370\033\027\210\247i\271F\317\365\344\007L^9("
+	.text
+	.section	.gnu.lto_.lto.e2bc8c0044f87c6a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.2.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\375\013"
+	.string	"6\027R@ q\223\016\037D\226PD\274S\026\017P\274\261I2\026(\234N\216\034\261\343\240\nUt`\321\262g\250\264\227\21306l\017\003"
+	.string	"\266\006\272\240\263\035\233\256\b\201$\034\240\2615\262\367\2262\245A"
+	.string	">"
+	.string	"@"
+	.string	"\025.\026N!&f\354n\314\034\003\377\334\005\300?\345p]z\335i^\376\006&\272\253\220\\]\201\022\027$"
+	.string	"\260\221\303\300\320 \343\246\347\b\006\222I!\330]\247\b\206\341~\267\235\300v\264\317 \252\351\324\364-\001H\230m\367\302Fc_\274\025 \236\375\366\345\233|\261\235Mp\233B\201\210\030(\273\273\371\363\246\362\227/Y\263e\267E\b\025\273k\300\004*\177\266\375\021'q\331\332\202*\372\201\016)(\232\375\003\2466(q\002\311\024g\376\001\257\251'\225\214r3\324\353;\241\205\324x\n\365\246kX\240 \235(\344fg\242\324\r'\036N>XM\250g7|\351\177O\273\227\356\241\017\207\207\363\270=\234\216\007\241N\025?VUY\236\370\341\350T\321\003\352\210\234\001\266 8"
+	.string	"\305\220e\201\342e\257&\324&CZ\263\235\032g\247\251#\347\362\251\352\210\r\363\251\035A\002\274\b\245.\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.3.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`:\001\305\r"
+	.string	"\346\032^C"
+	.string	"\221(\035{\215\321\013r\314\265\310\377\345\244\344\312\276\260\337u\340:\360\n\231\310\177\245\032n0\324/\321(\361!\370\271bp\rhB\275\252\214\232\250\252\t\271\006\025Y\316%\272@c\t!{K\231RK"
+	.string	"J"
+	.string	"J"
+	.string	"\266\377\341 :\373[@A\253\020CZ\311\330\335\215\343\033\327#\274\200\353Q5\274;\324\354\374\253\\\323\262\242d\03294\271\302\003\247\024&"
+	.string	"L\"\270\001\223\241\305W\317\022\323(\023K\260\273\316\222\351\302\035o\233\201\355\315~\207\360\250?\237~&\200\313"
+	.string	"\025\273\026Z4\226\025Op\270\352\267\357\263\\\345\257V\272\320S.\200J\331\335\220\277b\355\321\241\207\230"
+	.string	"w\204\002\017,\\\354n\307\243;\262w\266\226G\371sf\027EJ\211\335E`\003\331\243\0030`0\250\2428\365\220\353R\007,/\243\2141\307C\256\250\027\324\250Q\304G\252\341e\313W\250_]\343\322B\362\342}'A\212\301Z\347h\327\323\244^Or\022e\313N\211RQ\354\303\325\223\354i\f\246/\230\216W\335\001\240\016\210\b\024\2717\036\037\b\240\017\316\326\3418\034n\263u@>8\333\306\363\331<\b\230\213\360\300\263\2018\316\263i\336\341\352\211\r\025k\260\341\224\376l\247&\323\022\333\231^\345\331\213\031,OE\020\313\253\257\372H\270^\302\024\352H\232\b\027"
+	.ascii	"h\b\341\3350\021,\270\303\354M\264\2556\b\217\273\314\257h\b"
+	.ascii	"\025\273R\227\271\206\227l\340\354\330\005.\f\003\227\250j\242"
+	.ascii	"\2268\221 \2061AD\205\033\200\312SU\233S4\265\007"
+	.text
+	.section	.gnu.lto_atan2_approx.4.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\254\004\375\033"
+	.string	"\346\361\255I\260\226Q:\026\004\003+\034[V\216z\272l\2713u\262\236j\334\276\226h\267I\262dm\231\351\202\275x\033\341\336\235\342Wy\306\006:c\234;\245?'\025t\360R\356\n\215nG\373\321##^\376\267F\b\331r\247\024\233"
+	.string	"\207"
+	.string	"\235"
+	.string	"8\022,\031X\203\363U\025\023\210\212\3148\360\320\b|6\016|^\311@\263j\345\021\003G\255\025\201\r\254\036\332\366e|F\217\r\244>$\025\027\022\004\364\243\252\265\326j\036\023\037\322\303\210\0177\305{\336b\255F1\244;{\374\361\001\205\241+=\344|\336\322\235\245\033\300\013A4W\003N\210\030\372H\013"
+	.ascii	"A\201\344AB\fQ\332\256\307\b\240)\222xH\272r\035&m\345F|a9\034"
+	.ascii	"\255\251\265\376\3513(w\233s|Pk\365\364\220\023q\273n\233g\273"
+	.ascii	"\201M]\004/\033\333\3238\204\235\356\211\204r\233\245a6fgS\\"
+	.ascii	"\366e\025\020E!\251~fi\373|\346\036\331\247u\215l\032\332L6\363"
+	.ascii	"i\231O\307\276t\307\\\351\207y\323\375r\337\357\322\302\002\273"
+	.ascii	"\323\375\372\364\312\247]\237n}\232\365\351\325\247\307O\213"
+	.ascii	"\237\016?M?\275\237\236\237~\200Wpg\002\305\207%\342\253 J*5"
+	.ascii	"\030\352`\361\245\277\351w\372\332\267O\303vM\273\307g\372\357"
+	.ascii	"Ov9\225X\320d`\rRR\023\347\332\225m\220\244\265\256eP\225CW\304"
+	.ascii	"\332\326\326~\344\316\250j\bkm\242H\036\322\022"
+	.string	"#\301\035\270qW\373)q\307\0250E\362\3122G\303\025\027\300\023\272\341\002\370\221<\022U'*\225]\272\263\037\271{\355\334]Y\024\311\373\032\370\235\024U\260\312\334p\212L\272\001\017\205\203*\252vP\226T\270Z\177\b\274\366{\235\356\007\311\273\321\330\312\354\314\376\351/Q\244\324m\2262\373\032\237\273\037\351\3446\313\317Z\253\317\356\221\201\266'\201\330\016\t\245`:\202\233R\034\263\001;\026t6\202\204\035\n7t\3039\33486;\027xnrj\031l996\234Z\006\f795\034\235\235\232\r\3156\r\026tj<6\233N\315\345\253\247u\215\224\260h\326t\305\262--\013#\177\004\177\366\326bY\232\2455!\231\374\260\236\316J\352\371\030ik*\302\226\005feB2V0J\333\b\272%d\322s<\001R4\356\221_\244\007\025\316\266BO\211\312\026\266A.+\023z!\312j"
+	.string	"A\t\316\226GG\204L\n\367\310\033z+\346\221z\273\235\331\327\006\331\226\t\265`\352\261\262\253\225\355o\220\001a\250a<\244\020S\210\321\004\"\222\302\202$\035\300\002\221)c\035\020H\206\2144\311p"
+	.ascii	"Bo\b\013L\340\312j*z`\264\371\024\003j\020\333\345\327T&\273"
+	.ascii	"\030\b\251\035\202\372&\006\314n/\262)\037\333\230\215\275\005"
+	.ascii	"\027\356?\226l\036\272E\3221l\370,F\22283\005\f+\001!kfp@\177"
+	.ascii	"\025\2047\201\024\311\027\034l{\223\320\275V\324H>n\231\332\032"
+	.ascii	"\314\210\203\251n\317\315YqO\277T\033\021\005V\266\311\321\214"
+	.ascii	"\006%A\242\310A\331\001[\240T\242\276|\023:\n\236\2338\270\314"
+	.ascii	"[\r\031b\256\200\207\302\213)<\256\001\367R(46\025\2231d\233"
+	.ascii	"r\007\205~\337S5\016\353\355\321?"
+	.text
+	.section	.gnu.lto_acos_approx.5.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\374\001m\021"
+	.string	"\266 sG\360\320&\035\330gA\347'Q)v\334\037\224N \266\030\236}<\376\f\346\276>\020\327']\242\251C\034\364\373\036\251\377\236-\025\375\001\305\326\342\304S{`W#\375\001\021\256\027\215'\025\215l#\204\220-eJ\001]"
+	.string	"V"
+	.string	"d"
+	.string	"\230^\307\242Gs\316\310y1\347\\`\005\3331\333~\212\253H\331\242\fG\224\270\220N\f\017\321\234\263\033y\201\354\230<\201\354\330\212x\352r5\345\253.\357j\331\220a\315|e\202\240\0209"
+	.string	"\260>\031B\3433\363\327u\305\362T\265\2239\247U\206\305\341\306n\373\201\355\006\266\272\004\016U\2727\366\345\\\233\217\207w\351;7w\235\237t\365\350\352\355j\355\352\354j\354jy\365^\255W?\200\326\n\022\031\347\3240\362\230@X\f\023\017\377\235\253\235\362W\374en\307\342\310'`\256\274\026.\006\241\305M\265\301"
+	.string	"(\324\243c\316Yr\314%\333\0038\264\3356\373\001i\262\325V\343\001qh|"
+	.string	"\301\343\3036[\220\036\240\213[\271\330\036\270\001\342tX]"
+	.string	"*\372v\345\212\310"
+	.string	"i<\361\036P`p0\216C6\334\356\"p\001\342H\375\332\025,d\227\321\035\371Ven-\336\372\315\tC\362\205\320\022A\227\247\243I\313\355_\227'Z,@\"\030\035\035(/\3322\301\205E\005\225\275\334)&,\021ZPL\335\312\311d:\245t+\022PL]\n\212\2453\t\361\211\202\n\252k9\235P\035\027\316\313\2716~MN\r-\r\330\217\035\355\312\366h}\002\263\236,m\314\020\220\374X\320\345\035\306\216\240\232\335\033\213\266\225\204\264 \031H\274|>-\362\266\272\245\375O\017\030( \200\202\221\200Mu\355\204>\2248\2556\254\223\275\264\032SZc\275\273\266\027\fD\302\350\240\344\262\215\b\355<\313r9e\360\363\3300\007\277\024\020\231\\l\312\216\252\325:\351k\360\226\243y\300\033\266\347#g\231aCz\237\357W$\316\234\300\200\221\232\020\256"
+	.ascii	"\362\231\224\313s\235="
+	.text
+	.section	.gnu.lto_gcd.6.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"-\013"
+	.string	"f\025K;0M\225\016\313\345@\306\217\275\037\264\253L+@`\357\224\375\312{^p\003\217\214J\377\353g\b3\013F"
+	.string	"\316v\303a`\200\013\222\332\f[\203\357\252\335\017o\210\220\275\245L)8"
+	.string	"<"
+	.string	"6"
+	.string	"\016\353Q5\370\326\344\036\241&\347\377;\354"
+	.string	"Zu8Xx\314\034\302\210*u\002\320q\340\305\371\214\376==\335&\325\361\274$\273\353\354t\025n\353\266\027\330V`?A\316\247\177]&\022\005*v?+\024;\"\2366\330\346\354\206\355\215\036\317\227\2142c\367\002\310\264\273\017\037X<\236t\017\234\215\202\236\250;\006\021\023@\234\330]\314\300\005X\217\360\001!\377{\200xKS=\377\276H\221R\304T\303\214\252\352A\360\324\001\024L|(\261I\225\355e\016wwUC~FD\252\2245\203}\357\267^\372\343K\267\336{\331\246U\030\304\f\202\246\246@.\r0\223\f\323\266,\333(\230\346`\222a\024\313\005\203\020\360\366\240b\3010\333f\301\032\336\336\251\252\327\177gH8ir\245!*8]\324\220Z\022A5P\003\026"
+	.ascii	"i\b\204c\030\306\300N\213\017$\020`,\013__c\355\323\263\001\232"
+	.ascii	"\240\226\300\247\t\005\314\201\314\300\210\240\002\006T2?e\037"
+	.ascii	"\216\222U7\325T\215v\225<"
+	.text
+	.section	.gnu.lto_powerf.7.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`t\001\275\016"
+	.string	"\366\333bD\020\217(\035@\361@\032\265\370d<\322\221\244\363E\361v\026\343\234\t\350B\\\316+\252\003.\362\351\036\376\027\2767W`\333\225\361\236f\035"
+	.string	""
+	.string	""
+	.string	"T%\236\201&\370&\200*u\005\215\243%mo\271S\nN"
+	.string	"N"
+	.string	"L"
+	.string	"\253\031\270\200\314e|\200\314\245rp\366}_\314cwGH\272\214\nI\276\367(\262Z\221\342J\2271;qt"
+	.string	"\300\235\"\306K\254\344\257C\025g\202\361\203\307\365\257#X\261\2448\217\303\354\301\356\032\246\270\fw\346\266)\330v`?D\036\356\372[\207\366\355\227\360_.\233\314R\307$\361\\\032\314\313\333$\337\263\306v\313\260Y\352\030\200ZQ\021\333\335\004\227f"
+	.string	";\233h`m\016\3172\314\027\273)BP\354\356\002\037\230\227\037q\022$\033\026;\220\220\257\264l\270X\354\006\n\3651\036\312\005\370\362\270\273\033\255\340P\247\312\024\324\312\004?\253^3\375\353\022e\305\202\002a\202\237*\311\311\211S\375\260\273\022\304"
+	.ascii	"y\211Y7\3303\223\357\376x\326\257w\335\360\255\373\027\263\005"
+	.ascii	"\214\211\002'\273\034\037\314\252\310\222#\220\306\326\221\243"
+	.ascii	"\t\032\"O(\223Q\301\243\036\021\007Btg#\2120\342|4\320\366\371"
+	.ascii	"l\035\r$\201\363\321:!\221\266!\340-\303\023\322F\333\026\322"
+	.ascii	"4\335>\306\253\224\307\260\221\242bAMR?\254\021\241S\265\005"
+	.ascii	"\252\376\272Fd\344\204\367\3512\302\202*\333\216\001  \200\002"
+	.ascii	"!\333\016\033\201z\354\025{D-\344-\016H\223\237\361\201\231\325"
+	.ascii	"\266X\321\254=\330\322\355\026rLq0\330]\203\355t\255d%LB\340"
+	.ascii	"\020\254A\300\303\202\241\001\345%C\226\220,\362\302b\037\357"
+	.ascii	"K\244s\321'"
+	.text
+	.section	.gnu.lto_applyDeadband.8.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\031\0015\r"
+	.string	"\006\231YB \255&\035\027\215^F\214r\215\217\330/c\256R<#\001\340\"\234:/\034\004ve\n*\367\327Q\271VV\332\371\250\213\001\332-\t\020\300\302\005\t\002#\031\261\247\222`\212\033\261z\357-eJ\001E"
+	.string	"D"
+	.string	"G"
+	.ascii	"\273P\3005\336];\200w\247\026>\372sMs\344\217\374\245\334a`)"
+	.ascii	"om\243\244\rP"
+	.string	"\241h8X)\265\0258\311L\310\300HMC\205\242\371\313\363\0043eZt\354\256\323\004\223p[\334\266e\373\200}\220N\273g\177sZ\337\362\247\323\337`DP\005\030\261\213\022Ul\t'\202\305>\214\315\271-bs\354l\0053\337\022\342\213\335\n\036@\354\226\f\230\300\346\316\266\237\341\032D<j\331\005\354\241R@\330P\263\001\244\214i\302\241$\3454\225\372\364&\f\244\214\177\007\026\022\253\026\362R\023\240\304\230\231R\2562\004\n\225\212j\312\355\345\033\02312\245\\9U\3650Gp\2420c\252!\311hg#\251)\373\032c\214\326\025\333\351\027\236\220\245\300c}<\233\017H\003\353\201s\207\303c\301\207\005\202\241\013\004\272:0\304\300\002\301\216\310\003rl\370r\360\021\301\217\353\022AN\266\327\025g{\232'\\V8w\241\342\362!\375\321\273\236\330\035$Jr\333\335}No:\005\031"
+	.ascii	"|\bX\325Q\024\026_d\242\200P@\235\2373\001n\017V\r\025\2000\221"
+	.ascii	"\250\336\341\214]eZ\247\256\201\244\020\026\230\003\203\201\021"
+	.ascii	"@\005,~\346\223\223]\200\313Uu{\253\235P"
+	.text
+	.section	.gnu.lto_fapplyDeadband.9.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\025\001\025\r"
+	.string	"\326\330XB\020\257&\035`\225\204\336t8=\304l\2220EC\271\f\027I(\336\354\354\222\201;H\374\177\335_G\345o\214\230\206\023k\354v[)\002"
+	.string	""
+	.string	"*\200P\334mn\315T@(\325\250\315\356\275\245L)F"
+	.string	"C"
+	.string	"F"
+	.string	"\273Q\3003\340\237{"
+	.string	"\370\247\027>:|Ns\344\203\034\226\374a`%wNC\304\021@\241\320t\260R\252;`\"C\002"
+	.string	"#\271\f\024\n\315]\236#\230)s\303\261\273\316\023f\341\336\334ve;\201\375\007\001v\246a\246\337\265\337\275\345\327Lg\246\317\301`A\025\230\331\255\260\265X\023/\304\212\355\221\335\261\265\025\361\371\026\t\276\330\035\361\001\304n\t\201\rp\376l\373\032\276ad\3038M\005\303Q\234&p\250\331\271\345\251\203H\3664S\205zS\006Rn\277\207\025\022)\247\231al\347"
+	.string	"U\005$'^fJ\231\312\030\026\250\023\325\314N\257\035/2\245LY\365z\227;\026\225\024\246\232\220\334l\r$5\263\257\333\266m\326\224\237P\325\361\251@\037\016\bB\203*\302\263g\303c\301Ge\305\320eY\227'\206\030TV\364\210<\342\206\206/\007 Q\374\270.Q\354h{Mq:\250\251B\004\205\367.NbJd\352\210\232#DIv\273\273\360\351M&\244\030"
+	.ascii	"\177\b\030\326Q\033\013:\214\034Y0\003l\001u~\316\020\270\275"
+	.ascii	"Q\353(J\026\324;\267\214u\355\032\3704\241\20090\030\030\001"
+	.ascii	"T@\343g>9\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_devClear.10.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\255\007"
+	.string	"R\21765P\217\032\003 \315\243\300\275_\2051.c\237\213\272\021g/\326\354\340P6{a"
+	.string	"\266\266\260}\215\304^\3142\210(F\362\304p$\2016\215o\264\345\2262\245\023\234\207\330L\343\201\370l\264\331\3314m\313f'b\243\315\214\363L\315A7\t\0167?\333\306M\314w[\217^\035N*Q\274h\202[\n\217\024\005\373\317P\213TX\f\224<,k\320e\031UJV-\"\370\322~!\0309Z[\377\337\350\265F\331\320\0220\245dV\376\214\027\227\253\344\311\007\246\255ak\223O\235Q \023\374\036\210\311\377-4\203Y\366\263\301e\211\271\340\262l\327\262\370+\335\251\r\214\324\352\377\214\035\356\f\273\332!\016\030\221B\206"
+	.string	"\r\377\013G$\r7\272-B[\205\266$\001\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.11.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\302\002]\022"
+	.string	"F!sF\360\320&\035\\~cC\365\004\333X\330\361\255O\262\252\273g\237G\211[8\217\003f\0323\370\230\245\303\203n\250\244\241A\347\266\r\177\002\315\254\204\354\300rD)\222\321~\260\313\204T\255R\304\022B\310\336R\246\024]"
+	.string	"Q"
+	.string	"f"
+	.string	"/q\023\250\277T\036`\367E\006g\027\006b\004\334\243a\357\320\036\271\013\320\036\215\262k\034\026\263\217\305\\\210\315v\367\323\017G=BM\224\177\233w\254\326\312c\313\341\250\325r\205\036.\237\r\244\026\013\354"
+	.string	"\362@\3436O\f-U\346\226`w\235\254\226\206[\273\355\005\266Cl\025\t\257T\026\331\260\225T\030\373pw\327\372b\277\346/\375\365\2232\355ez\224\351.\323\\\246\267Lk\231\216\231\206\231VM\247\246?`4\003\362\220\355f(\312\261?QG\306\366=\333\t\373\t\324k,s\267\333\342\006gwA\f\302=\032\200O;Q5\242\225\r\325\222B\215\261\025\211\034\313T7\227\236\241W\346\334"
+	.string	"\352"
+	.ascii	"e\007\354\323WD\035\236\331L\302U\2202\250\2446\312o,+\320\315"
+	.ascii	"\360\320p\370\b\226\353G\025\306\037O\355\020a3\203%q85\005\200"
+	.ascii	"\230\263\204>~M}\320\312\245\362\204\243\360\016\267\273\"~\254"
+	.ascii	"A\005.\204\212\366x\325\324\016M\026N\241\304\201\232$\004\345"
+	.ascii	"A\312\210\35139\231L'\222\317\004\302\210\351#9A\371B\b\370\024"
+	.ascii	"\241\344\344K9\235N>\017\266\207\253/V0\364\223RU\364\024F\017"
+	.ascii	"K(\345\202\001\b\031K\310S\333\364\236\221r\352u\nu\244\032\321"
+	.ascii	"jFU\322N7\031;\234n.>4\257\215\205\246\252\233\302\030+WT\250"
+	.ascii	"\232~\365\"56 \240\002\221\2712\017CC\377H\f\261\035\252H\366"
+	.ascii	".\2551\223\225!\325D\227\210[pWx\3152\270\272\226\372z+\020t"
+	.ascii	"\266. \262\330u/\260\\\\\207\346\323-\177\321\013D\256\343\216"
+	.ascii	"7\221*\330\\+\202\202\370Zb\342\367\214`\224q\335\267\030\321"
+	.ascii	"\373 \216\243\026\b\t\216\2439\366\346\267\264\r\300.\325\267"
+	.ascii	"A\263G\034\217\216\030\277\"ML\231\277\334l\362\251\256F\273"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_devVariance.12.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\r\f"
+	.string	"\006\030S>\020Q\225\016\030\302\351\303\302\314\362:\273\035\nZY\214z\004n\316iM\005\\0\272\367\371\231\026am\324\373=\271v\203."
+	.string	""
+	.string	"@\024\201\202#F\355\333M\205gd2\223O\366\2262\245C"
+	.string	"="
+	.string	"A"
+	.string	"\250\263H]\0201cw\261\311\rX\217\360\004\254G\325\360\355Ps\363/\003Eb\324}\016\003t\033W(1\241\330\020\320\205`\202U\006\027\007\361$u\\&\304\301\356:G]\351\216\267\375\3006\305\376\204\336\017\321t\3244\314\264j:3}"
+	.string	"\221\322j\301\267\213\341\253\261+\242\211\016\2667;b\373i?\365\017\333=\317\007\354\236:J\354z\f\254\340z\264w\331\366=\274c\263U\320\333\020\237+j\305\020\2318s>\302\252T\004O\016#\323J\225\303\224_\365\205\207\212P\322\260M\341!\374q\355n\003\337Cc\341B=\372\036\353\361Z\240E\n\224\237\355}R9\354\303\325\223\255\351\353\001\0250\020\324\227\n'B\307\222a\031-\313\264\013\226\221`\311\260\313\206\203U$\3264\230\r\326\321\264\r\026\361\366zr\246U\266\363@T\222\355\250\023\220r\020BM\275\024\222Bt\202\313\317\252P\343\207\b\006(\003\023"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026s!'\250\031\354\310\330\203v#)\2011\357"
+	.ascii	"\324h\025\024"
+	.text
+	.section	.gnu.lto_devStandardDeviation.13.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"F[_D"
+	.string	"\2216\03587t\367a/\022rg\r\375\rtn@q\236R\327\005zI\2607H\030\204\267\360&\317\037\233\"'\350?\243\006\215~PUU\353\177\311\265\206Y_\344M\006\317\031\247\337\272\221\275\245L)M"
+	.string	"G"
+	.string	"O"
+	.string	"\034\336\241\263S1\304pz\213\021\022>\324\230sj\035\027`]\306\007\260.\367\302\273\307\325\316?\313\243\206\223\214\017,y\324\200(\337\270)\245@\341"
+	.ascii	"E"
+	.string	"\321Ce!\346\250+\t\364T/\004sN\353\007\236\334\362\266\023\330\346\330W\t&;\2523Q\215E\365\265j+\252eT\307U\357\303_5Y\005\025\347\305\234\023V7&\2144\241\342\273\0345\362\026o\213\213l\304\316\336\331\231\332_\271\207\356!\311\001\314i\"Qb\316\320\200\013`\227\0161\333~\213\355\245b\204\302\332k\345\313hF\347\273\326Z4F%OW\016.\302)\271\004`h\206\257\244\332M1\347\273\033\303e\205Hm\370(\203\036\302/\330\234\363\200\017\"\302\003\377t\351\223\354Q\3678a\261a%\244+;\364tS\354\307\271\001\020@\024\254=\035\320\002\221\217M\013\341\266\215\363h!\f>6\315\363\001i\235\215\271\006 \037M\204\343>Zf\333a\350k\262.\226\305\2340Q\247l\353\200\314\222l\307\355\b\255g\215f\326\3368\353_\334\263\374&$\n0\242-\211\327\312\027"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\\\303\313n\0026\025:h\230\026\342z\r]2A"
+	.ascii	"\202*\034\334\215\244\032\244)\251\306\245\240"
+	.text
+	.section	.gnu.lto_degreesToRadians.14.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\205\b"
+	.string	"\006\021=8@\345&\035\340\253 z*W\325\034\322%"
+	.string	"\001\213\002\320R7-\307Mu)\276m\203o\256\321\203P\251'\351p\031F\177\370\235Mi\206\\SSm\266m\023)S\n-"
+	.string	","
+	.string	"*"
+	.string	".\251\t\223\230\335\215\233\023d\016\253\017d\016U\343\335\263\363_\362*\325\241R2\205\236\232\205\335u\226L\027\267\336\366\201\355\004\333+\001\250]\213\017\300\262\300\024\017\333\235m\331\316\264?r\222\356^\204\341\356\351\004ew9F\b8\024H\333~\310E:\033Uy\033\034\017\n\337\007#\261+2\270\252\236\3641\312\317\251\327\223^D\371\331^(5\303~\265\273k\305\2605\255\367\376\324\364\241\005\322\302\t\034\206m\r\030\203\306W\207s"
+	.string	"y\262\370\321\262L\273\342\347\301\223\305k\343b\247\300\032\004\266E\220\246m\321\362\366\266\352F\244#\033\365\212"
+	.string	"\024\247u\t"
+	.ascii	"2\003\302\260R\b0\254.\001\327l\016L\020p\342I\265b\022&\031"
+	.text
+	.section	.gnu.lto_scaleRange.15.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\357\001%\020"
+	.string	"f\336iF\360\260(\035\352\341\326>A3H\301u\354\300(\325\224\021\276g\342\264\032\026\203\322\233\241,G\022;Y\034d\231\267#H\024\272m\016,XHyf\235\004\347%\357\355\035E\352\320_\025\024\375\237\020B\266\224)\005W"
+	.string	"T"
+	.string	"Q"
+	.string	"\242e\351@\341@\315\013\0024:\003B\031\222\347g\234\343\317.\007\020)v\267\304\002\272k\266}\231\223X\33191\374\340\272\313\212\026\214\306\356z#\017\331\256\305\223\266k\372\362\325s\345\037\347Q'\346\246\305\225\362\344\f\354\256\263\305u\341\326\333\016`{\201\235\022\002\232\006i\372\223\351.\323\\\246\267Lk\231\216\231\326Lg\246\037r\f/%4\224\304\330\2550\253\261.4\025!\036\373eO{\345\2438\216C2\357\304\315 Z\026\030\213\227\002\023?\261z\314;_\226\205O\013\326B\306\356\222\\s\202\260;i\263qN\f0\263MUE\372\036\226\bM\243n*\302\363\241\232\212\364xhT.\365\252\032a\260^+9s\207\246F\033\034ze"
+	.string	"3\243uC%gv\230\222\352b?\356\356Z=\230\364\330=:\315\017r\331-z\370\177|\346\367x\315\337q\233\237C\323\241\2467\370W\332T\251\023\007\335W:\201)\r\365\201\bN`\212\233p\237LR\017T&\224\207\362\241P\337\311C\201`By'0\345\231"
+	.string	"\360\027\341\004\364T\337\007z\241po\223tDEW\034R\022H?\032\322\2636\200\364\235~4yF*\322N\013\304\334\260Fp:z\201(\247\245* \340\2421\013\036\024\202\025P\006\374\260,\201\256\2114\330p\337\200\b\306d\216+\204'\230\305Aq\340IG\371\206\326g\006|,\336\251kRF,\032x\223\315+\264P\222\036\212/\021\264\320f"
+	.ascii	"\2333\034\311:\001\273\222q\022;$\353D\274A\026\007\300<\246"
+	.ascii	"\366\220\001"
+	.text
+	.section	.gnu.lto_scaleRangef.16.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`b\001M\r"
+	.string	"\366\330XB\020q\233\016+ \245/\240\264\374<\022 B\274\377 \304\035xQ\361\033\271\016@\031\037\276\242A\361\365\275\221\372\022\265_\0374\325w\250{\357\202\020\245\212\311\301\344h\324\005\361\034\275u\243M\344N)D"
+	.string	"M"
+	.string	"?"
+	.string	"\230]\226\023-v\367\200\rT\227\266}\024O\321\331\241\004\216 \361Q\313\206\224\034\273\213m.`\272\224\036`\272T\021\357\036;\377+\227X>\027\021\022\317#\265`w\035EH<\334z\333\005lC\260?#\217\216\217>\200\177P\261\342\273b\354rx\321\2612\244\213\022\017\375\242G\273\363Y|\305\226\310\341&\203fG4\330"
+	.string	"=\b9\254<\035\006x\243\0338v\327\343\322\016T\034J\232\035\371\2240@\331\221\340\244\006\002P\344\361x\023\207\016/0\232\321\253\305\003E\275Vz\030\236\tJ'\215*S\244Jz\215\360\321\360@\237\370b\203\236\250!\354K\273\273V\020\266\036\2723?\3711\027\335\325\301\237\272\311?\035\345\227W\371\245Gk\234K\370\374\230:\034\310\204j~d\033'\265\2715\3106\216\272pg\027G\241\303\321\260\220\251i3\303B*p4,\3338\354\"\340i\001d\303:sn\230\005\356mK7\030\364c\251\252\226\306\221W\222\321JU\025|.^   #9j\003\034\202\r(\003\272a\367\302\212\303|\023\215\036\n\234\260\021\372\246.\032\031\321f\340\215'3\261a{\226b\363\332\346\016W\262N`G2'\260#\031'\2007\300\342"
+	.ascii	"\236\307\32422"
+	.text
+	.section	.gnu.lto_normalizeV.17.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`:\002\305\020"
+	.string	"6\340mE\360\222(\035\020\370^\"h\366\317,+\036wT#\334\204Xy\221\tAj?N-G\305\2740\327t=\270z\311d\305h\344\226g\244g0\273\023P\312\301\315B]\365u\242\324\327t\333'\204\354-eJ\001W"
+	.string	"Q"
+	.string	"]"
+	.ascii	"\360\263\ty\332g\361\026\250\263\234<\300nJ\f\230\335/\304\t"
+	.ascii	"\266G\177'\220=n\027\220=\032e\367\370\207b\377\262\341\360\002"
+	.ascii	"\262\273\234\2368\352P\023\345k#\234\226+u\030\342\372q\255`"
+	.ascii	"hw\377zvp\2512\265\221\335u\266\\ \356x\333\020l;\260S%\366\341"
+	.ascii	"\356\2565\305\376\367\003\270\313\r:\313\377\311\264'\323\235"
+	.ascii	"Ls2\275eZ\313t\226\351\230i\230i\315tf\372\003>#pp7v=\304nv&"
+	.ascii	"\306\250\334\345\267\377\227=\276\213\267\240\356b\330\226\372"
+	.ascii	"P\200Es\343cw\025<\232\301\366\030\nj@D\254e\307*m\314\311M\355"
+	.ascii	".C\366\026HC+MY\323\250\233\376G\246\231j\252\0059]F\246\017"
+	.ascii	"\240\246F\2054\254\022\252\214YU\025j\344\241\3410T\027\350\270"
+	.ascii	"^S\325\006K\205\312\033\376\302\260mw\033\370/\023L\266\024'"
+	.ascii	"\331\3435\326\304V\260\240d\314\376R\251&\002%^\205\322\350B"
+	.ascii	"\346\235F\024\240\310tR\213DN%\036\t\211+u$R'\342J\026HH\234"
+	.ascii	"\310t\342D\016\270\30302q^\327\2318\317\267\207\253)\216@b\006"
+	.ascii	"EU\320\24342\365\250\267R\243\2431\252\035\365V`,\031\216\302"
+	.ascii	"H0\371\344\310\031\255\032\220^9\352\255\274\260dT\271\273)\205"
+	.ascii	"\331N\004[) \240\202\031\261\341\003\263\320\216\307\020j(\312"
+	.ascii	"\366\256h\\\263\262\332\266\r\332\0250K\313[\321\fb\316&B\222"
+	.ascii	"\024\260\251,\366\fLJ[\0341\341\220:AX\230pS\232w\304o\020\313"
+	.ascii	"T\\T\fA4\023\013vD6\257v\f.\212\0073\214\b\200(\340K\032\260"
+	.ascii	"x\271\355\352z"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.18.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\005\013\005/"
+	.string	"\332S\240\021FpZN:\003\200h\224\213C\336,P\330\211\nE\210\021\325\005\314n\222\302I\244\0033\266\334\235\n\016\204@\207n\033q\213\036;\322lm\320\361\254\220\213\241\256\333\375 \223s\367G\207\231\231\265\204lB\244L2\017\001\346"
+	.ascii	"\b\001f\216kR\236\334\313-0J\327\004\"x$^e\333\314\361l\312\251"
+	.ascii	"\2148\224\025:\023s\\K\323t\304.\220\304>\312\002I\034i\242L"
+	.ascii	"\341\322r\207\\\333\332\032*\364f\375\333\231\334\311\343\026"
+	.ascii	"\370\304\006\206&@,\300-r\310\227\246sF\242P@\257\344K\272\356"
+	.ascii	"\266HT\005\214\036\032>j\230I\323\224xs\241\320\233C%\363\376"
+	.ascii	"\b\022\024b\232\366m\273\276\233[<\357~\355E\272\316\226\342"
+	.ascii	":i\312\003\031%M\333\222\326\b\275\271m\347\2517\321\007\250"
+	.ascii	"7\267k\227\314\333\320\322\277\215\205-Y\223\246i\261}\274\353"
+	.ascii	"Ca\020\370\363\241g5\313\346\256\375\343\356\023#S\361\341\361"
+	.ascii	"\302\033yG\016\236\035h\343\313\031\377\314\356;\027\0305\354"
+	.ascii	"\314\030-\240#F\331\3170\272\027H\203Q\306\225\306\315\025W\214"
+	.ascii	"\\\316x\227G\307,3\206d_%\217\335\0161\227;\267 \003c>\243\322"
+	.ascii	"4]\026#\213\361\315\371\356\306\331\335\016\273\277\031\001\274"
+	.ascii	"\267\333\366\305\335c\367e\332<v+\257T\345\215p\362F\235\274"
+	.ascii	"PO~!T\336\247\312\373\240\362:8y\235N\336\006\237\3736U^\246"
+	.ascii	"\312\313\340\344]p\362*\270\226o\202\312\273Ty\021T\336\003'"
+	.ascii	"o\361\344Uz\3357\251\362\"U^\342\311{t\362\032\335\313\327@\345"
+	.ascii	"-:\222\177\300\335\276B\207\373\006\275\311\027\350O\276?\307"
+	.ascii	"\373\372\234\274\002N\336\236\312\313Syw\316\366\007\250\274"
+	.ascii	":\225\027@\345\315\251\274\303\312+\254\274\301\312\013\254\274"
+	.ascii	"\277\312\353\253\274h\345=+o\255\274f\345-+oW^\256\274\227\320"
+	.ascii	"]\312|\274h0m\351\213\2757i\2359%\310\223\377\334\257\345\257"
+	.ascii	"\373\275\374x\277\333\017\3677\371\237\374\267{\274}\336\r\034"
+	.ascii	"^\366_\272\334\275\251\333\333\255\321\262\247\313\202\345\314"
+	.ascii	"\334\376JW\277\353\035\251G@\367\370\264\200n\237~^\260\250\367"
+	.ascii	"^\210\375/@\037\321\f\275\336\021\034\031\365\221\2016*j\003"
+	.ascii	"\375/\335E\375;\rw\323\246\337\034\213\260\375\270\367u\007\372"
+	.ascii	"v\276\223hV\257w\246\242R\027\223Z\211;\251o\207.\365^\013\203"
+	.ascii	">\335i\022\315\312\353\375\301\002\005\275 A+X\352\004}\272\223"
+	.ascii	"9\367R\037\313\324\323\240\341~\334\371\354\354\314\261\b[}\357"
+	.ascii	"\347\034D\201\231eG \232\361\"\211\244\272\305\232\271\323\313"
+	.ascii	"\274A;5u\203wS\377J9\344\247\336'\253:\324\213E\350\262U\260"
+	.ascii	"\0244v9\272{l\333E\324\250\336\220\204\016\214\333\354\320ET"
+	.ascii	"\250\216\352\033!4T\233n\310\2608O\r\241/w\"\2717#\235\027\362"
+	.ascii	"L\302\322\324\245\313`i\352E\364~\352S\371\331\276\356\334\216"
+	.ascii	"_k\3651\213\034\242\355~\270\230+4MS\006a.d\021@\373qs\237\242"
+	.ascii	"\336|w\22286l^\001\\XV%\312\255,\252\255,*\264\004\226\325\326"
+	.ascii	"\t,\253-\264\204\225\026\327\324U\245\252\n\2615\324Ak\n\235"
+	.ascii	"\342\002Q\305\301\\*\245-\017\\SWE\254\254\253\253,\252\"\226"
+	.ascii	"\325\324U\221Jk\253\250\004"
+	.string	"\264Y!\252\264\212\\YYZE\240\327K\241\231\226\027\206\f^\357;\335\242\002Y\235W\177\255\216\2141\251fj\235\326R\333\003@6\026\3249\r\340\b\3249j\206/\306|\204-\324\303n8F!?-\354\017Q+\023t\001\354`w\022\330\027\324\300\030\365~b\276\376\351\237\020\241\366m1\246\241,8,x\024\025\250\317F\273\307\030\217A}\366\323\324\254 \350\345\025\337d\275i\356\310\302\246\254&\261\327N\233]\273\223\306\264/\263/\250\275\031\313\336]$N\027\231\203\226\246i\323~oB\006!\036\212z\223\223bzL\215\324ek\021\331\333i\241v\n\363\240\221:\250\235\356v\032\250\235\260\030\323\244\032\251\177\210\356\222_`\334\322\276\206\335{<\236~\236\020H4\013\200\322\250a<C\225R\246fDRP\220\202B\032\003\020\003\021\231\252\016\022@SM\013\203\2229'\026\245P\257\351"
+	.string	"l\312\307Rx\024\276\332\b'M\213o\311N\271\031\260Mx\2443\332\230T\262f\027\255\t\013\231H)\024\016\344\224X F0\244=q5\311\003?\346!\366\354\2425\312\275\274\347\3647;\311eG\304\0304\265}\2164\034Y\201\246\302<4D\234}\324\002J\200y\211\1775=\205$\355[vp\272\206O\361J\336$\2401\341\307\311\200-\347o\274\202=\367.\005\002\320\241\3426\0372\353v'\3103\233\226\335\"N\265\224\235f\346\204\f\334r\372\306+\330\303\357S "
+	.string	"\035*n\363!\263n\335\243\205y|ZO\215\n\276\032N\351\355\200\013Wpb\004\316@\225\256o^%M\307\362\271\257\347\334\276x\232m8!\021\253\271o \367\005\266\307\210D\2643E\207\263H\037s\370\357=$\273\017:I<-\365\265f\204\237P\266\304\244\315U'\260\t\331~ l\264CHk1]\204;\227\211\235\257`"
+	.string	"\255[\264=\336\330@\326\377\366`\315;\322S\313\363\325\013\261\023,\":X\225\301\214\204\315\205\230\266\337\300j\212:6\t/\n\250\244"
+	.ascii	"F\365\205\005\313\030\325<\345\026\303\236\212\322&@\217\273"
+	.ascii	"\235b\200\364\224-\373\003"
+	.text
+	.section	.gnu.lto_rotateV.19.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\004\0055\032"
+	.string	"\306\256\240H\300VQ:\344\002\302\317O\250\361\t\2745-2\203\tY`'F7\362\363A)\206\240\024\354\333\316\354}\314Il\314\027\277\177\"\210d\210\376\200\351N\377\333\272\246@DR\307A?M\223\251\212>\352\376\266\211\224)\005\207"
+	.string	"~"
+	.string	"\217"
+	.string	"\023\310\r\344\343"
+	.ascii	"0\304\2138t\320#\323\207\340Nd\204\314!I`B\"5\347d\360\364\372"
+	.ascii	"\322A\373\357\331u \017\202\373R\t\231C\202\200%\224\232\023"
+	.ascii	"\t\350\321\013\344\243\316\370Q\236\t(\240\253}\037\377\201\273"
+	.ascii	"\322\211\307\346L\032\222dN^\002\037\220\217\346\035g\365(o\263"
+	.ascii	"z4\316\216:o7\317d\204E\017\314\234s\2667\216\273\342\374\367"
+	.ascii	"\336\322\271\310]Y\017\346\234V\235\213\027\367\336\266\217\355"
+	.ascii	"\nv\234\001s\223\354\373\376\002w\372\t\274\351\377\271\357\366"
+	.ascii	"\271\323\335\363\246\233\347\274\037\300\225\376\035\251\226"
+	.ascii	"I\265\216T\347H5\216T\337H\265\215T\327HuL\252i\244\032&\325"
+	.ascii	"3R-#\325/\251vIu\214T\267\244ZJ5K\252WR\035\245\032\224\352\225"
+	.ascii	"j\225\352\033\200\371\230\"\204e\316\026Ua\346ST\242c\211o\002"
+	.ascii	"\210$N\020\344\221\021\373G\216\004\367&\207\036\020\2037#\007"
+	.ascii	"\322\314\005V|v\265\254\225MUqx\337\251\274G{\270\323\233\311"
+	.ascii	"\352q\265\367e\001W7.\030e\205\214\236\335\0057\376\2468\024"
+	.ascii	"\332%x\217\026\004\265+\204\203g\277\272je\305\216\024Ze)\016"
+	.ascii	"\005@\331F\360\036-\300n\316\311\340\361\313\352\362\243R\362"
+	.ascii	"\322\013y\257\350G\007`m\0165\275\316\032\362xR\2619Cq\270\200"
+	.ascii	"\207\317\023\207\256\032=N\034F\030\277 \277I\204\021\002v9N"
+	.ascii	"\254\036y6R\271B\245\204B\253l^N\327\206}0\030.X\370a}\250\335"
+	.ascii	"2\210\210$\212\214nC\265\325\320\255\003MC\024q\023)8\332"
+	.string	"p\033\252\315<\330j5\033\321\314C\321PmFdt4S\260c\333\007\232\321\354f\263\031\315\\\274ypn\222)\374xB\261)\\\002\234\223\206\203/\375R@\264\312\262\375\242\2638+\313Y\235\225My\311\271\331\232\305\261\331\233\215?.6\261\255\221\212Q\321l\024le\226ffa+\233\3322\363\332\230\225q\355k\343O\213\253\2651P\255eu\211\352!\367\212C\271g\242\343\302\332\270rY\001\\\250QPe\020d\304D\202\004\005)H\223\306\300\002\021\251\262\016\021P53J\221-(\247\324\262\006@\310\350\221\016\255Yo\267H\023\264\217\346\266\212h\305\024Q\250\231<\333\204\351$\343M3T\327 \364\252\034\240\340\020\325\312\212\022G\224U\227d\337\272\t\276\03122\376\232\355\270-\240\026\177\322j\360\313C\335\022\302\033\004\367&\360\035\305\376\022 ~\305\227\305\217\225\r\006.\024\n"
+	.ascii	"-\365\220\227cU\004^\362\033E\310\032\246\310k\021\227\354\275"
+	.ascii	"mRr$H\217\316NYo<\335;\230F\020\036j\302\354b>\177\276-C<B\260"
+	.ascii	"\n\274\326\204\331\365|\256\005\234\177\350\370\013oQ\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.20.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\312\003\265\027"
+	.string	"\306\351\216I\3200'\035\302\t\023\235.\252\257\032vq~!$\267\345*&\246\205cg\345\265\223\201\343>c\321$\177\344\326\266\204\365X\275\227\\|\241\036F\251\227\247n\3424b\367Y\037\030)f\313\332\272\220Z#\204\354-e\222\001{"
+	.string	"s"
+	.string	"z"
+	.string	"\237:\206\347\360\0163\245\311qB\356\373\211\252\331\315\350n\230\353\254\357S\336\343\373\344\037\345\313\361*\227vq\245\n\301oJ^\232\0364\221\033\206z\267\\\355\"\317W<;\253\n\351\271\321y\310\204\323\t\021\302\345,\030\341\237t\325H\327\216f\247\024\320\335\001r\017\344\201\265\311\311\254\274\200s\376\321\245\211\241\246[\016\347\013\232t\267\356-ws\335\270\2522\251*\211*W\b\265}\263\217\352\307\307\277\245\253\254\363\256\342\\]\315U\325\\\r\347*8W\277\271:\347\252\334U\226\253+W\017\322\201[Qr\242\033Bo\252\227f\222\205\363~\243\377\203\376HE=\217\026\326p!\257i\352\025~J\325\231~\247\242\022\275hv#\230\260\206S\360C\343\251\273E>UdicW\365\036>4\373\030s\216n\037$\022\335\343K\r\204\001:\375x2\203\"\0253+\365\372x"
+	.string	"\320\310w\264\220\277;\201\022=\rI\266\355M\326\251*\210?\030\274\255\310E\2669T\221\213\231\225\272\354\356\226\254;\355\023\371\203\245\022\215\004V\325\224\357h\005\234\272;\301T\272\305\320#9\240\205\024\3641|\233\035\333\366t\271\305\314\247\301 \257)\276\363\362i\204d\266\247\"\237\177\364\231a\250\251\246\206m{\314\335]c\326\251\216\001*gy\203+\n\211K\312\313I\f\266\"\213\305d(\260\025\225\223\030\f\245\305\005F\002\2422\226\005-\260\027\231\254\005&\216\3757\373\260\330ec\031\205\221\335=%7\372\237\210^\254(\025U\fC\304=\240\300\025\353t\305*n\005\255xk\214\250:\240>U\270#B|\201d\310\220u\0322\310"
+	.string	"\244P\354U\351\373\f\371/@\376\356\034,Z08\371<$\240\234\217\0218\035\304[:v\367\307\001[\250qP\247\234\251\200DDR\220\202\244\325\200\002\231\252\253\007\021p\2714y3\354\006b\330D|[a\270PB\351\345\3434\312\213\352\226\364\211\222t\020\263\237j\001\267\370\022\205\275"
+	.string	"u\t\323\330\363\342\373\255\026`v\370\213|+=8\bY=\314\353\200#\033\206\334~\b\203@\327\246\311\200\241\213v\240\250\234u\363\254C\360z"
+	.ascii	"\210%\360\241\034\340\005}\232\020,g\316\t\312\220\037\300\f"
+	.ascii	"\214\237\220\361&\244~\001+\f\004\224\203/Z\251\247\201\333g"
+	.ascii	"\370\200C\204\354\024\274\004\303\302L\031\333@\325\327x\360"
+	.ascii	"\002I\300JXc<\323m\311H3\004 3\331T\r"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.21.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\252\006\005\037"
+	.string	"\346\363\261H\260XQ:\360\230\374\312\340\242\256\326/\364\220Q\246\377\206\204\216\351\005\306<\324.@\337\257h#\235h\245\365jc\017&,\314\237\215\215\265\0374.\304Q\206\370>\355\204\333\310\370\3426k\377\333\377\215\020\262\211\224)\005\243"
+	.string	"\215"
+	.string	"\234"
+	.string	"\322\273\361;>tc\033\270\213\201\013u7\036\036\2269g\315\345\001\302K\360\262\360raX\036\334\335\240\332.\213\301^\256\026k\245J\241F1\224\340\252\315\027\031\200:\200 \271\341p.\223\361\230\214 \205\351\376\322\305PW\213\267Z\260P\326\212\257V\250PU\212\247R\240PT\201\027#N|\204\342s\242\200\220\317\217\212&\036\266p<\240\013oG%\230\372\035\ri\341<\200\b\202\204j\334w\355\301\351(X\243\304\367\276\203F|L7\\\211\253\310`\316i\275\341F\334"
+	.ascii	"n?\203m\031[:\0058\352\337\f*X\274@\366\354\273\037\306\352\227"
+	.ascii	"\367n\231T\307\244\032&\325/\251vIuK\252YR\275\222j\225T\247"
+	.ascii	"\244\032%\325\243T\213R\035J\265\224jP\325\013\252\025T?&v\343"
+	.ascii	"\211"
+	.string	"\203&s\212x\3222\235\310$\032\357\375E\377\017\337g\225\337\263\2158>cOJ\b\332x9\3327>\317*\3738\321\315\2136\2148>\rt \252\3149g\227\236\215\227w\001@\325>\217\367\270\371\216\303as\002!\021\231sG3\314\370\341\345\270\247\"#\356y\207E\221\262\342\346\366=$\335O\270\t\226\016\344\003\016\034\2711\024n\316\341\312\245@\304\244\203:\321\302\025\240\2139\3176\356y7`\244\227%)G\237\344\346\214\n\332\331\2127\235]\266=\362MDS:\250\323\3019\347\0047w[(\333\331\202\277\035\026k\373\301y\266\227\2459\247\002\371\273Y\361\2234\330\306\031>\207}\017\212\034}\262.\314\356~\307\006x'\t\277\272\337\021\322\321'\313\366{\337%\016\037\023\317\226\034}\332\r*B\342\303n\316\336\005\023n\341\031\356\031\231\013\0220@\240\251U\250\241\241\251\231\251U\230"
+	.ascii	"\201\2466cs\241&C\3005\026\"\330\3240\324\324\330\324T\273\371"
+	.ascii	"\005zY\227\234\325\361\006p\316\027\013"
+	.string	"^\364W\361\241O~9\312!\203\355\220\303\220t?\261\330\302\224b\260,\206m\216\t\322u\350w\263\362z\255\353\345r\261\224Z\264\243VkYJ\332\242\261\226\2659\232\321js^\255j)\254h*\243\034V\241\226I\310eMb*\265\250\035\020$\223Z\335\022\203\2125\205(q\227,i\024\335\317\270j\024\344\252\273\002\216\233\363\270\342\262\234\224\200\367/\200\233\250\221T&\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022@\224=\007\305\350HJZh\375\357\"H\2072X\370e\037\001\t\221S`\250\037\0349\364\001\301\255\354\324pmAB\004\026\207\002\344\025\n\200'\212\206\220#\212\232k\267\032\356x\3261\336m\245D\237\026\375\016\202\253\354\236\206\273t\365\346\333\336\021l4\203xM}\332q\307\252F\360\266\246\237\243\004\231\223\301W\016l\032\230\332&\211\317*\nMg;u\215`"
+	.ascii	"\270x\361\221\335\002\366\353\016@o\350\201\340\327\003G\323"
+	.ascii	")\211\303\201\ni\346~\031Z\377\275\320\315\211i\020\030\243\230"
+	.ascii	"V-~\310uB\252CD\256\004\214\t\274{\035\177\n\306i\321\364\222"
+	.ascii	"\363\225D\031\371\007\244c\360\312\267!\252A)\241\025\340l\016"
+	.ascii	"J~A\375Z\206'\2763\211\032\230\252+\224\245`Q\261=\330\325\272"
+	.ascii	"\255\211%\255\336\206V\262\343P2^\3604\316\231\013\246XT\334"
+	.ascii	"b\202H\231'\340:\0231\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.22.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\027\013\035("
+	.string	"\366\177\332K\240\226U:\204\236~u\237\371\025\200\006\256g=b\356\355\2521c\300\237\366\313\346p\"\b-\304E\315'\211\274\267\323$\277\020\207\260\n\257\303Z\360\257s@\n\257\202\335\337\370\236\n\256hWtE\333\266m%\215l\"e\222\001\316"
+	.string	"\260"
+	.string	"\301"
+	.string	"t\215\347\223\256t\263\303\322X\004d\026\205x\216Pj\255B\227\343\314\323\3627\363\264M,\353\245\361[\362\360\277\026\026_\217\267[\321\345p*7[\2156\223\305`/W\353d\231\264l\036\356Y0\345\213\247\253\036 \234\377\226\336\262\024\203Y`\334\007C\211{I\347%\275\340\035\322W\220\\\260\356\350\271#\025\214Kq\225\024(\370v\342\266\023F\\+\236V,\342\331\320eC$8&t\230\320\b~\211\270KD\bn\001(\321\001\304O\"? "
+	.string	"\260\370\tb\326\207\233\245\013O\351r\334aZ\236\265V\031\220\206\322"
+	.string	"\373"
+	.ascii	"\351p\271\302\303\373N/y<!{\200<\234Y0\265\326\345\036\240\016"
+	.ascii	"_\227\357\362\202\335\r\356\2666\004\273F\034n\"c\023\355\312"
+	.string	"\334\370#X\336\230#\277?\312\333ByY(\257\217\362\366(/\217\362\356(\357\n\345\325Q\336\034\345\305Q^\025\312{\243\2746\312[\243\2744\312;\243\2742\312\033\243\2740\312\373\242\274.\312\333\242\274'\345eQ^\223\362R\312[2o\227\274\\\362>\201\215\311\020\005Oj\345p%\245\n\241QGG\376M\377\214\275\323\276\366\310\341\211\363s\"\217\024\001\317S\331\356\315\376\270\257\225q\246\2337]8q~d\212CLj\255/\247\373r\236^\210\217y\3671\276ts#\206\327j%\202\312Q\253\021\270\003\316\007R5\316JI\226\253\211\353\352V\353\214\246LW\363\024`\313Ve\266\232\030\f\302EN\266\361t.:)\317&\356\331\254\216Y\005\317\276\022V\377\370Z\221#\315\242}$T1\310\354\002\247q\235\331\3045\2336\004&\251\fl\265R\337\244yjv\256H\340\307\341\331?>"
+	.ascii	"\217$RT\016_\321&n\313\250e\232\325\303/\377\265\317\253\230"
+	.ascii	"\220d`\253\227\265\326Z6\361C\363\3272]&wH\364\356\302\3748\024"
+	.ascii	"`\244\326j\200&{\232\354\177X\030\236(\366\030\372>!r\370j\271"
+	.ascii	"\021t\367wZ\224_ \346\233\373;,t\370j\177\375\276\323\251\213"
+	.ascii	"'$\317\224\034\276\3526\326\212\323M\f\017.\341\025\2763\301"
+	.ascii	"\t\016(0\240\021F\250\241"
+	.string	"\241\251\231\021Fx\300\200F8c3A\030\344m\215\204\0066B\n556\302\227\261~\215M\024\323.9\255\263\027\312ZK\034x\323\317DFL\224\37551\230\274.\371\226&nK\2634\204\226 \213\017\244e\351\361\370\255\212\345\363u\257uF>`\257\267k\036pG\311k\342\362z\3271+\036p\327\273&RE\255\254\264Nj\205J\027euM\324\221\3135n*\207\303\335\2029TT\372\246\322Wr\273\325\246l\215\303f\353\332\224-I\255\007Rm&E\013B\321\232\270\264\236\265\316\210\026\234\231\263\0300\310\215\333\212\024\203d\262\216\001e\261\330\213\n\3266`\260~Q\225\260$\374\212\262\257V/\351*Ww\201\001\250\221XE\225P \"\222\024\244$i\rA\006\204(de\035\022`s)\311\305\212*\021i,\367\3773\322\320\265\353:\273(\377;%\314'k\373\366\331I\345\353"
+	.string	"\303\f\004\224\032\227\377\346U\366?\327\037tR!\342\306\017\253\367\260?\375\177\305$$\364\243\030\355\0051\\\250\177\267\210\363\221\023R^\356\305\274Xg=\263\313\302\310r\220\376e\203q\323\372\016\026\350\325\020O\250Ur\321\230\261z\335_+\205%6\214dC\207A\375\262\367Fsv5\242X\341A\366\353\271~\370Z\\\2008\215:\245\227\3665{,_\007\225{)\253)\340\n\367\345N\034~\004\344H4\026\037\365b\331\251\315\354\352\020jHHL\217\322B\244\274\314E\205\202\221\004\\g\364\243\b\377\265?[j\306_\206m\275D\320{\3606b\201f\263\357_!\233\204\253\350h\246\020x\245\017_\235\024e\313:\320m\346\305\344\004\024\236'\264\213J\225\2114\335\236o\354\004\270\200\215\322qfY\363x\224\215kA<\372JA\252[\257\315G"
+	.string	"\0163\020\232\317\342)\370\370n@\013\371L\220\2332\327\0178\310\fY\020\214\323y'\216\022\371\217LL"
+	.string	"y\314A\300\257\f\272f\245\210\357h\f9\200\251Q\023\216\255 \253\252-\203C\303L\204\272\341\245\004\334\302\n(KV\027|h\n\2218\324\314\300i\240\032;\366\364\0079.\243%\006\255%K\334\336X"
+	.ascii	"\316\307\324h\376"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.23.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\210\017\3252"
+	.string	"zO\030\021J\240\226\231\016+\310\372+#\272\326\237rkJ\001\322\246D"
+	.string	"\234\217\204\207\366\352\177\305<\322\023Ps\315c\354\270\235\206\374\206\271\204.\343\345x9OJ\033\362\256;\271$\277\005\\-\337\005y.\340o\341\277\355\275\345N2\245\013\001\346"
+	.string	"\370"
+	.ascii	"\254\347^\262n\303\211t\032\231.U$Ue\r\r\314,\256\353\036}nS"
+	.ascii	"=\247NS=\177\212Vy\272\364N1\322\2151E\030\342P\030\004\276\374"
+	.ascii	"|=\027\336N\227\303\265\2647[\2156\223\305`/W\213\265R\261\253"
+	.ascii	"\232\323\307\310\366\325@Z\243\211\305'\271\343F%\217QR\202\213"
+	.ascii	"I\034&\t\022L\004\342C IX\210\344A\244&\006\036\371\313\321\017"
+	.ascii	"\374\363\341>\037F\270\227\303]r\340\300\274\033\276\273A\204"
+	.ascii	"u6<g\243\006\306\ry\313\020\r\334\276\360\333\013\027\330\326"
+	.ascii	"\302k-X`\332\n\237\255\020\3022\245\307\224*0\254\204\277J\220"
+	.ascii	"\300\256\021\336\032!\002\263B\370*\004\b\254\372\235\350\020"
+	.ascii	"\344,\224\237\240_\214\037 \274~p\365\225\324\220\372\230=8\247"
+	.ascii	"\252\214 \244W2CJ\240\271$\303\215\034oH^\300)\f\017\376n\344"
+	.ascii	"i\221\243*>I\017\216W\003\256\3536\366Iv\360\226\361\356\007"
+	.ascii	"\320\3354\335\256]\032\244x\360\324\177sIF\320\377\333\275\334"
+	.ascii	"\301\001\202\232\320~\024\3356\276t\257i\334\t\274\310\333\230"
+	.ascii	"q\307d\334\305\214\033&\343&f\334\303\214[\230q\0073n`\306\375"
+	.ascii	"\222q\3772n_\306\335\313\270]2n^\306\275\313\270u\031w.\343\306"
+	.ascii	"e\334-\031w\233q\3372n[\306]\313\270i\031\367,\343\226e\334\261"
+	.ascii	"\214\033\226q\2772nW\306\335\312\270Y\031\367*\343Ve\334l\306"
+	.ascii	"\275f\334j\306\2353\356\024\343\376\0247Nq\273\002\032\211'\b"
+	.ascii	"\232\270.\207\251(\327I\036\362\302\213\334y\270\367h7jV{\021"
+	.ascii	"\222\335\371a\213\246\334\230a=\327\272u\332\231\315j\035\276"
+	.ascii	"C\307yT`w~\016(\211\232\\\3275zn#\353\031\233\bb\334\3558<\207"
+	.ascii	"\216/-\270\314uQ$\005q\335\345L\027\003Ik,\366\260o\205\242\261"
+	.ascii	"(\025\006sA_\217\364z\275\013\372\242q\275\213\365-"
+	.string	"\231\246\267No\375\333\255g\375\315LK\206\365\034j\326\277MU\336i\365\317\344\3101\221s]\255^\365\255P\023\273z,\025]U3'U\2652-\201>\225@\354\343\346\017\307\312+)\373o\263\277\276\013\212\311\333\371N\005\232\256\357L\227=\247\374\232\337\213\222\224@\352\013\200\272\017oq\315\245\031\352\277\255~\376\233\035L0`\250~bo\247\352Y\375\233r\306\231H\366\235\351\300\"M\236\206\360\340\251\374o\253\204\336\346W\037lt\343op\247\035L\0300\224\247\256\353\272\351\277\216T\215o\363\251\263\207\304w7R\2053\221D\250\353\272\003\262\323\307J;\023\nH\226E\273\205\367\r x\360T\343\257\371\177\357\231\221z+\251\376\370\275'\306\005<\325\306\367w#\3174\216\252\004\r\374\201O\360\266\241\211\300@B\r\316\321A\016\016N\216\315\321A\203\032\234\243\r\204\bG\232\\\347<X"
+	.ascii	"\341(!'\007\302\221\265t\375Q$x\037\317_\350\n\251\353\236(\340"
+	.ascii	"<\334\233t$\2202\324"
+	.string	"\306\177\225\274uz\314\277\035\363\305\277y\306\374\255\270\364T$B\2258\315I\t\004\003\363\304o\205\2400\217\245\242\210D\341s\230$\035\376\333\303\027\276\013\3529|\247\"|\341\277H\202\377v\360\201\177\023\r\376\r\2704\324\300\177\237G^^\376\307\364\362\374\251\277\336\022#>{\246\276\177\333\367\275wA\371\336\251\364z\274w\272\270</\312\205\206\367\304\323Ew\320\"\273\335\353\242;\250N\325\375\313D$\227{\\S\016\207k\177\210\313\222\224@-\377v\313\267\177C\323\"\323F\031jmM\267\250\220\365v{\333\267BM\267\307RQ\233\215\306T\373 \265\332\323\230jP\032M6\0032\233\275l6#{\222\301\242\261\250\201d\250\201`e\221P \")(HI2\214\001\201\006\"CV\266\001\022`\262I\016N\031&&\222\032K\373\177\007a\034\266\370\226BJ\326\353\370\200\210\272W\315\366"
+	.string	"\2368S\270+\304\0332*\022\021\303\316&\361~\317w\305\247\264\322\346\001\251\242\201yUhM=\200\274\350\216\246d~,\315]7\300\303w~\033\243\261\230\247pm\271\263f\340\333\207\254\213\2735\230\313o\202\357\215\314\354\211\337\367\026^+\240 l<\n\376\253\313\310K4P=\203)\373&"
+	.string	"t\254%\373@\254\241KM\246@_\341\006\n\260.U\342\332\222\224G9\233\212\337\311\273\277w\314\372\2330v\352\326\256Yx\333\302\363\260\317`\366\210i{[J\020\313\257\373\002E1\206\332b\311'\224l\351k3\337\353\220{\307\276\313\370\231\032\200)Z\360\207\022nZ\321Atz.\346\355\264M\310[\251\264\337\254rE\277\002\206X\354\275\230i?\332wL?\313\032c\201\324\360\223\372\3568H\212/o\313;\221>\207y\340]\215eeo\bh\200\312\221\3012\312\314\006\303T\220\221\304\226\331\304?\324\310|\320\274\343%\224Mp%\212\025\206\353\312\216e\323&,kt\356\272(\006\021\273e\007E\203"
+	.string	"\003\001\023L^\237\220\310<\321\327\311\247-\351\016$\027\rX\326\226\360\bH\037\230\252\207\325\226\232\214\325>\375\026\023"
+	.string	"\302\310%bC\370\007\352\021\013\317\267\\\255}\335\321\214},\360\211\004\321\021\nR*@\372v\001_\024}\030\312)\343\372\003\003\224\025\3137cV\367\3114@x-bD\003\336\271\036\272\366\236\206\257\234@\231\300\324\323\323\220,\201M\345\263\371G\376D\310e\341\247\216\235$\376v\340K\204\\\026~\352\330I\342o\007\276D\310e\341\247\216\235$\376v\340KC\f\311\365J"
+	.ascii	"1\\.\306\366\235\3415\037\212\322O\200\364\230\226\343\037"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.24.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\332\003\315\027"
+	.string	"\366i\217H\340\322&\035R72\2450\332\020\311\337l\355X\310vZ(\347\2561\306\242R\016\207\252(\213\344\346\016\017\247\365\037\016r\232\030\007\252i0\2141\204q\2609N\355~\217\221\305\006T\241\203\325\245d\033!do)S\n|"
+	.string	"s"
+	.string	"z"
+	.string	"\227\016\277\227\270\t\227m\024\303\r\035\2364\203\307&d\316\271J\035\325]\306\227t\227\253\301\373\030\336Q]\007O\246\317\353d\\u\371\236K$\201\313\311h\257\203\027~\272`AM*\031|*\374\3231\253\240\002bFA\275\t\357b\212'\246l1\225Q\300\2343"
+	.ascii	"-B<\240=4\035\215\037~\276'z\204\201C\222\321~\256\236\313\234"
+	.ascii	"\323*\243\371\334#\267\255\303v\213\275'\002/\375\\ \033\345"
+	.ascii	"\341\177\"\325\250\337nP\252ORm\222\352O\252=\251\356\244ZJu"
+	.ascii	"\274z\243Z\243\372)%.r0\2101\247\204\034\221\211C\276\360\360"
+	.ascii	"\333?t\025>\221A\377\206\363\275f\337-\251\206\352\273\214\266"
+	.ascii	"\313\267\031\264S\\\310\365\241\234\3575[\220D\343\307\234s\345"
+	.ascii	"\322+8F\256\366O\034\205\353\241\213N2'P\013\027s\206*\033\370"
+	.ascii	"\002[s\267r\035\b\331\330\321%U\267&A,\337\336v\0020|\214x\001"
+	.ascii	"\323\234\334\232M\034\026e=\231\256\034\334\236"
+	.string	"\007\021\342\261\243K\217s\316\031\267v\234\016\\\224\215G1\fk;\3466\033\025\3301\347L \217dJ~\021\004\033}\035|\027\355{,\3004g\335\223\335},D\274it_\335\307@\350h\316\340~Ot)\002\207\304S\004\246\271\3359\347k\267f\207\0012\247\371\203\033\246\305&\346\346\205\265\232i\261X-\230\325\214\314\013k\005Sc\263jIq\213\246A\315\352\246\325\252Y\201\341\374\347\002\2416\005[\035\347\30493(\370\320\377#\205\n5\304\240i{\264x\211\017\357\2645\237\326\264&K\247U\",\246\001@:\323\247,\256AG\361\333\232\277\365\026\200\222\f\275\217\366H\336\336v\222\033I\353I\325U\340\202(t\213`\307W\374\304&S\202i\316\341\234\263\013]\250aX\246\230!!\031\221\202\244 i5\240\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!|\374\216\304"
+	.ascii	"\323\332\360\343\275\217=8\215*\224\370\350\306\336\356AgG\205"
+	.ascii	"r-\307\205\357\315\207\200C8.Ol\222#\306\243\275\211o A\226~"
+	.ascii	"\035\240\204\034\244\0274y\330\207J\316\025\237\035\347\225\r"
+	.ascii	"\354\346\271gAn\022\340\026\202\201x\230O\250\351\363\233\345"
+	.ascii	"q\235@\031\376\201\354\333\356\r\205a\202\226\2173d\027}H\260"
+	.ascii	"D\253\364Z\024;\303p\001\225\356\342:\230oZ\220)\243\366P$\032"
+	.ascii	"<\360\220N\373\226'\230\304)\260\034\244\327\tp0}\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.25.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\310\006E\037"
+	.string	"64\263H\260XQ:\262\247\246;H*\217\bpL\031\267\232)v\2661\227{Y\234\312%\003\320\367+ZF'Zi=g\350\361B\023x\277Sxw\310\037\312qZql\375\025`\2318/R\265o\377\333\377\244\221M\244L)\244"
+	.string	"\216"
+	.string	"\236"
+	.ascii	"\322\275\3618\236\003g\377\302\336\013\237+9\301\361Q\231s\336"
+	.ascii	"X\036@\274\f?\023/\327"
+	.string	"\205\345\303\336\035*\3563Y\f\366r\265X+UjD\2112\\\305\371(\006\341\215\337QNG\363\031\214\313`\364h\214w\030\357\205\276V\334\265B\205\266R\234\225\002\205\256N\\u\302\204\246\f\264\bQ\342#\023\235\022\006~tv\024E\342\242K\207\023\262\370nT\206* \321\317\245\363\020&\350\371\221\361\241k\216\316FC\031#\276\037zH\244\210)\247\033qE1\230sZs\272\0207\200\333\317`\333f\213\004\002\272<@\237%*^\036\233\366\336\357\"\325-\027\272gR-\223\352\230T\303\244\372%\325.\251nI5K\252WR\255\222\352\224T\217R\215\222jQ\252\245T\207Wo\250\326P\375\227\231\224%\016\222\314\t\"\3704\225H\243\030\027\372\203\336\303\037\362\312\027\3320\322\350\214BJOj\343\345h\343|\237W6\217\003\341\036\304a\244\321i\240\264\004e\316I\2734m\274<\013"
+	.string	"W\373:\276\003\367\236\213\036\233\223\007\210\2209{5\273\214\017H6\324\336\367X\022\245E\355\256\366\036D\274\035q\023$\335\307\007\370rM5\032DP\204F\016qw\026W.\005 $\035\324\251&\256"
+	.string	"\336\313\270\367\375"
+	.ascii	"\221)U\214j4(w\347T\317\322\026\225S\332g\233#/\005\310I\007"
+	.ascii	"uz8\347\234\341\356\276A\234-mC\340\215\212\265\375\340>\377"
+	.ascii	"Z\222\346\234\n$0\327\344\033i\360o\364\361]\264\3171Q\243A\353"
+	.ascii	"\272\354\356of\204\267\021\361\253\373\233\037\033\rz\266\337"
+	.ascii	"\017]\326(b\302\271R\243\301\335\236!\">\354\356\354\036M\023"
+	.ascii	"n\341\031n\030\333\005\t\030 \304\334*\310\304\304\310\300\334"
+	.ascii	"*L\200\020s\203\231\271p\263\025\260\214\205\b37\f223\267Uo~"
+	.ascii	"yZ\226\245fm\314!\234\263\305\202\007\375Px\264X\2611\213\355"
+	.ascii	"\3571\"\336\216L\2661$Y\254\212c\273;*\272\342h\222k\202\301"
+	.ascii	"\366\005{\275ZH\256\032\221\313\265-$u\325Z\333\332]-\310\007"
+	.ascii	"\370\316\332\235Y\273Z\n\254\332\352\311\206W\251]\002\362\031"
+	.ascii	"\023"
+	.string	"J\245\332\324\np\262\251V\237^R\262(b\n\265GI\212\204\2673\332\364\307\225\007\f\307\335y\\\324\266\232\216\2047p\037\200\237\250\201`E\221\214\214HJ\222\222\264\032\340\002\221)\252\007\022\240\2045\006c\315\225\024\245\230\375\337\002\310g29s\3741\252\035\367\374\\>\326\306\035j\325{\0351\271\220\330a\006]\274'\005<\322\217\013\354\n\375\254\0357\204a|I)\267\t\016\320B\371\261\203\243\366c\250Q\031\222\267\035\034[S\347\201\303\270\004\036@`s\275\364\336\346~Ko\345M\276A\316\260\230wqU\256\200{\336\200_QsaX\245\301V\244s \330\005n$\303\325\340\007V\013^\322\n\211\364\333\354\251]R\024\372\3138[\233\3633h\223\025[\235}\231\247\277+!=\235=\353\322\261I\372=\223\222\203\340\030\0020\361v)1\372\017\357\367\244\217\225f&S!G-\266"
+	.ascii	"\343\331@\253\261\036#\221\245\210\b\250s\021\364\246\356\306"
+	.ascii	"0A\221>\340:\223%\233@T\261\3040\225\323\200\273\202}\bF)E\""
+	.ascii	"\243\346\023^\374R\013\345*\026\r'\234\027V\242\022(\237I\232"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.26.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`K\013\315("
+	.string	"\032A\310\rJ\260\226Q:d\306)t&\241\304\356d\357\034\250\211\375\361\314p1\211+]\341%E\341p\332m\375\200F\343\376]\211C\375c\263\243\376\344\2671(\375\336\256\371\324\3545\223\351\306j/\377\333\377\366\277\375_\362\311&R&\031\322"
+	.string	"\263"
+	.string	"\305"
+	.string	";\300<]\242\371\244\323\310\331\205\"\211)\214\256\304\212OqJ\255u\370\362\\yJ\376V\2366\212e\235$~I\3169\320\245\345\347\353\361Xv\272\034\356f\253\321f\262\030\354\345j\231\254\222\222\3159{V\f9C\352\370#\244s\340\322]\226jp\213\322\177J4\330\227\364^\322\f\346!\235\005I\006\357\216\256;j\3019\026\307\2610\342\333\212\333V\250\340Z\321iE)xf\3422\023%8F\3420\022#\370%\342.\021!\270\005\340D\007\0207\217\004\201"
+	.string	""
+	.ascii	"#h\210Y\037^\222/>\344K\261\207)i\326ZeB\032H\003\f$\304\303"
+	.ascii	"\344\013\017\357?\235\f\"e\374\021\362pf\305\324Z\227\177\204"
+	.ascii	":|_\276\313\fvW\270\333R\nM\254U\247\373\334%\352p\023\021\233"
+	.ascii	"hw\346\304\037\001\345\225\271\361\013\244\274.\224\267\205\362"
+	.ascii	"\376(\257\217\362\366(/\217\362\262P\336\035\345\325Q\336\034"
+	.ascii	"\345\305Q\336\033\345\265Q\336\032\345\245Q\336\031\345\225Q"
+	.ascii	"\336\030\345\205Q\336\027\345uQ\336\026\3455)/\213\362\226\224"
+	.ascii	"\227R^\362\274M\3622\311{\005:\027F\026H\251\225\303\261J-B\177"
+	.ascii	"\034\335\3707\335i\377\264\257\275\361\202\251\023d\032\231l"
+	.ascii	"\b\232\247\262\335\234}q_\2736\316\224\363&\f\246NP\002%\307"
+	.ascii	"'\265V\230\323\2051O_\344w\336}\215/\345\234\270<^\253\225(G"
+	.ascii	"\217Z\211\301M\332\211+\330Br\234\223\220\260\\}\256\253[\255"
+	.ascii	"\273\242*]\315U\202-\033\224\262\325g\263\020\2362\233q\234\213"
+	.ascii	"\242H\263\3175\233\3251+\241\331\247b\365\213\257\021Q\322,\332"
+	.ascii	"w\332Q4T\022(\360\033\337\025\177\254v\370X\366\271e\323\256"
+	.ascii	"a\232\312\300W;\365\215*O\313\326\025\0210\373\305\007\210*\""
+	.ascii	"\375\330\341#\355s[*z\246Y?\fs`\003=\n\323\222\f|u\262\326Z\311"
+	.ascii	">\177\241\004\366L\223Q=%zwc^\\(\001Ij\255\006h\324\217\325^"
+	.ascii	"\312\302B\231F\373\345\321\007\n\261\303\307\345F\320\335\357"
+	.ascii	"\211A~\207\224o\356\367\300\340\341\343\002\373\375\247S\031"
+	.ascii	"RF\237+;|\354\020.\341\025\2764\302\t\017(4\260"
+	.string	"\031F\270\261\261\271\241\031F\200\320\300fH\2033a(\354\355\215\004\0078C\n778\303\027\261~\211M$\323/;\315\263\030\310ZO\034x\323\377\304\206\f\225\005\366\031\365]\361.}\256K\267t\215\213\260\305\210\264-\276 \2779a\375~\355k\335\325\317W\372x\335\013\002!{}n\257y\035\263\352\005y\315\353\263\352\007\013K\357\246X\252vTv\327\247\017\235\256sT\272\\\356&\354\201\303\365\r\327\247\272\335jT\266\206\372\256x[\237k\353Z\327P\331\230\324\234\220j\263)\232\220\007\255\317\245\365\254uW4\341\254\234\305\232\205\3346U4$\223u,(\213\305^U\260\326\001\203\365\253\212\2041\341\027\225}\265\272\003\201\006\250\221\\E\221\214\210\210\244 )IZ\003A\006\204 eV\035\022\340\203%\310b\re\"A\323\302\326\377;\322P\316\313\272\233\"\237\372\347\224G\354\2468"
+	.string	"\320\260\354\352\020l\320\007\361~\001\365\007P\242\253O2/\\\230\365~Z\002\356\301\2137\314\376\022\314\221\254(F\207Y\331\215\261Q\001y\213"
+	.string	"\035\025DD\271\251K\276\266\207\215\022\353\3741\007\b\022\221\235\350\024`3\025\321'\004\335\307\360\fpG1\207\n\\\\\312Y\242SI\n\231\232k\321\331\236w\274e~/\217\235~cx\264\007\251\314\022\bh\037\"\327\202A\237`A6\253-?\t\200\371\271\333\363\220\341\220\224\023\030\212\222\306\020\r\bv\034^\314\024-\312J\343\327\363\346\224Mh3\320 6\"\207\3475\314p\324c\315\246q)s&;\311\260D\322[0\354\211\217+\261<C\247\301\265Z-\247\".m\375\230NJr\327\311:P-r\r\027\3642c\023s\343-\322\302%\254\255.M\316\257\027s\020\321\276\251\2377N\003e\200\021\275\215\004e\375\037\253\277\264w\234\034O"
+	.string	"\271I8\231\322\310\231"
+	.string	"\375\277\366.\277~\301g\312t\177\020A\246e\354s\374y8\321K\344\27121\001\244M\002\237_9z\353\272\216\241\264\226P\226+\217\tC\255\340TU\0253\036\372|\200\353\001~\376\220\347\013\270\017\260\373\007=\037\340\365\200\235\177\310\213\317\030\261\247\177\311\030\212+1\222t\260\274\322\273\261"
+	.ascii	"\3571\351\304?"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.27.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\322\017\r2"
+	.string	"\252N\360\020J\240\326U\007\002_\fk\231zGg\315\221\036\216<h\251\243\274v\3360\347Y\363\222\303\345L<\300\240\210\317-x\344\022\002\225x\274\n\257\005\257\2037\343\357\270\001\322A\233x\356\357<\217\337\377\377\377\377\377\367\336r\247\224R\t\001\335"
+	.string	"\366"
+	.ascii	"J\265"
+	.string	"\221\032\207\017\363\323\251\\\341\242\245\204\330\260\274\302\262,\216\260uh\337\263qh\337W\301\256>\225\315\247\373\364\221fF\306\030\003S$\276\f\205A\027\340\317\327\343\265\354V]\016w\263\325h3Y\f\366r\251)z\317w\037\356\324\300y#\211\025!\242\237>J5\215T\022\237\211j\231($n|\352\230''\207i\352b\023\223\023\227\372e)\210\017\201\264\020\210\222\007w\264\313\016\035\016\314\321\277\0348\334\207\324=\244\033\316;\352\226#\033\276\213\321k\f\030\256{\321\271\027.\034\327\242o-X\270-\331\265\344\n\247\231\350\231\211\022.#\3211\022#\034&\242_\"B\270k\210\302\203Q\253M\206\214\2063\206\212<\005\321\350\214h\303)\\\006\371=Q\032FM3\"\r'\001\246'4Z\251\235\003\021\006?e|\350o\245>\215DY\t\021}hO\r\260,\313.D\344\241\271\246\231\037"
+	.ascii	"3\3370\313\030\004Oh\030\375#\231\225?\036\300\210\251\345O\301"
+	.ascii	"\254\323\312\356\234\353\234\240\223\232\217\327\231\346:\317"
+	.ascii	"\\g\231\353l\274\3161\327\031\346:\027\2573\361:\277\\\347\341"
+	.ascii	"u\026^\347\340uv\271\316\300\353\374\273\316\276\353\334\273"
+	.ascii	"\316\274\353\334r\235w\327y\275\316\272\353\234\273\316\270\353"
+	.ascii	"|\273\316\266\353\\\273\316\264\353<\273\316\262\353\034\273"
+	.ascii	"\316\260\353\374\272"
+	.string	"\316\256\353\254^\347\364:\243\327\371^\347\263\235\377t\366\323\271\025\254SL\020(a\331\016[Z\354\222K$F'u\373\350\037\334J\f\343N\262\240\376\f\251IRH\330\250}s\314>\334K\2061\363\350\036>\355\343\202\3723t@\312\210+\226e\217}\371\250\366\365\023\305v\346\326\321;|Z\311Nmc\331\024KBXVi\3033j_\016\262v\366M\263\331\313\332\331\215L\006\373X\rS\357\226\035{$\307\036\366;6\261\032\230\221#\206\271\256~\312[\275\232\017\265\324\216\344$}\275\336\365k\326\225\372z\327j\246\256\033\025\324\225VA\265S\311\"\265\365 \355I\346\251>\222\325O_\206U\325\314\374\206\322\236\351\367\262mJ\242|z\277\1774%\213\320\027\3206\220\336-\205\260\200|\213\307\364\244\006\372HF\377\376N\217\251\f\236\305T\336\314D\373\242\277&m\324\357e\023\231OX\210"
+	.ascii	"\371\326}$\273X\274\316\247B~\354\343s\350*=\2522xV\237,\313"
+	.ascii	"\262\347#\333\002z|\235?\231A%\236\231}V\364\222\237\214-\313"
+	.ascii	"\262\003.S\b\213{\252\002?\251.\270\331\351\233C\b \337b\377"
+	.ascii	"\234\377\357\240\032g\263\024\332\357\337A30\370\026\037\277"
+	.ascii	"\277\225\372\332\210\262\332\220\005\310\267\376\231\002\016"
+	.ascii	"\032BSh\326\271\221\320`B\016\017\316\203\036\036\236\036\035"
+	.ascii	"\234\007\016rxpt\"H\300\271\351q\017\204\005\021p&\364\364D\300"
+	.ascii	"\201)\331\376\024\t^\b\364\030\370\302\311\262(\n\264\217\356"
+	.ascii	"+\036\t\240\216\370H#E\363H\246\371\231\337\241\242\371u\346"
+	.ascii	"\b\226\031c\233\244qV\311\"\031\2317\2662ZF#\fUL\033\025\023"
+	.ascii	"\3630T1-\314\303<\022I\361\221\\|\342\3574\213\277\022\217\034"
+	.ascii	"1\361\221TP//?\254z\241\032\242\303 \324\221\276M\235\302G\262"
+	.ascii	"\360\203/\303\022~C\t\006\201\317tqy\240\226\313\r\020\013\320"
+	.ascii	"\327\374\265F~\277\3675\177\255\017\365=\262\252H\257\367\274"
+	.ascii	"\253\036\217\267{\"mkJ\026\265<\222[~\367;7-5;\346\321Nw\265"
+	.ascii	"6\207\244\353\372\272_\263\256\326w\255\246N\207\253\312\275"
+	.ascii	"\220\\\356qU\271\026\207\263\335\236n\267\267\335llXl\264fM\313"
+	.ascii	")\255\325\236\366kV\263\246\205\322h\001\201a\250qhd\215\214"
+	.ascii	"\210\210\224$)H\2061q\006\"CU\306\r\022@\222I\216\307*\312\\"
+	.ascii	" 2c\033\373\377\0061\274<\304\277\276\302/\340+\235\275/\212"
+	.ascii	"~\247\365'\356\251H\343\004\177^\360ga\376\037\214"
+	.string	"\357\261\250\341\334\376f\037\325.!\341\230\002[tq\217\323\307'I\005\003\201\375\275G\312\263\230\334M\035\367\266fj\361Q+`\227\363m\rF Y\"\375q\013F1\220\342\023\017/\361Op\225\025l\353\003\352\335\340\264\"\327\311X\322\215\222\030]\224+\227\277(\252\321o\034\n?9\026\345o\226\217Sh\313\250\231(\003\016\031h|\320\305\215\306\026\232B\363\350\351\234\177z\261\tm\016\300dqS\265KA/0\002K\240\234\341\0254\230\006\310\367V\310\332c\357\027c\220\346Lz\304\347\246\241\330\202\275\274\f37\b\251?C+\371\203\363,\323m\030\243e\324\361\t\004\016\345\220\326\316\303\353g\374m\352w|\236\024\362\024\260\214<E\247y.&\372?\327\375+t\203\230\240\232`\367Xq\252M,q:\326~\"xUW\237\016\350\004\330\227\364O\266\254\313\bJ\274*`\233\272\b\365"
+	.string	"\371\036\307\236\256\2021Eg\264O\nQ8\377\314\263Kd\210j\25568\3054Q5 \210`\200\307a\261~)@\245\275\\\227\027\304\315\227{\326\025\200\333\3718>\224+\250\261 i\317\214\313("
+	.string	"\310\315\002\227\271\202x*\340\374\037\331\203\221\364c<h\006\353\007\364\375\265)b\306\264\356}\260"
+	.string	"5\005\330\233\204"
+	.ascii	"~\345\3657\026\032\206\212\353D\002p97bG\022}*\237&\030\266o"
+	.ascii	"\317+\247\353E\325\214\323\217Q\265\262\3505\363o\211Z^\357\213"
+	.ascii	"\365\211$\035\253\266\345\3703\244\336\026\333\3207\364\327+"
+	.ascii	"\273\354\272B\005V\302\254\341$;J\334\004\234I\323f\374\003"
+	.text
+	.section	.gnu.lto_arraySubInt32.28.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\032\002\305\021"
+	.string	"6\"vF\360\356&\035\306_?n\"\261\361\314\303]"
+	.string	"t\243qG9\267\271\273%\177\313\352^m\364\274f\275\371\3303Y\273\240go\215i4l\254|\"\273\346+p<\217\362qm\\\020|\fn\2521b\t\331R\246\024`"
+	.string	"`"
+	.string	"^"
+	.string	"\013\202\370\200w\316\340\005t\347\274{t\347\f\263a\034\264\331\367\224p\321\221\261\273\237v\260)\f\303\360\021\274c\302\316EM\230_\273\201[\214\031M\345\\4\265\300|@\321Z\242H\322\021\320m\317\027Z,\243\b\231\353mGp#\232\321d\236&\007\273\353\234\321b\356\356\266-\330\206`g\204O\2332\335=\315e:>\255\232NM?\300"
+	.string	"%\026\022\204vaB\245-\342\200@\234\347\366U\3706\036\007y*\031\274Z\217\211\243\335\3758\347\007\336\271k\330\316\024\327\201}\307A\021\300\262p\320\360\263\273 n\340\235+\020\357\321\345,1"
+	.ascii	"\207B\236\366O\374\006v\234\224\247vin~6H\235F\365T\215d!b\035"
+	.ascii	"j\322\277:\224r\032\215|\237\013(\236\007?\245\373\313\314J\206"
+	.ascii	"N\345P\325\313H\304\373\326]S/\033\021\313\320'\275\336\366\210"
+	.ascii	"tk\3412c%C\325\232P\013M\265\306\006UR\304&\351\310Jc\247\216"
+	.ascii	"\363w<\347G\035\3749\276\363o\234\347>e\332\013$\177\225Th\255"
+	.ascii	"\270\005\n0\250\\.U\367:\031\231\020\275\n9\241\360R\261\276"
+	.ascii	"\222\026\213\325Z}%$*\326\267r\235|!\004\3342\031q}\257V\313"
+	.ascii	"\365i\200{\245\361k\367V,\025\255h\214\323\032\237f4\245\372"
+	.ascii	"\"?~\322\227\r=\351qP\f\261d\322\343\356nt\202\2374\245\217\271"
+	.ascii	"\021\3116x\352\373\230\240\240\\\244\317,* \240\202\031\313m"
+	.ascii	"#\016\224\003{G\226[\224\276\265\240\214\244Q\370(\376U\034\331"
+	.ascii	"\221\231y\233\006Y\301\211\005,*\260\004\213i\256\262\225\331"
+	.ascii	"\036d9\355\266r\ro\030\215]\334\2601\265\016\247\003\033gmv\230"
+	.ascii	"!\f\267dbin\300(\371^>\213\2440T\215\367#\322\271\304\023"
+	.text
+	.section	.gnu.lto_qPercent.29.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"U\b"
+	.string	"FP:6Po\322\0015\241\031Q\265w\301w\216\313\021\346k"
+	.string	"@*\206o\216\332E\2725\204\334\327\306\017b\002\226\336\231\231tU5,\256\333\223\020T\236\241M\266\224)\005)"
+	.string	"+"
+	.string	")"
+	.string	"$2\273\033\tn"
+	.string	"o\345\013\340-\3158\367\344\374\217\374\245R('\224\350\t\320\260\273\316\023\252\342\326\333F\260\255`\233%3\333b\251p\330\336l\215\355L\373!\027\331\336\205,\260k\341\221\262\273\fN\b\270\265y\266\375\217\203l\346\262\323\240\200\033%\246^\201\327\324\214)\251^\036\202\252\327<)u\220rew\242T\f\373o\365\302\357\335\257\232NM\037.\230\334\005fwb\025\022\367\305\371<\200:X\364d\030\226]\321\003\321\301\342\245}\"\347\300Y\204\203\026AY\246EM\267\367\323\315HIN}z\223j\224+\017<\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.30.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"5\t"
+	.string	"f\322?6@\217\322\001\t\254U\307C`\345\270\315\262D\202\230\300\314{c1\236\222'j\373\310\235g\356x\262]\241\263*\212\206\003\227\013O\272\r\220\036\375-\333\233H\231R1"
+	.string	"0"
+	.string	"-"
+	.string	"\\v\031\022P#$\345b\331\3358\360\002\370\227'\200\177\212q\356\311\371\007y\266R\242\242Z\225\236"
+	.string	"\013\273\353T\255&n\275\355\003\333\n\3661\001\021\261\226=y#\033\266I6\306\266\346[\234\337.\305Ks\371s\246}\217\177\220\336A8`\267\202%\262\273\tF\270\374e2\333>\353\035$\007\352B\301\236\036\305q\312\2303\275\246I\nf\312\230\335\225R/\354g\253\026\266\323\360\335\377\336\3723M\253\246S\323\277h^GI\331\r\243\007\320\307\363\034\356\316F\3240\342h\361\263i\332\326\211\037\017G\213\235\220(n\f\274\201\030Bq\264m\241\210\351\366\206\2321\351\311\252P/p\223\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.31.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\005\t"
+	.string	"\306\021>6@\217\322\001St\204\357\364sw\001\303\331\210(h\321\037R\264\234\360A\272o\353\245;lE\223\235\3204;\206\201`~u'\310\261\001\322\243k\365\336[\312\224\002/"
+	.string	"/"
+	.string	")"
+	.string	"\027*\210A\202j\261\354n\314\234"
+	.string	"\376\271\017\300?\265\370\3509\362\357q\247r\002\222R\221\236"
+	.string	"\n\273\353L\251$n\275m\003\333\t\3661\001)+\273\021/\327\242<\221\f\333\"\033c\263J4\227?k\332\347x\207\350\033\204\337\356\304*dw5>\270\374\t\244m\177\343+\221Gn\013\036\201\327\324\237\\\246|\331\3515?P-\245|\331\033)\265\302\276[\245\260\235\206g\375\357\333\3574\255\232NM\377\202`\362\231gA\261\207L\335\331\200\030B\034,f\032\206i\235\2305p\260\330\371\200\342\246\300\232\203\347\023C\232\366\211\230mo\250\231\222\232\024\352O\032OU\265\025\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_quaternionTransformVectorBodyToEarth.32.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\202\003\375\024"
+	.string	"fd\201I\300\222U:\340?\341\013\340\005}H\255\377j#\207"
+	.string	"\353z\312J\331\326\332\374y6\177L\227_>\rY\306\r\275mO\264\006\"\275w\t\377_\220\007\266)\304\320.\333p\260m\243xf\332\205.\333\312\006\206\366\227;\245j"
+	.string	"f"
+	.string	"o"
+	.string	"<\020\300\343<gv\235\030\3702C\352\355\270\021T\353\314\201S/"
+	.string	"O_S7\231\200T\345\220#\"\301\247\375\025g1\273MvU\2555>\236Zo\bl"
+	.string	"<\365\355"
+	.ascii	"BN\301\227\204\234zf\367\370\255V\357\342\307\003\216\250\326"
+	.ascii	"*\256\211\317>g\376u'\321h^>E\032\324Z=i4 \356\275m\023\333("
+	.ascii	"\366\376\002>\"\"\230\031\304\276\305\314%a\177"
+	.string	"T\267\306\246\323$tZE\247Stz\204N\243\350\364\211N\233\350tH\247Kt\232\364\333?\272\355\237\004n\223\"G\005\212\257\326\017A\200T \032\303\346:\177\316\177\361\235\226\357L}\204h\261\303\026\347\331\241]\276\263\204\241\320\305\016O\347q\3279\314\305\n\220j-Q\013#\344u\240\212N\245iO\345q\230v\177?n\302Vi\303}\016\231\326\201J\273\277_\221\215\264\270\035\277\376\243\201\264\337\271I\356G\262\344k\220\354\366\f\335\250\266\274\217\252(\2653hB<\267.\303\251\335\036\337\215\3550~\236_\327\271\267\265\363>B\301\303G\023\352\331\236&\366\353<\356\201\265V\005~oC\fU;!\0139\245\035\002\256QE\205\305\301i\204\245T`\271\300*\037\224\214+\326\350\032U\306\b\255\222\253\204\255\306\t-\021\257N^\026`)\244\310*I\262\\\211\254\225\024R\\\271^\342\311"
+	.string	"\227\031F\227\b+K\227\030\336`>\252[C\301\006\020\314\306\350\304F\265\216`\360\334\037\2043\347~w\\"
+	.ascii	"\032\246\371\335u2\2206Z{\005\303<\315\327\275\344\343\003$\263"
+	.ascii	"/\036!Q\033I\250a8\b\211R\214F\202LR\222&\035\300\002\031\272"
+	.ascii	"\252\003\021p\261R*\230\242\214\265\006jZ\264^\235\224\367\027"
+	.ascii	"[\003\220\b\321|\353\033\257\363\201\261'\260\322L5%\024\224"
+	.ascii	"$\035\346o\271\216.\017@`]\202\214\361\376^8I\270\007\232\264"
+	.ascii	"L\273\332\031U\212]\354\354j\357\355\363\304\316\357*L'y\215"
+	.ascii	"\223\310\2351{\223\375\237\324\\\b\273\027\2501\023\326\016n"
+	.ascii	"\3630\300\245/.\020\337\230\300+Z;v\246\034\002\027\263,\006"
+	.ascii	"\323\002\216\037\372\376\002\021T"
+	.text
+	.section	.gnu.lto_quaternionTransformVectorEarthToBody.33.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\202\003\375\024"
+	.string	"v\244\201I\320\262*\035\262<\005\305\301\203\372\037hgQ\037@\200t\315\250\026\240&\026Uy\031\310\254\036\n%\314DZ\377?B\022\336\007\221\356\022\t\221\3162&\276x0Dxx\035\263\017\242z\206U\350\246\266l \333Fr\247\024j"
+	.string	"f"
+	.string	"o"
+	.string	"<\020\300\337\034G\366\034\030\350\"3\332\351\b\372\251U\346\300\251\027\200\247\257([L"
+	.string	"\252z\300!\221\340\323>\213\267\220\275\026{\252V\232\036O\2556\0046"
+	.string	"\236\332v"
+	.string	"!\247\340KBN-\263y\334F\253\177\321\003q\013\252\265\212\213\342\262O\231\377\334G\263\031\227O\221\006\265V\317\331\214\210{o\333\304v\005{}\001CAA/\363g\333`\346\232\260/\252Kc\323i\022:\235\242\323(:=B\247Ot\332D\247Kt:\244\323$:=\272\355\027\275\366O\002\257\371\341\254\260\360\2535\304o\250\362\250\214\232\347\3748\037\306wX\256c\032d\004\213\035\272\270\316\016\335r\035K"
+	.string	"\022\266\330\341\351\374\3559\2078X\201Q\255'h\001#\344s\234\204LeiM\345o\224v}>lB\026i\303=\216\030\326y\244]\237O\2506\332\333\216]\267\301a\264\337\271\t\316G\262\344k\220\354\366\364\260Imy\237\224\020ji\314\200tf}\206Q\273==\233\332c\374:\273\236\363ni\327]\244bGo\006\264\263=Ml\327y\274\003k\255\n\374]\007\330\211\226\"\026rJ?\004\2551%e\305\201i|\241\\X\311\260*\037\224\214\252\325\330\032S\306\b,R\253|\251\306\t,\021\253N\\\030^(\244\270*I\262T\211+\025\024RT\265\\\342\311"
+	.string	"\227\033\306\226\370*\313\226\030\332^.\252KC\341\307{Y\230\034\230\250\326\022\f\216\373\177n\346\317\2459W\264\001\206J3w\235\337b\340\314V\3210?\363s'\371\374\340\305\254\213G\310\323\006H\250Q@\b\211R\212F\322$\205\005M:\300\002\021\302\252\003\021p\261R(\030\242 \n\326\032j\264hMu\224\305\250\333\032\204n\212Q\315\272\362\346\222\n\277)#\204J\024\322k\234\222\022\t\006\021\"n\022\311\260\367\371\335d\245PGK#\264\323\021\260\024\333\303\237,Wg?\314\027<h\021%yk\256\213\376\214\2657\217\377\204\313\205\204\230\326\0333Y\355\210\027\031\324\272\260\213\315bH&`\bjG\357\224\213\352\315\020\006HB"
+	.ascii	"\343\207\326_\310\202\n"
+	.text
+	.section	.gnu.lto_quaternionComputeProducts.34.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\352\002\365\017"
+	.string	"\266\236fC"
+	.string	"\261&\035\254\303\277}\322\207\377C$\236\005\023\023R\315\304V\220\307\370^BU)\320t\243\340\007\323\301\001$j\222tY\324C\373\245V\004\337U\353\357$9\355\036\033\245o33k\t\241\335\222L)S"
+	.string	"L"
+	.string	"T"
+	.ascii	"!\332z\324\026\273\024\001\035\211\201f\303\207\261\365\b\223"
+	.ascii	"Py\245b\217\314\030\030*2\273\217\036\310\374\3329\300\345\227"
+	.ascii	"\031\300\345WU;\303\235L\372\306E\003\313Ffj\377`\225QU\273\204"
+	.ascii	"C/0+FLAf\026_`:\270w[\003m\021\264w\t\tj\032\t\0272\020*\227"
+	.ascii	"\237\377jX3+\026\374i\273\025\274\207\326\240\314\314>\246ug"
+	.ascii	"{xew\034k:\266t,\351\330\321\261\242cC\307f\307b\307^\307\276"
+	.ascii	"cA\307\376X<\326\005^N\212\001229\374\340\310\236\307\"\355\311"
+	.ascii	";\277\350\234\317O\350-\312-\376\3209\237\032\331\333\020\347"
+	.ascii	"`\3673\n^\201\335\270\336\212\030\347\335\277,\370\346\035\323"
+	.ascii	"\251\231\001\275M\031\305\357\2036\237\3701\035\326\215\025\276"
+	.ascii	"%\261M\r\004\223\222LJ\216\027\032\276\217?+\203\210\226\242"
+	.ascii	"\330Dq\262\314\f'(\033\003\2227\262\200\344E\201\230T89\245\264"
+	.ascii	"\221-\225\332P\332\210\310)\245\241JL4\020\002\335\270\220\022"
+	.ascii	"\355d\333J\264Q\227\006\345c\352`\246\207\345-5\275m`\036\354"
+	.ascii	"\246s-\236\322\333\007\216\361^:\327\332!\275\215\340\027\357"
+	.ascii	"\244s-\234\321\333\tv\361\217\316\265lD\017, \340\202\0219\326"
+	.ascii	"\001\002CO\312\300PP9\3326\030\232\311`\322\315p0\2345c?\230"
+	.ascii	"\037\315\330\016Fl\233\3511\230\256\036\017:\030+lW\217\007\264"
+	.ascii	"D\260,\022d\001lM\306\370 \323\304L\256\365b\330\341\3661\267"
+	.ascii	"\006\350;\204\224\r\301t\216h\031z\341\016\013\270\320 ./ZH\006"
+	.text
+	.section	.gnu.lto_quaternionMultiply.35.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\275\004\355\030"
+	.string	"\226.\233G\300\226Qc\364\013T\022\0208\021\276\005\343f\037#\t\314\271\327{'\024\201\210o\332\004\301\227\310\353\b\035\215iN\242\261\376\307vE\020\004A(\333V\340\326\203\002\227\362'\300\246\360\r\203\037\375\266\311\336;\311\224\002\214"
+	.string	"s"
+	.string	"\214"
+	.ascii	"v\223\355d?\031lm&\3370\016\377\332z*\201\300\311\350@\223\206"
+	.ascii	"\332\206\327\354\340!\305\221\201\3216\254\224\363\222\2061("
+	.ascii	"\304l\210\205\n%sN\002\016k\033\035\326@\032@\264\327\334P\243"
+	.ascii	"\203\216\017\t\001\313\3261,#\347\036\220as\026\375r\314\351"
+	.ascii	"\323\351\200\321a}\226\211\016G\307D\207\315\265I\3543\232\376"
+	.ascii	"\021qPj2\347\264\035\205s\226\271\332?\263\206D"
+	.string	"\004Y\256\026\3149+\207D\214p\357\266\001\332&hC\006\001/jM\303\026\340%7\307M.\216\235\334\033?\2716\366\331\001\334\263\001\\\266v\331\232\313\322\\v\346\2622\227\215\271,\314e_.K\273\254\313eg\227\225]\266\345\262\261\313\262\\\026v\331\327eW.\253r\331\224\313\272.\333\272,\312eY\227\035/\273\272\254x\331\360\262\340e\177YyY\353\370\305\214\032\037\"0\231\023D\225\223\031\025\352p\341\245_9\214\b\274\374\313_9n\212i\307Sy\3536\227\277\224\273\256r\232\221\035O'\004)\345f\222\352\t\335\034$\311u\333@\371\352\255\207OX\037\217rq\311\216\247\003\302\272\202\n\3761\036\201\370\177u\360\267;\322\311\252\206\007/>T\332\361t=\220\302\353H\365\204|\274#\t<N\ny\377?\217\035O\247\003I\236F\252\026\234\243P\343\2343A\r\225K\372\031W"
+	.string	"\211\016\375\360\b\024UOHV\265\276 y\023\255\301\031?\276`\f\316\340\233{,\301\335)\340\003\001\347\200\3076\341\306\303s\333\261M\210\340\200\307\266\323\343c+"
+	.string	"\323\033\205\007=6\334\355\326ck\371\246\301\371\242\006C\242\204\256k\316\217\370\200\201\363\"T7'\322\003\206\315\243Z\374\334\350'xP\221\250\275\3469\3625\232\317\274\346(<\215\314c>\003^\306\2179n\312\007\314_\216C\024\036\206v\227\277\214\227\247]\\2\273\354.\007\301\317|\331qSP-\217\375\306u\326[X\016{\214h<\313+^\250A\\\006\021$D\322rJ\222\326\360\002\021\251\2426\021\300,\020M\206Kk-\007\003X\350>\035JB"
+	.string	"\f\240O\236\034\006B\225\216\367\300\016M2\007$\225\013?\345\315\316\236\315\214\035F\262\200\326\032\303\264\314\006\026\270\271\343\"\242\240\205\363\\\t\330\324v\265)\340\\\357\256~\272e\231\333%"
+	.ascii	"?\203^\354Q{jV\302\356\247T0:\3757\247\316Tz\232\330L\225\025"
+	.ascii	"#=\305w\230\323\032vs\\;H0\311d\357t\224\024\260\251\0160N\026"
+	.ascii	"\211\214\233\003\245\007\361\2432\0221M\300\247\355l\026\340"
+	.ascii	"WA\220Z\024\360\017"
+	.text
+	.section	.gnu.lto_quaternionNormalize.36.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\024\002\365\016"
+	.string	"v\334aD\020\221\223\016\020\211\271\224*\301\360\362{\027\212~\303Gk\211\324\024n\254\226\262\312\177\313}\345\366\313\032\"\370\327\007\261\375\"P7\235]T"
+	.string	""
+	.string	"\n\026("
+	.string	"\r\372Fl\3051\336\017\346\212\204\220\275\245L)M"
+	.string	"H"
+	.string	"N"
+	.string	"(\347\354\222\\^v?\004>\200=\372\373"
+	.string	"\353\021\273"
+	.string	"\353\321\235\r\343\037\313~E\013\005\0234vW\323\016\357\0165;\377\002\331\020\215\274C\f\327"
+	.ascii	"#\020\354\330\335\237\236"
+	.string	"\025F\241\314\013dw\235\242\321\205;\336\366\002\333\t\354\\\t\366M\367\346\245?\3134\226\351+\323V\246c\246a\2465\323\231\351s2\0205\251\021\324\356\312\252fU\021\346\303M\277\375\237\234\331\337Kt7\031\205y\0268T^\210\220\261\273\036\217\366\300\036;\340\323\376\210\223\350^\n\242\031\033\275\246\236F%\006\224+\333%Ga\024\266\273\n\374\023\"\037\314\303\243\217b=^\225\203LK)%W\271\273\236\242l\247\201\215\022\b\021\343\344\"\2245\0343S[\302\204\274h\243\03414\252\220z\366\347\245n\260\017ww\255\244\237\023\b'\r\270\355*\271;\037\037\021\223\220M#\341\266\215\353h$\017B6\255\343\371h\037\005\314Ep\340\321L8\316\243e\337\036\256\222\314 \203*EA\020\323\026\227b#gq\2515\223\262\024&\252\265\375%\2525\243\001\252\213*\344\256B\325\222I\225RS"
+	.ascii	"`y% \300\002\031Q\352\243\320c\214\001\310P\241\334\233F\243"
+	.ascii	"\274\262\205\023;\323w-M\026\bb\034\217R})(\013X\341\034\273"
+	.ascii	"k\202&n\256B\3468\232\003;\366^m\301\206=v%\322KK\036F\364.\270"
+	.ascii	"\226+n\336\240\002\272\304\001\313\225\333\256\245\007"
+	.text
+	.section	.gnu.lto_quaternionAdd.37.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`P\002\375\r"
+	.string	"6\030UA\020\221\232\016\213Z\263\020\204\251\261^{\370\263\363/\021\233F\021Io\353\327F"
+	.string	"\261\004\340\322\201\020\377\377\034\024g_\273L\026Y\002"
+	.string	""
+	.string	"(B\321@\325\347{6V\376\261,\0315\241MdJ)@"
+	.string	"9"
+	.string	"G"
+	.string	"$8\207J, \023\344\362\222\331}\024A\345\327\316\036\223_\345\001\223_\271\226\206;\225\264H\204\241\345Ffb\330\301\234\317\325.a\353\223b\342S\0132\263\377\244hp\321m\017\264\345\264\267\021v"
+	.string	"w6"
+	.ascii	"\207\354\216\277\233\277\327_\315_\353o\365\227\372;\375}\177"
+	.ascii	"\245\277\370\367\177\355\361^\200( \312\3140\203#c\036L\210\266"
+	.ascii	"\276Z\226\034\037]\214\004~\353\021\016/\017%\234R\274\nF\021"
+	.ascii	"\"\311\204\020O4 A\025\263\370\3248\032\021/\272\260\001\305"
+	.ascii	"\305\301\221\200\207Z\260\211\252\2502SA\335\022BR}(\231\374"
+	.ascii	"\2148\222\261\022:\371L\333\231\0349\264\22623\213\240\326,\001"
+	.ascii	"\2327Kp;\034\017\204\021\220\f\023\321\262L\353`\"\021@2\254"
+	.ascii	"\263y0\216\201j\023\036l\330\210\246m\330\325\245\245DP\031\210"
+	.ascii	"\2109A\224n\020\306\205\032\334\270\270(\270\205F\306\302Q\205"
+	.ascii	"\024Z+*\217a(\304\321\214\225\t\0034 \020\003\021\311:\342C\217"
+	.ascii	"\247\300\0208\005\367U\340(\263K\031\330!\001\273;\202S\300\336"
+	.ascii	"\027[\231\261T\200\207i\331\023\234\003\346>\330\312\214\225"
+	.ascii	"\312^\300;\330\227\355b\001\243\035\321\022D\265M\344\222t\254"
+	.ascii	"\313\254-\n\205lq\366\"\3055\224!\214\376\210\2631\314\035\314"
+	.ascii	" \344\301\214\021\001(\n\300\313\213\326\223\001"
+	.text
+	.section	.gnu.lto_quaternionCopy.38.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`L\001\r\013"
+	.string	"V\323E>@\307h8\340\312\312\212\253\373zm\005\247\352\334r1\361\027hC\360\n\004\324\037\007\253\260\220\202\020\253\363\216m\033\271\207mM\373\r\303\314P\032l\271C#\374D\f\375M\366\336R\246\0242"
+	.string	"2"
+	.string	"5"
+	.string	"\327<~a\273\306]a\273f\321~}D\355]\006p\2400\330\335NA.>E\377%?(\231FO\214\304\356:K&\217[o\273\3016\204\375\004\001\037\177\314U\377\226\351,\323\232\351\314\364\0214\007^\200\300nG\254\301\2724\226\210\355g\354\321\300\303\323\376\310I\304\253DO\330=\255\254vG\215\035\270-\nKe\311\270J\252\266\020\244\256)\237\220\242.\240\244\300\032?1"
+	.string	"nw#|\0230\304\205\210\266kWm\275`*R\306\354q\224\372a?\333\335\265\236\354\024\017\357\316&\264"
+	.string	"q\274\316\363y\336\327\351<\027\034\257\353\200a\267a\360\367\251"
+	.string	";\320\367\201]f\334g\253'O\004p\221t\303\231\2620\276\312T[\013R\252/\341\003\036"
+	.string	"2\241Gh`\\`Q\301\005\315"
+	.string	"Z\226 XT\300@\343"
+	.ascii	"\t\260\273\004\301\242\002\006\215[\202\302(H\003A\024\265\t"
+	.ascii	"QI6\355\255\332^\001\263\202\273\360\266\302p\300\b\030\007\206"
+	.ascii	"\005\250\320\340./\332I\006"
+	.text
+	.section	.gnu.lto_quaternionConjugate.39.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`~\001\375\013"
+	.string	"\206\025L>0M\225\016\300n\303\354\250jU\210\022k{\251]\033d\340\246\251\372\347\007\003x\261\272Z\213\025\f\371\256$5\244\364wCC\201%\026\207\300\030-\224\2051\n\364\252\261\021B6\2212\2457"
+	.string	"5"
+	.string	"="
+	.string	"\250]P\342\r\355\321\3403\260G\355\030\330\243=\273\304A\321\336\303\210\007\244\325\356n:\341\336\323\363\217\341\216\017\250\363\314\006\354\256\363\003\212p\353mGl\007\2603\022\032\262\017\376\025\377~G\246\263Lc\231\216\231\2762\255\231\316L\037\"Y=\004i\027B+\305\252b\252\202\355?l\220\004\200\247}\013\277\340\375\343\374b7d\n\312!U\365 \034,\370\006\2374-U\303\220u-\371\244\035\330\250\350\037>'\314\340\032|\262\020\355\256"
+	.ascii	"?\003\202\rD\004\005\016\366x\325R8\372<\331\262\301N\252\004"
+	.ascii	"\373\327\356\256\003\335-we\2221\240\241p\333\245\343\270\256"
+	.ascii	"\262],\024n\253`2\333D\303]\202\002\230M\323u\230\355\001\356"
+	.ascii	"\257\325\220\t\230Py\264\2013Ma\232)8\ncE5]\0323\357p\251\206"
+	.ascii	"(F\237\006\" \260\202\021I\336\262B'e`\f\214\203\373\035\306"
+	.ascii	"\203n\306.\245\305\002\341\035\305\343\202\314\2311\276\262\213"
+	.ascii	"\273\227\\1\352\253\222e\242q\271\310\216\230\034\371JBxCh\354"
+	.ascii	"\020\0243\242\365\230\315\035\354\021\001\020\005\372\345E\273"
+	.ascii	"\310"
+	.text
+	.section	.gnu.lto_quaternionDotProduct.40.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\332\001E\016"
+	.string	"\346Z]C\020\221\223\016X\311\222\200E\n\257\303!\374\377\b\324\021\244.\020|\351\330\242\002\240d\364E\205-f~\214\211\254N\364\256\030\004\033"
+	.string	""
+	.string	" \2675\002\321[\364%D\361\025Q`\326\3106B\310&2\245\024K"
+	.string	"="
+	.string	"O"
+	.string	"\234\277\022s\304\230\342\242%\306\017T\004\230a?\254m=\302$\270\226\245\372@\2508\306\206\006T\215\030\243\346a\001\226a\345\016\3130?\230\363\271\332&\f_\310\3008A1\361\257\0071\306\376\004\205\203\233n{\240\255\202\366\031\002\355\337\217Wl\016\177v\200\277\236\277\235\277\234\277\331\337\315_\315_\354\357\365\327\372\013\377V\177\363\357\377\272\0034\343\031/1nH\315\304\030\320ED[\256\315\332\025\231\004~\353\223K\004\013Hf\201%\310\312\314+s\205\327\241{\2520\253\264\262By\246N\005\bL\0030\247\222\005\247\b\251\262\300\323\231\371\027\317\324\241"
+	.string	"y\016\200\351\005\237(\013\026cdP\243B0`*%\226\241\023@\210S\351\251\3663yzh]\305L\t#OpC\037\244\b$\"\"md\023\211\266\2206\"AD\244\205F$\355\203@7\n\020F\032\311\266\215\264\354\213n?\351Q\312\256\236\314\362\223VL'9\351\311K\206g\352Zt\322A\005\273p\262\301&\257\314\262\272\241I,7\tix\246\256E\223\001& "
+	.string	"#\021d\007\"\340\f\333)\001\214\214Yf\"\035\336\221\016\304|dx\231\261\324y\335Q\327\bcY\336\267\254\362\016\373N/c3\\foQ*\344\322\331\006\211kE\302r\016ww\306\t\r\220\221\343\036&\030\371\023O\276\025\223"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_quaternionNorm.41.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\036\001\305\013"
+	.string	"VWO= \221\222\016\257\020\r\241\306X\\\370\365\215CU,\006\005O|\344\202\324%\203\340\266\366c'\343\330\366\213\330\256\252\n\204"
+	.string	"DA\343\346,\307E\221`\203\252\216\337\032!d\357\224R\n?"
+	.string	"7"
+	.string	">"
+	.string	"\036L0\265\361\232H\262!*\302\"_\330\325a\245\240\033\026Zh\334\035\325\321\002Q\033+\201\250\355\034j\325\026[\022m.d\204PRJj\251\301\335\321()\031\312\227$\002\222\n\310\226\b\264\251\351\325\002\260\231\261\211\2619\331\224lF6\233Mf\3636m\263\001\250\013\205\001\272\303\020\252q/\032\213\017$-\222\303dY:\302\352E\322\001w*.+\356\256\236\246\210\356\301\356\267_\305\211\206\217C\374\177v\3262\241(\376\003}\357\273\305\t\210\017)\364\004_\246\273[\300\232xPaZicI\242\266^\200\007\026\023\207\310\253\304\337@\226\335U\030\"\345\346\303\003a\004\204C\205T\034N\265\241B\"\200p\250M\307C}\030`%\301A\207\032\251\252\016\305q]I\315;L\376a\346\3235\217@\230c\236\271\024C\244.\2303\220\336>\235\331\210\036]z\233\021\027"
+	.string	"2\003\302\260\025+"
+	.ascii	"0\" \034\240\016\340\bF\004\204\003\352\004\001\013@\270\251"
+	.ascii	"\250\313\n\347\245\006n\215\275\256\211H\321\"\022L\220\240\n"
+	.ascii	"\007w\237T+&a\222\001"
+	.text
+	.section	.gnu.lto_quaternionModulus.42.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`X\001]\r"
+	.string	"\226\232ZB\020\221\223\016\270_\022\b\361Q\f\3729D\331\036R=\324Z i\376\211\004\021\261\367!\373\232\266\237\0036\2550\221\023\240\350\fD"
+	.string	""
+	.string	"@,@"
+	.string	"Sw\310\257\224>\240\332\3666K\b\331;\311\224\002I"
+	.string	"@"
+	.string	"J"
+	.string	"\336L\034 F\025\223\213\030\267\217\"\260\374\272Ym\353\0226\241\265/n\003\261b\034\244\013.21\306\313\303\003(?g\001\224\337?Xsj\265[\354H\310\314 \245\2348+\0061\306&)E\203{\267=\3206A\353\231Wi\237\365<\333y\226\363,|v\363\254\346Y\353\331\352Y\352\331\367\254{\366\336\354\004"
+	.string	"ip\210A\001&\306\f\247\231\030\363^\210\250S\270Tb\024=\f,i\241\237[\255\205\331\232\305'\264\360n\207\346\232o\376r\214\270\205\346\037\325\337\255\337\204\322\201:\365\352\316%d\026\324\013\204\370\377\367\204\2012b\224\247\272T\t^\321\027+\306\250\240VQaB\275\342W\233\334%\033\260q\322\301\"\312S\273\215\362\036Z\273\030#\356\007$\344\200$\004\273D2\f\313>\227\310\203\020\354\372\200B\027\b\201f\021\032\200.\222,\003]p\023\271u\367\020}T\230\236\267\0200\312$w\267\330\030dl\210\261\360\223v\016\3579u\203s\316;\257jd6q\276`s\353\001\032"
+	.ascii	"2\003\3020\255\254\240\301\210\240p`:\200#\030\021\024\016L\007"
+	.ascii	"\260\177e9(FT\223\200\253\024l\023\200k\242\2226\021\233\n\035"
+	.ascii	"4J\013wye?\250\314A\273OJ\212\351\232d"
+	.text
+	.section	.gnu.lto_quaternionInitQuaternion.43.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"%\t"
+	.string	"\346\320<6P\217\032\003 ,Q\202_\257\n\204"
+	.string	"\177h\301\356\243`\3133\b\006a\034C\263\027f\370\215\034\373\353\225\256\222\230i\202TU\220Np\256\243\306&+\211\224)\005*"
+	.string	","
+	.string	"-"
+	.string	"\026\310,\333\265-\366V\367\353\302\302\365\375\237Q\345\316\260\253\035b\200\023\252d\230I\370_xBe\270\321m7m\rZ+\004\177c\252u\313\206\231\251a\026\227\037#\366r\230T\351\320\2645l\375a\220\316-\222\003\376\324J\312\357\035\264@\263\254\347\201\314R\013\205\233\026\302\256\023\326\313\205\025\277i\323Fx\244/\355?B-\"1\021W\034\2265)\263\214*\222\3573\301X\353\225`\334h\215\371\003\037\327\303\0215\214:\333\004q\333\306y&\350\323\331\246'$\232\034\202r\016\f\2419\342\270\320\324x7\3461\325\005\017\230)R\210l\202\302zp\311\327\006\023"
+	.string	"2\241u/0.\030\260\rPc \017"
+	.string	"\267)\027\265J"
+	.ascii	"\001\003a\020\277 \022=\206\314\272\005H.\3266\253)\340./\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_quaternionInitVector.44.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\265\b"
+	.string	"6\220:5`\215\032\003\3002\0334`\b\200\311\037Em\370\200\021\030K\204\221\254r\035\215,\376\304\327\016\330\"\310\330.\004\323\312JI\357P,\002z\371v[I\244L)("
+	.string	"+"
+	.string	")"
+	.string	"\226\345Z\024w\247\333\303\250P}\377g4\2313\344j\177\030`D\n\031Z\022\376\027\216H\027nt[L[\203\326\n\001u\312\206\226\251\341\223\325o\321J9K\226p\\\332\032\266\356\260\007\347\024\310\001\177\311#\371\273\203\026`\226\355<pYb\026\270\002\020V}^[\210i#\034R\017\373\217P\203HL\304\323\206e\r\272,\243\311C}\"\330j\273\020\214\031\255+\377\337Xj\0337\313x\032>\032mr6M\333\262\311\331h\264\231u<3C\320\315\201\2413?\333\326\231\227\356\256<\226\272\260b\211\"\205\307#\337\203ELP\001\021"
+	.string	"2\241[/0.\030\260\r"
+	.ascii	"/\220\007\2501\220\247\251\004poSg\f\231p\013\206\\\202mVS\300"
+	.ascii	"]^\264\223\f"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.46.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`F\004\355\030"
+	.string	"\366*\227K\260\022R:\342d\304\304e\334\367\220z\003\247K\356+%\272\222Rg\355\212\227o\312C\222<\005\267/)\332\277\365\365\3464f\336.\260\242\207\364\037\364/\240\337\276s\007~\372\035-8\312\263B\245mO\032!\204\220-\245L\001\203"
+	.string	"w"
+	.string	"\200"
+	.ascii	"C\274-\261I\266_\350@wZ\240\252a\352Qk\215\255h\262\001\306\025"
+	.ascii	"\351\222\214+v\207\367\307\266\255\353l\231%9\212\264\371e\373"
+	.ascii	"\262M\217\302\272HYpi\222\215\033@9={\036h\361h`\223\224\001"
+	.ascii	"\345\360l\t\203\227\201\232\324Z\267\210\267\303d\215\216G\235"
+	.ascii	"\025K\235\245\224\324\341\200\200\365rt\005\353\nj\203\3137\275"
+	.ascii	"\033wK\304\205e\222}\221\262Z\353\367\266a\017\333\3772\376\253"
+	.ascii	"\374\364$\314\027a~\b\363A\230\017c\376\213\371.\346\237\314"
+	.ascii	"om\323\336,\311Q\244\315\373\333/\2005\320S+\3160\253\376\210"
+	.ascii	"P!\326i\267i\371\337\177Q\324\276N\033\374\t\2545\325n\222c\272"
+	.ascii	"\220\326\340\022\031\325P`\373\002\177\236\230@k\220\001\222"
+	.ascii	"\325U\255\025e\305\243\234y\177\273T\207xg\336\245\013o\326\352"
+	.ascii	"\342\210E\2555\301\212GP\256\370\257R\355\027\322\237Pf\267\021"
+	.ascii	"\217]\021\216\207'\331\243\017\230\215\217T\253}\017\232A\002"
+	.ascii	"(\225c,\363b\217\002\236\n`P:*\351\330-rN\354\005\216 \333w\025"
+	.ascii	"\"\355S\272\335}s\032D\003\224\032\273i\323\213\235\217H\351"
+	.ascii	"k\244O$\346\336\2769\245\001R\345\030\353\275\264\333'\334\024"
+	.ascii	"5;\252\352?\346j\275\235lsopQ\214\242vD8\036\276\267\235\242"
+	.ascii	"t=n\337\373\265\"\204u\365\016\372\367\267;\022*3,\363\3422C"
+	.ascii	"g\366-)1\021dXf\261\027\332lFk\211\275\270\260\314b-01\261\224"
+	.ascii	"\222\323$@\200\211\311"
+	.string	"\320h0\261s;\250\301\323\2173\244E.\322\227\335\032\347z@\203\252E\366\251)v\311\207\025\345\330%H\227\035\322\253c\347\003\353V\2034\373\360\320B\367\223\365jX\213S;\"W\233\375\352\221iWTa\307W\225#w\266\253\007L\355|p<4\201#\306o\301phe\366\331\004\230\314.\273\325\"\207a\331e\007a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\004\355\013"
+	.string	"D\020\374\004"
+	.string	""
+	.string	""
+	.string	"\002.\177 \360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \002\177!\253\325\252\325"
+	.string	"\272\200\202\002\003\177\"\200\200\200\200\004\004\177#\005\177$\006\177%\007\177&\b\177'\377\377\377\377\003\t\177(\n\177)\013\177*\f\177+\r\177,\016\177-\017\177.\020\177/\021\1770\022\1771\023\1772\024\1773\001\025\1774\370\354\254\026\1775\200\200\200\300"
+	.string	"\027\1776\350\314\2313\030\1777\031\1778\032\1779\033\177:\034\177;\035\177<\036\177=\037\177>\"\177?#\177@ \177A!\177B%\177C&\177D'\177E(\177F)\177G*\177H\004$\177I+\177J,\177K\001-\177L\037"
+	.string	""
+	.string	"\200\200\200\003\001"
+	.string	"\302\001\003\002"
+	.string	"\241\341\365\321\002\004d\003\f\204\006\003\020\244\006\003\021\342\001\242\007\013\342\016\022\242\026\003\022\021\202\001\003! \013\242\013\003\"\202\242\013\003(,\204\007\003)(\""
+	.string	"G\250A \304\265\222\032\366\016@\003\231i\232\003\021\220\214aF!\001\0214B\004\312\007Y\346\r\323"
+	.string	"\237\0079\356d\016\023\022\027\235\307\351\360\315\323\035\277\227\322\301\f\320\222I\002\tp\005\271\240\302\300\002\224v\374_\356}\002\227\254:"
+	.string	"\251\343\263L%Z\321\244L\324i\362\260\023|"
+	.ascii	"ZD\206Tcc5\322U\343\006\3617\2766@\362\033\241Z\355\317\200\256"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.refs.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e2bc8c0044f87c6a,"e",@progbits
+	.string	"(\265/\375`\227'}\237"
+	.ascii	":\371(7M T\312I\007\375\377\276s6\267\367s3\243\3526\327\237"
+	.ascii	"\367\333;zkg\357\250\217\210\265\242\247?\372\273~3\377\373\233"
+	.ascii	",\357}\035\212\037\220\352\252g\351\340\332\343\270\024\007x"
+	.ascii	"\342{8U-`\\\t\024\343\021\241L=\335>\331R\246\317\002V\003\225"
+	.ascii	"\003,\306\236M\241p\007e\312~\374\205\355.\220'c\370\217\325"
+	.ascii	"\330\357'V32TO\243\332G\223\205PI\023\272>\205\021"
+	.string	"_ea\306\240y|'\266\307z\314\307j\234\307x\2748\246\257lU\317^\353\231k=\367X\317W\353yj=\333]\332\317\001\232\016\320Ga\253L\347s\256+a\234\302\212\336\035\333\006\347\224\330j\337\230\353\242~i\322\305\260\325\263\231\226,(\034\017(\027\366\302r\254\306]x\3139\216\243]\370\355R\235&\236k\203I\013z\357\335Y\002r\244kUqxi=\337\365A\254\007b\3759\013\2271\026\353\274\361\274k\367FI\320\324}\3112\330\252\033\0016\211Ld\300Z=s}\n\264\25463)\002@\335\335HA\345Z\354\331\324\252\006$jZ\026\345R\235\232{\343\310\332\356\275W\270\n[a)\267\261\032\263q\021\3475\236r5zo\323\275\367\034\375\241\260\031\263\361\331\245\366l\352\332x\002c\240\351E\215\254\360\336\213\002\005\n\024\004\240\240\361\001&\256\rG\375\t+?\331\2041"
+	.string	"\020\326s\332\021X\272\030\034\201\365\003\254\347Y_\263\276\327\327\261\tc\002l\302\250r\t#O\224M\030W.ad\2215s\243\322 \342\374\026\021\221\220pL \336\324\316\316\361a\003\240\332\003^\363\333*?W\360\263\004?_\360s\004?[\360\263\317\317\024\240\350I\361"
+	.ascii	"~k&\206\313\317F4\211\237M\374L\300\317\002\374<\300s~\253\345"
+	.ascii	"\255K\372\243\252\205\215\3221\023\002\347\311\017l\203d\264"
+	.ascii	"\206\371\3003J\\,\202\001\375\267\341\177\242\361\267?,\244y"
+	.ascii	"\006\257\363\333\031\364\376\347}\357\377\337\377"
+	.string	"\276\003\360[\026q]l\212\034\326\201\033L\254\2603\277\371[q\005\303\377T\376\263\375\227\376\277r\233\277\255\\\375;\217\213\364\366\357\263&\177\357|\346\357#\375w\327\327\277\177\374\234B\353\034\236\346\357\035\177\347\374=\363\267\375\233\177V\374\031\361g\302\237\003\177\236\376\374\367\263\230\237\371~\306\373\231\356\347\267\237\245?S\371Y\355g\263\237\237\374L\366\363\330\317a?+\371\031\354\347\257\237\215\374<\344\347\035?\347\370\031\352\347\245\237\203\370\031\210\237\223~6\372\231\350g\027?\357\360\363\r?\313\360s\213\237Y\370Y\205\237Y\374\254\342g\003\376\327\375\237\376\347\362\337\355\347\021~^\361\363\007?w\360\377\360\347\r\376\267\370\277\302\317\032\374\234\301\317\007\374\274\363s\316\3177?\327\374l\374\371\377\025\377#\376/\363?\360?\340\177/X\376\303\360\237\305\177\271\377\023,...\3764X\277:\304\177"
+	.string	"\016\001\267O\353\224\2662\245\331H\270\227\243O\251\251\213\245\003\202w\021\275\366\246\3627\225f#q\247\356\305\272\366\357\313UY\341\305\322\202"
+	.string	"Gj\f\021cU\336l\277\005\030\\\212so\331\275\367"
+	.ascii	".\202\317.K\253\037\274\224\303\256\214Q\271[\337n\353\1776\336"
+	.ascii	"\245\251{o\216\231\350\235b\302\341\031f\b\376\034\266\274\300"
+	.ascii	"\275\022\324\335\353\365\024\\\225H\227\262\236\300\275\330\275"
+	.ascii	"M\0227z\247\234h\\Mg\032\030*\022\321\2735\300E\013r\235Q.*\365"
+	.ascii	"y\373F/\337&.\252\030\316\350s\312\031}6yn\323\263yo\224\212"
+	.ascii	"\307\271\266\324d'\032\027\225\023\355"
+	.string	"IE\3426\335\346E[\332Z\233\236TN/O*\036'\332\022\225\263\211\213\212\004\221g\227!\224\223%+|\346l\2728\242\264\226\246x\352\234\321\347\325\273\227\327\234\356\324\002\367j=\247\364\226\256\270\215\251\016\007\023\333\322\223\243QL@\236\267\251\316\271\344y\357\022\246\0277\352\202f\264\356vq]3\210\326\275\341to\0017zo\324\275M\276u\367\336\346\275\227fJ+z/\017\036'4*\352^,\002\242\256V\323\315\351\336^\343k\243r\242\001y\372\270\251\241Ao\215h\223\241W\217kjEk\236\335\033dV(\325\020\201\235f\361\252t(\t\262v\264\317X\355DG9\323\265\224\317,Eo4\260\b\023U\253<\255\265\006q/\2370\362\342\"\2370J\033\212\032\345y\006\275\367\362\340\360\tZY\263Z\243h8|T\350\006[m'V\210\304{\227\332IwY\223\275\235<\312\254"
+	.ascii	"\263\002;4zb\316%\343\030\2170d\210\004\021kb$n\313\331j"
+	.string	"3i\035M\332\362Z}3\255\347\350s\315\207H\026\227\2236 _D\\\031\342#\210\027X\037\351\260\366j%\235\244\277\332HC{\t\2535\222\277\213tW\373\370Qe\353IY#i!B\304L\357\275(Pp\220\304\275#\002\250\357\2736\004\212\353\371p=\023\256g\301\365\f\270\236\377\326s\337z\326[\317xk\002=\264\304H\337h\264\332Y\266,\214\210[\227\325\252w\364Uc\261Z\363h\035leT?\332\206\3102\313\321\243-\332<\272*z\275l\204|q\n,\234\241\302R\304\313F=\307\255|\331\204\361\f\267\236\337\3263\226))#\224{\005J\312x\226\346\234\303\021\325W7\240\242\244I\230,\336\260Q\203E\252I\023\033\227\346\304\r\021#\203z\262\301\322\332\222\322\352\373\t\360+\213\021\2552\231\317\333\271s'\035DR\303\tG.\214\252\235\376nj\032;ZRA\254V\371"
+	.string	".a\354%\2377S?\031\342$\242Uc7\373N\221c\262\245\325\367=#\256Mg\234S\253\f\305\347\274\250\006)#\225\344\b\3054\250\245\253V\025\021q\332\022\235\254\022\021\373\013\307\327`\253\\\310\206\254v-|\370\232\246\350E\343\256-\315.*k\022\r_\013a\231\234\"\213\321(\255\226\371Y\220\007\331\256\246m/GX\253\335"
+	.ascii	"\227 c\007%j\207\263U\300\033<?,\251Vyz\"\247)O\352\f\312\n&"
+	.ascii	"s^\214[4\302\354\344:\313\346B1\034\223\263\\\204T\031\344\321"
+	.ascii	"\252\215\253R\2460K3\331\301\273\362'\267\345\214\003\214\206"
+	.ascii	"\234\02177\373\026\207\343d\330\245\227\345\366M\215\346k0\252"
+	.ascii	"\327\252\305\322h5gt;\310\236llV\272\262As\362\242y}Wn\2457}"
+	.ascii	"\200dw\255Z+\255F\267%\347e\264\262kv\315R1\2626(\025E:\345\226"
+	.ascii	"J\243\005\341\361\005\327j6q~L\214QggV\255\312XNS\227\263\210"
+	.ascii	"\264[\265\031\253'.\256V-\032'\356\204\321\013\003k\325J\341"
+	.ascii	"\304\"Dh1i\325F\341\304\2322I\004\217X43\353\343\001m\036\031"
+	.ascii	"\373\353{\362\304\216)\322\200)#&\312\02622;\3067c\225\305\251"
+	.ascii	"\210\224&M\354X\315\036\227\251\016\237\234\035\230\330\355\330"
+	.ascii	"Zc\215\212\216+`pOL\276\302\302\234\234\211\275)j)Q\322\003\272"
+	.ascii	"\372@\314\233y\002\003\263_&\354A\rn\025\221U\306\036\261G\354"
+	.ascii	"\227\t\321+e$bxUVx\303\230']\026\311\355W\njG\232\234\230\003"
+	.ascii	"\005\232\007wW\244\2105R\005ZC\206L\313\030\021\267FlZ\236\032"
+	.ascii	"S\253\266\313Z5E\371"
+	.string	"c\262?T\261..59\233e\263\354\2205\017\2071\020\356\312\356y;\344V\b\316t\310\020\033\255\336\002\261A\304t\221\273{[\355\226\3452\206\261\"\024\242^y\240f\261\371Gh\003E\364B\322\252\325\262?lx(\366\330\362\303G\211\302\250+<\325\311\022\"\004\252\307\303"
+	.ascii	"\246\3651\031\035\274++mN\254\016\253\303\3568\\s\213Va\335\356"
+	.ascii	"\370\313"
+	.string	"\241\021H\343I\253\366\312Z\325\264\201q\352\263Vv\3524D\223\265\262U\226\316\306\216,\266\212\267\260-\342M\277n\334\2609\360\372z\307\226\340\021T\2679\2446jpV\f[\265Syk<\216h\325J]\272\212\355q)\266jq\\:s&\304\rL\2536J\005b\233l\223\205\02227\235Y\242H\345\317>\335Bi\241I\262\327<\322\252u\332\247\232tG\253\266\306\r\017\"CTi\325:]\313\2128\305\314\210V-\r\025\313^{\355R\234\222C//\333\274]\342*\277\036Nh:PA\257f\253Wk\034qD'\232P\245\255X\371\005\t<<\354\304\232;\205\007\345&\217H\216$\210\357Di\315\2300(\2220\203\203]\210W\004:\023\265A\006\213\360]\370\267s\247x\205\255v\231\006l2\261\270\252/\177\177M&-kz\261\260 \340\253\303\252\034\201o2\177hoW\244"
+	.ascii	"\266aZ\242U\003N\243pU\271\271\341\324A\305\316Z\035\303E\f."
+	.ascii	"\351\"\250eo\257\305\340AM\327>g\022\034}o1|j`\300t"
+	.string	"^Ci\324\200\030\342\024\246q\t\363\316c\304n\n\243\362k\265\215h<\251h\340t\260\357\214{K\266j\210\315\315u\335\035\237u:\364[\244{\327Iu\326\206\034\272\265\332_.\265S\360|h\201\305\305\265\234\007@\270L\333*O\013\255\313[N\313N\031t\n^\253\315\205F\356\013\220\037Z\324*7\262\271#+\034\\\263\361\275wP\256\312\304\370G!X\223-7\267~[y.\323\235\r\250\221pK\213\223,\3577uKo\007\221V\033\313\316\2253=#:\244\315\306\316\346\275\366^\037\207P\235\036R\2260\265\032\177A\201\021\021\321\021\310\2109\304C\317Q\322\305\004IG\311!\242\t.P\361\243B\203\244\036d\320\021\021Pr\250git\324\323\203\244\\\276`*\2234BG$\221\n4#\304\\\3060\232q\2019\224<\201\200\025\214\216\210\216\202\224,H\300X*W`*E\b"
+	.string	"\311<\2728\352!YB\251H\271B'(\b\204\034e\213\027\314\345q\004e\013\245 e\b2\300X*\205\214\222\307e\213\006\220\314\243\"\030\312\025'\230@GK\246QR\271\"\206\215\022Q\321\020\223\350\210E\214\032f\022\t\264D\266\020c=\201\207#\030\224\216\313\3451Gh\203\f0\020JQb\203\f0H\261D2\211\206H@\262\360\001h\350(\006"
+	.string	"2 \2274FFH \240\2431\207\0247\370\3500\2234\264d\036Y0\225/\004\021\r\035\361PB\006\344\214!\242#\214\2452i#t\203t\221<\276\200$:\002\031\331\030%\217CA\307\027\224-\214\220\310\245\013d\020OR9\304<\016\311@\212\020\264<\006%\217L\030d \203\002@\002%\217C\313\243\f2\220A7/\214\216Z\220\201\f\242Y\036\221D+d \203V!\235\240\344\221\207\240#R\004%\242\242\242c\216\320\022\211\244,2\006\001\271\260\307\033\013\222G\346\021\307H\tds \233\n(`.\217E\024$)\227EE\307\237\344\220\021\211\003\r-\221I\244\213\365\027\250\230@\205\006I4\327\200\203\n8\250\300x\r8\360\361\341@\205\317z\025>\226\371c\201O\322\220\020\r\363G\205\317QI$4c\304\004:\nR.["
+	.ascii	"`\306\214FB\352$\244VB\352\031H\235\224\324JI=#\251\225\224z"
+	.ascii	"\206R'\225C\311%\222y<\212a3\203\2218\211\225\230\371cA\nfr\210"
+	.ascii	"\206y#\204\f\372\311A:*Y\"\"\345R}\001\304\034*\2321B\022\271"
+	.ascii	"H\036\215H\307\245]*\231@H\031?EB54p\rl\0033_\024pe\021r\331"
+	.ascii	"\303T*\227=7\311\037\030\326\350"
+	.string	"G\0062\210iDs\037\237\025\t\304\260B\t+\020\005F/\230G\030=I%\f\030J\240\236\344\320\021F\017\320\322\250\207\202\023,X !\223AD\312\037\030F\030\220\220\311\037\030\306[D.\"sN\324\034x~5\222\260Q\331!3\206eN:\242\202{_]\252T\263MY\004\024\323\352k\\\215\252\321l=\345\350\305z6\0015\310bH\004\253\360:\265 \2301\322\005JU\253\252\215\2537\362\360\344\242xY\325\247\253PYC\364-\331\262\376\252\263\210\227/\201n\353\327**\r\225\206\332\\\307\364\300zB\334\302DeR\231\324\346\212\003j\367tr\353\261\270\2506\307\2466E\224\340a\251\367j\363O-C#\312k}RT\264\210&\3341PF\271\2676&\204\206\206\026\321\204\346\021\320\301\032R\304\016o\021\243\2427\326\364\004\005-\241\337\341t\247\213,ZU\346\226P\252>\243"
+	.string	"\225\264j\007\263\004\006\366\331\314E\305\024\315\246S\313\2676\275\354\\!\211\273\320\277?\213\347ge\206G\035\226.\255\236\206K\214\2301P\233\347\235\035\242b^\236\345\353\233K\364\252\222c\357\226\357\317\006n\241\323\213\263\263\263x~>\2409^\212SF\334\342\345\214\231N)l\325\336-~A\301\330\271\031@!txv.'\361i\325\227\006\007g\351\330\312\223R,M\360\313-\335\237\030\227\300!\255\332.v\016\307\317\f./\203i\250r\001=G\343\312\314\f\211\210H\222$i\f\202\013\020\004cI\330b\313\r\022"
+	.string	"\0245Uc\214!\231\021\021)(HR\312\262\033\240E=fFs\253\344\360\231k'\002\355\002\235\307\206\232\"\233n\202\237\2062w\346\311\241\307\261\320\214g\\\210tB\264\232\3567\026\334\256\275\bV$\203&y\005\356"
+	.string	"\"\277w\360\315\313\271\2449rNmN\271E\257\377\\IDK\3451\312h\227p\307\001\025\"\263\2135\006\335\n\242.\332*\334\276\314\3744\210\360b\024\371hg\341\241n?\370\330\303\023\212\374\217\017:\330\005Y\335\237\bD*!\236\2633\340\375>\205D.\333\367}t\301Q>p!i\355\207\242\351\244e\251,\252\362,\341\356\257\r\336\251X\201\323\244ixA\030\030\205\262\234`=\227=Q\023\233C\030 \206\321\335\214l\205r\3612\262\344\202\025t\324Om~\226\336\004j\306\366pFG1\2125/O\233\004\332|\267\347\375GZ\3651! +q\307tS\036b\242\275\365E\331M\260\bP\036\372AI\221\325\333\255\213\327}\347}p)\007\352\211C\200\341\221\353\254\026F\270-\276\370\021j\362m\316s@\361\214l\357\314\343k"
+	.string	"\250\370;B2\017\332\352k\274\23245s\230\331\2729\375pC\031\032\325\241K/\325\203\274\330\250\202\370~\002&"
+	.ascii	"\025\244\"\200\036\030\355\351#\0074\360\270\373\222\256\224"
+	.ascii	"1\327\276\241f&\261\202&<\327Pi\357\243\255z\235Y\251\250\"5"
+	.ascii	"\036\212{ca\327\351%\221\324\372F\211I\005\314\006x\022b\n\216"
+	.ascii	"\bDd\252\343|=\026\274\016\267\314s\233\373"
+	.ascii	"\356\360\315\340:r\217\332V|9\231\225\333|&/D&\352?\323\307\264"
+	.ascii	"X\373\305\002\016\350\217,\214\026;P\034\347\031X9\016?'Q\271"
+	.ascii	"B\226.\376\303XF\001\254L\007\004\025\300\323\r\254\376\340\204"
+	.ascii	"#s\025/\241Y\360T\330TP\032\244J\242U@\363\324\357\270\302\036"
+	.ascii	"\214\025"
+	.string	"\233H\002b@\343\325};W~\261 \251\220a\202\325\031\311\251s~\204\005j\222E\304aC\324&\306\212\342\367\266\270&^\213\177\305\373\021\222\353\031\026\017w\b)\235i\370\201\302\224b\313\370\2318\226\016\375\241\366\257-3\242\217Z6L\\\203\260\"0-\032;\303n\305n~\2216-\266 \263\323Q\264q\003p\"y\202\230\266g\320\306m\233\327\037\231\333S4\300\n\017\324\344\370\320\250\343^y\004\236\331\360\300F\223f\274\216\254\330\264\304\332\277{\016\177d*\242\207\352\211(\006\323\306f%\232\221\303;x\0209\206\256\313\352b+\025D\363?%\325`\255\003_\261c;\272\323\037\373\344\266!\357\024\204\022(R\241\306\026\232\235E\024\273\024\254Z\261\3449\2349\2209\322\321\301\221\344\301\034\354\017\216Q\025\007\245\212)\315\230%\336h(-D\bw\020\361K&\223\240P<\002\303\t\232"
+	.string	"\256%\355\225\320]j6\301\tTX\333\207W!27[\357\001\001\030\032en+\323%d\\\222\3464#9\n\246\355\222\005\017\023\024\260\3629I}\253%\203\326\264)\032\035w\200\247\377T\030\t\031\373jlb*\366\302\257\302\223\351\315Jx\343L\006P\036\340\304WD&\177s\362\237\226\232\205h\246\036\220\004\214l\266\237\374\357s\007\315\261\216\360\033\262\236\257\242M\326\224\n\027\327\ng\244\003\314\236\234\2255.X\311\356\241M\032$H@\265\210^\210\032\305\370\271_dWKQ\344\274#\364\321\017J[\004\024K-\332\006]~fQ\350Iz3D=\336,\375\376\304\340\311*\253G\372\3579\200,I"
+	.ascii	"f\374)\305?\233H\022]\004\242\267U\035L\347\204\231\236@ekT\f"
+	.ascii	"\025v\271Q\340\304y\371g\"D\270\231;%L\200\r\027\222\245\020"
+	.ascii	"V\310N\266H&`\355\317\025\343mFF\022Q8o\325\270"
+	.string	"\025x\231\217%T\2703:\337\027\242\262t\241{$@\244t\347\211f\024\3545\311\340\216cS\361\024n\300,j@\341\005\211?T\270\362\352\032\3140Wy\237\325\226T\373\026A\376\2116\263\317\220\360\315\tDn\305\223\305o|\317_\355v\244\316\r\t\225\0239)\001_\016n\216LG\304\246\262\352\3070`\356\360w\357\233\025\366\306\214\202\340\030\027\244l\323\367\303\210{\002\274or\020\271\r\b\245\372\263\332|<\035\021\220\344\357\362\003e$.\240\330U\206\341;Q\304\302\rl\234\252\016\341\3332)_\274\377\345\353\244#9N\3208\003\373\203\024\336\261\312K\222\320s^\371\333\3010\223\245&%N\314b\302J\361%\254\204\3515\322\333\273n\236\217\201\227W\376\r\f.+\371\334t\303\364{A\244\323\256\203\345`\331\217a\243\365\267\306\340\361\334?J]\217A\250\006\327\037X3\303\3249\355"
+	.string	"\002/\231\364L1\007\370\347\024}kiC\374\306\216\3061"
+	.ascii	"\247km8q@\351\320\377\3765o\323\263\020\204]\302\002N\030\312"
+	.ascii	"\r\340c'\006c\267\317\301\330\343\3562\261\302\350\321tu\233"
+	.ascii	"\271\236\002\225\327\3171\366^\\|,\330v\367\016yF\036\336\025"
+	.ascii	"t\247\267m\375\001\276[\303c\023\233q\250\325\317\221aN\177O"
+	.ascii	"\207\005?5\035uvp\304O~\357+\360\237\357 \261\313\3326\225\021"
+	.ascii	"\207_\322\217,\245\335\301=\364\016X\273\004\230\351\357\201"
+	.ascii	"G\342\360\355\004\254\312\203\341\307\257\331\231i\342\337dN"
+	.ascii	"A\237\031\354\203\356#\245M\231\275}\016>\240\336\250\351\200"
+	.ascii	"\265\374\342\370\244.C\236\364\237\273\213\300C\331\027\376\027"
+	.ascii	"\321`\316^H\277\235\216\244|\220\356\360O\261\033~\301~\355\307"
+	.ascii	"\002\326\330\310\330\314\344\220\367v\226\323\260\270O\222]v"
+	.ascii	"\256\266r\r*\034"
+	.text
+	.section	.gnu.lto_.symtab.e2bc8c0044f87c6a,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"quaternionComputeProducts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"quaternionMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"quaternionTransformVectorBodyToEarth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"quaternionTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"quaternionAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"quaternionCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"quaternionConjugate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"quaternionDotProduct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"quaternionNorm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"quaternionModulus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"quaternionNormalize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"quaternionInitQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"quaternionInitVector"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e2bc8c0044f87c6a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
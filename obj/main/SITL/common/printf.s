@@ -0,0 +1,626 @@
+	.file	"printf.c"
+	.section	.gnu.lto_.profile.266c50917d335358,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.266c50917d335358,"e",@progbits
+	.string	"(\265/\375 \370\365\004"
+	.string	"\364\006\354"
+	.string	"\r"
+	.string	"\343\214\373\264\003\004\002"
+	.string	"\001\312\334\346\233\004\006\002\001\254\277\363\246\017\002\003\240\342\234\212\n\004\261\316\222\345\017&\002\003\002\003\002\004\002\004\002\005\002\005\004\006\002\006\005\306\261\236\222\002\004\002\007\002\007\002\b\002\b\006\007\b\376\220\273\353\017\b\002\t\002\t\t\252\335\206\331\006"
+	.string	"\002"
+	.string	"\n\206\273\306\320\013\226\266\306,\002\f\240\342\234\212\n"
+	.string	"\023"
+	.string	"x(HXmc\007\353\007\025&"
+	.ascii	"\237d\251\273\327\320\361\3252\340r\016l\250\025//h\345\006."
+	.ascii	"@gX \313\334\350\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\335\002"
+	.string	"\344\002\002\001"
+	.string	"\007"
+	.string	"\005"
+	.string	""
+	.string	"\003\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\002\005\001\001\004\003\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\n"
+	.string	"\001\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\022"
+	.string	"A\263\211K\201\2251\360|\236\244\263\206\374\200 \n\204\0022\251B\303\271\302\305b\220\204\263\3402`\0270\270\260\273\272"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`\352\0015\n"
+	.string	"R\016.0Pm\222\016p\361\"P\n\370\246Q&3B\303\003\205\025s[&PT\274L\306\354\373\231\332UUUSA\303\200u\233\277Q[K\b\331[\246W\223G\256\344\275g\311@_Zo\t\222\303SA\342\360\013\017\204\016\200\fe\203l\026yzi\255\344\372Z\330T\365\247\212}\245\311\317A\214\f\205\217\233X\320\200\350C\034\211\bIh%\255\251\302\277\222\377k\330^N\202\274\2462\3075\016\3643\225\353\363\261\367nrr\247jh\003\277\030\366\324R\247\374\3268j\360\275w\320\276"
+	.string	"\031$D,\004\",\376\016\233\177;\315\241A\346\355d\203\003\305C\300C\343G< P\002A\212\354<\fbG\270\200x!\031A\233t+\224\310pw\001\2020G\200\320"
+	.ascii	"\356\001j<\200cL\301\013\026\032\356T\375X`\331\313:\310\n\001"
+	.ascii	"\241\300\210A@<+\341\n\034\274\020\306\034\351B8\201\202\216"
+	.ascii	"\024Y\b\301\200&\032\354\001\021\035\346\212\206\261\002+J\177"
+	.ascii	"\201;2\225s\f\303|\030-q\020\n^\203\202\372\204\205\"7\331\301"
+	.ascii	"\301\325]\206\270,\303\276\327Zw5Z]\234\272\256\360\272)\260"
+	.ascii	"\236v\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`2\004\005\013"
+	.string	"\222\216)*\220'I\007\313\374\037\373\001\276\037\177\273\273;^\\\231\225\260\325?\307\005\315*\177\302\260\367\243\266\310\266Flk\244m+\223\f\024\350%\236!\327\375P\377P\bh\202=\346\2530\362\232\364\376\342$\215F\002\364d\372d\204*\202\301\221z\341~\360\202X\326Z\266\206gx\351\376\360\016w^\013\206v\234\tT\311\230\246iz\271!\352!\252\037)\376\320\345}\266"
+	.string	"z\211\322T9b\306'c\363\355\3525=\306\367g\307\221z\216Tw<\363\256I\334\244I\236\031{\253\307\364\026m\323*\221\023*\230\f\004M\250\261A\241*I\013\264op\"\241\262\234\007\022\340\3610\002\216\310:\001\223\006\031q$\230\231`\202\t'\r\267\032.c\337(F\b\261\2227\236A\370Qh\"tM^+3\305\216%\330fh5C0\227\314X\265\2429\034\364\344\235hs\316\034\367\025\244\266"
+	.string	"\022g\325\201\331\347G\017\214MG\314$\274f\003\"\327\343x7v\002q\266C]DLd\246\201\370\202\236q\031\250\f\007\372\370\307T`_\232\0220)\343s\230 n7}\205SNBTm\257\310\2051j\236[\257_\212B\231p\314K\246\233"
+	.ascii	"\254\023HZV\211]\200=\277\320\277\274\200\023"
+	.text
+	.section	.gnu.lto_.pureconst.266c50917d335358,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\231\004\001\232\004\002\230\004\004\272\004\005\230\004\b\270"
+	.ascii	"\004\t\232\004\n\230\004\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.266c50917d335358,"e",@progbits
+	.string	"(\265/\375 \341\325\003"
+	.string	"\322\204\021\036\260%\351\300%\017\2255\f\013\032\320N\312C\266\352\330!N \3046\3226!\244I\231\002\013\n\207A\001\034\204\203\020\205\201\312Qg*OeslB\246*Wm\347\353U\006\312\371\206k\327\216]>\233?\021\025"
+	.string	"\b#"
+	.string	"\354Ub\261\017\021\214\206y\202\001"
+	.string	"og\260O\305;\025\341%F\251\003-V^l9j\020\227U\2356\354\022\257\330"
+	.string	"l\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.266c50917d335358,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_putchw.36.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`\335\004\225\036"
+	.string	"\2267\301K\240\326Q:\005\026\337u\256\272\"#\270\312#\271\216%\250a\3353\255E\037/kX\331rJ\005\260\251P\241\376\273\344\331~\3322\013\270^\217\327\202\327a\253\360\3709\005,\247\227\006\021(\007\227u\214f\255\021B\b\331r'\031\257"
+	.string	"\246"
+	.string	"\253"
+	.string	"<\345/\367>\345\330\272\267x\200\013\234'\271x^\307w\364\230\271l1*\330\023\206T\205\345\336k\313y\255<i\017S\236\354\025\263\030\233\307\343\361x[<\227\266w\332L\226\306\320\323,I\333\265\307\357a\362J\n\372N;Q\242\316\240\226L\\f\342\2515\217B\304x\023%'\333\003\3665\204\251\306\004@-5\035=\252\347\211\232n\332\226\372a$\r\"Y\b<p\260\270\361\002h(\tkI$q\322\364\2617\204^IA\022\267#\336i\260\310\346\334{o|\005\006\215j5}\356\275\\\223\202K\347\2263\237\0023O`\266\022\002765/\3764\227\372g\236u\226\251\305\300\274\234\352w\371\325\337\222\336\352\247\331\312\261c\235\321\363Zg\363W\347\222<\325\331v\345\356\312\325V~"
+	.string	"\005Ef\216\367\2068f\271K\310!2\216\365g\375Zo\3463s\217\037\344Bnd\0313k1\327\351S:\255T|\360\311\342\235w\206i5\225\364u\357\215\2005\364\373SB\177N\200_\367\026uN\362\203\223\274\032\242q\271FS\037zx\030\364n\305\343\276\327\211J\203\256\247b.F\357M\241d\353\336{\200\027T)\017Bl\257\314\357q\037\275\027\003G\2440\"\035\"\216\262\240=\324\271\355\033\217BMu\031U\260\267\023)RX\347\251s.u\216\323@>m\263-m\247\rd\027f\017\231\003Q\213|i\r\304\036\266\245\321\006\336\370\023\n\261\213\204i\266\326\245m\003\267\376>\324\211h\340\235/\370C\345\311\367\237"
+	.string	"\233\210\352\221\023\034\355\227\206 \364\372\331\260\367\336[\362\316m\3034\215\224\237SQ=r\0039\361t\204\354!\327\3169\257\254\025\301ye\254\201l\271\350\263=\254"
+	.string	"\2100\270\232W\322\272\006\304\212\251(F\025\214\271\350\253=d~\203&IZp?1\343\0047\f\273]\220\216gf\370\251\271\003]\250\035~;Pn7\224\263\374\263\003\264\273\005\351r\266\033NH\b\367c\273\005Y\020\262\375\3506\330v"
+	.string	"0.\207Ag\333\341p:\233\254xogg\337\334t\372\313\261\204\250\213h=\254\021CVc\366I"
+	.string	"\211\254\326l\323\226.eZ\247\343\325\242d\272V\225]\353\nL\306\331\3315-\323\335<LFd=\344\247\375\3047>\206\202\030\206\332\340\2649"
+	.string	"\t\032\323l\315\264\311\006\222\375\024S];';\246\035\b\257\374]\305\n\223\250\230\201\233m\323\266\252\254\265i\232g\232s\216\332\307\261\256\315#\f_\250a8\343\020R\006\031\031\231\200(H\242\016\200\002\231\301\272\r\021`5FhA2\354o\305\024\377f\211\030\"\371\377\3236\223\271S!\217\237\252"
+	.string	"\315\255\037\335\302\347\006\nuy\356x|F:\242X\022\375&\301H\251\fe\226\241k\037\3364\212\251\263\351<|G\323p\344@\035\245\227X\332\t\251\350\353\t@@+\n\316cK\261g;p\226\3471\026\212E\363\375\001\274\317\013\370\0274\227t@U\207\30710+L4\020k1\267\243\234\262\326\273\362z\247`\304\177,:G\bn\364\255C\016\023\372u\343\354\253\342MM\350\312\341\255G\224\201\317\374W}\254g\314\225\357\351<\222c\002\007\270"
+	.ascii	"\311)\347cS\236\032"
+	.text
+	.section	.gnu.lto_tfp_format.37.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`h\017}J"
+	.string	"j|\200\033;0&k\f\364\222\232\2428bC\2210\372\217\037vDW.\226\277\221f\367\341\315\310\226\275Y\373\335mb\177"
+	.string	"\236\323\274\2602\330\326\273\237\004\360kk\"\331[J\271eJ)\005\256\001\213\001\243\001\177+\334DB:1)\334^63\224\033M\253\351\302Fd#6l6\320>\364\341\276|\033\004\257D\276\357\333\t\306\243^\303\211n\364\3155C\227\027\031B\001\003h\2479{F\251\257\333\002(\214\177\224\275\344\017~\rmB\206\354\327\363(\377\b\364\2225\360\352\334\325A RJo\021\301#\027\3346\303\314\354%\207=\031!~\f\337\327\320"
+	.string	"/\360@\"\204`\355\314-\246\307@\233\312\177z\351}\353\366\f\337\227j\200\275\334^2\325\3550\375\007eN\\\251wpMw'-C\371\276/\330\263\237\330^\256\335\304\366\362\255\360\323\241\255\365\314\302\272\262\252\242\232\222\212\202zrjbZRJr\"\035\0315\231n\313.\327w(w\230^\225\r.\332Z\353\007V\025\267\306H\336y;\263J"
+	.ascii	"\354\303k\3044\177\256\305\rv\026V\243\211\351\253\257A\300\266"
+	.ascii	"Z\356i\251zC\345E\375\363\233:\304{\3743$\025\325\327PY\366\374"
+	.ascii	"\311\357\f\377\374\234\232\364\232)o}ny\273\342K\213\275.N\241"
+	.ascii	"\212i\245\244\273v\336y\233\262>\337\367\235:\322\231>\222\002"
+	.ascii	"\346\017\317\017K\0309\266M\"\347\327so\200L\243(\335\354;oQ"
+	.ascii	"\2408Sk.\356I\273\253W$\033B}\347\355\311\372\344\266\307\326"
+	.ascii	"\213\255\265\345\315\211\267M\232u\302I{\261\275\rn\315\227s"
+	.ascii	"qc"
+	.string	"z]\237\354\320\371q\302\251\255^S9K\214\340\212\3707b\257^\240D\376\031\232\213\033lo-\274\357\313\316\006\027\327\f\240\231\335\214\231c0#\031\t\354\327\2675\237\337\224\235\360\016\b-#|\327\2671\223\261\355\367\234\340\234\"~\210\214e\277\375^\233v=\373?\344\364H\027\265A`DMxw\\\376\362\177\310\025\256qIsP\250.\217E\320gl\204\357JB'\270\247\351@\271\300x\272\323\343\026\302\3662\302{\2316(\377M\246\233-\220w\023+\340\377_D\251\\\343\362\325\213\275\005W\247OP\327Q\343\340Y\026h\256\307\361\253\343\3324\315+9\311\3739<wx~\252}\224\303\276\037B\224\252t\021\232W\372\230+y\034\327\267\343\255>c\303>\207\035\311F>E\374\3207\366\t<\363o\307L\215\372\201\276$r\370\353\230\307p\320\220\321:\213\261H\321:\243\030\321:\213"
+	.string	"\321:\177\350\300\356\016M\355\346\320\203\335\030.T\230\020!\254\025\233\0134\234\346//\002\235\246\271\213k\300;o\275\263"
+	.string	"\247s"
+	.string	""
+	.ascii	"\255\263\026\222\363\263u\316Z:c\265\316W\255\263U\353\\\325"
+	.ascii	"t\246j\235\247\216\234\245\230\316Q\2553\324\221\363S\353\354"
+	.ascii	"\324:7\265\316LF\316KLg\245\3269\251uv6\235\221\230\316G\275"
+	.ascii	"\246\331\350\235\233\357\314l\235]\327\271u\235\331w^\276\363"
+	.ascii	"\267\316\235C\305\033\245$U\341\373\272U&z\031\327\303,\235\330"
+	.ascii	"\255\330\r\247;M\367\232\356\303f\231\233\271\333p\273\3517\275"
+	.ascii	"\310Fp\316\236Q\2457\255\021\f\337\013\3053\367\345k\t\005\003"
+	.ascii	"\377`\t]S\200\310\251\336\3223C\303@\001\275\331\224~\351\255"
+	.ascii	"\004\035\253.m\245\377\307\312*\223\215L\223\202|(\333Y\035\264"
+	.ascii	"\364\341\271\036\304\377\237\265\351\323u~\322w\340\013\031\274"
+	.ascii	"\331>\374\372:I\354\244g:A{\347\367\333\264R\351\352)\235\255"
+	.ascii	"\221\236\231\203\0077\322\334 \220\376\201[\230\244)\304\021"
+	.ascii	"G|S\275\257nv\027{\364\314%Lx\263q\333q\003a\271O\260\030\236"
+	.ascii	"\371\350\037\270e\0214\262\366Q&\334c\033\347\333q\230[\236 "
+	.ascii	"\037\217v\222*\033\244\325\210\353\001|\033\277\357\\\205Nlf"
+	.ascii	"d\340`\241Dg\336\237\343\206lg\025\2201\352\212\230\350\330\334"
+	.ascii	"\035q\t\263\327l\307\356\273/k\230\215\247\013|[/6\21048\322"
+	.ascii	"\302\346\205\347\225I\340\275\\\215!\235\370\246r\224}\306:\032"
+	.ascii	"{\332\240)\265\222\375\235\034L\304\255\b\362\n\245!\356Cx\246"
+	.ascii	"\030\022\342.\304\220n#\036\225InA\f\351f\336\274Y\336Ir\313"
+	.ascii	"\271\302\370\327\367R\001\304\355\310\220\256K\342\225\022\371"
+	.ascii	"\327\367\207\231!\237\036\247r\357\033\355)C:\333\373z}?\026"
+	.ascii	"\372{\243\370\"#\035\027\336\035\233\t\232\371\315\3575.M\246"
+	.ascii	"\231\337j\361cH\016\255\271\330\314>?:n\205\347\265\355z\002"
+	.ascii	"\337\346\247\317X\002\337\225\244\221\351\344\035\247\335p\233"
+	.ascii	"fs\"\333q\272\214\n\227\315}f\026.\274\331*\374S\372Q\356z\367"
+	.ascii	"[\310\001jP\027g\216\373v\334|~{l\367\031\333w_\366\226\334g"
+	.ascii	"\001Ct\370\r\036:\036H\333\220\341<j\230\231\215\225\001iq\314"
+	.ascii	"p\26322\031bK\261\037>\243F\017\037\317\033eb\256\331\016\033"
+	.ascii	"o\243\207\331Y\217\225g\034\260a\306c\254\254\007\030\017\262"
+	.ascii	"\035;\310f\200\361\030\023\333\0016\243\314\007\330\201*&\353"
+	.ascii	"Q\243\f\314\214\214\254\f\314\210\3722\366\223\353y=\002\360"
+	.ascii	"c<\366\31668F\264Oc\037\207\335\221\201\204\275*F\032\212\214"
+	.ascii	"\272\"F-\304v\361t\021\343_\315k\226\321s}[\330\227\t\362\361"
+	.ascii	"\002\343)\354\275\314\226\200\337\022\260%\251\350'\327\353\023"
+	.ascii	"k\3007b\233H\353\223\026\2568\336\250\373\331T%\353\262\256\270"
+	.ascii	"\036J\r\213\264\260\212\3067\236\304=\252\021\237e7EZ8\305\342"
+	.ascii	"\235vr\322B)\031\277<\"\255:\245\370$:@\322B%\020?`\311\025\305"
+	.ascii	"Ia\243b\265\237f\013\335\002\252s\206W\\\317\276\004\332\307"
+	.ascii	"\211]7\325\323\363\273)\226,\001\336\317\354E'\033\021\265\223"
+	.ascii	"\260\216\025\215_\226\331r\"\214\303\250\026\331f\211TC\221U"
+	.ascii	"\"\236\353G\374\253y\376Wk\211\320\202ja\237/\201I\236\340\242"
+	.ascii	"v\022\"R\261x\n\202\216f\262\260>\353]\215\364\352\261\036+\315"
+	.ascii	"\261\252\344\352W8V\354L6\032Y\033\324NB\300)\261\347z\031\377"
+	.ascii	"j\252\336J\314\252\352\203\340\351\221\232z\177\322TH\250\244"
+	.ascii	"~J"
+	.string	"\352W\340\325\211z\204z\245\356b\243\242>\303\323C}K\027\241M\266\327?\375\n\274\252\3640\315+\241\n,\031\023\250\235\204O\236P<\327\247hz'\024NM\337ow\205R\247\001.\210\251\013\364\213\032\267a\n\201E\250q8\345\2203C##\"\222$I\032\003\201\005\304 \346$3\017\021 5TL\315\f\245\222\341\005<\204/\226\222PM\307\r\026\257\227\226I\351\250\210\243H\255\327(\261\255\\^SOD\370\004\236|\013\277\006\3050\366\251\353s\004,e\225)\303\240t_\312\303\372M\237\331(\017\031\233\247c\3603g\227\373\240\b\272n\202\310V\353P\317c\352\226C\261\252\027$\r\252\211\354\201\333>Q\340\262\272j-[\343Y3\t\256\212\364U\0239z\377\001\3212\300\3066\001V,\266EI\376u\350\366\321\372\035*\216%\201\277g\"\233]g\004\242|\374E\203b\240\310"
+	.ascii	"\007\332U\244\034\031\301\037I\367\303\036\260\222\244\326D\026"
+	.ascii	"\036\204%\245at\301K\333\355%\035m@\3225[\013\020C\r"
+	.string	"\200\251\364\340\201*\335\341E=7\326=B\273\254D\234/\344iTo`\n\213(\270\347vF\307\251\250XN&#jL\177\232\203\317Y7\356\341o\302\341\324`(K\\\224\371\205\2021\250\317\266\215\272d\372\001\273@\237]\256\262V\n\235\366\231\241\230(J\254\376\346\374\272;h\2427\016\271/\371\272G\3430\001\024\2313\026\b\004J\314<\033T~\247\016S7\316_m\t\304\261\026\242*"
+	.string	"G\235\351C\004\224\306\022\241\027\244Qy\277\272\301\241\277\352\006b\020\177\226\373\033\362\353ea\347\311;\355\007\337G\354\327}\354\177K\257\006z\025\242+W\354\264\234?\257q\016\233\272\360\357\223\301\261\371\343s\356\325\210\025\217\025C\020\303\241?\226\276\316\345\241\334\300\242\004\024\023\361M\340\233F\b5\216P\261\3606\214Hk\001\317\310F2\360\252\n\177`\320cQ@\027c\037\255\023\213\350\020\323\230\274\270\354^\253\376w\024P\245\200y\344\f+\305\226\261\332[\235\215\275\027\031\245<\332\252D?\244\006"
+	.string	"4>\213\203\302+i\213\257^\024\350\375&\345\341\034\3715B\025\254\322\300\t\372Z\342i@5\237\031\264\030\351\210\232\373\371\301\200&\305$\357"
+	.ascii	"\350\336\3370u\330\340\2406\030\352\311\316\017\035=R\371\330"
+	.ascii	"\204\222\360O\262%\215<5\036\217q\f\316\230y19\217\224l*Hx++"
+	.ascii	"\021\330\346\331\373\004\232\tfx\177"
+	.text
+	.section	.gnu.lto_init_printf.38.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\375\b"
+	.string	"F\221=7Po\322\001\240X\300q_\231\026\006\204\364\323b\250\324 \300\375j\241\373\266,\267&p\357-\201DB&u\315g\306\325\214\006\330r\210m\345\274\210\264A\366\336;\245+"
+	.string	"."
+	.string	"-"
+	.string	"\230\017T\237\376l\226\327\215}\311d\242\324\262\2734j\374;\374\374\207<"
+	.string	"\024\362\034\002,\354\256!($\272\343m\033\330V\260\357\365\207\225u\241\202p\332\245H\275\254i\246t\330\276e\033\326\210\023zh\377\343 \337IF]`w\344\201\262[\023|\200\371t=A\365\031$/1\352\241\353\252Ox\252\200\321\027\371\b\307\3470D\007\036\324\251>\247h\305\305\342\003Sv\365\300\230a_\356\356:\216\354\223~\371\032\217\263\311\315\343l\322WF\343e\033n\243\231\206a\332E\263M\003F/\256\243\231\002k\233\003G=M\343\250U\367r\343\310\f\030\246O\224\260\214~\017"
+	.ascii	"2\241\th\340\270X `\242\322,\332\313\033\326\262\013\227+\214"
+	.ascii	"\007T5p\005\314UPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_tfp_printf.39.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`\337\001M\021"
+	.string	"v\340rG\360\320&\035PY\2279\373\235X\271\301\321\3114\336N-L\026\216)\257\335\024e \345/vM\346k\r[\336\2734Y }\020\033\361,\270C\004m`\376@\334j\274\035-=\352\3756~\253\225 \262\267\224)\005\\"
+	.string	"]"
+	.string	"^"
+	.string	"<s\206!N\260]:\334~\3427,\333'\2064\340gd\260\344\b\3159\271\322?\264\313\370\001\332\345\206\360*\353Q\256\262|\0236\261\017l=z\220x\271\214\034\257\026\033\022\350\212&\"YO\007\370\322}\354\261D\315\354\003_\256\034\017\346\234\326\017\364pk\267\335\3316\331j\n3\366M4D2\257\214}\330=z\370o\232:J\365F\265\256\372\035$.B6B~\346l\231\025\255"
+	.string	"\311\236\021\207\375:,\037\3471\223V<\207u\035\2258c\302\331bP\023\303e\301vy\002\207\331\247\344\n'\250\240&\350\006\344\322\"\333\245\332Oq\025\254\207\033\036`N\231\233r\367"
+	.string	"L\321\343\234s\256?t\002\205\240!\231k[\026\240\r\202\266\375\352\332$\025\364\337hK,w\361\027\256Q\322u\332\245."
+	.ascii	"\237\305[\230\370\"l\341\244\377.\375\223v\371\005\201\271\361"
+	.ascii	"\001E\314\212\316<R\220\177\3471\024\202\016\237\355]\320\177"
+	.ascii	"\366\230\2613${m\313\016[\272\001%\0314e\262Z\235T\0328V\250"
+	.ascii	"\223u'r\262J\235T(\\\312C\241\274\216K\235JP\\\247J\341D\f\330"
+	.ascii	"C1Qq+\317Sq\244p~\264$\036\240\225\345`\2258'\b\007\327\371e"
+	.ascii	"0\235\305\235\361\277\261\237\027(\235\242\305U\341\320p)\221"
+	.ascii	"\013\350\256\r!\202\376\213[r\371\034\006\006\t##\332\003' \240"
+	.ascii	"\002\021\301\343\001\321@\345e\353\207\240`\321\t\206\260\224"
+	.ascii	"\030v\227\2658\371,6\367\326(\266\203q\022'\302S\303\325\310"
+	.ascii	":Ga\300\30246\357\262\213\254\373U6M,\fC\344\200B\314\2032Xb"
+	.ascii	"X\221\352C\004\017\022\356]\242\003_^\217aJ\363qM3]\375\t"
+	.text
+	.section	.gnu.lto_putcp.40.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\315\t"
+	.string	"\026\223C90%i8\200\213o2\377a*B+\204F\345N;\017W\276\001cBlj:\2615\237\240\230\275\227\033\214\354\230\031A\340Fh\246\325E\233\200\306\320xm\262\367\2262\2451"
+	.string	"3"
+	.string	"2"
+	.string	"\233\307\027p\337\272\023p\337,\3324\037?\226\343\222\271H\001\260\273\236z\\|\212\376O\036\260b\241\236\234\206\335u\256X\032\267\336\366\201\355\217}O~\327iy\001\301\354f\314\002llc\021\261\375\216mM{\201A\374x\262\356v\254\300v\367\343\204\247\375\222\233\210\177y\346\003\273-\022\330\356\3701B\367\034\251*\373\312F\341\327\324\274\261\030Q\035\205\302\324\201\370\023\334\267\253@H\r\306F*g\366\210Ju\331\327vw\255-\373\343\317\375\365kZ:\265\f\337I\367\007\212(\215B!\311\033\201\"\021\370y\243\320\203\310\373B\t\017d`\220\004\021z%\020\f\275\316\270\327V[vp\211\245TeN}\225\212S\312L\3347OL\017"
+	.ascii	"2\2413\0348.,\257\322\3404LT\303C\311h*\374O\350\312\027\230"
+	.ascii	"\271\006\274\n3\024Thp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tfp_sprintf.41.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`t\001]\017"
+	.string	"\246\335hF\020\217(\035\200\371;<\310\204\370@\240\213#\360\037\\\375c\037\027\242\261\323S\355\250\337\205}!\220,\2425\234\033kn\325\177\0020x\224\254"
+	.string	"\210"
+	.string	" -Q@9\211\252,\344?\024E\r\305\304h7\331;\245O"
+	.string	"W"
+	.string	"V"
+	.string	"\037Vpi\177\304I\210\257%\327\330-\235\\\273\256\017'\330N]7\333\276\210\243D[F\253+\244\233b(.\261\335\355:\276\2419\325>@s:C\\\274\024\375\263\256\265\264\274\214$\321e\306\203\335\265\034I\034\356y\333\bl\207\330r\013\237"
+	.ascii	"8J*)&\331"
+	.string	"\234\251\253a\026c\264\202\2468]\365\257|\230\307\330\234Co\231v\210\251\240v\227\013\331\334\351m\321w9\313\334\211\277\210_\221h\353\241\256(\344\344\332\320`;=\201\253,\323qR\227\304\340\304\002\025\333]\217S/\330d\352\002\n\327n\r\224\243E\312\353\267\371\230\313\0270L\314\300|\030\311\231\003\310n\316\267B\0226X\354\216>\276\365\022\234\003+\023>\371\221\316\263\274\\2\030\312\024y\223\036\177\353,\n\0062\214\366\247\202\374h\001\257\225\f\206a\212\354j\"\247\311\276\266\273\353Y\362v\325M\237z\033\013\022\024\001\2018\236P\006\350\033\231\237\333\003\031\001\201\034O\247\003\303\357\013\275\016\344l\276\316\363|:\220\002\016;\"\236\016\024\206\236\216\253\243\333tv\\\254\f6\232&&\321vA8\370\352\207\245\344\314\0322\302\346\254Cx\305d\260\223{\032_\005\350\371,~\211\346\001\034"
+	.string	"2\003\3020\303&\310 \255a,)\314\3366\327\375J\b<\007\303h\272U\3132\256\251cZ\020&;\321\b\026"
+	.ascii	"\003@\210\251\202\302\3407\206\355F5\023\356\005\205\301q\201"
+	.ascii	"2\007\355>))\246k\222\001"
+	.text
+	.section	.gnu.lto__putc.42.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"U\t"
+	.string	"6SB90\345(\035\2363\230Y\320\3650\016\005\352&jN\344-\317D\205\312\312\360\001\325\032\211\200\355DF\002\231F,\f\030\262@\343x}DT|\217\306\366m\237\020\"eJ\0010"
+	.string	"4"
+	.string	"/"
+	.string	"\230\343\t\262c\232\017d\307\354\331/\217\035\233Q]\234Tbv\027\252\352\336\323\363\177\362\315\207*=3\r\273\353\374P\031\267\336\366\201m\217\375N~&"
+	.string	"\244\205\001f\027\243\005`Y\030\313\207\355wlk\332\n\013\336#\205uwce\265\273\036'<\355\223\274\304\273\211].\260\233\032Y\355F\217\0214\017%\373(O\231\360=,1\312\177\243\354\230\352F\343\232\372K\257\034\221\326)\200)[v,\245r\330\277vw\255)\373\361\277\260\264j:\257\f\332E\267\366\211 \205@\235\b\206\270m\3434\030\002=lP\353F\360S`N\004\321A\022\307u\260\023\367\327j\312\016!,\223V\230\223\251\252\366\306\345?\033Xh\013"
+	.ascii	"2\241\037h`\341Q\026&\242Kx`\016P\256\261\257\302`\005\025\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_printfSupportInit.43.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"5\b"
+	.string	"\242O88@\215\323\001\374\344\021\007\361\370\013\025xt.\326\254\342\260\312\346x\206\231.\312\205\tm\220\341k6\326\376^h\003|\224\206\002N]\216\2430\272<5X\333m\357\224\002\306.\t\033\r\263e\250V\263\254bT\303\034d\024\3338z\tp\315 ltS\353F\257\320;\351\005%(\223\224'=\246\3677~\262H\325h(\237\026\320\350 \2470C)\021\270\353\375\363\303k,\370\027f\340\304\177\237>\207\362y\323\243\005(CT\nyqe\207\236('\354[+%l\213C\251H\006>v\037V'\0132=0l\337/\335\3249h\203\216\321\356^\237v\307\276>\177\271\263G\036V\3549\"\034N\252\335\245\222\342\335c\347\237t\200\357\323\360X!\330]\307\357\003q\313\333\026\260m\261\035\022\r"
+	.string	"2\003\302\260\300\302\232\230` `\251\2621\2532t\r\027\017\341"
+	.ascii	"\025\375r/\270t\213v>\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.44.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\305\007"
+	.string	"\202\31777Po\322\001 [\256\242nN\314p\025\2617\002\2442\t\321\226\224\276\034\212[C\255\373#W\330\315\334dI7\225JQOSK\254m\345x\264n\031\331d\357\224\002\032\235\017\021\235\213z@\002\2668\020Zv\321\217\314&\206MKfW\007\223\026\005I\316\201\347\307C\2456'\225\233\272\247\026vv\3008\221\340\204\037\364I^\"\362;,\021z\347\036\375P\365\030]^>2Ho\306\256\243\0075\354S\273\273\206\235}\323\377\250\201\213\026\206\224\335\212\031\231=\305\025\217\215\355?\373!\027\331n\022\235`\267cQ\331\255\nN\320<\272\336\240z\324\274\240z\364f\303\274r\354OP(LbvW\302\215o\177\233\377\221\007p\245\321\037@\303\356\372q%\213\033\3366\202\355\005\333 \001\b"
+	.ascii	"2\241\177/pq\241\024\f\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`\347\001\375\n"
+	.string	"\242\017=9@\223:\260V\307\"6G\223\321\221\251\217"
+	.ascii	"k\305\275]e\365kk{\307\231\302\207\230WQ\004&\"oay+h\273\006"
+	.ascii	"\341\334G\221\330\275\013D\376\272\215\261S\222)\005\272\344"
+	.ascii	"\327\261Fw,\202\035o\351q\274\344\307\361\216\315\261\br\354"
+	.ascii	"\301\001\353\376\330\271B\303\271\351\356\220m\264\204\245\251"
+	.ascii	",\215$\322\240yT\202\232E\262\r\231\300\314\264\331s\3714{\257"
+	.ascii	"\355Hrb\n\232\005\312u\22124\241\346}\021L\036\200\005\234,\253"
+	.ascii	"\224\204\360h\263\274b\345\026*\277\020=\"\345\023(\2478yk\301"
+	.ascii	"%\366\377U\303\236\3201VAL\237M\301!f\202?\314X\311\033b\031"
+	.ascii	"\263\035\035\222\263&Bj;@m#_\215\237\322\252\211\314\210\\5Y"
+	.ascii	"u_\017\236\266\317\035Xj\375\377\017r\006\200\037\307GQu\325"
+	.ascii	"\227\221u\325\310\320<\027\247\252N\233/ \260\002\271\242\316"
+	.ascii	"\001\fR\fb\031\232\306\350\3624E#\005\022\204!l\373\373W\202"
+	.ascii	"'X\004\177%8L\2708\355\332j\025\002\253h\274\"\372\365\020\034"
+	.ascii	"\30018\202\003p\030\034\316@`\\\n#\301\260\204,ZyO\023\016J\260"
+	.ascii	"\373\231\346K@8s\214\2751\373\f\\\270\001\367\216_b\251F\b\356"
+	.ascii	"\023\237\2033\006"
+	.text
+	.section	.gnu.lto_.refs.266c50917d335358,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\003"
+	.string	"\002\005\001\006\001"
+	.string	"\001\007\002"
+	.string	"\003\b"
+	.string	"\006\002"
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"\003\006"
+	.string	"\001\t\002\001\002"
+	.string	"\003\n\001\006\001"
+	.string	"\002\002\001"
+	.string	"\001\007\002"
+	.string	"\001\013\001\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.266c50917d335358,"e",@progbits
+	.string	"(\265/\375`\314\032\215|"
+	.string	"\332\313$-Q0P\322I\007\363\332VYET\002'\372\225\253NJ%\360&\r1$\003\343\256\374~\022\0043\226X\360v#1\352\021\005P\352}J3N\016\217ZF\3630\035\237\210(\325\007\357\311-\315\322uE\037U\272r\260s1\357\325Q\215\355-e\nh\002\300\002\307\002\034\206\351\320<\230\223\313\273\267\356\024\374=~,\206\307\324\324\353^+\251"
+	.string	"\252\346\224\332\370\356MY\260P\301\202\205\355\3425f\204\215=7A\317b\350\317c\370\332\312\021HF9~G\374\372\300j\260\200\371\201\366\205\202\241\323a\255\270+}A\320\263\025z:N\001\334\201BY\005\243"
+	.string	"N\300(\200|ggo\270\271i\025)a\007\254\242\344\236e9\333\351\bQ\253\263j\313X8\312\237\232\334[\333\035P"
+	.string	"\271\n\327\325myk{!ZGw\003\344\212\032\020$\316t\347\202s\r0\001\366E\345\266\3459\226\263b\276\262\216\340(3\177swR\332\262\024\226\263I\303Aw\226\213\2539\224\204Yk\313S\230\n;\017`\270\324\271\264\264\325l{\030\320\377\361\001@f\343(\350\027\017'im\271\215\237\260\363\001v;C\341\267\317\024\2457\355\2552E\224\265\335\341\024\300N\001=?"
+	.string	"\254\177\177\374"
+	.string	"\220\213\340\265\376bs\363\321\226\323\270\t;y\330\311\331\bV{M2\275f\367\246:8EMjumWp\n\240\r\001=\363"
+	.string	"u\376\376\376\376\230\007x\275\343\335H\021\242j\256\355e\240\217"
+	.string	"=\033\035\243"
+	.ascii	"\226\345@\235Qmi{vr\031\213\361\263*\221\232\027\355\336\364"
+	.ascii	"\304\007D@ii\313)\223\235\237<\366\027\026\274\"\237\327y\357"
+	.ascii	"\345g\005\315{\213\370\251C\346\336\"\035\346\004\230\023\260"
+	.ascii	"H"
+	.string	"\252\270\322\200\366\016\240O9\005\020e\024@\035\252k\301\033\275\375\273\213\b6\274\346\357\272\237}`b\300o\376f\036\200\277\343\016\374\333\207\237\261\316x\310\222\237c0+R\206\301\013\370\273\355y\364o2^\246?\0071\366\363\007b?'\225\374\354\374YG\222\237\221\374\034u\344g\006\330\352\377\003\377c\370\031\214Y\034\202\277\301~nq\232\277\223~6\3623\327\317Y?\377\370\271\351g\346\317H?\337\370\371\207\237{\370y\207\237\207~\016\372\271\306\317??\317\370\331\206\237e\370\231\204\237E\370\031\204\237\025\370y\203\237]\374,\343\347\013~\206\361\037\350?\013\377\311~\256\340\347\236\237'\3709\202\237\033\370\331\201\377+\374\274\300\377\262\377\317\377<\377\343\376\333\374\375\375\375\375\365\1775\376)H\ba\367\202\361\205A\211\254\025A\255\270\017\273\027y\342\246w\2514\243B*\227Ta\236H\357\224"
+	.ascii	"\327\314\352*S*\246m\336\276\351\345\233\244b\346\240L\233Ke"
+	.ascii	"\332D\356\334d\023yo\312\334Q\242\025!YiF\305T\2325\231'n\362"
+	.ascii	"\"\257Y\321\024\232l2\225rM\346\216\322\254\210\251LR1O\020\301"
+	.ascii	"'\244\213\016\260'\036O"
+	.string	")\223W))\252h\271C\247L\233\327\356^F;\272K\005\356\215j.\355\212z0\233\021\235\222\221\223\242&\017\220dT\325\274I:e\221\346\275E\214j\334\244\n\220)\335\r\302tH\253\250\213tt/\0017\2757\351^$_\272{/\362\336K\263\214J\357}\332Qv%%\335\353\244\"\351F!\333\216\356m\264;6\246\322\254\252\331\323vf\326u\201H\221\334u\355\250\226\250\031\222\354\"\201A\273\230L_\222 \271\3413\"\313\355#7>\200\300\341Q\205}\256\372y\031\231j\"\270\366\230\240\356\242\214\024\321\343\333SB\204\235]\344s8M\0335\246\246\255\266==o\"<\326G&\345\353xH20*^]37\b8\250\266]\315e\231fZ\330z\310\233+\347\357\311\245K\333\026r<-B<%i{=~r\221\213R5\304V\323\r2\037m\337[\177\013\301^\370i\203"
+	.string	"9Q_VWmq\030\005\260\265z\336AP"
+	.string	"\227N\351E\233\361\0217\265\325\366\206Qd\275\261\354\272~\310a]\351$\341\2015\304\325\251i\3533\022\204U\025\232\254\222$\327UM\225\227%\006K\333\251\032\275'\031*m_\227\320-\334\245\213b\034-I(\373\221w\357\275\302I\260\226\2452 7Z\231fe)/\311{L\312|tS\007\301|5\355\242aR\265\325\323I\315d2B\242"
+	.ascii	"\215\255("
+	.string	"Y\321:kb&\307\213q\264\2549\262\022\244\247\233\032G#U\262%\232f\244$\326Mm\324EL\347\224^\244MYT\017(|\177G\265\217~j \335\354\036\375\243\245\332\251\241\330\331M\275\343\315\324<X\250\2508\254\214\232\001\330w\026\024x\273\206C{\211F\266\345.\265_Y\326\270\332\276\227Z\351\277\367\002\305\254h\301\025\201\276\2379Z\207\216\230\2440X\300r|5\0208Ev,\r\261B\373\350\366\331\314\251EMG\254\265}G\241o&\364\235\003m\244\n\024\311\246\245\f\332\243\307{N\270\274{\323\263\227\277\347\013\2071Qs/U\\\327\275ue\370\257/\223a'\373\361\022g<\346r\025\351\275\311{/\347\235\375\270/{KZQ\257?\370\271\344\357\255\254m\205\342g\037q^\035\265\255O\235e\006\206\313\255m\365\361\267\031/\316\266'\207BcUFy\026\305\304T\233\220"
+	.ascii	"\355\226r\312 ^\233,\334U^R\333\312\343r7fD\372z()U\246s\306"
+	.ascii	"\352\211\022\256._\231o{TKm\353\022\023\020@T\244\327\344\225"
+	.ascii	":\322e\343\254\223\242Vu\274\"qIc\333\243j[s<\016(\305\353J\216"
+	.ascii	"\266\025\207\022\230\204\376\326[o\250h\326,]]\276\302X\310\243"
+	.ascii	"\002R\223\2577\270\340|\2711q\265\255F<N\206\264\361\265\255"
+	.ascii	"E<4RU\316\214\332V\344\337h\220oM\350f\256\240}\357k?~:9\361"
+	.ascii	"X1u^le\336~h\022|dp\264m2\255\327[Pz\020a\276\252\275-kS\306"
+	.ascii	"\260\263\307\360\236\b\267\210\311#\345j\231\343\273\313)\021"
+	.ascii	"\324>8,(Y_\276\264\030\2767\013\232\024\\\330\315\331\234\223"
+	.ascii	"\"\275\367\026c\203\005\205t\352\321\355\355\241\351u\230)Jq"
+	.ascii	"[S\366\251\t\024*m\301\364\216\343H]=ea\352\322\245\363\230\311"
+	.ascii	"\223\024\034\237\305\262\225\324r\275w\036\227\231*E\206\244"
+	.ascii	"\265\375\f\362\356\256\361\370*\357u\2725\t>)\2700\251\034K["
+	.ascii	"\336xo\026G\330\023&m[\013\227\321\204\351H\003\243\207\005K"
+	.ascii	"\333\2417\275\242\"\005\307\227\323\345\245\252G\226\267\335"
+	.ascii	"\017\\\212\273S\202\225\343\344\3122ww\345\312\361\370\304\275"
+	.ascii	"VKt\315U\251\322`\031\214\261O\2168\242\351xI\023)8>\035=*M)"
+	.ascii	"$\336tld\344\300\264\355\271\343\331\204A1\223]T\246\360@r\346"
+	.ascii	"\304I\307\261\223\006UZy\327\311\211\307\304\016%\246D\2755\034"
+	.ascii	"\223e\235\323\224\246\362\327\360\221W\222\2511\264\243\264\224"
+	.ascii	"#%\270\302\354\221\007j\334|\340\375\331t\365\r1\244mC9\036N"
+	.ascii	"Rl\354G\333v\353.\033\267\271\034um\373Ic\241I),b\335\266\244"
+	.ascii	"-n\257\215\r\247\356\206\237R\333\263\265\021\275v\223\267\364"
+	.ascii	"\307Tc\263\312#\322\366V\013\275}Bo\227\322\234\235"
+	.string	"\326U*\322\273c\206-\3134\202W?4\264\346Bo\026\022_\232\366\031zc\370\275\227\274\317\336n(9\267\264m\263\343\325\214}\371i\265\355\262\006\273\031\023#DG\333~\376\255\f\263\215\331\266\311\370\211\246OEQ\312p\370\320\316\234xA\337\316V\362\026\373/\326\\(\362^dz\227h\256\264H\301\361]\247%\317\353\032\372\376\201\267hy\357\3351\223\336\245\021\016\360\347\363\f3\317\237\303\225\025\2707\203G\243\360H\004\300\016Ec\215cQ\210\206\206p\bd\177\204\206B\304#\020\321\306\214`p\007\250X\344 8\323\303q(\350\203#1\210HHhd\201\210X"
+	.ascii	"\361\205\320\n_\020\253\360\005\021\310\306\314k\264\020*\022"
+	.ascii	"\205\212>\303\241\036\216\013\b_\020m\330\341\221h|\341\3465"
+	.ascii	"Z\224\300\302\b+\2708\016o0\n\2178\370\024\201:\030\032\213\035"
+	.ascii	"\004\r\217D=\254\240\223\302qH\204\342H\024\032a\310\306\n'\210"
+	.ascii	"\206\2166\212?G\242\233\340\221(D\274!\"\032\372\370\b\2014\364"
+	.ascii	"\310@A\r3+\2103\204A\035\210z "
+	.string	"\332\271Ax\f\006\2039Ga\220\261H#8D\343h\263\302Npf\207\032\300\0270t\037\242q(4\274\001}\0050$\200\021\203\007\232\307\2201\201\214\t\200\217!\243\247G\006\214\036\3640z\352\221\210\b\024\024\352@C\303\347hch\346\030tAd\034\352@4\376\030`\034\022i\020\217B\303\037\242\rQ\020\307\205\243\261\230\302\316\020h\206\220\005\035\200\303\340\360\247h\202\315\360\247\030d\207A\024\216\306\342P\016\221P\221x\034*\322\f\217B\025~l\bg\240F\364\370\032-\202+^\034\032\032]\034\213E\243\213\033 \242\360h\211\2027\b\021\21583\2008\020\t\203\3541\370\202\202\037\341\260\2065\016i\320\260\301\001\017GT\007\342\320g\250\202\n\033\3431\205\021\200\204D\343\220(\3051\030\203\346\030\204\321s\024\"\332@\217A\242\026\206A\304#:\004\372!\342\b\217B\017p\360\021\316"
+	.string	"\002\022v\300\203\321\204QX\303\307\276\247\247\203\025-\234\020\002\352\323\202\306Q\210h\034r!T\f\n*\372\270\020\"\n\203\\\370\030\211\\\264 "
+	.string	"\255\375L\350I\201a1\311\032\363\306c\314Y\345B\255H\021\271\262\244\343z\204\331\262bV\215L1\365\025Q\313\300\276\274]\355x\036J\217u)b\213\214\211\366\370\272{\222\326&4)gc}f\342\352\313\327\232X\2751\003\306k\251\254*\341\311\031\203\305(\314Y\221t\276\274D=%y\334\327[r\252\"\251?\346\326\310\260\332\326\260\256`\365\310k\330+2\rC\200\214\316S\223)_@\353\365J\304\253\032\231\021\253Mgsp\265\310\253\221\273/H\243\266\277\341\022\263B\242m\375\242\013\362*$H\345\232Qr\257\321\004\251\221\335U:\361\320\354\205\311Jb\310+\327\215\222\2103\260\272\365:\304\023\251+\252)\350_\205\370kh\322\260@u\271\241\007>\201"
+	.string	"\251Y\374\034\242\007\024>;\265%Z\225\3525\253^5\t\241\326\266^u\265\252X\257W\265\n'Y\257,'`\2029\201\2317!Ee@{\240\023\275^\235\302I\221\227K\235\252\315\232/[\264$M\030Aue5\235\234\352\017%7\316\202;\250\002\3614\2112\2311F\261\221\221\221\244 \351\002\013\020\bBy\036\270\324\003\022 eE\r*\310fd$\005)\324\350\203\022\236\231\3208\246\ta9\023\013\205\301\271"
+	.string	"\204\252\037\023\210\374=\004\357\031\205\315e+9\312\312\217\245\315\033j\217\321\270\361\307\030\024jYa$\351i\215'\266\033v\250\330\220[\343\335\304\214\313>\237\234*\267\350\327d\031\242b\020\241(\357mK6\276\273r\352\023z~\347\023\003\271\356\f\b%6Q9\037\323)L\036\372<\033x\344M\330\225\246\177)\266\305\364\240\301\0223t\377f\275\001`\231S\352g\260R\33550\306w\313[\302'[\255\250:M,_o\f\372ePbUP\262\031\276\304\013"
+	.string	"\325h~\365\2319v\205\256h\251=+5\326\342\30447\006\341\3153\277\351\022\243@\007N\327.\036\326GO"
+	.string	"\357\fG\3209\220o\333.kH\276'S\221?:\330\375A\2553M\357\n\276^\tC\227\370h\025\235\323\320\234\217\240!a\275\317\254\235pF\313jF\311OmM\2140\312\023\203\245\310\315:\245\312gZ\202)>Z\034\370\350\350\325\354\206B\330\202!@\206"
+	.string	"'A\301E/\t\246\335~c\256\231R\203\356"
+	.string	"\310\217L\305\355\344\233`B6\270]\036\374\202\002)\316\303\021\003\t\356\302S!5\270\277\317\236\365j\343~\367l\3627\016\317\24497#\003\367\353NX\037\351\247o\013\016\236\301\377"
+	.string	"\254\260\223\265\013q\237s\337\"\241\033[n\211\315\002\0354.\002M\264)\305]\246\245\237\223\r\f\350\245G"
+	.string	"wX\247G\334\275D\370\271/\004q\262R\342\016Rd(\346T`\243\003_B\330\325\314E\220\236"
+	.ascii	"\326t\324\355\236Ry\253\217K\2743r\t\316\224\376\206\351\357"
+	.ascii	"3\2054 p!<0\271\322\217\254;\025Fw\335b\201i\251fm\310M}\316"
+	.ascii	"\001\251\260\031e\305\2249\366\373^#e\221\034\274#9\272,\316"
+	.ascii	"$\334\316k\336\346D\205\027\211F:\333\276r\021%/\362\244C\255"
+	.ascii	"\332@\363\257I\275\3244dh\007Ug\247\321L\002'\341\024\006|\274"
+	.ascii	"v\004\246\266TW\302\024\271I\013\207\230Z\337\342\250\222q\023"
+	.ascii	"Y\356\024[\250\227\204E\031\030H\330\241s\317\357H\213!\366~"
+	.ascii	"\030\254\254\023\f\220\357\231\035\332\036\002\362\003\033\033"
+	.ascii	"\311\350\003\366\007\033\334A\223"
+	.string	"\255\031\245\335ZXAJd\316UU\234\243\331\271\340\310\004I\272\025\300\300#K\002,\336\352\222P2\267S?Q]\255\230e\270\305\005\233\234\265\226\261\333\020\353\363\013\034/\261\272\373\343\007U\253\235\375\323\310\315\363\247l\201\001\271W%\320\350\312p>M18\374\373D\003\252\020\334G\274P\245\177\235,\261\005N\243\213\032\266N}\342S\235*I\036\316\216$\313ts3\035\030*f\275Y+\222~;\t83'\372\202\364@ve\347\013\304_\355\232\"k\332\t\214<cWQ\242\034%\306\274a\0160 \375\313\376\303\321\006\364\275\216F|\345\237jr\362\243\013\357 \276\322\330\353\336\345\316\026\211o\001\245aew@\177 \221\005b\332;\0013mJ\200>La\023\025\310\024\214\007\004\3758\027{[\013\332 \021\323\221\275H}22&\244\013\324\264\211GX7'\367,\005\013\356I\003("
+	.ascii	"\233\005\316\314\216B\f\376\036\222\323\260\254\230\371\214\335"
+	.ascii	"\223c\215\027\0244*\321b\013\216\033\350\213\t\027sBtt]1u\277"
+	.ascii	"\227%`\276\210\365${\316TsQn<\372\001\360D=h\237\253\3672\357"
+	.ascii	"\326\364\003=\327y\363\372~\263\214\227\023[\335\337\254\001"
+	.ascii	"\236\366=W^e>_\344\326\334\307\360X\006\026\023\235`\377(\224"
+	.ascii	"K\310[\360\351\334\235\220\031\240\271\313\326\233\225\347\320"
+	.ascii	"\371\213\367\207}\251\2153\322-0\313_\376-\377\253\277\270\212"
+	.ascii	"\323\344\002/\007\240\205\311\236\343@\351{\370'b\031\234\262"
+	.ascii	"\0371?\373\177\223\375:\223\212\205\354\277\365#\374\216\205"
+	.ascii	"V"
+	.text
+	.section	.gnu.lto_.symtab.266c50917d335358,"e",@progbits
+	.string	"tfp_format"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"uli2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"li2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.266c50917d335358,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
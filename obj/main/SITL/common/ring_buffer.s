@@ -0,0 +1,403 @@
+	.file	"ring_buffer.c"
+	.section	.gnu.lto_.profile.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375 \250\245\002"
+	.string	"\204\003\234"
+	.string	"\006"
+	.string	"\240\222\351\301\004\b\002"
+	.string	"\002\001\002\002\001\367\262\317\345\r\004\002\366\373\347\275\t\n\002\002\002\003"
+	.string	""
+	.string	"\003\345\301\370\263\007\004\301\223\354\265\017\f\005\317\245\200\361\001"
+	.string	"\013"
+	.string	"B\267\336p\001\f"
+	.string	"\034\306\347\327\213\035hl'\246L\262\355\266\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375 t\325\001"
+	.string	"\340h"
+	.string	"\006"
+	.string	"\003"
+	.string	"\001\001\001\001\002\002\003\003\004\003\003"
+	.string	""
+	.string	"\001\005\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"<\t"
+	.string	"E"
+	.string	"\030J\325D\314;\244Z"
+	.ascii	"\016\273@|\363\007\3145@$0\300\002"
+	.text
+	.section	.gnu.lto_.inline.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"%\006"
+	.string	"\002\n!+\200EI\007\3233\016\205\023g\316\311\346T\203\213\201C~\301@UP|\373\237\025t\210\305$\206brF\017\377\r\267F\266\334)_\006\027j\2219"
+	.string	" H\374\334\016\n\377$&A\253\262\b\030~\322\200\316\245a\364\217RN\001f\243\230\r \306\350\b\361\262\373\350\021\276I\320\343P\357\033\370\323\273_\004\253\314<\334\177\302\354_{\276\207\364\336V\370\251\231\231\f\177\326\353}\r\255\314\214\036\372*\001\031"
+	.string	"`h\253\220\353\355t6\3277\0069\237V\200\007_{\214aaQ\232s\312b\034\354\025Q\b!W\017"
+	.ascii	"L#\361)/j\f\023.\350IZ\346\021\242\f\273\2642\213p\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375 \304\255\002"
+	.string	"\302\304\016\030\260%\351\f3\rP.\353aX\301$\311q\030h\016\226\220\266\267L2\233\360\203\307\360+\bN\252\252.\251l*o\202X"
+	.string	"\315\330\341\310\223\263\363\023;\330\331\300?\023\023\004\t"
+	.string	"@\024&\354\315\354"
+	.ascii	"e}\030\n(\314\366)x\347\002\037\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\272\005\005"
+	.ascii	"\272\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"e\004"
+	.string	"2\206\025 \240'\351\340j\\\305\247\005fu\256\342\376\327\337s\003\314i\227pT\330\354\377'\233\220-e\n'HrH \351\303h\024\216Ez(\206\f\212\035;\362C%\324\036\224\177j\020\3551$\217\013\227\227\232\021T\251\327\351\353\365\234\247\332\201\362k\3307\340Y\b\025"
+	.string	"1T;\036\370\2755\360\t\bY:\026&o\267p0\206T\265"
+	.string	"q\305\260\261\243\273Hh\357(d\257\301\002!9K#.R\276\334"
+	.string	"\006\034"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.dc19b645cf330903,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ringBufferInit.10.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375` \001\375\f"
+	.string	"\366WVC\020S\224\016(\200IF\n$\320\310\374\230\302\230\374\210\037\201XQQ\b\252\007\335d\320N\323\324\275\006\261\335b/\030\360\004O\356me\001"
+	.string	"\200\bfH\270\276E\320\021\220L\312\322K\352\336d\357\224\002A"
+	.string	"A"
+	.string	"C"
+	.string	"0\036\243;I\350\005vO&'\273^\003S\353\322\336\021\314K\353\006\346\245;\333G\002\020\002>\021\251\225\335\245q\305\273\303\316\177\352\026R\311\303!"
+	.string	"\t\273kH*\225\270\343m/\260\035\301\276\213\237\367\376\352$\177\224\320\017`\341q\340\306.\211\032dQd\216\026\266\357\323\370\367\371\fK\025#\273{]\332\037\373\272\374e;\242.\243{\tW\021\330\017)F@\260./\025\364@)\016\016\355\007&\221\025\025\024\254~\264\265\333\340\016\204\364c@\255\265\236\2333>\312\035=B\230F\260\272\212v\206\233\200\254\335}\340\327\340\340\211)\"\241y\311 \344\305\t\021\254\2667\2021\304~\265\273\353x\262_\362\233\016\230\247\232\231\rZ\203\3316\034\316\206\f\005\013\035l\243\035-\3134\r\355`\0252\252\331<\024s\261\206a\263Q\r\232\266\321\313\023=\365\t&PDq\344\343\370?c\327\241\200\305\210\n\352\334\374\347\013?\311P\370;\f\033"
+	.ascii	"\001s\240\314\2000<\265\260\352&\bF\347-\214;\215\305\274\200"
+	.ascii	"\242Rm\330\2329ADq\330\020z&\324u\231\rh\210?\334\013\354gj\024"
+	.ascii	".S\302\020\240\020\\\006F\004\250(\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_ringBufferReset.11.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\b"
+	.string	"FP;5P\217\032\003 \315\343\026\215\230\002\t$\355\205{\n\263w\325W\223\266\251\241\355\205\031\265\257\274\235Y\340\362bf\226A\302\252\312T\272z~q\332XI\244L)*"
+	.string	"*"
+	.string	"+"
+	.string	"&\320\034\313\265/\005\027\002*\0300\331\177\t;\314\371q\265K\034\240Z\245\374"
+	.string	"\026\376\367\251V\032.t\333\203\266\tm[\002\205\254\326.\373\305\r\b\007\345\317\230\305<\026Y>6m\375Z\217\230\204\263\013\345\201\237\225\262\362w\b\225\032\307v\346h\216\232nM\206u<D|\322\332\b\277$4\377\206Bm2A\001]\376\273\345X\2434\307NK\006\363z\263\266K=\310\321:\363\377\001\237\371\n\362\314\220Ht\37208\224FS\2266\022i\003\311\322\250\201$A\323$=\006\335\036BSBl\333\224\233\356\316\034\262\032Cb\025\320\242>\t\n"
+	.ascii	"2\241\037\034\030.XH\321Q\247p!\030r\t\266YM\twx\321N2"
+	.text
+	.section	.gnu.lto_ringBufferPeekSpan.12.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`h\002\335\022"
+	.string	"\306\343}I\300\224Q:X\025\231E&dS\203\031\346*\371\210\\m\035\322#\007\366\312m\270\250\373Sr\236\222E\220\033|\272\bl\025\316\204(,[\313\342\272\212\206`*\020\320\257S\324\254\227\305\266\345\253y\364\260\344\023B\344N)g"
+	.string	"b"
+	.string	"i"
+	.string	"\273$x\360@\370m\306\333\241\tK=\232vK\005\377\374 \324 \232\035\2039\355\003\335\205\315\313\232\013\330\325\331\221\264[\252X\f\377\271\fm\373,\336\302\3062\2574\221\323@\207#Dd\267\024QN"
+	.string	"\374\347}"
+	.string	"\370OK\\\366)\363\237;\002\237\235-\347\346\363\024aw=m9\037n\275\355\024\333.{\036\005\267\311\213\356\222\007\375"
+	.ascii	"~\273Q\307\335\341\313\377\004N\177\247i/\234\326\323\364\004"
+	.ascii	"\247\037@U+\200\264\333a\207ds|J(N\364\027\375\267\037w\317\276"
+	.ascii	"\017\343Hv\3122?\362\274\351v7\365!?\306\215\212dF\222(\020\311"
+	.ascii	"\302\033\017aN\310\217&\t2v\352\337m\033_\3509\247p3(\250F?`"
+	.ascii	"\373)\342\251\277\204a\303\324\3714\340\277\343\260\001Q\235"
+	.ascii	"\352\351k*hsg\224\252\336\007N\222\331\3525XS\023\370\204zE\351"
+	.ascii	"d\302\tAs\371\214\231p\227Cx\255\320S\004hf\327\2252\204\273"
+	.ascii	";\016|\0310/\003\272\023\377\374\032]\320\263\002(h\356\354\222"
+	.ascii	"6u\307\276\267\273k\325\261\301i\225\247ON\024\2760\262\314\026"
+	.ascii	"\226\251\3015\306\274\030+\246\325\"\30116Z\360Z`\323\253\025"
+	.ascii	"\030\253\325\222iaqyq\301\304\027\362\365\"W\342\213k|\211+X"
+	.ascii	"\214\270\202b\022\206\005\023c$\t\023S\345\354\366\211>wo\310"
+	.ascii	"\210\231\322l\242%z\242*L\265 *59\362\363B\007\216\347\227\201"
+	.ascii	"W\225\036\351)6\222R\200\300\211\240}Z\242'\0325\036\332\370"
+	.ascii	"\033\237>, \320\"\231\263\016\207\277\216\"\240\017\303(\001"
+	.ascii	"+:\356\231\203Sf\035\232\2748\254\227uT\236Y\345\300\037\342"
+	.ascii	"\261\246%z2\033\337\345\322\301\314\271\263\262u+V\352\244\315"
+	.ascii	"\336\034\363 V\031\002\303]4c\325\262ulM\200F\232\"bA5\025\030"
+	.ascii	"W\\\3702G\b\n\357nO\265\322\021\026\031"
+	.text
+	.section	.gnu.lto_ringBufferWriteSpan.13.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`}\002\275\023"
+	.string	"f&\206I\300\322Q:\362 \247Bl\b\237mOM\250\264\234I\375\232\314\212\213\224\227\262\333v\021\032\253\226\312\246\307\366\325J\324\201\336\336\346\246Z\365B\376_Q\024\205\034\230\213\013m\217A\341\243\332\314\f\325i1\242\t!r\247\024q"
+	.string	"i"
+	.string	"q"
+	.ascii	"@\031Vj\227C\220\007\341?\031\322&\003i\224\303\201\332-\021"
+	.ascii	"\\\264\003R}3\003V\253K\201\263`N\373\275\013\325\274\244\271"
+	.ascii	"\311.\320\r\245\335\022\305-\362\242K\322\266o\342'j|\013K\017"
+	.ascii	";\f\200\334\f\365\330-[\254\007\030/\206\0070^\324\016\277}\336"
+	.ascii	"\374\023=\344\321c#g\307\3463$\302\356z\346\354\360\334z\333"
+	.ascii	"\007l\313\354I#$?\272G\356\373U\377\335\"\007\336\251\227?9N"
+	.ascii	"\217\343\264\0302\035\222\323\0322=\307\351\233(h\022\020\265"
+	.ascii	"\213!\370ce\210K!^\364\037\375\277\037\370\320\276\277\342I\266"
+	.ascii	"\3121g\341;=\355\256\352*|\243#Yutc\351V\253\373\371\2404\201"
+	.ascii	"\274Xt\373\362\354/\220\370\321\201\222\020c\253.\336\256\361"
+	.ascii	"\207NdUI7\340\244$B\003\320'T\377"
+	.string	"\205\213\205\371\344\317\214\027\037#G\207\352\324P\277\033\221\233A\213\250\352q\334\004\301\275\336\004\233*\332\f\245\364*\242\263\306MO\256\345.d\310]\035yM\315\370\225\350\341,\373\022\005r7\250\201\337\2026;y\002q\321\247\031/\2464\201\220\217\236o\006\355275\310~\270\273k\005\262\307\351\225\247K^t\007vq\251\314\025\225\311\342\202\271\2040\260\227X\2546\272`\\,\341\212m\372\225b\203\305b1+*-4\231\255E\253\315f\265W\213&s\315Z/\333K+\205\345Z\005\230\255\005S\253\331Z\252\022w\273D\2436\3404g\022\035\321\022}\300\264\333\261R\022EA\332\361V:\352\210\022@\332\371\344D\035\365\204i\307\313\271\016C\324#\275@\016\035\236\017\212\236o\006\375\337\306\353J\037( \260\"\031-n\207\227\216B@\035&%#\353\226\260(6<:\374\311\035l\243\244"
+	.ascii	"tJ\036;;1\202\374\321\276\210^\323\343\277l\030\354\2341\023"
+	.ascii	"\003~\245\025\001{\220D q\372M&\270\311\363\256\264%\306\303"
+	.ascii	"ot\005\253\224\231\333]\363a\202\"{\242\347Z1\t\224\f"
+	.text
+	.section	.gnu.lto_ringBufferPushN.14.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`\232\005\305\""
+	.string	"*A\364\rF\200\334M:\235\225\222c`\303V\2607\202r0F\271\256\240\266\255\336%j\203\204\001\356^\017\2325\203\246\242\017\342\332\300\234k\351F\324n)\376\323\034\267\377\251s\314\177\233\202\310\202\013\244\300\310m\020B\344N)\307"
+	.string	"\276"
+	.string	"\325"
+	.string	"\265\352x\003\223\200{Iu*@\263,\023\021pV/\273\231\255\263\210K\361\022\217Ij\255\217b\353D\330\272\227\324\016\372F\353l\223\tqW-p\306\261\032lj-\032x\351\0078\372'B\022\250j\355\350Z\260b$\354$\240\324~\330\235\004_,\361\240Z\275\320\316j-\036\360\016\367\322E\334\227\234I\320B\262\330\203h\216umA\231Skq\307\364\"\363%\371!\363\345\362pI\2057Kr\251\320g@\343\310E\274\272\351C\034\032OQ\020\263hy\016\211q\222t\320$\211\217\227\235\256 j\221+f<\232\242 \016\351\336x\022\311\f9\\\304\030\247<\020j\255\246\\D\0277\317m\227\260]\355\362Eo+\006\215\230\224\335/\273\230E\337\024F\355\207\327\313>\251\227Nj\245\223:\351k7\322\275\334"
+	.string	"N\352\243\223\332\350\244.\322Q\023\345\250\207t\324BO\273\203Nj\240\253\335?>=\027\373u\246>\177\274s/\376\270?\371yNv\223K\2759j\212\243\276"
+	.string	"3\016\033\322\227ZY\274\335\251`\312+B\256\366\247\375^\376\265\377\370\223\335\264\357O9\233\325\301\370\307\266\343\327|/\377\262%\230%\370+O\363\325\336\305:+\301*A\252s\361\313\364\220\342\243Y\027$\262\243\307\025?\313\267X\247E\310\244\345\343\354\002\016\213\360\325E\375\t$;RT\240\362\253\334\212ug@\246\\F\364\273K\2646\206\f\364\\V\200c\270W\246\253\333\335]\333o\271\235\373M\320\265f\313\r\253\314\206\027\032\271_\266\201\346\2715T"
+	.string	"\031;\243E\3538is{.\2034\3037\344\362ln\217v\t.\272\214C0\244m\240e\370\246h\221\366\300\224!\330\321\026-\200M\2322\374Y\243=\332"
+	.string	"Z\206`\032\216\006\nW\353\227\321\376\313\007\250I\001v\243I\230\330\205&\320\026\355\331N\340xv\304\f\331\215\241\025Z\242\375\320H\026}s\320\016\355\323l\271amx\033\007\241-\257\240"
+	.string	"\355\317\006-%\263%#\313\351e\200\270Z\265\2006\307\366DI\030\026}\363\323\314\373\030\250"
+	.ascii	"m\265~5\371b\246z~\020\017\346\313\237}\227\323 N\350\204\211"
+	.ascii	"\321&\361\363I\365\244x|\177\3409\321''\332\201\327\373@V\365"
+	.ascii	"\200QQ>\263C\357\003\320*\204Y5e\345\203*yU\274\016\344\323\217"
+	.ascii	"\032\n\301\257\027\025e\365\344\344a\n\304o7\345\223\222\362"
+	.ascii	"A\355\246@\360\244vP?\340\016\001\223}!z\277]\225\317\367\333"
+	.ascii	"\351\212X_/"
+	.string	"\273$\327\344\222\353\343\363\025C8`\2606\013\210\271_~\331s8\216\270\221=;\242\b\025\352\013MrQ\360,\2717\236\002Iag\254\213\026\255C\326Zky.\271=\373\262\023\270:\216\231![\3327\023\266\355\\n\224\366\334\245=\234\341\215\233\231w7\023p\265\346h\362\333LQ(a\276TZ*2_c;g\0017$Q\340\245\b\337\276\331O#\f\025J\334\\mub\250a8\205\230!\304\031\032\021\021\242 i\341p\002\021B\253:\0210E\247\214\2064i\377\r\324r\005\351\203\351\352\211\027\204\232\021\336\335G\030\264\202E\340\027$\235\364}\336\272\007\225h7k\323p\020w>\007J\207\332\221\007\271\247${C\r\203a,{\265\270\243ym\027\017\001\206\204\007\340\024\246_\311\364D!P\356\357R#\200\225\260\321@\310\255\002W\371\365\375-\216,\256~\023\321S&\327\207\314"
+	.ascii	"\204\337a\365Z\t{\035\225\237\223\0032`!{\203\274F#~\230\367"
+	.ascii	"\311!I\r\016h\034\343\256A\207\037\004\211\243\370+\247\346h"
+	.ascii	"\301\357\350vvEWY\366\246\0131\205\327\027\202\372\371&\360\210"
+	.ascii	"\020\255\271^~\034\206\355\313b]\254\354d\222\361\037"
+	.text
+	.section	.gnu.lto_ringBufferPopN.15.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`\202\005u\""
+	.string	"J@\330\rF\200\232Nco\201\034\215\356d\001sA\355\3644\217\244\f:\311\025*\344\b\\\n\210\220\373\352\254f\307\270\032f\321:\027\024\035\204dO|\360\330\346y-\022\336\t4\234\343\257\273\273\2737\320\2336\331{K\231R\303"
+	.string	"\274"
+	.string	"\324"
+	.ascii	"7\225Nd\251\274A \254U\201\2006\275\354B\354\236\235nf{\304\222"
+	.ascii	"\343\336"
+	.string	"\373 v\317\311\356\335\254v\224\237t\3176Y\021\225\"\201&\307\314\264\334\2134p\323\016\320\372\037\305\322\346V\261\300Z`\305\236\254$\250\325~\217\373\210:\022\3527\367r\235\241\335\213<`\037z\323H\364:\276#\312\305\022\351\342x\216\005\261\002\002\346^\244O\350;\347\315\3629\347M\333\302f-\3764K[\213>\203\255\344\325Q\352'\315\321\230|\305:RU3\245a\342e\331\200G\216\027/{\315:V\225V,\251\346\212u4V\373\344\313\033ZqWG\023\257\273\007\367^\327\253c\211{w\333P\266\257mB\005b\265\316\302U\0213\263\266\313FR\325\017=i\203a\313e\247\325Ai5PZ\375s\267\333'\255\356\371\333\315\223V\357\330j\035^u\216\255\3069\333}\223V\333\274\355\256\241\231\271\330\337suz\265\233w\344\217\376\307\277;\331]\332j\313\253\256h\365\003\354\322\234"
+	.ascii	"8\273wD\035\231\333\304L\233\361\266\237\355\177\373\335~\265"
+	.ascii	"\237\354\247}\177\310\2354\275\211\353\0179\265\273\371og\222"
+	.ascii	"\344H\324\323\316\346\267}\211{E\242\316\242\224\256\304\217"
+	.ascii	"\"g\346\257\031)\376\226\270\0171\003\216H\232\177\344I\220\024"
+	.ascii	"\305\240]0\342%K\005%\377\354E\334C[\022\342\335\273\202\312"
+	.ascii	"\227\0044\336\251\267:\326Z\033C\206\372++Ha\264R\256\266g\255"
+	.ascii	"\255W\2146\252\275\025]jo\023\240`bE7U\206\202k\255\264]\266"
+	.ascii	"\227\316\324je\301\215M\251\252b\374cy6\265\f\334\214\\J\273"
+	.ascii	"\263<\373\265G\240\323\372b\374\362\261<\366\307\036\210b\344"
+	.ascii	"\322c}\306\340\030\213#\373z\361\264\261=\366N>@\r\r,\216l\253"
+	.ascii	"\306\356X\036\273Cb\374\322p*A\364\336\256\035{&\027p\205#L\216"
+	.ascii	"\305\261:\366F\033T\265\31676\307\376\212\025\335\324\206\313"
+	.ascii	"\021\341\330\0027ll\215\275\2615\212\325\t\252\337\245,\241\367"
+	.ascii	"V\331\330\t`azL\325:\237\315\300C\t\006\220\273\267k\310\207"
+	.ascii	"\023v\360c\334\364\217\316\2335\366K^c\200\205\365\b~\"\016\221"
+	.ascii	"\202H;\337\036~D\265\210\250~8\3721\225L\301%#"
+	.string	"\243\341\311!\230\2244L:\231\204MC\240\371c\372q(\213\210\325@\004\304\240\221QS\021Q\007\341\021\321'\034\"!\r\201>\341\321\017\311\007$.\371\020\by\230\024$\372\230\206C\242\257\207\234\362\272YZ\227\266\26444\317\262*\322d\312Ry\235\266\313/;/\205\216\267r\306\202\b\223Q\375\342YZ\254\235-\355\223\257^Y5\306\226TU1\345\275\367\232\251-\355\214}\331\007Ha\031\213#\333\n\262\\(X\271_\315\001\331\324\006\331w1n\t1\360s\024\320{U\f\371[\204\026\240\316\233@V\251L\230\237\3056\357\002j|\"p\323\311\267/\344irND\330\234\224\275\001`\250q8f\0241\204\241\032\221@\210\202$\205\003p\002\221Avs\0210I\211\214hA\322\376\033\324r\005\365\201q\220Usb\001F-\322\273s\374\200\025b\243\356i$'x\357\330j\017\347\336"
+	.string	"\207\241jH\361\037'\332z\ny\346#A\355Y\374\204\375\331\264Z\002B\270nr\335mT\302\341v\357#\250Q\034\022\021\177\030\270Zh0dW\300\256\354\250\335\341\366\320(\030x\001\241HM\254\330c\220/\210\314\330\252\no[\311\001\031e\301\024\237\304}w\265\037\300u"
+	.ascii	"\347\350{t\246MvxMgKj\341\347\3463G\022|\216.\312PT\240e2\035"
+	.ascii	"\253\331\2030\314\223\277B\020\223B\267\346 \244\3205$^~\026"
+	.ascii	"\210\025!5\035\217\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375 \305%\003"
+	.string	"\204\004\301"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177\r\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\013\177\016\f\177\017\r\177\020\016\177\021\252\333\3426\017\177\022\001\020\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\003\004\006\330\244\235\311\003\001\344\n\003\005\304\n"
+	.string	"\n"
+	.ascii	"\256\374\0243\255\230\306p\356\323I\234\210\221\r\276\001\276"
+	.ascii	"\001~\270\326\034\003"
+	.text
+	.section	.gnu.lto_.refs.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dc19b645cf330903,"e",@progbits
+	.string	"(\265/\375`.\r\025A"
+	.string	"*p\234\030CP\036R:\313\025\307\2207\260\030Ng\252\274\f\366\35503\\\203\021}<?\324\274\337\367\263Y\253\331\003\254\377\261|G+\370!\205\300C^@\240\337\n\224\275x=@"
+	.ascii	"I\006<\034I&\"v\313\024K\001s\001\206\001\027\272a\2640;u\335"
+	.ascii	"\355\331\354\027\252\3416\003\212\272\243l\322\237\3470\035\256"
+	.ascii	"\303j\334\362\032\247\235\341p\234+h\273\225\335\315h\316k,\207"
+	.ascii	"\3330\234\231\211\267\266\272n<\357\360\013\327\370\r\223\375"
+	.ascii	"\332-\335P\270\020t\315\225\365\345u\267\027.(\270pA\025\264"
+	.ascii	"\305L\033#\3651XV\240\202\375\211\">\204\266\314\256\372\021"
+	.ascii	",\257a6\334*\361\331\271\214\323\274H\331\366"
+	.string	"\264\033.\310_lz\230\330\263\322\032d\245\365\035\330\303\361\2015\002\037XU.\260\"\361\224\f\300\324\316\335\333U\177&\373\231\f\207\361\330oi\005m\263\3566\351\306\271Y%\257\312b\\\206\333\007|\346\034>\374w\034\353\260\3566(\200O\f\337\336U\217\201=\2339\201\261\376\360\313\236\037\254\334\307\017\326\267|`e\271\300\272\246\246\007\002\270\340\277A\366\3603\206\nko1\230\002\203\377\376\326\366\360\b0\0042\244\237\t\261\355\371\257\366\177\215\316\1779\026\216~v\373\271\301\317\300\237\371\377\336\177\275\377v\377\351\376\307\375w\373\177\366\337\316\377<\377\307\376\303\375\277\363\337\315\377\267\377md\377\r\374g\373\017\354\353\353\353\373/\205\237\301~\243\023\001oWe@\234\006\024\323\026\352\253\262\037&;\272\363J\324W}!F\373_\264\276a!:T\206\375\375\327F6\273\373\b\200\266\233\311\2433"
+	.string	"f\245_"
+	.string	"\377x\302\177\265\177O"
+	.ascii	"\326\275\344\356\216\355\202\206\314\272\352\377\b\3750\335\307"
+	.ascii	"\244n\273\271\234F\217K4y\234Imw%\350)\224^\266Q\247\n\355\333"
+	.ascii	"ms+\243N\036\313\026\332\\\266\320#R+\241\307\356\326\211\264"
+	.ascii	"4C\036y9\215:\227S\2503\251\225}\354)\262\213UB\235\3136\250"
+	.ascii	"\023i9E:\227\312\2503I\311]\0247D\264D\255\260s\251\354+\246"
+	.ascii	"\026\262\211\004\267l\241\355\247\233\315\252\2729\241[\013\332"
+	.ascii	"\364\203d\302o\222pW\3113$\224\333\356^\300LzA[\t\267\004\203"
+	.ascii	"v\203%\237\232\351\341\330\3025\025\206;B\321j\253\252n\006\335"
+	.ascii	"v3\273\217\334p\335}\354n`S\253\355"
+	.string	"v\202\264\2242\231\335O\005\314\326:\246Uu_3@o\234\313\251\027T\230V6\225\366\220\366\310\322\366\023m\262\323\343\231\266\352n&\304J\235H\354\256\332\032m9i\206\211\313\363+\"v\207\326\206\035aaY\201\222\215\265\353[\2256\267\253\266\006\236`\256\356\274\r\260\272RDH{GL\216\0337%\001z|\222a\332\330\3305+5m\256jG\001{|\023\210\255\330s\330\003J\377\345\372}r\024\306\220\230\034\274\017\314$G\370\330\377\277D~\231Dn\326/\356\250\217c\215%\202m\215+\257\227O\245\001F\004E\243$\371\315\372u\302\341\303\347\212R\312\312\256z\233\234\251\020*[2\271\317-rg|w\330\273$\303\326\241.DJ\214\276\362`\361r\325\313W[/\222\317]&\034/[W\275G.H\300\331\231/\255\353\374\275y\305%\257z\257.\026\267g\273\315\257\315g\033\034"
+	.string	"g\210\0326:\354\203\360\331\326k\344\327\n\016W\224\350\033\366\277E\376\"\340\032>YR6\354\357\364&o\362\0161\373I\343\264cU\277C\214\344\320\271\025\271\352\025r\225^\022%\272G\026\251\223qN\244Eizl\322n\377\036\177u\274\302\220\\\225\373XN\225Kd\307\307q|\360\316"
+	.string	"\335({{\254\227H*\240\375\203\007y\325_\347\335\035\353q7\273\237\"\300\374\324\261jqT\232yg=F\013@\245-\212\225\253r!\306[\233rx]x\206\214\310\310T\235\265[{Yl\323"
+	.string	"z\266\316\266\360\325\325\261\035{\354\376us\241I\371\214\0306w\203\316v*\235\2762B\344\212\304<\255\244t\354y\017\3639\367y\037\246\343g\377\344\314\256\306\344\365\363\251\004\f\233\222\214\316\235\351Nw\324\035\326\335\016dx\251\013sU\376\303r\254e\220\332!\271@\313*'V\354\030\345\315\255\tC(\252\251b\222T\323\223\223j$BAE\225@\032\002!\272x\322`\234Z\032\332\240\322\341T$.IMQ-!\320\241\203\252X\214*\002\2153\206@\210Sk\217(\251'cT\021x\243i\250C\375\261\303\tj\b\265\256\330\021\305b\305\323\024\025\213\340\320H\224\202Q\240\330\264\303E\216\341\220\005\001\343pj\330\"x'#\261\230b\300\235\210R\303\342\020\007{\017 2\200`\362\001<S\210\r!6\254g\n!\024\206"
+	.string	"!d\017B\3703\376)\302\243v\f\245\226\214QQRK\001t\020\233\214\352\324\f\022Gk\216\251&(\3258\203C\007\326F\323\360I5\316`2\026\211T\300\013\205%\"\274X\201\202u\322 5\274q\203\252\306\f\034E\242\324R1\n\n*\312i\251Hl\202Zr\222\232Z\322"
+	.string	"\341_\276\b\222\376\274\330_/\377\325r\245\027\214F\202\243=n\354\276\256z\271\334.\277`w\313\005\363"
+	.ascii	"\355F^\260 \242nd\220Y\002\263\004u\214\227\2265\253\372\037"
+	.ascii	"\027\313\304\007V \027X/\026\341o\226\027\350\340\025\223\262"
+	.ascii	"\254r\325\365Z\371\275\022\264[\322\225u\325K\345V\371\201\221"
+	.ascii	"\256\371\323~\216\256\213\034\2342W\275S\356W\360K\252&\316\005"
+	.ascii	"\275\256\031\314\003\313\003t\245\334,\340\025\231=)W\355\352"
+	.ascii	"\272P\212\002$\315\274~\241\364\211\272\251]\365FYNU\226\211"
+	.ascii	"%\3711\267\376\255\373$\305\261\373\3306\326\216\274!_\362\372"
+	.ascii	"\331\f\201\001\250\241,\205\0345\023\310\214\210H\222$\351Q\005"
+	.ascii	"\204(\306\341\331\001\022\300e\035\322\031\251F\206\024HA9)\264"
+	.ascii	"\033\211j\001\016C\304\207\246J\357\201\272)\334\206o\360\216"
+	.ascii	"_Kj\375\312\222\004\256\034V\306\326rj\007\235\216\320\025n>"
+	.ascii	"\n\037\337E%V\301&\367\316\250\256\267\225\340b\377J\313\240"
+	.ascii	"\256I:\004\002\255!\304?\310\"\244\025\030q\322y\007\212\030"
+	.ascii	"\020\234\300\307\007Eo\341\3458d\210\2463\007\307\250N\260\356"
+	.ascii	"\212a\022y\032\265\036r[)\346S\023\343\267\022*\002\367\204\341"
+	.ascii	"\273\003]Y\251N\214\226$E\"\357\313\210\234\020\310\013\376q"
+	.ascii	"DR/\233\371J\007I\035_#\374\244\226\274\033C.\314gh'\270G\357"
+	.ascii	"\340\373e\342-~}\271P\220\256\315\330\346%\262\020y\n\202\302"
+	.ascii	"\373\303_L\242\352\346\346&j\251\230 \367v.B\030\0070\313,@O"
+	.ascii	"\372\217\325r\263g\320\344\\\007\020\001\005_D\224qN2\323\314"
+	.ascii	"ed\323{\305\004Q\355F\231\200\257\324\227|)\352Y\275\274\023"
+	.ascii	"\031]K\270\026`\242$\372S\343U\303\344R\303\347J5\234c\002/)"
+	.ascii	"\2424\313@L\004\246Z\202\251i\335A\371\252\232\232\346\236\340"
+	.ascii	".\202X\214S\b\375\312%\016\215\007A\250{\357\204\260\345D\035"
+	.ascii	"\331\201\374\3577~ \221\013\013\027_\231F\203\215}t\232\323@"
+	.ascii	"\272\336\245\357\220\002\013\255P\321\275ke\343\"\202?@\373D"
+	.ascii	"\032\226!a%-#\300\252+'\2746"
+	.ascii	"|\334\336\312\333\315\2239ov\206\307\017\321\236\270-S\270'\217"
+	.ascii	"\352_\344\261r\ty\223\2353\352\256\340A\372I\271\005\022gl,\366"
+	.ascii	"$\337q\323\347+\2765{qs\270\2149\360\354\376\253\235\324\217"
+	.ascii	"a\270\016\027\357\307\215\355a\177!?\365\223~q\207xb\256\346"
+	.ascii	"x\251\272\370H\003"
+	.text
+	.section	.gnu.lto_.symtab.dc19b645cf330903,"e",@progbits
+	.string	"ringBufferInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"ringBufferReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"ringBufferPeekSpan"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"ringBufferWriteSpan"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"ringBufferPushN"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"ringBufferPopN"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dc19b645cf330903,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
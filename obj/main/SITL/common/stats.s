@@ -0,0 +1,546 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\275\006"
+	.string	"\224\006\352\001"
+	.string	"\t"
+	.string	"\301\232\252\247\r,\002"
+	.string	"\002\001\003\002\001\002\003\002\004\002\003\004\001\246\370\341\320\001<\001\004\221\336\365# \001\004\002\004\003\201\320\365\373\001\020\002\005\002\006\002"
+	.string	"\002\006\002\007"
+	.string	"\003\004\364\321\340%4\003\003\b\002\b\006\t\005\262\323\355\225\r\n\006\302\346\324\346\013\n\002\003\002\n\007\377\344\223\227\b\240\342\234\212\n"
+	.string	"7 \260\002\243\332\r\362\24203\346\333\002+\303\3167\220\b!\250,\200N\312\355\004^\263\276c\021\221\273\263a\025\202\246"
+	.ascii	"\351\255\307\225\231\311WE\206\r\301o\330\004\022\333@@G\263"
+	.ascii	"\204n\001\363\311<\331\b\004x\002\002p*\341x\270\360B-\260y\300"
+	.ascii	"\026\370(\310\260V\017\367{q\343\360\027\316\302?\300\254{\200"
+	.ascii	"\335T\360!"
+	.text
+	.section	.gnu.lto_.ipa_sra.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375 \274\225\002"
+	.string	"t\002\260"
+	.string	"\b"
+	.string	"\002"
+	.string	"\001\001\004"
+	.string	"\001\002\003"
+	.string	"\001\003\001\002\001\203\004"
+	.string	""
+	.string	""
+	.string	"\001\004\001\201\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004\003\006\007"
+	.string	"\022"
+	.ascii	"`\013\227E`\254(s,\355\205\022\226\217\340\206\255A\221\220\231"
+	.ascii	"\001\230\001\002\022U\204\242<\006\006\001\235\200L6\200\005"
+	.text
+	.section	.gnu.lto_.inline.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\360\003e\021"
+	.string	"\006\\T;0m\223t"
+	.string	"\366\304N:\311\200\215\326U\254\317\364\bUt\035<\313\321}r\320\270{P\354E\314\314\372\375\r\0058\3615R@\221\246yq\0014\315l\203\036\211\265O\266\334)A"
+	.string	"E"
+	.string	"G"
+	.string	"\311\211~\243\234\314\3340\0347:!3\337\220q\024\212$]6\313`'3%w]K33\357\336L?\2319yM?2\363"
+	.string	"\200[\241y x\353\375\270E\3575j\260#3\r`\314^\"\002\323k\275\3304\263\254\331L\243\225\247\302p_N9\220\236(_Jq\264\317 H&\204\326\376\250w\017\265\f\356\357((\352\346\240Q\001r\350@\021a\300Hq\226Gf\"\250\350\0325M\221\231\005Z\377\013\031\002.\273\274\314r\tj\242\362\200 \3604&\272\323\265\034\342\245`\232\231\034\3207xi\r(q\326\2132P\303M\272\340\356\002M\272\231\225\370 \221\341\nc\375\272J\347\276\322\301\331GKZ\242\320\303\207\220\021\353\025_\244\344\307\364\023y\302\245\336\035)dC_\372\301?@\357n\244\0329r\245s\r\245\327$\322\3337\374\266\362J\026\356u\371Z\253\335\250>\350\3609qq\333m\230J\240\300\ta\221\301\020O\345\021c\250\001A\246P\211\220\210\302\302$\031\306p\002\241\032\232\365\022"
+	.string	"\206%\353\245\022!Ee\024\024\024\352\347p\"\311t\321:\017\206\341\017z\245\302\213\300\207\022|\340\374\016c\032\221\276\204\274\271\316?\233b\377.j\231\350\352G\\\306=\362\006\352\200\316\223\236( \rs\362\177\212e\b\367\371\264\017\201\304\310dXaE\303>\373\211\201\f\234\017\361\033h\310\235M\206-0\361\2052\020F\230\223Z\270\224\237q5\246\342 \201\035\334\310L\245\350\234@\350\257\2002u\356\327pi\350\020\024\366N4\335\270l\033g,\221A\244\375\304\013\267.\314\301\177\0317\213\252a\322\b"
+	.ascii	"\023\301\rGe`\364\334T\236\272gd\3459E\321.\001\331\f\203fM*"
+	.ascii	"1\326\230\023\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\003\001\235\006"
+	.ascii	"r\t\036&\220'I\007\210\271x\235\345\214\364vww!n\00533\262\016"
+	.ascii	"\275\225\022\354\312}\266=\333\330A\354\266\204\310$\003d \f"
+	.ascii	"\351%\312C?\264\221\313\006)-\037\274:I\030{\306:\257G%k\317"
+	.ascii	"\020\33146\200\025 #X\t\207\262\030\002\326\202M\004\353\002"
+	.ascii	"\253a\340\222W\2448R\223\347\2205z\212\336\242g\347P\376\323"
+	.ascii	"\243\327\336\353\037\335\336=\344\313\304\025\002& P\002A*\325"
+	.ascii	"\003(\302Zc\327.\323\030\266V\313\315y\221\207\331\334j\013\230"
+	.ascii	"\r\324w\272\226\033\275U\327\003\302\034\373XIkA\311\001 \326"
+	.ascii	"w\272\271\273\203#\005$\fK.\323\357\303\267B\204\3130t\301\200"
+	.ascii	",~\202V\027(\021g\\p\225$\321\301\212;\004"
+	.text
+	.section	.gnu.lto_.pureconst.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\205\004\007\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`#\001\025\007"
+	.ascii	"r\313\036!\240%I\007\377\3476\327\361\037\335P\361\352W\235\337"
+	.ascii	"\004\030o\276\375\326}\312G\b\333H#D\312\024\027\030\034\020"
+	.ascii	"\030/\216\177k2/\214\212\371\300q\345j\240\231\252\320)y&\312"
+	.ascii	"\023\235\207\353\221\233[\231\361i)\006\341\022\020\372\354\373"
+	.ascii	">\223\004Z\305t7\324l\200\226O\031?\345W!d\221\316\021\275\263"
+	.ascii	"\237*\234O^\255\302\354\320\252\347\334\320\216h\377S\275\260"
+	.ascii	"\371\006\004* P\0021\312\331\035t\002\201V\027\001!\201\363\202"
+	.ascii	"\020\212x`\301&7\367\335\343Y\2548\017\260\025\270\200\3718)"
+	.ascii	"BH\210\370\253 \016\002\200-\0168\275A\310i#\034\271\342\020"
+	.ascii	"k\004\2006\314x\232\267\305\300f\311\"0I\254u\020u\260\364\202"
+	.ascii	"js\232t\245\203jf\001\211%s\360\272;\006\007\007"
+	.text
+	.section	.gnu.lto_.lto.84a1c7d5acaa498f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsMomentsAdd.7.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`e\006\215!"
+	.string	"V\274\314I\260TN:z\023\276\016\264JRgi\334{t\336\301\360l\361\231E\205'B&\375\260\256PNW\260\\\253\225\357\030T\320\306\342\356\374\263\263\263G\377\275\365\267\207Lu\002|\340\207Z\034\3305\207\365o\264\033!r\247\024\270"
+	.string	"\242"
+	.string	"\276"
+	.ascii	"\366w\370<L\363\362\227X\267(\3308b\201\374\370g\235\353]\246"
+	.ascii	"\351P\0020\253\2657d\252\002\231\343Z\274o)\211uK\254\"\022\001"
+	.ascii	"\311\313q\374\212w,\020b\335\372\224\320\310\224Z\353\201\217"
+	.ascii	"^@~\004 N`\210\034\231\312t\325\244\340\323\276\215\337\340\335"
+	.ascii	"J\304gj\205*\322\243V\340\220\013\220\037\r\274\215\354#\371"
+	.ascii	"\032\331G\363\354(\007JU\bAHda\251\265\336\266\205\367\"\360"
+	.ascii	"\026'\357\243\270\223\347w}\242\320\3729-}\024ej\2555\247\021"
+	.ascii	"b\202&'\337\024e\234\370\236\307\347\327\360\347t\342\223N\250"
+	.ascii	"\265z\376\234L\334\262\333F\262\215\301\226\245\b\277\260\177"
+	.ascii	"\203\354;\367c\345\223\317F\367\261\201\254\2656\360{\360j\344"
+	.ascii	"\310\027\037}\021\262\217\337\036\030bV\2759\264\201Ks\243\354"
+	.ascii	"\277\326Z\275P\366\355\300\337\300\261\356\240[\375\001\356u"
+	.ascii	"\003\321\351\037:\355C\247{\3504\017\235\336\241\323:t:\207N"
+	.ascii	"\343\320\351\033:mC\247mt\272\206N\323\320\351\031:-C\247c\350"
+	.ascii	"t\215N\303\320\351\027:M\243\323.tzF\247\3119M\311i\0319=\322"
+	.ascii	"iQ6\275\343\364\034\247\237 \246\264\t\326Zb\250\245\"\031\205"
+	.ascii	"1\356\365c\375[\277\216\213\366\003@{\333\331\222\341\3146a\""
+	.ascii	"\2631;\263[\244|\362\271\254\314\216_%\225\022\007opOb\213Y!"
+	.ascii	"\032b\302\032\227\2036'\233\365\013\203\331\332\212_\345\224"
+	.ascii	"\017fi\025\220\246\025/{\304A\034#6\332\316\366e\027J\371\024"
+	.ascii	"\264.K[Z\216`I\345\262]\016\306L(\277\260\331\222\353\262;VN"
+	.ascii	"\371\346p\302\2118x\223\252\265>\2605|\210\322G\241\331\336\\"
+	.ascii	"\b{\017\322\001\004\351\207\3307\255\220\255\201\245\373r\206"
+	.ascii	"x\023\221\215+\333\227T@;\356y\234@\251\265[k]Z\213\353\340="
+	.ascii	"\231j\355\t\b\332\351U\016\361\315\241w\305\025\275\312)\273"
+	.ascii	"\264\250+$\266\314\375Q\223z;\243\017D\342\250\204\273@\224\304"
+	.ascii	"\001\227\201\274\200\333!\341<\034\031\221\037\276K:\302\345"
+	.ascii	"t9\352\"\004\273$\242\244\335\355H\227\313\351\212nGFD\271[\021"
+	.ascii	"\322\356\206`\307\272\0168\244[\222N\207t\243\001\353_\027\312"
+	.ascii	"#\025$\275\365m)\211\265\262\220p\035\377\024\034s\350\237\335"
+	.ascii	"2\346\263<\373\323\2639\3533\324\223E\214g\035\b\331\331+Vt\026"
+	.ascii	"gwr\266fu^\205\274\277d\037s\226\301\023a/\214\n\316:Pq\263R"
+	.ascii	"\242\324l\226fol[\2636+\216q\331\226\001Y\263\003\236\b\301\034"
+	.ascii	"\264\025\375I\215f\337\365)U%&\0347\3123\260\275\355\202\315"
+	.ascii	"\003\007\332\246\241\003\355\255\\\2011\315,\027E\241\007z\250"
+	.ascii	"Q<\206\230Cdhd&Q\220$\031\016\220\002\021\2522n\021 5TN\215\224"
+	.ascii	"\246\036\333\001\004\257N\267\244\344\226Q\237\224\342\373\\"
+	.ascii	"M\002E4x*U\313J52\274\320\227\377H\351\332q\212\002u\243H\323"
+	.ascii	"d\001F\267\300\030\n\261\337}\223\035\357\t\277$\340\217\216"
+	.ascii	"/V\360*\263I\267j\377\207Y\033\206\230{\331J!}\247\364\264\313"
+	.ascii	"2*\035Ap\016B\367'Xj!\036B8\301\342s@i\220\227V\277J\r\017EO"
+	.ascii	"\026)Lh\211\235\264w\363\364\221\025\243\024\003I\214\377\350"
+	.ascii	"\344\335\021\210j5Cb\267\323b\b!\034\2264]\2537\316\bG\313O\211"
+	.ascii	"\223\246\301@\236\030\037,\032\203g*\274);\327\221\t=\013\022"
+	.ascii	"\303\277\257]\203\332\315\351x6Mp3\211\335y{p\21237\360]<\363"
+	.ascii	"\300t\330\006\330\017\fpxqK\352\n\273o\357\351\216G\251"
+	.text
+	.section	.gnu.lto_statsMomentsSlide.8.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\021\b\025'"
+	.string	"\372E\234\016G\220\234M:\004T\257\026s\210b\021`\377\203\211RP\002\257\314mE;\340,\220\337U\354\341\3406l7c9\253\330/8n\337\263\357\356N\222\230b\262/\266[\\z\036\243xxh\030=\253c\223F\bI;\311\332"
+	.string	"\270"
+	.string	"\335"
+	.ascii	"\\v\227w\375\265\256\262\264\335\245\262V\312\037\215\322\311"
+	.ascii	"\222\030 J\217\266\024o\371\264\327\322\272z\267Y\255Q\303\017"
+	.ascii	"\\/:L\351\335X\324j\335\001\003k\203\237\030\212\317Qz\345\217"
+	.ascii	"\206\206.A3\265\326$\217[!,\207\211\265|n\262\247X\253R\300#"
+	.ascii	"]\265V\334B(=\336D\367\220J\200<\240B\025\266Ze\261D\206\003"
+	.ascii	"\323]\027\261\021\237\217\2540O\255V[\272j\025\342\366\250\364"
+	.ascii	"\270B\377\220\036K\367\220\036\327\267K\306\302\253:\301\215"
+	.ascii	"\013\2555\265\326\334{\354-\n\275\"\365y\024O}k\331\005/\023"
+	.ascii	"U\r\203S?\217b\255\326\2523\325Bl@\245\246\200T\024b\303w\025"
+	.ascii	"#Q}\tN\3310\225]\250\265.\rN\325\360\222\336]\247\335\025\261"
+	.ascii	"[\346\002CD\257\026\322\247\267\231\005\244\303\305\335w\025"
+	.ascii	"\213cTe\\\274\211"
+	.string	"\242\303\277\326\372\373y\354\n\177\324\365V\273\030\334\304\246`%\366\004\013m\t>b70\025/\356t\225N7\351t\221N\367\350t\027\234\256\202\3235:\335\242\323Mp\272\bN\227\350t\017\234\356\355t\r\234n\201\323%p\272\003NW\300\351\016\235\256\320\351\332N7\350t\201N\367\347t}N\267\347t\003\234.\317\351\326Nw\347tuN\027\300\351\346\234.\355tqNwv\272%\245+;]\362t\307\323\025)\335\217t\351H\327\031\036\244\tRS\353\214a\233\0326~\0051\025;\212=\305\0163\261c\370\305h\222q\227\302\031w\247Y\"\306\202\262\261Xk\255\342*\031w\f7\016\252/?\027#\346s\236\377\374`f\216\236\007\270\317ecL,\340\354=\027\"\037\340#\230\231\005fO &\177\341\371\230d\213\310WM\312\316k\027\301v\016UuJ\335\320\331\332\363\347\352[\3011"
+	.ascii	"\327\271\bfb\001\001\034\252\312\211\324\215\234s\3313\350*\314"
+	.ascii	"\347\312\3011\332\307\347\374c\314\034\024\216s\332I/fVy\361"
+	.ascii	"8w\026\325\320\304\232\235\345g&xe9\341\262;Q\2511\207\220\367"
+	.ascii	"\332s\207\242\t\216\215\027O^\3242\261\200the-{\346$\354\356"
+	.ascii	"\234\245W\326Z#`\361\3458\241\004f\005\351q|.\314\327\372\n\024"
+	.ascii	"\257\374\261VAZ\352F\024\035.\275\204\3776\003\274\021PK\242"
+	.ascii	"\207\017dO\307\301CO\307\341\303\322S\t\235\210\031\007\035\317"
+	.ascii	"I\207\242iD\231\302P\346=5\351\230vL\262\r\301\200\367\264\364"
+	.ascii	"\304\3135\355\230\230v!rM#\226\230r!\234x9\006C\2733\241s\312"
+	.ascii	"=\355vN9\232\260\332\365V\253\001IX\324\201Q\246p\365\304ZuX"
+	.ascii	"p\227mF\t\035\256\322M\332\"\351FWB\372\202'\035\235\350H\267"
+	.string	"\341\216\024\374\366\0058\005\364G\253\321}V\025\375\215\233\0047\360\"\004?\360\004D\037:\202\333\300\210n\017\372\201\217ZfSz\255\220\036ok\324\030\270\271\260\0248\2323:\004\016\364\002\003.t\002'\335\230X\002>\364\001\267\201I\021p\237>\316\241[\bc{\320\205>jm\331\016!L\031t#\037d\366\364!\3411:@\267\227\213~\\\343yl\200\237\250\201De\224CCB2J\222\244\220\341\260\002\021\032\272y\0210\255d\252fFT\310\306v\312=\205F;\035\361*+\031\366\227|\032\317\212*C\220\374\\,\2104+$>E\230\2323\273\345\321\324\321F\256t\376\250\330\351\360\266\250\374\323\255\001\002\313\360\2110v\rc\334I\026\270\207\352\261\262\313\237\024\334I\333\243h\234K\213\237\236\022y\223\0320~\365\031Ae`\366i\207\321!\\\020t\033\271\037\263\273\317\212\235m\\"
+	.ascii	"\202\007\306\277\273\201\204\310\326\016\334\0347\221\350(b\252"
+	.ascii	"\266~\346\207\265\207NUZ\204\003\302\261\2166\2005\264\326\306"
+	.ascii	"\304<\300\177\353\002\231\331C\255\003O\202Bb\347M\243\322m\210"
+	.ascii	"\244+\325jB\301\256\226\270\365<\315\026\207h\353\274h\204\245"
+	.ascii	"\272\373\037\301o9D\236\200Y\271\354}J\320D\245W\331m\242l\324"
+	.ascii	"g6\005\262\002\273iY\364\235\371*\217R\200\314B\024\206\261k"
+	.ascii	"\2041\303\207\3148\215DEb\205W\237i\354O\210\260e;y\032s\357"
+	.ascii	"\256\233@?\016\240_\311\230zD\217Zmz\204O\251;\235\240\002"
+	.text
+	.section	.gnu.lto_statsMomentsDecay.9.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\353\005\255\037"
+	.string	"\226\271\301I\240VN:\304P \252\023V\360@\315\260\336(\013Q\237\356\007O\340\216\353\207\236\323\033\214\307\371\205\245Z\373\212\214\261\275Id\357\210&\307\313\361r^\020\245\202\215\334\362\2057R\324\313\226O\375\206q\307\023K\bI[\246\263"
+	.string	"\223"
+	.string	"\264"
+	.string	"YX\346Q\0361\225US0\030\224;\356^Y\346\265\261U\277\265**\217\230\036\024Q\001Vk\035\260\243\027p\265\320\330\251\337\326\360)\322\352\022\320)G\2555\347\003\345\2168\221\n1\330h5i\212\203\201\245\366\312\330\031\277\225\312\2600\265>m\345\250U\230sO\271\243\205;C\356X\256\f\271\243\177\366\222\025\242\250\261\022)6PA\251\265\352~\302_Q\270\026\351oG\361\364\347\2155\270Z"
+	.ascii	"\"\252\224\202G;\212\264Z\353,\250A,@\227\202@*\266\370\260\337"
+	.ascii	"\254\025\320T\245\024\374\2604\326\240\326j\252\024\364\260&"
+	.ascii	"\327\366\220m\0076) =\377\327t!\256\201\220{\3725\243\200th\334"
+	.ascii	"\367\233\265\"X\323\271\241\n\022"
+	.string	"\035\376\265\326\243\337\204-<\242[\377d\347V\270\333\263R\273\001\266\306.\317b\255q\247\3369\265\316\251sN\215s\352\233S\337Nmsj\333\251kNMs\352\231S\327N-s\352\230S\303\234\232v\352\227S\317N\355r\352\226S\313N\315r\352\225S\227\247\216\235\232<\365xj\221R\177\244\246#\365\372\304\230\206\334\276j\3550\234R\271F\255\025\213\265ke\357\roC^f\337\253\035A4}\2157\341\225\256\347\376.:`q_\312-\356\373d\252+\211JYQ4\201\305=We:\271\\\210O\232 \265\007Q\nk\371\312]>\0321\243dgy\313m8L' y\331oT\314( >\177x\373#\001\313\177\240\264\220|\256iR\255H<+_\020M[&\213\362>|\326\364\250m\354\343\313\337\313t\3429\371\330WD\223\0173\212\374\225\317\027\352\245\0246^<\371S1Y"
+	.string	"\351Pjw\370\324)\260{\253UT\326Z\021\350\370\275\270@"
+	.ascii	"E\006r\307\361:(-\357i\344+Sx1\220\273\024\002\211\016M\037\276"
+	.ascii	"\tF;qGT!(\302\270\223`\241\302n4Z\037\221P\020\257\307\213\031"
+	.ascii	"\310\307G\264#\362\351\204z<^\017H'4a\307\323\001\r\371t>7\367"
+	.ascii	",\004\r\351\210z\275!\235LXw\353\237\f!\310\205t\240\213\304"
+	.ascii	"ZI0X\253]0\032t\350\235;i\242\363\331wr~s\035\234\327<'\3468"
+	.ascii	"\267\361\ncr\023\345\366\257%6\237\375f;\315mj\016s\333o\250"
+	.ascii	"V\t]\363 w\254\351\362\371\223$\001\315_Fl\305\2309\022\237\265"
+	.ascii	"#"
+	.string	"\263\332g\237\221\371\313k\267y\231N1\207\271\314o\250r1\337\255$\264\303\334\306\313\214\002^\371,i\337\036PZD(ls\250a<\205 c\204fd\024$),\264\006\240\002\221\232\262:\021P5$&',0\324\332:#\254\b\271\303S\341\302\nU\035\271%JH\334z\276D\321\343\265T\033\367OAKm\t5\344\265\347h\n\265\022\261\340\324\0305\265\253\203s\3246o\237j\332\237\266K1\377P\240\305\265B\333\033\257f#\0218,\201\337\020L\240\267\0210\201\024\001\023J\373m@\351>\024\n\r\372\256-\246\240\251\320\231\321c\2235\3536\374zHm\3378\317\340\2613\255\013 )FL\272\273\350`\246\261\2122\017Jo\361\226\027\322\230\236P?g\327\276\232\266\n\371\355\202\240\031\376\001\3231\366\207g\305t\256\212)\331\342vs\333Jt\305<\214\026P{A\371\352e\254"
+	.string	"\230\007\257"
+	.ascii	"P+2o\ra'+x\213z\205\356(\342\017"
+	.text
+	.section	.gnu.lto_streamStatsInit.10.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\373\004E\036"
+	.string	"v7\275H\240\330M:\207\320\021\377A\357P9\320G\346a\345\270\343\2436\251\236D9\361\313\330W\353\327\243@R\377\276\205\277\036\325\246\302\242\317\216\321\256-\214\013\327I\223b\360\362\001\323\227\322\271H\361\334\334\255\021B\366\2262\311\250"
+	.string	"\235"
+	.string	"\247"
+	.string	"\337=\223\335\331g\273K\227\254VN\255\372\234\202D\230H\236dw%E\\\253\276^\322\003\362\264\306,\274\221\335\217\030m\254V\033fp\344\351\201y\336\375\220\023\331\275\t\305ojU\212\242\252U\310\263\n\310\323\025\036G<%\037@<\335\335n\230\013\227\352\235\244\220\222\230\251\265\342:\307w\037E:\233w{\236Q\346\007\344}\224\001_\\\2348Y7\300\324"
+	.ascii	"\221\346\202`\225\0263`\311\324\300\227y\250\317\037\301\251"
+	.ascii	"\037\320\305\333\327\023q\230\254t\310\200)\232G\t\265\326\345"
+	.ascii	"\037\220\305\227\374\356\236\330\335\n\273\224'\247@F\006\026"
+	.ascii	"\2440[\357\376\234\312\210\254\265B\330Oi\020A[\332\201B<\245"
+	.ascii	"@\255 1\216x\2703\336,_*\"\203\213\275;\"\307\377\355\241.{\362"
+	.ascii	"\201U6o"
+	.string	"\305\007\020\005\264\330\313%\220\036\017w\205<n\034\273\357\341p\350\265\255\264K\362\356|\311\2573yoW\362\347\374\310o{\323/\200\344\275!yk$\257\315\344\255\231\2744\222\227f\362\316D^\331\310\033\033y\311\311;\236W\034y\351\310;'o\213\274<y\237`\374\312*0\2545i\370U\261h\023\036\273\0334\356\372qi)\"e=V\201y59\371g\255\265\322\030\223\035\033\233\034\267px\226\016YU]R\316OVs\306\264\031\\\347@\331\274\235\263i?\252{\366\221\302x~\353\356S\005\237\312\037:\275\353\341VVj\300\322~x\225\236S\233\021(\306+\306\255>\016\301\3421\330\231\254\230\240\364\224\375\325\275\364\2504\240\354\243l\030\262V\336\203{#\361t\371W{Wz\324\272\373'\373 \271TWTaUpjk~\022\202\345\343\260\345\336\365y\223\242\377\270n\315}\250\003"
+	.string	"k\360\367\255_\222\311\351\367\231\004!JL\210\375\234"
+	.ascii	"\302`B\007\"\b\310\204\354\007\204.7\351\3728\030\"\352!\032"
+	.ascii	"\302\005\351r9\235\017.\b\250'\207\363\021\032\3029 \260:\022"
+	.ascii	"?B8\"\235N\b7\023\326\317\332J\313\264\277\212H\211;}\323*(\200"
+	.ascii	"a\035uok\275k\341[V"
+	.string	"?.\233Y\353\227W5m\323\035Un\321\272\246iW\031\354\321\372,f\210A\n\273\351\335\013\327\332)[\027\030G<\234#M\357\324\227}\265\036!\330\351\021\254\274\3525M\347t\225[\262\236\365M\353+\344\235\253\272\262j\210\215c\371F\242\255wIc\234\274\370\370\314\312z\027\303\273\024\341p\311p.\033\002^\250A@\204\020D\310\230\210\314\004I\222\2441\240\002\221\241\262n\021\2209dC\024\024\244\222\326m\222@\377\271F\262\210e\t\013|\342\356K(`\271\005\223\360\0074\t\277\355\344u\f]\002n3h\350-\256)\007\200\007\340%\235\\\332`\037\226\214\357Ryo\232\344\222\256\347\225\335&\n\3658\200`\264\203\032ZY\223\242\371\230@\020\367\212\212\bO\231 R\341\370\031\357\023\274\032\303w\207\007\035\357%\266\323\007q\375J\210w\316l\217\277?+\342%tQ\024\2336\2204"
+	.ascii	"\260>I\376\245\237AH\373\246\266\340\256\366\235\032T\206}S\312"
+	.ascii	"\237\275'9\303\244/b\036\204q\276\226&\376\207\217\0029\376\316"
+	.ascii	"\271\215\310\327\231q\n:\310P\001"
+	.text
+	.section	.gnu.lto_streamStatsPush.11.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`0\013\2457"
+	.ascii	"\252`\274\024@P\246J:\257\256H]\232\273_\247\331\330[G\305*\\"
+	.ascii	"\r\235\371Z\371\342v\237\177\333\332\234q\263\301\233\027\f\337"
+	.ascii	"\232KD7\300\354\355\325\2378\364\202Gc\326\003\265FZ#\215\020"
+	.ascii	"\"w\222\0016\001!\001?\001\207s;b\257\303Vo\007\344\323\3415"
+	.ascii	"\316\345 ?\007\207z\375\324#\201pL\016\352\321%\373\246\364\257"
+	.ascii	"\314-J\0271\346\263\341\273\341\325\217\001\245\312\354n\032"
+	.ascii	"\n8;:\fm\316\307\274\262\216\263a\002J\300\260\321\335{W\035"
+	.ascii	"\314\353\321>\232\253\371\036\257kvH\225-\335\353\266\354rA\315"
+	.ascii	"\273\036\362iv\250I\264\016\201E\230\367\242Y\330c\374\335\361"
+	.ascii	"\220?\323CM\242\251z\201F\230\367\336\255\243\334\245\036\225"
+	.ascii	":\255\335\217F\\\267\314\247{\031\344\353\200\234\351\336*|~"
+	.ascii	"\367\3321\340,\365(\333\375)=\252\276)=\312\214d\036\274\335"
+	.ascii	"\333}\340\22034\214\356\275\\}\345\344\376iwN\033\371\265HT\207"
+	.ascii	")z\266\361h\221\374\344\327\275\027\207\032\370\3564\207n\256"
+	.ascii	"M\255\311\211\247\026\323\215\242\367Akr>!\331\262\374\336\247"
+	.ascii	"\344\320\230Xu\252M\315\311\207\177Bl\352E\311"
+	.string	"\321s\251\017\332\332\351\340\336{7\267E\322\310\354Y\364\222\344\355tc\200\037\241\274\r\355I\372\024\007\210\245\230v\326v\250\341\336\313v\231\246vN:\363\223\230\031\006sQ.\026\022\377?\266[ \276 \017\332\276\265\377\341\007\362\240\023\035\333\223\247H\217\332\345\315\352\303\314\203\366\316\332\275\311\263\251$n\034#:1W\312\315Z\245\224\331H\314|\342{Rt\243mz\fn\033B\037\222\231\034\231m\362\333\366\317\"\261\212\347\361R\357\275\023\370x\220OV\250Y\200\244G\337\337\373\325\233\274\271:\245m2\333\221\331vc\276m6\233\216\270\2530_\250\3609\347\b\267\373\273~\346\f\341u\377\203\3039k\335\357\234\245Z\306R-_\251\226\255\230,W1Y\2462ZV\300d9\201\321\362\024\321\262\024\3212\002\243\345(\243e\250%\313\007\224,\033X-\027X-\023 Z\036\240dY\200\321r"
+	.string	"\243\345'\242e\247$\313MF\313"
+	.string	"\214\226\231\254\345\245\325\262\322j9\311h\371x\264l\\-\257\253\345\"\3212\361hY5Z\036Z\313\351j\031]-\237E\313M\264lU\313\377\340\305dt\b\253\357^$\315Gw\017\372\206\313\347\374p~\277\377\314\237\346_\363\224\371\034x\201\362\330\250\336\216\3128skQj\240:\352@C\365\020\320\214i\223\0376|\245G\017\024h\001m\300\022\350\002\215\002\016h\002Z=\240S@\016\217\364\005I@\023\357"
+	.string	"\013\003\304eh6\037=u\200\b\375\324\303>\200d\201\362\230R\035\341J\356\017/\220^\220{\021\264T\2635S\324l\236\001S\247F\320\267\363s\f\226=_\256\344!jj\247>\003\317\"AY"
+	.ascii	"\315\354\001D\372eSK\225u\222\271\357\227Y-\273W\251\200\251"
+	.ascii	"\001\310\221\265(\301\244\324]\275\224\324JZ\235\324\247s\224"
+	.ascii	"\031\207\266\033\257q}\241\3218\343\326\263\272\b\203g\025\255"
+	.ascii	"\340\r*\263\215\370\347\271\340Y}\241\017\006N\317\214\215L\f"
+	.ascii	"\234\236%\341Q\315!\031\334\307|\351\321\343\332j\033/\350\305"
+	.ascii	"^\373LD\354\"\204\316jb\243\211\314\330\310B\334\020\363Y\275"
+	.ascii	"1\213\370\340\210\243Qoj\023\357\332\314\325\r;\313\367\270O"
+	.ascii	"\351\355\336[\301\026Z\022\236P\216\022\374\037\351\321a\277"
+	.ascii	"H\023\245m2\332]\235\366\315\300\234g;\351\331h?\253\317\276"
+	.ascii	"\233\237\210\340\372\272\357\275\311\366\363\033\333\r\320YC"
+	.ascii	"2<\243\201\330\214\261/\260\0305n\200}\211\245b4x|\235<\336\343"
+	.ascii	"c1\304d\310\bK}\364\340\321(\277h 6\3665&\306e#\f\f,\354\005"
+	.ascii	"\227\r\032_`\\/r\210q5(\300a7b\344\340\032\013\013\313\301\265"
+	.ascii	"\332)\337\267\253\260\006e\223\275\32731\357\212\020,\326\326"
+	.ascii	"\253\232\317\207\204\202\214r\276\243pR\n"
+	.string	"\231f\235\3447\004V\220e\206J@su^)\025%\2240P\f\"\245m\362_\0311o\304vc\254\276j\027xz\312l\243)v\nV\017\t\377\024^u\024/\365\370%\341\275R\253\276j\253\302>\361\262\352n\3733\327\300ZU\271!\257\bYca\341\354\022\250\252.bY\264T\242\264\n\372l\256\006\251\205\201\340\331|\017\251e\301\033\025\027\244\22735\0266-\212\352\213E\302}VP\202\2026\221\307\252iN\334q\336\333\226\341kn\3610a\336\331&W\331\251\356\352\004\315\214\f\203\234\263_\262\224\231]\2620\n.\231\221d,\021d\031*\301\004\375\245\022\245m\232\261g\334g\024\2440\325\255v\247\260N\311\347\337;\n@f!3i!\361\207h\205F\343\216[\327\322\352\377\245Z]\241\377\367\255\266\276\200\333\250a4%\221R\206fFDZX\220\264\006\200\002\221)*\363\022"
+	.string	"\305AF\222\221\210\214$\251\324\330\347\177a\nb*O$N]\f\254\303&\307\201\254\360\232i\b38\3367OSEbl\027\031s0\026\024\324>E\2634\2652\031\277\364r&\310GH"
+	.ascii	"\r\272tXK\323\202\t^u\317\232\310\311\344B}\214\374e5Sd{\225"
+	.ascii	"\360\366_/\b{\206Q\211^q\303\321\207\272\026\b\007DG\333\023"
+	.ascii	"q\3243A\307#\032\205\374\201\363\220\356 \357Q2\337\205lI\022"
+	.ascii	"%\rMq\323\344\324\r\343vw\347W9\313\351\231\304\264x\3173p4\230"
+	.ascii	"\n?\220/\276\263\324?\272\036'I'\371\374\005d\240\bCT\242a\022"
+	.ascii	"\351\217\301\234\201=\226 \n\221\375\216\241\353 .\343\257Y."
+	.ascii	"\240y\222G\276\\\334\205\230\211\204\212\260w\276\265\365\324"
+	.ascii	"\023\366<\031\370O\261\351$T\230v\3164\013\353\344\235\202\253"
+	.ascii	"\223Y\327\331\344\301S3\205\307\013m\n\332\\\254\317yC\242\307"
+	.ascii	"PZ\320\370\016\335(L\214G\201\226\026\257\220\345\bTc\201\323"
+	.ascii	"\230Rp\354\357\305b\302\373B\332h\2159\304{\220O\324\217\207"
+	.ascii	"F\206Cgb\313\225\343)\347NZ\021\300\r&\310\207\254%\2654\216"
+	.ascii	"?\031a\272a\315\277TLk\021\343\225!j\006L\226\222\347\341\f\220"
+	.ascii	"X\377I\2129D\036_\360\317\007\204\006\272\327q\317\354\036\324"
+	.ascii	"%7\324A\210\373\223\200\276\257t\3013\230\031\330y\031\340;`"
+	.ascii	"\245\334^\303\b\n\013P\tz%\376\334\235\245E\236\342\225F?\016"
+	.ascii	"b\211\205\305g\300\247\017\004\203U\254\006"
+	.text
+	.section	.gnu.lto_streamStatsMean.12.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\305\t"
+	.string	"V\222A80\257\322\001'\036\240\241\001\237#\177\377\255\373;\350-<Q*\322\203E\267\322\373\177\254\022\367\245jR\3244.\f\fr\251\346\274=!+\303\234\026\200\321\243\275\367N)1"
+	.string	"-"
+	.string	"4"
+	.string	"%\262\272^oA\241\210\275\354.\355| \363)\037\220\371\214\031\377\016?\377!\2271\032*+\026\352\020\200aw\rW,\213;\336\366\201\355\004\373\234s\266a\373\2637\266!<\314&\326\354^\270\310v\327czh\377\343 \337\353\351\234\335V\212l\267z\214\260}\272n\266\375\216{|v\013v\367\221\207\002\227w\021\210mW\245\020\223\210\020\240\275NQ3K\301\232]Q0b\330\227\033[v\204\226\207\375\361\365\207s\303\301\3429\331\255\250\301\354J\236\310\004\222\323\241\217W\002\225<:\3528\256\013\321\221\b\304\321\020\311\243\037\002w\016\r$Z\352:\022\335\324\275\334\330\222\261\223\212\023\266m:\tg@\333U\005\022"
+	.ascii	"`\221\"\023o\300\321h\211\204\211\205{!c\342U?d\216\2707\023"
+	.ascii	"\220kx\201\026Od\341TB.\2012\007\355>))\246k\222\001"
+	.text
+	.section	.gnu.lto_streamStatsVariance.13.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\005\001\005\r"
+	.string	"\346XWB \217\223\016\220\320\f\024z\354\214\033,5\342\007\366\243\032\205c\200I\232t\215\235*Xn\320G\2405\204\347\325\234\246\352\004\313\024\013C"
+	.string	"B \320e\202\227\337\370\224\021:z]\237\020\262\267\224)\005D"
+	.string	"A"
+	.string	"D"
+	.ascii	"!\323\312.\247q\001\353\320\234e\333\357p"
+	.string	"\017\233=z\\\211\t\005rb\202\350\305\356F\001\017@\035\276\003\240\0165\303\267\347\346?\345\357EC\b\221\021\217g\225`w\235\"#$\267\3366\001\333\032\366+\004\251\351[\030R\nM\267K\241;m\013$m\270\350\366A\370*\"\217\276$\233-+@J-v\327\300\241\017X\207\2677\033c;\363(f1\306\356\205\323\312\356j\034\237\366O\376a;\327\361\314nV\352O\246\223Ov\236\227\300\356R\332\375@`g'\341\340,J\264\217x`\355~h\210\200\020\341(J&\035\324\341\365*\317\270\230H\237\354l\316#\025\203\375\267\032\2625]]tSG\371\341\271\377i:\227\202\3246$\\\017\232\263\321<\227G\213\034\031\206e\234\310\261qa\221\323\321\342&\303Y\203\005\235\350\311\262N\304p\373\267\032\252\364)\177.,|\024d\217\006PZ\351\206%\344\005\224\235S\257\224f\250\b\341"
+	.string	"bp\023\230\025\031"
+	.ascii	"`\221\"\023\317\361\321V\021\n\207\025\243\250\373\252fD4f\204"
+	.ascii	"K$\263\007\263K\377V\312,\264\240\025ho1\027r\341\033\203:\263"
+	.ascii	"\246\032\340\323\367*\301\227@-\007r\237\324\025S;\311"
+	.text
+	.section	.gnu.lto_streamStatsCovariance.14.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"%\013"
+	.string	"FTJA \251*\035\b\004C\334\377\002\r\002\360K(\370\003l2dh\224R\226a\201\001\2431\344n\003Z\303\210\304\301\b9@\322\320\201@"
+	.string	"b@\"\b\034|\013z\276\0171\225i\210\021K\366\336;\2457"
+	.string	"6"
+	.string	"7"
+	.string	"\027\360\001\240\255`\206\250T\366\001\013aI\330\335\212\271Cv:\317\220\235J\224\203\217\240\377\002\247%)\021J\246\320c\305bw\035K&\222[\336v\204\355\t\373\027\0012\372\025\013\003\007\032\b\273#\261\t\333\200\266"
+	.string	"\330\276m\320\266\330\216\361+\217\251\260$\023\221\372h_u\002\340C\320\027vO\260\005\273a\306\022\332\251C\315\266\003\366w\004\333\305\265K\252\260\271\037\320\200@y7\260\241\355\222(X\034\035\r\256\024(;\275\274\274Z\242\030\263\303P\224'\366\347\312\223-\243\263\257~\372\360\2372:\006]g\363\231\324\034\215\367m>\257z\270m\3438\325\323\331l\225\323yU\363`\356\203\321\325\217\343\272j\t\367s\345)\223\030\221\0349\312\313L\316\007 \001F\031O\260iZ\224\231\227*\026"
+	.ascii	"`\221\"\023O\306\321p\025\226\250{\251fA4&\204{\220 \007\023"
+	.ascii	"\013\370B\306\304\353~\b{\b\3135\\\217\026`\022\362\201\271\002"
+	.ascii	"\025\016\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\345\005"
+	.string	"rI\"*\220E\351"
+	.string	"}/\356\b\264D1rn\274Hl\005'g\023\230iA.bf\277\366\267\355Y\2512\326~\302mlvK)S\257\\x\200\r\346\322\230:\316\231\272\207\211L\247\001\304d*]\250\314LAL\243\352\271\020\255"
+	.string	"K\240\251N\232\252d\023\310\314\277\353\310JXQ\020\035\270E<\366\300\034k\310\356.hl\224\377\363\261F\273\233`Z\210\261m\261\205\374O\340\3678\363\357\337\261 23+\366\311\377H\t\024"
+	.string	".cr\302\240\275\260\\%\345\3140|\212\034\236)\034\004\303\363I\215\365"
+	.ascii	"\355\300w@\f\210\235!\370\016\261RL\026 8\250\307\272\236O"
+	.text
+	.section	.gnu.lto_.refs.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.84a1c7d5acaa498f,"e",@progbits
+	.string	"(\265/\375`\027\024\365_"
+	.ascii	"\032\242t#R@PJ\032\016\252\266\252\263\203\3235\346\347j\263"
+	.ascii	"\276\377:\362\035\377\266\265\271\275\275\305eF9^\334\265\034"
+	.ascii	"\230\006\316Z%\006[T\006\222J\251\247k1nX\364\007 ]\227\023\354"
+	.ascii	"\376\301A\273\204\2525\3308\023\256\376U\030&pT\256\021\356&"
+	.ascii	"e\n\326\001 \0026\002\373\343\333\331\237-\317\037V\323\217\345"
+	.ascii	"\232\332\315\017\036"
+	.string	"3\2768\375\327\353a\213\366M\333\256\247[N-\236\034\2711_PN\323m\365_-{\3063\263e\203\t\247f=;NcH)\234\236\004\025\313^\331,K\266^[\266a_++\366t\355V\332\256_(\312>\227\r\2326Y\213v\267\320\267l\241\013\266lF \270R\213v\257_\254\261}\352\330t'\343\250\272\373Y[\266Z\373\374@\243;\3714@[\331\022\023\273\356\356\001\002\002\002J\323\260 &\346&\375\004*\377\244Pw\312RY\257\020\373\365\335Z)\357%\327^\273\327\035F\242f\n\027\247\017\252r\017[}\3429\3527\204\217ww\267!|\277Qyz*\210}\376\273.\326\303\330\331\255\324\335\003\360\026\033\202\330q\272[B_.\017>\246\323\332;<+Y\226\322p\312\254\346\254\007\037\017\333\006\340\373\227\206\177\241\354U\b\336\362\206\263\241\335k\007U\351J\225+N\277n"
+	.ascii	">u=\370\256\254`\032Cael\214\f~\363\263\t=%\374\373\177\013H"
+	.ascii	"Z\004\376=\256\261\230\326\353\371\240mI\370w\204\177C\330\027"
+	.ascii	"7\361\263\b\377\246\377\325\254I\3633\377\362~\367\357.\007 "
+	.ascii	"x\360\265\352}~\006&\300\302\254\305q~\216\340\377\225\377c\377"
+	.ascii	"\311\376c\361 \201\377\\\337\371\331\304\277\300\177;\370w\202"
+	.ascii	"\177W\374\373\300\277\r\374{\342_\022\377&\360"
+	.string	"/\210\177}\376\305\371o\346?\232\177\177\377\315\376\037\375\273\363?\355\177\006\377\333\376\323\375o\361\377\353\337\234\177o\376\333\375k\363\257\372\337\355\377\332\177\026\377\325\376\237\375\277\372\177\300\177\264\3776wwww?\357\303\317Y\377\316\002\001\235dv\267\216\336\332Le\216o{\273??\207\345\255\001\377\323\346\031\351&\0227F\225!,\371\304 \372V\335\310\016\2756s\371\214B.\273\334\232\035\326na\200~J\365r\215j\246\316\346^{[)\252I\302ru2\227\253\023\311\323JNd\367\332\344YB\223\310]>\243\232\313\247\263\331\241\225\032\331\317d\013\252\222\263\271Ls6y\226\317ds\251\024\325\354 \0257\205\244F\221-\350\266-\225\032G\023T\222\311\303\266\\\235\035\327\275\320\245f\032\320\r\345d\306%}\254\025%\033\016\245W\322\271>M\312!\316Vb[V9\273\253\224F\335\304"
+	.ascii	"re\353\251eCJA\365\215\245n\002\232\272\221\333l\335\215\354"
+	.ascii	"\356\037\023j\355\006\302\263\244jj\352v\352ij(\244\330R7C\345"
+	.ascii	"\2544\227\317!N!\261(O\252fZ\221K\325qQL\365\211\324\352\033"
+	.ascii	"\335\275bT\252\346\216:N9\307\017\251\304\n\313\031\225q4\335"
+	.ascii	"\300\241\201\310\031\267\225W\303N\212\311FY\016\024\035\323"
+	.ascii	"\025\256\221F\307\254\210\026'L\203\227\\\306\214}q\312L:eL_"
+	.ascii	"I0\352W\356K\230\270\033\242\\X\271b6\315\007\345\262\2027\032"
+	.ascii	"?+1r\357x\306\256\341%nN\256\027+7\372\265a\353\336cbn\303,\033"
+	.ascii	"T\202\261\271\355\002\247&\312\312\005C\307\312\365\262gfg\242"
+	.ascii	"W\254\334\032\036\266l\320\245jb\007\004\004\324\003\324\203"
+	.ascii	"\262\262\211\001\220\216\331\033R,1mjp-\325,\232\365\3324\357"
+	.ascii	"Y\273\241i\366\314\301>(\227\024X\271\003\362\001\3525m\301\301"
+	.ascii	"\344K\277r7\330\245D\224\200A\341t\311l\231\365\362Y3\275\263"
+	.ascii	"uF\224M75\205\356\365\361\355\335\335\372\370\276i\352\227L\365"
+	.ascii	"\255qR\324\245\343\020\2252\246\204\242~\233\250_$\352WJ%\261"
+	.ascii	"O\352\227\207\372mR\277K*\t\017on=.-O\222\234.\333\266\255\327"
+	.ascii	"\272\275\237\335+\007^\262\207Z\030\247\017a\352S\250\372)\347"
+	.ascii	"\257)|\306\203\313i\344V\347\370\205\231\275\215\331\365\322"
+	.ascii	"\351\007G\313\206V\033\226\363\331\331\254\304\211\317\251VM"
+	.ascii	"\340\222\234r\3319\213\223\332X\224\214\263\310@\344\351dJ\275"
+	.ascii	"\b"
+	.string	"u\253G\263\311)_\371\034W\315\335\260\201S\036;Y\216\223\027;\027\304\326\206\274)9e0\016[\257\243\261\225\353\2141MA\213R\257\302\036\315\307U\316^cA\210D\001\241B\005\356\211\212\323\247<\324\2478\324\237\273\326\213\273XJ\272v\323\327e%\344\211]3\315\024\340\241\321R\004\313\017G\261QZ\373i\003'\206\005(\027\365<,\353\312\\\024t\371B\265\223\343\2052j[g\256\260\033+\267\034[\234\262\026?\261\231Kk\322\305L^T\013\b\026\026\026\026_\001@\365\2132cM\247F\335\324\326\021'N\370\312\246y]\316v\224\261R\341\372\206\022(\347\253\260TJ\0133\212S\266\342'7P/^vOf\260\251j\362C\315j\303\243\317b8Y\312C\f\212\032\220%K\230I\227e\017\256M\316L\325\231\t#\251\322\202\022NY\206\233\250\325\2222^\r#7\302T\353\344"
+	.string	"\027X\264\235\234~8\224\351X.\211\341L\325K\342\204\006\023\247\214\204\223\374\356\272\320\240\234\204ahbS\302L7I\236\264\242/l\324G\326c\256\211S>\262at\344\262\240\250\341\224\247\026\f\347\016,\215l\016\247\354\310\220\2653QQ\\\204\247\225o/\0209\027\331;%H;NY\212}\354\025r\315\023\247<$\356\351\211\235jw\363\272\203\250\241\022rv\372\320l\315"
+	.string	"\307)\007a\037\275\250\222:\035\2342\013;e\262\262\220\2342\324\256\245n\320(\327\303\226\t\330\fT\262\250\347&\3538\357\370\016\376\241\256\235C\205\331\2162v\355\304\374\371\331\351\374\343/q\342t9\335W\335\375\001\347\271f\013\312)\257\300>V\b\02059\037\334\203\f\315\233\331\217\216\nl\006\247g\036\033\206\343c\211\313\024\247'\263k\2761bVk\234\236\221\250\347\337\0277\032a4:\002\221\206B`\321\346\0304\00618\016\205\274\033\2150\036\035\001\211\214\216@\244 \343Q\bBP\322\020\206\b\031IC\341\221\b\006P\f\241H!#\350h\034\022\211z/\216Ca\361\b\306PX<\032\203\202EIGDCaP\321\230\024$\300\321Q\322pH\034\376\216C\301\023\204F_\fb\321\350H\034\376^"
+	.string	"\203G\3511hD\n\"\371n4\302\202\f*p\021t\f\302(\002\217 \216C%L\210@D<Z\021,\022W \005\217F\023\\\354\224@\\\021@\220h\b\024\026\201\033x\030\002\203,\214\214I\027\034\205\303\nvL"
+	.ascii	"\022\005%\b\026\t\217\\t8QQQ\004;'\022\026\203\303 \f\365\f\240"
+	.ascii	"\020\201\"\205\214\337S\250 \241\202\204\357)T\b\t\251@!\244"
+	.ascii	"\036\205\020/8T\024\002/8\276\330_QP\206\360E/\006\3218\344\002"
+	.ascii	"\t\030,\036\215\034\202C\301\"\234`\021\021)\r\236 t\021\203"
+	.ascii	"x##X4\024\306\360\265\b\032\213\301\022\206B\025h4\302\021\260"
+	.ascii	"\007c(\034\016\223\212\277\030\304\"\240\221\321w\004\022\217"
+	.ascii	"^\364\2167\"\340"
+	.ascii	"\304\021\202\305\240#\221X\f\302)A\304\306!\343q\030D\"\262\320"
+	.ascii	"9\016\241\020:\016\205I\352\205\204V\200\320\240\305\004*\321"
+	.ascii	"\b\343\021x4\006\r\211HHD\242\240\241\020\210\024DT4\006\215"
+	.ascii	"\360\031\356\020\030DJK \361W\355\227\305\344\001\305\251\331"
+	.ascii	"\016\331\324\226\322\314\217*\245\037.\224q29b\207E\206\213\320"
+	.ascii	"\035a\362\264\362\252\244X\301\211\341\266_\024;0\035\353z\346"
+	.ascii	"-\207\031N\301\200\341\3502\231\310\272\005\312\372\013\020\273"
+	.ascii	"vZ!\3149J\326[\0023\306\215S\246;\231\212fJ\026\027Ny\356dG["
+	.ascii	"\033\"\244\367\024\027\307r*\022Z\303Y\316\254\207\215"
+	.string	"6\037\227\332\361D\203\206\312\\\270\313z\235\214\341\326\247\316\232\027\2708N\337\233\241\312\370\235\314\367\363\033\237\261e\335Mq\212v\336\202\306mKf\327vr\"\353\020\020b\006\247\305\256\227P?0\212\bIc;\267\245\335uY\211\342\265\263\227\227.h[\234\262\332\231\312\323\216/UiF\322\326\352\002\201\215\250\221(h\2304#\"4\"\222\202$I\007a\005\204\030\006%\324\035\022 %1S\"\245\020\315\210HR\220T\n\033smWzh\033\223\304\225\236\210\264\323\373\027G\r\001\302}\227\t\213\034$\227\002\242\006\236F\334G\271.\027\023\375pf\017GA\016\0219j\b\322\037\277l\033\310{%<\371\373\\M\360\204\235xQ&\327\352]\031g\225\240:y\274\262\007%\332\367\263U5\013\337\214p\347\\\326\2040\3002\356\314F\266_\206\262\3059\373n\214\346\313\253\"\233\302\240\250\375"
+	.string	"\313\254\371^\331\254m\343\253\243\303\b/\322\236\316\233\375M\021Pmz\320\245T6Yd\320;\t\252\r-\243\016#q\343TI\240_\023ac\003\214\204\031\334>\350\303\232\311\240\322\222s\0178\241\376\206\267\250\357\233\210`^IT]\240^\2620\030L\202\023\025;\247\340\233\005\276\021\250\363pVW\t\013B\316\372\006Po^G\005\314\374\254U'hJ\036\375\355\020\215IM+\335,\333\333'\331@\254i\322\351\025U\212\005\201\273&r\323\262\215\323w \303\030\200W\016n\035BJ\200\350B\372\363\217c]\247\352{\t;\306~\3054\225\2736\364Q\233\0054\003Sp\230\246\t\b\037z>T\211\320\336\264Ka\2016\321A\025\177\211E)X\351\230H\201,$\323\356\006\020\360\204-\232\251\016J+H\356\355\341\001v"
+	.string	"S2\226[\331\266q\351\321-ejv\001[\331\367\255\247e\222\223\003\267\220\265\264u^hh2\252\241"
+	.string	"O\344%-)lf P\002\222Z\022\375\322\2337\317\223/.\345F\364\217Z\002\2167}\245\206\257\f\315y\002\342\217\310\316\b\211.\200bR\316/\253\216\037\265\200.\214_\263-F\326\330c\367C7\301-\306\342\323sM\3255Ai.\326\230\2276\227\206\344\356\261\026\016\335\363\023\342 \360OZ\024\004\257\026\230\242\032\032"
+	.string	"L\334J\035\bNY\202"
+	.ascii	"(7\306\374\034\307@\036s\377\225\r\301]\026\020\321\212P\302"
+	.ascii	"d5\344\214sH\352\0012\361\276\267\220\373\2055'\001z\005\001"
+	.ascii	"\026\203\177\r\nVrV:\250\020\365\003\2518`\303\275\310\300\251"
+	.ascii	"\311\210\236\265L\325\021sf\237`s:\327\301\276\013\270cD\035"
+	.ascii	"\\\275\366\376;\r3n\0379\313\220\315\222\306\263\254Vy%G]b\224"
+	.ascii	"bA\250\234z&=\013N\332\202p\\\254\302d~C~\302\300\340<\330\301"
+	.ascii	"a\373\377\361\354;\221\023\370F%\377\013{=\320\201\205\3369\237"
+	.ascii	"\rh8D\374z\315\025\335\334\333\b\342\2210\375\306\306\371\362"
+	.ascii	"\003\254\t\360.\361\025qH\362\376>\222\\'\357\235c\357\t\362"
+	.ascii	"\253\332\253\352W\020~\226\210\267\310y\355k+\261\2164;\303\030"
+	.ascii	"\263\302\207\0374\027\357~\225+w[\277s&\361\346^~\300\253\273"
+	.ascii	"c\202\330+3p\236)F\362/.\301u't\025"
+	.text
+	.section	.gnu.lto_.symtab.84a1c7d5acaa498f,"e",@progbits
+	.string	"streamStatsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"streamStatsPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"streamStatsMean"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"streamStatsVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"streamStatsCovariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.84a1c7d5acaa498f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,781 @@
+	.file	"streambuf.c"
+	.section	.gnu.lto_.profile.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"E\006"
+	.string	"T\b\306\001"
+	.string	"\023"
+	.string	"\271\352\202\310\n\004\002"
+	.string	"\002\001\001\331\205\355\260\004\006\002\252\337\376\202\003\f\003\332\333\323\265\005\030\004\217\273\217\234\013\005\234\225\205\264\f\006\347\301\343\350\b\006"
+	.string	"\002\001\007\311\244\360\314\013\b\221\344\270\264\005\t\365\250\256\225\004\n\275\227\373\\\002\002\002\013\275\240\345\300\007\n\002\002\002\f\207\236\200\376\r\022\r\366\264\360\365\001\016\257\241\227\210\017\276\237\344\233\016\002\020\003\021\226\210\313\347\b\022\345\362\340\204"
+	.string	"\034"
+	.ascii	"f#5R\332\\\352B0\200k\265\314V3\037\030\025\001\b *\306\027\003"
+	.ascii	"\234\005\240\240\2556\r\216\002\216b\363\034P\030!*YX\n\200@"
+	.ascii	"(`/1\260y\205\013W&\231]H\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"5\004"
+	.string	"R\305\017\025\240'\351\377\377\243\377\377\221\267\277\377\237\374F6\331\204\310\235d,\020Z\364\327z\320\272\333L0I\367\213\335F7p"
+	.ascii	"\2350\266\341)\n\217l\216\202\224\311{\213\214\322\244\313\322"
+	.ascii	"\300\017\001\" \360\"\013\256\033`\213\213\354,m\340.[\372{\212"
+	.ascii	"\001\242\301\271\312\305\366\013\367\177\276\3426\031LM#h\204"
+	.ascii	"\270\2318o\323\323m9\201\031\006Hy\307l\355i\226\303\220\201"
+	.ascii	"Bx\r\342\216\024\211\026\206"
+	.text
+	.section	.gnu.lto_.inline.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\314\004e\f"
+	.string	"BN)(\220'I\007\277_yE~\237|\362\205(\371!#k[\003^U}w\373CTD\310Z\333\232\265\215\264\326\366\226;\005\377\001\267\203\225"
+	.ascii	"\034\343\177\354E\343`\335b\300H1B\333\204w\346\365!\005\r#\b"
+	.ascii	"\221@\230r\260\230\271\241\320\330]\304\036\332*N)\035\227\272"
+	.ascii	"\241`\277s\214\031\317]b-,\032C\333\304\212\222\244t?x\217)\220"
+	.ascii	"\363\220\001%\302\206\266\004\333)\031\363\020\027\3322\t\253"
+	.ascii	"xA\350\320\266\2317o:X\214~\330\275M\326uA\313\305\371X\372\007"
+	.ascii	"\371\005\261m\223\0278\211\002l\250\200V\215$Ia9\200\002\221"
+	.ascii	"\031\263\335\022\300\243\035\305q@\303\bS\301\004\022c\243\244"
+	.ascii	"\240\254Bc\217\b\b\261\225N\252\005\"\264\330|\037JW\367\t\326"
+	.ascii	"\355e1\356{(- iy\373\007P\0263\326\275\027\356d\307k\030g\235"
+	.ascii	"]\221\t\">dc\322Y\035Tr\274\342cB\325\361i\351\370\"\346W\313"
+	.ascii	"\311=t\226\232\377\002\270\b\326\230\354\2251\375\2305;>\217"
+	.ascii	"R\314O\riH:\324\314\351\353S7\256y(\027\244H\004\241\242\276"
+	.ascii	"\361\007\336\347=E<\034c~\242\362\250N+\263\f)\231\277\254\200"
+	.ascii	"\336o\024\240\0258i\354\220\212\211\214\370\212\334I\351\004"
+	.ascii	"\363eE\230/j\013\241\273X\246D\n\f\205e\3068 \350\025\253aP\336"
+	.ascii	"s\217\344\377\314\f2\206ftD\\4x\026\300\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\005\001\275\005"
+	.string	"\322H\032 \240'\351\330\377\266\375 o"
+	.string	""
+	.string	"b\214SU\365\317\027\3775\263\377\375\366\267\326H\333\204l\231v\326\002B\270\001s\355^\260X"
+	.ascii	"\260\334\274W\222\242\322\336\\\276i\306/\376<I\277\211@\024"
+	.ascii	"k\255\225\224Rjs\340m\331\327\326\300\303\375u\3664\366i6C\244"
+	.ascii	"\231\020\021:x\250\211\371\336f\2337\023\377\231\301~\004! \240"
+	.ascii	"\242\252Q\017\240`\345\ns\231<\242NbA\234!y\204\001\004q\bV\377"
+	.ascii	"\312\306\025\003kd(C\"\002\370\007\030r@73\207a8&\217\261\314"
+	.ascii	"\005\271\224\204~ \2036\273\0227\266\340\nF\301v\341\341\262"
+	.ascii	"\202\017\001"
+	.text
+	.section	.gnu.lto_.pureconst.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\232\004\n\232\004"
+	.ascii	"\013\232\004\f\232\004\r\231\004\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\034\002%\006"
+	.string	"B\307\031$\220)\351\260\327\335\335\242\233\205rw\027u\247u0)\027l7M\364\347\265\017~\333\376G\2154B\310\226)'\034\222\202\035A\355\210!Al\203\303\302\302\356\270se\t},;X\017\312\233L\277D\036\3454\202o4"
+	.ascii	"@H\230N\252-\324\302\226\302\317\323a\357\353\353;\277w\304\336"
+	.ascii	"`o\020\365\341\347\261\022( \260\"\031\235m1\001_K.8Yn/\034N"
+	.ascii	"<\030\343\004z\302(\225g\276\266\307s\306\302d/\221Vt\207\231"
+	.ascii	"\235\236\274\331\273Y\242\31491\300\177\035\\\032T\036\230\034"
+	.ascii	"\250\r\2224(z\200\303\201\026M2I\001y\035\b\301\005\b\260\324"
+	.ascii	"\301@\343\251-p\031^\021"
+	.text
+	.section	.gnu.lto_.lto.dcabe39c893d3d8f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufInit.0.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\255\t"
+	.string	"\346QA90\305*\035\200\237\034[l"
+	.string	"\222k\230\300\035\335\037\331\241,+ia"
+	.string	"W$q\026aT\357\334\360\201\204\361\233\332a`\240\001GA\315CZ\231\270~hRQw\223;\245/"
+	.string	"0"
+	.string	"/"
+	.string	"\004\023\343\325\211I\324Pv\247\364\374\200\345\021s\215\345Q/\376\035~\376i?\240\235\264\\\253\303\313\302\356\032\266\\\257[o\033\301\266\202\375\204\227\375\360r1\321\214\354N\334"
+	.string	"\254-\206h\330\276m\225\235\261g%\0368S\"\035x\331w\201]X\fdwn\274\301<\332\3669\336\241\362\027\021\216j\243\376\221\242j;\334#\205\331]\217_\203x\b \311x\364?\313\243A\305\006\005\013\336\354\271\202ja\277\262\n\263?\373\343\347\257\001\f$\221z\247\222\216P S\305!\316\b\005\342>\"\357d\222\244\216\343\272\220$5|8\031\362L\222S\340\256$\362\344\251\353<\231\231\373\312*\fj)\200\215\245\001\023"
+	.ascii	"2\241\033\f\354\376\2025\312\001\330\305\264\231\261Y\314\205"
+	.ascii	"\374Mc\0130\002\306\201a \bP\b.\003#@\335\013~\346\351\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_sbufWriteU8.1.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"e\n"
+	.string	"v\323F=0\345(\035"
+	.string	"\276\334\356\016\205\375\030\026OxA\244v\rH\2444\005o\302\246\252\320\377\206\333|\263\326"
+	.string	"\202\004\355\332\3253\"\"\031@\373F\366\023\305\235N\177\376E4!D\356\224\0023"
+	.string	"4"
+	.string	"5"
+	.string	"\366x\347\\\276\240;\347\235\240;g\322\2261\270\340\254d\244\004\330\335O?N~\222\376M\256q\275V\237\002\017\273\353\351zm\334z\333\t\266\031\354+\004\357.\373\267mzn\323\3674\263\316\313\256Fm\300\3228\227\020\333\337\330\326i/4\220/S\326]\017\026\320\247}\222\227\220\227\251>\260\013\033i\331-=\001\335\271NL\307\324\031\007\346\256\031\320\257S\017"
+	.string	"C\244\345\361((ow\035\374\223\223\311\003Qu\347\256\0071\0012\326\254\331\345jj\314\376\266\273k\205\331/\037\024\241\223\226\306\b\265\350#a\202"
+	.string	"C#\2614~\244\020\004C\321G\232\b\201\237H\034\277\017\202\303\212\221\370\225\302P\3746\345~[\205\231\343\240\261\264\345N}\025\213\324\364Q\001\022"
+	.ascii	"2\241c\034\030.\254\244\346\024\025\b\002\213\3124\250\322ee"
+	.ascii	"\323R\003F3\261\016v\225k@T\030\f\346\006\250(\341\016/\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.2.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`v\001-\016"
+	.string	"\206\332\\C\020\221\223\016\t\025\227\312G\024z\3501wN\315\276D\250=\331W\330<TL\007R\022\364\265Z\353q\315Q\260F\033\004d\322x;@\004\200\"\002\005EL\032\024\005\320\216\2413Rkd\223M\244L)G"
+	.string	"E"
+	.string	"K"
+	.ascii	"\330a\200|\332\027\361\021\336M%\027\260\233\022b\305\356\327"
+	.ascii	"\341\016\354\320\337\007\\\207\3309\256C{6\f\002\0266T\214Xf"
+	.ascii	"\354\256\246\034\356==\377\247gH'\025\236Q\301\356:I'\030n\275"
+	.ascii	"m\003\266\021\330\311\021vLkb:\023\323XL\307\233\376\353+\277"
+	.ascii	"\005\323z\245\023\246\017 \333\260Y\355^X\325X"
+	.string	"\030\350\322\301\366S\007Z\260\034E\362\022\206%\020\273\233\035\332$vv\230\231m\375N\302\373\n\005\303]\r.>\002&*\365[B\"\370%\337s\035nbP4\232\302\263\361\342\244\030\037\317\250F/\303\304\203(W>\312\333Qx\260\335M\340\237\3508\277Tr\035f\364\250g\006\025\032&K\257\fL\214T\241\\\331\237(U\305\276\265\273kM\t!\234\t\n\3728Pw<\036Hh\260q@:\320G\023\341\266\215\353h\"\0208\233\326\351>\232G\001s# \235\006\342\270N\313\276\320O_\360\001&\244\"\353\310&\006EYD\305R\336\356\342\301\242>\225\252\372\221\n\273_.KS\177z\276\264\004! p\002\031R\326\001b\300\031>\221\260\\\nD\\\0031\340w\257-\203u\f\340\035^\022\311`>\262\005A\3028\332se\247\f\355\362\243\260U\216\253&\006F-\303Sg\303N\305"
+	.ascii	"\030M\3744\355g\217~Y\032\034\035:\274h;\031"
+	.text
+	.section	.gnu.lto_sbufWriteU32.3.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\306\002\235\021"
+	.string	"&\240nE"
+	.string	"\261&\035\320\207\f\3037\033"
+	.string	"\353\236y(\375\307\265\343\332\321\336u<gY\225\t\013\207Kg\262\305t\320\201M\254\244{^\225-\301]U\255\277\344\2738:o\304\345\365P033+=\222\2667\2212\245X"
+	.string	"S"
+	.string	"]"
+	.ascii	"\334\241\306\331N\331K\274^s\301\036\273\036\\\214l\207\004\264"
+	.ascii	"\247\375\021'\361:M\312O\273/\"R\354\312RNm\207\226\035$\036"
+	.ascii	"n\017\020\017\375\262i\204d\020\375\254\334\344\330\335N?\374"
+	.ascii	"\365|\371\267\271\007K\013\206g\b\301\356:YZ6\334z\333\005l\223"
+	.ascii	"\330\272\n\327vw\255/vL\243b\372\024\323\246\230.\3054)\246G"
+	.ascii	"1-\212i"
+	.string	"\3564?\200\327\374\233\226\016\301t\324\322\020\2465-\2550\235Z\372\002F1 5v5\314v,\020\\1c\373;>:$\034r:\237\233\343\240\334\204\341L\210\335\345\016m\024;9\366\336\342\333J\372\234T\325\324J\320\335\0237M\275\315\r\300\314T\202\324g\261\200\345\313\370_<\374\230\341\202R\025\237H\306Yl\214\374\244(\375\r\025\020\261\234\3718\366\316\363m\273{\300G\021\201\202/\223\022\017Oz\234g\007\030\0354\233^\025\340X\t\202\345\314\226\305Ra\354\022T\026\324\365\225\250W\"\016*4`\251LZ\256\257;\361X,o\325\235@P\261\272U\353\353D\006\330\233`\322\352\\\236\327\3528\031\354\332\352\213o\363\004=@0\2159\364@\24418\025\355\330;\fN\277\0235\024\022y`\tI_\214\224\244c\357?#\275\216\246\320\244\305\234P\006\0373\\L\352SRS: "
+	.ascii	"\003\2211:\006rB\237M\201\031\311p\r3|/\326:\360\213\262=\220"
+	.ascii	"3\330!\347\022\230\001k\317%\262\003\254#rOr\207\275\355H\342"
+	.ascii	"\032\030\243r\340s1[\307(\274\303K\"\0314\016+\013\202\013ck"
+	.ascii	"\257mv\224\241=~\250d\225\303US\303h\231\"\367E\2207C\247N\017"
+	.ascii	";!\006\260h\242\323`?;\272\313\322\330\350\310\303\213\326\223"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.4.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`v\0015\016"
+	.string	"\226\232]D\020\221\223\016\tc\322=\250\027\024*\035\334\3507\207\025Jdh\027\261\271_E\007)H\370\245N\353q\315Q\260F\033\004d\322x; \002\200\250\200\264\024\201\017\205\n\230\333\256\265Y\333F\310\336D\312\224\002G"
+	.string	"G"
+	.string	"J"
+	.ascii	"!\331!G>\355\203x\b\357\250\223\003\330Uy\201\331\375>\374\221"
+	.ascii	"\035\372{\200x\230\275#\036\332\263[\f\260\320aar\231\261\273"
+	.ascii	"\232n\270\367\364\374\247\2569\241Txb\nv\327yB\301p\353m\027"
+	.ascii	"\260}\300\316\216\252bc\351\r\226\326`\351\fKcG\375\361-\377"
+	.ascii	"\025\323\032\323\t\323\337\330(\tp\261{\241Uce`\f\007\333_%@"
+	.ascii	"\341r\225\311G\030z\370\260\273\234C\333\304\346\034&\307\266"
+	.ascii	"~\027\341\275\205\202\341\256\206\025\001g\361A\361\320c&e\243"
+	.ascii	"%@\035\025?\301\b\271F7\372\030\245\016$\225\267\277\200\262"
+	.ascii	"\335E\340\223\3508\237\345$\036j\364\252g\206\025\032\250k\352"
+	.ascii	"M\254Q\266\234\335'\342\245W\0062J,R\266\354\217\224\272b\377"
+	.ascii	"\332\335u#\236\t*\n9P\177@\036Hh\260yD:QH#\341\266\215\373h$"
+	.ascii	"\020<\233\366\351B\032\b\001s%\"\235&\342\270N\343|\243\247\276"
+	.ascii	"\340\205\314HI\326\022\217\231\0245\201i\266\362\366\030P\206"
+	.ascii	"\351W\227\252>u\003)Z&V\252\0173\022\301\001! \200\002\221\312"
+	.ascii	"\353b@\035>\311\260\\\005\032\327\376\230/w\357\226i\035/xG\220"
+	.ascii	"D0H5\016\303\325\236Bv\226a\300~\333\206\232\255\032,O\f4\260"
+	.ascii	"\002M\230F\230\214\0014\232\370i\331\317\036\365\262\2645:rx"
+	.ascii	"\321\0322"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.5.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\310\002\305\021"
+	.string	"f`oE"
+	.string	"\261&\035\240\034\035F\273pn\343w\r~\232x\b\367\215\026\022\374jxMA\023\022\016\227\316\322\305t\320A$V\322=\257\364K\360\377\377\277\2122\246\235\316cb\364f\251\233\231\231\225\036I\333\233H\231RX"
+	.string	"S"
+	.string	"^"
+	.string	"\346\0165\316v\302\216\242u\232\r\376\330\025A#\265\035\032\320\236\366M\374D\353\257\224\233vad9\2730\224Q\333\241a\027\020\017\267\007\210\207n\3315B:\204x\260\330\350\330\335Ne\336z\266\374\327\374\243\305\205\303\023\344`w\235-.\037n\275\355\003\266\025\330Z\022\366\265\335]+\214\035\323\247\2306\305t)\246I1=\212iQL\207b\232\373\353\007p\232\177\203i\020LG-\raZ\323\322\n\323\251\245O \2652\200g\327\303\254\307\366@\235\021\266/\333\301i"
+	.ascii	"\342\206\301\216\315c(Oa\370*\261\273\334\241\215\3427\366\336"
+	.ascii	"\342\333H\372\033U\255\244\372\232'\220\261\221\352\257x\260"
+	.ascii	"\362g\374/\036\202\314x9\251\316\027\222\361\226\033\251\233"
+	.ascii	"\364\244\307\261B\302\025\263\367\234o\333\335\005\276\212\n"
+	.ascii	"\030\374\231\224xh\322\307\236!bv\274\256\251(\226\037\225\234"
+	.ascii	"9\344f\0217\275\202d|V~\\9\263a\256\324\230\026T\032\364\344"
+	.ascii	"#Q\217\210H\310\020a\245*a\235|\235\211\267Zy#\235\t\005\325"
+	.ascii	"\252\033a}\235H\001{\027JX\335\211\347\261:\016\246rm\025\306"
+	.ascii	"\257\371\026s\351QQ\227A\023B\032\203\323\220\314\336apz\331"
+	.ascii	"\246 \004>3\226\237H2R\036\221\216p\354\375\205H\217\0035n0\207"
+	.ascii	"\006\001d\306\213\272 i): \360\002\221\261\252\003rB\247M\201"
+	.ascii	"!\336\201\331\260\366^\202\035a}D\354\270#AL\211\261\263\302"
+	.ascii	"\200\341\363b\255\013?(\337\203\034\203\035rN\301\f\013\007\376"
+	.ascii	"\344m/\333\301 lB\222\200C\357J\210\371G'\214\243=]\331U\206"
+	.ascii	"a\366\0337,\277\n`}\352\320\260\262\234\315\222F[ \020&\"L\216"
+	.ascii	"\0010\232\370\264\333\317\214\356\26246:\344\360\242=d"
+	.text
+	.section	.gnu.lto_sbufFill.6.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\f\001\205\f"
+	.string	"\206\030UA o\233\016#|I"
+	.string	"\"N"
+	.string	"1\240\007\f\b\252\336>\b\245E\255\224\223\001a\304\242A\025\"BI\003A\341\325oQ\307\374\003\020\004\206b\360\207,\304O\001\243\300\026\340\377\277?\331[\312\224\002@"
+	.string	"A"
+	.string	"?"
+	.string	"\017\261]\264\361"
+	.string	"\273\336\b\312\356\247\261fz\364\367\001\322\343t\001\322\2437\273\305?\221=\t\205\017\223\030\273K)\207o\317\315\277\311-\035\b\367\2540\330]g\007b\341\326\333>`{\201}/%\277\024\3231\246aL\253\246\023\246\237\221BT\020X\261[a$cS\342\211\021\333\307\330V\021'\331^b\024\266\354jH\201\262\273\032s\246G\003P\323N\240`\3737\301\272\033R\002\301\323>\210\037.yMU\265\255+\337\031\223\301C9\333\022>Bc\332]\216\177\002\312\246\016\033\322\243*"
+	.string	"\026\242\212\246^\322\353\345\202\213\217\031\0349\262?.u\203}\270\273k\365\354\213~\313\277\277\362\241\017H+\255\362@-\363\250;\233\007\032\016\254\352\203i\031\025\272,\353\352P!\b\225Eu\260\214\332\024\360\025\341\203Q\332ua\024\346\333\303U\317\r0\244ph\207\243\232\310\210\274{q\205\032\3650<<t\344\210\004T\345N\002\027"
+	.ascii	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342"
+	.ascii	"\b\307\232@\032;.V\2039\366p\r\343\207y\201\300p\005$\214\005"
+	.ascii	"s\003T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sbufWriteData.7.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001%\f"
+	.string	"F\327Q@ o\233\016#|\231\030\033}#\247\203~8\200\320\235\021\217A*t\265\t\221\354\321\202\221\027\"B\255\005\243\310\255o\240l\376\001\b\002C1\370s\350V\256Z\301\340M\220\314\372\223\275\245L)="
+	.string	">"
+	.string	"="
+	.string	"\240\007\330\r\205\224\354~\027_\246G\177\037 =N\027 =\232\263Y\374\003\331\213|t\220\274\330\335J/\234{r\376I^\361<\272'E\301\356:=\017\t\267\336\366\001\333\t\354O\b\242\237\362\221?\3064\214i\215\351\204\351S\022\007\025\004N\354F\030\301X\223X\"\203\355S\266\365\303E\270\217\330\204+\273\025NJv\367\342\314\364h"
+	.string	"\346\347\023\024\b\236\366C\356\201\273(\252\332\221\330`\311\353\244\251\366\205\345=S\0248\264\263\r\341!>\323\356f|\020\036m\302"
+	.string	"\222\036S\001\254\020E\275Z>Rt\304\320\310\221\375u\251\026\354\303\335]k\310\376\367O\017\035\316\003\2656k\0037m\243\326`\032|\030\\\026'\333\264\252\203]\027\246\251:\016\254\253\322dZ\205)`\314\303\311\252\r\303\262\212\372\366p5\344\005\035L4t\303PGd\200\334kqU\205z\027\034\0326r$\"\030"
+	.string	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342\b\304\232\340\031;`\332\035\\\303\004\314\274@`\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufWriteString.8.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\026\001\265\f"
+	.string	"\366\230V@\020q\233\016+\330<(\242;\222\213\316o\r\203\341{#\251xYlT\246 )\035\224\276\333o\224\360\247:\212\033\271\035\376\377\t\240"
+	.string	""
+	.string	"\212\3404A\270\335*\244\r\003\355\246Fv7)S\nB"
+	.string	">"
+	.string	"D"
+	.ascii	"\037q\022\334=!\027\260K\342a\261\373Yl\231\016\375\235@"
+	.string	"<\234> \036\232\263i\374+\331\237h\0201qcw-\355p\356\311\37179\345\215tO\211\301\356:\275\021\f\267\336\366\001\333\013\354\203\b\321\356\256\225\304\216i*\246\247\230\226\242t\274\347\207\377\376\b\2463J\277\022Sd\024@\331\275\020\302\261 \330\342\203\355\373'\377\200\274\204\033\244T\2076\210]\035\276\262\235_\205\030\t\236v\032\251\244\376\007\363\221\367\\m\350h\347\177\2349\nm\332]\005>\312\026\301\367\020\022\017%\r0\303\223\032\365\237g\006\030\327T\213H\216M\206Le\24466!\357]\021t\\\200,hg\177\234T\016\366\003\037\232L\266iq\323\036\250/\035\020(8\270<0\331\246Y\032\354\272\260\213\245\311x\\\326%\323\254\016\003\306$`2k\303\260\314\252\276\315M>\235x\001\332(\307\224\252\320*%\367jD\235\224\322\333\350\204\340d(\305\244\332\255\020\001 c\027"
+	.ascii	"2\003\302p\331\302^l\2443\\\304)\031\244b\0170\266\025\302}="
+	.ascii	"]5&}\332>0~q\031\0034`\035A\255p\037\250\006\256\200\271\001"
+	.ascii	"*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufWriteStringWithZeroTerminator.9.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`9\001\265\r"
+	.string	"v\333^B q\223\016\254\320\244\274\342\357\210\2543\324\341\252\371\224\206L\b%\236\313\002\001|\220&\266b\267\326\031J\370f\364\221$\264x\323i@\301\200\202\311E\240\003\031\203D\306\355\302\244\021B\366&R\246\024J"
+	.string	"E"
+	.string	"L"
+	.string	"\002\326\304Da\301\323>\210\207\370\274T\362\001\273(1P\354~\030c\256C\177/\020\017\257\023\210\207\376\3303\376\245\354M*\244\0217vW\323\r\377<?\376W\216y'\240\247\345`w\235\336\211\205[o;\201\355\006\366U\004\366\253\335]+\212m\2453+}\261\322X\225\276^\372\255\177\177\214\351\n\246\025\246\263J?@t\001\343"
+	.string	"\215\335\n)\034\213\202)8\330\276o\372\211\344\"\374`\205\207\335\315\016m\022;;|f;\277\t\006\002y\317Y\206\221\202\374\223AnB\344\332]\006~\211\220\215\257R\022\0171\355\220Q\252\364\322\237\236\027X\250V\212!\265\204>\022SU?\302 \312\224\257\2510\007\251%\224)_2\252\275qy\357\252`\324\002e\242 \373\023\245j\b \234M\347\351DO'\202:\343!a\004\302\366\241\351<\035\215\303m\033\227\3218\233\217M\313t\035\315\003\201\271\020M\247y8\256\323\262/\364\225_$^\240B*r\246,\""
+	.string	"R\356\325\270\364\242\231\336\306\250\203(S'.\252 \226\017\035yiTL\375SF\023\026"
+	.ascii	"2\003\3020\300\206\325\331Hg\270\210S2H\305\036`l+\204\373z\032"
+	.ascii	"oL\316\264=\251\341\"3\300\3442\007\320\020V\270\017\224\bF\004"
+	.ascii	"\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_sbufReadU8.10.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\275\t"
+	.string	"\346\022D<@\305(\035\340\311Z\363\362\313\265>\fM\224\017\221\226\001\314\215\361\006\374\3442'A\022\263\re\365\021\377S\224,,\033KQ\024\035\325\247\030\031y\210\023]+r&\177w\223;\2452"
+	.string	"0"
+	.string	"4"
+	.string	"\332\t\346\245m/0\234\f>|\261&\007\311\205\212l7\334\324\343\340#\350\337\344\230\221\215\227U\013\365\230q\330]\307U+\343\326\333F\260\235`\237\023?F\243\243F?3e\001\n\\vY\263\002\013@\266\204\330\276\355\223\255\261\035\243}\330KN\217\231>\260\353\202\261\354\206\035w\264K\207\347\314\313\030\032QS6\257\257\b(\374\0325\016\260\020Q\231t\224\222\266\273\r\376\311\004\205\006r\351\233\346\345u\363\021K\305\231\035\242\242v\330\307\354\356Z]\236\217\005\334'Rs\036\b\322C\367\001}#\321\026\362\272\316\343\266P\304\247\333\270O\264y\f\354I\200\276m\344y\337\246\t\367\236z\220R\225\375\225\nP\363K\363r\352\005\004\016"
+	.ascii	"2\003\302\260\027s\212\251NE-\202\305\242\212\r*wX\355\244tA"
+	.ascii	"\226Y\267\013\252\035\225\031S;\311"
+	.text
+	.section	.gnu.lto_sbufReadU16.11.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\232\001%\017"
+	.string	"\306]eD"
+	.string	"\2216\035\263\tC\301?\341\037\233\360\377\321y<\346vW\233\177b<Y\250\331\274G\350x\306>\366\221\371\200\302\230\252\b8\234\367\311\245\377\377w\325l)Z\263\246\024l\270\"`\337\327n\264\211\224)\005P"
+	.string	"N"
+	.string	"S"
+	.ascii	"\321\037Y\246\375\322G\200\036\226<\300\256J\tf7\354pG\366\350"
+	.ascii	"0\263\355\207\270\b\220C\031"
+	.string	"\256T\270N%\320Ef7\3348^\340z\314\017\270\036\225\303C\317\220\377\323\255\226\024\027$\024\223'\306`w\235$\024\013\267\336v\002\333 v\202\004\326\260\264\346Jo\334tgV\032{\370_1m\305\264\306tZ\351s`\031^\030X\355RX\315lLT\321\341\246\337~\212\204\252\345.G\331\232I^\302\352\001\206\314\356j$\266\366\2306\310?Y\363M\241la2\360\224\222\261\033*x\346\236\002\3045\335\320\247.\340(\034@\360Y\374\357z\344\350U\0234l\364\345#\260r\322\214\217k\272\321\214q\362a\224+\037e\356'\276lw\027\370&\274\316g)\271\0365=\352\bLZ\320(\211re\207\243\324\r\366\255U\025\033Ks\256\364\346\312\037\217\247\035\357Sw<D$4\340B<\336\347\333F:\216\353:\333\310\203\020n\353x\337\346q\300]\004\217\267}\272\316\333\264Pt;S"
+	.ascii	" \206\030\221\216li\246\232j\351\301\013\034U=\246\251\177\001"
+	.ascii	"kd7\213\353\212\251\252Nf4z\375\351\231\262\002\254!\022\321"
+	.ascii	"\004  p\242\241\265\033b\300\031\226EB]$\227\207w'\266\022_\207"
+	.ascii	"\360\017;\024d\001\324\200\232\037l\030&\0318ka`\355\335fG\206"
+	.ascii	"v\362\013\331\305\254\310\rHvn\005\312\240'\003j\027\347b>\236"
+	.ascii	"k\327\250\244\230.C\006"
+	.text
+	.section	.gnu.lto_sbufReadU32.12.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\312\002}\022"
+	.string	"\246\342vF\340\360&\035\342\007x\373\200)\340\267\340\344_\002\201\205\306\302\364\231DG\254[\342\220{0 U\373f|\217\022\305\216\230|^c?0\004\031fX\203<,\223\233P\300<\207\3316\327\017\235P\223\266\367\2262\245a"
+	.string	"]"
+	.string	"g"
+	.string	"2o\276\017L\203\261\240\231\220\031\341\230\363C\360h\023M\325~\317G\274\374s\271j\316\233\036\024s~$&\321\036\375i\266\375\235\363\274\030\006?\234\032)#\212\375(\315\371q\005\316\222\217\360+\371\270\035\016\273\302\374\313\016uln\320\324\300\\M\013\346\234V\232\232\013\367\336\366\001\333\t\354E\tP=\002\325,\251^E\265HT\253\244:\025\325!R\215\212j\020\251\376\210\352\315\343\244\335\3476\375\373%TC\250^\250V\250\276"
+	.string	"\023\217\214\001\2639+\314\226&RT\341\341>\277\375!\033\031\204\236d\024D\"I\347?\007\2627\267\274\204\367C\r\2459\347\326bo\217\320~\361\0036.f\226R\313Z+\203\224\273\267\320\257\244jC\366A\207/6\034\255\326\264\227\035\202\260)\212\355\370\212\006.?\307\177\311\307\325~\006\005\r\"\233\342\005"
+	.string	"\34749L\256Z\221\325\244\231\0202:\363\201\334\275\350\245\3159\025\370D\336\004?\307E>\252\366@7"
+	.string	"\023CGO\214\316\354OF\227\203}8\367\306\016,)\336\266\274\225u\253\004\302\353\201\353$\305cY\341T:\227\253kq*\021N\\\\\313[\341J\b\270\223\220\342q,]\347q\333\027s\333cQ\261\035\244\230\225\361i\341z\004\030YH\343cGP>\334\375\350\"\256\332m?\244\355\356)\365\335#\324\336\001\312\335a,\310^\310\264\272\332\376D\f\203v\263\220\254U\2459 \020#\0313\0352`\031\266\301"
+	.string	"\224\030F\276\207\301\3072eQ\r\b<8\243R\306:Y\030\006\037\313(\233\006\024\\\013\242\223\241<\370\371\323V[\253\333\004\266lj@\204"
+	.ascii	"\265\006\376\363;\214\254\366(d\267\f\355\312\357w/f\210\034"
+	.ascii	"\336\03046M\b\030\264Li\276E&s_)\203\236\fx\2738-\346{^\273F"
+	.ascii	"%\305ty2"
+	.text
+	.section	.gnu.lto_sbufReadData.13.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\305\n"
+	.string	"\006\325J@ \2518\035\017\004\321\003d\336\002\r\362\311\006\374`\340\233\257\001\244\t\351 \263"
+	.string	"\021\352*\354\002!\266\006O%\217l\034hl\b\020\002\224\217B\2503\266\362\036jF\004\263!\350\323&r\247\0245"
+	.string	";"
+	.string	"6"
+	.string	";b\214\311>=\236\001\373\314\276\200}Z\264!|,\331\233X!T\204\335\325\224\344\342\245\350\037u\212h\364\271\234L\354\256\245h\364q\353m?\330\216\260/\021\322\362\222~6a\320\340\222`\327\243%aWSA"
+	.string	"\333\267\330\326\0027\211?y\201)\273\"\254\324\356b\254\311>\035.9\372\001\002\210K\373\003N@|\311s\205]\222\200\324\006\027\331\022\322\241\037\333\033?\320\311vW\343\033\b\301\f\200\007\373\224\332\340\240\244z\255\200\250B\023@\262e\217\037\251#\366\257\335]+\311\376\370c/\375\363\247_g\234M\206n\341fqq\037\250\3462\027\235\212n\333|!\250q\274\256\3638\215\203\261u\032\367\201Z\346bOc\363i\241\347}\232e\334_\253$S\250V \345pE^\245bjw\236\f\021"
+	.string	"2Cs\025\370x\024\204\rA3q\300\fk]\003\006\314\350@\f\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.14.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"m\t"
+	.string	"\206RA8@\217\322\001\233\276J\2046\004\016\340\013\024N\256K5\242\216vuXZL\334\366\221;\256=(\310Bi\255\270\f\303\243\302\027\214\224[p\207\3604D\032\331D\312\224\0021"
+	.string	"/"
+	.string	"0"
+	.string	")Yx\341:\305\013K$fw9\316\007\264\307\354\002\332\243Z\034|\202\376?\236\251L\230\264\\\251\247faw\235-\227\304\255\267\215`;\301>A\316L_\243\201a9 \331\215\210\311\354JD\321\260\r\332\033\333O\373\260{\200\017Q\017\330}\225\234\354\206\035w\266G\207\233m\237\343\035\240\035\020\033+\207\217\244\026`\270\364\220\207mw\025|\020\323i\313x\364Q\332\343\025\240\005\246\312\230\035\246R+\354g\253/;Kk\017\377\250i\315\f\243\023H\035\362\214N\240\356#\372L%\216\344u\235\027\342H\f\237\216\013}%\316c`\257A\364q&\317\373\270M\270\2675\345\250teUM\317\232I\275\252\246K\016"
+	.ascii	"2\003\3020\006\013\220\205\230\340rD\245L\351\254?\023\230k8"
+	.ascii	"S\026\245\004\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_sbufPtr.15.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\315\007"
+	.string	"\002\01766P\215\322\001c\2020\026\324\364\246\201\242w\024\313\024D\321\0211W*\306\377\321\\\307\265e\352\236\246v\330\253\252\346\230U\335_\255S\344\337\032\2364\262\211\334)\005\034\220F\235a8 \215\226\331l\037O\354HM\223Y\354,d\264\230m\236\210!\260d\330l\361#\345\026-soU\003\222B\330n\270\007\207\355n\202\337\361\340\200]\034\372!\255t\244\267\262\347\350)\205}k\025e}\367?\213r2R@\262+\261R\255\b\f\301\260-\262-\266\337{\027:\300.*\003dw^|\301\016m\373\032\337\020\231\033\230\026\247+\245\212\3700\331\235\321\363\002\327!\366\200\353P+\316\375q\3769nu\023%%\323\350\217\242\260\273~%\323\351\326\333>\260\215`;\025\013"
+	.ascii	"2\003\302\260\2268\\2\203\rc\273k8\304\0046i\214;\004)\374\314"
+	.ascii	"hj\347\023"
+	.text
+	.section	.gnu.lto_sbufConstPtr.16.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\375\007"
+	.string	"2O77P\215\322\001$\243\252B\240M\242\350:\0338\032\304\274\216 \3016\177\206\256Y4\327\361\330\260\224LS;\354UUs\314\252\356\217\332\253\342o\365\217\326n\"wJ\001\037\256\243\3066\037\256\223q<\233($AZ\226i\230\0041p2\211m!\271)\260\326\340\331\244H\3236\231\231{k\325S50i\204m\356 \016\327\256\204\202\377\001\361pi<\372#\005\370Lpe\317\022T\f\373\326\252g\375\367C\013s\221\202P\262k\261ZY\224H\262a\233dglC\370o\364\200]\317ddwj\254\271\036m\373\034\357 \271#\230\252\024f\242\202BDewJ\317\017X\036\257\013X\0365\343\335a\347\337\343\326\247:9\241J\207\227\205\3355<\241R\267\336\366\201\355\004\333!\001\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_sbufAdvance.17.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"m\n"
+	.string	"\206TH<@\305(\035\365]\257\305\233\352\345G\351Z\006\314h\244\241u\036\375\366\027\346\303\224g\224\332\217\350\031\315\322\225l\251\255\025\227\201\323Q\367d\307\214\023J\307\027\304P\311 \233\310\235R4"
+	.string	"7"
+	.string	"5"
+	.string	"\032k\270O\217G\330>\271\037l\237\026\355\227\217\255=,#\005\023\260\273\235r\\\274\024\375\233\034\243Z\231.\007\"v\327R\265\302\270\365\266\027l;\330\207\b\252IK\225>G"
+	.string	"\342\302\320\262{1#\260\262\271\342a\373\031\333r|\211\370\227Y\214\331\325H\211\355\256\306\r\334\247\202vi\177\344$\342]\245\033\354\262Db\273c\026\037(9\363\246R\037 U\300\341O(\270\335}\360a#\022\327\361\351\227\266\317\253\236T\006\270Nrf\217&\251\033\366\265\335]+\313\376\353\337\356\372\247J\007\237\212P\250\201H\035\265g\003\"u<\316\007\034\205\235\350\363\274\317\323\211B\034\257\363\200a\267I\3607\361\001\273\321\367\201]f\334k\253,K\204\310N\212\262*JA\353*"
+	.string	"R\257\252\017\020"
+	.ascii	"2\241C\034\030\027\b\302\345\312\340\2559\026\301\030\246\275"
+	.ascii	"z\315j\352\302p\f\243\0031\300\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.18.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\315\t"
+	.string	"\346\221A;0\345(\035"
+	.string	"\276g\245p\221*4\004f\036\366\264\2267B\230\276\326\032\224%e\271f\261\r\201\337\306\004\t\322\315\365\227BY\020\302F]\347\030H\260\203\216)\233\355&wJ\001-"
+	.string	"0"
+	.string	"1"
+	.string	"\234\307\355\005\234G\177\266\314gl?\313\250\230\325\354\256\324\215\177\207\237\177\221\007\270^\254\303N\303\356\032\272^\027\267\3366\202\355\005\3732\217\227\375\n\241\337\021h\201I0\331\265\250\005XZT\351\260}\217m8U/\n\207\366A\036\362]\266:\301.\f%ew~\374\331\036=o\020\032\303\362\201q\265S/\031\210\235\3065\343\210\223\250\266\335e\360G$&6\216\025\347\361\032=V"
+	.string	"\310Z\260fO\026T\r\373\233\335]+\314\376|\244SH\264)\245D\352\021\250\224\022q!\222\207:IS\307q\335H\232\036B\234\034y'\t:p\007A\362$\252\353<\351\231\373\315*\314\016.\264\226R8\352I\023"
+	.ascii	"2\241[\034\030\017DBp\217\222~\0023DE<\224#\230\312&-\256:\204"
+	.ascii	" \256\261\2550\036\250\006\256\200\271\001*\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`h\001\315\005"
+	.string	"\322\307\034&\240)\035\377\360\253\177+^\271\321?\371\203\373\377\337\262o{\326\276\375o\215lB\b!\244\331\2667\211\335r\313\024\216\360\321\304\274\247Yq\032q\032\035\315I\243\220[\217\303\264\315v\327\2762\216W\3318u}b\\Z<R\034J\374A|p\270\300\360@\341\217pg\335\201o\252\003\250\267\351*\235EO\311Z\354\333\027J\266\335]\350f\266Y\f\036"
+	.string	"`(\310\fg\3117y R\036\226\224\311(\3150\250\007\037\360\317T0\\\366"
+	.ascii	"\355\300\347\300\347\300\347\300\347\300\347\300\347\300\347"
+	.ascii	"\300\347\300\347\300\347\300\347\300\347\300\347\300\347\300"
+	.ascii	"\347\300\347\300\273\266\235x"
+	.text
+	.section	.gnu.lto_.refs.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dcabe39c893d3d8f,"e",@progbits
+	.string	"(\265/\375`\225\024\035]"
+	.ascii	"*"
+	.string	"\231\334!Q@\220\322\031\016\336\023I\354\322x\022\235\237yXO\031\270\211Z\016(x\245&\031eJ\351\205\022\fD\007\026\n\323\004\021\226G\021\211d\246f\021\221\177\362n\016\241\3311\027\266\217\003\245\373\264\250\242\334\336e@\323j\246\026\231\034\273\035\273I\231\002\301\001\b\002 \002\335G\340.\002\273\b\240XT5\204\245\350\027I]1;fW\024\233\366U\333\265\347 \255\335\225\203\306n\310\027\243&VD\212\316\240~Q\244\300E\221\356\227\005\263\353\211=\373\342\260h\3079\256\2752\223=0.F{VD\312D\365{\"\365=\237{\"\335ZS\266%jke^v\222jx\203Z\031/\315\017\2621\036'P\266\220\214\212\215\330\035n_\366\030}\013\352\r\033\266\353vY\257/\227\375\372\210\265\273Kw\177\257\200-\327\007#\210\356#X\230\335\353S\374?]v\313r\371\326'\335G\210"
+	.string	"\215c8\224\316\356u\204\003\016\240H\2568\265\024=\005\352\366\212H{V\250\377Q\377\355\342\302\351\032s\307\306\350\277\\\377f\355\225\335\362%\227\226\375\325\275\202\340\267\265%$\243\213e\263\354Zb\265\034h\305}\306\255\276\322\275\002y\336Xy\343\206\3217\240~\265\036\342\330+\316\352\267D\272\317-\221~]\021\251\272"
+	.ascii	"\244\026\030C\260\r\025Ec8?\243p\302\325\237_|`\342\002\022k"
+	.ascii	"C\002\376\331\342{~n`\205G&\034\370\363\002\377\022\211\206<"
+	.ascii	"\006\374+B\013&ha\340\t\366\221x>Ox\370\327\r\003\377I\240\351"
+	.ascii	"\374[\347\"\315\377\260\377`\351\277k\377\262\360/\214\177G\370"
+	.ascii	"\327\202\177'\3707\350_\b\376u\340_\006\3765\361/\211\177G\374"
+	.ascii	"\033\300\277!\376\345\371\367\367\357\376\177\376\337\373\357"
+	.ascii	"\374o\367\177\315\177\262\377b\377\211\376\277\375\037\376\327"
+	.ascii	"\362\337\305\377\265\377h\377\313\376{\371\277\365\177\354?\327"
+	.ascii	"\177\005\376\247\375\017\340\371|>\177\237\336\317*~\340\213"
+	.ascii	"l\334\275<\346\2071T\354\306\030=?=\237M\346\025\222\211\235"
+	.ascii	"^^\336\356\251m\022,\245%\275\357^\316\033\247[\036\243\353f"
+	.ascii	"oH-i\262\245lMzysxx\353T\273\333\327Md\214\251c\225\345\204\210"
+	.ascii	"\016_'\316\325\016bm\214n\233\234)q^A\302\240ZP\242\252\334\350"
+	.ascii	"\350\326N5v\033{\032\331\004\243\313\371\301\206\006\307\346"
+	.ascii	"k\3675?&lH\236\030\335\272m\336\200\242\267\334\302\241j\323"
+	.ascii	"$\303A\375\236Y4iv\215\272v\023\020\226\0166gGE\241@W\265$\235"
+	.ascii	"\334w\315\017\264b\233;\335$p|"
+	.string	"\240\031\301bt\343\266\251\343d\225\332k\346\240\303\fb\267'\366\203B\346\2411\272j\326k\310S\023-F\027\016\345\301cY\003\243\307\333\034\337\326\025<-F\277W\352\371O\373\350\324\335O8k;!w\2768\273(~\236\365m\002\377\321\366\t\020\245\333\307\335\235\n\205\354(\344&\372U\272\215 zm\247d\327\2241\271\305M\tbm#\003t\327\221N\256SJt\331\334ko#M)]H\256K\247\344\2724\3664\322\322\330\275*{\222_G\343&\273\246\224\311\256\245\022D#\265\261\273\216FT\244\2452\251\266T\366$\273\216\312$\322\224\022D\217;$WJI\246\254V\231D\352\035LRG\247\236\266\344\272l\270\356\375\302\321N\ttK-\235\340\216?\326\013\262m\007\262\313q\271kw\023\300\204\244Z6R[2\312\262;\nrF3\2510\256mm\265m\306#R\275\204\243\273"
+	.ascii	"\246n\343v[w\033\273\373\347$\265v\007\351I2\231\230\272\243"
+	.ascii	"F0\265\224\261\fG7\177\251\361\242LvQ-\177\312\274\272\230\235"
+	.ascii	"\264\032\227\331pSNj\227QK/\331\251L%\0176f\336\200Y=\252\232"
+	.ascii	"\254\300\23427R|0\272m[\346\353\266dz\335T,\273\217\353\006\324"
+	.ascii	"\013\274u\366\332b3\037\232\2356nu\323\217,\214\333\024g'\243"
+	.ascii	"P\350h\321\241\245\214\330\331\354\\\006\264\342rj\225)h\216"
+	.ascii	"\214\262\227\177\210Z3\243\033c2(H\272\2500z\024\251\376\001"
+	.ascii	"u\013J\251d\224\273\\\216\243\310-\3251\3127\374l'*\2153\t\207"
+	.ascii	"\261Q\275!\031e.\374\265\353\323\030\354\251S\324\332_\037\314"
+	.ascii	"\222\300\322\364\324\323\260OK\271\353\274\305\214\b\222\251"
+	.ascii	";\25604B\230s\352}pX\260\360z\246\b\323\214\222%&Z\347\325\367"
+	.ascii	"\344a\267\307(g\331&O\334\322\n\330Y\225*\234\265[\200\320\t"
+	.ascii	"\251\345\3211\3269\213\365\350\3264F\331\3126\227\313\223\223"
+	.ascii	"&\030\223\311SB\204\335P\332\263+!oP\316SX\212\032T\322\022K"
+	.ascii	"\341(\276\034X\356\310v\232\232\230,\331\206_U\363\213\030\266"
+	.ascii	"\201\237x\300\232\322\026Dl\035\001\234{\343\221u\245I\023\276"
+	.ascii	"\n\241\267S\004\254\f\231\223\363\325r\375\266\356\340\214Q\224"
+	.ascii	"(\341%9Ts\250\023L\323\022\253\363\222\237\351,\215$9}F\246\246"
+	.ascii	"\270j\243*\340\202\243\343\270\261\034UH\316U)\026\2205 \214"
+	.ascii	"\362\221-\242w\365\304(S]\016U2\346\320\341\353A\204\b/\307\230"
+	.ascii	"8M\270<\265)r^\2621\371r\226\371\222A\202\260\024wseQ\243\236"
+	.ascii	"\224y#\344,\025\206\207y\304mL\017\n\212\243\270\227\335\314"
+	.ascii	"\237\027\225\025\272\034\245\225\330\017\376q\216\332-\036qL"
+	.ascii	"I\\\234QC\246\256G\217&\036\342\236\322\262\310\270\211\233\370"
+	.ascii	"I\355\267\"L\037\332\222\333\025+\317O\037\222\256\224\3160\312"
+	.ascii	"N\333\334\271\301\356\255\315\232\001Rq\243\003\215\226\222\022"
+	.ascii	"3\251F ;rb\314\314,\235\2316\254\210\027&\214\262\216T,N\f\213"
+	.ascii	"Q\316\3619\035\2747K\347\023F2\222\223\324~\323\301L\353\260"
+	.ascii	"\304\2401\216s\222\207\267\035\224\316\030\345"
+	.string	"\033j\231-G\2600\312H\273\345\201\254HK\371\231\217\262\2545%l\fAb\r\032\3500HD,\036\2451\320\030*\n\026\311\030\n\2031j\020\r\r\205>\304\243\032>\002\020\021\325\030\016\215\206\277\"\214\240\f\302\243\324\206\021qF\321h\370[A(H\204\026\203GE\301\242\224\0304r1c\250(\264ABph(\364B\214\013t\210\305\020\212GC\243\f\210\305\020~2\206\302\340\bG\301b\f\030\204\330\001J\021\364\243\303\342E\f\241\340\b\036\210FE\241\241\260\210\030taD\f\2320\243(,\001\001\031C!\261H\002P\250(\244\001\017\021\221\220\003\025(\305PH\030c\270\201\f!\006A?\"\200R\004\375\354\260x\021,\n\211%\350|\250(\034z\240~HH\f\016\2032\324\253\bz \210\005\f\277\263h\021A\213\b\322\263h\361\363\323\"\350G}\320\217\217(4c\b-\302"
+	.ascii	"J\021\364\243\026?\343\200\033\321\b\022}\212FFD\037\235\030"
+	.ascii	"\303\240\357\b\306\n5T8J\211E\032\276\"\f\026\305\241\260\306"
+	.ascii	"\357??\031\230x\001B\007\352\020\004+\324P\241H(H,\036\371\f"
+	.ascii	"\215\212\212\214\206|\206B\241\"\237!\342\221\017\004%\316\316"
+	.ascii	"}>\365\234\300d\3272\217w8;\237\302\022\325R\2122\236\217\006"
+	.ascii	"\275\356#\3431\353\300m\316x\007\376\340\252$\217\351\235\232"
+	.ascii	"\324K\223\226\027\233\263\035\220\r\224\021!\2142\035\327\371"
+	.ascii	"\2500\303\342\326\313\255\201\3224"
+	.ascii	"\313\302(\257\3419%L\260/\237;\235\2233\212S\215\034\231\337"
+	.ascii	"\216,7UM\263\017mZO+F\313\234\317p\031V\343c\243F-\215u\025\234"
+	.ascii	"9y\304\202XY\2429\2539\307\001\255\3400\236\035gSm\030e\2704"
+	.ascii	"l\346\274%\313\031\2167F\371\355\314U\265\243\315\315\255\256"
+	.ascii	"\t\324\022\246z\324\n\314\031\0070L\006\270\324\275\324>\244"
+	.ascii	"&\222\306\374\240cn\n\211\2303\2313\333\260\312\313\213Q^;\223"
+	.ascii	"Y\331y%\325\230\354I\263\313\033F9\355\201!yF\364\306\\\211\233"
+	.ascii	"\023)\214\362\376,\3450LfR\2060\312"
+	.string	"h\237\343\351\242E\211\324\031:\245\006\201\276\250\261(g\0345#\"#\"IARH\007\321\005\204\030\346\030\332\006\022@&)\220\"\206F\210$)J\251}\003\272\300\223\003\363\277\027}I\262e\3611F\235\376\205\322\255\366\314\277\205\374\237e\345h\024g\350GH\356\220/\323\335I\016(\021\371zo\343V\345\374\b\362\203AF\006Y'5M\361\t\271\024\373Z\311\257\022\254.\220S\353TE\253\201v\376B7J;\257\222(~\004\347\360\342m\017\0041\2176\256\021/\260\276\247\311\356\334\002\333\005\002\356w\020\243\t\377\200\362\327uL\241\023\222\310}\215\220\200#)\315S2\366\020\n \234q\254\252\023\244\"a\023>k\261\031H\002\344M\t+}\321i\335\256y0V\036k\207\235\240\245'\346\004\345\350\237\360`k\373\276\034R1C\376\036n\177\224\332\260p\333\212\021\335\323\367\261\231\202f"
+	.ascii	"\214\031?\270\244\261\224)\261[\314\374\b('(\177\253\357v*Lu"
+	.ascii	"\222\305\310\310\350\237\262T\304c\250\"\350\307\367\313Rv%\257"
+	.ascii	"\201q\rX\235K\001.\037\322G)a\326\036\252\221\023\250\334\211"
+	.ascii	"z_\216'\353Y\271\361\323\212ul\370qc\300\020^\241\b\211\016\264"
+	.ascii	"\305\201%\314:\025\330\271\020\342\345H\374\352P\336\007\262"
+	.ascii	"\362E\304\030\\p\202\352\202\310\306\"\361\357\241t\233\271\321"
+	.ascii	"F\314A\031\373%1\n\337L@\374Q\363\034\331\200\361\331\200\353"
+	.ascii	"^\256\337\016o\270\237\335\331\326~\315I\037\037\004\277\266"
+	.ascii	"Gc\244\264\362=b\234\327\244\315\234S\204\237\202\3310\026#G"
+	.ascii	"\346\026T.w\214;\244>L\322\310"
+	.string	"\027\234\307\200I\305\234r\232)ws\303\250X\246Pd)d\035<p\3527\034\\_\325\"\002\341hF\b\350+A\337\241]_7\341\273\340\244Mg9(\334\2457\203\005\357\217<,\022b3\347\350\242\200\022P\360\272\257Y\367\224\376a@\202\b\251w\320K\020\350kJ\344\343$H\311\n\225v\034\212\023\201S\227p\332 (1\350S\202\3776\322\336\"\340q\345\\\364\023\001\353\276\342\371S\314\213't<\021\272\350c\245\206\361\264@X\346\006\311\316\f\202\305\342\334\314Ny\357Ib\323\252\236\374_\215\2023J\341\252\221\021\240\024\233<d\207\246\370\331\227\325\241\360\352S\357l\300\277\254O\276\354\3606c2\266\221\230\377I\324_.tn\030\350\330\340\257\201\337\327Q\367\213v\302\343 ;\300\252\3569\202}\323x0+\323\331\364\247\325\333\020p\327ki{\266\226\376nx\374\203\217e\313<"
+	.ascii	"l\201\256\331\030Wy\367\366\311\375#\305\233\224\001\350\347"
+	.ascii	"eK.{o\205GUOj\217\332\342ko\260\275\013\326\303\340\026\302\235"
+	.ascii	"a\203\201]\240Gk\371\b\333tu\207%\2554\205s\255(<Cgm\334\253"
+	.ascii	"\375\263Ef\347\334\200\370nx\252\035\246\235F\263\257\373\341"
+	.ascii	"\376\350\360\0056\"\332\221\361wp\316\336\305\215\302\351\005"
+	.ascii	"\261\213X\257\002"
+	.text
+	.section	.gnu.lto_.symtab.dcabe39c893d3d8f,"e",@progbits
+	.string	"sbufInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"sbufFill"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufWriteStringWithZeroTerminator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dcabe39c893d3d8f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
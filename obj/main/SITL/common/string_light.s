@@ -0,0 +1,490 @@
+	.file	"string_light.c"
+	.section	.gnu.lto_.profile.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375 _\305\002"
+	.string	"\364\004S"
+	.string	"\n"
+	.string	"\331\326\350:"
+	.string	"\001\271\377\365\344\017"
+	.string	"\002\354\342\265\376\013"
+	.string	"\003\343\251\364\236\016"
+	.string	"\004\311\373\264\342\016"
+	.string	"\005\202\330\305\315\n"
+	.string	"\006\224\203\353\323\t"
+	.string	"\007\272\201\205\261\003\004\002"
+	.string	"\b\326\214\367\241\r"
+	.string	"\t\211\202\250\341\005\002\002\001\002\001"
+	.string	"\002"
+	.ascii	"\232\033p\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375 ?%\001"
+	.string	"\2303"
+	.string	"\007"
+	.string	"\001\003\001\002\003\004\005\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.ascii	"`\b\030\007\006\003C\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`\006\002U\n"
+	.string	"\226P75P\245&\351\024\241\267H\200\310\353\320f\206\310\343p\021Z>\261\276y\265\374\360\032\352Hc\007~\3536Sw\317\314\254\334Z<\230\020]BO>i\204l\231\002+"
+	.string	"&"
+	.string	"*"
+	.string	"\226\353\364\266\321Q\313\335\016jU\243\315(b\303\003\241P\310\323\311\3150\201\341\003>\351\344\020\031v\367\302<\231\032\351\003\306"
+	.string	"\001\030\364\310L\202\033\303v\205\215\365^0\272\217B\251\274\346\317\002\341n^1\034+\314\314t\357\220\231\232\217\260\025\r\315\340\307\207\003\232\360\217\260\031\004\371p@\006K8\334\273U\020\177W\314\265N\033\212d\246\344h\fn2\023\201\001h\265\034\336O]\375%V\352\372]4\302\375\002\303\260\330\204H\370\315\260\211\021\n\211\202'?uM]\354\027\250\302\373\275\345\0260 \340\"\241\031\362\0010R\317\005ER\275\200\004@<\201(\n\354\257"
+	.ascii	"\333\016\352{\3122\270\351y\027\314\036\274'\267\301\226H\357"
+	.ascii	"\200\217,\246%\3040\003/0\312\210\202\273\r\310`\020d:/u\f\337"
+	.ascii	"\2742\244\242*\327\247\035\312X\034Zxy\341\213\363\2209\324\260"
+	.ascii	"V-\031\006\032\361.],\307{\033]\272\024\334\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"\305\003"
+	.string	"\262F\023\033\260%\351\f3\r\240\b\036\206\205\222\t\017\303\214\303P\234m\266\331M6\221I\006$\234s\016a\2141d59+x\006\266\262\357P\334\360\205/u\243\336(\276\222\216M\307{\245\232\317\213'Qf\007?\001T!\302\311\222_\261\023\021"
+	.ascii	"[Aa\255fae\247\2071\241\016\252J\245U\f\020\244\360\224E'$\030"
+	.ascii	"\002\306\201\301\300\0200\256\3128\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\205\004\b\204\004\t\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375 \221\365\002"
+	.string	"T\004w"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\b"
+	.string	"\001@"
+	.string	"\001\002\003\004\007\003\300\004\300\004\300\007"
+	.string	""
+	.string	"\001\b\002\300\007\260\210\200\374\267\214\301\377F\t\002\200\005\260\304\210\374\267\234\243\204`\277#"
+	.string	"\007.cR3R3"
+	.string	"\005.cR "
+	.string	"\n"
+	.string	"G\325\203\0131\215\\\325\034@\006\240"
+	.string	"x.\220\001\3670"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.f0a6c6b514dcd717,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isalnum.0.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`Z\001\305\r"
+	.string	"\006\232ZB \217\223\016C\337\034\315\016Y\025\f\370=\016\363\317\034\235bJ>\326a\246\307A\002\244\025\215\232Z[\037\205h\025'\257\324\2358( L\215A\340!\357\312\314\206@\352\016\003\342\215\220\275\267\224)\005G"
+	.string	"E"
+	.string	"F"
+	.string	" [\305A\310\363`\"\222j\331],s\002\361\360\035\023\017u\303A\217\360i\202\374\213\t\026#[\350\221\004-\f\177!\3276J\005\260i/\263\273G=I\266Qf\325`w\235#\333\205\273\272\355\216m\006\366K\002\256`:\376\344\177O\353K\347K\337\252T`Xv-t0\026\005,Q\342\217x\352\343\234\rp\370\360C\034\005\344\234\037\224Z@\354\3530m\220}\345O\254\342\313\256\206\016)\273\253\300\013\254C\333\276\311A\004\241\247\246\002\367\210Q\217\272"
+	.string	"\027-P\367\210\327\250O=#EG*i\271\273!\325\223/\327\210\251\371A\304\211Q\276p\200\256\353R\256\021\257\251'\225\264\354\374\364\372\025\221\030\242\354lNK=\331\177\253&\033f\232[\263\361\231\300\261\241"
+	.string	"\201\243\263\361|:\260N\306\341d\032\254\263\211\300\3014\236\016l\343\200\263\n\022<\330'\313<\330\305\211\256&'D\360|\t\256Jb[5#R\315\212$^\rX\221\241\322\243<c\205\205T\322\016\365\344_\271\335  p\"\"\254\036T\300\025\306\b\276d@"
+	.ascii	"z1\030\260\306\222\3574\205\203\246\374\226\352\300\025\310\017"
+	.ascii	"l\271\240E\316\267\254$\331\003Z8\211\3404\210\031\210\0012{"
+	.ascii	"\322\262\002$#\246\306\271\354#\252\031T\317[lz\023B\031"
+	.text
+	.section	.gnu.lto_isdigit.1.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"}\b"
+	.string	"\246P;5P\215\322\001'\243\252\252\244\003/\323\353\253o\026\036\336\026gA\233\235\001o\233t_\313T\326\360:R\272\252b\214\206\210\265=W["
+	.string	"d-\372do)S\n+"
+	.string	","
+	.string	")"
+	.string	"\032\"\246\220\224\335\205\231\023\\\177\356\002\327\237b|{n\376A\256A)9\241FOK\302\356:O(\212[o[c\033\301\266I\232\351\314\364-\027\216\201\221\335\211\250\262'\217d\303\366fc\362*\267|\331\265\310`\355\256\201\017"
+	.string	"\376l\373\036\377\330\354\226B\204\013\227\213\256T\325\233:\002b\214\254\213\256k\352%*J\031\355\364z\323\n)\243\275\032\245^\330w\273\273\326\324\273\352w\232\016\330\215mB\016\234\316\303\002\347\323\321B \370\311<\236\f\203\237\016\203\007b\032\bn\n\234A4h0\224e\032\304\254\366n5\3654C\322\222U_\013"
+	.ascii	"2\241\307\037\330e\002\202\212|l\206\307e\024\253\336\253\203"
+	.ascii	"\021Q\366\002\240\362t\332I\006"
+	.text
+	.section	.gnu.lto_isupper.2.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\225\b"
+	.string	"f\220;7@\305(\035\365\231y\236\254\235\004\222\347\371m=\363\301\270\031Lw\347{\364\377F\237\311\246(\313|\035\240\312eca|\221.\320\245\302\253&\204\252\033\331[\312\224\002*"
+	.string	","
+	.string	")"
+	.string	"\"\244\220\224\335\205\226\033X\177\356\004\326\237j|{n\376S\277\234\304\222\t\364\2540\354\256\263d\262\270\365\266/\266\027l\227\004\351\314\364+\327\250"
+	.string	"e\267\"\002X\223G\322a{\263\257<\312+\013\354bl\214\354n\202\025\002\376l\373\037\007\331\354U\003\205\343\b\357\340\037+U\365$\217\201\030c\352\037\353\232\372\321\205(\243\235^O\n\020\312h\253@\251\031\366\335\352\351\035\365;Mk\006\330\215a<\021\031\215\204C\206\243\321<\035\310\3116\233\f\203\034\315\303\006bZ\007b\020\234M@h\320\223e\032\274T{\267zzj\t\251\310\252\001\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_islower.3.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5P\215\322\001'\243\212h\217Op\222\335\272,J\017\337\026\374\312\321\333\021o\233t_\313T\326\360:R\272\252b\214\206\210\265=W\305\205\310\005\372do)S\n*"
+	.string	","
+	.string	")"
+	.string	"%\246\220\224\335\205\231c\256?\367\201\353O3\276=7\377 \327\234\240\234P\243\247%aw\235'\024\305\255\267\255\261\215`\273\025\351\314\364-\027\022Lkw\"\252\254\311\033\341\260\275\331\227\274\312,\007\354^h\210\354\256\201\017"
+	.string	"\376l\373\036\377\330l\226B\204\333\b\217\340\242+U\365\246\016\201\030\243\305E\3275\365\022\025\245\214vz\275i\205\224\321^\215R1\354\273\325\324\273\352w\232\326\f\330\215mB\016\234\316\303\002\347\323\321B \370\311<\236\f\203\237\016\203\007b\032\bn\n\234A4h0\224e\032\274\254\366n5\3654C\322\222U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_isspace.4.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`S\001\345\r"
+	.string	"\206\232\\B\020\221\223\016?B!\035\204|5\256\336\206\212xc\346\201\"\375?\221i\220.\212\fk[\2405j\037jj}\236h\257\037\200"
+	.string	""
+	.string	"\240\0200\001&\033a@q\211\013C\376\210\255\021B\366\336R\246\024K"
+	.string	"D"
+	.string	"H"
+	.string	"\246\030\273\213]\027\020\017\337\003\304C\345\360\317#|\232\037\277\201J\n\023\016\364\370\016\270\330\360\242\203+y\005RV\240\300*\303\037\211\206\023\245vp\241w\355\356K<O8Q&\345`w\235&\034\206\233\272m\3156\003\373\035\002J\262\317\362g\236\2664]i\232\312t\3144\314\364\313\264f:3\375\r\016\225\001(v/t3\266\005t\371`\373ck\362,>\331\332\325\260\242bw\025xAuh\333\027\361\021\037\373\364\200\344y`1\n5F\262{\207Z\362\257 H\204XyJ2\361\250\037P\237F\215&\016\250\021F\346)4e\356.Hm!\252n\300\234\200\021\245\f\247^U3f\204b\245\352\313u\237bF\257\2471r\teg\267\200RK\366\337\006\331\235yx&\200l(@"
+	.ascii	"\3216\035O\b\246m\034\316\226a\332&\002\007\313:!\230\207\001"
+	.ascii	"o\025$t0\317\266u0M\313^IN\210\340\371\022\334\322\023\333\226"
+	.ascii	"^#\032\252\242\226.\022+\375x\001\320u]\314E\"\245\225\276$E"
+	.ascii	")%p\032\005  \320\242\232\262\003t\001W\036\243\254\342\224\314"
+	.ascii	"\206I\324\312\315\233\220\212U\220\321_>\230\221\fv\362\261\032"
+	.ascii	"\224l\002\245\365\366\306 \350\203\331\341LT@3\2144\\\001\232"
+	.ascii	"'V\273x\242\016\246z\336\252\351M\020e"
+	.text
+	.section	.gnu.lto_tolower.5.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"=\013"
+	.string	"V\025L= Q\224\016\017T\240\301r!\202\227 \260\372O\023\027\223w\260\031\260) \225\247\265\374\226i\002[L\362\016}\003\b\006"
+	.string	"\034\tP\254\203\200\211S\nJ\370\003\b\002\372{o)S\n9"
+	.string	"="
+	.string	"9"
+	.string	"\235\0232v\327\252\016\211\207\357\003\342\241z\270\366\247\251\371\324\206\030\036N\363\327\301i\270\006\3408\257\332\335\223\236\037n\313|4\330]\247\207\313p\303\333v`{\201}\006\001\351\367\321\257O\377\001"
+	.string	"\006\201\027\273\030:\032\313\002\252\b\341\227\270)\363\222\r\210\030\221\261\251k6\225\037\371d\216\335\016\037R\354n\002+\3308\264\355\213NB\263O\017,<\020.\002\271\273\032\325\220\013\034\023\243\236t\b\n\221\211\025\234\234a\001]\327\221\216\211P\243\376\002\207-;\253B\275\351\bZt\235\032\233\354\354\322\226\032\262\377VA\266\246\243\246\341\003\327}E.\023$\023\n\020$\225Iv\261X\025\214B\301.\2532\211@\261\256\314bE\016\030\253 !\263.\030\226YTi\363\267\nr\246j\352\323\353G\253\215n\357U\367)\252\276\007\024"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\2345Y\022,&\316n\327DXMh"
+	.ascii	"\246\342\001\215MC\004\251\241'&\210\250p\003Py`\2668\224\274"
+	.ascii	"\355*z"
+	.text
+	.section	.gnu.lto_toupper.6.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"E\013"
+	.string	"\226\325L= Q\224\016OV\202\240\004/8\324\005D\326\234\031\003\027\036E1Ba\020\204\247E-\277e\232\300\026\223\274C\337\200\fA\200F\006(\324E\300\304\231~\222\\\301d\177\357-eJ\001:"
+	.string	"="
+	.string	":"
+	.string	"6>*:v\267\222<\022\017\337\t\304C\r\361\354O3\363\251\0161@\033\347O\300\306\341:`\363<\311\356\276\364\fmZ\346\303\301\356:A\333\206\033\336\366\003\333\f\3547\b\360\351w\322\257O\377\001YQ\340\305\256\206\016\307\312\200.H\370(n\332\234\363\201\023\035\033\233zfSy\222O\016\260\013BD\213\335U\340\005"
+	.string	"\016m\373%n\"\263O\0200\274\021\001\234\366\334]\216\352\310\006\256\211Q_z\204E\215\0240<y\303\220\256\353>\\\023\241F}\006\017ZvV\205z\323\023\314\240\361\311\321\311\316\346\264\324\221\375\267*\2625\0355\035\326mM2\025(\025\013\021(\227\n\226\301T\227\313b\271\254\352R\231`\251,\fSM\020\370\272@\001\2532\327\205U\024\327\371[\0259S5\365\3515\244\222\216j\357I\270OQ\365\335\001\023"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\\V\371\023g\241k8\254&\n"
+	.ascii	"S\361\200\306\246!\202\324\320\023\023DT\270\001\250<0[\034J"
+	.ascii	"\336v\025="
+	.text
+	.section	.gnu.lto_strcasecmp.7.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"u\b"
+	.string	"\266\320;7@\345&\035\365aQ\034\003\234\230\177l\343\006\241\275\027\273\\L\317t\343\307\330\214\262\321F\017\362b\353\371\204\313\312B\232\fM\007\b\016\\ !`\373do)S\n+"
+	.string	"+"
+	.string	")"
+	.string	"\0018Xjv\367uN`\335\265\017Xw*r\370\204\376W\336J@ZN(\3233\240aw\235'\224\307\255\267}`\233\3016M3\356\205\304\366mC\233c\253d\026\236\366S\256\002\037/.\260\233Bq\331\215\bN\330\3349nl\373&?\2016\214\203F\033\t\360\216\261TS\355\n\213\374\251igCMv4\245\206\330o\273\273\326\224\235\351v\325\257\217\177\272\317G\301j\267c\005`\003\nY~\2624\310S\222\b\211&\036B$\021V\312\036\351\032\215.\320#\211 F\017\204e\317c\340\213\"\002{\245\353\302\036'\356\355\246\035\f\315\260\313\013"
+	.ascii	"2\003\202a\365*\020u\031\033\030\001\343\3000\201\212\fN\364"
+	.ascii	"\250VL\302$\003"
+	.text
+	.section	.gnu.lto_strncasecmp.8.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`\251\004\035\035"
+	.string	"\206t\266J\260\226Q:d\312\277\236\217\230\247`\233\374q\235\ff\223\265\001v\356\331\034\021J\355Q\003\335\3700\373\177\262c\313%O\243\254\005\327]\330\377\204\322\237\322\237\360l\020\3200\360g\330e\311\037b\033\005\362\t!\204l)\223\f\243"
+	.string	"\231"
+	.string	"\236"
+	.string	"N\033\262\020\354Hr\340\274\373\246\353\250\275\307\3411\265.5\tk\355\r\330\002\345\305\355\225\307\361\034\265]*\332c\241\273\022\256\350)K\255\025\206\363\327x\221~f\274\330+jL{\337\026\327~\266\314\222\034E\332\\\333'\330Y}\320\t\375d\2223\001\264q+G\305\321\356fRI\027L\221\020\361\340s\230\344\220(\273\270\262r\340sf\344L0Y\342c\321\324\215\305\226n\304\351\213\316\003\305\021\236q:\"\356\003/*\355\254\2448\332\235\311\006\265\326\345\017\272\243\257\313w\367jw\035\354\322\f\001%oM\311\373\"yiH\336\231\222W\246\344\215\201q\275\270\334\351?\277\343o\275\367\233\377}\313C}\311G}\307;}E\222\227\216\274M\362\362\310{"
+	.string	"c\325\222\233'\265\212\030j\251JD\251\030\377\375P\177\324{\367UTS\301\037\227\332=W\303\203l"
+	.string	"\0337\202\027\002\035\310\222B?\356\003h\367\324\260{^\344\335\332\236\307{\034\270gT\020\255H0\225\310\027\202\211\001T\320\353-g\03251\252RkO\301\177KU\n\345\312\237\022R\225Z\253\316\305MPr:w\365\314\207E\3237\355\242RITnLd\363\212\234\366\21496o\231\332\364\205\227i\356\233\306\021\271L\177\352C\036\32321\375\252n\212\241\311~y\"\342|\251Fn\233_\021\n\311A\233\267"
+	.string	".\033k\372\302\277\2008|G\2108k]\303\341P\307e\343\253k\372\267\023\266W_\352\002\234\f\337\334\375T\264e/d\326S\276\330\007\215\027\337\364\t\267\033\342\341\356|l\227~\360\342.)\311\255\206\215\207-\005\005S\226n\336n\317\306GPbH\213\355\245]\222\367\206\344\265\t;\264\030\0205@\213\001Q\t\367\271\001\032\357\320xc\004~*P\340\271"
+	.string	"\201\202\017\317\354\207\006\363\221\365\364\310b0\037\236\b=\260\330\214\006#\220\2632\f\023f\260\037\231l\006;{C\357\245\345R\347\334\322\371\2037\227h !]]\2267\272Q)\031j\333\331\274\r\232/f\024\031S\270\325d\343\036|\253\006\215&\323\245\037E\006\0226{l\334\201\027\200e\302\364R>[l\334v\360a\321Z\373\206Ql\230>\360\324H\222\325\355D\017(*\254L\013#\rG\201\300\342\273\"\342\254w\221\335\357J9>\2001E\244M\323\270c\250\221H\003\rR\244DD\202\004I\222j\f\240\002\231\262\252\016\020X\250F\223\244\003"
+	.string	"\360V\313\246\267@ 0\004S\222\234K\ry\317\272Dv\330\271\221\331\347<\340D\230\214zepw\020\363{$hn\263Y\326l\251\357\\\243C\206\364\023\177\202~\321\272a\026i\001\311y\360\306#QC1\317.\301\340\007\032^?9}Q\317\361\fj\nH\316P\335\252\017OD\341\301\370\223JR\227\203<\rw\365\256\342\26066\314U\273\246\223n\235r\254"
+	.ascii	"A\034\240\220\235\370K\0258\213V\020\0275\bV@j\214\2159\362!"
+	.ascii	"\214\205\007\252\314\347\266\007fQ\364\270\275\367\273:b\241"
+	.ascii	"w\034b\216C\277\211\2124"
+	.text
+	.section	.gnu.lto_strcasestr.9.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`\342\001\375\021"
+	.string	"\346axH\340\322&\035\222\353\270\351\237\250\237"
+	.string	"\307\020\363\371\001\203\221\030\036\215|E\344K\320\271\021\212!\337_t\217\356\333\024\301\272\230\273\275\264i\r\"\214\261\034\243\252\312\354r\302y`Zl\237G\314BjM\032\331[\312\224\002d"
+	.string	"_"
+	.string	"a"
+	.ascii	"a\002+\350.\257\342+^\034+\020\206\250\271\221\211\231\033\322"
+	.ascii	"\234\341\347\360\003\270\313\356#\334\345\202\360j\354\\I\306"
+	.ascii	"\325\230/;\027\340\204\315K\"\340\314\003gTJ\0264bn\b\201\034"
+	.ascii	"\036\343\t\317\216\b\0210C\334\036 \242\337\2564PF\367\004\332"
+	.ascii	"\\K(sN+\rXsw\267\215\3016\004[\t\004\2729\366\031\330\2301\302"
+	.ascii	"[\263C\274\333\376\323\177n\323\303\277\263\232\273\355\226R"
+	.ascii	"\035\243zW\255\253>\200\006GH=\f\370\230SC\022\220Y$c\350\374"
+	.ascii	"\347\267_\374\233=\367\334\347\345?\226\321\3116t->\350\034\315"
+	.ascii	"9K.\215\322]\222\304\217p\341\016\007\252\267\271\\\300\2345"
+	.ascii	"\033\2149\003\013.\327\333\031\212\2305\322\321#$\343\312\rY"
+	.ascii	"\232\017\334"
+	.string	"\360\354\304\315\361o7\325R\274(y\353\250\247\225K+\371\256\313\007\207\214\376\260\247\272\335\312\265YVz\232]\222\331\312lZ\335\023\234\2418\347\234\2739k\332\273\230\t\002\243I\356\264[\333\302KO\363\375\355\277\231\325(\222Y\231\035\312\002\254\224\004VL\265PH\245X\034\013*\005\366\272\220\242\322\031e\002SQ\255\264LP\261V\\\260\327\307j\255V-\324\307ZIY}(\327\3533A\340V\205\224\353\203\265Z\256\317\363\374\326\"\030\331\200\206\244\037\343\034C\226\343\326(0\033C\202\373\006y\250\021\225\256\342\342>\310\341\007\251\250\2729\347K\370.{\202\303\203\326\001F\223\034& `\002!\204\331\001\030B\270\335\200\311\252\335\266\343>n\277\006\337\002\327\230k\025%w\301\254\241\027\265\305\235.\003\323\ruo\335u\374\245\213,JEB\200\3750\031\305f\355\\\251\246\357\202\307\0133\216"
+	.ascii	"\n\370\237\201\217Z\222mU\036\017\243\031\335`\233\006\232\274"
+	.ascii	"{a'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\r\004"
+	.string	"D\005)\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\007\002\177\b\003\177\t\004\177\n\005\177\013\006\177\f\b\177\r\252\331\2276\232\007\177\016\t\177\017\252\333\342\001\n\177\020\377\037"
+	.string	""
+	.string	"\200\200\200\003\b\"\003\t\n$\003\t\242\001"
+	.string	"\022"
+	.string	"6sxmdn\216\351\266\324\t\202\341\262'\025\002@,p\034d\2412\204\001\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.ascii	"?\\k\216\001"
+	.text
+	.section	.gnu.lto_.refs.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f0a6c6b514dcd717,"e",@progbits
+	.string	"(\265/\375`]\013\2059"
+	.ascii	"\372fH\026Ep\334Q:\221\202F\024\245W\307\002\3575\310\313\036"
+	.ascii	"u(\267)8YK\240 tyJ\207\240\366/\214u\327\017\265\224"
+	.string	"\362e\037`LF\366@G?\264\205,6\204(\021\333\206\377\213\\\037\250(o\261\277\224)+\001F\001f\001gbL\257\206\221\022\327\253\331\264\220'\223\230\245\255\272{\361\234^\311\033o\\\367\313\202Y\263\247\355\331uHe\332cDa`\220\245q\275\206\363[\366\004`m\341\003\316\273\330\247\351\226K\316\005\034\027^/\333\345\313\345\337\261%;\357\2306\263;-\332\261EA\213\272\212\264\003tu\005\350\304\212\250\340 \222\244\213xg\200\234\344\340\272Z\226\371\r[\260\256\322\335\033Va\331]\334\260\"\270\356b\321n\322nR\235\262\245\204\213\256\336\350\3747\313V\3314\207Z-{\254;=:\321\224\025op]+{\345\013\026\313)Xx\216\b\226V\351N\213N03\334\270\236\317\357\002\335\306\355\002\335\323\035\240;W\200\356\177\330B\270\360\237I\"\351\377\320\317\036\376e\372\217E\301\317"
+	.ascii	"\226\002+\301\371\341c\347\315\r\235\264\263\177'\324\177\267"
+	.ascii	"\260\351\376\245\362o\204\177\033\374[\340_\241\377p\377\371"
+	.ascii	"\374\177\373O\347?\333\377\265\377\315\377g\377\311\376;\370"
+	.ascii	"/\342\277\330\377\364\377\321\377\264\377Bqqqq\377\"\377\r\361"
+	.ascii	"\363P\004ML[\331D=Dm\306p\301\352\323\312\254\007\2743?kD\256"
+	.ascii	"\377\246\3716\217\026\240[A\021\326\220\344\221\353\365\034\355"
+	.ascii	"?\257\3468\243\322\344\272g\276h~\236\320\025\264\2525\256oq"
+	.ascii	"n\231\257\231\237\267Dh\250\265\341\372\025d~^\200;It\034\341"
+	.ascii	"z\341y\024\347\371\327u\021\331\3356\202\322F\032\003|\203v\037"
+	.ascii	"\374C\233[\006\377k\347N\304\325}\305\226\347dRV\304\342\372"
+	.ascii	"\037\251\243t\023\217:m$\312\324\"\242am\222Gi\007)\320L!\215"
+	.ascii	"\246Z\311\272l\356\264\267\217Z\311\024h\272D\242\351\222h\324"
+	.ascii	"\307%\261;M\032\241cE\342\242L\255$\312\\&\217\372\330\304f\026"
+	.ascii	"\203\234\307e\022M\263L\032\241\314b\022=j%\217\254\330\266\220"
+	.ascii	"\240o\300\224\313\006=6\215\253\254\"\322H\rM\227\315\326\275"
+	.ascii	"cU\215d\320\235\265D\262\025w\254\231Q"
+	.string	"\215\206\321Kq\271iw\037\2702n-\373\250\2066Yv71B\365U\005b\252\326FV\215($\253\255\252\272\021t\332}\325M\334V\353nbw\357\220Yiw\017#\324\353\352\252[i\340\252\263\210gU\335<&\307,\2112\267\226K\001Oxg\342|9\371q\336:\007\241`\201\265\210\232t\305\251i\205ux\2025g\t\304\007\326\220\236;O\264\270r\017\236\r\030J\314\320l\2750[\362\325\031\311W\274#'\307\250\215km^A8\334\272\350\260q\336q\326\261#\213#\243\215+\347\300\3017\222BF\302\304(\267\024A\0014\343\rW\256\30148G\24031\020\317\310\341\371\320V5v\306>e\177\372\264R\371@\347\2038\366\305\307\363\214\263\214\323\007\227\f*\\9\306\0315\202G\f\205\301\350\317\343}\265y\t\244\347\344\252\b\354\343O\020\270\027\\m\272\234p\345=\232\216\215"
+	.ascii	"\310\266,\341\301\225\213\273\245F\261\316\235\r\223S\263\265"
+	.ascii	"f\344\312\035\027g\341\374l\363("
+	.string	"\013m?\272:bnP\270.\240?l\362|\371\344\331\346\221\022%\266M\225\235i\343\272{\364\234\261\363}\263\263\315#\024\3555[\203+\315\035\26739_:r\266i\004\207\206\250\b\031+#\327m\233C\266ln\266yd\205\022\277\354\224,\273\312p]8\373f\263\254\371\256\255\331\246Q\036\264\255:\327\375c\314\353\354\001D\210\031\327m\263\203\343&\r\214\353\262\t\302\2721\247\211\032W\0325o\\\277T\316/\223\363+f\307|\321\276i\377\232-\3326\253r\003\303\237/\027\005\004n(\021\364\353E\005\207B\335\241$\020\b\016\205\301\241\020\300\241$\b{&\250\242\234~>\245\240\220J\251@T\024\325\357\007\374\355\246\244\234z\302&\247_p(\024\002\016\201\303]\317\251iJ\250\002\030%\364\355\202\275\251)*\241o7\024\376\200NAC\337\223\317D\322\201S\275\240\322\020\b\f*\t\251"
+	.ascii	"\006\241\206\300\337\356DS/\252\366\202TSU\212\352\027\325$\364"
+	.ascii	"\355\356\344\013\366~\275\247\363\025\230\"0aX\261;\206\f\023"
+	.ascii	"2L\320\035C\206\245\245\fLK\347\231\226r\303\022=\026>\241\356"
+	.ascii	"KK\034\220F\200\360p:I\030B=\371\242J<\375|\301\241P\351\007"
+	.ascii	"\224\222\002:)\375|MRJNA\241\222\004\244\032l\202rB2\321\373"
+	.ascii	"=\371\204?\252\241(]:\263\032X\304\270r\023v\362\243\361\223"
+	.ascii	"\224I\244\006\316\033\266\262s\305n\217\306\204g\360\226p6\240"
+	.ascii	"p\345/f/^r\376b%\001\216)\177\325\356\342n\022\321nR\020ZWQ\213"
+	.ascii	"\256\236\311x\310\231k\bw\345\336\214\332\330\355\265\rc\013"
+	.ascii	"\035%n\215*\037\f}\351!ei\344\334uNB\301\302\206\031\242\201"
+	.ascii	"\246\265\207+#9\221\262\031\306\355\b\243L\2060\241p}\204\023"
+	.ascii	"LG2Y\204\211\200\3618g\361\340\255\017\335]\340\304\004\200\314"
+	.ascii	"\250\2614f\22433$\"\022d\024$I\016\260\002\021\031\263\325\001"
+	.ascii	"\021p1sHDf\246$\345\221V\003Qx\335gn\223\307<\345\020\323\207"
+	.ascii	"\206l\275\245\034\350\177\270B\341\b\237\250U\031\2224\244\020"
+	.ascii	"\213\024\274\021\017\227d\347\311 !jB\303\"W\262z\031\321c;\355"
+	.ascii	"?\301\376F\023r\267\305\250\303-\202\242\206>\r\020>\371\036"
+	.ascii	"\272\220\234K\351'\301\037&\375\272b\341\316\032\261<\27414V"
+	.ascii	";\341u\302t\274)bT9{o\017Zf\274\023O\031\305\376>*\020\2554\245"
+	.ascii	"\235>qcr5\365\331\022B\352U%\026\356\343\2208o\330\346r\005\311"
+	.ascii	"\256\220\311\241\022x\022\304\201H}\205J\235\325X\312\253\246"
+	.ascii	"\224(e\r\247\256^%\224\376?\"\234+Q\t\245\377\217\b\337\370\267"
+	.ascii	"\363(\255\364\177\236\315\331\235_\245\270\243\362\017SWYk\360"
+	.ascii	"\272\347\023\017I\327\241\347f\375\021XQ\316H\356\342\002\225"
+	.ascii	"\237j*\277M\243W\375N*\241O\324\b\034Lg\311\214\330\376\r\013"
+	.ascii	"\236TN\302R\016\314\240\020\201\246.\025\277\r\350\200F\225\013"
+	.ascii	"#\361`<\230\360\32106Z\0131\001B\230\356R\332\237\213\211\017"
+	.ascii	":p\267\300\331\036S\241\t\342[\275\325xyk\355l\321\272a\361\033"
+	.ascii	"\314\271m\336+\017\023\177c\301\020\341\344\372\022w\373\362"
+	.ascii	"\017<b\233U\267C6a\231'J\322\342x\212\017J\211\006\242\233^q"
+	.ascii	",\377\004<.\0203\345\314\331r1\312\353\210*"
+	.text
+	.section	.gnu.lto_.symtab.f0a6c6b514dcd717,"e",@progbits
+	.string	"isalnum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isdigit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"isupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"islower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"isspace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"tolower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"toupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"strncasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"strcasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f0a6c6b514dcd717,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
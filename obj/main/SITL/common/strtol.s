@@ -0,0 +1,324 @@
+	.file	"strtol.c"
+	.section	.gnu.lto_.profile.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375 Bu\001"
+	.string	"T\0026"
+	.string	"\004"
+	.string	"\356\251\224\234\013\f\002"
+	.string	"\001\002\001\001\245\345\200\302\013"
+	.string	"\002\256\272\324\254\001"
+	.string	"\003\321\312\313\372\t"
+	.string	""
+	.string	"\002"
+	.ascii	"\271\2046\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375 \207\355\001"
+	.string	"4\002{"
+	.string	"\004"
+	.string	"\004"
+	.string	"\003"
+	.string	"\001\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	"\001\003\004\001\200\f"
+	.string	""
+	.string	"\001\201\002"
+	.string	""
+	.string	"\n\002\003\001\n"
+	.string	"\n"
+	.string	"9\207 $"
+	.ascii	"\0266\312i\250\270(\221vW@\213A'\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"=\005"
+	.string	"\"\212\037)`e\222\016PQ\226\277\210\255\031\f\002*\bx|\375\323\025\350"
+	.string	"`\202\210\024q33\210\212\035`\361\200CR\032\2212\005\377s\306+k\372\t\355\277\366\225\273\263|\237\216Zw'\230\254,\376\003\206x\321\251K]J\321\321F\343\341\274\247\r7\330\325\311\204\n\3672zw\227\366\017V\n\340`&\201\222\354o\331\237\224\306J\370\007~\371\325\332H\333\2040"
+	.string	"\220\210\364\347\247\231\b\017"
+	.ascii	"\001\023\307*\202)\013\364\221\310C\031`\020,\346\026cc\253F"
+	.ascii	"\300\324\013`\036\3160\250L\313%\214\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\275\003"
+	.string	"\222\206\021\032\260%\351\f\243\034\340\b\036\206\205\"\2355I\034;jy(mkj\023\231R\036\207\022t\241\220Z_\fH\301\362\215N\2731\244\327j\300_\036\361\207Mf\330D\241\367 >\310*i\322\326\324N\376\307\361A\022"
+	.string	"\030s"
+	.ascii	"\346\024vlo-\033L#\0253\r\310\301\305\n\005\351\242\232\215\021"
+	.ascii	"(\301\034\230\331\215\244\bv\223.=\005'\205\025\r\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\230\004\002\230\004\003\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375 _\365\001"
+	.string	"\324\002S"
+	.string	"\004"
+	.string	"\004"
+	.string	"\370\007\274\007\374\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	""
+	.string	"\002\001\003"
+	.string	"\374\007\274\007\240\304\300\377#\002\003"
+	.string	"\005"
+	.ascii	"U(\204M_V\225\227\335\b\033h\003"
+	.text
+	.section	.gnu.lto_.lto.d97f9ab604fceeaa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__strto_l.3.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375`-\016\005M"
+	.string	"\332\206\204\035T@\020JJ\007[+\307r\311\340\2623\204`*\375\016\267\325\236\303x\373\375\343R\373"
+	.string	"\330|\250\327s\206\005\006Q\323\234&\030Y\034(\207q\214B\334a&\367\214\315\007\322\001,\377\271\b\251\314=n\357\377\377\333gUU\273L\234\375o\215\020\222\244\224\001\315\001\240\001\302\001:\2647E{Q\264\367|\357\337\333g/7\360$\214f\300\271ZK\230\233\242jA\231Mx\n3\025f+\314h\314i\274\313\314]\037\357f-\367\300U\370\214\227\254\266\276\264\3052\324\nK\343\201\266X\236\230\322\234\300J\007QD\020l0\2514\037\240\"\034\276VdX\332\002,Zd\361\024\341Y\275dx-\233\265\222-1\272QRv\355\374\325 ,x\301x\357\362\016\254\314b\036vmy\265\202\311\245\325Z\231\266\305\216\321\341\271M\306\001\\\0237\217u\3005\265\0369K\253\225\214i\225v\2142\024\026\313\332\305\242C\346B\327"
+	.string	"c\3062(j%sZ2\016\246\214\356\030\2302\372\026\026g\317g\361\221Q\021\321\220P\320\020\350G\350\323\303\263\243\223\203\023\274\001\332\324\374hfdb|=\336N\227\242\347;k\231F\313\t->Z\262\321R\r\255\213\316\230\350\314J\017Ua!*\314*\035\324\003\017O`\021+[\330m\253\207S\305\026\031\276\2464\320\017\226\021$\304\242"
+	.ascii	"\353z\201\205c>bQ\272\307m\013\n;\331\312\241yvp\270\241up\340"
+	.ascii	"\234'M\032'\355b\302A&|\223\303\222\006\006\331(\351\232\207"
+	.ascii	"\020\303/\211\013M\023\226B\317@ \307\004XW\030\313 Q\350\030"
+	.ascii	"\244\223\255\023\332g\244{\247\022\222\210!\354\266\025v\006"
+	.ascii	"\213`!\t\346\271m\0259\207AN\266\276z\007\326\345\305\272\036"
+	.ascii	"\027\021N\213=.c\032T\262\026\266A`[^GO\335\007%0\231\341\372"
+	.ascii	"\340\204\212k2\217\\\304>c\030\302g5n#/(\337\250p\r\341\326E"
+	.ascii	"\325Z\267E\340\352\342E\342\335n\333\335\036\273\276\265\004"
+	.ascii	"|OT\346J\030\244\351s(\321\237O\317a\214C~\274ki\324\321w\030"
+	.ascii	"#s\211\243~\376D\226F&\020\314\035\206\211\335\223\353;\033K"
+	.ascii	"\231\205\251\356L"
+	.string	"\b\272,L\003\370Q\346\004\374@\200)r\020\314C\024\225MQE\367$\026f5\336\035\261\246E\253\303\330\270\311!I\3173\3512?\372\216c'\237\367#\021\313Y\230~i\025\016\206Z\205X\036b\275\354j\325b\344\022k\220f\251P\235(\321\254*\324\244+\273\353\205\031\271^Z\204\232\304(\357A\037\264\004i9\364\311e5\246\021\206v\006\276g\307x\322\217K\374\317\200\013\322q;\323\375]*\036\315\"\374\303 \327Z~\237\2170\312\001\351\271]\376!kI\325n\311r\007)\243|\264\254\355\370\005\344\254\265\326s\2378\351\f|\207\t\361M\312\f\304\236\273\331\225\017\270\376\344.\231VC\271\020\327\334\037\331e@\327\213\203\311\230\025\270\301R\230\023@\300\306\256\267\306\256\227\006\243\361\036\300Sx\r\230Q\200\024\363\300\034E\300\256W\006\2171\307\320\365\302\320\365\276\330\365B\t\340\242E"
+	.string	""
+	.ascii	"\260xZ\341\324\304<\3602\251XRJ\352\365\"\365z\217\320^#\264"
+	.ascii	"\267\b\355%\322\365\016\351z\205\330\no\020\247\361\016\201\320"
+	.ascii	"\336\037\264W\210\366\372\274\267g\327\313\303\353\335\331\365"
+	.ascii	"\352\234\2759\272^\034]o0\355\275y/\360\2756\357\2559{\177h/"
+	.ascii	"\r\332;\303c\2742\357\215y\257"
+	.string	"\357\354\355\235\275<\246\302\273;{\003\327)\322a\251|3\223\343Z+1\347\246\3057\270\273\213\247\240\263\370\221\350e\\\336\354\006\207o\372qo\226\276g\020\350*^pU\232sf\202$\347:\255%\361\255\312\027\020\356Zk\021\007\2072\212q)\274\361=\177\\|\307b6\b\371\261\361\240\037/f4\023r\223g\2109\030\227?\b|\370c\013m\334g\304\023\343\362\307\306\201\230\331\210.;\240\005\203\347&\037pT\013\215\370&\005\007\234\033\360\034\342\021\301g\361bIq\316E&\323\203\347q\235)\337\314n\270yru]\220\274\030]#\365\376I\275e\244\356\353\202\354\305\370S\324\031C\r6\273=k\242\376d\302\217\335x\351E\206\265\360\316D}{Qg\372qO\236\322\333F\352\276%\306j\244\376T\374\315x\257\t\233L\0017\226\030\233\221\372\236=\245/\375(\304H\351\315s(\263"
+	.ascii	"\177s^3\312y\300t\340\261\212\\)\"\211=\007|\222\265|\331\262"
+	.ascii	"\371\221\246\021\302t\330\262B\315\223\\X\3513\356\200\227\031"
+	.ascii	"\277a\021\373\271\331\274\237\250\261\371\275\346i\331\357\272"
+	.ascii	"24\211\016Yhh\316cJ\270\237\247\371\303\030\207\270q\324g\316"
+	.ascii	"\0033gd\366| \3360\363$0Uz\001G\211,Ql\"& \221yr\241\210y\217"
+	.ascii	")\271\370\276;\025\323\273\357\350\332\226,%\334{\272\306)\r"
+	.ascii	"#4c\236\\.\202\323\267\362\213\022\356\211\225.u\024"
+	.string	"L[q\006b\f\\\2216\337\n\256Ju\277R\242\373\257\\a\2534\364\236\334f5\006vySr\t\322q\3543$\312\023\236.\2003\033\267\370\221\325\270\306\013^t\001WT9z`\340#M\257\246*\320!\201\005US;xT\031TaM\361\240\362\261\303\252\342QE\201\004;vXaa\240#\206\307\224\005;~\240T?\246r\234WX\027P\340\203*\275\302\372\361\325\321d\201\025\326\025\326\017'\037V=zX\351p\362Q5\325\303I\307\325\017\247\246\236\265\272\200\352\312\t\313\312\352\312\311GV\271h\305\333\b\307a\300\370\020\310\211\347\021\322q\\Wf\224;:\322\3170\305&V\374\bu\202lc#&\363`\200\"G\364\342{\0169}\305\217P\224\320\244\350\311%\372\221m\241\235c(\240\260\005e\325\027?\032\375\252\350D7zg1z\275\270\323\213~'\214b\t\234\3500P"
+	.string	"c\374\201\330sCO\266\320\217\260\261"
+	.string	"g&\003\233`V\370bD\020"
+	.string	"_\216\363`\213\0041H\324ZyI\022!O\220Q\274\216j"
+	.string	"\3432\344q\361\005\266\270"
+	.string	"?.\017\213/\360\351"
+	.string	"\374\270'O\323u@\376\302N?.s\220*p\035!6"
+	.string	"\r]\350\b\374eE$\324\207\232\036\274\320\271\313\310\\\321\tT\\\323\207\037\031w\361\033G+\260)\337\314\022\270\214o\033\345\200(i\252\305\t\177\316H\224p\302\373\374\347h\231\321\313\200C]\370t\315(F\3549\237o`\244\315\310\\&\234(\242\005\237'\367\2007\035\211\204.J6\025\267\361\b\214\234\365<\271\275C\343\255\203\304\302\224\227\310\340%\247\306\241~dz\317\031L\331\006\365\236G\360\365\266[2-#O\022\026\246<\247\261s\236s\332\327\362\\\262Z\265v\264\260N\272\363\245\021\244P\262\rY'\315\371\316\331\204/\263\326\3414\026\246:\257\361\007\212\200)\"s\002\201%\250a,\003\rcH\031\222\021\221$I2\034\001\005\304(*\245\274\r\021`\271SY\223\2441\337"
+	.string	"%\022\003Aq\363y\341.N\026\307>4q\357T\0165\224\007pu;\020\325C\325=B\026;\371eP\277\031"
+	.ascii	"\205\302@\217\272\317I\226\340{Z*\314\b9Q\271FN\023!\320!\367"
+	.string	"\322\016^\257<\231\035_h\2074\350\231\357\224\235\033P\264\334\332I2\r.\355OXc\330z\346\366\0346/\003\225Ac\210{\330\330E\212\003\rpn\b\242T\3370\006\025\223\035\031\324\332\225\262b\264=\271\354Z\240"
+	.ascii	"?\252\215Q\261\331n\246\227Ue\302\261@=\rH\346%\366\222\250H"
+	.ascii	"\0263\026'\3579\336>\323#\3503\226\210\274\210}\207\036''\016"
+	.ascii	"\324L\234\211\316\207\321\261J\363\331`\2142\020\315\322\200"
+	.ascii	"\t'0\207$\361W\220\234S\251(\336\274\301j$\034\217\237\026\212"
+	.ascii	"\3141\331e^7\216\204\350\3408\300`\025[\333\013;\206\350\006"
+	.ascii	"\004\360\347{\033\bq\277\371\277\214{\337\373\200z\317H\223\340"
+	.ascii	"(\b\262\371\314\f~\3570\273^+]\333\350:\222x\205I/\006\367BZ"
+	.ascii	"\356euq\206(\205\341U\253\370\320\217\222\005\032K\260\233+\005"
+	.ascii	"\270$\350\277+\2315\030\317\001Sb\347\374q-\312x@\274\004\206"
+	.ascii	"\247\361\322\021\264\2412\004\177~\003ZI\350\275\260\277p\355"
+	.ascii	"\030$f\ti\027)&\340>\f\327\"V\371b\215|\262\346}k(\314\207\227"
+	.ascii	"v\254\230\\\027\346\204V\201\217\251\335)\245ah\325\306\201\023"
+	.ascii	"\350\005\312<vd\021\244O\3771\f\003d$%\301\320\254G\b\017R\002"
+	.ascii	"\316\260\204\212\316\277c[\266\336~\201_\361\277'd\320w\026\246"
+	.ascii	"\177\247;P\3642>h\276co\345\362\233\273\267l\177\347\032\263"
+	.ascii	"6k.\021\204\327\307\227\276\334\333\310.=\234\333\216h\341\354"
+	.ascii	"\374\204p\203)\321\340\374B\362F\325\321\230\360'\270\331\356"
+	.ascii	"\217\321vWh3\354N\360\223G\365Uh\221I\234U5H.B\206fI_\244t\\"
+	.ascii	"\266\263\247\n$\362\252c*"
+	.text
+	.section	.gnu.lto_strtol.4.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"\265\t"
+	.string	"v\023D:@\305(\035\365\245bK\360;\035\343pb\374\237\255r!q\037\\#\353S \211\200\375 3\224@m,\313\352\177\351\030f6\226\307:\220\276e\2600\263o\220\330\275\345N)3"
+	.string	"2"
+	.string	"0"
+	.string	"\235\235\2020=LO\005\030\255\006\354\256\364\274\201\345\021{\201\345Q;\336\375u\376W\207 \032%\244R\350\357\202\330]?R\311t\353m/\330~\260\177\020'\037\266;\373b[\237}\222\247\272\253\214\342\201\335\r"
+	.string	"\254\335\315\330\001{\304@\277ia\242\371;\352\342\004\273\247\020\326\356\314\230\001{\264\355\213|$-c\257\341Q\241\252\332\025\333;\351\212\031i\310\236\241\247\034\366\341\352\311\216\317\327U\177\374\374\341Q\277\302\347c\227\200\025\205\326nF\213\300\252\304\235m\023\0015\016$\361\351X4nSs4\024\031\247q\233\374d\036O\306\221\237\211\215Gr\264Mj\022\234\201:\232\344\262L\223\227\271\267/\305\210\024\303\327K?* z\001\016"
+	.string	"2\003\302\260#!h\327D\233-t\177&\b\234 C\303@\0214\006P"
+	.ascii	"eq\370\231\307\324N2"
+	.text
+	.section	.gnu.lto_strtoul.5.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"]\t"
+	.string	"\206RA7@\217\322\001\030a\303l\205\341\002c[>\262St\276\377\331d}\002\004\210\262\006\351\314 \354\306\220@ye\216\242\263`&V\002\035\003\232\203o\017K6\331r\247\0241"
+	.string	"1"
+	.string	"."
+	.string	"\004s\343\204\241\264\220V,\273Sz~ \376\302\\ \376R\215w\177\235\377\325a\307\305J\3114\372\303\030v\327\257d:\335z\333\007\266\027\354c\001\031\333\372\354\203<\244\273\312$\006\330\305pa\355\356\306\n\230_\032\3507%T8\177OM<`\027%\302\332\235\033#`~\331\366=\376\321\331%\001\252O\355-\342\275\024UC\322\221=GO3\354\303U\224\r\237\343U?\374\374\365\251\377aX\353\304 e\327\342\245\265&\327\b\207\355\316\016\237\255\323"
+	.string	"5N\344\020\372D\215\333\324\036\016D\306i\334&C\031\b\224yd\350\241\003\222\036m\223\234\002g\242\217&\271,\323df\356\355\250\032\n\2550\366\022\0165\016"
+	.string	"2\003\202a\354*\020\327D\211-t\177&\b\234 C\303@\0214\006P"
+	.ascii	"eq\370\231\307\324N2"
+	.text
+	.section	.gnu.lto_atoi.6.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"E\t"
+	.string	"&\223B9@\305(\035\365\311k\013ox\r\3110|\371?\f)\r\216\256\300\360v\356d\335Z\003\275\r#\240\225e\211/\346\243\352\303\350z\035\2739\243Id\036\2250B\266\334)\0052"
+	.string	"0"
+	.string	"1"
+	.string	"\266*\316\222\350\244\013P\212\265\273\322\362\002\354W<\001\366K5\376\035~\376M?8\245>)$\242\316a"
+	.string	"\303\356\032\206D\031\267\3366\202\355\213\375\007\253\353\204\303\0379\212\363\223\365\224\362\330]\215ck\277n\177\266f\373\320~\310E\276O\213\017\354\2166Lv\347\305\n\331/\317\314\266\377q\220/\027\270U\230O\201A\365Q]\005|(\352QoPY\201\264c\317\017T\222\375\270\273k\035\331\021:*\264~\376\020s\350`\255$\224\354b\264"
+	.string	"l\234\327\2513\030\211\315\343\274Nn6\215f\313\310M\304\203Ff\270Nb\f\274M@p\322\3336Nj\323s[\325\342\321\217\243\252\336tXB\001\005\360\300\2263\270\020\n"
+	.ascii	"2\003\302\260\307B\330v\031\335T\274\240\202\332\253\320\340"
+	.ascii	"\304\223j\345%L2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375 \330\235\003"
+	.string	"\202E\024\037\300%\035F\367.!\340\353\272^\307\372m\373M\034WU\241W\005\273\322B\366\336[\312\235R\275s\212\361>\204\031\r\f\t\354\035\314\211\3204\3549\3203R\371\177\233,V.\253L)\021\376?J<\314\013m\266\007\200\027\201\242a\336i[D\f"
+	.ascii	"\200\210V\025\216\b\003`\262\346S\331D\246'\026\f\227=@;\360"
+	.ascii	"\271\235\030\323`\342\001"
+	.text
+	.section	.gnu.lto_.refs.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d97f9ab604fceeaa,"e",@progbits
+	.string	"(\265/\375`T\006\275%"
+	.string	"*F<\017H\200\234Q:8\367\005\300\317E2\240T\267H74B\330L\rU\306%\202Y\3745o\n\312}\t\355\326\b\272\314\t\257tq\033Dy\0049bf\252\356\177\016K\211\fx&\322\224\257\310\306~\277\204 o\271?\221)\304"
+	.string	"\330"
+	.string	"\357"
+	.string	"\\XmT\273`O\216\352#Q-\333\263\252\227\312\312\250!\2157\344\375\031\353\312\307\t\213\270\206\274\347\226\257X\016L\234\324\220\367l\365\001\305\256p[\361g(,\305U\264ti\355\254n6w\203R\343G\021\366\306\303e\266\204\211\274L\305Q\316,O}B\205\323\316bKu7\263\024\326n\224\331[\235n\364\306\374\303\374s\237@\035\241R\273'\313\263\\\240V2\201ZW\330T\371\363\222\377W\312x~\026r\346\315\177\366\377\210\377\006\376/\370/\342\377\203\377c\377\243\344~\316\361\237\315\377\343\377\260\377_\376w\375\327\372\337\376\007\361\377\352\177\325\177"
+	.string	"\377\277\376\357\234\235\235\235\375\374\377[\377\316/\274\303\f\341\367a\032;\370\177\273\377\323v\306\006\326\201S&\301\202:\221\367\177\203\006\352\r\253\332At\230C\221\266*\356\3128|\321\250\232K\331n\f\254\332Av=q\rFT\323 \252\342\272\3553\355\265\033\244-:\243Y\3420\227\262\304a\332\022\207\270\264]\317\356u\310*\213\236i\220x\003\227\266\350\260[\342\231K[\"dR-\250\230\030I\032\354\030\302'T\305\031Sv\355c7g)\265\352\240\373iU\217\350\r\336\002\032c"
+	.string	"\255\240+\263\335\215@\b\204Z;hL\225\254\335J\200E-\244p\262\306\026\302\306\263\307S/)u'h\266[\330}r\033\273\373\354n\233\372\304v\343\300\245QBaw\323\001a?\235\\J\335dV\232\255a\332B\255\272<\001\250\274\224\310"
+	.ascii	")y\314\231\314\317\303?b\030\307\020\313\237\305\374<=dEl\f\311"
+	.ascii	"Q\236\231\300\3008\fA\323\005\037\351XY\203\007:\004\3149\314"
+	.ascii	"\213\347(\2013\204\213\267&f0\304\324-[\370\013\031e\223B\306"
+	.ascii	"lL@\227\ra\r/\347/_\001\202SJ^\310\313]\270\244[[\334U\236\335"
+	.ascii	"'\3332\330\252\215\013\034W,\311\226\035Z\316]`>S<\246\232\274"
+	.ascii	"\234\205\213>4\230\2748\222\227\271\030\213\346&\210Z\206\317"
+	.ascii	"\362,\205\263\316S\270\345)\254u\\w\003\273u\354\270U\211a\225"
+	.ascii	"\321\351\246&\b\2658N\210UW\316Z\377\352\351^P\242Q\236Z\362"
+	.ascii	"\262\025.\002\2102k\277\310\313U\030\3536\006\246L\013\3622\025"
+	.ascii	"\333W\030\324\016\362>\316\275.\023\027\0240\344\375\207\222"
+	.ascii	"\374k\215\252\335=c\207m\025\330S\013=\323\314@b\207\267#BJJ"
+	.ascii	"2\262\275\b\210\207\304\342G@\205\351+\372\231G\266\022D\274"
+	.ascii	"\336\345\371R ]\037O\205\3313\1776#\363Gt{)l\275\332\025\334"
+	.ascii	"D\342\371\202~\246\351\013\n\320#A\242\374\316\310\307;\342\231"
+	.ascii	"(OA(\202\220\205\025\266[\030\2220$\241v\013C:\335\220\220\256"
+	.ascii	"\274\220\216v\235NC\203\020\036:\224;\240\236\371\363\375\222"
+	.ascii	"\202\216\314\023'\314]\320\221\021\321\211\240\235/)\b(\201\217"
+	.ascii	"\250hw\341hq)\222\203J\331\261G\252(G\007y\231\214\3441~s&c7"
+	.ascii	"=A\226\311.\377\b`\376\331\3612\202Z\325\356\271J\2323\2334|"
+	.ascii	"\314\245l/5-\330:\302\242\230\372j\nyy\r\253\261*\215g1#\037"
+	.ascii	"\357\017\f\275\324g\221\001\032\030TN:m\202\320S\345\246I\230"
+	.ascii	"3\347\343\315\311\3070\310e\316f\376n\250\221,E 4DfjDF\n\222"
+	.ascii	"T\007\240\002\221\251\2639\021\300\261I\025F\223\202d\2179j\006"
+	.ascii	"H\376\246\264\t)\201\366\336\310\225\221\200\341\337\214\245"
+	.ascii	"$\201\375\004a\350\347\237P\027\332\250\304\231\301C\246,:\361"
+	.ascii	"\003a\034\177\251\241\307 b>\343\267\2425\251\032V\032\0347e"
+	.ascii	"\256\241hJ\251V\356\346\030\360\343Wdi\r\350\033\232~\313\bf"
+	.ascii	"\177M\301\216\251\357\361\257\314\350\317\003$\3604 \352\"s\211"
+	.ascii	"3B\227p\202\003\275[\331\241\206J\343S\223\305h\307\275e\265"
+	.ascii	"\253\251\022\331{Q\263\220\004\331\252%I-\263c\013\245\017\252"
+	.ascii	"\254\355J\370N)\024\005\377\361\bJ,g-\200~q\327\340BC\330\270"
+	.ascii	"V\274\324\357\23151\266\316nc\300\3401\260\316\316\256go\031"
+	.ascii	"\370x\007I\006\276\324"
+	.text
+	.section	.gnu.lto_.symtab.d97f9ab604fceeaa,"e",@progbits
+	.string	"_strto_l"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"strtol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"atoi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d97f9ab604fceeaa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1022 @@
+	.file	"time.c"
+	.section	.gnu.lto_.profile.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"=\t"
+	.string	"\364\f\320\001"
+	.string	"\032"
+	.string	"\232\324\333\212\f\020\002"
+	.string	"\002\001\002\003\001\243\214\302\266\b\002\373\373\217\353\007\016\002\002\002\002\001\003\346\307\273\333\001\004\002\005\002\005\004\352\263\360\321\b\005\255\263\333\322\001\024\003\002\002\001\006\315\203\200\366\013"
+	.string	"\007\320\272\212\332\002*\002\002\002\006\002"
+	.string	"\006\002\006\b\303\243\360\202\004"
+	.string	"\t\211\242\243\201\017\002\n\251\324\331\213\005\013\326\225\305\221\002"
+	.string	"\f\324\342\311\266\t\002\002\007\002\b\r\240\342\234\212\n\016\305\237\224\203\017\222\275\371\270\b\020\331\345\253\313\f\b\002\t\n\021\354\242\3530\002\022\221\335\225\216\r\023\266\200\366\276\b\004\024\211\307\225\365\002\024"
+	.string	"\004\002\004\025\364\235\311\257\t\026\355\314\246\334\007\027\362\372\330\324\n\030\031\240\342\234\212\n"
+	.string	"' p\202b&\327\001 \3443v\207\303\202u?\007U\b\002\020\326\t0#\214\345\212B\266>n\317\363\267\022\031\235\327%k\273\333\005\377\300\205\026d~\250^0z\020"
+	.ascii	"\302\032\003Gv\001o\200\207r\234\206\200\304\255\f~\211\200\261"
+	.ascii	"\3534q{w&\355\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\032\001\315\005"
+	.string	"2\t\027\026\2207\351\272\273\273\273\273\223\376\355?}\373\265\226v#\204\310-S\333\037B\332\205\347%\374A\260\034tAoBe\3008\342/)\255\202\350\261D\333\024\240HT3\262 \274\226\301\376\022\022}\361\017a\221?\234\356\241\371\376\263-_=(\261\214<\246\364\212uUQ\003?.#' p\202Br\345\003LL9\352\032)\017\313w\030n\313\214x@\311\003\033\r\251\261D!*\b\367a\"\030#%\201\305gY\326\035\026\302RB\210\006\314\026\260 \367%\030\006\240"
+	.string	",\213]\254w\022"
+	.ascii	"\245\361wK\270P\330\036oX\003>\007\343\021\371\200\320\376\002"
+	.ascii	"\f\001"
+	.text
+	.section	.gnu.lto_.inline.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\202\006\225\030"
+	.string	"V!kB\020\257&\215\001\205\200\\\321O\0261\300\212\003>p\030\365\017\304v\b\220\225\260\246\037\177\225\216\221\023\214\276\337\021S3[\372\037\001(TT\220\024@\027\241\020\002\342\376\2676{\263i\273I\320\226R\246R"
+	.string	"["
+	.string	"["
+	.string	")+\204\035P#SB&\020\305\322H\2259F\223\244\260Z\026\001gn\356\211;*S\354\256\347\304\315>\345jw1\316\f\333\244zb\3579w\266\333Y\302\363<\245\365&\272\273\353\361\316\326=\317\003\0330\210\376I\374\032SJ\263\273\037\277\361\245 \210\242\027\\`Z\b\214\341\311?\037Sn\025\301\335\305\026\301H\3466\204\004\333\315\025\311J\336n6\362\334+\351\345\036I3\351j\227\301u\266\266{\266\222\304sw\027\354.\313\203`\231^*@Rp\306"
+	.string	"\312\004\300\017\036\372\2011\210\0360\224*\343\013LY\207\362"
+	.string	">\365`$\325\035 \2673}~?\224\276\340\300X\3408k\330\255\244-rjr\254\261Omt\375\242D\020(\312\004!\226(W\364\307\021\353\345Jb\214'Z\023!\303\203W\031\327$\025\"I5I\365QS\242\364\363\022\023\307\223t\260\273o\013\364(y\343\002\323R@\177P\"\342\001\237\232j"
+	.string	"\200\217\312\021+6\260"
+	.string	"\225@\361b\263\301\301\205\210\t\035\216\243\224\270\241&ysb\306\246\363(\027\311Tx\301q\177\2421\022H\204\030\3454\r `"
+	.ascii	"\375\364\320\032\350\262\273\031\177\332\037R\355ngO\306\257"
+	.ascii	"\212\240\3169JD\345\272I*\275=\250\271\335\217:\177\200\256\250"
+	.ascii	"\0219\310\024\t\211\222$I\n\035`\002!dD\346\001\022\2404I\nR"
+	.ascii	"\251fFD\202&-\024\366\217\003\266EY:%\232n\200\341\201I\257\276"
+	.ascii	"\336\204\225\357j\005\276\307\306\375\021p\327\315\237\256\226"
+	.ascii	"\211P\200g\364\322\022,"
+	.string	"\007L\244\215\224}:!\263\226\354\007\2112\336\360\304\r\034\353\023\001\30030\004\303]\245\365\312-\306\365\265Cp\372/\001\027\346\314E\3053\344\256L\026\306\r\025\245\311\355\341\224\370}\302l\243\343PO\350\264h\223q\"A\027\215\344\266\270\233u\324\336d\243\341\035:\322\372=\364\210\234\200\242ig[\371\272<\fV\357)\347\223\n\325q\340\003\034\314\357\247\256\323\303\301\271\342\3252u:jb\332T\262\333\311\267\237\220b*\344\267B\363cC\025y\020\"\316/J\006\254\0337\247U\332\225L\227H\252\332\213\333\246I\325\r\205K\201\031\243<\343\203\323\374\316\323c\220m\021'P\004\314\253R(=A\314Ou\020\f\222Yjk\327\373t\265\023^#`\350\303~\344\315\\\221\2618\303\032\0366l\360\277N\270\250\241\263\221\326\003\177\210P\304\254\277\002\232U\024\b\002\372IFe\264\027>6"
+	.ascii	"\036.l\036X\234\177<,#Bm\003\360 \025\357\270\202\020\227\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\362\002\265\n"
+	.string	"\262\01600`k\222\016\335 H\330\242\260\230 \b\264\001\234\213\322zF\235v\030\336\013nNU\030\226\rc\3511\0070\360\355\367P\364[7K\b!2\355x`\200\030\213\313$UHT\303$Y0\022\227IZ\240\034&\311\2028\201&[\273\311~"
+	.string	"]\245\256\024\304\311\323|2\023=\311\n\002\211"
+	.ascii	"\t\327\271C\035\372F \367D\232\024\007\363\213\3279~\343\216"
+	.ascii	"9\341l\246\b3\220\213\341\213]WN\275\247^G\r\205\263\031\201"
+	.ascii	"\025L\232\021\324\376\361\337 g\353\203Uaxd@XUUUc\307\353y\266"
+	.ascii	"Yx\263\3061[\2130?{\001\315\233\222\257C\327d\317z\221=V0\002"
+	.ascii	"\221i\004> `\"B\205\305\003\220\205T\360Y\246\307\226\241\241"
+	.ascii	"wO\344(\330\253\025\322K\016<J\007)\262\371s\355\315\305q,8("
+	.ascii	"\t\244\227\200\037\341\354,$\216\217\267+!\230\373\261Z1\317"
+	.ascii	"\263\263\244BX\334\274\020\005\213b\250\"\340\253()\203\351{"
+	.ascii	"\265\266\007\035* \016\0045\313\005.\373amb\301\362\n\262\231"
+	.ascii	"\020U#1\370\001h\360\031,\375\260\205K<\310\214:;\351\026E\033"
+	.ascii	"\265\371\313W\035R\005\005$\200\314Vn 2;\264!\207\002\007"
+	.text
+	.section	.gnu.lto_.pureconst.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\205\004\002\205\004\003\232\004\005\232\004\006\230\004\007"
+	.ascii	"\231\004\b\200\004\t\205\004\n\205\004\013\230\004\f\230\004"
+	.ascii	"\016\230\004\017\230\004\020\232\004\021\204\004\022\230\004"
+	.ascii	"\023\231\004\024\232\004\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\013\001\225\006"
+	.string	"\262\310\034&\2009\351\030\221"
+	.string	"\021\271\330\333\025\306\204\346\262\370\024\305\003#\f_A@\032o\006\373\304h\364\037\031\331F\266L\001G\020\325\303\363\033p\006\273\275)\313GueZ\f,\020\022\330\021\330\001V\227\24416\202\017D\223\251\025f\312\322\001\201\234\325\334\222\244p\021\\\376<\257\203\335a\260\266%\213\177\336\337\373\2167\270"
+	.ascii	"\274{\037\217\260\277\222\375\271Y& @B\243$\264\003\310\007\330"
+	.ascii	"\257\333\224&\316\362\247g\"I\003,\333\250&r\027\201B\245MD@"
+	.ascii	"q\3604\034\244\265\350\365v\t\237\256\031\f\355\215 _8\363\f"
+	.ascii	"=\033Dyw=f\355c\352$\331\034\254\377\330\347\362#\"\264U<j[\360"
+	.ascii	"g@N\240=\031\252\341\025n\b"
+	.text
+	.section	.gnu.lto_.lto.ba0219fae183c22d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_days.13.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`|\001\305\013"
+	.string	"\206SD<\020%9k\360\3140\202<\001\371\352\336\306)\343\224q\366$9E\020\371\367}\263\221 %\250\214j\200w\316\373\002@\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200,"
+	.string	"\304\325)\320"
+	.string	"\025\200Sk+\2737\3556"
+	.string	"2"
+	.string	"4"
+	.ascii	"\243^\027\231}\344\366\324\270j\2440l\341\201\341\340+B\211f"
+	.ascii	"]\203w\361\235\367\005\036\002\b\035V,\232\002\016[\213\002?"
+	.ascii	"\213\207"
+	.string	"\340w\200\264\b~\2719\256C\b\253\317O\310Y\243\243\234\236\262\272\312\353\255\331Wnw\215\263\\\327\r\"m\254@\233DF*D\203(m\272\274cs\217\317?\310O\243\203\234\036\262\032\032\235\312\345\362\327\346\260\317c\344/\243\303\234\036\263\272\314\353\262\331g\267\317\214\323t5/\302+y(O\3669|\030\337\351\213}\001\256\305-K.7\331<\334$\263\267\334^3\3563J(\260\271\234\266\371\315\3475r\234\321sN\327Y\335\366\372\316\354\267\333y\306{8\002\003\316\305\001M1\307\254o\335D\027< `\023Qs\363IQ(\262\022m\207\024\346Zk\245]\333Zi\327\264&\332\f}[k\244]\323Zi\327\264&\315\265\255\21168t\303\266\326b9n\230\333\206\030w\030nS\f9v.\002\373\240\337P\260#\367\016{e\316e\035\001v\343\260{\337C\333\001\273\256\252\f\211a"
+	.ascii	"\370#\261i\250E"
+	.text
+	.section	.gnu.lto_timeConfig_Registry.17.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\217\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\325\006us\356\005uq"
+	.string	"\005\001\006'\001\002\216\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/common/time.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_timeConfig.19.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_dateTimeToRtcTime.20.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\353\004\245\035"
+	.string	"\206\271\303I\220VN:\205_4.\220\266\222\336\264\fr\035qWuE\306\314\213\037\346\203\327\2628\022\362JH\031\325\231\025\355<4}\324\255#\0060\0047\311\322\343\274\t\256\0214\321\356\037\245\376\231\352\377\377ZM\310&D\356\224\002\254"
+	.string	"\233"
+	.string	"\265"
+	.ascii	"\357\372\275\376\257\037\354\244}\237\310\305l\233A|\210\027"
+	.ascii	"\353\313\006\302\266}\274\335\344k]x\256\003y\220\013y\230m`"
+	.ascii	"R\022\276J@\3602\341\240\353\004\203!\316'\n\246F\275@q#\301"
+	.ascii	"\026\316K+\305Y\255A\003\301c5=\213\251\0341Ur\275`qVk%\360\321"
+	.ascii	"\004\312\217>\342g\350\234\277\022\361\230Za\224\r\2515X\300"
+	.ascii	"\270\362\243m\337\307\1774\331\351\026\234\261\242\246E\002("
+	.ascii	"\224Rk\3159\370\032\372\261\374\f\375\2702\356\364\351\344?\354"
+	.ascii	"b\217\026aR*F|\222\rj\255\236R*V\334{\333B\266-\330#R\243/\202"
+	.ascii	"~\374\222D\204VWO\263\212\035\204\232\033\303\276Xk\255^\030"
+	.ascii	"69MT\233\306\325\246\207j\323B\265\351\240\225i\001\317\272\201"
+	.ascii	"\276u\377|x\007x\327\355s\257\273\347_7\317\301\356\235_\375"
+	.ascii	":\344tN9\215SN\337\312\351\233r\332\246\234\256)\247i\312\351"
+	.ascii	"\231rZ\246\234\216)\247a\310\351\227r\332\245\234n\241\323,t"
+	.ascii	"\332FN\327\350\364\n\235.\307i\222NS:=\216\323\3428\275\343\364"
+	.ascii	"\034\247?\200\352hr\013\2535E\225)\225\311(f\343Y\377\326?|1"
+	.ascii	"+\26380\353\2621K\311~T/\013\263\007\246\375x\231\204\017m;\361"
+	.ascii	"\370\223\t\013f\324\032\205\200\354N(\210\026.\320K]\240\037"
+	.ascii	"_\366a\217\031\322\020#Z\001K\246}\210\326\226h=\201,l;\216\243"
+	.ascii	"-\353R\005\365\263-\373\251\026\\\2774\226\375\361p\343\036\243"
+	.ascii	"\266eYq\254\2666\f_\222\241\266$\016.\264\225\rP\356\312\212"
+	.ascii	"d\344\226{\rWB.\211\305eE\327\247\350\343\322\025\205?*\250Y"
+	.ascii	"\305\342\216\373\rG\".\351b\210\266\333c\364#\273$\216\241\325"
+	.ascii	"\\\236\243\033\231h\337\235\235c\3004\353>\306\241\254\265\036"
+	.ascii	"\360\213<\330\2255\036H=\337\221\356\003\325)-\365v<\232\264"
+	.ascii	"\344\353 2\031!m\007\245\236\2177&\031\351\230D\035oW!\304\256"
+	.ascii	"\267T*!M\037\025\351x;\245\\\317\307\343\371\216r\275\235\021"
+	.ascii	"/w\224\364!W\204c\237\007]RN\311\347K\312\331\202O\267q\345Y"
+	.ascii	"\216)\264\263\247\205\362\320\n-n\377\243\312\331\241\025\315"
+	.ascii	"\200iOew\022\032\264B\273Q~U@\033\264\027;\220X\024\255'\\\021"
+	.ascii	"n\226!gW\260\276\320\256p\026ho\006\324\332\001\254\307\321\333"
+	.ascii	"\342l\217\331\316\336\354my\240\334fov\207\n\317\326\254\315"
+	.ascii	"\352\230)8\216\322l\315\352\b{vfi\026\200\360v\034\225\331\231"
+	.ascii	"\315Q\362\253\362\331S\250A8#\215aL\t\311\220\202\026\264\260"
+	.ascii	"\034\360\"\231\252u\021P\255tl\204R\305\035\002\037~\224c%\212"
+	.ascii	"\206'\323}\204\210\267p0\022G\357k^\221\254\316&\243\007\261"
+	.ascii	"=\347\202-\276\003\253\r\215\304&\231\022\271\264\374\353\362"
+	.ascii	"\227mn0pb\300\361\301\3530\204`\274\246c\373\205]\330\307\244"
+	.ascii	"\235\374`\021\004\342`\337\247\266\005\274\271rQp\315A\256+0"
+	.ascii	"\357`\254_'\331\217[e\324\350\301\204\316e\215\323\321\360\272"
+	.ascii	"\032\257\243\205\327\337A\032\3349\020\334\340\024\001I\360l"
+	.ascii	"\302\203\252\211\316\177"
+	.text
+	.section	.gnu.lto_rtcTimeToDateTime.21.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`z\006%&"
+	.string	"*F\004\017F\200\334M:\273\325+\305\303\377V\217\253\177\330\203\312:\n\322\356Uh\205\330\277\322{3s@\r6h\262h\356\273Jj\304\342\245S\bG\361\377\023^\333\375\253\200\227\275\366\001d\347\307\304\326,!\204\220\264\223\f\340"
+	.string	"\316"
+	.string	"\336"
+	.ascii	"\273\366\230\311l\266\271\262\027d>x\254\251\265R\210\2423\372"
+	.ascii	"\371\324\237\217%^\022\f\305a>\213\351N\031W\247\224\260\262"
+	.ascii	"5\265\016\225Ln\203\323\244\321H\2070\314T\251\2656X%\323]7\261"
+	.ascii	"\023\237\237\304\360O\255?\246T\251u\330`u\247\311\035:\2504"
+	.ascii	"y\032\2504\351\333M\343aWu\230Vp,N\255u\367 \271\334m\357q\350"
+	.ascii	"-\3573\356v\232%9\236\372\326t\253K\025\226\f\343Fr\210\221/"
+	.ascii	"\203\271\022\216\025\322\316\320\202\364\006\344F\226O\203\271"
+	.ascii	"\322a#WBj\216>\265V\036\254\337\370\200ZaQ\321\022\367\225\303"
+	.ascii	"d\202\0367\262<\216LN\224\b\341\301\2321\036\n\231Z\016\353G"
+	.ascii	"o3'\355P\253\302\312ajZ\250\265.\255\302\272\341\315yw\325v\327"
+	.ascii	"\302n\351!\265\326\tk*>0\336\311\0201\271\216Q\232tU\233\361"
+	.ascii	"\344\351\031\2237\2554\372x\027YE \3617\272\331v\232H\221S\335"
+	.ascii	"\242\244\377\r\344\341\323\217g\301\266)Z\\\223\214a\224E\367"
+	.ascii	"{Yp\200`T\264\270;\224A\317%\306\304\253\306\376\307.\204%\245"
+	.ascii	"$$\335\321\002?\261\025\270\314k\344\241]d1/\221\243x\207N\272"
+	.ascii	"\bF\272\007L\272\006L\272B&\335\002']\002&\335\001&\335 \223"
+	.ascii	"\256\200\223.\320I7\300I\367\347\244\353S\322\3559\351\362\224"
+	.ascii	"t\001\234twJ\272\271\222.\316\244{+\351\236&]\263\244[\232t\311"
+	.ascii	"\222\356H\322=I\227\216t\035\301D\362EHM\2556\212t\252\027\222"
+	.ascii	"X\304bv\024\273\314\017L\304\320\336\234=<\357\271`0\276.\177"
+	.ascii	"\361\302\363\333W\230%O#\202F\216y\256\275\r!\223\3769\364V\313"
+	.ascii	"\305C\267\23003?:\307gh\240\251eO\261X,ZW\016=\35163\211c\207"
+	.ascii	"\0325\2203&n\310r\255+w\374\320\225n\265\036\317\265H\007p\251"
+	.ascii	"\260\265\037\235\263;\007p\007\333\246v\227\274%\004\203\335"
+	.ascii	"\305`-#\210\310\324\372\243\200\305YJ\214&\232JW5\225&w~\373"
+	.ascii	"Z\223C\234\262\027\020+\365\347J\263\356Hg\022\342\236{\271\006"
+	.ascii	"4\222;\242;\356\316!\204\003\004#\372\350\2723\t\307\334\276"
+	.ascii	"\353\344+\347ow\235\002G?\337\023v\001\022\251\216\316$T3\277"
+	.ascii	"\213\302V\312\233\247\013^\336\205\020\rH\234b\243/8\223\220"
+	.ascii	"\f\bF~\367\311h*\316N\274'\016.\236\240Z\234R&\234^\214)zPQ<"
+	.ascii	"\262\347\336\t\272M\016\234xO\275\035T\024\217\027\325\264\203"
+	.ascii	"z2\301\3335I\261\3309\020\332\250\025NR\273^T\224\324.7\254\276"
+	.ascii	"\231\213w4\211\016\341V\031\222x\231:\325\"\370\256\006\263\001"
+	.ascii	"q\340\bN\307\202mR\\\364\003\377\260\245\006$\032\370\356\006"
+	.ascii	"\253a\033c\241\0338\031\006\310\203\352\003.t\003\275\b\274\300"
+	.ascii	"?\346\3232[\210\243.4#\212\272\316\020\370\221\020\"\322\007"
+	.ascii	"|\305\026Z\320w;\270\214\212:Um\254\242\024\360 \b\027p\022["
+	.ascii	"d\3016\240\357z\260\030\020o\252\332\364T1\2102\300\201~\266"
+	.ascii	"\237\373<\200\322\177r\367\271\b\255b\260\rw\256\265\231\221"
+	.ascii	"\314\234K\337q\314YW\022\021\335m\354\261\326Zo\347Z3\321\227"
+	.ascii	"n--\264\007w\250Q \243\220b\212!D#2\332$i\rp\002\031*+z\021\220"
+	.ascii	"\255DeS\320\032\2056\003@\320\031\240\004L\265qtf\367\212\206"
+	.ascii	"j\200j\226yB\275D\204\267\340\374z\240\013\226=\210\213\314\r"
+	.ascii	"p\260\306\273dxr\r\035\374e\375\341|\376\366+\253\205\312\266"
+	.ascii	"UR\f\023a\312-\302\350\304b,\016H\215\364J\037\237\262&'n\334"
+	.ascii	"\035\3452S\362\221\242\302\203\024\201d\210\367\230[\35765\364"
+	.ascii	"5KX\254$\251\326\336\307Rt\037v\003\272U_g\252\354\321z\215R"
+	.ascii	"\020\230i\222\032F\350\233\346\245R`|\025\f\246\0269\274)\235"
+	.ascii	"\272\026\034@B\264\"\t\211\022\204\357\b\267\243\210W\021HB["
+	.ascii	"\315\r\354\236\n\027R\313\n\032L\335[\312A\3420\300}8\007\003"
+	.ascii	"0&k\t\220\024_\300\334|\017\030\325\205\352\353j\317\024\200"
+	.ascii	"rh\r\002}y\3125\035\304\225v\352\376\007"
+	.text
+	.section	.gnu.lto_rtcIsDateTimeValid.23.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\340\002\225\022"
+	.string	"\326bwE\360\262&\0350\001{o~\037\240\242r\001\376\260\260&\224xs\3163e\027\007\344\330G\253\372GdL\233xS\013\221\301\212\231|\257O\326\260\302-z{\347Q\322\363\345\216\357\022\225\350m\033!{o)S\ne"
+	.string	"["
+	.string	"e"
+	.string	"f\240\035\032v\003\361P{\201xh\333\021$\264\330\345\260\023\\\306\002\222\211\001\355\302Jj\342.\037\211\264,\302\247\351\342g%P\004\211n\246\265\372hA\t\233\233\213nRSQ\003\"3\231\2141\t?\344#\265`Rw\324\204x#\273\373\026O\232\026+3+\331]\347L\313\346&\335v\3146\004;q\004\023|\027\031T4\024\207>K<\274\302\236!89/\331\331\260U\352\313\376\333\335\265\272,\362\234\037"
+	.ascii	"L\2174-zi\355\245\263\227\216/\r_\372\275\264\276tj\372\001F"
+	.ascii	"6:\024\354\354r\235\320\346\200>)l\267\330$\333\231\366W\234"
+	.ascii	"E\313sXN`\327e\203g\027\366 \337b\246\0258 \247\357d\n{:\234"
+	.ascii	"\250/\037\370\026\243v\340~\350\374h\370\214\030d\330\356\302"
+	.ascii	"\004\337\"T\017\234\217\030\177\n\365\305P\227\361\024\366\f"
+	.ascii	"\375\351\313\244oQ\325\002\327C\347\347\335\267\230\252\372j"
+	.ascii	"\304\214`y\303c[\006\345\356\256T_\026\260sU\274\232p\235\316"
+	.ascii	"\r\230\fb;\365\027*mw\003\247\ru\341\264r\202A\263\211\344\264"
+	.ascii	"\241VJ(\251mK\231J(\250\223\255dJQ)\221 p\212\303)\245\264\222"
+	.ascii	"J\245\224H\260\275\272\234\242\006O\315\301GJc[DG^\224\345\221"
+	.ascii	"\212\350e\206^\262\203#}]\205vW\"u9\343qU\024\251\t\327\235\234"
+	.ascii	"\206J\244\320\007\206j<\327\324\204\023b\272\217\0264`w3\n\001"
+	.ascii	"4 \360\002\021\221\353\006\314\b\230\360\306KP\221\3038\002J"
+	.ascii	"\020\256o6\364Z$-\277\321\332\002\227\361\216<\002[^Y\026\t\307"
+	.ascii	"\004\353\257%G8\004\332~pS\206\253\224\363\251\314<b\\\223~Y"
+	.ascii	"\210\271\032\215a\n\266\245\007g\263\242\031\305\205\342\265"
+	.ascii	"\242\3208\243B\304a4\n\206\330\3018\2326\224\303<\306\235\206"
+	.ascii	"\214\310x\3100(\365\210\3452"
+	.text
+	.section	.gnu.lto_dateTimeWithOffset.24.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\310\001-\021"
+	.string	"\206\"vF"
+	.string	"\317&\035\323\034j\036\200\342EW8\215*\216\206\r\031<\270y\006\371E\317\002\263\336\331%\336\214m\243\316"
+	.string	"L\357\320l\201\365\270w\271%\333+\250\213FA>\276\220,\330~\213vq\332\243m\"M\312\224\002`"
+	.string	"Z"
+	.string	"b"
+	.string	"\255\333DH\324\256\274B\360\354\356\207\017\214\276\241\362\033\\\230\""
+	.string	"\265+2\227\220\247}\017\377\320zM\3125va|xv\303\017{\214\2769|"
+	.ascii	"\356\333\350\033\3347\267\354\024\017e6\306L`\231\255\330\335"
+	.ascii	"N1\274\365l\371\237\375\"\326\242\362\214\006v\327\031k\251p"
+	.ascii	"\353mw\330^`\247\202\216iTL\2374m\212\351\214\230\306x\315O\272"
+	.ascii	"\315\177\021\323\243\230\216\017\177"
+	.string	"N\323\"M\253\2463\246\257A\312P\302\003h\227B\255\305\376l=3\266\357\213\370\316\3524s\254r\256sr\232\t\310\234\330\245\233\343\240\234\346\020\327\r\207\335-}\263Q\354\3227-\331V\020\227\005B0\032\221\216\364;\357\350\021\222\231TU\244j\002\366R\340&\301\245\252\036Fs\241\251\237]\264\341\302\315\013\350&CMz\226!W\326|\236_3\364:\317\031\031\254C<\361\217\273\236\3648\357P1$\003\242\365\274\262fRrj\203\252|\354\312\221c\341gEU\354\360\225\032c_\264\273k\205q+\217u\222\372\300\370`\344c})\004'\226\267*)a\340\201\237\210\307\032i`2\t\210\007~\254.\245\002A\025I\227\372F\300\216\304d\325\201\f\260\n\202g\322\261T*\223\256\024\272.Z\205q\002\r?.}\331\224\030JR\333s\220\217\371\263\213\214\bb\021$AU\214\322\250\030"
+	.string	"P\300^\264V;)J\235,.\366\341F\032U\003\036"
+	.ascii	"\006\b\312\f\375D\004>.\336UA\220\212Q\023\270\215\323\017e="
+	.ascii	"U\211fZB\225)]z\\\347\322\244\013F`\025\024\006\322\001e\241"
+	.ascii	"P\312q\2101h\264?N\223\204\r%\264\031\034\006\303\002Thp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_dateTimeFormat.25.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\306\b%/"
+	.string	"\032W\354\022E`\236N\007s\3049,\240\003\215\211\004\204k\216!v\327A\366\231\225\320\341\263)\376=8D\024k\021\366)\245\271\001E`\234\303\037\230\"\016\007\252x\213$\003#\335\316\200S\362;3A\332\356\266\345N)\245\034\001\377"
+	.ascii	" \001<D\243\214Z\034\013\346`\333g\356\342v\322R\332\256\237"
+	.ascii	"\034\274\353)]\3554\252\367\016C\030\216\274{\313R\334\001\033"
+	.ascii	"(\255\363\271`L\265 \367^\022\375\244\241tu\024\256\"\004k&\371"
+	.ascii	"\340\213\203\273\367N\251m\205h\023\2440\331\274d\303\266f\\"
+	.ascii	"\202\266\314A\265\336K\220\3354Jk\306a\231`\351\032IW'i\341>"
+	.ascii	"\027\354+\306\335\275\367\211\033\250m}\374\233\\d\234\334\231"
+	.ascii	";\256\345\272z\356E\377\334\273\346\344\356\336\346\023/\251"
+	.ascii	"m\271\331Ai[\265\201\322\266\314\314\303\006]\214\354&\033\331"
+	.ascii	"/\fm\251\204\357\336f\324\367hd\007\201\253\372K-\372\216\344"
+	.ascii	"\376I@\341\336\332\210\231%;\bD\332q\206\326"
+	.string	"+J\244\246eF\343\225\335@\225\274\360(\323C\312\320\\\375I\330q\226\326\277\306+\263\261\364\264F\333\240\231\022\025\336{e\230\2059:\243\037m\312\233\262\307c\006\206\006\221\375\020\353g\373\230\331\227\373O\302\275\227]\314\354\254Y\247\231\271\311\314s\314*\204\337T\372\311\245\2121\023Ox\213\261P\371If\372\377!mm\226\376\311s\260\361_zv\345\033\257,\315\364\376}\245+\354\265\241Q:\373\235\336\253,\347xy\037C\350\241\357\031mb\224E\276\274\257\331\336\344\335\3753\271E\312\364}\244\315\313\232/d\300\374\rs\363\313\237\311\334\350\3755\346\236\353\036Zg\005\275\244[\312:?9u\263\273\251\223t3\005\235\227\254\363\201n\322l\240\2434'u]3\222\260\233\315G\326\331\b\350\\d\235\013\254\316\004\2543\321\352<d\235\007\254\316\002\254\263\320\352\034d\235\003\254\316@\326\031"
+	.string	"\320\371\307:\373"
+	.ascii	"\235{\2543\317\352\274c\235uV\347\240u\006\256\316\253uVW\347"
+	.ascii	"\237uNWg\313\316\250u~\325\331U\347\206 \024G\r\0073\355\305"
+	.ascii	"4/Y_\234\333\305:\201t\223\356(\335u\335\316F\231\233\233JWi"
+	.ascii	"+\314Af\321T\002\351\253\017|\235\347y\0378\023\212\330\356U"
+	.ascii	"\266\030\005U\311\002A\333\3413[\270\3407\355\223\334\363>\""
+	.ascii	"\232\217\252\347\355\316\363\200\350\275\235_\235\301\327\361"
+	.ascii	"\320z\301\337\301\003Cd}`\207V\263\276u\376^\335\320y\277_\361"
+	.ascii	"\300\270\231\263\237\376\320\315n9\2075\364\231)\225\333\fr\316"
+	.ascii	"\250\272\265\345\346J\333\332\347\252\341\246&7\347\365{&\003"
+	.ascii	"\303\344\226v\266\267t\312d[\332\241\335\310\324\200u\242\221"
+	.ascii	"\247\026\207\036\275\360\307xKK}?\373\347\310\220d\372L/\031"
+	.ascii	"\372I\345e\217OC\232\2750\033\322\260\341\233\3520\205\r\334"
+	.ascii	"\227n+\354A\210\036_\367\024\210~N\331)zpz\334Ti[a\021\375\244"
+	.ascii	"\342\031s\357u\320V\272"
+	.string	"e\304Q\303\241\347\345\367\336\244}&\007\303\336\226v\377\364)SG\322\217\001\225\270-\355\336\351S\246\332\322\316\0234\322\217\365\263\225\332\236\373\311e\351\256\360\241\336\364G?\206L\321'\201\344\307\217\236yD\225\267\030\372;bl\272\200}\022\345\361\377\246\\b(\245\364\240\304PJ\311Jik\201\224\022\324\007(~ \034J)=m1\220R2RQeUTa\215Z[E\024#\\\034U\254\021.\216@\025U!\216D\2554\253xe\324\"\2068j\025Q\030u\214\304\343V\326\225\206#\321h\302Dq\207\210u\365\201x\254*\241\232\330\"\361l\005E\304\272:Fe\025\261\260\212VQYWUXQVZ\306(\250!.\256 jE\035\213E\255\250 {5z\177\315\300\363\214\311u\361\372/6\242\367\356\210\320\316\356<:\357\013>\223}}z45As\225\364\300\217%\275\202?\360"
+	.string	">\300\013\375\200'\372\002o\364M\305c \345\220FTe\227\351\370$\027\275\221\b\207AU\364\226\300\027"
+	.string	"\341K\002\277:\207\236\310\203\207\r\375\016^\0317\002~@\007\377\022\360\326\031\364B\033<\031\364+\036\320\007\350\003\372\23633D\346~\036\300\017\337\230dh9?\277\200\316\f\n|\246s\363\253;\206sK\335\372k|\243\306\027$\\\220^\3017\226\266"
+	.ascii	"\367\306E\311\347\345}~%\214L\210z\344\001\200\223\250A,\203"
+	.ascii	"\031R\212\214\210H ##J\241\003\300\242\221\"\352\034\021p%df"
+	.ascii	"JLR\324\001\230\2020u\241\th\376& \375G\256\334\222\342\216\352"
+	.ascii	"\272)|\254-w\016\267\233\320\326\347\351\t\023\017\250\225H\333"
+	.ascii	"h\215VYh\370\304H%\326\006Dj7-LF\376\264\321v(\314\277\r\333"
+	.ascii	"v6\252T\327\302\312\366?\022z\217{7h\"J\234xXYP@o#\300\262\346"
+	.ascii	"n\372\2054\236\336u\230\304\341\031r<\034\363p\001CK\035\313"
+	.ascii	"\245\325\261\360\024\031Rzw\307\215\241\327\330\302\341&\024"
+	.ascii	"S\264\271\006\250\346\311^\360T;\r|I\264\235\"\217\bW\313\030"
+	.ascii	"\363\3306<\202\322\306M\204{\233\225\270\372\023\311\333{\270"
+	.ascii	"\335H\257\310\244%\fo\3121i{\221\234\n\241Aj\363\232\341\376"
+	.ascii	"\340I\311\220\027\t!\351\317+4B.BZ\304y\361\241\006\233\201\""
+	.ascii	"\352\n^\310\3646\332\267\021\211\203\214b`x\216b)p\251\272\033"
+	.ascii	"\007\300H\214\224\245!\205\360\240\241\034\341\2617\200S\036"
+	.ascii	"\361\007"
+	.text
+	.section	.gnu.lto_rtcTimeMake.26.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\345\t"
+	.string	"\326\023F=@\247(\035la\220\336\247(\342R-\331\353\330\272E\340\225Q\b\217QT\340\335-\344\033\271\3775\334<\255\035\344w\255e\263\f\003\222\235"
+	.string	"\202-c[\304Bz\245\244\355M\244L)5"
+	.string	"5"
+	.string	"1"
+	.string	"#'\361\354a\370>L\021\201\202Q\252\301\356b\376\276\020\017\257+\304C\365\270\347\351\361\237:\304"
+	.string	")@*}\236\024\211\335u\222J\246[o\373\301v\204}\207{\261r\260\006 \200\020\333\236]\261m\231\374\304;\252\302pW\203\200j\367\273\370r\035&d\246\375\222\237\274\177\026F\330\3358\251v\367b\210\353\320b\331\366\003\367\200xMU\006\"\221P\256l\351\365\013F\017@\271\262\277Oj\207}kw\327\312a;\035\217\372\341\277\337\202i\205\351\204\351_\025\001\0070\0016\235\246\321h[\354\262Lg9\303d6\255\203m\270m\3432l\243MlX\306\3510L\2039\212\f\007\353p\034\007\253|{G\265\2004d\325\324\250\027e@U\265(\t\002\r"
+	.string	"2\003\302\260\\8"
+	.ascii	"\354KP\231\264k6\313D\004\004\006W\304\3248\270\373\244Z1\t\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rtcTimeGetSeconds.27.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\225\b"
+	.string	"vP;7@\305(\035m\217\207;\342\007\006\330N\274w_\317\342\0250\\\023\314\364\211\363\266^\247_\246p\204\266M\031\3070\224\006pg\003\315\300+3\273&mo\"eJ\001*"
+	.string	"+"
+	.string	"+"
+	.string	"#\016\223\335\205\225\017\274;\353\002\357N'\376y~\374k\334J\241:H%\320\223\222\260\273NR)\342\326\333.\260}`[\025\253\223\rq (\333\036\033\263\235i?\365\f\317c\347\001\273&\217\217\335\210`\203\353\316\361\262\355_\034\303\343\217\025)J\357D\022\251\007\340`!\372F\003\347\252\360;\357\356\372\221\007\211P\256\354\bJ=\331\267VMv\217\277\245\351\324\364\037V\"\222\255v!\002\233\333\222]4\314\006f6M\333,0\203Q\320\240E\303"
+	.string	"3\002o\013\027\r\334l\233\006bqo\247\225\220\212\234\352\364\243"
+	.string	"\024\3259\357\032\r"
+	.ascii	"2\003\302\260\\\270\372)S>\246\345\236e\256\341$\023XQ\343u`"
+	.ascii	"\342\301]#\325\212I\230d"
+	.text
+	.section	.gnu.lto_rtcTimeGetMillis.28.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\235\b"
+	.string	"\266\020<7@\305(\035\325\302X8@\314DC\002\307{wl/\241\004tq\354\206n\346o\365:\3752\205#\264m\3128\206\2414\200[\031\265\300V\232Y5i{\023)S\n+"
+	.string	"+"
+	.string	"+"
+	.string	"'\243\224\311n\204\001'xw\371\201w\247\027\377<?\376;~\241N%\244\022\350IY\330]'\251Dq\353m\037\330N\260\275\n+\321bm\210S\235l{\354\314v\246}\3249<\217\235\013\354\232>@v\243\202\021\260;G\314\266\257\361\r\217?\0311&^*\357\232z"
+	.string	"\020*\321=\0368X\206\337yw\327\217DT\204\262eGP\252\205\375k\325d\367\370_\232NM\377e,\021H\262\001\233\333R\271h\230\r\314l\232\266Y`\006\303\240A\213\306\001V\n\2745\\4p\263m\032\230\305\275\235\032\204T\344T\247\037\005\be\313\224\3259\001\f"
+	.ascii	"2\003\302\260p\341\210\217=\271g\257k\"\311DS\324 \035\230 \340"
+	.ascii	"\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_dateTimeFormatUTC.29.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"%\b"
+	.string	"V\220:6P\215\322\001dVDmD\201\305\b\203/\266\n\201jTg\345\323\317y\321kP\316\233\200\241d>m\003\241\252\232\203\242\013\006\375\300\232\371C2\332\310\326R\246\024,"
+	.string	")"
+	.string	"*"
+	.string	"\f\235?\217\035\244\2374D\252\325n\204z\372\347\371\361\037r\003\021UHe\244\004z\0068\354\256sT\332\270\365\266\017l_\266O\002\036\266o\273\2631\2665^\240$d\332\0079\252{\n\343\002\273&T\311nT0\302\345\317\361\004\326\337\345\003\326\237m/\004\232j{,\362\243\247\031\221\202\354\bJ\345\260\017\260\273k5\331N\277\307_\237\372\323\242\370X\2554\220\354\222ZX6\345\231\004\\DJx \324\330\265\3118\034\354hY\246a\260\303y\310 \266U\300\253\300\332\304f\203\234\246m\020\023\367~\232\311\320\220\255\324\\s\r\t"
+	.ascii	"2\003\202a\353\352\022w\031\033T\003W\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocal.30.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\315\t"
+	.string	"\326SF=0\307(\035\305A\376\030\262s\334R\013\375\240\256O\356m\244\210\342\245g\004\372\225\364\365[\375>\301(\327$\251\373d\354\36000\300\020\013AXh\026\250\037\3602\324#\261\233H\231R5"
+	.string	"5"
+	.string	"1"
+	.string	"\230\303\355\b\230C\333\226\240\020y\364x\222:\213\344\364\202\355FNY\037=G\376]\316\340\002\3402\020@Ezj\027\273\353D\251Jn\275\355\006\333\033\373\n\001?|\353\317`:\263\364\267oa\b,\022\354\246b\n\226"
+	.string	"\034\240b[dglk\f9"
+	.string	"\221i\177\345,\242\267D~\260\273j\021\260\033#\354\260\035:>!J\3625\365\005N\013\334\361W\267\355\216T\370\256\277x~\312\241?\276<\352\320\3770\207\327\t\224V)cv4\245\232\330\317vw\255+\333i\3551!\215\334"
+	.string	"\311Ps6\235\316\023\342>^\327y\034\356\343\301\3508\016\350\3436\013\366<: .\344y .\023K\267\246\232\222\232l\220\017O\205\232\251\315\341\311\2434\325\234\002\013"
+	.ascii	"2\003\3020\330\341\364\241jZ]\270'\306FP\r\\\001s\tPq^\327$\003"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocalShort.31.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\325\t"
+	.string	"\326\223F>0\307(\035\305I\230\333)\254\237G\325.\216}\333\356\272\303\td\254\256\233h3\310\267Z\253\337'\030\345\232$u\237\214\035\036\006\006(\f\316\305\333\331\312\201\013,\252.\211\335D\312\224\0025"
+	.string	"5"
+	.string	"1"
+	.string	"\226\303\355\t\226C\333\216\230\bY\364h\202\372\212\304\344\202\355FNW\027=E\376\001\274\241E\240\224@@j\364\324,v\327yJ\215\334z\333\016\2665\366\027\002?<\353\317`:\263\364\267\357\005[Pa`\027\025c\260\007`\201\024\333!\373b[#\210\202L\246}\225\257\204\316\n9\302\256j\300k7B\370a;t\274B:\3625\365\bL\r\314qW\267\355\212P\370\255\007\360|\224C{|\371\323\241\377Y\016\257\022',R\306\354XJ-\261\237\355\356ZU\266\323\332c\240\214\324\370\300Po4\234\256\003\342<^\327y\033\316\323\271\350\270\315\347\3434\f\366:8\037\016\344y\037\356\022I\267\246\030\222\226|\220\231\247B\315\324\336\350\344O\232bL\001\013"
+	.ascii	"2\003\3020\330\341\364\241jZ]\270'\306FP\r\\\001s\tPq^\327$\003"
+	.text
+	.section	.gnu.lto_dateTimeUTCToLocal.32.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\r\n"
+	.string	"\306\023G>0\2478\035\030\335\236\351\002\260\344Y\357\356-Q\235\376y\b\341\2509\260\3206\b\260\357-\342\t\340\213\263\022x\n\211B\004\220\013\364\022\2530\326\177%\351\227\2404\241\241}\334d\313\224\0022"
+	.string	"3"
+	.string	"5"
+	.string	"\226O\217g\240|Z\276@\371th#\3708\262O\201\220P\tv7\223\"\017\257\241\177"
+	.string	"7\020K\241k\245bw\255b\351\343\226\267\375`\333\302\276B\327\356\256\245\311\376\351\237\037\377K\252U\325\257 \250\016P\244v=Z\013v5\013\224\330>f\217,\211\253}\223\237\204?m<a\3274\200\300\356x1D\230\252\234\362\2226\206\247\027\355\320!C\276Ty!\261\374\035\245a\331\345\230\360\003\\\200\307'\371\364\007\244\027A\224\317\313\210\221J\301I\244-{\034\251\f\261\037\234\327i8P\313l\264\355\333\034p^\247\341@-\263\201\037\314\033\206\363:0\343|\236\367m\031\247\323\274l\353x2L\203\277\f\256\223\201\337\327\311\260Q\364k\245\311\027\006V\"9r\r"
+	.ascii	"2\241-h`\342\342-\365\206<Xk\256\261\2550\0340\002\306\201a\001"
+	.ascii	"*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_dateTimeSplitFormatted.33.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\030\002\265\022"
+	.string	"\246!zI\300\224Q:t2$Q\")\007"
+	.string	"\374P\370V\350\245\325\375\203\211\272\361\340\322\321\375\231d\003U\210\255T\032?\370\245\277n\373\307~\315\363y\207 \bBG\211\200\302\tU\237\226"
+	.string	""
+	.string	"\240\262\235\036\347\277%do\271S\nc"
+	.string	"a"
+	.string	"k"
+	.ascii	"N`:\365\370\002\337\251\351\004\276\323\024\0063\216}\024\201"
+	.ascii	"\363\036\237\031\316H\255c\270=\376d\354\340G\347\312\230Os\020"
+	.ascii	"%\316j\242L~'tN\351O\222\022o'v\370\234*B@#P\242\206\2717\335"
+	.ascii	"\214\022\321F\356s\2271l\310x;Q\347\022\\\251\265Z\322D\016\267"
+	.ascii	"\351\266g\266!\330rB$\2746\373\267?\300\307\037\300\351C?hi:"
+	.ascii	"\247\364Jiy\334}\001\257\034#C\036\004\251\025\247\207\244\342"
+	.ascii	"\2400L\034w\373+\374\034\016\366z\223s\242\315\200\204\324:*"
+	.ascii	"8\265\212\351\364\366\214]b\337^\006\006T\033\242\r\016v|\375"
+	.ascii	"H\221\322\276\212\013\315|\bv\223Zm\273\027\265\216\013\002\265"
+	.ascii	"\0175\262\367Yk\255\037\312\347\236\250\207 \235,\332\261\321"
+	.ascii	"\240s\347~k\266\357\372|\243\f.\230,\t\250\210|\221H4\"(\377"
+	.ascii	"\312\255\020t\343\006\205L\366\f\256_d\001\206\332\341\343\277"
+	.ascii	"\276S\372\203\224\002D\215\354!p\261\2634e\334\365\355>w\223"
+	.ascii	"\034@B,)\361\260\221GV\311\307m\267\313c\2174\262\201\216\032"
+	.ascii	"\0012O\251`Z3\325bq\231.\251V\213E\305Z\275\234\334r\222R\301"
+	.ascii	"\264\302\230\225J\265j\tc`XTa\013\353Bxr\300+\231\024+l\255V"
+	.ascii	"\254p\254_\233Ot\t<\026\272\243\317\217}\317\235\002OHw4\377"
+	.ascii	"\330G\351z\245fe%\300\345\361iGOKi\022\334\2715\267\370n\204"
+	.ascii	"\0367\302\3402\355n\222/ \200\002\021Z\346\001\245\t\376:wj3"
+	.ascii	"\031\362\241\303\202\327\312\233q\275S+\234\266\376t\221\007"
+	.ascii	"\271\240\236\246c\203K\024\b\312\306\t\fA\231\267b\334-*r\237"
+	.ascii	"j\266B,\200\215*\021\213\027\302\326\005\317\236\315\026\033"
+	.ascii	"\370\354\271#\023\031VT\350e\216\310Q\202\023n\332\212\264\006"
+	.ascii	"\347\206m\340\273\264\320#\220\213{]\357\t"
+	.text
+	.section	.gnu.lto_rtcHasTime.34.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375 \367\275\006"
+	.string	"\322\314.4Pm\222\016$\223\203(\241\212\344Rw\377,\3725\332\244\256\262\257\376\354\333\277[\206f\253`\232\305e\033QU\025\324\272\230U\022\3126s\350\260\255m\"SW\025\213u\311<\314eYW\3650\227\005\353UX\303\253\f|1X\260\227\271.\354Q\266,\216\020\t<\370\371j&E\304\202<>\315\250\206\346V\354\260q\325J\335\315\244T1"
+	.string	"\302\343J\277u\034N|\247\304\321\357F\347\356$\020\021\222 \222\031*\225$\b\325a\361s\236\362\001\002\347\254\033E\250$\016\320\006I\346\366\220\324\254.\273\275\350\364\2011\242\211:u"
+	.string	"\n\231\271\323D\017\035\373\027\374\006\277D\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_rtcGet.35.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\225\013"
+	.string	"\306\026QA o\224\01601\220\231\004\342\222\327"
+	.string	"`\350\003\027\031\005\371"
+	.string	"+\314\002\272Z\005\311%\312\216\226}k\330&\206\231\033N\022L]\020\020\340\005DE\300\210\203\003\034%\270c\316(\022\367\336R\246\024@"
+	.string	"<"
+	.string	"<"
+	.string	"\266\275\200\301\307\333;\016\031\337(A\0221\331\355.\335\370\366\247\271\371\0018\320_e\341\372\f\2340\270\020\300\211\336\001\222\022\322A\236&n\224\211a\331]g\211\253p\303\333v`;\201\375\007\001+\032\214\354f\244^l\t$\321a\373>\352!\236wV\r)<\354\256\345\261\255\303\333\037\333\262\235i\377\303=>\377\320N\331=u\214\330\355\024\030Au\350\356\004\342a\365\001\3610O\017r\n\252\005\212\205\t\024\243<\261\017\342\"\034\237\303\024\264|\351\320\327\342\341\323\207<94:hx\\\be\312\356D\251\033\354\277\335]\353\311\361\037?|\351\347tV\232\n\223\235\373R\301`\231\316\245\3110,\273\\\232L\004\354\272l8W\245\2003\t\230\315\325\311\262\315eu\241?\215\020N\220\204\030I\177\213\251&\265%\244\242\007 \241\332\331\204|)\352S\320O2\244D\25091\020"
+	.ascii	"_\b\b\303N\026n\025\361#\026\352\r{\r\325\026H=\021\227\367\020"
+	.ascii	" \327\250D!JPA7\257\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_rtcSet.36.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\375\t"
+	.string	"fTH?0\251\270p\304\267\346Gr\365\032\245\243\002<\234\0237\272\213\002\346\322w\334\331\246\030\260q\211nk\215\262\016\326%\216,\370WD10P"
+	.string	"\365\324\313\222\2054tC?\030\r\021\"eJ\0016"
+	.string	"4"
+	.string	"7"
+	.string	"w\320\236mo\320\236\331v\205\005\350\360#\t\351'\004#"
+	.string	"\256\335\221\323\323\303g\350?\345\020&\017DZ\002J\240\247\002\306\356:\305\322\307\255\267\035a{\302\276%j\262\257\3725Mc\232V,\235\232\376\002\310r-\2700\260KzE\330\003\031\201\224m\320f\260\235i\377\344(\340U\237[vM)\326\356Ha\211\355\231\307\tD\006\252WL\263\200G\211(_NU\375h\302\226v\007'/\246f\204\210\024d\177\365y6\224\377\321\236]\265\201\003\225\326"
+	.string	"\220P\276\354\021\224:b\037\333\335u\235\033s\311t\232\016\267\361\272\316\303p\033\215F\307a>\016wy\260\307\221\371\270\216\347}\234\307=\266j\362CmCB"
+	.string	"\b\nB*2\246\376\352+\036\037\345\356\223\027\237=\t"
+	.ascii	"P\213RF\214\325L\274<\203\225\032\355\314\204\226\256\001\310"
+	.ascii	"\016q^\327$\003"
+	.text
+	.section	.gnu.lto_rtcGetDateTime.37.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\323\002\r\025"
+	.string	"\026g\212I\3200\2511\222\025q)\004\257\360\301\354\035\364~\205\n\274K4\327\374\211\030\203\321!\310h\345\003(#\304\320\255\366\002\005y~\343\342\007\200\234\030\"?\205)\3306\262\026O\227\363\001\326\030\220\260\253\357\254\221-\267\224)\005u"
+	.string	"m"
+	.string	"w"
+	.string	"\366\203.4\363!\231\203\334\273\003\236\270\3674\340\002\254[\237\017@\336\262\036B\336\332\366\t\202\031\317~\372\340\274\307\206m\304\360\336\263\254=\237\235\264c\2453\237\346\344\317\317V\251\034 \202F8\016\037\307\003\265\341\316\007\2566zT\331\232\336\263\241u\034\260\323Q}\340j\306\021\245%\333\201\2477\270\032\245+\224{\257\351\r\267\341^\335\266i\273\304\256%\0019\241\0164Z\264\317\032Zy\354\217\367\336\353\272s\307\212\272\365\241\337\232\232\256\250\037B`\227\333\351\031\326\340yq\212\304\273dQ\204\370\371\333\367I\334\b\346%, \367\242\003_\356\263\210\316\351\305\206\361\211\376\263]\216\271\317VG\314\005\335{]1\266\353\226\3323~\317.\333\247\354\027CN\313\026\244\202\2727\207\344\326$,J\003N\367\336\004\276\212\330\004\237'C\336\376w\312\323@\314\005\ti\264X\217x>5,"
+	.string	"\372j\253\375Z\241\277y\244Vi\\\253\016\016\252\223\024-t\306\031\331Q\337;\213\211\210\206\007\275\357=SD\347\364\233\017d\261@\177\353\250c\245y\225\207\"\260V\036_F\266\352\201\007\351M\365\244f<\331\320*\373&~$\363y\206\231\3647\223\274m\325\033\235\362r?\001\261\307*P\277LV`,\261\262\305\204\301\314W\331\302B\001V\276\\^J\023\021\233\027V\\\312\230i\272\224\256\223\366\361\326\235\311\247\fEH\366I\013\202\304\"\244\361\237\221\264\336T\243\320j\215e\343\275\037\024\364\016\002\345#+\017\013\006oR\22115lp\246\250\251\030\016\276\024uc\230\362\3400\222n"
+	.ascii	"\275\370\177\206p%\021\302\341\237\022\341.Rl\222\020Hx\025\362"
+	.ascii	"?K\370\n\225\2172 \200\002\021\272\253\007\227\f\375\252\360"
+	.ascii	"\216\210\257@\342\017m\240\243\311s\244\335-\3029\314\361\320"
+	.ascii	"\243\311\024[\016\357J\341f\r\372a\036\270>\354\261\225\034\241"
+	.ascii	"\306\215\033{\031X\203\347\211\365\"\274G\345\021\256y0:\177"
+	.ascii	"W\037\337\342H\310<\006\321\030%\300\007,\030J\367&\3530\213"
+	.ascii	"\235\267k(M\230\020\030\3516\357\0333\225\201\201\362\260|\036"
+	.ascii	"\236\264\314\036"
+	.text
+	.section	.gnu.lto_rtcSetDateTime.38.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\275\n"
+	.string	"\326VN< O\225\016\007\214\307e*\264\201\301_\324YoG\340{3\361=P"
+	.string	" B9\017\323\374\bS\n\302\r\223,\263\026\203\001\200\t\00484\305\222\207\300"
+	.string	"j"
+	.string	"R\210&{K\231R="
+	.string	";"
+	.string	"="
+	.string	"\273\037\002\033\260\036\375\335Q=Z\037P=\332v\002\005\030s\3778p\336\301\302\206\204\213\335\017\323\r\347\236\234\177\321!\250\324\302\353d\236"
+	.string	"\030\354\256\323\353\\\270\365\266\013\330>`\177A\351\n\246cL\303\207~\205\3517\004d@\321 \305.'\365bO\321\364\301\366}\021\037]\376YG\220@\273{]\354\353\3616\306\276lg\332\007\361\020\230\207&<\300\256\247d\",\242^+\315\023\025>]\246\f5\352714\231\362\225\376\b\202\226\367\240~\364\306\007\306'\003\325i\306V\252\332\022*y\357\3520a8Q\320\214\375u\251\032\354\303\335]\253\307\206\001\226\007\351\354\001\321$\026l\262i\332\226a\023\211\003\r\313(\025\354A\300[\004\b\005\263l\033\005\363\2479\\\365\370\\u\321\255\025\235S\006J\243\235+\365K\234\224\371\036\f\211D?R=^\205\027\t"
+	.ascii	"w\213\302\2631\354Y8(\204+<\303q\227\331A\005\315\274\212h\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_rtcGet.part.0.49.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`&\001\215\r"
+	.string	"\246\232[C\020\221\223\016\363\230\020a\f\311\323R\241\312}\005\266\207\371{\231^^\360\337 \217\362\037\325\335g\264QC{\357\347D\272\b\360\366\211"
+	.string	"\200\"\224\224\nz\327@\331i\206\357\250\257\350\253\325\275\267\224)\005H"
+	.string	"L"
+	.string	"F"
+	.string	"\232?\307s\300?\315\013\300?\373%\374\001\":\261\355\017\220\221\267\307\017&_\221)Y\315\330\215\327\237\256|\273\246\333\3744\241\220\256W\035\301\b\030)3,\224\rO\002w"
+	.string	"Bv\327\032\016\367\273m\007\266\027\330'\021\036\336\n\026\333\2079@\212\020N.1\325\262\026\"\003\220\267\216\013\352\"%\223\362}\024_\201~\302\232\362\242ewA\367U\"\233c\217l\2165\037E\177\tu\304\325pbM\373.71\372K\350\003vQ,1\273\261\301\237\025\004>\353)<~\bK\b=?\004\377T9@t\270\246\276\344\006I\266\274I;\243\2207]\257\372FD\215\030\0321JJJU\261\272\273U\224\3554|\374\037L;\230V\230\316\227~\200\004-\004\234vMZ66\332\335\361\020\301<\3325\222aX\326\271F<\021\260\253\363\251py\030p6A\344siY\366\2718\266\363n\025\345\253\376`\206\005\214\212\3747\b5\203m\250\016!\321\222\252\212m\247>K\373\312$C5\325\3511\234J\331r\031"
+	.string	")opr\240\024T\220\266\212\201TP\201@"
+	.ascii	"y`\204+FLl\200R6~\311\006O\346\200Qf\2042\337\331\330\031Q\b"
+	.ascii	"\016\235\363\016\355\264Ps\030u\006\222\324\3005\357\277\266"
+	.ascii	"\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`\024\002u\013"
+	.string	"D\020\020\003"
+	.string	""
+	.string	""
+	.string	"\002\024\177\030\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\r\031\200\204\001"
+	.string	""
+	.string	"\003\002\027\177\032\0021\177\033\204\202\202\200 \f\034\025\177\035\214\260\273\304"
+	.string	"\272\200\202\002\030\177\036\002\031\177\037\002\032\177 \033\177!\034\177\"\035\177#\036\177$\005\016%\201"
+	.string	"\002\037\177& \177'!\177(\252\333\3426\"\177)#\177*$\177+\002%\177,&\177-\005\023.\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\021/gistry"
+	.string	""
+	.string	"\005\0170\005\0051\001(\1772\377\037"
+	.string	""
+	.string	"\200\200\200\001'\1773\003\003$\003\006\200\004\001\"\003\006\005\202\007\003\007\006\320\360\372\250\001\001\202\006\003\007\002\033\204\023\003\007\033\261\217\205\327\002\001\304\033\003\013\007\f\007b\003\016\017\006\022\003\310\377\241\372\001\001b\003\023D\003\024\024\005\223\327\3232\001\302\001\003\025\025\032D"
+	.string	". \300\002\221\223:\007\fL\251\370s\031"
+	.string	"\331c\202K\031\035\030\221\354\343J\357\225Ccd\r\303G\031\366\\\344YL\251D0z~\344pv\306,\331p\264\333_\206\036\276\301?\033D\300\227\204\351\033\204^C\267\bz\360\r\377l\004\360\231g\002\364\207*#"
+	.ascii	"\246L\254c\037\310\204#1\260\245{\311\204F\251e"
+	.text
+	.section	.gnu.lto_.refs.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375 We\002"
+	.string	"\264\003S"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\027"
+	.string	"\001\003"
+	.string	"\004\003"
+	.string	"\003\005"
+	.string	"\001\024"
+	.string	""
+	.string	"\001\033"
+	.string	""
+	.string	"\001+"
+	.string	"\001\f"
+	.string	"\r\001"
+	.string	"\001\016\017\021"
+	.string	"\004\001"
+	.string	"\001\022\023\001\004\025\003\027\002\r\002\030\002\026"
+	.string	"\006"
+	.ascii	" \344%\200T7@3 \327\271\312\023"
+	.text
+	.section	.gnu.lto_.decls.ba0219fae183c22d,"e",@progbits
+	.string	"(\265/\375`b\037\305\214"
+	.string	":\340\3640Q0\022\322I\007\256_\220\250\205\311\310\335M\316d2\266D\340\035\370\356\357\177\277\217Y\375=\261\231\"n\251+3i\354\330\2160\333\270u9\315\372s\007\307\020UM\211(\346\3564\361\210(\242\232\323\262\330\252*\252j\314\354m\246\304\210%[\312\024\210\002\366\002\036\003S=T\037n \037n\314\341P\266$P\220A\344\005}\2105Ui\364\234\367s\035\333\261\030!S\237\227S\243g1?\343q\030Vc\347"
+	.string	";d\264rH5\312>w@g0A\035oTE\032\275\341\2364\275s\334\223\262\027\240\363\227\236\224\331\\\357\016\007E~0i\324v)\241*\325\316\276\032\375\231\013\3235\020G\270v4:\347\303]\317:\275F\317Q\352Y\312\031\r-\260*L\246\203\344\271\311.2\264\312\314\232_lSS\250\b\311\254fT\300ml\205\325\354\212\246\302\210\262\324\273w\005\372)\270\200\333\030\n\223\331U\353&\273\244="
+	.string	"\005\rY\023\277{\327\263\033\307\361\026~c9\326\302Onc,\3475\316\362^\357U\336{!\360\261B\200]\321\343A\277B=\032\217HmfP\031\215\323\370Y\202\257\234\2370\330\203L\353]\273\b\240Y\224F\317\202z.\221\332\300@.\221\376\004\365#\250\007A\365\341@M\200G\244\267@\375\341\021)\207q\024~\036\300c\247\340\202[d\330\375\272w\335\311I\343\225\346L\243\217@=\213\035"
+	.ascii	".\367\202\333\250\347\003R\016\344\003\322\267:\001\217HyxD\332"
+	.ascii	"\354"
+	.string	"\344\347&\374u\200]\316p\336\262{W\021;\353\017O?\032\375\312#R\225{R\032(\030\032\355\324\272\200\311\021\267\374<A\234\315\337D\275\346s\234\277\315\204\300\314t\376^\362\363\bp2\b\377\336\032\362\340\337T\351\337:~~\033\373Y\213\033\233h\373\331\003\266\237\263\260\232]\340\357\032?k`\205\027\250\322\3109:\236\277ex\340>\177\267`\007\250\374w{\334\177-\377\345\376\303\375o\273\224\377%\376\007\021\3607\t\377\001\177V\332\233\237\217\374\214\344g\255\237\215\374\\\344\347\254\237\267\314~n\376L\344\347\253\262\377;\277E\372\271\304\317\3757\013?\223\375\274\376\374\365\263\222\237\271~n\372\331\370s\016?\023\177\006\3729\351\347\033~.\372Y\350\347\032~\246\341g\031~\016\372y\205\237O\370\231\204\237?\370y\203\237/\370\231\202\237#\370\371\347g\006~&\340g\022\377\347~\036\340g"
+	.string	"~\316\371Y\370\377\357\277\001\377\037\370\277\367\177\354\377\225\237\355\317\350\3774\377\313\374\357\373\317\367?\210\377y\377\271\374\247\373\377\365\337\202\377o\377\007\b\f\f\f\374\203z\277%\363\013\220C;Ut9\274\032\355\256\246\252Z\263\333\342\313\261\373sn\365\251\357-\356$\317N\302|>\353\265\021t\307\274&\336b\3243\363\245G\032\210#\215$\275\227Wg\rfVV#Q\221,\244\255\371#l\232\373\242\242\365F\202\2625\t9\343\276 ]\030\020p_\3247\033\021\"\215%L\372\025yc\365\322\004\023\033bb\352\331\213\033\310\263\201\364U\315\022\225\303\323\273\314\033&Z\bg\025\321\363\352 9R\314"
+	.string	"\317\032]o\320z\230\335"
+	.ascii	"S\337S\315\343\335\343=\332\252\204\365\326\260\211\262\214\222"
+	.ascii	"\362\273M\346\317\337Uo+>\234k\200\r\233\027^\217F_\246\306\205"
+	.ascii	"$mW\032m']\231\264\033s7SohH|0\026\324\007\217\034m\215\276\243"
+	.ascii	"\324\377\347\36421\357\2756\202\353e&q\316A\316a\313\013\374"
+	.ascii	"G\257m\340\356\336\037W}\352\226\025\246\035\235\300}\327\275"
+	.ascii	"H\021w"
+	.string	"\275\314\245X\025r\371\344\002%b\275T\003\\\261\037w\271VA\241\316\333w\275|\225UP9,W's\271:\221<W\351D\336\273B\361,\313\230\220\274\024\253\202Z\2129\241D\\\345E^1&*U\351\204Z\3029\241x\226bLPKe\025\224\b\037WB\316\304\370\013s\302tK\345\245\3614\305\304\344\231[\256\316{w/\227\275\270\314\005\356\235r2\357\230r0Zr\216Fr\n\223\223I<%\255\234W9\267\344r\336\313\225<\272O\026 \327\271;\204\347\220?\246\356\214\027\367\022\360t/\222\357\334\275\027y\357\0252\247\326{\245x\226ZOO\3676}\236\356\0242\355\305\275]\206\207\006\265\024\263r\002\245\215\211i]\030+\222\265\356]\025S\025CB\2713\370T-\250\250\275F\327\365\257K\215!\032m\035>9oR\246\\:\365\335\374\373\207\316\321yRO\2104\312\b\334"
+	.string	"z\343\320\361B\3628\322\350\001\035\3657T\333\350\244\r7SW\200>\032m=\036\221\236\250\001\364f\276'g\013\317I\254Q\t\270'm\031\355\304\317\257\365\214\367\023Ky\215r\275bC\330\220C\032E\331M\335A\270\226\366\262\033F\307x/\373\005\216\262\227\350\275L\314\n\3500+\020\\3\302\024EM\375\273I\231\263c\254J\314\263\225\235\024A\311\2160\2156\262\231\336\311\276\267\223\0268\357e\352\344\016\232{\231v\230\025`V"
+	.string	"eb\225%%E\317U\002\001Q\360R\367\327( \017\301gt\202\367:\361\264\356\275i\370\311\200\214f\365Q\233W\302"
+	.string	"A\3213\024\225\375\330\f?I\360\037\357]%\241\274\324\036\356e\022)\007\0062\211\364|\245\376,\004\t\341\2224\037A\312\264\245[cp9\372\230O\210,\262\300FY\217\311\360\363p\274w\264N\206UTv\b\3175y\256\262\312\030\275/#v\207m\352 E\334\373\003\214V\226\005\302\"\261G,\226\325\342\2475b\235\267Q\366\306}\3263\2305b\247X\215\347\256>\370\272\203\340\246\256L\326\234\016\232\343y\006$\227%<\311\033b\253\354\025\3175\327k\343\206\312\034\237\024\021[\204\237v\310}\326{\313  \221s\006\214\337\223\364\312\n\301A\223\261\003F\2436\210\330\233\323\017\035?\370i\201\300"
+	.ascii	"\002\360H\243\326\352yh\f\244\f\247\257\341Hk\022\327\350\323"
+	.ascii	"\037\324\247L\365i\322\366P\277\350\361\220\003T\0374\243>\330"
+	.ascii	"\247>(F}\320N\375\255\016\333\f\212i\351\223\263M\262.q3\222"
+	.ascii	"]T\036\356I\023\340\236\264\177\270'\2655,\224M2A\013r\306L\201"
+	.ascii	"\310\226\263FQK\243\337\262\264\236\236\032\360\356\210\031\224"
+	.ascii	"\031g\201}:\032\265N\352\213\340Z\t\033\036U|\354h\364\326\351"
+	.ascii	"o!\254\f\036\002\001\357xDj\227@\2671n\344\262\350\2015\212\003"
+	.ascii	"\245\314\255\262\214mj(+3\0064S&Z\2315\004\330\352\263\303TW"
+	.ascii	"\004F\243\366Z&\233\374kj\324ft\231\362Ro\221W\\\214$i\264\323"
+	.ascii	"\274\003\377\032\341\027Si\306\245\276\3214\340_c\001\341\324"
+	.ascii	"b4\372 \226\372\366!\f\325\237\372\"\310\243D\r^X^\221F\337\177"
+	.ascii	"\177\373\265\231\031;\232c\032\275\216\020@\357!:\253\354\355"
+	.ascii	"\255\321\234 \023\037\037\030\247(\251.\030\\\256.\037\0312\215"
+	.ascii	"5&J\252+\213\271\303\316\313\2301\215\204\301 `f+.N\214\230\316"
+	.ascii	"\253\271\314\263(\251.[Ff\257\255\321\316\253A\262e5\343J]]\343"
+	.ascii	"a\245f\232V'\2307\036\017A\363\342\251\321\276ke\252\266\344"
+	.ascii	"\207\267F\333\256\233l~$\255t\351\246"
+	.string	"%dm`M\350\350\332\013\231\217\235\271\255<\252F\333KN\223\325VT\243\315\245\251n\236|\321\262\005\275\332\262E*J\312O\307\356\t\246\321\2435\342\236\035\327R\275^f\332\374k\232@\363\366\234\300\001\276\275\265\333\265vOQR]9nB\260\200\200Q\263di7\365.U!f\206\320h{\273\005\271\330h@5\332l\255\024\323E\203\213\355\312\225\306\362<\243g\363c\017\315\232\332\033\013\253\305\035\211\243\032\253R\245\321"
+	.ascii	"\270\316{\265\204c@\202\320\273\211\241\305I\016+o4\032\352\333"
+	.ascii	"\223)*\313\245\232\231\365\224\364\013\230\251\0374L\026\036"
+	.ascii	"Xg\357)8\240\f\221\3224p|\320\021\351b5\024l\253\031\344*,\254"
+	.ascii	"\311\232\244\306\336dgK@&\215\366\263\225;=\366\336\2344"
+	.string	"\332bMu\004F_\024>s\243\304\257n\257\22782l\250\365\320\361\365\325\253*\004\342\004\366^m\334\200\224\331k\264\237\260\2271\"r\215\266\223\246*c\267\244rFG\253\017\013\331\350\355\213%_\322L\270\331A\224)\275\032*LRe^o&\017\",Z\f\255\030\216\370\321\211\002V\034\225\220\212KF\241\245\025\307\233\037\031\213C\035\220\212E\004\034\205\214(\250?:qB\220\t*P\034\207F\305\241c\0028\020\021Y\244\030\026\211)v\\,\021S\354\034\177t\302h\t\205\321R\017\221R\213\021\216C\343\215\322\212\016\032\205p\216BJFKA%\243%;\344\001\311\210\032\215\303bQ\321\220\320\305\022\221\b-\036\227\354s\\\024\217F$\243a\013B=EC%#$\026C\302\242\241\261\005\252DD:\016\035\207\212\212BFK't\204\206\307!\026KI\303\240\343\3208l\301h\211"
+	.string	"\025:\307\241\n\343P\tD\307\242M\321\360xDb\261\244B"
+	.string	"bP\212 \027\216E\342\221\n\237\244\341\321\350B\205\b\026CD\304\023zR\004\271\200\002\217\212\343\220\204!\016C(\334\034\207\222\212\304\021tT8:\"\301"
+	.string	""
+	.string	"1HD\321\360X\034:\032\205\351\004'\216\305\241\245\023\307!\tD\307bN\021\022\213\241\027B0\232@t,\002`t1T\204\236\250\005b\220\210\023!\025\207JC#\365\026` \001\006\031\354 |\006\033L\260\301\004\3513\330"
+	.string	"\bh\003\f\200\324c"
+	.string	"d\217\024T\300\202H\004A(X\034:\"B\215BFH+\224\210)p\204(\034\207\306\025+\210B<\034y\216D\307b\315\321\346G$N\\\032\026Q\034\211\304\"\212\033#\022\013\026HI\251Qh\230\204\0244<\016\025\t\335\034\2050"
+	.string	"R\213CC\027\350\321Q\211\230\024t1Td\215\305\026\304\243\240qxl\241\204\224$<\nepTBj!<\020P\212\004\\H\201\004\225\350\3040\t\351\210B\211\230\224D$B\241\2044\224\204\202\250hDq\302\307X\244D$\032\032\205[\354j\337\254$Y\"\207d'\312\332\243J\034\231\020\355\305\325\023.\352\306\2314b\367\326\315\245>'xZ,\231\335\222;\255v\303\372\202\363z\322\326+W\0325\251F\355\232\315r\313v\313\326\226\315\006\006\246N\274\220\245\250M\263iVMEZ\305\331+\267j\307qZ\272\271\301\2411\261\021\306\357L[\261\262ab[\322\252\364\225\215\327\236\221f\243\366\314\372`\317\332R\261Sn\317\276#\274\353Z2\245RZ\nM\312\335\b4\263MJ\230|q6j\303l\230%\343\260[#"
+	.ascii	"'\3144L?[\206\243*p\354\366kh\214\256+d\215\332.')|\215\336\212"
+	.ascii	"}e\331\311\265X\224\235&7\202"
+	.string	"`\255_5ig\222\340\340R\177f\263\253\217\323\202\271\177{]\3676\177P!\177N\360\354j\301\314\350p\002>)\002B\206\245\321\013\231]\347\247\355\262_%\\&\250\037\266;\304\023\277\313l3a\317h\t\202\245Q\353e\231\360\363\3076\251\251\343\343QV\247\236\177\322\235\237\364i\026%VIK5\317U&\247\240\261\r\277\251\2501\013\343\326\006?-\f\313\345\003eE\336\310\375\221\225\241\322\324\350\326\252\024:\3518+\363R\317_9\254\2160?H\331\346\027\036\017\353C\311\026\213#\202\261\250\222\3310\207\362\224RfjdD$I\223\016\222\n\020\004Ci$\350\360\006\022\200\0059\320*\310FFA\222\202\244\3764\007s\t\366\220f\275\271\027\273j\224&\317M\033oB\357\277\345f\027\t\3671\026\212\232#\"U\232;\330\200\202\223\020\345\341\237\n\021\256\004\210\330~Y\220\361\267\n#"
+	.ascii	"\273b<@\n\0138\223\002\316\236\372;\266\261\363Y\230\001\254"
+	.ascii	"\224\b\204R\020\370\371\370JI\020\340\261f\033\250\353\034\277"
+	.ascii	"\231\f\256u\337e\357\253\311\333\340s\037!K.\021\227\020\347"
+	.ascii	"\320\257(\002\277\371\001n\004\324\361\217\"Q\315\036\200V\241"
+	.ascii	"ql\315'\312\231\003B\240\030d\251E$\242qmkK\216\352\201(\016"
+	.ascii	"k\370\207\230d\341I$\321\207\025'R\330\375\366\260P\0077\025"
+	.ascii	"\377\234\250O4\020\304`(\344Ch\2256\335wdr\210\023\225o\251\004"
+	.ascii	"6\"y\367\232`\n\353w\300;\350S\217\033\371\005Eb\237O|\373\322"
+	.ascii	":\300\331\336?\322:\233\347\rub\275%\360\250S+\370\f\214Wd\255"
+	.ascii	"\034\357tkk"
+	.string	":\321:8\031\262N5\231~\344\344\344\345\255\235\372\002Trm\006(\261\354\335\027\223\3518;\033\246\377\260\276\346Yd\025$W\315\034\203\344\036\366\016\004*Bw\006]lJ\366\345l\177\354nB\315G\243\202Lt\247\320\353W1AsB\271\203j\303\232\320\026\303\321ZNk\277\245\313\b-\221ih\023\353\027\357\0214\030F\2131\320\314\025\235<bR\324\225\224I\255Y\342\224\301\244p\027\327\b\301\275E\361\353\230#\tn\255\255\206\002\263\022j\344?\277\213\b\005}\003`;\322\312\227)\360x\267\3444\313&w\263\br\242\327\027\rV\215\230\243\300\241L\342\274\314\236\232\026TjM\001T\305\300\241\354\255-\277\311\205\334\254\365\337\320\006\332\327M\032q\3064b\242\372\355\\\001\315GR\302\2623\223:\212\265\375\252\020\313\273\214\235\360(\3612\271\316\355\233\020zx\341\tg\334\202\237\246\254"
+	.ascii	"\216\b!\033\273\367\3504\316\254k\f\250\321ReE\b\332\256H\304"
+	.ascii	"4T`\025\366\006\370\ri\245\003\201mr\355E\003\200\302\2218\032"
+	.ascii	"D?H\253\"k=\271\256\273b\247`\246\353\277\267\023j\216\334g|"
+	.ascii	"\273\337\223\373\250hF\326=H\242VG\031!\263\344\335\006\316h"
+	.ascii	"\377\224\005%jD\027+h\240hY`bRS\341\030\365\006i\346H&\001\001"
+	.ascii	"\227\312Q\246C\357\230\244:W\300\253'\017n\235&\363\373pI\204"
+	.ascii	"\327\2642U%,\035\273*\"\3410a)P:x\327\343&\001\266\355\307#\255"
+	.ascii	"!*K\213\032\\\314\324\254\nI-\306\342x{Gw\372\351\246c\352\363"
+	.ascii	"\300\242\003^\376\221\272\241\371Y\006\241\244c\246D\336\330"
+	.ascii	"gr*\372\340\322\210\200_&:\375\231\315\317K\333<^\231\363m\317"
+	.ascii	"\367\022V!\004\276\342\221\021GN\223f\270KM\007.Q\213\026P\034"
+	.ascii	"\300;\300\312\002{,\nl\214\223\220~#N\f\255A\327Db\030\320v\f"
+	.ascii	"\344\301\343n;,%\220\315i\252,\267sAM6\223\204\024\220r"
+	.string	"x\256\020\330\332\322z\035b\333\302}[N:\022g\272J\036\242\210\203\227\267_#\333\311D?\366\311\344\374n\230H\245\021\261\0176\217uWC\005,I|\006s<\334\034e\005\b\336\026W\035\231\036\023\226tM\364\223\007\377:\330\242\377\212&\250m\002\3638\023OI3\373\237\236i\352|\265W\344D\346G\246\206\202[8\274{Lo#z\205\233Dn/!\301\246\320\025W\201\022\234\0041\200\0175\372y\223"
+	.string	"\212\352\263\364\343\221\227\210Y\033\325\037\346\0364\317\355\263\020uA\264\t\251\t\224\370{\r\304\321\216\021\354q\320A\346\341\030\242\307\202\334\b\227\244j\253\003>"
+	.ascii	"w\270\247\244!\372\020h\273\013*\0074z\207A\202\035\300o?P\021"
+	.ascii	"A\265\253.\025\375$ht\250\345o\003\221u\031\033Pp\213H\2758\304"
+	.ascii	"\253\220\036\n<Q\257B\316\314\3464/J\343\252\203~\005u1\3109"
+	.ascii	"\246l\205\275\3021\310t|\253C\230\236\260Mv\017\317.\332ZL\351"
+	.ascii	"\257\340~DZ\\\337\374\377\321\335j\033\201z\003~\371\216\207"
+	.ascii	"\371\246\247\320m0O\230\355\322\313\267\215\300\270w\307`F\333"
+	.ascii	"\335\225\323\007\230\f0\330\034\301!9U\325\335\2257\003\203\351"
+	.ascii	"\237b\311\310cv\244\013P\353\037\363\233|{\317\026\n\037\025"
+	.ascii	"\2369w\345\317\3576w\264\035\024\f\341\364^\244k\203cQ\217x\325"
+	.ascii	"\273\270\367\360\371E\346O\271\215\367\321l\217\327\212By\300"
+	.ascii	"\374\240\320+\351\210\3607\266b\276\273\317m\207\346\211\355"
+	.ascii	"\003=\357\335\035uQ}\215W\001\367\237\301z\231\316\177\327\033"
+	.ascii	"\263\334NoV\375\302:\240{C\315\333v\256\027\373l\276\036\347"
+	.ascii	"\266\343\274\037\314\276>\261\303}uq\030\356t\277\020\341\266"
+	.ascii	"\346?\222/\206\\\243\203\313\205\364\t<\240\016\255\307a}A\013"
+	.ascii	"\365\002\317\235\374\020\205\272\301\211\217\360\205V"
+	.text
+	.section	.gnu.lto_.symtab.ba0219fae183c22d,"e",@progbits
+	.string	"rtcTimeToDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"rtcTimeGetSeconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"rtcTimeGetMillis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"dateTimeFormatUTC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"timeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"dateTimeFormatLocalShort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"dateTimeUTCToLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"dateTimeSplitFormatted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"rtcGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"pgResetTemplate_timeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"timeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"timeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ba0219fae183c22d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,738 @@
+	.file	"typeconversion.c"
+	.section	.gnu.lto_.profile.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375 \354\r\004"
+	.string	"\264\005\340"
+	.string	"\n"
+	.string	"\232\317\241\374\t\002\002"
+	.string	"\002"
+	.string	"\001\201\351\223\225\002\004\364\223\222\365\n\006"
+	.string	"\002"
+	.string	"\003\303\224\212\270\b\004\004\344\300\270\257\t\006\005\251\243\200\233\007"
+	.string	"\006\331\327\376\320\001\b\002\001\002\001\002\003\002\003\007\221\334\215\370\004\n\b\376\242\274\376\b\030\002\004\t\241\221\303\212\f\f\002"
+	.string	"\020"
+	.string	"\270\3129\211\240\002\3301 \030q\260\001\025\026W\f\304Y"
+	.ascii	"k\0011\200 \231U\271\003]l\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375 \274\225\002"
+	.string	"\364\002\260"
+	.string	"\n"
+	.string	"\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\004"
+	.string	"\001\002\002"
+	.string	"\001\003\004\005\001\003\006\004\003\007"
+	.string	""
+	.string	"\b\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\001\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\017"
+	.ascii	"T\331\200{\273\t]\005\002\004Q\003B\220\003\250\001\002\202\215"
+	.ascii	"\005\345\033\3102\350\005\030\262\001,"
+	.text
+	.section	.gnu.lto_.inline.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\276\003\005\023"
+	.string	"\226\036gC\020\221\324\0307oW81r\005g\027\343\270\256\254\352Uh\016\310\037J\255\271\264\355rBk^\373\0075\304\b\214\304H\366\023\361\320"
+	.string	"\300 \024("
+	.string	"\200\006\t\246\353\271\254l\024\211]I\331\244L)\005U"
+	.string	"Q"
+	.string	"W"
+	.string	"\375\214\013\025\213\216N;\267\333\305\316\027\36447H\324\006\364\\M\177P\203E\006Oo%V\003\243#\272M\340\370\006\177\365\351y\220\t\241\"\240.\211\365\332\2028"
+	.string	"Zr\b1ZZ\236\276\217\355\310\347\234\023\276\267\345\334}]\362V]\312K\250\365\024~\b\"\237\3052\270\304J\317J\221wc\206\214M\254gG\036Jl\035\3149QZy\327.\243\342\b\030\025\216_l\021\226O\325+\214\212\335\376\261\375\344\335\214\212\362\250\306\332\364\0164\"\264B\345\024\312\277\036\366\020\304\205\034\224\205\245\267B\203\231xe.W\316\364\026\257\030\031\250#\321v\006\241Z\255\226\303\247X\317?<?y\r\370\024\343S\2176-\255\024\036\355\204\270\357)\310\326\3447\260N\205"
+	.string	"\266\257\277\355\332\3448`\235\252@\243ga\351]\nL\314+9\016\344\241\220\255d\037\225\236\213\205\t\252W\212D\001m{!6\243y\365\366\235\216!6\243\365D\267\326\365k\223X.\211e\022+"
+	.string	"\364C\316RA\303\213\312\327\313\225\344\275\346\234 \323\333"
+	.string	"\342f\346\300\347\206\371s\224\n\217\317S}}\n^\215\204U\327\022\004\244\344\344\310%I\236\f\0166hB\275\354\245+S\250\341<f\020\031\242\tfd\0244-\034`\002!&U<\022\300\224U\203,\223\210h\371]v\261v\317\263\362\373\242j\035FN/$\007\357[K\324\266\275\342c\022\rPI\313\027j\264Q\251\335D]\031\205\003\314\314\2009\241\035\226\265u\254f\302*O\306S\252\245:\243\nJ\343\236(\307G;\340\327'.\177q\226\334\360\307\324\215\036"
+	.string	"\353\006\236(M\364\031\342\210;\n\217B\211(kp!/\214\255\202_j\345\252gz\tR\314hU@t/\0323\030\275\3558\307W\t\001\361\240\3151<\036\265\316)'\224\213\274u\315\037F\334i\366\332\255\274\351,\211\2043\337\245\363'"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`E\002\035\t"
+	.string	"\342\215&'\200)I\0073\260\314\210\327\f\21700\003\317u\025\\P\031x\234X\367\267f\035\003*\300\242\330,i\273m\"\223\f<(\273H\222\222\302\fl"
+	.string	"\365\b\240>q\021n\260\021\352\263\252'\236\266\262\235\025V\006\344p\301\271y\211\373W\305\036"
+	.string	":\342!\356\313\335\260oXOx\241\212a\030f\305~\270#\004\313Q\214+\326\217\031r\356!C\275\363G\035\207=\244\307\370\226=\013\350\235\376\353^\221\327\277\"#\245\224\256\206W3iG\217\275\243\267\374\207\t\017y\024\002< `\"1\254\352\257\222\b\244wx\263\300*t\n"
+	.string	"#\001H\006\337\322"
+	.ascii	"\332\251\371\205\002\240\321\335F\2113\034hV\333\253)!\354\345"
+	.ascii	"\201\006D/:\206V:\230\275\227\306\234\n(!\200\023\007$\344\202"
+	.ascii	"!\202\203\361\027\224d\325\006Ea\365\330\002\002\357\211\326"
+	.ascii	"\226\025N6P\356\206\274\315\005\261[\032\260\332\301\303\301"
+	.ascii	"\"\336\026\327\261\317\215}\352\032\221\023\305\355\020\037\267"
+	.ascii	"0\242\005\026\257i\206v-\362\206[\004"
+	.text
+	.section	.gnu.lto_.pureconst.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\200\004\006\232\004\007\232\004\b\232\004\t\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375 \335\235\004"
+	.string	"\222\307\033&\220+\215\001+\007\034H\254\253w\325=D\037N\214\347S\215{q\235\r\006Q2\3164<\365$v\373\357-e\noB*"
+	.string	"\216\\tX\267\n\311\265\365\025\023\"\304I=\215\243\0019\235\205 \363\370\274\310ds10$\020\212\347a\246O\270\006\232\276\373\251r\246\307\343g\346\252\331<#^l\251U\225Af\371\225\177\016=\370+\001\r"
+	.ascii	"+\001\351\253yU\205\021S\b\215\353\334\205\245Ua\200;\240:\203"
+	.ascii	"\271\363\314L\240a\f\024\001"
+	.text
+	.section	.gnu.lto_.lto.b9c1d531e9d13416,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uli2a.2.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\334\003\005\033"
+	.string	"\3661\255I\260\226Q:\345\025\340\\\234,\306s\002\272W\213\204-\002=\260p\024Z\364D&\314\231\224\245\220\033B&\376<\377\275\345\237\017\211=\266\376\240\377\240\377\224\301\227X\252c\365\347\264\362\022>\231B\373!\232\220MH\332I\006\234"
+	.string	"\222"
+	.string	"\222"
+	.string	"\033Sk\f*\017F\207\005@\317]\3770\020\233\223v\211]\265\356\222\242j\355)X\007\243\303\355\371E\035\216\016@\035\256m\267j"
+	.ascii	"\020\013H\020\221/\265V\330gl\271\340mf\225\344(\322\026\370"
+	.ascii	"i[\277\262\b\351J\230\345\0027K\221\202\f\242\026&\r\304 *\362"
+	.ascii	"\270B\307P\321\024\243\f\025\201\005\236\202&\365\255\205[\240"
+	.ascii	"\b\204\302\310Q\206^\200\021~VRn\362\314\351|&\230C\205\357&"
+	.ascii	"\0378\202\022\322\251\360\024)\324Zw\n\351\210\2742\336]%\273"
+	.ascii	"{a\3679\002T@\272\237\267\333+1#\320\370Y\355w\2737654\036b\013"
+	.ascii	"\260\223\367e&\033\200\225l\227\223\354\231p\256L\313>/\253t"
+	.ascii	"\222\2274\2237\206\316"
+	.string	"\035\303\271b8\227zn\350\271\240\347\336s\247\347\232@\231$\200\227ZQ\204\001S\237\204R8\354d\373\274k#\353'\247\235B:bUk\315\031\035\332M[\356\256\017\007\254>\013H\202X\325\332K\340p+\214\016\231F\f\230\251?K'&|\310N\375\242j\255\nV\302\354Y\210\315J8\001\216\362@\233Tn\254GP\207f\"\264E\374\370y\244\201\313\323\334DpG2\247\027o\034\214\360\364\036S\220\347\201\253\245\013\224\335\370]\002\013x\216\225\237\371\263\245\\Q\362\211\347m\214w\212\276>\215\370Xj\022\376uc\001O>l\035\274\237\214\200K\226\240\253\033=o\335\372ni\025\243\337\234,r5m\034\312z\356\237\317q\3623\177\353\372?\247\3703\2377\016\211u?\374\201\n\272\272\201\265\326\n\256\353\254\337\374GT8\035>3\314\213\004=\0356|\2039h\230\261\332\324\241e\320"
+	.string	"\356\324d\337\330\002\331\354\003\215GG\204l\026\323\tA\242\007&\233\355\354\314b0\331\207\f;\260\030\017\r\266\340\300\316B\350\360\300zf3\036X\331\253\006\313\3621\317\205>\236\334\356\263k\032]G\201`a\324\203\313m\206a\235\267W\214H\033\326[\027LT\2214"
+	.string	"^>\347'c\260\001\203\254\371\202\255\231\223\317\031\207\266\356&\273\266\354X*\317\333)Bp\215N\312\3005J\326\250\032\227\3125*\363\\\3536?\017*\034\222O\315?\005\205\223\032\277\001P\25010\202\214d\314($3\301hS\230\306p\002\241\302\352\006\020pW\242\244\003*\237\227\"\004\025\340\267\346\026O\300\310\325\260\211\270C\245/^\361\275Z\220\255\3044\367\332[\026\340!S\017\177\367\022:`\261\216\365\037'|\376X\032J\270\003\"q\337\375\344\377c\342\"]c8\337\267\006\222\303\367 \2150\2768\333\365\t\341\023\240\240.\017\313\254\316j\370\271V\020\321\317`\235\365>\350b \b\352\225\022\026\273\211u W)\234\336\221\007\321\226"
+	.ascii	"D:\365\265\271\326x6\375\236\350/\324\220\322\245\247\267\216"
+	.ascii	"\240\177"
+	.text
+	.section	.gnu.lto_li2a.3.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\376\004\345\037"
+	.string	"\326\271\307I\240VN:\205\367\206\273p\20136,\005Z\3517yP\352C_a8g|\373\300\304G\213\242'Kii\367N\206\327\037\372{\341\234\361r\232\234&\316\3101N\314\235\370\363JN\352\177(\344|3\262l%\204\310\235R\264"
+	.string	"\251"
+	.string	"\262"
+	.ascii	"\245\025\324^\352\220?mS\242\021\016c\255D\036#8\265\237\343"
+	.ascii	":z\257\262\330]j\205ja\254\265\362\370@\355\245\211\2271_\326"
+	.ascii	"\016c\276t\317&\253A\302\215%aQ\251\265\356\226\205M\237\333"
+	.ascii	";\356\274\331j9\263$\227\366\374\246)JB\017\307\235p\242\347"
+	.ascii	"J\203\025L&~\003\220\202\251\304mH\226J\220:\307\003\220Z\"A"
+	.ascii	"k\367\231x\216\\A\022\021u$K(\310\004ge\307\033\221\2509\243"
+	.ascii	"\351\345\215\0170UT\0226\235\034\361%\005\034Q\361\204ExD\336"
+	.ascii	"<\211\215\270\325iP\370\243t\245A\255\325TI\310t\263\334\366"
+	.ascii	"\023\333\flr+-\316\312\274Pv\016\216I}cSSR\323\224\3243%\265"
+	.ascii	"\314\275\356\030\222\032\346\\\367\013I\355\242{\327\335BR\263"
+	.ascii	"\220\3249\334\213\367i\253\235\370\233\257\372\313\023\357}\325"
+	.ascii	"MI\352\353\344\224\314h\325*\"\255J5R\036e\274\370{\375\\\177"
+	.ascii	"\327I\373\376\217{\371G\237>z\327z\3217:\253Wt\036>\220\007)"
+	.ascii	"m\234]\224hd.\331"
+	.string	"\200N\\adu\322\325# cd\321\253\034\266\037$T\321Qv-\337\307\226\277\250\272\312j\255\013jE~\226\317\227\376\325{\024\035k\207\254[\016\204\354(\253\2258\340\001\303'q\302c\313\266P\3762c\226\376\300\001\2631{(.\373\2620\272u\331\037/@J-\267P6\231D\225\270\275i\241\221\017\332\3560\223e/uU$\267_\226=\220\352\334\334\226G\305$4\262\326Z\315\333w\314sq\013\006\224\372\255\026\030\222\260\334\241CT\255\315\334\335\340\255\036!F\324\326\326$-\227n\320\246\373\245\020%\t\315G\323H\236\013\231\376W\220\020n\t\f\337\310|\331\262D\212\217\246\331\300\315\265\355f\215\001\247~4\315\345\326v\207\200\001\315|4\215&8\344\304\356P\314,\367W,\256\304\216\350\231M\374\321\035\332O\020C\0320,\206g\270@\177\210\200\326=\004\200x\033\204\202|:"
+	.string	"\361z|8\024\r\355\200x??\274\236\035\320\006\013?\273\236 \241\035\201"
+	.ascii	"\346q\360\t\332\r\361xA\273\223\350;y\326l\313\006\255\376\200"
+	.ascii	"\210\021\337\376\354\n\306S\022Q7\244\340vh'"
+	.string	"Q\267\234su\020@\220\335lvk6\370\343#\274x\272\341\254\311\334\367e\307\324\355\215w1\243q\325\344\210\236\235;4\265\031\354D\346\315\005Y\255\300\211\314\231\203]\2679\2735\300\200T?\234\335\257\"\360x\263\376\327\004!\037\306\211(\231\321\354\315\322\256$\264\232\265\331c\001\247fVfi\366\300'\230\225\331'\241\371n\033h\250\201,\203\020CJ1\241@d\244\005I:p\002\231\2713\017\020hG\263)T\032\003\377\330\241\223\2000\255\227\203T]\020\214>]\271\036N\344\300\024\023\026\305\315l\324\f6\310\r\337\216\347\002&\036l*\317+\r\027\005\204Z\3039U\275\264\035\0044q\201\021\366\177=\224\033/_d\374\232U\241\242g\223\216\364\201~\272\321M\325\037\345,\303\253\375\310\f\001\354\260\262}\306]bH\366\002\322\372\201\326\313\204S\0277\242\243\316C\217\227S,P5\351"
+	.ascii	"i\026\265\375(\335g\263\311\003\002m\262\007\2640\320\\^\266"
+	.ascii	"\347\257Ln\313\331G\023\242\226Ww\002\275\022\025\352\257\334"
+	.ascii	"g\333b\215)P\245\006?\221cs\275\023q\002\241\377->\024L\334K"
+	.ascii	"W\322>\345\0135"
+	.text
+	.section	.gnu.lto_ui2a.4.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\267\0035\032"
+	.string	"\346p\250I\260\226Q:\345E\340J\343\272uhOf\232\266\334\007Z\257\343\310\315\237\345\277\364\271s\262\026k^\367\f\216\342|\343\r\031\341\350\256\341\363\003\316\316\316\206\034>\bJ\026\n\260{\376\025l\nC\373%\237\220M\266\334)\005\225"
+	.string	"\213"
+	.string	"\222"
+	.string	"\226\260\003\342@<\350K\3737\216Cv]\214U\265\256\260\301T\353\016\201\031\210\007\007<"
+	.ascii	"=8\317B\017Zf3\201\361a\371~\220\244\324Z]\353\302+\317\225\235"
+	.ascii	"\265\032\305\220\266\346J\231/M<\321l;g\241\230\311UH\241E\320"
+	.ascii	"\211\217\004V\004\r]\024\"\002\032\222a\021\240\2419\240\367"
+	.ascii	"#\351yN\2745C\237\0211^\004(\305\204\340\213j\272\322e\315\326"
+	.ascii	"#g\256\304\367J/PC\212f+q\031R\250\265Z\322lA\267\312m\003\261"
+	.ascii	"\215\301\336Z\277\325\361\344c\333\305\331\273\035\t\341\205"
+	.ascii	"/\312{\263a^\256\273]ZXn\364\003\370\322\275\362\244_\345\273"
+	.ascii	"\277u\335\317\232\322\243\352\274[|\322\035^wSP\032\234\322s"
+	.ascii	"J\357\245\345\245/\240A\213\227!\265\216\370M\251P`\223\214/"
+	.ascii	"\375<\373;\374\336\222\235\304\035 Q\007\013ZT\255\325\202x\360"
+	.ascii	"W\362\3126/fV\336\205\037S\242j\335\0358\350\n\366\3468\222\354"
+	.ascii	"I:_\251\36565a'J#;)a\252\265\"\b\033AHj\326\004\256\317D\203"
+	.ascii	"#\217\300\360u\350\301\007\241=\231\013\256\344\261\340\341\266"
+	.ascii	"\354\221f3\306\335\235\373\231\n\271\273\027I\214\213\233v\022"
+	.ascii	"\205\310M\334\333\201\003X\013HBH\337o$\211\021/\\\234U\267\023"
+	.ascii	"]Y\003\"d\034\t\221\273\262_\3623\305#\177V-]\271\357}\n\021"
+	.ascii	"z\232\025\321\305\371\255\275\2316\231Z\230\035}\364\220\177"
+	.ascii	"\f\025\267\346\357\211\216\206\204\220>\213\313\332/\370#5+\232"
+	.ascii	"\265\326:\335Zqavk\374fD=27\0368,\207w\330 _8R\306F\303\2069"
+	.ascii	"\203\003[\277\022\300b\037ljd@\300b/\031\032\235\033\027,63\023"
+	.ascii	"{\271`\0374\314\270^56\256\004\005\034\243\221\251q\335\304b"
+	.ascii	"5\256\325\256~o\366\\\205\313\2625\323\200\342\331\036\3738\324"
+	.ascii	"g\312`\353I\201\302#\177\254\305YInj|\021W\005\225\323\215-*"
+	.ascii	"\033n\355\275\213PrLF\227\365l\261\226n\3551T\265*D\2708Z-\316"
+	.ascii	"2|\360\034*\251\202\347\320\337r:\321O\317\241\343\326T\373\262"
+	.ascii	"\016\204~\263\242\036\227J\25010\202\220E\312(#3\"2\232\246\003"
+	.ascii	"p\002\241:\253\016\020pW\242d8\004x\276\336\253\b\031^\263\036"
+	.ascii	"\244\031\224\327\226C(\227\305\221\304H5\376\254Y\031mi`.ko\371"
+	.ascii	"\200\337\223\377\f\374H\340\330\032cX\353\177'|\022U\260w}-\316"
+	.ascii	"(\344\251;mXg%\240\bD\241\364\003`\364\304\262\317S\210\240\204"
+	.ascii	"\034\246\225\227J\037]:\222\213\225\031v\211\223\317h\347\255"
+	.ascii	"\350\305\030\257\202\242\340OG\036\304\271\004'\342\344\322\323"
+	.ascii	":\353\265q*^\277E\326\224\216\236\216;\202\376\001"
+	.text
+	.section	.gnu.lto_i2a.5.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\344\004\345\037"
+	.string	"v:\312I\240TN:\273\327\032\260\351\213\031sO\262\327\fW\020_\2742\360N\337\257\222\365\311\250\336\213x\bw\037\332\277\223\020\204E\245\311\346\035Oa\324\340\337\352\355\204\037\377\236xu*\254q\377\177\356oF6\022\t!r\247\024\266"
+	.string	"\251"
+	.string	"\264"
+	.ascii	"UBW\251\365\251FW\255A\033/0O:h\236\332\267\361\033\274S\031"
+	.ascii	"\314\265ZQ8u\325Zm\254\300<\031\340.\345\311\361,\345I\363\354"
+	.ascii	"$\017\262\250\0276\025Y1\251\265\352v\205K\237\313\373\355\264"
+	.ascii	"\325L\\I\216Ky\276\360\003\230\202\030\001?\374\326\264D\317"
+	.ascii	"\023\034\025J&n\023\200B\211\351\265!ILc\200\341\005H%\225\240"
+	.ascii	"\346{&\216\033O\210D\270\370\220\244\023\343\315\031q\370.\""
+	.ascii	"ZF\2218\371\256\323\31403\002\222\3708\342;\022\020\222\202\f"
+	.ascii	"\00584\3168\371\030q\341\351\021\320G\351\tN\255\325\324\b\250"
+	.ascii	"t\243\3346\231\355\007\366\350\"\3240/\337\272]H\352\026\222"
+	.ascii	"\232\205\244^\271\327\2552R\247\344\256u\243\214\324\270\333"
+	.ascii	"\271\356\263f\276\352/O\365\223\257\272\367T7\035\251\017\240"
+	.ascii	"\f\023\"\243\244V\021E\264:F\016_\234\353\367\372\265\376\255"
+	.ascii	"\217\366\375\035\367\362\207>u\360\216u.\277\313\347U\320s\370"
+	.ascii	"<\336\243\002\030\215Z\353\271\205\343\0031!\350UB\013b\002\232"
+	.ascii	"\257\025A\3304R\252\032\t\020\210g\304c\371:\262\ff~H2\261R\030"
+	.ascii	"\021k\255\016\314 \377\312\347I\333A\267\252\031k\026\204/4b"
+	.ascii	"\255A\003'\315\300<\371\3236\r\036\007\357\001O6X\251\262\005"
+	.ascii	"\220^\244\254\312\036InQ6e?\374\bdI\3547e\342\366\311\245\222"
+	.ascii	"4\362\2666\256\036\343\217j\257)q{)!\220s\277\270%\213\314~S"
+	.ascii	"c\255\265\226\266\327\224\347\336\266\370\223\362-\226\030\021"
+	.ascii	"\220\\(\023e\204\330Z\271\273G\027\336,\203\221\266\346z\244"
+	.ascii	"\344\322=\262\351~mLbEi=Z\034m\356S\372_=>\267\"-|\241\362d\256"
+	.ascii	"HY\217\026\235\340\345\326\366\206\t\353\027\303G\213&\327\334"
+	.ascii	"\006%\212\277%=Z\2049\nk\332\205\262\201\223\033\203\324D\350"
+	.ascii	"c\210\236\331A\037](\3737,\316\210\336'{F&\246\f?\0332l\206k"
+	.ascii	"\300@w\200x\3269\007xv\034|zt<\360\354rt:\004\375\350xv;;\273"
+	.ascii	"\034\035\017\207\013;\272\234\036\037\335\001\032\357:\350\364"
+	.ascii	"\350~v\273\036\335\031\354}<]v\346Jl\254\267>\233B\327i\200<"
+	.ascii	"\230\224\335\026\312dQi6\231sscQT\266\227]\227=\372\360fYT\022"
+	.ascii	"[\314z\304}Qj\312\334:!\255\020\032\031\242g\347B\231\326,v\240"
+	.ascii	"\362OQT&\202\003\225,\017{nev\301R\3617\345\213\331\006Kf\277"
+	.ascii	"!\314\372_\026|\374\026\377a\264\244ea\226n\025\245\271\354\313"
+	.ascii	"\336\352\027\203eW\266e\377sJ\331\225}QZ\317\266P'r\244*\253"
+	.ascii	"\266\001`\250q \203\020D\006\242\241@\204$J!\035p\002\031:\253"
+	.ascii	":\021\240\2615V\f\031\346*\362 *\304\254\233\312\244\003 \210"
+	.ascii	"\231}@\033\336H3\276\252\365\031\247d\376\022&z\354I\212\035"
+	.ascii	"B\b|d\217\257\2117\334\202fY\336)\306=\257\262\034Uars\277*H"
+	.ascii	"\020kh\230\263\364\033v\226\255\320,o\n7\220[?\236\213\212N\317"
+	.ascii	"+\361@\027\264\235\323\210\r8\360x#R|\031\221\021\303U\263\026"
+	.ascii	"XRI\361\bi&z\221;w\216\307H\\]Z \266\234\365\214\301e\025h3\330"
+	.ascii	"\r\357\027qp3\371\332\317J\367\261\216@\264\233\226\376\350\234"
+	.ascii	"\243EK\305!\261'\205x\320\237\310\374\214\377\022o\002\n\374"
+	.ascii	"\332\352ZN\221\240\032"
+	.text
+	.section	.gnu.lto_a2d.6.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\322\001\245\020"
+	.string	"v\037pG\360\260(\035\251\205\306{\261\215\276\202}\370\343\336>\232\306\255\224h3QT\2375\353@\350\217\2120\177\256Q\260m9<\004\2451\266\020\330\231\236I\313\007\257\227\231464X\224\312\003\253\017\345\267\204\354\275\245\224)_"
+	.string	"Q"
+	.string	"^"
+	.ascii	"!n\324Z;\001\333Aw\312\005@w\366\205E\355\246\321)\233Q_\222"
+	.ascii	"\335\372\245\203&\267\005CfYLX\221\tnT`\270p\305\024\324\372"
+	.ascii	"0U\\h\302\322\323\302\303\f\013)+\333\222\200x\243\002\nKd\207"
+	.ascii	"\254\025ca\313(!\310\254}\324Z\317'a\312\276\263\377Q\376\033"
+	.ascii	"\370Y\013=\216\343\370n\3710\237c\276gcv;\314\337\230\2575\237"
+	.ascii	"2\1776_2\277\233\317\315_\020\235\311\002\330\250U\302\230\243"
+	.ascii	"\346\314\032\016\377Q?\367\237\371\3678\200\332\030\b\357ZE\221"
+	.ascii	"\246\326Z\340\036\333\316\377_\020\373\202\372md\fC\270\255\r"
+	.ascii	"\253,\034\225\b\342\2000%h\2732\314\346f\177\254\024\247A\243"
+	.ascii	"U3\347\236\250\354\221\n\262M,\023*\021\344\0235d,r\301\336\206"
+	.ascii	"v\177\272\031\260F\254\313\211\230\323\355zgO\224\333\201\314"
+	.ascii	"\212\022\306\361\245\331\023\335\346^\225\b\362\370No/l%\n\n"
+	.ascii	"\343j\226\342\361\217\221p\273\376\r\017D|Q\250\344\201\204|"
+	.ascii	"\243\221\222'\032\231N\"]\311#\221<QW\002i@\352D_H\027\032p\317"
+	.ascii	"4\372:\021\317\373:.V\267[\276,/\0314\264\bDh\236^\027/\227\311"
+	.ascii	"\365\302\266\243\341\025\241?\275\365\326\377H5(k\255uS\240\265"
+	.ascii	"G\353\217\365b5K\251 1c\242\315,\205\3216\005$ \340\"\t\354\272"
+	.ascii	"\001\366\001o\347yj\206yU\337\256\261\003\271_\245l0\262\246"
+	.ascii	"zA4\316\350\267\016{[#\324`\301Y\356~\004\177\226w\343\336P\013"
+	.ascii	"\200\023\267\306 \217\032Hmci\275\342\274\216\201\036\b\027+"
+	.ascii	"\343\336\223\r\333\313#\344="
+	.text
+	.section	.gnu.lto_a2i.7.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\217\004\375\037"
+	.string	"v\273\320K\240\024R:\024l0W\340\271\353\2200\016-\217\202q\257\213\322\274Wj\312I\224c\277\216s\2162\375NF\345\237\323\301\013}\265[\037h\320\005\334\r\326\t\264\200)\302\336\177\332h\001\353\2679\354\325\353\362\2555B\266\334I\006\277"
+	.string	"\260"
+	.string	"\277"
+	.string	"\374\252[\375\234\351s"
+	.string	"\3672eu\335\3134\300\n\230\207A\177\332\356\202\376\344Z?\005\304}o\022E\327\275\327"
+	.string	"'\260\375L\240\340\207\201\316da\364f\216\241\033Q\356\275\274^\301g\005z.\305\335l5\364\264]\201\370\f\224\320\210\216 \236\373\326\260\246=\365\204\263W*i~\2101\311>\020#Au(#R\275\351\2245l\037b<\001e<\2525\034\021\032N\226F \217\332\002I1\022\272\343\220\205)S.9\327k\361H\254\347S\211[\353\340\313\204\221\356(d\353\213$N\016eL\252\375\255[\031IhD\307\022\2575\b\367^\256D\307\021g\2263\363\021f\236\300l/\004>\350\317[[H\032+\"\005\3254f\346\260\366\222\371\004\320\234\252p3\361\256V\266\251\251U\246\251\225gdj\225cje\230Z\345\227Ze\227c\375"
+	.ascii	"Zt,\277\372s\351\247~\334\355\314\337\366\254\363y\255\263\375"
+	.ascii	"\324\271k\345Z+?@\255\252l\027v\257QZ\225Kv\366\200\361\254_"
+	.ascii	"\353\374\035\347bNYx\035|z!\241q\357M\205\314\351\3173\377\360"
+	.ascii	"s|\213Sf\326\342\371%\032oD\312\255\263{\231\022\262\030\314"
+	.ascii	"\006\302h\303"
+	.string	"R\3528\273\367\336\374\344\b\026\213\277\226<\260\331x\363\347W\f\306\267{\227\2004\260\375\024`\273rAd\030?y\242\364a\353%\237\327Ac\272\007EL\003\221<\210\311\352\005\245l\251V\341\f\206\326\206A\342 &\357D\224$C{\311;RI\313\322\035\242\270\352\315\317.>\205\224\223\325\365\231\242\252\352\255m\027\277u\333\231\224\223mi\266\025\327\335\305\333u\320\227\346\320\024\362\256\353\240.\375\322'&\207.}\256\333\037Hi\335\2653$\241\r]\t\252i\366\336{\317\036=\277\026\026<\350\317\226\276\021\004\267\255\353\nJa\304\030\273~\263\364\231\020\223\271>\373\215A\211\007\021jX\323\302Dx\205\260\275\344]\347zWd\325\024\023\252S\332\214\212\013\023\335\313w\371xb\314\232\370\001\300\347\360\370\032\230\303\343\2638\302\r\034l/(l\017\275\312\275\003\276\337\007a\020\247\307\367\353\341"
+	.ascii	"}vx\276_N\316\257\307\363}\330\220\303\353\005\205\274\003\003"
+	.ascii	"\370\007\304\t\362v~\277 /e\006Y\371\355lN\317\346>[\3066\247"
+	.ascii	"\266\271m\327t\221o\335\234v\263\355\3564m\335\020\025YP\017"
+	.ascii	"Y\246\371B40X\345/\364g?5\221rT\323\325\354\336\373\246o}\200"
+	.ascii	"\212&QGVr\275\344\005X8\233~\221\031N\266\231[\323\214\"\024"
+	.ascii	"\246w]\274\371\256\253\212\244\232cBuJS\271A\254\221R\260\351"
+	.ascii	" \022I\220\254+\"\256\227\034v\032+\232\006\"\307>6\244\342\272"
+	.ascii	"\001\265\230\351W\250A$\205\020c\304!#$$B\2244\006p\002\221\272"
+	.ascii	"\353\006\020pZ\232\016+\320\241VJ.\bM\\\350<\344<\356\232\007"
+	.ascii	"a\221\021\312\277>\212\311\341\013N\323\026\225/R\342M\306\366"
+	.ascii	"\001\257_yI\021\0173\261\336\331*\314\005\334G\227\026\032\213"
+	.ascii	"\275*\334\004\n\035\rK\204\312\016^3\371\314\341C4\002X\340\177"
+	.ascii	"\033\354FWJP#\300\340=\020\025\2333d\363((=bj\205\036&\233\003"
+	.ascii	"\243\0359 \321^\342\210\313C\264b\365\342j1Pp.\250\215Z86\366"
+	.ascii	"\340\320\211\366\341\\q;r\tTUB\203\225\242vF\261L\366\330\020"
+	.ascii	"\374\347KM\307\250\001"
+	.text
+	.section	.gnu.lto__i2a.8.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`t\0015\020"
+	.string	"\206\036pH\320TQ:\204@r\351\365&\313"
+	.string	"0\232\213\020\233\031\362\210\031\271l\023>4R\303C+\270&'\216q\277\013\004\265\001\\Ya\224a\035$\230w'\301<\b\204\240\003\235\2644\211y\020\f\f\231\362\370-\331R\246\024V"
+	.string	"U"
+	.string	"["
+	.string	"SD\340\026\357\035J\332\366s\334gfZ\212\030\346\224F\030/F&s\212\237\305\243\220\336y\037@z\2673N\273\\\245\371\037/}B\243\033\216\346R\347+\017\024\r-9\301\331H\024\034\033\267\217\327\033\\M\265\024a\316i\275\341r\356\356\266al\257\260\377\023\233\242\323\263C\210\215\036\331\"\215.\217}9w\307'\323\201~\357A\177\351\342O:\320-W\275\252VU\377$@\f\"*A\346\304\3115\231C:\242\036\3333\333d\007\035q\361\364@\264\013\230s\307G\312{gU\373?\3271\273\250b"
+	.string	"s\312\360\021\232\001\366iQ5[3\313\345\236\026Bhd\273\261\353\367\230\221\251\221\032>\215\364\356\343-I\215\346\\\234\207\314\233\323\346%\346\331\036\030x\267\233\242AT\2439\335\003\t\221\330\210j\232\223\235\226\326\333\257=k\241\277\231\026e[\232\257\203\260\210\rGMs\017\217\212\204vy\\ZRV\221\002\305\t\023%H\214\020\021\002\304\007\017\0358l\200\321\220\001\303\005\013\025(L\220\320\340\205\201\313\202\224\202\026\226\004\005X1\025\013\251z\353^\255\274\300V\f\306\232y\201+V\214L\346{\201.\027\270\372^-\225\353[\301b\337\n\001\2031,\330'\003\202\260\317$\316\313\271;\376xO\311\320\2175\255\245z+\367\306\001\032"
+	.ascii	"Y\b-\257Q\226\b9qC\001\207\030X\357\254\302\212W56\224\240\240"
+	.ascii	"\216\307\331\345\032\256\2611g\210K7\001\303/\0240\327\325`@"
+	.ascii	"\247%\021\004\022\362\021P\363\340n$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_itoa.9.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\223\004}\036"
+	.string	"\0068\305H\220\330Q:\205\t2\345U\210g\327\226\372\342\230\3435\227 \322\273\025\263G\013W\006\247\343e\003}\375i\277\177\250\315\372\335#Z\033\224\004\352\371\304\325utXOt\nr%\206\004\032W\017\215\333\377\244\221\275\345N2\256"
+	.string	"\242"
+	.string	"\260"
+	.ascii	"\017p\257\325\222+\367\036\203X\310\274eJ\231\377\344P\234~\344"
+	.ascii	"1\266\335[\205u\345\336\033\304\016\314[\237\312\314\374&w\342"
+	.ascii	"\304@\236#V\324\305L\021\221h\367\036y|\374\256\2745\237S\336"
+	.ascii	"6\221\003\217\273\331\314ZikS \277*)RV4\3268\356\366S\025\365"
+	.ascii	"\343\266\203\201\372\221\374\217\026\324\0245kC?UQ@^\353\361"
+	.ascii	"\262*@\023\306Fg$\326\335\216#\305\177\r\251\255\007\316\206"
+	.ascii	"\2249\030(\037\265\207\212\213\224\rZ\245\336:\343S\365\271\367"
+	.ascii	"\036y\232\303(\244\2646t\357eZ4F\235sg\346(\314\374\202\271\032"
+	.ascii	"\005\345\233\366\207TBz2\256\337,\262\276\020\323\202\364d>\n"
+	.ascii	"i_1\277\317\363<\271\255\230\t\224\224{,\345\001\367:\363X\312"
+	.ascii	";\002J\312;KY\347T\3169\2262\316\267~\335\217\177\356]?\356]"
+	.ascii	"g\233\245lZ\3125K\271\264\224-S\256\226rW\312\264R~\201\033\331"
+	.ascii	"Y\202\262{w\234n\256\231\025Cr\257\237\312\277\252t\025\330\245"
+	.ascii	"<\371{\024\376\224\256\312\202v\357\305\335kHx\303\203\230)\240"
+	.ascii	"\337\267\200%\224\215\307\025\0164\367\036\203~\314\270[\312"
+	.ascii	"\354\304\214c\356\362\212`\322o\001\0037rd1\315\277\230U\234"
+	.ascii	"\314g\336\3734a\311\034Z@p\273k\241,\261 =u\372dXg\206bB!5\223"
+	.ascii	"v\327\306i\376\327/\006}1\247}\206]\203\273\313\306\351\nXc\206"
+	.ascii	"L\204\214\034\022\304R\366\025\227\335\355C\n\tW\027\333e\177"
+	.ascii	"l\230&\327\266)\262\301u]\373\303$Bz\262\255\273\205\262NbZ\320"
+	.ascii	"}%_\354\310\227#c\204\017\334\002S\242&H\317\2605gAl_\361\221"
+	.ascii	"7\321\260X\351\333y\254\344Jqm\353\034@\317\265\316\032..O\264"
+	.ascii	"M\355\253w[q\201\323(i\037qyy\242m\030\300y\236i\247\021\354"
+	.ascii	"\242\005\213\025*R\2408Qd\242\004\211\021\"B\200\370\340\201"
+	.ascii	"\250\003\207\r\0322`\270@a\202\204\b\020\204\0368h\300\340@\222"
+	.ascii	"\317\350\250\032]\351\214\264\200\251\247\344kJ\232\301\324C"
+	.ascii	"J\202\361\223\301c\352--\365\220xLJFK<\244&\037o\201\001\356"
+	.ascii	"\301Hj\342\311\350\365\232x\270c\360\365\266\225\256\217\374"
+	.ascii	"u\024\307\314\202-\2547i\343i\256\246\256\t|\313\371Z\210\220"
+	.ascii	"G\240\225\245\207(\311\034\242g\300\255\326\272\336i~\222\247"
+	.ascii	"\326f\357\204)3\363\306\226\314\265\331'\246\005k\235\244\b\030"
+	.ascii	"1\215\036)R\231\231_7\325\204Y)s\232\253\255-@K\321\217<\220"
+	.ascii	"\026\030\232\232]\363\305\212|\034U\250q,f\230R\306\224L 3\263"
+	.ascii	"\2400i\003\240\"\231\253\333\022\200\226E\b\241\271-\326\377"
+	.ascii	"3b\344\202Xi\026\013\257lX\205N\035\363\372xK\266\340\2702w\216"
+	.ascii	"5\326vH\314\366\\\302\3027\301\337\337\021\370V%H\374\255*\332"
+	.ascii	"\026\212\301\020 @\334n\255\004\001\300dqV\3716\254\346<q\201"
+	.ascii	"\366\301~\203\336\377/ZH\300\232Ev\035\002K\250\331\364?'\346"
+	.ascii	"\016\\\202\337\035\305\317\225\236\003\365*\023\232\352.\"\254"
+	.ascii	"\001\027\330L~\033\034\263F\276\236`\355\317\224\341\220\344"
+	.ascii	"\"\013\246\263\n\007\343[\305\200\256d\002\344\365\201{\036\370"
+	.ascii	"J\026qyK<*"
+	.text
+	.section	.gnu.lto_ftoa.10.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\307\006\215%"
+	.string	"\nA\200\016Ip\332U:\003v@)n\201h\003\200\245j\233\354`\301\314Gi\306M\222\002\331\342\020[\254\374\254\0015\307\b\006\246\232\313\221\235\367@(\247\037g\340k\275P=\304\027\342S\326D\034]\025\201\353\272\215 B\310\336I\006\320"
+	.string	"\307"
+	.string	"\337"
+	.ascii	"Nm\366\252=\231H\322rv\022}\355\t\355=\023\250\363\344\314\003"
+	.ascii	"lJ\316\316\242v\320~\355{\273\237\344J\236\356l)\275\223\263"
+	.ascii	"\026 Sr\316E}\324~\355\251\335\335\007\373\221\247\206\372q\376"
+	.ascii	"\250:\231.\2510i\316N_;\357\303~m\017\200\375\212}\034\352;]"
+	.ascii	"\016w\263\355\2645vU\361\205\352\227]m6\313(\251\214\337\351"
+	.ascii	"rj\202\254.3\036f\231\245\372|-s\\\334\r\307\327\362\306\265"
+	.ascii	"\351\370\216\332\300\205\024\307\303,\261T\\\034\2511/\273\201"
+	.ascii	"\257\345\325m\r\324\276Ue\343\254T\362\256VWmTV\307\252\200\254"
+	.ascii	".3tTQ\352\201\263\035g^\366;E\205\274\2676!\347\334WIU\365\346"
+	.ascii	"\275\273\245\335\215\324\315\206\b^\310Sis\246\245b\346\221/"
+	.ascii	"n@sK\230N\317D\345|\f\312\341\035\206\300\365Lf!\257\020e\326"
+	.ascii	"\031\226\022\224\303?V\323&_\242n\234n\272(\204.v\274\345\005"
+	.ascii	"\316\362x\247\335N\343\305\314\356\253\031\363\030bo\013\235"
+	.ascii	"\311\337\273\2237\320z\233\347Q\336\274\235\356\316?w\347\273"
+	.ascii	"mo\327\3726\313\336^k\267U\3666fo\337{\373\btXgD\317\234cL\347"
+	.ascii	"d\350Z\245\353N~\261\037\312\037\345j\367\273o\326}{\367S?\354"
+	.ascii	"c'{Y\337\272;\nSk\\\266Of\221\264\234\363\017JS\317\310\313\231"
+	.ascii	"i\304+\347%\210?\371\363\351bMm\366\262\020\006\226\226\3632"
+	.ascii	"\003\024\327G\017\236\356$ux\027c\237)9\2736\3072\347\211\246"
+	.ascii	"[\363&\r\230\253!9\fv\303\270\234a\341\270\270i#\255b\005\372"
+	.ascii	"\274]\240\032A\260\215\256%g\266\236\0027\373\230\260\347\207"
+	.ascii	"\210\02182+P\027\330h\024mF\241\017s\327\225\215\032itA\221\232"
+	.ascii	"f\364\330e"
+	.string	"\246$\321\332\301\314\223`/.\321\304\f\357\266\335?\340\275\362b\034\031\0304\n\033\333\"4\322\350\261\326{\220\355n\005\037\013\372\240\345\234#\254l\316H\243G\0263[D\017U\207\221\266\300\300;\334\342)&\226\207\177h\210i\002\006wm\357+\354\315N&\374\0254%\017\356V\221t\257\354\227\235H+\211\215\315\303<\370f\267\340\305\365&)=\346\341{I~9\336i\234\234sO\213\217\213\\e\222_\310U\207\025XI\006mt\273o\220\t\351\307bep4\024\332\206D\341\322\017H\324\240d\302\206b(,.yX\372\021\221N\334Z\274\201FC\242pE1\310bH\004\006\225\234\226|CbR\022\021\350\033\n\177I>`q\205\317(\250\211J\301\242o\211H,\372n\316|5c\036\215u0\256\240G\214\024kRs\336\222p(\177\032\223;\355\236[\303=|\323Zq\177L8"
+	.string	"\255\206m\315,@\367\276\271\260}3\205\332\326\227f\316\311++\264\311\024B_\207p\367\005\fB\270\207\207\360\005\334\r\034\356\225B\370\232\311\270\234b\260\347\007W\037\212\375Z"
+	.ascii	"-\272\342\036fq\207\3463I$\300]1\201\036\356\366\360\241\007"
+	.ascii	"\204Wl\353\232J\325\241s'V\305@\370\206a\254b\025\215T~\250a"
+	.ascii	"D\205\214b\246dF$\210$M\212\r\220\242\221\262\343\001\022`\205"
+	.ascii	"A\2179f\024HI\352G=\007~\024\030\364\002\257\305=w\333\277T+"
+	.ascii	"\026\215F\222\031NKXG\323P\030i\002\216\004\\\2262\316\026\253"
+	.ascii	"1\365v\033\260QJ\357J\341VM\336\366x\250\272+\3222u\030 8\300"
+	.ascii	"\n7\376\233Mj\235\211\203\fM\214u\251\377\340\005\265\314\316"
+	.ascii	"\0162\320\276(\023\f\272\353@X'\177t\355(J\240\314\261\203\375"
+	.ascii	"\320\313)SN\016\023\2415\031\341\036n(\210\254`\202b\206^\023"
+	.ascii	"u\241~\243\361\325`\246\233d\343@\324\376#\265\303\003\017|8"
+	.ascii	"\345\364\007\205\313\233\255q\033rv\035;\375\214\355&\206\376"
+	.ascii	"b)\341\026F\352\246\037iX;\021\364x\f\260O\305\372\250\215\021"
+	.ascii	"\261\261\342\272\266\251\017\005*:\2033\222\200\006\347\264("
+	.ascii	"\357\355\3535\376\0254\323lp\205Q(.\243\236\3134\034l$\036m\276"
+	.ascii	"\346kT\273\032"
+	.text
+	.section	.gnu.lto_fastA2F.11.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\331\f]B"
+	.string	":r\370\030AP^N:\367\300@N\00493!\307kY\273i\0371s\227\007\221\232\b\322@s\364\227\3350\264\363\t\330\227B("
+	.ascii	"`f1\003\236\373J\371\254\037\310T\377\377]_Us\263\226\220\235"
+	.ascii	"\266\224\001\213\001c\001u\001\335}\25527\024\315\326\037\037"
+	.ascii	"#\301u\3353\3532\334f\330\370\367\306'p\003\261S\313\314\306"
+	.ascii	"\035\246\3074_\373\261\261\217\335\020o\300\021\3118\241\023"
+	.ascii	"\264@\306H\231\030\206*\213\353\032\007J\232\261\006\303P\342"
+	.ascii	"\r\270\247\036oS\004\327u\345\352\224\027\020;\265\314\255\327"
+	.ascii	"^\330z\317F/\255\353\034^\232u\335\353\342\004\304Ny\217\330"
+	.ascii	"x\235\307\306\f\275{O\350\232O\224\2671\211\326u\375R\266\223"
+	.ascii	"\332\351\355\244\332\351\235\f\207U\003\372\3565O1\024#\331\310"
+	.ascii	"w\310\326J\254+\253*\252\254)\251(\250'\247\246$\323\222\022"
+	.ascii	"\362\230\204d<*\022\207jzo\331\270\327\374Ey\304\335h%V__\351"
+	.ascii	"Y\253K\304\003\327\345\212\255\353\212g\253\362\232*\257\263"
+	.ascii	"\374\266\330\251&r\\Z\252\333\270t\224\026h\235\205\242\322O"
+	.ascii	"\303\262\002F\254,\221\243\322NMS\350lrJ3I\211b\227\240^\256"
+	.ascii	"r]W(V\351\211\031\247E&\351\343\220\317\237BK\344\222t\222\231"
+	.ascii	"\316\302\003\367\004\211Ej<pG\262\256\300\025\261\306\254&rF"
+	.ascii	"\372\210@\034+K\344\214t1\213\330x\340\210\364\025\270!v\270"
+	.ascii	"D\216H\253\327\200\223\016\220c\334\333u\272\303$\2201\216i\323"
+	.ascii	";\314\341\243\356\030\227\343"
+	.string	"\212-\022\\\323~m\233qn\366Z\001\322o\277\276wx|<\342\200\264\035\226\255\353\312\226G\234\\3\200f\266G\230\231\004\363\021\235Z\007\336TtGtp\276\303\341i0\325\007\027\360&\027\035<,/\020IM\034,\304?\231\013\313)E@\220C\211\206\303?x\036_\362G\216D\352\275\001>|s\306`\217\333\177W/\325?\n\ta\030?8\354\242\364On\277&\006\032t\036\304\371Z\261\007x\223\231\206\232\236\302\037\034v\021\337\333\247\3577 \305\373V\366R\355\333\377\314\333\232V\303v\267$\322q\333P;\355?\300\343k\026i\273\353\272\256\227\301:\300A<\f\017\312\264s\263\321\363\301\311\001\367?\231\367nX\261'\213\004\371s\314f >x\270\226;\\\313\034\256\345\r\0322`\270`\241\002\205\t\022\312\"\220Ax\340`\254\367\272\305\032\\\313a\f\0264\232f\005\375\327\234"
+	.ascii	"\254\3014#\370\362\352j2\315\007\272\257\231\313@\201-\002\003"
+	.ascii	"\004\004P-k\251\226\001X\313YC\313\312\241e\254\241\345+k\331"
+	.ascii	"\352\226\253n\231jhy\352\226\245\254\345(\3252\224j\371\311Z"
+	.ascii	"v\272\226\233\256\345dj\231)\265\274\324b\232\225\220\252\345"
+	.ascii	"\243j9\311ZF\272\226\215\251\345\243\324r\361Z&\366^\363\320"
+	.ascii	"ZVo9\275\345k-\377\226\255\265\334!\222pw\306\002\327\325G\224"
+	.ascii	"\321j']C\245\321t\377u\203\351\026\323M&o\332\352\\sY\230\312"
+	.ascii	",\312K\376\331Iu\353\024N\326W\364\003\303\210\351Ov\323VWk>"
+	.ascii	"lum\365\261>(Xo]\302\033\332\367\316\013\241* ]\264,!\275\316"
+	.ascii	"HJ\377z\223\221\004\316\027\t\371\255n\323U?\021\206\352R\257"
+	.ascii	"\032C\305zz\251F]\352V\320\333\032\267\272\250\333y\tT\242+D"
+	.ascii	"s\214\360\032\204\215\222\232m\246\213t\205zG\262\363MR\272\327"
+	.ascii	"\2335\n\001\217egQ\330#\t\302\t\274Y\247\241\350\364\323\241"
+	.ascii	"\336O\277\240*N\037\241\007\247\353x8\357 \t\274\354dz\204\230"
+	.ascii	"vn\t\036\341dy\230W\274\336t\262\333:\t\236|\323\233)\207\351"
+	.ascii	"\311\3373-\247\227\316\364\273q\372\322K\350\005\2765j\353\""
+	.ascii	"\203C\372\034\221\207\3606\323\367N/\351Ofc\327\225\336\344k"
+	.ascii	"\034p\344\2333\b{\030\221\256\276\351\325KU}\224\223\020\351"
+	.ascii	"O\256A\350<\362p\032\210\212\fef\253\325\365&a\335\321\207\363"
+	.ascii	"-\n\370\2007\213\275\246\036O\241N\247\35155\351\307wR\243\266"
+	.ascii	"+H\177\320\3058\340\037\036\326\005\016\323\316x\342=\274\013"
+	.ascii	"\217n\374\013\231\202m6\312f\315n\324\342\217~\0051\235H/\376"
+	.ascii	"\272yk\324\006m%\304\256\023_\242\013\224yE\356\350O\266\304"
+	.ascii	"\216\323*\006\001\2078f\f6R\031\332l\347\326\265-iK\0273\320"
+	.ascii	"R\004`2\226.\3223\023j(nZ\212\025k\027\r\006\013\0231R4\026"
+	.string	"&\316\326R\027\315g^i\313\025kjh1\322\226gh.h\274\370J[\266h\261<\373J[a\242\305\327\231\332\332\227\227\026/]\240\251}\275X.\325\276\214{k\177\216-\326\206\033\271\\qxX\207+\333\356\306a?\360\016\027\361\027\275\312h\235R\027j\276Vf\037\033\373\3277\274-\226\331\277\316\241\330G\036N:WU`7{\223\353s\236Q\253?\2054\241\262\260\340\f\2048\251*\234o\026\202\203\275\031\250\031\334\353\231'\314\237\276\303\004\320\227\252ho\251\fn\341\034\3300\235`\257p\016\177c|\324\355\240\312\372\0347\264\323 {\2440L}AqJ\020@\251\013\347\033e\233C\257'\2260\200S\211zK]p\f\337`\210\351t\323\003\324\021\206\340\027\336\224!$\005\245\340\r\254]o\251\r>u1\277(\363\220\233\215FM\371\201\346)\303\373G\023'n6\264\211\205?"
+	.string	"\2374\234\257S\201\033\320\002p-"
+	.string	"Q\262>\302/\320\256\353z\003\312\3005\234\314\217\020\323\016\031\215F\323\364\226\252|\006\254_]\231u\254\3371o\215\216zKU\360\253\307\360\343\323y"
+	.ascii	"\201\361{j\342j\032q=\222\\\335P\342\352\230\0164\327\2336\342"
+	.ascii	"\0065M8\213(`R\302"
+	.string	";\356\216\211\302\013\274\311N\177\366\351\255O8Y\337\240\372$P\221\246\201\013\250QD\003\rS\206hDD\222$IcA\005\304(\b%4\017\021 1dP\225$Ii8\027sP\347)\366,\336\b]\227eL\341\016\t\250`\245\fI\275\252\274\021\336\354\003\253\003\241&5YY\023\242\256S\211\367\202\311\222\341\210\247RgF\"\342:\304\313\374\354d\006\225W\243\222Z\376\230\tDA\311:\\YQ\343T\214\236\\\370n\264\346\032\254\nG\340\243^\256a\204\037\311_\021e\206\243\203%V\221\315'8\255H\262\243\354\344,\256\213\233dx\256\305\306\f\340\3348\340\320\254\230\330\035\251\024:\316\037\013\034a\3539\376\202\330cF\311\274\005\030\342\3664\342Y$>\313P\354\233\036\027n\243\266\247s\331~N7y|T\303\274=\022\004\320\016\2202\252\207\030\240'nh\314\345\034\313cQ\334"
+	.string	"\"\224\243\364\305\325\b\222\354\351\366"
+	.ascii	"<\233n\b\357#G\rck%\343\023\257<\b\273\"\207WL\375:\250s\253"
+	.ascii	"m\242jQB\344\004r\"\323\243\371\371\251u\350\202\242G{\221\f"
+	.ascii	"\021+\024\001M\345\nD\213\177\f\f-t&u\005\211+\363\365\201\324"
+	.ascii	"\035\211\352\225\356\244\331\223\322I74\013J\207\236><\330\364"
+	.ascii	"\006b\233\360K\320\"YoR9\016\022\260\245\023\334\244$\352\217"
+	.ascii	"\240U/I\256\215\245|\324tl\265\236~\271\0309mf\231\202a\001\350"
+	.ascii	"\225\003\330\200bR"
+	.ascii	"\246*\220\020bY.\327O\327\001\3351Yk\222SpD\211-\3418\003s<r"
+	.ascii	"\222\021\034\360\261\374`p/U\001]?\035\274vc\337b\f\231\317G"
+	.ascii	"\340\003\004+\001Y\027\3410/)L\327H;+\333Z\267\030\314\t\253"
+	.ascii	"\303#\253\360E\027\016y\fA\022<!\220\257.Wd8u\3125\377\334!%"
+	.ascii	"f\263_\033-)~ze\233\254n\316\375\275w\226\017\261:\204E\250\301"
+	.ascii	"f*h\n\320>\3231\377\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\022\001\025\b"
+	.string	"\222L/2`m\322\001\320\377\344o\025\215\216\306\215\375\252[T\231W\f\366\032\360\207b\0028\b\002\032\004\001\021\020\215\002/\rk\370\221\255\265\354/G\"\221D\246\266\234\246\365Pi^0\212\246\005T\321|\240\207!r\214:#N\363m\320%\036\021\025N\263\302\320\033\237\217\216\323t\030Z\304\203!\3414\333F\223\3224\315\n\004\035\322Ar\342\226M\203\316\230\270>n\351\200\310\021\205<v*\234\222\360\207p\314\3013\270\273\366\202\301+X\360\212\340.\363"
+	.string	"\006\023\212\021\346-\263,\313\254S\227\003\f|\022x^{\321\300\021\205,\227\250\275\256\265\260ok@\340\264\273\373\256\222m\351\005\033"
+	.string	" \353\234C\303\320P\030\332ZK\001\335\234\2075\303\003\365"
+	.string	"\340"
+	.string	"\340\360\001\222\375\245}\020\306\303*! \220\346d\004"
+	.ascii	"\232cH\365\r@\f\030\020\016\350\001\350\241\223\016\252\304\340"
+	.ascii	"I\206\016\246\023"
+	.text
+	.section	.gnu.lto_.refs.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b9c1d531e9d13416,"e",@progbits
+	.string	"(\265/\375`\230\020\275R"
+	.ascii	"j\215\324\036S@P\312I\007\346\252\252\373\257I0|G0\220\261\333"
+	.ascii	"\367\367o\232fV\245z\277s[\b]\034D\020M*\266\034p\334-\031@\037"
+	.ascii	"\204}\300\252*/\335\217j\352\301\201}F@\037\250V?\002dV%\226"
+	.ascii	"+\271\305\230C\331\345\001\254\003\221\350\266R\246\240\001\323"
+	.ascii	"\001\344\001e\305t)e\3441\363Z^u\0222\270W\rw$\242\313 W+yA\257"
+	.ascii	"\2127\352\270~{\370\227\312VA\236Q\\UL\256#\266\304\311\233s"
+	.ascii	"\366\360|\231g\222)Qd\270\356\031\317\206\273\273\273\2733\336"
+	.ascii	")+\345{\366o\331\232=\304\021\262\227\213\242\007\227$\025\236"
+	.ascii	"\365\304\2268k\024\336\261%\373F9\022\271Q\0220\263(p\234\240"
+	.ascii	"\364\200u\212AAu\314\340\332\301\365\013\345_\260\r\333\244\n"
+	.ascii	"\335G\335=\300\315\023\326\217)\256on\211\323fs\316}\302\363"
+	.ascii	"\375\3129\211M\310\376\242\331\201\026%\204k\315\346xu-\334\025"
+	.ascii	"T\032w-q\230\340\320a\b\022'\204\231\035\0179\270~\265V\371o"
+	.ascii	"\223\335\332$/U2\366W7\222\204\006Gxl\341\272\310\345\372&\327"
+	.ascii	"\311{X\234\027L\266Vwor\205\261[\270I\0343\335B\234]\024\273"
+	.ascii	"(\352\022)\253\260\263^\005z\344\2268\321\3159\277L\236sl\026"
+	.ascii	"g\364\247\300\277\016\374\013\303\013\377J\340\373\027\006\013"
+	.ascii	"\377\002\245\360\357\004\377v\200\302\366N@`\303\376\035\341"
+	.ascii	"\304\317\007\230\211\370y\355\337\017\234\374W\206\370\231\246"
+	.ascii	"\376+\246\0011s\347\277n\311*%\364\376\035\373\327\203\1773\370"
+	.ascii	"w\305\277\017\374{\342_\022\377\336\374\213\376\313\377\355\376"
+	.ascii	"\213\371_\367\177\313\377\267\377W\376W\371_\302\377\017\376"
+	.ascii	"\233\375\037\373\317\365\337\204\377!\374o\340?\224\377 \374"
+	.ascii	"_\376\357\372\237\374o\342?\332\377\232\273\273\273\273\237I"
+	.ascii	"\370\227\203\377FK<\330\225\371\3321\227dpTI\226K\243\"\025\365"
+	.ascii	"\345\313\212AG\364\260\355)D1\311KR\230\257\030\032f\230#\023"
+	.ascii	"\327\005\003\025\027\267uh\260\fo\211\233\020\037]\276u6XRnX"
+	.ascii	"q]:\235\0331\"fc\270\356\234\\\023\034\334nA\273\233\327\335"
+	.ascii	"\343\312\025\203)\231\233\003\342\273\305\312\024\335\022\327"
+	.ascii	"\325\362\264\232e\226\335\r,X\366m\233\330\335\324<.M\222\260"
+	.ascii	"\306tS\223\016\ni\3053\\\367\355r5\254,\314\221\353f9\332Y\245"
+	.ascii	"H\026\032\\\267\255\327\203\315k\310u\331\316\354\005\231P\232"
+	.ascii	"\253\264\031\363\345%\266\204~}X+_\264\275\262'\272\257z\330"
+	.ascii	"\306\226\"\212\213\227\335\230n\"\352\374\273\366\275\362\367"
+	.ascii	"\260X\245M7\002\350YZX\221\353\252\351\324P=\261\302\342\272"
+	.ascii	"i\253\024AL\006\327\270\036\214\016\016\r\2570C\256'\001\345"
+	.ascii	"\377l!\261\273m\320 \2338\264\371\322\354\352\3747\313\333\024"
+	.ascii	"\335\377y6f\272\225\264\276\240YdB\036\\\233\246\331\350R\330"
+	.ascii	"\215<\026\217\2169\220H\227\315i\232\260H\354c\220D\332]DSa\367"
+	.ascii	"\322\330\305t\331\305\232\3451\330\310c\020Ev\261\217Zh$\221"
+	.ascii	"\036\035\213\351\362X\334t\331\304>\022\022\003H\333X\354\345"
+	.ascii	"\261\313\246\310#1]\032\213$\322\256\265\342r\306\232\216-\222"
+	.ascii	"\036u\215\245'!qD3E\032\033\256{\277\220\232\230\242\373\311"
+	.ascii	"H\204\023\346\260e\303f\215\241\230\320\270\310\356.`i(e\354"
+	.ascii	"\243fj\304\330md\b\243\227V\004\221\315\016\262\315\340\217\247"
+	.ascii	"VB\3526`\251;\270\335\354\356`w\367\210O\310n\247\021\351\325"
+	.ascii	"\322Rw\023\001K\375\0244C\352\346/ \002K^\030\233\016\216@\016"
+	.ascii	"\335\200\\\211\221Bg\303\311yyV\3428Q\362\245\310\225\223\\\214"
+	.ascii	"\334Z%\r\026\037RG\\\271\311v\361\230\204r]X\213\267&\3256\344"
+	.ascii	"\312Jx\311j\035\215\231\034\211\003\300Y\022\030\232\020\364"
+	.ascii	"6\354\321NF\302RC\316WE\330\b\257\216\3107\302\234`a\235\215"
+	.ascii	"\234\263zX\034-\207\352)\216m\240lu\326\261\305Dj\343\312D\316"
+	.ascii	"8t\250\321d\253\3522D\007\325\022zF:\236\177L1\025\257\255{\030"
+	.ascii	"\001r\b\327i\252\203\243v\203\\\032\2203\3259H\017\213\307\211"
+	.ascii	"\020\033\"g@\201\251\201i\302\225wx\334\263l9!\271\262\016\237"
+	.ascii	"\003 KV\030\263\255\257!?\300\240,%\207\362\215s\0167\330\310"
+	.ascii	"\333b\323\301d3\365\272\252\242\254\215\351\264I\347f\256\212"
+	.ascii	"\216\311\216\263\361\354C\313"
+	.string	"\320G\022\256\334\343\033\304\213W\372\304PE\270\210\235!C\231\007\004Pe\242\314p=;\001a\253\342\201+\357\231'7\255\362\335[u\234\343\254\343\017\021\342\254\307\324\361\t\3723\216\2607\036WI\364\313\204\231\230\211\213\005t\377@\225\204\225\004G\2169Dc\342\271H\206\276\315\355\200\352\302Ab\207\303[\026\323`\032\274\344fuEC\245\330qJ\347%^\332\027\322\035W\306\341d8Qt6\234\210\360\021\037q\212l\246u\333\221\2045\306&\007\230\244`\3229U\256h\262D\bWF:\223\245l<]q\345\031\253D\311\216\\\005\301\2549\314\230\250\005\t\"\b\026n\267\022\214\016\3351T\362\302\301\263p\223]wL%W\356M\262\022\255)$\256{\267^K/VR\270\356\2313i\272h\231\235}J\357G\020\251\327\024\0312kG\201T\025]7=\351\324du\tBCC\027\370\320"
+	.string	"}z$"
+	.string	"\376|=\240\217\013\340\317g\324\003\372\004\325\340+:i\220\001\364#\002\026\365\202\210\214d\324_\220\220\317\317\007\024\362\031\255\340\3433\202\006\031@1\202b\234\207\241\302\205\237\217\bX\264\023\304\202\221\020\320\317\267CTd\264#\200\220\220\321\3577\364\353\3110D\004\0038\364\353\265\360\023$T\201?@D\300\242s\203\036\013\200E?-\364~\206\200-\324\237!\240\257\372z~x,\364\374\360~z|F\365\247\307'dDs\005>$#\210h\00784D\264S\363\323\343\363\251\007\362\021\005\375\202\\@\277\242\005\004-\\\314\320\273\213\027\021\274\210\340\274\213\027<</Z\360\240o\301\303#\372\201\001T\317\303\203\301\t\021>\340"
+	.string	"\005R\361\033\362\025\021\005\305\360\033\002\n\222A\003p\3477\024#\306\020\320\316\317\367\023c\007\210\250hGE\n\226c\272\363\034\307\331\034\361\\\005`\027\005\r\263J\250<\3539\311e{x\"Ey\265\205\252\004\037IO@\030\251Q\003\222\004w\326rV\332Mi\313\302\225\177`6\021Rb\315&W~\343&\216\327\361\2062\267\345\024c\231\264\355\234\205\f\254\221pe,\314\366\265d\027\216$7\265\210"
+	.ascii	"i~\352\210\025\"D\021pNIb\256\030i\310\234\271\tY\033;\313\230"
+	.ascii	"\234x\251q*$\302T\342\312>\260\225\325:\223\3216H\225`\220%\350"
+	.ascii	"\f=&SY-\023\\\345\346\214\2223vX\350\327\304\271wk\342<O\371"
+	.ascii	"\371\214\245\030qm\001\331\022'\003\233sr\031\317\331LDJ#\035"
+	.ascii	"\302u\201\3159\177&\273Bs\346\316N\213\353\327\020\036\343\325"
+	.ascii	"U\320JqVQ\326\306\334\2149)1\202\235\307\316b=,X\353\246\006"
+	.ascii	"\363\030\206+C9C5\251\235\321\2051T\326\324\022\t\327C\200&u"
+	.ascii	"\024\213O\274\216\234\223\034\341\201Y\250\2410E\030523#\"R"
+	.string	"\220$I\007q\005\204\030\346\240e\035\021p\255\202HfD$IAI)\303\034\211\005"
+	.string	"i\207\r\340\021R\313\013h\227\243\252]\255C\263\251v\224\254\203T\262\244{_~\261T\227\\\\\037\006\214\333\024$2\025p6\f\026\314q\031&\304\341\324\322ab(\344\340\270.@\033\307\214\n^\275/[\022\247+\327\375\357\340\311[c\024:\272@\360\207\242\335uX\\5rU\3570l\253\341\263\204\003\350\272S!\374K\331\254\253\300\237\335\224\314R&/VA6\371.\337\037q\202\t0\265\254\365\023\231\224\307U\257\232\220\251\266,\3103\241h`\375\200\nO\376\031#\354\361('\367W2DD\211rHt\364"
+	.string	"\r\262f\372x%\016\t\207\241\216.\tA\213\331\361\255S\257"
+	.string	"\210\326r3\371\\\323S\f\360\3358\034\"^[\330\263\"\017\\\026\364Rv\323\251v\033\230a\026>\360{\013\301\351a\250\344!\022\310\024\217P\034w\341\031\253c\242\202M\332a\215O]\260B\210\303\n\210\270\020\211\221W\202\203$p\2115\025-i>\344\356\372\274\026\330\030\207\022<\364\241\351c\347\\\300U\231\262<\r\035\031\374\204\327sJ)H\266\017\233\n+\245<\224\334\320\030\004\303T5\200cha\357\200\246\224\b"
+	.ascii	"7\016)\335\321%qM\371\337P\344\252O\356B\251\224P\324\223\025"
+	.ascii	"\177\034>\006<O\370r\3408\354\313\366\355\033j\262\352\270\243"
+	.ascii	"j\372{~]\363p\035\342\304p|P\340\343W\314\322\366\026]\271\036"
+	.ascii	"\246H,\217\025RKi\013b\007\322\250$J\353d\235 1\362EC(E\002|"
+	.ascii	"\032R\241\362\361\bJ\270Y\340\2109O}T\b\216gQ\240\324%\3037\247"
+	.ascii	"\357!\244d\353O\226]\032\210\212pFy\\\317,\316P\324PeJ\230\031"
+	.ascii	"\210i>\220\263`\006\340\333J:\016\03095\334\360\214\252\220p"
+	.ascii	"\f\360\242\267{\313\203\276\r\261\273Z\013\264\013\005s\204/"
+	.ascii	"&'x\037w\257\377\034\204\205\177\234\344\325\350\317\224\r\036"
+	.ascii	"i\276\305\351\357\177\273\336\005\333\235\267\310oz\377\005\236"
+	.ascii	"\312\036=\225\217t\302\217\020\231\363=\004l=\237\220q\334X\376"
+	.ascii	"\023\275\244\227\300[}\211<\331W8\355\3405|\200\337H\354%\356"
+	.ascii	"\303\177\322>\322/1\376\035\337\036\210\3360?(\357\020az-\216"
+	.ascii	"#\203\207t\223\276\371\007\352fZ\253\fwX\005"
+	.text
+	.section	.gnu.lto_.symtab.b9c1d531e9d13416,"e",@progbits
+	.string	"uli2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"li2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"i2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"a2d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"a2i"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b9c1d531e9d13416,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1077 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\365\t"
+	.ascii	"\"N67"
+	.string	"@\217\263\006D\t\274\254T\205\254J\262\0206p\\ d\261\343\032\224\242\353\347\310k\240\320\300\206aaQ\024EQ\024E7\214\244\264\276\2276\tm\022\262\245\224\264eR\003?%\320Fr\f\035'\035\202\211\255p\214\241\346m\024\"i\fl\240\300i\021\300\256\265\341 $\006\310+\304\204\342\311Hz)\251Du\002\260\226W\007\212R!\346r\371\277\337\177\327\013\354\304\203\b\311\347\355\335\335}m&\035\221\302\253\033)`E\307q\234H%5n\232\364B\325\n$\273\337\351\3335\035V\030\243=\333`\247\005\024D\265g\332\332\366\314\276]\216]\317\334\b\026\204\021\035K0\241,f\275\256\367\341\221\030Y\003?%\2205\257\364\237\277\265\374\316\013N\206\207\324HK\f, P\202R\205\325\001\020\222\232\001\350\022\346+\312Q8:\343?\314W\204\327 !\213\3359\317\013[,\251N0\315\002"
+	.ascii	"\rn7^{\303\252\027H\\\2336x\254U\310vzqea\211\200\310\341\371"
+	.ascii	"\216\023\t\336\235\016-\026\332\305nw\177\206m\327\215\265\017"
+	.ascii	"\263\241\b`\371O6\314\215i`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\275\004"
+	.string	"\242\206\020\025\220)\351\377\377\377\017\365\037\336\200\377\013_!V\375\266\245L)\213]1\023\210\235\2075\254\212&\273o\205]n\302`\301n`\235\306\252\003\321=4ju\0330\310\222T$i\243K)\321\2628#& 0\002\006\325\371\242\021\007(;\260\214\300X\0062\240\033G.}aH\336\tK\344\335i\315/\013\374\025W@V"
+	.ascii	"7\262\366\236&\204\001\325\023\021\001\360*\325wg\341-h\315e"
+	.ascii	"\031\265\272\300%\343\r\034\310C\036\3714\231ln\212U\005\030"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\233\005M\031"
+	.string	"\266\341uH\320\362&\215\001@V\334\350W8\224\310\377\316\232\302\354N$\211J\306C\362\007ho\261Tz\257\352\007\210\036^\3640T\356\3547\026\243\003\352\337\330D\256\306\b\250\201\313<!\236\344\346\351\3230\031\366\255\304\022)e\n]"
+	.string	"\\"
+	.string	"c"
+	.string	"7U\221\243R2\2607\303\275keAm\026*'w\343e\177V\025\f\"\244\001/\204\3364E\2121\256`j\254\247\251\367\345\257\035\246\231z\306\254\311\352]\333\247\240\234nW\357\210\204\013#\271\2564\2151\306\357o\0325\204C\247\300\373\035E\363<o\313\263\323t#\340a\1779\001\347\264\205\032\025c\204}0\177\2063\361~\031\335\251a\3125\320O\231\255\262YJrY\331\341\f\327\322c\207\247k\365C\232B\r\261q\202\303\241m\211x^"
+	.string	")0$0\244\351\017\247\030R\336\257\327\n\2234\337w\2101\322<\311)\232\272\214\351\206\207\233G)\341\213)\207\2753{\311\027Kp\002!|\r)\354\321\207\"=\n\263Dx\202t\254_4,:\223,2\213\322S\r\357\031\263;: \216\304v=\303y\320\333\253\240LBv\370\350\360\232\2564g\321\231\227<\307\267L'\374"
+	.string	"\302\2277\313\324\301\376\221\214\360y\232am\222JRj]\022u\304\030I\006\360\f\227\255=\377i[\023?R\273\225\233\032\205"
+	.string	"*\222\035\340\344{\206\023\202Z\321\244rae\354Zxpye\227\351\207\244R\323\247\022=Q-\233\2128\241\244c\235\362\3571\037FIT\013\364\251\0318@\007\206\035\263S8!\235\027\234\335\020\212\226Q\266\2659\254|\233\322\b\222\242\206K}j\206\226\020x\231\030v\304\356\307\306<\030\274>\200\237\250\301-22B2a&)(\024:@\002bLY\231\007\021 \2654L\325LA\222\3024\006\331\n\326q\374\031\202\301[\202Y\226\"\025>\222\016\210E\377\310\201\004\256C\373\177\\2a\224M\r\024\203\023\017\356\024Pj\227A\230\233\013\336\337\272w\325\021\3116\242\372\240>\272\265\333\"\370\270#\257\006K\300k\327c\264\235\020\256\244X\021:$y\013\3668\311\216\036\272\240C\255f\355~y}=\r{\023VM\016"
+	.ascii	"W\005\t\200I\227\247\214L\323q#Y\327\217\250t;A\376\021KQM\007"
+	.ascii	"\013*q\364A(\206@\273\013\373\b\217k/$A\313Q\325*&\016\221\232"
+	.ascii	"ok\221\227X\221\272\031\241ku\001\371\310<:\345\033\032\230}"
+	.ascii	"h\214?\217$U\374a\216\313HW\236\006\256\313L<\364H\215}\345\275"
+	.ascii	"\033\022\023a\216\3310\315\023U\225\237\356-\237!\024\375\247"
+	.ascii	"\335\b\237\2237\274\005d\2519\320\032\310%\332\026\244E@+?\370"
+	.ascii	"\034E\2168&\2216!\245Ly\352\216xaQ$I\224\322\261\363\337r\345"
+	.ascii	"\013s&\322\212?\351:\245\301\230\035X\315\354\206l\362\006\230"
+	.ascii	"\310\020Wh\0329\223\017%\351o\206\372\2001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\301\006\235\020"
+	.string	"v\22391`K\222tPQ\024|J\310\202\266<\ntS\024EA\334"
+	.string	"4\323\n\202 a v\b\307\022AamgI\022#\252R\207EC\333n\"\223\f)"
+	.string	"*"
+	.string	"-"
+	.ascii	"\023\353\274^\231\322S\024\027)\361Z\017\357\025y=\365L\224\322"
+	.ascii	"\214\260\232\242\327\340G\250J\353uA\257\312\305\227\f\002\260"
+	.ascii	"\020\3132=X\311#Gh\024\031\031\300l\211\365\013\327\034i\210"
+	.ascii	"q\210uG\332\252\243W\0322Q3\fB}\206\307p\277'\366\001s\270\271"
+	.ascii	"2{6<\304V\307\300&s\207\333%F\301\230\205t\034\307\231\021\307"
+	.ascii	"\252%6\301\201MG\237V\305\242\325C?\240\230^\t\bd\"\361i\260"
+	.ascii	"\226T\360\003k\223\"\367?H\370\024\224\232\004$\002\222\007H"
+	.ascii	"\032 \013\220\214;\002w\275.L\207P\036\275\302\r\233\217\216"
+	.ascii	"\002\200\211\250\241\315!)iR\222t`\002\0212+\333\022@\0021\004"
+	.ascii	"\343\201\fs\004!d\210r\214\222\322\224T\332\370D\277\030\nu\245"
+	.ascii	"s\020\330<\025\364\242\342e\262\217D\205Gj\3423\330\022\036\207"
+	.ascii	"\307]\336,)4z\016\021j\203\204\242\314{\037\273F\327\bksvqwL"
+	.ascii	"\357\254o\266\342\"\013z\231\242dI\261\320\255?\253\311\210\n"
+	.ascii	"5\221X\275\266\247b\250\230\f\205@t&/GN\333\337\255\360\002y"
+	.ascii	"\236&K1\313f]\220\212\311\261\276=)\267\334/2\232K\300\226O\247"
+	.ascii	"\240{X\230\220\030pm]\"\324\335\277\272\265r\013R\3435\t\237"
+	.ascii	"\205\033TW\311\370&\222i\236\204\212\304\221\b\022:h<\271\206"
+	.ascii	"\"\230\257\216xG\371\013\375\333.\021\333\253h\332\021\207\t"
+	.ascii	"=\203\025T`\371\005\347\021\261\371u#\t\375\315D\261>\351\004"
+	.ascii	"\342N\316\273\306\210\b\342\021>{\255\034\267o\322j}\370\310"
+	.ascii	"\321\325\342\342\332\244\233\353\337\375\336@\roO\007\242*Sa"
+	.ascii	"\261C\tU\215\247\360ij\246N\376\326\323\013<\001"
+	.text
+	.section	.gnu.lto_.pureconst.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\265\004\002\232\004\003\271\004\004\232\004\005\230\004\b\231"
+	.ascii	"\004\t\230\004\013\230\004\016\230\004\017\230\004\020\231\004"
+	.ascii	"\022\230\004\023\231\004\024\200\004\025\231\004\026\230\004"
+	.ascii	"\027\204\004\030\231\004\031\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\017\001\255\b"
+	.string	"b\r(,\200)I\007:#2\221\213i\021\214\2144\343@3\300\254T\006\020\214\325Gf\b5\212\210\036\370\217\232/b\330O\232%\226H\231\002CDL<\250Op\020\236\0074p`\301Oj~\346\237t.\225t\017\024##\262\230\202\002\r%\245\001\320"
+	.string	"m\262\004\327\234U\342\2301\322Y_\213\221\244w\254\230dt\2034\315\312\225\306u\224M\271S\252\312BIi\b\372\226\30214\322\364B\311\273\233\344M\373S\376\004\217\213\266\377\335s\316\224?\235N'\244\2345\375KS\2553?\236\033\0014 \200\202)*\363\0044\\\375`\265\341\350\\\201\331\221E\366\"\021&1\262{K\021\f\261`?\3615"
+	.string	"\036\020\033N\002oI\306\004o:\3273RAm \372\306\213\216\234#\270\"\310\231\274\214\203H\232Ih\343\321\302\022\262X\273\026\253\365.\034\302\204~K\355\225\275 \207\265r\032\037\324\220n\263l \304n\3310\356\031\361"
+	.string	"d{\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.567dc7b3f7fd65c8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.15.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375 \310M\005"
+	.string	"b\211#-pU\323\001"
+	.string	"\355U\251^\277\036\316\036\260{\204\177\215c\304\004j\276\"kz\003\026\021cE\377\373}\261\261mT\205\221[\273wJ\001\226\242j\322k\232\030\017\312aMIZT\243\222\022\205\310\350\340yMTF\346\244\022\252\373\310\031$qb\327\f\306\213\375\300F\316\206\213\352\001\024\276\335\312\027\260\037\201Gc\373\2201\273{\315\3549\035\245\343\355\256\214\230c\207\230\377\315\t\332\226\035\016\024\273k\250m\226;\3366\302v\3026\025\t"
+	.ascii	"\252\244\233iq\316\f\001_\356\032\236\026\302x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_scanSegment.18.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\307\003e\033"
+	.string	"\206\362\261J\260\324Q:X\241E\262\211\331Q\245a\336Z\251\305\242\032\315:\311\025\031\215%\213g\bx.\016\223q\324\276\375\257\034\177!\327Rj<\315\376\354\300\366\205\204\325\251\227>\254\216r\255\374\034\227/1\266\330\2144B\210\334)\005\241"
+	.string	"\214"
+	.string	"\242"
+	.string	"O8\030\2348\232"
+	.string	"u\027\fZ@\357\204\373K\255G[Aj=k\234\240\374x\035\337!\3028\232\023i\310\314J\362\t\251\324z\316|>\206\374X^F~\\\027^\212\273\t{\265\224.r\024\227\342\374\0217]\274-(-\206X\034&\3264!]y\022\241\025\242"
+	.string	"\251\"\274\013_\001h\020\275\245\250L\"\224\302\3453\177;J\232\370\365\204/PCH\005\035\237cqQt\360CI\222\313\217'\236\251\210\310\247N\201~;\272\260\037\321\251\353A\255\325\364\3477t\307n{\211m\n\366\006\005u\027X\353edl]\366\302\037x\"\242\323\212b\322\321\241}\352\350\002\355+\210b\325\344=\362\214H-3R\307\214\3240#\265\354O\377\313\317\037\300\241n\227;\3751S\233?o\330R\277H\352r\244v\231\232\024\251GS\357R\237fF\311\250\b\bc\265\316\0324\304R\221\214B\226\016u\373Q\227z\017\3334\210Gy"
+	.ascii	"\n$\243\035\265V\023\204m~\244\266\b_h\3236\024\356\265'\364"
+	.ascii	"\002\342)=\251\365D\360\321\020\002\345\236\312\227%G\207~\331"
+	.ascii	"]WM\316\211N+\352\206\231#\001|}}\224H\362\321\262Gc\214\340"
+	.ascii	"\325\020\246\245\253r\201&\367C\360\310\270\260%\227Z\365\350"
+	.ascii	"\216\353\243T\304\227\005\253\312O\023\327\002\207C\031 \023"
+	.ascii	"#?\031$\017I\367\026d\262\243Vl\357\034\bOY\353n\201O\305\301"
+	.ascii	"V\326Z\257\364\321\357@~\244\213\340\204\024#\036N\271\225\202"
+	.ascii	"\265B\310x\033\022O>q\201\376\324%dU\371\252Z\310\265H\001,l"
+	.ascii	"\201\\\366{\013b\355\250\025\213\227\221\260\375~\352\343\214"
+	.ascii	"\244aO\254\265\006\031j\021vj78.\237\333\215\217\005\332\215"
+	.ascii	"V\366|\247v\203#\232f\303c\273\365\344\344`\330\240\243\241f"
+	.ascii	"\243\315j:7<3\332\315\303\314\306\200m=9\267\231\217\315v\233"
+	.ascii	"\231g\356{\344\013?\201\267\345\253\202\315T\310j\222\252\022"
+	.ascii	"}\034i\232\353\007\271\325\3450e6\2663K\251zL1+\003s\025\002"
+	.ascii	"fc\326\324\227bo#\244lav\247\364\214b\273+\333\367\270\210\365"
+	.ascii	"\302I\317\305\204\310\006\354\002o\311W5~w\201\032\004\235F\276"
+	.ascii	"\026'\270\025\243\345\276\254\255H{\203\016\375\317k\t\364v\204"
+	.ascii	"]\033G\250Q \306\b3\210!3\201PT\022l\013\007`\002\221Qu\036\020"
+	.ascii	"P\b5j\r\312R\246U\341\022O\031aW\n\302cz\034\304v\270\320s!\005"
+	.ascii	"\201f\256\026\023\210\344\363\360 \250R\340\017\355\210\203g"
+	.ascii	"\326+\336\303\274]\b\253\377^\270\250Y\317\307\b\n\321`\363e"
+	.ascii	"\251\253 \005\252Q\246\351\0038\247\006]\332\364\352s\360\265"
+	.ascii	"\252\211\344\3748e\325\261\301\354\357\2335\362\207\027\341\200"
+	.ascii	"2~\212|PQ\266\301\003g\322\b\024\007Yk=\307\321s\225\345\271"
+	.ascii	">\215\026\210@\032v\364y\227J\003"
+	.text
+	.section	.gnu.lto_scanBank.19.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\024\005\245 "
+	.string	"\226z\320H\200\334Q\007\377\005\215,\322\222<n\211\217\271\232-\264L*T\226g\001\340\336\203\007D\320\341N!\024\022r\330k\211\211\221i\355\302\254\344ds\030'a\231\377\325\263\034\365.\016\357\321\b\260\301mdo\271e\222)\005\302"
+	.string	"\261"
+	.string	"\301"
+	.ascii	"\250\233\275\372\016v\023u\001\330M\b\022\216\032\350\353\216"
+	.ascii	"\246S)m\230l\223\363\312{\035@{Wo\\\233\017\364\\\212\273\241"
+	.ascii	"'\326\2319\367-\260\035\311s\351\323\320\246\367\217J2_:Q\335"
+	.ascii	"\n[X<\334\313\206\305\345\200\232\362[\202+\250\032\216\336\235"
+	.ascii	".8\306\370\322\251\306\375\261\3022\303\2138I\331\323\275\374"
+	.ascii	"'+Lk\355\nj\312\261\016\021\032\256\273\247RS\020\335\323\322"
+	.ascii	"\235\300\246&\346IOP\304\311\312\232(\r\317\271\021\220\300\200"
+	.ascii	"\342K\247\252\233~\2611r=H\345\177w\232\2020\351\236\222\356"
+	.ascii	"\217Z\2245\236tK|\022Z{^\3109\267ez\202\362\006\340\335^\240"
+	.ascii	"\2733t_\037\001I\226\255\273\211\334\211\212\346\234\004\324"
+	.ascii	"\336D\304\n\364\207\233\355,\260\233\3767\242\314\254\266\270"
+	.ascii	"\202\266\255{E\262o\354vo\022\266\004M\177\261\333\247\307W\367"
+	.ascii	"\001~\364\346\3319\227\273N\333N]\351\215\363.\357[\333F\255"
+	.ascii	"\355\363\332\306m\333\274\266"
+	.string	"\257i\373\255m{m\373\001\003fVTF2\177\266\346\246\2667\231\213)&\304\225\356G\367.\377n&\355^\235*\177Y\030P7\275\373\250\035\351\311N\273\026\b\001\243\205e\341ht\263\324\232\241<`\205i1p\263)\240\277\276(\003dm\267k\371\326\221s\031y\200\234\213O\302r^\033\364\203\337\363\304n\016\256\005\350@\\\305\367\315\307Y\206b\302\016~E\275\177\216IY\373\357\376\340V@\3304\2463\035\302\311F\3749\006%\tW\317w\007\371\224/{\222DJ\310\307\214\320\2343P\273\330\206^n\307\013\354\346\243Q\256Q\005\361+\221\241\204F\367\305>u\304\030\202\351x^\227\2043\004\313\331\375\355\211`\316\363?$\332\355o<\357C\314\fYS[z\2447\243\246K\225\371\306v\007Z^\351\221\363\3056\302\273'\020\345\006\031&gu\276{(\205u\246\335#Xz\244\276."
+	.string	"\353\274\375\363*\016\362\214\311\021a\037\313(a\271ol\227\221f\366\365ol\347r\025\373\223@\242\005E^\302\327\373\026.z\276{BU\361)|A$n\0139 R\177E\275\336\210\023C&|\252\020\3177\024D\304\023\372\261\3409P\320jQ\357\307k\241\252?^\272f\377b\333\324\317\034\237a)\301p\356@\354I\327\340\205M\t\366^\346i\372}!\370\3024\2712G\321\276"
+	.ascii	"\321\267Rx\374\227\2119z\245ol2\266\233\317\367\305"
+	.string	"=\217{\"\356\317\337\241!\265x\316\347\233Y\374\346\2343\356\201\343\336\347qq\262\310\226\216\bm\233\275\275\021\210\227\300\3359F\005+\215\005\262\254\022\205\266\271\212\361\377<\f\205\212\342w/\277YY[\210SA\333\366UU\244r\276\261\373\232\267\\\250a,\246\fc\212\220\214\214\biA\222\016\200\002\221)\254\016\021@1U\256jI)m\007\n%2\fd1\035I.\305\2648\326\022N\035\027\0310\357lp\3473\356\362\235\355B\206\207#\204\362\206\355\220X\242w\361\352H\356\rb\207N=\274e\370\233g^\0062\264Z\231[\261hd\246\207\204\3208\371C\263;R\207te\355\316\364\227\nd\221\323\257\320\3527\036\215\354\314\r\213\327\221\372\264\334\016\306N\214u\251\343\314\2653\210K\357\266\256#\335\fU:!\377\231\314T>w\307uCJ\206\213t\016\314Xk1\245\022\230\2344"
+	.ascii	"2D\374`\240\323\bF\226\364d\221\347\315&\244\331\275\304\033"
+	.ascii	"\364u\366\227o(\237\025Q\272\032"
+	.text
+	.section	.gnu.lto_scanEEPROM.20.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\351\004\035\037"
+	.string	"\246\367\302J\240VN:\224k\033\037\266\177yw\355/TcYC\366\020\333\024<\224Q\301\270G\033C\025J\t2\222\372\316J\341\306i\330\n\273\265\255\204\360\n_J\223\263\340\337\263w\240\300.\204wf\270\n8\261\204\020\262\267\334I\006\256"
+	.string	"\242"
+	.string	"\263"
+	.string	"<?9\213\306\347\274?\tA)\301\232[n@\336\322\274&\336\326\323\304[\346\023\314\346\355M\346a\036\373\251t\307$\247\037)-\367^['1}=\317$\345\2719+\311Q\264\265)\017\2376e\001\372\241\270i4\004\343\263w\t\3018\220\037`\022*\242e\255\331`\312\361.\241\027uA\226\325\325\241z\224\034)\320\030\"\372\350\342b\215\001j\265H"
+	.ascii	"e\206\230\2556^:\212\002\374RT\332\213*/\363\347\2435\300\357"
+	.ascii	"\247\322L\235\006\375|h\037\3526\311\252\212\321\020\321\351"
+	.ascii	"H\341\336\313\024\3507t\006pf\346b\346\t\314\365\f\214\373\221"
+	.ascii	"\253\032\340\321uD\346\334\253t\004(\335{\037\360\211\274\310"
+	.ascii	"\016\177\351\226A\350\350\201n\371:\361\326\006(\003\030,\353"
+	.ascii	"\241C\346\263G\033\211\371\267\201\305B\005\367\021s\245<3\243"
+	.ascii	",CR\216\201!)\327J\312\264\222\262\371\363<#)\227"
+	.string	"\2252Y)\217#eQ\244l-\345j)w\245L\233\362\013\030\320\002\214\221\364\324_\347]1\354r\237X$7.\365\237\247\314\3477}\310\211Sqc}\231A\370SQ\027\302s\251\235_\237P\205$#d\367\n= o\177\022x\220\017u\247?\005bB\"\02629\211\304\303\210bS\032Q\\\266\305\332\335\266\tl\371p\364\274vd\224\332\277\252\3414\265#\273!\200\235\263\004\237\234X\332%\242\300\272tH(\264G\035b>\234\224\360\b\326F\342$\177\347D\205\371\320-<\200\236\352S:\362\336{\240\231f\306\220\241?u\262LH&$K\321(Xf\353F\200\224{{\016\304or-\r\033nn\304\333\231\356-\337\216\230\226\351\377|\271\367\254%\326:\246\357c\352\321!\317\272\326\037r\005FU\275/\252/4kIL\330\215\264\023\2319|\311N\311\222\t\221\371v,\023H\""
+	.string	"\225nu\0169\0227\017:\01787\\\031\002\347\326\2412\216\301\216\227#\"\227\343"
+	.ascii	"B\367\001\207\207\263\341\350n;\033.g\204\215\001\002\346\211"
+	.ascii	"\310\345\330H\360x96\363\354y\0371-\317\344\357\301\205kFk\263"
+	.ascii	"\203,4=\351\351\036\233\315\267\362\262\235\205\013\027\304\333"
+	.ascii	"\222\250\207\016\253Y6\255\351\225\261\311.[\364\342\343Q\205"
+	.ascii	"\214l\0075~\024\265\230\215\375\037Qac:\344\224\235\261\017\344"
+	.ascii	"\nX\214\t\235\312F\3422l\204\351\016\2435\237u\020g\211\263>"
+	.ascii	"\226\327{\357%m>k\230>\324m\214 \025\037\260G\207\274S\3575\232"
+	.ascii	"@\026\204\016\351\226\261\221\244\016f\255\004`\250a$\304\030"
+	.ascii	"c\210\021\222p\204$\321p\200\002\0211\253\033\020XFS\232B\213"
+	.ascii	"\001\n\221\230\336\344\244\2275*\024\005%\265\035\002\225hmN"
+	.ascii	"\ru\214\211\372\013a\313\273\227\360\224,\361\225R\\zIf<c%Cy"
+	.ascii	"\370\3154\004\003\363q&d\221S\366\202\362\020\354\216i\255\327"
+	.ascii	"\326\245\032\330\"\030X\255\tu\355X\223\2403]\334 4C\346\023"
+	.ascii	"\2143\002M\023#\334\366\013I\232\242\200\231\236\255+=+@\342"
+	.ascii	"!S.\337^Q\366\rM\311\031\213\355qA\304\357\215P\031e{(\214S\030"
+	.ascii	"\235\232\360\223\327\"\264\375<\007\005\373\212V\214\020\322"
+	.ascii	"_\367anP%\234\0330jd\363\201\304\355\212\334P=\006\002i`\216"
+	.ascii	"\201\353\355\206)\036s\323z\177"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.21.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\245\f"
+	.string	"&\230WC"
+	.string	"\261&\035[\322d$\033A0\201`\337\344\355?*\031gG\242Q\b\230l>\240\032\244~\317\275M[\004\366\3649\021h\213\327\022"
+	.string	"\337>\247\357\n\020W\366\243w\371\206\252\272\305Vk{o)S\nF"
+	.string	"B"
+	.string	"E"
+	.string	",w\241\241`\342f\267\263\324\345\333\341\323\334\374\320\241\316\300y\221J\301]\370\353\340T\036\200\335\255\270Q\352# \242\202\212\016N\364*\0245`nz\256p*\231\235\220\335u\2228\013w\274m\005\266\005\330G\020W\bCcDLJ\3468\246\035AB\236\344\233\236"
+	.string	"G\203\r\033\221\206\354.\224\332b\377\355\356ZK\266\323\252\351\314\364\343fs#\303"
+	.string	"j\227%\007\307\272\200,>\330F\261+\017(\200\342\355]\207\033B<-\371\036\216\305T\221\023\214\3532\230gw\004\342\237&\214\374\345\023\017S=2\320` \241\034@\310\324\250O\342U\344T3\312\033\266\035\274;\361\354.\210\037\363\022 \377\345\320\231I\236t\350\233\304\303\276>@\231V\202a\013F>\rH\262\313\"\3710"
+	.string	"Y\227\366\300\372\b\340\254\004\323,\bY\246YU\267\177\253%w\362'\036S9fP\372o\361\246\037H\305\230A=\177\213\252+\266U\035\222\242\"\250-_\321\"\024"
+	.ascii	"\252\322ia\272\016F\220c\013\357\3271\241%\254n\tTA\030\216\302"
+	.ascii	"\034\n\026\240\313\214\275\251a\326\001\027n\200\261\f\274=#"
+	.ascii	"\350\320\252\241\236P\240"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.22.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\315\007"
+	.string	"\262O75P\215\322\001$\213\230\232\371\211\3551\003\007q\0242=\307\267\331\371\324m\226\326\364\365m\030\324\266\347n\020\020\256\212(\302b(\236}\2653\321a\374M\244L)\266.X\3144\327\245\320\200a\310D\013f0\013\030\2642\r^\006\0345W\006\037b\314`\245\333W\253\243J\005>\272\331\337P\256\225j\b\350\264e\3126\366n\023\260\273\007>\351\035\321\307\370\263\203\226\347\376|\215\362w}\247\322\006\351\223)\277\264!\"\362\234\3234\201\332\324cw\236T\n\373\325\352\310v\272\312\364\337E$&%\t\"\273\241\324\311\242\236)\3036\307\256\270\300\200\343\316;\213\320/8\320\207\311n\007\265\342\235g\307?\307-\032\245m\004D\344y\002 \354\256\223\023I\334z\333\026\333\004\266=\002\t"
+	.ascii	"\252\244\2231}|\303\315c\354qM\214\031A\230\0209\334\271W;\237"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.23.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\342L/3`m\322\001@\203"
+	.string	"3\202{\013\253b*8\216\361\247\354\333;\346\202o\326Z\017\243\255\266\320b\220x\004A\b\032N#v$\304qu\252w[)S\n\236.\031\3676\024\305\360\200q\320\270\251i0\r\2316=\210v9\260\333P\257E8\367\232%\356U\224j\360\321\t\373!\217\320\347\260\004'_}\371\034\366\225\032\200\361\311\222\035=\251\031\366+\253\"\333\351\324\201\321\311\002\311nE)eM\326H\207\355\216m\361=\376\3211\314\270a\301H!\n\021\224\335\330\004^\300\276\362\004\354K5\016\237\320?\310+#RI\005\362<\001\024v\327Y\201.n\275m\004\333\t\266C\001\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\267\0218\013\221\207\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_findEEPROM.24.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\"\005e\""
+	.string	"f\277\337I\200\030R:\243\204\343E\203!t*\203\321Cb)\007\3771\362\333\300p\240\250\316,Q\303\267\200f\305\253\026(\243\032\334\337\t\177#\314\2204\223\2002PT4\004\212\356\275r\373\277\354\203\267\221k\237\315\022B\b\221;\311\322"
+	.string	"\272"
+	.string	"\323"
+	.string	"U\3146I\"\315\354\313\301Q\276\320\314\033Q\272X\2133@\313\224\203+\302z\324\300\311\367>\354\305k\3326+\215\222\266e>`\b\353\321\023\371\227\022/\3350\265\222"
+	.string	"\316\266\216G\314\264-\023\310\314\377\322\243\353}\351\321\336\301\354]\372\216\325\345V5E\317\276K\374\030\337\235jS\024\327\263H]\235\023\336\2760y\223\351\262I\034\327\035\310\235Y\335\365E\253\253g\003%\025\252\336\324\361\374a\311\321\345]RU7U\267\314\300`%o\034=\033|YR\2467\345t\376\242\270\236~\366\213\234j\272g\352F\004\fV\022\307\373\244 E,Ko\312x\242K0\345\233?\320%uu\257j\241m[\276OS\3113\357\314|\205\231}\230O(\001\314?g\222\264\266m+\201\257\344K\202|\037G\031Hx\377$L\217\276\337\374\355\261\364R\202\205\025o\0343\323x{\311\374\n]`\316pg1\253\227y\324\313;\347e\035\335\345\034\3662\016{\371\306\346b\377"
+	.string	"\366\362\357a\277"
+	.ascii	"\337"
+	.string	"z\271\206/\367x;\366\274\254\323]\316\345.\257/;\253\353\345T\275\214\236\354|\236\227[\275|\317\313'\260@\213\362j\213G\2671\333\25084\355\025\224\t\220\223\375e\277\314\347'\271\232\321\321\030\245\262b\306\350gOcf\031\351h\314\243CK\371\325\266\355\315\230Y$f\366\350eV\342\037y\223\331\262%\026hQ0\220%\235mE\2364\355\032\346\r\307\322!mt\314\026n\343\"\246j\355%\377\027*\306\031R\355,\346i\324\303\255\214@\273\210\016-%XX\201\270\203Hw\232\247o\310\034\253\3228\304\251\214\230\"\242\004\277H\217\356\364\323\236@\006\230\361\n\354\006\331\001\225&=T\362-J\251l\033\213s\372\255\3237\211\223\027N\347\b`;\302\301\270i\234\346{\254\3523\225\364\3277\335d\234\224\335\375\353\253]A\030\265\261\2662!\306\033\307\353\356\017iqN^\306\033\367\327"
+	.ascii	"R\206\006z\"\275M4\361''\326\266e\222\300w\222\302\347>\226\322"
+	.ascii	"\243\267\177v\005^U\316t\023J\323\324\331\313\"\177\373\372\210"
+	.ascii	"\315\330V\346e\234\240\365\366\245\223\3227\21217\246\373\306"
+	.ascii	"\001\254\242GX\004\024\026\371R\020!\r\203\320\242\023\r\205"
+	.ascii	"\216~\202BABFF?+\202=!\020\2619\33034$\026\001\001\371\b\205"
+	.ascii	"\202\210\206A \221\320\317\0200H4\002\366 \340a\021\020\021x"
+	.ascii	"4\034\022\201,\263\370\316buF\224\343\032\273\313\340\306\325"
+	.ascii	"\\\273o\362^\257\331B\261\215\273\346Q\267!\307\265\3665\237"
+	.ascii	"\272\263y\215|\363\034\334z\034\327\372M\316\247N\355]#y\255"
+	.ascii	"k\027cU4|\213\026]\277y\006Tlg\302\212?\333^\362\220U\225\234"
+	.ascii	"M/m\300\241:}6\222sl\363\211\356Z\275\256\227\271\037Vj+\257"
+	.ascii	"\371Tw\3156\2229\327\274\266\351\263\335\3165\t$^\216p\271^\362"
+	.ascii	"\200^\233EM\257\2764G\270[\2501,\004\225S\304\030\021)\021)I"
+	.ascii	"j8p\002\2219,\017\020pe\022\245\320\034\016\006\241T\372\363"
+	.ascii	"\020\021\316o\215\301\030\374\2623'\251\230M\306\256\261\206"
+	.ascii	"\302'\255\003\266=E\204\221y2Z\341g\tO\333|oo\352\213\202\033"
+	.ascii	"\244\352k\255q\322Y\033\335^k\003\371\2717t\264\026\316\301\264"
+	.ascii	"\344\247\271\3306qM\237\036\245\254C@\032\375PC\035b\366\332"
+	.ascii	"l\333*\254\2028/\337B\343\225\002ME1\360\346Jw\243\320\033){"
+	.ascii	"6\f\253\003\242\320\320T\321\240a\006\204\276\031%\2672\203\270"
+	.ascii	"\202\231\2165z\256\323\005\315\027\363\255\032*\342C\316g\002"
+	.ascii	"E\225\270,\332x\267\300\3027D\272\006\2518\335\374<\213\252\001"
+	.text
+	.section	.gnu.lto_pgRecordSetStored.26.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`k\001E\017"
+	.string	"\346\335hE"
+	.string	"\221(\035{M\341\222Q\212\247MQ?\346\311OV\364:m\264B3n\303\346\335\272\3714 \213\301\362\207T\004zF\033D\276\274\r\307\326\336%\bZ\177\327}h\271^\325\257\243\004\323\361\244\221\275\345N)T"
+	.string	"O"
+	.string	"X"
+	.string	"\025>`w\025\343\265\033\0360\002\355\323\341=\262O\355\237\354\323&[\306C\326r:\320\240\270\330\330\335MWn\272\324h\362\337z\007T\235\\j\270J\0035,l\004\250P\322#\345\003\370\326#\006\325\027#G\301\356:\202\252\f\367\274\355\005\266C\354\303\002\252b_\356\356ZWv\026\335\231\321\332[\3769\243\345Y~\005\360\251\201\301"
+	.string	"f7%\206ca\263\005\b\333\367]\376Rr\2279\256\032#v\327\363i\227\330\236\317{lkx\023\246\267\230\304\216E}\027\022h\237\035\361\321>\211\2270\235%0!\213Fq\224}r\\678\234\316\272\251y\251\2528\366\bYG7\254\204h\315\240\342\2155\355\350Qr\234b\314\005n\231L\252\246O\311|1\346\277<EI\333M\035\364O\034\005I\336\303\247\273Rv\260\224}\252J\375\313\345K\305\214\224\210/\306\354\360\213\001\234\307\251(\344\2519\020R\347\221\204B \321\b\302H\307m##\021\322\306y\0236\020\002\356HB\336F\241\353\274\315\023\236.WWn@\003v\322O~bG\357\372\013\320\007\315\356)\346.\034<"
+	.string	"\2012\021.\036t\200\230\031\230\005=\361T\333\022\3762\371`\355n\210\277\342\001\032"
+	.ascii	"\252\244\2231mN\r\343\326\342\266\027\037\255Pf\021\200\361\326"
+	.ascii	"\304\234X\366\240\r80\302Cr\274\r@\3335\270\314\302\357\202{"
+	.ascii	"P\023b\350\027\254\317\024*h,M\241\026\327\362TBN)\324\036"
+	.text
+	.section	.gnu.lto_pgRecordClearStored.27.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\005\007"
+	.string	"r\r14`m\322\001\240\362\244$\3763b\302\026\370.\214(\301\t\004oEr\365-\301\307\034A\324{\323u$\271\b*AC\2063\317- c\267\026\215v\2232\245\2366\035X}(J\241\201\303\340\201\323\363p\026:o\252\034\336f\300\360CU\357\001\302\352i\264\375eU\224\260\262\201\224\302R\006\334%R\301\377q\315\002\310vA\217>\310C |\216;GX\371x\347[\322\235-1\221\217N\022\225\255B1[\303R3\354_VE\266\n\214N\020Lv/ZXvs#\035\266\257\361e\243\\\313\026\2631\262\020I\331\335\247\032\277\236\227\177\217gb\b{b\016v\327\031C\030\267\3366\201m\003\333Y\t"
+	.ascii	"\252\244\2331\315zC$`\332qa$\013\026\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_pgRecordHeader.28.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\375\001\345\020"
+	.string	"V qG\360\260(\035\263\275\bP\253\310\325\236\355\031C\212\324\326\376Z\342\255\003\264\232\202k\004Y\230\324\2577\323\272\002\b0\"^\263\275\365O\036\2223\254e\361\\x\030$\230\fz\263Fmf*\333&\314\222%M\356\224\002X"
+	.string	"Z"
+	.string	"a"
+	.string	"\3369\273\304\366\316\251g[\216&\034\002\026\005\366jpi\337\304]T\1779\371\200\335\225\030,v\307\005f\3609\347\361\004\346\271\3177\3469\253\354\031\037El7\342\326\222\345\354\356\247!\256\272T\371\2079"
+	.ascii	"W\312\206\313\316\301\356Z\272R:\334z\333\035\266\037\330R\025"
+	.ascii	"\347B\372\330\345k\206\206\216\313\313J\336\354\221%\025\204"
+	.ascii	"}\317\356\256u\305\236\322\242)\035\232\322\240)\355M\351\356"
+	.ascii	"/?\327I{>\376:\245\037\240\200\212\f\t\264]\0167\235\245\341"
+	.ascii	"dJ\330\276\177\342\265\021\034Y\316\310\3544\222\307\230c\221"
+	.ascii	"\265\220\330\036\354\261\222\307\330\263\305\002\263\035\220"
+	.ascii	"\332\024\376\342\3430O\340A\306\252\251\335\250\270\247 \345"
+	.ascii	"\300\241\031\344.J\236\236v\371\202\331\250\r^\346\364\331]\017"
+	.ascii	"\277\205\210)d\263\273'\363\234\264\271n\346OS\244\327\303\\"
+	.ascii	"\001K\fV3S9p\373i\206T\244\006l\255\027K\336\374\2301<\005\352"
+	.ascii	"\263\213\342\341\243\320\020\372$Lf\27602\245>Sj\303\004\212"
+	.ascii	"ZA\fK\2408]\032\241B1\005\202\037\246\223\205\220\260\364\205"
+	.ascii	"\234@P_I\314\360\215\0208L\201\342'\022\206\342\347\215\253{"
+	.ascii	"VW\f\341\003\315JY\366I\323\216\360\031\022\3072k\251\341Q{\302"
+	.ascii	"a\220l2XM\255S\217\276\265\263\272m\323\323N_{\207\313e\005-"
+	.ascii	"% \200\202\2312>\342\231\246\234Nd\032/\206\201\025\344\344c"
+	.ascii	"\004\321a}\254I\244\r\273\013b\330\354\370\313\315JN\337\337"
+	.ascii	"\200i\333\034\207\263\032\241\264 U\033\304\343'\016vp$\202\034"
+	.ascii	"Y.$\2028F LM$\213\253-\274a\001\020\032py\321v2"
+	.text
+	.section	.gnu.lto_pgRecordCrcInRam.29.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\245\001\225\020"
+	.string	"\346\240qF\340\322&\035C#(\255\317\353#\267\247:\365/\345\265E\246\2568\272\240\253\"4\033\2446\263 \230\035\243\353\211\241\245jO4\313\206Y<\004\26181$B\0175\234\227\257\223\332\247\t\275\315\372\216\354/eJ\001["
+	.string	"X"
+	.string	"b"
+	.string	"q\205b\013\207\212\243]O\301\241\035\304L\373\257\327P\335\223\371\200]\034 B\273\336\0027\210\207\366\242m\177\306i\250\274JO\307\006@\013\024\255\036\244]o#9\201\3540_\222\035*\213\257\236+\377\261\207\304\330\361\271nf\236\"\023v\327\351\272)q\353m#\260]\301\316\223\017Y\305\261c\272\344\264\026\323#\207\335\361\336\017E\322\232\245\023\246/\300D\210\207\212\216]\022_\2205\202C/\016\373}\236\366\375\033\007\2625\303\374\307\245\234 \244\335\325`l\355\360\266\312\347y\314\232m\274Gu\237\230\2700(\324\2448\332\265\201\020\017\031d\207\255\002<>bI\006\276\257\262\021-i\001\242\326\tV~>\220U\236\003C\334\005\361\300\037z\311\340\2738\364e\262\303\021=\320Qj^\254\021;/\232\374L\222\331W\262\b:\372}7Qfs\246\274+\252\211\211\035#\021:\343"
+	.string	"\t\365?\217\261D\227\355\241%\357r\026\3110\n\2413\266\307J\315\261\003\356\220rJm\247T\311\206\016\305\231\272\214\3538=\231:5\227\322\202\352R&\223\206\023\013\007\027\024\267\271\260\254\264l\\\367aK9`T\312\324m/(T\267i\036\315mMOh\224\345\230\220\335\025\022\356\363\037\301\256\251\252\232\236DU}\217V\222m\341E\027\342\356\246&\370\361*\351\365\261\243\364\004\005\034"
+	.ascii	"Ve\206*\231e\332\006#>l\260\212\335b\262\034)c\234\250-H,)\202"
+	.ascii	"i5\246\003\200\315,\325\232\224\n\341\263\302uM\254R6\242 \""
+	.ascii	"\314\303\201\247\354A\223'0\340\204b>u\016\3325RRL\327$\003"
+	.text
+	.section	.gnu.lto_pgRecordIsDirty.30.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\324\001\315\021"
+	.string	"v\343zG\340\322&\035\222\243\312d"
+	.string	"\202Z\027zH\311\241\264\275\215\241\221\314N\265\230Rj!\220T0\201\345O\2645\333\261\021R\301x\313q\333\243t\243i\214\261\034C\266\212\032y$\002\004\243\020"
+	.string	"x\313\220F\366\2262\245i"
+	.string	"_"
+	.string	"h"
+	.string	":\210\346\004\027\230\301vi\360'\332\345\366"
+	.string	"\332\245m\2538\250q\353 \217\316)\247\004\216\320\2209\301\324\222x\353\232\214\253-_\305F\f\357s]\213'J#xp\337MD\t1\363 7\020\217\250\317\206\373b\272\361D\347\204\307}\260\210\302T$\344?\327\234/\246z\2120\347\264z_\207\373t\3332\266\033\330z #{\240\033\210-\005\345\030J\001\323\320\006a\2722\373\033\206a\350\335\261OjNS\227XM\242\251G\356\363oR-\243:F\365Z}"
+	.string	"\002~(]@\232S'$2\223\244\021\n\333\367_\034\210\346\240OBG*\346\234(\032\033uy\273\306F\331V\265\337\342.j\356\303\341&s\356\004=re\337\0366,z\342[\332\327%h\207\211r{\3605T\333\234\257\031\247\301\342\026\225\252\264\325\213\336\373rGHI6\353:O\023\023\321\256\314\341a4n\377s\023\031K. 8n\304\264\311%\313\355q\212\27444\202{\246\215l\311\376fv\240\017u\333\2347\367|\030\027\312\020o\342\3221\235v\357\322\3576/+\326Z\225\022\323\261fV+\226\027\030\027\231N\225\222\201i\211I\251X\032R)\005\334\315\254X\251\r]\307J\241\300\327w\307*\023\\\243\202\313\315\261M\262\004^\013\263\\\022\031\347\234S[\231\343\356"
+	.string	"\335\326\2260A\357\305\375\007\021\261ua\270\021\205m\316\t\301'zQ\005\013++\332\345\256\f2[a\364\322P\037$\371\b\036"
+	.ascii	"\252\322\001\301b\240\016\277[\3361\030\007K\306Aa\023B\205\321"
+	.ascii	"\202\221\325\f\266g\254\321\2208\021\307\007\241\341\216<\006"
+	.ascii	"\243[(=\034'\256K\262.13\353:.\030\203\262\354\274\232\211\205"
+	.ascii	"v\301\023U!\001mT\t\023\n"
+	.text
+	.section	.gnu.lto_loadEEPROM.31.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`G\004=\036"
+	.string	"\206x\306I\220\232Q:"
+	.string	"\226\325}cB}\254\355o\336Q8\016\216\031C\221\017\302\005\247a\231=\301\303T\203\333\373\350\2336[b\276\325\334A\313$\006!\222\252\275\n\374h\242\370\247\232\265\002\311\007\277\2619\370\277\021B\310\226;\311\261"
+	.string	"\250"
+	.string	"\261"
+	.string	"\366&\245\367\210\206\027\030\013\351u\312\223\347s\312\223g\026\342S\361\354B\324g\227^\243\b^\251\220\301I\206p\236\344\b\022\204\030}*\304\350\301\241\217\230\346\336\324\326A\270\204R\322\372\202R\322\002\273M\317\261\212^\026;\315\222\264]Q>\325\r\020\321`\2019\001\356.\263\346\220\321\323\271\340X\262\025\214E\256_\361j\f\310\221\322O\223x\002MGI/\221N\316\200D\326\347\336K\003\016Uks\224\264\276h@\237m\360\005\265t\342k\021\260W\373W_\340\005F\030\326t\244\364jb\270\367r\375\001\217\316\2633s\0273c`\266\b\002,\243\344\351\236\247*,1\275jd"
+	.ascii	"\225\177\242\25453\212[\375\217\247O\374\201X\331\261e\250\231"
+	.ascii	"X\031\0026\216\007i\213Me\006ZQ\377c\035%=\302\212\274\3361\247"
+	.ascii	"\273\332N\314\257 \304H\206\373\007s\317\263\316<;\267:\327p"
+	.ascii	"h\027\236o\310\3126e\345Y\254\262\254\254\034\343\312\347Y\331"
+	.ascii	"$+\227fe\322\254l\313\312MV\256\266\362\005\330\2220\351\bV5"
+	.ascii	"Xz\215\216j\356\026\222\253\310\263~\253_\370f>\363\261\370D"
+	.ascii	"\236e\311\2607\251v{O\242\030\271p~\310\277\342\331I~\325S\241"
+	.ascii	"[\315\b\304\177\b^\361m\221\247r\266\026\247o\272\210\231@\265"
+	.ascii	"A\2532\370\f\365\216gm\323\037\343[3\240\312\232\247\373x<w\225"
+	.ascii	"\314\0328\324\377f\355C\324;\216\265\254\355\227*?\261n\243\247"
+	.ascii	"3e;\235\307p*\212\354\037hy\366\233\002\324\332e\233\335\301"
+	.ascii	"C\375\357\354\237\036\276s\345\376c\006\361)\"N\232m\241\374"
+	.ascii	"\220\310.\273v\371\326\340\034\217G\343_\224\266\311.\241\020"
+	.ascii	"1\361\352\221\273m\3377\342Q~\272\035\f\031\276k\353\360\276"
+	.ascii	"0Y\303$\256U\342\274\2677\201\377$\204\211\223\310\311w\007\237"
+	.ascii	"\2740Q\rk\324c\035\252A\023\306\266S7\234\256U\340t\035\024\204"
+	.ascii	"\273\335b\004\231|{\300\"\247s\201\303\235P\001\224\242E\356"
+	.string	"fk\001\204\202\205\355\246\013\262=(\3009\0278\235\rF.\247\263\315\322[\274\215\341\364\016\357\234e\250\244\204\025k4\257(k'\246\260t&0VF\213\240R\037\236\242\230\204\265.b{\322\372T\337\020l\342\333\252?Z\342t\221\026T\352\274\227\350?>\226gA\217XF\241~'\371\250Ty\262\326IN\314\3700\323\305\253W\215\267\367\336\033\353\020\f\343\3332\313\233\246)xNY\353\236\376\325-\222\034_X`K\242x\365X\317\003U\t:\025c\252\030V\354\365\316\306\225\033C\314v\342\007K\2501\030\007\032\003\005\020\031\231\t\204\202\220\346\032p\002!23\017\020hX\223\244\260\214\001*Su\227\303_4\006\234\027\245\316r\200\201:JG\223d\372h\363\365\240O~ e\357\2709+\363\031\177\356\365\305\374\007\224\323\255\b\243\324X\033S\350Qd\235\035\240\0330\343>\006\030\301"
+	.string	"\025\201\366\377\265\303\217\214x\324\006\216\241\033\275K"
+	.ascii	"8|\311\370\355\240\352\260Om\231\355;\340\026\375\020|\250T\017"
+	.ascii	"\224'\021c\2775\030\n3\002'\317\021\255\262\202P\020\272\t\233"
+	.ascii	"\343\326\255\\\0379\242\177\321\221\204\302\206\376\2270\177"
+	.text
+	.section	.gnu.lto_writeSegment.32.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`C\n5:"
+	.ascii	"\232fl\026EP\036R:;&>43\226d<\307\222\275'l\356\203\"\314\006"
+	.ascii	"\356\214\026\026L\017\237\332\372\017\004\351P\245\3070\r\374"
+	.ascii	"\034D\204\017\200I@\020\275\255\225\307H,\250{\r\234\354\232"
+	.ascii	"[Y+y\322\310\336I\006V\001>\001S\001wS\3635Wg#\325\276SZ4\\_"
+	.ascii	"8\332\373\216\353\213\272\257\372c^\346g\276\366i\013\373h\236"
+	.ascii	"\346\352l\312\277\315\350\b\273\035w\357\033\235j\357\303\322"
+	.ascii	"\005/b\325\254\332\227\255u\256q\335\275\257T\206\231\032G,\342"
+	.ascii	"\313\344Z\233\362\276Q$\031\252c\226\364\215\252\260\263\303"
+	.ascii	"f\342bl\034\261\244oW\006=x\\\034\334\327\037\332\365\313\323"
+	.ascii	"\256\016\306\n\023_\246\326\030\206\366>\"~\021+\335[\302\270"
+	.ascii	"\373\\\336\345\352h9^|_%m\330\336W\n\241\225\332\373Zz#\366\276"
+	.ascii	"\366E\354}\023,\\\265{iY\327\017\232\347\f\203\367\276\322\244"
+	.ascii	"\314\244Y305:30\265:_\245o\"vO4\034\022\022\022\201\355\217\365"
+	.ascii	"\0053v\373\237~\315\262g\317\323\013\353DE>\224\023-B\004\017"
+	.ascii	"\r\271\320\020\244*\3211,\\\177[]Q.'*\266^\320\273k{\334\026"
+	.ascii	"&.\371Qv\340\347\336\202\375\2676\270"
+	.string	"\233\376y\225\350\327j\324\025\3459\364rbv-\002S\243\273\234\350\327\372\200\316,\354sM\354\303e\017\"!\371\021\366\274V\310\343\025v9\321\260U\bD\017\335\247\307P/-\214\177\032\336\367m\374\364\372\361.\276\373\022\272{\254\0338#o\035\234\204\342\246\324\005\271\033\304\335\254z\t8\206\026\242\355\223\005\345\004\330\356\021w+\321Kw\273\202\246Z\226>Y\270\n\264\363eN\316d}\314\005\262\321\212\227\264:&\326k#\316y\315'P\034\233\031\253\013\3445\037\347\234!8\007e\341j\027\310\3178;\200\323\274\362\367}\021{\314\317\307\2633\327\264\242\205\253m\204\337\366i\212\366\331\275\202\005\376\263\215\246\321\274;f\306\352\226j\341L\326\375\013ezz:+\351.\342\026\021\302\211C\021w\323\305\274\231\224\036\034\314\277\240\210;\001\322\321\376\343\245\177\201#\343\200\025\267\200\"n\243\"\356"
+	.string	"E\334"
+	.string	"\016\367.\256\270\211+n\242\025\367p\305=T\304-\264\342\026\022q\007\257\366\006\022q\267D\270\177+n\266q\373\206\270\327\025w\036\302\2151\356\217`\302#2\346D/\327\221\276]UA/\325\327&\345r?\334\317\346\027\363\223\371\315\374j?\333\333\356\367\333<N\267\260g\234\332\300%p\360\336\367\025\272\351\317\2759\234\253\313A\265\357\024\023\\Z\236\325\336'\201}\021\033\327B\270(`\227\335\023\035\355\214n\341\333:_\337\367}\211\231\254{\375\031\363\036\234\217\326)\017\310\320\356\257\375(\207\310\217\373\007>w\352`\340\231\360P\006\342\n9\n\345\241\374\265\n`\256\030\376S(#\020\023BE\200\1779\230\205N\034\2620\177\357\031\314\302%s\264\240\375r\233)\030i\266;\0047\335\"\355\373\276m\216P\207&\"\377\362\004<U\347\240,\234u\013el\346\220\217\306\314\346\fx"
+	.ascii	"9\007!a\226\372\271\267t\336\330\362\356\232\262\210|\304\306"
+	.ascii	"\371\245\025\247\335#\337\243j\337\227\271\324\027D\302M\322"
+	.ascii	"\177r_?\212\275\257)?\316\017@\321\266\300\272\240A\300G\371"
+	.ascii	"\324\317\271L\334&\256\023?\324\255\214\325rg^\306Z(\271g\267"
+	.ascii	"7-+\2217#\301]w$\314\237_&k\227\365\345\337a\200\217r\267+\305"
+	.ascii	"\245\202\377\364\345+#\314\214u\214&\350O\035\373\271\343\261"
+	.ascii	"3,iw\230X/\217y\333\362\362e\262\306\370~\376\270+\320\313\355"
+	.ascii	"\232\271g@:\267,\357\333\374\263\230\241\237\276\315\233\312"
+	.ascii	"a+6\353\345\007\031)C\373A\251\365}\2214\335}\301\325F\200\277"
+	.ascii	"\347\026\312r"
+	.string	"\265\372f\303v\273Z\334-\370\317\007\231(N\r\022^\357za\377v\267\rKv\036\035#\002\024\215$(\032E/\226Jdr\311B%\227y\231|\361\224\214\301.\223RO\311e\025U\213\\\"\3632Y\245T\302`\221\313\016SOQ/\246\234\240\2428\274HV-\2237\246\242\002PQ%\221H\033T\277)eT\325\32329\225\204\n&\251\236\\\2543\246\236\\\254\215\214 \245\\\322H&[@E\301\230R\"\223\246\242\236\244\222\220K\252\244\b\006ZI#\271L\252R*\227IBi\326\263\022\246<\024\013D\315\312ZME\246\206\031%\033\221\007\334\255#OG 7~\250Z\031\013\200\031=.\303Lf\304R'\355\216\203\013\310L\371{\3166-\\\335\023\220O\007\316\335\220\216\352\247\177\0177pBDc\006f(\026'iuMZ\356\326\224\312,\343:\231]\250F\371d\376'\237"
+	.string	"\331(c:\316\260\004\031@\016\220?=\320\031\204\230\023\344\306bW\312"
+	.ascii	"\262q\2559\250%\312\304\374\246 \245L\224\377\307n\317\327\223"
+	.ascii	"\206J\300<\314Kvo\270\355g\\\036\025\332\260\0333\352\025\260"
+	.ascii	"\335.\364g\254z\351\323'\020C\207w'\314"
+	.string	"d\375\270\257X\302\200!r\007\213\371(C\0338 \367\032D\312\306\f\305?\334\263\266q\024{\271\\\253\333\365t\317\330\373\216\016\36083K{\303\304z\177\200\310\250a0\345\024bf\204dF\202h\222$\035`\002\231)\253\352\021`=EUR\220\202\024\2061\243/HU\321\343G\242\310\232\313=\374\005\004\217S\025\205'+R\314a*b\314q\231\031 \225\320e\263\271\033s\021\377\302\207;\213b\026\333\003\206\n)\302\232\233@\202\273)\305*\263V\367\303\216\271\320 RXB\210\313\204\243\361\2105q\371+\257\222r\316\240\276[)\242#\200\202\265\221\211+\270n-\200\b\347\222=\027\276q\366\367\233\n\242EHZV\265\213\0175\006S\225\301\326\356)\267h\316T\333hDn\234\274\306\202\347h5\264\366L\001\266!Y\256\330N\351\t\220\311\234 P\023*F\322\273\276Y\253J\236*"
+	.string	"p\322\253\375\332\315P\303\274\352l\177{B\230\365\035\":\r?\340\354\0048Q\315\224f\221\005\b\272A\3013/\005\366\365\372}\311\336\306\336\332\272\330\r\027\240\254\235\321@\207\021\362\032\341\002\233<\f\247>\356\320RY\330>\275\016H\346i\300\335\021\242T\374\244\257+\254<\257u\211{\337\347\336\257x\337#\306\370Ax\361\363\273\022{\304w\223\255\230x\335\266\026c\366\230k\372;\2074d\262\3043\230\032X\246\330C9\004p\025\030$Z\363_8\3712l0\275\033\217\241fV\300\327\261IG\345\nX\224R\223B\275\306\356\004\252\362\034'W\300\002L\272\237\311\220\356"
+	.string	"\247\030^\351\214u\024\206\316b\254\202E\342\017t\r\340"
+	.ascii	"~]f\301y\334\343\311\231\234\376\001"
+	.text
+	.section	.gnu.lto_retireBank.33.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`t\001\345\016"
+	.string	"\346\233eG"
+	.string	"\223\223\016\233\367\027\2475^\005\376\b@G\260=`\321\300\364\030a]\323B\206\232\bOZ\212\217\250\265\002\032\250?}\220\005\f4\252\345\344P\273^\3626\240\337C\374\214q4\035\213u\321@%\221l\262eJ\001M"
+	.string	"O"
+	.string	"T"
+	.string	"\231\252\375\232\267(\335\206\303\001\354\322\310\320\331\035\017\030\301\366\351\361\036\355s\273"
+	.string	"\355\323\266\023,(\331\364\321\204*D\325!\205\343cw\354d\211\233\256&\377\256\317\232\0377\304\231\3235\304\301\356Z\305\231\017\267\274\355\002\266%\330\357\021\317vw-i\314\335\346\237\232Z\247\372$\003X\330x\241\261\253\212\001\331\327\3349q\326\337\272\332%\377\346.s/\216Sz\313\345\213ZE\310\341\001\266\273z\260}\352h\300\376x\027\245\263H\333i\265\301P\201\200\355\352\224|\232\301\366\371\t\236\t'zQ%\211\210\025\036\n')\002h\366\n\332s~\203\242"
+	.string	"\307\256\314E\017\204\342\205:I;\353\323\025C\305\216\021\375\356=C\273T\t}P\362\344)/_t\244\202\300h\314\"\372\234\273D\233h\203\032\364\242\265F\210\227\214<\331\343I%\t;\341'\362\276\260\205e\013\277\024\357\203\220\022\312\340m\030\205F0\214<\013\231A&\"0\\\371>\024\225\320\205\021\b\352F!O\324\201B\226\316\204\200\301\225/\354Z@0\354\270qoN~`d\214I,\227lwD\203\267~\030Kc.\271JNN\036\251\235\030\2159\034"
+	.ascii	"\252\244\223i\021\206U\254+\301\020\312dN\365$\002%\\ \021\220"
+	.ascii	"a\230\326\202\323`\334\027bJ\025Lp\255\244\2019\254p\273F\201"
+	.ascii	"bQ\244&D`,T\001\301\025\002rp/y\212\216\351\232d"
+	.text
+	.section	.gnu.lto_compactEEPROM.34.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\034\004\365\034"
+	.string	"\2066\274H\260\326M:\024\214\340\212;^@\307\265\357\016\032\260\360I\3153\n/K>V\031\335\316\3741}\316pt\243\307'\246\230\3619?\333\322\274A-\355\217\375\016\177\303\304\234\322\357aE\246\347/\201\255\021i\204\020)S\n\254"
+	.string	"\224"
+	.string	"\255"
+	.ascii	"sN /\032\bQ\034h\002R\346\234\265\265{\374)\327|\250G\365\\\212"
+	.ascii	"\347\263gT\022\0255\225\315\t\\p\321\016\310\213\006\3766^$?"
+	.ascii	"3^\364\203\b=\3669\220\251hV\304$d\265eN ng\334\347\264\222\234"
+	.ascii	"\215b\270\352\343\377\234v\301K\031\024\027\030,\224^\206\b\222"
+	.ascii	"\236\210\330\210\025\311\361'\243$%\237\214^\350,T\340\363B\252"
+	.ascii	"\035\t\2057\260\030T\036f\244\244#\355\310\305\305\236\n\r\221"
+	.ascii	"\276\341LR\226\030\200\243\240\220\201\330\r\245O]\211\216x\252"
+	.ascii	"\263\nsN\353\320\021\213\273v\3339lS\260\303\001\001<\344\234"
+	.ascii	"S\202O\344Y8\276\323E\347\204\320\017]\364C\214\027\277MQN\276"
+	.ascii	"() \r\332@\236\356\317\376\006\203\301\240W\206\255j\233R]#\252"
+	.ascii	"o\242\232\306\352\031R-\363\252\333fu\f\251\256]\352\246\251"
+	.ascii	"\272\264\232\034\325\263\231z\034\325\342\250\016E\365\212jU"
+	.ascii	"\365\005\234\313\322\026+)\264\346,\n~\231_\"W\215W\375RW\373"
+	.ascii	"\276\220c\3315qF\327\2269'\n\273\026\3048&\373@\337\312\265\213"
+	.ascii	"@N\325\363\252\023\344\217\0219\204\314\251l\006\343\270"
+	.string	"2\253Qz>\2369\234I\207%#n\207W\217\213\373\363\255^\322\310\342dm\326V\243IHK\377\343\206\266DF\376\375\324\003<\251\362s\345IX\243$g\223\322e\263\333\244\207\343\2665{$\247\331\333\276\367$.\315\036\353\t`d\361\306\256\302\350\235d\fW\\M\322\343bp\333\206\373\027]\310z\276]\333j\023\2410@s\336^\243\356\256\355\252\2137\026\304\007O\203\376\325\271r\005\220\276|Ps\002}\310\337\372\021\0177\271\234\356\255.\362\3502\326\323\301S\261\033I[\273?\363\214\337\017TS\202\264\213m\335\213\004:\0239;\271\233qG\207\243s\2633:\327@\304N\207\204N\347\001'\007\304\210]\0167\"\347F\004.\247S\002\327\340\200w$t:\270\235\335N\007W\003\002}eX\311C\371H\206u\2455\373}FZ\221\224\220V9c\201\314\307\225\326x'\217\211YW"
+	.string	"Z^8\005h\2716\206\f\372\241\231\245\361\201\371\n\332\037[\311\227\245\026\345\376h[\356\303\250~*V[V\310\375\271\f\343\001+WA\024\226#Y\300\226f\373\263\206\376n\274\r-+D\231\255-\221\317H\336t\266\264\245\255\255a\203~\210\\\003\275\375qmg\013\301\213V8\356\357\273H\250a(\245\224\"\210(#D\"\301\210H\332b`\002\021\242\253v\020P\251F\225\306\312S\207j\260\275\2461\230\261\307\320 \342\372\364<0\213\343V6a \362`ki U\373\235\321_0"
+	.string	"\305\013Z\271j\335\260\305L\252\305J\247\350A\314\321\033\251=\220M\351?*s\202\251\300\247m\310\344\365d\020\220\235\005\300\267\362\225\220g\214\201\350\326s\275tL\031\350\247&\013B\225\023\001\300\037>\342\021X\227\242\025t\350\\\214a\300F\310/\262\360\250\013U&\317E\374\330\373\036-\337\276"
+	.ascii	"\325c\021\273\007af\312\247j"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.35.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\205\005\225$"
+	.string	"\032E\370\016E\200\236M:\373\317%\264\364@\t\270\316S\337\322\251\235\267#\323\024*\"\fi\300\334\t\2161\317}\350\030\252\200\315{\332\005\214\274q4\264\301V\334\200\022N \324\006\214\335\001z\373mm\315\022B\b\221;\245\340"
+	.string	"\306"
+	.string	"\340"
+	.ascii	"\30116\034\320\2276\242:\354\333\313\333M~\3217\237\313\257\232"
+	.ascii	"N\344\201:\tQ-./\26245Jxi\n\350K\242\013\231/\311\007\231/]\341"
+	.ascii	"B\223{7B\t\236\301\255\250\254\26245\356\366\211M+\"[q\254\210"
+	.ascii	"l\211"
+	.string	"\2354\336h\355=\207\273\331j\350i\226\244nk\317wz\356\f\242\341\301\365\310p\321r;rEh\244\332\302\204E^|\321\025!\222Z#O\037\301*\017\023\022!5\234\221\231y\226\217\212\236\035\234\004\251\372IuS7\025E\022e\375j\371\342I2h`\270\230-\t\202\344\344\237\252\256##$\361\022\362+\302$\244\220\033&utSPu\311\r^U\324\350\246|\244\311\244\314\223\027_\245\246\240j=;\244i\352\n\234\nr\003\335\376\002\333'\354\262\006~\317\254\3738\3079+N\246\307U\367A\224wI\351\232\262;4\016\363\373\342(\007\252\236\331f\361-\034h\232\246\030\3740\027\343\302\247\362\322G\274z\340K\237g\276\374\226Y\352h!>\3254\343\252\235$\243\036\350\027\217\302\f\314\214\314\267N\266\321Ww\3705\206\315\024o\023\033\255.r5\021\202\003h\265\001W\027p\365\220"
+	.string	"\264Z\310\325"
+	.ascii	"\216u\003\351r'\336\270Z\365\r\255\266\225\325\265\262\032-\253"
+	.ascii	"\317\263\332,\253K\263\232t\365\272\272\226\325"
+	.string	"W\3604\2602<=\306\3224\230\346'\005+\315X9\326O|\265\357w\271\226}\263\216\177q\016\315XY\232\2467\372Y\276\227\037\233\216\225\343\351OX\013\265\035:C\221\023\301\231\316\036\214jbw\312\200V\312\344\231\333\027\217\232\365\031\243\363y\230\272\225bc\204\246\351o\315\275>\220 \214\314\003\215\314\227@\273?\210|\216^P\365\354d\232\246)\232\365\032\234>\177\314\003k\262\324mn\245l\b\0172\201\026\301\232y\320\306~X|5\255\236\272%\367\300^h\311\007TcG1\255?\346\037\230E+\264\256\277$\t\322\036\3024\260EK\240+\252\312W\323|-\217\370\031\022h\232Ba\360\273Z\224\360\251\3440_\032\330k}\201\024\321\367\343\352o\350x\001c\356\260\314w\231\216s\006T\240\265M\240\250\007\356>\353\007\322\346\n\fj\265\320\370\230*wh;@\265S\250\250\007\022m"
+	.string	"%V`\016\206a[\310\035\372\327"
+	.string	"\345\214L\267M\002\2161\001ii\207\264\024\204\304cZ\336\216$\0237h\360f \361l\334|4a\206\022\323\022\217\307\002)\t\006\r\245\243\035\215$\0273vGL6v\023\024Xi\211\307\264\273\241\244\304\264\273\031\237\276M\\#\355\0137\264\266\340Y\024\327\255\300\236cv\264\270j\177\317|\361\"\202j\242\270H\242\005`"
+	.string	"\353\016O\353\3131\250\267-\027]\273\247\245\267\245\0368\264D\277u\262mo{8W\247\023b\216m)P\3751\033\302:\202\205+\260\001\224\354\301\225Icu\333\241k{\356\213\343\327\323\364A&\272\2655\367\304\201\203\256\205(\304-\367\334\377\260\bXs+Z\324\037\273W\374\033\034a\345\226O\374\230\021\311\3630q+`_|\003*?>\261/\r\206\350)\263\221\250nq+\365u\334V\025\255\034\345h\200rF\026_\250A8\242\224DLI4\"B\n\223f\f`\002\231\241\273n\020hH\022\245p[#\223J\337Ia\004\366\357\317\323w\r\002 \337\025\352E\007\211\205!<\320D\023\202\265\337.M\024\032IP\227@Ie\374\0217\n\365; \357\b\213\364\\#\363g\204\022\233H\376\235,\330\3522\360\242&\222\372M_\231\036\325\342\211\325*\202\221PZ"
+	.string	"\027\033\021\027\222ti)_\033\025\200\334[\330Jyo\321\251\345Jr\351\364mZ!;\004\312\324\335\264A,\327\2460M\033\b\201\024\347\207\210h\035fj\352\021 \227\005"
+	.string	"\232\250\217\2572z\b\260\204\3172\0048"
+	.ascii	")t^\241\373\036\266\370\331\235-\324\263\360M\035\327\224S\246"
+	.ascii	"\215\\\326\325"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.36.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`g\0025\024"
+	.string	"f\345\201H\340\320(\035\3308\n\2065\370\034\233\236\340\211\215\003\246\213\006\373\021\352\242\023\025\331\327\034\354"
+	.string	";\016\373Z^!\210\034.\317\314\372=\225\312\3243\306\030c<i\b\223\013\002\202\bs\200\374\215\304\342#\022B\366\2262\311r"
+	.string	"f"
+	.string	"l"
+	.string	"\252F\0377\264\310\314%\002\345\272\273\304\032\224/\307\253\334\3267>\257\233\222\267\245\347\210\201\337(\220\201\306\346\237\034\271IQ\263\002\307\305=\314\330\254'G`\224\220\021\"\303\341\325\021\023\267\223\244\241\031\231$\325`vJ\001\335\r FA&XX,\\9\2539\337\347#2\021!\321\210X\315\3273\351n\335W\214\346\312qU\375\240\252&\252k\no\316Q\375\360\270\355\372\235v\365\276\332}u~U~\225\277\272_=\210\310\211\020\027bV\201\211\306\2269\242\321\267i\242\303m?\355\253z\325\203\320\373\274\347c\3536\025\"\275\214\035\363~\\\267n\360}\222\036\322}\312\203t\237\177M;t\001\203\326i-$pl\231\016\307E\202\226\353\036I>U\301\367\251\2551;\266\030\270O\326\321"
+	.string	"<\374\361\345f1b\320\222\374c\230J>\277\366\217\305\354%\006\355\201\3561\254\245\223\354\240\305\313\316PfYC\224y\314<\205D\013.{\244{\025\352>^\226*D\236p\217.\273\273\245\"\370\307\037L"
+	.ascii	"\347\"\202\271\t\367H\345\252N`\331\277\316\367\371\200\242\241"
+	.ascii	"\013\267\220A\356n\220YGu\0047,\025\324\211\305:\361V\253\223"
+	.ascii	"\311\264\262\362\324T\202J\251TN\247\007\021P \244\244L\245\024"
+	.ascii	"\224\023T\311\244Z\225J\fhJ\345\244*\261R)U\251c\354\2779G\325"
+	.ascii	"\304\205C\375\006\307\316\243:\325\224\204\375K\017\f\365\334"
+	.ascii	"^\030\324\\\321\013\334\327\361\032\255:~m=\326\321\311\337\371"
+	.ascii	"Ya\331\277\246D\201!dP\307\356\356\244\364\330\203a@\367`Y7 "
+	.ascii	"\200\002\231\272\352\006\352\351dM\377\212\021{\246\033;\023"
+	.ascii	"P\326Z)\241\331\324^Y\243*v\tdAI\226\370\244.n\241\372.\240V"
+	.ascii	"\201\224\020\302H|\244B\254\022\032\266\227\316\3620\274^\333"
+	.ascii	"\350\205\246\373\230\273\225g\331\003[*^\177c\001\226t\017\351"
+	.ascii	"\353\340v\313\212\031\273\244Kj\271\3121\341n\\X\316\253G\016"
+	.ascii	"\3576\312>/b\nc\323\366\267\243\204\022y]\364\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`\302\004\245\025"
+	.string	"f#\205L\240\324q:$\300\240\244\201\256\003<\257q\205\001\374\016G\377\350\374\023 \t:5\223\002\351\300\313\201\177y\324N\246\360:\274\016\257F\257\303x\021'n\372\223~\353;\354\260\361r\320A\035\226\340\246Q\255\226\304\t{\004\371\324\344\016y"
+	.string	"q"
+	.string	"i"
+	.string	"&\013\032\366\331n2xz\264MI<V(\350\225\004\215~\b\n\354\f\365\206\034h\225o\247i\237\232\232\232\322i\231\001"
+	.string	"1\0270\247\005\244\210 N\2377\235b\023\202\326Z\0165,\240\n\034%\200h:"
+	.ascii	"#)\031\025\231\3512\207\310\022\f\231&?U\232\246iL\243|\267\226"
+	.ascii	"\325#\230\022\320Z\273Jm\266[\fk\333\332\244\033\363\270\210"
+	.ascii	"\222zi\363\263\326\202E\001OD-\361\234\223\211\347\225y\250\007"
+	.ascii	"\245\224\022\276\206\342\372J\3659[G\277\326W8\376\226X\004\221"
+	.ascii	"R\201\347\035?\312\210\217\023W\235mluO?;\256:\213\307\241\r"
+	.ascii	"\204\320\371o\350\030\r= C\023\300\3208\027z\306B\323T\350\032"
+	.ascii	"\nm3\241o$\264L\204\206\201\320/\234\336Rkg>\335\302\266\306"
+	.ascii	"\203\203\334\3235\007=k\320'\f:\374K~\206c\022\251G\303u/\233"
+	.ascii	"\335\313r\265\373\223\247r\177\256'\353y\177\242\362\316P\017"
+	.ascii	"\212vO\356\302{\022\327\272'\3251'\256\347\275\250\322\356C\034"
+	.ascii	"\177M/\214\202\276\373\027\216\277\242$G\200\210\367,\365\274"
+	.ascii	"_\361\330\345\244\343\321\356yE\357k+\367\314\233\215\347Ue<"
+	.ascii	"\347h\343=\240\343\312"
+	.string	"\370\225\215uz\004\226\305c\213\304I\310\017\227\330Y8\206\215h\021\302$\366\325\216\355Q\232\246\260\330Q~\232\246\037\312\330C\225\031H\207\210\024,\346_\273\320\374+w\232g\251-\346;X\363=.\363(h\036\005M@\330\307\035\233k\320z\313\2176.\271\221\203\210,m0\375\220\020\313\263\216[\204v3\310\362(X>\334\261eJ\202\302\304H\376\245\013N\2501\020\307\244V \025\024\305\260\220\345\340\002)\022\321\003\021p(\016!$\022\t$\020\213\210\350\001(+i\310E\200\360:\007\330\211y$(CIr9\340+\356\264\206\032*8\272NJ\200\356m\221\342\"n\345W\032\005\013\311\343G\254cU@l\273[\017\203\r\\\301b\006\243u$\341\260\f\345\260\314\304\213\367t\203\376\023\310\020:\302z\005\217\213\250\335\276\205\254[\007\017\326\261\213\367}\2753\374\230|<_\277\232d\023"
+	.ascii	"\215\262Q\231\365t\362@\363\306>\337\301\340\243\n"
+	.text
+	.section	.gnu.lto_.refs.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375 \301\005\004"
+	.string	"\322\311\031\035\240'\031\016\377\377\377\377\377\377\340\013e\321\032\221\331Ok?!{\351\333\275\t\3312\245ZP\323\260V\230#\027e\203=\254\262.5\2235\211%@\026\254:3\235i\316\222#\302R@m\300\210\016-\214!\306c\314\342\330\325\222qc\001{@kX\2275y\2215\255"
+	.string	"g\022\257y\367\376E\362`}\235\232\020\b"
+	.ascii	")\202\203F\261\306\375\204\031\317\242\375\032\226\266\023\225"
+	.ascii	"\"\230f"
+	.text
+	.section	.gnu.lto_.decls.567dc7b3f7fd65c8,"e",@progbits
+	.string	"(\265/\375`_/\355\310"
+	.string	"\212/\325BX \214I9\351*\006\245\352A\230\026c\307\250\264n\236\246\363x\352\317T\351\253*Na\325\217f\256\343\336\033go%7\276\347\025\323\331h\260>\361\235,\345g\347f\027\271\224\213\320\022\220\352\317/\016~\3277F\252O\003\247cBb\307\317\017\3057\262\375\275\245L\001\213\003\t\004?\004h\347\360\032zf\202\236\313P\275\030g\024<\267\266oM\245\315hH\f\025\301\005o\246\216G\215/my\213X\b\340\227\223\251\035E\320\263\333\024~\253\351\0250,\312\352)\307e\325y\205\022}\355x\302\375:u\254\003\277\331$=\334!*<\256\270\255\216\261p\226\232^\271\020\345\343y\357\325\251c*\\\305F)\275I?*Sv\274\003?Y\013\337q\312u\3479\276\302m\347\364.G\204\370\365\230\343\342\242\261\347,\177\023A"
+	.string	"\202lK\332\244\332^\347L\207\363Kb\246\367FFG\332\f:\"\350\217q\254\374A\231\266.MW>\3203\2178\264\312\263\206\233\024zn\242g&*\202A\374\256VM\230\"a\370\332\236c\2409\f\342\247"
+	.ascii	")\037\240\31242-\266\265\"I)gmO\302\b%\360\032+\3413\233dz\221"
+	.ascii	"~QK\236p"
+	.string	"\024\206\302N8\345&\254\366\020\351\275\312{\357Y\013\215\277\370\215\231\336\0303CJ\220\234\327X\214\313l\204\322\233\004\3742#\342:\t\277\316\032\247\361\327\t-\222\256\022\254\213\204\244]\230\f\275{\323\021!F\214\030\001\344b\004F\227\214\345\020!@\337\001\224\317\232\315\230\311\371\214\227\320(/\237\331{\205\2309\260a\346 F\315J\350\353go\002=\f(\217q\022N?`\262s\030\203=F(\275iS\201\031C\001=\177\360\253}}\374\301\357%\240\215\363\363\300 ~?;\277~a\232\272\276\332\036a-\366\252K\243\346\025\2737\375P_l\341\231\265\345-\346\342t\003\356\372\b%\274&\275R\255{\323\033\032$$\252f\333\207\200\376\317\3418B\267\004\336\340\307}\274\301\357)\203\370\241\214\363\373\033\207\003F>\363W\244'X\275\001/\017\376Z\325\032\370\031H\323\220\001\022`\300\204U"
+	.string	"\376\352\201'~\366\005\376\266\300\337\025\370\371\002\274\243e\320\353\030\232\002?\207\351\t\374\335\177\303\320/\274\003\355\302\337-\374\315B\253\300\302_}\032M\341g\250\226@\337\240\360_\313\337\021\260C6\004\372\001\1777@\003\004\374\265\350g\032}\302\\3`\206S\320&\274K\003\354\342\202%\264\316A\374\r\346g\267&q\340_\037\3603\225\237O\264\b\035\002s\240\023\360\337\304-\370\253\013wu5\037t\216"
+	.string	"\376\246\373\272\375+Q*\363\327\244\032\037u\n\332\203\237\213\032\207.@\210\277;h\002\034\203\277\022\340\377\332\317\032\374w\"\200'\377\325\206Z"
+	.string	"?gp\301_1X\322\031\374\177\376"
+	.string	"\177c\360\233\277\006\317\177\265\341o\013\376\366\360w\360\357\230\277\353\317}?\357\375\274\345\347\273\237\257\374\034\367\363\224\237\315~\036\3739\354g\260\237\277~N\177\346\372Y\353g#?g\375<\344\347 ?[\375<\3653\216\237\243~~\372\331\351g\346\317L?#\375l\364\263\362g\025\374\\\303\317+~&\300\317#~N\361\337\354\177\334\317\026\374\374\341\377\226\237;\370\331\347\377\224\237{\376\223\375\314\363\263\t?\357\374\377\340\347\017\374\334\201\377\036\370\231\206\377]\3775\370\331\304\317%~\236\341g\031~\216\341\347\004\374\f\302\317\036\374\327\373\357\365\263\001~.\300\317\"~\006\3613\316\317"
+	.ascii	"\370\217\027\345\377\327\177\f\374g\373oA___\337\217\232\340"
+	.ascii	"\217A\301\337\201\007\002\317VJ;\017JVZ[-\374\345\277\r\2270"
+	.ascii	":\033\375V\363$$OY\205\276\377\337\2751b\322\2334Ds\216a\316"
+	.ascii	"\371k\270r\007u\230\336$X\026<4\210\231\020\r\0217\347\336d\322"
+	.ascii	"\322\t\225\374\260t\n\335%\330\233\322\207ezo\004\340:\245\356"
+	.ascii	"2m&m3\3317\275J(\245\253l&\201\226\351M\272i3\351\341*\225<,"
+	.ascii	"S\241\344\322\t\245\304KgS\351\303U\336\344U\n\335@\225M\245"
+	.ascii	"\245\224\246\222\207\245SHi\251\204R\342\2336/\303\245\245P\311"
+	.ascii	"\026\327)Ts\3575J\257\2224\367\n%\335\244\016\r\343B=a\334\247"
+	.ascii	"\313oER\251{\357\275I\261\271\250f0\035\272oK!\315\024-\356\235"
+	.ascii	"\2730\026\220\344dz\357%\272CI\276\267E\232t\357PS\004\314&\307"
+	.ascii	"\021%\335\232\253\0242\032\212j\322\264\030j\022]!7Xi\351\214"
+	.ascii	"j\3520A\342\274\272Ci\222\227F\315{u\347\240\222Pg2\345-5N*\246"
+	.ascii	"Q\352\306CJ[[\271\266\"\223\304\312\022W\333[\030rD,`b\035\301"
+	.ascii	"q\332pM%'\2757\310D\271%%\201@\245uh\254n\336[\366\303R\013\002"
+	.ascii	"\244-\337\032\246\247\324\320H\241\253!\207\005m\267[\257\346"
+	.ascii	"\255\251BLmfR\376\226\322QBx\335\244\r\225&\244<\275{\235@\250"
+	.ascii	"]oUD\234\260Ey\022\2257\027#\006I\030 |m\327"
+	.string	"\016\205\246\231t\225\374$\007\243+\204\0071\216\322\332:I\235G\310\206\210\215\241d3gOcKm\3234\306*\252\257KZ\243am\325\265\265e\302i\243\275\317\322Fk3.\263Q\322\252q\202\241\303\316\332\312\265\344\351F\013\260\241Vr\306W\003\213\326\217\253\361\233\330\n@\224<\031\016Hk\331(=\\e\217\262g\030\363\365\027\327\325\275\251NX\347\320_\\9\260\334\325l\202\367B\211]\335{\301\032I\2275Y\213\365X'\341\264\303\332\371\366\021\326WW\263Q\246\035,\221\361\314\272\367\206u\017>\033\301L\306SoD\314Y\22240\036\354k\025\332iwqz\266\366\272-\3522DJ\333W(\364+\340\263\375^k\240Y}\204\337\230+\240%i\255\016\322X6\312\364*\231 \223\361\334j.N[\3536\275\327\031\224!Vt\367\263\357#\277\263FK\223\324\252m\027\321y\033q"
+	.ascii	"\225\224\221\266\265\363\320\026\322C8\315i\"\017*\323\353\f"
+	.ascii	"\312m\251!V\207\236s~7\234\363{\323\241\3578\364\r\207\276\333"
+	.ascii	"\320\277u\023\253\234\232=\271\241\254*\252\261>0\272\266o\252"
+	.ascii	"\277\247\232\007\227q\223\004/\250li\353\3412\210__\306\371\265"
+	.ascii	"\016\235\367\216\231\033VHhm\337\227\243\316*\375\250\341\206"
+	.ascii	"\203\317\200G\234D\211IE\261\223-\r\253mC\361\224\020\321\235"
+	.ascii	"\330\215\246\2237\246]\333\266!\346\374\335 2\032\322\366]\004"
+	.ascii	"uj\032]\203\323~z7\365\f\206s\222\300\204\001\326O,\326\364,"
+	.ascii	"\341\327\351\247\226\301o\300\250#\".\032\245\246,VPk\033\007"
+	.ascii	"\372vbj\034~oiW\214B\310\204\351H\313\2266\270I\231`H\365\r\035"
+	.ascii	"C\312\235\023\257m+\245EMdbm\337H\350Y\253\013\357\321!\361\302"
+	.ascii	"zZX\210L\341\274\276&\3427\246\207\253\\b\367,b>\326\263I~\270"
+	.ascii	"W\352\312\025\214Nj\2446\352\027}\304i\027\361\2273\030\016\003"
+	.ascii	"\326E\374\266\003\005\255\271\0213r\\|\274\331X\356\362:\r\206"
+	.ascii	"\226/p\3255Q\337n\361\001-Hy\275l\027\2346\221\030\0065|W\364"
+	.ascii	"\270~\366\357\026\315\202\346"
+	.ascii	"\354\005\r\242\266\255d'[\221\224\035\372\267\020\247=t-4\367"
+	.ascii	"jpC\004\004L\217\266\235|\235\213\344\213\242\266\347\362\240"
+	.ascii	"\305\201\311\221\266,\350Y.D]|\026\3516\251iw\305\326\326\036"
+	.ascii	"\365\323\n\357j\253\255\205q\246\022EjF[kt5 \233[\224\r\031\""
+	.ascii	"Kd\211\254\213\"\244<\275\033\035hCx\313[\027l6\347\354\022\354"
+	.ascii	"\263,,\213z7\345YS\345\245\211\031g\2236i\207\242\\\001o`J\342"
+	.ascii	"\263B\267CZd\366\240\274X\006\315\370\370j_\026)OvzF\325\b\363"
+	.ascii	"\332\247\305\266\210\353\021\246m\005S\355\302\2328\207\264\255"
+	.ascii	"_\372\013\2451\203\b\251\b\027.u\257\355\352\207w\253\274\364"
+	.ascii	"^\367\346\222<m\264\255]\252\335\315\321\025*-mk^\2272,Q[\266"
+	.ascii	"\324\273W\345}r\273\n\036m\021Mi\373 \f:\272z\307^\003\270\""
+	.ascii	"\343\231uc%\t\207\367|\275\273\032\022\253'J\273\264\266\"\030"
+	.ascii	"\325\256jySJ\366h[\353j\274\370\242.\037\232\245\235h\023\037"
+	.ascii	"=n\210\223\223\253W\330C:\204\305\307\363\211\326\322\322\334"
+	.ascii	"\353\225\232\"L\252\222\264\255Vng\363\246\224X\240\300\375p"
+	.ascii	"5\216\275.\022\207%\243\360\364\352\236\022\212\216\312k\334"
+	.ascii	"\213-*\035^\007\207\205e\225\363\002I\336P\017&\257jL\352\224"
+	.ascii	"*Gs\223^\027\th\266\006\345\246w\227\314\234\231\256\242.\270"
+	.ascii	"(\257S^\335F(\341uh\026\0219\241\266\265\355U\n\263\r\355\311"
+	.ascii	"V\245\004\301\341\304BB\037\002\352\305\244\244\324\266\256\275"
+	.ascii	"\256\205\324\031\335\265\255P\256F\303\264\242\247\343Iu\213"
+	.ascii	"\2422\324\266:\261A#\032c[\2425\355\265\311\037\f\242=\341\200"
+	.ascii	"j{\364\242%\221\243q\305\207\036\210\207\236\214\254\232\205"
+	.ascii	"hV+\3150yY\3672sb\364\372\250\344X\362jV\306W\303E\333\252\204"
+	.ascii	"\313\2346\242xi[\313n\207Tf\025\301\372\271!}\361\"6\226\326"
+	.ascii	"\261\306z\341\n)\345<\271V\362\364n\022\024\020*_\224\034M\262"
+	.ascii	"\302\302*R\210\037K\224\251\353nI\n\f\214\212\253~\211\241\244"
+	.ascii	"\255\311\313\253~\275p\357\035k\"\342\322\233\363\262\226\325"
+	.ascii	"\366\253L\206\252\253\305\215\266\007\262H\323\232u\345\005\021"
+	.ascii	"WV\020\215\305\226\016-\\\\5K\307\0343\347\007\266<*Z\253ZU\253"
+	.ascii	"\"\361\227\026\247\234\037\363\252\b\335\022#Fj\226]\331/\013"
+	.ascii	"\013\253f!\355x\315\372\021$\312\210\307\220:d\306\007r\300a"
+	.ascii	"\210\351\303G\rB\267\007\3445H\020\253\013\221\030m\353\017\376"
+	.ascii	"B\215\334@\262\324\266^\361\327\315\363G\332\345WDEU\255\354"
+	.ascii	"\\T\275Z\235\001q\330\302\"\345wu\350\250SE<\210\270\364v\274"
+	.ascii	"N\235\005\303\236G\222<q\244\025GS\275\220\336\244LT[L\\\263"
+	.ascii	"Y\243P\017w\350\312\334\025\324k\224\335Bs\332\322\266\336\350"
+	.ascii	"g\314\222H\023\022.\2639\004a\346@{z\252H}\005\f\233\362\362"
+	.ascii	"\214\341\232\361\031\325\211\231\267\3225\021qe\321xu\342\262"
+	.ascii	"\2726\203\bH\214\0253\255L.\353\364&\315\240\227\202\360\030"
+	.ascii	"'\364\257JiU\252L!\2327\206\210'WV\230 \320\220\261\335U\246"
+	.ascii	"\277\306\2507(m\200\354i]\265\255K:\2578\004w\230\271\320"
+	.string	"\241-\367\365\335k\237GG\025I\007\327\271pZ\221t\020\322#I\225\026-\252\021\220E]5:\013\276\305\360\321\243m}\241dB\241U\027p{4\244\252\213\272\004\301\333\016\312\206\262Z\232\2528iKt>\372\301\202MJ\275\365V\345L\025\036u\350U\311_5J\257\032Um\253\220M\231X\321X\333\232\344/\0329',j\3745\023\325\026\327v\266\267\327aP\340T_\207\351\035dP\232\264m/\375\345Gm/\207/|@,'\213\263%\r\337\323R\372\004\2565a0uu\341\264\273tTNz\2233CQ.\b\267X\350\033K\323\275\263<Ks\341\233\261)fR\316\337wo.x1V\356\226\230\360\266\3108\035\215\361\340-<'f\343\266\003I\336\016\347\271e\214\022\222\037N\332v]?\201Ek[9\236m\347bj\207\310\"\261\"\215\306\026\200\202@?\023\f{\2120\370"
+	.string	"\001+\340\003TK\004{\216F\r\030M\024}\210?\302 \022\304c\217\0063=Bc\f>@?\3440\b\210\f\032\036w\206A\302\3430\003\013R\004\255\370A\001\002\231\"\210X$\242\270"
+	.string	"9tA\210$\236\330"
+	.string	"9,a\203\360x\224"
+	.string	"\222xb\246H<\"\203H\f{V\374\360\024\211$\216A+H\\\360\363\263\242X4\026\201\310\235_\r\306c\n\244\261\bD!\034\376X\3440H\305P\305\357)D\3409\362\220(\032U\2500\362\204\030\"\205=@+v\220H\"\017\317\216\t:<G\036"
+	.string	"\2500<\032UP1D\006\331P\342\006Gh\374\221\031\372\340\f\217+\220<+\216\310\022\027\364\020\177\2044\004\021- \026\2112F\023A>E\"\022\t\002\311#\004Ra\344\251\351)\016?\f\221\304c\r4\303#\0219<\312\330\200<\022W\b\202\341\206\347\250\302\frX\342\303Q8\374\301Q!\234\241\b\003\317Q\005\017\303\023\020Kxx\n\021b0\001C\t\022\310\241\317Q\210\024!D\nW\220\221\031AQ\230\002\212,\016U\370\fK\024\205<A3A\031,0\303\005X`\241\247HD!s\036\"\372\005\230\020\202\t'\230"
+	.string	"8\334\031\366\030e\030\036W\374\020\205(jz\206G#\262\204\315p\247\005\034\344Q\210<\356\370"
+	.string	"\355\354\340 \213D\021=\303\242\0171\250\270\202\346hD\n\213D\025\307!R&h\347\003r\347\210\004\n\016\203\204'\354S\210p\034\252\020\016\217\310 \003\234`\344\316\b$\324\300\307!\n\024+N\374\220\302>\036\207\325\370S\\\201\"w|\2141\314 w\216\303\036\341\360\005\032T\300\031\236\330\341!\372\bU\240\310\247\020\301\007\210\204\017\020\016OqE\013\310a\320L\021E#\207A\303cL\320\216\rGd\020\321g8\203\017\020MP\320\360\330\323#\004\332"
+	.string	"d\344\261G$PE\356\364\034\215<\303\031l|\200\272g8\002\036!\320ox\002b\220E\356\024}\200b\212>@\265h$\006\035\207%"
+	.string	"\006\371\b\177P\304\274\203\033\201\206G\022H\243\361Hbf\004E\341\t\333S\034\326\037\2431\205\235\230\341\317\taOq\b\004$\224A\356\230\240\203\026\215D\244\3608,\016}d\220;' \213\304\025\300\353\350\250 \"\003\025p\001\345\021A\205\361\b4\034\356\370\020Q\024\215<$\212D\241\n\022<\307 \022\"p\020\305.\305\320\351p\344\307ZV\n;\030\341\200R\255\202sA\332^<\251A\232\030\351\301\324\326\246\331&\234^\315\252\331\270Y\221\233\333CM"
+	.ascii	"\274\332\357\267h]\005\210\033\031\223;\253\374\002\305\342L"
+	.ascii	"-x\205\244\304\211\231E\202\026eIjI\235\252`\370\276\304\224"
+	.ascii	"X1\033\027>\346\366\312\352^\0168*\036d\265\017\f\237\327V\022"
+	.ascii	"\033\026\304$\004m\314\016\005\241\262p\325\b\303\312\261\245"
+	.ascii	"m\255\253\301S\352\002b\301R-'+\027\013j\363#RE\304\244\277\254"
+	.ascii	"\213\240T\226\0200^Q\314\"\346\024\333e\223\330\326\236i\235"
+	.ascii	"\002\321\236\334\035\345\320\\*\226\254"
+	.string	"\0266\232\313n\2451Q\203j\257\032\345\314\205\217\266\326H]A_\2375\322V\313\036\2715\362\033\340\\\326R\350W\304\211\313\226\216\304e\325+}h\313\213\325a\230S\252<u\220 vH0)\351^\246\003\334\370\236V\310\355\220\267\232\037B;\354\336~\374\370\262v5\305\346-\207\276)\037M\345\367$\025\267\354\021\207V9\352a\307\203\207\255\222\231b\243\272\255\312\261\232Q\225%\303\004\335\261\243:\301"
+	.string	"\344\005)OOF\211\016\244\261\246\035Q9\270L\006\013>2\034FqC^\254TeR\246)e\264\2657,\324m\324mT\333\250\332\327\367\345^\241\033f\016\2309\370m\305\205\375\254\255akX\033h\262\312\321\325\323\255\r\0322\031BO\276\320\337:U\245\335\312\n\343\2634\252Y\023\247Y\332\3262Y&\333\204&i,\345\374\226y\333\364U\224l\336\265\2652\260b\304\260Kdp@\36020\272\022\273\341vi\346\t\030\222W\317U+JUG\216l\221-\262I8\302 \345\351\241\020\204E\250C\343#b\250M9\245\23035B\222$i\r\003\025@0@<(\036\322\227\351\003\023"
+	.string	"T\b\325\231\222\206\031\232\232!\005\005)\024\2261"
+	.ascii	"N\303\272Pv\315B\017:\027\261}<\r&ih,\245\004\037.\341\"\021"
+	.ascii	"YJ}\377,\272n\202K\240\347\323rW\266\024i\347\372\256\267\265"
+	.ascii	"\255B\314\254h\025\023\331\242\025vCg\f\240\341\350\244\265\344"
+	.ascii	"\262_\307\301\371\357\0203\037\230\265\225\212\230\360\335\f"
+	.ascii	"0\271\n\2225\"\263\200\031\265\024\257"
+	.string	"\"\323\177i\237\nNX\025\343\342\360\361\200tB\246\214{\237\242g}\360\363\031\024;\021\302)@\370\330a\033T\313p\200\221\033\271\305\367\020\215J\220\316\252(\215+D\006^R\316\311\254g\331\307\344\231N@,\200\351\277*H$\330\007\347\234\006\r\255\032\302\226\263\310\3701\304A\232\272y\215\332\305\340\320\205\315\006:\032\3636\306-5;!\227\004\330\264\2625S.\204\221\361;$\232\363\306\357\360\232\247!\320 LD\226\375^\313\b\235Zp\002eN8i\235m\331\363\202\277R\264m\350\031\222\242?R\304<ZXn\310\367%\017O\230_v\256\323\244B\310\024pj\321\222p\272\260^\345\344\256jb`\bL\221\204\324\230\247\307\325\377\307^`\341\034\362\237\250\353\360-\326\226\321\341f\013UA\t\300\2277\007\n\354Z\033f\3150\025P\343\222N.;\367S{L\"\332\266\255\211#\265"
+	.string	"\250\216\364\034\336V\023\257\327\323k~\244\306\027\217\276\031\351\023\035c\246\263\"\265\367\336!_\267\323m\211\312\016\275\344\333\237Ry+2\027\342\210\261\256^\031'%\270\363vw\360\031\003y*\321Aa\"\314)s\361*4F\350\020\246'd\205<\264\313\005\300a\235\263\302\236\b\364\304>\262\315\r\213\331\330\312\276L\254\346\006r\373\365M\332:G\272:\304Z\220\337"
+	.string	"n#\327\256\337\324jZ~\207\200\020"
+	.ascii	"\t\360\233\032\342=\013\n\312\273\345\336#\353\033\340\362i\357"
+	.ascii	"\024\rU\034`e4\301\242\303A\n%\376\030XT\271\377g5\337\277\025"
+	.ascii	"\221\013_YR\335q\327\177>dBn)u`\350OL\254~\217\267\266\307\036"
+	.ascii	"\n\313I\222K\303\371\352\266K\267\202&\222\2070\206\006\365\305"
+	.ascii	"\320\201\203\271\025\345\210\3222 $\215y\034\034s\021\351\306"
+	.ascii	"\262*\nv\260\322\317s\271\235\314/*\333\250\351\316\311\006\""
+	.ascii	"\220\320l\215\263\377?\362l*\026&\035\324t~\271v\212\373\202"
+	.ascii	"]\202%\355o\222\372*\0261kx-\337\2072\027\314\023G\272\363N\306"
+	.ascii	"@8\215m&\366\034\035\300e\366\004F\222nT\361\235\333rz\302\224"
+	.ascii	"z \021\366\315\316l\347\007j\243\362b\212rc2Z\254\221\t\253\226"
+	.ascii	"\003\232\200\325\205\331\220*\032Z|Nz\212\3178\334\366\305*\326"
+	.ascii	"N\335\237P\306\251d\311\340\325\260n\342\275uf<\301\031cs\276"
+	.ascii	"\225\030J\330&S\360\021aUh&\316L\021\300\345Q4\233\374\022\007"
+	.ascii	"]\313S~\354\356\033W\320\317\351i\246\"[\353\324\n*}\241-#\332"
+	.ascii	"_\202\3206d\265\261\361\036\274\351\\_\242\242\356|\207p0OP?"
+	.ascii	"\200\371z\364\234j1\335\030p)\251\206\317\214\321\277m\221\024"
+	.ascii	"?\002\202\001\335\331J)\261\353\332\220\330\200\362\311x\301"
+	.ascii	"\023\2232\026\321`\021\221\2002QE\262\216\312\303\0269\371vp"
+	.ascii	"\027\210xIK|\203\201\246\254k\324\005\212\275\217*\373\305\372"
+	.ascii	"cnN\260\366\377\363\3102N\215,\270\226|_\246\204\2437\365\202"
+	.ascii	"W\342\346\231\017\031\202\240^\332B\266B\223\343/h\024\302!\032"
+	.ascii	"b\340\223?\244\261\r\302H\271I\235\274y9\331=\347)\345O\316\347"
+	.ascii	"Z\020\31741\006-~\371fx\275\265\325=9\024='\323\025\244K\307"
+	.ascii	"\345$\026\202\333\032\003'#\340\nc\256\027\344\313\"\203+U \313"
+	.ascii	"i1]\016\231&j\326\243\013\375\374\363\374\211\\\322`W\"A\247"
+	.ascii	"R\2507 \347\336Or\b\311\016\335IE]\356\215g\334\322U\326\213"
+	.ascii	"\213\360.\272h\021\222fE\243\020\345\260\"\306\266+>\204\345"
+	.ascii	"iZ\251X}:(v\006\306\021\265\367[\212\235\3013\334\277\262RPt"
+	.ascii	"\307\303\246\026m\275s\227vd=\nSf\336\310\r,\353\247\240FX\372"
+	.ascii	"r\225\241\201f\350\212`\334\350*\223\223M\035\267\263,\001\217"
+	.ascii	"\361\221V\"B\257\016dh)\2209\260:\365\315\307\350\314L\371\357"
+	.ascii	"|\274\277\230\n\343\3433\be\016]P\260\365\031\204(\213\201+\262"
+	.ascii	"\267\372\023\351\223@\016\021\255\331\360\364'\013u\020n\241"
+	.ascii	"\303\304\303\303F\254\350\026\305n\362\353<39\r\304\220 }\032"
+	.ascii	"N\314\335Q\326\212\004\254\003\356\264\251\002B\300\367\333\301"
+	.ascii	"Y\214\006\277\2319\fr-j\234\305Q\213\356\343\223\013\305FU A"
+	.ascii	"h\321\307\236\002\250\273\310S9\027/\177jh\200y3\217\301G\306"
+	.ascii	"\003`L\242\r\362\333<T\\5-g)\307\335\204.ruK\240\365\246\246"
+	.ascii	"\363\213>b\227p\3271|\205\236\004S\304\252bE\213\210\261\362"
+	.ascii	"%s\345\372\242\r\212NW\264o\305\276M/\212Hb/\322Kt\324\203\327"
+	.ascii	"N\262\273\370[!\250Wdq\235\212\305\266\024\277\n\277\234\305"
+	.ascii	"\302\310je\200\202\002\203\344%\342/\f\205\372\323u\311p_\035"
+	.ascii	"/8\200\013vUJ\353[4U$\n\b\315\203\037v\200\246P\2741\203\023"
+	.ascii	"\222C\030*\001\t\223\343u\2057\205v\322C\\\343\270Mz\030\027"
+	.ascii	"\274\227\325Z\303\340r\226\023\023\n\222\353\240\330\331\nX\001"
+	.ascii	"E;\025\2267Z\204\036\341l\367\003\356\350\035W\002e\276\223\210"
+	.ascii	"\232i\272\252\367bK\342\361\353\343E\315\217\240(\263B\2543\240"
+	.ascii	"\233=\256\31367\254qE\342\207K\373y7\246\344i\233\306\240&\300"
+	.ascii	"q'\nT2\252\247Y\326(\226\250f\343\371+\353\021\310\273\213\213"
+	.ascii	"!\265*F\305\227\300\316\022\300\261\317*\224$p@\343A\363\257"
+	.ascii	"\222#J!\371d\201\247\2234$\307\254\216O\367\355\374\233\322\232"
+	.ascii	"O\361v\n\306\315\302]!m\301g\233\317Cz\364\nF\375-g1\376\211"
+	.ascii	"\221)\177\375\371\375\262\247#\335\371\230[\035\375\035\336\313"
+	.ascii	"\372\203\223\354\364\350\340\254\2631\326-\262oj\356\242\235"
+	.ascii	"\247\260\237\306"
+	.ascii	"\317\024\337U\312\024l^\222oU\373T\342Q\332\335\376\314\344\374"
+	.ascii	"7\215\333I\271\310n\321?\303\246\007\216:\017\252\247\354\337"
+	.ascii	"&\335<\301\333\264\267\261\":\207\355\217\017\3743{\304~\\N\217"
+	.ascii	"\267\317\262\035\306\321\037\223|O\324\301\022\027\307\256\363"
+	.ascii	"\327\334\336\271\354\277\347\255\333e\211\243\344gz\277\005,"
+	.ascii	"\024\354\214m\260\232\317\016t\035z\327h\237\b\034\245\334\364"
+	.ascii	"\375\351\353\311\217\231\360\225\262\277\202m\264\177\245-U\373"
+	.ascii	"\240\375E\377P\364\307Pr\242\357`\226\2055\271\3039+\202\237"
+	.ascii	"\265\227\321>\241\371\t\371 r\377\250y\317\3718;\021\177\327"
+	.ascii	"\037\210\2021\025w\207[\001\256\324~\310\267{\200\377`\335\\"
+	.ascii	"&\370\306m\244.\347\356\220\177J4\205`>\353\203\377=n\017\310"
+	.ascii	"1\017\207\207\334\0236\350\367C\031\303\355\217o\335\033\237"
+	.ascii	"*;u\365\205\275\226_\335\312m\272\006\013\337/\020\307\226\333"
+	.ascii	"o\335\001|\272\365f\016\227\003|+L\317K\274\023\342\243z\237"
+	.ascii	"\177\330\370\330\270\235\352\236T\337\t\271\213\354\034\334K"
+	.ascii	"`\207f\0031\327\374\377 g\001\363[B\347\267\241Q\274\257\247"
+	.ascii	"\227\375\245\354\273\370\023D\006\353<\202v\346\241\034x\265"
+	.ascii	"\023\001o\345\032\353\213\304\377\244\006\341\313\2703rg\035"
+	.ascii	"\271'\266\372\\ZV\300\031t]\302\013\255\237\373g?\310\375\356"
+	.ascii	"\325\306go\343\325\252}\373\377\335\227~\024]>\217P\226\354\232"
+	.ascii	"\270\327~&\224\315\360\007\355\213]l}\324\317J\006l6\316\266"
+	.ascii	"\2633\264\367\333\032\2710:1\274\305y\2123\263&\367\331\004\272"
+	.ascii	"2\2336t\001"
+	.text
+	.section	.gnu.lto_.symtab.567dc7b3f7fd65c8,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"config_streamer_erase_rest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.567dc7b3f7fd65c8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
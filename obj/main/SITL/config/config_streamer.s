@@ -0,0 +1,522 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375 \342u\004"
+	.string	"D\006\326"
+	.string	"\013"
+	.string	"\253\332\330\232\013"
+	.string	"\001\255\245\304\212\017\006\002"
+	.string	"\002\001\230\217\331\337\003\004\002\002\003\206\360\244\357\013"
+	.string	"\004\304\250\326\314\006\f\003\002\002\001\005\222\351\256\307\004\020\004\002\004\002\005\002\001\002\006\210\251\332\260\016\002\007\355\300\261\313\n\n\b\227\313\327\302\n\002\002\002\001\t\200\331\354\210\003\006\n\240\342\234\212\n"
+	.string	"\021"
+	.ascii	"\002\303\370\2620\207\271o\030*)\004.al\006\003{A3 \300%\340"
+	.ascii	"./(\033 U\224\314\301\357J\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375 \275\r\003"
+	.string	"\362\004\r\023\260%\351\f\303m\222$If\271\301F6!mo\231RNt\256\307\b\252\205N\260\017\021\207\362<,\037\035\225I'\3006v\351\304\266\271}VW0\020\022"
+	.ascii	",I\200\315Q\003\016k\332\013\257\246y\204\013\300E\b2\324\243"
+	.ascii	"\004v\324p\214\232\313y\333\322Fs\003X\242\262\016\f\260"
+	.text
+	.section	.gnu.lto_.inline.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\023\003=\020"
+	.string	"\366XQ> o\223t31\220\311)\232\265\\2\331@\346\240\003\373\263\3348\032\206\f\223\244d7A\3705\204\240\204\363\212\017\253>\370\202\\"
+	.string	"\350@@"
+	.string	"4\244\236d\341\312V\266\021jv\023\271S;"
+	.string	"@"
+	.string	"@"
+	.string	"h\302\004`+f\n\b\022,6"
+	.string	"\356\325uu\365\247\362\274\035\350\"\304\302\211{\213\235\200FB.\237\035\025\307\020\232\b\035j\274\272\360\237Xo\364V\366\321\243\357\275\347\276r\266\027\2730\223\367^\233\245Kw\272\016\220<-\247\325\n$\232\007\355\246\345&GGT\224\220\200ol\365\363\336\243\334\215\005\357=\006\337n\"\210\032\3205s{\201\037\321\256\026\316\306\217\310\025\363\001T~\201\023\237\276tB\250\343\241\367zt\343q!B=\202v\240\220b\205\006+V\212\355\230\240\r>\200ZhL\271\202I"
+	.string	"\004w\316@%\222\212\337\307F\005\221T\314\345p<!\323\371\370U#n@\251\231^\340x2HKX]\023\303\300\270Sw\356R\023\241\216\b\351\017\260\016\206\023\034(\351\261\233\205\215\330\224\240\310\330aue\023\304\316"
+	.string	"\034\375\270\037o\237\314\314\001\211\006B\306--v4\240$S\250\001=\252\020\211\210\210\342\250RlP\24213\267\007\022\300\224-\312\211(\272\231E\366\317\006\016\276\270\034\0375\022\310F\376\354\243\200\200\025\217{\013\263O\316@`'\304\036\177\246\004\035\266\"\317F\346hw\2211\232\231\237T0\301\375A\022|Dk\305Z\002\306\235\244\307&\342\202\270\234\2019(\356\2561\375\226\232\271\375;\337\231/;\324\254\336\177_k\367\276Z\r\374\317\255\006+\035l_\333\"%\013\027]B\237\261\222!\212\\\366Yx\0077\037\205\032\241;\026\034\354.\323y\264\313\367\230\240\026\021"
+	.ascii	"w\337\026\250#\253\3348?vhm`\234@\314\031\006\223\355L\013\350"
+	.ascii	"\212\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\365\004"
+	.string	"\342H\027\035\260%\205\016,h\241\003\216\017\303,P\"1\f'\212\242V\360i\2445\262\333\3362\311\333\354<aK"
+	.string	"p\260\300\364\222\232W\3667P|v\276\230\233\257\225\004+\330bg\021\377\320q\274\244\270}\230\257T\317\234\241\224R\276D\006\237-<\337JB6!o+\2618\177\306\016\b\031"
+	.string	"A\267\200\306\3204\nP\031\271(\254\001\016\220\352\364f\003\240(\356\302$|\346.h\227\2468J\021\003\270\b\326\307\306\212!h \225\206% "
+	.ascii	"s\237\n|f1\312\363\274\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\001\232\004\002\231\004\003\230\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\232\004\t\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"E\006"
+	.string	"2H\032#\2205I\007\240n\377\356\023\326\302U\212s\247U\377\253\212\325\202\035\330\234\366s\265\265\204l\322\b\2212\005\023\n\207\301\361+u\026\252\242\204\260/\341\335iD\277\022\025\244\267\305\366\005\030\022sL\205\312j-\262y\277\222\231\224\312T\371a\230s\026\013C(\0324\377Z\004\270\266\267\333s\216\312\005eR\036\030=\023\001* \220\242\021\303\036o@\367p\346x\322`{\300\367\002.\305\277\"\370"
+	.string	"^\025$\256\326\btp\355.\224(,"
+	.ascii	"a\031@\351\211d`\333\340vy+\222\320,\322\203\321\002\256\337"
+	.ascii	"\0376$\013\026W(\371\227\231\266L1:\304\253&\n\346\310\356h\213"
+	.ascii	"\300\312hy6\324x(E"
+	.text
+	.section	.gnu.lto_.lto.8c055744016d3d35,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.4.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230NL7\\cB\2528\033o\027\223?\345\214XKc\316B\2358\3406\322\216\267\203\210\265\216Rv\361s\030\364S\343\237p\276y\353F\266L)\226ku\262\013\344\271\262\221\310\001\342\363\020\302\254\030\372x@\321\312D\261cP,\342\312\342\b\303\262\310\361\356\351\260k\203\307W\001-:\345\201\333R!8a+1\221\346\232)\034\337\005\334ZoK\370\321z\372\377\302\256u\311\316\251\352x!P\3715fd\376Q,\"\234\266\316\326$.\321\\\242p\300\337\271\254\374^B\0256\246\352y\2402\265\261@e\252Z\013c/\344>\311\300@\211\371\037!\2105\247V\333\304"
+	.string	"\034isj\030\37679\322\206\013\335\266\240\355B\333\221\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.5.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\242\001\315\016"
+	.string	"V\032`F"
+	.string	"\221(\035\020A?2\301\002E\240\337G\b\0138\260v\206\2676\355\303\3742\3435@73\267 \243\246\033\212)\376\021\201\221\314UM\3336\300\377wehk\f\302=\344\255\277\321LY7\213 \262\267\334)\005I"
+	.string	"I"
+	.string	"O"
+	.string	"\332\247\303\203d\237\332\005d\237\006m\032\017S\373U\207\r\254\330\356nJ\342\340\245F\320?\353"
+	.string	"J'\321\345\207\253D \343\262\3019\221$H\212\211\322Y\217\246\323(F\016\b\273\353X:y\270\347mG\260\375\300\216\037\001V\224}\227_{\370\317\253~)\243\357\321@D\254\306\200\033\273)76\013\2331'l\237c[W|\005\336\305/\031`I#L\255\335\r\261\003\355\263\200\214\241\211\315\202G\373,o\001\257:\371\307.JFk7\f\261\202\035,T\300F*z\252F\246\245\016e\327\221\325\fR\254\261\r:\214\220vU\02404*M\355\356/~\301\244\270\360\027\352z\241\231j\177wa\242\355.\003\277E\006\f\232*q\222}\036\340"
+	.string	"Si\t\201\022o\354P\024u\305\276\334\335\r\234\206\317'\271\2573\"=\267G\304\343@\035\316+\371$P\370L \351<\033\311\247\003\332<\336\267\211\030pg\201\363\266\222\256\3636N\270\007\001C\321\221\023\334\346\376\362K\t\230P*,3RW\036\312bB\036\323\025#6\323\021\355O\205\370\222\003% \260\002\021\261;\007\252\247\023,\252a$\031\326\222Be\213\f\242\374\271\3214F5\3407\373@\257U"
+	.string	"\017\342f\242\031\273\261\366uH\303h\235?\256\030\007\224p\013\353\0357\211\204\205\356\200"
+	.string	"F'\306\256(\307\275\320\313\030\021"
+	.ascii	"\243\210\227g\232\234\242\255="
+	.text
+	.section	.gnu.lto_erase_page.6.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\305\013"
+	.string	"\326\026SB o\233\016\304E$\\\200BEP<O\227C\353\352\237\314\005p@\f\006."
+	.string	"u\023\362\276\300j\352\223CPR\243\216\343\206\330\032\b\005\324\354O\200\013\240>\005\267xY\352\230\307l\333[\356\224\002A"
+	.string	"="
+	.string	"@"
+	.string	"\025\016\023\034%Pv\227\302\274\300t\031O`\272\324\220o\217\n7_\364\b\201\344b\324y\\c\003\023\217\021\002:.\336C\213\357\337aG\267\001ae\263\273\206\243.\303-o\373\201m\007\366\025\0040\366D\242"
+	.string	"\361\322o\337\366\346\177\276\370%\r\f7\267\013\221HDPvg\346\322\f,\207\366I'\261}V\370\200]o\204dw&\360\002\313\245\247\305\266/\342\"\233]\022\347\207.\n\022\340\303D\203\252\347x\215I\252\001\016!>\026\034|\341\t\252\332\031\024\340GR\377\375\336\211\222\023NE\366\024A\005\261\037W=\373\245[~\376\252\320\237\016\250\370\330\0202\242+\346bH\tY\206Vi\331\224e\026\326\351T\025s4\230\365\251,L\313\"L\360H"
+	.string	"]\034\n\344\251>\024\007\313(\r\002_!\013\243\264\353\302\250\313\334\253\347P\312\005\230\371\277\003\350\020#\205j~\355Po,\350F\f\017"
+	.ascii	"\252\322%\301\342N\247\375,\024$\354\330\252\rq\253\2700\032"
+	.ascii	"\333\354\006\205\022>u\0314\021I\t(U\r4\227\202\002"
+	.text
+	.section	.gnu.lto_write_word.7.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\224\001\275\017"
+	.string	"V\036jF\360\260(\035\362\367E\323j\336o\221\274\243;\3005\"$}\227L\262V \306u\265\304hp\372\245\225\033_\201-4\332\267y]\247\241O\013\335D6\276\n\346\230"
+	.string	"\r\217O\3551c-\006m\237\354-eJ\001Y"
+	.string	"O"
+	.string	"X"
+	.ascii	"\320\233\351>\261\0321\233\031\273\313y\274c{\204\037\260=\352"
+	.ascii	"\206\267\276E\250\331\362\001t\256o \013\217\360\203\003\013"
+	.ascii	"\235\006\027\\D\335J\302Q7\001z\354\256\250\203\245B\003/)ZF"
+	.ascii	"\335\013v\344\304\300\370\367d\351V2? \273\353\224u\025\356\317"
+	.ascii	"m\213\330f`_'\207\2533"
+	.string	"\3735?\307\275?\244\351M\323Q\323\020\246\025\246S\323\037\t\240\345|\264\330\245P\263\261*\342\211\017\266[\266\310v\346k$8\264\253\201G\301\323>\315G\264\356\245<\300\356\f\005m\327C\340\004\240G{ \333~\210\213h\3318\001\251\366\003T^\026\365\0302\300\324\365\317\364\304\240\301\2536\325\220\317\305\247v\325\226\252\232+b./\247~\243J\325\031\t\020iBF\016\214\252\214\017\374\032\362\355\300\262\3076\353%\214\263\300\267)A\001\355\356;\244l\217\327\177'\020s\203\006\215J\326l\317\225*c\007'\224\222R\204h\272M\244\325\tU:\255NX\016FHDLR&\316\204\244\204\342L+\026G*\340\024\204\323\212;I\245V\234\310\333\303\b\3650\335\013$\375\337C\263\032O^7e\261\275\251AT\364\265\215\222CCj\237F\3622\250Q]\264\226\02771jz\370vD\031\037"
+	.ascii	"\252\322\231\301\"\fS\313\006\022\267\025\254\320\002\340g0\005"
+	.ascii	"U\025\027\002\252\020\013\"\236\"\324\033\201\036\302\027&\024"
+	.ascii	"\217\213\320\n\232a\302uML\250\305\016[\220I\310\022\214\020"
+	.ascii	"\250ppw\2226\b\205\320F\230C3x\357*P"
+	.text
+	.section	.gnu.lto_config_streamer_write.8.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`%\003=\027"
+	.string	"\246*\225I\260XQ:\320\005\300\334\241\365\003\020Z\200$4<h\033\013\231\206o\f|\222\332\207\256s\316~\220\226\265\377\246\247\004\005\326\227f\223b\367\260<\340?<?8c\005f;\"\016I\232Q-B\332`\312\b!{K\231d\177"
+	.string	"{"
+	.string	"\202"
+	.string	"&>\240\326\033\221\221Z\313\007\033A<\335R|\217\373\200\355\366f\231#O\243\206M\227TkM\305\034\005\236\316\027"
+	.string	"O{\006\214g\371\005\031\366\020\244\263\031\266\327}\362\030b4\222;\017gH\353\271a\"m\223\306w$t\336\231\207\2241\030 G\213S\026\2373\002-\351\205\211\244M\001>[Q\211\234q\237\367\006AF#\331\342\034^\250\265.\217\244\212\257\370\335\355\331]\013\273\235!W~b\374\353\335\022\032\331\215\333-w\230&\347;\332\276\355\242&\357\351\345oz\220\277\345@\376\322w_Q\344\rC^p\362R\220wR\336\236\274<y\377B\300\367\004C\223Z{~X\252\023*\204\343\273\357^\310\236\267\323y\255\245"
+	.string	"\200\202\206\215\243ZK\231\323\255 \236~\027\266[\332\335\346\007\0311]\352L\306\013\n\fD\347\200K\235\001\235\220p\336\375\317\177\300^\006'\2062\"\031\340\331\246\336\335\300\201?\322\216\241\365\316\356v\370\222\0210J\030D\231M\213\206v\354\020\f\035\267\331\270\235\337\036\310\215"
+	.string	"\367\003H\312\214}\333\275\273%\216\304\303K\256\326J\263\253\272\320\n\225c\375H\210\323\226\2662\"\305^\304\246%\356uz\352x\\p\023\201\311}Dr\3607w\367j1d\374\333]\021\037\262=\261\326:a\037\364\241F\264q\2727\001\236\276\317\373\202\"%\0019\252\233f\221h\341\314\233\257\276\253\231\027\253F\305z\345\340x\b\321\002a\343Z\245lZ\252\232\324\352\205\223\232Q\260\256\033\326+\225\343r\275R\245\262\276o\247\216\211\265l\211N}\335\023$!\332\361\023\343_\330\270\2050RT\207.\270\324b\363\210\0356\363"
+	.ascii	"\232\002v\251\303~\315\247\245\301\006\251\330\262\304\370\367"
+	.ascii	"Yk\255 \204\213\215j0E\220Q\315G\306?^Ae>D}\206\222\252\320\336"
+	.ascii	"\325p&\333\023\003? p\202\021B\353\001\n\323\205\206\001\365"
+	.ascii	"p\262\026\364zY\213\376\351\322U\267q\275\355\344\311\022V\210"
+	.ascii	"\267\265\307\207C\020\354)`\210\177'\326Y\013\267\253\352\223"
+	.ascii	"\213]S.f\300x\332\231\f\273V\021(\024\032Ku\221\347\034\322\230"
+	.ascii	"\320\177\017\3535\212\3434\236I\264\002!\3478\222\003>\366\324"
+	.ascii	"\2555\260\345\224[\274C\326\314\230\355\272\005\235z\317\214"
+	.ascii	";\360\264\214%6Bp\370w\311\035\330d=\341\201\201\013\221B\262"
+	.ascii	"\322\336(\275\235\366\221\001"
+	.text
+	.section	.gnu.lto_config_streamer_status.9.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\r\b"
+	.string	"\322\217770\217\222\016$\036\024Bb\020\211W\026\276\354\037\353\206Z;\027V$}\367n\321\376\375\364w\275\036\250h\235\206\001\243,@v\257\1777\002\316E\001*\373\255\021\"S[\3378\235\007\324\361t#\021\203\303\247!\304mZ\350\323\001i['\3228\004s\017\236N\033q\\\247e\276\354\307\2701\305\211\037\242#\263\262\314L\270\"\022\021\031G\261K\212\001*\023l\375W\202\021\343{eL=\204\307~-\2744\027-\013%\231\025\255\227d\301T:~\3573\177\341W\325\225\327\217T\201\314\324\nJ\346g\360AV\354/\373\357GA\274g]\237\006\252\033+\n\022\227\314\3246\035\300\024\273\252\301\024\213\031\365\n\275\333\220^\036&''T\251\020@!3\207'\224E\217\375\013~\204?%\f"
+	.ascii	"\252\244\223i\021\206\315D`\231\005\324\230\320]\303\321\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.10.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\330\001e\020"
+	.string	"V\336iF\360\260(\035z\326 *>o\177i\357\037\341\313\352\350i\212\324T\303\271\277\3664\232aL\177\252\350_\246\373\231\342\242r\331\335\206\177\332;c\260\203\331\302\255PBH\0210\322`\356+/L4\371do)S\nU"
+	.string	"Q"
+	.string	"W"
+	.string	"a\001\033\340.\035r\266}\023?a\262g1l\251\356\001\346\362\312\231sv\241\203\266\313\370\220\355r;\334\364\270j\362\037\363X\"\006\003T\235\0367|#\201\233\0268"
+	.ascii	"\250Z\"\350\005\004\370\230k\006\025J\265\223`\316i\005U\032"
+	.ascii	"ny\333\nl\037\260\225A\b|\231\t\026\270\017\227\376\312v\371"
+	.ascii	"\335\325\f\030\027\213\326\354\360\244\313\262\037\347\256lU"
+	.ascii	"{\036"
+	.string	"\376\036\252\356l\352M\252eT\307U\357\252U\325\017\020BB\306\002\033s\276\324t\314\030r&\204m\223\375\241\366]Gaz\270r\001s\256^\310\346\f\"\333\312\225\r\214\313\243\273#\227k{\"=\350PjO+\367\261\324\b\324Y\\\370\264@\373\344+F\003j(\\\005\351\362S\023W_ \007\335x\273\330v\037K\211@i\315_\335\323`5\227\035o\321nd\273,\217\374\033A\206F\213\322l\177O\341\0317\347\f\336\355\221\224D$\023QI%\245\344d$\001\345\363:\224\221\t\251\363J)\035\211\210\277\n\242R\247\362}\245\356#\234\217sW\236\r\261,\3124\236]\232\0329\342\262f\026\307&\007\247\263v\203\313<\343@Z\372\002o|t[\217\265\035<\320\203\235\ra\330\223m\b\217\225\200Z\260( @\002B\214\243v\212\323\311L\377c\230+\263n\353\206\211.g\2213\202"
+	.string	"\313\202\213|}h\230c\300\206\215\235\220X\037}\001\353yX9m\244`\217\203\233\034\032\021q\260"
+	.ascii	"\022\005!\037\026m8\314\313(k$\347\243\264\371\364/ab\344\256"
+	.ascii	"m\243b9\030s\333\215T\201\326\233\246\024\024\n"
+	.text
+	.section	.gnu.lto_config_streamer_erase_rest.11.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\206\002\225\023"
+	.string	"\306\343~I\320\322(\035\326 \030\002\t\f\307Y%\277\265\f |\361\365\241\232\023\030v\210\3529\225;pD\0215\254\013\035\333\361\224G>>\002e\232:\034F\2515\203\3309\227\007K\344G\314l\226\215\235U/\337\b\331D\312\224\002h"
+	.string	"e"
+	.string	"k"
+	.string	"\2509mB-\346\034\0218\001\351\322#\351%n\002f\367\3001\247\366[\215\331\316\307\2343E\362\221\360\022\274Hx\271\037\f*\354\241\004Wa>\n\013 Z-\346a\251\026S\tn\216\007$\240&\003\031\234\320\271}w\245\251eP\220D\315\367\273\037\360\371\321j5W\321\301\234\323J\253q\270\305\333\266`\273\201\255\274+\352\210~\340d\364g\2171\2728\366On\310"
+	.string	"\341\265\331R\215\n9\231\256\273K\037\377"
+	.string	"\317\335\242T\207R-A5\b\252W\252\025T\177\200H\221\215\007\27495\374\200\314 \371b\304s\277\016\346\363|\347\222\016\003\315\315\207\222{}\3126"
+	.ascii	"\230\371r\360\230s,\271\364\002\322\245\332\307\035\005\354#"
+	.ascii	"\314\003\327\361\371\311n\344\332\253\273p\357\224\263\243\365"
+	.ascii	"0\251\2706\213\202\236&w\244\303P\320\314\306\354\252\260\261"
+	.ascii	"\305X_\230\177\205\246=\255\002\237\0353\017\342\357\257\020"
+	.ascii	"\\\323\376Hv\023[\371\212\027\270\222\250h\007\267\373-\255\352"
+	.ascii	"\220\335\304\364g\335\335\317\202\264\336\343\236\256\201\233"
+	.ascii	"+<\305\2134\347<\361y\023\\H\".}\230\360\362\001\021XV\273RI"
+	.ascii	"i\001U\267\312\304\265ZIY\271^\\ \250\260$\260\264T)\026V\312"
+	.ascii	"JJ\345rI\231\024p\253e\345J\275\264Z\256Ti\234_\033jId6\006\303"
+	.ascii	"=\324\356\317\321N\210pq\\\362\3207\243F\376\t\227\200Oq\b\345"
+	.ascii	"z\344\342X\207l\202l\310\262lh\350i\305\245\261\355\322\212{"
+	.ascii	"\034\317\214\0315:8\347\234 I\334\220\r2 \200\002\021\273\343"
+	.ascii	"\001\n\351b\303\353\321]e\2400<\326+\202\261\326\206tS\033\213"
+	.ascii	"\231rc\031\303\002\321\006\364\204wC\035\354I\332\306'hl#\030"
+	.ascii	"\217Q\354\0325\031\352\367\"\300n2-+\016\232\300\023L\263\006"
+	.ascii	"\312h\213\013\300\004\260\333\262\001\366\0264\262\\\303\337"
+	.ascii	"99\342\b\f\250\005\r\357.\265\003\237X\017\301OP\340\227g|)w"
+	.ascii	"\256\367\004"
+	.text
+	.section	.gnu.lto_config_streamer_finish.12.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\355\013"
+	.string	"F\326P? O\225\016\210\262\026\241"
+	.string	""
+	.string	"\253\031\266\n\214\335\320\034\304@L\232v<\007\320\006\221\b\213\3437\214\251\370\006\272d\263\3743T\t\240"
+	.string	"\"0Qf\361\004<\320\235\360$7\t!{\357\235R="
+	.string	"<"
+	.string	"?"
+	.string	"\273\034\344\217\354\225^@\366:E\007O\247\004\375\237NC\260\210\205\342\346T\303'5\320J\021\003\200\350\241\217\217\207\360\247K\fbGJm\301\356Z\206b\206\273\3366\003\333\t\354w\001?\225\322\337\016b]/\032\310\330\375\304`\313\252*>\330\006m\207\355K\373\246\223"
+	.string	"?j\036`\027\324B\265;\0360\202\355\325\343f\333\027\361\022h\257\3508\022\337a\306\205\224k\003\2415Vl`u\346\346\243WK5g\310\317d\237\017P.<\362e\233\302Kd\266\335U\340\243*X\330H\257\276&{\375\034 \202q\030a\342\310\230=n\344\f\331\247;A\366\224\326>\006\335\335E\276IE2\3710\027\007\021(\020,^\307Y(\222\n\327}\027.R\300\236\204\311\307a<\357\343\034\343\336\326&\2043;\266+G\341\2256\t\220Jt\206R?\2611\252+\023.\030\233\264'\\\344\003\025"
+	.string	"\252\244\223i\021\206\301Z"
+	.ascii	"\026\346\275\210\241cB4\b\242\n\203\251H\275\013[Kh\\\\\034>"
+	.ascii	"\023\206k\242\217\026\244(\023\004\234\210\244\032\264J\244)"
+	.ascii	"\205\202\002"
+	.text
+	.section	.gnu.lto_write_word.part.0.18.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\255\021"
+	.string	"\006!tG\320\224M:2\240|\251\313` \263\037\377\245\356\354\213\207p:\250G\360\351[\370\"e\210\035\21429G\261\001\2239\3546\306->z\323\t\203Z4\203 \"\323\331\201&L\324\253G\001E\3154!{o)S\n]"
+	.string	"b"
+	.string	"Y"
+	.string	"\334\243?\316>Q\r\217m\037\306c\270l&\370\r\3016\035$:\262\"s\316\3561\345\006\344#<\001\371\270,\356z\204\253\322\345\353\013f\363\350`V\203\022f=^0\022_\b\241\311\207("
+	.string	",\007>\310\t\351\264\353\016\fGu\300\345\3062\3474W\342\336n\233\202\355\b\266N\b\326\037\375?)\220"
+	.ascii	"\305\234\"jO3E\314\341\342\263\333\237Q\343\323lb\3733%\031\247"
+	.ascii	"\344(\311p6<\\\215\020'\204\314\371\251<\372\001\347\262M\274"
+	.ascii	"z\331\223f\3407a\253O\232q\311\234@A\030\250\376\250\346F4(\337"
+	.ascii	"\034\301cU\3732\376\271nDs\001s\306v\334\230\363S\360\350\005"
+	.ascii	"\001P\217V<)\315\005\362\036\300O\223\211]!\303\313H\270(1'$"
+	.ascii	" 9z\304'\272\253k\267d\320\277\340\246|X\033\333.\247\341qs\316"
+	.ascii	"\006\376R\007\030\277\305\243O#\037uO;\002\237%#E7Z\323\025\362"
+	.ascii	"\312\303\2711[\252\267\250\226Q\035?\273\341e\377F\r\254\230"
+	.ascii	"\026\252\305\222\252\030\r(\0161u\247VV*\027\224j\325bU\300\320"
+	.ascii	"r\341\305Ku/-(\227.\265bu+\007\354mP\255\272\226\347\255:\223"
+	.ascii	"o\3140=I\240\312O{\211\212\236\242\365p3\311mwlok\226\233\305"
+	.ascii	"\361F\271:\274\035\372k\b\274y\310\270rU\006\342\007Gk8\342Z"
+	.ascii	"\260\361b\211\370\b\372\021* `\002\031c\353\001*\351\030Y\340"
+	.ascii	"\367\361e\347~<|\231E\340d\230\262]\270iH\317\310\022\335aqj"
+	.ascii	"\305\23622+sD\225lw[\021\362\r\230\271\026\253\006\022\361an"
+	.ascii	"\366/\275\013\233\374\300\372\371N7\037${'K\373\355\006\026\362"
+	.ascii	"=4Yuv\037\035\3309\250\t\3156\367\2040\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\225\007"
+	.string	"\342\312)0`M\323\001\200\316\223\273\0064\357\370[\330F\030t\245\buS\306\r\263A "
+	.string	"\300\006\206"
+	.string	"B\267\300K\t\"\021\021Z\322F\215\2264\271e\n\206P\3056-\223\234\345\260.\0177\373&\034\263*\002\031\203X\025\227[V5\"\005\356>\251.\223\030\331P\267\232\241\212mZf\267\017\220.\303\343M8\205\360\350\340\320\340\222\306\031m\205\222\202Oj[#0\bv\0318\324\020\362A!\360'\340\023\200;\016\330\246Uo\250/N\316\213\351\312\223\316,D\257^\224rZ\330\267;\246*1\306\b\377\234m%\t\037"
+	.string	"D\b\310e\350\234\203A@C\rlSd\264F\216\233a\200z"
+	.string	"p"
+	.string	"p\370"
+	.string	"\251\375R \b\026\227)\240\207\022\020\003\376\354\020"
+	.string	"\363\316\350\020"
+	.string	"x\304v\022"
+	.string	"n<! \340\006\004\027\370"
+	.ascii	"\353\002\037\2645\235"
+	.text
+	.section	.gnu.lto_.refs.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8c055744016d3d35,"e",@progbits
+	.string	"(\265/\375`\224\020\205P"
+	.string	"\212\210\324\035S@\222:\032\016Z0\250\021a\211\245i'#$K\233\001\027\300\221-(z\346\347#\211\366\2541\035\377\352\036\257.\334,Y\020P\365\016\313]B\f\020\237\3008\330\023\027\323BUW\224\030U2\352\251ILT3\347\257Yr\240\007\351\366\004\333J\231\002\210\001\301\001\327\001\253\232\337\237I\304n\255\327\220\206\026r\254\273?\301\017#\271X6\213\005\r\335PL"
+	.string	"\020\023f)I\326\275v\331#\026\271\311\227\253\013\027\004\330\204\\\365XS+\277[_.,t\017pK\263\265:\341r\213X#\026\331b\265\036C\306i\251U\033oq\246\304y\303\345G0\177\266-j\253\005\306wK\212Zp\270\266O\006M\220\004\301%mS\324^\303\334!\366j\221B\213\365\255Z\253\333\200k\037\273W\037\033\030\233\034\256\270<\007\3467\313\r\260j\031\007\300\374\n\325|V\250\366\037\3636\3635\363l\006\255\212Z\271)j?^\253\242\026$\304\277T\326x.\232\332D\354\253\356\025\250|\222\004\036\341\362\353\252\250\231\233\242\366\357\003%\320\270\375l\353\340;?k\2606X\\\200\225\364/\t\005\310X\001\203\226\374\257\365\277\313\177.\377\227`\342?\232\035\341?"
+	.ascii	"\377\033\370\317\202\315\005\370\331\201\177yC\370\377\304\202"
+	.ascii	"\260\002\326}~f\340\203\245\241\363o\023\377\315\374\273\301"
+	.ascii	"\214\377`\377\305\376\237\371\257\304\330{~n\361/\006\036<\347"
+	.ascii	"g\240\177;\370\227\203\1773\370\027\202\177\033\3707\350\337"
+	.ascii	"\003\376e\361o\001\377\256\3707\200\177{\3765\377\245\375[\376"
+	.ascii	"/\373\277\365_\315\177\254\377e\376\257\360\037\205\377`\376"
+	.ascii	"\267\371\317\346\377\232\3777\376\217\3757\376o\361\237\353?"
+	.ascii	"\212\263\263\263\263\237\263~~\372y\034\b\377mi\233\300\377\222"
+	.ascii	"\026\326\235\303\016mL([|D8\250\205\272\323\240z\204J\201\324"
+	.ascii	"\243\257\325+^B u\355#\003\364\021I\253+1-\211)\367\332@(a\003"
+	.ascii	"\211\251\016u\355`\257\304\364\247\201\302\037u\365\245\352\021"
+	.ascii	"J\270\352\221(\004j`\247\r\364\0351\201D\241\n\206(\374Q\217"
+	.ascii	">\241\n\204\022n\257\304^1\\V\250t\251\217\276[w7\255\305\224"
+	.ascii	"\247\333\027\354t\f;5\324\230S\027\351\365\232\262\"\351\356"
+	.ascii	"\356\364*,\212h[\177\355\245F!\"-u\207\265\023\005\351\246kw"
+	.ascii	"3\365/\335\356\2455\330\375#\2620$n\031\246`\337\032\350k\372"
+	.ascii	"E\021y\226~D\246\216rd\205\3521\212\b\303\b,\307b\377\326t\213"
+	.ascii	"\035\006\0254\217\351\262\271\035\233\f\233\270\334\244Q\007"
+	.ascii	"))m\330\320x\b\321f\313j\344yzjBd\342K\207J\227\250+^\263c\274"
+	.ascii	" Q\264\270T\263\342\326FX\365d5\277\306\343\223\353uE\343\t\021"
+	.ascii	"cVW6\331\003\374i\240T\326X\022\333\325\223\002u#\251R\\\343"
+	.ascii	"\212-\022\333\305\342\247\326\250B56\201\227'{l\335PW\305\356"
+	.ascii	"6\263a\233f\321\354\231Ub\227X\344\212m\230\257\327\212\371\212"
+	.ascii	"\265\033\270T\377\256bk\345\311\036\340\232\200\226%8S[\345\217"
+	.ascii	"!c"
+	.string	"\305v\314~\365\244k?\305\330\262\004\307\305\n\027.r\212@r1\373)\367\213\267\314\202}\277\226\f\017p\277\312n\337.\002=\273\b\344$\235\370\254\324\312o\020\346\327\007\223\205\326\210\371\025b\356\227\345Z\344\271\026\314\313\036n\244\200\341\362\353d^\206=W\355\001Mk\270d)O\016\315\220)\211\222D\024\231\037\227\f\245G\213)\013\327\321\344\342\331\207\337f\323*\222\004\312\330\303o\323A\202\021)\002a\276,.Y\302<\354\317\372\023{*\326V\265\312R\2233\0176 \253\206\\2\223\355b)(D\270\312\"&CA\261\222\265\352'\235,>z(TB\0203LD\235\225\260\016\3030\262$\\r\222\332p\310\016n\204\214\304\212\270\336h\276 ][\312\324\374\231\210d\342f\225k\013kW\246\214\004\311:\350\345\001\332\233/:l\025Q\244\210\331\016\231\025'p\230\202\003\016a\252\230"
+	.string	"\236)2d\b\017\315\254\342\022\341\243\255py\232\032$\b\017k\210Q\025mK4P\361\t9\017\223&\026'G"
+	.ascii	"\327\004\203\fd\t\223'#\031\230\022c\276~\234\201$oa\3101#\\"
+	.ascii	"r\r>>\304\232\244\341\222\205\333\206\007\314M\326\031.\346\301"
+	.ascii	"<\330\307O\377\3108\025ic\330\224\001q:\373HS.\225\221\212\303"
+	.ascii	"%7\r\261u\224\302%\367\330.\223\310\020\246\247'K"
+	.string	"\033\214\240\322u\205\227x\211\325\265\242\016\205P\320@\245+\311tV\323\354<\341\205\207\312)s\351\352\341T\204\303@8\374\253u\357J|\n\232\335\214\177\333\301\356a\323\314\274y2N\261\357\374\263\025\327\2741\343r\343pJ\003B\225\204\303)\367\216\2270\225Rs\263z\023\325\\\236m\230\277\315\255\036\244~d\325\222x\202S\306\3459\211y\376a~\235X7_2\344\222m\231\331\335:LWOF\262\036\006\205\376}\342[\366$O7\013\0371e_\206\\\276\211\355\372o\313Y\342\252\006$\310\230?\377\265\356\032r\326\016\376x\2769\273B\001(\016\251(\310\350\324\035\345x:\245\233\013E;\033;)\034\351\305\221.\207\366xC\247\221RR\221.7\204\362\224\206\004HJR\322\351v:\235\036Qm\307\016E\352\355t:8pgR\331;y9\316\0345#t\247B\016\034z\264CO"
+	.string	"\272\301s\036\341N\370\200\250\306\215\016l\200\340s\244\0276P\020\341\306P\357<Bq\275\240\031'\272\233\221\343\354\361`\270\341\203\304\313\351r8z\274\023-"
+	.ascii	"\211\247\224\204\203\247\324\303\365x\002\240\270\036OE/\247"
+	.ascii	"\313\005\260#\301\213\036\212\323\361\302\b\335\355 :{9t\007"
+	.ascii	"\320\213\316#\234\016\242\223\207C\317\235\027\345\320Sw\036"
+	.ascii	"\231\247\240\202\b*\260\340\005\235^\322n\347\001Q\216\321\351"
+	.ascii	"B\321.I\247d\362\210\200"
+	.string	"x\274\02352\302\351\364\210\320\236\016\333\311\303\265P\2361\344x\345\221\026\370N\307\211\016\365v;t\bE\217\310\002\235\026\266G\024c\202\236.\247d\036\006\214\031A)\230\020\202Y\364\002=s\340N\264\307#:\312\341\320\355\212\206t9\\\216\241\"\2247\364B\201\035\213\2368p(\265P\353\341\030EO\232\026\346\3416\203\323\020.\\\256W_q\314\262\270\334Z\257)#E\306b\244\371e\213\357\007g1\265\364\030\343\3629\276+\376\355\004\205h]\031b\313x~`\021\265`Q\342S\366\204Gq\345\361r\245\t\310G\246\312r\303\016QV\214=^TgK\270\254\252b*\247\342\2158\246\345\214\233*U\230j\2634\031\t\222\331\2308yb\326\304\"\231*gL\024)\344\031\251\363\023)6\322\300v\355!\221\246\306\013X\227\251V\207B(\252zT\211\001\342l<S\211!\343h\246~"
+	.string	"\363q\311A\274g\330\24556\305S~\333\016\224$G \260\314G`\025D(\344\222\1778\032\216\202&\201N\250\2218f\2244#2#\"\222$I\032\003q\005\204\030E)\274\r\022`5AR\032\206ddF\223$\373q\234ZX2\302m\n\304\322"
+	.ascii	"D\246\371\203\305\211\304~\341\325\257\260\"f/S\2351\306o\f\277"
+	.ascii	"\200\304\233(\007\022"
+	.string	"\241B\274\314\352i\01384\223n\245I\004\311\227\274!_\344Q\224\340\316\224T\350~\236\036\\\2163\241*\347\340\252\341\353)u\356\rSp"
+	.string	"~\004\fe}\245\345{\221X\007\372\r\316\200\205\034d\211\215.\353\036\367r\2328\225<R\244|\035c\363\2011J\231y6\306L\367Jk\372\233\266\350\024\361%\307z\262\f\367&\363\313d\f\t\210\313\227\032\205\354/\\\035\217\304b8\327\t%\024\006\3511~\310\237\315\254\307T\023\205`i\0323`At+\260Sn\236\013\254d(S\355\272R\360\034\237a\\\252g\315A\365\267\256\312\346\377\317|)r\216s\263<\254\311\230\212L:\032dA\207\241\227z\342\007\"W\251L\220\3119pJ\3275`\254\300;\213\006Iv\036\0037@\251\246\372\032\325\372\214\330#5\021?\366k\267`\204\356\350\334\256\240\204\023\372Gm\204.\030\t\355Q{\033)D\214\253~=\231`EF\0032R\252Lp\227(\\\t\201;"
+	.string	"\337o\310A\376\313j\313\364\310cm\336\371\256go;K\370\261u\226\373S\027Ok>\242\2428d\356\3747\035\230\241V\315\026W\373\345D\2508\346\257\002\353\367k\307\222\252\244\376\307\300\376\016\323\330\344\234\274\221\002\373\357k\344L\326\2266\361\350\344\001 \002hG\233\357\200\005\n\323gy\257\005N+C\237\232\362P\257\346\n\205F\271\002P\341\307\177"
+	.string	" \356#\322\260\025#\022E\322\330\301\215M\264\330\201l\254\321\203o\217\362#\226k\230"
+	.ascii	"\372\3532k66\321\255\021\307z\211\240\333g&?\0362\230\\\371M"
+	.ascii	"/\201otJ\374;\024Q\3540\202NG\212\331\273\237l\256\230\374\354"
+	.ascii	"=\343\245\364\230\243\311\353\276\334\032y\037\375>>\226\301"
+	.ascii	"\001\007\314O\360:\364`1\212\007\213\036\016I\342\257\203\337"
+	.ascii	"\240\332<7+\330\275\354W\375vl\366\277\360\323\213\350xP<\311"
+	.ascii	"\030\2605\367\0134\2644W\031\027\325\003\003Y\366\031\316\241"
+	.ascii	"o\351\317\265(d\300Iy\3307\002\037\275/\033\307\"85\321MkP:\224"
+	.ascii	"dQ\232K\331\310\374\n\326\362\277I\025"
+	.text
+	.section	.gnu.lto_.symtab.8c055744016d3d35,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"config_streamer_erase_rest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8c055744016d3d35,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
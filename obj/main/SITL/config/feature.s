@@ -0,0 +1,579 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375 \263M\004"
+	.string	"\304\006\247"
+	.string	"\020"
+	.string	"\345\217\300\314\013\004\002"
+	.string	"\001\213\331\256\305\001\002\366\213\237\344\016\002\003\227\247\344\313\017\004\002\001\002\002\002\001\002\001\004\240\342\234\212\n\005\352\263\360\321\b\006\312\251\326\231\r\002\007\203\313\255\261\f\001\b\347\364\313\323\006\t\306\272\236\261\n\374\245\334\221\007\013\201\267\227\352\002\f\342\360\342\213\016\r\240\200\360{\016\017\240\342\234\212\n"
+	.string	"\013"
+	.ascii	"d\310\317\302ih\245\013\250\235\240\306\305\212|\332\003\326"
+	.ascii	"\310,%7\320\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375 Pu\001"
+	.string	"\330D"
+	.string	"\n"
+	.string	"\002"
+	.string	"\001\001\002\001\001\003"
+	.string	"\001\006\003\007\b\001\t\n"
+	.string	"\001\013"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"`\020\\\2462\255\345\036\260\315e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\004"
+	.string	"bF\021\030\260%\351\f9\r\303"
+	.ascii	"\314q\215`\222$y\224\265\315\022B\310\336R\2463@p(\372\0070\205"
+	.ascii	"8\371{\310_1\246\237\277S\323\020\352\004\023\274\2569\347)?"
+	.ascii	"`\333n\374O\0237\276\202\204\266\344\207W\b\" \240\242\231\253"
+	.ascii	"\036\307\004\026\016B\216\221F\371:\231e\205\r\002\330\320(\206"
+	.ascii	"\024\301LR\200\274s\2239\242\355\277\023\311`\353\246I\337\263"
+	.ascii	"\267@\212/\202\364|9\020Ynt\255\023\347\216m\230k\336\362_\217"
+	.ascii	"cjF\372\233\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375 P\245\001"
+	.string	"\024\002D"
+	.string	"\n"
+	.string	"\002\001\001\017\177\002\003\177\002"
+	.string	"\001\002\001\001\003"
+	.string	""
+	.string	"\006\003\007\b\t\n"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"`\b\030Wep\313\221\232vp\331\177\003X"
+	.text
+	.section	.gnu.lto_.pureconst.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\230\004\006\204\004\007"
+	.ascii	"\204\004\b\232\004\t\232\004\n\232\004\013\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"]\003"
+	.string	"D\003\030\001"
+	.string	"\n"
+	.string	"\002"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"  \002\001\270\006"
+	.string	""
+	.string	"\003\001\002\004"
+	.string	"\001\002\005\001\006\001\300\007"
+	.string	""
+	.string	""
+	.string	"\007\b\t\n"
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\013#\343O\016`]\317\302\005J\013qd@{B\0137_\362s\024z\001$U"
+	.ascii	"\fT``\b\214\213\242\002\033.**\003:a0\023\225\335\360\005\030"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.5f1cfaa1b02bf490,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.19.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375 \225]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\245\317\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\004\023?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/config/feature.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.21.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\201\202\002?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_intFeatureSet.22.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\225\t"
+	.string	"vRB8@\255\322\001\264\254\341\341\025^\344H!\377\0342\212\353\251J\315x3\t#k\033\302\367\216B\305\260\320@d\365T\225\223\222\300&\204N\004\023\214\246\227i\321&[\246\0240"
+	.string	"2"
+	.string	"0"
+	.string	"\227\b'\260\\j\037\260\\\032\264O\f("
+	.string	"d\250W\312\356\316\310q\360\n\372\0279&\245*]/\016\273kM\251.\356x\333\t\266\033\354c\002Q\375K\300G\301\310\256\305Lec\262\304\303\3663\2665|\bx\327\350\002\273+\023\206\355\322\341v\265\017r\026\370\026\311\230]\r\026\311n\270`\205-\262\247PL:\263\214\217\032\277\202\3028\3755A\332:\374\221\345\362\361\001V\221a\322\231\035\2264n\330\327vw\035W\366[\277\274\353\327\242Z\003\240\356\023\205\270\216\263E\2008\217\346\215\246\373D!\256\343L\210\016\347\343m\346\247\303y\346\346\003M\315\201=\211\356\233!\317\373f&\334k\033W\226\260\230)\236\254Q\003\017"
+	.ascii	"2C{\025\030\027\210\250\303\206\352\340\263\217\364\255[.\274"
+	.ascii	"\3050/\b\277\251)p/\230\232\022\356\360\242\235d"
+	.text
+	.section	.gnu.lto_intFeatureClear.23.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\005\n"
+	.string	"\026\023E>@\247(\035@\271]\332\302u\346\371e\351\337\243l\261\354\037\334\205Sr\004\300>\260\013y\333\220\335MI\322\221\205\002!\353\300T\225\305\305\001xZ\0313\302*e\320p\242\311&R\246\0242"
+	.string	"4"
+	.string	"0"
+	.string	"\256\300\036'\356p=Zo\270\036\375\331\013 <\024\024\220T\017v7\323\223\177\317\317?\201WJ\246\3203!cw\235%\223\310\255\267Ma\033\303~DVM\247\246\217-|<8\330\r\t!\354*\032H\261}\213\355\004?\340{\352s\206\335\023\202\013\354\321 \366\264\017\340\001\276\243@\256\354\226\b(\260\013Z\004/5H\275\252>\002id\224\241/M\315\003\244\253<\020\206\342\177\256\307\253F\bB\"\312\320\006C\251&\366\255\335]\353\311>\352\277\236\372\243f\235\255\363x\332\226\3018:\332\3062\346\262u\036O\3332\331\206&\303\3410\031G\243m2L\327\311.\022\346:\266.\3638\256\313,\340\336Z=92X\211td\325L\020\020"
+	.ascii	"2\241\025\034\030\027\b\252\303O\365\210\325b>\250Y\237e\351"
+	.ascii	"\032P\f\243\201\360\233\232\002\367\202\251)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_intFeatureClearAll.24.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\215\007"
+	.string	"\262\21656Po\322\001\200KO\235\307\353\256\330\f!\243/\252\223\02224\255\246\026[C\355\216\032\261\205l[\177'Bf\306\315\002zh\024\322\211\212~\370\004\355M\366N)\034Z;YE/\312V\206\326NV\321kBh\256\rf\315\215\246\212\230V\345\314L\2021\tZg\206aub\272\375\264pst!\205 \205}\217\364E&</e\303\377\310G\005\316c%\364Jv\007z0\303\376\264\273k\270\331\347\3767\r\234\034\240\354^\224^\226\024M80\266\377\354\177\034D;\3679\301\356FR\262\3335\230\201ztw\003\371H\275@>Z\263U\020*\004Z,FXvwB\215k\177\232\377\220\007\210F\240?\200\207\335\365\023\2150nx\333\013\266\035lw\004\t"
+	.ascii	"2C\003\0258\036\201\306\004K0\344\022l\263\232\022\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_latchActiveFeatures.25.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"e\007"
+	.string	"\362M36P\215\322\001\244\024\217\250IU\301\327\r\225W\3237P\341k\002F\321\035\243dH}x\333\257q/;J\3303\263h\302\254\373@\026x\002\00346\262\211\334)\005\306*\331\364t,\331%&`.\032\211E\r\306\222\211\330\344\304\312\200\245B6cG\312\031-\323vjU\204@q\332\024\344\253\277q\216\214?\262\334l\252C\005\341H\314\271\206\007`\327\301\300\317xi\301\037\035\232\341\363\316\035\372\237\352\360jUt\230\224\266\327\331&\320S\013\373\324\252\310\376\363\251jB\344\372\330\215\350N\366\004C0l\337\262f\217\\\017\002\035\204G\311\356F\275\270\366\247\371'=\200\0135\374Q\016v\327\217\013I\334z\333\004\266\013l\223\002\n"
+	.ascii	"3\241\177\037\370\305\\\366T\362\220\252A\027r\264`\375e\334"
+	.ascii	"p9\026\355$\003"
+	.text
+	.section	.gnu.lto_featureConfigured.26.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\005\t"
+	.string	"v\222A8@\217\322\001\2305P4\375c\016I\331\003\312&>L\355 \342m\026\220\274\024-\324\337\346\332\203\202=\246\265\312\3170<\252\344\371\240\330%\227\027\324\251!\262\211\224)\0050"
+	.string	"1"
+	.string	"/"
+	.string	"\002\333\241m+,\250\274\372\307\361:\006E\313Df\367\213\272\361\325s\345_\344\360#\026\343\202I<\001\032v\327\351\202U\334z\333\007\266\243m\227\262_\323tj\372\333f\301B"
+	.string	"\263\373\232\315\354\nL\361\260\255\2627\2663\355\203<DuY\312\001\273\027'(\273_\202\0214\207\234\017l\207\332\003zM\205/\255\230g\356%\021\232\335\t\006\177\344$%\277\343\320'T\336u\350\243\266\303\253A\213\214\2253\373\363R5\354k\273\273\326\f\303\007\017%\317H\363\247\003\352N&\017(\024\035D!\022\367\211$\221g\024?])v\n\314A\200\272h\342\270.n>\326\r\225\303R\317~jK\205\372\226\212\2273k\001\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313(E\215\177\350\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_feature.27.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"\245\b"
+	.string	"\206\221>8@\305(\035\340\245\313\360\303\215\f\242~\016r\267\023\377\017\030\233\025\225L\227*Y\253\327i\3756E\331p\342O\270\253(.\272\303\031\202E\rO\206\372#\2667\2212\245."
+	.string	"/"
+	.string	"*"
+	.string	"\266\255\26002\351\335\205\352\023-T\b\200\335.\252\305IO\222\177\217?\210\326IjUz\0060\354\2563\265\212\270\365\266\017lG\333&\001\232>\204\033)\005%\273\252W\200Ey#\032\266G\266\305v\246}\216w\214\356\022\271\262+\221!\262\333%\030A\340\357r\002\370\207}"
+	.string	"\376\005/czM=\212u\372\307AD>\206A\241|\352\317\017\301\277k\205e\312\227\335\225R+\354c\273\273V\n\277\273~L\323\031\016\236\214\203Y\303d8\320'\313hb\303F\323\331\264\330\331d\234\250q\236\2101\360\366\220\341\342g\333\270h\351\366~z1\351\311\276\b\246>=\212\344\224\001\b"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\177\350\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_featureSet.28.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\225\t"
+	.string	"\206\322B;0\345(\035\200{\371\305\330\344,X\013\032\235\374bvj?(Pn\202\002Y\216\273@\213\330V@[n\260\315\271\246\327\241%\331h\2500\334\241\206{\002\236\230\r\262\211\334)\005."
+	.string	"2"
+	.string	"/"
+	.string	"\327h\227\331\013\264K{\366\313C\217\275IF\352\005`w\247v\334{\364\374\267\236\001U\023\217\002\f\273\353\b\252,n\275\355\004\333\323>A\260\026\203\330.EL\300\262H\030\210_r\227\351\241\035VBvw\273\264M\366v\371\315\366\243\375\221\223xg\235\234\331\325\020Q\331\r\027\2540p\211\020\251\213\357'\177\235\374\017\217J\361\340\245/\241]F\275\353\232\325\347\222\202\201\2121;\374\242r\330\317vw\255\033\266Fgg\375\252\321Q\323\002\020#N(sg\343\351J$\216\3473\037@\037\021\327\231\"\020'4;\335hn\016\314Ex\272I\342\270nn!\352\2557\254*\002\300\240\364s\246(\007cT\243f\372\001\001\016"
+	.ascii	"2\003\302p\036aYL<\bXR\354\256\262\211\244\254\256\313h\246\342"
+	.ascii	"\001*\004\261:\r\256\345\2050\311"
+	.text
+	.section	.gnu.lto_featureClear.29.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\345\t"
+	.string	"&\223D<0\305*\035\200{\371\353=\026\324\254AEP\322w\024\032RC\343n*(\022\241)H\207-\303X\302m\256\030\027\037T,1\031\266\260(mP$\214\225Z\207\302hd\023\271S\n0"
+	.string	"3"
+	.string	"1"
+	.string	"\227\007\317l\227\332\t\266K\177v\313C\216\375\253#\005\023\260\273S7\376=~\376[\307\200\252\211\307\013\303\356:\202\252\212[o;\301\366\264\217\020\254_5:^\266\025\226\002\331.\305\214\300\306$\312\207?rW\351\241\035T\270K\273ds\227\347l?\332_]\344;\313d\314.\306\352d7\\\260\302@\026\2508\263\252\2461%u\222\303L\276\207E\244x\360\322\227\330.\243\336\365L\310Kfrq\2123;DE\325\260\257\355\356Z3l\215\226\032\255=\020\242\rH3G\323\361H\243M\3073\037>\236P\307\231\241\317\00649\236hj\f\334Et\2749\352:or\341\351\2557\200\304\006"
+	.string	"8)\312RK\016\006\3204\252\324\027H\005\017"
+	.ascii	"2\003\302p\301\3022\231x\020\260\252\354\016\301^$5t\270\314"
+	.ascii	"f*\036\320\200W\bJ\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_featureClearAll.30.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"E\007"
+	.string	"\022N37@o\222\016\200\304Ucd\362Q\n\367Ng1\361\324\324\327F$\201\241\365\212\3554O\017\317\nj\201\027\244iD\201\360\223d\214i\214x\355\234\"\200j\232\020\231\002c\230l\343:\231L\023\0276\032\216\206E\316&\303\020\261\315!b\n\326\032\262-v4m\213W\007j\251\t\037\035-(\020\f}9\353v\r\341\356\306\017\020\257\242V7\302j\325S\007\\P\026&\025\320K}\027z\020\343\013\220\2319\274xh\255\240\020\220dR\244^\362\244*\341\370{Az\362\324\264\202\t)3\257V\357\371\253U\257?\237\322N#+B\232\030a\311\314\b3\372\351\373\334\226* \032I\364\005 d\346O4\252\350\260\277\301\177\360{\004\t"
+	.ascii	"2\003\302\360\024am\f\001\306e\n\240B\274\\\001.\335\242\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_featureMask.31.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\342M24`m\322\001\300.\025b&\207Y4\303t\020\353\2009\237\3349f\3650A\250\367\nf\241\036}a \250\216\242\220\024\226%\177\225Z\267\332\374F\366\2262\245\2460\325\365\361d*\rT\330h8\026\0059\233\314\002\244\256\016\304\024\330b\250.\350\261\254\013Zbv\267:\262^2\025\331\356\034\344\003\260\013\201\340\177<6\370\032\177v"
+	.string	"\345\265?\0374\375\245\006xdY\262\243(\325\302\276[\035\331N\247V&J\bNv%J)K\362F6l\207l\213\317\361\216\2201\0273\266)\204\024!\202\262\033\341\345\003\323\237\273\300\364\247\030\307\236\230\177\322\235IEI\333\036\236\225\204\335uj\033\305\255\267m`\373\300\366E\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\225\004"
+	.string	"\344\006A\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\027\177\007\030\177\b\031\177\t\005\020\n\301\204\005\017\013\300\003\002\032\177\f\033\177\r\034\177\016\035\177\017\002\036\177\020\037\177\021\005\025\022\305\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\023\023gistry"
+	.string	""
+	.string	"\005\021\024\t\025\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"P\223}9\267\001\264\033\303\227\001=\3007\340\033ux\3152\302"
+	.ascii	"\006K\003z\200o\200\037\2565\307"
+	.text
+	.section	.gnu.lto_.refs.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375 C\335\001"
+	.string	"\264\002?"
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	"\004\001"
+	.string	"\001\005\002"
+	.string	"\001\006\007"
+	.string	"\005\001"
+	.string	"\002\b\004\003"
+	.string	"\002\t\004"
+	.string	"\001\n\001\013\003\r\002\004\002\016\002\f"
+	.string	"\005"
+	.ascii	"3C\200\240[F\277\234\321\266,\001"
+	.text
+	.section	.gnu.lto_.decls.5f1cfaa1b02bf490,"e",@progbits
+	.string	"(\265/\375`\353\016-M"
+	.string	"j\205\030\035T@R:J\007\256*\302`\242'/\342GOc0\274\006\032\2044t+L<\314A`i\0359S\21227\261G\230\215\265\206\024vS*\263\020X\022\247\231v\265\357\200\231cw\317\255\212\356\312\213\252\310c\203\321\023}\n\221e\bT\207U2\341\376R\246\201\001\271\001\275\001\247N\267O\330'\027~\352\250\344S\013\351=6\251S\335\335}j!\245\2108\365\327\307\340\022b\r\246nd?1p\356Y\273\033G\377\316\355f\252\302\356\037\361\004(\342z\301!\354[\003}N?)\242\016\323\217\210\243\227\020\331a\320(E\f\002\243b,\366\257\236[ld\224\3204\236\265w\211\233\221\n\312\251\002"
+	.string	"\305\004\006\246UT\224F\224X\335\350\332\232\002\363\201\214\351\027\370\203\276[\373\303\032W\344\350\216\022R"
+	.ascii	"\0212&03\335\225k\353n\255\026\255\335/T\334\244\2109\270(}\005"
+	.ascii	"\346\0230\377\245\362s;\003\346W\305"
+	.string	"Y{\265F[\320\211\330Z\335\365\204\271%\346\330\304t\237,\224\255?+\345;e\261\216\003\254m\354\2568\0340K\004\321b\332bS\224\324\307\374F9nJ7p6\277?%n\177\312\327MQ\232\333S\246%\201\026Fl\314\027\343\315\277F\230\225\377\026q\304\177\234\177\303\266\230\370\327\312\366o\017bG\376\373\320\177s\370\277\365\257\316\177\376\231\200\177+\370W\350_\013\376\245\340\337\t\376\225\361/\006\036\374{\300\277\022\374\013\301v\360\037\367\363\323\277\034\374;\343\337\f\376\275\375O\373\217\366\177\314\377\344\177\263\377e\377\271\374\337\362\177\354?\226\377b\377\257\374\367\372_\345?\326\177\256\377Y\377\215\377\003\370\237\345\377mmmm\355g\3723\220?'\202I3\255H\344\221\266\3062&\307$ghh;VU\264\205u\001\36156f\314&M\236\376u\241*\336\272\266\306\322|\211\021\263\311\235"
+	.ascii	"KH\322\304\223d\0261L7I\273D\001\203djf\266e8\335]|4\025\253"
+	.ascii	"d\030\263F\346\211\027/[6\243\366\216\225rj*\232\321\021b\244"
+	.ascii	"\211\021L\267l\22172YG(L\027\311{\304\206\371\"\027\214\016\260"
+	.ascii	".\222v\373v]\354\354\272\260\t;\342\303*\351\231\211y2%\331\016"
+	.ascii	"5l\203\371=\356r\341\262\306\031\027\b\241\225la\205q\036\232"
+	.ascii	"\3375n\251\273e\275h\355a\351\204K\b\005\303\346;\023SS\243E"
+	.ascii	"\313\216\231\275fs\374\"<\236\314w\314\206\313\022$\\H"
+	.string	"\"\210X,h\212fX\031)\250\"\276Xl_ZV\31001\261\275b\236\335\266n!g\305}\301G\206\226e~\203\330\257/\330\353\202\355\225ma7T\333\314\220ME3\r\005\365S\202U\005\361Y\371^\371\025h\340bt\272\257\272{\005\316\232\256:\204\351\n\261\306\r\342@<\231\236\314f\225\340\205\n\r\323o\r\346\377o\331\035\203Mm\341O\347k\263\373\363\337\326\266\006t\247\230\352\346\341\005\315T\022\204\357\007\323\377-\372\247\373\024\006\215Q\347\211\240\321\327\301\254\343\360D\2606\021\001\3328\325\301J<)\361\344\256\r\214\0326\220x.\005k\013\273\022O\236\006\016y\202\325w\006\215Q\303\r\032\211\303\023\r\354\263\201>\"&\2208\fj!\016y\202F\3370\b\214\032nWb\257\021Vj\324\311\324F\337\255\273\235j1P\265c\310\361:vI^\361\223\255lu\025\265[\353\305"
+	.ascii	"\2674a\314@)\2354\321\371\322\361\003\007S\256\022\263\306,M"
+	.ascii	"SF|\330\312Lp8xPC\302\224{\370\031\315q\352hz\030\235\001\314"
+	.ascii	"j,\007\363T\312<\245\241h~I\006!\023\232\247N&S\261\221\255>"
+	.ascii	"|\344\234\003\027\271\215\257ve*\265-,\246\247?\363\353S\332"
+	.ascii	"\326\326\326\247\274m\215\311\333S\362l\212\362\2662\346mJ\230"
+	.ascii	"?\3330ec\304\202F6\305R\334e\314\351\307\224\211Ld+\013\216\272"
+	.ascii	"\255i\262&M\030\363\313\242\334\265eQ\336\366\305\344\331\236"
+	.ascii	"\262\305\317\366\224\334\203}\340\234|\335\320\005\005\202\016"
+	.ascii	"[\272\230R\0328K\222\342\323\f;H$[Rx\330t\255\241\371`\3122\230"
+	.ascii	"L\266!|L\004\001b\310\017\246g\031\376E\3031\264\260\246\226"
+	.ascii	"\306\364\310MQ\2620\350<\314!\023KFa\252c\253\346\267\311\356"
+	.ascii	"\231\263\323\031~\242R\352\320\004/ 0n\2340Q\031Sqh(\242F\305"
+	.ascii	"\224\203\254\203\233~\034"
+	.string	"\034+N]\200T\231\347\034&\212p9\322\003S\336\207\225\314t\306\361\343\334\\\t\201[J\3143\220_\370qljZ\254\344`z\033\225y\376\271\200\004\221&L\331g2\331\200\370\340\224M9\243bz\366\375\253f\325\370<\241\005`\247\037PI0\3355\356\363\271k\256@\003\267\235S\370d\200\330\355\343\023\247\246\333\207\333u\261\353\202:\221J\302U\322\333z\230On\212rg{\312E\023\364M\323S\n\241p\234D+K\026\2467>S\246\314\246\241(\336P\301z\022\257\021\303\203\0216\020\001\250\2473\332\345z-R RB\022\322\355\224\204p7\226\224\204P\364^#\206\321\022\220\321R\017Q\222\215\fz:^N\022\r\266\341\r\351\364\206\222\214\226l\222\214\226l\275!\007\202t-\034\361(\217\247\333\025\025\345nn,)\021\321\336\320\0037\273\336\222\355\267\033\273\036\357\310H\027\302P"
+	.string	"E\272$\243#\244\334M\221\216g\203&)\035\365\210t\274\233\347z\271\242\335\220\321R\214\235]\256\006\021\035\322\365rHK*\350F\350\351x\272\020\214\226X\244\300\313}\220\203\204$C\207\206\211\033$%%\013\206l\212t;\033'<\310\365\250\240\353\361n\210"
+	.string	"\200n\205\243\036\221\214\032D\275\034R\017\022\222\f\024\273\234\016I\bw\242\236N\204^\322\321\355DG;]\222\316\310<\003\016 \340\300\003,\334\364^c\305\225\226t;\240\236\222\322\016(\2077$\204\343eP\244CB!\227\244\303\365\206\024X\240\227td\303|P\220P\013\022@\320\300$\212\241\333\331\350\345t4\200\214\216h$)\021\001%\035\345T"
+	.ascii	"\"\332\361\200b\020\340\265^TG\225\247\036\\\345\311\026\204"
+	.string	"\332\031.\346\342Z\343\214\366\r\177\206\350#\314\230i!\0210li\260\334p\305L\213\265\326\213\3624P\n\211/\\\217*C\030\212\340\035\347\032\266\362\016\246\242BJ=w\252\270x\244\325`\3064\253\002o\232|tiU1\277WC\330\006$\204\334\300SWeIx\007\037\266$\027\3709\210\022\266\332#\024O\003\201H\"\271WQ\030\007\236\3329OtO\205)Ja#cqe(<e+Ga\036\316?\030\310U\324s\021\216\302:0\222=\026\251\340\n\371B\305\213\0340d\222\034w\350\220\237\255\370\005g@9KvW+^\302N\366\030\201$\250\221,f\020DfFf&\020\3214I\007\341\004\204(\01354\017\021\200\235\202\f\315\210\246\240 \205\302p\327z\216\004\313\366\213\263\3043\3611\t\342T\311\260\006\320\003\220\021\177+)68LY\217B\326\333\243JL\357\366\345\016f"
+	.ascii	"+gcQ\3065vE7{\363+C[\310\2073\273\370!\031\003t]\367\376\244"
+	.ascii	"\210\264!\362\242G\027M\017{\353\370LinF\177"
+	.string	"\003\b\033\256\013\320C\216\203\261\003A?\220\234\372\235Yr\rH\320h\331\013\363\3318&\bJV\006\324\307\204z\034]\361/X\037\301a\371 \033\2757\030\205?P\030\304\f\373\232\026\272\276k\024\264;\001\354 \360\232\370\332\246\025\305\247$*\332\246\n\002\034X$\312\034Df.\036H!\373JvRl\301#\363\322i\252\365\2368\240rGy"
+	.ascii	"\224JN\345\305-\004^\356\316l\312`2\201\264\306&\313\326\221"
+	.ascii	"\251T\033\357/\276\317{\363\213)}Z\366\361\231\027EfXt\b\361"
+	.ascii	"{w\376\270\306\\\302\341e\202H\004,\267\323\"\210G\217A\376\216"
+	.ascii	"\354\241M\001\b\310\277\003\347\307\2104\345\362\2717Xq\236\334"
+	.ascii	")\037\023;\177\020/\016\271\320\207\230\305K\022\307o\374\234"
+	.ascii	"i\272^$\27353\353\027\216\376\244\255\023x\266\310\221\256\271"
+	.ascii	"u\2608\307\225\300\304\300?b\235\235x@\216\343\220}\350!^M\356"
+	.ascii	"\217g\333\351\300\361d\037\262\322jw\322A\001\342{\257\320[\243"
+	.ascii	",\rH\331u\232\2335f\234\366n\203$+\340\216\2148t\034U\025\375"
+	.ascii	"\031\027?E9\311\326\234'\327\227\013\220\2501'.\233u|\320h\340"
+	.ascii	"\203o\320\271\366\017L|\033!\214;\330\244R\236\333\251\343\243"
+	.ascii	"*\371\177\246\374\035\242G\214\356\347\216\026;k\f\024\301\222"
+	.ascii	"\373@\217\226 \230\221\363\201\021\313\b\325\f\021\215\365\370"
+	.ascii	"\003*\244\257H\272Qh\216\245\220O.`\317\225\177\213\370\201\356"
+	.ascii	"\222\217\330\326\305\322\301\267\336Z\233\334\017'\032\223\372"
+	.ascii	"y;\273-\225\375@<1X\343\321\346\306yy\375Wf\373\346\275\260\365"
+	.ascii	"\262\275\342q\376\244\256\332\345y\rG1\013\276\355\337\360\205"
+	.ascii	"\326\370T]\315Z\315\273\377\212Q\005"
+	.text
+	.section	.gnu.lto_.symtab.5f1cfaa1b02bf490,"e",@progbits
+	.string	"intFeatureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"intFeatureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"intFeatureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"feature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5f1cfaa1b02bf490,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
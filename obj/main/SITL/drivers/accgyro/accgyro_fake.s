@@ -0,0 +1,671 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"m\006"
+	.string	"\322\212'.\200K\322\030\035\315\005!\030,M\b\300"
+	.string	"\340\364\003\f\217\305g\302\232\021\337.&2\"#\262!\345\225\310\022\322v#{o\271\211$I\312\350(R5\001\350\320\372\263>y\265\216\311\200\202\224E\030\013\227'\177\347\222s\347\334\315\246\230\016\024&?\216\n\213\364rd\330\343\020\342\321 \311\333;{ww|\337\005\026\202\206\004\204\343\326\253\341\212H\030\021a\333\334|\313\240\242j!\263|XD\215\252\252\016l\\\030\030G\221\252\351\231\317qH\037@*\027\211\217*\250L`"
+	.string	"&A\024"
+	.ascii	"q\205.\251@p\257Si\226\262\007\362Af\301\220\025\264\f\034\277"
+	.ascii	"S\002\270\rd\001\371\300\304\356\356S\026ZI}wC\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375 \364U\003"
+	.string	"D\003\350"
+	.string	"\r"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\001\001\001\003\005"
+	.string	"\001"
+	.string	"\001\006\002\b\t\013\001"
+	.string	""
+	.string	"\001\f\004\r\004\001\001\001\200\004"
+	.string	""
+	.string	"\001\016"
+	.string	"\003\017\020\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\027"
+	.string	"W\311\210\271\370\262\236S'r\002\210@\206\326\002\277p\314\251@v\036\200;\231\30683\320\314\262v\252\265x\022"
+	.ascii	"\366R8\253\214\325\031c\027\314\006\260"
+	.text
+	.section	.gnu.lto_.inline.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\002\002\365\b"
+	.ascii	"\"\215*.pK\222\016\310\277\360?\322#\222u\365\361q\021\214\343"
+	.ascii	"#\375F\t1\020"
+	.string	"\215Z;\020\004\377\377\377{hO\253\215\255\021\353\246[#{\357\024G\276 \023[\264&\224\344'\\\370Ge\003\234\350\t\033F#\301-\t\357&N\302\204_-\277\201FB\204\363\253\262\201\301\2419C\354\347\311[[\200\2570\242-\345 )\332\n<lE\234\373\212\005Z\377\222)\361BC\342\302n\276\312\207\266\314\314\312\212\205an\204pX\260\247\260\343R\2211\301\377\360\276\317 A<0 (\337c\363\nm\027\036\377&l\333|h\374\b. `\"RS\271\003\250X\340\fe02\327~\255\0255\017\031\311\344\210\023\214h\033\234\3401\r\265\254XP\212\245\203,\332D\027s!*\016e\354\\\036\211P\037\003D\004h\355\003\3660r\254\251\277\300\252\036\240\250\323\306u\363*3V\rz_\267\371\211\335\205\260\233#\342\001\314\016o?/\001\2311\262\315\r\255nD\354Ap\037\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`A\001\275\006"
+	.string	"r\212#,pI\223\016\374\377\377\177\364\252\003"
+	.string	""
+	.string	"\\\360\351\243\t\311K\030#\0073 @\220\300\351\002\331\364^_\374\377\366g\t\223\266\311N2Q\004\001T\300M\316I\314B410\223{P`$\007Hr\006K\023\222\017\307K\034_\257\340\202o|W\374g\003\"\313\230\342\\<\361\022WO\233\203F\005\264\266a\004\226\235\275\035\366\016\303\t\216x\332$4\352\201\223\205m\222\353\366aV=\253\333\266\341\370\326\037\301\216\355c\225\026\264\230\001\034"
+	.string	";\317\200'\035\300\355\001\206a\241\245c\206\273##\031!`}\363\322\261\342QNeF\370\031\2079\266dT\340\034\244\250\302e\300\363+d\002\333@c\2163\004\357\rr"
+	.string	"8\322\225p\200c\244\371\311"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\200\004\001\232\004\003\232\004\005\230\005\006\230\004\b\230"
+	.ascii	"\005\t\230\004\013\231\004\f\232\004\r\231\004\016\232\004\017"
+	.ascii	"\232\004\020\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"\305\006"
+	.ascii	"\362\307\031\"\2207\351\377\360\335\347;j\354\271g\365\377\377"
+	.ascii	"\377~\332G\303\217\204\r\321\333\2775e\344\3116\"e\n\317\330"
+	.ascii	"\232$J\323\212D\325\255\271\r>^\033E+:D\225th\rE\006<( 3\024"
+	.ascii	"\270\0179B\027\244\\\231\261|%\t\243\255Fk\325/\032\305\351O"
+	.ascii	"\371t\312\013elq\3149T\376\264\267\235\231\2167 \300\202!#v\210"
+	.ascii	"y\355`N\354\256\261c\001\256{[\034\2137\370h\001\213\213\001"
+	.ascii	"a2\021$\320q\036\006\277&\2335\002\273]\302x\b%\324\300\263\244"
+	.ascii	"\266'2o\021\270\016EG\324nL4\307\2716\023\375\314\225\367\005"
+	.ascii	"\267\210\004\372\211#\035vb\324!t\334\373\3020\270\006\265;\007"
+	.ascii	"\373\325(,\224\035\256\\\366\245\001\256hn\b"
+	.text
+	.section	.gnu.lto_.lto.99ad6fb804041618,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.33.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"E\f"
+	.string	"v\227TB \221\222\016\234v\270D\t\204\270\360s\215\303\354G\223\205\210\317U\261\2250f\260?/\023@\237 [\240;|T\262E\312\027\231L\b\002\344`\3211\202\311b\204#pbz\260\251H%{K\231RA"
+	.string	"="
+	.string	"C"
+	.string	"\004\246Ckv\214w+\253\300\305\t\314\214\335\255\364\303\265?M\315\377\3135\221\333\376\250\r\327\347!\255\220\021\2003y\035\024\020\361/\317\f\\I&"
+	.string	"\006\273\353\214\234\206\033\336v\003\333\013\354;\b\034H\262dw[\252\212\375\267\273k\035\331w\371\237\2463\323\327\200\234\240\350\224vQJ5V\006\262\b\261\261\375\264/\342-\332]D\037\260;R\021\263\333m8\001u\350\356\235\351\220z\n\241\004\f\223\2341'}\320t\265=>\3621\265"
+	.string	"\006\335\354\237\270\300\2116v\030\n\324\356\"0\021\0222\360\202E4\035^5\245ELy\352\2178\t\221\317b\013\"\371x\350\213L\207\231\302C\207\226X6\322\361lq\\\036\037\t\017\260l\244\303\262>U(\273B@Y\204\n\004\364\371\250\254,Tqx\214M\270\262\252\002\206e\325\246\333\277\325\2217dh\220H\264\344\tH\333\272\362\321\252\333WfH1\252*>\360\f\024"
+	.string	"_\2417\023z\3051\260\n\203"
+	.ascii	"73\027\320\373\017\323\374\270\365xJ\212\t}\276`G\305\264Q\201"
+	.ascii	"\024\214\272\204\325\254F\207\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeGyroSet.34.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\006\002\305\020"
+	.string	"\226]jH\340\262(\035`\311\314:u\335nW\213\331\304\265\025j.\023\2454 "
+	.string	"\224\312\317\016\235\301p\bE\027\232m\304V\037c\210`\347\031V#1\023\342\030fX?\307\350\340\235o\361\310\301A\272\303Y\345\337,\367\330;\245P"
+	.string	"S"
+	.string	"X"
+	.string	"\256\273%xj\273[\362\203\320\353\310\374\264\337\342\260\361\261\226\013\330\235\201\325v\311\222\035\204^M\336"
+	.string	"\367\032:\001\356\325\243\355s\300\303\350\347\003\214\237\335\365\350\211\217\237\243\377\331\001\270`\\>A%\273\353\351\202\031q\323\333V`;eO\224\273k:cs\323\242\337\374\240\313\376z\233\237>\366\317"
+	.string	"\024x"
+	.string	"\351q\243?\310\0251D\310\356\250:*l\337\227qZ\312q<\242\221\211I\261\273\030/U\216\343\n\253\331\335\356\325V\261\273\327\331\3317\2539\262/-\020\020d>%\224\374\213\3616\2536H\261\033\245\266I\257\261*@\263\273\r|\032\337A}\340\274\013\344^?\373"
+	.string	"\0376\031X\314h\212\250_\246L\346]N\360B]\374\3629\252\331\343z\351\223\327B\004=\273\313`\006\213\006?E\013\367*\242/O\202\202|\315J\022\2549\304&[\223\232\260/\262\001\306`Z\300\362\225w\270\210?\023h\202\262p\n\305\225\013\337\207\362T\"\310!%V\360PR\250\023\357\023U\236\211\304a\006P\3646\204\241\350u$\353\263Gx\255\270\331X\264E\223p\332E\245N\210\227\355'\316\236p\035\247\320\250\346\310j\202\200(\317s\340\360\016\367Jr\301\242\226~#/ \220\002\2319\263\003Y\334 \205\363==!\340\f'%,u@$\246\272\035&\004\255\004`\177\267\254\005\001\246?5,\222\235\214\243\300\0015\343\232\265\034\261h\313\021G\260*\243\r\214\037\264\030\343$T\037\345?\241\007;F \304 \345\206c"
+	.ascii	"F\343x\307\206\035\230R\302\0070,!\004\314\030\274\"\355L\t<"
+	.ascii	"\274h;\031"
+	.text
+	.section	.gnu.lto_fakeGyroDataReady.35.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\r\013"
+	.string	"v\024LB \307*\035p\216|$\2233\002\331\001<\305\235\204\356\350\247\360q6\003\332\001\016\n>\020\340\207\016\200\3260\326\352\224a\212\222\326\262!\b\200L"
+	.string	"\330YPs\352k"
+	.string	"\0047j`\033\"{\357\235R8"
+	.string	"7"
+	.string	":"
+	.string	"{Z\211\310"
+	.string	"\333\356vS\345\341+\2352\364\023\304\324\253\347\024\345\223:\270\b$P\020Y\264\263"
+	.string	"&\3453\227#\342JJ\rhw-[\342\311\315\3356\205\355\t\373\2360\373\263\177J\351s\020.\266\007\f\267]\223[\204\255U\004-\034\333\227\366e.\013?C}a\027V\340\300\356\370`\211\315\253\307{\270\327\315;\334\253C\333\301\307\2253%\025\b0\300\200\316\330_1/\256\351\023\367iAk\300\222\020l\203<\300)\302\007\020b\332\354\356Y^}\024\367\372\371\"\251\275d3\225\274\331\343J\316\230}\272\273\353\031\037h\032Q{\037QF\b\243\342\003M#\317\013u%P\364A\002/\272\rRH\243\363\300R\367i\360\307!\002\273\216\357\003;\316\250:]\220j\256^g\314\266F\316i\227<\344[\246\001\022"
+	.ascii	"_\241'\023\372b\b\006\022}\307\305`\216?\330\245\341\3363\336"
+	.ascii	"\245\265\215\322\254/\200\345bm\263\2322\356rK{M\t7\245P{"
+	.text
+	.section	.gnu.lto_fakeGyroRead.36.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\032\003\225\024"
+	.string	"f\343~I\260\324Q:tFz2\223\353\331_\202<\214\333\364\326\332@\203\203\216\377OyDX\263\305?S\327\335\330\270\377\370\262\037r\372\356 D\177\241\331\034\261\3653\205[\272+\364\3048k\374M\361\343I\311\2015d\023)S\ng"
+	.string	"d"
+	.string	"n"
+	.ascii	"V\265\237\273\220\316\207r\2162\347\317\317\306\234\343\212["
+	.ascii	"T\227\036\237\022^\252. \274\264m\005\013t\034\373\b\324\023"
+	.ascii	"`\026\324\001\206\324\234\243\270'\036\273\004Wc\376\316\345"
+	.ascii	"\n'\037\270"
+	.string	"Q=|\236\216n\"\276\240\nN)\304\352F\003Sz>BNt\345\271\315T\001\270\3149\255\265\333\207;\274m\t\266[\366B\bG/\003\2779'\003\0315\032|\0249\341\345\311^w\345\315\350y:\032!\323){\234\351\232\260\017\316\375\261C\365\311\207~\225\325R\252A\251^\251>J\313(\025U\300\310\234=SI&\223\344\251\260}?\306u7\266\334\215mD\300\326t\027/\302\371h\311\003\204\313\3159W8\366\352rm\035{e\0074jCd:\225\3409^\032\3708\236\004c\307\260\3645Vx\251\373\300&\205\023\342}w\236\311/\310\006\205\313\021\221\351\224\336(\322+\001\032\265n\364\bI \216@\321v\347)j8\246u,\374Rx\021\204\246Hl\273^#\246R\3159\277'\272\222\2601\341\204\206L\364d}\235\314\214\276\346\003\264\335\361uG\262\321\327\2563\315\003\306\300\202"
+	.ascii	"t\213\3055\303\262\020\363\202\341\\h\265X\242\r\314\305A\006"
+	.ascii	"VA\254\221a\321\210-\230\215\310\242\342W\006\027L\334\360z\301"
+	.ascii	"\304\325(;8\367\307\241\017I\267\003Ot\007\276\026\272\335~w"
+	.ascii	"\271\036l\313\265\213lg\262\250\b\\ N\357\335\367C\357\244\260"
+	.ascii	"\244\327\304bw\311\307\312\225x\354\226\364\226\216\360tw\274"
+	.ascii	"\f\370y\302u\300\2506A\250Q<\347\234afFd\024\024\024D\031\016"
+	.ascii	"\200\002\231\271\253\007\021\320\251R3V\211\375\357\006S\n4\r"
+	.ascii	"}\377\243\366\275\317\033h\331\323(r\236Y\036&\312\371\316\241"
+	.ascii	"\017O3\231+\225\366\211\315\025%\250\315\334oT\227'\tR\352\017"
+	.ascii	"j\200-M\200j\3459\260\366\270=\357\260$^\256\330-\370\232!9\321"
+	.ascii	"7\320\002\030g{q\267\201R,\200\270\037VzMN/\362\327\266\354S"
+	.ascii	"\205\310\313fc>\350Y/\002N\316;;TsO\232K\321w\324"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.37.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777@s\322\001\033\262\331\335\357\005\005<\3678\355t#<m\341\030\226\"=\032\002\376*\223[\244\251\372\331\311%\013\341\362\304\236\200G\217\366g\344\311\270YB\310\336)\005R\223\021\223fh\222\316\020hj\001\2251\317\274\220\025\023\031\035Y`\230\214\":5>\224\"b|$(bT\024=\t\316B\223F-\313ht\335W\013;\237\273\f8`\311\256\244\007C\354W\273\273\206\235\375\034JP5\005\251]S\312fe,\030\022\333\233\r`\033\326\321\315\303{\366Q\236\262]e\343\002\273]\314\313nUpC\347\226\353\t\256[\235\017\\\267l{\201a3\367:b\342\224\\:XP\2735B\221s\177\234\377\225\037\230\320\200\314\264\234H\177\034\210\335\365\3638}\334\360\266\021lK\330>\t\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.38.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"%\013"
+	.string	"\266\324MB0M\225\016\300\274g\214\323.n\302)\373A?\313\310\242R\207:V\221\353=\230\271\276A\3220\252~j|\265$\272l$\t\n\321\025D\341\216sZD6\026+B\230\216\342p\223\032\342Fd\247\0248"
+	.string	"6"
+	.string	"A"
+	.string	"\3433\266S\3111\266S\333\366\370\b9\374\210\"\275\002\211\b,rw\344\264\013\017?C\377\253W4\310J\300Z%\321gd\300\356z\216J\022n\355\2667l\013\260\237\t\263\264G\321\324,\330\207\354\356Z;\331W\3753rY2\005E\266K*W\354\213\216\310`;dOl\317i\177\303S\241\253@\277\330=\255D\354\216\035\016 9u$\204]\261bc\036\302.ZRA\222\235G\211}\007\241\251&\327\206\3239\013$`\3720J\340\321@\355\212\037\331\013\336\241\201dw\001\370\034\034|,b\030N}\320vJ)\234\360"
+	.string	"kM\020\003`\375h \366,\037\247+\200\001\353G\343y\035\347\251\037\203M\315p\0076]\207\363\252\207\263p\030D\360UN\001\bVn2\356\355?\334\f\244\310\031\nQ{`\273>{\231\330\365\245,\003\021"
+	.ascii	"_\241'3 \f\033\267\020\243\346\002 \037\270\031d\004\244\001"
+	.ascii	"2\006\005y*\221\257\31682A\3045\032\262C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.41.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"u\f"
+	.string	"\246\027VC\020\221\232\0168\221\314-kE\212b\272SEY3F\030\001\216\334\234\313\357\317\357\264j\371\301\002~B\3327\241\301\274\372\210\364{B\002D\n@\261\224T\b\371\207\030\001\002\310?\302@\237\354-eJ\001B"
+	.string	"@"
+	.string	"E"
+	.string	"\002\244Ck6\215w\241\355"
+	.string	"u\3400S\263\273\224\216\270\366\247\251\371\227\271G\344\266\277\351\345\372HF-n\204p,O\244\205D\274\314\323\003\267\222\331\261`w\235\221\373p\303\333f`[\201\375\006\001!T\362\306\356\266T\220\375\267\273k\375\330\217\371\237\2463\323\367p\340Rcc\004\306n\313M\216\215\001]\224\370\260\375\264o\3420\332c<\017\260\373aA\263\333\031p\202\351\320\335E\244\303\351\001\n!\305\f\226\2641H\372\034\351j\233\234\344c\352\200\r\272\331_\241\001DF\264\261\317X\230v\027\201\n\224\016\201\220\310#\035^\017\204jD\020O\375\023G\341\361E\306\220\222\217\207~\212t8\362\"\022\001\023\226U\251\255\222\313\244\222\360"
+	.string	"\3132L\260\254\212\352d\027\n'\213@Q\340T'\224\225u\250\022\022c\025\256\214\272\200a\031\365\321\355\337\352\307\357\205\013\216\221\212\256<"
+	.string	"i[W>Zu{\310fD\243\nr\201g\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.42.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\f\002\265\020"
+	.string	"\006\335hH\340\262(\035\323\312\300\212#"
+	.string	"P-%\\pG\0065\357\260\262O\r!\275U\217\311\274\037\254\r\212\f\t\026a\353\236\323D\260y\007\255\221Hr\024C3\3149\235\264\204\t\265\342\300\311\030\254\202\004\3707\313=\366N)N"
+	.string	"Q"
+	.string	"V"
+	.string	"\263\335%\331A\350U\300\374\264\037\3432\343gX>`\027\006\306l\227$\271A\350\325\344G\333k\350\004\266W\217\266\220\223\256}\215\t\0205;\273\333Q\024\037?G\377\261\003X\275\264|\202 \354\256\347\352e\304Mo\033\201\355\022{\246\002\273k\nco\323\242\333\374\240\323\374\365\260\237~\346\237\001F.Z\254\030\026\375A\256\210\237\236\325\2518T\330\276O\343\262\324o<b\321b\245ln\306K\224\337xB\r\356\325F\261\271\327\311\3316>\021h\202<\240\344e\214\207\255\270\356\236\310\t\025\206\363\202R\333\n\236c\245"
+	.string	"\003\037\3474\357\003\347W\340\366\372\330\347\213DOK\20652E\324/O&\363+\037\370@[\374\3627P\023\310\352\245O>\013\r\270vw\201\r\225\r\376\213e{\025\321\227'i\325V\264(K\250\346\217M\272L\032c_d\003.)%Py\312=\374\373<\352\257\004\232x\027L\241\230\202\341\373\274\016%\202\035N\242\205.\303\311;\351>\021\325\225H\034j"
+	.string	"\305\216C\030\212\035G\252\036\273\004\232\016OME]d\024.\273(\346\023\"E\355\246\315\256p\037\246\320\210\353E\333\031\002\242;\336\203\207i\033O%]GN2 \220\002\0319\273\003\261\270\360\031\"Rh<\302\224"
+	.ascii	"\324\001\221\370Z;\317\013f\t\260\365!\020c\231\013\325\232I"
+	.ascii	"\326eH\005\006\254\331\324.a\004\207!\334\222d\n\252\030\214"
+	.ascii	"\365h\204B\005U\214u\031\252F\t\210\320\204\037#\022b\230r#1"
+	.ascii	"\200QvE\342|\007s\f\306 \310#f\340\221\304qa\307\350\212\264"
+	.ascii	"5\005\360\345E\333\311"
+	.text
+	.section	.gnu.lto_fakeAccRead.43.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\031\003u\024"
+	.string	"V\344\200I\300\322Q:P\201\254p%\231>\350\320\375\357\311L\274\261\242z\325dhJ\003\222\260<\004\222\255`\2668\262\345\253\225\250\231\254Q\r\231\326'\0225\007\217BqT\234|\236}pV\2010T\222\201pc\202\310&r\247\024i"
+	.string	"f"
+	.string	"p"
+	.ascii	"N\331\226\322\376\317s7\007\2629\311\356\255\007cww\342\006\343"
+	.ascii	"\247w/\021?\307\007\020?m;\201\202\033\303\276\303\351\204l@"
+	.ascii	"\301\201E\324\356N\245#\016\373\fU\302|\234O\023K=\241>\035)"
+	.ascii	"-\365h\265khb3\372\220\242\311\302\222\244\236\246\353.=\320"
+	.ascii	"r\244\fI\331]\313\031m\347\026o[\202m\027[!\004<\307\274\347"
+	.ascii	"\"\200\333\335\005.d0\370>6\342\347\210\236wI\344CgF\217'&\203"
+	.ascii	"\366.G\252\b\373\341\356\256\365f\213\322#\007\372GK\317)\035"
+	.ascii	"Ni\235\322'Qq\212\332q"
+	.string	"\300\267\253\023\f\262H\363W\302\366\375\026\347\321\324\230hl\241\0015\247\253xP\315w\236<'l?\273\233\252\261S\237j\3378\300\331SL\006\021\\\306\312\270\273\f\374\030/b\261[V\362\263\225\370)\365\001\317\315\226\373\335\367\237\b\316\247\026\304\366\323#&\203\222\b*)D(\304\272\320#\350x@9\311\024\347$f6$5L\274\272\254\320!\223@l\267>\004\033G\237\317\353u\227 jM\266\034\220\210\034Q\237\367\002#?s\001\231\342\370\274\277\230\221L\273\373\331\003\266\200b\200\305Z\251Y(-\230\025\205\026\327\253\246\002\213\265R\315\274Z\032^^\023T2/\253\030\025\3535\243B1\261\353B\353\245\312\340r\275T\251]\354\341\352\315\"p\210\347\013\257\273\003`\216\347\323\373>\265\203\355\251N\211i\316\f\n\n5\007\360IW\302!\357\"\3613\374\241z\343\350\344F6T\001\354"
+	.string	"S\374\244\326X\021\200\263\312i\260\2142= \220\002\031\301\243\007R\334\377L/JB\3573\020\3202\f\032m\311\\2\313s7\332\2203\356\260A\302\327Lx\214}K\233_\311\270\214\001\276\037b*\fO\013\221\272\365\240\001`\023c\"\257\354[\264mj\354l]\370\210/\036b\327Yj\031"
+	.ascii	"\023\2134_)\213\305\345,bQX\303\261\023V\007\215\351\332`\216"
+	.ascii	"Ya\277!E\344C\034\360n\317\371N2\266E\b\3439\1778C\305\271q\322"
+	.ascii	"\023\212Z\001\005"
+	.text
+	.section	.gnu.lto_fakeAccDetect.44.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\375\t"
+	.string	"f\023G; \261\322\001\244\n\350N4\177h\213\013\300\351\2429l\024b\321\212\r\340\344\336K\025Y\214;\313\376\f\030ti&\tPL"
+	.string	"\b\f\006#"
+	.string	"\251T\001\200l\251h\207\033\221\235R4"
+	.string	"2"
+	.string	":"
+	.string	"\325s\202\357\325\266\023\024R6\177\312Z\217\275x\324t\273'\350\205\334<5\375\237\274\240\204\006\344fs\251N\001\034v\327\224\345z\335\336m\037\330n\260o\020\273k\017f\237\366\323\017\"\247\253\001\271\354\266v9\033S[Hl\337v\312\016\260M\251}\223\317R\247\241>\260\013\233\261\354\236 3x^}\376\363=\036\277\"\25263\272\233\021\251\364\032\3710rc]\230>\270\335\325Yv\306S6<\273\273\340\243p\234\004d\"\257>\352{\255/\031\225\233\355cEw\366\251\242^\314~g\003\242\030z\026C#)\234\210 \313\223H\024C\320T\216\032\243R\002\254\030\205%P,M`\b\301\244\305X\202\030$Y\202>\367\235\365`\276\371Q\300\340pr+\257\303\276\350s\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.57.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\245\n"
+	.string	"&\323E< \005)\035 \221Q"
+	.string	"\250\307c\224\331V\366\f\021@\367\354|\033\f\356\200\213\201>\266u\007\3767\006~]#H*$!\004\263(R0\347\3501\217\205kA\2219\354&{\247\0241"
+	.string	"2"
+	.string	"7"
+	.string	"\266S)\026\355\331G\230\225\3409\211\365\354nw:_.~JM\364\017\273\300\212\245\372\034`\251\\\206\256\005P\354\256\267\225\233\336\366\203m\013\373\241\177\335\376L\312\207\031d\373\257\324G\024\247ba8\265\224\366i^#~D\275`\267u\203\263;:\234:b;\365\370\203\317\351v\203\317)\350\3642\001tG62I\346t\331\336\244o\363a7<V2\304)\310f2\241pj\213\234\344W\006ud%S%\247\313S\273\266\263eO9#h\331E\t"
+	.string	"`]hNLN\250a\255 G\372\302\r\216\003M\036X+\0204\177\"\220\344e\\\204\365\244\361}^W\252`\310\250bt\035#\217\243\373j\251\023-8\364"
+	.string	"kg\n\303\332\311k;[\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.58.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\355\n"
+	.string	"\246SIA \347(\035\220\b\"\002\231\025\300\311\302\004il\323=\301HF\240+\303\342\006\241\347J\360nXl\353\302\372MCcO\004\271a\202$0\003n\3719R\024\3618\241\301\202B\032\312f7\331;\2454"
+	.string	"4"
+	.string	":"
+	.string	"\005l\237j\f\332\016\036\nXOkF\006\366`w\271O\031\340\340e\314@\377\257'\244T\250K\005\225\315\243\3033\217\307\356Z\273\271\347mk\330\016\261\017\021\263\301\200\273n\337\300\311\177\371c\373\256\323C\323\206Z]|:F\373\007\216"
+	.string	"|hz\303.k\001\203\3350\343\323\034\332\247\303Gt>\265?t>?\237\017+Y\006!\020s\221/R\266lk\321O\240bc\0346\362\306\347\212\026\323Q\361i\267\224\342S^P\260\212\301HT\224-\313\354\331J\226-)p\030rvi\"@X"
+	.string	"\001\236\250_\255\336&\242\237\311Fi\267y\244\316\253\037\022\224v\322\024\344\211:\022\221\257\226J(\355\270Q\365XBu\204C\tu'\034\255#\016d\341/\305\253\034\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_fakeGyroDataReady.part.0.61.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`<\003-\026"
+	.string	"\366f\210J\260\324Q:\264\237\320(\217\37166n(\230\266o?4\021\310\351\237\273\177+\221\357\214\312\236\3557\263e\260\177}\360\271\224\323\036\b\374\312's\342^\300\302\313\270\376\005>\265\341o\336\370_\307\307\275\315 \204l\262eJ\001k"
+	.string	"n"
+	.string	"y"
+	.string	"\027\226\\"
+	.string	"k\345-85\004\252"
+	.ascii	",\357\276\264=I\307@YS\360\274k\377\350H\267'\351\034\245\326"
+	.ascii	"\240\247\035\265\226,\247~@\236\272|\212xJ\236\200xj\277\206"
+	.ascii	"m\033\3177;\311\313\241\372%\024'\230\230\324Z]\247\023\306o"
+	.ascii	"\237\033\336\374\325\371\340>\337\373\352|T|\007<\034]j\255&"
+	.ascii	"W\334\364\266\033\330\006a\317\236\275\032\267\220V52\027\341"
+	.ascii	"M\227\261C\362s\004\314mp\247\220g\370\260\316 \373d=\222kq\\"
+	.ascii	"\323q\035\216\353)\256"
+	.string	"\367\345\377\002(+Mj\355\t6\251@\364G\343M\277}?\307\241p\356\344G\265\300\261\217\343>\233\345\234;\231\356\200?6j\255\254\234\365\225l~\317\254&\333\231jV\341)+\216\347/\375\306\355L5\022\307\013\276\337\256\bH\247\221\017y\021\"{K\211\247\364*\234T,\027\022$\234'D:\214~s\002yI\031\362\206\367`\004\354\022\235\222\334\006\031\374\307\013Yku\340O\335\007\f\207\230\275.F<\235\363ig\365s\364C\331\235\276O\346\265\327Y\205g\342|\337\243h[\245\273\317\260\367\210!\250\252\265\266\374J\314\3703t\304\323\235\367}%FI4\345c\361\327\2106\315\003\376\320R\020\013qc\363\242\211\241a\255X\315\313\203\214lV\233\201\301^.\332,F\202f\326\301%\202\346e\343\202\315h\256\326\212e7\261\231k\204L6s\261\356\222\233;\236s\n\331\256\205\265\276"
+	.string	"*m\320\t\366N\357\335\222ZC\343\264%L`\001\231\2308\333\024~\304\206\034\347\310C\312\bI\234v\205\367,\034X\033C\206\275N\234\357\375\204\252\210w\005\334\2318(\r\207:\200H\250\221,\205\fr\312\224L 3\n\022c1`\002\031S8\017\021\360=\244\005\306\365\177\213\001\332\203\210\311\247\334c^\020;\322z\3045FV\356\2315g!wFkG\023\371\305\0377\200\254\033\020d\366\360\267(y\366\271\024\324\2309\333HI[\243u\3774_\"A\203\233\355\262\2656/Y\346Xcx\334\323\240\245\352m\325\n\031\312r`\367\242\242\327\347d\355KE\025\264C\001\255\273U\321\270\026"
+	.ascii	":\243;\201M\202!\364\240[\204Q*\3236e\214}X\260d\301\025O~v\230"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\373\001\315\t"
+	.ascii	"\"\31657@\255\322\001\317\353\232R\023r\177\264\005d\203\034"
+	.ascii	"\226\002\371#\200\005\310\t\2233\f\265\206a\200"
+	.string	"\230\001\317\316\326u]\327u3\026\027\303\214Il\240Q#\334(m)\003y\271\330A!l\203\003d\003\260Z\314\262X?\314\346,\306m\326\276\201\315Z\214`\243T*\024+\205j\005IHG\314\374 \220\271\013\210\266\255\271\024z\210\300&8\265\272T-\"$>85\013\243^\375\244\272\211\341\250\205\247\024N\322\335\315\314|\2654S\222\360\222\"8\036|\224z\b\365\316\351\033o3L7\370Jo }F\007\211\276\202\t\021\322D\320\013`fj\326\363\026\343s\225\307\023;\027Ag\352\267\234L\354\336e\353y\032\027\231\317|\265t\262\273\2739\007f&\034\t. \020\003\021\252nb\212\300R\371#\0313qC\373C\217C\037XA\024V\254\250\306 \006\336\f[4F\031\237\007\247vA\007t\001\235\027\344\303^\036pz\033\033\351\341\033\370g\021`\335xx\rg\022\227\034]\214:"
+	.ascii	"\030\350\364\310@=\013\240\037\237g\230d\003@\371\247\203\016"
+	.ascii	"\230\023"
+	.text
+	.section	.gnu.lto_.refs.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375 o%\002"
+	.string	"r\306\016\021\240'\351\377\377\377?\363\377<I\016idK\231R\252\311\211\bR\314\316\354\346\301\234R\313\007\t\246\320\216v:0\205,s\300d\037\017[F\311\350\0307\213\224H\207|j!\001"
+	.ascii	"\362\b\005\005"
+	.text
+	.section	.gnu.lto_.decls.99ad6fb804041618,"e",@progbits
+	.string	"(\265/\375`\0135\005\341"
+	.ascii	"\272W\315LW0\nIJ\035\274J\".`ff\346\377.\255*\210\004\300i\272"
+	.ascii	"\332F\022v\377\264\n`\374\2335\376\350\334UK\202\301;\n\305V"
+	.ascii	"\003\336r\352\253\344\236\357\361\303)\210\242\331Y\330\222\253"
+	.ascii	"\005\264Ui\212\212\022ZU\3678\210\033BA\357\313_Q\222\354-e\222"
+	.ascii	")D\004\275\004\272\004\037xA\321\200A\203\006\227\"\252&\245"
+	.ascii	"\316=^z\247o\366<\306\276\254\n\233\331\347x\035\023\3704?\020"
+	.ascii	"2G\325A\260\204\\-)\363\217\302\b\261q-\331\361d\024^(\335\t"
+	.ascii	"\231\323;\374\032m\375\314\275y\224\027s\275,:\244\2615\355\353"
+	.ascii	"\231\366\225\207\366\f\376\353\267\276\353\336\245\211\260sB"
+	.ascii	"\335{{=\330\235\376\327\343\370\272wJ\016(\362\204\032c\203K"
+	.ascii	"l\214\315\276z\351\374\305D\253{\256\277\261a`\364\232\340\272"
+	.ascii	">\373JC\373J\245}\205z\255\257q\247o\343i\370;\275\f\257\211"
+	.ascii	"\356\375\343m\274\325gM\340\323\034\341\244wu\270\337\274\215"
+	.ascii	"\237q\327b\224\321\315\302E\213\352\304\251\252!8\365F\206\305"
+	.ascii	"f\317W\262\374\2610\214\346\032`t\035\242\204D\353\363\364\257"
+	.ascii	"~\312\305\311\320\326\223\242=/\321\236\355\264g8\355Y\355\243"
+	.ascii	"\320\242v\200\221=\324\327\005v\206K\337\350\275\300\326\264"
+	.ascii	"ii\317S\332\3572\223v\252\013g{#{N\325\026\372\356\347\225{\347"
+	.ascii	"\277\264\001\002!}\376\025ot\247\016\367,Z\230\321-\275\032\242"
+	.ascii	"\274\372\354\231H\233\020t8\326qU\277\374\220\373\003}\3203\357"
+	.ascii	"\323\336\314\275\267\004\301#!eo\237o\340\215\277\220;\r\353"
+	.ascii	"T\212\3564\334\026\007\004\030Ew\270\027X\326yi\330W\376\362"
+	.ascii	"N1\274\217\337\300{\346\3532\272\243{o\231;\305\312\347\231D"
+	.ascii	"\217`\357\213\201\275\201\201\027\003\353XN\377\245a\261\324"
+	.ascii	"\3008Q_\2648\323~\247\027\360R\271Vnt7\001\357\225\353\207\245"
+	.ascii	"\320\226\241$5j4PX\022d\233\345|\373\330-&W\201`\332\357\364"
+	.ascii	"V\371\262\032\f+\251\317\356n\305/\237\353\275\354=\301z\244"
+	.ascii	"\253\206\017\250n\241P\307\007\003\372\331\361\225v\214\244\035"
+	.ascii	"\377hj\215L\213&\264&U{\006H\356\022\\\346\324>fL\251{G\375J"
+	.ascii	"\271\323\253w\231x\216\356\355\327\314\375\346\352\335&\027\n"
+	.ascii	".sn\346\214\026\031\374\240\265\260R\335;\252\241F\003\214\217"
+	.ascii	"\352\037\022\233\357\023\031\"\255\240\254*'\277\244\375\201"
+	.ascii	"t\222\253\344\217\314\260\374\222P\321~\357\364}\2724\354\275"
+	.ascii	"\273yW\374\204\334\364\255\273vwz\215\\3\317<\236\266t\357("
+	.string	"\f^\"\325\261}\366k\303\312\\\033\326/\232\366+\246\375ni\277\223\322\316\004I;\365\372\350\013\255\036\3312R\035U\215\317\216B{\007\364M\273jwJ\301\375\201\225<d`\262\204e\371\373\354$h\277>\374\304rk\340\026h\277\024\2607\360R\300\272\3263\367\002\233\341^`\363\245ao\364\322\2605\367\002\353~\313\256\216K\206\233EO;m\357h\205\240X\234T\332\347K\366w\307\215\372%\273c\356A\003\177an\035{G/Y\336{yo\0051\367V\260\302i-{\2609z/\260\372\322\260\356_\245\343\257\373/\211\261\253_\020c\201{\356\361\241\217\310\375\2339Z\3343\225\373\265\342~\177\302\334o\0250\367\273\027\343\236\227\270_=\020\242P\251\342h\021\005\004*\325/\367\307\321\227\347\376\033\340\242\322\307\345~\307\376\206\373\275\261\345~\273\302>P\301=\303= \273\347\036^\343"
+	.string	"p\317>\356\217\001\250\373\225R\340\332=\227]\261W\332\370\032\356O\303i\334\263\233\373g"
+	.string	"\313\375\225\256\334\357\231\373\305r+\237q\317P\356?\303\375\231\334\037\206\373\027\271\377\217\373/\335_\205\373\037\335\037\004\356\377\001\367\367\200\373\353\270\377\320\375;\340\376\032p\177\016\270\377\b\356\037\202\373\223p\177\020\334\177\204\373\207p\377\016\334\377\001\356\367\210\373]\342\356\027p\277E\367\213t\277\"p\277U\367\333\342\356;\334\357\232\373\305\356\377\301\375;\270?\002\334\377\002\367\267q\2779\356O\201\373\033\300\375\013\340\376\026\270\273\005\334\277\002\367\317\340\376\004p\377\001\270\277v\377\240\373\375s\277~\356\267\317\375\266\271_6\367\013\304\335\243\356\336"
+	.ascii	"w\237s\367\230\300\300\300@\367\354\302\275%\306\335F\003\001"
+	.ascii	"U\227$\252\032T\025}\005\357a=L\005G"
+	.string	"\301R0\024L\305V\360\024\\\345N1\037n\202\235\370\007=\301@6cJ/\273\352Sq\036\021*\337Z\022\037\026RG\275\302\367|\230I\030~\303A\366\370\344\250|\030N,\211\357\026\271d\006\020\303\213\301g\324\203.\006\037\216\303E\224\033\210Ay\331\311\240u\355Ek\262\273,\321,\330\222K\303*\301K\222P8\342\205\245\307\033V\202\223\304\334`\362\004\305H\034'\371\240\241;=|\004\213L\211\310\030\306\303w\024\246`\261c\303F\034\337](@JT\330.KQ\r\001\303v\270\316\305\311'\225\206\353\360\034\246{\031QGD\\\2724\036\202\211\334\351\005X\356\263\260\250\365\370\354.Y\332\357\005,\016\f\274\027\260\3562\245\335\245I\273\213\013\355.A\332\006\273\r\031\233\210T\3330|\271\311\250\372\354\216\331\034\003ir$\306\3623^\203\311R\372\275\300\242\375\352\230s6,\205\006"
+	.string	"(\357\322]\274\251\217\215$%\031r7\357\356\331\340\320"
+	.string	"\310m\303\373\372@\234\205\245P\020\244\214\250G\276~?3H\212\006[\333\007a\242\342\257o\376\320\007\034[<p\r\274\205\245P\355\243G\232\233\333\037\265x\027\373\251"
+	.string	"\034O\270\270\005ly\331\201\375\024\375\023K\241\023\220\302J\372z\030\316\366S\246"
+	.ascii	".</\273\352\031\332\236\\\021\263;\345f\301Qh\213\221\217\026"
+	.ascii	"\365\n\337\003*\207\020\271d\006\370\202\362\262\253\306p\374"
+	.ascii	"\365M\017\004K\241\024\220j\352\201\307p\032\346\201\273p\024"
+	.ascii	"\207a\035\370\007\236b5,\206\317\260\024\223\3412\354\205}\340"
+	.ascii	"\035\030\f\233\341\033\230\013\343\30090\332\235\342/L\003k1"
+	.ascii	"\377\005\376z\244w\201\245P\017\362\254\362\250oEJ\001\\O/\273"
+	.ascii	"\352\233\373\r\202\277\256\220\255\334\373\360U\346eW\315C\362"
+	.ascii	"RX\344\305`\373z!\177\344\036Q\332\313(\007pmy\331Q\340\362\201"
+	.ascii	"\344\007\"c\350-\353\021d\303\007\2661\246_\300\356\005\366\242"
+	.ascii	"]\032\026ca\220\231\232\261\244\240\2457\016\302Q\250\007>F\324"
+	.ascii	"*|\205g\334)\266r\246\025nb\246\r\200\234\030\360YA\265\302T"
+	.ascii	"N7\201Os/\241:l\365\331\250R\315gVr2t\366\226)\332?\310\005\206"
+	.ascii	"{g\005\201\033S3\030aT\314\204\205p\213\t|\232\025 \362\203\212"
+	.ascii	"\344p1-{G\245Au(\345\240\312%\331\264\351\300L8\206\303\3050"
+	.ascii	"g6\263\006\030\3251\023~\201!f\031\335N\366\352*+Ku\357\035\205"
+	.ascii	"\247p\023\206\3022\360\023\226\302Nw\212\231\360\222\206\232"
+	.ascii	"\365\314\254\372g!{\213\226\366\226*\355-N\332[\220\264\267\254"
+	.ascii	"\320\336\002\244]g\321\256\253\034\275R\312\021\026y\230\005"
+	.ascii	"v\336)~b\242!\274b*\n\024?\261\021^a!J\023\251\033U\f\344I\025"
+	.ascii	"36\273\216Z\201\213\\\262\2145e\301E\230(f\207"
+	.string	"\215\242\251\317\256\207\264k\037\355A@\355A+\332q\220\373c\371,\030\310\003\253\232\320\\\320g\314\304?\216\201\260\317\306@\037\236\366^b \031\300\275\2272\367Vpo\0059\207\224\r\037l\366 Uc\345\215\343\345\217U\321\321\347\013\202M\264\007\221\350\267\2714\354\377\365\0251q,\201\274\337\367\335\247_\026\322W\375\3730\031\020\24634\235\341\322\260_\245\005\016z$n\213\212Oy\331\303\002\255\356\371O\211\251\322T{:a\205\226\206\222`\275\336\232\305%\345\324Q\240$"
+	.ascii	"\214\205\322\023\177(\227\314e\272\206w\365\371\225\274\223\227"
+	.ascii	"\277? 4'M\264S\r@\251&\277\344\2314\267\bZ4\351\372\034\004\322"
+	.ascii	"n\345\223\264\354%1b\225\204I\265\005D\254\252;\\\032\226H\r"
+	.ascii	"Fc\206}\276\273\323\307{\270\032\274\217{#\367N)\272\217b\320"
+	.ascii	"\250W\374^\266P\237[6bw\215\214"
+	.string	"\250\315\317_\327B\347\342\205\234\332\334\235>\235\r\024\327\321g\267\362E~F\022)~_\304_\316\271\321`|&\022\324{\036\341\361\245\207<\334C-\221<\273\264\263Q\332\331\246 o2+\244\264\212\336\336-(\245\346`\361\331Y\"\355k\240\366\265\1772\226tFE\373\370\351\235\376\217\237\362_z&\257\211\376\370\247\227\332\361\343\307S}\332\275S\232\331L\275>\252\006\r\367,.\313\0246\207\275\031\023(\332\237\275\332\235~\232\177\332W\275\215\030e\205\275\253\252\320\264\207\376\327\275K\013\276\376\254\314uyyl\026\301$,)@0\031\255\271&Mq\332\253\236\375\252\353\3221s;1\005\267rH\001VwS\311\346\255\210\r\235e\361u\351\253\322\203\006\016'WF\264\024\270n\367\026\n\\T\322//\355\030h\036H\317g\306\342\354{B\301\222\001\235\250\2140\326\332\343\312^\336\347?\307"
+	.string	"\243d\317\354I\037\013\251\237\231\032\332g`X\231f+\371\312\007{\371\264\031\242\f\244V\361_\221*!\237\217Z\224PiJcB\205JV\233{\242\001\305\375\025\201\002%\357\325\004\331\202\311\021u\344\217\352y/\310\354\232\342\3619K\311h0gx5\260>g\275(l\332\211\223\\\2467"
+	.string	"\304\334\364\350\252A*\246\034`Q\235\227\227\231\334\275\261\024\245\036\035X\003\206\204\345\370\234\231\354e[\220\317YI\026\253\233c\316}\316I\236\211\245/\352\232>g$\317,3\002C\214\351\320*4\224]F2\236\221\334vwW\263\205\247\244d\263\201\241\273\273\317.\023\245]F\250\256\016\373\261\316\026\240\274\300\027\277\335\347$K\\.\022\227\347\346\206\f\311rw;?\270=\211x\226\023\242\204\021\0253E{\214\021!\323,\004\263\341\346\007`t\324\355$\222"
+	.ascii	"\r\b\007\345\013\262\226\335\326\362\033\273\367\215>\261p\346"
+	.ascii	"7 @r\233V\356\035\314\302c\363\334\306\372\001\025\375\234i\217"
+	.ascii	"\2711\235\376\220\315\336G\031\310\360\252\314\314\262\332\020"
+	.ascii	"e\232g5\231j\2159\251\214\366\202\244\257\217GF\313g\301\245"
+	.ascii	"\245\265\037UL\027\034\002\026\310#\206\276\323\334\343\207\236"
+	.ascii	"h\313\271\023\3401Fdd\271\214J\006\034n\316\250\347\262\325E"
+	.ascii	"\020$d0P\2524\351\263\307(\265g\257\374\345\031\314\335\301\362"
+	.ascii	"\330\355\020\206\247GW\335J.l\334\263\016\317c1i\200U\347\347"
+	.ascii	"\034\226\305\262\333\321\222\027Y,\347\370'\035\225\037^{&.@"
+	.ascii	"]\321\346\347\035\332\375\335\331\275t\356\275\217\326\350v\372"
+	.ascii	"\274\370]\357\265q\207\271\370Z\260\267;\007*\242\333'\256J\025"
+	.ascii	"\315\305\266\\\372\f\333\327\273\275\231QJ\b"
+	.string	"D=\231QIMi\324V2k(+8w\224\262)\335\273\302f2\225\"\236v\205\246t?\367\317\221\347\335\321(\345f>\355\n\233\271\227\031\232\314\250gS\272|VhJ\243\236[\032\265g6s\351\024bng\205-\215\332\333\322\247\347LS\372\364lJ\243r\3341\241'L-\340\252\314\310\272\317&s\033\255`Z:g\356\232\321\247\315d\357\233\006\264\235\026\354\315\364\344d\262L\272m>wF>?\226O7\272\302G\352i3\357\232]O{w\371\350\354\375A\031\275\333W\367N9\305\264\213\200\366\026\300\212\275\225w\337\355\275\225{\357\240\223)\272w\214\231&t\305\212\275\225jVl&\245\033\320\336\237\346\244\355\331\224J=\335\270\235I\241;(\252\274\320\315$\312\251\245\312\262]DEC\237-\246|\366\214\303=W\345\256lUbM\255\371\371\202\335\270\361\314\005cE\303\213\355s"
+	.string	".\315V\206\256\305MQ}\3166\242\322\253\327\364\007\367\331a~4\325\264F\246q\247YK\252\205w\316z\262BW/>\234\202\202\330\234%m\001b\205E\305b\261\024Z\222\257\262U\306\202e\n\027\325\321\342\366\207\343\305\347\\u\343y\206~\362\372\222\372,A\246\302@\022\360Zz2\205\027\204\"*\202\222\302J\\\326\312\240IQQ\264\224\244\2415(*WN\372\226\345\351\375^k\307W\020\031N+\335\221\0243\247\314tF\304\244~\366k\226\231\3623\267\250\203\221\233r\214\274t\247\231\351\335<'e%\244\374\"\006\357\3554\007\325 3e\027\371\005\035\035uo<\246L\224\235J\nS\274<\260\032\r\0324`;%bk\0242\336"
+	.ascii	"f\277d\021\313\203\372;\272\223\271VsH\376\246h\177i\242=;\363"
+	.ascii	"Pf\361OK+\304\332>\033\325\350=\260#Lt:\027\335x^\341\200\254"
+	.ascii	"\251\034\237\361\213\020\215w\026\262\351S\342\003"
+	.string	"\366M\317?]W`\314\370\234\177p\340\017)\203Wxy`U\214\305\375&\377\340,\227\214\275\332\003\312A\231y\247\371'\373\344\374\223w^\3060\243\373\031Ts\313\003\323v4\234/2\264MV\276,\221\200\340}\366\027$\355/E\332_~\264\273`\321\336\006\350\267^1\303S\372s\314v\203\005\363\317\257\257\307\322\212\220\317\001(px*P$\341eH\241H\202\212V\004\f\n\034\236\n\250hE u\216\311\020h\\g\303\221\307\210CL\301\232\030\266;YX$\"w\210\311\022Ba\314\021\231\354\311\026\\g\203\004;;\311b\221\247\030,\201\307\250\203\344)\006\213Ia\005F\030!\002\007d{\3028Df\b\321\032yB\244h\221\307\023D\220\201A\266\"\304 [\021*\210\250\351\200\202\213\005\025\255\210\016\033\220\306a\317\006\232\020\":pyq\r#H\3408Dc[lOh\377"
+	.string	"\002\003\020\033\230\020\364\r8\350\300A\007\3267\340\340\346\206\003\0207\332A\334`\244\320\210D\016ir\206\255N\336!\016\221\371XL\032\215\255\n\036\215<\342\024O8\n/8\n\217$\264)\210H}$\001\331\301\t-%\fI\340\344\f\331\343P'\210lsxB\274\340\340t"
+	.string	""
+	.ascii	"=\201\033\226\305\301\031j\034\234\341\013\322u6\034\340\203"
+	.ascii	"\027\244\2140\350:\033\2208I#\362\350\341(4\241E&ST(&yp\204\302"
+	.ascii	"\240\261-\226\300#\024\006\217\306\366\230,\n\205:\247HD!\024"
+	.ascii	"\262\307\"\261\347(\024\006\213<\304#q\247\025\n[\220\302\031"
+	.ascii	"\frZ\343P\347\210\001\207#\222X\202C\262x\002\003\023\222E\342"
+	.ascii	"\016\006\037@\bAl`\002\2076'\271\203S$r0\036\223\034\030\200"
+	.ascii	"4\241-\356"
+	.string	"\f\213\306\026Y$\nu\220=B\241\004*Zc\217P\310\"\217\304\035\241\220\025\nY\343P\007'\267! \036\205B\026\005\016\317N\036\201$\026\211\027\212\036\344\f[#kD\206\200SLz0D\016E\360\030O\230"
+	.ascii	"\206\243PE+\242\350\001\214\353l\020\200\261\335\311)\016?\240"
+	.ascii	"A\026M\374Q\210\323\222@\2013,\261\2633\fQ\201\2104\241\315G"
+	.ascii	"\241\b\025\332d\233\314@\273\323\223bxtA\036\205\304\036\021"
+	.ascii	"L\264\"\204#B\020\301\245\305)\016\221\307\"Q#\205\030\030\221"
+	.ascii	"\213\304\020\212G\034\226\330s\304Ga\b\017#\\Bx\030\321\302\342"
+	.ascii	"x b\327\331pL\226\300p\024Z g\306\330\"\217\303\024\354\361\330"
+	.ascii	"\032sr\206\301V\305pG'\205*\332\234c\262\204>\n[\034\242\212"
+	.ascii	"V\3041Y"
+	.string	"\302\245\025\266='\214pL\226hi{N@\036\223%\202\307d\t\334\356\fq\216+\217\261\335@\320\204F\n=dpL\362\020U\264\306\020,\2240$\021B\004\005\244\020\304\r\262H\f\266\306$rhl{R\264H\027\244\021\031\002\211\242\007\310\366\330\032\2039-\n\234a\017{\024Z\030\032\223'\210&\212<!\222=)f\220\256\263!\331\223\302yzZ#\007$\017\217\221\203K+$\321A\203\016 \222=)h\222;<\307\326H\341(\004@+B\262'\205\013\213\334I\036[\022\255\205V8\024\032y\216\305\366\030S<A\334\351\240%\004\037\200\320\"\207$\\N\310\031\266$\206\310aN\213\361hB\250s\202\250#\2041\321\263\363b\242gG\030\002\035\024\0362\020\266\306a\t9\306\241\216\205c\017\217Q\204\261\315!\252 \212H\366\244\220A\nO\fG\340!\006O\fG \"M\220"
+	.string	"\2628\"\331\223\002\006)\334"
+	.string	"Y$&\203~s\023\"\003\t\027\230\200\306\331\320\242\030\232\020\342\340\f9\034\215\255\n\2421\207C\2218L\301\001\307x\344\260\001\001E\036\"\022\247E\362\030C(\201g\307\204\261U\201\201\343\360\003\036\343\t'0\354\360\360D@\270\216\2553`\2460\271e\255:V&&SaD\253\330Z\004\023e\212{[sd56\017\311\323m\r\313r>\224WH\237\277\276"
+	.ascii	"-,5\016\034Y.\357\t\224\257k\216k\354\345\311\224\261\347"
+	.string	"\215\\6\266\265\364b+\267\r9{\353[\241\353\262hH\372\265\326Xk\344\266\226\231\355\223\304\t\332d\245\261\322\310m\327\351\234\322\301\315\315\313\256Z\241N\273\257Y\371m]a\274\200\"\304n\275\302YU\177c>\237\235\234\326\031W\013*\017\354\273\226\364\220\262V\371:#KX_\213\317k\324J\265V\273\222\232PMuM\331o\253\024]\224\262\241\251v++\024\233W\205\343\007\324\372d%n\211\206\321\313\f<2\242\317\253\214\354S%\n\332\331\327\222\373\322\312\304\242\035\301\252Vu\022W\230\320\347\225i\231\241\304\005\002\2760\362\365i\264\302\250\321[GX\023T\246H\325\217\300\025\311W\030\276*\rQ\032\371HZ_d,Lr\200K.\304\234\240Q\\\254-\226xca\331F4H\326D\264\327\243\225\205\257\316\243 \033\025\234\032K\220{s-\312D{\373t\210\3720\331[\311&"
+	.string	"oU\036\353\220\257E\276\022A \013\217\034\257Vgel\025\222\371\372#R\262\nY\211\271\250\242\241\247}\246\211f\006\204m\250\323\302\363\211L<&\231RL\311H\211\244 i\f\323\024@@@\\0\231OW9\037\023"
+	.string	"U\307\303\221\030\3071\306\224\320LJR\250ll\007@\334\030\217\201\260\371P\t\016\214\341p\374M+^ \234\210\364\020j\371\230\332S\324G2\374o\006\254\252\356\361\243\246e\324\\\032Y\355\307\373\375\022\203\235b\314\363|FZ\250\370\350\226\025\210\374\"#\222\247C?\003\306\215\220\2418\362xl\260\246G\217%]\223\227\376\020\244X\223\007\002S\261\201\327\303z\363`\376\r\365\274\365Cm\225\254\212\336\313~\200|\016\241\267Lk4\032\345\020"
+	.string	"=X\243\313~\033Z\020\330c\027\003\274<\333Y\231\270\206b]\312\371\254\f\344\024W\213_|\261l\025\006a\224*\367\222\325\016(|-\3233Hn\316.\365G\037'\235\3537\021\025u\201\223`\254\324\330t`[\363\373\030\231\365!\177\220C+D\002\031\3217\363Q\360\216\351-\303\306\261\212s8\"+\207pO\213\244A\r-iO39\3061@\316Qb\037]C+\204y\247hJ\271d6DG\\E\314\035\374\316\321\262\031\"\362\216Z*\242\020v \325H\026\246\200H^\204HT(;mXdgG\023o\317\237)\tO\310\225\212\024~\356D\210\333\337\213uLBd\026\230j\215\256z\262\350\266\216:\350\232\211^\317\002e\221s%\354\006"
+	.string	"\216\362Sl\035\335\346d%\203\243\36627\353\016\033~\354\036\034\177h\243\305xW\231V$n\363\2300v133\332\371&\346\\ft\326\0041DbW\255\013\213\363O\n\377\370\221^F\207\376\225\3449n\217\025\b=\347\342Kx~\302\356\320\326#kY\352\357E\306\262\215\032'\367/\206\373X=\306\345\305\356\324\341\244F3\214\310\326\240\275\214\257>G\016\275\003\260\332<6P\230\017\350\314s\372\b\202\004\177+\360T\202Om<\234\364P\231%\300\177\265\327\203!\302v\271xC\364]\316\277-j\246\013RzW\373\264q\342\241\327\277\363\177\025\003\023l6\006\241\312W\346gjJ\307+<A\006S\260\360}\203T\177\017\303\265\235\br\225J\356\367<\252\324\033\342\355\t\227W\230\"E\023P"
+	.ascii	"\367\304\177\216\276\006\343\b\033\340\007H\016\332\261i_\346"
+	.ascii	"MO\003\264\203\237\nH\211\245A\273|\203\277\371HJ\251_\344\306"
+	.ascii	"\246\001\025\356\252c\bt\346\r\r\333b\303\034\322\025d+,\305"
+	.ascii	"\334\025\313\025\003\340\342\326\261-\2355V\004#$z\t\321q\036"
+	.ascii	"%h=\211\256y\373h\b8I\210\311\rW\350\367+"
+	.string	"\"\362J\013\345n\020\3302\\T`r\362\r(p\n\344\005\266\355\243,\232\\\3355\312\214/\207\304>u\270\f\230h\fo?\346b9\230\033\357\262\365\b7\253\301\2474_K\035\210\272\372\234\353w\225,d<\335\245o&\272h\2421\356#\3501-\031\033\313\"\331\360\233v\025\005\204hy\274\351^K\264r\022C\022C\344'\211Z}\301\\]AQR\327X\330xo\017\322\256c\033\342\335/\\\340l\256+\266\231\232xCb\202\226\301X\342iYd\2639\013I\272v\002`\3414I\341\322\2474\326M\342\247J\320\254\367\301\271<\007\350H\246\b\314\254aV6\373OB\034\257\340\242q\344C\367)\004U\017\317\312f\346|p\fO\330\362'0`\224K\241\377\217\fQ>$\260\201nb\\\034e\341\245|N\247\326\"\002k\t\260\322\3078)\352\246W\r{\030|\205d\304\356.\026"
+	.ascii	"U\245\2505\262\020\235\031ZM\013>\316!6\330%N\323\315\343\317"
+	.ascii	"\b\n\202\314'Y\247\370\031\216\342\201\204\342\030T\344\345\244"
+	.ascii	"\320R\370y\352\261\343\213\003u5\370\256\316\213\204\3178\246"
+	.ascii	"vp\313:\331f\347\002)\211'\3650\212\223\372\302I\245\357\257"
+	.ascii	"k\230\356\214\314\213\347\207O\003\251\310\271PQB"
+	.ascii	"\333@\3231\211+-0\212n\342J\317\333eD :R\270\241\364\211_\277"
+	.ascii	",LP\231\017\227\306}\026\007\267\034\377\262"
+	.string	"\024=QU\030\364\300\202\216\246<B\224\264\246@\266\3627S\n\314\225\303P@\221\311z\236\306\373\315%1c3O\351'\024\326\236@O\257Nw\207\362\311\211\310\350\206\330\034\360\321\260\3264\376\345\n\311\351ef\227\236(_\300\023M\025\241\030\225\202k\201qdrSDu\202\315&\t\205\254!\222\242- \251\313\023\334\205\372=k[\240\032\354\352\331\312\244\261\362\314\326a\300\310\002\031\210\213\322\324\020\027=\227O~\231\367o\353Q\267\323'\004H\370\005\333\340+k3O\266\314\3755\303l\2355F\241\024\023\f,\261\"\332p\277\232M\266\027@\267nd\321\213\300(\306\377\246\373l\237\361RR\314\271\004\346\3320\320\004\260.\345j2\035\340\335w\025\302\346\364\227/\376\370a\232\247q\237\004:\021=\277D\361q:n\2255\236\\\352]\272<\336h\034\320x\317\f;\2170\372\373\204\fe"
+	.string	"\300\020\337y7\246b8\313GU\234\243H(\026\024rkP4\002\215\350on\251\207\310\013)l\016(\035;\320\241\323%T@kN\302\232tc\022u\374y\307\352\t\031Q\006\346\020\372\264\\\342I\245h\237\2234\235e\271\f<\210n\024\036;$\254\033\265E\227\341\334\013\275\317\211\213\025\365|\":\266\303\227\001\226J\001\204\365\242&]\266\022\246\211\370!"
+	.string	"\224\033y\036LYaB'1\036S\241\262\355\221l\330\277\0355\263\271-"
+	.string	"Q3\035\007\233^`\351\307\252\213Ra(\366\277^9s/Q\216\222o\241\321J\313|t\372\364\231\313Y\236\264\013\313\277\006\243\356\250\223\327\215g\355A\230M\360$5\335\227R=W\336a\234\251\034\377\017\f\201\024\331<BG\002\224\241 Rj\265?9gb\035\023(\301\200F\n\375\024\333\335\201p&\365\302\334\2642\262\211\342"
+	.string	"u\327a\352#\365's\317\261Nb\376%\r\035\036\354\236q\203\322S\003\tb\177-\371G\302\240\021\302=\335\254\366e\305\220Q~\031\035\324\351\330\206\357]\027\227\26589^B\324\234\226Jcv\241E\004\240\027\253\354\023Pf\331\266\336\032zM\252\021\253\235\330-\310C\2174\212\351\0203\030h\203\0206?c\017\273u\350c\0056\"\177o\227+{D.l\373\016\325\256\230I\244\343\350{"
+	.ascii	"\277\2013\251\312)\031\207\276%&6\301\257\342S\371y\311\255\341"
+	.ascii	"\257\353\221\n\270\363*\272w@\203\026\317\244vn\337F\342Vr\304"
+	.ascii	"7`w\214\262\225\347\023zF\302\376\326\213Pe\320\340\022\317J"
+	.ascii	"@\250-\360\257-\273\260^I\314\226\372\001\263\265\260\343.k%"
+	.ascii	"l~4\240\334Fe\212q\370Z\311h\256\021\333\252\334\354\220q\022"
+	.ascii	"\322\022\360l\231\226c2 ;\030\t\334\275\202d\312W\304\223\207"
+	.ascii	"\336\211\373O<\017\243\254\226=Z\203V\242+\366\367[PVU\325CG"
+	.ascii	"8\273\313\2717ng(\360NY\0375l\025\277:\027\302\353\026G\001\301"
+	.ascii	"\221-\007\301Y\021\026\363@\345w\236\254\240LwG\341\370\300+"
+	.ascii	"\221%\241\234\005\202d\210x\244x\t=\237?D\334h\035\314GJ0J/\305"
+	.ascii	"\244\354\352\013(\r\303\214P\376dNLY;\300\307\002\357\031\bo"
+	.ascii	"\336i\021]\212\033\255\027\306$\205*\370\216 \272\031f\237\265"
+	.ascii	"\335\303\001~\231\2435\260\251U8st\242\316\324yV\314\264\350"
+	.ascii	"Y\021\f\030\224\310\002\307\375\331\360\266\300V1\f\333\375M"
+	.ascii	"~\3210l\363\005\206\013VJ\255\240t\300:\247\3231\344\005\342"
+	.ascii	"\313\231\327\340M@98cq\333\225Ar\333\334Of\346 xD<e\363ciK\222"
+	.ascii	"\266\346S\275\347D\302\306+\274l\217\301}\265\177O\316U\377\226"
+	.ascii	"\236\267=\374\313\3342\357\337\322\300\210\327\202\367\332\026"
+	.ascii	"\335f\034\025v\317\023dL.lM<\253[\360\347\210\255\246\372\343"
+	.ascii	"(\213G\016\016\356Y\r\246=`I\344\240\304\207\335k\360MP\203\253"
+	.ascii	"cR\203\261\337>\374\006\377\030;}\033m\372|\035K7\334\221Z\323"
+	.ascii	"5S\257\033r\311\373\327\310A\335\027qQ\376\211\333\374b_\034"
+	.ascii	"\341\2237\3577\221\2706\235\252\236\035_d<\340\306\203\316\252"
+	.ascii	"\235\360\365\344uC\350\235\375%f\007\177{\354\226\037\346\377"
+	.ascii	"\257\262F\341\271\3146\270kv\016\323\037}W"
+	.text
+	.section	.gnu.lto_.symtab.99ad6fb804041618,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"fakeGyroDataReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"gyroSampleQueuePush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.99ad6fb804041618,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
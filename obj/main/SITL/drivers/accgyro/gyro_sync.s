@@ -0,0 +1,479 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375 \232\215\003"
+	.string	"D\005\216"
+	.string	"\007"
+	.string	"\362\251\246\354\f"
+	.string	"\001\213\346\250\201\004\016\002"
+	.string	"\002\001\002\003\002\001\002\004\002\004\250\270\250\373\006\n\005\002\005"
+	.string	"\002\001\003\256\331\366\246\b\006\002"
+	.string	"\002\006\004\200\223\350\277\005\004\002\007\002\b\005\356\204\255\363\002\b\002\t\002\b\002\n\t\006\240\342\234\212\n"
+	.string	"\013"
+	.ascii	"`\213U\232/X\261\263\225\224\035\241\3320J\313\315f\300\335;"
+	.ascii	"\0216\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375 h-\002"
+	.string	"\364\002\\"
+	.string	"\006"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001\003\001\200\004"
+	.string	"\001\001\002\001\002\013\002\004"
+	.string	"\f\001"
+	.string	""
+	.string	"\004\003"
+	.string	"\001\002\002\003"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\003\004\005\004\003"
+	.string	"\b"
+	.string	"9\006\300b\225\031\\\205B(Z.a"
+	.string	"\345o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`?\001%\013"
+	.string	"\026S?;@\207(\351D\341b\357\225-\236\244\245/&G\205>\251\320\f6\362\353\"D2\236\331\326\267\026#a3~\024\377\200\r8\005\210\216q\\Tz"
+	.string	"\264\337\376\037\211\206\b\221;\005/"
+	.string	"/"
+	.string	"."
+	.string	"K0+\310"
+	.string	"(u}\326\006h\220L\f}\344\224\342\300\002\006\013\370\017\026\355\277\334w\323\314\314\352'2\323\363}\214h\245\314L\370\352:\004\273\353\256\303\024\177o\"\367\335L\261\262\212?)\265\221SY\355\\\367\336\3651\253\250m\032J\001\004\002\223\317\032\001\343\364"
+	.ascii	"k\320a\372`\007\356f\023\363\254QD\231\037\205\367L\260\237\362"
+	.ascii	"X\021\037A\320j\247\205,\f\301\253\235\227\224\232\0045\325U"
+	.ascii	"\211\337\215\323\023G\n\325p\344\017\377\273/\270\303\334e\212"
+	.ascii	"\340\002@\200\357\253@\340\317\362}\226\213\007\376\\F\210\364"
+	.ascii	"\341~\025\314_\005\323\004\214*F\356\327\374iZ\300A\202\215+"
+	.ascii	" @\002c \253\036\220\301\243\274\340\375\b\213\205\324N\323\233"
+	.ascii	"\246\202\032\246i\3104\337\366^A\354\022\364\362\2141\210{\270"
+	.ascii	"\326\022+\360\202q\"*\256XNiB\375}\2002\f\241\317\036\037Y\354"
+	.ascii	"\370T\344d\317\001d\0357\245\002\r\243\220a\275\227\347\007\313"
+	.ascii	"g5\215\226\016d\2329J\373[\254+\334\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375 \200\215\002"
+	.string	"\322\005\020\030\260%\351\f3\rpIR\201\"\206a\221\027V*&h\223Md\222\001\013\330\302\026\226\260\007\376i\020V<\025'^l\203\345\210\233-\317\215y\200\342\2660\267\222\316\246\363^\251\346\374\325\206\005"
+	.ascii	"/\371\2401\232B\"\223\344\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\265\005"
+	.string	"\362\210\034%\240%I\007\240\336\3537\363\240("
+	.string	"\360\217\267JPF\\\253D\243\306\nh\233m\210]\315\346\335H#M\356\0247\b\305\341xD\345\311L C3\005\203v&\032\211RK\307\210\tSz3\355\222\372\027^8\2423\324\210\270\332e\2449\255\032\027\263\241\305x\365\236\315\376\356N\232\231\204.\374\373\276\257\366O8\275$\320\036\200\200\201[\255\376\232\033"
+	.string	">\234R/AW\215\270\b-u\350\206\031\016M'T5\315\023\243\016\335\002\337\0215"
+	.ascii	"0\213^\240\330\005\304\f\007\325\004\334\323\202\tQ\307\021\002"
+	.ascii	"i\313e\2072\265\013S\313u/\204\f\240\b"
+	.text
+	.section	.gnu.lto_.lto.c052b77df2a77233,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSampleQueueInit.19.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\215\007"
+	.string	"\322N55PO\323\001 [nU\f\347\204\351\267M\013\300\332\321\312PF)1\314\b1\317\261\321\036\345\351#!\r13\2160\3025\364\026\211%\320cb\2437\3312\245\226\307\362LDW\232\252\223a\016\362\232\031DUm$6\255\n\316|\220\035\316&BV\023\223\232\003_\022\326\224\024\3275\345\344\355a\3478\362a\300\fG\272p\263H\bWhg\026z\316\224\310\267\0017\333\333\024~\330\217vw\r;\373\241_\243\t\204B\331\355\210\201\331/\256\200&\333W\373$/\321\036\272\370\300n\327\242\262\353%X!\363h\357\224\364\2309\201\364h\315v)\320\020H\3418y\331]\tC\256]5\377&\017\340>\333\025\240aw\255\334\307\343\206\267m`\233\3016(\t"
+	.ascii	"@\211\"\023\032\200\307\025\027\b\301\220K\260\315jJ\270\303"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_gyroSampleQueuePush.20.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`X\002u\023"
+	.string	"\366$\202H\320\322(\035\322\302>\023\022\221\203\243\260\fI9\272\303lq\352\321\330\255M\236\r\242\214\375P\031\231\323o\234\006\303\341\251\255\333X\324>}H\312\232\340Z\034\313\370bP\256mz*@\225[\272J=\315\356M\344N)n"
+	.string	"c"
+	.string	"r"
+	.string	"!-\201jqx*Rb\264\357\342D5\327\321\274\300n\316\307\214\335\360\201Y\250K\207'\231\227\250\033\230\227\266\r\001\245\306\265\207@<\022\230nEBv\303\225\246x\355\022\324X\363m.\025\020\235"
+	.ascii	"K\204r\354\200\201#q\005Kr&\206\f\300\341\200\r\222\226n\347"
+	.ascii	"=\356\340l1\236Tv\327Q\0077\342\236\267m\3016\005;\006\005E\035"
+	.ascii	"b%L\273\373\025\227>\315\274L\351y\037I\002\362!\322\355\342"
+	.ascii	"\317\016m\242\242\260\017\356\356Zs\266\214V=\374\003|w\247\256"
+	.ascii	"\373\0018\372$\243\347)Z\316hpF\253\214\2162\372#4\267\036\002"
+	.ascii	"\337."
+	.string	"\317\217\310.I\244\240\357~\273\306\3479\345\357f\300\355I\261\301\343\307n\350\340\322\023P\032~\215\r\031L|Z\314\221VH\230v7\202\335:\r\027jwY\227\002@\035;%T*u\250\005oG\257\310M\374Y?3S\252R\307[\217\355M??#\020T\0310\002@:A~\330T\005U\213r|^\217\001Se 4\024E(\355\220~\301\214\252\201\247\204\023\233|Mi\324\037\345\260\260\265\334\buE\301a\017\177\341\202\332\375a\371\001,\255\027\007\360\365\001\306\2455\233/\231\227\f\bi\327\211\353\2056[Y\305d4\230\313\325Z\315d\257\020-2\226\325KK\313e\345\222\315V'&\216\301\274d\253\230XL\266J\205{p5gVS\317\007\376\265y\336A]\217\236O\375\332<\351\216\355\223Z\345Fmr\352\215xTa\246t\352\351\346\313\361\261\305\237\017D\373\002\206x\035\223"
+	.string	"Y\262\251\215\003) \220\"\031;\353"
+	.string	"F\361b<\2436\220\314\255\330\3318\213\265\300\354\t\211\255\313{o\361\030\240\351\356\275\200H}\220$\n\255,&\032\317-\034"
+	.string	"\304"
+	.ascii	"<\206\261R\030\211\360\332*\337\001\326\215\266;d\346\0263\201"
+	.ascii	"\230\007T\306\034\260\303\216\236\201\241\t57l\001\r1\270F\334"
+	.ascii	"\204\355\346\021:\024"
+	.text
+	.section	.gnu.lto_gyroSampleQueuePop.21.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`\341\001\275\021"
+	.string	"&\342xH\320\362&\035F\300l\036\033gI\tT\367\271\002\371Q6\260`\"\304Cm\206E\350<i\235\bm\343fm.\216\007\261\376\374\221\361\331\326\017\324\303(M\3573\276U\f\212t\002\365I\021\261,)\"\221l\"eJ\001c"
+	.string	"\\"
+	.string	"h"
+	.string	"#N2\355\273\370\017\315\201f>`w\207G\215\335\360\201M\300G\207?\360=\202/\360=\3326\204\b4\236=\354\311\231\360d\013\362\261\033\246\324\304g\3674g>\355\236\372\f!%\305\270\205\270z\rd<\005\241n5\217dEM\213\353\23687\233\314\020\224\335u\336\334@\334\361\266-\330N\261\263B\013\224v\367(\036\375\031\275\356\004p8\351\374"
+	.ascii	"\345rg\207\264T\036\373\336\356\256u\307\216i\324\303\037\300"
+	.ascii	"s7x\240?\304i/\246\365KgL?\200\342lC\b\232vsvN{\024\215R<\367"
+	.ascii	"\3334\276\316\"~N\306[\334\311\215\035\323n\350\340\321\024@"
+	.ascii	"\re\t\004\254\215.:)D\342\250\246\264\016/Z)\220`\253\234\206"
+	.ascii	"\n\334]\223G\222\036\"\r\253T\362e\337#j\311\b\245\031E\340\222"
+	.ascii	"lAjrg\275\314\007*J\2356\\-w\036I{\245\225\277\261\001\037\025"
+	.ascii	"?\230jJK\242\034;N\250\362\030\324+\006\335\222M\002\261\275"
+	.ascii	"\3410\300k\324\361\202\205[.\344\002wK\230\370A\257\227,-\025"
+	.ascii	"\214\307by\265\250b\037+\206\025\363\022\275*Y\271\310b*)\027"
+	.ascii	"L\266\262Z\251R1\030\213C\013\226!\345\322R\265\244V\260X\252"
+	.ascii	"\204\201]/\026,\005\343r\301R\"\341\336[\335\361\207\2243T\244"
+	.ascii	"\377\354\273\356)H\037\206\212\322\237}\236\342\330\366\324("
+	.ascii	"5Z\363Tm\214\344\214\233\036\271\334\371\277\360\201\252\372"
+	.ascii	"\3025y\b  `\002\021A\327\003\200Q\030\024\357J\031\210N+\232"
+	.ascii	"4\262x/4\033k\371\2757\262\013\260\226\276\024\201Q+m\263;\324"
+	.ascii	"\006'\263\002\263\216y\001\203(\216\256\034\305\3619,P\354D)"
+	.ascii	"\301D\233\201\271\tjv\230\002\b\221\266\206\242K@\001"
+	.text
+	.section	.gnu.lto_gyroSampleQueueIsEmpty.22.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"=\t"
+	.string	"\346\021A:@\305(\035\340\335V\0362]\017;\314\f6pG\203\037\006\032\375\361zKr\265X\257\277\337-#V\t\324\030!\307\031\206\007nt\300\213\tHa*;\232\022K6\221;\2450"
+	.string	"0"
+	.string	"/"
+	.string	"\227\266\275\30002\351\341F\352\222\222qz\265\354\206S5Nz$\371\027y\306\202\241\202R\225\036/\016\273\353\210R]\334z\333\b\266\033l\003\b\321Q\243\257i\037(\005&\273\251X\200=\2210\017\333#\033c;F\373 \017\031\275%z\300\356*V\262\033*X\263]:<\201v\271]@\013\252\257\023\314\3449I\324\003\016\203w}\266]\226\306\037\001Ul\035\227\276H\273\274\016\254\264\\1f\207\245\250,\373\331\356\256ue\371\326\237i\335\247\373x\244\271\f\327\t\201\017\323\373B\021\034\267\231\340\327\2018\037\304\354p6\022\223\373\300\231I\2607\321}\223\302\363\276\211\t\367\226j`\241&G\275\312\f"
+	.ascii	"@\211\"34\030q\017\027@\353\210J\231\322YY&0.\243\0245\036\252"
+	.ascii	"C\030\3235\311"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.23.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"\215\f"
+	.string	"&\030WC \217\223\016@OD\363\330\037@\306\"\262[\200\233\306\025\n\233\374hO\323=\200\242\365@\035\305G\004\355\01734;\301\001\274\326\034\003 \b!\255\020\322\251\367A\231\024\260\n\340\211\2244\262\211\334)\005B"
+	.string	"C"
+	.string	"C"
+	.string	"\360\272"
+	.string	"\353\320\2667\020x\274}\226@\027e\370\240\\\354\316\250\032\276\275\322\267\371\035\027R'\035\367*\243\253p\315t&\225fw\277\362\207\322\225\274wY\260\273~'\035\205\033\3366\003\333\n\3547\b\237\367\363\363/"
+	.string	"P\2040\210J\232b.\250%\306\236\200&<|\376\366m{\374\025c\374\271i\270\271\240\r\013\"L\006\016\235\340z\317\276\351*\236\237F\036`w4\242\304\356<`\216\353\320\363\003\254\007\225\222POeTt\244|\b\231Z\274\335\345TI\376f]\037\260\2540y0lOx\210\355\332]\016\237\245\243]\034\016\375\021\353\360J \245\024R9\221\274\026{rOI\366\253\335]\353\310\376\351\207\001\235\215\324Lj\037\2251\r,D\3438\210\231\324>0\314#r\344F\002\210\204\020C@<\"DLr\242F\001g\"\033\031;Y&#f\356\253\325\221\265\303'\365\216\372E\264\341CB\377\315z\212\242\" \366\005\013\022-\t\023"
+	.ascii	"@E\301#\036\021\013\214\267 \001f\335V\326\300\n\"\f\036\"\227"
+	.ascii	"%\020\027?G\335\330!\270Ft\"S\023\254\226\247\232\201)q\250{"
+	.ascii	"[[\364"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.24.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`\004\005\r\036"
+	.string	"\306\363\270J\260\226Q:$\332M\227\250\362J\240\265m\266\017\275\347\034\016\021\276\016\261\200\322\331\313\026'\264\206\215\216\365\237<2=\313$\t\266\254\372\246m\207\372\203\377\203\312\3319\350b\r6BW\322\230\340\253\034\306f\t!d\313-S\245"
+	.string	"\225"
+	.string	"\243"
+	.string	"'\n\016p\257\0175r\357\371\340\025H\016\177\222\377\317L\334\264s\036{\326\340\211@\246\034\020\254{\317\330\f\307\210\034Z\036 r\3304\230\207a&\314\253t\265\310Q\fmW\236\363Hc{\034\245:^\n\206\2311z\025\306\254\212\262z\035\031\325\362()\250\250\272F\032\005HB1\270\245"
+	.string	"I\350\005\223P\202\210\222\202^\324\321:\3509\031b(A0l\f\325\214+\271*\272\340\320\344\001\251\340\341\252\035\342.y?v\346\336\313B\270\356x>\265\2164\367\336W\035O\210\017\200\177\026\360\337\346\267@\001b\267\f\213.@+?5\353\265\271\273\255\222\334\320X;$\3027\321l\356\023EYrP>5\375\317\024\265\177?w\232\246\351\333\367\277^\206\2030\307\360\311\034\200\237\230a\374\203\331$\353_d}\311O|\027Y\337\"\353I\262~\264\365\342X\037\212\3656\254\357\260\276\206\365\\"
+	.string	"\303\305\2622@\345\336\026\251\227;\025B\345\370\277\363\227\177\020\035>\021\024E5Emx\2721\200\353S\245\313`\353\037\201\302\016\377\270\275\357\355a\271P\353\317N\354c\207\003T2\\\344Q\256B\3222\0053d<\312RFC\347\353\305\344\350\201`\353K\200Z\350 \333\367\021;%\034\272\336\324\330\277\327\220@\365\262\204\303\036\345\254\233?\367\366,(],\023\303\356"
+	.ascii	"\f\376\324,N\"cP\3453F\002\202C\263[\274)KNe\3777|\344hh%e\211"
+	.ascii	"\250\247\246V\354_\r\333w\026\302\255-J_\232\371&\336VX\273Z"
+	.ascii	"\305\020\356\256\331\331\260\375\213\340\"7\362\336[\341L\204"
+	.ascii	"\003\316\253\312\r\016\317(\236\350\256zjzN\371&\272\3326C\031"
+	.ascii	"\241\270\236\355\037\267N'B\210\210 \241f\226\243Sc\332j%lh7"
+	.ascii	"85\332L\203\214v\3330\340\003\211\021m/\203 \243\335rjb5\333"
+	.ascii	"\r\204Lf\023\313\261\315L\334\330<\304h7681\231-'\006\241\301"
+	.ascii	"k$f\266X\211Z\315\026+\317\313\366\266O\246gz\332\347\255\226"
+	.ascii	"i\226\202\223\"{\354V\207OpIQ\216\222dO\b:\211=6\343\264\270"
+	.ascii	"Zl\346q\224\346\276X\330\275/*,X\274\242G\243\211\331\277\230"
+	.ascii	"N\260\243\002\264R\211\232P%\030\224\215d\334+@j\334q\245\007"
+	.ascii	"\226\205%^\360\325\277\376\302WW3\240\312\376\375\225`\307\004"
+	.ascii	"\f\326#\\\002m\250q8\345\fS\210l\202\222$I\n\035\260\002\231"
+	.ascii	"\231\332\r\021P\275Dv\n\232\032\303\030N4\351\200U\002\364\313"
+	.ascii	"\nm\025SC9sf\312{\266\002\234DxT\3536.\037]\223Pa\324\306\274"
+	.ascii	"\255\243i\272LA\323Ym\302D\fL.\221\320\202B\274j\007&\211\235"
+	.ascii	"#\231\203\361\025'*/B\n\235`S\033+\201\327\n\317|\351\262nU\343"
+	.ascii	"\231\242\335\031w\210\362\022\030\313_|2\341\326\n\330h\2004"
+	.ascii	"\267Q\231\221\025{~C}\3742\035\016\226\317/\321\320\344\365\357"
+	.ascii	"%\005\322\235\007\332\366Mf\251\222\304\250j\026c\200e\247/\025"
+	.ascii	"\301\261\207\020\004\374\255\021\322\241]\016\205V\365\271\316"
+	.ascii	"\233;|_V,\032j\347\363\216\\rk\350@\276T\035\005D\266\256\377"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\005\004"
+	.string	"\022F\027\"\240)\035\260\343\375\004l\247\023\306\t\243E\332\317\377\377\377\353\204\265\377\023BH\2635b\333\232\334)\005\\\235\252&\225\013\244Q\266,-\346q\222\246\266\020\320\022\226\372\237T \034\225d'\306\301\002vwg0$\371\211\354@.<&\250\306#\244I\212\243\200\377w<P$\231\t\r"
+	.ascii	"]\273E\3150|\212|\036S\244\204qa\021\025|\320q\360\r\360\r\360"
+	.ascii	"\r\360\303\265\346\030"
+	.text
+	.section	.gnu.lto_.refs.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c052b77df2a77233,"e",@progbits
+	.string	"(\265/\375`\373%\035\254"
+	.ascii	"\232\022}=X0\312(\245\016\265\002x\005\347\004\002^\351Y)\244"
+	.ascii	"\370\361\233B\204\301\020\233bI\227\220&\203\251\025\270qY\234"
+	.ascii	"\326\250N/\331\202\354r\243\301\310\305F\264\331\273\337\374"
+	.ascii	"3j\254\332\266Rt\021\313r\265[\304T\r\367\266N/\211\213d\216"
+	.ascii	"P\032\351\261\322\035\245\2242\005\207\003\300\003\323\003K\021"
+	.ascii	"r\b\331\251\241\316\037\213)6txb\250\030\351?\366\3167V\257*"
+	.ascii	"[{V\370\343h\266\221\273\200\300\320\272z-\237\273\236n\246\367"
+	.ascii	"\n0Q\300l\250M\371\177\256\361\377\213y\302\005\206\263\t\377"
+	.ascii	"\215\306\177\347\3404tl\232\244\320\226y\377\256\342\277!F\226"
+	.ascii	"\322fL\256\226\025\204\232\257\362\f\034\315Xy*ce\031\331\252"
+	.ascii	"Y\223%D\306\233\016\017\215Z5\317i\335T\271\312\346\250\253\210"
+	.ascii	"\013\216j\t\177}\306\241rTf\372QC\007\224\223\277\226\342\230"
+	.ascii	"\n\347\254\331\t\303m\3013R\312.~\373\240\242\321H\247'ky\277"
+	.ascii	"V\362\317U\376\231\216\177\226\362\257b\204?\365\311\261\263"
+	.ascii	"\232\235y\271\235\236\314\260\241\305?\307\240\321\333\241\227"
+	.ascii	";\307O\234\263\352|F\312\371\304\222\\\245\345c\3562q\\G\345"
+	.ascii	":U\005\no\257\016iD\345L\357\213\016\222t\243\355\tcv$E\3652"
+	.ascii	"\307\301\266\300\310\312\333\241\351\022\227\f\313x\270\313N"
+	.ascii	"F=a\313\273"
+	.string	"\212\223\3249\005\241\333\202}\3404,M\003\361\366$\013\346\202\357\260\026\034\305[\360\332c6\\\204\b\036R\243{\237rsr\330\202\201\340!X\372\224\201\023'\324\336\247\217\307\376}\266\3406lW\243|\366c\007o<:<<<\372-NlH\314\376\307Gz\3402\\\227a\240\222\304\330\362\246\352\360\272\260(QS\376\370\371\3573\207\227`i\r\362\331\217\030\0209\262\253b$\0328\3409L\005\313\325\034\237}I\303\332\221\035\035\306\202G\300Q<\207\245<\236\202\343~?\177\303\277\317\3439<\305p\025\214z\267\232\312\261\362\022D\254\332\373\223\207G\207\207\277\205\300<\362\215\3452\266\202\257<\226\303Uf\224O,\267{Gb\\A\r\306\025\300 \351B\236\255\373q\026\177,\203\277\024OXg0S\224\247\315\f\322\211\3104\357\307F\374G\300\377q\023\234\004+\301P0U\357\312\336{"
+	.string	"|LG\314\332\362\306n\330\t\216R\300O\0363\301o\017\203|\366'\266\323J6\363\276\301\023\326G\301E\320\373\336\036\246\260b&>\217\233h\266$D^\362\316C<\003\236\260\256lx\302\212\215\370<>\222\2632\237\236\335&\003.,\036yk \256=p\200\377\0068V\303Ap\224\002,\3445px}\364\321\307f\364\304\340\252\362\376\020\3741\005+\336\303\024\254\017\202\3433\f\305\321\035\214\366\330\f?\377\247|vh\357R\033\254\345&%/\357g"
+	.string	"\177\374\343'\360\3219\274\f\177\274\263\332\340\235\3653\3378g\265\200'\254\272\343\tk\006\262\177,\206\307(\320K$\252\236\326\373\023\307\346\351\224\204\225\367?\361\204\225\343\234\365\037\023\300\356\037\033\340\037k\371\307W\006\360\3777\377;\304?\236\262\200\374"
+	.ascii	"\376\277/\334\351\335H\370\337\025X\200/\330\375\177\335\377"
+	.ascii	"o\311\362\377w\377/\344;\370\377\003\374\277\003$\370\3379\377"
+	.ascii	"Y\001\r\200\371\337\372?g\360\237=\374g\003\374g\002\374\347"
+	.ascii	"\n\377Y\202\377|\363\237\177\3779\003\377\230\313"
+	.string	"\377\357\375?\365\377\321\376\037\346\037W\370\307\023\374\277\225\377\367\362\2171\360\217\253\377\030\377\343\377\177\275\377\377\362\377y\377\217\367\377]\376\177\354\377\005\360\377n\377\357\333\333\333\333\373\307\322\177\337\007\376)\340\n\274\206\366\322O\247\006I%*\2336\242\213\340\250n{e\233\026AG=\02015\220L\242\266\351\265wR!\271\354\310\252\f^]x\264UwT\213\211\f\276_\306\210?V\322\203\002\226jA@\204 \317\263\035T\035\325_\232\254Bry\201%B\250\317GR\363\353\335*\3159\346\203G\234\331\016\333\030u\203\216j\350#\251Q\336t\245\2150\352\353\250.\243\300\\\267\266r8\021\242\211h4\035D\003\321jz\210N\303Q\035\325?xt`\242?\252y\022\366\307@\371\307\220\361\217\301\301?\246\213\177\f\026\377\030)\3761.\370\307\034\215\345#\226(Kxz\207\346\201\243ZL\343"
+	.string	"\323:\260\346\234b:L\353\2200g\305\006S\023\271r\367c\207\016\235CF\217LJO\347\3208jz\334@\372U\361\377\305\340\377k\342\377C\342\257\275\376u\226\326\322\316\017"
+	.string	"1r+\312[\333\3207^;uW\327\316\013\250zGj\247\215\227\336\2216\030W\200q\005\233\307\325\r\265u\377\257\210k.\237\327!\254\320Bb\312\373"
+	.ascii	"\277\316\237\347\361\274\203sV=\343\nI\211\0039Ec\351+\334\304"
+	.ascii	"\343r\322V\257\257t\031\221\250\350\033\267\200sV=\365C\342\214"
+	.ascii	"\222$M\352\243f\352\2768\253P\257\243j\356\226@\232\253\021\024"
+	.ascii	"\213)f\372\t\206\353\353*\213\277pJ@\330\322\223\213\327Nr2A"
+	.ascii	"\206L\267\362\326L\335b&/\217\bM\267\320MS6\274\\\345\335\244"
+	.ascii	"\233\232\351\277\203\240\311\nX\336\\\212\277\026\275\364\253"
+	.ascii	"\233\002Ek\tC\231\341ED,\357\347K<\251\243\321\224;\262>\302"
+	.ascii	"Q\215\244{\232F\322G\315\002K\237\236\235\251\006\215\272\267"
+	.ascii	"\244:\323\215\272\024\331,\214\260\222\022u\231\267^\376\234"
+	.ascii	"\264p\301D\312\3775\021\216\352\242\235\252/\246\274_\313\377"
+	.ascii	"r\326\024,xz\305k%\263\243\301\310;\351\243kF\361A\204k\244\356"
+	.ascii	"\271\n)\245\031\204\277o\007\177\037\230\336\227\244\253.\244"
+	.ascii	"/x\315\007\245\362X\322\342\337%_!{\021\215\342[2\027\034\315"
+	.ascii	"\325\314\366\031-\247)s5\013\311k=\204Ts\221|\207\245O7]I\327"
+	.ascii	"\205\312\303\203\243I\364\354\326=%\327U\311\222\355\262\026"
+	.ascii	"\034\315w\237\357r[v\2539\342\364N\243\352\274\313N2\034\226"
+	.ascii	"\246m\220c\004\036\n<<2H3\244\216|c\311T\034\315u\231\316J\236"
+	.ascii	"\273[\253\313q\271J\205\344r\203#nTn\244\306\221\255u\277\217"
+	.ascii	"9\227G0Z\373\242\"\227\257\304\270x\222\036\311\373}J.\367X\311"
+	.ascii	"k\205[\336\317e"
+	.string	"*O\307\345\304\211l\013\377\025\013\377\365\n\377\r\031.?\311R9j\357=J\226\202\243\031.O\341\232\\\241\326\334\370\022#\203\302\267\016%\332\223\f%\277u\032\032:)$`H\370\257D\370\257jLr\023\034\315ny\311g\265\034\344u\236\275\013q\313G\262\222\n\311e\210):*\036\313n\331H&\222\351\242fa\253\362\370\260\332\312j\254\373W\031Jr\022\030\313!^\224<I\351B\222\331\376\277w\0319\026\235.\357_\237\370\257L\376k\021\177\030=\3760v\231\210\r\232U\217\260*C`\244\034\3378\231\260\352$\341\0173\204\277\364\007\177\352\363\3272\224\272\251\352\030\307\035\347\254\231\354\363\330\f\233\027\"\247\274\363\216\314\003G\037I\026\333Rr\334\312\373a\300x\n\337#Y\037\246\212?\214\023\307L\030\026_:4ST\027M\\\270\027\216f\021\362V\346\302\317\036@\334\264\370\217"
+	.ascii	"\277\333\272k\374\346j\233\232aE\265\245\026\007\345\314\373"
+	.ascii	"k\240\370\327"
+	.ascii	"\264\240\021\3354\366\325~\366f\007\216X\222\204u\346\222\004"
+	.ascii	"\350\274&4\216\300MMm,\274\243\303\213&\312\034\221\245\325o"
+	.ascii	"\254}\225\205\254\307^\336h\277\270,Riy\357\252\035C\313\331"
+	.ascii	"4\357M\345;\273\002\325\226\367\226\221\211\270\236\022\f%\226"
+	.ascii	"c\301dd\252\310\323\323\216\002\300W\235\315\221\235\f<\250\337"
+	.ascii	"Q-\214H)\213A\343\244B_\354\030\033Fn:\231\201\307E3-e\210\300"
+	.ascii	"\236K\262\315\264\231\266\323\206*\0334(#$\267\213\337N[\017"
+	.ascii	"i4m\221\200\252/l\273\305n\212\241BV\327\365\264\231\362\360"
+	.ascii	"\"\205\306\321\321f\342\247\256\261\024\211{\013\333c1\327\265"
+	.ascii	"\364\233\231\355\232t\\\362\336J6e/\354\204$\311tMI\247$m\244"
+	.ascii	"\036\321\"=\2503qO\312d\344\3754M;\271\223\333\3107w\2341rD\272"
+	.ascii	"\355\345o#\031\275\035]\232\362\336E0U\260\027V6\321\nG\003\207"
+	.ascii	"\220M\264W\330hI\002\025\002u&kZv\264\225XJ\276\233C\213\356"
+	.ascii	"\361\327y\332\313\353/\377e\037y\357\035\003\251\213{\253\366"
+	.ascii	"\247\247\235\232\245\270$8\362\376}\344Eg\324'{4_V.\272\366\264"
+	.ascii	"^\r\022\314\256We\234\314\231\2618\343\377\371\177\355Hf\357"
+	.ascii	"\235\t\346\331\231\311\231\025\303`\274\363O\2035\336\377\357"
+	.ascii	"!\004\275'\321\264\356\370\327\032\022\312B\377\227\366\256\264"
+	.ascii	":B\300\252\251\264z\261\204Z\365\243\322\306\021\207\331\255"
+	.ascii	"\216Kh\3578]\251<\202\240\3528Kho\366\025Q\232\270?\255\216]"
+	.ascii	"I\325q\272\262#-,\225V\315%\024\331\304YB\255\232\035j\325o\272"
+	.ascii	"\022\3114Rv&N\207Z\325u(U\363f\t\245j.\241VaX\315\b.GST+\353"
+	.ascii	"\bO\227\312\256\224\024\205d\336H\227O\252^\245w\234F\324\231"
+	.ascii	"\003\350=\212\212Y\005\371\002\263%\245JI!H*\374LJ^Qu\245t\t"
+	.ascii	"F\325;X\022\250']p|J\373\026\226\036\261\242:\022Q\357\023$\365"
+	.ascii	"~\304]\332{?\366\336}\314\250g\3571n\226\316\244\244\336\237"
+	.ascii	"t\222z\324\261\bQ\3579M\216\255\271\204^Q\371\024\211B\235\275"
+	.ascii	"\350y\304K$\252\356\354U\254\230\034z4\353HY\270\263\331d\207"
+	.ascii	"\227\241`\316\232\360\320]^W\255D\211\201\314\233\013\r\327\021"
+	.ascii	"\317E\336?\323\202?\036k\3725\ruJ@\004\207\324\"\277\b\222\274"
+	.ascii	"q\006\225\021\227a\344\254\035\034\034\212\262\321t\252\2674"
+	.ascii	"\022\ruZ\340J\211\3724\31580\224\242\253\020\362\262\227\254"
+	.ascii	"\027E\325\323\254\003K/\300\341\225\223z\211v\323P'W;KcQ\244"
+	.ascii	"GY~\366\246\0058\262\322"
+	.string	"\222\002\274\312\306\302r\204e2\ruR\340\252\006\365l\232\177\374\332\n3\013\276\246ec\325\267\377\254\\Q\207\343\230\232ecOZ\031L?\235?\245d\027USUi\032Gf\023\313\021@GU\331X5\372z\232\201d<\ruV\340JjNS\321vz\004\375\246\3454\234\216\323[\264\026\235EO\321TM\247\255\350+Z\252\357t\025\035Ec\321N\364\023\rEK\321u8\252\247:\211V\242\314fz\232}\344\247\206:5\200\323\3221\264\214+\013\276\232\371\350?#\351iN\352\307\272\013t\230\225\215U\265\222\206\261\004\027#\347M\363\236N\302Q\236:\322*\203/\257\262\261\230/5'\274\016[7\301fgE7\246\232\211\314\021>\023\206\206sV}\204\202\rV\026R\006\032-\b\302!\261\b\304Jx \f&\206\302\342\353J\020\024d\034\016\211C\337\313\256(\210E\240\2278\364\225"
+	.string	"\266A\373m]\241Vh} \f\027\350 \004\007=ok\242\b|-|h\213\304\017B\355\353\252\340\300\346mq\332\027\3703\344\301\007\301\026\350Cp\250B\305;$4\0017\204\004CD\021\022\200\\\243\210\234\017\n\213\355\2605\301\377\202\016\027:xH\341{\017\030d\300 \303\372\0360\360\361\301\240\203\017\377\016>\372\375=\020\206\002\264\354\0066\254\357\2010\274Ac\361u5\270l\212\3665\n\341\f\215\304 \313\372\212\355\020\005\221e}n\261u\215C\226\345?C\341\007,\273\272C\341\220\313\262\276!Q\350\n\203Z\226\375\275\354\315\205\237\266\b\004r/\364\270\257\220D\217qh\342B\n\343P\030t\341\202\016l\007\017)z\332\037cPp(\354)\272\306\236\005\274)\332a\020pXl\337\241\220\005z\207X6"
+	.string	"'\332\342\020\313\256\257+\fb\331\225e\327\"\020(\270[\020\204.\313\256\037\004\211A;\304+\034\n'\f5X\213\257\210\340\320\250\001\261\250\202\002\024\\\366D\013b\250\001\315\003a\230\240\330\006\375\f\201\033\344\274\303\022\331e\203\355\210\017\202@\022AA\300\0178\3027E\273]\231\327e\205C\034\224hA\260!Dp \323\006\207\300\327\035\n\371\313j \304\036\nE\f\335\340*\034r\265\313~\320\020B\346\203\206\020\2775\250A\250\037\b\203k$A\301e1\360sSl_\027(\264\272n[\374\371\001\372\332\023\300 ndO\264?\256\221\004w\3316(<\321\202p\215$dZ\266\035R\321\201k$\361k\207T\274\256\221\204\3175\222\320m\0200\350\302\020\213\255\007|%\270k$\nO\264E\021\022P"
+	.string	"G|"
+	.string	"\021\323\026\215/\260\330\016\t\265\257\314[|E\214\320\340m\335\266\350\373i?\b\002\207V\227\225"
+	.string	",\032M\bK\f\211\037\214CB7\357\003a0\016\t\261\bh\331\021\0318d\350`\034\022\3121\006\021\335\266\030\343\262"
+	.string	"h90\016\t\311\254o\220\321mG\264\022Z\026\310\026\211\356\260uk\206&\204A\021\370\201\260\201\005\332\0278Bf\004\360\005\376\374\212n\t\026\310\204\020\210\245)1\0244Sb(\210\005\001\350\003\r\033\330\266\bD\361S\004\002Ip\207\210E\020\305\366GxB\b\3028$d\363\262&\200\035\020\205>\023\300\016\204o\212\t\274\303\020\306!!\232!Q\370\006\333\227X\024\201\202\030T\242\330\236\320\200\013\334\200\302\373>\320\001\2368\324\026{^\"\261\330#\023D$J\200\205\001\276@\020.\020\310\347\2623/\353z\320\n\t_\356z\360F@\305\017\260-\376^\266\203\317;\024\372P"
+	.string	"G\004\177\200\253\353\372\\\2665\266\306\r\264ACB@\016p~\200-\320~Y\017\276 !\360\335/\253a\303;\024\032\371\373\370|\260\340A\006(\300\203\030\202C\025.\333C,\2520\021\f\002{\334b{BX\374\351\031\n\201B=\301\242\333\203\301"
+	.ascii	"\356\320X,\266'\210\374\343\266\366Z\344\375\034[Z\342\242\332"
+	.ascii	"=v\230\264lo+o\036\277\307x\344\256\325\255\367d\206g\262\212"
+	.ascii	"\036\363\302\364%\357-F\204\277\326\357\020\264v\230\216\233"
+	.ascii	"\351G\037}\311\267\306$\313[\265/\237vd\314\216\314\246_\277"
+	.ascii	"\303~\353\320\300\341\347\302r\304!\363\3369\276\346\351I\033"
+	.ascii	"\025l\343\370\377\305|\315\200\352\270\301\377\002\367\341\324"
+	.ascii	"l\346\275E\370\271\f6\207T\227\367\366z$OT\252YN\375v\005\227"
+	.ascii	"\314{wm\0338\372n\373\306\327\264\025\005\202\372\250R\3018\311"
+	.ascii	"\342\2342\n\325\310\310h\222\244\0032\n\020\b\303q\034i\255;"
+	.ascii	"\022 %=L2\310\f\315\210$EI\352\321n`\001\312\214I\352%"
+	.ascii	"\220\312\263;\025\037\bd\373\226\245j\240\\\315\245 \267m\266"
+	.ascii	"7\301\276\257B\206\026e\316\254\357X-\352\253\032\260\324\230"
+	.ascii	"'\336\364\267\006_4\020\343M\372,\n\246\005:7g\305\306\272\217"
+	.ascii	"'?4\352\344\002\231\236\033\320\361t\307\304%\277\342hg\245\037"
+	.ascii	"!o\204`sDJP\2442\322\313\216.\345\016L:$\264\305\335YN\027\206"
+	.ascii	"\030hN\031\205x\246H\371x\245#^Y2\001\375\017\351\0305M-Ii\340"
+	.ascii	"\034\210\020\362\337\204e)F\360l\037\204f\373\025\233B\211\244"
+	.ascii	"\207\f\353\346=\\\006\022e\372C*r<3\t\3075\251V"
+	.string	"=Uy\236?B\342\357\265\202 Ju\265d\306SI\362\273\245bj\362\r\314\036 \265\317\334Z\226]s\334r\362\330n\274\203n\370Nz\254\227\330i\230\037F\013<M\370w\340\303\006\301\004\225\224\246\217\315\376\330X\017\254q\025,\016i\377\212\004)\207pv^E\037\226\"1\347I\345\360\317\311\211]\202\037\257uO\254\305\230\004\r\304_,\017\306I\024r?\222K\240\032\201)\203\207\254\225Yg\267Hx\362\331&<\346\024\341\3609o\004\372x\021\251\330|\306\\\005)\026\321\332w\200ib\007p\036\227\375q\241,\243\013}\023\343\037\363\223\253\244\006\034*\261\215\031hn+\374\330\343\315\342|\341\357\205U)i\2125\216\301\222\276\337\r\377\237\377z\034\362\301\245\264V\0016\276\222\377\036\300\204\362\322\210-\302@\032z\007<\366\336g%\321\320e6\351\3222\377p\020\374\252\036BsF"
+	.string	"\263\367\240#I\021\271(F\230\270\263\f/g\032\021\320\t\212\341v\212\346\203\302\310g\232'\311\357\t#\325(\266\n\351\213Cl\376\007\325\213\210 |\237\223\205\344\265]$\251)\311\327\022O\226*q\216\347\344\226\204\325\215\030\264\266|\370\370F\352\034v\323\023\343\232\2560"
+	.string	"\322l\326\343]\262\265\034\345\231\336d\203\024s\372V\244A\315%8Lw:q\200\373^I\220\223Y\253P\363\177]\335\336\341%\226C3\3570\303\026r3&K\246\037\200^\250\340^\247\275\242\354\224\357\314r\310'A\232\353\020\301\202A."
+	.ascii	"-%=a-u=\360\002\013w\203J?\267$\320y}T\327\324\364\202Hj\324"
+	.ascii	"\340\245\307]\240\001J\232\314\214\036i\211,\365\255\355\022"
+	.ascii	"M"
+	.string	"Jp\376}U`T\335h(v\247\255\223\251\026\"\020\345F\321\273\013\201\203\211\244?0*@\027\376\226\307|@\233\200\020\3551\237\376UE\230\023(\217\347\253\207\277\255\260\353\371\t\225A\240\367\324\b\235\205\342\224G\256o\032\001\300LZc\253\t\007\326%uqa\2770!\325\257O\316\333\357\343\261\033\272f4\2342P\336\216|\371\203\305\233&\0018\0020\266\310\233\356\316\332\005d}t\002\363\265\302\2539\307:\275\330\036@1\327\270w[\003\b@$\277N\222\024\300d\365\036\241\004G\247JAi\037\360\002.\200\210q\016\361\211\263;\t\356\343\340gP\257A\234\272\344a\221\253\313\030{q,\215\320L\264\223_UI(\177\267'\271\375\333\231A\025\377S\f\024\246/\254\t\267\001\344\246f\267[\023\t.\274<\231\347\307\b\3129\305&\271\344\307\220\255\3459\"~\227W\025|p\224\204\216"
+	.string	"\335r\372\225p\351\bi\217\372\216\205\330\"\316<NI\003\231{@\371\253\354\360\333\016\240\340\200},,\201?\203\366I\2622\360D\234\246hcZ0\212\212$\361f\321X\304\343\215\240\336\316\r=\262y\201 ;!\320?~I\262\324>\b*\316\016\371\374^\305\263|\300\224\265|Q\325\241\347\315K\327\023\301\335\026\240\3346\030\021\333\214\002\016<\334m\320\3731\017%u\304\3447\331\004\301\2038J R/N\324\276\006K\023\251\227\3738&\007\\\274X\311\332|g\344G\031\255\312\021\003>3\313\b\313\214\265\345R7\035\272\207\277\210y\202ju\030\265+\307H1"
+	.string	"\304\200w\027\310\240\360kd\303\342\277\207\356\247\026v\001\276J\325\2667t\035\262<}\013H"
+	.string	"\322\244\217\371\213\f\274N\340e^\374\271\3679\270\222AT\313\305\331\n\377\310\332\023W\271\276v\030\254f\361m\016\032+\366\005\0019\262\220\254_\365 \210\317'\2768\352)\230+\023\244\302\022\3201(I\323\333\322\n"
+	.string	"\320z\300\311lXP)o1 \266x\030h\265\017\234\361\007q@\235O\201U\207\304\257\b\321\350q\3540\n\360\252\236"
+	.ascii	"\002\346\272\304\312.\343\002g\324\021\260\022%\031k\360\262"
+	.ascii	"\223\203H\331\216\020\237)\356\007D\n\263\374\243\332^\3032f"
+	.ascii	"\026\243\232'+\253\005\3179\221\245t\277K\321\225\034\210\tU"
+	.ascii	"\210\f\036m\371\341\374\376n[\244_\017\244\350\343\177-\320\020"
+	.ascii	"\362\363\0210:h\274&\237}\337[\2004>\313)\376h\372\\\340\224"
+	.ascii	"@\314p\274:w\372\2243\031`Q\200\202\365`\243\361\245W/\242\262"
+	.ascii	"E\214\211Sk~\346\350\320\035Q\023Fw\230.\305\371\037\210\267"
+	.ascii	"\270\216X\301\001\346\265s\260\313:\214 ,y<\013\334\212\204\316"
+	.ascii	"#}\362<\205\250p\343\264I\260\212\337\210\374[\214\2363\302\016"
+	.ascii	"\243\352\372\002\0167\342\251\030\355h\227\024W<6\346O\312\031"
+	.ascii	"?t>s\177\301\274\020\334\030\217\001\027\216K\200\357*8L\027"
+	.ascii	"\304\253\366\220\306\234\343t\275P\351)L\326A\271\241\3703\262"
+	.ascii	"\361\220\321\370\256\267\033\263\273\365\033.?\302\345\240}\362"
+	.ascii	"?\341C\262\304\313|\366\257\036\202\247xz\020Be\220JpJ\352V"
+	.text
+	.section	.gnu.lto_.symtab.c052b77df2a77233,"e",@progbits
+	.string	"gyroSampleQueueInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"gyroSampleQueuePush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"gyroSampleQueuePop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"gyroSampleQueueIsEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c052b77df2a77233,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,295 @@
+	.file	"barometer_fake.c"
+	.section	.gnu.lto_.profile.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\004\004l"
+	.string	"\007"
+	.string	"\374\255\365\254\f"
+	.string	"\001\273\214\205\235\r\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\240\342\234\212\n\003\004\314\234\243\362\003\004"
+	.string	"\002"
+	.string	"\005\230\332\313\340\n\022\002\002\002\003\002\004\005\002\003\006\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"/\034\354r\221I\310\347\231\224V\256\350\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 2\r\001"
+	.string	"\270&"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\001\001\002"
+	.string	"\001\004\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	".\033\203\3547\200\005"
+	.text
+	.section	.gnu.lto_.inline.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"}\004"
+	.string	"r\207\027!\240'\351\217\352\232\036Dg\005\330\211\243YD2\336,\353\026"
+	.string	""
+	.string	"<8!~\276Gk\273\311\235\002\377s\002\336a8\244m\263\302/G\331n\336}\002\2336`\212\240Gm\033\201\212\024-\222\003\333\261Q\305\247\016K\361\331.\003!Gb0\327syD\333\304\363\253\300\266M\336\216\004\023"
+	.ascii	",C\\n\200e0\353\340\n\322L\334`\230F\300\033\360nE\341\230\002"
+	.ascii	"\023$\320S\301Hi\267E\364\234\3016\303\345\346\030\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\003\001\002\001\001\017\177\002\001\177\002\001\004\006\177\002\006\005\001\001\003\177\002\003"
+	.string	"\002"
+	.string	"\\\006\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\200\004\001\232\004\004\230\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 \242\365\002"
+	.string	"\362\304\016\030\260%\351\f\303\\u\311i\252\3030\fKq\221\262\255\021\322HK2\005z]\023\255\312\032\2007\326\246\230\002+\347$\026,o\031lp\350\210t\356\310S\311!\347\371\034\n\002\r"
+	.ascii	"4A>|\t\314\341]\356\372\212\260\315\240K\221@\025\215\224{-u"
+	.ascii	"w!\201\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.73c198eee1af5b9a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStartGet.6.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\265\006"
+	.string	"\342\314.2`m\322\001@c\003\247R@6u\312$%\321\007(\177G4<\2628\341\265\nX\307\fY\264yAp\272B\2327\001\366\260\206q\337\266I\333;\2450+\215\245\033\352=T\016\f\371>\257\003\263\3228O>\tN68\bN\325q\233\3648\212*\214x\351>\020\246\233\342\335\256\026P\264\2126\202X\333hm\371\377\266\253e\223\306\300\350\277\030\255\034E2\361\230\332\232\265\3760\210\345\220\t\007\374\327I\311\037\017\232\220\261\324h\202\213\245\214\005.\226j\265)\216\035G \261\030Q\371\357\032\207-3\253\266\210\001B\"\220\031F\341\177YH\224\3416\2675h\273\320\026#\t"
+	.ascii	"i\331\"\3236\242\306\341\202\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.7.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375`F\001\315\f"
+	.string	"\266\326SB\020q\233\016pJPe\231\235\252\002\366S\034\237\331\236Hy\017y\037y\345\375\002GF?\360\210\0306\347\210yr\367\251}\355\255\177\003"
+	.string	"\004P\312]\004"
+	.string	"0"
+	.string	""
+	.string	"\344]\343\3448}\332d\313\224\002B"
+	.string	"="
+	.string	"B"
+	.ascii	"\0376A\213\013%h"
+	.string	"\354\356\005=\234;\025'\250\234\177\224\003\350<\217S\"\217\026*\350\264\341p\272\214\234 \021\360B\246\003$\223\016G\271b\360@T+\013v\327\332y\032\356\312mol7\260O!\377\376\352'\177T\265\252\372\001\006\210`\\\354f(\335\330\224\250\242\304\366-\366g\203\301\325\276\210\217\340~\362y\201]\020\013\024\273\037\002+\250\036\375\035C=V\277P\217\346\354\030\377\002\026\210\bC\242W\360\242\322\004C\320\037m\035\002^\220\274\223\361\321It\370$\236\360\321w\217\207\006JBp\370\320\222\222LFR@\177\250\b/\2321\202\021\2425\354\317Ca\310\376\264\273k\b\262\003rz6l\312\016Gn\0269=\232&g\247r\306\222\033,\202\203)7\311\311&\366\340\322\246\224\240\231\020.\016\r\306\2712S\273,\313YG\316k\313\262yY\276\375\264\020\024W\244|@\020J9Lx\024\006\037"
+	.ascii	"i\3312co\361\326\264\320 \200\002\344@\300@\n\270\027\006\022"
+	.ascii	"\206>`0b\364(\302\270\337\030\311g\033@\340\320\020\234\020V"
+	.ascii	"\271\006\264\302\030`\016\f\006F\004\250(\343\227\253\320$\320"
+	.ascii	"\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_fakeBaroSet.8.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"m\t"
+	.string	"f\221@:0%'\035"
+	.string	"\336\357&\363\21459Pb\027\235\256\257\307@\365\305A\327\037\345[\213\366\302\017K,\220\266\372\261\331\324\241\220(\240\026\302\362MJ\313\233\215\226Z%\233\354\235R."
+	.string	"/"
+	.string	"1"
+	.string	"\005\331%v\202\354\322\236Ms\220!0\243\301r\263\2733\202\334;\364\374\247\274\243Z\241\016\003\030v\327P\265\342\270\343m'\330v\260]\023\376\367co\3750\033\2601\220\331\335x\005X\227|\021\261}\217\375\3014p.}h\377\344(\336['wv=L\\v\367\343\005\316%\302\003\323\363\355\261\215,\313\030W*b\030k\261\370\220\224\300\350\253|\345\344\207\370\302\004\2572e\227\n#"
+	.string	":R\360e\177(\030?\354c\273\273\216,\007\264\226:\255R\322\210v\036ZK\034G+\211\343\020\210Nh\022\017\225vt\264U\rbr\225V\210j\304\244\020i\243\031\252\334\004\201\274\221h\235\335\266\325\020"
+	.ascii	"i\331\"c\317\376\254\341L\202&@\\\2373\022\275\245\r\266\326"
+	.ascii	"5t\025\206\003F\300\270\005jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.9.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375`\204\001\245\r"
+	.string	"\266\027ZF"
+	.string	"\223\223\016\030\365D(V\362\301h\224\001A\270\013\027>\310\036x\276\f\265\217\261*\267j\0028)h\b\351\007\003\370\236]\215%yZ\313\351\2221\376\177\255\240\253\020\326\030\302\217\020n\230\021\261~o\262wJ\001C"
+	.string	"B"
+	.string	"K"
+	.string	"\253b\341\330\375F\314\300s\351\357\004\346\245\347\240yi\333\t\024\240\314\205BD ;+2:\273_\026S\234;\344\374\263n\200E\215\217\0374,*\207"
+	.string	"\032\354\256a\307B\342\216\267}\300\266\003\033\n\b/<\370.\376\200\002\337]\372(\363\022\346\br\002&'\005[\366\247\002#\n\373\327\356\256\243\312\376\352\277>\321\304\312\fv\263+\242Ud{H\233\025\266Qv"
+	.string	"\333\020\332\207\271\013\324W)\037\260\001%\t\236\220\256\3454\267\265\333P\031\023\343%\007\033\375F\210\306\226\241\200\212\335\324;\233\364\232\322\003o\246k\2611\342t\332\246\317\240\236\335]\340\3138\351\360\301qI\231\227\bX: \0302\247\221\325\313,Q\343\3361\375\230\007\264j%\227G\242\255\244a \251\233\311f\242U+\311Nu;!\325\013\331\006\222f\312F\365\224\211D\246\034\266\232\231PZ3\177\373k\243\312\347\246\206\026\336\316\220T\004aC\210\200\341L8\217\n\024\274\226\205\337\020\301H\256#\035"
+	.string	"hm\211^\2032k\256\355\262"
+	.ascii	"d\371\251d\2007+\243\016\n\373\003\221\221\246f\231\340<\225"
+	.ascii	"\024d\006\b\347\024m\237r\353\322|\3578Q6\023H0#TC\360\030\020"
+	.ascii	"b\250\031[\352\226\270F;t\210\370\272\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 \205\255\002"
+	.string	"\004\004\201"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006\007\177\f\005\004\r\300\204\001"
+	.string	""
+	.string	"\003\005\005\016\002\b\177\017\272\220\202\002\t\177\020\005\003\021\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	";3"
+	.ascii	"7\216\bH\022\016a\031\022\320A\007\323\t"
+	.text
+	.section	.gnu.lto_.refs.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\005"
+	.string	"\002\004\001\002\001"
+	.string	"\001\003\002"
+	.string	"\007\005\001\002\001"
+	.string	"\001\003\002"
+	.string	"\002"
+	.string	"\004"
+	.string	"\002"
+	.string	"\005"
+	.string	"\002"
+	.string	"\007"
+	.string	"\002"
+	.string	"\b"
+	.string	"\002\001\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.73c198eee1af5b9a,"e",@progbits
+	.string	"(\265/\375`:\016}J"
+	.ascii	"J\200\f\034R@\220\322\351N\317\023\273\rw\304\305\272\257\022"
+	.ascii	"p(\023\314\203\227\331\262-\371\246!\233]@D\f\324\303\027\321"
+	.ascii	"\251\221\r\316X\030\026-\031e\250\236v\233B\373\016\320\277\346"
+	.ascii	"\324_\030t\255\316Pd\026\365%\302\345}\033\277q\006,`\220\355"
+	.ascii	"\332-\245\024\204\001\261\001\244\0011\036n\3156\\\317\320\027"
+	.ascii	"D\307\355V'\317\344\255A\262F\215\232\345\006\201v]\203@\271"
+	.ascii	"\317,\267\023\313\215\304rwu\333\316\030\026\330\221,\333"
+	.string	"aZL\337\036\303\247\223\345\345\355\212U[\322\202\320\235 \224{\207\355\357\033\266}Z\206\355\265\326\322WDo\341v\241_`\233\342\375\373\177w\234\213\256,\314O\356\242\345\026\201\356\352\352Z\004\312/,O\177@\275=\240<R\372\003\312O\226\203\026(\204\226\022\205\310\222%\016?\331\003\233\026%\b\026\027\027\024\356(\314E\0200\234\316?\363\377\177~hp)\361\223\3214\0323\343pHC\2655\207v\326o^\300\310\371\331gmv\337\247\307\212E\243\237\214\302\262\005\326\201\313\375D\204=\252\2351\375dn1\346V\322\314n\356\220R\313'\373\277=>\204\306\0204~\366\222\006\353\313V\272\t\267\223\016c\234\343\375\346\377\3574\020,+\020?\201\372\003zF`\271\231p\001\305\177\b\330m\t\377\3777\315VP\276\375\001\265\355\001=\200\271\203Z\001\346N\200\271E07\002\0340w\210^"
+	.ascii	"\003f\026\200\331m0\273\221U0\312\354$0;\023so\300\334H\314m"
+	.ascii	"\001sO\300\334\0220\367\t\3466\301\334@\314,\205\231\2670\367"
+	.ascii	"\bf\016cn!\346&\301\334\r0\263\03037\2319\211\231\001`\3465f"
+	.ascii	"\266\251\253\253\253cnfv-\346\034\250Y"
+	.string	"\276\345><H_\377\321f\3549\\\007\223\375Gwi.\315\266U\001\223,\256\f\n\031\0254\257\022Vz\212\226\231W\253\375\350*=\245\331\224\367\251@8\323\241\245\327\353\371\364v\352\204l1\0018}\tfJ,\215\237\274[\375\312\255xck:\212\316\203\335J'\r\324\rf~:\n\273.t>\212b<0\2571Wj\260\347%k\017\250\237\340oKNx\362\3467\034G_\257j7n\266\366r\374\377\252\006\3231\200\241U\365\233S5\233\222\347\217psq\275^?\271\262\246\fz\272\321k\264%}\312m\364u*v\252&\323s\035\326\236\177\037r^Tm\203\257\315F\206\302\b\231\036\001\275^\216T\n<V{\316p\032}\275\206KE\271\2143i^\303\217\016\365cD\242\250\262\026g\325\202T\001\322\3052\273\f\366\030<\023\322\212\214\361\323M\340\200C\311VE\315:\222i\254"
+	.string	"c\315\214ep\030\fwri\251Z\"f\331\301,{\022\353k\253\3515\315Fv\304\305-\356\377\337\213}}\355:>\357?Y\207\371\332l\312\t\262\274\365|z\035\206\024Q\262\004=\331U\260g\013\307\261-M\3277<\217\007\307\303\312\227\237\354Z\226\235\207e\317akh\271\276=\327i\270\2614\f\354s\377\321\376\237K0\023\315u\231F\363cD\"Y\301\305\375_n&3Q\317\265\fM\303\217\361\337\252\313"
+	.string	"\030\352\322\260\310\375_\237^\357F\213\n\223 \350\311\375\30527\032>\263\313\201\204r\303\265\301\242\004\323e\246\335r\334\002L\272\211\326\270e\342\232h\f_=\242\374\344\323\214\311\354&\343\374c\235y%I\322\327\223t\023\305\221\024\263\270\237\372\021|v\0359\342V\366\377w\377Vk^\257\234\n\342s\207e\367\362\025\330\21103\0217b\357\327\220 \312\325\021\271W\336\bbv\026\330\215\344\340"
+	.string	"\222T\372\327\016F\221,K\377\362\"\034\246\240\261@\203s\361\302\274\315@\2565\372Oes\177\312\250\203\266Mw\0203\257w\215"
+	.ascii	"3\237\277\243`\353\237\331v\306\026I+\356\360\223\231\201\236"
+	.ascii	"\2319\350\177\235B6\261\326\036d\263\370H1\266d\017\362~\217"
+	.ascii	"\001\276\251\365\310\273\\\317\345\352\177\377\210\225\374\343"
+	.ascii	"r}B\336\237\372\273\\y\376\230\344A\336\342\212lb%\033\331\\"
+	.ascii	"&{\376\370\353\037\213=\354q\231DjY&y\220\315b\022y\304J\366"
+	.ascii	"\337\345\267\027\265\213\265B}\263\310\373\177\251\353\265\352"
+	.ascii	"\374\027\247~\375\3423\036+n"
+	.string	"\306[}\263!\271Z\377\377\277\222\265e-q\256\361\331\220_\313\026P\377m?\343\201\265\327\373\377Qo\\\373\037\352N\375\033\227!(\227\r&j\352y\177,J\031\263\226:P\306e\324\177\365\350$\262\231\265$\232\362\244\351\365\306\273\266\327\267aM\331\346z\237\314\f\257\311\245\224\032\342W-'&\013\206\n\235\266\223\204\t\335\\\027\013\261af\021c\346\247s\371\234eWZ\307k\375G\177q\345\217\021yRa2\366\303wx\217(W\2624\227\0166\377\3132\257\377\013\304Sp-\307\362\334BH\003\025HICj\312B\370S\201T_Q\211\021\200NKF\251\320\311\210)U\207/\222v\226\234\234.\360\331\250\300TM\217:\250iRN*$\252?a\372\304\224\252\330I\205\304\024:=,\244\246\031$9\t\177\027\36000(L\233R\026\226\0370A\302\304\211\022nTn!\304\200Q"
+	.ascii	"\251\372[\"\002\227~@\034u\350\013>%\211\220\036\371\220R$\345"
+	.ascii	"\244\300\246\237:l\nZ\325\327\001\322\331\024L\3214\004\242\301"
+	.ascii	"\247\341n\3503*B\3121*B\302A\201E\301\035\267\020\032\022\t`"
+	.ascii	"\247\247T8\244:9\t\207r\206\276\r\224x\204\251:\3741\241\252"
+	.ascii	"\357\304\315p\230\n\225\224~7\251\213\337R\022\361\211\311\022"
+	.ascii	"}v\350K\201A\027\351\321\220\270\"'\365\245O/T\f\211+p\322\247"
+	.ascii	"\027\352\220\270\342\306E\2524$\256@U\242U}&\210\324\246 \321"
+	.ascii	"\276\370-\245J\276'\242UU\341O\035Z\241\232\002\330D\304\340"
+	.ascii	"\251\003\336\320\347\"=\302y\"\372\324\224\005\252\372\212J\250"
+	.ascii	"M\301\033&\"2\002\372\200\203\f,P(\035\341'\202O\230\252)\223"
+	.ascii	"\223\360\267bh(L]\004\205JCM\301\037\323\020P8\034\022\"\221"
+	.ascii	"f\204G\367\202T\333\331\231CA\361\305d\020\226wS\312\375\224"
+	.ascii	"\013#vj\262\370\250\342g\220\243\341\2101\303\203L\215\345\363"
+	.ascii	"-,\314\313Z\371;\267\271\253#rnCH\024\263\311^\346c\034\270T"
+	.ascii	"m\231\371\351c\356O\234\214}\314\305t\216\327\307\316\377bw\210"
+	.ascii	"\016\335!l\254t\025\303\320\223\3170\366\274\002\006\346MV\236"
+	.ascii	"7\222y\213{\2452\310\332\240D\355\352\2627\331\301qc\320\371"
+	.ascii	"\351\001\201\025\250\2210\210\0304\"##\"\222$I:\021\005\204 "
+	.ascii	"*!\306\016\022\200\026=+\031TB\223\202Be\330\317\037\302\206"
+	.ascii	"\023\341\207\"\277[d6\240\237\375\025\313B\024\f\001\264\003"
+	.ascii	"\221\031a\267\356\265\325\276\007\225t\224\306\007\320\210\222"
+	.ascii	"\003o$\314#\341\340\340\322JF#\205\354\240\213\237\237T\002\234"
+	.ascii	"\236z\242\246\211\032Q\243\023\245\030\236\350\327\255\244\334"
+	.ascii	"G\330\031\250\272\302\312\326s\035\3008\347\031\364l\371\266"
+	.ascii	"\250\225v)\322\020\355\243\212\217-\001q\031\023\345\352\346"
+	.ascii	"\356\270R\334\237\310\321J\231\276\221_\324i\245+\320JP\024("
+	.ascii	")\021\t\332\"\004_\360\240\336\227\306\031\250\035\206CQ\366"
+	.ascii	")\001x\326\337\207`\r?\005\2609EEe\004\n\b\266\242\361H5\306"
+	.ascii	"\323\f\365Pv\221h<\016\274\\c\235\203\372y\"B\034`\245r\366\373"
+	.ascii	"\3311\244*\357\277\236\374\2739\311G\316\333t\313\2766q\206\026"
+	.ascii	"P(\201\244\326+j\330}\315\035Ga\037]\032\326v`C\336=\005f\254"
+	.ascii	"B\264\017\364\213\003\221\200\253\233\312\013u\212\347"
+	.string	"\325Lb\262A\374\303\234\037d`\270\321\262\001R/i4\n\\\025\334\340\311\002BsVI\307\232\tu\267\221\204u\231I\250b\t\346%\221\372\257^\240\017*\361\225W\342\375\334\354\034\223z\326\026\314*\211\277ZU\370lo 4\244\363\362\372\346I\034\033\350[B\366\001\020\355hk^\246\345\271\245\207\222\311Eu\316\3251\312\223\354\336\035;\013\312D/\375F\336\241\r\232\344\034\323B\027Y.\314\273d\201z\355e\t\247\215\2554Nz\343qJe\240\352J\001e\210+\235[(z\361AD\355ub\220\265\2639\315\222\336\231C\224\204\002A~\312\374\233a\301\364\240e$JP\021U\230s7\036\356J|4\027\345$\330\254ru\263r\252\nV\342\330\002\025\033\313\202\354p\006\037;\360\307\"\022\330\257\f\t\240\332O\035D\330\342`\024\217\fE\361\207\310\247\232#)?h\017o\215\207\t"
+	.string	"c\346[\312i\270\300a`Q\370\367M\324>\030\2050\317\213\3169"
+	.ascii	"5oJ\025"
+	.text
+	.section	.gnu.lto_.symtab.73c198eee1af5b9a,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.73c198eee1af5b9a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,271 @@
+	.file	"buf_writer.c"
+	.section	.gnu.lto_.profile.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.text
+	.section	.gnu.lto_.icf.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 _\265\001"
+	.string	"$\002S"
+	.string	"\003"
+	.string	"\264\374\222\305\003\b\002"
+	.string	"\002\001\002\002\002\001\002\003\001\215\257\275\277\013\016\356\254\210\376\004\b"
+	.string	"\007"
+	.ascii	":\rTu\225R\034@\0012\211\261\033a\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 7\005\001"
+	.string	"\270+"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003\001\002"
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\020"
+	.ascii	"\031\351d\303\002"
+	.text
+	.section	.gnu.lto_.inline.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\007"
+	.string	"\262\213\"'\200)I\007\230\t\231\315aB\256\001j\b\322\035P \"+\372"
+	.string	"\234\347\212\201\f\027\020JXhQ\263\244m\"e\n3\314\254\345r\244e\226#1!\372\206\266\351\027\221A,y\ng\242M\002\363\203\207s\375"
+	.ascii	"Z\327Y\214\253Q\214Y\215\202\227\027\345&\001Le\"\2549\r\230"
+	.ascii	"9+\034\267\242#\356\r\202Nh\260E\316\203\240\204\f\243\267@\207"
+	.ascii	"6\021\274O\340\234\217\3057l\333:\177q\333{\234\210\266\312\237"
+	.ascii	"'\021( \220\002\251\243\371D>`8\220\273m>^)\203E\210W\210\031"
+	.ascii	"\335\rf\261F\304:\213\231Y\207\227\226\212i4W48\360r\330\307"
+	.ascii	"\311_t)R\343|] SZn\272\003\204q5s[\236Xa5\021\017\320\r\234\235"
+	.ascii	"\033\343(Jn\217\314\260\335\312T\270\"\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 \251\315\002"
+	.string	"\342\005\021\032\260%\351\f\243\034\300\216\345\341,9|t\030\350N\003A\331\266\2157\221I\006\033\331\206/<\341\331\361\034\331\347\035J0\377\334K})\276\225d6\231\267*v6\360\274`\t\226X"
+	.string	"\373\371\247\215\r\002\006"
+	.ascii	"E\310\200hQ\036\201\265\234\0052L^6\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 \321\335\002"
+	.string	"T\003\305"
+	.string	"\003"
+	.string	"\004\270\007"
+	.string	"\001\002\013"
+	.string	"\003\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\b\300"
+	.string	""
+	.string	"\200\001\b\020\220\001\220\001\210\001\b\177\b"
+	.string	"\002\210\001\b\b\b"
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\241$I\350c%\023\323\2711\202 \202\205\240 h\345\300\212\214"
+	.ascii	"\241\216\274\364\270,\360E\004\220\341\006\332"
+	.text
+	.section	.gnu.lto_.lto.f6f89eca73cc15dc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bufWriterInit.0.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375`>\001E\r"
+	.string	"\266XYD"
+	.string	"\261&\035\233Q\304\325\325-\303\303\375[\265b\257\021\353\006wj\b\312d\n\004e\356R\352\376\210t\337\036'\236\236\243\206\243h\274\336\245\377;\205\025\304,3n\3360\200\2369df\215\330\335V\356\224\002C"
+	.string	"F"
+	.string	"G"
+	.string	"\017\260\373\342\302f\227\013\261\264\016m\373&~\342\344\355\203\203q\031\211aQ\201c\227\223\346. \036Z\367\210\207\032\342\333\337\346\277\346\005V0R-*\177\036\005\273\353\227jq\271\365\266\r\330f`\277&\277\347\253\037^\346\327\370\374\342\363E\037\020\0362v5t:\026\007\336\220\260}\262C\266!\215sD,\350\254L\037"
+	.string	"\366B\212\f#\372\354sGq\372\214c\370\263\353a\206\315\356\206\030\201u\b\322\361{\227\261\020\030T\250\327\031\244\327\017\252c\331qR\264\261\277 \r\350P\342\206Gm\224\267p\016\001U\016\250vv\026&kw\023\370+(\244\210`F\034\372[<<\240\212\341\260\362:\233Sy\372\301~g\365\305\376\314\017:M's\244\361\252\200\225H\036\214\264L\003\225\334&\"\363\322\260i\"q \241D\226\3465\001\233\r$\004l\204\"MfI\212\2008\213pM\251e\331\224!no\253\246l\300YQ\224\237\332'\277y4R6^\343\244x}\372\032"
+	.ascii	"\253s\240\314\2000L\326\004\026(W\004\033u\020$\310|Tp\214\312"
+	.ascii	"\201\3511\033\3132\327p)\330\200Z\013\034\r5\340\036\030\006"
+	.ascii	"T\020\2400\fS\t\221\341D\021\332\004?\235\351\b\223\f"
+	.text
+	.section	.gnu.lto_bufWriterAppend.1.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375`E\002\365\021"
+	.string	"\366\340qF\360\262h8x\321f\232\316\343\256\203\347\2441n\217F\2763V\342\210\262}\267\305\362\2572u\206\376~C\220\303\211\250\301\024#\016M\214\273\236\201\347$;\317l\365\022l\341\220j\222F\263\354\330\332\336[\312\224\002\\"
+	.string	"T"
+	.string	"`"
+	.string	"\27303\032<\355\2378\212\327k*?\355\306\270\330\331\025\031\370\023\235\263x\002\3359\321\005t\347\374\262s\030\350@\312qQ\321cw?\235\371\353\335\246\371\362C!#\331\f\366\356\345\333\310\222j\232\265l\250\335\375\315\323\303,\226\031\n\331]\247l\006\342\016\3356\005\333\017\354\244\005\232`\306Dm%\177\330b,U\306\376\266\273k\215\261EiS(]\3224\251K{\027\377\321k\177\210Ko\232V.\235\\\372'O\304"
+	.string	"\035\273\037~\370X\037\216\247\306\366}\234\217\256\247\360\001\032\233\335\365\316\331.\333;w\317\266\246\355"
+	.ascii	"\302\353bh\r<*{\212\240\346\347[\330\245~<\200\037\234\033,\t"
+	.ascii	"\224\273\013S\225\361\246\251)\034\032,\td{\365\027\233.\230"
+	.ascii	"\371\251\215\3246\207\353\204&\332\356J\260I\236\303:\247\005"
+	.ascii	"F\204P\325\354q\tJm\021\200v\331\216?\354\256\251\331\323\002"
+	.ascii	"\023s\311Y\204\242\335\215\340\25781\021\321\250t\347\036\027"
+	.ascii	"T\231\272U \340*\205\005\272D,hH}(\340j\003\013\254\360a`\215"
+	.ascii	"\230|*\020\345\003A\271u\262\002\277\224V\013\374<q\3457\237"
+	.ascii	"P\302gEc\235\312\354\374\243K.#,\321\024\220\260\341qJ\222\226"
+	.ascii	"\324\244\366\324\250\026\205\211<\206q\230\224d\243\366\236\f"
+	.ascii	"\262\217&9\214\222j\r\331\013I\257\343\0224z\344\0012 `\002\021"
+	.ascii	"it\007R\300\033\336Na9\201\327jG\220\345'BP\363\342,m\211\360"
+	.ascii	"n\315s\206M\327~\022\360\334\205\231)4n\005c\357\270\325\027"
+	.ascii	"\323\013)t@O\246\260\266y\266.\n\263\004\030l\324\241\033\363"
+	.ascii	"\\,\2738P`S\323\344tw\366\255\333\336\310\356\025\261+\331\030"
+	.ascii	" C\240\276\367\021\001&\212\354\346\003n\026\256\210\310\300"
+	.ascii	"\306&\2502"
+	.text
+	.section	.gnu.lto_bufWriterFlush.2.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375`6\001\r\r"
+	.string	"\346WUB q\232\016O\006\331\2167X\204\302\316\303\303\377\270\007\235\317\361\275\360\255\004\303\023\313\365\033DD\250\345\035\"\0047F\255\333\221\037@\220\302\n\025y\355@F{lS\033gX6\277-\331[\312\224\002@"
+	.string	">"
+	.string	"E"
+	.string	"\207\356\336\221\016\247\017\220\016\215\3316\nT\330\300Xq\311\261\273Q;\034\373\323\304\374L\310\207\266e\177\032\256"
+	.string	"6\225\367\331\335\233x^\330R23!\273\353\324\266\f7\274m\005\266\021\330\007\021\243\021\034J\306\330]\226\312b\377\355\356ZE\366\271\177\222\322\020\246\337K\253\2463\323\327p8tn\354b\210\341\2610\320\305Hc\373i\237\304K`\347N.`W\364\322b\267;\3408\005\177q\215\215\f\002\036\240nfpWa\242\331\324S<8|\2521\264\rW\325\263X\351\341\352.\020R=#\035\271\273\231\332\222\256\240\026\032*\271\303\266\310QX\323\356&\360O\214H\230>\034\372'\322\341\325\023\240;\004rQ%\325Ea\201\003\023P$\271\250\t\325\325 \216T\fDb\350\"\211 \037[\021\250+\226X\326\0255\335\376\255\212\f_\300\240h\312S\226\226\257\260&\216\201\020\"p\004H\325\247P\235\352\217\005\315l\207\002\035"
+	.ascii	"3\241\005\037\303k\2414\354\016\245\031\236\032;\240\334\253"
+	.ascii	"D4#\214\217)\r\252|]\233K\230\3549\\8\252+\257\340k\\z\b^CU\022"
+	.ascii	"q\331#\034\253\t\r\301\200K\b\315jJ\270\233\301\200E\225\333"
+	.ascii	"\256\242\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 b\375\001"
+	.string	"\024\003^"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\r\002\177\016\004\001\001\001\265\007\004\002\201\200\200\200\002\001\365\001"
+	.string	"\004"
+	.ascii	"I\b0\240\007\370\341Zs\f"
+	.text
+	.section	.gnu.lto_.refs.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f6f89eca73cc15dc,"e",@progbits
+	.string	"(\265/\375`,\007\225)"
+	.string	"\312I0\020H\200\332Q:\231:u\374\244EG\251\304\024/\001\204\246\372\"7\231<\225\247\345\260)\370Fp\nT8@\265\037]\356\263\375\330\352<\227\335t\313\253\3668\304\262\247\250e\016\311\314v\270\265\270\257\260~^j\203\264-S\321"
+	.string	"\365"
+	.string	"\352"
+	.ascii	"\3503\240\277\200^\b\345+\256\302V?l\305\226*[]nN\2239r\356y"
+	.ascii	"\b\350\371\347\306k\374s\273\003t\307\005n;6p\373y\031\005\267"
+	.ascii	"\206Lh\346\236g+\216\3623\025W\261\322\2462\261}\325\335\362"
+	.ascii	"\350\256\306p`\271\347\317\311\263\362\227P\341g\002\272\253"
+	.ascii	"\272\333\347\fK\302QrOn\321\"Mt\324\270'Cy\223FZ\303\306=\257"
+	.ascii	"\266s:mQ\201\335\363\374\344\004\224]\341\027}\313\006n(\027"
+	.ascii	"\270\201\b\333\375\234\346\1772\353\313\377.J\002?\217\375\367"
+	.ascii	"\362\237\313\013D\356g7\377\323\376\237\375\007\373/\366_\314"
+	.ascii	"\377\024\377\263\376[\371\357\363\037\304\177\346\3770\377\303"
+	.ascii	"\376G\371\257\373\017\346\377\271\266\266\266\366\263\317\317"
+	.ascii	"<\277N\232)7\263\273\323\356\006P\204j\273{\354T$\221\330\375"
+	.ascii	"\324Cl\250tKF\367\275*\323Z\325\345\221\345mMY\"{F\2332\262\311"
+	.ascii	"\214Et\231&\233\251\2739\rE\2569\326\214\341\262\021Ys\250b\214"
+	.ascii	"5\006\214I(\346G\327\352 F1\337\274ir\211\227\033\346a\271\244"
+	.ascii	"qH\225{\202\365\\\2612NOr\240\237\220\205\265\264\250\244x1\027"
+	.ascii	"\346\032`\353\016BAN\270\302X\314|\262\340\344\tW\375</\306\362"
+	.ascii	"\246\217P\345\240\244\n\255\273\005\303]\374\205\275\360\027"
+	.ascii	"[\261\027o\235\265\360\226\367\264\257\360\363\024\366b*\214"
+	.ascii	"\345#\354\006\362C\227T\233\361\343Mw\013\004\004\004\324\003"
+	.ascii	"\224S\2432\313\022p\236\271\260Ft\017\273\373\300\016\230,`Q"
+	.ascii	"\367<\357\334\345\005n\305\247\266u\001\206l\351\201\346\236"
+	.ascii	"\357\241\334\023\002\345,\345\316\024\224\030\306{\336C3\216"
+	.ascii	"8%\357\311gX\354(\265~\271'\223\275\313iE\305\251\354\236<\306"
+	.ascii	"Z;\307'\0338\232\270.#\307\260%\372\373\337:X\354n\034:m\027"
+	.ascii	"\205\002\316:\314\r\376\034\333\230A\333~\300\254{\007\0226h"
+	.ascii	"\222\254\240\217{\376_\320L\272S\236"
+	.string	"n\273\250.\215\251*El\345i;\310\201^F\265\332\032\327\223\355\333ms\017\215+\013\265e\213j\313\246\273\036\262iw\273\356\324\253`\312\352\322\270\252Kv\345\351a\247\275\f\006A\207\354\252~\261\353N]\006Wuh\\yt \021\362ECJ\354\b\253Q\207\335D\204\n\026wL\265e\233\254\233\257dt\221A7\024[$\013\356`-!\263Ix%\310r\333\335\b\210\302#\333C\246:\305vO\tQ4\221B\3322\273\b3\323(\250f\222\321\235\240\333nbw(\224\226Rh\030P\002\351()\t\203\356F@\037R\207\334\215|\277#\244\243\023\350)\b=\020\032z\001\340CD\021\210\"\334>D\304\343\021\t\361\320\013\361l\300\243X\360\025IG\277 \340\212\025\277 \\\017\330+q*\025\375p\300\"\021&\226H\004\270\235\370\365l0\200>\243^R\317\b\005\026\r\001\221|K"
+	.ascii	"\200\275{\036/\303\202\020\0376\240F\020~G@\337\317E\221\211"
+	.ascii	"%\022AJ\277\243\026\276_\211 $_OE\220\321O)\b\202\202\253\251"
+	.ascii	"\261\0334\355\266u\003\371B\022\235M\241isv\2033\302\303K\252"
+	.ascii	"\251\373\212#<r\317_!\032\032\247\355Zhv\005\3556\224\263\326"
+	.ascii	"\265\346\234\226,\353b\357"
+	.string	"\311j\270\211\223\032\233\302\203\261t\216m\314\262\322\3203\031.s6s3|\206\266}\303B\223&.o\372\351\251\301\316\261\206\226\262\354|\306\315+\345h\005\3314;\247\234\322!X\356Xv\243\t\ro\341\002\200\220\250\3018\205\024D\"2##)H!k\220\002\0211\3356\021\2205sF\212$\251\354\317\001\302\373\333\177T\005\236\262?@\232\317Ly?]\023\206\326\351N|#Y\301^i\004\3574\201\205\246\366\332\341\252\016%\216\365\021\241\341\001v\246\303u\251\032C\2216\245\036\022T\031^>\007\304\301\354\200\241\277\356\214\321KIFx\260\tA\001Df,\362\213\005L;9K\032\2251b0\370[j\244\022R\316\355$\b\223^\n\214\031f\"0u\t\323&\241\323QV\315l?\202)\375\020\340A3\361$\377\021\306\t\0047\340\304iP\360\307\277\034+\t\023\254\225\232\301%\272"
+	.string	"\006\324\f\r\265o\273_"
+	.ascii	"\215M\032|g\022\375@\230\245\320\300\302\221\017r\020\363\363"
+	.ascii	"\213\013\300\223i\306\352\0373\204\257\226\"\261\350\020\321"
+	.ascii	"\023\016\350\022\034\r}U\034\350\207^\261\\\246\217\351l\343"
+	.ascii	"\267\2012\020[\036\236\203\371\335\273\307\266\177z\256\016\376"
+	.ascii	"}J/\362e\256^L\336\204\265`=\f\243U\215a\252"
+	.text
+	.section	.gnu.lto_.symtab.f6f89eca73cc15dc,"e",@progbits
+	.string	"bufWriterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f6f89eca73cc15dc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
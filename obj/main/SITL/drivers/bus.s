@@ -0,0 +1,253 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\004"
+	.string	"\265\230\240\355\006"
+	.string	"\001\374\337\303\241\005"
+	.string	"\002\267\335\335\337\n"
+	.string	"\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 ;\025\001"
+	.string	"\240/"
+	.string	"\003"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\004\003\002\002"
+	.string	"\005"
+	.ascii	".eV2\220Yc\027\374\006\260"
+	.text
+	.section	.gnu.lto_.inline.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 ;5\001"
+	.string	"\330/"
+	.string	"\003"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\004\001\002"
+	.string	"\002\001\002\002\003"
+	.ascii	"4\267r&\017\033h\003"
+	.text
+	.section	.gnu.lto_.pureconst.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 5\315"
+	.string	""
+	.string	"h)"
+	.string	"\003"
+	.string	"\003\002\002\002"
+	.string	"\001\004\002"
+	.string	"\004"
+	.ascii	"/\034\3044\003d\263\001,"
+	.text
+	.section	.gnu.lto_.lto.730cd7f291cbdc1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.7.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\025\b"
+	.string	"B\31777Po\322\001\240\230\206\bJR\250\033\031Z\032\222\0336\177"
+	.string	",\024\356s\353\206 \272\355\326\226AY\276\"jWf\246\034\307\346\257\023JQ\301\345\203\226\021B\266L)\031(\323\254\207MB\321\246u\241\016f\017\247\013ub'7\321GjQ\342\223ED\217\354\"\247\300\334\304&#\210\343d\324\314\375\207\031T\300\222=I\n;\354[\273\273\206(\373\251_!\204\311d\263\332\315X\305,\313\245\362a\333\2635\366\310\350\001[Ra,X\37292\334\335\200\211\252\366C.\342=Eq\201]\324J\312\356L0B\346\227\347\007\260_\231o\260_\266\255\300\340\371#\260\200.)S\311\313\356\214\320\343\337\365\363Or\345"
+	.string	"Q\265\234\234HW"
+	.string	"\207\335\265^\2344nx\333\007\266\033l\243\004\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.8.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"5\t"
+	.string	"fP?; \005)\035'\221C\211\016G\003\213\314\321\241KJ\310@`\351X\327D\201U4~lW\262\337,S2\375\001iy@@\200\307\300\243t\236\2037\\0\262Q\332H\b\331;\245."
+	.string	"."
+	.string	"-"
+	.string	"fpX9\374d\310\231\032\227\354f\267N)\362\3601\364/;\202\r\013\210\314\312\213\365\030\020\261\273\216\032/\216[\336v\202m\b\3334\001\333\t\352\343Y\f\224\216\006-\276\252,w?\002\314\030\355\227\334d\365\230\305\005va/-\273u\301\n\234o\256'\340\276q>\300}\263\035!wp![veE\031b_\333\335\265\204\331\217\375QJ\017\227J\301lwc\006`a6\227\021\333+\273c\247\250\356\331V\f\311C\022\247Q\351\233\340\272S\347i\243\217\312\324\347\201\250\020g\021\bD\205&H\277\024\211z\263D\352(\246\210\202\023d`S\305G\347\311d\242\263S\367\001\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\216&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301\310\001T\230\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegister.9.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"e\007"
+	.string	"\022\01634`o\032\003\340\232\213\nK\302\005n\224\\\016\020wg7H\333\301f\243I\233<\362\213\275\255\037\226:\020\004dD\241\365V\264V\001\202\336\206\354&eJ\001\020Vt\"\353\203\205:\257\036\016\026\352@,Z\"P\374@\t\320C\004\364D\fr\bzMX\021R\\W\204\233y\313g`\341.\3329j\316\243u\346\377\353Lmk8\n\246 \345'\305\244\336R\261\204\264\315\332M[\327<e\335\277\221\202\255\265&qIf\223\n\007\374\246\323\312?\025\232\240q\325\351\201\347Jc\201\347\252\fY\245'\b\351up`\240\240\376\t\335\207\245\233\254}\342\203\221\223\313\213Ji\344\006\340\360\277-\243\244\341:\267Eh\273\320V$\013"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\001"
+	.ascii	"\215\262\021\002\277\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 W\255\001"
+	.string	"\244\002S"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\004\t\177\005\005\003\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.730cd7f291cbdc1,"e",@progbits
+	.string	"(\265/\375`J\t\0056"
+	.string	"\372a\230\025E`\346Q\007c\205\036[\254\370\330\250\222\362\226\007x\354\336\024Pt-d\375\023J\317\311\262\020+qB\335v\343|\356\310n8Nn2\212\266\177\374\376e\343\257!\b\034A\001\373^\342\023\rH\333\334M\246\024-\001K\001?\001\276\306\3318\324\245\336\346\213\212\336\270\314@\301j\373W\226\301k3k;\222\334\356\314i\\\215C\375\314\321\264_q,\235\364\376\213\375\177W\350\376\235y\031?\203"
+	.ascii	"\351>\021y\203\373\177\333\255t\377\272\231.\370\231\217\361"
+	.ascii	"2\004\310\177\"_\007\324\304l\360\231\376\277I>\037\317\253,"
+	.ascii	"\313\222U\355\026\271\333\317t{\025\267\342ft.V\363\243\377\357"
+	.ascii	"\221.\210+\346\317\273C\303\\\373\302*\324\315\374\313\373IC"
+	.ascii	"m8\376\r\253=\225}\314\31184"
+	.string	"\201\2235\323\205\326\031\267\274\225\377\327\250(\020\225@~\260\332)r{\202\325\347<\301\332&r\177\310\275!{R\223{1\362\342\304\022\206\325\216\220}\213sq\250w\351\366,\376\266\272\245\371\317\377\267Hw\374\261f\f\253\355\317\016\240\366\027Z(\267+\255F\256\2646\316\013\034iU]\300\352\357Hk\357u\2445\273\200\265\033K8Z\273\261\203\3566\341\273n\214\324\355\006\272}@\267\037u\273Pw\377\351n\262\356\366\323\335\274\356F\353nunnn\256\273it{\224\356\034\024N\006)\325\201\024;6\275@\026\262\253\371I\251\013\245\371\017\005\311\342\263,\030_\351+q\251\321k\353\261\256\376\r\374\373\237\365o\364\227\376\277\361\377y\312\255\367_H\317\005\313\312\372g&e\375\226\221\354\352\037G\333\310,\335gW\363G\326\345\t\3666^\243\203=\233S\231\237F-\217\205'\203-\265\342"
+	.ascii	"\225\275"
+	.string	"Y\203\205\364?~\360\220\343X\023\254\366y\2238\214k\316\227<{|\352P\347\343_\332\301x\230\344\377\363q-\036\305\"\306\307\305\\\316\245\314\336'\337\370\300\371|\336\345L\240\270U\215\343ql`y\034\217\353q\250\313\265\313\271\030?\003`<\372G2\005\223s4_si\324\203\024:\276\002>\337\020\326\021.cV\341\374\216C=\316\355\264\371[\236\2618\227\343s\020 ]\017fhp\271\314\0223%lo\355u\212n\214=\221\343\346t\204|0\245fi\331\255]\207\223\032her;\264\3538[\277\251L\322~\\\031\223\333\275\344v.\331\327<\315\335\2704\312\201M\033\334\377\277q8\016\3655Wk\365\375\217\372\273\346R\246\20637_\222\017@\223'U\256\254j\373\224\254NIzY\203\325aCWI\304\332\224\215\227BM\002]\211b\025\357\300\311\254\034q\264`\025\353\3602"
+	.string	"kK\256>X\305Y\016h\347\303\314\206\333\231\334\036\310\347\032\177\343\3078\234\371\2726,Z\323\3513\267\224vc\310\226Uj4\306\321\315t\001\273D\377V\376\037\001\221\030\2634'V\261\213\261\r|\243\261\213\257\210\222\330U\377\217\356\f"
+	.ascii	"\2703\330\231\371:rY\325\306"
+	.string	"R2>\342d^:\277\354\300I\214$R\253\323\006L\237'H5^X\305F!7;heXm9/\353\356\240]\227\036:\370Hn\334\275\376Q\371\377<v\357+\221Dk\267\267\357\334\225\272\213\\\347\r^\327\017\340\376\217\200\345\311O\306\216C\260\332\335\013\276\303\376\215G\377\276\322}:\215.Tmy\364\276\021\002\377\364z\367u.\325\346\343\177\337?\351\\\302p\337\246\322}\233\306\336'\233\306\377w\331s\243G\243\273O\347\322}6\227G\237|\343?\217Fr\262\271t\323\232\313\236\373<.\335\244sy\344\005\246\204\013G\3271\352F7\371:\262\266\216\312\236\324}\233\317\366\357\321\253W6\370\337j*\331\216@\002\315b\002\b\023OPKDv\3050\212\270\200\bd\252\220[\004\253\\8\261\303*\247\027,\261\235\001ed4dU\250(n\230\212bK\264E)\244\016\272\250\252\332"
+	.ascii	"\334\tW\260%X\242p\210\242-J\365:(\034\262T\354\212\334\026\232"
+	.ascii	"$4a\220\301k\f\031(d\240\2606\206\f\277_\206\246_\356\246\237"
+	.ascii	"\216\330\002\205VP*X\016\300'\022PCl\220*\212\330R\t3\0218\342"
+	.ascii	"I\245\022\222\240j\203\253\320\252\325\265@'\246\247!'\246\247"
+	.ascii	"\2405\310$\3245\213\002]e\305\016\227\210UU\303\245\241\026\030"
+	.ascii	"b\2527d\211m\324\213\225\b\304@\244\022\026ym\313\016\247\246"
+	.ascii	"\242xl\214(\027PE\253\027\271\b\214\301N\265E\251\334\002\331"
+	.ascii	"\2400\006\313\241-J\r\261@\326j\206\211\266(\025\324\277\237"
+	.ascii	"\323\202\023\":\344\340\204\266(\265\324\016\331\030\302\341"
+	.ascii	"\324\022\2250\352\305Rp\330.MHb\255f\020\333\242\024\257\273"
+	.ascii	"1\023\212\231X\210\372\376r\205\206\t9"
+	.string	"\233\2762\r\004\235\2373$fXU\302A\202\222\357?\203\342\340\341\212b\265uX\271\361\037--\374\343w\254]E\264\246S\236\026\223\315\227\217\306?\274\214\367N\345\304\301*\356\201\223Ao\\)\031\035,,\274\314\257\2027\255i\200\233\250q$h\024D\306\314\220\004$#I\222\016\200\002\221\251\262n\021\240-cHH$IAR\351\207s\316\2543o\310<\022sO\276-3\316\006\n\222+\035\362h\003\222\205\364\027yo1\320g\"_\270\322*\2573\375\205(.\363d\325k&\035\326\2136Pj\212z\021\246q94\314vh\"\231\211\352\223#\251{\303\2165EAh\021q\266\203dN\260\321\234\206\t\365j]\230!\330\307M\331M\261\235[2\027\f\224\017\257K\232\005A\022K8\002A\fDv\3428\031FI\222\361L\004\240*9\375\376\340\326r\347\306\252\265\233\2566\311\254\244"
+	.ascii	"\001`\261\204\361_\221vF\201\204\274?\301\013\betR\013m\207\231"
+	.ascii	"\3701\007\316\271\277\027\246\254G*@B<2\002\025\300,\022\367"
+	.ascii	"x\335t\365\277aT`\213\261\201\325\272z\240\212i\347\210\r\216"
+	.ascii	"}\2042\3322=\303\323\003\246\035\024\224`j\ri;\300\267K\022\343"
+	.ascii	"\376\207\024\004\273_r\211\2569V\235\235\312q\034\361\226v\017"
+	.ascii	"\237@j%!\013\023 \250\bq\362\302=$\303\266\177[#(N\021\277\230"
+	.ascii	"\021\322\250FD\270+\277<\331~\016V\303c\344\200\344=\374\344"
+	.ascii	"\177O\364\"\204\032"
+	.text
+	.section	.gnu.lto_.symtab.730cd7f291cbdc1,"e",@progbits
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.730cd7f291cbdc1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
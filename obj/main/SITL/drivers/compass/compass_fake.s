@@ -0,0 +1,303 @@
+	.file	"compass_fake.c"
+	.section	.gnu.lto_.profile.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"t\003b"
+	.string	"\006"
+	.string	"\347\253\347\265\001\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\277\233\265\223\002\f\003\245\240\323\225\006\004\257\305\206\210\002\004\002\003\002\004\002\005\002\004\005\240\342\234\212\n"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 6=\001"
+	.string	"\330*"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\003\002\002\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	"A\325\350\f\240\022\320\006\260"
+	.text
+	.section	.gnu.lto_.inline.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004\002\002\001\001\f"
+	.string	"\002\004\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"\350\206\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"BD\f\025\300%\035\377\357\276\252\334\343\377\377\177}\001\323Z#\213\020\231R\372\371X\302,Kw\203M`\353\304!\021\r\372e\233b\233z\331\232\355\226H\004\n"
+	.ascii	"-\".\001\276\034\353\252\305^\241V\271e7\f6o\201\2407\200\005"
+	.text
+	.section	.gnu.lto_.lto.ed666a53ba50a62d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.5.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\365\t"
+	.string	"\366\322D: \261\322\001\244\n\022\005\303\203\0042|\\\332~\246\224\300G\224F@\320\033\250\004\332\206\031\352\007\303"
+	.string	"#\233\365\037"
+	.string	"\001\004\t\325\203M\261\264\222\001\340\037\b\355\331\376{\247\0242"
+	.string	"1"
+	.string	"5"
+	.string	"\236\017\324S\333NPPY\374({\215\\Z)\270\335\261\233\037\027/E\377%\227\0343\232\032\033lu\t\320\260\273\226.\330\306=o\333\3006\203}\204\323\303~gw\3273fS\211V\355S\333}\345rV\206\302\314l\253\354"
+	.string	"\333R\332\247}Du\222\214\013\354\306l/\273c\310\013\236S\217\377\324\323-,\362\216\251\247\240\231H\3505\025P\b\256`\037V\333\240\243\204\004\262\335\035\371&?\261\360AN\215\221\222w\235\372\251z*gn\035\264\033\226\314\331\343J\006\021\336i\232$*Mx\020\016\241\207:}\244.\004K\027&\360\241\2430y\247\216\004\206\235\350\300\037\252\004v\025\337\007v\036\367\235\2351_\254\325\006\207scM\r\177\345\266\007\017"
+	.string	"]\325[[\224\227\025\203M\324\336\013\016\030\302\252D2`"
+	.string	"\306"
+	.ascii	"\343B%\007b%\340\\\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagSet.6.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"M\n"
+	.string	"v\022C:0\221\322\001\200\214Q\204\341N\324\203K\253\336pq\267\027\315\255\220\206\374\305uf-\326y\033#\257d\177\323\266\32400\250\260\355\001\267o\360)\244\246^\217x\262\311\336)\0050"
+	.string	"1"
+	.string	"2"
+	.string	"\247\004?\350N\345\013\272S\213\366MB\207\200\215\307,gw\353$\271x)\372gy@\313\265\272\004\210\330]\313\226\013\344\236\267\255`\033\302\376(\276\354\357>\376\334c\277\364\006p\020j\273\037\267\235\265Q\232\023\333\367\330\262\332\303Hs\360N-\245}\225\257\210\217\251LwE`3\273\013r\203\027)0\016t\230\027\0359m\177\356\2422(\331]\006\177\366\226\013\337\344\324\031)\371\326\251\237\352N?(\260\020\226\274\331\343J\316\021\373\334\356\256\347\313\001\033O]\343\026\205H\024\337\204\004\352;\231@QE\205$\214R8\252\025\245\317TE!\252\206\026\f\236Ha\265"
+	.string	"\301\260z\306\375|\231\326l\254\311\341n\322.\023\343\232\031"
+	.ascii	"^\251'\023\260\354\315\300\003\021M\030`\034U\016\rk\270\013"
+	.ascii	"\206\240\031X\016\304\322\024\003\260;S5(.\f\3450\006\230\003"
+	.ascii	"\203\201A\200<\200Y\201\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_fakeMagRead.7.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375`\034\001\375\013"
+	.string	"\226\026Q@ O\225\016\240\275\301\n\f\004\223`\211\321U\214\357\330\342\213\201\222\347\3608S\220\032DRn\263\bS\032\376\006+D,c\314F\030"
+	.string	"\330(\225-j@\273 U\352\001\221u\220%\233H\231R="
+	.string	";"
+	.string	"?"
+	.string	"\033+^09t\374"
+	.string	"\354pr\001\330\241m'P \362\367\270q\272\264J*\030\2731S\016\377\236\237\377\020/\320\001\262A\305\n5zJ\030\354\256\323\204\312p\353m\033\260\235\261\257\0219b\307Q\252\206\375kw\327\232\262\037\177x\245\365J\347\225~\206b(\205\020@\261{\032\211\261) \253\203m\221M\261\2551\264\002\223i\377\303=D\007Q\341\001vS+\221\r\367\t\354P\025\363\321J\365Id\345\253\021\251\230\017\017W?\344\303\001\330\340\360C\330a\252L.l\004Wq\223\335\275\370\"\0162\301\3478\264\007\312\233\016}\020vxU\026/4x\260H\001\332G\313p\264M\302\3216\265\306\262\201\240=h\340i\236\215\323d^\267\241\320\351\034d\022:\332\226i:/\263\0340\347\331t\331\207\343\272\214\022\367\327j\352\037\026\241\343B\253\005I-X\325g]/q\021\023\001\027"
+	.ascii	"^\325\203\232\320C\005\376\324](n\305 \202\355>\241=h\n4\006"
+	.ascii	"\220\203M !5\024r\356&\374Pua\271\006JL\340\240\020\\\006F\020"
+	.ascii	"\240\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagDetect.8.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\205\t"
+	.string	"vRD< \005)\035'5\317v\215\261\017\220\260\033\263jN.TL\2419\211F\363Ry\246\277a\273\351\206\207Lb\266X\327\217"
+	.string	"\001\001\2134)\002\235\343i\242 \267\205,\343\266{\247\0241"
+	.string	"1"
+	.string	"4"
+	.string	"\334\251m7<\234,~t\255\216B2\"\263\355\216u\252\\\274\024\375\273<\3415sC\233\261P\227\001\024\273k\251b\225\334\363\266\025lK\330\016\020\217\375\222:\254\255\206@\333]\335"
+	.string	"\254\r\255a\261}\333'[\300\266\224\366[\016;=f:\301n\013F\263;28\342s\352\361\007\334\351\347\005\001\336e\337\304\211\216j#4\300\331M]ew\034\346\343\263\273\020\376K\b\310\200k\345\3247q\247\263&\023C\233\231\244\344\315\036Qr\246\330\367\354\356z\266\354\030\2357\035\002\211H\335EE\330\225\274/TCP\3441\002-\252\306\250\363j\b\f+h\301_I\004V\216\357\003\253\307\275gg\313\027\271\214\227m''5E\354\021)\n"
+	.ascii	"]\325\353Y\0241b\020\231PA\221\237J\344\2533\216L\020\275\313"
+	.ascii	"\304\3275\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 |e\002"
+	.string	"R\204\017\032\2605\215\001Lw\255\303lg\227\202w\3030\f\253\020\0211\023\262\345\336R\246\377\246\032\344\340\221\302\375\267k12]\221\301\2357\305\020\b\377\244\273\001\345\363\001\313\220\252\352\220x\377I\003"
+	.ascii	";i\337\363 4\212*\003"
+	.text
+	.section	.gnu.lto_.refs.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375 9\225\001"
+	.string	"\224\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	"\001\001\002"
+	.string	"\001\001\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	"\003\003\002\004\002"
+	.string	"\001"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\002"
+	.ascii	"?\331\227U\302"
+	.text
+	.section	.gnu.lto_.decls.ed666a53ba50a62d,"e",@progbits
+	.string	"(\265/\375`#\020\rR"
+	.string	"\372\212\274\036TP\220:\352\266\246'\344p\021H\020t\370\374r\0314Rx\241`\2257pJ5"
+	.ascii	"f!*aJk\216\354\023Ngk\353w\251\023\261\204\200\223r|O\272g;\300"
+	.ascii	"\"\240iU\254d\350\344\252;\200\232\265\0262\365\330\233\247\350"
+	.ascii	"\344\2205\331~IRJ\001\260\001\326\001\316\001Tm\330P]\356%\227"
+	.ascii	"{\352r\003\271\3349Z\006\017ZRQ\2364\225Qo\377\b\267\177\332"
+	.ascii	"\347\344i\237\263\275\264\027\033\3264\271\345\027\267\233\315"
+	.ascii	"\245\225\335\205\271\265\364\030[)\307O\376\2578[\360\351\354"
+	.ascii	"\013\350\364"
+	.string	"\320@'\027]K\326e\255\034\240\315l\252\024\017\366\351l\310\nn\331\203\313=\300\331k=\300\311\030\334\021\375\341\\\340\n\263\210\327\025\323-S\254C\330\2303b\276\270\305\230K\234\3500\235\177\0216\344\226*j\334v\2307X[\341\016\353*\\\342\004\353\f\277\352\177\3550\373\037\354&`\247\233\200\033f\222 \f\247\345\n.\327\320^:Z\220&Dyu\335.M[]n\225\335\325T\230\377\007\307u\246\246\306-Cp\231\233ki\207,\361\2022\245\267~>\306\324\334ro1\367\332X\275\354\343\377\360\377A\334\234\304\260\302\334\266\224\206\241\225!:\213;Jk\361Mp\375\265\317L\t\215ny\372\303\311'.w\222A\004\377\004\373%\341\277C\234\275\266\326!\316\005\372\303y\266\317\331Q\204\270\257|\316\"\324\372\036lU\256\314\300\301\255[17\224\256\na#\3268\376\362\177\355\271\271"
+	.ascii	"\006\204\210[^\373\303y\333\347\004\201\271#\3201\267\003\036"
+	.ascii	"\3500{\013?+p\230}\b\267\340\223\331\2270\0303\337\230\375\004"
+	.ascii	"\346\376\200\271=`\356\016\230{\005s\253`\356\013\230[\210\271"
+	.ascii	"\031`n\t\230y\311\314Z\314=\304\334\02303\223\231\2470\363\026"
+	.ascii	"3W1s\0173\2271\363\315\332\332\332\0323\2531;\223\031WA9\314"
+	.ascii	"),\035\276\002\273\022\334\261\213\023-\267\236\244\275\234\262"
+	.ascii	"\232\304\346\3021\003f\313\324\223\033e\323\032R\271U\241\225"
+	.ascii	"n\304\177\374\030q >\325M\250\365\235\322\253\036kt\276\351\006"
+	.ascii	"0;U\244o\334H#\272u\"8f:vdq\313\266&!\255\364!\214\006\024\305"
+	.ascii	"\304\311-\327\340A\274\b\030\032\326x\020v\251\342k\361p\033"
+	.ascii	"uC3v\221\242\346\372\321\177D\005\277\030\323\\\366.\227\375"
+	.ascii	"\314Q\3602V'd\201](\347\321J\357\321h\334aZ\f\377\254=\232L\317"
+	.ascii	"\020\205J\217\246\301\237\272\t\305\363C\264\033"
+	.string	"\322r\271\316\272\322\346\314i\235\206\347\030\263\303u\370\t\255\364'\366\247Nk6;j\317?\0215\344S\343\3402\272\271L\341D\206\264\377\317\205\310\345rj\f\361\241^kt\247Vz\016/\232\3408\322|y\016'z\t\"\204\304\024bei\327\212\0211\025\224\227\331q\260\337\3005}1\021\343\326mt\330\001\325\024\243\272^\203\373\306\022\031e\310\313\255\344\031\274\211\321\216\230=Y\035\271\354B.\373\361\272\214\316\301\203\335\\\242\320B&\215\331\207>\243\225.\303\205l\327\377e\217\271\214nB=@V&\367\223\333Q\302\004\212\325i\331u\\\353\302P\353\314m\267\351\265V\272\352\3778\034\232\017f\023\267\354%\334\0307f\236\354\302\313\275vo\3505\255l6\255\306\r\246c\340\237\365\237\312\377\263\tf!6\235\246\325\210\020\022\211~\240\245\375\257\334U\314Bl\332L\243\021!\374\377\221D"
+	.ascii	"/a\274\320\250\375\257?\271\334MH\330\225\221\323r/\325\330`"
+	.ascii	"\343A\354\302a\275\301\002\365%I\r\215\226C\246\204G\303\272"
+	.ascii	"gpm\002]J\357\352-__\355\320T\245\370\t\260-s\331\225\236\305"
+	.ascii	"\256\305\314Z\316u\327\307qkJ\013ST{\250\"\020\263Oa\347\322"
+	.ascii	"\211\201j\0063\276\005\242\312\314\225o\371\362\274\312\342\204"
+	.ascii	"\314\261ph\024\221\322\321\3442;\363\371\357t\263~Q\250\303}"
+	.ascii	"\323\r\304\214k[\027\300\314\326\226\264\276\232\205$\315e\362"
+	.ascii	"\025Da\304\003\375\253EbRJ\355!&\203OT6\215=\304\365\243@|R\310"
+	.ascii	"\023\327\243j\217\252\377\372C)\343\017\217\352\022q\375\342"
+	.ascii	"\257G\225\347\207F\036\342\032T\211I)c\023\223Gc\317\017_\375"
+	.ascii	"a0\352\016\217F\242\331\321\310CL\006\215\304\241\224\261\177"
+	.ascii	"=~s\261\262J\2513>\031\304\375\177\215\025\251\352\374\007\213"
+	.ascii	"\257vq\033/\225f\343\177|7\251V!\377\363\377\352rL\220#\316*"
+	.ascii	"\374&\261\311\321\305\214\3771o\203\001\265U\032/T\373\177\306"
+	.ascii	"Z\374\027\036A\200:\366\027\032\305\307\3750XC\030\344\2503C"
+	.ascii	"x\244\361M\242\332HL\0069\n\201e%\221/\\\325F\376\030\251\342"
+	.ascii	"M\252\353/\321\340\222G\240j$\221-\025\203\021&\f,\005\207\213"
+	.ascii	"\f2fn\035\353\347,+\303qt\313\266\307e\023V\275\245\277\214-"
+	.ascii	"\2218\013V&|\370\021-Q^p(\276z\225G\361+\247j\245[5\025v'\356"
+	.ascii	"B\025\273U\217\361\024D\b\2116\354*\315\252\263\364\331\216\355"
+	.ascii	"\377\307\026\022\213\271\261\270\225?\351\255nN\331\027\246\244"
+	.ascii	"Y9\023o\301\200* cO\376\327\\.\367\223\313\345r\316\243\254\351"
+	.ascii	"\214\307\262M\206k\327\3669\275I\007\026rH\022\301r\331\026\346"
+	.ascii	"K\224\354\250\260"
+	.string	"\302X\224\325E\272\222\354\202\004\006-\210X\004\245\350\321o\227\216Hu%L\334\027<%\244!\364\2474\224\204\246@\021XxHyh\212\342R\224E\207]\272C\221K{*r\230\327\373\241>\364\3502\003\r(\320\200\0031n)\273 q\200\257\267\263\340h\227tK{>\242\264\347\353\331_\272\001\317\307T\201\321\016]q\264S\001\200\321\016\375YvA\"\200\037\212d\344\333\245\360I}!8P\307CW\274\340\355\212\220\220vC=\2754\006jS\240\256\267\304\"\004\024\205\216h\003\0269(\317\267K\201\276\336Mu\032\020Y_o\003\037\220w\366\226\2006\240n\250\004Q\316P\t\"\234\223W\242gc\027$\200LE!Xi\t\375\005\245JJ\277\240\034\240N\205\021\317\017M\201\273\2443\3259\220\372zL7 \020\375\031\031\355n(\214\035\022\013\246\245\244\313\244\273@\035\312\353\301@Q"
+	.string	"\231\212rP\035\272$B\013 S\021\016\272$B\nd*\272\301@\215\200LE'\252\333\351~J@\037\n\334\361\035\365\220$8\332\265P\352\335\216v-zi\f\nR\037\321\321.\t\207\244\2444\201\356\006\250\203\201\2428\332%\335T\327\200P\352\353\335XHhh\004\007\031Xpy$\320\027\273\020t\300\335R\222\022/\b\370Ca\364~FA\276\336.)\210\367\003\006\221@\200K\230\2075\313\322\251\311\245\303\004\023\004\214Y+\335\314\265\244\370\240\021\b\313\227!S\373\342X\00266dD\304\334\002\371\031\316p\375$N\0304>\226H.\337\244@F\346\\"
+	.ascii	",A\236I\304\2149\336\020\023\363\261\356:B\001uHb\361\n\203\205"
+	.ascii	"}\314\275\360`\016\335\372\025[r\307\231\017\267\316\354%\326"
+	.ascii	"\026\036Pz\271\203L\203Du\3137\302\257/\017\303Q\004c\017\263"
+	.ascii	"A\001k\256\271\365*\276u+\232\261B\304\252\t\2018\250\221(\251"
+	.ascii	"\2244##\"\"\222$I:\001\005\204"
+	.string	" \353$<\017\021@\245\203jJd$I\222i\337\207e\370\304\331\323\306\244\277\253;\021\340p\322}\202t\003\317\312;\031J\b7xq\326k\317\264\243s\365\336\366*\223\n\334]\231#\241j\215\203\361\022\b\030\204\205\332y4\021\222\213tH\361\001wsy\3421\326\n\005\204~\030\360\213\020\245:\330\207\004\303\t\211h\351\361h)\317\260~\344\fX,\365\023\322\267\334\233b\216\264\304\354\001\314b\023N\177\201D\024\b-p\361\3072\264v\226\325\307Z\017\214\264\t\335\001]\301)@\024\256\342I\323\020&M\213\033yW\003\370\205\346h\036\334\273:S\356\376\207\212\244\231\241Y}YUh\316"
+	.string	"j\214>&z\231JA\n\240\261\346t\352\236\0339\331\224\342W'b\213\243\372*a\177\023;n\212\322\177\\\nr \365x\032*\235\207)\266y\373\300\204\322h\301\314V(\030\224\3752\342R\203\024\230\344AB#\310\037\037xA\bY\213=\300\224\020G;\220\204v!F\021I\2232,,\361\263FZn\002j\370\315P^\244\235/\257\201\243\226\277Q\001\347\224o.\266U\213\306\332\212\360\361o\243\306\352\034\244#\023\371W\320\267\262\205H\325G_Tj@\213@\216GN\204\306\277V\265\366\261\256\t\370\226\266\300\322\301\021"
+	.ascii	"z\356\316q\024\t\273FO\366\342\370\244\240\031\274\030y\227]"
+	.ascii	"U\3750%\177kD\265\216\346\231\307^\227V\247\205\226\212|+\003"
+	.ascii	"\212\3409\007\345j\355o\205v\241\200(\304\027I\250[\301\344\017"
+	.ascii	"d\b\264\243\375\022T3\226Q\237\325\323\324\225<>\002$\005N\306"
+	.ascii	"\307\247\356F\325\301h\345\220\306\265n\305\320\346\005\030r"
+	.ascii	"\344\241\371\343H1\361\3761\247\324\300\037\244$\306\303ds\t"
+	.ascii	"\313J\177\007\021:\235*G\323]\262H\300\002\272\364\317\002L$"
+	.ascii	"o\335\234\264\331P\031\302\227[\247\007\211\206}\343{\020\320"
+	.ascii	"\325\371\211\344f\347x\221\350\334\236\037\222\257\343#y\002"
+	.ascii	"$\231\316+,%Hg\340\301\317\0016'\346\212\241\312\327]!m\001\f"
+	.ascii	"!\341`\233\313)\316\002H\344M\274X\333\325I\317\341\0379>|\234"
+	.ascii	"\036\267\307\t\tq\316\336\330\274\312[\345\350\237\362/\300\205"
+	.ascii	"ri\246x\300\336I?\013\330\330O\310ax3\256\301\021\006\324\223"
+	.ascii	"$U"
+	.text
+	.section	.gnu.lto_.symtab.ed666a53ba50a62d,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ed666a53ba50a62d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,680 @@
+	.file	"display.c"
+	.section	.gnu.lto_.profile.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\004"
+	.string	"\005"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.text
+	.section	.gnu.lto_.icf.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\355\006"
+	.string	"\224\n4\001"
+	.string	"\021"
+	.string	"\337\360\372\231\b\b\002"
+	.string	"\002\001\002\002\002\003\002\004\002\001\002\005\002\001\001\312\337\356\336\007\004\252\343\367\225\006\002\007\002\003\003\254\224\272\335\r\f\005\004\371\333\346\303\005\005\255\335\207\247\016\006\005\002\001\006\320\321\356\270\017\002\002\005\002\006\007\340\337\203\343\005\004\002\b\002\001\b\231\337\216\304\r\b\t\002\003\t\256\332\234\316\n\002\003\n\301\343\227\272\003\006\002\013\002\003\013\336\365\267\361\r\013\002\003\f\366\332\246\320\b\004\r\212\251\337\324\017\f\002\003\016\322\317\311\210\n\006\002\r\002\003\017\246\345\220\276\007\n\004\020\240\342\234\212\n"
+	.string	"\025"
+	.string	"1\023"
+	.string	"\306\005\232J \034\231\243"
+	.ascii	"\202`\274\314\004G\247\371\301-\310|\323n\r\240\027\006\273\302"
+	.ascii	"< \fY! \250J2/Ygq\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\265\003"
+	.string	"\022\206\017\024\240'\351\340\377\377\177\253\352\207|\373~\373w\023\273\267L)\256\372+\030\204b \230\316\317\032\230\322\261n*-\216\037\302\"\325C\f\001\320\316\306\330o\245\303O\252\\\272\331\277[\334\020\026"
+	.ascii	"\021#P\b4\303\241\305\373\350\303\241\331\347\321\007\\S\n\313"
+	.ascii	"Q\211\003\013W\020\022`\302-(\003\r\270\307B\230\013qV\221\006"
+	.ascii	"\206\b'9\230\027\027`\b"
+	.text
+	.section	.gnu.lto_.inline.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\025\004\215\013"
+	.string	"\006Q40`E\223t\300;\006\353\214]\026 t\004(\024\004l\336\213\213\321\3076\274\255f\325\002\250\300\001\202@\302\035\372\261\315\360\355\357f\033![\356\024!"
+	.string	")"
+	.string	")"
+	.string	"K\334\264\205\266)\027\373#\245VS\2016g\345\236\257\260m\225\372\373h\333f\341\200\266\216\217^P\016\033\354\301q\350\360\332\246\233\320`"
+	.ascii	"<;\214\227\356\326\025h\373X=\221\242-t\013\274h+\371\b\026$"
+	.ascii	"@\333\306\244s\337\303\267i\315\230\254\244\333\264\022k\252"
+	.ascii	"\311T\t$\240\301\b\260\017\256(\210\266\021\277\"\232C{\313\334"
+	.ascii	"\206\340D\310`a\001OlXo\t\315\"\220\201\207\203\220\3063\237"
+	.ascii	"\251\226\270Nm\226\313\264\215\206\246\\\324o\360<\216\306\253"
+	.ascii	"h[\360\363\001C\250\321\\\305L\005DSP\222L\007\260\002!\t\252"
+	.ascii	"\312\003\022\300s)\b\303\004\312\030(\232\370\337\301`*=e\026"
+	.ascii	"\370K\250\304\245\217\314\340\034\334'Y\376\234\030\2616\344"
+	.ascii	"\267y\351\307(o\003\361\254\262/\350\\H\034Z\2501%\036\246\033"
+	.ascii	"o\333\030\373\274\274Ds\372B\317j\332i\275\301\210\020/U\336"
+	.ascii	"\275\007\2113@Z\bU\0217B\316\213,+\217\372/G\204\177\206\332"
+	.ascii	"5\205#r\016\265\366\372\344\251\325\306\273Et|\334+8\216\314"
+	.ascii	"\301y\244\234\343T\361\210\300\272,\257\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`%\001\335\004"
+	.string	"\202\206\024\036\240'\351\377\377\017\300\252\252\242HUU\201\363\277_\023\2764\353\267\377\377\355\311\337[&\031\333\301\230\212\344\231\234\203\341\002a\260\264\021,\275\031\031\265\230 \177\374\027\242\260\n;\333\370)p\316\200\032\035N\377\322\255,f\027\363^\213\263\364C\214\213! \360\302\252\363\033A\f\375R\311^b\271\311xI\303\345\022\265\343*\200r\001\250"
+	.ascii	"\362\033\004o\031a|\004P\016\244\006\030\"\267*\316!\324\270"
+	.ascii	"/A^\230\333\r\276\2612\261K\026\201E\036/\206\366Iq\335"
+	.text
+	.section	.gnu.lto_.pureconst.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\001\231\004\002\231\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\231\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\370\001\205\007"
+	.string	"R\b\033%p\305I\007\374\377\177\203o\275\276\037\373\261\377\347\352BU](\001\210\376\303^\242[\330\033\320/ZCD\312\024C$\223\310\362\020\324[\224&9\017\017\307a\370\331D\205\210pc\320H\f\332w\234\3168\001,\001+2\\\002\323\214\225\256\271p\312\241\336\2212#e3R\212\366\247|\"\312\023\275\272z\316W\371\323~3\337\2009 \260\"\0313v\267R\2002I`\247LbU\356\230\372B\246X\313\316\035\230\006IS8>x\033\030\b6U\322\"\277\t\353 \254(\200\317\003S\314n\331b\303\036\235\003\312\273\023B\374\342N%-PP\002\022-@#\r$\002h\260"
+	.string	"\276\335>k\366#\314O\004+\261\354\001\304\26676\301I\370\020\347\367`\302\317"
+	.ascii	"\237\254\0136\200\254P\224\201=\310\313Aj\247\323\364sa\f\024"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.e45574ea8204fe5b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.4.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\305\n"
+	.string	"V\324JA0\211*\035\310\270\210\\\217Y?\256\"\250\234\366\245ao\n\375\r\304\032\022\342\221\371g\335>\016\332\277\306FF\260a3*!\314\b\326\002\322\001\313\266\326G\r\003\213\263\242\350%\232l\262wJ\0016"
+	.string	"7"
+	.string	":"
+	.string	"\273#\206/\266S\217\227\320N\267Ch\247\016m\n\024\003\032X\243\226\205\335\255\023\301\303\313\320?\353\021R\tt\311\240\261\273\226\244R\201{\336\266\205\355\f\373\033\001\363\023D\223j\025\2221{\004\311y\262\237\355\356z\212\366W\1776\245\245\224\376\3061rE\270v\t\304.,\214>H \261}i?uU\370\325\347\017\273\"\004\007\001\246\324\237\321\354\356\256\214C\204zRP!\"\263i9-9 \232 \333\336[\037\333\256\210\3427\b"
+	.string	"z\264S9'$\030\344\f<\333\356R\374\005\235\220\ru\352\177\264\323\007\234ES\341\200\232n\263e\002\240\322\261\001\273K\005?\256\323}\227\252\351*\036\325\362\201uRao\303}\225\343y_\225\214\373l\247hj"
+	.string	"\026\232\002\034\036\243\331\334_\230\371B\005\020"
+	.ascii	"2\241O/0\\\020\224\312\207\364\366,l\0345\211b\260N\251\3155"
+	.ascii	"\235E\312\204Q0\352\022V\263\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_displayDrawScreen.5.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"E\t"
+	.string	"6\322A:@\305(\035\240.L\2744\242\222\304\316\t\2114\322\224\215\021\226\252\301\004\267ch\037e\365\244\350Cm\024\264\325o\355\030f\206\034\203+\262\216\007\216\377"
+	.string	"\203\t\"\233l\231R/"
+	.string	"."
+	.string	"2"
+	.string	"\016o\220]j'\310.\r\332,\b\026\002'\027\255\226\335\235\261\343\340\025\364?\362\013*U\272\0064\354\256\025\225\312\270\343m'\330f\260\r \366\261\335]G\225}\326\217E\265\252\372\331\246Q\360\332\305x\005X\227T\361\330l_\355\207\\\004<\213\364\201]\025J\312n\270`\005\3552\321\333\306)\226lwoAh\273'\215oB\361\215\262K\215\007+\216x\311H\333]\215O\"\222\320V\227>)\273|\304\254@X&}\331aI#G\036\316g\023\372>\234fNfb\343"
+	.string	"\372\270\316\374<\217\210\363:\363\303m\036&\307\373f\006\343\016\344\361f\250\353\274\271\205{l\243\312\362\303e\212\025\276(\026\255\001\013"
+	.ascii	"2\2417\034\330\270\360\224\332\334\322YL&4\202)\227`\233\325"
+	.ascii	"\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_displayScreenSize.6.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\225\t"
+	.string	"\246RC<0\345(\035\200\213\307\326)\374\365\210\034R3\247\227\256\320\303\211\203\255\001\224\276\371\317\366q\237k\261\301h\314FQ\323?#\202\004\201$d\312\t\334vi\007\001\001b\367&[\246\0242"
+	.string	"/"
+	.string	"2"
+	.string	"&\240\375\022\241\201\211\300l\270\b\354\356\266\271f^b/\230\227\021\344\340\025\364\217\362\004\327"
+	.string	"\325\352t\315@\354\256U\265\352\270\343m+\330n\260?\020\341\217E\265\252\372\031-\200F\300.\307\253\300\002\220.$\266A[\263}\265\337\372\t\370\320t\202]VL\313n\310\340\205\354\322af\333/y\036\251x\262-q\226\320\nFw1/5\"\230\342*_\266\233r\360SJ\025\331\310\245o\232\227\217\006!-\224\276\354\360\244\361\303>\266\221ec\352\371 \217\250C\372D\\f\017\307\24231\372\270\317\366y\240\022\347}6\021\327\tm\036\357\3338\007\356F o#u\235\267i\341\336\236q\203\212\031\326\024\213\3268\343C\r"
+	.ascii	"2\003\3020\005&d\220\035\330\233\322\\q\3062\327\360\207,^\003"
+	.ascii	"&\036\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.7.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`/\001\225\f"
+	.string	"v\327SA\020q\233\016\300\207T\201\262"
+	.string	"\233\003u9\200\317\221-\242\225`EpV"
+	.string	"\270\f\360\373\004F\323#\342\2570*l1lA#vUUU\276C\372\274\345\0325\3103\377\343\232l\355\266\273I\231R@"
+	.string	":"
+	.string	"E"
+	.string	"$\270\213D^`7\244\342b\267\323xA\374s\367\003\360/\336"
+	.string	"\3743g\317@\200!"
+	.string	"\313'\245\306\356V\372\341\334\223\363_\342"
+	.string	"@&\236\347\324`w\235 \223\r\267\336\266\002\333\f\354\257\b\177\327\314\t\212h$Gv\347I\365`_\332\335\265\206\354\213\376\213\224\216/=\2754\224\322O\323R\246U\323\231\351\017\020"
+	.string	"\003\323bW\303\350\306\256\274\027!(\333O\373#\036$9\362S\250\232O\213u\025\327\323\004\"P$\007W\251\220I)T3'6\250\274\250SMu(Q\217m\bO\361\210\273%\034>\212\013Y\b\374K\305\310\260\204\237\b\211\273\313\341\233x\260E\020\177\276\b\f\227\325\341\200l\035,\332\332X\340D\370\330\260\216j\323.\n\230\326Qu0\216Gei[\265\3118\373\270\264\n$\313\264\212\352\366\322j\310/\306\312\210\2228*\213\213"
+	.string	"\313A4&\215\372O\313?\001B\235\364\0318\004\032"
+	.string	"2\241+h`<\020\022\001gl\343;\344p\231\0011\266\201\201"
+	.ascii	"\257`3\330\216\n\245\021E\b\360\323\202\tSI\013\206\353\224\332"
+	.ascii	"\334\322Y|&4\001\306\\\202mVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_displayRelease.8.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"u\013"
+	.string	"&VN>@O\223\016\367\3060f\362\266S\022\202\337PO\254M;\033<\230h\0058\357W\324\377\277E\366\022<\032\024\033Q\235x\244%\035\303\304\234c\206\234\374\013\367\030\312.+\356\2777\2212\245<"
+	.string	"8"
+	.string	">"
+	.string	"\027\260+2qb\227\243XA\3743w\002\360/~"
+	.string	"\374\363f\2578P!"
+	.string	"\013\020\310\213\335\245\224\303\267\347\346?\304\001\204:>\317\f\006\273\353\fu`\270\365\266\023\330^`\237\023\327\211\007\214\221Fv6\367I\335`_\332\335\265\212\354\217\376(\245\341K\277\227\226\244\264j:3\375I\362\301@\310\356\205.\306\212<\024\036&\333O\373\036\377\330>\362\004\372\364\0262ldgUI)\240\221\352!\rT\021|\200\2302\252S=i\340\320\217m\007\007\321\304]\016\213O\202\002\326\201\177\251\005T\030\302Gt\342\356Z|\021\227\026;\374\371\036\370\027\025\346\272p\264\313\212\306T&\\\036l4+CiY%\301\3122\324e]4\024&\323\250\312\304\330\246\312(\016\206e\324\304\355\245U\221\237\013\021\r\3350\324\022\222\024\017\265x\n\365\240\221w\217"
+	.string	"\245\024"
+	.ascii	"2\241\213/0.\020\302M\302`$\344p\231\t\004\333`\220\0266\230"
+	.ascii	"JZ0\\\247\324\346\226\316b3\2411\030p\t\241YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayReleaseAll.9.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\025\n"
+	.string	"F\223F= \345*\035`!\316B\020\\]\b"
+	.string	"\b\3124?\002\377PX\305\001\300Z\036@\356\2625\034jboa\005\225M"
+	.string	"\275"
+	.string	"\3000F7a\306Y\200p\201\324#\346\273\223O6\331;\2452"
+	.string	"2"
+	.string	"7"
+	.string	"\r\335\251\307\037p\247\335\r\270S\213v\214\302\306@\001\216\231\200\335\255s\344\342\245\350?vM\313\245\272\314D\354\256e\313\345q\317\333f\260\ra\177!5{T\311)b\177\333\335\365|\331\207\375\333\224\226R\372\231\007\220\204"
+	.string	"\273\0355\002K\243.%\033\333\227\366O\216\"\036\226z\301\356\213\245ewtp/\031\227\314\004\200Fn\323rz\023\302\232*\333\337g\025\335.\313\343\3132B\024w*'\002\214-\256\202\352v\327\343\247\234.:\222S?\305\235~rb\003`+\031\"\020\351c\nI^gP\007\3433Q\n\275P\rA\321\311\003C\225\344}(*\b\fk\207\343\257$\002\253\351\373\300\272\031\367\333\316\227%>h\253\251a\177\304\331\336WF\004\001\016"
+	.ascii	"2\241\003/0<\004-\354&5\237`\260Y\251\035-\035\300d\202 \030"
+	.ascii	"u\t\253Y\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.10.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\335\013"
+	.string	"\326\026SA\020q\224\016\033,\222\366a\235M\030y\024q\bT&/\250\005\b_<k\017\353\225\342\340\324\262\266\327\277\213y\013i\357"
+	.string	"\221\355\252"
+	.string	""
+	.string	""
+	.string	"\315 \365\"\030\007\355#mO\230\027\023\270\367\2262\245C"
+	.string	"?"
+	.string	"@"
+	.string	"\333a\032\342\243\303\2479\362_\362\207\362\241F\007G:\364\360\367\n\200\240tP\220\0222\243\302mH}\226\017\025\254"
+	.string	"\334\351]X$ ^\362Lq\246L"
+	.string	"\021v\327\331\301q\270\343mO\260\355\300>\202\251\351\307\b\222B"
+	.string	"\306\256G\013\307\276\200,F\330\026\331\025\333\231\366K\334\204\350\253\320\005\354\252Z\234\354v\f|\271\016\335}@<\274n\211\207\266\335\340\201\310\243w\"<\036\222B\231\330\330\255\bU\344\215\230\234\320x\337\342\365$R\270\260\205\243\330\256\335\023\004\377D\206\013\327\310\3415A\214U)[O\026\311\307\nu(\252J\220q\312\033vGJ\025\261\377vw\255*\303\257~}\351\034M'\003\332:\331e\rFC\206\302g\3136\330\246q0d\332\006\353d\231\n\230F\3330\214\001{>\034\r\003y<\032V\351\366oU\345|\013\236zyj\3126\324\003%59\025\352Q9J\031\021"
+	.string	"M\204\336\031\341\265Qd\210\3235X"
+	.ascii	";\202\350e4\233\300\026\320\275\226\260>\027T\212j?\261\314\f"
+	.ascii	"\022\032\275Jc\2265\367"
+	.text
+	.section	.gnu.lto_displaySetXY.11.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\335\t"
+	.string	"f\022C< \005)\035 7\005\243"
+	.string	"\361! \270\r\332\333K\024\253\227\032/Z\211\326\200K\225m\330n\327C\026cfFf[$\b`\361(Y\364n\215\006CP\245x\241H\343\266{\247\024/"
+	.string	"3"
+	.string	"0"
+	.string	"/\330>\271\023l\237\016m\233W\221\275\254Ccv\263\273T\206<|\f\375\313\036\320r\255\036;\020\273\353\330rq\334\362\266\021l?\330O\b\261\263\231\314\030\310\354n\324\002,m\306\220\330\276\307\216\325\034d\264\031@\341k\312r\367\243\006\364h\037\345)\341a\252\017\354\276Z`v\353\202\025\270O\3276x\226\227\022)m\212\257\244\270\335m\360g\030\026\0024#\252\355s\252\270"
+	.string	"\360`\305\232]WQ\202\330\347\354\356Z\276\354\307\376\371\372\313\303\376\250_|\024\"u'\220\344q\016}P\235\204\t\364D\024\374F\025\336'\242$\257\233\240\241\017\244\237\003\227L\243\217\236J\245\217z\352\236\263\362\345\210\023\032Kfx\312\022"
+	.ascii	"2\241\033\034\030.\250\243|\001k\232\366\r\333\n\r\263\326\270"
+	.ascii	"0|\303\030P\016\f\006F\360\031\026\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_displayWrite.12.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\204\001\035\017"
+	.string	"\006\235eE\360\260(\035\031\211Y\037\232\301x\317\343g\2738\255\353\331\245:3\366\270:,N#_\372\363\342E\213\314\2321\374\252\215\300\224\373\265\006Od\023\031\207\257\347\n;\033)\3357\277\277\315f\033!{\023)S\nM"
+	.string	"N"
+	.string	"W"
+	.string	"O\373\260\233\360\376\265\334c\367\205\242\305\356g\300\005\270C\177\234m\237\304KxvL\373<\270\276A\003\253\346\306\356v\241\007\210\207\332?\342\241v\270\367\364\374\337\\\023q!F\313\245zn\013v\327\331rY\270\365\266\t\330V`'H\251\034\354k\253/\203N\363w\374\373?\237\371=\267\371;\232\3364\035\2714\334\322ZLkL'L\337#\302\220!\340f\267\302,\307\346@\234\020\266=\373c[\263\231"
+	.string	"\002\332\325\211\f\thd\b4\355\003#\336gX\254\27315F\002$\276\013\025\007\034J<\204:\340\003\314\026\235\005\n\247)\224\211\341\200u\250=\372\n(\023\033\201A\325&]\005\013\267\273$~\n\b\017"
+	.string	"\320"
+	.string	"\321\022\017sF\313\206G\017\023\363\2223_S\265\206%s\311\231?\331Q;\202I\276u\r\201y\221\263R\225\375\251\002\251\257\234\302I#\223(%e*q\036\211\254\210$\234\244J%]\nER)\241J:SId\322\215P\251N$\304\247\023\022\252K9\235P\335\347\333k\253/\333\006i\310E_\374\221\035\215\272\351G\r\025\244!\226\252\354\321M\317\222E\375\f\226\214\301q\032p\273\253\036"
+	.string	"2\241\021\374P\2620`\245\243\322QR\211"
+	.string	"\231\260ERi\200e\216\"\215)\263\327\356\345\233e\236\313\bsi\027\306\2155G4\314\342\325,\267Ba00\300\005\214\003\303\370\f"
+	.ascii	"\214\020\250pp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_displayWriteChar.13.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`l\001e\016"
+	.string	"\366Z_D\020\221\223\016\300Kga\214\272Z\243O\r\276\217\310\217\224\323\004\277\215\325L\346\240O\b\232o\254Y\034\233\354G\224\274\255\204\301\334\332\t"
+	.string	""
+	.string	""
+	.string	"\245\251\266\205\200)\210\322U\034\030\365\254 i{o)S\nH"
+	.string	"H"
+	.string	"R"
+	.string	"\334\273\225\207\354\272\320\250\330\355\016\330"
+	.string	"v\350\016\263\355\2178\t\316f\361:\016\255g\370\2602qcw\263\317\003\304\303w"
+	.ascii	"\361P7\234{r\376g\376B"
+	.string	"\260\264`\265PO\016\203\335u\262Z\026n\275\355\002\266\027\330\351\366\\\346\367x\314\337y\367w\034\346\347h:j\032j\372\305\264\302t\276\364A\242\215\030\002^\273\025^9\026\006\254\001a\233\263;\266\f\006\0051\247\203\254J\006+\201\246\215`\204;\314\311\272\333Bc\344i\337\365\022\001\242\3274\300v'\220\370+$hX\212\022\350\340J\331\301S\244`\251\360\345\205\bWG\355\223\323\300\027\0278.\250M:\212\023\266\273$\376\t\223\007\0373<\254\304\303\264a\325H\345\313\377)r\364Zb\231\241\320\242\312\227\335\241R5\330\177\253.\001\241\253<\302E\241\021\b\3054\3220\207DT@&%\223V\222\2316\021\004m+\311F\032\350$\013m\246Ld\200I%\321\226\241\220H[\326\351\366\266G?)U\371#\237B\215\332\241V\365\350g\245(s4\352W7P\357\241Oo\263\272\t\037"
+	.ascii	"2\003\3020\016l d\030\356e\304JG\245\243\004\345\206&XP&l\226"
+	.ascii	"Tn`\231\243\250\316T\302\316\206@\326\204\347\032^\2611\300\301"
+	.ascii	"\302TM\200\240\b\030\007\006\006x\004#\370\f\013\346\nT8\270"
+	.ascii	"\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.14.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\t"
+	.string	"\206RC<@\305(\035\340\345\376\267\013"
+	.string	"\37700F\214f\270\364 \203N0\317\256\355\2008\213V\257\276S\365\207\332X#[\375\326\216af\223\001\317+F\344w\021\310\374J\354\336d\313\224\0020"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 J6\375\023Y\375\303\245\001#\260\373M\030r\323\325\344\037\345\231IGL\305:]/\023\273kU\2618nx\333\013\266\037\354;\177\226\251\025\252\177\271l\0048\030\260\273\212\025X"
+	.string	"\261\245\304v\311\306\330V\265\177rW\351/\322\007v[\002Xv\277\0063h\217\376^ \037\265\007\360d\233\3420\317\n\0067\222\217\n\023lq\025O\333ME\370)\242\013\215\344\321'\311\307C\203\221\027Jc\366wR\bb?\333\3355lY\376\025\235\315G\023\362>\233\346Mf\244\251"
+	.string	"y\033gz]G\264u\234\371\3314\236\271\351\274\231A0\007\352t3\304q\335\304|{K\250\200\202\031\306h\006\255PB\t\217T\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayIsSynced.15.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"U\t"
+	.string	"\206\222B9@\217\322\001\230\016\013?,\273\0340\313D<M\200c?\002W\332,i|\264W\177\027m4\030\215\331\260Q/\351\030&\3261L\240z\301E\250\223\277%vo\262eJ\0010"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032PN=\374p\235C\345B&\263\033r\321\343\251k\312\277\311\265\021\215\230\326Ku\325@\354\256\265\365\302\270\343m#\330f\260\357\277\246\2515\252\257\321d\300\020\270\354\272f3\373\"YDl\243\354\215mU\373$/A=v:\300.\254ee7Tp\302v\351\360\002\363r{Qe;\342\262PJ\205g\232\227\032\r<q\024p\333e9\370'%\212-\344\322?\315\313\307\001\220\330Jgv\250\322\330a_\333\335u\204y>\026 \217\250C\002E\335f\017\307\324\221\030\201\335\207\003?P\251\373>\234\250\353\2048\317\007r\234\002{#\320\307\221<\357\3436\341\3363\036\254\242\2057\252Ek\234\361a\203\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayHeartbeat.16.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:0\345(\035"
+	.string	"\276\353\341\270\340R\312\264\201\026\203\365(\177\266\330?4`I\311l\315\3426:V\033\214F\251\242\246\177F\244\330\024C\265\035\220\267\3668\302T\311'\233l\231R/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\227\207\031\373\221\223\211\327\313\356\316\210q\360\n\372\007yf\305B]1\t\273k]\261*\356x\333\005\266\021l\307\002\317vw\035[\366]\177\026\325\252\352k\030\216\225M\311.E,\300\302\244\312\206\306\366\325\276\307?\300\273N\017\330m\231\240\354\206\0076\330.\035\006\032\013UD\331\356\376j\330vU\035\237$\3423i\227\032\tX\354p\021\323\266\273\035?\244\364\260i\\\372'\355\3621\246\264"
+	.string	"p\2454f\207(\215\027v\241\217\310C\372D\334\346\017\007\302\2630\3728\320\374\274P\211\363@S\304y\030\346\307\373&g\343n\024\362&\251\353\274\251\t\367\331\306\226\025:`\251(\341\214f\321\032\035\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayResync.17.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B;@\305(\035\340\245\373\355z\001\306\3720B\232Q\220\202\224\301\313\360\244\321Lp\246\261}\224\325\223\242\017\265Q\320V\277\265c\304N\324"
+	.string	"\270\"\353\230\t/\332+\371d\223-S\n/"
+	.string	"/"
+	.string	"3"
+	.string	"'\310.\265\017d\227\376\354"
+	.string	"\0175\366\"(\024,\001\273;c\306\277\353\347\177u\013*U\272V\024v\327\212JY\334\361\266\rl'\330~\005\307vw\035U\366\301\037\213jU\365\263\n\230\202q\355V\274\006lK\236p\\l_\355{\374\343;H\272\300\256\212\244d7D\360\201v\3510\227\213S,\331\346\316r\320vO\032\177D\302\033e\227\032\013"
+	.string	"\370\341!#mw5>\210\bB\333\270\364I\331\345c4qu\200&}\331aI#\206\035\036\316g\023\362>\233fN&b\303"
+	.string	"\362\266\316\364:\217h\353:\363\263m\032&\247\363f\006c\016\344\351f\210\343\272y\t\367\330F\225\027V-S\234\260E\261h\215\016\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.18.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\375\t"
+	.string	"\366\222D;0\345(\035\236\213'\230\235\300ILT\302\332\275\322\031X\364\310\177HQO\332\334\326L\377\365\361\032\214\306l\0245\3753\"\"\031\300\340qS\264\362\005\nye\b\341\266r\247\0243"
+	.string	"1"
+	.string	"3"
+	.string	"(\247\342\354\270\320d1\255\223"
+	.string	"\273\263\033\270\201v\031_\240]*\307S\217)\377%\317\204d\270\270^\252\307\355aw\035]/\214[o;\3016\203\375M\321\232\211\216\032}nk\201\341\260\354Z\314\004\354\213\\\001\261\215\2625\266c\264\037;\t\352\363t\202]\030"
+	.string	"\225\335\271`\005\356\322\223\263\355\213|$\252\352\240\301R\225m\357)\020(\024\"\223r\374\335D\202\333e5\370\262R\310}\\\372'\355\362z\340\021[\305\231=UQ7\354gVa\336>\177)\003\241\317\310S\nG\036\347O\307\344\211 \205\036\250\013\301\320\204\007\202\272\221\347\021u\0370\354:\033\177\244\020\330\225\276\017\3544s\357M\021VZa\325M\337\032 \020\245:\006\020"
+	.ascii	"2\003\302\260\r\273\032\f\366\202\354\224\2568\032\213)\315\325"
+	.ascii	"g,s\rG\231\300\256\032\257\003\023\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_displayInit.19.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\375\013"
+	.string	"\206\326Q@\020O5\035\033\246p\217BH\001H_\3678\224\336\004\317\245/u\237]!&\233\375g\332\320\371\230\361Q=u\237\3606\225"
+	.string	"\b"
+	.string	"\242\243\341\226\236\035\250\310\252h\232\322!\377\325\2376\331;\245;"
+	.string	"="
+	.string	"B"
+	.string	"\273$\325j\267,`\002\333\253\313wh\257\3339\264W\223v\353e\207}\252UA\304kw9\312\341\344'\351\037\3041@\242\316\347C\301\356z\202D\027nz\333\003l#\260\217!\254\321)\203g\306\354\2623\351\006\373\331\356\256)\311~\371gG\375\224N\037\222`\365r\t\210\355\206b\260eU\024\037l?b{\226\023"
+	.string	"h\354'e\301\300\247}\323O\344Q\234o\004\337\201\220\212\221\351\0075\333\301U`u\271(\255\200LJ}\352\210\206\017\355\330\266\234D\270\355~&\376\210\315\203M\243\275\236\326\0230\026\250\214\332\343Ch\266\335\235\370\251\b\0202Rx\340h\257\222P_\245A\307`\243}\336\245\313\214\027p\263'\221\320U0#H\341F\361\333\200\"\205\273\200\235\205\363\304\221\223\004p\210\371D.\023\206\"\027)\367\331R\222\027\264`y(\005\223\335M<D/J\376\247\331\336K\004\025"
+	.string	"2\241\247/0.\016\270FR\224"
+	.ascii	"\001)\225:\351\205\274\220z\255\202{\252<\247\301I\213\273\016"
+	.ascii	"a\215k@+\f\r\n\203a\001*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`>\001\275\005"
+	.ascii	"\322\207\035'\220+\035\377\377X\355\216\375?\376\201\206\344"
+	.ascii	"\271\273;\277\271\357\373\276\277iXt\213J\032!\204\020\302\215"
+	.ascii	"\366\226{\313\024\266*jR)R\270\201\024z\242fWtO5=\256\245ZRW"
+	.ascii	"w\327\306>\224\023\322vf.\023\367$\037D.\200\374z<\340\270\325"
+	.ascii	"x\3058\265\370\244\270\224x\224\035B<\036\0160\034\026\3760\313"
+	.ascii	"\261ow4\251\273\273\330\265\331n\225\" \200\203\304\325Y\310"
+	.ascii	"5aE\232g1\0232\310\215ac<\337\230\240~\t+\004\211!\0363\0242"
+	.ascii	"]\226\231\242\207o|\343\033\277\361\r\337\370\306o|\3037\276"
+	.ascii	"\341\033\337\360\217\266\375c"
+	.text
+	.section	.gnu.lto_.refs.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e45574ea8204fe5b,"e",@progbits
+	.string	"(\265/\375`\021\031un"
+	.ascii	"J\264\314'R0R\312I\007\277z\337\276\376\252\206\371\253\274\212"
+	.ascii	"\320\275\021\332\302g\304\005\2373\336\315h\370\314p\371\354"
+	.ascii	"3\223^,7\353\376\317\252K\227o\031\236\020\244\271\356\335\325"
+	.ascii	"sU\2255\273\252\312\022\255\366\210\210\t \312\322\3522\233\251"
+	.ascii	"\252*\221hB\244L\001\013\002p\002\203\002c\244\216\360\302i\300"
+	.ascii	"\037L\036O:e7_\224\020UU\235r\027\234\2673mN.6ZvpS:\345"
+	.string	"6\326\302-\n\336\202\032\211h\201;zJ\364\030\271\236Q\250\274\307(\324\343Xo\264\252\270bE%3\353\302[;[Y\313\200\331\003\315\205\365g5'\016\020u>\344Q9;o\246\235\317&`\235\276\216\323\370G\224 >\244M\001n\365\360e\252S\261\237Z\030\035=:\275\320\372\226K\240\235\255vi\332\272(\347\263?\202\025\\\246s\357\t\366\242\006\nS\247\\\326L\306f\3472.\342\021\254\270\216\322\005\273\267\345\262\364\336#s\002?\346\004l\326\212\034\305\324\364#\254\257\373\315\317K\323\021\253N\177\206\3623\023\006\34314\331\304\274d\367\266=>/K\212\254\351T\254M\362\003V\022\235>\203\225\211\340'\355\365\361\345\350\021\327\325\351\203\326\263\223\013p\274+\236\263\276\327\247\265lB]\271\204\252#@\b\347\371Q\337\317\352\317<\f\374\354\273\341\377\316\337i\376S\371\271\204\223(\006"
+	.string	"\032\236\253\260\313\177\263\237o\316\276\374\214\363\224\341\312\177\271\237\003`)\253\377s?\361\337\205\007\360\267\332\317+~\236\340\276\277\247\f\260\376-\226\343$\007\006&?\253"
+	.ascii	"\362\217\003\377\366\372\217\304\317=2\376\327]\347\357\256\235"
+	.ascii	"\343\374\315\365\263\004?\037\360s\320\327~\326\001\272\225\377"
+	.ascii	"\376&\362\363\324\317K?#\177\306\341g\342\3174\374,\374y\206"
+	.ascii	"\237e\370\031\351g\032?\023\375<\3643\f?\277\360s\013?\257\360"
+	.ascii	"s\n?\237\360\263\t?\227\3603"
+	.string	"\t?\217\360\263\b?_\360\237\354g\023?\267\3709\204\377o?\303\370\277\345g\020\376\017\360\363\007?{\360s\007?\277\370\231\203\2377\370Y\203\2373\370\031\203\237-\370\271\202\237\005\370\331\305\317\024\374<\300\377\240\377m\377{\366\366\366\366\376\264\306\217Z\360\003\220BNCZ\266\003\022\265\264\243\3230.\344r\254S1\324\031\006+M\023\237\2357\274-\\\032\254\214\211\025-\262N\371\212\315\023:\275\257%\255$n\312\f^\247b>7dL\315\257N\277\202\007\346\262\244\211\\\017\217\033\202\211\234\220,\346\362C\357\305r\322\324\032\022\026\245\274\253\262\352 _gr\367^!\032I\037\351!:I\1775W{u\223\333\356\342'\357 \272H/1\271\214\335\250,8b&\327?\214t\220\026hQ\312;\t\272\332\207&r\002\231\214\201\265D\256\253\267\230\313\317\330^(\027`Q\312\225\210\032\024\250"
+	.string	"\322w\226\225[6\241\372p\t\"@\3340\r\311:\376\246<)\251\351\037\030oG\017\311\027\347\372>[\337Q\326\367\223\365\r\266\362x\255>\315\265\366U\003\341\326\247\261\200\374\005\371t\325\351\333\207U\207\273\307>\352\033k\375a\023\252\2127\325T\016\0245X\304z\252\245Z@C\023\327i\253\224\363\206\225\205\t\026\206\321t\221b\004\253\235@&a|\275\311I\251\302W\312D)\277\216\240c;\026\\\242\224wM\366:y\243L\210\213R\336\005\255ak\376\275\354\035\272G\363h\035\275\243}tT?\265S7\265\222\333\206b\274s\036\353\335\247\275W\351\336{\006\273\333\322L\"\215\226f\220\032\276\3623\366\334;\244\255\311\306`\3060\330\317X\2620\032\273Q\265\013\220\211R~\335\333\276\t\024\2071\032\332\nq\357\020+\003\224\306\240\262\334\335\3336\340\323"
+	.ascii	"\316\222\027\026\226\002\222\235C}\202\203\303\352\373\316\321"
+	.ascii	"L*\025-=4u\332\306>r\373\323\310\267R/\375F\251\275c7a\350\200"
+	.ascii	"\220u\232\202M\250\351\333z\376Q\201{{{{\374\243vY\325\313&\324"
+	.ascii	"\273\361"
+	.string	"\331z\216\262\236\303\326\363\221\365\334\303\312cW\227\266\3355I\002\211s\335\317I\t\333\016\235\362\325\3723\2329\234-O0`\344\316s@\250\244W\247|&G\312\026\225\247N\331\314\257\b\266/!\235r\\\016\223\036e^p@\2575;\302\300\2751\351\261\025D\013\274\241\262&\211\217Ny\f\2239\227a1\227\313L\300,\003\304\273\367\bdN\2009\201t\211\026\227\231\232\236\247\326\363\2165\005\230\347\317\231\2264\362\345\374\314\tI\364\035\267\ft\232\267\232\326\272\315\261m\201M$\257L\254\323\266\371Z\317\f\250\350\336\0363`\303\003\035\035;\2654\215\264\344iM\315\315\261s\212\234\317H\230\034\311No\303t\346\214\231U\330\227\316\226\230\021#\354\342\342\370\354\331\304*\354\213\002\267 mloo\374|\032i\nUir*#C\206\347\264\202\310\345\360\343\210\004{>[\314\005b?\344\212"
+	.ascii	"9\3530o1f\312\304A%\351\264\217\3404`\0204\246\262N\033\f\227"
+	.ascii	"\027/|\006\343\336\313Z;\254\302\356T\271*E\234`u\351\222\327"
+	.ascii	"L\203\220q\201\353\364i\323\226-\354<\323\374\211I\221\001\313"
+	.ascii	"kkc'\334\030\240\023\232\272%sY\262p\035\317E\226i\223\303\251"
+	.ascii	"\002wu\325\345\312\025v\256\355\001FX\205}\001\215\255\233\024"
+	.ascii	")\353[\255\253\274\327\276\306N\246\272(\234\023\253\260\273"
+	.ascii	"KE\365\203\243\303L\023\275Z\337\277z\217\312{o\224M{\225H\235"
+	.ascii	"\263\r\363\317\277\303(+\360?\275\350\212 \356E\002\207\304\332"
+	.ascii	"5\345h\365\024\367_\367\032{n{\225\311\261,c\022\312\227eO{\205"
+	.ascii	"\fp\307\206\334d\233\265L\231\267o{\371*e-iH\266Le\262e\032y"
+	.ascii	"\256\022\323xo\273\344I\222\035\215\234\034\313Z&\307\230\313"
+	.ascii	"\236\253t\215w\354(dUb.\223Z\230K\236\344\330q\231T\312Z\366"
+	.ascii	"p\301\025i\322\241\367\205\013\317%\225\356\223\323\325Q\311"
+	.ascii	"\343\226l\231w\314\275L\306t\225\n\334{\305T\2169Nq\032\322\355"
+	.ascii	"\t\211vdr{\357%\300\t\251\305\274JnI$\314{\221 \217\256\323\004"
+	.ascii	"\306\326\355\376\300n\306!W\267\211\351\336\002n{\257\323\275"
+	.ascii	"F\276n\367^\343\275\327\247\274j\357\255\342I6\235\234\356\245"
+	.string	"\362q\272WF*L\3676Y\231\264erL\213\031D%\312X\363\346h\215\334\274c\262\224\353\230\361\311m\242[\233K\036h\032\347\311K\21005\347\257\313\307\226\032\332\231\316\236\021\263&\235>\351\222G\226\235\316\341h\341a\207\274N[`\231\247\025\031\264>\323\2132\252\265\231\016W\033\027\327s\265\322&\223\360\202\3544E\262\361\270\232\222jU;\3462L\224N\342\344A\321\235AQS\253\250\322\354\030Ccs\242\304\210\030\030_\022\"hSD\240\3211\262$f\210'(\200\255T?\202\200F\020iX$\002\261F6\222\212\202H@C\242\r \001\212C\354\rHD5)\311F0(\f\372n\b\207GEa\320\027\003\021\233\224\262C\0335\322 \2334,\022\325\037A \202\214\030B@E\226\306\220\250\230B\206\"a\322\013v(|1\003[$\342\020\002\026\221\2021\212C,\202d\240"
+	.ascii	"\003h\300\n+\264\300"
+	.ascii	"B\221\3251bg\020c\360$%m\200\302o\006\321\020\204\034\241\016"
+	.ascii	"z^\364\002\200\027!\r\331 Kc\375\004,\036`\321\302\006\337[\270"
+	.ascii	"P\341B\205\372\026.\202\202\\\260\bZ\317\"\b-\026\2036\204"
+	.string	"/njP\331\"\244\032X#\225xC8L\211I\302\242\224\205\026\210\302\032\251\021\353So\bQ\030\n\211C\033E7?Bqa\rv\bT\024\n\207@9\305\241\b$XYv\370\001\221-\342\340\300\206b\016q\210M\232A$C\205\0223\210\2064R\226H\304&\261C\337\220\210M*\312\021\272A44\302ao@\022\n\262\354\260\210\2103$:*Ji\004\221\206E\241\234\342P\213b\020\311\206oHt\364\202-\"\ro\334\020\211\354\220\206phB0\306\220\215\201\030$\032\312 \"\005P$bg\024\207D\354\321MQ\020\007\221\035\252IB!\007C6E\342Pq(4a\347AA/R\244@\002\bk\021\0048\210\222j\020\221\214\200\210C\266\006\244\241\021P\020\211h\006\240\242!\021\b\202\023FlQ\020\207\020\021i\275B\247\322\240\234D\351\024\255j\364\007ju\264\352-Z\205"
+	.ascii	"\036\260\352\f\313\0215}\216\243Nh\016t\nE\263^c{\251\230\306"
+	.ascii	"\271\013\326\356\350\256\356n\222\352gGJ\225\022\346\323\321"
+	.ascii	"\251\243Q\021\254@\245v\236\326\262\354:Ey\240=\270}\033\352"
+	.ascii	"\343\252\222\252\275d?g\216\262\266 \353u\340\267\251\350\362"
+	.ascii	"?\252-N9(T\371\337\340t\3610\3465\265\376\201\225\b\251\345\022"
+	.string	"\335q\264)l\215\351\t\265\242;\034\325\261\365\344\366EG\362\277\321\231\013B\n\210N\257.\255\267\321[\177t\351\334\242K\315\004\343\036\227?W\256\0315wW\211\305\001t\r\333V\025)zz(\322\314\352#\357N\fz<\212\324\001Sc\024\322)j\3444_\253\374\201^\254\346\017I\320\273\367c+\2025\325fk\031\231'\220'uu\215\327M_\02412r\315\244\204l\b\2737^\257\341\331\342\361\354\264\003\202\003\250B1%\210\362\034\"C322\222$\205\016\002\013\020\b\203a$\306\314\003\022\240\024-\222S\320\031\022\021I\031\005I\2450\254\001G\251\30648\345m\320\213\031\f\235\020\271\305\277\215\325\300U~b\360\325\024\200\024|\321\332\025\035\254y.\340\336\311m\t\b\242\2530\201\251I\354t\224c\337&@*\2050\377A\247A\2060=-O\005\203\033\265\205\226\362\223(&"
+	.string	"\342\3774\347\030_\204\3278\372\320g\017\004!|a\240R\325Q\227\001\213\235\254Q\351\204\317E}\034h\311\364\242\255P\374Q&\241\250 p\230\301q\305\300\337\030F\265p\217&\007`\t?\330aW\371.\203\327\354Y\027\023\253\362\376\335\252\266\221\031G\007u\201\221\255T6F\027\\.R\326\350;\324\322R9^\337\246\rJ\354\234\216\265p\024\333\005_fe\005\\*\337\211\243\340Jx\306)\244>\360\337\017\376\345iyo+7l\027\305{G\271w0\232\031X\340vAS"
+	.ascii	"\2340\206iy\016\237d(\235/n\347\260\21268\360\355\377t-\341\002"
+	.ascii	"\260R\304\214\270\333W\214\351\212\361\201\267\254\326cqE\225"
+	.ascii	";\242\331>\206\366\333\341F\007t/\236\364\027\236\3507i{\322"
+	.ascii	"\333\367)xu\234\324*_'\t,\003<w\345\225)\013QE\317\204H\327\366"
+	.ascii	"\362\347\322\333h\353\252\035ZH \223`N\352\252\360\307\250\334"
+	.ascii	"\021\200\332%4lA\202\223O\245\251,\270\340AIg>\302\255\310Y\344"
+	.ascii	"\223\001 q\001uYV\035\354\013sV\270\301\243\037\346B\227\201"
+	.ascii	"O\275\235.~l\374\317f\222Ev\246\310APl\373\006\222\337\013\323"
+	.ascii	"\025\200\246_\177p\245\260\300d\230\222!\351g\2638\223|\214\253"
+	.ascii	"\345\241\304d\235\247b\302\215\345d\023\303\316B\376\222\027"
+	.ascii	"2xd\265Z\034\016\037N\371\222Ob\330\355\216\206.\376N\362e\351"
+	.ascii	"g\376\022\3349A\365\362"
+	.string	"\346\032O'@jX\345\022\247M\344Y\314!6\261\304\016N\231\264E\310\006\242\261\266\375\030a\372\251\031\314\204\340\230<\342\022\230\216c\202wj\220\200\303>u\363\267!\235L\231`\255Y\262_\004\361\277\264\003\214\253\217W@\013.\313\271\335<\317\255\034\364T\203\361\341\225\275\277\206 T(\254.$,\2559\274E\214.\323\222d#\f\233<\035\b\034\003\245US\340D'\"U\240\357\273\263\037\027`Q\355\377\002\r\024\266\266/M\275\202S\321\264@\375c\215\264\023\032\005:\031\002\020\234\307\216\3618\233a\334\217\356\374=\362\210\235-\207\316\007\244\344w\267R\307\211{\223\026\005\244e\255\205\354\033 U+\267\335\257\002\211\317\355\021K\354/\331X\036'H\024$+\345\237hf\240\255kq\247\342\377\253y\227r(\322\374\360co\340\357\222\304\234\363\025L\323g+\213\244u)g(\356\354\247"
+	.string	"\016\226\205\027M\306\321\025$#\216\272T\200\256\227c\307JO\350\006_\213\220\230\021\211\255\304\325_\345-\317\346\300|e;\265\243;\033\215\035\331\2648\361\332\037\377c&\351z\331\r\317\264\346{\3528\332=\344'\322F\244l<\3304\3608\334\205\244\323\340\337\313\364\261\361-\001\034\033\302\217\360\317c{\3633\004`N\324\032g\03677\006\177\370r;\214gl,H\361N\332{\214\316\361\203x\317\373\335\2138\037\340k\246\277\242aX\031\305\001m\323\267\350\213\265\233\316\220\031\330%L\273\246\337[\362\317\363>\177L\236\213\231GWv\2773M\263\341\021\361\320\325\206td\372(aq\262\254\237"
+	.ascii	"V\363\024\222\265\002"
+	.text
+	.section	.gnu.lto_.symtab.e45574ea8204fe5b,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"displayIsSynced"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e45574ea8204fe5b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
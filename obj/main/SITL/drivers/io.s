@@ -0,0 +1,851 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\005\006"
+	.string	"\024\t\024\001"
+	.string	"\027"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\006\002\007\002\006\020\311\256\332\347\002\002\021\324\314\220\352\001\022\366\326\370\351\013\023\234\253\215\342\007"
+	.string	"\024\025\240\342\234\212\n\026\240\342\234\212\n"
+	.string	"\023"
+	.string	"#3\034\234qiMf\333\302+"
+	.ascii	"\234\001G\261y*'\201\226(Sc\020\303U\260\317e\263\247\306\003"
+	.ascii	"[\\\3662g{\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 \273%\003"
+	.string	"D\003\257"
+	.string	"\025"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022\001\003\023"
+	.string	"\001\024\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\026"
+	.string	" \006\b8\347\300\034\005\020p\314\031 \260\325\213\335@\004\304\200\340"
+	.ascii	"\307`r\003V\30080\030\030\002\306\201\301T\246\275\004\267\201"
+	.ascii	"6"
+	.text
+	.section	.gnu.lto_.inline.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\343\006%\017"
+	.string	"\226RA7@\217\322\001\311\347;\213\244u\360\230q\002\316=\352{\234G\305\260\0207f\rE\274\032\2169\013#\315\206\237\247"
+	.string	"Q\024\005\b\020\321\200e\255q\333M6\221R\312\024+"
+	.string	"4"
+	.string	"7"
+	.string	"\n/.\303\371\3121\312\310D\202g\017?\323\337\320j\377|\270z\275n\334\327\177\337\337 \245t\370\367\327m\245\224\222\377\202c\252!)\026\354+\302BLd\244\304\307\f\304~p\241\252\242m\225\272\023s\300\277\013\245\335\332{\333\023\025U\304\365m\355\333 \216q\251\350\320\303o}\305U\r0\243\r\354"
+	.string	"\334JX\200<\304\020\247VV\245\3159\033\255a\303kT\252\374\274C\373\366\274E\255\305lU\023^\266\013\372H%\rV\366\254\323iTJ\244\345y\004'\330x\316\331\352\375\234s^\03708\307\030&$\037\234\256{\374rZ\225l.\360_?|\315\3529"
+	.ascii	"\244 5\215P\260\274k\333\337\275r\333\005e\250AU4EbA\n\n\225"
+	.ascii	"\345\320\"\231)\242\007\022\300c\025\304\201\030\305\020B\214"
+	.ascii	"\b\210\023JD\022\225$\211\022\203\344\001ZI|@\036\315\310\225"
+	.ascii	"Zq\376\037\0236\326\250\001\227p\332\234l\307,\267RNJP\3634\253"
+	.ascii	"d\256\b`=3D%\261\2737Yl\340\276\225\024\303k\342-D\267=8K4\373"
+	.ascii	"\274J&\375\261{\350\214\214\230\bj\337rZ^\302p7\r\026\220\361"
+	.ascii	"\232\265+\342\247\326\203\361b\251j\345J~x\215\343\212?dE\226"
+	.ascii	"\336\333\b\324L\016\240AW\256!mP%\372j\250\317(\3141\244jZ\327"
+	.ascii	"\234\220=\224\371v\352y\315\n\177#\223\033\322\202\031&g\016"
+	.ascii	"f\300,\346\344\302<\021,\276\335\235Ac'P9\217\227\323,\233\030"
+	.ascii	"\220\363\n\350\362"
+	.text
+	.section	.gnu.lto_.jmpfuncs.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 \357\355\003"
+	.string	"\"\206\024\037\240'\351\377\340\377`\031\376\377_\373\377\277\371\357\265l\366\377?\351f{\355\177\322\310\226I\006L%\037A\036\f\005\202\322K\024\177%%\031 =\353\245/bV\362\005\201\031\277\030\260 \276\240^M\363a\370a&\213\216S\265\262~\353\3253\301F\021"
+	.ascii	"1\207\200q\201\032M\324-0Ne\260\232\203\0365D\240\230%J\231\227"
+	.ascii	" \300\0200Ne0\234CP\031k\003X"
+	.text
+	.section	.gnu.lto_.pureconst.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 D\335\001"
+	.string	"B\304\r\026\240\2531?\360Os\377\377\273\376\257M\3234M\3234q\334\254\f.\311*r\310\037\317\361\032\217\361\026O\361\022G\\\207\033^8\341\203\353\202\007\016\270l23*"
+	.text
+	.section	.gnu.lto_.ipa_modref.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`p\001\375\005"
+	.ascii	"\"\307\025\035\240'\351\377\347J\374\377\277\253\316\377\327"
+	.ascii	"\377\2738Ik\275\3667YK\333\266\326\232\224)\2476\b92\217\026"
+	.ascii	"\322\276\212\210\013\205\027J{S&\fB\007J\"\342M\024\251\202g"
+	.ascii	"\312\227v+\217\001\236\002\034\003\023\244\2162\314\276\323\357"
+	.ascii	"{\316\253\334\312\37782\335C/ \320\002\0212\362\201\271\261."
+	.ascii	"\204=\262\272,2\005\002g\325%\343\271\3731:X\345\223wM\367\210"
+	.ascii	"\030\f@l\230\n\006\026\027 \334\002\023S\020kF\035F/\017\233"
+	.ascii	";'M\272\2554\0068\227\211\024K\324\027\350\2055,\211\021\374"
+	.ascii	"\336\306b8\334\323\320^9ke|1\307\202Q\267\367\230\305\342\242"
+	.ascii	"\273\001"
+	.text
+	.section	.gnu.lto_.lto.39aba1bbcd9c44cc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.4.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016\244\204\270\2327 \222\350P\013\213\212\035^\026\n\264s\025ffw\003\320\201%x\227\354uUUuUE\277{\022j\276^\307\376n\226\020\231\002\257bs6\257r\036\330\201\250\340\202k\250\024\030\034\007z\334F\363s\350@\367\360\036t\231\230m\327\215@\242M|\004\261\206\361\265d\273\276\244\266\215B9\031H\311\254(\255\244\311T\322\361\367\377|\346g\254\244\210\002d^\034$\231\021a\003L\247\377~\024\344\263\245\211\032#Jd\203bD%3\272c\005\250N\230\006P\235ZF\2552\3536\244\026\217\213RH\004*\273$d\346,$\032\365\326\277\340?\370-\002\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.5.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\302N56Po\322\001\220l\272^\212LWc!\226\355\321\272\270\261\341\020zq\001\213|\224\017\004\372\313\214@\302\fPU\021Q\214.r\347\007\215B\255\2064\262\211\334)\005\361r\346l\342\0051\331\231\270d\003|\270\030\034 Gbp\243q\204\350H\030\021\243\204\231\251\235Z\335T\0134\375\330\306n\"a\355f(\370%\026\024\026\310\237_\241"
+	.string	"$\315\235\354\371q\332a\237Z\335\254'\375\216\252L,\004*\273\033'\323\256\274R\210m\217\235\261\355\334I\027\017\330\335F)\2733\301\007\326\237m\177\344#\2173\315\374\020aZD4P^v'\364\374@\365g]\240\372S\217gw\231\177\222S%\016\027P\b\343\016\263\260\273v\240\220\350\326\3336\260\215`\373$\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.6.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\335\007"
+	.string	"b\21766Po\322\001 ;\323\216i\212w\301\022_\006S\003\022\310\361m\251\336\016#\362\021\034\003\377/3\002\t3@UED1\272\310\235\315\317\301q\031\322\310&[\246\024\361R{:\361\202\230\374T\\\362\001F\\\016\020\320#1\330)p\224\370H8\021\243\204\234\271\335\316\035l\016d\033;\013\205\265\273\301\340\2270,\254\222?\377\302\001\2206\255\261'H\235\210}jw\327nd\367\371+\265\001\22110\355v\324\320l\314;\235\330\316l\216mU\373\244\253d\237\031\027\330\035\231\274\354\316\005'X\177\236\226m\037\345)\2315\235$\036U\311\205\243efw\302\200\023T\177\372\201\352\317\215\\\273j\376WN\235B`B\"\215\353\246aw\255!\321\307\355n\033\301\266\202mS\013"
+	.ascii	"2\003\302\260\2268\0343\203\031c;\227Q&\215\321\201\t\002N\030"
+	.ascii	"\251VL\302$\003"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.7.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\b\001-\r"
+	.string	"\306\031ZB\020\221\223\016$=q\305)\371\347\340\345\242\324?\320W(\236H\024\234\351?\207\b\353"
+	.string	"\243\3565\264\256U\034u\025\024\025\3565\036\t"
+	.string	""
+	.string	"P\301\003\005J\360\324\255,v\2144b\215\020\262\245\224)\005H"
+	.string	"C"
+	.string	"I"
+	.string	"\243\247lvI\273\021\334A\3000i\271\261\273\330\201\023\240\376\364\003\250\277\024\361\355\232\270\371\026\256\267\201b:\3416<\325\301\013w\""
+	.string	"\367Q\0042.\276r\fq \304\312cw\215'\234\206\373\335\366\003\333\013\354_\b\326CW\357\376\247hMt&\032\023}M\245\"\306\200\313n\206\223\216\205y2L\370,'\215\234\205_\214\f\212\335\275F\354\353\233}\241}\225\257\330\336\221\\\300\256(E\214\335\216\201\025X\177\356,\333~\211\251\245\222\016\037<\271\312\347W\256)(&\223\231\223\034\362\026\231\265\013j\340\273\210P\360I\374\371\035\352\257\312\223\236\200\243\201C\305\203\247\3341#\364!MB\275\344\200\301\304R\003\2049\354\356\203\031\302\276n\212lE\007\031\007\375\261\3118XG\003\251\300\321\"`\0228\020B\260\017\255\203m\n8\233"
+	.string	"\242a\"Y\246a\227mw\236\353\246\310\t3z\221\226\306\303\250\004n\256\031\262\255i\017O~4\323\312\003\270K\024ff\325R2\263\335/\324\003\026"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP\226\274\232\036\031"
+	.ascii	"#Ae\016\332\215\244\004\224\252\006\232KA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.8.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`4\001E\016"
+	.string	"\306\332^C"
+	.string	"\223\223\016D\266\340\340\271\337\023\346C\213\212\233\332\372^\016F\006\036C:|\203t\n\236\313t\367w\313B\024\3430\2365\252\"\206\023UU\t\240\003\nB\230\377Y\002j\253\246\306O\310\336[\312\224\002K"
+	.string	"I"
+	.string	"L"
+	.string	"\266\352u#\270\203\270!B\355\330\335\314\300\007\304\303w\001\361PE|\373\323\334\374\323\237\013\013\214\021\227\341\3579VX#\216\303\3655\220\341Z"
+	.ascii	"p\240"
+	.string	"w\200\306\305QO\022\027\312\274\034\354\256s\304m\270\341m?\260\255\300~K\351\367\322\372\356O\220\213\306L\201\324\256\206\226\217]A\031&\374\230\247N\256\302p\206\306ew\237\342(\223\243\260\236t\230\330\233\023{\363\315\336\244}\230\237\330\336\241<\300niE\214\335n\201\023`\207\3560\333\276\351/[\372T),\240lY\365\351Q\177/+,Q\315S\226\360\026$\330n\210\201\317\002\203\346\223\250\240O\035\001g\203\007\314'[\372\243\006\351\203\032%\246vPa\305\340\be\017\273\003\245\206\260\377VKvLc1}\301t\204i\b\003Z'-\302\321:Y\211g\344B\307\023!\233\320\201@\222\211xJ2\016\001k\024F<\231\005M\363d\233\356\363\267Z\262\256L/\364\002\361`*\221\234cJ\262\215\351O\277\212h\306\352\243\240\027\365\322\207\334\252\b5\352\205J\251\331n\231\370\024\006\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\276\305\022\2351\021\007X9\342\3254\312\030\t*s\320n$%"
+	.ascii	" \315\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.9.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`4\0015\016"
+	.string	"\306\332^C\020\221\223\016$\375\301\017::d\242/\346\220\366\353\313W\351\030\275\253\364R\353\037\252a8$k\357\376Z\266\342\030\346|\004\243*\216\370\005"
+	.string	"\200\"\360\214\002\202\016\262\013Q\016\2212\206\b\331{K\231RK"
+	.string	"I"
+	.string	"L"
+	.ascii	"\266\352u$\270\207\260!B\345\330\335\354\300\t\304\303\367\001"
+	.ascii	"\361PG|\373\323\334\374\323\037\213\n\315\210\323\360w\034)\254"
+	.ascii	"\021\327\341\372\034\300p+\0018\320"
+	.string	"C0\363\342\250'\211\013e^\017v\3279\3428\334\360\266!\330^`\177%\351\367\322\372\356\317\217+F\306\300\215\335\r-\036\273\2022N\370/O\225\234\205\241\314\314W\034Er\025\326\023\r\313\356\222\330\233\022{\363\315\336\244}\227\247\330\336\231\\\300n\tE\214\335\216\201\025`\207\3560\333\276\351-[\372T'*\240lY\365\351Q\177-),Q\315S\236p\027\"\330n\250\201\337\"\203\346\227\260\240O=\001\027\243\303\345\223-\3551\203\004Bm\022S=\240\260^j\204r\207\335\201RE\330\177\253%;\246\261\230\276`:\3024\204\001Z'\r\302\321:\331\210'\004C\307#!\243\320\211 \222\201xF2N\001k\025B<\331\005M\363d\233\356\363\267Z\262\256L0\364\372\370`2\221\234cJ\262\215\351O?\212\210\306\352\243\240\027\365\322\003\270U\021j\324\013uR\263\3350\361)\f\034"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\rOBt\216_9\342\3254\312\030\t*s\320n$% \315\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.10.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\f"
+	.string	"6\231XA\020s\223\016\300\300BS\214\205\216\036\2613\376\taS\346\214\345,\226\035\216\030\034\252\371;\266\356\206\320]\036a\001\247d\0240\t"
+	.string	""
+	.string	"\020A\030\"Jy\266]\321\324@\356\246\201\b\331{K\231RG"
+	.string	"B"
+	.string	"G"
+	.ascii	"O\241\331.\217\023\261\375\303K\312\n\036\273k\205\274@<|'\020"
+	.ascii	"\0175\304\265?"
+	.string	"M\315G\371k\260\322\201\266\r\327\347@\306fB\300\346y\007r\2708\351\031\332>\231\223\310\356:A\233\206\033\336\366\003\333\n\354s\002\236`:\236\373\337K\353K\247\246O\001\310`#CcW\245\373\2615 \f\022~\313K'W\341IGW\235\330\3255\273\262\375\264\317\362\221v\216\363\001\273\242\023/v\271\005N@\035\232\243l\373(\002\022\342A\251!\037Eq\324\353I\317\025\037)1/\271\344-0j\367\303\300gaR\301\037q\350o\342a\324\227\216`\273\321\203\245\223\235\302\304\byPs\342S\016*;Zp|\362\305\346<\251 \354\277U\221\3752\330\225\036\321`\227\265\311HL\256,\2025\341\202Pb\215d\033Kc\300\030\005\222\314\262\200a\231Uq\235\253\310\027F1:\351I\007\3510\232\221\232\253\206l\253Z\244\243\236\227\232\271]\342\244\207\301P\302\223\235\003\344\325\276\002\024"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222kx\327&JS\361\202\306j!\230\327x\025\231 \340D$\325`T:\256"
+	.ascii	"\264\n\n"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.11.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`$\001\375\r"
+	.string	"f\332]C\020\223\222\016"
+	.string	"\270\320\024\322\346\216.EH\357\006i\037\261\215\2630Fb\346\247\013\034<\347\276\346\321[\333\307-|8\002\233]\361X\022"
+	.string	""
+	.string	"\024\340\016\024\005x\356;\037\340\226\214\362\260\221M\266\224)\005J"
+	.string	"I"
+	.string	"K"
+	.string	"\266\201\235\013\367\322\266\342\375\330]K\344\006\342)\370\002\361\224\242\270v\250\251\371\2279|q\321\261q*\207\020Z\276\215\023q\205\021jp,\006p!\230\200G\214{\317\021'\312\254$\354\256s\343B\334\324mO\260\335\300~)\020\246\365\335\237\235"
+	.string	"%p0\270\261\313\362\r\331\033j\206\n\237\346'\224\327\270\352\361\335\305\275\223\317Xgj^v\367\304\366\240\330\236k\266'\355\307\334\244\275K9\201]\022\214\214\335\316\201\027tN\271\353\330\366[\034Fs\352{\026\256\370\215R\021\221\252X\025\266\bY\311\371\311\027\016\243\244\263+z\340\277\350\200\371)4\350OW\300\345"
+	.string	"\022\003\312Oqh\214N\250Sb\352\b\026\0374;D\031\304\356B\251%\373p\225d\307t\025\3231\246)*\035\330\225\036\371`\227e\222\221p\270\262\n\026\206\213B\2115\222\231X\237\003\3062\220d\326\006\f\313,O\007:\\%\331\203)G\243\336;"
+	.string	"\023&\033\371y\245#\333\225^\346\007\261\221\270\001i\bR\212\340\266\211Q\217\363aE(?\013H\030\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023\"v\017\021Z\002\3219~\345"
+	.ascii	"\210W\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.12.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`$\001\355\r"
+	.string	"&Z]C"
+	.string	"\223\223\016"
+	.string	"8\002%)5\275\310\316\"\303-j \344\020\343\017\325\374\310\n\344\247Kb\027\271\017\272\355#\021\034\343\243\316\251p#\240\252\252W}\243\202`\314\3331H\243\377\232+h\311&[\312\224\002J"
+	.string	"H"
+	.string	"K"
+	.ascii	"4\260+\301\2754Z\361"
+	.string	"z\354\256\025r\003\361\024|\201xJI\\;\324\324\374\303\034\2560\021c\343T\016\035\260|\033\007\342\n\037\324\340Z\006p \230@\307\314\275\247\210\013eV\020v\327\271q\037n\352\266#\330\026\261_\ni\b\323\372\356ON\200\226\033\"\247\335\321\027dk\250\031(|\231\237P\356\302\325\216\357-\356\235<\306\0323sbwP\354\3165\273\223\366_n\322\336\245\234\300.\311E\306n\307\300\0138\247\334ql\373,\356\242\331\001\036\205+~\2434$\244*V\205,@Vn~r\205\303(\341\354\206\032\370/6`\376\t\f\372\323\025p8|\274|\362S\033\032\242\021\352\224\230z\357\031b\304C&G(\177\330\035(\265d\037\256\222\354\230\256b:\3064E\005\330\225\036\361`\227e\222\221h\270\262\t\226\205KB\2115\222\231X\236\003\306.\220dV\006\f\313\254N\3679\\%\231\203\351F#"
+	.string	"\021&\033\351y\245\"\333\225\036\346\367\260\251\250\371(\bR\212\340\246\211Qo\323!\005(?\013H\250~\033"
+	.ascii	"0\013\275\272\301-Y\030\024[q8\332\203\202\020M\2031\026\227"
+	.ascii	"bE\002WG\355\322\202e\256\341\215\330(N\304\023B\330<\t\321\031"
+	.ascii	"\023q\200\225#^M\237\214\221\2402\007\355FR\002i^\272\322*("
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.13.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 \373\245\006"
+	.string	"\002M.3Pm\222\016d\222\013h\316\200\210\261G\265I6\273\360\"\301\r\304\313\003m\013\240\006\226\340]\262\327sf\232\033S\364M\026\215\350\264u\376o\255\021\"S\217bg0\217r\033\250\211\240 \203s\240\026\032\\\006n\034\206\340\367\240\201\016\342=\350,\221\242\326\304\032\347#\2075\215o\224\255\363\215m\233\302H\210\344R\222yqb\222\"R\b\307\337\277z\313\317\330\327\243\037U\243D\0032;\037\220\314\210\360A\245\322\261\362\337\216~\252\255(n\\\023(\243\002\024\312\214\316\240\003S\245\250\002S\245\346\251Uf]\200k\242\214\222\220\2313\213\013\243\267\376\005\377\345\367\004\t"
+	.ascii	"2\003\202a\243\302r\025\216k\330\220\2308\340\204\221j\345\n"
+	.ascii	"%\017"
+	.text
+	.section	.gnu.lto_IORead.14.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`j\001=\017"
+	.string	"\246]hF\360\260(\035:\206\201=\020Q\307\211\354\340rr\033;\364\307yw(\235\235\265\256\203\033\313\034\276\002G\353\257\225\342D\013\204v\350\317^\275\300\006\236!\341\002\031w}t\265\030\033S\350\fn\261\344\223M\244L)U"
+	.string	"N"
+	.string	"V"
+	.string	"\353\202\265\330\r\023\030\201\367\350\360\003\272G\357\002\272G\333V\300\300\344\323C\030\227\277j+\232\216\335\360\323\017?\235\323<\371\026\316U"
+	.string	"acam\270r\013J\\X\001\200\225\342@\265\034$>\363la\2512=$\273\353dai\270\343m7\260\035b\277Fku\371\343I{]\332s\331\037\235\346bZc:c\372\037\004vZ\035^)4'\\\227\033\217\215\021]\204\260}\277\346\264\224\207>"
+	.string	"\223\342\323|\246\362\320\006^pZ1\273\013R\261A\217i\233l\220\355L\3731\2271]\266r\220\rgQ\342\351iOX\206\230C\277\021\215\370*N\"x\273\373\330\243_\352\036\257&^p>\363\3505\t\336\256j\304G\201b\342\307\300\356\321\243\237=a\030n\264dd\250\274\251\007\0215:\352\225.\352g\016B3B\206\215\031:\252\334a\207\251\324\227}nw\003\340(\035\022\001G_\211$\2420\"A\370&\214JL\276\020\251\364\211\0240x\"\"}( H\372@!\352\334\252\313\001h0V6\3758\240qccK\377\324q\332b\233S\223\2404\305\351K\324\251~\364\253\027\251WU\305\261\342\220\312\233=\315\020\324\316\211\034\233\0364?\b\032"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\350\247"
+	.ascii	"\013\244\265\242\255\2550<M\226e,\200\206HW4\303b\\\2506`\f\002"
+	.ascii	"e\013\320\035\3524\241\3547\257\354\221\252\034\232K\355\001"
+	.text
+	.section	.gnu.lto_IOWrite.15.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\304\001\305\020"
+	.string	"6\340pF\340\322&\035\223\240AB`\344fT\372<=$\340\202GRu\262\303\022\225S\036\2528D:I\306\375\252\310\332\025*\211\333\272\b\357\023\036a\2141\306'\250\2678\336\365`\3408\006iQ\300>\261\233l)S\n\\"
+	.string	"X"
+	.string	"_"
+	.string	";'\212v\277\0056\331\256\371;\201xm\273\200x\315,\333\307?\236=\221\215\rDK\273\333\251\211\263\0365\250\311\3623<\246\\!\256\2018\034q\331\300\003\273\313\2714\244\302\006,8\310\030q\265 \367B\210\212\007=s\\7\231(\225\335u\342\270tn\324m\257\330V`\347I\251\177\277\b*\275=\366GM\303\230VM\247\246\017\240\300\322k\004\354\206\"}\373\341\251iqh4P\330\276\357\342\263\230\013\331"
+	.string	"\217\030\233\033\272L\346B\326D\374x\375\\\263el\356Zr\2665m\006\016X\377fJ\256t\364s\224\340i\377\347@\254\307hN\262\033zM\205;n\232Z\371\0045\205\345\215\216H\254\200\2723\023E4\235\206z\244\364&:N-\244\231\323g\226\360\030\336\266k\223\342\303XQ\360}\\\342\265\224~\366\354\361\340\363\002\212\325\344\223\226H!KR\323\304\250\017:IP\213\034J:\222l\222\311\376Z\2510\373pw\327\272co\351\336\204Tyi\026\024\225\327\301\254Z0x\253\b\335\213\267\342\322\261\254`:\224\022\253*\264\254\272\013*\325\252\343\276\232\303U\251\321VT\230\023\006\270kD\216IO\0165\307V\265\037\334\b\302\266\273)~\321\313\312"
+	.ascii	"\236\335\265\020\257\345\020\034 \251\212@Hf\226\317h\331\364"
+	.ascii	"\262gO\207 /\240\030\f\" `\002!\202\326\003r\250\361\020h\204"
+	.ascii	"\020~d\227U\233X\017Gho\260\246\351\247U\355\213\03088\271\271"
+	.ascii	"\r*3^\215m\315\202\r\021+\236\\\354\030h\200\026\016\224\215"
+	.ascii	"\307\020\212\323\022\336\344c\373\006\320U\300\b\322\351\002"
+	.ascii	"\333\273\255\256\327\206="
+	.text
+	.section	.gnu.lto_IOHi.16.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\025\001\035\r"
+	.string	"v\230WC\020\221\232\016?,\254\202\032z\242\030tI>\226\210U\203m\300m\n&~`2P\032\023\317\257!\233-\375q\235\2378}\003\f\313B\004"
+	.string	""
+	.string	"rL\027\002\202\003\211\2004\226\352..bw7)S\nC"
+	.string	"B"
+	.string	"E"
+	.string	"\335\005\304C\352"
+	.string	"\342\2415\233\306\273\321^\006e\202wcw-\365p\355\223\246\346{p\022>a\270N\006H\240|\034n\233\252\031\033#\016\363\244\300\21127\"\273\353L\341.\334\360\266\021\330&`\177C\244_\247\364)\216K\214\003+v-\324\344X\030\260E\b?\346^\311;\347\214\022\373&^2y\347\215\312\347\262\273\325\241mbW\207Y\331~\332/\361\027\355\244\223wvWF,v\273\002\376\240\016\035OqE\275\367\316\013\027/y\301gH\250]Q\210\217\"\002\346\2678\210\207P_z~\250\320\302\341\205\024\312\032\355 \"\206F}\022U3h"
+	.string	"q\202F\2248\354nKe\261?\355\356ZW\354\230\2160\r\037\330\225\366\200`\227\005\312>\020\256,\201\305\340\032!\261<\031\310\002\031`\254\301'\263\036`XfU]\350\"!\335&eQ{\344*<\324\356\206\370_\366\t0\332]P<L\035)5\240^\017\363\017\225o\223!\263\303\263\202\032"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 \203\212\326\254\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_IOLo.17.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\025\001\025\r"
+	.string	"vXWB"
+	.string	"\2216\035;}\266w%}\034\3513/3\242\t\276\0322\\n\307\032G\240\301b\301\273\303\230\355\371\214\"\340\006\026\247u"
+	.string	"c\037TUU\2157\214.\"@\312\375\3379\346a\034'vw\2232\245D"
+	.string	"B"
+	.string	"D"
+	.string	"\336\007\304\303\352\001\342\2417;\306=\322\276\245\204\302gcw/\345\360\355\224\346\346\003\350&\234\322p\245\016\204\250\360\242\3518\312r\251\001\342+O\013\335(3\323\261\273\316\221.\303\ro;\201\355\002\366I\002\245_\251\364+\315\f\027\bN\273\030N8\266\005T\341\301g\371\007r\317\t\003\304>\211\233B\3569\303\301\210\330]\353\320\016\261\255\303\264l?\355\217\270\312\366\222\3107\273'\244\024\273\236\001s\252C\007?\201E\375\367\r\213\0257\231\301]>\252\335\221\3077!!\363S\036\304C\2507=;\\H)Q)\211\362\244&\037Xb\324\"Qu\003\211I\211\230Q\336\260=.\025\305>\265\273k=\261c:\3024|\031\226\376t2\354\ni\240\b\230\246\340j\200y|\\\037-tu\b8s"
+	.string	"\322.\bY\246]\226'z\207H9JQ\324\3668\212O\265\273\036\377E\003\t \355n(\036&\215\021\031P\257_9\207\203\341^\264\344\370\274 \032"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 \203\212\326\254\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_IOToggle.18.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\f\002E\022"
+	.string	"&\342xH\340\322&\035R\267W\037\032\232<\006\355\337\027m6-\214\332\244\375\203\343#\n\237\303$.j:5\3253\257\">\207\023\303\210(:A\005\2352\306\030c\fCm\216G|\343\002!\006\310m\314\030\237\020\262\211\334)\005b"
+	.string	"^"
+	.string	"g"
+	.string	"\251\307f>\262\273\343b\261;6\260\002\357\323\343\tp\237\336\005p\237N\3315>\266\366\264\227*h\307\356\202\332\363\324\271\271\251L\3714\347BV!>A|\023Ya\330Hv\367[\331H\335\034\244\310@$\262\022\267\257\246\343\304g\2278\253\033)\273\223\335\265\324\260\372pw\267\215b\273\304\226-\001\322! \234\264wY\354\237\227\335:\245\345\224>"
+	.ascii	"\004/\226\210\036\230*\215\333\241\311\307\302\230G%.\373\355"
+	.ascii	"\373*^\2039\220\017\350\264X/\030\373A\027\262?\307\034\310\005"
+	.ascii	"d|\3321\366\367)?\363g\217\377I]&\343\321x\360h\264\241\033\273"
+	.ascii	"#\203O/\360>I\266K\373\257\303\002\262\351G2&\276\021\205\024"
+	.ascii	"ow[\270\317K\227N\213\005\213\325\254\362\242\t!\372\332\245"
+	.ascii	"\317\006\034,X\314\323.AR\fQ\211\366\343B>\235h\305\333\2651"
+	.ascii	"\361W\274\260\370\256P/t\351\303\301\305\202\305jd\223\2220\001"
+	.ascii	"\264\244\312\343\031n\352g\037\371\261\361\303\224\264d#{\330"
+	.ascii	"\243(\225\307\376\266\273k\335\261\273+.(,[x\222N)\tO\240\013"
+	.ascii	"J\345\302\t%\001\254pBa\001SP.`\211\001\207\026TP\340K\030\242"
+	.ascii	"\300o\254\371\266\272\343\223\032\0259\345qGCE\333@\264\243\r"
+	.ascii	"\251\212\264SU\034[\325\206\360\026\003Z\223)\007\217\234\031"
+	.ascii	"\340F\342:\005\321\007\261\0277>\304\033\271\030\201b\223\341"
+	.ascii	"\244F\230\315\350\364*U\221T9b( P\002Q\346\3566b\350[b\374s\311"
+	.ascii	"L\332N\336\340\230\231v\2548\267\232a\360\265!Q\374\025\211Q"
+	.ascii	"\003:5\372a\274\312\356N\265\r\312f\274\215kf\327\311L\241\333"
+	.ascii	"\2113f\274a\2340p\264\200\343p@\322\200\207\n>\374y\224\033c"
+	.ascii	"xE^\247\002xI\221.\270\275Ku\275v\356\001"
+	.text
+	.section	.gnu.lto_IOInit.19.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"-\f"
+	.string	"\306UQF\020\255(\035(\332\316q\244\020g"
+	.string	"\231\t\351\207Rn\261\346k\2271]>\327\327\371\312"
+	.string	"\251|\273\365g\330V\036\202\242\022\215\016y\034{\001"
+	.string	""
+	.string	"\030\371\201\020\325U\276\340D\001q\330\311\305#$\222\275\367N)="
+	.string	";"
+	.string	">"
+	.string	"\325\240m\342\242j\277\001&\240\225bw\267\371\340\340\351\224\240\217\021\0068E}R\223\n\003<h\204&\252q\241\240\360\326e\201\360$\245Egw-\t\204\007\356z\333)\2669\366W\002!$\330\276\3066\225v\t\007\374(\362\334UP\202D\212\317"
+	.string	"\2365\362\305.\203\017\"\332+\b\275\264\177\341\030\300\257H\337\330MA"
+	.string	"\261+\2168D{\265x\217\354U{G\366\031\252\335}\004\230\354\265\246F\013\tJ26\033L\030_\323\244LN\004\013Nhx\235$\314\026Mr:\260Oww=S\366\307?;\353\247_\375R\343@\221@\021\261k \266bG\3243\334\007\324\325\217\003\311x\325\353\244=\033\257\333B\037\027\323}\237\r\324\251\260l\236/\264m>\354\265p\337\366\342y\337\246\021K\357\224\246\211f\323\366\336A\244\202N\333\345\256\221\266\273'>\007"
+	.string	"\241\031"
+	.ascii	"2\003\302\260\311\302\326\021\210`{\301\320\362Q3\200\334\232"
+	.ascii	"\336\370\031\243\240\341\321\025P,IX+\215\013C}\030\fsI\b\026"
+	.ascii	"\204\317\324(\270,M\215\026w\371\251\366\246hj\017"
+	.text
+	.section	.gnu.lto_IORelease.20.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\246\021B:0\221\322\001 p\346\321\210S*\332?\374Hb\334\237\204\321\370.\230B\205Er\256\337c\263)^c &\304\032\017\003\207H\347(\274z\210\034j\024\314&\236l\262wJ\0010"
+	.string	"1"
+	.string	"1"
+	.string	"\273[\247\311\301kS\202~@\270qm\344Sc`u\300\006B\224\366y\311V\016s\371\021\246\244\004\b\355\256\245G(r\323\333v\260\255`[\0269\273!\263\236\265\2415)\037\333\227\366]\376\002\276e:\301\256\210B\263;.8\201;\365\370\203\355\224\273\301vj\320\306\371\270\332\277@8fv\002\253\335\375\311\251\257\261\235R\021\306\242s\222\263Y\242\"\023\2336mr\222\210-\256XJ\362\330#JN\225}mw\327S\264\337\372%-`\335<\004^'-\002y]%}\243\213\356\213\250\023\035\204D\025}\244\nB\260G1\372j\205\347}\3653\236\036:M\2246U\245\315\266\270\253\304\355n\203\037\223\201!\020\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.21.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\005\013"
+	.string	"f\024LC \215(\035\224\323\201\231\032\037Ll\240\342POy\327\221)\006\353\005\352!\310j\025MX\r\230\333\301\266\236\366\007\323ig\320\264+\214\ny\247\320\224<\264kBj\254\016\350\343j%\210\354-wJ\0019"
+	.string	"8"
+	.string	":"
+	.string	"\226s\\\227\361\033\327\245Fx\367\250\260\363\017<\226t\030\021\362F\327\030\202!\201\007\f\357\023+*\326\205\237\016E\036\b\302\n\314\356\032\206<\006\267\274\355\021\333\037\366-\001$\254\335\005\255\024KB\202\250`\373\266;v\3056\204\366M\337\320\371\344<c\367S}\330\235 \366\300.=1\333~\206k\350\270\213S\202w1\301\001\202\224\211\335\231\005\233\247\004`\273 \021\037e\200"
+	.string	"\266\273\247p\351\027P9\nq\302\344\201-\205`\001\265Rs.\250\r\276\026\207\025\b\242\260\347\007j\311~\\\375\034?\177h\350K\r\021%\002\233\006\235\271lZ\266\3414\0034\356$K\321LP\262\f\267\311.\035\336"
+	.string	"h\270,\300\266qYez\036W?\277D2i\324\237n\361\200\244"
+	.string	"\372\335u\025\2511\036\375D-9\021"
+	.ascii	"A\204n\211\030U\004\370\205\315i\265\3413&A\303\243+\234X25+"
+	.ascii	"\271\220\003\215\341\321\224\035\320\004 %\240T5\320\\\n\n"
+	.text
+	.section	.gnu.lto_IOIsFreeOrPreinit.22.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\226\001\305\020"
+	.string	"\266\240sG\360\320&\035\270\263\007\224.G+\004\264\322\030S\201\212\005\271\211j\022\207\311\337v\214\276\224\034%\220O!)\2056\337pN\373#\340\304'\270Nd\023\026B\314\234\377=\304Sar\003\"u\rf\204\354\275\345N)f"
+	.string	"W"
+	.string	"^"
+	.string	"\367@\243\312A\252\025\344V\346\247gt\312\215'\277\302\2635\n\032\212\361|0\247\022\204\347[Q\372T2"
+	.string	"\t\032\"\266\257%N\211\200\003\320\252\364Y\220\036B12n\323\022\345\\\375\340\304x\276\325W*(qAE\351K\311m\347\306\210\277\036]>\226\030\263\221Z\253c\206O\303\255\3356\312\366\001\373/\002\326dtv\327O\035-\035\275\321\007p\230\032HE$a\255/a\216\nc\372\200\260}\377\346\257\224\203\316\\"
+	.string	"\231\250\265n)\366\366y{\305\336l\307h\277\346(V\356RyG\255\254\032\026\265\202\tl@\3734x\017\372\251]"
+	.string	"\375\264m\220\220\025\237\016\316\274\004.\366\211\3566\300\211\021\367\273\2733T\253\220\270\362H\365\023\252\355\3676/`\024\224\212\301|R1\224\333z\271\273N\004\255V\026\021?\307C\361?|\372\023\350g\266s\365\203\303\205\212aL\210\024\261\265\n\245\373\327;^2B6\206\210Xb\222\r\246\342\266\354o\030\206\241\227e\313\030\235)\272\344\2433q(\236\t\005\223\347\200{`bp\302\225x(\334\007\001w\020L<NB\327y\334\006\242\276,S\"\027\254g~\347\267\371\002\242\023\260\036\372\237\250\224\353\021\324\246d\255\265f\333\362\215\220t\212\350\262,2 \211\346\346\006S\217-\216\204:\314m\371\255\r\256\315H0\314\250z\342a\3276\034"
+	.string	"Q\bx\2523\306p\033f\037\244\366\274\356\245\261a\215E\030\r\031\222\231\222\302\214\304\030\002\2733\233\226\203\231\207w\224+\373\300(\322`\303\020n]\206\230\273\034\224Q\317\253\215k\2501\255\256"
+	.ascii	"s\212Z\265\007"
+	.text
+	.section	.gnu.lto_IOInitGlobal.26.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"E\n"
+	.string	"\006\023E<@\305(\035\240\256zs7C\261\311\262\300\032\t\027\215j\2049$\272\203 \240\r"
+	.string	"\346j\304\377\306}i\263\030\240m\235\3221\314\232%\270\241Z\2343\177\344r\022id\357\275S\n2"
+	.string	"4"
+	.string	"2"
+	.string	"\236\177\351\250~\260B\362\201\243\323\231\331]\0010bf\242\t,\305\311z\3746N\227\017\237\360\212}\340\351\361\322\331]\307\017\254\270\263\333\336lo\354\317\230S\377\343 \336W\032mD\241\265X.`\273\341\346\324\b\332i\346\004\331\351\374@vz\214=\273\345a\306\276\304Bb$\300\356V\211\341yJ\357t\312\030&Mv\371\360\261\305\021\023yAD\001sww^\312\224\035\226b\334\335\221%\312\376\352>5\200\241l)\273\023\261\001\353\242&\032_\335>\353\036~\350\242\216\003M{8\334VC\335\347a\353\030\252\303\266\320P=]\250r\n\314\201>]\025q\\W1!\351\022\245\272v\002\300E\222%S\231\262\202\212\3745\031\355\210\017\371e\024"
+	.ascii	"2\003\3769\006\324\201\030Q\230>\314\002W2\355\205Y\f\314\225"
+	.ascii	"\313=\335H\020\372\004\267\312\213\020@np\253\354\264\354\347"
+	.ascii	"(1\207w\256\371\004"
+	.text
+	.section	.gnu.lto_IOGetByTag.27.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\242\f.4Pm\222\016d\254\210\206\330\200"
+	.string	"\242#\023\004\222\267\321\303\006\370\334\"\007\273\033@\265X\252\343\236\354\237\231\231\346N\027iE\314\272!5\236\035mc\023\231\002\r\233\017\316\321XU\363\270\216D\345\030\032D\265yh\034\347i\232\314VD\307\265\217e\271\206y\331\213bH\361/\304p\343\013\220\250\361%\265\305\242|\224V\034R2/ZXRe:\361\370A\217\371\221}\202\002\250\244\21113\003\304$\363!lp\351\364_\221\216\200\2762\257c\324\222\220\n\222R\346k\277\022P\235.\035\240:!G\257\262\353\n\210Be\001\013\2319\263\020\215:\366/\370\017~\214\b"
+	.ascii	"2\003\202a\243\302v\025\216k\270\005\013\207\334\020\346^%\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`L\001%\006"
+	.string	"D\bH\002"
+	.string	""
+	.string	""
+	.string	"\002\004\177\024\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\005\177\025\006\177\026\007\177\027\b\177\030\t\177\031\n\177\032\013\177\033\f\177\034\r\177\035\016\177\036\017\177\037\020\177 \021\177!\022\177\"\023\177#\024\177$\025\177%\026\177&\377\377\377\377\003\032\177'\201\200\200\200\002\033\177(\005\031)\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\003*\001\034\177+\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\006\027\241\213\331\375\003\001\204\001\003\007\b"
+	.string	"\034"
+	.ascii	"\240\b\256]T0\214 \232\361\265]X\204\205\245\361E\017\200p\200"
+	.ascii	"p\360\r\360\r\360\r\360\r\360\r\360\r\360\r\360\r\360\r\360\r"
+	.ascii	"\360\r\360\r\360\r\360\r\360\r\360\r\360\243m\347\030"
+	.text
+	.section	.gnu.lto_.refs.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.39aba1bbcd9c44cc,"e",@progbits
+	.string	"(\265/\375`\034\024=["
+	.string	":\2260!R0\020RJ\007\326\273\377sq\231\371\263\273\201\016"
+	.string	"\030"
+	.string	"\216\303\361\367\325\317\"\3373"
+	.string	"q\311\325\021y\0013l\253\377\344\3031\255F\246\027U\200I\035c\227\323\261"
+	.ascii	"\311r\022Q7\020\217[\246\335\247\b\341Z~\233a\321\364\265 \220"
+	.ascii	"\222'm\313\024\247\001\375\001\037\002\227\001X\231\312\315\334"
+	.ascii	"\363\b\327U\017\003O\271*&\325\0016{\\Y\273\352Y`\177\226\362"
+	.ascii	"\3066\367\216\f\271\352\317o?3\341/"
+	.string	"v\003>\237\244}\326\335\372\354\230Yc\005vUn\373A\242\001\253r\325\233\300\236\235\230}\201\302Q\230\215\325x\312k?\243q\332\325\266[\255\273\317_\255\036\203=\341\262\035gO;\203\200\351\352n\017\301/t^\3433.\013\221\243\373\252\n'\356IK\037_wk\342\307\204\t\023\254\034\231Z\364F\375\004,7\203X{\206\330\013\261\034\306b<\005b\262s\023vr\033g\333\323\356\226\307\346\216\f\220\263\253\036\210\375?v\236,=t!{\006Zy\030h\375eG0\210U\255c\020\353[\006\261\262\f\300\252\376w\206\363\177\243pN,p\250\371\372\337\030\376\353\375\367r\233\377\276\260F\226\374\2576tB\002\357\371o\322\177(F\377\360\337\342\0237\237\377r\240\001\t\f\276\363\337\013~\036A\204\004J\\\347\277\025\204\230\3408\377\0352\372\017\302o\376+\364\277\313\261(\360\037\214\360\277\007"
+	.ascii	"\377K\300\317!\374\\\3643\214\237_\374L\3643\006?\263\370\331"
+	.ascii	"\202\237+\370Y\202\237\207~\206\340\347\240\237M\374\234\300"
+	.ascii	"\317$~\036\361\263\001?\207\370\271\200\237\177~\016\340\347"
+	.ascii	"\236\237s\376\233\371O\366\277\355\277\230\237\201\377\271\374"
+	.ascii	"\247\3623\377\377\373\257\346\177\232\377h\376\363\375?\363\277"
+	.ascii	"\314\177\267\377{\377\311\374\037\363\377\355?\003\377\255\374"
+	.ascii	"\027\340\357\357\357\357W\277\376\373\301\257s&Y\375l\257\242"
+	.ascii	"\252\264o\267\315\355\274\212\246\360l\245\320g+e\366\264S\312"
+	.ascii	"\354n\243=\317\263&\223\237\323\253\350s*\215\372\264\263\231"
+	.ascii	"=m\326\300:\245\321\347\2344\332\363\2346\243O\347U\324\207\006"
+	.ascii	"\255!}9\322\210\2011\017OgGAU5\241=u\317V\332y\335|v\243\241"
+	.ascii	"$\272\253\244\320\274\246\017fc\252\213bRkJ\t\200b\302\222\266"
+	.ascii	"\263\356\231D\332\235\204iFCE\300l\353\232\b\3271\263\252\372"
+	.ascii	"\351Fw\001P\335L\356\272\356fv\267\020Z\325v\377\350yvAAuO\375"
+	.ascii	"@u\025\263\355F\367=\343\302\026}N\261\244Bme\323\256\306\321"
+	.ascii	"2\271\253\363\256\240\354\224\031\326O\335\315d\330\256\350\216"
+	.ascii	"1\3672\251=\256\004\341\272c[\23538\234\324]\365\366\345\277"
+	.ascii	"\313\374m^\223\343\274\255v7\231\017\330a> \b\267\325\034[\325"
+	.ascii	"s\035{\236\376\013\253\271\236z\303\\\0170+m\213\303f\205\306"
+	.ascii	"\243e\274\2479,4\"x\332\036PY|gr\350\236\324\316\256*\346'\b"
+	.ascii	"\247V"
+	.string	"\344\314\314\224\340\230\234W\263\f\220\016\232;&%{%\234oO\276\310\214\021z\t\031\"\275\252\230\326\231\003\205y\004\310\033\253\307ul\027\202\351I4\005-\314\377\300\020\3531\036w\341\272)\n\274\324\300\360\027\366\302ax\312z\334\303Y\013\337\375\247\355vv\267\036\303q\034\327\235\265\220{\022\246\273e=\266\302t;\315\266\241\024\2449\311\361\314@\245\303\330\215\312y\274\205\247\"\230\313\037\030:\220)\326_:k\226\254\351\333b\317\"V\376c\021\353y\b\313?L\203]\026\340\232\032 N\334\206\203f\332eu\325)\363\360\267\335\315QGlX\371\301\362\034_\341i\t\306r\256\302r\0176\333n\357\r~hcW=G\331s\211\025\370\367\307%\3263\024\333\303 \326+\336\230\"Y>\314\314\356\031?\241PI\355\361\2556\346\232\244]\365\236eI\302\225v\325\253MddD\270\240Mx"
+	.ascii	"\303\027\026v\307>\2644\215\b\2200\301\252.gQ\261\3371\216S\340"
+	.ascii	"\211\264\311\027'N\266<\251X\326\374\270\354\226,\271`i\244\366"
+	.ascii	"\224\344h\265U\311\372\372\005\263QC\2449v\325\313\204\375n\354"
+	.ascii	"|\320\365U\257\027\307\001\363|\204\251\351\022\3042\343emn\207"
+	.ascii	"\035\276n\322\372\264Ty\313!\207\213\204\305\263\342\331\332"
+	.ascii	"\242\301*\312\221#\027\tO5\020\357)\265\247d\275\322Xa8\374\""
+	.ascii	"\301Y\303\322\262\201V\244\3105\302\222]\221\332\343\3438\035"
+	.ascii	"\374\314\270~\215\\/\372\325Lr\325\273\305\323W\305H\221\333"
+	.ascii	"9MRoVaZZ\327\006\242\346 hR{|\302/88\335\021\371\265\341\366"
+	.ascii	"M\223\235\031\024\320++\353\n\271\335ed@\302\\*97*A~\205\224"
+	.ascii	"\001\337\250\334\375\330\272\272\322!,\233s\032B%\225jib/\317"
+	.ascii	"=\031\256z`\016+\253;E\304L\023\214\256\221\301\255\257\252\312"
+	.ascii	"\013\016\023\\\231\217\274\037?\356\024QO3\331\321u\351\240%"
+	.ascii	"q\002k\353\321\343N\3314\264{\252\002\254\265+G\347g\304\307"
+	.ascii	"\357\324\341\030\257o\215\234\230\224\324\345Q6v\006\2142\202"
+	.ascii	"\245w\374\362\240\343\021\303\205\256\311$*\352B?\264\264\273"
+	.ascii	"Khf\347\025\246\247\246\200\202bd(\323\244\343\027\312v8bmQ&"
+	.ascii	"H\330_\033\367\006\216\373\3042\273\231m\353X\307\266\244\366"
+	.ascii	"\370z\252\nhG\311\026 P\367\371\373"
+	.string	"t\235r\272\277\272;D\260\016\r\233\327Uo\023\024W\232/1\3022K\264\350\2709\270\207\240\\\216(ZW}\031\366\263\301\321\364wu\325\337\035\354\357\277v\023\332\335R\301\266\241L9\353\317\347 3\320\257\303@&\321\215@^w\226\326\036\213d\255I\365\021}%\335L\237n\033\372\234^1\237dY\242>m\3270@O\003,$\2253\226I\244\260\204#\243\222\272\\B&\221\202.(!\025\221\307\245\322Q\005\022\212E\235\023\220\222J,\214\312$\013\024\214\313\245\026b\360,\255IGF-\254P:\"!\251\344\"gyD\036\215J\030J\242\321\250\314`iH\034\372,\215.\210\303\033\343\322\221Q\311fyD\016\225\222\222\222F\304!\233|A\034\252G\"\342P5.\217\312\016\210C\241\214#c\021q\270\032\221\307\0279>\310\243O\r\031C\344Q\347C\214\342\320\310\003\f\212\304\241"
+	.string	"5d\f\227\312$\214\035\344\021F\2218\024\036\351\304\017\222\261\250H\034\256G:*\215Hc\022\373\bP4\200\"E\r\341S\250p@\205\003\353S\250\020\022R\201B\210=\n!\340\262\230td\224<\n\225\222\311\025\305\340\262H\034\252\313\3178\241D\003\205cQ\304\262\230BX\303(\003y\f.\025\221\214E\311\2430y\244\221\244.\213(\204\220G\032@c\221hDR\252\220\\2*y\224F$\013\311`\t\306\026F\032-\030\025\211C\030.r>\343\304\013\243a\214\240\2451Iy\264\034\361$\r\2432h\231L*\203p\212\212V"
+	.ascii	"\213Z\f\201E-\210\300e\361\001\b\226\310\243\n\354\205\204X\214"
+	.ascii	"\340`\003\027,\322\211\3441hIi\\\341\250\224\021\204<\036\241"
+	.ascii	"\020\204\244\\\n:1@QQ\214\025\352[`S\227\337\030,s\3132wP\256"
+	.ascii	"z\245\374\312I\271s\352\\7\223\003-S^?\253\200t\314\370\370\374"
+	.ascii	"\254\374\316\251R\322i"
+	.string	"\0035\225\231a\272\352\215\373\255\362\333\b\361\264X\021sc\357\224_*T;\272$\201\002\2475\207e\214\031{u\211\333\364\272q\231\332vt%Sr\003\007\276\206\306-"
+	.string	"\354\223\023\"\205\b\373\337(\323\033\345\262\335@3\330\212\n\323\320\251\005\210\306H\363\256\372\313v>\223#\035`\245\312\322\004\311U\205\204~\327\016\300\n\235j\233\207\235\364\205Q\271JK\273j_\274\272\200W`6\240\335'\277j\354\267\303\003Zd\2133\201\241\250\341\250\"\214\"\021\021\021\021\221$I\322\001q\005\204 \007\035\323:\022`%%Q4J\311\bM\320\244\254J=\206\003\206\020o4\343(Ip\013L1-\220\234\364ew\266r\265\264\336\220\360\004W\217T"
+	.string	"\345\302\004\330 N\334UZ\317\353\310"
+	.ascii	"\255\325\013\354\230\345\275\225\200 \207\265\345\b$\351k\241"
+	.ascii	"\244\020\021h\266\375\301\212\360&\3543u\371\306v\361bDj\300"
+	.ascii	"Q\367\322j\366K\206\324FV\315%\214\272\372\220\224)+h\223\232"
+	.ascii	"\361\2243\202\016\220\316 U\223\005\251\r\025T\230*(jCsl=g-}"
+	.ascii	"ex\312\"!\2415<\342\317\344\247=\261\313\271\t4\f\325j\006 \b"
+	.ascii	"ij\036\\\273\213<\272\217b8\323"
+	.string	"\225T\b\207A\275\252\016\201\310\001x,\211Q\270\264\261\005\267f\021h@<\374\342\315\301\321/S\006y\265\342\243\374#mRV\245p\240?\364\272\270v\325\202wd\215\310HX\214\354\222439\237*\255!\353\\\230\204\240\264\216E\301\b\b\t3\316qy\017\331m\220\3436\242\304\213*<\361\020\357?\006\037bB\244\225\364\013!\374`\310,\210\t\375\273\324\3125\227\353\2651l\r,\257e.Db\360\270\255\264H\214BH\\\023h\r\321\211\273\320<\250\207\334\367\333\204L'\017\370\016\33284r\n\177\370\007\204k\375\024!!\251\237]\233\240ts\315\277\232\244\032\362\020A\214%d\rS\033\235\266Y:\211\310I\377Jk\206\027J\240\251$!\315\305\236\026\313?\365\314\264\363'|\361\247\324\260\342*\240\225{1\305\304\324}b\364!v\237\350\215\262\211\255\0069t\371\362\241<'\347"
+	.ascii	"u\3518\026\377%.G\371F\260\362!\306\276}B\200\340\365\206g\264"
+	.ascii	"P\364r\204$q\234\216\334\213\275\177\037\211\004V367#\030\261"
+	.ascii	"\366\244\273\367\321\204A\304oL(\302\324`B\031\274i\036\343\256"
+	.ascii	"G\021\364\335\352\013\263\235R@\262\362{\221\035`\200\314\370"
+	.ascii	"\302h4\227\3534\nr!:\365\362\336\016\323\345K\020\234I\3552\022"
+	.ascii	"j\256\362\306D>\370\376\207\013*\261\363x/\242P\272\212\254f"
+	.ascii	"\t\222\362\033\n\212\341\352\361\033)\007\220\337\343p\367\213"
+	.ascii	"\375G\237`)L\027\354\3603\325\315\321\235\020\367\273<\006i\252"
+	.ascii	"\304\241\272\302\017\020<\031\033N\230\357l\306c9'\316\332\237"
+	.ascii	"\017\205\213}B\214\304\363\222\037\330g\365\242p\013\360/m\013"
+	.ascii	"0\314\324\206M8\332\356^?\315T\342\224*\236\f\354\205\270\306"
+	.ascii	"n%\214\355\327\317~\201\365\024\357\207o\177>\302\373\254$\260"
+	.ascii	"\030\354\203\214\223\311Q\330\310b\361\305\002\361W\353K\331"
+	.ascii	"\245\267\3466\376\020\330\323\221\232\341\212\342+\262\001G\005"
+	.ascii	"?a\202\321\331\307W\337\257\364\324\016h`\347\215\001{\007\237"
+	.ascii	"1N~H\371\261\256\204\035\362\327\377\210olo;DG\f\262\n"
+	.text
+	.section	.gnu.lto_.symtab.39aba1bbcd9c44cc,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"IOIsFreeOrPreinit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.39aba1bbcd9c44cc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
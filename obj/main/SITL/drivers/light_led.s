@@ -0,0 +1,475 @@
+	.file	"light_led.c"
+	.section	.gnu.lto_.profile.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 \202\r\003"
+	.string	"\244\004v"
+	.string	"\n"
+	.string	"\366\254\342\276\002\b\002"
+	.string	"\002\001\001\251\245\204\311\n\f\002"
+	.string	"\002\002\002"
+	.string	"\002\002\003\002\004\352\263\360\321\b\003\240\342\234\212\n\004\275\375\215\235\005\005\237\326\324\323\t\004\003\002\004\006\212\302\222\270\005\007\b\t\240\342\234\212\n"
+	.string	"\b"
+	.ascii	")\"\222:4U3\205\022kWZ\356\372;\2366\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 O\315\001"
+	.string	"D\002C"
+	.string	"\004"
+	.string	"\001\001\001\001\001\002\005\002"
+	.string	"\003\001\001"
+	.string	""
+	.string	"\004\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"4\205\230*5)\013`\007:l\331\360\262\034\f\332"
+	.text
+	.section	.gnu.lto_.inline.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\006"
+	.string	"rJ!)\200)I\007s)<\\\366`\346\2224e\n\252\253"
+	.string	"\200\213`Qk"
+	.string	"\273\213\313\2202$\362_h\355j\244\265\275\245L\001\237\236\231Z^\032\221^0pc\316\222\374\250d\003Q!\204(\250\t\264\371(\305\335\t\234\fPG\225wT9\250\t;=L\317\365\f0~z\372d\352\3556\330\224\303]\004\375\243*\036 $\0306A\235\224s\"t\201A!\2021\377{\235\3057\265>\235\272\273Co\323 \034"
+	.ascii	"G\233\001\207  \220\226\032\270n\213cR\234P\241\255\226@g\013"
+	.ascii	"6\210\341\2640\002wfh\201%$\205;\254\226\2351na\356\3439\256"
+	.ascii	"+\254\fa\275Tju\254O\231f\351\327eU\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 \274\005\003"
+	.string	"2\205\016\026\300%\035\377\277\013\370\375\177\377\365\377\277\006\255\031\327\366\336[&\031\344\023\320\263^\360-\243Kq\277t\036\366\303\372\\\365`4r\341\222W\"\234\310$\265\234\377\336<\211D\016"
+	.string	"0\013\300sI\341"
+	.ascii	"A\367\336\241\007XEN\370@i\200v\203\022\372y\001L\242!\223\274"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"D\003c"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\t"
+	.string	"\001"
+	.string	""
+	.string	"\001\b   "
+	.string	"\001\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\n\002\013"
+	.string	"\001\002\f"
+	.string	"\004\001\274\001\005\002\274\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\203p\001n\350\n8HQ\267\374\264\244r\030\3058\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.869a53a0c2e58510,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.12.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 \232m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\237\210\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\304\007us\250\327\006uq"
+	.string	"\005\001\006'\001\004\371\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/light_led.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.15.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\315\n"
+	.string	"\226\223IB\020\3478\035 \264\307w\302&"
+	.string	"\317@x\306\355m\017\373\315W\3453\354V;\021"
+	.string	"y\312\345\221\177\304\336\323\302:\274\202\335\345\265\036\031"
+	.string	"\240\0210SBP}\003\261\f\2104`c\372\330D\310N)4"
+	.string	"6"
+	.string	"6"
+	.string	"!\213<\367\234~\341\273\347\271\302w\317\247}\200a\344\200\200\253\306\266\273 \227\362\363\365\364\037s\203\027\214\365\332\241\330]\327\027\314\344\346n\373\301\366\204\375S\367:\032z\"K\320\2527;eU\016\305~\267\273k\016\265?\373k\207#q\325@\265\335\222\333\202-\340\tX\371\330~\265/;\314\371\331\352\t\273\250\201"
+	.string	"\273i\366\313\317\3468\200\322\3457\317\301\251\367\200\317v\232\333\016\275fc\321\362r\325g\033\3424UClw%l\217\317|xv7\342\236/\003\022\002\212\251\334\363W_&1#5V\224\302\213Re\216\314\022\301$Q)Da\230'\223\210\002K2\354\020\311\022\230\022G\032 \211,A\221\203\307\215\220\004\315q$\301O\272\357\226C\335\261\254\002\004-N$\023"
+	.ascii	"2\241\237/0<xd\027\304\241\273^q\002\306\355J\325j09\\\t\fq\225"
+	.ascii	"\032\374:\017\310\204f0\357\022@\263\232\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_ledInit.16.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375`\360\002\205\026"
+	.string	"\306\351\220H\300XM:$\210&\206Y\005\356\213\223\366\\Y\\\215\246\276y\203\377\020\005\"W\312'\344\362\240\261\326dg\016\301.Q\221\264\321q\262\324QU\b\274(LC\207\350Dh\267hCx\216\n,\276'\204\220\275\245L2|"
+	.string	"r"
+	.string	"|"
+	.ascii	"\261\327\204N\240;\351\007\220n\033\215\326|\237j\373K\367\371"
+	.ascii	"\275@\367\2511\325(\267-\365o\343\221\216+\335\035\262\013\345"
+	.ascii	"K\333\325\333\330?\257\233\2227\246\367nn<\201\212!\343L\374"
+	.ascii	"']\230\220\240\311\006\2134#ZO\006\212w'>\001\314N\\J\231)NV"
+	.ascii	"\004\314\212\344\313\b\030c\313L\266|\246\313\320\244\2143\024"
+	.ascii	"_\357\246\273"
+	.string	"u\307Y\211+xU]\241\252\020T\031\fs\237F*\372\341\270\327\327-s\240oR\005}/>\365B\f\312h\242Q\033\332(U\233\270\254\244\372ww+'\251\246^\373\003\374v\005\345\352\307\253\336\256v\273:\345\252\344U\336\325\335\325\277tB\226\300$\351\036\021\225\245\225\314\\\214\337\256z\233\236\t\307s\304~\323\247O$\361\341n\"\246t\367\314\247>\370>c\344[T\365\253\372\032\267\021\222U-\\\330\217\032c\304\242v\354\361\241\374=\335\344\216o\304\202h\243\024\344\311\237\221\002w\004%9\bN\252Iw\333\350\235\236\303\240\031rr\240\270,\263\252\316\316~\224\034#cQ\227\2315\320\242\216\240\024\352\210\211\032r\325-\273nNd\213\305\347>V\n\226\272e6\252<\357\301\372<\260\264|\246/\300\201\243\221\343\356\026\231\225X\277\343<z\364/\364\247\265\037[\335\003\254\363\2608"
+	.string	"\265\"\250V\023^A0\035\330k\200\356\324\250V>\033`\035xX>\341\313\265\002\301r\251B \226\316O\270\343z\2055\b\264\345a\345\na\255\226+l\261\3659\351\306\277\246'%CL\364\261\222zF\272\024\263\223\2359\310H4\007\371\265\313\356n\217\301ANq\b\232\224\355\302#\301I592\235|\\\251\262b\213':\246\201\235\371\307\252\022(\024\261\250Ep>\"\037\277G\221\034\314z<_\241\013< `\002\031:\254\007\342\200\377c\360\355q2\310.XM\251o\253\004\312\351\354\336\032\305:\327\034\267\364eM\345\353\203]\244\017\035q\325\306woi\220\240K\206\313\005\3041\261\326U\253\324\213\346\024\330\273\tc@p}\213\242u\373lq5\254Y\340\354\214\270\023\247#VJpl\267Hf\305\350\355g\235\345\r\001]\3305"
+	.ascii	"\025\341\335Y6\326\254\350\367^f\b\320\266AK\324\352!FI\007\331"
+	.ascii	"T\343\373Z\247}O"
+	.text
+	.section	.gnu.lto_ledToggle.17.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\225\b"
+	.string	"v\021>6P\217\032\003 [\374J\206\n\200\322\200w\361\001\324\"AeNF\2613\202\220\253\351\200\365\006SH>6\231\250\323\270M0\242\312\004kyNj\004m\271\245L),"
+	.string	"-"
+	.string	"-"
+	.string	"\022s@fY\257\205\361\n\344f\2454Pd\376\317\370a\317\320\253]b\355;\225\f\001\022\376\027~'\0167\272mA\333\203\266,\001\177#\252\265\312\216\020\3262ky\031\210\3717^3w\311V\310\246\255a\353\021\223xVU\245\332\337\221J\371o\320\216\306\222c\201\314\001\334\004\364WNF,\265\355\205Y\"\315\177\204\332\304'\024u\312\262\026$\350\317\262&e\226\216\013+\"-\023|\265\253\022\214\036\255\261?\237-\024\353\351|\266\020\303\350\301\001\024\232\242n\253"
+	.string	"u\237\031\001j\200\230\236N4;\004\345$\266n\2168\256\233\233\325\215=\242\252\340\3422E\214j\320\261\r\b"
+	.ascii	"3\241\303/F\361\031L\300\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_ledSet.18.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375`\250\001m\020"
+	.string	"f\341pE"
+	.string	"\261&\035\177\352\234X\330\272\345\273\027\"<=\f!1\017\376\t\356\241k\332&\324j\342`-5k\3007@b\024\035i\356h\fN\377_\332u2h\302\022\303l\212\246u\354\351\215\272\021ido)S\nY"
+	.string	"Y"
+	.string	"^"
+	.string	"\217~\332\267\271\t\324o\334\302\332.\207\020:\273\033b\221\354q\364\001\330#|"
+	.string	"\354\321([\306=\020\373\027\tV\316\317\356n\372\341\250G\250\211\362A%Z\313\225z\2149\f\271b\256"
+	.string	"\\.p\264\273\177=_\\\253LP\311\356:[\256\f7v\333\fl'\260S\024pw\327Jc\337\373E\307\271=~\363\207\236\326b:{\032\224i\354\351\3704|Za:\237\376\207h\306\006\r\035J\350\013oa\276\033\333\023wD\034\347\267\377\227;l\343P\030\245\274\205Q0\303c\363\263\353\201<\232\304#$\250{-\004\356\243c\303\263\353\205x$\0131SmG\225\037\214\230\202\364\230\206\260vV\371%\364\320\250\220\306swS\372\026L\244\021\203\317+\206K\3260\310\241z\350q\260X\250^\241\236%\263\312\317\251\252g\345P=\347'L~\215'\234\362\255\023\366\230j"
+	.string	"\206\214*?\207\364\300\257\025f\\\\\270\261\312\317\366R\251\036\354\007$n\245\343XTJ\231\212)I\034\212\332D\204\304\2414XypRB\331N\035\307R\352H\233J\311A\312f\322\2356\221\0026I\340\272m\305d\352\266\016o\017Wi\234\020\244\002F\254\320\250\232\276,\260\321\243\322\225?R\323Lm\023.\337\362\310\202\246 \\\305I\266\273\b|\024OQ\362k\036\035!%\005{\034"
+	.ascii	"@\205\006D\304\nh\214\177\004\241\262Lu\246\204R\247K[X\2028"
+	.ascii	"P\327\347*\301}a\013\217\005d\315\2160\367\226\272j\246Y\336"
+	.ascii	"\271\320\324\241mE!\377\264\373=\033\fN<0\312S5\206:\275\265"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\365\005"
+	.string	"\302\210!*\200k:&I\225Jx\340\203\201"
+	.string	"0\365\210\250\361\353\3370z`d\216\261\302\266\005\026\335DDDD$\304\232\335[n\231\002\207B\225s\023r!K\244\013\350\btU\243\367p*\030I\327\300]\2019\002g\003\326\264\273\377\303\247\343M\271\235\007\267h\036\324\002\363\217|\220G\303c|\n\317\201\270\206\223L\222\030c}\361\025\255i\356\257aW\324l\245\330\212\222\314\345\347\177CQ\331\335=q\025\377\353\"\027"
+	.string	">+\006\323\312\004\f\315eP\240\036"
+	.string	"\034"
+	.string	"\034>@L\\\232z\202\341\362c\231\f\241\321B0"
+	.ascii	"\n\020\006\206[\004IX0A;\240\f\230s\255\211\007"
+	.text
+	.section	.gnu.lto_.refs.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004\001\001\002\002"
+	.string	"\001\003\007"
+	.string	""
+	.string	"\003\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\001"
+	.string	"\002\005"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\013"
+	.string	"\003\006\002\007\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.869a53a0c2e58510,"e",@progbits
+	.string	"(\265/\375`\225\021\205Y"
+	.string	"\372\2330\"R@R\322\031\016\351m\266ted\315Fdf\354t\037\326\267A\364\252\366\254\300\213\352\312?\315\371\231\271W\204VV}\253\034\240\342\005\024\nTM\320\304,\356\210\321\350\032\322\334h\020Uu\267\327\375\024\026"
+	.ascii	"*/L\221V%Bl\273m\273I\231\002\312\001\f\002\021\002i\357\371"
+	.ascii	"|>\367'\3357\336-\313\345\373\266N\235\245}C\273\217\273&xvM"
+	.ascii	"\324\244\315pt\222\242\337\245\272\352DE\025Y\272\265\325\211"
+	.ascii	"q\322\214\252m\226e\323Y\366\314\344\234\\\315\317\355\332\307"
+	.ascii	"\024a\353\301\344\207\272>\033\"\375\034\033\305nP\273be\247"
+	.ascii	"\200L\325\255\033\304K\231.\214\376\233\266U\320%lZb\030\245"
+	.ascii	"\342\243\003U\245\206\204\321\257\r\365\013\374Ah\273.\024\036"
+	.ascii	"^\3671\214\253\273\245\354\224m.\332F\371\226m\016\337\365\033"
+	.ascii	"\366\007\375\n\260X\264\325a\317F(u\003\251\352m\221k\336\235"
+	.ascii	"\351^Q\370\240p\201<\262$5\333\371\341\353\207;F\377\201\372"
+	.ascii	"\f\324\022+\"E\033P\277P\376m\262aKVB\367Rw\013\300C#\006\214"
+	.string	"\027F\327\3112\267Ib\237\\\001\026\347\031\307\032\254{\355\241=\332d8\302\350\203\324/\016\017\340\330,~\243\376\271$\322\025\013\372\216\205H\223Rk\367xR\2540\241a\224Y\345m\210\324gE0\371w\311\202\221\340!o,\233\254{\005\321[{@e1\372uE\244\352\206H\377%J\341\b\205\236\237o\376\035!\210\363\357\0062\376\215\001\274\333\020N\370\327h\177[\300\321\316\375?\373o\366\377\311\177\264\377dW\377\335\362\357\213\177!\370\367\201\177\033\370\227\201\177\035\370W\2025\340_\026\377\256\330\242\377\275\237\215\377\232\360/\t\377\212\360\357\007\377\016\375\213\301\277\025\374K\301\277\023\374\213\376\177\376\277\373o\367\337\314\177:\266\377i\377\251\374\207\373\277\345\177\214\377n\377\333\376_\371o\345\177\225\377`\377G\374_\373\237>\237\317\347\277X~\016\362\363\330\004_\\8u;\234L\261\322y\t"
+	.ascii	"*33\214\362\361i\233\004\215\210\334\276\3518\345\240\002\344"
+	.ascii	"+M\232}\252kG\255\023#\021\370\330\232\373\341\373\344;3Q\222"
+	.ascii	"<\r\345\201\266\244mK\375\367\256\271w\333V\203D\225\220\321"
+	.ascii	"u2\231\342LD\375\366\260k\327\\\273=\333\265\2438\200\022\225"
+	.ascii	"\345L'\327\024\347*\365\273g)\0312k\206\213ST\026/\236\023\223"
+	.ascii	"Y\033\017_39Td;<\353v\346\300tx\326\225\351YQ\256S\326\233\034"
+	.string	"VUD\030=\363P\277`6\314W\314\305,\335J5ONKT\2263-%\365\243\336\3359\331\355\360\245\373\030\235n\260\356\036\221\n\351\2322\302\350y\3301\377o\322\033J\2760\0313\227SD\207\022\013\225\336\217&&S\030m\256\334F\301\331\241\346\325\\S\317\177\332\307dw\347\250Y;\251\244\363\255\331\375\371w\226\267\007\374G\233GB\253\233*\256N\265\341\354\370\203K\364\275\272\215 z\355$\222yeD\342\360\246\004\261v\f\00243\253\221\353\225\022]6\367\332\333KW\312\025\220\3532\211\\\227\306\236^Z\032\273We\017\222\354h\\$\363J\211d.\225 z\251\215\315<\306\240.-\225H\266\245\262\007\311<*\221KWJ\020>\342\204<\331\b\033;\262[\220K\215\003\212\352\230\354q\"\327e\307u/\031S'\017\350\246Z&\343\216>V\212\222\023\207R\016\307\345\256\335="
+	.ascii	"\224\022\326\262\227\234H$\313n$J2\032j\205qu\366\220u\032\263"
+	.ascii	"\250\372\006S7\001\275vCu\033\267\235\335m\354n\233$\325\332"
+	.ascii	"\rC\017\222\013\n\252[\312\007\252\251\214hL\335L\026F\212\022"
+	.ascii	"\311\304Z\006\2415\231\\\335\264\032\227\253\343\256\222*\323"
+	.ascii	"(\3267\272{\313\250\\J\035d\030]8\0346$\rG\202\250\333e\275l"
+	.ascii	"s\277\034\035[6\263{\335\341\035"
+	.string	"{\264\235\375\004-\365\223S\246\365,\302f\34738\036\304\260\030e\035\226-'I\232&Z\234\003\nU\303\230\016.\353\315Y\341Q\306\251\036\245\322l2\031\006}T\376\\i.U\316t\022K\n\336]\226 U\030\375\341'7Kk3o\276\224\251\"\033\242\036\235b2\355n\312\234\354|`\364\350\322\330\267\311c[e{\272\261\254\244tR*\205z\027\205%9\247~\277\226\231\316S\333d&^}\304V#\017[\030U\212\232\034R_O\2146\261y\232*#s\252_0 \274\024S\025\003[\201\205\031\302E\272\2640\325\f\234d\235R=\275d\266\003\035\330\027_\261\025\217\021Dw\026\030\256%\034\306LX\t{1\3306\371\213\215\234a\340\037\367a,\376\342,\326Z\247\326\004`q(|P\344|\341a\313\311\203\002\371\334\b%$\006ast\335k\022>\302H\326)\265v\216\021\306"
+	.ascii	"\361\372\317]|\30369\311}\326F\201b\200\235;0g\302R$6\350Hq\372"
+	.ascii	"\321\304(\327\260\314\265\247\254\225k\233LC\257\251\2064G\030"
+	.ascii	"\345\255\317\3310:=\361\230\250\347\335\240\236G\204\210\352"
+	.ascii	"\205"
+	.string	"\256\312-K=o\251\262\f\034d\233'X\310W\214\261^s\\{\345\"i\2408\361\241~O\244\274\347sO\244\347\345P{xN\352y5\324\237\227lU\303\314R\347f\265g\\\332n(1z\236Q\355\331\020i\211\037\036\354\203\245\376\233\236\022)A\312\354\324s\217\r\210h)c\024\335\247\245\254\343\274\343\277\341\265-.\250:\365\254\344\034\377\rO\334\021(br\3529YS\366\254\233b\224\243T&v;\201Sef\305Q?\333`'\306\361\3023M\017\214\362\r\206:\343\340\247f\034+\226\335G\306\321C\323}\354\355\232\3305\201*\301\332\212\222\242g5\365q+\"\335\331\020)7\005\235\2219nV\350\2320\252\263\262\221\215\274\324\323J\\\002\277bp\b\302\220\220\315\220\220\n$\212A\203\202\342\357\202!!\234!\241\3642T\b\203>E\2370\2103$\304\301\005CB\032\304\020\362"
+	.string	"\250\370\003\016\211\212%\212>\005\026H\241Hx\004\3437\024\302\350\321H\022\302"
+	.string	"@\205_\221H\303\203"
+	.ascii	"\212\227\241\002\230\004"
+	.string	"\004L\nQ\2044#\007\351\004\036\326\020}:E\037\0220\251\006\t\230\304+\372Z\004\251\277\027\202D\224H\374\r\215\214\210lh$\t\213\320a1\211g\364C\002\006\217\210l\214~\304\031(\2220X,\372\021m>\364\001\223T\354\f\211d\024\2414\206Eb\020\370\353\300\347S\374y`\364;J\177G@\2400\206\321\357\350\206h\364;Bu\212A$!\243\337\221\315\213|H\026\024\177\304_\007\300\244\001^\024\034\376\220~@\365+Z \320\302\205\0136w\361\"\201\027\t\244w\361\"(\350E\213 \365-\202x?\337\360\207\324\302\320\257h8CH\374\r{GB!\005\276\232\242oH\b-^\206\001\027&\375\206@E\241p\b\224S\364\271(\"\005g\330 \t\203H\301\033\242\017\030<\001I\b\303\350\247\001qF\221\250H\004Q\364\331<(\bF\211\0176\270@-Ra\364;\362\025e"
+	.string	"\203G@\304\341\217\205\340\320\b\b)H\244\002P\321\220\b\244\242"
+	.ascii	"\"\220(\2060\230\312\275\3610\235\312\304\030]y\322.#Mh"
+	.ascii	"a\332p\316\272T\021\302`\370,K\r/T8.\rj\253\251\006\034\253\355"
+	.ascii	"\\=\233a\030e"
+	.string	"/=\314\210Yc\364\311B\331H\242\325e\351hx\272Y1\252E\013\277%\341\272\274\370\311\020\031\354\266\234\337\224`G$\214\262s\331zwj[F\254\326\326\270m\205\353\362B\237\2701-\331\316m\037\223s\206\245U\203\355\246\311\351y\325\343\312\025V\203`\t\327\345\025\344\356\t\313Ym\331xv$\215\200!K\341\310\030\311zBC\3434\007\234p]^<qS\316@\251rN\273A3\344\350\204Q\246\202\303\305\207\226f\224\247l\034/\316\207\030\2323,3rg\214\276fI}\224(|\266c\035\345\303d\205\353:\323\001\201L\250\201 \207\0246#2#\"\"\322&\351A\005\304 '\245\263\016\021`\251\203hfD\232\244P\3328i`\306ms\231{\3023\034\272\306\202\326\006\r'n\032+\025\322<\332_;\rl\246\"\207\273\326\006\321\216]?>\022\244.j\221\361\257\320d\217"
+	.ascii	"\326\201\355\262>Z\001\346#\332\211>d\244~~=HB\202\376-\036\367"
+	.ascii	"\033\303V\215a\246\203u\005m\330]\201B\t\300\254u1\036\275P\266"
+	.ascii	"\373\300S^\251\256}\360\255>\004E\331\370\022\226:\356\312\""
+	.ascii	"\022\037\317I\304q\263\232\fY\002\361\214\302\253\221yl3!0\003"
+	.ascii	"\320\370U\037\216\341\214\255!{\304\307\002\032\237\356\204\236"
+	.ascii	"\021*\327\245\374oJ\264#\274\022\270\r\324\b\026/6\023\013.\345"
+	.ascii	"\bY+\"\224z*\023x\0264\246\266&K*\250\240\245mO\002\266\374\227"
+	.ascii	"2\345\033\013\300h\244\225:VvG\230S\\\260\031P\324\350\311\301"
+	.ascii	"\007"
+	.string	"\201\276\316n\275*O\323\0073\344\354;\3227m\312\254\005%\220\2422c\261\033\005a'\203\330\004:\013\230\262%\002\217\2436}\002x\331\242\017\350\003\276.\371\303M\005\266`\322\356\236\362O.t\004\260\013nYE\007\021_\346\364\032[ReG\307\366\r\344\331\033\035\020p\351$\256\253\360/\r\0313\0273#&?\233\236\f\346\34562\371\214\273@P2Rs\004\233\352\330\222\"\300`&Z\212\333\250fA\221\356\270$\305\262g\212\2572\267\314@e\"\316\031\030\264\207\250{\327\357\315\367;\235\320\020z\210\003\006\343Q\373\030\214\005\226\204\354\312w\006>_tf\372;\036\351\275\354\030\370\327\243-u\302\373w\200_\370\013\020L\234\207\003\335\314\232\310\236\237b\t\3424\322\203\340\f\362k\222\035I[\205O\243\213\022\270ji\246\366IG\235X\217S\340\231\204\202\241\350\242\321\270\374\3767\f"
+	.string	"\236\227\3450\304\341\326\020\030\355E\313\230\016\275\365\302\301\\E\354\226\022\357`t+\004\b\274 \20054\036\017%\305\225U\266\206&\336]D|\204Fk\034\377W\300\352\231g\037\202\035\031B\005D\020\013\260$\345\3343In\244q\313x\026\315\217\210\374\bw\017g\217\326y\021g\003&\263dl"
+	.ascii	"\316f\314\225\214\004\372~\360\300\214\033\220~w\026\266\375"
+	.ascii	"\3759\300J\254\275L=\267n\3763\356\274\254\340l1\362\274\007"
+	.ascii	"\253!\360\220\376\231]\330\036c\341\252d;_\025"
+	.text
+	.section	.gnu.lto_.symtab.869a53a0c2e58510,"e",@progbits
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"ledToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"ledSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"statusLedConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.869a53a0c2e58510,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
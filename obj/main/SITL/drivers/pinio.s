@@ -0,0 +1,386 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 W\305\001"
+	.string	"\204\002K"
+	.string	"\004"
+	.string	"\342\366\243\226\001\020\002"
+	.string	"\002\001\002\002\003\004\002\003\001\240\342\234\212\n\002\241\251\226R\b\004\003\240\342\234\212\n"
+	.string	"\005"
+	.ascii	"+C\370YTp\334\256\320\r\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 .\345"
+	.string	""
+	.string	"\220\""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\002\002\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"B\221\221\333g\003X"
+	.text
+	.section	.gnu.lto_.inline.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 \260\375\003"
+	.string	"\262\307\031$\200K\322\001\fP\035\220\f\342\312\205\230\205-d!\0047\007[\n\314\320\231"
+	.string	"\310\024\003\372\375\373\261\021)S\277\356u\317\316P57I\202{\2412\306X\340\243n&\221\214A\375\200rNE\0337I\207\373:\256\236\005\207\277\256\317G\255\343\223\320o\244 \216\312e\360\2136\013F\222\350\223\241\332Di\210\357\217\b"
+	.string	"z\ba @Q\304@\2007\313d\331\376P\326m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 \301\315\002"
+	.string	"BD\r\027\260%\351\f\303\200\234K\222S\f\206a6\340QOQ\262\333n2\245\3724f\204\231\3417\017L\223zR{l)\027U\023\217\324\214\216\323Y\367\f\336\t\b\r"
+	.string	"0\005\225\027"
+	.ascii	"\236\262\b\274\023\250\272\251\202\321\274\022\310\254)$d\022"
+	.ascii	"\003\216+\246l0\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 S\375\001"
+	.string	"\364\002G"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177"
+	.string	"\001\002\t"
+	.string	"\002\002\007\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	"\002\002\274\006\001\002\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"1\003\320)@U\334\240\254\n\2036"
+	.text
+	.section	.gnu.lto_.lto.87f861a0acaf4f7c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioInit.10.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375`\266\005\235\""
+	.string	"\026|\326G\200\332U\007\277A\376\032`\005\334\364\311D\254\202\237d\374\2604V$\236\213\363\332f>\007&\374\\T\321\352K\360\024\212\237\270\330\rq\364\215\211\246\265\321\342\347\374\272\245\340\001\003\232Y$\321\316\317M\366\226)\245\024\304"
+	.string	"\264"
+	.string	"\302"
+	.ascii	"k\247\234l\037\265\323\265\005\250\235\262\217\331L\001&\\\026"
+	.ascii	"!\227\233{\257\356\207\260m\233l\326q_\357\350\344\340n\266\332"
+	.ascii	"JSS\373\356\343\326j'z)\301H!\376z\307\342\236VR\355\034\376"
+	.ascii	"\260\022\266\226\\GH\321\3309\270\333\261\330\243m\226\301X\020"
+	.ascii	"\262v\016yX\003F\346S'\031Jy\rN\325\261\030\325++8\026\241\232"
+	.ascii	"fubL9\3329\204\262<Tfg\204\256Z\237\261 d7b\223}`d>\261\002\347"
+	.ascii	"0\312S\n]\316\034\213>\332Z\241\247\225\224\016\221\311\n\210"
+	.ascii	"\242\362\354e\273\rb\320\277\267\332\303\260\\\225\035\213\306"
+	.ascii	"vZ\205{/\273\023\261\330\314\323\314\235cf\n\314)\210\316Ex\006"
+	.ascii	"\364(\213\236\342b\002\325\275A\"f^K\201\261\336\033\034\212"
+	.ascii	"R\"I(L\221N\271i|/{\300"
+	.string	"\023\250\021\013\f\350\321\217\242\362\254\372G2'\177\376SO\253\250*\374S\314@\335\325\334\323Y\335\001\336\231\247\225\315\266\324\271\366\316k\352L{g\325:\247\357l\337\371\255\263\277s\347\236\207p\351#vo\216(\234\333L\301\216tW\267\222\271\271\270\227]J\271\037\023\311\275I\242\265\223\334[|\353\224\331I?\361\265\222\303\354\205r\341j\013\364\336\033\324)\017\255\235\346l\337\230\271\235\271\257\032\313\327Y4\032\300\275S^_\367&!\360\203g@.#\0260\177\326\327\240U\006\326\r\344&!\203\336\344u\320\036\247f\300\203\272\303\007\031m\232L\377[\tx\b\021\215L\323\f\376\257@\2314Zh2T\332\367Q\311T\237\366\351\216\245\360l\245\272\303{\257\203\326\322\374y\034\036\313j:S\037\331\bT\236\365\311\321F\240\252\317\363\354B\250\245+#\032\220h0\023\t\250\324\347\260\204\t\030"
+	.string	"O_B\237P{\236\031\205\221\267\023\347\232\376\307\366\323o\257\356#\365\337~7\031\227<\312\266\377\257u\211\t\317\334\310|\322J\037i\274\177l6\203ZAc\037\311Jj\317\267\363\215RL\320\315\030\347\376\314\273\026\336N=\237\013\376\217\373\375\003\274\235\357z\305N\005\022\257\350\306F\021x;\244\335\013]R\357h\306\256\227B\207\264C\341Bg\324K\322E8\300\274\027G=]\f\036\257\247\273%\357Wk\365\005+$eP\340/}\355<\222iZr\200\376\307xP\333\336\0067\207\251\266\357,\345\230\240\233\265\275\367^\035\241\266=\320c\031Q\202\351\362\034&\315F\351gM\321"
+	.string	"5\270/F\037P@\217\342\312\2409\003]\372\2324\231\214\314\030\0177\224\030\257\232\210\216\0338n\217\364\202\325a\300<kU\\1\252\200\224A\333\202\312\354\323j\247\205\004T\367\336\241\261\242\2370\367^\242.\335\304\300\0316x;mP;\255\215m\271Q\003\364\350\232e\215*\233X\327\276\267~\355\273\2140s\250a<\246\fD\206FDd$I\223\306\200\002\221\251\262z\020X\2504M\322\030!Ry\236\375\206\274R\265P\326 t\267\303q\033\221|\212\005\271\301\336\204\314,\2414\376j\362\221P\373\213\221W\202\273U\020\341z6x\377\374\020\235\370-'2\220\202&\272\321\233A\354.\352B{f"
+	.ascii	"f{\261\212\n\222f\n\207`D\360UI\240b\277\375\323\210\364\026"
+	.ascii	"C\265pL(\203\217\263\367W\246\252\260\035\214\3711\246\255ij"
+	.ascii	"@q\013<\300a\301\354\207\027\341\036\323D\331u{\244\223\343M"
+	.ascii	"\356\270bF\247\310W\232H\313^\346;\217D^}\f\020\337\322u\363"
+	.ascii	"\236M0Y\303I\372\272c\257\312p\302l\030\335E\017\327\341\f\341"
+	.ascii	"\264\005\267\032n\026UI\t>\006\236fuW\306;'\306S\037\3018xQ\343"
+	.ascii	"9\321Rq\001\3651\210\326j\322H\251\2270\177"
+	.text
+	.section	.gnu.lto_pinioSet.11.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375`\303\0015\020"
+	.string	"\326\336mG\340\222*\035\222S\344\301\325\031`\252\3468\271f\"\t\375\021\250\225CZ\242\2167.\020\300\025gu`t\324^\001\\\333Vn\b\3474\032\302\0303\024\200\230\007:yi\t\n\252t\231\206\020m\305\306F\210\334)\005X"
+	.string	"T"
+	.string	"["
+	.string	"/T\247\031gp\367\204\212\231\3355q\202\316\277\317\005p\376y\017\300\371g\225\375\343\245lo#\321\212\321\355n\250)\256\272\247S\345\337v\320\365Z\335\363p\365><r-\222W\213g"
+	.string	"V\302\346\266O\016/\326\234\"\021v\327\323\365\352p\177\267=\3016\004{\236\004\336\356\256\025f\277v\203/\377\316i\277\210N{\237\3269=\347\364G"
+	.string	"\264x\031\201\342E{\224\353\262\023\262\271\017\007\213\327~\373\267\331c\273\226\372\254\312u\t\205\320\315t\273\245\202\177n\340\320\211\352e\212\300\203"
+	.string	"\231\351\330-M\314\240\363\317\237\366g\017\240\252\206D\334ZC~cb'\243\0323\250S+\330|\264\314\033\333+\257\221Z@\203t`\306T\317\212\006\246\243WPo\243\365\201e\3622)\220lw\035\330\036]\006\tA\315\356>\210y\f\223\277\342\2371\240\346]\377|\024\347\337\325\003\343fCc\231;\273\\M\215\331\017\342\t\345D\001%\212:\"rj\020UD\343\347\024\0209\212\306Qh*\211\031\306\222J(\032QV\302\224\222)\004\02509\022K\341\211$K\241\247\334{\2530\t;r,\312\3624\206K\225\310hH\003r\200.p0 H\246\252\247\266ha\336\345\317\006]\331\036?sa\244\346F*\271\341)\030\036"
+	.string	"3C\357\220\3009\273ehwF\326\200e\026\001z\300\270M\210\236\tl"
+	.string	"\355\300\020b\310Q\2068%\243cnB"
+	.ascii	"\333\201!\224\220\005\n\361\b!Fm\006\222\270&\326\341\032E\r"
+	.ascii	"\377\214\373=\017\212kn*q\246\024\n\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"u\005"
+	.string	"\242\211$-pU\323\001\024\037\234Om\215\032\312s \366\"\342\301\352x\331\\\020E\374\374\377\256\252\252\206\352\304t\320\250\211\210\210D$B\344\226)\327Q\025\200Rr\252\271\232F\265\"q<\244\3575\352G\233F8}-P\017\3020\002\250\257\345\251!$\362L_\n\3249\371D2\201oB\367\353\220\241\340[\340\216\300\330\200\263\2167\2165\355\356\377Pn\314\351\025\332J\335\335\031_s\177\365\032\253\246\377s\321\227\237\177\021\242'-\237x\2615\377+\"\n"
+	.string	"\240\036"
+	.string	"\034"
+	.string	"\034"
+	.ascii	"\034>@\020\274\024)\301p\t\201\345N\020\245\007"
+	.text
+	.section	.gnu.lto_.refs.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\001\026"
+	.string	"\001\001\030"
+	.string	"\001\001\031"
+	.string	"\001\001\033"
+	.string	"\001\001\034"
+	.string	"\004\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\001\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.87f861a0acaf4f7c,"e",@progbits
+	.string	"(\265/\375`\363\013\r@"
+	.string	"\252p\234\030CP\344Q:\005\322\206\254Vn\202\2166\312\375\252\346s\354\324\215\3200\205\201\305\211\303\340\260\255_\325(\260vb&QI\037("
+	.string	""
+	.string	"Iz9\332\335("
+	.string	"P\245\211jb\240\215\202\227\313&Vw\3332\005E\001r\001|\001\314\f\216\330P)\212\351\335sq\315\031n\202\230\033.\366\252Y\243KJ\343\"8\366~\250\272q\032\206\362\033\2339\257\335Q\r+\227q\342u;\323\314\272\373\f\346\257z\3433\334\226\240\253\333\251\304'6\007\ng\327\335QSS\275:Bu\272z\267\rM\323\2375+\025\266\246F]\032-\262\367V\352C\250\337\240\236\313\374\034\206\301p\264E\367\263\273\013(\335\331S\006\316^\026\303O\206*`2\317\300\341<\342Z\247u\257\276\013&\247I\025{_A=\2179"
+	.ascii	";\315\341\252\372)+\350\261Z\325y-@/\271\\\333\007B\n\031\232"
+	.ascii	"\275<\253^\016\320[\300\003\276\374\354\205\323\024\360\216A"
+	.ascii	"\232\035\355^\241|+\030\222\314\336\257<\240\247r\200\336\317"
+	.ascii	"\013,|\206\357\267\274\377s\307\363_\317\036\206\252\360\263"
+	.ascii	"J\341\347\t\377\333~\236\372\271\200\324\177\266\237\021H\370"
+	.ascii	"\031\302\177\267\237#\260\203\004\017~6\3643\203\237\023\374"
+	.ascii	"\034\3653\200\237\227~N\372\371\350g\376\177\367_\321\177:\377"
+	.ascii	"\371\374W\363\277\315\177A\377U\374\257\373\337\347\277\233\377"
+	.ascii	"p\377\323\376\017\370\017\347?o:\235N\177\006\361s\332\237\324"
+	.ascii	"'\307\247Sy|6\225Pmlb?\213b\252\261\251<\306i*\237\216\317\242"
+	.ascii	"\362ht*\241\226\024z\362\307\013\221\363\013+\217\306\026\202"
+	.ascii	"d\026\223O\322\343\332l\272n\216\366\350d\203nf3IW\f\3434]R!"
+	.ascii	"]l\305f\033@v\2155\333(=jivk\351\212\321\310\r\304U\332PXJ$c"
+	.ascii	"v\220\036\335\007z\355Fv\023\271\245\335M\354n\244$s\355F\362"
+	.ascii	"t4C\"\273\227Q\310f\022\337zt\333(\2374\312\343s\254Y\365\006"
+	.ascii	"}\232\265\217\225\310fM\347L\252O\242Z\007\351n&\244\232)\211"
+	.ascii	"\f\262\227\005)\3059^\251\"\247\362\037\006\304P\016\364\273"
+	.ascii	"\326\\\233xE09nR=\337t:\235\262\224\237\373!\252q\221\263\367"
+	.ascii	"\347\272s\037+&\207\007\231\275o\030\016\363ajv\033\227\324\304"
+	.ascii	"\201\241\331\273\007\251\216Y\0275\243\236\323\344\234\321\360"
+	.ascii	"W\315\361\034\226\262t\271\366\327\0063y\230\216\3650\224\347"
+	.ascii	"\270\316\331\016\337y\324\332\315\026'\003\007\236c<\034\347"
+	.ascii	"D\\{H\0066 iv\335\353\324T\324\024\223\023\264(\233z\317e*7\017"
+	.ascii	"\350=\361\021\365\f\275\037\246\363?WJ\034\260/\366\236\213\250"
+	.ascii	"g\245z>\252\217\362\200\336\355\225\003\310\305!yi3\026\265\227"
+	.ascii	"\343,\267a7\3478f\303d\344\270\333]df\340\024at\332^k\204\007"
+	.ascii	"\361\350\302\324\356\320\034\215\035\252s\033C\"\355WT\223w\247"
+	.ascii	".\f\355l\351L\331T\212\362\366\253\247\307\220\332\230\2756\311"
+	.ascii	"\322\245-\214\302\224\331!\027\211e\215\210\025\342\363\323\306"
+	.ascii	"\b\241\245z\036\020 @\254\027?\255]w\336\230\361\272\210\361"
+	.ascii	"z\250\326\307\255\017\353\305kp\302\320\354\272\227R\267\216"
+	.ascii	"I4\211=\336z\271\215\225\361\220&\371\3701u\322\251\277\355\202"
+	.ascii	"\332.\313\343\256\255\354\2159\003[b\327I7\024x\213\3368Yc\257"
+	.ascii	"\2245&\031\327~&\315\021R\022\005\243\336Vi\324\310\022\325\356"
+	.ascii	"f1J\232\332\32672\266o\211\002\230m\207\354\345\351\331\360\226"
+	.ascii	"\267(uqL?\276\340\2264\271\203\362\035\367I:\3369n\201:\231\244"
+	.ascii	"p\273T\317\204\270\220!V\304\313\346\325\311-\227R='\333\031"
+	.ascii	"\271DgE\377\303\324\235\326\335\t\226\346\226gF\354\275!\266"
+	.ascii	"\373\237d\353T)\263f\307\210\324Cp\016\tR\263"
+	.string	"^Dg]\346\330\013\345Cl\246\311P\023&\324\336[!\352\355\337\353b\262\273\277\216\326Nv1\235\217\270\211y\334\340\377\355\326\322\315\244P!5\213[1\211\275\377\027\364\317\272\211P\275v\362\370t\022\217c\354(\241\326\026+\320O\262>\256N\345m\266\355\265\271\215N\245\215\343\332L\036\327&\361\251\215Mb\367\252|:F\213D\016\277!P\310\342\312\nI\313\205\212\035!\206\277\021WVJWV\275\241\322\225\325\211\021WVL@\022A`T\260\304\225\325}\214\013%TX\245\240\032\376\264\204.\206\013\206X\0314\2502\262\2023D\374\204A\0214~C\256\035)|\303_\n\225i\b\334\262Jz\026P\370\333\372i\251\337\320\301B\007\017:\220\356\341\003\206\017\030z\367\360\241\252\352C\207*\365\035\252x?,\341o+\307\325/Kx#\310\365\023\372\206G\360\033\272\030r\035qa\375h"
+	.ascii	"\207[7P8\r\261\256\254n\020h_\374\206\302\037\216-\240:#\030"
+	.ascii	"\f\201u4|\f\255\032\004\036\254\361\023R\r\203A!\325\322\020"
+	.ascii	"\313\303p\013x\003)\253\307\205\245\005\204\261\025\024\3214"
+	.ascii	"\304BzU\225\210\005+L\214P\263.\004\201[\300\032T\\\302\037\016"
+	.ascii	"\240\360\005\325\026\320\005\r\252,!\027\325\205\003Z.T\004\201"
+	.ascii	"GU\304\234\236?"
+	.string	"\316\250Q\371\362\275\341\221\007n\212\227\222\033\2365O\332\2424}\005\202\222\206\215i\310\020)M(K&\244\025\037<l\231e69\247P>\366Z'\352\225\036{VFzm)\263\327\222mhv\027\355\230mrK\366\325\222\371\356|\314\fl\0266\"\215zw\311\022+&\027\206vf\311@i\222\3106o\305|\312\264\242\026{-\023\226\372\026\311Y\231\262\005\t\022\313\344\343d\021\220$\267L\226:\025IN\331\023\355\351\0314\205,J\221\"v9\307\211N\215]\231\260\333e\322\035\224\242\030{-\030K\225\356\004\200\357\250q0\206\0206#3#\"\222$I:\220\002\021!3\326\001\020PF5\232$\255\001\225\201\310,x\005}(X\030\332\246\345\367W8k\303W\0034D\256x8\030\321m\246\226\026*\226B\261|\230;\371\0301h\3047\315\026Y\243^\220\243\262\322\363\227#\314\355"
+	.ascii	"\305\346\302\b*\036\\\217\003^\272G\370\363\220\245XF\352P/a"
+	.ascii	"\317\326K!xE\367\322\307\006\377\004\226|6\205E\312W\t\243\001"
+	.ascii	"\2679\231J\221,'\304\324?\256U.\024\241\006D\305\302\200Is\303"
+	.ascii	";\242\354\227U\220\270\224U\017Xhb\325\021\267\\\247\240\031"
+	.ascii	"S\246p6,\032\242\364\232x\365\353\034\031{\360Tf\261R.\277\250"
+	.ascii	"d\313A#k\272\267\340\270!h\362\357ak\211z\330\0074\001\037Q\257"
+	.ascii	"\270\273z\022\215X\n\031A=\222s*G\202\331\261\025\233U\\\013"
+	.ascii	"\366\235DLD\t\213\214\216\016\tX\332\247\326\310\211m\261!\273"
+	.ascii	"|\300\364\342l\235\217\311\326CI\300\030\233x/!^\312\306\360"
+	.ascii	"\304\023?\311\226r\240\207q\"\360*\222\364d\205\264^w\024\323"
+	.ascii	"\252\340\306\234\206\2540K\267\344\252\273\306<\312\370\300\003"
+	.ascii	"6\264\206\257\260\022v\261\366\222d\265\357\241W/{\034u\241\234"
+	.ascii	"\226\202\237\373|z\263\nA\327W:\356\007_\263\233\233\360\303"
+	.ascii	"\210\357(\235\370\300M\203ok\376\250\223\233\023\217\3637\315"
+	.ascii	"\323:\245\226tEP\020p\343\260o{g\031\002.T\376\366\001\244\f"
+	.ascii	"G"
+	.ascii	"\005b\360\030G\002\264\226\314%\215\n\266\t>\273\2717\215\375"
+	.ascii	"\353\343\373\\\254!\235\254\026~\035/\342\317\210_\305\377+o"
+	.ascii	"\257C\260\246\237\374|\\\303\315\323\237\374\251@=\017\255\002"
+	.text
+	.section	.gnu.lto_.symtab.87f861a0acaf4f7c,"e",@progbits
+	.string	"pinioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.87f861a0acaf4f7c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,121 @@
+	.file	"rangefinder_hcsr04.c"
+	.section	.gnu.lto_.profile.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.ada62301dd55390e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ada62301dd55390e,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\275\007"
+	.string	"\022\21668Pm\323\001\250"
+	.string	"\0208;\351\263X\361\347zlU\245Wtp\026\225\037"
+	.string	"\220\355\022\270\034?\331\342\266\333\226\206y\375l\302*\377\037\377\324\032E\205:\326\335\223&2\005\357d\r\020\f\031i)\2477{\275V\320\226\266\326\226\001V\203\200\261\035\367\211\277\\\264+\302a!\316,\341\240\275\331\3214\335t\234\004\345t[K\257\251\005\327\033\331q\233G\316\366d\206\231\230\225B\243]5\017\265\336E\306\n\235E\034b\022\203\356\307\261\221a\2242PT.\250\304"
+	.string	"`\305\244\203d\242\030\344\020\026a<:{\360\307-\037xE\356\005-K)Ecd\242\376\020\317Xe1V\375\007\371\034]\205\017\304\213\013*\212\t\252O\361?\351\377\311\177\016\3030\374/\360\377\373\377\t\t"
+	.ascii	"\257\354Q\005\243\374\305\232\013\326\b\247:j\265\205\250E\340"
+	.ascii	"\204\261\240\214\001"
+	.text
+	.section	.gnu.lto_.symtab.ada62301dd55390e,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ada62301dd55390e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,121 @@
+	.file	"rangefinder_lidartf.c"
+	.section	.gnu.lto_.profile.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.303198e98848d4dd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.303198e98848d4dd,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\305\007"
+	.string	"\"\31668Pm\323\001\250\300\030<Z^\f\013m\007\326c\253*\275\242\203\263\007\353\001"
+	.string	"\331.\201K\307\266\363m7\365\324d\261\254Q\024\002[\374\247\326(*\324\261\356\2364\221)\227\310\032 \0300\322\316Mo\366z\245\230-m\255-\003l\346"
+	.string	"\301z\324\023\177\271hW\204\303B\3442\215\355\255\243\234L\317\316\243\232\271\361\266\226_\317\n\332\235\364\350\326\221\\\1772K\230\340*G\233]\265\316\264\237\005\306\n\235E\034\342\021\203\356gC#\273 \215\224T.\310\304"
+	.string	"`\345\204\243d\242\030d\020\026a\034r\356`\217[>\340\025\271\027\264,\244R\006\311D\375!\236\261\312b\254\372\377q.\345*| ^\\PQLP}\212\377G\377Q\376s\030\206\341\177\201\377\030\377=\001\t"
+	.ascii	"\257\354c\005\243\374\305\232\013\326\b\247:j\265\205\250E\340"
+	.ascii	"\204\261\240\214\001"
+	.text
+	.section	.gnu.lto_.symtab.303198e98848d4dd,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.303198e98848d4dd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,178 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \023}"
+	.string	""
+	.string	"H\007"
+	.string	"\001"
+	.string	"\315\260\273\013"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.89f1ce3c369381d8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.0.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375`\362\007\245("
+	.string	"\272IP\02080li\016\0030\314\322\211/\370\037\202a\216C\301\342\235\f\013\023 @\020 g\257kAi\262\3266\351\220\204\201J\221\r"
+	.string	""
+	.string	"B\346\bWC'\346m\233l-%\031\365"
+	.string	""
+	.string	"\001\365"
+	.ascii	"pl$>\214\366,!\326\260\304_\321\236'\270*\226\370&\3323\205U"
+	.ascii	"j&\334\007\242=W@uf\342\215\245=[(\205v\242\224\366|A\024\333"
+	.ascii	"\211\327;i\317\030>\235\241p1i\317\232\023\213\342u1\266\376"
+	.ascii	"H{\316\220i\350q\356\213\261uC\332\263\006KE\217{\347\264\347"
+	.ascii	"\r\223v\270\234\353u\264g\016\220\316\\\356%\216\255\303\321"
+	.ascii	"\236;4B\3639"
+	.string	"7ml\235\214\366\354a\221\232\317\2752\306\326\255h\317`\210\212N\347\316\030[g\242=\377\n\321p\272wml}h\317\037\354\336\274\316\325\241=\203\020\264\303\353\336\031\332s\b:6\267s\335\3066M{\026\021\367\346vo\216\261\205\241=\207\365\331\341w.\217\261E\265g1==\374\356=\241=\217p\004>\317\330\357\364\340\252BJ\326\031Xpp\255\037\361\354cl_{\306Ob\354\013\023sb\017\350\003\375\240\257\373\273'\364\206\376\320'zE\317\350\337w\024\366\220D\254\360\261\202+\002\004\005\376G\301\007\350\330\366\360\350Fg\017\3369\332\363/:\203\340\272\321\236y\210\336 \274g\264\347^\241\267/\267\007F{\316vg_\357\026\355\331\367\202\316\"\270=-G\340\243\033Fx\233h\271\241\205\336\226\037\326\302\313\265gx\301=\245=w\341)^x9i\317^u\212\030x\221\264g"
+	.string	"r\3360\274\213\264\347"
+	.ascii	"o\336\264\313#\244=\013`\303B\363\006|\032\264\016<\002f\330"
+	.ascii	":\360\320h\317\005\306\260\036\334/\332\263\0010C\017o\025\355"
+	.ascii	"\371\300w\031\202\361\020ha\301^^\253='\270\302\376\\\005.\333"
+	.ascii	"/\225\366\274@J1\314\223\366\314\340\237\260\b\333c\373\r\230"
+	.ascii	"\f\305\336\301'a\305\036\220\366\374\300\b\333\b\227\217\366"
+	.ascii	"\f\241e\033AG{\376\372 E\022n\032\3559\302\007l\360\\}X5\201"
+	.ascii	"\3023\205I&$U/|\246\233h\246ja\364\024\236\251\017\013\317\224"
+	.ascii	"X\356 ql\263^\230M\31740\265\264\266\26757\265\266\237[\233\032"
+	.string	"\216b[\214_\215\"\032\215_Z\233\333\017\354\013\257\331Pk\373\335X[k\373ua6E\211\353)<M5%\236\351\036\200\035\217\347\361=\316\307\375\370\037\227\3639\007\344\201|\220\327\371\235\023rC~\310\023\271\"g\344\257;\362G\036\311%9%\257\344\227\034\223k\362M\336\311=9(\017\345\243\234\224\233\362S\236\312U9+o\345\257\034\226\313\362Y\377\343\201\274\220\037\362D\276\310\037y$\257\344\227|\223w\362P>\312Oy*_\345\255<\226\317\362[\236\313{\371/\037\346\305<\231/\363g\036\315\253\3715\337\346\335<\234\217\363s\236\316\333\371;\237\347\365<\237\357\363\177>\356\003\3304\325\024\031\007]\244=\034L\323\036V\321\025\r\3720\332B5\267\017\003\315\262\036.\201d\017\257+9\246\252l\271\232\231#>\367V\211%\220\334\302f\253\231J\344\302d\354\230\t$#;\3255"
+	.string	"FU\224&Q%\205\350\356\302As\335\303\255\205W\224{\304\350>\317\215\006\267pYI\0027\261\fq\216X\013\357\222\013\250\222%p\007P\261\311\262\024[x\227#\336%p\243Z\\x\227Zl\032\334BUr\214\013\237\253\231\t"
+	.string	"\217m\266\207\327\322\\M`\027V\315\3244\307\2640p\243=<b\325\\U\263\205\360\334\302\351\251\256\233\b4\313\270\320t\013Iu\365\302fk\213\036\336%qo2\r\242e\027&c\313R\"Px\216\021\315T"
+	.string	"\270\214<Us\227\333\344\302e\250\272\n\321\222H\252f\220,\005\3404\200\222\2501 \342@\354dJIR\224\3022\006\320\"\252\231\252\003\0200B\230hg\fUlW\326\201\231\346:QP\203\326\202\330\205GiE\005\251\3471\201\205\301J\250"
+	.ascii	"7o#\026F;ViB7YX\351\360\342\276\033\321\022\362\021\003S;\232"
+	.ascii	"\251\206|\226\212M\346\350uyj\333\234\202\020\\_=k\t0\224\001"
+	.ascii	"\204y\316\030V$\263\020\033\321\017\304\306\276\335\377{\257"
+	.ascii	"\353\350\342\272\177\256\177\371\246\260\021\265\304\256\305"
+	.ascii	"\177\220\0238\025LI:\245\354z\337\0079\"02\r\240W\333(l\020\243"
+	.ascii	"\212\344lT\"\037\n\323Wv`P\277\034'G\372\352T \312d\034\224\265"
+	.ascii	"\240\022\334QqM=m\367\221\253A\206\377R\273\374+0\334\301\256"
+	.ascii	"\306\344W\007\334\371\322C\366<\314\337\212v&2\372\317\017\005"
+	.ascii	"\315}\315\005\207\247\374\232\032`e\331\332L\354@\214B\372\237"
+	.ascii	"\001\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.89f1ce3c369381d8,"e",@progbits
+	.string	"(\265/\375`!\006]\037"
+	.string	"\206:\306G\240\226\316p\356e.W\227\373>_VCp\320\337\310\344\213\310\221C\334up\306`\260h\244gk\271\353\310\307\t:]\354\340\"@\205qr\274\200o\307\033\370\201\366,\336a\252\365\033\243@\234\200\306fIdJ\001\222"
+	.string	"\276"
+	.string	"\265"
+	.ascii	"\347\241\"\f\235g"
+	.string	"\316\241x\\\3163\207\367+\370\025\254R\021\222T\271\216\220{\321\364\215\330wz\221\231\222'\250x\032\317\363\344m\220$\252\031\272\316}\246\234`7\231\200\327)\30129\003\305\367J\\\322gJk\316v\022\3731\366w\366s\366a\354\257}\234\375\373\3156\027\333l\266\327l\247\331F\263]f\373\212m1\333a\266\277l{\331F\332\336\262\235e\373\211\355+\333V\266\r\330\027\262=e\373\266\217\2665\231L&m\007m\327\330%\203A\032?t\037\274W\226QL\377\210\023\353\261\002\322}\201\222\225{\241\343$\244\353g\331\307\372\223\240\214\f\037F5t\335\365^\031\323\304\364\235\274\b\035\211r\350\356\316\344\212\n\261\t\251\353_\331_r\253Cm8\317)\335\214\237\030^\272?\337+\005|\246|\225\351+)\273h\3311\352\362.\344_\"\362\245O\351\204\347\351\342\001r\b$\255\355\344\221\321"
+	.ascii	"\206(h\314,\tS\217\221\216\342.HH\325\244\353K\331g\372\220G"
+	.ascii	"\305\f\235g"
+	.string	"\360<\317\0028\025M\306,\215\272\021'\034\016\025\007\360\226~\210:\212L:+7 @\272\177:\022\037\352G\fA\202q8EN\246\363\f\275r\265\230\376\226\n9\214\224tqmlN-|~\350\372l\366\233|\r\302\020\207\r]gY1}\2652I\350\246\224%\215\370$\005\244\353\247\331\307r4\023\31176]\213\275W\312`\231\376\031\022\353\214\210Y\331N\207GKG\327/\263o\345W\222HY\206\272^\362^\t\3403\345\311L\277\312.\370#\305CW7&\026S\3043v1\373U\017;B\371r\323u\333{\345\301L\237J.\231d\202C7\300\224\257U\233\262\345\243\353\177\331\227r\257\030\260*\264\033\272\024\336+a\264L\277K\207\020\205G\\H\0315\262\242\024\272>\322\276\326\267JaF`\233\020?\240O\204\215\r\320\267\003\322t\250Y\233\246\205\004\0310\\\310\3258\370\325"
+	.string	"G\330\334\374\200\276\033\340\217\204\007 \007\037\b\0174\037|5\300\033\237\203\0037\277\0174\030\200?\020%l"
+	.ascii	"\260\320a\030\022\255(]\353\320~\024\335\251\332z\"\352.p3\255"
+	.ascii	"+\326h\255\205\017\025*<\273\210^\272V\241}0M\241\303\030Af\272"
+	.ascii	">\303bZQ \031\217G\235\240\206\236\036`\272\326\2401\300\333"
+	.ascii	"\216\035.\335K1\255'\020P9\261\322\034\305yq\022\256I\351Zq\354"
+	.ascii	"\223\351y\004\344\303\245k\243\223\351'y_J\324xty\343\301 \252"
+	.ascii	"\261b\213\377f\337\355\\\216\350\252n\034\235\351&xn\250!<&P"
+	.ascii	"\2240N\024&\005\005\311t\260\002\211\356X\007\021p\241s\242d"
+	.ascii	"\031\335\372\031\304\026s5H\260\322\020>:Wx8\302'\300+\263^\033"
+	.ascii	"\365\034\0340\257\265\031\350+\202\246\215\r\332\226\341\300"
+	.ascii	"\241\203\306`h\200\275\243\310\242\210\364\237\336fP\207\237"
+	.ascii	"sm\332\f1\264\200\374\311\354<\201r\224\033\216v\230\344\263"
+	.ascii	"0B\326\267)\177\001P:-0\255\314b\003\263\256Y2\227T\240\026Z"
+	.ascii	"^\223\277\\\333H\307\272\2174yQ\036\200I\032J\254\366\241\023"
+	.ascii	"k\274\230\236N\214q\0130\247F\026N\273\312>\f\373\244V`1\376"
+	.ascii	"\030x\241\233#\031\236\370@\224\004o\375\204y'\367\034\320M\253"
+	.ascii	"\320R#&4\037\262\240\250.\267\324*"
+	.text
+	.section	.gnu.lto_.symtab.89f1ce3c369381d8,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.89f1ce3c369381d8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,885 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\002"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.string	"\022"
+	.string	"\023"
+	.text
+	.section	.gnu.lto_.icf.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\325\007"
+	.string	"\342\f26P\215\322\030\004H\334=\200\226\301_q\034P\215_}O\301\237\356(\230G\225\337T\324\"\322\316\314\314\314\324333\313\030\376\333\2364\022\2737!{o\231\310\016\260\026p_\267\t\300\020\3514\373\246\223\300\200\220\201\226\302\006\310\004\263k2\215n\302s\3313\177\333\b\245\355\030\nQQ\002\261\354\227ef\362(\001e\273v\205\225D\\\b\333-\004\251\357T\331\263\345\\\360<(5\224\022BA\261\353\223v\234\034L\227\306!\221DV\214\031\034\016o\356\225(Q\r\006\007r\340sA\022\345\365\227\033m'K\247\317\354\363,R\327\327\273\265\214\235\221\210O\265\317\345\360x|\377jx\245\333\203\304\007\004\200\225@\024"
+	.ascii	"1\013\207T\256`H0$\230\tb\202 ef\247j\2450\rP%\016 F\246\224"
+	.ascii	"\006\023\202k(\241\260\246HQ\252\216|\206W\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"u\005"
+	.ascii	"r\005\021\032\260\247\320\001\f\3030\3050I\222$\201\314\254\221"
+	.ascii	"5#\333\244\021\262\367\226)\005\"\246C\242\\\206\315\226*0\212"
+	.ascii	"\260\301\212`\272\305\".N\200\022\001\310\350\320\315OM\363\274"
+	.ascii	"\215\257?\305\257\222:&\274\0213 \360\"\251*\017q\016\256&\231"
+	.ascii	"\260\355\220\346\373M\f\204Fr\013\023\nW\214\273\267\230\301"
+	.ascii	",\211\273p\f\205V\001\377\024\036 K\237'\305\336Ob\235!e\035"
+	.ascii	"\260W_\370\231%\377\270\262\310i\370S\220\254+\306i?\22064\007"
+	.ascii	"V$g 5\206fe\004\220\240\034\363d\031a\004\245\023p#\270!m\r\001"
+	.text
+	.section	.gnu.lto_.inline.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\357\004\235\r"
+	.string	"\326\322B:PK\\\030\003"
+	.string	"P\007J\316\3430\202\230\266,\233nju\3566\325\264\017c>\203~\377\332]\233\271\242\301\362Y~\246\023333\203\354\272\267\356u/\372ii\311\226R\246."
+	.string	"4"
+	.string	"-"
+	.string	"w\337X\206|\334\250q\203\237\033\365\004rw\367\t\317\263\222\244\220\306\302\365\226\004aJ\026\221\374\003$&\216\t\364B\311\342\303}d\212\"\323\270\272d\234\350\264~\001\365*<!\353+\272`7\323@\240\313\231p\241\235_ \020\353\340#%G\025\236\321\365\007rb\202\002\004\211E3!:\032n\f\332\227u\367ar\217\352\356\323?\233&:a\207\335\3136\325}\033\225\002\022\361uM4\220\030v\227\361\364\3239"
+	.string	"'Y\275\202\335\275|C\034\016\"\210<4~\344\033v\327zK\212\212"
+	.string	"5\240\310v"
+	.string	"\250\264\202\210\303'[\323\214\223h@,\315\253\252\017$o\003\231\241\230\204\315\b\217\245\201s\301"
+	.ascii	"\303x\232\007\001F\250\361Th\246\306\202\024\244\320\372\006"
+	.ascii	"\300\"\0219\243\007\022`\305(\006bF\310\250\021\030#\030\361"
+	.ascii	"3\241\315\204e\007\347\350f\026\003\311\317}\3242k\025\301(\230"
+	.ascii	"S\366\242)\205\037\223\206\326pQ\305UN\223\333\230n\r\226D\345"
+	.ascii	"\356\3014.\035.\304\003\366I\367\243\260j|\24023\370&\372|\360"
+	.ascii	"N\237\203+\246\0279\032\034o4\013\216\365\by\321\036\265G\030"
+	.ascii	"\007\3147D\245\317K\231\211\272\2469\235@\250\331\342\341=p/"
+	.ascii	"\276\016\301|=2\2067\334\256\004\377\233\220\240;\206`HKR\357"
+	.ascii	"\306\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\337\002m\007"
+	.string	"\342J %\220'I\007\377\377\360\005\221\273\273\323\272\273\273\343\333\273\375\262\206\366\365\373\361\361c#\302\206Z\263\204l\"\323\016u`\260q\005w(x!8\274!Y\301\031\006\026\004\002\312\024~8\362D\256IJ))\244A\036\362\001\340\034F\342\312\271yt\255^\254]C\347Z+\330a\2317\327\323\013\372\005\361\343\344\311+\025\326\370Z\247\355ZU\332\242\266\305UUc\002k\354!!~S\be\"\002/ \320\3021\273\030\275\213\f\310\345>h\360-\317\206A0\251\340\324.:T\024\274g\342\200\270\211\021\002\\"
+	.string	"\357\272\177\314\241\220\375\327QJ@\\D\223\336\007"
+	.ascii	"\330H\237!\367z$s\311,\267\271\f>\202\232\036\307\220 \002\217"
+	.ascii	"\221\342\205\013\341\363F\340\266\330\277vG\235\310c\031\302"
+	.ascii	"\224r\361\266\221\005\240\201^\021\206"
+	.text
+	.section	.gnu.lto_.pureconst.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375 A\315\001"
+	.string	"\022D\r\026\240\2531\377\233\346uUU\265\372\277\366}\337\367}\337\236\337\266\f\016\371#\345x\343\214/\256x\342\210\037nx\341\204\017.\270N\201\007X-\317\"3\223\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\235\001m\006"
+	.string	"\342\307\032%\200K\322\001\310\220\tyM`\006\2201\023\031\221\0219j\237\373\276\357o\313\030\261}\356\373\276\277eQ\334R\246\377\317\252Q1\026\035\005'\261Ah\016\031\003\246p!\260\301\315c)\257\364\004\213\222(\201'eg\214\037\007\177@\343M\267|>\312%\235T'k\217\364v\343W\016\351\375k\264D\037\313\227B\323\367tA\0012 0\003\021\222m\025\024\342+\003\243MV 0\334\201\265\202]\313 &%\005\370\032\370\2506\260\203\244\200/\017\f\220\032f\006a\017\306\316\n\236\340`\267*\334\225\035\202\207m@v8n\r\254\3046"
+	.ascii	"\202C\231\275\f\353\n\342\356\343\306%<A\310\322j\001?h\232\314"
+	.ascii	"\312B\332\034\002"
+	.text
+	.section	.gnu.lto_.lto.aa2ec325f77859bf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.20.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"\006\340oF\360\262&\035\222\312\231\377\r\016\2311\361\330<\002\n\320Q\025:\243R\030b\r\255Ur\263\246\236\332\356\257\214\274\277\002\225L8G\nc\3253\360\f\274\336\314V4\216#L\270\365;\376\035\220n\204\220M\244L)Z"
+	.string	"W"
+	.string	"^"
+	.ascii	"\273\241\002\217p\217\016?@{\344.\242=:e\013\025X\001\320\231"
+	.ascii	"\341\341\261\273\236\212p\226\251\307L3\345g3X \314c\266\255"
+	.ascii	"jJ\204\200\253l\004\033\002\372\353I\003\2522\353y\336\330`\235"
+	.ascii	"\260\271\376u\004(b,\320\346\271E\330]'\013\344pk\267=\301\366"
+	.ascii	"\003;3\277\350;7\267=\374\343\303[\265t\306\364\003\210B\210"
+	.ascii	"\344\330\255\211\371\330\240\bd\342;\277}\237\347=vg\226\267"
+	.ascii	"\260\201\226\212\335\355X\354\356\361\177\2713\003\007\251\357"
+	.ascii	"\264d\333\001\302\n\327\320n8\362\350\221\235\241\213P\203\247"
+	.ascii	"}\235\263H\335\365r\001\273\255\037\031\001\272\351_O\260#\266"
+	.ascii	"!\205*[\207\344U\244\356\324\035\210\225\302\230\016\203\002"
+	.ascii	"\267+S\342\277\260pR\321\036;%p\303\365\036_\270\013\025nwK\374"
+	.ascii	"\037\223\023?\347E{\004\321\017$z\2708\275\252\215\317\314\217"
+	.ascii	"\230\214\251O\215\025\250\212c\207\252\374h\004l\310\332\262"
+	.ascii	"\271t\267\245A\356\n\025J\371\255\240\324TB!\255\240PN\234K$"
+	.ascii	"&\244\323gBy\250\317\224\341\364I\360PN\244\023\257\364\241<"
+	.ascii	"\222\003N\301`\372\274\225\224\224\317\353\302\230k+\336\004"
+	.ascii	"\305\250**\216a\272\251\263\214\252J\343\267h\234^\307\013\207"
+	.ascii	"L\302\234\312i\362\314\374\360ch =\307w\321\036S\223\006\215"
+	.ascii	"\207\005\327# \240\202\221:\333\001\242\300\352\215\305\255\310"
+	.ascii	"QBz\373\245b\314g\232\rS2\330\352#\373rf\371\332\242U\310y\350"
+	.ascii	"3\246\246\0250\215\310\022\334\262\\p\270n\003\306\303\324\037"
+	.ascii	"\004G\023\206q\241\2275\"\200(\364Z\\Z\241ea\357\264\353\t"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.21.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001\2408\211Y<\207\366]XZ\006\323\202D2U\203j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aT\006Rv-J-\213\022M8lov\306\366{\366G\377\330^=\017\330\025\235\224\354\326\003\033\310GWi\333\357\270\307fn\252\032]\302H\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107\244\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260M\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.22.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'\027\003,\341\006D\356\002\217\262\3008\315\021m\242T\254D\202\332\006\343;\321\353\247xi\345^\216o@\311\n@\b\024\240\241F\375"
+	.string	"\212\313\344\036\224\224n\306m\345N)5"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\020\331\247\307o\260\317\354\b\330\247E{\200\302\311"
+	.string	""
+	.string	"\312\205\300\356nJr\361R\364\277\362\202\224\252tI@\261\273\226)U\310\255\267\355`\333c\377!\376\370cg\375S\245uJK\215\3643\255\265\231\331\005y\031X\327\2249\261}\315\266J;bB\374\310a\335\025\021 qi?\345*\342Y\244\037\354\256`b\002'-\031SU\016\352\300\305_@\331\356\207\307ou|#\354SjB"
+	.string	"k\274e\224\355\256\307g\021\205Y\t\t\373\2742\230\024`\231\344\313\036KRG\354kvw\255+\007\026\234\354\270\320G\024\206\274\314\\\007\343\343\201]\270\205`\267\341\201\025[\310\373\2006\016\f\267\316\202\277\214\016\334D\337\007n\332\270\327\254\256<Q\\&\365\260&U\247Z\252\033\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.23.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"\366\335jF"
+	.string	"\221(\035\277:8\210[\212\204\377\016 \375\237(\376\007n\223\230e\340\337\221\215\246\365W \374n\326\032\022\242\364Y\351\321~\345\231\230\271\264W\004v\307\317\004"
+	.string	"\026\201\235\330\227\223t\f\341[\244\222\275\345N)U"
+	.string	"U"
+	.string	"W"
+	.string	"13\273\341\210E\270O\207/\260}r\007\331>\r\3325\020l\b\020\243\003\r\307\356vZ\002\004\025\374\224\032A\377\264wZ\257\324'\267r\351y\255\\%\b\213\013\033\217\027K.\260A!\342\264G\327k\025#"
+	.ascii	"\320\356:\266^!\356\355\266%\330\006\331\267\t?\367\332=?\273"
+	.ascii	"\345\214\2162"
+	.string	"\372\002\006\274\030\250\355\202\310\311\2615\023\206\313k\267\377\342\303\324R@+\017\020ph\330\330\rE>\355\200\373\374\307\266\262\270\f\374\3144\362cY$>\314\354\356\210\033p\237\td\fSr0x\264\257\342+\300\307TN`\027\026\237\350\321\216r\352\250\366hj8h\352c\304\016\231\236\264E\235 \233\301\2128\266+\\\206\304\355\262J\374\027\032L(\333g\324\020\031\276\360\030\024nwK\374\026\245\023gBe\373\274*Hq\023S\305\034;\\Em\261\177\200E\307\r+\314\376\354\367<\374;\217\005'G\2250\230D3\204\n\231HOT\n\241N\245\021g\021\211\205\320\350\363N\335\351\3632\214>\223\2564\n\221:\321w\352HBl:\361\276\016e2}\335'T]a\264?\270\251Q\351jj\213\017\363\b'dbG\247\272,\243G\245\272l\017{\024\342[\3364\365\r'\307E\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.24.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"V\222B:0\345(\035\236\213\247\302C)\301\244\034\326\275\322\031X\364\310?\022\005\233Jfk\246\377\370l4\210\301l\024\304f\302\300@\023\b\217}\2702\354 \324B\364\223\277\367\336;\2452"
+	.string	"0"
+	.string	"2"
+	.string	"6\305J\262z\030\300\361\022`\267R\316\013\346e<\301\274\204#7\375\231\374\263<\242\200\270T\253\323\237Fbw\375T+\217\033\336\266\202m\007\373\002\0011>?\370|M\303\307\301k\267\343%`g\244\314\211\355\222\275\261\375\236\375\326WJ\257\244\017\354\262"
+	.string	"\304\354V\006/`\227\256\230m?\345*\245!)x\262Mq\027\bFc\313\230\227\017&\370\342.\035\266\233\202\360[F\030\230\311\245O\232\227\207\006%-\324{\331\365\364\240\210\375\270\220\345\371\372\007\331'\344\021u!\r\363\247S\341\321\270\254\243\035\227\2154n\202\2064\017\210~\270\216v\020\274Yd\034\025m\033G7u\357\t9(\270\341\315\213\320\017N\030\021\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327p\221\t"
+	.ascii	"\034\250\361*0\361\340n\217j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.25.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\255\t"
+	.string	"v\222C<0\345(\035\200\213\307V\035\376\266\213:x3\367W:\003\213\036\371\027a`M%Z\264\372\373\\c\rb0\033\005\261\23100\320\004\242N\213R\026%\340\324\263\034i{\357\275S\n2"
+	.string	"1"
+	.string	"1"
+	.string	"\246XIV\323\305\261\341B`\267R\316\r\346e|\301\274\204#7\375\231\374\263<\242|\fP\255N\177\232\210\335\365S\255<nx\333\013\266\035\354\017\004\317\017>_3A"
+	.string	" \004\330\355x\025\330\031)sb\273dol\277g\277\365\225\322+\351\004\273,\0011\273\265\301\f\330\245+f\333O\271J\311\001\360d{\3420\240\227\214\rc^>\250`\213\267t\330n\352\301w\215.0\223K\2374/\017\017JZ\250\367\262\353\351A\021\373q!\313\363\365\2171\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\n\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062\327p\222\t"
+	.ascii	"\254\250\361:0\361\340\256\221j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBufferSize.26.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\200\001\325\017"
+	.string	"6\036lF\360\222(\0352\207\337\333\311U\331\315x[$\003\304\036\226\332H\233\207\217g\243\221\302\023G\370.\346\333\376\362\300{\306\310\202\251N\b\372\337Vs\306\343\342\313\344\363;N\367,\230V\222\277\326\377\326\366&R\246\024Z"
+	.string	"O"
+	.string	"Z"
+	.string	"2\235\032s\206\n\234\340\363\350\360c\333W\361\025*\257\266p\004(k1\230\213 s\206\\\311\t\310\307\355\002\344\343\212\370\352q[]\371\254\307\0061 \333\203\030\016\030\320\303w3"
+	.string	"+R\""
+	.string	"\370\332\016\004a\335\234v\215\001]\252\036\2239\247\025\006\354p\313\033\202\375\031\001\247\035\001X#d\326\322\035;t\351\312\330\337\346\312l\251\016Y\r\222j\317\303_Z\275Q\255\233\372\"9\273Q\300\306\234\034v\210L\234xc\302\257\235\246\345-\2744\033\024sNQ\213-z\274\255\262E\266U\355\317>\243z\350\362\2219\003\272\343\3238\302i\234\324|$/xI>z\3664\037\371\221\243\203\305sf|\364\330"
+	.string	"\250\\\353\202v\300K\n\234\327\262\364C\270\001\334\225\361;\251\213R\313\361\322!\266U.\243\213\241\201B\006\371\250K\242\343\323ax\2379_\f\374\027\237\205\317\234\363$\036}\027\371\370\r\2360\372L))\027PNTP\335\307\241\274\323\311+\225\230J(\022K\n\325}\\\032U u\237)\305\245>\023\206\356\223\300\241:\322\211+})nDbo\305\364q,\236\367q\242\260\365m\256\314+'xl!\007.\0200\233\005\355n\214\355]\233\264\326\025\377\225\364lhu\307K\bW\034"
+	.ascii	"\223\324`\312B\247-\370\265\005\366\332\336M\264&1'\334\330E"
+	.ascii	"\303\002@\212\241\267\350\320x\234\b ;\245v\364SC\273&F\337b"
+	.ascii	"k!^PA\355Uhp\"\220j\360+\035\240\007\346\2724J\224\007\007\007"
+	.text
+	.section	.gnu.lto_serialRead.27.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\346\322C:0\345(\035\200\213'\205\350(\277#K\317D\\\013\335\353\233\376\024\226]\245kl\257\377\372\333h\020\203\361\nb3a`\240\tl\334\211\371\262\034\034\024r\231\211\335\233l\231R2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\007\346\245m7<\224lz\b\262\232\035\256\f\030\200\335p\213\0377]M\376M\236\215l\274\250X\247k&bw\255*\226\306\035o[\301\266\203}\007\236\177\375Y\246\326\250~f\272\304\030\264\354\256b\001\026F\262\210\330.\331\032\333\252\366I^R\372\213t\201\335\226\312\312n\310\340\005\355\322\341\t\346e'\333\237\303<m7\305\361S.*F\363R#\202\301\243\214\264\335\345\370'\"\013-\344\322'\315\313\307\002\327\013\2451;<i\364\260\237\355\356:\266\002\234\007\324\t\201\240N\263g3\321\351>\016\334\300\217\023u\237\304\006\352:\237\315\363\201\333\346\300\036\005\367m!\317\3736M\270\367\214\t\250\210\341"
+	.string	"\315\2425\316\b\301\221\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialReadBuf.28.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\234\001%\020"
+	.string	"v^mG\360\260(\035[\022 }\274y[Nk\336?P\257 2\315\350\213\362\207f\265tC\036#\235\177\271\263\266?\361\016JmQ\354!<\210\267p\340)\220\335\023\2144/%)dw\250u\030}d\266\344\223\275\345N)V"
+	.string	"X"
+	.string	"]"
+	.string	" \334\251G\316\266o\3421+\207s\f!n\263\227\225\0249\265\216]\202\033\330N\347\tl\247\013\"\224\341\351\\\031\372 \221u\312\261|\216tp\001\023Y\276\023\301\212\316\213H|M\0059\254\233\327.c\242KJ\217H\255\325\022&j\270\267\333\036\261\r\301~\217\241\323\374\240\217\377g\223\366X\232\236vO*-\247\364\003x6\3148\260S+\206\035\036\025\207\336\2208\355\267W~\315!\333\264\220ce\340j\263\030\034\265\216 \247~\300\311\323\204S@}}\340\340`g,\350h \245}\231\237X}L\371\200Ze6/j\035\0318#\0321DL"
+	.string	"\022\264\241\375\254\345\212\266\200J\016\034\225e\241\270\241\323\262$\233\334\b3\033/\271\303\266\351-H\270Z_#\237\305\005\023\224\355T\356G\r\243\276\002e\344\327\224L\340j\255\037q\352\247l\247\337\327\276@\224QB\246%w\354\321%\327%\307\006\206\n\257L\364\231?%\357\003\247\352t\202\"QO\345\225\346G:y\252\324\311\304\231\024R\342\231\300/\325\245\300\217\202\t,u'\223g\322\221\300T\027\362a\224\204\017\354T(\024\330\205\306\326Wf\317\351\371x\200iY\321\322\215\331\246k\221\326\272j\350\272\270\002\214\215\364\303mn\314\337\211<\314\263[\037"
+	.ascii	"\017\023p\323\341\244\026\030\243)\013\230cTjG5\006\250tX\270"
+	.ascii	"i\265\241\024\214O\341k\213%\256qL\304^7\016&,{\026%!\215!\314"
+	.ascii	"\220\017\314\201\300@5p\005\314\025\250ppW\220j\360\246\320P"
+	.ascii	"\rAs)("
+	.text
+	.section	.gnu.lto_serialSetBaudRate.29.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\275\n"
+	.string	"\266TKA0\251(\035\210\306C$K\242}A\331\261\\\332_\033\236aM\006\035\022\317\"\021iC\270o\263\026g\221]\373\3111\332G"
+	.string	"\332&\250\244\260JD\013\344\025W\255-Q\341\345G\367'\233\354\235R5"
+	.string	"9"
+	.string	"9"
+	.string	"\341\204%\350\247\303;d\237\364\r\331\247A;\302\303\225=+\201Hk\302\356V\251r\360\021\364\317\372\345\204*=Z,v\327\361\204\"\271\345mG\330\256\260_\003_\375\363\252\037\303\242\243\214\276\305R\342 #aw\344Ua]\263A"
+	.string	"\333\307\330\216\341\013\200_u\370\262\213B\201\202~B`\217\366\007\234"
+	.string	"x\025\351\f\273)\005\013v\003\322\230\223\020Y\262\3559\202\216\356\202l\374\003\036\034\243\3543\312\007\b\376n`Dww\343\267D!\n\200\224}^J\006\017\004\250L\361e\207\245(S\354c\273\273\226);\033H\303\350\204\264\f\272q>\032\350\373p\324\034\215\206\306y\333W?o\023q^\247~8\315S9\336W5\031w\033\233WA]\347UL\270\307V\246|a\3422\311\017/\304)1\351\030\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.30.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"e\t"
+	.string	"v\022C<0\345(\035\200\213\007\323e\350\371%\f\007\256#\334\364\230\232\361\220o)\254\247\277V\255\376>\327X\203\030\314FAl&\f\f4\201\302\234\207+\203J\006\001\037L\354\336d\313\224\0020"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 F&\375#I=$\246\303E`\367\233p\344\244+\311\277\3121\326\007"
+	.string	"\224\252t\315L\354\256\025\245\362\270\341m/\330~\260\357?\206\251\025\252\237\311\260\004 \300\354\246^\0056@|9\261=\2625\266U\355\243<e\364\226\350\003\273\253\001.\273_\203\031\262G\177/\220\217\331\003\260d\273\342.O\313\006\247!\037\025&\030\343,^\266{\212\360WB\031\231\311\243/\222\217\207\006%-\223\276\354\257\244P\304>\266\273k\270\262|+Z\347\303\001y\237-sgc\301\331:\315\233^\247\205\266\216b~6\216gv:on\016\314]h\335\004q\\75\337\336\022*\230 \2075\212A+\224P\002\344\024\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.31.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"m\n"
+	.string	"v\324H<0\345(\035\200\213\017J\304,=H\371j3gqn\310p\023\371p\250m`MTk\270\217o\272A\f\306+(\331\r\003\003\032CG\341E\213L9\321\021:\2364\262\311\336)\0054"
+	.string	"7"
+	.string	"8"
+	.string	"\013V\340N=\236`;\345>\260\235Z\264c>\202\354_.\0310"
+	.string	"\273[\347\307\305K\321\377\353\033\325\nu\251q\330]K\325j\343\236\267\235`\273\301~\r?}\353\3274i9\245\257\321\304^\016f\273\032\263"
+	.string	"+\2431\021\333\347\330\226\343M\304\273(\274\331\355\220a\340N\021\264K\373$/\021\337:]`\227\245\262\262;\006\034\030\023e[\364\224\217\333\275\360\370(\025\022\246\355T\316\002\030\207?1q\273\353\361a\245\t.\344\264\235~N\226\231\221VJ\316\354\021%\247\207}mw\327\223e\337\025]\350\023i\035h\364!\205#\2173\250\003\361\361\300.\254!\330\225<0TG\336GTA`X;\006\376\":\260\222\276\017\254\234q\257\355d\371\241E\226\232\026\016\220tj\323r\232\023\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialSetCtrlLineStateCb.32.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\n\001\265\f"
+	.string	"F\327TA"
+	.string	"s\233\016\270\277\253^\266\206|\255\312\247\372\023\005\246\034hI\315'\304\037p6\223g\323\032\221i\b\227c\007\\\243t\230\200\312\245w5(\225\211\bB2I\327S\r=\3036O\2156\2212\245?"
+	.string	"B"
+	.string	"@"
+	.string	"\323\243;\373\306\301\021\373\260\206\206\025\036\273k\251\210w\2274;\377\341/&\037\350\322\207\253\2249i1\022\360y\322\202Q\n\210\207O\016_I&\305\331]\247\311\347\341\216\267\355\3006\307\376'\237\036\372cL\247\224\376\205\312!#\301\214\335\016-?V\024a\224\260}\214mU\261\r\226\006\t^00`\275p\303\346i\377\304Qt\017\215\234\300.J\f\027\273 \003+\250\036\r\276\300\364X=\023SjH\310\342\245\017\333\021\316\302S\355z\033\177\005\206\3543=\246\"\240a\nO\361\251vw\343\257p[Ebdz\274F\023;z\204H\262\305\006A\251!\354K\273\273V\024\373*?u\360\001\234\005\214\023\311.*\344JN\313\036"
+	.string	"\360\245\221"
+	.string	"\322\321\260\315\3324\254BG\203`\211t@<\326\245m\226\346\200\263\t\230fqY\246Y\030p\257CD\242%\022&)\2354\252S\035@\005\016Q\006\005\345(\345\344\205\332\023\032"
+	.ascii	"j\231\"34\030\271Y\200\330\rJ1\313\032\325,\b\214#\304\"\023"
+	.ascii	"\206R;b:@n!pL\b\353\032\233\016\343yU\016\\\001s 0P\"\030\021"
+	.ascii	"\240\242\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialSetBaudRateCb.33.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\t\001\315\f"
+	.string	"V\327UB q\232\016"
+	.string	"\243\262\212@\362\370\217)\233\037\300\362\255\306"
+	.string	"\r\205\276\250\262;tJpr\204\0202m;5?\r\314\204\205c3\361"
+	.string	"\217\323\br\214\333\002\223h\bu\360^\206\314\272\221\275\245L)A"
+	.string	"C"
+	.string	"B"
+	.string	" \322\2439;\307=\022\373\017&\303\313\216\335\255t\304\271CM\316\377\367\314\312\307s\350\341\nAX`\214\002|:\250`\324\022\342\337S\303G%s\022\331]\347\312\207\303\035o\273\201m\021\373'\001.\377t\357\227\036\372#L\247\246\237\321|\250\201@\307\356\206\030\230\025\305\031&>l\337\245S@\300v\037\016\006\351Y\350\261y\332Oq\025\334C\235\017\330\005\321\210\261\353-p\002\352\321\336\tH\217\324\0039ja\221\241\306\244T\222\357F\227<l\227\334\005F\355v\033\277\305\205\t(\322c\352\001\033\326\316\002\205\332\335\215\377\262Q\240Jt\244\307k<\261\002E(%cl\317\223*\302>\334\335\265\202\354\007[\205k3\301\254\211\304\312-\303\036hl\205D\030\341d\227Vi\331u\302\311 T&\234\221\222\312\312\264*\304\2001\tWVm\030\226U\037\336\036\256\202\354"
+	.string	"\204(EU\240&'\2254\252S\r\340E\007\021\006\365\004\032"
+	.ascii	"j\2312\023\317\361\302u\r\220bV4\252\005\020\030G\210E&\f\245"
+	.ascii	"v\304t@\334B\330\230\020\016\314\272\302\232\303x\240D0\002\302"
+	.ascii	"\005\205\34020\"@E\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_serialSetIdleCallback.34.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\325\f"
+	.string	"\026YYB"
+	.string	"\221(\035;;\255{,V\034@\306\350+k\342\332\027b\205\337\002\244\265g\201\"N\007\300\320^y\001\271\3427\346r\373\257\242\376=b\242(\346\246\357\200\207!\352\262n\237\036C\377\337{K\231RG"
+	.string	"D"
+	.string	"F"
+	.string	"\233\017xw\266\335\300\001\311\245\307\020,wYAY\321\332\215\227\202x\351M\263\344\233\336\334\t\206%\243E\346\341\332>Pr\214\360\310P\rA\313\024\363\325S%;\311\324\204\354\2563%\353p\273\333\206`\373\201}\030)\333i\316\343\257\271\352\177N\253KgK\277CBl\325P`c\227e\006\307\312\270\030\022\266Iv\307\266F\r\006"
+	.string	",\212\325\342\311\264\217\342)HW\231<\300n\n\306\213\335\310\300\0136w\216/\360\356\0022\034\324\224\037\342J\246\026\275\324\021\026\rT\336\260M\341/\242\315.\312\343\263\330\200\225\274\273\324\217\031\306p\025%\036\237\005G\233\335\275\210;\337\344\335]\277z\202\0220'T\247\234\261\243)\325\305~\333\335\265\006#\237$\201X\204\016\177@*\210\204 ht\215 (C\bN\270,\204DD\327\007\216.\220\003\306.\200\340E\202a\360\352\304}[M\371\305hyq\221~\351}u\001\312QU\025u\310IOZ'5\372\324\251\034%\220b\"\023"
+	.string	"jM\001#\336\220\205\200[\200\026\263BQ-\200@:B\2342a(\265\343S\363\332\022\210\273f\323L\210\240D0\262"
+	.ascii	"\025\fU\345\024]j\017"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.35.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"}\t"
+	.string	"v\022B90\3456\035\200\323\013p\035\350\271\360\353\251kO\t7s\254\250\270X\300\343\020*Df\027\205O\261\240\264P\204*\f,\n\304\245\344\356WAC\342%r\334L\310\226;\245/"
+	.string	"2"
+	.string	"/"
+	.string	"?\250NY7\250N9\264\001|\034\331\213>8D\246\335\275T\344\341e\350_t\001\321\323\271\f\200\330]K\321\343q\353m+\330~\260\257\001\024\211\304\3661\266\025\345)\341Cn\231\004\253\001\"\216v7c\007\353T\302\224\343\205\251\341\322~\311M\302\203\374\362\202\335\317\311hw\314\230\301:\3451\232\341JNU\225js,\344EK\225\225\322\206v\354\261#5\304\376\334\335\265~\354\207\376\371\361\327\203~Y\r\220\\\026N\273\035\247"
+	.string	"[\n \307\3512\n\003\261\315\3242\016\003?n\263\234i$\260\315\323\276\353\363\264\212\315\333\\\334\206M\\\231\367]\032\004w\024\232w\201]\347]\230q?W?\216`)a\004\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.36.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"\226\225N?\020Q\234\016\030\216\200\362\260\007r\024\370r\312\263\236v\007\254\205\252\315+\257xA?\266\210\260\257?\005+k_\021meF\""
+	.string	"P\026\026\001^\007\220"
+	.string	"\020\204\007n\366\201\376\264\211\224)\005<"
+	.string	":"
+	.string	"<"
+	.string	"\236\361p\303\376\304\241\302\211\306\356b\252\341\336+M\317\277\307#!\320\363\n\303\265\232\214L\244\002\200_e \325\221\341\036O\013 (\023\222`w\235!Pt\307\333V`\033\201\375J\325\356\256\225d\337\364GMg\246\017\341h\361\202"
+	.string	"\214\335\013\0377\026\025Ux\220\330~\332\377p\020\336M\235\013\330%\235@\261\033\036p\201\353\321\341\007X\217\327'\326\243=\007)TK\2665V*\203\0212\276\264a{\373Is\355~\026\237\004\205\216c=\246Rb8\302Ep\256\335\265\370!6\023\256\016\217~\307z\274F\321\212\032\246O~\330\241'\265d?\031&s\331t\031\3552\246\342\340\242qY\207u\\&A\343\032`\031\355\362"
+	.string	"\303p\035V\241x\203\220q\330f\3338L\022\356\253U\222\027\270@}\024TE2\252S\r\240\004\013\324\247\236Lu\214\002\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialEndWrite.37.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"=\013"
+	.string	"\226UN? O\234\016\300X\026\030P&e*pJ\215\001\371i>`$&8\224K\244}1:\n\361-\342\306\330\2151\363 \257\323\226\002\f\240"
+	.string	""
+	.string	"\362\260\356)`G\364U\f\013\364\247M\244L)<"
+	.string	"9"
+	.string	"<"
+	.string	"v\3610\303\376\304a\302\351\305\356b\212\341\336+M\317?\307#\"\360\363\312\302\265\232\220J\244\002\200_E \265q\341\034O\n`(\023r`w\235\"pt\307\333F`\333\200}K\325\356\256\265d\337\364GMg\246\017\311\360XQI\261[\341#\306\242\"\212\r\022\333O\373\035\356\301\273\311s\001\273%\022&v\303\002\256\\\217\016?\300z\274>\261\036\3559'T5lo\254T\005!Z|\351a{\373is\355~\027_\204\204\256c=\246RX\370\301At\256\335\275\370\0378\021.\r\217\276\307z\274\306\221\212\016\023(?\354\360\223\252a?YF\203\341t\032\355r\306\302"
+	.string	"\243qY\207u\\\006A\343\026`\032\r\323"
+	.string	"\313p\035f\241xs\220q\030g\3338L\022\356\253\325\222\023\300@\2014TE2\252S\r`D\007\352\323O\2466H\001\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.41.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\345\003=\033"
+	.string	"\2462\256H\260XQ:\320\001\030O!0$2\305U$%;@\002\305Z>\034\371\207\332\242,\024Q\343\023v[Z\\OI|\365\301\016\230\217\352Xh]h\275qc(R\271\013\374\203\303\370\364\214\003\330[k\204\220M\344N)\223"
+	.string	"\237"
+	.string	"\224"
+	.ascii	"Hl\213\304f\306\301\234\367\335n\004\350\306W_\020yN\373E\236"
+	.ascii	"\204\273\021\240\003\250\325hI\260V_\316\251[\345\251}'0\236"
+	.ascii	"\226\0270\236\332\037b\373f\207\271OG%2\316\016s\263cA\r%!Sk"
+	.ascii	"u\235n\016\257\311\341p8\274\350\273\307\305\235\034\251\270"
+	.ascii	"\263\304\371\007>\305\242\027tr(7G\325\217\030\2476?`\\\024\311"
+	.ascii	"\235\213\0365\275\235\030A\030\325\364\340'\257\247\233+\340"
+	.ascii	"\263\300K\262B\255\325\317\311\270S\267}\303\366\005{\305\004"
+	.ascii	"\363\276\377\003\256\200F\255.\206fj\021m\362q\246S\261\fGg\303"
+	.ascii	"B\207\004\025Uu\276\226\355c\331\211\006\254P\372\361\\\247\207"
+	.ascii	"\362\265\357K\371\223\317\2378'\210\020\037{\305\344N?\177\342"
+	.ascii	"GA@\344P\334\340\301\355M4\234 \233*\364\005\252\301\203\237"
+	.ascii	"7\321n&D\231b\241<\365\231\276\304\017\336I\023\333l\001}'Ml"
+	.ascii	"\025\204Vd\020~\211\252\325\327:5\205\362g\372\300\233\275ZY"
+	.ascii	"\234_\272\371j\217\310b\222+\341\256\304N\242M\325\341h\021\254"
+	.ascii	"\265J(Oq\304\235\377\005<\246$\215K\356\301\f\235\361\263\324"
+	.ascii	":\370H\276m<\0357\025\204\2117#7\207t\225H\331\365D\313Fq\037"
+	.ascii	"|\200,C~^tSh\002\363\353]q%\024\3516\310\303\261|\200B\001\242"
+	.ascii	"g<\335M\260\343O\016q+\"\312Zu\020\374*)^>\022l<\235\373\247"
+	.ascii	"/8\242T&)7\207\336\213\265\326\272{\344}\004\035\302\250\271"
+	.ascii	"F\336r\024\016}x\215\354\377\376\232/\3754\254\325\227n\025\315"
+	.ascii	"t*5]\212\323$kz\244\253iQ5\275\251\351$`\323\304k\261\037\031"
+	.ascii	"\214\276"
+	.string	"j\257\021\342\016,\366\252\321b<\245a:%^<\263\035\232\2136\3339\3013\033\341\212\361\274z\\\260\031\315\245s\3002\023;3WM&\233\271V\266\347\327\bx\fe\260\344V\210\334#\223T\312\032\027\220\262\226.\317bI\2634B\272Z\325\362ZW\355\034\363\273\262\247\200Chc\334#\333\fN\227\265\244\026\025@t\256\332U\316\030.*j\b\315\241\rLr\277N\255WE\273\r\322\360.\033b R[\300\213\223C|KOYk\205\340kI\301\001h\357\364\007Q\250Q4\246\034\"\304\231\t$\222\231\031\247\003p\002\231\272\272\r\020hH6\035k\372\201P\002\207]\364A\311\\M\212TV\234\300\217\n(0\nF\267\210\265_\222\007\303\002\22784\320\240 \276\231c\220\240mZ<\201F\335cA\3420H\2773.\323\202\t#\326\003k\031\326\030\220P\037E\211\242l\201\220N"
+	.string	"\225\237"
+	.string	"\224.E\203KA\264D\b4\322\342\322,\357\327\214\304W\204\210/%\316d\360\025{Q\210\374t\221\224\330\234"
+	.string	"\317;\345qx\277p\003\302+\032\215\016\266y\326ku\206v"
+	.ascii	"\323<5b+P\001"
+	.text
+	.section	.gnu.lto_serialReadBuf.part.0.44.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\244\003\325\031"
+	.string	"&\356\242I\240\230Q:\300ul)^\272\332\262\344\344\260\314\361\333b\220\217\225\257__\3334V\200n\221\203\274\224\345\237>\331ak\345\020\334\275}\017V\341\371\360*L\215\035m\242\276\036\362T\346\0250\376\177\371\2154B\210\334)\005\210"
+	.string	"\223"
+	.string	"\211"
+	.string	"`\222\216\026\006K\217\224{o\207\300YM"
+	.string	"y\251\375\036?y\336\333y\200Z\207\234\236j=\023<\264\314\370\320\347h\237G\016\350:\276\203\307:\360|\301\023}F?JYj=a\017c>@|\b\036F|\270.\f\340\367\373\375\016\236\367R\335\305\020\\\252\322\371\274\236\213(\036\222\274\035\005\301EZ:\362\342\201"
+	.ascii	"\035\360\300Q\364\246\323\021<\223.\253\306\211S\230\253T\020"
+	.ascii	"j\255\036S\334\343m\357lG\260\027*\016\257\364\203#\365\322\017"
+	.ascii	"\b0\023Uk\211\037\227\032\024\022\231q!?\342\231\0069\343\214"
+	.ascii	"\225\206\200\037\037>#\251\231\0067\343,\020\360\343C\250\310"
+	.ascii	"H\214\371\"\302\0242\242Q\315S&\307:\t\017J\262\321Ej\355\373"
+	.ascii	"D\016u\353i\202\343\346\017\371\223M:\347NV\365\230d\251\265"
+	.ascii	"\2229\246\276\220\234\337d2\b\223\3161&\217\037\304$\223n\354"
+	.ascii	"\001\032\227|;\244j=e\036\372\301\370\220\376G\356\254<\323/"
+	.ascii	"\351\300\227j\n\251\250\001\351\225\222t\002\227\341\353\210"
+	.ascii	"\017\243VL\211\300\002C\305\365\270\253\255\t2\267\007\303\231"
+	.ascii	"d\030k5i\374%\0354\334\354\201\242\243\035\224cWr3\326Zi\374"
+	.ascii	"$\245\314\227\261#>T\355\241\216\240gD\313\321n\301\r\367VB\330"
+	.ascii	"\360\331\335\377t\331\321\237\177\235\370\245\373\246\203EVL"
+	.ascii	"\205h\341C\177\336/\020\026CH\350\022yU\247\201\242\004\206w"
+	.ascii	"\310vQ\277\\\324\256\026ukEM\376\307\317\"\251W,\352qE\255:\322"
+	.ascii	"/\20246\261Y\t\342j96Y\030\303\305l\300\231\254\026\303\335j"
+	.ascii	"\264\3212\005\034b\264rv\203\335\312\231\007Zi\003\253\321b7"
+	.ascii	"0Yy\203)0`[\207Y\t\303\331l%\214\214\361\360\373z\255!\354\326"
+	.ascii	"G\214\021>\271ks\220\230\362Q)\320Z\327\204O\241\260d\203\206"
+	.ascii	"\326\223c\227R!Ji\341\202\370\220\334?\035A/)\307\321.J\025$"
+	.ascii	"&p\211\374\341\206\223\312/n\\\241t\277#X\373\255!1\345\2132"
+	.ascii	"\351\026\357\301Zk\335%\262\275Z\337\t\016\307\001T\250\201,"
+	.ascii	"\306\2302$\240\021\221\031\231ia\033\220\002!\2721\017\020\200"
+	.ascii	"F5\255\001\351\202fI\225\274\212t\337\210\032\250z'L&\375<\301"
+	.ascii	"\357\235\355h\370\t\326\234c\354\223\362\337\317\251\207\325"
+	.ascii	"\0045\372\bAW\271\212\216j\223u\347S\303\035k\236\335S\353^\321"
+	.ascii	"\006\323)B\344\254\335MJ\003@\261\272\321k\004\275\016KyA.\240"
+	.ascii	"\300\031Y}\240\2002\f\031\020\fu\034=\221O\222\007\373)\350w"
+	.ascii	"\332\313\330\253\311\270$\033)\350\031\254\251#\273\311\370k"
+	.ascii	"\003?\005\357\266e\021DC\272\370k:\024\315K\361~\373|\367\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`\314\001\225\t"
+	.string	"d\r\310\002"
+	.string	""
+	.string	""
+	.string	"\002)\177/\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 ,\1770\252\333\3426\024\1771\360\372\2508\272\200\202\025\1772\200\200\200\200\004\026\1773\027\1774\362\375\231\027\030\1775\031\1776\032\1777\033\1778\034\1779\310\331\316\370"
+	.string	"\035\177:\036\177;\037\177< \177=!\177>\"\177?#\177@$\177A%\177B\005\003C\201\204\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\312\302\353\343\003\001\225\007\004\001\330\244\235\311\003\001\325\001\004\002\221\205\327\307\003\001\225\001\004\004\225\001\003\005"
+	.string	"\342\001\004\005\303\376\236\020\006u\004\007u\004\b\221\215\300\227\002\t\003\n\001\302\001\004\n\236\376\353\301"
+	.string	"\013\004\f\r\016\321\231\263\346\017\020\003\021\005\"\004\022\023"
+	.ascii	"* \340\242!39\210\260\214\3451Y\220\353\212\025x\037%\202K\260"
+	.ascii	"d@M\022\321\\\273\370\027O\342i.\360\340%tu\024\033oD\206\340"
+	.ascii	"~\371\364\360\215\337\340\033}c\361\033\276\3417\306\277\021"
+	.ascii	"\341\276\201\337\330\337\3707d\304\350\317\206\200&\304\231w"
+	.ascii	"L\030\270\231-8\006"
+	.text
+	.section	.gnu.lto_.refs.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.aa2ec325f77859bf,"e",@progbits
+	.string	"(\265/\375`6\"\355\215"
+	.string	"*\335\3000Q0R\312I\007\372\372\277bv#j\373\346\335\332\333\177\273\373\272\256\352\230\370\257ywz\277\312\252j\353\357\354\276\3526\266E\237\243\267'<+\216%&~<=\356\360\314\0203\3233\263\263\252\316*\263"
+	.string	"\250\020\250\312\322\374\177l\323ml\"e\n\201\002\374\002\n\003\201e\356l\354\306H\225\265=/\255g\035^\272\004\245\002\323\332\352\316]\330N\007\211\226\016*m\331\256y\013s9\333\261\226\233\344e;{/\222\031\201\034f\004h\332\262\220cA{>\256\034\307t\234\007d\255\f\335\234\333\0168\254\266Q\313\234\302\366\326\366\306\365\017\202\345\376[\342&H\025\223K\333\327X\317\307YP,\241x\265e8\236\233\303kk{\026\326s\030cy\013!D\013\232\220\266z7\367~\335{\r\310Y\262\365v\333\362\025n\263~[E\254p\032\315T\356\313\225\266\254\306mB3\243h\263\333\370\213\331TeR\363\226\335\373\344Q\217\234\354\245\265\3455\246\302a\007p\225KP\301\325\243\330\363ki\t\253\331\366%\254\237\362\001A\226\302i\353\226\323\231Y[6\343)\034\266"
+	.ascii	"\237\235\201`\264\323 \237\367\331Xf\244\214\265\335a\022\301"
+	.ascii	"\366`=/\020T\247S^ \310b\\\326[jU~\264\3451\206r\330\t\206r&"
+	.ascii	"\343(\267I>/\364\336\247\316\r\262\007\332\\[\023L\"h/X\317'"
+	.ascii	"\202:|\"x>\233\020W\216P\311\265\025@\354Vp\021\353{}T\372d\022"
+	.ascii	"\301\225\001\b\022\360\253\303*!\360p\003\236\005\374\252\f\037"
+	.ascii	"X\351\373\231\203\373]\370\253WY\257\371\325\252\377\\~\006\341"
+	.ascii	"]\326\237=\260\2411\003\340\347\025#\220\005\374\254\201\001"
+	.ascii	"d\t\374\274\201\002\337b\177\306\200F\307\303\374\334\301\305"
+	.ascii	"$\311\371U\031?\237\370\271\005\003!~\225\350\347\030;F\370\002"
+	.ascii	"\3210\021\277:\024\302\323\201\2373\360\361\200\016?#y\373\177"
+	.ascii	"\346g\026\237\262]\347Wc\270\371U\034~\316\201\346Wo\370\331"
+	.ascii	"\350g\t~\026!\007O\240\374\316\257\006\375\354\366\263\225\237"
+	.ascii	"\251\374|\366\263\331\317e?\223\375\f\375y\354\347$?\213\375"
+	.ascii	"\034\366\363\363g\260\237\263~\376\372\331\353\347%?o\375\254"
+	.ascii	"\3653\221\237\251~\236\372y\310\317\315\237\205\374\034\344g"
+	.ascii	"\251\237\243~V\372\031\310\317\314\237w\370\371\307\317P?\223"
+	.ascii	"\360\363\221i\376\377\374\274\363s\211\237}\374\317\373\177\367"
+	.ascii	"\377\305\317=~~\372\331\351g\036?7\375\314\364\363\362\347\245"
+	.ascii	"\237w\374\234\3643\322\317G\377\365~N\376<\3643\362?\333\317"
+	.ascii	"%\374|\177\346\341g\023\376\203\360\037\356?\211\351t:\375i\262"
+	.ascii	"\374V\304?\200\212\026\312z\373\265j\271G\265;\333\303\n\307"
+	.ascii	"x_X\244\355\366\367\2745\226\034\233{\247\340\234\367\316E\233"
+	.ascii	"\256\353:\b\016\353\271\216{\267\265\225\236k\271\306\302\321"
+	.ascii	"2\020\344\262H\357\235\373\004s\235\205\301\324LY\322}\241@Q"
+	.ascii	"\002\005\n\013&\311\023 \204\366\326h\275\032\270^\345[\257J"
+	.ascii	"\327\250\016\033\201\323\002x\267>\252\322\255\\\202\001\bv\225"
+	.ascii	"5KT\245\212\021)M\245\327\202tN.Y\253\275\327\262\320\346\210"
+	.ascii	"\264\355\264\020S\264,m*\330z5\311zu\312\333,\b\021\22753){b"
+	.ascii	"a\302\264}&\3272g\316$m\331\t\023\"%&\363\257\307\331]oVXY\230"
+	.ascii	"\314?0~\302^\202[\216\230\314?\253\"}\244N\216\311\374+\003\330"
+	.ascii	"\227\214\223\217\3778\n\265s\223c\201\3162}\354#0`\374\205\307"
+	.ascii	"\034\rMy\217\311\360\237\216!@i\020!MDE\321\322\246\250\356N"
+	.ascii	"\212\324\243\245j\206\362zzh-\216B=o\223p\b\216\311l\244\244"
+	.ascii	"~2`Hy\355\230\036\223\311d\202\277\2034\351\252.RQ\264\274\311"
+	.ascii	"\261\260\025VdW\306\374\335\373\374\337e\r\245\237-\326Oz\254"
+	.ascii	"\303\332\253\2354X\377\320\320&\353\257\216\302a\335\244\225"
+	.ascii	"\274}\350%/\361\2747y\357EQb\335c2y3a\337vk\315\377\332\272\270"
+	.ascii	"r\370\202,\261\332zs}\335\362\027h\324\266\2230\035\026\233\017"
+	.ascii	".\326\243\241\352\303K\223\262\276\273\264\262\204Pf\264\342"
+	.ascii	"\220\274\263\360n\252\352\220P\365\324\221\276\222\300\316\251"
+	.ascii	"\324F\336W\354\364&f\325>\326\235&\"\322T+\2316'2=\365\246\302"
+	.ascii	"Q\353q\004m\310\315\363x\365zH7m\304\340\335%\2379C@\234E\274"
+	.ascii	"\254&\244:\n\007-\310V\221\006\362\216\262G\24283m\233\251s\247"
+	.ascii	"\344\374\321"
+	.string	"?\232\256\2501\265m(\035?\245=;\271\265}\334\2125qTd\217\2704+ON!\302\230\222\326x\274\235l\321\034\026[\333n\022B\031;\232\266m\245f\032\303\003L\223\251\2277L\254\276\267^z/[\352\"%\333\366\216\347\321\\5\035\307p\332\023.(\253\266ck\004}d\204\363e\211\017P\3716\312\241\232\002\306\331\266u\330%\271\ri\333\310.\"\343\204\224\245\250\211\324\255$\024Q'\337D5\322*R\276\332\366P\232\034\026<%\353\337wZ\203gU4v\346<\375\2227\305\325\226\3150\035X\020d[\016<\030\2763\315\277\267\331\2475\2578$\353\237<\344\317OX\245\227\305\331w\366\023Z\0019~\321\331D\373\372\240\326\253\235\307\210\271\311S:\212\022\346,\006\217\265(\227\222\264e)\323\325\310\365\300\005\326\226\363\030\314\315\036\225\231\013F\257\353\342\222\206\356\027\316\231&g"
+	.ascii	"\333\236\217\361\202rK\001K\270\254\224\004"
+	.string	"\256\247\341\262\032Q\265\214\250Y\301{\371\331\\Z^\250\345\211\253Vj\221\253Wa\352\225\232\265\036\357=>\357\022O\221\352u\375](\250\0234\246\0041\246\"\271\232\205cE\206\212T[\025K\270\304g\307\325V=\302m8\3232S(\215\327z\232\252\365\357?x\221\313{o\023\315\363.\207n\3164\214\303\352\355Ug\270\367\330\346\334[\271\322\220@n\342\376\321{\223SG\017\246\230\222S>\224\320\251{Lj\035y\226w\352\250\204\336\313s\223\311#\b\315\313\243\204^\246KD\307\304\3679u\274\311\346\345\271\311\2134\241LN1)\241H&\036%t\212\351B\247\356\316M\"\227F\311\273\344\271\320\2510\027\332d\332QB\233LJ\350\024\223\223\224_~`bsR\031\341\2432yw(E!\227;Q\345\263y\273\334\313eEw\231\300\275Q\315e\027\244\017V\033\212\356\030:C6y"
+	.ascii	"\245!\252\346MF\225]\315{\273\206l\\%\n\216\317\350\275\342\350"
+	.ascii	"\221H\324M*\272\227\200\373\274W\351\336#\337\350\275\367x\357"
+	.ascii	"\255YF=\357e\356(\235JJ\367B\225P\272Q\307\265\242{\273\354\213"
+	.ascii	"\032\223\022J\325\354Y#\203:\257\216\347\221\235\267\313\324"
+	.ascii	"r\205\036\303n\322\275\227\307\254N&\036b\332\252K(`\317\266"
+	.ascii	"9T\240\270!\035\031\255B\260\350\224<9\335\370\361U\341IE\r\235"
+	.ascii	"G\255\266\320\037VF\202\311,\036Um\205[\214\274\244wO\350\b\250"
+	.ascii	"%;\332\326\360=\207(\273\270\244eJ\334\332f=\247\316\274L\333"
+	.ascii	"^=m\226Q;\271\347\217\024\245'\037\177'\342\244\332z\260\027"
+	.ascii	"\031\250\254\310\236\216\232\310\035_\237\323\223P\313\262I\304"
+	.ascii	"CJ\307J\312'\245\251\211\254J\311(,\246.\372Q\205"
+	.ascii	"\213\337\222\307\330\374m\231R[Rw$!9\"j\033\204\02364\245\033"
+	.ascii	"Tr\306\225t\002\207\214\335\020\023$\365H\307\313\311\n\311S"
+	.ascii	"\307f\rP\311S[U\207\252\274j\244\026]\325\210\202\346\275H\325"
+	.ascii	"H'\360^\244\016"
+	.string	"3\002\314\b\330\037\250z0\013\332[\300\365W\211\216TM\255\220\222\335%t\322\364\362\321VEJ\213\370\331\331\360\211\005\276\265\325\n\342m\2719\251w\212@\222'gm\243B&\037 \\\333+\275EE\321\322\2041)\351\275\267\fZ\263-\215\t\351\322wuK\\\030/\312\330\217\336\3531\254\247>\2355Q\250\260\244y-\3451\224$\005\202\263\354\2503\"\335\353\263\347]I\367\032\257\177\250a\313\325lh\207\264\367\332\256\267\034\205cQ\267L\373\365_\233\3513\315\327\200\035\330}M\206\303z\217\345\336aZ\214jDd\250\031\200\275\225\256\301g\027)\230\2620\274/v\213KZ\017\255\327J\202`uF\260xYo\265\364\227\233\256\246%-+^,\332\372\303\034\210.NxQ\202\213\024\306a\215\242\217\221\006\031A?-\206\305\240\0267\206F!\034\\\350\204\300\342\006\321\206\013\021$b\264"
+	.ascii	"\240\204\013\234\027<BC#\016,r\214\030\201\307\bD,\256@\003\007"
+	.ascii	"\013\234\021\227\221\023\001\004\306\242O\r\020\320\300\301\202"
+	.ascii	"\304e\020\213C\240a\215\365\024X\360\200\005*r\324\\\305\212"
+	.ascii	"\bVD\020\274\212\025==+,\350YoA\217Z\364\261!\303\026\207D\032"
+	.ascii	"D#\320p\006QhCp8#\350\206\035\302P\001G\b(\210h\254!\250&\306"
+	.ascii	"Z\\\215\267\001\001\214\024@A7n\004\3110\361C\3641Z!\0305\200"
+	.ascii	"\210\305\233\030A\032\204|n\330\031>C\033\326\270\026\215+\330"
+	.ascii	"@\034\312(!$\336\370\030}@\310Q\314\271\r\003\036T\303\260\230"
+	.ascii	"\302\030\024TL\021b\230\003\321E\216\027\"\206?1|^\274\260\023"
+	.ascii	"\242\006\020\321H\364\201!G\013#\206\303\242\b9^\374\370\030"
+	.ascii	"\203^\314\360\031\266 t\301\203\203\261\206\033!\024\2074h\340"
+	.ascii	"`a$\336\020\002\362)\276p!D,`\b\243\030T\203p8#\b\005\343P\250"
+	.ascii	"\306\350b\bD<\341\247hla\034\n\211\210\321bh\364ia\006\016\037"
+	.ascii	"\026\306\241\020\016\r\034,nX\201\2105\2061\204C#\261\b\303\f"
+	.ascii	"\240\341j\204!\301\0044p\260\230\3413,\326\374\004\005\261\200"
+	.ascii	"Ac\024\202a,\006\255pS4\256@\302\bCE\215\021\206\005=F \"\216"
+	.ascii	"\325\bC\310\205\341\r\242q}OO\013\023.\2440\302*\003\202\037"
+	.ascii	"\037bq(\224B\2508\264\201X\234\221\002\210\350s#\205\214\242"
+	.ascii	"P\n\b\n\240A\206O\214\237\037\237\026\303\237\031%\030\207B:"
+	.ascii	"\207\203S\243%\034s\226.\335\327\337\325 \256F\231\3649a\223"
+	.ascii	"\253@\311\251IN\215\033\363*:\323\"\224\002\004\002\247f\351"
+	.ascii	"\270\232&O\276\333\366k\022\313\325\254\262\263'?7\016S\335\030"
+	.ascii	"\217\204\213d:q\345N{\374\335\245[\003"
+	.string	"* \026+\266*V\2544q\332$21+(\033\033\373m\301r6\205\271\342BCS\251\224\250\022\325\353\372\273\221\322\331\245\255]\245R\003E\311\214S[U\355y7S:\374\316\264U\323j\232\352\231z\306]\326\324\364\272\3768\212\331\225\260\266\257923k\243@\233\307\\\273\353[\3252\265\254\235\356\234\352]\037\340S\334\252\222\251d\035%'\245i\262JzK[[H\013i\252\365\216\360Z\352u\375\t\227D\371\001IWuU\023\361\006cgR[\327\324\026\245m\027\351\"}Eu%]\241\216\230\241j&\315\244\263\326\373C\347N\332\244G[\365\251>;\253\016\311\031\364\342\366\004\b'+\030Xg\361]\236Y1&\345\207\221v\266\263\271\326\343\333J\345\204t\245m\223&\252\227\r\224\006]gB1.\201D\352\017W\275\360l\212\330)%\005{\254]]\352\222u\347\016\341}\335"
+	.ascii	"\005\351J\365\341\352\222\234e\217\247Y[U\311\315\224(S:\025"
+	.ascii	"i\t \222]\333\007\217\234\352\226\223\305$y\022\026\323\267y"
+	.ascii	"\257\263\206lLK\232\023\202\356\250\202\3418\b#\235\021\222\021"
+	.ascii	"\021\221$I\322\001\022\013\020\006bi\230&\317\003\022 \024E\320"
+	.ascii	"9\312\220\320\210\210\222\244 Ia\332\f\330\001e\210\3037\201"
+	.ascii	"\302\236_\323\f\303/\033\367\n\263)\032W~\332\213\027\317\230"
+	.ascii	"\023\314\347Q\236\267x\020$?\362 \013\346\313\276g\372\2400'"
+	.ascii	"e\3046\350\033i\3426\215\253\016A\247H\325\211\311\027j_\300"
+	.ascii	"i\250\331}\2667%\344\023\035~`q\236\2529\245\013F\353J\272&E"
+	.ascii	"\313\323\233\350QK\331\017\360\256\212=gXk\367=\2169\241\374"
+	.ascii	"dM,\227\\\211\271n\f\240\274\330\310\b\235\220\246\364\202F\332"
+	.ascii	"\2156.SbT\233B\311\\\030\322,\237\252>\366\320I\tE\305J+Qg&\225"
+	.ascii	"d\352Q\304_\213ap\222\311\351\rFA\240dOFG\212\216\"s\316\266"
+	.ascii	"\266\245\372zec\350\316M\203\305\267\036\342\256\307\215o\215"
+	.ascii	"\215O\035\377\356\212*\201\217\334s\312\2720q~Z\313#\025\227"
+	.ascii	"\262\250\317\233\201\003(U\356\357\374\234\206\312\252}QG\252"
+	.ascii	"\257a2\351\260\030\001\337\356)a\330A\253\006\253\264\222\274"
+	.ascii	"y\335<\202>\203\350rV,N\262V\364\270\354<\255a@\007\251\336\326"
+	.ascii	"\214]\206IZN\265\004,\036jD\246\0076F(\034\362\n\221`h\312\317"
+	.ascii	"Z\3439\312\273\335\022>AQ\252\227;5\023k\306"
+	.string	"\340C\177\177y\027uM\031\225M\251\035h\030\275~\233/\017\013-\033m-\340a\215\215\200\200(4T\304i1\"B\375\300\026\227\226Db\235\305-\375\3569X[\372\byi\274\255\241r\326\344\320^\214\206\001\356\207\250I\360\366\273\333fD\316\2618\320;\"\306\177F0\373\016.K\256z%A\3158\263\203-\fOR\204\356y\355\267i\355\317\033\200e?P<H\027JP\212\035!\275\366\262$\256(\346\304\351\301\317\221\\\374D|'\n\243\023!\31198\021nR\361\360\216\334O\377@b\202\320#\254\234y\024\303\334\340\004Y\204\267\377\307\361\331+\003>x\231\f\200\030\324}w\216\230|=D=\r\034o#\312\024\370(!\341;%iI\302C\026c\356\243\2558\2260\243\233\267@s\027P1\030\035\340\240\201\347\305$\2324r\0273\276\363b \0057<)I\372-,\306\315\344"
+	.string	"\247\265\r\364 M\017O\206\275N0\227}'\245'\220\032\bfz5o'X\333*\331\245_x\302!\026\343a\306m\247\317\023\357\220\347\017\252d;\346\"\006\013e\274zpv\2611=1t\353\f]{\023Gj\372\315\022!oe\3637Z\242\242\353\200\207v\206\225\342\254\275\274\t\243\\\026\256?\221\216\212\016\037\326a\025<\023g&g\236\366\"`\277\245<\345US."
+	.ascii	"\001,\263\207\032\320Br\245iv\313\230\332\312a)\311\225\244\f"
+	.ascii	"\315\326]k\320\0360\301\237\263e\310g\203m\200<\2465\177\216"
+	.ascii	"\2441V\035\321\374]\rT\245 t\342\006\267V\262\357\317D\250\007"
+	.ascii	"\rx\305\272\303\017iI\250mdyA\004\245\215\227\351MNf%\245\300"
+	.ascii	"WD\334(\321\272\034\305\nK\340\326\002&\366\364\002\262\2509"
+	.ascii	"\027"
+	.string	"P\360DZbM/$\355\233\036\207+\214\b\210:\"R\262\256\243W\3205\017\274\373\271\347:\024\351\255\204\247\3329\332\201\002\301\346\034\340\250\374\354\264\"\325 \2646+\023\335\3005\177&\265\231\032\275\332\234\203\226\215\376\371\037\031\026\347D\333'\366,\007\224{\t\032 \351"
+	.string	"\207\235\344\323&\223eV\t\244Y\367\204"
+	.string	"2\267C^\252\206\277O1M\242\341i\320\336\377\250l\307\203!\314}\345\021T\203\277\376$\207\3329\271\361P\241\366\373[\366QH\261\322\006\360Zv\005\304\005)\006\226\366\266\221,G\305\232\337\335\301\367)eA\356\310B\366\240{\037Gta\034@Z\260\323\300\343r\240x\021Dx\202\206\315@\335,1W\337\025n\0072\302\"\354\034\207N\0222\237s\221\201N\016\306 \305\202\302F'\005\243R\021\332\262V\270\276i\035\316z\177+\033\006X\253"
+	.ascii	"\357\261+#\006\362\036Bh\337\030\210D j\315\207\331\"\033P\302"
+	.ascii	"vIO^\035\213\307\343\256\315k\323\226\177p\266{Y\341d\313>sL"
+	.ascii	"6Xn\220t\277\235b\211?\376\377@\335K\033wN\246\333\034:*u1\301"
+	.ascii	"x\351b\350\343\273<\372=\361\366\226!ig\016.l\334_Cn\333s\237"
+	.ascii	",<\177\222\344\227\324\002\331z.\312\352]E^\270\351\327\331w"
+	.ascii	"h/[\262\327pw\271\203=\360\337\375\331\352\243\352\n\357<\337"
+	.ascii	"\016n\233~!\026\233'\2120\355\376\204\027\277q\377\360\3069\317"
+	.ascii	"\333\235=\2233\034\007\356\257N\344\315\373}\177\3603\340\210"
+	.ascii	"#7wc\206\367\314\374\\\306\341t\267\266Q\356\372c\367\026\250"
+	.ascii	"\335\001\030\352.\004\177\233\340\213p\023 \247\364>\321\r \303"
+	.ascii	"4\313\332\275\370M\267\251\372+\365\241\322}\362\277\263\202"
+	.ascii	"3Z\344\267\201\027\364%t\366i\3558\316`\363\266\036\\\370x\306"
+	.ascii	"|\313_/\316]\373i\374L\245.\244\377f.M\036%\\\301l\241\177\313"
+	.ascii	"\345\345?cA\003{\215w\342~i9~\310\252\025"
+	.text
+	.section	.gnu.lto_.symtab.aa2ec325f77859bf,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"serialTxBufferSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"serialSetIdleCallback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aa2ec325f77859bf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1219 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\030"
+	.text
+	.section	.gnu.lto_.icf.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\305\n"
+	.string	"v\320?<0\3058\035"
+	.string	"\306w\215i\216\257\351\2161b\336\241'\"\267yz&6\221a\306\276\3335\240\372\021t\b\f\f\f\f\f\f100\320\210C\356\255\370iI\333\335\366J\2647\265\035/"
+	.string	","
+	.string	"1"
+	.ascii	"-'\350\26311\241\325\240\023\006\240\375\311o\035JDXS\336\\\022"
+	.ascii	"C\036\364\364\377\374\3453\352\321h\260\256\353\362\275\211\027"
+	.ascii	"+\220\304\310\013@x\373\226\217\237\261\244\216\323\341>\326"
+	.ascii	"\256\275\237\275\217\337\277}\354\366\365\034\0265\250\0220\231"
+	.ascii	"G\013(\224\225\025\244\364\021k\001\005\004'\371jU|\214\334m"
+	.ascii	"g\364(T\346\374\374m\023FJE\261\247\334~k\332\021a1\332\354\315"
+	.ascii	"`\253NB\224m\206\352!\245]\357;\201\231v\355\346\362z\337\t\304"
+	.ascii	"\3203\2604&\002yq\220\204\302\201z@\362B\004~[#\2331 \033C\204"
+	.ascii	"\315\345z\337\t\264\364/o\313\373\365}\356\375\312\003% @\002"
+	.ascii	"\245`Y\007\007H\331+P\267Q\275a'\331\232\243\025^\201KF\254\362"
+	.ascii	"\356nqyOcb\b`\263\257B\013[\310A\200\302\252%\007\360\372\204"
+	.ascii	"X\3306\270\256k\002\333\347*\247\\[m\212\214\026\352\022\261"
+	.ascii	"\356\212\336\200k\345.\214\213_$\025w\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`p\001\335\006"
+	.string	"\222\007\024\027\2009\351&\361\231\220\211\r&5~}1j\203\333\232\265d\313\224\002\256~$\032v\205G\215\342?\314\216\001)X_\f\204\262\302\256\303\262f\264\262\357h\340u\017`?\252\256B\306\354\223D\317bB,\251\220\343=m\234]\032MKp\211E\250\361\271CQa\332\f\200\002!\243\262\003\021`\251c\316\321\224\244\262\261\035\305\021\314\220\256\0301tA\324\345\370\033g)c\321\300\021\257\013\274\270\021\274\232\234\214\234\320=\362\221\355\206y\221D\345|0\314\264ci\235g\333i\257"
+	.ascii	"\351\324\251\244 XE\345,\375B|\202.\2062\202\203B\360\030\024"
+	.ascii	"R\245\f\301\335+t&\334\210pA\266a\210#\023\317\372\314V6\301"
+	.ascii	"\024\220\261\213Y\r\247\212\352\310[\272T|"
+	.text
+	.section	.gnu.lto_.inline.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\227\006\355\027"
+	.string	"v\336fE\360\260(\215\001\332cs\270\366\306?\223g/\25303!V\221Z\235|\254\354\311\255\374\366d9E\235Y\016g\320z\034\002\375\253hX$\2613\351\034.>\026\353\250\252\177f\035\252\276\202xR\362\267\2242\005L"
+	.string	"M"
+	.string	"]"
+	.string	"$\332)+W\313\030\273\353qn\347v2\310\231\237\234\017\370\233\225H\"\005\207\203\350]\312#\002\207O"
+	.string	"\355\365\227\370\"\372\200\304\227n\240\001#S\032\337#\252\347;Y\211\347\271}K\265\267\210\216J\034\307W\356\356\212^\300!Y\261\321K\216\234\032\004\372k\211\\\"\346h\222(2?,nq\307\277\352@\377\207\366\343+m\354.\352\231lv\367\264\350U\247?\t\224b\331R!\315CS\373\t\273\013\373\222T\001=\002,\273\013\340\267\352\360\357\310\331\356\206\316?\025\027H\nx\b\027h\\>X;\0233|R\207\374#\331\322Ap\364^\212b%\246\206\350K\264\004\f\231\315(\033\244\213l\346\205\333J\245\322\266\345L?\351\352:\222\244\312\307\256\304\260b\247e\364/]i\361\240\342"
+	.ascii	"L\n\316I\202I\230\243w\276V\356\270\b\241C\322\024=3\001\277"
+	.ascii	"\352p\223\250\303,\203\206\324\271\001\243\321TQ^X\030\241\032"
+	.ascii	"e \021\363\306\234v\203\217.7\025zBo\2225<: @\034\344\013ML\013"
+	.ascii	"\367i\003\341\252\022\361\004\252R\302gluT\240\2512\302\032;"
+	.ascii	"\231m\233\362=W\312\270\200\362\023r\351\326\203\215.\310%\204"
+	.ascii	"\200\250\250\241A\"\231\231\221\202\202\302Bc`\002\031\032#\353"
+	.ascii	"\022\300sE\205\262\f*423A\322r\n\245\235\003s\266C."
+	.string	"*\n\336SB:\326\250\311\355\321\235!\"\023 \306O\272d\305\361\005\212\345RB+2\362\325s\305!\241\242\330!Sl\244\206\006\246/t\301\225\213\033\261\202(\t\003\233H\374\013B\023T#\206S&I\271A\350\357)\bML\376\332\237-\032\332\362\205\344d\346\342E\234\345\236\210\371qz`\211\017\177\226\034\320\242PF\274\016\234\377 \257Q\327@\021\242\221\213+\007\201\003x\265y\310\315\"W\366\035\030\231&j\320\203\352\317\027\220\r\240\312\341>\235\232(\315\277q\tI@\001\2277\264\271\234\371W\231\361\350\325QS\222\271\203-\317\226\356\034\t\234\213\222\361\003\263\226\365Z\354\256b\347>#\030V\231\020\256`g\026i\2452..S:\036\023\274f\306\241\304W%(iJ[9#)\305\345\273\245\025\234Kt\037\263\307\024\266\206\326\257\245\335P\2441`\211\033\261o[%\350j\204."
+	.ascii	"\236S\262\210!\b\210\272\205\2020\277\315qdo\017\0310k\365\306"
+	.ascii	"\223\237^\215\r\336\206\214\271\330UPt\rP\245\206*\253~|\034"
+	.ascii	",\214e;\253!x\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`t\tM\031"
+	.string	"6_jC\020q\224\016"
+	.string	"\200\""
+	.string	"(R8\262,\327YcC\260H\005"
+	.string	""
+	.string	"h\331\016\b\037\250\276\327\374!\253\023\221\200kP|aM\022\266!\364\002\300\255\303R\317\252\355\337\277\363\370W\2665\220 \335\177\357\224dJ"
+	.string	"["
+	.string	"Q"
+	.string	",\217\240\352\036\27364\363}\337\347oTo\224\235;\336\236/\3116\274\334\362`\244a\210\326\345\023\335b\257\260\327+\322^\221\267\356cK\035[V\325\213\360\256\177|=\360_h\037\364\3757c\337\276B[7JCu\203%\2522\\\303S\345"
+	.string	"\341y\037\f\304\020\ff_\330.\214\340r\2718\326\304\3052\313\b\302\360\273\023\362QuQ\\,\222\021\224\252%?n\\{St\370\201\303\037\3030*\236W\342^\233<Xg\310\bQ5\245B\276\345b)`q\261<.\316W\002P\370}\366\347mq\005^\210\222|\325\324\by\205\207Y"
+	.string	"\215\277\3742 \240\376\034A\034\020i\203\310[\236\363M\320\300c\343\345\r\355\016]\247\242cX\343i<O\2207}K\337\316\267\343K\372r\276\037\237\345"
+	.ascii	"U\001\252\022I&\031zm\251\321\265\314\264\030A\022\001\212e\242"
+	.ascii	"Y\342\272\311u\333\352D\343\270\356dn\320D@\025 \210\230l\024"
+	.ascii	"\013e\032\207\ru\332V\262\223\246B\235\246\206\rT\362\231\246"
+	.ascii	"\271\332\270m\252h\253\224\f\323\302\310G\261\216b\241P\246\241"
+	.ascii	"\266\023\312\234\252\016e\246\210\346J\325\245f\306m\030\n(\226"
+	.ascii	"\211J\231h.H\021\225\2148\240p\201D\302\003\223\215^\002\200"
+	.ascii	"\246\250"
+	.string	"!M\244\320\314\210HR\220\2440\034P\002!\244\252\214\007\022\2401Q\nd\031\016#1\304\2141\206\310\320\230HRXZh\rZ\367\224\365M\202\360\254\313\257\035\267\211\263_|s\354I\316\330\267\214^\020\302+\227\302\216\265\270\001\3025\252\235\246,\217\343\322\210\323\025\330\003\024\313\001\230\350\265C<F\264\323\333],W\373\027\002\204\271\"\365\213\370C\025e\375\\\254H.\031bA\314\307\370Z\373\237-\370\300\200}\263\301\367\262V\202\032\267,oAx\303\320-\203\2079|%\003;\370S\270\263\265\f\033l\272\005\301\255\013Hi\251\242MACJ\006d\331\344\361\3504\261\315XxS2\333\356\374W\251\023\252\373\357\211\330R\303:\352\242{\3515\035.nY 7\251\035\212M\211\245\032|\314\273\237uy\373&z\302\373~\341\023\2540\3750E\250&=\021 u,\240\342\270\302\325\255\276"
+	.ascii	"4\265\360\200\307P7\231) M\2159\321IfJ\n\216(\f\031-\246\034"
+	.ascii	"\016\\\226rt\3168t\313\221>\232\0224\2548\232\213\002\343\215"
+	.ascii	"\366\266\235\234\300:Ik\241\276\341\016\337\344=\364\352\217"
+	.ascii	"\353\210f\232\324s\375! x\356Qp{\245\306\343\323\330|o$\307\325"
+	.ascii	"\374\207\2457\275d\227\034\022\331\232\311\302g\025\220\275\023"
+	.ascii	"\361<\240\373E)\226\303\253\352\205\377\331[\006"
+	.text
+	.section	.gnu.lto_.pureconst.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375 A\t\002"
+	.string	"="
+	.string	""
+	.string	""
+	.string	"\024"
+	.ascii	"\232\004\001\272\005\002\272\005\003\232\004\004\232\004\005"
+	.ascii	"\230\004\006\232\004\007\230\004\b\230\004\t\232\005\013\232"
+	.ascii	"\005\016\232\005\017\231\004\020\272\005\021\204\004\022\232"
+	.ascii	"\004\025\231\004\026\271\004\027\230\004\030\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\232\001M\t"
+	.ascii	"\"N(*\240'\031\016\377\340\342:\367\377\373\017\303\272\377\207"
+	.ascii	"Ws\366\223\326z\223\264\211qsn\311n2\373\337\235\255O\310&dK"
+	.ascii	"\231\002\377/}V\027?\204s\026:\021:\025:\235NFgB\247C\231\013"
+	.ascii	"H\360\277E\031Kn\245\035\345\300\317\210\025p\320D\241\250D\002"
+	.ascii	"\322\246\251D\271EM\367\341As\225\257\362\206*\001?\243N\250"
+	.ascii	"\023\322t\343\243\374\321\331\372\333)w4\375\007\004h\230\206"
+	.ascii	"zy\370\373-\216Q\336\222b\214.\302\252\347\221R=\366\204\241"
+	.ascii	"\214\375\346\374io\224\2772\301\rnDA\250\361X\305\230QXfi\rp"
+	.ascii	"\202!\262\353\006\021`A3\312\202\202f\2175@\270R\017\">I\246"
+	.ascii	"\343\225\337\322\3425t\353\3758:\021\2110B\224l8\025v\236d\264"
+	.ascii	"]\201d5\332Lh\005{\274T\363\366\243B\261t\005\036\202sk\307w"
+	.ascii	"\253\353\266\227?q\207\037\255\333\337\360H\260\037q\266*\013"
+	.ascii	"\201\300!\023\252\307\017\362\024\366%\325\227\262u\361\326H"
+	.ascii	"\264\363\025\312\265O\362w\200\326B\373\351\004"
+	.text
+	.section	.gnu.lto_.lto.fbdd682e78d27034,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ringBufferFree.18.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"E\f"
+	.string	"\006\030T@0q\222\016\003\023\350h\350f\016z\017\315\326\234\374>\303\030\264Z\375\337\206|I\371\214\302\323\030\2623\357\r\022\317H\260\302\362\177W8\0308\3010|.\254&\0053\224\264,!{\023)S\n@"
+	.string	"@"
+	.string	"?"
+	.string	"\273\021\201\341t\3478\331\366K\334\204\306X\024?t"
+	.string	"d\034\f)n\354Fx\371\200w\027]\300\273S\017\307\236\230\177\226G;8\314\340t,<\245\005\273\353\344t4\334z\333\007l'\260\277!\351\310\245\365\361O\217\327A\006\001\030\273\031B:6\206{\021\302\366\375\226\203J\276\331"
+	.string	"\215\022\037\305?&\337\254,-#v\2272\261\251\273\26456e;\323\276\366\025\315\343\311\003\354\246\344p\021\252\007==+8\264\355\330{*i\332@\361d\031\362?\266\276B\302\264{A\201\257\242\002\211\017\342\344\335=\375\347\3519AB\333d\310\216Y\252\212\375h5\305v\351\311\245%\227~.\355\034 W\372\301\307%22B\001\204\201\203\f\346\202\031\253\252\254\020\230\3014\250`\310E\002?.\266\"\210\\p\202e]\220\212\233\333\221^6\232yRI#Uu:\251\023ED\206y\013\247\005jh\033\310\020\316\242\232vU\002\025"
+	.ascii	"2\003\302\260C\013u\270y\221aL08\241\020\202\320\2572\277\231"
+	.ascii	"x}\034\230k\270\262M@\240B\001\272B\235\016\312\222\275\262\002"
+	.ascii	"\2320RRL\327$\003"
+	.text
+	.section	.gnu.lto_ringBufferPush.20.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`'\002\365\022"
+	.string	"\206e\202H\320\360(\035\332\251\bf\003\t\310\366\267\264\365D\316X\314\212\265\033\031\226i\216\035\366\2066\356~@qA\255\365_-\216\301\333\004Y\364.\231"
+	.string	"\253\031\204\362\023\371Q\263\213G\330\001\264[\031\344\230=\311\337\204H\231Rl"
+	.string	"f"
+	.string	"q"
+	.string	"#\337\247\037c\3369s9JT\355\003=Hv\335\314\007\314\331\303C\232s\\`1<\350\361!\362`\370\002\362\240m\2270\220y\366\321C\016"
+	.string	"\247\0175\273\2509Gq;|\366ou\346\323\376-\211%\036\030F8\235\357\227 \347B\007\004g\373B\232xb|w\275\301\321\250\246N\346\234V\033\\\206\033\274m\t\266!\330z!\363?\007\375\031yP\265?8?\271 \235\220\366\354\221\246\353c\377\233sNo\217\375\361\0079\321\255\272\356\017`\265\207T\207)u*TK\251\006S\352O\252W\252U\252O\300\004)\212\206\001\2459sz9&\023\230$\342D\277-\363w\376\360\205>$;\221LH\303\020\242\260\201\2301\347\250\340\240M\302\203\001j\302\306\013\332N\203\254\217\364\022\023\300\363a\344\301\003O\034\344~\233\332\353\270\225"
+	.ascii	"W\356kv\324\264g\325\356\202\2532j4\330R\256\002\346\333\024"
+	.ascii	"\016S.HW\323\025PM;\273>\336\325]\r-\321(\016\333*O\301\n\347"
+	.ascii	"\234\273\"O\272\232\366\374U\255\356\241n#l,7\n\277\340N\213"
+	.ascii	"\033n\375D\205p\316\235\006~\321\212K\2047g\216\301^.\226+\345"
+	.ascii	"SHa\265|\254\230\330\352[\301\324-$0\326\312\212\314\n\205\305"
+	.ascii	"\245\005\023]^.\327KEti\245\270D\025\230\005\221d\304\257\027"
+	.ascii	"\026L\214y\275`\342\3078\277=\226N@EG\373\317\344w\217\340\024"
+	.ascii	"\242\350H\375\231\364\330\233\365Imm_\270v\353,\226\007eSC\350"
+	.ascii	",\251\332p'lP\272\345\236d\333\003%\274=@p\320\201o\007  P\202"
+	.ascii	"!\242\354\016\b\004lu\034\325Pd\332{D3\001\211\030\240'R\255"
+	.ascii	"\264g\3455\273\003\f\341\254U\322\222a\177@\226\034X\215\204"
+	.ascii	"d\2131\230{\316\005r\363\354\244\360\232\235\003\326\200\301"
+	.ascii	"\310\277B\231\360\341{\317-\200p\350\345\024]k\017"
+	.text
+	.section	.gnu.lto_ringBufferPop.22.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\207\001\225\017"
+	.string	"\266\236kE\360t\224\016XJ\354$\341M\300\370x#\345\006p\210E\314X\316{\337\235\267=\226c\204\373\262\264\265z\032.\337\317\022\021\332\240\377:C\023\207\305\302\224T\001\301\201\262\335\332\211\340o6\3336!\233\310\235RV"
+	.string	"S"
+	.string	"["
+	.ascii	"<p\f\331\r\023\\\032e\306h?\305U\240\036[\371\200]\027 5\273"
+	.ascii	"\241\002w\363\322\341\013l\227\363\004\266K\333FY\200r\352\341"
+	.ascii	"\013\213\207\307\r\227\214\221\335\260\323\020O=\246\374\313"
+	.ascii	"\\;\001\313\361jQ=r\020v\327\361\325\302\341\326\3336\261\035"
+	.string	"\301\216\002\0023;TE\005a_\333\335\265\272\330\017\357\316cn\316c\377\334\2427\031-\271hm\213\326-:\312\350\003\340l\3500\340c\227e\206do\244\f\022\017\377\230G\033\345\313.c\217\017\363\025\250\307d\230\252\r\263\005\313\246\301\274,\321\036\236\346\226\340h\002q&\306\016\225\256\375\027\245\224\311\213o\332.;\032m4x\320\364*U\353\3212\301\2123\253jzW\222U\234\231\243QU%\rW\007V\350.DQ;\021\243\323\230\346\356\316+'\023\202\"\266r\205\263\360\346\356\007\006\376\f\351;\360c\304\245\277\262]rT\312\202\034\211\301\304>\201\237\027\3628\337\302(\245\244\205J\247\217\366\001\243)\234\200!\025\025\323g\202\2104\002;\322\347y\037\250#\215R\274\016\004b\350NJ\374]\b\201]\351\373\300\316\023\356\355\216\006p\325\270Y)\313\233\316\320\027y\021\371E\033G7\225"
+	.string	"\203\321\202\275\3066\0074[\017\020\\:\360\355\032"
+	.ascii	"2\003\302\260(+\024\204\003\303\256F\031\330\342'\214{P\350D"
+	.ascii	"\236\353\001\201\020\345\t\310l\324`Ge\334\324@\214e\005\344"
+	.ascii	"\23284\301\341\302j\212\024.71,&$'O5c\022&\031"
+	.text
+	.section	.gnu.lto_tcpVTable.28.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"}\006"
+	.string	"\364\n\307"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\334\304\007\177}\270\334\304\005{y"
+	.string	"\005\001\006w\001\274\236\264\245-usq\006o\006m\244\245Xkig\274\236\374\244/ec\270\317\344\007a_\370\316\224\ta]\270\316\204\007[Y"
+	.string	"?\202\210\200\360\001WU\307\001S\306\001Q\305\001O\304\001M\303\001K\302\001I\301\001G\300\001E\277\001C\276\001A\275\001\277\177\275\001\275\177\274\001\273\177\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\r"
+	.string	"\200\224\230\244\310\220u\370"
+	.string	"\330\005V\023e\330g \b\2063\354\233$\231I\352"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_tcpIsStart.32.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\214Pc\305YA\216\261G\222\316\242\337\256\235\376\001\230\326\254u\252\263{\r\276\227$\325\020\004D\222\341U=\"$\245V+\261R\312\024ORf\322$,`*G]\355r\224C\345\024ZC\205ah\223\273\232t\331\312P\256i,\3135K\266\250\240\324\213G!\0369\260\343\215\031?l\0221\214\306\r"
+	.string	"F\251\002\026\236\f}\326I\275x\254\254\202\376<5Mp\344d\227\"\224\262\"\021\210\306\317y\313\006\007\234\337@\204\226\220Hx\240\354fM1\360a\276\0217\220\340#\004\373t0\003\020v\367\304>\025\270\342_\360K\377D\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.33.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\026\325KA0\307(\035\020\335\036\225\236]q\275\347\222Z7\265V\361{\255\267\23734r\017\262\364\004\007\334\326\032vb\212>\324&\214]\323\226\231\341\241Ks\210H\313/\257=\311B\016\250lv\223\275S\n7"
+	.string	"9"
+	.string	";"
+	.string	"\257\335Ja\272}\272\236\001\363\271}\001\363\351\320n\360\252Z\f\006%\004\036\354.\225+\017\037C\377\255'\234P\244\307\314fw\035O(\224[\336\366\203m\013\373\032\001\365\236g\375\232\026\035e\3643\023\206\340\253\004\273'\263\b\033\233\006Z^\177;\364[\346l\327\221\215\311$\343%s\260['>]\261=\332\007\360"
+	.string	"\341Y\243+\354\246\\\001$\222d\333\273Kd\213\262a\001\310\013\370@T\020q9]^\f~\200e\333\356^\370\002D!\020*\226O\177\204\371\234Rb\005\201U\2123\273\222\242T\261\257\355\356Z\246\354\007\340\273\273\243\001uB\033\036\034\317\327\201\024\374:\221\347\343\240\037\036\316\207v>\220j\034\354\201\272\217\206<\357\243\\\335k+S\236\260XI\232\314\305\313(\247\264;>\361's)\001\020"
+	.ascii	"3\241\t\037c`\013\257\204}\217\312\004\251l\240\334\243\210\326"
+	.ascii	"t\202\251\t\"]\263'&HD\221\315S\247\3075\274\020&\031"
+	.text
+	.section	.gnu.lto_onClose.34.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`p\002\005\023"
+	.string	"\246c|G\320\322(\035R\016\205C\230\224%\265\247\213\025\325\374n\305\224VP\372\327\207\217\005\257r\200\023\312\b\377\261\036E}\365\372ub\345\372\370\003\276'X\241>M\210\273\345jB\204_T\233\316@\001\354\223F6\2212\245d"
+	.string	"]"
+	.string	"k"
+	.ascii	"\007\262\210\355\260Fe\306\341\201\320\021\321nx\340\321\t\300"
+	.ascii	"\247}\024\277\305\216\2639\200]\236\026B\273!\002\243\300G\207"
+	.ascii	"\027\360=\202/\371\036\035\263\177<\364\331\024#\035\026F\273"
+	.ascii	"\213\322\020\217\335\323\214\371$\225\022\255&\273\007\342JR"
+	.ascii	"\303\361Lv\367@\317\016\265Y&Iew\235\264\332\207;\336\016\354"
+	.ascii	"\254\0215\337\343\365\273\235\260\314W\330\007\270\273\013\374"
+	.ascii	"\234\252u\362\371y\364m\276G\022\315\234\016\333\rw\223;;\224"
+	.ascii	"\245\366\330\367vw\255<\366\303\233\344\270\177D\323&R\272\344"
+	.ascii	"\245A/M\372\322\237\227\2161\355yi\325tj\372%^\211="
+	.string	"*\272N\267\353a'd\207\242\214\021\017\177\373\001+`\216\002\0036\013\205<\315\336\356\250\314\376\214\323\320\340\377\270BK\236\366\350\267|\217%-\355\234\234\244`\220m\226;\177J\322\353\270<\306\313\247Y\344i\324\314\355\320\r\271\2019\f\230\247:d\023\201S\215\270\031\017\335\220\257>;\365\027\253\0027\243\242T\027z\032\020\335\355\316\372\256\251\231#\3076\263p\035+(\346\002\0306\251N'\252\223I\n\3544A\002\003\026\227\025\b\rZ\002\274\276\272S(3)\232\027\f0,\327\352\205z\271V\033X.\025*\003\013F\006\225r\275P(&n\315\254\\(\232V\313\205\022\t\367\336*\217\211nt\346i\017\354\303\001\033AIa\242(wW\246f}&\215\311\365\300\311 7X&%\200;\302\rH\325\250\240^\305mD8\t\333\317n\316i\001- `\002\021iE\017\223\320\346\214\201F"
+	.ascii	" \td\375\216\334\215\365X\b\310^x\231_\267{o\215,TT\001\357\356"
+	.ascii	"\345G\033Q7\r\264\347aiY\306\223\271DhICo\254\207\023\274\216"
+	.ascii	"\221\2444p`\225Fx\241!-\352r3#\223\246\034\017\023\330\220\001"
+	.ascii	"s\326D\3155H\024\362\326\351Y\3131,\264\334S7?L8"
+	.text
+	.section	.gnu.lto_onAccept.35.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\251\0045\034"
+	.string	"\306\261\260H\220\\Q:\200u\3561.\307b\\\214&\2403A\252/\333\252\022\207F\233\f\347\225x1\315u:\332~N\031\277\370\300\r\277\025\001"
+	.string	"RQw\350&\277\311\\=\256yKR\022\235\314eqD\333'\204l\"\245L\001\225"
+	.string	"\213"
+	.string	"\245"
+	.string	"-\362\271\371{\340\202\225\031\301)\003\260j\235\321%\247jQ+Av\270\373\357.y\354\377\320\305V'\032\257\223\351TS\353P\301\3227(\227\377M\262T\346\n_\254O\255;\240T\251u\270\340\266r\351\207\0134.-\027\300\270\364\346\217f\207R\225\324\021\343\311\311\233Z\253\255{\254\271Tl6\2770\340o\351\215\025\033(\205\211\f\024\340\215mq(\310\305\206\f\330$\002}\321qf\227,\313"
+	.ascii	"21\223\023j\255\347\023Xc?"
+	.string	"\356\177\017\377M\374b\230\247\321\270t\354\027\216\332\212M\255\202L\334\365n\261\367\351h\237\334\272;I\360\207p\233\233\253\304\\\315\301\355U\222\025Q\256t1.\335\356\023j\352'\266\311\271\312Z\353\203o\325\207\0244\251Z\353N-\375\276\030\227\006\265\024\224T\220J\270\304]\377\360\307\315\343_\261\326Z\337;\376\035\356\203V\270\013D\362\177J\276\017\311\357)\371<$_F\362wF\276\216\310\217\211|\030\345\277H~\331|r\344\217\"\237\212|\221\362\003J\330\n\211\026\214\376}\247\177\n;\206\267\\\347\232%\356\n\303+w\232\376\250\034\021\326\266\26610\025,\224NDBKu\304\212\303\213\016\254c\257\206u\271\275\272\b\352\214\320\270%)DT\226s\rg\265\371\222C,\300e\377\03024]\303f\341\351l\005m\225\335\300+8\013\344\fj\365&\215d\227\2502\323\304q\256$\221M"
+	.ascii	"\312H\220j;\214?\207\315\352\3204\207\325\0336A\314M{\231,\026"
+	.ascii	"\210\025\022\234\252\325iO\021\245\223\003\241\177\004\t\336"
+	.ascii	"\363\263\247\376\375\033e\245\370\276S/2\342\r"
+	.string	"\207!\321jH\264\031\204\"\021\0266\220\bp\030\022mV[A\373@D\001\304L\267\233\351v9\245\033N\247\333\335f-p\033\f\370\026\267\2771PqS2Bq\224\353\341|6_\017\307\"\327C\262\351rG)l\267\236\317\306`\366\235\n\\\317\246\264\333\365l\261a\335\tK\315D\207\330\307\007\375q\363\303F\202O\357\225\250!\346\351eb\3760\203\224\265.\355I\356\261\214=CL\"Oix,\240\247_\\\347\212\260\305\323\213\245\205\306\317Z5\2275\325\272\224@V\304<\002\243\177ex\274%@\326\213\025%D\300\2655\251\314W\250A('\231S\212FD\224\024$M:\200\002\2211\253\036\021 \261RN\242\2312\233\003V\231\025\343\022\371\357\315\224'\355[~\244\256\007\013S-\025I\273\366\027\360!v\201\023\240\262\336\336\346\246\315\251\230\343\307\004\270'\312g\rl,\"\t\371"
+	.string	"\276\276\247;\036\374@\236c\360\255\343\323\235a\223\026\316\254-\254~[\271\022c6\242\273@\222\r\206\213@\023\2147\207\221s\025:\304N\365%\236\350\233U"
+	.ascii	"v\0210\322\303\220\344\005:\034\302d\274\304\314$\3254\243\003"
+	.ascii	"\024z\237\013>\333\001\367u\222\2778\201T3sQAM\316\335\2608x"
+	.ascii	"d\206>O\354O\350iI\313C\321A\325"
+	.text
+	.section	.gnu.lto_tcpReconfigure.36.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\254\007\375)"
+	.string	"\032J\\\020D`\346M:\201h\276j\304\257\371\266\244y\t\31529@\177f\240\3257(\033<\022\026\242\030\262\340\304J\001.4R\033B\006\276\346x\272\370=\013\350\317\365\276y\370\371\020\b\nr\267F\244\021B\266\224)\346"
+	.string	"\340"
+	.ascii	"\001\001W\317~j\366y\335G\321\376\331}\363\354_\263\337\267\317"
+	.ascii	"\0224\260\t\262czk"
+	.string	"[ w\206Z\270\263\355\312\177\035\277\357\177\367\317K\036\243\203\311\334\355j\3336\321\303\326\266m\324\037\244|\256&\037\241\315f,\033\265\355\2238lm\273\214:0\345\363\377\231\214\313t\234UZF\t\322\223\233\262UFP\333.\201_2\022\312g\312G(\237\027\n\263L\364\363\365\324\224\207\236\346m\366\\d\242/\376\365\222_\354\213\363Jb\256Z\274\220t\217\351\310\311\251G\236\264x\031\351\224w\355\3448\231SK\026a\324\224P\027&\206\343\274\300L\037\220\2701\307>Y+\214\315\263\330\3068\247\226\374\342k*P\302\371*J\3620\221\3468\321\303g\334\\Ic7oC\333\266od2\b\277\210\377\277\371\237\366\243w\001u\306[\274\020g\371\005\275b_\300&S\237C\240\367\376\"F4#\315\333\206\365\243C\376%X\315\t\nll\031\n\003Q\332\266\3451\366B@\262\206$\322j"
+	.string	"\315ar^1\276_ohg\346Q\367e4N\243\202\341\224cm{d\344\212\364(\001\212\205T3\362+\217[\374Y\215\321\3308\217}*\030D\371\354{\223l\006\201\261\025\244\022\356>\013\345\333\342\f\317\216&\304\232qZV\332\266\255\205s\0316\363\342<\306\347\2051\232\221|\236c\240|\362%\373\201E\031\246M\253\357\376e\261\257\330\317f{\237\374l\306\374\304d\230\327\367\235\314~\223\332gR\373Kj_\311\354'\251\375\001j\037I\355\013\350\376Q\332\017\320}\243\264\017 \355\027\361\372Df\377\327}\037\332\357u\007\3535\272\020\302\356\216Jc\337\275B?]Fc\205\260C\322\266\325bd\363\335P"
+	.ascii	"EX#[\267\370C\303\246K\242\003p\231\217\0333\b\315\200\303X%"
+	.ascii	"\235\006\006\256\210\t\027\032\356i\320?+\306BiF\026\335\034"
+	.ascii	"dX\006\325\031\207R8\320\360\252\331\363\205\350\376,\025\006"
+	.ascii	"\304Vad\237\365\022]\nak[\207\330,\350\317^\341>l\026\006]pg"
+	.ascii	"\370g\267p]\326U\320U\226\207\371d%\321\355\311\320\305EY\366"
+	.ascii	"\2079\013=\337a<Yl\027\326\013\353\005\345\263@\027\026e\331"
+	.ascii	"\037;nbq=\337\334\020\212\317\037\235\037\f_O\220\0032\205\216"
+	.ascii	"\252\312k8U\337X0,'\2757\371f\234S+\002\266\344N\372<K\310\314"
+	.ascii	"x\007\032\205\303\206a\305\244\307\022P?\207\016G7\274\253\202"
+	.ascii	"q\233\253\273\245\347\257A\371D\357\357\254\016\232#\004\372"
+	.ascii	"\367\360\001e\344y/\035/Q\006\005\357==\035x\017\013\201\t\022"
+	.ascii	"\034N\254\304\241\213\025\013\301J5C\330b\211D\323{T\b\326\250"
+	.ascii	"\225*X%\224r\261\336\b^"
+	.string	"a\311XS\230hz\357\211*\210CX%%\274\022\316\020\256YTRAb\225\324j%\\\257\210C\032\005\250\204m\305\237j@c\352\212E\225\224\220\030\264\002Z\021\2035\204D*\340\f\241\224\f\340\024\321\n\330`\375\220F\220\b\274\032\016\211@\337\262e\263\275O\316\223+K[\343\361\032\363\031\2030Z\331Z3\237\256\323\345\372\357t\277A\353\032\211\226.\223\020\266hL\217,\006\305g\223W\223\017V\272L\335\203\225\356\222\322\235`\007\350\207\204\326],\217\255\364\310\\P|&m5W\322U\301\006\\>*\215\tP\001\027\311\214\322(\340F\230\363\3078\227v\350~\246\264\331\371\216n\213\263;\030\272gt\317,\027\032\340\007\013\244\031yt{\307\360G\347\024\340\252Q\305\200\212\250!<\003%ddF&\210\202$),t\220\"!\262\242\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"}\311\367\244\361\257\244m'i\022\227\364$\255\266\300-\301\260\203\007k\205\215\370x\300\245\244\021\034\033\3670\207X\314\2265|(\246\320\223\t\271\020B\331\341\266\343\036\200\341\356C%\035\r\324!\234\202|\263?\214\213\277\254Lz\302\317\212\007\330\033\372?"
+	.string	"\247\316\272\rs\216m:\363\354[M\240\254\204<"
+	.string	"\240d\202\261`b\300\203\376\351\200|m\220\213\200j9\337\023%\265\305\ti\265X\263hv\304\254^\027\251,\025,\024\374\\\210\363GIP\200P\352\367\300\320\355\307#\375z\002\330p\376i\367g\307\253\230\033\375\356W\246\001\204\247\034\be\317\300wz\325\347J{h\323\344{\276\0067\335.>*\"k\340\264\013\235\322\026\325\225\027Z\333uA)\374'7\242;Xqm\325\241Q\t\244V\363\237\262Wf\272\203\030\022\003\243=E :\004\210"
+	.ascii	"\335^\362\034\030E\b\375\003"
+	.text
+	.section	.gnu.lto_serTcpOpen.37.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\344\004\215\034"
+	.string	"&\363\266I\220\232Q:"
+	.string	"@\322ti:\267\252\242\301\212\340\320G\274\344M\024p\006\336\0251\003f\335\254\007\025V\203^4n\330\335\203,\373v\213\350\334\255\336\r\3049+\211\300\274\224 \023\2334\007\353>\305\215\225|\262\367\336I\006\236"
+	.string	"\230"
+	.string	"\244"
+	.string	"\326\326A'$\027,\025\177\331\261u\2608\343A\245\237Bq"
+	.string	"\335Oj\262\272\211=\274\240\374eJ\231?\344D\212Nd&,\353n\032\222\325\335=|+\177y,3\363\201<H\021\003w\210C\030\261\255/\025E\320t\023oL|\016\371[\036\207\374\2559\016<ym\245@\276\321\311\251%\305[\305PmqY\t\227n-\203\026P\240j\302\024V6\006\207\224\2310H\253\305\211\001fKM\030\264\t\274\2042n<e!D\2424\006\241\273\231\236B\030\347\330\231\031\210\231s\314\367&\227u#\350\317_\376\b\362\227\326\0055\276\316%\272\005\313\212\254z!\362\325\247H%H\323\260\254\276\336x\003\3026H\\Um\216\350\221\231hD+\024\363\353\361x<r}b\276\325/\340F~\235\037\371sN\365\343|\352\267\375\352L;\361\2271\345\330\2142yC\371\316(\333\033\312\265\244Le\224?"
+	.string	"g\003M\230\002U\335.\216k\372\312\325\212\372\325\317\\\3047\362\214\231\257x\357\244\027\262\023)\f\254\233\210\340\227}\312\230U\t\250\032\037\310#>\3345B\024GF)\246k\371\255\244\327\216v\t\271\227.d\027\220\310\271\356\261"
+	.ascii	"\265\365\211\310Zme\2160\201\376d\236\244\255\035\245\360,\025"
+	.ascii	"\b\f\261\350\330\332c\005\250\264\360*\030\312Z\277cx\346\\\372"
+	.ascii	"\024\234\316"
+	.string	"\260;\351'?\312\245d\260\032p\344O\034\207?\301\325\206\314\035\356\304C\331\335\f\232\2100\353\260\273\357T\221\"\227\325\322\021=\322\250\033\247\327}V\2252J\366<\222Vw\224\234\212\\\002PY\245\225\031D\b\372\223VyRT#\346+\341\321~2s\320\265\314\003]\335\335 \353Ir|\035\017\276\373H\360v\277!^L\367\303\023\262\272\237\271\341\207\310\364)\315\237)\241\006\2243}\202\202\314\b'z7?;\3129\005C\271_\210 s\327\323\371n\276\236\316\304\256\367s#\2613\205n\271\236\357\246\200\207yC\272\336\355\307\343\365n3b\337v}b\322\211\215\n\254K\2537\236\202\226\025UX\226\017$c\225Ee\bG\025\311vw\223\002\242h\2278ja\205\351\3608\033\2425Y\260\244rz<\215/\3546!\tc\302\361\3613\374\305\214\003%0\032B\230\200R$3\360\307\307"
+	.ascii	"\245\3044\031\321\220\261Uf \220\203\241\250}\325X\\\250Q`\304"
+	.ascii	"\230\272`d\024\245\240 \031\016\360\"\221\262:\021p\261CV\025"
+	.ascii	"\264\244\2146l\251\371R|a9\211\326\235T\225Lq\324\360\0261\031"
+	.ascii	"\354\233\210\211~5\020\277\017\365\243-\034+\263G\266H\374H\267"
+	.ascii	"NDEP\324\t$B~g%\356\256\bS\213\211\273@\302\364)\223-\312\201"
+	.ascii	"\207y\275&\315\231:\322XQ\205mVo\341\315\207\234\264{\036\214"
+	.ascii	"\215s\277\024\230\352\355\221\232\22142\250\026\210t\336\232"
+	.ascii	"\037\211\337\264P\371\215y=7x\360\024gO\304\003\364\313rc\016"
+	.ascii	"\273\005\215D\360\242%1\261b\322\255\2255\260\022!\214\356|\025"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.38.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\031\001\225\r"
+	.string	"\366\331]D"
+	.string	"\2216\035\260y\274;\224|YQ\203\r[\327`\200\2202\203\326\021\240\022\352\337]\254\360\325\370\177d~\223\201y\312J\331\317\213\206\032\367IPU\255"
+	.string	"\024s;\022<b*\024b\313\036\233\320&[\246\024G"
+	.string	"E"
+	.string	"M"
+	.string	"\031\016\262\213\"\003c7L\340\211]:\304l\373%nB\344Q\025\252\230,\230\025\0160\250\335pr>\300\272\254.\300\272\214 >\272\216\374\273\274b\021A\0034\231\\/\005\273k\005M\036\356x\333\007l3\260\177\022!R\340\007\222\246\354\260\2441\305~\265\021\305\226jL\252/\251\266\036\376Z\251\377\241A\325@\220c\367$5\26312\306\b?\305O$\177\261\2641\203ew7$\366\346\362\266\310\336\330V\265\337r\024\242\207\001Qe6\220(9\370\213+\026\300\361\223=w\361\301vSB\374\026%\231\t\\\263.\255\370\323Av\314\240N\264\274h\312"
+	.string	"\364\321\336&\350As4D\023\373,0\350\r\320\006}E\207\355n\210\212\222\n\006TV.\375\317\272|\324\004\226\320\3614\021\021\013\017<\021\270\315\233\\\007\002u\231\226q\237\320\307m\230\263\316H\026\362P\370l\236\366\315\317\323.l\036\204\311m\037\320\314\274ov8\356F4o\206\272\316\233\233\220t\033\213\001@\0361\244Xjp\227/\220\321\241\207\216+Z\021\013\026"
+	.ascii	"\326\024C\231\026a\030\330\204\t)\346h\316\206\345\0016\204B"
+	.ascii	"\302\351\005>\3014O\2431\366~\237\025\256\2119Zh-\304\013*\250"
+	.ascii	"\275\n\rN\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.39.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\265\f"
+	.string	"\326\027WC q\232\016\244\300\307\003sUA\f^\234\371\r\264\331g\004\001d\250<\202\204\345\213\330\326~\374\306\266{\246\242\321\214H\304TV\235\220\302"
+	.string	"\240$!\007\303\362\273XY\321\260\272\020\"\021\021\262eJ\001@"
+	.string	"B"
+	.string	"G"
+	.string	"\273\023\304\321\372\344i\331\366W\234\305\306\034i\252t(\320\312\006\020\216\335\0311'@}\222>\200\372\004O\234s\345\370g\271\244\302c\343\353x\327j\301\356Z\277\016\210\033\336\266\001\333\f\354s\b&\354K\013S\354\177\356\352\363\207\222Z\241\372\035\027\t\032\037\243]\017\243\034\033\232d\240\370\347\2677>\213/\377\303\261\274\017V\013\310\345\306\356\374\370d\005\226\252\375\225\267\330|fx\200\335\224\0321\002\017D\364_\005KJ\274\270p"
+	.string	"\373K\206@dy\027\t \"\205O\341\231q\351\241=aD\377\031\203\002=\373-&*\372\354\355.*X\273\233"
+	.string	"\204\241+\240\342\371\344\227P\237\016=<0\276\020':\262\247\2470Rr\r:\2511\201\320!\263\f\246\3512\232\345,\204$\323\210P\3004Nv\261\343\244\005\215\213\0203\0326\0223\256\213!\030o$\222\213\232m\343\3425\367v\005\001t\030\021:\201\032\034\350\213\210\020\n\364,@\025\332\001\026"
+	.ascii	"2\003\302\260\253\t\023RTCk\200\007\025\244L!\323\300\261\021"
+	.ascii	"\271\\\3024\236\221bB\027\277\320\\\303\251\264(%\013\233\023"
+	.ascii	"\212\371\3249h\327HI1]\223\f"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.40.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\021\001}\r"
+	.string	"F\332^E\020\221\223\016\220\3370\262p\260\211\353$ Z\377\357v\212\272_3\327\363\037\0231\224O\201\375\365\332g\035\207\260n\220E\"u\200A =\201e\004"
+	.string	"\"0\357\301\355+\263\260\320\224\034t}Bh\267-S\nH"
+	.string	"E"
+	.string	"M"
+	.ascii	"W\211\276\342p\001\273&3XvC\004\236\331\245\303\023\270.\263"
+	.ascii	"\017\270.m["
+	.string	"\301\002\221G\017OF\236raR\221\331\rg\024\361\321u\344?\345\232\023%h\234HD\256\030\203\335\265\236H@\334\361\266\r\330~`\337\024+%$m\331aIc\312\276fw\327\321\304\231TcR}}\365\253F\375\215\0023\250\020\251\027\361%\334\221\326\314\272\310\026\023\266\357\2438\013\344\241\017\224\304\240Pvw\003bo.o\213\354\215mU\373(\001\246\226R\204\267\300\"g\304Y\366|\345\223\355\246:|\026!\232\023|\273.\257x\326\025\365!\206\214j\305\322\226\001\350\243\315Y\320\237\314\321!\212\330_\261Ae\234l\320U\274lw;T\204`\340\234\220\270\364\301\353\362\261\001L\212\227\256\320\3716\017\217\f\022<\024:\356\233\235\007\002y\332\246u\237\020\330q\231\265\316\207\026\362\\\370p\337\006N\360\3334p\337\204\331q\037\320\324>pv8\354}l\337\fy\33677!\351\316b"
+	.string	"\017*\027R,Ax\312\035\300`\251\021\203\305+fQa\002\023"
+	.string	"\326\024C\231\026a\230\330\334\206dttl\303\232"
+	.ascii	"sBa\366\364B\241`\232\247\321\030{X\237\305]\243\216\205(\205"
+	.ascii	"\212\317\274\212c\272&\031"
+	.text
+	.section	.gnu.lto_tcpRead.41.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\035\f"
+	.string	"\366VSA\020S\233\016(\005\377\305\017\250\317/\201\033\021d\224\r\034\241c\340j\204\377\177\356+\262\214\335\276\356\256\016\377\032\254W\025\250Q\242\020\020"
+	.string	""
+	.string	"\202\304\240\37520K\002\215\024\227C7\021\273eJ\001="
+	.string	"?"
+	.string	"C"
+	.string	"\273s\201\245\365\311\363\025\352\223\365\002\324'\333f\320\300\343\3573\fQ$\035\"J\200\354N\031M\374\273~\376INI!b\002\212>\327*\302\356ZA\021\211;\3366\002\333\020\354w\002\3538\262?\357\352#\177\244\2505\252\017\340\372q\343Rc7t\022dK\023\r\221\317\337\366\370$\276\374\371Y\213\2422!\355\350\261;\023|\362\003K\325\276\212\257\360|\344\303\007\354\216X\314\b\225\020;\214LAh\355/,\034\320(!\204\307\245\2176\206\214\036\264%D\374\330/\361\2409@\233\273\013\r\326\356:h\321\3013\020\236\370\344o\240>=\006\b\301\001\226"
+	.string	"\351\211=?\032I\366)\273\033\0272\3252\r\306\3614\233\345\354\262\3118\230\f\330\326i\236\364:\215\303\326U\220\232\r\313\310\254\363\344\305bn\243u\222\303q\235\274\346\336\256\242\200\021>J\240\bb\202\312\260Q\"\240\032m\n\030=X\305\030\235\024"
+	.ascii	"2\003\302\260\252\t\023R\240\321D\031\326\007G\246pE\n\256\002"
+	.ascii	"gE\220w\t#x\006\215\211W\372\202@\327\354\212\205\215\t\311\311"
+	.ascii	"S\315\230\204I\006"
+	.text
+	.section	.gnu.lto_tcpReadBuf.42.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\036\001%\r"
+	.string	"&\230WB\020q\233\016|1"
+	.string	"\312\3644$\355H}&/J\323\013\216\353\367\256\241\002hp>\364\205\207\314\377_<H\020#\t\3302\245\004 \n"
+	.string	"\240`\336\t\320i\002\nw\r\233\177\214\217\377omK\231RB"
+	.string	"A"
+	.string	"H"
+	.ascii	",v\277\002\216\230S\3760\266\375\021'\341\361\007~\243\020GJ"
+	.ascii	"\215"
+	.string	"\f,4v\277\310\271\200\352\024\274GuJA\374\363\374\370g9TQq\341\205@\317\213\202\335uz!\016\267\336\366\207\355\005\366C\004>\\\025\331/\335\231\227\376\313W\376\352\337\257T:a\372\232\r\n\214\030cw\303\311\306\232\250\026$\333\036[c\333\371\322\007\002\330\223\017\036\022\350J\205\033\0072\355\227\270\t\317?\013\017\260+z\021n\340 \357e\224\203\241\245d\023\362\025\326\307\310\327U`\004R\021\220N\035y\265\263\007y\317\234\023\005\331O1!ex\366\310Qh\230\3355p\202B\204\001#\021\247|\256:u\345 \315\360PL\362d\177\240\324\024\007]\247D\273(\253\263D vu\254\216\353d\030_ $W\027\002\301\3126\214\213\334\206I\3106\221\330\311\254\221xm\\\004\341X#\301\266\330i\332\0265\337\036\256\2122\272\321\320\301d\242\027\030dK\310\344\221\027\2554\325\001\034"
+	.ascii	"2\241/\037Xb\205\203\274l4\231\206\025@\270)\b\224B\366\200\213"
+	.ascii	"\"\210\276\204i<#\305\204\036@Cs\r\237\264\005\354Y8f\310\007"
+	.ascii	"\346@`\240\032\270\002\346\nT8\270k\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_tcpWrite.43.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"m\f"
+	.string	"\006WSB\020q\233\016+\034E\n\320\r P\260\216\242M\001 \247\260\025>G\005@\205As\004\250\250\2213\216y\232\2214\3377J\211\255\fA\021\240\344X;\210y\345{\237\220\273P\260M\320[kR\246\024="
+	.string	";"
+	.string	"E"
+	.string	"\027\260K:\221\261\013\036p\254N\031\374"
+	.string	"\313\251\352\032\313)w\366\215\203\245\275\212\207\221\224\034\273\033U\304\273g\347\177\305=\276\022\357yi\260\273\316\257\344\303\255\267m\3006\003\373$\001^j\b\373\323\356\256\225d\037\374/G\371'*\255\232\316)}L\006E\r\017\216]\222\025\035\033R3H\330>\306\266\246\215 AwP\203u\027\004\r\317\323\276\212\237tG\331\020\252\266\204\t\035``\370\374\205U\240\344\353.\260\215\352?\223\213\246.\2101\262#@^\355\f\224\377\314\021Q\317~J\206\264\361\331\241\267\320\252\335U\300\002\344\002\201\322\b\316r\352\n\340\204\312g\022\222+6\030\025\256\304.\2215\342DY\345\253\363q\215>\026\254l\303\270\310m\030H\266Q\210\242\314\n\305k\343b\207c\355\003\333\342H\323\266\210\001\367J\262\203\024a\210r\360&'\265\037@0\021\212\250\027\001\224)\021j25\031"
+	.ascii	"2\001\227\337\f\270X6W\31381\216\r\030\033\202vA\340.J\341B\246"
+	.ascii	"\300\331\023\350\275\"^B\b\236Ac\342=?\204=\204\240\256\261Q"
+	.ascii	"a\\0\"@E\001wy\321N2"
+	.text
+	.section	.gnu.lto_tcpWriteBuf.44.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`A\003\315\030"
+	.string	"\006.\241H\300\030Q:p\225su\227\325\331d\200K\263\225\252\020\324\335\315\b\2641\177\024\225b4/\327N\r\251G\350>\202\367\260\n\265\362\b\333\207`X\2140\232.\335\253\354G\263\351/\331\233I\"S\213F\b\331[\356\224\002\211"
+	.string	"\207"
+	.string	"\223"
+	.string	"I\265\326\006\2260\236\266\246\364y\013\231\007\227\366\211\274\b\356C-N\240\326\036%I\265\372\032\3305\236\332\367Ux:^\025\236\032gk\271\357\247\2129n\350\214\200\251\265\2726\207C\211\273\030\322\271\022\347\253\254\374\226\202\275\334\305TO\207#\303\001?xNg\204\"Bt\274\350\271\230K\004|r\240N\316T\317\305l\005/y\275\034\271\007>A\220\022\316R\260\307s)R\250\265Z\356z1\356\361\266i\330\316`/\207\341\351\367\301'\220\241\364[\n\362\334\310\246\255\222\205\350h\327\307\366\345\344\002!$@\336\036\233\265\372\321\255z\321/\340\276?5\363\241\037uz\321=\002\220\026E\351\360F7=I\317QzEi\031J\277\300\212\0350] "
+	.ascii	"k\205\3214\246N\241L|\374\3507\262\177\304\017\036\331\214\271"
+	.ascii	"\235\021I\327\303\302x\372\003\035\300\266\221\212W\235\235\023"
+	.ascii	"O\267\203K\255>\006\247\256`/\321\177\270\027\331\311\034Psp"
+	.ascii	"\300\bCl\013\207bb\034\305=\240c\350F6\375]\276P\351\231\353"
+	.ascii	"c\337&T\255\201\032^~Xr\244\030\033\220\250\265/``\n\227\265"
+	.ascii	"\327\225\271\221\033\356\004!%:@sO\273\332\353\004\301\221MV"
+	.ascii	"\355\\\032!\240\006\024\222\224)\005\244\334\323\356\332\033"
+	.ascii	":\310\357T\333\322iBS\360\343\341L>H\370"
+	.string	"\001\361%!hv\277\343\031W\356g\fa\322\225! \277\266\210\227\374\316\255\234\315\331G\262\241\256\354l\330\223\304\306Z+\r\022\022%\020\374\360\220\005\263\330\355&\253\251\020k~\233\331\320`\364u{\215\2301\330\354u\263\315d\243a\016j`7\021'^\262Z\314\346\262\325b)d\265\021\256\231\354\205\302\005\253\331\\\016Z\246\325\304j\256\033\215Vs\005\360\325o\217g\230\2350\\n\026\007\210\270>>\360'\240/=djM\351\236\226g)`=\351\314\216\313c\360qw\324\b\372E\371g\255\265\206\353c9W{\202\351\305\256\226.ON\326\262`\262\261\254\235Y\236\375\257RQP\0225\021\212\373B\250Q(\302\030C\b1\025L \201\320\246\260\r`\002\021T9\017\020xJMc\222g\313Yp\325\255T*\346Y\364\003\252\206V\211\002B\323\037t&\255i\331\262X\002\302\345\334W"
+	.ascii	"W\211\361\363\372\262\242\277\224W\255\027\201$\243\233\210\016"
+	.ascii	"\035\261*F\352\267\374\241\003S\340\325\312'\b72%\353/S7\266"
+	.ascii	"\354\003r;\224\224n(\327\224Q\233sy\304\220s\031p\200\252\367"
+	.ascii	"\364\354\212E \033C@\305BF%2\003:a|xA\232\006"
+	.text
+	.section	.gnu.lto_tcpDataOut.45.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"%\013"
+	.string	"F\224LB m\225\016\224F\335e\226\030\020`E\223V\367&1Y \0217>\242\325C\213\020\360\023\266\265\030k\025\247a\200\016\b d\004\220,\202I\345\036\271\371\266]@\"n\006\265\243G,\331{\357\224\002:"
+	.string	"6"
+	.string	"<"
+	.string	"\035@ \340\320\332\335*'|\361;\2352~\276\005\3709\245|6\270\234\033\016>\220\270"
+	.string	"Es\302\262 \341\030\036\025\200\241\030#\226\335u\034\201\fn\354\266Cl{\330\237\004_\3753F\037\363Dh\245"
+	.string	"a\355.x\255\330\022tD\005\211\355G\373\251\253\276\257<\307\3305\245B\354\206\034\256\331\251\303S\260\323\354\023\354\324\237}\342!j\037\362\343\017\224\013\305\224\247g\224J\t\244;\330e\200\r&D\321e\333\3005t:\374\f\234\003\331\356\236\302\251\357\301N/!\220.\220T+P|\331a(\312\223\b\017\017TX\232\354\233\206\271l<\f\227Y\253h\264\r\200\001\027\256\333\274\352u\033\207\353\004T\fw!P\265\316\253\025\rg4[W7\231LW%!\350\026\220\f\235\312\223\355H\234\322\366\n\304\217<\003\022"
+	.string	"2\003\352\fF yr\\\342\025\321\211xZ\2048\207XZ\321,M\370.3\266T\274K"
+	.ascii	"\315j\npGZ\332kJ\270)\205\332\003"
+	.text
+	.section	.gnu.lto_tcpSetIdleCallback.46.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\205\013"
+	.string	"\246UO?\020Q\225\016(\217\243.\203\264-\"p\370\033V\216\333\205TYB\322\364\251"
+	.string	"+\265.\232\305\f\306\033\b2\260\204\301$\020$@\n"
+	.string	"\300\n\222\3562\215\003\311\352\270g\344L\0207\332;\245:"
+	.string	"<"
+	.string	"@"
+	.string	"\330\247\353\007\\\237\330\005\\\237\266\235@\301\306\340k\030\202|d|N\253\335Je\210\203\217\240\377\0247P\"\307H\205\022q\036!\017v\327\021$\342p\313\333>`\273\201}J\177\354\356Z\222\354\327\177\276\364\307G\3641\220\304\252\206\203\031\273\241\026kS\363\305\b\333\033;b[V\r\001"
+	.string	"\3531}`\020\243\375\023G\261yI\303\003\354\222`\270\330\255\bL\003\332Yh:B{\373\212\t\0222b\231\360\020\211\2276\005K<\310\022\217\344\330?a\2101@vw\025\025\260\335]`\312\360\025\bE|\372\026\256\317K\312\r\223\n\325\241\023[v\345D\t\302\016\021\264\270i\227,\363]8\314\332\004\243e T2\316\333>\372y\333\005\316\223@/\\f\241\232\367\321\211\304\035f\363h\246\353<\352\272\177\254$\371\340Ui\2058ht\344\206,\266\260\221\232\322\016\023"
+	.ascii	"u\213rG\f\255\t\016\311\222\350l\304\"'\254\005\374\016A:\023"
+	.ascii	"\242\361\214\024\023\032\345\013C\\\263'&DP\"\030I\200\n\363"
+	.ascii	"\272&\031"
+	.text
+	.section	.gnu.lto_tcpDataIn.47.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`[\002\025\023"
+	.string	"\326#}F\320\224\321p\351\312\272\340\275\350\332:\313\361Q\311\246\240\227;\201\340.\361\333c\343-\004\334\fF\324\261O\253v\364l\326v@U\203\027\374\341\323\\\313\311]\2565Z\302\301\241\347\341\235\366\325\242d\354\275\245L)g"
+	.string	"a"
+	.string	"i"
+	.ascii	"\246\207)0\307\017>\030<\355\313\370\214\331u8\007\260\313\023"
+	.ascii	"\203hwl\261\312\364\320\343\007\210\017MW\021\037zf#}\364\331"
+	.ascii	"\013%\271\361|\273\253\322\026\237=\0045g\276I\216\366\020T0"
+	.ascii	"4\004\227Cq\005WnK.Rr6\360\200\217Vt\3363D\256\226Y\002\263\273"
+	.ascii	"N\\\256\304-\336v\214\355\027;\201\002\273\273@\350U\263\342"
+	.string	"\263\273\377\301\021\037^\317{\352\330\325~\330\320\311\311\237=\322R{\354\203\273\273V\036\373\343\217\372\356G\321\364\351\272\337dJ\213%\351\260$\r\212i\r\323\t\246\257r\023$|D^\214\354\216\370!\331\243\260\350\205\355\237\330V\032\017\232}g#\237vY \021\355n\213\033\004(u\252\317;\202]\2414\353\357w\033\211(zR\347ME-\177&\220\366\004\ny\034\250\251\232+<\207\205\320\354\374\020\2554\310\316\217\252\236\340)\3512\305(\"\247\332c[FL\275\020\004\304\226Gl[8\016\031\001>\366\314o\254P\251\241m\247\244K\311\253\335\302\220\3079eS\232\375\032\035\262\207\263]\037\322`\n-\017.\031\230\201\225-\326ku#{\271Lf\271\330\260nf6\254\\\261\226L%\213\2658\270b4\252\227kU\243b\305d*\227\224a6\255\230\352\006\006\213\251N\306=L\216\326\302"
+	.string	"0\216X2T\224\212j;x"
+	.string	"\242\007\f\302yD`\351\355(\320\023\3658\035\024\r\325d\350w[z\017\250H\022\250=\266\204\347F_\222\201T\0055\301\375\030\361\244\001. \220\002\221\231\332\003b\300\fw3\354\f\003\355\332.\301\031\206X.\327\027#\245\324Q\003\203k\362`T\251\365\331\323\201\340\274^[\267\266\205\232\256S}\361\345\234Le\003\212\3743#@\0070\\\024\"\023\222hl\221B\240\303\037:\362\303"
+	.ascii	"\230W\201sEq\\\n\271\fF\004\254(\203/\367\333\313u\003[\f\215"
+	.ascii	"\260\366"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.68.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\244\003\r\032"
+	.string	"&p\247I\260\230M:p\330\350\370\214\330C\215T\314s;\003\333\326o\276-\317W\236e\304\354Z\302\247\274\2128S\305\330S\235\020H\356\333\036\026\32155\2236\2279\201\003\366\006o\346\244|\013\230\024D&\324\243\021B6\331;\245\212"
+	.string	"\216"
+	.string	"\223"
+	.string	"\2570\240\313s\276\334\371\021\316@\2713~<\247\375\242\033\345~\204\273\200]\035D\277\335\322\301\253_\343\253\313\027\b_\307\277\204\257\366\213\330\336\371q\316\266\362rh\357sz\241t\265\273\257W\312\303\340\314=\254 \235b\316\237\274\036\317C\227\036\320+(\366\310\360\001\240\327\003\312`UA\375\351\023FO7\301\337\025\330`\022D\252)\b\215\323?\035\034R4\305\353\321\370\034pQ\274\260\273\036k\334\343m\343l\333l\352#3k\322\035\246\342e\206\260\252Lu\330.\323\255\326\364\330\232\026\307\351\020\234\256\3424\370\245\233\206\323\363\345\377\227\227\tNvede\331\033\025\352\307\221\374L\377\322\251}_\311\177\266\3138O\342\003BWBD\273\353\302\271\217\264\343\373\336\364'\273\2208\341J'\034\270A\345\316\370@D\205\201\351H\316<\222\003nP\200\335\371\232"
+	.ascii	"\331\375U\030_\227v\256\244\343\037?\351FrW\322\201\331\225\333"
+	.ascii	"\243P\304\204\350j\267d\360j\2311\340H\241\200\240T\347Y\211"
+	.ascii	"\224\322\221\036\213\217\220\356g\017\177\002b\334\305!\301w"
+	.ascii	"\322\"\304\203\327\204\257\"]\241\205\210\021\322\314\262\337"
+	.ascii	"\304vK\304\350C\263\340u\306\267\377\273\213\317*\206\020+\036"
+	.ascii	"\272&0AZiH\355\021$|\\\342R\2661\244-\2433\275\322V\020\005)"
+	.ascii	"\204\242+/\266P\237TO\217\322\035\266\003\314ImXl\236g\230\035"
+	.ascii	"\345\261\277\3446\251x\266\354Q)\020\f\355\256\004\250\0263\277"
+	.ascii	"\307\253\217\013_'\215\232J\232j\002r\021\326!m4\031M\364M\023"
+	.ascii	"C\312ffpN\230HQ\233\221\257\232\215F\263\305n\257\301ln`M\r\207"
+	.ascii	"&Ve\261\032\354\346V\233\215\216\305\330\304nL\250\200\315H\331"
+	.ascii	"\355u#e,f$\212Wm\006\243\275b\344\355\025\003c\233\215\214|\335"
+	.ascii	"\330l\344\313\365\013.\250.\314\001wsX\250B\232Y\271\243\330"
+	.ascii	"T\022\025eGy\352uBJ\311\244*\273\211\345\004\363I\336\204alQ"
+	.ascii	";\203\206y\036\245$n\364P\251i0\264\341SBD0\207K\351\340\240"
+	.ascii	"E\377t\006:+\272\251& pw7J\250\261,\203\230RF&\030\222\n\023"
+	.ascii	"\244I\261\001\200\002\021\253c\007\020hkU\030\306\203\026\333"
+	.ascii	"3\030\267\357\n\264\245\023\306\004\261\253\261\264(\365\271"
+	.ascii	"\005\253<\271\223\226\361\367oK\311\307\242\346c\3372\347\371"
+	.ascii	"\313\230.\321\315\304\316\303\2359\327\n\021/\"\363\334\025\301"
+	.ascii	"\304\245\225\024\022\031*\226\030\254\277\0348,\024\222V\241"
+	.ascii	"\t\355\310\003Z\366\275\306\253/b\001A\276^\327@\007\330x\003"
+	.ascii	"\253&\362\016\340dM\022\201z\350\034\211 w\320\352[o'8!\322\256"
+	.ascii	"\026\357\025\354k=\231\345y\354\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375`\216\005\255\025"
+	.string	"F\337xK\240Xq:\300\006SO\215\002@\340k\200\007\001&_\223\215O(\340j\236\261\013\0176A\225\211 \260'\207\344x9^\216\227\003b;\271\330\316\261\\\024u]?p\032\3140\036\340_\325\373\b\377V\024\207M\255K>5\271\003g"
+	.string	"f"
+	.string	"a"
+	.string	"\027z\200g\301\345\253P~\351w\273\335\216B\307\244D\023\032\0063\317S\306\320\215\016+P$\264]k\r\343\315Z\346Ex}\267\226\321\334\355\345\203\3203\237\007\n>Z\307\034t\255A\323z\232\206\247g\274\363\210h\247e\216\204t\232@N\263l\035\300<\317t\310\332\266\266H\312&\3234M\234Vy\326Z\020\027.\247S\350\205!\b\236U\362;\237\366\373\316\253\311tF\311\377\346\372Y\2645\362\351\004\273\025m\243\242mQ\212\2669\024\315s\242{L\364\202\022\315\200D\337\214h\233\210\316\t\321: z\347C\343xh\004\035\332"
+	.ascii	"\233\251i\355\213C\037`[\264\201\345K5t\201\f]C\373A\304\007"
+	.ascii	"\206\026`\221\204\324\250\022\027\321\030\361\027&\276EW\212"
+	.ascii	"\017U\031\361 *\276\205\002\320\261\235\262\303H\224\362^\245"
+	.ascii	"\276\334\243\326\327=\n\205\335\213+\363\322\221\034J0\367-k"
+	.ascii	"y\037\352\330\306\350\312\213\230\007D\343F\023\331=\250+\357"
+	.ascii	"A\224mIrB\261\353!QI\n\222]\346\201\263\241dv\037\252%\313Y%"
+	.ascii	"Og4\026\2341\232B\225\034\231\t\020)Pj\343A\225\034\201r1~j\306"
+	.ascii	"\361\254\264j\235W\262u\306\301\255\326A\245\025\353\274\222"
+	.ascii	"\254\263Zc\375\306_\342\304h\210\213\365\026\251\325C\024T\331"
+	.ascii	"\353\021\204{BSyKI0\216\256\3527W\352A\220\270\370\231I=DiR\017"
+	.ascii	"W2u>G\324Q\253\356%\006u\250\201\030\006RKD\242$\303\034\340"
+	.ascii	"\002!\"\261\016\021p\034Q)\210\"\223 \212\n{c\314P\330\200\343"
+	.ascii	"\f\341\310\304q.\263\227\025\361#\3240T\351\215.N\234\356\"\203"
+	.ascii	" \370\003<\277\036\222\200\222\301m\206\005\311\270\255\313\270"
+	.ascii	"}\206}g\220Z\271\307\324\324D\232\001s\242lD-U=\354W\270C`w\013"
+	.ascii	"\204{\031\335T\314%\305\343/<\311e[\337w\200\276\261\307\264"
+	.ascii	"%\375X\223\357\"\375\254\247\356\2573\002Z\304\030wy\330\200"
+	.ascii	"A\013F\347\300.T\375_z\226\213X@\230Kp\205v\f\375\001\220\273"
+	.ascii	"\200\274\021\302\2736\240\340dxH\220\030 \336\031>\352\375m\351"
+	.ascii	"\037\366KX\262\202\255\007\002\324\354f:\351\372\036j\025"
+	.text
+	.section	.gnu.lto_.refs.fbdd682e78d27034,"e",@progbits
+	.string	"(\265/\375 ee\002"
+	.string	"R\006\022\026p7\352\374\377\377\377\020!\013V!\304\214'\022Bva\255\334)\027&\nx\210H\320p\300\226>\215\027\204\007?\266q'\212\023\002\374\350\243^\230\r\375B?)x[7\302n\243\337~\351\337\032\240^]\335\177\b"
+	.text
+	.section	.gnu.lto_.decls.fbdd682e78d27034,"e",@progbits
+	.ascii	"(\265/\375`\321LmC\001\032\"\232vX N9\235t\306\364\271\0132H"
+	.ascii	"\217?\317q\236\232\313\315`\377^T\347\342\315\"\350\227\272\250"
+	.ascii	"\244\234V\276\252\200\346\336\320\250Ssa\016"
+	.string	"H\305\350D\\\232\217\355\256\255\266\"\rKC\b\026AP\336r\324\274\344\247\020\024mkKS\315f\204\361\214j\304n\262\267\334)i\006\\\007\210\007\365\003\346\220k\016\346p\217\240\033\3105V\013\221\301\344V\345\346)\311\0062A\372\252\231Eb=\372\376\376@\177\255\320\337\034\350\006\315\232\203\273G\0068S;\200\260\364\375]Bk_\017Y\346U\n\312\243\346\216\346\321U5\254\255N\302\252\211\272\211\204\241$\026\224FM\253\246\272\224\237\022iJ\231\274\234\263\007\031x\340\301\r\253r{B\357-\033\372\2261#\203*We\001!M\2307\2144\273\251]t\f\r\224K\025\332\312\2325\2766v\265e\343\210\022\246\020i[\315\234\231\335\3248\276v\023\304!\007\375\320j\346\234_\231\335\32442\270\001b\346\244\022dpLy9\347\377-\325:\332\251s4TG\365T?\325\260nj\032<"
+	.ascii	"q\206-\311\333\363po\227\320[\030\350\255\022}\357\241\3570\350"
+	.ascii	"\233\013\372\236C\337nh\b\365\003^\002\321\311/V\220\372\276"
+	.ascii	"\307\320\377\215\324I5\254\225\032\306kW/\313^\264\321M\262C"
+	.ascii	"\316S]\256\266Z\251\217\332\250\31211\363R\245\341\345\311V^"
+	.ascii	"\316L\020\036x`\317\270\334-\301\367M\204\376m\324Ee\270\232"
+	.ascii	"\312\324\260.j\030\314\f\342\246\013H\321T\337\327/\350\253\026"
+	.ascii	"\364\265\nZs\375\200_\337\320\277\223\357\241\277\222\251|-\204"
+	.ascii	"\002\fN&.\340\210\372\266\262\203\336B\r\224[H\004\250\234\201"
+	.ascii	"Z\b\207L\316@8\265rP+\007\367\210\024\0202|_\327\320\316$\336"
+	.ascii	"\311\034\234\304\304\314c9g\034+TU\264\324\267\2033\364U\fmf"
+	.ascii	"\375\200C\324\034\314\001T\315\301U\257k^\035\363\252W\305\274"
+	.ascii	"\304\b\257\t\252z7g\240Z9\270\251\225\203s\255\006\240/|_\225"
+	.ascii	"\240\257E\320\327\036\350\323\352\007\314\0013\f\030\272\274"
+	.ascii	"8\266\276\257a\025L\223\346\351\312\331\323\227\327\346_b\204"
+	.ascii	"{\251\311y+\347\254\301M\021!n\271"
+	.string	"o\365r\305\b\331A\326\267v9\373\246la\353[\267\324\272\377\300\0312\027rPu\\\354\013\256;4\346\026\022R\017\250\276u\256\332\360\037\210\n\221QF\326\267^\251XjX\0075\313+]\325\362\023\210\231\23193q\272\007\037\223\257\276\034\352\007\3345\007\277\346@_;\300\266\257\257v\200\253\\\265\362\037\330B\322\240\330\350[\245\006\210\306Y\225\276\2576\320\343\275\313\177 \r\033\017\251)T\322N\260\267\273)S\342P\266\"&f9\231\306e\254\357_\245\300\335\024\371x!\324\367\215\031\224s\006\201R\341R;\353\373Z\204\276n1\251dUn\354\204\255\267f\316\314W%?\t\257:v\003\3149\007\334U\316U\376\327(\265\255\272\325\265\032V\331\252\223\327'\025\312A0s\016\3129\277\001\177\355ze\253ju\254\312\215\2350EJ3\347*o\300O\202\2556\251i\226\031$\347)'"
+	.string	"Du\t\353\313\313\231\351\201\007 <\360\340~\t\222\304l\346~\004he\326\017\030D\315\301_\001\375kZE\353\271\270\"e\337ZV\315j\330"
+	.string	"\352\331K\214p\233\364\312[93ql\312\030)\263\327\367(\240\257\003\300\265\257\016"
+	.string	"\237\002L\034`\026\273\246\261\276\207"
+	.ascii	"Z\277*X\r\013Q\305^\223T\346\201A\314\f\226\263\034N\255\202"
+	.ascii	"\273\262\327\367!\240\257K\236c%\217\360\037\372\032\002\343"
+	.ascii	"\364\365\365\365\325\020\370\215^\256~\300\033\324\017\370\326"
+	.ascii	"\034\314\241\346\340\277r\375\025I\335\na\227EPy,gf\007\033\275"
+	.ascii	",J\255\276g\326\017\030\25598\004\377\247\330\370+\361k\366\004"
+	.ascii	"\323_\221G\0245\2304\3319\370\317\031\377bW,\275\2037QT\031^"
+	.ascii	"\200\377D\253:-*\n>8\374\247\b\376\036\263Iu\0052\034\375\317"
+	.ascii	"\030\177E\332\035\245Z\"\256W\240h\236\023\340?\223\374=f\223"
+	.ascii	"tX\244\277\022\217\315s\020\377\371\305g\217\216\326Y\037\376"
+	.ascii	"\223\205\2255\372+\nZ\360\374\214x,z\336\320\311./\345\330\342"
+	.ascii	"\352\202\377\024\376\215wg\211\376\332\242\003\333\363#\347?"
+	.string	"M\360\327\025\177U\361W\341_S\374U\247\362\374\225\370W\343oO0\364W\024T\025\3745\002\177\013\353N\365\371k\013\177'\261Bo6\310*\253\fg\262B\224\005\374g\r\277\005\262I\213\301_\225y\006\027~\033b\206\277\"_\250-Z\360\267\220e\201\f\277\225\300\337G+\370\353\361\257\037\330\023b\250\355\365\016\256\201m\361\367\233i\201\377L\332\r2\f\2775\361\302o\023\340\302_\221+\374\374\025\306\363\322\277c\324\022g\300\177\373~\313\341\267\310\277R\261\307\277\265\322\027\376\212\254?u\005\327\340\177\236\002\236\301\177~\360w\026\253\202\277\026\375\325\350\257KY\206\2561\342o\2606\273\377\211\343o\023\374\035\202\277G\3607\b\376&\301\337\"\370\373\304\337\036\370\373\003\177w\340\357\022\374}\202\277Q\374\035\374[\270\302\337?0`\302\337\t\240\300\337$\374\335\200\277\027P\200\277A\\p\363\377"
+	.ascii	"\377\211\344\267>kG\333\302\003\347?=\360[\237\377jgr\261\377"
+	.ascii	"R\376{\350\340gM"
+	.string	"\325\341?W\370\277\366\237\255\355\357\025\035\374\266\347\267)\350\247\327\374g\005~\313\363\333\341o\203\277\025\301oQ\374v\003\277\325\300oQ\370\355\004~K\342\267\013\370\255\002~\313\301oA\374\266\303\337e\376\316\373\033\357o\033\376\246\373\273\312\337T\376f\362w\334\337p\177G\371\333\354o\262\277\301\376\366\372\233\371\267\326\337Y\177\017\371[\310\337W\177\377\370\333\307\337<\376\246\372\373\351\357\024\177\337\377y\377\265\374\375\277\312\370\353\n\376f\372\377\366\237\313\377\342_O\374\025\004\177]\341\357\032\177\317\370;\306\337G\177\013\375\235\377\236\341\257\312\277]\370\373\370W*\177E\341\377\331_K\374\335\302\337)\370\233\347?\223\277W\374G\361\327\374\277\347o\025\177\017\377\336\371[\347o\374\377\304\337\347\337\365\2576\376\312\364\327\032\177\245\361\327\031\177e\301_e\370\017\346?\332\377)\377\343\266\376\247\370\017\367\037"
+	.string	"}}}}\377\214\b\377\314\314\017\001eD\312\275f\337\221\233\204K\023\215\3105\222F\202\311\035\313\261\001\222\2530Yy=\356\220\t\310\205\311\322zr\231\227J\003\3452\003E\205\300\225\024&+\357V\271S\256\333\205\273mW\312}\273j7\312e\273Pn\334\245r\327\256\\\r\273O\372\355\027\355\246\241w7\264\3346\270\257\031C\177ygf7xNE\250\312~\315P,yd\\\364\275MnQ\017\265\032X\025\355\224\272\241\016m\013}\315\2161\261\031&\276\037qa\277bd5:\346|H\325\314"
+	.ascii	"\373*\221\345\312\310\353\367\253\242\311p\363\242\252y\201\236"
+	.ascii	"&/I\027\252\267&C\217\353\267\313&\215\006\217\263\255\032f2"
+	.ascii	"{\331B\002\fS\307%\350F\211\343j\207\024#Z6gNBv\024\371\325J"
+	.ascii	"\n\305\361\365\275Y\267\b\207\213\321\225\215n\373-\261\245)"
+	.ascii	"\251\r\301\242Q\242T\344D\310/\326\035\252\322C"
+	.ascii	"\255\357\r2\263\344\353E_\337\353\343^\331\305\370\002u\005\244"
+	.ascii	"\346F\217\033\334~\374\002\351\246\f#\250\357\255\341]\254\226"
+	.ascii	"\222v}\217w\223`1Q\321(A\377\313\303\312f\013\022\336^\325\257"
+	.ascii	"\325\215T\223/W}\357\216,EmQ}o\216K\245'\003\206\024*\035VH\020"
+	.ascii	"\223\320\324\257\216_\023\n\223\255\276W\352\026\375\320\246"
+	.ascii	"\274\325aA=\375\352\250\206\276\234~\237\266t\311\201\325\367"
+	.ascii	"6\335\242.'\240\276\227\206\177\301+\003\225\327\367x_\233\341"
+	.ascii	"\004I\\\337\323\360@O\363d\203iF\207\027)W5~\231\356e\206\nG"
+	.ascii	"r\353\026\001\345n\270a\214\306\f\0315]\214^\210\305\370\225"
+	.ascii	"AV\257,\221\202\364\275K\277)@\260\272\372^\245\232\366\037X"
+	.ascii	"s'\305\227\373\036\257\222\375\007\342)Hd\306\364=\315\021\372"
+	.ascii	"_\244{\324D\006m\355\032\375\036U=\037?\210\236\364\275.n\321"
+	.ascii	"\177`\355\202\303\311\230\242\013\243\355\b\256\007\227{\243"
+	.ascii	"\211\232\333}\321Sj\234t\334\240\353{\274\016\373\017\364 i\t"
+	.ascii	"\222\276\237)\203\376\227\310&mp\204\345\250\033\022\272\361"
+	.ascii	"B\322D\026\364+\204\202\234\307\254\020&C|}\257\222\304o\020"
+	.ascii	"\001\314\326\234\364\375]\240\2442\tt\243\357\177\2237\327\220"
+	.ascii	"#\203\325\267oF\311J3J\337\317\350\241T=\354\017\251-\034NRc"
+	.ascii	"Wo\\\256\23005\321^\200-\261b7\324\366\200\\Y\2549$\315\276("
+	.ascii	"z`wv\354kUn\f\2059\033M[\305\362Y-\266i\273\3302V\214\335b\353"
+	.ascii	"\354\025\313\305\206\261z\026\317\356\331/\226\316\216\261X,"
+	.ascii	"\030k\305z\261y\326\316\336`\263\3309k\203%S\303\354\235\255"
+	.ascii	"\272\205\263R\372\326\3064\215\330;\373\325\201e\246\241/\276"
+	.ascii	"\232\304\234\330\344\322>\351x\227..\262\243&\032\0242T;,\017"
+	.ascii	"%\227\221#\226\253\3121q\310A_VWU\213\027\2109\247f\316\331\002"
+	.ascii	"\031b\265H\030J\002\022I\031i\222p\363b\237\240\354\324W\222"
+	.ascii	"&W\023{\006\343\253\210-\357*\315&\245\\\330\256\337\032\371"
+	.ascii	"K\214`\357l\022\253\3042\257~a\312\247f\233M~\271\022\273\263"
+	.ascii	"Ol\222\257\311\374-\016{g\343\254\\\225c\312Yi\003#VYKy\347\025"
+	.ascii	"\037c\240H\340\376\226\312\255\334oi\260M-t\363\246\203\355\250"
+	.ascii	"\257\235B\342\226\312sh\232\300\361\001\351\233\243\205\3320"
+	.ascii	"\353\007\\\333j\016\376L\020\3643S\350gj\240\237q\201\0368\006"
+	.ascii	"=\260\016=p\nz\240\023\364\300%\350\201E\320\003w\240\007\336"
+	.ascii	"83C\201\314\324\250\230\3312\232$J&\245\276\007\"\241\007\016"
+	.ascii	"\241G\373\320\243b\320\243_\320\260\343\304Qq\021\352{\224\016"
+	.ascii	"=\n\207\036EC\2172\321\3372o\225\264\020\n0\200!H\331\327\227"
+	.ascii	"\004\211[\346sj\222=%l}\217f\241 \352\007\374[.\273U\237`\265"
+	.ascii	"Y\205\335\213E\362\3775\002\260\001\243A\343\253\357\321\036"
+	.ascii	"\350Q\035h\3155\007[\"6\253\206]\212-r\\\326\344HP\337\2438\320"
+	.ascii	"\031\362\245\340\2431\320\337b\t\301\271\201\n\026\246\020\033"
+	.ascii	"\344w\245i\366\242\357Q\"\364\2772hM\372ak0\242Agk\260>\320\234"
+	.ascii	"\326\242\364\375\257\211\376\207\005\375-\017kU\346\224\345\205"
+	.ascii	"\265\262U8>\344\336\264\372\376'\005\375\357\f\255PJP\033es\324"
+	.ascii	"\260\303Y\2513qn\236\0201\201\353\373\337\021\364\365px\206z"
+	.ascii	"8\374\037\026Z\257j@+T\375\200/\2509\2702\355\215\001\3400i\030"
+	.ascii	"M\331\250zH\242H\2151a\375f\200\341a\251\321A\020\224&[}\177"
+	.ascii	"K\343v\206\327\026\\U_+\343g\226\311p\365\375/\007J\202\350]"
+	.ascii	"\2304sfv\037\220\r\322@\271\314@W\331o\217\254\221]\262E6\311"
+	.ascii	"\306\260H5\314*\375\326\205}1\224F\266\264J\026\306Y3\347\334"
+	.ascii	"}\331&5P.3 \304\314*Y!\027Wc\206\324)GZP8\334\377\204P\313\254"
+	.ascii	"\0370\t5\007\377\227\321\3431\350\261\035z\\\207\3766\310*q\220"
+	.ascii	"\310\240\362\221q\200N\366\210\314\350{\254\005}\r\263I!"
+	.string	"\024\262pp\351{<\207nP\346]:\251\244\210\033\037\231_\225\322h\252o\357U(\2616\273\276\307n\350^-\323>\2224VrvM\274\276\241\363zL\333\365]\213\351f\207i05\254\365\376\356\322^\352\rU\017[5\355\232yC\2104\326\f\223+\273f\336\335_\355\364*^\265\241\312UY`\253\255\332\351\365\227\212v\223df\244_\217$\273f^\rz\r\244\2614P.3\240VV\203^\377h\037of\\]\275U\345\230\356\221\261f\353\265\222\256\323@\271\274jI\262Z\257\215\364\326M\222\231\223?\253$\273&\b\353\324\245d\003\300=&\202\266Q\256\0370\007i5\007s\001\342y\221q\353{\\\205\242\031\251q$\f%i\340\253\251\231s\026\033\3533\244\257'%NZm\016)\255\222Y%I\250\330\227\215\346\372K\214\320rM\245\242Y\346\325OL\252\207[\307\305P\0265"
+	.ascii	"\254\303\216\346\252\332K\256\277\336\205\204\241$\340\320\234"
+	.ascii	"\225\\\257u\233U\222\204\222)\217Z\256\273j\234\006\312e\316"
+	.ascii	"K!\260\230a\262\262\364\\_i\033zKWi\272\326\322V\032K\rk\271"
+	.ascii	"\236\362N\322L\353bJ\t\005\200{\234\321\237v\350\337qR\306\224"
+	.ascii	"\324ma^!th@\340\372\rw\315U\275\365\375i\005\375\t\027\245\331"
+	.ascii	"p\304\030\335eI\213\322\244\241\324\fYB\372\321\367'W?\371\365"
+	.ascii	"\202\262\261@4\342\320\372\376$\202\376\364\201\206Psp\233]!"
+	.ascii	"(P\252\372\376\214\201\276\206u\331\273\t\266\302\225\303\372"
+	.ascii	"v\023\234\032\316\252L\365m&\325\206\2763)k}\317%zf\315\301\275"
+	.ascii	"\244V\251R\267\326\3677\f\372\213\005\375\215\202>\315\t\212"
+	.ascii	"\231\365\003\276\2261\364H\336[\177\027i\255\212\366\013#f\013"
+	.ascii	"\253o\037!\361FrC\304\025\005L_\234\276$h\3159?\020\270D\004"
+	.ascii	"$\255\357=\b\241wUU\330*\204\232\211\304\276\234,\232\216\266"
+	.ascii	"\030\330\252\261\266\210\271Y\301\"%\205\251*\007\246r\256\353"
+	.ascii	"*g\246\0206JG\354\234t\034Sq\311-)\322\027O5\026\315\033[\r\262"
+	.ascii	"\265\0337p\024"
+	.string	"\b4s}\365h\346\314\024bF,I\b\206:\216:k\262\347\324\027?5\026\037\230\276$}\261\323\327\204h!\005\351\213q\340&)HF^}1\r}?\306\314\210\352\373\016bY1b`\246\352\225\221. \222\307\f\351c\263\303\3025\216\231\326\242\256 y\353\213i4V\0177>\275\276x\206\r\252r\201u\245/\226\361\265\037\334\024\251\247*\234\2173V\262d*33A%\301\220(b\303\rRn\332d\f\215\r\035+\035'\225\030\341kRL.2}\261\021F:}\320@F\250/>\002\241iL\024\231\276\307\313*+5\020\351{\f\003\027\375@\2331\2443\030}\337!\n\305.\360\013\032`W\312\364}\207\033(&\302K\240\"+\260\276]\277\206/\202\257\252,F_\f\204\205Z.*O\bc\032'@\320\270\364\375q\020V\236N\246`\\\351\373\2611\233\370\372\036'\243|"
+	.ascii	"Y\352\233\244\345\006\221\230\276\357\2604\346\037s\226\251^"
+	.ascii	"\031I\004.DYy93\205\300ij\002\002"
+	.string	";\371~\226\231Q\363\022\367\242\357I\346\234\252@\300\254\215\351{\356uP\212\371\231'\346\304\253^\031\351W\203\007US+/\231B\340\324"
+	.string	"gCS\363\344\362\263\013\227\023\3576(;\321\360\013r\204\252\231\227\227L!\032\017\311\21300?\361~\336\225\030\341knJ`\340\350\3733\314i\367\003g\260t\200\025\351{\016i\350A\360\242\241\244\324L\322S\252k~\301q\322q\324=\316\257\033\300\314yy\0066Y\300,\341R\367\003-\222\224PZ\337s\030C\317\001\013\375O\033\302N\033*Y\0062\220R\b6\240\034jy9\251\355\003\273\367F\245\326\367\034\200\346\346N\272\031\234\320\275i\321\204I\n#\312\362\223\0168f'\246\251\357\211\345\354\302Q\002%\003J\337\363\212\215Q\020 1\234\274*U\256\331\004\304\214\232\231\211)\304\214\324W\332\262\357q\276P\241r\237D\260\003\2033\207\276\032\251g\334k\330\031w\255"
+	.ascii	"\2279\313\200@\214 2>8\216\033\372\237m5\354l;\3412\300\314\311"
+	.ascii	"\231&UN\270\377t;\337\232L\r\224\007\251\256'}9h\311\365\003"
+	.ascii	"n\243\\s\360q\310\320\320\316(\022\340\002Csgw\305u\256\375\214"
+	.ascii	"r\213\340\256|%\365=\325\2766\246l+G\337\023J\237\341Xm9\262"
+	.ascii	"\354{>y\227\240\251 p}O'\225l\313\351\211[\3373\255\333\366\322"
+	.ascii	"\262\270h5\033f\205%\tZVv\232e \327\032nrdQ-\361~\232\001\203"
+	.ascii	"`I\025\365=\316\220\260\223,\354d\202s\256L(\244\244\314\224"
+	.ascii	"\024BL\354d\202&A\350\005\251\301\243\241c9\366\223\311q\354"
+	.ascii	"+\306\331\345\245d\326\325\3678V\350qj\240\257z\365\004\013;"
+	.ascii	"\301\252\036\210l\273$\351\336\264r\022\363\203\343\034yy]!\020"
+	.ascii	"\314\274\364\203\001\206\356-/'%}\360\233\275#GNf\030\006\020"
+	.ascii	"\211\242{K\362\223yv\005\305\310B\244\357\211\344\354\372\017"
+	.ascii	"\274\241R&\247\345\354:\271b\360\035e\351=\233tAeyn\335\324\241"
+	.ascii	"\377\251\025vj\335\244]B\001E\221\260f\343\006)y9\267}0\343f"
+	.ascii	"#F\031\264\254\254+\243s\316\371\352G\246c\257y\0036d\310\375"
+	.ascii	"B@\234\022\312\203\211\312\250\357o\266\204\b\271]\027\300%\317"
+	.ascii	"!`\276t\351\373\033\251\253\253+\306!+\261t]e&\246\020@ YKj}"
+	.ascii	"\177\203\204\236?\316\037W,\304\232\022\246\0202\254\205\351"
+	.ascii	"\353{\233<\364\364q\372\270G!\360)\301RUu\362\240\231\203\263"
+	.ascii	"\372\311\003\r\177\231:Z:\247\200F\230\212\256\330\242\242N\252"
+	.ascii	"\2319+\035?\251\246\252\354x\353{\3468\247\200\236\224\320\246"
+	.ascii	"N\251\345\320\215\036o3y]\310\246\330\214\335\270q>\001o\224"
+	.ascii	"/\210\262N\247\237OZ7p\251\365=\336\331\364\0378\202\221\214"
+	.ascii	"\245\276\377\331t\322\360\205d\250\354m\246i\017\007\334\211"
+	.ascii	"\243:1\302\304\313}oc\2049\323t#I\253o\215\0326g\247\272+!\350"
+	.ascii	"9\343\347\214\333\207\346\234\201$mx\240\377\251\364S\306\177"
+	.ascii	".\2351\272\313\215.\036}k\263~\300\004\2509\370L\"\361S\311H"
+	.ascii	"\262\351G\337\001 \235GfQ\246t\364=\215\230`9\347\f\252\227\246"
+	.ascii	"\275\265\276\267\241\2016U\223\263\350|Q\303N\030\314\234\301"
+	.ascii	"N\030\265\357tq\223df\245\020\310j\310\234\210\210\360\375\317"
+	.ascii	"\345O\027`gU<\232}O\"\022?\227\022\3501u\244\257\2559\370?\225"
+	.ascii	"?\207\3763\350\024\002F\2451\315\372\326\266\372\001\013\240"
+	.ascii	"\346\340\023\210\304O\245\235\0260#}\003p&\373\320\242\332\224"
+	.ascii	"\364\375\315\273z\277c>\346\3661\345$\030\021\202(\321\275\345"
+	.ascii	"e\246\244\020\377-\363\333gy,\215u\361\321\350h\"\225\305G\346"
+	.ascii	"'6\307\367\264gex)\3521f\357\365(\210\020\\\337\327\324\241\377"
+	.ascii	"\353\373\307\031()\347\274t2s\222\262\006\377\365\365\2545\304"
+	.ascii	"oSm5\300\377{\b\f\231YiV\227s\256w(\026"
+	.string	"\032\020\216\r\362\377\207\3109Ys\316IK\260\034\311\016K0\240\274\\\"\247\324a\t\226Ci\311\314Q\030d\260\251\274dB%/T2\347\234\354\314\314A9\224r\020T\322g\311\314I\231\t\225\344\220\203\2248,\231@\311%X\016\245\272\004\203RZ\202A)u\310A9\231\203\200\242\320 (\245\245\024(%\016K0 \245eP\016\245\312\204\312\265\n\024f\216\344P\006\003\262\3119\0271\257\22259\003%\345\244\2256\3129\232F\331)W9#\314\251\234srL\213\024\024\220\251\314r\313!P<C9k\311F\"$k\222\231s&\312\312d\315y\210\231\224\263\022\n\005L9\347\fU\257\020%e\233\034\004T\244\224\202\252\031RB\021\345!Q5\347\234\225\226`RP$\234\204\201]e%3Y\227EP\371*k\311\221\204\202%\231\325\316\006\254\007S\321\335\257\230\377\342\335\033j\254"
+	.string	"\361\340\321\267\216\325\0178\203\232\203\353\023\022\277w5P\226\274\330\232\277v\377\005s\303`4$[1\372vR\375\200\rPs\360\375B\342\267yn\331b7\327\227\203\232\203o\235\235\241\257\257\257\217L\316@\267\256\257\227\333\345\267\3568?-ZK \314\345n\341 H\222\262\27637\360\366\340l\350\272\346\0161Y\304\230\0270\0259\242{\222%\312\371\365v\004\bK\227Y\275%4`]\271sNBtN\346\254\334y\201\001\323wL\331U\220\276\026\314\211\223\2640Yyd\367\314m\t3LV\336\362\"1\300\tT\230\254<%\027L\002H\344\302d\345\211\341\270PzW4\256\r2WbQ\227\307\027\256\244;\203\204\241$\340\013e_\363\306\265A\302P\0220C\026?\310\242\321\004\244\211\016;C\244\007b \2368\217\210!\013b\032"
+	.string	"\244\361\250Cd\2017\300\203\374\341"
+	.ascii	"NJ,\232(\n}N\2640\034z\030\"\215=:3\351\217q\310\202\210\"X$"
+	.ascii	"\246=\304\237\024\301 \0162\375\361Qq\246\304\"1E\026\215:\247"
+	.string	"\n\341\260\347\026\215\304T\250c\354\t\032\213\307\3430\030\344\360\302\260x\323B\3303<\301\270\201t\210\304\2619\016U\330\331\021r\200\001\205\3420E\022{lR!\213\243Q\005V\221\026\211G\037\025\277\r\370\030[\3201\366x8\217\b\fzz~\212Ec\361\367\202\361\310\223\032\213\277\026t\214=\305\237\340\005\347\021\241\002\n\023'F\244\303\025Ga\332\202\216\261\307\204\341\321h\002\213a\212lq\002\247h\002\210\252\370)\301G'\245\361\321I\201\310\233\342\320\207\005\037\035\024\307!r\006i\302G'\235\231\tADz\024\372\210H\177X\020\246\302\023|t\322\016\351Q\230\236\360\321I\321\235a\f\304\036!1%\026Mx\030\036\177V\020U\024\215:7\347\021a$\356\244\310\017\307\343p'Eb\025?%\314\354\b\207\035\360\321I\177>:(\220D\020\303\3411\005\0249\310a\332\242\004\037\235\024"
+	.ascii	"'|tR\017>F\033\036\344\017\007\206\303c\n7\302TxB\321\210\207"
+	.ascii	"Hc\217\tE\343/\r\036\323T\230s\235\324g\250\243s\201\242\021"
+	.ascii	"\275\016\3618,\016W\240\027\301\001 8\200\004\030~\303\030\210"
+	.ascii	"'Px\240YQ$\246D!\b`\350\300\005\303\3411\005\030P\364\bS#\212"
+	.ascii	"\035\341\314"
+	.ascii	"\211\016-R\037\026(\244D\026\310\242\360\210\342\004\222(\200"
+	.ascii	"!\362\227\302\204a*LO\f\213D\025z\216\251\t\351\020\351!\205"
+	.ascii	"\t%\244C\244\215\212\237\022\320\"q\3050\305\3140%\036A\260S"
+	.ascii	"\034\242*~J\330\021\016\217\277t\210\304AA\005\023)\334\363\210"
+	.ascii	"@A\005\023)<\240\304\316\020\371S\374\t\242\370\230\372\f\221"
+	.ascii	"\302\0247\307\324\307&%\036_\250\331)\016\203*~R\f\221\302\024"
+	.ascii	"6C\2440E\320\347\247\005\035a\212 \013&\2028;"
+	.string	"\305ap\350\202\020\031d\301D\260\006y\034\266p\024\262\b\242E\242\220G'\210\215\305a\017QE\360W\002\271B\330\243\"\370K\203\277\235\036c\220\246\310\342\247\307\250\023<\376\350\004i\206=)\204\251\013\301\033\025?)\322\243\221\007\031\004\246A\026L\004g\3164(\202\003T\2500\006\203\300t\210T\241\302\030\374\261`\"H\223\272\2403\3341\352\004Q\026L\004m\206;\304\027\2023(\250`\"\205 \013&\202h\212$\366\330\250\370I\021D\016\217\303\341QE\260&\r\016c \"\361\b;B\237`\020\017w\214,\202gZ\034\272\200\302\314yD\354\b[\354\214\330\021\266HA\354\031!\002\203a\fD\344\035\372\264H\2570\025\356\374\234H<L\215,\206G\274\002\311\302\nS\341\316M\203\351\321\310\001\037\235\024x\236\035b\247\347\021\241\301qHTAL\213\303\035\342\f2X\363\201\364h\344"
+	.ascii	"\207aO\n!\n\027\36008\3341\256\220\036\215>3\303\035#\213;\f"
+	.ascii	"\262\220\036\215>6\310\242\221\230\372\030\177\303T\330\201\235"
+	.ascii	"\037a\n\324\005\342Pg\330\001\0203\307\224\003&>\f{v\2105\302"
+	.ascii	"TxB\013:\302\024==B\023`8\336\244G\243\317=\2420\244\250\013"
+	.ascii	"\307!\362\262\020\016\217\351\211\340\216\260\305\016M\261h\324"
+	.ascii	"\271)Nq\212+\210=\302`\360w\036\021\251\316\3171E\226@\006a\030"
+	.ascii	"\246?,:\264\240c\354\t\006qZ\3741\352\004\203\277\343\260\370"
+	.ascii	"\2021\030\374!\217C"
+	.string	"\344O1\030Dw\212\304\026\202A\214,\022}\220\301\340\257h$\"\211=\303`\020\230\006S$\261\207\303yD \207>-R\020v\206G!\017\022\204\021\310\224\230b\304Oq\005\b0\374\024\211= \210\340\200\240\003H\200a\304p\347\247G\247H\034qD\376\214\200@\n\303\260\330#,\036\207i\221\030\334\021\016\217<\251O0\210\201\013\303\243O0\210S$\261'\030\304\302T\270\023\f\342\243\220G\347\016c \"\203A\334\202\216Q\005\030\216\270\307h,!x\356\fS\235a\261h\324\001\246\305\037\243\tiqH\354\321\241I\203\016 \221\006\221\036\030\262 \246hz\036\021\301\025E\342qD\321\310\202\205Qg\203\033}\206\307\021\251\321x\034A\323C\024\246\027\031,aE\221x\254I\203$\244E\342\317\3578T\241\342'\005n\001)dq\323`\211\006\244E\342\017z\022$L\330\300\003\033\300"
+	.ascii	"\252#\302G'\r\366\b\211\307!r\004\3628t\201x\334\031Q$\nY\214"
+	.ascii	"\3209\"G\210(\300\216p\310s\377\377n`7k%H\r!6\260\332\226\267"
+	.ascii	"\253<\0312~5h\224_h\374W\203.G\334Z\337\337\214s*\214K\206\036"
+	.ascii	"\372\377b`-U\313\224\021\030K\030\013\220(l\251J\351d\202\323"
+	.ascii	"\345.\210H\322Ie\371~\204\205\371!\225\021K\302D\362;:y\324\215"
+	.ascii	"\225\251\322\367\367\342\367\342W\004L\"\375`\374W\244w\003$"
+	.ascii	"\312\233\226\034:\364\377\271x\302\341\343\333\302\261<\361~"
+	.ascii	"E/\300\212\020a*g\031\2611\246!\246\r[\227\240\035B'\334\325"
+	.ascii	"\263\222\244-\250\267p~\300\331P\332E\321\303\341\365\003\272"
+	.ascii	"b.\024\324\023\335/\311T\255\274\236\312\374\262\325\251w\205"
+	.ascii	"\bV\3379$\364\245\357\b\223\211\256\f\030\276 \350\026\273&J"
+	.ascii	"2\307\\3\352\324\246\340=\274\304,F\024\2421\355#7\325\036\227"
+	.ascii	"R/\252\310\013/A\3620\231\315Cx\240\211\241\302\311\034O\324"
+	.ascii	"n8>\033\032\342e\006\336)\303\347\216k\313\235\225\323rc\310"
+	.ascii	"\235\235\322\220\262=\2550'\335\b%QY\370\3131\230\377*q\023\313"
+	.ascii	"Y\230\252\276$\324\017\030{!q\374\245\271\250\226<\372\342\232"
+	.ascii	"\203q\035\256;\237\200I\276\2536\274\005o9\237L$}\362r\230\320"
+	.ascii	"\321a- \240,\235\025$[Z5\260\214\270\320b\345\326E\351#\263\243"
+	.ascii	"J\025\214\005\004\232\267\206li\016\271\261E\356\3121\0267\251"
+	.ascii	"\255\030}\361\334\255\343\013\023\327\027[\251uY\304\224m\251"
+	.ascii	"\001\007\207\251\324Qi\342\260U\231\0224\345\230\212\t\2104\265"
+	.ascii	"\372\3428,%g\211\243\340"
+	.string	"(\330\255\013Q\326\225*%n;v\243\261\222\242\243G_\314v6\341\244:1Q\225\312\225\246\262 }\357\001/-\r\253\035A\307t%\225\301P\216\325\200{K\222Q\372\342'\215\205A\236\225\274\276\330\211\207-ee\370\314\310U\345\223\242\224dv|\266\327\274\003\323X3A\\\322\254\250\210\211a\262\352\225\221@\024I\0333\244f\031\264#\213\3111\331\231\023\245&}\361Xc\001\323\332\362\016'E\212\340\314\372\336\003Z\222\237\211\227\\\240\234\225!0\225Zrf\nQi8\301\330\362u\274\344\030\254\304\b_\313s!EC\337\277\231\304\341q\365\305^6\b\017q\362$O\311\177\340\016\020\024\035\357r/nI%\221\276\367\220\004\275\007#\030\353\230\b\306\302\\1\336p\336\250\312\372\360\221c\256\343\255\312\226<\"\353{\214\004\0339\2334\270\221\301\321\367xX\313\006\211\323U\027\254\205\213"
+	.ascii	"U\3412r\0321\177I\232`d\234\205\207x\240\302=\216\257p\017\034"
+	.ascii	"\304\352MHZ^^\322\020\242&\313\021&A\202\250Q-\321\342\372\342"
+	.ascii	"\037\307@~`;\311\273\021\326\367\036^\240\330\307q\r\001\205"
+	.ascii	"n\250\243\001d\202T8\204 \f\205\n\031BEC\333\264\030#\026@@8"
+	.ascii	"@*\022\013\333\250\017\023\300\304K\353D\251,\306\234B2$\"A\224"
+	.ascii	"$\005%)\024\206\003DA@\231\n`bH'\374\235\347V\372S\331\344\224"
+	.ascii	"\200\220R\375\033\344W6J\006\325\037"
+	.string	"!\347U\220\343\242\022y\351\rU\257\2144%\242\367/\226\022\222\344\300\361\261\204>`\024\322\276\353$\020o=\200A\001\006\203\312\354\236k\005\272#E\244\347\364\324\301<\250\273c\037h,X\234\364\257\017\225\360\266Ws\214!M<\213\nGf@*\231\365\341\321\200\310\266\354\336\256@j0B\267CLK'P\254\004l\371|\241\353\250J/\244O\0052\365\326\352\314\224\261\244w}\224\253\034\303\340\343\032\026\352i\362u\364\031\303\"\232\326\345\325\220\214\262\022\025\233\017\376\261\264\034E%i\034\300\222\243\362\321\200\374\210\334T\265\024x\366\301K\222@ao5t\322<]\355\373\250\\(%\227\317)U\342\246\0262\241D\267\363A\200\336\315\373\f\353\271C\342\322\374\2420U\241\325-\270V<\210\002\214\372\001\211\212\256R\304\377Y\230\207\002ax\235=v\331\302\354\030=<9W\363\026{\205L"
+	.string	"\313&|\342\264\314=fUt\272d(j@\263\327\345\332\n\204\020\327&\354\253\243\345\302\302\034\215\2323"
+	.ascii	"\3242I\366\f\006\305jC\022\203\t8\360u\371\251{"
+	.string	"\343u>w\021f\217\262#\301\031\271\302\0378\245\330\020\023s\2136\211s%\026\221\033\277\225\311E\026D\026\233'\0311\220\234\270\324\362)52\034v;\025hB\373-#\243\304\203X\231O\314$\315\265\354\203\005\274\033\f\026\220C \3414K\370\375\022\277\026A\177\221\322A\006Pc)\242\262\314\266\203W4\322\202\252g\1775>\020\320\331\353\001\210\250\337\226\363\233\205\273\313.)\n\2536\314\006\251Q\004\267\325+\202\035e.\363\365\261\225\006\345\2043e\250\212,`\323\001\200\373\277\214\023\3230\374\370\206\345Hl\016%\331\350E\257\006-\253\3766\fFX\310\251\342%U"
+	.string	"0\036\255%8\366ZR@\340"
+	.string	"\325\342\212\201eUv\025\2452\271\316\\\341\374v\344\366^\2078\353~\216\310M\2246O\305@\356\365`\210\351\365\360\311.\t*S\314+\345\325rl\231Wa\300\257\321\265\"\317\251\235\251\262\001\324\257\263\366\007\247\024\006d7\277\364\205\231\032\226\3033t\224\227\301l\273`-\277}\346H\226W~\003}\307\017\376\r@c\375e_\311S\021\232\264\205^\033;\227z\304\352PT\243@-\007y\334!\2268\343\251+\273\222\264\030d`\024zA\013\202\352B\231\025:1\033\303\200\232"
+	.ascii	"\363A.\031\t\262|\350\233\t]\245\027\357\254\366\237\216\303"
+	.ascii	"\255\374{\3321\016[}\232\016\243\024!k\230n\\\344I\317\244p\374"
+	.ascii	"\202}N\3304\007S"
+	.string	"D\331\315\346\021IN^\244\224\324\013U(\367\352\325q|\345\233o:\3621|KY\320\267\005\013K\327\004\200\215\n'=\252\004S\300l\261\367^\370\220G\t\352\343\244\230\361CC\307\253\244\"\2347\022\273\247\364?\003\004\373\222\261m\312\335^\364U\0071/:\335R]1\301\f\337\005(\240\340\325\266\363r\0070\005\304\364\350\016Oi\223Bp@\016\177\336\302\312y\"\210p\303\352\321\204\372\233\313Z\274E\027\026\250\262\200\226\235d\343\017\tQH\370\003\224\367t\216\207\231\2528\243\223=\273\025PA<Zs\016uem\022\250\310.\203.\200\242\332\260\2576|d\270!\0248\355\213\037(\253P\t\265He^e\374\n/l#T\374l\347\331{_$g\006\346Z\204\301\005\3239`x\303P\024\0228\243\361L\306\260\313\254gz\270-\231\253?\032I\221\237i\306-\025Sh\311\r\244\367"
+	.ascii	"\271J\002\236\332\200\310\211I\013\244\316\226\266 \371\020w"
+	.ascii	"\336\372?\354\321\212B\330\267\271\244qx\332\214\301\266\031"
+	.ascii	"\327\273\354\017\230\352cwobRU\376\320\227\020F\267\211u \334"
+	.ascii	"3\264\306\\\267H\3450\035[\212\264\236c\236\370K\f\336l\007\001"
+	.ascii	"<\037~q\275\242[\nP`\tr@rZ7\024\324\310\032\301\346b7\344\034"
+	.string	"\217\353\333\223\355\247\322UB\362\342\222\n\223\352p\241\275\\U\316\345\002\255A\027n\256\006k\323\313M\212\0271uj\013\001u9\357\212'\324\237\334\232\242\036\3677<T\211/\371\024nM\265\202m\267\005mQ~\031\372\266\022\253\017\272b\205|\331\321\311\007\214\252\337\201\351\262\303\tL\270\304\310R\235\325*\017n\254Elib\224\215P\213\257\334\246\221$\366\304\"\251\313P\244\3621`\215\344\323\034\017\364U\333)s\255\330)\356\300\2330\364-\020f=\004\024_(e\250\207\334\331W\327 @Gx@\221\373\320\216AG\367\027\036Z\376G\377\030\224\325\221\001\357\231}-?H\"\270\277q\366\306\033\006K\366\331\366n\334\216\240\356h\372\300\201z\216\221\242\347[\320\221\232\037#\b}\2518cr|pp\351\02463\335N\347\207W\t\221\2734\307!\327\003:\206\216\244[[H.\361\004K"
+	.string	"-\235q\346\2711\t\363\235\232F\366\273\300\236\355\230/v\326\325\032\215L\005\325\b\262\035\323~\001\212\323\316\255"
+	.string	"o\227\023\343\374\275h )\025\231J\262\247\343&\223+VA\337\343\021\362qRb\013r\"O\255\330\005\213\366\2472\206\303"
+	.string	"x\241\2045RC\377\326/\243\255.\322zr\2435\265\005\357\200\313p\256\t\037\201I\337\214\326\207_\003\001|WT\rz~a\2259\032|>\260B4\206\017\330\365\264\355\234\025\373\226xZ\035U\302_pSK*\036\020{t\024\032\227\231;x\211L\377\236\004\235B\0060tr\210t%\225\004\030\340\205\314h\246\312\177"
+	.string	"\344\355\270\313\0019\233\\\351\235S\272\201y<\376\237VD\332\3049\335\361\271l\317s\222)\320\t\177\266\234\304\2173[\2644\026\241\r\034t\327\355\352\326\002\254=\324G\025\344\246\265\305\333\311\247\317\351\027\263(\3411\336\270\345\376\023\3370"
+	.string	"\3311\025\331\024\210\034\372\313\306c*P\312\t\216\022\305\364\262)\036'JbS\235Q\202K\336\264;\025\343S89\363/%\274\315\267\356\013}\252\035\016\324\310(\330\3032\253p\353\320\b\346\224\261`\"\371\002\027\237W3\013r_\020D\276\351\013)@\3720\024\031\215\331\035\254b\301S\340\222i\353\267\r\035\354\023\251?\357Q\251\370\306\335\b\242pD\022>\365\262\243\206%c\013vS\252v\177\270\210)'C\3464\303=\236\020\303\006\nN\005\256\271\274\025i\332\236M\374i'\247\260a\340\304\326k4\311\234\200r\266/\022\247\346'D\340\215\005]8S>\3231Y"
+	.string	"-s\004\244y\350qP\376\316]!\272\366T\300.[+G~\026t\342}Z\026\331:\334\230\246\341\017G\300\006.bh\274"
+	.ascii	"\274\333\333\037\377m\200N\3043\330Ja\316R\300\024i\3279\376"
+	.ascii	"\321\266Zv\036\274\310\330\025|\207O\020\276\032\325\320\024"
+	.ascii	"q\016*#\333+\025\220\0052W\021\331L\320`\247\366\032\336\272"
+	.ascii	"\2106\312\372\313k\271\266\032\352U:Y{\"T\336\327\027\b1\332"
+	.ascii	"z|\035\223\341\362l\364)\376\362\0133n\333\353\314-\037\005~"
+	.ascii	"P\353\246\3359\032\271\035\301\304'\246\217\314\301\335H\375"
+	.ascii	"\340\266/k\277\222\322\355\206\037\240\230Q\276\373\276\327K"
+	.ascii	"E]\023\246&\371\016\367[\330\362\206\237n\017\324-\274\b\361"
+	.ascii	"\263\233\202{x@D\276\212.\224\266\302Xq\213t\257\260nV\241O2"
+	.ascii	"\207\246\021\201P[^\002\373\215\371\325\337\373*\247\304:\353"
+	.ascii	"_\023C*Kf\360\301\360\272\262\374,\334\222\227p\364C\036\205"
+	.ascii	"\265\237E^\3541\355%\227\027\343i\223\336\266\336+&L\265\306"
+	.ascii	"\2334\205\273{N\336\263\321\026\330\376\314*\360\2231\206a\031"
+	.ascii	"<\314\0245\355\321\372\024\231p\256\304\311.\016Mc\234l\323\346"
+	.ascii	"\377lk\356haJ\240\003A;\305\327\266M\301\260\301?w\326\tO\300"
+	.ascii	"\327\222\247\271\262Nb\023P&\242\220\b\31602\233w;%\322\275X"
+	.ascii	"\220\226\335|\265\252&\342X\307\b \277j7\366\3254n\340\261\272"
+	.ascii	"\3476\210\020/J\202\347\256\002\260}\332m\251C\316v\372\350\353"
+	.ascii	"k\003\026\342u\215\200\215\2418k\246\377\207\301c\3036r\371\361"
+	.ascii	"\262\206\007.\253\321\352lXCs\013\310\r\305\364M\004\216\323"
+	.ascii	"[\250\037\304G\2259\252\366\027\211\306\367\350\310\f\232|\227"
+	.ascii	"\305|\216\020e\237\356\"\216\340W\205\341'\315\216\202\264\271"
+	.ascii	"\343\236\300\261\371y\376\303_\366\351\261\330Q=\233\341\246"
+	.ascii	"\31775y\373,\230\270\335\337\034\177\030\334\363\233\305\271"
+	.ascii	"_\361U\311\351\f\231\271B\267hm\304G\367\3058\360\024q\233`\261"
+	.ascii	"\336&\351\275\022\263\263\370\365K\261o\362\275\377\240\207+"
+	.ascii	"p\217wO\354\343\236\315\341\220\203Or\270\340{m}\361^9\020.\352"
+	.ascii	"\237\333\377\306\341\244x\237\364M\354\313\276\251\017#pp\377"
+	.ascii	"2\373\233\231T\242\277\002\033&\266\n\272pt\226;\366\022\276"
+	.ascii	"\253\363r!\3560(!\016\223\3179\322\366\313\221\306\030\377\261"
+	.ascii	"\330,\326\374\017\231\006%\237k\314\276\3146\204M\337q\367Ry"
+	.ascii	"F\320FG\371$\212o,\217B\376M\302\036f\037\177\371\b\3354\326"
+	.ascii	"\263\315\027Pw\240\300\327\330f\031\222\373N,x\333\r\373\237"
+	.ascii	"w\337\366\344\226\313\005\376GD<\365\333\334\202\367\365b}\245"
+	.ascii	"^\312w\"N\366w\033\375\024Q\023n\361\003\244\017{\227\200\335"
+	.ascii	"\3609\335\200y\030\236\271\275\206\376\205\323\247\352'\243\207"
+	.ascii	"\3463\376?\317\336\255\371\232k\3732\202\215\0359\2024\325\357"
+	.ascii	"\203\030\377\\\276\004\306\341\361E'\335=n\017\263\251\246\272"
+	.ascii	"?y\322y\013\335:g\356\332\227\225\025\301\205\357sq\243ML\342"
+	.ascii	"\262E\331\206j\306N\307\333\277j\177\013\226?\213\374\307\265"
+	.ascii	"\247\030\034\360\233\"\373\317]c\372'u\271\242\226\315\325\263"
+	.ascii	"\026o\364\273\032\276$\327\355\226\tE\001"
+	.text
+	.section	.gnu.lto_.symtab.fbdd682e78d27034,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"ringBufferPopN"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"ringBufferPeekSpan"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"ringBufferInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"ringBufferPushN"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fbdd682e78d27034,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,245 @@
+	.file	"sound_beeper.c"
+	.section	.gnu.lto_.profile.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 )\r\001"
+	.string	"\310\035"
+	.string	"\004"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"b\216\265\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.string	"(\201o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.4ccc8737541e75e0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_systemBeep.9.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \343U\006"
+	.string	"\242K,2`O\322\030\024RH\034\363\004\360\320W\177\330\353]\006d\230\217\3036m\224\250\367m\333\201K6\260\020\004C\252\261l\203y8\213!h\003\362\367\226)U\025\257\370<I\022b \224\200\240\256\212\210=LB\013KR\357\262\"&\336$\261'!\0341P>\212\030\345\203\262U\3079\310p\032\237e\232\373x\005X\307\371V"
+	.string	"bP\262\333\361\342\262)\317\211\310\257\320\337\33234L\355\\D\312\242\322A\331\315\024^\020\320\347\371+\321\006\201\t\007I\313\356>\027\242S\333\\uD\0074\233\214\266\200\207\335\275i6\036\272\323?\341w\3701\002\b"
+	.ascii	"3\003\316\231\301\341\313]\303\277!\264\222\032\027\356\306\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_systemBeepToggle.10.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \303E\005"
+	.string	"\202\311#+pm:\240k7USW\\\366]\243\246\216\035\303R\350\346\225\217\027\364\260\264\226\206T5\004c\344WF\342\237\013\020\351\275e\n\267\252:\2659\037\215+\223\320\215\267:'X\2758\303\034\020\266\352\306U\342T\233\225#\224V\246\302^\t\"(\262\362\207]\224\232\177\001-\301?\026@\006R7\346d\352P\340\303\371\277\324\271\177t\260\020D\027O\251\273Yn\226\333\310}\267\263\003\357\3536\n\030\335\375\350}\231\275\334\377\212\377\213\377W\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_beeperInit.11.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\342\214/2pO\032\003$\372\360\377\266\257\210\237\033\356\372-\001\034<e\252\021\231\320c+\025\321|7-\231\326\377\277/\342\221]\370:t\035\331\004mI\244L)\022TD%'\251\023gFO\214\020\016\235\252BZ\320\232\321\202\232\035XQ\017\023p\232\026\344\034Tz\342\204\024RN\250\311n\207\325"
+	.string	"\303e\264\331\2479\220\326\230\377\257\303\332\266\360!r\331\240\374\034\243\227\263<\025\021M[\267\326#&\271\\r\341\201\037[I\371\263\204*d\374\232\271@\362\313\230@\362\353\325\266l4\004F\033'\242\377\320\205\370r\273j\2338"
+	.string	"\024\372\270\0014\374o\003\205<\\\347\266\bm\031\332v\004\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 W\255\001"
+	.string	"\244\002S"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\n\177\003\013\177\004\005\003\005\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4ccc8737541e75e0,"e",@progbits
+	.string	"(\265/\375`\321\005m'"
+	.string	"JJ`\020Hp\334Q:u\246mU\241\t`|\013\222m\342x\261I\375\347x5\t\327\253\026I\217\327e.\217\032\0326\216\375Y\035o\033\031\243A\2417\365\267e\f\333F\322\244\336\001\241\324\266,\036uT\313\020\001y\322\210L\001\334"
+	.string	"\362"
+	.string	"\360"
+	.string	"\347\355.v\367y\354\337\375\021\226\030\215\225L\226\300\252[\313\207\220\332\031Y\017;\3357))\251@R\220W\177a\362\203\262\027>\343e\003\376r\236\302c\317\021o\337\363\b\236+c'\372\026\352\271A\212k6\271A\372\240\n\201\213\322\224\005\244\027\241\005\325QFH\222\023}\b\365\036\324gP\231\nW\341\245\021_\301\261S\204"
+	.ascii	"\344q\222\347\316\211\276\202\212`J/}\200z6J\271\311F\351Uu\210"
+	.ascii	"\213\322\223\005\244G\\\224\376rQ\252\262\200\224\303N\006c\261"
+	.ascii	"s\030Cy\204\245\007\025"
+	.string	"\033\254\373r\030\332Md^\020\200yA\356\013\027q,E\177\252\347\317d\370g-\270\237\255\374\247\363\337\315\377\265\377i\376\227\371\017\366?\375O\346?\332l6\233\377\241~\356\375\2714J\342\017\265\230<\266i\311\343P\253$\036\333\342\326\221\b\211\204\b2\206\232\232\022\216\323\026\273\306\025\222h\034b\2667\331l\335\274|\321F\006\335\310\244\221\215\270\203\315\254\2305\254\262\020\223|\273\333\300\225\025\220d\027\231\355W\262\373\313\252D_M`/\263\2150\223\r\202l\032/\272\017\\u\263\334\314\356f\273\273\307\210\274\335<\206\332\256\253\253\356\254\002W\215d\271\274\350>\227m\314\216\255\022Hr\307\245\212\262\253a\\\226\273\232m\313\250*Y)M\243\273y\216\332u\274!\347D\1776\363s\024\276\\\006\327\322H\366\262\373\022\245`\262\322`\234h\332-\220K+.\361:\3213\227z\tYxK"
+	.ascii	"\\\267VX\327\022\026&cf\026\205'b,\205\321\270\013\203af\021"
+	.ascii	"\013`\313\267\356\373\237\305p\030\036\303dx\311h\\v6c.\017\214"
+	.ascii	"\224\242g\022\266\263\261\033\265\273\233]\250\2130^D\334\316"
+	.ascii	"n\370\312\305\201\247\r\310\354\r\213\253\255MP\034\"<\316\322"
+	.ascii	"n\220X\221\267\264\023e\303e\377/\324\366U\345\002Y\263\206\327"
+	.ascii	"\324\253\300\315\206X\023\365\007;\203\370:\347\265\234\332W"
+	.ascii	"\022\262\023\375\211\245\236\3170\363\214f\311h8\rg5\316\255"
+	.ascii	"\314\206\230\235\316B\"\001q\311\211\"D\355\234\346o\202\272"
+	.ascii	"\301\272;\001j\304-G\333\211\276\016\207\375\367\t\222\201\345"
+	.ascii	"EK\215\372\247M4v7V\356\266\321*(\345\0343\322\017\200q"
+	.string	"\314\240\373Fn\335>\220\320Q\275\312\210=N\364\377Q\277I7K\324\267\215\255r\213m\251\250\035\211n\377 \320\312 \335\336\255#\232d\317\276\315]\334:\246ho\322\330\336$;\324\305$\333}\217C\355\222\310r\253\334:\266\312\344\221\250\213\315v/\241\264\001J\303\007\335p\355\005\243\206GC^\004\t&\244\200'\236\326 \360\351\203\320\320\367\323\360\263\236\350\365\200PCg@\265\256\027P\254C!\013\341\317\245|\301\365\267\366\324O`z\300\324\264\242\347MN\020\234 \244or\332\355\234\230v\352\231v\270\341K(U\255S<]\217\n\301\201TkP7\004\002\203:\240!\217i\247\262\220\372\255*R\254A\022>B^\317G\342\007|\252Z1\020\ry=\275((\240/7\265\016\203k\325O\203\320\3673\3445\r\177>\025=\337\355\236\216@p\310\240J)\005W\252u\035\301\233\372\251"
+	.string	"\nu\302\340Z\345\013N\351~\276(\024:\251\240P\247\264\340\347\213\nb\370\255T\035\204>\240\023@\340\005^\016\316y\311p\230\016z\373\230Ri\242C\313N\033\321\034\340\356\214\031rv\242\034\207\345\360\022\211\347\234\337X\312}\212\267\225\335W\310gm\216\217\245\230zFJ\205\002Z\250q$g\220EL \"\022\214\214\004I\n=\200\002\021\261+z\021\320\271:\221Z\220B\233\001\307{\343v\021s\223\343A\211q\275\275T\2230\023Ah\023LN\200\214"
+	.string	"\234c\205|\005?%\r\231\f\203\335\020%% H\340\0216\340\254\334\020mAj\274'[\214\341\022(q^\300\230F\030\271\234\320\204bE\226\262-\362\377\206\2629<5\330\346\212\262MZH}\334\206\270\374\002+v\254\254\203\205\253\222\033\331\226\f\264\335\246\211YBP\301\224\254\036\357!"
+	.ascii	"\325\022\365MHnc\331TIK$\375\225\306gJ\200|f\230?\377\330\253"
+	.ascii	"\271+\376\331Z\020\337\226,9\340\330~\365\007\002Rt\007d\323"
+	.ascii	"\362j\375\375\021\333\334\375\245\001"
+	.text
+	.section	.gnu.lto_.symtab.4ccc8737541e75e0,"e",@progbits
+	.string	"systemBeep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"systemBeepToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"beeperInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4ccc8737541e75e0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,255 @@
+	.file	"stack_check.c"
+	.section	.gnu.lto_.profile.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\003"
+	.string	"\302\252\341\340\002"
+	.string	"\002\004\240\342\234\212\n"
+	.string	"\002"
+	.string	"*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	"\003\002"
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 VE\001"
+	.string	"\270J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\006"
+	.string	"G9\354\f\260\031\356\315\3410\257\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.d76f4655451e3d7a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stackTotalSize.10.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001'\243*\310\251\272.\250\233Q\260\021O\350\255\207\242\225\337\"1\315f)\177\363\036kc'Gff\331\251\365\214E\237\204\250\326m\333[\312\224\002\2260\033iJ\220\0166R\206cE\253\232\0344\025B\\\320d\024\242TY\0213`\212a\252\"\207\242\252h\341\366o5d\275d\n\341k\352M\376q\021T\354f\327|\217s\r\276\305\241\037\256\274v\350_\321\341\365\237\224,;\233\363\244N\330\177\253!\333\351\314\364_\005T\"\320\355Ft(K\002G.lwl\213\257\361\215\216\261\307Ul\021H\307'\344d\227\213\227\007D\207\357"
+	.string	"\321\241R\034{b\3769\3762$D\264\315\363\254\030\354\256S\333@\267\336v\201\355h\033#\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_stackHighMem.11.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001'\223\003\202\234\252\275x%|eD\177\336V\347@Q\225\325\020\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2360\233\211J\230\0166S\206s\305\313\242\0344\026B\\\320d\024\342d]\0213\340\212\201\262\"\247\252\254h\351\366o5d\275h\n\341k\352I\336\201\021\210v\265o>\307\273\006\277\342\320\017X~;\3641\351\360\372O\212\226#\273\363\244N\330\177\253!\333\351\314\364_\0054\"P\262\0331BY\021\030ba\273c[\374\214kt\234\275N\304I\036 \237\217\223\335.^\036 \035\276\003H\207J\361\354\231\371\337\370\303"
+	.string	"\231l\234\347Y1\330]\347\306I\334z\333\005\266\243\355\213\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 M\335\001"
+	.string	"\004\003I"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\f\001 \013\177\002\r\003\005\003\004\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" \300\340G\204\245\236"
+	.text
+	.section	.gnu.lto_.refs.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\001\002\002\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d76f4655451e3d7a,"e",@progbits
+	.string	"(\265/\375`\203\003\245\033"
+	.string	"\206\266\276J\260\226q\306\324\2548\336:Rp\276\340"
+	.string	"\360\311\321z@\325"
+	.string	"Jg\267\217\\\373\216-\275\375\2265\3538\230\267}\372\013\261\f\032\330\rbf\375\3027\367ZJ`\247\271\354\361[\002\347d\307\357\224\232+K\237\024\002\277\225)\230"
+	.string	"\236"
+	.string	"\262"
+	.ascii	"?Oa~\337\232N\235CW\270\033\n\355\202\347z\331\377\bz\273\242"
+	.ascii	"\365\274!\032c\375c\354t~\032\223\035\336\305\035\232+|\017\372"
+	.ascii	"\371\023\234\375{\277y?\374o\376_I}\354o\242\005=\352\365~\242"
+	.ascii	"\003\275\373L\037?\377\n\230D\250\242m\321\032\363\341\324\036"
+	.ascii	"\035\2105/\032\264\376\350S\277\224l\315\245\007\375\277M\310"
+	.ascii	"#\265\004\223\225(\204Ba\373\t\210m\f\255\355\321\276=\333Q\266"
+	.ascii	"\205\266\241l\007m;\331V\261=\3046\253\252\252\252\312v\006\333"
+	.ascii	"Kl\026L\342-0:\003\351\373\032[\3675\032\207w\212\3745\226\221"
+	.ascii	"^@ze\217?\323\377$T\330\247;\026_\225{_\366\200\313\2720\266"
+	.ascii	"\305\263Z\354M$'$\214\036\347\211\225h\333\345\266}9\374\247"
+	.ascii	"z\366\251\313%"
+	.string	"\242\375\251?\323\320\333\025w\275\375\375\274\365\253\363\354\325\226\363~*\311\236KPvM]g\317\364\274\325\274\377\245(\3604]h\3733](\373S\317\273yQ\036\323Q\336\252\272\220\330_\212\266\247\332\202\266?\365HG\021\"/(\357B=\337\231\266\fQv\375\324\177\201\001R\244X\374X\022\n\237\002\370\242\340\b\242\001\005u\235\310\377&\373\021c\216' \251\253\204\242GV\242\257\021i_\240\322\005\336\340e\372\210Y\020H\212\352'b\300\002\364\223\302h%^\036\367\3117xwx\246\306,\223\351IA\232\365?o\2605\345?[\367\276\334\373\"\326(z\301c\024}[\220\276C\244\257\215\233\344{C\351\336\270NW\346;#*`KPt\300\240:\221\357\325\022\0061R\237\370:\33135\267\211\345O\372\257\200\225d\306\360\305J\274\354]\272J\257\313\344\233\343\266\006\300c\337\376l\013"
+	.string	"\222&(\200+\321\345\032\030\003\326\211\231`A\002\016LW\346\344j\272\035\033n\303M\231\303\335\360\224:\037\0208\255\222\266\302SR\320\311\271E`\311\325tl\"\r\207\326s\243@k\371\3058\016e\016\246\303\341r0\001:\332\214\003]\317\255\003\351X\354\306\345B\005\b\244-f\307V\352\330h0\237\\\351\341\226\323"
+	.ascii	"\353\271\325x`\266\234\017,\306\245\fq\303\331P\323\341,\354"
+	.ascii	"\330j:\037\002\266\335reO\231C\232F\326@f\363a\30563\231\231"
+	.ascii	"\314h\233Y,6\223\305H\313b\254 \366\375q\201\334 \013\370\263"
+	.ascii	"\256\0072N(Y\211f\257\201\221\274\005\242|\225n\324m\022\331"
+	.ascii	"\253c\023\222P\024\325S!\fX\0010 `\002\021BW\036W\346y\202\227"
+	.ascii	"\324\220\211\024\355\270\370\001\277\020~\244T\314\340_\317/"
+	.ascii	"\026\026k\255\2226f\345\353r\214N`\273\312-\206'4\340\226E\244"
+	.ascii	"N\341\323\003\220i\3615\214\360\220D\t\tD1%f\301\326/\314\333"
+	.ascii	"2\231\205BM\030\003\035\323\020a>e \3254\306=T^\262\003\273\227"
+	.ascii	"\336\334\274q\355\257\300\261\243\030\215z\351t\016\327@\001"
+	.text
+	.section	.gnu.lto_.symtab.d76f4655451e3d7a,"e",@progbits
+	.string	"stackTotalSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d76f4655451e3d7a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
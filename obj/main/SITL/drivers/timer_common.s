@@ -0,0 +1,244 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 )\r\001"
+	.string	"\310\035"
+	.string	"\004"
+	.string	"\317\253\250\341\002"
+	.string	"\001\002\267\335\335\337\n"
+	.string	"\003\240\342\234\212\n"
+	.string	"\002"
+	.string	"*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 '\355"
+	.string	""
+	.string	"\230\033"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\002"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\003"
+	.ascii	" `\225q6\200\005"
+	.text
+	.section	.gnu.lto_.inline.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 '\345"
+	.string	""
+	.string	"\220\033"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002\002"
+	.string	"\003"
+	.ascii	"2\005V\031g\003X"
+	.text
+	.section	.gnu.lto_.pureconst.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 0\325"
+	.string	""
+	.string	"p$"
+	.string	"\003"
+	.string	"\001\002"
+	.string	"\001\002\002\002\002"
+	.string	""
+	.string	"\004"
+	.ascii	" \223\313\276 \353\r`\001"
+	.text
+	.section	.gnu.lto_.lto.45ce0eae2825e3a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerIndexByTag.4.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"B\214-3pM\322\030\240`\260\026J\370t\026\362 1p \304ml\250\232nv_\304\355\200\335+\263'd\005\250*\264\212\021\030\373\312\2528xY\223\270\267L\001\022\230\007\350\242\251)\003\337\203\024D\254\236\3334M\254(\\\214h\031\207y\215\212\2326\035\f'\252\3306\020\306&\315U\031``\301<?;\213m\274\002,\323\370E\220R\200\262\013ja\331\223\310\304\343\327\237\363\322\317\226\202T\314v3HJv\247\302\013\003\032\375_\0308K\235\035\240\313\307\305\310\312\356l\214C\245.\271j\210\"\210\250|B\035]\002\016\273\373\372\2040t\246\177\302\337\360{\002\b"
+	.ascii	"2\003\202\341\243\302Z\025\220k\370\346\020Oz\036\354\264\363"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_timerGetByTag.5.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 \371\325\006"
+	.string	"BM03`m\322\030@\203\300\260K\232\210\330\232\303J\242C8\270\n\216Z=l:\325\354\r\266\271\370\221\264\202PQ\261\235\243&BLJ\3173j\203\375\367\226)\020\231\006X\271'\214\006Z\026\234\034\"eU\235\307\211TD\025\037\236\246\312Xo\212\234\2071\030n\250\370:\020\306g\231\023*%\326>??\254e\274\002l\303x\035\251j\363\200@.#\273\025)(k\342D8\376\353-\177c\237\240p\351\310s\333\275(\t\331\235\007#T\324\375k\207z\\K\202\271!\332\220\200>Nv\347{\352ERW\321\001I]\323\220L*\223\253@HBY"
+	.string	"\303\356\316(B\"\275\351_\360/\374\026\001\b"
+	.ascii	"2\003\202a\243\302n\025\216k8\003\013\207\334\020\346^%\017"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.6.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\305\007"
+	.string	"R\01776`m\322\001\310\017\340\374@\021\256[zD\300\241\031\334\275\347\364ui\b\277\247\337\356F\302\233\032m\004%\210*2+H\024\273g\032qpl\343\206\310&{\247\024\022\263\223]\321S90LO\265A\\li2\r\3034\253\201N\354\372\310\215\316\210\213vdvU\230\264\350&5\006\326\036&\225\037M\243\022S\367\035\365`\310\256\240\0075\354O\273\273\206\031\366\353\017_\372\337\224pQp\262;ZI\331\2228\322a\233\2631\266\247\367:q\201\r\231\210\026,\217~\317\376\307A\270\227(|\331\305 \021\331\255\007F\260<fN@=N\037\240\036m{\243\300\271{\345\030mT*BPv\253\204\033\335\353\376:?\200\004\372\003\340\354\256\237\210dq\303\333\316\330\346\330\366\b\t"
+	.ascii	"2\003\202a\243\302~\025\016]S\020\026\322\bW6@M\274Wq\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 W\255\001"
+	.string	"\244\002S"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\005\177\004\006\177\005\005\003\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.45ce0eae2825e3a,"e",@progbits
+	.string	"(\265/\375`\233\006\225)"
+	.string	"\nL\340\020Hp\236\316p\343\343p\304X\003\002[\254X\246\n;\366\016W\365\262Te\344\202\002\232A\301\274\231)\222)&\370\264\016\230x\3039B\342b\242\367\340W\351\\4&\3631Sc$\033\270\3002Q\364b6\2337\3312\005\342"
+	.string	"\356"
+	.string	""
+	.string	"\001E\334\356\"TNM\204\300\276\313\356\301K6\307\261\255\252\272\013\364\333M\354f\271\227\335\315v\367\256x|\273g\364\332,\"\261;\006\020\261\217\254\224\252nS\t\206\314\330&\221\256O\212W2\253S\274,\267Vngu\033V1M\262M\332\252\273\371L\232el\361f\236\312\2357H\336\310\231\347+\260\227\211D\013H\232y\336(\345&\314\305[\334\365\263\023N\376\344r;\331\375\356\350\204/\324\306\3143\210\177\320\223}\320\263\020\312c!\224\225\260\026o!`&/2\272\216\345j\255\356\227w\276P\323\001\304<\337 \365\021\266\321\315\364\214"
+	.ascii	"\3459F\200\256\341\374\274$\216\310\177\245\363\347\032\377\331"
+	.ascii	"\376\257\375G\373/\366_\371\337\353?\223\377\273\377i\377\317"
+	.ascii	"\271\271\271\271\377\353\317&~\234\033\001\3470\336\3420\026"
+	.ascii	"{O\330M\325mC\006\017\333\030\030\214\270\216q\024\332\201}a"
+	.ascii	"\2612\243\234\305\376\"#\376\n\320\255\325\335\007v\330\270\361"
+	.ascii	"\001g\236\207\343\367\177\016\352\345\355G\016\363\274Tz\363"
+	.ascii	"G[X\354n\0268o\027\251\002\240?\237q\230\205\376\035\326\261"
+	.ascii	"\202\326\361\264u_\361@\223\022\031\023\3220\317\377A\375\377"
+	.ascii	"|\244\233\355\351\267\213m\022\213m\273\330\214=o\343\030\320"
+	.ascii	"\311\034\335\276X\306\323e\315~\233{\210e\034\321\276n\261}]"
+	.ascii	"\266\327C\227\355~\215\275V)d\271Mb\031\333\244k\354\351a\263"
+	.ascii	"\235\024\342H\207\256\261\305\342\032{mR"
+	.string	"hl\207X\306\036\"\017\244\222\026\f\227\f\316\322\016\373\212x\024\026{\313\366u\273\255\233\225U]T\320}t\213mB\030LF\265\274\242\n\023\272\374v7\001\"\025\322\355\341\262\rn<\345\367\275\361\027~yv\310\260\027l\342\272\3374\f\307j\370\f\243\341-~c\263s\031v;\320\333=\354\356\005@9i\310,p\001\316\233g)\003\221\031\303cL\\P1O\026\243c%d\212\021,\rs\276\022\202\"\315+\275\311\225\336L\222^\311?\350\315 \351\227\374\203\366\330g\311[\274d\266\363m#\332u\204\205V\\\027\2550\320\311]\331af\236B\234%g\370v2\247\313\231\032J\363\274\211\"=\303\245\245\361Z\372\366\212\"7*\266xe\312\302\216j\347\265W\207\310\f6\034\346\311X\370\t\317EQ\356\370\205\203L#flIv2F\343\030\021\334\320\334\270M\013\271C\312\031\315\n"
+	.string	"-i\3362+?\227\361\024\256\242k\255\334Vv\277=<\313\256$F\314\363\354\345\235]1K#K\251\260\331\333\rt\252\265)c{\323\277\374\203\246\354\203\362\220\364\f\306P\002w\0322\260N\211X\247\200\350\007\225\202*\342\204\322\222\006\fJ:PO\253\256\351\267\352B\250QQ?'\246\235\324\024\200;\reP\302\300\201hU\233\202\2775h]*z\220\202`\002\206\230\240\006\201\023\240\324U\352\004\007\236\200UjI\r\376Jx\b\376.\254\252\205\235+8P\204\032$Z\201\300 \221N\323O\351\204\004\023\252\207(\f\2743=\005\325(\265)=\204\243\006GH&vGJr\220\344"
+	.string	"=R\222\317\227t\344K\177\344\323\255KHk\324\323\324N]j\372\205\250\2406\375\244:\364\326\245\246\237\022\360iw\237oBP\207\r\026R\246\241( \024\024\220i)\250B=\255DRA\225\304S\320\003Q\324\323\017\212\210)(E4\224`M\034*\fs\304\213y\236\275C\2341r\256\032\363<{i\343/\036\266\327TZ\242d\361\0263\374\245{\263vO\220c\\~\337\033w\341'\272&\305\024\212\023\261\007\277\357\215\3010\031\244\252b\216\n'P\002p\250q4g\0205\023\310\220\310\004I\332\246\r\200\002\221\261\253\016\021p=\203L[X\310\260\377\006^$P\t\030\274\0168\310\005G)<\214\373\261\314;i\0011#\021\004"
+	.string	"\260\020(w!\351d0\237F\376\365\016/G M\252r\231\227x\020y}\207\375:\t\257\222\205\r\374C\233\367\005\261\322\t\261\244]\2747\211i\203\356\334wX\316\0322\321\336\320]\002\306\271b\227&\373j\373\265\354\2073,\206\240\312_Y\307\333\323\364\013o\272\262\330;\024\034\254\202"
+	.ascii	"\357\305pR\357ts\f\327\225\276\240\210 \361=\341\321\027\344"
+	.ascii	"@\364\033\224\017?X3e\253\302\253,\345\3433\231\021\204\300\334"
+	.ascii	"\b\227\b\210P$\317*\272R\230\361>\t@]\332\331\212L%\206\001\335"
+	.ascii	"\234\251\215g\267\022j\274\343\230\232\347Tn\302\266\367\005"
+	.ascii	"\331\323\\b\215\257\355\355\237\236\032"
+	.text
+	.section	.gnu.lto_.symtab.45ce0eae2825e3a,"e",@progbits
+	.string	"timerIndexByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"timerGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.45ce0eae2825e3a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,192 @@
+	.file	"dsp.c"
+	.section	.gnu.lto_.profile.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 =\305"
+	.string	""
+	.string	"p1"
+	.string	"\001"
+	.string	"\226\256\311\266\006\024\002"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"@\210\234C0\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 \035\205"
+	.string	""
+	.string	"@\021"
+	.string	"\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\300\220\r`\001"
+	.text
+	.section	.gnu.lto_.inline.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"$\0035"
+	.string	"\001"
+	.string	""
+	.string	"!\260\227\272\355\003j\001"
+	.string	"\001\001\001\002\002"
+	.string	""
+	.string	""
+	.string	"\002<\260\227\272\351\003j"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\001\004"
+	.string	"c"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\204)\312\006\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 \035\315"
+	.string	""
+	.string	"\230\021"
+	.string	"\001"
+	.string	"\003\001\001\001?\177\002\001\177\002\002\177\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 ;e\001"
+	.string	"\360/"
+	.string	"\001"
+	.string	"\003\020\274\006\274\004"
+	.string	""
+	.string	""
+	.string	"\002\002\002"
+	.string	"\001"
+	.string	"\002\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	" \200\225\301 \264\335]\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.e3aa48bb1c02650a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_arm_bitreversal_32.0.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375`}\004\275\034"
+	.string	"\326\365\270J\260\324Q:y\004\232g{\035$\265\233\245\203\362\324\321\370)\f\316\366\034\207\241'\260\355\203cDc\00768\357\007g\326\013\244a\025\320\317\266N\315\317\321\312_?S\221A\255\2337\023j\321p\037\366\332o\204\020B\344N)\241"
+	.string	"\226"
+	.string	"\252"
+	.ascii	"\227\362}\312Xc\225r\340\344\224Uk\3559i\b\347I\333x\230\355"
+	.ascii	"\021\312\003\355\245\216\340\361B\301\022\257\303\367\035 L\326"
+	.ascii	"\252\002\313U\255P>Fp\236|\241\247\366\235\216\303\367\247\020"
+	.ascii	"\207\251\225\205\217\253Z\211>6p\2364\3613\345\311\363\263\362"
+	.ascii	"\244}\366\024\032R\354\206\260\210\245\326\212\333\026\246\265"
+	.ascii	"~$\336#\365\235\034\227\372\374\342\351\211\250\244\241\210\223"
+	.ascii	"\243\211D\"\206l\2104&\320\312\022\2424\004\322\221\206\211\357"
+	.ascii	"\251N\207<I\032\23285\027\324ZM\223\206%\356\362\266w\266+\330"
+	.ascii	"c\214\267[\3359\277\272q\016\365\333\276\343'\360\251\273\266"
+	.ascii	"\3247/j\233S\0070\251i&u\315\213\232\346\3243&\265\214I={Q\307"
+	.ascii	"\274\250aN\375bR\273\230\324\262S\0030\251c&5\354\244~\235\324"
+	.ascii	"\256\221\372tQ\233.\352\362\244&O\352q\244^\223\232\232\324\357"
+	.ascii	"\201\005gJj%\261%K]B\n\221\361\252\337\352\277\372\247>\332\267"
+	.ascii	"\357\303\377q \017b\330\325\221\315U\353\n\0343(X\035e=M8\253"
+	.ascii	"zD\244\262j%J8\337\303\2472\354\244\037\025M\236\004\227t0\024"
+	.ascii	"`\262\201\002feP\350\217\244*?#\030z0.{\333\227\"\227\255\313"
+	.ascii	"keKZ\001"
+	.string	"\"\334\372\031\311\320\033\340\"DyRg)Vlo\013`\204ml\037l\202\255\t\025\365\332\034\254\273\366\265e\261\310e\256m\317\347x\271&\202\177\313\205\001\257\004\227\310\305\331-\n\267~X\345\270\344\222N\202[>\221\017 N\030\276\207\362J)~k\333\335\007k\320\373H\371\245\373`\023\220nqm\277\017\362\036 \025\341\326\217n\331\215*\2024\334e\262\211\"h\002\027ZY^\0266\317\316\253n\235?\375\001A\027\272\216\003o\211\236\333 \024\004\304@\027+\312\375t\310Y\340\021\t\271\206v\027t\243\207\016\350\2162\340~\200\"\\\300\361r\032vA<\\\021Q\020\007\334\320\356\bw@\200\215t\271\035\216gd\264\303\301\210\365\305?\240\261\344\267@r\231\354\212\262<\273Qh\317k\253T\333\233m\220d\004\3252\201\275Y\252\345c\255\265\216\313d\327\226gO\365\002Lv~|Z\330"
+	.string	"I\371\351\2356{\332\3366@\315\322vi\266\006\311s\226f\315&T\202K@\240\336\314\316^\212\314\336vf\2662K\221\004\233bv\266\027n\375\336+q6f\311[\250!@\247\0205bD2Q\n\222\2441\240\002\231*\235\003\020PfT\f\303\001l\253\001\231!\227\342\321\222+I\275\340V-\252\244M\345\346\324\037\330\221\266\221X\036\266D\354c\035\272\322cO\205\302\330\363\237s\370N\352\005KO\3059e1\fk0(@\360\0230\322\\\276\2704\220\365\b)\247.f\216c\002\354^\245\002d\027M\315\201\017\333o\345TGx1\232\200\216\030\246"
+	.ascii	"\364[\255\326\tx\020\227\025#7%\004\320[n[\007\331\315\316\251"
+	.ascii	"\325\340\261\277\rr\226\360\001\206-\2034\374S\207/\266<\272"
+	.ascii	"\276\265\266/y\235'\250"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\004\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e3aa48bb1c02650a,"e",@progbits
+	.string	"(\265/\375`\013\003\245\030"
+	.string	"&\361\251I\260Xm:p\223\034\371&-\033\216C\261\312\331t\007\250.z'\374\267\257\017\3052,-^\254\235[\320\314Z\365\223'\373\031q\355\236\302\177\363\034\233\273\302\273\276\203\357\033\207\277\304\f\006\252E{\271P\250\351\351\023\231\002\210"
+	.string	"\224"
+	.string	"\217"
+	.ascii	"/\262\372\364%\312\025\030\267\316\263\331\232\317\013A\257\352"
+	.ascii	"\223Y\325g\357\221\275=\326\307\246'R\350\374\355\257"
+	.string	"\251\027\033\212#L:o\177,\220\2557[\344\025\262FF\215\265\326\277\312\300,\305@Z\321y3[\363u*\320\033\3042P\036\301\035\350\275\371N\271\334\336|\256[\363\201;\340\263}c\233\306\366\002\333\032l/\201\261\327\206\355&\333El\033\3316b;\265\215\262\355\304v\227\313\345r\2661\330~a\237b\002D\216\270\020\255\fR\366\241Ym,gpd=/\345\337[\320K\005\177\355,\245\214D\273\024\303\r\305\222\306s\353\177\003\263\330\214\3632\034\251\343\374u\304<|\006A\254\270\333X\234H\243v\241\240\377\300\353?\373\305=\356\277\370\037@Y\253\277\213\031\3226\233\375\264\002\263\327D\246\240\277\273MY2\311t\306\0312\rIm7Q\305\265]\nZ\202\251Xt\241\377{\005\264\231*\254t\236\275IF@$*\270\023\235\267C\226\310V\325\336\274H[\304\0010\224:o\227\226I"
+	.string	"\022&!'\336\335\350\202d\324y\316\262G\266_N%X\264H\322yn\201\235\375},\377\247@\325\227\261\030/jWe\007\330\323*\260\355\375\024\200\307/\264\005\013\230Ci|\321y\266mn\334\301t\374+j\312P\242\024\231\276#\237\214fyTL\221\277\t\222\343\237\2367\311\364&L\212\212\257\250\b\326\233\227}<S\244\f5\311\0245\227L_^6\2264\344O\363)Ze\311\212\226dz\232)\362\210\213\031N\340\237\020\256\327\n\366\363\363Z\301\340<h}\330\001z\271F\270^\260\236\r-\020\257\035\032\363\364\274\\>\256\016\240!\260\030\260rH"
+	.string	"p\216\216\003\035\007\237st\302P\207\025\202f\205'X\013\347\001\254\305\na>=\"@\207\241\004\233\f\026&\200<\rB"
+	.string	"qXU\300@\341\302\n\346\352\360\332\201\255|zv@\254x^@\253\006\b\\S\002\264\035C\235\347=\262H\274Ju\225\266ii\027\265\b(\312\231X\262\3454\232\n\225&\325\214\224x\233l\234\b\246\022\363\373\370\217 \246K\215&\270\316\333$\233\204\302\261\"* P\202A\006\211z\311O\216@\\P\315:v\230\251I\272\\\360\n\r\020\311r\314\310\340\231\212rD\314\214\034;\035\3133\021\f\204\300"
+	.string	"\370\217\002\351\241\230l@\314\024H]=m[\331\372\314\256"
+	.ascii	"\332Y\302r\243\265cav\366iq\263\030;`\324*[\242\271\035wk\320"
+	.ascii	" Y\364$\366\031\366/\304\233\200z\246\240"
+	.text
+	.section	.gnu.lto_.symtab.e3aa48bb1c02650a,"e",@progbits
+	.string	"arm_bitreversal_32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e3aa48bb1c02650a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,603 @@
+	.file	"board_info.c"
+	.section	.gnu.lto_.profile.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \357\355\004"
+	.string	"\364\006\343"
+	.string	"\027"
+	.string	"\273\212\353\205\002\004\002"
+	.string	"\001\240\342\234\212\n\003\317\365\212\237\003"
+	.string	"\004\005\246\231\223\357\n"
+	.string	"\006\007\344\333\361S\b\225\325\244\224\r\b\002\001\002\002\002\003\002\003\t\352\263\360\321\b\n\013\231\300\241\373\t\002\f\342\217\301\202\r\006\r\222\222\3753"
+	.string	"\016\017\233\246\366\244\b\020\240\243\304\256\017\021\022\262\321\251\007\023\024\025\026\027\240\342\234\212\n"
+	.string	"\023"
+	.string	"I\025\001\373\3002\252\232\300)\024,s5\310\004\201)\26766"
+	.string	"\230\214\3170)\327X!5\252z\340b\230M\3450\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \236\255\002"
+	.string	"\002\004\r\026\240E\303\001\217\256\252\252\252\352\250\031\341\226VZ#\267\244\245-S\"\367q\266Y\006\271\313\"\246l\262\310\036\306\334b\252\227\204A\003\300>\251\334\323e \f"
+	.string	"<\217\024s(\341e\026\236\316\022C%\214\334\020\240\002\234\363\211\212\r\2346m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\365\001\225\006"
+	.ascii	"\242H\036(p\305I\007\034B\252\272\246&\f A\360\202(\006\031\300"
+	.ascii	"\037af\325QUU\225\275\243\370\305\277\231\231\231!j{\223\024"
+	.ascii	"[\035\242:\374G\310q\224\210\263\201\372\332\336/%\226\370\270"
+	.ascii	"p\223\347B2\023\006X>e\020nm\237\245\004\342\277\005J\332NG\320"
+	.ascii	"\323\260\322\266R\244\003\022`\261v\232\300\177mO\f\243m\343"
+	.ascii	"\265\354r\304\004\237\241\203\377\262l\333\346\251\021 & \260"
+	.ascii	"\"\nn\370DC\362\271\2772/&Rx\"\rn\023\334D[\020\245\2740j\313"
+	.ascii	"\267j\224\213`\234\223w#\201\221\tN\025\356\036\246q\007\026"
+	.ascii	"_\020\336\343e\376K/\002\0368\f\032\203K$ \341F\017\303j\261"
+	.ascii	"h\2129\337u\331\006-\232\t\265Pn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`;\001]\006"
+	.string	"b\311\035&\200K\322\00130\375\033-\366\005\027\211\215\r\315\252-f7`\006\246\241\200W\004F4\261\331\322\026\t\331d\313\024\377\n)\361\356\021\377aB\303\027\236\360\203_0\310\361y\004R\323\251\007\262\330\024/\247U\344^\226L\260\2262F\017\265\262\365G\022\276Z\200s\315\264\230b\247D\354\314V\032\336_\276R\255\245\032\366\207Y\335\254:\303\325\022\213\355\372\247\261\021# \240\302\242\264\003\230\242L\360}\315\002\027\t\227\031\312\315n5\244X,5:\034\021\321A\037\n\330Vl8B\005\273\2021\210+\031\257\242\213\024\f\256M"
+	.ascii	"\301\30011\t\b\2031\212\353$\302u\003)\256\357\220Bd0\342\205"
+	.ascii	"`\214.\234\033"
+	.text
+	.section	.gnu.lto_.pureconst.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\003\230\004\005\230\004\007\232\004\b\230\004\013\230"
+	.ascii	"\004\f\232\004\r\200\004\016\200\004\017\204\004\020\230\004"
+	.ascii	"\021\230\004\022\230\004\023\200\004\024\204\004\025\230\004"
+	.ascii	"\026\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \351=\003"
+	.string	"\244\003\325"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\f\003"
+	.string	"0\005"
+	.string	"0\007\001T"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\200\002\200\002\001\001\002\020\002\021\2140\013\260\300\001\017"
+	.string	""
+	.string	""
+	.string	"\020\021\022\024\025\026"
+	.string	"\0071cO313"
+	.string	"\023"
+	.ascii	"`\0260\037\230\031\230\005\314W\363\002\bT\024\0011\007\365\034"
+	.ascii	"\200\253\031\240\002\354\002\357\f#+\302u\231\203<@\036\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.4daa2a444d0b5d90,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initBoardInformation.14.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\344\001\235\017"
+	.string	"\266\232aF"
+	.string	"\261&\035xbt\317\036\370\317\353\2656\344%\375\362\366\252>\370:\241\025|.\365\204\214\234\225\372\233\021\003\336\031\270\312%\002\026\303\260F\226\032\333\020[\372\357\270\202h\324a\362\242\253w\245\364\310\222\275\245L)L"
+	.string	"H"
+	.string	"P"
+	.ascii	"\366C\274\262q\b\210\001\300#\203\202\307\356nj\363\325\265\b"
+	.ascii	"5W\276\350\004\304\373X\327><<\216|/X\262\2731\t;\\!\002 \231"
+	.ascii	"\216\221\317\005\003\314\340x'\361\334\360\2652E'\273\353\364"
+	.ascii	">\016\267\350\266S\266\017\330\251 =^P\367\002\3325\3652/Z\306"
+	.ascii	"p\235\226\217]W\002\337\304s\\\374\233Gkx\311{\217\376\213\366"
+	.ascii	"x\225`3\"\247\313!\033\326J\255\261\017Wi\354L\307\247a\246\363"
+	.ascii	"\351\213\210\274F9vg\206z\354,\372\200p\017\f\270 \311\356\003"
+	.ascii	"!\002\211$\202$\341'h~OJ\2628O\251\344\276Q\342+P\243\032\273"
+	.ascii	"\335=?\305U\230N(\224\366h\247,\344=\237B\314^\312\372\007!\240"
+	.ascii	"\026j\030-\3651\235\035\033\256\024r\252\037\373\016\214\177"
+	.ascii	"\343\025\216\323\03656\231p*,\251\224\n\252\022Ga3\251l,\251"
+	.ascii	"\322\312fR\265l&\003\314]8\251\266\f\034\247\332B`\335\341\225"
+	.ascii	"&\312f\235\2664\002i\243,Pee\324\232\023\217\372\330\216H\203"
+	.ascii	"\001\227?^\320a\207\032\033|\206\f\027\250(8\220$G1\034\374\034"
+	.ascii	"F0 \300\002\0311\272\003#\310c\340\267\276\027B\027Jk\"w&\f\303"
+	.ascii	"\234\303\261\034\265vA2\337Pp\017\2406|\261\203\214\352\213\264"
+	.ascii	"\215\202\277\350\271\026\254\020\007\312\230Yxj\237\272\022\026"
+	.ascii	"G\256\022\226\201\003[\310@\303@+V}\r_]\212;!\346\332&\214O\307"
+	.ascii	"\222\257!\246\331\215\032\245\230!{9\307\230RT("
+	.text
+	.section	.gnu.lto_getManufacturerId.15.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \360\265\006"
+	.string	"\242\f/5@o\222\016\230\016$\234\3520\025\035\347\002k\022\300\362\362s\006\330\246\372\177\263S\246U\264\300B\217\233\261g\030\035H#\032F\037\037(\263\364\353&\226\020\231\002S\233\252\363\3614<X\234\312\001R\035\370\361p\" eM\300\215\301\225\004\204\005)\252\312\202\232\230u\245'\2712\231\242fw\244\261\342z\364mq\265f}\367\232\372\016D\356\342c\250\271\215/&]\351["
+	.string	"\nAJf\306\213K\252\274\223\217\037\364\232\013\322\020\320XA\354 -\260`\224\264dFx\354\300\324\227\251\300\324\3478\212\265a\267\"E0Y\311F\2416"
+	.string	"\206\314\274e#Rw\375\023~\205_#\b"
+	.ascii	"2\003\336::U\b\3055\321\031!\260\020y\270+\235v\222\001"
+	.text
+	.section	.gnu.lto_getBoardName.16.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \360\255\006"
+	.string	"\242\314.4Pm\222\016$\2233\2324\2306\324 {K;\315\255*\200W_,[\273\333Z\325\372\246\342\332\021\333\200\231Y\236\250uC\032\265/ \323\373\243\211%D\246S\232\212\343\3514<X\233\312\001R\034\350\351l\" eM@\215\301\225\004\204\005)\252\312\202\231\230u\244/\2710\231\241f\227\244\261\342~\364mq\265f}\367\232\372\016B\356\342#\250\271\215\357%\035\351["
+	.string	"\007A)3\243\205%S\036\n\310\377\371\314\r\251\310g\254 z\214\026T0LV2#<v`\352\303T`\352s\035\305\332\260\333\221\"\224N2\021\250\r\200!3o\231h\324]\377\204_\341\327\b\b"
+	.ascii	"2\003\336::U\b\3055\321\031!\260\020y\270+\235v\222\001"
+	.text
+	.section	.gnu.lto_boardInformationIsSet.17.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\262\013,3@o\222\016\240\n\021\220\357B\260\252\361\"\013@\023\231\0020o\252\217\255\335\354\025ZA\331%Z\337\214=\303\350\002\360\245a\364\361\b\363\203J\323{\313\024S\231\266\351p\036\"*M\203`\324\206u8\232\tFU\025,sp\243\220\250\230Ek\025\303\214\262\037\"\204\020\343[R\023\353\212|\341\271^\235\256'\240\323\341\200G\350J?\002\035\202|\001\022?\376\373\220\240\245\200%\223\243DJ\225)e\344\377<f\206\206\317\226A\006\256\2204N^2G\fCj\365\254[\222&\240\270\\\"PO\300!3\277K\324\321\261\277\302\277\360o\004\b"
+	.ascii	"2\003\3020\021\341j\327D\267\b\214\204\310\343nt\332I\006"
+	.text
+	.section	.gnu.lto_setManufacturerId.18.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"-\013"
+	.string	"\026\226O?0O\\8D\b\314J\202\341A\022\213B=\"\364FP\025\216g\356\325A\262\271\215\336?\375\267\306>S\370\216\025\367=\353R\356a$E0\315\332\366:\225\030D\362\221\002OO\233H\231R?"
+	.string	";"
+	.string	"<"
+	.string	"v\201\003\"\203\037U\247o\220\020a\304\307\356\250i\207\203\2674A\037C\034\335\312.\\\255\212\307\t\027\022\321dQN\036\302o<+\210\245\314\310ew\235\241h\341\276n;\201m\004\366\007\004\273\326\224}\215\037sZ\323\317\fh\370h\021 \305\356)\344\305\252\270P|\260-\262%\2663\355\203x\206\350\032\020>\331M\225\350\330\035\t\270\222\375\362x\n\366+;"
+	.string	"\354\227\035\252\276\220\264dE\022S\273\363\311\207\251\226\216\256\002\361\350P\203\330\025\303\301\302\224 \366C\\\004\350\257\f\n\345\303_~\b\373u\305@a\225!\003E\312\020{\034\245r\260o\355\006\231\005\237\346\373x\270m\363\3516\006 M71g\3616\035\247A\346\333<\214\306m\264\216\2639\320\270\257\243Y\004\330{\240\3714\217\347}\232d\334k\312\337\270\202\025(\022&\362\034\267\246\252N\260\035\r"
+	.ascii	"]\b8N\307\243a\257\241\332\002)$\342\222\216x\214&\374\\f\314"
+	.ascii	"OH\020c\261\245i\032\230\202\002"
+	.text
+	.section	.gnu.lto_setBoardName.19.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\355\n"
+	.string	"\306\225M< O]8P\205\3226\241\022\260\266.\254\230G\220\032\030\211\225\217Ns/J]X\034\2771\345\316\031U\262\255E;B\200\2108u \310/,\026\264\016\220\020Ctq\311\2262\245="
+	.string	"9"
+	.string	":"
+	.string	"\007$\037\203\037M\244s\320 \301Dkw\344\324\303\301c\232\240\237!\202\216m\027\256\030\204\225\002\206C\034a\017R\210\360\251g\005Q\224\331\230\354\2563\024-\334\331m'\260\215\300~\201%\373\250_sZ\323\337$\253\326\213\001.vI\257\030\273\"S!\302\366\307v\330\316\264?\342\247\317Q\021\036`\267\204Z\355\216\006\f\331\236y\374C{\266]\200\366\314\266\003\"\254\221\232\332\034\b\3710\025S\320M.\326J\rjW\212\252\305(]\366I\274\004\350\203p\307\223\017\237\371\036\355\3315\003\205\326\206\023\206P\276\354\021\224\332\301>\266\273k\r\027M\307\300\362u\236\202\316e\003\300\225\210\207\331d\032X\276\316\243p\025\f\267\311t\032\256\362q\270\b\001{\016.\037\367\300\363>\3161\356\265\344\247\276\200\305\207\023(\362\252[SU'\330V\365$\244\001\r"
+	.ascii	"]\b8N\307\243a\257\241\332\002)$\342\222\216x\214&\374\\f\314"
+	.ascii	"OH\020c\261\245i\032\230\202\002"
+	.text
+	.section	.gnu.lto_persistBoardInformation.20.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"V\221@; \345*\035\340\240\211`\252TqE\204\022\260\005\342\327`\f\342\344\343d,\203B\027\365\367\267\031\353\350\nU\214\266f,!\001\320(\344\004S\264\215\300BIF:\204\310\2262\245/"
+	.string	"/"
+	.string	"0"
+	.string	"\241\\\220{\217\253\236/"
+	.string	"\236\036\0034\276\261@\246\002`\003\252\342\300J\344\373\353\212\001\246T5\2369\247\365\0033\356\355\266\023l\023\330\206\t5;L\351~\330\217sY\266\325\253\276\006!\234\305pbs\256j\001&\313\266\342\262}\333&{c\203\003\223\275\207\255\325=\\\025&\2639\003\036\324\246bFm\211\t\375\247\273{z\213&KY{\231/\250\344E\2454\373\260\217x~\210)J\372\357\233_\312|\373r\\\270t\3006P\032\016u8\021i\264\300\320}8\220\f\211$i\364q\220\241\016Bv8\346\036\032:\031\301q\235\334\204\250/\313\177]\241\345$\206\242'\271\327\302\366\256\003\017"
+	.ascii	"[\b\230S\023\226\206i\206\025\202j\n\244\220\210\3137\342\271"
+	.ascii	"\230\360]\303\307\020\374\334\271q\315\265\bMcPP"
+	.text
+	.section	.gnu.lto_getSignature.21.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"\022\315/4Pm\222\016$\243\252\022\252z'T\236`\262\210\2725\222\272>\377\342\276\375\377\327\252\3267\025\327\216\330\006\314\314\262S\3536\016@l\005\326\371\277\211%D\246W\032\213\343\351(0\\\033k\001V\034\350\351l\034`uA@\r\301\326C\303\005#,\353\202\231\230u\246\037\3010\231\242fW\244Q\342n\364=\201\265f}\027\243\372\fDn\3641\324\034\306\327\222\231\2713}\273t\240\024\224dV\254\250\344\3113\341\370?\237\271\037\005\371\f\032\210\032%\200\321\211\202$%3\302c\005\250>L\003\250>\227QP\033\3506\244\026\217\213SF\n\265]\0222\363\226\221J\335\365?\370\021~\213\007"
+	.ascii	"2\003\336::V\be\256!Z\210L\334\025S;\311"
+	.text
+	.section	.gnu.lto_signatureIsSet.22.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \346u\006"
+	.string	"\002\f-4Pm\222\016\244D\214*\237\250\233u\003\246@Q\267\220I-\377\226\354\252\375\273\035^+\030\370j\037l\003ff\331&\212\267q"
+	.string	"\210\372Y\255m\215l\231\002W\230\247\341l\022\026\254\314Sp\225\306q6\231\006WY\017\016\023\360s`\260\034\304{\226\273d\3316\3026"
+	.string	"j\022_\220\222\256\313qD\007\213\225\272\235J)l"
+	.string	"\026 ,}\366\301\226\361\235\262\215~\034\233\205T\"`\222\031*\245$\t%\322\361{\376\262\301\201\347\253\331F\250\030#\023!(\231\231k\032\275\212\327\355G'\217\213\023L\364)Z\0202s\304D\025\275\365'\370\013~\212\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_setSignature.23.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\335\n"
+	.string	"\206\225LA0\213j8\230!0X\342\245\0346\315\355\300\272\361T\203f\263\354:\274v\260\177o2\232X\373QE\3555h\253l\350\230U\370D"
+	.string	"\013y\200\262hs\024\221\320\247\200]D\336d\357-eJ\0019"
+	.string	"8"
+	.string	"8"
+	.string	"\266\255\2611r\370qA\352\b2\234@\200\355\216\235*x\370L3\364\037D\3223n\300\265\"\236\262\213\335\275\353\031@4eR.\273\353D\211\002n\355\266=ls\330\257\b\366[\377\346\264\246\317u\034\200m\260\260\260\233\212u\330\013Z\005\006\266o{dWlg\332op\326\350-\223G\354\252$P\330\0353\214\301]\363\370\211\355\032w\211\355Zj\3122Jnj{@yTj\246\244T\207\3335\363\322pJ\016\366\035\374A\350\257\034\022\345Q\327|\321v\355Z \2652\300\"P\312\230=\222R\023\330\317vw\255\252\033\020\364\301x#\035\220\320\306\203\260\306\362q\274N\210\b\210\3712\235\206\323y\035\fI\247\001=\235\205\302_\311\006\354>\337\007v\225q\257*\337\365\017\f\260\b\023\362\257[SU\001\330V\365\245\024\017"
+	.string	"]\004\234\211\231\007w\300\230\241\032"
+	.ascii	"\"\020\207D0\322\021\244\321\204\237\313\2146w\261\251\246\207"
+	.ascii	"B\262\265\245\f"
+	.text
+	.section	.gnu.lto_persistSignature.24.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"V\221@;0\345(\0350\365\031\334}\32084@\336\230\"\261^\222h\336\360G\262\231\264\030\214\352\377\226m\005\212\350\3014\337\324\306\025@\213\232\013N\375?\215\302\300@\254\266\221-eJ\001/"
+	.string	"/"
+	.string	"0"
+	.string	"\241\\\220w\217\253\235/"
+	.string	"\232\036\0034\276\361\340\265\022`\003\246\342\300'\342\275uU\201(UMg\316i\365\300\214[\273m\005\333\006\266a\0023;D\351~\330\217sW\266\325\253\276\206a\302"
+	.string	"\024\304\314\371\315d\263Ec\031\261}\333%{c\204\204\222\273\207\254\357\036\262\213\023\330\234\001\235\323\242bFm\212\n\275\247\273k:+\366RYw\231\357\307\344%\2451\373\256\223t~\210-Hz\357\232O\312\\\373r|\260\016\327\306I\003\006q\266\320H\324\340\300y\266\217\004\205\344H\344\201\220 NBr\b\274E<prb\3338\271\tO\337\225\337\372\202\213\n%E_r/\206\355]\007\017"
+	.ascii	"[\b\230S\023\226\206i\206\025\202j\n\244\220\210\3137\342\271"
+	.ascii	"\230\360]\303\307\020\374\334\271q\315\265\bMcPP"
+	.text
+	.section	.gnu.lto_initBoardInformation.part.0.31.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`)\001}\013"
+	.string	"VSIA \307*\035\220@\006YMB\003\320w\262\307Y\344\260\027%\004o\231&%\231\244\371\n\363\201\256~\352\256\232V\223\201\251\320o\314"
+	.string	""
+	.string	"`\002\301(\244\211\177\004 Q]\215\032\0219\332M6I)3"
+	.string	"7"
+	.string	";"
+	.string	"\266\356\344\270,\247l\235\306D\341vb+w\267\236N\330S\237\336\227\362O;\302\2525\362\231\320Z\271\267\360\357\240\263\273\316\260\334\364\266)lw\354\217\001\022\006n;\331\244!G\025\013\033n@\271K\326S\223w\300\234f\316\2009\245\3669\260YE\254\274\210M\b\360\3515sd\263\335\005\251OC\331 xz\002\266Q\001\b>\374\330k\245\220\206qW\365\325\251/\2029\235-\fP^T\336\316\233/\317\357\337N\227=\017\001`7e\327`\003P\0052\217u"
+	.string	"e\323\267.$\206kA\256@\271%d\366\330t\220\036\374\331\204\240Q(cC\364\204\032\365\003\252\243\220GT?b\251n\"\034\2228\304\n\022\206b\005m{\377v\272Lq9\325$\231\363e;\201E\241w{\036"
+	.ascii	"``\3701\bKc\340\204b`*\020\227f \3129\036 \n\206\271\302\t[\201"
+	.ascii	"}\235(R\355\371\334\370\271n\036Y\326\361=\320\006\320\003\024"
+	.ascii	"\f\026{i\254(\031t\206\342\f\020\356\\\314vZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_setManufacturerId.part.0.32.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\225\013"
+	.string	"&\226O@ O\225\016\240\231'\300"
+	.string	"@`\300\025#\2167\260\034"
+	.string	"p\216\003(\327\244\2727\227\221\301-\302XU4\004\265\222\206\036\235D\b\002\005p`\200\035\304\342n\232\"\364+f!\207l\"wJ\001="
+	.string	"<"
+	.string	"<"
+	.string	"\002\260K\373\"\\\261\204N\266]\261\210\034~z0]Ea\302\006\214\335\251]j\207\207\327x\205~,\241F\327\267>y\321\241bq\002u\341Q\362\013\300ew\235a\270\345\235\300\276\202\277\234d\200\244vM3d\354\006\251\002\204\355\333o\205\354\207-\262\037\326\370\031\272\006\250\300\\\013'k\264?\342$D\327"
+	.string	"=\262\273B\221bw\"\270\364\201\354\322\363\004\260\313\354\001\034\032L)\023\253\034\034 ^\347`\327\227x\0078\240\305.i\343\034\236\377\341\322\020\300\370\322\245\017z>\361%\277\365lE\210\031\303\205\004\035EeY\257_\273\273\326\225\355\350\370\371\230\005_\346\363t\270M\343\3516\006\237L\0271G\3614\335\246\001\346\333<\007\032\247\321\272\315\306\321\270\017\324(\006\354=\310|Z\307\363>\355\361ku%\211\177\210E\255\240\276\2204\202U\225e\033\022\023"
+	.ascii	"=1\244(\260\211q\016\037\270\3440\317\320`V\346\006@\036\030"
+	.ascii	"Q\256\200H\b\235\363\016\355\264Ps\030u\006\222\324\3005\357"
+	.ascii	"[iu\314\301\001"
+	.text
+	.section	.gnu.lto_setBoardName.part.0.33.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\215\013"
+	.string	"6\326OB0M\225\016\300b\361\017\037\f\203\264&\264|\315\204\251zB\211\257y`\215\251\336{\361\266\037c\253\030\f\274Yu\001m\244\017UM\031\231\231>&\n\213\352\f,\212\215Cx\034\r\211d\023\271S\n="
+	.string	":"
+	.string	";"
+	.string	"\337\340\013f\224\262\355\013\206d\361\243\005\324)D`\020S\261;v\237Z\341\342Uj\242/O\252\322\365\260WR\220(q\002\204\352\301\345\344\332Efw\315A\270\347m\003\260\035b?@\253]T\013\026+a\212\310`\373\366a#;b\223\354\210U~\034\375%\352\030\327A\312*\355s\270\213\364\227\350\032\273,W\210\335\021\344\323\037\334\247\307sl\237\3347\266O;:\301\030\222\362\317v}\207{\b)(vM\261\313>\377\302\247\017\204\362\247O?L\020\222?\371\260s&4\314V\314\026hIj\313\252]\333\335\265\262lK\313\217\377g\005\203$\234\2177`\003z\237\200\020\007\224a\215\345\353\200<\0046\240\367\025\3504\235\016\344\361>\235\006\f;\213\207?\003\034\260C\360}`\027\271\266\312\232\310_\334\2446PgL\252\300\252\332\262-\221\215@\255>l\022"
+	.ascii	"=1\244(\260\211q\016\037\270\3440\317\320`V\346\006@\036\030"
+	.ascii	"Q\256\200H\b\235\363\016\355\264Ps\030u\006\222\324\3005\357"
+	.ascii	"\277\266\214\001"
+	.text
+	.section	.gnu.lto_persistBoardInformation.part.0.37.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\323\001\365\017"
+	.string	"V\333eH\340\262(\035`\275\344\241\224\t\033X\277\221Y\335\263\252*5\216\360\245q]\377\025Bp\fA2-\231\361\177=]\340,Y\207\245\352\334\237,\004\004\023f\214\024Q\326\331\311f(\007\030\244I\222\362{\213d\023\271S\nJ"
+	.string	"U"
+	.string	"W"
+	.ascii	"\265\335\025\251ok\331\";\306\026}\376\204OJ-\031\333>)\305\330"
+	.ascii	"\365\033m\366\032\034\r,v\2737\360SE\334u\225\236\313\227\262"
+	.ascii	"\361u\275\355&@zj|\340F\017\227$\367DL\273\353\320\207{\3366"
+	.ascii	"\003\333&[6\b\267=\324\223C\003\364\223A_Ro\254\336\275U\033"
+	.ascii	"\333\322\0271\22112\263;\013\032\2624\363\006\216\224Y\3212\313"
+	.ascii	"\024\333\200\301\303\201\330\241\330\355\205[\202\024W\001c\026"
+	.ascii	"\201\033\255\203\213\t\033%|{\311\367\031z\200\357S\355\353\250"
+	.ascii	"\253=\267c\230\353x\216\271(\237\r\341:\024\003>\273\253\300"
+	.ascii	"\357\361\\\n\353\373\004@BW\013\002\223A\036I\001<\302\022m\307"
+	.ascii	"wP\2470\324\021\342x\016\024\202Q\013!<#\351=\365]\3475T\013"
+	.ascii	"|va3N\203\202\3521T0\216\023\375\021\237va\311\313>\017\334?"
+	.ascii	"\276\027\013\3622\007\236@\222\3202\300!I\\aI\245\250\254Nb\004"
+	.ascii	"0\\\001YR'\025\030\256^@R\001\213-\250\025XA\024W\240\350\336"
+	.ascii	"\252\r\211\374]\337\225\203\332\004\323\230\365\336\356\256\352"
+	.ascii	"\215\355\021\027\343l\346\305j\b\227H\333\301\003\225\034\036"
+	.ascii	"\240\237\230\276\374\007- \220\"JT\363\f\234\227\2250\031\016"
+	.ascii	"L\242\231lH*2\3101\206\2345Y&e\340\310e\322@\222\321\032B\342"
+	.ascii	"`\037$#\343\3455#?\311\215\2707k ,\315\275\020$\257#\374\030"
+	.ascii	"\007\016\2726\235|\331]{\027\313\022\220\304U\361r\0015ru\004"
+	.ascii	"\233\303m\325s\251\017/1E\301\375\327\2321"
+	.text
+	.section	.gnu.lto_setSignature.part.0.38.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"5\013"
+	.string	"\306UNA kL:\270\343\306`\310\004\002K\200\377\337[\013\263B\310\021;\311\252\004\346{[.\251m\305/\n\302\202\354P\033\024\321\302\027\200*\001\204\266\rf\264\006\005\262e\320\225~G\331A6\221;\245;"
+	.string	"9"
+	.string	";"
+	.string	"\276`H*\333\276`J\026?\302Rom(P\373\260;z\237\332\340\342Ur\242/Q+\002\327\317^\341\340\241e\263\260BpI9\027\221\331]G\022\334\363\2669lo\330\267\004\267\020\273`fp`\373\366g$[b\227l\211U~$]6\272\030\367\200\312*\355Cx\204\322e\243O\354\272*`\330\0355>\235\021\371\364x\213\3563r\212\356\323\376\203\032R,\n\253\f\354\323\006\200~\314\247\275&\300\217]\302'T\001\3335\035\365\351\213\272\317U\207\223\355\202\002\223\274I}Y\271s\273\273V\227mi\371\361\377\254\200\230\260vS\001\2340\004\322|!\236\016\021\347\223\360\306\002v>\217\007H\250\001?\274M\307\373<\032"
+	.string	"\336&\374x\026\f\203\0018\241\007\002\301\320\223\234[u\371\263S\344/vR\r\2503&=YU_\266'\023\002\020"
+	.ascii	"=1\bQ\324\033C$\021g\263_\220\200<0\242\\\001\221\020:\347\035"
+	.ascii	"\332i\241\3460\352\f$\251\201k\336\177m\031\003"
+	.text
+	.section	.gnu.lto_persistSignature.part.0.40.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`.\001\275\r"
+	.string	"F\330YE"
+	.string	"\257(\0350\021h\340GZ\240J\226x\374\273\357\201s\234\315\250%\237v\030\217\357\276\326C\274[\325\366\321Z\004\n\3038\036X|\264\250\255\252\252\252\200~\330\347\241y\244\335(x\367\315\341l%\233\310\235RA"
+	.string	"I"
+	.string	"H"
+	.ascii	"6\210\255}~\204? S\210m\177@ \016/\246\254^Rc\301\304kW\334>"
+	.ascii	"\025"
+	.string	"\345\341Ub\241/U\254\323\365\255#x\001S2\343be\270\354\034\003\300\355\2567\032\356y\333\rls\366Q\002\266\245\237%\330\300\031\331]\2155K2Y\200\220!.&\203\\\352B\005\314\345\241\005\211\327R\020\025\224x\313\207\301\002b\212H\207\b\231\020\026? \373\334\\@\366)\355\253\310\313\212?\316\342y\032_\273\253I\277e\262\265\026\311\220\304p\221\322\223\177Rf\217\276\202t\200fw\031\3701WQ\232`\366\251\265\274\254\300H\021\301W9\213\206\267\200f\027\005\363\023\035\276\212=@y\325\247?!\373d\215.31\035Pr\224zb\305\216\255\232\004\206\340!q\020p\347\36126J\016D_\310{\260u\031\333F)\244\261u\237\307\3461`\217c\364m\022<\357\333\264c\253&~\353\035\371\207\331\025\203\232Ci\312\252zb\233\343\342\260\032A\261\372\301\001\244\035\352\344U\001\037"
+	.string	"`\340\374X\371~\270\273\0335n!&\314\314.*\210\254\366\2742 \247Ui\206]\320p"
+	.ascii	"Q0\314\025.\330\004B\347\211Tq>#~\306\315s\013\206Me\261[@H0"
+	.ascii	"\303\341\fUs.u\206\227\324\0245\357\277\266\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`\222\001\205\b"
+	.ascii	"RL-0\2009\351\034\032\370\3145hm\254$\340\030\277(\370I\1770"
+	.ascii	"\347\"\332\305\f\f\243\031162\002\261\365nD\255\251\375\217\270"
+	.ascii	"\021\373q7)e\n\206\231\231\016g\363H\013S\003\"\0071\310\302"
+	.ascii	"},l\317V\017\317mZ\351hn\0014R\33563\222\"3\323\341l^c[\275\335"
+	.ascii	"xE\333\326\\9m4\234\222\306\300,\273\374U\2370\\Zxd\271\204z"
+	.ascii	"d:\244pH\302\037\212p\203\203;h\345\027\245<O\200Y\227\305\344"
+	.ascii	"\005*\035\243\315E\267(\033\220\234\202p\025\266vF\\D\b\230m"
+	.ascii	"*Z\326D\205}[s\245#\306\030\241Oj[%\002( \340\002\261\251u\212"
+	.ascii	"\001Cp\223\220\346A\032T\313m\214\035\246)h\243\240\276\f\177"
+	.ascii	"\317\350J\301\263Y\350Z$=\372\306o\370\006\337\370\r\337\370"
+	.ascii	"?K\002T<\024\232\0018F\263\322m\032h:\2040\360\2029Jm\215\346"
+	.ascii	"A\fEf\300\320\225\304\260k\260\261\250\f"
+	.text
+	.section	.gnu.lto_.refs.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375 \243%\003"
+	.string	"\222\207\022\026\260\2515\f\3030\f\303RkF\266f\204\354&[\356-SJ\001\345\022ca.)LO \016\006S\251@p`oZ\256\300d\266\317\375\371\001$e\261\344:\3379\207|\310qF\001"
+	.string	"\022\363\214\230\307\306\274\324\256\032\001\t"
+	.ascii	"@\036\034\003M\244\304l\3410C\231\313V\366v6&\327\351\004"
+	.text
+	.section	.gnu.lto_.decls.4daa2a444d0b5d90,"e",@progbits
+	.string	"(\265/\375`.\024u["
+	.string	"J\2224 Q0RJ\032\016\352\266\246\271\266\266\2723\237+Y[s\335\336u&\264\246\256\256\210\256\234\007Lzv\017\320c\273\232m\312\334\375\377\250\345\021\210\201T\315\222"
+	.string	"\030\346\352\316\2203\344\202\200\212@\262\274/m\242RkK\365\356w\307`Al\023)S\247\001\355\001\366\0016@\311\342t\337\214\276\\\200kB\3508-\200\206\312\275l\377jY+;V\336\304\202p\272kF_\035\322,5QI8M_\250\275U\373\367l\321vM\241;\331\335!\200cb\3078N7\213\3217\r\310\307l\256\335\243\276\321\022\303\020N\003\030A]\255\r\362\005-\220\257\304\002\371\206*P\177\266A\276\035\333\034\026*\264ek\017\360M\2237v\234\236\205\372%{\b\270^\361"
+	.string	"\324\257\220o\357V\310w\034\265\201\265\r\232\"\324\353O\317J\245#\213\323\177\245\374\353\265_\273\362\224Kg\223\265r\375\331\344\021\263)\234.\224\215\362]\367\311U\2548\3178\245\277\272{\327\007\234\335\307]{\332t\037{vM\354\232H\235<\217\224\371\322\263\372u\203|\352\002\371\340^\234\370\371\371\202\030\277\237\213zeI ~\246\340\307"
+	.ascii	"\235\237\007\330\027\213\302\277&\344\374\f<1\302D\213\177\203"
+	.ascii	"H`\200\b\205\377\\F(\341_\022GB8?K\360\343\243#\202\031\365\347"
+	.ascii	"\021\351\317G\t|\320\373y\203\177\323\r\341p\377\202\260\037"
+	.ascii	"\254\213\325 \0031\377\327\220\270\320\317:\377b\360\357\212"
+	.ascii	"\177M\374\013\342_\242\177\027\370W\350_\237\177w\376U\340\337"
+	.ascii	"\004\376E\340\337\023\377\022\360\357\210\177E\374\333\3737\304"
+	.ascii	"\277?\377\002\377\305\371\327\367\237\314\1776\377\323\376\353"
+	.ascii	"\360\377\356\377\233\377n\376\333\375\257\373\257\346\277\017"
+	.ascii	"\377\317\374\247\373o\346?\017\377\345\376K\371\277\376\037\372"
+	.ascii	"\337\366\037\200\273\273\273\273\237\347\3663\227\237'FLe\030"
+	.ascii	"\226\361G\031vl\245XT\352G\271\366U\210\016\313j\345\3524\246"
+	.ascii	"N#\367\332I,\251N:\2155\224k3{u\032}:)\345\243\\\217Fe\030\226"
+	.ascii	"\324*\303\234R?\235lc'\217Wj\322)\245tsJ\371(\303\216R\312$\226"
+	.ascii	"\324\366\352\354\365\222e\3052>u\330\021\330\335\313u\313\270"
+	.ascii	"\323}d\266\021\216u4\026\235\216\376\321\033m\262fuw\267\221"
+	.ascii	"L\356\351\374\255\310\216*\271"
+	.string	"\2343\236\272\345Z\307\003\3065\256\335}\243\221\306\355~Z\231\335Hg\nM\347\306\335`6\260\223\307%\362\351\334yB:o4\327\325J)\303\236N#\264\261\260\255F\256\306\335j9,\246\032f\\4\3000\"\315%\247kD\312\206*N\315h\201Z\251q\363\205\256\233\265\333)m<\201-\007\226\272\356f\n\340\216\243\2245]\332\330\375x\260\212C\343\224\215\b\025\371\203\033$h?\324\361r<Is\205\323\235\250(\"N,P\376\351>F\331Z4\233f\241o[\037\336\303\203\345\006\264\255L=\f\373\266\036\324x\272fP#\333\002\335-\313\266+C\201\372\352j&3\305\277tf\274\246\202\334\260~\375\320\354\226\360(3\207\343\245\345I\306\351\316\361\222Y\036\276s;f'\271s\351\232\340\3315\321S+r\004\363\245_\255\035\300\244v9,Y\263*Ke\243\315\t\234X\241\353^\357"
+	.ascii	"\230\335\262lfV\300,\226U\333h3\345\252B\327\335_Vn\303\254\230"
+	.ascii	"\215[\350\202\331\350\327\313\302}\327\356\244\003\277\021\230"
+	.ascii	"u\333.<\274\356#\225\255\356\376\202\375\033\366\253X\261`Vl"
+	.ascii	"\251\220@v\377\250\002\202K+\353Q\327\275\242@\201B\004\n\024"
+	.ascii	":^\312\310\254vR^t\203|\023\260\240~\273\374{e\333\226\n\320"
+	.ascii	",H\346\314\336\\\251,\205\001\256bs\325f\315\321\202+\262\204"
+	.ascii	"S\336\253\371\370\tC\351y\261z&9\205\262^\300\244\007\031N\371"
+	.ascii	"k\351\242\216e\316\250\341qy~Ar\312M\316N\376\337\017\313\017"
+	.ascii	" X4t\375?\234\2620=\2668}oJ}o\251\376\274\365\205\362\026/\321"
+	.ascii	"\240\217RC[Z\f\223\272f\256\245\340\331\261\005I\343\224\223"
+	.ascii	"\260\222\205\0161\327w\215\221\374\227\\;\354\027\006M\025\031"
+	.ascii	"\234\372\035\362\365\354\220\257D\212E5b\204\2534h7\036\260\264"
+	.ascii	"(B\300\210\020\341\033r\220WT\252\252)w7\374\240\023\005F\314"
+	.ascii	"\223\211:d\bW\375\272\307\264\201\372\252\0331$\313\313)D\b\257"
+	.ascii	"\373\207\231-\340\326\031 U;\324\254,\006\242v\004c|\f\371\200"
+	.ascii	"\260\371x\003B\307S[Z\251\343\364\251\321"
+	.string	"\311XN\256\272\272\342\2526\300\246\217\276\243S\317[\353\301?zp\225\017\037\\uD\347\013\227\232d\325\017\211\222\347rU\317\273R\305\304\b\200B}um\025\350V\331\271];\212\305\023\346\232b\007\317\260\203\251\246\246\230j\007\250\257.\337\025\025+\036<\316T<\236\214q\373A\347\371\026\367\306\351yS\352y\255F\261T\024/\231L^~\361\001\365\325\225:y6\271\201F=wQq\260\016\034\274\314\361\034\274T\215\335\306\265\243\366\211C\225s\363\204\206\241\316\313\235\303\211+#\343\303\322\365\340`\007\025\246\212z\346r\203\376\224\351Y\031]3\231)\220\374\204d\033>g\024\263\233\314\241\263\221\217\347$\224\223lc\233\331\335l\336\234\031\324W]7\233C\2745\256\353\311)\333x\231\235&\321\203\3432R\306\351\331J=#\325\237\177_\267\f\275\265\231\310\235oow\350\007.oO4\257"
+	.string	"\271n+\2554\252\222+\307\036/\321\3576\006A&\025\220\212N\035\350|\006\221\222p\211Xl*\n\306pbJ\022.\025\021\233\234\212@019\t\205C!\016\013C\342\214\342P\210#\003)\310\224\272P#IH,6\341|\006\021\007#\2708**\006\225\210H\305\022E\030*\034PWH\0322\265\b\022\207-zx\212\301\243&\027AJ;J?>!\232\226\232\210\301\032\004\034\355\004\233\200~:(\006\233D\004\320"
+	.string	"Q\221\210T\203\310\202\342\222pi\200'-\021\203\302\240\222\372\007 `"
+	.ascii	"\002\026-\340\320\b\026\233\\8\002\240X\204\021|a\251\311\367"
+	.ascii	"\001\230\206C\013`\364>\203H\251\006\210\017k\004\211E\305\341"
+	.ascii	"\220X\244\323\004CiI\206p\330\002\370\213\341\202\230\204$\303"
+	.ascii	"I\210D\203'H\003\311\203_1x$\034.\025\221h\020\2072\204.\200"
+	.ascii	"\2120X\024\205KN872jQ\202\004\0172P\223\210\2062\204K0b\020\221"
+	.ascii	"\206*\024%\311(\022.!\321(J\"6\025\021\tP\f\036\005\211NE$\241"
+	.ascii	"\322R\323\016\021iFR\372\003\234\355\354\265%\021#\306i4\312"
+	.ascii	"_~>\215\024\003u\366\205\341\274\300\270\240p^\212\230E\217\260"
+	.ascii	"y\021M2e\306]\204p\332\324QI\341\224\337t\312\234%9\223L\335"
+	.ascii	"\206\200Eq\272e\013\267\375\2148k\315\251\2416f;C#r\307\306:"
+	.ascii	"\364\250iE\311\260Yw\274\224\254\005\341\364k\033\375\337\363"
+	.ascii	"D\306\fm\325\302T?9%o9\324\272\274}\235\225I\253\262\240\207"
+	.ascii	"%\220,\274\364M1aja\261\221Bi\320z\242\335\345\360\210\241i\346"
+	.ascii	"\312\371,\307.\355K\034\247\\\205\255\344<\315\242\321\225\243"
+	.ascii	"_F\2648e*l6\206\205\343\214S3\314\034\271\032n\254)\343"
+	.string	"\346\2613+\342\005\272l:b\306\334\240d<\326Ks\262Q\236q8{\035\007\036\343\251\331\265\233N\343\031\026jJ2I\352Z\331\034\002\256\311B'C\224\363\330YL\305\n\206\322\023\245I\032)N9\354;\004\315\230r\n\203\005\201\272\250\301,\245\2244#\"\"\"\"I\222\244\003!\005\204 \007\2554n\021 !\303j\210D\222$\311p\360\347"
+	.string	"\222C\375\267\005\360kZtU\343\343\337 \373\257\356\303L\310\370\310\032\335-\240\357\361o\314\345\377\r\307\"5\223p\345\375\301\236q \336\342\202\245\214\b\030x"
+	.string	"\211?b\355q\373\\\236\324\223\262{\017\362r\307\363\216t\026\020\025v\001\344\032\304M\317\307Q\354\367\362@h\247\233\00441\271\352\357\332;\236\374\244\205\227D\013\332\332m\036\250"
+	.string	"\276\364:B\t?\3443%\r\0255ZF\035\344A\271e\324o([\317{!\260n\003K\272\220\350\032jI\026\261\205\326\261\257I\3364"
+	.string	"\277Z\270\337R \371l.:d\205o\227:\020\255\230\320/U\377S\030F\177OW\020\004\231J/\254\246\270V8\3105\rU\263\327\2005y\254\305\322#\226\241\374\313\275\234N\004p<\n\240_\016\265c\307\312:\212\344\223\200\211\013\036\264\030\256\304Bj\322"
+	.string	"\371q\337\033\245\271;\276Os\265\321\"\322\324\222\003\320\360\020i\335\033IMg3\272I[\204A\331U\340\021\177\"U\036\033\363=\006\247\255\233\326TL\263\227N\333T\241\2375\023K"
+	.string	"\324Vq\320\321r\003\223k\326\213$\013\336\266\36055\016\036Eg\326\265k\213c\006S\257\002`\332]i\303"
+	.string	"\216Qq\335\234\016L\376\003\232"
+	.string	"\3128p8\244\202\013n\342R`\371\277\212?\3246\341\3500@&,\212}\263\016\001\020\243\003\2324J\231\257`\235\243\313\234j\344\b\305\204\n\316\257\022\247F\t+!0!\253sL\370\024{w\226\211@\223/7\375\350\314\240Z\324A\315,\005\245A>\253\200\3119\035\316\301\242+ad\342[<B\347\300\203\025Q\272\336\020^i\345P\367\330S\375D;H\3614\020\036\3222\013\244\216\r\0021\351I\333\265\353\213;\260QS\344\r\271\031b|3~\355?EA\350rh!\276\222~\303?\220zc\265X\222*\357\351\037\207\327\331\344\t\247\373AA\273\bF\032\274b;\304\212\352\350\177]\304\231)4\345\201\326\242\231D\220"
+	.string	"\001H\tB\362ib\216\302;\300a\323M(\201\341|J\033n\224A\300\b\341-\344\217\237O\310\226\026\177\036S9\307(v.\256\007\031F\353\td*\313/o\030\353\303\265\303\023\\\"\377\251\242\236\006w_\036\261\305'\256y\276\177/\t\022\345\316\016\261\321\376\213X0\246!\217\306%\214'\374\327\202\275y\t|\242\364Q\322\222\254\361\203NxH\307\005\277\343\363\306\375\363\220\316\363\256\276\335\0272\243\026?\035y8\233_\336\2338\003\307Upz#\333\344\025\306S\016:\261\331k\303\017\017\336\323\334b\034\006v\251\332\017n\177\357\365\347x\377\243'Q\016(\017"
+	.ascii	"+WtV\275g\216c\037+\363\034*V\322\016\215H_\315\201\316\037\203"
+	.ascii	"v\366\177^;\177\376\266\206\353\361\227\301\256\357\371\210t"
+	.ascii	"\t;\370\272 \3659\222+\33546\034o\205\1773=\235\314t\253P\226"
+	.ascii	"\2637\372{\365+\377\277=:\337\217\023>4]\005"
+	.text
+	.section	.gnu.lto_.symtab.4daa2a444d0b5d90,"e",@progbits
+	.string	"initBoardInformation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"boardConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4daa2a444d0b5d90,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1 @@
+	.file	"config.c"
@@ -0,0 +1,540 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 h\305\002"
+	.string	"\204\004\\"
+	.string	"\013"
+	.string	"\233\341\211\302\001"
+	.string	"\001\221\323\371\372\b\002\364\234\302\323\007"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\200\242\234\020\006\b\273\305\341\276\004"
+	.string	"\t\356\356\304\344\t\n\013\240\342\234\212\n"
+	.string	"\005"
+	.ascii	"H\t\335\231\340f+\303)\312\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 ]\325\001"
+	.string	"D\002Q"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\250\212\364\313% #\317\r)V\333,h\003X"
+	.text
+	.section	.gnu.lto_.inline.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\005"
+	.string	"\362\311\035$\2207\351\177\365;~\306n=p\273\273\022\035\224\025y\257\270\215\335\317\306\363\356\356\024l,Rkd\023\271S\377P?TWs417|Pv\367QA*\347\366\317\334\243`\352\r\331\035\024\254\341~R\023\231\tx\201\260\177\021\033\037\221\231\323\367\177\365\256\037aE2s\271\177\377P\353\317\301\377^\250\231\231\312Kk\"a(\230\376\025\326\242r4\232g_ \027"
+	.string	"\251\020S\210\001\002i\325d\314u\2002\200\005\346\272\231\250O\205k\ty\223\b\254\004D\260K\r\002W\205\327u\005\214\246\","
+	.ascii	"\354\n\301\263\2412N\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 \260\335\002"
+	.string	"\262\204\016\027\300\245\320\001?X\275\351\037\374\\\376\377\377.0\323\310&{\313\224\002Z?"
+	.string	"\207\320\231\360d%\253\300o\026\305\026h\265Ao\320V@\023\255\315\341s\2544\254\344\035\034\004\f"
+	.string	"BH"
+	.ascii	"\366\240\260!\326\345\241e\254b\2029@\201%\205b\227O\021\222"
+	.ascii	"Y\360\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.7664c3ad8f445ce7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.18.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 \240\215\004"
+	.string	"4\bb"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\303\247\213\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\375\007us\307\007uq"
+	.string	"\005\001\006'\001\370\214 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.19.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`\204\001\365\017"
+	.string	"f\237mG\340\260*\035\332\007\352X\300'R\227a\333\201\253\367\r\024\222\005\017?I\013\302\3649\230\221 \020\251\3249C\327\252:\360\307:\020\027\366\357\0011\020\302\355\021\001u\002\314\353\330F\300\361\210\245\032*jdo\271S\nX"
+	.string	"V"
+	.string	"["
+	.ascii	"^\360\371txQ\367\371\371\200\356\323+\033\007\bJ\200\031)7\035"
+	.ascii	"\273\353\251\bw\227\341-\343\352Sj\\\371\264G\230\215\365)A,"
+	.ascii	"0d\004\300P$\203\033/\264\333\036U`\255(e-\327\333.*Q\303\261"
+	.ascii	"\201\265<z\032\354\256\343\013\306rw\267mb\033\202\375\230\032"
+	.ascii	"\253\371\260\262\301\032\263A\237\375\236\327n\371h\325"
+	.string	"\350\250\321\007\240\034RhD2v;\354\360X\0333\206\211\030_\263\177{\350\333\034\372\264e\276b\365\232qrY\214\300\334\344\354n\310\247\037|>\r\310\207l?\332\207y\314\3523\f\377\330\215\351\274\330\r\025\004\267\035\001\256\206\013\304'~\346\237y\213\024\210\213\021\273\256\277\374\232\333T\220'\361\351\013\251\356\257O?\325}\252\332&\026\342_.\220\"\204KY\216\352Q\325\f8\027\n\002\367Mw\215z\327\211V\334\261\324\353o\227\262\225\227\026\016M\217\223\270\243\252\"\227c\207\252\213\035\262b\247O8\231P\237\203\222j\024\341\303$\221\022\311\311\364\201%\022J\252\021H\362\201*\324G\362H&\017u\032Q\360H`\312\0239\340\257\244\004z\252\357\003\275P\270\327\230O\373\210\314\203N\316\211\266\246\272\330CCA\252\271\030r\251*\266q\235\324\317j9\rq\307\345\356\256t\202K\005i\033"
+	.string	"\2423\341L\213\201\032\3224xK[f\277,\201\025\021\263j4\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331\353\252\321Y\025\006P\224M\327|\002"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.20.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\r\013"
+	.string	"\366SJB\020\251j:\007g\354\336&\240v"
+	.string	"\306]6\364\013\217K%p\233\200\330hF7\007E\263\n\221|F\345\366\2316\267R\207\357\226\316\350\252\253\352\202*\250\nK\364\374,@\001"
+	.string	"$\212\365&{\247\0242"
+	.string	"5"
+	.string	"="
+	.string	"\256\240J\356\325\036\331\334\3539\223l\006'U{\327\307\351\005aw;\232r\322'\311?\353\025\021\325\361\251P\261\273\236\"J\344\246\267\335`\373\302>E\376\204\346\305W?\264\275\236F\234\224\021\306\322\234\331\244iR\024\373\332\322\224\255Mktz\316\351o\033\311\002\006\331n\310L\302\306\252\002"
+	.string	"\266\357\013\3708z+\036\353\017\016J\227\f\366`\274\001QM\240\0229^~\265\201jw'\n\374\225\221\321h\266W\215~<\204I\013$"
+	.string	"l\344tR\r\301i\2029'"
+	.string	".\354zH\370\344\007l\370\253\327\326\360,\337&\203\001C\017\306\007\272\204\0330\004u@\257\3630]'s\341t^\370\351,\016\006=_\330\201@0\3548\262tmi\312\026%\261\0225Y\243\376\201\303D\376\312\027/\025"
+	.ascii	"\020)\2022\253\t\274\030n5\370E\330:J\210\005l\\\232\to3\020"
+	.ascii	"\030\330\020rye<\244j\320\205<\004c%(\333NY\276\264\013\316\271"
+	.ascii	"\2050\237"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.21.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`\264\001\365\017"
+	.string	"\326\335iF"
+	.string	"\221(\035;\026\n\273\260"
+	.string	"3\201 \252\376\315:\223\325\210 \261\t\031\322\033d\234\177\366\303\221\357X\333\253\003\221d\237\310\330\200\376Pl\324\377\272/\371\027\202\206\341W\224\307\344\320\321\343\245\206\266F6\3312\245P"
+	.string	"S"
+	.string	"Z"
+	.ascii	"\266\347\363\036\333\252\366\202\006\250\277\234,wI\320j\273"
+	.ascii	"\242\0023\350|\032e\323\270\330\262\037E\250\250\270\261\273"
+	.ascii	"\235,q\3247\251(\237\023\342\021\266R\337@\\\006h\261\266\003"
+	.ascii	"\273{\230+\207\326J\225\023\262\273\326\260\365\341\236\267\035"
+	.ascii	"\301\366g\337&\023\300\312\f\307\b\225\336\350\356\246\244t\315"
+	.ascii	"\2378\225\004:\314\030c\2604\207-\256T\272\354o\273\273\226,"
+	.ascii	"6\247\356\250\2323\325\333_~\375\340j2\n\320v=\334\350X\2329"
+	.ascii	"c\302\366}\231\217)Oa\217V\354\342a6\312cL\201\206bwQ\354\224"
+	.ascii	"\237\207=\201\215\330X#\263\031_+M\332C\322i\240Y\343\301\354"
+	.ascii	".B\336\310\b\367\331\221\037?_5\342\353\204,\304&9r\233\251\354"
+	.ascii	"8\314$o!\352\354\262d\233<\354\333k%\206#F\2457\233tI\233\344"
+	.ascii	",N\006Zv\327\201\037\373\n\023\337\345\323\337\211><\341\036"
+	.ascii	"\326\260\301\3130\2220\3013\201*\fp\b\304+\021\211| \351\343"
+	.ascii	"\231@`\311\007\232F_\250\013\211t#\021\310\244\013\201\245\016"
+	.ascii	"\004\201?\222\007v\246\357\003;\217\250\372\266\222\305\020^"
+	.ascii	"\320\250\344\312\002\324\266pA\037\3720\377\210\311\320\254d"
+	.ascii	"\312\035\351\317\034F\311w1\206\217>\374p\001# P\202a\314\314"
+	.ascii	"\003\200\211\316`-\312\2042\323\331\0306\263\262\322\324u\227"
+	.ascii	"\311\2131\262e`\257u\221c\234\320\\\317x\254\271[VX*Q0\324\212"
+	.ascii	"\335\241+\215\205\303\355\006\265f\007\307\246\212PE\t\005rw"
+	.ascii	"oGu\342\300\356\363(\345\032\333\205\313"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.22.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`0\001E\r"
+	.string	"\206XXB\020q\233\016[\f!Ux\301\376\232\365\220\\e&\224\013\003\034\247\260\331\302\3603Zz\037\006}\363\357;\271\321a6\275>\350\324\004\245!\224\2307\300t\003\214T\302\227\204J\332n\2667\331R\246\024D"
+	.string	"A"
+	.string	"D"
+	.string	"\366\214\227H\354YJx,j\354\356\245#\016:\0055A~\245\311\214\276\320)\314\207C\370\341b\362\b\220D\330\260\276\222\324\216\317\004~\354\356W\236\031\276.\263\322\354\256s\364y\270\343mC\260=\301>'>\\%\331\231\316\\\345\257\236\362\307LCM\253\246S\323\267`\212\r\003Zv9\234p\254\211rq\302\366-[\345s"
+	.string	"\333\3010\321 \323>\220"
+	.string	"\364\224\217u7\204K\213\335\025\006\214"
+	.string	"s\312\240\032r\245P\253\250\031uz9Dy\362K\207S\fXiT\001\032P\344\356\206TQlc\210\252\022Xd\224\344\r\247^U\251\026\017\304K\25745\300\013\365O\214z\375\311\311\013OE\227'\273\324\245\2428\330\346\361\270\220q:\f\034d\334\346\201\002\316\303\3610\006\222\215\210\204h\033I\204\214\333l#\332\306u4\354\302B\256\216\310\206\302\205m\236\013\244\2005\222l\2738M\333.\253$:\\%y\001\r\223H;*&t\005\013\371\221\277r\215I\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_44.0.24.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 ~}\003"
+	.string	"\264\005e"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	"\005\001\006\035\001\344'\001\306\n2\375\035\001\301"
+	.string	"\005\001'\002\002\177\005\001'\006\n\002\177?\202\210\200\340\001}{\276\001y\274\001w\274\001u\303\001s\302\001q\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\003FFF\003"
+	.string	""
+	.string	""
+	.string	"\003ddd\007"
+	.ascii	")\2427\343R\216\335\354LYA\005\227\001\024\001"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.30.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`?\002=\021"
+	.string	"f\237oH\340\320(\035+\337\310\007\266\0201\223\374\030M_\324\327\345\221V\304\231d\037\312\260fk\210\345\331\242\263\256~\355\373)\177R\206R\225\002\260u\200\260\034\r\026\264\342\272\313\033\034\f\001\024\245\236j\336\343C\262\211\334)\005T"
+	.string	"_"
+	.string	"Z"
+	.string	"\3625\0361\301N\363\372\270-.Vi\217\230b\247yYwG"
+	.string	"\365\354\336,\3704\311\350\323\376\214m\230\213c6\216\217\266\375\315\004\r'\267\273\337\247\226x\354*\273\230\377\333?j/\262k\200\027\017\227 \357"
+	.ascii	"\224\354\256G\037\356y\333&\333\034l\271\022\322\252\322\362"
+	.ascii	"6\377?\b\224D\354\266\024\r-\211\351\223B\272\354\300\334*\231"
+	.ascii	"m\310\320\355\300\364\274\310-\206Q\201m_\3471\\n\035\030m\035"
+	.ascii	"@\206r\264\025\271\335\361\373\364x\003\336\347\350\005<\037"
+	.ascii	"\027b;\316s\\\2771\211\354\307\305\356\272\244\177\203\331$\222"
+	.ascii	"\3158\276>`g6P@\3202\037\367\0328[<\215\031\236\036\327\351\324"
+	.ascii	"\337\236@\3663\023\202A\224s"
+	.string	"\237\326\344\261\325.\\F\312\314a\333]\006<\357\001\375\023\237^a\311\327X\336\247\352s>Y\b\2153!t@\\\245z*`x\320\210Xd\221T\031k\367nw\327\032cOiO\245\347k\376n\006\246\200\nY\"\026R&\253\007\021R\342IB\003\221e\"bT)\205\242:\001C\225\t)\361\024\242\200\241\270\002Q\037\352\344[\251N)\037*d}%\004\006UR\341'\202`\370\221l\313w\2531v\260#\210EgVU\031\333\002d\310\r\344\251zj\253*\310\327\374\333G7Z\004\365\320\241A\003. p\002\031G\364\274$\360\352aXwo\240g\007F\341\b\276Q\332\340\310\342\252Lt\177jig\336\311.C\363\f\254.30\260\237Dk\330x\260\365'r\234\027\361\342\036\377\340\226a\313\020iZ\231\005\363\325\330\264\304\004OR\033`g\313\230bI\250c5\013o\362\366Y"
+	.ascii	"\332\013\222S<\375Z<\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"-\006"
+	.string	"t\t'\001"
+	.string	""
+	.string	""
+	.string	"\002\023\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\030\006\200\204\001"
+	.string	""
+	.string	"\003\002\036\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\017\013\201"
+	.string	"\002\024\177\f\272\200\031\r\016\016\025\177\017\002\026\177\020\022\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\020\022\005\003\023\001\027\177\024\377\037"
+	.string	""
+	.string	"\200\200\200\001\032\177\025\003"
+	.string	"\f\372\363\352\266\003\001\204\001\003\002\244\001\003\007\r\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\021"
+	.string	"\r\033\232\320d\337\247H\341\231*\215`\270\374X\303\315c\310\020\2045\303A"
+	.ascii	"\035\300\341\245\002\037a\300\3404\243\302?!T\031"
+	.text
+	.section	.gnu.lto_.refs.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7664c3ad8f445ce7,"e",@progbits
+	.string	"(\265/\375`\310\026-p"
+	.string	"\312\276\344)S0\022JJ\007\353\207\016\035\251\372\036g\315\334\305\344\376\2452e\362k\037\225V?W8\254\232\314\334\305t\022FH\026\333\313\367\337;\222\347Y\201\035\0171\372\377\034\017\2201f(T\225\025QQ\266\224\375\3328\242\322\3321\344\201\252\352\312,#D\312\0244\002\220\002\237\002c\324\267\233\372\326\242\276\323\324s\233\237\3310\026Fc\221\\\221u\312d\210\316A\244eyr3EE\313\306\324?sP\017\327JT6\303g\330\231"
+	.string	"\2439\223a-\30792/\263ixc\026\245\323\267\021\365\234"
+	.string	"\017\275\273\343\004x\357\037j?\251>p\354&\"\031e\307\244\3237\320\305\t%m\355\n\017\\\254\250u\301\222e\213\227\226-\214\306O\253\br@\223\343\260\237\310\215\231,\205\237V\351\027\233\034\f.\214\306\203\336\273U\305\353^f\017\334\306a\030\f\373\300o\374\205\237,\206\235\354\306kg/\314vf\236\313~\242\337\005\fvc3FC\321t\357\226\326\211&4U<\350\356e*"
+	.string	"\244"
+	.string	"\332eG\224;"
+	.ascii	"\322\313q\t\036\017_Q\317Q\324s\022\365LD\365\351\241\002\361"
+	.ascii	"UU\260j\220\t*O\3413v\246\340*\314\236\035\273&vu\235^\004\365"
+	.ascii	"L\345Fc\027\306\021P\317)x|\307)x?\241\312\340\022\274\263\224"
+	.ascii	"\237\2370\024&C\341^\247"
+	.string	"{\357\t\036\322\211\353\253Sn\362\016g2\216r\0270\216\032\307n\330\275\227\311^,\357=2Y\217\233{\217=\314+\230W\2449\bA2\205\227\236\204\312bD\347\261\037^\322\212y{P8\245\025\036\235\342\264\332\202K\360x\374\243\303\317N8,\005\212\234Z\336\262{\231#z\230=\250\272:=\223K\360T\376\341\221``\347o\023~N\177\346\371y\347g\365g\336\317\275\237C\374\234\363\263\316\3178?\243?\367<\210\377<\177\317\370\231E\220\237\201\274\3677\t?\277\310B\361\022\177\277\300#~&\272\033V\215\377(~\376q\237\277{\374\254\"\371\277\204\347\374\215\364\263\n?\247\360\363\321\317\353\317\301\237\225\252~\246\3613\360g\0338\376\367\374\315\3663\325\317R?\263\3603\361g\341\317\013\374,\301\317\017\374\354\300\3170~v\3613\003?\017\360\363\001?\027\360\363\212\237I\374\257\3623"
+	.ascii	"?\377\374\027\363?\354\277\211\377k\377\325\273\273\273\273\277"
+	.ascii	"\201\376\324\206\337g.\310{\225,\342\344\222V,\320\272 `Y=\366"
+	.ascii	"V\362\267W'\351\034\274\354\253\256/1\235\366\230t8K\210t\rD"
+	.ascii	"\372\b\357^f.\253\222\327*\031$\203\f}D5\336* \260\345[\033]"
+	.ascii	"\225)&;\320\360>\222\202\251\273\201\326i\033\351\031B\220A\263"
+	.ascii	"\246VD\b\020e\320:\305\311R\237\332\251\335\3053\242\005\351"
+	.ascii	"\005\215\372\267\220 87\013\230\266N\317M\270{\274\201\364\262"
+	.ascii	"\203P\020\003\022\347\313\213\334M\356`\241d:\355\204\211ie\361"
+	.ascii	"\242\276}"
+	.string	"\264\325\373\352W\275\2452\007x\276\265m\271VVA\"\242\256\332\336h\275\267~F\347\242\300\201\n\243\262\244\323\257\351,\234\037\212H%\263\2608\253\006\250'\245\210\030\234\322\204\351\324\331?\372\206xB\003\222$\235>\275R\377\376y\367\230\274\367\346\300a\336d\223\316\031\2079\350\337a\224\013\370\237\242\377\201j\334kl>\325\250K\320\216XWqO\334{\225>\310{4\216@6\227J\244\027.\345uR\022\221M\246\021\351\304\225\274\340&U \357Q\351s\233\\\311\333\274>F \235\216F\244\323U^p\223\027yTr\324]*\221M\256\344\bd\223K\211l\036\225>\227y\223HfW\222o\363\250\224j\036\225\214dr)o\223Ky\302\215S\222()\273\243\035\213!\235.\016\252\254c\322\347\211d./\334\275\\\366t\223\005\334\233\265L\302\035}pZ\323\023G\023\225\343\222\231\367\336"
+	.string	"\250\232\204,\257\323\023\371\265\274\367\253\t\351R\27502\237\327\b?\215]Yw\352\351^\001\250\3565\362}\336{\215\367\336^2\213y\357\017\037\244\027\025\325\275V@T7\313h\345\351\336.\033\223\246D6\205,\211\254\2205\275.\024\323\310^\027\216+\2516\215bw*\215\352\245\3241\347\306\f\323\251\252\242a\271C\207\352\344\306\334T\247\177\353\350\034\250\224\2701\034\235*\201p\320\276\314\360C\247G\317\3247p\307E\013\217!\323@Oq\031\226\343g\021\n\302\306\310\271\361\342\365w\f]\3258:\252\241\032\331R}\243\251\372\251\235:\311\316\236\352\3736\366\361\315\274\327\t\b\272\266\236\342:nsd\363b\373!N\315\032\267\2714po\3268\256\233\312\300\350)\266c4\036#s\200.XY8\334\313\354\341\341\264\303\230"
+	.ascii	"\351\321*\225\227\\\202\007@\235\372N\243\276\003I%=]`K\232U"
+	.ascii	"[\351\rl\262\322tz*\224\252\301x\354V\361\231\230\fmAj\224Z\234"
+	.ascii	"\2250\352\203x\277\t\002\225B\337t\256q\354V\365\316\232\020"
+	.ascii	"yBw\221VA<Rh\270\206\240NG\245\216\336p\001\343f\204D\310\310"
+	.ascii	":E\243\316F\322\220!\241Pd\2222T\354\244\250\350\023\003Zm\202"
+	.ascii	"\270\211\241\310\227\032\300:m\264\351fN\245\006\246\325)z<\232"
+	.ascii	"\035*bE\262P#\332&\344\255\251\323\266\353;v~\r\275\347Q\203"
+	.ascii	"2[c\252\207\201\277\306\353\272\267\233?'Gmk\b\027\016m\376\234"
+	.ascii	"\336\2240X^K\324\253G\346\316\316\236k6\033\334\2432H\213\221"
+	.ascii	"\353\006\264\256\013\021\036:m5\275\206\235A\r\304;\r_y\216\023"
+	.ascii	"\3636s\302\244\321*\353\364\352Q=\007\361z8\210\227\366\346\344"
+	.ascii	"\344Z\311\006>\367\016\001\222\266\323\224\344\362\203\007\025"
+	.ascii	"\312\333\311\316\206\322gP\244\325\3251A\224\\\026\013\035.F"
+	.ascii	"\346\222\235\232\351I]\235\225IQ\317aV\372\n\017\255\0266FKs"
+	.ascii	"\271\301\255\323\326\372\215\237V>\327\251\n\032\27101\215\245"
+	.ascii	"\325x\214#\356\355\212\363\212\3532M\246\341:L\217ag\213\351"
+	.ascii	".\357*\215v \"1\235\005NND\2305H\236<\251\225\233A\321\204\334"
+	.ascii	"\340\211\031\242\267\366\322_\370i\345|\326e\001\323>\260\263"
+	.ascii	"\337\016\304\274\n(\020\300N]\034\335\023\336\227\036t\322n`"
+	.ascii	"Au\332On\256Iu\311\320\306\316v\353\201R\362\306\206N\233\355"
+	.ascii	"f\242\2147\244\216%\345a\305\t[\227\372\336\226\372\236\262\267"
+	.ascii	"\250>\310i\365\244\324\367\240\324\367\216\352ym\324\363\326"
+	.ascii	"\\QkvQ\323\246\306h\375\3066\325\364\203\252\202K\360\202\314"
+	.ascii	"\372\254\251\3749=9\244\0219\213S\337S>\230\301\355\254\323\224"
+	.ascii	"\217\205\327R\336e\177N\257!\361\242\002\243\276wh\262?\207\007"
+	.ascii	"\316\0063\261\346\331\235\232\253N;\212\372\304\253\222@\b\255"
+	.ascii	"*@\260:}G\371{\214\347\230\314\205\2737l:\335\341\037^3\211\336"
+	.ascii	"b\"\332\262\310A\351T\207\227\304\211\223\326A\275K\356N\020"
+	.ascii	"\261#\035\366\326\301\211\032\323\007\243\235g\325\304\331MZ"
+	.ascii	"\007\020\363\346\020a\226\266\205E/l\353\214\231\035\223\263"
+	.ascii	"\263\231\364\020\036\273\306\023\340\252\302\350\356\265b\221"
+	.ascii	"\303\346\203\031\2231\352\327W\203%\361zk\243\353\347\032\035"
+	.ascii	"\264\276\346\r\366\345\313\206)W\220\260\263\221\264\222\234"
+	.ascii	"I\303\241\005>"
+	.string	"\2345\311\306\257]\362@\200#\t\001Y\037\320h\bhd\342H\030,\026W\340\220\r\001H\243\r\n\203>\302 \333\026\207\326\242\245$\24008\304\026\227\206L$%-\t\205Ca\257\365\361X\030\n{F\2775)e\"\002\225V%\336\221\204:\250\301\201\bC\355z\304\376Z\025\255\317E\0033Vv8\243\207\2118\234A\034:\"\376"
+	.string	"\205K\"\204F\215S\364\351\264>\341\021\021GxDDW\027\202\305\264X\\\331\242\242_\217\2118\004\246lKD\213V\341Q0\351\327+Z\213K\251p\030l\201k\261w\326wD\024\332ab\333b\360h\245\201b=\022\376\220\200@\255pe\331%`"
+	.string	"?E\277a\222\t\246\037\313V \202\217"
+	.string	"\023-\204Z\366G\024\232\301D\034\002S\264$\016,\372\204\031\3208\"\24680\310\256\302\365H\375\213\030\f\304\220\321B\3572 h\001A\013\336e@@D\004A\f\"\3651\210\320\026B/^$\021\225\326\326\327\256\305\225\365\001\320\036\351\200V\270\002\331\225h\342GFQ\320\003\026\251\355\311`\221Z5D\021\310\366\206\304\0260"
+	.ascii	"\262\274\"N\b\034\\\300\"\325\0202\025\365Z_\f\"\265\025\006"
+	.ascii	"\207D\025~+k\303\367#\266<+\221\251\365\265A\245`\222oMj\333"
+	.ascii	"!\213\324\376\034I\350(ht\342C\342\312\016\265\303!;$\242\350"
+	.ascii	";\n\032\t\2073\224\326\266\310T\344ia-\022rP\024$\366\320XW\b"
+	.ascii	"\266\300\337\210\243%\033kQ\210\"0\330\026\203\355\257-\372T"
+	.ascii	"(\376\332\036$`\033dA\204\3420\204\030!\224P\0018L\002\262\353"
+	.ascii	"\nC\337\022\021\270\263*\005k\254\300\037\253\301\2210\250\304"
+	.ascii	"V \004\201]Y\030\022M\264>\031\2550\270\324;\021\321\f\025#|"
+	.ascii	"\240\201\n\024Z\223\202FC\226\350[\333\037\2334d[\341\0208\004"
+	.ascii	"4\032\022\006\177JC@\2668$d\300Z4T\362\261k\322R\321\212\004"
+	.ascii	",\362\260?$`\312\256A\243`+\\\2138(b\177C\033=\\Gr\322\340x\262"
+	.ascii	"\326)\272l\024\b\032\344\350\022\335\322qb"
+	.string	"\242\313\224W\3600\257\300\301R\3031\n/}\216\021-\260\324\354\252\210\220\254!f\320h\261\351\024\265B\255\320\0379F\022n\350\260\262\350\256\325\216\240\037\275:\372\243\263xf`\342\243,\007\207\372\243=\216\372\230\353\021\004\253St\007\312\203\211\327\2248\347\315\234YRF\355I\247h\016T\307\213x\231]9\232\313%\351\276\350\306(Q\251\036\016'uD\002\201\255\250\2210\207\2303#3\"\"2\222$\351\361\004\204 '%t\347\001\022\300%5S\031\211Df\202\031)(H)\303\032\275\325\335\253}\"\222A~pu\322\277)\266`n7\027\306\366\327+\262J&\235\254L!c\020\373\246\277\214\020\351~\360\272\b\261\267\227\243\202-\005\026}\274w\214\362\231\230\324\227Z0\2516\331\236\260\242\205\356Y<\267\317B\007\320{(\252\327ba\253^=\370ew\313\204*\203\341\330\035\27000"
+	.string	"\303\314@\2414\226[\237\362\306\215K\031M\033vcuWv\367\237%I\205P\321]\016G\304\201\360\217\240t\003\244\215l\242\237\240\242\321\250\242\240\035\222\021\205]&\355TS%\373:\276\215\321\223;\270b\006\305R\331+C\321UC+I\362O"
+	.string	"\r\317x\022\314\031\375\242R3\307\230\223\331\364\341\372\371'p~\216r4\266\346h\202\306\b\352\206\260\205WK\036f-\211\323G\243\315\326\030%\201\226\200O\210lUJ{X\336c\302\373\211\343\253M\335\253\023\033\235\301\264\276[ \367\240hm\234\360\017\225+\321\301b\374%,/\317~\324g\177\273\ni\312\300+\r\331f\264j\256\222\341\370\371\313\205\203\326T\233\335\261[\237{\304O\351\206\020N\320\003\235\035\274\224\373\313\372<\201\320\256\311N9"
+	.string	"\033t\030+\231,\230\357\310\224}Y7\037\340\323I(\231I\2766\334\220\302#\211\232EF\331p.r\265\357\032\240*L\204Y\013\254\346\315\270\224Z\"\027(G\033\016C\007@\274Lz_\362uG\232\363\313\3204\372\335\320[P\207\031a~\222\204\227\244\251\\\3158\r\301\002\347\203oN\340\356\307KQ\b\"\023E;|\3249x\227LF\374\3702R\245\242+\213\020/U3|\b<\330 \033\244\235rlA\273\263AW\310"
+	.string	"G\226\225s\340\305\310\215\2625V\242\376\236\262<\343\210s$\273\373\270ws$O.0C\336T+= \371\242\002\215\361\233\034J\311C\315\355\016\366h\256\326\317\342\016Cli\213y'\360\332\027\336\21706\204\003)\350S\366\202|z\333\366\213\n\nv\272\026(\211\204"
+	.ascii	"\216[i\207\233\024\001\006\364W\335\235F\326\020'j\200z\320)"
+	.ascii	"Y\257\r\2367-\225\237<.\246\302\232\023]-\205\324Z\237\307=S"
+	.ascii	"a\252E\265p\233\251R\264\025\311\315E\335\323\220\200B\003\f"
+	.ascii	"+\361\023\270]#Tu\362Da\225\324Z\006\367aZp-\354\235\335\026"
+	.ascii	"\346A\035\220I<{\374\205\374l\343N\330\305\335\276\025\t\247"
+	.ascii	"\234\337\234G\236\334\"\343\210\377\334\316\356A\352!+\r\236"
+	.ascii	"\\\035\301E\020\300\305\003\243\324\205O\201V\202\271s+APX\252"
+	.ascii	"a\333\212]?}\223\2733\037\004\364\037\221e9\244\345\303)=\245"
+	.ascii	"\334\246\034\222\034\222\274\201\201'\245\331\307\310\302\222"
+	.ascii	"\305\301\257\220b\206\232\333\210\351E\246\004q\250\343ag\305"
+	.ascii	"U\235,q!S61\034r\232\256\335\305\272\203v!\205'\217\346\364\024"
+	.ascii	"=+\314\021\223k\201\353$\250\337S\306\314\237\342m\327M\245\211"
+	.ascii	"t0\225/\242\207\024&\316\306=\221\016\n\0176\370\222^\25100\035"
+	.ascii	"\350s\020\236\315\2747\223\237\277\217\216\\\264\021\237U(\027"
+	.ascii	"\376\003b7\212'\261\235\225\331\017\265\257\n"
+	.text
+	.section	.gnu.lto_.symtab.7664c3ad8f445ce7,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7664c3ad8f445ce7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3385 @@
+	.file	"fc_core.c"
+	.section	.gnu.lto_.profile.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\t\004\355\023"
+	.string	"\324\027\375\004"
+	.string	"<"
+	.string	"\372\207\323\204\007\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\231\357\210\200\005"
+	.string	"\n\350\326\320\274\b\b\001\002\006\002\001\002\007\r\254\346\242\270\006\030\b\002\t\n\002\n\002\001\002\013\002\002\t\017\240\342\234\212\n\023\367\224\352\360\002\022\002\001\002\f\001\002\r\002\001\002\016\025\026\033\243\262\274\213\017"
+	.string	"\034\250\200\234\374\004"
+	.string	"\035\246\270\273\243\003\006\004\002\016\036\331\236\330\362\n\032\001\002\017\002\017\020\b\002\b\037 !#$%&\234\276\301\203\013\f\002\021\002\022\002\023\002\023(\233\304\365\321\002\002)\214\233\312\236\002\002*\301\212\240\304\005\f\001\002\024"
+	.string	"\002"
+	.string	"+-\271\300\243\227\b0\001\002\025"
+	.string	"\002\026\002\027\002\b\002\002\t/02\311\202\342\200\017\r\017\002\0173\376\336\373\325\016\n4\204\345\257\223\003\026\002\026\002\030\031\002\031\002"
+	.string	"\002\032\0138:\310\351\233\230\003\n\024<\266\231\367\251\004\032=\315\347\335\233\n"
+	.string	">\312\357\204\345\006\016?\205\245\273\201\t\220\005\004\002\025\r\001\033\002\033\001\001\002\001@ACD\350\300\306\254\005E\234\346\300\362\007"
+	.string	"F\354\301\314\336\005"
+	.string	"G\321\300\237\354\n \001\034\002\002\tHIKL\354\206\342\366\006\002M\342\201\222\246\004NO\202\321\330\342\013P\374\202\331\242\rQRSTU\240\342\234\212\n"
+	.ascii	"\200\206\250\321=!\222)\005)H\2265p\002B3e\036\021\360\\D\320"
+	.ascii	"\ri\3313\324\237\242s\f\332\231_\230\211e\t5\371\327\332\340"
+	.ascii	"\230\242a\037\236M\256\021\314[\333\3264\265\225r\003\020\032"
+	.ascii	"\330\r\315w\2017\313]\200\276\377?j\003\272\202\335\f\223\313"
+	.ascii	"3\345M\347X\211\346\274\242a\225+y1K\364\262r\037\227\001\346"
+	.ascii	"<\226Y\235$d*!1\326$\271!\237!\023\177\024\367*\261\273\007\f"
+	.ascii	"D\240\332\360\305\217i\\\376n\030\237\030g\n\305\256Yb\270\357"
+	.ascii	"\221\347\214\203\350&$k\r;\276\306&\027\007\030u\257\213\255"
+	.ascii	"\262.\314\271\354\261\333\304S{87\277\222\020\342\373+\035\271"
+	.ascii	"\0336\247\313y\276(\342_\201\200\263\312M\254}:\272\237\337\007"
+	.ascii	"t\312A\357\016!+\274\370\034gB*\320\313\236\206\221\212\263\207"
+	.ascii	"B\035\351\245\276a\210\032%}\222d%3D\005\0067\312\274y"
+	.text
+	.section	.gnu.lto_.ipa_sra.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`D\001%\006"
+	.string	"\"\007\023\025\020Y\322\001\0179\250rO\251\t\347\322\272\360\376\201#wJ\001ngr\346fj>\363\230k\227iy\337\025'\345\311\224\250G\366\261\216\2751c\241\330\304\036"
+	.string	"\024\256\272D\225\252F<3\035\f\273\250&\350\017t\n\326\307\202\004E\250\320\2268\231\326\260\2021\263m\020X6R\332\244\320\0303\020B^\2142\007\334"
+	.string	"\017\245\220\013>u8\006\030"
+	.ascii	"*\211_\351\312\037\303\360/s$=\211\026\267|\201\316\312(\005"
+	.ascii	"\326\325\354\256\202\264P\205\240b\304\263\304J\257{)\346\256"
+	.ascii	"I\230\226\034\334,#\252\256F\032\273\243\031un\222\365H&\241"
+	.ascii	"\026r\006r\f\"p8\242\326x\337\216\347V\253\037"
+	.text
+	.section	.gnu.lto_.inline.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`P\t5\033"
+	.string	"\306]oJ\260\224U:\271\t<\363\303?\203{\354\205\034\344@\333y\252\362\256Q\231<\224\245S\225\232\013\330\017#\205\230L\247\350\235\322\237m\203\353\034\376v\324o \357\311o\361\322\305\335I\370\332[}\321\273\335\361\026\231\300-\245L\001\\"
+	.string	"U"
+	.string	"Z"
+	.ascii	"\261\375abH\016\255\201Y\026\301$\037z\343\003X\266\263l\013"
+	.ascii	"\333Z\n O\213leh\312\"\204\227\224\224V\243\007T\t\"\366\234"
+	.ascii	"8\275$`]\234\213)sN\366\327\330\036\365(sN\017\240\372\337\304"
+	.ascii	"\373mmw\367\370\277x\007\221\020\214\325\376\nc\336Pwk\360\247"
+	.ascii	"^Z\005)\373\334\r\250\206r\006.rq|\206:\362\013\376\177\330m"
+	.ascii	"\361\374\nI~\347\347\367E{\274\t\037\265\372\335\351"
+	.string	"n\323\023\360\013\244\342\217j\177\226q\315h\006\022\226\247\206C\335\214\003\330\252\320\315\360NG\031\b\321\335\263\377\305.\272\033\300\013\250\352U\304\370\007A\025\373\204\277`\312)\274\006If\b\301M\320\350\207\372\004\\w\273\274\230\330\335\n\336\242':\272g&g\371U\365,\233\316l|x\bY\351\321\024oT\036\341g\331J\346\257\363\036\270\210\004\215\331\3166H\207\326\323\033\377O\255^\317\261\335\371v\276\023\377\200H\021X$g\355;p\330`{\361\021\020n\347\2621~lz$\\\303\3623\264X\006\016\336\220\251()H\022\002\307\260*\365s\316\227\005\022\t\265\230'\337Z\332\370\313VX\24202o\323\306\212\035\2750\246\026\304\367\f\303<#\216\224`\234[\300\305\224\271\024\016\251\b\004\345\252\003\352\332\256\020c\035\341/\200\304\250\361\251\031\0311\031I\212\222\341P\"2TE\346\001\022"
+	.string	"\002q\204)9\n2\206\030*!\221\246\240<\013\303\034\026Q-h\007nk\023\330B\216i\351\237\220\373\223\216\236\372Vi\235\216@8\177\177*U\212p\230E\305m\036k\346\356\020Pp49\037\"(Cf\310gie_\260*\207\217y\316\224x\364\371\370\266\200\2007F\243A\020'\035P\343\302XO\210R\256\226\t"
+	.string	"\242\222\021\353E\240\016\003\321\005\206\007\001\330\377\240\342f<9\205\tW\343+\313\257\024f\265M2c\221\215\300\3241\226\331\376\301\341\211b\320\313\345iA\342\020|\r?\362\236:s%<\234=[UO\322\324\362\313g{\003\345\332\265\320\200=\252\335\242\243\363\251\t\325M\017\215&L\277\200\233\026~\204\354\346z\373\356\200}\212\001["
+	.string	"&2\205\025A\177\363\032\355\233\330&\335\330*\035-\306\230\251X\320\"\235_\327\274\235,Nu\335\312\317~_\353w\372\312\331:\312\004xR\207\006L\376\233\206\021d\032\035\305/G/\352\326\303\b\317o\376\213C\301oJ\n\350\304\232|A\371\362r\033%\"u\353I\311\347]\332\021_"
+	.ascii	"\300\323\2259\274\221\376\306eq\013\234\035\273[\341b\2261w\206"
+	.ascii	"\223Zp\222T\004\2713\310\026ip\034\231\201\331$\240M\362\036"
+	.ascii	"v\243\205\217\027\365\031\325fT\220\023\271\322\317\302\247\267"
+	.ascii	"%\364\032s\3140\271\035$\212\374\372q\"R/\345\005D6\367\247\346"
+	.ascii	"\355\247\246\350a\255\n\274N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\bm\026"
+	.string	"\346\027N; Q\224\341"
+	.string	"\270\r@\264p\300Q|\254\207v_\177\375F\034\rA"
+	.string	"\301\"\304\372.\004 \004 \332\224\354I>Q\006\017\237`db\244`K\241\331U\373?\301\376\335d\222\0017"
+	.string	"?"
+	.string	"@"
+	.ascii	"\357\221\370\367(j\304-E\024-\342\317dr\350i\372\363{\273\017"
+	.ascii	"k1$\277\224J\245\022\335Z$\357\003\230\262V\273\003M\310\227"
+	.ascii	"\250\275D\263\355B\254%Iq\272\021\244+ck\037\330\300-I\254RA"
+	.ascii	"\325E\036\001Y\200$\001\222CL\031\371\001\022\tc;\3177\304\232"
+	.ascii	"JE\200'\300+~U&\263\013U\325\333\201\336\307\307B\261\326\211"
+	.ascii	"7\033\023\355\265W\"m\215\325\210t\271L\022\351\027\223\3578"
+	.ascii	"0\nd\224I\361\300\301\246\3014\225\001\271\200\026\213\202j\r"
+	.ascii	"\343\032\326A.\231\300\275\353\300:1\314\342\026\316\003\337"
+	.ascii	"@\367\301\201\350\031\226\264I\203-\211\004$/\220\026\310\n$"
+	.ascii	"\005\ff\247\201u\002%a\324~\004\022\302{\225\212\207\007\207"
+	.ascii	"c\343\216\016P\3105n\247\211B\331y,\226\020\016\216\031\267\235"
+	.ascii	"H\304\305met\332\030\267\035\326\376\002\301\270\001\200\345"
+	.ascii	"\250Ae65I*\245a\r\240\002\021\242\252u\022\2401\262\026\307\214"
+	.ascii	"2\250\206F\233\244\260\354\033L\016\217\355K\355\\\2451<^f\234"
+	.ascii	"\006\313\260\305\201\360\241X\204\331\317\321>\366\235\23650"
+	.ascii	"\246\031B\300r\271\302+\366\355X\016\226\372\352v\215\343(q\337"
+	.ascii	"ix\36193;\374\224._\023\254\242y\"e\241\312\257\366\302\350\222"
+	.ascii	"/%\265\021\334\354\025\234\005_:a\340\032V\300\313\267a\212\227"
+	.ascii	"XL\336F\311\323F\343\3404\311B\331\031R\253f>L^\002#\212\347"
+	.ascii	"5\305q\363\0277\206\267\352\257N\234\\3,y\353\326Q\2431\261\277"
+	.ascii	"\200C\310\250R0$UWfbaz,]O^F\331\024\242\245\322\332V]f8\262,"
+	.ascii	"n\0078\037\252\f\322D\325\270\322I\267\350\332Ns%\031\232:%\335"
+	.ascii	"\206\300y\372\202VQ9\307\327\013b\t%\225\307\222sm\207\200\250"
+	.ascii	"\177S\360\fhR\256\013;\004{+\232|\273w\025\013?\244\361pWI3G"
+	.ascii	"\313<\222\022\fc\373\263\367|\333Hd\240Tk\227_\240J\266`\022"
+	.ascii	"N\273\3562\006\036\205\254&\253\272|\257\212h$\354;\253c\232"
+	.ascii	"$\260\356\224\246x\005}\364\214@\216\035\227\202MN49\244\240"
+	.ascii	"C\334\261H\375!\033\322\001HH\243p\203\336\265\025\241\001\312"
+	.ascii	"HLa95\234R\344(\227z\342\3644\027|r&I\024c\326s;\207X\212\347"
+	.ascii	"\375\034\357\002\346x\250\267:\205="
+	.text
+	.section	.gnu.lto_.pureconst.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 _u\002"
+	.string	"\362\205\022\033\200M\032\003'\f\021#\211\251\230\0270\361p\003\326\rjw\374[\350\271\230\201\f^\321(\332D\223x\304\013\304\037\232\303k8\303\027\232\302\023\036\302\017n\360\202\023|\340\002/\340\311\001\0369\344\217\347x\343\214W\252*K"
+	.text
+	.section	.gnu.lto_.ipa_modref.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`L\001\235\007"
+	.ascii	"\322I\035#`o\206\003\3100\f\3030\f\3030\f\362m\357\314\rktcf"
+	.ascii	"\224\222\b\267\320\216.^H\214\210\224)\217^\364\f\201>\364t~"
+	.ascii	"N\326Is\200\304\314\264\bJ\304\274\313\273\316J9E;{T9\205\375"
+	.ascii	"\216I\371\215\347\013\003\337:\267rm\004\031\331\344V\360P\225"
+	.ascii	"W\257\360\222\316H'\244\374\321\351\312\261\002Hx\360\363*\277"
+	.ascii	":\255r\253}&\356&6 `\2021d\326\003Z\231\203\006\207\306@h/\213"
+	.ascii	"\021>\013\246\023P\366\256\270h\254dA\033\313\267N\207\032n\244"
+	.ascii	"\005\b\305 \210\303\341\215K%\271s\310\320u\234d\b\266\035=\026"
+	.ascii	"h\354e\224\210.\201n\035\221s\211\210\360B\307\205\261%\"r\340"
+	.ascii	"\025\307E\020\003\300\034\016\235a\213\211{\310D\350\023\340"
+	.ascii	"|_{\330?\274c\026Jit\213V\r\343!j\"\334\302\r\001"
+	.text
+	.section	.gnu.lto_.lto.572919fe6c43f8ea,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.131.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \222=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\327\202\031\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\337\030us\355\007uq"
+	.string	"\005\001\006'\001\004'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/fc/fc_core.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.133.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_applyAndSaveAccelerometerTrimsDelta.134.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`*\002\305\017"
+	.string	"\226\\eE\340\224(\035h(p\036\373\256\2060\351hT6\266%z\023!`\021a~\032r\257wCh\343\324\252\346L\231}\220\030fCiaabZCX\024B.3GU(\002R\360\\\025c3\322\270\255\224)\005M"
+	.string	"G"
+	.string	"["
+	.string	"1#\013\2133(6\333O\373)\376\202z\250\362\001\273\254\230\314\256\213\201\025h\217v\335@\366\250\275@\366h\224\035\344\256\326\376\365\302\362\"\262\273\234\2328\352\211\362\257\342\236U\313\312\263\363`w\235\253\226\017\267\3366\002\333\r\354\f\003+\016c\362]\036\315!%\277z\364S\262\307k"
+	.ascii	"\030\036E\302T\306l\227*\265\204}\316\356\256\225e?\374\001d"
+	.ascii	"\032\244\351M\323\237L{4\255e\272\223\351L\323Q\323\234L\253"
+	.ascii	"\2463"
+	.string	"\323'\260\205\350\261`\310\256\207\037\033\336\177\264hv\264<\372\037'\302\216j\243\327\230\241!\323\321\3641\"\314t\206\214\0301_\t\211\232q45j\210\246\003\tU\306\254\312\201\341\335\346\346EIsa\001\34557.*\331\243\352m\200\\S\317r\304\030\376\362\034\264l\roQ*\361w\026(\tnv\267$\242\023i\024\301T\362@\n\031\272\2237\341\302\t\004\022\351\003\017\270#\031\201_W\2413\341:\023\356\304\023\225\270\0164q$!\177\033F w\372>\220\333\\\251sVY\226 \002\226R\225\005\244-\352\362+g\f\b\230JW\fR\0359p\334\330\024\364QM7\r\325x4, \260\202\231\032\355\"\241930\030\236\022\256\301>\344q\371\303\204\2737\214 \327\t&\331\334\353\320\264\034\ft\304\342q\035LA\240\024\267K\210\317\203\345\020\255d\304F\220w\035qm(\315v"
+	.ascii	"\311\250\024\343\032\212\243}\346A\233\3762\241\3675\353\253"
+	.ascii	"C3Y\333\354S\240\227\027m&\003"
+	.text
+	.section	.gnu.lto_isCalibrating.135.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\253\001]\017"
+	.string	"\006\\dE"
+	.string	"\261&\035\273\224\306#\370\216P\\#\233|\300`k\352\030\005-h\267\006\031\366I\373\362\336B\307\2150kI=r?\026\251\255H\024\031\223\376\277+D\265}\247.\257\365\377\022q\240a#{\223-eJ\001R"
+	.string	"L"
+	.string	"O"
+	.string	"/\375\223E\210=\315\222\317\375\023E\031Nw\243\323!\205\345\331M+\217!PVR\tKR\211\201V%$\371\336\001\0166*\240\025\352\rp\341A\306qPXR\003\254P\257\300\356\036\346i\262:eF\321\356:U\253\224\033\300mw\266\r\330\247\t\0260\344U\327\303<{Q\263<.\224rv\213K\355\354\277\335]\253\213\355t(\323\231\323\321i\3504\346\364K_"
+	.ascii	"\203\335\321\341\230\261{\322Cc[`+@\330\036\261AN\240`\304\245"
+	.ascii	"\267X'\221$E\312\304\316nK\323\017\001P\341\206\22726*1\020\323"
+	.ascii	"\314ILO\242\005\245\334O\0233\202\205=\335xy \222W=\275P\343"
+	.ascii	"\342q\235\224\263\262^.\025\3572O\375\353\223\366H$\257J\275"
+	.ascii	"\206\226\223rw\213{\356.\247Z\202W\217\0221P\3712\314\367\n\320"
+	.ascii	"\016\336:>H\243\255\301\006\242m Z\204\020\007\020\264\2154A"
+	.ascii	"\353 \340\221\204\017\222Fa4\"i\240\326^]\354\321\335\244f\262"
+	.ascii	"\320\002\030,N\314\350_\202\321Q-2\351\351\243\235\023\"xF\216"
+	.ascii	"gjbg\032\322\247j\230\262'\313\264{f@\221#\"B\335x\t\t% \240"
+	.ascii	"\202))\353\001\n\tx\302\370\241\2047\02085\331\316\324\032\302"
+	.ascii	"`\330\364^\033e\262\233-\251\233Fn\306=\332\322M\324w\261\005"
+	.ascii	"\3314}\\)\001\204/\024XF\317'\224d\231\270=\006Z\313\032\310"
+	.ascii	"\345\320\325\306\250\310\323\311\267\315\261\266\001\330\265"
+	.ascii	"M\350e"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.136.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \3445\006"
+	.string	"\222\013+3`M\222\016\300i\250#P(Ah\003\203(\360C\264\305\023\b\316\206\2105\321\332\2658R\317\267\252\206\31300\016\201\342W#\037\226\016\266\330,!2\005\277\211\212\360!<\213{\026\307\240\220\260\340^tp\223\300\260\201\212\356\001\302\350\244+\3336\007 \036L\213\270\240w\243\034{\334\213!\356\260Z\205\356\035\200B\321\310I\206\t\206}\376\272\260F\361\255d\333|\223>D\246\220\314\314'%=P\007\306_\351\352KzYd9$\022\034\224\314t\255\242UYu\253\321"
+	.string	"Ks)\213\f2sfi&z\353?\360\023\374\231\b"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_updateArmingStatus.137.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"E\t"
+	.string	"\246Q@8@\217\322\001\220/|\204Kd1~S\032\237Fm\r\b\244\3207\322\002\210\017<\245\374\246\372QcJ\350\365\026\323,\003Q/\257\307\f\317\243\024\331\327,\331D\356\224\0020"
+	.string	"."
+	.string	"1"
+	.string	"\030\007\035\323\b\362\257:\200\367\205\216a(\256\230@I\303\013\370:\254"
+	.string	"\004Q\271\352Q\342\033\305x1\330]G\357\233\270\345m\037\330&\260]\0226\253\213za_\3030l\261\242\354G\313G?\373\tt\245L\217\335R\310\262\"2d\303\3663\006\331'g\245\366-\024R\313\265\273S\003\252\241\247^\340\207Z\223I\275\352\230\221\016\223Q|\371\327dW\251\216$S\367\3259 \374\fG|\342\275K\377\223]^7\025$\026+\223(\206\001\3266\034n\323\020\264\316\324:\223A!aaj\234gn\006\2745p\270\351\260m\334\314\260D\307VQ\226'p\005\024i\207\355\356b\227h{\036\342=\007\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.138.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`:\002\r\022"
+	.string	"\346\240tG\320\362&\035\302\217\237\263fOk:1\363-4|\341\322<%\246\216\267\243\265\204\242\f\340s\002\016?\326\374U\345\317\022\351\001`g\220jG"
+	.string	"\316\032\f4\321G\265\333\206S\317\235M\2541\253\b!{o)S\n`"
+	.string	"W"
+	.string	"c"
+	.string	"?\331\305\266q\237\233\371 $\030\220\322\234\263[\233\273|\323d\204\253.\376w\316}\261\326\267\273d\327`*G<\302\021\243\031\214"
+	.string	"M\211\245S\fF!H\f\004\034\231s\236b/\272\360@\022\f\036?\222\221\301\220\030\023\337w\256!b/Um\301\234\323\372\305fn\356\266gl\027\260\325Ck\021\211\332\357|;\372\251\361\242L\376E\344\027\265V\230\354u\236\367\260\3708\356\320\242\377\036\375\026\371\370-\261\301!\301#s\351\017\333\347\245[c\037\316\245\261\257F\251\232[\365v\265v\265Tu\274\032^}"
+	.string	"\317\221Q\302\361`\306\2341?\232\346,\3068a;B\255\2705\326\247\244\266\252\202\302_\bi\253"
+	.string	"\251\307\345\"\036\235\033\230\222rY\266\205\273Hms\276 \360\203\336\002\305\307y\264\247R\311G\271ZQS\212\236\270\376\212\263\270\240\262\262\"\037W\006\247\366j\203\376\213;@\204\321\354\265-\303\375\371\227\343>\316\"\277p+\b\321\200\311^\277aJ\032\n\366JT\254\225\227\362R:/\245\313\240\202\202\241\363X,]I"
+	.ascii	"\2574\250X\035\207\325\212\325\235|\\\207si\"\344\314\\\373\332"
+	.ascii	"\030\354\266\022\314n\344h$\222[\326\017\322\310I\344\266\334"
+	.ascii	"\302\036\002\324n\340@\377m\373\001\305\320R\322M\244O\364\""
+	.ascii	"\023\b''\362\221\203\001\322\331\341\222!jK\230\240\377\fB\244"
+	.ascii	"\303@M. \200\002\031\251;\017cB\003J\340\273[\355\355[\261\302"
+	.ascii	"\316A\323\336S\335\264\b\340f!\274\203\226\305\264g\b\276,\350"
+	.ascii	"O\272\002\205\023xd\334.\022Yp\005\026\255\243m\214\243\234D"
+	.ascii	"\213\3316q\206!s\031\210\017\036T\333JB\f&\240\314\\\215\330"
+	.ascii	"\347\207k\340\003\034\017&J\242\243Iv\354I\235\2225\226\231\364"
+	.ascii	"\265o\017"
+	.text
+	.section	.gnu.lto_tryArm.139.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\372\003\305\032"
+	.string	"\246\257\247G\300V\325pt\f\215UP\276\260Hq\305\330\260ZBH\217vc\301I\b\226\232\237\240\034)49\246\366\377zL\267mx\204\263J\367N$\351\362\212U~\005\375\251\231I\320B\031'\305\030\345\366[\357\275\245L)\225"
+	.string	"\207"
+	.string	"\225"
+	.string	"\037:\221\212\013- \b\324Ox\236\347\352\244\255\302^\235\034W\256\331V>\334q>I\215\234\321\226\363<_\253\343\265\307\254T)\023\246$\307\325\232\257\342\361<\306\006\207\217\357\253\247\235/hWCUH6O;\032\232\272\315ws,"
+	.string	"\264\021\365\247]ot9\021s'r\233\240\235Oa\202v3\\\360rZ\30689\303[\361\"\026:\276\370\216\t\240\226h\231\341\341\306V\017\220\356B\327\026\274\233*\314\315y\236V\035\317\347\226\271m\242\355\007\3666\t\306y\222\021\346y\342\032\370G\216$\307\3779\351\231\t\275\316DyR\367BW\037?Y~CD6-\332\303\233n\320\376\026\213\305\242\027h\227j\232U\267~t\263V-S\252U\245:E\252\315Q]\256\232\034\325\273j]\365\0074\020\362\363\361\360\255\224\341\331S\354r\022I&>~\364#\335\310\215j?\362\222\0137<y\030\252@\t\025\2344\002\363\244\353\255\362\344x"
+	.string	"\345\205\037\276(\305\205&{"
+	.string	"S\330\001wr'/Y\260\222\225\312\223'\372\001\037$\340O\230\305\246\305\224/p\270\320on:\230\240 \231\033d\362\233X\226\234\3347\221{\"G\020d\032\322\263iQ\233V\364\374\200AQ.\215\332\0314\350ukN\t\362#\n\352\266<e"
+	.string	"\365\2136pX\262\246\2241\237\376\232\262\2652k\315\365nW\362\244\016\376\217=\300`\345\311\326\276\350\n$#\312o\2507\316\350\202\3332\021z\235c\230\206\210\270\345\371\016.PI\273A\217(u?\024\241\202S.v:\263\035\230\f\003\b\031\211\017\260\035\034\t\"tprh\260"
+	.ascii	"\2161\220\321f1\017\261\020\257X\210\227\016\016,\347\025\243"
+	.ascii	"\355\274\030\b\360\254\204\214\366:1\233\321^\253\241\3557\266"
+	.ascii	"\275\215\347y\236"
+	.string	"1\006\224f\355\332\220\232\220^\347\027N0\210\254\245Y\253\016\013k\237V9\242\020\2701\004\2566\310Z\325\036\007\2616d%\325\256r<\211\352\2714\2656\204\b\345u\254u\231\233Z\322(\367\245F\355\t\024\364:s\217\364\003\321\360Bt@\274\002D\265\301\245\227K\253PF5%)\270\003U\250Q,F\225R\214\214H0\022TA\222\341\200\002\021\271;\017\020P\347f[h\f\362H\037\235-m\255\347\233e`\217\255\367{\007\f\203+\023$y\337\020\316_C\377\001v\002\305\023\343\343@\021\020\367\036\3179\232Vw\037\366A\335\220\332\024\210\303D\006O\305\260S\247\364\023GA\266c\006\337\354\230:\350F+\324=\366K\334\377.\327\353\235\243\317a\3078\216\250\251\262\372\3625\367\347\242\371\227\361ed\277\013\240\303\237\021\274\226\252\312\240\304\256Ft\344\330.\023\376b\353\346\005\360\251\201"
+	.ascii	"\3056\020\006@&t1p\200W\374m9\375Z%S\254P\003"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.145.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`H\001\335\f"
+	.string	"v\025O@\020O5\035"
+	.string	"\277:\224\213\023\3205\2124\244\272G\351\240\376\212\224\270\240\306\363\375c\247\324\253\2601[\351~\3469\007b\373\331\353\211\001"
+	.string	""
+	.string	")"
+	.string	"\2705\"*0F:\234\0036![\312\224\0029"
+	.string	":"
+	.string	"B"
+	.string	"\273\253)\206{\216]V\324\364\370X\005\300\007z\307.CF\267&d\240\204\214\001\300\321U\002\206\"\201\335}\207'\005\020\224\211Uv\327\371\201\026n\310mkl\027\260\237\021\337-\237s\335\272NBS\tE\372\344\207\235\362RO\366\343\252\311~:>\235O?;\207\211\025\013\315\210\335\n\0371Ve\235\320`\373\231=\366\212\2472\366%8D!V\001z\212: \324\210J\"\252\370Z\244F\275\350\202\210\007\251\223\220C\tE\212zz\347\332\200p \334P\362\320q\215\203\310\\x\254:rw=u\347\272*\330H\021\312\027\366Q\377\320\36138\002'\037\336(\226\216\333\020l\027m\273h\032L\202\214\266u\033\215\"\300\034\003K\2479\340\270N\313R\373x5\331"
+	.ascii	"\f\325GA\021\213d\344\230\313^\220\221\240\360P\205\366\202\244"
+	.ascii	"\335`\223\377\254\352\335\n+ \240\202\241\301\036c\020\200 \\"
+	.ascii	"Q\336e\f\335\235\2604\250\2105\225\367X\031\346\274YAZ\375j\260"
+	.ascii	"\200\235s6f\032dGcs,:\235\213\fgH\367\006\246\204\306\030\334"
+	.ascii	"\035\327R\021\306\r\366\003\364\303mG\370\357\270\303\374\222"
+	.ascii	"F\245\352\372\325\227dg{\343\362\266\213\352\001"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.146.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375``\004M\031"
+	.string	"Fj\226K\260\022R:r,4m\367zM\204^\301\330\315\346l\226ys\365\032\303!\004\352\374\245a2\255x\217\244V[\333_j|\311\350\006[S\316x,j\363(\337\300\353\016\332/\"\370\300[M\n?=\332\236\224|B\b\2212\311\205"
+	.string	"p"
+	.string	"\202"
+	.string	"5G \025G\211\204bw\237.\315.\324\207%\352i\342\310+\252\252\265\306\232\3474\017\201\275\\i\013e\235fI6\323\354\321\236\017\367\020\030\220_9#\330u\256\234\350\334\344<=\321\271\301y+\004\243?68 \230\245\303F\304\311\217\315\217\317\0177y\034\270$Q\242\216|\220\324\234\350\245\276\rL\246\276\0357\314\307#\007\324Z\037t\356\340\3231\237+\265\326\345\236\357\346+\362\335\223\354.\201]\262$\375\240\267R\374&&\367H/\363~\272\263x\013\n34\232\371\222[\305\351\\k\305\365\336\3147\f\361i\307W\273\027\372\320m\357\263\027l\374\336\313\275\315|\371.\021\356"
+	.string	"\205~9>\356\016u\334\301\335\223\265wv\231w\204y_\347u\2357=o\353\274\350yY$\357Y\362\232\314[\222\274d\3636\363\362y/\340S\306*\251\f\305Z\003\273\306\235\035\244\201&\025U\0318\213\2717\376\210eAK\213\371\362l*\002\2422;\270':\253aP\304'"
+	.string	"\274g`\3566p\300\357\261\372$\"\261k\\\243"
+	.string	"\225<\224\035\334\263\311v\351\020\227v|\265f\237\017n\004\201U\353Ne\037\3432$\270\274\274\230/\315>S\317P7\331\347\005\311\355\246\034\206\214Uk=\260\177\361\342l\357\363r'\310\310\230/\273o\344\204\224\343#\23741G\002+K\231\325h2\027YLL\026\023\253 \3632\023\223\325l\261\224"
+	.string	"K\2630\253\3050\320h\265X:\314\275w\312)\243UT\256u!\035\274\361\246\033\002[\004a\017\240\220*\307G\036\351\217\031@\260\016\272x\231\256 :\021\377\352r\307\253_tz\271ZC\016W\027\0202\001\205~\256\337\314%\264\311\b\210*\355 \322\225P\236b\025\325\016k\255\255\264\031\312F\202\264c=h\253k5\024\264\272\223\212*\226\2056\214\b\3323)\243UTf\250q@e\225RA\321\222\244(\225\016\220\002\031\2613\017\020Xd4b\230\326\323\271\013t\336\213\226\240iv\320`sk\035?\340\313\320\315&at+\360i\312\240\254lJ\313\t\321\002\350\343r\033'\344\r\340\001\001\bC\324\210\235\233\3519L\233w\340\256\326\242Z:\203\304<\230`\362\3261\355sr\022\034F\270\210\b+*"
+	.string	"*\314\315\034e'\223*\216\212{\335\303\346F\253C#5\311\0224\255\306\347\333\273\354\251\241q\217\034\224EK,"
+	.ascii	"\255\024>:\2221{\007\0337Cp!0\230\332L\t\364\356OY\240\376\322"
+	.ascii	"\342\225i\377\232k\f\360\307\240\246\177t\035\360e{\311\340\247"
+	.ascii	"\271\035?\262\342By\\\275\370f\336\037"
+	.text
+	.section	.gnu.lto_updateMagHold.147.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`1\006\325$"
+	.string	":B \016F\200\234J:[*\372\317\356l\026\215\300U\021\222I\364!j\tA]\343\035\254\220+\004L7lkv\344O\307\254P\225VK\266f(\351F\024^\t\034\025\201.\344g\261\353\241\352\203bk\215\020\262\t\2212\311\306"
+	.string	"\277"
+	.string	"\322"
+	.ascii	"&\363\226\"/)\362\322\346\035E^\261y\273y\231y\037 \311\215K"
+	.ascii	"\212a\255-\342\340\324-c\224\037O\362\233\235w\237\206\344h\347"
+	.ascii	"\223l\225\025J\351\365\243\207\200\362#\017\357\376\310\376\354"
+	.ascii	"d/;o\266\303\222\013,h\306\220G[\255u\300\307\215*?*\035\210"
+	.ascii	"~\024\357C?\262n\317]3?\023\253\037\212\001\323\334\324Zy\255"
+	.ascii	"\343\347sv\272\234Y\222t\024\233\317=9ez\205q=\207\234\332\325"
+	.ascii	"\270\256\306\f\316\311\270\031c)\b\230\f.\227p\270\b\236\f\246"
+	.ascii	"\001\231\276\370\250\023\366K[\301\242.\254\213\273\013\030\r"
+	.ascii	"Q\251\326\372\261\363W\230\217\231\234\252\265.{\205\271\370"
+	.ascii	"\352|w\315\354n\201]\232\013ko\312.>\212\226g\321\005m\214\370"
+	.ascii	"(\372.{\031\030\364]\355O:\354}l\225\225\025\375\370>\334\216"
+	.ascii	"`\217\343\316\265V\256n\341\016\337\266eW\255\275\246\245\376"
+	.ascii	"\330\313.hl]\354\266J\275\324Fj?7=\216[r';\274\2220\265V\004"
+	.ascii	"{&o\362a\357\343\343b\201\340{}\334\203\3305\372Q\251\177\366"
+	.ascii	"\002`\326\212D\351q\334\356\231\217[\270{\261\326Z\267s\354B"
+	.ascii	"Q\336'\247&&\223w\351f_%\222\027\351\350I\276F"
+	.string	"\315[\324\274D&\357\220\311+D\362\006\221\274@$\357\017\345\365)y\001\220\274=\224\227G\344\335\021yuD\336\234\221w'\362\352D\336\234\310\033\255\203\3249\235\340m\211\230k!\233\235c\237vS\270\006\216t\352\025\373\353&\350\256\217\003m\314:8\227\007e\255]\006\366Z\276\005B\004\t\022\350\307]\233U\330\212\224\3658\256\324\265S\307\t\376\004\315\265\256\377\263a\324\271N\361\006\204\353\221-\334\257\24126\365\205k\312D\2466\352/!\337\242F}D6\206\226\245\213\335\250\331M\034\346'(\331fSp;\363\263\341\333\263Z\353\330\302U\241\366-\312\324GdB\320\330\310fjV\003\302\321\026\233\354\377\200\214M\255\374\312\326\204\n|\257\n\364\343\330f\260[\354\003\341r'\242\334\335\364\313\317\210\317\302\327\266\b\210\355^\370\024\fNaj\255\006\242\\\212\206\rTT\364#\367\323>"
+	.ascii	"\030WX\036\032\005\025o\225\224\225VV\025U\325\025\257\352\212"
+	.ascii	"'\002\253C\b^\225\026\t\236\324\320f\215\260\322\342\225\310"
+	.ascii	"\312\322\342\351\316z\027k\347X\016o[z\355\313)j\267S9Q\0275"
+	.ascii	"\253\271\331\202j\203!\211\rQ\200%Y\272\326\312\265\033j5;\024"
+	.ascii	"\022Ks/4B\255\324CA-\324\375\345\327\226\004\324A=\024\347g\344"
+	.ascii	"\247{\032\250E,\277 >\375\263\247\220\267-\270\0222?s\016Qp\022"
+	.ascii	"\271\231\263HY&\3039v@\254\326z\037Y>}%;\312zb>&\353$;\315N3"
+	.ascii	"\372\021@\037\330\021\204\352\236\376\213\267*@8]\013\227M\251"
+	.ascii	"\377F\033\026%\201#!\321\247\022My$\312\323O^\376e\001\203\006"
+	.ascii	"\r\350G\236&a\260\275\t\3564\224N\347\364N\377\027\304\307q{"
+	.ascii	"\024\200\202\250a(%\0252H\231\031\031\322\202\024\244\325\200"
+	.ascii	"\002\231\031\273y\020`GS\223\306bt\307Z\004\220M\302\331\242"
+	.ascii	"\026\1772\326!\231il\302\216T\346^\302\004x)\306\246\203\331"
+	.ascii	"\263\366\245\335v\300\"y\215\016>\304\206Hn0\263`\232p\301\003"
+	.ascii	"\333b\213D\314Pu\217\206\fSu\374\323\263\227\235\027\365\022"
+	.ascii	"\316\210nMlJ\024\270b\022\347\3437_\032\204\353\177\267\006]"
+	.ascii	"\"*^\301\322\211F\241\t6\271p4#\244r\255\177\306\250\030W\335"
+	.ascii	"&\232\034(\232\b\013\276\207\276\031\023\2522\034\221-\206XS"
+	.ascii	"\220s\3325{L\224\001\260\001\243\240\261N\366\037\230\347\314"
+	.ascii	"\234n\347J\366\265O\333/\364\347\253i7\b\240i\307\237\005\364"
+	.ascii	"$\260\235Ie\361S\">=\343\036]P\374\256l\204\300\356x0?\274`\311"
+	.ascii	"\233!w\371_\267\020\177H\321\020\376\274\355\372\334`\225\262"
+	.ascii	"\331/\331/\250\266\346\221\264[3\215.[\247\216\036\377\001"
+	.text
+	.section	.gnu.lto_areSticksActive.148.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\016\005%!"
+	.string	"\366=\324H\240\230Q:EZ\262,/\271\272\316\034\340\200\336\350f\376\0269\3065<ZW\204\234\350\257<H\335\364\277\346\360\215\232Y\245c\026\334\306\037\346h\260\016\316\272\007\352\262\001oh&\026\374\004\370o\3777B\b!i'\031\310"
+	.string	"\256"
+	.string	"\277"
+	.ascii	"\300#\033Y\2533\005\323IUu%\253\326Z\300\344:8M\016Y\24749\032"
+	.ascii	"\2474\351\335\243]\0305\021\243}\255ORNj\005\022\355\200\323"
+	.ascii	"\244\202\005G\213d \217\026\206\252\242$4S+\260\366\035{\217"
+	.ascii	"@\257\214\"y&\213\301^\256\323,\311\361\024i\235\302\263\261"
+	.ascii	"\346iD\300\2432\035N6\034\033\037H\t\351a-L5\306OQIy\2420\001"
+	.ascii	"/\0323\250\313\214\200\303\211\206O-L2\2020\305\240\346\254I"
+	.ascii	"i\034\022Z@\020&\032\264|a\362\325\364\302\343\230\240\352\306"
+	.ascii	"p\326\244b\234Ea\341Yh\272\324\224D\357)\023\030f\021\331\302"
+	.ascii	"\341d\303\324\214Pk]\272\242\311\311K\363\256g\273;aw\364\021"
+	.ascii	"J@\254\177\230\334\0209\352\025&\327\271\322\244\317]\277\035"
+	.ascii	"-n\224\034C\234\306\373\226z\255\312\234C\375\212\301\253$z\346"
+	.ascii	"\265\326\024\277o\027\310\243v\321\002\310\212}\216]!\023\261"
+	.ascii	"\203\200~L\272>&\335\236\245\313c\322\335\361\021\257\216\215"
+	.ascii	"xsN\027\347toN\327\346tkN\227v\272\263\323\225\235n\354ta\247"
+	.ascii	"\373:]\327\351\236\247k\236nY\322%Ow$\351\236\244KG\272\036r"
+	.ascii	"1\313\314\230#\254Z[\024\323\324,$\024(\037\261\215\230\356z"
+	.ascii	"\327\301\265\360\210\321Y"
+	.string	"\243\314%P_\262j\005B8\375[O-\314\344\272\210\003\256\331\201~-\331a\237\275G\2537$v\331\203\254hNb\367\321\352E\361\270\274\016{\200a/\210y\327_\007`\245\027U~\274\353\376\021\261zQ\274,\265\326\363\276=?\3368\314\227?wn\276\264B\276\274-X\n\206\323\312Q2h\330\260\2414I\236\350\352\267\033\217b\213\022\321\300Z\253y\337R\262\347\226BC\034}\276\363%\323\213M\224\277.x\345f`\330DI\377\273\367\304\243\305\365\351\307.J\304\035-^\360\023\016g\255\265\301\272\312N:\330n\267\322\244OR\221\331\202\262\243\305\261\374\340&$,\206\007\223\236\363\\\321\036T\204X$\316KH\030\311\227Z\223\030\254\2238\261\022\270\023\035\306\"\\\b\034\205\"\0217\233\356V\001\204\rWT\302fm\007n\272\234\215\203\315C\315\346\241&\002\327!D\315\246+Q;"
+	.string	"`s#n\272ZQ.\247\253\301\200;?\307Z\312\022\260\210TU\2625Ri\241'`\241\241\252\202\331H%\017\3177\302\356\274\331}+\033\022\023\372\301\320\002\316\371\022\221sN\201\004\301$\3213\036k\255Uf\3009\027\272\247LF\031\226\241`\262\236l\305\356[o\r\211\257\237\3337d\341Z\033\225\336\032^9\201\356\253!\220r\271\330\250\324\371R\320u\376S$L\020\313\016\206\363\237\233\333\034\347D\f\332o\036\2445\3055\267\031O{\315M$\026\021\320~\301*\264\233\f\261L`\250a(\306\210s\b\211\0052A$I\322\214\001p\002\241\251\3329\020P\307\210S\030\016\255^\253\317\030\013\277\030\205$d\333\264\223\033\227X\373\003\030\035\204#)\220\037\204f\017\035\005Vb|\031g\346\340\217\243a>"
+	.ascii	"eY\026a\007\351SG\270\363\260.\001\001V\0058\356\035\021Vz\302"
+	.ascii	"\302.\t6\302\005b\203?\322\230\001\031\304\367\327\310\341\200"
+	.ascii	"\251aKy\306\310\020j\353\003\215\341\332\376\260C\333\265@\302"
+	.ascii	"V`\013\003\360\2178\203\355n\"\030\241\256n_\260)\220L\201]\201"
+	.ascii	"\026\210.^^\307\362\351\357E\333\225\266A\021\255\240\347\221"
+	.ascii	"\007\025]\033N\347\270\311\202\231-\357\031{\n\302N\304O\315"
+	.ascii	"\245\235\366\361\0040\367 \247\327\352i"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.149.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\355\007"
+	.string	"\222\01787@\217\322\001\230E$\230b\323\023\353\022\367}mNX\276\\\003\200\216x\252\3156\370\230\032S\302:{\230LP\253\"p\230\316\323\001\f\216I\367\002\242\355I\2232\245\r\231(a\023-d\243\020\003f\315\263u\234\246\240\201\242\006\212\017\241\314!j\335(z:\346 \266.Fp\\\027\261p\237YUqR2X&=\371\352\207\027\231\360=,A\312\177\277|\222\346\327?\027\323\0074\251W\001\225\324\013\352\344\224-;,\245n\330\317\254\252\354\257\376\324\364\257"
+	.string	"\215\025\360\251\226]\213V\314\262.\223\017\333\307lg\332\237\003\357+\n\353.\006J\311nh\340\002\316/{6\313\303\216\355\200T\240H`v7*\307\275\247\347?\344"
+	.string	"\037Xzn\020v\327\371\201\027\267\3366\201\355\217\355\221\t"
+	.ascii	"3\241\217\037\270\036sOM\313\\\303\367\207\360Tj\034\270s\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.150.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\240\002\325\025"
+	.string	"vj\223G\260\030U:\360q\037Ya2}\320)\030\031\314\0205\202\3643\034\361\025\336\370\246\260G\002\227\004qh\353)\004?\236\361\363\250\320`o\340\337\270\333\226\267\301\270\233b\306\007=\276\"\252A`m:\326\222\275\345N)~"
+	.string	"s"
+	.string	"\207"
+	.string	"\"\336c\004:\240\225S[\204-\236\336\036\341\363,\236G\366:\326\017Tn\264\030\252\265gsj\001\243S\017 0\302\262\024\211\331\224"
+	.ascii	"7X\224\340a\245\326\336ja\\vQH\347J\231\177\336qj\270\340-7\273"
+	.ascii	"\210\224\333y8\3329\035I\310)\346\306ISk5\345lrg\315\320O\025"
+	.ascii	"Sn\234\250\0244n\347]\342r5)E\tj\255\226\267\234\212{t\333 l"
+	.ascii	"\337\330\362Hg\205v\013\203\374M\356\235\b\375<\006\226!\"\273"
+	.ascii	";\037D\370\275\340\203b\223X,J\232\372\r\241\375\202\311\337"
+	.ascii	"\276\377!\344\023d\333\231\335\253\311\335\331\237u_\3301\250"
+	.ascii	"\363\3340S\3724\245MS\372eJ\227\246\264(\222&Mi\227Pz4\245)\225"
+	.ascii	"\236SzWZ\256\364eJ8N\344n"
+	.string	"BJ\255)\202Yj\020\375\3258\317o\337\367y\317\026\0358\304u\331\322\322&\243\215\232\f\232\264\242\314\347E\024\374\374\267\340\006\007'<%\355\001\031=\243u\331\227\330B\223A\325\2070\030\325Z\r\370A.\244\201\203\007\017\302\323\321^\205\016x\345\267F\224\270\210\022\312H\033B\004\371\033jwg5-\220\254\240\273\363\204p\256\313\367\304\226p \023F\265\332\n\370>\376\203\202?\343\324\025r\250\237\023\236\316\r\241\003\272\322C\223A\003\361t\304\230\273\363]\256\353$S\001\316\240\362\220A\307\302k\305\001\366z\301X3:\255\330\232\245j\305`\254\034\226k\305r\2558h\260\360Z\261b\036V\252\224a\035Z\261\225\016\f\026[\211=\332g\335\027>\357G\321c\007\030\306\254'E-\314\342l\303\354\203\204\202A\264\255\211\350\306\354y\227:\240o\211\017\233\357\322\265\034\253\034\350\247\335}\357"
+	.ascii	"~@\\\216\036TL\373\262\247\275\226q\307\211\210ig\222\2146jL"
+	.ascii	"n#ai_6\325d\f, P\002Q\n\257\016\002\262\262'\361\366-\005\"\255"
+	.ascii	"\025\370n?\236\240\350Xa@g\203\3470\316\307\037\r\213k\353\023"
+	.ascii	"3a`\376<\316\020\220\2666\232\233L\333\t\006?\205\306A\323\203"
+	.ascii	"\215\367\r`\265\b~\363\303\352\225D\272W[\023\345\215l0\022\211"
+	.ascii	"8C\b\307\"!x\204\332h\204x\207Fv3+\322\365Z\274\007"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.152.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \345M\006"
+	.string	"\302\013,2pM\322\001\240lH\025\212\34233\034\236OI\331\265\006\351m\227\325\326\232M\262\321\246\274T0b\276*\273\240\322U+\230\351x\370m$M\312\224\002n\221\364\\ch\023k\023\203phx`\355I\260\250\300.Bzl\302\271\307\240\270WN\252\001F3\366C.\002}\016SPy\353\217O\001\374I\025\300\300d\307\216\227\324\f\373\226U\216\355t\352\300\307\311u\r\312\356\246\263\262&OI\207\355\333\256l\310\b\t\225\341\343\306\206\300\203\244bDe72\3258|B\377 _\310hR\254\353\362\fP\330]\247u]\334\372\003\333\026\001\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto_processRx.153.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`[\001\225\016"
+	.string	"v\033cE"
+	.string	"\261&\035\b\005\031\231\314\027D\2370\300\227\242m\001\031] \311\320\346\262\240\016\245@\356f\\\321\353\250-\371}FQ\311\004\336\3312\020\310\001"
+	.string	"\030T\207\217\fW\214\363\3153<\003A\325\266m\262\245L)R"
+	.string	"I"
+	.string	"P"
+	.string	"\340\211T\201\227\032\250\0276s\202\332\232x\351\035y\305\325\222\017\340;y\307\300e\210_X\366y\320\030\027\264f\344\310\276\224\370\221J\341a\337I7&P\261\334`\237)\202h\260P_]W>\224j'd\316i\365>\020\267\347\266;\333\016\354\243\b\353b\177\3030\334\341U9;\314\377\261:Z\275\352\013\320`\223Z\371\256\022\316\231\ns&\353\242Qa\233dc\266U\355\263x\013\322a:\3703g\211\0253s\202\f\254\300\363\013\364\017\371+\236\200\374e\333\r\036\220\\z,\023\202\026Pu\355v\036\352W\220\266\310\202\336\333}\253F\007\31341D\314\270.1\327\217\202\3469ic\030\351=\335"
+	.string	"2,-\307!\021\312\254K\362K\301\305\215\223\342\370\322\317\332\0338\350\275\357W\277J\312\210\231\233\326iOl\320\244\001\243\b!\022\021\004\223\222P\327e\330<\274\201\204:n\233\260\215h\333\210V\"\022!\321\266n\244\201\0340w!\324i&\034\327i\030\210\362(\263\375\352\236\234\027\0340d\350c\036\367\203\355\270\016AYS\234s\316\216\204l\243\034\240\266\310\246\367|\03357\001\033"
+	.ascii	"6\023\020\3520CVd8\200\031\273 \305\317X\003|AL[W9\r\340\200"
+	.ascii	"\025\2639\020\016\306\260\025a`\213\253\335\310\301\226.\243"
+	.ascii	"p\025\265\3740\0054\026[MG!F\022j\300\275\243\262y\006"
+	.text
+	.section	.gnu.lto_subTaskPidController.154.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\262\f\245:"
+	.string	"\032c\254\025CPdR\007\023\212g\330\263\n\255&\271!\325\301BS\240\333\313S4\360|\320Y\r\231\030\277p\204\327\2447\025(\351\250\202\020\002"
+	.string	"TA\b\370\324N\026Dt@\377\035\362\337Q<\331f\367\336)\245\024L\001)\001K\001`\255fz\357\3274\320u\263\2129k\270\356-\335n\335k\2552w\\\2354\273\267<iu\334X\270\265\264u\226\266\335b\f\265\210\334a\2168it\016~\275\016\375\233\215\205\314\2746\243o\330m\033xioz\356]\033\320+\037\370\2653\267\225Vk[J\203\201\367\026Q\003\346\3365*\026\360\3535\252\211l\257j#\261\275r\313\\W\354\272Z\006\322\244K7\274{/\362\221t\333"
+	.string	"\244\242\240\216\306'\247&\246\342\222\0221\t\351\310hXD4$$\f\002\177>vU\337[n\337\003\266\0062\301\264\032\200T\034\234G\2755\324\333\025?\306\2651N\315\237\254\264\223:\365\\#\326sM+*\361MY\236fk)\264f\23271I\025\253P\361%\337\203\"aUZ\351\314\211\023\223\314\220\2304\361\243\250\221\222a\222%^D\364Dk\016\361!\264\246s\2569\304\205\324)=a"
+	.ascii	"\021\277\2340{\256)\304\205A<(%s \020\377\2415\307\3347\327\224"
+	.ascii	"\252Q\367\336\245\263>z\365\352rU\254_-\320\205'\204\b\214K\025"
+	.ascii	"\322[\306i\266v\034`Jw\337\203{/;\023,\2549@3{\016f\206\300\034"
+	.ascii	"D\023\315\246\333L\240P\241\002\333++\207\311\307\367?\366\327"
+	.ascii	"\367}{=Q\372\224\241\236\375V\177\375\242\333r\320\226O\325g"
+	.ascii	"\361\356\200\270Y\037\312\007\226\321\347S}\3212\272\303\271"
+	.ascii	"g\260P\217\243\275\364\177\t4\377\035\234s\242M^\365\334g,t\231"
+	.ascii	"6s\201\333\254W\306\220\301\233\311t\314\0338x39\312\353\265"
+	.ascii	"\230;L\213i\341\341\303"
+	.string	"\207\017:\345\344\251F\316,b\2047\223\352\273\f\021\345k5\323\001#%\362\017];\311\366\223h\263\303\345z\314\315\245\273$\271\315\370\312\2047\263Wn\023l\257\375+\224:#O\265\261-\2372\257)\375\241\314\375\323\351t\312o\204\271\341\232\031\364\226\346\005\355\326\234@u\266jiw\025\225\352<\325k\315P\252\363\361\347l\004:?\261\316N\252s\023\353\314\304:\027\205\316KBg%\2413Q\350\234$tF\022:\037\005\235\215\200\316C\240s\021\320\231\b\350<\004t\026R\235\205\252sPu\006\376\234\177>g\237\317\231\3659\257\254\263\252:\377\352\354\252sO\220!\346kGbGK\357B\351\227\336\273\270\r\357\362e\013\006\345^\\\206\355U\tP\264\3150\227F\304w\221\364\304\367.\276\305_\004\324!\340Z-\030\224\337\244\357\247\363O\236\324L\354k\370P\376\322>8\211\353\336\255"
+	.string	"H\237\325&w\364H\337\202\274\360\266|\372\325\202\370\213"
+	.ascii	"\004\201Z\260\243^\357\265<z\264?~\260\275\036}\013q\376\211"
+	.ascii	"J\325i\327X\021\020\326\350\177\220\225\263\035\342\3154z\366"
+	.ascii	"\2073\034\0273D\303\367;Hgn\313Z\2507s\370\235\326rJ\351P\021"
+	.ascii	"\001\037\366\f\226\271U\3222\361f\026}\353\271\013\343\206\353"
+	.ascii	"\265\3262<X\204\210\3724!\312\033\336{\205\017\265\353\241=g"
+	.ascii	"m\224\241W\340\264\213\006\261X\241\246\353:,(m\224(l\257B\257"
+	.ascii	"\300Y\2277\306k\367^\340C\271\333)\254\360K\264\335\341VJ\337"
+	.ascii	"i\247\374\356\345B\300]\247\355\264\3216\255Uk\325\330^\205\037"
+	.ascii	"\302Y\027\225\336{\357\357\241p\332jN\233\235a\033\331\340[\311"
+	.ascii	"i\257\004?\313I\227\327>#;\365\315\326\277\271\266;\335F\026"
+	.ascii	"\370S\317\276\034S\372\364\r\004\023\300\007\341\244\213\262"
+	.ascii	"\277gf\252\226\213\200Lr\357U\300\0010D\370\025\326\t\r,\262"
+	.ascii	"F\260X\001\\\261\341\n\353\204\006\026(\256\262\262Z$\2078Yu"
+	.ascii	"\225\225\")\"Y\002\231,\201Dqb\004\0262\231\265\002YU"
+	.string	"\344\024*\256\262\220,R\244\310B\n\327\266\372\2150\2052\315<=[\257\004\360P'\r\345\211\324\361J\024713{\262\227\006\352\270\344\370*\236[\242I\302\236Z\360\374\354]\275:G\243\037\201\026\335\230|\236\336\370\355\364O\337K2eN\337s\224\214\031\235\335\364\037\306\317\331\323C;\002K$B\003\037\322Y\222t\243)\363r\222\352$\333\364.\\H\323\253x\272E\307\232\036\032\326dM\366\314B\305\317\226O\333\306\265c\222\340\3145\362j\354\275\320s\243|-\206\340Q]c\252\325*\375\355.\217\307\334\033\305\252/\376\272\307\316\256m\r\227\353-1}\217\265\013\223\017\034^\323`\253\236\351\217erg\274\236\312\336\303\322C\251i\260\305\357\"mv\274\351`4\272\332\345\222\355\265\370\215\346\f\2247v\307\245\204\370P\266\352\030,\003\347b\360\035\327N\266v'\267\340\316L\022\216^"
+	.string	"<2`\301\367[;\331\333\035\233\263-m\220\212:\006\233"
+	.ascii	"P[\033\006N\240\231[\034\255\016of\202o-\355@\360\356\324\250"
+	.ascii	"b7\200\377\250q8E\221S4\"\"\005I\222Jc\260\002\021\241*n\003"
+	.ascii	"\021\3604\207$\253\231\246P\332\231\003CqM\201]\273\262\273x"
+	.ascii	"\021\244\311\202\247\357\231\267$\277K\036^\334\242\233s\226"
+	.ascii	"\004\232\022\363t!\261u\t\312`&c\242"
+	.string	"\fJ?\335\3648\311\360\334\t\252\023\234ZAx8\327\220S\016\224\271QL\255\236]\373\007\025;A\274\2777W\265]B\t\370 \267\244\364\366l\233\351\270p\023l\001\363khi\265m\363>\021:\020\320\020l\262*\030\237C\0208D@-\311X\363\310\205\3662)\t\231\301;\263v\265\374\004x\3738\204\317\355h\315\0064:\206\032\340\275\202s\007\265n]\243?/$jY{\016`\354{\257\371\310Z\224\303\357#Y\024M\017\276y\367\371\327J\032@\2115\034\303\270\230\325\247)\344\\<\232\350\324\210\004F\034jf\344\016\365\277\253\036S\2612\233.\024L\205e.\233\244\203i6\336\\J\373\343\253T\326\264^VUd?\272\204\237\002\202fK\206\263\016\267-\213\230\374Efe\276\301\231O\253-\016\234(\272\001\370Z\001\322-Q\017s\215}\254\262\212\227\204B\0224\335w\274\263'"
+	.string	"\367Qe\2311w\316\226\316\364&G\nz\032E\316tl\200\306f\036\331\231\004\337q<\3458!\301\216\f\200\tg\2100\213\003\021\232\225\n\367\376%\206\366\366w\024\275\246\341"
+	.ascii	"P\017@\331i\334\367<\233\017\227\373\035\257\270\313K\036\204"
+	.ascii	"s\367\205\263\251\0260\311\212Q\205\233]\373U\240g5\025\r\234"
+	.ascii	"\323\233\276\037\253\3531\205N\320\030(Oz\2558.\244\242\225\250"
+	.ascii	"\307pG\210\212\372\350\001\242:g\364\270\0341*\303\336\bP8\232"
+	.ascii	"\202e\377\376\003\227\275)\345R\003"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.155.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`9\003\255\027"
+	.string	"\026\254\232H\300\030Q:\020-3k\n\334\264<\0278\316\213F\250\266f\201$\031]Q\n\"\235\027\336\274S\322\366\377\321=\231U\030\255\027e\213+\004\260i6L\005\2320\203\252y\312\340/\315D\034T\203|B\310\336DJ\231\002\214"
+	.string	"x"
+	.string	"\210"
+	.string	"5\307\025^\255;\006O \356,\260'\272\023\\\035\272\363\257_\314\316P\2059\310\365\240%-\325Z\313\336\261\257%M\243\030\322\t6\277\276\341\204\243\035k7\330\2225\326\264Zl5\f\b\261\321\340\321@\016\242\031+\n\261\311\340P\213m\006X\240\326Jc\032c'\250@\311\t\231\233\333\n\360\344\342Gm\210\301\027\333`\203\241%\0337\267\031X\343\243m\331\243\345\0267\031s8\241\326z\256\335\210\3665\373\237\311\177\t\177\037\b\333$\220\276\314\330\367/\322&\001\372\032}\305\342\255\355\374\262\350\316m\0177\246\030\221\021\343\337\277\223q\343\376\005k\353\370W\267{\312\331\335\236\f\371&\312\037)_\244\374p\362i\363g\363\301\3467\310\347\346\257"
+	.string	"\034\"F\267\005\323\245V\027?4\2657\237"
+	.string	"\331\335\356\277{t\362\377Nh+Q]\026K9\037J\265\356\026\354\374\003q\371\337#\233{\255N\305\307\032\275\031\224\\\221\"q5P\260\227\307\237a\237h\020k\235A\370\362\326\311\206\257\321\316s\350\351\241;\301F\360E\027\343\037\327Za\341\027\210v\223\017\335\004\266P\241:\374\207\020\301[\373.\361\231\331\"\237\022o6\356\001\224DI\3239\215C\213\202\205\277B\224\354\026\177\n\312M\002\t\f"
+	.ascii	"\026W\210\376>(\336\032\367.\361\225\351\315\032\006\332\360"
+	.ascii	"_B\305[\313i\366\342\313\322\2235\354]x:\034\335\270\317\005"
+	.ascii	"\242\001\251\225\252\203\253\345\343\n\032\203zR+U\007\227\211"
+	.ascii	"T\253\205\002es\024O\252\305B\215@\375\224\250\237\322\204\312"
+	.ascii	"gU\242ZA%\317\316Y'R\255\322\305b\265Jr\027\333\326q\361\314"
+	.ascii	"\220^\254e\244\251\377\363\254\225\027\222\262\250\326\032\341"
+	.ascii	"Ke\253P\250`\301\002\335I\271\324\306\214m\022;\354\261wE\020"
+	.ascii	"\031\377N\266\330K;\354\235$Z\232\030\377ho\026\034\262\206\255"
+	.ascii	"\251qI;\373G\312l\0207\302\030\031\007\360\251\377\013\030\316"
+	.ascii	"\300\b; \240\002!)\263\003\263\200\255\030\302!X{\365l\315\030"
+	.ascii	"\263\221\334\335\016;\022\3361\343\266\345\334\212\013\033\317"
+	.ascii	"\233\240\013\027\013\026.\262\367\334\270jLNja\004\005\023\017"
+	.ascii	"c \224t\203\270o\026\265\253\004j\024\033\355\345\252)\337\252"
+	.ascii	"\013\221\231\034m\233\333\333\330\302 \221\202\212\260\355\211"
+	.ascii	"\211\fy\200\0219^\363\234\030\234\270r\336\204\332\212Fu\277"
+	.ascii	"Z\366{\305X\3724\334\026\310\307\232\f\356\030*\013cL)\004\024"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.156.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \366\265\006"
+	.string	"\342L/2pm\032\003\240k\235w~v\212\r\026\236t\201\226\004\361\270pc\250\211\204\240\244@\310 \250\244\\4\324\005\200\247a}J\204o;\364\267$R\246\024\"\006\b\372,\214BPJ\210'\320\327\2012\276\206\347q\317\343B\037\007\220{R\344:\233\306\007(\335(F\3514\325\315L\345H\260\211\266\"-\226\321\372\362\377e\246v\rt\234PFQ\371+ZXn\322F84m\275Z{\3704\375\021\321\314\217A\"\362W\b=\bp\343\270"
+	.string	"\343v1\001\306\255\263Mq\265\361\315\251\204\"d\345\277c\032\236^\2636\2103%\212\344\005\240\360\277\253DY\270\314m\r\332&\264\275\b\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.157.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\275\005\215!"
+	.string	"V;\317H\220\232Q:\365\b\244\300\362\353\235A\267\024Qr\204\002\212\250\250\236.\346\336\343\020\252\262\002?\267m\272\377\263E\273\360\270\245\351%\351|;I \336\234\201\\_\313\b\215}\304\b~fdd\260o%\237\020\"wJ\001\271"
+	.string	"\247"
+	.string	"\276"
+	.ascii	"\366\231\370M\260P\2700V\21158_\376W\256\331.\246x\225\252o\001"
+	.ascii	"V\005\366Uk\221\300K+8O\355+y\225\357V*<\253u\007\027\255Z\213"
+	.ascii	"\006,\340|\031\340A\346K\362?\346K\373l\257[T\375%\250\362\n"
+	.ascii	":\001\253\265\352\366\307}\267\325h\263Sf\226\344R\237\377\253"
+	.ascii	"\317\204\303\337m8^\303q\203\322l|\36602l\340\214"
+	.string	"\310\250AO\334\016)\342e\344\200/+n\036F\006\221\f\212!D\030\244&\215\227,j\303(J\322\2064\276$\202(0\034:\303\025\244\rNP\314\257N_\f\201\224\312\034\324ZM\205C\251;\347\266\263\330N\262K\030\001G\252\036j{X\242\027\346\366M\356\323\025\247\215\021\270?\223\321\262\322\261\337\231\337\017XeVP8\366\237<k\347\0071/\004\275\360\245\037\302|\371\3150%\026F\204\242cv\361G\327\207}\262n\017\373V\377\321\261n\243\034\356\305\273HFMtR\337N\352\241\223Z\310\244\016*\251\201d\324?'\265\317I\335cR\363\234\324;&\265NI\235S\243\266\321\250k%5mF=\223Q\237'\265\354\2446M\352\362\244&e\324kR\323\222\372\007v\314H\031\336k\254\326\030cb\325X^\031r\254\223\364\305\257\375\373\001\313\f\216\332\276%\017\350\205\266=\224c\021"
+	.ascii	"\264\266GkG\220@/t\200\250\375\231\266\2655\020<z\302\215\273"
+	.ascii	"\005>\227\b\ng\255\365A\232\314\227\264\235YAy\371\227\246\n"
+	.ascii	"II\346\313\331^I\216'T&ni"
+	.string	"\327q\306\025,\306\254\262\374\325si\304x,q\310\025\0302\267[.55\026F<\3276\322\265l\321-\241\032\331\236\346\222+\333\227k\356\203G(,\026\312\235\021\311\375\341\201\346M\360\270K\345V\224v\200\324Z\031\370U\256\205\301\017\362\322\0328p\270\267\204j\214v\227\206\205\006M\360H7\267F\273NX\020\001>\312\245\2448\321\241\203\371\222\356\273L\005\274&\246\013KO\"x\020xzKO%f%0\360\232\230.<\215\340\365z&v9\336!\361zN;\017;\020\272\035\b\335\b\246\245&\335\256WB\207t\263\023\t^O\367\344\344\324\323\325\212\365d\335\036>\217[F\250\005\332\210\330(\351\326\230c\204jnK4T\264CA+\2647'A{\256\032\227\003}\001\205\321~\n\334KIA\327\031\331\024\237\375\351\331\235\365\341\331\036\337\021\2365s\350\320\331\235\275\235\321\331\207\351"
+	.string	"\356\3573\335wf\316\202\350\312\331\r9\262P!9:&1\002\367w\032Q\371\222\034\312\361\310\201\300\371\322\222\255\017\013e\245\231*q\217\021\344\202A\372)\3147\371idq\t\331\334\026\355\013\233\311\264\005x\250q(%\225bjFF\202HAZ\220\026\003\320\002\021\251\252\016\020Ph\2066I\007+\022\370\225\216\\'Q,U`o\330Y\332{\221\254\311\230\204\242Vc\033\216}e\374\242\364\037\030\333\372\311\023\34124\376\027\237{\b)p\265\215\b\020@\367K-\204\275\372\364\337A\312w`>\373X*\341\252\360\337\230\316\32512\306\343\245\323\342p,[\277#9#\226z/\223<\260#\n.\275\316\200\255\367-\305]\225\243\266\376\273\205j\265\023\3573\314\327\362e\320\032\340h\341\303\376Y^a\345\350q "
+	.ascii	"7\"\324\357\022\262__\201\003wG\364\253X\213P\220\236\365)\017"
+	.ascii	"\334\350\235F\244\035\324\215\037\202\312\203D]\226\355\003q"
+	.ascii	"1\253\322\235\345V\3479=\334\2012l\302(\212\321B\327\230.\275"
+	.ascii	"\25272\324\260@\210[_\202\032\346\374\001"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.158.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\241\002U\024"
+	.string	"vc\200I\300\322Q:\201+\226\223\223\310I\023\205\005)\3013J\272#4>\322~l\261\216*\271c\350\310\315e\254\231\265z\025\301\344\371\240\276\332!W\n8\204S\2518\020Y\3206\007\250/\367\232\221p]T\376O\366&R\312\024m"
+	.string	"`"
+	.string	"j"
+	.string	"\362\261\037\310\211N\313V\220\210lID\272\273\305B\032\323\221\225*\234\022\344\215]C\226\325m\224\351\210\201\237\235\036]\201(N=[\001 \037)-\302\215X\225\026\341x6\234\266\225\240I\217\023?J\306\017`\202\022:D\260F\235\005Ycm\331\007\256\007D\351nE\322\0051\322vC\226\356\376\336\306\035=K\377\347\376\257\374k\"2~\207\251\214A\007U\333\251\257\366\177mX\275)\353\316'\325\243\261\354\317\321\226\203~\005\273\273\317@\377\334\207s?\301\275\224{\020\3343\357w\367J\002 ji\324\251 \335!~E\272'y,X\377u\177\215\241F1=\362\360U\367O\r\033\335\271\224\037P\251DQ\223\251\022\324"
+	.string	"S\003\034u\034F0RH\016R\2279YQ\350\240\376\t\312\344BC\227^*\300\300L\225\223\225\307\207\207\324\321l\177\nr\320%3\257\n\335\216\332N\035diAg\\Pu\327\024\\\225t\027##\212\254IOG\313\314j\363\315\366\247\242I.Uw/\270\352TF\206+\221\312\323\324\310k\315T\271\234\362\304\233\355O\267\273\0038/.\033\032\n97.\030\214\203HrQ\305\005{\2111\342LK\234i\335\320\310\330\264D\030NK\345\344/\r.X+\347\365\202\265X\271\231\202\315@?\027\275\031\323\032 \370\265"
+	.string	"G\b\354\357\340\301\352\355\272\373\221\030\300\223\255X\251|C\f\232\206(\251J\344\350\023\272\223\220\0279B\227\031\262\026\351\236 \350\215&\345E\220\320\3222U\206\254\277!\336\371\340\230\246\200= \240\002\2319\353\006\262B\347L\300\317)\336%\327\003\356\002\345\"\330\017\271\312\367\242\313\354\345\321\036\356\347\024\361F 8[\232.\3741$\244\201\337\344\305\330\335\024\216\211K\3779+\251q\361\361@\330R&\flKV\242[<\275\204\305\252y\260\016\267\256\024o2m\r\365\265f\263E\253\272]\265\332\3473\340\206@|\246\230/\351\200\030\232y_\363t\204,\220,\224^"
+	.ascii	"\330\273\266c\266R\217\230)\003"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.159.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`6\006U\""
+	.string	"\226\272\315H\220\232Q:"
+	.string	"\020Z\204\"UdE`\252\016mUc%0\001\020\202k\220\341\262\032G\277M\032\251\344\037\233\031s\366\261g?\236t\255\257\223\204H\342\004\022\265\352\026\324\322\351\016\243\f\366\355\177\373\277\021\262\211\224I\006\270"
+	.string	"\245"
+	.string	"\277"
+	.string	"\264\n\220f\346\332\356\236w\237\344J\314K\251\330Y\255C'X\265R\031X\001\262\323\236\357\220\247\343s\310\3235w\313\234\212Xy\246\264\224\256\302j\255\275\336q\363\274\235.\207\273\331j\264\231\254$\351\330l\356\247>\013\n\215\316\343\361\335\273\226x\004(.E\261.\207\013p\273\3016\247\327l\324`\332H\300)\213i\207K\307\230\027\227h\360\314i\354).\315`\031\216\227cO\327RSM\250\304d\351`\030\203x\212\023&\215=\265\326\025<2\275G\004+\302l\340\204H\243mL\t\314\247\316.\204G\314\245\203Z\353rP\030\343\233\363\335'\330\335\004\273\264*G|.O\217}\356n"
+	.ascii	"WJqx\274\333\301\003?\310}/9\216\332\350\033\006K\nG7\024}\020"
+	.ascii	"\371\036\262\372B\342\261\335W\335*h\337c}B\374\340\351^\210"
+	.ascii	"<}o ^\031i\002\362\2716\346\351]\"\020\374\340\016\030\312\330"
+	.ascii	"Bj\243]\252#n\250\335\367y\236p\266\237v/\365\363\224\274;3^"
+	.ascii	"\235\2227G\306\313\033yw#\257n\344\315Q^\034\345\275Q^\233\214"
+	.ascii	"\267&\343\245\215\2743\312+\243\274e\311"
+	.string	"K\222\274\224\344\035I\336\246\274<\362\276\300\207c0^\b\017\247M\2550\3167u+?\244\256y\314\352\013\311\273\270t\335\340\213\252\326:\373\017\231\353\017\225\274K\326\265\314\251\007\020 \220\247\271FA\224\"&\005\224\341\270\234\370\224\337\032\327\271\253\026T\312\206\222\362[\377\254\304h9qk\006\304(Y\332+\bVk\233\317i]\353\222\314\254i\273\021~\345GV+\222\202}\225[\2210\201\002\005\362t\326/\022\233\210I\001IYc=\b\226;\317\363\2245\316\213\205\231$\247#>\367\347y\306\241@d\331\037\254\304@y\024\240\024\025*\220\247e\037 2\031\311\336\335\002\177b\241G\254\265.\3307\271\023\f\373\036\247\253\201\003\007\362\224\364\n\202\321&\307\356\246\375\244 \001$0\b\205 \272PB\204\320\357g\302w[\237\217\320\257\310\347\3017\324\363\r\365D\020\005\205\350\371~$z>"
+	.string	"\266h\204\320\257W\242\250\350\327\253Q\001\337O\263\241\233-`\037\215\274\035\003\177\343F\247w\036v1\023\312\334aF\231Q\344\251N_ j\2115\345\260\261\220[\303\353\234f,Jq\bp\316M\037\344\256\t\304\024\302\017\362\232\271\206kr\354\202\310]\1778\263\353\f\304,\261\326\r\311\"2\344R\344\311p\313\2313\215\374k\210e\013\251\215j\255\025\367/*#\032 \323\255\241\226\377C\316\272,.q\203\373\361t\304\326\007\"\275\356D\234\022\246\006\310gY<\213\265/\2375\255Z\222f\207K\307\030\332\037\200\212\250\2418%\0213c\"\222\222\024\024\024\322\001\300\002\221\241\262\035\021"
+	.string	"=\351 \225\2460\314\001#"
+	.ascii	"\253\252\332\226jl\373\217\020\247t^^a\350\026 \234\261\212k"
+	.ascii	"\277\345\027-\361d$\bF\034\222v\370\276(e\0031\334p\366\006\241"
+	.ascii	"\272%P\271+b\217\351\t2\001F\230`G\004\312\205\265\tjw[\345\003"
+	.ascii	"\340\360?T\365\002?;.\202emE1S\361\227I\257\222\305\310\275\221"
+	.ascii	"h\371\361j\002K_\350\300\027\245\f\b\316d\033\366~\235\227\030"
+	.ascii	"\345\360pa\325\036(\220\326\370W\305\030?\300\037\033\300\270"
+	.ascii	"\200\216&\212\267\365\264:\337\021\223\213\216\326%\224+\017"
+	.ascii	"U\004%\243\270\ti\037\240\263\277B\311 CYWk4\b3\020Q\023>\273"
+	.ascii	"0'\220\252\314UB\306B\273\0320Y\331\002\342,E\032R}\301w\305"
+	.ascii	"\227\020\366\307\023\251\356_\006\213k\267P\224\326\317\001\272"
+	.ascii	"\tE\276L\234p\310\304\217\322M\204\303\356\177Sx\370\007"
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashMode.160.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \345E\006"
+	.string	"\002L,1pM\322\001\240\013\337\225\225g\330\230\344\256 #O\321\361V\327\356\256\2615\233d\243My\251`\304|UvA\245\253V0S\375\370\354\211\2252\245n\322\364\\[h\024k\024{h`p`\355E0\211\300\016bzL\302\271\307\240\270WNj\301E)\354\203<\004\372\034\236\250\362\327\037\277\n\370\223:\200q\311\216\035-\251\031\366\001vw\255\034\333\351\324\310#es\f\311n\246\263\262(\217I\207\355\333\266l\310\007\b\226\341\343F&*\031\261\020Q\331\215L5\016\237\320\377\307\025*0'\227\306\362\024H\330]\347\245\331\334z\003\333\027\001\007"
+	.ascii	"2\001\0238#(\016%\\f\207\273,\315\206w\335\033"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.161.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"b\f.3pM\322\001\240\f\210\376K\002\360a\206\b\017\304|\350!\035b\250\025\221f\267\375\3651/\025l\033\257\352\032\350\357\336\340\261J2S8\210l\"eJ\001v\027\f|n\301e\232\313\264\207\006\006\207\346`D\273\024\370A``\223x\017\266\212\265\327O\252ER\n\373!\267\242\277\341\tM~:\3635\321Yj\300\205\224\227mqR3\354C\253\037\333\351\324\201\016\312s\352d\327\342JY\023V\302a{cW|\217\177l\034\025:Ru@2R!\202\262k5\313\t\2423\350\002\321\231j<>\243\177\220't\250k\2528O"
+	.string	"\204\335uN\225\347\326\033\330\306\b\t"
+	.ascii	"2\003\316:#h\b\3055\3217\004\216\031{\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_isTryingToArm.162.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \371\275\006"
+	.string	"\302\314.4Pm\222\016$\243*J\221EMT\270[\022\2037\003\254\244\356\377\373\317]\263\1777h]|#\2206b\347\031\3136Q\234\334G\301M\033\036\334\354&2\005\277\013\246\242\336\302\313\270\227q\017\r\f\016\356U\021\35620\005\201\251\234\004EU\256\202eq\204H\300\301\316\006-\"\326\223u\272Q\216An\351\211\263\326\253\323=\003\350T\024\240\340\264\223\3076\rI_J\342\350ock\227b\311(\211\372\021\311\004\235\230\344\310\364\201\361\367\327|\345\003\004\315V\261\013\220\305#\304\323Q\222\2119\264\250\325f\335jT\201\364!\271B\233\266\200\204\314\274]!Q\307\026\374\025\001\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303S\206(\341.K\263\341]\367\006"
+	.text
+	.section	.gnu.lto_resetTryingToArm.163.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375 \347M\006"
+	.string	"\302\313+3Pm\222\016dl\266\0314\362\365 \022\252j\264Mq\237\024\363\324\253y\261l\355\006\251!\004\277\350G\271%f\211\2515\271U\312\"\370\352\320\366\t\221)?\313%\302\207\3600\356a\034\203B\302\202{\321\301Y*\303\206Kt\017\020FG\271\262\2153U|@\232\026qA/G;\376\\\214!\366\260V\225\356\036\200J\007\235\220(\244a\243\2772\254Y|'\3318\337\0044@\254N|dR\214J\022$\211d\374\245L=I\257NVBF$<D\231\351\332E\2512\352v\243S\265\311\224\005\030d\346\254\332X\275\365\037\370\t~+\b"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.267.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\227\021EL"
+	.string	"\312u\270\032A0\"V\007\027\274L\017\f\340((\037r\343\234m\210\bD\257\214\240\236-\310;\026\277?\030R\251r\347Fz\356E\316{\247\367\356`\205\254\r0\373A%?$\345\007\226e\331\310\336[\312\224\002\243\001v\001\232\001\376p\177\306\213qf\314L\261\275\265\201\361\022>\\\306\013x\345x26\274Z\300K~26\226bo\263\220\021lk\332"
+	.string	"\347\371\255\371\260o\t\037\213\343\335<\201uQ\361\365\307\346p/\026\037~1\356\236\243\352\262{\337\277\251\315\037\3477\026\0078\317\263\363\341\035\345\345g\260@A\002\004^\007\f\024 0\300\331% @\023"
+	.string	"\027sK+\013\353\312\252jI5%\025\005\365\344\324\304\264\244TJB:2J\"\217\306\"q(\f\306\360\273u\003\331?\030\301\252\256K%\023{\006\201\277@\001\367\023"
+	.string	"\372i\004^}\201\364\201\007ti\332\270h\326\2767"
+	.string	"\350\217."
+	.string	"\310\217&"
+	.ascii	"\210O\017\330{\347\236\236\356\232cG\013\250\243\003\330\371"
+	.ascii	"\346\034:\032\300\234<\315%\347\231q\344\350\2558vZ+\333\207"
+	.ascii	"\247\232\325Yu\217UG\247\257\254\210Q\374\376\320\254j\276jN"
+	.ascii	"N/\347\322h*5c\364\224\224\333Ga\3334\324\223\230w\n\303\246"
+	.ascii	"\233\230\202Q\350\376\320\254`~\t\313\025\255\304bE+%Uy$*S\364"
+	.ascii	"\221\221\224O\342\251\252\275K\354W\255U\233hd0\002\232\325\354"
+	.ascii	"\217U\3065<\325%\272\310D\211&v`\333\266q\321\254L~\210D\013"
+	.ascii	"\361T\223\254U\217\350\340Z5\311\273\234\347\371\317\214\351"
+	.ascii	"\370\327\252fA\310xhXS\311\312\376-\222M\365~\001l\331\030B\222"
+	.ascii	"\355x\225B\256P\037\373\372\007\231Tk\244o\020\2140\317\263\277"
+	.ascii	"\016D\357\016\336\375m\272;\325\375\370&pz\361\016\006\367\336"
+	.ascii	"\335\304\360\21673\216\307\332\273\341\375c\213\3343\274V\203"
+	.ascii	"p\236\247\b\374\355\274\336\006\377*\017;\007\017\372\251\036"
+	.ascii	"\342\207\337\375}\370\334t\350\256+\265;\210\020\372\251{\307"
+	.ascii	"b\316^-pk\267\367\325\335\231\261\336P8?S\035\350z~f\374[\357"
+	.ascii	"\267\320\330\021\251\356:\222v\027AB?\365w\r\2755\334\255t\213"
+	.ascii	"\351}\365\335\340w\267\333U\344;\315\375\325\316\365jg\276\332"
+	.ascii	"\267\216\332\265\216\332\263\216\332\261^\355W\257v\253\242\366"
+	.ascii	"*\242\366\245Q;\325\253}\352\325.U\324\036E\324\016e\324\376"
+	.ascii	"\364jwz\2657\031\2653\031\265/\275\332\225\257v\245W{RR;\322"
+	.ascii	"\253\375\310\250\335\310\250=\211\324\216|\265\037_\355\306W"
+	.ascii	"{\361\325N\374\270\367\341\253]X\324\036<j\217\217\332a\243\366"
+	.ascii	"\267\250}\027\265k\242\366\177\301\245\2274\233g!\335D\363\031"
+	.ascii	"|\207\345\343\376\313\374\327\375\317}\034\0278\334E\323\233"
+	.ascii	"\2325(ho\354\315\233\247\f\177:yp\225k\223\303cD\220\366\330"
+	.ascii	"\361\322]\001l\003\234\247oM\277{\274\031\036c\367\330\241\003"
+	.ascii	"\315j\017\033\017:\316\207\375\355\225\361\303\302O\212\037\016"
+	.ascii	"\272\277\313x;w\220Fh\306\3339\206k\025\2636\3774j>[G\027F\027"
+	.ascii	"&\267\227aN.L.\354\301\\\032\007\377\366n\001d[\356vz\245\344"
+	.ascii	"\223\202\244uE\326X\275vzYV\362\346\252}\325\322g\"\006\276/"
+	.ascii	"\025/m\246#dK\033\002\337_\022\261%K\345~4]\366\312\255dW\207"
+	.ascii	"JiC\251\206(\355d\236v:em#e\304&*\251,i'\335\264\322-\006\245"
+	.ascii	"\203\200y\022v\321:\351y\331H\214\264\241pv\\S\365\017\331\b"
+	.ascii	"\022Y\211\222\370a\244=\314\003\250I\217-\321N\251\224A\023\207"
+	.ascii	"i\266C\242\266t\264u\337\324\321\3761gJ\251\330H(\b\216O\370"
+	.ascii	"Rqr\033m\327cG\244z\326b2\223&\262\023\331I\374pr\007\237\354"
+	.ascii	"\341*)JV\223\374M\021\322\313Ob\244\200(\262\024\375T\344F\006"
+	.ascii	"j\245G\200O\310\310\b\231\375\373\344qC\207\307\375\330\377 "
+	.ascii	"Y=\355\264\213\034nB\360\2267l\307\337\276\273\005\274\2435C"
+	.ascii	"~\214\306\357{\343~#g\323\003t\320\320\212\373\352\017\350\207"
+	.ascii	"\333\271\244\333\344\316\325\020Q\370\025\250(e\261C$sy\303\342"
+	.ascii	"\376Ep\\\332_\306\022\273\313Z\344-\372\251\305\235\025\204\r"
+	.ascii	"j\373%Oh#\036n\n\373\275\r\026L\224 q\353\300?]\210{\303\222"
+	.ascii	"=3\354\021\035\272\373e\270\377\314\023\317\006\315\334m\274"
+	.ascii	"\257}^x\245\335e12V?U\270k\374i\271[\377\260\330\177\317\363"
+	.ascii	"\t\363\257\342\362\030\t\022\342\207\207\3228@"
+	.string	"B\033\236\322z\376\n\261\273\205\013\372\251\216T\323\325N\023h\375\266\274\373\032\334{\033\371\004\236\242\013\205\212\023/\236_L\236\242KF\213'\024\354\0054\352\t\265a\201h\242\005\030\330\023\232\342\203\t\350\363\005\n\025\310\032\035L\320(\221\"f\361UbB\215\016`O\013`2f\2548\372W\227\t\350\363\213\304\327\t\347\327\t\347\013\025%\\8\277\2402\234]M\376\204a\002\352\004{>\241\316\342\277\363N\3630F\253cK\031\004\212\0262\342\211Y\340\027-\304E\201\205A\321BxZ\364<\317b\t\2706\224\013\257\211V\372\316\363<#`\3033\222U\013\243\347\305\334\357\205\271\231\360\312\264\323\017$\305\332=\260L\262\"\275\t4\033\330\332\321\255\255\034B\246\235*\250\233\263\005\366\325\233\257\325\344\332\315\332X[\213\210\224J\0314p\b\\\355\033\321CW;y\207\350\007,\255\177Z\247\200"
+	.string	"\377\334\262l\263\371YV;j\265\225\356\364\272\252\366\007v\307<3^\356\252\035\254\263\334Ywr\264\322#\240\222@\0024\224\247\342\213ru\226+\032K\024QTQ\264\033\355\306\017S\355c\232\033\256\033"
+	.string	"3:D\002p\245\202|4\247\366\0076Mm-\245\354\214\273\235\002\330W\327\314\346#\345\314\306\354\266\002<\326\376!\265\037\\\267\300\371\201\240\227\363\313\322\035\362\230~\252\324\326N\312\252\334-\227\233;O\3760\347|\324~?p|\311\256\236_\367\2311\324\216\332\261\"\250-\237I\2674\304O\233A\032\"\037\372\252\237\3504\371\207\fD\026\"$~\370i\177\366u^\032!3\254\226\223\323NZ\277h\245;\353N\013V\223U\323\236\021\201\201\250q<\205\02133\"\"\222$\005)\f\007a\005\304 \347\034=\017\021\320 \223X\331LRP\310p\340\362\372\313\216\243\210\227\033\177\255py\266"
+	.string	"\360\211&\235\306\360\211\003\360\264:\002\205\240\nT\375\337\002\277\020_\026\001i\177?\203oq\233\334\270?\301\006\303[o\204\202\346\353\314\220y\350{\2256\212\235\250\311\027\023\372\016"
+	.ascii	"\006x\321Tw\252G\3058qi9WW9[|\252m?l5>m\224\027\244l\320\301"
+	.ascii	"\b86H\204$\343K\374V\"\016|#\376!\002f\311\344\036g\233\177\211"
+	.ascii	"\030\317C\217\310\215\371\035\3565\315\234\221\276dyh\263Y\314"
+	.ascii	"\020\316\351\330\031\220\301\203\374\254\036I\025\316\332y\021"
+	.ascii	"\023k\250nE\375\312\241RL\327nc\312\344l\300\275\270\006'\352"
+	.ascii	"\271'g<\314\374H@\202|\343\332\344\304\31583\177\324l\226\213"
+	.ascii	"\204U\024>\336wk\363\030\257{\034h+\303y;\306\364\260\215\300"
+	.ascii	"^\037\311*\301\230\364\240"
+	.ascii	"\027^)\366\301\344\023w\233\352\360\363M\354\004\336V\177\377"
+	.ascii	"\332\265H\351\003\314k\005"
+	.string	"\2124\362\203\2050a\210\240\363\210\033\323\231z\301T\345\005\001\023\206\004\264\222;\240\222@\207\375\211\264E\207\225\352\3319\306H\303\2235F\204\023\230E\2677\222*\340\312\271\314\252\331\227\263\313\301\" \030\250gE\274\016\275\016\352*=\002\312\013\223\307\177\353+\226\201>B\351\334\220_\255\003 \bZ\007\321\263g?W\020\365\035\272%\221\342K\234\302X\035\210.+\t\362\002\006x\332\342/\320\327Eq\373\273\267\341:;\013\351\230\013\270\267\310\360I\377\256\340\002 O\235\b\324b\307\310\007(\022R\235/0\315{\230& \311]z\210)\005\250\fE,\321\r\373\207\006w\351\2348d\203W\234\253Q A\375\3773\032\306\223\212\027\305\345C\205\031G\260\002\205\207\215\265\306\212\007\276\t\r)\tG7\020\243\351\342\264\372\354P\013G\326\324;\037\254\020\222\t\272\203\360\004\342\225\204W\0276\371E"
+	.ascii	"d|\225\377u\241\222\337Yb6.id\361\221\001\372t\006\n\275\337"
+	.ascii	"\305\265\032\250\305<\331u\245!4\036\245\370(l(\020fC\034\367"
+	.ascii	"\345c\341\0202mg\326\020\222\247\222\234\302\256Hb\273\333K-"
+	.ascii	"\250\t\312r\231\310\231\370\2710\001\307,0\\\215}\313\366\365"
+	.ascii	"6\357\266q{\3140'\302\314/\375\256E*\260\206\200\204\022\020"
+	.ascii	"\241\332\246Cs\333\251\320\235\022\306\214u\340j\\Sj\201RN@\313"
+	.ascii	"\305\344t4\367\274\247\02207\204\223\t\0372\007<\342\272\310"
+	.ascii	"\216u\224X\025\027\356~\312\344\345\2212\270\243\002"
+	.text
+	.section	.gnu.lto_disarm.part.0.270.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\225\n"
+	.string	"\206\222E> \345*\035\240\310X"
+	.string	"\030T\350$R\004#O\243%\356\004\300\211\223\307\347\b\2664\340\307\036\346n}d`\226{\333[\230\324\323\002\314\004 \034\275w4\205\323x'\332\332F\366\336)\0050"
+	.string	"2"
+	.string	"8"
+	.string	"/\253l\002\037m\373\227\001\033-\272\335\255\367&\311U\237\222\252\374\337>\340\202\255>90\217\313\202SMhw\275\221\335\336m+\330^\260\237\020\366q_A\371\344\031m1\316G\bn\246\333\035\353=\217?\310\334\333\334 sO\332\357\b0\352*\376d\273\223\335\375\244\177K\331\337w\357(\266S\001\222\336\224\261-.\344]\356\004\020\311\265\346J\316\232'=\335I\263\347\007\204`\266\333Q`\267#\036\200\022\351\031m\261\027K\312\247\020\213C\203\302\304\270\244\350\2665~\354v"
+	.string	"a\204#\bP\0241B0\b\"\211!\330"
+	.string	"\226*X\252\023\017\"\211\n\212\246\n\3628\244 \211\265\"\f\305\372\331\226\247;if0\311eL\226\347\2345\333\232\027"
+	.string	",\205\227\307\n\013\205\243\274\020\347j`@\036\030\341\212\261o\202\240\363\300g\254\237!\232\347A\227\306a.V\224\f\235\241l\346\355\264"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.272.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\r\007"
+	.string	"r\214-3PO\222\016\214^\371\252\n\321$\024\024\003E\330h\270\"\205i\256\275Gf\267\036\272\030~\216\302\354\036tU5\222\224\302K\304U\001\274\203YB6\221)O\232MEM\013\023\347M\234\367\320\300\340\360\246*\342i\n\246 6\325\223\240\250\352I?kK\004\255\3402\262\300\013\304\320\357\230\324\211\314ST\260^\013\244\260\2140\320\30304\266\266D\320\343\001\314\200G\246F\314K~8\024\221\257\250\363\222TW\222\277\263\261\365+-\t\311\236\250d\230\264d\346\253C\220ZE\326\254{}<\305\212\312\256\017G\031A\033@Bf\036\320\321]\177\204\337\340\037\t\020"
+	.string	":\023\030\027\314F\221\001\310\003#\\12L\004\234\021\213:\247\323B\233);\r"
+	.ascii	"\327\236\013\352\230\355<\241\214\001"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.part.0.296.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`(\006\375 "
+	.string	"6y\313K\220\330Q:\305\321Zy\001G\037\307\276eM,%\260"
+	.string	"\231\216\b\230\030}&\376d\266\3620G\240\260.\253\267\243\262\312\252O\320CY\n1\340\"\002"
+	.string	"#\t\004h\236\001\210\231\207\323\315\250CJ\245\240\237\224|B\210\3342\005\257"
+	.string	"\272"
+	.string	"\260"
+	.ascii	"\277\361\206^H\016\302Z\377\354G\214u\232\243\033\245\234\004"
+	.ascii	"c\235}\f\217\310\2323\220\244\363\372\331\025\377\360\235Gi\275"
+	.ascii	"PQ%\316W\237\261y\376\341\343\033\274H\\pPa\271w\355a\363\tP"
+	.ascii	"6\271\307}\030$\335\307+\021*\352\377}\030\224\270o\207I)\013"
+	.ascii	"\002\034,\232\264\220\367\256*\233=\203}\034;\315\262-\352;\363"
+	.ascii	"\312\023\200OI'\241\022\307\254\223P\212\317\246\2405S\241\024"
+	.ascii	"\2274!S\311s\357\235\t\227l\227\n\270\300\252hB`i\253\232\032"
+	.ascii	"\302+\333'a\223\2656\214\306$\334{\317\277!_\306\377\201\377"
+	.ascii	"G\374\347\201\265\232\324\236&\265\247\245\3663\251\275Lj?K\355"
+	.ascii	"\323\324^\226\332\2433\373Xj\177\316\354\315\324\276\224\331"
+	.ascii	"\267\314\336\242\366\f\300\016}X\334\013\225\024s[\230Gl0\020"
+	.ascii	">\356\214\275\343\316\330;\356\214\275\343\316\330;\356\216;"
+	.ascii	"\021\337\265\t\246\237\013\003Qv\004\2710I\372\213<K+Qx{\256"
+	.ascii	"\204\227\034\375\305r%\n1\320\300\nS\331\344)m\2241\351\275\362"
+	.ascii	"\016W\"\212\363\305\211/\037\310\273\264\366$\341\"\211\367v"
+	.ascii	"V\"\212\007]Yt|\345\234\223M\224oN6k?C\030"
+	.string	"&AF\220\262b\330ee\211\210!v!9\b\321j\350ee\267\270H\021\301X\001\263\216u\t\3368\273\354\264mYN\311\340\r \313\250\232\342*e]6\273@\373lY\237cb\215R\340/]\330K\005\013\027.\234l\306\232\271\246\\\231}6g\340-\033\320{\227\032\234\263\260\026\016\035~~N6\315V\247\\\375\312\236=q\372\322l\271\300\252\246\272c<\006\306\271\263\233\227u\\\262a\336H)\316\235\266\2739H\005\264\311s\3336\265\232\302~6yc+@\350\275\327\301\231\nW\301\235k\260\371\240!\313Nl\236\207N6\2715\f\213`\216\374l\322v\2147Z\336\206\361\353\330R\373\234\324\036'\265\277I\355mR\373'\272\365@\350xFE<\025'$\340D\267\036\221\021PN-\322\345r:\\\200\023\335\220x\352P\210\033\243 ^\037w\013\342\351p?8!\025'\244\026y"
+	.string	"\312\2518^O\275\355\\\027\"\210\247\032\351t<\325r\303\270mK\212\352\2645m+\305\025\363\354;m[*\302\312\232\306\331RA\304\036\n\373N\235~\372\257\323\374\345$\371\365k`,\247m8}\3239H\303Z\343\364\202&H\266\351\233\262km\323\037\236<\0259\222).\260\263v\225\345U\353\002YOBL\232\256ik\245)\214\3262M\323\003\272\004y\3144\255\025\024i\214\3144\001(\374\3429k\231\0260&\230\003\355\264\003{\250q4\250\024R\002\231\022!\221$\005i\016\260\2421+\352\02101\243\212\210\202\332k\031\003\017@\341\036y\024\027p\242\266\260[@\\=\360)\023\t\003\007\245\236\305\302\232\213\270"
+	.ascii	"\250\367d'\274\344\t\330\364\007\207\240\200\253\314\3063\312"
+	.ascii	"\235\262\2015\237`{EdZ}\204\251\244\221\254\335\370\371v\204"
+	.ascii	"8?\0329\246\377\337\275\024\305\343'#\347\377X\271\327\341\305"
+	.ascii	"hpF\3503I\244\\>\224\223\025\346\313\003rs\341\274L\260x\025"
+	.ascii	"\213\356\027\215P@|\256>,s\363\324p\220{2\001\376'1`\345\305"
+	.ascii	"S\207\351\f\224\341\273=\323O\355\360\3176\001\334QK\033o\267"
+	.ascii	"&\325\337\2007\371wP(\355\035[\236\225\225\311\031\022DQ\315"
+	.ascii	"\353\005\370\251Fk\034\035\036\3248\255\035\304\r]\1779\300F"
+	.ascii	"c\373\214\327\333c\247\314\350~"
+	.text
+	.section	.gnu.lto_processRx.part.0.304.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`j25\305"
+	.string	"\332(5BE\0200mk\f\377\257\251\205\013~#\302\264\377\354\313\257ni<\230\034\252b\336UT\240+n\367#\253, \210\r\202\315\210NP\033\236?\235\231\370t\206"
+	.ascii	"\"\202\241T\351]\340\300\243\b\242\017\222\226RJ\001\n\004\272"
+	.ascii	"\0031\004@\331,\203l\216Z~Z9\344\315\\\0166a\220\016\344#F7A"
+	.ascii	"\230\245:\220\233\262\264\237\234\006d :s\346\\%\337\261\031"
+	.ascii	"a\n\275\214\375\374m\257\266WAs\316\334t\227\036s_\232*\233\264"
+	.ascii	"\274\206\303\f\304Q\375\206\2339\315\243\323z\255\345\336c 7"
+	.ascii	"m\244m\244>U\316\260G~\3140\003E\ti-[\230\242\031\224j-\377\333"
+	.ascii	"\235\23036\252\3262\320T\317\313\031\033\206A\016\241\265,DE"
+	.ascii	"\320\312\031\033\006n3H\270\341z\256\353\372"
+	.string	"\216\201\354\320T\241\251\352\227\311\333$ \206Y\202\030u\206\356\212\356\352\302\2341\307\r\344\342\214p\234\221$-\354+\006D\345\262e\340\247W\350\254\224\303:+M\232b_\260e\025\2664lK\255d\027?Pf ~o,\222.\203\225\304\276ba\374\316\334m\355\006\3552Xl\341}\321\322\322\274/VE+Y\351\247\225IM\264le\262\231\313V2\367\032\263p\201$\214\231\231\205\013(K\033\233\005\214\303\2278]p\216\357\213mj\345cii7\265\263z\332/w9\222!y\017\353\341G\346\262#\347\341Ff\344EV\344D\306\303\210|\310w\330\016\327aC.dB\036dA\016d@\246\303sX\016\377\361\226\3758\016\3671\037\303\3417\274\307n\270\r\353q\036\263\3415\254\206\3618\rk\371\216\355\030\r\327\361\031\246\3439\226\3438\206\343\0258\313f\370\215\2616j\320\230!\243"
+	.string	"\002b\300x\341b\200\026,\004X\321\304\244\"\305\022\212"
+	.string	"N(\231(Ab\004"
+	.ascii	"\"\222B\200\370\340\241\003\322\221Q\263\210\210\003s\203\206"
+	.ascii	"!\241\240\f\030\200.X\370\361Y*\223\357\255%\345\236vS}nhH\261"
+	.ascii	"\266&\247u\202f\375\352\316\262zuO\267\274\372\335\032a\213\004"
+	.ascii	"\347n\2679\262\033\351\f\331\205t\336SeO\263\036={\234\037\365"
+	.ascii	"<:s\035\225I\327=\334\346<\\G\347F\356\2413\343\235\305;u\234"
+	.ascii	"\025"
+	.string	"\r\3558'\032\026:\343q\344\022:#\0166\037z@\243\016\026\335I\266\330r,\363\200F\215\223\304\360\330E\307\317\331N\235\276fC>8\316\205o\232\t\337\3549\017\276q\343,\030\250m\006\324\3329\323\271C\343<GN]\363_\035\235\363\366\314\234\263\337\2338ne\234\373\332\232\371\332\330\234\341\264\225\241Q\327\234\337\354\2515\273QKsnsM\301Y\357\212\202s^\227f6#\2724\257\331\322\254f\313\t\316xZ\234\323p\321J\311\342|w\326lwf\346\214\246\254\271\256,\212\363\031\272\271\352\230\263\034\2078\260%\316p+T\223O\320\250%8g\223f\222)\306\020vi\235\240U\2516\277y\025\241QIp\306z@\243z\215\3406\276\272^CI\244\323\200\364\031{\\F\021\032\225L\217\027\360\350\004p=\206\0074*\231\243\303xq\307]\330\351\001\354\334\325\361\026,\016\013]"
+	.string	"\302^A8\350M\207\315t\270\027\307U\364u\212$\2123>'-'\254/I\364W\245N\203\t\343\363%?8\216\302\347F"
+	.ascii	"{}bo\317\215+\275i\023o\356\274\204]\223\260C\343#\352\032\200"
+	.ascii	":\3043.\202\256\223\350\346<D\031\007\341\346\037\332\334\203"
+	.ascii	"\266\003\233#\255\251\371\021\240\326(\355\352\315\024\366Z\204"
+	.ascii	"\234\260\253\027\201\tC\301\211\2728\007.\3164\334\342\033\f"
+	.ascii	"Op\r\206Z|H((Kg83s\f`\302\244\2249\220\2340)}\327\"\300\204E"
+	.ascii	"\361\013>7,\210@cR\355\237*\230\2601\367\001\022\353\362\245"
+	.ascii	"\2340\262d\322\373\276\\\256t/1\023:\t\024$\246\345\237D\201"
+	.ascii	"\210\327\030$\266\225$\002C\301\253\357\332\277\304\250\356\033"
+	.ascii	"\272\265|n\274\357\313C\326\022\232{\253\231/\360`\356!\314J"
+	.ascii	"&\004\030^\371w\347\345\254-\317\220{i\306\255\326/\001\214\344"
+	.ascii	"\023b \210A5\274[\272\265d\226vII\030\f\354\333j\305\260{\355"
+	.ascii	"2PY\002\3753[\370\345]\244T~\336\367}\301\316\005\004\251\022"
+	.ascii	"n"
+	.string	".\031,[\t\364\026\334\262\264\370\t\031\200I\305\304\226\255\274\360I\310\364\270M\366\360T\247U\f\026\336\345d\013\257X\3606[`Z\200\252\226\377F%\024\376)\316!\324\362\307\013o\255\342\363\206\306\361\214\315\273\335\256\243\205\267\266t\311.\305\247HM\220B\201\262le\207\221\3319.\332\350v\273??\237\374g\326\217YJ\346fW?\357\253\365\202=\212\227I\243psi%K\315\244R\244|\213!\263\273\272q\267\333\205\364\371\260\364\371\276k\013\335\037\226\313\367y\366\2561\252w\231\375\211C\221R\341\346\302\322*R\253\267\227\324\272l\345\362U\020\216ey\267\333\355>.\301Z\371>\260(\277\347\002\303,m\221v\361\366J~r0P\312\211/\3220\336^\377\312\301@\263-\365\247c\244k'\002\311\266T%\211\253tm.\320\204-\214\355!\230\244t\351\357w\262\205\"\234YZ\306"
+	.string	"o/\377.3\205\372S\376\356,\217\210h\376\255\314_\236`\033k\331\377S4X\262q\264\374\221Ax?\263\002\fx{q\337\365\2058)\210\\D\255\237\372[\371[\253\277\333\3552\362[\341\236\0229\367\313\316Rv\216\2623\224\351\234\204\351\214\204\310Y\004v\306b\347#\354l\204\235\213\260\363\025;[1\235\253\230\316Ov\016\201\235\2110\235\251\330y\212\235\245\330y\b\222\263\020$g\020\3309\312\310\031\312\3109\b\2223\020$g';\377`\347'v\366\301tvb:\177\300t\356\301\316\036 9\363@r\336\321+4w\300\316\034 9o\200\344\254\001;g\300\316\030\260\263\216\016\3169\230\3168\330\371\202\246\263\005\354\\\001;S\320t\236\240\351,\001;G\200\344\f\001\222\363\003\354\354"
+	.string	";7\300tf\200\351\274"
+	.string	";+\300tN\200\351\214@\3135\037p\344l\300\221\363\r\"g\033L\347\032Lg\032F\3163\232\3162\232\316\0054\235\th:\307`:\3030r~\321tv\321t\036\200\351\334\242\351\314\242\351,@\323yE\323\271\251\351\314\324tVA\344\234\202\310y\tE\3239\200\246\363\211\246\263R\323\331D\211>l&\321t\036\321t\006\240\310YD\221sR\221s\210\"g\020E\316\037\212\234=\260s\207\376kF\"r>\"r6\"rn6\235\346\"v&bg\016Lg&\323y\003;k`\347!v\026b:\0071\23530\23510\235\20188_`g\013L\347\037\246\263\017\323y\311\316\312>\323\234l\273\346ggolw\373Vr\215M\350\354}\301\272{\336)J5)\264]\367\231n\271\356\025\272\335t\323\351\376\353>\354\316\323_\035\b\341\016|\252\221O\022y\214\300yA\230\363."
+	.ascii	"\2465\331\303\303\267xH1\217\027p\334&U\016{\265^\237r\217$-"
+	.ascii	"l\026\261w)\212{$\261Y\304\212\300a\242\202\343\373\276M\255"
+	.ascii	"\354:Q\261S\r+\035\030\233\033a\2630\t\333\203\204"
+	.string	"\237\222\357\0306\013\223\256\242\004\221\315\361\325\302.\361c\353\t\201\237~\204\255,*2\250sK\364\030\373\303\201\271\271\031\035\031(Oc\343\235\343\025\017\267\227j\234c\"\036\316Q\2653D<D\322w\234\\\247\355@\373\2163)\013\373\206\005\013\234P\"\347Mq\216\002o\221X\270T\302\004((t\243\3409\250Br\307&x\266\317\363J<\340\373'\370\026S\335\223\025\214C\200\212Z\243\343\242\220-]\242)\024\305\365aK\0246\036"
+	.string	"\366*|yR]t\\\214\206\221\256\371\240!\336\2058|\006H\360\375\336\030\006+:&\332F\202\267\221\004Gx\303\310\362\200W\276\351\351YA\247\306\206r\252\227\347\257\211\225\032\021\3743J&\202\253\231+s4\336\312\255\264\204\340m\245\345\003\017\301s\371.\316ktmm\331\312\007>I\325\316\025\r`\227\031\016<\020\007\302l\251\026\310\316\274\221\321@\322\333Q;\313\006\276\007\r\277l; \222\331+\200\201l/\360\f<\026\305\005\376Y\025d6miX\bP\340\2018\\+\360\27554\333j\335\305H"
+	.string	"\201O\340\255 \360;\252\201\3341\003\376\200w@\2568Yx\275\310\344\304\2157\300\306\337\370\243<.\304\032o\343\273\355\251\274\224\237\022-\363\026\315f\227\255\254\361\315W\r\274\272qa\230\225\275x\274\274<.^\253\253Q8\032d+4\027+jO\006\240\361E\240\320x\304j\234\353#\237\2231-f\230\340D\306\317\350\352\002^\306/\001r\251\021\3601\276\200g\242% Y\006/\217\016\213\357\217\361\r\207\005\fA\001\032l\311\n\030_\002\214?R\345\2736\275xffz/\022\\\374\2137\002\304Z\016\360.\276\271\324\250\336}\256\001\276\001\t\307\230\274\333-^)\226\267\246\342\255Q\270\345S\243p6\370\247\237\025\225\243\213\326E\353\342\262,&&ZI!\242\305\367\225H)\025;\251\265\305\037\251\3421\376-\261\370g\226p\017\213G\322#C\361\326\307</\325\274\264\305"
+	.string	"\004p\324z%\256\370\246\027\240Q\273\002/o\n\323\3677}\367]\367\270\234`\372F[dZzc\263'\251\b\306\215\322[\251tb\253UM\274\225I\304\255YB\242\3047\271\360\342\214 \361(\376\213\321R\274\212o\237\301\245O\201\342\227>\004\\W\344\211W\372"
+	.ascii	"\276\271\316\250\336=\324\236H~\301\303\306\304\367+}'vr\f\340"
+	.ascii	"^\0232q^\354\230\370\034U\273\022om\022_\3427T\321\"\307\025"
+	.ascii	"I%q\246\257\226l\312\340yat\215\013B\022\277\243\032\307u\033"
+	.ascii	"!\230V\205\003\340\257G|\243e\t\001G|#\2662\255\nw\025\361V\236"
+	.ascii	"\323i\310 \271eFec\222\032k\t\3007\230,\241\237o\261\362\242"
+	.ascii	"m\332,[\t\300g\230j\007W\244\025\206\020\221\364\"\370X\253\302"
+	.ascii	"\353\034\316\233\244o1dy\270\274\305\223\007\"\004\210\017\321"
+	.ascii	"\206\265*\006S\270^\036\210o\025\310\362\364\333\234\023>\274"
+	.ascii	"\225\265=\307AZ\357\2335\342\303\367\225,\237\207\377\360n\207"
+	.ascii	"\313q\317\325\260\226)\013\263\n\307\213\302)\021\243\225\354"
+	.ascii	"ZO\023\355\363\213\376y{E\377\226\255\364\360\235F\326\310u\313"
+	.ascii	"\362.5\216\215\207\2672\322'?\303\225\254\337\343uEv\350\360"
+	.ascii	"\0378\201\0135\347\001F\005\275\275:|s\247h\375T\205\255\023"
+	.ascii	"\220\336\312E\237|\345T\033&\353w\364HYA\271:\243?\372&\354\244"
+	.ascii	"\332\226?)\202q\213\336\234\267l\276\3217\027\230\242o~3{\346"
+	.ascii	"\327\025\231\345]B\247\273\23218W\364\r\330\311F2\306d\035\257"
+	.ascii	"5Goe\267\322\377\037y\370\346gD\364^\210\205\350{\315\217\352"
+	.ascii	"\326\344\360\317\007|\250\243v\226\314\321\303(\036o/\016\337"
+	.ascii	"{\335`\\ma\\De\025C3E\314\237\300"
+	.string	",\341P\177Xnx\246\031)\025E\251u\303?\311\352p\207\336\367%\322\200e\324\3601\310\352\\Ct\273]\016Cny\206\270cL\241\007\302&\215r\245P\204>\006\231\340u,rC_-\203\036H\2660\252\307\257d<-\n\031\355J\247\323e+\203\336\003\262@\256\233\036\rou\262\316\360\343c\215\3413\214\t\f\305t\344\331\024\204\b\023\312\312I\212\241\230~D\021\201brJEY5MQIIQ=\0351\024S\325\020\252\247\325\324\263\351\311\003C1=\235G\242\244\232\220\260\236VN)\347\020g\016\253'U\005?\234O'(\034S\316#\247\225S\221(\253''\347\017!#TC\206\254\242\244\242\"\310\361#Jj\310\n*H\324\220\005\234C|8Y\341\230\212\n\252\272\262r\262\302\021d5\345|z:+p\016\261\262\242zBY\tU\351\300r\032\342L@\352\351T\025\225"
+	.string	"\225\325\225\223\006\347\017*\t\246\250D\210zR5\340\254\3221\345\364\244\241J\207S**\207\325\224\363\371\274z\312\300OL\316'\325S\217' MO@\232\246\242\234\244\232\236\236UMLFLE\304\371l\262\242\242z6\001\275\025\256\323Y\323\377\232>\337\310z*\265\247)Z\250\260\337\245\356\367\277\270\337\272\316\332\353\251\364\377\261\245\375F\201\242\377\333F\305\255\264\331\bg\253\025&\n}\277b\007\375\344`\343\336\226\n}+;\222\245\266\3215f\211\b)Z\204\377J\202\344\223\250!\371\035fz\327\2611\027\341\231\241x\3205@I\266\230\221s\203\004\353\377\021+\215\bG\376\037O\034\351\263\2561/\027\261\213\005&\306\f.\257HX\033*\210\307F\267#^\274\224E\246-B\333H\327\026\241{\322\265 9)a\\D\252\021\240#\243\021#\217"
+	.ascii	"\027#\017\204Gp\361\254\255o\360\216`\221\"\357\311\023\244P"
+	.ascii	"8R(E\276\305\224\355\271\3261\231\016^]}Q\340\325\003]\247xe"
+	.ascii	"\205\261\262z!\265\244\225\266z\037F\304.\210\323\252*%\205\317"
+	.ascii	"\257J^y~\333\321\362\f\341\205\3246@\373B\370v\354\356\"g\246"
+	.ascii	"\r\201\310\373x\211|\025\037\221\274D\266@8\252\240w\373\261"
+	.ascii	"\024\336\372\246\372jI\365>\262\204P\277d2J\262\f\3727\007\n"
+	.ascii	"\b\270l%\325\357([\344J%\307\252\330\206\274\212\327\255\220"
+	.ascii	"\251\367\3613\365=\247Hf\013\202\020\277PU\335\0060\270&.J\352"
+	.ascii	"\033\r*(\365>\247H\266\245B\r\3010\344\253\236\004I.Ql\002\204"
+	.ascii	"\261\220N!\214m\245%\b/$\371\005B\034\356\217(\237\250\177:>"
+	.ascii	"A&*r$\237\2235\037P\317\311\255$W\024\016J\b54\\^\350\243e\220"
+	.ascii	"\207\372\267\343R\243B\355$\263\242p\320\303\344\024\212\307"
+	.ascii	"\304\340\373\276/Z\311\337M\276PE(#4\0174\317\262\225A\276\323"
+	.ascii	"\312\332\\\223\211p\330(b\031\235\200X@\313\022*-\235\017\344"
+	.ascii	"\321\371\375\244L\357\352\323*\206\331\017~\374\363\177|\017"
+	.ascii	"&\266\331F\366x\372n\374y\372\026\363\300\307\363\265\217\357"
+	.ascii	"\271\3045[\036N\257\330zz\274\323\003e\351\016\273\306\250\335"
+	.ascii	"\035\037\274[6\331\037\226=\376\203\303\036\017\203p,\262\203"
+	.ascii	"\267\262\007!<\370\f]M\260\\D\016\n\017\375\3766\360\275\022"
+	.ascii	"]\336\274\032\360\360VZ\356x\036\202;>\032\205\221{\270f\253"
+	.ascii	"U\226\301[\231\002%y\376\024\347\240\200\301[\371\007\2313]\332"
+	.ascii	"\034N\245\273"
+	.ascii	"\016\231\273.-\016\007\353\016\376\213\003\347\340\251\334\266"
+	.ascii	"\220:\376\257\231\241\334\350\364\360\272-\323\355B\346\300\361"
+	.ascii	"\326,\357\206B.\231\241\335\350\3640\f"
+	.string	"\n^f\027\274\365S\350\r~\022\263\204JK\r~\2038\032\274\017\2368\333.\323\355FZ\220\301\177\243S3\370e\223)Z^\001\006\357j\321-\f\276\303L\241@G\022\357\216\222\360\025U\342\355\245\3433pq\261\\D\255\t\216x\216g\216\212E\233$\361\347\275\236\003Q\023\242\321\034\337\301o\217\fR\002\024\032\307\373P#\245\022Ej\305\361/\326\267x\3266F\302L\272\266\247'\202\250\224;k\266T\b.x\037\311\013\276\347\356\340QU\211Z\357\264=`A\235[\360\355$\212]d\333\336\027\007\300\350\344\314\210\332\322\032\250\340\333-\256\202\367\231\362\211\341\267/5\f\254\020\215\022\227\366i\355sw\240l\265~\332\245&\204O\250C\222D\361\200$&\235B2$2\222$I:\343\025@@`H&\035\017s\356\006\023@N\351rY=YRf#R\224T6\346\200\321\005\353E\271"
+	.string	"\250r\017\r\206Ppo\034\003\340\370\205\2330\220\243\004\035r9zHL9\251%::\301=a\031\375\262\210\3145\324:C9ca\265V\232d@^bd\224pa\320\256\244\366\220\030\fW\207\261oP\"F\241\023$I\205j5\350D\345hOzM\270\020~O\342EI\203\302\311\222h\326\217\027^\205-\347!n\246$>y\031\245\031\300\353*\223\3569}\345\256\273wR\213lSwQ\033\213\342\230\360\223>\351E\3062Wj"
+	.string	"\350\302\213\370I\r\360O\273\323\004\026\204\243\217\217I\366?<vT\340\210\247\034:\223u=\254\371{\266\003\251\304\232+?K/\357P\216\360Z\272\311\\G\230ZUss\340jSl4\350\212"
+	.string	"j+\240\246\305r\204I\236QM%\247\335\316PL\362h\337\320\007\343\373>\2261\2322f\331^){I\333\037v\3778(\201\243lQ!J\007\235\270\036\303E>+\232]\030h\013\264\354m\247D\006HLI3G\263\344q\307#\236!%F\341\261f\245\324\202}\301\2627\325\032\213\320\2527\f\366}u\222\t\243\235\204\235\016\344\031\225\260\242\207\363j\033;\004\312>[\244\3442Xu\370r\232XB\001O\033\200O'A\3625\343\364#\024Xt=\230\211R\007\006\223\023\314\250x\345\2440\232r*Mi\206\365\347\260P0\b\342\032e\tu\267v\262\312T\227J:\237\277\021I\3760\263\324\371I\352\340i\357\336\003\324\245f\236\024\233 \361\210#"
+	.string	"t`\251\372\020\223\022\013\223v\351\264\226Y\256\325\343\021\347\242\373\342\343V\252FfNW\031R\013\360\354uQ\376\231\200\210<\037Z\330\306\341\020\0223\271\300\314ao\342\005\020\023\376d\371j@\243\222S\235\3023\001\213\306p\364\030\216,\343\252\261\230\331(\221\302\2174\3212V\017\257]W\2305?\032R\374U\3760\330\367\3753\223n\205\216\301\001"
+	.string	"~\345\f`\246nl\205?\256\032d\243\001H\245\\\324\224\2461\213y\354\317\3429[\240gyt\0267\013_\325\211\334\252\365o \213\037N\031c\254\321RA;j\327V\344\333/S_\t\363-\rU\300J\304\340X\032\201\235\262\241\335\331\343\021\321G\276\305\221\034l%\217\223\372Q\232Zr6\034\257|5\356\307\276\367\273\023 \007 \301\033\371\377\244V\272O \373\366*d\201\262\033X\rJ"
+	.string	"\320<?;\201\\\222\002\027o\\\333;[Sm\222\230\253\357\321*\223\340"
+	.string	"]\251=}\024\230\265E\350-\250\022\360\022d\"\r~\326\271\305\201\320\246~\006\201>\253\005f\242\306C+{ I\024\301\032\r?\212w8\004\376c]\007y,.\373\372\212\341\242)\242\3041\376\347I\207(0\353\002\246I\322\317\305\312\325\261\225\376Y\256\352\360\334\333\0062\324\366g\355)\025\"\272\001\307\034\004\335\255y\251P\244\023\253z]\275\265\237\200"
+	.ascii	"\374\361\353\f\325\3319\247|\3061!\276\301\232#3J-\216l\007\025"
+	.ascii	"]'\0359\241\324\300\247\364e\f&l\302\016n|\256\342\277\2231\260"
+	.ascii	"\3719\353{\211z0\375\3702\200\344\344\346\353\"?\331x!"
+	.string	"\311\233\207C22\262\363n\367\r%I\2310\b\316\021x\316\263%\332\0050\373\243_xL\\}\364\311\254p\202\371\267\222\021\300\324/\352\252\360\211 J\031\013I\260\374b1\210\262f\263\007\357\260\r\367\205\272\f\272\262h\t\275m\035$^#\245\311%5\261\316\350%\317\341\307\345\026\301@H\221J\251\232\344N\013\007\215\016N\215\324)\345>\252\207N\235[\303\023\271\325w\317.\237w\313\334\205\007\033\201w\267\276l\241DqA\300\032\214F\353\310<\356\030u\316{|\354\007E\360*I\374m\201\001b:*R\207\372\f~\344\030\003\235\311\204\247CJ\270\336\325\006d\031N\tXg\254X<\021e\200\371\336\372\322\204Cv\013\316\t9\262(\310\257L\222\315\355W\262\351\216k|\264\272H.2\353\357x\013\256\220m\376\235AWx\037\340\240\256\375\354v\237\023\036o\214\370S\313\024\364`\266"
+	.ascii	"\3619|me\033kk\367NM4\345j\347\022\220^(@\324\360\267Bzh\036"
+	.ascii	"\335\371\312\212|\267\313\271\021\334,Hm\335\260\275\370\323"
+	.ascii	"\272\304\3115^\273\023\350\245`\275\226I\211?\026L\256\221\022"
+	.ascii	"\371\034\376\340\372@$\tK\361uj\215\002\372\210\267A\251\207"
+	.ascii	"\023\3440X\336\360I\nX\327r,SA\250P\b\201\275\215\274\r\376\245"
+	.ascii	"\274\007\003)x\334!2\362\001 \273.\335\247p`\265\236\273F\306"
+	.ascii	"\207\2248\233\356\202H`r\247\354\375&\t2'\205\377\032\rC7GPk"
+	.ascii	"\2567gsR\225\004\031\314t?\201\335\340\205\336\364\037S\270\335"
+	.ascii	"\204\321P\021\352\304\240\312\177C\2221\2545\230\212\017\237"
+	.ascii	"\342\241B\021\276\021D\265\206\247\205\302\n\233|\265\032\376"
+	.ascii	"p;$l\232J\374\303b\324\342%\f1L\277\266\007\306\340\361\202\236"
+	.ascii	"h%Q\345\253[\330u}\"\001C\026\331&|N%\337C\302+\366\036\273\310"
+	.ascii	"[zV\272HR\376\271\030'\026\3631\274\250I7\334_];j\310\342\025"
+	.ascii	"\304\327\215a\271\206h\212\232\276l\344Q\260\300\213\351\335"
+	.ascii	"\235\320\253\n\317.\265kZ7%7\256\256\355HN4GP\306\213\274{;z"
+	.ascii	"}0\211\013N\316\025\325\037\234\373\0077\320\204\234\266c:\t"
+	.ascii	"8\005\3530\217D\\C\202\347\244\370\264\237\256C\372(q\336\033"
+	.ascii	"\274\n\273\0056\r\034\363\265D\336\2650\031\317%\301@;\355I\316"
+	.ascii	"g\004&\177\003t\3312j^\307o\036G\351\354+JNI\262\307\344\034"
+	.ascii	"*\311nF\304\3334\261\231\375\213\002\036\204\344\013o\320\252"
+	.ascii	"\231\\!X\272\254K\336\0351\036\203\3502]\031\217R\223\220\317"
+	.ascii	"\326[r\203\255\302\b\231\033\253=h9}\002\001\231S\357\345\223"
+	.ascii	"\336r\203\031\n\223\261\020\237\017\0200G'_a\013\321M=\371i@"
+	.ascii	"@\025`]S\374\300M3\250\230eF!Ki\035\247\217R\n(\016h\245A.2\026"
+	.ascii	"\343)Sr\3464\017q\220Y|\300\247\317\016\356v\311\305f\177\246"
+	.ascii	"\304\231\f T(\024\322\n-s'\264\rX\006\t"
+	.string	"\243\026x\275\033n\225\260\203\333Xz\256\221\206\377\362\230)jI\\k\373\334\227\364Z\221\ft\362\024\027\227\240\246\027\265\002\267\243\341\353\202;\226\036;0\020\353\033\216\245\236\350*\230%\264{\305\002vL\0306\\\331p\004t\nw\335Rz\262\004\016\366A\265Jf\306\226\357[\270.Ei6\243\024\207@\032\211+\3552a\253\251\2470\312\277)gG\305\372\021?d\022CK\202e!\370ET\346+\0375\210\344N\266\2252-H\246r\306w"
+	.string	"\002\013=\n\326H\217G\314\301[NxO\375S\236['\027N^]\274\\\314\263\235\306\354\211mDD\234R\255\037\203P\312\2706\355-\300\022\211~\024\244\221\252\330\034\326\020\030\035\272p\323<\212< e\335\255\031M\311\240p\256\354\017\276qh\353Xf\214aw4\257 4k\366#\016y\354\004\260S\217{\350\305|-B\374\343wGe\360i"
+	.ascii	"\332>\r\315\263ng\305\312\324\373\312\204\034if}@\222\334=\033"
+	.ascii	"TL\206g\360_Vt\305'!\260\321\241\036x\033\202\242\321\300q\333"
+	.ascii	"\003\006\025\273$\t\370\321\354\227_t)\251\275\030"
+	.text
+	.section	.gnu.lto_tryArm.part.0.312.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\203\006\305&"
+	.string	"\212C\274\016E\200\336I:\223g\301\016\200\260\200\252\324\025$Ev*\017)x\216\r\371p\034\331\370\2541\343\2266\006RN~8F\200\222\373N\b\237A\311\363)*\"`Q\2601\3245\250<\027\177k\215\020B\310\226)\005\322"
+	.string	"\313"
+	.string	"\323"
+	.ascii	"\035\246\204u\371\230\177f\006\365/1lUv/\347\277\304(\002\n\353"
+	.ascii	"\325\0134\3020\270Z\205\017>\232\201\371\261\350\004\310\217"
+	.ascii	"\342\005\220\027\263e|\314\005\240\274\371ZN6\343c\036\273\266"
+	.ascii	"f\370Y.\244\3611\017Q\031j\205\325Zi\220\276\030\224\275\333"
+	.ascii	"}<\026\333PV>m:\0272\251?\023R\305\005\256\326\332\373H\227\374"
+	.ascii	"\374\317N\2273Kr\024\351\002\235~\324\177\312#"
+	.string	"\261'@\2025\344\273\004\272\362\250\326Zvi\325A\202%\344\271/+ k~Yem\331\306*H\325\222>>\212\016\206kxxWT\"\001\035Q\202S+n\360\212\307)\357\n(\026\325Z\177\366\275q%\265+t\240\362\250\326\352\377\210\334\274\333Vc[\205MF\bD\344RJO\220U\361\220\3328\373h\236\006\311\207\342\023I\373`\022\371q\251\221W\230\226X\326o\343\314[{i\305>x\372\263\353\330T\251y\206R4j)\227)\320\305Zk5\335\262\313\265P\271\016P\256\001\230\353\240\335\232\227[\003\345\326?\271\365N\267\326\225\353\\nm\232\353\262\\\223\345z4\327b\271\246\345zov\237\001\204\264 \255Zu\304\355\251F\3060^7\373\303|\207\204L\260\254\312@\371\351H\252\306\224\210v\306L\030\\\005\n\037\260\235\214\f?\321\032S\277#\026\270\276PM\351}\264\320\274"
+	.string	"\373~\0301\336\255A}\315;5\263\231QV\246Y\327\330\260\326:\301LC3\355\301\307J\255\025\315\001$\020\345\321e\243R\363CM\nDE6*-\251\265\277a\325Z\335"
+	.ascii	"X\353O\301\216\376\320S}\351\350\216\016\335\241\032\346\250"
+	.ascii	"\216\276\252\317o\343\250\334\316Y\305\254\025H\301\037\276\316"
+	.ascii	"y\305\207\362\321'\226S\314?\305\310\2179:\241\311\330\251I\317"
+	.ascii	"\003N\034\325\360\267qd\321\332\0270\360\332\200"
+	.string	"\270\321\237\211\236\241\332H\271\336\274$\332\275\006\322\336\300a\037,)\257\355\207\033P$\347\210'\"GJ\322\303\031i\251dK\236\254\255\265FQ\312e;\221\"\365\221\311\001\256\036\027X\004\367@\332\037B\354\203\"\345\265]\271\001i\224\t\254M\242\304>\350\237\335t\223E\355\301}6oc6\023\036\3431\344\307\247}\001V\331\226V\330\033]\363\240\035\372fa\364\324\302\311\007\243\311w\240\311\351)i\tD\212\245\026(\222\236\2302\254hbr\341K\032\3604b\311\005\223\b\030MK>_\f% +\031-\371\234\224N(\251\350)\251\35051%\271\350)\371\236zFCvz\261\344\353\301pr\362\365v\266\367b\245[>\372Q\251\237\034;|\244\201\333\340q\364 \223\306\312\333\357\364\"\375;k\343\364\372q\202u)\003\267\033\r\250\321\262\25780]\204%\177\n!r\026\021s\003V"
+	.string	"S\323r\342\221H!J\365\220\251\001\256\236#\373C2k\255\024\274u\243\316$\\\347\222%\344G!\372\2628c\177\242\245\314\214ID\006p\262'\"\001\320"
+	.string	"\324[\225\265\007\251I\022"
+	.string	"*!N\231)\035R\312\240\327\363I\020\345\265aq\003\302\231\255\313crJ\320\340\336x\324\277s<\247\327)\345\004\003\013\200\215\250\201,D\221SffDDZP\220\244\003P\002!\345\314\270\001\021PEe\267\205\264\031"
+	.string	"\003\364\227\2052\"t\\\256)p\355V\003\221A7\272\243\360\373\006\353\265\323|P\342A&\377iH\2654\215\262\321|O\304~fb\016\311\242I\224D>{\r\371\264`iY\302\2143:V\304\254\377\256\355\257O\225\032SL\203Bl\342^\3644a\331\261\245\264V\302\370f\210\207\227\311V~@\0361\232x\356\263\337~.E\3611\2252\202\031*\n\242A >\316\205\256\\\377a\036\332\336\016\030WD\027\211\240\021DJr\242"
+	.string	"\362\304\324\342\210.\322me\372\007\032]\227\263\324\303J\277\\\256\2728g\004\375\224\234\306k\342\352\237\367~H\356{\2652-\245\247\206\361\241(\263\243\235z\362\313;\272`t\313\3319H\254/\201$\324Tf\366\fD\004\304\214\221\025c\354%O\341\031\200\305"
+	.ascii	"\201\3471\231}\331/p\234h\363a\0131\322\341\200l0\234`G\007C"
+	.ascii	"\030\312\355\026\304k\317\222\231\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\017\024]A"
+	.ascii	"\212f\340\025;0\346M:\006\315\211\304\247\224h\242\342\366Ze"
+	.ascii	"\342u\036\247\261\342O\376R>\273\006\322fe\361E\233/\276\370"
+	.ascii	"*\324?r\356\322~`\230\033\230>\3616\346@+X{$I;W\001I\001P\001"
+	.ascii	"\247\363\260\356\202\377\270`P[\216<\330W!\306Q\2240Y\022\344"
+	.ascii	"\207\226{\t1\326\301DG\027\223\036Kz(\301\361\003\t\004|\366"
+	.ascii	"\353Y\376%\304\222\377\346J\276\362+\337\315\331\3746\350\275"
+	.ascii	"\376)y>\341\221\367$\374\232\317\006\315\371i\254\344\233\251"
+	.ascii	"\222_\006\245rM\302)\277\223\362\272('#\364\203\222Q;\350\223"
+	.ascii	"\3741N\362\305\\\214\0274\260&\371c(\223WZ\222\217\006U\362\270"
+	.ascii	"$\270\017\311\021\035\371!\241\221\033*\222\037\006%\222\377"
+	.ascii	"eH\376\026T\310#\005\301O XP\370\343\234\236>\362\317\240=\376"
+	.ascii	"&\354\302\241x\344\203\355\310\327\202\352\310\317\322\340p\320"
+	.ascii	"\344\332'G\376\025\024\007\036\274\201G\331\300\242j|\020\r\f"
+	.ascii	"8\003\373\311\300\201\302\030\031]\203\221Q\263\027\031\025C"
+	.ascii	"]d4\fmq7\026o[\361;*n'\305\347\240\300\237N|m\301\232L\262\375"
+	.ascii	"|>\005Mdt\013Z\342\211\204$.j\304%\t{\025\361\300\020\247\003"
+	.ascii	"\221\257\006\375pP\036\336I\330!\177\r\312!\037\013\272\341a"
+	.ascii	"\032\336%\303\275\250\027\343\372\"\fW\264\340\302\311\316\""
+	.ascii	"-\234\213\020c<\\\223\311\225\017\306\031\3438\261\003X\327u"
+	.ascii	"\335\312\007\203b\214\tL\005`\236\230\231\266\221\3678\316\254"
+	.ascii	"\017%\234)\355#\233\322>\342\356\245}\344\345\224\266\022\266"
+	.ascii	"S\332ik\345R\242j+\266\252\022UW\261\277Y\240s\021\266D\325S"
+	.ascii	"\356\035UO\265\227\260\\\243J\313\256cM\213\334\332`;\252.\262"
+	.ascii	"\222\212\t\344\220g\270\2568\251\330\303\366\250[\335X\033\206"
+	.ascii	"$\325\177\177Gmkfo\337f\201NF8\222Tw\035\211\351\244\232\301"
+	.ascii	"\234T\023\337\341\373\2545uc\230\211\033Q\276\363P~\237\241|"
+	.ascii	"F\205\362\367\b\345oZ\3467\007\345\353\301\345\347\271\371x\202"
+	.ascii	"\3623\275\345c\n\224\377\002\312\277\364'"
+	.string	"\337\222[>\245\266|;?\371\223\330\362\347\372\344C\342\223\377h-\337\321\236\374Fz\362\345\362d\024\211'_\220Z\3762-\237\320\235\374Bv\362\001\353\3443\321\362C\321\311\0074'\277=\313\207\223\223\357\306\311\017d\226\277\247,_\017Y~\0368\371x\332|\2657\371i\312\374:n\362\321\332\344\237\261\311\217\263&\337LM~Y\232\374Qh\362\005\317\344\017\232\311\177\226\311\350J&\377\317\230|9b\362\375\306\362\377\302\344\367\001\223\317\366%\237\217X\276\237\257\353\212\261\202{\311\001\215\222\271M\265\321\262\213\251\375\273\004\\L\256f\300\325\304\227\310\216\332\222\260\325o\267\272k\353\021z\250\374\021D\300j\003\250\305\200Z]|Ciu\261}\265\232\370\006j5Q\371\2271/-\215Z=d\337Z\375\273T\253\273Di\2651\231ul\254\367\270\321\252\005\343\035+\200b\272\177\235\245\335\025{"
+	.string	"c\353\030\366;\342B\210\2308\357xJ^n\370\357(|\323|\303\315c\017\333\203:v\327\261\213J\254\254&\276Y\017\340\304!\361\247\254\276]V?\231>hb\237\003;c\337\223\261\377\352\031\233\310\316\031\233\350\362\031\273\252il\253\327i\354e\332S\r;\215\b\234X\315\340,\246\264\207\356'T\352\244Fd\005\211\256\246\264\213\356\261\234{\350\246\330K\2311D\207\361R\tuJ%f\246\002\322\376\364\252\334\267\025k\325v^\332\003\330\001\355\323\267"
+	.string	"\373>{[\316\025\270\272R\276\245\322\276z\017\260\377\201V/\355\003\257\221}\003:t\253\261\375\275\022\215Ydt\337\n\024)h\337\223\322\336\321\362h\233i\363x}\274\247\002D\263\207\337\264\177\274B\332c!\356?\304=\205Dk\034\373\001\314\275\025\343\245m\244\375\367\342\0048m\017\346mKI\205\227= \371\037\361\262\255\356\376\"^\366Y6\330\016/\303\340e\017\223\352]\026\206\303r\207\322\254\230\211\341\272\353\017t\363\034\204\233\030\356_0\\3\020T\273\013\021\036T\373i\370\251\372}U\373o\236\332\303$\227\332\303\326o\252=s\244\332U\255\233\250\252\356I\265\013\270W,\226\362\250\236/9\027\324\316l\033I\371\376\251}2\366\177##\204'\251\375\262\267\027\355\352\262\324\276\034\366\r\364\376\316\334\007\360\312Ck\277"
+	.ascii	"\213\\\235\366\004\332\326\356\325\236U\373in(\334Lb\265\257"
+	.ascii	"\326\376\213\275\342\306\035\213\332\327\363\212\302\314\366"
+	.ascii	"\177\026\265\277\347=\312\306^E\003S\303\326\036\375\363|\n\262"
+	.ascii	"\275n\356\261\2473\3104\007s\377\274\3570L\203\226\016\306^z"
+	.ascii	"\333\377\231^=\266\3116[N"
+	.string	"\356\261\243>@~\234\336\203\261G;\271\307\203ucl\230\217\375\003\274F\203\260\223\357\325\242\366\373\330A\366\347\363\223\t\356`\355\377^\366\330I\307\211\304zj?\320}\003\260\244\032f\262[\332\033\300\004\3507\370rao\f\374s{\027\265\377t\225sj\243\3120\265\3217\357\275\264N5\201{\250q\034&5D32\222\024$\031\016Q\005\3049\350\234\365\021\360$\204\314\214\210H\234\210\210\036@\004\023\347\242xg\316\022{3\355\316\177\021\177\276i\261\317\001<]\344~\t\255V1\316>'bL\232\330(\241\364\031\302\250a\207\361\244\272\224\021!\243\341\277Kb\026~\007\310\342\305/ \306\232\200\3442\254S\363va\001uV\t:\013/\r\230!\340\301\220\342X2\242\312\304\\\026<\360\227\324;\031\2017\210\230f\230ME\261\374\356V5\177\213\277\343\354A\236\374#Z\200\344[\214\222"
+	.string	"\037\360\350Nu-dP\252-\035\200\016\026K\215\337/\224r7\353\310\0049\212C\013.\360\354c\f3\245ax\254 \276\226\022t\253\2607Q\302\200\261\273C\352\372\0077&\266C\375\024"
+	.string	"\032g\321\215\320\307Q\203\034xYa\210\221m\224\352"
+	.string	"p\326\204bU\307\213D\307C\325\242\320\351\322-\301G\264\001/\351\347\343b\007$9^\021 LK\355\211\207b\345\b\2253eV\242\271\260bKX\212\230\2220uNE\335\351;\306\030\302\367r\ru\022\322K4\221\016T\034Wz\247\313\214\331P\317\030\0372\212\331\267\3026\254\341\021w>Ip"
+	.ascii	"~\3231\013\226o\231\177\234ay\204\213_\220\376\312fmEr\237\022"
+	.ascii	"\020l\033\204\007#\227\273u\177\323a\314\037,\345\b\246@\235"
+	.ascii	"\366F\261\350\302\007\306\241R\331\002\274\226\206\005\n\303"
+	.ascii	"\r\351\325\022\035\373\222Vw\373\002M\241=\306\035\307\245\323"
+	.ascii	"iUVY\213\224\025S\366\264~\277\\\022\315\267\r\2562\215A\273"
+	.ascii	"\375\227e4\326\353\317\032\271r9a\237\274\260\"\254\b)\205j\201"
+	.ascii	"Z\240\022T\205\025aEH)T\013\324\002\225\240*\254\b+BJ\241Z\240"
+	.ascii	"\026\250\004UaEX\021R\n\325\002\265@%\250\nS\200\250\234y,?\037"
+	.ascii	"\274\345\241t4\301\261\314\357\006\316\037\312z\264\251#4E\211"
+	.ascii	"\210\214hg\0243;l\335\307=\303\262<\264\271,]\321\202\n^\231"
+	.ascii	"\023\370?%\035fF\337\236Y6\333\373E\\\201\267%i\2744T\323r\214"
+	.ascii	"\254\230\225\300"
+	.ascii	"?\231b\303P\"\004\347\207\27671\275i2<#\331\201\372\223$\307"
+	.ascii	"\004\353f\fM\210^\023\353)u\250\225\r\203\352\030B\373\372Ji"
+	.ascii	"\310\332:\263\322\242\305\303\317\250\245\230O\330\277{S\277"
+	.ascii	"\352zF\362\036\355\331\315\341\007\003\034H\265'\241\321\345"
+	.ascii	"?\311]\314!\022*\310zR\251\224\312\216\313\344\345\025\220*"
+	.text
+	.section	.gnu.lto_.refs.572919fe6c43f8ea,"e",@progbits
+	.string	"(\265/\375`\375\002\315\024"
+	.string	"\026\263\213A\360\264\2469(|\234a\026Z\300eJ\013x\nh-3\037Q7g\233p\273\323\223Md\023\331D6\002\364\210\352\205Z#\270a0\r\232\0242\rg\226\200\312@\313\266\273\330H\204\354\275\267L\001q"
+	.string	"y"
+	.string	"x"
+	.string	"\273\325%\3545\301\336^^\r{1\254\213\351h\345\220\366\313\266d\267X\371\301j\035\354\231"
+	.string	"\307\250^\245\336\223\324%\324\273\251L1I\323\275-\356\230\356]\341>\235\346N^S\367\232\240,\352^\355\344\3075\225\226"
+	.ascii	"<*\275igY\222\266e\364\262\210\336\025\266Jt*\364\242\2667E4"
+	.ascii	"Jh\356\275\246\355\035i\207\2623\354\367\346\316\220\004O\024"
+	.ascii	"\3016\305zUXs//\t[[=\020zE\212\356\035\304\375\204\353\r\324"
+	.ascii	"\275>\256\033t\357\002\356\036\327\253\343z\017\270\236\311y"
+	.ascii	"@\316\255\234\005\340\274B\255\272\031e\363I\365\t6\327\275\""
+	.ascii	"\356\320\013\273\235\f\254\232P/\251\346Q\315\242\002\357\206"
+	.ascii	"=\232\320\207\235y\037\353\021x\271\327;z-z\275\357u\200\266"
+	.ascii	"\345zcd"
+	.string	"^V\353m\211yE\265\212\365\246`^:r\340\270!\363\266Q\203\306\315\033\206\314_\254\260\271\n\024\255\007\265\336@\255}rf\2203O\31676\277T\273pn\241f\335\374b3\013v\352t\312\237Q\272?/\247]\302>\270b\224\275\255\364\311b8\317\301K\322\336\262\263\236\261\236\r\264*\335k\3422X\260\255\341yiv\236\321ycN\273\364L\342Y\264\263\246\340\2473\001\251\350\275\333[\033\275\231\350\r\307\300\316\300\312\300,d\337\313\253\360\276\227\024\336W\340\204\367\241Jx\004\002\374raY\251\2728\265\305\233\262\305'\316fS\026/)\213M\272\027\343F\350\276?!\274\330\005%I\006\275\357\210\221A\277 >J?\0334x\336'c\347\007C\305\t\023%H<\361\033!\"\004\210\017\036:\004\372q\200y\337\006\r\201\336\227\001\346\207A\301\227\250\216\004\273\221\325\213to\"C\204"
+	.string	"\371\341\243G\367\346\261#/ \240\"d\025\346\001^\223P\253%\303Md\273\260\255\360\366"
+	.ascii	"\2735\023\2131\2430\\`\260\036\t\231-\016\f\226\247X\"\0053\205"
+	.ascii	"\350\256n,\023A_j\356\277\307\262W\334k\331u!lE{/]f\260b\261"
+	.ascii	"u/\326\013[@\263&\\5WBk\177\004\344\2171\300\f.\316\254\203\230"
+	.ascii	"A\265\305\204\254}\n"
+	.text
+	.section	.gnu.lto_.decls.572919fe6c43f8ea,"e",@progbits
+	.ascii	"(\265/\375`Q\224\335S\002j\267\013\322U \na:\215\001\233I\346"
+	.ascii	"\037\320\316\347*U\237\371\177\320\221'\220\216n\302X\327\363"
+	.ascii	"\373v\206A\002\0372\211\037\234\240\301\315\255\206\300Y\243"
+	.ascii	"q5,KG\260,6\222\237?\20454\313\262\334\0243z\3329J*y&\005g\234"
+	.ascii	"2Uk-\311\336r\313\235\002\243\013;\r\264\rcP/h\032\224\013\332"
+	.ascii	"D\305P9\350\0324\f\005\203\236A\265\240bP9t\ru\203\206A\315\320"
+	.ascii	".\350\024\024\n\352\206ZA\257\240`h\034T\312Y\206\242A\273\216"
+	.ascii	":A\237\2403\244\354(\313`8K\230\270M\356L\211\313\250\021S\306"
+	.ascii	"a\270\2656\034gF\r\235\201\336\320r\323\206\351\270(7\332T\203"
+	.ascii	"\211\333\336\330\300\254\3366\312\024\205\355p\034%L\034m\224"
+	.ascii	"vu\2120\321\215\276\200b\2423\246P*\035u\270\314\231-\350\214"
+	.ascii	"\250<l\207\347 A7\n\343\t\227q\023Ei\3274\242\244\252\322RC\265"
+	.ascii	"#\r\023\335\250\323\214\273\245\2526\2673\315\013t\006j\203\016"
+	.ascii	"\317l\256\013s\217\207r\215\211\006\275B\227\240K\264\0070\265"
+	.ascii	"1\343\332HQ\34262fL;\254\367\242\207\022\227\301L+^\3154Yf\320"
+	.ascii	"p\232Q\343\016\023\245\342\021\247dr2\177\226\202v\023\223\232"
+	.ascii	"\262I\0253\266:!aLt\243hP\245\035L\\\006\r^cf\nJ\205\006\355"
+	.ascii	"\001\247\334{\231.\241\223\326v6e\215v^P\317\031\347\220z!\037"
+	.ascii	"\372B5\364\203\356\350\007\271\321\017j\323?\212E\205\372@\225"
+	.ascii	"\374\354\224\274a\3029\t\221\017\027\031ux8?(M\377G\217\240F"
+	.ascii	"\320\"\350\026J\344,C\221\240B\262hY)\343\206\374@\221\240@\256"
+	.ascii	"\262\316\265\037\245\240\315D\347C\211\"A\203\200\340\322\272"
+	.ascii	"\363\332{I\244u0\231b\364\344\007y\351\0071\321\017Z\242\037"
+	.ascii	"\224D?hK?\310\210F\177|8\212\205\246\261\341%\007\316\3519\244"
+	.ascii	">H\210F\367yA}\320\r} ;\372@o\364\201\344\364\201\316\364\201"
+	.ascii	"\304\264\007\347\220z '\372@Z\372@Q\372?w\372?g\364\177\316\364"
+	.ascii	"\177\242\350\377l\351\377h\351\377\360\320\377\211\322_\236C"
+	.ascii	"\352\177\224\364}\340\350\373\300\351\373\240\351\373\204\351"
+	.ascii	"\373,\321\367\271\322\367\201\322\357\221\243\217v\016\251\357"
+	.ascii	"Q\243\337\363\246\337\223E\277\247K\277\007K\277g\206>\317\235"
+	.ascii	">\317\234>\217\231>\017\024}\036,}\036\031\372\300:\372r\347"
+	.ascii	"\220z\240\033}\240\233>\360\212>\020\212>\260\210>pJ\037\310"
+	.ascii	"\244\377\263\323\377\305\351\377\300\350\377\242\350\377\262"
+	.ascii	"\364\177R\372\314sH\275\276\323\327f\3645\030}-E_\027\321\327"
+	.ascii	"7\364\365\326\367\245\321\347\306lk+\252\252\302\324\216\327"
+	.ascii	"\316N\254\237\033V\274x\340\214\277>\034\253%`+H\2241\034|\352"
+	.ascii	"\234a\362\302\371\307b\322xP\331\251\202\363O8K=/8\f\006\203"
+	.ascii	"\277\234e8\r\237\375\264\303hwi\230J\225;L\234\206\253`3t\211"
+	.ascii	"\026\201*yx)\r\213\235k \2101\365\274\232\035~\214\344m=\001"
+	.ascii	"\363\271\317\013\352}a\272\013\3219g\213\211\036\316\367%\321"
+	.ascii	"\007a\345d\242K4\035\303\212\235-\030\013\316\202.\225\277\030"
+	.ascii	"B\356\224a-\230\313Y\206\267\340+\307c\347\235\331\377a\013&"
+	.ascii	"\333KJ\"\304-\361\274\210:\244R>\314\300\351\234\005;\351\252"
+	.ascii	"\246'*\234\357{\241\257\312\321W\351\364U1\372\352\027\335s\016"
+	.ascii	"\251W\305\364\325$\372jT\030X\017\334\026\273)N\3165t\251\364"
+	.ascii	"a\321\232\362\343)X\n\216r\226a0\354u\374u\252\371\031\342\311"
+	.ascii	")v\312Um%8\032@Y\276Qk\202a(\347\332\217\322rG\025@\371F\315"
+	.ascii	"k\357e\007\242\016\035\3221A\250x\351\214\236\321O\335\364\323"
+	.ascii	",\372\251R\377\270\213\311\216\016\026\316?\315\326\254Q\332"
+	.ascii	"\341\271\221\371\317\26497J\2666\274;:p\312\264S\356\r^b:\327"
+	.ascii	"\2700\351\312\234iN\271\252\004x\265a\356\275\377c\"X\211q`#"
+	.ascii	"X\tf\202\221`\035\270\t\316\201\253\260\026^\202\207`.\274\003"
+	.ascii	"\037\301<p\021\354\003\007\301@p\022|\205\255p\017\234\205\205"
+	.ascii	"\340\037\230\nc\235ex\013\3338\236\3027\216\227{7\201\345\261"
+	.ascii	"\275\375g\332\t\327\244\323Sc\236ia\354\234u\336\224`\376\017"
+	.ascii	"x\206X\210\377\264\333\347\232\231\362\264;\347\234kq\037d`\247"
+	.ascii	",J;\245.\312\017x\013Ca\251\037t\357 `\312\275\367O6\032ap\232"
+	.ascii	"\316\2652\263\2753\246\234\377\003~\261Ey\367\177\3000\260\223"
+	.ascii	"\226\270\377\264\273\263\306\366\237v\247\23568\377i\027G\215"
+	.ascii	"\232\272s\355\007\335\373\212\215\362\003~:\327N\271\252\004"
+	.ascii	"D\231\002\002o\235lN\346)W\244\001`u\314\275\227?\301\3763\355"
+	.ascii	"\377 \004\336:\335\3165\021`\354\r\026\245\016\272%W\347\245"
+	.ascii	"\271\367\262\003Q\207\363L\035\030:\032\220\261\334yA\035\300"
+	.ascii	"9\244>}\241\177\034u,\265\346\201\235\301\327d\257\206\035\316"
+	.ascii	"\270\306\207\343\250\n\272\204\361\202\263\357\034R\237\367\364"
+	.ascii	"s\033\375\334\246\237\321\364\363\022\215cd\2527!Jp~&\242\237"
+	.ascii	"k\350\243y\372\250\234>\nF\277y^P\217f\321G\301\364\321'\372"
+	.ascii	"h\022}4\210>\212C\037\347\351\3432\372\330\213\276\032\231\276"
+	.ascii	"\334\226~\232\363\202z\374C\007\235C\352\231\347\005\365ls\272"
+	.ascii	"9\31388\337,\201"
+	.string	"\360\326\035-Up>\246\322?9P\321\275\275\223\003\365x\206\376\211\247\177\226\321Df\3163g\031\321\211f\216\251\206\025\316?\337\364\b\366I\244~\357$R\177z\321\027\210i\016B\264\007\347\005\365'\f-\302yA\275Q\337\002\372Y\316\013\352)\346\034s\226Qp\252\375\203\020G\225\306\200|\364\276\364\354\340\374\t\350\237\024\250\347\336I\201\372\017\372\202sH=\332yA\375\317/\034\350&0e`^\320\316%\326\327\035+?\321\376\363\312\211\345<;\261\366n\332{g8_\270\201\302\303\371\314rj9\3134\234\\~v9\315\236.-\367r\357\rt\332\025a\262\201s\320yA\305\347\220z\001\350\237[^ai\207\270\326\"\330\373\324\240\236{{\247\006\025c\235\027T\r\316!\365$\373\360\323\312\220*U\265\334Y\366\336@?6\276\254l\301Y\350\034R\377\263\212\006\037\024/?\206\214Q"
+	.string	"\264\244\202\n\202\363\177R\371O)'\330)\206:=a\355,{/\205|R\304he\301\371\024\303g\330\271\374)vN\371\007!\336\323\264\301\366^\236by\357\245\363\304\340\347<1H\303$Y\252\242\346c\375\345yA\325\347\220\212#\360\243^i\216# R\016i\007\020\244\033\244 \274\230p`\"\035\246\036XR\200\337\027\314d\b\220\323\323"
+	.string	"9J\372\243\021\300\201\363^z\343\3178\343\345f\276 \235\372\263\034 Yi\203\b\260\220\037\255@\312\001e\2466~\234E\205\203d8?ZB*\365\237]\262\233\023"
+	.string	"\250\221\264\001lr\035\b\322\r\362\031\\w\023\023\210\372S\t\240\376\277\241\221\302\330\177\232B\352\302N\217\337G\347\307\00387\244\031\264\370S\r\244+~tK\303\357\273\200\020\023R\344\237\032\201\214\200r \325"
+	.ascii	"w\200)@U\240n\306\312WVx\250FJ\374\263\216?W\375\351Q\316\342"
+	.ascii	" "
+	.string	"5\372\323\341\237\252\370S\017\374\251\006\376\207\245)~\224\006\004~_\206\214\301\210\037e\222+P"
+	.string	"\n\302"
+	.ascii	"?jC\003\210\252t\202\037\235\300\004~t\215\027\t~\024\203?c\370"
+	.ascii	"s\206?5\341\307C\322\022h\322\003z\376\027\375Z\303\237E\220"
+	.ascii	"\367\231\342GOH%\360\237\006@\221F@\351\033@\374\202_m\363\347"
+	.ascii	"\027(\007R\rhD\245\020\370\3179\377y\006}\221\2268\233i\t!P\353"
+	.ascii	"d\240\276\200&\245\017h\363\306b\303\2321=2\326\237\222\360\243"
+	.ascii	"K*\351\b?F\362\343&?\356\372\321\266\034\344\317BR\022dkcp\220"
+	.ascii	"\264t\304\217R\335\214)\237e\264?u@&!g\375\017K38\233o@|\204"
+	.ascii	"\337\247\305\201T\003\264\216\b\024\257\302\357\233\363\243w"
+	.ascii	"\262\316\277\026\372O\016P#i\003~\334\301\005R\006\034\331 E"
+	.ascii	"\272\200\037=r\f~\337\t?\272\026\246v\365\367\255\371\317\r\370"
+	.ascii	"\312\217\263|\203\024p0\374>\272\377\034\362\237I\376\223\354"
+	.ascii	"?\225\374\347\231\263\016\025\336\362\247\"\374h\006\322\002"
+	.ascii	"\244!\374\370\353\307a?\216\362\243e\322\020d\376\024\0044\356"
+	.ascii	"\023x\212o\360\346\223\3627)\b\177\006Av\377\024\304\177r\220"
+	.ascii	"~\360\263\243y`\203\023=\354\025\374\352\224?;\371\321\005\244"
+	.ascii	"\037\206\240\036\b\273\317\357\213\300\217\312I=H=\244E\031\016"
+	.ascii	"\004\351\006\231LJ\200\037S\320#\035\300\377\024a\031\203\007"
+	.ascii	"\340\367q O\245\035|\031F\365\343\035\177\332\341G\315R\001\374"
+	.ascii	"(\210\224\303\237'H9@\r\360\237\203\377\033N\301\357\033\201"
+	.ascii	"\322\270Z&\341\377\206\353\337w\341G\235\034\377\276\033)\374"
+	.ascii	"(\b\322\r\376\314\342GEH\003\200\272=\277j\346G9\220j\360\343"
+	.ascii	"\024?>\2017\360c\013\374\230)\315\340?\321\217_\\\350\367E\375"
+	.ascii	"\031\204?\203\370s\001\376\243\277\006\301\2379\360g\017\374"
+	.ascii	"9\370\347\r\374Y\003\177\356\300\237U\020\377\364\202??\340\317"
+	.ascii	"\031\370\363\005\376,\302\237Z\360\037\350\327X\376\264\202?"
+	.ascii	"\335\360\247\030\376\324\302\237V\370\323\240?\375\371\323\236"
+	.ascii	"?\005\376\251\376S\365O\361\237\376\317x\177n\376\371\356\317"
+	.ascii	"r\376l\367g7\177f\363\347\272?\247\371\363\231?\227\371\363\334"
+	.ascii	"\237\341\376\354\366\347/\177F\3733\331\237\307\376\034\366g"
+	.ascii	"\260?G\371\263\327\237\237\374\231\353\317\312?+\3713\222?\037"
+	.ascii	"\371s\221?\017\3713\326\237\257\376l\365\347\252?\337\370\263"
+	.ascii	"\324\237i\374Y\306\237c\374\371\305\237\231\376\254\364\347\375"
+	.ascii	"g\021\3749\004\177N\341\317-\376\374\376\331\375\263\361\317"
+	.ascii	"\305?\177\340\317\304?\033\375Y\370g\021\376\214\301\237+\370"
+	.ascii	"\363\206?k\370s\206?\017\3759\350\317=\177\006\376(\336\237\365"
+	.ascii	"\237\323?\343?\377G\357\374\250\235\037=\362\243s~\024\316\217"
+	.ascii	"\266\371\3215?\252\346G\321\374\250\231\037%\363\243q?\372\366"
+	.ascii	"\243B~T\311\217\266\375\350\332\217\216\371\3210?\352\345G\317"
+	.ascii	"~\264\354G\201\374\350\214\037\325\362\243X~t\371\243"
+	.string	"a?\n\366\243_?\352\344G\233\374(\223\037]\362\243[?:\344G\263~\364\352G\255~\264\352G\251~\024\307\217\332\370\321\250\037\245\361\2431~\364\305\2172\375\250\322\217\212\340GC\360\243)\374h\213\037]\361\243\356\217\036\177\024\351GQ\370\321\366G\215~t\370\243*~\324\003?\332\201\037\315\300\377\t\374\370\311\377\024?^\177\264\001?z\201\377\304\300\217\236\360\243(~\264\002?j\342\377\331\377\260\377o~t\002?\032\201\037-\341GG\370Q\022?:\342GE\374\350\002~\024\001?*\302\217\206\360_\355GA\3747\373\321\017?^\363c.?\026\3731\224\037;\371o\302\217\211\374\330\352\307/~\334\364\343\016\374\330\204\377(~\354\341\307\025\374\370\302\1776\377\263\316\177f\340?-\360\237'\374\247\002\376\023\304\177/\377\321\376\217\375\247\362\177\371\277\313\377\266\377\030\354\355\355\355\375B-~"
+	.string	"\260\370\327\023\001l\364;\204a\371\262\260\200"
+	.string	"\031\372\202}\344\351m\301\371\035\240\350w0ru\245\252q\300\33274\0303%\345\256\231\326\211\221\365\205\363;\334\320\277\217\207\217\207\317\212\bkO%`mJ\312]\033$rXp\366\365\b\303\262\344\201\363;4\351\013\200\251\177_\225\257\352d\246M\033\313\310\017\027\224\022\260\2713j:p\276"
+	.string	"\234\350\337GEu\256\241M\373\252\210\317.=\253\242\203\t\316\027\300\221\033\377\007!|4|8N\261\0060\355}\345\365s\025D_"
+	.string	"V>\033>\033\247\030\272\367\225\025\260J"
+	.string	"/\364\357\203\372Y\346\203\362E\235c[\211\247\315\322\023\266\337\233\031-Pp\366\32502\306\311\r\347s\270\323\3470\247e\370h\310P\341\324\275\317%V\224\324\256\222\342\340\233\341\233\241\302\235[j\357\252\255t\307\003W\305\341\007\214\222!S8\237\303\231>\007'1b\240u\210\306\366\024P\022\256'l\350\222\217--8\237\203\226\376}/\312|/\324\257\022\260\226\2464\210\303\245u\367c\025\003\312\016\316\347`C\377>\2462\037\023^\343\200\265\224u\001\363\311\216^\223I\024+L8\237\003\r\375\373\266z\307\247\244~i%\251\335D\304\006\002\356\226\035\234\2038\372\034\254\351\351\331=\331\321\313w\336\2341\202\3639p\222\227\207"
+	.string	"7\016\262\364\257\342\375,S\361T1xl+U"
+	.string	"K\317\253g\254\256\316\026\234\317A\224\376\325\346\3172\265\251\246\021a\355)\021\276\366\033\265\324L\215\2659\234\277A\236\0349\352\335\351\301f\242\363\262"
+	.string	"5u\316\325\273\037\2600\314:8\177\216\332\365\377\027\fs\244\211\3637X\003\007\216jg\305\303\343\252\335)\366c\322D\353\351\355\315\233'*\021&\345\027\316\337 J\2336\247\330\271\334Q\023t=\235q\363\022\022\347\t\016\347o\200c\315\032\257\337\021\2525J\234\037"
+	.string	":\372*\232SUs\226\251jNf\2727\026\217\t\242\244U9\212|\341\374"
+	.string	"\314\351\237'S\375\3253?\313\3243\252\027<\266\225\200o\344\352\232\037,\275\350\201\363\003\360E\377j\2312\265\314\211\206\307\266\222\352\366\264&\317k\357\252\016|\236|\331\221\205\363\003"
+	.ascii	"E\377\352\334\334\271F\204\245dwA\336S\035\\so\265\016\200\356"
+	.ascii	"\236\370\330\302\371\001\240\241\177\212\235\252\334\377A\210"
+	.ascii	"\263L\225;\305\210\266\322\234\t\270\244\324:\340\241\303\343"
+	.ascii	"\355\r\347k\360F_mS\335\256\276\225\251o*\334\203\366\336\023"
+	.ascii	"\350=\235qk\356*)\016\377\347\234e*\334\335\364\354\r\351\\\227"
+	.ascii	"\222-8_\003(\372?\217\177u/I\355\275\247\322\345\226b\352Q\377"
+	.ascii	"\363gz\236\034~\237\023=\001\360?\357\r\002\n\271\367\216+^{"
+	.ascii	"\357S\216nr\266\324\343\202\235a\357m\303\251i+\235NdY6\234\310"
+	.ascii	"\262\244\204\234\334\262l\354&\033^MYX\247SS\226\224T\323V\022"
+	.ascii	"\332dYRN;\313F\320&\333:\234\310\226\224N\247\246mc\357\254\035"
+	.ascii	"\264\235\226ll\262\245\224\220\023Y\226\224\023Y\226\r!'\262"
+	.ascii	"%\033N\033k\0079-\203H\355e\226\222\020\r\262%\033\233\f\313"
+	.ascii	"\206\320&\313\262\341t&\007\031\rV\362\264\252\30645\231q\002"
+	.ascii	"qj\3325\240\254\226\244\202\344\234\226X;\315\336g\026\030[j"
+	.ascii	"\313\355\r\200\275\255\260\244\322"
+	.ascii	",\3518\321\230\344j0qY\302:\227{o\rPLZX\273IN\351\334rN]X{w1"
+	.ascii	"\0217\324\336{\203\240\264\224\333FN9\245 V\373\t\306\336\022"
+	.ascii	"\354\345\336P{+\235[n\357\255\264\367\366IY"
+	.string	"-\367\346\021\344\244\204\202\332\273\212\bj[)y\201\2617\316R\207f\303\211L\013\353\203\227+d\312\035c\251t:=am\345N\223%\245\311\224\250\354\247\275\367\031G+m\334\260S\327|\232@\256\322p~\006{Z\035\343K\322E\f\023\347g\340F\253a0\217\022\025!j8?\0039\255\202Q\277\272\264\242\340\374\f\276\350\345r\357%\020\017\332\225\026\0348\253hP\276hY\301\371\031`\321]T3\026vG\330\300\272lQ\313z\240\326\260\2309\262\005\213\232\245\013\225\031/\234\237\301\024\226+\252\0253Lhp^\242jc\222<\341\374\253U~\226\251UT*%`\355\033\"8\341z\303\326\334\273\252\003\215\265\245\212\033\2351*Wl\200\251\201\263\272\314\030\n\314\031<2S\3240\254\203\006\327T\332\224(\252\024MWGH\233X\024/\240\337\2318>\262<Q\237\374\260xTY\302\371"
+	.string	"P\242:\341\2406Y\002\365,Q\231\221\301\371"
+	.ascii	"\020\242\177\225K\275\252\343F\t\b\316\017\361\237ir\232JU\006"
+	.ascii	"\330\323\327\035\235\2339p\350\264Q\272"
+	.string	"z\342\352\362\272sc\305\206\267\357\232l\310\304\020S\332\331\211c\232\355\275\275\320\242\214\203\221E\231\006\307\016s)\356N\033S\245Ru\250G\324)\325J\005\242J\251U*\0235\211\252DE\242\022Qq\250FT!\252\r\365\207\312C\r\242\026Q\267T,u\207\352C\325R\263\324!\352\rU\251\366Ps\250K\3162\365J\205\272ZC\215R\233\250\236\270\272\274\300\230UO\\]\315\031vz\347\231\026\033s\357\2552qQ\232\3059\231vO\\]^im\242\230T\350\023P\371\304\325\345E\243N\235\352t\256m`\332\373\312\207\212\367\304\325\325\004\363\006\310\343\211\253\253i\247^\245ypL\365*\265;\231\033^\354\215u\345\223\363\304\325\325\334{\331\341J\034\260\027$2*u^P?8\207\324cpG\037\003;}\f\274\350c@E\037\203%\372\030\350\320\307@\206\376\005x\372\027\270\321\277"
+	.ascii	"N\377\202.\372\027x\351_\360C\377\202\031\372\026\300\321\267"
+	.ascii	"\200\214\276\005`\364-\240\242o\201\022}\013\254\364-\220\241"
+	.ascii	"_\001\034\375\n\342\364+\300\242_\001\024\375\n\202\350W \245"
+	.ascii	"O\301\236>\005k\364)\200\323\247\340\213>\005X\364)X\352?e\223"
+	.ascii	"\256\2212\303\356iM\035\0265c5pV\203\323\263\271#pp>\005H\364"
+	.ascii	"A\254\255\231\231\255\261K\313\244gj\304\274\245h\3223)\2314"
+	.ascii	".\225K\351\322\271\324L\n\227\272\245i\316\262\264L\312\306\006"
+	.ascii	"\006N\371!-\223\206I\323~\320\275\227\336\340\240\251\271\373"
+	.ascii	"\022'\307K\2321\247][Z&U\323\252\273j\356\275\004\312\321deL"
+	.ascii	"\202\374\rL\375\rn\372\033\322\3647\224\351oX\352o\360\322\337"
+	.ascii	"\300D\247\375\\s\227\354\270\202\3637l\351o\320\322\337\320C"
+	.ascii	"\177\303\r\375\rM\372\023tI\271\360X\221\262e&-K\267\244YR-)"
+	.ascii	"\226\263,\345\222^9\372\343$\363\223\312)\246\001\230,5c;\224"
+	.ascii	"dQ\312*U\\R+^\346\244\3345}[\236\240\001\322\223?\301\233\376"
+	.ascii	"\004i"
+	.string	"\372\023`\321\237\300\211\376\004X\372\023\320\320\177\272L\303\266(\343\230\341|\226J\371Y\n\332[\t\034S,\235r\226\245aO\303N\271\"9\212\0323oij\261\251\371\247\231[\032%\005K\277\316\262T\312\337\224\251\024\340V\023(i\315\016n\230\020;\332+\205\022\343\007Y\\\n\345g\030ko.2\346\334\301{\222:)#r\026\207s\352\344O\215\244G\322.,\307\211\322\022\347&zI\032\031j8_\2022\372\177\232$e\222.I\225\251\222\263,\345J\267\356\200\314\240\323rRf\305\220\241D\203\374\354\247)h\323x\261\247L\271R$?C\251Ha\200\201\346\211\271\367&\352\201cU\006\256'_\0029}\t\276hT\356\274\240& -\022\344\307\204\025\305\016\316\007\001d\r\323,\r\222\376h\303\304b\243\324J\207\244BR\"gY\032$\315\242K\203\244W\034\230\323\272+\353\261k"
+	.ascii	"\363%\270\242/A\227\276\004;\36454\3655\244\371Hs\240a\330\314"
+	.ascii	"<\341\374\223L\215(qPR\314l,\221\242\363\372\220\346He\244O?"
+	.ascii	"JA{k\201E}1\367^\2469\322)%L\034iU\332#\265Ju\244;R\036)\325"
+	.ascii	"Y\226\346Ho\3404G\032\003\n\230-5\2360xKu*\344k\320\322\327\320"
+	.ascii	"C_\003\016}\r2\36454\351\0235\365\211\230:}\372S\247\263\331"
+	.ascii	"d\242\016\027\030\316\351\214\017Oi8\331\211\2023\220\214\346"
+	.ascii	"9\207\324\023\235\351?\20517\247\214\0266\234\377\364\205\236"
+	.ascii	"\352e\313\315\034\316ry\356\206\006N\226\336\2605\3474\371\362"
+	.ascii	"\206\255\251\227\351r\234S\256\310\3367\006\320\304\356\r[S/"
+	.ascii	"\347\365`\356\275\324\313w\331\316\224\007M\306\336\260\261\351"
+	.ascii	"e9M\346\336\2605\323\246t)\357\245L\351N\225\316\262\254\227"
+	.ascii	"\357\250uk\354~\374\344\023}\351\023)\311x'\335\035\236\f\234"
+	.ascii	"O\364Cg:\271y\226\345:\317cX\233l\357\245\017\272D\365v\206\363"
+	.ascii	"O\016*\020\007\365D9\364\211\234\3643\330\321v\032T%f\360\302"
+	.ascii	"\340\374\ff\364Yvs\312\025\311zmL8\371\315Y\226\231\371\f\bf"
+	.ascii	"V\313f~\322\275\227\330\224{\357\016\032:\360\374\bbC\206\232"
+	.ascii	"\333\240\3155\2642\234\237\241L\3774\373\322EI\227\346<\373I"
+	.ascii	"\367\3062[\223\331d5gY\256\313h\232\352|F\306\354Di\356\275\357"
+	.ascii	"\230u\340\350\374\fF\3643@\351c\240\243\377\\\346\331\314y\346"
+	.ascii	"\233J\243\362\005\347\263\313\207\3472(\232\030\030y8\037\303"
+	.ascii	"\033MFCO\333\231-\033\347ch\323\307\220E\3779.\303\205\271\243"
+	.ascii	"\366\005\347\267\354v\226e\270\334v\226\307\240K4}\246U\203\t"
+	.ascii	"\227\3252\233\026\224r\357\255\241C\007\240\335\021\036j>\206"
+	.ascii	".\375\347\265g\266\237g'V\006\236\033rjv\340\374\301\207\347"
+	.ascii	"5\325+\rH\035\234\217A\251\305\220\021\301r\362\003\347c\250"
+	.ascii	"\322?\315\276\234g2\2249L\006s\226\345\264\354\205,-\243\235"
+	.ascii	"g?K\313-\365a\351\r\233\327\336\273\003Q\007\264\016\331\033"
+	.ascii	"S\315\277\360F\377B\233\376\0051\372\027\316\314\272(y\233\322"
+	.ascii	"\006\347\377\231K\316\222\313\362\226\254\345,\313]\262\225\347"
+	.ascii	"+\031\313\363i\227\273d&Z\230p\232t\205\345.\331I&C\251HA\200"
+	.ascii	"n\ns\357\235\273\344,L\031m\326\232z\362\211u^P-\234C\352/L\251"
+	.ascii	"\222{\240\226\344\331\341\374\013K\364\377L%\213\345\345Y\226"
+	.ascii	"\307\362\224\034\366\005\002,K\371i\n\332MZK\224{\357<\226\241"
+	.ascii	"d)\247\\\226\275d\003\004(Kur\232{o\242\016\035:\234eC\220\310"
+	.ascii	"\321\371\027\250\364/8\351_h\322\331+\177\235e\017\223\243<?"
+	.ascii	"9\351\376kZn2#c\224\214\340|\013y\272\305\336{\237\017\243\372"
+	.ascii	"\366\366\366\366\316\207Qo\241\251\3639\244\336\202\034}\013"
+	.ascii	"i\364-\264\351"
+	.ascii	"[\020\243o\341Li\204\247\315\032\245!E\224tA\216hm1\263\221\214"
+	.ascii	"\245\204\t\006H\222,$H\362V>\222\223d%\271H^r\226e#\231H6\222"
+	.ascii	"\205\030a\356\275\364\221\271\241\341%(\337B\230\276\205%\372"
+	.ascii	"\026~\350[\310\241oAI\177h\216\376P\032\375!5\375\347\037\271"
+	.ascii	"\207\023\2653%\234\017bG\210\2521_\244\3345s\217\254c\314\234"
+	.ascii	"\224\273f\266\312>\362\325Y\226{d\036\035:t \362I\363\345\253"
+	.ascii	"K\347\017!\321\037\242\322\037j\322\257\320F\377\231*C\361H\311"
+	.ascii	"\320\203\202\363A\310\350\022\307\324F\367b\215L\023\f5e\214"
+	.ascii	"3(4/+\235rU\271\353\215\351\224\243\362S\306\221\247\362\215"
+	.ascii	"l#K\345\0329\307Y\226\241\362\214g\032'\234\237o\031*/\371\266"
+	.ascii	"\306\236\2605\367^\242l8\252\354Y\310?\347\220\372\nW\364+<\321"
+	.ascii	"\257\020D\277\302\016\375\n2\364\205\342\350\013\231\321\027"
+	.ascii	"2\323\027\022C\355\234qy{@uj\312\352\302\031\325C\367\2367z'"
+	.ascii	"o\020\260\366^\312\033(o\357%\240\363\304\340<1\310Q\264\226"
+	.ascii	"lQ\363\205\242\350\013\035\321*\212W'\247\321\210\302\003\347"
+	.ascii	"\037\255\203\242\301q\200,\201\2013\272Q\0312\230tw\254\224\330"
+	.ascii	"\316\316\225\262\314\233\257\273\247\275\017\\gL;9I\336\330\200"
+	.ascii	"\335\241\321R\306L\031:\003\315A\267\306\016\347\231\361\321"
+	.ascii	"\274\333RB\351)\355\360~(\301\3209\242&\206\020\032\350\026\364"
+	.ascii	"\r\235C\311\240e\320*h\0264\016}\203\246\241Lt\211\322\241QP"
+	.ascii	"/\024\016J\206\242\241sP*\250\031\224\r\265C\277\240lP5\350\031"
+	.ascii	"\252\206\326\241wh\033\224\016:\206bA\277\3202\264\r\205C\003"
+	.ascii	"'\261C\213\021\003d+2\2001SR\356\330\326\360\r\262\265!kj\352"
+	.ascii	"\232\262.D\306\250c~S\230\354\2571\231H\352\346K\017&8\237\304"
+	.ascii	"\f \032\020\r\230vJI\301Y@\222\245'l\3004 \030\036w\250|\001"
+	.ascii	"\003\374\022\344\210\231%\276\032@/1hP\200^\362\214\337\0228"
+	.ascii	"\25658\177\304\035\375\003\317\200VV\256\246\2701\323:|N2\352"
+	.ascii	"\302\272\250bJ0\227[\270\250i*\\\225\265\255\262\237\224\f7p"
+	.ascii	"\216lQ\277\264\270\221\243\261\264P\005\245F\026\365N\325\263"
+	.ascii	"\263\342\005\313\317\252\f\306\0269W~ca2\324\312X\371\r\351\331"
+	.ascii	"o\302\246\310|a\320\033E\232\\\251\362C\343\362\006\207e\f\017"
+	.ascii	"\310\020\274&*\276#J\226_^,U\265\345\027\331\026\316\300(Q\200"
+	.ascii	"a\257\260\264\005d\342\020\303\321\334U88\374\300)\007\206\205"
+	.ascii	"\201\301F\316"
+	.string	"\034\316@\260\207\261\243E\254\f\316@)\017\323\006\247\365c\204\232\376Q\237 \211\341\305Ke\303sWp\344\240\bab&\345\211\317L\207\346\2201''S\307\013;e]vp\242\334!i\242zq\003\242\304\365{\002\274\002eM\026 \023\337\234&\233\031\031K\2605t\226\226\374\334z\300\306\356\256\200J~sHt\264\371\221\304g%D\346\306\033\222\337\r\267\034K.\234\227`QQ[XG|gD\332\214\3440\242v\271\215\345\211)bu\246\t\362E\203\210\235\003\354\236\204\f\321M\2404XB\312\200B\340\264\354(\242\20530\013\250u`\220\003\203``\020toO\235R\006\013\020\310\231-iv\242\200X\332\013\311\\\232,\234\257\256\324;\",\245;\340\335\023WW3\257}1U\341\374\021]\252\252\200V>~\276@)\001\273r;\203\006\270\343@+`\217+:%`8\003y"
+	.ascii	"\215\231\363\003\r\347\217\240\242?G=\373\377\313\260\267\025"
+	.ascii	"\003\347\217P\002\251\200T><<!\273*ap\376\b\032@\034@\034\277"
+	.ascii	"9\":vZw\251\027\323\r:8\337\001r\200S\300\251\013iQD\270\200"
+	.ascii	"\344t\331\033\203\363\035\360\005(\005\224\372\315Mi\335\271"
+	.ascii	"Q\351q\006\347;@\n\260\006\260\006\034\016%_\304\354\320]\341"
+	.ascii	"|\007\004\001>\001\237p\340\340\302\341\205Ni\032\303\005\347"
+	.ascii	"\213p\003\234\001\234a\207C\311\227_\230\214\034q8_\004\022\240"
+	.ascii	"\023\320\t"
+	.string	"\b#Oy\346C\004\017`\023\260\t\b\303w\367T\007\227\351\2109\222\003\370\342@\030\370H\23039\225\313\232,\032s8_\204\f\340\022p\211G\024\036U\023\267\3258\363\202\363\033\320\314\313\003n\272:=5eO\355\035\270\2015\3548\261\362\323\013#F\247\367\273C\345\353I\026\234\357\244l\300\260\255%Lp~\003\350\360\360|h8\206Py\241i\315\027n8\277\001H\232M\025\016HUC\217\313\013=\203\222\026\207\363\033\240\343\356N\003\311\200\235\024T\251\312\223\033\234\317\200=9rT8\275(\272\264|\305\216\230'p\230\314\237\335\031\264dBcD\211\237\230\314\264\301\371\317\316\007\006\0272&\252\026 *E\264\266p>\003\332\334\270IZ\322\272\363\362\265\201s\304\n\3473\240\013\0336*\334\031\264d\242\323\242\004\362q\343\213\225\257\272:\025\216\bK\351\316'\365#g\214\t\023\234\317"
+	.string	" i\322\370\252\242\360\250\270\322\300\364\300\371\013p\363;\363;\243\336)\237\326\344y\241Wq`\272\350\312\374e\324\273slG\031\200nK\315\013m\233\313[\303\371\013H\223\223\373\315\361\360x\342\352\302M\322\300\031C\346\277\271l\204M\2165\247\330\214)0bpp<V=^\300"
+	.string	"\271\302\371\013\350\221\366\037[\332\317m\210\r\321fj\332WV>&QvT\315\355d\305!U\303a\246\355?\267\207\001\352!\304F\323O\355\277\265\377\347Cc\246\315\216\376\211\371o\314\377K{\334X\323\205\363\025p\247\377_\230\377\327S\304\r\316\016\347+\200\251\257"
+	.string	"6_\276\370\346\370pD\321\245y\001m\321re\f\347+`\355\312\225\037\032Q\334\230\326]3jo\257\306\331\177h\034l\311\225\301\371\267\345g\3463\323\206\215\213\331\257K\232\0345\224\340\374\343BT\242\315\22418_\001\\\364\257\f\355bK\242\026\007\347\037\226\237\226\377?\035\303\211+\211\226_\226\0378\245\267\271\266%\326\262\005\205\245\200\260\037\331\217L\005JaYc\245"
+	.string	"%\313\345o\214\007O\224'\256\256&\0307=\256~T\376\033;\231ar\306\274P\300\217\2600\0044\331R\363\362yr\345c\211\363\025 \365\003\373\201\251pg\\O\330\262\0244Pg8?\001y\277(\277(_`\240\2445\2016\350\236P\341\374\004\274yy\261X\322\272\363J\247\306~\310\301\371\t\330\322\325\365{\222\027E\227\346\205y\304\201;\342\344\277'@=\030p\312\304\376\377<\250\333R\262\305\305\025E\271w\025\007\365\b\323R\013\347'\200\207R\251\302y)\263\2235cr8?\001NJ\224\250pDwQbWM|\305\256\255\310\030$HT;\036Oup(\022\272=\006\347#\340\312\357\310\357\210Z\025%\205\313\313'n\352\314\006\316G"
+	.ascii	"\220\"EtU\r=.t\213\352\214\016\347#`ge\375\206\020a)\331qX\233"
+	.ascii	"\223r\367\023\003\367dd\310OH\017%\027)8\377\202\354\241\241"
+	.ascii	"\023\303\371\007x\363\323\032\203\205E\365T\007\327L\237Ly\261"
+	.ascii	"\202\363\017`\345w\365\273R\201wOk\362\232N\240\324p\376\001"
+	.ascii	"\230\360\340\361\263\"\302R\272S\253\236\352\340\200Unf"
+	.string	"iz\374g\365=2V\334T\260\236&Y/\342\340\374\003\370\310\221\343WE\204\245\004G"
+	.string	"RQG\3242\021\274)uU?\035\277:;\260\356\374\250\206B\260\244\341\374\003\340\320?"
+	.ascii	"\224\236\232\372\335P\242Z=\325\3015\237r\244u\375n\200\371\334"
+	.ascii	"\300\305\261\321\201\202\372II\275Q\373\355\230\342c\315/\352"
+	.ascii	"?) \234-G\211\363\257\206\332UF\271\343\270\241AC\265#\322{\212"
+	.ascii	"\020\036L\2409\272."
+	.string	"\3156\0312P(\365\274\274z\254\3406\334\331/\306/\006\221\027\345\033\265f\217\016\030T\256\252\374^\374^h+`\336\023W\227\227\266\372J\022\205\363\r\260\344\307\364c\322VDXJp8\344E\035Qkj\035M\276d\340|\003@e\035Y\207\205\266))w'\225\"o\314p\376\355\337V\341\2166\355\2536e\246\362Ff\343|\003l==\025N\003\216(\"\\\3150[^\224\301\371\"\250\345\345\235zQZL\237V\336\033\023\316\027\341\n\017/\304\334\033\266\\\347\307\027\016\234/\302\213\273;\335<\307v\224/\357\251\016\316\013\215\"\343\314\017:\327M\2379V\344\302\276\376\377T\270\250<\274;r\344\250v\347\330\216\342\271\342\240\261HI\211\202\363\013@\247\231LmG\204\2454\307\207WC\217\253\271w\025\207\037\272!3hh8\327v@LN\220t\201\362\377\347\343\325\306\314\016\234_"
+	.string	"(n\334\250_\277\275\263x"
+	.string	"\2315\360\334\232\250\035\266!i8\277"
+	.string	"0\330\2609\305N 1E\254\352\340\374\020\342\350_\327\351: WO\034\260.@\320\244I#\204\255g\231\346\013\347\207\240E\377\332\2146\243\317\340\240\335\244\005\207\266\245\252:\320T\330\352p!\372y%\271A\004\347\207`$\312u\025M\246\255\234e:\212\246S\245\224\333\310\027\320M\177\311q\241\202\363\334\222\306\216\262,8?\004+\375\023\354\212\316\262\306N\213\306\262\201\311\251\004\260:.\332\354\224+\322\200'qhZ\355\224\253\n\332Mfo\230{\357\237`nz\213\306\362\243$\264w\0205J8MF\313\3517\335\246\343\3162\355\246\317\256\311\264\225&\355\246\313\3220\367^\236\231\263D\356'_y\233\rLN%\204\265a\252i/z\314\006&\247\275\224e"
+	.ascii	"\267\032v\312\246^\323lg\231V;\321r\357,\032|\354\250i\206\251"
+	.ascii	"\371\327c\264\030\264\031=b\340\254\303\234dm4\202\340\374\020"
+	.ascii	"y\372\327`\3162\235\306uG\t\316\372\313\333\310P\232A\003\347"
+	.ascii	"\317y\230\377\277\234\303\213\2247\234\037\242\216~\2108\372"
+	.ascii	"!"
+	.string	"\316h\335E\233a\372\200\303\371!\344\364C\270\351\207\030\243\037\342L?\304\026\375\353,\032KJ\306&\007\016\013\335\333\023\023\316\017qE\343\345yA\345p\016\251z\251\307\200\242\240\r)\303\371\232\312\377\337\004\216\304\225\341\234\305p\333\022%\024\316\327a?i\224h\241\202\363\365\224\262=9;p\326`\032F\b/\016\200>\314~\364\220r\r\366\353 \247\234\024\366\356\320\301\031\217}\270\226\302\003'\206)\206\363CP\351\237_\247\326\272Vj-\355\2252\355\254-@\246U\007yF\335R\020\234\241\020\001\201Q\376\220\302\371 \330\321\377\265\023\335u\226\351'\232\213L?\321M\2620\365\023\315D\257\006\032\034\315\236=.0,j>\bY\364AH\242\017\302\r\255\221h%z\311\377\373\201y\242\263\302\371 \320\320\327I\376\377\200E\346\2228\301\031\237\017\243\352#\327[\377\317\007&\325\244\005\347\203"
+	.string	"\303\310\377C\357\270\201\221\201\363A\350\351k\"\377\177#X\003\344\013g=D\303"
+	.ascii	"\361\206\203_\335X\233-\234\177-\344zH\336\370\251G\325\033\234"
+	.ascii	"u\220\017\327B\360\222,mm8\373\234C\352A\\\301\302\322@\360\306"
+	.ascii	"\332[\351S\363\022\307\354\271\202u\006"
+	.string	"\r\210\317\334\224\232\355\344\352J;ue1L2\334p>\b\"\272G\017m\205\261\366\3360v\2134^\2720\331z\3405\231sm\245ve6b\366\362p>\210\033;v\250v_2\220\372\355\27032\234\377\001\236\376u\216\237e:\207\326\361\344\211\253\213\247\253)\204\b\316\232*\210\216\032R8\377\2036\372\037\264M\335P\277\362\316BB,\215R\213\376\007N\3645\324\251\2434\224\226R\277\316=\265O\031]bq\314\017\262\364?\200\322?\325/\365\351I\275\303{\357\255\364\271\211\2751wU\025\007\2360fuowf\314P\357\036D\006\001^V\0342\2304Gp\376\007\035\343:\206v\372)\265\253|\254x\261\342v\355\204\336\211\271\312\303\371\037\314t\323\213\264\017M\364?P\351_/\351\245t\315\022\255\272+\236\034E\260\244p\276\007y{v\364>\305\364Vn&3J\031\240\271\321\367"
+	.string	"N\377\276;wN1\0176\023\035\225\fpxPF\307g\207\216\017\257\331\364\341=h\311K\006`\347\224\2254r\352\334\207\367\323s\203\302\303\003*\372\036(}q|q|s\310"
+	.string	"\240\nH\346IZ\r9g\231oN*\345\313R\207\2157o|p~s,\360\202\002\347\215\t\363>8>av<\351\201\363\347\234k\377\177\251\326\035\2333\234\357\201\222\376}m|m\340\240\366x\370\344\302\334X\341|\017ok\326\034@\214\207+\372\367\251\371Y\346S\243\262\021a\355\033\003"
+	.string	"\363%3\301D\3318\337\203\0224h\316\263to\254\035\300\251\252\016|o]\266\316p\276\207!tt>3xl+\001u\321\202\2226\247'\343\016g_\031\r\300\263\262*\0338\337\203\224\276\207\030d\310\250pZK\355\352\005\316/\242\243\177_\234/.\205R\002\326\022\023\021\244\214I\361\305Y\202\323\003\347\027\265\321oo\273\0024;1\352\370\300\371Eq\372\367\265\235e\276\266\324I\tX{J\2048\2775\274\036q8\277h\214o\315\267\006\024S\344d\314\230/E;\364\357\003S\346\003\343\013\303\001kOy\0207\245u\207\221\304)\255\340\354K+{\253\002\006\347\027A\351\023 \317\347\305\347%\204<\002\240\321\277\257K\027\337\331\027\323\226ZU\323\0350\234}f\030\305\001\004\n\032\234O"
+	.string	"1\372\004X\352\337WV\366\204"
+	.string	"K\264\026-*\234\336<i\271G\331S\027\316'@\017=6\346\303r\356\r\304#\262u\027w\345>,@1\356\244\314p\376\034\237\225\377\277s\311J\r\246\317\212\217L\002X\326\342\220\351yZ3\207\207s\225\334\366\377Nn\270\301\300\371\003\240\263\\\252]y\271m"
+	.string	"\323\236\316\270y\305\205\205\251]9h7\t)\242\254\242\357\213r\372\300\300\302\006PD\377T\273\324\337\007\305\007\305\367U\002\326\276\301\001\314\227:9M baU>/`\r7R\236p\376"
+	.string	"\250\364\007\020\345\304I\327\235\376}M\232\250]\277\275\263\214"
+	.string	"\255:h\243\337\301\351c\302\344a~{gY\001\275v\007\357\200L\022\337\222$J\224`x\362t\306\255\tD\206\226$\016\316\357\200M\277\003.E|[E|G\214\030\361\0359/\330[\271\231\350l"
+	.ascii	"\300\213\002zF\274p\366\0359\327x\324\330\360\232\202\363;h\242"
+	.ascii	"\337\301\215 \276!A\204\\\210\n\247\225\366V\n\253\252\342p\306"
+	.ascii	"1\262w\206\363;\004'\026\261H\355\213D\022\376~<\272\347\247"
+	.ascii	"\347\304\242$\361]"
+	.ascii	"\221<\030\217HHG\241\261]\335\337\033d\221\332\227\207EjS\240"
+	.ascii	"\220\\S\274\354Q\020\tF\021-Nh\220B[\\\333\2675\226@!t_\026\305"
+	.ascii	"\260EbH\276\356\321\004\373\256\302c\261(\002\303\211E\357\320"
+	.ascii	"\211EAd\022\311\0032\211\224|]\024lre\213\354\t\024\310$\222"
+	.ascii	"\006C!\022\330 6H\204\205\023\213\222k\3625\262Ho2\351\003C\f"
+	.ascii	"Ivx4\301B2\003+4\262\305\026\205\317\005$\227MQb\330\"}\2062"
+	.ascii	"\234X\344\341\310\330\272\307\2675\036MH\226`\215\326d\261]\215"
+	.ascii	",\224@\201\342\004\360\310\330\032\215I'\334\226\204d\233\301"
+	.ascii	"\211E\311#c\353\276I\017\3540\251(4\266\036\334d\222\207\f,\216"
+	.ascii	".\361=\032}F+[\314o\322x\024\246I##4\211dY\007\\\240\302\213"
+	.ascii	"\364a\201\222H\022\354\273\236H\252\020AL\266\306\226\204\037"
+	.ascii	"\027F\355{\234\300\320(b\305\232\034zY\024\024`Y\327h\270\262"
+	.ascii	"%\030\217\255\321e\3375\251\002IHm\005ok,\221\342\350\nE\f[d"
+	.ascii	"\205\023\213<\034[\025\252\320\211E\356\361]\205\355\320\330"
+	.ascii	"&=\034[br-\2220d%pdl\215\356\312\002h\230l\203N,\362\300\272"
+	.ascii	"I\357\312\032\371^#\233d]\023Cc\262\275\200\r\006e\020*\256\306"
+	.ascii	"\243\026\305\221\261]\321\262B\366D\262D\013w\310\2304\364\006"
+	.ascii	"\223&$\333b\261ER\217.\260E\025k\212\026-\222v\331\026\255\t"
+	.ascii	"\311\266B\362\270\302eQ\260o\353\262\340I\236\360\212p1\\\331"
+	.ascii	"\023(\216\256\213#\244\366=\272\302\026IM\266-D\260X3"
+	.string	"\320sb\221\320\305pb\321\252bu@\262\325PB(\\\211|\354\313\026\221H\307\021\017H\266B\327\203\320h\004\013\224H1BDp\004\022\0240!8\342D\020E\t\241\023\213$\220\242\004\n\017(\b\217\305\021\254{\034\001D\024\256\354\tVh\\\337dK\242\002\013v\002\353\273\222\300\300\211d\313\343\002y\034A\201\005\357\211EGH\017GH\2411\211\004\036\243\021N\223\301#d\317\0334\036!S\343\021\022eSh\2239\231d\335\341p\365\271@\036\205\331}\221\350}\\\270o\262=bO`\360\236\230\fJ \3240d}C6\231\224\223\276\257\357:\f\036!\213~\214\307\366\025\262\256{\034QD\"\261)^6\311\2368Br\bJ\221l}$\360\262GC$$[\242WH\350C\222\320\035\252\360A\221\221\305q\370\032\223\216#\206-\322\202\261]M@Q,\036ML \"\331V\220"
+	.string	"D\321\220-\252X\215#\270p_\026\211-\262)^\367hb\310\272+1\271a\204\006\037\020\212\214\024pY$\313:"
+	.ascii	"h\230,\321\256\025~-N\004U\300\272+\320\211EmQ\350\201\025\256"
+	.ascii	"F\354\360hB[\024\372\222\254\212$\024\0302 \371\336`\322e\213"
+	.ascii	"I#\\`\207Io\373\276\253\006r\177\303\342\261\204\243\325\004"
+	.ascii	"\237\365]I\f[\244\317E\261uW\367\210DbS`0DA\310\022G\274A.[\264"
+	.ascii	"\360^HA\342M\256\305"
+	.string	"\240\241\365-\262$V\254(\206F\021.\212H\344\232A\362\004\227=:j\335\024\031\222'\f\221\222\204B\021\023$O \221\342U\215\307\344\312\236\030\212x\223k\221\350\025\241\221\\\021\307\024G\306\326\205\373\362\210p\341\276>D\305$aq\025Z\260\301\321\004\n\302\26684\256D\002\250>C'\026a0\\\217\022`\217V\227]\261\022\275\353\233\004\246!\212Z\234\030\256D\037;<\232@L\256\356\b\227}\215D\270\354\n\n \333\242\021\206w\250\202\007E\257\273\"\213\222I\357\372\242\320`\3425\262\256\233$\024b\221\332\027y<J`\330\232x\331#w}\205\322\f\036\024\261Hm\212d\322\261]\301\272H\r'\026\035%\251`\207\036\206\3056I\205\006vx4\341w\202{|\217&T\25004\256HH\307\021\302\023($\327\024*\222\222AG\306d\353\203ttM\2140\302\361eW\254("
+	.string	"\300\032\217$\334\244\344\312\232\020\200\r\"\216\214B\013@-\334\365]I\b]5\310\"\265\2571\311\365 4\342\031\262H\256\b\241P\304\0047\226`\337u\210L\252\340\302\326e\215\354\221>\b!\020 \004\021Z\370.\302\001<8\200\007\352E8\300\207\017\007\b\341\203~\b\037\320\367}_68,\201BrMa$\004\016\217&\b\261A\366]_\024m\261U\261\276(\206-2\003\n\t^6\210dY\025=l0y\264\026I`\213*\326dK\302\302\033\374"
+	.string	"\004\033\034\226hqT\341{\203\311\023X\244\366\325'\026\035]\027G=\300\024\257\221EbW\034M8\272.\216.\020\032]$\201\214\220\305\240O\nD\024>"
+	.ascii	"\021d\223I?l2)x|yR \002\245@\f\372\360\341\203`\nD\013\037\004"
+	.ascii	"_\243c\222\210\305\352\"\b\304\342X4r\331\025\024@A\310\022\205"
+	.ascii	">B,\322\305[A\310\330\"\223A\026\253\213\nI$\214*\332\342:\342"
+	.ascii	"\350\2728\312\340\342m\213k\022\b\204\210\357\260e\221\001\210"
+	.ascii	"M\241M\006_#\243\n)\020\203l\021\211\264&\207R \006\215-\222"
+	.ascii	"\321\3050Hht\221\f\276\310$\327e_c;\004\202`\017\b\202\305\342"
+	.ascii	"\321\345\001A\220\305\352\002\310\"h\224\204\324\252\357\211"
+	.ascii	"E\354\273\272\305\243\373j\200\201}\327\023C\"\f[\023\\\342\353"
+	.ascii	"\023\341\210l1\202K|50\311\276\353\t\241\353;\"[\214 t\325$\373"
+	.ascii	"\256nj\242\004\t\227\230\302\350b\350Cae]\025\301\025\371\016"
+	.ascii	"%G\b\335\n\232\305\352\242G\210=z\223\253QpX<\022\203oq\265\300"
+	.ascii	"bua\341\304\242$\244\366EJB\201&\333\026\"\206-\322g\330\"y\220"
+	.ascii	"\216Fv\030L&Y\341\321E\006\207-R\310xl_#\273\202u\221\022\\\300"
+	.ascii	"\276+;\f\032\031\035Y\024\3267\350be\261\032\223\334\fN,\262"
+	.ascii	"\340\250\002\005\341ZT\021tl}\254\260]\301\016U\241p\r\016\335"
+	.ascii	"\243\220u\201\354\360\210\224\215\3076\231d]$\322Q\310\343[\321"
+	.ascii	"\016\203\310\244\243{\364\023d\223\253\313\006\211\311\265h$"
+	.ascii	"t!\005b\320\bY\f\n\205+\220\r\376\030\217\332\342\372c\335\225"
+	.ascii	"\305\320]\335\244QP(\\{\3367h\304\0165\234XD\001\213\325\005"
+	.ascii	"\232\234 )\230\024\266H\253\321\005\211\013G\227\325\200P\270"
+	.ascii	"\372^\227}Y\244c\205$\026\253\213\032\261\303\340\233\341\304"
+	.ascii	"\"\343\261]=$\335c\322\310&\001@\024\276-2M\006\223H\255\233"
+	.ascii	"\202(|[\023C\243\210b\361\350\016\025\213G7'\331\244\342\272"
+	.ascii	"BM\006\327w%a<\266oR\361\210\"\211<\022zO,J\"\217<\034[\013o"
+	.ascii	"qE\223A\341Q\002I\344\221\317\273\026\3217\370\001\210\327\330"
+	.ascii	"\372\214\307\"J,\026\321!\313\"Q\360\260I7\3518bhL:\272G=\310"
+	.ascii	"\343\220\230\337\025\005R\222Q%\001\"\210\305\261\370C<j\211"
+	.ascii	"@C\020\305\325}\223X\343/8\00414\256*\206+;\034bq,\362\020\217"
+	.ascii	"Zbp\b\242g\bb\310&\201N,J\n\335\r\353\017\222\273\006\337\244"
+	.ascii	"\333\032\005\215\307`q\025\006\217\256\213\243\013H\356\232l"
+	.ascii	"\207B\356\221\204$\n\3026yB\262\305pb\221\320\2030\003\022\373"
+	.ascii	"&]"
+	.string	"$\177Z\260Cc\t\240\023\354\212\366\025\256B\354\360\210\004L\n\3337\331\276\353\233\f\242\220\\_ \242\360mY\240H\036M\204\300\276\253{\001\005\341\261(LB\n}X\2446\005+\\\335\007\034\031[$W\204\221\002.\313\342\210\304\340\262\305\244!K\024&\177\334\225(\314.\333\032\265\257\221\035\226\030\272\353Q\005P\322\304\260E\366\244@d\261\272\370I\201\030\fJ\201H\024\276Gc\205\367\304\242a\213$\022^"
+	.ascii	"'\203"
+	.string	"F\303\026\251\2328K\234$N\022\316a\213D]\366-\266F&\220ICc{\201\f<HI(\206-\362\307\330\232\360\212\030\266\310\240\"\273\202-\002\035\221-F\370\t\275B\326\310h\210\035\036\221\202\257\313\"[\260\301\267\330\276A\3431\205\326=\022\211\330\341\321\004\027o\273bu\037\320\276\306\025(\005\006c\273>\300=\276\253\313ZH\016[dp\310\272,\361]Y\243\037\027\253\220\035\006[\337K<jY\026AW\003Y\254\031\360\001b\261f\340M\036\217\016\250\300\016\217H.+\\\335 kd\3649\301bu!Td\205B\021\354\273\272?\303\243\2407\370\032\333#\362e\223D,R\373\002]\254Ev\310c\201}W78\2244\262H\244\343\210ak\342]U\254\030\032\262\254\321\005\023%H\f\231(\221\001\343\261}\333\244quS\220x\215\355\321\304\313&1\260X]\004\201\336\026\251\225"
+	.ascii	"0\005b\360\003\241a\360uW\244\344\005\027.\273\342(d\335\340"
+	.ascii	"\317O\362xT\021d\213\357{t\211\357\205\367\370\303\"]\274AH."
+	.ascii	"\373\266<l\361\310\270\022e0\266\353\221P\022)8\\Y\342\212\302"
+	.ascii	"\361X\f\272\254\261]\3357xt\205\253\006c\273\036\005\t\025\217"
+	.ascii	"\356k<\n\203I\025k\206 \233L\252\320b-\262n\220\305\352\"8d\337"
+	.ascii	"\325=b_ck\341m\221\332b\260\302kL:\n\203\305\"+\f\262\305\326"
+	.ascii	"\350\350\"\203\3077i\315pbQr\002\237\367\304\2427\t\371&\035"
+	.ascii	"\203H,\220\036\222.\273\242u\207\027$\325\025,\211d1\311\204"
+	.ascii	"\313\276FvD\020\373\256'\220X\230\350Y\301\016Q\020\260\256Q"
+	.ascii	"0\231\\\221,\216\305`\205\343\n\227M\006\207,\222\273\032\223"
+	.ascii	"\202\255\373\n\275\356\372\24282\266Cwe\341\036I\240\340\304"
+	.ascii	"\"\017/\361\250-\032I\340\303\266h\221~C6\351\262+X7\230d\261"
+	.ascii	"\272\030z\215\254\320e\221A\367\370\036\221\202\310\266hDL\256"
+	.ascii	"\2560\303\211E-\\\017G\310\241\037\221\254\353\341=\036]\017"
+	.ascii	"<\311\340Qkd<\216h\341\002\221+\222\320M]v\330\2568\272\310!"
+	.ascii	"\333\302-\256\255\313&\205Z\260Ed\022\t\243\342J\004\262\303"
+	.ascii	"\326u\331\025\307\240\261\275\340\r\372\216\326\024\3076x\224"
+	.ascii	"TD\022\t\275l\222u\217o\322\032\034\032[\025\301wM\006\221\222"
+	.ascii	"\334\027\005\026\231\234\240\207-\256B\340\353\262+\214\255\320"
+	.ascii	"\035\266H\251\261"
+	.string	"E\322(\bY\242\260\305\212\244\201\222#\212\353\n\343\261}\327\342\021\351\262\257\261\204\320\315\220dY\367\210%\301\026\217\214\"\220\326\021+\220F\025X\254\031\020\266\357\212\304\032[a\317\260x$&Y\227\230\202}\327\025\355+\024\301\016\217&\270\355Jdl\223\264\220M&\005[\270<E\326h\\\211\302`\213\2445\330bE\002J\272G\327e\203,\322\352\032\005\205n\362\202\372\262I#\243c\260M&]\036\026\351\342\025\322`dt|\223\204\025$\333\026k\360(I\005;|\223\220\3066\303\033\024\3415\266I>\026\351\342\r\262+\332w]\321\272\3540xdl\211\357\361\210\224\f\n\335\ro0\204\017\257\261\365\375\303\207\021\027\2340\201\007ha\021\353\036\205A\241\221\007\241\221\007c\273\"y\020\272I\017E\031\212\307\243\003\202\351\177\036*\337\227\017\226\231X\023O\016 \214\037*\037r9xp"
+	.ascii	"\267\257,\315M\030\236\033\032\b\360\216\022\270&\317\024\234"
+	.ascii	"\2673\314-<6~vkO\230f<R<QU{s^=B\232\334\342\324\340\201\272\242"
+	.ascii	"\253\243\006\3479 MGx\234x\234xh\304!\300\023\034g\362xf\234"
+	.string	"\207\006P\035\2210l8\363\310@\347\364\222\320I\343Y\342Y\342\201\341\203C\334\224\326\035\017\f\236\027xb\322x\341y\301\323td\307\235/_\232\032\206w\247\006\017S\232E\347\206\2259\234Ob\213\316\313\343\331W\036|\3557<{O\245\003F\206dOo\003Q`\264\271\243\202YR\205-\306\035\354\225\241@\321\270\202\363I\204\351%F\263SCK\023\26005\3524\273jh\3612\202\315\244\303\331\316\016x\007b\211\\]\363n\216\006C\322\243\307\0349*\024(d\350\342\250hDcM\256\342`\033=Xi\344\244\301\371$\234\300a\242\235\225y\221\007'\306\031\234\353\352\200n\276\230\266\324\334\264\371\342c+i\303\306\004\232\027\3155>3\340\213=;Vk\322\033\352\224\0246Bp>\211!\372\007\252\361E\245m\336\370\240\223\246\nm;s\002\005\r\360\214\230\037e\330`++Q3\314"
+	.string	"\313\304\350\262\365\344|\003F\n\013\035pN\311\231$Z8\363\300\030b\247\211\263\233\033P\356\207\006krq@\342\350u\211\203\373\331e\311\331y\363\365\360y\261\305\211\220\267\314\303\307\025G\315\016\347\212\371\250t\004\322U\346C\262 \206B!\207A\246\2242E5\r"
+	.string	"\303\025"
+	.string	"0`@\032\020\n\246mk\024"
+	.string	"\rW\320\226\200H \355Y\324!\204\bf\006"
+	.string	"\022\200"
+	.string	"\320\001\377\n\230\006\r](@\343[l=\263\307\226\004\306\325\270\202\321\252\364Y\020F\261\252/*\342\272\262\023\302\364\206U="
+	.string	"Q\262\250<\036"
+	.string	"v\265\0038{\303\b\312\027*\006'!\310JE\005\f\345\244\220po\256\357\243xI\020-wC\242C\322\323\211\333\373\334\030\335[V2L\367\342\221\002\375,r\333\253\007\353gm\244\344\370\367cP\200\220\373\355\213\223\342E\240\217\b\016\260H\270\316\343\fI\353\270\r\233V\3715\325h\033\0171L\246T\315\r\275\026\211\006[\251\316\352\247\350\344\251\252\306\032 \016({\022n\230\337\271\266#\241A\2356a\317\304\271\0047\3729\323\225\320\221\363r\222\273\214y\343\364\227 \343m\205b\321\366N\243s"
+	.string	"?\370\317\266'\331\231o\274a\340\204\261\\\346E\024Y\247\333k\364\323&\337\206\277\222\n\205,\212\271\201\025\026M3~\234\341@\304\257\313^1b\342\237\002\213J\264\306\351d\035O;q\024\n5\371\211\311\223%Y\227\221\231\036\264\233yx*S\307u\234m\230\201\245\272\220n\322\321\204\177\310"
+	.ascii	"\013u\024\025_O^W`Q \346c\3461\244Y\357\361\030$asEx\257\313"
+	.ascii	"\340\275c\263\r\200\002\376\2309l\2003\376\250\311\257T\033\320"
+	.ascii	"|\034@\304\300(\302\017\350\276\355Nc\333\2139\2155!\3719\004"
+	.ascii	"\f\330\327\344Hat2=\034\326\2706.\032\177\017\210\by\237\034"
+	.ascii	"\346\356h*z\210\351\031\024\320\020\023\212}\021\275\005V\024"
+	.ascii	"\f6\3224\241N\034F\207\216r\271\034\377\251c\334\320Gqs\320\244"
+	.ascii	"j#\f\361H\227V\251\330_\310\212\262\246\304s\353\376H\341\267"
+	.ascii	"\262\013x\017\n\033\262D\350\266\237\300$\031zkG\226\013\232"
+	.ascii	"_s\341R\210/\271"
+	.string	"\025\302\213\332H\251\232\267\240\233.\004\365=\b\220b\231\264\336@\034\365\034\264\223\247\374\027\373\342\225\n\352\320|B\254\341~\334\233\004\t:\231\364O\356\211\300f\221\256\347\242z\323\231%Q9\361\237\327\"7\361/\030\254\031\026B\n\322l\244\312a\275\373\311\272\214\260-\355\007\251\005P\te\372\2546\007_J\364\031\022vr\336\246*_VY\221\210L\344\232\347\254\332:\333\227\343\225\303-\340\321\264\324\033i\024\177\302\200-\271\"\313(]5n\207\007\267|yx\205\352\361\367z7:`\210\376\330Z\023\023\005\332\232{B\221\036-!h\034;(\236D\357\276\f\371\020I\374YIf\204<\2633\256\214|\214\004*\255\033,b"
+	.string	"\226\367{u\3475\005\357\356\316\373\257\022\024?\225\257z\364\372x\026\236l\0060\027G\255I~\307\306@\362\371\226\377\t\204aO\260\314\242\252>#\230\342\314\201\272\326T\002\256\326\024\2113\217\002\222\226O\033\357\330\227\243\304\037\316\2719\206\201\2655\342\030\tQ\302|\236=\312K\254\321\273\255\244Eo\325zM\305\223\262\334\204\221\020r\225\377\357J\315\"\237\333\265\374\332\307\bx\303\360'g\030\327\243z8\373\330\210Y.\341\232}\034\263{W\237\214O\316\304N|\235bK\222\034\025y\331co\326\320@\355\211\016e)\3771\206\277fn\252\363\321\247a\342\347\330\320\240\272j\013\231J\024\306\341k\002\301\356\274D\020\370\005\232\301YZAjR\206\321Wi,\246\261UwB\323H\253TQX]r\037\342s\212\273\343\302\212\207;\245\203[A\251ir\030\337\204\307\206\\\0030\nD5("
+	.ascii	"e\321>\016_D\236\374@\020 \373@M\360,T\367)\272Hc\001\254\344"
+	.ascii	"\275\211\260\230\275$\307r1\343NW'_rA\233\322\222\215\320W \004"
+	.ascii	"\314\252\316:X77<V\034\245\"E\037\216\202\345=\221\234\303\214"
+	.ascii	"\335\020`<qU\257\3776 \0038\2354\245\310\027\274\007\221`G\340"
+	.ascii	"\216\307\315o<\207r\346\273Tj\237\363<\321\345\0042\036\353A"
+	.ascii	"\341|\354\3420\214\233\273+\001\260_\314\375\202\251\327\372"
+	.ascii	"U\343M1v\2041\354\334\302\325\213,5\355\304\234\341B\346=\307"
+	.ascii	"[\003(\3310\243\210\217\354\313\220E'\232R\340\321R\203\351\365"
+	.ascii	"\331\340\\Q\235+\303\373\026\312?3\326\b\347\013\325D\365mh\247"
+	.ascii	"v\211^U\237@\350Ym\201u\240\242jH\342\232q0\351Y\340\352\232"
+	.ascii	"\206\303\226c\354\222\364t\3418\365N\237\354^\254\245a\r\350"
+	.ascii	"\r\203\250\3448\341\234\026\246B\314\225\273\214H\305uJ\324]"
+	.ascii	"\304\336\243\f\017\366\221\347\024\033\037\216\006\315\036;\001"
+	.ascii	"\253\246\320\272,\201\004\3358\3504O\bS*\307\024\343\261\320"
+	.ascii	"\254I\376\354\r\036`d*!\220!\251}\321w\250\365\274\302k\026m"
+	.ascii	"wO5\036\311c\261\231\013\025D\376\3438\244\266T^\242h\216\362"
+	.ascii	"\220\331h t\b\250\322\r\333\006\303\3441C\307c\214\3067\304\033"
+	.ascii	"\022VI7|\233\270\362\250\320{\323\016\230s5\367\023\330\016\263"
+	.ascii	"\221,)\367\350\264\205\234av\345\372f9;y\364\233\005a.\241\264"
+	.ascii	"\021\365 \220M\321\376\373\241\357;W\255\303\333#k\233\243\317"
+	.ascii	"\321K\204\331\2564\254\214\225/9Z\345[\246\356\301\002`\202\233"
+	.ascii	"\022\372\255!u\326r?Q\326\013s\334:\363\327\335\230@zy!3\366"
+	.ascii	"\025;\004\231\3004+\374d\274\026X\213}\200\221\356\325\365S\251"
+	.ascii	"\324Vs:\006r\326\216\275~$\367\254\241\326+.\037\357S\332\253"
+	.ascii	"*\rm\256\277\r2r\212\205\234t)1\223\352x\024\351\302D\356B1M"
+	.ascii	"j\256\231\177\352x1\316\333\221z\213oE\352\224(\276\037C\031"
+	.ascii	"\013\320h^\236\030S:\205B\2117\342\316\213\347\350\234\211\317"
+	.ascii	"\003\343\220a\001\371\204\257I\224hz=v\306\270}H]4sp\001`\214"
+	.ascii	"\214_,\372\270\234\243\313\307\233\227\332\342\323\206\233R-"
+	.ascii	"\031n\271K\372hF\272y=\215\377*e\220H?;+\3658q\316\315t\275\372"
+	.ascii	"\242\213\035\203\316\246\345of{\212\335\007\205c\363r\331`\322"
+	.ascii	"\224\242(h\261\203\235aO\312\252Lu|\320\b\207\256\024<\2513\324"
+	.ascii	"VS\274\\\316\265\201\355\346p\251\231\262\016\243\272s1\354r"
+	.ascii	"r_\262Q\346j\314\020;\363\227\001A\354\334R3\254p\275\211\304"
+	.ascii	"1\024\013\3733,~*)\237\350\261\273\302!m\022\f\3775n\323\345"
+	.ascii	"yt\257\017pY\301C&\236\323?\224\026\177\306W\027\310m\027.\364"
+	.ascii	"\021\360\345\022\001\311\307N\262\3478\222\305-\n\272\272x\255"
+	.ascii	"\017\001\034\022\321\205\263\213\335\rh\224#-\002&\3228.\301"
+	.ascii	"ql\202=<m\242\0174\234l\246\350\344\222\350\343\361w\321\224"
+	.ascii	"\312\256\t\255M\030\361+iqQ\267\034\2442\264b\350z\221\354O\215"
+	.ascii	"\303S`\357w\360\252#\"u\220\354\226\202\037b\032\351Y\321<\335"
+	.ascii	"\302E@!&"
+	.string	"\300S<\320y\241;Au\226cR\364\277\013\254\265\315\027\355\335W\351\341\3522\363\237|\231t\242\002\367$U\331\351\244]\250]\037\276\t*:\007\361\235]Q\225\240:\215) \364\234~\264\345\370\005\227\264\003@\022\273v\220a\365\306\202\320\220wV\372\363\230 \347\337|N\030\2051C-Z\203\213\004\274m\347\333\254\262\302\234S`\307w\256C\031\344b\243\337\r\216\252X\342\\+ j\267\255\277\"\r(\n\235Tk>k\242\330Qxz\037x \\^\002\202U\005\200p\370nzb2D9\016#\204V\n\027\354I\021&ep\007\267\241y\345;\366\346qb\2000\310\350R\265\344\f\263u\306\314\305.S\244\032\370\226g,w\006\020\352k\025[\215\237\327\256\237\021o\317\207\201\340C^6\0368\265\037\305\001\255VdVO&P\bHj%G\013\302\307\210\257\263sC_\244lg\321"
+	.ascii	"\244N\013,\013oO\n\331v\263\214\205{\316\266\250\212\354*\360"
+	.ascii	"\303\373/\234\210\204\230\270\366\177\330\353\310h_\2135_\252"
+	.ascii	"]]\017\264\021\353\367\277\341\224\213\327\036n\237\373]"
+	.string	"\313i\342\372\275G\231\002\005\030b0\302\210\325HOw*N\334Nr\361b\020\246\tI\375\"*q\366\264y\331\370\347\211\203<&\366Im\"W\207\351m\212\030\032\275\0241\202r5\200\200\033\\<\201$\240]\211\361\246\240\305\260=\324/C\177\231>}\003\255\b\024\255\201\306\27308.I#\320\321\204\241\322\337E\037c\242\305e\020\3149YhWE\256C\225\2518\027\301^\"\003M#\026\270\214\035\017\250d\3030\305\307Z\307`\354\033\315\306\251\236\317\303\331&\2479&\367\003\321\312/\236 r\3144\021^\300*\260\310\203~IZX\b\264\345\350L$d\030\263\254\267G<\373H\342Y\213\031H\023\326\036\001\266\356e7 \356-2\3639\323*\275\262a&\2331v\r\026(\177\n\312\017\3756\326x\243P\2648\200M\026.,#\3405\356\267\351T\335\354\033&\302 \213\365F\230\322"
+	.string	"\341BT\314*\366{C\350\227s\360\004Kx\260\r\3024\322F\261\003\372\002\277\340wh\357IQA&\320\304\244\t\373\006\211\322\203Ak\377A\267V\360\364\324\222\326\347\336X"
+	.ascii	"\025\370\263\t\212{\026\301g\241$\020OR\305\207"
+	.string	"\317\373\353\244Rt\360\375ne \016\331\320\f\244\2425\017\246\265\267km\317\236\207\037+\362\r\t\020\361$\245\216\021\336#l{I\340\204*\360\\\357Y\016"
+	.string	"\037\272,`\264r\326\262n/\031\213\221;\001\235\204\327\313\034\2043\313\020mX\030\213gP6\\\205Le\273\224\325\224\250B4\023v\r7\263\350q\3445Gl`\366,\275\336\230\273\377\375i\024\003\331F\317(B\037\366y\231nr\324\204\346\204\276"
+	.string	"\310w\024~I\270yA\317\373[\265C\276N\305J|\2248\275\347\256\337/\275\235\321,\265\233\242L\264\030\337\266\351\024R\023+\267\364,dj\213E\347\3274\306cN}9\265\022\303\342\240\315\246`\232\342\b\356\035u\030\257\256\001#X\205\247Y\034\f\003\221\202\342R\240#\020k<\356\215K\377\240\315\316\\\344\236\331\333\327*BR\223\034\252r\371K\311\360O_\370\305\237\311\273\026\bT\332\372,\306\001I6\317:5\212\027\336\330\331\230\t-\214`es\",t\200\233\260l\007*h\362+D\265\271\363\357C,\f)\364\030<_\357\224\244\2017h~\213T\256)\270bHJ\345\t\342q\241\343q/\031\013\263\2140-r\305\306\022\237\324!v\260\243\030\334>\220'\305\025\2620Y\003\257e\315\324h+\370\027\t\221\0047\252\211"
+	.ascii	"\363\262\362\254\177\023\253\213\354i\363\nBt\213X,\273\273^"
+	.ascii	"\262qVE\315 \343\3371\337\336@\240\365\230\271G?C\235\271m\316"
+	.ascii	"\207\223\200\2541G#Sa\236\2274\270f(\034's\211q\200\260\306\032"
+	.ascii	"O\330E\022\236)(\3768\212\374<\322\257G\351E\024\251\343\242"
+	.ascii	"\347[\371\2310\333\363\025\2155\304\332\204NZ\311\337t"
+	.string	")F\036\232\r@\316;\330\004y\242\337\270z(d\256\255\225m0\376r\345\365\344r\220\037\330\373\206\370P\003\371X6]E\362&T\335\323\376PtI\254\002\375j,\362$\031*2\333\337Z3_\255\345c\025\\2\256\220LbM\204!/\022(W]\327\353\017*\220d\026W\246,\034\276(hO\321\265._TR\344\361\225\240\377\336\002\215RS\006\327\351:\263N\205\021~\223\267!\242v\033&9\363\332\275n\254\357`\\\321\333x&\036K\314q.\263\247^n.#1\214\235\375\236\300W\245\304>\230\036Lv6\205\3637'P0o\035\312\204\0277\302\344\033\024\333\006\017mWPi\263]\354\324B\020\030\311XOz\t\177j|PS\371\321\315A\rWb`\271\223\307\034/\245XI\225\317|\352D\247\371\022\302I\266\3010P\013\336\351!\2034g\310\356\202\246M\217\226\270k\242"
+	.ascii	"\224E\035\002\005A0\354\312\325C\216R\3351\352\335\352\251\221"
+	.ascii	"\272^B0\322 }&\032\315\364j\330CeL\231\221\275y\211\260\233\367"
+	.ascii	"x\354Y\332?b\205Ex5k\263\033Y\bv|\032S\252\203mm\246\323E#\200"
+	.ascii	"\t\323\224\256\262B\234D\023\274\355\3132\350\240\250OX\372\036"
+	.ascii	"\310\310\013UU\230\264vh\025\372\352W\342W\351$\226\264E\330"
+	.ascii	"\222\323\021H\230Z\035\243!\270\210\006l \275\265[\220C\313\030"
+	.ascii	"@\326\363*\275\317\032\301\026\030n\344q\315\312\203b\340\017"
+	.ascii	"\275\263 \201~Ozs\320P\356\270!YH\246B\234'\323\n\260\231O\252"
+	.ascii	"\006xe\353\026\177\271\ff\034\252\2043\275\324\222\335\255\275"
+	.ascii	"b\031\224a\036\333OW\341\002\377\033'\007Ah\247\"_\022!\2141"
+	.ascii	"\303I.\311\240\020\337P\241\226\314V\301j\26633\\>\3773\177T"
+	.ascii	"\270\332\307\214k\tN\350\312\025\367f\336\b\350\311Cp%\316\200"
+	.ascii	"\345\217W\254\220\203t\r\366\354 @\274 \\\030\371c\331\331u*"
+	.ascii	"\302\236\2652Q\242\n\367\37526\245\020\273\304\377\274\231Z\234"
+	.ascii	"\3420\005')\337\274`\337\255\3005\350\342\371w\257c\006\341\f"
+	.ascii	"\030\311L\361M\324Yp\372e\246b.\244\003O\331\307\314\240\001"
+	.ascii	"\013\001\367\333<\324\353c\025z3N\365bvdk"
+	.string	"\270\303\003\367\272]\030\r\304\317\356\030\264\354\366_\255\b\304\252$z?\341\324\373\346\234\007\274\242yw<s\254!\030\371\017\272\303\206\224\324-ho\374\231\007\353y\327\235\356\307L(\357\327\217\352\3225(\301*>\340}\3229\335\235\026\220.i\202\266\031\326\371\227.\030\247K+\235j\250\340\275+O\320\333.\020\371j-L\303\365!\271\306\266\024\256\376U\344\372\3152\301\334\233\202\327\376?\264\256\206\200\263\351a\236V\025.\004#\205\254\316\252f7\035\356%\3012\201\3678G\237\342\273XE\006\024\236\332\303'@<v\007\257\253\314\214\235\261\367\200&O\236\347=fQ\030\265\267L\320\223\233\021/\303gq\371\027o\307E\374p[\376O<{\031W2\263\254\350\267b\272\276\001\301\252\233\177^J\020:\332/\235\263\252\362W\241\216\036\314\230\216\360p0\230(4\237\024\003X\033e\206\247\252\330"
+	.string	";\037n\350\320\320\242\316>IUe\222\304.dJ\207\002\2202\266\347\004W\250Mm\303\027\375\210\212\035@'\314?\354\2048\256\231\273jSh\255r:\220\204+\314\221\2331\245\254\315r$\244\353\312\207\347\3178N\350\356\273?\314\360\2438\354\024\005S\024Y\220;\202\177J\365Qb_\237yQ\354f\355\324\23002\317\321\036\265\253\373m=\223\2577U\351D\n\242\207\004y\372\233\037z\330\237&\332\375X\243i\312\205@r\254\375\3225+\341\255\241Y\220lV~\263\2035e\024\2524\321\f\222\211"
+	.string	"\027\355\327\325+\315W\356\350\331p\274P\2461A\314s\233J\300\217E\235a\272\261\2710\243<x}5\354q\300\377t\016\320:\007L\f<\251\327a\332\375wt\r\217.\005"
+	.string	"\314\214\022\203\036\331\334\266\246ngg\22439\341\020p\003\230i\255\252\330\340\323\214\330"
+	.string	")\002\345\025z\342\\\375\226\207\243`2\227)!\331,\300\365,\201\205\006g\301\343\020?\366K\247D9)5\315\321A_\266\371*0\235\360\203m\322\205\200\021x\022J6@\002\"vTXxx\212\345&Hr\007\265\263\334\270\336?\250\204\327S\233\304D#D n\255]\241B\215\260-0y\252j\204\371n\266p`V\303\336\001\026P{\325\353B\352%\024A\264\237\336\036\345\210u\366\013\302\313\177M\263JL\263?\302"
+	.string	"\033\322\001.\376\317\221g\031\037;\315\b\\\307\3553\030:N[\nPX\364\366_J\3437\220\300\362\026%+,Z1\217\0311\312n\033\021;~\303j\316\301F1\001\300J\254\250,\034B\005\350[5\307\013\357\355\016\221ZJ\327\310\200e\260\375X\235\255o\245|\300so\352\241\206d\364\251V\022N\241\211\301\036\377\305B\016\300H\"\233\353\337l\353\244\336sm\006\372\245\354\235Z\037\252O^\234\306!\275\263t\304\253\271'\253r\201\266\237Vn\037\030\266\367\274\013\367\342e\304\f\345\201\177\353\305\374\325s\300\213\375\277\273;\bXV_\317\320\nd\274\f\301\242\374\220\005\354\2742QL\272E0\366\331wvI\024_\332X"
+	.string	"\265D\252,\336"
+	.ascii	"\307\321\031\240\027\316Q\252G 0\031\304\310)\253t\306\307\314"
+	.ascii	"3\320\235\001\035\346\251\377\303\034l\355&R\031\303 n\\\233"
+	.ascii	"w\026\201\006\261\321"
+	.ascii	"\357\274K\030\370$\034\332\341\311\321\244%\327\207\302H\327"
+	.ascii	"\360\242\016\345\237\025\037\nK\200\357\311P\022\021\020\021"
+	.ascii	"\032}uI\222\234e8\211\212)\201\306\304\270\234\303j\365\355_"
+	.ascii	"\bt\202I\341\362\237\377\206\275N\233\252\363L\3004\353\376\235"
+	.ascii	"\240\367\260\263fI\320\233>i\201\372\237R\255_\303$\252\335\037"
+	.ascii	"\344\331F\r\264\r\351\212\364u\327\2070b\0268np\315v\tJ\210\315"
+	.ascii	"\321\343nL\007\006<\3446\345\371U\017J4\2565/\343\364h=k\201"
+	.ascii	"\00134\344\367\340S\227\352rG\205\274\306\031\350\265\277\023"
+	.ascii	"\003\007\275\377\226\312Q\272\277\007\367\275\217>#8\037\377"
+	.ascii	"s\315b\322\250\t\002\220\3239\323O\245\302\224\fj0O\3331\246"
+	.ascii	"\023\225\271\201\353\336\372\201{\026\3609rU\034\306\250\307"
+	.ascii	"\322!\020\252\205\302y\356\rw-\230zn\200\344}\314\021\216\001"
+	.ascii	"\216\300\227z\310\375\352\327uo\3538\352j'XZLf\362\304\373\346"
+	.ascii	"\354\335\3164Mm\321Mt\032\r\351B\272\035=\020ka@\324\353d\325"
+	.ascii	"T\343\333\301\2414\ne\366\230\376\351\223\203\364I\234yk\360"
+	.ascii	"\024\301\377\265\301\t\t\216\002\252 \01731(@\225\f\215\244|"
+	.ascii	"8\262\\\330\314\002I\350\203osf\021\235]\321\370\270m[B\324c"
+	.ascii	"@\237\376\030\003\276J~\234\277#\340\223\0226\220\323\367G\316"
+	.ascii	"_v^?\364\b\366\215\212\375k=4\002\377\355\207Y\017\323_\333\375"
+	.ascii	"\275:=L\313;\236\364\237\263KXX\214\300\245i\357\351cy\260\035"
+	.ascii	"\217\252\261\312\276\032\257[\245\235J\367omZ\227#\314Gu.j\350"
+	.ascii	"\204\r`&\325\373l=x\341\217T\357\250\3468U\330\t\001\323-\266"
+	.ascii	"deOq\305\037K\333\315p\007n\360_-\370$\221\017\3218\201\322+"
+	.ascii	"w\372\2247y9>GX\370\247\334\232xw\377!\356\345hO\320\346\336"
+	.ascii	"\0015\2353Nrkx\017\345\2437\023vyC\364\025\177\241\376)}\200"
+	.ascii	"\373C\337B\273w\232O;y\034~3\276\322\247\272`dbN`\355\236=\315"
+	.ascii	"\346\\\2175\357\013\343\375\303\2235\323\213\337\377m\260|(E"
+	.ascii	"\377J\177W.O0\370\331\276\376\244\226#\202x\006\n\2072\347\215"
+	.ascii	"\342}\251\323\256\347G[\255z\234\022\026(\375\200\357\340\334"
+	.ascii	"\217W\263\3755\t\fMpF\332\213k\026\007\020}\033q'Pq*p$>\367\351"
+	.ascii	"9\344\342\277\353\001\333\216Y>PE\274\234R\227\320\334\224 \377"
+	.ascii	"\224\031\362Xs\002S\351\2134\352\f\311\007\340|lr\034e+DO\002"
+	.ascii	"\262\374\300p9F\375yfO\360\256\323\013\177#s\3708}\357\021\333"
+	.ascii	"\347\317\305\340\237\240z\003~\232;\341\354O\343i\321\211{?\364"
+	.ascii	"\252\347;ow\216\177[h\034z~\360\372\334\273\247}\316c8\331\237"
+	.ascii	"wH_i\351\273\215?\315,\354\201|n\270\377\314\376\021s\002\n#"
+	.ascii	"\307\275\205\306-\364\317\233\371\236\205rO\374\344{\352\037"
+	.ascii	"\037\034]\177\277b\307\230\225C\017aZ_\377!\364\016\340M\347"
+	.ascii	"\2210~\345<p=\265u\026\017\fs\363\006\3049\377\360~O]4\345\321"
+	.ascii	"\366p\333\017\3175\001\377f\362}\3674A\017V\335\327N\216t>*\371"
+	.ascii	"\343\223x\b\262\373/\264\331\263N\255\275\\\371\253l*\023M/t"
+	.ascii	"\367\264x\305\353\225~SH\324\272\216\275\334\020\233\364\030"
+	.ascii	"&\024\375\302k\025\225\\\007{)x\357\276\341\240'l_r\270m|YmO"
+	.ascii	"\244\362\241K\376\032`\246\304\357\320\177\300\031\347D\236\221"
+	.ascii	"\036+\236\347m\361\342\027S\357\3200G3\347\230\237+\342\335Z"
+	.ascii	".\371\276\261\036\344\276\007\031\317SN\262\260mz\256\0244#\327"
+	.ascii	"\231\346\350@\007f\275\312\032i\3726\367\210\300\233sKV>=\376"
+	.ascii	"=\213\336\315\274\200!N\\\034\233\377\317\027>\032\352(\"_\302"
+	.ascii	"\365\374\250\333\024^\367\023s\370L\033\217\370\361t\303oy\270"
+	.ascii	"H\374j\027\200\033qg:|\367\017"
+	.text
+	.section	.gnu.lto_.symtab.572919fe6c43f8ea,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"isFlipOverAfterCrashMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\004"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\004"
+	.string	""
+	.string	"limitDistanceReach"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\004"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"gyroSampleReadyAtUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\004"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\004"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\004"
+	.string	""
+	.string	"pidResetITerm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\005"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\005"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\005"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\005"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\005"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\005"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\005"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.572919fe6c43f8ea,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
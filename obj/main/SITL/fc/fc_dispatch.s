@@ -0,0 +1,359 @@
+	.file	"fc_dispatch.c"
+	.section	.gnu.lto_.profile.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 x\365\002"
+	.string	"T\004l"
+	.string	"\007"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\236\376\250\313\b\003\200\276\204\276\004\f\002\001\002\002\002\003\002\002\002\004\002\004\002"
+	.string	"\002\002\002\005\004\005\255\302\354\351\001\016\004\002\004\006\240\342\234\212\n"
+	.string	"\t"
+	.string	" `%"
+	.ascii	"T\004D\005\340y6U\273\275\340\200f\3030h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 *\365"
+	.string	""
+	.string	"\240\036"
+	.string	"\004"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\001"
+	.string	"\001\005\002\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	">I\327\fg\003X"
+	.text
+	.section	.gnu.lto_.inline.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 \264\225\003"
+	.string	"R\006\027$\200K\322\001+\255px\001\201\b\r\263\206,\342c\353^$\243I\225G\320\004=\374/\350\242\244\221-w\n\377\007P\202yL"
+	.string	"\277\272iO\304\320?\365\356\276\205MC\271\020v>8\356O\200\026\351\023\310\032\017+(\260b\3110\006c\377{UzD\333?\205\231\231\350\321\220\007"
+	.string	"\374CQ"
+	.ascii	"O`IG\021\311\"\257K\250\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 7\245\001"
+	.string	"\324\002+"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\003\001\001\003\177\002\007\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\177 \005\002\001\001\017\177\002\002\177\002\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\003\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 \272\005\003"
+	.string	"b\304\f\025\260%\351\200\035\rs\220$I\022\352T4B6i\255\221$S\236c\221-k\205!Z9\267\250py\335\317w\304\316\354\310\303\362\020\330\360\3213\020\020\021"
+	.string	"T\025"
+	.ascii	"+&0\033\003\025\226B0\254\033\200h\363\205\035;\213,\330a[~\360"
+	.ascii	"\\\363MD\230\307v\346\200m\033h\003"
+	.text
+	.section	.gnu.lto_.lto.e375c411f5330f0b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dispatchIsEnabled.23.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 \343]\006"
+	.string	"\322K,2`m\322\030\300.\036\t\310i\233w\030\003\321\201\234\323\276S8!\323\232\265\036\334\246P\376\177\326\333\002"
+	.string	"X8\213\336\327S\317\233\202\300\217\244I)S\273\352\301q.\232M\246\201\301a\232\303\264\210\314\005\242\271k\323*\202-\215\303\3258\226u5*[TQj\001H'\036?\020\344\215\034Kt\0221\224\306\016"
+	.string	"J\251S\006(G\237}R5\036-\253\242?O\235P\004Nv/F+[\"\221t\374\236\247NP\360\374\006(\324d\244BDe7k\272\201\017\363\215\350\201\006!)X\350\203\031\260\260\273'\026\302\300\025\377\203\037\341\267\b\b"
+	.ascii	"2\003\316:#e\b\3055\321-\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_dispatchEnable.24.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\262\313,3PM\324\001\244\034\360\"\346\362\210XT\246\275\245w\270\211"
+	.string	"\b\271\250H\fk\373\261i8a\036\026\024d\246\2711\365\301Z@\177u\222\377\337\310\337;\245\256\220B\305\242\352\232\020\016\252D\253D\031\246h\201V\353\242P\200\251*\301\242\030EY\364\021\3673$\020QJ\272\351\340?s|\215od\276\205\0334\371\357\215\2579o\244\310\310D\206I'G[\344\344\244\260_\331\031\332\323\300\353\310|\354F\214)\033\322x\\\330\376\343\315&\001x\300\200x\034'\273Kg\305\267\313\315?\306/\037\310]Z\nv\327\362\003%\356y\333\002\266\007lC\004\b"
+	.ascii	"3\001\0078\003R|\241k8V\b\343e\210p9\026\355$\003"
+	.text
+	.section	.gnu.lto_dispatchProcess.25.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375`#\002\225\022"
+	.string	"6\341xI\300\324M:hW\301]\001i\305+\355\234V\b\201\341oX\003\304\273\353\227\024;C{\221a\204\204\004\274\355\234\317\027\3302\334t\031\257\215\371E1\002"
+	.string	"\"\274E\n\321\001\030i\022KW\345E\216\004D,![\312\224\002a"
+	.string	"]"
+	.string	"i"
+	.string	"N"
+	.string	"\336;9\353\273'\037\340\273g\273\307"
+	.ascii	"\f+\0337ID\346\234\341\212\260\247\264\177\236\\\245\371E7\021"
+	.ascii	":z\322\2154\377JF\033\243k\206\321\246\336\t\235K\311`(h\304"
+	.ascii	"s\327\234\261FnnI\206j\264\321\275\321Y@\266'\335\250sM5\230"
+	.ascii	"sZq\306\016w\352\266i\266!\330\372 \337\347n\002u\3730DT\323"
+	.ascii	"\335:A\345t\273<6\316\246O\301A\203\204\367f\247\324\253U\203"
+	.ascii	"'\372S\237Zz\352\225j]\365I.\334,\261vsn\330\031\2317\274\246"
+	.ascii	"\037\337\350H2?\262\001\240\334q\266J\306V\335\273\312\366\325"
+	.ascii	"\276\320\207h'\2321\2009C\024\275\230\023\247 $=\254\335\303"
+	.ascii	"\020\272\370\331+g\022A\001\013T\004\005\321\365[\334\205\314"
+	.ascii	"\367q\253"
+	.string	"E\217\323\222\003\347G\315u\235\005\020\324E\220\"j\205\207\333\f\351\t\337\3529; \2008\325\250\321\"\006w\265)!7G\276\251\005\367H\227(F\035\032\206(\231\260\351\316\366\353K3%;\346\234)\276R\005\330\201\036\237{\276\354\273\027vA\221Qp\315b\302\027\330\353\005\023\t\264^\256\b\263\227V,\026#\252,\242\270\210\263\025\030\231K\202\212\310\022\212,\341\213k\345\025\2121Y\210R\3000\230V,\234\301`\261P\205\253}oE\227?\034\242|\324\326V\342[\236\244\313u\300#\206\\& \333\023\213\235\232\356.\347\234\3233Q\271\336\365I\315\322\330VySL. \200\002\221\262;\007\306d0\f\254;\376\r\264&B\326L\315\r`p\033\210\361\214\fie\353\215\321\227\201h0\004-\3275\"ob\027wB\220\265W\331\013k\313\357\373\360M\350\262\221\262\005\034\314t\003\231"
+	.ascii	"\032\345\"\256\b\350\027Z\032e\026\340\216K\244\3563sl+-\r+\264"
+	.ascii	"?\223\361\361w\264\203kC\303tu2"
+	.text
+	.section	.gnu.lto_dispatchAdd.26.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375`\210\003=\032"
+	.string	"F/\250I\260\226Q:\025 \306\325\030Q\327|\0254\227\243\3211\260\f\340!w\275E\252\246-\201\226C\301T\241\2437\372\220\035u3\342e\366\371u\233\347\020c\376\033\324?;\375\323e\334\037\345{\006DWZ\206\220\275\267\334I\006\215"
+	.string	"\213"
+	.string	"\225"
+	.string	"\2732\370!\270/m\223\005\320=\203*\252\273\033\254\203\361T\301\274\334}\220'\341\256$\364W\367\321\221\250\356`\203e0\236n\3604\365t<\201z\272\270\335,\006J\b\b\263k\302\352n\030\327\330)q\027+\235<J\334\3367t\261\305k\313\247\223t\362\222\323\023\227\317\304\224\220\204t\243\204\234\001z\020\235G\242\217sA\321\024\321\251\250\370M\232)4\260\334\351\262\347\333I)N\350\356\225<\337\212/\200\357\256\212\335\365\260\313\274E:9\\\031\226<\257vY99\334"
+	.ascii	"rw\247&\317;\337\351\027vD}\331\242\343\241\335\240N2P*\013\330"
+	.ascii	"\264|T\363\252rg\256\364\017\270\360\353\372\322/3V\271\342\345"
+	.ascii	"\326\313\245g\372NQ.W\271\262\312}\001\206\261s*P\245;\305PL"
+	.ascii	"K\241R;\316\364\013\367F\376\264\333Z\240\027Yj$D\352\356\026"
+	.ascii	"\320n\353\364o\272\323\266vW\0304\273\b\205 c\"0\335&\350NX\240"
+	.ascii	"\312\332\322\035dp\272\020\002"
+	.string	"\177z\005\0371\244\374\330\ty\354n\370\223 \032\033\335}\223@dj$\004\242\224\223\303s\325\225\245'\312\300\325\351A\305/\246`\306\345p\213 \004\251;w\336\310=\250S\036q&4\241q\177\253\247\224\037\374\252\364^\314\356\356\311@)\034\227\025o7\366%2$\266\031\215\215\027\337\374\264\360X\344\344\220\215\3108r\302\f\334\377\206J\024\034\343{*\263\007\"VHH0\273\013\342Izn\366H:\314\306\356\276\016\241z\312|&\027J\222\317.\376\225\211\033\302\346Ggf\003\202\321j;;\265\330\001\235\231\215\226!G&\200\347?\031n8:\262\034\361\346c\243\311\350\306lB\304l8<?\263\034\016\261\017\260\330\007\030m\206\263\003\213\371\374\300l\020l\215G\346\003\263\325j>\260V0w\326\tE:\362\3169\362\344\236\244\224E\035\212\235\222y\250W\356\355\016\340=\023\021B\322\312"
+	.ascii	"\n\253\242\244\030\177O\245\352\241FPX^\246\202D\037\024\220"
+	.ascii	"_e(2\031\f\277!\217KN\016sT\r\265\346\205U5\324\245jj\206kX\274"
+	.ascii	"\332e\271X\344\031\016E\250q\030\310\020#J\221\221\221@\210\026"
+	.ascii	"\024\246\003P\002!\204\224y\021\36054\266)\354\006\335\300\332"
+	.ascii	"A\t)\212\232ICLF/r{\266't5\025\036\235\271\240\354\363\216\001"
+	.ascii	"\305\234K~\275G\246\254@\277>\002\3657\231\227\307U\033@\336"
+	.ascii	"<c!\2219L\22619?\360\003K\216\253\203\336\307x\306\"\034\307"
+	.ascii	"O\316\354\b\263\202\002\004\371t\210R\r5\246\372g\262\035\307"
+	.ascii	"Ym\"\364w\242)\262K\205\203\371\356\020&\353\b\214\031\375\350"
+	.ascii	"\ri%\2715\002/A\016\"LR\345\003\332}_$\357U"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 \257\315\003"
+	.string	"\024\006\253"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\027\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\026\r\200\204\001"
+	.string	""
+	.string	"\003\002\030\177\016\002\031\177\017\252\333\3426\025\020\032\177\021\305\245\376\322"
+	.string	"\005\016\022\201"
+	.string	"\001\033\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\004\003\330\244\235\311\003\001\265\006\003\005\007\305\245\376\322"
+	.string	"\001$"
+	.string	"\b"
+	.string	""
+	.ascii	"\023\212\324e\270\204DY\031t\0162\274\025\302EhU\006"
+	.text
+	.section	.gnu.lto_.refs.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\001\002\001\001\001"
+	.string	"\002\003\001\004\006"
+	.string	""
+	.string	"\004\n"
+	.string	"\001\005\002\004\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e375c411f5330f0b,"e",@progbits
+	.string	"(\265/\375`\216\t\3354"
+	.string	"\332]\214\024F`\246U\007\t\250T\354wc\314[\300k\201:\232y^\016z\313AU\271\034i\202\320\227S\223)i\213\341'\255\0067"
+	.string	"\303{\350\371\313\261mNe\367\"\216\252\357\312u2\362\265T\001\276x,\330\356&S\n\025\0019\0015\001b\324\034\230\355\244\334\355]\036\3650M\226\373_"
+	.string	"\340\316\223&S\314\266\231cu7n\006\0179/f{Ev0\256\345Q\235o\265{\361/\215C\276\017\375\177\203pbv\206H1\333%r\273\356\026\344\272[o\310E^\340\306bI\335*6\275\302l\324\245\336\345}\242"
+	.string	"\307\037\255\023f\373(\033p\276\205\376\311\235\263\220\026\335O\036\261c\025\276\352\366+n\345\317\232\373\324|\351\377;\344s\305KJ\212Y\177b\317\342o\373\323\261\364\221\205\316!\337\352\377\365'\373oto"
+	.ascii	"\344\336\300F]b\334rc\033\347~\275\300-\373\200\233\325\261\377"
+	.ascii	"\f\350\366<\335-\246\273\277\272\033\215\003\350\3563\017\272"
+	.ascii	"='\240\333\331\220\241a\273=L\267\327\272{Ow\243u\267Yw\227u"
+	.ascii	"7Yw\303\351n7\335M\355n\260\356V\323\335Y\272{\253\273St\367"
+	.ascii	"\232\356\016\353nkwW\273\373\252\273\337\356&\320\335f\272\333"
+	.ascii	"\226\226\226\226\326\355\023\272\235K\267\217S\0175\026\311\310"
+	.ascii	"\346\322=\323\\\n\271P\343\322E:\227C@\246\214\2349Yq.q.\027"
+	.ascii	"\371:\222QF\245P\325}\233?\366\357\322\246W:\370\217j*\307\214"
+	.ascii	"@|z\254\3528f\031\233\376\376?\202\344Q\252\371\310\252\033\245"
+	.ascii	"\371\037\345\250\364\311\n\355[\375$^m\247\242\376\251\351?\301"
+	.ascii	"\277\377\311\377\326\277\372\377\355\377\373(\243\336\377 B."
+	.ascii	"U2\371\317$J~T\313\325\364\217\245o\246K\027*\325\344qE\241T"
+	.ascii	"\177\343m\235\352\307\234\312\fm\257\376\351\377\335N\246Z\362"
+	.ascii	"(c\343\005\364]N\3365`\231L\323Y2\314\212\241T\211\354\260\342"
+	.ascii	"\264h\311\352\002\253\342*T\250J\314\252!\nZbu\036\301l\373\220"
+	.ascii	"\334nud\301\277\274\214?\201\332\367\241\216\262\340P^\335\312"
+	.ascii	"\277<\313\247^\225v\260\262\362-P\307ZptC\234a\241C\241\233\367"
+	.ascii	"\345\\\356U{\235\374O)\001\262Bo\224\271\376\277i\374\214\243"
+	.ascii	"q3\036\365/\357\322>\306\3114\321\373\217\374\177\b\020 @ \372"
+	.ascii	"\361\262\226M\001`;\230\361{\201[\221\027\025hN\217%H0\353b\274"
+	.ascii	"Ne\271\333\367D}\217O\331\367\2277.U?\272\256\257$\023\241\246"
+	.ascii	"\347\353\210\230+<x\034M\017\024\363Z\273\356\210\262\352iG\373"
+	.ascii	"\321\252\n\223\206Y\277\372Y\266\201fez\226\007\210N\322\330"
+	.ascii	"\244\346)m\013GSY\037\\W\320H\311\355v\334\315\242n\346`D\357"
+	.ascii	"\357\030bM#4\246\312\355\016v\243C\307\313\362\313 \r\024\263"
+	.ascii	"*Wf+\207[\247\275\214\r{\212\215Moi\240\320\3160\333\270)G"
+	.string	"\216\223y\2342?C^'\037d6k\024&^0\333x\231\333\237\356p\242\016\307\237\376>\024\006/\3127B\3436\267\213y\233\366\261\036s78\346\327\336dA1\257\317d\352X--3&\230u7O\234\023(RO]\271q\367\355\215\312\377\337a{_y\314\265\333\334u\335?^s\007\335\315~\255\027\254\371\217\232\272\223\241l\031\205`\266\273\213\276\253\376\333\241\177_\351B\235\255\313\305\272\034z\277\310\201\207N\275\373:\227l\363\361\277\357\217t.c\270oS\351\276\315V\350\221\315\366\377]\n\271Rc\353.\324\271t\241\315\345\320#\277\r\255dD\\\002\026e\354\202B&&a\317\347\210\002\f\246\236\255\225\214v\304\341o\006p\350KPD\"\252\3701\001\213\231(\034\366\200L\267V2\032\221B\004\212]\361\347b\230T,z\321\023.q\370\r\205\034\230~Eb\r\024A>\237\206"
+	.ascii	"\276\244\237\022K$\376z\302\241\t\240\236\357\267\304\")\350"
+	.ascii	"\201(b\250{\300\341/\370s\221\273\302\005\t\0270\320\360i\f\031"
+	.ascii	"&d\230pk\f\031x\274\f\027x\271/\360jE\245\005-\204\361\033\356"
+	.ascii	"\212B\341p\027\340'\343D\020h\353\005e|\310\345\"\322\021\205"
+	.ascii	"b\020(#/\001\213A\025\276_\215\244\245\237/GD\2521,\006=\004"
+	.ascii	"5\217\307\241H\005\t\020\271g\244\324+&\301 \002}H\275\026\273"
+	.ascii	"^\213]\020\230\304\264\353\r\211;#\005E\032\277 \273$\024n@\262"
+	.ascii	"\351\300\307\261\251*90\213m\330\300O\270\366?@X\226\220)\327"
+	.ascii	"g\366\320u\343\033\215\237r`$\026\023\013\263\330\305N\036m*"
+	.ascii	"\306\361A\236dL\233D*\323\360i\352\r7\371\024\027\026\344M\233"
+	.ascii	"\332\220\214\037?>\272\026\006Y\202\364\250\372g\3522\020(U\234"
+	.ascii	"\360\021\033\343x\245\241a\026\2679\343\017-\260<\271q\200\261"
+	.ascii	"\250\261,f\2203\210\310\214\210\310\314$)\034\220\002\221)\263"
+	.ascii	"m\0210)\243\316\324H\223\302\036\007L\n\254Z\362\275\007*\324"
+	.ascii	"\177\246\301\247\036\235!,\200\n\002\031\234[}v\272\316qr\272"
+	.ascii	"\240\2106\323\361&LKi\234^w\226\351\031V\216)\226\314\340\355"
+	.ascii	"S\221\204\314\374\tL\300\227\330\221e\376\311\304$\371)\224l"
+	.ascii	"\333s>&#,\301\b \303\302)\303\313\222\225\016r\354(\227\265\002"
+	.ascii	"\300I\212\374v~\177)\003J*\357Z\034\256\224\t\251E\240\214\342"
+	.ascii	"\203V\026Y\253\0354\260\336q^k\310gC\032\205\304d\371\321\001"
+	.ascii	"\270e\237\257V\027\347\017ij\201#\220\247e\235\334\223\373\016"
+	.ascii	"\371\211\222\352\n\363\345\205\331#\307[&\207\300\304%\273\343"
+	.ascii	"\331-|\357dL\362D\001\303\321\235\004\256Z\372\251I\331YE\324"
+	.ascii	"W\274ut\tX\360\241\004\2100\003C$?\027Lx\217/\017_4.}\f\236n"
+	.ascii	"\007:\313\006X\353[#o\204\344\351?\240\300'\217K\n\245\025\222"
+	.ascii	"\007\035A\376\203\017\374\250:\340\347\254\340X\335X\330wVp\026"
+	.ascii	"\322p[\007\334\031\222oi\220\260\350\301\334\031\243\375\355"
+	.ascii	"\363\303\201\314\307\364l}\335\366\265\037\031\237\016/8\307"
+	.ascii	"\370\035V\311\360C\034\326\207zS\206\365\274~|?\330\276\026["
+	.ascii	">\363\021\3411!\336\r\255\002"
+	.text
+	.section	.gnu.lto_.symtab.e375c411f5330f0b,"e",@progbits
+	.string	"dispatchIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e375c411f5330f0b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
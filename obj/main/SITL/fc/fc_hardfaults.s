@@ -0,0 +1,265 @@
+	.file	"fc_hardfaults.c"
+	.section	.gnu.lto_.profile.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\002"
+	.string	"\223\344\350\214\003\002\002"
+	.string	"\002"
+	.string	"\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 @\335\001"
+	.string	"\024\0034"
+	.string	"\001"
+	.string	""
+	.string	"\t\372\341\240\227\002m\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\001\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"hJ\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002\002\006}\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.67681f644ec4ddaf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.19.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"}\n"
+	.string	"&\023G=0\345(\035\3365\004\240\367\374\334\035F2`\245u\024o\200\203\036)0\f\305\225\245\331O\213\332\356>\303\266\334p[aQ\331F\nXh\"\244\266\003E \224&\337\265dw\3332\2454"
+	.string	"7"
+	.string	"4"
+	.string	"'\246\253:G\247\\\225\237\020rn@\0249-\370\004\271\344,\264\306\021\002\261\305\371\330\\5w\371n\210\341.\307Pk\365\276D\217\273s\333\"\333\b\3667\037,%2X\306\336\354\331j\245\211\375\251\021 \3062f\177\275_\277\343\3201\0168\270\325\312q#Pk\223f\305\366=V\331"
+	.string	">C\251\247\025p\311\214\265\326N\006\234Zk\245\223[\273t\332\277\374\231!\251\205r\3650\245E\302|\245\210v\303Z\233\347Q\364r\345]\260\360\262\277\240|\025c\244\366\257O?E?/m\002\366@%S\305)4\202"
+	.string	"C\022\017\336\250\363F\235\305D\210\324y`\251\003\031\370\273\210"
+	.string	";\323\367\201\235\307\276\214\231\2231\333\236U8\005\265I_Cm\024\300\222\253\377\001\023"
+	.ascii	"G\b\232Q\271@\265\035X\203:\274{(YpZ\205\205x\260\206R\033g\306"
+	.ascii	">[Zy\301\"\310\fn?K#-\242\233\272cJ\241\240"
+	.text
+	.section	.gnu.lto_.symbol_nodes.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 x\315\002"
+	.string	"\322\004\022\037\260%\351\3144\270:\335\246\003\245*Q\200\244\265V\003I\222$s(m\r\316i\204l\"SS\300\324\266\266q\221\317\200\220\266\342\020\376\250\355+\tu\tW\223l\261C\375tZ\370\373C\200\n\2000\2403\320?\023\005"
+	.ascii	">\353?%\030.\337L\313\220U\236"
+	.text
+	.section	.gnu.lto_.refs.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.67681f644ec4ddaf,"e",@progbits
+	.string	"(\265/\375`k\0045 "
+	.string	"\206=\332F\220^QcB\2444\026\314\377$\213\207C\024\227K\234\362\227\245\013\2554\302\025'\003\344\t\226\027k\355\335\221,\267'\303\344&q\340e\006\345\201,X4"
+	.string	"\ba#\317\370\263Z\314k"
+	.string	"d\305\332\223\337d\313\024\261"
+	.string	"\273"
+	.string	"\316"
+	.ascii	"\350}\361?\372\377G\215b\177\036\260T\352\367\373u\b\375\036"
+	.ascii	"\205b\301\370\307!\234-\300\264\r\262\326\260\250\264R\217\301"
+	.ascii	"\242W\352n\202j\331\242\302?\375\277uJ)\240\r:#y\241\334(W(\273"
+	.ascii	"R|\247\334\326@>\366\355\317\006)\r\251\342e$\211\356\201\027"
+	.ascii	"\331\240\364e]\200w\n\036K_\331+\350\312^\366}b_'\267j\310\225"
+	.ascii	">\255\037\376l,\210\305\361\0232\222f\357\201Wy\r\274l\203)c"
+	.ascii	"{\250e\214m\005\002\354k\303\266\030\333Y\266\273\330\276\262"
+	.ascii	"M\264\335\332\256\262\375c\233\214\355qkkk\313\266\t\373^\260"
+	.ascii	"]M\002?\224\017{\265'\300\327\347^\231=\340\272.\003\333\344"
+	.ascii	"o\333\245\365?Q\331)\227\\\361z\214\244m\242\317\236aU\357\343"
+	.ascii	"\001c*\322V\205Y\025\2012\316Sc)\373[`\325\373\330\025\205\275"
+	.ascii	"LPM}<\025\366\366h\372\365Di\313\203:\033\004\306R6\bL\333 \020"
+	.ascii	"\226\266+\372\257\300\253\262<4\365\005s\300\322\226\007|\033"
+	.ascii	"Dci\233\004M\024\25328.\220\324w\032\277(\236\n+\246\354z7\377"
+	.ascii	"\035\302\270\312\340\217ZU7\274\034wK\257H\243\207\205\267^\366"
+	.ascii	"?\202_/\310"
+	.string	"z_1\235Z\377\251\036\356\277\t([\274\221[D\205D\375\t\306\237\340\354\377\373\003.6O6~P\215[JzGF\322cT\371\345\313\315\022Z]r\252\240\240\264~\0352\002o\346\234\341q\301\370f\001\200\363\2028\034I\337\271V\266\201\b\214\021\002\327\350\301\362\025^\254\333\205d\017|YQ\321\260\243u5\214\003\227\2361D\274p\001jS\307\307\020\253\364\025\226\366\275r\205\367\312\275\272R^#\304p\206\224\326\037\306\001\320\221\344iG\362b\271Y\256p\350jq\241R^5`\017\223=zF\322w-}\207^w\353\016\275|o\224\276Tn\025\337\341\025\336\341%\032\366\277\367\377@SA\210\247\312\022\255\353\240\222\225h\246~P\335\361%\332\021(x\216\200\277\352\277\002\2374SJ\254\214\244K\224\243\375:O}\306\315\314[\213\\\023\355\304\235\3101-\355L\335\251\373\220Bw\356"
+	.string	"\0307\243\355\314\033\213\234\251\224\300\205\215\351\246\344c\334\314\303\210\016\"h\347\355\204i;\211N\244\b\022J\024I:&\f7S\207AD\220q\2633\347\224\023:\221\214N\247\334\212\237\333i;E4\335\316\235\213]"
+	.ascii	"/\260.\305\315\244\235:\235I\013`\336\230\224\234l\034\2204("
+	.ascii	"\2316\0161'\345\314\233\323\355D\351\tE\017\212\214Z\374\330"
+	.ascii	"\350\b\302\021\204\227\215\216j\265\243\242Z\351\242\232\353"
+	.ascii	"D\332}\2705\345\316\322\265\032\006\"\022 6\224I\263\335\311"
+	.ascii	"\264\302\266\244d\332pHIK\264\244%\232S\316\326DK2w\264\331\220"
+	.ascii	"\231\254\001\354\036&q\312\020I\342\216\"A\310\334\253Q\215\231"
+	.ascii	"\247\336H\212\021s\211BkA\250q,d\004\222\030B\034\022\221@\002"
+	.ascii	"\032\241i\007`\002\0219Y<\021 \256\311TTX\3667\311\0367\t\n\207"
+	.ascii	"\257^E\323\271!\356\305\256F\373{;\266\003L^W\333\004\201_\365"
+	.ascii	"m\274\n\355\256\201\330\235+\363\"\223y\266\261\333s\313\363"
+	.ascii	"Y\341\004\311YI\026aE\331\266\001\326]\202\004\317\007vd\270"
+	.ascii	"\002&\327\031:q\2431\240O\207Q\221\232\254r\233\314!\225\213"
+	.ascii	"\352\262\b\262k\t\335\252\235\322\225\322N\214c8\316\334|\310"
+	.ascii	"\2270wN<8\235\307\323\317\007*"
+	.text
+	.section	.gnu.lto_.symtab.67681f644ec4ddaf,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.67681f644ec4ddaf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
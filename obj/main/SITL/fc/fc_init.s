@@ -0,0 +1,1602 @@
+	.file	"fc_init.c"
+	.section	.gnu.lto_.profile.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375 \202\245\002"
+	.string	"\344\003v"
+	.string	"\007"
+	.string	"\233\364\343\336\006"
+	.string	"\001\307\334\373\306\017$\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002\006\002"
+	.string	"\002\002"
+	.string	"\003\352\263\360\321\b\020\240\342\234\212\n\021\022\023\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"@\204\224K\345\354\006\b\020T\371\225\314\346\n\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375 \2045\001"
+	.string	"px"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.ascii	"/\036f\022\200{ 3Pd'\001\200\302\316\2759[`\200\005"
+	.text
+	.section	.gnu.lto_.inline.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"5\005"
+	.string	"\002\005\022\036\240'\351\003\351\347J\304.\210\353\321\213\rc\367\2108QU\325\370\326Z\326\2555\"e\n7H]]\335\237\2379ZG\242.\207\250\377\212\240\207\264H"
+	.string	"\372\034\264Q@(h\230\337\344\tf\226\030\250\231\331\371NF) `\002)\226=I@\361\241/\220X\230\343\b\th\313"
+	.ascii	"fb#\027\213\361p \300\007x@p\005\030\352\304]\301\233\036\032"
+	.ascii	"\274<\030\304\200\203/\330\2210|\020\021\0059\255y\207C,\203"
+	.ascii	"&\016sO4\337\312\221F@\002\02080\023L\244i\033\273'r`\363Z\031"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375`\254\001m\t"
+	.string	"\002\r*/`k\222\01605\240\200\030\240)\320a'\212\0306\304\032\241\024\003\320\007k\315f#\215\017\002\242E\320\325V\340"
+	.ascii	"\336\256\376\355\357F\210L2DX\250X\036\362y\246\307\265\002U"
+	.ascii	"L\240\346\270\343 A\001\232\037Gr8_\006\330\332\021c[\256|=="
+	.ascii	"9>\271^\211d\252i\332`hp\270\214\300\303u\221\254=\242\240\301"
+	.ascii	"\032\020\034\203\021\022\335\342G\225\001U\275}\306\235\f\200"
+	.ascii	"B\371\302\306\334c\2563\323HU\371\220\004IG\220\016\24437,\270"
+	.ascii	"]\263fn\256\257V\351\325f\245'\256%9\311\362\310^\004@\250\001"
+	.ascii	"Q\251\250j\031\311\262\006\260\002\t\316h\036\021\26081@W\233"
+	.ascii	"\2725\003{\262\340\302P?\n.\016\006\020\215f\323\221\357\206"
+	.ascii	"G\b\220\306\326\025Z\274\355\257wZ\234Lg/\222j\036\235\306\036"
+	.ascii	"a\031t\0215\001\275\fT  D u\2761\317@DOk\200_V\347\223\247A\205"
+	.ascii	"c\0170\002\366\226\301\340;\bB\221\353\263\303\247EJz\037\b3"
+	.ascii	"\3635\013\034\016\t\234\370\r\2500\234\001"
+	.text
+	.section	.gnu.lto_.pureconst.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.fe8176f817cdd957,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.170.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375 \276\035\005"
+	.string	"2\211\",pU\323\001"
+	.string	"\355WB`=\326%|\325\205[\374>\307\210\t\324|JhHyi\234\337\377\1775\200\345~\020b\307\267q\357\224\002\226\3215\251)\311I\345\244\324T0TZ\016\215\n\256\032\013K\257\252\262\024\352\366\2213<\"\304\3562\030)\366\003\0339\033J\231\357\023mv%\001"
+	.string	"\313\021h.\266\017\031\263=\357,{\257\023\361\276\335\325X9v\210\371\307\234\240m\331\341 \261\273\206\3326\271\343m\037l#l\317\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_init.171.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375`i\016\315E"
+	.ascii	"\272q\\\031A@\246N\007A\\\263p\tg\305\367\267\026\350N\321\320"
+	.ascii	"s\267\212c\245\264\177\034h\250\304\354\336\243'\r\265\233\002"
+	.ascii	"\263\206{\207\316\350\236\365\241\363\372e\016{/nF\fv\275\221"
+	.ascii	"\320&\273\233L)\005y\001o\001\211\001\303o\343\372m\264~\027"
+	.ascii	"\211\337\304\342\367\272~\017\207\337*\361;]\277\205\353w^\277"
+	.ascii	"\177\370\355I\327[\202v\026\005-\363A_\"\203\211^8\305\303\342"
+	.ascii	"u\356o\376\335\320v\2739\247s\275\256\337H-\241\257s\030\307"
+	.ascii	"\354{#\254\236J\t\267\034\332\017\236\240\235\341ph\017\377\310"
+	.ascii	"\321\341\320.\222\335}\341\001X\246\257{8\2643\233\271(\232\333"
+	.ascii	"\373\276F\252\303\265Q\273\233\213q\375\215\225\352\202\276\315"
+	.ascii	"\013u`\267\300\367\205Ny\332\013VO\225\374\250z\372\336\244z"
+	.ascii	"\332n7 \207Jy\235N\t\230\\\340\373\276U9J\027]\b\365Vz\327\241"
+	.ascii	"\236\216NMLKJIHGF\243\"q\035\252\2510\277\333\016\347\b\314\b"
+	.ascii	")\371\3148\271\034\n\213?\t'x\005\236\371^\023\213\320\210\b"
+	.ascii	"L\317\225?\252\271\223\232\225o\252\342LU\250\374\2220\355kC"
+	.ascii	"\347{\315)B\013cV\332\334.\355\225\240\024\221\342IC\fv\236:"
+	.ascii	"a\366\271\305M\212Hq$4?BS\362\30637\332k\236mi\232}1\211\023"
+	.ascii	"}K3\311\201\275f\331\257\007\232\024!\363\241\260\001Z\0351\337"
+	.ascii	"k\222\t\217x\234\374\001{\025\211\247H\316/\241\324\373\276^"
+	.ascii	"/\024\363,l\020ec\b\311\271\024\036\211\\a:\234\177\230S\371"
+	.ascii	"?\304\360\276o?\323Y\304\033\200w{\\w\307u\033\343\004k\356n"
+	.ascii	"\007]\256a^\225^h\220\023r\275\300\\ @TO\207y(\247'~\263\360"
+	.ascii	"\256\273BT5w\273D\\\247\224W\346\3524\253\371\001\330\242\n\337"
+	.ascii	"Pw\217\214\271e\357\3144;\02368\226\360.\347\177.\223\364n\310"
+	.ascii	"\227\330\355}"
+	.string	"\273\374\374\217\253\304Ms\2310q\235\270O<8\n\362\251\313\324\267\036w\253\250\335\256\232\213\305\271\274\201\321e\346r\265<\036\033\254\314\\-\324\303E\021SPW\273k\276\347\262\255\357\273\254\320\016;\036\267-D\036\022B\323\366\226\363\035g\nr\217R?\347\354`b\312\037\354v:\236\347\206i\267\322\256\030\027\356\235\351\302\345Tl\256\215\254\353\007\205\031\220F<#p\222\032\340\217\234\237=\345\236_\304\371Y>\242.\360\251w\236\352P\207\243a}\337/gnX\277&,\360\264\335\r\007\307\3636\036\332\255x\332 B\244\253\367_\217(\361\316\364l\345|\343\350\327\t$\273&0\352\364\335(RtY\261\205\005\232\213\244$0\322w[!\337\231\355\024g\211\243\312\314\325\rU~~v;\225\334\331\227\316O\272\257.X\360:o\003\005\374\315;j\375&\260~\017X\277\005\254\337\001\326o"
+	.ascii	"\304o(\342\367\023\361\373H\374v2\372nZ\277\231\326\357%\342"
+	.ascii	"\267\322\372\235\264~#\r\277\217\002\202k\357\245\005\003\322"
+	.ascii	"\206\205\251BZ\"]\340\245S\tR\216\357\327\322\036\311\322\216"
+	.ascii	"\225\265fJ\332\264\257\333+\203\227G\371\331G&\307\354u{G\234"
+	.ascii	"\274(\322>\221\f\366\234\3066\212\036 \2544\312\317v\372v\212"
+	.ascii	"S6\352\351\315\370&\265\026K\377\363\241$[--\027.\252\247Myx"
+	.ascii	"\250\214l\r\371zy0\3237y\217R\2272\323\247-\345t\214PLV\214\361"
+	.ascii	"\356m[\230V\214\0017\270\305\277\367\033\325\275\035\243v\267"
+	.ascii	"q\255\234\225\340\2328\352E\314\317v8\357\3407\007\354n\330\316"
+	.ascii	"\252-T\243r\201\034\266\310\225\234\350R\2743\225rR0K\034M\361"
+	.ascii	"^\346\221\264w\251]Z\334\225\027\373#\355\2314\355\335\235\312"
+	.ascii	"\246ms\024l\306\321\244w\n=JE\312I?\004)\247G\002\305d'\336\230"
+	.ascii	"\217r\177\2206\016\204\017k\371\3329m\336W"
+	.string	"\346\352\002\371(;\330\"\243l\034\241\327\342yg\032e\ncb\326\374\354\003F\3120?iWk\003\224^\310<\332\324\b-\344\250\034&t\227M-\346\027q}\226\217(\317\177\271lQ\335\356y\257\226\017JJ\374\313b\036\256\375i{S\373|W;H\301\277\317\325\372\375\265\201\332@\252\247\027r\272\306\327\366\006\325D\315Y\3525Tb\205\227z\211\331\030\307\f^v\013\350\202\355\240\005}\261#j\013\265\207\332\270\215UO-\344\274\207O+\b%\226\341\003YI\250\276\242\332\221\365\"@_Qe%\261\2226\252\2206\236\372\212\352\006\226U\r,d\222\206\213\030Z.\262^TmiemaYm%\350+*\032.\222ZV[U[ZV9\222Z1\b\364\007\023\034J\244I\267\332\242\201C\204\025\215\030Ib\303\240\272\221\304J\262\200!\243\n\206\214*\254\244\213\032U0\264\266\252\250"
+	.string	"t\226\r+\255\252\033YYZUF\320.\317Oz\r\304\006\356\312\312&\360~\257G\251\0032\201\276\001\231\204\031\033\007&\306\377\353\005^\262r[`eV\026\272\030jW\b\216\005d\275\325\243\324"
+	.ascii	"Y@\0357\f{\306\205\013\220I\230\245\211\311\322 \0075\275\356"
+	.ascii	"N\315k\006F\227c?\345\335l\033\366\215_\032\274\204\312O\261"
+	.ascii	"\037\366u\263s\330<?3\230\270v'~\312\317N\001|\233\307\003\220"
+	.ascii	"U$\2613\247\031G\225G=@'\250\025*\253b\242\201\321e\023\213\007"
+	.ascii	"\311\267\306\364\344O\3318\027\246\031G\227y\360\366 \315\242"
+	.ascii	"q\324\203\274\217y:\366\357\217xe\344\352\310\375\034\333\307"
+	.ascii	"\217\375\373S\331@,\340\027x9hK!\030Y\330C\305\27128\216.\345"
+	.ascii	"g\017\375$]\345\354\007i\312\r\024\rd\177s\341\373\276\257\222"
+	.ascii	"\0037\220\257\262\01728q|shS/\301\316=\310\\\331\2333\0330y\354"
+	.ascii	"\222\362S\371\036\367n\354`j\227&G\005\314\207a\005YE\354 ;\310"
+	.ascii	"\325*\177\316\b\034G\331w2\317\326\206\245iO\224\001\2019\250"
+	.ascii	"a$h\035B4\"\"#I\222B\032\003\201\005\204 %\035<\017\0210-d\214"
+	.ascii	"\021IR(,\007\361F\265\367\244\3167E%)P\035EW\225\304\210\253"
+	.ascii	"\213\346{\274p=+\217\216\002\241r\246I\001\3130\030v\237\370"
+	.ascii	"\362>\376\243\376\355\030&\350[\231\025\220\034b\264\275\006"
+	.ascii	"\016\346\263\030\"a\204\260\0338\244O\372\2639\203\031!\326\030"
+	.ascii	"X\003?]\323}\031vK\217e\300\311\317\330u\273\206\224yi1\320\354"
+	.ascii	"\301\211\rI\243T=G\371=\2744\007\362\207\271\022\211N\177\313"
+	.ascii	"\255\356\257\341\273OX\341\367\210XMo\002\365?\262\240\305\256"
+	.ascii	"d\222\317\353~\370\020\274=\3304\345\227\030\376\317\034\366"
+	.ascii	"\032\033\035x\250\334\344\250\036\304-\n\005N\023|T\0137O\311"
+	.ascii	"%\271\327\242\307lnTI\340\2606\324\202\b\344d\032\211\276\240"
+	.ascii	" /*T\232\01613\243\262\220\006\031\002\224\346\200J\214\272\235"
+	.ascii	"!\376}\032A\265\027A2\327\202G\231H\177\260\322\375\253\244\232"
+	.ascii	"\340\013\n\032\002\363\335\035\330\274\3572\340Ri\236\310)&l"
+	.ascii	"\b\334\327qeS\210H9E\313\210\260#\200\362\206c\240\020+\n1\234"
+	.ascii	"\232\216\360\034\354\246\313\0337\"\367\225\371\b\216\031\341"
+	.ascii	"H\223\270_\223\031\024\231\272\004E.\007(\233\276\b\256<\367"
+	.ascii	"\200\212"
+	.string	"\037;'\3649\207\022\206b\251\364\315\037\216\n\207\007\313w\215\317\227@\021\251}\227\251\364\001~H\344\370\212\037}\230\315\034\313\232\256\034\036\270\336\211\207\312Ft\037\352\025\310{Hk#]\3400\330\337z\322\277\270ot\276\274\033*\361\326\304\257\233\231h\314\235\"\220C\312\332\301Z\251U\276P5\373\214\370\235\033\324x\027E\256"
+	.string	"\342\023\256\207aH\265Cq1\202\017"
+	.ascii	"\366\266i\\\260`J\333\033\374\316\035\034\022<\365\301\202)\321"
+	.ascii	"1\271\177\\\341\023\214^\377Y\b\352\335\031\334\027[\225r\322"
+	.ascii	"\354cI~1\211'\201\220\"\217\023\240ZB\326\001(;`>|\360?\212\274"
+	.ascii	"\224>\340\310\330?\213\364_\353\350\236\030\300T\b\231\265M\312"
+	.ascii	",\220\3139\232\207\177A1\nf\033#\267\374r\327\357\374\315\327"
+	.ascii	"\225\266qC\3751]\276\312\201\366\275)\317\247\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375`{\007\305\023"
+	.string	"6\244{F\240\226J\032\003\300[\360\026<^\007s\314\261\240^\375"
+	.string	"\"\345\3131^x\200_\207\265\340\2554\351pW\231\302[\260mi(\031\344\\\030c\2141^\346nwwwww\267\203P\025\217:\3262\227E\310\232vp"
+	.string	"k"
+	.string	"b"
+	.string	"M{\023\246\335\311\322\376Di\207\222\264KA\332\341\216\3662\243}J\321\256\366o\354'%\370\205h\247\362\220\n\035\b\222p@\253\3709\212\314[\n\254\305\300Yf\306\342\263H\363\225\236\343j\036y\346\262\333\nx\215\303\264\336+b\244\224#p\256\022\243\304\226\302lgo\001sb\354L\312\225\322ml"
+	.ascii	"\277\337\357\247\263\263\200\221R\0160\0210<\3541:\35428\354"
+	.ascii	"36\35444\35472\354f\030\366\263\013{\016\013\273\216\n\373\016"
+	.ascii	"\n;\217\t{\017\t;Z\204=\r\302\276\366`gs\260\373\340\332\177"
+	.ascii	"4\330\2010\330\333\026\354A\024\354B\266\366!Z;\221\254\335\r"
+	.ascii	"k\267q\265\027\261\332\215T\355oT\373\221\251\035\211\324\236"
+	.ascii	"$jW\002\265\343x\332\2278\355L\002L+/lZsF\2475g>\255\273i\263"
+	.ascii	"\356B\250"
+	.string	"\365F\214Zo\244V\004sj\245\021\251V\235nV\255\272\320j%0\257\326\334\310\263\346D\25457\263\326\\H\264\n\330\255\001\3463d]Ph\255\217[\353\"\332\372L[\017\325\326\022k+\227\270\002I\266U\304\356\"\304N\006b\177\361a\017R\254f\025\263Y\305n\326\26001\301\0326qV\260\231\263\202\205\274\365Kg\375\022\227)\203\363\262\263z\215\275\325K\004W\257p\354Y\273fW\350\263\372\306\237\325'\002\255\276\031\264\372B\241\225\3048\264\202\343\372v\026\327F\264\202b\321\nN\243\025\f\217\326\336\210\264\366f\322\332\013\225V\336\270\264\362\304|\250\021 \020H\227\025\324\316\034`\2036i\306\0210hg\210\021'\361\310\007\001\224\224\274\374\273:{\303\333m\016!\321\206\375\027\345\340\022l\360\331\313u\202\265\214\240\036\264\206\036kf\f\331\305\276*\2657\254\357\303\260n\375\204J"
+	.string	"6F\305\214\026"
+	.ascii	"Q 0\004\242@`\bD\201\300\020\210\002\201!\020E\036\251O\342\340"
+	.ascii	"\b\002\230/\020T\353j\213\266\354\235w\316\232\345\355\005\327"
+	.ascii	"7W]\377}\221\316\353\257\002"
+	.text
+	.section	.gnu.lto_.refs.fe8176f817cdd957,"e",@progbits
+	.string	"(\265/\375 u\355\002"
+	.string	"RG\026 \220+\255\001\027\371:www\267\367\377?\b\002\032\017S\340\200\365J\b\t\330\320\370\221\224;\005\317\234\032s\277Hj\213\364JsJd%\220\215<\026B\260\017g\307\251\215\2331\260\213S\025wbY\304\372 xZ\033\232\013\001\033\001T\310~Nu\356e\246\246O\002"
+	.text
+	.section	.gnu.lto_.decls.fe8176f817cdd957,"e",@progbits
+	.ascii	"(\265/\375`\351O\275R\001\3325\226|W \fY:\215\001j\007\261\335"
+	.ascii	"\266W\267\357\303\235\320\261Z\201\355\254\342\220s]AU\226\037"
+	.ascii	"\206\313T?\013>\016D\257\212\371\357=\365V\002\237\216\255%2"
+	.ascii	"9\374v\253G5\270\251+\247`Q\216;~m\251\204\306\201\t\r']\323"
+	.ascii	"Q\226\376TU\245\355&\245\224)\340\006\257\007R\bfV\204\251\342"
+	.ascii	"\352\272KN\33474mwh_H9\266\031RZ\306\260\022\216\302G+$,q\261"
+	.ascii	"^V\224\\.'U\344\316\276\250\260u\303\256\331\223\2561)bopMos"
+	.ascii	"Yl\356\335m\343e\353E\226-\f\003\331D\356\266\341\261\013F\206"
+	.ascii	"\334\r\253\302d\213\312\177\357\306n\236\332\326\336\307^\020"
+	.ascii	"5X\270X\246\254\255X\240\322\256\260?\345{\206\350\367d\351\367"
+	.ascii	"H\351\367,\351\373\3444\216\372\357\0356b({\205C\007$n\351\346"
+	.ascii	"\247 \036**\312\334\335|\037\031\375\037;a\026x\005n\201UX$v"
+	.ascii	"\201S\374\036\367\026;Ac\313\253\311\206\034v\201\227j\3101\265"
+	.ascii	"Yma\027\030\205q.\001D\204\330YI\356}\f\3221\344\226R\354\344"
+	.ascii	"\373\220\372>(\372\2760}\337\227\276\357\250\357k\242\357K\242"
+	.ascii	"\361\266@\345};\364}P\372>&}\2364\372<`\364y\260h\004\330\237"
+	.ascii	"\362I\013T\236G\212>O\227>\017\016}\036\026\372;-\350\357"
+	.string	"\200\321\337!\323\3379\352\357t\351\357\004\321\337\301\241\177\264?\345w\250\364wP\350\353\324\351\353\204\321\3271\323\327\t\323\327!\242\257\203\245\257\243B\337\212\375)\237\323F?\207N?'M?gL?\307\210~\216\r\375\034\026\3728j\364q\332\364q\250\350\343\030\321\307\251\241\217\343B\177\315\376\224\307Y\322\327s\372\232\213\276\246\242\257\231\350\353\025\364u\225\276N\241/\206F\377\306M?\013\231\376\r\227\276\233\005*\177\223C_\316\376\224\277a\241_\336\351\227n\372\245\025\375\222\211~\271C\277\204\241/\222\233\304\"\203\256\222\036\313\266\344\202\306\315/]\350\023l\033T>\317\006\225\357\331i\273\357\221\033\344\315\214\321x\363?\3708\261\243G\017/\036O\264\344.\216 7\007\020\271\253c\205\037[;N\370\330\032r\205\334\255K\344\026\271@\256\021\213\274A\356\217\213\026\344j\331<\237\322qCa"
+	.string	"\n\216\256k\357\343M\030\034\2132\237\374\236\230~\017\211~\217\207~\317\206~\217\205~\316\323\317t\372V,P\371\314\246\277v\263\256\215rG\230\222<\2334\"\323~\017J6\317\247\344\263\231\226\250\330\026h\334\253ku\261\356\215[\303\"\257\215+\343w\306U\341\332\270K\267\n\037\255P"
+	.string	"l\212\034\332o\2236\356\266y\370hE\247"
+	.ascii	"\253\"g\223\327\206]\223\245C\207\0339\033_L\276l\217\026\250"
+	.ascii	"\f\302\242c\004\335\2201&\333n~\006\323\267f'\334\240\356\212"
+	.ascii	"\373\3443\372l\246'e\266\316PxAKa\311|F\237\275\024F\355B]\246"
+	.ascii	"\034d\344.\324m\262yvm\307V22\200\213\225\266\251\344\205q\245"
+	.ascii	".\325\235\272/n\224E^\250\253\342\346:\025I4_\376\257\323\357"
+	.ascii	"\323u\001\202\275AW19Q\335|[d\252\264\034@n~\236\241/\013\017"
+	.ascii	"\277N\001@\236\225\335|c\177\312\347\027\372YI\037\247\321\307"
+	.ascii	"`\364\361\025}\f\246\217\215\350c!\372x\206>v\241\217\225\264"
+	.ascii	"\305\263l,\222\003\333\346\366\316\242\275\247t\334\307\275\217"
+	.ascii	"=W\213\315\030\330\315\277k\364-\007%\316\313\263\034\224\277"
+	.ascii	"p\372z\321>j8\320LfS\226\334\374[;4;jR\350\230\334|\213F\306"
+	.ascii	"\222\341\343\326M\224,&ril\235\245\263H\213\306\312\335\316\331"
+	.ascii	"3\017\312\3307\237\361\270\237\312\254%TU\311\275\217\377\200"
+	.ascii	"\306\306m\334\246\204\252\252k\357c\207\240\016\035zh8\234t\351"
+	.ascii	"\214\217\350_\037\332\276]{\306\302\335\276Y3\357\300\203\357"
+	.ascii	"0\331\267l3\360Y\233A\357\354\207\022X\231\177u\350_)}{\247\177"
+	.ascii	"\353f\275\350@\251h\303u\363?lAzY\341b\206EK\331\225-g,d\331"
+	.ascii	"B\313b\311\354Z\325\003\222\220\311\355}\274]\362{\360b\2176"
+	.ascii	"\212]\253\312E\322\344\366\336\367@\213%\363\341\275kT\331\332"
+	.ascii	"\373\370\337~\261jV\214\005c\303\3306\313f\327\354\030\213\264"
+	.ascii	"^,\227\333.6\355\366x+\366{\370;\360\300z\261c\226\314\202\245"
+	.ascii	"\275kXmX\n\343\"-\271\367\261CP\007\274e\n,/C\276\234\005*}\366"
+	.ascii	"\247\274\215\242o\271\364m\016};C\373X\240\362v\205\016\262@"
+	.ascii	"\345W\215\201\005*_\2449X\240\362&h+\305N\261\310\013l\225c\017"
+	.ascii	"O\033$mZ\270\371$\350[*\027\300\327\366\340\033\350\333\013J"
+	.ascii	"\233g/(\277A3\300\002\225\277\375\272\215\362\333&\326\313B\001"
+	.ascii	"\301\336L{\357\re\023\023V\221\233m\230}r\013\305\202\275\003"
+	.ascii	"\017\216\215_{\311\336\333BI\300\325\336J\026J\017\336\336J="
+	.ascii	"\326f`m\0069IV\020)e>\006m\235x\270\375\372)\241\252\216[l\357"
+	.ascii	"\335\203\335\242\312`\334\334\263?\345\257F\200\005*K\373S\376"
+	.ascii	"\226\311o\225\330%\027\340&\247\253-\266\367\361B\317\221\252"
+	.ascii	"\005\216\233\177\264@\245\266?%\027\023/(\270\306\177\277\260"
+	.ascii	"\025\362,\355\277\032\323\300*\260\301\375w\003\236\201e\374"
+	.ascii	"7\315\1775\300U8F\233\037Sa\0308\353\013S\226\313-\362\333/\370"
+	.ascii	"\305\217\203\376\033\001\251\f\376[\001\034\005\365\343\016?"
+	.ascii	"~r\361\343\003\264\370-\206\337^`?\374\367\004\330\351\267\002"
+	.ascii	"\3701\213\377\232\240\200\025\377\347\376;\002\254\342\307\016"
+	.ascii	"\370-]\323\177\255\374\266\r\247\3701\b\377\025b\024'\356\230"
+	.ascii	"\377\3720\323\177\221\374\313\217\227\376k\364\277\nV\362\300"
+	.ascii	"\217\215;\333\236\240\350\"\231\340\267[~\334\301\3773\377-\370"
+	.ascii	"\177\302\217K\360\343\024~L\342\307\353\217\321\377mn\343\317"
+	.ascii	"cn\377\334\366\343\020\374x\370\343\242\037\013\177,\342\307"
+	.ascii	" \370\361\007~L\302\217%\360\343\020~\374\200\037/\340\307\b"
+	.ascii	"\370\261\320\217\r\360c\r~\f\200\037S\360\343\f?\306\360\343"
+	.ascii	"\234\037\353\037\227?\316?\276\377\315\373o\362\277v\377\215"
+	.ascii	"\373\257\333\177\301\374\227\355\277k\377U\373/\332\177\317\376"
+	.ascii	"k\366\337\262\377\"\377;\345\277c\377\215\362_\260\377z\375\227"
+	.ascii	"\311\177\225\374\027"
+	.string	"\311\177\271\376k\344\277B\376\033\344\277?\376\333\343\277.\376\313\364_\245\377\356\377\222\340\277%\376;\342\277\352\177E\360_\342\177u\376\033\202\377\016\377k\376\226\356\277!\376{\201\377\202\370o\t\377\215\300\177\037\360_\007\374\267\001\377\035\300\177\203\376\353\373\357\316\177q~\333\366\333/\277\345\362[\017~\253\301\177\273\377i\376\217\371\277\344\177\007\376s\371\217\363\362\362\362\376\234\377\f ~\006\234\b.z-@\220\275\234\250\315\335\354\024\264\203\005\004G\213\233_\001\r\375\277\267\302\"{,zM\357\300\203%\037z,z*x\200\005\301\323\361\"\267%J\316\247\200N\237\202.\332\336yx/\205\025\026P\340\335|\n\310\364\337c\3521Y\262\240+#\035\006^/\264\232\364\310\300b\b\271\371\024\340\320\177O\251\247\204\271\004}m\251\024\314<Ma%+\255\261\233O\201\224\376s\2336\275\315\341j\277 "
+	.ascii	"\032"
+	.string	"\024\034\335\232\024XHn\316y?\220,\310\335|\n\214\372Af\364\237\357n\221\371.\343Y1\252\252d\030\027Z\330n\316- )\222\225\344\346\007\245\351\007I\321\177N&-\231\375\332O9)^dYI\356\235\305"
+	.ascii	"\231M\234\030\0367?H\207~Fc\263\0352\333Y\262\240m\234#@\232"
+	.ascii	"R^2\271\241\262\030`G\f\013F\232\334\374\240\031\372\326\222"
+	.ascii	"\225uu\352\225\274d\327\256\252\342\200\003\005\316\214\355\346"
+	.ascii	"\007\301\320\317p9\356Y\016\231\345\362\234\336{\033\217\373"
+	.ascii	")(\r+/\231\334U48\330:,\263\2574\026\231\347\016\267\263-\350"
+	.ascii	"\261\025\001\"\345\346o8\243\177\373\373\227[\tj\357-\325;n\250"
+	.ascii	"\245\235\362\267\267=k9\374<\026g\374\237y\334'\330\234\331{"
+	.ascii	"[4\232\b\231\222\n7\377\307`\377?\207\275\215v\357\r\325\024"
+	.ascii	"\206e\274\320\024\246\264\233\236\254E]h\n\303\212j:\356\033"
+	.ascii	"\033v\030\216\335t\2742\346+\343\336\333x\367q3aEm\246+#R\323"
+	.ascii	"qC\355\343\225\321g3E\3714\035\225\214MaXQ\266)\354*\252)\354"
+	.ascii	"*\352\302f\332\306\315\244tC3]E5u\271\212\362i\nS\212jb\302\212"
+	.ascii	"\262\307\253m\277\230\035\261\214(v\230\022\317\336\333\351\270"
+	.ascii	"e\334\331["
+	.string	"\tj\033\331n\213\215%\327b\327\330v\r\311\021G\320\336\333(\346\226u\205s\\\332kME\256\206(\366v\333-\022`\264\306\343\336;\305^2\332\275Q\034\241\366^\272\002A\325\336{_Y0)\2406\317fRrZ\312\272\332A\261t\225b\027\271a\367\336;\252),\353\312C\031\224\260\255\275t4\332&\247\253\275\265\335\260\240t\230\361h\353x\302\264\252\234\316<\277\375\326\211-\263Pv\252\244=\321q3\366\342\341\371L\306a\3674\244\314-2\227\311n\366k\033?\340\3664\205\223\026f\214\353\346o\210B\306\255\367\026g\245\346\346<\206\007ZS\227\233\277\241K\377\371\354\026\231\317r\030\004\330\275\253\200UQ\242\242qw3\030\037\215/^X7\177\203\216\265\314\226\277Xdn\313j\317,d\264[\035Z\244l\355\275\323r\027\237\321g\357\2541\233\314m\331K\356b\327\252\366\216J"
+	.string	"\222!wCvZ\f\261A\246\3635\264\240\257\201\214\276\206/\372\317\\\236\273\3749\313\325\301\3243$\306\225\224\233\363\026\017\317\\t\230\246\244"
+	.string	"\271\031G\213\316\261?\245\225\263@e"
+	.ascii	"4|\225H:4=\256\334\"\363\225l"
+	.string	"\345~m\243\016\030\027\252\252\344\336U\006\320a\241J\222-7_C\020\375\347\262l\005\315U\025\264\2333\031\016\026\035=\322n\276\206\033\372\317Nn\221\331IFN@o&:\257%-_Rn\246\322S\3274\305\355\346k\200\032\313bY\212E\346)\031\312\223$K\242\3440\037\316\224\374\225\303|LC\342\216t\320H\320\2449\321\371@k\372@d\372@`?\313`<\320\214<n>\220\022}  \372@U\331+G\312\230\251&7\037hEnr\324[|T\325\270\371\317Jn\221YIF\002\302\356=\345\311\212\235\2572k\244\334\374\fj\222 !\222;J\271\271K\307\350$G\226\233\237\201\214\276M\313\221\211d\256l$\027\261\310|$o\335&\263\220_\017G\262\216|\344.\345 xk\362\221<\304\213NL\222d\007\037\017<-\247\234\374\fA\264\315pC\003I\243%\244\315\315\317"
+	.ascii	"\245\377aG\013rfY\353\256\270O\370\270\205\223\"\007\033\037"
+	.ascii	"\271G\376a\221Y+\363\310Zy\005/\307\266\251\240\016=(\2530j:"
+	.ascii	"\377'O\377\007N\377\347\213\376O\025\375\237%\372\3173\220yF"
+	.ascii	"\316\n\322[\254\213X/\n\351\304t3\226\030^k\352\262o\376\017"
+	.ascii	"\020\033\371\312\"\363\215le?\250\220i\370\360\336XK\266n\344"
+	.ascii	"\032W\222\250u(\317\324}Y*\363\177\240\364\177\2244\215\353\""
+	.ascii	"\247\215\314\230\331\315\307\200\247\217\201\214\3763\0242C\345"
+	.ascii	"\252 \275\303\350\274\362\032 e<n\216\021\2043F\354\313\305\315"
+	.ascii	"\307\220E\377\3170,2S\345\250\333\343?d\252,\225\247|\306\343"
+	.ascii	"\216\272Y\341\213\b^r\357\035\324\201g\r\324.\313\371\317/\236"
+	.ascii	"\247,\031\b\366\006\0368,\307\0377\3339\017\317/\036\240\205"
+	.ascii	"#\311\315\3070D\037\303\r}\f,\262\013a\216(Xn>\006%\375\347\026"
+	.ascii	"\331\311\313\027\233\271\2333\213\253\346\313\223\324\021\247"
+	.ascii	"\254\005#0\302\334\"q\230\254\302B\331\275\247\204Q!\267w\225"
+	.ascii	"\001n\3248\3712ws\223\245R\303\272\273\371\027\3524\n\\&\033"
+	.ascii	"\261\023(\013,\341\375\231)\237\310),2\243\310J\307b\360\230"
+	.ascii	"\347{\226Q`76\031E^j#\227S\246\355N\207\316\277\300\246\177\301"
+	.ascii	"Lg\343\177\3170\231\274o\001r\260Qss^\251\005Jn\314\315\277p"
+	.ascii	"\304\303-\34058\211\331\340;\213\304mp\232c\273\213\343\031\267"
+	.ascii	"\301p\270\016;\201\322dKg\356\230\232\344\226\0163qrm0\0323g"
+	.ascii	"\332\340\332\3407&W\264\266:\364\210Q#\246\305\227\177\001J\357"
+	.ascii	"\330\237\362>l\364}\3440\235\r\213\302\243\205\233\357\243E\343"
+	.ascii	"8,g\221x\356\233G'\207\0251\245\233K\354\275\267\375Yy\363\263"
+	.ascii	"\362>U\364}\226\350\373\364\320\367y\241\357\223B\227=s\272\274"
+	.ascii	"\262@\345\301\330\237\362=i\034p\033\016\323\261\007GL\235\225"
+	.ascii	"\030\026\374E\267\255\311\301\345\346\367xi\234\206\325,\022"
+	.ascii	"\257\375\330\2135{\376\272\332a{\037y\260\022U\032\331\315\231"
+	.ascii	"C\331\223\227\227\227g9\224?\356\302%ca\221d\306\315?\346\202"
+	.ascii	"\307n\335\215 (nn;\243\342l\215\206Z\r\263+H\342\362\344\320"
+	.ascii	"\246\316\320~l\221-\331\022\033\013{2e+i\246\314\213\325\230"
+	.ascii	"\026\255-\2716[gi6\316\266\364\330j+\303\002\373\300^8\f\203"
+	.ascii	"a(8\007\356\201\235\3402|\004_\301X\370\t\246\201g`3\254\003"
+	.ascii	"\017\301h8\013G\301K0\026\\\004W\301S\260\020\234\004S\301Y0"
+	.ascii	"\031\326\202q`\036X\005\374\0033\301G\214\004\023\301R0\020\274"
+	.ascii	"\005\337\300,`$\276\302F\260\030\326\302]\370\013+\301V0\027"
+	.ascii	"\336\302A\260\r,\0037\301+\340\035\270\006>\303V\026\211\307"
+	.ascii	"0\325q\f\\\365{\334\233\351\255\256\205\2550,A\344\270\216d["
+	.ascii	"aS\274\266\274\232h\341\362\n\223\345\315.\013\216\013\214J\333"
+	.ascii	"\030\027r{\037/\027\223-K\360Nk\023\363t\306\002\020\017\376"
+	.ascii	"\373\246\346m\353\254\313\016\271\333\346\326B\356-M\334\232"
+	.ascii	"\377\336\265Pf\353B\371oX\024)otxgY|\33462N[eeI\316\270\360\330"
+	.ascii	"\272\303\313\"sw\331\270\311\265\005(\244\240y!C'F\262\214\214"
+	.ascii	"\0242\b\023\030lQX6\207TY\030\250\214\245-M\222\274'\255\004"
+	.ascii	"<\3611\347\242\004\002\344x\345\304M\213\336>\"\t\323\272\371"
+	.ascii	"\250c\245\306\330\024\213\222\013\247\n\255Kk\005^\251\006\246"
+	.ascii	"EKE\271\304\276\320\021\003\252\251W\326\343v\225\303)E\016C"
+	.ascii	"\245#\r\354\006\005\230\232\227-\257\233\023=\267c\033$fn>\356"
+	.ascii	"<=i]\335,Y\262\2664\247\245\033\245\3746\006J\227\261\233\377"
+	.ascii	"\033c\251v\205'\305u\263K%\020\350\234r\334|\213,\363\362\334"
+	.ascii	"\230\214\035Y7"
+	.string	"\343\341\225lx`\200\204\355nH\222\215\223\033/\253\031_N\326\254)\357,]\334\221\252\273\362jGK\006\032/C\354\354J5t\032\214\241#\202\247\246\367v\206\rmG\326\334\\\211\306BA\355]\265\215s\016P\241\224D\rM]\n\036O\346\312\272\222N\333q\261\233\303R\323\205D\355\346s\210Q\2369S\306\035\203\322\336K{\327\260A\2002)\255\255\344\256\232\342\020WrQrTS\302\225o<`\274X-i:\352\035E\236d\334|\016+\312\224\311s7jNyK\272n\304\252\370\320\272\371\034tqs[\235\332\260t\rASrr\3639(\023#\346\355i\n\367\030\273Sr\3639\200\002\006\314\2315r\271\310\013d\f\036ll\245R\320\025.\023\3674\225\364)\021S\222\342\346sP\243\\+\327n\350\234\356f$q\306p\375"
+	.ascii	"\222\034{I6V\252\365P\261{W\355%\246]\203\306\315\234\223\032"
+	.ascii	"\250\344n\252\342\220\203T\n3\242\275T{\231\326\201\007?\323"
+	.ascii	"V;V(\271\271\354r\313\243\016J\323\315/\267\224\\~\034\034!g"
+	.ascii	"\250\264\271\371\033d\321\245\226\003\374\307\271Vw7\360n~\231"
+	.ascii	"e\007\333\017#7_\373\263\262d\241<\033\2132D\306\315%\226\362"
+	.ascii	"\f?)\301\315\235e\026=J\246t\3700\373\217\203\325\262\332\226"
+	.ascii	"n.\255\224e\026y.\345\225\037{|WR\214q\271\371"
+	.string	"\033\224\351\333s)O`\317\245,\221/\253\3748:M\316P\264\335\374\r\306t9\345%\225\037\307\352p\261A\230\376K)?\316\316\234\017\252\0367\177\003/\375\r\210D\211\002\3674\305\2445\303\311\315\337`\205\362I\371$\317\201\321Mu\335\220\241\321\221\345\346o`\325\244I\t\226\304)\316\256\013\207k\212\232&_/\301\266\200\325\200s\342$\215\221+N\2169-\230(]\001\263c\343\315\f\313+\253\355`q\212CS\006\t\222rI\b%\255-\033v7\224\274\\B\326\325\004\355\3462\211}\223B\305FX\335\177\234\013'\214A\274\f\031RrY\237\343R\033\336V\026\223\005\016y\344%W\211w\254\321\302H\0336-\304n.\213\360\364\024y\302\241\345\346\027\300\254$b\343J,A\314\232\214mm\3459\2606TUI\333\265\277\340n~\001\212\374\370Q\002)\263\336\250\252J.+\026\262"
+	.string	"\261d:d\242\272\230\334\374\002\350(q\2248J-\017\310\265M\3356\243\231\227\262\307K-*kay7\227:J\036\377qr\310f\034\205\360(w`\271\322\265\024\303g5G\304k\205\253\002\347iK\205\344\315e\016\233g5\326\005\203\354?N/\313\356\f\331\315/\200\f+\253\022\313\216a\305\035\221\202\"R\336x\211\325C5\006\206\221\362J\3570\302(+\257J\033T\244\272\200Pi2\345,\312\31552\224\027@\262p\335\374\002\240PA\205RI\315i\214T\022\337HC\326\342\346\023\200\254\244*\251J\031I\234\332\260\354\234\210\313c\241\254z)#\233\261\200\234\272\271\214\221\217vi\344x\374\fF\231\2224\254\251\251<g\277\002\200\3674\325\2453e\212\211\217\233O"
+	.string	"\025Nw*\245\354\327~\nJSfg%\211\351\266\344\300QF\275\224\302\371\221&\331\243\204R\233!\345v\363_B\225On0\\"
+	.string	"\271\271tA\364\306\004\355\346\017"
+	.string	"O\227-0\025\336\362#K\035\232\025+ze^mZM\222IT\210\261q\246l*\233\026`v\327\246+\247ET\022\026i(P\3449\353s\\\n\263c\253g\034\002\306\314\025&\246<\027\2447\223'6\344\342\242r\244\270\371\003`R\032Kc\251\224\301\fKL\222$[\0332ys\251\204#\204H\226\323\315\037@\217\273\273^\336n\233\322F\246'0\332\274\227W\306h!\313\212\215N\335\022\327\0166x7E\350\310\370"
+	.string	"\302\003\366\264&E\013\231G\333\2260b7\177"
+	.ascii	"V\311$\006\244\304$\351\365\020c\023r\363\007\34047\327\263\263"
+	.ascii	"TN\\VD\200zjK\363\236\235/\214\232/Y\320\224n[\260\320\240\251"
+	.ascii	"\373\342\243\tLG\335!\331B\227\255x\322\344\240\001EL\2312\275"
+	.ascii	"\270\0178\035\351\302a\261\266\026\006\356\275\270\236\033Qn"
+	.ascii	"\\y\333ac%\212\323\333\031\037^Qp\304hB%\210\225\231\034\325"
+	.ascii	"Sz\"\303x\3635\360\022#\246\347V\302\211H\225\217\f\234\332\214"
+	.ascii	"1\357\271\345\22491&v\363\323\344\247\3778\276-N\242\300\334"
+	.ascii	"|\r"
+	.string	"j\200\001S\3329\r\2311U\003o\005\0336\266-\247 R=n0\234\306\334\374\f\264\254\255\335dq\322J*!\2154\335\374\f\200h\321\322S3\201S\017,\226\r\222,2i\357\251\245tE\266\364\272\\i*S\353\302E\007\017'U\371\f\214&4\266d%*\024I\242\334\374\fV\240\241\225wN+t\335\224\221\242\224\345\345\354,\317\3219\3518\322\305\323\266T\006F\230\231Y\236\013\2722\332\345\3309e5I&\311l\365\270\371\030\254@F\326+\263_\373)\203\02003TI\036/RdQV\336+\263o<i\236\2545\001\363\037\247T{\302\273\273\371\030\330@\"\343\352\362\356\360\f4*\342\246Li\200Y\233&pSiN\334|\001|\215\215yPw\327\006\203R\216\255\233/\200\024O\236\364\242p\300LM\327%\3426\207\006\345\275(\231\307\031\030f\354\333\n)\263\0327?"
+	.string	"hN\234\364\300\226\352\324b<\211\361\343\353=0\234\326\203H\330\315Oc\363\376\343d/\"U:n~"
+	.ascii	"jxy\211\300\214n\252\324\302\205\346J\r\023&\036\264\301\321"
+	.ascii	"\371\232T\2013s\363/@*Q\222\347\202\256\260\231\254 x\326.Ml"
+	.ascii	"\037\221 \361\220e\206J\347\352G\027\0257\377\202'.\256<7\202"
+	.ascii	"\255\266)\23673?l\344\021!\3223b\277\366\223\007\"ZM\272\366"
+	.ascii	"\256\342\320;\""
+	.string	"U\366\244\310{Fl\336\227']n~\032\314\366\037g\207\b\326\211\272\233o\301[O\310\205\3449\373\265\237l\224\027bXH\356]\305\001\002*\230\211q\363-\210\242\377^\220^\020\ff\002[)\212\003\332R\033\r\334\302\026\035Xn\276\005T>|\364~\004\035\267TN\212:6\250\t\260\341\350\375\350\365x\213\001\207w\363\001 \247\377\036T\017\252\327\203\303q\033o\306,5Y\222q \327\330n\346\021$\206b\253\353\346\003\340\250\357\001\f&r1\376f\301R\323\004\216(\221;{\341\2655\325\246d*\031u\227\330\265\252\007tM\221\333\275\033=\034=\254\236\216^\216\336\216\236\215\336\n\275+\213\354e\365\254\202\314\244\354\233]\253z\300\020)r^5\356\022\025`J\246\222\275\254^U\217\206\005KMD5\222\310\355}\354e\365\250,\331\315\n`J\246\202\264\314\236<e\310\007@\225>"
+	.string	"V\350\277G\243\247\002\016\n\034XJ\307M\346\202\351\356\346\336\214\236\214\343\336\273M\0216\0327\277\002;\375\n\342\364+p\323\257\240M\277\0025\375\n\264\350W\200E\277\002*\372\025|\351W0D\377=\024=\024=\027\366\270\215:oKA\360\222\033\252\312"
+	.ascii	"\345U\227\245!7\377\275\024\357\005=>\237\316\316\207BCE\364"
+	.ascii	"\350\b\r\256)\212\204\224\024\242h-\236)\322\205\365,\022\345"
+	.ascii	"\234\3053Gx"
+	.ascii	"\022\201\031P\211\3144i\r&\245k\b3MR\213\246\005B\240\231\346"
+	.ascii	"|(\204\236D\240\b\224H\302z\026\211L \332\371PH5*\236\351\252"
+	.ascii	"\016\231\302$b\260x\016\245j\322\320\006\"1\251XD\2137\353\317"
+	.ascii	"L\341TK\022h:\\\321\342M\021\320$f3MB\312HGAS\005\006\213\351"
+	.ascii	"\252\352\224`\302\005@H@\002\253\251\232)\316\207Bk\nL\372\231"
+	.ascii	"i\322\232\002\223|\324\034\363\207\223a5\215x\326\263H\264\003"
+	.ascii	"\302z\026O\f\352I\004\236\353Y<\327\240\271\232BtM\372`\004s"
+	.ascii	"\005\006Oa\361\354AS\023$\2248G\020\026"
+	.string	"?0W\240\360$\002G\004\255\302\023\351\346F]\317\"Q0\b\364\345\230`\246I\031B\030\025O\025\003\251Y\342,A=1\254g\221h\204)\302\316z\026\211Rs%\236#\250\037\n\341\240\347\316\207B\275\017\205\222\216\316\241\365,\022%\035\2357\037\n!\251GH\352\321\315\017I=\032BR\217\326\263H\024\002I=\342\371P\350$\006\207\314 \260(5\327\342y\026\211Nb\360\346C\241!\263\b\250\022O`\321\316\207B%\322\241\022\351OZ~(\244\"\031\r\241g\006$\243\233\233\017\205\316\"\021\317\207B\353Y$\332\371P\250\210\236@\r\202A45a\204\246&\2142|(\224\232\253y\204\246&1h\"\204T\304I\004\206\260\232!\320\024(\"\350C\241\324<:\327\234\017\205\316\"\221\211\324\\W\240\b\235\365,\022\355|(T4\244\232i\322\n4G0\207\301\025H\374)\301$\212"
+	.ascii	"\026%p"
+	.string	"D\002\251G\370\301j\252\027>\024RQP\201\353z\026\211T\024T\340\t\301\"\235\017\205*p\002Q\210\241\3254J\201+\nA\224\030\202\231\242!\364|(\244\036\005\207\324\243 P\bH=\037\n\021K\244\352oMQ$\364\314`\375PH\00405\302Q\177<\352/\003\302\037\223(\002x\302\210\262TI\240iV\211h0o@E\2212\007T\024)\013\315\024h\022\2037$\320\013\244\250\232&\005q\326\024\005a\002HDRO\021\210%R\265g\375P\350\b\030\374\r\241\347\005Bs\005\2168\327\340\007\352\251\243\376B\230\301s\204)\f\246@\352\316\317<:\327bR:\024,\022\300\n\\\325\034\020k\321L\323\244\340\205\025h\305\360\241\220Q\222\bS8$$\236I\"L!Z\002\216\271\002\327\020:\353Y<\363Q\b\002E \241h\005T\325\f\242)R\317\203gj\026M#\375\004(\340"
+	.string	"\n`@\211\233\237u\275\220\232+\217z\241\304\t%.P<?\024\002\016\251)\252\026M\225"
+	.string	"$\200&rT\037\"\021MunT\323L\215L\021\206\301\365D\332Y\213\346Q\321\350$~"
+	.string	"d\376L!Z\202\231&\021O`\021\017\206\365C!\025"
+	.string	"!\254)p\raT<\211f\261\b\034\006/\340YUb\022\210\324\\\213f\b;\"0\323\"\f\350\210\324T\177B\363(\005\026\223~g\272^X?\024\322P\252<=\f\353\207B%P\021CFH\024\b\211\326\242Y\004\036\245&\222\216\352S\002\005\001=\213'\022\320\372SK0\217\316U\257\251\271\006\201)p\030\374\255(*\302L}T\337\372\241\320\020z\232HW\363\310$\232\353\006\f(\250\300\022\212\350\271\006\213IE;\346oMQ\020\032\316\034$\365HE2\272\260\002Sa\022P\304\257\004*\002\205 \220(B\203\272\246(\222N\n\303\237\271\002\205HI?\240\020D\340\231\232\352\317\372\353\340\203\371S\215\200\304\021L\242\b\240z\212"
+	.string	"\314\240\376vR\030\376H"
+	.string	"M\370R\030\376|R\030\016\203+Z\304\260~($<\221\202\202\032\270\352\257Hx\"\225 ,\221\025\301\216`\205'\022N\315\225x\026\201@J\022\026O\rl\3209J\n!<\221|\305\263\204\365\003\341\211\344c\022\215\212\037\020\315\021&\261\007E*!\001\234\013k\320,*\372YS\023\251\204\371[\211\347\372+\242)\234):\f2\205h\t&\326s\0040%\341\\\213\300\236\023N\320P<\201$\244\350\nL\315\f\252\360D\372\t\315\324\034\256@\263\310g\002\0304\205\277\363f\035\032\235&\211_\252sH"
+	.string	"9\300\323C\002\310\201UEQ\0200\230B\364(5\203\300\364g\026\025y.@\002h\342\002\321\f\006?0W`\352\023\032\371\b\211\350P5\323\341\372[\213'\212\264\232j\220yt\2569&\200DS\250\223\301\\\201\351\357G-\232HGh\b\302\023\304\n\0241\342G\230\002I\244\350\bB\323,\002\002A$\302\017\b\"\016\024\321s=\325\"0=A\204\265x\242 VS\325@\002h\342\327\263\236Gg\005rR\030\376:PU \022\t\224x\301\250x\016W\024=R\205\2775\005\036\251@&Rs\004\0324\323\237\317\267\252(*\342\007TD\317\025\270\242>\023\311\304\352ST\204\256I\301\337Qj\256\247\216I4*\002\203\324\263\004pC\361\004\032]P\217~B\2409\004\242\200\242\304_j\026O`\272\376\3204\b\244\240x\002\215|.\244h\232\232?U\004p\303\317T\2230\224"
+	.ascii	"\022\315\364G\002h\342'4W`jd\256\3053\303\017C\271\026\223\320"
+	.ascii	"\340\217H4\203?\244\037\272&\0017|(\244\022\321t-\242\301_0\035"
+	.ascii	"\n\026Y \302\007\037\022(\32174:\207=\302\017D`\272&\231E\234"
+	.ascii	"\237\360\203\260\b\024!\004\232\302\037\022(Qght\016\177\302"
+	.ascii	"\017\353yt\022w\204\037\204\246\332\303\263~(\264&!\255I\350"
+	.ascii	"\357\210\004\322\220\232\232#\316T\210\301\372\273Q\215\200'"
+	.ascii	"\240g9\302\024\301\\\201\027\330!\242AtES\020>E\364TSsD\221\350"
+	.ascii	"\210\304\205#\022 \204f\260hB-b\300T\223|+:TEX\3254\t\004SM\342"
+	.ascii	"\031a\n\261\231D\004f`5\325\242\"\023L\242\220\210\b\\O\243S"
+	.ascii	"\250\241x\036\351\230\304uE\323\341Z\002x\244\263\376\024\340"
+	.ascii	"a-\236IZX\004\036\035\241\301\342y\224\263\026\223\320\020L\""
+	.ascii	"\n\302\367\241\320\320:4:\211\025\360\230B\264\204\324,q\036"
+	.ascii	"\341\020Q\024\204_Oh\252\2519\302L\177*\t\240\211\237\265h\006"
+	.ascii	"S\023\351\227\242+z\364C:\211EC\025\230\0067|(\024<\212d\246"
+	.ascii	"C+\212\246C:\352\317\350,*\242!\034\231\253jB\365\2250\205E\""
+	.ascii	"\341\211\324s\001s\304\271\006\201\027\214\222D\230\302\0345"
+	.ascii	"x\256\352\271\002W\365\207\202\n\\{\206\301\365$\021BEA(\300"
+	.ascii	"$\236Eh\n\302\\\201)\020\nA\224\030L\315\021\350/\t)\310c\036"
+	.ascii	"\235'\230A`J\202Q\361<J?(\232\220\232$P$\r\353\217\001k\361L"
+	.ascii	"\272\271\007\017!`\200\001\013\220\240\203B\353Y<\177\301\242"
+	.ascii	"\241`\321P\361\004\036\r\005SuHh\203)D\217~\251IL\022\232\303"
+	.ascii	"\240\352K\201\303`N\315\263\350\\\213\246\220H\230\002Q\021="
+	.ascii	"\377ol\364\242\370\210\361f\243\006X\357l\212q\207\225\212{\365"
+	.ascii	"\205GC\215g\303\371\330R\241\252d\323\205\306\211\031qu8\206"
+	.ascii	"<\221\221\325C\223\361\343I\225\335\315\2209\252\245\030\231"
+	.ascii	"I\236\322B\007\n\252\274\236%qxf`H\335\032h\356\222S=#\276)\001"
+	.ascii	"\205\333\250\323\001\025rPVB\210Q\205"
+	.ascii	"\020BD#\263I:s\026@0hD\"\321\305\315\327\003\023@\204\315\352"
+	.ascii	"\324q$'\241\243\221$I\241\375\f\3330\273$\223'<\237\323\024\233"
+	.ascii	"\332\216\306\370\316I\323#\220\363#\262\025\262\346\300\306y"
+	.ascii	"\212\032*_\335 \375\227\001\027p7\030!0k3`\352\024\315\211\030"
+	.ascii	"/R5h$0D\262\241O\244e\326\212\224<\022\030\313\0027\244oN\036"
+	.ascii	";B\2337\017s\\y\353\272\250QqO\362~\034\275\276\362\346\255\233"
+	.ascii	"\364\006\3214\036\305R\255\307.\303\254\317zr\322\003k\303\\"
+	.ascii	"3\177\217:\304\372\314c$\371\245\021\370\333\371\351\263\372"
+	.ascii	",,\361\341]\354.u]$\241\3651d\025(\225fm\362H\034\304\246C\226"
+	.ascii	"\362d\013\201\371\003j\"-\343\301\376\177\354\364\033\231\266"
+	.ascii	"\215\2705\314\342/#^\212\275\302\022\355"
+	.string	"\355=\233\300*;\302a\001bF\317J\003%\231\214\343y\305A\367\007CL^\030\317\213\364\321\353i\025\244\215\311Z\\0\361\213\322\"\245\361\235\n:\3608\235\315#\260\313s:F5\272\245u=\013\242\365L-9\207\211k\374c\354\0178\202?\001\255\034\025M,V\022\365\336\227\331eT\035v\016\305~B}74\272\317_\003\327`\200\303\316\020\350\301\274'U)Y\013\021<n)\234p\037\354\375Zp\0138>B\235D1o\2008\006\211ilFe\013\027\3261.\206z\353\205\246\f\233\324\232r\366\002I\363\212|T@&\216C\257l\2378+\322A\255\026E<\013\350O\215\217\200S\252\212\222C$\224\231\326y\261\223s\362\260\016|{\240\321\304 \222f\2209\017\361~\256\247\215}\341\231\316.\237w\312T>\234\",|\360\022\212\006\005\240\376\334u\225@\325\"\346\242S\251\336O"
+	.string	"(\ti\005G\275/\307\b\021\206$\265 \312o\344r\213\215b\266<Q\266S\364\256\200Jf]\244\253\242f\322Df\216g\026\207\032\325\232\317\2551.\345\005\221|\366\352E\272n\321\200\223\250_\300X\341E\t\377\255\020W\3530[4\257@VU\315\205L\346\004\213\314\276\227G\331FO\177\345\301\314#HR\327\030(I\235\005\352\220!\377AO\216\365\b\274\344\004\272\3223dv\237\313kEa\220\001\226\273a\205\311\214a\037b\026\360S\022_b\336 MGp\016\037B\353\017U\235g\224\r\213\214\006\261\013N\320j\252\322+\027$#\313\243{5s[W^\257\004\005&\213MNy"
+	.ascii	"\225Xr\3417\300\007\341\350\367\247\256\311\211\021\222\322?"
+	.ascii	"R\300\305$\2713"
+	.string	"\230\005\"\357Ru\324t\234\234\256Q\276B\027\362\306\005y\375uz\304\371\345Jm\031\276\2120\353\235\273j[\275x\003a\330s\313k \3677\305,c!\246d2\315\214\241\303u\013\352\232\343{\252\271\006\005\034\205\360\r\201\233\316\307\304\253\222P\213\371\225&\222-\254\361\244\032\221\252\r@nR\303u\233\247\255\026\272\036\r\217\321c\206\345\3061/\310\213\212\256\026s\326\007~\352\026\311\224\006\222\217\004UBxd\177\200\003\327\206\211\204\222H(\031d\215\216\325\350X\327\343\240\354\002\3606\200\323\375\f\215N\260\227\330SF<\200\362\220\005\304~\277\235\031\025\026\002-QPB\034\210\020Y\256\006o\030\235IK\343\023f\016\023nM(\206\247\230,\334`\323|\027\227\224\323#\rU\033.\332\024\220\016\022\243\323\205\036=\376\332\2669\023\347\246\026\020\214\310\2326\340\2076N\336%^Y\312uH"
+	.string	"e\301\367\216\356\357 E 7\fy\353\017O\324T\220\302\2147`g\350\270pD\036\364Dl\020\030\331#=F$\343*\304\272u\205\013\361\2107\312\376F\325\264"
+	.string	"\372\354\023{\267\020\347\352D\342\204\013\036B\236G\255s\271\254.\205\352\003}[\033\316ll\206\3035\254\300\254i\305\251\320$\020=\267\251\"z\263\311\341x?\030"
+	.ascii	"\252\215J \227\316bM\0279/\376\334\237\265}\306=M\345&BfNFz\264"
+	.ascii	"Z\020R\036\336\020\364\0010Ko,\204.m\002\207&3\231*\352\031/"
+	.ascii	"\334\310g\022\244H\263\001f/\201\342\242\177w+\365|\271$S\352"
+	.ascii	"\315\273\261\304\355\335I4\307u\033\241+J3n\036\3779( \312\277"
+	.ascii	"\242\352\241\275\353\034\032L\221\3048\017\220\262\277=`\342"
+	.ascii	"\247S\261%\310*M\333\013\214=\325Q0\262\026\004\361\335H\200"
+	.ascii	" \275\013Q\246\376=\3261\326\025M\260\335\321\253\225~\302 \312"
+	.ascii	"T\366\317\036\317_\272.\270\366\214I\374\034\0334\232\302\222"
+	.ascii	"\264Q\336\342T\016\005\343\320?M=f\220\221\007\240\305=E\004"
+	.ascii	"\325\240\3154\347\337 :\215\313ORg_\221D\205\251\003\306d\327"
+	.ascii	"20\030\030\376\310\217"
+	.string	"\263\330\202Vi9d\247\210\357T\005\026T\337i\224\3667\276\233$\030\264\213\347\361\236\246nZ\r\246;`\266\270\035Xw+\241\327\336R\002\204h\235\255\317\236\030\261\324\223\004\024:x\274\240\227\022\202NW0o\212\322\205)\250\225\357j\310\361\223\261\f\t\275\264s\356/\331^\226Q\035\263\211\320\036+B\320d\301\016h\240\374.\353d2\222\363=2\n\0242\254T3]\325!\2255k;|x~\233\352\t\020\347\340\317\223\267\304L&\222\215\376\251\007\"n\307\023\330\023\003R[\t\356\246\203\032n:\366Y\336\241\210\325A\013S\270/\341\217^\270\252\352c\326Z:X\271O\226\031\257Q#<\264\030\237\032H\206U\205/5\232\322f\376\205Q\317\307\272_LU\234\201\202\355\222(\205E\240\220\311K\360\236\034\024\222!)\027\232\001y\355\"\311\202Zx\177\374\254\177\320>\362VA\317w\""
+	.string	"\341:\275\023\307\322{`)"
+	.string	"\020j\372H\263\322|\027\266.\216\276>\3364\312\216\003\220B4`\353\213P\363\227\0325\350L d\0242\202bW\220\340*\262\220\334\214SRbP\330\317\242#o\346Q\257Z\313\365\324\211\246\177\200\256\177\300E\220\265Ot\226{\003Zu\362H\254\351F\017\326l\335mAk\246\203d\253K\341\362\326W\241\225\227\363\022\256.\345x\f\231\027\236\211S\250Xo\261,\016C"
+	.string	"8\021\205F\312\tD\367\201)\211.j\271\266\202n\221B\315\323|\346\237\352F]\225r\316\227\216\336\244\215^\035\032\273 <=_\r\225}J\262\330W\324\013\276\350-<\233}\204U\265\307m),~\030`5KM\311&\3742\351\203|\241\323\366\241\357\313\311\004\t\305C\337s^\001\347\342\227\367\357=J`v\rh[\244{\216\321\204\226dD\212\033\257e\265\362\326r\204\263"
+	.string	"f\352\\\262\275\022X0D5\236\021\365F\237,D(\366\0162\323_\222\255[\306\177C\234\305&\223$\246\2262c\3054l\217\\\350\310[f\270\323p\320\031\310\316\214\255\324,-\226\215f\325\275\227\375\373'\004\261\325\324z\023/\224\215\rQN$O\266\256^\207\205?\230\002_Bx\200\223\333\2633Q\356srE\234b\371 \031\344\271fOC<\333*\216\341Yt6IG"
+	.ascii	"\233h\360\375\237\246\024\031;+,\"U\273iu\f\251M\233\344`\027"
+	.ascii	"6\320BQ?\361G=\271\022Z\245\353f\356?\206\203\034i\337\251aO"
+	.ascii	"#z\216\023\330\302\320\205\266Q\361\3545\356\210(\n\274\027\204"
+	.ascii	"\312z"
+	.ascii	"T\312\254\363\023a\305\237\330\331\322M\320c\b0\212kxH\360\032"
+	.ascii	"P\237F:51\365\347g%\350H\374\207\"T\"\001J\237uY\354\343\032"
+	.ascii	"\302\301\341\232jx\271\222\253\305\304)U\243B\263\007[q\300\344"
+	.ascii	"\017\344S\227*QG\377\241\301\306\365\353\332\221\231\337\305"
+	.ascii	"&H\370mK\344\205j\302#\277\224\221i\035\030\346\224\f\221\023"
+	.ascii	"\261\310\\"
+	.string	"\3707N\342\f\3727#\216~\005\276\377\301\337\365r\326#P\013\273\264k+\023\373\340z\240i\346/\263\026C?]h\360\330\245\237\302\370\347\2658\256\371\347\301@=\366\252\246-\257X\b&|\231\033\323#\210\342_\rK%\374\024\350\253\374U\315\266\342\fx\3708\2500$\031\037\2368\252\247\363\37181If\3352\245\374:Dk\375\2117\307T\331\306b\036\362\244\313\304\301Q\267!V\224\356\256\035\366\035\301\2331Z\243\005\363\257\"\351\"T\226\276G6\326\207\311X9d\240b\355D\344y\245\346\214\356\327\300\035\324\037n\032V\237w\315rD\360\346\334/pk\247\345\334\003,y\242w1Z\330~\251n\247\005 \337c\302\213I\001\265\027\246_\232Q\3045\275\253\271ys\b^\320\206\250\024]\022\304\030\r^D\253\272\374\275\2228\362U\205\001$\275\0256\f\331\245\210m/\350\307gI"
+	.ascii	"\301la\370\177\212\021g.=\236\002\232\2539\300b\377a{\321\315"
+	.ascii	"4\214\277\006O\343\202\352\235Wgj9\227\354\262T\026\035\031\301"
+	.ascii	"\256$x\246\262x\231Cl\002\3608\357\255dK\330^\244*G\024\004D"
+	.ascii	"\302\365\223\311\306\034\217\306}\n\017\344\224,\221\242\031"
+	.ascii	"\016\305\256\n\232\256\037f\255f[+$\373\317 \364\031\334\025"
+	.ascii	"\2078\262\363\310F\030.J\311a\356Ot]0(!\r\235\227\373r\355{\327"
+	.ascii	"9\"wg\0131sJ\321\005a\2606\335\213`\207O\202Ck\300\211\224\004"
+	.ascii	"X\304\344\272\002\305\344\373\213j\336U\356\320>\312\021\314"
+	.ascii	"J\245q_\007\210\201\032\205\220\246{4\320\205#\365cR\203#\300"
+	.ascii	"%1\204-\270]\020\036\203\251%D\215\206\267q\224\246\030O\204"
+	.ascii	"9\270\225\264\005\331\3526Y\252\347\362dC\025_)\241\325'\217"
+	.ascii	"\244\211?cq\255Z\375\034\306^K\\:\272\013K\257\2210\201\311\301"
+	.ascii	"^\217\274\360\026\211-\"\024\363y\304\365\235m>?\005}N|\2712"
+	.ascii	"\215\326P~\006\255\360\203\200\027\t\006\207\313\035W\320\212"
+	.ascii	"F\276\030\210\266\220\025c\271D\007*:\3741ot\022\022e\033\200"
+	.ascii	"1\024\272\341\224\b\214\005}b\017E\tR.\323\301\f\265-\342\013"
+	.ascii	"\303\321_\325\374|\333Z82\030\027?\017Z\356SyN\367\332\307\301"
+	.ascii	"\305\377\312\316\272a\224\237\251\032\037Rz\363\366\232\252\277"
+	.ascii	"\244\370\341\355!\276oh\237P\275pXP\300\244\354\356\247:F\313"
+	.ascii	"\265\377\3457\233ro6\204\317\336y|\333\226\300\374p\355\217\336"
+	.ascii	"T\335\036!\340\273\223\215|\363W\344\370\335\335,\327\266\231"
+	.ascii	"\221\f\233_\027\267\234\345\r\266\360\017\335\343`p\363\266Y"
+	.ascii	"m\331\214P}\214\270\340cV\0340{\350\n"
+	.text
+	.section	.gnu.lto_.symtab.fe8176f817cdd957,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"srxlDisplayPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fe8176f817cdd957,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2578 @@
+	.file	"fc_rc.c"
+	.section	.gnu.lto_.profile.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`o\005\025\026"
+	.string	"V\230^H\340\262(\215\0018#\031u\313\331\333\277[\027Iu\"\314Z]\307\270\237:I\256\222\002\f^\030L\367\304\0200\306y&\306\fs\234\262E\344"
+	.string	"M\314\377\377\377\0370@\340\277\r\344\253\355\307\376\224\266\033\331d\247M\002C"
+	.string	"R"
+	.string	"J"
+	.string	"\245Q\236q\321\211\215\234L\244\241\310\223\222\336\275\275\367\375dyZ3z\250\250[\327\213\366\"GO8\024-\343\335\235<\316\035W\215J\364\250\t\211\223'\b\207\305\303\267\267\247\227\323\242\335\330R\266.D\f6\212\343\304\316\317\202m\004\313\016\031\n\022 8``\364\034=\271\371\374\364\351zU\331 \031\0225\004P\006\b\bp\022\273\037\032\213\017"
+	.string	"\023y,\031\371\304\332\253\275r\f\255\266U\001\344\002RM\032Ad~\244H\274\0251t\334|\3224\274t\365\232:\265L\035I\252\004Ai~f2\025\n)\023$D\200C\023\334\215\177\323\277+\\\2315d3\035\b\246a\267;@b\265\007K)\253\324\242e\023\343"
+	.string	"u|.\354\005L\212\006[+\254\250)\352\2550}lj=\001\333\272^\264\227\017\337\265\344\002k\211\361\360M\273\030\203\301\311\351\300\211\300X\2611\343"
+	.string	"\013\210x\b\r\221mX\272\250\241\361\241A\222`3&Pd\300p\201\3438\223a\311s\326p\326\265\276\032\2566\276\252\347\"d\313\320\215\220\205\200\263\250\361=\251\021!IJ\351p\202\251\252)n\021\360@\245\244\"\031\005I\n\205\016\345tL\312\373\3209\212\212RuN\225\267\344l\250\310\362qi\337OP\217\216\241\2443\r\rH7\263\340z\372\240\0224\21710\tq\264\363\300\311\312\035\017\364\r\035\276\357\244\351\2040K8r\375\255\312I\225\337r\242L\262\373\370\b]\271\031\267\035X\311\036)\303sx\006\356\007\203G{\322\312\210\312\320"
+	.ascii	"\200\342R\262\300\362\3622M\0168X\367z 2\320\245\226\361\227"
+	.ascii	"\221v\370\266om\217G\317\375?\354-\037\022\257\267\004\\\tr\303"
+	.ascii	"\261\302\266\231%\0355\003\350\354\340\256\205\367Vp\277Y\321"
+	.ascii	"\354\2053.6J\"\242\276n\024\025\f\221\374 .O%\235\356\222?\334"
+	.ascii	"\362\217\361\254{\222\021b5'hd*\326u\213\024h\234\243<\001\320"
+	.ascii	"\262\3166\257\343\270p\275\3631/\032\251_\243\236-\210\242\352"
+	.ascii	"\231\301\237\b\375\2056\2246\247Y\322\344\334]\233\355\305:*"
+	.ascii	"p\346\326u?\204\372\331I\030\021\237`\345\211\027n%\316&\360"
+	.ascii	"U\200c\237\0328\360\316]x\200_Pk\365\342\350$\224\212GN_wz"
+	.text
+	.section	.gnu.lto_.ipa_sra.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\004"
+	.string	"\242\005\020\025 \261\322\001\177*\b\224\262\007\356\276Yt\230<p.m\231\002\356c\3076&c\027S\2018\314\260\005\302\006\276M\260\201\252g\001\242\205\366\331\3444\314.\265\325R4Q\207\350v\355&\227\b$ \240\0029\033;\013\022\276\323\360\006\216g\003x9%\307\3265K\311h\340\210\005\021\204\223\303\333\006\004\203p"
+	.ascii	"s\205\r\254\334\250\206\305[\230Z\262\201\373\0066\216\301\364"
+	.ascii	"\270$\032\"\236ss4\270\230'\311\302\222\304F\242\225!"
+	.text
+	.section	.gnu.lto_.inline.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`?\b\325\035"
+	.string	"\246&\205I\300RN\032\003PP\275\321\230e `\003V2\264\rb\215\r\206\304:\002~6A\210\265c8Q\210;\260\251Ih\325\253\037-+\255\337%[4\274j#"
+	.string	"\214\020\325\276\221ZM\376;@\376\351\350j\222'vo\271Sm"
+	.string	"r"
+	.string	"n"
+	.ascii	"MA\"\\\362l~\353\215,oN+&%\024\026h5\233b\213\352\004\204I\276"
+	.ascii	"\365\002\210\320w\373DE\20453\032\002\004\301\374\307\225K\036"
+	.ascii	"?\034\\*\317p]\335^\255\265F\3679s\362\232\234\333\303et\350"
+	.ascii	"t\335\334W\267\265\326\n\376\314\\\232\261\243\303\013\354OY"
+	.ascii	")\377\003+\367GY\371|\322\354\017\321\025\214\225G9\346 UR@I"
+	.ascii	"\274\360glhN\233rI\326\026\347c\276\t{\326\314\032V]\\[\335B"
+	.ascii	"Yv\372$t\262\310q3<\227\274\335R2\372\212\275\262\003>\315\372"
+	.ascii	"\262\252\242\344\320\356\343\206\212\017C\255BK\321M\024\003"
+	.ascii	"\263\200$ \263\343\016\366\311\267^8\025\303y;\245\341k+\245"
+	.ascii	"\334\340\002\254m\216\234\276Z\353l\223\243\212Lx]\330\2374\323"
+	.ascii	"\003\215\322k\252\373\355t\204\212\241R\304\024\267S\331\233"
+	.ascii	"\346|t\331\223U\326\030\3336\335\0241\021\017\303\001\313dHs"
+	.ascii	"\232\254\316165o\221\217\013#eu6\220?\201\240\215$\241\034*+"
+	.ascii	"\370e\357\246\310\tv6%\t\275\365l\347f\222\220S\026\354\265\275"
+	.ascii	"\030V\n\210\251I>.\263\276\035_\234\270\370\346V\356\246O\t\251"
+	.ascii	"\037\001O3\003\317v\035\242\253\030\261ap!N\304\215\357Dp[\344"
+	.ascii	"8\316\024\300\025v\266\233C\265\352\304\246\320\003\376\315D"
+	.ascii	"\342\t:\312\271\231+x\202\216\\\236 %\350\300\027\233e\361\333"
+	.ascii	")\332/\233I\202\203\216\0262KtY\216\254Ln\210\236\027?\244\017"
+	.ascii	"\204\220\"\247\265\304\007/k\246\017\226V\327\216\330{\374d\374"
+	.ascii	"\244\321\f\376\335\234\252\265\226\354H\013\350K_\232\203M\003"
+	.ascii	"\200\302\250\021E\307\b\315\310H\222\202d\230\003`\002\031\""
+	.ascii	"\242\262\003\022\300\0045\206\303\f143\"\222\322\244Fi\032\003"
+	.ascii	"\230\003\216A\343\234\nIo\t\265\276\306\275R\\JH\004\251\202"
+	.ascii	"\310\264Z\332\026\341\270\304N\231\213\302V@\351\350\247\263"
+	.ascii	"\365\303\"\215\240R\237%n\305&^\254v&\304j\303I\207\323\025c"
+	.ascii	"\227\35675\347\001"
+	.string	"\024\364\025hQ\t!Z\330Q\3460\005\340V\205\353\325\3629\220\245\324\202y\f\024\203S\2241\363\247\247\372\273\311\211FOb\317\247~\013\220\270$\013\252\013\262\240X\364\316:\274\232\210$\022-\341\0045\223X\360\315l|\t6B7-\264Iv\002\234I~\344\3633\376\342\0257\354\330pe\226\024*M|%l+NS\322\"m\023\323\2103i\246\243a\316\205h'\217\013A?\3368\0242\215`?\261\373#\367\264\245\210\020\241\277\212\377\3455\324\0061\366\007G\333*\224\217\247ex\277\022\003\304\363P\377\275\356\220\036K\005U\374\234\205\221\035\274\2032o\246!*D\214(g[\206\211\242\344\270`#\370\222.\212\017:=0\310s\024*\261?d\330\nk\024\3424\274\026$>\017]\300K3oP\234\263b\363rB\331R\342<\252\214v\222\022e\203a\\e/\356\017\036\303\301\231j"
+	.ascii	"]W\300\261\004\254\306\r\262b\031\202\321\035\020\302\333\203"
+	.ascii	"\342\250#\3739\254F\300\035\360\202\234\240\332\022\367\230T"
+	.ascii	"w\002\220iZ\032R>\2617\b~\356\346P\351\333\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\246\003\215\f"
+	.string	"\022\217//\200K\322\0013\020\362\240(\035\024\021\266$\220)\026\243\352\215r\210!\001\022J\022\332\321\315\334\013\344\267\355\363\350\237\f\264\026l\233\310\235R\nm+\032E;\321J\264\021-\204=\374W\304\bA\016\361%\033\311\346M'\206\375\016\2758\212\234\032\007W\232\311e\267\033:\262,\276\021s\203\253[\234\241]h\317G\341\271\240A\354\017S\336{\317\316\215u7o\254\237W\325{\177\022,\210\320\251\255\264\254\225\006\004\002ZT\360lO\212}\b\240\216\343\344X\177\233k\316\331\261~\215]{\f\347.\246\2772i\3314fj\314\270m\342jOe\253\023<\331Sz>\330V\225\212\031\001_\250\201=5&MA\222e\rP\0021Ne7\022@\002j\004\204xT2E\"\241\024D\373\317\001\203\033\033.K\177\220P\346H\354\002U\213\201k\023\221\375\363\357+\033C\304\206n\027"
+	.string	"\221\320\226Z\270\362\364\352\366\253\373\244+x\221\3610\200O7$+\2006\025h\211\362qL\2505;pV-\246\331}"
+	.string	";n\365\326\320\267@"
+	.ascii	"\343\230\201\262 \246\016\264e\\m\246,\245|\367\362\331\202\275"
+	.ascii	"\005\332\350\202\037>\331\351\340\2000\241%(\233\211\222\024"
+	.ascii	"\203\347\202\357\222\r\030J7\024\200\360\367,\277hQ\345\360$"
+	.ascii	"A0\\,NF\202\242,\033\272A\327%\307B\202\253;[S\310\025<\220\233"
+	.ascii	"V\221P\"E\b\240Y\025\023%\003z"
+	.text
+	.section	.gnu.lto_.pureconst.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375 \\\205\002"
+	.string	"\302\005\023\035p\211\322\001\251\3701\372\377_W}\004\300\326\203C\025\035\373\376\241Y\007\246\357\345\007;s1\0253q\0031\017\327p\013\227p\007Sp\003\027p\253\0315\233\2564\243\t\3155\237\351\334\3462\263\345*7\271\310\355\270\335\272;F"
+	.text
+	.section	.gnu.lto_.ipa_modref.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`E\002\355\n"
+	.ascii	"\222\317-.pK3\034\374\037\375\377\032\263\376\277\252\222\376"
+	.ascii	"\377\177\373Nq\b\037\216\332\232\265\211\326f\255\331\354z\333"
+	.ascii	")$R\007M\223\004\270\250m)SW-F/,~VP\354n\236\022\021\235\031"
+	.ascii	"\210\316\207r\253\230B\0317/\345\2276\313Rn\221\232\253\316H"
+	.ascii	"y\244\262Ey\260y3J}v\366d\017\002\275\007]\363\367\236l\3366"
+	.ascii	"8\375\203<\032s.\225W\345\204\022\267\303\204 EQy`\320\200\261"
+	.ascii	"\200\241|\201\300U\312)e\007'\256\200\243\312\251\266\347T>\351"
+	.ascii	"|\345\2573*\227t*t>\312\037\005\370\035\007\003:\023:[\336\366"
+	.ascii	"w.\347r\260\366\300\r\023H\250!Y\305\250\002)L\255a\016P\002"
+	.ascii	"!\246\352n\022\340eD\2122\215ML\205Z\\\255\237\001]\262H`\006"
+	.ascii	"\246\037\300\220\364H\b.\234\334j#\222\273\021\264X.\250\335"
+	.ascii	"\242\312]+\320e\005\320\312 _\027/=\271&\347c=\n\232edA\007v"
+	.ascii	"x\242\356\302[\035\223?{7D3\261\322\3238\316\233\234>D\244x4"
+	.ascii	"\334\232v|:d0\035\300\275\354\021qH\273m?\243\254d\220\336\n"
+	.ascii	"r\234\241\236HZp\337\275\303?\333\273\325\316\027\307\007\310"
+	.ascii	"B\023\b\334I\035\327\277Q\255 \360\004"
+	.text
+	.section	.gnu.lto_.lto.b05ef73e95f984df,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getSetpointRate.86.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\335\007"
+	.string	"B\21766Po\322\001 \333\244`\264V\017\210\027V$xW.\023\t\205[\031E\263\210V;\371\350\223Cf\231\321\236\231Y\306\350\304\242e9b(gfm\333\336R\246\024ZH\342\363|y\256L\341\002\305\013\024\033B\037\206xeZ\364\b\030sX\310\342\003\206e\261\323\355\337jI\325\242\320\212\211\223h\233]\r\004\177\344)\b\353\246CG\210\362\334\241/R\216*\225+\273\033\245r\330\177\253%;\323z\324\237O\003\3222\260\332\275X\305,\013T}\330\336\354N\036\345\025sv7N*\273{`\202\315\241m\377\364\220\315Ny\235\207\351.(\026%0\273\033\255\007d\016\337\0012\207\332\361\355\271\371\027\371{\3110\341H\243\247&aw\235\034\t\343\326\333.\260m`\373$\013"
+	.ascii	"2\241\237\037\030c\242\f\341\034& \327\360\"&\234K\030Q\341\006"
+	.ascii	"\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_getSetpointRateInt.87.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\345\007"
+	.string	"2\31767Po\322\001 .v\265\n2\331\210\b\331\223\246_\301DB\341VQ\211\020\306\206Z\310G\237\0342\313l\273\310\3144F0\026-\313\223\004qSk\226\354-wJ\001\031H\302\003=;\023S\230\0379?\262\001\344a\220\023\313dG\300\227\303\002&\037\256\013\223\234n\017WI\252\026\205VL\034\225iv5\020\374\221\237 \254\177<:\"\364\276=\372!\335\244N/\306\356FO9\354\303U\222\365\246\377\301Lie\200e\367\"\006fUb\n\304\266\310\346\330~\357&\243x\263\273Qr\262\273\007&\320<\332\366C^\022Y\203\235\007W\241R,H^v;i=\240z\204\007\250\036\265\343\332\237\346_\344\320%\243e\343F\177\231\204\335\365\3338\214[o\273\300\266\201m\223\013"
+	.string	"2\241\235/p+\312\016\013\3270\001\271\206CL\340IE{*\244"
+	.ascii	"T\032S;\311"
+	.text
+	.section	.gnu.lto_getRcDeflection.88.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\305\007"
+	.string	"\222O64P\217\032\003 \333\230`3\f\271.\241\"\213\267\206w\222\032\0212\212-\007!g\317\005\263\305\210,+HUU\035\242\263\202\250\363\020\312\321\255\265RJ\231R\242\220\304\007vz&\2460Ar\202dC\350\303 '&\222\036\201^\016\013\230|\270.Lr\266\033\376\235\336\353\224\036\305\204E\272\322\374G\250A\034\002Q\243\034\0331r\326\034\353\321\333\260J\256\325n$\3674Z\303\377\357;\265\316\365Ye;\2309Q\031X\375\026\255\227\247DVG\333\254\3458\253j\322\315\237\221*\371\177P\002\215c\333:e\217\254]\301\215\003\345\025\226\212\021\227\377\262\343"
+	.string	"\214#4"
+	.string	"\306\361m8\263\313j\177\030\266`\240h&\222]&\341\177\235f\272p\237\333\026\2645hK\022\n"
+	.ascii	"2\241\241/p+\n\036\026\317a\002\n\230\342\022KT`\003P\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.89.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\335\007"
+	.string	"\222\017770\217\222\016$$\271%\310>H\301\033b\362\270\253\224O\232\314Rm\003\373\314\332;\262\215*\331\264T\254\303a`\300\210\307\301\326[\266\3027\032"
+	.string	"\3777B\210L\001$\221\004\b\236}2M!\013\305,\024\033D \206\230i\244\370\021x\344\260\240\305\207\321H\213\235V\026\346S\275\3479=\212\377\211\216\354\332d&\302\r\251\b\304]\025;\242\344\212*vK\217srr\257o\231\334\323\370\302|\252w\356WV\353\240\246Ee\340%\323\342\025\223)\330I\307\277}\307\2255\312\234\314\f\226If\036L\260)\366_\217~l\357\202-\216UWX*H`23z\032\220)\006\013\220)\3666\272\325m\267 \205.\030/T\312T\247I\310\314\035*u\321_\377\202\337\340/\t\n"
+	.ascii	"2\241\241/\260ZQ\034&t\327\360\"&\234K\030Q\341\006\240\362\230"
+	.ascii	"\332I\006"
+	.text
+	.section	.gnu.lto_getThrottlePAttenuation.90.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375 \363\235\006"
+	.string	"\322L.3Pm\222\016\204\263\323\220\002H\215\317\362\f_S\314m|\251)\360\370\213eko\n\255\340F\340\270;3\263\331\351uF\330v\th\363\3417\322\310\226)S\031\312:\2404\217\322<\006\005\204\205GY\016/#p\325\220`\275\207\252\262\336%\3136\0176\f\247E|A\232\035\272\237!\006a\261\272;h\252\303f\251\340\340\350\263\r6\214\257\224\315\363\305\261UD%\003#\231\023\243\224$q\"\033\377\365\227\333Q\217\353CR\246\361\251\211H\"\004%3\037\246\001S\235T\200\251\256e\364*^\267\037\2258.N\260\316\246X1\310\314\021\353P\364\326\277\340'\370-\002\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getThrottleIAttenuation.91.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375 \363\225\006"
+	.string	"\322\f.3`M\222\016@\203\350\234\320\325\3539L\300!\0025P\242p\207\355Ri\206\265KYl\277tV\324a\213\202!P\b\022=h\217IG\031\2154\262e\nK\030\211R\2202O\312\274\207\206\005\207'Q\021\017S\360\004\301@=\211i\242\236\345\312\266\016\266\313\246Q|Ez\215\335\317\023\227`\255\272{IT\207- c\203\331_\032l\033_([\347\213c\023\300@A \311\264\310V\362\304\231t\374\325[\356GA\252\307\240\313\363iJV1\242\222\231\357R\202\250\016\352@T\3278Z\025\253\333\220B\036\036\314\342h\212"
+	.string	"\t\2319Z\234\213\336\372\037\374\006\277F\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getThrottleDAttenuation.92.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375 \363\235\006"
+	.string	"\322L.3Pm\222\016\244D\f\202\215\252\245\035\225\341k\212\271\363v\250x9\242\027\313\326\336\024Z\301\215\300qwff\263\323\353\026\302\315$\334\032\002\333H#[\246S\031\312J\2404\217\322<\007\006\205\206GY\020/Cp\365\260`\275\210\252\262\336%\3136\0176\f\247M|E\232-\272\240%\016a\261\272{h\252\303\006\200\301\301\321g\033l\033_)\233\347\213c\013\32009@\311\264\030\255d\211#\351\370\257\277\334\217\202\\/\222\262\017\250'\025\024#*\231\3710\035\230\352\244\nLu\215\243W\361\272\r\251\344\361I\301:\233\242\005!3G\254s\321[\177\203\277\340\317\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.95.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\340\006\225&"
+	.string	"\nE\b\017J\220\330Q:\2213y\226\364d\317[\304J\366?-\315\025\377\314dRBj\274\340h@\317\006:\243!\336l\337>0J\325H\300\033\375\006Y\205o$@\025\276\021\360\204nz+\240?\262\215M$!\220O\b!\204\310\235d\333"
+	.string	"\307"
+	.string	"\336"
+	.ascii	"h\nf\365I\370X\254^\255H\212\n\242\001}i\231\217\370G\216\204"
+	.ascii	"U+\036\326~\263\233\364\202H\360\202\021\036\242.\224rV\257+"
+	.ascii	"\343\275w\301K\246\320T+\310\331M\362\325h`"
+	.string	"\205<\214\262\205x\357\rb\005\267/\322\202\323{\241\264\210\367\376\202\030\b}\311\314|!\037r\304<$\205R\300{\371@:\022\346\336k\253\235f\276$\217c\276\354\035?\272*K\321\323,\311\266G\374S\302\017\325W\325\027\326\222\213\253=PL6.\223\275\340B\n\212\201b\252\361\224\006J*x\352\222q,JN$\355J\216.'\276gJ\251\206=\261(\331@\262f\323\313\365\205%e\274k\226~d\355\336{$\267IK>kO\t\367^\2660\226\230\3163g\346\"3\367\230\315\033?+f\341[\271 \251{/\004f\021\207B\002\275\367:x\302\242\004\220\024\020\205\371\322v\020\217\342\213o\202\202\017d\335\316\036\306\316|\371N\241\272\2028\365\354\221Y\350\263\035\305|\362\266\016f\240g\235\021X\313?>=\265\003\247\372\r\374\352\314s\341_\340E~\0027r\336\271\325Y\347\302\263"
+	.string	"k9\307Z\246Y\313\001\254e\234\3232"
+	.ascii	"\323\362\215\265<\263\226m\254\345\032k\231\346\264<cZV\255e"
+	.ascii	"\231\265\234Z\313\250\265|Z\313\246\265\\Z\313\344i\271M\313"
+	.ascii	"\266\264\374\004j\360\212\202\343\2751\216d\256\225\262\370\343"
+	.ascii	"Y\377\325o\344\267:\311"
+	.string	"|\376\222\023\231UN\361!\013\201\335{\265\262V(\tv\b:\235\024\3457^9\006`\267k\271i\225\311+\310\254}tZ@\317\372O\300\341:\3453km\323=m\217\254O>{\004c\362\305\nZ\3236\335O.Y\353\232\322\251\307q\r\372\312\216\342c=\rn\371\350\003\315\244-\320\002:\211\231\223\314tf\214\251\242\362\263b4]\353OY\247f\232\246\317\260\325\250\366L\037i\254g\217Sr\017p\357\022\002S\373H\036\204\205\212\230\")k\264\017\264\365Z\237\322\2265\317\223u\212\207\267i\363\224Y\203<}6\332\003\302\n\264\331g\223Yf\353L1\320\006\272\354C\351\261\265N\371\206\317\301\205Jx9\302\361\350\345wo\357\207l\236\266a\353\224\317\036\271\233l\235\260\325h\273\373X/\311\364\030\"\215\331{\257\213\316\231\266ATm\t<B\250h\204\321Mg#\332\351t;\334"
+	.string	"\336\316\bw\033\342\345N\240\310\260;\241\"W\342xf\316\350\206!gB\004\321--\0021\201f(\004\321M\247\333Q\300\361dE$T\334H\306\t\341x\037pC6\334\220\215\210\304Mg\303\361\212lB9\274;\221\343\331\214v;\236M\025\366N\336\326\301\327z\n\344\322\222\001\265\t\256'\323\247wvP#\227Q\214\261\327>\265\243\330CS\232\323\034\300\240'>\305\301E\004\023\343\374A\320>\r\324\033\200_?\b\200\212^U_VRd\035\305N\210"
+	.string	"\221J[\0073\333\037Z\3634\t\251\352\372Y\261K\211\031\211hGY\325\234x\353\324\024\274Q\225\205\226\323eX\200\246\365q:@\037@\343\364\316\227\325\330\263G\276i"
+	.ascii	"}\255W(\002\253 \215\365N\034[ceO\233\330\242B\326:~\250a,\004"
+	.ascii	"\021B\206\231\022\031\031Ia\n\351\220\002\03112z\021@)e\210\210"
+	.ascii	"\266\244(\351\335\001\3124\375\222\310\362\255\272\242\205\f"
+	.ascii	"|\266\273\204\344\364\323\004\247\324N\322A\353\345\312\306\265"
+	.ascii	"R\344\370\005!\f\200\013\223\004\350#:l\026\327\243qO\214\217"
+	.ascii	"E\330`Kq,_\020tJ\324\337I\221\005\013v\221!\f[pz\217R\313[\225"
+	.ascii	"/d\346[\227\213k\224\276\013Z\354\330\370Bz\237/\272\371\275"
+	.ascii	"+\034\017\217\244u\355y\001\t\f.\207\t\376\024\204\274\377$\216"
+	.ascii	"\305 l\373\316\213\032qn\364\330\264d\241\301 \266\302\247Eo"
+	.ascii	"\333\351\016k\241yh\013\212\356\030p#\037\013\210\224\367\333"
+	.ascii	"F\260\320\314w\177\345Gp\231]\255jQ\027\035\0134-\205\341>M\327"
+	.ascii	"\302S\2358\320\344,JIH\327\303\331\256\317\t?/\037\222_\007k"
+	.ascii	"[\363\275\246\230\\\372K&Y7Y^h\343\320\326\305\321\031%\244\220"
+	.ascii	"\214-~T"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.96.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\362\002\315\024"
+	.string	"\326f\207I\260\224U:\370\231u\215-~\007\321N\233\025\017'\343\244zGf\270[n\231\214\222~G^\177\273h\006\264QH\271\211h\005\222Vz\316\351C\372\235\336\200\361J\372\017l\177\264\363\266n\240\322\377\347\366\344\023B\244L)q"
+	.string	"c"
+	.string	"z"
+	.string	">\320)\333?\007\313\032\021/\036\222Q\322\2343\301G\267\254\317\203\330\2329;\022\013\264\347 \217 Bs\316\025#\270\376\007\204Os\236\310!4\247\315\212\r\224\037m\3732>#g\007\305\036O\317\221z\334"
+	.ascii	"\215\3149c\004\356\"?\212\007@~\334\025\317]s\376\201\027a\264"
+	.ascii	"\330\201\243Ss5I\230sZqtv\356\275\355\003\266)\330;\02381\344"
+	.ascii	"\307/\3137di\204N\207v\257FW\205}qn\n\033v\337\237\362\337\215"
+	.ascii	"\362\336\375z\357w\375\347\017\240\352\023U\233\250\272\245j"
+	.ascii	"\326\250^\251Z\245\352\022R\235\032\325(U\237T]\252\332\244j"
+	.ascii	"R\325\243\252ER\275\243ZE\365\005\244\210~\254\030\315\031bx"
+	.ascii	"d\036\215B\027\377\375\366m\347\002\250M\tk\377\001\241]\307"
+	.ascii	"\003\324*\330!\262$\324\235\366\265\n,\367\264\033\304+\201B"
+	.ascii	"\210\257\027a8T2m\271\347\371\220+\256\311g\027\274\325fN]\201"
+	.ascii	"q\311U)\302{\341Z\327\216; \210\347\263\323\241w\305\205\025"
+	.ascii	"\361\222tw\177\223D\247C\013\307Q;\020\317\234\323\201\375\362"
+	.ascii	"\033\032\3129'\003\033\037l\020xz"
+	.string	"h\310\217\272\007b!<\215\327\240\361{|\213\321\007\264\031Y\005\332\206\032\214\354$\203a\202\312%\003\214\314f\273\265\314p(\231\227\0162\3213\226\031\356\302\314%6s\211\301\274\310l\261\031N&\306\362\362\215\003\r\027\233\271\335p\261To\336\206\355*g\350H\267;\243\354\311\302\366HL\366dE`kMV%eY\333Z\022\270Z\326\222C\274$\242\332}\314>\364\241\3256\330Q\212!\324\231(U\213\262/zm\311\252\366\251-Y\03005 \240\002\231\262\352\006d/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332\310\2056\310\203H\350\034b\205=\303\n\"X\343q"
+	.ascii	"\003\n\277<\246v\221\001"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.97.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`_\003\215\030"
+	.string	"\226\254\234H\300\026U:t\214\251\263T\307\034`\n\025\321\207\302\243\025PG\022\250\236\333\267\030\0279\r\006\310A\016\327X\rse\205\241\374h\342\277\306fI\234\215J\312\305\2458\220\005\022x\355\1779\002\221\265\005\322\310&r\247\024~"
+	.string	"~"
+	.string	"\217"
+	.string	"G=N\3649\355\377\336\363}\2469\265Md\340\352\326\253C\023~\b\20508\365\002\362\3644\266?\355\013\371\020\332\211\370\211O\265\346"
+	.ascii	".\251\2656p\002\362tu\325x*~\300xj\232\235\364\236P5\005uiQD"
+	.ascii	"\246\326\312\332\035\247]\334I\363\317\373\251\314\261\270(\343"
+	.ascii	"+.\370\231\"#@\356&\252\256\350\340r\336\347\213\234mNS\205Z"
+	.ascii	"\253g\231\213q\323\333n\331~`o\224#xx\306S\323\317h\247\253\001"
+	.ascii	"osQ#XMa8\374r\253\265\206\340\213\332\237\301\371\260\315!\354"
+	.ascii	"F\006\222\265V\b~\321\213\364\370C\247&\021\233/O\375\330x\372"
+	.ascii	"\275\357\n\232\024Y:\252\315\241\335\263\315\r\262/\326\005\262"
+	.ascii	"\311i\325N\247v\332\346D7\352D\376\032\323\364i\247\311q\332"
+	.ascii	"\264\323#\235\246;-\356\364\212\323s\247_\340\300\215\037\033"
+	.ascii	"AI\273\245Wa\f\315\324 \r7:\265B\367avc\312\0316KE\207\200\260"
+	.ascii	"V\034\020|)\237\342a\365\001\004\b\336\007\024\225J>\240Zk\b"
+	.ascii	"\306\265\331Q\214m)X\353\215\270\343z\342\302@\021\367\274\343"
+	.ascii	"\350P\262\323\355\372N\376Dg\365!\257\360\361\241R*\371\346\320"
+	.ascii	"\002fjQ[\263\236\273\273\302-\013\373L~\224\302\037r\210\235"
+	.ascii	"\235\361t.m\222d\247K\001\r4 \244\344\345\342\271\3578`\220\354"
+	.ascii	"t\251\375\357- ?\20682\250E"
+	.string	"b\340\215\320\310\217\274\0020\021%\\\261\230,\3475\003p\242G\205K\364\313\301k\266\363\202\261^0V\211\036W\214\365\232\235`9\270\261\314\304\210\031\013\205L6c\321\364j\027\353\002m`\022\254\255M<}\241\005y \224t/\264!4\236\005\013\245\022\271\247=\256J\215\013\271\021\220t\2769\274{\266\237G\371\023\334\r2\371\234\321\264\260\037\322m\226\261/<R\316\205Vk\351\017\270\244Z-\030p\204X\236%\2035p8\351\260\240\220\275\303x\252\332\006/h\324\256\370H\020*\203:\001G\2501,\3140F\f3C\024\244 )H\332\220\002\0211\253\033\020P\312J2\354\006#\001\314\033\2100\320\362\351\221\232Q\231m1\253,\204^\024gt\035m\247(b\231\243P\265v\255/c\304\f\034\316\345\313U\021\303\227+\356pU\326\332\204\247X\234\215\027\002\217>v\367\2468\020\333\234"
+	.ascii	"\312\301\240\211\255|\210:\r\245Q\272\t*\032\035\356\311\225"
+	.ascii	"\321&W\306\326\352\332wI\265\317T\246\210\021\345\"\357\025-"
+	.ascii	"\217_\007L<c\236\305\252\221\315\013%\310O\322<\205\254?"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.98.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\220\006-#"
+	.string	"&\177\332J\220XN:\206\352v\250\303\276\360'2irE\214\022\365\256k\335f\030`\234]G\002\322P0\313\243\235e\373OH\272u\210\367U\376\211\211\t\024W\023\002\215+\216^\233\236\363,oq`\327CQ\fk\204l\"\267L\001\276"
+	.string	"\266"
+	.string	"\314"
+	.string	"8[\217\332\372\023\255\267g\275y\326\267\255\257f=\037\270\351\021E\001\224{],\305\\4[\306\203\215\314G\356Z+WF\362\3713\003\341 <\366\024\311\245t\274R\027\304\271W\303d\327"
+	.string	"\034\333\263\030\377\250b\343\2258+\254\2340M\311v\357%\300\366\001plu\334s\2625y\347d\373\252?\013\037s\\\024\307\216!\031\230{\357\256qp\025\343\320\323\232]\253\316(\223\f\261h\3058\324\3245A\033\262\024\254,\323Hk\206[Z\034\326\023e:\262\361\"\213m\f6W\244\305`m\233\242\320\324\335{y\214\353U\021X+\312t\357}%\026_\360e\370?\361?\203\377\f\013|$\003\356\336 \202s\0216\242\341\211W\231\310;\331v\333\25730\243\222\215T\371\242q\317`\271\f\023\274\367\007\2406R\363\231\320\013X\227\347\256}v\021\262\375\352\322"
+	.ascii	"\023\2012\220\340\357\300C\242\004\250\335{\021\220\261\020\020"
+	.ascii	"g.\266\017\321\253Ld{\356\235l\271\323/%`e\277\272\374\217\300"
+	.ascii	"\332[?\233\267\265~6\362\227\370\310\337%!\331\372#F\362u\266"
+	.ascii	"\336\310\326\027\331z\"[?d\353\205l}\220\255\007\262\365?\266"
+	.ascii	"\336\307\326\347l}\017Z\317s\326\357\330z\035[\237c\353q\320"
+	.ascii	"\372\033[oc\353k\316z\232\263>\265\3653\266^\306\326\007\335"
+	.ascii	"\323u\247y\324\322v:\275A\305\315\250C%G\007\247s\232o\032\247"
+	.ascii	"+\026!\333Ms\017\261%\3031iG"
+	.string	"a,1%\261\355oX\313)ho\235\246\323V\301O\030J\204\024NN'[\232\026`%\313I\223\264k\306\246\200\031\177go\235\327\276$\315\244\226\352\222l\244\326\365\325?\303\344\304\223\225\211\023f:\227\\\242\311\364\331\214\225\\y\346:\212'\237<\331\3263b[\256\342\372\247P\2412Q\246u\301\266j\361\306\302\213\256q}!\354\213\320\013h\315N\352\022aiB66{\353H}\366\2071'\266\317n,f\333\346\341\230[\340$H\314Na\234\271\031\353\275\327\252{\353\031\316\356\rcW\2025\314\177\f\001PR\035\246\032x\340QEI\240\232\202\362\371H\360r\244\244z>\323\304\323\211>O\211\347\323\300\343\260\343q\330ME=\205\330\361|#vJ\271\367D@\371vT\275\236o\227\036\177l\336\326\272\223\017\264_\003_\323\365W\255t\336\216\272\306\250\217\212\232\250\215\272\217\be"
+	.ascii	"\203\272\250\3213\241\327O\0235w\375P\n\275\320~k\342\021\303"
+	.ascii	"c\274CFlCj\3314\332\247\027\240\033\332\275\271\241\266\351W"
+	.ascii	"!\027\241\006\352\241n3a\327R\007\265\020\230\240^\240#k\327"
+	.ascii	"?\r\344\345\247\323\033k`Y?nc.MEj[*\337\354d\273\344V\206\254"
+	.ascii	"\313\002\314\326d\224\343\336\032\t\316YX\213\003\335\003\b\020"
+	.ascii	"N\266\273\356\2574\2602$\316g-\347\323\3239\236w\250Q8\305\f"
+	.ascii	"S\310\241\031IaIA\263\006\220\002\231\251*;\021 -d\316\214P\250"
+	.ascii	" \251Sh\fC\311\344<\345\020\230}\026h\361\227\377TR#\361P}\f"
+	.ascii	"a\256\317\001\232\367\177&\301Q8\242\200\346\025\337m\\P\203"
+	.ascii	"\376\263\352J\271H\222\351\240\314v|\362\273\215\274\373\212"
+	.ascii	"\275\315H1\250V\320s\305\356V\301Jn\\\034\350\004PV(\"\\q\202"
+	.ascii	"G\234\352\340\340 YWA\030J\340\207\264+\031r\212\342z\367t\032"
+	.ascii	"\306\227\")\032\351\273\347\r\035\242\001\334d\007\3572\276\251"
+	.ascii	"\242\354\221/\223\007\243F\365\3761\002\f\263\327\356G\370,_"
+	.ascii	"SW\335N\310\206\031l92\025*\304\353C!\252\271\214\377\367^H\371"
+	.ascii	"&\377G{\340\177Y#\321\007\347\243\013\203H\321\224\260\007\026"
+	.ascii	"<\304\200\234\230\027p\212\300\377\214\354+\202\270\223\335}"
+	.ascii	"E\367>\277\3550j"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.99.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`G\007-+"
+	.string	"\032N\354\020B`\350\315p\363\003\020U\251\003,\373\226\245\373\221\352\226\"\361{2_\347\361w\312:\240\334\203\254\243\n\246(s\001\354\034\376\"\021_\366\177\336|Gm\302\"\226\302\037\334\210n\"B\366\336\335\244\224)\374"
+	.string	"\344"
+	.string	"\376"
+	.ascii	"h\273\266\333\266)\243\274o\373\357\227\3777&\t\241\005\263a"
+	.ascii	"\376\337\265\366\313Q6@\203\326\374\265\376\337\232\275]\326"
+	.ascii	"m\225\377\275\331\0203wg*\365\262l\352\266\335H\215`\251rn\020"
+	.ascii	"\207t\315&\336Z\216t-\223&\355\364\240[\327\025j\315GH\231\377"
+	.ascii	"\325\262[\324U\333qs]\311\364\224Y\3275\007O\220\256I\264G\347"
+	.ascii	"\232\274F\347\232W\177=\273\306dE\227\274\361r\033\264\256\353"
+	.ascii	"\260\227\254\272A\340\317\327K\321\323\3445"
+	.string	"\253_TC/\031f\334 \020\325\200\344\207\221\375\025\221\002F\204}\274\006cl\200l\0340#\274#8I\360\f\341\336\001$?\204l\032\007L\310*\367\200\02401F\203\354\031dMa\030\222\327\264\256\353/\214\007\363|a@\266y\r\350\314\004\022\206u\361\216\276\316\222\253\\\366\021vdF5\254\353zN\206\375\330\013\367\377\232\377:\376sN\347\232\233\354\343\205\227W\352\355U\256\202$\200\330\346\224w\\\274<Zg\250\225\372\214\ft\344\345\267\b\331>\356,\320C\275a\226\207\305\211\\Z\220\267?G^\362xIl\256\211\363?\221\2027\371\324g\024\262\2566\3562\261\243+\323]v\033\247S_8\202\306f\247\213\355n\304\277\212\025\274I\247\216\372\212\223;\266\361_;r\227\375\313[[\t\204]\333?h~T\363\241\266m\317`\325v\027\020\361\237\366m\357\324|&\"~\001 \237"
+	.string	"\220?\200\371K=\276"
+	.ascii	"\346+1?i\210\217$\344\037\375\370\001\200|# \277(\310\007\300"
+	.ascii	"|\"\346\0171_\030\344\007\231\017d\376\017\310\367\365\370\275"
+	.ascii	"\037?\355\361\321\036\377\374\361M\037\237\307\374\356\361\271"
+	.ascii	"\307_\tET\340`P\256\353\327\222\320*g\236\t\31333\252\231\332"
+	.ascii	"\207\260\201\255tD\020\333\233`\377\267Z?*\232\001&|\266\217"
+	.ascii	"\032%K\2352\345\364u\260M7\244\033`\357\3715\260\0279v\304\263"
+	.ascii	"y\036W\343h\216\346\\\363\327OM\244\366\316\341,|\353\254\035"
+	.ascii	"\265\312\257ZQ\323x\223j\332\271\246\257\203S\356\322\316p\241"
+	.ascii	"\275\206jn\343u\307E\007\253''m\036\323\204O\264\243z\275\356"
+	.ascii	"\242\366l\264\271\r\362\356\310\313,\033gG\272\256+\205/\234"
+	.ascii	"-uKj\026\343\\\363\354\236\332\327\315\276\211\3615\273\312e"
+	.ascii	"\303\206sM\263+\034\013\245\211q\361\222\327u5\232]v4\f;5P\256"
+	.ascii	"\220Z?u\201\366!\343\344\365\236\261\335a\342\246u?\234\177\b"
+	.ascii	"\021\274I\336\217lIVG\327\325\306\007\020\366\2169\203\276\234"
+	.ascii	"\356-.pH,\334\fz\013y)8\0274"
+	.string	"\367\252qQ\"\261\3647n\323\214hZ\263\223(\301\233,\021\267\222\322\262\332\242\272\032be]]eU-i\235\240\332\232A\364@\274\242*\202\300Q\024j\221\030zA$\3220\361\002\213\352\352*\253CUQH\334\242\232\262\322\"\026a\020\247p\024\203\257\222\252*\266\250\2021\254\2021\304\212Au5\254*j\r\245\220\236E\203X\034nee\025\207\2775\256m%SU\344\270\372\370\340\341\226\213\306\344\272\332\b\3542&\320\277Z\246.\341M\276\251\013n\217=\210\310\255\317\260\\\352\351ZW.\004\003\232@/R\312R\017\350\315\203\244\023\320K\275M\330\210B@\017\375y\253S\273\032\036_P~\020:\251\213ll\230:\251\213\024Bj\b\017\032\251\227\314\202\260\3732\207\264;K\216\311\371\272l\325'\347Q\273p\262w\352\023\024G\204\0024\252\304\255N\314\250\037\270)j_\033\365\"\241"
+	.string	"\350\242F\335\220t,\326NEK\353"
+	.string	"t\357\214 \242\236@\245\255N\254\007\265\200\332\317\362\312\237\264\313\316'T\257Y\200\211\250q,\345\b3\214\241@dDFA\222\244\003\200\002\2211#\333\020XVC\224t\254I\037\200V\347\013\353\021\215\276\271!2e(RJ5\024\354\250\301 :\336\354\\J\232\330J\334_\370\343\365\303\310\341\254\001\205\245\205\016\323yM\230\361\223\315Z\021\n\363\325\300\322\\\206\222\201D\324\026\321q\244\344\365\217\231\204\201p/pi?)\200?\007g\241\262\031\004\321\312\221\r\037\343H,\002H\330\355\323\013@\317B\337\214cW\322?7[mH\347l\033\224"
+	.string	"j"
+	.ascii	"F\333\210\240\"\204(.\237\342\f\023\236p\227\334\223\032\243"
+	.ascii	"\323\233D\366.U\330{ig3\261Q\335\277v9h\334^\355\2740b\003\032"
+	.ascii	"\0066\r\207\367\341\245\037\372D\247\204g2\"r\240\303\2445\033"
+	.ascii	"\337\346\263\371\005\304\221\035\236\245\221\247\261\237\030"
+	.ascii	"\215Z^\257\255\232W@\252'\335[\252\203\307B\036n+\342\365 w:"
+	.ascii	"`Yz8!\025*E\353+\350S1p\315\f\343\322F#\267z\204\373p\272\360"
+	.ascii	"\343M\373\240Y\243\323?"
+	.text
+	.section	.gnu.lto_processRcInterpolation.100.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\256\f\245@"
+	.ascii	"\232n \030<@\352\315\030<\320\364\346\270\315\342\320\017t\006"
+	.ascii	"-F\356\360\231\357\237\253\357\032b\0058\216\305q\207\376\300"
+	.ascii	".l:O\232\2611\326]L3W\375\333\353\337\233\204\265[J)eJ)\005r"
+	.ascii	"\001R\001v\001\276:\267\b#3\320\207F\357k$0\323\273\227\342q"
+	.ascii	"\3517\335f\272\347Z\365\324QW\231\233\271\323p\327\261\220\273"
+	.ascii	"M\273\001\322oX\2175Kc\343\324\335"
+	.string	"\371\275\357\253\201\355\224\013m5\275\206Y\310>:\r\027\317\370*\275\357+\364\301,\354\324\231\201p\237i:\026r\3135\032 =\367\203}\351\260huX\034\260\235:\365\224\332\251w\224\332i\233q\331\027nu\343\366\346\367\276s_\235r\027\333)s\330\003 \354\366\\\233\021\265\356\t\032\233J\357;w\374+T\2146:\327\334\276\333YXWVUT\306))\255(\250'\247\"\261\035\n\233\202\354\252\246\350\273\313=&\017\236\245\232Yg\231i,3e\374\312\311\264\325\263\253\310\320eq*.m\334\322S[\264\270T#\271\264\026z\365D\273\316x\024\324[?\275\271\271S[\027Q\004\315>IZPZ\033:\025\250\312\242\246\213\342Dt\310\027\327\244\005\2455\321\006kv|]\327\304\333\025\203\225#Pz\030\200\312\221'-|\342\304\233V\fu\355u\327\205\312\021(\035\364\222\266\346,\226"
+	.ascii	"^\322\230\276\252!\024\245+\006\224L\034<K5&\215\006iR;S\247"
+	.ascii	"\260\350\275)\377\005\245\215A\271\336\367m\272v\"jI\367\025"
+	.ascii	"\303\373\276\354K\265#\315[\315\354\024\230\371\005\263\020\r"
+	.ascii	"o\341[\351%\351\201\234\276\372\357\007\r\020\311$\332O\237\364"
+	.ascii	"\233\256\277\b\375y\312!\363\2321\244\353\241\376\241\242\177"
+	.ascii	"\341\337\217\262\231\354<\255\247\004Wg\341\023(P|\313\326\307"
+	.ascii	"\0223\215\007r\327i(\277=3\377\233\300h\315\r}\247\036\367\035"
+	.ascii	"\356C\375\344"
+	.string	"y_\276/\036\267\035\356c\275\265\324N\307\300\275\357\353\325t\230\271\017%\304|_\263n2\003a\356c_\276C\344\340^)\257\327\020\017\320\336\231\003\266\0267q*}\253P\373]\250It\346\227\2309E\313Q\301\276\357\031\004\3568m\267\202;K\247\314\242\205\367\262S\356\026j\247\375\351\227;\226\344\220\036\310<\227\364w2\267\3631\302\304\021?\0333\210\016\031.X\3507\315a\f\332L\363\202\236k>\016\235\301Vg\005\255s\202\326\371\253uF\300:{\261\316\007Xg\003\254s\201\325\271k\350L`\350<\240\350,\240\350\034`\350\3145t\006@t\336j\235\265X\347\254\2403V\320\371j\350lEt\256j\235\251Vgc\353<\325:K\265\316Q\2553T\353\374\304:;\261\316E\326\231\270:\267C\347!\353,d\235\233\204\316A\326\231mr^\203\316\352\352\234\006\235Q\3269\205\320"
+	.string	"\0238\3253\273n\356\233\332\313\252\347:{3\006\374\243\372v\203\210\270\347\226W|'s\273\252\361\233\212\032Dg~\351\222\026W\214\321\300\227>KL\342;\231\001\234a\207O\023\005\277:\354\211\240a\357}y,\311Aj\023t\330wx\225i\027\250l&=\320\207SO\211\357"
+	.ascii	"\034\232\264\303\215\223\263|$\365Q?\365X~\224{\206/\365X\214"
+	.ascii	"\224~P\377\364Q\277\376)\341\222\221 \361p\343\240\276\363\334"
+	.ascii	"\360\220\036\3506iG|\307\276\357+\201\273Q\373\271\\\334.n\\"
+	.ascii	"\234\332\351\323\267y\213,\341]\022\276\363\253\235\276\275$"
+	.ascii	"\350\342;}\2431\303\236\370\305o%`\373\304E\315\310\005\343\212"
+	.ascii	"\021\243v\332~\327uW\336\242'\023\031\251i\370\334\210:\221\373"
+	.ascii	"\314\341\226q\313,\037\t\177\370\250$\177\366\205\n\b\361\251"
+	.ascii	"1\324\206L\362\257YOmz\377^\323(\334\033\235\270+m&\005\277\351"
+	.ascii	"\033\r\020Y\250\371\334"
+	.string	"3\334Y\330E\223!\203\332i\360+\2701\217\317~\367\261k\364\325\345Q`\360\207z\374\tV\342\232\357\f*\364\307\276\223[\322ZS\315\360\315\244Mj\341\233\021\223&z\341\217Od\206\272~Y\357u\240\r\034<xP;]\377\363\370\236\230V,g\0161\302{\231\341\267\354 \331K\276\031\367]\017\361\376\366\324w\356i5\034\003,G\f\035b5\2166n\324\250qc\354jl%\323!f\"F\016\2622\030d&z\224\2654\310l\330\020\213\261\341\005\231\016\261\0278v\020y\fl\254\254\305\030\214\343\030\214\243\r\031b5\216ce9\216`F\276\201\203\254\354\250\343\306\215\262\243p\016\331\317\306\340\211K\224\354!?\231\005\366X<\213\373\214p\350\215\365\332\300\276\250\267\246y\022R\016\025,\272f%)\221\263r*\315(\225Oi\006OD\301\303p+\n>e\263\346\311\224t\325\221\370"
+	.string	"V\261r\265f\013\262\001V\212T\251\352\235\374`\217\021\304\007\233h\361\207A\337\367}\251\336\331\256\272\340A\274\272gN#c\024\276\003\320\346\315\226\273s\263|\364O\370\256@\233;\371z\004\237\340UF\312fr\215\357Xg~}\263q\303C\302\371\022W\202\340\203k(\265\035_\334\332\224\327\201\3672\360\005\376\300\2027\320\365\005\034I\327\247y\224~\315\216\317\213T3_\334\032\035\255gc\367\251\022\37025\177\322\b|\220\320\244'\023S\324\200/\"\340\007|``\213\251\001^\300\267\262\311\365\001\0209\021\256\017\346Ez2\033\251$O&("
+	.string	"\n|\210\220\255\007\240\365[\337\312?Y\257\365U\177J?\254\317\3726\240^=\326\267\222\214\007\271\372.\204\210\231\346\2511\265\361\017X\301\344d\365\236t\237\027\332\334\314\221\356\224*\256\323Y\365V_\025\201"
+	.string	"\250\201,&\rC\210FDD$I\n\222\016\200\002\221)\252\252\003\0210-d\216\021-H\332\r_4\bi\250\330w\0164\217\325,\2151\217b\243lZ\316Ni\036Q\253\232\245\nhy\240\0206;\220\255\212\220*\227"
+	.string	"\231\020\013\361e\223\003\314"
+	.string	"d6\322\262\035y\221\221\334\005p\262r\227\317I\213|\203\350\227\377\313\264E4\321\037U/\006\270\017\345\253'\n\224\340\033n\345f\277\3668\320\243-\354_\206\200\326\320\246\273a\260\r\025\236a\274\266`d\371\2456~\3500$\223\350\003\242Ie'\350\007\303%\244\213\211\f{\036\362O\266z\317\221\303t\342\323\032\007z\235R\233^h\336"
+	.string	"\037\273a\353\271\003K\210\272r&,\236\243\024 l\263\350\214\222a\371\021\365z\302L\236\217\366X\2108\345`g\323# \037h\271Q\037\273\214h\036\204L\037:\232i\302\313X\303VV\206Y`HxU\253A\231"
+	.ascii	"=\277u\352\0215\267\007\325\344\336_E\022\341\200\242\254d\244"
+	.ascii	"\235\350\256V\317\0268\220\021\024\025\365\210v\275J4\264W4\314"
+	.ascii	"\\r\325\371@\r\217&\207\332\362\261\333\035@\275\307\365P\177"
+	.ascii	"y\244p\003\025\352\270\357$\022\263P\036\210\t\306\213 !\272"
+	.ascii	"\262\271\333\200\26317\311\220\341\335\340\247\265f^8\037\275"
+	.ascii	"7\332n\216\353`Y\271x\t\301\340N\213d\356f\333m|\2412q\230\300"
+	.ascii	"\372\350\001\211\264\"\242u\225\\{\236\343*(\254\216\366\365"
+	.ascii	"3P\350\277u\016`t\217\310\006\256\020\006\nX\226\242\300\353"
+	.ascii	"\031\364\251\321\022\202\370)]\330W\020"
+	.string	""
+	.string	"\021 (\363\020\300\"\320\373\2627\201\025G\342\027\207w5\266/\3139'\020\203m<\265\227\272f~\354"
+	.string	"\3057\0229\002\364\365:\2150\032\326\231\204\367\b!\333\341\234u\371\374D\375r\036\353\351<\271(\273\226\327"
+	.ascii	"M\3577.\230\n"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.101.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"u\013"
+	.string	"\006\026P@\020Q\225\016\033\002H\006\200\257\326\256\322\326\225\266`\2135\221\016\245\017%\263\240\022\201\314oj\335,\375\350\210\360\230\247\375'\220B$"
+	.string	"J\224X58\206%\205\225*(\202\373\377\177o)S\n="
+	.string	">"
+	.string	"9"
+	.string	"\257\325\n\033\273\233\0358\201\311\341\373\200\311\241\2168\367\247\311\371"
+	.string	"\272\323_\305u}\005`\"\256"
+	.string	"\235\352eHD\320x\354\331\352R\231\224\316\356:Y\235\207\033\336\266\003\333\r\354#\b\351S0\"$\023b\354v(\301\261#\020\306\t\333\234}I[\301\002\356q\303\243\201W\374\220\261\0337f\360<\210Cl\331\r\301\342\305\356n\234\251\034\332\366S\374\203\263C^$\321\275EOSm\f\032&g\251>\366\016\007=\031\352S\347*\007*K\322\004\0136\242\352a\315S?\224\250\241b\206*o\330\361\224\352a\377\255v\330\217?|\372=\255\007\371\363\001\tL$-I\370\210B\021>\"\317\366 \003\204\n\027<\002\254q\264\215\202\006\3124Pf!\344\021e\332V\3128\030\217H\237-3\215F[v\211{\355\360c\267\200@\341\"5\267\252^[\352\016JS\017f\020"
+	.ascii	"m\b8\323a!\013u\205\275\252\252\275\242\204\343\241\317&$\327"
+	.ascii	"p\321L\024\227\330\276\212\026T\300\002\250<M\265G\003S{"
+	.text
+	.section	.gnu.lto_rcSmoothingRxRateValid.102.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\305\b"
+	.string	"\266Q@:@\305(\035\255.I\340\267-@c\250\330\317\2140\314zF\256*,\233\031\220\227\255\325\333\340\316\232\3714\203\b\262\351\226U'G\3473"
+	.string	"\013\342\271w\240\031\263\204\020)S\n/"
+	.string	"0"
+	.string	"+"
+	.string	"\232m/0\220\\\272\367\261\272\004h\245J`\273\036T\217\227\236%\377$\327BRZT,\323\363\342\260\273N\025\013\343\326\333N\260\335`\373\025\3372\002X\036TvW\337\200]\321^ \266o\233dclg\332\027\371\b\351.\237x`w\003\305dw\025\214 pM\363\203\355Z\366\202\355\001\037m\251\231>\325\"\370>X\306G\3335\365\027\032\250\374\254z}*v\312\317\366L\251\035\366\263\335]+\207\263\273~\325tj:\235\250\303\211\bu\321\323q,8\242O\027c\005g`n\303E\b\316\0039\017\374Ht& \027Cp\2231\210\242\213P\004\002E\210\361\366\316TsR\2243\006 \007"
+	.ascii	"2\003\302\260T\270\033\233\226t\031\265\243\nc\272&\031"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.103.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\245\r\215?"
+	.string	"jl\254\027@P\350\316\030\334>&\253\013\366\360a\246\321\037L\374\320h&\315\271:.\034\240\363\330\bp\301\355\025\300\252\245\316\022"
+	.ascii	"h\033\3419\360\227eF\365\237-?\023\254\221\267\341&RJ)eJ)\005"
+	.ascii	"p\001F\001l\001\315\326\016\215\236\203\026*\034\344g\250\317"
+	.ascii	"\264\035\263\220g\264\031>\242\323\333\362\276\257p\006\263\260"
+	.ascii	"\325\3571]\307B2]&\331t4Ze\263\310\234\202\346\317\373\276am"
+	.ascii	"\253V\351\\\207I\266\230\032\355\273\246]\242\201\376y\3379c"
+	.ascii	"\253|\240mU\311\333\231\333K\177I\366\323F\017\337\327\211\241"
+	.ascii	"5\357;\367\305Zm\253<\327\304\265\325\266\231\326V9\311\f\330"
+	.ascii	"smo\3579\263,c\350}\337\343C\341\264\323\271\346%O\366\224T\024"
+	.ascii	"\324\223S\221\330\304\2644TJB:2\022\006\335\226]\325\364=\311"
+	.ascii	"\315:p\231j\312\236\222J\255\346\354-\233\257\351%\255r\222$"
+	.ascii	"\332o\315.\036\345\245\241\322\256?l\b\365[\223KJ\364a\205\331"
+	.ascii	"ur\376\264\245\235\334\272\230F\3615\335R-;+N\254\342M[\2508"
+	.ascii	"Sj\324\007G\244\371\232S\322\003l\320>6_z\362CJ\017\225\222\332"
+	.ascii	"\2228\022\353\340\210u\300\344G\2246:\302\3274\342\302\"\251"
+	.ascii	"\325\025_\023\211\007\371\232Q\336\232D\334\275\353\253\267\346"
+	.ascii	"\224\036jKo\273LJ\263)\221\257\271\226v!\321\003\262\3645\250"
+	.ascii	"&\244\325 \235\246QH\364\200 \251\235\245Zv\232\360i(\016\177"
+	.ascii	"$5\264\324\352}\337\256kOS3sg\035\274\357\313\316T\373\321L\325"
+	.ascii	"\314Nd\346\007\314F\020\002ay\201\362\376\235\354a\375/1&\017"
+	.ascii	"\016?\304\314\035Z\216\207\366}q$\340\206\323q>0\b\021\336L\021"
+	.ascii	"k\253\377j\234\037\217\35075\332\367}\023p\343%s\220\330\372"
+	.ascii	"\243bcm\265\301?\236>\271\347]\243\025\361\243\344e\026\013\f"
+	.ascii	"\224\203\343}\313\260\374\027\274\247A{3\363@\356\367o\264?\315"
+	.ascii	"\246\333\214qS\341\023)\274\231)\326V\373\205gx\242ke\036\310"
+	.ascii	"<g\346\357D\344\346g\205\337\t\263\353l\301u\256@a\202\353,\346"
+	.ascii	":\207\265\230\346\006\375\354f\320t\315\013\300\\g\003A\347\002"
+	.ascii	"\256\3631\350L\300u\376b\235\275\\g#\353\334\325:s\005\235\007"
+	.ascii	"\270\316[\256\263\200\326Y\213u\316b\235\261\204\316\001V\347"
+	.ascii	"\253\240\263\225\352\\%t\006\260:S\005\235\247Tg\251\3269J\350"
+	.ascii	"\f\265:?\271\316NA\347\242\320\231\270:7\271\316LA\347\245\326"
+	.ascii	"y\310:+\271\316I\2563\222\353|\304:\033\265\232fa\353\034\f:"
+	.ascii	"\273A\347\326uf]\347\265uVY\347\224u\376\325\331U\347\306 \325"
+	.ascii	"\264\023\"\357}}\004&z\367\3246n\255\246[L7]?s3\267\031\356;"
+	.ascii	"5\214\327*\003i\344\326\222\242\374,\352\205Y\240Q%/WQ\216\032"
+	.ascii	"\322\323C\271\271\222\254\313\370\233\324\322z\201n\240\376\311"
+	.ascii	"\351\251\370N\211\212/v\246\350h\313\233\236\b\227\214\363fr"
+	.ascii	"\r%\334Q\2620&\2216\224\324\322n\024$\345\272P\262K\253P\342"
+	.ascii	"\263xL!W\276\340\231\2369\t\346\2017\263\351\255\316^\311K\317"
+	.ascii	"\364\337g\271HP\215\245\017;K\0245z\347_\017\277\001\r_\030\227"
+	.ascii	"H\356\331\266\275\315\367}\271\212yl\366\224\256\b*|'7\325\252"
+	.ascii	"\364\375\004\260\217\322\273q~\344\236\r\355\203[\013&}3\361"
+	.ascii	"j\244O\372^\256\201\375\321#}\243-2\372#=\275\007\202\004\n\336"
+	.ascii	"L\nk\253F\337w\255\025\0040\272\366l\320>,.r\r\376\003\262\320"
+	.ascii	"~\310\340w]\017\325\344i\256h\021/mklNWc\013?\215\233\347\224"
+	.ascii	"\315}plk\330\006\357~\2111z\360\264\356\273Y\341\203\344\313"
+	.ascii	"sMS\013\027\322\250,\357\336\330\025>\215\271\375;5Z\247f\002"
+	.ascii	"\252\360\355w]\033\361\374\306\370\325-R\243|}\366\271\241\030"
+	.ascii	"2\254\315\264\360\352+\263\336\354\334\244\306f\277\241=\024"
+	.ascii	"\323g'\320\235:\032z\217\361\216\177\215\327\366\276/\373\356"
+	.ascii	"S\375\365{\271\250lN\247\257\276\252h\331\306lC\327\241\223~"
+	.ascii	"X\234_\364\031d\315\301\204\243@\201\214!\003\202\211\025H\227"
+	.ascii	"D\f\022\021R\264 S\021\003\211d\001\343\210\307\b\214\275\030"
+	.ascii	"1\206\3428\206\342\330\202\214\004\213\343\330\013\030G\002E"
+	.ascii	"F\2728\361"
+	.string	"\342\030\003\211|q\024\316\225\365;\001\241\266W\366fS\t\334@\220\344\020\034\257\344\002o\340\301\366\024Z.\202\333{J\275\223)|\201\277\001W\340\3317u\242\3176n\302\304E\035p\343\177\375\261H\362\210\025\332+\231\300\037\257\020x\004y\274\376+\211[\251\342\365M'\312\263\353\215\337i\246H\351z1Bu\344\006\314qF\241\270\276D\033\222+\356\251(\366mG4v\330\2471\017\370'a?\340\353\211\236\231\223\200\337zn;\261%6\247\224\342\326\267\2357a\274\004my\177[Z/\240=\254Y\257\365\rgO\335\262\215\031\200=Q>\304\254\177\3001z\226\270\222$Y\337\320<\317\246wb%\233\370\0217\202\365*]^\324\351D\252\332(`\021\312\223cz'\367]\033\365\f'<\247\254\360\301>\215\361V\260o\300\356N\227\274\032\354'|{\241\343\207\206\304\314\003}X\365W\037"
+	.string	"\212\020\262\246\013\222\324\322t\200\340\005\370\247>V\177\365\303\352\033\260Y\365\253\032\2665\245w\272\324S=\200)\311*h<\310\272\314\337\216?Os\363\007\340\237\350L=\325\177\037\264?\256c\352\273O\236\247/\245\236}\023\201\003\250Q0$\025tjD$\210\244I2\254\001\221\005\304\030\005\0354\017\0210\245cJ\325\220&)\264\236\001\223\320\215\235\224\245\260\261\030.\f\233\306\003\245\256\231(<\206>\265[\271\230b%\223\370\f+\257\363B \227\337\374\237\311\301\203\302\037\271\321>\022\225h\265\331rv*W\231y\275\024Z\223E\310\253\313I\216\235\231w$\330\004\356=\233\3149\264Rg\334\256\362\205J.\347\361\204\b\302{5\262)\335\211S+Ev\204\207\241*\2633\031Q\3025\272LZOJ)\372B*\272"
+	.string	"\345\235\204K'\221\342 \021i'\212A\276\235\304T.U\365\212t\013\035/\375D \333+\261\257\270y\ty\035\022\261\201X\310\376\276`a*\210\257\323\b\225\377\347k/\332\322\f\031L\243\356\214\2752U\261\224\253\310\334q\350\227o\256Wz\256\261\205J\254\215P\213\210\331\212\303%!\037\032/\201\373I^,a$\246\357J7R\262\373A\317Z\340U*&\317~\"\306\372\177\005\303rO\"\b\257\346\306p\363C>w\210\305\266\271<\353N\007\017I\214N\325\335\324}\334\374\017\260\313T\373\270L \235G\326\006\244\320\310\206\005\005\330\314\266"
+	.string	"b?\312e\023~\300\276\306~\355/\342X\330 `c\340\020\316\254\321\036\360\324PAU'x\206\220\023\301\254\364\225\371i\275\255R\2609\001l-1\355\022\025\367 \376\"\017\277\"x\212w\300[\t\306gJ\rbV\225\246\221c\020\034\363l=\032]\350Z\201N\247\3203\0017f\361\315[\265|\203\034\023\f\365$5\264"
+	.string	"\005\363'Xi\301]$D\244\261\203"
+	.ascii	"\353\276\307\205\306\240K\313x(\205\240\222\033"
+	.ascii	":\rR\311XAWQ\027\332\336\302\236\320\354ju\007M\272\212\351}"
+	.ascii	"\2736\253\203\353\3445\326\316-\204\203\rFR\307\0332\253\001"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.104.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\265\n"
+	.string	"\026SG>\020\005+\035"
+	.string	"\360(4\030}\346!uV\007vO\214F\325\201\346\335\315I\241\306+\341\235\266aNz\216@#\323\340\352\204\026"
+	.string	""
+	.string	"R)B\301G\006\254*\344[\241\262\266\221 \262S\n1"
+	.string	"3"
+	.string	"9"
+	.string	"\237\317\217\300\177\240\017\200\377\\\332:?k\373\034\034\007\013\272\273\241\027\362\362\265\364\217\362PL\366z\375,\354\256kL\346q{\267M\262\235`\377\"\260\232\332\347\253z \366=\273\273\366h\366o\177\375\274f\321\235\t\233\335\2164\300\352\276\231\021\221\355W\373\346O\312\337\\\027\330\245\001\220\331=\021l"
+	.string	"zi\372\025h\217\307\255^>pLv\007\267Yw1MK\310v\203\356r\266+\311\256\370\212s\0055\333\342*\030\240\335UH\311\320\030\325D\376\371.\360_\203\215df\242\001\246\226\211!B\205\222h\215c\212\025`\261$\222\017\342)\024O\241\neJ\205\"\311\nK\004\036) \310\2605\216d(:\367\236\365hv(\321\301\274\r;\365\230\025\21493\275\026"
+	.string	"2\241\267/0.\216V\227`\2736(\254\f\033Y\211\004\333\265Z\244\016\354"
+	.ascii	"|\267\252&\204\253.6c\354!=+\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.105.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`g\005\265\036"
+	.string	"\3668\302G\260\326\321p5L\207\361P\300Eo\240\336:\202\313\223\004\341\275\363\fB\341\233\362\227\033\253P\007\266t\376\227\364\247\200L\276B*\367A\375\343\003G\207\372\356\204\270\f\216kjr'\237d\307\033h\020\262\367\2262\245\253"
+	.string	"\237"
+	.string	"\266"
+	.ascii	"2\037\310\203\034]\312\350'\360\374\2715\203\n\327y\016\017\274"
+	.ascii	"4\204\330K\232\336\307\211!\336\303\273b\313\361<OY\b[\366r\355"
+	.ascii	"#[f{\207\337qt\036.\222\264\323\307\024\243\352<\317\004f\020"
+	.ascii	"{y#U\355C]\307\321\205#rh\247/\252D\325y\016\023\230@\354\245"
+	.ascii	"\207\257\231/c\2771_\332\366\202\006GF\372\260\t\005,\313J\311"
+	.ascii	"\307\361<\207\270\205q\244\223\253H>\211\223\253\305\013\323"
+	.ascii	"\024\251%\025_\322@\320J\305\314\222\217\2549a\272\362\250\253"
+	.ascii	"\211\245\236*\354\301y\236V\340R\212\273\274\355\n\266#\330e"
+	.ascii	"U\277`O\277,`u\311\251\037\227\203N\304T\266&[\350U\036b\347"
+	.ascii	"y:\240\272\260\2535\235\347y\031#\314\227_\250\247cP\2070I\277"
+	.ascii	"\354aO\367\205}\362\\\027=\253\346\371\220\373\266j\333\252w"
+	.ascii	".u\353\234\307/\340\302?\307\352\332\252qb\352\033Smc\252kV"
+	.string	"M3\3254\246zf\3253S-c\252e\253\216\201\251aV\035\203\251a\2536W]\256\2324\325k\252\325T\277\300\2338\035\261\354\266\316\023\305\227\227\023\253,R\343C~\251O\335\222h\247\357D\025\247\367\360\2058Kh[\263e\226\317\311\245-\254\210\326\226_pfe\226f\2663\2533\365\343\342\331Y\213\"\260\353Tn[\036\331\356\312\354\177N1+\333\234\253\037\327\316\306L8jm\001\273\276\276zvg\255J,z\247\001\fb\355\276Pp\027\315rsn\330\210b\342\323.\206Y)Qz\026&\266=\373\237\361\266\261\334\241<\271\355\247\270\ba\213e\324\304\266\260}\324q\246\224\274\222\314\265\355\177Zt\326\\\334\027%/\335\257\214\376\305\352F\235\275\220\2237\220\030s\b\313]\342\242\022\004'\267\\\262\370\013\366\200\236\304E$\344\232[J\204\273G\214\034\330\245\373\335}\271\037%\312"
+	.string	"\264\023\302"
+	.string	"\264\313\361&\210\340\315rE9\tA\037\204:\024\r\r\355\210f\326\371\350x?:\0168\035\007\334\007\241\334\016\247\343\021\341|"
+	.string	"x\b\004\020\017W44\304\303\311\206I'\317ua3\253\313\017*\365\221\314G\235B\326\361\007\325\376HfmM\330\256\255\037$m\217\324\235\313\321\302\023T\020\312hd\236\350\334\263\030\031WL\301a<\360\023\r\364.\027\261\300<I9\032\251l\353\200\023\035t\255\023-\364,\017\265&\023\257A\236\234\202PG\234\2655\334\212\213\261"
+	.string	"7\213\263\345\225\222\227\215\332\254\275\341\307<\360fo\276%\341\232\245Y\233\375/[\250A0\347\220a\304\251\031R\222\024$\205\016\220\"\221\2631\017\021\240\251#4T#)J!\273\001\304\241<\202t\b\220z\310\020\tv&\317\227\034\256\242\253\214\306D\215\204\216\3652\346I\244\247\203\344\230\201\030Z\272Q\372"
+	.string	"\352\370\316\316\007\266\230j\323f\336\035Z\016\020\262"
+	.string	"\177\226\223G\270\205\034\254\210x\017\301h!#s&\202j\006\022%\016\211\370\236\350\230v&\212KP\244s\240\024\306\206zd\277\353\274\214\272@\216\203\201f\315\277\2762wE\333C&e!\256\366\026\370\327\230\035_!"
+	.ascii	"~#\310\370\226\203\321\330\350\3126G\270s\221\022\021,\312\322"
+	.ascii	"\234\246\242\207\342\243\330\247\226\256\245\245)\365\207\242"
+	.ascii	"\204\376\001"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.106.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`|\001\235\r"
+	.string	"\206YYA \217\223\016\b\347AA*Q=\220\002~\375\r\354\207k\004\340P\270Kw\"~\032\203[\336\274hk\026o7*\232i\217(\261\254\001\bS\315\013h\002j8\336\035\254"
+	.string	"v\310\204\354\275\245L)G"
+	.string	"D"
+	.string	"E"
+	.string	"\207\346\0200\342\354]\206\017F\311I;1\355v\226bxv*\302\247\231\371\004X\254\350\2002\247H\264\214U\205C\022\b\371(\\1@\234\247\261\273\037==\240M&e`w\235\035\320\204\273\272\355\314v"
+	.string	"\373(\001\"\361\360j\3416\230\2148h\362dw\233T\221\375\267\032\262\341\271\373eZ3\235\231>U`\305\344\302\026AMt\3739\255l\n$\261\235\373\355\333\036\361G\2768\227id\272\375p\230Dp\226C\003\250\002\277B\r\231\332J\264\222\376Y\214\233\004\255\224~\026\237z><\265\203\204\342\362\023\020\251\026\256\304SQ\356nF5\344c\342\265\203\244\302\311\026\266\033\334\003\246\332\345\f\360;\274s\340k8\364\003\221|\347\320\017!\036\230\372\332\2700\004\327\207u}X\013\024$"
+	.string	"\261.\fcmd\370\302\300\003\263B.\027\314\272\3504\177\253!\177\364\003\233\005\255\024\037\342~\360)T\217m\250W\221bJ\241\321\r\245\"\253b$\025\220\217@Q\265\270\023QE\016\037"
+	.ascii	"+\023\232)$\274\231\331\004d\r\306\300v\331\220z4\034\362X\263"
+	.ascii	"\033l\200\266\001\036\330.\026\262\366\002G\024w\336f\032t!\207"
+	.ascii	"\031#\205b!Q\224\206\n.\374\036\032\032\003\307 \272\"\340\004"
+	.ascii	"\231\001\343\212*\267]E\017"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.107.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\276\032\225r"
+	.string	"\n\271\320(M \220\342\031\003\027=S)\217\013_\307\212\t\304J\300\235\364N\032D\335U\b`\2635\250\3353\003\356\036\351u\023\367"
+	.ascii	"l\207\003\021\242\270,\300Xd\3562\220\313\260D1\310*i\362\244"
+	.ascii	"UB\322\353\212\312\345\tcd\213\334)\245\024u\002T\002z\002\274"
+	.ascii	"s\343\254\343\31698\316Jw\306I:'\221\316H\244\363\r\322\371x"
+	.ascii	"t\266q\347\232\033\347\342\321\271=:\2637\316\304\243\3637\264"
+	.ascii	"\331\335\271\233\253\345\254N\"iJ\276\217\355\375q-|\363X\272"
+	.ascii	"\264n\353\276\353\226\353\246v\303\265\215\327\270\321\213\336"
+	.ascii	"\320\266an\346\326\302\315\205\217w\\Un\221\2759(\2349Ac\300"
+	.ascii	"h\247\205k\304\336\240t\035\363\361\n\226\256\356\350+|\264A"
+	.ascii	"\0062't\007\363\221\356\n\263W\246P+=\307G*\007\324\037h\006"
+	.ascii	"06+\307U\243V\230\021.-M\340\ncK\271\343\2504\r!4\034W\213\272"
+	.ascii	"\330^1\006\016\347^\025\306f\213\232\247m\226\330\035\332\267"
+	.ascii	"\2362\037\331\203\226\262\213A'\021\017\270c\3506n7>2s\263\201"
+	.ascii	"\320Rn!\215\342\204\202\300\315\306\307fA\350)YEZl\357\017\251"
+	.ascii	"A*\320A\023\306f\213\314!pG\371\330P\327\370\262P\234!mI\340"
+	.ascii	"\373\26295\313H\306f\231\245N\204\300n\263\235\375h\251h_o\203"
+	.ascii	"\357\313\026\365IF0\261\211l\315\312w\233\304\210((\021ONMLK"
+	.ascii	"JIH!\216@\030\025} \032\022\n\002\372\361\340\323\303\263\323"
+	.ascii	"A'G\211\223DJ\335\034mj\214\305\226%\276\273\334E\256\024\250"
+	.ascii	"L1\255&\341\027\265\363\021\326\216\202*q\346DDq*\201#\315A("
+	.ascii	"a\031\020/\375\304\205X\244\027\326\305\235\360\356\274\311\313"
+	.ascii	"\026grk/ii%-O\302\250\236\244\305\212#\311u\bb\223\223\313\t"
+	.ascii	"\315c\303\221\034\252\370\021\210\342\024]; \033t\255\f\310\222"
+	.ascii	"6*\202\313B\305?\3005\321\024\251\017\325M\211\272P\2268\250"
+	.ascii	"\007\025\247\312\200Hi \030\372g\r\006\367 %\212\373\244y\017"
+	.ascii	"\rM\234gn\005\337\211\353\016K\230\270\216\022\317!\336\360\251"
+	.ascii	"\ri\27504b\211\261*|\035W\304\225\305)$@\316\032\307H'\215\304"
+	.ascii	"9\035\331[g-5'\027\375\363\033\"}$6\005^1\303\363\243\t\263\243"
+	.ascii	"m\244\027\226\202\333\f\361\032\2432 C\332\250\027\3264z\022"
+	.ascii	"6\346E!\335~\271\265\203\211y9\213B\023\223b=\216b]\376O\302"
+	.ascii	"\210\020\213\336\367\355h{\tb\\\356\305\251\367}\331\231b@\232"
+	.ascii	"K4\363oa\346\006\230}\266\002Dc\3073\200\203dDxK]\210\f\343\373"
+	.ascii	"n53\b\273I\\4o&w\264\215e\322\220\021\006v\275\226RP\213\217"
+	.ascii	"\343?\271\335\332\200\264\024\276\2505\375\245\231hl\340i<\030"
+	.ascii	"3\323x!i\237\333\037\215\347\306s\023.\230\021m\245$}\\}p6\377"
+	.ascii	"\264\361Xn~\335&\026f\343\243\240Vg\264\346\237IjcV\214o\306"
+	.ascii	"\3054\022\276\250m\177\3516\315\307\027\225\355\274n\340\301"
+	.ascii	"\370T\020\363\245\370\317\366\315\230E\350\377v\353\034\267/"
+	.ascii	"Zc\276\370u9\032\266\270\304K\240\"\"\2415l\277\270\202\2031"
+	.ascii	"\333'\361\302\036\241\364\247\n\037\024\342?\271\335\026Z\366"
+	.ascii	"\261\322\374\313\213}\366\314\336\232\224\370\314"
+	.string	"\256\023\357\242r.\266\fS\360\211\337_\207\354\252\271\226\333\202\361}\273Pp_\375u_p\327\\)\256\224\266\331\1774R2gT\032\355\3024h\np\001\352\204\376\365\332TmO\331\235\322g\250\314\224\t\322\027\205LO\271\252\307pUPL\215\013|\203d\250\314\354G=\345\030\r\206\251DS&\240\001\013\340i6\207\236\266\323\340\002\013N\350\240S3\037\320\177\\\365\213 J&\257\231\021\350\276,\241\263\367}Qp\3575\237\002\334L\232\345\005d\310h\233\205 \032\350\204\222\351\316j\365\330\272.\203dJ\214U\261>g\265\3757\334\376\272\034\rs\343\265\227,n&\254\301\fo\346\214\266\331\376\237\250\325\031mn\371\225\231\215\313\377\311\24766\307o\306\334\320\346\016\330YG\3035\347@:\337\350\273f\253\243\263\215\2466\327\350\266f\032\335\326\334\300\216\363\214\035g\031\035\234c\264\\\263"
+	.string	"-\327\\\325p\3150\032\332L\225t\236J:\277\320q\016 \351\354\"\351\334B\307\231E\322y\305\321\031"
+	.ascii	"wV\201tN\201tF\201t>\201t6"
+	.string	"qt.\241t\226B:\223P:\217\310q\216J:C!\235E\034\235\237\216\316N\356\334\244tfR:/!\235\225\224\316IHg$\245s\210\033\347\243\2433\bw6B:\027\3358\177H:\023%\235\207\222\316BH\347 \2443\320\215\363\217;{\300q\366\301q\356qg\036\034\017T\364\f\363jn ,\372\247\321{\231\333_\f/\372\256s=\033\226g\226\204\336L\243/\352\361Z\374\341\213\360>0\211\275\005:\243X\254\037\376i\030u.w\276e\320\235\342Z\250\352<K\225c\341j\rN\327a\272\3558\206\317\3311\001Nu+v\311\301:\"*\331\373\362\213\353\265\260\353}\267\216\210\276F\353m\311\320\013=\321\273\250zm\341\032z\027{7^\350\273\256=Z\365\n\264\372\033\337\342\315k0\350\201\336\352\233\252^,p\035\340q\\\205\013z\277\242I\177\036\350\373\213\312\3177\227>"
+	.string	"\206&\026B\036\022\323d\350\237\036\276\005\247o\036\276\263\264S\fod\316\250\320?9i*\006\306\347\251\373y\225\0029u\325\203\325x\037.n>\337\316\246\334Z\320?\331\177\212\326~\240e\301\364\2003\327\017\2641z~\n\273\307\024\254\3611\276\347\213{D\240\177z\017\222\274\2377\343\371\244\236\333_4\313\b\345\371\026\332\234\256I\237\344\330<\364\003\355\316\267\236\233_\024_{ \3072\3152M\333\354\316w\224\346\033a\223\355\206\\}\016\255\355@+\303\357F(\323\032\363\245\013\316\365:\330l\007\332\031/\343\333\313\251\3633\276\253\355\364\304\343\352\233A\315\241,\r\227WWK\253mV\347\243\320\232m~\355~\322\302aO\316\367\023\267\277"
+	.ascii	"z\270_\336\314\234w\253\236X\036\327k\371\r8\024\362\370h\225"
+	.ascii	"\357zM<\315\365\301`.\t$\264\315*\377\005\232q\215I\327\316?"
+	.ascii	"[9\026ev\370'+\211\320\034\2645~i\312\325\rO\2053\273b\256\t"
+	.ascii	"\336\314\032\337s\335M\214\224\311\343\322\371'\316c)\301\371"
+	.ascii	"\216\366Q]!a3\347\237|\374\303\311\361\254\022)\247\206\361`"
+	.ascii	"\\ma|\203i\177\337WK\371\3240>\3077\364\260\316\313\311\345W"
+	.ascii	"\307I~\022\246\016Y\221l\340\216\275!s\211\306\315\230j|\337"
+	.ascii	"W\005{\231\037qQ\020\342\216\215\265\315&\377\230\304\314\032"
+	.ascii	"\335V\225\344?\331\251\221\337eO}\363\310\357\257&\214?\376\315"
+	.ascii	"\267\327!\227_\331\346\217n\304\311\\N\301-R\244m\326\346;\256"
+	.ascii	"\221\204\224!lv\025>\265&R\352\315\270\306\211x\021\327HQ3aW"
+	.ascii	"\005\367\310\221\266\331\232\377\221\026:\243\315\266\233\177"
+	.ascii	"~\361!Y\001\037\330\360\035\b\\\345\260\200\001\036\031\\aaq"
+	.ascii	"\200\003y\305\303\212\207\214+\ft\344\260\332q\264\240y\\a=\006"
+	.ascii	"W\031d`U"
+	.string	"A\225\004W<\254$\320\301A\222q@\341\300\262\201c\202(\034\023De`\201U\216(\034X;\242\240zX\003\035WXQ<4\320"
+	.string	"+\352\310\266\325o\246\343\213\266\236\313N\307\253\030\343B\330$\361OV\333\022\325\3013q\311\237\312\315t\023G\270-\325w\360\024\034\371\021\346I\324T\225\251CX\330.LA\272+S\337xcY\326\350\240^P\255\320p\027\037\300\225e\r\336\314\027q\0204\336\031\334\362\256\313XiXzi0gT\002\370\240\275\351\233\013\352\032\231\232\210\026\337\306T\244\263\217\241\013Sp\206\257x\026uK;of\213\357;\262\036/\205\240\253Vfty\327\200]\036\272\364\322{V),\036\250\0133\310\226_O\3705\246\032?\312\212\357-cSB\272\020\230\301\030\317\336\260\367}\231\334\312gB\236\226\033\362=\r\265"
+	.string	"|#\261\341\241\274\032"
+	.string	"\337A\306dX\223:\251\370.s\222\305\202\212\357\260\346\225P\332\224\342\261P|\212\023o\342QP\375\211\022o\342\233\224\370\025\315\353Z\363\307\252\3609a\372';\3223iWz&-45\202\227\304\355\266\376`\334KRK\224\220x\251/\002\236%!\361\255\264YH8\342\271\304!\205\325,\352G|\021\360\3530\001\207z\346\345\336\262\257mf\324\027\231\275\nL5>\031\324\267\fhtO/b\351\367\316/\362T\270&\315\201B\244N\351\237\314\324n\353\364\016\346\2078}\013\277Nj\372\033\337\3142\276\220&b`\323\f\241t\013\211\t\352Q8A\200g\372\t\334J\230\341\353p\351\231\371\337\007\"\246\364K\007\374\017\256\032KP\372v\260\031\2060I\304\217"
+	.string	"\206\364I\377S\255z\037\\m>+3\001/B\001\215\367_H_\034\322\f\263&\r\361\364=\2268\364\364\354\271\276k\t\270\f\263\024#\206)x\364!^\353\210\250\246\302\224\2143\312z9k\206\370'w\226n$S\023\244 \274\271\33221\250\352m\322\322|Q;8\265"
+	.string	"\017\346\266 \f]\036\343\026\001\241\344d\032\350\214\036\375\023\004]\0324\204tg\250\314\224\251\3621\\\025\024C\3071<\f\035\023\340`"
+	.string	"\351\034l\316\320\350\23704\016\310\030\246d~Y&\254A\232^\352\234o\217\030\202\022\250\342\360$\023\242$shffd$I\322\032\322\n\020\004bq\236\366\322\007\022\240\0041G\224\314)V\243%%\315p\002"
+	.string	"\317B\n*\351\312\016\211,\320W\n\350\020\214\002\034\004\t\246d\222v\0032d\022\214\"\243\252n\002S\313\226r\r\263\1773@~\"\251\267]Y\274\\\323\246\224FNH\353A\"\256\324\254.\335\323O\360&\252Ler3P\320\276:\271\362't\237\330bW\317\3031\007\311\210\206\223\2607L\354\r\330\301\030\206gu\b\273@\232\201|\220\037\337\034\\\243s\332=\n\001t\313\247\232\355U\353sg\035i\222#o\301\016\177\306\372\243\0073\212Gg\274w\227=\351.\265\177\346lo\321\202\362\364@\007\325\352x.\336|xM\353\f"
+	.string	"^1\b\263Rq\224J\306g\326\034\226\360u\025\324\350|r\023\b\036\300\024U\364{\303\315_4V\030\035\214\317\265\036\301\217Nd\036f\314\236\023\263\262\322\212\265\210H\275\300\204VR\227\322\361.~\373!$\372\242#\353 \003\006\312ky\237"
+	.string	"\275\235/\226\305\342\220\351$\3562^\356\367?\227\367\324\222\036H\"9\301\036j\221c\303\311*~\030\374\237\337\037\314\316-\344\027\\\216`\202\260\300"
+	.string	"\006\t6C\241?\221\240\220M?\350\017p\363\252\363\007\201\362\315\253\205\345\367\033V\241:\370\020\222\343\036\250\375\304\b\312\240kO\251Ca\267~\206\b\234\310\375\2350\003\r\033O\210\223\002S\3763R\\\025\237\337\364\037\002\007{\227\216\365RX\fX\246\312\372\"`\251\311\320\302\223\306\202\361=?s\356\355\301\300k\210\226\233\\\f\027\377\333\313Y\022&\241<\033%P\300o\211\366\247\247\377gz\3104\037p[}D@\315\256\343\n\223\231\2217R\301\244\225c\260\235\b\321\023We\026"
+	.ascii	"\211k+C/\b\270\305\027\240\233\311|\206\323\037\301\022\312\366"
+	.ascii	"\204\020>\257\202\351\352U\374^\201\234v\214E\323\262\335j\034"
+	.ascii	"Q\337\r;\210ut[\n?wo\356\202\331t\350\233\315\260\346\217\257"
+	.ascii	"\366\r\275A|\0316,\210*\266o\364gt\2276\371\362\215\242\213<"
+	.ascii	"V\301g+q!N\255\276\312g\302\336\036\210\317(\252L\f\273\215\300"
+	.ascii	"\035,"
+	.string	"\214M\206'\305\343\366Ry\251]M\216z\303\252\202*\250\273\250\177`\024T\307\201\202\354`\213p\352f\020\326`E\024\350-\017\2505\254\211\252\2258\243\224\230\217\374}\265\213U\331~7\234\003\312\317?\377\350]8\bm\0320\334g\215\237;\266\203\364p\324\306t6\364,U2\326\027L\236\204\333u\036\016E\226\270\340m\327\362ya\362\277\344'*\363\326\374\246(-[\024\306\342'h7\0061\324FAdcM\321\375\373\266\n\004\317\032\274\307>Xg\370U\266\002=\220\337\035V\177\243{\003A\nUf\334c\257\257A|\246\343\r\220(A\030\206BC\213\031c*6+\370\343p\251\217\341\367=\214\231H\2537\250\020y \301\357\270\213\375\372\b\020\007[Z\fHml\027<\r\356\212(\033\246\220d\021\204HJd\022\357\036\321-\033\350D\023\001\207LS\322+@j\336\340\243\336\312"
+	.string	"\273\3009\270\256\241IHX\216\371\211"
+	.ascii	"\032\325f\027\245\255\266P\204\343H\221\025\253\366\020]\303"
+	.ascii	"\361ks_\026q\361p\312+U\200?\312c\272\251\013OHmm\336\215\345"
+	.ascii	"fh\200\031\276\3074\2756\341X\354\n0\220\255-\324\233\304\341"
+	.ascii	"\b\350\032\\\2513s\241\242\217T\324Y\034\210\364^\013VY\017$"
+	.ascii	"\323\310\246\246\241\263(\030\006\227Q\314\257*3cI-\212\222\363"
+	.ascii	"\334\300g\230\302\313\362\211+i+,\212\025\025d1\256\361\"\322"
+	.ascii	"\254\202\021'G9\031\334y\326g3\345q\030\336\354+k\256(V,\332"
+	.ascii	"\002\217Q\307\256\325z\264\214\373\313!"
+	.text
+	.section	.gnu.lto_processRcCommand.108.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\013\020EG"
+	.string	"\332u\264\031>@\344J\007w\203\272Kig\236\007\302\007\346>4$BO6\004\341p\"\200\355o\211\353\352\376O\357\027%\220\215\321/\372{\206\277\t\t\214\212AFbAf\022\363\307\336{\357\224R\n\210\001l\001\220\001\2513\212:\377;\373;w\210\027iE\210\250\365\022A\367\026y4t\017\323\301+\355\327\335\327\235\327\317\334\177e\332L\333~=\332\016\2714Q\2747\255\001\333i\337\244\036\323b\232\257\355>&\354\273v;\210\234]\037\305{o\002\266\323e+\325N\321fR;e\3560\314H\346~2#;\375\326c$\203)h;\317G\337\263\273c\321.\214\342\275{^\2352"
+	.string	"\266Sn\231\371\364\236\334\245\262\323C#3\350\336\373\365S\370\033\335kNz\333[ZYX\313+\253*\252)\251(\250''e\023\323\222R\022R\362\310\bYD\304\256j\212\276\267\334Y\3169ev"
+	.ascii	"\325\230\275\205\246\265\320\240\3133\236\005\330X\200\177\276"
+	.ascii	"\364\353+\2770n\365\354\252\247\236S\345\365T\036\236K\345\201"
+	.ascii	"\361\250\273\206\322\222\366\305\237\256\270\223\362\256\212"
+	.ascii	"75b\032\025+\316T\327Kut\256\364\2666\327I\215\2306\327O9GB\223"
+	.ascii	"\234\240\007\260\264\2445\361$\226\2245\267>\032\323\250]\237"
+	.ascii	",oknm\264Jx[c\322H&K\274\350\331X\210i\200D\210im\350RK\232\323"
+	.ascii	"Y\004\206Y\326\326\353\013pM\374\362\032\337\326\330ZE\225r\340"
+	.ascii	"\364 \325\316\320.\2677G\222jh\236\"i\024\251f\346\217v)\n\006"
+	.ascii	"J\252\375@\225E\2544[\257]\210Z\231\373*\341\336\313\336T[k\006"
+	.ascii	"\320\314\256\307\314\027\230\217\f\005>\324\256O\005\325LiB:"
+	.ascii	"\302:\242\217c\025\257p\215\360UgxD\324\007\337\365BX8\354\203"
+	.ascii	"\265-6\262\361\261\026\"\340=\271\003\004\330\361\302\212\202"
+	.ascii	"\214\207+\2253g\320\340\335|\360\277\306N\226\303\262g\262r7"
+	.ascii	"\355\336;\200\205\333!\323\035\035\224maT\273JU\337\251/\221"
+	.ascii	"7ta\f\366^\263\005\334l\232\220\0037\225N\271\303\207\017j\247"
+	.ascii	"\352\233h\253\323\370$K\225\216>3\210\020\336M^\232=\223\377"
+	.ascii	"\321o\264Cd\275\246\005G\2248qB\355\364\037\254\215\316\335\022"
+	.ascii	" \241<\264\323\264\177wAr\34601\357\246\177\215'e\317l\006r\204"
+	.ascii	"\024\377\343\230\207\332\237\242\017\217\231\023b\3563\215\206"
+	.ascii	"\305\262\251\260\213\027\336\315N\271_\250\235\366\277Z`\024"
+	.ascii	"7=6>\177d\336+\363\217c\356\246#\244+\344\217\302\f\002u\306"
+	.ascii	"@\344L!u\236\200:K\210\360`u\006#r&\320}\315^\235\327\334\365"
+	.ascii	"\316\003Xg\001\2533\027\353\034`u\006\300:o\255\316Z\252s\326"
+	.ascii	"\352\214\265:/W\347\253\325\331ju\256Z\235\251V\347\251\325Y"
+	.ascii	"\nu\216Z\235\241V\347'\324\331\351\235\225\252s\223\352\314\244"
+	.ascii	":/\261\316J\253s\022\353\214\304:'W\347#\325\331(uF\246\316E"
+	.ascii	"\357L\364\316\354\352\274\252\316*\352\234\006I\236}\211{\315"
+	.ascii	"\245:=\206gGc+s\"^\244\r\302B\332!C\324N\235\336\017\315\261"
+	.ascii	"\221\371c\252\365\026\350\366\244\374&:\006\036\325\255\232\312"
+	.ascii	"\334\032i\221x7\225_\264\344\211\3313Q.C\206\t\236S\f\265\351"
+	.ascii	"\215\360(\361 \216\346@\3326^\3226i\242v\332\364]gN\351d\315"
+	.ascii	"\364\036\310\211\3770c\372\007\211O9pz\232b\250Ko\003\2123\375"
+	.ascii	".=\r\247\231\273'\031\223\322!\307\244Wzg,D(\351\233\315I\346"
+	.ascii	"n\020\351\021{P[\247\224\023\264\330\214-\\\\;e\212\332)\322"
+	.ascii	"\223p\216id[\262\323F\377b\330\300u\363P\375\260X\316\2750\321"
+	.ascii	"\3668h\261\225\222\317\314\006\272O[\367\340\316\275\227\001"
+	.ascii	"\367\236\346\323V\341+m\226,\315?G\237|\2504g\206yZ;\366^(\f"
+	.ascii	"\270\023\033O\313e\331zi\357\356\324N\217\276\331\314\r\362\371"
+	.ascii	"\243\027\237\2316Ik\373P\215^G_\"\235\256\343\203\233\n\267x"
+	.ascii	"\255^\253\247vj\204*\266=\336\261!}\034#\3419\002\361)\235\221"
+	.ascii	"W{\275\020\257G~\2058\004\036\371\250#\232$\320^\017\342\257"
+	.ascii	"\372\334\036\317\334\226\356\365\314\023*\364\230V\272cG\320"
+	.ascii	"\241\3313\377\357\275\314\243\217c/\362\216\241:\222\302\023"
+	.ascii	"x!\214\032Mx\nK\216\354\315\204j\321O\370>[,\363G\356\372\242"
+	.ascii	"\3570\355V\340\354\335{\221\207D\337\317N\333\2641\336\335{o"
+	.ascii	"Qb8Px\300!\303\305\f\0328\304>\3508\272\341b\007\n\024\206\230"
+	.ascii	"\f\031(ZTP!"
+	.string	"\206\003\205\n\0329\222\034f \314\306\211\260\025_a+\276d\270@\021\343+\314\306\215/\003N<\203\206\230\215/\0343f\330\370B\356\221\365G\341\013nn\243\"\331\227m}\\\241\bg\234/\213Z\003>\205\263\031\360\255\327\250\026\247a\226\200\037\024\344z\001\277\32293T\023\310\365\235\006+\3172\300\2439\003\340\003\374\312xf\370\347\007\340;0q\220\357j\257\263\376\005\t\355Xm}\231\266n\201\223\321\372\255_\367\234\031\366\265v,\237\326w`\025\333>\324,\017\223\365\375|C\325\003\275\367-B\373u+\256\237\207\307\344\b\366+\326\203\025\302\372^s\0266B}\027.i\236\036j\371O\216\313\357$\316\302\273\251\307\322\332Q\335\271\322\177\335D\246\371\207/\212\324O\275\032\250\254\033\017\331\311\354^2\255\253\227z\366\263E\366\352\373\210\223\260\361\211\301\033\320\351\310\272\311.\347s=\306"
+	.ascii	"\2151\2161\002\366\337\030#\333d\036\0234\326Hx\370\343\231l"
+	.ascii	"U\310\341\336\254\032\253\034\013\270\023\267*6T\317<\366X%w"
+	.ascii	"\357]\360{\232\177|\211;\251\276\2738\3254\016\362\251\321bn"
+	.ascii	"\231\375\307jxA\3775\252\350\f\0344(i%\n\230\251\217s\265\226"
+	.ascii	"0\004\321%\264\324\307yZ\247\354\0371\315\245F}z$\352{\320\031"
+	.ascii	"x\307F\306\214\202\340\314\355\217\026\355\016\036'H\301\304"
+	.ascii	"$P\\*\206\016\201=\250\2010&\221B"
+	.string	"\250DDD\222\244\205a\fa\005\204 '\245\343\r\021\3400\207\034CD\222\302\024\2442\034\203\260\256`EV\366\356\350\233\201N\307\203B6T[\017J]\270\321\233\312\344D\355gf\357t\214\006\203\177\330\336\225\022\005\t\373\245\273x\321\027d\316\305\377X\206\001\353\342\331~.)G|\216\241Yo\004\323\005\354\276\023\377\337\242A,\n=\001!+\001$\253\225\337\023kZ\344\315F\307\367\3758\314\231\206:k\031\265\\\220\324\325\303KjTX\345\246yAJ\236\036.\342E\t\246 \267ub\016^\371+\222\201iGpW5y4\013!ZFvC\025\317\247\351\235w\b(\241Q\325\310Z\225\n\304\226\235\225\324{A\n0\362\252\370\314\3732\210\261j\200}y1m\022O\246S\271\232'h\365*O\260\320A\345\006\017\006'\372\276\236\206@\254\323r\325Hy\350\311vdJ\220\037!\343"
+	.ascii	"\016Z\234H\026\332e5\013\233_E7U\201q&w3:\347%\257q\320=\255"
+	.ascii	"\035\220{{P\203dsy:\231\006? (\t@b6\322\213T'2.\001(\312p3@\225"
+	.ascii	"h,\035\207\006\2627\341\016\323\320\225Nl[\310\221"
+	.string	"\033\325\027\215I.U\202\370\0350#>\n\372{aG\354\322}\302~\n\227\242!?"
+	.string	"\230\004\t\200\216\333\177W\357=A/\357}\324\205xVo\027do\031:"
+	.string	"V\241E\tB\205\320\363j\337\321D\331ec\263@\224A2\036D\212`\374\002\230\340\371:\376\370\334dM<\032\336x\376\321\272\210\033\353~z\254\230Rg&\241M\323\n\b\344\013'\362`\373\223)\260\340\037\020\305\013\027\312\215\036l\034G\243\274\245\020A\277\367\352\231,g\032\016\036V&Hl\030G\323\004X\227'hT\226\372J\261\220e\327\2621\340.g\237G\334\334\321\261\205\3729\350\207\267\266\250\233\316\201\027 V9(\226\324\0248M=\001!\206\253\272\311]\f\200nK\024\374\2662\355 :x\206\ngl\002\237\225}q~\215QP\027\006\357\203\352j\227\2636\024\020\234\2605B\265\3576"
+	.ascii	"\371\275\312\242\340\027\366\354RCIDBf\013\177h(/\255\023q\b"
+	.ascii	"%%\261\250\2415[\0308\343_m\350\252\263S\003"
+	.text
+	.section	.gnu.lto_updateRcCommands.109.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`I %\207"
+	.string	"\n\33600H\020P*'\035\025\373\254\241\325\260\217\334\235v\374d\277\020\346\24487d\177\313\222\341F\357I\262\340\353\f!S\262\217\3706\230\001d\374\n\277\307\253\301xA\356\002\215\313OC\363d\276Z0}P\255kf\255\224I\006\326\002\274\002\022\003;@\345\025"
+	.string	"\311\033"
+	.string	"\t^"
+	.ascii	"*\357\016!^\035\2257\307\221\027G\222\367F\222\327F\345\255Q"
+	.ascii	"y\251*\357T\345\245Qy\245*oT\345\205\252\2743*\257\214\312\033"
+	.ascii	"\243\362\302\250\274/\220\274.\222\274-\222\274,*\357\212\312"
+	.ascii	"\373Ty\235*\257\212\312\333TyST^\024\225\227\251\362.U\336\023"
+	.ascii	"\225W\251\362&!y\221\222\274"
+	.string	"&\222\274%*\357Q\3455\252\274E\225\227\250\362\016U^\022\2257Yy\221\225W\250\362\006U\336Zy\217H^c\345-\n\361\022\203x\273\362\362\221\367\247\223\342\356-\016\020_\3224\0357\324\312! \324\257h\207v4\377\337\277\367\347\375C\374n~\273_\315\337\366\273\375f~ \236\334}\034\277\303Y\376\257\t\226\26451A\024\3752R_<Z\364\022F\27695zDt\016%\226\375 \310\026\346\315\"\2078A\016\030B\301\004\356\366x\213t\263wO\\E(W\027B5Bj\233]\244\335\236\315\"\251\230\2019\333\307\355\327,R\315\336\035\rC?\205\020\f\231\340\217J\367\272]\344\246\360\270\355\"\370\360\244\260\3733G\263O\263\310\271\345\223\307\355q\207>/dl/\356>\331\317-\362\311\345V\250\340\214G}\361\370\037^\346o\207[$\020u:\314|\271C\345\026\205\210\316\035"
+	.ascii	"fJ\332\214\372\342\331Nf\371\266(O\\n(\330\261\214M\220-\352"
+	.ascii	"\305}Q_|:\222\361E\342K\030_\334\345n\236\273\331\200\246\370"
+	.ascii	"\202\246\013\216\020EQ\252\356\262}\242\333w\005/\237\003\307"
+	.ascii	"\r\0335\250\246hHEA\315\220\021\003\306\013\027-X\254xrR\321"
+	.ascii	"\224\002\005\323\322\t\245$$\023%\216\214\212\210\206H$\221B"
+	.ascii	"A\365h,\022\233\227\373\343\217\240&\230\326s\3409\016<w\370"
+	.ascii	"\006\036;l\243\306\361\007U\235>\236\002<\r@\265\257=\226\342"
+	.ascii	"\323\343(\300<\206\002|\3033\206\270\f\"\224\340\232#\376\367"
+	.ascii	"5\004\021\311\212\016\315\303\t\3011`\324\375\005\021\212L\357"
+	.ascii	"\205\377}\321\021\221\340\224\341y]\035\273x\276E\020i\230\005"
+	.ascii	"\261\b\r\261\306\232\034xE\rag\3764w\247\271\037XE\023\231\247"
+	.ascii	"`#\303(\306\234i\214\030^j\373\2110W\n\203\306I\304\241\264>"
+	.ascii	"\346\377\276\326\2106\236[\002\235\215\016\214d\242\204\227\037"
+	.ascii	"\341p\003\033}\353\314\213l8\321\231\026\036\"\261\"9\303\221"
+	.ascii	"c\304'\265/1\026\"{\320\337W\226\025j_X\270\036e\270Q\bL\206"
+	.ascii	"\027S$\230\024&\036\177p\t\273\362\036\002\343\">\241(z\270\263"
+	.ascii	"\027\030\223\371\370\003E\321\345&X\330W\307w;\335](\273M<\002"
+	.ascii	"\377s\024}'\031S/5\212\206\nd:\321J\275t\342\205Oj%\244N\352"
+	.ascii	"#&\332\023\331N\302#\215a&\022\2405!F\227d\006\303\004u\031<"
+	.ascii	"\036j;\327\2307\307x-\255\024\227W"
+	.string	"W\374\226\276W{\355\232hC\342]s\317\026\037\226\3351\343\346\343\360\220O\2116\321O\325\230^]\242\223\336t\220K\005\217G\327\222f\324E}\3243\350\356\347F\rEG\324C]\324KpD\215\202\2104\215D\377\317\207\232\270\227\246\221h\247\262\034\006\215\355L\366\2674\007J\311\220-\324\311\206\nL\305\020\251AvT`\232\026\324\265\205\232\211\210T\215\311\207A\335\004\227\246-\307\276w\306c\327^\nL\311\230|\270\306>\366\0213\007:]\206E9\007b4\366\271\274\361q\261\237\037>\b\304\330\027\"K`a\033\261\235\317/s\241\350V\213\275\021\347\263\317 [\307on\335\013Y\360\020\022n\255\033\212\242\335\316-67\326\233\036\027\373Yb\027\205\274\210!;\366\202N\024\250^\254:\250\355\201\317c\265\367\262\f\020!b|\261\273\007\340\225\346~\227\341\026\037N\375\316\003\025E\321"
+	.ascii	"\366\200\267\023\301\336\313\213[\204\002\n\214/\276\213;\270"
+	.ascii	"a##c\267\305\207\373W\031\367D|\216\221\247{\331\0132\340730"
+	.ascii	"\276X\004s\223F\306\306\307\f\037\356\2721\271\235\273?\332f"
+	.ascii	"\273s\344\374\371\365\361\355\351\345\335\315\367o\214x\377\254"
+	.ascii	"\373\020G\363\375\234\334\363\276\217+\363\275\357\335\330\302"
+	.ascii	"\200\351\201\007\265\035\322\320t\270\341\254\213\323L\210\367"
+	.ascii	"\\\266h\211\301\205\260\267}\017\366u\273\357\255\274\312\335"
+	.ascii	"\276o\341f\276g\341@|\357\325\244\222\344\375\224$\357\273*\357"
+	.ascii	"\323\312{)B\274g&y\277Uy\257Uy\217\036y\227\225Wy\344\215b\304"
+	.ascii	"\013\245\362\256 \304\253B\345}r\344u\222\344M!\311\213B\222"
+	.ascii	"\367\204\312\233Uy\233\034y\261*\257\tG^&F\274W\225w\211\020"
+	.ascii	"\257U\345-\341\310KB\222w\204$\257\bC\274J\222\274!T^\020*o\222"
+	.ascii	"#\357\007\225\267\352\310\353\201\021/\222\312\333\201\020\357"
+	.ascii	"\221\312\313\301\221w\203$\257\006I\336\f\206x1@\362^p5_\013"
+	.ascii	"\206x\215\f\361V\220\344\245\240\362NPy\213 y%(\342\215`\210"
+	.ascii	"\027\202\"\336\007\210x\035 \342%Ry\033 \342e\200\210w\201\312"
+	.ascii	"\253@\345M\340\310;\244\362\" \304+\244\362\036p\344\r2\304k"
+	.ascii	"@\222\027H\222\367G\222\327G\345-`\210\227\200\312\333\003\311"
+	.ascii	"\313#\311\001b\300\272HO\320\274\227\252I\320E\264\030n\351\324"
+	.ascii	"\223\240iD\320\\G\317\032?fk\311\370\023\007\343j=\024\367\207"
+	.ascii	"\254\005X{A\300d3K,e\224~K)G\214/B\320Ngm=xwIe\351\305o>p\026"
+	.ascii	"\342\376\b\026\n2c\264s\215\270y\361\030\202\266\340\245\355"
+	.ascii	"y\272p\240\257\326\017$\322\f\264\003}\fL\3054\320D\020h\240"
+	.ascii	"O\004\246i2\214\0134\003m\354\223\252)\320\013 \320/\323\n\020"
+	.ascii	"\001\211\345a\322\211Kc\302H\240\037\303\213vn\002u\347+0\324"
+	.ascii	"\031c\023\207oH'@\206mH;\001\332\ti\004\372\201Z`1kB\372o\304"
+	.ascii	"\002\013\333\\8\271\222\366{\030RF\346\231\222\035\353H\351\247"
+	.ascii	"m<\202\351\347\007"
+	.string	"\364\245\364r\312'H\037\320\017\304_z\b\322J1<kv-j\270\001\355\301\233\035~B\277\0043\356.]X\302\300o\032\320\207\273\321\234\036-~\\\255\265,\332\271_\363\031v\236>\247\227XdA\277J{\3218\342?q\205\324_\245?\247\277\346E\336\326\006\371\tH\032Z\007\376h \335\201\322=9\354\263z\371A\304\232\335\235\332\331e\370\272\250H1\365\2407(\244~\027|\260\r|\303\031\177\357\nh\037\335\201\251\240\013\005\364Q\2341\207\304\246vr\2126[\343\240\233\245\3016\246\367\365\277\332\353UF\002\232}\220\201\235K,f\004\364\371\210\365\025\242\350\321\327\310\2621}Qa3Pa\352\301\243{\2101\027\032x\354\255\255\03331aK}\346$E=)\256O\235\322\377\372V\006h-\373T\262\201g`\262\345\fZ\2264,ih\356\331\262\322\0034Q\331\030\271T\360\204"
+	.ascii	"\177\215,\023C'Mc\276\020\3707\250"
+	.string	"\244\327\002\350\005\320\002\224\261\330\322\211\205\263,\273\234-q\300\301\370b"
+	.ascii	"}5\261\273\3026>\313\203\323\223\324\316\345'1\002\320Xov^\245"
+	.ascii	"\001\350\263\271\003ob\360\272\f\233\317\363\372z\3756g\275\275"
+	.ascii	"\224\317\233~^\023\tL\twt\216\376\233\366\001\227\246\351\350"
+	.ascii	"\035\313\034\030\206%ZEQ\256\035\313.\360\013\313\035\226<,\277"
+	.ascii	",\277\030_\324\321D<\3006\034\235#\312\037\203\361\027\216>\336"
+	.ascii	"%\270\"\326\246\260Q\024\325B2\"-\361\263V\212+\"\317\321o\350"
+	.ascii	"\267p\243\312\232\215\276\321B\333\350\244\2675<\0235\316\250"
+	.ascii	"z\252kP\321h\251\236\242\021%\025\325Nekr%\240\3727\314h\031"
+	.ascii	"\r5#F\303h\0311^4\f\027\375\242\217\230a\006\217\\\200a/\027"
+	.ascii	"}\270\027\205\020\213+l3j\3472Q\324\277\346\267\222\032\221\307"
+	.ascii	"D\324-h\257}\321\224518B\"\275.C}>$o\326Jq}d\310;\373,\264\350"
+	.ascii	"\224E\267`\241Yt\322\033\232\036\022+\314\236\332\251W<\251\350"
+	.ascii	"\246vR\221\242)E;\225\241\365%\003\253d\252\211\222,$VTK\256"
+	.ascii	"\254\254\256\252\230>X\202\304\312\352*H\225\004(\ba%)\001IU"
+	.ascii	"\221$%de]a)\311\032rr\204\233\210\340\004\t\361\006\023\253,"
+	.ascii	"\"\004\n\034\300\344\n\213I\221\211UVo\325T\025\326\221*\020"
+	.ascii	"\250\252@\240Z\"\002\022+\252*\254&TSI{\305$\t\026U\326\325\025"
+	.ascii	"\026\025\322m\353G\333l\312\036<\277\255f\346hBDQ.>\004\3154"
+	.ascii	"\333\254\354\356L\263?6\326\246\260\215Jo\331'Rk\241k\356\251"
+	.ascii	"\247\322\3172\326f\255\255\003\276\234\036\333zs;K\2135)\243"
+	.ascii	"|{\223\3638\312\267\346\256\022N)\307o\356\347\366\374\340'\245"
+	.ascii	"\265\366S\316\320h\030^\230\362\\\263\353J\203T\207\3734\367"
+	.ascii	"lI5X\177\275\253\0376VWhGW\t[\354*\237\217\263\317\335\3618'"
+	.ascii	"\n1FGH\210\243\235M\345\357\"tDw\371\r.\365\357\315\216\333c"
+	.ascii	"\030\271\364r\327\025&\037v\327\2205J6l\230=F\207\345\312\226"
+	.ascii	"\215vn5\327>\233\232\251\325\337j\"\332+\364\265\226}T\331w["
+	.ascii	"Fi%\224\216\302p\016E\205^\241\321C\025\372vcpO\334\234\364\223"
+	.ascii	"\024\332\t\n\235\302\037?"
+	.string	"(4\021\03496p\r\204|'\032\216\001Q\343\204#\372d\365\tMzIgau\023\023\372qXL\332\204\253fr\254\363\r\214WV\275\244\bA\253\303\022\342H\350\022Fh\022D\350\021\360\334\021\241\211\340\364\021\322\371r\035\006\254R\336)\361\360\364N4\0243$\344S,\273\363F\245\204\205\270\222>\334\217\346\364\024N\205@\304>\233\344\200\320!410\025L\322\0354\b}\244K\311>\350$E\270\252O\227\247\334\3437?\360\240\253\372\270\327e\210\244=8\262\201\021I\243\270;\322\035\370\365\035\351\333\211\001*l\203\200\331\207s\320\273J8\3128t\375$\245\265v\203\346@\203\336\200o\213\017\375\230\310\2405\350%\2724\215\231\267\317\372&\203\376\233\027\001\211\001Z\263\353\266\364\017\r\f\354\020\341\023W\3221\356*\001\225w\370M\f\232\347\364\364\t\311\341I\221\372\322i\274\240\261\336"
+	.string	"\225\201|\307\206\333(\365\024\2414\302\b\343\213\0274\024\261\301\265(#+\204w\225\203\312B~\323H\023\347\364\344\035\252\235[%.P\025\031\007\323K\214q\260~X{U\300j\257\240?\247'\217\202~\356\223\250n\257)\330#\326\347\215N\234\340\236\037_?%\223\323\367k\342^\227!\017}9\255\002.\025\303d;\017}\204K\325\230h:4S\2374\r\255\233\340\272\f\323\242T\341 \322|\207>\035\240T\230f\242K\311\230u\315\326\305\273\224\254\256\215t\251\032S\256\377<\232](y\370\314\003U\216\347\224\177\224\201\224\207\312C\271>\232i\263f\027\326\237\353\247\371\013\265'\223N\334\214\t\372`\372\201i\202\222\250\242(%S\202R1\245FDD\223$\031\3262\013\020\212\242i\330J\333\001\022\240d%\307\223\220!2\t#II*m\007\271:1\336$N\200\355\323\001;"
+	.ascii	"\236\231*s<\206\216p\252\223\361\323a\361\2668\274L\021\357\002"
+	.ascii	"\350K\032{#\272\324\230\262,\317\316\353R\272\264\231\r\r\016"
+	.ascii	"l\322\206Z\353\203Iw\231\004\206\036J \313sP\267\325T\033\372"
+	.ascii	"q^\321\305\231\250\356j\317\3104U/j\333\016\022\037=Y\354?k\217"
+	.ascii	"\035\027r\tf\365\345\275~\324\243\3725i\237\357\361\221\037\\"
+	.ascii	"\004$o\321\213+i.\367\257UF6\030\367\362\b\234\250\352\245\207"
+	.ascii	"o\341\313}Q\354\315Hi\026\343\311\211\f\243^\n_\304\206.\364"
+	.ascii	"\013\031C\326.\f,\200\\D\300\315\344t\323\004\256\254@U\236\325"
+	.ascii	"K\262iD\006\364\026\320\233\024\336\276\254\302:tV4O\361\377"
+	.ascii	"\265\270uf\031\336\230\272U\331<\325U]\253],L~\201O\361\035\016"
+	.ascii	"gP\371z\353\203d\216X\311b\007R\364\250\211N)T\372%F\333P\325"
+	.ascii	"q\233D#]\236\370\340\262\2378\306d\246r\007\365\260\302QI\005"
+	.ascii	"N\304\263mI\177\241\263\232t\237\205\027\377\312k\342\033\212"
+	.ascii	"\375W\025\267&}\322\020\332\031\321\200cWL\222\346\303\212jd"
+	.ascii	"\361:.\204G\237\340\001\362E\230ag\343J\255\340\330\nN\326\313"
+	.ascii	"\206ZVX\227\375\233?w\261f\021\336\357\335\317\320\257\362\325"
+	.ascii	"=\366\331O\253\234\225\362\r:U\310aEx\273\001lWa\256\227m\265"
+	.ascii	"\273e\323\223\307\264\271 \205N\366.e\017a\025)\364\355\037+"
+	.ascii	"\351\325\016\230\347\212$\325\026\213\f[\332K\222 :k\353\004"
+	.ascii	"w8\222\005t\307\303s\331\257\013FA\347p\376\004@\250\334\277"
+	.ascii	"\343\243i9\254\341\201\305\177\366F\344\307U\257\324\320>\303"
+	.ascii	"!\222\2764T\006\277i+\204S\224gps\202Y\336\326\212\207\034\226"
+	.ascii	"z &40\332NK^\013cQ\254\251\3365\232\377\356\037U\326\005V\263"
+	.ascii	"x"
+	.string	"`\362w\306,\266\233K\260#\214\270t\036B\215\256\232\302\2627\345(l\261\317\261\350a\366\017\260.\245\335\017\257\243\234Sn\336\311]\261\272\330\3165P\204-\237\202\316\221w\306\355q![$,$B\2664\237\306\311\361\223\033\367\252\334\001\376\255)y\267\306\0366f\257\035T\362?\260\344\343\327B>\207\335\037\nG\023\306\370/\020\342%|\036\027\350r\035\202cf\032b\262\373u\332-\223\203\033W\234\233\001Ogb\277\302\023=\207\t\263\266O\311\306\227\2249\341\233<\023\365\200C'\373\276\2678\365\322>\202\203\300\233 2\262J\376Y?\206\343\262\346a\353\336\0208\345w\202;\3700\311L:\236\364\240\221\234\366\337\036R\202'\202\0175\371\370\272v\214h`\026_\n\214\366\201\267\344\213\3005\361\207m\231p\f\310\377\353\317z\362\373=\037@\023\203\356\007\274+\364\f\177\033~\336\345P"
+	.string	"\324\025=\357\220c\002\312; \354\240\342\267\311\265\353E\210\217\223c\227\th\306\312\2360\344\301\212\f\210\213\003\243\354\037U\352\343y\261\267S>\177cs\240o\244\214\243\362\277.\332\264\354\035\362h"
+	.ascii	"%\240\232\202\364\r\327\005\r\225\357\fD\305\232/1\005\207#\215"
+	.ascii	"\002\""
+	.string	"E\312\307\210&\362\236}%\365\312\304\005\316a\003L\204\234\203\232\314T\344\334\364\343\332\201\244J\254\3668\267\004\3042\327\327\375A\276x@\361N\017\330q\2214h\322\226_\314\b\267\23250\236-BVh\207c\007!;\310y\177\307\230\\\177\233\337\221\212PI\302\026D\274\r\250*\026D\324\346\221\3444N\025\344$\004z\230\364\371P\231\217\235 \327\224N\003F:&\354:\320\336\365\200\255\f T\211\371\221\004\217\347\374\332W\"\236\204\030#7\016\366\251\261!8\017\2427\223\211k\002\002\232ZDv6\223\207Z4\253\t\213\304\3148\315d\004\002v|w(\"\324\b\270%\354\030\355E\177RXz\306\022\220\334\020\314LB\020G\367\030X*\0250U\220G\006uJ\3663~\353J&\355\211\306E\207\256"
+	.ascii	"\"v0{\253\033\024a\f\365\322OMl$T\315\204+\213U\344\310Ce\360"
+	.ascii	"}\260\353\216\304\277-\217\356\345\357\330\255q\322\001\026!"
+	.ascii	"Nfh\332U\"\035\247\317m\267<\343p\330\224\214W\022\252A\025\357"
+	.ascii	"\344Mk\033\212y'\211\222g#\204f[\276\310\033\263\177\215aya\346"
+	.ascii	"\007Z\001\022\206\256\266\352\364\006y\035\002"
+	.text
+	.section	.gnu.lto_resetYawAxis.110.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\005\b"
+	.string	"\262\21667@s\322\001\030\374\213\314\022\375\275{\260\247c\242\215)\3702\365\020\364\027\n\034\375f\221\372\365\231|h2\314\f\220qTH\240\273\350>\261,\230\310\215O6\3312\245\236\236\2515L\220\234 )\001\341\020!\247\026\222\036\003g\023\017\232\254\3102Mr\274\375\265\360\024@S\303*\301\f\025E\201\314n\307\307W\371J\b\301B$\302\036\031L0#_\312\312\266vL\356yE\200\332\335\217\177r\224\013?\365h\214\221\236{\364G\330\243\336.\330\343\202\351\345\373J\332\262=\222B\017\373\327\302\223}\r\204\244\272\263\330\354n\264n\226\025[Dl\237\343\315\236\271\207\332\003\022\020\r\325\267\273\022~|\273n\376K.\300u\244+\200\302\356Z\271\216\343\206\267\335\261\235`;&\r"
+	.ascii	"3\241\317\037\230g.C+Y\201h[\263\013a\345\314`\241k\270[\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_isMotorsReversed.111.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375 \343U\006"
+	.string	"\322\013,3Pm\222\016$\223\203\310\250zP\326\0052\020!\032F\321j\264[)\254\331\277\333\341\265\202\033\201\343\356\314,\273m\242xF\310\22508jL\263{\313\024O\227\251j\2300m\3024\t\b\207\2106U\024\355R05\361P\265\n\212\252\232%\313\342\347\320\200\203\235/HC\254\353\261E\346zU\272\031\200J\207\002\032\234\033}\2669\334\370V\022?\377}8"
+	.string	"\032\301*2\311\364\214R\262D\"\001\375\232\267\234\240\240\331j\326\341!\370\b]\210\240df\r9j\365\254\333P\031:\242\223\013\333\364\002\0262\363\273\260\214\216\375\021\376\203\037#\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.112.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\352\b-/"
+	.string	"zT4\022F`\232N:?\376\211\354\006\377\200\365\rw\005\016m\237\235\237\220\212(\261\375\270sua\314MR\262FDel=O8\214\356<\341R\340\227\rV\274\200\355!\254\271\243\252\211\324\2167-\264A,!D\356$\003\023\001\370"
+	.ascii	"\024\001L|\3627\252\303\315\370e\336W\2555\2450\255Ow\354\221"
+	.ascii	"\252\002\006Tw2\365\273\274Re\31586\367:\t\254O\231\277\306w"
+	.ascii	"2\361\351\231\274\t\325\331\270\356\267\353\336\206_3\n\233{"
+	.ascii	"\257\201\247<`}\212\364\037\365)z\244\372\364D\246b\316\273\363"
+	.ascii	"\354\n5\241`\275\371\335{\223-\204u\216:\317\253\245z\017\317"
+	.ascii	"\316\321X\324!\016sV\241\232\242m\251\370JZ\236L\256\252\367"
+	.ascii	"\214\361$\221u\r\371\016\252\206\003\tY\027\221\037}\334H\326"
+	.ascii	"5\366\342\331\020\261\261\223m\371P\207uD\3528\211l\213\210\252"
+	.string	"\363 \017\tQ\355\353\230\346\235\036YW\330\207\350O\332\026\030Z`\214\213\027'\211\331\352asP\364\r \333\305l\361@!0\257\332\356T\3325H\327\327\205;\256\032\271\260\2266\315q\024%\032\343\342e\344\252\201\016\b\003D\315\237\267Y\\W\266\357|\207f\024=\262\256\257[\241\204{/[&W\327\031y\346G1\363\001\346UBj\314\210\241m\3063\324\246\356\2662J\334\274\\\331?V\273\251m \226`\332\266\325F\311,\321\320N\373X\202\234\342sSN|9\031*\326{\357\215\304P\237\242\235\323\204\037\345Rb\360\215\360\n({\346S>\224\372\264;\002\232\257\341\245\324\267\355/\323\224v\220\223\372\375\3479(\343\276`\tZ\331\301\3062\245\314F\267\031\263Si\t\034\331\302\307]\306\354\264\340p\347&\245;9\0138\3339)\265\214\224Z>J-\007H-\033\245\226\213R\313"
+	.ascii	"R\313D\251\345!\324\262\220\320rP[\006j\313?m\331G\265\214T-"
+	.ascii	"\367\250\226yT\313;\252\345\243j\331\250Z.\252\226uT\313D\325"
+	.ascii	"\3620\265\234\243Z^\333\262\260-\253m9M-\243\250\345n\313\266"
+	.ascii	"-\277\201\361\356\006\327\343\350\356\325\032\214s\301\244U\216"
+	.ascii	"\334\311\017\367\263\275\231\317\3746\276\333\237\001w\353\336"
+	.ascii	"\313\344b\rL\225\r\344!A\260$\3036\273\221:\324@nhX\304\277d"
+	.ascii	"\030\352\"\324W{\032\026\226\007\347\313\312\016\372\345\264"
+	.ascii	"\031\013\357\204N\335w\326\300\223:+i\200^\231\"nwW\366\357\350"
+	.ascii	"\275\367\256m\306\177\376ZO0\034*\332\214\246\002Z\251\263\230"
+	.ascii	"\017<\251\235\372\316kp\213\013\352\265k!Qt\346\336\353\200\217"
+	.ascii	"\345YJ0?\2310\201\307l\003\324A\3023\227R\177\032\250\221J\271"
+	.ascii	"+>-\354\237>\262}Z\250\247\221\355\240\313r\tO\257\335\323Cx"
+	.ascii	"\313\264\235&6O\037\325-\307\216]\354\235N\276-\227\030\333\330"
+	.ascii	"G\2456v\022O\247\207]l\004u\313\264\265\327\326\351\004r\313"
+	.ascii	"4%\327\251\304&\312\351!\212[\311\351\257A\323\244\251\327\036"
+	.ascii	"\302;\224\247-\354';9:+l\263\267\331\255\245Q\273\214\217O\036"
+	.ascii	"y\350\202\366y\362\230\353\177J\025\320Ytgs\343re\377R\264y\314"
+	.ascii	"\247\324\005-\264\213\353[\242)\255\216-V\274h\251\2478?%x\212"
+	.ascii	"\"\361t\""
+	.string	"\371t\"\311\"E\211\025\311\247(\027\311\004@\f\325\302DT\362\005\024TT\222\350\264\352;\037\0250V\255\344\267\371m`_\017\222\327z#\365\250\221\270\216\232\206\330\\\234/\361)\341i\034Y\236\203_\342\363\261\023\340\306\003o\324\001\230FMC\f\316\315\227\370v \257\340\001\036\213\332\306\355=\200.\352cy-\0014\r\261'\315\257\276/\355\r\026\265\366\002\215\253U\036\355\350\3140\333\034\316]\360\251O8\202\3056c{\331V\241Z\201|\301V\003\373\343\003Z@\264{\375\370a\232\203o\370|\234\267\336[\3651\276\221\372\364?\256Z\026\332\036\177\314y\231\210?\260\254 3O\270\036\205\365\336+'\376\232\263\251\300l\341\302\005\365)Q\217\b\013lN\251\3744W3\205A\203\006\365)\214\2608~nt6\2341\363\3432-\355])\"q\276\0219x\b:\273\327\352L\276\335\307|"
+	.ascii	"\021\302\236\031B}JT\316=\231:\254\354\340z\026\200\251\250a"
+	.ascii	"0\306\fTf\206DDd$iZ\003\240\002\231\261\"7\0210\265c\016\221"
+	.ascii	"JR\3521\207@\330d\301\031\r\335\333\252\016\333\377\356\332\226"
+	.ascii	"(\21388\326\221\266j\246g\231=\344s\317^q@\240qj\372\260\234"
+	.ascii	"4\244+z\\q\0275\256\017a\301\254\336\221\211\002\260\271\225"
+	.ascii	"_.\n\237\024}\022\220\340\261\243\212dE\036&E\362\322\346\235"
+	.ascii	"\250i\313G\374\233VI\177\026\rJ\247\343A\247\300;y\365\342\231"
+	.ascii	"\331\215@\363\277\276\340.\210\326\230\254E\356W\351,p)\343v"
+	.ascii	"kv\222y\344\217\275lG\207\321S\364\004\002\234\260H0\202k\333"
+	.ascii	"+di\3770\374(\217\251\322\260\013\227R\247O9\337o\267<\3326\260"
+	.ascii	"@.\345U<\263`\223\247\300\037[a,B\347\332G\301@\023\003WIyb\266"
+	.ascii	":\2167\213#\b\200\335\207\016\201\025Y3H\211\276\246@\234\027"
+	.ascii	"$\347hG,=\266\230\256R\331B\007\227\036\367\024~\321\255A\336"
+	.ascii	"\247\206\251\301_m%\022p\262\247\341>>?\355\323\003\361\"\370"
+	.ascii	"%\302\246\215L\271@&\215\002\203\331d\023\250:\344\206d\211\321"
+	.ascii	"K'\270\270,\250q\270\311\274D\260\"\3232\335\004\312A\316:\276"
+	.ascii	")\246\177"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.113.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\225\n"
+	.string	"\266\023G?0\211*\035t\304\013dr'\233\317}3h\255\222\216E\357\002c\342s\256\017\225\024\020\270&$\320\013\200\306\371\203J\253\306\250\r$u,\320\320\263Ha7\311\300\254"
+	.string	"\377\033\331D\312\224\0024"
+	.string	"6"
+	.string	"5"
+	.string	"\033f\n\340\237\307K\363\343G.\025\036\013\202\b\004=JB~}L\300/\225\002zWew\237z\216\300/3r\331]\247\b\004\271\261\333\266\260\355`_\"\005T]\266\354\320K=\331\277VM\266\323Q\323\232\351\314\3641\312\004\024x\226\203]R\313\302>\210\013\006\330\366\330\023GLx\374y\030\200\304\220\022\020R@a\003\327KM\341S\363U\202TL\251A\356.H\275\301\256\212@\002\201U\204/+\330\336~`#\331\375(|\003Wq|\324\243=:y\321\243\337\301\036\257\230\022\203\326,\032w\241e2-\223mh`h2\215\343d\226\006o\034\031\\\326\261m\\6\t\273\253\311\251\017\317\013\342\252#\333Q+\235zV\215\372\320\205.[X\324\223\037\024"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\035\027\306\300a\032`,\013\327\036V\370T5\250f\336\226"
+	.ascii	"\2467\241\224\001"
+	.text
+	.section	.gnu.lto_rcSmoothingGetValue.114.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`+\002\035\020"
+	.string	"f]fE\360\320&\035\177\230\274\316D\001\323\b\226J\326\362\n\335a\351Z\215-\355V:\253\b\262\273\311\"yWF\263\251T\006\3449ZmU\247\227Cz\003\313\017\017'\037\277\037\326'\311\301}#M\310\336[\312\224\002Q"
+	.string	"N"
+	.string	"T"
+	.string	"\013b\003\332\241m_u\233\221\355z-\232\323"
+	.string	"\225M\351&hw\267\002'\020\017\337\005\304C\025\361\321#|\232#\237\364\350\003\265'\306;\353\r|zrL'\230\253\013\206\226\030`w;N//3\221\335u\232N\034\356\354\266;\333\233\235\026\00257a\033\246 \346'h\227\364\017\266ai\332\003\207O\317\372i\200b/\227\024\262[\244T\224\375\267:\243=\235=\035\277\372\337\323\232\351\314\3649"
+	.string	""
+	.string	"i8]F\215\335\rC7\366\005yH\330\036\331\036\371\225]\346\330\005Q\342\305n05\023\335E\213\244\221\342\327\261\321\341)J5}I\310\236p\026)\332\356.\360W|G\305\037q\350\025\226\274\351\320g\211\207\327\303\304\314H\255.\344\220\177\342\025\204^\244\214]s|\035\303\264\274]\361p\347\306 *jV\006\205\023\030\246\3752\253b\005$*\020F\034\230p'&+\035\346B\270\356\001W\262q%[\204\223\021\224\215\353R\266\220\017\213$\220t\033\005\221\250\333<Z\373\267:\343\217R\n\226\b\236\245p`\324,\025\342ez\326\031\244^TS\325\f\266US[\374\326-B\312XT\224Q\316c\027\214\370\203\343!0 \320\002\2311\253\003\020\n=\254R\200\246r\007\330Z\034a0\351weIA\214\367\260\335\244\260\230\310\356\226\3132\262p\311y\301\302\020\302k"
+	.string	"\373\302\360^\266_\333@%\210nY\267\2412 \205\r\356O\326\031\2307|\276\300\004\354\212gK\266\354"
+	.ascii	"\315\221\253\214<5\006\320\216\262\204%\222|\226Y\227\t2"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.115.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"M\013"
+	.string	"\346UN? Q\233\016\037\210L\245k\0302\n6A`\304]\004\265\200\016\363\256\344\207\026\326\304\360\3516\004a\324\236\370=O\227\373\356\222\205"
+	.string	"\300@"
+	.string	"]L\250^\n\250(\306Ifz\220\275\245L)="
+	.string	";"
+	.string	"="
+	.string	"\307\036\241&\346\337\373\364B\013Y\301u\030\036'\016\207\223.\003\244\354\256\244\333R\341"
+	.string	"\026\035dL:\r\036\340"
+	.string	"\331p\357\371\351\266L"
+	.string	"\rv\327\311u\032n\351\266\035\3306`\177A\217\327\0020<\262\034\331\237\226*\262\017WC\266\323Q\323\352tf\372\022\364@\356b\306.hdcEb\n\021\266;\266\304\n\030t\214\375\353"
+	.string	"\t\360TxN\324\330\375(\365\020!cRJ\270\tl\332]\213_\342\037\230\t\231\214\364\230\372\220\017\371\020\034\207\210\252\350\327H\327"
+	.string	"->bl9b\333:\t\315\264\273Y\374\021\367\330\370 \036}\201\223\347\036}\216\024\256*\325\365\240\272P\325\205\242\200\201\220\241\252kCU\b\330\252\020\341\242,X\326EI\276\354\032r*\202'Lp\325\217\355\250\224L5\253F\275\347F\226#)\252\310\277v\214\320@\0015\021"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224`\342\t\343\2160\r"
+	.ascii	"\272\220\003\016+\001c\031x{\216 ~UCzW\201\002"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.186.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\021\002e\022"
+	.string	"VbwG\340\322&\035\222\341\355L\201"
+	.string	"\201\252\245a^r\177\300K\266\001\301;\212\224\242)@\206Ju\242\252\312\203\332\226\347\307\343\245#\233\306\206\023\256_\303:\230\220\326\317\031~3\341@\2505\313\367\266M\032\331[\312\224\002^"
+	.string	"`"
+	.string	"d"
+	.string	"\273c\224\264\273\013\036\235\240{\264\237\002F\263\355\243xP\314V\202\337\210\332Y\344\320\020\371\330]\357q\344!\334#<\001\356QE<\366\b5\271\230/{<\255`\022\023\214\232\332\207\303\254\251y\270\006\250\315\340\310\356\336\366\264\251\311d\0168wZ\355\256;\234\373t\333\025l\257\354T\t?\374\321\2550\235\377\376\003\b!\231\261{s\003\262:\321E\211\037\375\366\375\242\257\360mV\035\301<2\373\326\207fd\244NF\023\241\321\001\242iwI\036\355\200\350>\021\314V\3311[5d\223\023\330\336\320v?\223\223\330U\300\374;\220\363\005\305\330\375\032d\376\273\320\326h\316\274\220\225\214\332Z"
+	.string	"G\251\306Le\326C\210\364\0267~t\036\334n=\242r\2326T5*\007\246\242\231\023\372\334]\231j\217m\030\016\252\001\237\333P\216Y\376p\252\221.\203\306\356Z\301l7\006\201j\204\245\0353L2y\3635\365\266G\036K8f\232b\362\226\332c\345\016Wy\234\3124*\246\273\023\007\323\361C\001\255\226\353%\003\213c\360\322\242.\024RXV&\244\260\240\274 l\220\240\242\001E\200Y%\254\227\005V\313c\265\274\013+(,\036\353\345\342\225\210\330\325\222\362\362^\\\256\227\247:\\\345\361mG\205"
+	.string	"\"\001Q\232rJ\275\212Q\231\250=\276\t\240\016\312\351\177^\244\352Imlh\264\272\343NQz\232 ]\236\324\306\340\302\275\246\013/ `\242\201\320\352\2772\206>\205J\b6\020a\210\307\211\030\265 \204G\251\224D\252\025\201#B\366\247y5\021\020\017\2427\3143\334\240\302\365,$\016q\201"
+	.ascii	"\356\202y\3021\373\032t50\301\027\020\2400k}_P_\372\026\005\306"
+	.ascii	"lq7\201\350\006g\307\340\302\020\237\203M0\277\325.\b\320\032"
+	.ascii	"5N\363\224~\353\265j\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\367\b\225 "
+	.string	"\246\267\305>P\350Jc\231\207\316\301\r\033\210\263\365\320\b\326\3075o\313]\365\2370^\030\364K\227\246\221\035\261q\310\304\235\232\212\b"
+	.string	"@*\245\341\004\202\202@\330\343R\243\206\005\212\013\333=\344N)\262"
+	.string	"\260"
+	.string	"\271"
+	.ascii	"\316\003rM\310\264\351\017\377Q\331\357\312\207\367\234=\034"
+	.ascii	"\351\2342\244\323F\036~3\353\270\300\032I]/w\270M\307\265]\016"
+	.ascii	"\3479q\\\327\3350\333i\343\372O\215k?4\256\351f\\\317\231\251"
+	.ascii	"\232\214k93-\026\325\030\367j&\214\2239_|\214\213\213\265p\245"
+	.ascii	"\223\305\303V\\\343\231*\356%\305\301P\374\353\264\361\204\341"
+	.ascii	"L\\\0172K\230\322I\302\200#\214G\204\357\250!\376\005\204\335"
+	.ascii	">\330\316i\355\253\251\007\3279;X\022\200\264XL\335p\270\026"
+	.ascii	"dn\270V:\320\340G\247m\263\030G\315\276\266[\327\227\3224M3\\"
+	.ascii	"\337\231\266\0038\n\277\002v\217\345\353>\355r\035\350u\177\305"
+	.ascii	"\345\276\270\345\036K\313\275\332uo\344\272\356\313r=\t\313}"
+	.ascii	"\230+\367b\254\334s\331\272\367\322\272\357\3624M\355\006\201"
+	.ascii	"\257r\177\374\325\251\330,'ot\237S\275v\204u\315W\274ndFH\253"
+	.ascii	"\203\364\253\353\275\247\327\214\356\365\"s\212\365H\271Y\024"
+	.ascii	"\003:\241\334\314\223\217\235wr\255\310\214\360-M\336eu0\247"
+	.ascii	"\215L\314\347\264q\211\351\374,\356LN\311u\"3\311\255 y\225#"
+	.ascii	"\247\002\301q\247\221g\235yj\216oE\256\365\210\\#\032r}\310\024"
+	.ascii	"rm\310\200i\205\320\202\\\027\252\272\001tZ\250\320\022X\177"
+	.ascii	"')\330\252\365\022\324(\327\334\007\265T\353%\324\225\371\031"
+	.ascii	"\016\265Rr\036<\226\235A\241v\0012\016\265\nT9\324>\251s\250"
+	.ascii	"=\260\006\227~P\033D\276\302\261-\317t\250e*\376A\03268(\324"
+	.ascii	"J\335D\333\022SBM\260O\310;)\317\3009\031e\231\324_Pt<c>Q\366"
+	.ascii	"\313$\224%\260:\2517"
+	.string	"\245\256\300%\323rO\360\312oA\253@M\260\274\347\214\\h\234\247\3112!\333\232\354\324o\366\267\367f=M\366\301\227R\267&\373>\273D\346\236l\314=R\314}\231\330}\2310\367Y\302\356\271\300\334k\371r\257u\274\337\362r\003>\237z\004\\h[\016D\264G\224\207\247\256\255?\311\364\346\250-\333\254\202\210\366l\324\333\265,@\343\021\355\323\254\027`g\316\350\273u\020\321>\355d\310O\020\263\363\372\330\372/\211\326J\375\211V\ny'4\244\232\003\r\355\202\342\007$\017}\005\207u\350\204\275\361\335\320:\025o\355\3202\215\335{\311>e\324\320\002\300;\006\2545}\302\241=\336\203l\177p\232\206v\352\026\314\376\366\254\034\332\223\255\177\204\366c\310:\241\265B\336\300\232\2609'\205\266j\354\001\226~\250\320R\341\235\001\234!\nB\233`\275\271\324\233d;\241}Z\rHh\235\344\274"
+	.ascii	"_\200\215\2501\b\205r\261\031IAAIA\n\035\340\002!\"n\016\021"
+	.ascii	"\300 \245\204\210\004\"2\241\230\210\036hl\253\020`\361M\216"
+	.ascii	"\n\n\251\003\362e\035\261\203\323u-\"\245\353\024o\207\236jQ"
+	.ascii	"\027\355\035\325*\347|\353x)[\004\263\316\252\345\256\323\270"
+	.ascii	"\026\267\305]\025\207\rP\312\025]\232d\275\333Id%y?'\250B\024"
+	.ascii	"d!\013\262\220\005Y\310\202,dA\t\f\321$\233?\032,\313\346K\013"
+	.ascii	"U \275\333\036a'\302\201\265\355\033\205\265\352D\327f\034\030"
+	.ascii	"\fl\234\026\245\240\016\232\240k\241A\342da/\316f\340i\020\264"
+	.ascii	"\253s\031/I\274\252\202\356x\336\376f\013\332\273\210\004\365"
+	.ascii	"!0#\244\2308X\222\356Y7\260\027\242\366\325\2179-\230_\2279\026"
+	.ascii	">N\331\031\300\004n\002Y\232\203'$\007\233\230A?\354\201\317"
+	.ascii	"\333ZF>\005wqy\036a\331\037"
+	.text
+	.section	.gnu.lto_.refs.b05ef73e95f984df,"e",@progbits
+	.string	"(\265/\375`\275\003M\027"
+	.string	"&y\233<\340\032e\031\003\324X\340\025j\205^\351F\252;\n\227\004k2\254\210\303\321\306\3010\306\030c\2141\306\030\025[\366\372\364oOq>\211l\352\225\032K\265\366\017\037X\373\215\020\"S\204"
+	.string	"\202"
+	.string	"\225"
+	.string	"38O\225\301\201\013\272`\007T\301\356g\202\035M\004\273\231\007v"
+	.string	"\032\330\241\026X\t\250m\200\332\325\200\203z^\200\032\b\265\202\001k@u\201\236U\371,\217\317;\252u\006,N\317\322\250>\251\236\200<;W9\003\355\254@\347\037\235E\260\263\006t\226\200\316>\247\005\344\234\223\263\r\316\002\334T\245\226\307f\235\233s"
+	.string	"l"
+	.ascii	"Ti\n\265(\233ml\226\246\346\031\2325\315\354NM\251\322n\357\323"
+	.ascii	"\214\031\234\376i\215`\365\201k\r\\\245\004(l\217\352\235ksT"
+	.ascii	"\007P\235\272\026\200j\324\2656\327\326\\Ks\355\314\265\247k"
+	.ascii	"MD;\242\023\356\220`\332\207\352<TgP}\244\232Hh\bB{Z\327\b\205"
+	.ascii	"p\263\220\324\016\302\372\217\233\367`\355\034\247\215ch\337"
+	.ascii	"hp\033C#\265\306\300\372\002k\213XSHm\004\234\037\244v\3504\353"
+	.ascii	"\346\240\006\3733t\202\323\004Z\373\260\226Gh\234\3256\252\003"
+	.ascii	"7Y\242\004\211\221\024\352Cn\036\244G\016\324\266\201T\272\001"
+	.ascii	"u\022j$\324FG\023\035\035\001\303\017T7P=\224Z\026j\241\324\256"
+	.ascii	".\034da\027\244V\001\352\0047\363\254\316Y\255\020t*Z\017\305"
+	.ascii	"\t\023%\256\322\221(z#N;\021e\310\214\t\323\372\027/]\266\024"
+	.ascii	"]K\026,W\252L\221\002\345Ij7Yrs%I\220\034"
+	.string	"1b\264\213\020\031r\225\016\202s ?|\364\270\366\215\3535p\326p\235\301\350#\243\255p]d\364\004\234!\n\257\212\026\233\256\020\245\250k\232k\323\025\204\251\351C)Rk1\264\266\320Z\243\326RhM\324Z\t\255#\264\326Ak\207J\245C5\313Z\312\252\331\240\375\263aM\353a\347\332\330aK\250q(\235\025*R\220J\007\305\t\222\243w\344\207\216\0348h\310\210\321\306\016\306\013\027\247\327b\215\307b\305\206\227b\303\305$\035\f\227$,\247[9\355(\032\316D\303I\203\217\244\240-\n\332\013h\177\200\026\301\317\332\374\354i\227\222\226\301\301PV\333\311jF\250Q|$\022$\221\b\205\245\270)\026\003\300\"\233\031\352\006\020\350\322f\366H\347E\365%fiCB`\f\222\002h\223\020\201x\027\215L\204\035h\036:,\277\3625\353\237\005\036CW\004\322H.;\fG\"\034dS"
+	.ascii	"\246,%G\221h\212\004U\017\374\n\004\266\220\22660\246\032A\027"
+	.ascii	"\034\204\226\027$\222{\315\200\375\031\225\213\224\022\264\212"
+	.ascii	"\227oUJ\247r\327\036"
+	.text
+	.section	.gnu.lto_.decls.b05ef73e95f984df,"e",@progbits
+	.ascii	"(\265/\375`\251q5\321\001\212\370\246\246S\0200e\3514\006\325"
+	.ascii	"g\364\257\034\025~T\357\306\347x@aG\315\026~\035LX\341\030\320"
+	.ascii	"9\306v\037\265\030%\007g}\263\304Q\207\241\343o\315e\r\177\021"
+	.ascii	"\243\323\277m\343\242\022\361\351\234\247=9\343ii9\213\242\302"
+	.ascii	"E\245.k\"\367\336RJ\231\002\343\b}\n\331\njV\3136,c\352d\370"
+	.ascii	"\257\034\0275\027\354\007[\333\233\235%N\214\334\263)U\310\273"
+	.ascii	"#\311\330\222'C\220r]\300\322\310yAsF\005\006\234\224-\0325."
+	.ascii	"\216\251\333\0267\206N\224\036V\226I\256;)\\\216\360\220Kw\355"
+	.ascii	"p\362\315\001Q^\226H\310\220\227\206\327\225\345\222(S9\220\027"
+	.ascii	"LI\232\330\r\"d\255\255\nU\233\333\235;\344\277r_\346\220ol\225"
+	.ascii	"\037\250\240-\025%\207'\345\n\226\"?\314\226{'\357\031\036r\321"
+	.ascii	"\322p,\313\376\013f\244\f\024$\226\377\312\341!\027L\030\344"
+	.ascii	"\336\311\242\020f\0229Y\274X\251\254\337,\321ia\330\241\363="
+	.ascii	"j\364{\274\350\367\260\351\367\220\351\367\b\321\377\025\363"
+	.ascii	"k\367_\271;w\227\326w\207\244.\352\346\272\"\rU^\250\241s\363"
+	.ascii	"{z\350\377\227\315]s\325\33467\215U^7\367\314or\177\2042:\220"
+	.ascii	"rh\254\032N\"\321)`]\366\316\177t\335\3341\266\nN\276i\027Rx"
+	.ascii	",\311X\265\237\247\240\0355fG\b\327\3155c\325~\236\222\033+\004"
+	.ascii	"%cH\261\275\223E\372\3062\312\205O~\317\224>\217\236>\217\035"
+	.ascii	"}\036:\372<y\372<q\364\235\341\350W\f\032-\270\0327\233v\350"
+	.ascii	"<\317\235\306\233N\237gM\237\247L\237\347\210>\217\016}\236*"
+	.ascii	"\r\202\035:\237g\211\316\363@\351\373\226\372\276/\372>)\372"
+	.ascii	"\276%\372>\035\372>\027\372:O_/\365\365\031}\375E?i\207\316\353"
+	.ascii	"+\372"
+	.string	"\332L_\027\321\327;\364u\f}\324\216>\272F\037\355\242\217\236\351\277\331\241\363\250\023}\224\210>ZC\037}\322?\333\350\2372\350\237R\364\317$\372g\016\375SJ\337l\243on\3217\325\364\351\354\320y\223L\337\034\242o\316\3207\245\3643\236~\236\323\317o\3729\212~6\242\377\346\245/g\211\316g\027\372\270N\037\203\321_\332\241\363X\212>\016\323\307^\372\230J\377\342i\020\226\350\374\245\323\277Vt\t\226\350\2746\356\r\253,\272[b\242\256t\334\374\253\246K\260m\321\371=[t\376\"\321v\333\241\031\036h),me2\264Tlm\231]\255\233e\275v\207\237\031ib\\7_\253{e\225\036.\326\006\262wB\242\264n\376\005\242I\260\267\365p\332\275=\353\341\374o\225\0074\006\270. 7\306\205A\225\024\262RI\252\240\335|\251\356\213_\030\327\305\2760D\360\332\033\352\302"
+	.ascii	"\262\2637\024\220\265\032X\253A\036\003K\302v\346\337\036\372"
+	.ascii	"\277-\356\3246\"\365t\363\177\247\256\324[\0257{7\337(Sk\313"
+	.ascii	"\251\273\371\227\206\376\357\223U^\250\237\304\bw\363\331\273"
+	.ascii	"l\357m\301\331\"\216\b\331\315w_\313\177\037\326\263R\202\274"
+	.ascii	"\331\356\335\355\277\357f\255\261\253s\363\361\254\336\177\037"
+	.ascii	"J\346\313\213\210\362n\266\316\255\035{\347\031\315\353\t\271"
+	.ascii	"\367\0162\261\314\310\221\273\371\203%:\263\035:\177\257\364"
+	.ascii	"o\351\314A\315\254pPm\311\263pw\273^w\316\216G\336\315>v\350"
+	.ascii	"\374\255\2348\247\213.\345\034\234\3338\2775\263xw\273^{W\331"
+	.ascii	"{w\320/\360\356\320\271\331nKt\332,G\267p\020P\304\307\330\233"
+	.ascii	"\013\200\2226\254|\334\331i2\030wU7\377\326\316.1U\225\327^\333"
+	.ascii	";)\204\247\244A\273\272\271\256\310t\023C\304\356\346[:\372!"
+	.ascii	"\200\341\022%i\325,\335\026\002\306\326\204`\325\3305[\305\322"
+	.ascii	"\ta@\231\232e\227/\277\035c\333X6\366\214-c\315\3304\026\215"
+	.ascii	"]c\311X1\326\215UZ56\314\355\234\245\373M\356-\205EK\030\271"
+	.ascii	"\377H\215\345be\200\002\203\334{\337Z\271\222\006.n\316\355\r"
+	.ascii	"M\224\377\310\213\027\013\345\267f3X\265\037\2747\0176\310\275"
+	.ascii	"\223\037\341?\372I\214`\325\330/V\315\202\250\275y\354\230@\312"
+	.ascii	"\226+K\362\366N\206\b\021\"DQ\b\240\032Rih\024\344\3330m\275"
+	.ascii	",\321\311\301\016\235\267<\364\255\r}k\245o\241\364a\320?j\020"
+	.ascii	",\321\371\333-\2672\3746\213\205b\325<\260\267\324\336\273\203"
+	.ascii	"1\t\016\265\233\355\224\243\333-\277%\263eCg\326Vr\257\355\275"
+	.ascii	"\201\360\333\226\026vn\376\222\306v\350\374\232%:\257\352\323"
+	.ascii	"Y\242\363\034\320Gc\211\316S@\177i\211NK\305\262Y\245\007\266"
+	.ascii	"\355v\212\215r\023*\271\223{'\201n\221;T\244\334\374\025\364"
+	.ascii	"\255\007'\336\333\263\036\234O\200\276v\350\264g\026\315*/"
+	.string	"\260i'1\302\361\023\332.\333;\t\244A\357\211^\235\233?\202\276\225\362\016P{\204O\240o/8\355\236\275\340\374\325A\226\350\f\262Cg\221%:\237\264D\247\266Cg\004<p\337\177\236M\220E\303\217\016\211z\033\216\373\361_\240\fDqe\307o\365\376\f\314 \357\370m\376\230\337\002}\206\377m^TL{\006?\212\003\263\325\270\376Q\255(X\255\204\216?\233\310\001\007+\377\314\365\343\256)\214\326\345\277^\362\004p\374W\303\205\373\363\326\177\335\256\025\242|\343\277\367\307Cf\310\224\371\237\266\346\177\233\0052\373\257\332\245\313\033\260`Y\224\033`\343\3172\376\033\302\323\037e\361g\002X\255\377B\371o\362\277f\377\215\362\343\024r\326\377\266\214\365\347\003\374X_\375\327\311\217c\310V\377\345\200\227\344\252\037\207\001 \307\bA\206\361\337\tp\001\362\323T\006\336\202\273\301\237v\025~4\375s"
+	.string	"^\3749\004\325%\262@:\262\213?\267\350\232\032!U#G\3757\312\205\024\306XH\003\026 )\222\241~\274\205\2770\360\243(\370\334\202\273\201\t\377mqE\320A\033\212\035\034~\364"
+	.ascii	"\377\025\301\177I0\202\377\302\360_\250\377\356\013\343<?z\364"
+	.ascii	"\343\002\344\247?\237\373\267s\376\353\363\337\237\377F\001\225"
+	.ascii	"\300\003\t\376K\374\357\323\177\213\177\306`\004\377\323\256"
+	.ascii	"T\213\377\022\375w\350\272\370\357\213,\202"
+	.string	"\377\035\334\r<\270u.\214\023\340G\007\360\347\r`\345\037\315\340\307\035\310!\370\357\006\277(\031\206\314\342\307\"d\017d\247\377b\220W\374xCV\361c\275\037\357\375\271\351\277\035.\220\006\356\001\216\312C\021\200\360\237s~\034&\257\277\245\361[\030\377\323\354\231\r\202\025\200\305\3401\177>\376\330\227\215?F\363_\275\f\202\037\257\311L?>\363\347\342\213\354X\007y\370g\244\254\266}\304\1776\3758{\240.\007\377\333\363_\016\177\006\376\030(\247\260\362\333*?~@N\2130p\f\376\023\353\267@\230\204\247e\017X\213\177,\002\177\200\003\220\177\377\213\262\006~\233\377G\340(\276\301\177:\340@\377\271\200\377h\376\253\371\237\366\377\314\377-\377\353ngA\316\300\177\353\320y\320\177\022\340\307,V\324\375\270\351x\346\0218\376\317\271\017\206\\\376\347}\316\317\377\324\222Q\374Gq1\200\313.\374\217"
+	.ascii	"\016\376G\377\223\312\237O\374y\205??\340\317(\374Y\001\177F"
+	.ascii	"\300\237K\3703\b\177\036\300\237E\374\271\203?k\360\347\f\376"
+	.ascii	"L\301"
+	.string	"\2377\3749\350\317\350\237\355\217\367~l\347\307w?^\376\230\315\217\323\374x\314\217\347~\354\345\307\\~\274\345\307Y~\034\367\343+?\256\362c\266\037\257\375X\355\307\312\037\243\3758\371c\263\037\227\375x\354\307b?f\362\343\260\037#\177\214\344\307E~,\344\307?~\374\365c\257\037\357\370\361\326\217m\374\030\353\307\277\037\307\3701\325\217\247~\034\365\343\375c\022\374X\004?f\361\343\025?n\372\361\361\307 \370q\361\307\303\037\177\340\307J?\016\376\330\003?\306\300\217)\360\343\t\374\230\205\037C\340\307\016\370q\211\037\233\360c\005\374\030\001?6\300\217I\370\261\b?&\361c\020~l\364c\021?\376\340\307\036\3748"
+	.ascii	"?\336\340\307\031\374\370\202\037W\360\343\016\377-\363\337\271"
+	.ascii	"\037\023\375x\350\277i?\336\360c\241\037\003\375\367\305o\203"
+	.ascii	"\376\347\375\330\347\307\032~\314\363\343\236\037\373~\013\364"
+	.ascii	"\333\344\177\274\337\n\371_\367c\375c\363\307\370\307\366\277"
+	.ascii	"z\377\305\340\277\033\374o\373\217\342\177\004\376[\347\277t"
+	.ascii	"\376\233\367_3\377\245\373/\226\377\252\375\027\355\277b\377"
+	.ascii	"\215\361_\030\377\r\300\177?\374\227\202\377z\370\355\333o\317"
+	.ascii	"\376\273\360\333\261\337\222\375v\303o\205~\333\363[\236\337"
+	.ascii	"\232\377\347\374\217\363\237\205\377\313\377w\377\355\376\177"
+	.ascii	"\375\367\362\037\203\275\275\275\275\377'\377\035\342\376\025"
+	.ascii	"\244\004:\240\262\202\350\250\222^\033\315\336v\255\305\316\332"
+	.ascii	"t{\003`o\035^Yh\240n\330\267(\272\253\250*P^6\271\367\366`\025"
+	.ascii	"\005\346\265\245\350\236\354\246\243b\342\2657\223(\245m\265"
+	.ascii	"\367\336\"<%\351\366\020K\367"
+	.string	"\344C\307\256j\2617\005;\271\267\325\336Ov\323\355\275\237\366\336h\226\216\344\336\\ATH+\253\275\267\212\254\266\216'\270\026{\33755oZTJ0\257#85%r\273H>Y\252*\257\215\334h\276\262\264\362\351lW\355\275\355\033\215\324\232qw\363y\343\210\225-\313\233_\001\236>kh\310\353\301C\214N\366\274\361\240B\343f\272\237\036\027n`m\367\324\n\376\230\222\345\346W\300E\237X1\304\201\245\335\374\n\256\350\323J\303\022\311\024\"t@V\210\0272u\316\030\327\224\333Avx\005a\250;U\222\334L\007\344+\262\346\t\356\346\223\312\347\305%\005\352\346W\240v\272\3709e\225\347\324\371\224\321\366\f\2366[\"N\036i9\320\334\374\n\312\364\177F\335*\317(\023\206\217j\357\031 <YB\306\225\267\263\262D\274\202\032\372?\241\316'\0376nY\246\316]\326$\b\334\315\257"
+	.ascii	"\306\035So\305\035\221.7\237\202\275;g>j\340XY\273\331\244\223"
+	.ascii	"T\2069c\006\315\315\247\240\316\234\2736k\236\236n~\bn\204 \331"
+	.ascii	"\020\221[Sdi\336\231h\220,\323\034A\2521\202\3043\341\230o\314"
+	.ascii	"8\246\034\323\316\314\263J\363\316\254\273\271\264V~\243\334"
+	.ascii	"\231ml\025\n\310\210\022&\266w\022U\272\211\001\027\224\177\354"
+	.ascii	"\320y\n\324\350S\340E\237\2026}\n\316\364)8\242OA\017}\nh\350"
+	.ascii	"S u\306\314\035)\344\23417\315\374&\031\263\f\006\223\265f\352"
+	.ascii	"f\233\264Dg\221\035:M1G7\307\2308\274\364(rs\317\f&]\2163=\272"
+	.ascii	"\233\347\222kW\310\234\261\335|\017v\372\277\t\306\364b~\261"
+	.ascii	"J3\214)C\030S\316\354\202\317\262\364\024)9B\330\202c9B\030S"
+	.ascii	"\313\0220$[N\"i>\352h\223\213\017\224\215+3\334|\017l\372\036"
+	.ascii	"\222\372\036\216\350{\370\241\357\201K\377f\026,=idE\312\304"
+	.ascii	"\231p\246\233\371f^\261J\023\213i\345w\206\273\343v\r\313W\224"
+	.ascii	"\260<*8\332\260\220l[X\314*pb\242\204\345\241lN\316\364\360\311"
+	.ascii	"\367\340B\277HO\277\310N\277hN\277\210M\277\250\311\0245\233"
+	.ascii	"\364zr'\355\246\332\315\262v\312\215\025\235\233M\345\321\315"
+	.ascii	"\264\037\255'il7\013\231R\320\256\2317An\232\231gf\0243i\225"
+	.ascii	"&ZN\356]\245\214\254\353\rJ\216;ew\223\333a\242\231c{\n\215\003"
+	.ascii	"/c\276\340\344\355\275\213\264\342\204\030\341\311/\332\322/"
+	.ascii	"\262\241_DC\277H\206\376\315'f\030\\\0217bn\2662s\314\340\240"
+	.ascii	"\tT\035\217\274\"VM\204%qu<\362\302L\035\346\020K'd\357\031\002"
+	.ascii	"XrW\307#\317\f3\2219\302L#f\022K\267\266\241d\200\260\004\255"
+	.ascii	"\216G^\230I$\373\260t[\373\311\216\203%b\352x\344\231b\246\023"
+	.ascii	"s\211\031\203\311\304lb\225f\230\251\344T\263\346\256\353'\277"
+	.ascii	"\203\035\375\016v&\022;&\016\235\0277\277\203\030m\036\271\006"
+	.ascii	"\fe\003\214\333\315\357 \247\337\241M\277\203\231\026r\")CG\313"
+	.ascii	"\315\357 D+M\037\226NH\326\363\262\fb\376\260J\023\210\271\303"
+	.ascii	"\004\362c\356\r\325\005\331\323\345C\353\305\231\301\212p\036"
+	.ascii	"\227\267\266\233\337\341\312\n\362J\017\363\313\354\262J\323"
+	.ascii	"\313\344az\241C\320\344\274\231q\226s\354t\376\004Y\364'0\323"
+	.ascii	"\237\300\t\227\007\037/f\330\366\315\237\340Ko\2317\254\322\304"
+	.ascii	"af)M\0338\371\246\335\300\256\226&\016\\\305\304\002\263B\356"
+	.ascii	"\275=\204\b\301sG\204\353\3145\224A\274\232t\335\374\t`\350\333"
+	.ascii	"(j7\213\206)\303*\315\031\246\226\322\234\201\247\334,K'dC=\211"
+	.ascii	"\240\004\252\216G\036\236\243\004\263<\363\211\260\350\023E\321"
+	.ascii	"\277yu\023K9\203.\r\216\233I\034\335\274:\305\262\364\230s\363"
+	.ascii	"\211\214\350\337\254jqc \327\256\2301L\030xSxt\271\331|\261\004"
+	.ascii	"\313.\313\315'\332\322\267w\210\354-s\020\263E\026r-?^ \315("
+	.ascii	"\323\205)eR\231P\346\224U\232-\362\335\363\233\f\307l\221\355"
+	.ascii	"\262\017\234D\242j`w\2269\210\331\"\017\311An\266\310x\346\023"
+	.ascii	">\313:\361\003\306\322l\221\215\344\345\214\022\242\210\211\022"
+	.ascii	"\226\027\"D\210\020\347\02152w?\331\334\247\2323\272\0347\237"
+	.ascii	"\203\035}[\026'\215\234k\301gYZ\r\f\315\035\222\355d:j\362\235"
+	.ascii	"\274\227\365r\035\253\314v\362\034);9\357n\370,k\202\026c|8\324"
+	.ascii	"\200\335\340\311\347\220\247\317\341\213>\0079}\016q\372\034"
+	.ascii	"\256\350sH\323<IKtZ!v\350<\007%\372\034\272t^\3769H.\222\353"
+	.ascii	"z`(\231\322\344f7\036\260\220\253\"Wn>\207\026\332KF\203\317"
+	.ascii	"\262 0fN\222L\206\317\262|1\242\362\226{\3574\031K\346\202\317"
+	.ascii	"\262|0\300\334,s\232\\\226\343,\335\332\3362@\200r\027%,\257"
+	.ascii	"Mf\223\325\3445V\231\323\344.\036& %g\206'\237A\323\334\324\340"
+	.ascii	"\335\374!\031\364m\031Z[\231Yf\3625\344M\355\n\030\222$\224\263"
+	.ascii	"'o\312#)l`G\226w\242d&?\276\275\277v\274\301\201\311P2\023|\226"
+	.ascii	"\245\333\300\220,\367\336dr\230\\&\317\3451YL6\223\351\362\f"
+	.ascii	"V\231\301\344/!4\320\211b\347\214C\376P\232\376P\023\375!\035"
+	.ascii	"Z\216\002g\314n\334\374\241,}{\307I\033RKF\262-\367\3362\344"
+	.ascii	"-V\231\265\344,!B\024\371\236\364\020kq\346\017I\351o\240\243"
+	.ascii	"\341\264\025\"`1\334\374\rk\364\021Z\230\2455\213\222\343\255"
+	.ascii	"\314\314l\356\350L-\314\334R\351\004\312\226\271\345\336;y\267"
+	.ascii	"\037\337\336rdoU2[\276"
+	.ascii	"\222\3352\225l%\277\345)\271\315*\363ZN{>\222\221<'\327\262\224"
+	.ascii	"\273Y\2725\2134\013\263\334{\367l\275Q\241\341\220\277\001\215"
+	.ascii	"\376\006.\372\033\266\350o\300\242\277\341M\177\203\025\375\r"
+	.ascii	"l\372\033\246\350oP\352o8\323\337\300D\217e\2368'o\2267\177\303"
+	.ascii	"\017}{\307If\362#\025\264\245\300\206 \237\344\030\2542\213\345"
+	.ascii	"&9\271\367Z\026\313\310\314\344G*\271\265F\200\n\013\023\273"
+	.ascii	"s\322\334\201\235\371\033\\\350\013\345\351\254$\207Y\345\265"
+	.ascii	"\344%Cdx\032r\363\205\226\332i\357\275\355\265\234\350\265\234"
+	.ascii	"\027R\243/\004F_/Ktr`\207\316\013m\321\276m\211\316\013\235\351"
+	.ascii	"\013\005\321\027\242\241m\226\035:\377\f\304\007\331\026\260"
+	.ascii	"\265\233\263\217\233\301\362\217g\037\371\353$F\270\217T\366"
+	.ascii	"\221\367\206\262V\203\037k50\265\034\201\222r\346\013\345\036"
+	.ascii	"\331\213G\r\227\272\030\331+w\245m\270\274\233\263\216\274\303"
+	.ascii	"*Ad\036>\251\344V\356\235\004\362\231y\263c\355\346\013M\351"
+	.ascii	"[\020'\320\336\336\336\236\005q\3769\007\b\rs\314D\211"
+	.string	"\335\374g.\033u'\307\353f\034\347e\r\362\013\216\223s\203\343\262\320\261fsa\2208N\2064U\356p\2718,\335\026\002\304\332,\263U\266\201\351d\254L#\337\3102\360\235\214\003\327\301z\371E\256\221\253\362\026\336\313Yy\347\253\034\225ad\027yF\226\312P\371)S\345\030y\n\333\311-\2542ka9\307yxN\331\230.8nK\336\2352rK\034\207\245\016\035\030\3442\2125;c\325\256 \335\302\034\325a7kH4V\262\026~\203\343\374\340\275}\224!\355\314\220Gj\332\314\034\255a;b\203\335P\221#\303e\211E\214\227\2455\003\223f\331\345\016\n\216\313Z\370\013\216\313ZX\013\232DF\2208kfN\213\033\f\310\227\316\022\235\0020\243\177\214w\034gm\311\336\325\335\315\030\316\3211\036\006V\264\300\335\214\332\241\363At\372AW\364\203\312\364\203\224\350\007ei\334&\333"
+	.ascii	"\363\003\311\315\017\242\322\007\252\323\007\002\243\017t\246"
+	.ascii	"\017\304D\037h\210>\320\016}\240\033\372@W\372@S\372?x\372?`"
+	.ascii	"\364\177\322\364\177\302\364\177~\350\377T\351\377l}\rp\3645"
+	.ascii	"\220\321\327pE_\003\232\276\006\244\276\006\033\372>r\364}\346"
+	.ascii	"\364}\246\350\373\020\321\037\340\334z\330\220o\256\334\254\304"
+	.ascii	"l?PA{#\t\263|\303W\254\022\273a7\\\005[\261tB\362\230\334r\357"
+	.ascii	"\035\302C\210\314\226\007\326\345\304VP\031Y\316\342n\276\017"
+	.ascii	"\020}\033E\rS\301mx\315*\245X\271\264\233\365c\356\355\005&\004"
+	.ascii	"6<\345f\375@%w\026O\021%b\306\362\366\336!\212B\2040\232\375"
+	.ascii	"\250\243\363}\250\364}\240\364{\364\364{\344\350\023\355\214"
+	.ascii	"JZ\3276;>\373q\024\234\274Y>Tz7j\334|\223\226\350\004a\207N\f"
+	.ascii	"\345\350\330\254\247\315\313\235$7\017\3412\262\234%\306\030"
+	.ascii	"\027&\303C\356\233\036IZ\334|\306\366by\307L\007R\256\214\007"
+	.ascii	"\022\f\371\004\316\312\336\022\216\333"
+	.string	"rI\223#\310#ep@\250\200\371hCnY\263\003\312\216 1\024A^\321C.!\353Z\"F\004\te-\306\217\253p\027\366\201\3010\020<\205a\340\036X\t\266\201\3030\024\376q\355\\:x\tn\201e\340\030p\024\016\202u`&\230\006F\202\213`-\314\205\215`1\234\004?\301R\370\305\255\203\255\360\016\354\205q\340\031\230\b\276\302c\370\t;\301G\360\3065\260\020\034\003o\341/\234\003#\361\r\234\205\261\356\336\235\203y`\027\230\352\352\341&\367\216U\342!7\316\257\234\233\327\006W\007\t\026\226dI\243\313\r\tF$\nRN\007\027\032<\312\310\265e\001sC\343\253\312Y\332\325\362r\375\227F\216.ea\300\234)\261\2260A\262\324\322\006\271dL\310\362\236\005Z\206\273\001]9CSd\304\021\375k-Wf\032.XkY\316\252\031\342\300t\271\371\312\025\035W\344\365\364F"
+	.ascii	"P\226 \331\202alU\311\021\007\347A,\315\206\323o3^\214E\231K"
+	.ascii	"\002M\241\223\303\345f\312`'C\227\213\233?\002G\225*(\227\225"
+	.ascii	"\2348\327\313\225\033\334\3157R3e\212"
+	.string	"fC\202\354\361\212\243\301\206\3125\233\226\202&\301K\242\271Y\257\371\316\346p\220\335<\227L\352\264\"\257';\016\264`\371\202\223\207\326!\211\241Dy\235v\263\326\330\221\215\271Y\237i)\377}w\256\207\027#\032\r\227\251Ac\311\3157\222A\037\357f\375\367\375 \341\030y\262bf\206zY\264\215\305\342i\f)\246gfK\233\233o\024\203\036\323c\272\f\245cuG\347g\f\020\03014\331uYT\023#V\316\027\032\304\332\224\301q\363\215b\204\205i\2619\260/81\232x\031\213\341Z\354N\206\271#7k'\272\211\335\217\27127\037O7\321`\307\313\306\232&L\316\036SMfXrn\236m6\347\311\222\333+%S^\314$I\242\221E^Ov\037dY\271q\022\204\016\0245\032y\312\230\203\303\353\316\315\037\200\362\310\021\324\253\310\353\t\217'N\225^Y\236\323\304J\356\346\017"
+	.ascii	")D\210.b\206\374\321K\343e\023\271.\302\223f\347\007\233\233"
+	.ascii	"\365\220\036``\032\210X\217\023,g\340~\\\003\361\241\202\302"
+	.ascii	"\203r\263\366\241\257\200\300\250\244\2611\200\252\036=4W\221"
+	.ascii	"\336P\322\312\226At\230\271\322\323\241Cw\025\351\r\245\f\331"
+	.ascii	"\362\224c5\344\f\217\353.7 +c\314\214\334\254w\364P\215\351-"
+	.ascii	"5\rMCsAA\306\241\321\242\303q\315%\246\327V\343f]Co\371\314\350"
+	.ascii	"\221\347\266u\003+9ruC\016\217\314M\224\215\234\345\266\271\252"
+	.ascii	"\263#\200.Z\206\226\241\263\212La\323\221C\355\305_\350,\213"
+	.ascii	"\266\261( &,L\311\306]\025\326u\026\020ZU\22797\353\030\372\352"
+	.ascii	"\277\017H\206\027Q\356\\i+8\037B\240\340|\354\344\270;\243\253"
+	.ascii	"r\032f\3625Fw\263\206q794+KdT\224va\203\222Qg\306\220\032\350"
+	.ascii	"@Q\t\243[\\\273\270\033\275\273\033P7\353)[E\217\345\tar\263"
+	.ascii	"\226\342YS\347%N\355\277\317\004\213\303\306\355\346\013`\206"
+	.ascii	"~\322O\347X\221\034%cH\324\206\017\021p\364\364\320=\256\236"
+	.ascii	",Uzeyx\216\025&/\366l\225\"g-z\334|\021c\340\034\245\003\007"
+	.ascii	"\265\203f)\332QR\233\307\220\241:Vd[\3626\225\016\020I@\272\276"
+	.ascii	"\3249j\347\313\271\227\366\366\205\346\035\235\363\373\3203e"
+	.ascii	"\274\240\335|\021E4\032\347\250\234\337g\346\230\261\206\311"
+	.ascii	"\315\027\001D\377(\336\357\363\021\362%\314\335\315\027\341\245"
+	.ascii	"/\002\307\335\035\272\264A\311\2502T\310\275\267@\350\2473\032"
+	.ascii	"L\256\334\270A\227\026\355\013\016\006\320\220\334\325\035]\272"
+	.ascii	"\331)jf\300\"\"j\315\032\224\215E\333X=[\252\364\312\304\366"
+	.ascii	"\336\002\321s\346\310Z\036\033k\025G\345M\2312h\232c\251\315"
+	.ascii	"c\307O\234\225\223\270\313\343\213\2313\250\231\243iP4<\306 "
+	.ascii	")\273\031=\003$\003^\327\333\315\017\221\246\217g\356\375\367"
+	.ascii	"u\330+\342\202\311\f3\240c\212\274\236\360\316-\253\2600\032"
+	.ascii	"\346d\270i\2119:F\003^\032\235Y\327\177\337\031\006\313\016\235"
+	.ascii	"\233\037\002\013\005\003\006"
+	.string	"\235\263h\033\253\b\257\307\026\b\037\030uw\300\2049:W\246$c\345v\345\t\333\315\377 \317\213\227\334\345\333\373\213\213gi\205$\f\256\323\005H\226\233\377\301\024\375\243rr(\027\020P6)E\226;k\216\bTN\224\032\250\233\351\200|\364\310\306\364\270\371\037\304\240\177t\013\272\005\013\026B%\303\221\233\377\301\0204\013\232\005\365B\311\300\310\270\304\362\027!f8n\376\007.\3207\364\r\215C"
+	.string	"Y\031\322\306\0310ppG\343\264"
+	.ascii	"\345\370\241%\365\346\312\225&y\fmi\343\346\203\b\203VA\253\310"
+	.ascii	"=Y[\"\243<\221s\363AXacC\275|x\350\215%\347\231\030<\366n>\210"
+	.ascii	"\262\265\2658h\r,-\226F\240\334|\020I\364\263\017\213\252\251"
+	.ascii	"e\037E\373\311\016\204%` z\350\037U\336*Q\345\271\005\302k\317"
+	.ascii	"\340@\006\031\346\034\027_On>\210\030\372G\321\254\022E3\315"
+	.ascii	"\230T{\313"
+	.string	"\370\200\005\314\003:\372G\223\267J4y\332(\362\3323\004\200%.JX^b\031\3337\337\0031\372G\315\254\02253\325L\251\r%\344\374R\245W\226\347$\016\307\327\315\367\240\254\214\013\320\226&evn\276\007N\306\306l\025Sj{\r9\303T\321\371\242\301\344xL\335|\017Z\350\037ur\253D\235\240b*x\355\031%4\t\253\343\341\305&\345\313\315h\f\327\n\213\031:7\277\203\245~\007Z\364\217F\241Q(\023\020\033\n\nD\023)OD\234p\224H\221\361\0022\355\264\355\330ah\230\222(\036-\034sr7\277\203)H\3449E\316\031\003\026\rAnh\311q\363;p\242\177\364\b\n\206\"9e\214\2007\246\0030\375\016\256\210\240`h\021<)\035D\351\007 N\020!\331\307\207\247\344\306\262xo\310\270\304\312\350\007 N\377\250\217\237\304\b(\030\372#\373\310{k?\301\031"
+	.string	"\036\226"
+	.string	"\250\351\007@\f\375B\277\360f\220q\345m\231\263&\326\325\325\205z\371v\326\033\r\346\336\220q\345\375\304\320\202\245\n\365Z\002Vu\363\003\320\002\345B\271\320\035\t\360\202\372\270\343A\247\343\350\016%q\350d\334\214\346@i\354`b\227C\r\272\205n\2416\364S\0336<\204\310\025\362\346s`\005\325B\265P\033v\r\225e\0316C\334\\\324\006\022\032l\352n>\036J\343\277o\203\2743@h\2403\346\250\235I\231/t\035U\022:7\313\310w\311\242\2379/\316\330\334|\016\224\240V\250\025\212ewV\002b"
+	.string	"\323\001\302V\271\225aC\257\216b\371\320r\220\300\201\341\200\013F\f\033'o!A[*M\027\222\003,}\016\236\364\217\2728\357\240T6\016\003\246\2506T\330\0073\306l`\247\277A\030\375\243S\350\224U+\332Ov \232\314\220\023q\200:&t7\177\2035\375\243P\347\0354\352f\345-dCA\035\325\210\332 \211\376\0063\364\217nt\347.\025\274\240dp\360F\311\030\362G\207\013\253:7\177\203'=\275sF\321~\262+\241\t\230\0067Zm\244n>"
+	.string	"\360\352\3249\355|0C\312\031)H\273\233\355X\2654ZbP\302\314\2313\203\212\0349pR\314*cg\342(\301\303[\022\005"
+	.string	"\035o\336\234u*Dyc\347\n"
+	.ascii	"R\372?\355\254\362\264\273\233\n{\352\254\004%\032\324\271qs"
+	.ascii	"\326\251\260\367^\266`\002"
+	.string	"us\235\233o\253H\226\fl\316\346$\243\302\336{k\013\204\276Bb\003\352\346k\240T\243\346$\343K\300\0304K\032Vd\266n\276\006L\314\2309\321\250I\361\262\334[[ n\231^\030\265\233O4\271\213\347G\017&/z\210\021s\222\321Ol\227\234V\331\230\237d\334|\330\240\354\311i\240\345\345\244\363r\316\235{\333\244\027V\326\336\242\001\342\313\227s\316\356\254\275\267\022\320\206c\271\267t\200\300TN\330\310\b\363sNK\317\326\231\252\030n>\301\330&pD\330\334|\274\354\343\277\317\007\206\f,<n\376\207:\372\037\302\350\237[\354)\367\223\030\341\\;\271X5\275\221h\233\013$\313\017S\364? \321\267V\355\374\031g\317,Z\356\366A*h\307p!\206\364\241\377aK\337\r,\0309/\322\334\374\363\212=\337\326N\270\273M\241\201\300{\363\341J\377\003\224\276\233\275R{Cm"
+	.string	"\364\003\n\232\032Vn\225\247\2253\213\247NL\2208\022PS9n~\006w\332*O*g\333E\333O@Vz\210\031\323b\364^\304\271\371d\343qk\333\322\272\371\031|\321\317"
+	.string	"\213\232\3329%\b\221s\312\335\210a\202\204\355\346g\020\203\376O)'\331\251\304gv\313\310\202\200\0137\313\fv\350g\360\224$;\317\256%\357\265\r%\343\303\035,[\3041\250\243\217\301\03333LV\204\266e"
+	.string	"\035Y\022'\016\206\332Q\204\312\315\307\200\212\376\3172\345Yv\302"
+	.string	"\261\241\240\004\320d\314\034\021g\0263t=n>\006L\304\304\3161\273\367\336u\336\220q\345=\3719\206\301\020Y\242\264U\242,\331\002r\3631\240\341\304\311\325\272)\265}\210!\367\336\022\241A\311XZ\324\315\307\340J\377'\223\237\304\bVy2\261j\026mc\361\270\230Q'\227\357\324\231\031r\363/P\023\026v^\235Y\021\220r\265\354\202D\236U\230jo\031\bP\202E\211\210_`E\377\347\221\237>N$g\214\274\327\366\224\024\001\200y\323C\304/\220\242\177A\fE\212\334)L\265\241\276JX\222\024\361\013\214\f\031b\347X\241\275\241\242\274\351\320\377\031\304*\317 vNQr?\035I!\343\022\273"
+	.string	"K\377\347\217\0376\216\n^PJJ C\213\022\206\276\201\262\313q\363/\230\352\321\343\004\273{\357\215D\247\374h\263\334[Y \376\363\353'\230\233['\016[\223\233\217\227k\300\221\201\251\353\352\362\002\346\353Bb\241s\363-\350\242\377s\207\362\334a\355\212\320\266\f\030\350\\u\311\333[NDO\r!^Y7\337\202\244\376\211\343\344\372\231Cy\346\270P*\354\275\237\222\033\313\002-c\310\270\362\366\326\026\210\236*\032HZ\334|\013\212\350\337\376\376\347\206\312\332{\3130\223;+\312\347\374\355\255i-\210_\203\305\026"
+	.string	"\377\363\336wR\367v\221\206f\357m\341\350%nP9>l\223no\251\257'\006|iI}\335\240R~i\tQ)\277\366\223\024\222'\241\254\375\365D\245\334[HJ\352\251\204\227\026\225\022j\013Q)\267\326\236\022\243ew\362\353iKym\241-\265\241\266\322K\353\003\225\324\227\026\225\022JK\210J\371\245\265\225_;hKAe\275\220\332YB[\371e\267\225^ZATJ/-*\345W\236\345\212!f\313\r%\232$Tv\006*\251}e\025+"
+	.string	"\215A>$\24205\362\254\260\252ICW2\032\241\036M\250H\351q(L\221\202V`\223q=\022\213'\200\200g\375\2218r\022\"\241,\206L\302u\330\304\002\b|&\004\205LDW2:\252\301\342\022\n\0250\201\342\004\023~(\224\220"
+	.ascii	"\013\277\023N\374\\0!\304\"Xl@\021\205\322jLQ0\026W\240Z\201"
+	.ascii	"%c\021\211\203+\031\251K\302u\304\321\250\252\020\032\203G\341"
+	.ascii	"p(\\:\207)1I\350B\022Q\250B\250\002\325\023G\023N\306\241\243"
+	.ascii	"\024J\260\03021\231\300a"
+	.string	"\025\022M\020\205\251\0034\020\245\320\302\n\253\220hb(\205\026V \022\022M\004\205L\026 1\255P\202\002A!\023\006A\303\024x\\\205)F4\021\223\006\340\324D\024\016\007 \002\t?\022Jp\032\241\006\233\206@\242p\204\361\3304b\304\212\242Qi-\022Q\244T\035\346\365H,\002M\244\225(4\016\317c\021\310\343T421\245?\242\360\310\263\252\016p2\002]\311\310\250\016\233\202\252\022\360\250\301\372S\227\204k\217\272$D\221\256C\265\304\013\307\024\305\252&\005]\311h\204jlZS\025\t5\261\252.\004\205L\023\\\311h\005\024&\\\030\361\341\005`qx\202j,\236"
+	.string	"\2442\t_8\002\0315\250\253:dZ*\236\240\201\3324L+\260\252\016\030B\341h\202C\022Q\330\002\360\304*$\n\203N\034\205AG\241\223\t+R\f\370\034\215\305\265\310\202\006\242\023N05\275P,\016\203:8\031\3235-\0014\236GuM\203LMA?uI\270\022\233\214\031\034\223\322a\nj\260\310\002\320J\301\n5\002G\241\206\240\r$\030\035Yp:\021\024\016S\025\034x\b`\224\256i\t\247\023\3531\035\372\004\225`\264\241\247"
+	.string	"FB\rE'\024\327&\023\324!\323R\352\202\332\264\324\004\004\232`\301qU]\b\n\207i\005\3245=\341tb\002\036\020\216\214T\030\204.0\251\253\013@\243\006\240\243#\243\rB\242\"\022GF+\261\251x\002\223\272\272P\201\272$\\\231\212\305\025\202\302\026V5\311\230\256B+\324\b\244kZ\342\002'\216\302\236\023\307\243\n,\032\231&(a\202C\023Q]W\023V5\251\3031\205\t\033N\254j\022\320J4\261aU\223\200\210@0Z\215)\223\321\t\3400\005Z0\001\bF\3531\035\026\371\216\210\302c\217\217\204\221\261\270\002\323\024\216E`\317\222\272\036Y\270"
+	.string	"\264\376\216Fu\330\204\002\221\032lZ\205\353\232\352\024\212'*\360 \202\321\261\251(T\241\032[\250\300\034\301\310I\r\022\205\350\225\214\200#\200H\035Z\020R\327\364\204\322Q5\"\251'\234N\254.\254\352Q=a,\032\215(\030\213)d`^\311(\251)\205\032\034\021\034\n\233RxP\203E\026|+\321\004\220\272\246'||!\030\251kz\242\207\347\230\302\204\025\250\016\221\324\022@\243O\220\230.-\025O"
+	.string	"\032}\352\232\236pA]\323a\023p\230\002\211RP\201\351\211\023V\242j46\001=\244\253\332"
+	.string	"\016\007\n\215*QM\322\027\201\204\001\220P\202\023\372\022\f"
+	.string	"\202\001@8_\202\001\216\216\f@\302\221>\tGx]\327\337\221\205\325\251\230\002UU#R0UU"
+	.string	"\201\357\023\244kZ\002\210X\024\022\215\352\2326\201\200G\375\005M\274pLQ \001yV\242\020\227\b!hEq\370\243\224$T\002\n\2060L\215k\223J\364\375\202!\f\255(\016{\202!\370\004C\b\252J\300U\270\342\b\264^\311\210\205Q]\3274\305\372[\265\272$D\261\032\323\365\350;\376\222\322uX\254\300\212\342pCP\035\246H\211*\252&\245<\307\023\200\306\rzE\312\302'HLS\004S5(\244&\255\307\024\351\027\034\026\225~\3530\345\020T\217FU\205j\374\255HYp\270\222\321QiM\227(Xa\235,\013\013\203%\202A\351\207\3044\374\001\201)\217\372\373!&\t\207\251O5\246+\202\306\324xD\372)%\t\225~@`\352\263\256?$5\350\341JF\027\034+8\002\205K)\221E\t\242\242Q\315"
+	.string	"\020\230\242+\222\032\374\255\035\256dD,\n\323\021Gc\361HT\217"
+	.ascii	"86\375\224\200\253\260\205 \321\204\341\260h\034:.\t\215(\214"
+	.ascii	"\352\252.\025\323\r\353\352\224.\341\343\017E\005KMGl\022\205"
+	.ascii	"K8\211(\324\307\337PP\205A8L\205\253\220hBh\275\222\321\021h"
+	.ascii	"\034\001D\262`=\376\204@\ba\002@M\277\243\312\304\002\205\013"
+	.ascii	"@c\321z\374\365\370V\022,\356\361\367\003B\212{\224\342\222H"
+	.ascii	"q\217\322K\"\275GN\227\204\323=bq\203i\023\b\204)|\326+\031\215"
+	.ascii	" \026\227\226\212\300\n^\260\307\337\017\252\256\351z4G8\232"
+	.ascii	"@\nG+\223\317\311\201\005\220\2506\201@5\246p\202\207#\005\324"
+	.ascii	"%!\nu)5\246\240&\245FUE\272aX,6\340g\256?\022!\\\311\310\311"
+	.ascii	"8\"\211i\310\311\310\303\224.\001\215\246Q\r\nU\024\215LA\325"
+	.ascii	"\3118L\205F\365(\344\244\016\231\232J \rS%\0365(4\032U\025\305"
+	.ascii	"\037Q\370a\375\241I)\212\242\360\227\3244d*\022Z\325\243j,\256"
+	.ascii	"M\351/H\024\246\370\255\351\361\267\324d\\_P\231\216\025\370"
+	.ascii	"\250\303\024\310\263\032U\025D!\320\030\024.\231D\341\222~\001"
+	.ascii	"\250*\001\235\322%\rt<a\230\252\030\026\231\214\352J4\0014v8"
+	.ascii	"\252\2521I-\261\224\236\240\202\ti\303\212\024\003@\341\232."
+	.ascii	"\251D!\320gMU\bW\240\tj\260\310\202Q\230\026\021\205@\365\330"
+	.ascii	"\364sJ\227~N\306\236\241J$\246J\300\237SS\372sJ\227\200\216\352"
+	.ascii	"RjD\372\001\215G\242U=\"!\025\177\302\343\321\330\2432\261X\205"
+	.ascii	"<`\26061\021\205\035T\025\3025U!4\252\301\037\320h\301\212\324"
+	.ascii	"\210\257d\324\264$\034\016\213\306\254\004\\\205L\346\212\224"
+	.ascii	"\005>\252M\303T\305yl!(d\362\201A\351\267\"e\361\003\203\322"
+	.ascii	"/\b\006%%\340Z$nX\257d\024\0242\215X\225\222\204\303\"\240\005"
+	.ascii	"\356\361\207\024\0242\235-X\023\266\204M\301\006\205L\330\250"
+	.ascii	"\256C!R\013LMA\242\320\002\035z\226\232\\\b\n\231~\210B\026V"
+	.ascii	"\023\202B\246 u\230D4a\250\252P\207@E&'\024|B+PEB\032R\203\305"
+	.ascii	"\245\337jT\231\234\324\337:\024\256?b\021\006\241\261\250T\244"
+	.ascii	"\006\213,\260X\205*R\243\003\204+1\005B\201b\002\2420u\200\261"
+	.ascii	"\270\246F\225\3031(d\372\005U\243\252\264\246*\322\017\213\024"
+	.ascii	"\250\006\177BtUJ\022\252+~F\315\263\"\305\200\006\240\025)\006"
+	.ascii	"\326c\261\330\200\rj\260\270dT\201\251\361\247\"\0215\234X\221"
+	.ascii	"\262\020\032\252@\240\t\352\232\032\177\202IA\301aQ\351\250\032"
+	.ascii	"\225\326\337\252\036\213\324%\341\312\303\"\035\252\301\036\016"
+	.ascii	"\352\232\032\177CG\242\312\264T<!(laMS\250\030\n\032\323\025"
+	.ascii	"\306b\nAUE\"j\301D\211\241\026L`\200X\024\256\302#15\242(\261"
+	.ascii	"\022\205\305\026V\3658\301\212\224\305\017h\025.\tW\340\201A"
+	.ascii	"\351G\342xL\231V\024\207BID\241\322Z,.\035\203\277\325\230.\035"
+	.ascii	"\211X\030U\025E\240j\374)\035S#\360\347g=\026\213)\210\210E\341"
+	.ascii	"\232\256\305\037\225\211\305\032\204\204T\\\233\200\277%\243"
+	.ascii	"\272\n{\222\210i\321Q\350\224\376\222\232R\250\301\016Da\232"
+	.ascii	"$t\\\372\005SU)}\241X\034\376\214*Q\230\032\327_\321\bL=\020"
+	.ascii	"\205iR\220\220\261h4\252\277\3371E\332\341\247\036\23368\245"
+	.ascii	"C\325\370[\221\262\370\005\32555&\251+Q\310ambZ\233\212?cq-."
+	.ascii	"m8WbS\021\370\033\016U\340\257\2706\245\035Pc\252\004\314\304"
+	.ascii	"\024X\f\231\230R\2375-\016\221\314\365JF\352P\210T42\375\324"
+	.ascii	"55r"
+	.string	"\360\"\223j\034\261\026\213\306\021=+Q\005\032U\246\t\216\277$!\022\261x\202\272\246'\206E\343J,\002\207J\b\nY0*\255h\tE&'\024\214J\253\3469\252kz\002hD\213LN("
+	.string	"\215\347Q]S\243\331\202\211\022F%\024D\026At\375\221p\264\022\205Mz%\n\213L/\244\2521\305/eZ\177\326_\t+Q\330\204\376\350\350\204\017\024\210\200\0034\320\bh\374\001\221F"
+	.string	"\221F\020\205\351\322\b\240\3618\302\210Heb\261\376V\341\222p\370S\207\353Z4*\255C\377}<.\224)E\313\231$;tZ\031;mp\350\320lV\016\227\026X\216-4\371DY\204+\216\254\210\226\252\233\177N'F\\\300\371\266N\033bx\330\321\335\354\243\341\243\341\263\341\333Yw\037\260H\361\325\270\317\206/\313\2345UL\3220\351\201\346\243\206m\016O\206\026\003\002KC%\251uN\301!\004,\313V9oL\325i\303*\323`7\026\307\210\357\n\025S\323\302r\345\263B\231\240F\214\274\350\342\253:\301\246t\315\371b\234v\220$\343\246`"
+	.ascii	"\321A\302\302\360x\241\213T\351\201U\206\n\335a#\354\216\227"
+	.ascii	"\213SF\222\031\350<\335|\253\364\265\360j\300]\325\017\337\224"
+	.ascii	"Fb/nMb\360I\331hb\004\310\034[\230\362\013\352\0343\265\264="
+	.ascii	"\tyr\201\337\316<\021\361\355,51-\236\354i\256,\346M\2352z\272"
+	.ascii	"\353G\317\210\013\253;uI\304 \303\354\234sj\342\316\250%\231"
+	.ascii	"L\0213C\007\265\203\252\345]\2211\347\207\222+d:/wQqC\027C\316"
+	.ascii	"9"
+	.string	"\003}\361e/\316^\007.\252\336\360\346|l\325\241\002\007\035\203\306\353G\325\033\030a\334\312\374\270wh\2324\036P\334\330\241l\212\320UA\335\254\335\350\272\353\345\365\362\352%\336\333;\241\220\231r\242A\243\331\\/\257\275\221([\031\261\345\232k6ZZ\260\201#\346f\255\346Zt\035*Q\310\334\254\323\\\213\2270`]#\3044\372\345\344K\006\2351Xr\312\240K*{vlnN\226aa\025\361\032\223\005\364\245\307\223\230\263-D\036\020\264\031\306\200\251\212\272\031K%\275t\225\2501\256\2335\030\\\202\275\275\275=;{Ci0W\317\3510\327`\016\204\242\021\243\202:\363\257\277\2341fH\321\201r\263\336\242\267\350.6+\353N\004.`_p\362\256\271\\wq\323N\244\264\201\273Y\313\335\355\354\007\234\230\233\003\210#\250\324\303S\223\004T\252,\022fR\216s\220)SU\264\t"
+	.string	"s\025"
+	.string	"@p8\036\222\213\246]5\024\200\fU\264\250rN!\217\244,\253\024\253\021"
+	.string	""
+	.string	"H\212$\001\315\241\276\253 ,@\272J\235\351>\300\240U\201G\202\f\226t\023%W\024y7\035\373\236\005P\310\037K\221\257P\322\323\n;\225\324\376\252\207\222\242\034"
+	.string	"\246Y\344\025\252\230o\346\215\227y!ap\361\221\002\251\317\313\324\260\262\270\325\200H\202"
+	.string	"1\316\267\007_\251\320\255\301\245\033w\027Pfh\201\027st\320R\254\351\234\363\346\200\2301o\351\201\245\177'\331\205\301@\rl\246\r\031A\\\272k\367\002ND\342\276G\242M^]\333\211\036\037d"
+	.string	"@\231\351\333\242\314\370<T0'COK\tg\203\303\006l\207\305\301\226\215\004!\301\210\351\264\017\211\252>\354\357V\214\333s\345ztq\035x\312[\363\016\214\271\337'\335\bt\033\0310\231f3rZ,\323\0223\325?\341\034\023Q\234\202\377i\020\335\257Qs\302\306\230\200L\265\177\224\333!\336\004c\203\373\237\210\b\221\361\353\214ry\b\021`l\202~\344\322\210\274\373\326!2\371\317'\nd~\255\274\367\256\013\017"
+	.string	"9\352N\2423 \364\024c\246A\254\300\245\271\224\017\233\360\006\023\251\256Sh\275\275s\\\003\021'\327\365=\232\322\221\375e\353\004Z\264\300\021\022\r&4\027\302\f\020\213\375\007[<\373\327U\034N\303VN\255\225\026\215\211\233\336\303St<\336\017B\303S\354,&)\017\201\320a\240\227\260\315\362\013\301\215\2266\333\323\360\376(\240,Z\211\005&\341E\303}\204j\034$\255\275\311I]\243:\346\310\243zY%vZk#9\204\226\354Y\252h\321\001\002\203\314\357{HG[\035\302\303X\367\222a\203\230]\354Y\022-r"
+	.string	"\220|\364\307\314:\323\202}y\002\031\367pZ\340:q91\020\360>Hg\213\"&\204T\247\030\246Z\346 \215\356\232\022\255Odl4\025\234)\267\337\013w?\005\310`\340J?$F\"O\230\235kV\013\211\322?\215\2138\235\035`)\2351Mqv\304\331Uu%\036\245\327t\234C\202\212<\026\020\2729\272v\007<UZl\213\003YcV\240|\322\241\3127\034\300\243\321\275\262/\344\"\027K?\253\275\030\332\236\272u/\004'\004&7y8'\267\035\364\365\234\313\2260\004!p"
+	.string	"\033\345\232@\034\017`s&\304\n\377\375\342\236\230\342\001\223>\021\374S\352k$\024(Y\275\341Py\244\033&\315\013\363&\366X\207\001I\377\232\nl\326\365\264\216\212\242_\247\007\272\357\002\221)5\371;\036\261\235J\237!\366i\261\226PpfC\346\230\266\355\257\002\033\305*\036\221C2\2130\233^d\321\314\036A2\377\332\237I\327\b\004\335\346\221\334\226\376\225\304\253\253\241\311J\365\201\276h\023\2534\300\317\206\312'\037\017#"
+	.ascii	"\323\236\336)Lq\003\272E\024k\027\003\036\265\271<sx\260o\022"
+	.ascii	"1s?\255JMp\271\236F\342\001\353\304\272\034\275\303\327aa\372"
+	.ascii	"\221\321e\022X\363^\005\300\337%d\224\341\375y&\035\317lG\021"
+	.ascii	"\377\007\246\331#\003,Jzw\277\307\243\345\237\231C\234#\035l"
+	.ascii	"\f(\243c\216\344\002\253{(\t\301\330}\376\213\032\345\216\237"
+	.ascii	"\372K\212\002\013\317\020h\326\nV\271\233H=\355\3044\216j\301"
+	.ascii	"\375@P\340\354_\231\221\301\024\302\272|\236\035M\337\266Qa\003"
+	.ascii	"\b8\227\214w\240\220!l\373Y\267\233\r4\266\032\036FZ\2230\312"
+	.ascii	"\022M\305\333\352\345\374\322\355e\301\372\207\001\r\242}p\307"
+	.ascii	"\263\3577\265#MNY\351\367\241\205\232\323M"
+	.string	"\223\367h\3321\335\246uLf\316\355\314<\260\3015<nB\353\036\261\3551\317\013\n\254\006\255\013\224\313$rf\373>\251\210a[AL\271\322(W\363KT1\364<\331rX\242\254P\200W\377\002\203 A5\242_\223\237\f\336\b\3310\326\360\314\244(\030\214!\254_\017\331@\310Jl\360\007\346\3135\035S\213\237\2630T\036\366\377\177G\223v+\320\363 \001\007\036NA\276!?\\\205\302\366\242N09\374\347\310\005\357Ao\3757vW\377t\301\023\261=\315\340\020\224H\371L\252\244\030;f{\035+/\270\260\247\356\247\256Z\bQ\200\316\345\227\341\353\363\001\266\036\352\275>\367w\035 \2645im\307#\020\254\325\262t\205Y\274\235\233\223\025\210o\365]\365!\335j\233\026@\017tK4%k\244xx\327[\240\026\220\005\033\306JB\310\227\003\2108\316\326\001\321\277\373zu\302,\004"
+	.ascii	"(\226\021\333\261X\026\233\202\325W\207\3554\322\245^-\25265"
+	.ascii	"<s\321)\033\025[7\260\377[S\024\245+\306\315\323\240'Y'\\\251"
+	.ascii	"\335-\240f\341\321"
+	.ascii	"\016W~\230\214\341\256\223d\035\244\233!5\265[p\032\036\036\275"
+	.ascii	"\300\345,:'\256qQ\3604G!\225\024\230yDD|\340\241k&$@R\030sy*"
+	.ascii	"I\034\273\363\270\356M\352\265#\"A\301n\225\363@:=\\M\202\\\006"
+	.ascii	"\376\322<\203rZ\204\370=\240\363tO\177X\027a\314\220h\034'I\315"
+	.ascii	"]\206\241(R\300\206\275\022\323*[\002'\034?\030L\323\234\013"
+	.ascii	"$\324\204\026\331\254\rI \017\334\263\f=A|\031\270\371\314\033"
+	.ascii	"\023\220\025\260p\375\264\350R\313\177\t\303\273\253kt^\205\202"
+	.ascii	"\277\313/\tt\f?\025P\364.\216\362\312\230#i\244\232\274\275\351"
+	.ascii	"K\343A\370s\342\326\026\t\177ri\246\223:!KNX\317\002T{\016O\237"
+	.ascii	"J@\320PZ\3131\303a&\2200\244\351\b\032\227\036H\\\332QE\210\251"
+	.ascii	"\n\257\210V)\331\177\027\260\252\325\340{9\251]m\220\034\030"
+	.ascii	"\331\260\210x&\033\232^U\262W\300\222\0354\245\031\267\343\262"
+	.ascii	"\272\274Rg\202}\017\\\212\314\255\243\007\220\"\3416\315\177"
+	.ascii	"\235\350NNu\256\212\020P)\007\263 \310\264-\346\305\371\020\b"
+	.ascii	"\320/\336H\217b\035\310\227!\270\274I@\270\366&\204n\033\270"
+	.ascii	"\2542\201\212\016M\205\237\357\225W\372\374\373\253\241y\245"
+	.ascii	"\226\321\325\354%\001\233\244\320l\003\004`h\327\351w\027\234"
+	.ascii	"\0317\326&\366\332\b\265\213\313}\021\333Ym\312\364\220\350\205"
+	.ascii	"\253\"\230M\217\245\273]8\fH7\243,\216IFE\263\022\201\357 \200"
+	.ascii	"\261\355\254\335\006\005\323\322a\273\b\343\227\n\217\221(\301"
+	.ascii	"A\016\266\263l\222jA\247G\362\214\343= <\004b\273\200\026Y\251"
+	.ascii	"X$\326\313\211M\244Q6\007_N\370\211\237\016\342u\212+DM\227\017"
+	.ascii	"\022|$\025\2268\253\201\340\300\245\020\025\230\262\rw\324Mf"
+	.ascii	"\0205\374O\322\355M\275\274S\304\357\274\377M\215$\333\202\231"
+	.ascii	"\324\275\251\350if?Fe!!\025+\372*\"\201\037\265\303y\2033a-\266"
+	.ascii	"@z<NC \253\310\037l\347|\214\272.\376\215\211\244\367\366\273"
+	.ascii	"\322\037T\224\325\232\nE\022LP3\317\267\210\254K\250\255\224"
+	.ascii	"\325\315\220\326\361v\324\t\332\255<\266 %\206\316\371\225)\367"
+	.ascii	",\f\354\365\241Yr\2709+gq\364&\234kZ\207\035%~\336(%\360mt\265"
+	.ascii	"\325h\315`\024Mp\244\2152\336;\273\013\354T\253\277\275I\210"
+	.ascii	"\251\257\247\366\326\n\234\341-\274p#\017\210\337\253m\001\255"
+	.ascii	"\311#[u\036\370Uy\335\273\342i\356Q\237\300\331\345\206\234<"
+	.ascii	"\246\240\305\333\340Q\270\221:\356\321\335t\351\n\b~.\367\r\347"
+	.ascii	"\376\252\376R\250\227M\231\303\346\013H\24156\366<\2743\013x"
+	.ascii	"\351{\272\335\363\266\262\317\257\007r\331}B9\332 \3310%\331"
+	.ascii	"\361>\034\210\211\3601U()\342\320E$w;\023\225O\006l\003]\023"
+	.ascii	"g\200\361\261\004\233[\245\342\203\350+\251d\302'\216B@\313\003"
+	.ascii	"-\212Z\334Z'+\reWy\206zy\240\315\fJ\030\023\353\342H!V$N\030"
+	.ascii	"`\374\226\273%\277\375\036\2118kU\360E\260\261\017\211J\335\275"
+	.ascii	"\255\030he\211\234XMV\351G\276\344?G\025\262\362\257\214\027"
+	.ascii	"B\3600\3041$Y\024\007b\351B\3737\322]\2668\242\245C\032\3502"
+	.ascii	"\300&\243SKd^\013(\341\352\316\352\326\n\237KYq\211B\322\317"
+	.ascii	"\254\211O\202}BP\322\013P\345#\006\206%\001\303\265\017\227s"
+	.ascii	"\346\247\266\307\352\2722\342|\251\334`3c\242<\234\203\216\270"
+	.ascii	"d\233\363\220a\365\001:\200\320yQT\230nm\225a\001\236\340\356"
+	.ascii	"\263\bGJ\305a\306w\367\361\026PD)\215G,Hzp\t\026g\260>\007\215"
+	.ascii	"|\\Nq+\r<]kt\252\260\314d8C\346\032w@S\034\336\267\250\377\337"
+	.ascii	"\237U\\\304\231@Z\030\232\016:\003\006\310\3273\321\246|Ta\342"
+	.ascii	"~@\n\264\020\264\264k\367\200\232\rKeT\207\321\332\252\377\t"
+	.ascii	"\235\207\f\353\222\371\216PN\216*\275\213\020)e\001\033\330D"
+	.ascii	"/\251s\016\020&\361\334\034\257?\2253\033P\262\345\321R\303\333"
+	.ascii	"\373g\f r\003p\312W\202\224\377o\343\200)-\236\300]\306\214\274"
+	.ascii	"\r@}:\b^!*e\250T\357W\231\214\243*\037\b\376S\327\336\333\023"
+	.ascii	"g\006\300 \272_\217\330\344\013\252~\261U\204r\330\326w\274\203"
+	.ascii	"<\217I\277;\277\322?\374\261E\372\366\371\021\2435\343\351\335"
+	.ascii	"~\317\317l\315\375u\246\216\232|\377\254a\265\357\305a\205q\312"
+	.ascii	"U\301\260C\307\373\344\013\276\2632\267V}\332s\016\2073\317\301"
+	.ascii	"p+\324\022z\0221\252\206\323\202p\022Vn"
+	.string	"\b\033P\367\371\274\213\002wJ\362\202t \005S\rD\205\201\001W;\330yD\356y\034aP|\026\b\023q3\304\2337\301\351\335J5\275\274|7\213*\f\342\256\243\350\302\201.\021&\355:\342M*28\372\303\327\226l!48\277\"\243Ka\237V6H%\016`T\3602z\016\375\004\335\023\212u\371\262\261\334\017\n\342\221\264\306?;\244\336\177\bI3W\327\205\026F\367\347\262\240`cS|\030j\340:j\303\271\233\321\243\263}^\220\334\370\267\017\255=-\376E`\216-B\\vC\263\252\313\007*j+\307\256\001\360-\363\264\234\037\344:\263H\212\217X\021GMP2\310\276P\203\320\202\214\256\275\003\336-H\300\245\324\235g\306\005\323\207[<^\306e\207\032\305\202\321\202\302g\307$\027t\2620\024\365\355\034\244\317\323\216\233\342v4\\x\033\311\037\370\317\020\255\213r\021\224<\205"
+	.string	"\217+s6[c Te\235=\220\363\310?\300\302\340\377\327.\261\203\261U\020'\242\223\310\033\241\323\225\034\2205Y\033\233\030\003\305\314\367\311L\345X\354\211\253\303S0\235GMLu\207\227\302\251\361y\213\030P\225\005`Fs\213h"
+	.string	"\367\236\346l\314\321%\227\225\347\200\277\242\031\366\233\275\271\316U,d\376\223\312\253\3532\217\364h\347\375\257\322\271\242\022J\374\333\002\003\033s\031\300\367\253\035;P\256\231\001\003\207\366\223\315\275\377z\314,\273\367\230\207\256$\370$\370\3406\322$\344\334)\205:G[\0225b\353<\256\334yJ\327(\353\346\250T\246\343\214\321c6\235j\363\220f\251\201\223\006\354\244\222K\342\216F\225\261\365\247E\026o\254\032\251n\177)0O\tE^\351\\\013+\242\245\277\b9\272,\005\371\005[\224C\f"
+	.ascii	"C\020(\242*\250\032\376\300\201F\204\337\270\316\276\321\206"
+	.ascii	"\324\n<h1\231\004\275\370\302\360\237\313!\240\3261^\363\311"
+	.ascii	"\303\200G\245\322\024|\013B~P\237'\333F>\351\r\367\253\235\315"
+	.ascii	"\355\205u\364\332\257\021w\022\365\0024\n%\264R5'\303x\226b\033"
+	.ascii	"\305\016\353\b\bRSlj\r\353\330\331\227\240\316\223\037C\234E"
+	.ascii	"_\371\005\336>\223\316Y\373\333\362\306\017\003\321\245\367K"
+	.ascii	"\356\213Z7\276g/\350\035N\273K\267\260\230(eiqk\233\253v\365"
+	.ascii	"Z*\271V\240{\371\310\007f\305}\355\3415;Q\225\307g\347\263\217"
+	.ascii	"\306y\270bL\360X\353A\225`\205\210t\177\004s^\314>%\254p\024"
+	.ascii	"\351\312\276\033%\034b\351k\272\237\203\215.\2775\274\245\253"
+	.ascii	"\234L\262\274P\002G\217m\260\344\214\260\216b\366\001o\2265r"
+	.ascii	"O\256{A"
+	.string	"\257\275\275\363\341\003Fs4B\337e\311_%\034qV\231\002Q\341\326\364\2170\305\243\355B\332\273\227\f\247\301h\t\313\365\310z\t|N\356B\307\245\365\037\362\035\242D1 \360\275\f\361$r\351nh\3438\021E\274\370;K2\353\253\007U\253'\367\033r\365\300\316\217\227\036\335O\363\020\036\rzod\306:\243\272\303g\267J$\b\346\373\003\262#\254m\242\351O\017\244\302\035\263Ye\323\226\373 C\207{\314\2021b\220L1\024\355O\017a\326)\271-\200|\330\027?+\326\267\333\311d&\335<\352\262\245w\030K\013\225\307 E\326-\251\357\322 \356h\260\234_\337\030\303t \032X\0079\352\342Q~\217%\226\376/\210\350Z\211\031H\333 \263'\341e\367\226\236=\274/M\004"
+	.string	"\253V\230\034\007\262\364\205\261\374\306}\361(@\277F9\266\f\235rS\001\333u\"\215\336)\205K\343C\274v\340E\206afM\350\367\350n\237 \270\007L\201\230\023\260\230S@\333\343\202*\335\371\320\240D\375CZ`\303\337\306\334\325\343qy\352\223\344\254\310\237\347\307\312\220\177\367\311\372\240p\321\233\233jg&\001\337\2150\377\031y\2307^C\341\277\317[+\364\360\237O41?L?\257\376s\327\323l~Tr\313\274|Ry\347\331\315\255~\326O\304Ea\034l\357\177`w\003+\337\230Q\007\236\302b\235\257\\\372=\260Y\301\350\335\340\277p\276C\217\327\367\332\323\\\377\370\367d\361\320\330\237\344\311\361\333M\300j\352\356/\327\023\353\356\005\311\177\321\371\033\230w\2557\225\236\312\227\022s\250\367\\\241V\003\325OS/"
+	.string	"\356\016\226\f\001\362\266\037nL\210\275\324\275\223\343C!\200\037\301\006\365\333\261\336{q:H\367GB\344g\250\303\220\357[\006\267V"
+	.ascii	"\370Wl\377\355\327Ot\230\357\022c\256\364\3738\376R\375\n\264"
+	.ascii	"_\027\360'\221\217\324\222Y\373\360T\371N\275\213\037\236\374"
+	.ascii	"\b\251#\363\257x\265\364\350ou\005Z{\251.@\352`\333#0}\231\260"
+	.ascii	"\377\b\347\0364%|\331\240M\353p\336\t\3478\362$\313\354\326\376"
+	.ascii	"\372\033\262\301XMw\202\327\027\256\356o\356\372\374\352\303"
+	.ascii	"k\246\037L\273\352n\375\302\262\2376\352Ot\267\250j7~s\332n\221"
+	.ascii	"\262\257\242\367\357\251\375'_\3300\210\\\317\375\362s\373z\323"
+	.ascii	"j\366\336\353<%1\177:\2154\347\242\364B_\351>\302\237\363\272"
+	.ascii	"\261H\355\261\364\034dIo\357\267\036K\374Z\200\177\034\215\207"
+	.ascii	"\342cM\344\320\b7\331\275\305\026\231\020\237\027\202\353\224"
+	.ascii	"s\213\321&\333\337*J\314(\337u\247\216=y\307\302\234\361\177"
+	.ascii	"\024v\311:/H-\271>\203K\027\247a\034!\370\3736\315\302Q\317\177"
+	.ascii	"\263A'\310<\262\023\023qoR\030\264]b\242\3539N\"\366\370\213"
+	.ascii	"\343\236\365\2655\025v\324\237s\211\357l6\334\207\235\332\371"
+	.ascii	"\210\323j\270/\217\231\311{9\205\035D^\266\366\240K\271\214\364"
+	.ascii	"\260\352\002\216\361b<\226\342\373\371\275H\177F\356\266\254"
+	.ascii	"5\035b\263\344\1777\221\3579\230\307\263\261\331q\370\335R\363"
+	.ascii	"\212\027G\310\253\003\253\3219\270\217\340\333\201.T\3141x \f"
+	.ascii	"\243[_y\034\240\353\026\034\344\244]]x\036\336?"
+	.text
+	.section	.gnu.lto_.symtab.b05ef73e95f984df,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"getSetpointRateInt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"getThrottlePAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"getThrottleIAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"getThrottleDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"processRcInterpolation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"rcSmoothingRxRateValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"rcSmoothingAccumulateSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"processRcSmoothingFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"isSetpointNew"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"rcInterpolationStepCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"rcSmoothingGetValue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"rxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"skipInterpolate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"qHeadfree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"quaternionTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b05ef73e95f984df,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
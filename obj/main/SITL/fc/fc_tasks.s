@@ -0,0 +1,1404 @@
+	.file	"fc_tasks.c"
+	.section	.gnu.lto_.profile.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375 \264\025\005"
+	.string	"\364\b\250"
+	.string	"\021"
+	.string	"\354\301\314\336\005"
+	.string	"\001\314\345\244\232\005"
+	.string	"\002\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\004\253\255\325\355\002"
+	.string	"\006\275\236\357\212\016"
+	.string	"\007\314\362\222\226\013\t\347\230\200\264\n"
+	.string	"\n\376\376\316\323\004"
+	.string	"\013\376\303\253\241\n\016\305\352\265q\017\202\312\321\202\003"
+	.string	"\020\316\305\360\246\003"
+	.string	"\021\200\357\370\217\t\022\002\001\002\002\002\003\002\004\002\005\002\004\002\006\007\002\b\002\t\002\n\002"
+	.string	"\002\013\002"
+	.string	"\002\f\025\232\376\363\242\t$\240\342\234\212\n%&\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"\244\b\267]>\243\232\006\204\231\347-\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375 \351-\003"
+	.string	"D\002\335"
+	.string	"\r"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\004\001\006\001\007"
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"\013\016\017"
+	.string	"\001\020"
+	.string	"\021"
+	.string	"\001"
+	.string	"\034"
+	.ascii	";\t\200\r\206\342\260\262\001\020\340\002\264\030\200\2737\206"
+	.ascii	"\nn\241\250\037\224=\227\025\200\267\t;N\220\313\205al\362\201"
+	.ascii	"\226I\305\215\263\266s\302\312\rP\006:-\300\034\256\n?\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\322\002\215\t"
+	.string	"B\312$/\200\267i\f\233\212`\026\203\215\225\003\352\030c\271!\257Q"
+	.string	"\316a\371\223\323%\f\204}\373`\214Fb$6\375\377\367'\273\337m\211\224;\0057J\022TU\204\371\255\222\331\204\301\246\305!\016\001\017\231\373\221\227C\257\033\257\277\344\304\335uG\337\0220\213r\277a\374\234\234D8\300\b\274\335\267I!\026\024\n^F"
+	.ascii	"d4\322\020\364\363\303\310P\006\347E\026\023\225\300,*:\2071"
+	.ascii	"J\211\016\354\256\342\366\371\274ew/\237\337\246\334\335\325"
+	.ascii	"\227\326\206A\250Q\256\022\t2\013\232l\214\001`\"Bf\345\001\022"
+	.ascii	"\340\321\251\002\206\244\224QJ\340\214Q\302\n&\250\331\336\325"
+	.ascii	"\201\350\300\327\016\tZ\267\373\3230\3507L\2643\037\277\264="
+	.ascii	"\260\355?\256\306m\237>d\312\224\223\321~\013\310\b\020\202\207"
+	.ascii	"\373\374\342\316\302icw\271\312h\362E\313\306Buh\314\213\bj|"
+	.ascii	"\325/?B\343\271:8S\033\316\326/\356\200\253\216\022\255\305R"
+	.ascii	"Y\231\227\254\304\003w\357\372R\274\234&@[Z\244\210\313\312a"
+	.ascii	"G\214\262\234\265\r\0339\265\372r3"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\007\004=\r"
+	.string	"\246\32042`E\223t@A\r\300\361Q\226\336h#Z\321\t?b\030\246E\275(\204 "
+	.string	"\205Va\200\200"
+	.string	"\225t\3274\360\373\357f\375\366\177k\273\221&\223\f%"
+	.string	"$"
+	.string	"&"
+	.string	"G,\221\300!\250\260\320\037v\246I\340v\232\265\310Rj\255\265\327\205\257\313$-\253Q\357\037\225|F\\\005\002\224{JC\007\332<u\234\272\376\221\217\265\034\223\311\b\327E\262A\210A\354\352\372\264\177\226+\367\225\353dh\321\024\267\263#\221'n\317x\214\2730\230\253\223\244\013\256D\3624\335\246\356\212VR2I\214|\361\026\023\264\261\034\344\337\200\273\f\034.S'\035\264v\007A\215\306\304\030s8\276\002\332\266\t\360d2W\3274k9\316\3630"
+	.string	"\217\307\325A Qy\250\021}D3)I\245\262\214\001\320B\"+\017\021@d\213\314\224\220HA\241*\323\032\342\006,\202\317x\025I\241\022\340\301M"
+	.string	"\020\022\2019\002\273AAC\236)\366\345\2425\257\016\232\362\270a\024h1)\351-4\264\232\002aRN\330\210-k\202\002\013<\274\210\007\256\3405^\016\236\351L\232`|\300d\352\236g\013\211p\341\233\031!\023\224a\230\353\243\2633]\233\225\335\036j\306\261\327\220\334N\003\312\224\257\032\016\361\025E6\032\347Bf\315I0\022\264\3058]r\226T\004\024@#\305i\311\375\323"
+	.ascii	"\244\032\n)d\200\003\335\320\312:\255\205\2112\347fr\006\224"
+	.ascii	"\364ef\025d\312\"\344\377\214LO\236\340\240\0377:\251\234\260"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.pureconst.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\200\004\001\230\004\002\230\004\004\230\004\006\230\004\007"
+	.ascii	"\230\004\t\230\004\n\230\004\013\230\004\016\230\004\017\230"
+	.ascii	"\004\020\230\004\021\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375 \305\035\003"
+	.string	"\"\005\017\027\240\325r\377\377\377\377\377\377'\370\377\266m\377m\333t[\2264\231R\252\272`\033\330:`~\315\237\2555\257\346\324|\232\2404\217\266\320\b\307F\346%A\016\303\302\301\335\255\342 \020"
+	.ascii	" `\026\202A\021\003'8\355\t-L\t[@\271A\025\314B0 \004\3016\203"
+	.ascii	"\005\004\203\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.e50c4cae105b212d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.128.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\322\f/2pm\032\003\240{\375\f\320j\232^=,\032*\362\242\232\026GP\223!\301\3374b\027\005\335\244\367\206\377\273\316\251\002+X\365\361F\"B\344\2262\245S\201\372x\022,\020%\245C\fh\334L\206\311\261\026b\007\306\016\004y8\037\030\345\204\033\202V\r\224\204VUI\210\311n7j\006\302E\264Y\2509R\353\351\377\353Fm\003\260\030\321|\374\024'&\027y!\032\230\266n\2557\314q\271\343\241\227\377\242\004\362g\006\325X\3742\036\240\370M\026\240\370\365jI\234e\274B\232\220\360(\371\017\035\206/\267\253v\311\027\021\026r\253 \374o\023a\025\256s\333\202\266\007m\261\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_taskHandleSerial.129.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"M\013"
+	.string	"\266\324MA O\225\016\300r [`\t\345\006NZdg\245\251\212\"\3064\370\321\210\225\317"
+	.string	"B\325\371\021\0166 \004\255\271\333Z\211\376h\002"
+	.string	"\226"
+	.string	"0\300\261\201\204\312\032\230[1\321&\326\222M\266L)9"
+	.string	"<"
+	.string	"9"
+	.string	"\273\273I\r\377>3\251\237\277!\216>%\247g\322\304\002|\261\304\323eVA\251\230\340!\2262\212\013\203\213\257\256\020DP5r\331]k(\232n\355\266\013\330&`\037@\277\252\372\021\004\022`0*\257\335\b\261\031\333\232)>Ll_\355\203x\210\357*\007\326\330\275`\342\304\3568\300\002$\237\001N\321>\263\203h\237\376\354\027\0377l$\305\341A\tX\346`\305Z\240\034\335C\210jI\207\264K\005$Z\224T\206}\021\037\021\362;\270\201H\037~\372\"\355\363\362\253\177\254\250@\201\2441{\034\251L\331\317vw-3\330W\005\336\201Lgc"
+	.string	"\344\311t]\210\3530g\3618\036\006\224\200\323l\234f\363l0\235\215\353\274\315\022\342\317\202L\267\201>\237n\233\214\373\013I\202s\2426\247#\025E\f\227\205L\2426\003O\037\006\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.130.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\315\013"
+	.string	"\026VQA o\233\0160)\305\020\365\220\201\003/\303L3\341)\nV\323 \257\036\326E\n\233p\320\334(\022\016\356\300\254\334\377\177\207k\233\025H\200\001H\024\204\241\313\017\343\347\302\222_\002\353O\366\3362\245>"
+	.string	";"
+	.string	"?"
+	.string	"\232Mr\020d)\037*6D\304\330]+f\270v\031U\363\377\275\322y\333\345\205Gy\240d\004\f\001^IZ86t\377\256\025<N\225\242`w\255\235g\341\236\267\275\3006\002\373\t\002\361\303\276\334\335u\364\260UM=\344\237\252~\245:\261\002\323b\227\343d\306\206\223\004\207\312\366\325~\207{\320\036B\301\225]\f)FvA\214\rP\237\005n\231>\345\007L\237\016\224\332\0222}g"
+	.string	"\"_\310\305\355 &%#\321\227\211\212\377N\261\b\341\242\244&\376/\323#\025\255\033\035\334?\034\304\310\327\340\t$}\367\351\223\246\317\307\371\202DF\207\206\236\330\340\246\001\231\203\315\247\323@\004\332`\330\350\n\340+\223y2\215\350\301\305\261.\216\005\352h>\326\205eV\206\200C\0216\230%\n\2050\253\002\367r\243\207\031\240\b5\"\007!\253LT:\243\355\371\250H\211\260\0247\031\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.131.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"}\b"
+	.string	"v\320<8@\217\322\001\230\002\024P13\003\211n2H\274\225l\336\031\343\372\273\256\320\377\0069\325\315BD\037\022M\310Z5\327\325\005z7'\367-\354\206R\366\033\331d\313\224\002*"
+	.string	"-"
+	.string	"*"
+	.string	"\330\245?\233\365\220c3)\326E\t\314\356\316\270\361\357\372\371\017\371\006<\221\256\031\205\335\265\202\247\214;\336\266\201\355\004\333'\001\021e_\365\353\225\271\254h\255]\214V\314\256d\212Gf\373j\377\343 \337U\025\336\354j\250\240\354\206\b>\320\\\026|"
+	.string	"\273\274.\020&k\324'\211\270\310G<\277\343\322#\t=x\031p\263`\227\032\355\t\n=h5iYYD\222\035\2324\246\354_\273\273\016^\003\367\3610\210@\\\327\2156"
+	.string	"o\232\367\340qD\016[gn\235\t\362p>s\353\274\251\0218\004\301uS\024\nu3\013K\2776\242\274\360\262*\305\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.132.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\275\t"
+	.string	"6\222C:0\257\322\001\220\230O\242\220\377\212^B\033\036\210\301\037\240\310\316}\003\253\230\225.\240\033\3661 \013\255\371\212 \031.\314\203\002\020\366\302\350)\311\262%\311uD\210\354\275S\n1"
+	.string	"4"
+	.string	"1"
+	.string	"\264\335\255\323\343\341\351\224\241\037 \242N;\215Oj\320\332\250m\304\024\345\244\310V\207]^\210*)5\236\335\265d\211\0317w\333\n\266\023l\317\002!\264Y]\331\305\270\305\254\214C\001\331\330\276\264/\362\221\360\257\n\003\354v\234\304vG\004\037t\3478'\310\234\243\037\310\234sh\273|\374X\215\013fU\0226\216\233\3114E\346\323\201\244E%m\346$\235\266\304\204<\353\363\260w,*\261\332\213j\242\354\021%\247\313>\335\335\365l\331\177\375TJ_s\n \003h$Z0\221@\337w\362\004\354u\300\007\360cj\360B\325\013U\222\3503\252\336\007\326N\201K\020\240\257\232J\245\257n\306\275\307b\246h'\355\bP\236\345\371\017"
+	.ascii	"2\003\302\260\036\302V\r\204\205\275@5\017\274\266\356\305\027"
+	.ascii	"V\021@u\261\213X\215\026w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.133.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"%\n"
+	.string	"f\023G= \345*\035\340\020\376\261\022"
+	.string	"Q\002<\334\231F\210\301j\326\326\227\020Ht\340\f\204\305\301\032\366b@\bj\211z\371%\372\255m\b@"
+	.string	"JgL\r"
+	.string	"\n\3406\034\177K\310\336;\2453"
+	.string	"5"
+	.string	"5"
+	.string	"\333\321\326\305W:E\377\261oF\362\364\252\0019\255\t\264\225\230\227\237\036d\252vT#\343c\237\035$j\316L\303\356z\216\344\352\336n\333\301\366\202m\230\253\032 `g\033\313\313~is\316\261\375i\237\344%\342a\032\336\354\206\244\310vK\005#h\276\035\274\303}\253/\340\276Y\264_^\2726\323zq\234\004\330\r\246w\325h2\352\f\356t\302\304%5k\346f\275\211\263/0\346\307S\001\025"
+	.string	"\263\024=\331\345iR\021\373uw\327\224e\037\366\3279\375\f\301\252\205\001e\003a\004h$\202(\221@ h\362\006\354yB\212\360S\222\360B\235\027\352H\242\317\250\363\300\260\363\030\370\253"
+	.string	"\201]\351\373\300\216S\356\353R\226\037>f\033\024U7\323\376,\346\307\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.134.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"u\007"
+	.string	"\242N55Po3\006\240\\\354P\001\n\236\347\2641"
+	.string	"\f\262\222\375\346\300(\255\017\264\007A\361.q{^I\264gEc\\7)H\301\246 \333Y\333\321\226H)S\n\331\203%\n9h#\013\303&\252\200V\236,\"\373h\020\025hV\2409\n}D\263\302\262\351)\350%aaS\273.lv\274[>\226\332@\362]D\214J\bcKQ\001\335\025\252t|\031\221k=\016\306\217\326\362\377\033K\255O6\224\002#.\0130\377\306\214\314?\212E\244\323\326\260u\211M6\237,\312\371=ZV~/\241\b"
+	.string	"\246\fL\2401%=\2401\325\255}\261\007\362\215)E\003%\346\377\214&o\206[\355\023s:\022g\270a\370_\330\2218\334\350\266\007m\025\332\206\004\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.135.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\335\013"
+	.string	"\026\327SB\020q\233\0168"
+	.string	"!\304\334 t\204\317\253\fN"
+	.string	":\310B\2516\n\r\351\342\233I1\030\241\026\261\321\303\230\377\252\352v\347i\355\2462\265\212\200\2604D\236\263\002\205\264+\256\365\374\364\311\336R\246\024B"
+	.string	"="
+	.string	"A"
+	.string	"8\376\221\254e\204\006\007\027:v\327\322\221o\217Ps\363o\362K\347q\217\025\210C\214GJ\205\007R`\344\b\340m\200\232\020\023\335M\236\035<\220LK\203\335uv\236\207\233\272\355\b\266\025\330O\020\251%\373pw\327*b\277\344\217\232\316L\277\022 \243\006\203\323n\310\312\2165\305\030'0\266\237\366U|\305\366\022\r\276\354\216x\201\262\373!\260\201\352\261\3005\324#\374"
+	.string	"\352\321\233\035\317@\245\236\304\311\r"
+	.string	"Y\355A\224\215a\310w\251\022D\220\224\273?\356'QIAQ-\371\032u\245pb\203\224*\366Y\274\205\346\227\360\310#\337=\372\036\324\343U?\234R\204\370\310\025\373\343\002\032\204\016\350\363@\024\352d\331\350\312\370\332h\0264\216h\302\345\261.\217\025\372p@\326\225i\326\206\200\261\013\235\314\022aXfa\276=\\\025q0\303\364\241 1\223Q\355\n\237|g\250\234\027\230N(\240\226\034\020"
+	.ascii	"3\241uh\340\254\267,\266\227\025z\201\305\201\034]\025Op\027"
+	.ascii	"\026L\271\004K\254\246\214_\036B\223Ua\271\352\230P"
+	.text
+	.section	.gnu.lto_fcTasksInit.136.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`C\n\3051"
+	.string	"\272S@\022E`\246\326\030S\004\313|\024\330X\342C\350[*\260\372\217\250\374\362\233\035\375\213[\236\f\200\260\265\204\016k\f\3550\247KC\311\202\f\327\331\bSf\303\204\226\310\363\201\r\217\201\261\244\334%DJ)eJ)\005\020\001\373"
+	.ascii	"\021\001>\326\271\367\316\355\352\314\276\363\252:\253\251s\372"
+	.ascii	"\316\377\316\356\316\335!\001\364\253\213\210\327\257Y{\255\362"
+	.ascii	"\352\274P\025LY\237u\247\2653w\243\265\032\377\322\212\264\320"
+	.ascii	"\235Ai\320\266\312\007\024\270}F\303\250\\{\255\036h\271;\273"
+	.ascii	"{\337\265\245Vy@\333*\273\314nzm\354\355,]M+w\357\373\036\177"
+	.ascii	"H\273\035\004T\374\361\351!\016\205A\036\340\317\327k\331UM\337"
+	.ascii	"]n\026B\317\211\245\354 \2402$^,\353\237\024\001\325]W\317]\221"
+	.ascii	"\245\3009\3154\275\344\352\210\373\224\031\361\236\236*\322\304"
+	.ascii	"\"\251q8w5F\304\205`\035\004\373r\036\026B\220\034^\r\354\352"
+	.ascii	"_\027\227\373z\356\312\253\325\372h\311\225\017\357\035\005\311"
+	.ascii	"\261\325m/\271\332rv\356\252\307\017\253\351\253\r\265"
+	.string	"\325\3524-Z!q\006\261\250R\002Q79?,\246\177\020k\231\032\337\367m\265\366*,\246;\013\341}_v'V\216f\241fn1f\306\300\334\263\020\321\366{\006\276}\337\026\266\t+\373\006\"t\230\to\354\253x\236\255\337\036\177}\237\026\273\346\235\251\256\260\252\177\374\266\323\f\263\244\320^*p\351.\0270d\310\260\266\252\276\212g\223/\2644!O\277\2534\263\006\016\306\377\364\233\374\0350\327\232\341\326\177\025\316\206\224\245\347q\277\1777\3570{h, \332\367e.\340\276\322l!\270\217\264\312#Hx;[\345&\261\266\332?\343y\344\013-m\312\363\326\336\361\343.:t\246\356F\256\314NO=mP\252W2\320\231S\254\360vr1\013\212\027]\276\222ym\351\377d\356\364}1f\325yC\2375\033\350\264\346\343;'\2753\322;\037\365\234\215\255\263\321;\027\261\316\002Z\347"
+	.ascii	"\2543\021\353\f\200u\036zg!\3269\350\235\201X\347\342;\377\260"
+	.ascii	"\316>\357\334\303:\023Y\347!\353,L\235\203\2543\017\353\374c"
+	.ascii	"\235\003\337\310U.\370O\036\372\360\333+\311\035\017\233\006"
+	.ascii	"\276\271\001\377\311<\\\256#\335\373N\265\223\331\335j8.\227"
+	.ascii	"\322X\233\216\272^@c\357\3732p\323o\\0 nX\330\332\252\267\332"
+	.ascii	"R\272\3309\265~\377d\341'\233\234\331\035\342\022\361v\n?\370"
+	.ascii	"f\006\025\362\340{#W#M\347>i\337\367]\300\255\246\327\270dn\231"
+	.ascii	"\253\304U\262\266\032\374!!\321/\264\036\233\023m\363\265K\255"
+	.ascii	"\"KZ\363\013\313\324H_\305\363&\232\t\317?q%\301\2132\221\336"
+	.ascii	"\367\373A\365\312\265\367\317\364\333\027[\352\243\377f\377\311"
+	.ascii	"\256.u\260\216\207"
+	.string	"\227\224\251\217\276\352Ko\370V\353\244\"O:\354\253\277\341\331\233:\226\236\327\256?%\037\276o\273OVf7\212k\346\355\374=k\366\203\371\312\224\303\240A\031S\377\331\017\207&\254M\372\3171\355{\240\020\2646C\243\214\357\033\256\316\337\367U\376?\271a\254\275\017\262\241\302\206\351s\324Z\f\r\271\336\247x\006O(\220R,\240>H\271xJ&cL\220\221|\222\222BJx\212\212Ad\247\002Q+\242\220R%\234N\034\235N\034]\244@\2668:%\243\216\005\206\030\352\305S\362(\005\005\225<\376\326\246\372\305X\204\022\350\324/Y\202\033\237\271\206\235\032yF\2437~\223\322\205\210\371\323]R\271\315\346\332\252\321\367\256\260\341\025\375P\300\027\335\020\360N\346F4\203\342E\203\234\253\317\020\205\215\325\001\365\226\310\236\330@\303\245LQ\310\205m\256#\030'\207\264\025\026\347\347\237m\2738\326"
+	.string	"\237\244R\307\3649U\336\303\305\341Z\316\303\265\302r\263\262\326V\003\374\221lL\330\3105\356\315g\270\324\217\206\t\022\"S'\021\275\211\226\350\201qn\320\244\017\366\030\231\302&G\0040\325"
+	.string	"\276\355|8\364?\347\354\241W\212s\"\364<A/\224\006\275Q\034\030\320\003\213\017\3242)\276\222\326\326\317\377|\376\307\347\215\264\262\240\314\236g\211\337\363M;\210\357d`I\324\"\330\025^\224J\2306r\365!\003\245b\351\332\256\275\332\002\200\323\250\201(d\035T2\"\"R\220$)4\006\260\002\021\241*z\0200\206\212j\222\f\007X\324jX\373\302\3578j\033\330y\315(o\341q(\320\027vc \"7\212\007\213Y\253\321\016x0+\bfY\255\0330\226*$\220\226u`<\250\225\342="
+	.string	"\300I\326\225HW\327\356\330\313\201\274\204\244n\225y\2219R\007\210\271C\350n\177^\037\210%L\35022 4\0069\360\033\276\006o\235H\322\363\235\005\032\t\207{U\306\227\\\321\310\272\353\324gqT/\374\006\213%\217Se\317\353\251\265\247a\023\016\375\306\224\230\276\266DQ\031\2152\357\213\2770\002X\270"
+	.ascii	"]\020\241\201\024\236I\375+\270\312\340\032\344\0243\361\333"
+	.ascii	"\036a\021_\006\232\377\220\350Y\210\305\345\263\241\212RXCDV"
+	.ascii	"\300\270\201J\345\374A\373\326\262\252\352\265\277\331epCk\227"
+	.ascii	"0\rc}8\016\203\027\217p\217?\346\337\206OTg\210\266;\340 D\234"
+	.ascii	"\366\320\031\363\244P\232\217\236*$T\222\377=2\245\353.\265X"
+	.ascii	"2\027\263\307\235\270\246h\261\373\203\360\356\226\2121WM/\372"
+	.ascii	"\020\303\021\0376i\224u\"\220U\346`6#0\032p\201\027*\361\311"
+	.ascii	"\372n\fk\372\231\357B\231\032W\032\037Q\246n\241[)X\021\177\271"
+	.ascii	"0t$\210;5\030\364\315\346#\367\202O\250\344\222\367\2652z\350"
+	.ascii	"\315\330 0\225\354\270\362\013/\2172\265\252\2707\356\255Si-"
+	.ascii	"\365\261\220\3772\247\347q\003\225\376\2603\304B\315\3647\325"
+	.ascii	"\377"
+	.text
+	.section	.gnu.lto_cfTasks.137.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\213\005\375\036"
+	.string	"\246\262\301Hp\236U\007\263\366\2168\332w0\355\036\026\334\346#\030\303\227/\211\027\b\232\032\f;\265\210\271\006\032\031\222\262HsuA\254\246\001\341\300\366\313H\222!\035_W\303Z9V\004\3352.\275\324E\321\002~\377\222m\231d\260"
+	.string	"\260"
+	.string	"\255"
+	.ascii	"\2602\316Y6\004\204q_\f\177\257\256\337\rf\306\034\320WC\207"
+	.ascii	"n\004w!e3\236\006`q\361g.\2017\370\353\b}1\004\273\021\374\025"
+	.ascii	"\023P\272\257\305"
+	.string	"\237\313\326\360\0067uH}o]\205\375\024\"\005\260\204\177\305},\374\265d\001qk\272\n\201\276\023D\364\275\245E\t\203\247\317\\\006\244L\341_\205\312\360\326\264\007y\033\321\367\226\262yL\036\370\004\262\337_%\374\244\373N\370[)-5 \272`\242\360dxsZ\306D\342{\002}\205\202~g\024]/pb\2528\243\207Hdz\030\277\317W\3533\327\003\311~\347\256\234wTF\272\221\276\231pb\004T4\223\253Up\275\242\037\321\257\322\222\220f\321\221\234F;q\022\364\375\251 \252\316d\203\215!{\223^\263J>`#\303\332\303\277\017\237^u\026\307 \211\304\267;A\337\207\352V\275F%vL\316\354\b\177\314\375\230?\236;\303\323\310\347\215)\256f\025\317\302\366\003\315\341/FGw\026\305\376U\373^\212\321\232\356\273\341\017\347\215\356,\216!w\350\253d\241\357\345X\374=\236"
+	.ascii	"\250q\037\214\377\2320\242\263\330\354\241/\022\206^[\022vL\n"
+	.ascii	"p\202\022\240\214\373f\370\2439\303\336`%\262\b}=h\350F\001o"
+	.ascii	"\345\267|\326wy/\377\345\301\374\230'\363_\237\346\331|\233\217"
+	.ascii	"\363r\276\216\204\317\363z4Q\247\320-\264\013=C\323\3208t\016"
+	.ascii	"\315C\367\320Q\021\364\024\204\016\245\265\264\017\035\204\353"
+	.ascii	"!]J\023\221\352U\262,!\300\263\230\305\214\352{\251\324"
+	.string	">\216\\?u)\r\004\252W\311\226\2602\350\3072\266\"\244\327\250\220\307$\220\326!\324;\\]\344\032\356R\332IiI\250\211\235y\301R\202\214\300\323\350\025\177r\252of\032d\376\222\235\272\006\3277\264\r\3664\202\305\317\244H\337\314&\362G\277p5\f\256e\350\030\303\323\b\007\0319\227\366x;\023\251-\373cgYm\323\234\257h\226s;\337O\356\255?\335\3168\\\372\323\246\264\274a=3/\335\255*;\313\025pm\352cw9ZVui\313\353eh/\250\353Z\2043\220\331vUy)\360\267\252m\233\016\025\310\254O\367\223Y6\365\021\365ph\356\255\351\320\316j\256\250\335\265\274\224\226\177k\253\022\251<\265\005\220U\334.\203\232\303\255\264\274\2417\324\333]\330\371h9\350\200\213\340G&\200\301\017\266\340\007\033\211\020G#l\301$ns\240 \013K %\331L\b\205I\266"
+	.ascii	"\371\241|\224\277\nw\250A0\210\230\244\216\264\214\202J\232\003"
+	.ascii	"\340\"\021\301\252\003\0200\245\212h6\006I\207(\t@\276\021nH"
+	.ascii	"\311[k\264\333f\003)y\211\233N2y\b%\241p\233\225\240\345\334"
+	.ascii	"\315)\344f1\364e_Imr~\320\217\2109?\nD\212\007sLS\366\326\002"
+	.ascii	"\302!\206\210\r\352k\\#\372P\253\332\220UZO\2207\366\210-\333"
+	.ascii	"\313\221\340\364\311\325\204\n\3128\321\211\276\t>\300\362^\211"
+	.ascii	"\360\313)\216j\031\267\027B\361\275~\262(\033\2457T\312\342\276"
+	.ascii	"\200#A\263\034\261\216\231gG\334o\375\240\266\210(\332W\025:"
+	.ascii	"F\341\016\023{r8\305\274\037\300-\213\231\371\362\371\007\271"
+	.ascii	"\264\214 \250\002\002\316\306\262Hr\217B\001\246:j\346zW\360"
+	.ascii	"i?J\006"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.182.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\215\t"
+	.string	"6\321>8P\215\322\001`\204\271\345\222\322\200L\333\246^\2261\217\306\004\005\234iC\210>\232>\216\032\250\366\371fK\023\273\305U]\301\325z\025\t\320\026M\226\221\326\356-wJ\001-"
+	.string	","
+	.string	"-"
+	.string	"%\224={\345\037\310bX*\032%,\273;/\225u\357\n\243\347\337u\355\2242]\001R\034\207\004\217\030\206\335u\326q\313[\301\276\026\231K\333\020\376+\275E\212\337\246P\206\320\376\310I\274\267H\326v?LPv\277\204K#d\227\007/\270\\\306k.\227\366El\007v6\321\r\274$\274\332\025\026\360'\007\234\264`\031j\202\272\262\306\270\252\262\377\375\227\232\205\330\356FKl=\344+\304\366\355\273Jv&\335C\007\364q\030\205:\034G\261\tx\333t\021\035g\004\261y\346\346\231\241\017\00747\256\233\033\003\213$:\334\034\211D\334\314<\256\252\334\220\002\273P\f\325\225\003\025"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZ\260\231\274\323,p\355\305\224\323r\332"
+	.ascii	"J\253c\016\016"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.183.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`(\001\245\r"
+	.string	"\306\330ZE\020\217(\035dbfW\b\254"
+	.string	"\310\037\320\220\245S\013\005H\204\300\022K\350Z\210\235\361ya\224\333F\375\326\255\203v\016V|^\220d\005\320\201@\345\002\260\224fa\001\\\323@GOC \232\354-wJ\001D"
+	.string	"E"
+	.string	"E"
+	.ascii	";]\262U\374C\331\fU\312\b\253\305\356\316KU\275\364\250P\226"
+	.ascii	"\374\257\256\321y\246G\330y\034"
+	.string	"\256\261\300\353\304\n\016\017\025;H@to\035b\360N\020\006\270\314P\260\273\316:\334\330m7\260\275\300~\206#oP\337z)\2335\312L\251\354eD\345\225 \373\312\375\025\222\277r\206\205\364OdSb\340\322\020\332\027\361\021\245\177\"\326\330\375P\002f\367;pi\002\331\345\346\035\330e\274\006\273\314\\>\204mRj7\027\324d\375Qb^0\252'\266G\330u@\t\213\226\024(\030c\f\332 !\360\335\365\255_\245\301\205\353\244&\250'V\031WM\356c\032\004*\273$1^\254\007\211\"\345.?\313\241}\237\304[\374\226\013+\333\2473!\002gc\020\262}2\241\007\233\247\343@\364\3318\016D\003`\315#$!\304\021A\320>\246\3661?\035\216gj\\hz\b0\210\302\306M\021\b\304M\370\270j\262zfb\203\313\202\236\342\006\274j\356\301lP\005\370\316\034/0\\\001\035"
+	.ascii	"C\013b\271\001\0171\256\013t\213\364\336\204\306>@\024\fs]\323"
+	.ascii	"X\326\326\224%`\b\220\017d\034\005\202\254&&\303\360\026\215"
+	.ascii	"RX\027\210\202`\356\031\272\250s:-\264\231/\270Fb\nIS\223\337"
+	.ascii	"U\360"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.184.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\034\0015\r"
+	.string	"\026\331XC\020\2176\035c\b\240\b)"
+	.string	"h\030U\212\027N\f0\263xA\372*\357\273 \270\023.\365\n\255\351\026-\007\tB<\037\231\006\2410\020\206\2124\201\210\372\270\003\214\005"
+	.string	"\027\rWN\373\264%{K\231RB"
+	.string	"I"
+	.string	"A"
+	.ascii	"-v?\005\217>P=Z'@=\302\017\240\0367\2177a\033\224b\317\216\361"
+	.string	"\357\303jJ F\246\231\335\275\036\325\303\275kB\317\017]\003\\\300\360\3348\324|\354\256\253\fw\274\355\005\266\033\330\327\0200}j\303\243e\027\345$c9D\027\"\016\363\273<\355\333?\001\362U\334\344\r\2149\035\240\277\2248\305\346tx\177)\261B\337\242pX^\264\314xT\217.\240\177&\326\206\004\217\316\264\217\342)\274\177&\006\260\333\201E+:I\325\016\361\344I\266,h\310\251\212 \204\314h\306o\200\272\246:G*'y\262/\363\025\037\237\305\024\270<\351\321\347\250\307\353M\207$F\300(\241\"\312Sj\311\n\017WW\354\230V\230\316X\2071\030\341\034h\035F2\001\253\240ip\0204O\347A'\242m\033I&\300\031\007\027\302a]\204\f\344\312@.\221\016\346\271\262\215\2738\n\3703\242mW\367\371l\327\306v^W\374!\322\023\325\222m\215|L\246=FB\247\332\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.185.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"u\t"
+	.string	"v\220=9@s\322\001@\244\301$\031\317\325\356\333\"\307&\316\203\374k\253:\256\317\216\rA\355\315 t\246\025\344\020\244\363\357U>|~\3339\322\331<\344#\244\271[\333{\357\224\002*"
+	.string	","
+	.string	"."
+	.string	"\237=\363\220d;`\r\306\n\315\356\326S9\362\3572\316\317O]~8:\036\013>;\242\335\265\307\343\246\267\335`\333\301~@\276X\336C\024\350c\341\3241\332O\271\312\367\020e\200]\221\026\227\335\220\341\324\n\236S\320\0178\247\363\006\234\323\353\364'\266\275\r\007\022\264\271\201\030\032\355\n\213\370\f\277\365\017\013\214\214J\246\242\004-\347\347\312\225=\023J\b@v5nl6\204\276\230\234u\373(\236\337\n\034Df*=t\247l\333(0\001c!N\202\033u\021\030\251b\244z*\215L\025\333\270\032B\2606\221m\265\323\264\255^\266\343\345\312\242\013\251\222\001\027"
+	.ascii	"8g\340\256\266\212\024\034\243\331\032\234\342\002\362\300\b"
+	.ascii	"W\fR\023M\017\224B\\p\n\214\271\247\351\242\332\351\\\320\246"
+	.ascii	"\313\316\005\200\023\017\344hi\372\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375`\r\007\215\025"
+	.string	"F\240uH\260\330I:\354\307|x\375\322"
+	.string	"\376)\334Sg\201\310LY:\206\262*\f\366\211\216\300eD\030{bO\177\320\177\320\2356c\211\215\204b\003A\023VXa\250\251\207\305#\024\241\252\224\332\354\205k\266\323\"_\222\264\003^"
+	.string	"_"
+	.string	"c"
+	.string	"9<\037\343\360@\032\005w\267\350\271kw\273\267:\005\367SG\273\225XJ\331Q.*\245\355+\300\235\304<\267V\267s\253\320\271\241\3448\364\022\334,(\b\322-\004\367\223\317N\274\003w\n\002\006L\304\303\271\301\002\367\n\030\005A.-)/%\225(\277PJ\351\315M;)%"
+	.ascii	"Y\246\034n\030t\303\235\243\032\356\0304\303-\204b\270\203\320"
+	.ascii	"\013w\023j\341.B+\334F(\205\373\b\235p\017\261\204\030%\001^"
+	.ascii	"\004\331\345A\270\257\036\334V\016\356\252\0067\025\203\033\310"
+	.ascii	"\202{*\351\376\201t\3738\272{\030\335<\\tK\231\310;\206\254\303"
+	.ascii	"\023\272i\270>\005\331\005\220g\3748\337\032tg\245\013\026\252"
+	.ascii	"Y\3146\331XPS]@1\353\3723\333%\231\017L\217\f'[[\231\250KK\026"
+	.ascii	",\266M\267\030\017l\225`;/k\261[\2079\335\272\3329\257-Ut\272"
+	.ascii	"\305\361\242\270\241N\334Q&\356\032%n\033$\356\027#\356\033\""
+	.ascii	"\356%!\356,\0207\223\0177\022\0177V\207[F\322i$\232\353TE\243"
+	.ascii	"\271L!Su\355*\227\0057wI\364\215\324\025\027\334\\\333h\013m"
+	.ascii	"u@8\2676\326\304Z\035mlj\215x\233[\023\216Gsi\"-\244\321\214"
+	.ascii	"44\265h\356L\2104w\246\316\375\302\271\337,\264\274\"E+w\233"
+	.ascii	"\013\023\253\260\212\233\333T4\027'izU}M\371d\206d\202>\241\200"
+	.ascii	"\201\250Q(\013\271\271\234\202\224:\340\002\231*\326\030\021"
+	.ascii	"P\024L)\311D\025Z\314\320\003\030\262vB0\363\316\212&\244f\212"
+	.ascii	"\250_T-\177\336\312\246\021\330D\326N\230OiY\353J\027O\003'\004"
+	.ascii	"R\233\226\001m\214\244\323\316)\2540\252P\215,\247\330\002\033"
+	.ascii	"\204\235\341\326\020\263\311/\241vN\004\254\007;\246\204\345"
+	.ascii	"X\353)\361\206\"\rqz\377\270 \221\202,\210\322H\033$\335\213"
+	.ascii	"\007}\340\017\364C\037\360\007\375\240\017\374^7@\1771\2476\246"
+	.ascii	"\223\022DI\nd\244\277\344\232\345{\316r\330\225@.&\311_\340\304"
+	.ascii	"P\254y\007\177 \266\305+\360\242\305r\206\276F$\344a\306\311"
+	.ascii	"\374\314\037\262\027\030\003\233\2654\351g\275\016\334lj\025"
+	.ascii	"\274\336;\274<\200U"
+	.text
+	.section	.gnu.lto_.refs.e50c4cae105b212d,"e",@progbits
+	.string	"(\265/\375 \1775\003"
+	.string	"r\307\026\037\240)\215\001\303\377\377\217UUUun\333\236\265o\377[\311\313~GZcC\004\331$\311\024\256%7\333\316\221!\377\364c\307\320\204\0333V/v\305\322i%\241R\020\272\016\273$s2\350\235F\247\317i\340T\025\214\034\310T\317\252\301\202E\003\330\230\306\254L[\334\324I\002"
+	.ascii	"7\003Q\301\034\003"
+	.text
+	.section	.gnu.lto_.decls.e50c4cae105b212d,"e",@progbits
+	.ascii	"(\265/\375`\fJ\025?\001Z\033\352uT \fa:\215\001\304\327\3443"
+	.ascii	"\2743\037\351\220\237\370#yf\277\314\036\234\263<R\037\236\327"
+	.ascii	"\017\226z\361\036\213U1\315W\304\275\235nB\261-\256\326u\213"
+	.ascii	"\334\354\253\006.\351\232\336\022o\027yQB\223\206\3151\277\006"
+	.ascii	"\3171m\346\033J\032K\264\267\224R\246}\006Z\007\261\007a\344"
+	.ascii	"\360\334|:^\230!\311\233\257\217\350\353\036\3728&C\006\221\256"
+	.ascii	"\233\257g\350\353\026\372>w\364}\334\350\373\204\321\034\254"
+	.ascii	"\350\3734\321\367aA\337\307Kw`\221\314\373\274\3207\353\364M"
+	.ascii	"6\372\246\232\316G\213d>\315\"\231\326k\333$\363B\227E2/\026"
+	.ascii	"\246\337,DYN\220Xn>\272W\316\2220\332\216gf\266\0051fTV~\315"
+	.ascii	"^\b\355=\266\367\336\300\001+I\346n\276U.\362\377\017\321\225"
+	.ascii	"\227\227\0357\227\tE\321\340\322\302\3157\321\364\351.\331\377"
+	.ascii	"\037\240%>\210(\271\371a.\225]T4\206\216G\332\3157\253\350\377"
+	.ascii	"\036\245\004\225\201\203Cr\363\255\332\225r\227\334&\266\355"
+	.ascii	",3I\336)7\212E^)\027\312\255\335\035\223r\305\356\023\237-rt"
+	.ascii	"\214I\\\325B\025$f\266\333&\2317{\350\016\327\311\317\324\261"
+	.ascii	"\350g\r\035\035g7\337\344\3227\255\364\177\231\37469\332E3gG"
+	.ascii	"\362f{\306\364\313\004\247\211\241\312s\363\315\255\377\253\244"
+	.ascii	"\303\020\2365RbI^\370@\021\363u\026v\261\376\213\344\n\001\""
+	.ascii	"\3425\265\344\346\3330v\2175c\302\002\3613\331h\300\0233r{\037"
+	.ascii	"\355\256\220\033\303n\261mA\"0\026\347\006\233Q\215F\221\035"
+	.ascii	"\267\225\254\302\232\302\325\366_\260\373u\215\267\353\362\270"
+	.ascii	"@\256\327\365q\211\334 \327\310\375q{\\\026\356\216;\344\036"
+	.ascii	"\271E,\362\n\2718~s\\\035v0\356\013\363\310\216\333Jz\311\363"
+	.ascii	"\"J*-\215\214;\343\030\267\225\264jT\326\214\b\357\275\243\316"
+	.ascii	"\370E\217\213\251\337\332\2618b\274B\256\326]\201h\352\270\263"
+	.ascii	"\210\266`\305m%\355]\225q\377\326\256h\315l\033\327\306qrq[b"
+	.ascii	"\267\305\025rkX3\242\342q\313\360!\"\027\267\225\334\373\350"
+	.ascii	"A\311Cv#\263\244G\001\262m\263I\346\006\213d\276\364\242_N\321"
+	.ascii	"/Y\320/W\320\317v\3729\216\276[Cm5\334`\271\371YM?#o\226\205"
+	.ascii	"Q\347\007\223\233\237\215\372be\035\372\031\206>\276\323\367"
+	.ascii	"\305\275.\356\325\357\213ku\017@\\h\352\276\310{GY\233\001\221"
+	.ascii	"\265\031\224a\212DU"
+	.string	"1\3631\036}\374\246\225\314\364\261\230\356\340Cw\020C\213`\223\314\343\255\177\347\364o\031\375[E\033Y\244:<e\225\265'Q7\333;6i\221\026\317\217C8\212\206\031\264\233o;\230E\035\314\337\332\261uh\224\351Ars\035\213f\345`*X(H\345\371\355\234\245c\351,\322\326\261q\267rv\316\007\277=\326\261W\364\310M\371\355\261\216\245\262Gn\357\243\007%\017\036\200\336\244\251\003\242\263\331e\223\314\277Y$\363W\211\376m\227[9\277=Z.6\316\355\312@\200\037z\356\334\fG\311$\203%\307\346\346\337\036\372\277uc\333\3305V\215}c\331X\244\205\263-\334\272\3314\317\307\275\247\324~&\013g\327,\032L\005K\243I\301\221\333{\337zyK~\001\343c\366\025\367\301\317t\013g\333\354\026|L\323-\252\300\311\205\021c\315\210\212F[*\215\034\343\336\307\333\261\237\351\367"
+	.string	"\204\205\263c\254\031>\032\267T\232.\f\360\241\005\315.\271\367Q\311C\321\232;gd\210\362\255\032\3756\233d\nY$\363\326\213\276E\3323\266\314L\210\335\315\267F\264-c\331,\322\232\371-\031\253\366L\326\265\313\366\336CA?\322\316\242nV\261\367\336\366aL\237\273\273\273;\3730\346\355\227\316\026\311\344`\223\314\333,\375\024\350\237\331$\363O\372i6\311\274\232M2m\032\323m\027$\023\213\353\270\317\366\336E"
+	.string	"\330\022\246\313\315>\026\311\374\007\264\271m\222i\261\330,\026\271\201\325r{f\247\274\214:\356\343\336\307\242KD\317\225*7\277\204\276\335\300\304wwv\003\363\016\320\327\"\231\226\314V\261H\f\254\225{"
+	.string	"\342\270H\266\307\366>\026\r\355q\262\307\356\346\203\320\267e\317\020\265A\034I\337b`\332;\213\201\371\253\337f\221L#\233d\376V\312\006z\352K\226\261\233\177\033\345\267P\354\030\006\270\352\252k\237\355}<*:\322\200\341\343\346\037m\222\251-\222y\2538\240\272\317_\016\375\370gO\t\274\201!.\377o(\032\375%f\300\255\2035\360\343\f\234 \350\317x\376\353\205I\300Y\341lL\375\027\207\016\214\201\037\233\260\024\300%~\234\302\177S\200I\340\013\374\030\005|\302\217M\300\025\370q\t\230\002?\236"
+	.string	"\226\300\217\361\b?\016\361\337\325\262\370m\n~\273\177\353\002?\340\307\016\370\357\221w\360\227\026,\340\267r\377E\261\002,\331oy\377\355a\021~L"
+	.string	"\033\225\225\2055H\300o\033\360\337\023\207\360\337<\326\303o7\370\355"
+	.string	",\007\f\342\277x0\b\377\347\360\007?\016\300\177\031\340\201\0010\206\377\033\212\376'\377o\360\337\304\377\002\374\227w\021\177\211\364\333\236\365\341\016,\320\211\376\354\206\315\216x\371\3471\3775\001f\372\357\234\337*"
+	.ascii	"wp\240?\323\375\227\005\376\360c\244\245\337\002M\225?\377u\203"
+	.ascii	"\021\360\333\021\377\371s\032\333\263\276\3536\374\320\237\313"
+	.ascii	"\374w\343\003\374\267\212\203\377V\260\207\377\033~;\342B\177"
+	.ascii	"\276\373\355\210\337?\177\371\261\001~\274\301\217\t\360c\001"
+	.ascii	"\374\230\303\217/\370\361\205\037\033\375\230\350\307B?\006\372"
+	.ascii	"o\236\377\326\375\227\356\277s\377\225\363_8\377}\363_\267\377"
+	.ascii	"\266\375\367\314\177\331\376\273\366_\265\377:\371\357\221\377"
+	.ascii	"\026\371/\221\377\n\371/\330\177\177\374\367\353\277<\376\253"
+	.ascii	"\343\2778\376k\343\2775\376\273\302\177\265\376\233\365_\031"
+	.ascii	"\377\205\361\337\027\377\265\372\357\324\177\251\376\233\202"
+	.ascii	"\377\026\377[\202\377\236\340\277*\374w\375/\324\177I\360\337"
+	.ascii	"\341\177\203\377E\361\337\337o)\360\333\031\377E\377\333\373"
+	.ascii	"\357\371_\336\177C\360_\020\374\367\003\377\355\300\1779\360"
+	.ascii	"_\r\374\267\304\177S\370/\003~\253\200\377\212\360_\016\376\233"
+	.ascii	"\200\377\202\370\355\210\337\326\375\266\355\267Z\277%\341\267"
+	.ascii	"\020\370\355\007\277\365\340\267L\277\355\340?\236\377t\377\243"
+	.ascii	"\374\037\373\377\201\377e\376\027\335\335\335\335\375\345\325"
+	.ascii	"\177\364\373A\360\tmUJ\272\366V\"\365\264a\354\2757\b\305c\333"
+	.ascii	"\026b\333\212>r\354+\252\275-\330\307\275a\354]\264\273m\357"
+	.ascii	"]\334{\373`\3458\356}\303\250\312\b\003\306\336\\J0v\216b\027"
+	.ascii	"\252\275\357\331\233\264\254\252\262\257.\246.V\312\214\273\305"
+	.ascii	"\261h\253\256\272\266q\267\361\302\322eE*\373j\357m\351hc\226"
+	.ascii	"\326\334\315Y\215\2201Ul7\377\202\030\235\323\350&^\276\2207"
+	.ascii	"\377B\026\235[\360q%\007\355\346_(\323D&\023\026Zt\271Y7A\002"
+	.ascii	"fw\363\361b\271\301\006vsf\343\342\004.\355\346_P\242\217Ai;"
+	.ascii	"\256l\335\234\311X\032g\274\352n\376\205\037:L\230<FI\357(Un"
+	.ascii	"\310\355\315\325a\310*\216\213\262,\346yLQ\236\272\267\250\233"
+	.ascii	"Og\235\350aCu\363/h\201\361\222\257\344\260S\3439"
+	.ascii	"\312\243d/J]\3059 $\2311\345L"
+	.string	"ro\256\0168H\030\331\233\314\345\331K\356bt\2732\2739\247\021ma\021\207\347\346#\301e\264\274%k9\202dK\214\233\263Y\326\362\223\246\347\314\020-Y\234\224\251\223\343f,#\370\2023s\363\221\320\350+\371L\317x\333U7\037\351\213>]\266\342#\006\216\230*V\220@\200\\9\2739\227\305\320C5\346\346#M\321\267\310\\\205\354\204\035it2\225g\262\354\206\205\225\326\315\247\313\3075o\354\332\216SX\324\255\225\335\374\337\"\363\224,\345\270\225\204v\374\270\301\346\346#\205\351#\355x\222\241\25007d\355\346#i\351\374$;\311,\320\275]Y\273\371\317Mn\221\271I^b\261\354\336hU\210\310\355\315\305\201\356\302R\205\355\346W\220\324\177f\222\227d+Y_b\334\254\344\302\370\262\246\356\346W\340\246wd\026\264\006\260$*LLrl\205$^\302\304$\213\340<YK\353"
+	.string	"I\346\302\304$s\221|\003\207\\.\222id\0333:HB\026&&\311\224\213\344\255$nab\2229IF\222\215\344\260|$\033-2\027\3118\236sd\035\346\033\2709\036D\231\210\006\2412k\260\354\233_\001\027-$\007\261\310<$\367\310S\031\f\037\3234\332W\f\271<\004\353\311]_0\214{o\r\036<"
+	.ascii	"\315"
+	.string	"\r\271af JC`]Kx\334\374\n\230\350\333),r\221(\312hOIY\375\310_\026\231}d\2572\037\231*\027\243\212  \211\n\023\203\361\224\231\2213\363\217\356\364\217\340\364\237y<we\b\322jsc\343f\017\230\236y\210\201\351\201\347\346\037\251i\333e\223\314\013\026\311\374\021\231\376Q\223\314\225\306N\235\325\315?\n\222k\034\355\320?\312\322?\232\32234\230F\324\324\205\271\371Frt\236\3121l[\220\274\247\214\\V\226a\221\031+Ke,\254'G\021\225{G\255\031\367\336\0364x\b\342\341#\313\312\3140p\222LZ\226\233o\004F\337Na\261\305X\225\213D\345\336]\\\214\371E\276\312V\026\231]\344\026\331E\246\312E\333\026dg+\262/6\261\275\267\007\017J\036J;rx\346\350|\2430}#\032\372FY\372F/\364\215\246\364\213\344\344\250\\\264]{O\315"
+	.ascii	"C\305\313\315x\017\276\263H\ry\317\005\221\312\272\371Ek4\n\366"
+	.ascii	"\266\032L{wg5\230/r\323/Z\323?\266\303sXV{\232\334\374\017\344"
+	.ascii	"l\211jS\306\370\206\214\03385#\03449<\207\323\3405\266\215++"
+	.ascii	"1\003\"\016\256\203\347`<\370\016Nb;\230\016\323\301u\026\211"
+	.ascii	"\347p\334\261\034\376\272=2\315a6\030\216\312\236-\274\266U\345"
+	.ascii	"\356B&\262H\346\213\222\350\027}\351\027e\351\027Q\351\023\331"
+	.ascii	"\321'j\323'\362\242O\004E\237\210\005\375c5\307k~\354v\243.\234"
+	.ascii	"\b\314\252)/%7\3437\246c5m\262\272\254psi\221\314\023\345\320"
+	.ascii	"f\013Rsw\272n\276\235\322\003\356\213\0209\306\273F\243\316\332"
+	.ascii	"\201\2351\332\2103\"\371\231\302\264\340\300<l\033W\003\304\342"
+	.ascii	"\200\301f0\025,\006\227\301g0\031\\\206\3330\031F\3424\314\206"
+	.ascii	"\277`4\330\n\036\203\315p\030\214\005w\301\\\360\032\316\202"
+	.ascii	"\257\3403\214\206\275`-\270\n\336b\221X\rK9\236\202\217D\326"
+	.ascii	"\356\032WR\255\210\232\334][\301.\210\031&'S\214G\270\030\255"
+	.ascii	"\035\020k\206\306\310$\206\233\234\031\215[\214jx\fG!\302{\373"
+	.ascii	"\0303\206y\"\305\230\304\232e\2213\202\366\343gR\202\305\270"
+	.ascii	"\0047\271\"\307\002\031k7\244\f\376\372\255\235\0177r"
+	.string	"]p\240D\301j\330\353\215\334\032V\3035\262\346\214I\017v\r\036\252\032\021\310\267\315&\231\007\030\322\203\243\230\211`g\360Ir\027c\356\346\017\335\321\037R\243?\364E\177\350L\177\bLc&\231\206\231\037Fn\376\020\017\375!*}\241:\372Bj\372BY\364\2236\311\274\320Q_H\211\276\220\021}\241\037\372B9\364\205\256\364\203\352\350\007\261\351\007]\321\017\032\323\017\372\322oSC_\316&\231\017z\241\017d\247\017\244F\343\034X\207E*\341\035E\326M*F\216\233\017tF\247`[%\363wV\311<\220\027}\240\243>\020\020}\240\026\372?q\372?c\364\177\236\350\037oa-\363N\2357\035Y\216\265\376\253\345n\3013\204\206\244\244\221Q\343f\234E\344\242\215\013.7\377\007\211\276\035c\263[\210\242\214\366\024\213840`Ucc\354\214a\324.\362G\2351\f\0314YrZ"
+	.string	"\253K\3365\\u\315 \345p9\256\272sn\036|L\263"
+	.string	"\233+lu\367\\=8\n\313\300-p\f\f\003_\335;\214\205]\340)L\2057.b)\314\002\277\260H\\\365\337\270+w\245\343\336Sa\304X3\020\320PAs\333\346\016`\006I\031\233\033\307\253C\2319`uI\017@\340\252{\346\276\260m\\\2738g"
+	.string	"f\250\200\325%\327\334\263\rRU;\252\307\001\314\024\301\352\222\027\355\313E\332\266\263\035\225%\302\234,\260\272\244\265\303U\327\355\252\021\201\n\353\247\005\0137r{\037[\270d \350\001V'\266V\346\222a*X\032\313\217\244\\\232.\367\t\321\224\321\236\002{a\274h\270\352z\271H\022\364"
+	.ascii	"\253\023\333\373\350A\3370c\323\242C\276v>l\260\300A\271\371"
+	.ascii	"?<\364?\370\357\332\235k\207(\312h\357/\035\306\272\233\264H"
+	.ascii	"\264\233\366{\361\\:\327\216m\013\262w\226\bI\250\200\325%\367"
+	.ascii	"\336\036\224<\\\035\\`1\314|]\207\356\327\316\177\327\356\234"
+	.ascii	"\335b-\025!eqn\276u\230~\351\314=x^\234\335\\\264F_\315\246\177"
+	.ascii	"\266M2-\226"
+	.string	"E2\257\277\350\377\306\271p\240l\001aa\027\375t\261[\262\302\315\327\315}\363\013w\333\354\013\007B\327\336Q\027\256(\317\336QE\326f`m\006\371\311\327\021,f\276\346\242\257\311\364\265\230\376\257\2327s\317\034\262K\232\337\267\313!\032\013W\312n\"\177\374v\247\270\230A\002\271\331\222a\272Y\226}\330\221\021V\205,\210\005\026\033\213\343M\262\337\244b\277\230wG\352\\\335\fd\221L3\n\323\315c\320\324\026\026#SL)T\252\354`1\307nJ\371\315(6\314\205\023\032\262\202\026\232\233\177,\222i\2410\335\034+J\203Fg\004\n\216\237(pJ\320\236\254)\343\304\351\270\343$\277\261\365(\212\231_#\314]\375h\222\3350p\026E\f\0233>U]t\270\226\224uB\\Z|\224Q\262v\273\310\362\260Hbv\001)\241s\004OX\316\203d\256\250M\327\217+#\325\021sK\367"
+	.ascii	"R7e\344\215\220\220b\035X\221\242\311Bie#\310\027\221\233\306"
+	.ascii	"\314\225\324\315\246\020SHi\325\003\254.\251\345\312d\3317_\003"
+	.ascii	"6\023\314\0043\277\216t\214e\r42*7_\203\262\037?\314/\245.\354"
+	.ascii	"F\353\310VP\225\021K\215\233\257A\230\227\227\371E\344\313\023"
+	.ascii	"cR\356\nl\211\371\205$\311\327U\227\016\035f\227%\3332\240\212"
+	.ascii	"`ub6.I\035\031\223\307\315. 6j\214\234\335l\356\310cwE\254p\274"
+	.ascii	"\370\377#\344b\306\227\0357_\203,\223\206I\303\304A7\007\254"
+	.ascii	".kEQ\371\270q\023\007P\223+e[7"
+	.string	"\237\316\264\361\377'C\341\"#\345f\223\213HI\013v\354\334|\r\2125\344f\3140\267\254\321Q\352\315\0319!\026\326\034)\232Z7\267~\366\2605\271\261\006\013\013\216\016\230\230\tf\213\235\234\233\237\301\0273\206\031\243\264RrE$\251\321\254\3519\336\374\f\210\230W\346Ui\245\324\205\335D\331\341\022#\372R\202G\354\346g\320\265g\217\351B\251\253h\307\207\355j\b\215$\227\031A\224\334\374\233V7]0Q\273C\343f\223\205YU\244\030\206\344f\263\305\257G\223\267\233\317\001\316\2442\243\314\240\034Z\340p\334lJy!b\201Jj\314\315\347"
+	.string	"F\237\316,\376\377)\251\212\034\ts\263\271\307\b\021\222\344\346s(\357\362\230\315FI\362\346s0\222'\317\024\267\270\031I\374\304j\r\217\233\317\001\310\235;e\035\2359`uI\037,rT\276J</\353L$\222\033`n.\223y,\216\033\"\034j\324\251S\322)u\025\347t@\242uw\346\214\231\016\266\233K\272\373\004\277i\322v\344\346\007"
+	.string	"\216\234\\9\207\244\312\036)I43\320\262\3129/\347\206\350\220mR\002`&GN\371\225\304\356\006\330\327\325\327\315\017\300\026\0348q_`bb\027\207\233;i\311\267\267\362M\002f\204\2111\023\203\f\225\322\315\3137>,\200\330m\335\\\266\321L\350\352\322J6Q\310\030rl\326\230`F\206\016\021\241+875\271\207\006\274D\213\215J\216\233[i%f\334\233\253\203\375q\265$\312\315\007\200\232~\333}\263FG\2514S\214BH38o7\037"
+	.string	"eg\316\224V\n\330EP\242\330\266n>"
+	.ascii	"\214ll\367\315\354k\016L\222\207\022\262\254\233\217\301\032"
+	.ascii	"\262\\\273OH\330QY\035\306H\311a\303vk"
+	.string	"@\300\334|\f\254\350\277\204\202,\241\224jJ\307=\003\250\005\035\270\264\344\306R\343\200\0047\037;\324\3121qj\310\311s\263\230\2373*\243\330\315\307\300K\037\304\221\354q6HU\221\300\004\212\\\013)S\246\244y\303\225\034\313\"Wr)\273\224h\345\227\322K\031\246\324R\202)\267Xd\231V\236\275\274Rb\271R\224\006\204a\221\213\312\202yX\3552\255\254R\232m\220\252*a\307\023\2712\255\244\002V\345\rWr\357\243&\362\005)\343B\376\206:m\2176\311T\262H\3467\300\321\177iVZ\371\241\362\341\025u\334h1\246\352JdY6\264G\211[\216\233\277AM\177C\027\375\rX\3647 \3657\034\3657@\321\337\300D\177\203\021\375\r>\3647l\351\277Db\221%\222\322\211=\356bP\034\251'F\263\213M*\214\311K'\177\031v[\224b\"\310\220\247P93\347\346&\367"
+	.string	"\304\230\227\021\0370n\376\005{\364\377r\211E\226L\312$\367"
+	.string	"\304X\311\244T\"\244\312\023c\020\032\2715\263\234\177\301\234\376\005l\032[$\363\027\240\0359\302F\n\312\232\317\216.hc7\377\002 E\212\300%ybT\321\265\345\n\036\"D\230\264\230\330\311^\226\024\275\266\b\021\242\201*I\344\304\210\\\244)\013\273\371\026\030\001\003s"
+	.string	"V\334\226\330O\233\324\232\326\315\267`\353\307\017\271\270-1\035Ta\356n\276\206\273\036=\312/{%\311\221-}\307\205\213T\351\365\362+\247\231\262\246\315\223\377?\346\031\031y\352n\276\006/<x|\021\311\2234\271\322\270\335\270\371\032\214:t\200\2403\344L\320\376q\327\346\346k`\201\003\307}S\352\302q\264\300\304\304\366\346\352"
+	.ascii	"\024\225\204\006\224\233\257\304\246K\033\245\215\373f\311\266"
+	.ascii	"\f\245;T\300\352\260\322`\355\271\371J[\364_\326\270E\2265\362"
+	.ascii	"\032K\266\213Aq\212{\266~\314\250\271\322\344\346+9\321\177\271"
+	.ascii	"\302-\262\\!\277]\262]\004\212ka\316\350A\024\013\0347_I\210"
+	.ascii	"\326\322\272\027\306\244\3211\336\025\274\354\240q\363\225l\350"
+	.ascii	"['\266\314\262\3102\013k\375T\355\235\205\200/^o\304$7\026\027"
+	.ascii	"\007B8\256\230I\336|\245,\375\2272n\221\245\214\354\226\311v"
+	.ascii	"\321'\316H\307\230\344J\343\205\311\315W\272\322\177\t\343\026"
+	.ascii	"Y\302\310fH\350\332Z\034\220\264\305m\t\255\2313g\343\346g\270"
+	.ascii	"\243\377\362\305-\262|\221\3272\331.\006\251\261\232\021\226"
+	.ascii	"\334\233\213\003\237;TZ\230s\3633\244)\253\312\252\322J\203\026"
+	.ascii	"\031W\207\2376\036t5n\266\3120\246\224*Y\224R%\025U9UN\361\254"
+	.ascii	"\350g0\262\247\334{\312bY\274\273\303@X\006\035\372\031X\340"
+	.ascii	"\311vxr\236\234\247tSb\004\313\315uuXtsv\3641\264\335\271\303"
+	.ascii	"b\316\016\227O\233\02499n>\2061:\231\216\316}3\367\266\307.\031"
+	.ascii	"Xu\352\3347]4\001\031\006#\372\030l\314\231c\306\355\215\230"
+	.ascii	"$\206\242\376s\334\357\001\b\213\314q\326\314\222m\031@-\334"
+	.ascii	"\342f$\367V\343\240\310\016\023\035Dn~R\2308q<\020V\005\016\356"
+	.ascii	"\276\351\275w\361\270e\254\360\362F\214\330\346\302\352\360\244"
+	.ascii	"\"\372\231Mn\363\354\306\315}\263{\357\335%\352\215\230\344\346"
+	.ascii	"\332\352\360$\027\372\277\375\375\315\035\205\265\367\236Q\036"
+	.ascii	"7\226\224\220\371\333\333\322\332\016\377\220\305V\203\377\371"
+	.ascii	"\357\300\210\343f\201\366\266\367\266ut\022\264(\034\034v\331"
+	.ascii	"\266\367\224W1\002^YS^5\252\312\274\262\216\252\312\274vq\312"
+	.ascii	"H\361\bk{\025\253\312\366>\232\232*\216\350\312\252"
+	.string	"*\213\332GUe;k\263p\313\262\373\350U\334S]\373hO\355\250]\326\225\305\241j\312+\253\252,*\353\250\252\314+k\227ym\243=\025\205e5\265\261\216v\231\327\234]\326\225eTU\326\225UU\346E\306\222q\301\006\314\n\\\336\210\344\260]\252\246v\f\0309\242\260\214\332\252\216]\273\315\336\366\214jc\355\266\2755\330;G\027V\233\250\0326M\252-\206\224\226\250.{\334{k\200!\365\325\265\247\332\212v\007\353OX\302\020\332\023\256(\261\022\241\322a\272\302)\203Z\302\221\017\005\2368\205\022@\241\236&VT%By\250oxB\021\352\033\236\260\242%R#\025)\020\177T\250\365\\KT\360\247\245^\212A\355\245`\364\003\366\200xD5\370\201\250\006y\347z\216 \252'\b\207(\240\353\t\005<SH\200\250\0063` \252\301\013D5h\344\203B=M\240\347\211az\236"
+	.string	"\372\323\322\0074\205ZO\264\311\347OK\031\030\225"
+	.ascii	"\002\207$.\350\221P\203\351\t\f\201\364S\207D\037\272\236\301"
+	.ascii	"\337\252J\240g\301\237\226L0QB\211\017\034P\364\206@\021h:\024"
+	.ascii	"Q\364\247%5\330\373\240\006{I\353\237\226>\250)\232\342\227\372"
+	.ascii	"N\234\251\323\217\312\033Ry\031X\323!\t\037\022\n<q\232Ha\232"
+	.ascii	"\252\n\3034\253\300a/o@\035\0223\007\324!1\373\320\364D\201="
+	.ascii	"\037\025\206)\244C5\205\352\375\2548\201D\3657\202X\264\372\324"
+	.ascii	"_\220\312+\221\244\242\353\271\226P\205\376\264\244bx\342\303"
+	.ascii	"\3607\034a\370\023\376\210D\177Z\n\236=\336\207\341\017\355\375"
+	.ascii	"R\240\276^J\364\247%\f\324\223\030\034\366\206\376\264\244\022"
+	.ascii	"\235>\f\177\027T\242\323\217\b\r\031\370\323\322\206\247\336"
+	.ascii	"z\022\325\237OE\212\242\207>\211P\221\016\375i\t*\370\373\260"
+	.ascii	"\206\200\n\376\216\376\264\204\246\303\036q84\301\367#Q"
+	.string	"\344;\207& \025\255\360\235h\n(\220\030<K\f\323\025NE\252\3170]\341\224/ \255?a\t*\n\3654\321k\n\022\376\316\023T\244`T\002\005\372\204'\tD\303\364\034\341i\351\007\354\371\206'\374\200=\237\241\016\226\326\364$.\231@\241\236\353\205\020\030@\241\236k\006\036\032\374\255B\2504"
+	.string	"\252\323\t\234\300\031\204B=\327#\324\007\265\376V`\bt=\201P=\340)\002\205z\256I\327 \374\235'\274\367KQ!\352\244\017B\b\b\bA\004\025>\027a\001\035,\240\003\363\",\200\211i\001!0\351\207\300\204\327u]W"
+	.string	"\211h\nG\177Z\"\252\301\017h\357lJ\321U\370\273"
+	.string	"\345\255@(\025MaUy+\212\242w\222 \252\301\240t%!\234\300\252\016I\020\325 \222\312\023\362\t\317`p(BU\321\3360%\321\233"
+	.string	"Q\r\"\241<_\t@%,X\327&\324\307[3\374iI\003\025\212\367\324[\177$|\302\020@\3400E\252 EW48LQ \332\353\235I%x\3425\021\201\274^\357\004ByDB\247\037\360\374A\323S\005_z\246j\023\357\311\351\367\304\353\365N\241\265\t\365i\370\323\222\n\347\n\254^"
+	.ascii	"\004\016\323\374\324[\177\304RE\241\200g\n\023\212\247\006\177"
+	.ascii	"\251\tu\304\372\344\364\0036%\371\250p\246x\230\242\035\350\365"
+	.ascii	"N\237?-\365>\364\2322\004\321U]\241\022\371~\304\242\024\320"
+	.ascii	"\024\277\265w\036\241\276a\020H\355\375V\225\207B=\327\242\247"
+	.ascii	"\336\372S\241\204:$\021\002\n\3745\rS\022\350z\246I(zC`\017\212"
+	.ascii	"\330C{gJ\001'"
+	.string	"\341/\230\206\020^ EU\030\0221\240\276a\220G\344K\317\341\211\242?-\251H?8\021\221T\244@\3043\330K\313\024\365\375R\fS\242\017U\221\036\251@\201D\250\021M\300\363\t\b\365\375\322\024M1\344\t\177\034V\236\217\323ib\370\3439A\001\211JG+\252\242\351p\205:y>\341\357\004o=U^\020*]Q\240D\365\002!\024x\366\200\326\024M!\374\365R\337/X\n\177A\255\342\f\352\"U\004\360L\001\034\022St\025\226\320K3\250(\232:\241#P\240\2230D\360\024\221\202\330T\201\n'\007z\277\365\f\242\302_O\310\007\034>\251h\372d\002]\317\024\277\265\027\002\365\rOH\177\247\222\360\327CU(\236\2124\b\210\n\205\347S\217\247\002\352\344\2518\203Ej:LS\224\207\006\317\264\211\327KUsE\325\246\246!\357\247\252i\020J\\\261\036ihj\032\256P="
+	.string	"\250?\025'\317\t\352\004\352[\241\210\302_\006\224\270b\345\241)~\353\231\342\227\242>\236\223\360\367\264\016\207A\225\327K7\254<\275\362H@\241\236&\232zG\177ZJQ \224\017}\352e\240\252\250\020]O\240F\207\202g\3524\\\325\337\323\017\032<QH\317\247^F\203'\n(\324\323\304\t(5\250\207>\365~zB\250\t\240P\317U\373\320\364\247\242\276\241\365\\U\"\025\206(\240(\320\212\365\227\016\177)\211\336/x\nW\370\212T\024\330[!\002u\n\201B=\327!4\3703\261\252\350z\232\200B=W$\037\n<\205N\277\022\253z\002\211\326\020@\304\023}\372\tB\225p\022\376R\f\203\030T\234A#4\3703!\034\376V\250\036\252B\002\300s\035\256\025\250\250\252\376N@\205?\240\357D}D+O\305"
+	.string	"\032\374\255z\345\235+\020\035\201\006\177k\320\237\226\206\351\n'\013T\3360]\341d\256<\017>@\203\277\2258\034\232\260\242N\351\271\0225\211\030\021b\230\256p\322\177Z\372\240\246CU\210\252\030\250<\025\247\360\027\254@\005\f\253\020U\321\224\270\016\205\353y\"\205\206^\n\340\020\312\253"
+	.string	"\345]@{)\324\260D\212\256\350\t\253\020MS\250^\005+\326_\357$\236'\212\326s\204\f\240*\324\020p8\034\201W\252k\212\002C\210@U\250\013\250\323\271\n\321^\212\222\020\016\177+1\b\245\n\207\275\r\352OEStUW<\255\347\211\024D\250\323\271\002\207)\200@\264\007\004B5\255\347\211\024H\253\020j(\002\bDE\254H\321u=G@{\351\260))\305\220o\370KQ\022MD\023\326\363\304o\310I\370\023\246\247\0060"
+	.ascii	"\317\336o\375\245\"\322\341\004\204\303\337z\246P#\326\363D\n"
+	.ascii	"\242\365OK\037\206\277\f\037\022\321\364\303:\034\246\037\202"
+	.ascii	"V\244+\032D\201\350\232A\345U\200B=O\020\016\177kO\b\325$\204"
+	.ascii	"\362JX\323!\t\f)\372k\372\255B\324\367\003\"\252A\225\350t\244"
+	.ascii	"\002\365\tK@\3273\365A\235'x*\206'P\364N\340\t\f\252\323\257"
+	.ascii	"I8\024\261\246Cb\320\312\013\201i\025\376\240t\t\236x\350z\246"
+	.ascii	"<t=}D(\036\360\374\245\250\232\264\362DX\205?(\23731\211\340"
+	.ascii	"\200\001\024(\240{K*\n\365\\y\275\246\017\275\246\017\302\337"
+	.ascii	"\031\374\320K\325\017KJ)\272\366\316\364|\352\361\326\341\360"
+	.ascii	"\004\232\032\3757\311\230.\364\2266:.\265\222\316j\207\034\273"
+	.ascii	"\233\217e{\037\213.p5\211!\306\f\323\204\212\017*3\314\205\373"
+	.ascii	"\261\343\r\0170_2\335\233\031-/7\277\3746\355\356)!5\\\346\202"
+	.ascii	"\334\214\335\230nz\271Q\200T\r\351\362U\006\007\217\2364\264"
+	.ascii	"5@\244\234\271\331D\373\255\335\325\362\303c\013\207\033\227"
+	.ascii	"-B_Xn~h\271\271\345\277u0\2222d\322\330\335\214\345\230nj\321"
+	.ascii	"ww_\204d\301Rt\243\307\017\027Wnb\271p\"\370\341\022d\210\334"
+	.ascii	"\315e\030\323\315+\r \342\343\311\231\031/\013\211\232.7\315"
+	.ascii	".\234\bv\006\"=E^\240\261\202\fbc\205-\205&\2503B\024jD*\305"
+	.ascii	"(\212\246\2242L\211Lm\223\016\223\025@@`P\"\027J\253h\017\023"
+	.ascii	"\200\203\214\3145=\222sN)!\222$I\262?s\036Q\310\"\352\231\271"
+	.ascii	"D\205\320CI\236\225\f\235I\327k\251FbH31\254o\335Y\311\3353\274"
+	.ascii	"O\rr~\036\005\301\313\362~\363\247]\342\326<ZB\365\265HM\336"
+	.ascii	"\243\303\271\224\026\036k\360X\022j\367\321\001}\032\"\031!\201"
+	.ascii	"\200\262\331\231"
+	.string	"#\234\302[^\353\3047\313e\214\\Y\217V\224c\227\261\2363\270\363t\323\n2\247\274\217\377J\214'\265\017\221\352o\352\307\263E\312^\212\273J\002\016?\360\366\202I\372\031\036&<\267AF\032\247W,\t\030g\212q`)\026\372'\326o\322\357\345\241Pu\023\322\215\220;\321\343\230=\003\366\257d\310\3774\f\200%aB\302\013\2374\204\237Y>k\307}M\257\341C\275\257iu\335k\301\240$\222\224\352N\212.\266?an^k\316o\031z7\344Z\302\203\r_\\\254\265Z\371\331X\373\201\373\2639RX\026 |\250@\232\243\301\030\037>S>\b\256lEM\345\202\231\033\254\024\227\2730\245\215\266,\016\023J\241\220\227\324b*\266\276\017Pi1\360\371\355\310oKM\022+7R\271\220D\225,G]\206\267\343&\3005(\005\367\341'\353H\340\246\260E\365ir~\226M\237\364"
+	.ascii	"\034\2177\371g\371zd\357{3\021\242\304K9\241\271}s \300P\243"
+	.ascii	"/\212\324\177\321\027J3FU\177\360\372\317\345\321j\300\366\363"
+	.ascii	"l\036\3170\345(:\242"
+	.ascii	"K\002\332\304\003Z\304\035\351+*\261\253P\3641%<\225\005\300"
+	.ascii	"-\251\034J\372\224\361n\217I\201\356\024\265\2406n\243\324\035"
+	.ascii	"\266\376\002\265\006\2668;\255\030\330\314\300\321l\0279t\026"
+	.ascii	"&\023\230\213\006\240\030\326K\024\260\254\335NQ\211F\372\236"
+	.string	"\240\016\347\375x)]FNtQ\035\324/\231A1\205e\032\334\f\342\023zy~\345\240x\226\202WZD@OB-\331\007d\244\035\321V\3770\300\037U\226\3040\214t\361c\261C\252V\377!\332_\237\310\242\366\366\361\320sF7\267*s\215#\220_Rav\374\nf\226@<t%~jd\302Z'\027n\033>\225G\236\t\023\3329\357\351\237\f\232\t\003\346\224\006J\262\343\\\262\303\b\250\331 \356u\0067\323\206\367\271X\001\271\f\270g\226\017C/\340H\2242\017I'\363\235\r/\257\237\021;\244\b?\017\235\241\264\005\032\312h\250\225\234:o\307\364\005,\377\307\3016\345lX\2465\271\242lv\213\213\001\r\206Qk`-\340\300T\277\034\027E\220\365}H-c\362\t\334\017Z\350\3047Z\202r\215\2127\n[t\344\342\215\360s*\213:\266\354\332e\032x\222\323)'#x"
+	.ascii	"\214\207\036M:\320|Xx\017\204]s\306\206\340\275I\323H\225\363"
+	.ascii	"\3751\257\002\3518\257p\221\276\325\203\322L"
+	.string	"\205\300\346z\270\030\177\347\371\311\274\303\333\272\020\035\355\352\r\301\033j#\223\300\026@2\230\371H`\006\375\\\275\346\205`\250\0048\326\361\343<\240\023\252\246\246\231\357}[\244\217\263\033\301O*v}\336\004.\364G\265\f\314:}\372F\320+\263\204\243\301vd\r:\353\314\217\361\221\250!\002\250%a\202;\210\310\250y\274\354\300\326\023p\365\236\3555\265u\303{Bf\254\327\002$\023\350\237\030\345\013,\237;\363\213\204\204j\020\333\2261\345\316\250K\214\027\235l`\232\343\300\220c>\242;B\236\332\325\237T\336\332\246\231\302]RX\3260\200\352s5\272\024\001j\352\205\0062\273G\2226Vm\350\326S\226#1>\356\304b\213ft\313\001\343\030\322K>\330\271\362\003\f\333\236\272\200Df@\035J<`\270kA&BO\312\275\255.{\300\026\322\\\261\373\325x\354U\263K\371\321\351$\004"
+	.ascii	"H\224\343R\030\303B\235\260\221\246\303J\312\f.\243\207\2771"
+	.ascii	"\365g0Z\257\300\335\267\222#e\272\214\305\317\352\230@<|N>hs"
+	.ascii	"\004\303\240\336zz\240\347\002\375\250e\320\003hM\355\355\037"
+	.ascii	"k\034\203\013\262\272v\311\262\231\343jv\262C\003\337\257\366"
+	.ascii	"\023\335^\3573\326bN\207\213\336@.\320V\257\274\253\255\246t"
+	.ascii	"J\213\343\221\220q\333\022\021\252$`\036\016\303\233\020\003"
+	.ascii	"^\366c2\204^\250\025\005g\313#\314\374'l\356B@\344\352n\363\223"
+	.ascii	",\233}A\233\317\355+\177\b\267\213\225\031[\345xt7\2441\323\022"
+	.ascii	"N\312a\353u\336d1\205j\214\316\230\243\334\022 X\261@8\t1R\241"
+	.ascii	"-\240"
+	.string	"\362\346\362\353\330B7\342\022)\017\301U\222\025\301@\333\325\306X\275\302\252\304L\270J\305\001\217T\215\017\nh\346\271@l+Q-\230\365\237\036\201\311\262\314\257\260D\364@l*T\253\211\257$\351\357F\211\203^\225E\335J\261\234\031F\251\264\234\222\320p\036\341\332\205=[\222R\377i\032\321\351X\327$\206\325!M\353\212\355\216\346\257\213f\b/c\013\035\337?&Y;\324O&\252\200\024a\353k\017\365/m\323\267\251O\226\226fC\024\034\203\223es\272\356\264?\031\346J\374\257TI\330\243\002\022W\341E\263\334\204j%\341\213\260*\177\257\233\330\260\024&g\247\360\363\210\3011j`\025\271\272\243\017\314hj\263y\367\254\265~x\374\276W\322\301\274v\217\312\201\265\214\353\316sr\235\325\033qpp\2158F\335\272\251`\373`?\026\001\262\232S\343\037\233\n+\215\321\001\322\217\306\302\340"
+	.string	"Q\036\037\002jl@0M~\013u\006\342\022=\"j^\247\312:"
+	.string	"\200t\201[\3668\232\t\177\b\207t:\004u\246\322\263\246\004}\252\030\315JF\231h)\345JD:\016\200\210}Gx\263<\2505V0\003"
+	.string	"\323\223N\372A\352"
+	.ascii	"\206\232\361<zH-Zr\033\016\360~\365i\311_Kx@p\024\245\2467pN"
+	.ascii	"\306_\211\332 \033\"\361\006XYP\020TG\341\206\245\255y\344\210"
+	.ascii	"\366wE\017\300\211\240\327\244<<\006\302\324j\261\231\316o\361"
+	.ascii	"\333U\357D\373\240\307H;\226\016\227\234\275\255\335\023h\"\335"
+	.ascii	"r\374!jR\204\266\025.\275\207\302\345\235\317\016\251S3\211N"
+	.ascii	"\332W^\210\244\335- \323?\317t\355\324\344{4\305\370\256\031"
+	.ascii	"\355\345\004\260z\236\214\305\235\244\020\036\320\257[\031\211"
+	.ascii	"\n\020\242\031: L{m9^\177A\200\364\325\336lP\206\256,\227J\355"
+	.ascii	"\0030Uj\243\367+\254}4\252d\220*.\271\347\\\rE\240\225u\364w"
+	.ascii	"\262\027Q\3003\t8\253a\373;8]s\220\200\355_\223\245,\3607N\036"
+	.ascii	"\325WlA\037\020\331ujS\023\303n#\023\247\324\t\272Uj\266\035"
+	.ascii	"\216\277`\347\250\263\026\250\202"
+	.string	"t\352KO\347Z\213\244\325\377q\037(l\272\027Z\220\321\224\356\017\312E\371<\323m\361\266\315\273\334\245!\272F\217\033\252\004\275\234l\337x\271}\374\333\362:\327\370\254\351\366\036'l\323\245B\202\217T\261\tu\257\351WY\312\031\235\034\244\245\370\370\272\005\033\246\302k+\337=\347\222\267\355\256\201\2437\367\212\332\300v'j\3425\027\243\350v\t\277\225\305i\204\223\264\305_\327\320I\020\336\001U\214=\024\242\343\201\231D\273`\215\244i\266L!\344\205\242E\372\227\016\255\315\276@\237Ev\311\263\316i:\3460t\216\017\364A\251G6\003\r\206w\001s\013D\\\234\217\003\036z\r,|\317\236\230Pv\327D\032\335N]\033\007\306e\303\213M\207=%\227\355\336Z;\264\020\334\361=\271_\001\317q\020k\271\267\345zxr\020AW\346\354\f\362\266i\3558\3040\032\t!N\212W\322\023\232"
+	.string	"\353\325\352S\227\357\203\202/o\345\301\007n\036\340Wc\255\213\355a\017\033\201\003\222q\223\315\306&\"\007\254WZnlc\317\235j\nh\246\017\t\340>\017bJ\335\231\303r\017\311\210\004)\031X\270\212\222&\204\336\030N\030%\260<\003\006\016FN\300~en\227P\355\362\364\257N\fL*9Q\350)\230\237*\224'\371\3138\355Wm\027\207\225Y\237\001:z\267\331\364i\232C\374BT#\345m\310\213J\030\220n\f/fc\325>\023B\310\fU\366UAap$`\177\023@G8\354`9R\033\214D((Y\277\222\214y\312\213y\035\271`I"
+	.string	"\r\324\227\272Ok\037\266r \321\020\332\213n\302\200\025\036\245(\217%\252A\316\340\024\303~\355\233\327Bee\027\346\204\310\003\227\267\203e\304\204\363:v\r\321\023%h\244P*\300\353Cod\312\216\243"
+	.ascii	"\266_\264\321\312\303\243h\254\312\220:J\246\026S\033-\016\241"
+	.ascii	"\013n\237\362ndy|\236\240\247\035\346c\304\241H(\240\300\360"
+	.ascii	"H\254\374W\265\210>\362\213\3272\325\260\343\277\217\250\315"
+	.ascii	"\324\305\007e\033\340\016\316>:3\006\343*6|O\030ab\362\367'"
+	.string	"\272"
+	.string	"\320C\255\316i<\027\360P\307\267X\334\034\b?\313\013\307+@Y\300tF+\376\321b"
+	.ascii	"7\342\241E\236E\273\354w\3328\317\346\035o\271\253s\227\022\254"
+	.ascii	"\226\016\377\361q\202~\230\371D\331F\240\037\3206\353\365\317"
+	.ascii	"\245<\216?\330\332\273\272{6\242I~,\315d\247\313\355\377\247"
+	.ascii	"\241\346E0\215\361\326\254\r\352\221\356>\303\275\221\3249(\337"
+	.ascii	"|N\346F:\317\225\345\025\350\276\3458}\025\275\253l\235J\006"
+	.ascii	"\2055\300\277\323\362\237\361\365;\254\271\306\271:j=\002\370"
+	.ascii	"\215\255\177\246\037g\317G\027c\013\016\310\344\256H\335\367"
+	.ascii	"\3639\356\311\212\0370V\035\365\030\345l\226\364\365\344\257"
+	.ascii	"Yp\\\343,\325u\353R\371\003$\273\0313\234\0328\346\023\363\216"
+	.ascii	"\324\353>\224\234;\331w\005"
+	.text
+	.section	.gnu.lto_.symtab.e50c4cae105b212d,"e",@progbits
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"gyroSampleReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"schedulerSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"gyroInterruptSyncActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e50c4cae105b212d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1291 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`O\002\325\b"
+	.string	"d\nC\003"
+	.string	"\020"
+	.string	"\243\274\344\244\007\b\002"
+	.string	"\002\001\002\002\002\001\002\003\002\001\001\316\255\207\352\b\236\001\002"
+	.string	"\002\004\005\006\002\006\002"
+	.string	"\002\007\b\002\007\004\347\266\277\373\013b\005\007\005\004\005\217\321\237\360\002\n\006\377\200\252\343\001F\002\t\002\t\002\n\002\013"
+	.string	"\f\002\013\002\r\002\016\002\b\002\017\002\020\002\013"
+	.string	"\002\021\022\r\002\023\013\002\013\006\002\006\007\240\342\234\212\n\b\352\263\360\321\b\f\r\370\216\314\314\017\016\211\366\331z\017\307\206\334\021"
+	.string	"\020\366\311\315P\026\t"
+	.string	"\021\313\331\240\372\b\022\236\314\252\317\004\023\024\240\342\234\212\n"
+	.string	"5 \220\002c\266u\230\342\037\230;\3118\b\270\232\177\367}\300\310\006\307\032\227\233\301\026z\336Z\204\201\207\236\337B\267\013\225\025\006\030\330\256\326\n.\337\002\246\224\353\265\f\324\367!\213\033\007\342\020to\356\200\200S\021l$\235\210\033no\262"
+	.string	"\002\254\262;\243\224AQ\330\f\0300\350\201-\363h"
+	.ascii	"\347q\360\247\t|\327\344\316;2\t\313\2129\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375 \377\225\002"
+	.string	"\364\002\363"
+	.string	"\007"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\003\004\005"
+	.string	"\006\001"
+	.string	"\020"
+	.string	"\007\001\001\001\003\001\200\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\b\017"
+	.string	"\001"
+	.string	"\001\020"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	"L?\030\215\001S\225q\024\351\236p;n`|q\021\202\304\345\314l.\006\"\004.\303"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`Z\n\255!"
+	.string	"\306f\202G\320\226I:"
+	.string	"\251X\016\217\332\262-\031;\203\200\240\360\315%\022\215\033&\022"
+	.string	"(\365\212\3275\224'Z\232\\r\330vo\255 \223\001\271\013\315\301^\340\005\027\001\336,\303\241q\265\002\364V\263\364\203\200 \271\245L\001s"
+	.string	"g"
+	.string	"s"
+	.string	"=\275\317\270\214fo\020-\311\341\362\345\2263\"\244\b(u\355\332\314\223H\037\244K\315\213\305b1\262\337fgwsH\360G\0041\007\f\024   \005\363\022\300\005"
+	.ascii	"lA\261\234VT\264\224\f\205\337\252>\310R\213\243\177\003\205"
+	.ascii	"\331\f\033s\275\260/f\300\370\261:\256\372\177{\373}\355\377"
+	.ascii	"z\335\335\331\376\177Y\275^-\254\354n\225\355)?\271\0028\272"
+	.ascii	"!\343\325\360\230\032<\036\220V\305\371.yZ\030Ykq0\262\266]\362"
+	.ascii	"\337\325j\325\335}aw7uv\313/\253[\306\307\370\215\177=i\026f"
+	.ascii	"\344\004\b\365}\257'\205\365\301\321\244\367\332sj_\277\252\202"
+	.ascii	"\365U\2603\254\305\365[\3345\356*\273\303\016\366a\354GV\237"
+	.ascii	"\265A<\206\232P\337\235\260K;\001\003\316)\346\211\035\006G\201"
+	.ascii	"\334\301\310\332\346\325\nB\236:Y\034\277\034\3439>\tO\347hH"
+	.ascii	"I\317\357\365\234Y\231Db\310i\312\274\031\242H\213\026U\225\n"
+	.ascii	"\3060nq\034\253\354:\330gx\216g\326r\004=\257\r\242X\322)\343"
+	.ascii	"\200\350\3200\201Z\356\005y\262b\302\263\306\232\3142\t\t5m\347"
+	.ascii	"s\205\307\204\310\023\0209;\226\025\374\021B\366\262\001\277"
+	.ascii	"K\336%Wf?\206\307B\004\022\217\003\024\034\222\244\005\207?\013"
+	.ascii	"\377o\233\247\324\335)o\371\267\267.\371~e\351\262\377\346I\251"
+	.ascii	"\224D\233\366\327\233\327C\211)HK<;o\337h^7\342H\017\313l\321"
+	.ascii	"QL\306\326\254\017\323\317\\\271v\355\265J\226|,\245\256\305"
+	.ascii	"k3k\364c\344b\017\377\332\215\313\376\234\356\356\360k\377S\253"
+	.ascii	"\032\201P\250\3619\232\031\221$%%)tq\005DA\347\224\321\003\021"
+	.ascii	"@\2454\212"
+	.string	"\242\331\244\322f\"8\300\2520\261\224\212L\201\327{\355B}\332R\265\343\177O)\275L\214\b$\225\275\235\032\223\312\034\006\376\263\275\203JM\332\023\3476-*\215j\006S\022,Khg\357\b\2373 \255Q\372\230:\3257\247T\037\007\0234\225*\207&\337AC\303$\2268\342\256O\211\274{=\377\364\250\225\204\314\351\003\027\257\002\216\311d\241\340\024?p\252\260 \230\352-@0y\362\371\274O;\013Mg\312\251\324\013\260\242\252\370\236\224\321\317hP[\206\020\270\"[le|]\016e\236-\365\"8w>\206\226\273:G\213}\276\204\fs\273\232\202\371\265H\021\315\345\beS:\357\230\322\240\300\257\276c\364\bq\342B\177\2052_\fb\360\327\225\314Sco\004\302\245M\274~q_J\352\345\367i\003\033\207\346XN.\312|\027\260\331V\005\202+[JI\002\013\005\275\272\362\316\""
+	.ascii	"\220f,\250\3102\f\310fB4\222,\237\025wDcVF\241$\304$\223G\371"
+	.ascii	"Tp\347\266\013J:l\036I\207\315#\351\260y$\0356\217\244\303\346"
+	.ascii	"\221t\330<\222\016\233G\322a\363H\302\013\0223yL\017\251\231"
+	.ascii	"\177(\321\006\243\223\023&\317\232\231\214\005\231\215\004\241"
+	.ascii	"zC\315\230ux\\\"5Yttqb\215C\036\362\200|\2414\273\021\235\016"
+	.ascii	"\240\027|N\327\336\331\232\277#\333Kn\304\252\3431C\256!\331"
+	.ascii	"\303\371!\024\r\202?\304!.\236J\212\020;F\242\f\202\356~\257"
+	.ascii	"\232\260\247\243l1\360-\257\273\227\r\370\200\245?\332\234\275"
+	.ascii	"3\300(3^=\035\323\216]T\252\006,\303R\031\\Z\302\242Gk\001>L"
+	.ascii	"\n\226\n}\273\331P\331{\324\024@J\211\005\266\f\272)p\264z\016"
+	.ascii	"\277vl\375\002\036;~\342\262\344\3556\303\3166\330m\206\235m"
+	.ascii	"\260\333\f;\333`\267\031v\266\301\016[R\\@\346\3115\245\250\222"
+	.ascii	"\323\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`b\007-\020"
+	.string	"\026UH:0\3058\035\342\356f\nC\244\271]\3627\344fF\262*\332\247\245\240\240\020#\243\265ga`\304\210]Q=\331\210\204\032\320a\217\240'\320\263\366\250\373\305\037q6m\"S\n2"
+	.string	";"
+	.string	"@"
+	.string	"\335Os%\267\225\263Un%\370\177\275\3364\177\323\334[ae\350\033\314\027x\373\272\356\366k\3732\314.\303;\373\301\\\331m\335\266\322\177\035`\001\204\236\350\361\200\376>\360\376|\016\372\272\262\f\203\0211\214R\215F\3236\233Lf\333(\024\324+\225\247n\261|<\307\205B\227\270HDW\245\357\351h\344\222\2335\007\276\367x\273\013\227\237f\2473\302\301.z\"\236\020\320\037\013\364\007\344\276>2\017L\207\210\255(\207fC\323\330dd0\266\013\212\252\222BY,\304s\025!\n\321\304G\341\037\361M\356A\363\007\315\375\265\027\275\2665\273\325\272I\346\332\245o\302~{M\233\332\027\317\320@\307q\204\370\037\352\312\007p8Y"
+	.string	"`\242\332\327\217'M\2374\253\234v]\271\273\377\264/\001\200\244\250\221\260F\243 )I\3668`\223DI\033\022\340q\262\206)f\210\021Z1c1\033\256w\305F"
+	.ascii	"\243\026Q\315#\251\231\373!\377`\251\2243\352\227\377\355\260"
+	.ascii	"\264\253_\026\302s\312\377\365\020\017\320\252\341\002\341\243"
+	.ascii	"o\374p\231n\244\232-\355\0244\214t\254\321&\201\246\256-\332"
+	.ascii	"i\260\335\226&\271`\325\017<\245\242\266\3646e\354lms\357\bj"
+	.ascii	"*\013\b0\223\b\277h\254\276l\310\024\206\275,4JhY\013\034\r\241"
+	.ascii	"\237\234\211\346\224\b\304\025\346G\277UH\217\002\363\351\244"
+	.ascii	"\345\230\312\270\333Tj\302\030{\226\235!\225\214\275\207\303"
+	.ascii	"\024\207g\007\215\210Y bcD\216\021\025'\235\013\3059\024.p\313"
+	.ascii	"D,K\236d\330w\020`\267\007iz\352!et\374\2136T\255\373\005g|"
+	.text
+	.section	.gnu.lto_.pureconst.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\232\004\004\232\004\005\232\004\006\232\004\017"
+	.ascii	"\230\004\020\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375 \352\245\003"
+	.string	"\362\005\024\037\240'\3513\360\325X\317\377\377\213\226\375\267\202\017G{Lr9o3\214\220mB\b\331[\246\023\016\211\201Y\200\224F\032r=\030\271\262_\350\351\031e#\307\225\267/\300.\262\216\354*C\304{\302\025\367"
+	.string	"\246\373}O\254 \256\377\347_\004\r"
+	.string	"O\243\364G\250-\206\253\303\260\254X\001\336\345\252\360J\324P\001\350S\241"
+	.string	"\001+d\r"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.4e61d017b5200d2c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.51.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375 \213\025\004"
+	.string	"D\007R"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\276\317\ryw\250\367\005yu"
+	.string	"\005\001\006'\001\226\001%0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.ascii	"[\205\240r\3773\211\033@\021"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.55.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\364\003\025\016"
+	.string	"\204\023\347\004"
+	.string	""
+	.string	"\001"
+	.ascii	"\005\001\006\035\001\001\005\001?\202\210\200\b\177}\273\001"
+	.ascii	"\005\001\006{\001y\001 \030wu\276\001s\275\001q\274\025\001\033"
+	.ascii	"y\001\037\302\301\032\036\306\305\031\007"
+	.string	"o\311\001\035\314\001s\313\001q\312\030\377o\317y\321\320\027y\030wu\325\324\026\030wu\331\330\025\030wu\335\334\024\030wu\341\340\023\030wu\345\344\022\030wu\351\350\021\030wu\355\354\020\030wu\361\360\017\030wu\365\364\016\030wu\371\370\r\030wu\375\374\f\003o\200\002\f\202\002\201\002\013\013\206\002\205\002\n\n\212\002\211\002\t\t\216\002\215\002\b\221\220\007\007\225\224\006\006\231\230\005\005\235\234\004\004\241\240\003\003\245\244\002\002\251\250\001\254\253\002\340\003m3\255\0024\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\002\227\002\226\002\223\002\222\0025\217\002\214\002\213\002\210\002\207\002\204\002\203\002\377\001\376\001\373\001\372\001\367\001\366\001\363\001\362\001\357\001\356\001\353\001\352\001\347\001\346\001\343\001\342\001\337\001\336\001\333\001\332\001\327\001\326\001\323\001\322\001\316\001\315\001\310\001\307\001\304\001\303\001\300\001\277\001"
+	.ascii	"w\250\201\2706\027\262\354\033`\243Ls\020\030\b\321TF\301\003"
+	.ascii	"5\320\fE\030a\0261\207a\275\201\260s\203\230C\234\013\250N\205"
+	.ascii	"\327s\274\310'\334\212\245\253\326\250p`8\215\207\203e\352X\277"
+	.ascii	"\326\243\204+gv~\025A\345\013\303v~-@\307\027\343\254~)@\307"
+	.ascii	"W\306\354\374*\202\312\027\206\355x\357.4\234\f\255}K\314\035"
+	.ascii	"\004\366\250\236\267.\270t\342F\034.\342\336KZ\030'\342y\260"
+	.ascii	"\352\315\323\253^\251"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.58.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`62\035\217"
+	.string	"\032\345<2I \020[\031\016\277\003yGt\206r_\251\025\304\372\376\242\240\331I\324O\031\217\210\177@\332j\343\321$@\214\221*\004"
+	.string	"\302WH\242a\362O\036\205\335\322n\351q{\244u.)#\254\256.\351\002\311\202\220\275w\222R\006\032\003\307\002\034\003\2751\324^\030\357}\361\336\245\367\272P{[\030{Y\250\275+\336\253\342\275Jjo\n\265\027\305{\223\336{B\3555\241\366\226x/\211\367\216P{E\250\275H\357\r\361\336#\265\027\204\332k\364\336\242\367\022\251\275\037\324\336\241\367zx\257\220\332\333A\355\345\360\336\343{\215j\257\252\366\246\357E\337{\265\267yP\n\263>\005\356\326\365k\021q\275\223\276y\201\233\314\273|\026\310\360\312\037C+R\022\251 \226\325\275M\251[|\023S\263\302\235aX\233/6o^y\206]N\303-\2767-;oO\374z\251\247\257\002\027\371$\022\336\020\350P\f\321P\220\235 CB;\033\352"
+	.ascii	"\251y\373s\367&\b\307\320O\033C\3008o|\362\336\374\366\f\363"
+	.ascii	"\3241\354\323\363\306\307\367\266\267\207\216\237\034\3018\201"
+	.ascii	"\316BC\032\b\r\361\022\333 \276\255\353\252\206\3274a4\373\261"
+	.ascii	"\305&\273B2p\232]\241-\201\321l\332T\024*aW\210\323\246]\345"
+	.ascii	"\362\335\n\355ns\235\307+\260cs\013\235\301u]\2318]\344\361\315"
+	.ascii	"u\353D\213V\254,zn\326uuZ\b\336\2736r(\371L\222\213\326e\236"
+	.ascii	"5!\334\273\\\206\345\224<w\002\033\255\253\026A7\353:\347\264"
+	.ascii	"OGNw\356\270\273\313c\230\214r\327\211\316\255\205\031\267\332"
+	.ascii	"h\331\031\256\353\n\245\202\221TNQ>R9}\013\254\344\275\333\346"
+	.ascii	"\332m\335\322\355\2315\263sA\244\200\374\360\321\203\307\016"
+	.ascii	"\035Q9p\334\260Q\203\006\324\223S\023\323\f\0311`\274Xr\321\202"
+	.ascii	"\305\n\025J)P$\2350Q\202\304\b\021H!\216@\030\025\021}\030\362"
+	.ascii	" \324\201\303\321\250\246\350[\271\374f(\210+\354\212\367\256"
+	.ascii	"\251\002\257\235\nk\274z\353\350\272x\317t\341q\365\232\3319"
+	.ascii	"T\nZ\226\0248H\022\3322\005\347bK)\002I\344\037\211r\020\333"
+	.ascii	"G\217A\314c\320\336a\357\320\361\207\243\376\364=;\007\216@\276"
+	.ascii	"\021\310~~\332F\r@\246\001\b\370\327POv\330\311\216\340^7\325"
+	.ascii	"a\242\3033\3500\2409-#\206\036\303\320c\3026\375\202\315\322"
+	.ascii	"\032v\261\206\017\325t\013\026ixE\032N\224\241U\240Q\222\343"
+	.ascii	"\024rWe\032E\022\031>A\346\311\2306Q\202\311$\230[o=\342\005"
+	.ascii	"\021_\030\351\213\227\013\035\342\250\013\203\350\022\306\245"
+	.ascii	"\215\212\326\230hM\354J\1770\033\262\302\036\254\224Ui\241\026"
+	.ascii	"_\334a\005Z\024\026\230\003\343\001c\301\n\257\200\001\254\254"
+	.ascii	"\217\350\f\263:R\030\017\030\031\212\204\216\241-\277\3328\205"
+	.ascii	"Ut\306 ^\341\2070-\024\351\353\013W\237eu\272\245hF\006\345\006"
+	.ascii	"\303:l\320\274 \330\207O\316\fqp^\2660\032\030\225\016aO\324"
+	.ascii	"\3263v\026\002m\3715\002\225\302GM\230\325\221\362!l\211.\365"
+	.ascii	"e\t\344;\356\2560\254n\243\220u]\267\271\302\242\360\026\300"
+	.ascii	"\273)\332\356\232\260\353\344!\273\032L5sM\251\234r\326\231^"
+	.ascii	"lfqe\322'&\227\020Q0W\rN\324\236\236\357\230\tN\240%\237;&\346"
+	.ascii	"\301\263\332\267\263\ny\021=\017\276\2570\n\327\345\016\263\205"
+	.ascii	"f\240e/.\n\377\321\267_\226\331\362\377\t\265\024\235\364bS\037"
+	.ascii	"&\245\376\326u\335\261K\325\206F\216\353\272Fq\272-\350\004<"
+	.ascii	"\037D\255y9A\345\264O\004\347\317\341\033'\275\270\235\306Gp"
+	.ascii	"w\256:qE\234\301\220B\372\264\35571SQ\353\346u\252M\336\3256"
+	.ascii	"l\007R\361gp\033\320>UB\245\347>\325@\262\024~\266\003\367\231"
+	.ascii	"\336\221%\001\356\023U\324;\301Iu\3176\237}\242\202\364L\350"
+	.ascii	"\331'\372\207\254\004'\325\276m<#\020\355l\363\211hCg\273\016"
+	.ascii	"R\032\266\025\213\336\266\234}\252m\310B8\267\363\366\231.\352"
+	.ascii	"\035\275\331\246a\237i 2\020n\366\2516\365\2148\251\262\331g"
+	.ascii	"*\250\210\223\252\232}\246|\2108\251\312\260\235f\237\351\236"
+	.ascii	"\336\207\273}\246N\262!N\252u\333vBqf\266\317tx+\263-\307\241"
+	.ascii	"\313\230m2G/(o\333L\243`\333\266\233\272\006\206\3550)\232\027"
+	.ascii	"\266\331\320-^\266]x\027\225-\333\\\032\221m\305\242\266\335"
+	.ascii	"\302>\217\314I\225\323m\256uk\217\255\237\306:\275u\275b\263"
+	.ascii	"}6\327*\203S^\276\305@Y\345Zq\205\272\311wEH\322\314\265*\260"
+	.ascii	"~\205\242Ok\306#\354\303\362kY&F\341\251\232\037:;X=hwn\331O"
+	.ascii	"\333et\275\226\335\301g`\237\277=z\360\334\261Sg\216^\236S\256"
+	.ascii	"L\034\2311p\31471nma\330\270\254\251\245e9\303bV"
+	.string	"\205J\331\0241)Q\300\276x\216\231U\200\322\365^\336z/k\251\275\234\365^\306\3423\314\274|/\257\357Ur\0353\n\357m\302M^+\265\227\311{\227\274\227\204\367\216\240\366V\031{\225\034{\223\274\027\311{Exo\b\307\336#\306^\020\216\275\037\274\327\203\367\032yo\007\307^*c/\007\307\336\251\367n\360^\r\336\233\301\261\027\003c\357\005j\257\005\357\255\340\275H\265\227\002\265w\202\367\026y\257\004\357\215@\355\205\300\330\373\200\332\353\300{\033x/\003\357]@\355U\300\330\233\200\332\213\300{\017x\257\001\357-@\355%\300\330;\200\332+\300{\211\274w\310{\003P{\0010\366\nQ{\203\274W\352\275@\336\373C\355\365a\354\355\241\366\362x\357\216\367\352xo\224\332\233\303\330\213C\355\275\361^\033\357\255\361^\032j/\224\261\367I\355uzo\323{\231\336;C\355\225a\f3\334"
+	.string	"-\022\265R\305\355\f(\310Y@\313P2.\255\007\311\273\243\323\002r\326;\377\371q >\376#\f:\206\212\241R\270|\240Qz|\250y\307\204\303\233\223\021c\353G\2040\332\b\027\211\252\200z\265\235\ty\274\013\345B\267\306\266\316\243YG\267\245\343<\347lC\324u\344xT\033\252\205f\241O\306r\240K\034\037j\3261\341\274X\243hf\t\312\213\370\320E\030>\\\344\027\025\303\234\017o\0341\351t\303 4(\277\341D\204R\343\\\347,\210\306k@\235F\333\r\005\025\242A\005z\372\220\235\240C21qnZ\260"
+	.ascii	";\bN\\\301\306\211\213\374\340\037\266s\242\223`\262)P\311T\362"
+	.ascii	"\003v'\302%\330\034f:\3339\3370\343L2>\0030\311v\177\177|\276"
+	.ascii	"\3108\333\001\372\305\370\220]\240C2<\0253\024\366)E9\321U\n"
+	.ascii	".W\213|\337\035.\357+\030\267\223t\332S2\225\352\300p\006.\243"
+	.ascii	"0\232\245\363\235\363\242\213/\265\270\013\245\230\313IrsMO\311"
+	.ascii	"\374\241\034\3638\312\270\347)\341\224r$\250\234\26687\267\224"
+	.ascii	"qr\032\016\207\204e/\013\300\220!*\247,>d\307\347\220,\006\246"
+	.ascii	"\033\024IbO\237\234X{\262\310\267a\263\366~\262\342jf\020\373"
+	.ascii	"\2124\277%\236\263\230\2123\236\367R\351*R\\\251\013/\003\232"
+	.ascii	"\024'j\323s\370\006\fs5Qb\312?l\221H\333Z\344\353\350\322\336"
+	.ascii	"[(n"
+	.ascii	"fn\312Q\264\331\241\323s\236\222t\326\363\326:\361$\023?Q&\t"
+	.ascii	"$\316\304\211\332\354\240\031\321\364#\242\354C^HX\274\026y\346"
+	.ascii	"\033\226\267W\211\273%]\264\225\260\313[\3569\227\2218\357yw"
+	.ascii	"\2158\t\021\037\021&\tD\200\303 \342Dm\316\3037_\332\300B\034"
+	.ascii	"U\371\303"
+	.string	"@P\t[\344\277\270\020\226\324\273\006 \340!/\356\316\362W\213t.U\216$\303\311\206\356\357\\%\304\371\357\375u\364\020 ~\244\300\327\222G\020\037\262c\303,\323%\f\233Q\221\331\223\304\210\244\210-\362Z\262Hy\213\031\375,\271\204\305\310\251f\331\347l\366\025\270\350\334\347\275\002\321\213>\234\310,)e\345\303\211\354\356\016\373|\370\303s6t\366\023e\036\276\312\026\3712\262\257w\331\320\307\222Kbg\037\252[\244\013<\237\255\036\017\347\300\367\024\241{\350p\241\246GIJ\2551\360\260\016'\252[d\276q\262\306|\307\022\\\231;\034\274\352D\241\247u\310r\023V<\220\325\300\307\341iw\302\334ee\221\367\202b\205\303\271\276\305A\017\"\335\363\234\245\007\361\361\374|S1\376\250\336\350t\255\244\324\263\242\324\023\301Ad\276q\342\307\354\342P\321\315\361i\233\207yi\204\007\316\214\ry"
+	.string	"\261z\220qD\263\332K0\004\352\366\231\004\023\244\277Z\243\0275-\352\323\226-P9\353\034\320\365\351\263E\376\312\202\343\272bEm/~\305 \013\302\023\023\020\254\246\222@)\251J\222\244\212\312\204\221&H\246\212\224`D\311q\312\n\211\221\016R%UG\254\250\2244\031"
+	.string	"\304\007G<PR5\304\210\325\324\003H\252\226X)\251\2422Z\252'&VJ\214$\261b\322$\204\016\2464\240Z\002E\345\001\224\222#SI\240\250\2260\201zR\332\252\021\214,\201\262\252\252Z\002%4\347\204\257ey\013\240/\350\0233_\336"
+	.string	"H\316|YC68\357\271\t)r\2463\006\344\200\263\034\267\036D\316q\366\350\330q\2163\206\243\351\354l\326\340\365LC\341\023c\235\361\3660\261\326\031/+\006o\235\343\n\227\030\3129n\214\005\203\235\231\205J\034\345\314\034Kb\261\263\230f\t\236rns\023\301e\3470\315#\256r\006SXte\317\020\237\235\257du\340,g0T\024\215\254v\253w\355\256\325\021\020\240;\207\203N\276\334\316\302+\344\213\213\213c\b\030"
+	.string	"\311G\254\021@n\315\"S+U\344\316k\230\234\0054$g\342\244\266\330\304\354<\022\022\316\316s\232\021NB\325Gp!%K\036\321\224r\307\252sH\307\224\\\250P\361\016\337\034\221!\033\\\005^"
+	.string	"e\360\026\231F\t+s\306K\362/%\230\2465\025R\257/\033<\211\033\"\335\222o \302\227\234\333\204p\021\216<\204\264K\tF\352/\345J\267\276\034\271T\252\005\302\205\n\021\231d5\354\r\002 \244\310\225\234A\342\234\213L\227\251\223\270\263\363\203\247\253\022L\323\337\242\"\\\221\177\320,\364\340EPA6r\017\3164tp#T\357"
+	.string	"Q\t&\310\332\r\203\340\250\036d\213!\007\027*$\374#%(\006\310\001O!\347\007\0319\213D\003\331@\346,g\352\200\224`\234\326\006\377\034\360\251<\301\006~"
+	.string	"\221\033\r\336\3009N\006\327"
+	.string	"\203gp~\001\rT\202\t\362\347G\311\214Z\353\323T\312A\375a\360 \200\350\337\005\027*\f<$\333\033\364\321\203\310\221\366x\214\331[$\252'\317\230\363\236\005\357K.\335!r\013\232{\244N\244\202K\235\351 _\001\005G\242v\222RT\350\036\005'\312\363;|3G\016\226\035:v\\\250/\n\256o\221\250\034=\270s\337\004\317s\302\231\263\343\023\360\321\331\370\016\tn\343\314\027\301%\200\340\021\274\301s3\007\0026\017|\250\311\307\244s\223\003G\323;\370\335`\372-\022M#\003\363\354\347\300\357\232v{\232\356\300\336\362\305\233\030\370\213s\236\005\316\200\002_\200\356\214\231=\n\310%\360\241f\235\303\2718\253\215\032\3539"
+	.string	"\322x\003\\$:\006\356\355\f\210\300\337\222Mb\334jX\217\200[\036\235\362\274\032p\345\231O\0017\200\200\027\200\306\220d\27354\f\f(\324@\300\331\216m\200\0175\363\342\234lPOX\017!\350$Fp\221\250\227.b\316\202\002|K\262iM\311Tj\001\353\0024\341,\261\206\234\363\316~\002\370\020"
+	.string	"\036@\032\252\005\315\202\202\""
+	.ascii	"\350\231\220\0175\333\304ij\223G\355\214I\353F\f(\203\357\250"
+	.ascii	"r\2209\2252\245dDD$IA*i\f\342\r\b1\3100\211\254\016\022\200\002"
+	.ascii	"\031\204\343@)\025\203\"\244)\324h\f\\\037\216'S^\264\263\331"
+	.ascii	"\220\\H\213\361h\b\207xG\030\276\347\022\267K\346\346\321\211"
+	.ascii	"\206R%\277\275I\013'F\227\004\234\221 \360\217\030\2036P\272"
+	.ascii	"\201\023\241\030\302J\033\303\325\3447O\034q\270,"
+	.string	"\230\035\213\213\240\210\226C\212\276/\254\005\254u\311\211\326\"\301\r\343\305\224\203Hz\3773ht?`\211h\250\256\213\2079-<$\252\266\222(U\376tkA\240\237_r*\373\0262G\200\301dL\"\350\001\330\226\205)\323\006\304\270\361\222\353\321\005\365\323/U&=,\"\307\336\231\325v\r(\204e$\235\nP\3678\223q>\342\227\254S\263I\306\367~!b\207\257\333l`;\035\016\203\272\226\205*\270FF+<2\305(\220\366\034\241\034\321\303\274\275OI\002\r\032\301\342\260\226\351'SW^\251\367\266\367\351/V\020&\0041\322\345\204!e\213\221[\003\021\241M\201Ln\247\307\3048\316$\246\305\250\210\013\276\236M\255\267'^\365\322\020j\317$\n F\261\253,\246\3730\240\361\352;\230\200\307\214x\300\334\363Wu#\177\271\224\252\340\213\227\316\310\321\024\221$\307\314\242\b\243\ry"
+	.string	"N8,\314W\371\266z\243\303&\263\261=Yq\313\251\221\277\\JU\360\315KkN\216\352\331\300\005\302\004e\233$\030\302\331\034j4n`\333i.D\373\271C\202[\277\201\332\023\304\253\327\323.\302\324\220}{~"
+	.ascii	"\271\356\260\303\3437\247eS|z\216\032&\334h\343\277kd\365\032"
+	.ascii	"o\244D\233\224\032\344o\336\017A.>l\270\370\326i\331\024O\237"
+	.ascii	"Q\207\334\037\324%\354W\"\334\327\020a\344\2135\2306"
+	.string	"\0355s<\347Z\006-\026)\372Pw\232\314\251\223,\216\205\345E\312\027\261)\034\365\274\277\365\360JJf\n\2166{\031\f\314&\031\317\352\355o \r\3541\230kr$\371\207\352\0024\177<+\230 5\332\342\334\0058\034O\334E\242\356\027(\232=\350\220\332\007\022ON\240Q\004\006\370\221\ffL\375)\303\271\2540R\347q\f\005B<RG\023b\024\270Q\241I\030u\265\347-D\273h&\270\216\224D\272\317\227\216\271\256Z\226HC\220\266h\304\025t\330\021\242tY\227}\232\230\266\013\006\035Kn\354\353\325\250\022\333\254\250\017\r\002\225(\025em\f0(\246\275\325\234F\343\330Xy\334\351\370M\2153\330%\272\332ki\2232`\007\340\371\302\233W\020\302\205\204\322\337 AW\311\362\003M\214\336\005#\262\314\215\272\244\227\240NV\215\365\210\fO\334\302\032&\214\305\031`\214c\243\034"
+	.ascii	"@\217HJ\207\242j?\312\237\352\036\032\352\\"
+	.string	"\\\242\226\337YW,Y\nZ\207\334\371\nJ\2274\2663\312T\210zQ5+4\243\236\327V\214\002Q\277\364J%p&\232\036\205&*\275\264,\244:\351\2058-C-\351RE\226P6\360\214\37259\212\227\263r\345\323\256\242uY\f\356\002F\356\340\302\246T\242_\322\216-\330Lm\341\261t\t:\206\213j$,\006[T\371\342\020\300M$\002\3531\377\361\3344\265\201\216O\bj\330\n\023\007\217#Z@Hk\016\347\212\322\001\223\201s\374\244A\366;\226\205\223\037\243\311_<\r\025\251/G\007\320\b\373\035\303\245]\232\006H\032"
+	.ascii	"\313W^\265M*\363\030\272\334I\261\301H\345\035\343\225O>\032"
+	.ascii	"\333\316g^\2356^\331u\310\bNNKIGs\200\2369\177\214C|\242\320"
+	.ascii	"\030Q\235\025\276\341\250\360\305?\330_h\271\337\247L\004g:\r"
+	.ascii	"\020\332\200A[\335\227\241\275:\355K\341>\204\241\277\271\355"
+	.ascii	"\213\311\277\335\355E\241\036\224\314\241g\214\300\214\245\214"
+	.ascii	"\323I2\0335\207\261\357\034\277\336\016\363\227\221p\031M0\357"
+	.ascii	"\343\271\002\025\353QN\234Jf\306\260*f\177`\320a\327\222\215"
+	.ascii	"\273X\222\334\331\031C/W\326\276Z\rM:>\343.\302\330InR\306\020"
+	.ascii	"\tr\236\013\350\251\264\016^A\234\226\372\344\214c\270\302\355"
+	.ascii	"\226\330\244\231\016\260\314\315oo{\2323\352{\261\321\370\231"
+	.ascii	"6\237\3250_A;\333\032qK3\375A\021\314g^\3636u^&\316b\035g\313"
+	.ascii	"\f4\347\r1\t:`n[ch\274\241\231\354C\177\321^\376\250\360\231"
+	.ascii	"cP\240\246E\370\224s\353\223L\020\200',b\216\027\321\314\246"
+	.ascii	"\351\344\222A\371\004q\237+\206\217\234\246\313\032\276\361\026"
+	.ascii	"\255\002\211\\\364\277\242\217\3608\347Z\"\276\267\346\234<\326"
+	.ascii	"y\321\366\220*\317\274J\3306S3\310\005Y\221\316\340{FrG\267X"
+	.ascii	"\355\275\253p\202-\346W\353\210\237\331)Bo\341\233/\331\364H"
+	.ascii	"\244t\363UUmc\371\214-r\200I\374|\002{J\204A/P\3241\234\234\220"
+	.ascii	"\317\301G\"zx\303\253\377\264J\315\370\277\202z\006\246\353="
+	.ascii	"\305\231\241\005"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.59.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`t'Up"
+	.ascii	"\272\266\350'L \322Z\031\016\027\307z\203\367\270\236\233\365"
+	.ascii	"\325I\337p{~\365F\027\376SEflV\227\222\001\374m(\340\334C\020"
+	.ascii	"\314GL\311\2173\025\2079QU\025\002Qb\234_\203\361\024j\320\223"
+	.ascii	"\212\364?\256\"B\206!{\223-\245L\001\222\002\034\002o\002?S~"
+	.ascii	"\247|F\371\273n<"
+	.string	"\226iH`\252\252X\263\216\312\0031\007(i\314\345\331\231\245\031_\331\036\331_\341\022\277\3021\301\344\272\024\223\023\006\247\020\254\311\f\227I\210uu\226^s\205F\344\n\031\031\206\273\352\232w\206b\350\240\231\303$\344[\306\331[\016\002\376\360'\270\026\006\006\026\272!\\\262\221\263\004T\032\026\372\325)\354\223[\246Q6\227|t\205zs\205yv:\204a\2261sGFo9\006\315\362\216\317n\357\313\202\031\262tgQ\3667\344\347\251\333.#,\3351(\363[\252\252\3123\302\317\263D\251\237\353\347\371\337r7\243\252\370\004\314\313e\353\004R\213\254y\251\261\374o\226\325\302\265p&l\220\252\2720\007\007U\205S\361\251\342\022\017W\374\377\265\262W\270~3'\\[2\025+\363\232+TU\225\212i\211\320%\236;\204.\261\235,\327\276\356t\237\273\334\343\316\345[\016Gc\206\0012b\024"
+	.string	"\203\200\027.\006hQ\305B\200\025TS*\244\242R\240\b"
+	.string	"\200\023P&\236\234\232\230\226J\220PJB:2\032\025\021\215\030\022\n\002\372\361\351\021\301\263\023\242\230\242\304\263\231\353\273\223\354\332\327\321\241\260\237C\001L\030_.\016l\317\005\354\356\213\277\345pkH\226\206\222\032\022\t\231&\31784\300pe\0302\353p\214\002\202X\030A\344\315a\002^\b\256\013A\276\225\007h\361f\253\336l\237\033f!"
+	.string	"\233]\301\006p\rSM\355\255\212=7z,\205&*oS\344\255\340\016\214\""
+	.string	"\274\005"
+	.ascii	"o\007\357\370\204\030(\2735a\267\204a\370\311\351\3136}Y:^\230"
+	.ascii	"\251\313\222\226-\241e\233Y\230\204\322\225M\272\202\264\302"
+	.ascii	"HGT\326H\305k\311FP\212\334\226\310\rl\006\0361\024\303\n\305"
+	.ascii	" \006\003\007\001\265\355O\333X\032\373\240\365\234\255\2103"
+	.ascii	"2\026\230\347Ilw\232\324RXaCl\017JV0\333&\033\224\224q\361L\201"
+	.ascii	"\206F\205\355A\211\362$J\263\366&%[\364L\341\303\0309>I\257\223"
+	.ascii	"H\314\355\213\323\226\301\222G\230\230\344\020M9B\ry\002\235"
+	.ascii	"B4b\272@\tl\303\247\003\030,Udx\262jJ\314v\222FPV\303\244\311"
+	.ascii	"O\025\324\220bFg\221\242>[LAb\347\223D\236<^\b\243\354\334\236"
+	.string	"L\324\220b\314i\rUU\317_\311\024\366\013\354Od\373\037\344w\202 \257\321\305\206\367!\324\373\"6\3339\316Y\316\327\243=%\023\020\347\301\257G\314%\037\360J\354\026\032x^\277\246\201xJn\276\246~\312\244\335B\327\234\331|M\367\224H\177xG\273\205\366\235\325|=R\203g\304\3039\315\327#1\312\"\275\363\336\327\243:<\242\035\316y_\215q\360F0\317x_\215\177\312\2412g3_\215g\360\204r\370j\fT\006\355\026\212\003\320n\241b~v\013\005s\016\363\325(\247\364\361\202\327\263[(\335\271\356\353\321\234\222'\356,\367\325x\210\267\003w\336\362\325XG\031\002\3139\313W\343\033\274b\225\263\225\257F\275\364\355\274\374j\264S\242R\3167|5\322\341\021k8\333\3605%<\335\316P\276\246p\224\035\303Y\206\257\251\032<n;?\371\232\232\331\335B\227\310/\374_\217"
+	.ascii	"\225\252\332\265h+\177\251(\226\310\242\243\332\\Q\265\360\341"
+	.ascii	"\231\271E\017\355\f\202n\257\034V\343\265 _\031\016\002\026\357"
+	.ascii	"\027\026\272\304m\023O\224D\270\271\275F\203\034\233n\023\320"
+	.ascii	"\025\275s\313\312+\204ql\212p\020?\034\222\233\355\337Sm\027"
+	.ascii	"~'lkM\322\316\314\312\310\226\214%\305\302\232\277`\315\337$"
+	.ascii	"\315_\257\224\037B\312\327J\371Y)\037+\345\377H\371 \244\374"
+	.ascii	"\017R\276\217\224\337#\345\363H\371;R\276\007)\337\252\3719R"
+	.ascii	"~\006\315\307 \345_\320\374\nR"
+	.string	">\005\315\227\240\371\020\244\374\007\232\357@\363\033H\371\f4\177\201\346\343h>\002)\377F\363m4\237F\312\237\321|\031)?F\363a4\377E\312w\321\374\026+\267[\265\\vY,\334\356\212\346O5\377D\363\241R\276\211\346?\025\371N\315o*\362\231P\376R\221_\242\371$R\276R\312Oj>R\312?j\2761\345\0335\277(\345\023\241\374\021)\177\250\371B)?\b\345\003\245\374\237\346\373\244\374\036\224/\"\345\3634\177'\345\207H\371\305\224\237\246|4\345\023S\016\373\035\004`\307\340\217\315<\263\243w0\250\f\231\0346\b\302\001\210nI\2437I\243\367\2073'\356\240\244\201\032k\276\333/\241\t\017\b\177l\2730\036\364\022\376X\351/^\272\374\354\331\350\035\263\321\033\207\312\223\323\222\3462\373\245\323dE\347\307\236\223\263\352\245\323\303\345Jj\315\026\270\035\t\3644\321\317\253\263\210"
+	.string	"\240\311\334\0254,J\004z\227\264\224\255j\004z\347\220aj6\266[\026,\234"
+	.ascii	"C\327`\337\022Y\263\335~\233%2\330\346\217m\245J\006\275M\236"
+	.ascii	"\376\271\260\364\362JE\333\033\227\226\245%\3766z\312\r\266\022"
+	.ascii	"\022 k\236*J18z\311\272\340\3505\234BB\251\254Y\312\236\221I"
+	.ascii	"\027 \177l\033j\270\240\031\031\242gh(n\034B\212\262.n\201\336"
+	.ascii	"\262\005\232\273\242 \035\2315\203\331\263\227\221\002\257\037"
+	.ascii	"\033\206'\0244{\025\235\274P$NQ\316!\033\3505k\240\331\310\027"
+	.ascii	"\243.\207i\212\316\232\273\354\031\214\350\001\260\037{M\355"
+	.ascii	"\201f\260\264\205+\023\nt\332Y\247uu\342\034\350=s\2409\t\r#"
+	.ascii	"\206\322\232\335\366,&\304\200\330\217\315\202\031\003\315bI"
+	.ascii	"\3747\340\200\b>&\017\310\356:\332\377\003\255\274BQ0\343 !\350"
+	.ascii	"M\203\2409l\206 \240&\315\201{\036\373\2711\366c/Q\341F\363\030"
+	.ascii	"1\205$\221\271\306I\320\333\244\221lUK\320\234|\343\323fpK\317"
+	.ascii	"Zs\233=\223\211\230A\366c\243\0206\243\231\354l\260+\250\266"
+	.ascii	"\b\372\353\254\373CV\320\273v5\0254/\201\201\247\331v\330\232"
+	.ascii	"\327\354\331\254H\226\326B\210f\343\346\3060\373\261\217\264"
+	.ascii	"\221\030\315f\255\242\221M\244\001\371\220\030\364\2621\341V"
+	.ascii	"5\006\315e\200\273F?+\177E\277e\321;\267A}n\322\f\366\245E\354"
+	.ascii	"\267\347\264\n.\340\375:\261\273N9\202nh\016\324Ew\020\327\206"
+	.ascii	"\323~\344\303\034EU-\342\342\\\207\r5\3709\260\262B\227\350\242"
+	.ascii	"\251\204\321\200\206%\013\221\376/\305A\\A\255QU\225\200_\007"
+	.ascii	"\317\341QTU\325E\023.4\037$\332TU]\031\226\270_@\020q\322\034"
+	.ascii	"\305<\023\007XwH\204\233\217\332\034\275N\372|D\3166\367f\320"
+	.ascii	"\252\316\321|\266g\225\030xx#\243\203\203\344\346\331\311\006"
+	.ascii	"\3571\025\244\207\020+,\252,-,,\255+$\035C~X\211@\314\322\362"
+	.ascii	"!\344*k\b\016!\036>vdi\335\320!\304J\202\037Z@\204di]\005\375"
+	.ascii	"j*\210\220,\035XB\202\f\371\300\003+\016\256\200P]\355\240\312"
+	.ascii	"\362a\205Eu\005$\b"
+	.ascii	"\325\324\322\265B\320\001\204J\210\226\026\020*\0368\"\333.|"
+	.ascii	"\233\f\256\034\265;gJ\317\256\365\322"
+	.string	"\241\003\332&\275\206L\2066\255\267y\244h\317\032M29Z\263F\223\177J[\326\350\030\335\322\2225\272\344\317i\2274JF\007\265c\215\226\235\t`\223\215\232M\211Z\261F\317\350\2466\254\3214&\002,X\243i\177-6I\2435Ly\261^\215F9R\200O\243Q\376\f(j\364\355H\r\244F\337\316\334x\352\242#T\334p@5\321\021*\207\347\324n\034\272t\235\364\326@\270\267\263l\f\210\241y\335u\324\236h\260\277\221g\266n6\2339(\200\003\252\271o\277`\022\b\001\314\217\347\223\266\020z\301\230\210r\276pU\204j\023e\312\374\244v\252\241\246z\273\364\200\300\215\247\3468\373\275;@\353\356\307sMM\253\367\316\251\005\256\2673\r\255\204\247v\342C\002\326\0356\365SS\257\035\034\0335\220\232\201\330/\031\032Yd~<\315V\310\352%\303\244\344z\223Z#u\2221\251\221"
+	.string	"R3\235*,\331\251!\321H\347\327V5\211\3361?\314\020l\263\305\200\242f\301\3752e`1\177<\223J\260z\231%n8Q\340z;\303\316\023\212\272D\225\262;c\027\375\340`\3545\303\027\243"
+	.string	"\237f\275\375\346\301\370\221\367\343\211\344\364\372\321\233\247\324\247\221\263\210O+-\313\302\b\265\217P\257\016h\bx\341\325L\267_>\027 \360\375xv\235*\b\275|I\207\206u\274:\251\214\016\271\323\353\265\323\25377@\213$\315q\373\355\253\372\240\357\307\236S\370Ao\337\221\2348p\216\232-z\223\264\350M\303\205\205"
+	.string	"p\373\005\\\341\003\360\307\376\301\007\037\275\200F\353\225T[\340\033\26062|\321\013\366\242\327O\013\325TX\363\016\373u\243\242\207\233\037\233\315\232\036\275n\210\376\374\324X@\324\303\210:)0z\303`\364\262\321Aj\314\333\226\2501\373\025L\301C\360\307\346\333\343\321+8D\245\321\344\3550\264\"e\364\212\311\350\r\274\202\"\200d33\202\376\250\202\260)\315c\206\224\022\021\021\221$I!\035\342\r\b!\n)X\326\001\022@\342$\305\323L\307\214F\"\225\024\224\241\016\216\214\363$\207\240\363\326\240\252+Z\342B\253\304\255\033-&\200`\211\270\302\302\237>\337E\273+\"\270KX2\261\313\302g\037\247\026I\305D\213\357A\252\302f\242`*\270-?N]\201\f\3450N|\351\267DQq\351\305\204\031\r\r=WX,DsQ\256\356\320R\373 \250\t5\316+#\016\203\321\264j}"
+	.ascii	"I\235u\340\365,\356\261I\341JbP\365\3470\211\235<\267\303\324"
+	.ascii	"\244X\323\332\361]\026[\r2vo-\364\323?}\321\235\320e\374\335"
+	.ascii	"\004\320\357vB\343\350\024\312\347\212\214\002^X\265'!H\277\231"
+	.ascii	"1C\312|\351e\317[\024\0138\2014\037G0\0056Kv\240\336\244f\300"
+	.ascii	"\335\211U\025$(\370\337\271G\032\023\274\365D\372}\343\364\252"
+	.ascii	"\366\253\273\210\317\350\234FC\231\307$\220\230\016\267X]\203"
+	.ascii	"\271\327\013\303\300K@[\317\026\244\311\226\350\"~\f\233\016"
+	.ascii	"\302(c$J=^#;\247\270.)\3754\200\253\314\004\277GAW\213\255&\211"
+	.ascii	"\257\2700,|\017\344e\245@bn#\255\307?\347\252\003*_X%\216P\270"
+	.ascii	"\232e\320\334\251\241\305\235\273W\rU\032N\312\220\311\2556\211"
+	.ascii	"\327+\353|Fx\022\302D\307\"\322>\305;\023\347\263\304G\r\277"
+	.ascii	"\257\013\030T\017\220\204;\337\005\365\260\226\356U\373\375\251"
+	.ascii	"NP\035\0246\220\236\023\362s\223\031T\310\370\275\021\357TJ\325"
+	.ascii	"S\277F\211W\354\321\354\177*~\027\250\362\361\207\346\013\336"
+	.ascii	"\247\332i\305\264_\214\303\202\370\273\2034~-\341\244\fU\263"
+	.ascii	"\325\022\361\"\267<\276]\351\234vY\203\035\020\024\234EC\217"
+	.ascii	"\033\374\266\270\304\005\226\376\033\246\345\355\f\244 \375\261"
+	.ascii	"\372p\271\314\267z\261\n2\3651n\356\023\330\034?\274\364\220"
+	.ascii	"\2200*k&]\302!\333\030\030;\201\224\037#X\037\274\3006\337\276"
+	.ascii	"\220hs~p=ol\251\254\372\214\026\325p\356y\371\3500\037\326\363"
+	.ascii	"\213\247y'q\374T\271\031[\314\357].\270\374L\262\321@\220w\243"
+	.ascii	"\3067\246\334\260\256\031\372\356\001\267m\036\001g9\033"
+	.string	"N\353\366`h\274\323\322;h\253\212$h(\204\221X8\205\366\267\006\032$\3012\273@\243\372\002 9\311!\264\2701DS+\243\241}\035\225f8p\275\222\336U\240bj\343\240\345\345\242\205\021\275\035\325\3768\020\330\035\350\351\374\247\212\334e\037\025\364\f\206)g\341Z\326\316\332\217Q[''g\006e\001\020\r\306>\322\0372\002\266C:]OU\24459MH\003=\235\333\030z\006+\3119\023^3\200\035s\300\215\225&\207\262\244#\202?[4+|\315>X\223>-\354g\216\220\360d\242=\202j\355>\036S\220\001\017\223R\341\332\254d\325m=\236qY\307ls\220\307$\323\317\352\022F\036nb\0212w\276\277n53\273\253\275n\365E\362;J\022\277\3209\265)DI\260=\357\260\207\022\323\355/I\\\342\312>\364\204\035\215V\255\262\312\371d\t\220l@\"\373\346\3677"
+	.string	"\214\346\314\037\032\031\262\003\t"
+	.ascii	"\340$\252`Up\034,>\031|\350\313\244\250\344\334\210\316\237\363"
+	.ascii	"\310\313^\221\021\342\352\265e\013&\032\243\316?4f\364\344\344"
+	.ascii	"!f\202d6\314S\263gK\323#<\367\237&RI\f\363\f\325S\325:.G\f\002"
+	.ascii	"\336[lB\316\022\251\344=6\0325|_\371rVF\361\321\347\327\304*"
+	.ascii	"\215Q\222V/Yb\220g\322\324\264\027\0369T9\210AVt\367\031s\264"
+	.ascii	"<\353=H\252N\270\033\205\364<\r\023\346\214n_J)\340_m\265@{\234"
+	.ascii	"\250\267\200\031\263\312\232\177\211\372\232\264"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.60.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\314\005%$"
+	.string	"\232AD\016E\200\236M:K-\004\t\335\025R\204\355\001C\236-\266mP$\302\221.\001<\325\365\0204\220\307\220\rF\234\240?Z\241\234\225\0229\034\234w\007JDa\351\026\207I\321\017\007^7\353nM\032!D\356\224\002\325"
+	.string	"\300"
+	.string	"\320"
+	.string	"\257T\225F\236\257\264\265Z\211\r^:\303\271\364\304\337\007\324\340\231\223\n\347KSj\337\312\257\3348\230\r\343j\345\372#\246V\242\003+\235/\223^d\276$?d\276\264\355\007\020n\370G"
+	.string	"\007\020O\322\027\033\241\026\266Z\211\274E\362\337\001\354t9\334y3Kr\351\317/\376B\220\311\226\252+\340\001h}\247U$But\310s\007\270zd\035\3677VYdB\350I\026\2711B\207\301p\215\217\217\375"
+	.ascii	"\024+,z;W\217!7\201\274$\031\254\215\331\023\340\212\212,\342"
+	.ascii	"\321\244\352b8(I&\2511\n\377\306J\2134p\244H\237\027Os\\M\321"
+	.ascii	"\025\346\256\202f\321\2222&\347\262\322Zz\243Pk5\255\272\352"
+	.ascii	"q\007\270\355=\266G\330%T>\230\25703\002i\333\227\224-1\333\355"
+	.ascii	"\362\311\370e\b|"
+	.string	"\253~\375yR\267\302\370b\254v\356n\303|y\034;<ce\312\027\333j/\333\032\022\251\025\370\241\325hU]\360R\300R\261+[}\326\246h \233\030\244\333e\177\217\307c\037\357\021\273\244F:Zj#\242s\271\207Jj\241\023\377\240\203\375\002\236\345\336-\265\256\244\316-5n\251\317\245\276\225\324\246I].\365.5-\251o\200\005\036\036;\256\256u\254\225\307\021P5\226d\234\234\313\237\345d]\374!+\214\355a\376\030\227\032Q\276\332:\\\313\305l\235g<\314G|\260j\255\272\031\266\356%\265o\370E\353lg\371\005q~\022\222\330V:\034\r\t\322j\255\0236\374\214\303Yk\215\360&\312\003\202$^>\363\245\271\022\224\200I\321\243\37567\372|/\203\b\021\302|Y\356}\b9R\3012\332!\241:e\346\256\321\232R\345\t\322\243\203v\367c\377\020,bG\030\350c\256"
+	.ascii	"\215\317m\273\3763\203\366h_<i&\004P\020Ml\0304\211(\335\207"
+	.ascii	"\271/F\242D\271@\244\"\033\263\362'L\241Eq1\2338\232\023g\255"
+	.ascii	"S\021|3?\263\344{\2754S\217\276\252g\276\024Z*:\236\f\257\200"
+	.ascii	"\355(]\273\251\005}\225\223\246\026\350\240\245{32\264#\f$E\217"
+	.ascii	".#\345\250F\006\355\027\2528g\212\3721\216\332O1\350\253\276"
+	.ascii	"OCCc\f.0=\031.\226D\314\3509\235>\030\275\036\212\262\311\367"
+	.ascii	"\004\343tzj\212br\222aA\310LJ\276(\247\336"
+	.string	"\213(\237\f\026)\226N0A\361\230T\360\234\232\226^\360\230\240|<%\003~\202\321\203\342E==A\361tD\251\223u\217\004\031\347\3341Jm\320\367r\022\300\216\352\326\276\260[\035\224,\263\"\332\026\"\2322_v\333\345\217\375A\304\260\004\312\021\355\275\276\330\204a\314\243\335m\016\373g\356\256\203\t\360\316\231)\204\t\365\200\321\345vO\346>\031\202\037y\330p\333\225\346Hd6\361:t\220\366dC;GN\332\361d\205Q\301Z\363\334\022-m\243\032\3426\267\005\342\234\347\342\366\250\215\252\312m\215\366\\2\016\325\023so\253\342\254\310\321kc\364\030\317\355\032Zs\317ecxn\250q(\304\020\223\246Fd$H \205I\213\001p\002\221\2613\036\021\220\265DC\025\246\205a\016\f\210\225S\302P\376\276\231\303r\312\024\327\034\316w\362\355\266\027\221\240\035.\243n|@\357\274wO\245"
+	.ascii	"\261r\315\375\235&c\334A.\033\341#\344L\255\036\240P\023\363"
+	.ascii	"\217B\365w\nXAa\361\215\201\352\026\320\037\303l\210\035\272"
+	.ascii	"\323\027sm\017D\304\241\033\276y\325&xd\231\021\354\364r\352"
+	.ascii	"|w\341\016[/\243\025\336r\331\365\362\312\003\260\031\f5\325"
+	.ascii	"\243\330\n\235eE\227\237s\372\242M\210\372\356\365\312\005c\322"
+	.ascii	"\304/*\371\214\003\242\243\320s\020\031\024m\257\255\235\013"
+	.ascii	"a\026\003\004x\275f\263D\023<\362-!\025%\244\030\306\203\201"
+	.ascii	"[\351i\310\270\236\363Q\214\271* \006\016.:\316aGD\201\313\225"
+	.ascii	"*b\205\003C\202\032"
+	.text
+	.section	.gnu.lto_processRcAdjustments.61.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\221\025\315g"
+	.string	"*\255\204&I \214\333\031\003{\227\3150\234\270\267\311\253\027\373\212\327\251\267r1\237\247\376y\312t_\264\275j#\362\207h^\210\357\274\302\246\363\322\340\216\363\302\263q ,\275\217c!u\260\247\267\3114\356\254'\345]de\357\224R\nT\002)\002\\\002\274\fr\006j\235[\246\263r\351\374\263t\366Y:'\201\234\221@\316l\353|\374q6*\235\377\307\331}\234[+i\217\234_\0276\353\377\305\275I\256\212o\233\343\035\225\346\353V\323Io\275n\274\356\273\3560\335v\335_\272\343\272\2734s\037_ !\223\013z\217\373\016U\220\271\325p\257a%\2264zE\362`\321#\034!\017\217\361\214\357\227\030X\322\326\276\222d\270\315\260\362\216\361\214\230a1B\310\325^\272\f\263\222\2054\031V1=T\202\341\026\323c\354\262\372\025{[\272\306\266\347L\206\331\3527\372f"
+	.ascii	"\307\266H\370\276qRM\307]\367\205\361\220rj\204o\003I!\314\312"
+	.ascii	">\036\233K\317\261\222\031\205\226s\273K\006L^qo\230\022\232"
+	.ascii	"\226'\201d\037\231\214#L\270\035\267\001\023W\334\233\004\351"
+	.ascii	"\247\246\007\227\347}\343>\364\221]$\333\231\033\256\265\270"
+	.ascii	"m\355\240\205\336\327\f\260\314\373\306\205`\021\311>r\\\033"
+	.ascii	"\261}L6\021\333Gf\227y\260\343\242\274\026\330\264|\315\345y"
+	.ascii	"\337\027\352\2410\231L'6\2661\2569\351\335\326\340\324\304\264"
+	.ascii	"\244\224\001\303S\022\322\005\013\315#\243\"\242!\241 \346\022"
+	.ascii	"\250U\376\370$\221\354\321\370\356r\317\265\361\311\226>i\030"
+	.ascii	"Wk0\032\303\030W\244\201s'0\335T\327L_|\311\n\330\026W\252\263"
+	.ascii	"z\2067`uF\017k\2648\0060\375dl\343\\\231\366\03301F\022db\342"
+	.ascii	"t\035\324\223J\020\313\322HH\027\027,\264y\263\273\332\372hJ"
+	.ascii	"\036\02572zp3\032\231\340EebnM\204\202I\225\2414).d\206eZ\030"
+	.ascii	"\304|\003\026\245\211/\221.\312\304\320\032\250j\246\233\254"
+	.ascii	"\2001\361\366\r\230\232\221\311\n\330\022W\256\360\323V\300\250"
+	.ascii	"=\246\233\336\200M\335\247\251L\214\254\223F\244\352\236\222"
+	.ascii	"~\003Ff\334\340\346I`[\001\033s\244\t\276*\254\321\003a\nw\226"
+	.ascii	"a_F\243$S\244\312\260\250\037\265\330\324\024\226\211\275\265"
+	.ascii	"\321X\"0l\272\f#bT\2020\030\247\307\264\037\t\363\362\357\272"
+	.ascii	"\306\3016\246\260L,K;\322\305\373\276\354\3220\261\346\r\315"
+	.ascii	"\354l\314\314\206y\310N9\376\271\240\241#7\307\313\365\370\370"
+	.ascii	"|bK\rq|\362}|\276\306\220\217\343\331\277\026\273\372N\343q\251"
+	.ascii	"p\253\261[\305\275\342-u\257\274\317\030\373\310\357\257\351"
+	.ascii	"\361\3317\332}-F=\210>\376\021tJ_T\321\370\207\256\333\220)b"
+	.ascii	"\233\035\303\343\234\324\360\017\333uco\274\361\233rS\320D\253"
+	.ascii	"\035\374\366\332$]6\266\312\227 ysb\307\257o\307W=\022\361k\321"
+	.ascii	"\377\306\357\370.\323QV\226\264I\203\205n\r\352W,=\350\272\251"
+	.ascii	"\230\036\n\006\372\253\230\036&\322\375\345\211\202t\"\224R\204"
+	.ascii	"\315b\247\376\271\344\341\311\322r\262\222\357\353u\202\033\220"
+	.ascii	"\003WK\237\211\362\276\357\324\367\330t\320M\216^\331\332\361"
+	.ascii	"\317\252\357\227\365\021\0246a\214\177\306Vl?\226\234\034/\327"
+	.ascii	"\263\245\343Xi0"
+	.string	"\r<\301\314O\303\206\363\242\027\247\177)\374Z\005\030\334j}d\0313\274\2454\330>\366\367\2306\352\231\006&Z\273\374\312\327\353u\205g$gN`\001oi\216_\212\246Yk:\363\r\007\274\2457>C\024\ra\"!\364\271\230\343\240\376g\314\275t\275^\371\315\230\227\316Y\375\245\031\313i\325:W5^3\220\016\323\374c\351\354\243\355\232\247Z\347\036Rm\355\226\240\371\232#h5\315<~\234w\264\316\017\264\316::\2569\307\322\031Gwi\276\321:\327h\275f\032\215\327\214@\3375\317\350/\315QC\3162\224\3161\226\3160Z\347\003\204\234_\264\316.Z\347\026\255\263\001B\316,Z\347\025\255s\001A\316*\212\234\th\235S,\235Q\0209\237`:\233\020r.\021\344L\"\310yD\353<@\353,@\353\f\265t\026\261t\016\261t\006\261t\376\320:{h\235;\264\316\034Z\347"
+	.ascii	"\202\234\001h\2357\264\316OKg\rKg\247!\347\246\326\231\251u^"
+	.ascii	"j\235\225Z\347\fKg\f?\316IKg\244\245\363\005 g\013@\316\315\326"
+	.ascii	"\371\250u6Z:\027\265\316DK\347\241\326Y\250u\016\022rf\266\036"
+	.ascii	"H \374-\353?<\b%\036>\353\331\333>\274\222\2341\0176\374\340"
+	.ascii	"\376\242\212\320\2462`^\027\376\214\237\350\020\371\232l\021"
+	.ascii	"\035\242\365\b\310#\360G\230g\370\003?\365\314O;O\304\316k\242"
+	.ascii	"\270A;m\210<\027\367\265\303?\240\3439|\007\252`\364\355\351"
+	.ascii	"u<\273\324p\210b\217\347\360\235\327>E\214V\221^5\276\307\263"
+	.ascii	"w\202\256\004\3605\236=z\b\300\007\360\306=\356\t\276F\005\200"
+	.ascii	"\r\237\344\227\305\313\327\"\002\357\263\366\364Iro\327\350\033"
+	.ascii	"\324\302\026\253\341\177\021\217\247m\241\271\224g\342s\205\347"
+	.ascii	"\036o\351s\017\333G\r\337g\320\274\217\253\204\346\237q7\253"
+	.ascii	"G\250v\364f\355\221\213\315\025\247\007\362n\367\274z\t[\335"
+	.ascii	"\345\214\205\323w^G\201Q\361\022\255\311\"kW\243\336P\205MZQ"
+	.ascii	"\013o\202\272D\274\234\004w\002\301\227k\304\b\333\307\246WA"
+	.ascii	"=\223\250\302g<\323K\360\314.\0227\211\267\224\231\242\317\305"
+	.ascii	"\377L\n@\337\274|-^\237\235\210\003\222\277%>v\324\230\r\375"
+	.ascii	"\031\263\205yL\253o\322\025Z\201\234?\343\217|\350\2459 Z\351"
+	.ascii	"\227\276\277\306\240\031^\351;\272\210\3413|/\301\3606\250c\334"
+	.ascii	"\306\210\376N\370\"\004\205\304oI\365\3752N\362\251\353\326`"
+	.ascii	"T1y\234\314\307\340H\233\260o|\322#\311\271\221Ar\021|\374\205"
+	.ascii	"G\3726"
+	.string	"c\341}\270\222\013\315\267p\364\3157\n\036}\023\352\346%\252\b\365k?\"\327X\220\321[\031\026\275\321\267\330\026\n\3000\300\242o>*\0352\221L\217Id\225\333{\266\021}\217'm\177\321*t9\364\316\367=a\376\301\026\212(\354\202\340H\334\020\372Xb\350{\217:\227\250\034\234\022\002\375\031\013\225\311\361\341\261A/\364H\274h\225\371A\356\b.u\311\274\210\033q\251L\334&M\330>2\337\004\232\025\350\227\337\024x\324u\222d\367r\"\356\023\367\314\205\002\205\355#\320\373\334\375\370\366\333L\327\360kC\363\265\330\325\334ck\323\246\261\312\307Bs.7-\251\374\036\243vq\263v\365\026\373\363?\336\367D\253&\364\242Ke\217\342\317\267\341\364\352\006\325Fg\213\262I\305\0039?\033\260\001\f\004\210\210\254 UZ[P\316++\253\253)$\252\255 R\030\034\253\216YUYW\f"
+	.ascii	"\231\322\252\022\222\305\224\322\nB\345\343\350\274\252\322\232"
+	.ascii	"rnE\r\005\241r:\245\200L\265C\250|8i0\205\\9_JK*\306\020\033"
+	.ascii	"TY\0168\245\246\332\037U\0248\257`PiI\331\br\205\245\345\274"
+	.ascii	"\232\022\342)\021YZN*+\255\254\255\n|HM0\205\0055E\001\224\263"
+	.ascii	"J\312\nj\n+\013J\304\022_Y@\205\005\245uu\205\005\245\214\353"
+	.ascii	"j\2467\233\353."
+	.ascii	"R\007O\233\256\207j\3703VJi\222\372\237\363\364\241i0i|/\032"
+	.ascii	"\337\367}\235h\274\324w\232\316!\247\305K\223\214;2>I\221L\002"
+	.ascii	"\217\340c<\347\236^`|\214oA;[-T\330\007gX\b\343\331*\025O\242"
+	.ascii	"\265\253\216\353\244\t8\310\364\263\342\221\032\036\360.>\202"
+	.ascii	"w\273h\365\305\037\020\350\222yR!\2359/\336\353\310\261\266x"
+	.ascii	"\027\257$\030}3\340W|\213G\262\213Za\361\006|\327\371\237K\326"
+	.ascii	"\027\234\364\255\305\201\303\342\033\016\232\226Y\001\277\342"
+	.ascii	"Y\273h\025\372\005|\177-\276q\243\342\273\257\217J\250w\334\356"
+	.ascii	"\204\232(\026a\322\301\022\360L7}i<\374\304\247\260{\222\361"
+	.ascii	"\226\022\360L(>\305\267`\n\316fK\351do\r\212\017\201f\3654;\226"
+	.ascii	"\200\357\353\325R\346\247\031\327{\3425Q\n}jU84y'\036\371\304"
+	.ascii	"\332'\025\241D\031`\333\322\237\261w\265\211W\026\366A9\343\246"
+	.ascii	"q@El\253\272\031W\013k\245\016\346y_\257\006\364\273'\032c\232"
+	.ascii	"\347\032\326\304s@E\354\352\025\2620Jdl\211g\206\365=a\343d\\"
+	.ascii	"2$\227>\2631v%~\b\3650\261\341\342\\\031!\303\2371\211\037\361"
+	.ascii	"Xa\352\034\314\263\357\352\351\306\r\333G\022_\002\355n\211{"
+	.ascii	"\241\033\301\343\007x%\324\332P/\300+\301\211VE<\324\267\237"
+	.ascii	"w\331\352f!\337\241\034\n\"\236]\244\016\206x\036O8\036\267\305"
+	.ascii	"\f\343#\254\302\261a~\006\372\226\347\3377\013U\230[\204s-n}"
+	.ascii	"\312\241\363\024\254\303\3661\304\367\232>\032R\007\335\276\315"
+	.ascii	"\373raxz3\036@\017\022\326\377\034\377\320Q\177\204\243\376\247"
+	.ascii	"t7\271^WH\352\250\307\372\256\353\244\237\237\032\036W\f\201"
+	.ascii	"\244\250q(\344\020d\210fDD$)H\222\306!\005\304 F\245K\017\021"
+	.ascii	"@\255CL\021I\232\0242\354\033"
+	.string	"\263\026\307\230\376y\027~\006\274\003HFP\355T\310\260\305\365=\347\300\031\254\366\212\345`\213c9\227,\205\024*;&}\006o\371\305\007\240\203\344\251\257\376\243\"Y\312a\032\3550s\022\223\205L6f\322\214\027.~\321\323\262\223D\021g\322DW\201/$H\343a\350\367\247H\020\305\356\242\362\230\3157<H\266\337\030\204<\301\013s\313\342\251\364s\311\320\354\\\277\247\245\3023\256\0052\206Jf\001s\006.x\354`\002\212\250Mr\252\013\340\271P\316\325\004\340\335\340\270\360Z\356\027\366\305\237p\372\333\375\222\242\374}\271\321\356'q\227\223\340\365\243\265,U\377\353~\360\211\032Qz\240\210\304\r\371R\260\245p\362HF9g\007\n\224\315\246\307N\2213W\271K-u\241J\227d\267B\310&.)\301\013 u\245w\321\302'7\357)\267\215\315\177\234\261G\032\311\273W\274\032\370\030\222P"
+	.string	"{t=I\272\302H\005\361D\234\036L<q\3070\324\202^w\236\303E\316"
+	.ascii	"\035\336\226T\027\220\360/\3301\201G\252#w\0139|\344d\350\220"
+	.ascii	"\327\255\027%\264F\3222\312`y>A\363\243\261\277\240`_\343|\351"
+	.ascii	"\272K\306\363\022\013\001C\310\253\033\007P\352\300 \241\214"
+	.ascii	"\223\304\n\177\027\2001\374@X\377\312C\334\3475\310a24\b\347"
+	.ascii	"\002\325\025\340\004D=RQ\237\331l\246H]\002\017\017\217\026]"
+	.ascii	"\004\205\330g32\205.\241\361\361\277\205\t\213g\205J>\305o\210"
+	.ascii	"Bi\216\305\3533]!&\003f\360\205\027=\332\325\306e\236\312@\356"
+	.ascii	"\336\343T\bMj\013a\375-\352\264\026s\331ft\0037\242:\031U\312"
+	.ascii	"-\325\027\331v\030\002\177]B\034\254L\336*\207\t\252w0-t\324"
+	.ascii	"`\221\333\030y\217K\217d\020\030!\265\013\243\022\262)\017Q\205"
+	.ascii	"\1778\220{\252\207\226\227\237\276k\250n\351\365\006\334\027"
+	.ascii	"_B}\342\336Q\362\355Q\033\n\024\234f2\361\fy16\240_\342\034\037"
+	.ascii	"\017g\n\346\372\345\215\022\360\211\323<\211\226\342\205+\250"
+	.ascii	"!\220%t\352\2209(\367\234\367\276K\357\001\222&A\022\271S\310"
+	.ascii	"\225\366\257'\314\245*\315\355\217A\r\202\223\024\234\361`\342"
+	.ascii	"\264-\330\034\210\366\244\004\236O\324\030|\340\263}\305Z\025"
+	.ascii	"\020\300/M\210\367\216\322\343\221!d\245\303VVTw_\320X\203\035"
+	.ascii	"E\2354\027\200\b\016QY\024+*\214\363\361\203\276\276\213\030"
+	.ascii	"\2113\217^\261\021em\023\"V\211\352\rFG\326\221f\007%\273\033"
+	.ascii	"D\212\236\005\311sB\2506\355%E\002E^\277\007\303\266\004\300"
+	.ascii	"\370\227\025\207\bY\224\207\373\032\177x\214\314mr\247'\372\243"
+	.ascii	"\324\016\231\240(\033\210r\257jF\210\263\237a\334l7\023\257\371"
+	.ascii	"\201\030W\331\262\031\016\250Y=\266\324\322\257m3\030Y\243\020"
+	.ascii	"\344&|\315Y(c#5P\021\370\250r\244\224\255S\036\t)2P\205\246+"
+	.ascii	"\334\301!C}\274\345\211)>\232\376\203\362M\035\227\006"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.62.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"-\007"
+	.string	"\362\31525Pm\323\001\244\025]\240YT\223fM\r>\bV\336\0265\330bv\307\371\004\341\250\177G\224\332\200\371\366\270\231Ybj-\217q\002\030X\207a{\023\271S\n\226\030\353\342h6\227\325iP\310$\310*\312\205\310a\310l\242\254\254\210\0310\345\240\251\342EQU\264p{i\365\003P\262u\036\225\360\364\334\335\"\223\301\357q\016\273\200v=\237\376\307E\035?t\350\007\354}\036\372\330thCD\274O\027\220\214\272\t\325lN{\232a_Z\375\330z\301\250\330.2\331\265\030\241l\007C6l\337\342\314\0369\007Z\001\216\024\n\220\223\335\215\252\361\354/\363\337\361\200\271i\177\025\204\335\365\233\333\305\255\267M`\373\300v(\b"
+	.ascii	"3\241a\037\250\024\314=\256\211n!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.63.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`G\006%#"
+	.string	"\206?\336H\200ZN:\357\212\316\006>\t\361S\303'\037J\354\325\361@\310t\032\005vUWP\247~.q\276\330\257\003C$\252\311~\352n\3237n\232q\212\331\3346>\264\352\230\356+\352\252y\237\340\307\326\324\032\331D\356$\003\303"
+	.string	"\274"
+	.string	"\322"
+	.string	"7\355\354h\350\213D\t\270n\367E\260c\326\333\275\310!\335-#u\357\231)T\234\b\377\214\021\r\216\371d|0>\222y\267\017\273\030\3721v\362[\274\257\202;\266x\273\367\026\270e!\335m\320}\346m\371\236y[y\2142\2039\362\306\3659\016\205gp\367\336_\333\340"
+	.ascii	"/\221"
+	.string	"\347\263\242\337\235:\323\226]Q\376\327\313\031F\302\f\211R\337\225%\214\222\001\022X\317\234\203\032\305\254\353\b\310(b\335,\207\204T\261\341\020\251J\236\0214?\256v\002>\254\260\252\345\021W\324\322\315\n\253\f\"{eA\f\326>\362\030\216-\304\310(f\275\346\034\334{\271\016\211\3053\357\314l\306\314H\314f/\335\377\"\214\343\roR\304\213\301dI\355\0038\304\236\304\004\216\226{\203\0372s8\022\243\367\224\244`Z`\367\006\023\334\276\214Y\351G\216\272GLZ\346\002\354\336\253`\355lI|\256[\366\260T?\274\345\2070o\337';\321\214\264\344\360j\252&\273\355^\251\356-f$\260\036(\231\214\343\246\301l+\377\330\312>\266r\317Y\231\347\254\3543+\357t\345\236\316\213\234s>v\2761+\363l\345\235\255|\232\225uf\345\234\255l\352*\333\\\345\322\254\334\266r-+\177"
+	.string	"\216\r.\342\323\250\334\373\"\311\346\266\331%<^\344\037{e>\337\354j)n\204\027\030\331\274\356\rd\3164=\032\335\266zX\231\275\316\351\016Wct\310\305D\345\202S\274\356\275\t>\374\r=\006"
+	.ascii	"\"\305\013\314\303\240_|54\f\035\253\017\314\333^_\355\325k\353"
+	.ascii	"M+Ll\327\274\376\027\b\367R\004@\252\013\227]\017\341\020\213"
+	.ascii	"p-E\367\305H\265d\301r\266\331\304\310vL\243\032\334`\246[!\272"
+	.ascii	"\223*w\223PN\240`R0os\272l3\274\022z\256u\rtF\245\005\254I6;"
+	.ascii	"\327\257p*E\377\351J\323)R\314~\332\211\256\214ki\304\330^0m"
+	.ascii	"#\250\222\216\225ma\266\360(\027rJ\3226(Ol\2430\256\035\305\246"
+	.ascii	"j\362\214\004\376eo1\t\263l\2472.\301\252\206}\365\335\315\234"
+	.ascii	"AC\375\260\354\240\025-\305\265\003\374\301\303\222\022S\023"
+	.ascii	"\004\001'\222\220\230\226,\037\t=A1%\211\200z*\001\002\311\210"
+	.ascii	"\303\221\323\357H\351\307\264d$\342w\344\364\364\023\002\342"
+	.ascii	"\246\021IN?\250\246&\247\037\0179\365\246\361\365W\215\371j\233"
+	.ascii	"j`\320\275w\327[\314\313\241\323\351\346R\013\374\246Y\260\023"
+	.ascii	"\363\246\037\367\362\336{O\003\277i\235>\362\026\210\021\r\230"
+	.ascii	"\005M\013X\223uJ\367\323\300\017\307\370tO\377\234B,\236\366"
+	.ascii	"i\256\3028\256\267J\241A\370\\\214\352@w\324\017\321\035\346"
+	.ascii	"mO\237X\276\346\351\013a\354\264\257\233M\030\307k\003\337\351"
+	.ascii	"[\255e\241b\003D\273L\036o\203vY\263+^l\326\234\301+^er:M\224"
+	.ascii	"5K\341\340\320\344\232\244i\214g\377\270\0314\2105K\313\004m"
+	.ascii	"\2501<\244\214T\312\324\210H\0321i:\240\002\031\232#7\021P)5"
+	.ascii	"%$\023\224\026\334\337\032j\031\224*\026{\312\241\273\005CI\267"
+	.ascii	"xy\260V\321\367\201\203\210H,M\367+5\304\227_\031\236\371\016"
+	.ascii	"\223\204\211\"\233\367\036\271Z\\]Nvx1\037\023Y\206\312\356\253"
+	.ascii	"aB\262\366{|\023\024\003q\352 \007\255\276R\373\230\356\344\235"
+	.ascii	"e\\\004\313~\374&\003\343\036\201V\254\264\306\234\304\017GD"
+	.ascii	"ta\025v29\265\354\2542\023H\233\314\r\372\256\277\0055fR6\316"
+	.ascii	"\201$\205l$F\210O\200\255?\221\023Q\027\320\315{\272\264f\360"
+	.ascii	"H\325\310)\250l>S\254m\305\242\335\027\234\303\331\351\016\343"
+	.ascii	"*\"]*>\017\324\375g:\375\227\344-\274\272\260N\213\207\bi\374"
+	.ascii	"\301}\2007\333\262t4\206aJh\032"
+	.text
+	.section	.gnu.lto_lastRcData.0.69.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\b\1773\273\001"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.80.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\023\002%\022"
+	.string	"FavH\340\2626\035be"
+	.string	".\253\017}\374\224\312S\035b\333\n\201\223\340\211h\373n1P\026L\231\304+\r\2416\337\255Pn\242\027;f\2575\b5\031\035C\361\f\203\264\036Z\022\006\"\007\360`\357V\236\240\267\326\366N)["
+	.string	"d"
+	.string	"c"
+	.string	"\364\346\312\334WiJ\355\303x\f\326et\310\006\254\214M\b\241]S\3015\237\266k'7!]\313^\200t\315\376\013\333\253\322,;\310M\234-\331\320|\200\025\355.w\255\2568\353\225f,\377\260\217\270^\255W\222\027\211\323\222g\245\007\273\353\255\304\255\335\366\002\333\242MQ\001#\032\234\210\351\024\255\214\211\342\033\027r\261XA\314\300\324\034\360\341\343AG\321\256\311]\263\271Q\373\276\317{\374\323\246\240\325\201H\237\310\230\333*\375\237\327`\035\210\334Ze\005\033\026\261\335\022\345\232'\360"
+	.string	""
+	.ascii	"sy\217\353+G\316\356\232\250\017[\331&\223+=\317\316\213\353"
+	.ascii	"\316\313\217\320\356B\330\256\231\006\035\311\366>z\227U\\\224"
+	.ascii	"F\261\231\332\262\237\""
+	.string	"\331\027~\246\206v\344\f\251\325^\371\371R\232Ad\204\202V\273\345gh\202\263\273\f\356\022\362J\353\317'\350A\024\363\203F\021\030zD\353\215k\226mUa\237\347\257%jz\363?\t\002\035\0014\273\"\216\210l\n\rG\213\007}he1[\023&N\306p\342\020\246\254x\035KJ7v\021F\360\333\360\215|$KG\301\345\00370L\215\036HJ(\261w\022G\360k\031E2\203J\207\362T\234g\201\003S]\013\347\251D\356d\300\241\206O\305\215a\250\342L\266\351\375\255\307\210\007L\215q\255\365\3066\231\355\3268x\320\037\333\241G&@o\343'\352D@\\\001\036/ \300\002\231\244\325\001\334\202\237\310GH{wD\331\342\016J@\303\3108\254\030\036I\264\\\037\035\215\265\2045Q\030\346u\215\300b\004`b\277C\271\205#\002\276\247@\2736\357\201\001\332\206\273\211\332\215\3661"
+	.ascii	"x;\333\242\177i\016\221\260\006\2540\237\316\354\350\233-\231"
+	.ascii	"m\201\345\274yY\220\274\360;\245\246\237@\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\337\003\325\022"
+	.string	"v\\mI\300XM:`\261\002\004\020\246I<\177\317|*H\261\217!\240$/\256 ts\017"
+	.string	"!\242\022\003\264\330m\327\3368\224(\006o"
+	.string	"Q\024EQ\024\007L\336\3774\0273\310\324w\330\031\225\330\261\305\3525\332\275\211$2\005W"
+	.string	"Y"
+	.string	"^"
+	.ascii	"\3613\n\260-4SC7af\350$\344D\270\217\370\031\204\232\007/\342"
+	.ascii	"\340@b\203_\0068\261\177\246\321O\247\253\364\310\025\206\341"
+	.ascii	"\314\304 ;\fC,\257\331\323-\230<\235\202'\305\004'\022\377K\231"
+	.ascii	"\271#Ck\245:\376\371/\251`\217RJ]\363G\272\377\336\222\274zQ"
+	.ascii	"\243\266\342n]\230\233\0029@\213)N\316\215\002\031%\243\310v"
+	.ascii	"n\037\0267\333\b\274{\346\215\360\314#\355\314\367\2700\377C"
+	.ascii	"g\036\2273\257\2043\277da>\bl^\bSJ\377\360f~\bWh\033\233\370"
+	.ascii	"\233\210\221\030\361\001\310C\214\003\220\b\2323\rE\315M\005"
+	.ascii	"b\3730\337\220\334\232\f\304f\260\362\250G\325\206Q\f\030\227"
+	.ascii	"\211\356\274'\204b7\304\r\252?\265C\375@\026\215SV\230\244Xy"
+	.ascii	"\rsU\026\200"
+	.string	"e\027\026C.\3565\252\262WE\312\214{\335\025\201a\226\247\353t\241\200\340\016\020\007ht\371v\231\310\312\204j\254\202\260?\326\025\223\013g\032\367\023Jg\237\200~\305\250Z\226k\311\226Y\0360\244\245\346\311.\201c\230\215\222\343\223\035d\331\245F#\214\262]\271\226l\227\345\227'%6\226\275\341\200\354\027\002\331\252\034\037)\t\223\022+v\352\362\314\n*W\036[Z\376\222\2324=6\343\370L7B\247U\250a(\020Z%\"\nZP\224\2441\300\002):\316\001\021\240\034\246\304Ti2R\222\016o\026\032\2426?\3461\372\177\002\177Xl4\263\033lx^\271\005Nh\255\345\036\207<\373\2024\222 \220\370E^xcT\362[p\022\254{\214D\331\253\370\304\323^\026O\370\301\327\177\274\324\013\357/\236\345\316\261yn\036\364\251zt\272\032\373\274W\211\233\205\032XTd\026. Q"
+	.string	"\274\255\341KS\3060\233\016\242%4\235.\324W\223(\2572,\"0\204?\337"
+	.ascii	"\367\363R\001\367\245\344\001\374\003"
+	.text
+	.section	.gnu.lto_.refs.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\022\001\245\n"
+	.string	"f\223=9\020\005)\351\354\260\374}=\353?\013\003|zj\266\317j4\361gt\203:\210\365\001/"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300P\200\253#\243\227\035\036\335\211G\324\312\267\210\310<\221;\0051"
+	.string	"0"
+	.string	","
+	.string	"\022\375:\004\300\251\221y\211\301JB>:62.*\\-\212~F\270\317\207\036\035\232Y\213\373U^\375G\372\r}U\177\241\177\320\327z*|\267\360\267\227\203\336\273\367\007\265\251?r\377\272\200;=840,\\\255\t\b"
+	.string	";63\331\n\354\304D\244\317\352\257\372\251S\277\324\017\271\003N7q&F\026\3730\333\357\302\242\305R\342\217\002\363_\360'\001\375 \242g\271_\301gx\271\n\346)\370\250\320'\200\336\364\276"
+	.ascii	"\346\244\227\032K\352\b07\200_z9\351\345\004/\037\275\327\342"
+	.ascii	"\307\370\242\255\303\370\237\370\215\237\261\003\332\371:\312"
+	.ascii	"\347\311\321\362o\0026 P\023\225\302\003\220\021 1\3140\001\034"
+	.ascii	"\343\302`\212)\210\206-\214?\230\207\b\004\343!\023\227\r6\304"
+	.ascii	"q\320`\211\220q\202\205\210\023\314!\".\030\205\300b\3707\311"
+	.ascii	"cKv\214\231\260c\314\244\333\351\306L\3325f\322\2161\223v\214"
+	.ascii	"\331l\302\316X\231\350\254\b\026{\002"
+	.text
+	.section	.gnu.lto_.decls.4e61d017b5200d2c,"e",@progbits
+	.string	"(\265/\375`\357K\245A\001\332\"\252vS\0208\204\3514\006\300\311t\232O\374\203\016\317a\340\311\203y\224\332\237\326\325I\347\247{\341\036~\264r\277\374\b4\270\0247;\035\0311b\263l\356\203\306\3058\220\247f`<E\371\230\240\275"
+	.ascii	"\205c_\312\261\200\016\203\261\236C\r\225Mn)\245L\001t\006\206"
+	.ascii	"\007\212\007Q\254\220\205\351 K\222\371\255\225\253\304^\221"
+	.ascii	"\"#i\213\21091\222\375v\356*\261g\340\214{\037E\210(\211\304"
+	.ascii	"\321\362V\245\260V\253F\271\262\250E\371@e\364\201\272\350\003"
+	.ascii	"!\365\201\304\364\201v\350\337\262\271\275\363\3339\233\306\332"
+	.ascii	"\251^<m\206\260\211\262\270\316\021\020\225\025g\346X|\240\033"
+	.ascii	"\372\277\225c\355l\034;\307\302\251HK\307\272\271=\356\213\320"
+	.ascii	"\206\2061\371\346F2\215\216M\332H\322\325\b\201\216\255\013\241"
+	.ascii	"\310\031\032a{\037\217t\214d\224\212\037|\240(\375\237:\372?"
+	.ascii	"s\364\177\354\364\177\340\350\377\270\321v\r\322-\2332ZX^X\\"
+	.ascii	"\326\242\374\237\244\276\273\032\345\377\300\351\377\300\240"
+	.ascii	"\377\303D\377\007\210\376\317\f\375\037\026\372\203Z\224oW\215"
+	.ascii	"\362\177\266\276\317\032}\0377}\037(\372>E\364}f\350\373L\351"
+	.ascii	"\367\300\321\357Y\243\3373\247\337\343\246\177\254E\371=T\364"
+	.ascii	"{\306\364{|\350\367t\351\367\254\320\347\231\243\317cF\237\247"
+	.ascii	"M\237\347\211\276Z-\312\347A\242\317\323C\237\307\205\276\276"
+	.ascii	"\323\327h\3645\233\276\206\242\257\205\350k\031\372\032J\237"
+	.ascii	"\207F\237\247E\237g\246\037W\213\362yb\372<\036\372<-}\036\224"
+	.ascii	"~\256\323\317_\364\263\025\375\354D?\377\320W\253F\371\331\206"
+	.ascii	"~\236\322/\325\350\227o\372\311Z\224_B\321/\215\372\245\r\375"
+	.ascii	"2\205>\256\323\307p\3728M\333\035\226GE\036\331\036b\242Z\320"
+	.ascii	"\260\370\330L\277`\327\243\374\273z\224\217\203\350\272-X\027"
+	.ascii	"\233\333\234\225\305\267.^`\222\334j\002&\006\021#\f\2710\343"
+	.ascii	"\336G$\333e[X\255\240\247\241\275\301\306\214"
+	.string	"/*\332=\032yS\300\304\222]\226\253\216\271G5\255\"\312\220\337\316\2606,\016\373ek\330\033\326\313\322\250H\333ee\300uY\026\nP\023\023\026\346\3036\007JN\006\374KG\377\326\351\3374\3727\214\376\365\242\177\325t\b\244\266Z\277\265\262W%\344\030\031\263\330b!\335f\3450*:L,\356\251E\371WL\277\255\032e\237Z\224G\250F\371\227\207\376\355\nKu\247\230)ka\261UqT^\021\363\203\316\342_\027\372!\274\351\002&\256\242\3258.\0070A\223\264PUL\035S\343zH`\354L\262\215\027\343\336\373\177\245c\247\254T\275\253v\352\035\373d\267\215\252u\352\034\233\242\"-T\205\363\032\247\332\335\036\367\226\"S\003\227\374\221,T\245\253l\202\356\336P_\214d\312\230aC\003\306\314\2312\306\275\217Huo\306/\177\205\223S\321\202\356\3366\322\210`\241\252\233\212\306"
+	.ascii	"\267\030cv{\037E\210\020!\342H\204\320\013))e\030\340[.\272z"
+	.ascii	"U\243\254!\212\276m\242o\215\350[\036\372\366\206\276\345\322"
+	.ascii	"\037\254\251i\352\227\212\206\002\016(\021\0310X\\\303 \275\256"
+	.ascii	")\312Y\\\307\215\334{\013]\265-)\352X|\273\245o-\312\267,\364"
+	.ascii	"-\224~\231j\224_\347\350'\253Q\256r5\206\212\354\240\316\275"
+	.ascii	"\206\251`^B\035\367q\357\243\220\005b\347,\212\305\257t\372\265"
+	.ascii	"\203|\357\356j\007\371U\214\266\265(\277Z\321C\325(\017\325\242"
+	.ascii	"|\344\245\214\327d\013\030\322\342\277\276U7\0245\344\334Y\374"
+	.ascii	"\277\266U.\265K\335R\221\325\255fy\325R\331\216\217{K\245U\371"
+	.ascii	"\225 \251\343\016\222\347\250\366+\331\223Z\026\364t\334XY\007"
+	.ascii	"\213*.\273\275\217\257c \210P\335\252YE\013z\032\332Qs+\214{"
+	.ascii	"\037\037\302\217\364\352V\255\324\265\013%kK\201a\211\200\230"
+	.ascii	"1,\350\354\366\336G\"D\210\020q\327 \241\253\352\301\217\253"
+	.ascii	"F\371\247\026\345\247\272^\251j\025y\266\212\345\225J"
+	.string	"M;\217\324q\233\355\275\205\252\017.O>,~P;\355\275w=[\346\335\335\335\335\325\263\345\373\364=\240q-\312 \252Q\256R*\f\025\371\241\236\035\004\021~\237\312\204\200\356\210\335\241c\361Q\320>\250-\302\007\240_?\344zW?\344g\320\265\314V(5\312kY=\036\004\021\376#\265\307\366>\3262\2747T\255\034\004\325\312A\311&\004*J\306\377\321\267\372\310j\224\377\352\344\257M\352\330\207Ke\345\265\221{\037\211\204\2160\256rX\374c5\312\272\026\345\377b`\251\262\376s9\333\377-\377\317\260~\313\342\277W\377\261<\303_*\240\354\262+\250nL\334\023w\004W\bE\005W\305\177\203\367\340/\227\374\227\003O\347\375\345\221\337\n\271\373\267.\374W\204\027\374\226\005\277m\301\177]\360[\266\333\202\337\242\370\255\224\211\337\236\370-\362\267g\267\003F.\013~\373\373m\224\273\202{"
+	.string	"\027\300.\212\277\252\271N\277\r\341\277'~\373\344\232\370\353\335o_o\323_\335\376\237\265\251^\376\332\366\366W\270\337b\335\364\216P\374\357\003\320\253\202\277N9\372\253\230+\214\253on\360\277\347\375\375\267\367\337\023\374U\277\367\227\303j\""
+	.string	"w"
+	.string	"&8\362\341/\225~V\247T\375\016\376\322\004\177\r\373\353\211\377s\1775\361W\024\177m\372+\013\376\352\342\257-\350\361\337\266\225\340\277\234\377w\277\225\361\3271\227\004\177\335\340\277#\370\355\326\025\301_\355\3775\027D\b\376\023\340\036~;\343\277 \370\277B\325\027\361\227'\374\226\355\257h\376\332\346\257u\177\245\373\253\233\277\306\375U\314_\325\374\225\315\377\236\277\024\362_\236\377\376\374\327\347\277\372\277\371\277=\377\r\372-Z\007~[\367\337\362\277\367?\320\2377\370o\211\377B\340\277\013\370o\002\376;\342\277\004\370o"
+	.ascii	"\376\313\301\177?\3747\203\377\026\375\227\350\277B\277\215\373"
+	.ascii	"\355\333o\273\374v\313o\253\374\026\355\267f\277=\376v\354\267"
+	.ascii	"L~\273\344\267G~;\344\267=~\273\343\267"
+	.string	"9~\333\365\327$\277\335\372+\357\267Y\277\255\372\017\345\267T\377\261\374?\373\277\302_\307\374v\352\267\373\267J\277\315\300o1\360\333\372\3278\177\205\363\3277\177\r\363W0\177=\373\353\224\277\"\377\n\200\277j\025\376\273\375\037\373\377\200\377o\377}\356\356\356\356\376\322\315?t\347\027AM?\260w\334)\252\214\355\275\253\033}\344\nT\027\210]\306\355-\365\365$\201/-\251\257\030Tf_ZDTf_\373Ij\310\023Q\326\376z\2422\333\233HJ\352\311\004/-*3\250MDe\266\265\366\224\030\255\272\217_O[\312k\023m\251\r\265\315\274\264@PI}iQ\231Ai\021Q\231}im\263\257=\264\245\240\262VH\355,\242m\366E\267\315\274\264\206\250\314\274\264\250\314\276\314T\254\252\035j0\250\214\t\341\252E\250\244v\213+\032PYCqTG\257]f\357\212L\261\263v\334\336"
+	.ascii	"\330\233\206WV\031\250\030U-*\256E\024\025(\257z\334{w\270\212"
+	.ascii	"\002\363\332RqOu\307Q!\361\332\033I\324\322\276\332{o\004<\035"
+	.ascii	"\343\266\217\032\367\224\203\306\266J\2617\006\373\270\367\325"
+	.ascii	"\336Ou\307\355\275\237\366\336\274,\032\307\275g\fQ"
+	.ascii	"\031\257\256\366\346:\272\3324\236\260\244\330\333\"\317\250"
+	.ascii	"iQ\231\201y!a\201\301\314\270U\034\237*\225\225\3276\3562_Y\332"
+	.ascii	"\354\t\312\266\332{\327:m\324r\321\306\342r\353\276\200c\t\031"
+	.ascii	"\213\177dD\377\345UE\226We\026\017\325\336.\n\360B\356K\213\335"
+	.ascii	"\316\312\362\340/\261^f\375\366X\266\270`~\322\212\3000fqM\203"
+	.ascii	"\364\022\313\001@r0\2618\037=\351\277\264*\253\354\252\\\225"
+	.ascii	")Y\240\331\001\302\306\342s\370\242}\354\034\271lX\\R\225*z`"
+	.ascii	"DEm\213\317\301\212\376\313\024\345T\216\333bbUB\275\234\372"
+	.ascii	"\313\250R\252\207K\f\210\225\3055Y\215\262\006\265(\343/H/\241"
+	.ascii	"\364\335]\026\037\026\377\345S\271\317\270<Y|'\364e\316J\314"
+	.ascii	"\342s\030\323\027!\rvs\217F]\025%$\204\213%\310\231\261\344\030"
+	.ascii	"\0342c\022\313\301f\234$\351\3409\270\016\266\303q\360\035l\247"
+	.ascii	"\"\261\034\374\346\026\313*\271\305h\304\260\234j\366\004\007"
+	.ascii	".l\357\343\255\0027ef\b\237C\020}\0163\352\2160\312\350`X|\016"
+	.ascii	"U\372?\246\303\311\212\304m\360\232\3270\025\314\221\215\033"
+	.ascii	"n\203\3254`+\316Z\031%\314\305]\306\337`F\177\203\233\376\006"
+	.ascii	"5\375\rh\372\033\220\350o\310\241\277\301\205\376q\031\f\306"
+	.ascii	"'k\305\235%\026?\204\267*loi\\\266\264\265\031\301t\271\222\004"
+	.ascii	"\203\255\340,5\216\013#\371\222t\303a0\034\036\203c\300sX\016"
+	.ascii	"\213\301q\230LEb0\330\313\361\227J\346\325Va0X\313ES\306\006"
+	.ascii	"\316u{!\312\235\006\034T\213\362\215\322\350\033y\3217B\3237"
+	.ascii	"z\242oDD\337H\206\276Q\225\276\0067\372\032\346p\226\037W\251"
+	.ascii	"I\274\226\251\244\276\220X\214\3250\226\3435|\005\257!\300ko"
+	.ascii	"(\274&Tgo(\241Z9\250\225\003\314\004\214\bZ\306\327\020\247\257"
+	.ascii	"AMg*j\240\204Y\"e\361\217\323\312\242\332\304\361\262\030GY\241"
+	.ascii	"1V\270-/8j\305\032\03455\247\302e\301\031q\024\325\f*i,\254\217"
+	.ascii	"\032\307\345\20005IL\206\247` \370\210\245`$\216\202\207`4\034"
+	.ascii	"\004\023\301L0\f\330\t>\303F\f\005\027\301O0\022\334\004\207"
+	.ascii	"a3\234\004\037\301F\260\030\036\303J\260\020\274\244\"q\031\356"
+	.ascii	"q\354\003\377\030{\301\rG\251\260K\203\321\226\304QRt\264\276"
+	.ascii	"\030q<\251p\\\025\315\212\321\f\026\222\027\276\2014\312\250"
+	.ascii	"\202\313p\016\314#\350\356\235c\314\370E\206\324\225\026\003"
+	.ascii	"\211\006\032R\r|\343,\371\242K\222\314\305[\0133\311*0'8\n\227"
+	.ascii	"\341+\034\205\313p\n\036\221-9;\273\275\217u\214\234\0241$\200"
+	.ascii	"m\\5\312\006(\242\177\274\343\230\307+\032\n8\360\216\334\265"
+	.ascii	"hc1\326\201t\274C\203*lX,\346\325\242|\r@\3645\310\320\327\240"
+	.ascii	"B\277\250\216~\321\233\30660\214/:\206X\374\242,\372EL\364\213"
+	.ascii	"z\350\027Y\351g\270\323\317\340F?C\031\375\fb\3643t\321\317\240"
+	.ascii	"\246\237\341\250\237\241\207~\206,}\";\372DI}\".\372Di\372DO"
+	.ascii	"\364\211\210\350\023\311\320'\272\322\037\242\243?\024F\177\250"
+	.ascii	"L\177\350\207\376\320\226\276\320\033\r\002C\341\247z\364\022"
+	.ascii	"\2633\347\370\351\277tn\035\274\353\324\232\2539\026_;\367NE"
+	.ascii	"v\270wmzDiY|!5\332\005{\327\016\271\336\335\325\016\331zU\243"
+	.ascii	",\200Z\224\257\034\244\3379AZbR\320,&\262\353\260\004\313\215"
+	.ascii	"\035q\344\340\274\371I\303\346\343\206\305V\216h0\312\272,~M"
+	.ascii	"\263/\356\\\220\324\320\226\002\243a\274t\267\314M\336\243\221"
+	.ascii	"\227\026\245Fr\357}\351\252\331%s\241di+Q\272\352\256\233\333"
+	.ascii	"\246\"/\335\245rm\324\231\202\322\230M\007\275\026Uu\306\342"
+	.ascii	"\013y\321fZ\030\323\3345\025y\325\3343\365\270\325\\4X\311\275"
+	.ascii	"\217\":\210\250uI\354\332d|!*\372Bb\372BH\364\205\210\204\271"
+	.ascii	"cp\2200`\344\314\2701\034\357\244\250a\361\205Vh91a\312(nL\240"
+	.ascii	"\354\rs\\\346\005t\241`|\271\022\007\206\007\016\025,+,\206\263"
+	.ascii	"nH#U,~P\034}\335.\333\355r\241d\351)Q\332\334n\332U\033!E\026"
+	.ascii	"\017\226\334\225\344u\273X\366\023\035\002\304\302\300\201\263"
+	.ascii	"\373r\275\334\267\212\274nw\3557\313\325\362#\021\"D\034\331"
+	.ascii	"\026f\344\2364\276[.\227\212\fq\333\216B<c\352j -~\220\025\375"
+	.ascii	"\032\"\013\205\310\0172\323\365X\215\362Q-\312\0172\242\037\364"
+	.ascii	"\245\377\253v%H\f[\226\032\213\255\0341\232\224\0264\026?\bK"
+	.ascii	"\377\257\310[\345R\371\377z\334G?p\222S\214X|\240:\372@o\364"
+	.ascii	"\177\321:\320RY\322\306\316\220XK\025\223\031\026\377\027y\225"
+	.ascii	"\330:\034DRXl\205\313\212dZ\032\rc\362\314\206\261\210\02316"
+	.ascii	"\267\273\344}\272\222,\233\023\302d\214\r\311Y\021#iF94.\320"
+	.ascii	"j\\\231\0011\276\3351\036\2217\216R~\030\255\260U]\0317\310-"
+	.ascii	"r\215\367\310\335\2721\356\220Kv\301\356\223\213u\215\334\025"
+	.ascii	"W\305=^\027\367\3065\273Y\027\311\365q\241\\\034\267\311\r\273"
+	.ascii	"6.\217+v\245\334\261\013\303\325\2720.\325\235q\177\\!w\307\365"
+	.ascii	"\272Kn\327\235r[\334(\227\311\275\272_7\311\345\272:.\221\333"
+	.ascii	"\343:\2719n\215K\343Z\335\024\027\310}\341\276\270U\267\354\262"
+	.ascii	"\250\310\253\344F\375J\335\25168:\306\"O\210$s\b\271b,\262\344"
+	.ascii	"\2111\t\244K\216 smma\300\326\3440R\261\262\326\"is\374p\033"
+	.ascii	"C\363\305\n\026\254#\224!I1j\214\307)=\222\326J\226\253d[\234"
+	.ascii	"\034\233\030~;7\346\214-r\004\255\355K\235c\224 \326\212\026"
+	.ascii	"+\243u1\306\344\b\203\017\343\034\03103se\312X\331\302\202M\215"
+	.ascii	"+\207\016\353c\352-i"
+	.string	"\333\300\310\315\001C\244J\262\312\f{\327%y\225X5\366\316=\252Y \352-\331d\256\211\3151\304J\362h\251Lu\031m\021K&%\314^%A\266u\241j\363b\307*\371\355\2345\003\306\270\353\230 \250\241-\025\325f\274P\001PyMN>\263\3711\263\021\252#T+\007\366\b\025\027w2\03129\315\007bZp\340\312<\247\311hr\224\361\022C\223\317l\231\342\345\345\356\n\024\217\033\026\233\301o\354\264\314\001I;\362\204E\221C'L\230\034\003\021\036\227\025\0205\271\347\030\352\232\225:\343:\2638\213\341\221\233q\206\214\305\177s\273\300a\325\231c\3619\370\241\217\032\270\226\264\2608(+\t\242\002\013\\\336\3413\344\2706\365\245\013>\223\321\003,{)g\304Qu\211\263\3708\266\367Q\350\007\013\013\210\227\233\013\036o>^t\301a\3476\267\"g\311\222\271<\003\324\336Q{\333"
+	.ascii	"\322\223\264\372Af\267\271^\b\361\347-\317\\\330R\244q#\306\342"
+	.ascii	"\314v6:gOb\2608k9\033\357\r\016\354\006\007S\372\317k%ZO[\020"
+	.ascii	"\036-,>>\233\035\263\332\035S\217\233\313\353\211n\001t\254x"
+	.ascii	"\214\331m*\256\020>P\252\240\204I{V{\276\002\202\bW\243\303\224"
+	.ascii	"\214\201\2628[y\020\327\227\265\244\305\317Tr\225\237\247\347"
+	.ascii	"\210\016\263%\026\037\304\030\375\003\374\347\321e0\264\264,"
+	.ascii	"\316h\026\211\032+:"
+	.ascii	"\213\363\331\331~\270\310\330\361@\376\347\271p`rQ\026g)\031"
+	.ascii	"\206\212\374[\236\362\243P\320\232\212\2637\213\017\002\214~"
+	.ascii	"\375[~A\375[\316e\317Q~\036\2365\033:\276,>\b.\372\317P~\036"
+	.ascii	"\036\332\230.\343\232>\210\264&M2\331\221\327\023]\001\262\254"
+	.ascii	"\300\324\354x\314qr\206,;\221#\303\313\216\315c?\035S\264X|\020"
+	.ascii	"<\364Ax\205=,\213\325\262\215\005\202#J\310\302\260\234$WmbE"
+	.ascii	"\216\200YY|\020VFcV\242\001\313W\2345\034\207EX2\311\263\222"
+	.ascii	"Z\026\264\346\2058\\\026g$\025-\217\r\211a\311\021!\254\335&"
+	.ascii	"\206|$\033\001\222\304\350U\307s\307\216\215\025\026\027\301"
+	.ascii	"kJ\260.8\333\342op\247G\217<\344\r\22434\260\024;mPB\236\207"
+	.ascii	"\360\byc\367#\210\017\334\214\2552A\200\224e^\264\030\342#\377"
+	.ascii	"8A\215\023.\026\177\003:\235}\334\250\353&\244\255\316\342o "
+	.ascii	"\247CG\336q\344\365D'\200\"el\340<\2712\306+\357\3601\243\025"
+	.ascii	"\346\004\n\030X\306Q\3134\260\023c\354JY\0265\213\277A\217\033"
+	.ascii	"72\216Z\266\261\026\340b\216Z\230\020\216\235E\216\3273\216&"
+	.ascii	"k\307\030v5j\224]\216\274.\232(q\266\302\366\346\n\241W\254\231"
+	.ascii	"\301b\3615P\313/\376\"w\325\262\215u$f\f\341\003\243\016\223"
+	.ascii	"/y\306s\327\226\343\376aq\226Q\256\370\317\363#"
+	.string	"\226\365\002\315\342\277\311\\Bw\262\340\020\313\\9F\320\026\033c\272\344\030\031F\007\254\246\013\307\023\213\257A\023}\r~\350?\273@f\027\267\313\0056\224V\b.Qm\214\330\355\2546\017.\035\267\035Z,\376\0079\372\317ZY\253D\273\300\320\336`Xj;\213\313\203\036 \\\2400\261\370\037\340\304\274dS&K\272\212,\305d\254K\305\265\267\024\300&\013\r\017\200\246\244\201\262eqn\301\253\222\221\206\264\370\037\260\350\327\2616\245\0334\3117e\235\207(\252\013\214\235I\332\225sj\\\017\t(\001S'K\3258\256\241-e\205M\222\252\204S\326\005=\021\355\235\303\214\221E\276\312VyEV\221\253*2S\225t^&K\272LU\306)\223\334\3738\346\r\221\270 \334\346j<DQ]\200LM2K\225vrT\215\343:\356-\237*rh\346\330\345\251\234\242\"\263\324\217\216{#;"
+	.ascii	"\3211cG\226\361\237\2432\224\032\213.\025\026\347\247j\366V\225"
+	.ascii	"\303\342\177(\242\377\362\256\"\363Va\304\316\020\213\313;W\263"
+	.ascii	"\342\211E\325\207!\372\037z\350\177\350\322\245\034=\227\254"
+	.ascii	"\001g\361?\274\320\377\240\245\377\301J\377\203\224\276\207;"
+	.ascii	"\375\227n\312:377puV\356\213U\224\305\367@G\333c5\312!jQ.\321"
+	.ascii	"\224j\3125?\217\020\023\265\035i\026\337C\235~\231\346?\317\006"
+	.ascii	"~\200I\263\030\327\263\345\322\314\3133?\217}#b\274\262\370\036"
+	.ascii	"\326\350\227d\3122?OP\231!gP,\276\2071\372\345\230\264;72,.\347"
+	.ascii	"t\n\017m\035\364\324\260r\243K\356\345\334_\306P\315\3405\027"
+	.ascii	"\356\354\304\261\030\250\026\345\252\005\351\245\234\017\334"
+	.ascii	"\226\344\023\213\357\201L\277\204\253e\034\262\214+\341\352q"
+	.ascii	"?e\"u\330\b\022\271/\026\337C\016]\302Y\0174:\370a\203##\312"
+	.ascii	"\227\227p?\326a\253*\032\n8\004\345\030\303"
+	.string	"&g1\256\202\364\362\213u\262\203\352\207\305ooe\227\272\367\336\\\016\020ca\334\\\\!\360\216)Z\350,\276\207)\335\326Vv\271\033[\213\201\374\233\227]\304 \031\202f\3613`s\245\"\313+\345\026\036\252\275_\020\300\223\250\027<\270oJ/pK\346dy\311\366\227j%\226R\213\325X)\322l\334\244\224\265(\213\3135\244\227Y\200\332x$-\336\240\026\345\243]\215\362\335[\364\253X-\251\224ae\225rJo,{C\205e:.2H\323\317\200L\377%\f\025Y\302P\242]\340\270\237z\330d\341\362\240\034\223\246M\033\264\277\234R\"\3133#qZ,\202\262H\201\"g1\217\261\032\345\n\243\026\345g\200C\377e\331+\262,+\315j\331~\362Q\003\305\006\316\227\271\263%\026\227Q\262\017.T^,~\006[\372\030\334\321\177I\366\212,\311\312\243-\333O=l\304\310\331\201"
+	.string	"5\325eq\371D/Y\003\223b\3611\250\323\307@N\377\345XE\226c\370\311\226\355'\021\344\224\220\205\355\315\345\001\220\2225\031_\026\037\003\244~\031VK&\310\222IE;\332Om@8\211:zp\f\220\350\327\212\226\223$)\227\324\275\341d.Y\270B\350\255\255\0317\224\274\\\262\246T1F\345H\371U\322\365\250\312\262\370\030\3340\336X\036\001\261\367N\261Qx\035\201K\032yy\244\242\t\215\241\311\242\305\342\262\b\017\310\231\021+\026\377M\t\006'\315\025\213\217\301\212\037?\312!u.\312!<\\.\220\360\260\270\fR\345\274\300\311aq\t\344\222\301rrpP\241\323\177\331\003Y\366\270\310\243\262\275%$\304\b\0338v{\267yp\241j"
+	.string	"9\263\370\035\300\350\277\334\361\212,w\224.Bxm\027\002\020\333b\302\354\366\346\362\200\207K\312\316\230\305\357p\246k\324(s\324\275\221d\324\201\275\314\301\006t\224b&\215\305\345\215\362\353?\217O\322F\217\362\253\304AC\210\212\024V\205\317\224T\335\030\213K\257\n\247\207\f\b\221\"\026\2276*\332\177\236\236+7v\022\213\377\346l\377y\360\013,M\276X\374\016I4\214\262\013F9#\357]\217^XY\345\013\345\213\2271^\306(g\324\235\265\367\021\256\254\020\177)\343\345\214\257\371\331\036x[\222M\246X\\r]2\377y\200\334H\301\202a\361\337\324\265\377<\331\f\022\034*,~\207-\375\2432\372\257\267\177\336PY{\357\255\362\270\263\242~\362__\313ZC\374@\365V"
+	.string	"\374\3077J\300$\341\260\204 \264\251\250\030\004\246M \204@d\362\225_\032Q\\JM&\022\302!\023\323\320W\024\016}<_\032\241$\004\242i\221\304\371k\n\372\204@\022h\261\211\304\206`\260I(\034\nyi\357t\001X\314'\206\350R:\024\362\222\3143\210\323\263\310t2\345/\2158\231\200)\211\"z\232"
+	.string	"\242?\f\322^\021\205\223\t\230\352\"0\030\0042\345\240)T\002\252\240$\004\232"
+	.ascii	"\236\2763\205\342\tNh\321Y\004\002\245@\341\t? \021\250\204\364"
+	.ascii	"T\342\240\204SIh.\371\216\2764\202\304\020H<\317\t0\241\350I"
+	.ascii	"<O\0268|i\204\017\355\371\222H\370\2226(\t\201%|)\244@!p\250"
+	.ascii	"I\303\322\b\r\254p\202\n$\322S\t5S\020-\370\206\301\022NtX\202"
+	.ascii	"\020\n\342\260\004\f\322/\215P\"\222P\"\236\3053\005%\242\217"
+	.ascii	"0\311\226\305\236\022\361'\355\t\225\210\245P\211xO\027\200E"
+	.ascii	"\\,\236\350\357g\362P\020\207>\214\246\304\373;\205J\300\240"
+	.ascii	"\311\373\235\305&|\026yG{J\304\021@(\320\264\bT:S\350@4Q8\177"
+	.ascii	"C\024\206+\f\201\277&\022~@b\207\377\277\266\362\314\037\261"
+	.ascii	"i\203Q1\330d&\235\277\243\236\017F\244\220\026\315\340\017\n"
+	.ascii	"\023EI(zH\213R'\324LM\023|hn\241h\242PT\364\245P,\236\276!J\324"
+	.ascii	"\220\372\316\340\251\302\231"
+	.string	"6\005\207E\026H\340P\"\025\236(\332\344#R\301\210x\246*\240\b\022\211f\021"
+	.string	">\030\221\242&q\304\tJC\r\024\340> z\nO%}\004$\340"
+	.string	"\t\030\301\211\367\021\030\360\001\003>\310\037\201\001HH\fH"
+	.ascii	"\222~\002\220nz_\261\002A\351\0314}*\244_\032Q<\177C\246\016"
+	.ascii	"\3043U\341'<y\305\336\251$4S\b\"\236\251\n)j\246E\236SIh\242"
+	.ascii	"\245S\223i$\204\236\251\360,\341K#\224\200I\034\230\316\264\210"
+	.ascii	"\242\030$\224\302i\002\230\372L\242\3637d\352)\372\200i\021\230"
+	.ascii	"\232i\261\327B\321L\205T(\016K$\340LM\324\250\005\3370\350k\""
+	.ascii	"\372\200N&\340\n\247\317D-\240$\0042\241$\b9\200\236'\206"
+	.string	"\304\r\350\031l\372\235K\276b\020j.\3710z\002\223\200\251\360\374\235\360C\315!\013B_\032\341\204\222P\"\0269\241=D\223\311\207\226\350\371\003\232\030\242\304\337\351\204\006M z\026\211\234\316 \261\311\204\244\240\271\324s\376\200(z\232\030\366\204@\020i\217\247d\2560\004\366\224\232\202\304#\242\364,\236\3500m2{?!\220\205^j\026{LMh\332\302I,f\360s\006M_O\212\236&\204@\037\372\0032\225B \223n\301w.\371\234L&-T\f\232&\202C\"z\246\302\023|(\207\342y\242J\247\tLf\t&\210I\031N\230\"\360\001S\223\351\024\002}?\251i\002\230\372H8\177C\024P\240y$\004\372\316bS\317\311d\3529\241>\276\236S\223\331s2\231\204\212'\223\211&\365|h\321(=\213II\303\036\260XD}N\"\212\224\250\203\006i\023Q\b\344p\232"
+	.string	"\246\246\t z\376z>\324\003/\355\231\251iBqXb\311\227\002O\024\205\232\210gZ\304fj\376\360\331\323p\366\316\337\020\205\241\364Ki\017\204\020HH\233\206'\0230\345)\366\316\324LU r:\177\302\023\202\247Ph.\225\340\324d\n\245\276\\,\361\003\022\177\\X\352\2350Q\004\271\260\324\033rai\311\227\016\205\031\322/\215\370\001\211$\216| \260\305^\322\017H\314%\352\t\325\204Z\201\372\003\022/z\246A`R\tb\323O\b\004\001\007\037\246&\025~@b\220\020\210BJ\302\017H\034:\203JB\022\202\247\2113(4$:Q\200\207(\365\235IIE\347o\310\324K\321\223\350t\366\322 0\355\t\207."
+	.string	"\321\341\322\321\371\033\242\200\"\005\2320Q\013"
+	.string	"S\241)\264\302\n\033\204@\323\002\35005\321SC\361\007$\366~'z.\245\346\231\024\204\302\364\235\277\036\220\227.)\001\317\023=T\367\2340E"
+	.ascii	"$t\302\024AZ\034\016'\220\341\374\r\231\320\323g\242\2753I\b"
+	.ascii	"\224\302\t\023\005Q\360\364\371H8S\023\r\372)\r\375\202\303\245"
+	.ascii	"\342\211.\245\275\364,\036\235L\300\264\007\205\031<\177>\032"
+	.ascii	"\212\212\302\223\3104,\341\007,\221\232,\230(\372\241\346\tt"
+	.ascii	"X\201\337y&\031\2258\301\204\242\022'\210@8\004\246\300\242\320"
+	.ascii	"DW0!\025\002\207%\322\263\270\341\204\211\242'\224\002\231\200"
+	.ascii	"\032\350qa\251\007B\261h\022O\f\203DJB\340R:\0342\025\177\275"
+	.ascii	"\0245\231\212F(\320\323\304\320w\242\275\245\242\211\372\202"
+	.ascii	"\202\322\342p\310\202\221p\bL\315t8\224\2244L\233|=&\364"
+	.string	"L\201>JB\363\250\bt2{JM,\234?\016B\240\251DTd\352\2650\034\006{\350)\004\232h\332\033\242>\263\203\020h*\r\021\241C\024={\275\"\013&\207\336Yl\312\340d\006O\264w\302D\321\373\235\251\211*\235\251\020\250!m\"\246M\303\036:L\207L\031r*l\032\372z\301\340\351\353\r\323&\223\303\227Fl04\004\362N\037\320\304\371\313>\237\331\373\241C\337\211\366\234\277!\023\026\016\201\305\342\211\022\231\206>\037\236\t\340\257Gl\032\242JA?\363\\2{g\321D\317\336R\321\f&\021\245_\032q\006\201IC\224\330;S\023%\341K\022@*<}\350I\334P\354)\001\223\204\303\022\316\324L!8DS\341\320W4\302\017\210\002\272\224\362F\030\022\235(\200.\245\272\247x\246f\n>\2247$:Q\300\207\346\342\231\232hY\342\004\023\320\245\025\204(~\274\264\227"
+	.ascii	"\244T\bl\322\251\0208$\266`\236(\013=\223\230\006\235D\024i/"
+	.ascii	"\0052\001\203\2753\230\246Ct)-\372\322\210b\322\371\373\005O"
+	.ascii	"`R\317i\310B\013>3\310B\001>$\236(\211t8DI\370\024{$\b\201\275"
+	.ascii	"Tx\232\240\200\322P\003\351\222\0220\230\024\200\264\007B\b\251"
+	.ascii	"\020\310;q\n\365\331\0244?\220\232\303`\005N\234B\240\2647B*"
+	.ascii	"\0046\361\216\204T\002\b\017l\300\002\3327\242\330\363\241$|"
+	.ascii	"I$\204@\223\211\204\017-\222\030\241\201p\bL}\302\246\n\244\302"
+	.ascii	"\223)-6\245\340gf\b\016\207\023"
+	.string	"\350\225Jf\260\002\2519\f&\361\374\347iuU$UXN\262xXjWb\230\252u\350T\214\341\255\340\255\340]\3650\200\330\026\023\306\273\342Y\255\325\330C\254xU%\310L\331\225[=Swth\360XX\031y\253I\032\035\026\237\203$/\212\027\305SQw\226\b1\242x)\316SQ&9\306M\261\2307U\321|\220Hq=\261\230'U\321\252\324\300Rr\325x4\021\003g\3619\360\242\177\036\224Z\334\223;\037\274\247r\b.#g\352\006o+\311.\276b\020[\023dd\021\026\343\316\026\266,;\345\021\241\027VO\304\3241+\325\260\251\021\207N\036b\303\315\034\27399\340\310\260\360\260G\314\265\244\212\210\305G\0375\033g/\3049z\301\361d1o\312\225c\332\233,\257\027I27b\023hc\245\243\216\354\355J\222%\271M\246\333^L\312X|<\216=\375\030bqf\203"
+	.ascii	"\257\275\003\205'\250C\342dJ\234\0079\b#\235R\310\320\314\320"
+	.ascii	"\2244\007s\025@0x@\036\226\fgAw\023\200B\013*\005\212,\350 R"
+	.ascii	"\204F\002\021\221\024\024$\205\f\273\001\311f\272\205V\317:X"
+	.ascii	"\276\233\001B\274"
+	.string	"h\022\230\027\241&\307\270\341\264G\304T\256\037KZ1de\f\330#\313\022\004I\242\353\231\306\240z\370$\222\\\302\004\226\233\331\237\246J\332\226MG\202\331\f\021\366\231]s\334g\030\360\372\365\234\305=\347\263\326\216\23249\316\343fs\361\234y\bT\020-\221\311l\023~&\220\375\260K\364t&\2008\265\237\260\216\203\002\\\201\3113O'H\227~\\\305VP\023\256\332R\t\024x[\251SQ\316/Ck&\301\\\026_\316&\370:\260\231\037\266M\030\274\177B\331@\375\316]<@\255Hm\310?jK~\2014\330\374V\333\263gJG\032\232/[\244q\335\036\020'l\323K\272\026Z\024:Y\3145\3003a\233\n\r\355\240\036\003\216\337f\257\353\rD\227\324\274\310Sz\006:yC\006\320\213\204\205{?\275_\360\264I]4\302o!\327\366\363/u\353\235\340C\247G\302\374G\031"
+	.ascii	"L\335\311b\025$\007\032\334-\366\372\331\263o\022\312 =Z\032"
+	.ascii	"\275\366D,p\273\251\302\006\t\013\021N\032)\275\220{\337Yh\322"
+	.ascii	"F\376(\255\\!\031R\300\236%\017\315^j\265\230r\022\"\241j\230"
+	.string	"\274"
+	.string	"\025\371\261<\003tYz}/Z\202\277\360-\273\331\337&\337\222~\361\035C?\251.\2148\3615gs\247\206;0m[f\353iA\f\002@\273\271TmE\366b\2213\323\rIKd\244'\035*0\023M\310\007\253F\3738PIf\272\004\3471e\237\360\327\217\022\250\001\244\316\300`\311\331\260\37707w\273]\026\007\351d\250\331Qx\354a\ty&\253 <\232iK\357L\302\2320H\221\023)\353\341\321\b\340\370\301\007-FL9\026\237L*\350\351\222\0066"
+	.ascii	"\302Z\342\223"
+	.string	"\r\301\371{~6\250d\211`\372\251\231\021q+h\213+\270\363\330\362i%\027\316\304\263\004\"\311\321\033\026;\323\206/\253\272>\022\211\351\266\001\026\367\252c\023\021\232\026}\3537\337\303\f\bE\0044/\343\026\341h\310w5Vr\327\336\374\367!\207q\0220\nq\230\265\032\206\033\177\036Y&\\\345?N\223\302k\306y\323\362\033\177\220w\260\262\321D\326\004\271b\006\263\224\300lb\026\365T>\343\315\273\352\305,\361\230\261zV\003\277\301\312'\200\177\003j\n\"vU\r\236\244\002\361w\223\351yE\243\023\340\230\206CZ\345\273W\034 \216\267\323(\353\375\203U\002\304\307c\205\232\t:\202\345\322\272)s\366\220)U'\331\270\r\323\214|\t\"\340\334\267\345\245\217v\003\305\244\320\223E\373R\031\222\023\346\241\362\177\221U\236\231\347B\301\262\006\375\252\r\\\020\324\006\357\245\222O(\273\350\300\022"
+	.string	"\335\357\306CH:p\177\314\f\241\201\347\rC\2415\362[H\214\022J9l\001\277\314\033\216V\257\216\364\274\270\232\0179\337\247\346\202\025\310EZ\216O\373\311\342\311[v\331\204\362\253G\341\252!:\204w\277\321\177\315U"
+	.ascii	"\245\3653'\217\243\0021\021\241\237\006\274\020\214;A\03660\356"
+	.ascii	"@*SRv\377\"Z\240ks\212I\232W<\340\025&N\233\205\361\373\003\353"
+	.ascii	"\355!|\3420\242p_vo\205\225\215/\237q=\210g\034\250\331G\207"
+	.ascii	"h&\265\020\325\315\361VJ\022\314\353\2068l\207\310u\024\330\345"
+	.ascii	"dA\263o\273\217mg@\321\006\017\351%\256m\033\340\356ty\302Qb"
+	.ascii	"\216\271\375i\302,a\242\341\310\261\023\321\372P\220\265\245"
+	.ascii	"\375\350\320\336\344 A\365\262\362)\272 \336\320_G\024\3338C"
+	.ascii	"\244\244\b\331\3076\307\022uJ\236\353#^H\204iD\237\"*W\254C\304"
+	.ascii	"UK\020W#svMx\324\375=\334r|\347\221\026\247\002S\007\035L\253"
+	.ascii	"\005\013V\373\371n?\004k\214Q\216a\337\251Kj!!\340\2720\220\374"
+	.ascii	"\206\351\205x\032\"8\324\330\207?++\373\026\307as.2%\263\023"
+	.ascii	"\310\003\327\263H\324{]\262Y\202Q\",\274\021\351@\207\030*\210"
+	.ascii	"8_\021\346e%)\031\020#\364\214\326f\327L;Q\240\317\254g\332\243"
+	.ascii	"\241_\261\020j \020\203c$\321K\227\002\021v\215?\031\377=\270"
+	.ascii	"q\247\245\214l\353n(\370\303\221P\007\320\"\306\237\033\334\226"
+	.ascii	"\206%\016\313\206:\210=\336\222"
+	.string	"\036H\224%\002\243\362\3105\340M\2472\346\353R[\353\255a<\265\365\034;\013\354#'\360\306\316\336\271\277!\265\247#\347\311\322\221\016\202\256\035\004\022CP\244\230\204\301\027e;\332\266\221\343\231\022\354w]N\310h\f\247q/`\322\374]\332\310\247\247P\223\001\177\177\221\342y\274\337\316<\t\017\007\246Hg&1W\367\024\247Q8B\335\001\240\007\r]!sq\225\022\341\217\336\302\263\333up\313\256\362\027\275\332@\260\207\367Q\204\211\023\225\022\272\017\"\227#\340\343\3659\222\341\254\251\004\270\275%\032j\341\273\332\355e\260\007\316\273\006G\240\373Ab,$\242\31615Rb\2667\200y\251U\313g\361h\241\324z\205\241<\b^\361\322z\226\323\311p\311\344C\324zPc\3658x\262\231(\257-\253l \356\201\370\207b#\343w\234\016\177x\340,\270FE\215\013<\032\f\260\3246\372\350"
+	.string	"\362X\f\004x\3579\353\206\360\034v\005\270\212\270\377\347@\247\262XV)\n\332\363m\323,\273\326\250\311\267\0225\351\366\3201\343}/a\342J\227\317H\027F\252\334VD9V\341\013g^$\313s\271\336\230\216\025\337J\277B\242\237B\212\341\263\b\346\241D\233\342\370'\f#\006P"
+	.string	"y\315$\274P\303\246R\265\361\310y\271\231\332\274H\216@\242T9\350\003^\035\"tG^T3\361\003\205h\210\250\2301\356\002\235\311\343\016d\031\035\367y\252\323\373+\016\253\364\3608\b*\004\017Swj9\234\213\376\242\003\261%\212%\214\347\241\210\304\226\223\305[K!!\2434\310K=V\353I\370\036Ot\"\226\336\005\276B,\022\336R\037\232\215O\300"
+	.string	"\302\303u\315b\013D\302p\263\025xF8\203\242\207\202\\\250|\304\353\261\214\374\021#T\3029\213\260\306bs\263\350a5\214\267\260\217k\337e\fX\241\025\345>\345\026\306\220\204\245\2143@^.\342C\363\326\245\370\036K U\224\246\261'\233ss\035\362M\262\241\352\311\030\314\217/r\037\3162'\231R\216^*.tf\202\230?\024\205~\023\312\231A\214\020.\265\237W\004\201?b\242\364\214\201_\264\334"
+	.ascii	"\321\341\243\266\264\274\331\313\273\250\0270%5\177+\315\226"
+	.ascii	"/\036\250\217cgb\025\370\360\356\302\005EX\340~\030A$\032\027"
+	.ascii	")Tz-.&\207\020\227c\022\325$N\2047q\006\345ER\377^O5E\373M=2"
+	.ascii	"\271\341\017i\202n\022r*;\207d?a\036\342FFd\033#\326\274\261"
+	.ascii	"#v\202\n~\211\246I^A\037\304C\373\003I\023\202\347dX\223\253"
+	.ascii	"E5\300\375\220\2301T@\006]\222KA\266{\311\360\235\177-p>z\350"
+	.ascii	"\027\326cB'f\215uV\333Q1\240R\272UG\203\223\242v\233OY\376\217"
+	.ascii	"L{\213l\rL\220\261|\362\007\327%\270PX\312\2270\320\by\276]["
+	.ascii	"\261\365~\3200(\367LR\3665\216c*uUr\216\005\206\tfV\fW%_\210"
+	.ascii	"\364\372\357\325,\227\266\323%\265\3656\335\026\024\2571\345"
+	.ascii	"X.}w\033\314\235\242{\027\366u\256\266)IV\025\232\b\350q"
+	.string	"\216\325\n\031\273\363E(\226g\251FrkuY\350\355\274;k~x\2515G\314\212\254\313\234\312\215\316zT\360I\333B\362\330\323~\342.\207\271\3735^\035\221\326)\323#\241\227k\267\243\333%/\365>zHZ\306\236\210\340>\354B \3526\344\247\271\307\021\351.\023@%.\370\"U\005\bd\203\251\261\r\316v\346&\241m\036\23394\202\332\241\223N\231\213g\024\342\375aLS\f\204!\275\336\366\242\365\346k\007\337\001<\356f\316\353&DS\235\341\334a\242@\261w9G#\260\021\003\206}\357\005\2503E>\377\310O\270-\220e\357,CJ\310\372\316E\"\272Q3\326\036\206\020\307\350ulO\330:\356\267\177U\203\"\275e5U\020\266\206\366\001\n\306!\005\t\257\270\274'\252\242\023\241\257\231`\337Rv\341\002mR;\276\235\306\376e\026<`|\263\375\247v\310'sr\315\361"
+	.ascii	"0\375\242f\037\312\261\316\215\241\3338\361U\324\202\202\344"
+	.ascii	"7\212\365\340$\177\227$\365h\325\367\306\364\342SHT\377\320\\"
+	.ascii	"\213\212\200\357\347U"
+	.ascii	"b\247\031\300\202b\310\376s/\314\253CmQh1\364\276\342\333\251"
+	.ascii	"\226\227+\236hS\227\265[`\006\224\033\277\n\024\031v\365\235"
+	.ascii	"\350\316\265\035\004Q\2508\020\312\370\304\3428.\366e\201\310"
+	.ascii	"\251\343M\200\001\305\273\244\304\355\343s\332\214\243\231\004"
+	.ascii	"\240\242&,\002\200\201n\3341~\023\277\b#\345^ ~HjG<x\331c}d\357"
+	.ascii	"Z\374\260i;\321m{\351\247Ri\367\375:\215\217\353\341\007wQ|R"
+	.ascii	"\360\3172\034>\372\037\232|rIW`\365\b\301u\212Z@\345KVvw\306"
+	.ascii	"_?\374\n\305\356\216\230\300#\303\005|69\256\235\232\362\013"
+	.ascii	"~n\025\264_Y\366\365\232\332\272K\\~*4\327\250\337)=4\201\301"
+	.ascii	"\327\336j\235b\313\223\352\035q\035\025]\214\177\212\346WI\364"
+	.ascii	"\311\245S\304m\311\201\037\037\\\t\233\317\371jKs\200\344Lq\337"
+	.ascii	"!\345\231$\350i]\023\3353_\370R\342\233pt\203|\246\300t^G\217"
+	.ascii	"\307\334\020.;\347\203\215\033\212\261\023K+\353\376V\177m\233"
+	.ascii	"\215+\265\326\371\213\374b\252\367n\022D\003"
+	.text
+	.section	.gnu.lto_.symtab.4e61d017b5200d2c,"e",@progbits
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4e61d017b5200d2c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
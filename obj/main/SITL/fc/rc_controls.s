@@ -0,0 +1,1413 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"=\007"
+	.string	"\204\t\223\001"
+	.string	"\032"
+	.string	"\324\210\217\002\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\302\374\277\243\n\004\002\002\002\003\003\004\342\265\245\332\007\020\002\004\002\005\002\006\002\007\002\b\002\t\b\005\b\353\347\266\355\r^\004\002\004\002\006"
+	.string	"\002"
+	.string	""
+	.string	"\002\001\b\002\b\002\n\006\n\002\n\t\n\013\f\020\220\237\222\215\004\002\021\343\211\350\226\005\002\022\242\302\263\302\013\023\344\371\276\347\t\024\250\332\251\210\016\025\026\351\274\211\251\016\027\343\204\206\377\016\030\031\353\227\221\315\013\032\211\236\236\264\001\033\034\035\036\240\342\234\212\n"
+	.string	"$ \200\202B\270\033Yd\271\353\366\225\345\357_\250h\333\233\231\355FX\366\0043\233\016\026\350^'\232\311h\200A\016'\002>\bc\200\016\201\023\301P\300["
+	.ascii	"\205\301hc-\214\320J\013\3703\230\270\253\315\356\262\210\023"
+	.ascii	"\274u\305\034\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 z\245\001"
+	.string	"\330n"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\020\002"
+	.string	"\003\021"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	" \007\327`\246\276\334\216\230\003\354\272\233\333\261\022Df"
+	.ascii	"(\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`-\001\375\006"
+	.string	"\242\b\034&\200EI\007k\243\374\030\312\026\204Q\005\023\322\030%\020\250\240^\375\337``\206 \256x\024=\3727M\221-e\nSj\217\320\263\362\316\311&w\347\f\221\037\340`\221*dQ\241T\322'e\214\213\242\"\300r\370?\366'2\225\303R\350\023a\215H"
+	.string	"&z\375\257\311 \373\005\345\334\016}\334\335s\257\324\274\241\355S\262\273\273\365\315\215\002/ `\"CX\266\001\235n \346\303"
+	.ascii	"y\241\323\206?\005\326\271\321\330%\216G`i\255\366\267\016|%"
+	.ascii	"\336\001\311\007\036Pl\300\222\303\313\006\\\034B\032\370f\210"
+	.ascii	"5\200?L\t\230@\004\002a\343\226\034I\004\204\233\336\026l4`n"
+	.ascii	"\361\004O5\202\b\002\002@\302l\003<\365\216m-\344\005\035\316"
+	.ascii	"`\316\033\\k\326\252\032p\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\205\006"
+	.string	"\242\210\033%p\305I\007\374j\265\316\007\320\374\001"
+	.string	""
+	.string	"\200\017S\265\302\030\274"
+	.string	""
+	.ascii	"p\210A4\221\005\027D\003t\003i2\311$?2\241)\023\2249\337\301"
+	.ascii	"\222\333\347\031A:\316\211h\305\265\255\r\231a\246\033\267\\"
+	.ascii	"\252\245Zk\006\334\217w|l\351^\272NF\311\302\033n\347D9\034\210"
+	.ascii	"Z\324\236^\024\364\242&\364\342Zr5e\312\227\344q\200+ \200\202"
+	.ascii	"\t\224\261\003C\241A)\244\331T\307\332\315\365D\345\372\362F"
+	.ascii	"\021\364n\22763{7HPA\033\350\377\031\006_\016[6S^\251eXR\360"
+	.ascii	"\016\200\210P\356\206\355\002\3750\026\340z}\007kR\201w \023"
+	.ascii	"Z\243\023$\201u\262\265D<fKK!\254\303E#\321\302\025s\b"
+	.text
+	.section	.gnu.lto_.pureconst.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\020\204\004\021\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 z\305\002"
+	.string	"\244\003n"
+	.string	"\005"
+	.string	"\001\002\023"
+	.string	"\001\002\024\001"
+	.string	"\002\001\300\007\025"
+	.string	"\001\002\026\004\003\002\027\001"
+	.string	"\002\030"
+	.string	"\001\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\020\002\300\007\200\021\034"
+	.string	"\001\002\034\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"7\003@\034\b\021T\006W\r\275\252\t)A\200\3217\217"
+	.ascii	";\300\342\r`\001"
+	.text
+	.section	.gnu.lto_.lto.694c4a8942c8e24,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.78.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\315\201\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\005\031?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.80.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.84.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 \227e\004"
+	.string	"\344\007a"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\326\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\003\220 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.86.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 .q\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\005\005\001\006\035\001"
+	.string	"?\202\210\200\030}{\275\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.90.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\336\241\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\016\032?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.92.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.93.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375 \364\315\006"
+	.string	"\"M05@o\222\016\230>E\267]\206R\003\334(\210p_\213R\341\322v\227\013\271\215\315\236\365aW\224w,\"\031G\321\031B\375i\320\201`g\314`\265}Bd\nCN\025\021)O'B\006H=\370\360:\020\r\022\017R\325\343\f\034'\034\250\347\211\221z\233\354\252#\355\n.\027\372\253\232P\004db(\334\222\226*nH\247->\255X\247\373\001\350\324\234@\351j1\237\205\232\363\370f23w\244\277\335\234f\244\205"
+	.string	"%S\024\003\223,S\212\310\017\372\315\b\t\240\255f \242v\254d\234\274df\317}\324j\263nI\232q\341P\301F\027m\232\205\314\274a#\215\356\372\033\374\007\377F\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.94.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\257\001\265\017"
+	.string	"f_jE"
+	.string	"\257(\035\303\027*\003\341\022}\225\373\345t\341\263~Hb\354\262\001\306\377v>\334\f\233=\300\232\306\257WA<\370GT\362\034\n_\377\377o\277nG\310\214Y!\371\204I]\376\335\264}B\310\336R\246\024W"
+	.string	"T"
+	.string	"T"
+	.ascii	"\025\034w5\244\260\331\375:,\342\0365N@{\314oh\217\266\235\340"
+	.ascii	"\343d\324\277\016\257oP\301\222\351\354~\235r8\352\021j\242\374"
+	.ascii	"\r\244\001\212\225Y\013\226z\304p\b\202\245\244\002\200\255`"
+	.ascii	"hw\017\363t\301P27\220\335u\266`\027n\355\266\035\330\376\260"
+	.ascii	"S@\227\335\334_\376\r\246"
+	.string	"\265\307\356\250i\205\351\324\364A\233\215\013\0041v_\263\031\333\"\336\204\270\354\217=\355\313\204V\032\353J\231\261\371\347\307\030\344\2178\211\323c\256\341R\026\nd\210\261\300\331]\321\243\025p\217!\370\r\373d\203lk\332\027q\227\323_\002\003^<w7\245\332bMS\003|\210\255X\245\f_S\257\202\263\351uE\306\332\211\252\251\201\034\025\035\233\343'\\\363\031\030\273\273\300/q\023\023|\020\2176\235\344[\217\376\211\366\030\3651\277\213\207\033U\316\354/\225\332b\037\356\356ZYl\247?0\355\t\024F)\362\300\033\031\225\204l&y\230$x%\023\022\2174\"\225:\022\204\216$B\310HG*\231:\217\003\366JDJ\235\211\347\225:\320\267\207\253,N(z*\307U]\266?\032R)\212U?z\326\216*gZ\324\026\250PY<0\377\213S\2172\240\3518\215k2g\206\323\313<\036"
+	.ascii	"M\b=\f\022^\331\024\201\270\020\363\305\3355,\331B.\240\030\024"
+	.ascii	"\327\016\322@.\037\342\314*\302LdK\nB\340\340\207\325\205\310"
+	.ascii	"e\0340\b\200\2144\302\032\302\210\013W\325\215\365\2245Z\ryU"
+	.ascii	"\341j\336\333\256\242\007"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.95.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\262\003\315\027"
+	.string	"\306\252\226J\260\324Q:y\003\006(\211\271\032[\341\0019\021\034\367\361,.\260WkyFZ\207\271Jkh\343\251\252\320\177pL\274\206\277\371\334\301\303\342\r\332\016j>t\373\220\024\237\273\364\037\303=\246\346C\2365\322Z\2627\221R\246\203"
+	.string	"q"
+	.string	"\211"
+	.ascii	"\347\021S\212\nM\374\317\371\313\357\212U\312\271M\004\026\361"
+	.ascii	"\310 \217\236%\"\246\t\224\245,\254.\025\367U\227\366\210\265"
+	.ascii	"mI\262Vc\245b\263\355K\362t\266$Y\253\365-\001$ \016<\356\355"
+	.ascii	"\303VQeh(\264;\200<\210\260\251\020=J\036\017\323\036\321\305"
+	.ascii	"\313\211)\246i\226\274\035nQ\345\307\223\220\335\001\324A\204"
+	.ascii	"\355\214t\353[\366\341\341\230\307\025\3234\317:^\320\276\265"
+	.ascii	"\377\233\376\253\374\215\"\f`e\352oa\206W\307\355b\272\261EF"
+	.ascii	"~\310\350g\250\333\024\202<rl\344$\247\230KS\177\032\006^\335"
+	.ascii	"\366\372v\177\230jH\345Z\347\007\342\270{\377\366y\236\347\233"
+	.ascii	"\350?\037F\371(\225\377\242\374\023\221oB\371%\224\357\242|\222"
+	.ascii	"\312oQ~Y\371$\345\263D\376\212\362\307\312\257\224OE\276\330"
+	.ascii	"\374f>3\177\003\220AS\003t\230\346.4X\242Z\275NT?\262\313\005"
+	.ascii	";\003\212l\003T\253f\t\237V=\2368RD8voWD\220\237`\355\336G\020"
+	.ascii	"\301a\355\221\301\306`\201\261N\r\034\264\264\324\245\265e$~"
+	.ascii	"b\323\336\236\252\033\237\261}\361`e\232&\202o\323\272\200\020"
+	.ascii	"\301\305\245)\220!I\302\033\237\257\032\n)\321}\251\335\254\342"
+	.ascii	"\227\260"
+	.string	"-^V\246\231;\360e\261K\023\276%\226\036&\206~c:\001\325\357\306\347\241|)\212\304\356\001\227\273\346\n\237\305n.\320j85\264\031\314\254&\233U\220\325\314\304\320\310f\265\033YL\300i625\031\016\215V\223\225\300\3336\321m\2366\220\273\266\272\276eI\371\252\352\327Va\355\363\037\326_\2715N4\271\306O\220\037\331\275\243\364Ikx5J\016\034\257\216\231\364\311\r\033&M\247\252\2228jgw\304*iV\273\220\202\303\222.\340\203g\b\307\347\302vF\272\225\253Y\275F\301\034$]\266\253G\034<G8>\337j\022\005\033H\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031\251\3329\020PU$SAZ\016\317aT\2524A\332\006\t\b\2443pM\360~\324}\036>\262Ry\212:\272M\034\253\231\236\232\333h0\372M\273\236\003f\303\311\323\035I\3302I_["
+	.ascii	"\307n$W\006\207We\222m\200\202\177\024\271\004\266|p\005JtM\033"
+	.ascii	"6\356\001A0j\316\351\003\224\360\036\317\007B\030 \255\347L\247"
+	.ascii	"\0215\333\213\337\242\210\255\\\366KE\030S1D\330\241\244\020"
+	.ascii	"\330\006N\371\026E\272\276\336\325"
+	.text
+	.section	.gnu.lto_processRcStickPositions.96.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\031\033\375t"
+	.string	"*\266\364(M P\352\031\003o\001\230\274I\206\266\203\210\247%Q\227\331\f\305\325X\363\244e\272P \370,\036\312\302]U\223G\266\032\224\226%"
+	.ascii	"B\221\224\250\b\004sK\233\001\261\335\347-\263I\017MS\310\243"
+	.ascii	"$\312\253[\033\273\267\2242\245\224\002\206\002?\002\214\002"
+	.ascii	"\324w\354:\346\255\266S^\350\272\356%\335pmt\327[g\335\310\334"
+	.ascii	"M\352J`vQ_2\023\356d\210F\035[\216\233\256\225\364\234\263\227"
+	.ascii	"\260\036\363\213\372\222]\261U_\021\307n\231\255\343v\3136\216"
+	.ascii	"\333-7\222\2462'\371\204\226\343\036\0328\324\340\272e>\2019"
+	.ascii	"\331\355w\034'\031j\312\331p[L.\352;f\305F\005.\361}\251K\335"
+	.ascii	"\362\322\261[v2\0176\265\307\333t5\236t\211\357\373>=\017f\233"
+	.ascii	"\2456\037\335\331\374\204\235p\023\256c&L\307Kx\216\225p\022"
+	.ascii	"\246\2428a\342\252\204\025\211\252\021TSRQP\"B<951-)%!\035\031"
+	.ascii	"\025\201 \3720\304\024\n\002\372\361\351\361\300\323aG'\007\347"
+	.ascii	"\306\246\206ff\251L\312 \217F\267e\337\235\334\\\315O\2068\211"
+	.ascii	"\001\254\211\220\275:\003\330j<\361\312\230H\317T\030\253\321"
+	.ascii	"2\035/\231S\222\223\304\210\025\243\231\312\242\200\212\301\310"
+	.ascii	"\311\341\025\346^\333\023?9\274RXt\023gL\256\024\307x\t\032{"
+	.ascii	"V9\210q\022\326\256\262\272E\023}\204\331\020\252\031a\246\332"
+	.ascii	"\031R\203_\334\232\250\240[\023\005\303F\031\261\310\206@\261"
+	.ascii	"Uw/\236\321\355\032\244\335\242\201.\302K\027\017\241\370\254"
+	.ascii	"{\302\322NX\256x\223_3\371Y\361%@\267h\025W:\001,\211\006$Vh"
+	.ascii	"\355\206\265\377\242TXf\225\352\363\b\317\210UR\263R\326\177"
+	.ascii	"\321(\254N\r:\276\364y\021\210\243'\317:\"#\326\007\273\036\262"
+	.ascii	"s\342\314'M\\\310\016\211\007\331\3119\020\233d\247H\327\177"
+	.ascii	"Q(\354\016\f]G\332-\032\347?F\254\270.\200\307\217'^Y\016\035"
+	.ascii	"5\332\247\347H{0\362\346<G\376\242E\274\303\221\027|\207\205"
+	.ascii	"zB\026\245\377\242p\3542\206A7 \256\223\363\303q\356\330\374"
+	.ascii	"\246\005\267\271\363\3415wM\363\027\355\3012\335\2427|\306-\352"
+	.ascii	"\302_T\315\227\312\241\0342\322:\311*\021J\t\323\177\3214Vg\f"
+	.ascii	"\b\264\335\2426\\\206\215z\221\210\326\177Q4V)\346iC\307\365"
+	.ascii	"\220[\264\206#Y\345\026!5\372/z\306F\235A\331\342\345G#\326\016"
+	.ascii	"\031\3226\322h\367\3112]\214\f\314[\263fg\310^\260\314\367}\223"
+	.ascii	"d_\376M\327JlU8k\016\031\322v#\326\373\276\354P2\031\315\t4s"
+	.ascii	"\313\203\231\021`\336\371\t\013\374\314\273\342s\321\b\270\374"
+	.ascii	"\005\336E\354j/\277\001\373\b\255\204\256\027#A\222?e\345#\337"
+	.ascii	"\310U\230\305\257\257\327\344+\237\365\003S#A*\363\311\347\321"
+	.ascii	"\0033\"\3448-\200\313L\200\001\336P\231GV\255m_\317\305\307G"
+	.ascii	"\266__Q1B\212\024n\267\307\242B.o\322\256\034+\205\2022\354\361"
+	.ascii	"\352}^\314\347\215\237\301\\\027n\032\272\312\026\367\017\026"
+	.ascii	"!\201\004\334n\215D\205[\254\322.\277\"\177\312F\032\214\r=&"
+	.ascii	"\362E\361\2456\361b\314\032K|\307\365\361\220O\316\271\267\334"
+	.ascii	"\253\0273\361Of\206s\201_.\246\331\367}\337#]#\177\364\001q;"
+	.ascii	"\354\231m\255\276\304\21313\265\211o\350\233\300\306\005L\315"
+	.ascii	"\313\257n\2446\220k\365\035\366Ly\356O\271\177\360-\262\375|"
+	.ascii	"\024\370\256X\275\230k\245}W\201\326\233\241}\244\233\rV\271"
+	.ascii	"\256\366\247o\003\271\317\227\200\355\372,k([\204H\331\237\276"
+	.ascii	"\277\326\334\225/\027\303\377\354\002-\245\201\343\373~Qq\343"
+	.ascii	"\265\f\017D0\301\004n\267\377E]\344\372\375\373\271\330\345\327"
+	.ascii	"\257\276Sq|\337\267\212\333\256\241P\300\375\243[\256\340\002"
+	.ascii	"o\350\005n\267\375\255\033\226\267)]~eo\326s\257\276\301\276"
+	.ascii	"\351\232\250\360\312\034\027&\213^~\3753([\202\374O\231\251^"
+	.ascii	"\376k[\204\234\311\300\277\306\334\320\260\244s\303x6"
+	.string	"\330\322\331\001\244\363\002I\347\024I\347\003zI\263\211\253\022\r\327lut&\241t\256R:\2178:S\3118O%\235\245\222\316QIg\250\244\263\210\244s\210\245\363\323\322\331i\351\334\224tf\242q^\232qV::'-\235\221\222\316GKg\243\244s\321\322\031\304\321\231\350\350\374A\351<\244tf\036\235\205\222\316AKg\240\243\363O\3035\373$\235{d\234=$\235y\226\316\035\226\316;Ig\235\245sN\322\031\347\350|\243t\266Q:\327\034\235i\224\3163H\347%\322Y\211tN\"\235e\220\316\310\243\3631\351lD:\2732\316-\322\231\225q~\244\263\037\235\273cH\265\251\241Mm<\227.\024\333\254\204\006\370R37\r\233\210R\374\253\355\313\022_o\271L.\307\364Jj\211p\355\fAd\037\337\027\245\022-\254\020$\351\247\214\344.\275\022\b\263\221\\\245_z\037\305\247t"
+	.string	"k3\007o\250\322\2737~\246\217\355\006$\250V\341&\375\347\230\363\033\222\364'\272x\020\fC\266#\244\027"
+	.ascii	"\006\244\246:=&F8\307\277\243\307q\267\243o\263p\261\322y\r\246"
+	.ascii	"\025)\361\316\210\324\344b\200 \302\201\320J\370\001\br\306\225"
+	.ascii	"\"\207]4\006}\f\031}\273\315\005\002\340\314\315\253\223\313"
+	.ascii	"\033j\364;Qp\360\201h%\217y@\227\242?\240\205\242G\221VU\213"
+	.ascii	"\223\312\350\036|\211,\226\267\035B v\200@\312\025B\tJ\241\211"
+	.ascii	"\326\210\2765\344{\273Q\324\"\005\002\223F\204\nM\307\332\217"
+	.ascii	"\317\tg\266\363\305\323\031\326k\210\257\225\360\353\271nL\001"
+	.ascii	"\036~\360\264\241\377\360\213`\275\201\313\374!\241gz\r\2417"
+	.ascii	"\346A\261r\232v\2460\346$\233i\253~\365\344DIk\032a\252\036~"
+	.ascii	"\312\376v\212k\007}\n7\013zc\026&.n\240Z\t;\313%3\316\240+r\350"
+	.ascii	"/\b&\341\001\372\0263\027("
+	.string	"\350c@\017\242K\033\245YT\350`\330*\334\037\217\361\363\255\341\022\253t&\b\023\264\235\2372\226\336r}^\bM\307\222\273.Ht~\312<c\307\316j4\250B\316O\277\267\334\236g\242\001f\356J\317?\273\267\\\236\357\371\366/\2367\376)\2761b\ra8\035^\331\202Y\207w\323\274\275(\221q\263\363\276E\352\314i\303\033\272\363\375\206\303\353\271\272u\302g\265\201\201\3141\327@\256\3167\214g\177J\275\374\272\270\345L\323y\343\337\030\253\224\351\206\223\215\360I\207s\232\264R\303\344\314N\037N6o(\317\330\365U\275\236\213\233J[[\030\335\020\213\034v\371\265\246\220J\030M\316k\315\005&9\267\363\005\227\331\031\304)\304\033\232\3633vy\325\257\347\032\322\322F6\363S\006\323\016\330$1\302e\230%\220\312\316\030\032\321I\304\260\017\235o\316#\316\2708\267[\007\276\251\355FT"
+	.ascii	"T\213\223\363\371\033\202V8T\213[\376\224\263\\n\301\036\314"
+	.ascii	"\n\301\211\304\211\304\355\266\235\"\230x\250\302\rl\335\004"
+	.ascii	"\213\034\262\224\275\035Y\2247\017\330\320B\233\277\251\371\231"
+	.ascii	"\267\371\006S\243\371\232-4\217\224\006\030\270\350 k\200\026"
+	.ascii	"\036p\240\005\201V\226\213,\017Xheu\220\265b\005\006\0358h"
+	.string	"\020<\200\300E\213\226W8\265\350\200\205\226\213\017X\254\270`\205\326\323\n\r\236>\340"
+	.string	"\003\017\236Vh\265xr\372a\026 di=\271`\301B\353)\331\325\277\306\214\325\365^\3743\272]\021\201&\275\263V\356\345\245@b\243\225{q\0070\275\231\265r\217\210\001B\232U\366\204T\237F\357\264Uu\362^\024\200\306\276\250V\203=\007\037m/\016){\242\264\355W`G\024\263\321\366e\035c\357F\025\314\027\277\334\220\022"
+	.ascii	"\364\343\207Z\334\223=\001\036\222\370\261\252'a\243G|\025\325"
+	.ascii	"\217\370\024\250\336hF\367&\315r)@\"\3157\021\202D\225\362\200"
+	.ascii	"\f\360\"\254l\321\332Y7\004\370i\327\221\177\226\215\031\323"
+	.ascii	"Yi\204\0014\277\302\030vVZ\233\025\200\237\266\212\270\347R\321"
+	.ascii	"\004\310\334D\322M\232I\214z\274\357K\325\355r\355\260\310aW"
+	.ascii	"\230n\033\204\211\204X%\260\357\233\003E\327u7i\033B%74cq\271"
+	.ascii	"\242\314\f^P(\262/\312E\301\221C\034\036\016\354\211G\356\022"
+	.ascii	"\341\212\034\262#6\221#\003o\024*pE\n\263lT\255\204`\276\310"
+	.ascii	"\0268\333\\\305]\352v\322M\232t9=\240\314\315\272\246\223&\335"
+	.ascii	"1\362\210T\301\236\213\247z\234\235\370)\367\221\353\341\373"
+	.ascii	"\310\235z\017\036\350^\232vwM\274&\236\333\355\324\033\327\276"
+	.ascii	"\274\261P\027\304\204\324\003\262\r\344F\275\324\367\263\314"
+	.ascii	"\313\257Z\232R\242\276\235A\213U\t\314\330\025\017\236\035<\206"
+	.ascii	"PK\264\ry\315,\326\036+iV4z\313\205\372\f\252P\337\256\371\275"
+	.ascii	"\221\320\303\342d\203\013U{\275\345\212x\236\351\221\271.\216"
+	.ascii	"\327=\242\235\350\361\265O\221B\305\024'\245}\312\333\024\004"
+	.ascii	"}\315*1\370\f}\323V\345rEn.2\374\244\250\260\367]\351\321\366"
+	.ascii	"\342\320c\337\363\223\266\275\357\024\366<\036<\276/W\253q\225"
+	.ascii	"\226\035\372\206\241\265\2758\336$\227\201[\315\241o\022\363"
+	.ascii	"\205/F\021\361\020\324Y\215hO\020\243\374\234lS\314\252^UV\304"
+	.ascii	"\240~\3124\364\226\033\342}\360I\210\277\362\361\201yT\021O\237"
+	.ascii	"\201\323\365\323+\247\220\031\365v\\C<1\3402\315z54\263 V\277"
+	.ascii	"\234\234X-NOS\330\324\344\342d\233\301\353c\2750J\230\232\022"
+	.ascii	"\360~\273\351\305en\n6\301xC\233>\202Y\250\002\371,\323\342\f"
+	.ascii	"\251\231\021\221Q\220$\205\306\002\013\020\nci\232\250\324\003"
+	.ascii	"\022\200DA\211\204\316\224IA\222JZ\003Qy\026\354\363j\231w \242"
+	.ascii	"\004\r"
+	.string	"B A\245\253;R\363\202\003[<4\f8\352\366\271[\016\246\032+\350\030\347\365\221Znr\222i:\242Z\274N\324b\265\n\277&n7\305V\335\344}\b\212\351\211\201\b\271r\020\203k\0038\265\005<.F\033\254\243N\233N\f/\303^0n~\353\360\231\344:\317$\215G<\366\242\310\210\207,\034\321\345a\307\327\374\224\373\225\323\312s\375\3056\262\300\276\304\307a\213z;hZ\001\317\204\337\352G\301\375\017\243vc7\377\001\021X\2439v\353\336\336d\370:\317\255]\245\021\327E\200W\315\\\203\364~\316;\2568\253j2-\310DI\361@\242\230\3438\260A\356\334\310E\213.\323N\"\033#\"\371\004\304L\2639\350\0279)\\\252D\245\035\\\350\241\254N\"\212\001\251+\235\346\364\352q\2542\211r\235(\036\031k\275:\343\032\206J\274\364\272\235\021\325@6\"\236WZ\262$\263"
+	.string	"J\343.\b94MFGy\323[#\nu\304'b\313>!\007v\354p\246\353\240\017\013{\357I\317\2226h1\021Y~\317{+%\361\375K\252\203\035\2058\377\032\033X\343yw\006\265Q\362\267"
+	.ascii	"\2247\344T\241\211\"\332\222\177"
+	.string	"\333\372\363\263T\266\323\272\366\227 \236<\314:\311\231\350\351\336\253\220*)n\350\216Xu\362C\265\243\367\337DS)60\017\330\361\310\374\025\235\217\035\336Ve\2120q\245\353\020P\231\fz\030X\006\006\233\373\b\005\321\260o\253\274\346\003\245\032\216@[n\306.c\222\371jP\240\363z@\243\013\210S\336\256\231\341\334\322\315\364\2336\250)W\031\344\244\325\003LUZ\321TB\022\227\214%:6\252\201\341\333R\r\367^\217\372\321%E\365\252\003\230\022\376\374o\234\364\375T4:\337\347\257.t\243\001\007\030i\344A\344t\310\305\001n\020\307\202^\336\t\004\204\335\b\035^&\034d\342L\327\376\367\326\373\003PjM=S E\303Z\356\275\262aM\034S;``c6B^'\375_+b\313\260Tz\215\215>\2615&0\256O)\t\213E\226S\237\243\246\223U6\260\334\303*#\246\034"
+	.string	"Ax\025\030\"\007X\214kD\244~%\353i\264*itt\2216\361\007\356\315H\t%lZ{\003\002\355!\211:\252L\264\"3j\306\b\242T\026(,\233t?O\362lQKr\"\032E\327\331g4\365\"\315v\363\332\364\313\007\013\216\265\332\004\205+\325\205U\350\353\360\343\177$\216\r\022\003\303E\372\004\265\316y\226\247\315\363\302i(\f\351\336V\300\237\212\237\320\217|\261kTO\301mq\270\023@\362\355\364\342\356\366\027j\2513\221y\225>\013%k\220\033\277\374\0222\251\361\311G\371\013\366&\250:\t\277\313{A\tD\213"
+	.string	"C\203\2442\004!\334\r\350N\344_\236\304\332'\340\354\261\r\263)\343\257\3441o\200\311\306\277~\273\231\360@\245\034\330a\002i4@\2611\306\245\007\251\317c\313x\320\337\003\226\024\0058H\340\274\326o\3534\020\3376\\\022\026\321\325\275\211o\301\204\353"
+	.ascii	"\275\361C\200\250>l#/DK\244\322\303\272 \360O?g\002\023\317\255"
+	.ascii	"\245^\214\274\004\017\204\325\030\240\023g\215\216\254\277:\221"
+	.ascii	"\222\2700\344x\037i\337Z\022\023+\356(\272\323]\336\2468=/\266"
+	.ascii	"\213\304\353\231T\f\300@\202\024\211%blf\032\254\201\340\345"
+	.ascii	"\232\363C\017\237\317;X\201(\026\320\031\276\266\r\332B<QJ\251"
+	.ascii	"\326&\025;'\017Ft|\351\267\365\377G\360\241\0255\2151\003\020"
+	.ascii	"\004\316H\335\330\362\311\030\324\307\034Z0\033\347jZ\020\301"
+	.ascii	"J\2258*F\332\334f`\265\361{\2109a\227\327X\fz\025)\310\365T\276"
+	.ascii	"\0250\341\034\260\222\013\343$U\315\201E\234\302nX\034(t\344"
+	.ascii	"J=\261\276\253t\250.\216\246\245,\350\221\311ta\314\226|\251"
+	.ascii	"\005\264"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.97.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\035\r"
+	.string	"\026\033]C\020\257&\035\203\2012\226\013\235\212"
+	.string	"7\244i\374\250#\2351\001\272q\364a\021%\346{[\276z\267\317\372\205D\033\036\224V|\305P"
+	.string	""
+	.string	""
+	.string	"Tmd\022\214\320E\212\212\n\372d#!d\357-eJ\001I"
+	.string	"H"
+	.string	"H"
+	.string	""
+	.ascii	"\362\234\230W\021\371\332\275P\002fw3\334\261\016m\373\037\016"
+	.ascii	"\"d\321\3436\230b\n\005\222\023\315\356b\003\036 \036\276s\342"
+	.ascii	"\241"
+	.string	"j\270\350)\362\317\362\347BEW2\211<+\005\273\353,\231Ln\275m\002\2667\354W\b?\324\264j:_\372\030\233\f\026j\034\314\354\226t5{\002\306t8\352\366O\276\013\312\251\257\311~B\212\224\222\026\273\3339\264\001\353-\366\346\360v\310\336\330\326\264\317=D\350+\022\fwOX\300\354r\031.`\035\006\235Vz\340\205\344a$;GUE\200\342\232z\222\027\243\354@'\241Y\273\273\341\213\370\210\b>\207C\177@\362\245C\037$\036^\357r\216\211\0251\243\354lN$\025\203\375\267\273kE\2714m\035uW_\371\343U\002!\034\231m\013<\036\360\343\t\351x\3164>\017\264\r\364\241e\034\331\206e\r\260\017O\207\007\226m\037LC\2005\b\f6\f\244i\033\266\341\366o\025\305\266/=\313\337\314\311HG\2542w*Zz\351[\236/'\222L\245\226&H\221hF\031\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rcControlsInit.98.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\025\007"
+	.string	"\322\r13`m\322\001@\337\215\322&\363\220\301BZbc9\265z"
+	.string	"\271\202\254F7\202O@\265[\214y\373\343B!\203\200J\300\"\245\222\0320<\215v\2232\245v\232\310\360 g\363\334\201\203\315)\264\315\002BCs06M\200\237C\002l\234\367`\303X{\313j\310"
+	.string	"\344\352(\205S}\221[\023>\207\037\"\363\243t\246\242*\345\232\232\361\200:92K\037B\262#$\362\325U\240\344\343\252P\312\266\250\324\f\373\226\325\220\375t>})\203\361\023\223]\213\321\312^\214\244\303\3661\236l\224[\033\373\021\220G\244\262\273M5>='\377!\007\250>\324\363R\260\273\316\352sq\353m\017\330&\260\355\021\n"
+	.ascii	"3\241s\037\270\303\034[\312|\201}\256\341\bC\370\227q\301\245"
+	.ascii	"[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\024\005\235\024"
+	.string	"\226\344\205F\240\326\312p\324yU\035\200[\177db\372\331\215\3139\323&\370\272\034+tT\231\037\317\253\261O\212_\321nu\031\244\320K$&\307\023zrTXa\305\"\2001\3705F\203a\254\202\210\326\302\256\266\211\3342\005q"
+	.string	"q"
+	.string	"w"
+	.string	"QP%\230\200Nd\374\221\242\220\224\242\226\240\226\236F0\231"
+	.ascii	"^K\253\237\013}\0366\002\373H\304_\377\210\330\243$\317\207\343"
+	.ascii	"\316\233\350\274-\347Lp\256d\\\362\346l_\363\302\032\263\351"
+	.ascii	"\247\211\276\257\215\377{5W"
+	.string	"\033in\266\303\341p8\3237\322;\017^\277\210\226T2\3771\376\027\253\310\257\277\1771\030\272#I\2224\320G\023\377\263\270\004\272\275\335\212h-C\364\227\200\350\307}\350\313y\350\317u\350;\341\320\177\262\241\357\246\241\017%C\037\016C\377\355B\237\316B?J\205\276\024\n\375\272\t\375)\022\372T\"\364\253@\350[y\320\277\342\240\225\252Ak\025\203\326\025\013\372I\224$\311\237\247\240\177j\202E0\340\300}\034\275\207\321\305\212>Ft C\017\"t!c\320\317\306\377\304S54t\270\370\361:\231@\336\246\323\207\267\311T\221KH\366\303\313T\002\361&\005\203x\223JU\031tiB\274$J\025\271\336v\374xe\202z\003\367B\2107\346Tm\003\273\032\342\215\t\352\030fVG\304\013\023\004\362\302\224?\336\227S]\346\316X\374\360\276\224:\243\326\025\203\307\333r*K\333\027\216\"\336"
+	.string	"\247\022\020\316\275\025\361*\251jM\211\033\343\355\326\027\367\351\216$I\322H\300\252\227\351U\2329J-@f5\303\253[\246\356\220\335\240\341\325,S\211\264\260jx\265\206\2511\302\031>\336>\025x\332\260\341\355\322TQ\252\262]\241\335\360\246(\365H\330\002\207\027E\251"
+	.ascii	"\312\262\206=\336\2513\207wJ\207w\252\324\227\321\201\355\360"
+	.ascii	"J\231=^\251\240\212e\227\033\017\357\323\251-C\266\344zx\235"
+	.ascii	"N\rH\2501\020\003\243\245P$LZFZ\034@\003\241m\016\021\220(%\215"
+	.ascii	"A\342F4$\201|J\002\023\377\033\004\227\357a\261@4\b\345\032\333"
+	.ascii	"\250\216`\0311\026\312\004F@\f\204H\b\214\200\030\316\037\321"
+	.ascii	"\352\324t\245\007j`\264O\024\324\272\257\372Zv/\351\241-\030"
+	.ascii	"\277\255DLR#\327\3661\302\256\266!\233\223\331\245\331\272\314"
+	.ascii	"B\276\347\303\307\211\f\371\202j\332O\005"
+	.text
+	.section	.gnu.lto_.refs.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\006"
+	.string	"b\216+/`M\222\016\300D\321\200\341\307z\265"
+	.string	""
+	.string	"\220\347\220"
+	.string	"\275 \b\202  P\320\272J<\370\204\270\325\326\332\bY\333\032!\233XBH#[\246\017\240\001\026 A\342`\007\213\002)\203\033T\250I\247\200\002\364\2561\275\033\256W#{3\362\213q\371^D\275\026\321\267bE%\245\375('&%$#\320/\022\342~\220\017\327\367\310~G\376\034\320S\270>\341^\"?\342u\210\367\017\320;\274\316\320_h]\301\365\204\354\b\331\017\3627\371\231\366\260\307\265\245\341\016{\316z\214\372\210\375[\337\330\263\365J\375X^\351\233F\274_M\f"
+	.ascii	" \004\304E\211\272\031gT0\236!-qyF\001Q\215\314`\256\250\331"
+	.ascii	"\006.\013"
+	.text
+	.section	.gnu.lto_.decls.694c4a8942c8e24,"e",@progbits
+	.string	"(\265/\375`p8-\365"
+	.string	"\312\201\235UV \314,\235\306\360c\rG\323x`U\347\341g\3603\261)e#\327H\252\263p':\006\035\227c_,Z+\337"
+	.string	"\037\264\367`\364\344\264D\267\226\310\350\006=1\030\304s\0270\177u\036\374\370\303c\020\255\375\260y\273\226\033i\375\266\252Ym\2535)\245L\001\226\004\\\005\212\005A8\ro\341f\r\261&F\322\032\242\245\306EK+\253Rs\361\007e\2415m`\034gP\032O0\222\f8\250\226\026W\224@]\264\234\2747\225\226f\320\216\213v\351\246\036 d\f\272\001\247a\026\327\356\322\341\220\200\030\026(^\3424\234\304\365$\246E\217\206{\027&IJ\002\032\323\335\n@\005\200I\217\233h\"\330\3739\343\243O\305\036\326\230G\3201\327"
+	.string	"\222\270\261a=\003\324K\017\234K\017L\222\036X\226\036h\205o\350\027qY<\260>\020Fz\340N\377\303K\377kK\3773\222>\372\023\222\376\307#\375\017G\372_U\372\337\213\364\277\244\364\032/\275n\222^\027I\377\346\225^\323HoEC\245\327'\322g/\351\363\\\212\235\260\212\373\354\301+\354\216T\314\300\372\371-%a\367\335\036\3403\222\364YH\352\223\231\351\2632\365\340Jz\314\226\376\211\177\244\030\2602C\212\264$M\f\357\276\353d\202\221\301\372\267\357\277a\256\230[\3462\367F\272'\360\234\370\356\230\373\274p\311\334=\034GPX\037\357HO\260\367\275"
+	.string	"\274}}\367\002\0203o\005\340\001\300\004\375Fs\240\300\214\240a\315s'"
+	.string	"/\004a\253\262\341\005\317fK\026\345\025\034\315\273*:\232S\250hA\241\340]\270\213\226\235\315\231#Y<\240Q\344\266\232bR\256]\316rg#\235\330q\2417\357\356].w\313\355r\237\027\357b\371\315r\265\034_\274k\345\332e\347Z\252d$\007to\247\006\r\0324\314\230\341\245`\333\321\207\336\n\300\034,#=nJ\177\307\244\277{)\006\2714\203\266\364\316]\272\373\314p\353~\343n\331\177K\347vb-2gE\260\376=K\1773"
+	.string	"s_\337\315"
+	.string	"\374\025K\361\332\335\221\236\356\211\005:\316\027N5\336\234"
+	.string	"\225\252\314\346\260\376u\362_\267\333\344j\230\2717\222\275\267\205\224\311\013\0311X\337}+"
+	.string	"w\356\004\340M\022\364\313d\002\360i\312\271u\036\240UC\b\326\377]\242\206\201\274\251)\261\376\206\264\235}DE\254\311\201\331E\313Q:\367\212\231\2541\024Cn\331\037\364k\300\301U\273E.Yv6\367\221\224(\240254\251\350\336\316\265\313v\333\356\363\252]$\277I\256\222_\347\336H{o\r\0324\364\340Xi\003\373\221\352\236[\001\230\333\364!H\257\221[\302}Zp\317\262\262L\007\247\fX\031>\254\277\201\364\367\310\213W\233\203\007\245\277\026"
+	.string	"o\337\265"
+	.string	"x\002\244O\323\235[\201\310\025\273dy\251\211\271\237{;yf\302\232`=\261\276d\370\016\271\316_\262;v\r8\370\r\322\026\333\333y\311\364\336\313{/\310\271\367\202\237\333\326\262\bP\037\247w\336\n\300\364N"
+	.string	"r\261=^4\177&\022J\373\357\b\377\365\300\177\207\377-\201\206\317\376k\002\021<Kp\204\t7\225\360\343\025F~\374\302\354\3073\212\374\230Y\246D\344R9\377\373E\206w\214\375W\356\277\r\310\360\337\026\213]\255g/\3769\002\377\037\360_\013`\260\030\370\013w \310\217?\340\365?\001=\377+h\361\237"
+	.ascii	"\177^@\b\013Pd\236\377\320\377y\377\361\376\353\375\337\373\257"
+	.ascii	"\345?\227\377*\371\237\376\271j\n\003\301?2\230\377j\377\327"
+	.ascii	"\376\263\375\370\367\3735\216\017\334\303\202\037\033\340\307"
+	.ascii	"\005\3701\206\037_\360c\002\3748\001\237\371u\006\376\353\345"
+	.ascii	"\277\321\377\202\371o\227\377\356\375\367\313\177\305\314\375"
+	.ascii	"W\357\277y\315\377:\277\016\376\230\353\307[?\276\361\343\254"
+	.ascii	"\037c\375\330\352\3074~\f\343\307R?n\361\343\250\037?\375\330"
+	.ascii	"\351\307L?V\372\361\211\037\037\375X\371c\022~l\202\037\233\370"
+	.ascii	"q\361\307\302\037\203\340\307#\374X\003?\006\361\343\r~\254\301"
+	.ascii	"\217\201~\234\341\307;?\316\3711\360\277d\376\313\367_\265\377"
+	.ascii	"\206\375\027\354\277^\377\355\372/\327\177\267\376\253\365_\034"
+	.ascii	"\377\315\372\357\325\177\253\376;\343\2771\376;\365\337\027\377"
+	.ascii	"}\372\257\212\377\242\370\357\322\377!\377E\372\357\321\1772"
+	.ascii	"\377\313\374W\371\037\204\377M\376K\302\177O\360\337\022\374"
+	.ascii	"\327\304\177G\374\227\375o\321\177\221\3775\376\257\373\257\372"
+	.ascii	"_\020\377\375\377\276\377^\376w\371\377\366\337\311\177\f\374"
+	.ascii	"o\373\357\374\257\201\377p\377q\372\372\372\372\376\337\007\376"
+	.ascii	"\233\023\177\006\022\002Xk'\030\216\253\351\324$\307\n\2173\""
+	.ascii	"n\277\264\276.0\260\316L\322$\234\265\f54\224T\311\300\372\231"
+	.ascii	"\311\237\207`\027$\350#\003\006\353\334\026\364\274\304"
+	.string	"F\256\t\224\f\353\033\234\257\364\027\354\346\261g%cY\315gj\263\300\020\244n\006\006\251\336W\r+\254\2356I6\370\242Xg\264\214$'\371ih\2264I\231\321L\237\323jp\330m\001\301\032\347\347\363\331O3#\366\204t\246\225>\227\220\217\3744\231L\224%LX\037\007+}6BB\026+0\254\263Y\232\204\323\"\003\r\226\262-\331,\027\021\301\336H\270I\306T\036\326\231H.{.\222\235\271\310\006\314\275\227\271\210\316\230\275\227:\367^p\357\005Z\b\026\027\032P\037gE\232\207\004=\223a\256'\034\034\32687\320\364w\354\346\260\260K\326\263\225z\031t\351\335\304}}e\260\013\201$1\240:N&\247\027\330\317\356\007\0174%>|d/\232\275\267\036\002\330\352p\236\216\224Ie \317^\030K\020,\260.\254\363\017\214\345?\315MU\235\216/\260\256g\356\272v>\314\345\362"
+	.string	"@\364\310\306DS\2547\252\0239\270\270\""
+	.string	"E6\346\353\247VD\252\013\353\337Pm=\363\326E\273e{E\215R\035\331\230\350\336o\030\350|\361\242\241\205\365m\366th]\264\f\334\240\246\244\267ar\003\307%\323\030\334\254\264\366\242\317\3646Bjdf\316\272e0\320h\356\247\215\301m\232\351mjX1\363\325EKws&\355D\025t?91\270\215\214\3646O\231*S\345\252t\367,\261\300\212\230\212\343\341\330E]\331\321\031\277\317<##\341\262\255\254\311\243\023\323B\203\345\t\031Vb<s\214\333\347\303\334Q\030\200\324y\275E\367\236\302"
+	.ascii	"\307\253\r\306U\222\251O\345e\320\336\313\030\030\202\260\345"
+	.ascii	"L\241\361\004\032$**\277\270S[\271\3473fue..\311\213\354\242"
+	.ascii	"FF\023I\030\326\271\305M_\025)d62\213\032\025O\367\231\237\256"
+	.ascii	"\023\037\347fQ\201\017\250T\305\036\324\211\365k\220rSn\312*"
+	.ascii	">\330l3gp-Td\247g\025\300<\024QU\260\276\227k\247\311|L\331\300"
+	.ascii	"\202\342\367\231Q\340\276\274\367\022\206\017\020\266\247)\f"
+	.ascii	"\256\025+\2461M\322\347\244\254\364[\344y\213\344\245\017\224"
+	.ascii	"{S\bSj\355E\367\324\224O\332\265<\373\202u^\"\273\331\025\320"
+	.ascii	"t\371\300j\302\372\027\377\300\275|\332{G\375\234\373\351\350"
+	.ascii	"\006x\177\367\372\37487\337\002\374\327;\377\327\320\356\275"
+	.ascii	"lB\327%\365\241\266\224\201a\377t{#])%p\005\205t%"
+	.string	"\265dv\265\225H<\224<O\373J\271d\2667\317FBRz`n\236%\263\r\265O\330A\335\355\274Rn$\346\346\331H{\211a\t\351\nj\311l\t\305\263dv\005\265\315\256\366\316FZ>1!\355'\236mv\245\267\315\230P;KfL\250%\263+\035\367\213I+*\312\215.K\307%\262\204\264U8\315X>\355\320-9\231\333\312\336\367\231\264\237\n\260\367\f\346\223\225\245\324];\242Sq\204d\311\274N\247#,\346F\242[\372\301\334\373\307\321\320v\332@\351\244\3339.\235\262\306\214\335\224\264w"
+	.ascii	"\234\366V\336M\267\367V\356\275g\236f8\367\216\261\263\324tr"
+	.ascii	"\332{\252\307i\317P\262%\355\215\237X\326\240\226\314\260\230"
+	.ascii	"Al%\2305\267\222Sy\233\333\312\325Sj\246$\262\233\270\244M(\026"
+	.ascii	"{X;\2356kTg-\260\316Gi\2206,#X\237\206)\315\312\231\255$M\240"
+	.ascii	"\321\324\231\003\364\332\241\304\2065.\323\223\0169\342\214q"
+	.ascii	"\205\017\217!\261\247\003\212\034_\024\207\301R)zD\261E\275\340"
+	.ascii	"/\251\2240Ypb^\272p\231\3612\345\f\312\336\205\033\270;\264\215"
+	.ascii	"\303\007Cuh\356\270\320xVa<\032f\214\"K\251\024g\301Z\356\023"
+	.ascii	"o\271.c:q\362\362E\234\232\017P\307\007\210\253`+\367y7|\205"
+	.ascii	"\006\311\271\315r8Q\346\300\372\351\212\264\304\314\275\333\035"
+	.ascii	"\02572omXO\301R\356\023S\301vM\260\234\032\226\n\350\336\033"
+	.ascii	"S\301s\270\016\313\251\271\367\276\240AC\315\236\216\030|\351"
+	.ascii	"q\335\315lX\320]\201\201\265\006A\307t\300/&Va\300\244q=87\230"
+	.ascii	"@\252\260\376\314\\\372[\366\344\2269bjF\301P\356\023\303\341"
+	.ascii	"\267c\267{w\354\334\333l\003\206\303Nn\231\234\245s?\005m\276"
+	.ascii	"\350W\217\206\034\306,\016\n\324\237\361J?s\225~\206F\372\231"
+	.ascii	"\027\251fr\264\007\206Y\026\225\245\031#\n\212\024x\315\023b"
+	.ascii	"\244\344\232LyW\177\020\026\222&\374\364\265\005\212\327\360"
+	.ascii	"\017|\206\225`6\214\004\007\301K0\020\374\205\213`5\\\002n\303"
+	.ascii	"`\030\r\013\301O<\206\3150\021\234\004\017\301b8\f\227a#\230"
+	.ascii	"\f{a\347}\3424\334u\334\003\373\020\233\001\245\211\225\226."
+	.ascii	"Z\364\216\352\rz\304\007#\256\251\343\242\221q\300T\322|q\321"
+	.ascii	"\346\360\324\037\224\003\343xZ%i\006:V\230YM?\257\274t\202\231"
+	.ascii	"i\375\200d5\036w[X?p\037O\035\2138\037IJI\264\274z\350\036\330"
+	.ascii	"\216J\217\356\327\245oH\235\211A\301\232\213K?a+\013\262\026"
+	.ascii	"\315Z/\324\244P\311\221\343\267\325\303T\352m\340\205\205\215"
+	.ascii	"\027Q\252(wUt\374\267\365\333aC%\205\207\030\326?-\035'^\252"
+	.ascii	"\326\202\244\367\202\311X\350\323R\262q\343F^\342@\227\327\333"
+	.ascii	"W\030 NoX\277'\352\227\365\313\312K`m}oQ8\025jlR\260\260z\330"
+	.ascii	"M\331\300\210c\013\213RU\365\263b\200]\231)\034\203\213\234\016"
+	.ascii	"\346\177V5e\222\364\322\304d\200E\213\307\230\f\031?\032AD\310"
+	.ascii	"j\246\242(\2612\343?\032\267\257\316H\024\f\306\307\325\t.9`"
+	.ascii	"\300\310`ievSQ\355\214R\272r\365\342\305Ojk\017L\221\023c\260"
+	.ascii	"\226\372\322\204jL\213_\213_\213,QvSXf5,\354\250\250\\u\325\226"
+	.ascii	"vS\317(nNy+V\374\236z\230\312=\017\272\232\\0\371\361{\302`f"
+	.ascii	"\360\344\346\240<I\221\342\3474B\033\2271_\330\207\025='\277"
+	.ascii	"\246\377\234t\016-.\262\220\241\210ZB\205\365\001\220\203\211"
+	.ascii	")\203\365<\211\332{\003~\271rk2\346\247\364S\322qY\b\323]U\227"
+	.ascii	"\337\211\337\tMf\211\367\366\2232\"\265\025\366;\372\035e\260"
+	.ascii	"=\273\251/\253\2610-~\312\237R\327=#m\252\276f\022\026\220)\254"
+	.ascii	"_\341\250\357\357\313`=\314\234\327cH\363K\207UqR\313\343\343"
+	.ascii	"\323d\200@\371\242Q\n\226Y\3151\327dr\234\016\037f\024\234\\"
+	.ascii	"\271\336rE\207\311w7[Y\266W\314\250A\271{\212\356\245)\037\033"
+	.ascii	"\")\210\324u\271\016s\035\325\200\203oI\277\274\356\226Xk0\327"
+	.ascii	"_\246\342\332\240^\364\027\037YfA\276\322/ -{\001\005\205\265"
+	.ascii	"\346\362-\377\261\245I\017k\275w\267\251*\321\033z\227\303\222"
+	.ascii	"r\204\265\306\323y\367y8\r}N\233\322\031\\Wz\022\356\341\200"
+	.ascii	":\313\265\2266\252\254\253\034X\320\356d4\261>\205\032\351)\320"
+	.ascii	"\220\"EW\351a\346+vvS_{/ac\336]W\371q\321\322\353\323TfX-\243"
+	.ascii	"T\246\324D\261\361\3502\005\333]\310@XDI\242\233\233\323u=]m"
+	.ascii	"C\232\251Z\331\2225Mw]\367\013ksJ]\264\037\326\027-j\\pp:.\250"
+	.ascii	"L\b\223/\234\271(5\250(\327q8^\214\320\r\321\003\312\255\030"
+	.ascii	"3\001Ez'w\242\237P k\013\262\346\223#\305\006\212\024\372\355"
+	.ascii	"\372\211\316\021\220\035Ip\036\316\327\026*0\344\334\236\332"
+	.ascii	"\r\353}\260\227P>N\226>\304d>(6\230ly=\265\227^\322\343\334Q"
+	.ascii	"5J{=\344\242\373\351\r\203\017\354jP\351%mz\213\024\336\030\254"
+	.ascii	"\331h\236I\315/\254O\001Sz\016\302\306\276\305+\f\n&\304\216"
+	.ascii	"\313+\032\004?}\245\235i$\032M+\321I\364\232>\242\325\364\363"
+	.ascii	">u\232.rm\246\215\274\347\353\222\365@\203\226\200\237\230t\232"
+	.ascii	"\036\242\313*8Z\372@%$M\213\335(\343\362\212\246ZK\214\254\240"
+	.ascii	"\240\317S\227\336\036\236%e\232\bMR\215\253\345\316QS"
+	.string	"\201$\006k\355\324d\377w\231\037v<d\351y\276\322\363t\245\347\331\221\236\347Fz\236\253\364<4\322\363\270H\317\223\"\375\016\337\217\037Y(\216\204!\205\241\322\365w\351\036\227G\r\335\023\252\005'jE\305\004\353\357$\311q\315\225c\017K\006\r\224KK\030\326zK\363\330\241\245c\307G\324\365\324}\352(}\303\307\007\276\213j\311\303\332\006\016\225/U\214`\375\035fZCci+}\245\231\367\251\2634\3255\f\214\342\367\256\352\222\001\263b(\211\001c\306\212\246\214\251\r:K\323P\201bH\317\f\232W\025\253\033\375\235\024\351u\242\351u\362\322\353\330\245\327YK\257\023\226\376\356\004\240~\241\245\\\264`\241\023#\375\365\223~\302}W\356B}\201\201a}\235%\275t\255B/e>\021I4R\260\266\240\300'aM_X\353&\355\224B\243\320L{}\327'\372t\222\317\324\216\362"
+	.ascii	"\210^>!\343\005\323\315[\362t\004k}\244\221\364R+\365\316q#C"
+	.ascii	"&/{v\366\306\212\256\335D\271\030\223\"\302\366\fw\237\231-\363"
+	.ascii	"\005\035\355\245\020\005\004a\323c;\250\352\260\0263\223\002"
+	.ascii	"F\332\363G\372+&\227\351\262@\353\362\234\030\026\350\224|\347"
+	.ascii	"5g%C/\335\324\316FR\222\007\355\222\355\362\\\216\222g\357\032"
+	.ascii	"W\232_r\230\034\315^2\227\f\346>s\227\\\3459J\216{O\356\222\245"
+	.ascii	"X\261\271\363\302E\227\243\345\276\245\202\243\245\017\206l\201"
+	.ascii	"fh\276\222\363.\335\224sG\331$\251\343\362\244\227\367\3563C"
+	.ascii	"\337\343\334\373y\001\207\357Jt\b0\017\357f\r\205\f%\254\363"
+	.ascii	"\226k\006\227\242F\213,\367\231\265\350(\365 \303\003\353\214"
+	.ascii	"\345[\230\224(R"
+	.string	"\334\315\005[X\034\326\317\201J\237\223\"=N\231L%\245\002\245!\027M\217\323%=N^z\234*\351q\354\350\362\334\317\fJ\027\271<\207&%\256\351H.\305>w\0020\277e(:B\326l\244=\001A\307\\Z-Re\3255\004\"2\331\001\2314\262F\f\037\372Y\325\243\021{A\033\264Q\211\214!Z\265\270s\024\"\213\306\021Fu\250\212\300~(\261N\370\320\017\220\312~P\205\204\354\321(\024\332\001~\350\007(i\004\"\215L\254-\2205\342\020'\024\221F\023k\210\035\016\255Z\254\360\241\237"
+	.string	"\254\302\026\004\205\242\"P\322H\241(\250\022%\207\202 B\260\200\205\241\237\344*\024\321\203\374\240\036\211H\341P\002\210\306\020vL\b\031\333$\bD$\207\242Qh\204\220\235\300\252\307\241\211\016\"\214Ga\207V\0051\034\n- \215k\313\002\251D\243\343\020i\004ZY# "
+	.string	"\034\217FHd\0229\323\006\201$\222\310\031!\241z\324\255\312\022\251D@\241\036a{T=\254j\253\022%9\250#\204 \210H\016&\216EEB\003"
+	.string	"\r\205,\250G\243Pr\rAm\205\"\250\305\236\017\375"
+	.ascii	"\251\253Q+T\205f\206\027(\260\201\017!:p\bR\300C\0060\020\354"
+	.ascii	" B\020\304\007\236\017\375\\ \304\007\020@\255Z\\\205-\206\021"
+	.ascii	"\f"
+	.string	"\223\307\016\352\232\354\300\022\r+\264\037\372\0012\256D\013Z\244Q\262\203\b\341Z\244a\2038lp\003\355\232\f\2018!\304\b\240:4\216P\211@\226\30419\324\035\030\201M\026i\242\272\n\325\343p\206DR\2045\311\256FC\032\023\302c\021k\364\320\"\325u5\352P\244S\301\302\205VeWu\204\272\006)\260A\nR\022B\0237<j\261e\205B\301`{\024R\300\300S\241\002\023E\311\016\023\332\"\240b\321\020iT\201Vem\220B\370\307\006o\332 \262X\364C\026\213\262J\002#\253YV]\211D\341\214\211\242\344P\257mQ>\216\211\265e\215EU\204\240\005\242\212,\032\217\302\031\242\312\032iv\346\302VH\f\026\213~rV\341\320P\007\213\210\324\020\"\024\213\006@\264rH\206\240\2405\"?\344\f\325\243\220\352\241U\213\024tZa\313\326|\350\247h\024R\211\214-\322\210"
+	.string	"68\031\374\204 Z\207\253\216M\320O+T\213T\021\332$\bI\"\016\215\006?,\006<\fW\233t\303\017\273\326\260C\021XV\035&\327\"\013:%Va+\3640\\\201\025\324\340\016k\324\n[\020G\243\341Q8\264@D\n\211\210\222\035\206+\215\221M\206P\304\001\371A]\205\027\210\324\2265\001b\302\207C\343\252\"\325b\372\r:X@\007\036\224\230\271\007\016\310\300\001\031"
+	.ascii	"\357\201\003\202\202\034\320AP\372\016\202r\333\266#`\205!\204"
+	.ascii	"\2065jP-RU\0217j\220-\n\217\025P\217\"\204\254\321\003\205V\r"
+	.ascii	"\022?\224H\212\230i\203\032l0\"!\\\263\220J\f\266\026>\364\263"
+	.ascii	"\252Gu8\024\002\261k\222E\252l\001\212~l\220%2\256!B"
+	.string	" \"9L8\036\223\253fU\243\243p\004\360C?%V\240b\321\204\022kM\221\220h\270\376V\225h\034\221\\\213\210j\211\365(4\256*\313SB=\026\031y\020:\n\207jT\242q]\325\021\311 \322\210\241\r\316\024\205!\222\306`\321\350X\324\303\323\252\254\272\006\211H\243\210`+d\203DFk;\002\265\210\025\300\215z\024\016k\332U\035\2014\016W\242\221\350\2074\022\245#\030\252C\303\022B\242T\207\355p\024\216@&\215\255\360\230,Z\325\026\371a\270Z`Uu-\252\036\324c\021\311\201H\330aD\221\020\005$\204#\f\215\255\220HE\032\2077\304cr\210U\327\241\020j;\344\240\022\223\030X\215\302\036\244q\250\262F\301\022\253\315QE\"\205C\303`\t#a\260\204\220H\207]\223\353\252\006U\"\341*\024\034\256,\260UY!\241d\320\310\262\253\r\317\005!\241dk4\034"
+	.string	"k,!\f\026\215D\250\304\326\250\bi\264\240\026\231h\203\352\bc+\034a\\Ub\260\2104\016\265\311$\021\033\034\256\025\314x\330\320\016\025\215G\241\035\022\311c\216\016q\303Q\270\266F*\222F=\266mr\035j\203\304\rD\244P\004Q\250\022'\220H\036m\332`\007A\351P\3218\024$nh\215D\306\343\rq\203JL\022\005\211\352\320\2605\222`u>T\301\223E\352\n\324&\223+\220\r\033,\032\205\220\311\016\302\034\242U\030l\331\325(\024D&\203G\3410\230\\M\024+\264A\017Z\244\321h\346AA\0350h"
+	.string	"\004\013\244\303\037\366\230\\[dr\030\034\256@C! \244QH\0044\\Y\240\037\001\230\020\036Ub\220h\025\262Fb0\331\032\ty\212H#\321\312aMV\200\035\301\320\330\202(\"\215\254\006X#"
+	.ascii	"\216\311\344\004\202?$U\326v\344\260\221\246\303\344\320\221"
+	.ascii	"\365\345@\273v@\251\023|igu9Q(T\230\236\232\314\317-M\211\343"
+	.ascii	"\210\023\336!\265\245\252\204\247\231(.\234=\214H\335l\t\t\003"
+	.ascii	"eF#'-\t\255K\221\237U\tA\262<\313\226&\260\327\224E\244\212\f"
+	.ascii	"\017\271(\326\316\fv\006\003\007\026\331o\313\b\325\030\336o"
+	.ascii	"\310-\223\325\245$\f\353_\330O\354\277\261\377\306\360o,\367"
+	.ascii	"\365\001\307\246\034\001\n\311HQ\254\224X;\305nV\254\320b~=\301"
+	.ascii	"\321\023\362eG\020\035\027\204\242\250\203B\304\231P\334q\212"
+	.ascii	"1\206\224\031\222\3216i\f\303\024@Pph*\030\354\243\256\017"
+	.string	"\023@SI4z\016\205\231bhHDD\222$\205\354\354\006n\177JI-\362\336\211\256\246R\357\342c\305\202ed\300\374\377L\320/\223\304l\263\f;\2259\276\275;[`3\376\261\277\375\274\215l\235\313\341\263\217\224\324\023\345?c\022m\344\312e\367V\305\326\313\363\204\263\352\210\3467 \313\204\004\254\321Y4A\005\261^\357Ix\343\373g#\375\212.\347%\003A\240\306\353K\236\374~U5\310\334 \265X\231\214+\032\214\b\265\217\017\254\223\270\376hw\322\200\005\021\036\025\337\334s\254\250\325\321\325\335\353\031s\026\270\301\006\325?c\243.<\211\335\376_\007\2304I#\204\020\255\217\210\227\265s\267ch\274\t\234\003\302\263\241\006\3633\304\303\223D\210\312\203\206l\001\327\032\274\003\324\333#\353\242\021z^lB\037\317\346gt\235I\350@Lhq1\204H\240\303\221\2115\351\267/\236{\""
+	.string	"I"
+	.ascii	"\275S\031\350\226$\322\002M\302\214\367\233_fH|\317\036\344\270"
+	.ascii	"\355\235WR\025\241\004X\373\363\242\354\203\200\364f\266\370"
+	.ascii	"\230\250\254A\3238{a\331!\302\251\262\232\036\002\223\274\314"
+	.ascii	"\035\302\372i\354fFu\\\350\232\332R(\233\366\301\244\217\f\361"
+	.ascii	"\302\313\231\002\201\210\373\201_\270\242\211A\342p4\307\345"
+	.ascii	"\204\013\214X\205\214\256\326\307\204+\302;\213\305\005\202d"
+	.ascii	"\f7\243;\265\241\024\265\205q8m(|\346\274\266\240h\205\324\002"
+	.ascii	"\233\023\374\261l\032!\035\034.\327\202\2411iAVJsQ\022\271\267"
+	.ascii	"\030\220\341\363\242\357X\005\003\377\325Q\203\206=#3\313/\250"
+	.ascii	"(\203I\342\230Z\206\334\333\271\333>]\364\352\017\366#\323\204"
+	.ascii	"\nc\023\320k\201e5;[\361\2458\240K\226"
+	.string	"\377\255\220_\3630\355\371wr\306`\233p\236\357\313\354v\035R\232\025\362M\305\037+V^\220Q\032[Y\355\230\231\261 U\250\214\fN\260\217\3115\334\270\350\257\020:\363\017(\212\274\271\263&\314QF\337\347F\"ve\215'\344z\353\221B\273\017.\310\002duv\302\277\251J\3447\352\334\243*\007\226[\002\033I\242r\220h\223\250\004\212\223(\232`\2253z\370\317I\023"
+	.ascii	"\307\344\270}\023%\201\013\236\352\361&\324@\251\\\354\251[\335"
+	.ascii	"\203\260\230\331\202\313\325p\206\350B\366\002\270\340\226%\260"
+	.ascii	"\032R\321D\2011\341\357\370\253\356\215n+\275_\2547"
+	.string	"\253\205e\273\230T]!}\344t\357\326\234\264\211i\032x\234\273\263\352\177\202F\240\016\005T\363\310\202\2074<'\256\370\036\367Pb\225k;\337/\274\277\032\273LD\027\237H9\344X \207\270\322\374C\021[*\037\\\261G\013Xc\322\263\024\311\372\213\f\211V\3649\250\257\3032K\377?\341\037\016\317\212x4\376v\321\023\221\236\303\b\307\201\220\262\317\273\345\272x\026\037c\326\257=\247\260\205\300\304\335!q\n\233h\b\001\252Xz\327\366\263Y\223U\001\034\277\273\374)\017\026(\203;\323o\205}\035C\321\330\027\210\205\240\2110\321\274\032\307\303\227\363`1\342R\267\343\2231a\270\025\330\324\234:\340!w\022'\356\244\260\2012\300\251\220k*f\320w\220\256\205\0336]\333\350\nHD\36176\331xKn\2427Z\260\240\246\231\017p@e@\372=7k(v}\250\2616\206\007\\%^"
+	.string	"}\214\001\232-\007\271\003'\035\254\305g\333\304\231LC\360&;\332NGM\206\312-\204\177\311\036!}}t\277\223\247\207\3004dg@\320\323vYt\221\271r\377\321*\226\302\t\2171\004\300\304^\235\300y\344\353:j\r\317\3371\217U\242\304kT\0249A\251r1I}\334\252\035\304\246\331\374M\356qz8)i\225\004\232V\004\267\337Yj8\030\255\350\013\024Bk\006TC\240\\\314Qi\222a\272\022\247\220\214\032\034\332#\001\271\034PZ^\301\275\212.-mN\303z\254C\\\210"
+	.string	"'\301d-rC\025v\341\275k\322mf\027\031]\277?\371\2000\366\037\002\252k\223m\037\312v\353\253m2\246V\267\277\006\023\3478\257\273C-\374\005M\333\246n\024\020\343BM\355\220p\220Y\325\215PX\342(E\201\214\2328\244\tD\225\203\301/\377\266P\026\033*\361Mm\321\216;G}R8\331\334\251\251\334\376\252\333\002\251\345\201\251\243\240x0xPp"
+	.string	"a\264\032\\d\004\252m\207\232\250\232}B\323\222\034\007ao3\266\217\236y"
+	.string	"t\365\b\177\215\245\247\004\225\242\276\254P\353\327\332\017\336\247\301C\252c\250l\344g\361\225\202\237\303t\247\370bd0 E\271\311\3160\337\253\203U\205z\013\300\252\306\250\300\354\242\200x\331P\022\231\300\n\244\275\323\023\216\261\245H*\027\304\367i\266\231]?\322\344\321\322"
+	.string	"\034_\200\344t\314\350p\325a\212\347\276)4\277?\371P\005\t`d\f\304x\226\363\027\315\374\201{\266O9\266\274\372E\321!\345\235n=\341\301\366\216\2314\304\317i#\253\202\255\305\244\203\340\305\330t\335a\222\260\f9\267\266CsW\002L\343\374\276\021\256\230j\025CZ\201W/\224\356K\277\217\200\367\220Eu\037\270\321\322\001\347\230\037-\224\213d8\303L\nN\376\376s\n\022G\"I%m\307\227:\"\233\177,\245\347\360\246\315t\352MX\007r=\354bjw.\301X\365\336\337\001\003!\345A\374<=-f(\001\370J\346\375\301[\372\304\230e\216\311\261\345y(\270\352\t\264\003\220\306\216!\370i"
+	.string	"\354#\266\r\035\353\247e\351\fk>\214\n\225\001\303ql\353?\240\224K4\372\341\301\031\346_Z\312\260o\240u\036B\216\254\f\227\016\307\247\177\263\345 \244\213\240U\322\023\031\033\0342n\345\236?\306\356/\016\247\267*\240%\275\341\n\341'I\320XR\302\212>\007\352H%\347\243U\363\316\tMKrG\274\005\005f\252\215\2502c.\0276\n\304\036a\255MYHQ\351\2410\352\f\322|\263\230\2308\342\345\313\334\203ZrS\007AC\246\310\315i\320\314\231\231\257\201X\002\030\366\001\275U\206\267vC\252\337\361T\217*S\363\306v_\377X\317\2764\367K\344~\371\b\237\241{w\\T\217\241,i\002\212,\340\265\365w\266\370c\333\2347\345\225\371\034\205|"
+	.ascii	"w\355\311U\235\272\f"
+	.string	"\243\234u6\036e\030,,\332\300e@ 3\261\352#\247\224C\370\351\022\024,c8\211flE\201x\267\304D1\214\332\313\222`\232\372U\236k\2337?k\216\016Yv\004^\370\315\306O\371\344;z\242J\205\331!\340T\002C\275\325\005\324\030\233;5\b\273#\370\237K:\334\261T\305&\317\305\300\236-\354J\272\330{\036\210\354,\307L\220\265\244\253^$D\221\205\214\312!\222j\364\025\337\"\017MY!}\223\363I\274\022\004-\201UX\240.k\f\220\022VF:\340\202\013t\252\234g\243p\277>\336o\204G\301\340T\214\214\305\0377\275\256\264\036\376\355\001\316\245\007\220\2248\2710\232\007\305\036$\bU\304\354\261I\326 \244Q\336\220\037\235@\342a@\r}\r\325\350\366\265\312\231\302Y{\206B\227\024d\321l\216@\344\243 \310\372\035\2519<8>;x \\%FE\355\312\023"
+	.string	"\254\032\302\301\340Y\016\025)+O\331\r1il\251\360\304\202\346g\376\335*\212\333\346\257\031"
+	.string	"\255+X$\2548\206\004\354o\272\206`\327?\311p\3779\003\211\327\021\236B\241n\342u\246@\252\037m\003\001Mr\025g\002&\t\326\275\n\326_\266\311\031\210\360:\327\375\305\013\254VYA9\370\323j\364X\371\032\355^\377\fC=\nRE"
+	.ascii	"+\217~1\\\240\227>\255\351\255j\277^\254\304o\203\267\231I\327"
+	.ascii	"$\374k0\377\241\204\243\017{\220\376d\326=\332S\354p\215\254"
+	.ascii	"\001\304\302\375\364\270\320&h\323\367\017T\274\340\366\266\361"
+	.ascii	"\265\336h\301\313\301\213\223\377F\226\213\262o\215ei\214\231"
+	.ascii	"\261\027t\332\030=@\347A\315\373RG\310s\315\277\372\334\3231"
+	.ascii	"/a[\006\230\343\271\237\236\214\307OF\266\250\261\1774\346v\365"
+	.ascii	"\361\367\244a.\3447t\327\265\351{\031\371,\357=\324oj\315\022"
+	.ascii	"\342Zbb\202\023\370\230\272\257\352\361\36579\037\262\227eYP"
+	.ascii	"\315\234\237\367\305\376\347\345\211\357\257\342\033\315IZ?\202"
+	.ascii	"/\330\237\331\344\304+\344\207\364\021O\030\232\237'\343}w\330"
+	.ascii	"\373^3\373\031\301?\210U\265\026{\3015\243\377\211\277u(jfv\303"
+	.ascii	"ir4\303Z(o\301s\334\025"
+	.text
+	.section	.gnu.lto_.symtab.694c4a8942c8e24,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.694c4a8942c8e24,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
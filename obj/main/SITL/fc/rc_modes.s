@@ -0,0 +1,932 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\215\005"
+	.string	"t\b\020\001"
+	.string	"\021"
+	.string	"\326\363\316\r\002\002"
+	.string	"\002\001\001\347\263\343Q\n\002\002\002\001\002\002\002\003\004\002\005\003\240\342\234\212\n\004\276\264\256\247\t"
+	.string	"\005\006\365\203\345\270\t\004\002\006\002\006\002\007\002\007\007\252\343\227\371\001"
+	.string	"\b\226\336\200\374\002\006\t\241\263\347\271\n\016\002\b\002\001\n\306\251\353\346\b\b\013\327\220\2446\024\002\001\006\f\r\246\213\347\204\013\b\016\262\270\337\265\r\b\002\t\002\t\n\017\367\302\315\257\f\020\021\240\342\234\212\n"
+	.string	"\020"
+	.ascii	"]\t\313\315\345yy\252h\032s\035\360X.\305\316\226\320k\305\240"
+	.ascii	"\340\004\353\033\002;0[\365\\\243\235\030\005p\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"m\004"
+	.string	"BF\020\024\260%\351H\222$\211j!\3206Kl\333\204X\262eJ\001\356\003\222pM\355\n\322\001J\201*\354\201\310\316\377n\304Vd\231\324\271,\023\354\311h\354\037t\024\357\342\261\214\363\320\231=\215\023\002# \240\002\262\271\033R\0061\\EX\227\034R\354\036G\205\321#\002p\341h\240\270\2027\266\323J\230a\200B\306\np"
+	.ascii	"\336@\374\270Q\017\257E\232\001\241\346\302\342\2610\216\203"
+	.ascii	"\245K\222wk!5\336\216\31654\356\006"
+	.text
+	.section	.gnu.lto_.inline.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\353\002\375\017"
+	.string	"\246YU@ \217\223\306\270\362?\370\2424P\374\2624\261r,\003y\216\312\027\354I\206\f\311\277\264~\003\232b\032\200\313\303\343\242\261\335\003\300\212\200\030\214\232'\352\324pUN\315ha\310\266%dK)S="
+	.string	"C"
+	.string	"I"
+	.string	"x\373\243%\324\351B\245\356CyRr\342\"\200\265G\337$\212\250\311\214\024\024"
+	.ascii	"\306\2617\366\362\347\320o'\b\236'(ww\255\177\260\273\331\267"
+	.ascii	"\3275\211\343\030R\323\356b^"
+	.string	"\263\302\b\237,\241N\026\332\034\203\332\356O\222R,+\252\323i\212\245\324r]\356Q\307\220\222H\251\225\216\335#\213\021 H.\037ER\005u\302p\215\371A-\037C\252\255M\373\363\266;\335\251@5\244\234P\t\246\335,\363!\371v3\016\215\335\214\300\033\316\201\264\235g\317\351\022\250\213\211\032\017\357\fJ\022\331\321\026\0226\224l|H_\244\220\301\341\003s'Q\004r\322\301\037PD\004\026'\033\334\306\005\031\242%\202\207\2173\377\235\003?>\366:XO\222\031(\240\274\002\371!\206\n\223\200/\b\326\217\344\204\321\213h@>\216d\205\321\213\250\343\215&\366\036\277\252\261\247\217\"\353\031\244K\352\241\030\310G\022\315VLF\227\360\320`O\307\236&\003E\250A)5\n\221H$i\264\260\320\032@B\206\252\256\007\021\340<f\024Sc\232\202\024*\313f\024\351\020\203E'\227\344\203/6"
+	.string	"\340y\232"
+	.ascii	"\277\367\"\006\333\f\331\377\037\202\n^pf\3453\0358\214l\001"
+	.ascii	"\242\207)\024\275\327 \\\221&6V\371\330\216\204\301\201l\001"
+	.ascii	"yZ6\360\360\343\203\211\025(\355\300Q\335\306\2269\227WQ\347"
+	.ascii	"\214_ \325\343A\206L\311\037\363\"sg\311\303\342\333\336c\352"
+	.ascii	"1\215\016H\344\312W\236\006\244M\347\221\270\360\337\244}\335"
+	.ascii	">\307\220\310\216\246j\230)_m\356\326\306\211\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`d\003m\t"
+	.string	"\202\313!&\220'I\007\377\277\337\005\375j\273\273[z\036b\np^\372\314\214\362\004-&\242E\326\374i\204\310\206\233\310$\003$/%\221p \007E\317\274\300\f\227\274q\023\203q\2015\245J\016\204f\203\025\245\032\211\324\306\236\266\001_\365\352\264\361\033"
+	.string	"S\036z\210/Z,F\260\262I\222l`-y\216]\275\360\n\023\324\224\242\367\353~\330?\2543a\240\246.\315O\304\262,\313\327Rx)\363\257\352\364K\204u\020I\250\301A\252!iIRm\200\"\2513;\022`q)\214BJ\226@1\201V,\250`f\313\263\276\325\330c&%\324\203\241\\\241N\345\220\254\316\251YE\363\r\002`\325-=\213\234\203\333G\200\txM\226{\n\206\367\327\021]\200\251\255;\300\357$$\375\236U\240\034\344\312\253g\305H\b\016\213\332\261E\035\263#\201\210N\207_\316\240\362A\022:X\255[\312\034\302"
+	.string	"\252\232\nkZAr\3158\307\344\242]\205l[;~\346Z\330\006+\202"
+	.ascii	"\2440\312\370\363R\2124@xsT\310\301-P"
+	.text
+	.section	.gnu.lto_.pureconst.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\231\004\001\231\004\004\230\004\006\231\004\007\230\004\b\205"
+	.ascii	"\004\t\231\004\n\231\004\013\231\004\r\205\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\035\005"
+	.string	"R\207\026\035\240)\303\001\360\377\177#\332\277\325\317\325\333\003\307\235\315f\262\265\356o{\357nD\312\024/\032\016\2059\361\211\260\360\243#a\201<\256\265\326\270\224\200\261o\245I`\262\2779tM\243\373\006\345\0310\227rD\225\264\341<4%v_M\310\330s\256\312Wi\350\352\363d\004\035"
+	.ascii	"v\030\214\321#\215\214c\301n\3346i\020\260\307\200\241\f\206"
+	.ascii	"\212\201\356\203gb\026\300z\241\217.d\204#\224*\204\2325S\005"
+	.ascii	"\260\317\020\341^\034\rY\205j*\340\242v\354\354\352\271.\233"
+	.ascii	"RYB\036@\021"
+	.text
+	.section	.gnu.lto_.lto.4fb20845f2bcf2d2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.40.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375 \206\375\003"
+	.string	"4\007S"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\264\317\017yw\250\357\006yu"
+	.string	"\005\001\006'\001\300\002\251 ?\202\210\2000sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\003"
+	.ascii	"*\342?\223\270\001\024\001"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.41.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"e\b"
+	.string	"f\220<90%'\035\200\365Xt\333\206\006\027C\265S\315\243Q`t5\310/\315\202j\t\222\220/A\300\240Y\206-bK\201\252\321T\213nVH<\254o\316 \373v\357-S\n+"
+	.string	"-"
+	.string	")"
+	.string	"\266\033\0346s\007(\210\223\003\002\263\263\373Mxr\356\312\371_]!F\307Ku\327"
+	.string	"\210\335\265z)\221\033\336\366\202m\221m\231r\300\306\340f7$"
+	.string	"\200\255\2214*\2667\033d[\325\376\312Y\266\253<,\260K\262\232\331\375Df\370\\\206^\340\271\214'\360\\:Z\002\312\356\351\236\337r\227\f?\345\322\231\246\367.}m\243C\357E\030B\301\316\376:\205&\366\343\356\256a\211\343U\277\006\244\b\216\213B\332\032e%\322e\222\260\260iU\314\013\213\t\323\264\260l\216\020|a\224\260\251q]\330\004}{G\3700r\202\037\376\250\302\177\177\t\b"
+	.ascii	"2\003\302\260wq:\036Z\355\202*\2446\2328X\354\264\363\t"
+	.text
+	.section	.gnu.lto_rcModeUpdate.42.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\325\007"
+	.string	"b\31778@o\323\001X\202\217\352\005\242\220\303\016\245c\216G(0\024\277\234\323k\256lM\303p\036\r\017\212\t4\353%\004sJ\003\200\007\335+W\366 \374!\021\332d\357\224\002\330\246\331\036*0\316\345\232\351`\021\331\006\242j\264JP\316\204fC\253\326\241\031\004g\024\230F\267,\323(\006\334S+?O\227\022Hb\330\017-<\t #?\274\211\307\037\371\202\213\367>}\256\372\264D,\033\036\240x\262\301O\224\037\366\251\335]\313\317>\351\217\224\200\210A\312.\307\351eKs%\004c\373\321\376\310I\272\223\270\017\354~(*\273 \203\027\256O\203/\250>\257\023T\237\356\354\226\203\214"
+	.string	"\223\306\211iw\251\024\275{\354\374\227\034\300\013}\036-\207\335u\364B\035\267\274m\005\333\r\266\303\t"
+	.ascii	"2C\363\f\f\217J\226\t\204`\310%\330f5%\334\341E;\311"
+	.text
+	.section	.gnu.lto_isAirmodeActive.43.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\215\f"
+	.string	"f\030WB"
+	.string	"\2216\035?\335\252\254\202J\354\001A\211\372\025\321\300\35311\264\220O'\224T\251\245\244\241ZOo\337C\312\334\001CE\020\376\211X]U\353\277\364\215\236c\005\351KF\224\002a\021!{K\231RE"
+	.string	"B"
+	.string	"D"
+	.string	"J\242!\322\022cw\204\251\207o\036\241\346\306\177\350\035'0\274\217\363hq8\304|\037\310\261\273\327\327\245B"
+	.string	"$\"<\314\347\201\007J'^<\364\034\371\272\314j\301\356:\275o\303M\335\266\003\333\006\3547\b\f4\270\310(}\224c\217<\251 \373p\265\304v\332r\272\322\3647\342\351\345'-vIN3vED1\302\366}\224\213@^\302\005RH\354\356\365h\203\330\327\343\355\020\373r\002\005!\336\b\370\004]\232\214\311\314P\366\204\017=J\207N9y\023S\311E\275\241,}\350\017\241B\305\305\013\251K\22372\3005\324S\316\302\0210\331\355\334\363U\276\242\371 \036m\201\313{\034\365\350\2130d\310{\226^\364\316<\270L\004M\363 \333\260L\002F\341\003\202\006\3136\016\363\030`\255Bf\303.h\332\206]\243\316\265\304\251\035O\210\340\251#\266+\345\350\250\307\251\225^\244F'OTT\320\365\303\212\211\024PA-\277&\013\026R\023"
+	.ascii	"L\b\230P\307k\231\0322\303\261u\352\301\006\244BD\b\230F\210"
+	.ascii	"\242\230\200\245\004\347\032Na\342\227\013\007P\341\304\317\025"
+	.ascii	"\241\371\252\220\364\332\002\005"
+	.text
+	.section	.gnu.lto_isRangeActive.44.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\241\002\215\025"
+	.string	"V\251\216J\320\322(\035S\202w\251\001\201\003l\2432\340\201Pp\336\3754\021\365a\020\2235\314*\317\336)\311\340\f\332\207\373\025\202D\203\007"
+	.string	"N\253\\8\245\036\206-\262\326\201\200\354\231\301\320rhu\350\332\217\036 \237\020\222\244L\001|"
+	.string	"m"
+	.string	"{"
+	.string	"\032d\243\300\031\001\254\211\023\356X\200\332\"u,\365\204\324\321_\375\251\361\347\354\271 \232\023\270\300\007J\035m\273\301\212\215k\n\374\345(O\b]\214\2469\201\256\237\320\232\242\310Q\374\326\254\037\024\245A\035\231t\206;^\t%I\350\230[Q\305\003!\022\230s\246x\270\275\210\240w4B\305\273\211\255$\236\036\032\324\275\341\351vQ-sN\357\216'B]\252m\033\333\017\354\315\021*co`\3111\ncV\316\211s`\025N\330P\246\320\321:C\352\250G\201\363\353\275"
+	.ascii	"\262\355\320\006\336\366>[\305\371\036\267\274F\321\037\325\023"
+	.ascii	"\005\252\002\370\232\345\365\352k\325\327&_\227|\235\372\232"
+	.ascii	"\344\353\221\257\313\257Q_\223\344z\374Z\374\372\343z\307\265"
+	.ascii	"\006(\260\243\033J\2611g\316\220\310\3341\026\251\260\235\262"
+	.ascii	"-\256\255@\001\372s\002B$\336\347\326I\256AM\375\020\036\245"
+	.ascii	"\336\272w\027\3446r\222\337(\327K)?r\322G\316G_\336Gg\210\302"
+	.ascii	"\241\236:\311\304bA\036uoN\310x\362\242\016\335\223m\207\036"
+	.ascii	"\264\006\254\234s\262Xg(\215\230_`V"
+	.string	"w0\244\216\343W\226\212l;\264\2506\"\177\361\232\353\335v\350\223\377\f\202B7\036BO\213cH\222\211\337\347\275\276\202\020\t\267N\2661\004\261\027\331\2136\322\304\\d\0222\304d\262\327\005\b4\035^+\303Tdb.\263\030\n0\232\013f\301%\203y\305\270`4\031\227J\212g\032b4\027\207\331\214\346J\001m*\316\367x\200R\216n\210D\211\240t#4\264\326\032\271\362\352n\261\375\206\272\317;&\320\025\025(\35376\353(W\035I\336'\026i\361k\032\337\243z\rN\220\020I\207\324\344*\275\241%79i\224\363\331\227\\W\354\b\35140 @\002B\220\223v\265\241\245\025\350\225\360\306\300\027\3576\366\326H\021\256iL\363h\213g\371Gq\216\353E\234\001\302k\t\276x\f\026I\023\006\306\311\214\350cG\244\301\223(e`\347\340\315\341u\306r\3504\f\332\342V\212)"
+	.ascii	"\204)\213\316\nYx^-|s\270RcF\017\202qF\026\037a9*\266w\003\312"
+	.ascii	"i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateMasksForMac.45.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`A\005\205\""
+	.string	"\206\276\332I\220\230\316p\005\227\354\300\272\003\177\036\034\365\217^M\264\207\001e\200\235y\221\240/\273\026\207\310\265|%\r\301\315\325\303\362\354U0V`\210Fd"
+	.string	"\317\233\002S\324\300\244\373\036\004\b\214\020;<\b\030\332{\357-e\222\001\310"
+	.string	"\270"
+	.string	"\305"
+	.ascii	"70+Qi\005t\336\375\326\271\202\357B\361\230u\305r\023[\327\244"
+	.ascii	"\201%\240\376\334\344i\320\237\352e\320\237\033\334\225\362d"
+	.ascii	"\326z\245\213\342\262m]\327_\323x\360;\335K\316\245EM\321\323"
+	.ascii	"l\016\356\215dJ5!F\246\357.<^\207&u\274\342\027\253\347\314\002"
+	.ascii	"T"
+	.string	"\214\260\035M\312\312\244\211\272\341\364\245\013vI\203\300~\262Q\265m\271\311\230j\361\026\237\214\251\252\253ZRU\234\036M\212\252\310\250Y\340\250d\305\316\330d\322\234\315\200r\260\373\264\244Z\360\251\262\270\2713\2460{\353\272\346\214Dn\223\007\353\205\333\31684{ef\305/\317OF\"s\032\264\256\353\262\223q\352\013\340\273Gw7h\327\234\0225\224kD~\333]\021\037R\244\256+\221\301^\310\320\b\325\006\n\364\347\033\b\312\312\221\253K\310q\273\311!7r\367\346\332X\273\315\353\323\274=*\257O\345\355\251\274<*\357\216\312\253\243\362\346\250\2748*/O\345\275QymZxkT^\232\224w&\345\225\371\217?\300\275\2760O\376\273w\375:\225WEyS\225\027My\317\346m\224\227O\336\013\320\3318Z\315\260j\265\344\032\025\207e5;\307p\334\353\373\257\203\355\346v\351@\226"
+	.ascii	"T\333qki7\367\363_n\016\301\202\340\275L\364\230\222k\024\202"
+	.ascii	"*'[m\353\232\374\371\271\016\366\307\020\005\234<\021Q\232\264"
+	.ascii	"d\032\247\265\250\342R\342M\363\032e\203\331a\3237\275\334d\245"
+	.ascii	"\246m\332\\R\204\313p%\023\324u]\033\354\223\274\214\302V\260"
+	.ascii	"\300w\262\200\376\254\351\005kc\346\227\fE\233\306\324\341\343"
+	.ascii	"k\250\006\3448\344\270e#W\316b\240\215\\\356\237\177\371\016"
+	.ascii	"\312\253b\230\tt\265\237fZ\246A(\233\020\371\355\302\221\314"
+	.ascii	"\364\200\265\203-\206\223y82\244a\277\001\375)\323\007;\327\200"
+	.ascii	"\312:\033m^\026\341\226\303\307<\234=\001\252Mm\230>\221\"\234"
+	.ascii	"\220\343\320\263\221-\234\262^\231\215\\\023h?\211a\356]\357"
+	.ascii	"~\020\342;u\277\fF\212f\332]\340\213\020q\277\310\032\377-F\034"
+	.ascii	"X7\362/B\337\035CG\017@\230KDG\351\b%\241\nCGB)P\310\250\027"
+	.ascii	"x@\211h\b\311\350\0030\351\007\f\361;*\0222\372\001\223\224~"
+	.ascii	"\007x\213D\202(\351W\002\t)\351\227K\n\337X\021\220\230\t{\270"
+	.ascii	"\363q\200\326\365n\260\307\203\263\231V\327\310\365i\230\276"
+	.ascii	"QAC\371\262\303)\004\t|\247M\200F\224v\020\0250\216\\]\271F\356"
+	.ascii	"NZT1\254\245GB\332\323W\330y\261\373\364\323\317\325\376\362"
+	.ascii	"1I\265\263*iO\\\324\237s\nt\237\257{\372E8aK#\263\360\310jS\033"
+	.ascii	"k{\315\353\023P=\224Knv\236\356\275\311w\232\247Q\262&\255\231"
+	.ascii	"\336\351\347\250\372\312z\243\"\2266ru\232\327-E\311$\035\346"
+	.ascii	"\264N7Y\323\221\207\3239\215\006f\250Q$\345\230RF\"\231\221\024"
+	.ascii	"\226\246\320\030P\002!s\314l\003\020`f\n$I\2061\266\241#k\363"
+	.ascii	"\350\357\036|+g\005\251\007T\0300\030\361F`\334\234v\354i5\261"
+	.ascii	"\330i\216\340\225\233\331\362\374u\231\354\350W\025\241L\277"
+	.ascii	"\006i\331\350\340g\322\365 \003G\224k\361\326vH[rF\211\231!\255"
+	.ascii	"\302\307\210\313O\254\312?q\013\2424\253\024\271\355Y\275\177"
+	.ascii	"\024\\\277q\216Kg\021\002\020\225\177[l\377\334\317\232]\300"
+	.ascii	"\311_\237\024O\013,\201\351{\346\374\030\332\205\b\327\031\263"
+	.ascii	"\315\f\217\235u\367\020\316CT\024bU\215#v\201NVf\222h\3766\206"
+	.ascii	"\t\022\211#p\266\001\357?\340\036\035K\313\377\346\351\325\314"
+	.ascii	"\2021\345\236\347|R\326\177\214\260.h=\274\365Bq\326\327\256"
+	.ascii	"\267\246\032"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.46.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\332\002\025\024"
+	.string	"\266$\177F\360\262h8\320\nC\263\340'Y\356AD\321\243s?\264\373z\036\020\232\371z\235\210F)9\330\274\222\255\214b\374\230\254\311\240`T&\264\214\\\361\201\212\n\"\224\025'\3260d\242\2652\r\335\354\336{K\231Rj"
+	.string	"b"
+	.string	"n"
+	.string	"_!\373\317\f\001"
+	.ascii	"k\313y\030\332\035\025\030\001\351\240\307\013\b\017\222\036"
+	.ascii	" <h\231\375\343c\317>g\302F\310hwSZ\342\262\223\304\020\3744"
+	.ascii	"e\276\250R\272\341f'\235\226s\361;\331!\"\307&C\260\306\204\243"
+	.ascii	"\311OT\321\271\311\271\242p\266\357dw\237{~\300\3252E\225\335"
+	.ascii	"u\336p7w\351\266il\247\330\212\n\266\006\276\013\f\032H>3\341"
+	.ascii	"\301\253\310#\352\375\320\362\310\036k\251<\366\277\335]\353"
+	.ascii	"\216}\240\037\365\361?\201\351\221\377\374\2450\035\202i\360"
+	.ascii	"K\177_Z\277t~\351\227\2108\274\002BvC\034\021\331\035X\343\204"
+	.ascii	"\355\373B\327\311<\310\212#2:h\313\330\246\2037\331@E\fr\214"
+	.ascii	"\371$x\332W\021\3123\343\240\276r\237>\350E1\322\r\n\240\246"
+	.ascii	"\020}z\342\345\350}$\251\212R\273\202\r%\311\324\223\332-\252"
+	.ascii	"\374\315\013H\320H-\341p\244\310\335\235\2519\204#\372\334IF"
+	.ascii	"\037\274 <z\330r\210Qy}\213\313\210\031\350\331\245\375\346\303"
+	.string	"x\f\226/\304\362\267X\250{\201\311\337F\364\272\257\200\030\352\001\241\321\231\355\326_\270H\273\00100\025K\007V\214\b\003S\261\270\304\250\304\225\252\245^\241\300X.\256V\313\352\225ZYH\305\274\250Z\251\325\013\226B1\261+\003\353\225\332\340r\275R\246\221v\335Y\031\261\243i\215t W\034\344o\376tv\217\273+*\217\023\005\016\213?\bC\275NN\207I\332\020\"\344o\241\226\350\212\354j\341\200D\351IKjK\230\200\322\365v5:\373\356.\030< \260\002\2311\272\003#\001\2573t\336\312\317^\361\306\033\027}\272\207\267\3754\256\253\346\273I'(\227\361\223\340rF\311\227yaH\321\303\300u\r\004\324\206vO*y\001\t\267;$\353\006\353h,\210\253 \025\252 \305M\365Q~\335K\2555\226\221\240Lp\232\r\224;14x\222\341g\3564\367`G\b\327\302\227mD"
+	.ascii	"\214B\\\302\003~\317\236\205a\236\366\201L\206\333\333d\351M"
+	.ascii	"\240e"
+	.text
+	.section	.gnu.lto_updateActivatedModes.47.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`w\0075'"
+	.string	"\252A\254\016Hp\334U\0070\212\276Q\207\356\247?kN\2402\201\"W\332\n\262+\255\017\205t\205\224\373'\005S\355\344:\004'}mT\021LQ\313a\322$\243\312v\342l\034]\031\021lI\\i\314\240\372\332\377{\357-\245L)\326"
+	.string	"\312"
+	.string	"\334"
+	.string	"\252?\326g\001\277\t\325\006\215\267\031C\261\264\275\215D\257\372P\373\252;\277g}\265\375"
+	.ascii	"\353\253@\3673\357d\356\177\301"
+	.string	"\250\272\324\366\336\273\fD\307y^;\337q\031\370;:9\272\034\216\213\273\265\354\252\352\214\201\376\254\321\373BA\276\020\217\301\337\tB\226\003\3530?G\267\2141U\"w|\316\314\230\324Ae\177 \211Q\007\306!{u\tc\252D2\337\325YJ-\307\233\031q\350\tn\250\302\374\327\020\343~ \255\376v\240}3\343\215Ob\264\201Y\326h\325\n\322\310\330\350\216T\272\247X\204\350\036\247\260\312\366(3U\"o\274\326\035\245t\020\330\343\252c\024\316\377\365j\017/S%\322\3521k\264\367vL<\"\337\001\274\373\213pw$\367\365HX\350\207V\036\251\211\245&Q)\255%\237\345_%8\334\276oY\211\376\271~\313\247c\022\335\233V\340':\206\"\211N\345\240\273s\210\363\322\375\177\214ly\361\354\303\035\350g\305\356\363c\357\355{\275\263\032\373\252\261\253\032\273V\261g\215\035k\354_"
+	.string	"\307\004\fP\233\275\213ml;\252\226\031\371\261\177\257\377\346\277\363\377\351Oo\305sB.5\367/#\353\2021\345\305\236>\314sA4j\017\346\356>\227\377\227\273T\276\n\360\275\034K\0334\266\320\327K\332\336\333B\373j\220\376"
+	.string	"\353\223\373w\275\024w\327_<\227s"
+	.string	"s\262\367v_u\177\341\356\276\232_\353\267\376u\367)d\202\023*\350\266\267\217(c\r\332\017\371\233\257\367\336\033\267\340\331\f\224\377\3535\233\2166S\311!n\303\312\033\2064\016\324 \257\332\274\034z\336\252\363\027y\273Da7lx\273bt\215\032\235\325)[\017\"\3175\226"
+	.ascii	"\376\260\177}m\330o\371d\367\fG:\350\027\037\203\302\305\306"
+	.ascii	"\332b\315?\030\347\017{-_\273\241\003~b\316\022\256\244\334\303"
+	.string	"\233\341\201(:)\203\206\263\313\243\315\223\246\252\223;+\377\323Hw\030u^:o\375\374{\321\242\260\033w\377\360g\274\241\"3\211\265w\324\2031#t\317\224\315+\003+\314\213qZ_\375\314,2\223Y\315\027{\263\020y\215\212\0073Bk\221\356\275#|\371(\222\377\220W=\251\207\237\330[_\365\311/\366\032\256$\245H\316\252\324\020\342\266|6\326\344\221=\027~b\351](1\261)\234\222\216H0%\261GO)zK,\234\\\357\0259)\221h\362!\365~\273^\211\035\323R\222o\327\3739\355\212\006x\223\n\245\337\216ES\323o\347:\205\321\267rd-M\230\207M\347?\224\336[I\341\237\377\357\357\244=\237\357\270\n\307\200\362\037\342\300'>\237\224\307P\262\206g^VB\334\266\223\363\2233\232K\364m\256z\363\255N\233\177\362\223\275fcBs\204\360\232\325\374V\376\365\t"
+	.ascii	"f\001\265\030\\M\345 \246\342\241\240\2015\205\245\326\234SB"
+	.ascii	"\327t\271\274\224\276\232\177/\031<\344%\2401\344\212;\023\026"
+	.ascii	"\342\240\232\277\354\021 \273\326\2328\0060\004i\2214\013\217"
+	.ascii	"\264\302\205\177\037\007}\023\245\212\272y\351,\332\r(g4L\364"
+	.ascii	"l\256r,+\033\200\226\250a4\346\214b\250fD$\214\246 i\f\260\002"
+	.ascii	"\021\242\"z\021@1d\212dD\024\2445\3327\373h\254\215,\2421\007"
+	.ascii	"\263@\001\223\347\231H\310^Z.\027m-h\241\266%4\214\245\b\231"
+	.ascii	"Yfx\355\\m=1\201\364\002\357X;\374\206g\317\013\355:F\f\234@"
+	.ascii	"# \031\"\210a\177\336_\202\026\337\372\370H\t\377\224\020:(\035"
+	.ascii	"\214\233k\f\341jNA\262\003LD\305\253g\330\235\037n\340L\341~"
+	.ascii	"\034m\343\001\026w\316\204\310u\252\323\361J\345\0020\362NCg"
+	.ascii	"\200d\211C\324\002\251k\317Mzx{AT\267\f\326\206\353^\230%G\325"
+	.ascii	";Q\370\211_\261\370\252\204,\341gLO\275F\377\240\360\370\232"
+	.ascii	"\210[\331\003&L\r\304\301\240\244\227\201\304\267\337\204B\301"
+	.ascii	"^5\247\234\310\024qg\245 =\262_$\272\323\306\020D\200\002B\220"
+	.ascii	"BJLE\200\356#p\223!R\312\030\035\350\007by\327\207Q\260\321\351"
+	.ascii	"\243\362\367$\373A\3559\211Ar\f\n\261\203P\310\027\312\267\212"
+	.ascii	"\356\263N\307\0237\005\230\366\332\003\236\347\260\326@\b\322"
+	.ascii	"\364\255?"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.48.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\373\002-\025"
+	.string	"\246'\213I\320\362\2501\300\203\247\332\352\020'\244\256<\032\370\"\234\371c\226\225\212\026r\232pz\203>\331`X\216\345\177\254\355\314\304\336\217n/\360\226\031\003\241\305C\301\256\232\241\202\305\013t\214\024\215\003P\3519\272\355\226R\312\224\002z"
+	.string	"l"
+	.string	"{"
+	.ascii	"\341m=\200\360V\301\202\030\327N\372\344\276\023QsDu/9R\023\016"
+	.ascii	"\360J\336\254Y\273\310\nm\245\263\346\313\\\254t\206*\304y\340"
+	.ascii	"\350\324\006U5P\357\335&\013E\316C\032[\0354\201\310\221\350"
+	.ascii	"f\352\004\002N=\005\216\316\254\365\300\316\223\007\022\035M"
+	.ascii	"-\331Q\242\307\313\317\033\035n\322\367>\231\224J)\030\272\234"
+	.ascii	"O\226\312\275\327\323F\327\341n\335v\220\355\025{\n\ttg\223\267"
+	.ascii	"I\240\207\2642\355\261E\316\373[\236\016_t\333:]\3554\265\323"
+	.ascii	"\263N\337\025\341RM\031\bro\356\312\352\352\260LB/\372\355{\303"
+	.ascii	"\215<bkZq\357u\331/}\322\357\331U\344\237(\203#\372\216x~\334"
+	.ascii	"{On=\212\267\267cl\227\3559\355\017\275E\314y\034\334\272\227"
+	.ascii	"D\216\245{\311\0046\021o\007\274$\022~#F\221l\374*=\324\344y"
+	.ascii	"\002bd\351\316\224N:O\224O\023^\203\tF}h,Q\372\246\037\263|F"
+	.ascii	"\213h\277\236\004\223Y\0311&M\001\376\273\250\244^\245;\267\350"
+	.ascii	")\255\004\342f\225\355\nG\212\231|\360\331\031\272\027\227\362"
+	.ascii	"#\033\346/.\264\204r*\200C\367^\006.\356\223\371A\267\236i\230"
+	.ascii	"\267\271\365_\302\333\323\227/`\373\261\340\331\346\025\225Z"
+	.ascii	"\342\215\240\001\266\020\273\013\204\320/\224\027\230\313L\306"
+	.ascii	"\362\242\215/\n#\206X\213l|\321^F\024\001\236e\200\321F\230\331"
+	.ascii	"\2146\272H\333i\217\353q\374D\177\020%\344Sb\371\265\360\345"
+	.ascii	"W\242\200|J\366\257\205aH\255b\243\267!\"\335\231\025\fE(\r\316"
+	.ascii	"\223[z\343_h\351ye\0207\253^\357\275\227\205\340\226\212\320"
+	.ascii	"\367^\255~\256hvn\324\311\211h&|,\254t\304G\031\f4 \220\002\241"
+	.ascii	"\232\254\003\346@\316\357\013\265\360\020Af\"w\3405\266%\tK5"
+	.ascii	"\277\242(\337U\326\270\001\354\t7*\007\201\206cf\3562!L\307\305"
+	.ascii	"\330\230c\270\210-CX\263\200&u\r,/\326@\3129\260f\341!\024\337"
+	.ascii	"\024-/\330B\313\"\220\320;Q\367%\241e<\256\025-\220\2067\233"
+	.ascii	"\256\013:\001\026,\200\n\013\301u\220Tf\262\255~\265\213\f"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.49.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\227\005}#"
+	.string	"JA\020\016K\240\326Q:\004\356\005\3168\005\246 \003\216\323\026\372\301.\360`^D\263\204Z\377p:0\270\004\370\263\333\367\261~\266\3005\230}D\345\213\247F\013\360\002<\205\325\340\303hz\327B\205"
+	.string	"\3034\n\323V\362I,![\356$\003\320"
+	.string	"\277"
+	.string	"\317"
+	.string	"Q|\334kT\300\267\363%\201\317\230/\355e\314\227,\304\\\345E\247\373#\216\243c\330\275\027\3271d,\340\266x\206i\241\333`j\264t\206\23623\246\264]\205\370U7P#\213\367\033\272\3156\211\260\025O\372X\330\006bGK~\334U\230\303H\n\276F;\321\322S\246$\025\237\331\031\244\032\274'}+l\202+][\016\345KQ\321\364gTO\333VY\310'}(l\003\242\224\214c\275"
+	.ascii	"\224\357D\225\315n\230\270\311\247\211\307\330\034#J\304'}K\026"
+	.ascii	"\300\013)W\207\3629\325r\346\326&\b\032Q\202\371\221\2603I^L"
+	.ascii	"9\326k\357WT\373\307\227B\"\026\246\244\340\253\314\301\275\227"
+	.ascii	"+\357\227t\006p\346/`\346\b\314e\007\037\276\344\036\016\365"
+	.ascii	"\274\227|\016\346\313\232>\327\313\256\337\226\036G[\300Z\277"
+	.ascii	"\217\3652\352\211\313\321\027\242:\366-*;\210\335B\346\342\256"
+	.ascii	"\316~_%\270\233\230o\320\3126g\345\032\232S\375\002d\225e\314"
+	.ascii	"\312\266\033\3175Z:{\361\214\332\312\347\313\312\246\255\\\232"
+	.ascii	"\225\255Y\271\313\312\325V\376\200\324G\022\034$\367\"\215u\271"
+	.ascii	"`\345\017\0337\376E\276\216s\201x\026\247LH@\240Y\232\204\361"
+	.ascii	"\257\256\305\234r\210g\261\354\007\025\251{/\026sz+\376\321\270"
+	.ascii	"\305\204\250\023\2029}\331\257\342\224\231\213\267s\310wf\035"
+	.ascii	"\247\256\334[\304y\311\270\363%3\2772\177\352D\241S\215`\364"
+	.ascii	"^\246}\003:yB\315\256P_#Z\0050\252H\347[\314A?\222Cm\024\271"
+	.ascii	"\221\017\346K\263\277\003Jw\331\017\016\255\\\211\024\253\034"
+	.ascii	"g\013\247\274\252\2304\3156\006\355\231\314ofw\205\272:R\353"
+	.ascii	"YwS\030Z\261\367\336+C~\3264ma\310\305(\270\253c\3349\226\232"
+	.ascii	"\206\230-\344_'YdFL7\361\261\216\016\275\202\326\326l\233\326"
+	.ascii	"h\367\230o&z\340\215\253(EU\254l\341o&\255m\315\325h\313\256"
+	.ascii	"\216\235\215]b(\331\026v\355\237+(EU\214\2311|\310\316\r\330"
+	.ascii	"\"8u\357\325\021\222\253\361@\212\n\233\002\362 :\363em'`\213"
+	.ascii	" \221\352\\\357\322\231\306'\274s1\213\270\217\234\351\304\351"
+	.ascii	"\336\313\200\307{h\340\274\241\347A9 \036\036\235\231\341\201"
+	.ascii	"\311;9@\271\f:\237\013;?\270\035\036\\\207\036\f>\270\235\037"
+	.ascii	" \\\216\r\353<\344~pA:\335\017.-\022\275"
+	.string	"\233XG\027\030Q\357z\266\0262\212\243v3D~\325\272\307\266\226\366\253~\206!y\324\0239\255{\277\23154\313\203\214=i\301\244\262f[\236\310\323\356\325\372\246\177|\t|\252T\265\026\326\230s\021\023\3475\315<\241B=\217S)0\243\036\nP\302x\244\2650\265i\376\022\b\350\t\376\022\t>\374!\377\202\371\322\006A\022\225\235\023\035)\264\236\324\265\026\247\016O\222\263\310'`2}\255[/.l\237V\214\006\362\200\027\260\311\354\2345[\331\254e\335\253g\367\245\274\276d\335\366^\267\001l\250q$\303\224RL!\221\211FD*\315\030p\002\2312\252\036\021\260\315\013hJ\n\303\236\001M\3523\277Xu\007QN^^\256L\367\034\363\002E\024\223\372H\2714?4\3158,\177\034\310A\350\307\023\323\245+#\361\231\n^\302mHgbs\307$29\214?\277\030T!\223K\256"
+	.string	")-h\333z\027J\206r1\240\006"
+	.ascii	"(\203\241dC\026HS\254\013\202\330\3720%\241\240\025o\036\322"
+	.ascii	"\017a\361N\306c[\020#\206\247\037\241n\374X\223\225\362\373\305"
+	.ascii	"/N\264!\"\355S\350\",x*\020\261\235\304\324Y\013\254\327\346"
+	.ascii	"t&\247\221\027\003\237\277\203\364#l7^\"\264&X!\315\323\2107"
+	.ascii	"P\244\352:\024\363\303\373\222\350\013\240\245\n\366,\030\370"
+	.ascii	"\264cXx\222\350(\306s\335\264\275p\275\3111\177"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.61.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`D\002\255\022"
+	.string	"&\241vI\320\322(\035\240\217'y\b\337\342\334UM\340h\252\f?DmLj\3510d\034\230\267\243\363\202\001\201"
+	.string	"\301\247f\273~\214ay>*\253\201F)/\342?,1\262]\213y\372Jy\372\243#\211\253\030\255\335D\356\224\002["
+	.string	"h"
+	.string	"^"
+	.ascii	"=.\251qE\324XJ\373/\316S{\217\313\007\354\346\3640\332\035\027"
+	.ascii	"|z\344\373\364x\003\246\317\357\005L\237\366]\330\246\325\270"
+	.ascii	"f\357\370\210b\237+\361\341g\267\273\340\247\236x\355*\275\232"
+	.ascii	"\377\242\203\314\330\274\\\001\330\214\270$p\357\004aw\375\221"
+	.ascii	"\270\347m\237\330\246`\313\025\001\272tK:\311\330\217`\037\227"
+	.ascii	"\206\203M\227\362\305|\037\006\315\217q\242\027\031\005\204\340"
+	.ascii	"\246\204\333\031\262\311\t\355B2\327\b\361@y\220n&\242 \026\306"
+	.ascii	"\204\221\352f\246\235[\022n\367\340\373<\220Q\23769\251\375G"
+	.ascii	"&\3622.\215\311M\t\267\333\035I>\335\340\263\312\347|f\3523K"
+	.ascii	"\t\330\230\234\220\002)?\322\036*>}\027\323\247T\020\233\032"
+	.ascii	"-x`\344\017\251:V\317\333\335\265\346\330\317\375\372I\313\217"
+	.ascii	"\377M\tR\204\334\354\322\374\360\2618\023\211\305\211\376\241"
+	.ascii	"\037\3516,\363\326&\243K1#\211mYJFu\330t\340\347\203|\243\323"
+	.ascii	"\260Q\216]\206?c$\304\356\006\267\273\250O\244#\230\267\266\r"
+	.ascii	"-\254\225(A\003K\024\303\f\021Zba\b\213j%\206\247\225\210b\301"
+	.ascii	"[\201\205\023d,\361\244\n[jU\t\214\265r\265*\250^\240\352\002"
+	.ascii	"(\252\204-P\365\202\201%\007\354\332\300z\201,.\327\013\224\327"
+	.ascii	"\034\247\334\310\001\243\036Tul\007\220RUm\026\006\371\0313\300"
+	.ascii	"\221\321\027\333*\307\261\362\355\3068\360\223:\264\3745 \200"
+	.ascii	"\002\031\233\342\003\nJh\222e\351\311\331\n\345\225\b$Q\030\006"
+	.ascii	"\376\366&Ja\274\"Mc\024\256\262\2475\255\207\227\240\020\250"
+	.ascii	"]ai\301\247\272\360$\260U\241\217kC\3400\312\035\002o.\340]A"
+	.ascii	"60\027a*Be`Q\363)\344\353\2510\242P6%\0016+\022\033\376\366\231"
+	.ascii	"\233[\\\370\210\345D\316\335\241\325\2021y\215YP{Ar\212\247_"
+	.ascii	"\213\307"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.64.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`E\004\225\034"
+	.string	"\226\363\264H\220\232Q:\001 V\315Q\b\374RX\025ge\b6\225'\254\204c\316\263\0262\r\254\310\355\026\320\377\255\363Eu1\234-y\271\276D\"\201p)\020#\0061(\351W\033\257\3544\307J)>\332/\371{\023)\223\f\233"
+	.string	"\232"
+	.string	"\242"
+	.string	"QPP_\036\224\227r\364\031\350\030\365'D\301\347\366\321gdA\371I[\346\033\215\214\025\307\215e\336\275\323\237\216\376\244H\200\255\006\2172\252j52\370\\\004\345\347\032\317C?\313\007\240\237\273o\262\273F7\366hW\315\215L\365\307#HS\274j\255\267\317\036\362\243\323I6\307\216\366\227\272,\211\b\343\224\223\210:>\207L\326\210B\322@\255\225F\fr\223\t\212`r\324\210@\222G\013\b\327\251\3163\210Bf"
+	.ascii	"\217\305&\324Z\267\334\361-\277\273+v\367\302.\351\"\2734\336"
+	.ascii	"\035\312k\243\274:\224\267Fys(/\016\345\245Q\336\031\345\225"
+	.ascii	"Q\336r\306\033\243\274T\306;e\274$\345m\031/\337\370\237g\247"
+	.ascii	"\347M\2556\302\336T\037\023\013\222\253\240\345\335\250\241\250"
+	.ascii	"\205\213\225gY\036Y\225\204A\243\202\335\345\t\0206\232\333\347"
+	.ascii	"\245\374Q\373\252[\005}j\233\270\305+hO\345T\273\264%\372\324"
+	.ascii	"\376\212\314*k\211\225\355\3611z\225!\262*\325\346\352\261\345"
+	.ascii	"\304\213\362n\217\017\321\253\f\335Xm\260P\222r\342%\201\210"
+	.ascii	"\367Q\214\366S.\265\2648\235\323}5,\016\2405N\323\256a\023\260"
+	.ascii	"i}\252\317&\2450$\260_P\326\263\246nlJ\312\226\365\362\220M\254"
+	.ascii	"\313&\261\220\300z\037\303\241\254\265F\330\213\271V\207\365"
+	.ascii	"\360\201\237\364\201~\306\332\347\f\026\362{E\273i;\200\022\005"
+	.ascii	"4\003U\004r\330\366\331\252\215\326\217\356\245\331d\2178f\005"
+	.ascii	"\371\013\304\261\372\300\231Sm\210\177\361\362B\304<\216~\222"
+	.ascii	"M\204\006S\321\351\211\273\233\354B\002\333\315\235\213\256\254"
+	.ascii	"5\ba\277\345E\211\275\221\"\372\311\235\243\225\305\344\351\307"
+	.ascii	"a\334K\333\261\223\265\203\004-t?;\013)t\273\035\316\004\205"
+	.ascii	"\026C8\035\"\335.\206B\b\207\341g\207\213\345p@\275\271\006B"
+	.ascii	"\272\037\036\220\210\\\357\226#q\333\235\300\001\335r=\241[\203"
+	.ascii	"\001\313S\241\353\335V\360x\275\033\355d\355 [a\207\230_\003"
+	.ascii	")\001\336\351O\275\313W`\253\326\337\223\366i\316U\301\202\317"
+	.ascii	"G/`\340'-\007\037\302\206\261\273\031\276\265a\247/u\376\252"
+	.ascii	"\361\246\350\364\324E\242Du\231\275\264\266\236u\021\215'G\254"
+	.ascii	"\227\271N\333N\346\265\326iz5l\232]\353'\341\021\205\004\366"
+	.ascii	";\323\327\232*\262\2276\247g\335j\216ab\300Y\250A$\307\214r\002"
+	.ascii	"\307\310\214\210\204\n\222\026\016\220\002\021\252\3346\021\360"
+	.ascii	"\271\272Zna\217\003\266G\023H^Hf\300\246\013\266\305*\273\374"
+	.ascii	"\220N\336\211\225\241\021,\260S\301\255\006\026\277\351\3204"
+	.ascii	"(|\"\177\2256\032\343q\021\f\251R\237\205t,\205\025\016\334\237"
+	.ascii	"\261\234\013\225\251\263\375I\b\2760.;\275\216\236\274\277L\013"
+	.ascii	"\255\200\243\013H~\334\365Eu\230*\332\267\251\317\3333\371\204"
+	.ascii	"\375d'\002!\202\b\034\277)\213\204\213\341\361\006\241\312\026"
+	.ascii	"\336d#\252lr\267,f\216]7\033\\8\f[t\207|@$\351h=2\312\326\b\006"
+	.ascii	"\323\3459R\re\316\202\324\003\237\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`5\002\365\f"
+	.string	"6\324NC \213L\007X\021C2\004ge"
+	.string	"\026\030k\003\321\005@\022\002@#\222\360\213\322\"\265\311g\210\006"
+	.string	"\227b\001`"
+	.string	"\202\201\256\361,\336\006\340oE\272<\206i\274\331\026\343\336sE\332\337\354\237dJ\0019"
+	.string	"B"
+	.string	":"
+	.string	"\035N\342\360Q\306E\030\017\311\r\007I\r\377\310e\205\232nw\345\370\260\f\367\310\336\345\372\022b\207\021\322]\370\3062?\216\225\302\256\357fp\361\344\377\377\342\001\344\356\266)%'!y\311\310\001\210\\$\344# \007\371\370\007\377\377.&\347\361\023w\272\363\340t\273\bV\007\f\020P\rX\tP\025\030-\327\004\234N7\025\324Z\0337I\361\025\013!zI\263\261L\250P\013M\2611\177\263)\257p6\337\300\331\374b\371\377\254\212\031\316\006!\354\327\0217\360k\256\314\270\0079\f\341\327)\346\b8\017\264\t\257\305p\322\264rK\220]\320"
+	.ascii	"r\243\300\355Kg\f\266f\026.\225\256T\013\332\363\306\301B\333"
+	.ascii	"\263\361\t\304\002\007\037mo\344\245\30160\230\264)3\346\017"
+	.ascii	"\035\032\270B\332\\A\332)\224x\241\355\311xc\377\317\263\275"
+	.ascii	"J1\003+ \260\002\251\263m\214v3\236\227B\216B\314{.\360\316n"
+	.ascii	"\013:C\263\214\177Etzh\310\321\372\0360G\275tpk\007\350\004]"
+	.ascii	"\320\r\272@\347\005\231B\226\032V0\234\037e8\316\fX\333\305A"
+	.ascii	"\337\220qC$\200\021\206o\370\215\365Gx4\21149\353\265\334/\004"
+	.ascii	"\303\243\204\016\230\023"
+	.text
+	.section	.gnu.lto_.refs.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375 \177\255\002"
+	.string	"\342\306\021\025\220\247\351\377\377\377\377\277\227+G\021\t\t~2\322K\232\224)\017X\n8\241\034\261L\204\364G\177\035\221\r\265\013\375\242\217\372\247_\372U\006\314gp\026\001<\361\263\013'\314^\255\354\025\311.\0067|\374\017\001\003"
+	.ascii	"5S\201\244\332\341B\311\003"
+	.text
+	.section	.gnu.lto_.decls.4fb20845f2bcf2d2,"e",@progbits
+	.string	"(\265/\375`\360\037\035\222"
+	.string	":\353\3543Q0P\322I\007\336\322\214\365\350\324d\f\343\235\314\215\340=\313F\326[VT"
+	.string	"\377\363\035^\233K4\341n\236\232[\307q\034\242\335\306h!\240\221\207V\300q-mQ\266\372\017R\024"
+	.ascii	"a\372\013\234\276\301a\372\013\017\301\262v\222\221D\020!R\246"
+	.ascii	"\272\002*\003@\003\fH\206\333\250\230`\253g2?\343\3009\360\030"
+	.ascii	"\216\336\333\274\367\016\3003|a*\323*\353\300a\270\r\301bh\230"
+	.ascii	"\355m9\007!I\3202l\f\367r\210\225\007\0079\304\332Q\006\261*"
+	.ascii	"\300<+\203\t:\377\361\254O\250\366\352\344@\305\230\264\265\372"
+	.ascii	"\201y\276\204\020&\211\363\001\304\317Kz\243c|\255\322\265m\223"
+	.ascii	"-\263\270\372D\350\264OLX\335\205K\021\253\210X\253|\255\023"
+	.ascii	"\017^\250\214u\345\261\177\240\216\357r\232;\267y\205\347u\246"
+	.ascii	"\205\253X\311\302z\214\205\367x\013\267\254\205\361\316V8\357"
+	.ascii	"j{\257\023fr\205\357\326\256\272\220\375A\254\205\325\270Ij\366"
+	.ascii	"d\333\256\270\374\335\333\006\235\265\360\033SI[/v)\211\357\357"
+	.ascii	"\336\373\363\323\363\363\363\263\242E\351\275\335\250\3479\226"
+	.ascii	"/\203Xw\330\006\026\215\355j\242=\320\230`\354\231\213=S\321"
+	.ascii	"\365\334<\235\341\360\324\352\271\211\275\201\247p\313s\034\345"
+	.ascii	"\354\306N\316\355\275\355\275\367(\244\260\\\316r\347&\351U\361"
+	.ascii	"\272\267\375\003'P\360\034?a\271\264\365\272Izq)\252\306\254"
+	.ascii	"}\001\336\333\366\374\374\320\240\205\345\030\\\325\017\331\223"
+	.ascii	"\3002\024\206\343V\004\307\375\004\212\247\313\263Kvo\253\203"
+	.ascii	"sF\354\214\231V\337\001{\026\261\362 \213Xo\001{\n\330\035\006"
+	.ascii	"\2616\363\254>\fbe\266\016\264\262\245H\2537\301\256]\001\366"
+	.ascii	"y\fbU\302d\214\226:qD/\333\275\355\007\032\264*c\314V\331\006"
+	.ascii	"^\302\255\031\237]=\213\336\264{[\234\224\371t\007\245\325\021"
+	.ascii	"\fbU\231g=\227=\007\313E\361f\317>\253\016\373\254o\031\304\312"
+	.ascii	"2\317Z\002\2053\017\354\230\356\001"
+	.string	"\374\255u\205\347\357\252!r?\037\211\363\271\036\315\317-\370\f\016\312\025\370\373\307\355\347\350\317Um?\217h\202\305\300\r\370{\204\237\025`\266\237s\254i\331;\226\263#\360\267\212)\377\245\364\374/\300\306\317Rj%\350\374M\343\352\337\311\237\241\230\234\370_\363\367\f?;\177V\372\271\3713\363\347\032?\337H\3739\306\317\313\237e\370\323\001~F\373\031\354\347\254\237\261~\266\372y\352g\036?\353\370\271\351g\246\237\227~6\341g\021~\006\341g\016~\366\371\231\304\317\031\374\\\301\317\023\374\214\342\347\006~.\361\363\002\377\305\374\037\363\277\357?\337\1773?\003\360\337\356\347\235\237s\376\253\375\217\373\031\347\347\376\371\346g\233\237\327\237\325\237\323\237\377\237\314\177\277\377^\376w\371\317\345?\332\377\240\377u\377q\006\007\007\007\177\365\357W\313\374\002\214\t4WQcn\034\253DI\223\361\275]\004\237\250"
+	.ascii	"Y)=\212\270\265\332d5E\276\256p\230\261I\222\264\030\273\274"
+	.ascii	"\327\013\340\037\316\222,oA\302\336b+Z\324\016=\365\b\333\325"
+	.ascii	"\325`]\372\322'3b\344\274\336`\375\245\223\004F\344\255\325\376"
+	.ascii	"\3526\322G\336_]\344\246\331_\352\275Lf\0229\314$h\246l1\321"
+	.ascii	"V\365*\027{1|\207\023\346\247\205\207\324V\333[L\306'z\235F\200"
+	.ascii	"\345a\361\002\274\027\252\004\016\0229\036V\255^]\006\351!AZ"
+	.ascii	"+\353\255e\343$\305\225\346\303C\231\035NZB.\244\253\370>\357"
+	.ascii	"\205\272\251\336\326\023UX\232\305'h\327\352\323-\354S5\366\251"
+	.ascii	"\255\236\372\307z/\267\321\246\347\205z\372\374\215\365\376\201"
+	.ascii	"\303\n\226\257V\373\252}\b\325\236\262\210\264\216\256\341\275"
+	.ascii	"\343;\272\212]\336\273lo\023\243EAA\371\b\367\270p\271E\277\334"
+	.ascii	"\334\002V\253%}~\255\266T\373P\275\240\334\220\362\321T=\326"
+	.ascii	"\220\264\361\265?\346\224\234\246\030\217\237drhi\265\243\210"
+	.ascii	"D\251\"\246{\320P\235E\231\364\340A5\207\205H3W3A\2424[m\033"
+	.ascii	"\212\317\374\277\3172)c\255>=\302>\215b\337\377z\231\317{\257"
+	.ascii	"\023M{\237I7+\3230\016\247\214\300MQ\b\271\367\b_\030\366\013"
+	.ascii	"\n3j\304}\330\275\313\017\267\275Og\232\325\322\311\004\013\364"
+	.ascii	"C{\253\006\270iX\327\331ZA\325\350\355\333^\276M+h\013\3166\372"
+	.ascii	"t\266\321\345\316mF\227\367\266\320\035'\033s\311\3164+\2503"
+	.ascii	"-\n\375p\233wy\323\230Ul3\nu\332E\241;\3164&\324\331\264\202"
+	.ascii	"~\350\342\333Z\272q\346\f\217\2578\233\227\006&)\346s'\317\331"
+	.ascii	"F/\337\275\314V\343>\021\270W*\372\344c\356`\270\244<\032\222"
+	.ascii	"\2340\243\034\202)\351*z\233y\316#\321{\217$\301\270L\020,\333"
+	.ascii	"\274;\204\363\226XR\027G\215{\t`\272w\3117\357\336\273\274\367"
+	.ascii	"\n\237R\355\275=v\234^LL\367B\3650]\251e\\\215{\233\255\013\034"
+	.ascii	"\324\231v\025\r\212SK\363\272J\355\222\275.\237\325\223M[\232"
+	.ascii	"]\034\367^\326\201\365\202\346\310\301\311\251\223R\347\n\262"
+	.ascii	"\273\277\373\204*!Tc\323\242v\345\331\366\263\223z\332\353\244"
+	.ascii	"\002\336\023\025\340}>K\274\273X&\313\262,\323jKv\323\324\244"
+	.ascii	"\025m\265\315\331\242a\310\024\216^r\266\037\270\331\345\344"
+	.ascii	"\254\325\266\3217\336K\355\274\275\004A\364^f/\351\004\336\313"
+	.ascii	"\324a&\301LB\035\273\352j[\325w\226R\215^\022\334Ck\225\257g"
+	.ascii	"\335\003\fK\233a\255\231\264\372\300\253a\252\231=L\367\345E"
+	.ascii	"o\212\375{\251\266Ey\273\241\325An\373\362\231\276\274\003\013"
+	.ascii	"\3464\333\353$@R\227R\025\300\037\0350;\202\350P\325\367\223"
+	.ascii	"=\013\006v\364^\266f\002\262\305\351\303fj\232\355M\253\331\323"
+	.ascii	"a\212M\211=\021t.\263\206I\251\332\241\3257\223\375\003)\330"
+	.ascii	"\230\020\360Y\245\306\221\247`d\310\310jh5\375J\263<q\234i5\345"
+	.ascii	"J\215@\255\230\201\322j\332\225zq\373\272\264\310s\344\224\232"
+	.ascii	"\324\265\372\032'{\031\370uk\272%l\353\361\306\274\237\315\\"
+	.ascii	"\326\025^ \020 i\326\323\346\245R\342UC6\026m\032\3624\253+H"
+	.ascii	"SU\253\251\220\373E \247\346\324j\032\304\207e\243Jb\005\006"
+	.ascii	"\013\3539hD\370\245L\225\236\017\037\251\325\272v\005\210\027"
+	.ascii	"\273\343K\314Fj\225V\251^n\030\fL\2437\314\247'W\312\330\263"
+	.ascii	"aQQ\351T\220\231\325\2300\034+NP\240RO\247\3040\311[\302\201"
+	.ascii	"+^S`\231\034OO)\017\336i\223\272t\375\315\221\351\320\221B=\345"
+	.ascii	"\201#\026G\244\255\325t\307\301\250c\2064\273\260J\354\241)4"
+	.ascii	"\325\301g\267\211\327\356\240\021\237t\207\246U_\232\343\251"
+	.ascii	"\016\341\r\033\264\240\255\246N\353\225$I\266|~CmL\322]S\233"
+	.ascii	"6q\340\212\313\204\372\314]3\200\200\367IW\"5S\005\b\021\366"
+	.ascii	"O\231R\246~\262b\347\336\253281\2561\241\r\366,\306=\367\336"
+	.ascii	"\343\266\347\322\245\036\263v\231\203'U\202\3753\333\222\322"
+	.ascii	"jz\243m\n\227x\270\261\005\262g\262.\355\245\217\255\370u\037"
+	.ascii	"Y\227\2770=\006\211\225\277\346\002\230^\316\203\332\271\315"
+	.ascii	"'`\376\310\232\375\245\373r\226\037\356\305\342\342U#\265\221"
+	.ascii	":\323\031\322\244T"
+	.ascii	"\211\333\264\331d\336[\232\257\351$m6\230\326\201\363\204X@\306"
+	.ascii	"\367\363\363c\263'\246+/G\355r\277\002\222\234+\226\370\245\267"
+	.ascii	"w\350A\316\203j\257\223\315[\036\031\257e\312\3446\275\357i\357"
+	.ascii	"e\013\201c\206\013\340\222u\360\314\r\334\215(\245V[\220\323"
+	.ascii	"\352\226\260\354\314p\333\201JF\004\271Z\3552\367\263\261\274"
+	.ascii	"\261\364)5\304)\271\243\302~\215\302~U\023\303j\371\233\302k"
+	.ascii	"\331\257dl\3775\016\3342\3209\264\226`\023\264/\366\314\300\232"
+	.ascii	"\016\0162\003\353W.\366+\020\366k\225\227\356K\253\022\006\257"
+	.ascii	"\217\345\364\356p$M\261#|\260t\226\3262\006\007\304\255\006\366"
+	.ascii	"\255\007B\226\025\267VU\376\224\265\363\336W\376\232\256\353"
+	.ascii	"\362bz\262o\274\266\362"
+	.string	"\327\344\360q51k\365\253\223}\337\271\r\206\341\321j\333\2615h\3120\340a\352\211\217\250V\337v\177W\351\272^Z\001\206AA2\255\236\217A\2548\314\2636]\320\233\n\336\r\177e\255\336\320\320\311\311\365\024&c\036\242e\224\204\264\224\367\024a\240X\231Z\024\23218\270\006[\361cJ\307H\2263\257VO\303\243\t\267\335\244\237\254h\357\322\005\276'*@\206\242\001.G\253\357'\177\267\265[\327h\341\216-[TZm'A\3577\033\267:\301\256Vy\230g\r\340\266j\030VM\255\327\330\373\226R\211\342Q\255\321`9\302\325fe\311\222N\253\271O=\033OTa4v\201tR\215\366N\313\371\242\203\fT\253}\306r+\031W\226$f:M7\207,f\255\026\230W\224\256\346\214 \225\2152\216\022D\243\027C\245\214\026\007\364\030\213He\022\210H$\303h\310X\004B&e"
+	.string	"\t`d$\303h<\032\205/\034\2210\224G\243\220\205!\321HU\022\223G\304\243U)\264\"\217)\334 \215T"
+	.string	"%\221D\027\212H\"\002\224BI\023\210GE%\233<\"\207\212G\353a\230"
+	.string	"**\262`,\200\210\224\241\034\022Y\020*\211\034\f\225\305\027@\306\343\321\321qH\204\222\350BY|as\030&>(\201\205\013 %\261\b9T\216\2101t4RAD\036U\350\320@:\252@@y\030&\212\220\200\212\220\206\21426P\022\2236F\026ZI\223\024*B\272Q\n\031\213\220h\214EH)\021\206bRM&\211H\"\242\241\220\006\322qHE*\221R\"\242\261\250h4\024\022\021\2232\324!bRx\244P\021\222\t\034\032He\262XD$\201\004\321\205\343\021\021)Bi$&\211H\021\222\305\0214\206H\344\005GDe\222\206\013\241\244\002I\"\242r\030"
+	.string	"1Y\304!\"\213\027$\213:&\334\030\035\217\030\b\321hp\002\213\022T\\ \244A\006!\264\020RA\202\220\013\026\037\016\303\304\f$\320\f$\317P9\314`\b\271\206p1\342\203\003&\224\310!\222\211\241a\013\344q\203d\214\344\260\005Q9$B\222\321\363\241\"\222h$\026\261\207 E\003)$\230!\274\004\0248@\201\003\353%\240 (\210\202\024A\354S\004\2451\222\303\026-\206\220\001|\210\210h\364b\230,f\200$\272\240A\013\0321\206\212\312\344"
+	.ascii	"\310!\214!U\231\024\212\221\034\036)\213\030\3148\276\270Q\n"
+	.ascii	"\235x\200M*\213/T\245P\212 \245\261(T\036K \"\3060\026\215\330"
+	.ascii	"\244P\221\310xTa<\026\225C\027\212\312\241\013B\020\205\210X"
+	.ascii	"\3148\276\020\022\261Xg\020\211\214,T\314\2201\324Q\036F\210"
+	.ascii	"\037\221\210H \345\361\210\004\262!2\022\205I!\022\214\210F\343"
+	.ascii	"\020\306P\216RH\002\245\261(C\210D"
+	.string	"T\272P\"\207\312d\r\261\3108D\322\020\205l\206\212E\307\017j\036\024\244b\204\t p\300\016\231H\022\211\216GBCH\240!\026\200\214\305\341\021\320\0202\td\242\347\016\bi\243N\266\256\232\232\264\232\326uZ%\265{Zw\017O!m\233\326\245v:)\223\320a\276\365\341\255j*%\225\222\322\325\364I\301MyJ\227\316M1\031\0033wC\031W\\\035_\252w'\204\255.J\232\265\316\020\266\203\235\\\n\206\363\267#\332\214C\313\311+\033\034\322j\372\226\276\245P\370\271\324!\201$?(\035>\177\372\344)\024\037\036\240e9H9s\242\325{O\200\024qK\255\230\017Kl\251\255\253n\220\b6\3015\351\037k\323\030\300\032l:X-4p\201I\327\322)\035\276\350\017\034\251Z\312cP\316y\231<\261\031\324\n\203\326j\222\247J\222\244h\351\336\315]\236\335&!\024*ZH"
+	.ascii	"\257\023\312\307\306l\311\354\312\222\247hO\317N\240\270"
+	.string	"\037\033\206d\217\331jj\366\264\205\272\223\373+K\333\257\037iI\256\3307p\366\004\265\341~?\342\207\003\207VS\262O\271\201\332\002\030$5\202w\245\227\324j*\366t\354\257\251\221\243\372a\025\025\266\027\345\365\304\276\246\211\b\221\202\222\250\202\2710H\"\231B\006!\032\231\221$I:2\n\020\204by\244\311\241\017\022\300\0255P*\246hh$)J\366\230\003\\\232<\203\214$\271\256iDQ\254n*\330\370\270\342\245f\300\3566\303\257\002\262\305\352Fua\233\365\013\301\003\275k\256\310\230\026K<-\017\314\277\314X\320l3*\320\332\265\307%\265\027<>\362\260\320\341\247\035\342\350\341\360\346\316\216\370u-)\332\331\270\206\347\034\204\2324\366\363M\3321\313)\305:\034\022)FXS\264\022F\375oI\273{`\241\332 (\252\002U\211\003c\340\034\2206\211\201\\\230IDw\240\226\226\n"
+	.ascii	"J\366vA@L\214Wh\336E\022\026\3223\026]Z\364\243\324\342\343\350"
+	.ascii	"\306P\031W:-\360\355\21668\313\363e\256\252\274\345\370|U\312"
+	.ascii	"\306\034\205t\301~\275\376\b\203x\251\336\243=\354\201\263}v"
+	.ascii	"HZ\364\273\265:\213\242\201\332'\022\212\334\307\222\251SX\325"
+	.ascii	"\217\345+6\227P\305\253\177i-\255-\032\354\350o\256\244\240\225"
+	.ascii	"\305\304[\311\222\271lm\272\251g4S\244\214\323\345\004\254^ "
+	.ascii	"9\301\240\333S\300\223I\bx\tFo.V5\327~P\322B<7\340\306'\226\376"
+	.ascii	"`\366\031\222\305\354\022\360a\005hD<I\027\301\216\237K\032Q"
+	.ascii	"\367\020\327\224U&\020\003\002\036\337\247\256\247O\213\371\032"
+	.ascii	"A\310\234Z\027\226o:\200\004\356\336\\\265\246h\304\305\273\234"
+	.ascii	"\261\217\301\332\"\004\273Q\332\212\277\216\222{1\3002\202\b"
+	.ascii	"W\215\377\305S\345!\323-\265\220t\275\237uO\222x\271\302\250"
+	.ascii	"\244l\254\030\334\263\340\026Jj\\\022<_B\330\237\023\373\220"
+	.ascii	"\372\201\223\277Sp;\251\264\276\352\321s\357\022\334)\r;\b\227"
+	.ascii	"\340\214S\273\337R\272\361q\201a\340!\354\330\267\200!\260\315"
+	.ascii	"\261\261\rrce\344\030w\343\2153\016\266\200xa.E\276V\355C\211"
+	.ascii	"V\315\232U\030\370L\350\364\377K\273#\017\001WE\367\356\261\225"
+	.ascii	"\t\264\2104\230\254+B\372\034\236\203kW\325*\345\"r\005+\274"
+	.ascii	"\f\253\341d\021\350\226d\220\214\204t\374\22010o\276z\221\260"
+	.ascii	"r\270\320X\001~\265\303\312\273f\345\272\354\330\016\322\265"
+	.ascii	"\342\301\3140\366L\236k\177L\340\351\025>!\340g\252\323\232,"
+	.ascii	"y\335\3254\025\223Utb\346\317\204(\016\306n\2411\020e\033\211"
+	.ascii	"w\020\354z\227&\020m\006 T\317\233\234T"
+	.string	"\332\236\312\306\306\205d&Pc/\306\b\336F/0\356\343{j\033wc\315\375\317\343'\267\337\316FZ{\371\245a?RU\364\033\300\230\257\307\321\347\262\265\306G\341\212\374\216F(\302\017 SKxRI\320\0237\264\216m\240\357\337$$\343tT\334\004\374\222\255l\0355\233]\356\201$\267A\267\205A\321\024\024\317\271\031\305l\214\323\314\001\301Ha\f[\363H8\264\327\354\214\364[^\001\264\t\321\266\260\027\316%Kt\340\024\375\275\r\243L$\200\035\374QmDz\235T\256\247B2\241c\305\235\2700\355\314\214\213}\311\336\261t\220@\331\371]M\214\251d-\t\251\222\026\217R4\201\254-\355\005\250(7,\376O\346$Bx\350\2243\255"
+	.string	"C\224\2017\203u\323\202L&\t \205\277f\207\356S\2153\300\302M)\245\367#QB\364\361\300\354?\312\262\274\203\2672"
+	.string	"\232>>\004\216\021N\222\373\362u\205\333'\b\264\321#\327\311\021\3731\273\37592\373\314D#\313uE0\004\250\300\rV\244\216\270"
+	.string	"d\224\310?z\006x\257k\367|\\\034!\n\032G\333\363\376c\001\254\363\340h\"\362+\025\213^\n\376\246o5\223\224\211\360\353;"
+	.string	"x\270\373-T\221\315\367\236\225\221^t\n{\303\271\226v\023\202&\331}\315_\261\300\017\314\200\266\266O\340\270\340rt\370\375\"\353{*I\2511\225\2746\323\340\256E\234\021A\0035C`\232"
+	.ascii	"\321v\030#Yr\007,\246\003Ha\310\201\306Kg\367\337\025\207\356"
+	.ascii	"\rF\030\330C\325M:\276K\257\347\r\307X\307\216C\336\005\210X"
+	.ascii	"z\357\363\177\253\264n9y\231\260\375\\\333l\002\2318\177\361"
+	.ascii	"\254W\271R\207\342\367\235\237\207l\326[\337\034\240#\177S\375"
+	.ascii	"u\355\317f\202\201\027p\213\311\236\364\364_pF\215mb\027*\347"
+	.ascii	"\255\235\241\346\306\315\263HGE\f\222\341\313\365\205\251g\222"
+	.ascii	"\027\300\205\374\206\314G\204\300\223|9pD{!\374\240\335\205\217"
+	.ascii	"'\374\"\360#\322\337x\177\201\353\216\340\033xA\244\313G\374"
+	.ascii	"\035\257\374\324\274\220l\350\213\362\021\311\344\232\306\247"
+	.ascii	"2\357{\352\350w\320\264\261\r\361ks\302\356\026\342\367=\374"
+	.ascii	"Z\325\235\202[\364c\375\212N\276\333\341\304w=\342J\267\265\305"
+	.ascii	"\325\270U\323\237\255\253\354R\376\020\307d\033\036;H3\313\323"
+	.ascii	"\344\247\034)\333%u\016\267\276\037\311\367\253g\330\275/\257"
+	.ascii	"\340\200\326sj\031\212\217\313\364\346\256\0360\030J\276\326"
+	.ascii	"\357\255"
+	.text
+	.section	.gnu.lto_.symtab.4fb20845f2bcf2d2,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"bitArrayCopy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4fb20845f2bcf2d2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,584 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 \306\345\003"
+	.string	"$\005\272"
+	.string	"\021"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\333\227\266\231\007\016\017\020\240\342\234\212\n"
+	.string	"\021"
+	.string	")\"\260^LC>\310A\207|x\016=\344\035\325\f\267n\236\253"
+	.ascii	"\337\233\333\343\322e\250ep\352\224\033h\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.63e7f35480867a25,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.14.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`,\002U\021"
+	.string	"6\237vJ\240\030\325t\300\212\f\\\353\013H\227]l\257\036%\361\225\274\n\257\001\257\003'a\2754\244\300\004\301\221\220 \375\277\375\200\005\331\234~\263\257!\200A)\020\352\343\377\301\361\346\005>\003\374\223\243\303\365@~\304\320\242p\240$\003d"
+	.string	"d"
+	.string	"c"
+	.ascii	"\253.T)\330w\013\216\235\351g\023\2524\373v\251\221\232\326\t"
+	.ascii	"\366\r@Fz\372\305\354;@OzZM\373\026\340\"\215\371\271\354{\300"
+	.ascii	"\2124fe\3317\201\024=\006\277\013\241\352\300\276\013\230H;\204"
+	.ascii	"\225\f\241\332\300\276\r\374@\350\315\037\201\203\200\347G\347"
+	.ascii	"\212\317\247>\347\255!TA\366\315=\314\240\b\001H\236\344K\316"
+	.ascii	"\344N\376\344Q.\345TL\257\262`\006\344\343\353\260\341\001\377"
+	.ascii	"\207\246`\307N\351\331\237\b\373\006A\241\331Z\250\036\204}\263"
+	.ascii	"4\331\275|\260oP\211\355e\255\t\325\353\330w\037\271\301T\b\325"
+	.ascii	"{\260\357\020\221\036\314\372\034\373\026\t\331\225\316\301\002"
+	.ascii	"\301)\255\030\354{\324\243'\346\354\233\264\003'\006\022f\344"
+	.ascii	"5/l\304'l\005r\255Ts\243\311\351j36\334\355&\327\343\2115\032"
+	.ascii	"1w\243\341\304\032\317F,%`\235\005\033O\274\321\351xb\013\263"
+	.ascii	"Rh+v\272\314K\342\223x\211\2378\212\253\370\316Y\274\305y\376"
+	.ascii	"\3420\036\3433N\3436~\3439\256\343<\276\336\307\177<\310\351"
+	.ascii	"C\356\363\"7\362\\\232\263U\371\022\215\370<KRf\212Xf\252.*\304"
+	.ascii	"\243\314=\311\326\225\221\225(\027\236\335\330}A0C\036I\024-"
+	.ascii	"M\026:\342\221\\\275n\210\307\3245WhY\242H\3542\357h\302\312"
+	.ascii	"\327\210U\267$\233Q-\362\246B\334\"S \237\256\024\310\252\263"
+	.ascii	"\004\031=Q \303N\027\310c' @C\"z\022\274b\316\214o\211\202\321"
+	.ascii	"\362 '\263\361\346\272\231\270|\232\007\212\034g\322\334\205"
+	.ascii	"\3620kc\272\003)\271u\362\2302Z&\231\317d\3462\331z&\266\226"
+	.ascii	"\311\3263\361\326]\231`l\3353Y\346^Y\023\310o\bE"
+	.text
+	.section	.gnu.lto_setArmingDisabled.16.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\265\b"
+	.string	"\206\020=9@\305(\035\340\355\316t\003\tcEZ1\366.\346\023?\272\244"
+	.string	"\233\312{\354\333\206\350\346Z\270\262\354\247?\031:\307\314\301\370\2410cO\022\341\315i\327\214\220-eJ\001*"
+	.string	"-"
+	.string	"*"
+	.string	"\360\004\3311{v\312A\305@\200S\213ew\243v\334{z\376W\277|(\3223\300aw\235\037\n\343\326\333V\260\335`\033%W\375P\323\231\351g\f\026\006+\273\027/"
+	.string	"\353\302L>0\266\237\366A\036\342]5\362ew\343\244d\227\265`M\340X\302\013\262c\001$\332\372T\240^S\177\3120]\344##\337\303!Q\376;\346\213\262cW\210U\213F)_6\213\224\312a\037\356\356ZSv\234\214\304\006z\3238\235\315\207\333\"4\236\016\350\023\352\342\266\211\237N\306\023\267\216\"j\b\346&4]\004q\\\0271\254=\\M\371\001\345*\251\311\251\001\f"
+	.ascii	"2\241\323/0.\020\0047)&Q\031\032Q\366\021L\271\004K\254\246\204"
+	.ascii	";\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.17.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\r\t"
+	.string	"\226Q?9@\305(\035\240.\220\360\310\fq%\341\331\214B\230\364-\345v\371o\026C\375\244\376\217\350\346Z\270\262\354g\1776\3150\342\260\230\2033\366$\231\367\255\257\033!D\312\224\002,"
+	.string	"/"
+	.string	"."
+	.string	"\307\256\013d\307\374\331%\017-\366\036 Iu\262\273Q+\376=?\377\033\257\200\245\320\223\242\260\273N\260\024q\353m\037\330N\260\r \366S\377\225i\325tf\372\224\354$B\260\332\205h\005X\026\026\202a\261\375\264\237q\215\357)\220+\273\023+\220\335\020\301Z\3001\203\017d\001*\320$\365\252z\222it\216w\200\374\013{>y\360\230\377\311\216\245j$\246K\257O\231FH'Q\266\3540\224Ja\377\332\335\265\242\002\231K\003wy\3232\032\216\323m\f\230\215\246\303\361xq\343\"Gs\331\304\315{\210Z\201;\007\214\027;]\347EK\270\277VQ^\220`\211td\325\017\r\r"
+	.ascii	"2\241\375/0.\020\0047)&P\031:*\033cZ\020`\326%,b5\032\334\345"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_isArmingDisabled.18.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 \375\355\006"
+	.string	"2M04`m\322\001@\203"
+	.string	"'\337\231\342\202\265ppY\237'\275e\233\202\005tk\350\330\201\332\325\270*\300\267\233\203 *\326EM\320\320\031\275\360\330\022B\244L)~\025\006\353r\301\247`\301X\231K\023\335\273\270\313Z\300\270\027\035\\E\300\260\301\022]\006\302\350\252m\257\"\325\001\217~\354\027PW\325\203F>\357\270\207\306\307\360\303&\237}\3627\324\247+@\204'G\366\326I\255\260/\255\212l\2475\323\227(\215\222"
+	.string	"\220]mt\262$\223H\206m\216]\371"
+	.string	"\201c\354\333\205v\n\r\364a\262\2739\2658\366\304\374s\\\332\220\b\311B\235'%aw\235Y\b\342\326\333&\260m`{\"\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.19.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03`m\322\001\300\216\002rB\223\315\342\216\266\002\325\252m8\2079e\205h\026\365.\300R?\035"
+	.string	"\337\362\027Ee\301\242\t\346\275\3620s\030\367\336R\246\024\226,\013\023\206\252\244\204Kf\322P\016\026\2240\220\232\0242P\262\032\240\245\300\025\303\305\202\232\252\262`\024\367\nJ\255x\024\302>\310\343\345g\370a\223\307\356\374\315\273K\r\240\360d\310\216\235T\013\373m\025d;\235\372>J\bLv%B)K\342F4ls\354\310\347x\007\307W\213\030Y\024R\021!\202\262\033a\345\003\357\256]\340\335\351\305\257\347\345\337\343m\343s\202e\235'"
+	.string	"\302\356:\261l\342\326\3336\260}`\373\023\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_enableFlightMode.20.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`\034\001]\r"
+	.string	"6Y[D"
+	.string	"\221(\035{\f\321\353}"
+	.string	"tc/\267z\201P\323 \367E\265F\334\377H:\017\323\202`\326\232\241\206,\020@\274Q\254\274P\341\223'\322\377/\271\022\302\031\261\245D\351a\205l\033%\232\354-eJ\001G"
+	.string	"E"
+	.string	"D"
+	.string	"[z!4\\\337\bn\345\306\256\227\rx\201\3531O\340zT\020\337\01657\377\337!\t\024\031\035\252txr\205\233\027+N"
+	.string	"\352\004=R\035b\376=1\240L\231\035\rv\327\331\2416\334\361\266\035\330f`\337$\252;j:5}"
+	.string	"\027\353\345"
+	.string	"\314n\206\026\216]\305\026*W\3756\311\377\254\361U\033\266.\030\367\251\324\330\365\020<z\001\226i\037\305S\220\356]pf\367\003\f\227]O\2019\330\343\006\332\366M\374\004\311\001\255\026\325\0245`B\343\233qJ\226S[\336\331\210zM=wb\312\226/\275B@a\301\345\370\312Y6_\204GH\362\335\243Or=F\325\027\0271\034J\262e{\245\324\024\373p5e;\235\271\367_\017!\235\007\022B\264\213\302\250\003\202\366p&|@B\232'\302\007\350#\022\032\021e\036\220,\364\351\2002\217h\224q<\254U\370\020e\"\232&\3124\336\036\256\2462\272)Q\223WdTU\304(\001\261Lp\333\302(\3379"
+	.string	"\013\314\352\244\245\263<\004\027"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355\271\220C\334\f\"\315\032M(\226S\347\240]@J\240"
+	.ascii	"U7M)\024\024"
+	.text
+	.section	.gnu.lto_disableFlightMode.21.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`C\001\025\016"
+	.string	"\266\032_C"
+	.string	"s\224\016\233\bV\352\370\036\2247\3501\031\272\021\330\271\367vz\231\326\200GI8\253{\267\326\2545\344\230\200@Cg+\265@\250\333\375K\273\352\225PBx\t\205\nZ\032\353\005\355\304\022\262\245L)L"
+	.string	"G"
+	.string	"H"
+	.string	"W\361\025#w\t\266d\300B\031\236\013\220]p\023\360\021\354W~"
+	.string	"\366KC\274{\324\354\374\207\217(<\334\370P\244\307\r\327h\200U\343G"
+	.ascii	"\324)\216"
+	.string	"\254\214\370\036>/\240L\231\031\006\273\353\374P\032\356\353\266\033\330^`\337D\326\034\3743W\335\230\246U\323\251\351\213dN\300\020\330\261\273\322\022\262/\227\r\022W\375\366\310\017\255\371\252.\333U\346\2054X\273\340\201_V\220e\332g\361\026\243\203\026\f`\367\003\216\325.\230\300\233\354\027I\264\355\232\302\220#\344q\312\030cz\325\324\251\032\343\237\217R\266T\365^\312\224-_S\357q\310\350\365A\207\2267\344.\177\321\371\"\234\242\222\377~\371*\330/L\025FG\220T)[6HJ\005a?\256\262\330\232\326\234\001'\034\007\021N8l\202\210\363\211\356l$xL@\\\007B\311\307\203\002J\tm\035\223\r\344\341|\266NH\264m\n\230\243P\022\332P8.\264i\340>\256\262h\224\244\244&\317\320\250\272\350\221\"f\211\340v\005Q\376\263\b\214\022/'%\275%\206\265\322\016\323\002\032"
+	.ascii	"2\241u)\260\206\303 \270vp\2253\3626J\002\034X\314\226\312v\276"
+	.ascii	"\267\326R\n\021,\006\004\303t0 \225I\026\325\210\013#\346\315"
+	.ascii	"6\322\354\326\204b9u\016\332\005\244\004Zu\323\224BA\001"
+	.text
+	.section	.gnu.lto_sensors.22.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\265\b"
+	.string	"vQ>80\305*\035\200\013\313P\b\352\325\213\013\344\020\003JEj\264\220\311K4\243 \302Vw\003jc\304\270\370 \0023#\"\3000\316f\027\227\243V\344y\375do)S\n."
+	.string	"."
+	.string	"+"
+	.string	"\002\330\241\023F&\235\263P]\342\205\372"
+	.string	"\260\313E\2558\351I\362\317\361G\002\321\245V\245\347Daw\235\251\325\303\255\267m`\033\301\366+\232NM\037\233\270F\bJvU]\200\025\201 \031\266Gv\305v\246}\215o\214\336\022\231\262\033\201\341\332\345\016|\t8\264|"
+	.string	";|\017\250\220Sv~zM=\212uz\307=D\376\205A\241|\352\320\017a\207W\n\313\224\235\315\225R)\354\277\335]\353\204\341[\377\013\r\036\f\3479\2730l4\035-[\310p6\237\016h\213\231&v6\030N\3146O\274\024Xs\310l\361\243i[\254p{C\265\230\364d_\204\245B}\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.23.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\315\b"
+	.string	"\306\320=:0\345(\035\200\313\024e3I\226H\246\001+\213\262\205A\323\262\003u\226\223\241\f\326\032\366\007T\213\t\266A\306\206.%\005\004$\0250\003\030\303zH?\212>\331{\313\224\002*"
+	.string	"-"
+	.string	"+"
+	.string	"\002\327\245;\273\345_\306^\204\345D\002`w'\304xw\355\374\203<\343\241HW\214\302\356Z=\324\304\ro\373\300v\202\355\225\177T\265\252\372\027\346D\205 eW\242\025`Y\322dCc\373j\337\343\037\335U#gv-:Jv?\004c\001\227\006\037\270.\343\003\367\\\"<T\370\023\205\351\253\207\214|\rG\210\364\336\245/\272.\017\345\352\205\243\242\244-\373#)\274\260\037ww\rS\366U\001\016\240\215':\303\032\264\316g\313\0308\036-\364\201\340f\326\231\037m\343\231\031\007\232X\201\267\007\0167C\333\306M\315\267\217\013S^@a\225\240\311\nG\002\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.24.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\365\b"
+	.string	"v\221>7@\217\322\001X\264\"\340\244\344\300\377K4`\255\370fd\026\023\234o\311Q\353\177C\374q\331\224`\217i-\231\3143\272\341\360\375\300\352KoJ\352\307F\b\2212\245,"
+	.string	"."
+	.string	"-"
+	.string	"Z\366\200\355\232?\033\345!\306\036$%%\002\333\335\250\027\377\236\237\377\216c@\225\351yA\330]'\250\222\270\365\266\013l\037\330\206\005w\375Y\2465\323\231\351_.+'\232\221\335\210X\313\2764\223\215\214\355\247\375\3269\276\273J\306\354V\264JvC\003o"
+	.string	"\256\021\\`{*\251W\325\247V\250{\374\243\344k\030\202\224\007\257\371\244\355Z\352@\306*\323\253\002\005Ij\342\2241;4\245Z\330\317vw\255,;\r\"\016(3\267a\370xB\035\267\320\001}F\241\007/r\236\030\372p@\221\363Dq\243q\347\320\361\342\250\353\274\230\t\367\331*\313\t,\257\223\242\254\032r0\r"
+	.string	"2\241\371/0.\020\004\027)\036\300\320P\331"
+	.string	"\323\202"
+	.ascii	"\263.a\021\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_sensorsMask.25.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 \370\305\006"
+	.string	"\022\315/3`m\322\001Si\036\270\005\r3\202\247\326\340]u\b\237\013\236\254\020\315\242\336\005X\352\247\003\340[\376\242\250,X4\301\274~Fd\007${o)S\n\226.\bS\206\252$\003\214f\332P\013\026\2242\220\232\0164P\262\024\340\245\342*\001c\301MUY\220\022\367N\265|\264\301\276\307\343\345c\230\201\223\307\356|\316\273K\005\210\370d\310\216\236\324\n\373m\225\302v:5:\031\251\220\354>\204@+\342B2lwl\212\277q\216\216\257\026/\262\367\001r"
+	.string	"1\331\215\320r\201w\327\036\360\356\324\342\327\363\362\337\361\2461Q\202e\236gT\260\273N,\203\270\365\266\007l\023\330\226\b\b"
+	.ascii	"2\003\3020\021\341j\327\304\333\b\234\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\375\004"
+	.string	"\202\007\034%\2407\035\330\367\377\376\370\\\374\025\372\365\265\367?\377\350\377\377G\273f\335DDh\251\211\210\310\254\275\374[\312\024\016<DF&\2118\245\241\0031[L\036N\333\356\332\206\t\366\002^\315Z*F\251G\247\023\244c\356W\344(t+\237W\017\3414\332\234b>-\227rp\227\315\306\267\002Hmgb\033\366m\210\002\001\273\273\312\243\264\215\207\022"
+	.ascii	"5\033j\263.\303\345\007F\003\271\261\262k\230\301\001\332\201"
+	.ascii	"\317\301w%\313\034\033\350\ft4\214\240\001=\3007v~D\204Ve"
+	.text
+	.section	.gnu.lto_.refs.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.63e7f35480867a25,"e",@progbits
+	.string	"(\265/\375`\343\0165J"
+	.ascii	"\n\202D\034T@\020JJ\007\355\313A\304\2353PV\331\276\034*\027"
+	.ascii	"G\255\365d\321\375\305\007\312U\327\347Y\221*\004P\334\272\n"
+	.ascii	"\026\3775\023\300~fP3\276\210!\351\b\343\306\346\003\366x\216"
+	.ascii	"\305\321\016=\230\354\363(4\323\256q.\267\213\245\214\252*G\""
+	.ascii	"\265\233\224)s\001\256\001\271\001i\335-\354n\031#2\355\226\312"
+	.ascii	")f99uG\241pj\244\320L\251\233\233mK\216E&Urg&\306\314\352\030"
+	.ascii	"R\341f5\233\322\2102\205_\335\324\335\253"
+	.string	"\005\315:\322\220\205\353*\331\262MY\354\222\257\331\376\360\230a\332)\357\220\033[r\315Y\236\223O@\277,N\335\334\334\2628{6\311\f1\305\231\261\242\005\207&\327\217\200\216\355\221\032'!\214T\341\372\013\320\2615\202\256}\311q\306\365\r\240\377\212\365\330|\261\202\264\025\306\002%2A\322\305\314\355\332\245\256\330\224\354fw\252\023\263\2042d\310u\211\254\327\246\273\374\367k\301^\301\222\315\354NmtC\033he\\U,\317Yw\347\374\026\271\teKpF\277='\316\366\234O\227\347Dw\347\344\225\213\213\371\267\313r@\304\333\224\1777X\r\376/0\363o\020W\352\277eS\306\300\320\270\026\350?\213\377`\347\277?\376\255\3717\203\1771\370\327\202\177+\370\367\347\337\t\376}\361o\004\377\272\370\327\347\337\006\376e\340\337\005\376U\340_\004\376]\361_\347g\002\376-\340_\024\377\006\360/"
+	.string	"\377\332\374\373\377r\377\343\376w\371\277\345\377\333\177\267\377X\376_\371O\345?\332\223\377?\374O\362\377\310\177#\377\303\3763\377/\377\013\360\377\354\177\315\334\334\334\334\277a~N\340\247\321\n[m|\342"
+	.string	"\232c\b\017e;\320\35729\211 b\261\260\330\262\307\333\t\245\r\b#m_,\313\204\257\232\224\245!\301\242dR\223B\255X\331+&\262d\220,\221oh\022\035\300(]i\312\270\r!\005\n\3273\021\225\"e\251x\220\366\323R=1!\331L\016\207\331\341\276TVm\346G\020\252&\256\253\306;e\327\276j\233VCLW\255v\017wW\334\354\256\210i\322c\270<\3537\t\364k\004\212\206V\301r\351\355\306+\365J\022\002\375\n\261{\366M\367l\233\036h"
+	.ascii	"&\356\255\215\251\003_1\364\273\315\363\013\3046\371:I\327\311"
+	.ascii	">\331\250\026r9@ye\t\316KGE\365\224X\003\203cr\335'?\004\022"
+	.ascii	"\334\255\246\273\253\273\013\330\271)aQ\270\036n\2335A\224IZ"
+	.ascii	"\270~\213\350\371?{h\354n\250\230\264\215H5\347\306\354\366\374"
+	.ascii	"6\253[\004Zw\2340\335O][\320 e\303\033\270\376W\321[\335B\235"
+	.ascii	"N\333Xd*\205\3050\265\243N\332S'\232Y\325\305Ty\254\311\346N"
+	.ascii	"{\233\250<\266PL\223\306b\232\024\34641)\354N\2179\305\346P\270"
+	.ascii	"E\246\362Xd&\217:Mla3\207S(1y,FI\036s\212\314\341\261HT\036u"
+	.ascii	"f\350\242b+jQC\356\217\"\261gpB\016\2159i\3054\331l\335\333T"
+	.ascii	"j#\002\335\310\244\221mxc\227 \245\315\200\224d\230\334\264\273"
+	.ascii	"\005pB\242J61\255\250\225\354\326B\242\321N/\204iZ\357\260i\302"
+	.ascii	"*d7)u\017\340\324-\334\016VRS9\226\270\236\255\2303Jt\\\275q"
+	.ascii	"\345\252\3359\007\005;\252\206p\3251\225\222&\311\030%\211\353"
+	.ascii	"Y\371s\222\247x\t\205s\016kK\023\327/Y\236\263\304\356\234\214"
+	.ascii	"cw\316\201X\343\210\017\2563\273s\262\024K1r\301\372\t\205\020"
+	.ascii	"\243\332\226\227\356\250\036\234\251f\362\205o8#\357\026\303"
+	.ascii	"\365Cz\203\241b\250\270\024Q\266\005\3759\212\243\316\260-\034"
+	.ascii	"N\274\304A\261\002bi\303\006C]\327\215\203H\226N\207\324Y\224"
+	.ascii	"\017\350\031j\271F\3125\030\n\005\005@\274\336n\236\230-9\202"
+	.ascii	"\007\372e\250\223\237\330\270i\n>\332$!$\2118\256\327U\241\337"
+	.ascii	"\024\347\316m\212\363+dy\270)\017\331\311\203\264\2051\222D9"
+	.ascii	"@\323\243\212\212\214\353\331\351g$&rSM\262\233\330\335'tH\f"
+	.ascii	"\333\214\340&f\302\341\252a\305#\355\2321\213\343\241\006\256"
+	.ascii	"\\d\031\316K\034\203N\b\306K/\222\335C^\302\t\323=\304\331]\261"
+	.ascii	"\273\242\016\241\302:r\326\353r@9iwV\3329\215Qi\343\320 9\223"
+	.ascii	"\303\342\272\263;g\211^"
+	.string	"\236s\223\272\":7\307m\"\214\215\r5, \334d\2726\037\322\260\302\310\311m\034\232\323HkGd\255\023\266\245\323\021\350\227/\033\207.\333\230\2205\210a\021O`\276qu\255\210\0256*\350\027n\267K\227%\253i\037I\030cBz\341&dg\226,\273\005\355\274Qe\b\245\325\362\335b\003\027\226\346Ev\016\361\024\006\f\031\372\366\266XtkH\230\220[4JMM..\364[\304\256\3337]\267e\302\251\212\"L\310\247\321\302\307\327;\001d\201\307\313\340\310\327\013\n\031\375\200~<\026x\274\024N\234F\013\020J\370@\206O\220G\364\023\n\252Xa\310W\004\304\373\371\200\214xA \f2ph\202BA`\211`\320\217\314O\210\306P\005\362\214\204D\b`\005\240P\b4?!^\021PM\220'\243\204\214\0317\300\237\017x\304\003\312\314\320\3019\342\345\020\361\024\371|\031\004\305"
+	.string	"{9G.\354\230\370\001\367\261\300\373\371\004}\276\237\017\315\f\f\202<\240\316\207z?\336\021\217\b\375\013\030\017\300\370yA\346?1\\\304pq\376'\306n\027\003\306\016=\214\235.\030\004c\027\f\202 \202\340Q\317\005t\206/\204 \r\242^\221\n:\274  \221P\021\007\274\242\024\204\200=\r\210\216zF?!"
+	.ascii	"\276\333\001\2510A\204\016\320\241\026D=\025\216|CA<\243^\360"
+	.ascii	"\310\205\237\317\220\n>G=!#\237\241\037\320\247\205\001F\226"
+	.ascii	"\f\035sKc\022c\344\215\027(Ud\bcr\336H\212C\302\334fOm\t\324"
+	.ascii	"\022\254\302QA\243\201\353\031\354\347\036\370\253\212\222,:"
+	.ascii	"\270\376,\317\311>v\347\224\211X\025\257\212x\331H\372\262\201"
+	.ascii	"\353\331\353\347.&b\203\004R\225\203\353\323\226\347\254\031"
+	.ascii	"\262;"
+	.string	"s\305\330p6\265\203+\215\220\255\240\343\017\336j\336\310\365`\222\302\225{\330\235}0\200\254\211\031W\031\036\264\256\210E\031\343z\326\372\231\007\007Q\202\026f\305\265\347kw\006R\253\270<\001\371\221\005\327F\025\003\327s\326\317>\030\253HTjqu\261<\347\311cw\356\241c;\232\325\3005f\007_}\025\271\034\341z\276\372\031\007\357PsU\003\rR\270\276\311\265;\353\300Y+\203\363\241C\201\033\250q$\207\224D\206dfDD\222$I\007q\005\204 \b\245\264\003\021\020)\264J\210\024$M\n\373\034)y\360i\312\245\350\227\3650\367\2618H\216\200\322\260\252PQ\317\0022\273\017\235\231\2004\277\231j\217\303\035\275\331 3\031\2339\230\2061\352\361IyV&~\230\306'\252\221\311\373\024{\363\243f\341mMkcc\n\316\200\005\200\177\220\306\333\235\301\r\264\374$G!\342/e"
+	.ascii	"\"\210<`.\265f\247\221\270\f\202\f~\315\277\260xv\324K\343q\367"
+	.ascii	"s\203H\030\023\017\030\377\305>\317Q\0342\362\201<\003\004A\303"
+	.ascii	"\200E\322"
+	.string	"z\235\206\310\325\b\262-1\367\374\254\251\355\321\032\235\306\336\024Z\314\346\\\355\264\r\300\222\361\261p)S\342k0h&\351\367VH\303`G\227v\033=\243Q\252\342\367#\324\032\301\226m\276d\235lYt\304\t\026'\177\351\251\r\207\tyqPzq\254Q\300\f\345\251ZX\313\036&>\253\360\247\252\026Se@\265\261\350\341w\037~\370X\322\034T\3554\311M\324p\335k\3624\370\006\210\240\013\3307\364\325\221A\212X\020\004m1\312\371\363-"
+	.string	"5H\214\026\3040\016%p\313Z\304\352jM']\210\2258;D\322\370\220\016*\253\226k\034\320\307\345\214kM\305_\345`1\177;^6\347\313)\376\241\331\260\346T\3043\253g\002\300Z"
+	.ascii	"c\323\252\365\341\\q{\273\245\352+\177\002\"\007\024&]\212i\207"
+	.ascii	"\357\177O\317\345\013\227h\225@\242\373\001.\322\324\026\350"
+	.ascii	"f\2115\177\322l\266Lb8\231N\341\352\341\201\022\350\352\222\351"
+	.ascii	"[$\317\2523[\365\317\003\320[\340\004\200\222\361\371F\361}\n"
+	.ascii	"{\211\323\370{\017\004\353w&o`{O\001 M \343\304\373V\030\322"
+	.ascii	"{\320\201\357f\306=\274\\\001:\227\376\001gD\276\312n\212\377"
+	.ascii	":\246\252\236\310\323%\357\214\367r&P\254L\034\024o\364\261G"
+	.ascii	"\366\2403\t\341\217\357\272\026w\324\372\001Z\003\021W\362\031"
+	.ascii	"{E>D\225\253\241\377"
+	.text
+	.section	.gnu.lto_.symtab.63e7f35480867a25,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.63e7f35480867a25,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1 @@
+	.file	"failsafe.c"
@@ -0,0 +1,1454 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\236\001\035\013"
+	.string	"4\016\222\002"
+	.string	"$"
+	.string	"\366\211\325\221\013L\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003\002\004\002\003\002\003\002"
+	.string	"\002\002\002\005"
+	.string	""
+	.string	"\006\002\007"
+	.string	"\b\006\335\276\216\252\016\003\240\342\234\212\n\005\006\007\b\t\352\263\360\321\b\n\013\333\232\304x.\002\005\002\005\002"
+	.string	"\002\t\n\002\n\t\002\t\r\016\017\247\320\217\212\001\020\343\267\245\270\f\021\023\233\326\340\375\t"
+	.string	"\024\227\376\323\354\n\004\b\002\b\025\026\027\271\227\355\346\006\024\002\005\002\013\002"
+	.string	"\002\004\003\002\013\030\031\032\377\215\355\207\017\b"
+	.string	"\033\034\203\366\244\240\016\n\006\002\007\b\002\b\035\332\273\310\201\n\b\002\f\036\372\315\205\371\013\004\037\252\344\220\257\r\006 \221\326\260\227\004\006\n\002\n!\326\374\265\374\005\b\"\234\347\235\363\t\022\002#\310\231\251\304\013$\276\363\265\272\007%&'\240\342\234\212\n"
+	.ascii	"< \240\202*\"\361\221\b>\257\227\343\302-\020c\323\300v.\362"
+	.ascii	" ee\004 \023\2031b\267\300j/1\321\006\324\252\0017\334\023\f"
+	.ascii	"1\003\212\31529\254\313He\213\002\311\356\260TM\236\3707\"j\242"
+	.ascii	"\204p\2375V\271\220\265D\021,\254\013\334\f\026\260\302\223\203"
+	.ascii	"y1\354)g\264[\230Nd\235\274\240\356\3221\232@\301}37\370\364"
+	.ascii	"\265\002\356~j\263\345\355\327\261\347\322\302\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 \273\005\003"
+	.string	"\324\002\257"
+	.string	"\r"
+	.string	"\001\001\001\013"
+	.string	"\001"
+	.string	"\001\023\024"
+	.string	"\001\027\032\034"
+	.string	"\001\035\001\001\001"
+	.string	""
+	.string	"\036"
+	.string	"\003\037\003\002"
+	.string	" \003"
+	.string	"!\004"
+	.string	"\001\""
+	.string	"\003"
+	.string	"\026"
+	.string	"b \325y\005`"
+	.string	"\206Ph\001\304\201\023\254y\314\245A\025q8#q\0273\333\205\2113\263ASrQ\002M\023!\250"
+	.string	"q_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\265\002%\f"
+	.string	"\"\31757 \221\222\016\021p\240\204\300C\261\213\024X\253*H\013\311\202\343\341\004E\373=66\b\202*\024_\016`\204"
+	.string	"\004\001\004\312\344'\177\204\f\026\353\341\223\260hK\222\002\267:fL\032\272\f\314\302\265\260B&\200>\315\352\306\212\021\034\360\346d\347\265$4.5&\201\255\033-\r\025\324\007h\360\016\323#\307&c\265\005\003v\221\215R5\324w*\320'\027r\254\276\314\3146d\t\311H!\330\264\352\313\nK2\363\024\300\302\322\005\332K\341V\220\314\034=\360\242Fd\246\304\367\335\n92\363s\251_\035\224\030\305\326]*81\2570\210\336]\355\271\177\204ko\355\325\343\331so\252\231\231"
+	.ascii	"\277\341Hl\342A\340O\252\333\215\017}\211\300\274\216e\223\306"
+	.ascii	"\217J\250\221\255T\"TbP(,\233\001p\242\"G\345\003\022@\324@C"
+	.ascii	"\003\231\300\030e\214M\230\270\260\345z\006\312j\350j\352\263"
+	.ascii	"\336\372\306\335\242~\203p8\366\257\371\201\310Rs&\200\357\332"
+	.ascii	"s\326\370\n\326UEY\024Luc+\032\003\312\235(\352\246\341\254\013"
+	.ascii	"\0047\220\270\327\205n\341j\235^W\325\354}\270\333\305\340\033"
+	.ascii	"\260\366\346d[/Z\211\343\211\220\303\313\334\344_#\271\023X_"
+	.ascii	"\252x\n\003\271\2478\333\006\304\"\370\fy\233\0022[\302\030\260"
+	.ascii	"\b\340\273<\265\367\336\013\"V\374-\250W\374^\024\347Zi\367\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`]\002\225\t"
+	.ascii	"\202M,/pk2\034\374\377\377\252\241"
+	.string	"\201\024\375\377\377\275\260wC`S12*Lh\200\206\327W\002\306\002\350j\260\251eD\260\264\356\307\326{\313$\003\314L\235i\2220\032\027\235\t\311\303\301h\032\216\215\f\214\344\341HS\204\205\rR\370\375\257\fA\035\304\2570\344$\201D`\273\004k9y\357\255F\275\177!-\277+\214WX\353\024\254\007\003\021\335\2650\250j\004\271\262a\221\n>h\002<^\030@\225\244@U\254Q\252\326Z%\005\016y\220;[\013\252\334\033\366\033\326\331\321\217\373\233#\214\341\376\243{}\370\372L.I\235zJx!\225C5 `\002\2211-\017fR\240\027\033$\024\270\034\212a\360\022\020@(X \270\306\212:\214\277\002\307>\262#;\335\002Ne1\326W;\177\310\235~a\277\023\033\305\306\214\005\025*\2201\260\340\305\216\325\331jq\271\214\224N\352\262\214K\273\346f\032\312\276+\226\t\271S"
+	.ascii	"}u\241\313\201\267\027r\0260@\257\b\036\034\224d\306V\007Q\312"
+	.ascii	"\211%\324\023\327/\240\206\375\027d\030(\002"
+	.text
+	.section	.gnu.lto_.pureconst.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\230\004\013\230\004\023\230\005\024\230\004\027\230\004\032"
+	.ascii	"\230\004\034\230\004\035\230\004\036\204\004\037\230\004 \230"
+	.ascii	"\004!\230\004\"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\215\004"
+	.ascii	"B\206\021\031\300%\303\001\377\377\377\377\003\357m\204\220M"
+	.ascii	"\310\336m$\254\3354f\023\231R\"\205#\331&K\313aC\221]\254c\245"
+	.ascii	"\204\246\300v)R76\2758~\366@\025\250\255\232\243-\232\247-an"
+	.ascii	"\266fE\007\270!! \220\002\241:>\255\001\025\362R\237\213\265"
+	.ascii	"\227\271?\270v\3715\211@\270\035\210\023\345\221\346p\023\363"
+	.ascii	"\344\273/\371\232\204\017ru \220N\366\002*\354]}\022\235\201"
+	.ascii	"\234\336\200\355\314Fs\320f\303T\031\204\005Q\360!"
+	.text
+	.section	.gnu.lto_.lto.2a396289f33651d2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_qAttitude.63.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qpAttitude.64.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_qHeadfree.65.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qOffset.66.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.67.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.71.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\345\261\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\b\026?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.73.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375 P%\002"
+	.string	"$\003C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001(\005\001?\202\210\200\020\177}\273\001{\273\001\264'\001\r\3456(yw\300\001u\277\001s\276\001q\275\001o\274\001"
+	.string	"\006"
+	.ascii	"I\005N\271Q\261\2272\301\315\313\006P\004"
+	.text
+	.section	.gnu.lto_imuConfigure.76.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\273\002\025\023"
+	.string	"\026$}H\320\322(\035\211\210\344\337\264\366\201\"d\202\370"
+	.string	"\217@\340\021~e\006\344\306P3"
+	.string	"H\340\217\030\356\323\306_*Q\356[\240\270l\327kk\302\374\267\017]h\271p\211\247^\007\322x\030\254\001K|k\215l\"eJ\001`"
+	.string	"]"
+	.string	"q"
+	.string	">6\027\213J\330\276\257\342=0\277\331$\302\007\305\356\206\2176\214\035>>\264\235i\177\347)d\267mp\334\r\2613\264{K`\004\247\307"
+	.string	"\037"
+	.ascii	">\346\005\200\217\226\3319~\303\331\257X\232\371Y\332]\225\222"
+	.ascii	"\270\354)\363\317sT\215\206\303\323t\262\273\316\032M\315\255"
+	.ascii	"\267Mb\373\304\326\006\001\252`\022MwM\375\f\317\256\263\270"
+	.ascii	"p\332\2251\361}\376\323\342\347<\372\365\222\257=\372/\340\343"
+	.ascii	"5\264\371\241c"
+	.string	"\233e\317\276\305\244\216\260\377\355\356Zo\354\333~\221\230\016\211i\220L\207`:\005\246Q1}\212iS\246\301/\035c\372\213i\315t~\351\217\244j\224\f\340v;\364\0029~`!\013\201\217\n@\364j\273\224\332\020>#\311\250\266\213p$\224\243\224\206;x(\265%\\\306\204\030\037\216\332\216\302\215P`\240\024\200\rO\347\244v\205\027\021\231\364\004\252)*\230r\241\240\310\303\366\251\255\362\027\306\215\334\330]\023\277\305]\254X\255\026\370\2508j;\334\211\220~r\353\005\275\236\r\231\335\031\211\352\247\247\235\210\311\236S\003,\226\226\213J\212\313\313\025[\261`\260\327*\205\305\022\213\275`+\261\002^\225hhq\251b+-\027\213\005\225\213K\245E\265\202eP\225\020\360\013\003\013\246\212\275^0Ux\233\375[\2751\003\017\271\231\306\030Dk88\317?\035\016Pm\027\242\306\275\007\r\335\036"
+	.ascii	"\321\323\216B\r\321\367<\016}\320A\323\211h\2501\034\240\031"
+	.ascii	"\336\314D\320m\311\317]\3118?1 \340\002\021)\243\007\222CCM\201"
+	.ascii	"\031H8\006\273\223r\226\225\330\244\b\264\265n\356\347\270\016"
+	.ascii	"G\206W\247\bU&\021k0n\245\217\007)\256\245\016\213\231\215Ye"
+	.ascii	"\006\323\342\222\005\301\302\335C.\030\303\033\365`O\266\253"
+	.ascii	"\230\260M\271\r\257+\334\320e\344\267\335,q\335aB\372\013\242"
+	.ascii	"5gx\b\342s\032V\313\013!\223\001"
+	.text
+	.section	.gnu.lto_imuInit.77.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\227\001%\020"
+	.string	"6\037lF\340\322&\035R{Z3\f\230"
+	.string	"\036\"\020%p\356\330\325\252\003\201 \033\213\323*\3030\352\364\256VM[\262\203\267jfY\241\205\026h\026\313\321di\034\r\307y\332\374\326>N\036C\323QM\032\331[\312\224\002V"
+	.string	"N"
+	.string	"_"
+	.ascii	"\232\326L\347\323\027`\022;\312\221\340\306.\314\314\307\306"
+	.ascii	"\240P\n\333\0071\313.:\214f\317\363\342\302s\264\273\234\236"
+	.ascii	"8\353O\223\345\337\346\245\370\352\376\266\230\353S \013\332"
+	.ascii	"\001\340\345z\003`P\304\333<_^,\231$\007\273\353\214\257\022"
+	.ascii	"7\274\355\022\333#v\212\004\001R\325>\241\344\343\013\311T\033"
+	.ascii	"\365!\037"
+	.string	"UE\\\332\371\232\232:\\~8\365\034\325\266\273\f\374\233\343\214\360k\016\235\262\222\217\207\376\212vx\325\030\243\302\304\rN+g6\254K\235\261\377Ve\354L\2274\275i\232\224i\355\245\241\246_\207v\004\t\371X\322\220\030+b$\264\363&c\202}rF4\"\251\177\276;D\273n0\233\025\271v[\0076}K\r\226\234YS\222B\034-2\250\232\236\302a\230\214\f\271\302_X@0\344\342=\0270\234\234h\207PKB=,p\236\372:\337\361\217_\343\f\366\261\217v\2306\242Q>\221\254\244P\234\212\207\016(\020\034\270\020(\r)\356\264J\341H\bX%\002e\305\251\250T+\016\004\266\177\2532~4b<d-ey\006\322f\335\260r\362\321\252\235\r\353~\232\0362 \325\031/xI7\350\020\271\262\207\013\244\377@{\213\007\231\266\335\326\243\377s\240\022\b\246|4i\001\037"
+	.ascii	"3C\233\0201\266\006\226\\\313\020\252\363\360E@\026\037\2051"
+	.ascii	"\001M\\\fG\034\232D]\350\202%\303\025^\305\bR\354\026a,\330X"
+	.ascii	"bx\003'\225\336Q\273\300\310C\006\233\2549c\250\272\3335\261"
+	.ascii	"\001&\354\227!\304\245\213\331\016\rLA\001"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.78.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"U\t"
+	.string	"VP=;0\3456\035\200\323m\204\201\331\213\244\377\204\212\264b\245\3216\240"
+	.string	"\372q)"
+	.string	"o@\005l\246\373P\370/U\343\213bLZ\n\244\002)\224\2339\036\211\226*\037\335\322\266{\247\024)"
+	.string	"-"
+	.string	"."
+	.string	"~\307\234M\363\020\265\027Q\034\"kw\353\3748w\311\371\017y\200W\"]r\030v\327\322+\231\356y\333\005\266\r\3547\004\031\376wj\215\221\274w\352\217\256\323Y3\202"
+	.string	":\331\262C\222\234\036\3667\273\273\236'\233#"
+	.string	"#s\320\262\333\321\n\260+\352\002b\007\237/\266\255{\001\237r\025\217\376g\221SN]\247\324\244\372\311QDy\217\227\nT\270I\t\013\341\266\023N\20210\263\273\013\276\310G\002\376xD \254\206&$0\212\210Z\201=\200\352G\333\252\207\300\231\005\204VCY\246\325N\270\337\354<9\304\254\272\271a?\273\374\225\263d~\024"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\0320\f\340\200\370\234\342"
+	.ascii	"\355\022U\002\322e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_imuCalculateAcceleration.79.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\314\tM/"
+	.string	"\372S\274\021A`\246J:\023\277\254 \235B\270\220\334K\366\353v\262\334e\016\276\372\2327\212\250h\240\2605=\216\177\350E;j\303_\324a\370}\314\177\023\350\265\345\001\245\231\373\372+\333\032\"\215l\322\244\224)\364"
+	.string	"\367"
+	.string	"\027\001\224O\200\362\235(\277\211\362\231(\177\211\362\007P\276\022\345\0130\371\001\202\374$\312G\242\374#\3127\242|"
+	.ascii	"\224/\244\374\"\3127)?H\371e\311\247%\237\244| \3457\3453\345"
+	.ascii	"\357\007a!:Xxj\035\362w\250\352\221yV\266n\027\314\222\fd\340"
+	.ascii	"\277k\267w\027\376\007\263#8v\306dd\033\323Wk\355\n.\371\323"
+	.ascii	"\355\227s\353x\004\307\316L2fe\372j=\303Z\362[\301%\267&-\377"
+	.ascii	"\313e\273\234;\327\343f\255N\362\240\251\265j\335*\270\244\324"
+	.ascii	".\321%\201\253D\227\374\371\363Y\272\266Z\262m\361qG\250\326"
+	.ascii	":l){nII`\363\3715\215hc[R#\332\221%\215,\360\b\315\f(Uk\025\242"
+	.ascii	"\225q\003\257\326\342\0249B+\002\227\350<\321\263w\313@\320\310"
+	.ascii	"\230\313\n"
+	.string	"\265\326\263\021-m\037\334\3779\376O\370\213\222\002_8\033\207\007\210\020\274\306\020t\311\r\263v!\202\306\177\004\t^\343\271\314\022=\263\036;\260\377\022\253f\333\260Y\303{6]\346\341\221\353\376Mh-\032\2743\355\227\307\375\243X\273\343!\261\031\343\037\"\377em\231\343A\355\325Z\273\376\024K\006\254\251\255\326*A\314\216\t\373\276-y\261\026\274\306%\277-\350\222\334e\336\035\271<\274-&\351\303\244\236\302\337\337\233\262Z\211S\333^\315f\212qd\374\367\256\336>\361\206W\354#\362\337O7\306\315\366/\2606\224\277\344{0\371\033L\376\227\311\307\260`\366^;\267\333e\362\271L~\004!\037\202\220\377@\310w`\362\033\230\374\241\311\337*\342kQ~\226\311\307*\371W&\237\201\311_`\362\255\212\370\n(\277\312\344S\225\374)\223\237\300\344#0\371RE\374(\312\2072\371O%\377"
+	.string	"\345\033\240\374\002\001i\203\344\fp-\320Nm\240\033Qq\215@3u\201\246\201\212qd\335\324\004\022\341p\352\r\303wl\352\275s\233[j\257fj\340\236\342\033\257\036\320K\275\3055C\247\226\001-\374\023\310\357X*\th\244V\352-\302\005h\001}I\035\240\327G\"\"\377\311-\241sK\324\336\317.;\350\364\362\264'(\251\243\370\346\220\232\001\251q\232@t\232\320\243^j3ja\0375\357)\302\221\t*\003\320F~"
+	.string	"t\025\337\221(l\322I\037\2719\262\250\371\254\361\217\331\301.\352\276+\256\221\2250\333\254\343#7w\250\326\n,;\330[\214\343\333<\307\323\3613?C\227,\273$\356\361\273\033\263!p\300f\373\023\365\320{\267\301?\273O\224\266\207>\3738\222m\235\265\363\365}\273\205\013\027\350\222\264\313\270=r\307\255b\\\323\353f\373~Q\262U\330\361\225q\241\377\031\226\316W\260\326*\341;g\3654p\350\320\201.Iv\231\246\307o\316\2117\314\312!\2561\"V\360\n1\031)`\210\205\205\201\231\"\300n\300\020[A\037\266\205#\306\213\341\r\027-^\300`1\224\361\002,\3060\254\206\215\341\226\323g\320\020\2531\2741cF\215\241\220\256.\2606\224s0\244Gl\262\363"
+	.ascii	"\326\352\204"
+	.string	"\302\326\355\366\325\361\337\271\032K\326Fh.8\276r6D\276f\r]2Bs\"\265#\204\256\362\240\0354\204\007<\205\337N#GN55\272\244\203&\211\210\374\216\r\332\255m7\364\260\033\364r\024\266!Vom\320\352\255,\255&YM\345v\274j\254$\274dM\311Us\245\035\222c\320I\220|\365\202f\240\305\307#\013\250\332\352KA[U)0Q5\325TihgS\tZ\310\251\304h/\b\206F\320\tz\021=\213\201\234J\202\374\203\215\347\222\263\311\371\204\327x>\241K\"h#\276<-~j))\247\033\257\021CKE\265\324\025C\365\177R9\255\3205F\265TY\217\375G\001\325Tn\007\372\251\231\315\025.\373\3325X\230\354\314\262a\366\3460\361@s\005\200\272\250\201D\345\fS$4\024\224\223$\255\001\240\002\021!+v\021P\255C\316\220\320(\231\326\3238\260\f\""
+	.string	"\263d\r\210\222\362\216v0\2408\301@\363\335\312\346\240R\223/\024]0\023\034\262}/\201\034&\007\226\272T\200ps\370\237\251\363\372\001\305\032bV\340\247p+K\030\006?@"
+	.string	"\375L6\005<\372N\244\271\237\303\221\031\261\022|0\363\3739\354\352\022\206\261\330\352x\243\354\231\300Y\200\210\006\002p\262\tl\0020\227k\353W#\344\326H\022\234\013\031\206ByG\230"
+	.string	"\231\334$\256e\362>wx\220\352\210t\026\034\344\0133\307\3408\202\237P\361\271]\032\233\350`\036uG\202\350\326\340D\214\220\255\214\330\337\371"
+	.string	"\261\362\353<\342D\373E\221X\261\031-%\335\375s\373\017Q\340\211\"m\356\013Q\234\t\304B\211\304\253\306\211\235\235\327\"5\2429F}rB\255\262E\333\b\004*\003\324\352\375:\036N\216T\230\242`\213\301\265\276\fO1\260s\341`!\366\t :<\201\316.lBiJ*8\245v\007\371\350@a\261"
+	.ascii	"\020\3118a\266T\037\223\220\355\016Q\272\220\240\"6\201\202\244"
+	.ascii	"A\221\266Q\264\236\324\236\264^\232\342\343\275@\331\225\020"
+	.ascii	"\320\246\022\221]\0028\204\303\273\267pb\177x\241.-\252\036]"
+	.ascii	"\213b\217^:\330\243\215\032"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.85.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\004\t\305+"
+	.string	"*M\\\020Cp\336M:3\360N\334?\027U\365\244D1\305h\263t \352\372BH\013\350\215\232=\236\251\375\311"
+	.string	"\242\341\nn\367\003\032\"Z\304\302h\336\265YLGQ~\240^\374\315\307\246\325\254\021K\310\226R\246\341"
+	.string	"\341"
+	.string	""
+	.string	"\001G\224oD\371\004(\177"
+	.string	"\345\013\240\374"
+	.ascii	"%\277\210\344\003\240|\"\312\357Q>\217\362w\224oR\276\216\362"
+	.ascii	"K\312')\237R~S>7\177/\360\372\024R\023\002L\255<\346\nU8\362"
+	.ascii	"\214\2245\356\376\373\345\262k\177\3574\366\370\036\213\273R"
+	.ascii	"k\355-\371\323\370{K\356\252\275\367\325\262[\3165\3260\275\304"
+	.ascii	"8\3408\333S\253X\325\222\2372\227\344\343\"\225KR\255Q\271\344"
+	.ascii	"\317?\317\036\315\252\316\211Y\330\227@\265\326\253n\262\347"
+	.ascii	"\362v\246\256$i\363\371\325a\355\206D\257\345=\355tXJz\fY3\216"
+	.ascii	"\230\220'412\326\005\331\222J\301Yr\247\210\030F\231\212n~\b"
+	.ascii	"\231\034[\312#\216m\027\021\277\250S\255u\325\226q\020\203\314"
+	.ascii	":\254Z\353yH\354\261\357\355\377&\377\255\376]T\035V\355mf\255"
+	.ascii	"\325\001w\204\2627,F\262\r\233\021o\340\300\250\222\232\007s"
+	.ascii	"\270\307M\343&\342\003\210$6p`\355u#\336\343\2361#\242\215m\304"
+	.ascii	"\036\227\214\226Y+p\207_1;\206\304\367\311\222"
+	.string	"/\241\245U\236H\301;<Q\2325p\302\366\342Z\253Ww\331\247J\013\275jk\306\351R\347\213\007\375\307\235*\267-\3649\214,\270^\366\313\326\367\311Wp\361\016\227\374r\225Kn\353\312\334\004\221\001y\356?\006\271\313\376\245\265\231\374\315\267@\371\025(\237\002\345gQ>\026\345K0\371V&\237\201\311\2572\371\013(_A\311\247\322\361\247t\374\004%_\212\344GQ>\024\345#\240\374'\312w\242\374\003\224o\200\362\233(\377G\371\005(\237\211\362\227(\337W\362\225H~\022\345#Q~\007\332\251i7\365\201\366\341\021\026\203F\f\364\262\3211\002\2174\365z)\360k\032\307\324\005\372\347\266\324\276f\352&C\302b\222\245^@\033|\035!\355\r\026\245%\373G\316OR+u\277!%\035!u\343\021\242\031\205\t\373\003w\324>9\341\024+&\320\344<\343\035\032\321\001M\240\227\276\b\350"
+	.string	"=\240\177\206\204S\202N\004\364\352\241\003%@CH{\023d,\222\262vN*If\377Ye\353\234iEs\346,\235\323\312\211\345\314rf)\227\334!\037 \317\035@\027u\273\205\035zb\242\376O\265\254r\207"
+	.ascii	"\332\351\213G\021\315Q\257\211\272\343\fp\331\274\376/`\340\035"
+	.ascii	"\366\332\t\254\275v\315k\372f\266\256w\355\213\023\026\203\031"
+	.ascii	"\314^\2663#P\203\256\327\313\231\221l.\233\276\t\247\264\355"
+	.ascii	"\351W\255@(\332d\377\312\b\321\202<\367nn\332Mr\302bpC\367\002"
+	.ascii	":3\002\037]'P\240\230a\242\274V\203\031\\[W2T\244\330b\201\342"
+	.ascii	"\252\305V\t\256+\255\256\030W\r|w\361\342D\327\225\f\027.\272"
+	.ascii	"\256zG\340\322\332L@\034\201\003v\3605h\255J&\354Y\343Y%Y@{\022"
+	.ascii	"K\006m\325\033FVd\320\244\2345\273\252.bnS\271\240\253z\303~"
+	.ascii	"\004\231\214\205\234D\037\347\330X\271\344\202&\335\342\004\231"
+	.ascii	"\025ZA\233\350\342\206\307\030\310\333\316 g;[\271\244\202\316"
+	.ascii	"\022\305\254\270\205\214B\205f\267\254\246\320]F\210\206\325"
+	.ascii	"\022:\253I7a1\270\201\211bX\375\340\314\270k\357\300;\336fr\016"
+	.ascii	"\326QC\210\007\336\241\207rI\t\275k\313li\201\212[tT\303\223"
+	.ascii	"\312\217o\234iGlc\252\251z\177b\013\243L\320S\335\t\372E\233"
+	.ascii	"\2715#\007\007IyR)\245\332\007\205P\0277RD\370\213\203\f\214"
+	.ascii	"j\251\3562PQ\b\032\252\373M\210\026l\004|\200\277vzj'0\032\200"
+	.ascii	"\260\250\2018\305\024"
+	.string	"sHdD&HR\2204\007\320\002\021!\232\332\006\021\360,d\n\232\231\331r3\214\001#l\256\3421\353\004\022Y\324\306\3432\214\347+\341\264\250\004\260\307B\241d\222\374\006\310\352Y,\261w\341E\261XVa\013\240\002s\263\311\320M[\272\320\231.e\"-4\250O\027\251\324\212\370\271\311\226^\f\032P\355^Y~#Ej\310\242gV\250\360\037\357\313\375\303#\261\266!\335\275\002\227a\365\foQ\221<\213\266\361\214\222$\324%r\367\016\001Q\300\263\206\331\360O\251\305F\262\236]\202\273J\264aB.]\022\020\030\021\322~\021\212|V\033\037T&(k\017\357\200\310\317\201a\340\342\333\320\005hD\367^h\347}.w\215\"\3166\016\021\207\003)\255\037\\\340\r{\373\2528X\254\274/D\333\206\233\"NAQ\234 \373H\201\262\210%\177A\003\361>\027\274iYzZ\271\336f|"
+	.string	"u<\036\"\360\327\021\334R?\242`\347J\216\232\215\300\f?&>\005\373\rJ\334/\035 \034\317iOv\361y\253\202\025r\262c\235/(a\024\024\\L\261\234\375\036K\004\277\240z?L\251\206\372\300?5"
+	.ascii	"\257\035\227\216\234\271r8\223wi@\205\333\266\324"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.87.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\266\001\355\016"
+	.string	"\206\033bE"
+	.string	"\221(\0358\373\261\b\207\377c\232Q"
+	.string	"$i\017a.n^\2729\234-0\t\223\241\301}\343{\263V\267\t\203Y\240\254~\310C\223\017\207\016"
+	.string	"\300\212\331\"\314f\330J\301\232\201\226N\"~\333{o\231RM"
+	.string	"I"
+	.string	"N"
+	.ascii	"#\363\322%;\307Y\252=\213\r\030h`\273\253A\017/}\312\b\265\344"
+	.ascii	"wN>\274\317\364\t\362\275\\z^\036\243\001\035.^\037\227\020^"
+	.ascii	"\366\245\024\212|\027\"\311\356\276\3045\303\207R\355\234\354"
+	.ascii	"\256\325\3734\334\235\333\336l#\260u$\252'M\233B\005\275w\b`"
+	.ascii	"\306\bW\n\232l\026Ja\007\373qw\327\020\306\376\352\227\252VU"
+	.ascii	"?\023\360\252\301\345\354\272\304z\254K\276\020\221\331\276\332"
+	.ascii	"'q\231\322W\026\374\261\313\241\306f\227U\342\002\236K\222\177"
+	.ascii	"\346e|\233\210\352\262F\276r`\260\223\306\f?\314\244\220!CTB"
+	.ascii	";\205\323{\216\320d\337\310\304\250\342g\256\360/;\302Q\264x"
+	.ascii	"v7\201\177\3424!\037\304\245E+\322_\231\227\n\t\334X\2354v\335"
+	.ascii	"]\023t\313<t`\002GJyx\006,\f@!n\301H\005\324u\244-\304\233\t"
+	.ascii	")\304i#\b)\234\204\007\232\n\207\022\322\266\216E3\t`\321\004"
+	.ascii	"P\247\215D\242N\313X\247\307\2050n\260\303u\202\250y\030\217"
+	.ascii	"\201s\2437\316\204\225\334\246\325\202FL\313\266\016\260}\340"
+	.ascii	"+\334\372\330\330]\0056\312U\004$ \320\002\0311\233\007\223C"
+	.ascii	"_I\214\206\re\307\275 \261!\241A\271\323\203!\312\207 t3w\016"
+	.ascii	"&\324\020\236\234\032\255@\234\313\221\025\355\262\204\262lr"
+	.ascii	"0\303\037`\0011C\364\033^}\312\006K\\\247\b.i\340\357}\225\215"
+	.ascii	"\254\f\271]K\017"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.88.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"M\t"
+	.string	"fQ>80\345(\035\200\013\327\233\t\036\241\220>B\364\242\271\260\274\315\\z:\200H\347\326\3366\242G\370\276\2616\205\034\037\016\006\006\f({\315\225r\221\f\317\261\266\367\2262\245."
+	.string	"+"
+	.string	"."
+	.string	"\266\313m\035\253\303X\027("
+	.string	"v7j>"
+	.string	"\377\334\005\340\237r\\{j\376Yw+./\250\024\351\211Y\330]'*\225q\353m`?\006\036$\245\214\331\033)u\303\276[U\331O\303\247\335\323\372t>}\fB\353-\260]\214X\200ey*\037\2665;\343\213|D\013\005\252N5\345\024b\312\230S\257\252\357u\3220\201~b\222\252`\321K\354\n\330\335\004\277\365\215\302_\375\271b\224G\375\371#\370w=\b\346lD\235,\206 \036\262\b\207(\2211t\"\347\003\212\033\002{&\032>1\344\361|bf\333\273U\025TMIMv\232P\363u\002q\335\316b\267\024\022"
+	.ascii	"2\241g(\360\376\005\007\344\rJJT\207x\013>\2148p\007\030w)9 "
+	.ascii	"*\007]\310\341\007+1m\023\327\2124\005~pp"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.89.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\317\002%\026"
+	.string	"\026\253\223J\300\360*\035\372\241Db"
+	.string	"\356\0205\335\276n\241\231S\217&+\005\204\\m\325\301\314r03'\220+\204\226\246\357\373\016\347'\221\n\265*1\f\262\b\202\302\270\001)pV)]\211\213\261tCf\334\tV\324\310&r\247\024~"
+	.string	"r"
+	.string	"\205"
+	.ascii	"^\235\336\336\371E\257L\274\211\335\203\214\224\222\251I\031"
+	.ascii	"{\222\234j\255"
+	.string	"\bN\375 ujB\336U\356\264\0270\330}\210\301[+N\r\025\265\022\023\330@\352\324\266?\342$v\346M\242\207\232\262\207hF\bG\2555\306\372Hy:\357*O\267\303y'w\362|\231\223)M7\202B\233/I@\207C\216\020\241\2174IZ\232y\361\223F\370\233\023\245Rk\365\f\n5\334\364\206`/J\34795\356e>x\352\277\224\247\254\275\361\007d(\001\r{\363h\023}sw\354\223uu`t\372E\247K\3504\211\247G>\374]\017\272[t\232E\247E<\rRN\257\350\364\007\235V\321\351\024\235F\321\351r\247i9M\322\351\245\323\223N?\200\200\341\213\233\213Z3\034w\324%\272\002\304\203~\373\276\320\215\366\3121?\341\222\351\246\326\272\212q\013[\005M3\200O\344\266\366E3=Zs\327\226\260R>H\256\311\334\357\356\201>g\361\026>\362y,\263\221\215\026"
+	.ascii	"\215\233\220\371Z\233V\333\001\033D,\375V\346:r\216C\273;;lJ"
+	.ascii	"\020\035\034\217=^\374\274\371\201QT\372M\035.\331\371\332\211"
+	.ascii	"\004\f\341;\272\311_\255\275\002$[\262[\004\364\361\315\243Y"
+	.ascii	"+\262$K\221\2008>"
+	.string	"\333\213R\210,\312\207\033M\341(|\224\252\2656\360\207N\324\342\264[\315EFi07\331\205\025\027\234M7\243\345r\270\331\n\355\246\323\341r,:\230g'0-\266\230\216\245f\273M\210\271\330d-\261Y\316B\354\344e\\\005Z.\246\303\341r\261\225m\023{_\035\277$\331(^\225\223\2043}^\t\2624\266A\326*\275\365\221\253\035\331\177\254T[\356\307>\006\320\307\227Z;Bm>\250\002\372y\252L\250M\301\026\265\224\007\335r\017tr-\335\224\246\033\250\337\215T\266\0020 `\202!r\2167\214\001n\030\355\262baM}L\323\023#\364\2747\324)\200@\357\205\272\215\362\274\342\200\006`\r\341\324.\021\027\r\205\034\207\204\373\355$q\206\214\0301\236\305x\031\233\321\006\026I\340\bc\267R\212\240\030\007\005\342\005-h\016<7.S\222\273K@\307p%\003\375c\356\3606"
+	.ascii	"\323\226\213%\025\360=\262\345h\354\352\007\005\007"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.90.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\362\001e\016"
+	.string	"\266Z]D\020\221\232\016\030\034D\035\267O@\r\273\213rN\224\325\347\202\2112\240\216J\377U\200\212m\022\373A\321Z\371\300\343\332;\247\001>\0220!\233\002"
+	.string	""
+	.string	"\n@+\2455\025\261\300*\303\331F\232\321&R\246\024F"
+	.string	"D"
+	.string	"M"
+	.string	"\217~\332\377p\020\240\217,\343k\267f\244bwA\214\300z<p\002\325#\365\001\325\243A\266\351!\314\236d\243\302\210\035\273\233\351\206\203\236 \377!~\201-\241'\200\006\273\353\004[\\n\275\355\017\333\013\354\264\020_\036\374PR\362\240\323\206\246\264\242!;\f\245j\260O\355\356Z_\354\307\374\234\207?\366\321\177e\272z:f\232zZ3\235O_"
+	.string	"\b\217\323\230\261{\341\324cKq\246\203\355cv\314\215\202\360E\002+10U=\006\223\216T\273\363\024Z\001\030{\344$\222"
+	.ascii	"5v\227\301\211\243\330\"p\\\365x\360\3065U[\260\310\020\345\311"
+	.ascii	"\226y\006[+\273\242\217K\257w1\335\260xP\311\223\255\274\210"
+	.ascii	"\233\370\254]\321A\237\304KL\3609<\372$(\235\024-\321>\233I\364"
+	.ascii	"x:\217\262\026\362q[\366)!\331<\0202\t[\207\3134\357$\0131\340"
+	.ascii	"\316d\304\313>]\347eX\270\247V_,\222\243$R\025\0306\"8*\265\035"
+	.ascii	"\274\206\306E\324J\225\304\321\250\024L'J\355\007g1\263B\225"
+	.ascii	"R\r' \340\002\242\221m\003\302BKJ`\nv\234\031L\206-\313*\205"
+	.ascii	"\232f\305\367`\376\240\311\356\3302\256\203\317\271]\024[\336"
+	.ascii	"\002\321\335\222e\t\003{\232\306o\313\f\314\210\r2Z\254\225\002"
+	.ascii	",\306\210\3651\230\233\231A\220\027\034s\030j\330\226\027\002"
+	.ascii	"#\003"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.91.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\210\001\255\f"
+	.string	"\006\327Q> 1T:\200\3077\311\205\003\f\313\357\017T~s5\t\203U \350\242\252!\361\006\343j\b\021\366Cx\270\312\234Q\016U9T!"
+	.string	"\022\024\334\366n\025\016\2046\2245)\351n{\247\024<"
+	.string	"<"
+	.string	"B"
+	.string	"-o\273/\023\256\335\2458A\344\364\300\t@N\037\037"
+	.string	"9\365g\343\270h\332\263d\032V9v\267\316\020\377.?\377\253o\341\b\274\324\030\354\256e8\332p\317\333F`\273b\313Ic\206\t\332\"('\b\373\217\335]\317\222}\325\277=\365k\027\177z\324?\001T\321k\334\330\025\315d;R\027#l_b\253tPR6&\342KA\344\324\227\366I\274\304w\224\003\207\361\"F\247\235y\013\027\355\240:\315isg\341V"
+	.ascii	"\323\356.\360W\234%A\323u\220S\312a\026#\201\344\314\232\374"
+	.ascii	"\211\253\360\"\273\240\207>\212\247\340\370\"N\355\361\344C\357"
+	.ascii	"\203A>\264\204\355\b\027\376\271\205{\367\245\342\321p\265\023"
+	.ascii	"!\303M\200P)p\026M\275l8\265R\300]\005\314\246v\272nS%\342\376"
+	.ascii	"\261\263d\007\037F\320\f\315\20050@\022 \355\007\026\032\036"
+	.ascii	"\306\320\004\275M\373r\0311V'm\332\230$  \203\021\251p1\302B"
+	.ascii	"\277\310\300\ff\034\006\333\261m\214\377\326\372\t\274~i\356"
+	.ascii	"B\3542\334\235\214\260\342\230\233\314i\3010\360\344Yz21L\332"
+	.ascii	"B\027\303\2111\346ff\020\3628\006\223\362\354\230\303\240\206"
+	.ascii	"\323\362B`d"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.92.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\030\004\305\030"
+	.string	"\206\355\235H\260XQ:\260\3339\326\275\252\230R\300\210p\004\023\207'\001\310aP\020\027\002S\243?\327\320\316.Y\004\233]\r\212\3033\361^T_\256M\340\275ao\224\0365!`\004V$\334\f\250\215\264\374\261\344\023\262\345N)\207"
+	.string	"\200"
+	.string	"\215"
+	.string	"\225*\\\222\364\336\357;\220\007\021z\017\305xc1\200()\tXkU\360\320\b\306\207\005n#>\244\017 >\364\227\336\244\342L^\240\233\352Qk\375\017[\205\355z8m!\333e\006\r\204l\273\323Q\321\223l\350\236\202\265:\221K\343\266\323\2356\377v\312\332\251\265\336\367\003\272_\257\252\210\321\213/M"
+	.ascii	"\214\022\003\300h\210\332\024\335\330]\351\223\310\250\234\223"
+	.ascii	"\265Sk\365\334\031\265\270\303\333\236`[\307\246.\002\213$\227"
+	.ascii	"\243\234W\276Y\330"
+	.string	"\342l(\225\343\225?7R\344f\037 \275\311\265\0231\324Xku\340\013\371\020\022~\215\207.\0214\277\013\022\037\302\366M\237Iv\004yKL\270ye;\225sg\330\247ue\330tzF\247et\032\207N\337\274w\307\350t\r\235\206y\372E\247]t\232\206N\267\350\364H\247YtZ\244\323!\235\246tz\351\364\244\323\317\331\320\242\210\007%\005\227Z\213\256\314\004Rv^b3\266\266\206\r\363;\232\315\001R\r\355\255\265\261\235V\260Iw\\\333\207\303\374\256\265\005V\354\215\265\343\356\031q\303e-\001,9^\351\341O\234\210{&HL8\332\233H\205{\037\022\323\322\3353sweV\337\2719ar<\203x\224\222\357}\247Q4\246\310\374\250\fP\311\356\214#Yt\300\250\331+}\254\322\373\r\3152\236m\315~\351\324\207n\252\254\022\022\224\355\234\355\224\312\341(\241n:T+\316"
+	.ascii	"\316\3126\035B\364D8\321\203\202e\037\235\240\037\032i\342\203"
+	.ascii	"\007Z\210\016\244\bZ\317\017\351\003T\202\324!\340\332\b\016"
+	.ascii	"@\244\211Z\r\210t9\341N\353\312\360\225N6\351\206L\337&\336\367"
+	.ascii	"V\2141\277\375m\342k\211l\277\326;\270-\351l\376\351`\276\374"
+	.ascii	"\351]x\306Zq\337\001\rA\302\374\316\257\037\031*\327\332\023"
+	.ascii	"n\265\205\202k\007\374\306T\270\226*)=\2028(\333\323\200m\341"
+	.ascii	"W\254\204<\242\004\2034k_8\025C\t8\232r*\f\031xx\304\2073G\250"
+	.ascii	"\221,\246\230a\250\002\261(a\202Bc1\320\202\221\300\346\346\021"
+	.ascii	"@-3\310\214U8\255Y3\264\244\205R\322\342X\271\3111F34\nF5M\306"
+	.ascii	"[\001\221\221\201Q\261\023\026\017\231\237I\3306F\273\262\311"
+	.ascii	".\275\252\366Bt\025O\353\031\206\200\303\276\301\355c\3441\232"
+	.ascii	"\022k\363\376\244~\013\231\032\353\206~V\364\177\202\bR\272\022"
+	.ascii	"\260cdm\220\363\350Z\312\205.\004-&\213\021\271\374\"[dv\177"
+	.ascii	"\263y[f\363\205\220\213}\006\035zG*\007\0242&\345\031\362\305"
+	.ascii	"m\216\032"
+	.text
+	.section	.gnu.lto_imuInit.part.0.119.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788@\217\322\001\230NL\r\212\353\245K\2351\034\0026\326\343\337\236\")\242\326KY\246\344\322\210\020\203(\2028\003K\342\324\247\003j\2411\315;\330\007*\266\262\211\334)\005>\230\336\234\333\206B\363\034\266/\203\370<\204:n\263}\3316=\006\326:\241\216\223\337\204\004W\021!-\270\254\223\332\004\311N\201\275\3176\345\347ySb\266\341\257U\224\033T-\r\335PM\331\316@_\005d'|\025\362\302\343\205\246\203\303y\26412\340K\026`Aiq(\tj\312z\375ZE\331\212p\0328\355\202\304\300,Il9\261\257\022\331\030\366\370\024\333\242\020\217l\227\257L\366\254\017\017\326\313\356\312G-\371\350\n\257\221\177\325\001J&\3225\300$rH\360+\303\260\273\326\214\334\361\266\025l{l\257\004\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.120.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\265\001\345\017"
+	.string	"\026]gF\340\262(\035\242\017\350\277\f4V\350\204@\267r\240\177\376\260\357D\370\255&C\013\030Z@)\036\364\253@\203\257\3474\260\363$T\227\247\236\275\361p \3068\217\203Q\247\313\201\030\004\002\243(\023\r\265\275\245L)Q"
+	.string	"P"
+	.string	"P"
+	.string	"*^\317i\031\300.\211\026\267\335\257\344\321\nB\217$\037\001=\302\037"
+	.ascii	"=\332\267\261\355z\361\313\376\371gb\317\023\302\245\366cw\273"
+	.ascii	"G-\361\3275\341\313O\0358b\262\225\353i\207)r\360\210\311<<\r"
+	.ascii	"\034\212<\330]\207>\334\361v`'\203\326\177\177\306\364\003\224"
+	.ascii	"\330\020\230\355v\310\005\331\021\261\007\305m\277}\237\305m"
+	.ascii	"\376\216E\266_s\261\256\343\00443\263\233\335e\3715\326Wh i\371"
+	.ascii	"V6\301\006\215\233\005\217n\020z\274"
+	.string	"Os\331\"\2213\377\271\236\323\202\337\312^\234i\037\347\001)\304e\3105U\365\033fX2g\037\306o-_\306%\223\t\364x\375\316\363\306\211\0353\034\020\260\314Y\224\3279\217\027\332\205=\346\273\370\213\013\276\314\243Q^>\366\350{\240\f\252|\314\002|jp-\272\222\032c\205p\025\306\276\355\2061\003'\243\025J\211\002H\005\241\204:\235\254RJ\251\224\ni\200I&*\250S\267\262`:\241T\350RN#TGJ\251:\023\004\3660\224R\335\312\363R]\036\256\3028\202\017\034LYTc\354\0312,A\225\264\237\203O\r\\\201\204\352\333F\244\221\0307 =R{Dh~jD\250B\r' `\002Bg;\007Y2\b\222\004f\301\260!\312\3014D\352M\036\230\311\330\261`\2722C[\314\216\337o\261\273\305\230\233{\005\373I\324\303\214\257-\223l\327\n\3554U\241\352\001\024"
+	.ascii	"\356}\n\262=\243\357\241\245s9\263\t`'o\232\005\265\007\020N"
+	.ascii	"\272doul\302\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\315\004u\022"
+	.string	"v\034kI\320VM:H4`\205sD\006\033\247\244C\"\271\350\324d\207Q\372&\342\016r%\017`\233\211\335\032\246^\006\027\250"
+	.string	"\2605\3168\343\214/ \221\376m\225\335/{\233|`nM\206\226\241\205Q\004\234\337\260\263$2\005V"
+	.string	"Y"
+	.string	"V"
+	.string	"7R\200f\316\372U\250(V\232>\025n\346Rd:\223\251\314[\304\376\302t\027\023\374-\346O`\37288\230\315\274\355\245\3465s]\211KN\353IZ\216d2E\260\263\3256\200'u\340A\346\377\216\212\"U\361\367otb\001PJ\251\201~\r\356\377,\n_\262\224\322?L\222\320g\262\021\030\002m>8\214\371\227\b\252\t\215"
+	.string	"r\360\030\363\357\251\365\370\324~\204~\202D"
+	.ascii	"\221\200}\253\211\006/\232\f\372>\026\364{(\350\363H\320\337"
+	.ascii	"\301\323\327\261\323\317\301\351\364\215\270\234\033\234>\215"
+	.ascii	"\033\034\233\223\363?'\322\0255\375\031\034-\247\362$\240\226"
+	.ascii	"\306\327\307\036\331\372\330\253\256\217\227\034_>\336\2726\330"
+	.ascii	"\307a\031\216+\344J%0\266\234Oe\353\334\215.\347\020\375) \372"
+	.ascii	"N>\364\211x\350\377\350\320\007\302\241/dC\277\324\320/\222\241"
+	.ascii	"?\004C\037\312\205\376\221\205~\223\n\375(\024\372G&t/U\332\212"
+	.ascii	"\277\331\212=R\266b\257\272V\274eL\305{\373T*\356\312X*\305^"
+	.ascii	"\351\215\263\220;\262\025.\022\212$\031\257\220wh\177\203E\n"
+	.ascii	"\"\220\205Y,\034`h\227\b\351\310\206\t\305])\203\342\2552\024"
+	.ascii	"\373\314\240\230\025\003\362\336\016\362\2261\220Y0&\016^\250"
+	.ascii	"\0210,\311\272\313H\2452\214\001\360\0021\032\245\003\021p\020"
+	.ascii	"\225\n\316D\"qR\322\003>\261\177\202;\017h\200\345\226e\312\354"
+	.ascii	"\303\214\215\177\025\001\237:G\271\275gnG\261\027\344<?5/\243"
+	.ascii	"\313\231\320\377\001\361\246IZ\336Y\201R@\"\031O0<\311x\202\341"
+	.ascii	"!\317(\323^\371\214tA8\3233\322\234\351\2124\300\262\345\342"
+	.ascii	"YyF\215\316\350\351\241\271\024*f\254\013\254\2221G\237\340g"
+	.ascii	"+\027@\3151[\017\360\3650\360\212\36754\366.\351bMo\3308\002"
+	.ascii	"|g\301*"
+	.text
+	.section	.gnu.lto_.refs.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\005\t"
+	.string	"\346W?-Pk\223\016"
+	.string	"\250\020\233\231\231\231\231\231\231\231\231\031b\321\030a\232\035_\024\373t\016\345\307\357G\303\357\337\004\251\2735\265F\b\3312\0050"
+	.string	"4"
+	.string	"2"
+	.string	"}\213\367\233\3475\354%^\207x\317\300~\341u\205\367\b\354\017\236\236y\036\343|\245o\271\207\270\036\335O\355#\366P\346O\337\365Y\337\362\255\b\327\312H\233\242\352\023\325o\252\256\251>\342\361\017\324;P\337\020{B\354\227\330#\261;\231;G\3362o0\357\264\364\370\215\250\257\021\375\031P\037\003\372/^?m@\333A\275E\235\275\236\257\367\025\300-Yyd\351\316\243\227]qC(=:\335\301:\274~b]\272\272s\275c\275\327\223\350\307\312\235\244\247\344g\322 \257,`\027\314'\260[\260G`\207\300\016\251\237\250\177\024\201\224\275eg\3313\007\234%+\217b\177bo\261\002\356G\031\303N\352K}\311_\033\013"
+	.ascii	"\356\302\005Q\260\231\231/\347B\345Y\270\205\354\322\020*\331"
+	.ascii	"x\347-|Z\2320\210\003\207\006"
+	.text
+	.section	.gnu.lto_.decls.2a396289f33651d2,"e",@progbits
+	.string	"(\265/\375`\336A\225&\001\272\005\346oW \fY9\351C\270V\320F\201\205\207\024\316\306~\020\351\370\221\312\277\236|\2550\337\214X\237Et\275\261\240\325\363, )TS\253\312z\234u\252\256o\003\360\333\245\221\257\370q\370\230/\027\274\305**\274u\277\344\243\223x\375\tsh\265p\364n\204\354-w\n\004\006\003\007"
+	.ascii	"\007l\356\030\306\240\n\235\375\305%V\345\326\367W\b~M"
+	.string	"\266\023\257\035\271:_\326\272D|P\311zr\376\3129o\250jTTi\365=\234n\362\237w\263\264\222M\2320\341\231\222\223u\306\244\223\364\022\250\274\003\013\206[\337\277\225\374\274\035/rl\034\373\376j\341\337\034\370w\206\021\242N\003V\003J\337\337(\"]\244&\373\330L\257s\352\013'B\036+]\033\353\333\031\taS\216\335\324B\352[\025\206\354\304f\2162\347L\304\201C\205\222\205N\356\274V\r\304\3141Hs\365\220\232l!o!\355\324T?\306\240\234},\217B\032F\343\250og%,Q\243\3149s\320\300\201\003O\013-+#\276?z\253&\033H\373\340\321Z\033\232\240Jx\263\006\244u\364\325\206&\250\022\256pQb+\\W\200\234\367\266\016\376[\353\335\303'j\r\211\013X\235\2653\243\352\355J\337\3338\214\365\372\302H\n.}o\315\340\327\344\327\364\216\263\271A\272\320"
+	.ascii	"\353{\013\207o\273\340[7\374\016\032G\307\350\252\372vF\302\027"
+	.ascii	"4\312\234\363\377\276\3219j\262q\264\r\034\235\242\243\352[\225"
+	.ascii	"\003\266\244Q\376\024A\342\004\354\274\267S\360e\342\024\305"
+	.ascii	"K\337\226\3213j\262k4\215\354\343\303\306\nK\222\276\267d\370"
+	.ascii	"D\3169\327c9w\307r\336:\301\267L\360\377\226\352\251\232l\252"
+	.ascii	"~\361:W\353\234\b\231\363\224\234\363;\370CP\365\212v\261\241"
+	.ascii	"\t\312\004\035l\2249#C\374\">h\252N\321Q?Fd\226\022A\233\033"
+	.ascii	"/,sF\022q\340\260\353QE\214\353\274\267-\360\337.\336-,T\213"
+	.ascii	"\253|\22632\310\332\200\2422\2074\223Uc\206\364\375_\223\315"
+	.ascii	"\242\231\220\231\210\007\315\212\314\246\357m\n\334*\372\251"
+	.ascii	"&/h\250\213\370\340\326H\006\344C\327EG\247\357\273\016~\275"
+	.ascii	"\340\254u\365\202\363\r\007\277\325\3407\034~'q]\347(XaM\372"
+	.ascii	"\276\251\324\365\023\\s\035:1T\241\363=\206+\262\016\235DU\350"
+	.ascii	"\004Q\205\316\372\246\302\251\311\rj\034$P\007\251\203V\326\367"
+	.ascii	"\335\004\277np\332\272\272\272\301\3716\202\345\376\252\246\252"
+	.ascii	"\325\270\272\203qe\254J\337\312\246\266\251I\rU\371zV\323\334"
+	.ascii	"dBfd\316\031\250\312m5Q\365}\003\301(\310\271j8k]]\325p\276\261"
+	.ascii	"\360Y\205N\fu\350<C\004\024\303*\nT\337\267\013\374\016\274\324"
+	.ascii	"7;6\205\245\374HS\346\214\374_\313T35Y]\250a~\221\371\025\354"
+	.ascii	"\017Q]\250b*\031;6\225\235~\304\350\240\211\214\032\230e\316"
+	.ascii	"H\016D\034|\244,\351\3208/\\\035\003\304b\310S\2202\270&\370"
+	.ascii	"5\013\177\251`\032\306\023\256\250\276\2575\276\324)\374\023"
+	.ascii	"\340\263U\241\263j\251pq^\210\352\373 \256W*\226\232\254R\301"
+	.ascii	"~\311\256\262Y\316H\037\313D\303\313Z_\"V\376\340\031\300\257"
+	.ascii	"E'P]]]]-"
+	.string	":O\002\276U\350\274\b\370\034\340\242:t\202\250C\347\023\200\317&u\350\274\013U\350\374+Z}R\241|\255\257rv\3129[\320`\342t,\373\326\263\020\257h\177uR\277\204\316\251*d>\3139\003Y\266,*\346\372v\025:\237\001\376[\035:{\252\320\371\267*tV\262\256c\265\354\225\254\"/\342\203\3678\345\257\234\221\225\354\346\314Tk\001~j-\200\211e\bS\331y\277\001\277\361\225U\350\304\240\016\235G\326\241\023W\241s\307\"\300\036\240\037\360[\rD\310\360\337\342\337n\177_\261\006\370\333\003\374_\340\337]\267\031\232\316\006\245\360\001\374\367\211\006\366\247'\366w\031*-\306fp\302\205\376k\344o\272\n\214\240D\243\360\n\376\253\325\341'|\367_\253\020l\001\376\232\242\351\374\225\216\305\240\2629\206\377\022\377\212\2155-\214JYu\"\345\277\362\257m\177\235\362\267i\t\320av"
+	.string	"\177\3752k)\277\275\300n\370\233-\214\025\262\002\370\037\307\006\300j\370O\364\177\004\366!\374\367\002\177gPm\374\260"
+	.string	"\370\355\220\255\340G[`\374\353VwY!\233\001\352?\3327\370?\002\004\264"
+	.ascii	"lP\365\362\005\374\327\202\277\322\261@\177g\320\027\364\005"
+	.ascii	"j\374\255\201\375\371;n\370\305\372\324\364\351\257\306\277\253"
+	.ascii	"\355!\263<\177\313\261"
+	.string	";\370'l\270\001\376{\364w\005\252\326\326_\261\345\375\325G\217\277\326Ylw=\201o8\002~{>\316\003\360\337\247\277j\371k\362\257n\177\315\362\327+\177\023\377j\343\2578\376j\365\237\367\3373\177\327\370\373\306\3376\376\246\361\267\214\277\253\376\316\361\367\004l\377\315\364w\214\277\251l\375\017\364\233\r\370\353\332\343~IPA\373+\362\257_\1775\373\253\223\277\222\375u\354\257a\177\365\372\253\330_\313x\376\373\201\277\276\370+\325_\245\376:u\363\267O~\373\277\351\376\236\373{\371\367\233\277\345\376.\3637\334\337Z\376n\373;\355\357\262\277\305\376\366\372\373\310\337[\177g\375\315\343\357\035\177[\375\235\376\235\302\337\275\277A\3607\n\177\237\3607\003\376\276\300\337&\374\335\301\337\025\370{\002\177\217\370\033\002\177\213\360\267\007\177\203\370\333\303\337\035\376N\300\337\033\374}\200\2773\370\033\203\277/\370["
+	.ascii	"\177[\360\367\320\337A\177\003\375\355\3637\317_\303\374m\376"
+	.ascii	"m\377\217\375]\377Z\367\327:\377K\374u\310_\211\374\225\316_"
+	.ascii	"\347\374U\371W6\177M\363W5\177-\363\3271\177\025\363\327/\377"
+	.ascii	"O\370+\376\037\347\257^\376\312\345\257[\376Z\345\257O\376z\374"
+	.ascii	"k\221\377$\376\032\344\257\\\177\225\361\327\030\177\215\372"
+	.ascii	"\237\201\377!\370\317\345\377P]]]\335\277\353\362\357\304\375"
+	.ascii	" jkL80\310\346[\316NX\306\b`Q9a\325\2002\303\242\n\2022\303\312"
+	.ascii	"F'\"\306\240\251\214e\2042\3139\310\311\311H\302\025\025\224"
+	.ascii	"\031S\016\2022\313T9\205\030\252\232\221X\306\354t\225\203\262"
+	.ascii	"Sf\312fWT\030@9aQA\2311Q\005A\231aQe3\254\214!;1ME9\345\251\240"
+	.ascii	"l\206\025\227\315\256\2500@\231]QA\231a\025\251]Qb2`\324\031"
+	.ascii	"\243\365Bm\203r\312/\\\344`\232\302\360\006\205\274\312fr\256"
+	.ascii	"g*\362T~\3139\203\234s\\M\231a\252Q\331\232\336^4Ma\272\252\310"
+	.ascii	"\234\263\006\027MYW\331\351\315X\363\033T\222\253\234\2234!e"
+	.ascii	"\0279\347\354\201\021\371\226\201\3247c\217\034\271\205\212\234"
+	.ascii	"\003\220\2219\273\310\331X\363[\316\331\230s\336M\345@\346|\003"
+	.ascii	"\003\324\321\205\213\234\253\210\\\344\034\3066\0259\367\031"
+	.ascii	"\0326*(\263\254\253\020mP\314\216\371\ti\254P-\256\3621\233\301"
+	.ascii	"\232\302f\306\261\334\"\347\\\335\340#U\f\271\2767\305\316ZZ"
+	.ascii	"\025U\337\363\210\341\333$\203\t\233\013}\317#\004_\243\001\272"
+	.ascii	"\202\364\350{\036\037\270\016\317\t\342B\222\276\347\211\201"
+	.ascii	"\353\364\311\366$\346\252\357y\236\350\360\312\270\261:\353\373"
+	.ascii	"\035\272\027\346P\311"
+	.ascii	"\322C\253\257]\"\315r\316\032*\033+:X\372~\007\r^\223&\307\302"
+	.ascii	"\251I\033\307,N\237\3317?Fd\246:\243\266z\244\350xz:\357o\335"
+	.ascii	"\334\276y\253\221 [\300S\333\342R\366\265r!n\3358 H\017\257\276"
+	.ascii	"\326*k\322*\333M\t\310l\374\221\3421\325\341;]\212,\033$P\017"
+	.ascii	"\023\r\2650}\277c\005\377\366\314\355\232\337\242\261i\254\032"
+	.ascii	"\2403[\310\030\221_9g ^\033\035%3\372\326\267:tn\250B\2475\023"
+	.ascii	"\342\366\314\216\213\007X\220\276\002\250Bg\2312`;`I\244\252"
+	.ascii	"\322\306\214\261b\2120d'\270\257c\236\252\352\260\213\253c,\353"
+	.ascii	"\373\2351\374\332U\355\333k\322\276Y1&Tf2\002\202\t\025\222\343"
+	.ascii	"2OUu(\302X\033c\303\\\373\245\344G[\337\357X\341\357\304\300"
+	.ascii	"\277\005\323n|\320\001"
+	.string	"k\362\002\224\204\263\203\255\357w\236\360o\273\274\222\355\234d\311:\343r\233\005\216\224\033\256\276\257jY\240\224WtG\233\305\362\360\252S\246\311\252r\352l\261nV\213MZ,5i\263\330+\335A\026\213U\345\324\267\255\b|\315)sF\326--\352\224=\367<:\370\267Vl\233\224\243\033\265\276Q,\225\037&\f9\023\371\242\254b\331j\322\266\265\331\265*W\337\266\256\227\333\225\262\314\332r\336\363\344\340\3274h]\216S\254\232M\253IK\345\rvV\343~\314\234\257\274\034\251X)5n'\210\021\037q\2108p\030\206i\321\301\367<9|\236\032|\236\031|^\030\374[(a=W>\214\254\350[\347\222\234yUy\261-)\322aG\324\272t0\021\3026f\301\354\023\373e\313,\231\025\263N,\322\232\325\244\r\273\035\206$\215-\347\254\004\354+\3146\3612\306\201\003\207\332c\356\314\020"
+	.string	"\334\363\276\340\363\270\340\363\334\360yX\360yU\360yk\370\274)\370<4|\036\024\374[#E>s\312459\026y\262\202\251F_[\204H\367\260\315\251\240q,v\b\317\t\231\315\200$\215@\372\236\027\206\177+d\003\354d%\355+\b\327n\206\215)h[\326\207\005b\265\354\217\232\264\\\266\207\023\217*K\343\017\301ekX\035\026y\304+\340n(\263^\330\035\\\366\252\243,\362\270\213\222eC\2313\222\313b}\315\216M\001@\005\234\224\222C\217\231E\301\350\271\347\005\301\347\365\300\347Y\341\363^\340\363\230\360\317\352\320iEtZ\275!\227\364=~\203\337AUG\375\330\234u\2649\332\0336GMZ\034\326FE\346\177\360\207\300aYt\324\256\210\321G\234\345\005t \251q\336c*\370X\n>\016\303g\253C\347og\\"
+	.string	"\204\244\341\242G\337\337\312\210\321e\334\374\350a\245,\f;e\251j\322\306\370\224\257\026;\330^\340"
+	.ascii	"s\361\265\037^\316nVl6\206e\361\265\372v\226S\220i\300%LV6\251"
+	.ascii	"\252l\t\331\271\307<\360\361\016|l\205\217q\340"
+	.string	"\337\256\270}:\245\\`\361\325\327>\325(UJ};\273K\346(\323\352\024\373T\251X\246\037#2\033wk\271\316\252\260Q\026\252&\355\223m\272u\262)\234\302\354S\025\253dg\221\253:%\007\"\016>U\256,k\340\273C\326\241\363\313*t~'g\215<5\224h<\372~w\246\256_h9=\327qz\331pzN\3235\235\256S\2236w\222^R\323\352\024'\265~\323jE`\231\216\306r\331H\032\314M\2313\322\346\216\322n\254\331\361\002YT\314l\256V\352\026kv\304iM^\224\035\326bm\306\224U\324\245D\276\256\261)\227\267\271\322\351#\326\354h\201,-\312\2343\027\233\353\232*W\305T\345L\345\201\223#\035\215\245\210\017l\256m\225\254\276Uec\234\006N\336\350h,\271\330\\\273T4\326\354\310{Q\326\205\213\315\325M\225S\305Te&c\bN\256\350h,9"
+	.ascii	"EI\022\207$\272\337-\301-\247\001\250\307\017&2}\277\363\201"
+	.ascii	"\317z\315\"\217\024hz\301\246\343\272MM\266\362N\312f\3531!\250"
+	.ascii	"\230\322@\223\013\245\262\327\274\313\206&\250\314\304\003\204"
+	.ascii	"\221\245\234,\313\013eK\313\016|\177\246\301\257j]4\324\267\255"
+	.ascii	"\b\034I\003\013\323\245\254sc\272\255\271lh\202\302\200\333\024"
+	.ascii	"e\235\373r,?\274\234\261\316\216_o^J(`\212\352\333\031\tl_\312"
+	.ascii	"\234\221cZ\314\261\3748a\310ND\232(\353\334{L{\321\360\303\204"
+	.ascii	"\314S'\220-7\312%\232V\323d\372L\273\320f:M\227\251\311\036\323"
+	.ascii	"p\034\210L(O\226t2\334\237>\360\317\035\370g\r\374S\n\377T\201"
+	.ascii	"o\326\341\233r\360\3155[\246\030\333\210\221\352{\263K\262\335"
+	.ascii	"j\262\265\264\225*\215\245\307\232\243\226\316\322X\352[\025"
+	.ascii	"2\303\310\260\306L\032\031K\253\226\346\315\223\363\336\304\201"
+	.ascii	"\345\n\017\035\230\025\335\225\266\362\023V\244E\217\2767\233"
+	.ascii	"\360\357\034\376\205\203\177\331\340^\373\373ICi5\022\230hQ\\"
+	.ascii	"\236\372\366\224\246\362V\353\264\334j\036\\\345\314\324j@s9"
+	.ascii	"3\001\325Z\200Z\013p\275\262\212H9\357\357\031\334h!\336RRl\265"
+	.ascii	"\200\321w\203*t\376\212\301\277^p#\353\320YD\326ec;b\226\324"
+	.ascii	");#\033\3739b\346\352\210|\217\235M?\255x\013\230\214\006\025"
+	.ascii	"\025\230\237\2519Tj\300\230_th\275h9\263,N\034\234\227k\360)"
+	.ascii	"\023\367$M\337[\251\254\024l}_\201\227\225+\246\226\313\"\347"
+	.ascii	"&\020\310&39W\025\001\240\312\222,\313M-7\335D|p,\021\240#\363"
+	.ascii	"J\376\274F\363\002\007\254\357+8\202\017\307\304\302\204\016"
+	.ascii	"\2132&\0265Nd\370\020\322\367\025d\341W\240\203\n\025\263\215"
+	.ascii	"\316\221\247B\206\223\032l7\333|\332(\321\226}\315\265\272\""
+	.ascii	"G3}M\265\nX<yb\246\031\333I\207Q\312\315\264\332D\213\234\217"
+	.ascii	"\276&Z\317\032\261,.\234U\255487\316\242\354\244\305YZ\201r\233"
+	.ascii	"\200\310\250\261\341\002%n\354cfY\305\200l\"\263\342\310C%LV"
+	.ascii	"\030\331\315\262\257EA\023\306\n\231\257/SlC\333O\021\036/\344"
+	.ascii	"\302n\212\255]\036fl\374\350k\202\t\271%IbzU\262,E\004\206\212"
+	.ascii	"\007F\007\f7\263\353\246\227\\\022\314\220\276f\023\223I\234"
+	.ascii	"\026\0302}\017\307d\362\237\3473wE#\r\023s\t\217\024J\302\330"
+	.ascii	"09lNW_S\211\020\022\256\233G.\363H\205S\221\271\352\312(w\200"
+	.ascii	"\035[\274h,3T\216\242#\037;\272\030\271y\344]\316\272'lX&\221"
+	.ascii	"\233E~\336\316\0052\\\310\372>\003\035l\n\2719\344\347\2318b"
+	.ascii	"\244I\322\367\031\342\340\337\f\362\363z\266\272|\221\353\373"
+	.ascii	"\fJ\374\fg\260\226\251en\021]\031\3434\3502\222Ec\231sU\321N"
+	.ascii	"R\b\230\243\371\343\346\226%\342\244\204jM_\323\207\024RNI\344"
+	.ascii	"?\357<\223\204\307S\337g\340\202\1773\313\314\262s%d&\252\242"
+	.ascii	"$\023\2227\313<\345\326\301\322\331\342\343J\337g\340\302\277"
+	.ascii	"\311\303\344Q\245X(\023.\307\212\034\313\033}\237a\007\376\315"
+	.ascii	"\035\346\016KG\204!;\225\211\261\345\251\252\016&\334\022!g\372"
+	.ascii	">\303T\234\2339\216i\025\242)3\021\301\240\213\007\317TX\031"
+	.ascii	"S\337\034\310\035\013\033ig}\237\241\t\277~\031\315\2464u\316"
+	.ascii	"\311d"
+	.string	"\372B\243\302\204\252o[\021X\002F\2313\322\\a\302Pk\2434it\n\223\351\314\261\312\304a\3360k\2303L\0335i\3220\243\322\2304\314\024fx\312\300)\362\366s\215_\263\241\t\252\204\2605\035\2300L\026&\025\017\0251E\302\226f\fSFM\2320N\304\201\203\006\037:g\226a\347\375M*s\212m\005\216\247\276\246\224\031\027\026=\372>\b\016\377\246\213\2324_"
+	.ascii	"=\035\251C\244\257\331\342k\242\214+X\034\313\2146'^\372>\350"
+	.ascii	"\r?h\013~\020\025l>a2J\253/}\037\024\005?\250\f?(\f?\250\013"
+	.ascii	"\377f\223\311d\232my\363\245\357o2E\301yi\321\324\367AJ\360\255"
+	.ascii	"s\353\200\274\330|\244\365\375\245\373\317;\201\013LZ\337;\327"
+	.ascii	"\\\212\034]\364\375\245\363c\206\b\332X\337\337\027\322\352\336"
+	.ascii	"\330\350{\347`\025A?6\330\261R\333\201C\316\357\234\377\222\271"
+	.ascii	"\313\026\352\352\310\351{3u\350\254OB\374\312\341\371\222E)\326"
+	.ascii	"\367A2\360\230_7c\356\233\242*&,\005t\215\345\350\260#v\306h"
+	.ascii	"\245/\322\205\021mH\337\333\346\306]\271\237\307\263\322\002"
+	.ascii	".G\337\007\265\300\277\312-1C\224\364\355z,\347]\363\313\346"
+	.ascii	"\347\355\276\246\234\320\372>\350\t\377\246\271j~\236\255\323"
+	.ascii	"\305JT\337c\250\303\277h\376\363R\220\206GW\337{\006\253\300"
+	.ascii	"\240\334\200\207\206lM\2202\327\205k\246\325H\320\002GU\233\276"
+	.ascii	"W\326\241\363\247\n\235\227L\210\3372]\344\214\013\227\276>U"
+	.ascii	"\350<\206,a\302\\18\017\301\331\031y\301\366D\214\021$Y-\230"
+	.ascii	"l\331r\301\340\234\263\021CnZ3w\334\201\0333\342\344\313/\030"
+	.ascii	".jp\340\364\275^p\2233Xu\372\336.\\z\\\271r\335\036@\005\215"
+	.ascii	"\362\330\006\007y\223\277nuj\332\276\372\336,\346\230V\233\230"
+	.ascii	"\276\027\013\220\332\230\231 }\017\207W\225\250uI\351{\f0\330"
+	.ascii	"\316v\253t\3169\037wP\206\240)O!c\242\250i\373\255R\343\216e"
+	.ascii	"b\360\350{8\035\365\237gf\305Q\263\326\367@q\230\n\225\253V\302"
+	.ascii	"\005\3116$\307\345\02670p}\325\326xU"
+	.string	"A\246\372\036(\fNK\273Z8c1\362\270\274\276\274\364=\020\032\376/\032\332\327J\250F\340\266|\320x|\361\352{ 0\374\337(Q\270\224@\\\370\277O\222\367\211\245K!\327)1YR\224f^fp\365=\220\r<6v\313p&\0223\"9.q\01385[\310~\313\254\027.$fU\216\030\222*\037}\017\324\002\377\367+\354\212\3316\3308\205\323\202lQ\346)d\207\377\304\001\003\273]5O9\371q\303\377A.\271^Kn\027\023&\267\253Z\241Brl\222\253\252\212\200\312(\237\2045\371\355\372\371\302\242\234\323\346?\257\207\205k\331\367?D\360\177f\034\271I\216\\\2553\347\212\274\222\232\312USEH\220\\-l\314\331\210\314RDmUE\025\307\221-M\372\376\307\005\276\017\035\376\357\361\330QDWF9\f\304\250\314\265\262\032F\372\336\307\r\376\025R/\021\"_\253S"
+	.ascii	"x*\023\242\034\023\344\006\271N\031\246N\200\363R\372h\271@\222"
+	.ascii	"\027\310UQ\2243\f\007t\031\221\034\227n\246\024\311}\357\303"
+	.ascii	"\206\377\373\243&\357\217*\247\350\212\211I\003%q8\313MG\212"
+	.ascii	"\276\367A\366\350q\265>Pb<\234_-SL\022\"R\372\336'\b~\207z\261"
+	.ascii	"\260\216\245\204\td\355P\346\251\252\016\247\017\255\272\264"
+	.ascii	"\276\367\331\201\177u\324{ue\347\352\024\206R\246C\231\247\334"
+	.ascii	":\354\316\276\300\210\323\367"
+	.string	">2\360\253\235;\377kee\213X\250\234\2514@b\004o%\223}\357\343\002\377V\325{\003G\030\037#~\217\233\032\311[\343k%\344\024c!(1\242\006\377\302\250W\306mqg|\355\346\263\234\202\254(\331\026\006\277\347\n\376\332\3776@\365\"'\352L\337\377R%/UGU\262,\265\363\024\006\316m\231\263[\007\2408K\254\202\364}\317\026\376\257\324_\237T(5y\245n\266P9\307P\200\2220\271\303{j\340\377\272xM^\027\227\351\222e\343n\215\255\252\203\217\232\027\030\221\276\357\211\201\177\237.\324o\324o\324eQs\316\271*\033\343<H\032Ar\\\346\252\251\242\377\256\370eQ\242K\013\246\276\207c\277\374\347\355(\351\021\344\005\374\277\276\37733M\345\234a\230\310<\325\324s\376\365\325\254\265\350\367\251\266f\360\377\376\037Rdf\242\033\223s\256o0\222\251O\230d\302\024"
+	.string	"\232\372\216\212%\b\n\005\201\304\235\0351\350\003\032\371P\020\226 \242\350\360\b5\302\260\223\002\203@\025~\302\244`\261\202#y\260 CRR1\030\024\006w\304\264\270\324\013\002\323$`1\205^\357\207\230\026\227.\212\244%`\232T\314"
+	.string	"\232\026\227\224\204#4\020\205?\037\317\t\341pi\311\327\023\021\364\245\276\036\244t\350\233\200\260\004\n#\241\004\206\302\364\207z@i(4A\f\372\206%48\222\007bR\222\357\207\224\372\224>\260 \034\"\245\302\340\316\204\017M\272)1(\374\231&\322 p\230t\242HZZ\302@\t\023H|H\321\243\241/\305@\205\2370i\004:\024\216"
+	.string	"B\217|Ct\205\021~?\337\016\212%\341\210\237t\351\303\321\222\320/X\244"
+	.string	"O\320D\233\304\336\321RO\332\013\036-\231\301\243%\213\266"
+	.ascii	"$^"
+	.string	"\024K\302\337\035\246K\366>(\206)\021x\204\242\320\313`\204\356\214Pb\361\022w\367\245>\243\024%\242\303\336\321\222\207\237\036\232\372\222\226\224\320\022GK\032R\224\004\007\212J\300\001\244\276\"\0072\204`\003(\244(\211\242\0220h8\024\216(\361\303 M\002\226 \nG\244\350\021\220R\221D\212\022Q\024\212J@\013\222P\017\374~>\0364\311\367#\201&\245\251p\210\224fPBS\"\n\022=\f\350\260\3303\244\004L\211\023\270@\204\007T\tX\242\003\0310\201X\024\002W@\207K\026\004\021\355@xH\207\276%\017)0hBQ\t\370\223\372R\342\216\b\210\302\021?K&\330\301\250\2210\003@\025\244\301\242p\004\217R\221\004\252\004,\361\373\371v\224\212$~?\337\311\003\302\003R*\024*\021{-\374~>\237\337\317\327\373\2318wBx\020\212\340\367\363\365\034\311\303\2577\374\360#"
+	.string	"\361\310\227D\201\243 Pi\350\343\301\360\373\371,\232\372\222\212\277$\337\210\242\022\220\350?\340\020\r\242G\370\036\200\300\001\b!\234\330=\004\021@\210"
+	.ascii	"\342|\b\"\204\b!\002\b!\360A\ba\323\036\021M:\n\2160D\223\212"
+	.ascii	"\023\360\r\021\323_\321H8\334@\2064M{\":H{\3034\365\t\251\360"
+	.ascii	"\023b\240\250\004\364I{\304\016\240J\300\024\247(\321\204\t\r"
+	.ascii	"\230`\207\242C\023F>\264\004\023\360\376\013\n\201\301!\232\372"
+	.ascii	"\212&\330A\215\212)0MG0\001/\355\371\322$\224\004T\t\230\362"
+	.ascii	"\024\225\200<,\370\2066)I8\274H\277\024\270d\262\340Ca\211h1"
+	.ascii	"\311\267\302\311\002\013}\202\205F\301B\267\300B\2378\321-\234"
+	.ascii	"h\024(\272\005\024\335B\013\235\366Dt\220\006\201;b\357\bh\""
+	.ascii	"(\034\201*\001\323`\021\205\242\0220\003pI\205\236\322\317\350"
+	.ascii	"L\362\375\214P\245\241/X\354\375~\276\0374\351("
+	.string	"\350\353%%\371\224\210<\351\221\210\210=\037\024'\332(\350K\301\310\307s$\017D\244\324\247\364!(TR\022\376\002\300B=QQ\324\026\352\221<\004\205\300\3247D\223\320\f\210\275\337\317g\246G\362p"
+	.string	"\324H8b\005t\330\223\002\365vG\362\220\376\212\303\224(\202\330;\201\246E\245 \025~\302\244^\357L\203E\341\257\327\333\r\321 \013\302^oG\034\242\304b\260\327\303FA\240\n\275\336I\f\002\227\210\275\336.(\004\022\201Ih\257\307K{)\021\230\204\341H\036\210\350\022\212\224\003#t\350C\"r\360\201\230\002S\370P\f\036qp\242\030\004&q\340\001\b=\020B8\361\0015*&\375\202\300\017Cb\361\003\003\322\023h0\311\027\034\242i\020\3303\362\241C\244t\251\327\263`\005t\270\324\353\235)\021\230\324\353\235\276\324g\324\353\235C\037\322\357\242-"
+	.string	"\211\275\336\251\302O\230tS`\320\204 \005R`\020x\016\323\r\374\202E\n\030\371P\024~\277\021*0BU\370\371\226Nbo\005\224\204\337\317\207\203\0240\362\241\3033%\366\200K$L\240$\240K(J\364L\330"
+	.string	"\t\036\364\027\364\245\304 \020\247=\r\230p\203\300\r\004\211\277\023\270D\264\304\336\b\021&\360\214\020a\002\357\374\211"
+	.string	"\332#y \026S\320@\354e\300\b\303\020M\211>\2453\355\205\220\006\201\305\035\221\210\016\215\214|;t\005_\022\211\342\222\022.\366V@\215\210\305\0240\261\207\376\200+\240$\020\213)\360\240=t\tE\tb1\005\036\272\204\"%\026S\330\021\213)\330\"\256@\210\336\357\347;\323\036\b!\322 p\307\202\017\205\021$\214p\246G\362P\\R\352\t\207(\216~?\337\007\342\020]\00184J\300\205K\350\360C*\024\016?\360\240=\024@|"
+	.ascii	"\002\204\342\222\222PP\bL\213IB\":\334!\366*@I\024\227\224x\316"
+	.ascii	"4\251HDQ\b\n\201\351\017MQ\022\212KJ\031\320^\360\b\230\344\353"
+	.ascii	"\r\205\304 J\374y\210\020#0\350\300\t\025\300?\017E%\340\207"
+	.ascii	"\024\351\b\230d\342C\020\350S\372\360\033\022?x\260 x\004L\032"
+	.ascii	"\341\367\363a\024F>\024\005_\3523\342\r\211&zHG@\244\336\357"
+	.ascii	"\347\353Y\0015\262#H\030\341\367\363\235IB\241\004z&\372\013"
+	.ascii	"j %\372P\f\244#\030\241\251\317h\251\003I\350\3577\002\021\250"
+	.ascii	"\341\377\371\343\262\370!\253\343Z\372h\323\205l.\213\027\244"
+	.ascii	"\031\326\022,\030=\264 sd\251\222\005\327b\205\031\023\254\256"
+	.ascii	"\223N\356I\033\2179 3WZ-\256\256\n\016K\037d;L\261\035\022\246"
+	.ascii	"&u:\256S\007q\343\001e\225vz-\021\003\313a\266\255y:2\345\304"
+	.ascii	"Q\345\324HA'\255\357Yu\332\370y\343\347\215>o\330\272\272\023"
+	.ascii	"lL\224\263\206\271\305\373rAm\n\231$J\22323\216\354\240,\325"
+	.ascii	"`\310\260b\324\254]Iq\306\360\312:\203\206\354\273vR\215\035"
+	.ascii	"s\316\030z\320\274\241r\246fj\016\215\315\033\213\276\257\311"
+	.ascii	"S\352j]4\033[Y/L9\237\031j\256|qq\231z\234\234\220Y-\312v\320"
+	.ascii	"\352\342\324\234,\314\245\033\233e_)\251 Wg\324\315utsG\372\""
+	.ascii	"y\330t\240\311\350{:\235N\247\212\020\300\214\310(\372\317\024"
+	.ascii	"?U\254\361h\321\2626d\210\r\377g\223\245\223##fy2\3357U\216\311"
+	.ascii	"\016\246\276g>3O\231\027\250!_ttf\331\006\261\270,\032! #\"g"
+	.ascii	"\344\205\027\314\271\n\304\302\300\271Y\257\2502;"
+	.string	"L:7\347\340<y\013\233\373\"5\367B\337\017\001\211\023\307\\\302m1\225<\324h\311\271\271\234\261\306JE\215\3739\276\021b\354\373\241\2527o\3142#6\216\311H\322\367C.\314\334Dc\306\224\213\261\245\214W\223->\246\324\265\271)w3\256&\215/\244(M6&\030\240\034Z\346p\254q\242\343\270f\215\251\206)\fXW\032\273D\356\304\254X\3444\346\031\036\214\247\"l/\220\271Y\206\214\tW\311\262\324\316\210W\031\257&\031\252\252\250\3418Y\001\205\f\227\233]\270\230p\267NYG\216]\r\2562^\313\fUU\0044\204\313\031\253\267\233p7\305\210\370\340X\264\214\261\300\321\367f\230\035$ZfL\372\236\203\204/\250\203\361SbD.KA \313\031\305\024D4E\234tS\025@ @L\036\023N\330\275\036\023@\203\214\355t\211\036&\031c2$\222$\005I\233\001&!"
+	.string	"\210S\034\245\023\004\244\332t\252Kx`\237\\\t\207i\233kU\016\342u\032\017\212\301d<\261[\020e\b\377\211\024X'\277\t_\020\251\341\352L"
+	.string	"\376\3458p\240\250\247\237\301\271dY\034\360\325m\210\266i\267\021z&l\247>{\361X\r\b3\356kBa\361\210:\320\177AG\213\344\304\251\225\332\205e\361\306:M\3377\b.\024\235{\244\375\265\230\365\032 \212 \021\347m\245\311`'\340a[\374\236\224e\364D[\214e\333\334M\252\024\377\200p\2261W90\212\302\237\262]\004\007\377y)<h!\214\023.\025\260\343\0018f\225\313J\367A\021\353 \315?\251\177\201\f\352\262\214\344\346\026\342\257\337\346\201\253$\232\374\330\216%\253\370(\002%D\257\230\250\257\351\355\224\244F\260\232v\262IlR\302\310\320\365\204\265q\356\360"
+	.string	"B\373\371\270\234#\205\330\245\373\006\220j\252&n5\364\317\366\265\276\236\301Lf\032\005h\242o\316\306\202\300wI\321(N\3407\242O\210S\013<D\237\022M.o\313J8=\345\351\210i\252\302\325\370\216\325\376\375\2773-S\017H!R\322\353U\034(\305\024\277\177r\025\242\007\231\026L\262\247\2243\245\323\253\002\242\251\367V\327_:\252g\222\204\r\273"
+	.string	"\021\271\377\257\2601\350n"
+	.string	"\253$\022,UK\023?\017\226!pH,\244\230\2761\333g\345=%\232Z\317\234Isq\035\274\035\355Bh\022\204\301e\352\364\242f\306\375^_\365}Y3j\027\335\320"
+	.string	"\rL\364\024\304\3303\n\026tL\337\251L\035#w\207\317\\\271\243\001\246\201\330\330\247\250a\327\246\236\177\247\263>\004D\206\253[x-7[\016F\232\214UCx\371\303\361\030\366x&}\004\\2\360\245P^\367G\030\205\204\250\210S\223\325\267\243\240\377\331\005\264 \320\353\267k\267\260;\373[(\034$\360\311\372\335\025\b3\354\325\001\022\243o\261,\tE\255\031\321\035*\314\0133\f\331l\b\355Z\222\303L\245\366\235\322N:\364\356\220\346\266\312\202\006\007t\n\224B\245\221\371j&\225\322\001A\311\027\342\260\275\212\346Q\270\004!`s\344\205\332\325\035\023\315\r\314\035\261U\304)^\317\266\265\350\n\272e\375\375\\u\3547\355qY\037N \347:}d\030K\212\212\023"
+	.ascii	"=\021\204#/\311\021\245\272B\260\240q\341 \261\331\262\3069\035"
+	.ascii	"2\267\331\217\177\2765M~9nO\377}T\372'(\321Hv\310\201\312\365"
+	.ascii	"\313\300\224\f\3533\350\214\242\252Nr\246$\343A\323=7\230\021"
+	.ascii	"C\333\247\033\312\356_\007\277\262\037\005\341\216\210\255z\324"
+	.ascii	"9#6jDb\225e\312Q\370\016\326\204\322\310\363\005!\21433B\037"
+	.ascii	"\337\225\312\215\264_\321 h\270/\026\235\2206 p\253?\364(;\361"
+	.ascii	"\374"
+	.ascii	"\250Qq\201]\"\226\237\026.\244\253\232\276\024\226>\006\337\343"
+	.ascii	"\227\232!\370\207\242\2210\201`\331V\237be\001\204\275\227\027"
+	.ascii	"\004\360\203\267\250\027$8\207\022-\3617\n{d@\3343>6\025\003"
+	.ascii	"\357\345\204+\326\231\036\320\225/I\337\326\360\331\273\"\003"
+	.ascii	"\004\310\n\254\223j\305]S\330RQ#\220\342\024\267W\\\312\331g"
+	.ascii	"\243\244\034\205\321\372\337\177^\207]\262\323\022\272\252v~"
+	.ascii	"4\215\322\351\034\306\t\301>\027\364J\230\034\207\253\360\211"
+	.ascii	"\212o4MI\330F\206\3433\013w\312\363\210~\245t\322\034\017\323"
+	.ascii	"81q,\037\004q\336\322\253L\204\027\267\3263\3108\254V\272!\253"
+	.ascii	"\200\276\317 \006\032\225w8\352\034\343\005p\374\223qb \272\206"
+	.ascii	"\r\033\222\311q\001\244\3672\372U\306R\b\202\021a\017\001\371"
+	.ascii	"::\311L\f\354\376\245\223D\233\335\300\322\371yrw\032\002\005"
+	.ascii	"-\306\313\215\225\344CI6\305\260:\260\026\345%\027\206V5\310"
+	.ascii	"\026\2412a\317\224P\366\367\245o\225\274/\370H\263\364\332{\033"
+	.ascii	"!o\231K\026\234\036\033hy)\001vS\"\366\032\272\350\346\016\317"
+	.ascii	"Y\332-\004\220\366|\020h\223\227CC\320IA0\037)\247\n\027\302"
+	.ascii	"\317\361@\230\272\222\261Q\214\351\202\257\222g\240\r`\227\325"
+	.ascii	"\246\002\341\305\201|\315I0AHOao\212\304\230\311\231<\243\303"
+	.ascii	"2r\201k\270\230g D\362\017\200rC\233\207\202\260g\267N\307\334"
+	.ascii	"\246\250_Je\322\236\250%R#\003\276.\214;\033_c$#:\245*\216\b"
+	.ascii	"0\273\320 \361Y\356\035\204\221\033\361\332\242\216U\330\307"
+	.ascii	"\210\244\200\245OM^\021P\333\333bJ{"
+	.string	"5&\202\216\034\247P\361\007\313o4\362X\017\032\005\030`\226b\245q\353\300\247\177ra$\003D\270\312\026l\003\201\351\273,\320NE\361\251\212\322E\364\274\322\036>ID\317\002_\277\177\276h\b\361\245q\240\335\312*9\336\207\314/\274\247\332>99\304\264LR\362\374\320\234&\245\263\2046\361]\331\332\233\177\031\020\327\331$az\331\270\313pc\021\036\260#/\323\326 \274Q\331\035\177\373\363%\237w\240\255\364\272\265\200\346T7\370\236\227S\002e\207qg\3609\022\334\177\001\217\226v\202\n\300\t\276\262m\314~f#c@\301#.-r\033\341\326\243\267;L\005_\243\350\366\f\276F\276@\222q\037\206\367\262\367\niL[\205>\020\306I\365d:?\361%\237.R\t.\227\261%\022\217\254\203o\217\331\223\037\303&\274\226a\217\256\266\372\263B>\322\bj\317\3103\311\371\032\251\365\022"
+	.string	"\020\216\346\254 \351r\271\"}\302\356\203\257\276\271\037\245\265\337\235_'\177u\233"
+	.ascii	"\220\272Q\304\314\275{\244\234xb\244C\313e\177\213v\335\260j"
+	.ascii	"\033\331\367\305\217\177\245\215m\333\277\222n\347&fHj\027qy"
+	.ascii	"\305\211\314C\263\177\201"
+	.string	"\352\r\017$\235~\373\277n5z\222\210\324\220 \326\024qw[\205Z\232[\204O\330~\206\251\324\346\242S\027d\201s\246\023U\271x\004\261\\\t\217\200\254MeV\373u\216\307\260dX\257\371\274aj\312_Ky\232h\324\221\345\247\220\276_\206\204\352\363\223\303\344\370>\020'N\255v\202\026\253]d\253-\026\225`\202u\221\330x&Ha\301\2410\003xRa.\315\013E\275R\246\271\252\200X\210\023(\321\302\207\314\0022=\253\242\321\237]Q\314V\247\365\364\330\003ta!\367\222\335\004\b-\343\317\212\212>\303;\367x3yq\331\2010U\374'\343\202\004\024[\361\275\bv\276\345\346u\266\003M\0308\024 \003B=P\272\246\256i\253a,\306L\363\215\350\262\002\276\300\257\306+\022K@\323Q\"*\277\001\324\304\216\321\262R\305}<\222\261\261\031c\244*mM\230Z\020\377I\264s"
+	.ascii	"_`\262\203\351O\331\321\276r\036r\254\370\322\326\352\n\\\004"
+	.ascii	"\324\316A\332}^\275\250\200\247T\276\303\252\377\257\311\252"
+	.ascii	"J\2724\232l\316\343ey\242\354\304\022\f\250\217\306\r\256\310"
+	.ascii	"\273\244 \004\007\353\026\334@\025)h\374\301vT\205\035%B\353"
+	.ascii	"\331Q.\214\214S\3242\371\340q^\257<\220\203\3221j\222\335\007"
+	.ascii	"|\200r\3342\360CO\313\0216\304\320\205\250>\326\315\213\016\356"
+	.ascii	"A\007\262d\237\323\331\345\034\261\246\321\016`\304\206\211\036"
+	.ascii	"n\334\314t\244^\301w6\374X\360\0203\375R}\274bl\236n\b^|+\377"
+	.ascii	"\316R5\366\375<(\363)\340\233\370\264ag[\226\277\025q\213^\373"
+	.ascii	"\364\335\345g\221\237@\343`V\222\274\354\344\231\244yw\360\205"
+	.ascii	"\026\373\214\362\207\344\222\303'\351\234M\267\231\344\364\001"
+	.ascii	"\353?\343\\\341{\207\n\247\3339ki\252\237\253\275\\\004f\217"
+	.ascii	"\206\207\307\334\237\306p\361\t\210\233\323\233\376\262\3131"
+	.ascii	"\016\340f\365\223\225\373\304\363>\250y\365\303\022i\242\361"
+	.ascii	"o\360i\301\331\223~|Q~[s\363q1x\244\232\027\2059\247\365G\365"
+	.ascii	"\263zf\006\266\351\377\357p\337\355\201\327-W[x\264\351\363\345"
+	.ascii	"`\323\232\303v\366X\270\022p3\333\377?f\304\376B\350\263\366"
+	.ascii	"\306\234 \272E\356\004\336=\276'\037\017\036\267\264)\356\202"
+	.ascii	"\215\374m\373\346,\351\226z\214vdJ\242\007D\"\303\357uZW"
+	.text
+	.section	.gnu.lto_.symtab.2a396289f33651d2,"e",@progbits
+	.string	"qAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"qOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"qHeadfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"quaternionTransformVectorBodyToEarth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"quaternionComputeProducts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"quaternionMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"quaternionConjugate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a396289f33651d2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
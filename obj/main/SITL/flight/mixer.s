@@ -0,0 +1 @@
+	.file	"mixer.c"
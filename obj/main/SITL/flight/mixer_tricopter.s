@@ -0,0 +1,363 @@
+	.file	"mixer_tricopter.c"
+	.section	.gnu.lto_.profile.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"$\0035"
+	.string	"\b"
+	.string	"\257\260\217\231\002"
+	.string	"\001\354\301\314\336\005"
+	.string	"\002\274\205\242\255\006"
+	.string	"\003\355\314\246\334\007\004\375\302\233\374\t\005\240\342\234\212\n\006\007\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"I\021e\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \037\275"
+	.string	""
+	.string	"h\023"
+	.string	"\003"
+	.string	"\001\003\001\001\003\002"
+	.string	"\001"
+	.string	"\003"
+	.string	"*\201_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \213U\002"
+	.string	"\024\003\177"
+	.string	"\003"
+	.string	""
+	.string	"\004\200\200\200\200\003d\003"
+	.string	"\001"
+	.string	"\001\002\003"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002d\002"
+	.string	"\002"
+	.string	"\002c"
+	.string	"\004\001"
+	.string	"\003d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\t"
+	.ascii	"G9\354\fnTT\313\224QT\f\2273>\315\343i\327\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001\001\003\177\002"
+	.string	"\001\001\001"
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 $\245"
+	.string	""
+	.string	"X\030"
+	.string	"\002"
+	.string	"\001@"
+	.string	"\001\001\002"
+	.string	"\003\020"
+	.ascii	"\204d\275a\001"
+	.text
+	.section	.gnu.lto_.lto.53aa012f59afc560,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tricopterMixerConfig_Registry.22.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \237\245\004"
+	.string	"d\ba"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\206\200\200\374\342\303\246\355\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\367\007us\307\007uq"
+	.string	"\005\001\006'\001\001\220\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/flight/mixer_tricopter.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_tricopterMixerConfig.24.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_mixerTricopterIsServoSaturated.25.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\335\007"
+	.string	"\302\31775`o\032\003T"
+	.string	"\007\213\030m>\361\270\3575\032A\375T\001\020*?M\3106/n\242\332\017\035\310\266}\004\020\250\204\262\327\030\255\025\007B\f\204m{K\231R\031\347y\230\333\234Y\246Xgf\034h\303\264\311A\314\354B\373HnBB\243\210\220\025\232\347#\261i!;\b\335@\331\224\334\266M\331\357\266\036O\215\033Q\034\265*w\224"
+	.string	"\343\027\0358\302h\022j\004W\355\027\202\321\243\265\365\377\215\247B\247l[\003\032\232\226\177c\365r\225\313\004\244m\327\n\264\205\2605\312\"\235SU5\363\237\240\224\374O\350B\200\257\2155\030_\226\0130\276\332V\201\241\253g\220\021YRH$.\377'\343\207=C\257\366\2109+\253\222)d\b\340\360\277\260d\342p\243\333r\3326\264\r\t\t"
+	.ascii	"xD\331Y\214!\004\342\002T\3522.\243B\032\303\221C\304\3165\237"
+	.text
+	.section	.gnu.lto_mixerTricopterMotorCorrection.26.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"\202M14Po\322\030 \233\366\273\036\302\304'/_o\211*\206dKT\232\032u\223\301\330\213\275\227\205\230$\"\346\035\2429c\253\246\310[\355\217\030j\355&{\313\0242\316\210\275+\217\264\346'V\227\234\r\322\252\27008# .\211\0078q9`\260\222\024\320cp\374X\022\316\030%\244H\253nt\351o\035\216\205\273x\022\250\271\217\327iww7\372&\340R\300\262\2731#\263-/%\344\317\236jJ\262\312\001\273\036+(\273\213p\002\200\276\177\025\321\221\354K\f\030\224\306K\206I\314\356B\216\022h\364M:\240\321\347@4\323\226\255Z\242\235\023\230\220\b\244m\263\260\273\267\220\210Cw\372\037\374\n\177G\b"
+	.ascii	"2\003\3769\003.T\271\206\324!\222\250\300\002\2402v\332\371\004"
+	.text
+	.section	.gnu.lto_mixerTricopterInit.27.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \305}\005"
+	.string	"\342\t&0pU\323\001"
+	.string	"\355\322\t\\\240`\234 W\210\345\370\3278\306=\217\232\233\273\255\351&\340\341\323\210\253*\013'\322~5`\370%!\262ho\231\002\257(jUlV\222V\b\2652\362\342Z\241H\313\204/2rqE1L5>1\213r\235\223\362\344\365\306n\241\211\233\337\323`\004\375;\350\356~\354~\210\030%"
+	.string	"\272=\005\004-@\b\020\375\337\351\331?\240\340\034\276N\351\353n\216\241\315\026f\337%\255a\343\264\205\205Gw\037n\334g\037\367?\343\277\343\277$\007"
+	.ascii	"3\003\316\231\001\340\313\3472\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \2245\003"
+	.string	"d\005\220"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\032\177\003\033\177\004\005\030\005\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\026\006gistry"
+	.string	""
+	.string	"\005\023\007\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\024\b\003\t\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"X2+\3476"
+	.ascii	"\355\300;\327\232x"
+	.text
+	.section	.gnu.lto_.refs.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\004\002\005\002\006\002\003"
+	.text
+	.section	.gnu.lto_.decls.53aa012f59afc560,"e",@progbits
+	.string	"(\265/\375`A\013u@"
+	.string	"\272v\344\031EP\036R:\363\240\355K\271\314Me\223\247\347\240^Xx\r\231\001k\036-F\374\313i\247\372o]z\211\267k\027S\177\2159\243"
+	.string	""
+	.ascii	"[c@R]F\001\026{\367,\024\272\311\021\026\225\026\023\220O\310"
+	.ascii	"\226)d\001\200\001\231\001N\355\317\346$3\347\254\243\367ffV"
+	.ascii	"\021\333\275\356\247\337\250\3255\253oF\222\355i\247\260%\301"
+	.ascii	"\360\372\177A~1\347d3\277\231\231\224\264\025}6s6\363\312Q\261"
+	.ascii	"\234\224\243\317\234\225\316\214\223\371\315M\244\254|6\3337"
+	.ascii	"\231g\371:\231I\371M2\263\322"
+	.string	"\211\354\374d.\321\222\310\244e\364\211LZ\276\317fVfd/\225fy\251t6\223\310\336's\031M6\221\226\321gs\354\313\0337MKe\306\321\025\226d\"I\227\2573\317\345\334hZ\231\311 \3470's.\351\325mYR\034YkIg\2779\347\002]YE\234Y)]Rq\346L%\353*\347\013\310W\232\225\264\024)\026\226\271\264r6\220\337\234\273rFv\226\346\234\2219g!f\330\2333\020\244\345XWW\316_K]9\f\351\246\2253F\253\323\326\\F\2138\177n^\242c\271\306\213\354%\2273\217\345\271'\263\215\"\271d\256\234s\337\265c\315\035z\360\332?v\230\375W\377\336\372O\347?\335\177\374w\334\337\b\376V\360w\202\277\017\374]\340o\246\277\233~\177\377\357\245\277\0074\205\377\276\037w\370\033\352o\247\277\037\374\315\340\177\335\377\265\377i\377\273\374?\361\237\304\177"
+	.string	"\377\343\376\263\323\351t\372\237\354\307\315\277\235\013\377\331\3518M\347\b\371\346\034\032\312|\224\345\345\374.A\210z\216![\327\226\323s\032\312\324s\257\317h\320\225A\200\274\264o&\266\247\315\304\036\277\355\261\222\266\333\264\233~\363\017\r\221\341\222\013#\322\276\245"
+	.string	"\222\274qR\005\257\270\377\306\366\2327\233\177H\250\214\251L\013k\337q\255\346\037R\005\251!c\003\257\307<\332w\232\377C3\354\020\271\202\327F\323ja\032NCu\314\352\230\340\365\215\346o2]\246\341R\344\254\3149\023\300\\`_x\360\332f\372\314\033\256\337T\244Y.\203\273\340\3149\331p\276@9'}\335M\335M+\226\"P\300\260\353qno\327\002\330\243Vb\233\355\367\036\363w[\273)\261\314\2577\243\345\234}\030\nZ\\\034^\377\266"
+	.ascii	"\266m%\326\250\225\330w\234\232Z\257\321\345\331\265rs|\302\034"
+	.ascii	"\357\275\366;o\250<\001\203\366\345K\247\265H9\353N\035;\214"
+	.ascii	"\203Y\007\b\355\235v\266\"0Z\246px=\336"
+	.string	"\337\326\036nY\326\340\365\275\244}g\351\262\267\226\206\266\226\356\322_\031\211G\340\351\345\313]^\376\n{\362\315\231\243\034\353\367\335\345\257\200\241\317\212rF\320\213\276\2459\361\332g\270\315:\372>k.\257\200\341E\312\\\226\363\333gk\316\311\356\246\243\356\246\336\233\223\344\031\273\376\330\036\357l\377\207\272\212\230+`\266\334\205Y\316\030\356\241}\276?aV9j\222\224\341\225\310\253\024\332\372\241\206\206\327\257=\332\267\033XO1\322\316\240$\316eu\266p\227\2256-(\007\366j\351\027RV\212\301c\327n`8\013\347#dR\316bt\306\202`'\036\202\3030\020,\244\241\030\f\343x\003\352@J\254\304`X\013\337hi\222\res\020\226 \020\311\301\203\"=Z{\372:\004YK\020[\352\354r~\2750\023\373h\351\327\233u\020\205\221\276\321\361\037\177\341\037\r\305^_z3\004\b\005\214"
+	.string	"\321\311\333\302\372\350Q\324v\003\254\006^1\217\216\306m\211\341\351h(\336q\307WC\212\240'x\305\315\327\331@\336\330R\365\264W\351\332\253m\270\3328vA\330\240i\257\276\265\270\006^6\324\t\3338\246\201\225\357%\337\374b&\202\322\316\326\332\267\023\253N\247\355\304^\375\322\342Vb\221Z"
+	.ascii	"{\025\332^\305\322\376\030\211s/\232f\017\033\234\233\216\272"
+	.ascii	"\344r\276IXn\rW\026^\257Zi\221"
+	.string	"Z\211]\320J,~\352\323~|X\332\216\250\345\221X\322F\r\257+\037\034\007e\254\013\357h\356I\032\227==\265\351\236\037x\355\273VKM\342\004 \210\230!}\3677[\353\2111\025\324\007\257\237k\001l\333\375\336y\210\330\230\261\203\342\265H\275\321\276\257t\213y\313U\300\320\320\026\323u\230\313\233C\006\333\r y\231\031\026\241}\270a\002\206W\272w\311h\316Z\224\267\273\266NC\333N\303\351\367\026\036\277\232 \342D\b\023P.0h\244r\027\270S\025,\254\250\"\262\220\002\032\211R>\030E\242T\001,\240{\204a\342\200\373\253\t\301\"T\260\250T5l\341\301\005\036\211\206*p\3578U\344N\r\203\305\3360XT\335\251\250_\013\214!<\256\307#\320heE%\004\243H\254Z\215nQ\275\021\f\243{\024\006\201%\230\334_\271S\031\334\241\260\205\020\f,\254\026V\275\343\324"
+	.string	"+\3400(dA%d\005<\266X\217B\247r\251\254\214S\301\342\204##\325U\325\032\024\252\030\022\245F"
+	.string	"]*\026E,\340\t\027x\004\226\b\026\035\270\302a\210"
+	.ascii	"C\242\320\255\002\032\215D)#\321%\216`\272\203\023\213@#\224"
+	.ascii	"K$\032\241\210X\020\211\034\246z\377\375\244\026\240 \361\241"
+	.ascii	"\255\232\340NA\271WA!\013\025PC!\025\026T\225\361\b5\241\201"
+	.ascii	"\025\320\2452\266p\251L\020]\030\201&\216!\214@\267H\254\022"
+	.ascii	"\032O\030\201/\204X\t^%4\002\207\300`\373\013Q\022\2422\274\020"
+	.ascii	"z"
+	.string	"\006\r\0244P`\237A\303\357\247!\352\327>\352\247J\301F\3306^h\354p\224\256[\311\310\3624\261\2227\024+\301P@\344d\363\351L\2363&/3\341\"\250\200\322\034)\203W\334\004;i\350\023~r\274\0043\371\220\362\315\321!9wA\320\346\332\367\023\353\353'vA\013`\327\025\016\t\2228OpS\217\034\220-b?\026\303F\032)g\311\201i\313\314\257\b\254\0265^x\360J\307:\337\232\320=\361\274\3774\264\361\340\347\022\227\027\031\200\272\250q0i\0204hDDDd$I\223\003`\002\221\261\262r\f\022@\b\261d\314\215$\005)h\366;W\240\363T>&\311\247\365\243\273\321\341\344\277\3166=\3737+\214\217=H\223\004\037\241\005LjQq`\023\355\206\331V\024 \366\005\355\233\240\347\013\"\273\024^\211a\025D\202m\225B\027\335\3263$\"\250\033\0054yH\\"
+	.string	"wV$7\340\277\215#\341\356=\246_\305\2476\262]\230\031\357\325Z!|\021\254\te\027\237\335\rsg\204\003\202\273\235\245\373q\376\273\\\205\210&\007\371\346!\330\257G\213\211?\016\326A\302\261\002d!V\320`&k\330\035(f"
+	.string	"\314\370qh\017-\002\232\213\006M4\270\223\276M\207\354A\306mQ\376\223\312\245\360\312\f;\026\210\346MR\322\032\2378\233\255r\340\202\345\367\230.\340\024\031\035*\024\321\274G\006\203\330\315u\261\231~\224\205\275\005n\331Y\325\024`\376\340"
+	.ascii	"\347\343\242\005\032E\335\301\252\225\032T\314\351{\246\005 "
+	.ascii	"\004\021U\313\320<\355\246\305q\316\216/4,\276B\371E\224\325"
+	.ascii	"}\315\f1\347\3429\205\364g\252'\262RKzb\317V\374{\363P"
+	.string	"\317\240\203&@N. !\256\352\275Z\271c\200T\231"
+	.ascii	"\261\233\337\306\367\355\262*\226Q[B\344\273\220\177\202\247"
+	.ascii	"\035\304\030Ri\177\307\375K\237\255\271\265\261\0323\327\215"
+	.ascii	"\261\207\343<\034l\r\352\3470X*tF\255W\001"
+	.text
+	.section	.gnu.lto_.symtab.53aa012f59afc560,"e",@progbits
+	.string	"mixerTricopterIsServoSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305"
+	.string	""
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_tricopterMixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"tricopterMixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"tricopterMixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"tricopterMixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.53aa012f59afc560,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
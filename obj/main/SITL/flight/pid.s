@@ -0,0 +1,2970 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001u"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\360\b\275\036"
+	.string	"\344\037\344\t"
+	.string	"\202\001"
+	.string	"\360\300\300\245\006\n\002"
+	.string	"\001\317\364\344\257\013\030\002\001\002\001\002\002"
+	.string	"\002\003\004\003\003\240\342\234\212\n\003\004\006\007\b\273\327\377\215\002"
+	.string	"\t\206\376\265\344\r\n\364\317\354\200\003(\002\005\002\005\002\006\002\006\002\007\002\007\002\b\002\t"
+	.string	"\002"
+	.string	""
+	.string	"\n\013\002\f\r\016\017\020\021\024\263\272\250\370\006\020\025\026\027\030\031\333\315\317\346\016 "
+	.string	"\r\002\r\b\002\b\033\352\263\360\321\b\034\035\036\037 !\330\255\367\375\f0\002\n\002\016"
+	.string	"\002\017\017\017\017\"#$%&'()*\200\321\333\236\n2\004\002\002\b\002\001+,-./\232\215\207\362\016\b\r\002\r012345\204\243\261\351\017\r\002\r6\304\310\377\261\004"
+	.string	"789\232\323\207\234\002"
+	.string	":;\351\264\363\336\004\b\013\002\f<=\335\210\325\316\r\006\001\002\001>?\314\256\230\325\016"
+	.string	"@\256\330\276\211\rA\315\343\301\244\013B\335\254\233\267\b\004CD\356\363\250\233\t\002EF\260\364\227\272\n0\002\020\005\002\016G\315\230\221\232\002ILNOPQRS\310\351\257\227\nT\327\255\213\231\013\002U\363\317\227\227\016\003V\242\262\337\300\tWX\357\270\266\376\002\340\001"
+	.string	"\002\021\005\n"
+	.string	"\005\n\003\n\nYZ[\\]^_`abcdefghijklmno\350\343\326\255\017\n\002\r\002\022"
+	.string	"\002"
+	.string	"pq\344\313\223\351\t\004r\256\276\333\351\006"
+	.string	"s\333\314\346\311\005"
+	.string	"t\337\324\324\321\f\001\002\001u\302\322\326\342\001\220\005\002\005\003\004\005\002\023"
+	.string	"\002\024\004\021vwxyz{|}~\177\350\300\306\254\005\002\200\001\332\253\224\346\201\001\202\271\345\236\005\006\202\001\203\001\377\341\234\356\013\204\001\336\215\314\344\r\205\001\231\232\327\211\002\206\001\207\001\266\264\346\335\017\210\001\226\210\220\365\005\211\212\001\277\332\376\350\b\213\001\240\342\234\212\n"
+	.string	"\201\035\250\201]B\"B\222\024\0242\314\001A\005\3141\006\231\365\022"
+	.ascii	"\023;J\224PQ\230\024T*{\354o\250\224\302\376\200\350\244W\236"
+	.ascii	"\023\211e\177#@\340\237\\gW\346\312\350>\273\260\273\032\273"
+	.ascii	"\277F{\255\367\025\363\005\372\265\2444\272?Q#\032\225\235\025"
+	.ascii	"\363E\334\024\254\027\t\007\350/z\021\364\374\n\226Qz\214\225"
+	.ascii	"\177\341)L\210\227\021V\230{N\230\366\212(<\2515\306v\350\177"
+	.ascii	"\364o\345\316\016\036SM\337\313\250}T\303\023+\276X\275\330="
+	.ascii	"\210S\3330\363\267/b\005qo\363\362I\266\376\nv\027\254\256k\205"
+	.ascii	"\212\364\307Z.\351D\205\231J\034x\033\230 5\222\241\314-\300"
+	.ascii	"o\350#\230\316\226\303\201\374`\321M[=\262\333\200\310\311\272"
+	.ascii	"\217_\375n\357'\300\013A\3312\334\344\240#\323X\344\234C\200"
+	.ascii	"\353\r\314\365\035\210\326\221>'CZ\007mkt\221\b\224\357\312\241"
+	.ascii	"\215\005[\305'\3376\004\016Z%LHb\025\375\275XliKD\t\374^\177"
+	.ascii	"\213\037\031\353\312\f\272\275\364c\006\342\177\357\234\016|"
+	.ascii	"\324\235\025\216\363\b\215S#\026\217\2229\237\2050\016n\264/"
+	.ascii	"\0360%U\3120\273U\"\201\2720vp\262\023\246\274\337!\217b\013"
+	.ascii	"\245Gor8\244\024>|\235\352\274\255K\340N\204>\270~L\242\217g"
+	.ascii	"\004{\006\314(\023\325D\223\305\")b9\366\263\302<\037[i5\311"
+	.ascii	"\271\\\356\226\347\3463\367J\350\340\3560\245I}\312\257.k\305"
+	.ascii	"\227\023yQ\304R\364\322\330b\b\202/\275\rz\217\003\322N\202\345"
+	.ascii	"Av<A\332Y]\225\361\253\330[T\350\363@p0||B\334\223\345\222\240"
+	.ascii	"LE\352\324\223\200n\372F~\206gcP"
+	.text
+	.section	.gnu.lto_.ipa_sra.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\216\002m\t"
+	.string	"2J\035\0370Q\223\016\335,\036\352\003C\203\026\345\214\265\261K\322\233A\340)7\237\355\177\373\226l\231R\226\352\177\224G\320O\351\361\266\004\275\270\225\331T\207\2568\312\215\247\261\031\351y\214\213-\256X\212\211\225\210\030\344%e\002\253!\036J\207\006\211N\236\353\305\306\235g\330\302SH@x\177\220\026\203\332a\026\260\023\301\252\f\314Y\002|%\346z\365\210\357,\260\242f\250\320\3166\2514\006\240\002\241\242\252\007\022"
+	.ascii	"F1K<'&\251\324\237a3\241\027\241\322\017\023\033X\232[iH\364"
+	.ascii	"(\352\353\"k\343f,\206\337q\274\317\335d\252\257\021d\0052\035"
+	.ascii	"E\361 \343\017\2500\264\210\225\217^i\332\374M[\377\305\001\033"
+	.ascii	"\215\2536\233\3578\360\020\365\300r\362!\033\213YR\004\342\226"
+	.ascii	"\372\351\274\033\336\025\017\337\2127\020e\037\231:\244\226\007"
+	.ascii	"\355\0078\206\004\033\276\333h\200})@398bm\303C\021\032\324\231"
+	.ascii	"Ot\200}vZ\231\213\246\037\331\323 v\331\350smPV5o\303E4\357-"
+	.ascii	"2f\321vE\374e\020\003"
+	.text
+	.section	.gnu.lto_.inline.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\231\016\2550"
+	.string	"\006\377\315E\240\034Q: \006\330|\257\311QQ\263\243\335qG\262\242\262\250.\244K\007\353\3652\024w6\"\257\345%\215z\377\333\367\2218\213\243\0017\221\212\321\241q\025\276\312\302\b\005\3246b\005\352\337\016\322\266\2242\005\270"
+	.string	"\276"
+	.string	"\273"
+	.string	"@\033\373\207\215#$\311\022\371\361\0376\006\216\036y\366\363\263\266ex\275%\363\342\345.\374m\273\244\310\213\346\020\"\255\362\377\243U*z\264N\212!<Z\335[Z\266\374\310:\226\037\351\025\307\\\320\324\251\341\241\t\222'1\030|\200\314\247\342i\233\325\245\f\214\241\317\317vr\367\363\337XO\233\253\"\nD\3767\332\242\3250\006\212\266\304\362\031\267_\312\330\350q:w\375\372\313|\374k\220\304\255\257\273]\373k\216\201\335\273\327\247\376z\375\376\177q\216\237\240\254HU\310\361\232>\275,\004F\272\337\332vw\207\177\210u\321\335\007\366\347\020;\243\273\215~\003\017@#[\343\030\204\377\264I\333]Z\275\204piu\337\253m\376\301\272``\214:G\226\326\t\026\034)\004\356\340W\361/\201U\335\353\215\177\336\340A\022\327"
+	.string	"\316\340\206Q\216\371t\373H\372\202\313|K\363\355\214\305\352\276\201\244\324Sz\202\271r\374\312\361+\233\226\307\246\245\364\362r\266UU^\344"
+	.string	"}\212\237M\254GK\320'\277\363;\233v\017\223\340\021\2361\f^\317\b\354\342g\374bH\022\031\363\277\355\r0_\346xp\375\034\376OZ\255\242I\253\333\177\365B\230\264N+wl\t\343\346U? o[\253\356~\331\026G/\211\214\027\0225PWt\ns\b~\343\006\310\325\373\234)D>\035\362\211\017\263\212\342\023\001\251~\276\247\3559Vf\200T\341\357\247\025\305\207\001aQ\254?eZ'\305\242L\253\373C)\276n\b\231\326\351K\347\021\213c\314;\334\026\n\312J\224y\016\377\273\205p\374\r\334\263\205\234\322}\352\336\271\256A\316\031\007\203\301\240l\021^.\205\220\300\352\326B\250\264\272\333Ju\357\200\236A\362\220x\227\371Z\227\327"
+	.string	"\341\336Y\316\302\252\302\363\372x\332*\331\361\013\202\247\202\301\340^\274\370\235\325\3667[\005\372s\233\243\2731\270\256`\344\023I+>L\001_3\204\343\352.\317\"\026\nU\367\343\274B\001\265m\353\023j\034\332\366\027\201\0267\322\026\312\342\177\273\366F|\250\201\232\327\335\322\023\221\254;\363\332\272\342\262\336P(\205Z.\355i\357H\274\237_\005\314\313|\252@\267\235\262\223%\215\320O\202\2034\023\031?bJ0\214\036,\220H\254\231\342M|f\312\314\235\245\"Sg\317"
+	.string	"\265\301C\312\r\354(\376\313O\321\242-\361=\237x\335\266=\267[k\256\332\\\005]\3474\224[`w\2137!^\024\267\305\332\344\033+\351\3338\252\273\203b\261q\024\3059\245\334Xl\034EqN\331\262\277}\032\363w\373\253}\355Xl\216\237\266\265\032G\334\370\213X.l\036<\364\361\211\302\226L\305\207)i\375\370\001\201d\250!I\206fddD\222\202\024$\215\001\021\205\n!f\235\264\003\022`\024-G\243\21493%2\"\222$\251\225v\003Z\204\226!\031\020\226\340#\251\266\224y\301MU\333\237\f\313NY\335+\032\364\253\372e\031\035\312\276n"
+	.string	"o\003-\263\037\021;E\321\276\257\215@\224+\304\205\242}\260\343HP$\016\352\373\214\243\365\312\0053`4\007\271\366\263\341G<\246\323x|\316uS\347>7'\341\214\024\020\360\231\b\222[%\251H\266"
+	.string	"\341\211s\266\362|U#\233ZCeA\352\364\337\016\025H\213\242\361"
+	.string	"\241\305O\304Y%\016S\227D\233\2442\3407l\260jI\207\200\232\347\200%Q\030)\347\377\025\367\204~\030\264/\206\377~BAe\320\315\271\230\t\331\215T\016\234t\315\013\r7\2068\233K\356=\373j6\263\023s\2638\023\312\245T\222\240\004>)\024S\234\356C\252{,\316\210EQ\313\304\226\036BB\345\301\036\267|`\267\037j\203\233\017\257\323\306\345ai\247\205\256\375\23799fD\214\210\030\0211\202\330\234\013\346\026\226\274\215\2057"
+	.string	"\020"
+	.string	""
+	.ascii	"\200\001\003\006\340e`\225L6]\006\351\342`=\341w\241U\220*\262"
+	.ascii	"\226\013\260\245\346\\~\245\265\210\273\274\r\363]\332\231:\211"
+	.ascii	"\355O\030G;\316P\230\205:`\026Q1hN&\306H0\b\001\237\035mP\244"
+	.ascii	" \313\013\250bW\230,\367\034P\366\342\204Uy\243\251)LM\024{\376"
+	.ascii	"E\316\365\317r\277\022F\212\275J\215\225\276\211E\366/\352\202"
+	.ascii	"\250~\013\302\241\004\246\333^\016\270r\202\202u\031\035\262"
+	.ascii	"\371\253Q\257\330\b\203\310\320-\276!\r\212\236\206\201Q\204"
+	.ascii	"=\362\031<\302\211gt\224\345\016\375\360M\303\362\244%\232\026"
+	.ascii	"\f\260\217\266D\304F\205$y\255\331\b!\013\243\031\346\262Z\325"
+	.ascii	"\235\373\354L%\367\215b\301\335eI\207\213\222J\374^hL\265\344"
+	.ascii	"\203`P{\351\2343\216\243\211\247\3502\372\2628\377K\273G\214"
+	.ascii	"\307Nr\343/\n\216\003\263\314\345M=\t\366\007\023\276f\367\343"
+	.ascii	"M\263\017-\346 \313+\267\270/\031.#9\264[\222\232y\222\243af"
+	.ascii	"j\222!PZr\315s\343\231\364F\330OA\2470V\251\303\340\311\250+"
+	.ascii	"f2\257R\345\345\006\270,\316\354\005\303\fZ\320\215\177w>\242"
+	.ascii	"\371\303\b\251\"8m\220\017h\023\277\373\313\363\324\244\340\267"
+	.ascii	"\027\2174th\300\361\302\350$'w(\244>\020\334?L\220&\242=\274"
+	.ascii	".\262\002C+\346\205H\325\357'\006\005\363\354\027.\274\n\221"
+	.ascii	"&A\301R\343.[\301ES\336q4)\362\301\376_\366\264jxTNk\206\rJ\311"
+	.ascii	"6\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\233\007=\025"
+	.string	"F\231L; q\222t0"
+	.string	"\f"
+	.string	"\3304\352E2s,\013\302\001\220"
+	.string	"\b\212\275\257\235\275\317z"
+	.string	"I\020\330\266\320!\362\033\035O\215\325\275\217\3063\b\213\337:\212i\325\256\326\004m\"\223\f7"
+	.string	"<"
+	.string	"?"
+	.ascii	"\233\333\004\267$\200J\275\247\264\364D~Ea\311%\263\306\252\206"
+	.ascii	"\002U\344-\220\236z(D\246\3126y\024\337\237\311\352\344\324N"
+	.ascii	"\270\235L\0329{\354U\276\314\020*\021\324T\231\324`\026\277b"
+	.ascii	"\006\254L\3234=b!\353CVW\323\264a\026\254\242\375N\254\366R\336"
+	.ascii	"\215\377A@\251|\312h#@\362\376\254\035\275\216\236\201^\200\366"
+	.ascii	"\322{l\314q!\017$\207\250\355o\030!\245\f$\006\314\005\336\305"
+	.ascii	"X\260?\023\253\024rv\361->P\305\247Y\251L\032\253\026\225\352"
+	.ascii	")\b\230@J\220\"\314\263\005\322\373\"\037\020L\352Y\036\244\270"
+	.ascii	"\036=\017\007\f\264\364\324?\202\234D\004\357\343\016y\003\216"
+	.ascii	"SB$D\222=\306\303\210\3164\213k(\246\340\315]\275\270m\273i\237"
+	.ascii	"rDU\033\020\234\261\214\016\031\221\350tH2\025\354\376 y\340"
+	.ascii	"m\035\002\200\251\250\201\271RDC"
+	.string	"\013\222T\2069P\002!\206\252\312\003\022\200B1\f\003R\2249\306\214M\230\240\205\005\205\3723\006\2303\364\017\351\372\272\303\001\001`\035\362\362\365r\365\317\035^\tZ\t2y3'\244KO\223V\331\307#+\311?*\245\nz\0207\230\207\231\354O\204Y\037\251'\300\373\335\276\205o\224\366\333\3760q\223\177e\201\346d\323\020x\377\001\310\200\307u\202\323le\235)\250\221\307\025o\005\016\r\261IA\370f\373\300\007cR7\003\366\351\277\322t`\275\213\316\r\334\340T\006\360\363\321l |\217Y\362\027\016\024\2704\013jE\265\252\302jN\267c\351\326\025\020\314\006\022I\226\200\247N\016WXh\345\276*La8\004\243\307f\366\204\177\320W\213H\035M\n(\251\311\276\025\360\356\270\323\001\346\330\016\254W<\210\260\276\032\354~\316]\353\335A\220\021T*\254u\r\027\357S\030\247\350\353\002 "
+	.string	"O\001\224\351\006\244-H\234kF\256<\352\304\253\310\224\306\346\240\272\366C\364\024v\317\305\bE\031\362\361M\230\"\212\025\237\2445.Pd-"
+	.ascii	"z\246]\240IM\331jX/\373\206r\217\233\240\023\311{\3200\316\230"
+	.ascii	"2\240\340\233.\307\2711\332\031\206\033X{\034\264\303\005c\345"
+	.ascii	"g>k\216\324\b\265\374\276\200\303P\0237\006"
+	.text
+	.section	.gnu.lto_.pureconst.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 r\315\002"
+	.string	"\"G\025\032p94\006T\207'\302\031}\310\377\037\307\373\334\343\370\2658\237v\024s\271\003.\013\271\f\344\366qS.\217\327q\216j\343\032\3178\306\263x\305)>q\211\027q\210\353\341\016o8\303\027\256\360\204#\374`d\360\b>p\201\027p\200\233Q*\244\224.\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`E\003m\017"
+	.string	"\266\025E9@O\223\341`\024\343\002F1\032\030U\335\321\263X\356i\022B\005\317\225\217SN\256\341\222\2304\234X\022\254\260\215\2655\323\241\202\277\244\261\264Bve1l\262\311&R\2461"
+	.string	"/"
+	.string	"7"
+	.string	"\223\362I\237-C*0\325\240\234R\002\345\f\032}g\nE"
+	.string	"\230\212\016\313\004\350o\031t\363\005\n:'\244\034RF~\007\224?\365\372\201\335\263*\030R^\212D\236\rS\216\341\245\374R\367\277\206AuJ\360\217\362G=\357\311-\235\225\362\212sLc\362\271\250c\262\252\364\227\205Xhf \3563]\240\371s-b1\2178vb\222.\346\316\261\026\363\246p_s\215k\030\363"
+	.ascii	"U\373\006\r\0162t\306\360\231\362LK"
+	.string	"\261\002\205\237\300\221\320\b\020\272\311\374\001[*\313\005\016\325\364O\027Y\202DG\320z\317?\350\246Q\221\210\020\034\202\370\303{\260\240a\241X\261a]H4\235\222\013;\274\347\254\3278\036\2738\236\004\372\2747\346\322\002\212\300\005c\250\001E\344\034\"\n\f\253\331\r0\002\202\220:\273\001\020(\245\350LJ\351\262\034\240B\371q\177\255\353\217\314\222\351\254\340\\\020\302\216+1\216\242\312\316\031-0\357\276V\261\253\272s\325\252p\222\232\b\340\204\006\347\213\355\326\224\243[y\34502\313|\351\031\2443\324\220\331\217\017\252G\0224\256!\001K|L\265\210\002f+!\322t\334\b\376\307|\247LL\214\370\276\001\211\\\262\351\321\231\330\212\311_\3513\f{Y\354B\305\364#\201\006\3273T\276FX\324\025\037\302\304\254\262\200MM\034\217w0\315\226\353\337\002~\334\r#s\236\366\374j\370\310\372\317"
+	.ascii	"\320\343\364\021PX7\272\273\371\236\251M\275\323\255\217\376"
+	.ascii	"\246\261\310\243\361\030(\224\311>\217A\024"
+	.text
+	.section	.gnu.lto_.lto.8052e9c2e6d81296,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.56.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.71.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\327\301\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\314\006us\250\346\005uq"
+	.string	"\005\001\006'\001\006\370\303"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.73.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 8\235\001"
+	.string	"\204\002+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\024\005\001\006'\001\364\003\001\002?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.string	")\"\300\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.77.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 \225-\004"
+	.string	"D\007c"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\304\362\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\236\003\216\3400om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\005"
+	.ascii	"[\tV\271\tf\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_resetPidProfile.78.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\325\b"
+	.string	"\346\221@:@\305(\035\340\355\b1d\314\215E\236\342{1\3060\317\321\337Rt3\275\267\b\372\203\370\321\264\210\003\025\206j\373\324n\306\211)\217[6\301\23798\357f-\331d\313\224\002-"
+	.string	"/"
+	.string	"/"
+	.string	"\331%\346\004\331\245?{\345\341i\257\312\300P\271vw\306\216\177\327\317\177\310\003\300\322\350zY\330]+X\332\270\343m\033\330V\260\315\n\273\353h\262\237\372\025\363\326\305\202\220\262\253\021"
+	.string	"\300\262\344\211\207\352\355gl_\355\177\034\344{\252\342\003\273\246\222\325n\230\340\003\314\245\303k\002F\311\036\236\304S\225\323.\351\240/\362\221\020v\324\245)\274\354\340\245\357e\227\032m\211\t=h\r\312d\365j\221\342\310\016G\0329\354c\033\036\220\366\331:\206\216\306\t\230\263\351h\334\024=8h\240\317\214\320\032 &\247\013\315M\2017\316\323M\321\266u3\023\356\261\215&c-\373jY\304\013_\364\340\003\007"
+	.ascii	"2\241\311/\360\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.79.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\215\001\325\017"
+	.string	"f\037kE\360\262&\0352\343C\240\006\264\030k<\325D\263\357\257UP:\217\001u)\n\024\224x\304\304u\201\026s\267\026\364z\205V\332r\320\200\325m\"\264\201\033\021\226\232\021\374\313aQ\271\243{\225\021B\366\2262\245U"
+	.string	"V"
+	.string	"R"
+	.ascii	"\026\331\036\375\275"
+	.string	"@\366\270\235@\366h\222\255\343_\314\0366\"\365\352\261\273\234\212\260\036~7L\322#\324$\371\232\311\314\021\264b\236\252\364\b\005\354n\210J\003\\\220.\252S\302\022/\327\277\236\240\325\343\251^\236\232\311\356:=U\207;\273m\221\355\006\366u\0022\277v\327\r\237VM\247\246\037 \304\306\r\007;\273\033b@\226'\316 q\327o\337gqX\313k\254\036r\376\371/\177Z\234\206t\227il%\016\033,\305\342\261\273#\217f\260=\036\200-\366\347\361\037\333O\373*\276\202t\031\f\037\260\273\252\201\263\373\221\0049bvQ\367\374\027\207\001\202g=\272\302(\273\367\350\217\262GU\037f\341B\336\363a\377\007\226\f\034\037<PZr\252\246\252\277A\241\270w\353d\327\324\243L\2342f\250\327\277\036A\264v\244\202\2302\246\272\273%U\030\373;\345ww\255+{{\335G)+\235\nH\364"
+	.string	"\245\013}|R\202\322\2058\026\t\021\272\025\025\216B\007a\002w\"\032q%\006\f\n\245\2108\026\020H\304}>\323\277\272\362g\276\305\330\3411\351)*\214\265\226n\252.r\344P]H\016\365)hpd\310\037\207\320\n\016u\0239\221s\352\251\t\001 o\363\333\374f\224\001\036"
+	.ascii	"3\241\365i\f\246\001\215\332.\222\265\324\230\235\314\214i\314"
+	.ascii	" \036\266N\025\354\210\246\021\230\226\202\021.\207\246e0\013"
+	.ascii	"3\2101\340\322\006\325\002\272Z\016\304\365*M\263j%\020\0277"
+	.ascii	"D\224\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.82.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"=\b"
+	.string	"\026\220;8@s\322\001\030\254\025y\202\0206\\\215\277F\004bv\277\333~IPi\246Nk4\033\222\345FV\221\3307\031w\341\350\347Q\227\203\005)\212\257\245\tU\262\311\336)\005)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\346l\231\177\037\373\224\225\013\024\232\335\235\321\343\334!\347\277\344\233\316D:\004X\330]\303\316\224q\307\3336\260\235`\333\013\276\367CK`\343Eaf\027cU\263*\331\022\302\261}h\177\344$\334=\247\274\331uQa\331]\004\037\004\\\026|\340\272\264\336\271\002\361d\007\016U)Z\030F\337\344'N\371 \2560\n\276\273\364\215\272.%L\214\210F\t\256\354\217\004c\207}kw\327\361\344U\333>\225\202(\2061\204*\335\032(\250\250c\314\363\220\215\346&\021\221\201 \246(\373\204&V'\246\207\300\332\210\326\271iZ\235\234oom\b"
+	.ascii	"2\241\205/0\340\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.83.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\r\007"
+	.string	"2\315/4`m\322\001PX\003\3136\270\026tYq;\n:]\3538\265P\210B\267\206|\300\022\322\341\277\370\023Y"
+	.string	""
+	.string	"3\214]\257h\260\201\005.\261\355-eJ\001\236\244\005\312\202\330\203\003\005\321"
+	.string	"%(\205\b8]\023P\032pe1\\\020\253\252\013Fq\357V7N\t,zq\352\325\3511\036\227H\221\357\334c\020_\303\025\376\344\267?\337\037\312\3375\340\302\222!;VR1\354\273\325\215\355\264\313tf\372O\200\303\004Ad7\023\002m\311\013\331\260}\333\231\035\331\340 \263\366\230\2219g\004\363q\262\033\241r\256=5\377\035w\240\016\311\246\251<\001\022v\327\271i,n}\201mO\f"
+	.ascii	"2\241\205\037x\306\204\005\371\300`>\263`Q\344\271\206\357\f"
+	.ascii	"Q\302]\226f\303\273\356\r"
+	.text
+	.section	.gnu.lto_pidStabilisationState.84.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\345\b"
+	.string	"f\321@;0\345(\035\200\337\212\243\n\360\031<B\017\276\260)\013.h\240zx\320\316\303;\265\037\373\f\226 \202\330\024\020\225M\245\304@C:y\341\302H2j8\366\0275\331d\357\224\002-"
+	.string	"/"
+	.string	"0"
+	.string	"\024;Av\352\320\206\271\b\262o\255d\234\274v\267\316\217\207\227\241\377\222oN)\322e\300\303\356Z\236R\033\367\274\355\004\333\r\266U\002\273\236*\373\253_J\351\323\021\352%\3430\356j\214"
+	.string	"\226\205\272D8\266/\355\217\234$\374j\344\315.\307K\312\256\270`\005\201S\204\027d\0171\245i\362\247or\026\206\037\342\013\221\374\351\324\027e\247\007\254\026\224\231\222\034\375\21729?\031:hL.-\227I\216\266H\222\323\303>\266\033\032\350\001#>\215\343\272\017\fu\020\240\315\033\360\247\003\332\274\nRLl\234D\rm\236\212\372\371,j\307\300\235\247}\025\354\272\257r\304=\266Se,"
+	.string	"\252&\b"
+	.ascii	"2\241\261/P\300\205#0\352\022\026\261\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.85.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_dtermNotchApplyFn.87.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 @\001\002"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\375\323\013\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.text
+	.section	.gnu.lto_dtermLowpassApplyFn.89.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 @\001\002"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\376\363\013\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.text
+	.section	.gnu.lto_pidInitFilters.101.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\270\f\225="
+	.string	"\372g\310\02690\352\315\030$/\247\030\270\305J"
+	.ascii	".{\331ZHk\276f{&A\266\313\024\237\210\360\037\3130\311\227\317"
+	.ascii	"gww\371,2\372\365=\336\267o\277n\"$\211\310\235RJ\001[\001@\001"
+	.ascii	"]\001\241\336D\353\237\231\346\323\335\327\275\327\255\327M\247"
+	.ascii	"\373N\263\314\375\307Gn\312\031\034~L\263\344kFEtF\0177\337\036"
+	.ascii	"\377\311\243'hF\333x\270\363\360\261W=$\355sm\231F\365\003|\337"
+	.ascii	"\267E\333\3537^\347\361\261N\333q\373\216\222\366\271\326\352"
+	.ascii	"\201B\327\241\355\2259\354j\317q\233\016\223\366\335\323\242"
+	.ascii	"\351\271\001|\337*\203^YB\333k\322\333\231\033N\307q\373\316"
+	.ascii	"IS\275\357\333\240=\357[u\300\\m\257\\\355+\266\327\266\225l"
+	.ascii	"\257\314.\263\245\256\302\275\255GE\263\343\351}\337\257'\243"
+	.ascii	"L\362\367\260\332\\\034\272m\245\254\272\242JN!\245\242\226G"
+	.ascii	"c\261%\262\353\360\335\345&z80\350Q\224\355\331V\303$\204\277"
+	.ascii	"8W\022=\214i\223\353*\271\276\372\233+\343TT\277-\236\204"
+	.string	"\353\251\"(4H\242\007\023TK\230\302\264yi\251\2725.]<\252\313\340zI\347\307!\323\217:d\346iq\3430\t\341}\337\2725\251\027\265\306\264a\351\226\245\n\302\024\246\rK\023\207^\200|8]\251\321E\321\234\345k-\250\257F6+=\\\264\226\345\310f\346\217d{2d\276\357\333y\355ilg\356D\017\357\373\262G\331\332\232\0014s\0032s\016\346c\215\375\250\3755\020\221\335]\377O\231\302\023\177\007\236!3\377\304\354\023\277\321\bUt#\026\354\257j\f\t\256\317\250\005\367\365\246h&1\223\350T;\024\026\006\232\275o\331\326\360\327_+\375\017\337\355@\001\371E'\212\321\276\257Y\005nDn\233\214v\316\t\333\353\177\361\255\220\335\235?\205\367F\320Ce~\315\303\367-\333\352\367oh\335\223&\324\205\330\217\006\367q\037\333k\277T` ;i\226 \033&&\341\320A"
+	.string	"\322\373\226u\224\333O\377\001\343\236\3430\037\336\321^\271}\260\275\336\310\363(\352V\346\205\314\325\247\377\364}\337'\377\0333\t\020\033Z\2579\303\205\276\353\256\320w\232)4\237f\257\356k\356\352\275\346\005M\247\231kuV\260:'8:#X\235\267\214\316\007Xg\255\325\231\311:\033X\235\013\030\235\263Xg\002\253\363\200\242\263\200\3259"
+	.ascii	"\321\031\253u\006pt^\256\316WFg+\242\263ru\256b\235\251Z\347"
+	.ascii	"$\321y\252\350\214l\235\245V\347\250\325\371Ht6\266\316E\242"
+	.ascii	"s\333:\023\211\316\354\352\274\256\316C\326\371Wg_\235\373\304"
+	.ascii	"\262\215\"\023\201\336W\2550W\260\270Z\264\260\275.#x\325[yq"
+	.ascii	"\301xG\257\224o\365^I\316\241,\224\337\206\250w\204\334\214\375"
+	.ascii	"\304p_\325\257~8\tJ\335\251K\206\203?\273\256\357Q\324\255\205"
+	.ascii	"{\327\336\367\355R\002J\364\364A\226\372)g\261T\177\004/\022"
+	.ascii	"\265\007cP}\3735W``\324\362\337\222\357n\360\fM}\362YCh\204\307"
+	.ascii	"\237N\352\251\337\341\3125\250\251\357\274N\240\306\222\340\235"
+	.ascii	"\361\247,%\251\335\360k\034\221A/\3704\007\275\340\375\256\t"
+	.ascii	"\013U\201Sl\320\013~\303w!\276<h\227.\357v\315\260\031^\352\243"
+	.ascii	"\036\371\314.\0327\215w\224\207\257\364\237\314\335)\b\022R\224"
+	.ascii	"\2569\271k\032@z\337\367B`or\3310\273v\356\033\367\r\333+\362"
+	.ascii	";\352V\206\2513\271q\\9\037\274\243\037\330^\245\276\371z\313"
+	.ascii	"\017%Ai\231\027>#:S+\323\026\360\343G=s\210\021\336\321\f\317"
+	.ascii	"<\373's}\324\267\361\217\337d\257\020\nX\342\304W\245\316\323"
+	.ascii	"\276\247)\352f \320\231\032\361\247\314\2025~[\222d\374\243\231"
+	.ascii	"\243N\364S\356HW\b\207\027\276\355\256\3649\373\\\237\306\204"
+	.ascii	"\345z\2541l\360$\231\371\247^\177z\341\311\364\024\242\021r\365"
+	.ascii	"}\337a\361\307\360\n\265_D\021\315.\322L\242c\310B\bKV\244i\204"
+	.ascii	"\210\222\024J\300\204\204\031!\0226&\202Gs\210r\t\211\037"
+	.string	"`db)\202\214\205\271\340\021\025\006\244\331Cll\005\217\346\020#\203=\340\321\034\362E\366\303G\023H\217/!M\035A\276\300\306\212|=\300b\261!ac_dbbc_\307\352\333\3360\354\022\225\375\023\306\340\n\342\300\271\324\364\216&\370\251\346?\254\0026\t\370\004\245V?\345b\226*\022\277\306]1h/\257oKC\245\327\223\370n\023\324\t\332\345\311\326#P\323D\306y\032\227\212\002Hh\274\316\211\311\251\311\271\311\271\211\355\025\001\363\017l\275\326\037\370\246s\n:;9\007\265\276(\235c~\377\365\326\237\274\257\272j\247 k\300\341\234\352\024t\202r\016:\007\331^\r\374[\271#(\305\340\005\276\361\370\230f\353o>u\2518\013\233M\266\327\b>\340\263\n<\201\317z\007h\204O\377\022\203\300k\210\324e\200\377\261c'\245\232\002\361k\334\222Awu%\273\036D\241Oqp"
+	.string	"\037\340\005\234\271hP-A\240x\026w\r\007,\256\025\013R\001X\037\340\275\022\024\320\r\353\033P\244;\257\002\340W?\203vR6?\277/o\027\262\017\"$\006\277\372\245\024W\215y\346R\232K\227\315\243\270T,\300\275\357[\241\3279Os\255L\200s(\036u\003\201\001\250a$D\031dhFDD\222\024$\031\016q\005\304 \007\031\362\001\021 \261d\252H4IA\322\030\323'\035oD\325k\022Sp9\300\321\203\261\221\267\317PT\223D{\274\377 \022G$\2526\366\t\022\351N \331\003\177`\260\221\007\241\347P\314\256\335\253\221=\364\274\362\314\371s\316\257\334wr\2344\034\3414\023\030N\252\357\357o\301\251\231\344\321\313#\342*Z\177\253\251\340v\005\361P{\330\004\246\276l\236y\007)\203\206\302z\254C\201$t\372\326\024y$?\022\003I"
+	.string	"s\253\307~#z#\177\177\037ON\030\354\3673\016\377N,rBB\251\t\274\030\325\217\250\3650v"
+	.string	"\306\006\302zMB\364q\226\200\200T\204\307\271+\025q\n\200\342\301\220r}\227\331>ESaz\217v\240+bd\r\355\312\rJ\214,z>\347\244\210\224\361\214+f\220Q\352\264w\352*\216\357\341\307\347\221\236\200\277o\233\032\205=\025\300\035\252nT)\303%4\341\323\3272\251\256P\033\335QV\315\372h"
+	.string	"#%\206%\366\320\342\313~o\310\275\256\371+A\354\366\346\216\372\314\334\240\253"
+	.ascii	"\270b\032\316@\371(\331\306\022S\232\210\244co0\264+\026G\241"
+	.ascii	"A\237K\347-\355!\342\3433\305\017E\311\221yf\334\273\340F\270"
+	.ascii	"\371\214%(-r\345\333o\341\242\242\3334\023\363\004\211yilUw\203"
+	.ascii	"\r\276A\234\251\233n\250\016\310\266-IW\352\223\021\374t\346"
+	.ascii	"6d-\"\27317u/\0012\354HU\026.\370\233\315\265l\035\276l\217\277"
+	.ascii	"\205Q\305\365*\344\013D\217\002\333\325\003Or\323\261\365\331"
+	.ascii	"CK]\342\23420P/dQ\320\233 \260w\234-Y\213$\266\331Q\356\252\327"
+	.ascii	"\210\354\202,\235\200$\036p\327\036]\037Cv@\005P\266@\363T\027"
+	.ascii	"\265l\036\362\007"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.102.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`M\001\305\r"
+	.string	"\266Y\\C\020\221\223\016;QQ\333\331\034\205\200A\332\3214\240\274\260\215\354\341\356\245\203\026\361\353x4\002j\337\342\377\3724\323\2748K\262H\026\003\205\"P86\022~Q\232\210\002B\245\315e\326\210\335\233l\231RE"
+	.string	"F"
+	.string	"I"
+	.string	"\002\344\243>\200|tg\317\3707b\257\002\004\312\t\230\335\305\240\210N\273G\013j\347g:\032\357Dz\274:\3342)t\271f8]\260\006\354\356WW\f\247\222j\246\263\273V\357\264\341\226\267\235\331n`\237C>\313\177\275\345\227\377~K\325\272\271jal<x\331\3250u\354\213\310B\305\366\355\273\330\234s\354\226\224\002\003\b\272\177\243{l\t\206w\340z\264\252}\023_\351\316b\342\270\033\302\305\212\335\257\200\t\\\217\036\017\n\255(;<\347\214\261FR\302\337\370\347\2348 L\261m\"/\370\221RY\3110i\214e\nP\246D\013\225\005}\024\177\031\371$,*\321{\217~\211|L\220B}X\361p\242\323\376H\nS\354\3039g\fC\224\003\231g\344`\003\332,,\030\021E\310D4\232\306\205D\f>Y\210d\323"
+	.string	"8\004Dd\363`!\t#\033\211\206Q\330 L\300B> \f\344\303\234'\373`!\216\373`\234o\017QQ\2659j\234\300\022\215\250Q\2056WA\357\371\253wL\220\344\013\006\034"
+	.string	"\255s\340\314\200{f0x9\354\013\023\305\271\027\f"
+	.ascii	"[\204\252\032zW\f\363\"\306\024\264\003\202\375\234l\243\356"
+	.ascii	"\007\2561n\270\016\024\001\343\300`>\t-P\243\205\273\004\006"
+	.ascii	"\f\302\220{\326\341c\245\f"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.103.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`&\001%\r"
+	.string	"\246\231ZC\020\221\232\016\273\020\033\216\216x8\002f\367\376\027\274\272\227\373"
+	.string	"\345\341\350\273_>\373bS\274\253\206\220i\375A~\307*\215\214+\006+\002"
+	.string	""
+	.string	"u\251\261\033 W\305\n\306XE\331\226>m\"eJ\001E"
+	.string	"H"
+	.string	"D"
+	.string	"\003\250\303\274"
+	.ascii	"\352\320\236-\343\037\207}\f\214\212\211\033\273{\351\006/\275"
+	.ascii	"\303I\323\363;8VH\364"
+	.string	"9\2540|\002\245\226\236\024D\023\246\217\335\375\313sE\224\222\331\301\331]gHt\341\246n\273c;\201}O\232\351\324\364-\0022/\026\270\330\255\020q,\r\\\361\341\244\333\377\374\2227>\211\227\360N2\213\352c\241\202\211IAcwA\016}\240:\374\230\276\261\235i_\304Gxw\361\030\356j\230\221\331\375\f\270@u\030\340\001\347\200\364c\250\251N\225\034\2161\326L\034u}\215\2378\n\316\357`\223\223|\350\320?Q\004-\031P2\3761F\033\252#{(\250\036\036@\220b\200\262\306\376>\251#\373\032c\204ae\261\357\362\303\223\356\\&Ad\3020\2553Q\260u:\222\f\003\340\221\020\006Y\311\3259h\220\221`\027\204L\344\3015\262qW\210\207\265\222\316vu\232\266]\233o\257,U\013\0254(\2322\003\352\310/\335j\t1\243 W]\261\255L\265\265\b\371\220\377\022\026"
+	.ascii	"2\003\3769\203\013`5\030\360\230\002\201\024!J9D\006\222\261"
+	.ascii	"8\324Ja\030\240\\f\353B\212\213\fN\252j\227XI\021\356\022\030"
+	.ascii	"0\bC\356Y\207\217\2252"
+	.text
+	.section	.gnu.lto_pidResetITerm.147.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`/\001\215\r"
+	.string	"\266\030YD\360\2226\035\260Hc\2724\257\351\345=\024{\251\240:q\274\340\315\004\247\273\212\215\021\0203o++\0375R"
+	.string	"\fQY2\023F\"\020\207\305a\321\346\214\256\207\223\315\313t\017\236o\305\002\t\331{\313\235RC"
+	.string	"D"
+	.string	"G"
+	.string	"\237\251\001B\346\264\273\226\232\260>~w\204\333eT\270\371T\b\346\bv\324t\036w\031\003\354."
+	.string	"\357Cl"
+	.string	"U<\021\214)V\256\377\256\300d\323y+\207Thw\r;o\304=o;\263\375\261\237\022\252.\366\307\301\257\266\330\363\243\373\224\001\025:Hz\354\206\270\t\2624\362\006\212\217n\237\205\377\231\363\026w\261}d\034\025'\242\2121c\303\307\356~.\355\251.\017\2743/\343\005\314\313s\274\331<\376\275l'a\262I)!\242aR\307\227\361\031\330\005\r\276\323\346%\305b\262I\266a\002\033\303eL\"\340\300v\207\303\3100\340ew\037\274x\314\006\377\304\2459\234\300w\227\376\311\274\374w\017K\315\351\204\002oTw\227\013\332\245A$z\004\004\341*\261L(L\270H$X\026.\221\n\326H\246Y\240\002\306J\"d\226\t\206e\026\347\333k\013\314\253\034+hPT$\325\305!%\235\252%\370\371U\205\301\257\377\021S\362"
+	.string	"\201<\356\356F/\370uj\036"
+	.ascii	"2\003\376\031c\205\306\211\375]\002\313\022X\0212V\265.8\242"
+	.ascii	"\021#DA\302\350\252a,\341\026\230\246f\323\036L\233`\256\353"
+	.ascii	"\360\323\030\t\305\206\316d\260j\372E\210 3n\334(\033\354\264"
+	.ascii	"\267\347\200?)w\256\371\004"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.154.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\035\n"
+	.string	"F\323F?0\305*\035\360\320\255\277a\351\017<\037\372A\373o\026\344\212v\214\f\215\n\302\025\204\214.\243\377\377\214\01341\031\030\223\301\333\222a(\304\360!\320\251\361\fc\341h-%\215\220\275wJ\0013"
+	.string	"5"
+	.string	"3"
+	.string	"\262\335\255\023\344\341\351\224\241\177\326/\342H:\3558>\351B\f\300\201\202\361D3(\021\361\254K\215\321$\245\245aw-\305q\343\336n\333\301v\265M\013>\2070#\340\271vQ5\332\302\266"
+	.string	"#\030\333\227\366Kn\022~e\227/\273\002\006\274v\227\301\n\335\267\204g\270o\364\006\3347\207\266\201\267T\373\025Y\206J\252Y\3545-\342>#R\n\234\344\314\376\311QD~\2101F\362\3427\177\304}\373\264t$ \361(\311\232\335\"\311\371a\237\356\356z\246\354\257\376)e\234\017\bz_\007\354\274\321Hx@\025\354Px>\023\325\302\003QQ7_\250j\016\354\2018_\005=\357\253\230\326\236\356L\371\001\001\2544M\264\223s\332\027!y\321t\222\036\016"
+	.ascii	"3\241\005h\214\254\241\304\260\227P\255\202\300!B\200\031\002"
+	.ascii	"\f\230r\t\266YM\021w9f\22340\265\007"
+	.text
+	.section	.gnu.lto_pidInitConfig.155.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\272\035}h"
+	.string	"Z\253\240$I P\273I\007_\216c\330\034\024|\271\350\306/m\204\247\200\216\355\353\370\331\255\003\t(\255\032pN"
+	.ascii	"Gz\270\303\224\334y1\231hR\341\240\210h\024"
+	.string	"\244\252\371^\230\232\276_\263\355\260\330}\261\032\233\232\265d\223$\245\f\365\001!\002l\002\303\332\273\345\275Zj/\007\265W\352\354\315r\366bA{\257\324^+\265\267J\355\215:{\251\234\275S\320\336\rj\257\224\332\253\301\331\033\245\366fP{\241\234\275\030\234\275O\336{\301{\235\324^\013\336\333\244\3662\251\275K\316\336\n\320^%\2657I\355Er\366R\200\366B\325\336\tj\357\221\263W\202\367\032\251\275\021\324\336\"g/\004\357%R{\037\250\275C\316^\007\336\373T{\205\324\336 go\003\357\005R{\177\324^\006\316\336\005\336\253@\355\365Q{\0238{{\274\227G\355\335Q{\0218{u\2747G\355\305Q{\235\316\336\033\357\265Q{k\324^\032g\357\001\357\235Q{\r\250\2752\316\336\002\336\033\243\366\022P{a\234\275\003\274\367E\355uQ{[\234\275,\336\273\242\366\n\360\336"
+	.string	"\336\253\242\366\246\250\275Mg/\212\367\236\250\275&jo\211\263\227\004\332\013@\355\035Q{E\234\275!\336\013\242\3662\325\336\017g\257\360\275K\2657X{\201g\357\357\275h\355\255\265\367<{\377^f:*w\210\304\270\245\351\231\276J\351\241Z\303\035fc\346\263\3130,\267\261\355\033\320\252\013\350\30643\004\310\225ym\205\273j\274\247\310|\306"
+	.ascii	"\255\272N\034\357\370\271K\323\224\006\327\325\001\344"
+	.string	"\352\342\344\336\345\0278\255\310\312*\036\221\246c\203hHS5\033+\003\310u\325\330\004\312\025\310$P\256[\334\205\304jf)/\373\264\330\366\3224uz\331\236O5^a\027y)\b\024\242\347\357]\\\376\t\t\036\275\254x\351\205\0344l8x\272`\363\342\254\013\254\201\247\210D]\310\023G\233\261\205L\007M\030\243'_\205\361o\311\353\213\017\302+\353t\221\246)\257qsyau\377\204\244i\272}\364B\303\373\201w7mw\213\354\2560!\334\327i1\255\250\347\251\371\370\204r\355\270#\336\020\346S\361\237\0363\251Lq\036\210\354\237\226\233\343\210\217\332\244\246\247@\361\246\243\313\023GQ\204\367N\314\320\372\323\004\236l\271\215m\230\200\362\334\367\374q\331\231\316\271l4\nk:d5%f>\2055\230\351\234\347\316\201\366\364\214b&\276k\204w\310\233\324\325\246\f\016]\211\233 \361\022"
+	.ascii	"\234\304\021\216\004\305mtwQA\350\354\200\230\001\360\034p\313"
+	.ascii	"\344\210\357\"\341\272G\216\216\202\310\036\211\370\210\020\027"
+	.ascii	"\001\342!\2240\335\034#\020M\246\357.\341E\212\022Qz\243V\351"
+	.ascii	"\303\231\204\377\260ta\0236T(n\3519\334\374$\225\301\357:aB\313"
+	.ascii	"d\201\303\023\024ti\232\372\030\3047@\331(R\244,\217xL\306B\256"
+	.ascii	"p(H_\337\036\360\301\263\361\354w\340k\235\361\016\375\357\254"
+	.ascii	"\325\303N\341\267!\267\231\355V\235q\240\250 fi\232\345\303\n"
+	.ascii	"\333\200\205\353\017:\364\334\306g\nnn\177\232\246Vh=\240\363"
+	.ascii	"\035\361\316/\223cX\020Yiz\005\243\236\2158`u\337\376\347+\233"
+	.ascii	"\361\216\377\363\032\327A{sZ=\234'\333>\r\3466\0066#A:i0\227"
+	.ascii	"\235k\371w2\346\3566\214e?\274\\\346\262\235\225\332?\315\307"
+	.ascii	"\375\203r\375\351\261\261\260\267ji\232\376d\313C\224Oe\255Q"
+	.ascii	"VS\332]-\334g\bL\323\254\036\3131T\231M\001\3234e;\\\227\253"
+	.ascii	"P\256\374\212\006CSy\325}\273jV}\262]\346\364c\273s\314\207\227"
+	.ascii	"\333X\311\314u\312\230\215\227\351\220\215\315\221\023\007\316"
+	.ascii	"\03317m\302\330\200!\277HX\243&\r\032\257\2563f\312\214\300\365"
+	.ascii	"\353\345\343V\355e\021j/k\235\275l|/\223\251\275\234\205\366"
+	.ascii	"2V\355\345+\264\227\255j/\247ho\261\366\022\321\336\252\332\033"
+	.ascii	"\002\332;\246\366\202\360\336\017\316^1g\257\007\357\355\340"
+	.ascii	"\354\rs\366\202A{\277\234\275Tg\257\027\264\267\013\332;U{\271"
+	.ascii	"\324\336G\242\243:\242\235\035\032\351ZPS\017\316\315%\225\\"
+	.ascii	"NF\322\220\313O6#\016Xm\3033\236JvF<X[\316m\357\245\226o\371"
+	.ascii	")g\274\313{:\324r&8FI%\007\257\324=\360\265\324\253\234\203,"
+	.ascii	"\227\372\217\017\313\263\374\2674\236]9\026\242^S\202\272\362"
+	.ascii	" \234\\SY\243\367\226Y\302L\357V\336y\313\224\261-\251'\021\233"
+	.ascii	"D\036\210|D>\224+\372v\304\253\362\250[\211D\354\253\362 \222"
+	.ascii	"\312\243\256\242\256u\340)\247\362\024|\306\263\r>\305\252\355"
+	.ascii	"\2406x\21099)u\313\304:\233\006\227\022\345\032\274\351m\027"
+	.ascii	"E9\261\022\323\210'\203Fd\376\306(\017\230ZCy\006\030\034\312"
+	.ascii	"\233\344\214wO\316w0\370\2714\342\271\340O\264Z\356\202\013\341"
+	.ascii	"\026%\235(*\246m=\305\035\361\270\032\221\223\007\365\fY`\250"
+	.ascii	"\f_\223[\360/\317t\\\223\013\313\f%\231\020\362zCd\307\r\234"
+	.ascii	"IK\316\244\202/9\232\247\344\025\f\202\202\023\244\344Lh\205"
+	.ascii	"\222\004J\203\265\025v\350\021\222'\241\340H\240N\301\221\006"
+	.ascii	"\004ECT\214f\262\200:\323W\241\344\004\3135oG>\201\004?r4\317"
+	.ascii	"\310%\220\241O\fF\232\021\264}\275\025y\004\020\274\310\321<"
+	.ascii	"\"\207`\215\317\036\"gB\213K>\240\007\354m\310\037p\340C\216"
+	.ascii	"\346=\335\201\027\206<:\331.D\305\240k\241\205\331\276\241\\"
+	.ascii	"\237\316\204\226CS\bZ\330\376\351\2638V\207\202\\H\003\017\002"
+	.ascii	"\344\r(i\025\362\234\0019\323W\016\311\037x\334\360q\203;\031"
+	.ascii	"\370\217\005\316\200\002_\240I\237`\247\216\002>Jx\343\207Q\036"
+	.ascii	"8\224\022\270\217\036O\340\250\034\217\367h:\303\035t7\232,*"
+	.ascii	"F\217\261\240\343q\246/\270\344\0169q\020\370\016\035G \307u"
+	.ascii	"\314\35179\2328\334\2209\035\307\215;\331\370\215\262fc\343B"
+	.ascii	"-A\311\032\310\022\344h\274\306\001\247\361\246\345\214\037P"
+	.ascii	"\247\327\314\270P\353\255i@\232\023d\334\200\002.#\306\013\270"
+	.ascii	"\323]1\036\204{K\022`&\005\030'`\200\303x\361\001\3624\327\213"
+	.ascii	"\246\213\255\025\276lq\027,\336\342\277\270\025gQDk\343\212\007"
+	.ascii	"\341\002\t\320Y\313L\356\037>\342\005p\001\3768\027\372*\200"
+	.ascii	"\007\365\230M\025\337_\244\304L9\301p\221\232J\322%L\025.RN\206"
+	.ascii	"TV\230\030\021ae\213\324\225)\252$U\244\272,m\324\215*R]\234"
+	.ascii	"\300d\301\"\265\345\212\023\027\251)C\247(\252/N7\232v\252\213"
+	.ascii	"\025*'0SSTNB\265\2249\375\0300Q\244CW\307Z&\343\241\230V\325"
+	.ascii	"\367d\365&\331\031\211\204\033\323\363\202EDk\201\307\310<o\216"
+	.ascii	"\240\246R\316%\021\265\344\274\345\266\036)\316\231\r2P\023\216"
+	.ascii	"\035W\035\2343\237\361\256\314\353\336\004J\212\335\021\361\214"
+	.ascii	"\334\021\357\312\315Y\354\234\347\365FnND2\233\312\2536\237#"
+	.ascii	"\246\251\243\024vn\363\237\\\330\232/bs\306\203\\6\225`\211\212"
+	.ascii	"i_O`?4\004;\267A.\223\312+\344\013\021\303 }\235\221OQ\367u\347"
+	.ascii	"\346\204\240H8\327\200\364\323T\256\271\341\315\2328\207Ss\026"
+	.string	"C\372I\3636'\217\3546\2449\253A\266%\321"
+	.ascii	"*\223+\341L4\347.$[S\351\265\254\303v\302g\360\272\030$[r\351"
+	.ascii	"d]}\356\034\006\3463\347\256?\317(\206\245\203\231\363\0313O"
+	.ascii	"\021g\274C\2269\033\305\260x\204\363]\237\235V\017\301b\032\312"
+	.ascii	"\\o\322#i\355\316\257\214oo\217\353{\212i)<\325\035\361\256\362"
+	.ascii	"\\\017\327\203_;\354_x\232\227\025\210hh\274\002\345\255\363"
+	.ascii	"\361\254\025\b+\371\344p\353?\275\274\246\362J\204\243\021]\210"
+	.ascii	"c\255\263\bG\311\234\215iWaH\346?\275IYgz\260\316Yo\266="
+	.string	"\307\203\365\237\233]\363\n\2055\266:_\275\343\330n\007\212\255\376\323\263K*\257R\023\334\212\347\364\227\353s\263\342\205Z\220\232D:3T\235\370/\227\037\253z\020\016R2\0049\3141\017\341g3\336\021\001\035\016\324\230\007\335\352\232 \\\214h\303\007\007\341\315g\274{{\233\341\007\377\325\201\211\371\036\354l\210p7\020\t\021\212;\342yp1o\312\353\340\036\304\235\204a\007\027\352=j\206QCTd\2108\327||\031\006\3630G\331\276\034\f\242\243\371\362`\331\243$\325\367g\336ET$G\234\233\313;\342\375\350\274\234\352\225\257\313\2754\372\b]\036,\233kN}\277\365\202a\250\262h%\030*\313\212\244 EI\2459\242\f\bBNJ\350\354\006\022`\223a\234\005\0352J\211\210L1(d\331\016\323q\340\331FmRQ\204\203\203\336\224\215\267\357\251\354|\3248\323\335\373\013jX\334"
+	.string	"\242\021n\246\021aU\363UDeLXO\007\240\340L"
+	.ascii	"q\305_fK\030\325\034m\301\374\211q\250\211\035\035\327\366@G"
+	.ascii	"\027\256\374D\276/\006db\360\177\301}9P\312\205\004\341\307."
+	.ascii	"\201P*\333\330\3728"
+	.string	"~\375\240\007\024\306\210\204\301\244\310\341\005\bE\221\223\330\rZ\220\306e\311\357\300/\002\027\371e\006o\301(q\0300d\377bw\365\306\350J\026['\202TZ\352\354\234eA\307\215v\3145\201\221\375r\267-\203w\223\244\255\224*\346\235\273\263m\223fAr&I\364(\315\251Qz?\031/\206\314P\361\020\211\016\240\307\210\205\374\344\344\016\276R\224AV\275\030;\030\336:fE\311\303\312\332\220\006\345\177h\241\023\264\035\021\366\3249\336\246\343\013\005H\204\025r2\365\252!y\033\273U\002xD\037\037w3\343q \027q?MJ\020?\322\243m\311hX\202\312\323\b\330\242\241>\271pvi\306\306\306\006\305@\323\246\177\325q\332Q&\202\025\350\201\343[>=\350\263*[\254U\207\223\030\330c\032k\373\001\"\377\366\017\3047\236\364\034\203\300\006z\305\034\353`\331>\267\265e\007\003\212\2132"
+	.string	"\304`\3537\t<\032\260v\322bq\274M\367\267\355`\021\031\337O\323\323\370\362\007\344!\220\b\004\344\223\231|=@{\230M\35428m\200\215\300\341F\b\212-\261\260\365\270\025\001\275\325\201.D'\006\213\f\"b\275\317=\3444\243\372M\242\213\231\220V\306\204\262\355\357\347\025'\254\3739-S\304\360y"
+	.string	"W,V'\236\0277\375\375H\261\246@\245\270\342\354\004\223\215XM\353C%P\203YE\314W,\341\352\232\300\030\221\322\2526\261\004X\241\002U\307CW\275B\346\241V\222\356\370\373\207$\2315\260Z \033#\t\274C^\207\315&"
+	.ascii	"JPABr\362\216\224\215\235H\375\223Z\354\220\241\351\r\367\221"
+	.ascii	"\353\237;\215Y@\031;\373\037\341\212\337\n&\t\342UZ\013M\242"
+	.ascii	"\367\350T\002pWvo9;\226\005\035\306cS\273\031\374%\321\364\213"
+	.ascii	"{0Z!\274\bq\210\363W\210\247\017\311\212s\250f\025a\337c\300"
+	.ascii	"\344v\232\252\013\307Z\346\034\227gK\355/so\213Ntc\3510{\203"
+	.ascii	"\263\232\334\260u\314\361MZ\323P8\227jX*\365\305\235\235\363"
+	.ascii	"D\307\263B\357Y9fo\340l\177E\316u\207\2244\341"
+	.string	"8\214I\230\377\310\037t\314{\245\323t\030\225_\246Th\323\350j?\331\007\224eT\247\020\227\304J\220yHk\031F{\006B \240\247\216\307\032\240p=\327v\245\3563\272\314*\034\266\"\223+\234\"b\246\2153z\303S\202\261\350\311\005\3226U\273\213\362\202CZ\365\306.\265\316\247\204\365%!\034#*)\300\f!FJ\250\277^\031v\325\223T\211\026\356I\n\376\005Y\302\275@\322z\207\300@\252\274QJ\t}\"\n\007\2570\024\022\013t\r\204\312E\301l\"\354\345,\210]\316\371C\263\331@\323\325B0\373\367/\254\304\213%\200]Y\243\355\261\326\325\003u\207\242@\013H\207\306\342\365\341\372\020\245\254\004\303]\016\226H\031|r\013jX\030\20049\003\037\301r\215\226\360H14\365&\241%\tf\247\023\001\335H\275!o\016\231\300\252O\340C\306LJHUMi\265\256\023\353"
+	.ascii	"\3272^Q\3168cxs\273\220\016\001"
+	.text
+	.section	.gnu.lto_pidInit.156.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\217\001\355\017"
+	.string	"f\036kG\340\262(\035R\237C\n@\301\2449C\335e\013\004j\024\317\271N`\212\024K9\324\325\274\320\341!\373i?\234\265\375\370\275r~b\261\np\363\r%\303\034\235<\226(\007\n\f\342a$\035\030\274\265d\023\271S\nO"
+	.string	"Q"
+	.string	"]"
+	.string	"\273\336\247\315b{\237\367l_\332_q\232\324c\033>`\367\205C\333\025E| \364i\361\005\270\317\320\tp\237N\331:.\232X\220\023*\\d=v\367\323\022O]\246\374\327\034@\350j\271\0041\330]\313\320\365r\353m\207\330N`\313/K\342\267\270\254\344\307|\032\003J>\374\364Q\334\347U\003\314N\212\230J\216\266\270\222J\302\376\266\273k}\331S\332\233\322\335c?hJs*\275\251\264n\322R\245/ "
+	.ascii	",\207\353\034l\354v\030\177\2666g\300|\026\267a\271\350\016f"
+	.ascii	"\007\305\006\264\313\360L\202s\234#\013{fo}\3301b\275`\034uX"
+	.ascii	"\273\252\020N;}Kf\305i\206\031\036-\236M}\030\217A\362c<\241"
+	.ascii	"\244\304\346\022\026\302G\004\r\b\325\353\246\"-\231\225\034"
+	.ascii	"-U\365.?L\216#\n\355\262H|\027\1771J\001A\356S\252\002\034\266"
+	.ascii	"\360\033Rh7#\025\020\245tjp\002\232:\213FN@\323\267R!\005TA\371"
+	.ascii	".\200&\244OtB}# .\231F\247o\245T:}\236\250\372\266\372r\350\306"
+	.ascii	"XS\351\312\001\205\237\232\001\tR\373\001\004\371\320\257yw\343"
+	.ascii	"\201\346\203\207\245-\366hD\2205\302\036N=\273\317\313.\002O"
+	.ascii	"O3cK\247S?! \200\202\221:^\fbB\317\310\300\024\270\311\314\355"
+	.ascii	"d\027V\210\343\006$\271\261g\234\2676\311=\325\257\341\331\361"
+	.ascii	"\324\0321\213Q\325\005`o\312\245\371\325\357q\1771\340\332h\260"
+	.ascii	"9\206\024c\017~bs\350\341h\315u\005\320\362B\350d"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.157.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"]\007"
+	.string	"\"\r270q\222\016 x\206!t\363\203!\334%b\374qNV\343\237|U\r\177\230\370\355n\217|}\315];\374\r\r\005\005F(\207\330G\241\277\006\254\037\330,!2\005\207@\016\230(\216$\"\260\t\210X\2015P\304\220f\021A\2373\321\203\026GY\246EO*\013Q\0025\037*\023\314Ph\013KO\247\025\013\241\177BW\236)\260\311\314\205\233R\225\213;\322k\f\322+\327\353\222"
+	.string	"z\325\343\264:\3011\275\326\247J\017\202|;\tQ\337!0\201\351\272A\223\311\321\312I\325%C\362\327\363\3667M\211\344\247\344E\303\205\225\231\021\206t\353\333nQ:\300u\245\276"
+	.string	"\206\314\374q]G\207\375\r\376\203?&\f"
+	.string	"3\001\3638\303\364\256\001\303"
+	.ascii	"\356B%\265Y%\240k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pidCopyProfile.158.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\030\001\005\r"
+	.string	"\366\327VB\020\221\223\016$\252\001\0056\177\017\241&\026\364\300\370\210\005\f\227\2414\231\n\317\344\303!\025\237l\353\373N\266\271\021\246\r\370\267\fPD\013\002\241\221r\020\232\210\375\202r\031td\255\355M\266\224)\005D"
+	.string	">"
+	.string	"C"
+	.string	"0\336qX\216\017)6\0212v\327\322\r\017\235z\232!?n2$Nt\ns\341\357u\2500m\003J\032\\*\316$\025"
+	.string	"w\362:v\367-\317\t\234\226\0317\273\353$q\026nx\333\013l+\260\037\022\376[-\331\231\316\234\345\217_\371a\246\237\246U\323\251\351W\033*\035\270\243\240\330\245p\242\261&\312\204\007\333\257l\026\027\004\231\266\201\003\241\257\224Xw3\200(\261\333\0250\001\314)\207\354\3724\276\214\362d\250\031un/#\327\250pj\3614\305Q\241*7\"F\356\256H-\001\252\n\b\361\302$g8\365\252\372Vl\030\272GM\215$\376\022\b\365\032@Cq\261\251hy\262;-5\305\001\234\354\243\211\320\271F\022tD0\020O\366qa\037\240\317\2451\307\343\302H,PH\003L\004\304\032\301\0308\2608\331\307\362\340\260\207\244\223Y \217'\263\252n\364\267Z2\206\305\t\323H5\n\346\363\003\by\222\337\362\315\211\212\034\003\033"
+	.ascii	"l\263\341\214\351P\262a\2415\325\357\355B\017\005]\357\r~\300"
+	.ascii	"\342\240$\300\025\024v+\2141\231\215\257\211\231k8\312,\300\""
+	.ascii	"\214\001\345\300``\204>c\004w\t\030\260\252\2215CnW\321\003"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.159.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\376\007-,"
+	.string	"JN\374\020Fp\\N:\337@1\026\300\347\372Mud\206W?\2579~b\b*5\274\330\344\002%n\020\206j/Gu3\260$\206t\316\026_\334\242W\335\340\252\270,{\005\222\003\257\334\362\240P\257\326\326\266\021\262\345N2\002\001\337"
+	.string	"\376"
+	.ascii	"\327\302\177\343\337\026\032b\312\230\031\221\342\271e\311cF"
+	.ascii	"\344\003\257\355\250*x\255\262\262\260P\341_\341_\225[\231\372"
+	.ascii	"\332\214 \325\327\rz\215\221\325u\340\375\f\326\007\241\374\373"
+	.ascii	"\311|(\374(\227\302?\265\344\332\006\336\317%3\217\254\202\027"
+	.ascii	"\307\225\032,\032x?O\346)\376\223\247\361\017\215\231tm"
+	.string	"\310\336@\340\375\374\031\215_\256[\305\204\221\325\301\271\3676\375d&\336O~\223;\231bf^\270\272J{@\326\306\206\232\235{\357\323\321\207\320\237\366A\350\317\026\362\251\377|=\336\016=m\327)\376\216\202\205\344\217)X[T\377\371>F\213\207\333\221\312\264z\324\036\022oG!\bW\327wc\264\224n6*\n\374\"k\306\t\302\325\343\347U\265v\200W\234\216\217\321\352a\227\304\200\265\371mY\325\366\331J\355\321\275\367i\2578\266\222\265\356(\334{\271bmq\235\201g\3465f\216\301\2743\022\303\236\223\346\336\353\340\313\341N\360\307~21E=\326O~\n\364'R\377\312\253RO\327YUm\262Q\023\350\002\035A.\255\223\254M\356U'\243\376\205\371\352\325\2463\033[\324c\021\350Ky\375A\205L\030:\253\246bFK\326\026c\276\275\035\306\354\324\244 \301\267\234\0210\375\354|"
+	.string	"\255\274\204VV:\3339\t\255l\340kg$[\371\310V.\360\345\331\350jg\002\266r\321\263\234\205G;\023\331\312\002l\345![Y\310V\016\262\225\201l\345\037[9h+\007\260\225}le"
+	.string	"\2662\320V\376\331\312>[\271g+\363l\345\235\255\214\332\312\347Y\331\332\312\335\225kW\376\002`\235\261\255\347xsoV3\317\245;\335\214|\313\237\345g\373\327\376\345\257\366\237\375h\3471\2379`l\320\200}\\\306\311\341"
+	.ascii	"\354\273\375\324\352zC\233\032\250\235\272\273\330\244e\267\376"
+	.ascii	"\272\251\355[\352u\266\257\177-t\223\302Q\361\351\265\257wz\322"
+	.ascii	"\262\002\335\033\261\354\352\222\312\251\252M\237\006j\264N\262"
+	.ascii	"\362\332\247\271\246sx\215\262\245p\007\032\355]\237y\336\032"
+	.ascii	"0%\232\364\b\177\311\241\006\344D\273\026a\323\001m\tj\376\035"
+	.ascii	"WYG,\223\231k\322\331\307\345\034\232\247a\246\007n\3436\364"
+	.ascii	"\347\3315\224\315;\365\336K\325-\306 P\333$\226k\254j\035\363"
+	.ascii	"\311\274\f\b\376\030\207\020Q\217%\242\033(\233L\224\314_9c\366"
+	.ascii	"uyB\263YguoUR\367\201\256li\331Rw?\355IXr)\034\2456\320K\375"
+	.ascii	")O\272\361V[)\251k\327`\203:\335\214\335\\\230\341\216\313\\"
+	.ascii	"R\277\355DS\324\234\275\r\364m\354A\3527\0063i\035s\324\343f"
+	.ascii	"t\236!\314R\007\023F\"2j\003q\b)"
+	.string	"\025U\001ItQ\034\272\360\305\200\252QP\225\004TE\201<Q\034\036\221\034T\fa\f3\024\2152\210G#\n\241\242\221\210\214*\022UH\0251 \213\303\343\361\205\024\020K1(Ad\361\204Dq\202\250\302\304S\221\030\265\342I\352\350\342\211\201\220\215,\206\307'\244\321x|\372\241U\335\336\016\343\332i\177Xj\266\307\326{&\\|\n.\226\232\315\235N\255\224\232\355\351\021\035\375\320\241!\243\253\352dQ\037\021u\321O@+\030j\241\026\320B\265\264L\330C-\324\223\302\t\265\021\031\037oR9\276\026\343\273\275\202\222$<\246\373H\225x\355\022\264\260q0\263\260;\215\r\317R\316\252\326\365\352<0\325.\271/\312*\036\202\016\352\004\335jv\202\372K\272\342\356(\177\032\330\b\272\331R\257d\222+/r\202\375\323O\313\0024\200\016v\021\235\264\f\030\240\007\270I\2170\363H\356\275A"
+	.string	"\375\267\207"
+	.string	"\343\321\334\265\030U\200\234\250\201(\303\030b\206\241!\021I\n\222B:\200\002\231)\253n\021`)dn\210$I\251\335P\007\214X*\fByO\376\267`\274\243\245P\234\227\032'\370\251\220R\245%\231\257J2\005\034\253x\337\365\030\006\365\375\270/\253\260\t\213t\244`\034i\323\260\264\224\013q\027\221\215\350P!\240\022u\301\243\036NB\372\2241\016s\231\236\214\033\203\240CL*\370\352"
+	.ascii	"\215pJo:GN|\265A\242\200C\037KIu\021\316\005\257\364\261\213"
+	.ascii	"\263\265\250\332\205\251M1W\331\344\204w\003\271\022Xg\240\016"
+	.ascii	"[ckgZ=\264U`_R\360\200\r\327jb\005\003\250`3\261;x\210\373!M"
+	.ascii	"7\376j}{\202\017\274\345x\264P\204r\341#\254\353\022\357P\032"
+	.ascii	"\013$\306\356(\f\360\201\316\233\265\376\265J\335Hc\336\265\203"
+	.ascii	"\205\2579\277\017.\363\264\252\351ZP\334\307A\215@\371<\r\237"
+	.ascii	"\354\262\322{(<j\333\265Z\004\302N}\262*:=\363\326G.K\350\370"
+	.ascii	"xf\244\020\203LxIA09\376\021|\321x#^\205\203L\302\t\336\032<"
+	.ascii	"\337\177=\365\366q\316+\231q\332\220G\005"
+	.text
+	.section	.gnu.lto_pidLevel.160.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`~\017\345N"
+	.string	"j\216\240\036O0\324\262I\007\002\343#.}Ap\371#h\232@n!\013\343u\003\036d\250\016xUr`\034V\031S\247\306 y#?\336tu\335\351\326X\016=;x\306\034\36314.\r\271\317\030\275\273\246F\332+\250!\214\027k7D\310NR\312\317\001\253\001\345\001\2647"
+	.string	"\332\213D{Q\320\336\023\264\327\004\355=\242\275%h/"
+	.ascii	"\264\327\210\366\026\321^\022\264\227G{w\334\253\313\365\346"
+	.ascii	"h/\021\367\232\271\336\222\366R\332{\356\355\\/w\320];\260\251"
+	.ascii	"\303\305&\f\252U\2048#\252[\271\306\002\373a\356\303<\207\271"
+	.ascii	"\006f:\314i\314j\314k\314l\314w\230\3630\337\300\274\207\213"
+	.ascii	"v\371\317\362\374\320pC\216sX~[^\2374bpI\266\034\037v\333\345"
+	.ascii	"\355\025\316ayt\311aSk\345]\331\345q\371\335\253e\032\330\006"
+	.ascii	"F\343#\327a;\334\306xX\017\343\300\310\345\355\021\203vC\225"
+	.ascii	"\227\032\265\232\345&O\025{\021$\306C\262f\251\271#\246\f\333"
+	.ascii	"\036_\350j\315\303\202Z\tk{|\013B\fP\022\0045\261@`g\332\007"
+	.string	"\033\320\261\322\301k\r\227\344\257\206=\322:\207\301\326t\201M\231\263G\256^j\273\tZ#&Yk\265\301\345>\241g{\244%*\227\"\022\310\345d\240\242D\315\212\343FG\367.\227\261\fW\fg\003>\252\325\013N\255\326\262\245U*\313-7\223m\333\352j%\323F\255\326\272\2643r\\\356\356r\033vs\265{4\262e\213\fLbH-\263B\265\326\336\013F2\271\244|\302\344\362)\360\025\363v\272\034\221Y\322\367\3252\321\017$\027)\246\031\264\305\245\205ybx\307}\272\210\201\021\326\245\253u0\310x\t\3039\016\353\002\246\211\372t\tC_\324Z\265\332\334q}\341\222\3260\356!\301\210k\013E\322\241\214 v;\233\222\300\2475\222u\b\031qeQ$\021\324l1\222\233\013W\261\233\350G\255u{\213\313\013/\t\336]\033vY\267kd\f4\374\034\335\304i\bq\364\335\030"
+	.string	"/z\211\267\2003:"
+	.ascii	"oq\204\321\211\332\220x\321\223\314\316BX\035G\342&\357\374F"
+	.ascii	"\367\335Kd\356\272d\356\3030C\214\221\035\271L 8eu}\304\305\005"
+	.ascii	"\221U+V\f\242Ky\233'\272\211v&\313\233\3477v*c\034\244u\210\277"
+	.ascii	"\f%\325\356"
+	.string	"3\313W\211\323CV\033\332\335(,\250\374\004a\b\215\221\321\377Q\316\3103\254\330q{\324P\276;\205J\363\026=\333\031\223u-\333\377\313#\316$\277\317Z\207\366\211\001\371r\265f\345X\346\301\2034+\2714\033\230\\\3625\b#\004\021dX\035\267[V\354\233\331eZ\357\305A\026\366\303\213\305\212XE{\207\264\367\n\2250\b\234b6\336\013\370\016\257\005L\207\367\307i\274R,\207\331\n\2577\212\366\372h/\024\257\361>U\341>\274RX\2157\n\2231Ca8\314\025\360\034\336'\\\003\257\023\253\361:\3413\336&\274\336&\332\313\204\366F@{\227\320^%\2647\t\355EB{\217\320^#\264\267\b\355%B{\207\320^\bh\257\020\332\033$\327\013\204{\177p\257\217]\357\003\334\353\300\256\267\007\3676\300\275<v\275;\270\227i\327\253\203\366\346\240\275\f\320^\034\264w\001\332\253"
+	.string	"\355M\200\366\"@{{\264\367\006\355]\242\275J\264\327\006\355\255A{\017\340^\032\334;C\327k"
+	.ascii	"\367\312\320\365\026@{cp/\001\334\013\203\366\276\310\365\272"
+	.ascii	"\240\275\003\320^\001ho\013\332\313\202\366\256\240\275I\264"
+	.ascii	"W\005\355M\021<\316\364\006N\315N\260\035\347\261\343\246\231"
+	.ascii	"\026\033\035g\312q\035\277\231\226\233\"#\367\230\313!\203\213"
+	.ascii	"\255\220\361\315\032V\255U\013\321\315,\024B\345P7FO\235!\006"
+	.ascii	"\321\030\367\355qw;\006\360\327\302\006D\234\036\0308\216\007"
+	.ascii	"\277\2141p6\003\324;\216\273\210s\206\317\031\266\300\0258\360"
+	.ascii	"\214"
+	.string	"$\241\315\002g:g\022\370\322\0258{y\263i\t\334\374\322\2056v\301-\370\324\215\212gf8\215\b\274\367\013\336h\335\345*\006\004\336\003\220\215\367\236\242\370\025w\206\335\370\322-\350\020\200\334\270r\245/\335D\263\241\364\206;\301~\267q\336\333\327\020g\241\027\266\344\031s\345?$e\276\370\234a^P\277r\223P\321\005#\251C\325\270\357R`E:\177\304\306\030:\3405h\374\200'\301\235\311\031\227q\0327\341\f\370\f-!|\306C\255YL\273C\372,\262\305\003\260#,\347+\003\223K\003\316g\200\326\n\270\214.&\351}\355.i,&K_\265\326\034\265\2654\331u\222@\002\223\313\002\334t\3111_\334\311\207\337>\203(v\035!t8\241\274\231\3457\346\020\316\336\370\360*9Ab\201\264\216\035\345N\316\305\311c\234\335\270\301|\001{S\304[\016\004<\006\214\023\360\037q\376"
+	.string	"\343e\233\326!\027\177\221<\344\342\246\261K\316\030\331"
+	.ascii	"\027\340Oo3#(\030\340>Z\234\305\0058\237aL\004\033\332\343r\232"
+	.ascii	"\205\262i\315[\233fr\331\3428\316\200Yq'g\361\243y@\207\365\354"
+	.ascii	"1WkeZqFr\t\026\346\020\021k4\351\273W9\303\235a*\216\364\244"
+	.ascii	"/\301\235\306\024\017\340*\316$\345{\344N\361\035m'X1\200\363"
+	.ascii	"b\220r\024G\272\022\334\211\363\216\342*\374\230x\211\237x+u"
+	.ascii	"\243J\212H\005\330\013\n\201@\341\323\n)\242\225\240oHt\232\362"
+	.ascii	"a\340S\022\024j\360\033\n\245PD\t\251\262\370\312\237\331\344"
+	.ascii	"\203\262\"\376\210D*%\252\254\204?\f|C\252\"\252\035\025\017"
+	.ascii	"8\364\021\247D\355\312\0351\350{\032\372\232\200\f\205\303\241"
+	.ascii	"\357\b\213pJ'e\345'5\005\213/8\345\267#\006\177B*\242\317\t\352"
+	.ascii	"\327D\f\372\206C\253'\023\300\337\360\211o\312J\220\212\3167"
+	.ascii	"\365\213\022\016\233\240~T\273\252_\026*t\237n@\375\250zD)+\277"
+	.ascii	"\251\250^\360G\005\330{\032V\365n\250X!\225o\330#\n\205\303\036"
+	.ascii	"\257\f\213\357\265\374\207\211\350Aa\227\345-N<i:\2537irv\013"
+	.ascii	"$\306\r\353\305<I8\264V2>x\0173\222\217\222pxXn\365,7*\246\301"
+	.ascii	"s\206)\365\356\325\231+4\315[X\316\177\030\251,\320\bn\305k\331"
+	.ascii	"\335\314\026\235\331!3\203G:\333\2149\252\233v^ \n\376\311\271"
+	.ascii	"\230\300\2438k\013!'|\321\231\0355D\300;\235\313\f3\312I\363"
+	.ascii	"\f\263\351Q\337\326\002\323)\364\327\325\n,\\\265\320\274u\325"
+	.ascii	"\202\311e\323\245t\361\031#\376\351V?\232\267\323Xu&'\376f\247"
+	.ascii	"\221\20339#\331)\016\032>gX\004Or\016\214S\037\362\252\033\025"
+	.ascii	"\321\3409\215K\256\344\021x\211-9\373\001d\343J\236\242\250B"
+	.ascii	"\034\222\037y\2223\2315H\316\202\214\\\351G\212\234\310\215\234"
+	.ascii	"O\260b\221'!\317$\026\016Dn\202\351\3023\266\006\301\205|\310"
+	.ascii	"\273\3554>\271\323!0\ny\216\256;c\272\340\203\234\352\2738*\034"
+	.ascii	"\3170\340\203\\\b\344A\222W0\264\021\310Y\255\213m\214,w3\373"
+	.ascii	"\343\r\370\270\003\377\361\025f'\330\003\367\361\300Y\300i\261"
+	.ascii	"\351q\007z<\311L\313M\201\025\250Q,\344\220R\210\221\222\021"
+	.ascii	"\021I\222$\215\001Q\005\304 J\231\235\007"
+	.string	"\021 \251\204\212FDH\222\244\335\220o\237s\225\365\263x\273V=\\\303\243\321\2674\016\026h\235\366x~\n[)zQ\232q&uRf\242s\245&\256%\""
+	.string	"l\b\276`\372Db\022\310z\n\355\275i\363de\t\365\327\346\320\312H*Z9\021\224\305\344\375\320p\016h>\027\357\336\217\315\253\b\254f\244\243h\242\363\177"
+	.string	"\260T\346~\361\320+\262\212\002WL:%\312\211_\200\334\317\335\300\272\360\323@$\017E\374\037\275\204\013o0\205\304,\2500\013\307\250\353\263\257q(7#f\036\211A6\035*\324\344\252QA\256\337\200_\307\254\216\200\030q\234\374\372,\0066\3478%W;"
+	.string	"\203\321\306;\033\353\215\201\3260\257\262\351C7\002%\275&\356\013\314\337\227\203p\233L\033\322q\016q8\\0\302x\351s\212S\272"
+	.string	"\270\250{Q\360\365\212\230\020\271\325\314B\030\273<\224\233\207\017K)\362\357\272\301\213\301\260\351k\007\013(L\374D\002\220\361B\213\263,S\035\245\375@V\225\037\255;\306\333]\024\205WB\205s\335\273\r\007\026k\254\334&\344\240\366\314\270\374\370'\017,\302f\201\207\360.\213\340\034\r\027\216\t\023\216"
+	.string	"\373(2\352\006\277\201\340\257Q\0016\242\2025\351\032#c\\/v\0160\355\227\204\342\212\246"
+	.string	"\017\276\207\201\253\f\337\321\232\215"
+	.string	"\252\300B\025\221\003vF1\022\216\354-\371C\232pF^|\264F\352\022\201\036\231wc/bb\357_\255\024;-\240P\253\367\001\206\006\234\373yL\2151\323\b\2677\311\254\230G\3228\325\322\347\265f\203\365\205J\234\302\324\350L\250P\233\360z\337\013\351}@\236\215l\315Ut\377\253x4\210\345\321\323MY&_\231\340p\2421\302\313\311\030\001\033\224\"\250\031\027\305\027\247\3557p\347\342\307\207j8\300\252\227Y\231\334z\326\360\362\223\002A8"
+	.ascii	"/IL,\017\2055vL\321\355?"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.163.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\340\f]A"
+	.ascii	"\352o\240\030=@\350M\007X\035\b\263I\024\016\305K\241\001:\005"
+	.ascii	"\252?P\241\255\366\232\005-\266C\202 T\325\037\333\260,\b\336"
+	.ascii	"\335\272\240\324Y%\306\353l\177\034\213]>Hh\251\t\331{\247\224"
+	.ascii	"R|\001Q\001~\001\231\356\235:7\246\ru\337u\023\352\266\353\016"
+	.ascii	"\324]\327+s\037b\343\026\006\217.\252\311\232\333Z\241Gnj\203"
+	.ascii	"\370\334\322\004\005\342(\024X\226;a\211\236\233Y3\203\177\352"
+	.ascii	"|\364}r\035\217\317\215\211\336\275WB\253,$H\327cV4\3155\237"
+	.ascii	"d\313\361\362\031\367\226df\243\255\207G\313\361\206\247\\_\253"
+	.ascii	"\314<\230\331V\205,3\036A\311\325\016\313\245\311P\353\370\370"
+	.ascii	"\363\247\207E:\007\b\013\357\335\202G\317\210\217\023b\274\215"
+	.ascii	"$S\233\237\336\275\314+\006\341p\r\247\3558D\252\240.\023ZE\317"
+	.ascii	"\275pW\214\025l\225\341\202\355\314\315\246\333\264\355\246\210"
+	.ascii	"\361v\222\276\266>\275{\343\256\330A\260U\004M\265\266\232\266"
+	.ascii	"\324\332*\267\314\221\252\214\334/\013m\222\216\310\351\273\367"
+	.ascii	"\036\337K\267=%e\214\202zr*\022\331\2410\b\\\325\364\275\345"
+	.ascii	"\006\202\020\2129\277z\n\bBj\255\215_<jM\315\241\300\244\371"
+	.ascii	"\223S\231\027\327\26081e\200\307\345\221U\231]\224f\033\273\342"
+	.ascii	"\3543\001\333\230\231\017\205V\330\306\252x\020\b\"\301\226'"
+	.ascii	"V\0328tR\3515\215Pf\027\305\311\331L\251\360\270<j>G\\M\017\234"
+	.ascii	"\231\371\265\2411\262\024\201\240\273#\254\323\210\247\254\223"
+	.ascii	"\351ohl-Ep\357\355<\355J\234a\356@\020\367^v1\347\223f\252f\356"
+	.ascii	"!\314\274"
+	.string	"\206\2315\013k\353\267\022+\351\253\337\315=0\275\236\304Q\026,\307r\277|\306\245a8npM\324Gco!k\203\1778u\177PFL\277\324\351\243\035\377\277+A\355\0365$\027/`\300X[\375\357<\235\232\201S\341\217_E\351\310&\377\005_\341\233\256\323\266D\177\366X\232C&\314\377\230\233Q7\2121\203\206\267\030\215\265U\377\005j\355\367\336\257\357\256\265\277\006\264\021\323/1w\242V\324\305\275\306Z[\336b\255ro\255\255\366\277\263\356QY\03320\377c\206\013\353\364\336{\375\321\230;\275\367^\3763f\3269\304\3209\213u\376\320\206\232=\260\316\035\372\256\231\003\321YC\023j\316@t\306\320v\315XD\347\013\035\250\331\302\320\271\002\353|l<\335W]\247{B\333\351\216\320u\315\020:N\367\203\216\353n@tf\320s\272\027\260\316\007\212\316\006X\347\002Eg\002\254\363"
+	.ascii	"\326\331\252\350,\200u\256*:\007\020:\003 :S\021\235\247Xg\251"
+	.ascii	"\241\263\221\350\034Et\206\":?\021\235\235\210\316E\326\231\310"
+	.ascii	":\263E\347!\353,,:\007\205\316@\242\363JtV\211\316)\353\374C"
+	.ascii	"g\027:\267\b\257MN\2328{L\335\275N\376\002\315\276\t\036\205"
+	.ascii	"\243](\257\212Ci\237]\207\345\364'-\026\263V\213\226\265U\013"
+	.ascii	"\337\202\232\304\3333\3527\007\346\177VevQ\210\217\346S\377\003"
+	.ascii	"jG\301\231[\264\326\213\267\330\324{\235Hm\356\302\376\213\341"
+	.ascii	"\036\215C\274\324+"
+	.string	"\235\211\0135\030RG\247\035_\326\2070\376\202\317\372\326\343J\214\277\341)\347\247\200\271\005\343H8\032\300\217\264a\246\214x\263\035S\2465\343-\326\232Y[\335{\312\275\365\201\371\3370\352\354\023M\370\247\217z+\350\333_\223\314\323\177\341\350T^\nIl\017\302;\375\323w\223-\314\277\3326\226s\372\356\363\244\223\206,\332x\024\231\311r/\177\370\373\273\304\274\027LA\361!\374Cj\262\021\277\370V\232\232z\354\013\237\370*]s\370\354\246\326\215C\006\3466Mkj\327`aa\352Lm\033n\337dy\213e\255\255\016\237\203\332\\\360\205\337-[\373\211\350h\336\275\314\f\314#\272\257D\360^&\226\245V\214\211\316\223F\344\373O\223p\363\234\3437\007&\354E\r\374\336\002md\345\336'Vf\024*\274\305\200\035e\316$2~z\314\377\362P\347\315^\360\321\030F\245\025\352\233O\013\263"
+	.ascii	"\332\3036FU\237\301+af\360Nyz\317\270\260Ev\366\200\351\257\017"
+	.ascii	"\365\354M\2760\tT\032\245\255\353\253O6"
+	.string	"\205\314\332\235C\204\230~\251=\343h0\234\203B\217\034K\255.+\316A\001\331\305\265<z%\273\272\222[\002\202\320\360\254\2412\251T\"\205K/\256\344\216%\222\205\r\256\024F\344RkER)\004G\260\207\013d\027W\213\245\027R\251\364\261U\354\301\025D+\355\342R\266@\352\300\341\245%\024\242D\376Hn!\2254r\364\320Rn9\361\026\005\033\\;\216\313\0348\270t\3348zqiu\035\267\224=\216\024\2528\271\003\251<.\223I\345\221\205\003\353\364\376\031\223\260\244\347\247\007\366aSm\302=\203\362\312\330\360I=\032w\"7\323l\317\2727\276\340\2316o\306\017?\300\303\177\370+H\007\276\300{x\002\232\f\374\2012\"\334O\032\231h\236\201w?j\004\276\200\230\326\2553\205i\327t\2455\002\337\207\272\304\336\323\217\037T\336\245IQ\035~\200\253\371\227\326\t\245\225\"emu"
+	.string	"\037#2\016\337\341'hj\366Y}\325sx\002\203\004\274\225\027\021\356]\\\300{\224\321\\\200\257:k\335\272R\236si\3274_\236o\t\360\215\327%\002=\375\244I\260\207\022\036\024\200\246\324"
+	.string	"\350\356\230P.\216\240O\0322\274\2067"
+	.string	"\251y\305\315\312\332g\373\301\342\315tk\253\031\276\0135\t4\317>~+\235:#N\030\236\352\331\240\204\260\036\303\037\310s\345V8\332\210\322\252\344\221a}\017j\022j\236}\322\024\235\210\021+>\032_x\252o6\250O\341(\025\226\2432\3061\"\263\360\027\336\200\246\201\002\250\201$$\021T\306dD\202H\222\024$\215\001Q\005\304\030f\245;\017\021P\261r\314f4I\232\003\215:\274\317\002b\305!\370\2236Ei\220\001\022R7\226\017(R\372\f\247\037yt\363\373\026\326\331\316\256\250\332S0\322n_\215pm\2071<*a\304\367\205\201p\342'\003\307{\200A\326\251\rp\316E\233\201\356\227\031\2011\261@\007\310\2270w-\256dn\370Z\271\332\362?\260\253\034\017)\2006\204\313\002u\274"
+	.string	"\t\220\330I\214\336\313\0333V\241\007B\013\370v\022\365\257\033\230\033\241F9\213\217\201\360A\0355\3422\214\363b\n\271\0240f1\3329\237\254}{\r\352\020\n\035{)\233@\272\001<\254\003\235>\316"
+	.string	"cI\245\215B\314jqWV\242\316=d+$;\364Di'f\225\366\241D|\226b\226\300\307v\206"
+	.string	"wsr\006\261N\257\364\034&<\315W\305z[-V\306j"
+	.string	"vT\374\362\237\001Xh\235\263\3305S\222*\246u#\371Y-\261\256#%\r\\g=v\"\255\230\251\265X\267\001\030)\346\300\031\336\016\3166%\326a\220\n\332\r\226!\205\277\344\035\241\224@\327\017\206w\357\022e\355;fom\255\311;\002\222"
+	.ascii	"/J\261\372+\335\2451\031\002'H\205=\226\303\371\222e\255\334"
+	.ascii	"t\205\236\207\0310\f\335Y'\017\216r\274\370\245b\256R+\212ZP"
+	.ascii	"\245S\226ML\272\322S\324\242\005\235\003\203\203y\217n\311\362"
+	.ascii	"\t"
+	.string	"B\301\256\203\254\246s\230F5/\013\2234}0y\032\353\273\264]\304\t\317?\271\362\030\374\360y\001$y4\256\005\251\251\241\360e\226)@Xh\365\2336\203\002\210\217\304\374\302\273\254\262\240\3642\376\221n\f\007K\031;o\317\234\236Ee\315\377\345\230W\374]\367&\272\210o\340\243"
+	.ascii	";\314\272\203\243}P\001"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.164.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\350\007\275*"
+	.string	"\272Ix\020Dp\234\316p\377\265LX\227\n03]T 5!Y$\231I\270,\370S#\350f\370\273(\306\306\220\2172$L!\007\314\261~\250\013\204\271\227u.\013\326\030\263\021w\207T\255\021\273\227\264\275\267\224I\006\365"
+	.string	"\333"
+	.string	"\367"
+	.string	"\352OT\335]\223\n\f\323g\275\201\274\352`\266\301\bS\247\241\245\310Pbv\205\002\257\315\330t]\203(\265\254+\325\203\215"
+	.string	"\374\271\347\335\247=y\274\032\r\240\3656\224fV\364\326\265\355\301&\001\177\036]"
+	.string	"\372\323|\020\372s\217\273yBU\253\024\004\263*VS\224\353\272\016\273\310\217\017\002\372\361\001 \354\341Q\203)\360\207\236f\363q\377\253\220^eI=\b\350\b\377\210\335\007\300\035\026\0202,#,\024\363\342\236\273\375"
+	.ascii	"\031\326\017\3469\020D\253\353*\027\007\273\310\260|p\332\325"
+	.ascii	"\203\201][\3743\tx\315\355\370\035V\227\211DF\310\0325\313\212"
+	.ascii	"\321\337a\205\251Y5\370$\303\022\023fU\261\371;,1\363h]W5\213"
+	.ascii	"\212\333T\322\223\203#\314B\232\002r\214]\335\355|#\213\212\371"
+	.ascii	"Wa]\327\345\253,\255o\200\357\336\270\273.vQ\276}\267\247g\330"
+	.ascii	"|\326'\241o\241^\266\332B\362r\367^\376\245i\217d\211(\370W("
+	.ascii	"\320\237\357\2454[S\274d\006S\225CI\237\006\n\324B8\370\310\360"
+	.ascii	"\341\251\241\3429\273kHn\260\335\367r\271\\n\017\331Uy\225R^"
+	.ascii	"\006\227\373&\245\274HA^\005\227\362#Hy\217\016\3675\360\265"
+	.ascii	"\337(\345-\002\362\022\235\312O \345\035By\205\336\366\017\270"
+	.ascii	"\332\017\364\343\025\246\274=)/\217\312\253\006y\203?\3364\345"
+	.ascii	"\005\246\274\277\224\027\375\361\236)\257\t\344\355\037/\243"
+	.ascii	"\274o@d\007\211\327f\206\245\321\254\2559\226uV\273sK\222\313"
+	.ascii	"\375p[T\244\332[\332\331\343\3406\316\\\337\326\252(\013\220"
+	.ascii	"I\273\264\006?w\004\360\347\376\355Un\305\305\337V\225\252\373"
+	.ascii	"\362J\373\031O\216\311#\224#\024\364g\272\204N\351\225\354\372"
+	.ascii	"[\240y\367\301\225\247\354\233\342\345\223Hq\251G\r\244[c\001"
+	.ascii	"x'l\313@\037u\001/5\224\005\330\250w/d\340_\031\350\307\235{"
+	.ascii	"\350\265A\263\243j)\246\233*\013\026\365/\215\206\337\031\002"
+	.ascii	"]\324\307r`\036[\262\0168\244\013_\332`;\324h\237\b\333\334\231"
+	.ascii	"\243\331\270\r\013\267p\350O\364\207.lk@\017\365\257\034\250"
+	.ascii	"\206-\t\246\206\322\247J\030\032`\203\211\371\331\274\307v\274"
+	.ascii	"\227i\301\241C\007\364\347\331\303\037\320\342\002\367k\260\215"
+	.ascii	"\3732\325"
+	.string	"\272N%0\373A\330\352\006\360\356\207\020\374+\263\371\255\r\023;dK\255\004\036J)\324\b%\002\356\375Fh7\321\334\307\210\030A\202\004\372\263\333\310\265\006m\177\304kn\307\331\002\345\346\031\373\341\335\022L\374+n\024\310\027\262\245\272K\362\314\210\231\204\n\005\233b\211\370\344d\034\256\200zz\202j\032\212Q\202\211F&\017E\250b\221\2302\031U\020M\234Q!\210ON \214+\210\305\242\213\246\236(\247\030L\246\214\"\361\005T\023\261X\"E\024S\261I\270MK&\234X\f\215)P8\25181\\\341\304\3644l*F\r\227\204\026\212\005\26184BA\025\207\352\332\324{\310bX~\311\321\233jd\020\225\026W\234\263\276\t\310=\033@\302\376\030O\t\373\214R\327\304+\271\265{Vet\3744\330\036\217\3277g\352\030\034l|\030t\317\334\235\236\244f\220\324\337\302\305\224\373\"\002"
+	.string	"\251yZ\250\306FG\207\007\310N\032\244\276\226\363X\026\026V\321\255B\245V\233\235\260\321)/\347XfvDCC\177\252fY\224\272/\257\344\226\202Vj\2417Vw\202\215\240\025\364\255\334,3\023\306\314\215\212\0228\301v\020Vt#m\355I\325\364\245\355\201\253\017\215\007A\357\335|\357\030\200\243\250a0\005\225DS#\201\210\202$)H:\300\002\031\251*\017\021`)e\314\244i\2065[4\322\021\201\026\202\301\252\217\251:\343+\233\330\".\241((\205\020\343'\231\025\225\253,\345|<c?\240R\230\334\n\222\303T8`xq \247-\372c\342N\233\2138Q'e\267\222t\007\001\246\272\246\227\266jI\221\263\004\"\003\2305\332\035r\353\017A-\213\350\211\021BT\024\250"
+	.string	"\034\341\303\342\211`\226\013t\250\177\222\271\302\347\034\347\270\214\030T0\02318\004\331D\034'\325\240k\221\244\364\2520"
+	.string	"\314]c{)\2371\344\250\255\300\tp\272Uz\342a\300\301\255z\b`(nW:\215D\335\261\307!k\334Z\177?&\254J\347\205G\313g\023P=\312{It\300`|8\017\f\237\353\r"
+	.ascii	"\016^>\260\2422N\217\3146\244\201\221\230\256b\241\266\375\275"
+	.ascii	" \302\\z\206=\214c\f\216\377SI\f\f\375S\025\027\375\037r\002"
+	.ascii	"\326\311(\nt\332\004\275\036\b>\304e]\022\242\370\002\\g\022"
+	.ascii	"=\2409\364\341^\333\223&b\267\2413Y\177"
+	.text
+	.section	.gnu.lto_rotateVector.165.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`k\003U\027"
+	.string	"v\255\227F\260\230M:\360!BU\317\224}\330\215\021\327\313\307\276IS\372\371\250|\224Q\025\257p\222\017\032R\351\214\376\025\323\217\342\350\\f\3769\274y\217{\337s^\243\2028\363\201\373\252\262\237\024\257\036\322\b\331I\246\024\203"
+	.string	"z"
+	.string	"~"
+	.string	"\005\314\225\201gN"
+	.string	"\364\252\315a\033\242\300s\3266|\3038|\\\253\223eb<\372\236b\254\341\024A\3153\2359\317"
+	.string	":s\255k\264,\346J\3003W\237v\211M\210\370\263\200F\025\021JRb\214\256\267\350\rk.L\037s\360\351S\253\034\35004\372\246\206h?\346`L\214\221E\013\001\021$\021-(\241\f\023\276\227\314\031}<\206h&\234*\0071\306\346\020\255\204\333\271\255\254\255\204\366+\002\356\214?\267\005\26320\033\003\26300\313r\366\345Y\227gW0\333\342,\313\263\336\263*\230\355\234\345\236\205\317>\263\231Y\007`\031%\241\031\007\223\030ILU\211R\034\024\f3\331M\366\315\376\f[\267\356Q\373\260\223\237\272\2725\n\306\017B\322\210\030\021\274&(IC\017<\246\336R\252J\022Q\003O\251^\352\312\\\275\303<|\3745\312\261D\264\220\224$\241&1\306QfHA\027X.\267\371\313\352.\255\257\336mh\361^s\026CYu\217\346\252C\245\372\207\2547\357E]\247\316\\w\023\241"
+	.ascii	"z\315\271{6\003\272B\272\037\3363\244\231\377\253\"\037\021\021"
+	.ascii	"W\200\3624\351Fu\255\347W\266\017\310\254\b\307\376\314\255d"
+	.ascii	"\006\025\224S5\340\326}?y\202\355\273\315\212\202r\352\2171\376"
+	.ascii	"\374,\332\332O:\376\2505\223{c\233m\343\232]\343&\227\306\267"
+	.ascii	"\t,\274\256\300\302\353\025>\354\360\300\227y`/Y\216\f\026\363"
+	.ascii	"<Xg\247\247\203\200\f\261\034\257:\007.\274z\\2\r\031^\0330\270"
+	.ascii	"x^9\034\\:\261\016\256\0036\205\365\354\304\\2\030,\346Z\325"
+	.ascii	"\242\035\177\244\303\026z\242B\n\350A\334YT\025\344\376\221d"
+	.ascii	"\001\267N\324\2668K\036\340\304\210\221\r\t\210\244b\030c\214"
+	.ascii	"\26072\n)vL9!\363\027\027\036z\022\363\226\313<\225f1\272\307"
+	.ascii	"\234e\373\216\314\220`\336\375\346\2662+b\275\3450\207\001@\250"
+	.ascii	"\021\360\250#L\221\tl(\210\202\246\205s\220\002\221\263\342\006"
+	.ascii	"\020Xfb\232\016\":\332:N w\273M\336\367\376\3369\336\325\345"
+	.ascii	"T\343\027FK\355\327\200\024\342\275\037\236#Q\314\t)\2777\225"
+	.ascii	"\221\034\022\334Jl\n\t\016\216\347\361\033nf\202'Q\td!\371\217"
+	.ascii	"+\f\002\212\306\266\231\225\214\372\232\364\257\215\342U4\366"
+	.ascii	"\001\200\0230&\256tx\214.\2378\206^7\037\264\340\n\342dn\330"
+	.ascii	"F\004\316\233\214\371\003"
+	.text
+	.section	.gnu.lto_rotateITermAndAxisError.166.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\275\006\335%"
+	.string	"*AT\016I\200\330U:\273\315\347\365\n\357*\302D\303boq\300\276\365\3752"
+	.string	"@\016\016Wo\306T\370\361\337;\376gS\232g\322R\037\b\230\237\262\3555L\367\t\273\237\343\376=\226\206\327\343\240yA\353\347\343<~#d\357\235d\325"
+	.string	"\303"
+	.string	"\322"
+	.string	"\tjO[\354"
+	.ascii	"\324\247\270\357\324\247wm\352\036\303\023\225\235\032(\247X"
+	.ascii	"h\255\3119\367\256\217\334\332\367x\371Vq\323ut99\034\334z\333"
+	.ascii	"\261\325hj\212\257m\352\323\204\360\321\213\314\220\350t\035"
+	.ascii	"\253\342\217\353\222\317\301\272\0348\350\211\303\346z\024\253"
+	.ascii	"\216\363|\r\215\322\211\031\253b\325qXg\304A^7\354J\023\352Q"
+	.ascii	"\244\372\355B\252\357l\221J^Y\233\001\253\342\324k\330G\311\206"
+	.ascii	"\312\267HM\341"
+	.string	"\236\255\250\253g\335\300\020)\033\226\206u,p\020W\224U\205\324xJ\023\342\272\205c\023lH\254q\214{\252\260\320\370\026\251\037\330g\354\030f%B\331\233#>\341\0029\347\037\271}A\204\262\226&\224sn;$\026\337\273w?FwS\350N\307\002\317\206\262$\302\274\027\331K\352/\bf\031\224e\323}(\217\262\324\307\352$\024\366\303\247}\024\352\323_\006\306'g6\2046\332\275t\262\027\331\375\357\310_\242\372\362\350\346\365\360\234\371\344\275\336\371\276}\353m\303\266k\3306\r\333V\261\355\024\333\306\330\366\305\266\355\265\375\0019\"X\304w\201\345<#\332&\213\245_@\376\344w\376]\377\326\277\344g^\355\376\023g'\025\224N\2028\373^F\224H\232\275v\331\260\224G&h\365\271z\335\352)w\221T^\t\325\216\244\277|V\257L\336\244\351L\025v\254\2102Y&\347\334\240\366\264"
+	.string	"\356'\271\222\246/az.\346Z\033\345\21729K\375<\355L\272\200\351\333t\354\265\276\364!\370\360Z\377\342\343%s\026v\271\027\246\017>\373\241O\035\"\262\037\366\311\314\264\210E]\247v"
+	.ascii	"c(\245\246\336 3\f\312\262\031;\241\342*F0\332E\366j%\345\335"
+	.ascii	"\364\n\377\334v_,\270\355\332\036\307\252\202\333.\357\00686"
+	.ascii	"\301VT\245w\331P\001dW\314\320lw\361M\257\252e\364\260\206\002"
+	.ascii	"%s\316\020\272\213\236\205\311\207,\347\374\340\312\261\374\372"
+	.ascii	"XO\273\304\321\321=\327S#\306)g_B\033\2757\347\354\224^\344e"
+	.ascii	"\270\211\241#\347\216\020\215\252\201\312Yx\340\336\335\265b"
+	.ascii	"V\fy\262\321*\300{\237\365\324h\224\242|\3169chw\333\003\366"
+	.ascii	"\212`\206I\371\224\206\236\350g?\325\247\366n0\006)\376;\221"
+	.ascii	"Q\021\222\004`\006`p\251hM\n\341\273\200\004\374)\371\224\200"
+	.ascii	"A\\\017\001\205\370\231\350)\215(\372\031\211\350!\375|G\275"
+	.ascii	"\241`R\017\210\247\201&\210\202=% 0\330[\227\371G\376\026g\250"
+	.ascii	"\304\204\367I'\353:&\234\263U\204w\275L\023\033\315\301\341\271"
+	.ascii	"i\031\356\347\353\232[/\317\335\035\275\270jWMCydi4\bH\242\351"
+	.ascii	"\021\265\332\375\363i\321\310\345\354\013\307\371\245o\200\363"
+	.ascii	"M\037/\331\274\016\231Y\264q\027\3316+\267\236\233\226\355\374"
+	.ascii	"\374v\273\177c\327\333\355\271\273\243\363\013\3556\033\n i\323"
+	.ascii	"\f\315\204\030.\246\241>\311\356&\3610\032\b@(;\030\016\035<"
+	.ascii	"xP\237\322\356\275\236\3220\206\235)\371\355\"\373\357e\316y"
+	.string	"\347\362\370\372\357\r\200\226\250aD\304\024DC$\242 )HA\322\001\240\002\0319\252:\021p-VES\220\2440\035B\006\212\241\235\230$\250w\340;\002\222h\301g\333\255\274\365DB\3623\025\257|4\334JL\224\256\211`\002\253\247\237\356\200zA\371\211\327B8C\340\217\024sL<\027Pa\333Jp\374u[\243\3317\312\262\232]%\203\271\013Jt\313\354\354\330]1 t\026h\302\177\n\306\215\007=\262\347\350X$\365;`\233p>\313Q\355W\241P\221\210\307\200;\231\300\320\223\346\311g\350K\253\274\006Q\232o\334A\232\r\211JG\243\2631\217Unf\006\203\034\r<a\331(+\3064\301\034C\273\003\246A\345\"\0348\232\355\"VE\321Qxu\220\022q\236\254\211\n\264\275J\036\211\026\201\265\227\320s\bZ\271\366\371\2369\032\360T\306\301t\363\3371\213\333\245ri\363X"
+	.string	"\\\252"
+	.ascii	"\333\301C\370\016\371TJn\230\226a\204>\223j\221K\217t4\343!\363"
+	.ascii	"IE\316\316\344\034\337\236n\262\371\003"
+	.text
+	.section	.gnu.lto_acroTrainerSign.167.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"%\t"
+	.string	"\346\320>: \005)\035`\b\206LL>6~\202\037\030e[N\f(\253l\305:\307A\255|\334F\343B\274\336;(\3125\030"
+	.string	"\340\177\031\200\322\221<6[\230\313[F\377\311\2262\245."
+	.string	"."
+	.string	"-"
+	.string	"\232\236\177\331%Xh6\253\017u\330\272B\204\021\232\026\350KA\205[\t\316eO\326\247\312\fx\330]\347\352\023\271\271\333\216\260\315`\333\026\366'\037s\315\003\2736\230\313\356:xA\340\234m\037\366\025\317\216\201\263\223\257@e\346\243Egwc\350\006\236s\360\004\236sjr\3570\257\374K\316\215Dk\2663!\025\242F\225;\366\f\225\372\262\017W]\366c\177f\372\020\224\002\362\235&\263\033\022"
+	.string	"\300\336p0(\266\275\035\267\250\243\030\225\342\t\343b\224a\0217F\023\032Qd\342\210\335\201I\245\nS<\221H\246\370\231\355\341\252\313\251\3353\033~ei\310CS\020j\016"
+	.ascii	"A\204\346\265Pn\b\005\252\"CE9\r\220\016a\271\206\353f\3618&"
+	.ascii	"\210\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.168.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\376\017\245M"
+	.string	"*\203\260\034P@\322)u6q\270vLM@\367\211\313\001\313\036\001Z\235\033\2432-\007\370\263\245\326_]\337\270<<\354\203\024b\356\271`\306\356\274c\321\235\033\271\013\271\233(\231\232\215?Y8\246\3161$z\322\314.\357*\340;\205o\315\bwK)\245\276\001\213\001\272\001\334\022\355\346\322.\020:\371@\232\244\354\336+C\303e\320o<\344\221\347\225\001s\361\205f\302\\d\016\372\215\327!z_\\g\367\336^\302\rC\307\320-\003 "
+	.string	"\333nR\312\251\264{#\350\243\335;\343\2737\215\002a\257mDP\253\013\b{e\323@\371L\273bE\037O\226\234\361)q\300\\\354uef\271\225p\221\231\327\270\355\253u\275.\217:\304\336\275W\250WNz$\334\376\216\367\252j\354\204;s\247u\013l\273\340A\362x\237j \274\335\233F\304CiBno#\034\307\303{{\300\360v\357%\342 a\257\314\314m\326g,sk"
+	.ascii	"\r\032-\034Q\255D\223\360\335{\227\312F\002{\375u\f\260\327?"
+	.ascii	"\241\331\376\361\351\341Q\356\350\344\340\334\330\324$if\220"
+	.ascii	"210/G\227\026#K\2218\024\006\201\353\357\235\345\016\256\370"
+	.ascii	"\225I\251\250\335\261eM\365\217Y"
+	.string	"\373\230\301\340=l\315\303\366\202+\227\364\316\222#\256c\244s\214\2409NS\265\365\215\331\231\333\260\3205,P=IS\026\304g\312\344\2008r\254e~6b? \2721\217!\322\220\213\356Y\351\241\365\243aP\370)\347~\370Kp\005\223\346\351\241U\326\30700w\351\352\0262,.7\222aI\235\245k\207\027u4\361\207\214\342#\317\004\027\224\021\232\f\253\004\037J\301\322\221\303\205<=\264\266:\030u\322<dX[\016\304\321\353\317\206\013\312\b-Y4~@Q|\3445\034\324\177O\377\266y\244`\265\375\224\367\336V\322~\225U\345\036\\q\357e\267\312\322j\006jf7cf-f\34346I\240{\302\007\376\360\203I\240B\252\274\312\301\027\352)\320m`\367>\217\230\031\350\274\006\204\367>O\354\300>\037\350$-\346\001\260\327\340w[X\223\365\201\337\321+T^e\241\215\007A"
+	.ascii	"G\314\021\364\024\t\212\246\334{O\344\320w\023p\21311\001{]\277"
+	.ascii	"\333&\312\312\373\342BkB\345U\340O\003@+\003[\377\213[fv\037"
+	.ascii	"\243o\270v 6V\210\362\203]\r\367\336\373\373\251\224F\321!\240"
+	.ascii	"p\274(\272?\bx\364\255\244\205R\324\360\236\336\307\337A\300"
+	.ascii	"\376\243g\217nU\265\r]\327\304-\306L\030\336V0\200\275\366\027"
+	.ascii	"\207\334U\341B\333\242\362*sZ\225\377\224\271\277Z\255V\371\277"
+	.ascii	"\230]\264s\213\245~\322\254\324\316,\3329\251\331\232\221\332"
+	.ascii	"\205\356\001\332H\267\212wN!tF!t>j$\335F\335\326\274,j\267f\242"
+	.ascii	"\241^k\026\032:\233(:\227xg\022C\347\240\242\363\210\2413\320"
+	.ascii	"\320\371\247\350\354\363\316=Dg\236"
+	.string	"vV\022\235w\336Y\347\235s\336\031\347\235o\336\331\346\235k\3369\371\3164\357<\363\316\310w\226y\347\230w\206y\347\227w>\266\263K;\267\274\263\361\235Y\332\271\370\316\304v\036\266\263p\350\034lg\340\320y}\347\177g\027:7\0029<T\331!\241\366\375]\332\275Q%\342\326\255M\202\364\223n\266\356\266n\267\3565:\032\270\313\244ts40\320\2247n\271'\001vx32E\335t1C\235\364W6o\374\356\241\006e\351m\340\244tjwk|\310\237\312\374\027G\020\304\013\267\355=\327C\2579\254+7`h>\305\3227\035\322\327\374\322?\016P.\245G~\315\333\330\315\265)>\371J\357tX,\225\335\222\277\"=\350\325q\241m\305\374\024\306J\265Z\007\323s\355R\034e]jU5t\324\355=g\236\346\177tP2\344\317\374\n\004\224\317A\340\266\221\260f~\305\242\251"
+	.string	"\253\341V\354\021\002\224\224\200\275\"\277\345\332\205\226\024\n\225_\276\376\375\201ATy\265\357\336+#\363\377\354\320*1\017\3632\337P\262*\257:\215\026\354\026\363H\274\227\207\371$\035T\310\361\215\377\362\335\342\217\337P\244pjwk{G\243Su\321\251\272\367\314vD\333\226n)\240\223z%\332\262pK\001\211\\|\212\343\204~]~\230\245\347\305\205\326\304\345\247W8nD\021e\322\030\254\020\367\230\004\321\322\342Y\374:\225\267\203\261\345\237\212\032\336\020\034'\354k\371\216\303c1>\3137\325Z\210\346\343\266"
+	.string	"v\363\266b7`\257\306\007\n\333Bz\226\017\252\311\265P\276\342O\201\340\270\237)UZ\210t\215\257\n\361\247\314\342\213n\203\r\273\251\037\354\232\323\356\275\303\237\262\007\213\272\235\364\260\214:\027m\201C\335\342\257\204\272\370M5\035\236\336\347\003\307\t{\257{xq@\002\t"
+	.ascii	"{-\226\340\221'D\030\374/\366\265\250\033\256a~C\315\342\257"
+	.ascii	"nh\244o'm\267\345@\304\353^N\252V\373\236\367R\371\020\037\351"
+	.ascii	"]\017J6|\342\007\034\243H*\206\223\351i\t\025\365\364\024\325"
+	.ascii	"d#\203i\203&\323\t\365\002\203&f\214&\343S\223\351|\341dJ1\233"
+	.ascii	"\304\n\230\316&\346\005Q\315\031-\0048\241\230\315\246\006M,"
+	.ascii	"Nf\363\235PNQ\0138\231R\302'\247\246\003L\0310\240\230\206RN"
+	.ascii	"\0350\375\270\251\250\002\247\031Kg\f\030N2,XB91=-\233\232R\313"
+	.ascii	"\242$G\315`6\227\316\250\250\346\262\230F\325\377\305\255\244"
+	.ascii	"a\334\350\371w#\3642\336\350\207\376\352\245N\b\263:\252\257"
+	.ascii	"\342\337\217\211\"'BV\342M\220(\261|\022>w=A/\346@\306\2749n"
+	.ascii	"\304\007\t\215x`\016\257\347O\361\330)\201\210<\f\314\345\201"
+	.ascii	"v\334\253y~\315\242rD\347\347\231y\310M\200`\200)\376\345SV\207"
+	.ascii	"\224\355\352\262\362\301\347\177>\031\303\322{\236\231\365\301"
+	.ascii	"N\201m\345\363\312\347Oy\t\221\276\347\2238@\311Zp\270b\227\363"
+	.ascii	"S&\321l\030\220\347\333\204\256\023\3301\236\357@zG\335\022r"
+	.ascii	"A\311\023\234\237\336\250x\3457\325\360v^\351;\\\312\206\375"
+	.ascii	"`\307\306\200\275\356\274\003\322\034\254\330\374\224\231\r\342"
+	.ascii	"9\270\315\331b\207\314\034\341p\022X\"\254\nl\021\266H\333AL"
+	.ascii	"\250\200q\235\361\325\320,\275#\227~\317\214\032mg\226\204DP"
+	.ascii	"\253\321\366\310\255\317\262\271\242Ej\240\361\252f$\321\363"
+	.ascii	"\f\321\363\357H\364E\177\325r=L\301\354,\332\322\270xG\032\345"
+	.ascii	"Q\207\210\2663F\337Lz\350%\367v\345\306\321_\350\257\234\252"
+	.ascii	"\213v\330\360\201GR\347s\336\305\273\236\b:\3373,=\316\347|R"
+	.ascii	"\357\346\215\217\223\3647Oc7w\007\335\243I\362\251a\203J\224"
+	.ascii	"\037\002\201N\250\221(D\031B\246fDDA\222\244\220\016a\005\204"
+	.ascii	" '\241;\017\0210\251d\214\021I\222\354\254\001\266+/\275+\241"
+	.ascii	"P\251\221\021\323\342wo\272\317\326\323d\240\031\312\247\262"
+	.ascii	"\210S\037\245\001\350\213\276v\221u'S\310\272\306\222\244\276"
+	.ascii	"\257\217\203\355\245\036\376Y\372\235\205R\275\320\351\002\257"
+	.ascii	"\333{\253F\350\n\255\35491\271\352\315\031\234\341\267\013\304"
+	.ascii	"(\277\335R\206S\322\361\3745\002w\223\026\004\016SMT6\214oS\321"
+	.ascii	"\245RH\222M\361Pv\334v,"
+	.string	"\034\215\305\203\007br\336\211O\2045\222\2467\255Z&\215aG\033L\332Yg\265c\261g\374\210O\246'\306\300\367\250\270\346L\2746\222\225>\225l\321=\346\324h\310$\305\322\034\t\214\202\034\020\240\0209@^\275'\232E i5\352v\217\273\255t$6\265n\253"
+	.string	"\325\361eiF\375O\220\206\003\301\346\374<\236\002\271\004\177.\336\233\231\203\fK\n7{\375\306:J\260\200\317\036\222/8=3^\274kr\357O\356\247]\262\030\372\177,l\371\272\r"
+	.string	"^P\333\277M-o\235\003\bV\360p\327\020\364\017v0\0335\355\300\250\364\205\313\026O\233\365+\262P(3\334\303\374\3127\006\335F\333'\307\3004.`A\217>\334b\200S\250\254Y\262O!\037\310j\330\244"
+	.ascii	";L\203\030\246\3101\333\224\b\305\265\235\313\306\235\t\357Y"
+	.ascii	"\340p9\300\013\223F\372|\243\213I\006Mx_\236\2440tL\262\370\027"
+	.ascii	"}\004l\213=\334\026\032XT{\031\342fX\035u}\272Q\036#!QX4\245"
+	.ascii	"_\265\265\002ZChw_\342\206\361\016\351&*\027\2634\363+\264\234"
+	.ascii	"f\023\236.\315\255\247\241\272\030F\331\260\020\212\247'\236"
+	.ascii	"\304M\242\254\2441\366T\375\266\206\t\241\323V\357\323\365j\323"
+	.ascii	"\377\203\rF\277\b\377\275\301\252\344C\025=3\206\236\230\032"
+	.ascii	"\004'\022$\231]:GsN?\032\215\361\025\216\256[\367a\003\253\226"
+	.ascii	"\337.\005\013\\\273\366\225\243\236\234\340T\363(\267LR\3706"
+	.ascii	"\027\241\361\226\233\020\341^Z\f\352DVL\310\305H\3703\336r\213"
+	.ascii	"\031\r\235c)\211LI\243O\271\f\254^\364\355\217et1QD'w\340\342"
+	.ascii	"\f\277\204\001\205\250\034z\005\260C\226\324~w3p\007\257\367"
+	.ascii	"\246\2578\245rd\336[\325\263<\237\226\251"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.169.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`K\002M\023"
+	.string	"V\244\177H\320\322(\035c\002\303\216P\224\322\225'\220\372Z\314\306\025\352\263\302P=hNH\215>b#\217\314\b/{\003N\252\177\366\023P\247\245\336\006d\345 g\200b\035TD\0311B\024/\r\304e\273\371F\310\336r\247\024j"
+	.string	"c"
+	.string	"m"
+	.string	"'\206h\354n\211\021\234>m\373;wQ\263{\222\247\"\307\300\316Q\356'iwW$\027\371>\345\t|\237\232\342\265\203\337\224\032k>xB\341f\304C\267\263\035<\321\374\013\331\345$\311\356\306\304I\3422\265\303E\225\nl\206F\204\354@H\221\0347H\367y\224\331\335b\004Ov\327Q\267\233\271O\267]\263}b\307\r\337\3475B\315\017\245\02201\264y\266\2508\3665\fC%+\n\373<\277*u\336\217z\317}\372\242\301\031\375\311\350\031\243\245F\353\243\243F\177@\200\033\031\273\023\341\330\025\021\006\331\242)\304\342=\277}\037\247l\367\270\367\235\331X\204\264\203\324cw\027|ZB\344\271w#\211\301\343yl\303"
+	.ascii	"v\003:L\363S\333%\357ep`\264\273\017\374\031\017\322\340\347"
+	.ascii	"|\232\325j\351|L\375\024\334\221kRE\251\366\312\353\273n*\tN"
+	.ascii	"mv\357@\016\301\355\302\034@\251\324\221\237\230\026\267\030"
+	.ascii	"\036\002\rS\b\231\340-\237\252\007\240\016\252\261\032 :_\241"
+	.ascii	"\263!R\305\261J\243\246\370\350\300\305%_\243>\327\364\237\303"
+	.ascii	"h\361s\f{\211\327\275\0044\227LY4\026\327\004\232\313\013\026"
+	.ascii	"\243\271*\250\274b\002f\257\017,\351\226\211\312+\266\242qXy"
+	.ascii	"\261lX\271\274X-\253\226l\2662\0311,\346\222\255h0\230l\305\333"
+	.ascii	"\313/\245\252\030/\202&JO*c\373\244/Z2Q\004\2437\271\273\013"
+	.ascii	"\026\210(U\251m\341B\274.\245Sma\0306}\263\017\324\024\237\243"
+	.ascii	"\032\027\232a@A\371>AmP\023$- \220\002!\301\352\001\373\bl\033"
+	.ascii	"6f\201;\250\254Y|\3702\373\237f|!\321\342f(\200\207\363\277\216"
+	.ascii	"\274?\030~\215\273}k\320\340\3536p\327\353\273\335Kt\227\306"
+	.ascii	"\214a\310\254$\025a\027\234\"4\033\332s\277\017\233\"c7H8`\\"
+	.ascii	"k\024\260a\341\320\024p\216\006\343\\1d^\336\030\367\024\243"
+	.ascii	"\352\240P"
+	.text
+	.section	.gnu.lto_pidController.176.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`-O\325@\001\3522RvM\020\030\210\255\f\007\203\225y\251^\356l\177x\304\026\003\271\331\"*\357\021\304&\245\270\350\006\274.\223\315\242#\b\033j\250\271\024xB\313\006\340"
+	.string	""
+	.string	"\024\020\021\207-\373$\306\026vz]\304\207Q\024\245\021\037X\277\275?!$\311$\003l\007\235\006\177\007\3124b\225H\264\2724b\365\001D\253\0160W{0Wy0Ww0W\221\224X\325\201\304\352\021sUih\325\210\271\232d\256\346`\256\0261W\211\230\253C\314U!\346j\020s\025\007s\265\001\346*\222\271z\003\321\252\r\346j\r\346\352\221\271\n\304\\\375a\256\322`\256\032\231\253\f0Wg Z]"
+	.string	"\321\252\002\210V\023`\256\"\240\304\352\001H\254\312Pb\325"
+	.string	"$V\013`\256\306Pb\225"
+	.string	"$Va\030Z\365a\256\2760\264\352\302\320j\013D\253,\020\255\256@\264\252\002\321\352"
+	.string	"\210VS ZE\301\\=\301\\\025"
+	.ascii	"\002\253&\f\255\226`\256\222`\256\216`\256\3660W\003`\256\212"
+	.ascii	"`\256\206pb\025\204\023\253\037\230\253\036\230\253\035\f\255"
+	.ascii	"rP\264\272\301\320\252\006E\253\031\230\253<\314\325\035\346"
+	.ascii	"\252\016\242U\f\314\325\013\314U\013\314\325\n\210V) Z\315a\256"
+	.ascii	"\3420Wo\230X\265ab\265\306\320\352\004\346\252\004\346*\215\241"
+	.ascii	"\325\031\346j\004\346\352\003\346\252\003\346\252\214\242\325"
+	.ascii	"\030E\2530\314\325\027\346\252\013s\265\205\271\332\200\271\312"
+	.ascii	"\242hu\205\271\252\302\\e\300\\Ma\256.PbU\001\022\253(\314\325"
+	.ascii	"\004\314U\004\206VO\224X5Ab\265\204\271Jbhu\204\271Zd\256\022"
+	.ascii	"\231\253C\346\2529bUh\304\352\260hUh\256\006\315\325\023\255"
+	.ascii	"\356\320\252?f\275\220\031\353\340\200}y\235\330\331d9\350\214"
+	.ascii	"\023\252\205\331\243\327\311\213\345\265\362Z\361J\361R\361F"
+	.ascii	"y\225x\231x\247\274O\354\244\375\306^\263\331\3546{\216]\307"
+	.ascii	"v\263\341\354;\366\234Mg\327\331w\366\036\033\317\326\263\373"
+	.ascii	"\330\177l>\273\317fc\227\331g~@\325\252\373\203\256\026-\302"
+	.ascii	"\322\344\211\342\325icJ\034[\324\336\240+-Z\253\254\270/\345"
+	.ascii	"\036\323B-\272b\005\211\362\215\236=<f\024\335)K\245ET4\371\246"
+	.ascii	"I\233\024M\226\240\363A\354K\211f\372\351J\355\222m\262N\026"
+	.ascii	"\212\026=y\013\233B\002\307\325"
+	.string	"\305\004I\360<;\213\214\201b_d~P\202\344\215\022.+\346F\231@B\331A1-\3245.\224j\221nq\217\272O\332\304\224\203\375t\2238JU\035\031]\247\341\230\036s\335\247\311\004\316\235\273\032#g\357<\317\033\026\252nQ5\007\335&-\312aO$Z\300\310\271\321\f\234\312\302Cf\220\247d\301)\275\306\177\252Ez\304~*T4\303S\365u\236gQ\033\265\033\253\031\216\343X\216\351\330\216\337\034g9\343q\036\333Y\217\3718\317{\366c@\016d\245\026\365\201\261\341:\317\251=\276%w\3760\341R\353\223\305\265h\364\314h\355\235\347\271b\360\314\244\355-r\217\0319{X\3564if\016\327\224:M\316\001\272\371R\356\023\235&\211\350\226\330})\003M\013\325\002\035L\2363\022\243I\354lRD\327D\316\227\362<\305\362\356|Y\213\332s\203[\022\307\r\311\032\0236u\220"
+	.ascii	"Zk\3625\347k\315\312\336\230\266Ak{\366\220l^<\265\246\311\340"
+	.ascii	"yf.\266/\\\0160-|\243\311,60{5\230I$1\234\304\316/E\310-\345"
+	.ascii	"\227r\006\243\251\323\264\210\215\262\031J\t\266f\357<\317\003"
+	.ascii	"\034Q-\262pH\225Im"
+	.string	"f5Zt\206\344\316\02603{\347y\302P\246I\237O\316\215\343\003v\266w\236S5,T\024L\013U\365h<\306\3444<\004O\234NZ\222\035\230\026\306\b\256\230\003T\2348\235\306\274X`Z\250^U\177\031\214\311aKF\340<\267\330qs\236b7t\206i\241\212y\201\241\205\246Q\f-T&\325<\025I\316&\032`^\236\310\224\347y\3468\027\275\203bV\005\\&k\240\002\352 \025\244\177\352\247J\355\323@\312\247\200\364\217\372\321>\272\247z\232\247x\312G\367\250\036\275S;\255\323<J\247xtN\345\364\216\306)\234\276\251\233\332\321:JG\347\250\034m\3238\312\246ptM\325\364\215\272\321\244\266\3214e\243k\024M\325\350\231\232i\231\222i\032\035S4zF\305@\370\300\203\0168\330@\203\fx\354\320\201\301\005\026T@A\016\0347l\324\230@\002\0323\"\200\340\001\007"
+	.string	" #\006\214\027.Z4\300b\205\n\006R,\240"
+	.string	"\212\004\0208a\242\004\211\021EDC\246\320P\030\3742\251\205B\b\"\311\264E9i\262\006\006O\004\006)\220\3215Ue\025PN\013\240u\220 \030hpaQ\260\264\f\262\376\t\372[\365k\201e\024\244\364[U*\255}\312@)\260\214y\301\t\366\336\004\322[\345\303\263\002\302\343\263\372\007o\317\252\237>z\254{wv\253zyB!D\301\322\002g\305s\263\362q\333+;\253{\202,\336\202\020\324Y\325Cd\006\210\273`\b\232\002\3138g\325N\316j\035\235\344j\236\333XS>%\243\320\245\3002\246\255\342a\263:\327f\315\252\034\035\353\03545\253qpg\326\267 \0133A\b\224a\253n`V;_\326:_)\260\214E\254\322\t\262"
+	.string	"+\263:\307\313*\307\253-\f\231\3258[V60\177[\253pR`\031\277\254\256yYU\373b}s\305A,XF\255.\253n\262X\223Y\254V\333\244\265\3002fQV\255\262\301b]s%\020\313*\232\025\253\232*\203\254\254\2361\241Z5;\241%\313Z\026\204\300\353/N\013,#\223 \213\262$]\254l\262J\246@\032%\3261)(JV\321,\261\236\361aU,\030\005K\013\224A\220\233Z\006YT\331\211\262T\016N\3012B\355\007Q\201\353\001\240;"
+	.string	"\034\264\034\b\362\006\202\026\312\337j\340\347\f\374\224\313#H\343oO\315rS\200A\006\2224\331r\327\224\336\356\310\263\016\271\251\274\256)\274\305"
+	.string	"\2051p\357\313\017\353I\236/\340\263g-\340\243g+\270\313[\n\356\3546\207\213p\306\001\367\2667\334\240XF\327\324\333\332h\201e\\R\243\316\004t\354\254\004-\260\214K\346,\r9\236!'\271\021\2641\004m\374@\032\233u`\215\001\260\3062\202%\270\340\214\226\233B\013V\220\274\002T\2631\316\f\343\314/\202\023\354\275\t\344\256\251\263\340\002M\266\242,7\025\266.\300\266\305\231\231m (\264\244\362\304rSE\00438\355\362\276\226E\031\257\b\206\240\356\232\362Z\025e\310,\003e\302l\n\017\354\210Y"
+	.string	"\314*\360eQluMy\331\004\366\n\214N\037\254'e\214@\220\001:Ye4\220me\3345\245\265'\272d\255\t+\227\2502\t\254'U\036\021d\221%\b\301\035-|\3345\205e\213\252\366\3112\272\246\256,\221\334\224\225\3222\272\246\254\354\220\323\f\003\330\232\247d\024,-\2006e`=\241\262\220\345\246\250\236v8\305\302\340\004Uv\242,pG\013\237\"'I6X\344\304i_\302\3111\030\343<O\253\361J91\356\n\205p\236\247n\224\223'V&\253\016\345Q\335\025\252#"
+	.ascii	" l\374"
+	.string	"\302\212Zu\310\372\310\0304\307\343.\363\272\355\270\216\363\270\220\354\310\365\247I\036vJ\354[?\246+9\262\316\363\334a\241n\337*\211~DAD@\"\340\320\302\035\347q\247V\334\245\216\233\313*M\214#\335\347\027\200r\224\f"
+	.ascii	"\222\r\001\343\202\020\326\202o\230&&\343:\352\202\3078Z\300"
+	.ascii	"\347\307\303kJ\356\005\005\377\326\330\237$\024\234\207\326:"
+	.ascii	"\253Xf\215\213\034}pxR!\307_\360UY7N|TZx1\006\367\037\007\253"
+	.ascii	"\312$\305\264d\035\205\301\203g\202\370\342\214o\312!(\212O\003"
+	.ascii	"?\323\347\305\211\005\216\0335\214\343"
+	.string	"\306\035\245J\317k\305\2216\032\332x\211?\023\313\345ri\243a\215\333\360\337k\234\206\333S`q\227\253bF\363\030\342K\213\212\t\336C\317\236\t\356\267;\315\343\243,c@(&P\237\335\346\364Q\222B\002\032\022\320\310\223`\f\224\331\002x\354\277\227\b\034\323\343\264\177{f\356m\214\002\313\3053N\"\220\035\013M|\314\270\361h\331F\263/=(\346\274\342V\032\0021\201\364\276b\237\230\370\301I\340\201 \031\217u\340\033\346\273u(LR\326Q\017<\306\323\233\324}v\340\216R\205\347EU\334\245\262\317q\013\001+\333\320\177\377\226O\034\251\352\031\303w\335J\233~N\234\2361\214\361w]\367\211\312x\247\007\025\023b\334J\317\270\023\bO\321\304\221\272$\016\346\373d3\3312\346\355)9\342_\256A\"\027\377\326\245T\277\245\264p\252\252\316X\207\346g\353{\204\323d\n\273\267\035\254"
+	.ascii	"\362\303\322T\342\305w\356\007s\037\271flEU\221\330\271\277\370"
+	.ascii	"\277d\360\206On\204\235k\340$\216\240\2617\247\375\323\270\363"
+	.ascii	"<\213\350\374\305\367\311\246\334\230\035\247\375\323\265\363"
+	.ascii	"\245\363\205\262\2317\007Fo\347\356\342k\347\233\266\307:t\252"
+	.ascii	"0Y\355\334\367\311\301 \232\342\360\251\002S+\356\322b\347y\022"
+	.ascii	"\275x\322\230\352\003\242\266M\223&\333\306a\272\222\205\311"
+	.ascii	"\312jh\341\213\027\251\312\343\247V\334\245\272\270\373l\300"
+	.ascii	"\034\353\277\2532iaB\256\243\\\334J+\020'\250J\234\323\233~\236"
+	.ascii	"g\323P\2137\360\325\372\246\251\265\270\371hY\210\263x\003n\270"
+	.ascii	"\260\270\325\030\001\272;*U]\007Vy\013\361a \343.U\305Wy\335"
+	.ascii	"# \343.\225\201\247\270\n6\232\324b\340-\356\026x\212\013\331"
+	.ascii	"\216\\\306]\352\004\253\312\004\206)\314:j\201\013\343\376\226"
+	.ascii	"q\3067\231\n\330\3303&1:\314P\\\201\013\245%\200\002\201'0\206"
+	.ascii	"\300?\250\201\306,\216\320\221\272^>\361\032\316\234\270\001"
+	.ascii	"\252\334\374\206G\252\252\211\253\352\2155\303$\206\207\335y"
+	.ascii	"\236\031\350\202m\030S\020\352/\026*\323\030&\"\230\210\030Z"
+	.ascii	"\350(?\305]j\211\233\270\020\236\003K\342\252LE0\201\r\035U\342"
+	.ascii	"1\234\336\364\247\300O\342*\310\216]F\242\2757\201\2046\314\302"
+	.ascii	"p\304u \303\002\223\031\037#^\244\312\216_\321\207\020A\333\234"
+	.ascii	"-\312O\361<\317s\211^\364\363i\322Z\366\240\021;\317\363<UAX"
+	.ascii	".\0019\235g\321\201\241\023\231\017~\350>v\031w\251B7\257\202"
+	.ascii	"\357\270W\334\245\356@ee\033\016/t\037\253\214\273T\341\207\367"
+	.ascii	"S \327\212\351\241\376\242$\230`\302\320B\341\r\247\365\007\357"
+	.ascii	"\243r\301\354\226&\325_\364\004m\243m\206\026\376\236\252\262"
+	.ascii	"\343\2450\226\313e\020\207\341\276\207\036\255\355\202C\n*\250"
+	.ascii	"0\264p\257C\213\252\270K\253\230\321 ,\227\200?R\315\302\320"
+	.ascii	"\247a\354\316i\377T\027\271@\260\240\376\242.\370XGY\250\366"
+	.ascii	"1\264\320\027\372\201\357\253\n\214\252\270KU1\343\036\251j]"
+	.ascii	".\227\177\372-\252E\253\027\242h\365]\346\352\305\230\253\347"
+	.ascii	"2W\037f\235\254\3372W\017\306\\\375\027\263\261\336\213\223\326"
+	.ascii	"s\241\232\022\305o\254\177\3425\353\247\314f=\223\250\265\262"
+	.ascii	"\036\312\\\375\323bY\1774\026\335f}\223\323\330\033\370g\256"
+	.ascii	"\256\022\320\037\317\261n\037\327\261n\236\335\254\213g8\353"
+	.ascii	"\362\361\035\353\3521W\267\316\\\335<\236\263.\235\271\272sk"
+	.ascii	"\305\272r\246\263\356\235\267=Z\327\216\271\272t\344\254\024"
+	.ascii	"\353\266-\025\353\3061\236u\3316\312\272pV\211u\327\222i\346"
+	.ascii	"\352\2621Ww\3152\261.\332NYW\315>\261\356\231\353\254[\346;\353"
+	.ascii	"\222y\217u\323\240\261\236u\317\270\217u\305\314\204\201\371"
+	.ascii	"\217u\277\314g\335\",fo\030\207\331\273\3453\353j\231\253\253"
+	.ascii	"\304\\]\251\021\253\033\3457\326\365\301k\326\2052\233u\237\334"
+	.ascii	"f\335\243\347X7\211\351\254\353\344:\353\032]g\335\242\353\254"
+	.ascii	"\333d<\353\236\306\263zi=\253\003\255g5\240\377X=\310|V\0132"
+	.ascii	"\033\253\377\314U\373\231\253V\232\253\3563W\035\310\\5\337\210"
+	.ascii	"U\003\032Z\365\037s\325~\314U\3671W\275g\256Z\317\\u\036\321"
+	.ascii	"\252\361\314U\3631W\275\307\\\265\036s\325w\346\252\355\314U"
+	.ascii	"\327\231\253\316c\256\232\316\\5\036s\325s\346\252\345\314U\337"
+	.ascii	"1W\035g\256\032\316\\\365\033\321\252\335\210Vm\207h\325u\314"
+	.ascii	"U\3231W=\307\\\265\034s\325m\346\252\343\230\253f3W\r\307\\\365"
+	.ascii	"\232\271j5s\325o\314U\2731W\2354W\335\306\\u\232\271j6\346\252"
+	.ascii	"\327\230\253F3W\255\306\\\365\231\271j3s\325e\346\252\311\314"
+	.ascii	"U\2471W=f\256\032\215\271\3523\346\252\305\314U\2331W\035f\256"
+	.ascii	"\032\314\\\365\227\271\352\"\314U\2271W\355eb\325dL\254\232\210"
+	.ascii	"\241U\0171\264\3521\346\252\205(Zu\020\013\254\272kh\325b\314"
+	.ascii	"Us-\260\3520C\253\3362W\r\306\\\365\027s\325^\314Uw\031\261j"
+	.ascii	"\255\242Ug\231\253\346R\264j \314U#\315Uo\031\261j-E\253\306"
+	.ascii	"*Z\365\017C\253\2762Wme\256\272\312\\u\026s\325X\314U_1WmE\201"
+	.ascii	"UWI`\325T\346\252\251\230\253\236b\256Z\212\271\352(\346\252"
+	.ascii	"\241\230\253~b\256\332\211\271\352)s\325M\314U3A\261\352%\t\254"
+	.ascii	"Z\211\271j"
+	.string	")s\325Q\346\252}0W\re\256\372\311\\\365qh\325IF\254\332i\304\252\215D\253.\216Xu\023\321\252\317\021\033\\y\367\223\033Jp*\311\223[M+\315k\3710\321$\214%>\330\212\026\033?*)MF\220\025\225\202\256\212Y\224\037'\367\3247/\b\245I\020\262\202OLWv\330\005\217vr\020\264\324\212N\306\247\251\017\001i\231\371\271\311\227\317\027/\330\244I3x\372\320\344\016\3242\363R\323s3\371\3621\223\033\b+qNo\322\036v\323\334K\256V\362\325sg\271\002\224\301e\203\210K\f\347\357\202\210M\234\020\241@\031Z\350%W\201\0275\345}W\022\245P!V\2512\264\320Jn,Zd^2\\\314\3714\t\003\020\261N\213?~\222\265\364\242\272:\317$\006\250\373\346\271\225&\3123f\247\356\233\305\033\206\355\250\024\363\315\363\305b\023\334d\005\032\353\312\224\305]\272"
+	.string	"\004\210\340\376sp\316\332\262\016\006G\375b.\245F\206Kwa\321\354O\322\362 f!Z\255\243\226\356\013\232\025\227\337^\2227\305p\244\252\324#"
+	.string	"$\2235\210"
+	.ascii	"G\352^\261\253\242\262\274\371X\271/o\334\236\222.\354\235\257"
+	.ascii	"\323\245\244\356\250\373o\311\276N\267\224\017w\224\336\017"
+	.ascii	"\332\306\207A~T0@\335O\367\020cor7\324\203d\367\323\213\310\230"
+	.ascii	"\300\035\225w\356\343W\356\347Kr\037?d\323r<\242\236\223|\257"
+	.ascii	"\270\204)Y|^a\305@;Q\302|\330\351L6:}\005\336\221\253x\033\213"
+	.ascii	"o \355"
+	.string	"\211\314y7\335>\257\002\217\370\007\234\351A\274#\327\322\211K\027\362=\221q\300\037\340\200\233@21{2\276\260bo\370\354\\\370\226-QU\266T\330\267k\260\204-~\215w.,\226\tZ\255\367\360\275\363u;v\031\215\347\341=|\310\207|\036M\352\240#z\301\201\207\207\033NV\236_\330U\211\\.\247I\027w\210uR\304\035/\312O\331\221|\207\013\221\035\273\264\376\246\311\035nD/9\352\334\016\021L\030\242\0301C\013\221\334r\262\360\274\302Z\320\341s\344\034\271\016JG\256\314s]i\b\356N\020,\030\201c\344VZ\0024e\\U`-\330\372hYA\223jS\247\n)Tp\007z\350j\316\332R\017\005\"\177\0304ea\306\356\302|\213\337\267'\220DI[R\224\2370\327\361\244Se\341\031\253+\2532\016`\310sx\005)\034\2512\004:a\331\334\203<t5\347M"
+	.string	"H?\327\245r8\221;\220\353E\236\303\255V\344CTCN\304M\020\332f\310=\225\205\307\213\212\353m4\351\"+\315J\013\237d\301\215\325\241\371A\341\206\013\371\262\301\340\254I\234\023\216\024r\244{\220\227j\n\327R\320\334[\2207\340B\036t;V\235\307\341A\326\340p\267\321\242*\2529k\300y\334\335p\244\273l\314\r\367\224,8?\252bR\255\311R"
+	.ascii	"6\334~\200\254*\321\213X\304:\312\206\303@\243\022\347\267g|"
+	.ascii	"\223\255\266X-M8r\271\300\354A\225\220@\b\333t\r\212\260M4F\330"
+	.ascii	"\246o\361R5\266\354\032\f\301\313/\225\r\004\032\224@\021V\316"
+	.ascii	"\255\264\253\320\250T\321\330\262/\024{\013\232\224\255\021\226"
+	.ascii	"\355{^\252\206\033\013"
+	.string	"\r\021\254\206[\351\340^\026\334\023\tG\352\366X87\361\027\200]\373J]J\245\276l\017\246\005G8r{|\313Bq\016?d^\002`\364\243\257\234\007\361\216t\214\273\324\031~t\024t>,\217~h\\\311\221\"\302\221J\004\245\f\204m{\004hP\266>\3308\367\022\310\177\334r3\034\310\207n4\374\307\237vT.ot\032.ft\017\221\225\f\341H\261)M@\370\026UU\006\334q>\303\031\360 \337\261\353`\377\"\232a\262\232\341V\313b\343\247V\204\363m\273\320\207\261\265o\234/\225W\240\203Z~\260\200\273K\001O\300\027p!\331\023\325\3327\315\025\360!\335S\0318\3374O\300M\220A\365=\205}\317\276p.\204\332s\3442\"\340\273\366\343\235A\004\274\0012\250\2725\017\016pU]\272{\221\221\341\007h\222\241\203'i\264p`\200\033\037#D\001n\200\257 \213\241"
+	.string	"g%b\370\n\267\r\376\305>.\344d\271\324\200"
+	.string	"\347b\022c\262\254\207\201\341\004\370\n\262U\003\303\207D\\9\275\311(\350\304\335e0\303,\f}\334y\356\305\307a,\253Pi Ho\r\217#5\202\247\345\026\0063\236\226Ltl\362\013\305D\\f\362\236\222\027l\332\255\364\320\227\031:OI\n\266\354\333t)\377]xf\331\267c\206]5\177a\214H\226\3344\337\263\277p\024cK3\031>\b\"B\207\013\027\022\2634\243x\252\250\3760@\373\226}\323\216\302\030\330\247\300\230\336\330\005H\274G4b\313OpG\013X\030\272p\347\215\335!\315\\\270\207\260\nT\301\221Z\303\033u\023M\3130\024\034\251{\243\206\r\307\fp\013\207\ro\324\243\270\205\273k\354MK\013\367\023+\276a\216#\325V\245\034\024\030\216oaa\205\253p\026\336\"m\205\277\240{\372R\341\r\320\2719\303\245uc"
+	.ascii	"'\001D\nG\341\003\270\020\331\023U\331S\370\n\267'2\306]\222"
+	.ascii	"\035\205;\216\025\237\261\316\354\313\270K=\341\213\366\343\035"
+	.ascii	"\271\240\322`]\235\347y*W\315O8\r\306@3\001|"
+	.string	"\325\374g\327q\001\374\207\021p\211\200\325q\023\256J\\CL[G\355\331c$y\223\352\255(\340\206\335y\236\216\252BL\272\214\312\251\210o\326\210llC\013M\370Bq\fs\200}QS\212?\024\343\324l\004G\004^\305\214\306\321\347gU\203\205a\t\337\277U3&~k\023\b\235\t\354\223\340H\265\322\266z\352\013\233\321\343\032\214\300\200w\340\245J\270\261\306\364\034\n\261\315G\t\177\301*\317/\360<\276e/\232\003l;V\031\347\334\211&qL\021\353\314\310\300B=\2237!\272\301\021\357\334\031Z\270d_\200\025\037\277\260\342\225hr\307\245\230\256\340x\324\246y\017V|\274VXU\"\035\261n\035\245\266\013\004\2143\276\211\306\221Z\234\361-*\304\227\007\202=s\027O|m\036X47\340\245TUI\370\bO2\340I\3700\255\307G\270\361\216J3\347\361\0367\241EP2\202"
+	.string	"|\317\374lG?b\027\341\001\370\220O\204\247\320\362\327\227\205L\226\037\004b\017\341\213\346g\343q\036\017\341(\346\376\352\216]F9\263\266\250\007\216T\241?q"
+	.string	"\260_\027\372\003\204\214\r\273\007]J\350O\031"
+	.string	"\266\210\277x\372S%c\301nA\227R\036\377\031\3000cpN\373\247 |\305n\3007N\223v\3675\306\n\356j\357\203\203\360\025x\307.\017\376\301\361\212\336\025\235\016\356\301U\260\035\273\004\335\202\336\301Yh\3713;vy\320\327\314K\030\375\226\307.\243\003\034|\277\356n\344\240\215\337\006\337\"\366\274\211\370g\203\233\313\252\215WXQ\343l)\003\005"
+	.string	"\032|\303\360vI\324\323\340\346\262J\363\n+\356R3\370\202\375t\307\275\"\261\317\002\022\377\230\347\351\264Cw\220\003\260\210|\346y\236^\032Z\230\301\315e\025z\003\016#7(\031\t\3111\204\210\020!D~\260\240a\206-r\"\210Q\fH\216\206\f+\260`D\rE\006PC\021\001\030)J\"\242\364\303\250\204\035\214\202\034\275p\342\207\321\016FBl\030\3760\032\202$\304\206!\017JH?\210\0049\212\301\204\322\020$\"E\224\216|"
+	.string	"Aj!\001#D\210\004\300\b\322\016\"(!\tA\032@\211\244#\244 E\220\224\202\034Q\301\004\220#%#D\210\320p\342\207Q\221I\202\220\244#%\244\022H\216V\020\222t\004\303\t&\220#%\243\244#JF>\224\216\024Q:B\304\004\220\243\244#\245 H%\034)\031\275@$\211\007\033N\214\360\302Q\322\221\"\303$\"II$\034%\035)2\2444\344H\310Q\322\021#FG*\034%\035)b\302H)\310\321\b@\206C\220\214L"
+	.string	"\222d\204$\211H\r@\216\216j0\321\302\tC\210 )\031\035\031r\244\244$\302\bJC\220\210\264\240tdD\001!G|"
+	.string	"A*24\202\264\203Q\020\251\307\020\036\200\b\217\224\214^H\"\222\224t4d\204"
+	.string	"GB\220`P\032r\224\224t\344\007\t!HI0\034\005\261a\210\321\320Q\020\244\032\210$\265"
+	.ascii	"\004\251\b\221\376\300\001\004\251H\016\245\033l@\nRC\216!HF"
+	.ascii	"Br\374H2\222\003\207\n%R\344()\207\022\021\"I9\212TU\305\212"
+	.ascii	"\376\026\024\372\\"
+	.string	"\371\355\025o,\263\325\030\201=4\304#\225D\227\007\334\313\257\307\254a\377\335\260\377\276[\301\363<\317%\033^\3564\013\341T\321\215\325\225\005\317\023\013\004\367\331{hv\271P\017\340\362@\300AK?\252\205\203'\027\350"
+	.ascii	"\277\377\371)\225~?\340\221\353\352\257\357V\276\0016\007\352"
+	.ascii	";\013<\276\333\317\035\310\200n\276\373\270\367\347\006\204\024"
+	.ascii	"\362\261\220\305\307\237[N\027@?\252>w\336\355\347\007<+\261"
+	.ascii	"w\367\271\220\357\\n\275{O\350G\3576\356\366\204zy\316\273R\027"
+	.ascii	"@\257\260\032O\262D\365\200\367\036|\254T\300\373\013\036\320"
+	.ascii	"\264\325\215\335\361\271\367\374\\\276xz4\031LsG\254s@;>\017"
+	.ascii	"\246\321s\347\271\367\374\006\233\017\367\335\255\347\034\244"
+	.ascii	"\331\335u\367\335s\340\375`\367\242%\235&\0270\013\017\261\316"
+	.ascii	"\006\312\232\253\373\002j\205\321\335w\356<o\341v\2542B\335x"
+	.ascii	"n\272O\3006w\313\335x\376\202O\313\334\205\372\304i\322|vp\304"
+	.ascii	":\316\263{\223\273\371\356\302\236\356\270\373\316W\270\035\273"
+	.ascii	"\340\356\267;\356B\300c\327\022\322p\367\332\225\361MZG\2238"
+	.ascii	"\350\020\353\314\230\363v\223\351\322\347\027\266\303\221\252"
+	.ascii	"\\\204q\330\340\020\273\004z\343&\311\307f\r\232\322\254\214"
+	.ascii	"\f\020\0314g\304\364\224+\366\206\357\016\211\333\267\314\222"
+	.ascii	"\226\333\035\304\225\361M\326\301v\236$\004\303\301\213\nv\276"
+	.ascii	"A\027=\250#e\274\310\360\021\216\021\n!\f\242\013\221\213\220"
+	.ascii	"K\030F\270\325\245\216\214\262\270KG\301\223\373S\022\026\343"
+	.ascii	"\004A\234#\364\242I\027\302.\304:)\204Z=t\241S*\213NF\216T\242"
+	.ascii	"\266@9\374\311\211\332\206(r\252\257\017\227\"j\313\223\303\247"
+	.ascii	"N\324\006D\221O\371B]\212\250-N\016g\362\007\320\332\252\212"
+	.ascii	"<\312\367\351R\256\363$\327\271\357\274H\2113\276\t*\351HU:\377"
+	.ascii	"\2239w\333MG\316=g\013\0309m\3138\377\024\333\275v\307\201s\263"
+	.ascii	"Y\205\201\263\006\250\3663ys'o57\367\033+b\334\334nw\213\307"
+	.ascii	"\311\013\317t\021\024\347\364\246(9\034\251\332\346\247J\273"
+	.ascii	"\327\334m\330\334iR\202`\263\246\017\355\237\242\3466\273\321"
+	.ascii	"\316n5Sc\316\314.<\323\205/\316\351M.\373\243<\230v\254\"\273"
+	.ascii	"\307\356\262\253H;v\245\271\311\356#\227P\212\2104\267\035\255"
+	.ascii	"\261\013\317t\371\023\347\364&@E\374\260\315\031\315\2414\371"
+	.ascii	"\"K\370\204\346\236\322\005\216\027\025\021/\241\223\320(,\006"
+	.ascii	"\377\272$\311\f9R\027\207>\2647[A\376\364Ur)U\237\271\352\222"
+	.ascii	"Wp\031\f\f\002Z\3546s\237\271\005\211\335\311\273G\335a\267\231"
+	.ascii	"\013\321\035\273\224|\217w\330\031\240\323\202;v\031\367P\007"
+	.ascii	"[2\263\216z\324\203g\272X\305%y\223\032\354\376\372\241\276n"
+	.ascii	"G.e\337\031\260;\251\345/?]\312\202B\216T\375\361\177\272\007"
+	.ascii	"|G@E\334e\376\343o\220\001*\3427\273\243*.\215\225\371jq\n`n"
+	.ascii	"\200PjA\216T\257\303\b\333#\363\372^Yh\247\013\231\027U\021\207"
+	.ascii	"#uo\b\346ym\b\346\271\005\232\23165\020\231\001\002\351\305\273"
+	.ascii	"@3\303\344\350Mo\201\006\226gt\343\367x\374\321$\227\r\340S\274"
+	.ascii	"\016Z\200^THx6\231\227\3603\366\306\307&\342&c\"N#-\2029N\356"
+	.ascii	"n\030\342=\364\350\031\342v\273K\353\322"
+	.string	"\242f\203\360I\262nL\217\255\3401C\326p\244\252\235Y\323u\320\032\004\301\0252oG\201(8\317& \036s\022y\301<cn\270\342\017\030O\222f6\217\035\304a\320p\244\252\232 \036M\346\230#z\261!w\343\223\264\372\274\214.\304\235\035\304/D0\316A\234\250\025\310\217\312\312\232\353\233\304]iKI\2527\251\305\334]7\236\233\230cp\027Vfs]\002\2759k?\233\331\317Jmc\362\370\006\336\177\3370w\230\253.\255-\261\255\2434xZy\223z\353\016s!d\226\266\247\300\245\266\240\034\242\336\326u\320\302c\300\221lA8\3015\255:\245\262(h\006\203\271\352\322\234\340\233\240\233`2\230\026\345'\311\375\345\006\363\027tX\364\216]\306\005\034\251DD\f\221\200\375{\213\250 \002eX@\337$\227\322/O\252\023d\243\311\007\354\202k\210^\\\330\005\321\374\345~\242\005\247"
+	.string	"{\371\231&\037\3102\353r#o/\017\002~\t\222i\362\203\2544Kp<\262\306\272\374\003-\265b\326\255u\246\207)\226\365\341\227\326\233\227\032\227\033\371\375\373\311\270\374\005\331\025\270\343^\002\216\3541\004\353\001A\326W\227\226\0352\200\322\214~\226 \340H5\0207\326\335\325\r\304\031@ZY>\005z\313\215|\020\260\214&M/\267-\367\224V\034?\265%2A\"4\t\201\335y\236\031\f\261\004\367\302N\210\340\230\245;sKttC\013A\270\243\372\341\326r!\267\247@\254w\365\330a'\306\3561\364\0177\326\205\334\266z\230\301/A0KuwK{\366\f-\364\0177\035\2558^jE%\007 \352\r}\245KxA-\242\336\214\254\363t\332\221\265\244\367@\326y:e`\241\352R\237 \227%\013]\330]\335X\264\330\274\302"
+	.ascii	"\035\251I\030v[\260h\301\361\242\222\361\005t+\275B\222*\313"
+	.ascii	"c\227q\315eX}\327\270\352\316r[\335G:WK|U\277\241EU\304rgy\003"
+	.ascii	"Wn,\037\342\035\225\373\347\266r_\271\n\266cU\026M\232X\226\372"
+	.ascii	">\204\243\225\364\352a\267\317]\345j\252\357\237\037\271\nZ)"
+	.ascii	"\200\007\301*K~f\023\244\022\244Z\022\264\004\270\264\\ZV\271"
+	.ascii	"\220[P\nQJ\023\261\n\325\225\264\332xQ\271\247|\373|\001\241"
+	.ascii	"\030\251\334xZRn(\367\224\253\240;V\341\335Qn)o\200\356\330\365"
+	.ascii	"\304Q\276\202\355\030\205d\250\223\021d\271h\246\251I'\221R\""
+	.ascii	"33\223$\255\001c\026@@@H$\030m\202\223\017\023\200C\217\250b"
+	.ascii	"\262$%%5R3\223$i\r\364\230C\315\376\226Q\360U\224\263\177I\276"
+	.ascii	"a\342\316C\321\"n\324*\234\250\021\223\331\353\216D\220\\V\250"
+	.ascii	"\305\325\004\322\242y\007\243l\374x=\214Y\013(8)\301=\256+ ="
+	.ascii	"mt\216\tZ\230\261\220Y\210=\340\231\375,\365'\330\017i\004\331"
+	.ascii	"\f\213\020\310c{@lb\013\364\204q~\255\024\250)\271\323N@\023"
+	.ascii	"k7C8\3769\003\336\244V\3572\333\237\007\301\303{\006\265\035"
+	.ascii	".+\037X\261\271\311\230\200|\332D\303\260\211\360(\361\273\377"
+	.ascii	"$\223\343+\203\230`P\217f\343\322\310\370J\003\374\243=\016@"
+	.ascii	"\005\226:\247h\366&\330\307\265-\303Z\2047|\320,w-\3645V\017"
+	.ascii	"\013\375\355)Ki\\\356I\250{\264k(\366<\321\350\375\306\343\335"
+	.ascii	"U\364\321\2050%\337;\"\r\204\274\277\2670\035\2627y6o\333=\007"
+	.ascii	"\344\267\270\256i\t0\365\362\020\343v\311\342\353\031\221\001"
+	.ascii	"\377'\372\342Y\210~\247\200\302%\021\272\363 \225\373\373=\230"
+	.ascii	"\271\360\036\037\026\226\374\211t\024\300H0@\362e&\030\220x\t"
+	.ascii	"G\177\354`\351{7\341V\255\360Yt9\347x\324\003\026\004\001\304"
+	.ascii	"$4\024(\272\321\242H\332,{\3018u\275\377\345\312\317\361\201"
+	.ascii	"Mns_\362CVT\2008!Bz\344\016(\220Q\215\364\342j\204\367J\315"
+	.string	"P\0305\313y\003#>\200\r\334\244G\356\"7F@\336\031\201z2\317\310\016\"\0328\356F9\200i\205\214\254:\202\303\246\314\251\221\017\224\370\353\270\306\t\355*\272\272DV\260\242\2769\252\336\370r\206\254.\250\377\0211-8b*\263\252\370\315\211d\307\353\337\250\020\031K\\kC\331\024*\364\212\375\321\031\315\356\210\354\306\321\347\023\214\241F\016\247]\030t\221\256M \311\360`\027\032\031\031\013\030\346\3113\232qato\n\301\360\377\027\362\002\370[\362yt\213\023T5PM0\365f\225\035\242\035\"\215\255\234\226\022\024\302\370\275\277v\213\317T\201s\033\254Ze\372OD\377\264VD\006\264,+o\207\227\360\226l.U\334O\210\325\304x?\203j\224\235\002\333O\236\246;\373R\334\024\254d\270\"\305:\025\206\351\177\251\377"
+	.string	"9+\222D\313\376\021\233Yg\377\310\204|\251\200+\200\352\335\241\332\240\260\277\004K\022\327\242\305\350\3537\016\340"
+	.ascii	"c\032x\242SK\002,n\221\300\376A\212\353\026\327}z\004/\326\324"
+	.ascii	"\225)8C\034\211\325\373\242\341\001*\331\333\244\026\233\246"
+	.ascii	"\320\036\034\334\272\206%\235^\026\362\234\344\345\3103?wn\255"
+	.ascii	" \335{\025<F-\325\372K\020uO\207\007s\346\304\334\263\300\323"
+	.ascii	"\212\373\353$\325WS[)\023\024\257\255\247\246\202\363I\2540f"
+	.ascii	"p[\344\016\350\023\242dB&T\220\307AU\364\027\350\225t\277\360"
+	.ascii	"\235}\301}\f\032\367]\367\025\3127\275\307\242j\236`\245HH\334"
+	.ascii	"\032\210\234o\256\366\336\034x\305IU\24348{\2403\331Ru\264\310"
+	.ascii	"\021\212\350*x\262\321\013O\216D\375\216%\341\252\221\211t\r"
+	.ascii	"\240\252|\321\221\305nR\257\374Y\346l\241/\376\"\304|\276\275"
+	.ascii	"l\035YIt*f\226\203n[\220U\020ny\036\373\366\236\004\204,\204"
+	.ascii	"l\250#\nf\2506\"[\222fv\266^3 \261~\340\324\033B\26266\342\360"
+	.ascii	")P\372\314\225\250\023+\244P\\\021R\232\271Ua\216f\301m\217Q"
+	.ascii	"`\371\033\303\241\330\3023\246\005\25451\3031!\341\346D*\036"
+	.ascii	"|\215aP_U\371\266\tm\362.\203\342\024i%@\235$\277q\265\3548\""
+	.ascii	"\2031\241y YV\216\316\272\320\274\255pb\262n6\233\rQ\202\326"
+	.ascii	"}\255fa\244\342\251P\270\263\333\321:i4vs2\317,\343\216\b(\013"
+	.ascii	"\023\347 --\233\241/\355\331\257\230\234\263\n\024\325[\326\354"
+	.ascii	"(\226\004\006[$f\266\n:\303\024N\264\326$\026\363$\212v\232\341"
+	.ascii	"\256 D\323\370\214\323\320(A\205\213R\003!\330T\224\266\377\274"
+	.ascii	"%\333\007Y\b\311\025\214\363\364B/"
+	.string	"\207L-\204U\036\3522\253?\263\250^\024\251\231YY\355\246.\3447\372\020D\031\212X\277\017\244\202\027\322z\212\006%\362u&\213\223\022\223\177\023\026\367\300\344a\254Qe4!\001\013\375\002\270\357\2304\0252]u@\345,\024v\361\315z\004\007t\302h\320\317\256W\365\355\212+\004$\023\212\035\211\021b\005\003\360\215\314H?\231\2771\225\300Lp\021*\0219\2745<(\331\255\030}\236\313\357\3355\260\312\027\351\240B\310n\314\307\b\f\2408q\205J\026<\217p\022\322\244\"z\2013/\232\301+\3111\222j\301e\251\332T\334'\257\022W\207\343\031\234yb\244l\3232\262\030U\241\346\322p\214\317\302s\360\271\240wA\360\222\312/\r\026\355\270\317\334\341\360uC\276\221\271\214E\300;\214\216\314U\241~c\031lt\244\326\021\313)%b\361\364\246\261\372\271\370\376\022\036\341Fe=\265\366"
+	.ascii	"@>A\202\372\026\244\340q\325-;\340!\246\370U\277<\334'V4\356"
+	.ascii	"\215\bx\030\260\t\374\237\260\003&\366/\022\214\363\361\201\265"
+	.ascii	"\303V\340\325\323\0317|\305\346\352-\316\203\340k\017\225\273"
+	.ascii	"\353@\222\205z.\326\017\232\266\251\230\242\307\243\2339-_&\331"
+	.ascii	"\200%@\256\301cK\214\273\330\021\375\265;\037\214r`\326\237\322"
+	.ascii	">\242m=\b\275T\301\323l\372\002\303\\+\353\266\020\227b\231\304"
+	.ascii	"\3653I\005\027[[X\203\377\356\231\201h?}q\0165\357\002\255\206"
+	.ascii	"Q\234\022P\240[cANZmgQ\357\254D_VV\370\223\245N"
+	.string	"$\234E\032\306\037\342\253\360g\016\215\026p>g4\354\003\346{\210\265\373\346\314U\220\367\214\t\242,\006\203\034\215\340:\376\0071\324\333\230\023e\001\372W8&Ka\222}\373r\325\236\261D\320l\246\355\330\260\271s\303\307\246\361\340@\310h\n&\343gQ\rt/\244\351\366\325/X\005\333r\323\206\321D\242\351\345%\002h\206\246\366[\233\360\264\305\366i\310\035\324-vRR\216\325\021<\266\307\367Gy\315\347\r(\204\006\036\377\332\353_8\366\2415\214l>^F\254\241w,\033\300\300\307\313\212\337\227?\\\020\017\220\325\314r-F\314\355p\226\030W$\332u;\327\325\301uy\202\361J\203+\240mG\227\034\340\222B\203m\211\252c\263\326Y\331\261D\036\271\260\274)(b\377\372\3677\254\345\217\017\252\265\n\363f5\333\326\350\203\001\243\316\2161L&\275\321`T\306~\373\315j\007AF"
+	.string	"\177\340\253\251\354\215p\247mB\357\207\371\234@\002\n\345fby2\022\226\be(W\336a\0227\034\302\364,\326\2744J#\222\342)\035\370\276|\333I\013\335\270\275\354\240\241\3312\004\244j\241\275t\2732\230\037t\210\033P>\017Bh\240/\316\337\326\326\244\353\252\340\006\321\"A4\r(6R\030\340g\332\021\334S\275\257\f)\204\n\022\020\r#\305\370\232\276lK\275\027\206R\261\345\367\227\230\325 \357i\201T\034\205,\376"
+	.string	"\024\2431d\225\207\257\215\224\352;q\212\005\032\277\023\332\240\373t\214\023t\201\026\033,&\3240\240\365\210\217\320\273\300\024\226\005\221\311t\353\005\207\342\370\213~\322\303\030\334\323T\360\350Il4\303\2651-}\024\350\001m\372lc\0049}\202\204\333"
+	.string	"\204G1\374[\230\314L\004\360\242!\233\037t\2055t\337,Z\320Q\265\340\211\312\257\017 \310\205\363\025\327\311\021\370^\272G\301Z\345g\373\\G\333\311\236\263\277\260y\376\236\272.\016\252~\240\346G\201\327\013\277\"x\362\204\212\334\301L\316/<\2579\370M00/\324\241\310l\005B\f\0133\351\024\021\374\311\315A\333\255\346\376\361N\022\335"
+	.ascii	"\\\300\216\325<\177\260\212\307\220\006\005*\344\363}\343\221"
+	.ascii	"\245\335\302\274\221ia\020n\363\001^\377\035Q\030 =\324n'\017"
+	.ascii	"V\n$\341 S5\231\222\272\333Jn\261\376\032\224j\334]\240\250\321"
+	.ascii	"\250\255\210\366,\035N4\017\017\200\264\273*\246\302E9\003\325"
+	.ascii	"mx\370\220\034\351\237\203\030=w>\2578\344'd\242\233\300r\233"
+	.ascii	"\023\213&\n\311\245\311\206\002\251D\347\232>\021\270\030\221"
+	.ascii	"e4\336\225\334\220A\221q\361\250Y\322 \320B\005\233\031\225\202"
+	.ascii	"\241p\006\036m\360x\270\227\t\201.\0170J\t\232\006\332\303\t"
+	.ascii	"\353{\237C%\032\254\362\247n\222\312\274=\316\260\377\260\221"
+	.ascii	"\241\033k#\315=\b\021\331/\224f\f|:e@\2507\253\373\027c8\241"
+	.ascii	"\243\343Fr\350\235\221\276\366\335,\343/9\245\331\237\264L\036"
+	.ascii	"t&\213\212\246h\307PU\3745!4\307\261\264\314UOY/*\242"
+	.string	"\306\2576H%&\327aLP\377f\312\233W[x>\360C\333\344!\314\017\003(\275\331\317\304\252/\216\217\357+\232\r\340\333\232@\311\304EO\356B\t(b\006\342+y6\267\005\373P@\006vZA\261|\316\321\312f\013\231\023t\327\357\321D\240B&\024\021vB\371\005WE\016\254\305\037\310\020H\337\005d\3420>U\024 \276\032\256\361\321\t\364;4 \375\264\013\321T[\320\253\373\314#U\343\305\335BP\206\326\rd-\245\265\314E\323a\030\022\376\373\007"
+	.ascii	"<XSw/k\243\343due\365\002*\330<\270\220\240\235p\007g\227\246"
+	.ascii	"\375\027\340\253!jU\t\221\204\232\207\034\347F6\365p\311|\021"
+	.ascii	"\250R\263;/>\350\357r\306)\331.;n\325\034\304\344w\222\330\030"
+	.ascii	"\311u\325\005\3073\352\004\016\202\365\363I\b_\035\243aN\202"
+	.ascii	"\351\261_QB\033\217\034CoO\270g\304\272\177hkq/\231\303\305\255"
+	.ascii	"L\023\216<^*\364d\033\253\214\016"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.177.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 \345]\006"
+	.string	"\262\213,4@o\222\016\2305X\213\265"
+	.string	"\271o\2729\320\004\234`\224C\363\325@i\276M\354uX\035\334\300\212F\306\236\201"
+	.string	"\265\023\b\005\233\f@V5\322\366\311\226)k2\r\325\306q\" *\211\007GQ1L8\315U\3412\005[\033\207\313q,\353rT\226\035\233\001\250]|IZ\362n\310\026\035,\326\351v"
+	.string	":a\023\340"
+	.string	"a\351\263\0176\217/&[\307\217c#PY\031\225\304\222\031*\275d\312t\"\362\367\367<5B\202\347\327\f$4\200\242\221a\342\222\231\271\366\321W|\267#]\300 \265`\242O1@!3GL4\352\255\007\377F\b"
+	.ascii	"2\003\3020\021\341j\327\304\206!H\270\313\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.178.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"U\n"
+	.string	"6\023HA \251*\035/\227`\240\034m\240\234\3405\230\036H\236\203\207\266\020^\003g$\204\b)LA\004\355\361[\266\26122\324\026\251$\313\n"
+	.string	"\350\"\021\225\001\rF_\004\031v\344X\335\"\331R\246\0242"
+	.string	"7"
+	.string	"4"
+	.string	"\024\346\234rK\356=\256z\376g\267| \352\261\342\372FL\215\004B\003\270\212\017\"\016\\\237]=@\225*e3\347\264~`\353\346n{\302\266\264\377\373\212\227\375{\365)\030\333\201\326c\017\346\374\270Y\2304N\201"
+	.string	"\333\277\330V\265#$\274\313N\231K0 k0g\ba\207\3129{v\204\207&3\303 \204U \233\325\242\274\033\327\312\272\240\t&\324Fva\273\337\n\002\266\225V\260?\340\341\311\007\340\222I\377\235\363M\f\347\276\035'\bb )\275\331\241J\027f?\316\236\216\323Q\224<\240\212;\032\213\217Hv\031\030\037\215\013\t\372p6dgD\222\232\214C\"\317Hv\241\320H^\302\324\343\334\227%\300\002ZjU\221\242qm\022\207\376\363g\017\016"
+	.ascii	"3\241\017(\360\202\327`\274\027\251\315\005\3618P\214\200\256"
+	.ascii	"\341\004\023\030P\335WR\343\304\235\213\252\035\032\230\202\002"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.179.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\035\013"
+	.string	"&TLC\020\251L:"
+	.string	"l\337n\201G\240\273n\276\314/\005\356\206g\333\"\206\303\267\375w{\212b\220+,\326\035\033\336\331I|A\331@\022\004\211\b\016\200\"\004\240\022px$\b"
+	.string	"\276k \212\020\331{\247\0248"
+	.string	"7"
+	.string	":"
+	.string	"\233\033\001\021\005\273\335\2553\300\303\323)C\377\263cX\"\352\324\365I5:"
+	.string	"\022\032\304\025\205@\301\271>\273\034\021URZ*v\327\222%\266\356\357\266-lW\373\022\001r\302\354\323\235/\373\262\237^\372\026\r\005\222\326\017\\\330-\351e\330\334\347\300\200\355glKiOP\204\227\2356\257\300@\366`w\214\360\303\345\237C{\302G\001\033\253\335\224\203\237\3404\333B\\s\255\362\017\214\341v;\331\300\202.eN\030\235\237\031\264\b+\211\301>\202\217'\177\200K&y\326?\337T\371\367\211\021\273\361LR\262g\217\250\037\260\003^\224>\241\213=\034\r\320\250\202\035\034 \217\215\032\002u>\252\207\004R9\033\213F\037R\005E\"R\315\214{\272\363eL\001^.5U\246s\301(\006\201wB'\314\366\265e\022"
+	.ascii	"3\241mh`\020\016\001\373\203{\007;\247\204\320\340\004\202\b"
+	.ascii	"\016\210\334\203 \016\020s\241k\370D&\274\222\032'\356\334T\355"
+	.ascii	"L\321\024\024"
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.180.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375 \345M\006"
+	.string	"\302\013,2`M\323\001@_\002\007\322\204\270l\255\005\350\320\256P\f\027\246\360\037CBl\347`#\206\377\361'Z"
+	.string	"\330,\220]o_X*\033^\374f\245L)\216\240\006\211zV\004\204$\361\360($\206\211\027U\025\017*\360D9T\317\232\246\352=q\257\230T\003M/\354\207|\003\375\214-\256\374v\307\277"
+	.string	"\356\244\nlh\331\3311K\345\260_Y\305\330N\247\022\234d.\327t\273\\\227\262&\016\311\207\355\333\306\354\307\b\t\230\341\243\0077P\262\311\020A\331\215O;\016\237\320\277\346\013\030 #\233%{\006(\354\256s\263\\n\375\201m\215\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.181.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\025\b"
+	.string	"\222\01787@\217\322\001\230Eb\273\236"
+	.string	"\360\007q\217\026\331\214\315H\203\340\005`\200~\325ot\210"
+	.string	"-\251\271\023\311c\321\353\032\b\214\256\006M\375\371~\361\277\266O\366\3362\245\243\214\002\024\035\372(d\242Irh\310\036\030fD\006\202\230\241m4?\001\326D\013\333$i\33269\337>.TA\3509A\213\212\213\270\245\331\335\003\037\344!\022\376\352\322\023%}w\351\227\340\306u\322\227\375\231\024j\330\217\013U\266\252\341Y\277\306\216\013K\352^\313.\306+fU\244\253\3036gs\364,\243x\263\233Ar\262\273\006&\320\\\332\366=\356qv+~\034+\201\224\222\213\021\230\335\235\236w\260\313x"
+	.string	"\354\022n\234\273r\376?\236\260\342\275t(\3235\203\260\273\326\016\225\272\341m\017\330.\260m\022\013"
+	.ascii	"2\241\245/p+\n\"\026\017b\002r\r\327\304\342\341!\210\250p\003"
+	.ascii	"PyL\355$\003"
+	.text
+	.section	.gnu.lto__reset_template_133.1.183.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\255\001=\016"
+	.string	"\366\327VB\300\234(\303\001Hf\004\250J\211\202h\214B@\351i\242\265d\32069\334v\275[2\2464DH\354\315pG\266\353\377-\031S2\246dL\311\230\222<X"
+	.string	"\002\327\033\256\377\230o;Q\255\350'\022I"
+	.string	"K"
+	.string	"?"
+	.ascii	"=\246c\247?\324r\024\3421\355\272\202@\303\231+0U\034\232\236"
+	.ascii	"\247'\352\331\212\226X\304H=X\244y\007\336R\001~Bo\255\022\250"
+	.ascii	"g\356\314\350\306\306\034'\032 \340-T0\307C`\320\347m\022\200"
+	.ascii	"E\332\232\006\372\021\030\236\031\246\242a\326\206u"
+	.string	"8\274\323a\227\207a\037\316\001\361\027\342)b1#\016I\034\226x\214\211\303\023(H\240\346\315U\331\312X\316\262\226\267\354e\237\3010\370gA\212\004a>\003o:_\034\274qy\235\336A\335\245\301\026\355\261\254\217e\201,\033dY!\317\016y\226\310\262E\216\325\310a\217\374\244H\2265\311\260*\331\353\222\3032\031JU\317\256\236\265\273\2030N\204\243HX\312\204\247PXV8\307\302\262\013\317\332\252Hf\031\313\274\212f\236\021\315]Ls\223\250\346\031\327\354E6\263b\233g[\334\325\305\263/n\025\306\2632vu\306NJ\343Wk<{\343\2578\006\233cXu\fv\307\262<\226\0015 \300\"\262\354f\202\274&Z\005\270\216\313\200\342X\261]\303:\327\02607\3375\266r\241\344\232\326V\320\250\3432\225_\326^\302\315\321\243\276\234\254\001\027\207\021\"\3610\333\023\261\016*\216t"
+	.ascii	"p\357v\206\273\311\274\016\031\306\321\356\223 dsh\304w4~\320"
+	.ascii	"\322c\335\313\300\343\302\313p\354]\254\315HA\017\252\b"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.225.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\234\004%\035"
+	.string	"\326\364\263F\240\232M:\304\317(\266\331\347u\316\312\326\375|\227xJ0)D,\233ta\037\220\272\346\013\204:\217L\323\340\250r)M9{\275\004\n\002\230\004C\016\360\311\327Lh\314\321c\320\004\217\2735id\023\271S\n\232"
+	.string	"\234"
+	.string	"\233"
+	.string	"\237\265O\371\237\356T4\344o{=\253\264?u&\273S\321\360\334}\362\252\262\373s\360\351\005\342\247\316w\302O\371\001\341\247}%\266u=\357\3542\377\375\330K\351\301d\345fwm\237\352\303z\360w\313\344\356\242,\234\240\312\331\316\227Y\300z\002\257\253\321\307\273\b\352\200\351\345"
+	.string	"!\310&_\222\224\311\261\b\216\207&\300&W\227\326\350\273q\260\006\315\247\024\356"
+	.ascii	"\331\nb9\372\226T\257u\320\b\227\231\321\207\343R\300g2\013\273"
+	.ascii	"\353#\351\270i\267}\304v\007\033l\nB\241o\345W\204|!\306\261"
+	.ascii	"\220\037?}\026\341g\t)\"NK\326 \3111\251Q\326\231B\215\215\215"
+	.ascii	"\301\261B\331\265\2314-\224\236\211\322\242LZ\366\254;\f\245"
+	.ascii	"\247J\203\377\375\032J\313)\375\001;>;vm\214\305\331\247ye\310"
+	.ascii	"\263~'\377\325\325\276\037\345P"
+	.string	"|-\327\262t\356I\371\224\335\251x\213G\351\267\276\020\\aK\334\354\356\006\361\223\007lr\277\211\316\267:\226kWO\236HU\020\357\304>\022t\257:\222\006\226\327\206\301\247\217\204\335\253\216\256\263I`c\0041l\346\0019U\246\266\207\017\362\243}1\030\005\302F\333\271\217\001A!lw'\210y\230\b_\310\247G\220 \021~\312\364\343\r\001R*\250\366\t\024\362\343T\236\032\312\263*\250g\232\343\203=\214\265~\234\345,\235[^H\336\365\002]\276xR\216\365\337]$\360\313\377\"\275<Y\216\333\224\204\310>m\217\227\317\305e\304]\336\235~\004a\327J\002;\006\031rfw{\266\370N\366\265\210\277\355\341Q\222s\354o\035\313\021\320\355\026~^yH\035q\232\312\241\273\313S\215zE8\031?\340\215hF\bZ\021N\306\005\241\030)n*fAACF10\344nF-pA"
+	.string	"\f\364@\005\216\310f\264B\b\327\"\310\366\002\367\343\302\006\224+\262=0\340!\242[\316f44\224\263\311\177\025\n\353b\026\337\027\222&\211\032\345"
+	.string	"baM'\020\311\340\2416\331\266\203\207*\231T\211)I8\326\203\273\273\262\006\017\265\246\367\3422\263\344\224\244\345\227r\230B\005R\324\231\322\324\336)\331M-\251q\221fGu\253\037g\216\346\002\206\f\031\302O\232\352L\277t\206\314\313h\330\300A~\344\020~\212:\267\270\274\361r\002X\002c\250a,\247\020cDH\206\204$I\222t`\002\2312\263\035\021\240\301c&\005j\317\254\246R\313\224\264s+\301IZY\361?h3A\300\021U\007\031\370\336Lr\223\211a\003/\220X\201\260\260\316v\272\204a\250\205mZv\254\214a@P|a\037\021\231)W\217\"\330"
+	.string	"\371\255\351i\362\364\0220\266\257\211\371@\321\313\325\224\326\342\261\b\347\020\303\020\213\357\177\027\266\026H\024\374\027\357\271!\353]\261Y(Bu\352\334\325#\204\260\001ZrwKC\002\317k}h\227\007;\257\006L\021\332\273\002\207\371\002\317\233\227\001\005\303\235\263e?2\315\231u\310\354\255"
+	.ascii	"\271\306\220B\350\314W\366`\325\f\347x\226:\264\020X\365.\037"
+	.ascii	"2!v\2074"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.226.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\310\0035\031"
+	.string	"\206\257\235F\300\030Q:p\315\026wB\275f\203\350\020!v\244R\344\205\243\353R\024Y\025F0@\214u\016\234\240\217V\1772\002&T\274?\325.\213e\b\242\251\220Gt\034\344\334V\020\020A*\003\275\366\023B6\221;\245\206"
+	.string	"\202"
+	.string	"\207"
+	.ascii	"2\267\265\232U\332\037r\"\260\027\201\341\271\213Cj\262\233\203"
+	.ascii	"\360\351\006\342'\201\323\200\237\362\006\300O\373Bl\277j\206"
+	.ascii	"\331_\236\313\261\037RBC\"fwS\237\212\303\372/w\203\022\366\020"
+	.ascii	"\234\237J\021\346_\367\005H@\243-\366\360#\260\273\002l\264O"
+	.ascii	"\202\354\261\311$h9\376\240\361I\302\312w\241\177GS\210F\333"
+	.ascii	"\214\353l\007\244\321\301\333a\262\305PYs1\264\260\273\276\254"
+	.ascii	"\306]\272\355\033\266)\330Z%C_\262\362yXE\216\374\370\351\347"
+	.ascii	"\350\205\316\200\227%H\r\231\354Y\257\273\033\223\372c\025\325"
+	.ascii	"\247\327\353\221\261\372\330'Q\3324\245K\241\264\bJ\207\017\272"
+	.ascii	"\301)=U\372{\356\327)-?\351\027\240\251`cWF\257\314\342\246\223"
+	.ascii	"\036\017\372\355\373"
+	.string	"A7\342\013\371\004\3642j\226[[M\347\003\375\310\221\300\236\304<1V\023\225\f1\t\263\273\016>=A\374D}\367u/\373t\372\224\317\275^\004Fcx?`\004\344\253\221SC\265A\204\220\037\355'\351\324h\031m\267NE\304\217h\331]\nS\2164\302\347\361i\022%J\200\237\241~\2441@J\375\324\276\301\221\037\247\242bh\314\252\237\236v\306\217\362#\023\241\360\316;\235\274./:\202[RL\232\261\376\273+S\375\261\241\370F\222\207\263\034\267\347\310\307\342\326\306\211\377\304_\304\335\330o\277\002\260h\345\201\035w\020\331\020\3717\373;1\2676\250\231<c?:\253\027&>\225\212\345r\201\241\205\343Z\261R\001\360M\204\023\253\026)W\n\024\253\025\252\024\213\225\211\234\324MK'\025!\201Y-pZ)\027\213\325J\235l\313\177\325Gw\321\250(I\246;\241\376x\352\020\035<"
+	.string	"\227yRP{l\033\302A\225D\214p\231I2\326\177\273\273\340\203\203z\322K\221\002\206\347\266\263\373\245\031\332DIQKjR\373\002\006\236-,-\031\236$\007\226g\321\260\201\003\007\360\323\244Z\322\363\204\261\362+\035<|\220\037?\200\237\242N\236\227O\250a4\246\224B\210\220\314\210\210\204\331\026:p\002\231\2622\017\020X\212hA1\007\"\204\255\222\211d\220\225\377\263\327\202P4\322.jh'7R,.\030\025\343oVf++ZE\257\024Xp\tCy\030s\031\355\b\004\311\013y\204{\237B\037\213\f)\305\007mU\220F\317\366#\232\016)\337\322\b\352g\013\360\3758r\033\334\202]%o\353\272\266\027\366\254\212\035\207\2166W\320c\311\231\224E\315x\300"
+	.ascii	"\304\272p\316pu<k\3662\2239\263\264\214n\351\n^\224\025(\331"
+	.ascii	"\227$\326\357#\344\304\005\bm\324\214\3424"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.part.0.227.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"M\013"
+	.string	"\346\225LA m\225\0160`\017\301"
+	.string	"\364\032\344\261\213\345\201\026\352\021p*!\221\020\030\036p"
+	.string	"\361"
+	.string	"\333\2601\202\222r\200\243\005.\240\357\316% \300kWdq\333\340v\262`z\374\277\261lh\023)S\n7"
+	.string	":"
+	.string	":"
+	.string	"\330+$\207\366!\330\006\221\334\331!\3765\330kp\035P\271v7\036*\203w\327\304:\377\251S\274R\350:QJ\360\24486\361\330]g\nnx\333\034\266\243\375\217\351\374\367\177r\321\021a\027\301\253\304.\200\034\034\330\276\375\024\310\256T\016mg\376\003a\337\242H\316\264/\341\023\272S0\313\224\335\016 6\354\356\306\2415\262\303\214[H\016\003\"D\371r\352U\025~0\360`\224/gy}\205_\370d\273\242{\276\352\026\004\370\250C{>y\357\320\377\f \220\367R-\036F\264\nh(\365d\305\216\355\356ZM\326\f\230\r\307i[\206\313|\261\210h:\221\313"
+	.string	"\320lFb"
+	.string	"M\b'^6O\264`X\353`\266\310i\332\026+\307VM\006!\321\022\351\310\252z\262\255\352cx\006\263|\2249^y\245\362\002\025"
+	.string	"e\213\361\265\002\343\341\210\330hB$\326\261\031\2642M\201\247"
+	.string	"\231\213\311V5\222\206\326@\230\316x\3043l\233);\r"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.229.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375` \002\355\020"
+	.string	"v^lG\360\260(\035\333\335\213t\3658\303LcV\266C-\377\321\244\347\376\206\264\316UI\325\332\234\276Y\2133\202bC9\034m\375W0\222\r\210\277\343\260`1\263\033\341\333;\204\230\301\203q'k\310_V\220M\344N)Q"
+	.string	"["
+	.string	"X"
+	.ascii	"#\222\353\264\224\213\373\"\263J{Dz\235\226b\335\335@\303\355"
+	.ascii	"\212\t>}\340\363i\337\204m\227\314/[\307\305pE\"f\264\324r\273"
+	.ascii	"\373}\252\207\277\256\262{\371\037\357\021\203Q\271\006\200\271"
+	.ascii	"p\031z\007`\301\356\372\203\341\236\267M\262}\262%J\267\371\357"
+	.ascii	"!g 4\273/=;\226\303\304\t!Eb\030#S\3412\253\333\231\030\306|"
+	.ascii	"t\271\321\344v\202\210\300\266\177\363\024-\263\264\002\005X"
+	.ascii	"\207Q\255\006K\211\334\256\370}Z|\001\357\363\363\001\236\177"
+	.ascii	"#\020\276v["
+	.string	"\353'|\235YNK\372\243\313\006\201lDq\007D\345k\034^\035\306\013O\177\353t\352\307w\270Y\316\230\003\005\217\3558\254nE\030Cy\213\222\016G\270\273\nX\034\207\362?|:\202J>\246\362>Uo{\003\022 r#d\334d\270J5\260\342\322\323\302\003\223=Rg\254\335\273U\031{J{*=_\363wSZUZ\006\036)\245T!\t'\223\t\203\023\t(\202J\205\230\300\220\225\312\024r\351\303\004\236|\253\221\007 \211\310g\002:(\371J)\325\367!2\352\344\224\372V(T\352\003\331\226\357Ve\374\271\341\302\006LWTgl\0130\rO\325S\033\204 \037\363\307\337\202M\203\316\216\016\213\252\370\267\307\2709/ \200\002\231E\354\0025\f\2466\"b\215\330\330%\355\224\b\317\255,_\354e\302\303\325\345o\307\305\030\2046\333\255N30j?Dk\230?\\7\013\264\352"
+	.ascii	"0V0\204:\034\344\033\266\f#m)\363\230\361\213\305\326\356P8a"
+	.ascii	"\307)f\032\273\225\323q0\220P\211\325\024\336\314[j\001l/JN\361"
+	.ascii	"\364k\361\030"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.235.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\206\004\025\035"
+	.string	"\306\364\265G\240\330M:$g\003\036O\341\301\351\020;\336o\370\203\371\303\007<}\212\343~cQ\033_t.H\330d\361\336\272bO\344\273\2364;\317\243\236g\361\003\344\033x\035\260\243\001f:\005h\244of\326\022B\244L)\241"
+	.string	"\223"
+	.string	"\244"
+	.string	"\257Z2\243v\211\267\250\240q\240z\252#\221j\376\226\254\372)w\2716\247\017/\2569\347\203\217^@\373h_\352h\311\266\037|\022\236\275%R=E\031\b\202Q\262B3\347\314}\334y\016\371Q\274"
+	.string	"\362\343\n9\3575\332\214\034\305U\033\317\317\220\0046\246\374!\275\246\345\017\307i\317z\202#KL:\323qRd"
+	.string	"\364\262\201\373\305\020s\262\374\b\273\375\224t\334\2572\361Y\337\360\343\313K\371\273\361\365%\2219P]Cl?\030\253\001n\233\365\3149\375\336\216\373v\333Q\266{lqF\300\377"
+	.ascii	"\3115\023\364L3A2\236'\266\305~\240}-\333G\026\243=\315\245I"
+	.ascii	"5yv|\272\306~\223;\321\371QN!\244/?\372B\344\307o\204\036i\306"
+	.ascii	"\230z:\324u\362\332v"
+	.string	"8\034\216y\201\330845n\246\276Y\265\315MT\333T]\023\325\264\031\251&\217u\217\257\372\305Q\275\247\372UT\177\200\002\025x\315Ic\230f6\215Q\212\034\353\366\261\216\374,\337\256\216\274\343\343\371W\276Yy\353\263\306TaX0\214\314\234\263\301GS\360jJv\334\033,\251'*\356me\324V\267\250\352\213O\311L\333\332^iMO\207[8\b\321\026\004\220\311\030\223\326/\3169\347X@\305%\327\356\340A_\316\262\030\t?\374\n\f\313\277B\210\0301\202\374H\236\221\362\203\235)\023\003\250\270\2736\211\022\372r\334\035\030\213d\377\n\013\002`\245\355\027\267\342S\341i\316)\201\312\253\374\370Q\037\r\024\024D~\334\275i\371\372*q\364t\350s\275\205\031!\222\252\361\376P]PSv\235\354.\177\212Jij\232A5Ff\323\344\201\342G\261\030mN\244\007;\240\242\365\331\251"
+	.string	"\272\260[\241\033\"\332\001}0\241#\002`\244s\341#\372\007\202\t\035Qn\207\"H\247\342Dn\205\316G(\367Sd\224\203\240\343!\"\240\242\334nh\250(w\263\255\027\247H\336\026ge\330\306\331\013\311x\b{\233T\303m\230\213\361\202\024\300\374\260\213\341I\361\246,\350K\013\344G\275\273\31227\213[\035-\2455\b\324fm\f\031\310\2277\273\343\333z\226q\2769{\nnk\263:\\b\034I\232\220\243l\006m\235\314s\035i\333\007\351\242\301\266.\200VH\210\224@\341l\235lr\235<\233\352\"\316\226"
+	.ascii	"\326Tb\250q8\246\fb\206hDDd\002\303\244\003\260\002\0212[\035"
+	.ascii	"\020Xi\250\024\322\001\335\0040)C\363\325\341\023\001\210\202"
+	.ascii	"\226 \265\215C\267CJ\342w\274\345\214\266\f\246@\204(\373c\277"
+	.ascii	"\342\256\357J\023\321\360\214@^\024_\216z\334\036\250\355\025"
+	.ascii	"\301{E\350`\007|\352\375v{\035\366\303v\224\n\023#\223\354\326"
+	.ascii	"\033\377L\bL\020k{\017\226\301\f\351\017\203\366\264g\0242|V"
+	.ascii	"\350\250\213\005\\S:\340?\304bW\371M\242M\263\257\264\252\n\312"
+	.ascii	"\320\202\321\257\276\020\321\300\027\007\275\376\356\2001\361"
+	.ascii	"j\207\021\030;\026\247\264\262B\342\214S\244E\266/0\226\005>"
+	.ascii	"\020\350\203\020\201\220\324u}\222\bB,w*"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.241.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`K\001\345\r"
+	.string	"\026\031[E"
+	.string	"\261&\0358{\b\022Fm8\352\206S;\314\270\375<\330Mz\324\255K\020\241\277U\r\325\233S\2646\030\233\242 \244\216P\252]a,,\271\252*\304\242\tK\353\371Ao\375\376\273\032\261\021\262\211\224)\005G"
+	.string	"E"
+	.string	"F"
+	.string	"2\376e\330O\n\013\021D\344\354n<T\f/\035b\232Y\311\327@+\027\312a\252\240(\034\323@\255g\352\305\251\205\rj\302\025"
+	.string	"*\005\033\260\273\377\236\022P\247\314"
+	.ascii	"\3174\320\356\272S\341\326n{\263\035\355\257\002\253\0027\273"
+	.ascii	"+\257\032\353\002Ql\260}\177\346\255\321C8\301\352\304\207\335"
+	.ascii	"\035\335\377H\266\307c\315\313\370\003\204t\226\367oWX\254i\177"
+	.ascii	"\200\224\316\362>\307\251\211Q\261\373u\034\232\243sh\037\204"
+	.ascii	"m\022\213Kv\251\224\213\034\003?\360\032\273\004\300\330]\004"
+	.ascii	">\315G@\360a\016mr\222W9\364O\262\303\267N\240\003\r\207\226"
+	.ascii	"\030\034S\276\254\317\335EQU\331\366\262\253\316\334\314h\305"
+	.ascii	"HI\032\251*k\206\255\276\330\227\371\257e[\027\322)\030m$\035"
+	.ascii	"\213x,\b\225\304\316A\203\320\003\006\221$\0242\022ED&\321\343"
+	.ascii	"c\256d\023\305\216\343D\321c;\217\255\276xC\203\213\205IOPU\352"
+	.ascii	"\227\270\t\317\207\361\b\307}\347\360\260\302\245\205u\301\224"
+	.ascii	"/\254\343$l\036! p\202\231\303\362\323\031\230\002\277\247\241"
+	.ascii	"E\370%\263miE$\266\003 \033\271\033\223z[\360W\026\320\362\360"
+	.ascii	"#:\303\214k\241\316\210\330\346\336\304D\330\372\261v\003\304"
+	.ascii	"-\261\244\254\031 \265\267w\034X\343\027yk\251\267\365\2047\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\037\016U0"
+	.string	"\212O(\021<0\246J:\341`\231\375n\026SR\237#G\027\315\342(\353\221A\332\030E\376\241\350_\224\344\026A\375\270\003\t?\374pgS8\370\363.\016\2076)\271"
+	.string	"!\357\210\023\264w\222\001\002\001\377"
+	.ascii	"\002\001X\232\017]\271\262\322\fX\205\355P*\315\177S\270\017"
+	.ascii	"\225\322\354gS\272(\315|\366\246P~\366\244/\311n1\023\223\223"
+	.ascii	"~#\313\\Mx\017\223\376!\273\204\353\"pSI\377\320&\3513-\022."
+	.ascii	"D\217`@\215\260\241\"|H\204\r\033\244F\243\312\317\3473\323\220"
+	.ascii	"\276\241\325z\226\254\253B\316\025\344_@\372f,\026c\372\301\225"
+	.ascii	"|\360\245\036\354\344\301\226\320\035\234\250\203C\016\316\204"
+	.ascii	"\243\237fo\334h\343J\264\306\275h\\\313\214w\311\320\020\343"
+	.ascii	"\2040\372\253}\301\213.xS\013\326\304\342)\352\264\242\217fU"
+	.ascii	"</\305\227(nv\342^L\034L\211'I\374\313\210\013\212\370\236\373"
+	.ascii	"|>\237!\372l\026\302\343Xc\035\035\210f?\226\271>dp\360#\312"
+	.ascii	"\314\r<\374\256\303\006\016\027C/\363\325t\303\303P\2654Q\227"
+	.ascii	"\206\376\332Sj4\246s\314\315\314\207\374\3234M\257\372g,3\023"
+	.ascii	"P\020z\375<y}=x}?\313>\336\323\273>\234\333]<\027\352\030\357"
+	.ascii	"\016\353\241\314?\266~\004\331\022\342\304\016\353\251\303|P"
+	.ascii	"\346)M\266\234\020\321\022\322\244\207\326\022\n|\265\353txo"
+	.ascii	"\016\007\242t}\271\271\376\0339\375\2708}88}7V\216\005\337\334"
+	.ascii	"-\356l\340\376\346\346k\3206W\363\3666\267\003\262\341;\364k"
+	.ascii	"\372m\256\246\237\246\255\217&M\277\214e\353\223\261hx\271\326"
+	.ascii	"\037c\317\274\313z23G*?\246\306\204P\346z\332\301\320\276\245"
+	.ascii	"\f\343!\303\3171\274H\f+\206aJ`x\322\027\226t\306\221\314\030"
+	.ascii	"\321\013CJ\362\2432v\324\205\033\241d\254\b\311"
+	.string	"\214\320\261\276\030+\326\001u:\366\303<\254_\306\2459\321\242\2035#\262[X\320\027\027\362\342A\250\204sA\265p\240\256~\235\253L\230\245O\367\033?\207\236\213\001\245u)3\203\247}9o\036\264i\232r\005\313\333\004\315\274\213@\315\273\007\226\347\302d\363l\250k\214\315\303p\336\035\240\236\301`\327\330\305p\336}\320\341~\345\275\253\266\3006\301\203\271\272:S\024\373\361\352~\r\303\300{\025\356\227I\253\373\244\236Y]\250\365\213\325}3Yu\237V/U\027ji\274Y\325M\240\236\357\3144\272{\031\025\327!\251n\224z\016y\356Lz\031\325\215\30240u\007\254\002\324\250\265\t\265\374\3312E\372s\265\313\324-\240\336\251/mM\200z[\310(\3671\251\373\264\374\005\263K\\GJ\335\257\267\200u\344\260\235L\352\212x f\340\026Q\263\232@\324\0178\264x\370c\324\275\372\3730"
+	.ascii	"W\200\335\271.MS\376\205b\336*\f\f\220\177\001\365\373\020\366"
+	.ascii	"\367\006\373|\202}>\201\375>\300\276\337_\377\317\257?\247\257"
+	.ascii	"O\347O_\317O\337\216\257\217g\257_\327\247\177\207O\337\316\236"
+	.ascii	"\376\240\236~`\236\376\237|\343m\237\3230m\303\323k\337\344\354"
+	.ascii	"Z ;\235.\234\345\230\270\225\f\334Z\306m=/\016J\3329Y\233\372"
+	.ascii	"u\2645\365*\233\317\345Yp\245K.\256\212\252\245\346m\032Ax\211"
+	.ascii	"\027\243\244\374\231z\203a\234\210\270\236\tm\372\362\273\330"
+	.ascii	"\241\024\223I\265\326\364\262\312\245\327\323\020\233\017`\310"
+	.ascii	"0\356p\375\321V\264\347\325\342\340\232o\313\027\bT\270\350G"
+	.ascii	"\267\365S[\024\343\\\311\316{\345\362W3\026\372\361\036;/\026"
+	.ascii	"\243zv^#\306[\230C2\243\330y\265\326W)\2029:\032;o\226\335\031"
+	.ascii	"Ky\tr_z\013\224\347K\222\264\270M\261\363\026X\376\216\261\363"
+	.ascii	"\022P\221\354\234`\247'\030\265|T\244\276J?\262\363\317\347s"
+	.ascii	"\361\212\023\357\233\307\0379\361>\031\317\233\220\317&\006\236"
+	.ascii	"t\241\214\204\214x\237\230y\214x\261*\260\240\025\003\336\333"
+	.ascii	"U\361\337\315Zo\263\324[\254"
+	.string	"\346/\326\372\233l.\b\201\b\250A\024\306\343\322\214\310(HR(t\361\005D)\310\252\266\001\021\260\230\343\324\210\210\210H\220 M:_\"\322\b\3422\273\371n\034`\362\267\003\330\207\350\363\212\305\226mz\202\236\025\267\243\212\033\270\013;\230\365\202\266|<\203\357\006\267\034X<\020\247\242(\252k\246\333\222\222;S\377\024\373*\267\364\247\353%\f\024B\320\037.k\256o\023\324\250%$\315\356\251\024\235\200\254\n\021\267\276P\263!\200X\227A\304:\374\231\220q\005\327e\337\237Q\177\233\331\317\204\t\200\376\fG\276\035\207\252\257l-LX\304\023\243'=S\017\346\370:\214\227\006ky\255\323|\221\270\006\3613\370\353}\371j2\235\232L\247&\323\251\311tj2\235\232L\217\nP&\202\333\211XH\036\371\030\243w\002\311\026\367\243\217\227\007\365\352n\277s\027$x\360\027y^\021k\334z\303"
+	.string	"\260k\3608\254\021Z=\021\312g?3!\017\036?\273K\253{\315\263a\236\347y\236\347\3159\235/\311\230"
+	.ascii	"\024\340\323\346X\313^C\367-\005Tm\003O3\032o\304\033\362Y3."
+	.ascii	"/\021\375Oxg\r\270\343\324\214\355a\250\001\\\034\346\266=.\276"
+	.ascii	"&M\237\370\357u\231]\232c\226Q\360@\032\303`\274 \007\311`\201"
+	.ascii	"\313\026H\350T%\335\342\375\307\255\302f\304a8\363z\b\3157\271"
+	.ascii	"\3634m\363Z\013\224\365\356\013\315oc\221\222n\002+\b\214\201"
+	.ascii	"\306\026\210\315.P\326\266`z\200l\373\223\363+\330;\357Ut\233"
+	.ascii	"\\<\3739\313N\236\235\277\\il\024\221\270\316\246\225\325<\021"
+	.ascii	"\243\374\272\325"
+	.text
+	.section	.gnu.lto_.refs.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`\254\005\325!"
+	.string	"\232T\\\016E\220\234M\206\003\223$\254eS\357=\210\302\026\204\361t.\215D\247\021\200\023\020\271\337{d \022\371%fD\""
+	.string	""
+	.string	"TcDRo8\315\304J\021\322(\345\342\246G\"\307\024\247\235[\333\305\321\324\032![\246\314"
+	.string	"\322"
+	.string	"\313"
+	.string	"_\004=`{)e\331\261r\1775\365T\271\227\252}\201\332CI\031\370\337\357\231\310\216\364\364D\271\377\211z\033\200\027\177\337\362\002\274\207\203\373\311\b\374i\240\376*\003\376.\340\3175\276P\300g=\275T\356\235\234>@\323\001pG\225\235@\371Pe\0072}\323\322\377"
+	.string	"\274\322\357\223\312G\372\365\243\262\373\230\236\267\364;\245\317\225O&\375\304\215$\264"
+	.ascii	"\337;\371^\351\350\207\214~\347{]\321\223\271\037s\023\335\276"
+	.ascii	"K\026\260*\275>\027\357\205C\277Ev\253\335G\t=\260\366M\273_"
+	.ascii	"\322}\251\353G\272\367\005=\221\256\017\351\376\226\373\342\006"
+	.ascii	"\352=\376\314[?\"\373\020\371;\333\\'>Y\373\332\370\242\370\235"
+	.ascii	"\367\3666 \001\003\372a\002\372_\240\372C`\037\313S\337\353\261"
+	.ascii	"\246\351[\243\351W\213\365\340g\372\324f:\201\313t\340d\372\323"
+	.ascii	"a]\311\210\247{L\277-\246\213\213)\206\254;\230/\364i\353%ka"
+	.ascii	"V\3503A\257V)\314\277\346\004\tV\363\275\306_\312]\346\r\036"
+	.ascii	"\276p|\255\271|\326[\346V\343S\035\b\376\324T\324Z\346\003\306"
+	.ascii	"\007\236e\016L\032\313\034)\370E_\231"
+	.string	"\027\355\325\177\266\322E\247\237s\260\336\277\274\032!\3519\225B\350\363\256\1770\357\\u\320\3733\033\364Q\330E]\237\272n\211\367z=\210\3678\255'\253\346#\325\314\262=b\315'\326d0\027\257z\255\346\202y\256j\016\024|\222j>\216\337\004+\250\255\253\232\343\202\177\243\2323A\337\025\3750\332g\344\257'L\355\037\226\377\026\341?ek2_\205\303\323\013\214\347\241&\373\247\246\361\231^\363e\257\033\315\365E\274'\352\365\035\357\203\346\352\344l\276v\365\342w\346\260\331@\b\376\247\327G\336W\353\r\343\325U\303\034\310\251\337\306^\013\232}kg\250]\262\345\364\216\035\247Wl8\275e~\323;F\354\005\263\353\3652\324;\024\352\315\022\324k\345a\357\327e\275U\346\322;\345\311]\275N\006\323\333d\366.\331M\357\221\333\364\026\211\352\035\302\324\033D\251\327\307R\357\016\251\336\034S\2755"
+	.ascii	"\364\3120\320\353b6\275,^\323\213\202\304\210\311zC\244\035\365"
+	.ascii	"\317\214\372u\212\372t|\3759\253\351\2275\265/\026\267\304\354"
+	.ascii	"\211\271\331\254\t\3616Kbb\315\216\020\357i7\004\210>~\207\353"
+	.ascii	"\316\375 ^\341\365\320[\336\241\213Q\2400Y\316\213I\220\0309"
+	.ascii	"\316\213D\202\360\310A\276\210\343\206\215\0324bL\345E\030/\\"
+	.ascii	"\260 \273x\342\261\027E\234\346g\237\321\374<[\354\247\235\317"
+	.ascii	"\3744\333\314\3178\247\365\371\246\254\315\330i?\315\204-\346"
+	.ascii	"g\030/\303\325\374\3242\257|\341~F\201B\366\351d6\231O\237LF"
+	.ascii	"\373\251\004I\221\371\374$2Z\237C\336\323\247\220\367\374\374"
+	.ascii	"\361Y\237:.\363\363\306g?kL\032\203\375\234\341\342\260\237-"
+	.ascii	"\316\323'\213\365\364\271\242\366S\305z~\2468\317\317\023\323"
+	.ascii	"\304^?K\240\335\346\273\206\214\034\363EC\306\313\3607_.60\257"
+	.ascii	"\341|\273\226 \261}\203\364\350\365Z\\\026T\2501L%4\210\"12B"
+	.ascii	"\301\0042%n\220\242S#T\017\020\330\216\001\245\306\313p\220\002"
+	.ascii	"\\z\215\214\341\204\017\357\236\b\265s\n\b\017\002\333\350\347"
+	.ascii	"\225|.\220q\b\207\321PX\360\330U\216>B\262\224\316\216%\245\276"
+	.ascii	"\016G(\rv\243\355Df\204\264\022{9\204\255fB8\262OR,\305 \350"
+	.ascii	"\270\2220\016\225\322\275\277\317\340s\370\231\222\342\326\034"
+	.ascii	"D\024\306\375\367\003\207\310\340\207G{O1\177\245\035\251\002"
+	.ascii	"\003R2\357\266\276\210\210\260\231\276\330\217\331\207\315\237"
+	.ascii	"\273d\350\302\340?"
+	.text
+	.section	.gnu.lto_.decls.8052e9c2e6d81296,"e",@progbits
+	.string	"(\265/\375`_x\325\345\001\312\026\027\253U JY:\215\001\354\365\374\206\224c(>\320r\254[\210=\006\251\036\306\235\3248\313\035.#+\204\371\300\220I<\317\307\327\266\235"
+	.string	"P\t\325\251\273,EK\321m\350\253\250+H\321W\264iK\220\244\034r\244A"
+	.ascii	"\216o\373\363\335\356\216&r\357-\245\224)\t\t\274\n\001\013K"
+	.ascii	"\237\373\003N\224&7??\351\333\013P\374\367g/@\217\307\350\343"
+	.ascii	"9}\374D\017\005\321\307Z\332\203\025B\217Y\350\313us\3307\nn"
+	.ascii	"\3277\360\340\270I\315\207'\016\2228~7\377\306\321\267\024\240"
+	.ascii	"\366\317R\200\376\346i\020\254\020j\367\r\017<m\302<\231\331"
+	.ascii	"\310B\221\225\205v\363\315\262klO\f'f7n\2764\210~k\204\360#,"
+	.ascii	"\311\315\370\316\330\220\036\211\313\261C\006\005>K\032Ta1`\354"
+	.ascii	"\354\200C\306w3\214\313\335\256\255\341\264\272\262\004\n\353"
+	.ascii	"\312\202y\302\273\331j\271\266\367\336\200\347\260\214M\335\374"
+	.ascii	"\213ES\335)\373v\253\356\212\346}\201\227p\232\tV\325\274U\026"
+	.ascii	"\316\205\002\243R\356\2757|\370\220\263\347\343\006\232]\f\361"
+	.ascii	"\360\3502\222\343\346_&\372\026\r\033\273\006\352IJ)u[\330\267"
+	.ascii	"\033uY\254\335\250\024,\nF\037n\263V\327D\363o\224\276U\243/"
+	.ascii	"\324\032\333\265\367\332\336[\203N\f\27316n\336\200\350\367\t"
+	.ascii	"5\263\342\325\346:\335\335\246L\363vs\323\372\3658\375\354\035"
+	.ascii	"\204Ks\357m\377\354\333\335w[86\216\265\023\313I\346\232{\357"
+	.ascii	"\017\033>\344\266>0-h\034\273\306\2460\254\244Q\271\371\266\251"
+	.ascii	"o\321\260\331\242tc\337\3306\366\315\214=\363\273\334\033j\317"
+	.ascii	"\256\3519\367\356\252SZ?\333g\327\3648-\367U\ntU\\\372\366\336"
+	.ascii	"\037\206>|@\242\351\360\323\371\226\212\276\225\242"
+	.string	"m\032\253\306\276m\260|\267O,\232\237N\313\275\334{\373\330=\261'\254\233o\327\264\b\366\266\033P\373\367g7\240\267K\375c\205\320[$Z\003+\204\242z\027h\250*nge\362\262\033\017f\227\233\263X-\226\fP\215\221\246\345\315c\206\264\0201Rs7\337\376\320\377\355\027\213g\301\3300\266\005\373f\305\330.\267v\326\313\363ro\2505:\027juQ\312\275\367\355\331\226\026RJ.g\366@\375\354\027+\376\224\226\212\030{w\246\265c\333:-\246\\X1\333{\017}\370\360\341\303\207\0354[-p\331\311\267U\332vY!\024\203\rBo\267\276\b\364A\240\317\202\276\n\215\355\254\020\032\202\r\232cC\243\262\021u\363o\261\310\351\320\345\345\221\335Ld\345\254\023\313f\355\330rY_s\357\375\337^\261V\354\233\225\263q\267Tl\225\347\3459\370\211n\345l\233\205\233@j\357/."
+	.string	"x\341\362\244J\337\336\313\017C\037p\224\227&dh\266\333\n\241?6\b=\004\264u\263R\354\233\007\313\274\215b\325\016\204Z\356\265\275\227>\3000ip\260\335|\021\272\002\247\355\3019\350[\017\250\317\337\337\337\237\365\200\036Hg\033\204\376\026J\023\273v\346\355\332\033j\357\255\341vA\303\325w\263}Bt\013%\b\275\312Zn\266\275\267\017\206\273\302\342\315\315\327\006\241\327\372vV\b\335\261A(\007+\204*\261g\226\t\216\232\352\332l{/\201R%W\300\330n\266L\256E\263\313[&v\3117\360\340;P\373l\357\245e\222\367v\262V"
+	.ascii	"=\326\n\340\224\033sj\202\346_\375\245\025B\265\rB\205\320\003"
+	.ascii	"(@\005~@F\321\363\016?J\301\237\327+\364"
+	.string	"c4+\345\263\313\363\243\347\177\375.\320\205\243\320\227\246\204\021,\2074\027\300\177\342]\275+%;\335\013k\026\374\247\324oo\374v\314\222\331\030V\210\r\263W\326\205M\263]X\326\207\375\262H\254\330\223\337.\2610l\020\353\265e\245\344\267U\266\354\2676\254\322\242q\375\026\307o\251~\333b\206}\301\202]QX\246\374\200\377P\216\005\310\005~l%6\001\253\243\177z\302\2171d\263\037\017\231\300B(\0068\354?\032\211\f\374\016\033\340ax\360\327\237=\340\025\356\376o\323%\313e\277\355\372\337\002\356\372m\033\314\365[?\274\265\204o\\\241\225\313EF\224\374\013N\221\215\212\374\027\002\271\002L\017\270@*< \023\371\255\331o\331~\273e\365[8\227\303@\036\362\337\025\001\340qkd2,\003\0331\005\330\352\377\322\306\371\263\322^)\361\3471\023G\3030\376\f\344\317[7\203\017\371S"
+	.string	"\374x'\377\370\357\023>\314\203\002\340*e\037=,\007\334v\224\201!\334\"o\335\3049\370\363\021\334\342\251\217\210c\311b\377\345\216\302\275#P\375G\341&\034\220W\340\0373\276\274O8"
+	.ascii	"<.\310aM'\276\334\177(9\203[v\2712\007\377\231;6\310RTw\305\020"
+	.ascii	"Z\016\273\027\275?\b\377\251\376\327\230s\3746\203\034e\225\230"
+	.ascii	"\220q\374V\347\317\\\277\365y"
+	.string	"\234\377p,\232\006V\307P\336\372\255\224\377\336\237\233\370\001\376\223\b\351\367\277\357\267\377\357\346\277\032d\032?\3761\343\277\211,\343\336k\370\263\227\037?c\375G\263\034\236\376(\376-\220\275\220\246\031\344\253k\202}\203\233^\005D\266\232 W\375\326\355C?\372g\207\374\370\003\277%\263El\f\233e\231\3300+\304.\211\374x\351\267.\354\325\217;X\033\377-\301FY\031\326\210\365a\355\017\253e\227\374\267\203\354\342\267P,\214\377n\220\245~[\003\037\377\034\365[0\333\342\267<\376C9\026\033\304*\355\016\333\343\307+\374\367F\330\016.\253f\277~|\364\3333\213\304\346\370\361\360\267b\326\311\t\353\365c\341o\253~[\367\333\225\313o\223\277\355\362[\024\277\365\362\333/\277m\341\307\034@\376\231\305og\374\271\205M\362\002\334\304\275\032\370\337\364\243J\376\313&\257\370-\007\334\326w\242\301"
+	.string	"\346\377\230\022\030\003\377\201?j\344\277h2\324e\373\004{`\376\333$?\375\227\255\355&\322\316\247+\345\307\026\370\263\223\345\320f\323\376,B\323\217#\360\347\005\354\037\233\360_\240\037K\340\307%~<\201?\217\340\317 \210\340\277&\344\020\374\026\310o\233\374y\002\377\305"
+	.ascii	"\004\377\315\373o\231\374\201\377\314\314\302\237+\300\364\343"
+	.ascii	"\020\376\254\342\2674~;\365[8v\255\rsp?\310)\376{!\243\370\177"
+	.ascii	"\301\377\002\240\220\227\254\333I\374h\006\216~L\364\333+h\360"
+	.ascii	"\307D~\034\344)\361\307\006@\303\027H\340\307\0358\374GCE\034"
+	.ascii	"\205\343\037\365\340\016\340\030\270\031\236\363g\035\177^\255"
+	.ascii	"[\361\372\317\"\322\254\264%'1\177\233\367[3\277\325\373\355"
+	.ascii	"\231\037\363\375?\377T\357\307^~\334\302\217\277\374\330\356"
+	.ascii	"\307\\~|\367\3430?n\312+\374\330\355\307u?\246\313\035\370\357"
+	.ascii	"\363\247p\376\254\377\333_\007\375\231\370\347\243?\017\377\034"
+	.ascii	"\374\263\006\376\234\201?_\340\317\026\370s\n\177\206\300\237"
+	.ascii	"K\370\363\b\177\036\361g\006\374\031\001\177\356\340\317\032"
+	.ascii	"\374\031\304\2373\370\363\207?{\370s\001\376\\\301\237u\376\f"
+	.ascii	"\374\363\177\034\347\307k~<\346\307x?.\362c ?\026\373\361\216"
+	.ascii	"\037\013\3758\354\307_?\356\3721\327\217\267~|\343\307Y?\246"
+	.ascii	"\361c\031?\266\3721\325\217y~\334\342\307\366\307O?n\372\361"
+	.ascii	"\b~\034\202\037\177\340\307"
+	.ascii	"L?N\361\343\245\037'\177\354\201\037\037\177l\374\261\322\217"
+	.ascii	"W\3701\361\307H?>\372\261\321\217\325\037\017\177\\\364\343\023"
+	.ascii	"?\026\376\230\003?\336\300\217"
+	.string	"5\360\343\f\374\267\357\307\030\370\357\336\177\323~l\201\037S\340\307*\374x\002?\036\341\307\f\370q\b?\356\340\307\034\374\230\350\307!~|\200\037\033\340\307\027\374\270\303\2179\374\230\202\037K\360_\016?\036\372q\206\037\377\374\270\347\307\351\217\357\177\375\376\333\346\277i\376\253\367_\346\177\247\374\227\355\277O\376\273\366\337$\3775\373o\331\177\213\374w\310\177\305\376\273\343\277a\377\375\372o\327\177\271\376\273\365\337\033\377\315\372\257\325\177\251\376\373\342\277R\377m\361\337\025\377}\372o\323\177S\374w\351\277\311\377\"\377{\374\257\322\177W\370/\361\277G\377U\377[\364_\341\177\203\377\325\300\1773\360\337\024\376[\342\277(\374\327\204\377B\340\277%\374w\204\377:\340\267n~\213\346\277 \374\207\362\337\017\376\333\301\1777\370\255\317\1775\370m\333\177\276\337j\370-\320\1772\377\005\361\337\f\376\213\301\177=\374\267"
+	.ascii	"\377\231\377\265\340\277\003\370o\206\377b\370\357\205\377\023"
+	.ascii	"\374/\300\177\201\377\321~\313\341\267\031\374\027\375\357\375"
+	.ascii	"\357\377\233\370\217\302o\341\374\366\315o\375~\273\367\333\346"
+	.ascii	"o\301\374\026\313o\247\374\326\355\267\033~;\364[\f\277\r\372"
+	.ascii	"\355\205\377*\374\366\347\267\366\177\231\377y\377\261\374\277"
+	.ascii	"\362\177\371\377\204\377Z\376\323\375\317\340\357\357\357\357"
+	.ascii	"\307 \346\027Z\361\243p\027E\212 @\256)\003\331\351\343\364q"
+	.ascii	"\016\251CC\366sH\317W\031 <n>\225=SB\310X\271\371\024\222\347"
+	.ascii	"\206\214\331\212\272\371\f\222*yb\305\310\315\347X\b^X\255\271"
+	.ascii	"\371\004r\346\030\267,Xn>\177d\300!&\326#\303\325\216\035sp\031"
+	.ascii	"\240\302\302\236^\260\371\372R\222\327\325u\346\201{\317\351"
+	.ascii	"\301q\321\377\311ur\305y\301\2732\023\242\262\265\005\002\021"
+	.ascii	"4Nn\3348\023\270\367\234\326\002\342\274 9\261N\2543KI\\\215"
+	.ascii	"\237YL\233\366&#\352\346\223\306\345\246\304ie\335|\3068g\370"
+	.ascii	"\300\325\265Y;g\2342N13\252\202\f\221\320[\202\345\346\023\206"
+	.ascii	"\220\322\312*\023)a;\301 \252\342%\224\203\212*\217\001\367\376"
+	.ascii	"\352\221\3125\tQ\351\377|q\276\240\312\241\\\243\377S\352\224"
+	.ascii	"\242\342Rb\370\242\377\263\305\331\242J\034\006\246\276eb\317"
+	.ascii	"\025\347\212\020\210\244aP\242\377\363\351|\272^Vm[\345\264\270"
+	.ascii	"\363YS\206\343\307\315\307 \244M\233\263\t\007\332\006\353\334"
+	.ascii	"?\233\314\344\037,\246T\335\234\343\344\277\377\300\235\346^"
+	.ascii	"\234\274\233u\272H\371Rus\206s9\335''f\353\346\354\227\3370\361"
+	.ascii	"\2504o\316n\316|K\023\363\003\303\f6l\334\34008\361\361\235\231"
+	.ascii	"\177\366\213\0258\340\202\364\364\177\277\334/g^\330\327.\316"
+	.ascii	"\224\252\346\363\336\336\365\032\332M{\002\250\322\024\204\345"
+	.ascii	"\314\231\334Dq\244\345&0\353\307\325\315\017B\323\323\273Y?\241"
+	.ascii	"v\230\231r\357,\fx\310\2228y2\313\313\273^C]\030\017F\2227f{"
+	.ascii	"\317a\220\341\234\t\323\343\346\007\311\0303\346zi\220\266Q\221"
+	.ascii	"i^\370\303\303\303\n\003\006\214\255\213\273p\345\313\2273K\330"
+	.ascii	"+\322\020P\327\204w\325wa\351\305\313\365\"\252K\273\360C\377"
+	.ascii	"\271\313[\356\222\311\256\332n\002\001\231*.wq\244\326\334\374"
+	.ascii	"\013_\372\317uo\271\356\216y\350rr\262\300\310\336\020\031}{"
+	.ascii	"\317a\240\301\346\270V\334|\240=+\267\222\351\376\263\367~\332"
+	.ascii	"\233\213+\315\201\205w\325\247\345\231\216\251\373\236\224\361"
+	.ascii	"qs\316\002\304B\324\374h\334\234\345\362\334\177\240\345j3\343"
+	.ascii	"n\356\031\013v\323\223\272a\265\001HdE\031Z\276rW\030\211\261"
+	.ascii	"\205\305\315@^\250P\311]z\363yq\310!\026\347\346\003\271\351"
+	.ascii	"?\303\275e8\233\007\214\332\033\006\007\"M\250\334\213+57\037"
+	.ascii	"\250\211\376\363\333\355[~\313B\262\332nb\200\037\0137}{ga\240"
+	.ascii	"\263\276P)\273\371@hR\244\234\231\227\033\b\007^\360\256\314"
+	.ascii	"\224\350?\267\275\345\2663\355U\206\026S\2224\367\325\306\340"
+	.ascii	"@E\364\237\331\376\r<\260o\231\3152\031\332Mi\026 \347e\211\301"
+	.ascii	"\201v\254\255\345'v\357\275\263B@bC\271\263\256<\234J\272\342"
+	.ascii	"\232\331\211\231;\030c\366\315\007\252J\222$\253\351\215\376"
+	.ascii	"\245\341]\231\355\254+\017Y\3559m\0023\340\260\270\371\231I^"
+	.ascii	"\376\300\213\003\316.r\363\201Z\350\274$\243\375\007Z \005\306"
+	.ascii	"\323\315\277?o.H\257\324\220\362\273\371\317Q\372\001\trsV\222"
+	.ascii	"\221\250\261\331\272\371|\177\373\017\324dW\244\312n\376\317"
+	.ascii	"\031\235\315x\334\352\232T\271\371?_t.\273\002\205*L\034*El\017"
+	.ascii	",M=n\376O\233\036\262}\260\360\345\200\273\371?h:+7\3440\335"
+	.ascii	"\262\260n\376\217\230\316Az\302\246\3140o\376\217\327\216\023"
+	.ascii	"\2157/7\373\310?0\232<\033`7\377\247\312\207\230\230\227\007"
+	.ascii	"riY\030h\254\030V]n\376\217\223\376\363\216\267\274#\303\300"
+	.ascii	"Q\333\351\213(\006\032\237\274\034v&Wu\363}\356\364-\022\233"
+	.ascii	"\263\236\275\362\027v\263\033\306\225\004\300P5\367\225\f\f\356"
+	.ascii	"\363\246\237m\344\033\317Z\327\312]\272i\357\246\345\266\032"
+	.ascii	"\212#\303\273\352\333YY\036\362\013\027E\204\344\034\317]f\322"
+	.ascii	"4\253\251/7\237/s\375\007\346\354y\001\203\307\205#\306\030'"
+	.ascii	"rmg\017\277\030Rn\316[xc-csin\276\017\232\376\355v\272\332{\303"
+	.ascii	"8\227\373\352i\007\375\355\355i\255\207\237\307b;\200\377yo\006"
+	.ascii	"\240X\356\2475j\366\336V\215&\302t\322\272\371?\207}\332\355"
+	.ascii	"\r\365\325\324\200/,\250\257\032Qk_X@Qk_\273\t*H\023\320\325"
+	.ascii	"\376j\212Z\333\033\b\n\252iD\027V\324\232\323\006\212Z\333X{"
+	.ascii	"\305\035\226\335\313\257\246\r\325\265\2016\324v\332k]X\034\242"
+	.ascii	"\240\276\260\242\326\234\260\200\242\326\276\260\366\332\327"
+	.ascii	"\376\331PNWRP\373\nh\257}\241\331k]X?Qk]XQk_hv\211\224\337V\f"
+	.ascii	">5<\362,V\024\324\256\242\332r\272\372\261\213Zvm1{[6\026\373"
+	.string	"j\333\355=\200\275\267\272\256\3048\325\260pOvUOR\234\2726P=\201um(\273&\273\355\242\212t\355]\344\tiS\355\275w\007MK\273\335\303\3325\205m\355)\026{K\260\227{S\355\335d\267\335\336\273i\357\235^m-\367\276\361\023\245\244\242\332;k\210jo5\305\261\330\373\262\221\201\303\212Z\003\353\"\212{\262\246\334-\226M6j\252k+\267\230\257+\275\326\224\266\247\366\3366\215Vb\305\330\273\371>O5h\344le=aqs\233\216\022/Y\350n\376\263\214\267,\303\262\341\250\275\261\020\200\005\013\357\252o_]a\360\2366\372\31712\f!V\262\366n\306\312\024\300C\253q\363{\364\364\255\032\325\231=\300\275\347\334\224\271*\2778\263\007j\271\201\240c\274\326P\351\313W\331\312\276\345\252<\225\227\037>\f\001\221x\231\261@\363{\230\372=M\364{\226d\251}\247\320"
+	.ascii	"c\246#Ge\250\274\302\276].\263\360\351\341\202\027F\314\315\357"
+	.ascii	"\361\322*\366\336\333^\016M/\207\376\366\355\314\354\224\246"
+	.ascii	"\334{\377\354\220Q"
+	.ascii	"3\205M+\357\245eqG\267\342\346\367D\341\277g\265.\036\354D\243"
+	.ascii	"\216y\363R\007\216+\212\214\233\227;VV?\272\336\370\355\321x"
+	.ascii	"J\342\367c5\230\017\273!\300\2327n\230\315\261\233\037\367\341"
+	.ascii	"6g^\0354Y\362\326n\276\3366\b\305k\210\216\331\354\270pA\246"
+	.ascii	"\346f\373g\203P\273\334V\b\035\332i\366t\322\302\270\362\366"
+	.ascii	"\306\254\217\23217@\320\350=u%\361\273\371\034\220\321\221\247"
+	.ascii	"\207\305\350\215)\243,\203\317`3\270i\337\260\036\316\303z\030"
+	.ascii	"O\207\231\323MkW\345\344\363\274\321\347!\243\317\303\324\347"
+	.ascii	"\t\242\317\343B\3778\f\230\036gZ~\\\f\006\267p\361\020)\255!"
+	.ascii	"7\177\001\202\355\335h\243\317\001]\031\314\005w\301v\370\316"
+	.ascii	"\276a/x\213\0245-zgY^\230Qb/\270nE\332\001\226\240\301\273\372"
+	.ascii	"\240\2278QC\225\223\277S\247\277#E\177'\212\376\316\023\375\235"
+	.ascii	"&\372\307sX\\\304\200\"r\363\355\033\306\202\257\030I\223\006"
+	.ascii	"N\356\370\312\231;{\002\2363.1\242n\306Ll\305\307)\017\316\f"
+	.ascii	"+U\200k\326\262\222\334LE\347\310\031\025\0317\177'\311\033\216"
+	.ascii	"\303p\313\275w\213\036W\312n\376\016\231>\337\231\377\201\326"
+	.ascii	"\310\033\2226\374\206\247X9\243%\316\315x\312\231\027\350\304"
+	.ascii	"\215\334\326\315?\226r\354f\205\267&\315\315mK\250\275\367\320"
+	.ascii	"\016\227#nhn\376N\230f\316I5\325\244l)\323\332\270\224B\320\220"
+	.ascii	"\254\321\3755\211\3420\233dM\306\356\226\2223%\221(B\224n\312"
+	.ascii	"\026\362\300\334p\024q\362C\271%\2162-J\216\264'>\224\314+/~"
+	.ascii	"\254\205\203`\"x\b6\202e`\033X\211\227X\007N\303X\270\b~\201"
+	.ascii	"\245\260\032\236\201\275\360\023\f\003\227\341\037\270\t\006"
+	.ascii	"\303Kp\022\334\205{`%\030\nF\303l8\006\316\302.\360\026\006\202"
+	.ascii	"\205`1\374\205\221`\0348\n\276\302N\360\031\266\302a\370\b\276"
+	.ascii	"\201y`2\354\0033\301;p\016\314\205\253p\024\036\3034p\rL\205"
+	.ascii	"\327\360\224}\303fx\0377a\247,]\374\224B\226B\232Z:\230J!G\230"
+	.ascii	"(\317|e\321\n\0033\227\345\016\314\214V\017)Jf\025'UW\013\207"
+	.ascii	"\026e\231:&\025\2534\265 \036|\321S\246\261\2115/\323\nU3\213"
+	.ascii	"\2273`\376\033\006\217\314%\373\257\220!mY\270\274I[\003r\231"
+	.ascii	"rS\312\013\266$I\032\224\036\3120b\300\306\204\031#\206\211\305"
+	.ascii	"\205]\213\313\322\302O\270\305\n\272\346\315b\347F)6\205\203"
+	.ascii	"\267\033o\232d!\302f\327\314\365\303K8\022\236\350\232g\316\224"
+	.ascii	"(\367^j\361xk\246M\271c+\264\224W\b\023'fE\214\260e\321\022\225"
+	.ascii	"\245\016Ns\357e\0302]\224p\356\330\334_\223\267k\206D\007\332"
+	.ascii	"\r\362_&6\273pNl4\367^^!I\300,Q\356\275\f\203\315n\036\027\345"
+	.ascii	"\336\313\017C\037N!l\254\320Y\250\214\241\360\n\3736\204Y\334"
+	.ascii	"=Um\335\374\035\034z\004\333\016\241\377\263C\350wVh\rg\205P"
+	.ascii	"\353\242O_g\214\276\316\234\276N\024}\2352\375\337f\230\253w"
+	.ascii	"\335\330\275 g\236nn\303&E\212\214\233\233\257#D\377\277k.\337"
+	.ascii	"Us\331\3344\366\355\366]4w\271\357A\335\226\362\314\335\273^"
+	.ascii	"x\251L\241\200\345P\353\263tw\f/\341t\213&\\\315\275\227\267"
+	.ascii	"h\266\\\257\236\246\237\375\364\005\207r\357\345\006\036\334"
+	.ascii	">\313\345z\3654-\267U\n\246\345\302J\337\336K]\243\371\324b'"
+	.ascii	"_\007\210\276\216\016}\317\020\3756\305`\305\315\270\371\264"
+	.ascii	"A\350u\2744\336V\b\275\216\225~\016\033\375\234<\375\234-\372"
+	.ascii	"9n\3729J\264\0066\b}\237\025B\237C\246\237\223C?\347\205>pO\037"
+	.ascii	"x\247\017t\323\007\226\351\003y\350\003s\350\003i\350\003_\350"
+	.ascii	"/\341\350k=}\255E_K\321\327I\364\365\017}}C_K\351\247M}8\033"
+	.ascii	"\204>\005\243\237f\321O\327\364S\245~\272\245\237\262\320G\367"
+	.ascii	"\364Q.\372h\233>"
+	.string	"JD\037\335\322GW\350\237|\372v6\b\375IF\377\234\323?\325\364O\"\372g\230\376Y\245\237\377\364\263\031}6:}8\246\376\\\231~\346\322\027c\205\320\347)\375\246\rB\337\264B\350\365q\177\330\267\013.\220M\035\036[a\252\364\222k43>fq\334f\334\254\317\356t\231FB\266\206\n\312\206\252\007\2366\273F\302\364\231\362\005\r\310\315\372\310\035\213J\022\347\315\005V\206\f\321E00\271\033\"\003'\221\n\223C\023\271.\302\303\347\304\016\r\356?\020\345b\365\306\215\024\2452\005B\301\215\2515s@/hf\266\234\005\t\202vY\035t,\334\364\361D\211\271\241\345\346_\300\003\b\220\334\264j\333*\3352\345\306\314\254\207\307\213&^\374|\370H\201\034Cm.7\345\336Y\036r\2726\034\326\315/@\236\330/\226\002\261j\333\212\202\255\2515s}{gy\200\300\221.Y7\277"
+	.string	"i]\327a]zGjeh?Am\256\036A~S{T\372v\324\226\207\243\0359\266h\035\327;\266\240\177N\340\2764X\212\007\206N\355f\375uj\305\310+\342\365\003w\304\266p\331\273\371\005x\241_"
+	.string	"(Mu\215\365\3337M\245\271\360\027\273\334Y]Mh\020pd\352L\222\276\035\225\345\241\347\305\231/\035Y\327\\\32786\360\340z\305\035O\236\334\254\267n{\244y\022u\363\365\r\255\365\003\201de\244\304\271\371\004"
+	.string	"\243\265\215\003\334\215\327\033]\343z\227\212\212\021\0347k\032?\303#%ML\317\340\002\366\345\351f\rC\307\260o\247\3232\276\364\351\241\322\"\n\335\315'"
+	.string	"\027}{:t\004\366t\250\266\272\276\372\201@*\\:\256\350_W\375\300\264-\214\226\362\346\023 N\237"
+	.string	"m\372\327/\364\013\013\007\334\373\353FNs*o\b\366\323\262\303\212\r\355d\337\264\223\226:\243\366\306\322\200\254\311\347\210\0267M:j\307\t\207\227\2308?#34\213\353\026\277~\322PcT>\332n\326+\210\256Y"
+	.ascii	"\231J\272\204\335\274\301\006\241\026\316\n\241\022\330 \364"
+	.ascii	"\004\270\322\277\336zg$\227\t\260\351\317\307\327\315'@S\337"
+	.ascii	"\3238}A8\030A\243\323\302\212\257\247\233\3237)\234\324/u\223"
+	.ascii	"\2661\223\367\224//]\343!k\303\310@\211\027\240\0237.Xn\326\001"
+	.ascii	"\265%\315\315\351^\252\006Xe\352\313\326\315O\323\374\007\346"
+	.ascii	"\210\335\215\031\271\371\242I\317\256\240\242\334\374\264\211"
+	.ascii	"\341l\251\"u\363\3233\377\201#\310\363BrsjF\263\260\240\313\005"
+	.ascii	"@2jz?\312<5\363\247z7Hz\306\201)\255\25437\367\330 45#zZ\346"
+	.ascii	"\na\243\243\273\371\0268\321\177:&\035\203\266(\341go0-p\373"
+	.ascii	"*\013\203\235\"P\264b\334|\013\204\224=\205\222\262\245Q\354"
+	.ascii	"[Z\226\342\021=m'\263\020\342\260r\\,o\244\335\034&}a\303\215"
+	.ascii	"\355\346[\360\245o\317\332R)ySR\267\t\236\242J8#\323\204K\251"
+	.ascii	"X;\261\006\224ui\356\275\264\222n\261vY?\033\352\355L\323.}K"
+	.ascii	"\335z\232\200\366\016\033\243\274K\301\244-\244^\322.\351\027"
+	.ascii	"\373\226\332\245U\236\262\245Q>\204&\265K\231w\314\332\2115\340"
+	.ascii	"LLs\357e\030>!v=\271\355z\023<E\225\200\226nI\345R"
+	.string	"\272\t\236\242\266\323\027\002\266L\335\235\365\245u)\027\373\226n\371\320\006\036\2771}hh\376S\272T\013\234\013\255\0267\247Y\314\254\321\275\b\273\371\0268\351?\305b\337\32293>-\206\300\trsz\345zRM.^t\370\323\357\320F\277C\031\235\306i0M\034\\n~\2070\372\035\356\364;\324\351w\220\323\357"
+	.string	"\247\377TJ\352v\256iQ\303%u\273^\367K\335\324\323\315\357 E\337\245\025B=\330 4m\222:I\237\374@\237$p;\334n~\2075\375t\355?\020\005\037]\334n\316iO\325~\340\245\023\242\244\272\371\035\230\350\247L\322\345\017\354\021\023$J\332\315\357pD?Es\373Sc\343\346t\211f\321\241\307\00598\336rh\035y\272\344O\315.Yz\306\001\026\376\340\260\2719M\222*yz\226\"I\317:\350\332\333)=\363y\263\267\223\217\265\002\260V"
+	.string	"9\t\230\22064\277C\230\346\261A\250mB\364\364\210\016\227+M&7\277\203\225N\203\244A\322\"8j;}u"
+	.string	"\207l\013\203s\315L\031\r\";]e4\232\371F\033\230\265tHJ\206y`\215\001\2739U\242i7\240\340n~\207\246T\b\031\037>R \027\366\336[\231n\301\"\245\251\377\230_\230\374x\n\204\271\323\266\344o\356r3\342\224\324U\021\023c\343\205n\013\327\331\315\037\300\222\035;\320\031v\357\034\276\270#`H\266n\376"
+	.string	"v\244ai\030\332\005\344\313A\223\3267DI\225\233?\200\252\257/\3136\264\334M#\360\302\2732s\323\325\305\245$\243\377\224\313\276\245\\\330\357~m\335\267\004G\263nk\013\357\345l`\330\222\034M\267\0337\266\316\262\262,\033\216\312K\264\224b\372Oi\2444,\033\321\336N\\i\025/\001\334\320\177\212\225\306HeX\266\237}\267\201bF\264\b@*\205\221\302@\251\376\343D\327\204w\325\307\201\215>\207\026\364\237Z\245V!\030\211\343\020\227J\245R)\325\215T\216Lg\013\337\376J\247\236R\235jS\336\270\2709}\261"
+	.string	"\266;\250\233S\027y\216\251\334\033\033\373\017\f\312\371\350\273\371\034\232\350tE\272\"m\301\227jamy\340\311\253\333\363\222\262x\332B\216\312Jo\354f\"\351S\372\204j\261\373\312F\217\2264\0336n>\207.\375\247MiSFr\032A\203\315~\374\310q\3639Xi\364\017\375C\307\354\3365r\234\250ue\271\371\034Z\350\037\205\203\302\211\322T\343\347\227\245\351\213\376\3216m\316\224W\364\217\262A\331`!\013\300\033\037\037V"
+	.string	"\230\350\037M\203\246aA\365\243\271\257\2620\360\241\"\326\346\353\346\007\200L\377wy\227XxW}\\.\227;\346a;9Y`\204\354\350\031\364\214\225\022\207\376Q=T\317\262\241W$\270\371\005"
+	.string	"K\377h\036\232\307\206\252\252\031"
+	.string	"(\375\337&M\250\326\326\246\2348y\361\344\211\013(P\244\224l\227-J\271\2576\032\332\337\225\273r/\3424\177\353n\235\033\034\324\316\276\241v\030\314\205+\024~\270\341\323\377\215r\243 \200I\032Z\207\326\241czw\t\241\314\230\264\233_\001\236\376\257\335\265\343`\004+K\026T\213\336\220%\r\2375\271\302h\271+\022\244\355\346W\220E\377(\026\024\3139%\347*\002RR\315\n\230rr\327\313\376\354\2471SJ4\375\243U\320*.\232\025\020acC\343.\\E"
+	.ascii	"/N\023\215C\341n\016\0133Re73C\220\346M\327\315\257 L\377G\245"
+	.ascii	"\240S\354\033\372\206\266\275\241Q2\f\234v\005t\301\303L\023"
+	.ascii	"}C\335\3162\326\216mo\030\032\300A\2637|\370\340\243\245\205"
+	.ascii	"\004\n\232_A\r\375\n\242\364)\210\243O\001\232\345\022}\342\245"
+	.ascii	"'\316\030\272\355\344\350\023f\216\2237:\312\334\214\246\241"
+	.ascii	"k;1\274\372\230\350\032\332\204l\254\252\006\326\345Sb\346I-"
+	.ascii	"O]\275\2523o\356\364\217\242\241h\247^\b\177\024`)+C\317\260"
+	.ascii	"\354\3405"
+	.string	"\365\360nF\317\230;QN|KnF\217\240I\300\242\214\241\221\004E\022\027&\346\224\267\363Fk\017\0175;\353\212|%\261\243\300\t\035\335\231Ym\003I\231ixW\367\n\027\026{7\023!\022G\206\222\221\341+Vm[M \207\225\345\341\234\241\204\005\231\233O\201\027*\004\025\222\217\340\250\355\004f\301\037\031\005V?~\240c\033f`\2456\300\250|\001rtl\214\257\317\307\315\347\323\341r\003\206\230\233O\301\326?\332\003\355\3415\201\030\255C\007\312\303\317\213\316*#s\332q\224\007\013)kd7\237/\273H\023\003\373q\363'\240\242\217zY\024\f\005K\303\273\352[\202\346@s\240]%l\f~XUx`\236\334\214vY&dD\300\246n\376\004:\364Q-\213\342@q@ikN C\237i/\324\336N\035|t,\0213\003\275\201\3368\373\364\036j\2236\006\243H\224\233\017"
+	.string	"8\372G\263\320\254\272<\024\006J\003\205\201\316@c\2401\320\0319i\274x\360\340\300\211\3118:\243G\231\031y7\237\3172q\001\243\n\327\315\007\200\025}"
+	.string	"\224\351\037\275B\257b\220\001\300\013\225B\253P)\224\nu\201\272@\251\330\244K\274\356\232\251\250\252\251\243TL\254\243iK\315\315\350\213\313\221aR\226\006\200\255/\301\234\376Q(\373\206B\241-,\326\336NY\026\304a\001m\364\230Q\344f\264\305\217\256@Yd\032V\337\250\262&\356\346\rM+\204b.\033\204^\202%\034\324\t\016\332\024'\016\332d\367\325\336Y\273i\r\252\205\205\002\261\001\246\346\346\037\335G[\360s\301\274\371\374\223\200L_\002-??\020\214xI"
+	.ascii	"\305w\266\341;\373\326\2549\373l\227&\274+\263\036' \312\035"
+	.ascii	"l~\366\335\263\265\026\2506x\321\337p\344\314\231\346\314\271"
+	.ascii	"w6\317\346\271\247\2336 \321^l@a\335|\356m\310\322\037\332\323"
+	.ascii	"\377\031g\337\316\270S\017\270\200\030Xz\377I\345\254r\226\331"
+	.ascii	"\261\305M\326\315yS|\200\035\271\371C_\364\355\231\226+jX\316"
+	.ascii	"\354\201\263T\256\240uif\341rZ\261\343\322\245\271\245\214\313"
+	.ascii	"\232\234U^\351\322\234;\263\347\fs\266p\2129\307\234_N\274\223"
+	.ascii	"\314\351\345\004c\337\316\273\263\356'\227\263\313\363yw\322"
+	.ascii	"\245y^\326P\351\333{\353d\301E\211\301\220?d\247o\227\025B-\210"
+	.ascii	"\323\037z\323\037r\323\037b\323\037r\242?\244\246?\304D\177\350"
+	.ascii	"L\177\b\211\346`\203P\324\316\n\241/c\203\320\017u1\231\026\256"
+	.ascii	"\204\355\204\225\001\031\2329\f\200;\322\334\220r\363\207\252"
+	.ascii	"\364\177\266\331\267\263\355\234rF\355\r\203(F\3239\345?\335"
+	.ascii	"N)\031\306\325b\207'v\263]Z!t\310\006\241\327\320\247\377\223"
+	.ascii	"\355d\223\332z\362\3042\321 e\216\271\321\324\220vv\252\235\235"
+	.ascii	"k\350\336v\331eu\325\344\347\032\256\363Adm\214\t\221\254\035"
+	.ascii	"7\237K\316%g\232n\332@\004Mj\244L\02477\377\347\362g\232N\234"
+	.ascii	"\275\032N7\237L\356X\222>\261\"7\237h\327+\357\f\035\225\233"
+	.ascii	"\317w\275\376\003O\2605e\2307_C\230\276\206\235$I6b\257t\033"
+	.ascii	"\225V3\303\235\376O\263\323l\253\231\001\256\254,\023\261W\332"
+	.ascii	"\215\312F3\003\223j\322\t\341\272tB\022\t\204\252D\\M\034\225"
+	.string	"\212\200FE\242\020\231c\002\303\221@$\221V\241\322\260(<1\024\252#\214z\216\004BE\032\213\206\352*$\212H\022/,\255B\025$\220$\221\241H<\252\220Bx\001#\222\351(\250\004\211\245\242\272\256\"F\254\352\221\206\t\254*\t?D#\214\3000B\t\023\204\204F(a\302J,\222\bZ\211E\022E\242\220\004\236\324'\2051\311\b\251\242\220\200\021\311t\204\341H \220\252\n\242R\b\365\250(LA\005\361\004\244q5\236\260\252G?\352*LA=\3629\022\210\"d\260\310(D\221Q\206\344\t\021IF\352\210\242\024V\365\350\302\221@$\223\222\204EH\253P)Dr%\236\b\261T<:\200\212\245\"1\351"
+	.string	"\035|\020\374"
+	.ascii	"\004\025!\326d\321Xt\032\255E\"2\t=\022\210\243\"\021\271&C\250"
+	.ascii	"\303\245\244\242\"1\0042\271\024\"CR\322R\261h,\246kPe\201\230"
+	.ascii	"DS\030\221H\253\261\230\032\t\325\244\314t,RR\225\320#\2010\301"
+	.ascii	"\004\t\025BpX\241\310\230$\202\2124\212\340\223T\225\204(\f\211"
+	.ascii	"G\315t4\212\320\023\274"
+	.string	"p\341*\034\256j\262\307\304\006\246\243Q\004\241\365H \216\216!\216\216AE\305%\235\242\321=\223\301\243\343\316\032,\036\035\317\342\321\021\253,\020\2239\231T\221\303\2410e:\032\2132r=\342\241Z<\"&\t\323\241\232\\\312E#q-R\223\351\221\301\243#\b\036\244\020\251(3!\327$\361HM\001\303\032T\241\016\213D\236\243\360\004\025\352\260H\302h\")$&\211(Bf(\261\252$\f\211\307\f\304\243\220:4\236\240\241\204\322\222\n>;H\325\310h\311\001GEb\n\303\025\200\206=kQUR\221KI\241zB\020\017\220\006 \222KF\"\n\025y\274p\001\251&\361\024\217\210*\024I\f\211\307\013?i\n\341\005.\244\020^\200\204\232\\\372)\022\356\254D%\242\tE\302T=2\231\350\341AQ$\021\304\264\022\213\214Ij\005T\b\225vzD\340\031\022\217<FG\023R"
+	.string	"\177T\b\223\324\024\326\235\245`\017p\247'\007\310\204\240\021\222\222\226\212>HE\253\021\205d\317PM:!,>@h\230\224"
+	.string	"\206aR\002C\342Q\303\017\t\025\005q-\022\001\224aUU\030\022\217\024`\340\220\302\005LB$R\204\222\272&\231T\bj\350a:\n\031\035K\030\200\b\003T\240\256\302\341\221\002C\342\221"
+	.string	"\353\006L7\031\354\321\340\304%:q78q\211\204w\003\341%Rq7Pq\211\230\256\003\206\206\304\022@Dk\t!\025\212\220BC\225\005b\222\220\270\022\213$8L\240\001\210\025)<\2020:\232\240\242 \256B\024D\244:b%\026I\f\211\307\016\304\"u\004\005\352*L!I\001\0365iX\024\"\005\215 \241\203tDD*\241\303TTT\227<\240\"G\030\022\217;)\214I\301\021t\206\304\243NR\200Ih\342'I\201U\304P\035\001\244B\006#\222\211\204\013#\324\241\361\204\"1\350\250HTB\nuVU\205aQ\304Z\244\256\352p\203\221\270\nS@\032\327\"\341\b\027\222\252\212<RG\210\200A\035\032Ox\300\232D\024BZ\217\212*rU!IE\241\232PBQ\222\260h\350<\022\210\243\245\023\3520\3040\211\270tb\203:4\236"
+	.string	"L\022U\2108Z:\241\216P\"\2320a\250H\024\222\340#\224$\252\020!\304\240\217\004\242(\250*\021\327\342\0222D\221Q"
+	.string	"\222G\302\244\021\324\241\361\004\037\023Fd\221\b\246\244\343Q\370\223\f\026GX\325\244\232\302\321QH\270\nG\f\211\307\324\210d:\312&\206\267H\024\222P$DS\340)\212PB\252&HhH&\325\242\"!\252\001\0162@\264\001\rp\220\001\r6\220\2034\256Ej\005\324\235\025\271\226(\216\300\224t<\212\370I\327\240pMRG\250J\304Ug\r&\221j\322\322\003\324\341\322J\\W\241\320\252\006\325#\223\211\241p\311\003\304\023\027\214\216&\350\030\035M\310\260\006\223\024P\225\210\253\016*\341\363\"\"R-\252G\372\035|p\200\017@P\221\036\204\004h\220"
+	.string	"\r\320\203\220"
+	.string	"\"\242\004|@\244\377\001\021&\002\301\001\007DAu\025&\035\225\3245\270\252I\025\031\024B\032\221\310\007$\211*\204\300\365H B\024\215JJ\306\""
+	.string	"\254`\223#\020\255G\035u\025\256\311S\r\252\253pU\201\230D<!\\U\030\022\217\032\326\"\021\257Bc\222\321\251\006S@J\n\221\"\f\211\307\013\311\340\021\321\250\250\243d,\252\303`2\251\026\031\221\307\340\220x\004*\032\211kQE\241\"\217\022p\b\252\253\020\005q-\022\252\303\240\221\221Q]A\270\006\231\204)\204\305%d\207\365E \206\304\243Q\004n2\270\026Ub\021\321\310H5\2120$\036\177\216\021\270\304\b\334a\004\356\232\324+\272\026\227\214E\301\244$\265\350\0304\256KB\r\311\240\232D42\"K\f\211\307\035\026\220\202)\204L=, \005\177X@B*Z\215\305\013k\221\005n2h4$\036\321!\361\210\221\352\232D4Z\213j\021R-q\\\032\026\211\026\320\240\243\264\244\302\220x\354)\022OXE\f\211\307\0375\351\250(\"IE\241&\371\030\217*\036"
+	.ascii	"\004Z\213T#\243 uhT\n\256H\365\250B\r\256I\3045X4\262@D\032\221"
+	.ascii	"\206\324\241\361\004\246\225\210B\210$\201\270\026\205>&Ld(\022"
+	.ascii	"\205$ \215\"0$\207\304cp\250\"U\244U\250\032\3650\t\213\324a"
+	.ascii	"\220\230\256HGD5E\020\251sR\b/\300\343\223Bx\2015i4:\340\202"
+	.ascii	":4*!\325\"!2\250\032\025yRH!d\002JR\213\212D\250\253\020\331"
+	.ascii	"3<\372\031&\031\221\222*\022i\r\256E\242\361\270\252\311!U\211"
+	.ascii	"\270\3460\t\223\324\241\016\006u\025\"\203A\311\242zT2\2120$"
+	.ascii	"\226X\205'P\004\r\221\302\024H\343\bCU5\022*AbDP\t\022\027(\032"
+	.ascii	"\211+1Y\024\"M\214X\213Dc\211UMfH!d\n\372\254D%\242\t9, \005"
+	.ascii	"7H&\205\307\024\306$\240\243\"\021i5\032\225\222\303\340\212"
+	.ascii	"\024*%\205\230\220*\nc\221\212\f\"%\205\310\242\236\2365i4\236"
+	.ascii	"\b\252I\353jD\"\255B\253\261G=2\255?FF\306u\251(\250\204TW\242"
+	.ascii	"\216\232tT\024\016%\211*\204\301\243\245\023\352PC\221(<\002"
+	.ascii	"Z\203\037\020%\225\202C\241\212$\\\301hL\n\"\325\"Q\210\\\203"
+	.ascii	"Fd\221pC\221(<\372\001B\032\221H5\230dD\256EcQ0yB\250!\250&\227"
+	.ascii	".\250\020&\251\310`\n!Sp\250\256B\344\221\272\026\211\030\326"
+	.ascii	" \bk\221\270\224\256D%bRp]:\256K\306 \322\270\032\225.\254F\352"
+	.ascii	"0\270j8\022\210\242\221\270\n\221j\222ZT$\034@r)\230T\"\"M \025"
+	.ascii	"\255\304\022\303\242\210\244$#2(\205\020\211\217\004bI\211\230"
+	.ascii	"\224dDf\244\242\225x<\327\340\007Dk\221\230\246\0202\341\244"
+	.ascii	"\272\224$D\201\256G\032RZR\001'\203\302U8\"IT!bH<\362\224\260"
+	.ascii	"$\354\b;\202=\022\b#\222\351(D\022iL\026\325\244\0047\036Ud\210"
+	.ascii	"\325hD\206\320I\006\215H\246#t\rn\300"
+	.string	"\301Z$.\351\023\021\211\300\201\002(\220\240\213@\f\211\307\020+\322\0211\311(D\221(T\nQ\204L\206"
+	.string	"\241AU\"\256G\243\321\204U=B\n\327\036#\021F\2100\"\231\216t\222\321\350\200\340\371$I\200g\0338\351\342\302\212\222\003\3172\027\225\036\177c>\244\321?\020\t:\343\002\251\241\227\303\254i\007G\225\232\272#\347\2207X\276\320n\231n\341\356\211\224\021\215\2673\226\244\rV\221\374$\037\021;\262\206H\246\213Bc\213\332\2203\313\017\fl\223\241p\314>/e7\003\203\340\021\374\375\375\375\275\331\333\t\030\344\002\225@!\007\006\271O*\306,\312\t\315\313\263\275\227=h\031\220\026q@P*\263\270-\275e\021(fa\200>v\244O\372\336`"
+	.string	"{d5,O|\234\001\212\241]\016\330\233\322\301C\027\021\323\245cj\307\330\026\2657^^\3000{\225\346"
+	.string	"eTe{`\007\206\375\033x\220\211\220\341!\247\345f\340W\036\303wq\306\330|`\352\037\330\225\233hlY[n\006r\345-OT^\334\354\346\213\025\233\233\201Y\300,\340\326/8\215\351\310\240\0322\327\267\263dx\370\201Z\007n\2255\321\213\273\031x\343\3144\035qw7\003m|X\323?\260F&\373\320\267C\rH#\005b\206\213\254\205\233\2011\2002\016\234q\340\214\013\234\201\377\376\320%-@Aa4\001\323T\241\321a\241c\\j\334\364]\t\241"
+	.string	"\333\222+7\003\247\200S\300*4\035\260!\003R\035X\365\205I\0301\037\204\350\037\370\"\033\021R%\204\017\350\"\023\261Ma\326~"
+	.ascii	"\245\356X\215\025~n7\003[\354$\271{\323c\311&\003ml\005\213>"
+	.ascii	"\237\260,\277(+\366\240\316S\316\255I\354\351\234b\231\264\370"
+	.ascii	"\302t\322k\371\311\035\013$\300&\264|\227\306\017\fp\307"
+	.string	"\3654\331\314x\373C\022\007H\013\2528\350\023\037)^V`\340h*=`_va\336\234zJ\2650\030~\026NG1c\367\302\215\306\222\022q2\373k\203\236i\036C\270p\365\035\351\231\263A\343\207fs\226i\003\007K\331\315\030\262\216T\251\271\346\333\243\341\245u\263\336\323i\216(\333\306\\\317\f\2212T\320n\326M\215FL\031\245\312\317\274y\345\323W\244\217\314\031\315\225V)\361\333a\006m\201\302P\016i\242\327\325\203D\257\213.\223\221\304\020#\362$o\r\232\365wgv\363\2301\032\313PW\023\2334\213j\310\034\233\2464i7\377\303\2120a4\236\325B%\304\314\214H\232\247\272\233\361\326\\\341zs\363\r\220\305\213\027\335B\332\234rcf\006\024\363\"\f\331\227\353\026\362\233\272--7\353;\003\250u\351\262\205\205\233>\013F\327\003G\220\272:\246\022\210\305\r\221\0377\337"
+	.string	"4\350\350rsN\211\255\270\316|\334|\017q\262d\311\315!Sk\346\314\304x\341\002\026\306\212\025\215%I\263G\030\0319}\345\032\013\323K\214\r\0367k9\017W\244H\321T\20041\224<46q\327Txpp\255\225\271Y\303)"
+	.string	"\212\016\314\315\232y\246\335\222\006\325\315\372\315\302\001\321\201F\343f=\345\3144G\333\033> kwJ\234\264\265\241g`\314\312\252\340\305)\331\330\364Z\020$\032{S7\236<\321hKR*b\260\354n\276\007\250\345R\257\331\237\345\023\230\037J\r\245mKK7\271^3\343\2436\245\245\315\315Z\r\213\024\02387\353\2643\347\324\2464\233J\224h\264!\275\22789\013\210\336\250d\003S\230\305\023\3224\206\"-\306\234R\312P\031M#"
+	.string	"\263\025"
+	.string	" X<\022\220\211\346m\355"
+	.string	"\024"
+	.string	"\017S\332D\355\2248\032\224\320)\304\214\200\b\002"
+	.string	""
+	.ascii	"\b\004\024\035W`\200\220\001\b\002}\207Ks-\362`\217\223\272H"
+	.ascii	"\257\365\031W\261s\261\331\211\203\275I\r\037\235\333x\2701\002"
+	.ascii	"_K\003/\266\246\302\tiI\350\022O\352X\326\334<r\354\250\300\271"
+	.ascii	"Z\007,\302\004\351\211{\251\322\261\223\252|C\373\305\031\233"
+	.ascii	"\315\251\3772\260\270\031\2261\220\215\306\250\302\255\374\220"
+	.ascii	"\216$\231\2502\203\252\314\360\003\352W'\027\326\315\312\245"
+	.ascii	"\351\227cY\337}\252o\303\003Q\20303\242\032\0170\033\315\301"
+	.ascii	"M\202K\261\006\214\240\301\203\201Q*\\v\3309pM'\263\370\350\323"
+	.ascii	"EZ\037\267\205XK\001\325\376\3049\020`\324T\"y\240\307\b\362"
+	.ascii	"\\\247\tn<,?\372Z6\211*\021\206\316\025o\241g\n`b-\307\020\216"
+	.ascii	"\336u\023P\232kS\004\025\205\234\332\317\245G:\375\\\316o\351"
+	.ascii	"\302\021\227\016P1\246\201+{5t\320 |]\352H?\230I\307r\204+\231"
+	.ascii	"\002l\316\235\365M\240\323\265\310eo-E\305\371\037\b\022hgl\367"
+	.ascii	"\017\260,\t\325\374C\033$I3\326\371\n`M\274\375L\004\005\337"
+	.ascii	"H_!HC\327\003k\260\222\327\017x_`\311\377\002_\206\226\323g\006"
+	.ascii	"\0237\266\322JkD\036\r\244\004FH\375\346v\031\215\017\302\354"
+	.ascii	"\247\026\207\363\250<\240\224\335H+,\261@\305\254\261Ho@B\301"
+	.ascii	"\265\246G\220\214q6\253.a\230\360O\350\322{\242\271#\332\355"
+	.ascii	"\347\351\353\221\301\r\335\244VM]_)!"
+	.string	"\342\\\216#\275a\003\013\250\224\364``\203K\324\263\323\346\027\357u\317E\203\313\210\341\204Mkez\200Y\003\320Ai\tp7\253\031\t|]\214\363\363C\377\371\365\037\310\017l\345\204}\261\302 \221h\334tE\300\210\377uI+\233\320t\262N\204\365\\,\343>\362\335\005sj\335T\261\275M\263\243l\013P\201|\005 \n\314\202vYl\227y\204\3312\366ST\n\253\2678\017M3\0317&xX\303\2052Os\362k\227\034\247q\233\212\236\375\321!\333P\243\013\314\357\3038w\315\240\035\230M\234\b\301\361\020\341\331\337\b\207\205\220v\200\0058\374\227\270%Z\366)\002\312Li\222Z\016t:\212\020\355A.5j\371\024\262\200\310\204/k\355\207\037\325&\2309S\326\202\341d\322qB4Nzt\242\275i[\343\236\3642\331\303\265\237\370P\322\002J7\023c\244\326v?\346\003&\""
+	.string	"]\031\326*\221\261eF\327>\"\373\372\te\325\2734G\342ui \035\266\344Q:\207\233\315W\353%\205X\227e\372\314^\370(\307=\300\277\fc\013y%\314-L\317}]\t\023\003\242\033\026\331\016x\361X\035\317\363\222\rPG\343g\235\235\035\342(\020\265\306\202\224\267\317i\304\312}\225\235\360w\213\341\223\236i\327\376"
+	.string	"\323\265\244\230\306p'\362P^\377\207@\324\230\376\246\204Y\026\275@2\\\204\032\220l^0SG\231\265\253\274E\035\210\r\344\340>\037J\246\236(\336\350|\221\263f\245[\f]e\320\016\275\027H\264\bZ\307X\277\237Tb1Zg\341\330 B\343\3664}i\244\320;5\250\327\262\tc\216\355"
+	.string	"Qa\267\026\351\024\006)\017\022\253\032\327\314\322\024e>\342i&@\034u\335\260\346\300t~\360\2235\263;\"\260\210\270\b\256\356\224\240\372_\\\212\304\227\016b\023_\223\306\240<bRW\310^Hqk*T;YQ\320\343ZU:\365?"
+	.ascii	"\371\301c\"\266\271\232\225E\031q\344\216\347\212`\210\272\302"
+	.ascii	"\261\264\363m\235D4\265\\o\235\034\253\303\037&\211\370"
+	.string	"\211\225\352T\221\2246i\263W+\255\227\237h\210\001\031\332\312#\266\270\004\276\242\234I\327\352B|?\030zC\315\212\002\002\0342\013\202\004`\354\214\031'\272B\247B\037\261*l\024\316\260\247\201{}r\325\225\202.\005r\200\204\357Dm\004\031\004\006\370hyr/A\326\225\373"
+	.string	"=\245\343\017\350aLrS\256 3\247\210\245\031\0050\234\025B\030\r`2{\2147I\315\nY\234w\031p\343;z\331\013v\237\360\007P\033\376\275\025\214\302\201s;\\\300r\205\236\311{\236\205\321\013\201}\036\025:\366t\216\247\333\360\022\221\263\032\032AD\260$\261\310y%\301\352\2340_^\002D{\032\345\304&\034\335\226\247;!_S\204\262;!cg\375l2\323x\2359\325R\200o&\327Z=c\261\301\247\301\0059.a\243\310M5\266\013gb\267\342\363\035/,-\307\204-\f\226\034\270P\310\317\206\240\262\2673\256\324\202\340"
+	.ascii	"@\004\302`\212B\030\333\266\253\205<\357\364\271\346\370\304"
+	.ascii	"1\031\242\375\236\211\356\243l\267DN*\326\270\222\355\215\370"
+	.ascii	"\260\006\261rc<\b4\f\215\352\221\035c\313\245'\261\336"
+	.string	"\232\211\340p>E\333\240R\332\346\304\335\350\264\340O9\223\2447@\350\361\360\344\320\243\022\235\036\361\254\004\331\350\006\245D\203\033\001\226sl\303Rf\t\271*I7\332\004\"3\264>d\024f\331\032\024\216\031 \2064\033*P\004^\257\356\221\365MM\262D#\024Sq.B\315yZ\227\361\264\365\202~\246\nz'\361\006\310h2*\016U\351\231\037\306#YY}\246V\033\325\206\275\360\022\225\026\346\210\364\337u/\231\3222\355\244:\031\351\2423\334\356!\316\230chU\003\302\257\200\272?\020\266\tLI\027\334>\302\300\344\246;4\343\220\261z\3404.ad\215kd\340\257B\032\306\332\225\265a\371\036\372\021&\316\314n\200qZ\331uH\335\337\261?\250\037^X4\242\207\337}\312\001\b\365\036\r;\366\245g\273wWr\272l\001\3364\244\311\205u\212,\314\201\236bufS\343]O\373"
+	.ascii	"\3274W\343}\221\223d\217^\301\2232\204HH\013\326J\272\264"
+	.string	"?y\215\335\026kW\230\302z\023\331}\002^~6\234\031\260\374J$\314?\3247\270\033\r\272\345\201\367p\320\342\031\252\356R\032\3543\332}\230(\"`\302\223\200\240\235G\267\202\253j\250\230\301\230\003T\323\377\304\272\326\335,\211\366\001\360\221\316s&v\350\305M\257\030\033\006>n\266\343;4h!z\001cA\025\343\r\367g\305\362\307}jv\357$?\223q\370P\206\350^|\031\230\2279ux\331\231\215\020Y\003'\0207\033\3369jgA\335\372\255\303*\213\r\256D87\303\251L&.\237\230\3621<\315\023=@\350\213\002\027\030\f\3445\226R\321J\b\204^\355\247\221\221\334\307\201Q\345]^CK\333\351\362\034\2127Z\004\217cMb#J\250\243\024\211\036\301\346!\263\255\214\335-\350\307\230kz\262\004\006R\227\346\367\214rn\310\251\350\227\202\234\327\221\314-\311^\231i\374A\211"
+	.string	"\300\r\021@b[S\264\230\003it\220\214\255\020Y..D\341\367QYy\021\017"
+	.string	"\037\350\b\326Vj\366\250\213D^/-\242i(\251n\347ZT\201\356\312"
+	.string	"\320(\356\351c\037\023\344\211ZJU\214\236\305\\\336\342\"\223\214\356QQ\002\322\375Q\004\373\377\315\232\246x\371b&J\243q10\"\034\345\033\021B\311Q(\357\227!U\321\364$\314\213\301w\314\250\353\273\337~\033\364\372\330\350\307\320\226\030\314\316\264\t\216r\205\2463K\026\t\300\324\277\001\310\356\360\340\260\022=\212d\230`\002\026\0171\300\007\b\334\361\340ZmU\033\303\034\025\323r\212\223\023@D\362q\352z\312\232\325\020\003\343~i\323\033D\264\342\350\3212\016]\247\315\352\025]\270A'5:pG\271K\260\327\343}\034\024\363\264\026\no+\266\032\355\320_\316\206\234\323\bW\0270l\367\311`r\360HKU\221>\264\211\342*d$\363\321C\340\225\336!\201H\303<\361M\311\202_\333s\202\007Kp\3613G\273\271\361\b\361\3513'\263\025@u"
+	.ascii	"qA;\253\337\274\020c\377Kr\337\021y\336\303\261h\"St\031\004"
+	.ascii	"\3455\333\301\252\322\220\216\320\274:d\360\2053g\234\323\363"
+	.ascii	"Rw.\265\375\220\021\350\210H\372\260\311\301rT\200\223\220\360"
+	.ascii	"\262\024p\007\320\313u'\253k\351\300\022\342\221\357\371t9<3"
+	.ascii	"9\027v\"\034>j-T\252aGh\262\242\343_n\177({\fN\345\323J\002M"
+	.ascii	"2\311\201 St]p"
+	.string	"G\210)ZCv\2365\013e\274\317z\341$\300-\020\201\351\342\004^\306n\"\365\263qjDS\333\243\364p0\220\257\361\024\3771a\2669\311\221\357\247&\003\276nw\337\214tYY\357\202\315y_\0367i\326\372{S\002b\332\201\037\177B\2202\031\363,*~\354\354\313\033\2339\317\221\306\345\036?tJ\212\260\0021}\200\002\"\323\304.\340\263\373\323h\rt[\f]B\216Ab\226\367\335D,\r\342\232\"I\257\356\247\255AM\215\036\250\023_\216]u\334\340L\202s\232\307\274To\3149\276\250Q\371\247N\340*z\372\3160\202\305\001\007\342\002\003\332&\330\013dK\315\351Y\217\177\353e\200R\035[2\037\035\247\201\276\005[+Y\300\260\253\355\315\303+h\353\204E\257\344\303\354\375[\007\252p\"R\314\020\235\252\251\2103\355\177\3141\3419.\322d\210u\333Han\332\330\212\346Y"
+	.string	"9\200Km\2265S/\033\0273\b\227;\221\351"
+	.string	"\202\327Y\307\260ne&\035\350\363>\f\200P\213m\342j^M\325\020\273>\204\\\376>(\333\241\361L\360\265\360t\264\\"
+	.string	"\225"
+	.string	"l\266\032G?@\352o\367n\207\324,M\334\345\354\232N\177\274h\217f\230\362\253\002\222\0063\235\0214Hj\023{\263\004G\252w\320\006W\004h\005\007\3233s\243\016\033\314\271\351\306VqN\270\346\304\343\2473\022J\357I\007\205\254P\272\223\221\230\234/\030MGd\277}\254&}P\246)\017\356\264\030\324/f\250>\344\372\233\212\237\220\300u\225\331\265x;~I"
+	.string	"\352\356\f\237\203\345\214\363p\206\261\337\b\361$uU*\f\346\205;\332VJ \2022\321L\3342S\344n\022\r.w\200\031\2705\024q\364\306\254*[\362\362\027\326\363\260\241\bF\222\336'P\346\252x\332\266D\020_\265\213\214\301\3768K;@\266\341D\236\264\022\346\342\221WQc\255\210f\001J\233\231s\320\244iE!\361\375o"
+	.ascii	"\364}*\360\344\233s\220n\217u\350]0!\b\256\3056_NM*\315\210l"
+	.ascii	"\276\270\323p\035Q\f\263\226\022\317\203.\017\211\347+\305\036"
+	.ascii	"2\230\327\303\255,\033\232h\006\332A3\206\215\267\177\314\253"
+	.ascii	"mt\007I\246\336\345\276(\340\036\221\216=/\363\226\277e\311\002"
+	.ascii	"\t\201VWup\351\215\350 \343\331\260\357*6\264R\260\001\033\334"
+	.ascii	"\257\360G\321P\224\306ZV\317\t\226\231\203\252\276\273\327\200"
+	.ascii	"\370\236X\312\336\032\306\233`-\035}pz\255\363\351X\353\230\013"
+	.ascii	"\r\244Z\005h8\366\026%\306\355\272\352\356rE\230\332w\210\230"
+	.ascii	"Q@\022\250\001\026\3177L\026\032"
+	.string	"\266\030F!\303\b\n\201\320\t]\371C\3249+8E\360\203\334\364!\307\262`L\202!\001ww6\241\271!Y2C\230R[\222\321c+N\242\277H|\354\312\336\200\23748HB\013%\336D\227$*\032\357\266\275\300\032$\350\313\022D\232\260\317z_\"\345\303@v\300\235\0332\243\237\023\214ms\037\3414\216\r\253x\023\217K\177\001iO\023\327\341\245\004H\006\352S^\263\003[!\t\036\226\r\272a\222(\007?<\347\217\r\031\347\3204L\272X0\200(\341C\220\301\177"
+	.string	"\346\224\225\375\314\302T\306\322\313\0364\243\204\217\225\204\351\375<v\202\317Y\215]\323'PJ\320\021\311\260BqS{\250\300\212\335\035\033\020 \247\263\fy\244Rk\235\004\035\225\177\347\370\017\016,\351_lw\352CV\214\013\244\306\255\371<>\367o\244\213\304\362^\205\333\331\246%8\351\221\343\205h\232\326_q\313\257?\362b\354\270\372\025\201\337\221C\224M\021\241\202@\240W\302\224\210]\023\b\b\022\240\266c'\235\353\305\017%\326\3034*\357\205,\334\237@\b\251\2075\"+\230\206\233,q\346\252b\343\372\330\301\230~\326m\217\024"
+	.string	"\036q\017v"
+	.string	"\223\347\316[\266\341\226N\001\374=7AG#\351PA\260\343HE\201\026\3724\203\\\221\353m\330\026\202\362\344D\037\370\2216R{\242p\256\242AM2\220\332\0321\360\342%\0232S\341f\235sp\275\312\267\346\006\272'\203\314,\365\341\353>Q`\372\007}E\320Gd\277\353%\210\034\276\321\216\356^A\226\025\366\267\312\365v\346__\354H\027"
+	.string	""
+	.ascii	"p\253\017\235\255\377+\344\221\351\213\021\"\241\274\377\nY\372"
+	.ascii	"\245\367f\016\024\323\361|\362Q\331y\235\320cn&A\037\025d\327"
+	.ascii	"7\352w\316\367c\031|gh\346\322\306\217\255\255\rlab\343\302\233"
+	.ascii	"\207(\315\244\2571\324\253\345\331,\005\247\310\237\177\231q"
+	.ascii	"\336\332i\226\344M\244+#\rV\377\304\235Ti\223\225\"\310\273\211"
+	.ascii	"\210\356=EoH\254\013B^\005Y\270\267\245\250\300J\253\365\305"
+	.ascii	"\342\237\333{;G\242\024K\360C\217\0206\001\200\032\330\356/\263"
+	.ascii	"\na\033\354\337O@4V\376>q\344\002\252\032\177\304DQ\361\350\361"
+	.ascii	"E\275]C\3011\260\017\354\216]\232Y\242\341L-E\253\242\326\360"
+	.ascii	"\212\017MOx\326\334\232sW\317{\335\275E\3635\224sQ^\332:eB\375"
+	.ascii	"+\253\037\n\b\264\006\376\250Mr\007\r\373\336\037\214\317\353"
+	.ascii	"H\037\227\274\321,w\373p\013\320\357\332\354\037\312\024\rJ\376"
+	.ascii	"\r\333n1\037\203\350\177\220\317j<'H\237\017\253[P\027\272\360"
+	.ascii	"\261\031\367\037\3060S\3218-\026\356\353\320r\243:\037\265r\023"
+	.ascii	"\235\301H\005\235\321\205\347\r\335&\274\317\376\270\227\211"
+	.ascii	"\336q'\346\250[\215\347\263\231\205\273Q9\227su\255\347\346["
+	.ascii	"\375\343\331\375\324\357T\r^\265\350b\257\336\323\342?\263\217"
+	.ascii	"\363\267\233\246\003M\376\342\261\353\333#\003\274\216:\372\037"
+	.ascii	"P\265xq\177}\333\241\372}FKm\335z\371\021\317\225\204\232\243"
+	.ascii	"\303\227\334\327t\332M=\216\313\237\247\372U\364\305LY\371\306"
+	.ascii	"D\276\235\357cF\237sz\203\023\366\342\306\267*\277j\276\315@"
+	.ascii	"\270\035kFr\245v\251\364-h\236\244y4\355\257\235\373\220R\246"
+	.ascii	"._\372\317\366\373\370!K\2578rCj4\254\020\274/\0358[R\263S\271"
+	.ascii	":\343v\354\340\3330\210\312\313\212]\241`^\344\t*\256\363\323"
+	.ascii	"o\032d)\023\3309;\237\033i;\365\253\022\235cfn\354/Z\367q\332"
+	.ascii	"\303\335\327\371Z\210\341\343\216\350,\376\265W\331\205\341\356"
+	.ascii	"G;w&^\245\236\375ym&-\334\355$\013\261G\305y\b\177\345\001\302"
+	.ascii	"=M\322\021>\r.\310zp|\370\235\317\270"
+	.string	"\337\221\273\314?\001\3604}^u\374&\215%Z\217\331\265\036\262\334v.\317\n6\270\370\355|\242\003\207\216o\367\177\203\241\377q\3650\361\265Q\273\253\200[\024\227\311 \277Z\016\020c\227\007\363\220bnU\3577;\013u\266f\217\241\255?\272\373qz\234d\345\275\343\345w\304\326\251\214\321\003\003\035\3421\213V\3319\365\2651\277\350\335\205p\317\035\327\225\017\333\324WN.}\312\032>\337\261V\371\313\350\305Y\375\371\2271>x.\036\306}\216\224\262j\375E\276\336?\376\006>T2\254\360\210X.%\247\217X;!\374\227\"\377\241\346>\276\300=:\361\310E\223\241\237\321\211\034\266v\362\217idaV\016\217\246\364\033e\017a\247>\021\254\342\333\373\215b\202K\215\257\003w\032\222_\341\360\355\224)\326;\354\376\037(\276Zo\033\317\301\003\216\020\335\247r\033\330W\222;\020\017\326;\031\343"
+	.ascii	"\346\007\\\375\375\305\223\301\034\031\372\321\321\216\217\341"
+	.ascii	"\311'\237\030\334\276\376\333\373?zs\310\376\335\2723D\306\353"
+	.ascii	"\373\035c\330)\351]\333q\031o:\374E%\273U\344\236\341y\245\371"
+	.ascii	"/\334\271\\_@\354<\372\311A\237\023\211^\0340\242\374%yV\312"
+	.ascii	"\030\311\221\037].B\242c\237Tw.\230\271\266\353\030\236v\203"
+	.ascii	"\377d\341\013\306\314j\317{=\024?$:\253\204\037t\034z\217\366"
+	.ascii	"nGAwn\3562\374\2671\030\232>G\3618\203\275\333\366\333\346\333"
+	.ascii	"\317\271+\342<c<p\247R\302[\034\321*@\026\271\261\313{\371\311"
+	.ascii	"\217\271\026;>&\035a=:5\017\335s#\372i~\271\336/\264\213\314"
+	.ascii	"~\242\363\210\346\177 \261s\016y\274\220\232E9\203>^\337m\373"
+	.ascii	"\347\345O\2077YyV\307\267u*\332:\177\327\350\244\301\313\003"
+	.ascii	"\217\340\315\217\f\006 \326\b\267Ar\364\270\275/\3432\315\213"
+	.ascii	"N;\376\003"
+	.text
+	.section	.gnu.lto_.symtab.8052e9c2e6d81296,"e",@progbits
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"pidResetITerm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"r_weight"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\004"
+	.string	""
+	.string	"getThrottleDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"getThrottleIAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"getThrottlePAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8052e9c2e6d81296,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,519 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 \241]\003"
+	.string	"\224\004\225"
+	.string	"\013"
+	.string	"\247\330\205\230\006 \002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\003\005\002\005\002\001\352\263\360\321\b\005\006\007\b\t\357\330\360\251\017\002\n\350\300\306\254\005\013\354\206\342\366\006\f\222\252\354\340\007"
+	.string	"\r\240\342\234\212\n"
+	.string	"\016"
+	.string	"HH\231\342\n\032\314@; \f\234Hi\006\"\334|\260{"
+	.ascii	"\013\340\036\341E\214\r\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 5\035\001"
+	.string	"\240)"
+	.string	"\005"
+	.string	"\001\001\t\001\001\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003"
+	.string	"\006"
+	.string	" \006\334K\231"
+	.string	"q_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 \356\345\003"
+	.string	"r\205\024\"\240'\351\036\344F8\366\201\213\013!g\235\263\341\351\253\345\326B("
+	.string	""
+	.string	"\fL\bi\256\265\266%I\001\0072\363}\361\306\232:D^3\204\344,\375\364\36410,\324j\315\372\351o\330\353\232\231\251<\324\327p\034"
+	.string	"}\214*($\024#>\231\021\021"
+	.string	""
+	.ascii	"\r\334\005\3268\212<\200\f\234\200\312pQfU[H\002/ \\\355I\340"
+	.ascii	"e %.Kx9\025\336\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 ^E\002"
+	.string	"T\003R"
+	.string	"\005"
+	.string	"\001\001\003\177\002\006\002\002\006q\001\004"
+	.string	"\001\300\004\001\004\300\004\001"
+	.string	"  \t\004\177"
+	.string	""
+	.string	""
+	.string	"\300\004\001\377\377\377\377\017"
+	.string	"\n"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"N\tz*\0174\006Dn\036"
+	.ascii	"\330\261\2016"
+	.text
+	.section	.gnu.lto_.pureconst.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\t\230\004\n\204\004\013\204\004\f\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 f-\002"
+	.string	"\304\002Z"
+	.string	"\004\001"
+	.string	""
+	.string	"\003\002\006"
+	.string	"\001\002\006\001"
+	.string	"\002\b"
+	.string	"\001\002\b\001"
+	.string	"\002\t"
+	.string	"\001\002\t\001"
+	.string	""
+	.string	""
+	.string	"\t\n\001"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"_ePsLQ{(\3068kCQ\330\250\363\026{7\200\005"
+	.text
+	.section	.gnu.lto_.lto.b3ae25589f920bfe,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.36.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\345\013"
+	.string	"\266VSB\020q\233\0168hJ-\020\262\264\313\321\213\020\252\337\324X\"<$)\342\017\251!9\370u\217\217\257c\372c\035\025\266\\\273n&\200Z\"@j^\006\316\234\003"
+	.string	"\376\031\232\360\301*\372\223\275\245L)@"
+	.string	"@"
+	.string	"="
+	.string	"\021\236"
+	.string	"\365\350\316\266a@C"
+	.string	"\226\221\212\034\273k\251\311\273C\315\316\007\340\205\016\253\017W\210\240D\204\216\001\236\bjd\254\214^zr\360H2/\234\335u\222<\017w\274\355\007\266\035\330g\020\177\204\351_\224e\264\242\300\213\335\016\247\035\273\022[\234\370w\315\264\377\2221\266\277\020\270*\020`\334\300\261\373%xt\203\352i\377\344(\335SD\354\261K\"\006\213\335o\201\025T\217\232g\250\007j\223\207P\224\336D\3034\203$[|\215Ji\326\330\200Bt\323S\210\370&\234\001\224'=\372 \352\361\372\3223.NB\240\200\030\311\223\375\205RK\330\207\273\273\326\022\373\337M=%\227\007\373\230\020\267\b\227\007\373\340>\227\246\201:\002\334\331|2\214\303\266\f\304\342,T\300.P\260>\230\004\217\325\3216ks\300\031\310\245Y\\\226i\026\346\333sFT\004\253\214jc\330\362$C\r\275e\304I%\021"
+	.ascii	"2\003\302\260\306\204\275\032\b\017{\t\325*\b\314B\b\207\212"
+	.ascii	"\201\244\202F\327\354,\334\215(\np\352\364\270\206\233\022\217"
+	.ascii	"\306\240\366"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.37.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 \350\205\006"
+	.string	"\"\214-4Pm\222\016$\223\346\261\0340\267\324\335:\nd\26705/\337\224\354\252\375\273\035\346\332\236\306y6\213\343ff\212D\334K-C"
+	.string	"\203gXl\226l\231\002k2\233GYT\347q\234\345\320@=0\270\r\245"
+	.string	"\3414U\307e\004~\234\205\312Y\357U\016\223e\033\t\033A\250I|A\032r]\216#<X\254\323\365"
+	.string	"t\302\026`\021\302\322g l\031_K6\322\217c\273\220\230\f\234d\212J+Y2\215t\374\237\307|\200\360\371j\266!*\006\312\204\210Jf\346\232F\257\342u\373Q\213\307E\n6\002\025/\t\2319b\243\212\336\372\027\374\006?E\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitude.38.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\362\214/4Pm\222\016\244\221\252\032J\006\250\254\225,\002\344\032\201\267\344R\224\371\035kw;\314\265=\255\207m\026\307\315\314\024\261\202\311\275FLl\333\373\337H#D\246k2\233\212\272\250N\305\211\327\202\002\305\220\0207\324AC\324X\235\230\021\270\342 X\361\252*+^\266\354\356aB\357\341\033\322\r\273\033;x\\\263\302\353\231\n\335\263L\204\334\3507\220{\030_)\337\305\357v\257\":\031 \311\214\030\245\244\t\034\341\370?\177\271\036\375\370\214I\233\2066Y\240@\210\21023b\0320\025J\005\230\n_F\261:\354\026\244RGEI\246\201\352*\006\231\271\3134\211\376\372\023\374\005?E\b"
+	.ascii	"2\003\3020\021\341j\327\304\333\b\234\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getEstimatedVario.39.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 \325-\006"
+	.string	"\264\nx"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\317\250\270\004\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\002\005\001\006\025\001\020/\200\200\200\370\305\207\377\243\006\220\250\300\002\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307(\341\224\n\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302^\025\220k\3704\242e!\310pWL\355$\003"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.part.0.50.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375`\325\ne7"
+	.ascii	"j^\234\024D`\346Q\007\223&7\265\231@{0\262\317\b\251\340gv\254"
+	.ascii	"\253\236\036\200\\c\243\003\336\330\251f\213\232\373\031S9\312"
+	.ascii	"Vo8=M\345\305I\327\036\204\022\351\2460\030h\245\333\307G\356"
+	.ascii	"\266\367\336;\311\224\002>\001\034\0015\001F\342!'P\257\030c"
+	.ascii	"\023\223b\214S\242\320\234\263\t0V\275\365\245_"
+	.string	"b\362\231\301\0344\237UBtAC\033\320D\2532\266\241\365\263f\320\300\312\267T\365\026\203\006G\337RE\274zf\034\f\232iU\006Ih]u\263\326e\211\221f4\013ln\320\234\237\b\\m\bmc\354O+\277\"#}f\256\255\306\270\333\313\334\312\321\257\310\350\\\316D\322\244\345\374T\340j'h]%:pu5u\337\352j\267S\351n\253n>\376\374\312[}\354\346\2034\203\350\316r\313\240\234s\223\253\217\304\217\216$\f\002\177\276\336\221\021oWD\244ss-\273\252\351\343\341\261\375\312\221\204ca8\bl\302\004\377\306\334\007\266\004\367\216\222`#%_\230\007\003\b\264\n\034\221\034J|'\304\013\027\t\t\202\211X\tDrt\271n\211H\016 \356\002\371\201sO\266|\340\266m\253k\351\311V\023\263\230\311\325\303W\227K\207\253:.eJ\3149kq\315\300i\333\303?="
+	.string	"U\013\264\343\302J\2018\2320}\315q\026W\022\343\236\017Y\t9\347v$\2317"
+	.string	"\357\366&\335M\325\235C\022ec_\352;\333\374\277\350\303\335#H`g\376\363\224@\336`\375U\277\373\027!hZ\372\376K\262pA\363\357\354\356\252\025\377\t3<IL\250\215p\352Nk7\212'\354L\374)\304\236p\320\344_\265\177{\033w#\243\035\254\241\242\2603]m\217Z]\3655\357\305\321\343U\326\205\304Q\374\316\376\241\247\371\215t\267\270\013\270\270\231\\\334\004\\\334K.n\242\213[i\200\213;)\305-\300\317\274\003x\027o"
+	.ascii	"\303\0267\222\260\305\035Lq\003\177\276\024wo\305}\264\3426r"
+	.ascii	"q\363v\016\306\273(\207\233(\207[\327\342vY\3349\177\275\333"
+	.ascii	"\0257\273\342^S\334\252\217\361NS\334\237\342\306\376t\367\007"
+	.ascii	"Lwx^9\343\210\032\312C\3241aN\306}\214\373\353\016\306\275\213"
+	.ascii	"\373\231\273\032w6o\273\275\335\214\227iG\343kZ\247&M\232~\211"
+	.ascii	"\271\234\331\334\322\212lg\316\364\273\276\375\030$\325j\351"
+	.ascii	"\326\271\352\355Z\254\332\271\270\027\017\343iN\306\327Zgf5F"
+	.ascii	"M-E\230m\036"
+	.string	"\340\263X\263\260\345\253\343=n\035\316W\326\341|\300g\261X_\313W\327>n\0218\204\350\362e\021\370\357\263\366\370Q\333\346\236\264\032\375Q\241\f\307(\033\214^\205\303\006\256I\364\316v\315\300\226\257[\204!\016\215\345\233\353\327}\200\241\023!\032\215Kfu\367\353t\240\370x\246\273\347\275\257\361\fl?\242\3127,\035\321\027=.\263\214\323}\2539Z\357\2229#\231\210\336\225i\334\327\375\227QBs\357\276\357\370Qg\031\207\304\321\347;\333\217dkN\212\003:\222\265o\271W\272\001\346UF\305\375\030\005t\037\313\274\317\361J\360+\347\354\300\315\241\023\332\301\\\355\n\027.\254\256\266\377X\326\310\254 q4\227\264\262\357k\236\243\203=i]\237\375\306\313&\026\216v;\036\317\223A\303\206\r\253\253\353\213\260a\310\253\254\211s\316W\355;{W\304\307\362]\335\253\326\265H\215\345\373\336\346"
+	.ascii	">K\027\247\271|\327\364!\034Z\276\217\300}\237\245~\217\250\376"
+	.ascii	"\017\n\224\035\342\356\016\036\2603\323\027\236\211\255A\334"
+	.ascii	"\r\"\004vf\357\316\202\364ZN%\360\211\022\370\004\013\265RM\031"
+	.ascii	"\213\037\246^@\265T,&H\025\235(\350\250XL\230z\221\341\t\206"
+	.ascii	"\323\n7\205:\005\342\251E\324\007*\027O\305\242\021EQ\243X\340"
+	.ascii	"B*\212*jJ\352E\023\325\n\250(\026*\232\\D9\265hBQ\234jZ\220\324"
+	.ascii	"R/\236\212MTRR\305&\354\251\277\221\226\200|\254~O\221\206<\304"
+	.ascii	"\366\2205\205\006\264\352\004\205:X5=\300w\266\222\326\225_\001"
+	.ascii	".c\222c\2303\3750}\201\1776\3126\004^\351\231^=\244\364Zz\342"
+	.ascii	"\023x\202\325\257g\274\364, \245\023\341\023\237\r\243\204\016"
+	.ascii	"\370\244WzW>\031~\322{\263K\220\022\352\023\020\340\001\274\200"
+	.ascii	"\027\321\345\266l\"\375\357\207ZH\377X\346\004\337\367\302w\245"
+	.ascii	"\023\033\301O\322\372\362*\353\2651\345\214\275\365\233\234\363"
+	.string	"\021\360+`\032\300Op\247\211|\346\234\215\336\331\203\334\340\374\211s'\211\t\361\336i\307\333\343\260\222\025s3\366\366K\032\227\034\303T8m\340\232\276o|\205\221F&\307\260\260\325U\265O\033\262&r\327{|\304\343<Z%v\204\202\235y\204\262\272\332{\0167\364\024a%Y\276:\267\343\270\3656_\003\200\347\250\201D\004\215CB32R\220\202d9\220\002\021\252\252n\021P9sPF\322$;k\353\021O\363~\317\334[:G\005Y+pk\023\216,\227n_\325\221a&W\267\327\203\266\334\244R\b\243\265\325%\211li\334\3449\354h\273\016x\332\350\377-<\221\313\242\227\347\203{\275\332\006\2337\037\334Z\263\245\0346N\260\022\031\232\272\364e\374L\320\307\355\363\334\332;\005\022\037\3126\247\351\020 \320\345\343w\350\231\234;1C\341 6\265\004-\024\272+\375\332\307[\3306"
+	.ascii	"?\323q\003*\\kC\234\377\023/\321\212Pt\2776\032\261\017\0305"
+	.ascii	"e\357\307\357'\371\016\fA$`Kz\371\340\310^\223\367<\356\rl\271"
+	.ascii	"\204~\f%\276\211q\215\365\335z`\353\312\234\253\376\204M\217"
+	.ascii	"\024f;\025\321b%?\027a\370\232\304\261\027e&Zd\376Y\035x0b\023"
+	.ascii	"\334\nc\267~\302\243\030V\n\031\236\352]\004\300\306\026\257"
+	.ascii	"c\030\252\021j\013==:\007\305\277N\001\365\210\267\356\273\013"
+	.ascii	"\374$L\021\376\n\365\354\255<W\216\303y\202\261l\332\344o\003"
+	.ascii	"\307`\344{\251\352\300u\257\316e\216\344\201\212\022s\2031\374"
+	.ascii	"\361\233\210\363\030\357\312\n\242\346\212\321\333\344.\247\245"
+	.ascii	"\336\333\346\240\227\201\306!p\035\211't-s\220\3358S\302\335"
+	.ascii	"\003\341dr!\306\204(\330\322\217\327\222\200v]H\307\n\270|.E"
+	.ascii	"\032`>\022E\334\317\242\324$\325\217b\n<Y/\353\365{yh\223>\253"
+	.ascii	"\304\377\3204z\263\033W`g\273\017$\216\306\372#\376\274\317O"
+	.ascii	"\367\020\210\275\217Mt-S\fy\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"E\006"
+	.string	"\364\bt\001"
+	.string	""
+	.string	""
+	.string	"\0022\177\n\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005(\013\200\204\001"
+	.string	""
+	.string	"\003\005-\f.\r/\016#\0170\0201\021\"\022\002$\177\023\272\200\202\002%\177\024&\177\025'\177\026\005\020\027\201"
+	.string	"\001)\177\030\377\037"
+	.string	""
+	.string	"\200\200\200\001*\177\031+\177\032,\177\033\003"
+	.string	"\016\304\006\003"
+	.string	"\021\250\270\275\324"
+	.string	"\001\344\001\003"
+	.string	"\020\304\001\003"
+	.string	"\017\320\360\372\250\001\001\204\001D\003\t"
+	.string	"\310\377\241\372\001\001\202\001"
+	.string	"\027"
+	.string	"O\225\3175\326\325\f\003\324\003\200\303\007\310\213K\231O0<!\033\254\f\350\001\376\354$"
+	.ascii	"\334\270# _8\004\f\f2f\3118\250\304\240a\025\301\233k\226\001"
+	.text
+	.section	.gnu.lto_.refs.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375 Y\r\002"
+	.string	"\222E\017\025PU\322\03003\275E\247\252\3613<\205\030wcC\254L\001\257\022vt\260[\301Jj#\265\220\332\207\262\343\334\240e\320\013Z\205\262\211\263\b\372\020x1\033\314\005\300\333.\237\004"
+	.text
+	.section	.gnu.lto_.decls.b3ae25589f920bfe,"e",@progbits
+	.string	"(\265/\375`\323\rUJ"
+	.ascii	"\032\203\310\034U@\322%\245\003{a\371\030\244\263+|@k\232h,\222"
+	.ascii	"9\334\214\362L\301\240\355\033\260\227\264Z\302\262\370\272\327"
+	.ascii	"\335\370\323\177\253w\234\250C1U\327g\372\237\037-\341\314E\265"
+	.ascii	"L]TU'\3667\354F\302\250\255\r\201=\245\311\301\330\304\314 \020"
+	.string	"D\310\226)r\001\272\001\307\001mw\361\312\311\220\030E\260\330L\361\326Ee\325\262\273\317a\177\356\214\0043a\261\263\310\261\213J0\334p\211\215\247\265\356\306y\361\342\005#\351q\303\023*zn\365@\365>\225\207`\"\230\3710nr^\302a\177)\266\315\325\3354<5\204p\352\2427RQp\341\207\245'A\325\341\233\024\035A\215\361@\375\030\005\352\317\370&e\037\030\t3]p\222\263\027\023y\313\260\355\366\376\310rd\353\242\207@=\273H\317f\223]\244w@\275\254\"e-\336b&\013\356:\f\031?\205Z}\325\335\322\310\264\ri\213\342\242\357Q\377s]\205V\313\370\213zf\221r\223Y\244\277\352\215U\2447\276\311bA\323\346`\222\272X?[\361\325\316i\\J\266Ww[#\203%\nQ\310E\337\362M\252\262\212\364Q\376'\371\377\344\377\022\377\241\374\3742\343\177\327\003?\023"
+	.ascii	"\3643\003\016\374\214\363\363\363\216\214\r\376w\360\377\203"
+	.ascii	"\377\t\374_\340\277\334\342\377\375\257\005\r<\200\3767\306\377"
+	.ascii	"6\216\3613\214\377.r"
+	.string	"\177\371\331\347g\334\317<?+\3603\002?\037\360\363\212\237s\376\007\360\263\315\3175?\317\374\034\3633\314\317\351\317\350\317\377\177\366\277\311\377\265\377V\376\247\375\237\362\337\354\277\320\177\254\377W\377W\374/\342\177\332l6\233?'\377\223\346\207\261\t\005$\321M\203\324\023*\020 \2062\\\364\277N_H\267\260\246\333>\032\271\242\204F&\024dM\333;\004h.\2516\266QH4\331\267\333\346.F!M0\266\311\243\261M\no]L\n\273[\344\315\3505\024\262\221+\ni\344J\"k\272\330\302\346\032\356P\213I\244\321\210$\362f\344\032\"\215\305(d\315\fR5\210\325H\213\262b0c\261\233\230\240\206\307\333\230\261M\266\224n\366\242\321G\003\272\241\222G)C\030\370\2138\326DL2Lr\333\3359LDe\262\213c\306 \311\356 \304\243fj@\330\216\365\024\217\t\245\240z\211F\367"
+	.ascii	"L\335B\356\261\356\026v\267\313\021\252\355\216\341f\\21u;\341"
+	.ascii	"05\224\020\214F\367\365j\342\013i\344R&s`]\\\313f\241\025\362"
+	.ascii	"\262\245D\035U.a\221^\352nvB]\"q\244]t\355%\212\023:\274\226"
+	.ascii	"\250\374\004\2531s\207\255\304\fs(A\002\211z\336Iiv\234@s\261"
+	.ascii	"b\242\364\272(\243]>\343\2643\032W\211)2\032\332=dn1\303\334"
+	.ascii	"\242%\f\207\341V\212\236\231\352\317T\\\250E!\220\\Ma3*'XS.Z"
+	.ascii	"\306Kp\023\314\004Ka&\233q\022"
+	.string	"g%8\n\021\0302\330\214\213\260\221\263]\272\030Q\0369S\002\004\37703\274u\221Hd\311_\177\016,\3531\330\214\205`\262\263\3101\0032\254\263\366l\306G\370\207\263\375RY\330\362:\353nq^\2505\2464)\306\240\234\344\233\324\206\201@\301\211a\252bK\273\350\231\207:\306G\360\023f2\022l\3049\b\376:\0329\264elk0+\330\260\325\203\252\005J\020*\037\216\370\361\343>\341$\317*gelB\\\224lN\210R\352k\250\341N\261V[\f\313\235\263\207\032Qh\270>~\247d\324\230cYX\322#n\260Aq\321\267@\361\340\301X.\350!rg\210^\302\312Z\037\211\3409\243\020\353\261\244l\206\031\256R\2755\221\254\271l'\250\235\231$:z\300\240\274Q2@\260\256t]\364\322p\223\314\314\271;\322|\020\221d\252\n\335\234\223r\263\3119\351Q0\031d\270P"
+	.ascii	",]\272\224X\316\322\034]J\230@\211\245+d\371\030r\245^\247\353"
+	.ascii	"t\237.h\373\006+\313.\232\025\225\332\325~\237\030\355%\007 "
+	.ascii	"J\364G\016\346\315\301bh\333\310\016\232\240O8^`1\235\227\356"
+	.ascii	"\250)KtI\375\231E=\017\337#\222\305t\212m#E0k\236\237U\324\237"
+	.ascii	"O\324\333\324\304h\334\366\r\240'8\332\326\316\037\226\226:\310"
+	.ascii	"\242\261\262\203\216\037E\214g\3465^\033\250V\013g\230:l|\255"
+	.ascii	"u;\361\304\354 \222\345tk\340\3004Q\261Z\272\350\317*\365\247"
+	.ascii	"\017\365\2774\230\227\006\033a\255\276\001C\304\022\303r\255"
+	.ascii	"\233\b\236\026 \266`\310!\213\372+\344K\274}\213|\005m\257\t"
+	.ascii	"\304\312\316\372\330\362\374RQ\177\235\250g\276\222\262\335f"
+	.ascii	"\343f\332\315m\362\306\261\235\216;g(8\212s\026&g\341&\367\261"
+	.ascii	"\333\251O3&p\264\255\265\223\323\016ZU\245%k\243\022\323}\325"
+	.ascii	"\335+f\256\302\316\260\\\364j|\345\377\313P\230\rk\027\375\225"
+	.ascii	"R\177\207\234\366\360\330\335.\264\264}$\306\244\334\3022|\262"
+	.ascii	"\001}>k\221\022\313c{\021\004\335\254=\242\024\220\200?#\340"
+	.ascii	"\232D\300\217p\300\225]\221zVv\355%!\375\202\200$\360z\272\240"
+	.ascii	"\037P'A\220\227\023\004\376\202\2765\350\362#\234\006\037` \324"
+	.ascii	"\303\256;\240\216\325)\201\350\327\013Z\201\277 \244\225\r\246"
+	.ascii	" D\363\343\001u!\324\260\353\316&\310\273\25551>\301\244\335"
+	.ascii	"\214L\016\307\366\"\370\001u$\320\260\253\020\273\006\215\214"
+	.ascii	"8\320\325\354|<$\240.\005\233\376\b\267\343\031\371~DC>%`\017"
+	.ascii	"Q\001\301\235\256W\301\312\352\330 \314\f\f\334\007A\245\037"
+	.ascii	"\357\204\025\230t;\213\001|p,P\227\204[\213\224X\036\333\213"
+	.ascii	"\240heuH<6H\301\312\352zJD=\035Q\213\023\361\200\253o\335\251"
+	.ascii	"o\340\207\201\037 \024\\\0164\303g\206Oz\240\031\271\334\214"
+	.ascii	"\237\234\372\237\034;\024\004aE\342\261j\357\367\223`\250%8\244"
+	.ascii	"cu\023(\365~B\301\244]\r\373#\\0i\327\363\343\331\374\227\264"
+	.ascii	"\002{\330\337\017\330\223\202\355\351\316"
+	.string	"\340\220\216\350\247A0i'\303\352z';\004#\006\353\343\271\370~\275\363\250\327;\213\3265I(\305\032\004*\375\202\212|J?\340.\206\035\372\311\251I\277\242#\224\035\002b}<%\227\347rA: l`\201J\204\363\375x,/\370K\352a\217v\274\236Q\217\217\247C\352!\002\006{p+X\235\020\222\222/\265\262!\223TB\244\330\203\0212'K\304!P\351\222\020X<\b\271T\350\221'\037J\036\356\223\004iK<v\270S4R\222<\226t\020\273UMUjA\232i[\032\023\354\002\271\222\302\b-6&\027]km\234xh\272\350ry\241|\270Y\350R\266p\246\026\2230IB\201\003\016\227\n'\201\004\250\2014g\2204\"23\"2\322&\303\001A\005\204\030'\255;\017\021`\255\223Jh&I\206\355\3358\266W\021\312\313\203A\264 \3070\330!\311\237N\267\033\247\300"
+	.string	"@Z\361\250\336\364I\002\006\034x\034\261\251\210 \004)\372s\346\323=\036p \366\366\337/\374\024\225\273\214\355\013\311\2633\236\346\340#\353\211\035\305\255\374\255\033\333\023\263\034\353\351T\230\224n\374 iA\224nfg\303\254\303\311bo\007\343L \301\237"
+	.ascii	"gB^"
+	.string	""
+	.ascii	"\007\374\033\f\362\035`\004?\346\333\031\206\031,\225e\346p\260"
+	.ascii	"\361\237\005\357\314\227d\214\023kX]U\336)\270~\n\210\231{}\027"
+	.ascii	"\222\252\371\256\212\254\367\341MV\024H\365:\241\240\372\032"
+	.ascii	"\303M\037;\310~\302&{\177\024\245\234\\\375rT\323-~;\213\370"
+	.ascii	"\204Qy\220\373\227\303\003+r\005,9\235\r\333\035\357'\344JX\205"
+	.ascii	".\372\025\0164<]V\364\312{\226\021L\275\020\362(\034'\336$\177"
+	.ascii	"&\300\271\332\315&O4rZ=\274mw\304N\237\324\032\375\202\240b\310"
+	.ascii	"\017y\216\355\"\021E*SP \362o\222\241\232\216\371\246bd\272\241"
+	.ascii	"\322HN\335 \301\210\370R4\034z\013)1y\221\264T\326v\034P\002"
+	.ascii	"\274Zz\332HR\335\362\251\261U\337\036\370pS\006\3457\220\032"
+	.ascii	")\305p\215\035\253\266\326\356{}\305q\304\310\271\264>\365\353"
+	.ascii	"\250\001\217\263\033\365H\343\2221\333\327\3078\250\330\332\376"
+	.ascii	"\206WSp\340\3339\030\304q\222 \022\301\372\0337\315\254B=\234"
+	.ascii	"y\324\221\333\376\351\r\212\376\351\324\312\230$\247\310\277"
+	.ascii	"\210'T\322\007\225:\315*\315,A\016bQ@\376o\204S\360\227\020\206"
+	.ascii	"e\246\212`(\335\312\202#\311\266eSeKj\007\200\277\306Z\273\016"
+	.ascii	"\324?l\232\343l\274\n\276\241N\034\270\275\363O\216\253\276+"
+	.ascii	"7\303\rc\007?\367\216\334f\347>\317\025\034\366\227\237QW\001"
+	.text
+	.section	.gnu.lto_.symtab.b3ae25589f920bfe,"e",@progbits
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b3ae25589f920bfe,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2027 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\350\002\035\020"
+	.string	"\304\025\334\003"
+	.string	"."
+	.string	"\334\301\274\312\f\f\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\346\252\251\302\017\004\002\003\002\004\240\342\234\212\n\005\266\233\207\357\004\004\002\002\002\005\002\003\002\006\006\b\232\242\313\204\f\n\002"
+	.string	"\004\002\007\003\002\004\t\n\013\340\216\253\313\016\004\002\b\002\b\r\243\230\366\360\007\b\002\002\t\017\240\367\360\225\r\002\020\364\320\211\371\007\n\002\002\002\013\002\f\003\002\004\023\024\206\353\317\360\016\f\002\r\002\r\002\016\002\017\025\352\263\360\321\b\026\027\030\350\266\266\364\b\030\020\021\002\020\022\002\022\002\031\227\257\311\336\r\033\344\362\241\220\b\020\002\023\002\002\020\034\217\372\237\340\013\212\001\002"
+	.string	"\002"
+	.string	"\002\024\002\025\002\003\002\026\027\003\002\006\002"
+	.string	"\002\030\031\002\031\024\002\032\017\033\002\017\034\004\026\002\026#$\303\335\257\241\013@\002\002\035\002\033\002\007%&\263\263\236\331\005\"\n\002\n(\342\201\222\246\004\002)\230\227\377\334\t\002*\257\260\211\347\004+\265\371\317\206\t,\362\324\245\255\006-\303\306\351\344\006.\320\266\271\326\t/\374\234\315\270\0130\227\213\266\256\t1\376\312\360\275\b2\217\240\261\222\00434\247\336\216\365\00156\302\234\216\234\01778\235\307\214\342\0029:\240\342\234\212\n"
+	.string	"T\250\321\241\300\031\t\324HRR\316\034p\002cU\334\006\022 \304:\r\021\232\211\306\322p\375\337\006\270\371\345s B\327\245\2400\3514\021\224\203\301\343`H\206?\272\300\200m- "
+	.ascii	"\024\353\200\330\370\\3}m;&NK\365\330\263\336@\034H@D\017\220"
+	.ascii	"M\364\211\357t3\277\260Q\266\312\335\366X\376w\236\317|p\336"
+	.ascii	"\346\315\233\3428\377\242\346^\300\201\227\035\200\202\366\005"
+	.ascii	"0|Q3\260\3467\\\227\303/\024\324\251\2161r\360\246>]\272l\342"
+	.ascii	"q\2720@\222I\230\355\260\375\356\2545{\213\377n\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \341\305\003"
+	.string	"\324\003\325"
+	.string	"\021"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\001\002\001\002\001\005\b"
+	.string	""
+	.string	"\013"
+	.string	"\001"
+	.string	"\001\r\003\017\002\003\020"
+	.string	""
+	.string	"\024\030"
+	.string	"\001\033\001\034"
+	.string	""
+	.string	"$\001"
+	.string	"\001&("
+	.string	"\003)"
+	.string	"\001"
+	.string	"\001"
+	.string	"\032"
+	.string	"C\t\2203\224L"
+	.ascii	"8\200b\211K\036?\t\337\274A\261\353b\323b@\247!\316\002\260\001"
+	.ascii	"\315IX\231Ol\\\030\b\246\031\026\004\022s\340\237EX\202\274\204"
+	.ascii	"\261\001,"
+	.text
+	.section	.gnu.lto_.inline.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\220\003E\021"
+	.string	"F\027WE\020\315&\215\001O*\347\027\317\265W\265<w\315\314\324_?\210\356\254\n\362\2422\363\306\306z7\330\316b<|~"
+	.string	""
+	.string	"\034cm\365\022\001"
+	.string	"\232\""
+	.string	""
+	.string	""
+	.string	"\nR\241\036i\001\362(\263\320;\rI#R\312\024<"
+	.string	"G"
+	.string	"M"
+	.ascii	"\032\002\332\277C\363|M+\002B(z?\237\364-\210B\b\241F\0231|\b"
+	.ascii	"\265\304\025l;'}\317e\272\226\364#\301!\261\375I-\304\325\215"
+	.ascii	"H?S\032!\256`\031\237q\026\003\353Y\262\030\300\316\314\304T"
+	.ascii	"2\222EQ\301\350h\f\310\222\306\270\250Z\242\271\317\253\340a"
+	.ascii	"\203\211\020Z\334\027\244/Ok\202\265\240\306C/\264\274\264\272"
+	.ascii	"A\211\322\035\b\023l\350oj\243\n\013\n\215?\244O\377mG\020\252"
+	.ascii	"\363\362X)\323u&e\311qyi\"\352\2458a\363"
+	.string	"1\022\321\006)+\0328\346\320\032\034\223\222\003'-QBs\363\361\306\\\346m\207\235\234\236\016\005<\022\\\002\016\220\027\032\312\225\236\t\017F(\315\020c2\335\030\240,\377\221f\377\207r\265\222\272 \204\025\033\370A\262\220\317\005\3625\323\264\016N6P\310\025j_!F\360\244\311\004R\252b1\200\345K\214+\2062\210=>??F\305\211\366#\312\341\345\245\250\215\376\216\004Y\250A\271R\202\251\242\231\326)t`\002!bUw\022\340SMErJ \255h\206&PX\\\255\035\370\347\307\ns\264\003\274?\271$\017\220\335\220:\b\364|\202H\316\264\264\033\b\371\314\013u=\321\232\320U\232K\317\213-x\003)\335\031O\245\3447\247'\"j\275\371\340\345\353Ld\237\236\232\301\360\304\301\226x\332\352\033\365\036\330\3522\221<ns\2071{7\207\327.\240\001\250k\341\3076\304\252\027\013"
+	.ascii	"r\020\324\002\367\305V2\367C\001\245\020\337\313\234+\220\307"
+	.ascii	"\326\263\037\226\251nd\320\030\201|\031\007\322tY'\230uz\277"
+	.ascii	"\374J\316\\\223\032\330\247\312\bso$@?\035XV\007\253\035&\024"
+	.ascii	"\3576\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`,\003U\r"
+	.string	"\006\02184`U\223\341Tq\350\022\334\361\001\353\031c[\227\337\025\226"
+	.string	""
+	.string	"\227Pe\004\243\271-\303\006A\020\244\214\252\273\030Z\f\270\352\352?\310\352\272Hw\334[&\031&"
+	.string	")"
+	.string	"/"
+	.string	"\221y\240\325\275\323h\235\025\225.\322\265A\f\231\3228\245u\310\254\342\254\212f\325\214v\236Vv\335z\"\220M\001e\025-]\215T\230\246\212\242v\031\255=\230\352\246:\351+=H(\275\367\036i\300\361\236;7-\031\021\360\315\034\026#\001\002>\300\003\270\177\274\307\013\264@\233\316\2463\341L8\324\2044\241\367,(j\032h\335\025\364\342KK\370\322\372z\r\023\303\302\347\203\271\024\001$)A^H\022S\240Rb&\360\231vM\\\3062\2275\310\325m4\245\275q\227,\344\035K$;\214\b\212\032p_\250\021I\314H\002\005-I\232\003\200\002\221\262\253\007\022\200\322z\bJ\b\005e\201\002;\205\375\030\003\264=\307hg\326jq\326\346\366\315\350\370\256\270\214$\005\221F\201\352\257\351)\323\3576\355\021\345\024\013\306B\302\365R\254\022r\355\355\025\312\234"
+	.string	"\350W\210\222\026\021\226\263\343\212\255\254\341\240\2211\003\360\3256\224\265\t\306\262\256J\203C\327\376\342\037\215\256\265\277\350\300!\177]\fNX\3236\221\243hO\310\2656\020Arp\300\357\211\006\316\345\3418\2664\244y)\236%\004\201\362\215\242M\242Z\3517d\205\204\002\351x\273dN\264\262\335j\314\300N$\002(\t"
+	.ascii	"$\r\301\342\242\250\0074\306P\001\367\004"
+	.text
+	.section	.gnu.lto_.pureconst.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\005\230\004\b\231\004\013\230"
+	.ascii	"\004\r\205\004\017\205\004\020\230\004\024\231\004\030\231\004"
+	.ascii	"\033\232\004\034\231\004$\231\004&\230\004(\204\004)\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"M\007"
+	.string	"\"\212\037(\220E\031\016\363'\276\373\204A\305\274\377\377\352\376\267\037u\237$%\317f\254\375\266\260\251N\300.m\340\273m\237H\231\002O\322D\251HkB|\013\252\234\352\234t\375+~JH\244\022\361\256\3341R6\256\252\016\244\253\342a>\345\217\201Qy\324\371(\177m\230\243\363\265\204\331(g\224\315 S`\271`^\200\356\212\271yc\023\334\332\003s\327\236w\250\375\225\027"
+	.ascii	"\2703{\006\0040 P\002CTy~\262\340vdCS:4\230\203m\032\234\316"
+	.ascii	"\3306\006N`Hj\301&\302\275\006\327L\226\023!-\216\210\021\027"
+	.ascii	"\311\205\263\003\333\030\207\255v\033\033\315A\023h\341tK.rN"
+	.ascii	"b\336\205\204B$\200:\261\201\341\026=f\206\356\302M\255\345v"
+	.ascii	"k\007\266G\210A9\004\361\301\262C\207\335\274\nV\212"
+	.text
+	.section	.gnu.lto_.lto.b1841bbbdffcf522,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.62.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \224=\004"
+	.string	"\224\007_"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\276\253\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\006us\350\364\005uq"
+	.string	"\005\001\006'\001\0204?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.63.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`S\002\235\022"
+	.string	"\026\341vH\320\362&\035S^\177c\306\201\212;\347\260\340\264s\346\202\207B\257,\017\033<\215C\b\006\2031I\320\250\333\f\206E\007\234\202\206\201\031\2005\231\340\024-\f\006\277"
+	.string	"\300\314\312\274D\305\357\236\td8ad\023\271S\n`"
+	.string	"]"
+	.string	"f"
+	.ascii	"L8vG\b>\361>=\036A\367\351\335@\367\351\230\355C\201\r\253\n"
+	.ascii	"\247hjw?Ua\357\334xs2\366\311\251\214"
+	.string	"\371Cop\002iF\223}r\":;;\004\320l8\027\324\017\024\267]\346\320j$\007\304s\275\355'=R3\032\317\245\210\312\356Z\316h$\356\356\266E\333*\266,\021\237\376L\3679\002e\013\nB#o\366(\223\372c\337\005u\343\302\352c\2678i\326\205\376\356\265[UZJ\351\017\220`\"\301mw\304m\310:M\245\026\257\335\376\350\333\210>#\366\232\211'\333\361j\350\320\001\262;>\370t\212\367Y\302}e\373\322~\214\313\210]h\346\004v}\002OK$\263\307,\252\200\274z\307\320\331\031V\344gRKlTf\226^o\373\024\352\271\341T\251\262\324r\026E#o\252G:B\222\324\034\313s\200\001dF\257+\205IES?\330\331.G\002=\242\242\240\b\034~\303\306\b\220mj\325\364\260\263_N#$y\262?\374\b\346\355n\212\221\b\342\300\212\335=\2132/\r0\024"
+	.ascii	"\270\200-0\341\204\225YP`a\b\361\005\373b6\270\200\035Z>\030"
+	.ascii	"p\345\345c\021a\037\312\002\207\036^\342\027\023\206\342\267"
+	.ascii	"\032\367C\367\214^8\321h\315\324\037\267\226\264\245\023\206"
+	.ascii	"t\216\244\252\361\020!\251\316\355\356r\372s\223N\265\245\247"
+	.ascii	"\352\221\272IQ#o\226j[\346M\025\034\270l\013g\272\300 3 p\002"
+	.ascii	"\241J\242\007\217\230\364Wbk\327\222\315\005J\254\203\226\372"
+	.ascii	"~\215\307$\026\374\370\305\214\357L\033E\262\002\234\205 \037"
+	.ascii	"\"\300\275jD\246 \236\212H\363\217\"o\340\307\213\244L\343k\002"
+	.ascii	"\302[\022\035i\342_\202@\317\265]\305`\\\254\022\336\357;\346"
+	.ascii	"\r\233\323wM\254\325\272\373\206i\327@\304z\267\331V8a\321\020"
+	.ascii	"\301^\250\031\357K\244s\365'"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.67.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \210\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\315\301\033\006yw\250\375\005yu"
+	.string	"\005\001\006'\001\360\0250sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\\\005\2412\022h\2227\200\""
+	.text
+	.section	.gnu.lto_servoParams_Registry.71.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \226=\004"
+	.string	"\224\007a"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\340*?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.72.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`l\001E\017"
+	.string	"\226\336iE\360\262&\0352\323-\256\343\363\2346b\277\305\3260\232\324\021~\346a\373\3374\rk\203\177pWPpk\324\002.\007\233\206\213Y\212u6\003\317ar\006\250z\201\357V\374\2743Q,5j\322\310\336R\246\024V"
+	.string	"R"
+	.string	"V"
+	.string	"'\200=f\037\200=:e\347\2707b\377\201Hy\365\330]ME8;\364n\230\251G\250\231\362e\216\300\303M\307R=\302\317\n\313\215"
+	.string	"\254\r\320\204g\247u\327S\205\265J\210\242\345z\327EZ5\035\253\345\371a\260\273\316\216\325\341\306n\373d{\201}\025\001\006=\346\377\374\273\341\323\252\351\324\364C\260\0356\n\320\354r\350\001\2629\221\206\211\314\177\366_\367|\227C\217v\213\273H\375\263M\246b\311h>\022:vw\344\321\n\262\307\003\360!\333O\373+\316\"\365\230\f\027\260\353\202#c\327K`\221\354\321^\371\231\177\3461\266\334\301\261\313\275\363_\034\006\005\370\022\217\306\260a\357\036\375\r{T\265+\\\310w\016\341\t\301\251\312\251\037U%yq)"
+	.string	"\3345\260k\3529\230U\366\030\352\365\2577\200i\335\244\004A\311\036U\232\025\0373T_lO\225&<\334\t\253\213\003\244\217D\245\023\324V\"e\026\225l&\013\247\321\246\241 < Ep\240\225H'\0224\321i\323J\f\3304at\322P&\323I\013y{u\361e\236\315\360\310A\321U\324\027\177p\024\244\252\223#\207\252b\033\f\352c>\035\r\371\343pw\027\232\344PAz\327\341\217V\r\367!\013\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.76.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007R"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\261\033\005yw\350\305\005yu"
+	.string	"\005\001\006'\001\001\0030sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"[\205H\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.81.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.82.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.83.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.84.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.85.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.86.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.87.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I_\255\362\265\"=*\002\037}S\365\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.88.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.89.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\303\304\243\017wu\b\310\001y\307\025\270\304\203\017sq\002\314\001y\313\024\023\022\021\020\234\236\354\027om\t\330\001y\327\017\375\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\260\227~kg\334\001y\351\001\007\006\244\227zse\314\001y\357\005\364\342\rca\004\363\001y\362\004\003\002\364\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.90.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`[\002\005\024"
+	.string	"Ve\205I\260\324Q:\343\327k\363\013eK\007\363\246\256\217\237\t\270\356C\204\347\350\365\211\312\321\230\276\031z\2319\353Z\277>\220\260J\035\367k\333\352I\3047\317\035<\374\350\235A|\030\203\273\023\034\037\310|\251\331\222O6\221;\245o"
+	.string	"g"
+	.string	"t"
+	.string	"\366}\237\201\373O\203]\265\242(s\324\372C\340\223\361\324@h\333\227q$\234s\363\227\342\203X$\242g\351H\2555\006\340&\342\351|"
+	.ascii	"\361t\213\236\273H\303\2359\237\303\305\003\305p\242/GW;\036"
+	.ascii	"\320\303\022\036\017\214\267374\231\032\242*\341\361\204'BR!"
+	.ascii	"\016\374\364\341\351\314\331b\251\265z\356x \356\326m\327l\323"
+	.ascii	"\354\251\013\247>\271W\022\342\023\367{\340\351\213\243\037="
+	.ascii	"Y\272Y\332?\235\271=\373[\226e\351%\362\313\323\256'\335\343"
+	.ascii	"\177\277\350iJ\247\303\326\364\212\323\223N\037V\0025\245 \252"
+	.ascii	"V\017%V\005B\203,\236\364\333\207\r5\031\347J^ \024l\3328\037"
+	.ascii	"h\230\023\244\340\236\2243\326\026-\246 $\212\324\372;p\352\224"
+	.ascii	"q\316\177z\360A\004\027\027\361\324\265\256\340\270\341\276\034"
+	.ascii	"]\271\252j(\030n\317\343\356\316,\240\017[\302\235&\214\265V"
+	.ascii	"\025\277\3518(T\220\315\357d{)\025>\335,?\237\254\246L\354\366"
+	.ascii	"\\>G\034w@\320\025p\310\316L\342\271\343\316\036\236\235\211"
+	.ascii	"\266\035\202\250\204\220j\335Q9\r{\303o\304\314\002'\260\200"
+	.ascii	"#\220j\255+5nC\3067:\365\005\232\371]\256\321\220\267\026\230"
+	.ascii	"\233\f\347F\266\220\020fh6\233\2546\023\220\201\006c[\360\362"
+	.ascii	"\f\245\206\274\271\321jb6\265\030\231\031\0131\233\214\214&6"
+	.ascii	"\273\325\304P\b\230\304@\273\305lH\362\026\203\375t\017\353\022"
+	.ascii	"y\032Y\t\321\327\036x\027\f#DB\327\322\365\261M\327,\272\325"
+	.ascii	"\tk\255U\334\236\033<\312\001\203\022DK<v\274\326\345\002\n\211"
+	.ascii	"\357\347Gj\005\335\236o\256#\267\342+ `\002\031Ch\036~\261#\215"
+	.ascii	"\350\277\342\305R\202t89\301n\311h\211\275{\260\322t\240|a\023"
+	.ascii	"\226\031\343\314\311\241\261\206\332\236&\343%\333\205?Z>\230"
+	.ascii	"\236B&\032\262\317\356\025w\022\006\273\377\330Coo7j\007\016"
+	.ascii	"\330\rhsw,\202Y#\247\344;!\310\006\245uD\233\200\326\305\no\274"
+	.ascii	"Qm\025\024"
+	.text
+	.section	.gnu.lto_servoDirection.91.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`<\001\265\r"
+	.string	"\246\332]C\020q\224\016k~CT@\022\244\235#\320\001\372\221M\233\t=\006XR\276URC\356\t\275e\324\340~\b{\033\253Q\004\252R\377\253\210l\364\254 \b'\230\306\f\256\310\264\0021C\377'{K\231RG"
+	.string	"D"
+	.string	"O"
+	.string	"\0052\217\266\375\226\253J\266\013~)\274\257\260\240\\^vW\003y\200\354\021\036@\366\250+/\035j\226|\223C\007-\257\224\027\342\372\341u\020dw\317z\236x\247L\214\310\356:S\336\207;\336\366\002\333\020\354\243\004\031\263\277.U\305>\334\335\265\246\330\377\376\314W?\346\351\250i\250i}:5}\315\307\013\r\0056v=\304`;#\306P\341\rga\005\361\332\334.\331\033\373\223q\340\371\225]\326\354\236X\001cw\r8\376dP%\264j\2342\207U\257P3\027JD\2271\247\252\036\265#\243!O\315tp\200u\266\360\027$\fF\250H\250vO\b\336\262Cw\261\345"
+	.string	"\023\260V\007\325\356&hq\027\f>\313\243E\244|\252${\274\236u\002\335\013\307\312\024\036\361t8\322\366`D\n\201>\033\r\236\t\240\006\036\356pD[\006\316#\322F#\025>\027(h\240O\004\022\255\303\2114\216"
+	.string	"o!\017\247\215\266\215\3236\237\351p5\305%(4\344g]S\342\006Jr\036\365\304vT\213\230\264\203\252\222\273k\242\001\027"
+	.ascii	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353"
+	.ascii	"\343\204}l\266\266\274u\335\205[\013\213b\260\r\f\003Y\300\334"
+	.ascii	"\240\002\026@\345#U9\243.nm\321\003"
+	.text
+	.section	.gnu.lto_servosInit.92.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\334\002e\026"
+	.string	"f\351\217J\300\324M:X%\230\237mkME\373\031O\217\0208\324\035Y\241]\243\271%hI\214\274\343\364\361\310\311\302=\372\234a\017k\357\345\376\374y\224*iQd\272\251\035\241\270}$nF\2474V\356\rD\023i\204l\271S\n|"
+	.string	"v"
+	.string	"}"
+	.ascii	"\340I\323\354\253\373\224\352\241z?OFj\255\256-a\361\324w\223"
+	.ascii	"\223v\223Q$\303\026\335I\363w\037\313\\\355&.\"\210\216>V\r\035"
+	.ascii	"}w\227\024C\037\246H[ACV\257\0322\242\257 @\216\336\303M\362"
+	.ascii	"$\210\220\036N\244\267\212NQr?\264\245\326J\346ns\251\212\220"
+	.ascii	"\211\022%g\243/XRE\276\373\004\312\335\346l-\250\265z\2269\242"
+	.ascii	"\373\344\266\237l\303\330\363\027:,J\265\336^N\177\001\243_:"
+	.ascii	"h\013"
+	.string	";\341Nxp\356\330\273\357.b\376\2225\314\346\313\203\376,<\370%m>\216\030\371\314,\333W\233\253\263\377\n\202c\362&\331+\344y\367\bN\213t:\004\247Ap\232\322\351\335\3519\247\317\222\322\353\221 \253V\241,%\365\007\3368q\336\355\267\360{&\r\034\240\235\327#V\246\326\f(\035X\265\372`\016\372E|\017\f\241\246&<\250\2424n\270\nxQ\273PAG\244\302\325y\356\245\376\336i\022\034\365{Br\201\374\226cn\003\034a\265b\210\253)G\rz\032\007w\252\260\257Vp\217\"\304mk\007P\305\343iW\347o\b\351\3368\375\270M$\0160[\036!\264%L\230/\351\236D\025\375n[\363\256\037\3432Le\343\251\371\322SDJ!sw\377\263\3048\207\221\023\203\300v\207?\005\260\033Gf\026\343 \313\231\271x*\350\300.Ppa\200\331\354\270pd3\227\314"
+	.ascii	"\3072\344\310\\<\261\230\314E\372\3527\3113M?\237\265\231\020"
+	.ascii	"\2306\203\006\363\245O\242v\243\2707\002\246\355`f\276\024\367"
+	.ascii	"\273\337C\024\213\237mk\342\352\374\336\013\034\205+k\332\"w"
+	.ascii	"\\ \361W\377i]\335{\302qW\366D<(\034\b\333\3142\271\3434\241"
+	.ascii	"m\331\251hR\224j\255/\037\307\247\002: @\002\203\214\241y\362"
+	.ascii	"\201\365#}\266,\3275\360\275u\013#\276\013A8D\0207\324\0243?"
+	.ascii	"\256\343\260\300n\355-\213%\303*2\025-\252\204^\333\252#\314"
+	.ascii	"C\204\f\022&\214qp\027\020\215\200\303-\2153\231\217X\341\020"
+	.ascii	"\237\231B)\353\0011\321R\207c\217\375\351\n@S\f\366\213\rg\321"
+	.ascii	"=U\327[Q\210\205\266\216\251e<W\364\314t\\p\267\005\203\027\032"
+	.ascii	"e\315\214\264o,7g\033\004 \362u\215\336\245\240"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.93.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`c\002%\023"
+	.string	"\026\344~I\320\362&\035R\230\fY\2731g\r\215>\375U\354\021cc\221\265\033RjHN\367rA;\227MA\bkfm\373\242E\362\265\262\254\2222\034N=\214R\272\266W\202\353\300\257=\022\235\206\370\202\343i\203\354-wJ\001h"
+	.string	"e"
+	.string	"p"
+	.string	"\006>\300;\235\027\340\235\312\317.\373\306E\235\372QI\003\220S\255\025\334\034\003\370\024o*]\367\350\\\351\362}~"
+	.ascii	"\305H\013_\367\346&\031\205\030\tg\023\245\2263\343\342eL\030"
+	.ascii	"\223\224\247\346s\242\334zD\214\204\262\271?c\321\027\316"
+	.string	"\344^<In\244\2055\227 \fj\255\226\264\220\303\rr\333/\333\rl)\023oy\376\211\003\265\374\035_\200\221\247\235\3720\336)\325\355\350\321\001\223;[\214\311\305\261\177\0224\243\341\275\261\277\347\356\271\322\273\322RJ_$\300L\322\202\242Zev=*\022\035\032\361\334o\177]\370\350\311p\023\016\241\371\361\331\267\371\242\277\323\337\216s=g\"\324k\0065\216NL\265\326\222S\223\240N\003ED*\005t^`\310\341\210\0011\362\360\3700\027\307)\336\227\245S\222\311'\333\017\336\"\305\201\215\215\232\255V\231\202\353\354\227\263P\001\301m\330\211a\253\265\236\004]h\205\305;\375^<\002\032\037$p\233\324t\313\261\026\221f\272\217\274\222\337\366\025\252\021\235Za\247\371)\256\"\345\357\234Z\202J\345\235\332+\013\3624K\241#\244\331\276\354nI\335+&\255\325\013\213\245\005\272\264DHM\200"
+	.ascii	"RH\251\250\300\025V\0134!\340U\005\026\026\350\262Z\261\300O"
+	.ascii	"\204}o\356s\324P\210\004\333X\roq\034Rb~\273K\262\344scL\344"
+	.ascii	"\315=N\267$\223O\237\265\326J\023|\356\267\357\220\033we\234"
+	.ascii	"\326\364\226'w\367\263ZL\356\fC.h\343T\273y\200\311\235\377c"
+	.ascii	"\024+ p\002\241\262\234\007\n\262\"f\315M\234\277\267\343\335"
+	.ascii	"$\004\323\374\213\342\301E\314\203\005L\231\335\207V\254\027"
+	.ascii	"\212X\261\347cq\301\001\354\240\335\310\333\300\255\313J\352"
+	.ascii	"\2654g\016\247\230\301\235\205GD\325S)\215\360\326)\241\276k"
+	.ascii	"\200\245+\031<\303\321R\260Z\371B\344\231Q^@\0138\306D\f\211"
+	.ascii	"\316\325\311"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.94.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\237\004\335\035"
+	.string	"\206u\273H\220\332M:\200\2000\343\365\205r(\232k\207X\360\370\317\237\236\031\235\300H\013`\372\354\350\271Yo~\350\177\356\0041\215-\007\306\270}\023b#d\022#\021\223)n\334\25715\017\361\366\267\2655#v\357-e\222\001\250"
+	.string	"\227"
+	.string	"\250"
+	.ascii	"\237\007~C?\345\003\320\317\343\226h\327\313\211S\365^A"
+	.string	"\340\226\231Zk\257{,\357\222\370\235L\364\034\356f\033ktJ]3\321\2766\301\026\024\026=\207\273\3017\004;\232\242n\223\017\220\314D\375\nS\224\314\241\001\261\274\212\311\006\217rA\216*N\277\302\004%o\310xtym'\004>1\2255\244% ;a\222\334A;\373:\361\210\347MH\215\313\261\306u2\200\215&Y\030d\031\002\365\253#\250b\302\301M<\323\020&\311\003\265\326_\235\225\204?\346\332\204Z\353rP\330\364\335}\367\272\335\325\331\225\"\002\263\333\206\365\255s\005\261\360\371\350'\267N\f\327\231\205R\004IY\377}B\313\354\210\321v\237\344Z+eO\265/\266\310\017~\356\267\330\355\304e\365d\304i\273\304\"\356\341\356\257c\314/\312\266\324.\363\346\340<\353\313k^\233\346\3355\257\256ys\224\027Gyo\224\327v\336Q\362\326&/\235\274S\362\312\346m\346\345\363\276"
+	.string	""
+	.string	"2d\030\304j]JKS\307\346W\220g\375\273F\366\304\305\375\310\261\210\236\265R\306\"\246\221\211\327\322Y\255U\347s\027\214\001\323L\247s^+\365\330\024\254t\217\335j.k\255u\366pw\031\234\3278\375\242\222\264\244\034\277\242\013\rwr\252\335%q*\033\022L\325Zw\366S\016\306a;|\340\007?\214Q\202\242-\273\326O\"R\373\206\321\331\264\237T\365\343\264\345\365\354\023o\201\210W\027p\215\021\247uw\201!5\311\036\356\2773\205v\246{\b*[hA\374+D\203\251(>\004\246\240\310\306IuYau\357\235\374\t\217\210\036\356\331\n\206\331\022gbBB\204\335\225\361%>\n\266\324z\264\243\344^?\362T\237\233\002\210\002\321\007@_\037\007C\276\030B?C=\030*R"
+	.ascii	"\255@\321k\001d\202E\317Gh\250\347`\300\372\\\374\b\365`\370"
+	.ascii	"|B=\034\261\276\245\326C\2311\243\376\345\300\334\304\302\304"
+	.ascii	"p=\\\001\017\242Y6f\377r\036\272k\233>\360I\313\256g\021\314"
+	.ascii	"\n\302\f\243#7\003\274[\341\002?\270\273/\260\261_\027\335\224"
+	.ascii	"-5\261\365P\3549M`\370C\327X\036\f\303{\001\232k\035\031O\206"
+	.ascii	"\236\\\317b\361\314\223\021\247q\331R\3444\346\214\220B\243U"
+	.ascii	"v\304h\265\017Q\334\255m\215\353\003\235v\267\361A4\247m}\340"
+	.ascii	"\327/,\247\177u\0351O\316\320\036\256\316\207\304\351_\250a<"
+	.ascii	"\304\020c\210H\002\031\205IRh1\200\002\031\"\273\016\021\240"
+	.ascii	"5UC\323be\fcn\211\327*P\206>\225\210\345\346u-)\016W\213n\252"
+	.ascii	"A\332\007\254\233\317\021\356@\371\350*%\335Z=k\030\017\306\030"
+	.ascii	"\221\367\236!\215\251\371\001u\237A\335/P\311#E+A\223\213\343"
+	.ascii	"\244\207\301\373\322)49O\002\213 Ux\021\204\277\01776\001\325"
+	.ascii	"\222\3213\204\"!))L\304u\360\370\352\333=\036\332=\276\351\226"
+	.ascii	"\257B \307l.\346\315[\301q\f\354\275 x\020\rM}j\304\310\204\001"
+	.ascii	"W\032e\301K\377\276'L\024\033'\235o\302<3\021\221eZ\3704\267"
+	.ascii	"W\252g9\034\261\227V\003\222\322m\356\213\370\017"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.95.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`.\004=\032"
+	.string	"v\257\245F\240\\M:\002\352y\272\021\257\337\305\265f\261\323\373\257[\353\0360\307\024\3544\3528[\316\254]\312\323\252\225\273\254\310\233\013\221\342\235\243a\016\226\265\200\003\265\345\262\322\256\307\300\013\374\213\305\366H\310\336[\356\224\002\214"
+	.string	"\212"
+	.string	"\226"
+	.string	"\363e\373\321\276\356Jh\337\271\312;\265\356\320Q\251\265\002\231A\370\211\340\004\350\247\374"
+	.ascii	"\372i\232\255\346\274\246\372\251\335\021\224\234Z+l{P\013\270"
+	.ascii	"\344\335ri\007\351\f\345F\232\277\344\n\242L\271\341d\034\224"
+	.ascii	"\340\f\033@\002\340\216$\205\2555T\227\232\021)\200!J\237\241"
+	.ascii	"\322C\271WZv\\LR\016Y!\327\003\314{\217H8[\224Cp|\337;\003_\230"
+	.ascii	"\033\016\307#x\241\326\352x\303\335\270wn\333\210m\r\266L\020"
+	.ascii	"\323'\242\237\357]n!\203u\344Mm\257\332(a\263n\360\327\362,\004"
+	.ascii	"\337\024\243\234-v\331<[\\&\373\007h\364\222\274K\266O\317w7"
+	.ascii	"\317w\377\353Qw\370\247\033|4\235\321s\243\245\214^\031\0357"
+	.ascii	"\372\004\006\020\271\302\320U\253\215.\256j5\251\202<\352\177"
+	.ascii	"r\214Oy\227\262\344HI\341\371Mh:\231_\21431\207+XGj\255"
+	.string	"/\373<\277\347\327\247\355'W\2052\222\302\250)(kj\255?\237~\020~\006\022l\233\270\230\017\021~\265\026Y\375\n\204\f!\202\212\330K\035\266\2245gW\213]{7O\220\314\231\313\344\207\273\344\235$\353\263\253\025\177\016.\222\200\273\212\202\373\035\023\255\242\270uYk\255\022\\\237\275\222/\314\267\334\036\361/\262\fQ^\272\3202\006\250M\342Zd\353\303I\026,\005\350\334\332\304\250\035t+\261\345\202\242\252\022\241~oj\227Q\373\304\245\310\246\024\017!9\tob\263x\224\024\257\0375\234\264t\265V\nP\356[\341;}z\326\"\376\366F!;\214X\t!\331t\220\003\242\331\213\241\030\021\314\005\212\0232\025&`B2\022+`ACD0\007\005<c\021\033\202\271\230\315\206`/^\355K\036Z)bU[\033\270L\356\3412{v\265\302\237\207\341R0Eq\313s\351^\303\323l"
+	.ascii	"\372\241\371\260\240\351\314\\ 3\021\227\205\353F\303\355\331"
+	.ascii	"o\371\342\030\345lf^p0\215\207.\247s\362=<\261\205\236\205%\341"
+	.ascii	" \351\250\305.\357~\345\336\310\bxw\241qwoD$\334\270 \235\243"
+	.ascii	":\356\3601\036,4\325Z\024P\250q8\204\224Q\002c\024\021\221\231"
+	.ascii	"\231-L\007\320\002\231\242\255\003\021\2205Cd\264\304Zk\fpV\305"
+	.ascii	">\235N\330\347\202\020\023\200\007#\222$\214\325*4Y\02113\032"
+	.ascii	"z\354Z\037\320\354L]\353D\rXcN\224rq\231\343\310\351\017\271"
+	.ascii	"\263\363\007\341\360F\357\306\264\201\304\364\270\016\353\215"
+	.ascii	"\0356\342\273 T=\277\035\323Ix\222\330\325\377\302\210\312+\364"
+	.ascii	"r\036\363\313\260j\300\362j|aA\216\032\362\316?\224\2624\210"
+	.ascii	"h\211\273\350\302\347\3348\332\\\376\340 L\240\353{H4X9\201\301"
+	.ascii	"\273\2014MM*\346\263\357\204\236\n"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.96.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`T\002e\024"
+	.string	"F\250\213J\320\322(\035S\341F*CL\372\267\r\236\260>\221,\020\340\020VZ8\324\bh\345\031\223S\233s\363\331\335\362\333\272\243\036\3762\330XFM\264\330\034\314\221\243\205\031\200\344w`\327D\365,2\201\207i\2154\262\211\334)\005s"
+	.string	"n"
+	.string	"u"
+	.ascii	"(\247V0\236\232<\200x\032\276D<\265=\247m\340\200\355A\033\274"
+	.ascii	"\265\356\360\210QkY\300'\343\251m\366\322K\237z\372\241\241["
+	.ascii	"\021\244\326\312Z\021V=,\357p\332N\303\2356\177\350\004\214\222"
+	.ascii	"v<\232\323\360\224\303!\241\342\345\302\025&\340\321{\2377<\334"
+	.ascii	"\fM\344|\337\373\311/\270\343\345|\236\030\324Z=w\274\017\267"
+	.ascii	"x\3331\333-\366\324\005\363\273S\177F<\375\242r\374@!t\233A\273"
+	.ascii	"\304\315\355\261\277\342\303\004\364\362"
+	.string	"\330\253\007\375$#\252\023\335\344\313;%N\243\304\351Q\234>\315iq\247\351N\207tz\303\351\271\323/)\231\201#\302\216Zq\202B\252\022=*q\242\277\374\264o_\205\337#\362\265\270\361`<\375\207L\372BOa{i\244\221\306\303X\364c\003Xk\r\247\2455t@\270\031|Xk\255a\312\311]\255\b\374\005WsW\\[\302\204\371\235MrKc\272\"\311\206K\367&7\334p\210\256i\356\356\1776@W8\f\227\261\326\272\342\273\370\213\226\353\345E<\235\273\340\347\3506\203NyjG\366\275;8a\344\263\331\301\315\340\256/)\307\333\355Y\325\376\247k2\354,,\214\265\326 \360\213\356\223\361G\234Z6\0235\027\355\365b!k.\332\353\305\022\343\212\305\\`Z\"\031\\\024b\020Zj\264\031\3545\342\226\nM\206a\346\242\261j0/\260\230\027+\006s\221a\265f4\226\312"
+	.string	"\313.\270f\254\232L6c\221\345\355\313c\031HJ\267\305\321\355q\202\335\256V\203N\323D9\2717\357\375\034z\204\3500\364Q\207\316\322Tmjol\232\210\332\006>j&\223\307=-jE :\020"
+	.ascii	"R;\256\200!: \221\033I$7' \200\002)3\363\326\302^\024I4\307%"
+	.ascii	"\021\013\363\330\342Xj<7\224x\301\213K\013~\036\253QN\\\344y"
+	.ascii	"4\302\312p\276sX\356s,\016\f\317\371\232\030O\313L\3107\250J"
+	.ascii	"\275\004DC\24060\034\321\030\315\2443\203\f\206\t\356%)\302\266"
+	.ascii	"P\215\337\203H\347ZO"
+	.text
+	.section	.gnu.lto_updateGimbalServos.97.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\025\013"
+	.string	"\206\025L= O\234\016\243[\237s"
+	.string	"p\244\222.\310t0B.\220\"\254%$\351\016EQ\023\350\365Us\243\362rwV\306\027"
+	.string	"\240\206H\301\311\023@\266\240"
+	.string	"\202\022\332?\033\t\331[\312\224\0029"
+	.string	"6"
+	.string	"9"
+	.string	"6p\200\273(c\335\005\2410\261\353Y&\340x4g\263\270\327a)\017+<#\030\273{)\207sO\316\277\210W\335G\363\244\024\354\256\263\373h\270\365\266\007\330N`\337A\327\307\211\027!H\233\374lO\223\272\301>\\\r\331\027\375U\246\251\230\236`:j\032fZa:5}\b\200\r\025\fZ\354f\370dl)\222@\330\376\303v\246\003\035\020'?C\215\326G%`\f\022$SUmLB\276\263"
+	.string	"\f\252q\245\252\367\314\270\246Z\235\215M~\005N\302\342\330]\004\376\210{\231\377\341\321\025\266|\367\350o\323c\027(\017.\013$\230M\303*\032\236D\266\314\202F\331.L\004\b\330\204\312u\301\032X\256\211\266]\221"
+	.string	"\316(P\264\013\223e\332\365\360\366p5d\211\213\322F9\206dTjRJ\255g\246J'\205)\002\022"
+	.ascii	"\227\031e&\236\031\205\313\274\200\202|\314\340,\210\016`\261"
+	.ascii	"B.\027\030\033\324\016\327v8\231\005]\310\263b,T\251q\340\316"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_writeServos.98.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`*\r\2759"
+	.string	"Ja\364\024AP\246N\007\013\324\270vN\001\373\244\277\377~\n+\365f\232ok\334\341J\007\2476\3517|\201\304\346|\020\370\211h\"\232H\200\002:%"
+	.ascii	"Q\360\364\206*\261\234\007\202,\215\206\220-eJ)\005F\001\034"
+	.ascii	"\001>\001\367\372x*\272t\026.J{\351\346\322\255\245\237\271\277"
+	.ascii	" \227\303\273D\333\243\306\275\205\273K\267\265\033Ws\341\270"
+	.ascii	"\237\022\354W\306\314Z\336\275\267\301\257-\262\213h\333\332"
+	.ascii	"Jh[o6NyA\003\256\326\262\365\273j>1h\314\274{\335\222mY\352\327"
+	.ascii	"\226\213\331\331nf\267\311,\312\001\346\320\275\327\352\233\240"
+	.ascii	"(\032\344\332\325\255\231\370\\\335\304T\\RJ\"\016\221\204G\301"
+	.ascii	"\024h\364\363\241\266\276\361\350\\\334\004\364\030b\206)\273"
+	.ascii	")J3EI\363b\231\030\224^\252Rdr\200t\035\030\224Z\264\243\304"
+	.ascii	"O+u\035\030\332\023O\252\301;*D\030\f9s\327_\314\234\b\305D\314"
+	.ascii	"I\017\351 \371\256\336H)\023;ka\262\214\224\243j$\266\206K\327"
+	.ascii	"\201\235U\007xim\335\245\241\246\200\025\361 \0231#\235\002}"
+	.ascii	"Wl]\001\r\n\24021\"m\364\353\256\263\366\241\025Y\0076V\221\367"
+	.ascii	"\3364\f\207[\337\225\220\256U*oM!a\330\215Z\364\221\306l\266"
+	.ascii	"\366\257\260\245\277\2216"
+	.string	"\272\223>\256!!\3032\344\b0\314\013\375\335{\273\f\354\354\347\276\253{/;3L\254\331\251\231{\217\231\0350\247|\002\037\327m\374&\235\346+\245/\342nv\273\367\036\031\017;m\230cc\241u\354\264sn\214\215\205\326\341\246c\247\035T\224\303=g)\316\033n8Hg\344\270\347\330i\345\214\t\331p\267\371\235\251\341^S\333\324n\2227n4\354\374uc\241m\331\231\367\213G\224\031fvZCn\356U6\2313oT\275E|\217\271\3074\031,\356'\234b\2057\263-\367\n\264m\277\005\363f\254\313\237-\230\300\200\316\374\"\313\233\311\316\346I\347\365Jf7\245\177\223\271\377\371|>\371\2270k\230 !\002\004\324\371A{i\256j.\315TSI\251\326\322\034\345sV\360\316\t|\316\b\334\371\300;\033\3609\027\260\316\004\2523\224uFV\347\001\326Y@u~\262\316\001\2523"
+	.ascii	"\353\354T\235\217\326\331X\235\233\2543Su.Z\347\245\352\254d"
+	.ascii	"\235\223\2523\321\347<\264\316H\325Yh\235\217\252s\320:\247\325"
+	.ascii	"\031h\235\215\252\363\017u\266\326\271V\347\177gw\347\346\340"
+	.ascii	"d\304\316\006C\001\305g\232r \376\243\370i\363\316M\373\334\020"
+	.ascii	"\341\322O)\375\222\036\007\363\241\244\007\327\225\364I\342'"
+	.ascii	"9\217/\342\247M<kpi\200r\317\243o2\022\221t\302\267\223+dF\377"
+	.ascii	"\252r%-\225\360#$%\315"
+	.string	"\310_?*\240\225\3766\347\335\235\340TS\375\204\357@q\322\340 \363B\372\341G\375\360\033/\307^o\241Q/\341+\036\0162\341#}\343q-q/\357\022~w\351\244\335\234\367\247\363\016O\372\315n\267\243\237\n\376\321\367\333\242~\356\325\340\247M\2715\243\247\300O\277\337\252\032\221\036\360\323f\234\036\\\303\265\313\305\031q\032f\366\002LZ\350n\274\362\3473\372\275\321\373\333 A\277?j\242\301b\226\b}B\037|\263\265QY\367\023j\377\301\263\347\030\363\362's;\373\317\026\206\f\031\336g\367\2467f\215^?\331\314\034: o\274\222\377\3537\036\216\274.\177\352\351>\036~\367^\b\334{\232\017\b\356'mY\004\t\022h[\333\034\207\266\375O\355\316\254\301u\371\263\332@\375\265\274\360Y:\"&:s\t\023\336L\177\241\334\221>\323\315\326\037\306\350\224\276(-\272F\n\0240."
+	.string	"\031\253JF\026\r\255\0242\254f\260X\321\302\205\n+\030-L\274\260\302\322\222aU\005\200\263b\244\320\262\232\221\225\245e\225\272\335\376%#\216\320u\275W\023\224+\3102\365\n~\201\236:m\206(O\r\3237YJ\233sI\303sUJ\376T\002v\2737\301\007\341\004\241\253\305oN\351\344k\370\020u\f9\202g\346j\223\260|%'\037\301/\250\363'\307\236\0371\263H\314\3227\3316\026z\340\335\212\227=KG\344U\016X\005\331[\363\271\033>\324\224*Q\352\275\231\245\207\260\366\026\352\256\243\271\006\243\336\233U\320"
+	.string	"\275\267P\267\243\202\306\347\313N\376\327]\033\370\023\002\034\331\024Pf\013\027\274\231\006\232\307\234\036\335\262L'}\223\0310\207\021\276\235\260\221\035\251\272\352\277\252\260\245\r!\034]GK\375\227\257\n\210\310\333\236\317B\304\252\217\360\250\032\035\002_@\352\013\370\262\245\036\002\324\023(\363'hP\337_:iG\250\237\317'\241!r\300#\315\232\f\020\360\364\002\226(y\372\264\351\\\213\323>w\005)\300S\001\370"
+	.string	"U\236\004\t\200O\233~\234\336w\034\337\311\231n\244\310\321\330\364F*\037\023\322\364i3\017S\201\005\250a<D\025rfDDD\222$Ik\241\005\304(\306\244\263\r\021"
+	.ascii	"%c\f92rZ(\354\261\033i\246F\365\312\004\375\324\241\343\266n"
+	.ascii	"\354G\001\201\022v\225\"\332\004\345[j\001\255/\236\371\276z"
+	.ascii	"\030(\030Y\352\253\202\317\363A\333\345\005\236\"E\265\215\263"
+	.ascii	"\310\363\272!\343\342\013,\251I\342\356?]\362Y\347\252\340\370"
+	.ascii	"\324\200\306(!30\307\366\304\276Z\224\241\332X\216\036\201\002"
+	.ascii	"\217\303\333\264\331\206\261 +\317\264\367\215wK\2576\033\026"
+	.ascii	"N\031\317\224,\002 \374\220\217\216\313o\027\300\270\227m\364"
+	.ascii	"\315\305s\200\021\233\217\005I/\313nz0\254\223o\245\f\257\203"
+	.ascii	"\3751!#l\260\240"
+	.string	"\006$xx\245e2\370\346\033\327\316m\272'\262\022\242\201\307\276\026\030mi\242\030\004S\321&&\240g\350\211\354;+q\301r\266\n\313\201\326\007\030\353\225\035\357\227\263\220\340\244D\311\225\fo\373\363\336\245\017\364t\241NA\230F\224lT1\031\216;\307y\303p\033\003\310\013\036Z\317\353\224\262C\355^\033\016]Q^Yv,\344V{F\374\275\241\024y\363\374\bt\332\345!\365\223\326\357\3029\300\b0\336\\\2075O\247\007\234`\200\023\341t\230\372S\322\251\27047\354\241Eu\364\356!kt\347\264\030=\365\335\342\013\3033#\201\005\253r}/~\342\273\r\277\236\341\0208\212\022\256\320.\207\227>F\316\002\036\033\252q\253\356\304\2366\017l\324+\276\002\314\321\322v\220\360yY(\276\221\351\324\332\375d[\271\200\fZ\251\253\200\314j\205\365\253(\310\250\364\244\263TO\324\256\032\206_"
+	.ascii	"?A\275\222Bu\004>\203V\340\274A\375\300\200\020\bS\222\231@\310"
+	.ascii	"d\020%\316\364$0\021v$\265\212\r\035^5,\003(:\230\021)\026\230"
+	.ascii	"\221\250\001"
+	.text
+	.section	.gnu.lto_servoMixer.99.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\177\036U\206"
+	.ascii	"\312\335p0H\020XKg8\347\026\274u\335\3373\336\363\026\256\311"
+	.ascii	"\336\255\204\b\260o\005>\276ra\351s\016\220;$a`\331\036k\213"
+	.ascii	"\007Tw\213\357\334)\375i_\371\346\274\307\tH\276\370z@\363\231"
+	.ascii	"\210\356\236\200\232\210\220$\245\f\352\002\301\002\021\003i"
+	.ascii	"\257\001io\001\306^\002\214\275\003\244\275Jio\222\261\227\207"
+	.ascii	"\261wG\332\253#\355\315a\354\305A\354\025\300\330\033@\332\013"
+	.ascii	"@\332{\243\330k\243\330[#\355\245\201\366\316@{\221\322\336\243"
+	.ascii	"\264W\006\332\033\003\3555J{\213\322^\030\306\336\027\306^\027"
+	.ascii	"ho\013b/\013\264\227(\355\035\372\351\025J{\203\212\275@\305"
+	.ascii	"^c\332\373S\354M\213\275\305\264\027-\366\022\213\275+\322\336"
+	.ascii	"a\261W"
+	.string	"\230\366\006\213\275\300\264\367W\354\365\241\275G{\233\330\313\314&\003\016\016\223s]\247\354\365Y\337\374\334\206`9f7\314l\314m\314N\346%\230\3230\25317yE3\223\211\273L\324\322\306\207n\337T#\207\345\226\347\242hb8\373\213S\323\264\034\305\022\233\030\n'4sW8\020\302\331\340\234\2327N\037\356\034\240c\302o;T\323cC\\\256\211\255\353\312M\360\232]\342.\341\267\375\211[\302\204\343\3669\304-\2531\334n\r\374\266\3019$\314,#\301I\260\022\354\306j\226\230&\nI\312\270&\355\360\300\326\365\254H\001=T^\"J\270\202\005\331\274T1\304\331\244\255\317\335\272\236)\320vD\2322\256T7\344\371\020\362\357\f\243Q\231\355(\\\225\020Zy\321+@\310?c\263\020p\r\211\312\270Ry\251\003V\303.\221\177\273|\266\214V\206\217P\271\271oB\251+\341Z[\335"
+	.ascii	"B\376!\371\206l\266D.c2*3\235\bW%\210x\341\341n]W\035\374\333"
+	.ascii	"\034B\376\361\033&\002\362\317\210\205\200\374Sw\351\360\231"
+	.ascii	"\327\312mZ\3134>\353\272*\235\313\f\243\261h\205\354;\343\035"
+	.ascii	"\372T\2461\003\351HF\f\243\032E0^\270h\301\202hH(\b\310\370\223"
+	.ascii	"\026Q\342\n\033Ca\020\370\363\275\325e3\246\201\347\246\nK\212"
+	.ascii	"i\240yS\3263\3160R\320\334\327\021qm\313N\226,3,\303,\354\212"
+	.ascii	"\3311\342\\\231\315\221i\2433\\\303\027|2\345\013\307\271b\363"
+	.ascii	"\375\300\273s\3435\036\272\250+k\f\303x\021\f\262\306B=vO;Y\262"
+	.ascii	"\310\330\205\030\267\030b\215X\263X\222\331\311\222\365\205\211"
+	.ascii	"\274\300}\351!\241.\034\344\313\261\305F\007\216s\025\204\217"
+	.ascii	"\b\216\226)\230M\227\006\022\342\253\215?^>t\032\f\222%K\b.n"
+	.ascii	"\251\301\322h\234\2531\037\022\221\343\\]Y\353\241W\360\324\030"
+	.ascii	"\266\341\013\342p%\307q\256\220\360\375\260S\207\007F\343\031"
+	.ascii	"aWZ=\234\321\225e\205\205\214\306?/uv\262dY\341\340\016\fT\366"
+	.ascii	"/\305Z\372\220\326u%b=i\337\n\254\035\370>\242)_\252R,*_\216"
+	.ascii	"\273%\364\260\031\267\025V\262;\030d]\327\355*\254,\336\033\274"
+	.ascii	"\333h\273\213e\327((*\027\027\365\353\013\310\277\242\377\030"
+	.ascii	"\341f\214\031\204A\364\3420"
+	.string	"\\\374\305\177m\312;Awq\017\244\210[\352\371\334\236p\002\317\325\342D\357\256&\033\026o\241vi\036T/\302u\245\362\261\255\325V\324!\210P\301\200\001\362\217\3059\355\2139t\242\363Ro\252\367\222\272\312\261uh*j\021\252\030u\254\271J\035\003\362o\350<\346\360\220\213\314\326o\t(\364'\032\215\264\262J\006\270\253\232=\320\\%\364t\r\025o\250.\265A\007z\320}v\306\003=\330\346\206u\"\320R\204(Y\031_\224\213\033\373\341\221\376\347\276\274\342\323\007\363\226\353\004\302\243\225B\016\360\352'\305\377t\301=\231(\361\250\223\301XA\342\315\272\256o]\247j\2548\361A;eX2\202\226Z'\003^\353\272\372\350U\210\022\235\036\357\021\241\240H\021 \377V\374G\t7\306\fB\2037\3067\274\360\303\373\354\370\311U\340\355\033\220\177\302\027\225j\236A\036\300\007\357\313\343\301z\362"
+	.string	"_\354R3\346\366\273\331\361\307\213\253\356\370\376\273/\217\362\211\251\336\333\301w\326)\\\327\365\307\362\035\333\271`Y\b\376m\006\033l\360b\025\347\323\355\306\023+\230\237k\321\234\315X\030\247YG\325x\333+\007"
+	.string	"\3443\232o/\265\222,\005O\321dY\210\355\340\203\346\252\017\200\374\343\007\273\222xjM\365\336\356Y\262\317\265\313?\274\360\350\354\267\354\2429cF\r\255y\306d6^&\303m\354\344\3451dc\274\004/\213q\032^\026\023f\250\227\301\276\b\365r\027\226\343\345/\240^\346\302\245\305\n\273\341e)\254\306\313V\334\344\345\252\264\227\243@Y\032{Y\371\004\355e*\264\227\223h/O\245\275,\205\366\362*\324\253\242\275H\240^'i\257\r\306\336\032\214\2754\030{\217i\357\fho\023\264W\006\2647J\250\027\n\355e\222\366>\241\275K\320\336\030\320^\247\264W\t\332\333\204\366\302\200\366\276\200\366\272\220\3662\241\275I\320\336\026\320^\026\320^$i\357\021\264\327H\332\273B\332\273\204\366\252"
+	.string	"\324\233\202\261\027\005c\357\th\257\tho\th/\tB\275#\030{E \366\206`\354\005\001\355\375"
+	.string	"\355\365"
+	.string	"\355\355"
+	.string	"\355\345@\250w\003b\257\006io\006\304^\f\322\336\013\320^\013~z\213\004\365V\200\366R\200\366N"
+	.string	"\324K$\355\035b\354\025b\354\225 \355\215 \355\205\300\330\373\200\2617H\332\353@\332\333\200\261\027\210\261\227\201\264w\201\264W\001co\002\306\336\037i/\002i\257\017co\017c\357\001\001G\276\3029L\354\210\221\377\354\226zYG!\326\n\037rI{\272\245K\237r<\372\r\307\001\351\304\013\3106m\336\252\3560\331\354(\\\372\320mJ\354*\234\303\3708\227\351CZ\262\330u\234\3029\013\322\315\253\242"
+	.ascii	"\210\242&o@I\341\30384\024\316dN8\ng%\230\t?\341S\\\302M \341"
+	.ascii	"\035\274\204\003\345(\303F8\tp\256|r\252\021N\324\2637\306\024"
+	.ascii	"\341\\"
+	.string	"\366\266\013\341 \\\204\363\230\207pV\352}p\020\376\"-\n\017\376\301]\274)\311:8\007\367\340\254\fK\216y\007\007\312Y\352mp\016\240\270\024R\216\022\335W5\231\344\265\267\301\211z\364\236\032\214y\347Q\202ep\r\346:\017)\305\203p\323\247\212\f\316o_\027\034\203\363\234~\"\245p\022s\267U\306O\354\"\345\232\017\322\256\217\200\350\323t\226\351\351=\310:H;H*\220y\200\374\273\340\b\314a1\267\340\254Ugn\251\267\247\361D\035@\205\232L\272#\366\037\\\336\223\211|\366]T\017\257:jR\211\216\016\2139\253\341\033pyc\314\356cV\265D;\213\213\274\3514\353 \350\n\276\213\314C\3565W\0259\022\005\257\340\277<K\275\tN\301\215\354\210|\202\033\245-\365\270\312\020z\250\020\243\200D\376\324\234C\325xR='\312\006]\323\251\311\243\037r=\247>Y\252Q\242"
+	.ascii	"\371G\344\274\3068\252\364y2\277\026\367\004k\305\271\226m|\313"
+	.ascii	"\006\327\b\331\314_\027\324a\265N&\343\355\271\2122<\027W\235"
+	.ascii	"\315\234\006:q\312\255#pw\235\3245\024\307\037/8\035G\265\272"
+	.ascii	"A\2352\005\215ot\345\341\203g\252"
+	.string	"\367\376#\222\240rE8\304\rQ\310\207Hp!\021\\\002\266n\303&\202\017\273\360\214A\260f\305\003\207 \310\037p\340A\324\232\2118\007\236\r\274\r\201\274\001\006\016d\2013P\246\323\270-\360aW\035\005\224\020&p\005~<\001\004\376\243\223hC\340\303.:O\037l\301<=\356\343\200\3678\360\007\2341c\300\207rt\306\nP\003\266\021\360\002\0068\001\367\345)}\200Fk*}X\305\356\231T\346\327\206\307\223v\234\307\177m\224`:\276\303\214\251\343C#\354\306\334r\224\371\376\206\3439\004x"
+	.string	"\307\001\226$\033\023\340>\346"
+	.string	"\360"
+	.string	"\304\030\001\300\207]S<\335n\334\306o\2149[W\026T5n\343\3014%X\262\303\032\254\211P\261rP\251P\001\362\257\306\211pQ<\335h|)\3168\215?Osqo\341\326\302\235\205\221f\034\035\351\276\264\035\272\313\021\210W\020\252\226\036t_G\377\351r\363d\312h.lv,z\241\274oUwb\\\306\237g@\037\217\rRR(K\370\030}W\275\242bi\256\212q\337\252u\251-\272\321}mK\275)\325\207\376\341\b\204N\005\242}P\265\370\340\3376\226\336\n\233$\211I\022\250\245&%%NMMNF`l\222&\247\247!G\236\226\232<9\rq\362"
+	.ascii	"\006$J\224,%12\004\205\244\205\247%(`\223\323\023\013\276$PG"
+	.ascii	"\230\232\244@T\302\324\364\031\226\232\316\304PQ1(a\372\255\221"
+	.ascii	"$&N2<!a\242\004\225\244\005&\030XPR\302\264\324\244d\344\211"
+	.ascii	"\211RR\321:\305\200\344I\t\312\311\351I\211x6\305\337\262(\304"
+	.ascii	"\275\231zr\235\370\3265\213\003\314d6c\240\273#\356h\234k\203"
+	.ascii	"k\2208\314_WC\007\263\024)=D\331\336\225\031\347\332\026\"\317"
+	.ascii	"\326\021[\031\212QAG\006k9\237\271\225\224s\230\323\360\214\362"
+	.ascii	"e;\376x\241\201r\216r^B\331J\2369/\231\352\254\364\225\3419\227"
+	.ascii	"zH\31027\203\224\242\b\226-s\326\324\254|\bF\315\263\215\331"
+	.ascii	"\016tG\353$\314\321\336d-\037r\335\204\261=K\275\225\203C^S\306"
+	.ascii	"\327\231\313[\257\331|\231(\341\315~\206LC\256!\317 \317p9\263"
+	.ascii	"\371\372\002\303v\026\343\\\273\307N@\376\272\213\036\3664\353"
+	.ascii	"\276\336r\213d{\031\322\371(=LQ7\206L\256\313y\216}D\344\320"
+	.ascii	"\366\344\344\231\352\375\246$\233\342\344\201m\224aR\347)\261"
+	.ascii	"\243P\214\324\201|\271\251\347\365m\327\366\"\220N\023\310\374"
+	.ascii	"\020g\327\211\334\303\200A\326Q\317oX\307\232\232\261.Fw5\276"
+	.ascii	"e\211A\300`\265\277\316\206\016+\253#\037\201\223#\017v\"\242"
+	.ascii	"\220K \323\244\001\362\317\311[\314\321\362\025Y\235\325\316"
+	.ascii	"a\350\354u\0160\316\025\005\1779\306\360\362\302k\334\314\262"
+	.ascii	")\266\312\360,\333\016UT\275h\321\3475,\226\234\2316\274\313"
+	.ascii	"\221\310+\210\032n\003\r?\276\206\263r+\211v\032\3766K\275\031"
+	.ascii	"~\364:\n\317e\206\0231\317_\316hz\236NeX\322E\fo\362\256\342"
+	.ascii	"\212j\331\342\\\333\244\213h\0073\034W\260\024[:\207\222\230"
+	.ascii	"\277\334\252\311\032\031\336\204,\352L.\303\215\336\224aP\217"
+	.ascii	"z;\027R\016\367\361\332\242&Y\017\235\026\250s\237/\346\323\231"
+	.ascii	"\374E\032\020?<\235\335|\271M\225}\t\231\307\360\303{:\227,\316"
+	.ascii	"EE\364-"
+	.string	"\313`_\241Y\307g`\007\276-\265\310\316cN\337\301Lv`\236\262O\022n\221q\307\202lb\002,eL\274\207_A\326a8>;\3031\216d\334\223\351\024\300\034\022\315\2715=(C\347\332\020\340\202>\374!\216\210,u\200^87o\265\253\304\212V\363Jp\314\255%\347\326\204~\024\266\226\t:\3276\261\341\326\242B\347\345\004\0240\334\2057\201\301\360\242\266\027\316.\354QZ\263\003\004P\002eb\232OP5\236\221\351U\2167\274\250\360\2233\r\345A\362$\347'\337V\342i\341,<\311\177i\312\255\024\336\302\213\332V8\013\347#Gr\006\3433\267n\246\3049\342'\202u\250\342\b!\020\2420T\210hD\222$\3110\007\342\n\020\b$\201\032\306\362\006\022\340\2041H\223\020\225\2204)(\244\003/\202\340\034w\310NT\362\212I\001*\227\377j\022\t3:w*P\2041J"
+	.ascii	"(;\262\013\311\240\361\250\325t\366&/*\344k\202,\350\301\376"
+	.ascii	"\035\325\222\013\2074p\346\f\016\364\354\333/\337\241\217\316"
+	.ascii	"\211"
+	.string	"\242\307\303f\200\316\250y\340 \342g|\255\270k\320\364_\364\037wJ\217p\003\035\243\263\311\211KR\027\246)\245*#\370+\025t\213\377+\376>j\001\200g\260\374_\362\245\311\315\321\306_\030\035\342\361\227Gw\331\270\255\261\022\374E\211\224\274\213\025p\322\233\005A\3172Q\225`u$K\301Z\343z\002\f\272\345\322_R\032\264\b\335j=L\225p\276R:\032\336\267T\250A\276=\f0\242\244PX\312*\316\017O\366\232;\360\353v%U\310\221\003\221\003 \302\215\306\214\017V5\370\261\326\305C\265B.\242j`\270@\022\206\243;r\036\007\365 \"N!\344\3677\036\301\b\300O\177\220\324\317Bf\026\305\376\300\271w\013:F\347c%\036<B\237\177\177\222\330I\355\213V\241uH\323\0071\364\343\337\316\331\222\363\324)\354\fY\032Y\351f4:\346\337\374\226sBc\b:\327\275\356"
+	.string	"\237\\=\373\377Y8\241\226\327\fL\r\327>\315\320\266"
+	.string	"\300\025\211*c\2656C\327#H\177\370\251\364\t\006\267\367lK\"d?\2713\255\217\317F\035e$\201Xh]\342\352\262\206\276\361*\340s\223\001\261\264\005\004\252\320C\225\013\t\031\367\246n\013>\214\373\304#\330\254;\316\017\021\351d9\240\370\215n\256#T\344\243x\023\311\265DD\243\375\034\234\250\037EY\004;\316\230.\016Pn\353\035\277\002\327\335\026\032\320\204*\220\345\r\250\213@l\231w\321\bS\202\006ug\036\215<\275\313\270;\001\035\266\030p\022\030\004\020b\340+)\323Z\327\017(O\002\206\322\220\023\343\201\266S\\\263\340\\\277\025\233\203A? \256\310\313\003\252\354\211\224M\335\211\204\340\304\222\272x\237=D\255\252\326\301Z\033\302T\203\325g\002\314\313;eI\370\217}*\250\247\3017\231\230\254\336\025P\211\277\337\013g\030t\356 \016yR"
+	.string	".\337\256XoPV/\004\244\301\215\256\274\202jeA@m\334\213\272Iuc\223T :,K\320\\\t\245|O\024\037\3053\003\302\035\031\211\3623x\330\330\024T"
+	.string	"\356*\013\004\017\361\331\024W\350\310\323\310i\376\220\2403\033\246\322\303\n\345d\356\346\314\360\334\264\016\033\203"
+	.string	"\354_*\266\202\375\325\3575IN@Y"
+	.string	"\274\342\322\212\250E\016\313\255\272\\9\027?\236\264I*N\206\032\302\271p\357\325\361\t\215c\201\336\331\350\200N\240\350\n9\311\366\300\264`\212\304\035\327\260H\t>\274\007\\\207\3254\030/\035\002;8b\310"
+	.ascii	"\301\005^x\3724d\036\334L\t\347x\240\274w\177\217\222\256\006"
+	.ascii	"\002mz\262\t\036\361%W\315xz\206\227\203\244\023\"\204{\360%"
+	.ascii	"\206*\220%W1r\016 Yi$\275\0253\204\027%\004O\013_\305\263z\364"
+	.ascii	"=\251#<a\365 4\232r\265\n\324\357\325"
+	.ascii	",\332\001\325\230\270\034|\002\255YM\343\322\250\020\253o\240"
+	.ascii	">\340N\030;$J5\230\364\022\r{\226'\365\3057\220\020D\315\264"
+	.ascii	"\20484\372\005J\240(CA5\3442\277\342zb\217V\300\333\376>\350"
+	.ascii	"\242\300>\365\007\303[\037\226\236&\373E%JTN\002^m\224\3276\262"
+	.ascii	"p\373\200<h\313\001\340\323\022\37168\205\225\313\267\023\226"
+	.ascii	"\3248\310\362|\257\267\\bW*\327W\311\257\271\306\005\002\232"
+	.ascii	"(5\274+k\006\030\002x\032-\\\325\224\311\372\217\027\017R\245"
+	.ascii	"I\036\272\016L\033\331;\210R\024\n\237\003\223\031\362\324i\210"
+	.ascii	"\276m\276g\370\250\026\035\334\245\326'\006\200Hd\3167-'S\345"
+	.ascii	"\236'\360\211\335\213=\364\034\\\257\375\234\210\343\311\234"
+	.ascii	"V\340\270\217\007\224\265\017\302\b\217\017\367\242\034\rL\037"
+	.ascii	"^\237\264+1\341\321]\310\366\241\007G\266\332\004\364Am\324\031"
+	.ascii	"1\200N-P+j\305\237\376\032M\027\204\360l\300\324\203\257\024"
+	.ascii	"\377\206e\335\271\207\226\213\205\320\215\"\334D\242\206O\022"
+	.ascii	"KL3\220R#\330\r\210V&\246\262\322\333\35385\324Gm"
+	.text
+	.section	.gnu.lto_servoTable.100.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\374\020\305M"
+	.string	"\032\205$\035O0\020[\031\016C\323/\3663)\003\261\255IO\021|h\311f\210\270\322\334\007\341\017\001f\300\232\307G\032\365\023\263\261\273\204\301\366\340\222\216\004U\242\005\r\r\bw\377\024\206\037\f\003\2105B\351|\"\00713\263\215\354M\310\336DJ\231\002\262\001\231\001\311\001GD\276\007\"\277C\3127B\371E)\237\210\310\037\"\362\205\210\374\240\224\017\204\362\177P\276\017\312\357I\371<(\177g\310\327A\371D\224\237\242|4\345\017Q\276\020\345\237C\276)\344\007O~\237|6\371{\300z\251\341\bVV\326y\311u+p\316jg\312\225mrw\271\013\267\375\357\327\205\225\223`\303\234HlI,\3147\316\327\333w\355\033\267`\226\005u\341>\227t\225\\\273\204J'8\254"
+	.ascii	"\f\327L\332\241s\315\340\006\235k\276-\277_x\270\331\021\303"
+	.ascii	"\342&\330\024\336\3121p\276n\233\374v\371\013\031\352\2625I\242"
+	.ascii	"J\256[B\322\310\254\301\241`\327\016\345\266v\\[\327\225\002"
+	.ascii	"\342\232/dP\260lM\206\253\231\020L\336\024\034\3265\251\264\346"
+	.ascii	"W\f\327\024\022\257\376{\233\024[\205eZ\260\226p\326u-v\b\037"
+	.ascii	"n0\271'bu\213\210\206\204\202\200~|zxvt\210):\024\236f\260Y\375"
+	.ascii	"\216\370\202\243\332\242\2400\n\227\r{\307U\026tb\303\347\301"
+	.ascii	"\306\215\300D\"@\220\242e\207\262\254\020\231\\\026\016\002\332"
+	.ascii	"*-\373#|\272\"el}D\020\343\236*\314\263s\\\035*`L\244\362eEl"
+	.ascii	"\341\232\302)P\336\030*|z;\262\271\"\305\203\035n\341\372bap"
+	.ascii	"\210\206\2605{\307\325Ap\305\261\214\006\333eY\253\013\213\317"
+	.ascii	"`\322\035\327X0i]Wb\227\221\315\n\344duymp\325\226\004\007u\312"
+	.ascii	"<0]^\333WV\347\220\bs#\244]\0274\013\237\326u=guI\331\033\355"
+	.ascii	"\277m\377%\370{\324\002}6\272F3\035\026\340&oc\335\340\350'`"
+	.ascii	"k\256\232\326"
+	.string	"\313\277\2649\344`\244\017\346(\2378\261\3316;\276dkn\022\252\307\217sM\033\275]\226\304\023\2605G\266\266*\016\374\300E\371u6\362LN\356\004\224j\2568\316\2118i\t8\377!Dx\263\270Wm\315?1pp\270za\377D\305\177ff\0213TfX\256\373\263\013\376\360\217\300\021\336\254\353\324\371\331Y5\325\227\314&Q\361\037\220\234*\256n\344\1775\035\320|\031\235Y\033\276'<#4t\267x_<=\033u\226\371\332}Ohf\270Qg\231\245\333\272\357\tk\b\232\347\254u\253\315l\265\022\303W\206\357\t\351\310\354F\235k\016}\254r\304\254qY\030\376\357\001`\345\b\266\256T{\344\254UEp\355\200\001\377\035\263sQ_\262#a\2007k\315/\003\347\232\333&[\rG\266\257*\016\374\223V\334\310\177\235\330\030\313\336X~\224o\004\345\027I\371\006\244|\")\277"
+	.string	"\224?d\341\366B\206\374 \273\334\003A\371?R\276\217\224\337\003\345C\245|\036(_\207\220\237\003\345\343@\3717\206|\033\233\334\327\020\362\237\026nOc\341\366N)\177\006\312oJ\3712P~\214\224\017\003\345\277H\371.R~\013\"\277H\3443\021\371,R\376\022\312WB\371+R\276\n\224\237b\310G\221\362O\020\371&\210\374\022D>\211\224?\002\345\213@\371I)\037\t\345\207\030\362A\244\374\017D~&\035P\007\365b\001nQ\321\206g@]4&\367\323\304\206j$=\343q"
+	.string	"\237\376i\2473=\275\323>\315B\217\247{\260X\213\212\306\201bYT(\334\207\206\214\2479p\254M\247w\032\351O\004\026\3431\035\235\346\274\261\266\027\373\2713mb#-\215(\240-\354\264?,\215[\2548\360\303F{\2370RE[7h\256j1\026\025\312\352\211\255y\276\302a\352V\227\232A\006\347\232\303^7i\332\316\026\266\371glc\366\331\347\322\213\255\340\250\242r"
+	.string	"\325\303\354\031X\200iA5l\322\370l\2233\330{E\231\346\212\343t\300`M\206g\017x\212:\205\212Z\245\n\273\271\2559\262\361\200}"
+	.string	"\327\263\323\243\367\313\356x;b\265\240\343\243y\264\326\362m\367\224RM\221wV\r;\177\025\251\206\300\233\325\315c\346\215\335US\235G\177\003/\025!\314\261\312\343Yf\240\202\024\356Z\366\330\271\005mx\213\243\370"
+	.string	"\3227t\200t\016U\2151`\255\034\301\023\254\302\370\021\033y&{sD\211\240\\r\330\033\026\320\006\264\326\337,\220 \rdy\033\374d\205\237\005;a\254e\220\336/\006\364/P\321z\304\330\212\257\324\261\021\324,Y\324\266\250O\211\007\246M\252\2261\225z\266\203\n\026\345\277\304k \221F\321\306\370\265\021a\2610\207\336\0021\373\247\2429}\345\354\034\265\004\365\0045MM;\327,\240Q\271\032=\244\215\244\365a\001\236f}\312a#_\243\237\232\001\225uW\034GU[?\225m\270\256k\323\267o\341\250n\017@"
+	.ascii	"\336,\001\3165\237z\313\214\001\335\231Y\n\033\031\270M\316\032"
+	.ascii	"m\004\026O\302\304$\t\004G\224\024\227H)Q\"\025\345\341I\032"
+	.ascii	"X%RS7\024\230:\"\301\224\324\r\251 \016 Y\262\344H\222(\241G"
+	.ascii	"11\221\212`\n\t\223\"\004I\030h\300\201\005\212K\0328\242\244"
+	.ascii	"\0305\305\244\310tt\251\007\220L\025!\220\222\232*\022\223U\333"
+	.ascii	"X\324v\235\334\241\331U\265\325\213\032\371\215[\0242\f\t\351"
+	.ascii	"\007\177h\264Sk9q\031\006a]r\300\333\335\340\272\256+Q#?\344"
+	.ascii	"\005!#\250\025\030\314\370\312\202bt\221\326rj!\335\023\346\244"
+	.ascii	"oF\343\251h=wEzFp\314\327\2332\357\rp\250\221\335\324F\372lt"
+	.ascii	"c\305dfW\274\204\032\371\246\216\321+\267\374\345\205f\312\r"
+	.ascii	"xu2\272\311\316\214\2146\221F\016F\307\260b:\365l\207\0061ef"
+	.ascii	"\200\3213\306\\\364\213\3463\027p\f\352\331\006\235yYk\341W\243"
+	.ascii	"0\031\030v\334Eo\334\3360\341\353\315\257\255\337\242\370\211"
+	.ascii	"\tj17\246\330-\230\232E\027u4\323R\263\220saI\251ut\210\271\025"
+	.ascii	"\235\242\225\372\210NE\257hAE\333\2750*\224\265!NE\357\036\212"
+	.ascii	"N\321\246\036\013`P\364I\346\313K"
+	.string	"Z\333\t\025\336L\364\211\022M\242M\340\350\022#\232\304\322\313\b\021\215\243C\350%u\210\026\321GzH\235\224\202\212\266|]T(\233\227D\352\345\033k\003\321!\332|\323\306\006\"XB^ zV\206\007\004\244\264l*-\373(\355\306\355n\031\273\366x\224\226Fk}\177>\264\032\nG\375\301Cw\350\243^\343\361G{hs\316\250;p9\301\250\250\211\375\243\221\316\030\217\f\302\372tQ\363l\020\310gD\201\250KP\321\212H\310j3\324DB\035\324C\275F3\250\026\352\201F\250\201($\221b\250hD\024$)H\322\032\261\005\304\030\006\335\231\007\022\240T=\n3\350\030\211\002\261[\330;\257\305\361\326\252\342\307\257>FV\031\341\202b\207/\f\343G5\303H\030\275\277\344xL\3459\223\247=\204/\350\034?\023\271&\331G\255n\315\301\n\221\t\342\361\221<x\320F\313\357\030\034"
+	.ascii	"}\322\301-%\273\242\312S\336g8P7%)\3225?"
+	.string	" @\022\204\030\312\261\343}P\303\036\300\201\244\354\245!\322\345\370\030\200G\031\275\206\236\241\311I\367\335e\343\260"
+	.ascii	"\016\266@\227\"\352\214\330\336\271=\231U\035\240S7\366\351}"
+	.ascii	"\2161\305\324K=$\347\271nN\333x,\363\344\224+\371v\267\304Fx"
+	.ascii	"\333\211\017\n\352\224\350\031;\272\236\336\321\254*\233\364"
+	.ascii	"\016\262Xw~Tm\312\312}*\245\330\205S\237I\314\247\203WH\023:"
+	.ascii	"S\272\322\275\242p\360\203\326\350;\305:\016\037\212\207\372"
+	.ascii	"\245\037G\312Ea! w\216\003\212C\362\034\331\300A\240\\\003\223"
+	.ascii	"\322\251<\317\205\347i\202\271~\026\004\203\3325\2149J\335\t"
+	.ascii	"FC\255\317\242,`t\0066\031\352\303\250\3655\350\226\227\340b"
+	.ascii	"MY\277\250\366x\335S^\256\320=\033gO\251\177g\005\221\005\232"
+	.ascii	"<W\244\345\342#&\310\314\023\240\226\031]\001\005l\267=B\236"
+	.ascii	"\201\313\337\335\221.%64\361,\244\242\032\221\203\212\013\345"
+	.ascii	"!\365(\316\341rs\261\252D\213\b\367\202\213\253\244\016\240G"
+	.ascii	"'\3372\273\273(@\210\364\003]\221\220A\334Ci\t\277\215\001=\360"
+	.ascii	"\34731\021P\324m\204\336\236t\356\276\221\270\221\033\234\021"
+	.ascii	"\203\301\230\315\372zv\220\001\255\025\365E\271\335\234\006\265"
+	.ascii	"\313Ko\245\314`\032\214P\331\373p\314\305\237\346M\222\332\033"
+	.ascii	"\237^s \002\363\002\207\200\265;V\372MC\\\203b\365\3135\326\317"
+	.ascii	"\235\261\247\210~\236P\341\334\256\252\354\\o\341B\312\240\324"
+	.ascii	"!\0217\031.\252P\346\201\364l\354\213V\020\242\267 \226\252\202"
+	.ascii	"tl\002\373D{\300\360\233\030\206\227;\265 \306\202sqk\355\362"
+	.ascii	"\026\310I\261v\034<\316\252\024Q,\n\271/\fD|8\302\3013Qzm\346"
+	.ascii	"C\204\304\3022\260\353\376\002\035Sa=\2476/\037\022\326\221h"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.101.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 \374\365\006"
+	.string	"\"\21506Pm\222\016$\223\203\310\250Q8\n."
+	.string	"\220\001\252\r^z\203\366\212\366\334\266\2663bgW\334@\036f\307\315,\022\004D_\262 \304B\301\321\207mm\023\231\002g0WUai.\310\201x\330D8\300\211M\203\004\314X\027\304\020\\Qh,\310\251*\013^\270\330\034e\026|2\033\241\315\314\202\272\254!\025\331\344vlq\367\252\225\272w\226R\315"
+	.string	"\214\317+=\347y\271\361\235b\216\376w\276w'\001\022\311\326\020J\214\242\322J<\241J<\376\316_NP\350\214\225\343\020\r|d\200FTb\344`\222\212\365a\267 e\310B)\332\346\351\003X\2101\376\264\355\242g\177\203\377\340\327\b\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.103.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"m\013"
+	.string	"\326\225PA Q\224\016\fA^\235\200\360\0278\202\220u\247D|L\006\016\365\253\026Xr\251(\3513\277j\2771\325\334\333\006\fB\371\333h4\004\300!\t\032\272\354\331\006EM\007e-O\032\331D\312\224\002;"
+	.string	"<"
+	.string	"?"
+	.string	"\236m\343\341j\005|\214\320\340\"\307\356j*\302K\357\227\246\347O2\224\017\f\375\312@\\\303\247\007\220tYv\367 O\0238\312\234dv\327\371\201\247;\336\266\002\333\006\354\027\b-k\312>\353\326\247s\342a\342\005\370\217\306\356\207\222\035\333\2120N\234u\373*\374\360+\036\342\235\345\030\337\323\236\303\352\243\304\215\335\275<\232@\366hy"
+	.string	"\354\361:"
+	.string	"\354\361\025\007io\026\362\237UCG@RB\241\252\262\007Km R\203\224:lwo\341\311vI\007|\026\027\271\340\223xt\006P\376{\364A\330c\352\202\0202R\204\210\262\304\016G\251*\222\221\016\001\030\034$\330>\334\246\313\254\301t\333\207\333tZ'\002\004\216\204\007\032\005\016\203\t\232\206\3534\314"
+	.string	"o\0256\234\326\3316N\253\204\242k\n\344\3370\202\243%\322\321\245*?\374Q%\324\214\274\\\325dS\002\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.104.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\345\003\275\033"
+	.string	"\266s\264I\240\230Q:\020g\256\361I\275\247\204\036\230\304\017\214\263\236|\340@\037<\005*X\2331v\247\020\254{\2607\376+\2545\247\374\271@\237\340\343z\360\no\374c8\037R\225\247 vP\b\334\260\2556\032!do)\223\f\232"
+	.string	"\223"
+	.string	"\246"
+	.ascii	"\265\306"
+	.string	"v/\265\037n\354\364S\247\322\275j\223\274\262\250O\321\364\204\345\245\326j\340t\013\224\247:\277\031O\347i\343i\307V\267\313%@Q%B\360\024\345#\212\251\265\326\272\306\226\237\303\357\310\272\223#\235]\262nO.\200\375\200D''\231\264\242k\006\364M\036\257.0>\344\361\370\244tJ\003t\3619\013,i\265\230\001{\363&\n\r-'\236\217\200E\334\245\322\313\3419\t\350\233:\265\326G\235@\216\025AfrA\255u\371\007d\361\205}wk\354n\320nc\005\335\302\375y\274\214\234\312f\332\237\361\335\301\nK\217\277v\327\347X?e\255\275\004\373\253\007\t\332\3378]\0207\376\357t\177\033O\337\032\202S\240\250v\\\334\035\362\270\205^R\220\266\266\231vqJ^\233\222\227\366\252\357l\362\326\224\274\262\22276yiJ^\330\344-'/I\362\216\224\227\216\274\223\362\366\344\345\346="
+	.string	"\331\016!\300\037U\251UE\261L\335\242Y8^\365\357~\377\343D\023\357\261\003\254\324Z\327\304*h:\361\036;j\005\273x\324d\270\240\364\370k\311\226\365}gh:\006u(\272\251\323\274\254\236h\321\364\213\\)\033\326m&\352NtS\317y\002\342\264$u\037MtU\364K\305\224,RK\316\204A\003\007\374\037\204\361\264lrG\260\013\212jl\262{\213\357L\016\323\336\2250a\374ol\235^\023m"
+	.ascii	"\356\236\275K\241\002\377G[\247\250\211v\217$\367_\226\205\003"
+	.ascii	"i2\362#\0270d\3100\236\316\376O\211\273\273\315\030y\331q\261"
+	.ascii	"\303\211l(k\255<{!\037\302\241\307f\033O\271?\374\0031A*PY;."
+	.ascii	"v_%\2159\022\013\264\223\003\032\352\271\325D\340n7\234M\300"
+	.ascii	"\002\225\360\020\241\\\333N\016GB\310'W\033\002\372\t\n\361\241"
+	.ascii	"&\"\250\347V\263\t\345j;9\213\033\341#T\033\302\341\204j\261"
+	.ascii	"\341\356\315\024\365\243\340\322\261\265k\036\331\302\255\301"
+	.ascii	"Bq\232\332(\r|\326G\233d\234u\023\244\0342\300p}\326Z\353\330"
+	.ascii	"\302\275\240d\322\372\304\303b,q\252\322\245cm\323G\273\007>"
+	.ascii	"k\234\316\261B*b\264T\323\033e\303M\323\326\177_l\272f~\005\273"
+	.ascii	"xU\256(\254eM\353e\2430<..\337p\232\2414[\270\262\216\365\211"
+	.ascii	"\347\240\013+/\002E\250Q \006\2312\3040\"\023\210\310\214(\331"
+	.ascii	"\001`\002)S9\036\021\2601F\264I\261\264go\337H=\r]|\200\b\317"
+	.ascii	"\021\347\024\225\301\362\366\221\307~\254\333\343\343|\326\037"
+	.ascii	"\340\363V\233\326aU\302X\bCu]@t\221\017\223Z\030\374\211u\026"
+	.ascii	"P1\205\323\f\334\333%\362\037\374\371 <k)\321\336\2112\265\307"
+	.ascii	"\342\031\374\177\031s\316g\217\373\234?\262$\245\007S\213\355"
+	.ascii	"\315\1772\b\253F\020R\262wxO\210\361J\264\236Nr\250\353\314\314"
+	.ascii	"\t\360g\212\370A\236\272\177\324>|\373\342\233\002"
+	.text
+	.section	.gnu.lto__reset_template_82.1.107.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.173.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`=\002\315\022"
+	.string	"V\344{H\320\362&\035P\203\354\013\212\343+\215B\363\\\221\235\357\242@@4\200n\230\206\374De!\316\326\031\340\350\342\277\306F@M\032\025e\006\217\324I\364%\217@?\\\211ex\347\240\230=\217\306rdE,\331[\356\224\002d"
+	.string	"j"
+	.string	"h"
+	.string	"\027\300}\312\213p\237\2369\220\r\320\216L\354n*\372?.;\225\372|\n\333.\231_v\216\207\265\035\361\341\271ps\332]\357SC\270\273\fo\215\257K\215\363\345\377\347"
+	.ascii	"\300\031\315\245D\341\310\222Bf0i\242\203\311\303o\2177\263\232"
+	.ascii	"\250 >\033\036E>Q\bv\327\035\207\233\273m\025\333\n\354\370\n"
+	.ascii	"\236\222\213\326\031\035e\364A\"mUcW\303\323\217\0051\213H<\350"
+	.ascii	"Q\006\303e\031\271\264\260\226s\0338\244\302iaa\211]\374\305"
+	.ascii	"\214eF\302Z\016\212F\215\350\310i7\364>\035vj\3373o\341\357\240"
+	.ascii	"!\371A\007\362o6\227U\260pg\262\377\370\266\360+^ga\243o\316"
+	.ascii	">C\315gD\323\356\226|\232@\367\251\nV\305\224\306>R\205\020%"
+	.ascii	"\320v\314\217\032\254\224v\327d\306\215\034<89\341>\247\036\354"
+	.ascii	"\020U\3658bMFyQJ\267\013;\340\017\235h\305\357\3714\013\213\305"
+	.ascii	"}F\275\220\b ?\306eD\360{\354\362\305\203\237\376\307}^\177\273"
+	.ascii	"DAC:A\253\211O\326\253\020N\017\242\250;\326i\242#V\302\252c"
+	.ascii	"s\250\030n\261\240\222\240s\312\352\345\213i\255\274x0-,,\t\020"
+	.ascii	"\274\t,\024\027/\245\365\342\255H\374QXiy0\337\327\362R\266\343"
+	.ascii	"U\307\366\217\341\006\017\0335jc\225\272\343\3113K\036`)r*\365"
+	.ascii	"\306\266\273\333\210\223\032\223lK\260\350\303z\271\273\253\272"
+	.ascii	"c\273\300\245rJb\003\231b\037l\342\223\007\304\253\352\002\006"
+	.ascii	"\361`- P\002al\033\033h;\332Ii;\270.6\017\210\355\270j\357\202"
+	.ascii	"\"\253L\213\300\230\227\247c\234\270\r\242wIY`a\355$\267\367"
+	.ascii	"\200\225\325\t-\016\020\021\020\227\353\030\bm\240\t7\345\313"
+	.ascii	"<\266Y0\331\335,\261\313\336`,}.\301\235\017\226\364HWY\375v"
+	.ascii	"+,\242\341\270\361\256\317\315\025\242\337\365\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\342\005\365\031"
+	.string	"\246'\223H\200ZN:[\326\212vb\371\245Qn\300\365\231?1ld?>\327\224jii\336\216\373\345#\003\221\310\207\310\220\306h\321\251\026\036G\276F\344\022\271\024t\205]\200P\214\\*21\254\353\251\324\260\312/\311\227D\246~"
+	.string	"\203"
+	.string	"}"
+	.ascii	"\027\036<\377\304\264\360\2622,\266\n\367YJ\n73'|\214)\341n\021"
+	.ascii	"\356\261\224J\367i\020\036\306D\301\272m\3336\351\376J\371\200"
+	.ascii	"U\023MS\365\313\301e$%\322W\363\350lG\036}\254\365\356\275\024"
+	.ascii	"0\272\030\263\250h+\371\326\340~\255\374\217\301\235\230h\232"
+	.ascii	"\242_6(\212\242D\367Z\312\376YE\017\034\214\271\340^\254L\203"
+	.ascii	"`\377\375\313\264\230\b\211\325\245\340\"\225\377uj\0014\356"
+	.ascii	"\333xF\3130\212q\004\365\260\247\017\235N\204\361\242\371\237"
+	.ascii	"\357c\346_%E5\345\344k\222Z\362E%8\253W/N\326t*.>\205"
+	.string	"\351h-~\306\342PV\274\312\322\245\230*\036%\305}\027\024\367\\N\374\214\211\373cY\342L\270H\334\263\345\bNE\360/\304\223 \330\352\303[\017_cv\270\0327\016\367[J\241\037B\255\r\367\306R\303\315\230\377e\270\0256\002gu\206\341^\255\374/_\262k\035 \367\214%\225|\270\353\235#\343\030\323\214>A\255#\344\237\266,2\237\240V\372\352\3238k\030O\343\250B\236\236\243\221\370!O3\360\301\234f\366\350\246yE\272\351\"\332U\220\236\331:`\257\233\215\270u*w\021\210\334Y\321\233\307=\334\216{4:.\243U\367r9\356\313\340\270\177\273q\217\264qO\206\352\362\325\324\375\234\324}\232\032\367qQ\367_\030E\321\177(\347\224\211\220X]9\b\032\352\310\274\225|33\317\206R\331\006\035\236\375t\204\313\"M\324\024\373l\237\372\341\331L*s\333\266p\354\220\220J"
+	.string	"8`\025\300\002\251;,\227\255\033\033\333;[g\315a\331\037\257\255\271\336\331"
+	.string	"T\376\311J\322\243w>(vv\322\315\331\006\270yg\357\254\274\363\032\0229\221\327\272!\257Y\270\343\365\314\245Z/\362zJe\036\302\025'\344\304]\003\261\001\326z\250q\020\tc\211\002\031I\222\024\322\030\300\002)1\342\034\021\320\240\225\210\231\021\tD\202\026\024t\220%\345\235N\002\006\r\024\223\214\246\222\327\f\211\2019g\203\003\245Y\255v&HN$s\351\362b\357\034T'\254\367\273\263ab\227.\0246,%B\271oA\346B\006\037\363\2467xw\240\f\220\204\276\314\314O\345\244\347R\362S9\351\225\353a>+t\340\r\320\262e\006\363\b\241.*c,g\236\215\343t\b\017\243B\240\025$X\232\326\"\323\231\214\006\034/\302\214\361\260\335\027"
+	.string	"\213\212\372Z\253\326uK{w>\256\221\255\334\215\321u2"
+	.ascii	"\265Ts\347\313\323\265j\255\033o\336\t&\"\234\342?w\333\027\355"
+	.ascii	"\223\377_\203\031\205\2765F[\223:\365\\<Hz?\316\3340\362L\255"
+	.ascii	"\030\006\235_1\207?\227\205\275\323\001\252\001"
+	.text
+	.section	.gnu.lto_.refs.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`\320\001%\017"
+	.string	"6\244eB\020\217&\351"
+	.string	"\002\270\326TEL\244\fW\346\006vY5\352\032h\204\252"
+	.string	"\004\222"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M/\343\032@\213)Fx\213"
+	.string	"\322~\373\337\333\377\255\255\0263\377GO\337\222\326v\3332\005L"
+	.string	"T"
+	.string	"Y"
+	.string	"\324\365\365\374\321\214\301\272\205}\245}\225uJ{\314\360b\315p_d\317xzz:b|\257;\325}\003(\306}\305y|o\362\314\340h}/\326Pcd\327\274\317\274\25728\225\030\353t_\353\n\257\362\233Sx\"\266\217,\001\356Q\334\227\230~\304}\210\306\237\266\347\330~dz\221{\254\364W\3517\245\177\244w\244O\322wt"
+	.ascii	"\221;\240\337h=\003\352\251uJ\353\250U\344\016\240\b\032\300"
+	.ascii	"\020\004\301\002\370\201\004\020\204y\024\352\242\320\177B=\013"
+	.ascii	"}\347zM\326-\320WXO\320\007\333\237\336wl\257\361\336\324\361"
+	.ascii	"\243\354\242\367!\367\032\3473\336{\262_\357;\3567\234\177\217"
+	.ascii	"\303tW:pP\341|3`\270`\001\373V\240\220\275\023$d\337\b\020\336"
+	.ascii	"\367\201\203\215\336\006\033_\006\033\375\026,V\250H\361~\024"
+	.ascii	"'Jd\377K\366]ZX>\270\177\203\373\224\217\t\320B\024\n\001jx\202"
+	.ascii	"E\023|XB\221`\007\216\340\265>\365z\036\320\027q\375*\371\n\362"
+	.ascii	"O\362Ir\220\374S\276G\276(\377\223\217\345w\3627\002\376\245"
+	.ascii	"\307\365&^H\214pi\t\261\375 V<\344\257a\373\005\357S\262\243"
+	.ascii	"\344\233d\027\311\377\b\" \240\242\302\332\016<\306\027\216{"
+	.ascii	"\314\265\266\354^\341\367.\303\212\223\255m\357]\352\256s\027"
+	.ascii	"y\220\020i\\VE\2258v0\243\200A\001\365\026\360\024\020\f \004"
+	.ascii	"q,\030\001\017ax\301\020R\301\302$:\004\362\342i\264}d"
+	.text
+	.section	.gnu.lto_.decls.b1841bbbdffcf522,"e",@progbits
+	.string	"(\265/\375`FW\215m\001\212e\256\204U \fQ9\351.\211\202\246\n\317\263\241;v-\330Q\316\347\232o\236\306\235\357z\315\212\273\240R\024a\331\354\376o\263Kl\266Z\232\221_q\3025.\235nx\274_\016|\266\030\261\212\331\034\034\320\r\fu\266{\276\342sQ\371\237\271\251M\032!{\313\235\002!\0079\bc\bi\b\013\224\036\233Q\217\343\230}\306\004\310\243\f\013.lL&GoRkK\336L\244\364\300\230\223\223\321\270\225"
+	.string	"\203t%1k|=\253\366?\210~\355\241qSR\326H\310\372\b\227\262\216G\331\311\254\326L\261h\334dV\355\226\335\251\351k|\2756\362?\210\237\342v\2301\202\203\307\313\217\251l|\\CH\017\031\313\261\033#%\327\3708J\310\030\323\030\256\246\306=\026\004Ma\306\214'\215;H7\220^\276\203\364\217\203\350\340:O\035\004\347\334d\255"
+	.string	"x\254\025"
+	.ascii	"\372\366\243\251I\212\217\363]\213U\375\265\3255\376\215So\233"
+	.ascii	"\035\266\343bQ\221A\326\270w\350\320\311\032\354\214\252\031"
+	.ascii	";\032\203\3514eI\371\322\370\327\212z\275\376\372\037\344\211"
+	.ascii	"\243\213\242\343\253\275\270\260=)c\246J7t{\215\377\333f\343"
+	.ascii	"h%3\013a+iqe\215\177\317\324\3371\365\357.)\351\f\250\276\266"
+	.ascii	"\306\277`*\006\026(\375\335R9h\032\033v\330\214q\"k\374\267V"
+	.ascii	"\3178\221$?i\234\305\304\331\002&JF\343_\030\352\255\231\023"
+	.ascii	"\232g\316\271\257Z\252\251\356\231\225\352\244I\231(\233\307"
+	.ascii	"\323\344\223\237\234\314\364S_5\224\315\373:\323Um\325)4V\307"
+	.ascii	"h\031\266\331W\375\0023s~\362\263o\272\211\207\311';\201\251"
+	.ascii	"[\272\351\253\206\321M\227\271\004:q\262{\346\2349p\340\300A"
+	.ascii	"\210\003\007\340\222+5_x\360\273O}\333\251\335\242\247lsC\273"
+	.ascii	"x\263\260T\036|b\346f\316\314\236\340\23046\326\032\277\305\250"
+	.ascii	"\267\033\322\236\277\277\277?\273!}\277\251\330\002\245o*\352"
+	.ascii	";\212\312\201\rJ\337j\252\375\353l\233B\3154\347\004\203\253"
+	.ascii	"\361\233\211\232\202l\205\322\377Y\241\364\215D\375\024-}m"
+	.string	"\230\3122\277\306\266\315o\371,\033\233g\225\030,\224\335\2136\215[i\203\322\f,Pj\367\206n\327\360\\\225\245=i\374c\365\350\324\032Y}M\324\244\261_\376\260\332:\315m\236U\346\f%\347\214\241G\217imLc{g\237\266\231\301\342\345\036\233\027\346t\325\370-DEA\3166Cj\377\376l\206\364\267v\031\200G\250\334\320QwA\0173\353E\216\306\277Es\206\304\223\371\244\261\231\034\24630-\215\3379\324[&L\253v\231K\240\223\2577\277\025c\313X2v\214mZ:\373\345v\316\202qBg\2374\361K\300?tKg\247X\347eN\251@\0237\317% :\260t6\214U\343ab\346*\340\327\037\326R\210\003\007\016<bnzP\341\340[3\252\3156(\365\211S\275\bY\275\036co\032\337\266\251O\200\025\225EZ\3373g\346-\225\177(\316\276Y.\227\271\f\262"
+	.string	"\363{\346\234\377\333.\026\316\312\331\246\215\263Wn\335\254\22373\347\247\234\363-\333?t\033g\253X)\2279%?9\315=\240\251n\312\217/g&\007\016B\034P+\033b\344T\374\333,\267\\\354\226\0232\006U\353\211*\253\261\026\234\325\005\fH\343\333,\325b\031\272\315\002\224Zi1\363Z\316\271\007"
+	.string	"Q\336\2504\006Z\240\364\266J=\n\324'\251?A\305\300\006\245\377\200\252c\201R\333f\241\330\246\0066\312\355\232e;\332\304\314\314\234\231=\335\303\217\255I\343\227\240\336j\220\336\277?\253Az\b\250>6(m\013\224\336i\203R{f\321l\363\002\233v\020\035\3742\241e\263\234\231=;o\312\336\3645~\b\365\266\3111\314\345\016nA\275\275 \265\177\366\202\364\255\376i\203\322\363\331\240\364\267J~\233\304\232ip\245\250\224y-g\346\217\372d\245\315\254\361\2316(U-P\372_a\024\233s\241\374\375\201\001n\333\177\331\222p\027k\241\302\323\037W\240\331\344\277\034@\373\233\001\177\027\335\263\377x\036\370\373\203\033\340\031\374\370\354o\341\005\353\b\334"
+	.string	"\307\3711\334\337OC\360\217\032Y\277\236\236\277E\250j\020\360\204`\327\314\3045\374\001?j\202\275\200\355\371\257\215\244\034{\254\360\333\237\377\336\270)\230\277E\252\177\203Y\277\377\242\200\311\337\377\033\375\355\337\337\024\270K~\353l\034W\211\r\373m\220\337.\377\356J\341o{\301\177\r\372\001\327\354\267\036~\001\003$oY\032\236\335\372\t?:d\342\016\251k!9Nh\0367a3p\002\374(\b\256\301\004\334\343\277$\204\374\307{\230\233\371\231\013\374\027\342"
+	.string	"\036b\227\220\354\323N\200\202k\270c\377M\274\202\037\335\240\243\260\254\t\256nVW\335\036\036l\n\023\017\300\217f\2706z\352\036\177{\002\024\360\370\237Vw\305^\341Gw\376\026\202\375-$Go\340\032\3756\347\313\202\200\351\357\246\353\365\367\210\213\343\267\036\376\233\260\031\370\237v"
+	.string	"\374\270\317\002\375W\251\301M\\\347\307k~k\341\2777\032\004\366\002\"n\327oy\376k\343o\241\277\211,~\213\001\303\345\372oV'3\374\270\314\337U7\205\277\315\376+\203\355\306\270X\367\352\272\370\355\324\3370\200~T"
+	.string	"\177\237A\375M\005\354\357,c\177\237\211\375\235d\305\337GF\020\343\357\265\337\"\177\253\364\333\021\374\366\370\333\244\337\"\375\326\370\333%t\206\217\252\240\377\302\260\030\244\376w\340\301\037O \004,n\324\001\246,\n\356\277\363\247\r\370\257\345\177\334\377-\377\345\340o\fP\377\303\374\037\363\237\356\\\376w\021\363\337\3135\370\257\341g~\341\307_\377\305\377\005\3767\375\357\375\257\375/\372\337\340\345\320v\177\377\375\375\346\357\f\374\367\351\177\317\237f\340\277N\377e\372o\n\376\213\302\177\221\377=\372o\321\177O\374\367\204\377v\340\277%\376K\201\377J\340\277C\377E\300\1779\374w\303\1771\370/"
+	.ascii	"\376{\341\277\026\376\253\363_\234\277\265\374}\345\357*\177"
+	.ascii	"\267\375\315\3667\332\337f\177\223\375\235\364\367\220\277\227"
+	.ascii	"\177\003\371\333\307\337<\376\016\373\033\354\357\034\177{\375"
+	.ascii	"\335\3657\327\3375\376\326\372;\353o\254\277\255\376\246\372"
+	.ascii	"{\352o\251\277\243\376~\372\333\351\357\024\374}\202\277K\360"
+	.ascii	"w\212\277\223\177+\375]\374;\004\177\257\177\237\3607\b\376\366"
+	.ascii	"\300\337\034\370{\003\177\233\3607\001\376\316\300\337\024\370"
+	.ascii	"[\204\277s~k\202\337.\375=\342o\021\277\275\360w\004\376\263"
+	.ascii	"\371\217\367?\357\177\224\377f\376\006\341o\007\3746\347\357"
+	.ascii	"\017\376.\300\337\031\376\306\360\337\304\337\026\376\247\375"
+	.ascii	"\375\363\267\316\3378\177\007\377N\177\273\346\267c\277\345\372"
+	.ascii	"m\326\377\021~\213\365\333\253\337Z\375\266\352\267(\370-\n\277"
+	.ascii	"M\361\277\204\337\022\375\266\304o1\360[\241\337b\370\337\346"
+	.ascii	"\277\232\377i\376\327\375G\363\377\314\177\263\377'\370\017\367"
+	.ascii	"\037\203\277\277\277\277_\307\354\347\t\3617 \002\001V\360\233"
+	.ascii	"\3159g\255\314\204\327\201\2153\253\r?\276b\233\370-I\025\346"
+	.ascii	"\214\0362(P0\025\237\354\204\346\315\263GK\214X\227)\307T\202"
+	.ascii	"b\326\230J\334\376\007\203Mi\264l\270a)6f0\261\231\311.\304"
+	.ascii	"\306\270\340(\366K\020\031A\334\032\277\307K\305O2\340\270\265"
+	.ascii	"i]5~\017\225\272\326<\203\243K\343\363\370\251X\255\207HU\216"
+	.ascii	"-\215\317\203\247\342&\227\0331g\343\363xQ\2319S\272\330d0\361"
+	.ascii	"YPY\243IS\343\363da.\261M\274\244\337\004\245r\306R@\031\016"
+	.ascii	";,\276le\325"
+	.string	"\341<iJ\314\330\370e1\3228I\024\036_G\032\237\307\210\352C\356i\347\304\266\246\230\205-\3612\324Cn\311\265\224\363\362\004bD\356\271\303.\261xy\362\270\033O0g-I\246\030\301D0\031.\303C\360\021\214\004\217\341\"\266\211\205\340 \307X\b\376q7\236'f\366\001<\363%/Gk\212\024\235\005|\236\031\352y\244\324\363@\251\347iR\277\363\247~\307\215\372\0356\352w\366\324\357\244Q\277\363To\313,\336:\316\201\301z\206\315QV%\300\360xf+\031\035\276\323E=\346\3026\216\273\336\205\277\324\2343\0233W\t\r\301\263\303\342\313ZZ\033\200SKh\330\300^\307_\267\3539\032U[0\016\036\254\256\027O\214\003+\355\336\232\326de\265\005\333\215+|\243_\360 \t\022\004\252\361wz\250\377\355\373Os\223U\316\031\013ef+'\235\364\267\267\250\265\033\376\035{\355"
+	.ascii	"\376\343\234\277\2005g\2477\272\234\263U\243\016qk\332\302 \243"
+	.ascii	"\316\234\237\274\230 \340u%\325\364\272\372\221z\362\232!\325"
+	.ascii	"\364\272\372\221jze\246' L?V\331\213I\252\231\363O\3169\347\247"
+	.ascii	"'&\021\312+\251fS\376\221j\346\253\f5we3\323\213)?)\363O~\312"
+	.ascii	"M\271\251\274\302@\352\311\353J\252\331t\365#\325\364\272\312"
+	.ascii	"M\257\354\223\237\232\254Z<e\253\237\334\364\302\313M\345\225"
+	.ascii	"\217TSy%\325\364Bbk\2640\203%\306\025\272\035a\366\213\324S\206"
+	.ascii	"\361\202\253\311\312\307)\305Tf\272\234\355ZT\266\312\316\234"
+	.ascii	"\007\2203\227\322\212\256i\206\235\342\344\204\341\004\245Ii"
+	.ascii	"\2319\347\f/\234\276\224\371\311\311d\263S\212\2102g\"NG\371"
+	.ascii	"E\3169+\200\211\351\314b\326\311\224\203+SE\345\\Af\346\374\""
+	.ascii	"g&\233\2359g\246\2343\320\212\213\231s\r\037\251\345\213\027"
+	.ascii	"9k\t\275\310\\LT\242r\35653S\256\244\232_\312!*j\315ef\301d\262"
+	.ascii	"RT\312\274\314t^Vj\223\351,S\345\234m\032uy\025#\257\361u\360"
+	.ascii	"j\320xf\205\301C\337\322jDe\341\031]f\006\004\316\231\205e\344"
+	.ascii	"\204!\363J\323\370:VT\034\343\267)\253\213\033\026\276\n\232"
+	.ascii	"\271\320\221\205\255l\023_\341\252\203\350\300\f_a\030bW`\366"
+	.ascii	"r\244\204\271I\001\343\353\370P\257\263C\375\361\013L\205\375"
+	.ascii	"\220(\211\201\251l\236\355\251\221\365\303\205\320\0317]\344"
+	.ascii	"\032\377x\252\305\006V~\350h\334\342o.,u\267VbH\305\324\200\242"
+	.ascii	"\243q\037\263\300PO\226i\2444\276mp\346i\362\311\031\210\034"
+	.ascii	"\216\302O\266\211\2410\024n\302N\326\031\206\221h\311\300\001"
+	.ascii	"?\341\373\342\222b'\233g\201XW\316\2524\276\316\227z\313\346"
+	.ascii	"&n\371\207\231\356\033\333\304\371\277l\372\211J\237\315\343"
+	.ascii	"AsVv\301\371\372\331<\236&f\266\302\35116G\204/\347\314A\210"
+	.ascii	"\003\207\343\022\260>\025_\007J}\316\237\372\234>\3659j\324\224"
+	.ascii	"\317)o\215\262\361-\233\331\231\245\235k\022\327b\376\346*\263"
+	.ascii	"[6W\2216v\356Ln\331\\dw\313\234\231mP\220t\223uj}@Vw\317\\5W"
+	.ascii	"\313\255\273yW\357>/\334]s\267\334\270K\346\246\271f\356\336"
+	.ascii	"\355r\355\256\334Es\277\\\272+\346\342\335\271\353\274^\356\230"
+	.ascii	"[\346\202\271\\n\030\333\274w\367\355\027\313\315b\226\306ey"
+	.ascii	"\346o\256#|T\234hy6\327\220>\264.~S\254\032\223\016\330\244,"
+	.ascii	"/\323\252y\261n\376!7\273e\315\316=\211\262\274\273V\356\025"
+	.ascii	"\236\233s\016\263K\204\312\222\345\020\2246\2665\267g\316\314"
+	.ascii	"\241(O\226N\376!)v\013[?\251m\271D~;\327\204c\362\333\271%e\236"
+	.ascii	"I\254\032\317\315\271\013\315\262\312\007H\224<\357\335Ub\245"
+	.ascii	"Xg\030\004\314\314\334\273k$\310\025\023+\276\234\231B\034\354"
+	.ascii	"\0306Q3 \200\333i\203R\004X\240\3649o\352\275\242\006\034\362"
+	.ascii	"\007#\257\361s\334\324\347(Q\237\323C}\216R=\316\237z\2341\352"
+	.ascii	"q\256\250\307!S\217\323C=\216R=\216\f\36580\324\343@\251\017"
+	.ascii	"\272Q\037D\243>xE}\320L}PL}\220K}\320I=\235\rJ\257\256Q\257\236"
+	.ascii	"Q\257\302\251W\323\324\253e\352\325\035\352\325\027\352\201v"
+	.ascii	"\352\201X\324\003\227\250_\263A\351\2018\324\377\n\271cm;\334"
+	.ascii	"\274t\335\033Wy\227\035TS\204\211\3318\210\032\204\256\205\226"
+	.ascii	"\306\007\306P\377_\261\373\343\366\270>.\017\333\274@.\330\257"
+	.ascii	"\216\273\303\t\216)*_RK3/\026-\206r\334\215\347\311'\273\200"
+	.ascii	"\372[^ 7\354n\326\271\226\241\316\020\200\307\\\243\206/\347"
+	.ascii	",\204\307\025FN\007?\335S\255\322\006\245\026,P\372\224N}:F}"
+	.ascii	"\032F}:\247>u\252\367\003\013\224\332\265\241\337\256;\005K\224"
+	.ascii	"\033\033\\\250\335\330\237\032\0325\356\226\315\263\031\234\234"
+	.ascii	"\314\306\326i\203R\r\026(\275ZC\2774:\310\032\034\\\343\235\031"
+	.ascii	"7\213\305\215\246\227\3067\353n\255\266\320\363k\323\370\312"
+	.ascii	"\030\372M\341\203\0369\2204\2767\206\237\352\326\344\204\302"
+	.ascii	"\f\236\021\313z^\255\371\341\343\356\331VU(Z\230\0222\215\377"
+	.ascii	"\313\324t\235.\f\235\013\246M\211\224\306/Z\t\223\224^\343\247"
+	.ascii	"V\324;u\243n\213/\270g\316\314;u\237\270,/\325ua\233w\352B\t"
+	.ascii	"\251J\266\252\266\024\377\267\305\225\n\272\2611E\246"
+	.string	"\027\324\241\203L\276,\332\214\224\252,\326\370\251\024\365\351\231\372T\210j\301]Z\240\364\346\241_&\2354t\315\262\306\025\374\275\001Bi\336\221i\323}\355\246\375N\300aM.n\367.\313HUc`\266A\351\237\026(m6C\3576\351\0336.\326\032\367\360\335\341/8\366x\254\371\336\224\2460\250\306z:aj\250\241\322\370)\230\372~B\263\326c\310(\211Z\262l1\r\305$\001e\220\250i\274\316\3534m\327u\375\264\315\276k3\267X\372\314\023\333\235}c\366\354\340\256\351\254\232uj\345\013&\t\326\222,g&\207 \214\264&'\037\374\024\207\032\302\006\245Oe\250O\243\324\243m\324\243jT!\033\224n\3500`\3320\351\023\322\030\314\377\367\234\216\322*?\345\221)\223\326\370K\330\236\224S\343\243h\324\377\335\245\345\332\213m\266\263\261\b1\237\2007\253\366c\2313\363\035\264\263\257"
+	.ascii	"qv\226\216\313\240\310\323\256\n_\316L\245\035\233\030\025\377"
+	.ascii	"\035\007W\345M\036^c.D\302\362\2544>\332T\267\264\226\216QF\314"
+	.ascii	"\256\361\321#\352\3211\365\250\230z\264K=\232\202\372\267\225"
+	.ascii	"W\2212R\225\033w\225\246\202\321\224;\351\225 V\2264>\352B\375"
+	.ascii	"{J\024\254\206\016\355J\343' J7\255\032\330\324\263H'\201z\321"
+	.ascii	"P\232\255\235\364\223\226\322k\335\326n\266\331QZ\371Nk\265\013"
+	.ascii	"1kl\275.J\f\r\266\216\322M\\\330\271\036M\004\006\030\214\346"
+	.ascii	"\262\321]!\242\254\202,\304h=\255\331?d\326h\326"
+	.ascii	"\251\345\223\237\322\250\226\315\025\245o4\017\rNR\271\351\013"
+	.ascii	"\003*O2r\034t\202\370\220\221U\001_\246\r\nO\270\266\274<u\332"
+	.ascii	"\365\240Qqa\3238\225\313\322\202\211_\343\264\313\335\264\240"
+	.ascii	"Ey6\276^0\225\253r\323\246\3613\364]\271\222r\261h\271JC\226"
+	.ascii	"\253<5:d\236ud\266<\345r7\035\251&=%\215\323\267T\313\027[\231"
+	.ascii	"\254TK\232\205J\216\260\246$:n\266\362\310\244Xp\220K\304\013"
+	.ascii	"\211\263\f\224\247S\240\244U\254\236ef-%S^\001n\300\365\310\343"
+	.ascii	"\313R\\\033\214t\334\210\243\362\264J\\\372\2276\305+u\003\222"
+	.ascii	"\021\003\207\3268\225\202n\3058C$\312\037\324\t\213\223\313k"
+	.ascii	"\374\fC\324g\360\341\304I\372\304\242\345*\353D\212\013\"\300"
+	.ascii	"2l\2440\331l3}r\275(3\267\306\351\232U\243\301l\361\274[\021"
+	.ascii	")eO\032?C\327\220\247G\206\244i\027\214NfB\313U\300\266$<\272"
+	.ascii	"\370\262\224\326\006\036\027w^`K\236\246=m\202\350\340uE\035"
+	.ascii	"jj\215\323&\267bi\324\244\032?=K\321\376`p\f\r\2247\215/\364"
+	.ascii	"\247\246\314\rl\264\301\341\246\361S&\377\2038as?\2124n\373\267"
+	.ascii	"4U\322/\252\024\261\32185\373\335\377\340\016\224\2630\256\306"
+	.ascii	"\327K\223\374\017^\271/0N\215S\262\264\3146\017\227\"9\263\207"
+	.ascii	"\247\n\0136\270\306\027\342So\017\227\246\300\036.M\213<5\362"
+	.ascii	"\007\203U\272\300\274\032_\350\251\376)\221?\b|2fk\331\370Bg"
+	.string	"\324\013\205IS \351\230\220\222\t/\003='\035K\276\234\2656\344\210\315\210\361\324\370O\227O\307\266\344\f\2511\207\243q\032\004k\375\017\366\310\260\352\343\022\032\242\376\251\217\324GS\211\220\233\2566dq\362\272\302\227\255\264t\270}\\t\\i|\241&\365Oy\244<\354\231\rQT3\275>#x^O\303\274\322\251\324\352\204\334\246\306M\243\231\211\221k\234\352Hw\200\345\370\212S\377T\231*\373\215\013\264\005\226)*\246\326\323.-$M\266\202ZgOg\215S\256\324\306V\r\032\030\300\324?\315J\263\260\031.\300\032vFv4>\206\252\024\306S\031)\214t\352DT\020\f\030\033\317l\305\325A\315\352\262$\254q\212\225\306H\257R\253\264\352B\033\365O\251R*\314\366)bKjD5\376\005:.G\315\240gP4\266\211rI\247\206\234r\223\030\002\216P\2610h\354\2055N["
+	.ascii	"]\320h[k\374\013p\352\255Y\035zw\346\371D\35548I\211`f\346\231"
+	.ascii	"\006\325\263\3160\b\030\361\262\006\375\223r\367L\235P<\324\216"
+	.ascii	"\207\351'\347\034e\226P\251T\312\"}J\233\322(\333L\235\320"
+	.string	"\275\243gP4\027J\235\320<\272g\316\3141zA\234<\270\356u\032\234\244DXR\367D\377P>\364\215uj13VN\224\271\275.\2764\247L\266\211\376\255e\330\351+\303\267$\305?\372\306Og\312\324\026\213\306\250\233&\234\213\034\215\177!\211\372\243ml\023\355c!\304\017Hc\224\315\353Z0M\271\270@\246\376\202\020\365\027\300TT\215*\346iC\256\361/\334P\177aK\375\205,\365\027`\250\277p\207\3325\271\250\221\263\003\323\205\312\251\361/@\251\315\004J\3211(\035Z\346\017\366 \231\242\243\255\361\203\374\324\243d\376\007/\300\303K[cl\377\226\242a\216\212\371\203\r\027d\371\242\361\203\370\324\243s(\230?\310C\007\204\355\254\361\203\236\352\321/m\177jh4F\235jT\320\234\00686\244\334\330\202;\352\374\257\326e\202z!\301\237\337\232\306h\027T\356\250\0274\016\365\242"
+	.string	"e\316M\250\227\036797\365X+"
+	.string	"k\005\200\221|\005y\222\342\007uQ\255\333\320Q\270\0349,O&\215\037\344\004\013\212\005\325Bc\357\013J\234\030\232\245\375Nx\023\243\007X\343\007\031\271r\205jG\024\333D\243\240U\300|\350\244a\021\2012\345(\225\037\225\202\2725\230\026!X\032\333$CG\247\364\200q\323\003\322\370\362\331\240\364\001\026(}\220V[\233\226 \250\246m\242M\224M\004\237\234\277\350r\260\252P\21599\272\366\243i\250Z\373\235p&\216\nH\343f1t\324\t\316\261W%\244qk\331\240\224"
+	.ascii	"\317%\266\211.A\321\204|r\006\223\262D\351\356\304\260a\036="
+	.ascii	"\373Q&\226I\373\241VXP\370\032\203\030:\312$\273\202\203Mc\036"
+	.ascii	"\013\224\336\202\027$\266\211\"A\3156\370\344\374\345\267\314"
+	.ascii	"V2:\354\355\260\320\261W\205&i\277t\214\230\333^\343[\250R\304"
+	.ascii	"6\321\"(\231P\3161\020\300\204IF\207\275\023\262\204\311\022"
+	.ascii	"\205\0329z\344\267X\372\214N\230&\2522\215\207\206\216\032\261"
+	.ascii	"L\372\316\2624\276\205\246\212\nA\205\240C\2029\353\2451\306"
+	.ascii	"\324\267-J\300\032\243C\306\206|Q\215-\227V\315\242\345*\034"
+	.ascii	"\026s={Fl\364h|\013@\200\334\240r\251\230\262t4\276\005\032\352"
+	.ascii	"\217\372@}`\266#9wnF\3164\276\005(\036<\260\263s\316y\tt\022"
+	.ascii	"\004\310\023\250\215\372\243;P\032h\030\246\202@\213!+c@h\324"
+	.ascii	"\003\305\251\177giv\026\334B\004e\276\n\241$\333U\361\312r\263"
+	.ascii	"\225\243\211\346\300m=Qp\314\021Q\347\336\264\330k| +\352\217"
+	.ascii	"*o\233\250\022\365j\264\314\204s\367\205\211\025\210&\250\255"
+	.ascii	"\306(\216_,7\313\373H\225\257\264\306\007ZS\017D\246\376h\227"
+	.ascii	"m\242]wL\004e\306\n\221\306j\215\232\340\2266[^\032\037h\251"
+	.ascii	"\376(\027\312u\263DP6\215\205H\202\206\004\0130M\023\336V\343"
+	.ascii	"\003\265P\177\264F\023\255a\245lP65eP$O\375\322\322\005\325\370"
+	.ascii	"\025\330\240Z\250\026v\326i-\263\226\326\206`Y\263\215\035*\003"
+	.ascii	"\225\201fe\230\361%E2\267V\206\246p4\253o\357I\221\nq\352\217"
+	.ascii	"b\241XVMH\311\224\207\001\023\254!|\250[\223\031c\215_a\f\205"
+	.ascii	"a\233(\f\324\212\003\2701\256\016Af\030%dh\025\276\321&\206\036"
+	.ascii	"~QF\214\252\361+\200\241T(\025vf\270*!\347V\326\370\025\254\324"
+	.ascii	"\037\235B\247\372M\005\253\t4\331zf+\255\016=\345\315X\343\377"
+	.ascii	"\344\251GY\330\373\324\274OVM(3\345aPv\305\354pk\325R4\n\215"
+	.ascii	"\302N5\013\371]\265\f(\032`]\324\277\257\364\225\277\211\220"
+	.ascii	"\233\2568(\033\313\035~\224\teB\235\256\2242c\205H\302\325!\247"
+	.ascii	"\215\027\272\027h\023\212#\215\237\017&\024\252-)o\215\377\203"
+	.ascii	"\345\357\017;\301h\371*\247\n\207\035\226\216\337\326\323]\343"
+	.ascii	"\377\244\371\371ag\003\234,y~\371\361v\243\361\177\220\360\361"
+	.ascii	"\341>\021\230,\350\235!\307d\211\302m\216\373\376f\266d\023\323"
+	.ascii	"\030\263\371\033\234\334\327\215\277\245@%I\227\306\377\351\241"
+	.ascii	"\376x\357\266\211\367p\332\225R\346\030\033\336\2368B~\270\201"
+	.ascii	"k\374\237\255\274<\254&\230\2552Hse\207\305\227\222\365MeIs\254"
+	.ascii	"\306\346\355\324\311\300\221\226\302\377\240}\342'\027\243\361"
+	.ascii	"}\362\324\037?m\023?\233J\004e\023V\006i\226Z:\360p\261x\321"
+	.ascii	"\327\370>N4\330\016\rv\2469[\246\262\312*kYm\250\253\303N\233"
+	.ascii	"\255\366\322\024p\034\345\350\002\323\370>n\352}\216\250?&c\233"
+	.ascii	"\230"
+	.ascii	"\f6c\257rn\322\312`\b\225t\314\231\363\254\261\231\037\323\341"
+	.ascii	"2\230\206\215\023\203\025\3278\275\363\206\372\3439\333\304s"
+	.ascii	"XL{\345\240\331X\3303[Yu\020\363c08\f6\353\f\205\013\214\306"
+	.ascii	"\025\262\rJ[i\201\322\373\304\360\342\005;\357\223sv\312\271"
+	.ascii	"\313F:c\354z\307\3169\"@\2364\276O\224\372\343.\267M\334\305"
+	.ascii	"\266\331\240\314X\030\024q\222\221\343\313Y\253\303\216\221*"
+	.ascii	"4\274\032\277\347\017\016\316\236A\245r\276\032\300\335\331\016"
+	.ascii	"\217-{eh\266l\331\032\353\241\242\3768K\023g\261iP\251\3344\226"
+	.ascii	"\301\021<\255\0168hK,Y\032\277\247\315\312\0039E\342\360\030"
+	.ascii	"\\\221N\f\223K#\b\375\344\230P\264\"\235\030\026%\200$\221\201"
+	.ascii	"\205\037y@\036%\207I\253QqX\002\347G\036\220k\2211IHt\374@\204"
+	.ascii	"\"\203\0044@\302D\b \b% \002\003#\bC(!,\201\304OrE~X\217K\311"
+	.ascii	"\341\212\002H\302G\311HD<\232@\002\215 \301\002Ib\221\004\320"
+	.ascii	"\n$%%\020~\220\206DG\311a\322\007d\222x\342\303R\321h\003\025"
+	.ascii	"KE\"\322\006\n\360@\350A\b\025\037\222\310\242\221\bE\221,\022"
+	.ascii	"\217H\351\006\222P0*\022\217I\344\207\265h\t\211\250H\374pD."
+	.ascii	"}\270\200\204\264T,\032\213\300\244p%\001\021\231\242`<\036%"
+	.ascii	"\215E \212\341\212\204W(\021%\255I\351\217<\254\210@r\235\200"
+	.ascii	"\205\037y\260\200\t\022%|\020\001\221\021)\204\365h\f\241\307"
+	.ascii	"\307\202\nV(\031C\b\022\"\225\214!\374$\177\344\301H\211\250"
+	.ascii	"\270\224SD\321(Rh\244\244\223\024\026\215\224\320\242\221\322"
+	.ascii	"]I@Db$r=\026\025\r\201+\224\214D\370\230T\272Ek\321\210\2104"
+	.ascii	"\004\026\255\310%\214\004\376(4"
+	.string	"R\362\260s\034\036\021\341\025\307$\222h\264\226\bZ\221\214\212\304\022|\220\206K\"\210H\253\b<kq\210\244t$\202P\301\250H\334\200Q\221\270\002i\204\005\037\022\021 \036M\354 \215\212D\244\tHb\005\244\321\020i\204Q\221\230t\034\346 \223\304#\n9@+\322\211\241\211\035\016<\364\250\311\"\242\022\360G\036\220H\306c\262h$\022\022i(*\016\223\222\214!\020\035\203E\306\021zpT\020G(\032\032-\360\363#\017D\302\343\007\"\024\001@&\207I$\0162\007\003\353q\311\002\321\005I\306$r)\204\242\241\021\311\0022\035\301'I,\222@\342\024\215\304$\321z$\212\350\031q\304\300\bEb\322qM\256E\033\326$bR\311h\264@\021\221\204\037\037\016<$\217C%\017Ib\221\004r\305\360x\004\001C\216\31609\024AtL\223\326$rE\t\302\nF\023*\226@\250"
+	.string	"EN`M\016\213\224\226*$\205\310\343\212\264$\201\265h)IL&\207AIaNr\025\026\221Pa<\001,!Y\\\217\307%\242\237\344\217<\240\370P4&%\031\211@\254h\244\360\270&\221\210#\212\206K# \236\340\341\340D\017\235h\020'zh\330 \206=\244\242A\250\350\241\025]\341DHaqDrE\256%\214\224\202ND<\256\305\325H\275\002<\330\300\203\020*\200\017\261"
+	.ascii	"\016\026\300A\372\020\013\030\032Z\200\007C\352=\030\272C\036"
+	.ascii	"@\204\020\256\311!\222R\322\232\024\n-\254B\243!\322\210\325"
+	.ascii	"h\2104\341\270&\021\223>\253P\305ZT$\361#\017\037\214D\fH\303"
+	.ascii	"\023ID#\236\265\310\230\204Q\030\036\357\217<,%\021\221"
+	.string	"\220\214G|D\224$*\241(\fW\\\344\272\2044L\221\032)\2518\342(\r\223\210\216\350q-\"\2460\036\225\212V\025G\244!\361\270\"\177T\254HJK\"P \r\217p\326\"\342\361\270\2460\n\213D\f\204FKHJB?\311\025\271\036\215\311\245\241\260\250H<!L\016\221\302\244\245cR\004\253\022\322\002\235\025iH\204\223<\256)\212D\242c\0211\t-\022\223T\021\020\255GD*\206Ij\017\022i\230\242h$&\207HF\245\343\232,\222 :b@\256\353\321h\025\261\"\031\025AH\032\206\220B\tE\005\024\206\034 \"&\207Ik\221H\244S\204d<B\256\307#\023kr\230\202\230$\002\2018\024*\022\211V\344\222P\3050I\250\342\230#T\2614\024\252\030&\365 \217\306\343q\025\n\211\216\310\240\344\212D\201\302($\"\221\307\234UiE\362'\003\n\024\306\344\022\021"
+	.string	"\220D\025C\241\321\322\211\265\b\303\252\264\")\\S\020\223\303\024\304\343Z$4*\022\217\222Fc\022RHt\324\220\374\221\207\"\242\222P\322R\t\027)\034&\207\"\220D\025 \024\021\225vH\260$\254\b;\302&W\244\245#F\n\221+\322R\t\235\025i\251\004OR\205\361\304E\256F\307ar'\271\244T$\346\024\255\253\022\022M\376\310CRg\004\035\024)\004\036\215Ic\022\2161\305q-aE.\251k\221q\204\343\252\202\230\024\374\221\007\025\307\017*\216@\311\342\2221\004\23559,q\204\\\217(\326\022*\216;\307$\t\305\021\303\344P\004\n\303\022E\303\265\004\3211\347\230$\2418\002\271\224\034&K8&I"
+	.ascii	"B2\032# D\213#\220\310\225\310x$\201\350\350sL\222P!)L\252k\022"
+	.ascii	"1Y\\*\241\342\370S\034\2014aM\"\232X\223\206\307\021D\307\236"
+	.ascii	"ar(\"g\230\034\212X\223\206G\024\301d\222\3618\002E\005\244"
+	.string	"0ix\034&\205 \022\200\\\211\216K\306\022\212V\344qM\261\036{\212\304\244\253b\230tW\244\242\"bR\232\256\311\341\021\003\223?\262 \204\344q\230,\301\250H,:\016Q8\032G \255\305\342\360\210\350\202\235\344\217<$\227\224\222KFa\022\nJ\037\220\3075\005\361X\204\301\215J\353\361C\322h<~\310I\n\201H\243\241\t#1E\n\215\210(\212\306\020R\254\"\220HK$\034\327dq\r\301gM\016K$\241@\202N\212\265\350&\205\036\f%\213\304%u\004\353\021\205\020\211\034*\241`D\022VH\nC$\213\304%\340\207\206B\300\300\204\013L@%\362\200\374\220<2\"\"\241\370P$\016\223>\020\035\221\037<T`Lq\\\221\302\2425\3518,.\t\211\307\344\317\177\240\024'V\233\213*\213\322T*\233\235\323\005\024`\233\031\23343\036e\2210o\255\246\006d\303c"
+	.string	"\324\024\326\222\017\310\006\\\353\362\003\317\013\270\006t\202VQZuQ\273\214\330\3615\276\206\037*\223\210\023\2621\315*@5>)XMR.\352\016!r]hXL/\353\220\204\235\245k\360\220\354\371`\246\177vK\006V\016&\270\215\003\237\016\264%\250W\034\016\246\306\300$@\263\003\225\034\250\244\201J\356\337_\252$\214\223\264H\021`\031\002\2628!\221#;\260\354-\n\215\232\271\306\300#@#_\352\017$\202\337x\370\270\210i1$}R\344\217I\325\030\370\003\370\0038\026d*\003c\n\220\003\307\200\313\0249\236h,\201AT |YH\246\212\360\025\3210\245\376@\037\250\225\234\f1\027\300\036i\032'\223?\261\035;\200b\031<\345\034\225W"
+	.ascii	"\371j{\206\035(v[`\321\302\026\204O\375\201:\260\023\263\321"
+	.ascii	"\b\373\002\033\022\201<*\260\034)]\017\235\022\214"
+	.ascii	"\352\313)\313\322\314\313I\027Vs\2531\263\2313\263\307\202\326"
+	.ascii	"\021\030m\300T\255\271\201\323\234@qM5v\342\022\203\2531P\013"
+	.ascii	"\250\005\344\262VVy\003\370b\203\265\344\313Z26\374@\032\007"
+	.ascii	"r\001\267\314\220%\361\332\002\326\270\261\205\257}L\301\342"
+	.ascii	"\206Fe\232UU\365Pf\221QI\211\001\222\202\031.\373\232\322C\006"
+	.ascii	"[\0231\343\245.\006Z\005\307\314\013.E\260P4\025\n\337\221\345"
+	.ascii	"\025\252\005\305!E\006\315\212mKG\215+ \214\003\253z\362\262"
+	.ascii	"pl5\006R\001_\034Y>)\323\370\266\371:\273!h\252,i\f\234\002\272"
+	.ascii	"\b[\262Y\271\373\323\252\207\217\b\237\231\026i\032\020F\222"
+	.ascii	">\035Rfvz\004\351\361\304\002\177\351li\002\304+*\035\213a\245"
+	.ascii	"\307[\343\037\bE\245\255\t\336\225\306@'\240\023:\004\f\b\026"
+	.ascii	"Y\2157s\215o\201\023 \023\220\t;\323~`-\321#jnLi|\013\204\260"
+	.ascii	"a\223\376Y\264\\\305\200&H\344\310p\236h\340u\275y\372\3677\240"
+	.ascii	"\2202L?\032\247~W\251\346F\243q\352&\247\306\216\030m\215\323"
+	.ascii	"\276\277\365\2611\t\3238mc\001\225\236^\272\206\211\225#W\370"
+	.ascii	"x\300\350\230r\261\367t\215S\021\037Q0\332\016Y\235\030\032\215"
+	.ascii	"_\201\323\314S4f\3224w\214\033\\\316\231\213\263/wO\323<\315"
+	.ascii	"\003\321\301\353T2#c\232\032\247x\347\321\352R\345\331\370\351"
+	.ascii	"\023g\bX\363H\343o\360?\250\242e]]5N\355\210\324Q\3415N\353\376"
+	.ascii	"\246\243E\206o\307\231-c\306\244t\026-W\r5\031\302G\346\005\313"
+	.ascii	"\355*%\363\224nG/\315\271\204H\2300\350\020\213\226\253,X\261"
+	.ascii	"\262\253\302\267\303\345"
+	.string	"F\224\336\327\334\034v\n)\257\030\037Z\033\254\236\223\355\256\361+\250\212{\\\352\024R\263\222\264\036O\325I\206\022\250\3231\204b@,\307(L2\206\020\032\232\241M\222\016c\025@ P@\036\030K\326Iw\023@C\315,u1\020\203L1C4\022\2444%I\215a\016T\3603\027\023\253\347;\024\250c\300\303\333\305\245-4~\200\345\2224m\001\024\305'K{\324\240~+;\306\327\351\265\361?\305\254\213\210%\024\276\260\226\306\340\307Z\352d\333.\304\323\305\242\236\336\242@J\035b\034+H\350<IL9\340E\020\026\027\353\232\355\005\t\334\017X\333t\376p\222\\\217\330J\207yv\022\035\3049\326T\262l5\217+,\270\2778\317\203.\330\006\003$\353!\357z\265\366\301\331\300a\236v\300\342b\220Oi\201\237E\272m\234D\237l\225\302\036\005W\256\364\241\237\025\fs\037\331\221\263"
+	.ascii	"65&L_\246b|Q\277\217\241\344\340B\202j\330\247\244:\366\261\201"
+	.ascii	"\3217\0171*\240(_\203\021d \r\340\267\352\024\355\360\031*\025"
+	.ascii	"\257Y\t\300\237\315\031p\306`\260x\202\032%Wi%\327\360\304B\023"
+	.ascii	"\311\313\336A<\362l\361\005\315?\255\030bh\317\270\220y\035]"
+	.ascii	"\311\371\337\030Q\262\325\247\025\246M~\203\264]\221Yw\277\201"
+	.ascii	")D\264\270\257=\3137N\006\336uS\211\252`oJ\337Q\333]@\005\030"
+	.ascii	"\351\3607C\213\302*\004\232\321\251\203\333}q\376\361wZ\363\226"
+	.ascii	"\242t\225\222\250'.\307l*\370%\002\363\302\266\230\224\212\024"
+	.ascii	"[> \004\343R\213(\017\335HxbT\346\254l\341Y\210\352{U\241\372"
+	.ascii	"\323\3652\346\255\017\245\300\263\224\300F\3217\272>\200\225"
+	.ascii	"\346?\353\017\227@\370\233\267\245\\\307\013SM\037\223\227\320"
+	.ascii	"\016\3059v\233\205\243\2022\035\024\025\216o\021X\244\025%\332"
+	.ascii	"\266iei\224\311\343\364qb\273\037T\242R#\031\001vk\004\026,\f"
+	.ascii	"\025\032BG\214F\026X\367\324\201\225k\305 \273\307\013\f\261"
+	.ascii	"cC\376\"N\310\256\251V\235C\223\030\307`\357\376es\205\0174G"
+	.ascii	"\005\022\213j\3400\202\t\256\200D\002W\330\002\\\244\345\216"
+	.ascii	"c\310\251\223\344\367x\bWc\f%@3\260U%\252\210\376A"
+	.string	"U{\234q\267\273E{\316\325\3455r\204\245s\276\t\032i*l^ \211yX\212\336\225\267L\206q\300\330\221\376\332~p\303\006\027I\247\222\300\002 \277blv\206>j\023\005\273\312\314\306}3jG\2715Uf\3212\242\366\320\377\223\220\037\350EQ,.\031\307-Q\331.L \216=f,\354@\223\022\355\343\032\004G\357\332\177`\325F\3326_U\263\240b7\223\371\247Ci\300*\200u\213\373w|\274\3449\321z\336k\356\242\305+N\304,q*\2238\306\001\351\234\355\331\3261\235\2175\265\013\r\002\315\257Go\213\263j{\246\2651H\325\360\221\357\013\027w[\317\250\232\2704q\377\"\025\234\211+\002\"L\037\341\t'7\0043\016o\245\326\234m\263\355Z\305\271\026\302\335\233\207\213\252\377+\251#j\353\362\212\206\004\264D|\272\274\253A\251\337\327\030\r-I{|\362\265\245#"
+	.ascii	"8?\r\245k\201\376K\224d\325\r\370\005:^\351^\314\253\365\360"
+	.ascii	"\006\n\211f\222c\222\323\357lG\3116a\250\277\201\355v\213#\241"
+	.ascii	"\177\212\351z\253\254\310y\002\244\342\220^\274\346A\326\324"
+	.ascii	"\201\222\221U\250S\233F\376\324\"\275"
+	.string	"\335\006\343\302I\227C\211/\303\352M\213\207\027\322f\261\r\353\3370'\177\266p\245c\234|>\227e\206\213\301\320\343\334\264jw\013y\246\352\307\236T\223\353C\371\224\316\347=\203=u\037\274q>!U\r\013l\177a\352\270'>\267\305\212\263\240\340*\316\276\231\267#4\335\203u*\346~\356?d\226\302\351d\372\227 6\360\245a\200\033\037\374z\336\232\334\263N\222,\255\221\264x\0305\303\024\001j\21701!p\216\241|-\270\344D\023]\344\\\327(\362\035\217$G\276\345\375\220\030>8a\254f\310\r\224\017RC\260\031\202\236\312K\244pq\013\024\t\362S\240\342X&E\013\222\343\006\017W4,`\036\205JN\2067%\035\245\025\f\213\310g\226y\"b\305\022\230\021\224<\232%R\372\256I\300\017\206\306c\227b\320\234\207\\h.Ld\223\016\216\f\202At\362\351u\207f.\247"
+	.string	"\355,.\241\200\375>\001jU\t\317\301\177\034\371\0044\343\340}\262\2204Q\326\362 d\246\261\330\201\023\335/\371\230E%\002\006\264"
+	.string	"\004J\307\357#\337\360\246Y\354\2223\220\f\225\203\267\254\343\337\r%\263\363Dpz\004\377\307|\325\213\314\002+3\333V%\3735\371\333\0362\310Z\321\345C\320.\005qV\027A\024\354U|d*,\276\377\200\030\324`\212\016\270\\\363A:V\274\357\202\203\226\025s\314|\323\261\213\272.\360\265\214p\360\330\035-Pj\216\"\312z\001\"{\310Q\341D8\003Z\257:\264\230\035Z\007d\320w\002\327\027\276\200\2640,\331\206Utl\233\233\307Z\203\242\375\255,\202\263f\b\t"
+	.ascii	"{]\221\255\2548\t\343<t00\335s\211\354@\020\324$\r\351p\352\206"
+	.ascii	"\351h\201k\352\004g\342\375\331v\004\355\033\256e\205\f\277P"
+	.ascii	"\360\022]\023i1p\022\347s\334\222\026Ee\250\262\224\340\2668"
+	.ascii	"\260\206\334bC_?@\364\320\347\324\305\234@0?\224\372U\243\337"
+	.ascii	"KVaZ\205\b\211\202\200\2402lc\341f\2540\365p\350\027\006\356"
+	.ascii	";e\343!uQ\rx\252\330"
+	.ascii	"\241wh\211\347\364\347\245l,\0253_\214\031\316j\365r\033\004"
+	.ascii	"x,\f\377\357S\362\030\227\212\301\357\362\2403\270\226\344.)"
+	.ascii	"\213\367\210V\234\323^4i8o\013(\344\"Q\335\314n\275\240u#\030"
+	.ascii	"\310pgq\375\205\033\340\033%j\333j\361\221\201\213\243f\t\364"
+	.ascii	"\3754'M\276k\372\flJ\216% j\267\b\362+\377\273\036\305\003\340"
+	.ascii	"\354\255\230\005l\263^K\031\230\214\003\240z\257z\\6\006\303"
+	.ascii	"\257Z\021\267\177n\251\206I&\036\254*\307\3744\302E*\"\231\215"
+	.ascii	"\215\365\255z\213\273\333\254\301;U,\250\346\250\257m\037\nZ"
+	.ascii	">m\355\206\002.\207\031#\t\354\212\277\\\0218s`Hx>G)m\017'~\320"
+	.ascii	"6\222\335\311\257\337\306\rk\270PR\320\b\306\302r\244\213 \320"
+	.ascii	"\310j\240\231\233\177{\373\363\265\206<b\003\\\237\317\022\342"
+	.ascii	"\262\344p\322\016\255\370\200%\0375i\316fP\215\320gH^\303\364"
+	.ascii	"I\257\300\027\006*$~\260\213\314\033e#\374\004c\323\355\2351"
+	.ascii	"\366\031?\201Z\n\366\312\034\3335rA\030\364\267\375\t\353\305"
+	.ascii	"\205\277\200FF\360W\331\021\271rT\fr\262\357\261\365\373\314"
+	.ascii	"\205V$`f\273E-\211\321\266\222F\007\005\211l)>\316\003\230\247"
+	.ascii	"\232\201\037\337\214t`\355C*\001v\246\250\3256\202j B\036\003"
+	.ascii	"\237\036\372(\242\343\364=\202g\006\253df\\\252g\023\225\236"
+	.ascii	"\220\034\335\330\310'FJ\016\366\312\340\343\213\007\024\306\374"
+	.ascii	"<\375\022\033\226\322\314\002m\331`\223\201\221\351\366(\005"
+	.ascii	"\212\312oF\202\204"
+	.string	"\232\271)\337\036&\3209\350!\327\026\230\322\326'\350\230\343.\207\006\345A\251^\335;\"\254\224<\331 j\207\262\220\246Y)A\374\222Y\262\373\336\017\312\206M\2518\250\327y\316\341\353\324\363\323\315\250Y\226\304\314\243\214\233\201>C\274\367s\242\f\373T\025\030g\225f\247\367G\305D3\212\355\207\251%\346\251\352H\307N\236,\200P\232D{\322\022\035%\330\007\003\240F\221;\263\t\003[J\365KDE_rH\340_U\27090\237;\005\233\367\201\353\307\007A\306D\r34Vj\240\t\357\363\fr3\204rL\262\274\361xu\264\2039\245\305\331B\233\312qz\t\230\205\002\001\362\211\2418\343\374\004\215\365Yd\372\214*]\200`\034\245\234\331[\006\224\3172ev\036+}Y\344\030\354\266\222C\231u\313.\315j\330\305\316\b\3747\026\236F\003\216q}@\223k\300\031\310\366w\026~Y"
+	.string	">0af\363\260\366%\231\203\344\267\303\230\312\025\340\370\347\221\202\203\342\344\264\035\235\204Bd\260\320Yc\375\252\266|1\344\001\031Kv\314YW\274\306\243\321\331Hw\376\353&{ /\341\021m\240C|\0267\303|8X}\261\341n&\346kI\301\246\241Jp\013\234"
+	.ascii	"a\356\2177t\0050\265\222/\330\335%\"`E\353\006\351\227\343\306"
+	.ascii	"\272'\2029z\265\f\001\016J\037\213*R\222\321\006\356\002\202"
+	.ascii	"\346B\204\344\351\320\375H \227#G\r$\265\033&\022GN\210\303\004"
+	.ascii	"x{\365p\241F\327"
+	.string	")\250\352\020\247\037\335\345\335U&S4\210MM\301\204!\334L\tM2\237\226\322%\"\350\020K8eg\226\357\n\025 T\347#=\275'\306\037v\204\245C\343\002\225;Sqb\246!\351\237\bp\334\003\206\267\r\344\2407gPp\rK\033\325\n\263Z\"<(\020W$\265mr\001\202\313\365\342\2026\343_\242\177m1wY\203\306\323\215\310\331\024\tW2\030\213j\033\004\230\016Er\tw[\002\f\226\377P\n\n\263\242\001\343\325\315\004\367A4\210\377\235\352M&d\005].\3064\250\034\t\201\234+7\177\204\3244\334\253\027\2214H\026\212\341\220\241\355\312D\365\277\250Afi\216\305 /p\365\233`\213\272\357\213#\t}\177\335\244\221=\241\200bU\276Z,\202\002\033\200G\266:\2126>0\276\035\3577#(3#\006\026\034\205\335\2601\245\0139\255<\3023n\260\227\025cl\\"
+	.ascii	"k/O<RY]o\023\323:\266XW\320\310\233R$\336\006#\375&\033\311\341"
+	.ascii	"\273?\230\256\016h\224w9\267\210\031\017\267\001\354\332\341"
+	.ascii	"&\211'\372Oq\230]\020\346\022\004\241H\366\367\302\037\036\b"
+	.ascii	"\364\221\365\241H\2124a\311\262\"\262\266\340?\213\352\246\r"
+	.ascii	"-x\236\207\350\324\271\036=\017\342\230pk\207\262<v|Z9\013\255"
+	.ascii	";\032*\240\007\245I\b\270[\316\364\241\211 \336\306W\004o\266"
+	.ascii	"\325\335f\021\332a\257wsvK\202\027b\2745\326\361\004l\360\335"
+	.ascii	"\003\272\217\333\237\201O\307R\363#\024|\321\345\363:\250cE<"
+	.ascii	"0\031\340\203c\251\254u\374\350\340?[?j\365\211\310\350\366\262"
+	.ascii	"\367\203v\002\347S\254v\312\021\334\352\270&\314\355T\3740\260"
+	.ascii	"s\305{\272\\u[\235j.8\035\356l9\267\342\362\024\327\374\003p"
+	.ascii	"\357\334/iV \375\027\374\033\235\367\215V\331\004~I\373r-KH\370"
+	.ascii	"L+gf\347\322\2703\310\362\227\314\261~H\371jC\274\324t\023A|"
+	.ascii	"u\324\237 \371]\344] \215\227\343\223>E|\215\364\246\021\354"
+	.ascii	"\373v\257\274\376\202\367\233\233\365w9\303\037\345\231\212{"
+	.ascii	"\352\2574k\361W\347\365\377t\220\204\231I*/\364\320\363\274\344"
+	.ascii	"\033.\300\352!\361\211\031\304\237\265\"\277>\216s9\241\354j"
+	.ascii	"v\253*N$\257%N\367\303k\376\334';\013\365\330\374\257\026Vv-"
+	.ascii	"r\367\307\374z\237\355\312\303M.\005\372\321\031x\230\203L\367"
+	.ascii	"\273)\256\345]9\231\325\004,\035R\016H\363\037ym\335l\0033\333"
+	.ascii	"\233=\233\266<\330\330D\277\327}\034s\324|\004G\211}*\354\213"
+	.ascii	"\326\374\004\373\017\3307z4\231\336\021\003\226\b\374S\240\247"
+	.ascii	"<\357@qN\311/\332?\203j\250z\312\2079\177:\225Mj\316\241\272"
+	.ascii	"+\363\241\310\233\243xo\240\036.\2610s\231\354\234$\250\333\t"
+	.ascii	"?\333<V9\330\372n\357\265\363\306\344-.\234\027\327E\352\302"
+	.ascii	"\2708.F\027\217\362\b\324\243uaX\377\365\232\034*\322\235\347"
+	.ascii	"O\025\033\212\302\307\322\224?y\016\360\215\227\311\007\323\003"
+	.ascii	"eo\375h\334\2615\367\313\377\336p\253\3742Oh\r\334\013\247\243"
+	.ascii	"\342\301\207xW"
+	.text
+	.section	.gnu.lto_.symtab.b1841bbbdffcf522,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b1841bbbdffcf522,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,290 @@
+	.file	"servos_tricopter.c"
+	.section	.gnu.lto_.profile.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 -U\001"
+	.string	"4\002!"
+	.string	"\004"
+	.string	"\242\316\326\257\007\002\002"
+	.string	"\002\001\002\262\374\202\245\005"
+	.string	"\003\274\205\242\255\006"
+	.string	"\004\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\024\003t"
+	.string	"\003"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\004d"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\003f\001"
+	.string	"\201\200\200\200~\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"M\005\320\025v\216\302\362\022\203\347=,C\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\003\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 &\275"
+	.string	""
+	.string	"X\032"
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"<K\200\320 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.ebd3f8eed88db777,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servosTricopterIsEnabledServoUnarmed.27.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"m\007"
+	.string	"BN46@o\323\001\230\016\004\267&\203E\002\335(F\034\247"
+	.string	"\025"
+	.string	",\250\275\031Hh\274_\271\261\361\020\256\332\030\3161L\314\201\300\210\340P:\254\215\361\374\326\232\224)\005\256:\321\322<XuEm!\303*\242\225A\355\301\341\202h\200\022\027C\004\254b\006;\034c\036+B\r\303\"\334|\334\247\325\221*\001\247\235\375\001\314U\365\241\224\316\023'\311"
+	.string	"v1\022\374\221\223(|\220S\266\370\344\275S\376\007s\352\252!qY\262\277.\265\303\376\264:\262\235\326L\177\322\230\004\250\354j\224^\226\205B\t\261\r\26276@"
+	.string	"y\023\310\320\226\223P\211\313\356\007\325\343\333s\363/\362\002\216\025Ot\361\314(\354\256\323\023m\334z\333\034\333\007\266?\002\t"
+	.ascii	"2\241Y\037x\301D\360SA\273&\372Ed$D\036w\243\323N2"
+	.text
+	.section	.gnu.lto_servosTricopterMixer.28.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \331\365\005"
+	.string	"\342J)1p\307\351\220,tB_\313\275 \360\016\355\035\301,\345\023i\206E\210\320\346\240\334\027t?\263\370\215fU\r\212\363\235\307\372\241\372\326\243\311\227[\246\247&Z\325kR\026\255\022ljh\205\311j\251X\027\212\314X\023\214\244(&\247\307\347UQY\347\244R\372z\331\213\f@\017o\347\370s:q\2713\n\300\215\265\377\323\"\013\374{h\366~\226\002\026aw(lh0R \370\277\322\263\177\241\361Q$\200\020\030\272[\362\300f\033\263\357\036l\202\353\264\215\210Hw?r\035\300\236\367\277\343?\344\377&\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_servosTricopterInit.29.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \306]\005"
+	.string	"\262\211$+pm:\240{\263\017-\302\try\270F]\0306 \324\304\213\265/\350\300\202?\235\243\252\3522\026\274\\\030\003P\204\350\357-S\277,\212Um^\031\255\214mV(\266q\215@2\311\203)Yc\302\027\335\330J|j\030\345:'\345*\354\225\340\301\"/\177\330E\311\371\027\320\022\374cE*\224\2725)T\217\002!\317\377\255\316\375&\003\206 \312\200N\335\315\262\263\334F\356\273\237\035x_\267Q\260\350\356G\357\333\354\345\376G\374W\374w\004\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \203\205\002"
+	.string	"2\004\017\033\260'\035\f\303\254\022\006\027\350k\rf\030\206\005\251\2215\245\325\255\021B\366N\001#\207\376k\373\353\021\270\354\267%\t\020\300\342\024\211#\031\352?\245\315\363\035\306R\333\"\016\367\317\006"
+	.ascii	"V\244\177\241\2618\367k\365\021@#\202UO"
+	.text
+	.section	.gnu.lto_.refs.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ebd3f8eed88db777,"e",@progbits
+	.string	"(\265/\375`\020\b\2351"
+	.string	"\352Z\364\023D`\250Q\007W\017\314\\\254\377fU\013\254\240\370\316\334\336SA\"r9\252\036K%\2548\222\266\230>\252\333\034\345\345\036N$j\370\313\355\276\257\312\207\037\251sw\202\317;\3016\016\207\n\335\334mo\231R\023\001/\001(\001\036\246\273\327n\346i\334\314\031\227\275\261x\266\241\270fG\221\265\377\230\211\351"
+	.ascii	"\023\356X\004\317\034\025m\217\343pZ\274\001u\313\230\005$\243"
+	.ascii	"oP fI\240d\264}\213\352mz\355n\b\244\307\255\370\217\030\220"
+	.ascii	"Ys&\2439\267\242\266+Q\333\177\250\355\257\272\344F\265\310\t"
+	.ascii	"\244>\306\311x2\202\227i\007\343a\032G\214?\316_n`\222\031m\033"
+	.ascii	"j{\204\364l6=B\332S\252\316\223\322\274d\2416\232'\245\036{\027"
+	.ascii	"O*\271\262+`\350\323\025\373\260\377\370H\300\033\226\267\266"
+	.ascii	"\214\266\t\265\273\305\032\252\3531\364\222\332\256\224z\323"
+	.ascii	"\225\322\316j\257yR\332\355Z\272=\213\207)\235o\026\374d\377"
+	.ascii	"1\322Q\fD\013IF;\366\244Tu\002\251w\273\241\356^\353\366\234"
+	.ascii	"Zw3\273=u\\w/\020\324\335j\267\357\351v\264\333sw\267u7[w\027"
+	.ascii	"\352\356A\335\335\247\273\367twXw\023uw\234\356F\233\315f\263"
+	.ascii	"\273ot\347\n\335)\212\304#\252\021F\276r`\244\356U\022\221\257"
+	.ascii	"\261\013\211\344\004\376\022\222\343\214h\306\273\274\306\337"
+	.ascii	"\241\305E<\352\226o\f?\363\337\311\260\376\350\340\237\013>2"
+	.ascii	"\211A\274\254\270\334Q\034C\204=\376\177\004ZE/\370\215\313\227"
+	.ascii	"\n\374O\2458\365Z\027\334x\371L|\351\"\341\372,\254\377\004Z"
+	.ascii	"\377\256\377\362\377\335\377\317\035\271\342\377!\272\027LK\353"
+	.ascii	"\177\353\200\326s\271g\260\3763\031\2372\344\253\364\202{g\274"
+	.ascii	"(\301\036G\354:\3303\273\216\252\322\355\362Y\377\357j*\030\322"
+	.ascii	"GZF\373\004p\273$q\223\321\316P\3700\325!@\332\222^\276\370\330"
+	.ascii	"\031\203\345\276x\275\341\361=\256\307\363x\322\231~\326n\307"
+	.ascii	"\357\2201]L\322\315\2023\375\214\3279\343\262\021\311Ch[*`p\246"
+	.ascii	"s\3611#7~\0369\257f\0175\007\230\230\230\214\230\034\372\312"
+	.ascii	"\002\200\372{R\252\313Fuy\300\t}EySS\333"
+	.string	"\202\032\025\307X\033\332\177\334\216\246\273g\346l<\316\031\203\021\341H\342\206\326\355s\\\216\323\361\244\233\371\232\3662'\353\034\377\033\377\277\003\304\020OD\356\332\374\231\221\265?\272\221p\266\301Q\242&\243\336\314\357\311]v\333\337\034M\023\031\343W\022\345Q+B\366\246\266\357\322\243f\263\331\364]\212\236\200\332\332\234M\375\377\363\337H\034\260\337\342\332\031)\3211\246\bgm\315\331\334O\231#33)x\330\032\020\356\214\n\224\261B\355I/\344~\262\330\273\001\306rlI(\022\343\303\026&\243}JQ\333\3778\240\366@I\017\344\203\210\266\376\344\003f\310\225\265\337\332\332\345;W\352\244\021j\037\224V\364\037\366\377\013\210\242L\361\312\312\250\247e\027\344j\355i\216Vd\3644\364\237\350\336\300\310\275\001n\315\023b2E\373\304R;\327Q;w\247O<\376\177\017\\\374\307bQ\3528\367]\267"
+	.string	"?\335\301\237=a\371\377\004\036\244N1C$\222\321\356^\372\276\362\357\"}\374\307W\331\345\276cgH\244\370\217\030x%\222\177\343.$\n\177\376\370\375\215]\310\030o\f\037\337\030vuo\204\335\377\030\251{\311\210\256\277\312.\344\253\204\221Ho|\367\225\001\354J\003X\002@O5\221P!\"\005\257]\245\330_\333\372*X\200\001%\244zZY\341\323Q\013\f\212 \300\2564\200%\nT\255\355\260F\212\001\r\201J(\344\340\303\255H\021\265R\271\370\005=\fE\250\030>h( \273\006W)\265/8Mp\312@#\327\0314P\320@!\355\f\032z=\rN=\265\235zg\333SM\n\004\264=\325\324^Y\265WB_\325\f+\336\220]e"
+	.string	"\331\250\245\026Z\255,\257\025\nY^\200\326\227\033J\375T\b\201\351\320'\005|\021\024>\311X;\f\251\256N\260k\033\\\237tk\373CQ5\343D\221\2145\352l}N=5\306\312\276\360\r\207?\253\031B*\337"
+	.ascii	"_\324Z\305\376\202W> \333\"\265\276\fm\020x\225\353^\357ii\205"
+	.ascii	"\t\020*T\023\273\266VB( \333\372\206B\031\354:\344\265SR@\252"
+	.ascii	"\027\274 \360W\305\203b\207\274\246\007O-\373kSH\005\201Q\354"
+	.ascii	"o\006+\374@\265\006\203\277)(\245\227\r\005#d\211WF\343\260\""
+	.ascii	"\036<\276\340\214\345G\004Z\034&\243\331\230\215\316\346b\317"
+	.ascii	"\303\307\232\354\316*l\177\2622\332\350\022\267\366\244\273\345"
+	.ascii	"\200\205\250Q$h\024B\206\030cfffd\264\311\001P\0021\246\354\330"
+	.ascii	"\001"
+	.string	"\021p\275\202(\240\331\244\365\f\221\340\\\243q\276\307\020\031\3463\211Q\377\004\305a\350\337\334\333\376\205\023\317\316\031c\2149\370\237\2323\352\235\033\026\3662\207KZH\305k\261\256!C\350\rp\215\032`\313\354<L\352\212\304n\243\253Y\267X\315%1\224\037\332a\364K):\251IZ\037K\265\306Y#Q\364d\214\216\256\262\025B%\267\027\007\002ip#0k#0bhxI\322\235\370\026\257\247JyA\304\0211\266\241 \351R\220s]A\306\310D\262)\"\346\001\303\200% \250\037\314\241\222\253dk\345\314\021\037\002\242\226$jv\347+{\032Z\1773\342c\232\250A\276DW\017\342\265\350\241\243u\270>[+0\277$\036\271f\3464\0257\027\200\3216\344\254\270Gp\342\034\237byT,\221i\232EV\310\003\314\313\265N\300\221\0018\004\371\330c)\016>\221nY{\377P\247"
+	.ascii	"\330\307*\n\364,\220\205\372\327\216K>\250\235.\266\313\236I"
+	.ascii	"\2233\0325"
+	.text
+	.section	.gnu.lto_.symtab.ebd3f8eed88db777,"e",@progbits
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ebd3f8eed88db777,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
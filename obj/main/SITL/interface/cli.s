@@ -0,0 +1,7943 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\266\001"
+	.string	""
+	.string	"\307\001"
+	.text
+	.section	.gnu.lto_.icf.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\035\017\335?"
+	.string	"\372\\L\025=0bRc\221\035\241|\352\317\367\366\376\272Z\352\206\207\307\200\234\235V{.\270[ `\237\363\005A\004\b\301\bF\377\377\256'\350"
+	.string	""
+	.string	""
+	.string	""
+	.string	"$]\351'5\262\265\275w\223\275w\2222?\001P\001?\001\227\233o\236\301\022\320]\240:\r:9F\320\354\232A\267^\272p-b\260\200\300\351\200\276\201W\023\t\003+\310\205p\320\020)\350YKV\3669\341\257\327\037/x\022\364\253\362(Z#@hz\023\354\247(p\360\201\222\320\371\246\310\301\306\202\246\360M\003\006G\252\261\216]\023\0248\201\377FX\252\227\325jjX\355M\220\"\004Lg\372\376\216[\263?\200\2608-\235\031\317\203p\221\n\017\030\030\360\001Kg^\300\005\374W\232\375$\202\371\303\364\245a5\013g\200{7\300\234-\363\203\264\244\224s\262\rb*]\351"
+	.string	"\236\264\374\222\301\033\265\"6\n\240\274\362\217\253\300\354\236Jn\333'\220\356\r@\362\311d\362\362\225\3120h|\326$\r\207\235\351\355-c\272Dl\004\225\361c\344\221\237\225\204[\210z\311\371\031\005\004C\036\177\374\217^\213\316\274\2436\372]9\263\263\236\371\364\341\321#\307\260\314%G\0354\316\237\177\330\254\221!\364u\023\261Y\276\\\371\362\177B\2540k\033?\376\337+Y\031\036\343\353\302\306\327m\035\310\200\202\350\254\355\177_?v\317$\206\331\323[\252\223"
+	.ascii	"\004\037<\274\303\231\3402+$D)zw\315\361\211E\331\360sx\363\033"
+	.ascii	"\256\277\341\032.A\266\022[l\003E\033\253g{qO\224\323<C\213N"
+	.ascii	"2\\\306p\375\245XO\027\275\272&\372\315\036\032\0162\321m\025"
+	.ascii	"\027/\354\022}}\301\320\026-2J\364\022/\312w\b\211\005\030\313"
+	.ascii	"\2154\361\210^jI\245gD\232N\263S\205\3177p>e\362\306\206h\343"
+	.ascii	"\233\225\337\025H\233\315\"\224\366\203\302\231\237\360\t\022"
+	.ascii	"\336<R\271\227\265\222\371\320W3\334#\267#B\204\b\227\017\341"
+	.ascii	"\362\037\264_\360\276\2529\364q\354\013\2368\034\032\006\234"
+	.ascii	"*\202\331p\200\244\346A\303\324p#\005rr\321\200\271\272\"\375"
+	.ascii	"I\355\267\r\336@iy\027\326&k\206>\312m\361C\225\301|\334\336"
+	.ascii	"\241\311S\310\305\3335\265z\323\342\377\274$l\220\035\026\314"
+	.ascii	"+\333Fvg\340\240\344\264\2666\272'\006g\336xT\034\343\322f\305"
+	.ascii	"\202/\370\215Y\354"
+	.string	"\004vQ\221\002\205\202+P\360\002\327\023ZCmS\353\t\023\372z~\357\272\330\256%\3641\221-\022\224\304\b\021\356l\007\215W6\204n\237{\213@h$#hW\340\207\377ZW\350\346!~\224\026\245v\340\260\241\371f\202\213\314\030\356\331_:v<]\307\221\257\360\n*\342\255,?\305-\315q\364\243\312\313n2S\237\322\363\324\324\365\374\034\317\361\251O]\202\034'\265\256\35517~\3436n\3437\216\343\206\r\251f\215\353K\035\211@ft\350(n\207\221\272\324i\234\306\245\316\274\024|\207\353*\267\301\200\270\236\341>\257+\331\376B\345J\037\331\366r\017\017\237\203\273k\306g\034\371\202m\211I\334\\O\177\222\361\016\217\223Y\346\262\036\355.z\251\260*\315\346\262\241F\230M\217\241>{+\352QQ\217\212q\035\3431\336\334_\210W\317\255\205\214\242\225\305\355\254$\214\277pq\027\027"
+	.string	"G\302:\3076\226n\327"
+	.ascii	"a\013\355g\213\353\263`qy\351\235\263\272\315\355+(\r\005\365"
+	.ascii	"\037\352\032\356\340\205.\272\251m\347S\323\212\247\270\212\247"
+	.ascii	"x\363(\336t\001J=\177lV{\213\211\023&\356\364\346\213\375\343"
+	.ascii	"shk\321\311C5W\204\273J^3G\207\272\263\350\343\227\235\226sS"
+	.ascii	"\351MfU\204Z!Q\342$\256G\\\304\233P\314\272\304Ty\367<\365\036"
+	.ascii	"Q\361\360\016!\316\004q}\344\026D\310\017\334\224z~F\001\301"
+	.ascii	"6\235F\232\031\236A\332y\260\b\256\365\024\264>n\033O\323\233"
+	.ascii	"\2220\235\t\311\231,`0\316*\261}\335g\266W\240\004\204\266\245"
+	.ascii	"\355;\337J\371j\232\350o\303\315KA\301+u\373\315\335v\3235{\333"
+	.ascii	"M\277in\202gv\233\361\306&L\365r\007n\333\331n\0369X[v\035%\236"
+	.ascii	"\232\"\252M\307\300\017\030\347\303\252\033\354\236\303\246\257"
+	.ascii	"\217\034\371\221\223X:\242s$\266\327t\262\255\357M\316\226\243"
+	.ascii	"7\365\356\020n\307\321\257\025\326\230\351\206\243\215|{Yq\373"
+	.ascii	"\315\262\032\350\017v\2539\031\271\221\250w\315\342^\242\235"
+	.ascii	"\006\301XG\375\213\3566\2725\004\274\366m6\332e\204G\225\356"
+	.ascii	"5\237\233\357_\0378\326m\325\361\"\2428X[\215\226\347\360\025"
+	.ascii	"\262\333hW\306\341\261\311\3564-\256\001<\351J\217\212\351!\332"
+	.ascii	"gz>\314\343C\263\315\212\334m\347\300T\301vU\273WT\201\206\233"
+	.ascii	"\252\257\211\234\210\007\367\214\227\252\334.\333[rp\220\266"
+	.ascii	"\330R\f\013mm\233\331aC>\344B.\344A\316<\220\313\377\361\037"
+	.ascii	"\367\361\244\367\270>\2173\317\024[QM\353l0\ng\316p\201_\250"
+	.ascii	"\2211ADfFDDD\332$\035\341\004T:\245\250\214\007\022\300\304\031"
+	.ascii	"\313sD\241\031\031\tD\202$\005I![c\252\f=\ne\221,?\033\341\224"
+	.ascii	"\232\223\321\333_\351s\360\3355\243\301\003\346\225\177\344\001"
+	.ascii	"\311W\035\271\300\363\235H{\245\302\312V\236\361\227Z[>Q\321"
+	.ascii	"\226\006^\n\246"
+	.string	"\246\364~\375+0\335y\226\026l\307rK\365(\216Q7T2\034\264\222\317~`\236fb\247N\267\210\311\034t\250\025\021\255^.\320E\222C\257r\246\177\271\316\272\222\312\222\004\303\363\305\267\267\206\016b\r\317\356\342\271_{mf\373'\016\376<\373\365f\030S_\247\006\232\037\274\256s'\036cR\3167\262Y\224\320\030mh9\t\341&/@\375\220\341\020\200\342\020\332 \225\364\261\361>f=~h\007>\314\326\371\242\247\376:3Gd\274/\205zG\214\235\360G>x\302\016)S\267<\203\301\246j\007\321\244-q\017+@\200\364\213!W\335j\007\225\361M,\275C|\261\334\373a\270\211\203\027\233\021\370\030\250u\027\357g\3217\347\222\367}\342\366\371\314\222S\371q\262T\234N\367\376W$#\374\304\347\216c\331\227\356\204\326\223\363\026\207\277h\031\312\262\201\330\320\267l\324\223\363\362B\301"
+	.string	"\264\377d\032\301\004\220\367Yd\n\257\351\351\242\313\004\304V\346\272"
+	.ascii	"\231X\231\252b\277\213\343o\265\301\277\371W97\342|m\206\030"
+	.ascii	"%\212\331\326\342\334\2243$\237\270\351\376\374\211\371$I)\243"
+	.ascii	"\343l\353\360\237}\220\271x\345\352\315a\324J\313\340\310\225"
+	.ascii	"\335qcs\027\210\337+\337\r]\236\035z%\t\335\027\252\373!\373"
+	.ascii	"\205\241t\213\310\273FJ,\307\312\316{+e\230\032\257\330\311`"
+	.ascii	";\331\177\236\271\bd\004\237-\223\322Nt^l\271\235\254\375\356"
+	.ascii	"\300=\372\020\002*\270\221\237D\2420\377\246\270\276\025(\341"
+	.ascii	"\363\211\261\275\230\353\264\r;\214P\226\354\243y@(\326h\246"
+	.ascii	"u0\244j\030\345\364#\022B\321\3309\0210\377s\253C\326\240w\347"
+	.ascii	"\3365\2008\212\325\213\031\026/\236\371\202{\312r-\r\360\321"
+	.ascii	".|(\330\026\024\316Qw\0049\214.\321\374\037P\246\200\362E\341"
+	.ascii	"\234>\336<V4\270\2461\235\333\245r\004\\F\345N\347"
+	.ascii	"N\332@\257\274\373\214a\207Yk\364\fg':\026Q%\203\357\245^\336"
+	.ascii	"\b\350\354\336+\204T\243,R\375\256\221\\\037\016\331\367\216"
+	.ascii	"\203l\262\324Kr\3624Y&"
+	.text
+	.section	.gnu.lto_.ipa_sra.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\211\024\365)"
+	.string	"\306\235V1\260\336$\351"
+	.string	"\365 \013\352\341_\231\036\006\207\304c\373Y\330\2708D@n\242ENWL\274\274\270\275\205\240\360F;\002\220\375v\357F\032\331;\311B"
+	.string	"N"
+	.string	"F"
+	.ascii	"v\357\230\002\274\004\331^\017\201\201\255\300\021@\323\371\001"
+	.ascii	"\331\212\202nE\243oM@{N\200>\200>\316\366m\245\020\266\243\357"
+	.ascii	"\246b\317\311z\225\316\324\335\226g<f\367U\265\2175\036\373\n"
+	.ascii	"T\035\034\001g)\335\266`\241\226\302Uw\354\307^qW\221\002\263"
+	.ascii	"(\356\237P&\356\022$F\210h/\004\210\374C\273\207\016\034~\303"
+	.ascii	"\032\362\f\027\303\205^-TH\n\235\200#\036\272J\270\021\356\020"
+	.ascii	"\0368h\300`\301R;\346 \0360\037\333\314\254'H>\322\215X/\362"
+	.ascii	"u\"\210\370\220\023r\220| \377\343\367\241\276\367\364f\366="
+	.ascii	"\332\347\261\343\321\345Xk\255\325\017]\240\253nX\307\332\250"
+	.ascii	"\321\217\206\315Xk\031\367\037\035\357\263\356\245\202L\244z"
+	.ascii	"`\254_\270h\033}*\366\337\354\346\266Y\251\264\030\366\263\301"
+	.ascii	"n\257YM\232\321T\235\261\223\314\264\227\271\223\2711b\302\334"
+	.ascii	"\301\250/^\356]\270lYK\226\261|e+U\320\250$NI)\037\345Byrur"
+	.string	"o\322v&\331LS\241\245%Jz\222\202\023\250\002DY\221\244$Y\016\022\n@\220Dy\034\326\362\006\022\300\002!\206\244 \246\024C\212\210\214\210\004\022\210\004IR\220\244\003t\361!\251\323\367\366pBf&\027\334\024H\201G\371\240@\374_E0\354\236\023\206\006\335\241\214zf\300R\313w\270\004\352O\220\340'\237\270\223\325\343\260\253+2\273\005\200\006D\355\246\bZI\004t\001\257\006R\352kb\214\264\037G\225ZN\326x\245$\320M\353\241\326\f;\332#l/\021\257P\311\020\361W\276\001\247\375p\226\303\013\253\334Z\337\256\367\225H.\302\236L\261/\024\357\007^\214\331\t\251R\341<\"\036E\232O\204\244\257x\206\243X\246h/\322\370G~\267\006$\250\212#Q\272\005\272\362\371\335\205\241\317\316\221\257\026j\337\243\307\034\221\331\017\207\217\264\205RD\314\216\370#\215\361sU4\261\273"
+	.string	"l\222\033\307\241\317\312\r\326ul\233rx\261\372o\371\345\213L\222\022$x)\033\004)\321)\007\255V\020S\004\006\335\375ND\004\337\t\033\304\242\371h\303\376#\320\314\007\325\256\211\250\025v\221\226~\033H\332\005\020\375\036$\023\315\002\206\001`R\230\337\254\325\211>b\n\214\233\232\365\216E\373\032\361\317"
+	.string	"\251\334\332\3603S\370}\237\243\372i!c\026GB@\322\205\025d\335P\322\250\245l6\035\211\253RY\031C\240|\312\356\224D\025\235\237!\201_\252\211\351\374\224\262\375w\353\272X\035\343+D\001\371\312\340\004\"`\016%zN\325\237\355\334\321\r\253\242\375\004<G\232\250\265W\002D:\207W\344\032\361\253%\224W\301_\351\325\275V\252S\203\334\314y\301\t\225Eq\r\215)\210\300G\343YWQ \252\004\202\314IiT\177dN\237TqP\217"
+	.string	"Nkl6\205#\322&\323W\317R\033\273B@7\367q\271H\231\205\277\244}\223\346=\211\016{\352\256\221\341\034\257\300\273\360\354\227\306\211\016\001\200\262\244\025\343I\240(\242\2108\202o\312\342\200\360\237i|)$\217\201O\207\272[\303\331\272X\035\335\035\252tx\242\177;\003\2450e\371\036c\370\026SC\315*\005JY!\3314\345\007\214\023\226Ch|A\002\337l\201>\237$\300,\321\271\032qu;\367\212\377g\003\357N\373v\300\367\243\005E^q%N\241\270\314\320\307\304A\356\326\021\377,\034RO^L\016\035\016H\332\332\005\344\233\2178Qb"
+	.string	"\303z\251,\340,\271_>\343Ux\245\337i\333\016\177\263\027\304\304]<\330\222\365\277\t\022\215\335\206\256\261$\314\036\311f\022\254\020\330O\224\301,A)\270\335\324\267\244\246/<vi#I\006\335'\205\255\214;\001l\366\342v\267\b\033\203\330)K,\\Vz\323?\255H\342\373\301\252\016\327\265d\364\006q\200\031\354\236U\013\227(\234\214\324;\346\355\212\332\262vf\020\347\344\351\026\235\b\211\262\227|{B'\265\220\314j\024\0048^l5wB\350\310\371\255Mg\326\371\233\304\245\375\216\320I\013\306\210\016f\264\266}Y\251\030AV\235-m\3131N\254\314S\306\333\217\307V\242\343\376\362\242|cF4j\310K\024K\353\363\034y\250\3258 \302"
+	.string	"\220\256\005\023)\336\317\"\335\021\205(w\024\212\023\023\257\256 <\257\274\375\314\031\276\277\350R\305^\354`\202\373\3624\0318\251\n\320#\227"
+	.ascii	"\220<\313iVI\343R\221-\347.\246\204\034\236L\0353\356\310\024"
+	.ascii	"%\177\032Z=\2309$\0310+\245v\361!<\233\017~\t\250C\001\006\227"
+	.ascii	"\\p\030\261\320\f?\271J\222W@\rM{\345\323\205u2"
+	.text
+	.section	.gnu.lto_.inline.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`@=e\237"
+	.string	"z\243\004#N0\320\322\205\016\206\310\365\220\342\r\207\326\021\352\206zD\305E\236\030\271|\304`\372C\364A\346H\252\226\221(\026\373\003"
+	.ascii	"BZ\351\353\020;\307\203\002\002A\016m"
+	.string	"a\fYU@\034P\266wk\265J!*\323\237E\007\021\333jmo)S\346\001!\0021\002\226h\211DK,\326b\261\336\333\3672\337\276/\332\n\311\023\025\337\032\357\255Q\323\361\221&\305\304\215\267\2157j\350\277\215\346n\301\005\r\247\246ff\241\231q\f\021\332h\247n6\213LB\330\254\302L\335\264\306T8\255\231\306\037\316J\364\fM\026\032\216\346\037\370|$\236\241\240\037\225\377QY\217J$*\347\341\257\257\324\376F\266.!5\020%\376^\367\336\340;\360\220\376x\305;\204\277R\227\001\251bf\304\214.\373Z\233\022\300\177\272O\346\336\273s\237!\375R3\363\371\210\252\365\374\250\004\"\273\367\016\317\263\343\323E\264\277\245\371%\316>\370\325\307\304\322\323\344\365\177o\3651\261\330\3769\251\217\3641\261\354\234\032oe$\203ok|\333\030\375,[\316\361\213/\2527X\243\3316=\343"
+	.ascii	"\023.u\223\033\333vb\033B\333M\017\236\215hT\331r\213}\3772\256"
+	.ascii	"\342\022]\305\355\033o\344{\276F4\314\027#7\004\275\357\373\036"
+	.ascii	"5\220\246\016\260\020'\236\210\324`_p\370J\274\370\"RW\331m\211"
+	.ascii	")\276^{\217\372L`\240\224\240[\242N^1\265\350\333\026k\361\276"
+	.ascii	"x\347#\r\216O\274Wj\273\27130\024\274\211W\006\r\f\f\314\022"
+	.ascii	"\376I\224\b\323-k\bt\027\364Hm\314\3244\330\230\251mT\332j;L"
+	.ascii	"B\310\315&\237\314\325|\3163(\022.'T\376\346L,\326\340}\255\365"
+	.ascii	"\276V\276\257\265Z\332\3676F\277-\337\267\205\321_\216|a\302"
+	.ascii	"7\276\210\252\335{;\274\215o\242\313\357wQ\337{\241\204?\216"
+	.ascii	"{\357\323\017\304\377i4\367c\240Oj\376\215\364H\315h,\205\231"
+	.ascii	"\332\351<\205\211CLBx\246.b#\265LB\310\324M\267\347\243\236\372"
+	.ascii	"r\304.\350g\3443\210 BBB\027\002\262d\255L}\361\3021\034\031"
+	.ascii	"\334\230e\207\241\021^m-\276\312\030RO|\021\025>1c\341W9j\312"
+	.ascii	"<\f\211Pm\321\332\212\324l{]\224\"\212h\025/h\220\004_\320e\334"
+	.ascii	"\223\n\003\3606N\375\334\005\n\3647\232\337L{k\362\264\371\321"
+	.ascii	"\004m\305\217\017\201\347\377\207\036\345\275\327\303]\360\275"
+	.ascii	"\206>HZ\345\301\3312\364\002S\013\252,\350\036\020\211\304&\276"
+	.ascii	"\211+P\300\275\271=\226\321W"
+	.string	"\313\270'\317\355\255\214z\343\215Z\356\336\247\341\213/\222\375\335{\177l\022=\f\315/2\034;1\221q\204\t\317T\230F7q\220N\2153j\305;`^\242ui\\\362D\320\240bq\370\314\002\370\006R>\340\210\r\245\\\325\241\021\257A3\237\377\031MeF\244\n\306R\277\001\354\321\3653\036Z\264Z_\352\336\013t\f.\270\267\315\263l\331\341\026\320[\301\036\005f\317\262%\317'\220\200\317OF\362\364\3508\207U\035T\331\371\016\301\037\340\253 \352\333~\362\243\323\222Ae\356\251'\262\213\005O\301G\345\207\364I\370\033Q\034\262\220J\204\372H\236\244)\"\300Q\374\f,\300\n\374\325\022i\323\025\266\321NI\024\314\275\227\370\023&\370\"`\306tsc\373vTsl</\200\211\326\362\245WR\"\322\236\027\177T\276\250\336\027\232]h~\023\300?\352\2616X\\\"\226c\262\004\212\370"
+	.ascii	"=\314\343\005(H\233l\224<M\364\343\336\236W#N\202\346h\"\374"
+	.ascii	"Y\350\252(`\206\030Y\240\177P\234<N|\210\177\352\fZ%\3517\006"
+	.ascii	"\304\324lPA\376\200\016\200QG99#\247\347G\352:gq\326\214\310"
+	.ascii	"\352\202s\023\300C\374\311$L\267\277\241R\367\320\372\242\363"
+	.ascii	"s\020\312Z\317>\375\237jmMj\271>\346\234\004\325\250{\314Q\243"
+	.ascii	"G_o\361\256@\233Qs\270\332Xo\214zk\211\230\366\366\302\240\200"
+	.ascii	"{]\240h\321^\"{\342\275\367E\317\371\225Q\302\017\226\261\336"
+	.ascii	"Cn\031\030\344\205\346\331'\300Yy0\244\032\256\022\375=>\246"
+	.ascii	"\025\t\316VL\237u\320\3228\350o\271Po.\346m\270\252\211\330\214"
+	.ascii	"1\221C\244\006/\310\230\343Q\246\342\251\243\262\253\251\345"
+	.ascii	"\211\007\375"
+	.string	"\257.@\267\026<\274\343\354\325H\253\347\221+\030h\024\024\230\231\273\031\262\324\317;\377\203x\216Jz\262\274?\267\253\030\304\356\306\276\270\313r\024ms\253\342\343\333\237\241\315\031!\0273\344\344\031j8\304H\276\024\016\335[\256\311\002\323\203\310\231\317e\250\265\036\257\256z|\332\226\320\321\031\360\0245\325E\246\310\202\305\016!\0137F\366\314.w\034T\251\321\356\275\007<\206Z\257\270\331\376\034\324zmuP\006\220C2\251\352\0166C\264\372B\324\t\262\204\023P\246\356\033\222\326\374\034\212\033.\034u\326\217\2570B\032\004\257/Y\342\366G\355\234\322q\245\"u\231\261)\\~\276\276n\260s`\305R\270bG\230\230\327\347\356\304\\\330\306N\007\341\260>\201\335P\005EP\205\212\232W\006,\217\305iP\032f\252\353n\370\031\301\255?\344\275O>W\242u\370?\304\217\021E\3233\223\023\361\232"
+	.string	"\226\031\036v]?d\351\220\003C\204\016\264\023\235\372\033\233s\265'\031U\341\317\304\235#\272\345\245G\337\360\366Fy\025/0p\017\2506"
+	.string	"&l\300\206@\255$\002/\212\361Zy~\376\320#"
+	.string	"\220\332\342\354\017\336\276;\b\377\323hg\22201\025K\215\325\034;#\236\370\244\276H'\236\225B:\307\024S4\307q\212n\n\023\246h\247\256\347\032\235C\0169\344\315\034\206\n\374\243\276c\200|\366\326\250\275\306"
+	.ascii	"\371\202\357\272\027G\212\030\343N\317hf\212\306%\214\232\257"
+	.ascii	"=\205\243\300\257W?^\025\3653\n\223\213\213\254\031)\343\341"
+	.ascii	"\366H\355\205t\272\261F\364\"\235ov\202 \375\222|\b\236hn\031"
+	.ascii	"\230\bO\264S\323(hV_%\212'\360\240#32\245I\232\031F\334\204\022"
+	.ascii	"\254\275&\232\271\006[\341\245v\342\252FBgz\316\362\243\362\250"
+	.ascii	"<\031_\251\334\335>\375S9O\b%\2078\261V\366\261lma\302l\3477"
+	.ascii	"\026a\r\206\205L\221\340\013\332\245J\231\223\241\264\3740\203"
+	.ascii	"c1\347\002\214\303\310R+\223l\3440\363l\345\\=\270h\211\240\377"
+	.ascii	"\366&\310\030\013\316nTaM\";6\274\205\005\001a\245\315ji\300"
+	.ascii	"\271Jen\273\315d\314Vc\304\240:\234I A'^9\224\033\003\344\353"
+	.ascii	"9s&\177p\020\374\353\370F71\226\360F;1]v\335\001iq^\003\252B"
+	.ascii	"g\265\037\2259\272\206-.z=g*\334^\364\270\260\206\272\352j@#"
+	.ascii	"\342\334L\263\200O\316\304\260T\225\235U\216\0072\2431\033\321"
+	.ascii	"\341\320\024K\205`\231\t\001\340<E)\345GeG\321r\271\f\377\204"
+	.ascii	"X\301\003q>\343(\036\210\025PL\232/p\314#LZ\224\260\2479?\321"
+	.ascii	"\333\342z\342A\224=\034\274\0328\233\2255\371\327\374\312\020"
+	.ascii	"\251\340\253\353N\353\304\231\t'\345l\236\0161&\2103\331\317"
+	.ascii	"K\350\2217g\224\317\231\tA?\215V\362\352pg%OH\330\336\354l_\211"
+	.ascii	"3\211"
+	.string	"\025\342\234\344gz\007\206\216\234\2115`H\002!8#y\222\362\346\214\002:\037\371\377Jsx\302V\306\312\036\363\233\362\301V\314F\370\347%[\374\362j\364\225l\240\320\261U\002\354uT\3326\f\243\373\252\236s\372kYC\227\035%<\342d\201PD\212*\314\351\3164\360\271\1775\247I\335\262\305\320\250I\322\305~*\270\253\250\353\025\346\252\365\250\364\371\031\304\020\220MY'\304\255\023\274\273JE\007o\255XO\300\341Ex\202\024\024-g\031"
+	.string	"\361V\317\317B>g\326\021\0076\205\206\273\2120\371\262\307?~\205\201<\313\211\024\016\313\021\264\216\212\036\225\023\337c-\036\2556\345\235\231[ \212%:\325\366\246\314\003\347\031~T\305=\315\204\372r<\236N\0308\373\340\243\222'I\377\006\n^Jh\205|\262\207\0025\263&\313\234\3139g\261\027\226:yS.Xj/.'r\376\026\205 \250c\b\203\216\222\316:F\"\222$I:\343\022@\300x4\"\223\016\347\323\356\003\023@\f\007\203\370\210\032\246)\306\fB\304\02022\"\"\"\"\"\n\232$\351n Z\013"
+	.string	"+\0218\274j*\226\200-K\222w\024\347-+d\355\005\233\260\2276\260\021\377\244dB\b\263\250\2514\2751\031_\260"
+	.string	"\210F\274\354sA\346\b\203\372\224`\245j=\360t\023\303\221\370`+5\252\237\311\306\371V\350\"\007\027P\230\373\b\020\004\242\266\347f\017\274M\020i\261\007\351\300j\017B\333\260\243\346\034\310\241\337ZOi\260\371fA"
+	.string	"\013+E-\323\207E\356\023\177\022\f\374\265R\350\255z1\323\270\340\206\204\311A\336\266\247p\241\255\025_\025\220&1\342\276\261\227\023(\220J\214\030\3237\323;\021d\\\301\003LBB\332\0262\251P\th\266\323\242\343\254\366\003!\374\334\235B\036\302\346\365\273_$\\\315\341G\027\306N\310\201y\354\3158<\232\364\244v\017\272\032\263\364\325`\002\016\242\037\211T4\236Sr\311~w\250{(E\fYSP\303P\003\324\346ri|\316\303\225~$\274\022+\215\354\315'5\301\217\275\017\356\256\034\r\352\003-\001\022I\217\314QE\237\354\tA^\334sc\341H>\260~\332\\\026nc\2653\323y\370f\233\313NH\254m\3764\223"
+	.ascii	"\302|\016\232V\334@\272I\220N\325\373\006B\251u\0139V1\201\205"
+	.ascii	"F\026-L\352\327\301Q\345\013r\267\212I\007\257d`\f\260\302+\245"
+	.ascii	"\341\356\004\332\2552v\031\301\224~\361*\216\231\266\341\270"
+	.ascii	"\203)[!\275(\336H\363\024\342\377\335\247{`\225J\244\364\366"
+	.ascii	"a\207X\007\030\027\301\316\317JM\352\t@6\334R\372\303\356\005"
+	.ascii	"\270\233\344\2577\3656\350\022|\020\375 \271Y\b\237\274\364\231"
+	.ascii	"\251gQ\213}\312A\354V.+\"\222\036\016\270Q\230\201\241\036+y"
+	.ascii	")D\251\360*\234\206\220\316]q\302$\336\024\357\245\004\220\016"
+	.ascii	"\320}&\235S\245r\325m\342\315\310y\311j+\022\002z\002\353\220"
+	.ascii	"\310\t\356-\322\t\370jOW\321\036\303\343`\275\034@c\273\240A"
+	.ascii	"Mvbe\234\344Q3\363\356\354\337\353u\221\375U\215I\316\232\334"
+	.ascii	"SQM^h\334\377rQw\331\334\305Dc\325<\266O\027In\353\204\337\236"
+	.ascii	"\346I\264\0026[n\267\024?j\260\016\203\226d\361\261c\3550\225"
+	.ascii	"d\243\243S8\324\r\f\004\350G\270\361\002\327\370iM\325\240\247"
+	.ascii	"A@\340\006\3227b\235\nw(\267\273\250b\341g{K\302\246\322J\217"
+	.ascii	"f9\007"
+	.string	"z\307\233\330Hy\276\200\f\224R\3069\246\305\271\221A\2108\314B\244\005T\327._CK\304\n\321\025$\311C\342)\303\203S\374\274|\303\025G\254Z\210hnYkEh^\235\251f\245f\336\250\357y\257\005=\013\316\310\250>o\330V\367.5b\026x\237[\177%\3367\353L\034\262\n\311\317!\227ta\250\201\206\225\244M\223$\210\376\001V\007\003\245A;\f\241\210#\r\265\t\267\275\215\030\343\332\211\002\275\361\242<'\261\2403\241\353t\260\335]7\350\375\243N$\tM\231%\244\265\223\"'\033a\3275\323\331\027\367\322e\345\212\316T\033V\330\230N\0377\213\322\260\252\311\271\336E\f\226\363\310J\006\036\362\0363p\240lLw\203\332k\332\300\267\001\034\"\376I\023N\341V\312\363\305\200\211\325I \306\214vzDfB|\310\f\237\277\234\005\201\330\264\267\"\275\331\277\267\343\3003G"
+	.ascii	"E\034\360\330=\341\300\030\003\210\215\017\245\203\232\314\021"
+	.ascii	"\262\005\240CYx\272r8\025#<(\200\226El'@\302\355G\250\353\tB"
+	.ascii	"mha\034\016\327F\314\007)\037\230\226v=\245DS\271d\367\352fR"
+	.ascii	"*l\212\217-9\325\261\"\360?\225\004\311\316\207I\266\375(A\363"
+	.string	"\362\256\t\250\013*\t>\215\302e\312Kd\251x,\271w\275\265\020\241\f\272L?\005\036\022\032$\333\262]\235 U\220?\231\342\300)\036\030\314\251P\205\206u>$\243\347\206\241\214T\024=pD\201\242F\253\305\277\227\250\250\211\245\362C\276\177\324\214\016\332-0}T\266y4x\277\033\223\331o\303\242,i:\354X\237\263\367!,IE\r\244O\262\204\251rL:s\211\262 \261\3278\004\017\237\201\003\330\244\005\364:bT<\261\203u\"\250\231!5\b\335\026\355\354f\310\256\030\b\356\241!\375\207\204S\373.\017\263uT\235\324\251\233!\016`*RB\305d\252a9\263\230\312I\304H\230<\032\\\357]j\314\304\r\266DB\304\205\374\233\350\2304\335\350B\031\375\343\323+ql\261\243\212\235\036\240H\367(\366\371\315\327\3562\346|\013W\213j\270K;Ki\355\260\265nD\272\267F\261"
+	.string	"\037\214\362\311\231\023\214Y\324\b\302\243\036\277\200\n\272\344\247\362I=\325\003AkA\214\3059\214HmR\026\331\244\236\243\311\213m\377\034\340\261B*\302\327\352\325+\373\210\031\265\270\300\325)\232eZ\250{\236\335\207\031\225\303\374\320\310\337Y\337\342\006\256\\L\274\020\256}\223*\310\3153\342\256\032rH\\\321\276YL=\242\017\0214\351[n7\372\022\301\232\337=\234\311\250\371\001_\254\234\247\303Wx\b}\302\232\222\001,<\336E\206\372#\2533\001bc\311q\227\311\331\235A\374\376{W\\`\300W\307\342\373:d\203S\374C\336c\200\374%\006*\260\ft\322'\257'\016\372\222FN\324\365\007GDW\002\231T(l\272\312\233D\330@\204\247\204\315\347\377\234\260\033\003\377\005\267\244\344K\272+\332\033Bo\277\373\350\201\351\272"
+	.ascii	"\227\242\261I(\312bn\374$\"=\201\325<C\311\233x/\305\021\203"
+	.ascii	"\207\215!\360;\370\217u\004\223\r\355\2165h\275\300n9\n\002^"
+	.ascii	"8_\032\005\225]g\201\363\270\037\235\320.F\321\341;eh\246 \374"
+	.ascii	"\250Q\336#\270\226[yfvtZ\237\334;us7}\304\2078\342J \324!\022"
+	.ascii	"\275\"\232\245\342\256\364G\234Dk\033\227\360\213\344\316\243"
+	.ascii	"\214\325:\351\260h\244\240\254>\333\235\022\225\337\236ml\316"
+	.ascii	"\34163v\020\001\020?|\244\026g\225\272\2040\3463:1\364\330\242"
+	.ascii	"\356E\247\b\362\364\003~\314>-\205\215M\222\367\331\203?\254"
+	.ascii	"\351=\203\242w\244{dF:}\232\275\n\b\344`D*\027\"\223"
+	.ascii	"\3279\020\020s\353\371i\250\344\274\2744W\272\020\002I\356\226"
+	.ascii	"nP\251p\202\301\231{P(\326\202\t\327\302\312\227\232)U4\205f"
+	.ascii	"\332s}+]\261\301\256\020:\022\341=\030N\332H\037\006\301\363"
+	.ascii	"\023N\030\374Y\207T\005OG\005*\232\345\244\361\001\033\277\317"
+	.ascii	"\006GJ\362\233\210\265\366\035L?g\252+[\317\355\222\313T\214"
+	.ascii	"L\370W\342\247R\224\206?B\304@`\023i\372\237\0217\256\333\234"
+	.ascii	"\202$g\252\3774\242(\365\366']\030\227SR\277\217\332q\367c\240"
+	.ascii	"\361VdI\271\036\375\242\036^%\025d\215\363\226\022\341\0270T"
+	.ascii	"4\366\034\357p7\2433\300O8\265\272lY\t\223\341L\221\332\211\341"
+	.ascii	"\032p\207\342\222p\013\207\n#\367pN\003\217V\005lT\2066^\247"
+	.ascii	"x\251\205\3451/"
+	.string	"X\344Jzv\b\374\254\277\215\376:8\037\376\r\300]\001\017\242\234\301#se\200#+&f*\034\177\357#=\270Ht:SW\261P\275f\332-\374\214\337\2460\203\312\347\023w\344\004`w\222\262\036\374\031Kk\360\256\214\024z\331\2010e\214V\221v\344\327\330<\002&]\256\313\253\271\374/\241]wR\261\227l\377\325\227R*\302\213Si\226\324\222\265\235\031:\262\201i_C\332*\007\207\006\024{*8n\3619#\024s\203\324\332\222\345J\320\302\212\035\345\004\3758\037\202\3579\346\366|\262#\366.\311\035{\007$m\245%3\3776\034\255s-[\302\325\3019s\352Cq\006\336P\364\036\022\231\245`6\371\2062\361\243\307 .\220\226\252$Q\024\350>\3443\356u\034\254*\266sNa\335i\017\243F\251H\361\240\335A\237\326v\364\301\221\203\367a\330\252d*.\007m\261\355\227\374"
+	.string	"\365\262\250P\351\021\017\003\377'0\231@v\344\342\313\\M\317\322\237\236(JD\352\026\373\267\351.@\"\263\314\021\221\211 \260-\rDG:\030\245\365\004\006QK7\326@\200\253\350\243k\256-\247\323\376"
+	.ascii	"\201V\306\305\215"
+	.string	"\017\352\030\270z\322H\034p\357Z\230\025wo\020\332\224\356gn\317\005&Q\362$\2734\230\221q\321`\252\210K\201\345\232\022\224E\215K\216\025\303w\267~\335\t[m\207q\035J\322\247\333\343sXf8?\241;7\205Y\027\3754h}\355K)3PI\334\276\355s\262t\215\r\033\224BKLTR{\366\356\033\317<\263\034\365v\200\n\020l'\035@~H\377\324V\236\356r8=\321VW\230\256\r\337I'W\255\276\031\367*p\034\016\232\346\375l\345\026zv\231\023T\212&\201\021\370\310k\267\b\036\220\030\236\301\376\274\214\367x\337w\025&\230\201\037-\006\241\315R04Xt7Vj\355\320\255#\345\341(v\240\240#t\"\345\242\357&\336\367\370\270\366Dq\233\372\303\220\315m\r\330B=\361\351d#\366\306\351\212\267g\030\005\305\031\375\210\372\325CIF\346\202\b\266#\244\220\203"
+	.ascii	"+\b\310'\022L\330\273\237\t\332v\351\fY\tM?\276t\336-\357a{\260"
+	.ascii	"\256w\212e\202\251\344"
+	.string	"\3435\023\242\217\366\263\"h\231\354\371a9\261-\363$,\023%\270\240\322b-Hg\277gJ\243\177\200R\270D6\233*\034\206\345\220\252\374\335\370\337\311\207\027\262\357b\376\303\311\315\274U\006#\372\263\375\221C\250\007\210\021,l\003\335\rq5\027\211\303\213~\377\360\257\271\263\327&\346\360\3460H:\214T\347Q-{\377\220:\233KP\002n\311%J\365I7\371\206y\203\364+\340\274\271\366\214\240V\372\350\bz\271\205p~\320i/\361@Y\356\270|H\2276\213\361\311%\342\305\303\247O\230\311\243|\371v\310\323>?\3202*\341\333[\272\2557\271\013\377\377xmv\025 @f\027\017\222:\271\350\343\271\030\320)\214U(\2063\323\002y\254\255R[\t\"5\311\003\037}G\206\301`vr@i\316\215)\021\363\203Z\257\252\201\326\273([\212\232\n<\207\305P\f(\351\213\236G\327u"
+	.ascii	"\360i\3612\370\261\252\0176J\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`aj\245\327"
+	.string	"\312\006\3415X \316\262\332\034e\334vo\316\322\034\007\007\360\241\216\307\357>\272\243\037\376y\307\215<\256\343\2537\346\267\365\262%1+\037\330\254\275d\301h\353i\021Cf,\006"
+	.string	"Pb]\364\227\371\006J\246g\201\213y@\262L\226\270]\320M\266\373\037\214X\3727\333&v\313\224R\037\003\\\003C\003,V\r\242)\267\217^\242\004gnc\370\370\361\362\307K\331\331\335\275-m_81Qk\302\211\002w\333\252j\002\255\352\r\212\031\037/}\276m\tK\233zjP\324\244\340$>x33\315Q\265\362\320\345\326\305\356\330\241Y\334\352\226\025\234\271i\261,#^\032\361R\005\0274yi\342!\001\254CS16\007\232\006\021g\"(\3202,u\247\035\234:I\240Ri+\272\013`\305\273\035\207\246cp\326K\353\034;\341\346\2469\252\332p\3220,\265\211\243\275\2054\220s\251\201\361E\315\213\034\234R\357\226B\277\260\324\313.H\314\245S,,\345nn\003/c&@\331\331\361\360\247\273\351\021\227\224\bK+\305\301R\257\301R\372"
+	.string	"K708\323\353\260t\013\2033=\214\245\336O\334\233\241\252\030\234\351`,\345\234\270\006,e.\335\261\260\324Y\360,5(\020\324\310\340\334\tK\2438\323\267X\272\243\004\032\t\334g\027\231\301\231}\306a\351\306[\253\333\211\304X\2721\227\336kX\2721A\2033;\252?`\351\306;^r\"\224ipfWa\2513\3075N\365\2629\252\246\240\275"
+	.ascii	"\233sM\215Z\030\357\030\2327oo\031\234\312dp\312}\266\254\346"
+	.ascii	"F\365\352\343\323gk\240\301\022\023pf\333`\251+\021\303\231W"
+	.ascii	",u\037@\310 x\022g\356\003+\214\304\203n\243/so]\033SS\260\224"
+	.ascii	"\001\256DI3T\r\323h4\007\332\325h4:\rZ[\347y\216i\235\347y\252"
+	.ascii	"\340\333\227\315\214>\243\366\006\267\005\270\226\202\222\n\357"
+	.ascii	"\030:\2655\213\251\235\242U\214n\017\264w\331\b\260t\265\362"
+	.ascii	"#\335\023\264\0022\001\016\316,\241\266\002\316\034\032\200\245"
+	.ascii	"598\363\310\026\032q>\351h\216\252\rF{\363\331g3T-\237\272\354"
+	.ascii	"\322W^\312t{\0173s\221\2253w\023q\346!spfg\251sh7h0\335`t\247"
+	.ascii	"\001=\317\346\250\312\315Q\325\233\236g\377p\246\335\317\275"
+	.ascii	"\315\274$\205\324\316\342%\347^\323\355\0310sYn\241\227\235E"
+	.ascii	"\250\273i\020\346\322}p\237B,\255[\017\346r\363\022\307K\316"
+	.ascii	"K\235\177\036\334'=\317\032\035\234\211\201\245\356\303\322\215"
+	.ascii	"\313\356\332\311\2316\226V\346\222\005\316\234\261T\013g\252"
+	.ascii	",\365\020\207\271\213\264o\264\035\334\345V\266\223\013\265\333"
+	.ascii	"\311\205"
+	.string	"\352\315NMN\271\005xs\336\254n\277a\356\355\213\215M3TufY;\311Q\275\253\350\246\242\275\235\206\250mc\305\233\2558\227\224\255x;\327\315\313\225s\253\333m\312v\332R\273\235\266To\247\0318\263-u\346VK\321\035E\367\331Ajw\220\352\355\034\315\026\223i.\267\315\212\227\244wM\267\263\372l.}\373\302\275}if.\267\332\336\336\275bf\0253\247V^\256\274lu\373\266\242\234\227\264\333i^\322:\346e\314\313v^\322\335\224[\013\317d\300\234\302\007\001\324\271\304\351b\351\206\223\305Rg\325\271c\016K\353\216\023X\352;<`\251\233\355\276C\003F\374P\335\002\324H\263\220r\206\271\b\037*\02155g/\361\341\025h\257\356C0\323\323\013\316\334\201\204\245\276c\007\377\2023oX`)\307K\316\276\t\3437e\334\200\300\322\215o\226\260\264\362\323\323\323S3T\345"
+	.ascii	"g\332\310a)\007\246\335\231\335\373l08\323&\t"
+	.string	"Kgl\272t\0176\r\260i\275\240\245\002K\335\360\302\\\212Q\235\276\320(@As\324\007\234\326+\034U\271\247\247\247\247\346\250J\233fiW\251ZkX\352\334\352\326\bZ-2,\335\270\266\300XZ\303\340\314V\007,u^\361\220\205\245\255&\312&1\232\240\3121Z\207\250Z\207h!\255\033,\345\326\341\023\274<\241s\250\215\251-\031\310\340\314\232(,\365\032$,u\372C{ST\365\032\035,\255\331bi\345\326y\232\301\2314$\2604\207\313\222&\fK+=\317\263\321\340L\232$,\345\234\306\006K\271N\2033g\330\260\224\265\302a\006\214\245\316Mq\350\236\271\302\322*\205\245\233S\02370\227\3563DX\272\315P\300R\034,\365\031\032,\335x\005m\303\f\003\324\340L\231\026X\272\255\234F\300kh\0316d\304\260\264k\220\321\247N\245\2726\246n@f\013K\353\023\226z\237"
+	.string	"h\206\2522FX\272\321P]\245\n\302\322JC\030\355\265\005\246\005\246\031\252\252\332P\265!\343\305\322\332\002\323\266\252\332h[\275[\247\f\027K+\313\260`\351\306\\J\326\033\226na8\223\025e\2513\033\234\311j\302\322-\364r\325\0178YP\235\347YG3T\245===ea\365`\251\273\301\231,\030,\335VpXZ\271\364\006\360\227/&\340\314\025\030KkmL\355+\332\246r\331Mb8s\305\304?\327\225\020\226\276\301\231\034\035\226V\356\215\031X\2543\272\b\027N\267%\034\227\025\252rkXZ\267p\331es\033\260\224\353-\274{\013\357\2257\221\030<\252\213\264w\227Z8\3356\030\272\324\262\203\332"
+	.ascii	"[S}\301\273\310\300\027K\271)J\347\240\260\224Y\346rT\257\\6"
+	.ascii	"\207D\317Q\235\2476\225\371O\217\251\316\334MtT\347\262\206\353"
+	.ascii	"b\251\253\306\250\302\250\256\260tk:9S\005\204\312\264\2642\255"
+	.ascii	"\261\300\231\225\004U\270\300\231\365K\231E7\026NS8e\031\026"
+	.ascii	"\3550\324\225\273w\267)\003\242V!g\271c\325.T&\272\205\n\204"
+	.ascii	"\245\336Zj\017M[j34=\321O9BB\360\016\241t\b\264\327\206\242)"
+	.ascii	"wNs\341\314j\346\204\340e\bN\251\323Rw\"\265\002K\271i\340\314"
+	.ascii	"T\030\333\024\201\332\r\234\204\tZ\353\002M\271\267\024\030K"
+	.ascii	"m\220x\211\344J\027\226z\323\022\256\004\311e\273\227\366\272"
+	.ascii	"D\227^83E\304\016\016\274\344@LM\240\364\241\366Ci\204S'\242"
+	.ascii	"Cw\256G\364\222\npf\212\213-\215(\207\340\314\224\026\026\220"
+	.ascii	"\227@\261m\016\247\"jFp\022*\204\323>\233\247\272\020\355\335"
+	.ascii	"gL\001\255\346\251\334<\325\273\365\343\375\343\035\363\262H"
+	.ascii	"w\323W.\016\364\376\353\036\274\367\n9v?\230&R\246\202D\231F"
+	.ascii	"R\246\"\205\362;\377\327=)\206PV\354\363\335[\345\311\020\374"
+	.ascii	"\0176\013]<\2020\213\346\273\340\225\205<\310;\3560\r\313\347"
+	.ascii	"\353^\311\1773\257\312\367\200W\026>\226\317\273\"\314\003\302"
+	.ascii	",\032\237\257\373\220\374\257\373X(&\375\367\205N2`\237\357\302"
+	.ascii	"\252x\340}\021\242Ly\3612\205\177IO\374o\346\211\260\303>\344"
+	.ascii	"\213v?$\377\302\\X\\/\336+\241\354{\224\300\327'zW\304\260H\003"
+	.ascii	"\026CQ\274\177G\321\2032\303\277\263\263\203t\204\204D\264\263"
+	.ascii	"\263C\303\264\231\2671m\346\375\340\312c\367\342\245\275b+f\321"
+	.ascii	"\220w\274\"\213\246\305#\355\025\213\345\260\212a0\357%\3361"
+	.ascii	"\b\253\370\353\336\206]\260\227\227D\023ix\305\n\370<\0010\307"
+	.ascii	"\263"
+	.ascii	"\356g4\361\206+\317\272\017\231\304;\372`\361\357(^\246+>\355"
+	.ascii	"\025\033y0"
+	.string	"\307cgdF\234\221\336M\222a\231\027\333x\354^\346\305Tl\304\371\306<0\305c\3677\346\201\034\177\335\033\371\257{\241\253\004zb\017\276\341\357\241<\n-\221J\340\205=\026O\024\207n\370\311\321\367\024\025\035\275\320xg0\217\351\277{%\204\301\206|0-\tP\367\337+\205\231+\226\303\035t\340\023\224\342#A>G|\200TL.)\275`E\263\030\221\220\021\224\241\207\022\305\311\330\375\220\261\343\371\261\373\237\037\273\337)\262#\303\257\344\307\356\311;\262x\354\336\310W\036\273\025\213\246\362\230\304H\367\377\377,\376\220t\033\223\340\035\257(\373\017\364b\261\320\365P\2428\371\360I\017&\307\020\366\343U\002\275%\327\177\227\311\033\301\331\367\0305a\362\027f\371~a\354\305\373y!\214\f\303*\017\276^\t|\221\242G\216W\314\200\225\300\027\2237\252\230EC\371\311;\246\370\311\253\224\342\003\240"
+	.ascii	"\204&\305\342%G/\246\342\013{%\205\242\214\343\361\222\236X\031"
+	.ascii	"\006\3636\036I\330\314K\272\337\212\225\300\027\031\206U.\022"
+	.ascii	"\213f\206iG\200\272\024\3678\177\035\345\257\373\257{\025?9\242"
+	.ascii	"\\Tt\264\361\357\260hR\314\301\027Nh8\rA\b\232\241\252\ng8\345"
+	.ascii	"\270[\013\316\354\321\206\245\376\364\324M\\T\367\241.\276d."
+	.ascii	"=\216\026A\273{\031;3\264o=\254\260\324{Da\251s\035\035\244>"
+	.ascii	"\237\315E\217 ,\365\3565\332i\013]v\035\375\243r\377\250[\017"
+	.ascii	"C\325\0369\364\330b\251\247hwo\301\314=Z\260t\323\002\216vJ\273"
+	.ascii	";\003\335Y\264;\026W\274l\357+\332\235v\367\027+"
+	.string	"\252\200\241R\201\203c\343>\205N\tx{\241=&\205\016\031\226\272N\022Q\324\252#\204\016\027K\235\241\210\325'\276\374\222\373l\347!\206\207\026<\224\340Q\004\006\030\252^\200\207\027\357 \225\262\240\275)\023<\264,\221\303\002K]\t\346\322\317\2345,\335R\035\244\262\252\223\310\321\002\211\234#,\365\034/\226\372\02196X\3529\016\260\324s`\300\t\323=8^X\212c\205\2458N\330le\260\273d_\f\277\007\024g\344\025?$\337\222/\332\265\177eXH'\342%A\"\026\r\022.!(\204 \024\200\030\340\b\n@d\330\312`w\311>\026\221\374\036\360J\bZ\001\247`\300\334s\033\277\020\016\177H>y\307\037;\231\232\312#\3300\030\276F\3612qo\303#O\b\252>$uv\370\302\356\370\017\363\300\227\322K\f\377\212!9^\3212\030\276HO\2341y#\016_&oL\311"
+	.string	"\341\031\376\272\277\244'\2668\001_\347\343\003\204\302\027\035=\321\bFQ\244L9z\242&FEGHP\236H\312\020\322Ky%\360\265D\206a,\3123A\372\035\035~rd$e\250\311\021\024$\")O\214j\270\312C\222\222\302\024\363|;\036\323K\034\002\363f\240\027\343Y\361\220\220\234y<*\376\025\226\276\356\205\222\222Br\346z\375ez\221\256\241\337\t\302/teX\310\027/\t{%=9\223\201F\277\243\303c\354\353|\276\216\343&COH0\212\362GOX|c\236\230\364T\220\236\274#\374\016\020F\"\222\322\304\250H\305\343\007\206\256;\276l\n"
+	.ascii	"x\224r\303C\260\210\227$\275*\037\345\353x\376\204 \037\240'"
+	.ascii	"\342\221\260\360\204\rx\205\022\234|\235\022+\256\020\306\344"
+	.ascii	"\247@ab\303c\247d\354\276\207cW\347\2631\255\243\001\275\320"
+	.ascii	"8^\361\373<+.\217\214\"\200\247y\261\025^\343+\275\222\300\320"
+	.ascii	"\365=\317\344\210\221\020\307.9b\211B\005\351\b\t\001$|O\354"
+	.ascii	"\325\323u_'4\005\n\223\"\026\032\225<X\322\177\257\004\276b\342"
+	.ascii	"\220\016\277\020\213\177\3546\366\300\331\f\217\257\021VL\304"
+	.ascii	"\361\350\374u\257U\212\377\307nU\231\343f\332+\306\032ix\f\302"
+	.ascii	"\254\3771\366\003\363\310\220Tb\362\376\363B\030\315\213\375"
+	.ascii	"8\373Qb\362\376\307\331\017\315\213\375\257\260\364sIO|\023X"
+	.ascii	"\374CF\016\272\2371\b\207\277\305\237\007\335\177 |\037 \351"
+	.ascii	"x\370C\322\375\277\r\203\020\324=\030\276H\027"
+	.string	"8+z+\256\273\304\344\251 =\177\037t\377}\020\324\375\2201I\307\363\342\205\315\276\273\344\212\362\203;\350\276\353\276\240\316\347\363\340H\367C\232\f\031!\021Ey%\360\365\315`.\332\345y\230G\206R|x\234)!\300\377\307<Q)$\307\327\322[\031=):<d\364 \250\343y#\377\035\001\352j\330ui7\305\227\364`)\361\322^NXL\216/X\212\205.\254\212\007{yLC2<v\277\261L\n\237\350\205Uj\330\206G\361\2123\322\345%\315@/\206\303\225?/\204\245hx\354\376\273\237\0276aq\345\312\037\315(\206d\030{\030\314k\261\317\327\335\260\317\b\203y\257\004\276\306)8\354\363u\377@H\357#\336*\261\031\370\344LF\316\302\216e/\206\242H\224\303_\367\264\373\201\257\027\303\244\360\211\316,\034_\t|a\361`Px\360\220\257{\241\357\222\256+\243]\236\017"
+	.string	"\273\272\027\372\300Y\230\364\342%]\236\370\202yL\240\021\006\314b;v\366\205H\360\212\342\214\311\373\200\236\353\307\216\b\250\364\032i\030vA\320[\n\205\276\250\023w\233\032\3459\346\214\210\210\210\214$I:\263\022@@\210T,\026\013\207\333&\037\023"
+	.string	"\301\210\003\301\220L\026\016\207\003Q\220\2028\006\342Ae\0242\210\324\310\214H\223\246\003\210\205`\r:Z\301\314\210\326\215\214b\357\233\311\272\203zT\326q)\0040o\353\256\364\323\017.\206m\035\304\213X\020d\343]5G\303#\005\3161\020;\3352\256\005\243Y\2168\213\023lb\250\230\313\225\t\344w\2118\243\361r\237\354\364\320\030Q\357\315\327\222\237[/\314\375\365\237\313\005\213\013\377$:\207\n\356CO\246\020\350\0226\"\032_A\376\377$My\300\327F \231QA\251\3204r\201!_\236x\375\213T\326P[\351\204\300\rH%Y\255\363\021\215q D6\323\273\246\307a\022\216cq\271A\267\006\002\321"
+	.string	"\221g}\345\2732\210\351\034\035\250\362\031\346\273\205q\360\315fL\034\307\304Hjh\261Y4J)\263Q!\314\025\351wN\033\361\264t\2215\322\365\245U)K?$\365\267\001=\342\330q\202\361;\007\f\225\231\300V\303\373\231\005>\316!\240\375\315\371N=\363e\313\245s\227Q\215\237V\351\242\244z\252\035Q\304U]N\200\024\035\250\254\274'\217\311\223@\305y\022Y&\205,\242\270m\341\fD\363\337\203\277\324\273pR\353\376\374\331\fk\3168\274\361E!"
+	.string	"\275\371\225,d@\317O\325\036\204\242\246\372\363\031\245\241C\336\301\227@{Z\325\320\033\256\266\3100\214\217\032\3373\201EU"
+	.string	"\314\b,/i.\n\024>\264"
+	.string	"$\006n\366\f`\225\261\2570\3342%b\257~\351\270'2\334\266F9Q\355G]hO\315\252\207c\300\304fPQ\024F\013\307\005i\036+1_'X\317Q\270t\241\261\320\256\207 (2\027\226\310\360\310\"\tA\226vJ\2214\327\334\202\327\301"
+	.ascii	"\221\246\371p\325\370\205\035h\267%|\262n\274\"\234\241\314\360"
+	.ascii	"\027\017\377"
+	.string	"R\215\021\251\351\332--\215\025\027\216U\303\371\260D\237\"\321\275r\225\331\300K\235\201AM\325V\273\007\026b\276\302S\344\001[\2225\022\032\244\322t\360\\\236\300\242\001\212\322\205\240\343\033{\007w#\256I\032\267!\333{\217\233\302\337\017\220\177\brI(cHhy\306\327\201\252\354Kvx\364|\036\330[1\335H\032\217\214\252Q\013\200aK\370)\005\211\"\324\360e\032o\221\353\361\225i"
+	.string	"\3245\003P\220Hr\336)5\357\201K\210h\222\034\334\002\025\216I-\337\334\276\322\210%\375\030\277\321/\017 \254b\355\311\013\017\357\355'\007^\200\t\236}\304\304W\346t\224\375\bi\f\256\343\036q`\233t\007\226|\202\001G\334\312\343\204T%gL\366n\032\327 ,\201 \322\234\371$\331eD\210\003r\315\201\034\301\351u\243\017\376w\204\3265\222\b\311E\341B\216b?T;\247\214\001\2263\260\326q\204V?\350m\24141\252\300 \226\307\277\351^k\f\323\360\362g?tZu\317\035[\025H\352\201Uof\206cII>4\021\023\221Q\230\342##\375\216\020\036w\217\006!\201oc:\326v*+\025o"
+	.string	"-\027\314\345\204\330\324\275\342f\275\360\305\007\322\007mT\214\220e\005\214c\365+_mQ~\031\362\236YH\\\253\360\222\207$\304\030N\311b&\332>\270O\314\327\351\332\031\276\236i\354\317\357<\302\326\341\270t\244\245\232\306\257#%t~\361\223\317\307/\344q\b\202\201|xC\\\225\266\373\007'5\353\201\270\335\265\310\222\220Hf\342\003L\342\206*:\311\234$\247\340\223\304f\231\371\323'E\257\023\202\225&d}\334p\037\303\256\337\350K\344+\225\275,f\n\330\037\f\316\211\t\b\345\037\005B\016\332Q\263\376C\025H\035=_~\272\302K\220\326R\206_+\253\224^\354\272\211\024\215IQ\264\250\314\214vvf\334lT\2415\034\313\211\013z\224\265\267\222\201\373\204\375F\006[\341O9\004\355.\323\246~\035e\365\354\3232*"
+	.ascii	"\213\363-\357\036+\243\352)\346\035\277k\246\362\b\200(@\354"
+	.ascii	"\310*m<\365\370\275\343qQ\300\354\227\315\020`\217\314\204\221"
+	.ascii	"\207\205\373Y#\253\217\357\370c\341\\<p\273-\275\313\"\320,\205"
+	.ascii	">3\247_\222\024\344\370\205#\305\001\206\331`h\264\263\031\307"
+	.ascii	"\277`\304\005\021\366j4u\334\214xF\364-\017\2146\271K\022\321"
+	.ascii	"\306\244\r1\361\232\023\017|\212NA=\304\345^"
+	.string	"\245f[ss\\\353\247P\235\3601\360t\371\343\023\324Y\343\351UQgG\357\264\316\327\361H\342\013/n5\242\020\312.6~H\255t\016\204'>\213.\330\233\017\323m\202\"\020\350\207\366\240$\370\213\201Ek\203\210\213\214\212\260A\331\272\346\001}L\374\030\350\205c\3207\f.x\034\f\271[\245\026\317\2204\020\210\235\215/u\352d\264ik$^\001\001\332z\353Y\307\265#\232\273P!N&\373\365\025\254Pj\342\203S\013\302\0043@\3738N\302\274\031\345\027\330V^\225b\367T\274\030\346\013%aKt\276\225[g0\225\327\024\360'!iT\006\027\254\232a\021P(\235\033\225\315\2115\215\301\"\342\272MY#\3127\251\315\246C_\207\256\323i\215=\327~*y\212\200)\244lH\356e\211\b|[_\233\312\234\335\033\314Y\266\303\364\235\rL\006y)\214\302\261\013\361\2155\200\244"
+	.ascii	"\371\031\262}TZOk\036\250\2732\273\232\f\270=\373\265\321\314"
+	.ascii	"L\022$\316nyTfdWt%\026\224\223\210\263\277\230\340z\037\024\034"
+	.ascii	"\311\223%Oxm\243\265\025\217\207\346t4\302\331\027\3008c\005"
+	.ascii	"A%0\366\263\3768\324zV\251\230\017\314\203\f\274\360\002\232"
+	.ascii	"\030K\370CS\001dS\n\004\327\337\337\337\021\007\354]\345HhgY"
+	.ascii	"lc\366\302k\323M\346\036\3122F\001\220\235O1\327\261\022-!v\347"
+	.ascii	"?N\224\207\221`\200\320\244\310\321\032\036Qd$Y\266\235\217\346"
+	.ascii	"\367%\2635\315\322>\372\214\017 \367\333\206T\302nz\rx\026\301"
+	.ascii	",\b|\221G\332?\037\2401\361[\004\207nWq\333`\005m\035\321>\254"
+	.ascii	"z+]8\025\361<b\252\307\005\370\244\032%\343:\226\317\247z\257"
+	.ascii	"\222\345\rg\246\203\300\003\001\204\365\241\275A\0059\031\256"
+	.ascii	"H\216\032q\342\253\304\327W\371\3314\t\3718\203\254;\220\302"
+	.ascii	"fF\356\346K\312\004\316\252_\331@\341\352\227\207n\026\343\342"
+	.ascii	"U\005*\371\031t\230\207\253\332\365\252\205W8\315f\316\332\020"
+	.ascii	"^\247\302@\305\311\020\320]\323V\334d=97\216\255Y\267FB\002\347"
+	.ascii	"\375w\226t\200\016\203\372\211\254>\352\342\252#-\360\376-\016"
+	.ascii	"e\022\205\230nW\257t\n;\236\207\346\312\002\307\257'\273\211"
+	.ascii	"c\311\302\026Uy^\314p\314\357\271\376\271b\204\022\r\227\340"
+	.ascii	"\325\344\023\033&\003d\312fz>\3571[\315<G\375b\"\2222\270\206"
+	.ascii	"\375\343\3254\205\227\312\360\\\351 G\204\244k\016\232\007}\005"
+	.ascii	"\307\237\316\336Ae\342\022/U\357\243\003\253\375Z\320U\234&a"
+	.ascii	"\245\277P\005\241\334A\203\247\250\203\204\270\206u@y\353]+\202"
+	.ascii	"\341'\347\r\020k\210\371P0\241\301!{\321\356\266TGP1\016X\205"
+	.ascii	"rw\201\006B\036\356\020\362\030u2\315\222Z\347\207\354YTM\264"
+	.ascii	"9\005z\nK\242\b?\305\200\005\316\245\337r\2350O\374am\177\250"
+	.ascii	"\203\232T\244\305\022=$\325J\332\313\314\001QeZ9\\\344u\025\023"
+	.ascii	"\301\022\034\272\340\306\343\273\316\270w\214\363\036{-\242\273"
+	.ascii	"t,\304\\,\227.\034q\241\026\327a\366\037\034 \267\220\344\340"
+	.ascii	"G\343\341\3417i7\370\022\007\274\312\341>op\326\331\277W\n\215"
+	.ascii	">\223(\r\344\2236\013\302\2111OcXD\236\034\276\211\240#\337\034"
+	.ascii	"\366\315,\224\261\031\027h\bh\022\274't]\211\362}@\033\021\257"
+	.ascii	"\254+\264\"\366t\t\347pM\366<:\244\314s\343\004\235\216R*S\246"
+	.ascii	"\357\214\007\222+\221\225)\334\264&\347G\257\301\233\332\260"
+	.ascii	"\217\216y0\021<\035\363\225\3625\3567\255*\242\323\347\366\020"
+	.ascii	"\367\261\025\364\301=\355:\354\206\205\256g\316Gn\207!S)p\220"
+	.ascii	"]o\212ew\327Y\274Y\224\006\303\247\273\0219\234\037}\370@\301"
+	.ascii	"\001)\212\321\257\212\004\240`\370\r\002\336\217\337\204\200"
+	.ascii	"\255\201\237\257\2557Yx/\367\271Z\313\006at\260\356\2522\210"
+	.ascii	"h@\340g\255t]\254\346\001\213>\360\177\b\262\273\t\033\225O)"
+	.ascii	"$\340z\036\270uZ\365W\2142C \271V\253\210\366\313/\244\321\302"
+	.ascii	"t\314\024K\245\203\265\221\004\241\271HN\345\202\213\020\022"
+	.ascii	"\370\340\332s\313=F\247}\264\227\212\255*\3516\354\204M\271\231"
+	.ascii	"\264\217\240\320F\352e\301\232\027T\206\"=\317\313\031\355\205"
+	.ascii	"\264^Yh\n\225\306\347<V\364\367\031\0323R\274\3154\250Y\260\216"
+	.ascii	"\023\326\020\240VX\t\276\022\302\372\031\330\366\007\223\303"
+	.ascii	"J\020\317\273\202\310\215}\277\204\177\263!\224\365\305\313\252"
+	.ascii	"\322\332\241\305\205T\350+\350\241K\223\266\320\017\351\343\256"
+	.ascii	"!\243u\347\003$\350\317\340\247\345\376\203\016s\370\333\021"
+	.ascii	"r\202#j,I\3247\002\254\217\356\312\220\354\027US\252\037E8\025"
+	.ascii	"\331\036v\020A#\212P%z!\330\342)\331\317\2747 4\342\263BGb"
+	.string	"\264H\201\313x"
+	.string	"\330Q&\f\310\314x\036dQxL'\330\321Go>\351\0361\251\366C;\017\320\324\215\"`? b\345yj9d\231\346\226:[\036K\203\300\034{t\354\365\271\273\2503\203\021\353\206\221#\002~\335i\364\223\005\347\306`!\033\321l\2225\027\360^\r\f\370\017\235O\210cB\204\375\007#\354\314=\334 \264.\260*A&\221)\024\205\r\020\203\204"
+	.string	"$\252\214 Og+\2509\210\026\025\330=F\255\353=\324\237\f-m=\021\363\027(\207i\376E[\242\177\200\367S\300\037\254u\333\365\256\262\342\024S\227\365\217%\346Y)\025w\345\364{]ZD\342\035\327\224\362\001\306\276\020\\\340\305Mw\303\021`_)\n\271\035\254"
+	.string	"\037\013x\274(\236+"
+	.ascii	"\230\243\265@\317\217\007\374\366\376\001,f?\fT\370\376\0053"
+	.ascii	"\227\036`4A\367m\314\030\ti$\\q\310\255G\376\354\020\372#\314"
+	.ascii	"\215\212\351\353\327\325\322\317\374Lf\322P\243\340\247\rV\007"
+	.ascii	"\347\200a=%\005+V\3473-By%0\314\327=\265\335H*/\223Z[\240\200"
+	.ascii	"h\241j\022\302Iy\224Q\333\210J\321\316\332{\301K\022P\236\204"
+	.ascii	"\213\b\325#Q\347\351\025\350\360\267\244\246$\272\276\270\255"
+	.ascii	"\254L2m\203\031\215\317\271m\3503\210\212Gzq\025\225\212\257"
+	.ascii	"\245\r_\"LV\273\242\250\217\370\024\264SY\251\020\310\277\334"
+	.ascii	"}9t\230\2755\316\0336\241@\024ar\343\250}\234\301\205\005\366"
+	.ascii	"]\246\344:\301\244\355\350\234\002\2361\374!Q\364S\231\360\335"
+	.ascii	"\373\001\223`/\230\025\030\305\262B\310\350\365,@J\232\211\347"
+	.ascii	"\005\340X\347\330\215hoXX\332\360\307\214Z5\226\b\245{\230R\330"
+	.ascii	"HM\302\207\235\245\324~j \336st\023iV\365\373\325\335OHK\221"
+	.ascii	"f\353^\\C5\330'\017\023q\300\203\314\337\345\346\247\334W\315"
+	.ascii	"\311\216 lU\213\3623\006t\005\274\356\261\225\216\207Y\036\252"
+	.ascii	"P\253\005\233B\266\231\026{$ oF\032n\027bm\265r\363\321tu\272"
+	.ascii	"\273jQ\304\364pf\375Z\233\231H>\024\370\225\371e\302\261\271"
+	.ascii	"\203\025\346\266\251\032\342\316\243\370'\211\376%TC\263\rq}"
+	.ascii	"\026\313\231\362\323Xm\315\337R\244o\320\233\376J\025\246\r\367"
+	.ascii	"\365P\275t\210\024\361f>\250\305\211\276~o\332J\003h\006\245"
+	.ascii	"Ef\306\277\350\357\353\360M\227\233\341\245\005z$\223\311\227"
+	.ascii	"u\203tj\302{6\031\366Y(\221\\\326B\3370\001\214\372\231\n\025"
+	.ascii	"7\256\325\21590:\212\372\271\3467,\032\025\300c\266\251\201\200"
+	.ascii	"\323\276LQ5\364\347S\021\260a!C\030\244vr<\217\372\352\202D\357"
+	.ascii	"\235L\310!\245|I\337\037&\b,\031\353\2363\3035gqKL\364\\'\020"
+	.ascii	"N\214\347\247\303\023\255Z\263\257`\230\204\003\251\221i}\212"
+	.ascii	"c\242\f\2138(3\"*!\307Q\037\241\243\251\363\017\374$}\374\205"
+	.ascii	"e\236\245\277\341\2546\226\233+\347\026\213\nr\252r\365I?{\016"
+	.ascii	".\256t\307E\273#^3\321\374\356\nM\267\251g3\361\211d\252\177"
+	.ascii	"\204\026\245y\322\310M\316L\270n\334q<\002\253\307\244\225;l"
+	.ascii	"\256\3105eD\377\307\034\273#t\235\020\271\020\017O\243Y\307\027"
+	.ascii	"\300\035\236t\341m\301\002\034\203\271\227\007\355\350D\013%"
+	.ascii	"\361odL\f"
+	.text
+	.section	.gnu.lto_.pureconst.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"U\n"
+	.string	"V\234Q:\300\226I\322\001\024<\n\354}@\002+@\333\236U'\313s\251 @+o\200\366\350\273\363?\220\220\250\021\364\313Xt\001\251\331\225\320\312\037iP?\007\235\306\370\0328hH\033D"
+	.string	"F"
+	.string	"?"
+	.string	"\001\276"
+	.ascii	"\334\244"
+	.string	"\213t\217NF\267\350\022\335\241+t\203>\240\373\363\371\334\236\217\347\266s\323\371rf8[\247\357\346\332\334\232\031\315\235\371\222\2711\027\346\276\\\227kZ\365\252\226-\226-n\225\230*\225\270\n'>\023_\211K\342\033qE|!.\210\373\341\363p;|\034\356\206O\303\315\360a\270\027>\013\267\302\245\360M\270\022n\204/\b\367\301up\033\334\030|\013\256\202/\201\351Bp\017\\\003\267\300%p\007\\\0017?f\364q\331cF\0363\356\370\250c\306\034\037q|d7\366\306\033\2276.k\\\322\230q\306\245\214\313\0307\302\370\370bF\027\227->\262\270\\1\243\212\031\255\313\024\227\251K\324E\361\005\243x\345\322\312\027\253\314H\345\306)\037\245|\214r\te\306\325\307'\227Nnlr\311d\306%\227J.\223\\^\227\355\022\311\345\221K#\227E.\211\\\016\271\024r\031\344#\220\313"
+	.text
+	.section	.gnu.lto_.ipa_modref.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\226\013\035,"
+	.string	"\306\367\271D\200\236M:1\202q#u\270\362\f\245\264\357\233\024t\026\273\241x\332\272\211\320\230\t\030\264\301Whb\204\320c\372\031\0046\272\271\2326\013\361\002\037\005h\211v\224\242\324\252t\242\245\370\030\242n\215\310\224\002\230"
+	.string	"\247"
+	.string	"\257"
+	.string	":38\027P\312\326p\253x\266\026\231)\b\005mh\266\323\n\263\255\302\233p\024\212\013\3060\373RzK\351\333\350\211r\326\004.I6\252&\025\305\030\264\210\340\300\003&\322\233Hu\272\3379\324\272Rq\276\\N4`\241"
+	.ascii	"\001\223/qZrZz(\367\001_\243\027\020@\313~\333e\333\204\0070"
+	.ascii	"z\216Smj\337\366\242\375\353\224\336S6\364\266\241j\222t\030"
+	.ascii	"_\215\315\366m\336\246\222\370\262t\020JI\322\323\367m\365\177"
+	.ascii	"z\333\343\216\253$\372;k\260\205\232\002/>\266\273+c\207\372"
+	.ascii	"V\265E\237N\016\347\023]\264pb1IO\235\243\367\331|8\237\270b"
+	.ascii	"43\263\033\263ZS\341&9zk\n\024B;2)I\352J=a\242\204\320\222\370"
+	.ascii	"\210(}Y:\216\016U\025\021\302\006A\265i&\026\2325`\213\363\301"
+	.ascii	"\366=t\2607h\357\267]\032N\250m\326\332Nz\006\333hhz\f\027\216"
+	.ascii	",h\331\347\222\031\264Uc\202\253c\202\033\004\216\376\215\036"
+	.ascii	"\347S\243\021\216\220\310\2273\273\253\024&\350%\330\216`/\351"
+	.ascii	"\275\244z\b\017\034\270\301\020o==\243\264,K\365\335\350\035"
+	.ascii	"\274\335U{\320\2333\321%\243\031\027p\032\241\261{5<\3334\336"
+	.ascii	"\257$\311\201\342o7\206\304F\363\314\016Y,\265\025\023;\"H\370"
+	.ascii	"\"\326\023\321\013\031\332\037\b~\273\273\345\016\013\006\246"
+	.ascii	"\345 Tk\365\013\006\322\003\231\241\264Vk\233\245c\247`\373\354"
+	.ascii	"\326v\3773@\352O\375Q\177)\250\242}h\224(\307\362\225\320\255"
+	.ascii	"\276=\214\246\037}\037=\237=\252<\364P\371y\360\354\300\341\264"
+	.ascii	"\273%nK\373\277M\275\375t\272\003U\364\357\334\220\272\251\255"
+	.ascii	"\332\251a\225\241=5bzj\256\246\223\222p>1J\324:\306\371lP1\234"
+	.ascii	"\026j\rFFbz:\272\371\251\202\350\247\032\242uRHGHLOG\243\221"
+	.ascii	"\232\220F\353\232tLO\025n~\332\303\210\277\335\035P,\372\251"
+	.ascii	"x4\333\320Li\253\f\346_\324\013\004+d\357w\326\373\355L\322\237"
+	.ascii	"\351\315\034\345\346\342?\313\324\326\325\273\013\227\233\361"
+	.ascii	"\311\310T}\336\322#\357\004\367\2665\334\235\222\337\356\311"
+	.ascii	"\264|L\305\262\204\031\013\317W|\203\331\372/\016\273V<eJ\025"
+	.ascii	"S\361\005//\275\227\215\373\273\212vm\303\263#<\262\252\276\346"
+	.ascii	"r\215\263\n\203\0174Xj\033\334/\245\325\342\371\312\224\321'"
+	.ascii	"\036\352\235\f\207o2b87-\201M\250\0215e\250H$I\2224\007\301\004"
+	.ascii	"\3041(\235T\017\022 \205)\207b\351J4)H)\303\336\001\001\300\226"
+	.ascii	"\302\034\235d\236m\353vv\034\276\216\321\233>\351\333\270@,3"
+	.ascii	"X\376\323n\221\311n\207\226Wb\340\223\230\217\272=(\r\261\206"
+	.ascii	"\276\373\341\016\323\024\016\227\224\032\337\224\360\247\304"
+	.ascii	"\204\351\200\020\024\007\314]0\363\202\313\203a\276\002\245+"
+	.ascii	"\216\267\274\f\316\335;a\341\337\037\"\260\305\344rc\027Mn\322"
+	.ascii	"\201\005\315\203X\360-\335\3016\037\251)\202\242\350\347@(\332"
+	.ascii	"6\340\224\037\351\204\331\273Q\304\332\343+\004\277\252\320\364"
+	.ascii	"\340\020\360\020b\347\001\307\353\362+\347*1;\355\213\350\021"
+	.ascii	"\027\261\301\302y\b\206\331\004l_(\257\231D?\224_\254\r\205\354"
+	.ascii	"\372\377{\267rc\305\247\306\220\360\n\300^\003\246M\232\022\265"
+	.ascii	"N\317v}\375\032oB`\277\334\274\367#A\f\357H\264\225\016\033]"
+	.ascii	"\357\214\221\356\327G;\222\030\366\323\234\"\004\340g\007\031"
+	.ascii	"a\205O\r\251\303\353\336d|3m6`\335{\351$\006\330FR\030\013\271"
+	.ascii	"\035W\214\266\230@.@\025\245\213\337.\273\262b\"\254\267\351"
+	.ascii	"\227Y\022\304#\343.\347\323{ZJ\347\264\330\316\255\0034\277]"
+	.ascii	"\201\326\007\205\202\332\346|\035\001T\353k?\201\222V\2220\n"
+	.ascii	"\321,\332\t\030\252b\003D\217\316 #\016\276\373\223\026\227\331"
+	.ascii	"\273\310T\352d\\w;\353\0255\350\254\240\033"
+	.string	"Cd7\202\202*\373\334HBIAG)\344'\251\301\324\220x\373\037V\006\332Y\023\"U5\256\\\277\006\352\371\210\262\b\314\306H\020\207\004\261h\371\321r, \306/xw\263\254e\005\245\347\346\035D\006U(\021\034\255\245\027DZ\t\b\032~\025\243\\%\263\213NjfK\3501\317\tS\216H\326\301\031\0268(\216;\r\373/&V\304\371\351\250h\307n\374\\L\244\364\305\277\017`K\t\265\024\255\246\f7F\233Hv\352i!\023\033\027\")vu\265TC\370\270\251\340\326z\327%\326Z\326Oj9|\037\275\366\322\326h\301\026\006\223:\345\347\316\202\204\274\243\272I\203'\373G\375\303\325\361Y-h\277\275\230\362\021\204\360\242\004o\020\222M\250%J\\\341\021\211F\330\232\rUk\007\310\340\215#&\201\023Y@>\251\017{\332\3655d\347h\375\341_\361\031\003\002\361\300\374\265\305\275"
+	.ascii	"g'\2250\200^\345h\250\314\303\036"
+	.text
+	.section	.gnu.lto_.lto.b0ce503e3041f83e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_settingGetValueOffset.106.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\325\002-\024"
+	.string	"fe\203I\300\224Q:\312\021\232A\354\232\334.%\320\r\371r\200\3214\376\231L\300\206?B\336#\321\315\244\323\034Y\333\333\027#S~\364\341;\025\250D\025\2024\375E\377bc\356\016\030\333\222\262\336\234\2136\360H\322\366&R\312\024o"
+	.string	"d"
+	.string	"q"
+	.string	"B\0274l[\220\021-\273\277\006\351\f\231\352pT\302\276\321\310\200\324\255Cp\021Ty\035\370\377\032Ce\310>[\335\211\017*\234\006\334\256\251['\206\2322U\256\n\230*\331\204\316t\312\217wv\245\351|"
+	.string	"\343H\272$\371t\247\337\323\013\"9\235\020\3127\333L\371IBa\242\203\201\027\365\322\335\337\234\016\b=J\377\267\376;\3709\025}Sp%\222`\003\246Py\305\231*\225u\247\006H\354\234\202j\333\373u\264\345\022\277r\257\327s:\373\374r\037~\277\372^\245B\252(\337\237\350\220jJu\252&\337\203s\217\232\3739\367r\356\277\271\347\271_\271\327"
+	.string	"*\027@\\xt{\350=\365\222\334\241\342\277\354O\375C=\026|\373'h\221i\222%\217\310)\250v\244k$\342\373xY\305|$\207\307\226\323\331d\376XsX\330\266w\024f\236CpKj-\345MX\226\274\032Z\244\252\235%\332*\321\237\244\037%F\272\352\b;"
+	.string	"uO\216\253\021(9"
+	.string	"u\367\212\342\370\317\004v\323\224\347?\3237\327\270\035\240\356\351\025\225\341\201\236\333.\271\212\022\230\312!\177q;\266\323\250\215\027\330\001c\214\005\013-\2141.\006\343LK\346\005k\020\323\252Y\215\024fX\025\344#\260\334@p\265b\261\361F\034aX2\2601\346j\211\256\026\213F\204\201\335\210,\005\376\252\031ab\354\365\202\211)]\353\327\354sma\204G\256\330\006\311w\002\240\251\310\017V1\310\033\376\203\374\227\032\333\276\356\356\351c\305\222WtC\327h\205D\261\344\223\001:\233\223Q)\236\214\022\242\0246 \320\242\031+\036\b\211#\023M{\247)\262\214\275\013\260`\341NZ\246HV\361\322e#\325\355\252J\276\b\024\222\245\223\2110\260\257|}\257\301\347\360\225\265\006`Z\232\270Q\362\352\310\361\017\302\312\320\033&\242\255\225\236\2323\254\367"
+	.ascii	"2Q\300\2427\221\177(\345\036\fFpa=W0|w\005\261\301\tu\200\036"
+	.ascii	"_\367+H\006s]\032Yt\331z\002"
+	.text
+	.section	.gnu.lto_mixerNames.200.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`<\003\315\025"
+	.string	"\206\345\214L\240\230Q:\212\324;H\347\216X\316\211Q(\266/\027WS\300;\274\016\357\360\016a\301\017;<35\007\351a\327\261\205\266e;9\355\206\261v4\033\005\306\202\267\020\336t\334\214\314\245\274\227\343\"\357\3533\342\026\333*\007!i\007t"
+	.string	"v"
+	.string	"y"
+	.string	"M#\344Gt\363M\340w\315\024\360\006o>\023~\0038\026K\252\343G\340w"
+	.string	"\037\022\256\360\346/\341\267"
+	.string	"\036\303\253\001\277\007\344\230Pt\263\021~\023\2601,\253\232,\334\f\001\277c3z\370] F\361\302\315*~\033p\201!\303\315\r\360\373\300\n\343\345\301o\004OF\230\323\021\253\304\026\022R\276\210\367\206\233I\374N\360\3309\270\336\3666\326\226\261Y\276\365-\357B\"\221I\244\007RiF\202\330\271\225G\244\245$\006\226\314\271\240\233I&\374\201\004~\223d\0072\004~\227\\\206J\251&R\t\277_\264l\301\357~\314\205E\013\277]\217\271\252\354J\251#\357\346g\341\367\013\353\nK\031\272\276\233o\205\3370O\246\360\033\306\244x\243\360;&\211\361B\341\267\314\021cI\325\364'\374\236)\342\340\301\315?\201\0375\026\325\255\267\334\272\343\321`\026x#\244"
+	.ascii	"\224\005\201D\021\210\301##\241\314HHT$\003\022\213\262\033\033"
+	.ascii	";\254\020$\312\216\206C\242,\306\316vtrz5\223\027\004\263w:\212"
+	.ascii	"\247\270\212\263x\213\2778\214\3138\324i\274\306o\034\307u|\307"
+	.ascii	"\243\336\343?.u \017r\252W}\310\211\334\352F\216\344WW\362%o"
+	.ascii	"r'\207\362(\237\302\363\254S\271\225_\271\326\003\026\325\255"
+	.ascii	"/V\355\325L^\220\313\242>\245MM\237\033j{\331\036_i\333\332p"
+	.ascii	"\350\320\317\206C}\351\217\214\235\371J\333S\320{Y\265\267\232"
+	.ascii	"\351On\245\345`0\366\246\322h?\034\235\034\032k;k?\234\005?4"
+	.ascii	"=\201d\204^\026\250\247w\002\271lNHw\356~\271\365wS\325\231\324"
+	.ascii	"\344\325b\254\356\\\325\034\355Lm8t7cg)j\256\346\313\276\354"
+	.ascii	"\2113SU\207\232\001? \320\242\271\242\007\3654\233\201Y\006_"
+	.ascii	"\030\246\215`\n\201\\U\353h\234\331\215\fD\363\03227\325\203"
+	.ascii	"\333\216\366\200o\345ez\326\327]\315\356\306\361\003\326\374"
+	.ascii	"\3424\274Y>\023\317\036\276\302 \237\263{\345\350n\036#\031\335"
+	.ascii	"\346\361`\364\204\262\276\272\313\031'G\306 \247\347\261|^Yw"
+	.ascii	"\330\245\233\307T\371\324\344q\333Z\306\"<=k\231\317\030\376"
+	.ascii	"\344\006\211s\233D6;\357W\230\304i\257\305["
+	.text
+	.section	.gnu.lto_featureNames.201.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\373\003}\030"
+	.string	"\366\354\242E\220.\247\003\242\377\3779H\325\277\377\377\177\271gu\004\302\001"
+	.string	"\220\376\177\324Z\357\227\206\336\352%\210%P\215\303n\222\356\275\257O\260\221\375\336\3143\3500\3223h&\361\232\2617\370\341\263\231 \024\322d\222\001\224"
+	.string	"\225"
+	.string	"\222"
+	.ascii	"oH\b\267\277\021\374\026\211\r\217\272\375\207\340\267ITS\367"
+	.ascii	"\201\340\267Jif,\253\035\264\333\277\007~"
+	.string	"\273d&\300\230\t\024n\177\032\370-\323\356\274R\267?\n\374V\200\227)\226\325N\004~;`\013\001,5\333\355 \360\333\002U,\334n\327\200\337\032\2202\205\341v\013\370m\323\023\334\206\333'\340\267\007\230p\360p\273\210\337\"H\362\341\206\270\275\001~\233\300\310\bW\021;6\202\\\351t\375]\274%q{\305o\025<\323\227\020zK_S\312\372\021\017\347\343\374\234\247\363v\376\316\347y=\317\347\373\374\237\007\364\201^P\3251\250'*\212\252\242\366\312\242\266\250/*\214*\243\316\2505\252\215\212cA\325\361\224[It,N8\2405G]\202o\324n\2554<\360\366*\004\277e\325\030\325\007~\333r\201cQ\355x\340\267vE\f\374V\250\246\250&\360\333\241jbv\257\360\240\032\253j\007\321\025\035\374\326\345\207\n\277}\355)\302#\323\267?\032\374\326\250\316\003V\325N\274\375\261\340\267"
+	.ascii	"\344<\024\374\366(\177J\330CT\227\334\214\221\374\322M\362\021"
+	.ascii	"\344\247\307\301\027\245\231:B\336\262S\233c6\242\0334C\035;"
+	.ascii	"=-\346\221\366\035\321\232\323\355B\rf\253IU\310\331:d\270\301"
+	.ascii	"2\334\2440\300j9\0160\247&\212\323`\313\301:\340p9\330\213\232"
+	.ascii	"\233,\313(~f~\322\274,\003C%\372D\276\310\037y"
+	.string	"$\257\344\227|\223w\362P>\312Oy*o\345\257|\226\327\362\\\276\313\177y0\037\346\305<\231/\363g\036\315\253\3715_\365V\337\346\335\004T,\3130{\247\347\345\323\204\222\35106\352$\027-I\223\237\2334I\361E\315P\233'\031a\203\374E\303\2547\370\242\274\224\265t\f\224\215y\027Q\3326A\021\fA\323E\277'\026\025g\345\031\202a\230w.O\t\033\211\226\\\364\276|j\3167\021-\3656\371\371\201\241\213\322rXr\375]\372q\262Ee\243\376v\236m2v\206\3408f(o\211n\360\033\311\222\217y\233E\024\374Hq\353|iE\250!4\214\021\313\210eVQ\n\303\001\020#\231!\333\020\030c<\013\3224\006\375)\337p\200q\034u\336\035\276\253\337\321b\251\372\001\224\331\022\030`\031\016\216\023\266\316\214\322\325\337W\205\375!\033\227<\377!\353\215[\2103\273\347&"
+	.ascii	"\364\027\260Z\377\242\016~\260!/\215\0368\332\007\210\036I\005"
+	.ascii	"\232-\b\376r\243\035\354\036\215\320\363.V\027mSZ\201\300h\247"
+	.ascii	"\274W\250\300:q\215{O"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.203.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 [%\002"
+	.string	"\024\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300\276\020{3\301\0014\277\001"
+	.string	"\007"
+	.ascii	"3\205\200q\2400;\307\202s)\255c\240\b"
+	.text
+	.section	.gnu.lto_sensorTypeNames.204.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\245\007"
+	.string	"\364\f\331"
+	.string	""
+	.string	""
+	.string	"Z"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\340\276\n{\275\006\005\001'3\206\by\bw\300\005\005\001'8\206\bus\303\004\005\001'E\306\003\005\001'J\206\bqo\311\002\005\001'P\314'U\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/interface/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\017"
+	.string	"\255\020\202\370\024#\260\030\340\017\344\006H\004\231\250\212k\2201 \234g\036 \363\202\312\221b\337"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.205.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 \241-\004"
+	.string	"\024\007l"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\203\375\363\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/interface/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_backupPgConfig.206.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\315\t"
+	.string	"\026SD<@\305\270p\355\245{.\364\3465QW\3353\265\233)\220\317p\256\203\301\247U\201\3443\320\336Z\032\366\345\362\206\264iB\007\247\350\223Zw\254\365\201o\341\003\307\244\364\264\211\224)\0051"
+	.string	"1"
+	.string	"6"
+	.string	"\231\307+h\317\266'h\317\034\332\007>\206lE\345*\001@\260\273\234\252\036>C\377'\267\230N\243gebw\235\246\023\352\326\333n\260\375`\037\"\273\273\326\224}\361\327\2604\206\245U\323\231\351o\b\250\002\022\257\335\216W\202me\003F.\266\237\366Kn\022^\024\375`7e@\300\356\210\261\303\366\227\017\016\035\331\266x"
+	.string	"L\rVb\347\254O\225auM\305\224\\\306x\nh\333\335\210\360Q\300\214M\344\231/\322\236]-\004X$\")_\3668J\005\261\217\005\234O\272\313x\027\035\267\3514\025\340&\344\3618\217\247\351p\035\b\3422\013\376>\033\220\013}\037\310]\306=\266\2322\205G\213\244\032.\310TULm\216\22779\016"
+	.ascii	"2\241\023/\360p\301#*i0\220\247\234\\\325\f\246\262\316Lh\005"
+	.ascii	"\006\\BhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_restorePgConfig.207.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\335\t"
+	.string	"\026\323D<0\307\270p\005\217?F\337^\373\222w\352\200\265y\nT\245\264\006{\256\030a\244e\235\370oO\200}\262\261\306\244i\242\207\006Wq\241&\254\303@&\023X`\r\272\277{K\231R2"
+	.string	"2"
+	.string	"6"
+	.string	"\231\307/h\317\266+h\317\034\332\007>\232\354e\345q\n\200`w9-y\370\f\375\257\034\203J\225\236\227\211\335u\242R \267\336\266\203m\b\373\021\001\273\273V\225}\361\327\2604\206\245U\323\231\351o\t!\005(\f\354~\274\024l+\033\200\222\261\375\264\237r\225\360\"\351\b\273*\227\200\335Q\343\207\355\001\231\221\016-\331\2768\013\323\203\225\3709\200O\265\301uM\325\234\0268\343-\242m\227C\302g\0015\266\223g>I{v\305\020`%\020M\371\262\307R*\211},\236P\272\333x\030\035\327\3518\026`g\004\3628\220\307\371p\035(\3426\f\376B\035\220\033}\037\310e\306=\266\252r\205H\313\244\0336\310TULm\217\227G9\016"
+	.ascii	"2\241\023/\360p\301#*i0\220\247\234\\\325\f\246\262\316Lh\005"
+	.ascii	"\006\\BhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_backupConfigs.208.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`)\001\335\r"
+	.string	"\306\331]D"
+	.string	"\221(\035{6\365\344w\335\n\2154\002k\225#\024P\275\256\320\221_(T\307\277F\243F\024\f\"\264\372\255\356\203\361A\241\022\371@_[\377\377\273J`\215\017\021\342\027@\b\025\326\353'{o\271S\nI"
+	.string	"I"
+	.string	"I"
+	.string	"\253)\007\313\224\222\027\026)%/\255\303y\303\027z\204\372B\276\312_J\206\324bu\242G\230\225P\036\002t%\310\001s\305\214t\244\007A\244\256\237\1772'VZ\254.\365\2271\330]\277S\207\341\226\267=\262\255\300>\0270\227\325\304\226_\335\317N\262\257\030\r`vQ1\032\253\"\306|\370\352\366E\370\323\233\2178\211\320W\025\276\246\013"
+	.string	"P.6\270vg\202G#\320<z~\200|\324\\\200|\374\306!\033\306\347\311f\0354Xhy\355\006\327\221\022 \315\256\211\345-\022\340Q\036\r\002\222?=\372 \325\032+3\"\017v\270\273\013Ue\373\200J\2253.)L!H/f\370\256\366\004\n\357'\177^\263\"\303\234\341\022Q\221\252\t\024\245NUeO\321\3438\t\017>\2369\033[\004\216\326\341t8\370tB<6\315c\353\360h\234\017\210\266A\300\334G\347\243\205p\334G\333\314\275\2328\222\354\f\327HI\3767\351\273\234\265\371(\206\340y\036\225\027`\201y\311\030\275XT\225\027\274P\251\031\354\231\003\031h\021\032"
+	.ascii	"2\201\007<\"\206\355\200\021W\004\224cj\321\334\341\373)\244"
+	.ascii	"\bV4q\272F\262\311\304\203\031\t\356\266\364\031e\207nIe%\372"
+	.ascii	"\345\212 3.\273\301<\243\253\006\367\f/(\312\257k>\001"
+	.text
+	.section	.gnu.lto_restoreConfigs.209.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`)\001\335\r"
+	.string	"\306\331]D"
+	.string	"\221(\035{\254\362\024Z\267\3056H\373\316\361\341G\263\211jfe\323\035k\342\177\315|\216@V\303\027\377\353>\030\037\024*\221\017\364\265\365\377\337U\353\257\322D\305^K\256\371\345E\335\310\336[\356\224\002I"
+	.string	"I"
+	.string	"I"
+	.string	"\253)\006\317\024\023\227\026)&.\257G\357\216\020t\031\025\202|\225\303\224k\345\325\352B\2271#\2356"
+	.string	"\350H\261\003\366\275\220t#\030;\244\256\367\016O\240\030\275Z]\3520[\260\273\206\246\316\302=o[d;\201}.\260\317zb\317\263\356g/A\301\310`\240b\367\024\243\261+\344\013\207\263n\037\204\357Y\363\020\027\001:\213\302\267\204\3328\275X}\273\036\202K\037\310\\\332\273\200y\231y\200yy\215Av\214{(\233e\320P\241\005f7W\222\021\237\314n\211\345-\021\342W\227\016\371\314\233.\375\217j\215\025\327\b\204=\356\356FU\3316\240S\247\253\365*y\030\301\230#\274\332\022&\300\233|\357\031\026\027L\304|#\032R%\221\202\324\251\252l/\004;P\002\016@\2407\034\033\204\215\306\331x4\360pD>6\355c\363\350h\033O\210\3061\300\034\b\307\243\211p\234G\323x{=\261,A\305|\"\035\331\337\246_\342\255\315_\371A\007vTN\200\305\365a\206\b\306\244\252\254"
+	.string	"\206N\315`\320\334\247\200\213\032"
+	.ascii	"2\201\007<\"\206\355\200\021W\004\224cj\321\334\341\373)\244"
+	.ascii	"\bV4q\272F\262\311\304\203\031\t\356\266\364\031e\207nIe%\372"
+	.ascii	"\345\212 3.\273\301<\243\253\006\367\f/(\312\257k>\001"
+	.text
+	.section	.gnu.lto_backupAndResetConfigs.210.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 \345\025\006"
+	.string	"\262\212(0pE\352\032\240\214\347C\207\351\374\353\362^\355UA\351\357\260\020\"\245\3210\346e\333\004\255>\266E5\024@@\374\366W\253\214\352\t\221\310-S\247\223\025\241\263\242\024\244V\331e\315\313\242$\223V\312\234\024\307&U\235\031\206\325)\205\275\374=\274\021\303\\\005\241\300\362\267\\\344v\227\"\302\310\361\366\207\233d\317\277P\363\367C\t\016\201\243\240{\263\220\320\243A\024\370\277\322\265\337`C\200\216\002\300\314\300AwO\376\254\266R\373.\270\207\316\333VF\215\356\276\354\274\316\236\367\377\342?\343\277&\013"
+	.ascii	"3\003\366:\303\fW\240]\232\202\327\274\3145\234,\204\3612\004"
+	.ascii	"\270t\213v>\001"
+	.text
+	.section	.gnu.lto_cliPrint.211.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\251\002\335\024"
+	.string	"V&\210J\300\360*\035\372\020?\224\3648\317E\033\267u\363\307\355\360\247\234\243C\022UU\213\n\\_\001\247'0\213\200c?\262\375\230\347\205\376_\350?)\212\3026\266\341\327Tq~\324\034\004'\031\212\356\005\364\222\222F\310\336R\312\024w"
+	.string	"i"
+	.string	"x"
+	.ascii	"\177\322\006m\352x\343s\353\231Qkuu\315K\246-\252$G\221\316f"
+	.ascii	"\332\227\203\2068\235\312\242\346h"
+	.string	"s\371\355\212\t13D\2504\264:\3139\035\013\227\342\216\267\344H@\244\331UX:9z34T\272\226\331\201\342\350V\352l<g\313\345\207S\351n\323C\251\004S\251\253q\257\316&@\372Y\242\331\361\226\307\003\265\3263N\267\333\247\366\377\357\377\307\317;\001K\277'\022\227n7\b\0274`Vx\330\"\212l\272n\337\037T\341\020\033a\322\273\367\267X\253\005\356\252R\223_R>j\362I\346\237\232?N>e\376l~/p\317\314_\001\254\024*\024\030\325\3522\254Q\217\350PN\371\177\371\337\016\353\201\266\300\224]\325\332\363\021\2525\370q\217\323\322\007\267%.=-K\\zZ\033cl\332\263\352\335\020dD!\207\351eL\361l\332\177\214\001/\356\035\266V\371\267gC< \221\311\304\245\264I\230\356\331\f\204\352n\332\342vc\205\207\254^!\240\246\027\031\031&D\003\233\352VC"
+	.string	"*j\321\300\302\303\265\020a\346\206\266\357"
+	.string	"\326DD5\007\006\026<H5\026r\206\032\t6f\373^`\267Kx`\324X\370\357\207\335\371\211/\316ON\304\213\0133\224\223\376\013$\326\340\345\202\275DFf0\224\222\230\253$&B\342z\315N\\ \003.s"
+	.string	"\233\271Pd\262\231\253\f\326\355\336\002\243\243\225fy"
+	.ascii	".\373\177\301j$\312&j\342\240\204bU\177\222\334\251\316!\370"
+	.ascii	"\03119\341|S\304\245\250\016\371y\221\213\331\235\265\326Z\266"
+	.ascii	"\357\273\304\373\321V\363\222\fp\\u_\340%\211\254\346\316\375"
+	.ascii	"K\236\232\034A\216}\3525 \240\002\251\261\242\007\242\300\312"
+	.ascii	"n\270\266\212\220\313\356\2521\366\025\233\322[ L\302U\206\353"
+	.ascii	"\"i\333E#N\300\312*[\177\275\023\370\312\006\336\231rv\206\222"
+	.ascii	"|\027\230\216\325\033\245\332f:\343-<g\n.\314\336\340S\003}\b"
+	.ascii	".E \341\300\007\004\227l\267\311=\016\fV\006T\304X/\254\346G"
+	.ascii	"\007\367\346\013>oy\032\361T[\236\315\331\300\"}\264\351\312"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.212.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\275\t"
+	.string	"\026\322C= \345*\035\340D\037x\004`\360'b/\2020\206:T\313M\217\254 4\026&\030\022\201@\275\2256\310\260\322\026\013!\n\305\250Gn"
+	.string	"Jtq\243\230\247\275\334\236\221%D\312\224\0021"
+	.string	"3"
+	.string	"1"
+	.string	"\336\202\034un\025\345?\366\200\221L\235\353p|9\020\215\245f\200\024\271\202\326\310\370\330U\203\\\251r\030\346\234\326\221\334\270\273\333n\260\275`\233&\276\300\320\217V\227\332L\334\224]\246t_\366\271\271.\373\352o\f:b\034`\346l\335\002\314Y\327Bb\373\037\243\354\231\227\260\311\t\251e\250"
+	.string	"\230s\006\373\262\302\277\b)2\242\332\354\227G\361\213/\342\t\313\364\343;\337\262\315\273\357\212\267\222\017\225\336\274\321\233\374\244\202"
+	.string	"6'\353\243E\207\005Jx\347\366\b\254\277\020)\342\363F\237\b\"\034\235L$\317D\022\225\274/\244\360B\007\006%F\241w\002\301\320\373\224\363\353\362\203\307L\265+\316\243v\t\334\303l\264\225\r\016"
+	.ascii	"3\003\3369\344j(\203\331\013\264\253\214u\323\340\234\341\326"
+	.ascii	"qa\344\0136\277\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_cliPrintLine.213.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\215\007"
+	.string	"\002\21755`M\323\001\300\216\005\322\216\371\310\344\373\\\354\\kj?\242\035\364\367`\243\361Y\210N|\374\373:\001\204!0\272\0027R\212:\233\302\3542\333F\232\224)\005\230\226\251\251\216\245@\305\212\362$`\225\366\261\342\307\362,D\n\313bg\300\027C\205E\355\272\260\250\001\367\321\252\347\203\2170BA\236\322\316\0326\035!H9G\231j;<\344;\347\311E(\241\234\rr\251\030\366\243\335]\253g\377\373S\332x\240 \250\354V\264\260l(\231phl?\355\203<d\373\007q\200]\217\244d\027\344\270"
+	.string	"s\311\340\005.\2270\017\270\\\362f\247\034\324\330i\203bbdew\243f|{n\376E\236\351B\334s2\330]g\027\262\270\365\266\tlsl\177\001\t"
+	.ascii	"2\241\205/0\\(m\006W0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.214.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"]\b"
+	.string	"&\220;70q\323\001 BY\324\204\262p\251\016\272\345\215\234\226z\306\340\200\2447j\036\204\314\006lq\316\274!\241.\0023R\f8a\bN\357$F\216\211N\237\266\335;\245)"
+	.string	","
+	.string	"+"
+	.string	"\237\356\354\231W\322rHB<Thv\227\312\221w\217\235\177\224\003|#\357\221\343\260\273\216\337\b\344\226\267\355\261\335`\333\024~\351\227\363\300E\006\342\264\373q\252\331p\232J:\266\037\355\233\374\244{I\343\004\273`\314\312ne\360B\365\351z\003\352\263z\001\025\034\246\242\224vE\013\025_\237b1@\332\025\375\273\250D\226\302\247\215\221\021\3779\302\260\204\035\322\263\253\027\245\210\375\315\356\256%\350N\360\004\b\314\215\013I_V&qQ\354\372Dl\030\007\312((\373L\320k\013Q\013\301\032\005\266QN\3236\332\251\373\315J\320\017/\341\206\f\n"
+	.string	"2\241\255/0\\\250 \005\220j\245"
+	.ascii	"\311\305\332f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPutp.215.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\346\321>80\345(\035\236cT-\322\344'\2628\253\262\006?@S8?\005,}\373\247\375$\002\266<+f7\bZ\027\017\n\b<\216Y\306\340\261X\007\3311J\376&R\246\024-"
+	.string	"/"
+	.string	","
+	.string	"\230\277\314\t0\177\356\354\225G\217\305>@J&/\273\013\265\343\335\263\363_\362"
+	.string	"\323i\364\304\034v\327i:i\334z\333\t\2663\333\254\031-"
+	.string	"\273z(!\266\257\261\255i34t\217\026\326\335\215\023\325\356n\274\360\264?r\222\356)\263>\260\213\022Q\355\306\215\0252\177\216/\by\223\0210t\344k\352U\257\002)\255R"
+	.string	"R\266\3548J\345\260\177\355\356ZQ\366S\377{\374U\323y\245\217\031\260\250@\270\354\006\022Z\202n-\353Lhp\3238\021\334&\362t\240\247\303\241\200\032\027\202\331\201?\240\215\203\242\317\207\203\232\270\277VQ~hY\221\364\302X\246>\265C\025\001\t"
+	.ascii	"2\241\343/0p\341\2019\226\271\006\274\n3\024Thp\227\027\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_cliPrintfva.216.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\325\n"
+	.string	"\326TKB \2518\035\b\004C\037\240\003\203\001.\301\013|\224c\312\006\301\364\005\203V\271H\bP\217t\032\b\361\316\344\205\241\374\004\243~\235\352QD\002\240\214H(P&B\021\275Hd\304\007\372\323&[\246\0246"
+	.string	"7"
+	.string	"9"
+	.string	";Z\270\"\373\364\370\b\3543;\004\366\351\320\266\3601\300Z\004<(\2510\354\256&\001<\274\206\376\027\374\"\232FW\313\306\356ZES\312-o\233\302v\206}\215'\373\251\177\036\365_R\255R\375L\242"
+	.string	"\005\217\013\273(\255\f\273\232\022\b\330>\306\266\252\257 ER\001\303\037\355\313\247/\256\366\021<AxT\311\037vO\020\"l\336\211\003\225\2235\241A\247\274\344\031t\276l\227t\361\322\006\001\351EgJrd_\365\006#\376"
+	.string	"\207\210\364\242\b\373\274\344`\035P!i\313\036G*W\354_\273\273\226\001\233\210r\335\007\224\341\200[\026\332:\340\267\301\314i\274\017N\353\270m\003v!\217\247y\274\255\243q H\323L\370\373t\240\026\372>P\303\214\373k\345\311\035\006V$ib\007Uis\002\021"
+	.string	"2\241\205h`\270Xp\017d\254+?\017\321\372\301,`.\274\3130$\230\006\256857f\240"
+	.ascii	"\025\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.217.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\310\001}\021"
+	.string	"V\241wH\340\320(\035X\t\tg|\225s\355\313`\254\177\350\265\271\033&8`>\003\371 \226\356\002\030\236\303\350\253\215\372:\001\252\335\2709\265\275\366\341s\031B"
+	.string	"\311\276\n\350P\020g P\354\f\255RD\243\023D\310\226;\245c"
+	.string	"["
+	.string	"h"
+	.string	"?\260\221\337\300\365\2600Q\371\236\027\353\356\207\024B\273c\002#\370\336\331\266\202\005/\303>\352\324t\320\264\220\t2\332\035A\025q\330\273\251\022\346{\210\261w\035>Kb\314<\260\273 \342L\3524\2111\362"
+	.string	"\"\312&"
+	.ascii	"$\231\030\257]\322\2103);Nv\327rF\344p{\267-\3016\212-\t\004"
+	.ascii	"\232c\177\256\342\330\247\375\237'\335\375\347\237\357\371\325"
+	.ascii	"\322\377\270\317\220Q\215\224\027\2735I9`\206\272\025;\267\335"
+	.ascii	"~\t\377\346\222\037t\023\257\333\\\337\f6(#\\\344vmH\336\031"
+	.ascii	"\302\367\356#\267_v\311\366\224\366\307\003\275N\3030\022\262"
+	.ascii	"\263\232\216P\203\361\002\274w\337E\274\023R|l\216r2\2159D\206"
+	.ascii	"\246\320G\303Qn\2461\177H\334\247v\205\324\211'\347!I\376\023"
+	.ascii	"\277\251\fl\330\335\317\330\253\026\371\031\377\366\217\210\007"
+	.ascii	"w\224\213\321\230%\t\034\bq\302\274\251\250Z\321L\"]ov\200\210"
+	.ascii	"Ts\\\300\353\364\265\007\240\341\210\331\200!c&\221\034\362\027"
+	.ascii	"O\265\323\216\033\231L\262\307\230\f\341\005\331\nU\254\025\312"
+	.ascii	"k\251\270B\324\311\201\213J\350j9}Xp\t#\260\250\\\024>\233JR"
+	.ascii	"*&\360d\nQ\254Sk%\005\256\244B\025hb\271\200%\003\274b9\261\300"
+	.ascii	"\326j\305\002K\343~\256\342\370\265\223\320\260\331\364(\376"
+	.ascii	"\333\037\314(\262\251\230?\314\273\322\250O`T\366\3165wC0\310"
+	.ascii	"\321d\222E\244\035  `\2021\264\252\003\\\206\226\305p3\006S\263"
+	.ascii	"\356\215\256\\\304\374\220\026\025\n&d\016\231\241!y\271\"\221"
+	.ascii	"la\270\246U\220\333q\020\307D\340\311\330j\310P\310Fdy\276\257"
+	.ascii	"\312\205\332\310,\314\035\315\372\267\203\332\273\247\256\327"
+	.ascii	"\206="
+	.text
+	.section	.gnu.lto_cliWrite.218.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"%\b"
+	.string	"V\220:6@\217\322\001[\215]G\004\272\032\260\317lCz j\216:\361\t/\372\342\377\3601\253\r\035\324\301\035Y\321D:\036\343\007`\021\271\177\302"
+	.string	"\306\376/\371R\246\024)"
+	.string	"+"
+	.string	"+"
+	.string	"\234_\346\354\226G\217\335|\260N%\254\335}\332q\356\311\371\027y\247C\225\236\033\205\335uv\250\214[o\233\300\266\201m\224kM\331W\375\252\351\314\3645\001.,\f&\273\030-\230]])!\266\357\261\235i#$pWUXw7FNv\343\201\013\002\266\204(\337y\340BK\366I\036)|\020O\220\362\335/\237\244\371\225\332\321P\275\002\254\250\234bL\331\262c)\225\303~fw\003\0160\r?\331\003|\030\0045l\330(\224\275P\006\202xp\023\275\217\200\265\bl{#M\333\236'\3563\253\251\205\227\225I-\314\311kj\b"
+	.ascii	"3\241\253\037\270X\346 \230v\205\313\200*5\016\334\271E;\237"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.219.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\345\001M\022"
+	.string	"\306\342}J\300\224Q:\364L\0011r*\355yt\220\265\036\271n+7 l\213)\332a\005!h\334f\252\251\311\216v\374\365\351\206\366\007\373\305\274o\003HD2}\027\036\265Y$\246D\235\026#J\317\342)quj\215\220\275eJ\001i"
+	.string	"`"
+	.string	"l"
+	.ascii	"D\262\225/\221CH\n\346~H\307\263V \034G\265\222.fA\375\263\355"
+	.string	"\004\013b\226\235Dq;\365$\361`\304T+\031\316\023\227\375\243se~\200q\366/\304)e\351\361\214\244F\036\252r[a;\031k;\251\212\222\t '#\017e\001\322\001\342\271o\317H\333=\301\324Z\275\266\361\303\r\3366\005\3331\3662\b;\205\354\317\262,K\317 \033\\\227\034\367\243N\364\323\017\375\323\353\237\334F\013\246!\030\226j\275\225Hv\222\276\032,\256\273}\030\376\316)\337\3501b\327\301^;\374\304\250\260\365j\375i\371\347\b\250\177_\271\035\263S\266\351\332'_\024;\216\303\nJ\255\345R\0349 \257\002\376C=\005\fM=\332\2349e-\\@j\352\241\254\017\324\264E\325\212G\232l\313/\343;\r\006|j\255\267\331\254\031\221\367\242\251\3073g\006\260\b\356\033\240\335\302\331\333\374\335\357\223cL\252\315\231-\244hG\017*\003\351\\\027\271/\257\210\022\2119\205\\"
+	.string	",\231\317]"
+	.ascii	"\256T\"\302\343Gm\217\370\300u\3009K\346I\004mK\233\234\005\342"
+	.ascii	"\206}\2115\256\226\f\370\242\201\2112\253\00794\"\fge2\223#J"
+	.ascii	"\270\251\201e@Y\365\302\242Q\205+\225(\343Z\275lX\241\rK\254"
+	.ascii	"\tU\256\234\360\205\200[7+W\370j\265\\a\212\254\247u\006y7w\227"
+	.ascii	"\021:\335\374\214\177w\bAn:\032\364\227\201\237=6\314\316\244"
+	.ascii	"\321Zk\375`\264\326\022\rz\270-=`\355\t\025\222\002\" \220\202"
+	.ascii	"\231B\333x\n\035\243\320\333b`\024\257\016>\251\341K\326\034"
+	.ascii	"\300d\262\025G\007f\233#LW\266\003\3210n\361\016E\270\f\035\327"
+	.ascii	"\036\316\366\037\217\335\003\3058A\360\347f=g_\265\205\332\310"
+	.ascii	"\020\346\212f\355\355\300\366\212\253\371("
+	.text
+	.section	.gnu.lto_cliPrintf.220.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\315\n"
+	.string	"\346\023JA\020\307j: \212Z$mQ\204\""
+	.string	"\270\005'\360#fp"
+	.string	"\250\254\243cJ"
+	.string	"(\327\245z\251e\033\375;\362PkEr\020D1"
+	.string	""
+	.string	"@\200\003\250\030t\017\n\221\225\006\025\036\332\254-\356\235R4"
+	.string	"9"
+	.string	"7"
+	.string	"\r\231k.\337\331\256e~\260]\263h#x\271Z\f\313$D@lw\271\252r\361T\364\017\273\206L\215\247\230\210\3355%S%w\275m\006\333\020\366A\001\255X\202O\301.\311l\301\311\200V`\345\257\337\376a\336\330\345\001\210\177\231\276 (\t\326\311\271\213\362\\\363C\346\332\021N\355\263\274E\274\213\343\234]\325"
+	.string	"\002\273\245\203\003\006\364\233X\311N\217:ZC\025\016\324j\203\026\035\023\265Q\317\037\3400\214\205\021\322\326\330\240'\3151Ed\347G\035\355r\2445\305\376ew\327Ue\337\365W\314\315]\006-u\243\020\024m\366>\037\205\307\205\274N\024\206J\244\217#}\335\210\363\302\013\356\223`\260\"\024r%\020\f\271M\271\277lUY3[\262\363T;l\272\354\242\200\316\027\2359\022"
+	.ascii	"3\241c\214\001\370Q;&\330 q\021\360\200\206\215\222\002\302 "
+	.ascii	":~\325\004f\327\0244\034\334)\213\301\020y\212\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintLinef.221.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"5\013"
+	.string	"\226\324LC\020\251j:"
+	.string	"\334;\317l\004\025"
+	.string	"\374\302h\030o\333pA\034\273\331\353\037a\304~\350`\006\276\360\023^\344X\032\313dP\216\202R}\001\024\200B,"
+	.string	"fH\273$\245b\016@\221lr\033\033\332;\2456"
+	.string	":"
+	.string	"<"
+	.string	"\246\205+\266g6\257\321\236m\177\320\236y\264-\334\\\260\226\023\003\001\022^\273\313U\005\037OG\377\253_\312\022yj\321\330]\323\262T\340\256\267Ma\033\303>G\177\335\336b\275.x\304v\t\3042\210\\\031\205\006W\375\366\2772\3066\017a\274*\364\r@\3328\241\316]\322\346\231/\266g\2078\265\357\340\017\306\247P\236\3315M`\355\006\336g\302\316Q%\335@\301\017\024\354L\251\244/T\242B\255v(\242i\035\320\350\346\217\360\025\311\304\200\32269\241/\235i\031\200\235"
+	.string	"*i\233$\255\t\354Wvw]M\366S\001]\t\005u\0361\354h\3668 \210\307}^\327\021?\320\007\344>`\347\341<q\204\343D8\f\371D\016\024\206\"\2071\367\225\255&w`p\211\352\310\241\312.\202\214SEcv\240v\023"
+	.ascii	"3\241\005\037C\324\342\303,\370!\f\007$.\002\036\320\260QR@\030"
+	.ascii	"D\307\257\232\300\354\232\202\206\203;e1\030\"OQ\001wy\321N2"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.222.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"M\f"
+	.string	"\026WT?\0201\324t\210\302J\262\bk\001\246\227\322d2\365\032\007\034\020\034H"
+	.string	"\331{\227\035\025\277\221\253\355\233\2544\320\273N\351\326\035|y\037\006(\016@{\244!k\027\275{xh\330\310\336)\005>"
+	.string	"?"
+	.string	"G"
+	.string	"\035>\331=\325\220\261k2\360\202\355\232\315S\036\327\266\017x\\\363h\337\270\211ZH\212\005\b\027\260\335\355\352\211\217\247\243\177\326#\245\211<\205@\330]\323\3224\342\256\267\315\331\216`\037\024&I\253\t\373\331\356\256\353\311\276\352\317\"w\2350\034\033\030\273\":r\210^\332\f\024_\375\366\317\262\3046\337b\374*\364%\225&\244b\234\273\245\31257\330\256\275\300\251}\025_1^\025\004\250]\001\363\212\235\243JzB-x4\002\320\0036\262j\203\027L\t\255\374\255\2630 \bQ\332\234p\342J\021;?T\322\020\372\326_x\004\240vI/5l$\007\n\256\331\0338\320\227\246\270J\261\323C%\355N\300q\334\205\302\345\"\201\3438"
+	.string	"\036\210~<\216\030f\036\376,\232\315\327\201\237\227\021\301OG\323u4\036\247\373DOg1\3400\003(v\2370\024;\211\271\317\266\236\214!\361\022\325\221C\331n\211\007\347\212v8\025"
+	.ascii	"2\241\005/0<\224\325\202\037\302p@b\021\230\255a\032\270f\264"
+	.ascii	"A%`At\374\336\204\226\244\002\264k\n\032\016\356\224\305`\210"
+	.ascii	"<E\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_printValuePointer.223.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`,\016}A"
+	.ascii	"*o<\030AP\246N\007[\325\253{!\225m\375?\367\265\252:/\320do\327"
+	.ascii	"\037#\2144\b\265M\315\006\354\237\004,\021A\022\021\375\371A"
+	.ascii	"v)\302\336M\311\216J\323\207\260;OMDDh\223\275wJ)\005t\001P\001"
+	.ascii	"x\001\316*\3209]\235_uv\325\271/\fXs\307\205\335\275bQE\367N"
+	.ascii	"m\303\326f\272\343\316\230\211c3\233\300\035\206\233\f\017\305"
+	.ascii	"\364\230\266\343\030\016\313|\262f\344\354\360\335{\253Ze-\266"
+	.ascii	"Ue\352CfN\235Y\001V\333`p4T\200\331]\0279\020\034\312\200\230"
+	.ascii	"\220\327\013\316\231\240\235\271\273\264\227\266\337r\264\321"
+	.ascii	"\275L\364\326\334\013\275b*\266U\206vrm\225m\244\265Un\231\367"
+	.ascii	"\032\232v\201kt\300\304\034\272\367.\337\tw\264Sh\363\320\333"
+	.ascii	"fZRJ&!\035\031!\217\306\"q(\f\262\300UM\277\311[n\270&\360\027"
+	.ascii	"\347\034c6\023Pk\t\250\245\204\367dK\225mO)\236\\\252\241\222"
+	.ascii	"\244\245\221\264\234\201\342GkQV\344\331\363\211\226\324\210"
+	.ascii	"\013R\313\021\n\025\343\231\336bC\022\350\214L\255\213iH\216"
+	.ascii	"\364\331\323\310J\324S\305\214\241\316\236j*1\005~\211Ii\274"
+	.ascii	"\247\2264\313\217\257M\223i\017\033\353\362a\0232\"-\204:#3\353"
+	.ascii	"`J\305\307\246P\343=\315\322\244\230\024g\267=\2078{t\002\027"
+	.ascii	"\255\305CT\324&\323\030\326\372\004:#\023\322)X\363kE\336{\205"
+	.ascii	"c^\3517\027\221nJ\251\216\324)k\274g\2214yg\211\237\206k\250"
+	.ascii	"\266\247\233;P\353\336\313\356\034#k\006\320\314\275\210\231"
+	.ascii	"M0\023\303\004\035>x;Y\371\365LV\177}\227\003\373\343\352\273"
+	.ascii	"\033 \270e\254\255\252\337af\377X\237~7\255ty\224\255\376\277"
+	.ascii	"\t\355\315\201\375qy\224\373M;\275\3351}\021\007\352\273\303"
+	.ascii	"$}4;\334u\037\245\303M\347~s\334rZ\3753\345&\271\b\3400\363\036"
+	.ascii	"{/\263\217\260;o\017\273)\367^\004\255n\245\\\222|\371\037\003"
+	.ascii	"\373i\365\337j\343\337dz\252\t\350\343\346\276\306\376\321\270"
+	.ascii	";+\315\217\257\t\332O+\203o\270f\361\340\364\274\334\217\371"
+	.ascii	"\256\237\326~\006\317\016&\244\213Ct\032\021\354\275^\r\270\345"
+	.ascii	"Z!#\330(9\326V\373?\316\236\333\033\227G\231\241L\1774\346n\264"
+	.ascii	"6zS\370\2310\253\316[\026Tg\255\006\323\035\341A\226\203\006"
+	.ascii	"\r\355\306R\235\031\364[\367\2026\323|\325q\315V\251sU\352L\225"
+	.ascii	":#P\235\017\0349O\0319\033\020:K\t\235\243\214\234\013 \235\t"
+	.ascii	"\244\316PFge\352<\300\350,\340\350\374dt\016\020tvR\235\001\244"
+	.ascii	"\316M\2523S\352\274\224:+\251\316\311\3249\311\350\214Tt>\022"
+	.ascii	":\033\t\235\221\251\363\221\350l\034:\027\205\316D\241\3630u"
+	.ascii	"\026\006\235\203\2543\273:\003S\347U\r\356\274\227\301\023\353"
+	.ascii	"\026\335}E\273}\021\234\321\3237p\261\266\254\205\322\256\255"
+	.ascii	"\255>=\211Ds:\232X7\b\031\340\035\360\265e\024\002<\t\277h\263"
+	.ascii	"\211utG\247\317\312\323\226m9=\t\2779\257&\326\2711"
+	.string	"\002\370\007\357v\3322\020,\200'\201\310P\230\2313[\300\226\344\036\036\241\242\357`w\246n`]\327tbk\376%\246\346\\\354],f\304/\263i\367y\241Z\337g\272y\324\271\3355\375\217\333M\367k\375Q\333\203\022\037\215\217N\241\205W\2374U\265\325\2075}\3571}\323\237\210\345\242\326\213\225\242(\246_\252\275qy\264\323{\357\035>Z[\275\205o\276?\200\\x\300\273L\373\265T\236\322\332*lS\303\324\2256KR\235\221;\257g6\020\266B?\202\217\306V\277\364}\006W\227\240\225~\351\325\276\346\221\344+}\273\265!\021S\314-\227.\324z\211Jk\277t\237\204V\003\244%?\270g\f\"6i\020\322'\361\221\240\240bm\025\311\350\261\376\250\365\032\371F\310oB\207\324\324i#]\024x\3343\376\261O\212\n,\326V\215\304\307\372\2427\323\255\303'~7\333\206\337\205"
+	.ascii	"\355\231\323F\272\276U\230\027|a\236\027[0\326V\203\300\307z"
+	.ascii	"\026\370-h/\032\247\215tt*;\371\372]\246\361dx\312\273\267\331"
+	.ascii	"\316\rl\363\302Tl\301B\207\2249txN!\245L!\245\004\262\225s\n"
+	.ascii	"\251WYt\213\0266V\2440<\250\260\321\342\304\r\342\214\0237\236"
+	.ascii	"Q$`\321\002\305R\005\212\023+f\250\250\361\202\305\362\005\213"
+	.ascii	"\023.\226(f\320X&pb\0301T\314X\326\200\001c\306rx\373\231\300"
+	.ascii	"5k\307\346\216\353\273\330\237V\230\274\264\314.\266Y\302m\251"
+	.ascii	"\321\370\026\021vW\212p\214\344)Uu\325\367\231US}\3257\230\020"
+	.ascii	"\004\177\365T\357r\315\277\003\217\340\373\313\263\210\260\302"
+	.ascii	"\022\225w\340\207A\374 \n\322D;*\311\251Wz=\223\331\253\264m"
+	.ascii	"-X\330\332\352\324\367\037\251/\360\006\330f\2725\352\245\276"
+	.ascii	"\233mW\037\365Mbv\370\2246\254\303\344mq\266\266\207T\326\232"
+	.ascii	"Ki\305Rn\307\234\255r\267>\326V\013|\207\321{\373\341P\332 \r"
+	.ascii	"\206\370\223\226\310Rm\212\300\027\347\366\270yY\023\355\210"
+	.ascii	"$\rx('\255\221\247<$l\263C\363\231\254|(%\316\244Es\260\244U"
+	.ascii	"cpf\245|\007z\002~\300\273\334\022O\322\242\265\232<'\216\244"
+	.ascii	"Uk4~\244\303\b\370\005\206\362\270\005\271\276\fAz4\306\261F"
+	.ascii	"\370\003oN\340\3708\371\3257\032'\222a\311h7v\347dM\254\213:"
+	.ascii	"=\341\302\346\310P\023d\203\357\276BG\007\337}M\214Y\337k\203"
+	.ascii	"\366\212\017\336\306 )\304\252\276\3720!\334k\344\374`\007\242"
+	.ascii	"\224\363\301\336\365e,\201\025\250a@\344\024dddD\202\202$I\322"
+	.ascii	"\030\221\005\004\031\346\330\331\r\021\360\254d\022\321hT\250"
+	.ascii	"\264\035\367+\351?X\247\232\033\031a\327\262|t\331\247\352\005"
+	.ascii	"\313\031/1=[M\270\201+w\021\261\372\377\370q\037\230\0339\346"
+	.ascii	"\004\203\260f\306V\357Z\r\370\316\037.=PR\206m\271\314\334\360"
+	.ascii	"\200\\\225E\312\224%\031#]K/\323\254y\325K\325\315\252\230]\023"
+	.ascii	",\021C\306\0217\213\205\224<\274D\232Z\037\355a\0132D\201\326"
+	.ascii	"\317O=I\t\205S\025\003\213*L\216\204\261\322\277\220\375\203"
+	.ascii	"\035\263\2451\206\026_HK;S\350\361VCoBy\3566\235\355\204\354"
+	.ascii	"\246\330\364\253\033\232\346\005\213\341\323\342B\214EN\013z"
+	.ascii	"\357\"\370\013/\256\324\352\313=:h\022\217\264\330UK\317KZ7\362"
+	.ascii	"4\232\372\263\265\366\305x\003U\323\311\275ZE\276\302\334\302"
+	.ascii	"<nNV\302%\205\035\t\375-\346\353\274\370\270\206\274\330\327"
+	.ascii	"bl\230\016x\3512\016\376h\007\026?\361\007\315B\024\241\b\305"
+	.ascii	"\356\240=n\331\224\204\032)99&u[\no\240I9\007%\220'\315s\t\203"
+	.ascii	"\226\356\"\372\\#|\330*c\223\333\334\240\315\036\006\276\322"
+	.ascii	"\323+\316ye\275\b\005Z\\k\250v,\304\244\244\232q\320\343I\320"
+	.ascii	"\332\241\232\263\211@\376i\215\t-Xc\\J\314\201\202\257\201$F"
+	.ascii	"\036N,\036\367\354\240\b\\D?\324l[\2520\306\377\024\027\275\237"
+	.ascii	"O\330\231\332\206M\2648\032Z#W\270\023\017Oj(~\335Z\204\225\201"
+	.ascii	"G\201tSR\351.\323\221\236"
+	.string	"G\204y\324\036\363Ak\364Z-\370i\256\332\324\273\270$\327\032_\334[.`\300\033(\370\nh\377B\001\347:>\324?\346\211\215\261\353Q\201\216<4\302\250\267R\020\257\323@\001\253\301\230o\366\200\204\365\025\245\307\200\226\223\241D\203\267\013.P\262\323d\205\016\355\333\363"
+	.ascii	"\202G\370F_\303h\232i\303\006\221\225\017T\003"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.224.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\333\021uL"
+	.string	"\272\200|\034P0\022\322I\007\217\234W\352\235\345\213#b0\003R?{\366\353$\325\013L3\005 \216a\377\250\230(%\306\243E\206kP"
+	.ascii	"g\t\265\r\026at$\315\036\"\032VR\363\271\243\201{\3041\315\357"
+	.ascii	"Y\204W\301\374\321\266\266\266f7!R&\031\302\001\206\001\257\001"
+	.ascii	"\317aO\267\303+k\327$\343F\306\007\360(\357*\331\343p+\237\333"
+	.ascii	"\341^NKh\213\231\242\357\213[\2244e\346\210[;\340V\030\020n\r"
+	.ascii	"//MS\031\300\2437\374M\311\341\222\bu1S1\027}d\334\232\216.\024"
+	.ascii	"\360\250\320i\203\232\212f.\023<4iW\225\016\236\230w\357\366"
+	.ascii	"\032\224|\n\006\257I\323\2630X\322\224\351\264L\300\243\313|"
+	.ascii	"N=\n\374M=\252b\205\222\325:3\215\311\217\211\022\31372i\312"
+	.ascii	"L\366\nN\373\346O\346\027\250\265\376\344\204lbZRJB:2*\"\032"
+	.ascii	"\022\nJ\002\375\370\364\034yvtrpnljhf\214E\342P\030\004\376*"
+	.ascii	"z6k\355\177Qs\267\301\305\201\227/\261\255?m\241\302NC\034i\245"
+	.ascii	")\313\231\204\310\302KB\004\301JnIuG\242\253\343#\272+l\364\213"
+	.ascii	":\331\242\260\231\215iy\321\334\211\344\346xH\016\213\025\026"
+	.ascii	"\002\"\207\270Jc\026\246\345\f\372\222!\236<\177^L\324"
+	.string	"\316%\214\210\223\305^\336\016\247[2\220\nc5\374\207\005\037\032\3363\003\r|\234A\n\363\224\355\254]Gm\215s\324``\034'7.\334\246\005\027\270\246\005\026\230\346dc\3026s\302\215ma'p\261\314\004&\002\237`\003\023c6\346\366\341\016\231\2159\271\260-\314\t\007\271\204\221p\n\r\265\2055a`\224\027\322J\270Y\330\bUh\327\202\335\016\231\205\271\325\337\351\216\2565\305\230\215\325\360JvT\351\305'\b\357\223\251L\013\bF\261\2563\247\210\024\302|\356\f&\306\305\374\213J\323t\371Kl\354\013\300w\273mw\177\354\032\341\0028\232\207\212\023'\367\002\315z\313\276%S\017\242\n\371ew\034\210\036G_~\374\007 G\201\276p\017E\340\223r\363\201\027_3\017Tq\364\347\016\344R\005L\027\357\355\336\035\250\276q\364\362r\004\256\rr\036\252\200i\332E\300~\207\f\216x"
+	.string	"\370\302\321=\006\365\350\273\177(\023\305\224%\334\334enq\243\355\236E\332^\231\355\263\335*!A\032"
+	.string	"\302\300\017\037=x\354\270\r?\325\231\377\024\312\253#\307\343\276\013|\312\257"
+	.string	"\312+\205\362\342\250\2747*o\002\225\327F\345\255Qy\021\250\2744*\357\214\312+\343u\337\030\277\362\215:\334\027\306\343\276/\240.\367uq\271o\213\313}\0170\362\032P\344ea\344-\240\310K"
+	.string	"\221w\005\221w\200!\257"
+	.string	"B^\025C\336"
+	.string	"\204\274"
+	.ascii	"\374x\223(\357\023\220\327\t\345E\002y\233~\274LA\336\245 \257"
+	.ascii	"R\2207i\206\027)\310{4\303kD\344-\"\362\022\031y\207\212\274"
+	.ascii	"BF\336\240\"o\n\"/\020\221\367'\310\353\023\344\3551\362\036"
+	.ascii	"\215\274<E\336\035#\257N\2217\207\310\213C\344\275\031\362\332"
+	.ascii	"\byk\206\2744B\336\231\037\2571\310[\f\362\022Q\336!\312+\004"
+	.ascii	"\362\006Q^ \220\367\367\343\255\225\027\255\274'\312\333(/\243"
+	.ascii	"\274w\340pP\312JX\013\323^\230)\223f\231"
+	.string	"\364\016\335a\355u\377\225\037\356\217\373\345\260\234i\034\r\266\027\236\004F'Q\027\021u\265;\276\245\260\004\025\036\235\034\344\021@\240\201\354\350\fu\320\236\326\224!\252\026\352\243\236\022\212\214 \240\236\352\024'\363\237\006\352+\333~\272\276\345@\221\204\024\034\233\032\344i\320\350\006nl\372\354\211\373\364\264\317\261{xZ\247\217{:n\360P\365\316\036\217\033W\365\250\016NOu\016\177\263\324\233\306\351+\333n\272^\251Q\302K\f4\306\"\3623ft\220\231F;atY\211b\354\263\265i\032!R6T]\323\307.c \220\232\240\036\2451\366T\317\030\033\345+6Z\336i8\342\217\343\342\204\330h\313\302\246\377\204\b\"/CF\013i\356R\207\215v\262\330\313\323A\330gIj\261?\246\n\030\030M\354b\1779\302\260\211\375e\237\260\201=\354\337\022K\262\"B\252\016\266\317\233\022\312\233@\242"
+	.string	"p\177\244\036\005\366\301H\250=\325\277\276\022JT\327\256W~Tf\016,x\255\332\242\177:\334\340B\225$^\304#\030\273\333b\276\235\213\202\214\f\330h\213\267g\342<A\211}\230.\341\313\036\f7\351\262G\342\035<IQ\340\2627b\361\200i\272\365\262=PU\202B\312\266\301\2234M\227\356v\027\357/[<`Z\032\2262\323\245\243:\372t\257\211\343\"v\267\344\276\375\351h\034~\360\022\3735}@s\364\371\306\2343\315f\263y\245\n\243\301\266\242\235\243\257w6\362h\263\235\262\f\0277\267\373\354\347\270\226*\243\264,?i\335\301e_\024h\243\355\2454\325z\201\276\342\303c\344_4X\017\017D\236U\304\202\n\256\260j\226\021\013\216\314\3102rE\301U\221+\342\004\025XQpf\025\261\300J\202+\032XYH\204XYH\032\313\352\202\336!OD\212\fI^\r\261\222"
+	.string	"\353*\313\b\221\244\021\"V\024$\207`U\220|\362\331#H\256\260\222YG\216`%\207i\336O'\250\336\261\243\346\316\210&wK\232+\357\251\321v\370\205\374Q\224D\262\3511\032l\221.z\317d\213\206j\260\030\375\242Q1o185Q6\361\350*\202\fI=\372XB\350+\362\321{\006A\265\213\030\375\243u\270\276\2740W\bH\246%\344o\334h\036ML\006t\001\036\030@\325,\372\250\2475V\300\212\236j\002\006\350\025\003t}[\202Ka\003>%\244#\344\023H\240{$!\t\320\001\220 "
+	.ascii	"U\253\350c\2271ZeR\001${\252\001H6\312w\304\004/\365\214\210"
+	.ascii	"\206\220\267a\243}\240\0255\332\271\005\016O\004\242\247F\236"
+	.ascii	"=Q\265S\037\365\264\322\024@2\365T7\305h\246\256oCPT\330\353"
+	.ascii	"\021h\021\243W\304\231\320\327\303\034\314\024\r\366H\314\300"
+	.ascii	"J5\356\222\352c\311r\347\305}\373-\177K\005\345%\373l\207_?U"
+	.ascii	"}\272\333\250k.\353j\323\243\032l\317\237\003j\254-\261\254\253"
+	.ascii	"\007\213\352\027\235\244\322\254\262\245\213\367~\246i\232\002"
+	.ascii	"5\332\326\020\224>\ft\375\300\207\035 ]?P\341\246\201\256bH\314"
+	.ascii	"\0049\231RLm(\244\367\374\265\350\003\220\217\352\252\376\223"
+	.ascii	"fSYF\304\317|\354\365\323sD\276F\215f\300\247gI\251\227\222\372"
+	.ascii	"\250\225\372\247\267$kK\222D\325H\355c\247\204\302\251\226\f"
+	.ascii	"I\254\352\321\243\242\236\352\201r\250a8$\031C##\"\"\"I\222\244"
+	.ascii	"1A\006\204\220bW\364\021\360 cX\325\210H\n\n\031\346i\233\034"
+	.ascii	"3\360*\201\2552s\357O\212T\352\n\323k\274\350pr\233\020zb\342"
+	.ascii	"\352\276E\363\342\326\227)\270\260xM\272f3\r\035\235\203\036"
+	.ascii	"D\364h4 \321\0237:\245\206W\251\263\370\033\025\262L\306\275"
+	.ascii	"\270\004\205~\250\251\232\355t\354\204\326`\357\013\2218m\232"
+	.ascii	"\247T\227+\244\320\366\317t!@E,\221Y\315@\030\301\005\237\370"
+	.ascii	"\276\352e+\232\"\007\252C>\314u H\303\246\350c"
+	.string	"5E\234z8\246\300\t\333\3058\225+\212\322\236\355\377\334C!D\017&\314\216)x\337h\374hs\036\033:\023\177_&\314\252]K}\310v\212A\363\240\373bX\022\216\210@| \260\356\210\033M)\343\253d\223\250\217\217?\257\022@"
+	.ascii	"\306=l\004\254s\022\323\211\312\334\345\005\022\264Y\243\252"
+	.ascii	"\357\001\334nc\034\210\005V\375\f\334\333\270\346\222\217\013"
+	.ascii	"\215m\017\036S\020\263\226e9\377\253\nY"
+	.string	"\021\313\036n\026\346\036\344\023\370~wc<\374d\364\253\201\302\307\2121\f/\247\006\262\234\303\021O\240K\347\252\036\005sX\030\344l\026\016r k\377\255\355'\347\037!\232\021\266\037>\037\023'^\215\243\226\314\221\026\314I\n\346\217\026O\272!\2441\256\340\3653w\222\b\007\343\256\315\232$\002s\347\230a[\322\245\2041_\305\247Q\001gad\245\301\200w\230\016\tH\271[o\217\364\3679l\235\204\273\305\031k\347\340M;j\262\351\201\256u\255\304\337F\347\306S\320\022\022\214\346\362\335n\357.\364?\271\340B\250\363\007A\256Z\224_j0]9\265m\215\245B$rP\254\377<\364\322U\025i\244\211RW,\215SA\325\\\377\r\247[`\207~\226\0054\324\331\b\315\373!\364\253\303\177\233!\025 l\375\024\177lwmP\306\336\325\330\331\b\210\230\226\230\355Zf<2\214\353F\213\310"
+	.ascii	"\"}6\330U\325?\220\312\333\003\311\363d\204\250\227x\374F\024"
+	.ascii	"\264\326RBx\372\034\004\312\215\300d$f\263M\340\016\273\256\n"
+	.ascii	"\257E.\230\225\371)\362\356\021\362A\241 \224EP \341\304\324"
+	.ascii	"\230\350\314\216)\244\370\007"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.225.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\225\n"
+	.string	"\006\224I= \305L:g\027\313L2\220\345<lz\222\225\034J\314\336E\tI\210+\324\241\005&\024A\215\344\231\024\037l\007a~\2240- \004"
+	.string	"\342\032\252\300\013\330O&8A\320\336R\312\0247"
+	.string	"6"
+	.string	"9"
+	.string	"\030+.\235\315\342wik9\271`\335\310r\\\332\332)P\266\266gB*g1P\242&F\247BY\332\362\252<1{\013\265\3263YR\354+\373\237\341\277\301\277\034\274\373m#w\354\337Y\033\366\237\357\235O\317g\346\257\0053\013)\227\005R\353\304N@-\241#\262\377\245\377r\004\205\322\305Lj\f\240\321\270\251>r\265\332\276\016\003L\274\343v\311:L\246\205\377\210\020/\351\365n\274N=\356SDj\257\356\230\270\243\3126f\346\201C\261\356_\216\255\215\276\031\227 \361\222K\277\244\312\322\355\002\234\313\024\0077\036\007\360\353\200\234\206\260#\372x\276\217\207\363\360\201a\350\333\020\034\004\321\t?\021\b\024~\027[\335Y\033\366\003\222I\373R\321^s\257\376skL}\232\264cM;\003@\025\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.226.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\205\n"
+	.string	"\366SI= \305L:g\3072\305%b\305\250\200\004\231M\3211\f\022\270\213s\"\302\271XpB\021\324H\236I\361\301v\020\346G\t\323\002B"
+	.string	" ,P\005@(\223\330\030'\b\332[J\231\0027"
+	.string	"6"
+	.string	"9"
+	.string	"\025+.\235\315\342wi{\301\335Z+d9.u\355\f(]\333\223\243\312Q\b\224\251\231\321\255H\226\266\314*Q\314\236B\255\365L\226\023{\313\376_\370\177\360/\007\274\373m#\267\354\337Y;\366\237\357\235O\317g\346\357%\263qRn\013\245V\211\035\200*BAf\377M?\346\b\t\246\213\003\2521E\223\021\262\362\310\325j\373:\001N\274\343~\315:F\346\205\177\b\021/\351\365j\300P=\356q\0375X\267L\\\222e;\243\273\225\244X\367/\307\326H_\214G\224x\311\245\337\222e\351\266\201\305\353\024\0077\237\006\360\363\200\035\206\3203\002}>\320\247\343\360\201\241\350\333\024<\364\340\t\277Q(\024~\030[\335Y;v\216\311\244\215\271h\257\271Y\377\2715\247FM\272M\233@e\025\017"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360Al\327\304t,\364"
+	.ascii	"\036\"\003wOP\355?\245\243F\253\240"
+	.text
+	.section	.gnu.lto_getValueOffset.227.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"}\t"
+	.string	"\006\023C:@\305(\035\365\245\013r\312\001\371\310X\030\214\\\210o\036\300\031:\225+\325c\371\204M\373\240?TY\035\246\t\206\243\350\344\214s\030^ _\270\362\314\362\177\371-!R\246\0244"
+	.string	"2"
+	.string	"."
+	.string	"$\227\024(@\020\301\203u\"\t \345\214\0037\250\034\323\027T\216\355\306K\327\222\377\221;\230P"
+	.string	"\302\324w\2654H)\255a\352\342\336\333N\260\035\355k\002{\251u\325\307\b\2548RG\235Hi\321\022 Q0\223\016\333$;c[\325~\310EH\237\023'\220R\305*\221r2x!;\346\231\331\366W\007\t\373y\367\302\250\375\351\364\341\356?\276\272O9\r"
+	.string	"\265e\213\332\241\221>\374V02L\373\331\363\323\325\260\177\311U\371\362\371g\227\372Zu\333\310\323\221\300\254q8\217\0267\255\363\340m\"\020\027A\\\347\0235/\0249\007\356\"6/\212\272\316\213\231)\357\313n\3005Y\243\272\327fkCp\372\360\262\233\212\f"
+	.ascii	"2\003\302\260\334\341\222\240~\202\272\3175\334e\002sk\224\016"
+	.ascii	"L\020p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.228.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\356\001\315\020"
+	.string	"\206 pE\360\262&\035\220\351Z\326\3417\364\274\271j:>L\304\373\024\245\251h\031\232\377\2165}j\f\354\320\306\bkIt[5\264:\331\006Lr3\033\203\024\021\322FXL\212\346\230\323\267Q\371\326\022\2627\2212\245Z"
+	.string	"T"
+	.string	"`"
+	.string	"\371\036\231\227vsr\330\330\375\024\030\301vh\333g\361\026,;H\201\357\304\315\201\035!50\210\354~\234\277\017\210\207\333M\361PM\234u\230i\262\374\326\241\302~d$\0220\035//\304\265\304se'\273{\237\247\215G\223\251\245\354\256\363\345\335\334\361\266Ul7\260sB\366\327J-a?[\315\261\267\264iK\227\376\335&\357\371I\2664IK\2174\275\305\264\246\245\243\246aLg0\255Y:5}\001"
+	.string	"\\"
+	.string	"\361\016\003\332\205\025\t\355\016x\003\305\277\337f\371>\036\261\375\305\004X\036{\257\307N\320\220\335/\301\241\027l\207\001V\211\220\177A\275\210\021\266\204\317\240 \343B\205\230\b\023\033\312\335m\251_\242*\206\037\037\256,b\037\3501^|\035[8\345_'e\020\033Z\021+\311T\273\333\220\177\231\350\211K[\276\246\352P\r\221S\177\301a\333u9\360\1772\260l:\207\276L<\274\336\347\220'&\024\3243\223E\001\250n\245\335\313\312\351\0034\n%\265\202\342:\324I\303\252siIq-\251\023\013\207Zy\340P\fX\325\241[q.*\325\212\033\371\366\331j\216#\016\216\254\364"
+	.string	"\207GMJR\033\333$u\312\214\322\300\221jZ\332t\264\351S@x\rMabDY\324LM\2324@\250\240\311\"C\215\372\032\"\002I\242\016# p\242\241\262z"
+	.string	"\204\326\"x\256B\220j\305\233F\033&\302l\210M\224f\321\364\005\320\002\277\013\3029\305\320\370`n"
+	.string	"\035\261\320B;\024V\330h\213\016\326"
+	.ascii	"\021p\216\005l'Z\032\211\270d8\317\250\307\302\031\217|\200*"
+	.ascii	"\007>\0277q\266\235M\be"
+	.text
+	.section	.gnu.lto_cliGetDefaultPointer.229.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"e\f"
+	.string	"F\030VA\020s\232\016\324\r\361D#\013\250\220\025&\362\263\331e\022\245\315|\177"
+	.string	"i\004\213\357`\324\377\326\354\030\035\376]H\b\234/!\330\212\200"
+	.string	"@\002\304D\361\032cEa"
+	.string	"7'm\335h\023)S\nB"
+	.string	"@"
+	.string	"E"
+	.ascii	"3v#\002\033\240\016m\373+\316\242\263yh\207\r"
+	.string	"\235\021\013`<xd|\354F\313\361\003\244C\352\"\322\241\232x\367\354\374\307\374\001\211\026\035\336\307yN\016v\327\351}!n\275\355\002\266\025\330\327\020\351\352\361\326\034\364OR\032j:\202i\215\322\251\351\207\204\340x\371\336Rc\027D\b\310\332\2004N<\376v\347\307\270\262\035S\002\354\215\375\227\003\346C\217\335x\340\320\t\236\007\251\\\300\356gG\232A\204-\3411.\030\033,E\033\270\274P\001 Sm\nZ\336\323\350\b\213r|M\325 \236\031W\270\213\022j\227\205\201\337\342d\243^\016}\025\351\360\372\024.2?@\235\f\331\221\223Z\302~\264\372\261\247X\306ivasa\200\306H\264\rfe\3305\201\313PL4\313D\273J,\214\263`\221\020\360v\222q\026\312\266qV\025\367\321\352\247\322\221\216\256\030\252j\245*\203\003\212\225\f9R\250\367\314\210\344\2446\204\by/\n\022"
+	.ascii	"2\2411\037\030\204\025\316WQ\275\n\020\262Sb\005\307\232v\tm"
+	.ascii	"h*\200\266\t\3305\321\251\026\273c\202t\024\271B\215F\374\314"
+	.ascii	"hj\347\023"
+	.text
+	.section	.gnu.lto_dumpPgValue.230.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`R\004\005\034"
+	.string	"&3\264I\240Zm:\034L:\215\211\201\373:{b\251\027\310\032\374\354\005\252e\301\375qy*\370\245\023&/[\374\2537\n{\333[\017\037\323x\373\261\0270\nR\352`4\350\371\347\234~R\354\243=\232\277\366S\023\021\"\267L\001\233"
+	.string	"\223"
+	.string	"\242"
+	.string	"R3Lt\275<Q\314\016\253\247\253{\327\006\f\336\302\330\366\217@\341\344\225\306\373\336$,\bl\177~b\250\223\243jp\200{\227\270T\271wup\006#\203_\031\02628\362\200\220\301\237\277\232\030\321E'(\341\355\252\256\356\275\262\376\301'\217b\b~m\317\263\310C\246*\312\243\310\323\303\350\210E\035\034~\f\326XqS\252\273\017\306+\222\276T\235\005w\245Jd\277$EG9\333/\025\367\231\367^\256b{C\315Y+\362\334{oS\325\210O\362\177\034\377W\374\337\211\001\254\355_\305\314r\252\323f\256\321s\333\3566\2738\247\261\224\332xo\256\3029\n\212\236qH\215\220A\356Ri\312\230$\250(\0336\353_Q\333L?\177\267\227~^\231\t\260\024?V\332\357\224\3660\246\342\353p\024\263"
+	.string	"\322\376%\332\273Z\3669\244})\332\267Z\366$i?\212\366\"i\037\216\366\240h\377\205\366\335\3666\264g\263\247\210\227Ce\244(\367\362\262\336\\+\360\212\021\226b\246\342)\256z\371\237\352\366\335\243\365\032\275| I\361\020OF\335\007\005\f\376\0326XN\177\201\007Q\243\377;p\026\017d\363\022\244.N\031\212\244Ia3a\341X\333&\274\336{\301f\272\302;PzO\246\320\230;\375\315\bcm\227L\241\311Y,\266\367^\264\331@\bk\256b\004h\317\311\324\231\234\305:"
+	.ascii	"\246\021\022hX\337\356\216\n\330\260\307\006\021\302r\032kS\327"
+	.ascii	"\350\301\026{\354\206\243k\302\211`*bg\b\002\366\327a\263\256"
+	.ascii	"\tg\263\336\rv\303\031\301=\022SL\224\270\205\f~M\001L\357\210"
+	.ascii	"\216\025\320\377\211\024\226\323\3566CF\213U\255\233\030L[\002"
+	.ascii	"s\250fCP\366\004\331\241\237\333\254E\215\203\355gv\213Qs\271"
+	.ascii	"\260\315B\004\275\270\261\030k\267\237\231\f\360\264\007>?4Y"
+	.ascii	"\2156k!T\033\202\341#\203\3413{!\243\t\331d\017\n\034(\250&$"
+	.ascii	"\033\002\002\022\222\225\353\345\357\366\322XF\265\262\321\270"
+	.ascii	"\321\352\345\352Wso\214\253I(=69}\016s\n\021\225zKDF\235\t\t"
+	.ascii	"_r\232\213\220\2748\265\270\300\376'\222SI\310\204\307\325\032"
+	.ascii	"\\\243O`\033py29\235Z]6\247\3215\341\270\264\332\245\324;`\311"
+	.ascii	">o9\241H\265\007$\351\351^\035\247gO\250\2410\242\220R\b\215"
+	.ascii	"\310\004\022\314\314$\315\001\260\002\221\241\333\r\021 \265"
+	.ascii	"s\316\031\303n\225\333\032\372\373\027xr\343\006\353\322=\375"
+	.ascii	"\031M~\235\3522~6\334\267~P`E\361d\276\271\374\243\023\360\341"
+	.ascii	"}-\356!\2743\277\207<\251\376\200\033\322\241\355\334\311\353"
+	.ascii	"(\214\332\352\r\366\275Od\315K0D\225\363q,M\333+\317FT\227\325"
+	.ascii	"\301\221\223\347\243\371\232\366\240\t\221\343\2559\271\354\263"
+	.ascii	"\"\032>\304\035\207]\263\266+t\002W\246\036 \252\306\340N\331"
+	.ascii	"\2359@\220\">\235u{\255r\274\372\006\266._&\355\311\315\353\177"
+	.text
+	.section	.gnu.lto_cliPrintVar.231.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\255\n"
+	.string	"\366TLB \2138\035O\260\301!\006 \256$$\352\240\001\237\337|\212\250D\006\2230.,\016d\201\244\376\3061(\002\250\034#\366\2240\255\020\200\320\"\264\320\r\346\310\331$[du=\354;Hs[\271S\n7"
+	.string	";"
+	.string	"6"
+	.string	"+n8\003\373\264x\212\353\023\373\304\365\351\316\266\200\t\260\236\207\251\001\211\001kw3M\360\356\262\363\257\272\345\003\275\313\207\220\335\265\374@\002\267\336\366\205m\020\373\030\001\023v\007\2648\3548!(x\352\267\177\225/\266S\276\020\261\024\366`hr\200aW\324\370t\007\246\322\346\370\350.\236`\256a<E\310\\\332?}Aw\024\312%vC\t\0176\352\371\322\353\017\2246\220:\214d\313\227T\265E&\362\337T\311Z\025\030\001\250g\213\236T\004\366+\273\273\326\320\276\370_O\335\363\250_U\372\030D\206\n\340K\001\\\b\244\036\217\210S\3414%j-\323\361h\331F\323p\270M\350\323\311>\035\215H\246q$Y\246\302\033h\303e\241m\343\262\213\270\257\254\206\306V\006\306\221\246\330\"\257S\267\021\371\317\026\002\002\f"
+	.ascii	"3\241S(\006\313\013%B\005\310\256\201x\\C\bj\222p\013\372\006"
+	.ascii	"\250U\300I^\\\223\f"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.232.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\321\007\r-"
+	.string	"\nP\210\021E`^N:\363@\013\327\240}\212a\270`\027\236\203C\274\212bc\211\227\317\026\367\025tx\256w\354m\fg\r\302>\"\322\177\331\340\303\006\f\355\0354p`.\216\021\336\246\232\021}\250m\2334B\210\334I\006\003\001\367"
+	.string	"\005\001P\336\366\247\251\361\335\326\316\246\276M)x\265^/ \234\243\234\206\364g\320\274\021\372\225\277\205\201?\231\202\005\365i:\202\304\365r\365\304\216g\312\360\356]\037\374d\t\351\317\003\231\371\226\371e7S\177\266\343E\367\216-\341\356]#\260\203\364'\257?B\177\2467B\177\262\312l7"
+	.ascii	"\353\022+$\321d\261\341\335{\227Z\t\377\254\372!\241 \340\317"
+	.ascii	"\227\366\320\323l\253\362\025,Qjy\021?\304%daKJ\220\021\240\331"
+	.ascii	"\303\342z\3627]C\314\f}\356\302\334\355v\313\013\313\376\222"
+	.ascii	"|\201\335\027\366e|\232\024\366%\344=\323\301]\234\236O\351\022"
+	.ascii	"b\036q=\321\032\362\312\262\250id"
+	.string	"|\233\373\233.\243\ta.\t\006\364*\332\323\355LbG9\260\233G\373)V\004\257\214O\330\327\361]\204\310\325\317\313\n\r\232K\202=\254\353x\332\236\207{/[-\257\2573\321\231O\200\231\2030\367\216\002n^ths\301\354\263\3119\263\335\375/Y\201x\260\370\232\026g\263dvq5/^\006\331\3644N?\017\006i\033\325c\264\343s0G\265\254xwD\013(\003\262\217]7\331\031\376[\225\036d\370eV\254F\256eW\302\360\305\004\227Q\356\021%\037\216\355\322{\211?\362\221\216\334\344\232(\367\336\006_\230\331\356?\246\310\333u\327\333\340'R\037\355\017\216\024m f\271#\241o\244f\233%\304\212\205\367\362\224\336{u\201\337\245\004T\332\344'\177\007\372\363}\022\301\3209\232\235\361\260y\314+\3216\231\361m\356\310=\306\234\324\226\221~\366\023x\333\331(\300\323\316E\247e"
+	.ascii	"m\231\350gy\250-\013\371,\007\371,\003{\226\177\251e_j9\355Y"
+	.ascii	"\356\241\226\321\323\362iZ6O\313mZ\266m\371\n\n\274\251\301Y"
+	.ascii	"K\246i\272\365r\345\375\271rg\230x\316\346\031\240\213z\213\371"
+	.ascii	"WB\215:\251\017\3009\322\025\217V6\317\372\202\372\\\356GU\202"
+	.ascii	"\264\204R\311\260\232\030\324?1#\312\224\313\367\250J\020,I\213"
+	.ascii	"B\273\244s\303r\220\260\345\3515\031_\007\032\240\3174\245\026"
+	.ascii	"{\366G\317\022m2V\231\240\300~\230"
+	.string	"Z\335\225\355\303\374;3T&)_\205\202\376\004\366\267\300|\335\353_\277H%=\253A\323\366\365\213S\254l\036\033u\332&\033\325\311\355\250Pze<\274\235*\205(N9v,\273\367*\003\235\327Q\223\246ZE\265\202^K\305\202\376\354\365\335\316@\212\222J\273\231\301\352:\023\330\253\275N5;B\252hi1\305\007\020\347BGF\356\252\211\314\034\342t\">\0069\342s$\376\266\214\263\266D\373[\316\004g\304\023w%\27289\223\t\330\356\263\277\036\316\t\001\313{\213\327B\221\02690H\241\302^\213\203\305&\262\331\347\212\313\2658[l\342D\020\002\023\323\211\001,\243\352IJ\030\025\314\3214\034~(b\252\005\315A\b\315\301\rTB\033QM7\212\030\306\202`\204 \214\005\301\r\302'\251\246a\020\206\020\307TT\324\007\001P\3171\254\222\nQE5\204\212\361\0336\335hv\222"
+	.string	"\025\345\264$tj\2121\024VIA-IA5\321Xr\032R-I0\300S5\204\303\245\252\251\251\341\022p\275\3571N\353\222r<\332\212\377\366[@K\206\276Z\037\352\017 iQ\255\033r3W\2523\n\001\350\257VK5\023\260\244A\324"
+	.string	"\372_\202\330\254\247\016H\325h\213\352\020\f\026k\211\250\217\007\266\306\347\354c~\264\037Y\347\0254\3012\253FT$[\376\036mhp|\356\254\232x\007l2&\312\342K\362\225%\351d)M\336b\323W\224\342I\316\311R\232\3372\352\241\266ajm\204z\250/f\357\0230M\031%/\220P\377\212Q\017\226\363J\274y\357\275\277&\343\273\375\307\"\332\223\364\001\200\214\250a$\205\030rJ\261\021\tF\222$I\007p\002\031\232*\363\021\360<\310\030\253i\ni\fo)\244\303T\332\266\306\254c\234%\304\021[@\304\254%\033\b\264T\333A\345\226\316u\f\241NK\272\322}L(\332C\027\275a`o\271e\\\2415\\\215\200PdSX\256\346#\264.q\327\323u\203\221\005\013\030(\025\321}?TY\324\031\243\260(\314\232\323\023x"
+	.ascii	"\245g\205\036\272I]\227\2327\004\361{\317\366\204\005\302\023"
+	.ascii	"\240\261\262cr\036:\312\247\206\210\037S\2375\237\001\304h\204"
+	.ascii	"\225\206*\361\273\210\203\017\321\265\330\340\270\261\260\006"
+	.ascii	"k\332\313wx\371\223\365\336\335\370\016\306\277\364\004?n\357"
+	.ascii	"c\231\373\241;#\341_~\244\261(\\[\367V~\245\030{\222\207.iE\202"
+	.ascii	"\243\215\347D\007\310\372\312\r}D\234\346\307u<\362\255FA\317"
+	.ascii	"\2327\276D\223\342\230\024u\334\033\366\335\311\303<?\304\262"
+	.ascii	"\025\315\262\313\b\030S\262\251\021An\fe\245i3\377\003Dc\370"
+	.ascii	"\r\004\274\023\220X\251\215\f\304\320;\317I\344\021\261\336\257"
+	.ascii	"\365=\244\204HdG\223\200i\370\017"
+	.text
+	.section	.gnu.lto_cliSetVar.233.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\234\t\035."
+	.string	"\352N<\021EpZN:\177\b v\263\314\367\240\356\202\001\211\001\265}\007\347\003\230\271\220X\342\022\305\363\r\343\317.=\314\234mf,\013\202\017\210\324Dq\244\017@\377\211\262U8\344S\226gk\313\302\254\021K6\221;\311\005\001\350"
+	.string	"\377"
+	.string	"j\214w\356\276\013\357l\007\033\bL\253\3632#\234\205\2319H/\345S\222g\263\372\375\272\227\241w\306\203\315\275k\tn\271)\275-p\366\332\237$\017\245\005\333{{\354q\271W+\211\225\322[c}e~\223;I^\355\305\217\367\002\201\343r\357Z\022\037\245\267\274\366\037\3646}\017z\313I\346< \030\367\252\351,\207r\212\336\275w\251\205<y\237\036\236\243\261H\034\356\b\203\300\364\207\332\263k\222\177"
+	.ascii	"\355m\313\353\352>\315\036':<y\307\"D"
+	.string	"\206\030\317\024\211<>\f\333Qw\316\263,I\204?\250\340\017\352+\307\201s]\313\263\200\222.\0345\375A\245o\316\230\264\371\361U\366\337\215\243?\250\033\267D\257\030g\201{/\214z\352\370\217.\260\240\227\026j4\360\243\253\354\354\363(\214L\215\317u\221\235?rbx\277\362\312\345\225U\353\017\352\336\313u\313\353\353\374s\346\257`f\t\314i\227q0j\037\377\236~d+,\256{\214\313\233z.J\032\255J\2079\356B\350\273\251\271*\301\262j\223\231\245\276\005\231\336\253\365\304\327\222l\002\"-{\201\336\276\037,\301\314Q\303\252M\026V\003\315<E\242~\353@W\246\035\2238\255\276b^\273\252=\306\374\3636\220\006]\231\201\255\374d+;\331\312M\013\0240)%!\035\031\235\355\\t(?\321\255\234\017\\\35570$t\346\231@Z9\310V\036\200V\026\200V\006B+\007\350\312"
+	.ascii	"\272\362\217\255\354\363\253\334\203V\346A+\037\177\225\215h"
+	.ascii	"\345\342\2572\261+\017\273\362\216\255,\264\225\203he Z9\265"
+	.ascii	"\225\177he\324V\266]\371\354\312m+W[\371\016\206sX\274>\204\356"
+	.ascii	"^\032\315\275\033g\275 9\333\317\374\255\274\231\177*\257\362"
+	.ascii	"+,df+\034<}\354$\244\346it\212ri\354\243\361-\210\324\305V\""
+	.ascii	"v\361.\211\206A\003zK\354\242X\031\260\307\344\336d\320H\335"
+	.ascii	"\0346\203\235F\372P\330;ut\3023ijo?\323\256N\332c\214\276\305"
+	.ascii	"@\025\264\020[[\236]\320\004\232\2139\330\304\272-7\004:\370"
+	.ascii	"\366\003v\332\n\272\31305\260-\237\362\327\351\257\213bE\250"
+	.ascii	"\240\314\324h/\350.\243\254a\033=\232$\332\206\224\317\001\275"
+	.ascii	"\265]\024#\"\207k\211U\233?rbx\226\337\002%j{\325\266$\212]\203"
+	.ascii	"f\352_9O\233\262\257ynC\317n\320\215\364\263+_\214\275\332\335"
+	.ascii	"W\366au\370\031$\202:\366p3Q\267Cu\265\277\\\272\245\035"
+	.string	"\314E\270\305]U\276\004P\250\2049\307\360\311\234[\302\360\341\252\023\263\333\243\215\357\306y\351\275W\017c[\304\354^\346\177\341\260\277\307=\2733\273k\327\350\366\351\310\264k\013U(L42\305\210\250\fSUTV\300\251\023Q$Nd\212\021Q*lU\224\212f)\245\020#\244\226\220RQ\037\252\220(J\204X*\021\"\212\304\222T\325\211%\245 \2462\201\254ZBAEU\265$\\\273?o\003\3414\317F\034Vg\361\275\374\225\317\207\250\271b%\321&P@oY,\233i:\352\314\351\tj\2567\211V\201Xg\001\275\r\352b\026\222-\312>\2756<\003\210z@\027\305\216\254Q\366\305\371T\030\006\343\004\215\354\330c\374\275\363\035\256\367\346\360\351\\O\016\236\323\335\333\273\374\355T\273\300\221\363a\034\303F4j!\2661G\206G=4\324\304:\027\3135i`E\001\r\324FE-"
+	.string	"\210\216X\324\001\372\310M\022\315\352\002z\033\240\213bF\336\206nt"
+	.string	"\272\250k\233\262\357\247\221\016\240+\034\237\376a\203D@\266\206\314\247\017\266\304\023\3633\357x\354\300\005\t&\265\020\033\334\f\240R\0135\027sO\013uO\027\243\224\321\t\003\200\304\250QH\345\230BR3\")H\nRh\f\340\002\031\231Z7\021\360<\210\034#\221\250\244\2301\003\341\025\351\327E\322\260\375\211\302\345\021"
+	.string	"0\2422$\216+\250CVh"
+	.string	"E\330Wf\246\327\202"
+	.string	"b\262\2675\222l\270\022fGa\362\247\0172\303\323\375M*08u\266\334\030\030\224\007T`\022<\177\250+\356\311\211J\017\204QZ\327b\252\341G\263..gl?$\177y\367&>f\027~\263o\375\271"
+	.ascii	"q\256T\363\033{\016\333\302\0162\206!D\336Yo\304\241\302\207"
+	.ascii	"\022\316\227p\276p\250\241\235\344G~;\016\361\260\355\273R(\362"
+	.ascii	"\022\350-\273\b\260S\261\356\2578p*t\\\314\265I\205\322H5+q\034"
+	.ascii	"\351>\215+\030\334(q\235n\206\305\216\3662\346\341J\221\347D"
+	.ascii	"\216s\214\273\361\0376~\336q{d8\353\211V:;nA\365\373\205\002"
+	.ascii	"UW9\rp\355\237\355\323F\353\215z\372.\321\326P\3419\363E\365"
+	.ascii	"\353\235\353\312!o\033\262G\313\230\020\226\033\324\362\215@"
+	.ascii	"\254\260x\336C8\\\204#(\316\210\206A\020S\005\230V\334\322\016"
+	.ascii	"\177\263\247\020,\313\225(\304s\335\332\024\201\3135\306\277"
+	.ascii	"\271\344\206\177\303\b\264a\362\237\001\243\032\020X;8\262\024"
+	.ascii	"\031\013\363\374\214\035I=s\302\201_\203\024w\002s\2068j"
+	.text
+	.section	.gnu.lto_cliPrompt.234.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 \360\275\006"
+	.string	"b\214/60o\223\016$\036\310IV\206q\225T\004\260Hh0\376\256\t\353{++\230\365\347\321\347\031\243\373\365.p0\260hP\2217\352\271\307\206\201\242\312o\203\020\231\002\037h\0062\322\323\246r\230\"5q\032.\312\323\251b\247\342<\304\351\212\210\033\203-\b\352\212\036\313\272\"F\224\205\241/\235\ng\001/\226^Kj\"A\360\221\371\2516q\371( Tz\212\212W\355\204\016\205\303\200\331\213\262\007;\276"
+	.string	"\tC\0173+ [GF\231\033\243\226\344\244\224\220\277\230\261\357\n22[\020\341\3208a\311\314\b=\212\365a\267$\025\320\266\254/\200!3\177\332\006\352\260\277\346\217?(\b"
+	.ascii	"2\001\007xF\340\002t\rw\013a\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliShowParseError.235.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 \367\345\006"
+	.string	"\322\31405`O\322\001\024RP\205y\tu\310si\347E\257\273, 2\270\227\017D\340\017\254\255\302 U\357\275\r\205\304D<<+[.[p$\365(\220&wJ\001\326J5\036D\217N\017\002\206\034*\002\276\b'\b\215\237\016\365:\324$\361\240z\036\247\300\325D\324\367\251*}\233\321>E\326l,\032FfXr7\371\t\205\001\310.\350X\205\006\264\220p\311\266\270p\307\254\260\255h\032y\331\243\313\245\207\375\314\246\310\316\001\227\224\354$-\273\03510\253I*\"\266\277\261eo\004\033{1\214\204p\240\274\354\356\313\217[w\226\377\222\007`\331u\007\340\260\273vX\026\272\363\266\021l7\330\016\005\b"
+	.ascii	"2\001\007xF\340\002t\rw\013a\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.236.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\365\n"
+	.string	"&UNB m\234\016\004\244\210*"
+	.string	"\300b\360Y\273\013\366\353\253\034&\206\304\036\001\306\b\025\007\177\371F#=\331I\357\032\030\244\023\004\b\001\340#\006.w[\326\020\361g\330pKT\363h\330\023\215\264\275S\n8"
+	.string	">"
+	.string	":"
+	.string	"\273$\306\037\326+\223\307\220\274\262~!y\345\320.3\030\254\030b\341\202\207Tbw+\235\360\3603\364O:e\374\210\237\223\221\335\365\034?\017nz\333\034\266\001\330\267\004\241\177J(\312\020\237c\360\260\353\340\204\211=U\037*\330~\305\036\331DU\354\202\b\r@&\371\r\341E6\231\262\013ADiw1\256\326\253\213\372\264\237\341\032\302\207\020\334b\027\004\242\024KA\266J\022\247\004T\201'\223\242\224Nz\016\357\260\331\240\260\333\371X\300\352\210t\274\2629\007\346G{\224#N\036*\332\2448\251\004\373\324\356\256)\310\376\350\247.\372\351\003\326\\.M\207]\232\313\325i\032\007\324\002\\\240\327]\233\213\305"
+	.string	"\306\321n\343\250\306a\035\345,\263\r\310\252\226a\002>\r\354\266\332m\030W\263oS3\032\366\bh_\005=\357\253\025rO\005\r"
+	.ascii	"2\241;h\340\303\005X\256\001\003f\f`.\350\234\022\202\005\002"
+	.ascii	"\203+\322\324\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_nextArg.237.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`_\001\025\017"
+	.string	"\346\233eE\360\222(\0352\3557TZ\372\264j\324\240g\243?\24412\264\315\215\253\315j[\b\275\313\020\266\234{\345\3776\355i\365s\242\230\301^\313\2608,\276\367L\205\r\361\305\023\326<1\362\016\372'{o)S\nM"
+	.string	"Q"
+	.string	"S"
+	.string	"\233\277\023\220\217\234\017\220\217K\242S\370\335P\273\313\bW;_;\271p\250\274\322e\307;i\204\033\003\2531\342\245\340\203\227\025%\376\272\256<\224\302\024)\337\277.A\346\202\251\274\224\253\006a\316iUy\037n\355\266M\266\035\330W\t\326d<\314\017\377\335\252\352s"
+	.string	"\374`\361\356b3\247\207\231\220\031\2133P\374\373m\024\377\345\216\355\257\0130k\346=V\013\013\037s~\b\036\315@\017\323]\300\234,\032\031s~\t|\200\363x\227\273P\334m\007\224iEA\313\013\207\231\2339\277\227\355\210\201\021\267\345\221\024\020\021+\267\200\013\233!\032Ww\345N\352\306\322\215\0212:6h\0208\347\234p\301u\345j'W\214\224\212\223\316\366E\b\026\315:*\311MC\302\2651d\320\253\342\352\r\217Y\f\265%\373+\351\266\3547\250\261a\302\313r\034\351d)p\021H\241\017\307]\360\210\330S\002\252\340\331>\036\223\t\334\207\024\002m!\220\211\205\315\303\215\266\022\003\026\235|\270\215$\022q[\347\233_\326\032\302\267\270\246\355c=Tb\246=\235\220\3332\311G\362\373\025\231\034\237\3210\342\260|Ed.\330\n\204Ig\001\035"
+	.ascii	"Y\005VzCf\306\311hhf\236\300\362L\210F\273\361\245\342F\273i"
+	.ascii	"\037H!\324\325\246\032\316\324\312[\244\202\020\224\270o\305"
+	.ascii	"\303\233p\034EX\250|\377\314P\247,\341\210\225\312P\204V^\363"
+	.ascii	"`\240(\233\256\371\004"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.238.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\007\004\335\034"
+	.string	"6\365\273J\240XU:\220\250d\254\247\177\301\252\037k!\323\336\307Q.\222b=\037\320\326I\251B\253\254\024@_~\254Z\377\272\334@\3241\357\322y=^\276\235c}z\201W\371jA^\360\006\026C\366\235/\333\032!\204l\271\223\f\251"
+	.string	"\234"
+	.string	"\251"
+	.string	"G\0305\365E\336_\367\n)\215\334kl\300\n\322\233\377q 9\314k\025:\275 \007DM)\210(\3575\312\330\370\231\363f\372\330y\263ep\2755\236U\225\367\225*EO\323v\345\361\217\247\340\013\322\024\024\242\370\312\316\320\310\201\343PX\374X\005NKMOz\335\021\372\252*\306\320\347i\320\260\347\250\213\237+\241\213\2336\301\324\225#"
+	.ascii	"\204@+@\207\307\006K\250S\255\215\371$\245<y\004PX\364X\006R"
+	.ascii	"t\374\260\204\277\332O:\006\242',AC\237W4\302\275\227kP8<\263"
+	.ascii	"\316\314F\314\214cn\245\325i\310\212\227n\"\263\321WO\003I\013"
+	.ascii	"\025\334B\31447\372\003\334\370\307`W:\277\\ge\231\027\377V\314"
+	.ascii	"\221\316\351\213g\024\255|\242\225M\264\262E+\367Y\271\236\225"
+	.ascii	"?\240\025&)|\321\321\275<K0\027\312<r\343J?\322+\363\371D\316"
+	.ascii	"D\342K\254\341E\224\362\336\313*\302O*\261\223\020Q\223+\367"
+	.ascii	"^\013\351\207\360\223\030\371\243\234#\341\374\016\357W\f\021"
+	.ascii	"=]\271\327\270\340&SHo\036\260\217\235$\230Y7\317\234\303\314"
+	.ascii	"b\34662Q\364\240\032O\320\270\356/\307\342\224\235\237^]\242"
+	.ascii	"\266\2319\234\211\355\230\257\250\244\247K\016\251\263\211\315"
+	.ascii	"\334\341O\263\364\336\013\201\277$\003\315\300\214\241\233\374"
+	.ascii	"\023\347\315\007\263\300\272;v,\036\245\b\323\253KN\322K2\231"
+	.ascii	"8g\332\246\220'\313#\225\001oX\327"
+	.string	"%\240\217\022`d\372f\361E\324q\n\022\b\375\325\226i\256\300.\256\035g\247\363\325\265\317t\353\243\006\024\217#\344\026_]r\253\272\232\331\306V\037|\365\223\207)\245z<J\271,\262Md\336\351\352\026\362D\352X\345W\247xU\321f\276\345\352\203\256~\322_J)\036P\277F\021\f\242F\004\210\335\354&\303\345n\267\034\215\300\315lD\227\250y\300U\260\321\315\322\035\016'7a\207\253\335plt\022<\330nf#`5\033\334Lg\352v!\232i5\266\033\232\254F\233}\320\325v8\233\fg\233\335d4\235\bYM\001\316\205\250\351d\273\\N'c\031{\267*\264cb\372\307\277\240\244\264@\365\332\267j\"\267\246R\232\236A~\001\252O\362\264w\236\364\363 \277\330H]\315\266\266\032\355\235Z\345\366\336{UM\244\331\020\245\250\tX\247\322\263gf<\230\345\237\235f\237m\271"
+	.string	"\201\370N.\314R\276\211\363\246\331\253L\250A4\210\214BH\021\022\232h&(\250\213\001p\002\241:b\007\020`\311\244\311\264\006S\262[\207\217^D\374\304\034;\205$\345m\200,\353\342\342\026\216\033~<\321\356HKB;)I\263\\\252\204\002\001P\367zZ\030\302\t\002\tx\200\254p\215B\021\362\330\2220\210A\326QrQ\265ul[\201(T\341r\375\357\357\030\202'P&\346r\036xd\020\356\020\375\205x:1c\205\020\b\300\311\f\fa \222\274\331\371\331\"\b\017\204\346\002\013\367\353\312\016\202\242"
+	.ascii	"\240\265.\367C\2142\225\016\265\0025Q\232\006"
+	.text
+	.section	.gnu.lto_isEmpty.239.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\225\013"
+	.string	"V\226QA q\223\016\037N\216\260\030+\006\300\013\031\376=\244\030\007\f\276\302\025\251:\\\321\226\026\004\354n\255w\026\212\r\3055\204\274!\006"
+	.string	"\204(\004\310<\021\244a\346\304(\326\246k$q\357-eJ\001?"
+	.string	"A"
+	.string	">"
+	.string	"\032\016:|\232 \377\247C\024\031:\020,Fd\241C\n\303\237%\013y\231\335\255d\244\324\247\341L%\226l\364.\245\024\356\247\347HF\312\004\260`w\235\024\262\013w\274\355\006\2669\354\023\b\025\262\237`\354\222t36\005<\301\301\366\307\256\330\316\264\357\341\037>?\001y\200]MD\211\335\r\201\rP\207\336. \036R\277\304C\333N\240\340c\320\200\220\220\013\216\0164DB\304\330\335*\r&\3763\2053\225\236j\037\361\212Ay\241\342(\023>\250\r\327\002\243\025$JD\331er\246\222\t5HTe\320\202\2242\354-\224jb\377\355\356Z5\303\237\374\372\322\251\351G\314\002I\0178\027\346\361\210\2666.\bV\265\261:\034`\033\017\347\2528WG\204\312\302<\252\r\214;\0226X\345\351t\260\252\262\355Us\352\201\347\323<u\3046\324\214HGN\205z\221\032\242\354\"\324\017"
+	.ascii	"K\b\230P\307\023\206\242\262\312\334\352\350\244\211\004\242"
+	.ascii	"\200\306\345\204\360\271\214*\325\370\211ea\"\341\252\252\206"
+	.ascii	"\364\256\002\005"
+	.text
+	.section	.gnu.lto_printRxFailsafeEntry.240.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`C\006e\""
+	.string	"\326\276\331F\200\234Q:\033\204\f\n\267\033\222\212\326\230\322m\253\373\243\333&Y\231\314\264\3326\227#u\334\005\307/\314\211\344\253\352X\267\226#\333\026|\213NY\231\321\007l/\245\030\267R\335O\315\2709b\204\020B\244L2\304"
+	.string	"\254"
+	.string	"\311"
+	.ascii	"\311\037\354\337\362\336\375\356\271\354\322\370Y\256\345aK\333"
+	.ascii	"Re\341\n\307\006.\035L\206\200U\2255\b\262\372@\362J\222\335"
+	.ascii	"*I\205\023\"+\017\324M\262\254\253\254V$\203\233;\265_W\300F"
+	.ascii	"\224U\356\025\274\225\252[Q\305\362\352R\001\2316\357\376x*\301"
+	.ascii	"#i,P\255E\374@Ho\342n;o\226G:o.\363\356\003\t\301w\331\330\256"
+	.ascii	"U\353\214\227Z\221\rvAzs\203\273vn7\2520\002\0271\353JY\2555"
+	.ascii	"\327H\036\274Y6\007\367\017;\020\261(\274\t\344eP\021\310\273"
+	.ascii	"\\\240\225\346\307P\021\253\264\261\331\242\363\260s\216\342"
+	.ascii	"\0253j\241\326\272L,\372\370\236\337\335\020\273\033f\367"
+	.string	"<\n\303\026.\267S?u'\361\364\201n\3522\317\360\t\177\321\234o\356\017\235\\\361\331\032\350\367\271\306\370\345\025\007\313\037+>\333E\n\271\217\354\276\254md\367]\277\202'\277\t\016\366}\372\327\357\364-\337\246[\371\017\034\371\033`^\\\312\313\304\274\005P^\002\314\273\304\274J\314; \345Mb\336\033\312+\200y\003\244\2746\346\005\200\362\"1\357\021\363\0321o\021\312K\304\274C\314[c^\241\224\227\306\274A(/\020\363\246\314\2132\357\211\362\232(o\311\274}\362\362\311{\007\300\036<v\024\237\024\253\225\307Y\237:f\202Y\362FD]\364&\nQ\277\3138\306\354x\343\264\205\332@\357\333\200\250a\f\223R\353\360D\021\351\360P\020\334\254\365P\357\2220\301'nY\205\264p\025\364P\202\256\321Zh]\\\354\004\205\275\232\257AQn\n\025\347\211*\316\233\264~\232\003\006\250\203\320"
+	.string	"\365\371\303\310\305\354he\007\355\264\317\255,bC\255\244\357\230\363l\264\331\317\320\211\331g?ku'\343\304\354s\271y\306\330\205\353x%D\255\261\356#\313\347\235e\267\360M\034\2579X\314gww\027\303Kk\305\232\260\017\023\214\302\"\255\265>\311\315}\325Yk\362fLk\312\221\301\273\023\364\375d\201\241\361\275\374\251\233z\367\005\f>\261\273)\253HfF\026[\333\025N\270\235\023\216\312\t\347\353\351\240f\374\212v\266\245\f@\237\216J\006\257\026b\312G\245\203\342\255`\002\262\350AEIa\300\300\203\322\001}=\235\206\031\277\233\217\027\025\245k\261C_"
+	.string	"u\036b\300\240Z\221\356\316A\317\267\313\361v:\250\037o*\252\227\213\352\351`\344v?`\316\201\322J\305\340\375rSRR\277\034\rY_\3266\262\017\373q\340)\216Y\365\225\211S\352%\246\306\365\271\245E\354\302\313\3660\021\350\002y\b\254\031\200\207C\r#\231\016\351\360_\bn*\365R\220%\245\244\036p\366\341dw\222\004\364\255\216\200~\227k\370aLc\306_\362\260!R\336\370\250\003x\260u\200\022\237#\307\206\324"
+	.ascii	"\340 \365\365\030\307p\035\255\314\334\250\217\372\334\002\303"
+	.ascii	"\3622/\352m\250qP#\2111R5#%II\222\016\240\002\021:\252\016\021"
+	.ascii	"\020\241T\3161ZXP\272\006h\bes\236\031\013\352c;\302\230\234"
+	.ascii	"G\003\332\0275\325\264G,\324K\002\344\213\225\304\262\203\272"
+	.ascii	"\303\235e\336\307=\207\026\350\341\022\373f\311\205\231\241\303"
+	.ascii	"v\022\221\354ksv\273\324\026\205\2144I\201_\343\300\245\276\350"
+	.ascii	"`b;\314\307\374N\276\023l\267i<\242\232\003 \020\022\352-\240"
+	.ascii	"a.=\357v\370\003V\255\005~8\213\316\347\246~oM\300!D\302\304"
+	.ascii	"\350\t\243L\0322\0224_\221\3670z\334^\250\301\004\365'bU\355"
+	.ascii	"\345\217\f\272\334,\245\r\362\310#I\311\217AB\303\353\004R.\024"
+	.ascii	"9\305\036\362\004-\264H~gn\001(\232\311\247^2\303.:UK\315\301"
+	.ascii	"\273\326{v\215\270\376\001"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.241.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`>\f\rD"
+	.ascii	":w\200\032A@\244N\007\177\32774\374;\002\215S3\246SE-G\f\321"
+	.ascii	"v\224\rW\361\034\0051\342\320\241\320g\310.\251\035\002\335\220"
+	.ascii	"qo\354\317\360\351Op\30226\246\252\231a{i$d\357\235dJ\001\230"
+	.ascii	"\001p\001\231\001m\314\003\363|\226\035\272g\252\207\005\032"
+	.ascii	"\257\276\216'C\212L.\233)I\321\370\305\rRAtVju\245\366\314\f"
+	.ascii	"1&\323@\021Dg\355hH1\3452\220\"\025\216_\\\006'\323^\327F\272"
+	.ascii	"\032H\371/\273\331\225i_\005\242\263\357T\237kc3p\360\372\030"
+	.ascii	"1\033\200\246g\006s\226{@\3640\257\213\301\341\331\231\211w\246"
+	.ascii	"w\2039G\255\234m\006Dg\237\336q\267\307\271\227\327\277\344p"
+	.ascii	"d\316L\312\340\345,w\325UDg[\316\231Zg\211\256\324:\333o\267"
+	.ascii	"\340\323\216\314l0\265{\316\r\3129'\337I'\371*\347\275\342\327"
+	.ascii	"\235\232\230\226\224\222\220HGFG\327X,\"\016[v\375'\374\266\233"
+	.ascii	"1\335\251i\216\2123-)\r/,9\233\342I\177\321(\253\224\036\024"
+	.ascii	"\214\034\260\344\254\315\221\250\034\255\021\356r\325\377\242"
+	.ascii	"O\326!\\\341\233\303E\221`\243%gO\374X\247\313\021\367/\252\306"
+	.ascii	"\227\206\215kp\321#\2708\274p\245\013\264\317\22237/Z\031\330"
+	.ascii	"\231\241\361\277\250\221\365\210E\020\316\341\242h\230\270\266"
+	.ascii	"\3224N\374/\212\266J\340s\333\3636E\360pUB;c\307\377\242mk\002"
+	.ascii	";V\214\270\336\023\267+\023\0207\250\377E\245\254U\203i\b\275"
+	.ascii	"\316\211\331\365\335\376\364\360\277\350\224uB\232\036\200|\316"
+	.ascii	"q\231Y\023\257\3057!\376D!\376dd\266c\225\3129\373\234\017\200"
+	.ascii	"\213n\301xx!\347\334\030jv\346\r\345\335.\327\335w\335E\266\004"
+	.ascii	"\336\300{\235\177\240s'\310y\245\211\013\331g\353#\364'<\233"
+	.ascii	"\347\251\313\260\233\2579\347\274>\233\213\265P?\341\243\232"
+	.ascii	"wU\347Z\023\027\266\023\376\357~I`\207\266\024\023.z\257i\235"
+	.ascii	"\214SM\020\241\370\273O\244\300\016\375\227r>\263\241\036\377"
+	.ascii	"Pz\327\346\231h\f\027\276\2028BS\376\331\332=JP"
+	.string	"\021\277\247g\3223Z\177\026\324<d\270P#1\201\357^\221\205\035\352\357s\356=\350\320\006\t\r\222=\263[\256\211\237\255\333\035\b\276\311\3653\351\236\340v\336\020\\\334\013\222X\216\347}\345{\336\t\234\215\267U\025\002\027\367\001\317\363\246\232r:o\003.\356\002\376\305\235\200\237\361\216\3621\336P.\356'\027\267\223\213\273\311\305\315\344\342^:\342Vrq'\035q#\217\270\221\216\270\217\\\334F.\356\243\213\333uq\033\215p\027]\334E,n\342\021\367\260\305\335\272\270Y\027\367\352\270\337\305\215[\334^!@\240&\2351S3\017(\227\201\024\036\312~l\036\025\337sg\343n\347~\306\035\317=\317\235\316]\214\373\030/\352\366v>\217\323ml.\357k\035j\325-9\3476ru\033\335\264\277\331\203qC\312\324\020\227\232\3666lj\254\271\210\\>;\222V\353\342\006\275\360r5\335F\323"
+	.string	"\031\273\275L\273\031\277\3634\256\027k\234\\n\234\035\370#K\250Vm\002\222Yc\005\027\374\201o\354$D\332\255\277\340=\216\257\\\242\370\351i!\003\250Y\350\376\232t\177\035$\354\262\246q1s\374:B,\030\212F\346b2\277z\347s*\346\036\300\266\211^\325\230|6\314\236\252\344\343A\204H\260\376\210\352\206\3173\257(\273=)>\033\356~\325^$\330\241\215\357\020\006\361k>\363\361\250\334\025=[\277\313h\257\246\302\354\221R\361\220\341B[\230\371*\201P\005\347W\332\340I\316d\021\022y\341\313\346\344mkk\235\275\372"
+	.string	"my\t\336\370"
+	.ascii	"\250U\300\342'\370\265\357\320\373F4d\365\305\3677\236BZ\225"
+	.ascii	"\343\314b\204\213\006\">\333\037\267z6\f\240\236"
+	.string	"*\\\364\356\306\t\275o\t\236\344\354th\273 \037\364NY_*\320\367\255}\255\274X\260C\255^j\3073\233\370E\277:\240\027\312\253E\n\361\275\215\023\377\250\325j\231\2211\027\257/\320\260F[\365,\023\220\0165O\001l\240\313\353\005;\264\352\261\233?r\374\260\213\265\303G\360#\322\b\251\200tyM\\\b\306\007\305\034i\006Xe\355\201\257\351~\2678\037\f-\324\234@M>q9\347\b\201.\250\241]\212\263\275\241\003\333\356\241uv\370\355Y\032\341\364K\373T\317\366}\373\256\347DA*\0329\3178/d\277\3007~\026I\332Qu\322>\033\322\305\332\251\3770v\n\251}\354O=\276\353(\020!\260C\331_\340\001\335\245\374\372\312\332\322\"\366\261[LIiMI\321\230\222\352\342\312rac\211\324[X3\266\302\262\274\222_`^^`ZQ\275\205ec\231\264\261TR\266"
+	.ascii	"\003\321B\0316Cy\214\341\312\030ba\353\252\244\321\225UB\271"
+	.ascii	"\344\242!C\271t\227\3120\255\254e\326\226\006e\0130\257\3432"
+	.ascii	",\306w)\277\276\262\266\264\206.h\260x\345\027WW\013/\255aka"
+	.ascii	"qui%\225ZY.\226\312\260/\256\344\027W\226WRk9#\211\005\240\301"
+	.ascii	"b(\227\31100\260e\322(7\346\027\306\276\371N(\324\346\246\355"
+	.ascii	"\330\230\261&\034k\316"
+	.string	"K,\3149rP\f.\364\244\236\300/L\0260\322\312\275\fn{\233T;\210N\237{\276<p\235#\357\b\002\343\347|&\261O\231\351\322S\223\267\314\007\321\351Z\234O_\224\366U\237\211\224\"\340\246w\372\002\357j\260\3645\023p\347\rBtz\023\252!/\221\3473\033\302;a\2503}\323\027\245|r\234k\270\207/=\323?\"'\234\322/%\021;\316\021\334\202dM\211\345S\003\234~i\231syIm\334\221<\337\342 a\375\022\235Z\234\026\301G}\231\237G=\313\024\214B\315\203\002\247\275Z(\270 |\004\3023\265\345\215}\322\3733\021\232\23031\003\007\213\020Ar\300S\213\3436\313\330\220H`\360\020\261\2429\201u\204\004\271z\244w\222\302\251>\023\215\265h\320\376 \365Q\031z;\242z\013\324\262\367f\317\350\b\rG\305\214J\0021\020\374\303\241~\214\376\350\243\244o"
+	.string	"\237\211\240\216o\364O\001\200\352\250q,\245\230S\250dDD\244)H2\034\200\002\021\2422n\003\021\220\275C6\222$\205\f\007!\243\324\275\327,T\354$\347\257\321#\355@\267\224-_\204x\2240V\311B\310P\003\034\357R\235\216\301(7V\237*\2713-\262\214\f\222{\3445\367\2262\026\314c\221\037\2567N\"\371w\030Ip4j_\303\364\376d\347V\336C\377@'\3174)\fE\266n\262&\261\245c\223\257\263\002\246\364\377W\365\204\035\006\354C\203\312;}\177a\242v\364e\241\234\344\371\224\340y\320~\0162`\334\267\344~\262\243\354`=\321\241\211R\335\321\370\317\263\336V\367\321\240\256k\027\213\302\241\221\325\205\037\361\377k\227\324;v\204\267y\b\315\037\2714'V\241j"
+	.string	"\222\2706\036[\233}\213\231\276d\030\r\221\223\036X\341\356\206\333\217\222\256a\234\207\234\247\350\237\203\226\024U"
+	.ascii	"\215y\212\365e\025B\264\005~i!\306\207\325gBQ\226Mw\t\3419\234"
+	.ascii	"\223\217\252\034)\"\313g'{\263\353\277"
+	.string	"\303uy\304\0263\027\214b\246l\323N\246fr{\350-M\035H\215"
+	.ascii	"\016#Fd\273\032\340\306\240)\3011\016i\355\242\251WR\300\367"
+	.ascii	"\201G\375E\247k\213\300\247\355\005Q\b\270\277\242\266SCA\233"
+	.ascii	"X\240sL~ifq\211\234\222|x\030K\205\031a\226\214\203\3165/\217"
+	.ascii	"\204\005\247\367(\006\341\214I\313S-\341c\n|\257m\336D=A\322"
+	.ascii	"D&@:xFy\226\345\271\177\311\b\243@\240\310\n\b\013|h\225\346"
+	.ascii	"`P-\213k\016\215c\304n9M\323\003\310\270\020\221\252\213\333"
+	.ascii	"\033\351\345n\032\321\251\235\003_\264h\232z\344\227\275\307"
+	.ascii	"\275\372\275\2216\304\364F\343?"
+	.text
+	.section	.gnu.lto_printAuxEntry.242.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\206\t\3050"
+	.string	"JX4\023AP\244N\007+\01394\242!u\315\267V\261\210 Y/\212\215\216\022\345\277\374\313\204\031V\022/\313"
+	.string	"n\207}D\323\200+\245\264)`,D\203\005\214\217\f\261\f\374\336g\b\331mm\357\224R\n&\001"
+	.ascii	"\001$\001]\246\211\314\315\334|\334}m\246\375\330x\006\355\350"
+	.ascii	"\002\336\206\303sG\370\247\307\235\241(\306\347\037\236n0-\246"
+	.ascii	"\3114\224\215e\320\220\236q\004"
+	.string	"[\307\2302(\246\363\376\030*\371s\342\t\332\bs\306\245\226\243C\236\\\024\264/g\351\215s^\270\3423\317\032<\301{\235W\255\262\030w\341\362$D\272\245\237\313\336CS:\272kO,\021\234\353;s\353u\226e;k0{o\222>Yk\253P\2354l5m\244a\253\354\316\f!\302\262\361n\360\337\333\212\341\273\327\331\200\255\326Vy\311\334G\t\307ej\335\355a\343\"x\357=>\223^6\221\261\310\256\304\241\232\276/\271\241\315\266\2751\233(*\t\234\2216v\022\270\"],R\347&\347l\003\272\031\201vT\235\033\021_\2034\261\3706\244\207l\355\327t\265\323\342:M\221\210\214\261c\364\266\2262\2603E\316\370\206\303?m\232\023\247J\373u\024\240[\\*e\004\211\230\206\266\357xSs'r\335{\331\333\336\340\232\213\232\231\3150\263\024\34650}\342\371\247\246IE\315\337"
+	.string	"y\254\371F\033>x%\037\205H\002\315\321\263\346\204\354\177|\007\237\016jR9jv3\354\367\357f\235\232G\031\353\373\207rs\201\317;^\n\323<\312\354d\372\3231\367G\243\321(\377\022\346\352/\315\026:Ls\205\306\353\246\340\316\023\232\257YB\3675oi\365\231\346\254\356\322\375\240\3134;\350\275\356c;\273\261\334\371\312\235\255zL\363\002wV\340\316U\356\234\200u\246rg\004\254\363\224;K\271s\224;C\261\316O\356\354\344\316M\356|\200uf*:\033`\235\227Vg\245\325\271\200;\023p\347$w\036\300:#\271\263"
+	.string	"\3269\200;\037\2713"
+	.ascii	"w6b\235\213\334\231\310\235\215\356\\d\235\331\242\363\312:\023"
+	.ascii	"W\347\341\352\254\272sJtv\242scpR\363\234\263w\307\347\3578\357"
+	.ascii	"\217\250\241+G5\003\245\371\272\373\272\317t\177\351\016\323"
+	.ascii	"=\246\003\023\336\352w0O\271\325\257O\364G/\340\007<\326s\003"
+	.ascii	"Z\336\021\221\370\271\322\342\335\333\354\266e\336\332\354\270"
+	.ascii	"\252V\223\236\3003/\263\\\360n\343\364\316=\223)<\001\255OB\372"
+	.ascii	"\001}\340L }\212v/\300\013\310\320{\272\002\374\214\226\213\235"
+	.ascii	"^\332\235\006\360Gm\247\215\036@\321\033mh=y\212\270\f\352\021"
+	.ascii	"\327\214O\324l\227\232\321\f\213o\374\207\323\254c\277\370\315"
+	.ascii	"\241\353t\035\233\260\207\246\363\241\325*<\3547^\333\305N\017"
+	.ascii	"D\003\212X\177F\333e0%\022\177\302\023\225\374E\331\230D\313"
+	.ascii	"\351\372[\3720A\374\216k\275t\023\216/o\030\247%\374\367\371"
+	.ascii	"\211>;K\037\036\017\365\351\330\244g\303\255\177-~\n=\221|(\341"
+	.ascii	"\033\b\212~3\374\0264W8\210\344\3523\253X\341\335\266\3655\216"
+	.ascii	"\254=\223\231Y4\033\344z\357\332\026\267\232e\\r\275\367\266"
+	.ascii	"\223V\325\3576s\205vzW\235\276\326\373!63E\336h:\353\035<\363"
+	.ascii	"\013\245w[\372\317\027\030(\247\371L\366\177\360Y\337~\001|F"
+	.ascii	"\005E\343\f\271\224D\206\025\223\310\260\327P\006\206<\223\361"
+	.ascii	"UDc\254\305\217\225\360\372\202!\246\004[A\230\201\235!]|y=\225"
+	.ascii	")\275\304\3062\210\215)\315\2203\224f\311\013_^caJ\312\206Q\206"
+	.ascii	"\004\021#\354\314k\345$\226\022,y\374J\"]\220}\231\211)\217b"
+	.ascii	"Jd\3301IVv\304b\342\261\030_dG\263\2611\262\243\321y;\275\277"
+	.ascii	"\204W\302?9i\257F\304^\265W\336\034\033\264\310\365WWo\340\235"
+	.ascii	"^\352\021|\202\252W`E\301\202\257\242\372\004\336\\\243\372\021"
+	.ascii	"-tp\352\021\370Z\327\324\217h\375\354\242^\n\352\243\236\036"
+	.ascii	"j\203\2479\363\311o\260\351\235\016|\323\373!\246?\020\355\242"
+	.ascii	"\302S\350\324\204\351[H\213\306Pk\340G\264h\214K\317\365C%y\374"
+	.ascii	"\020\336\245o\2676\r\341\237>\302\242\205\2517A\201ng\n\221>"
+	.ascii	"\366\351\270\375\232\305\273+\304\006M\265\336\353N\220\r\352"
+	.ascii	"\334e\303\005\277\243"
+	.string	"\302?SP %\013o\203P\253\364\255\327\222)P\341e\004j\223\005\276\241\255Ri\311pz\357\275\353\323\261\253Wmv\027e\203\016\003\200\245\250a(g\225b\204FD$(H\222$\035\300\002\221\251\342<\021\340$U\322\331HR\322\254\001vf\031\236\026]?r\373AJg\315}%:k.\254et\323\301<#\250\214\300&\363\227\033\317\002\304j\206b\223\013\200\312\366\261\274l\310\327\2116\"\335\213LkV\"\001m\315\212L\267\221\003R\242\252\233\343\307\"F\1776\355\265qc\361\263%_\300E\314\026r\222yj0\375\305\2741(\036\2470\241N\0010C\006\200D&\322\256\001\272\272l\255\271P\260\263\322\030\007\250\203\247e\226\b\322\0328u>\031',6\224\362\305\264p]y8)7\333V:\247\224\024\241J\324\257\001\243\242yY\215\242\002s~\034L-dA\034\206\005\247"
+	.string	"\214\341b\321d\270:\nBz\036W\004\316TN\333\377?\300\276\220!\330i\262B\220\246\315Zj\362\224\021\351\367\323A\005L\201\027\036\211^$"
+	.string	"\013/\204\350\277V\f[6\bmw\250\002YI(M8\325\356\340"
+	.ascii	"\243@tA\\j\200\373\266\341+\225Q\021\330#M\235S\246K\235\347"
+	.ascii	"\261p2\335\251\021m\340=\233+i\371_\b&t\213\246\217\032"
+	.text
+	.section	.gnu.lto_printAux.243.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\227\001\255\017"
+	.string	"6]iF"
+	.string	"\221(\035\373\250\247\334\203l\027\313\033\200\246\307\370\343|\354\006\3732\360mc\340\034\b\004_\316\266\306\243\006\252\210\361l\016|{^\265u\377\377\3740\354\004\235zA>P\272\234;9g\255\332>\331D\356\224\002S"
+	.string	"T"
+	.string	"Q"
+	.string	"\343\002'\330|:\264exV\233r\240r\202\325\"\263\273\235\2160\307\267\361\336d(C_\366\315E\253\265\304\324\347\246+\031\020\001\304\325\006a\206\365\342\263\313\022Q%7\023'\327\317>]\264\230\226xr\251\211\260\273\226-\321\344\346n\033\264M\262O\"\342i-v=\324l,\314d\001\273\313\355\253\360g\356\370-_\021\336E\344k\262\347PB%FcwT\360\351\321\346\263c{\307fi\351PA\245\375\225\243\b?b\360\fX\022\331\207\006\343\rp\237\233\027\340>-\245\315\340A\370X\006\353.\312\312\313n\337vw7}]\204\223\312Q\002.h1\032PT\262f\215\324(\247R\257\366\t%\337r\007KS\236z\375\354\024\\\264\031\254\033#\262\246\032\363\262\022B\365e\217)\351\201\245\200\261\212\2609g\3715\037\177\356\261\177\336\345\226R\372"
+	.string	"\004\300b\004\336?\300\021\352\003\"\n!8y\241\3227\241\364y\340\347\202\007\202$\210B\037\311c\341\364\371\b!\241B\033\203<\274\021\250\023\201> &\021X\362\272\222\367!u \323\251\3638\340/Dd\352\300\3573u\235q/\3737\314\324`FT5\365eN\212rt\246H\227p\274\206\f\006\211\234\t\" \200\002*\263\036c\205\005e\023^\r\",\006X\020\020C\352\275c\301\230"
+	.ascii	"k\316`y\226\262\020\\Y\271\365\216\317\255\030\223\263\3455\231"
+	.ascii	",7\366\016\355r\261a\200\202e\304W\361\362e2.\334\243\266$6\343"
+	.ascii	"\001\0221]\342\t"
+	.text
+	.section	.gnu.lto_cliAux.244.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\f\001\225\r"
+	.string	"\266\331]E"
+	.string	"\2216\035\360K0B6\235\320h\266\270\200`\032"
+	.string	"@\rp\332f0ns\027\340g\317"
+	.string	"+F\263\377R\233\301PS\364`\001\006\211\003\210@K\202\326\377\375\223Y T}\232\334\312m\203f\333\336{\247\024I"
+	.string	"G"
+	.string	"K"
+	.ascii	"\234\033\250N\315\3314\016\240,\210\001\213\213\01707v\267\312"
+	.ascii	"\023\347N\247\214\234\177\227wt\037\350\224\223\362\t\340K\271"
+	.ascii	"\234\037\250\0276"
+	.string	"\004|\243\351\341\245\350\356\362\b\342\023\305\270q\260\273\216\335'\342\256n;\202m\b\366\257\247\024j$A6(\212\322\204}\031\206ahI\262\337\362S\031\375\r7\302\013\361}\306\314\256\027\346\330\023\205Q2\207\203^@BF\347\035\333\217\366W\316\302\275\245\303\t\354\222V\230vA\005\376\340\234\032\274Gu\032\267\252\277\\\346\2225TvC\357\376b\203<\206BG\311SA\263\262\273\r`\336\002\363Q\234\332BF\375\254:\005\271\255a\210\357|\031\034%N\036\256R\2032Io\250.'\260\240\031\305\032W\221J;\203\206\370\3562@L\214\256\3401\271F\264,\304\332\252E\202\340\372`%#\231\265\261\345\301J\254zY\"$\333u\362\301\352\007\023\311\252\265\231TO\002k\027\256\255\236h\332V;`\350s%\311\017R\246\024*$Esw\227\026\220\020\022\337y\306\031\024\2574\007D\007\026"
+	.ascii	"q\224\301\231\320l\024\243\363\202\203+\241\355N\2140\220\245"
+	.ascii	"e\350g\263\351\201W\003^X\367\326\013\353\321\005\313\216E\007"
+	.ascii	"[kVM\217\223\274\363\312\246&\327\270\024\024"
+	.text
+	.section	.gnu.lto_printSerial.245.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\327\t\235,"
+	.string	"\212M\030\021BPdN:\023Kv\211\nu\321\221ce1\346\315d\204\200\241QJ\2126|\345w\314\343\227\315\351\005\001\343\254\331\200\025\024\002\330"
+	.string	"AE\302\325\002d\321V\\\325S\2523\250L\033\331F\210\224I\006\370"
+	.string	"\344"
+	.string	"\b\001{\277\336w\357e\377eO,\n\311\254iB\270D\177\350\n\255H\177\267\357\262\304\243{\274\347\035\257\227\343U\255\376G\224e\233?\2652\037\034\335\024\351\321\250\363\304].a64\357\276\356\313\343\231:\234"
+	.ascii	"T2\273\037\025\230_\n\036M\257\024<\272\314\273\024\262\216\247"
+	.ascii	"\333\261]+\233\2271\2652#\254\203\364\350\036w\3738\365\250H"
+	.ascii	"\254%\237\031^\241Z\253U;\331\364'\363;\344\343\213\206\2510"
+	.ascii	"\210\236\315\307\275\335\245\344\360\354\360\354)\221/:\205h"
+	.ascii	"A\356"
+	.string	"\274N\220#\347\205??G\336\345|\246\034\343a\0235#O\205D\036<\241\372\342\\AR\232\235RI\226|!*\313\030\r[\276\371{S+\362\363t\360\207\314 \242\262\307\271\224&%\371/g4%\031\367\273\034\205K4\206\256\371\246f\344,\334Pk]N*\325\276\304\357\256\227\335E\356\016\221\001A\356/\273<dlh\225\370\275\333\302\005?\311\215\301\215\254\221\273\013\343c\212\277\223\223r>c\006\277Z\311.l]\214\214\264V2\013a\216o\\XrQ\216\356u\364\277\374\254\202\004\334\303\266\245\216\007\007\266\036Z\223Lw\334.\023\311\027\376\312\250l3\331\315:\335O\341\352\\\376\tg\376\022\276\367mp\275/\003\346\255b^\252 \357\024\363.(\342U0\344\225b\336\004)o\324\220\027\001\363\036Hy\241\206\274O\314k \345-0\344%\300\274N)o\023\36321\357R\220w"
+	.string	"\363*\025\361\n\030\362\006`^"
+	.string	")o\322\220\027\211y\217R^\243!/\221y\213R\336\341\2207e^a\312\033d^T\310{\ny\033\345\345 \357-0\300\263\353\273[\256i<\314\232\026\210\250\316A\313Ly\035\240\225z@/\223\035\257\b\227"
+	.string	"\332a\243\253\265\354\311#\226\264L\253\352\350R3\365\356q\356\250\205\237\334\263&i\344Rh\246\253^\202\301\310\"\327\300\001\002Z\251\205p\200|\307-Ot\\Z@d\304:D%\240\277\246MP\363\305\233\205\002$5"
+	.ascii	"\016\037$(P\322\234\326\001\375!\031\365\221\207\373\351\303"
+	.ascii	"\307hPs\306\365\344!\016\273\b\304\375\360\334\031\316\325\361"
+	.ascii	"\340\300\033\267\023\"\335\327y\337\210\223D\211\340\223%\032"
+	.ascii	"\352I\231`\013\373f\200{\342sPh\220c\304\020\307*\330G\324F\250"
+	.ascii	"Y\367\340h_u\3031+3\306\201\313\304F_7\301\356\263wU\260\340"
+	.ascii	"'\321\336\341V\36668\250\374\330\0305\254\311:\373\344\223\\"
+	.ascii	"{\032\034\317\223\253\225\354I4\306\3379\303\306\3657\335\306"
+	.ascii	"1@\275\344\332\341z\364\345\005;\016\314't\022!:\177}Le\220\237"
+	.ascii	"\036z\262\325~\373\327\212(\317\316\216[\261\333\2455\025\005"
+	.ascii	"\005\326U\024\303\261u\304\365\260.\261b\214\255\017J2\270b\330"
+	.ascii	"\360\362\320U\344\372\332\0023\242\001V,q\243\206\230V\272F\t"
+	.ascii	"\\]"
+	.string	"F\253-c1\306\327V\230\r.+\033\\\305\032V\306/0+\t\006\326\353\306\326\227U\230\227\327\227\025\221Yo\367tOI\245\371\207G\217\025u\334\016\241\244Y\215f\341=;\240\263\326Z\207\035\367\034A\006\235\325B\332\370\214\341\311c\033\343@6\223v\334~\317\322\317\214/x\325a\3138f|\350\313\274A\237\021\350\247F\320R\275\240\247\250\272\252JU\203\246\222+:i2\225\250\251\240\027t\020.P\r39.!\300\031\253\336\236\374\024\364\255\264\001\036\351\330\255M*\252\023p`%I\220D\0016;\260\221\"\b\240\372\200\007^\033\"\004jN\004\253)\237\n\264\001\020\234\206\006\244@?M[\240\t>\343$\201njj'\366\201\"\313\217\315\214Xr\\6\345\327\324GV\356\334\330\266\b\2518mb#\005\200\266\250aHe\rB3\"\"\022$I\2224\006\360\002\221\031\342\346\021"
+	.string	"-3\316\230\022\263\220\335\213\250\264S\0233PK\0170\rxc\330%\200\031\330L\\\206\263\276)\271"
+	.string	"U\260+\301\234\225\353M%\244s\022LS\266\217\257\247\375\341\006\374Ri\363\266\035-\315\322.\211"
+	.ascii	"e\233\214\372\332i\223\234\325\001A`\200^\344-\031\361\267\211"
+	.ascii	"\306\330I\3332e\017b\306\334\245-I\241\247Fe\203\257\306\360"
+	.ascii	"{\215pP$*K\311Op\224\212\361\352\214vM\353\021\246\204\312;u"
+	.ascii	"\211z\227\026\360\332\224s\314\376\337#rl\202\271O\3312\205>"
+	.ascii	"t\302\334\245\330\262\261\267IT\217\261O[2.\0030\314\3236\322"
+	.ascii	"\356o\233\364\017\273]\2304<,l]\376\376\030<\272\212^v\020<\304"
+	.ascii	"b[\266\227\277\307c8\377\020\003\363\033j\257\337\353\002u\356"
+	.ascii	"C\317n\260\n\341\300\347\020\"\241\267Z\3440\200a\333\303,\020"
+	.ascii	"(\317\330\034<\353\004\355Z4\201\340\346K\201\252\004=\251`["
+	.ascii	"H\031\326f\347\273\033\3158i\216/\240\3719\200\037\373~\031j"
+	.ascii	"0\210\321 i\032\363N\316 4\370\352\031\261\021\372\251S\030\f"
+	.ascii	"\377"
+	.text
+	.section	.gnu.lto_cliSerial.246.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\203\r\035E"
+	.ascii	"\372vd\032B@\236N:kX\f\001O\217\201]Vk\315\261\006\005\224\300"
+	.ascii	"\324\243#\036\376{\323\266\210t\t\303\217U\355\375\375\261,]"
+	.ascii	"\223D\274\213\0047'9\254\266"
+	.string	"\212v`\223.\317\203\231\353\356nM\032\331;\311\227\001y\001\227\0015\302\220X\361-\215\333\362\324P\351r\316\313{\274\353\235\357}\007\354\245\337\265D\377\027\366\334\226\223\205W\037\2109\257\201(d\336\250\315\322B\315\025\356\002\002\005\321\357\211=\237e\027w\256sVy0\206\262a>\233\334\325\bb\316w\013\220w\277\022=\226\366\002ev\227\331Z\253\264\r]\201\033\033\001\362F(\366\267\373t\257\213\336.\306\211r\226\253\013\314\371\316@K!o\354\2737\333\033\2217jo\354h\267\234\244\031y,\3015\rMoO\316\371\211\2074{\366\356\275t\243w>951-)%!\0355\001\030\025\021\r\t\005\0011\227\312$\362\330\032Y|\243}%\333\330\235O\3256+w\322\032$B\247\351\206kut\227\211e\032\256Ua\253\256owIH\033\225+%\271!\r\246\035)Ir\233\203R"
+	.ascii	"\213FG\214\334\"?D\211CsM\326\210\\!\260\253\034:\3256)\017:"
+	.ascii	"^\311]\341\320\251\266M9\020+\205x\315s\3035*\333TK\"}\227\037"
+	.ascii	"\227Y\004\256\035\3129\277\272\346\243\035ZC\302.{(Y\007]t\250"
+	.ascii	"\275\313\243\f\327x\260\327\210\033:\277>\252\311Z\225\233\274"
+	.ascii	"T\216\214\252\266\271\375x\30357\264\333\352\270\2215z\373[\023"
+	.ascii	"\304v\306N\255q\302c\3116\343\262\255\225F ]b\265\315\356\230"
+	.ascii	"\225\242\226\301\021\304f\3066\321\304\3059\340\357\224\255\354"
+	.ascii	"\336\343U\316\271\257\224\255\355\r\365\356k\241\273\215t/sx"
+	.ascii	"\n\243\255\322#\340RE\211N\271\227V\341\213\251&\026\232\265"
+	.ascii	"O\334\035\255r\300h]\263M\316y\201\f\"e\246\270\221\335\3052"
+	.ascii	"rE|\030[\264\0070&\323\263\002u\237\270\033B\204{\351\001|\335"
+	.ascii	"T\315"
+	.string	"\024:I\230p/}b\250\003\237\302T\370x(\235s\366\244\354.\366\322e\276\311\264\005\376-\007l\021DD\332}\001\303\365\273\021\230\210\370\2627\205\210,\322\355oh\317\345d>\334\246`\036\236\034\272\234\311\304|\f\207\376\221\033\333\303\007c\377C{\343\324\273A\210\270\227\366\373\252N\n\317\032\017\017Z\020\214\255\255\242=\036\201\367\306\354\362\351\241;\205\273\261\262\356\245\307\007<\205\033y\017\242\031\036\353\276+\273\330\332\375\363\021\266ak,\327}\365\340\203o\253\006\f\026$\250z\226\367\201cy?\251n\367O)oK\005\210\202r>=\357\355\324\004t\233iy{\ty[)y;iy\033\211y\373(y\273\271\274\r\200y\333(y\273hy\233\210y{(y[hy;\210y\033\210y{\311\274\255d\336N~\357\215L\336>.o\267\312\333\306\344m\366\201o\214\274}\217\267/\201"
+	.string	"aY\232\274\253\r\314\346.\253-\372\311\205FA%\037\374\003\177,\177\336\277\367g\371\377~\354~\367\005\373]z9(&w%c\342[\372\327^\006\036\365\002W\311\211\037\340\240\3037\302\250\253\254\346\332\0061\337e\002\277\"\031\263\037I=\354\346\370\220\216\200.\326.\025\227\030i\206\033\233\304\277O\310\216\346\217\300\271<"
+	.string	"F\330\332F#\031_\237<}\212\340\376\020\r\261\027k\225}n\205\225\370\350P\215\357\316\337\027G(d\025\344\200bHO\210\344I|\360\005\rZ\020\266R3\256\336\231d\317\f\020\266\366\362bm\022\277\212w\306\354\362\021k\255p\022\037\035\332"
+	.string	"sF-\253\363\307\t\026\216\335?\335\2043\206\250a\362i\252\301\251\236\376\236\373\366\322\336\370\007O\033\230\263$\003\311\004\354t\267\034d\316c\247\376@\362\325\315\222\2343\201\033\243\360\373\342\256\2053\256\342\365\223\003nm\211\255}\304,\206BO'\032\207\314\331\254A\177\316\021\243V6:$:\327F\347\332\033\2178)\210\333\nzil\276\370\023\255\021K\341\276hnFl\205/ \232\242\324e\221D\225\334K\215\030\252\001fq\2215\215\220A\003\374\3048'R@;{\224\330zx\006\030c\331\213\202\347\006\212\001~\227\023%\306\275\341\267\2775L\222\330\332\367\372\253I\337\354\216\005\216\361\364\266UO\363\333\261\345X\205\235\360\264\331\266\t\337\343\002\034"
+	.string	"O\373Hle\363&\274"
+	.string	"\007\035\326\340;\243^&\007\214:\271\264N\002|q\221u\272\210\246\350t\253\022\340'V\377\024\232\341\261#\266\266\223\337\016\252\361\027k\203\374rP\331\276X\333\024\335\245%"
+	.string	"\312\251MPuaqA\267V<\277\220\\liyM\330\002\303\322\240\025\2065\002\210\353\320\257\024\312\022\\$\274\240\320\260, 0\257\260\257\b`^[(\302J@!hqua\261(\202\202\245\300]X,\360\226\027W\227\026\212\254cgQque=\267\262\260H@\267\300\274\270\236^\\X(\236Y\320\025O*\246\376J\261\005}\202}}A\237\313;\262\033\277\"\303e\277\341\304mym\250uG<C\027\346)\214\315\271\372\340\177?\"\226\273\330\016\256\020.\302M\234\204\2270\023\356K\215\242\035\253ytg\227Fi \317nc\300\215\005^\340\335\321i4m\214\0325\373\300c\315\204\215M"
+	.string	"\245P\353\354\224\360\022V\316}\301c\303\247\250\204;\314\201I\314p\337\334\222\2160R\220\243)\035n\016\034M#\f"
+	.string	"\316\b\277\230+\223\030\342\262\255\025\ra\242\037C\370\305\234\231)#n\332\255!\204\233s\202@8\b\037M\021\t\204\217\202\200q\250uvdw\261\033\334\023:]z\200-z\343^\332\004\204\200\0013f\244\212\223\202\333\035\335\021}\273\200'\352\023b\245\260\f\217M\271\201\022\245i\311\211[\231tb\344\315G\006 \373\353\203g\246\016\023\2666\234\364\315N\351\n\343(<U\363{\333\242\304"
+	.string	"7\322\tC\341i+=\341f\221\001\260\023O\243\004\324\331S\362\237\3159\347%#'\356#'n\026\310\371\037~N\354\222\036\340f\207\234\370\tO\273\247\036\205\257\360\257\307\240W\2030\201\r\250a<\343\024cdfDDD\222$I\007\201\005\004!\007\341\325\003\021P\255S\222\324HS(,\007w\220\315\256c\357W\356c\177\016\001M\311\343v\354\243\332\033t+\033\305lJB\035\263\030"
+	.ascii	"z\212>=*\345\315\234\031k\301}$\241\340\fx\302\356\">\217:\366"
+	.ascii	"\026\333\256\244S\307\272\366\026:\315\036\3057b\234d\370\320"
+	.ascii	"\316B(\026\343\341oz\235\270'\260\214\337m\371\307\224\267\022"
+	.ascii	"\224\006\337<\341\221\254\204 \026\024\330\277\004\335A#!d3\204"
+	.ascii	"\336\022\017\303\b\215\354\351\275\214J4\240\223G\377\310H\320"
+	.ascii	"<\321F\214ca\b\002?\343\304*\013\310X-\321\315\375\372\366J\006"
+	.ascii	"\325\352\267y\302\340&\276\211\363T\312\342\304\322\t\306\223"
+	.ascii	"o\257_\337^\325\313\312\373\272\333\371\020@c\021\007\301\017"
+	.ascii	"ab8\005\374\371\027\323\3466#i'\3471\345\004\335\312\225\246"
+	.ascii	"P\353\313\326~d{\333A\007%\355\203\344'W\254\205@j\027?\376\305"
+	.ascii	"\307\375\342b\nM\001\302\204)\331\n2\222O4\306\207\3053\276\f"
+	.ascii	"%\355pg\357\0346q\353\310\362\254\235\327Q\t\371Z\326\360U\265"
+	.ascii	"\331\240\210z\220\307\250X\226\343]{\221\325\241\336R\214\025"
+	.ascii	"O\355U]8\244\237u`^r0|s\371\004\3134\342\253\322\227\260?N\220"
+	.ascii	"\036\311\337\236H\031F|\277\r.?%mM\036\\Z\022\365=\344\027\023"
+	.ascii	"\213\357\020\304\210\310\340\367\032c\364aS\217\225JHV\236@\331"
+	.ascii	"S\212\3630U\210SE\022h\277 x9\026\004\270.~6f`\211Rj\232\177"
+	.ascii	"\345!\225\313\322\f\303$\025\275\320c\001p(\177\277\3049\rs\254"
+	.ascii	"\001\342n\276\262\303\265#Y\351|gb\023i\317\236\252fs\026\272"
+	.ascii	"lU=\266iR\251\275H>\224\314#\216\314\002\375e\016\214S\270\037"
+	.ascii	"\303\251\032\r\224\n\230\241\374\030\364\233\016\345\017"
+	.text
+	.section	.gnu.lto_cbCtrlLine.247.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"%\f"
+	.string	"\226XU@ o\233\016p,\260\035b\016\013\034\372`L\315GD\361"
+	.string	"00x9\351\036\025\364\366\267\347\370o\315\241;4F\007\247\b\241"
+	.string	"\003P\210@.BmF\274\357\370\003\221_{m\333[\312\224\002B"
+	.string	"D"
+	.string	"?"
+	.string	"\377\300\035\344\026\027\260\373\001\225\330\355\030XA<t\367\002\322a\374"
+	.string	"\351\320\234\355\302\200f1\016JDlHd\354.\245\"\347\236\234\177\321'\016\b\346I\211\260\273N\016H\347\326\333F`\033\202\375K\252\351|\351\003 "
+	.string	"\203E\347\036\024\273\030F3\326\004\232\350\360\320o\377\"W\374\020'\341\036\362\211og\177!E\311\210\027\273\273\340\320\017\342\241\345\331\332\035\004\367\021\017\303]\016+\032\304\303"
+	.string	"\371\264\357!\2364\365\242\303\020O\214\315I&\201\024uRJ\206{HP\243:7\032>r\344\353\323\223P\275V4\036\025\233\223L\216\354\016\223\032b\377\355\356Z?6LO0\035?\362\303\207\356w\320\037\332&!\273\260\353\0229\264\255z\233\005k\303\262\212\342J\343\342\250(\253\332\230\240Y\033vQ\330\265A\201\252\264\016J\343\200\263\213\245Q[\226iT\245\333\277\325\217'\221\r&\031\375p\314\324\247v\205\216<\307\026\215b\002\021"
+	.ascii	"3\241\351(F\212/J\314\213g\266;&\006\210k\"\305\034\001\316\036"
+	.ascii	"\264\353\024\016L\331\337\324(\270LN\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.248.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\314\022\215]"
+	.string	"\n\233\350\"Q0\220J\352[\250\031\016#\201`\025&\356\0277G\300]#\220\017=&\336\330\253.y20\206\207\314m\006\344\2602(\310\261\013\3252\2722\036\020\204A%\205x\240\222O\235\215\351\3033\221z\f\270\342\\\237\231\217e^"
+	.string	",\267m\262\223L)\037\002\371\001\025\002\356p\356P\334\243\270\257\333\335\005G\342J\234\211\307\340N\374\315\343\\\352\323\256\211\002\306\006\024\252^\0220\257!"
+	.string	"\001\257\303\305X\263W\376.`S\324\212\344\034\215\361\244\247\\\244b\350r\316QM\220<oe\027\241\214\324\006\272\234\243O\255\033\r\023V\"\240\220\226\t\2223\\\261]B\343\031Fj\227\301\013\236\344u\030z\352\326\210f-\026\032\226+h\235\347\256\036d\333f\340\344\271\354Z>\246itMQ\020\326\354\025\315[\300\25338\26529G\225\234\327\002t;\356v5_{\375\b\r\317\311\231l\n\\\316Q\021\235\324:\257\243.d\235\327z\220u^\277\335c|\256\362\222\204\264J3I\231\2343\323\363\350^\265Z\255\372\032\365\306\301\257/\211 *%\205@:\002a\024\300\007"
+	.string	"\212\\\242!\241a\020\320\217O\017\217p'\250\223\203s\003\374\331\324\370h\332\036\313[\037\277\355>\255\245/\211\020\333\222\301\211W\\\351\212\025\234T\305C\254Itq;\370\334\263\312*\314BsR\301Hx\212\0379q\020^5\305\215\234<\301\0014\361\017\253k\205\332$\"\013\263\363!\317\0300"
+	.string	"M\334p\221\313\304\211\226\260\341!\241\236\t\261\2557\037\256\251\341 \336\0178\2654\240\365\200+hT|\356ide\307\342x\264\200\177\322\334'\255\b\356\001\342<@\320\260\360\310\316\334\323\307\017\034<s\235\271\347\331\352\016y\232\341\234\265w\225\205\346s\317\036\253\001f\350\240\\a\234\024\266\312\374f\235\352\020\002\374\205\331\2340\365\242!O\035\270\246Hl\353\313}_4k0G\023/>\367\314\261\022\207<M\300-\013,!=\237z\023\264,\032\346,\230\213=\275\232>-&k\343\205\210\t]$\366\f\343\361\272\204Q\313|e\241:\350\324\354\304\266\260\370\257I`Wp"
+	.string	"\265j\254B-ca|\352\030K\313\n\343\236\211\234sc\247\326\2267\223w\277\261\333\273\272\201I\002\357vfR*\363\227Mt\242\177\340{I\314\2240\301\034\213;>\203\302\315\211\177\027\314\322\274\260"
+	.ascii	"\304\216\304\002=\212\257I\322C\311\217%\363\305\376z\203Y\030"
+	.ascii	"\325\346\241\335\345\214\033\343k\372^i\206\017\364X\274\034"
+	.ascii	"\272xa\324\253_\326<\324\221\330\3417}M\22222M\034V\270\332\r"
+	.ascii	"\205L\033\325\367P1\276>F\243\273\261\276\353\330q\365K\357\350"
+	.ascii	"\322\203\316\336\344h\036\332N\203\375w1\242"
+	.string	"0\f\264\016\264L\317:r^S\n\354\316\177\314\304\354\213z\265%G\213?\305\343i\363\256\nW\361c-f\\Z\334\231\230\335\350\001\341\241\357^\001\001v\247\212\307q<\252T\317\342\316\243\007\352\022\237i+Z*\354`\037:C/}qi\357\202\275\247\254\363F\230k\021S\033A\362\016j\023{L\233\363\322\301vd\351]\220\234s\b\227\241\273\307\270\203\265e\371\231\2439\204\363\210\336\306\215\r\316\216\216\211\357^\211\224+-^\017v9\217a\202\235/N\227s+,\214\276\344\314tg\005-\323G8r\336\005\030`w\216\370\0357\266\247\035\035\323\20023\3245\007wkP\304\356lg\302\303\b\325JhYe\310w\f\326\277\005\022\032j`3\r\304I\337}t\201\335\351\357S\367\021\334\214D\355\350j\374\262;\272\304\017\235\232Mo\364\223u\257x@E\n\024M'J\220\360\250\367"
+	.ascii	"#\210J~\304=\311\333\274]\207\301\233\310\227x\017\t\r\203\274"
+	.ascii	"\2117\320\217?\361\366q8\357\036\036\341N\320\243x\353<\356\234"
+	.ascii	"\307\215S\203\373\306\207\033\310\342\376=n\033\032\3345\016"
+	.ascii	"\305\333\327\342\246\351\341n\037w\317q\263\216\233\347\270W"
+	.ascii	"\307\375,n\274\342\366\b\034\315LV\t[\256#K\316Y\325\0362\225"
+	.ascii	"\007\005\210G\335\333\334ap_\342\356\346\336\304\375IJ\312\332"
+	.ascii	"O:C\305-\201}\337\263\361b\325Q\257|_/\tY-\323\353n\370y\361"
+	.ascii	"\272#zh\177\233\024\266\240&B\316\fy\275]=_\260\304\t\031a\036"
+	.ascii	"\256W\253\347F\313t60gk6vvk\303\207~\233\034\031$?u8\230\tj\002"
+	.ascii	"\260\313\341\255\267K\250,G\313\364\036_\257\016\240\233\225"
+	.ascii	"'\3762\265\003z(M\331\324\255\371\346\363\216\304\366\332C|\241"
+	.ascii	"\307\3026\274\304\017\271VX\326m\0013\002\267\277(\260B\317\363"
+	.ascii	"L\336\376\216\261\355/\224\345\361\366\300\356,\361\bp\021Q\313"
+	.ascii	"&\374\362\307\347\311Z\312\030\236o\313N\305\366*\364=\317cu"
+	.ascii	"v\342c9(\0220=\017\005\242\221\265\300\363dC. \303+Kr\020\316"
+	.ascii	"`{\357wH\316\260\b3\332\234s\001\215\231\257\327\373\243\365"
+	.ascii	"\341\274\336\377\346\246a\300\326\216T\341\352\321\nb_v\212L"
+	.ascii	"\1774\337t\334c\260Fi\r\315\267\034\227\342=\217\325 \260\003"
+	.ascii	"\374WMm@\202\204I|\367+\344%\202\3359\300\363\354\314t0\302$"
+	.ascii	"\336\345\260\325\313\302\315\2277\255ez\330\321k\344]\233\272"
+	.ascii	"\317MJ\266\243\273\372e\360\241=\304\261VD\007g\370\304\237W"
+	.ascii	"z\254\306\021\276\017'\370$\252\356{\037\256\263e\335\02605\260"
+	.ascii	"\031\272\234\207\266\214iY\363\355\346\2017J\315\020=V\b\323"
+	.ascii	"\036\315\267\233\0258\334\330\300\326\021?\024t\267\266O\313"
+	.ascii	"E*\246\371\266*\371\317N\226s\rmm\247b\2057:o\224\202i\276\255"
+	.ascii	"K\036\034\3722\034\325e\335\2265\347\234ql\200\276W\340\360\245"
+	.ascii	"%\374P|\367\206\337\354\360\2337\374\240\307\352\325\346\347"
+	.ascii	"\004\247\364\t\360\304\367\357\347\273\367\363\315\376|\363~"
+	.ascii	"\336G\370\r\024~\257?\241\212\270\024z)\276Y\3417O\370;\217\325"
+	.ascii	"6\301o`\360\373\027\374^{\301\347r\262\335\261*\276W^\360u\036"
+	.ascii	"+\0040\037gXx\016`>^6vE\2754\365$\343x\204r\232\341\344&\217"
+	.ascii	"1\220R.\321E\324\2231Y\214\221D\236(\352%\243\273\300\004,\334"
+	.ascii	"\344\361"
+	.string	"\003\244;UL\272\037\220S/\220\311\r\\\343\321ET\221\003'\367hD\256\030\n\352\237\317E\324\323\324\324\021\206K\234a,\036\223P\305\017\302\366\375\226\214Fn\002\256;\005EU\334\340ht\211B\275d<F\035\245\220\356\261\205;\205\214r\215PTH'a\273F#\227\246-\240\340[\306\324\267\005\022|\313H~\273\330\370\204\215T\305\026k\013\006\214T\305\005\216P-\212QG\233\344T\003\310\247\250'\251\366hD\276X\223SR\307\017\2120z\036 \247^\306\321\030\365\304\2739\272(\302`1\225DF\300\201\013*d\222\003\n`\300(J\355\034\243\236\240\214/\234z\355\264\364\004\345\304tt*n\220<NE=1E=\025_09%a0-\0055R\352\230d\232B\"\223L5\321\354O\326&\252\336\312\307\226~\353I\031\2605'\242!\210\017\0214\326\234\305\024\240k\303\325\266"
+	.string	"\343#\336\256\214c\335\317\221*\247M\265\234\367\235\311\220F\244"
+	.ascii	"\337"
+	.string	"\274\313)\251(\255\340`Qf)\202\3634^\300\277yw\362{\340\367\3164\357\226\\\351\177\337A\027#J\017m%W\372\257\302\302\266\202R\213P\271\245e\342\035B\240IIZ\201\335w\2716\347*w\332\314\240\004\303\304A\260\220\031\355>ZY\203R\fv\247R\f\353<\233\027\340,J\232W\025\256\242\275$\364\224a(hF\2509R2UBp\231\326\320|3\352\275\207\231:i\276\035\225x\367\261\252\256\324\021\020%#\203t\364\320\263wl\310\207\234))\223C\025\256\006\313\344\272@<\324\b\223\3405\237\264\001\367x\307j^\306\231\222\264"
+	.string	"\2320QY\247\324\001\355\006\361iRP\222Q\332\265LL\244\312f)[\373\360P\342\323\274\233!i%\017xLy\246\245y\020="
+	.string	"xh\363P\324\242\240\254.[&\356r\257\372\265\302`T\300/N\251\367\312\003\201\203\250\201,#\025ChfDDD\222$I\007a\005\304 (\335\235\007\02105T\254f\264Ie9'\304\304wu\250c\277\004\357\006R\331z ;\363\252\217\017\351\3444\212\200\2133\242C\355'\345\005T\0031%\216\325\211\n\"\333\342\225l\271\007\220k\233\344\242N\246@\233\b\007Q6Y\325D\243\241D\324\323\304\024\257\371\245G\242\031Sf\304\b\366\313>\354\001\022\371F\021[\266u\006si\266S\303\004\002\3439\351\2239n\303\213\206q\234\372\354T\214\027\035\321\366\225\032\203\003\240\f\001\243\364#I\2421\247}\216\354&\270\270X\233\005\335\020F\267\033&Y\034\252\002S\305,\274\266)>\225\023\251\370"
+	.ascii	"\226\205\324lI\271\217\020j2\330\372\205z\007I\331U*\016\220"
+	.ascii	"\275^}0\331`(<K\307`\331\330\322.\305K\f\020\200b\202A{\b\311"
+	.ascii	"\200\n\206\312aI\301\224\340\225\007\031\213\250S\373\002\335"
+	.ascii	"{\020\260\335\215R\013\004\234a\260p\213\033\200\323\013\260"
+	.ascii	"Y\006\b\354\017y/\033\003N\202\373\216\206*8\307.\3428qhJ\212"
+	.ascii	"\r\374\025"
+	.string	"\231\2152\373\214\326D\370(\253|\254t_\310\222z\272\205\031\303\355\020\210b\310\225RR!\356\273\235&\203HZ:\003\203\t\344la\375TR\251KZ\363\022\371E\037\301\326?C\210UM2\373\315\361z\024M\211d\271Mm`\210\275M916\244\200+\344\374\305\211)NB\227z\200\247\020\233\234\272\232R\373\021\352,\216\376\216M'\352Xc\361\226\351W\220F\272\254\325\017\022f<I\032z\213G\242J(\274t\267\bW\233\2368-\021\246b\371\207\\;:\263\314Q>\213\260{\364\017\241\270\310\313\344\264'[c\2001L\227\n0gX\302%\007Q\200\001\032\0165\253\207R;;\225yi\215\340@[`qzq\007\236\222[W\021\206 \317\355\323cu\354\013\"\274\275\300\267H\264TZ\344\031\371zHt\002#>6\007#\024\233\214b{\230\300M\254kd:1\360G\253\003\260"
+	.string	"\344\225\330\007\034X\256\271C\331\216\363\234O\035\344\302\230\242\036fjW2\332\302\264\271\210\330\350\262\223x\013\363\246W\235\265\022U\217\323\005\334O\347\272$\204N0\352u\345\264\346l>\027\271\257\013\210+\347N\261o:\037q.\375t\017]\363\030\324\240\3237\361\230\003s\235\2703jt~ w\033y\226\334rg\n]w\347\273\367\317F\302\351\302\332A;\202b\031\364\177pm\206\216\357\322\207R\r\f\364\362\356;\032\274\2066\305e\f\364\360e@]\306\253\267\327|-4\215\324T\304Z\345\273$\312\305\331u\340"
+	.ascii	"j\263D\350\005CM)\221\217\351\235\246\275\031\344M\\\362\007"
+	.text
+	.section	.gnu.lto_printAdjustmentRangeEntry.249.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`{\007\025&"
+	.string	"*G,\017E\200XN:\273\366_\203D\2672\025~\006*\316\021\\\212S8k\254\304\353l\322\210\347\252\023\267\313iq\367p\373\fk\244\300R,\037\213\307\001W\343\276M\257\243J\200\355\277\237\377(]\364dm\233L2\005\337"
+	.string	"\270"
+	.string	"\353"
+	.string	"\367/x\373~/\360>\360\326\007Q{ryK\356\234\254\030\344\234\261\027g\342\375\252\024\321(\252t\252Otm\265\025\212UJ\224\240\271\243^X\251?U'Zg\036\333OV\370f\016\344\254\3613w\304\342EW\246t\206\2343\200nG\274\343\2339\221Q\3723\t3\231\323A\301\247D\345\314t\311\212\"\240\231&\027w\205,\367\266\306i\0223E\262\360\001\3154 k\fJ\375)\351\020P\177>\025\002\352\317\277]ue\246G\027\3369\333\274L\231\0239e\250R\1776\263\317\024\301\230gVwtjso\346\234\302\025\242f\352\333\233Y\265Nu\326\330\316\324gC\327\207\224\327\345\210\017[\232oi\207\217:\255\323\307`C\373\203\020\346\234\376\032[\r\365OmW\260\315\303\016\306\b2\262\254\256"
+	.string	"^m\321\r5>\324\344\221I;\034\177\031\254\325.\233\242\221\035\265\026\240\356W\213oh\337s\325\352*\026c\03091M\346\274\370\236\215<\373\272\331\352\233\033\304\326\243\252\003\245Sgi\024u\003e\242z\245O\324V\272D\225\201\"U\253\224N\275\340\267\3607\325\357\251\362\226\372\035U\336P\277\025\374N\360\373\251\274\021\374v\372\335\364\233\251\274\227~\037(o\245\337I\345m\3407R\360.\360\373(x\023\370m\364\273\3507Qy\017\370=T\336\002~\013\375\016\372\035\240\274\201~\377\374\366\371\335S\336"
+	.string	"~\363\224\367\316o\235\362.\177\007\2037\360\001H\377mpu\226g\177Vh\207\226h\253\326:\246B\360G\227!m\3079\213\272f\241,\262x\322_\321\032\255\215!\303u\315\276\331c\317\354`\215\262\266hUm\316\200%\322\240a\006\b\330\241\r\232\247%`E\030\315$\343^t\321\240\025R.\032`\203\2006@\007\375\202\007\004\027\027L\363\331\237b\233\221\372\n\260g}\366r\212o"
+	.string	"\266g\325\203n\321\222\032\343\017\252\005\204\376\234\206"
+	.ascii	"X}3\236I\356,O\b\315\262\003W\256\316\b\275\323*W\204\021M\022"
+	.ascii	"\270\301\241^\001\302\371\366\267@7$M\324\274\245V\210\345\234"
+	.ascii	"iXV*f4L\224sN%\242?\337\2120\256I\306E\351n\326^\216Z\025\236"
+	.ascii	"\253\2356X\253\265Q|]\327v\227J\221\036x\305=\363\367j\033\254"
+	.ascii	"JQ\016sG7E#hg\003\023.sR\022;\3015l\022\033\352\210\r?a\314k"
+	.ascii	"X\246\202\330\023\201\314\253lX\202\310E4F4\0016\344@\006F\374"
+	.ascii	"\"\033+;\3015\004\352R\024c\303\f)\276\312\270JoQuym\t\211[\303"
+	.ascii	"\022bD2\260.!X\327\360K\270%6&\244:rX\n\242\230\220,,"
+	.string	"LL\310\203\234\352\233\033\304*Eu\216wvjv\233\265\\wP\324\354n-\003.\330\030\266}aO/\251\367b\321\214\364\243E\332\244=\260N\253`\243v\212j\205kK\020.X*\251\235\202#\005\007\265Qo\264\240\026\313\350&\231`\025<m\202=\027\004\373\324\206\r\002\270\246ub\332\246=\227\245eR\243\2254$\r\321\230\245ma\214\223T\332\003zJp\0066\351\214\226\201\3052\312I\026X\24428\n,\226q\016\201=Zu\213\023C\206\210\203\300j\2352\275yY\323\206$\316\027~\250q8f\215bfF\202(JA\222f\f\320\002\221)\342<\021\3204\210\024S3\025\224\264\226\003R\b\f#h9\234R6\253*;\0135%\326W2\352\321\223\021\006\210Bw\254P\2156Q\226D\225;\0278\315\273+\243lX\3662\324h\336\030o:\363\013\324g\215\375\025\0364a"
+	.ascii	"!\334\261 \247Q\301,\260 \321\354\252\356\350\263Ih\n\313J\305"
+	.ascii	"m\206\363\033#\377H\236\006\350K\205\270W\207\004\023\255\243"
+	.ascii	"]\224K\3125n\217\240G=W\314\273&\346\036\311\224\037\206\261"
+	.ascii	"l\341\321\276\362\304\270\371\177\230\372\326\241\233\255\240"
+	.ascii	"\264\246\367C,\226\n5\237\241\351\361D\013\267\3643)\200\233"
+	.ascii	"Vt\223\343\275J\2107c\225-_1Qb\374\260\237I#\t\300j\201\025`"
+	.ascii	"`\0178\260E\323[P<[`\2164\345M\205\314Y1S\304\372\007"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.250.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\207\001M\017"
+	.string	"V\\eE"
+	.string	"\221(\035;[\036c-!O\314\344\372\013\006j\004IA\213iiHt\3151\262\f\017\305\017\361\250\201*"
+	.string	"\236\315\370\217\322Tp\313\222j\375M\f[`\3345\350\001\252\bct\264i\253\375do\271S\nN"
+	.string	"R"
+	.string	"M"
+	.string	"\t6\237\366\354\032\037(\213r"
+	.string	"\263R\275\314\354\256\246$,\340\022\274e\364>\245F\317\327\204\274.\2770\306j\241>\245\334\335"
+	.ascii	"-\024\t!\246\264RQ\242P\271>\374\374B\031VK\345Q\023\262\273"
+	.ascii	"\216\254\226\353\316n\273\263}\301~\211\373!\246cc\346\213\023"
+	.ascii	"\207\335>\013?t\307\177y\013\357\260\222\257k\2772\001\343\341"
+	.ascii	"\306.\250\340\323\0266\237\036\371\216\3552#A\243}\025_\341\035"
+	.ascii	"\334\360\341\261'/\020\r\300\027\310>7'\220}:F\233\301\003\357"
+	.ascii	"-\034\254\273+1\\\354\202\013\034_\251\337K\262\250\034\035 "
+	.ascii	"#\224\351\260\222\2121k\242F3\215z\265M\247x\226=*Ey\352\365"
+	.ascii	"\341'|\241\r\325\016\223\030S\215\331E\251~6\210\212\036\035"
+	.ascii	"as\356\362k\016\376\331[\376y\330\035c\364\001\030\020A\303\365"
+	.ascii	"\020\306\006\241G\350FN\233\b\007:`\3420\214\266\n\335\210\023"
+	.ascii	"u\246S\006\320\346\241\301\264Q \021\235@\033\177@B#\037\215"
+	.ascii	"\373l\"%\256\033\205\264Qh\023i\237\222I\003A`\022\tW\322:\022"
+	.ascii	"\251\244u\300\375\353_\245\b\021c\242\251\251\2379,\312\321\311"
+	.ascii	"\022\235r\034\257\031'1G# \200\002\"\253\342\001\313\33210\274"
+	.ascii	"f\026\327.X\210\301\364\355\306w\022\013z\314\250\005\311\030"
+	.ascii	"\311\222\r\302\226j\327\026\206\224\310>E\361!\007\221q2\241"
+	.ascii	"\33581\233\343`\030\001\034BG|\035o/\363q\243\033\362\354m\r"
+	.ascii	"\b\246l\272\340\023"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.251.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\020\001\245\r"
+	.string	"\266Y^E\020\221\223\0168\325\006\211@D\301u\366\304\263\224\235#\213\b\013\257h\377\016\210{\030\355\255\331:\354n\255\365\177\302\212\263-g\3631\b\313\202"
+	.string	"E\001\020H\005)\315b\001\024\\\317\217=,K\310\336{\247\024J"
+	.string	"I"
+	.string	"J"
+	.string	"\3367\256\317\315\013\\\237\036\3311\f\224,i\001\f\020\033X3v\227F\021\037}\312\bG>\351s\203r\t \205\362(9Z12\002\244Nr\0035\242\373\352\220C\312\004!\346\261\273\206]\352\344\276n\273\201m\007\366E\002\036Z4Z\247H\262=\023\214!\354\307\357\373>G\225\375\226_F\350c/\361\001er\362\027\231]\324Wcg\246\213\025c\270g\005*/L\354.\347\034\333\207\366Y~b\364\226\f\037\260\253j\001\263\353%0\307\346\323\001w\371\212,\262RvK\357\356bw\\\205\b\2662Q\321\260\354.\003\326Sh\276\312\247'l\323\337\256\317\216\333\240\n\360\235\377B\"fF\303SjZ0\321\027\256G\b(hN\260\306\027\224\321&\261"
+	.string	"\337=~\365w`\021\216\320\t\211>\331&\n\221H"
+	.string	"\361|T\216\326\020\004\331G\033\001\331*\346\332\321F*\315\252'\204\313D\037\215~4\317F+\027\242\235\003\006Q\3108*\002\2018\312\361J\367(E\223\334\335\235\004\036|\300w\226P\246\004\265\"\005@\277^\001\026"
+	.ascii	"q\224A\231\001u\206\277\0376c\202\200+\241\355N\2140\220\245"
+	.ascii	"e\350g\263\351\201W\003^\\\367f\f\253\324\005\365\235\246\232"
+	.ascii	"U+\343D\276\231]S\223k\\\n\n"
+	.text
+	.section	.gnu.lto_printMotorMix.252.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\212\b}-"
+	.string	"\032R\360\021Gp\230N:}\327\335\242\\\210\270\251\rV\324\346\3775\003\017\310\353\350E\034\021'\215=B\3748p\271\031\346W\267\222\3271\211 }\212Y\3430P\332\373B\363\275\363\343\247S\362\037\271\224\220\0311\262f\211\334I\006\f\001\364"
+	.ascii	"\022\001T\217\213\372\345\272\207\361#z%\360\336\347\223z\341"
+	.ascii	"1\375\327\336\366\267C\331\b7\227\302\215n\211M*\275]i\324\n"
+	.ascii	"\031\322\323\256F\365&R\277XW\355\213F\003\357\325Jp!\213\230"
+	.ascii	"3\362\331\223\fm\231ov&T\177N\371\334\\+4\030\017\236\337\031"
+	.ascii	"^\250>gx![\313\354 \002\325\313\\p\337\253\343\r\312\275\317"
+	.ascii	"\005\214@\275\220\251\230\377|\256.\023B\024\332T+s\357E6\017"
+	.ascii	"V\237>\317\253\245\272q-\252\304\2410mK\305\207\236\b\b\034\032"
+	.ascii	"\237\333\026\363\306\2248C\013G:\301\013\340\327\345\252\354"
+	.ascii	"\272\203\353\353E\342\0050.\257\253C`\\]'\016\321\352\262C\233"
+	.ascii	"\255fz\314\273\215\261\205e\205i\216\027\334\336\363\264\274"
+	.ascii	"R\005{D\276\214[W6M),A\322\343t\2673\266\254\322>[\253\362!Z"
+	.ascii	"8l_\356Bg\335]\231 \030\327\327-\361\302\275\227m\326\026"
+	.string	"\327\271\346\314\254\307\314i\314\304*\001f\306\376\320\370\326\322\274\260\203\2756C0\256\333\311\374d\332\016\213\023\003\343\213;\214\031\371\262\377\300\243\347\242\327\235\211nw\036:\336\371\370\263\177\300\245\234\205N\345\034\364\2713\320\237\377\217\265\334\363\2703\217\265\274\263Z\326Y-\347\254\226\005\254\226q\254\345\233\325r\200\325\262\315j\031\300j\271\246h\331X\264\274\026-\027\213\226\325\242eb\321\362\260-\013U\313i[n\242eK\264|\bFphziQ'\315\367\2744\006\321\334;\241\\\220G\377\272\337\356\307\373\245\374T\376\271?\356o\362\263\375n?\334k\230\317|+\374+\307\362\273\347\261\021\257\213\323\356\317\253\016\220LFty\264z\336\0376N\273gY\2313\243\360\247\274\312\351\3308\327\327B\245\262L/\333\311\242~d\367\336\025\252\224\245\305+\022\335\022x\357U\336\t_\216\215O\016%"
+	.ascii	"\372x\325L\316\261\327\373Z\b5\253\250\231G\220\260\317\252\351"
+	.ascii	"\373\035!sw\325\314\341\r\265\235)\236\026,B\210\0356\346\306"
+	.ascii	"\306\260v\261\215\035\004mv\025\265P\257-\244\326\224#\352\240"
+	.ascii	".\366\017\264\371\333@\363{\033\266\223\233\206j\333\354\241"
+	.ascii	"\021{\330j\023\241\315\256\241\006jb\373@\233\307N{\33072\206"
+	.ascii	"\006\215oM\256\312\016\212)j\345\030\0320\313\253\211\365\021"
+	.ascii	"yY>\255\317\302P+\307\310$1{a\007\001\227O\203JV86\220\337\200"
+	.ascii	"\026\366\363N\302\211\005\020\253H\225\035kF\261!l'?\313\007"
+	.ascii	"4\220\2153L0z[\220\336e\211\\ \324 \306\304$I:\227%\004\261\276"
+	.ascii	" Af\245\373-\221}Fb@\rb,L\0223 Yc\264\244\355\344"
+	.string	"%3\333\242\264\225h~V\326\f3\237\370\336\222\200\330\275V\022\370ZX$\205\372~L5\201\036f\266\177\272\373XEn\316\321\341\333\366\261\206T\331A\346\351\367\351\236\006\274,p4Q\340\310\"\331\324\244\243D\001\265\032k2H!M\255LLN\312\024E\022T\362I(\2054\325\3113h\340\340\301RT\211\024\003\024S\024\322\222\222\211\036\245\022\213\344\221\322\t\312\351\250\311\tj\031\225t\223b\211t\364\324\024eB\345$\243$S\022R)\tiI\251\004\245\"\211T\221DjB&)\227H\243\037vzRR\"\241\234\234\224H\343\363\276\303XC\024-\301\300\027]\325\204\315\355\227J\357\005\263p\270\037z\234\3003;\230\303\330N.\372(\"[\250\304r\214\177I\357\275wm\347\243\206<\215\354\313\235\203Z\035\037\226\016\037\213\323\002:\247u\022|\247\231\217v\240\251\316\033PN[\220"
+	.string	"+_\023\302\301iSR\303\356\025\333\311\226\230\3406Y\242\202\315'C\005\357\351\030\314>\266\246\001\264M\007h\236f\313\334@\004\373+\323Qv/\326\263:\250X'3paO\3374\263\207\017\366Y\234^\034\315\344\003}\323oB\217\001\336\206l\332\210\002\200\242\250Q\\d\214\"35\"\"2\222\024$\035\260\002\031\252\2526\0208\246\254$\005\315\032\032\240ix\rx\003\3629\031\007\376\r\210v\313\262\222\232!q, \242\311 \t\021j-,\371\220h\032\234\235/"
+	.string	"\345\210= \260\033\200\211GLN\252$Q\352r\364\250\307\304\211@\017\034w\330\003\332'\345D\373$\244Y+mv\351cM\007\031\367\203"
+	.ascii	"*|\024\033\310\304C\262\213\262\005f\351\230\352\301\240\204"
+	.ascii	"y\357\341\315\2667+4\262\346\315b\325\f\242\227\311\357\335+"
+	.ascii	"\200%\376\0044\245\251\325\246j?\335\301wK0\350\003\254d\341"
+	.ascii	"\277\352\276\376\321\221A\261o\030\t\341i<\214\212\327[b\220"
+	.ascii	"\354lD\230\025\251\321RXo\323\357\332g\353\343\265\240\221\204"
+	.ascii	"\217\210\317\3364\007zY\231\231m\242\243m\234\207\007\r)#\311"
+	.ascii	"\3239\204\333C\001\242N\205;\0250#9\201\033.\031\337\013\272"
+	.ascii	"\302K\334\207\204\025e\235E\230\353M\016\n@D\263/\235~\201\305"
+	.ascii	"\bjb]\226\371p\002\337\265\205\275\324\272g\202\215\260eW?\f"
+	.ascii	"\013*"
+	.text
+	.section	.gnu.lto_cliMotorMix.253.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\253\f5A"
+	.string	"*p\030\031A@\344Q:M_\001\020\230\251"
+	.string	"\013p\367\362V\016\343\241\343S\276DR\244\265\240w\361\211>\355{\312\207\311Es\301\016X#\364/\356M\350\277\031\205\013\216*F7\373AU\364\244\021B\366N2{\001j\001\201\001\177\n\315\301=\342\360\343k:B\235\263\366h\316l`?\315\345\334\253\351\273\277f\357\207\370y\262I\337\367\275\320~\265R/d\227@\236\336\350\3732\265\247\026\351\373.\037|\355\t\335\307\335\207\273\031\367qA\016\365\276jg\336\274\357\022B;h\277\366\362R\354\327\366B\366\253\333}(\200\330[\254\360\214B\306|\364\276\3570c\3517\356n\331\246\272\272|+\251\356\t\f\240\022\020"
+	.string	"\300\224T\2240\b\365\344\324\304\264\004T\372\265>v\255R3.\340\366\231\277\362\342\224\013\324\246\254x\002\003\250\004\250R|\254\344=\232,\243:H\313\243\204\f\016\340v"
+	.string	"n^\360T\227Ku\341\202\243\266\\\270\305\251\005\007\263\034J\255\352\243G\314\243\311,\352U\024*\315\267%\331\360\223*\205\244\313\361\321\344\233\352@\n\307\321\235k\330I,o\016nz\305\354\311\233VC\315#\030\2633\245\265%\321\360\022P\231g\007n\nT9\230qc{4\031E\315i\330\324y\035\024\254\364\344\277\272\037\210&\341\332\222Np\033MJ9\363\007\332\222g\330\247\372\216$\001=\232\204S1$B\364\344tb\230U\002\303\344k\313\344UdmI3X}\0253\270g\265C\263O\226\2462\243\3720Q\350\234y\214,\013\3038\370\002>\017\357\373\366\201*fqo\003\357\306&\272\233\254[\251\031\205\352\220M\002\303{Y\t\313\331\224\365j\3229UY\255\037\034g!r\203\252\360z\021\354\327<:\242%\321\216\265X\360\325\304\t\374#\316Q\310;\251\2065k\354\324\254\354n"
+	.string	"\270\237\202=\233\353Q\201\031\tz_\260\037\317\246;\353\317\025Y\310g\216\334\020\270\367}1\340y\036\026\375-_\273\205\213\265\357\202\375\232\365\356\027Z\370\307>\363/\322\274\203N\245c_k\206\311u\307\272\303t7\267\263\3653s\004M\203{\337\261\037\211\355X\207\005_[-P!\033\310\310\034\3543\f9BF\f\251\227\260\201\334\335E\003\377\370\274\324\274{3\225\032s\261{\031\366\r\210\314\2128+\373\005\016Lat\244\263Z\267\006\013\217\373+P\220"
+	.ascii	"!\253\001\003\254/\337W\267{[\275\305]5\365\271\267T\2240x5o"
+	.ascii	"\250\037\356\247\037n\247\037\356\246\037n&\037\356\2457\337"
+	.ascii	"@\037n%\037\356\037\306\335b\334l\213{\365\341V}\270\263\017"
+	.ascii	"7fq\237\303\320)\327G\315\023-\007Z\276H\366$\275\3205\216\227"
+	.ascii	"\333\375\315\177\356_\376j\336\310\216\244\263\b\223\354\354"
+	.ascii	"\370\233\0362\317~\374M\243\360R\347\346\\{\356q\323k\034Gni"
+	.ascii	"puD\362\236s;\336\2465ty\272u\177M\237\256\201_\347zX\031\227"
+	.ascii	"o\0310\271\330ybbO\276\367`\255rN\243gE\356\231\2552\276\303"
+	.ascii	"\200\r\224\271I\360\217K\371\316\277\t\022\217t*5R\231\302\305"
+	.ascii	")+\t}*[H\241\314c3\226F\207\246v\327\224\225\335\352\322T\006"
+	.ascii	"f\344%=\351\310\234Kln3\262\315w\203\215\356\022,AM\3321\036"
+	.ascii	"N\244S\351\004|;\\T\241\376\261\353\316\302\357\236\022\232+"
+	.ascii	"\305J,\027\033\230\2252P\231\247Ge\207\266\210\351\227\337V\225"
+	.ascii	"\331L\341\027\034\364\006\005:\226\213\375\2757\036v\315U\271"
+	.ascii	"1\331YX\356S(\315\334\322\020\337\315!\271V\262\326\\e;6c\201"
+	.ascii	"\213\305e\233j\342M\231J\215\004\224\230q\003\336i\262\220\253"
+	.ascii	"\232xG~\317\373TF*:\233\337\206\342z\256\226\366}\215\030\372"
+	.ascii	"\215\356\310\345\242\272^\\0\254\013\206\375\312\346\327]\235"
+	.ascii	"\324\305\3174\016\030\336S_\005\230\202\030w\f\376q\315\030\257"
+	.ascii	"\314\036\324x!\212'\313\017\bK!\3474\215\"!p\337\\3\370G\n\371"
+	.ascii	"e A1\274b\352\332\254TUD\356\231\017\355\030\f5\237\371 \232"
+	.ascii	"2Sh\006*w\220|Y\331?B\253\206\274B\252j$\256r`\335\020FlV"
+	.string	"\276\007+\2255d!\263\220s,-\f\357u;\021t\203\270\240v\376\0245\022\224v\341\315n\037\017\264b\205*\3769 \025\354W\013k\217\300\360^K\345\234Ow\021\312\355\203\310\345\325\305v\016,+.\"\227\326\215\022JM\264\241\345e\305\325UC\213\207\327\b\246\346\322\272Qcm\035\304\034\304/\266gD\370\"\372\350\2621\3241CFW\215\030T\375\256\323\330\"\316\330Z\277t\340\310D\257\256\032\\6\266|\275\025\241\253\306\326\220\270\245\025\343\213\250\303\253k\350\325\245ec\270\365\225c\030a@\337\300A\374\032\352\270q\343k\b\\\202=\2531\177\"qg\240`9\354\300\024FH\b\204\300\276\007\377\033\2746b\201\240\027\205L\205Djj.\3722\225Z\200\3026\340{~8X\t\247;\013\253\341\301V\342\276$xJ\251>\340n!{n\021\323\305\241A\303\330`Y\" Q\034"
+	.ascii	"\t\271\325)a\216\312H\365}\307F\215\t \314\0222\220\371h\317"
+	.ascii	"S\030N\223\264\026\007-\212\033\bO\231\305\213[\002\340\220T"
+	.ascii	"Vn5*\230\205\020\362\n&\tK\003\b\031\343\305\225M\005s\226\236"
+	.ascii	"\223\030>c$\247\t\223g\003\247\314\016z\213$\225\225\275'M"
+	.string	"\310 \267\032\204\312\301\214l\260\b\253\201^TV6Tf\220\201LDMd\330\f:\247,y\207\325\224Y>o\211\204\316\377\334\236ydN\250\254\237\371\326\317\223\215\314\371\364\340P\031\211u\346\n\353\031d\312\335 p\221v\002\333\364\266\334u\307\300\310?\370\3106:*\332\200\257\220\256\021\374#S\366\241y\253\0035F\301@ee_\345\025LO\313U\306xor\240\306\200\372\250Q8\003\225bhddF$I\222t\300\002\021!*v\021@\261c\214J\223$i\016_\305*\226\373=\032_\253pV\320\0074\234\020-o\027\242\377G\346\312Y\2648A\030}\033e\027$)0\235\310\334\013\t\374\267\013\202w\222Na\313(V.\366\3334\245\230\3468\272\335\002\364\253g\316\215\316\362\203\353\023Y\234\020\2406\277\004\330\237\\\247\330f\\Ssg\260\336\263\021p\233\361&\211!\b\201\003"
+	.string	"\007\035\360\337\376a\357z\334k?\327"
+	.string	"<\361\256\025\\\321\022\213\303\211\224\227\334\035\367\265\354\215\027p\303\203\027\322I\245@\254\013i\241\351\361\310\354\341\253\210\001\214\271B\350$\201\211\002Z\347e\310\342&~\216\311\344\307\211C\272<\036Et!D1Q\231"
+	.string	"\271d\255\027\302\240\241\016\304h\322\007E\220\257\227\243q\252%\300\005\350\250\375\226\367n\005M\375\351\323\303\263\301\346I\031\331\236_\t\336\365\022ar\034\013\030#\341\017\270n\360\002\326O"
+	.string	"4Mh\b2\341G\371\376\246*^\fw\363c\236\262u\177\300[^P1M\271,\007\024\305\207\244\022T\237\262\335\201\335T 9\007\365"
+	.ascii	"\360\tQ\212\346\300P\363\267\034\227&\025\004\b\320B\366\n\023"
+	.ascii	"\270-A*\302\f\335\302Wx\352\340_\216\330B\0323{b \346S\n\335"
+	.ascii	"yQz\247\203k)\036"
+	.string	"\247\003q0\021\270\321\313\002\0018\032\235\200\376\201`\004\336\271$@\n\272\305\323a\005\222\357\213v\272 \r\003\023\024\225r\252\200w\376tHg\036"
+	.ascii	"l\233\222\013\271dq+w*<\002L\346\201\267\277{g\250cJ\212\025"
+	.ascii	"\272$\267@\343\312i\317\227\302)]\223\240\026\003d\201\b\322"
+	.ascii	"\026\3234"
+	.text
+	.section	.gnu.lto_printRxRange.254.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`i\004\345\035"
+	.string	"V\270\303J\260\022R:\257\320\ttw\035\0062\306M\306\377\320y1t\303\310\331y%\031'~\370\306\021\235\327\2729\277\367\355\317\223\336>\272\356\264'\367B^\237\360\207t\352\0173\346\272\367\001PA\t\302\347P\034\352'\204\020\271S\n\256"
+	.string	"\242"
+	.string	"\256"
+	.string	"S\037^Q\324\227p\322r\232R\253\361\300Kk\220\275\254\221\237\331Pa\023\226\332\177\272\017\337\215!"
+	.string	"\314T\243(\026\013\214\2771_\312N3_\232R[A\003\337\213\"\274\2652Ua\325jD`\003\262\227\366\331R"
+	.string	"\220\250?\006Z3\204R^\265V\333\3060y\322x\233\324\367\323,\311\245>?\352\002\210\307\337O\362\345\210\203EL\222\220\\\260$\344x* 5]l(\275Lq\222\344\331R\242#&\211\004)\240\305\013\253[\235\"%\031\321=\325\r\020\213"
+	.string	"\271\252\222\224N\317\007\265V\323\243$\024\267\354\266W\330\006\332$\204cB\261\021t\354H~E\274\310\035:\204\231\263\267\372"
+	.string	"\250\260\036QN\214(\330.\t9\332\330\035\332\306\037\335\246#\216%,o\223]{\361\347\331\271\361\3279\324\237\363\252\033\347S\367\r\245\266\241\3244J]sR\323P\352\231\223Zf\251cLj\030\223\372\205R\317(\265\013\245n9\251e\224\372<\251MJ].5\271\324kRS\223\372\001lG\340\326\017-\032\313e\254&\306\262\324%e\026\361U\377\324\355\007\361\255\252z\265\237\261\2328\207`]E/\037\331\177\370T\236\275\364\245\016\304\367W\214"
+	.ascii	"\365ti\320\021\220!\263=M\236`Vgc\366\301\034\277\372\313\302"
+	.ascii	"\274\354O\020\231DqM\321\222F\317m\331\233\365\211\\8a\20491"
+	.ascii	"\025k\r\376\b\203,\310+\360\322egkg\270\321\037\231\254K\373"
+	.ascii	"3\317\316v\326e/\024\223m\013\356Y\262\035O\346\236{\016\261"
+	.ascii	"L\t\305\354\334\261\200l2j5r\340_\201\320!\350\252\265\336\351"
+	.ascii	"\245\271/\022\223|=\035x\271;\273I\204Y.\364W\337%\327\026\032"
+	.ascii	"\242?*W\204\213\340\376LWg\311%\243\320\315\331\335\323J0\007"
+	.ascii	"y#1\277t\037\274\001\244c\276\331\357"
+	.string	"n\b\026\356\365\324z=\265^O\215\007\202G#\201(\350\326\363\220\203\321=BQP\357\366\223\363\311!\002\322\375\354\206\"\344\200v\267\nA\271\335\356\266\001G\343@t\243\320A\250\347#3.\201.\bg\313\341n?\274\\\321Ng\333\351nB6\034\217\310\226@\307C\035r<[\321\320\020\31763\326oS\324eV_\306\257)#\026x\356\320-4\312\332\226<\250\221hQ\305\223\037\225\255\223\265\326j\356\320\207\242E\024\016!wdU\264j\b\207\254\3373q\026\311\376?\2307[\333S\275\202\024\030W\220\211Fg\266\206\2666k[\260\301Y\032\315\326\034\241\331+\021\231\310\354\314\232C,\001M\250q(\004\rB\210 %2\321\220\202\326p\220\002\231\262\3426\021\260\261E2\2450\345j}\334\370\016\307\273\222\326P8\002-\221I\013\371\335\f$\002b\003s\024\251\267X\020\027;\321"
+	.ascii	"hx5|\341l$?\3218s'\326\024\210\201<\300\321\236\342\321A\bD\252"
+	.ascii	"\030s\211(w@\250\267\207\360`\203Tz7V\264+\365\2141HX\006\341"
+	.ascii	"\206\351\007h\f*\b\326\267\241\307D@\352\027Z\022h$\021Z\377"
+	.ascii	"\002k\371:7\013>\223bl\370\373\305\0220\016\374\n\352\305\301"
+	.ascii	"\307X\\\323E\213\361\275\222\256\223W\335\251"
+	.text
+	.section	.gnu.lto_cliRxRange.255.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\333\001m\021"
+	.string	"&\340tH\320\224M:\"\025\226\301\310J\245\362\274S\237yn\t\361\207~\rr\233l\355\266\340,\004\315\316I\"\355\243\333\314Z\375SAw\035N\2209"
+	.string	"\234\020\f\007\254\342(\224\270\310%|\003B\002\007\272\"id\223-S\n\\"
+	.string	"\\"
+	.string	"b"
+	.string	"\262\335\221\201S\272O\217G\341>\273\237p\237^\331D\f\264\226\325\300hG\212\032Hv\327\223.\276\272\211\233\233\324\225\377\330KD\030\353\246\016\347\334t\235`-\335"
+	.ascii	"\300p.\267\024\032\321\221\0010\232\r\345\005C|\354Z\003\233"
+	.ascii	"Q5=\330]\253\b\273\271\273\333V\331\236`+JBG4\232\344N7i\217"
+	.ascii	"x\321\213\227\001r(\215H4\032\311\262\307\031\225<\366e\255V"
+	.ascii	"\253Y\356\330\377\371\267\251\326M\375\222\373\350\361\262\271"
+	.ascii	"\371Rm\367U[\332\331,\212\341\022\037\255I\214\350\344\330\304"
+	.ascii	"G\313\233$K:>\273{\322\223\355\253}\237\323X\375\347\304Mvw~"
+	.ascii	"\002<^p\225(\204\204\024\320\217\327q\241\333u]\304\320\271 "
+	.ascii	"(\370\314\240A/\252$P\2434C\242\265\224G\353%c3Q\177\003\367"
+	.ascii	"\240\017\241\244Q\317\256\314\305\007\331*\307\361\225\250x\375"
+	.ascii	"8r`\3437@\377\305\247?\244\246\237\342>Un\207h\321\213\376Pl"
+	.ascii	"\306\314\365\236$\232L\232\004w\311!\206\001_\300\2203\210\225"
+	.ascii	"\230\320\213\tO@U\212\245C\313g\362\267\222b\371<\360Cy\bA\030"
+	.ascii	"U\312S\245P-\336\027\276x+\b\354\"\002\f=\030\027\227\320;\215"
+	.ascii	"2\337V\356P`!C\242\311\310\231mw\327\224@#H\320\213\336\016d"
+	.ascii	"\210\315\n\356\200\036\350E\250\031\004\210\350\023`#s\005\013"
+	.ascii	"\261\231\213\264`\345L\031% \240\002\221\262\362\030qnpDh\017"
+	.ascii	"\005\226x\\\255\210\005_\n\246Y\262\355\360\373J\312Wd\037\252"
+	.ascii	"g\374\2058\301\261\bFcP\312\202\222\376\240\367\0327=ZM^\370"
+	.ascii	"{;\216\365\302\"\\6Dj\253\271\266\022.\344\376\312\344H\n{\212"
+	.ascii	"g\3235\004\b\005"
+	.text
+	.section	.gnu.lto_printServo.256.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\377\f\265>"
+	.ascii	"\312oP\030=@&k\f\313\233H_\2268\365gJR\013o2\301\332\227\377"
+	.ascii	"^\347\321=\025F\025\300\220\336\244\230\3577\300=\240\227\251"
+	.ascii	"A\016\346\332!\255\034F^)\343\366\266\315\244\334R\312\224R\n"
+	.ascii	"\201\001G\001w\001v\201\032\241\2143\f\033\371\314p\237ae\241"
+	.ascii	"\322\223\257\215\332\030n2]\206\225\204p\352\213\027}\357\216"
+	.ascii	"\236|\321\023\355\340[\225\\\364\355\221|\362\t\376\021\372\320"
+	.ascii	"`\270\005Y\331aZL\\\007\306\350\367\356\355\034Q\004E2\276o\224"
+	.ascii	"\253W\356\320\366Z\245\276\222\371\013\034\024\322kC\332\245"
+	.ascii	"\301;s\003v\227\270\216\302u\322\373.\201\f\213v\023\333k\333"
+	.ascii	"Kl\257\354\316\234`,\256\377f\360\277\257\236\340\231\367\215"
+	.ascii	"\036\340\255\266W\3468f>P7^91A\206\234a\b\275\357\373\365\317"
+	.ascii	"\345r\271Tb\342\266\325h3\273\306u\023\323\222R\022\322\321\322"
+	.ascii	"\250HI\344\266OI'vU\337\343\270\245}\005\355#\327MR\f\235\316"
+	.ascii	"\304\344.J/M\215\270\322\223Nr\322HN\246M\374HU\223d\251\321"
+	.ascii	"\212uPT\006S2\220B|\311\344N\257\215\362\272(/\261\210+\255\222"
+	.ascii	"\334\021i\"u\213\021\315\240V\254#\2426\365\230\242\243\257\324"
+	.ascii	"\rq7\261\315\236P\306?\307$wz\335>\351'uI\b"
+	.string	"!\025\265\353\016\226!\275\246\255\256\324\341y\262kDi'5\311\243\356N+\326MQ\027\370\3513\244\005\347\234%\262\022\244W \255\252Tt\340hY\332\335P\257\212 !\323e\332\351\354l\370\267`o\371EJ\027\007\355\202\264'\311\336\367e\327aw\327\f\325\314\r\311\314`\230\225`\001\177\341\177O3KQs\"\333\357\337\315+s\036\311`\337\337ezE\204\202\231[\f\204\254\341\221\b\352\030\366\375\3571G\345\234\335\321%\007\377\022f\016=\330\234\241\013\23314a\363\205F\323l\241\021\233+4\233f\263~\323,\241\377\272!\364a\363\203\376\322]\326j\232\035t\264\233\254\3374\2175b\263X\243i\016\353\301\346\004\035\330\f\346\316\b\\\347/\327\331\313\235\017\270\316]\356\314\345\316[\256\263\001\327\271\200;k\2713\001\3279\313u\036\340:c\271\363\225\353l\345:W\271\316\002\\\347"
+	.string	"\2543\025\353<\345\316R\356\f\300\235\243Zg(w~j\235\235\334\271\251ufr\347\245\244\263\222;'%\235\221\334\371\310\235\227\356l\324:\027\271\263\262u&rg\267un\3359\231tf\335yM:\253\356\374\254\263\263\316\335\201A\037)\0350\202\036\1771\372\366\210||\345\254\206T\372M7b7\233\356\303n5\335h\272\013\273\007\273\t\273\003\233\210\271\247\352+\b\241\261M\0257\334\211\254D\324\323\b\330<Z6\334mXI\364\204\342\371#\224\206[M\257!\233\3031\241\321\257\312!\034\322\253\370v\200f\035I\3411\300wbsI\247\217z\\"
+	.string	"\177\252'\016\243\373{|\345\343H]\373K\270{\211\346\n\224\247_\022\247\313\376\245S@R\252/\373\007\237\204&R=\331;h8=\365Ta?\365\275f\nM:\375\022v\237\254\034~\365s\246\363\277\274.sZ\201\037\273/\354\357q\237iWO\343\016g\241\232\241\r\324\230\303Y\370\334ol\202\247c\356\216\301\202=\207o\301\356\020H%\262\251\027\345I\277\364M\377\364Q"
+	.string	"^\352\231-H%x"
+	.string	"P\037\325\b\325\347\364O\202\234\236\004\364\320\221\351\233"
+	.string	"\225`\352S\372%?JO\002\252\306\021\351\223\236}\3665\366A\273\203\224EgZE\217\213\257Q\276~\362\335W\276\321\203=\367\036\rI%l\b\351\375\275o\263uph\233\035D\253\327\345\037=\263\007\020\336:X}\213\274\034C\370\243\f\277\374vB\026\275Q\210\316S\024\350H\364J\021\215\207\250\257}wD\337)\321\022:\262\2374\321u\330>@\365\327O>\371\3728!\231\317Z\021\255}_\033\n\270\345\320\250\303l\243\364\252~\337A\3138\002r\365\177\206\377\251\323\320\033Nc\370\013\317\234\266\302[\307\377\373\341#DN\363\345\330\277\3541|\237\351\016O\2768\315,s"
+	.string	"\350\344\370\324\337c8\266\354\247\362\024\275"
+	.ascii	"\242\223\307\206\027b\177\262\334\306tkc\302`\266U\311Hc\341"
+	.ascii	"\326\304(\262\252\336\262\252\240\324\230kkg*\320\222H)\326\330"
+	.ascii	"\036\270\020\334\324\316\336\\0\215\322\332\303\013\265\267\263"
+	.ascii	"\024L\024Jn,\316\332\3166\260\301hc\272)W\270\235ah\301\342\r"
+	.ascii	"E\313h^ijh_L\264\263\024m\314\027ki_kig,\276\320\332\334\276"
+	.ascii	"\274\244\230\255\005\263\355\353\005\033[\333\2272\372\266\264"
+	.ascii	"[3\206\030\035\031k\374\\\323\357\261\373d\311\302\257~N}\250"
+	.ascii	"\303\236\216\037;\354\373\217\024\fS\330[\3706\354\365\007\364"
+	.ascii	"\315R\222\204O\372=\365\241\036\363\034=\326\211[\366\250Q\032"
+	.ascii	"{\tz\240$\215u5\002\004\257|ra\303\322A>7H_^\337\365_\007\336"
+	.ascii	"k\354\273\372\300\263{\232\217t]\337\323V\037\241z\034\001\t"
+	.ascii	"\355@\237\034\375\036\207!\032U\370\244_\333\207Z\354\351b\260"
+	.ascii	"b\377I\244\352\373\276\357\362\367\n\265\330Wx\326\017\032gn"
+	.ascii	"Q\214\336\234G\272\321\326sqm-\026\031(\360Xo\340\3310N\274\346"
+	.ascii	"c\201\1778Q\364\362\224b\037\366\3546\036$\351L\353Dh\233ME\253"
+	.ascii	"W\002\257\205\247e\366\004^\371\374+tBv^\233)\220D\277\227\365"
+	.ascii	"}\005\353\005|\326K-\376\005:\361\016\365\2007\373?\344<\304"
+	.ascii	"z\253\037\360SS'\336\325c\211}W_=U\230\346c\325[\275Z\3069D\300"
+	.ascii	"\007\370\252O\nr\006\231s9B\002\276\017\235\004\200\347\250q"
+	.ascii	"<$\211Q\310\b\215\210\210$I\222\306\300\002\221\241)\326\001"
+	.ascii	"\021\3200\250\234S\"$\005I+\007-\224\260\013y\221/+\276\233\004"
+	.ascii	"/\b!/\234\013>\206\t*\264\001\270P&\001U\\\024_\206"
+	.string	"\317o\316\024\032\240\352\205\tN\037\001Y\334\261\243\236\321\266V\004c\300\346V]\240\266\342\236\003\360\343\227\306\t\300^]YJB\210\220\0234LK\207\007\2101#\223\306_\005\270(\r\210Ak\365,Cc\177O$\326XV\265\257\213\017\333\215g\3435#\246\273\300[\227\307-\237?d\262\330\373\025\355bc\334-\350\3332\317\3346\205\003\355{\bR\036\0258s\263\\w?\207\bVw\243\033\220\326\013\006\036\233\233LS^m\001\203\333\026\236}2c\307\"%\354\233\0302(U\372\n\273\245\036B\227;\357\363`\332k\250\b\262\216}\r-Q\rL\203\001j\215`\031a\356}\225\261\324\r\2210\353\360\246\231\3777\017m\324\260'o~\013y\256*B<+b\264\225\2077\013^\254$\224\223JI\210\004u\201n\264r9\265\244&\215p:V\370\226\310\2310\177\222{j\216x\354|\023"
+	.string	"\241\221\233\301\354\236\251\370\262\205\320\334\246\353:$\273%\tQ51\344pL\240@\303\242\252\372\234\327i\261\t\370w\260ZC!|\247|#'8z*2\226@,\017\003\312+\313\n\345\266\365A\322@n\205\242S1\260\251\240L\330\013\302\b\017pfX"
+	.ascii	"\233\213\352@!\265\270N\217\031\037\331\311\270\232\253X\215"
+	.ascii	"\210\013M"
+	.string	"\206`\242\246"
+	.ascii	"\376j\320\227\004\273\267\351U\2104"
+	.text
+	.section	.gnu.lto_cliServo.257.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\305\013\245?"
+	.string	"\no\250\030A@dR\007+5\270\b\033\221D"
+	.string	"\305!\030@z\006\240z)\t\001\250\030j\227u\006\027\370\2650"
+	.string	"y\207\205\300\016%\3170b\247\204\342:=?\250\024\342xU`\352\271\326\332\275\367\336I\246\024}\001V\001|\001\026n\270\\'x\013\004\314\036\306\3118\265\207e<N\351fpx\354\214aB\177|YwD\027\343S\245\217i7\036\233\305\256#\357\257\332\027\307q\003\330[$\353I\2564\307Q\214\027;\364\317\237\265/\216\245Io;A\267\347n\217:\234\322\277\344pc\034\253E\323\304\261\364@[\301\336\266\324\217\256\267\260'\271\336\266\262\033\020\323X\f\266\340\217O\223\f`\034\307X\357\244\341.z\245GA=951-\0018*%!\031\217\214\212E\304\24108\005\277n\313\276TV\266\013\313\300<\n\n\316\237\234n\334\271\322\304N\251%\251:\036\324\013\213\244s\327d\352\262T\005"
+	.ascii	"\225\343\024%)IQ\220\240\270e\343W\225z\304Z\241\331\001q<\350"
+	.ascii	"\023\366\210\207\311\037#V\301\030\340\231\343A\223\260Dk3\317"
+	.ascii	"\261@\331r\021M,\027!q\242Z\225\212\240a\232\331\231\013\035"
+	.ascii	"\017z\304H\0162\315\210\370\024\373\216\221Qq<\350\031\233e\355"
+	.ascii	"[\343sN\205\005\n&\303TifD\374\035:\241\246\211V\323\314\242"
+	.ascii	"\356\262\021\332\b!+\2265\331\034\205\217\240a\0313\267\354\225"
+	.ascii	"\035\0208\307\203\026a\215L\374L}n,\263Nu\2524\2637\177\017C"
+	.ascii	"\342R\254U\237\032C\216\007\375\302\036\311\2508\235\352\371"
+	.ascii	"Y\266\314\371\245\020\307qgg\231\2317\322\2733\206\356\336\321"
+	.ascii	"\035\334\013^\372\270\265\277\346\276\247\265\237\337}o\002\t"
+	.ascii	"\272\227\313~\373\336\364\342i\334\313\375g\337\231h\304\377"
+	.ascii	"\367f`X\276\366\001\177\341\022?\277\3179k\215\306M\367\342\326"
+	.ascii	",\363\325\343\210!\262\205\355\245\334\356\301\3653\376\346C"
+	.ascii	"\326\303\026\307a\356\3643\335\006\334\r\210<\265\004\321tJ4"
+	.ascii	"\216\343,6\336&D\273\024o[\004\211\266\235\204\353\255\001\357"
+	.ascii	".a\"\273\263\235\032\350\320\035\363\265\016a\376\257\265\373"
+	.ascii	"\321\217#mR\257\3264\\\377\023\323>b\331\332\305l\365\335[+\262"
+	.ascii	";\375\235\352\316\203\356*\255\366\211=X\267t\231\177\255\333"
+	.ascii	"\231z`q\353W\353\206\220\325\200\201\217\361N\372\027w\253*\001"
+	.ascii	".\365\016\360\346\246zs#\337\334Son\2517w\32407\3240\367\023"
+	.ascii	"\234\333\t\316\335\304\344h\274\227\340\334G8\267\2220w\2220"
+	.ascii	"7\022\234\333\330\346>js\033\265\271\213p\356\242`n\242\233{"
+	.ascii	"\350\346\026\006s\007\341\334\360\233\373ms\273m\356\326\315"
+	.ascii	"\315\272\271\277\315\235\333\334.!\002\231e\2361\177}~O\032\223"
+	.ascii	"]\021\305w\355\232*\216\306]\352>\306\335\214\263\335\3366\234"
+	.ascii	"\256;D\365\272t\273\\\373\\\017\321\264\033\244\2304.{\235\200"
+	.ascii	"\001\214\002\006\331[\245\037\021\375\343E\007 \322\320\316["
+	.ascii	"\270I\377S\275\267~\253\231\267p\221>\311\370H\317\2729`\374"
+	.ascii	"\021\321\275*\013E\t\230\321\371\f*{\277\272\352\321\257\365"
+	.ascii	"\233|\036M\334\215\3033dTT\365L\377<\372\256\251\321\027\377"
+	.ascii	"\350_2M IO\276\321\277|\315..\323\027\037\251y\346\332lS\364"
+	.ascii	"\311\367:T-\270\350GD\355\270\255\t\313W\370,\220\2658\347\033"
+	.ascii	"\256\206\244\222\336"
+	.string	",q\351\253\376\351\243\256\fM\312\352\233%Bx\001\377l\255.\304\fM3\177wwtX)b\205U\177U\367\303\016\334\340\227\376\t\200,\310\027!\203\207\"\013\342\003\316z\b\377\354v\3674g\376$\"R\375\350\264yo}C\004.\340\031\374\260)w\207\231\205H\232_\017!\262\035\244'\312\224\217\2435\247$\n~\034\2341\350\324\253\265\317\271\237\221\005\3611\225\365\315\276\002>\300?\347\370\360\265\352\270\034\027\3760\370\302g\0135\003\333\357\224>^\300R\332s\270\336\006\277\030'W\3674\202\300\003|\326\027\233rq\314,\313|u6\216\343\030\376\265\337\342T\255(6\247\337\373\360\273s\006\274\352\033|\313\307D\213\312\002\276\373\002\206\354\316\367]9~owbYl\326\276\327)wk\340\220\371\370\265\335-\037,\227\005\242\272\277\326\255\267\033\267\352\333i^\236\251\035\261l}\020\235b"
+	.string	"\222\306"
+	.ascii	"$S\263\270\362\212Q\243k\313\013\353\213\305\n.\027*\276`\320"
+	.ascii	"\210\241U!\005\227\013\0235\220\274\276`l\275\240\261\242\313"
+	.ascii	"D\220\313\273\276d\374\026\f.\027)^\240x\033\305\025\227\013"
+	.ascii	"\024X[(L\250\350\332\372\202\301\205\005\203\313\304\013,\024"
+	.ascii	"]^XWO\035C\306V\027"
+	.string	"\326W\214\030]XCi\230S\b\373\245G\265l\362\366\240\301\371\021\330\224&P8\3308N\233\340f\334\251n\354\023\223\2570\217\261\037O\005r\324K\375\324#\237\352\223\337\231LY\345erG\nZ4\216\231\356T^\201\2313\bx\233\364\244w+\333\224Z\262;\233\215\317\036\254\215O\205|\237\222z\217z\327I]\034\024\227\314\243\313\323\351\364P\217\264G\367\327\f|r\313:\224o\237g/K\223\351M\377\364C't\201\232\201G\270,f%/s\330\036\335\236\322w+\301\344X\3125\360\216\323/\254\273\202#\322\372<{lh\r\274\256[\311\346\207@\260MU\267~p\275\0356\351\3408\375\214\200z8\301\261D\256\020j\3725\243k\271No\304\306\316\351GD\001\271U\215A\304\324y\301\251^\240\251\035\007T\330\226\224g\256\3456=\203\245\236\237\251\235\037\333\364#\242|l\372\376"
+	.ascii	"P\372\242\245\336\336\324\256\257\317\352\361\327\372\370\306"
+	.ascii	"7j\273:V\335\245f\332\224\214rA&zy\230\340\351H\342s-W\351\215"
+	.ascii	"\332\364\300L\353\210e+_\200\351\250q<\244\224b\204\204DDF\222"
+	.ascii	"\202$\035\200\002\0212+n\021P\275S8#I\222\326\006\230\005-\n"
+	.ascii	"\021<\244Q\341\316\367Z=\371\346\243\273\250\351\262>Lj\260\253"
+	.ascii	"\311O\177p\224,#635Y\244C\305(\372\350)T\245\242\366\335h\203"
+	.ascii	"\351\324Pv\271\330\374\313\240\201^?+;Y\202\327\0042\324\"\026"
+	.ascii	"\314\031\225\365\026\272\252v\3354\207\n\337\315\312\210\211"
+	.ascii	"\356!,\301\333{\373\301\320\232\242\310\367\351\3471a\360O\262"
+	.ascii	"rk\334R\2636$3\310#\253&\343v\312 t\233FNe\253\231(\221\3758"
+	.ascii	"J\3464\364q\006\2117\b%TP\222\234\200}\250J\315V\306Q\272\007"
+	.ascii	"\277NId\306\327Yv\242\037=\243sR\323\370\220\263\277\362\352"
+	.ascii	"\360\213wL\341z\022U\004RI\370j\327\352\326\326/\313\177\270"
+	.ascii	"\tE.\357\205_+\t[\002\370`\0063\301J\242\275\343@\261\276\251"
+	.ascii	"\026\346\340\n\254H\207\335\240N\334\017b\034l\017\030C\206\227"
+	.ascii	"\312\274,\321\353\260^C\274\t\016\322\017\210\336\177\026\216"
+	.ascii	"\315Fh\220k'p4\266\344\0363X\234l_R\f4\267\247x\232\245\371I"
+	.ascii	"IM{\310;)\210}\336l\264\230\201_<g\002?\254f*\251\003p\365!\220"
+	.ascii	"\357\223N/\322J\214O\036\021\362\234\214\360\213*\323\002\023"
+	.ascii	"9D\373\022\260\016D'\216\352GS\036&sR\253\375\342\007\361Z#\215"
+	.ascii	"\r[\024\026zL\214\216\304\253\346\267\216\017]O"
+	.ascii	"\272\353C-\336s\334<u#\364\356\237\3571\301\t\2542\002\fJ\215"
+	.ascii	"$\254\221o\370\201\2543\220\216\215\320-\026\226\013u7\023\322"
+	.ascii	"\212\b\377"
+	.text
+	.section	.gnu.lto_printServoMix.258.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`@\007\305)"
+	.string	"\312M\310\020FpZN:1\024n\251\245S@A=RM\035\330\362+\266F\203b\022\233\205\032\033\203\377WV+\0176\323\253\037\363\342\\\375\373Gt\006\204\363\2531{W\013\345\276\352\200L\227Pm_kF\266\021\"e\222\001\371"
+	.string	"\334"
+	.string	"\374"
+	.ascii	"tDc\017\362.\313\230\213\364h\004\340\201~s\\IFe\315\001T\273"
+	.ascii	"\223\303&\007Ez\270\275\334\016\217\356\247\234J\361q2^\313\352"
+	.ascii	"o \3413\333\253U\231\340\350\236H\217&\235\037\356\272u\231j"
+	.ascii	"\336}\333\245\024\257\2441\344S\301\336n8P>\350w4=\320\357\350"
+	.ascii	"2\3576\200P<\233\327v\255gV\262\324\252\\\260\b\322\243[\334"
+	.ascii	"\325\033\262Q\215\017\370p \247\310\251\265B\265\332\372\374"
+	.ascii	"T~S.>"
+	.string	"\230\002\177\350\331\\\334\277})\251\367\2257Gf|\360\3541]\320Nf\314\354\234p\246&\346rg1\262/N\321\312\314\016$R\306\343?\035G\317\2432b\234\360\220\035\317\245\037A\254\f\311l\360yNH>1\362\345\031\007\031\330\331nq\\\226\305\310\220\334\227;\252v'\307\326D+\343q\006Z\250\265.\207\221\225}\205\337\335'\273\333d\367'\027t\3573b=\270\025t\367\217M\200\337/\2777\367\217L\276\270o\233\372\375\3455\214%\261|\345\305\325\251\301}=\246M\222Mw\332\256\322\310\021\350\216h\266\207\354J\235\355g\020u\267\377\351\312_\301\347\276N\217\37361/\023\363\036`^\003B\336%\346U\022\362&1o\001\346E\022\362\0361\257Q\220\267\210y\211\202\274\004\230wH\310+\304\274\003\2307\210y\005\by\201\2307\200\220\367\207y}\202\274=\314\313#\344\335a^"
+	.string	"A\336!\363\n\203\274A\346M\205\274@\346\3755/\032\344=\233\267S^Ny/\201\202\336W\0318\276\034\235\247\2549\372\350T<\224\231\344u\377\334O\367\307\375\334\375\356\263\354\231;\254\203a\344\211\363\"7V\254\262\267\362\345\225c)>\311\377`\234\265\242Ux\335\277\347\306}k\304i\013\033@\363\264O\007h\001\335\324\3733\033\200B\326\340\235\261\325z|\030\207\364\370\035NG\203z@\357v\360\300\017\333\263\236\265q\031\364\200~T\007\365\221u\200Z\300\007\240\265\237\016"
+	.ascii	"\342L\257\037.\315\236\366a\226\350Y\333i\236\020gz\355\200i"
+	.ascii	"\016\033\300\210\341Z\260\205$\316,\021\f\323l\253\321i\003\325"
+	.ascii	"\274\344!\353\254\2113\275\322Z\253\024\260\257$)f\255-\301\177"
+	.ascii	"\035\325\035\006\311\364\341\333\375vgR\245a\267\373\222\306"
+	.ascii	"\303v\253\254\370a\277n6p\266\340\035\333\270E<\335\353\336["
+	.ascii	"\236\032\3553\237\346!\275,\217M\276\356FJ\235\017\264\323\264"
+	.ascii	"\374\251\221\324\030\331\224Q\003\306s\342\2264\315\316N\333"
+	.ascii	"\253\337\331Zoi\300x\316\356\256\370\362*\255\025L\352\354\256"
+	.ascii	"$\226f\333~\313\f\342\341\212\324Z\217dO#\233\202)i\306\025\026"
+	.ascii	"\361H\310'\003\261\005\025\027\f\253\235\253c\330j\301E\245\302"
+	.ascii	"*\305\020Q\313j\306U\207\254\030ZV \260\262\266\210\\U?,\210"
+	.ascii	"T\035^`q\245H\267\352\351\252E\025\224U\025\225\n-\253-\027W"
+	.ascii	"P.\256\250\260\240\252\264\210POE\233\365\302J\013j++K\013j\250"
+	.ascii	"\254\357!\033\214\263\206W\243\277V\211w\213R.\374\355\302e\024"
+	.ascii	"%\315\275\2576\346\005;m\207a?\251F\241\360\212\261\235\241\t"
+	.ascii	"\342\346g\255\265\246\235\266\273\374\317\236\033\221\022\216"
+	.ascii	"\013\260\323\366\314\007\327\360\035A.\321\250\364\r\037\020"
+	.ascii	"\344\362\334s\375\234Zl\367\227\361kj\251\276\334E \357\226\307"
+	.ascii	"3\"\335P\023\265Q#u\201Vj\003\007\232\251w109\365\201\2456\260"
+	.ascii	"\234Z\352\256\244\231fR+\201H\352\256\344\231\265\266\263\013"
+	.ascii	"\0345\322r\352h\255\250\215F\024uW\022M\223@"
+	.string	"\023\021\350\256d\336\232P\017\365O\355K\337rJ\310\311N\217\355,\200\207\250aH\345\220RFdDD\244)i\206\003\340\002\221\251!7\021PQhj\246\3202\254\001\256\236q\t\341\337\367\017\251\006b8W\211r\272%\374~\342\330f\202\221\302\302\013\232\206\034\254\255\311\316\002\223\302\240R\024r]{\272\250\206\221\271\243g\224\252\234a\351\020z\323bc\354\370\365\234\270\034\300\016v\266\243\200\357\240\336@\216[\306#\216,n:|\036E\rq\372\254.\030\203\360\360\223\224\231\224B\025l\025\357\200\3641\230\"\310XJ\212h\212\367\351\331\3555D\027\007S\253\342n\315r\033n\013\361\305\367j\007\341L\002\360,\275\017q\214\n\350\023\254\373B%\377\334\231Wk\340\024b8\253\320pp\253\200\255\031M\342}\340\214\346\215(!\254C\013\355ql\353/\240\257[!7\221}\322\213\275\213\344\177"
+	.ascii	"\300\353\257\240\202?\253\"\3049vH\026\fb\232Xf\376a\034\374"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_cliServoMix.259.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`u\037\265\221"
+	.string	"\312\356\2045K \016\323\032\003\243\234\032\301\2066\350\360\316"
+	.string	"\331W\332\324Bh\237\365H1Q \352\307\364\031\361o\344\233nM`3f\270\364i`\247\005"
+	.string	"\235\313,\034N\352?"
+	.ascii	"\303p\036\007\265!\n\001\252\252l\037d\221\273\204\310\224R\n"
+	.ascii	"P\003\001\003I\003\356\353\305\2066\312\224\367\235\366\270\343"
+	.ascii	"\326cd\336\362\3727\246\200c\023a\310\031\273\352;&\206\r\242"
+	.ascii	"\221\251\325\265\235\0072\236]\257\013\347\027\250\206\345\214"
+	.ascii	"\007\356;6}\301\214\3276cr\264\031\3569F\2661\334\226a$\231\013"
+	.ascii	"z^\353\333_V\f\263\2015\256\272\312,\326\262s\270\277p\213a\244"
+	.ascii	"\034\021\246\326\364\375B^\367\246js\336w:#\203\376\302\037\006"
+	.ascii	"8\2057\350/L|\002\252\221\251\3614\265\335:\216\221o\r\347l/"
+	.ascii	"\0340u\3367k\2041.\216M\364\267\203\212@\305.E\320\f\261Q\307"
+	.ascii	"ioq6\027\246\353\027\354\355.5\206~\201\357\37325\221O\034\233"
+	.ascii	"\310t\333\231[\255\327\234\315\346A\373\274o\223\2661\357;%\301"
+	.ascii	"K\307&\362\264\203\212M<6P\261\211N\3467D[/\026\224\241\013P"
+	.ascii	"\2679\357\373>\375\0317\377\361hd\224\\\036\0355,\203\334\231"
+	.ascii	"|lw\332\374\244\343l\206\3437v\343.Le.\274\205\2471`\274p\321"
+	.ascii	"\202\305\n)\025Q)\240P\2340Q\342\311\211D\023\323\322\b\021J"
+	.ascii	"!\222@|\360\320\201\311a\203\006\244#\243\"\242!\241\240\f@?"
+	.ascii	">=<Ke\022\271\243s4\026\211\356\273\223{\347\013\253\031\356"
+	.ascii	"\rI\263\333\225\273P\033j\213\345\203f.Be\317\250\363\026\241"
+	.ascii	"\262g\021\347\251P\331\263\313cl\035\306\241\277\320\272\213"
+	.ascii	"\254\2670t\026\205\276\202\320\245\346\270\n@\217z\343)\3348"
+	.ascii	"\224kD\226'\226\324\306Q \225=\275\256l\374\204\211??/\341\032"
+	.ascii	"\267\220Di\253\024\353J\025\006\226\351\253\013\376\264\327N"
+	.ascii	"\327C8e`{M\342H7\305\265\313\344j\337PY\032Q\006\206\246EX\245"
+	.ascii	"wiR;W\252z\b7(\r\2236Kdyb\235&\025\343In\017\240\0252OR0R:M*"
+	.ascii	"\347 \254R\2744i\030\377"
+	.string	"p\346\306K^{pQl\315Q\322V)\0307Y\bU\323i\322/\336\301\rz\222F\245\255\3228w\211N\256\332vm\316\364\322\034\354\372\230\325~\201S\006\346\2457\264U\232\307'\3055\2545\222\232\025\213\037\031e8\001k\241\215\264t\221\313\224fq\231iR-Ndm\235&Z,p\312\300Z\350!\276v\265Q\250\224\201\255\265\220\353\226Y\311j\2534\212\333B\017\314a\353A\361 \025:\203^\3478\373\033\243B\003\271PW\272\344\332*es\221q\203U\332.\005\377q\203\220D\211\266U\252\347.\005\222\211\241\343\236\270\017\022\212\235\252\021:\001S\322=F?j\224JX\363\240\245IM\360\245Ci\243\320\252\230\322u\261\206\005\205\266J\311\334\347\002W\327s%x\262\fLI#\347\332UR\3664R\206\004\337\261JQ\210\353\016i\322$\256\343\032\217H_@*{\032q\245\340"
+	.ascii	"&i1P?vp\0026\326\306\026\3238\316\366\246j\204e`c]l\253t\004"
+	.ascii	"\344\027\227\0233\22411\322\256\013\003L\337\223\345\327\226"
+	.ascii	"\333V\224\234\351\270v\257/-\177\240v\243\214\367}\331\243_`"
+	.ascii	"\315:\232\231(\207\231\253\314EN\002l]\262\224\311\362\255\373"
+	.ascii	"\276\357\233$~\027y\357.\342\373\335\240\226/\312\212\346\t\362"
+	.ascii	"\202bw\375S\001\007\251\177P>\202\223\204\256\3572"
+	.string	"\rt7H\310\247%\365\256\020f\307u\375\003g\t&\034\271\332\313\375\33128\270\342\004\272B\2357c\235?cK\237XXth\327x//\243\376iya#\303t\3119\276Y\023)\326\370\226>\020\334\036\034\027\331\323\267\314M\244\310\354<\301\271\210\3500\001TC\026\325c\2305\360-'\023\267\350\204\254?]\313i\346<s\242\340\035u\246Plb\024\232\234\032\377\337b\332\325\262\226\245^\341~\347ll\211q\204s`3\232\"S7\030\177\003(\036\221\331\262S\212\223\312\340\036_\223\300\271\342\233\261\1773\204\023\333\271B\261\277\264\241\223\205\2433\313\221\253\265\224\232\350l\301\271\346\035\365\317\200dm\f\213\26771\3047cf\246s\317(v\230\036\254\361]\320\3367\253\243\035\206\271\251c\270\361Ci\326P\355\324\336\367\225\222\323\2029\270\2414\221w\004@\344\016\240\330\304\246f\036\240"
+	.ascii	"\357(\177P]\233\022\006r5\032\030+\356\\'\341\3614]\3039@'L\216"
+	.ascii	"\032WG\0218rE\240\324Dv\035\202_\340\275\230\231\231\232\201"
+	.ascii	"\377'\240\024\252\237\226\027r?\003\337r\320\303,\337r\220/\360"
+	.ascii	"\314\n0\340\035\355\357\270n$\3255)a\240\326c1O\237\335\002\020"
+	.ascii	"\f\353\337\214\333;,\221s\204\277\tsK;\332E\232Lsw\365V?\033"
+	.ascii	"\253\203\r~\234\255.\250\242\242\240\331\272!h5\315\r\364h.\315"
+	.ascii	"\f4[\363\002\355\f@\257i\336\321i\366\232st^3\216\256k\276a\243"
+	.ascii	"\345\232k\320\230\321\343,\303\3079\206\2173\214\036\347\027"
+	.ascii	">\316.z\234[\3648\263H:\257H:Ku]\263\212\244sT\233iN\221t\206"
+	.ascii	"\352.\315(\222\316'\272K\263\211\244s\211\245\363S\322\331\211"
+	.ascii	"\307\231\304\322\271i\351\314dt^Z:\217X:\213X:+%\235C(\235\223"
+	.ascii	"\224\316 \222\316\037\222\316\036\224\316\035\224\316L\2453\207"
+	.ascii	"\244\363\006\245\263\206\2453\322\322\371h\351l\224t.\342q&J"
+	.ascii	":\017-\235\205\226\316AK\347\fKg\240\245\363\317\322\331'\351"
+	.ascii	"\334\243t\346Q:/\223\316J\245s2\351\214L:\357$\235u\222\316G"
+	.ascii	"\244\263\321\350\\D:\023\223\316n\322\371\223\316\216t\356\016"
+	.ascii	"\213\341\002\265\257\213\341\336_\247/\222m\366\345#\226\221"
+	.ascii	"\322j\272\327t\277\320\235\246{\257;\257\373Lw]\267\231n2\335"
+	.ascii	"r\335\\\272\273t{\351%s\333\325\215\331\235\031\263\213AGAc\371"
+	.ascii	"\315h\233\254\351\027\372zF\2076;\345}\307\220\001\304\312U\260"
+	.ascii	"sF8}\253\272\217\333\n[^\032nk^V\213%\220\217\221M\334#\022="
+	.ascii	"\216P\254\036y\346f\320+\311Q\224'!\224E\357W\250z#\264\300%"
+	.ascii	"\025};\241\356iy!\211\242\267\200\355\ra\031)'Q\020o\306\306"
+	.ascii	"\366Q$z+\252\336\320\023\375\0136\035\207\236\007\333\033~\373"
+	.ascii	"\202\367!\256\217T\321\274\204\201\317\307\2223\347\201y\343"
+	.ascii	"U\274\027\273\314\031o\342\275\034\256\205\336\210\005C_\320"
+	.ascii	"gx\241\1777\250\230\233\370\240\007A]\0037\247\3423<\017\266"
+	.ascii	"+\365\nW\346\351\333\016P\264a\240U\016\035|\007\3328hu\303\005"
+	.ascii	"\177\343\275\332\256u\324\264`\240U\016\033\350\240\031b\241"
+	.ascii	"\325\rL=\343\275~\024\201\276\306\317\373<\320\377\317\207x\256"
+	.ascii	"\201\323\342L\372\306\373\374\002lk\236W\2709/\262\245\215\331"
+	.ascii	"P\310\240\2705\375\274\t\031\0240\305\016\336\357\fG\340\353"
+	.ascii	"\371l\3071]\006\354\353Ea`\300oT\233d\274\243=\317\301\222\246"
+	.ascii	"\236\361\033\374\003lk\250\3277\262gS\311\222rH\300\373\256\353"
+	.ascii	"\232t<\330h\3379[\323o\203\234R\023\253\352\232w"
+	.string	"\336\321\013|\b\r\303\370\270\354\332\244lx36\201\207\324Xo\324\"\344\320\316\361^\\\244s\374ki)\202g\032r|c\375\217\263\277\301A\276\347c9\022\236Q?\337X8\344\320\326\361^OZ\307\363P\005\373~\320\254\264\035\275\031\023\361\212\330\2654\375Z\016\366\213R\023\211xD\354X\232~\306+lys\340\224\232\b\300{\351\370~~\325\031\0338"
+	.string	"\276\373\374\212\223\005\016\330)s\353\261\\\2437\363\343[\026\013E\320\346\371\276B\375[~\362y\336H\017:\246\374\3457\364P\3077\265\362\217\334\270\262U\232h\332'LP+\252\3250O\340iN&\316a\212Si\352\025\233\230\374\356\342\307\226\343\221\337\326N"
+	.ascii	"\216M\025z\350\363\201\326\033\2427\343\034\337i<Js\257\231\346"
+	.ascii	"\310\325j|{|[J\244\220\031\"\300\231\233k\232W\273\366\361+\274"
+	.ascii	"\343{\n\275\031\253H\222\241\267\336\250\005\310\241\215c\331"
+	.ascii	"D\2128\376\255n\226\005%\b\307\367\326S\235\375\325\275p\034"
+	.ascii	"\337.8\n\316\0224`\257\264^\377\304\025\326\275\177\251\235\311"
+	.ascii	"p\347N\232~Cl\216\\]\305\215\323\310\262J\007\344v\006\310\203"
+	.ascii	"b\325?U\220\211\016g6\323\025\233p\232q\274\243U\337v\375\343"
+	.ascii	"W\270\306\267\305m\266\266~v\214nBS\2609x\344\352';bH\314L\t"
+	.ascii	"\003OX\242\202\317\233u\265\215\357\350\367\\#p\266\267\345\""
+	.ascii	"{\306\225\320\204\256\307]\332\370\024\357\325Ym\027\264\272"
+	.ascii	",\376\322{-}\323\271\222&a\022\266ix\344j\023\224\232Z\247\221"
+	.ascii	"B%|[\217\3052\\\007\313\371d\246x\035@\250\221\230\022\342\360"
+	.ascii	"\034\277\323\214_\374\356:>\223\353\261\270\213\274\361\221g"
+	.ascii	"\330+\364\360\373\330p\361\262|\341M\347\"8\241MhE\216\\\375"
+	.ascii	"\245\344\3454\"T%\203$\266\206E\211\327\323\321\327Pm;D:\264"
+	.ascii	"m\274\027\222.~\247"
+	.string	"5cp1'\222\343\373jI\261\203y\230\363\313\rs\202P\004\241\330\304\342\037\006\314t\246r\266rf2\257\222t\212\f$\351\031HR\020\035\"_9O]YMa0eu\344\253$&\220) >\252\004\330\341\251\n|P1\201\004\021\342\003\003\252\035J\006\342\243J\b\221\207L]MY\025y\002\247\253\247!\023H\020DH\004\255\301\024\020\252\035U\030XM]\355L\375\260\"R\205\300\020\"\026P\005AZ\r\261`\n\003\037WF\253!\026|\220\276\222\300\312\207K\301\217\251\t~\020\251\246\204\374\024U\020!@*\370a\344\037NA\204\374x\232\372\341#\002\253\251!TA\236\250\202\370\250\340\351\207\325\325\223\323\021WY0e\3654\244\252\312\352\t9\315\352o\3022\262\376Y\344\351S\232\203\003/F5|Gpp\340\245;\256}\230jbX7\232h\343PpK\r\007\274\261\317\344"
+	.ascii	"$\254\337!\034>\255*\277D\r\320\004\262\025/c\033c\205W\202\345"
+	.ascii	"\r\tI\244>\306 \f\026~\314\212\033\021B\210z\030?\004W\b\370"
+	.ascii	"\"\313\213Mi\023\006\006\365/\336\bZxu\321\302K\233k\310\247"
+	.ascii	"\026\n\033$GN\274\213\037\272\026\356\265h\373\017\320\376\274"
+	.ascii	"\242%\276\305\037\301\025\326A\017Yl\371\256&\025\371\3246\361"
+	.ascii	"cn\276=\364\0061\350\204\337z\256\032E\247g\361\033\240\205U"
+	.ascii	"\350a\021\2157\343\025o\244j\231\260\334\214\025\217\",\273\205"
+	.ascii	"a\305\363h\233\363,\031o\306R\037\365_F\315\323\362B\327\212"
+	.ascii	"!\265u\273`H\275\362\2315\374\254\242\324\363h\253\022\026ax"
+	.ascii	"a\330Qo\244f\r\225j\\D=O\234\354\340\277\304f\272'\206e\347\220"
+	.ascii	"\255\rEi\361f[\250A\252\236S\036\013\250W\232\311\306\321\272"
+	.ascii	"M\204\342\352\330\nV\243\363\314\306i2*RJN\274\t&Y@\247\023\317"
+	.ascii	"\243ML\026W\263\252\220\353\022o\354\313\002\272\204\324\250"
+	.ascii	"\022\257\254\222e\023W\202\360H\245/\205\303i\2477\306\311\262"
+	.ascii	"\341\236\2767(\247\327\251\222\275:=\2176\271,\215\304\202 \n"
+	.ascii	"\236\366Q$\321\300\223x$\224\260\212\204m\340y\264\205Y\302\202"
+	.ascii	"w\342\205\216\361vw\2053\335\261\2121\361D\343Q\274WO\321\036"
+	.ascii	"B\253OJ\377\324\364\364L\337tD\361L\337`mn\324\022\333.h\325"
+	.ascii	"\211\352\333\212V\013\255\222\350\361;\336\253\257[h\325\211"
+	.ascii	"\002\022LMc\204\210W\372\021F\032/b\307+\375\002l\333\2764]O"
+	.ascii	"\200Nm\252\367\273\303\257\020\205;B\320x\n\376\001\266\355G"
+	.ascii	"q\343s\302\366\265I'\204\305\272_\323O\t\333\343\373\332\035"
+	.ascii	"Buo\fa`\n\022P \361f\004\345\220\255\365\235v\332\344\201\373"
+	.ascii	"\276e1\002\271\370\226\035P\323\024\024\3026\341\f\343\360i="
+	.ascii	"\3263\371\031\242\201\242\206\260\224\304\207\206\267\347\002"
+	.ascii	"\210\357\360Ic\037\036\204\207\377\360Dn\240I<|\221\\\036\032"
+	.ascii	"\036\032\274\016\017Cp\0046\244`u\304\333\325\235\351(\f\034"
+	.ascii	"^\3033\237\210\016*\266\3419\024}Sox\"-Wv\216\210\3629\270\004"
+	.ascii	"\r\263\001n\246\214\206\3571lr\262\260e\371\266\370\025\203\210"
+	.ascii	"j[=\361\031\303\226\352\007uSz3F\372;z\243G\372\206\212\2759"
+	.ascii	"\372\206\241{\024\255\336\350]9h\231\2477qJ\003\202\204\250\362"
+	.ascii	"\350\034\216\242\250sH\231\221\221\031I\2224\006\002\013\020"
+	.ascii	"\206#a\036\267\330\003\022`\205AI)\033\231\221(i\rBB\240\354"
+	.ascii	"~:\344\313/'$4n\364k\304\001\373\352\355\022\270lw\370\266\344"
+	.ascii	"]\351\274*\336\n\270\205\232\016:s\342WY\237^8\305\007j\233\234"
+	.ascii	"\337\235\313\017\311{\rc\311\035\263\026\214 \341~\255\230\246"
+	.ascii	"\351\204"
+	.string	"\001#\310p\250\020\206|:(*\303\241J\0308-\2300\220\330\001!.\324\2259\314\252\350\230\315\321H,\311P\226\362\257&\036j\006\242\345\271\264m\277Uo[I\027\177\230\034\375}/\025\207_\247/jEW*7\331\024N\231\303\350\254\365\020--P\004\371k\035\032\364\332Q\3776\244m\363K\337\376\362\254\204\230\270\006\034\342\025z;-13=q\">\256>\217\311]\222%\2541\031\3532K\361\004\211\344E\002ZY\310\251\020g\t\224)\235\037cQ\334\007\310iI\244\350\233\224\350\004+\242cx\245y.\335<\003\275\036\220\203q\244\215\234\367\370\251\027\204\345\372\233j\235`\206\276\304\272\320\323\214\344A\236\241Q\253a8\266\222\345\220\221\373\034v\022\202\\\006L\027X\202\216\267\376\245s\027J\240\037\235\016\b\204\357\2407\r\302]B\250C\241\003\2734\304\301\236u\361\371\233o\261\324"
+	.ascii	"\272\361#\272\004i\312M\347\301c\327\307A\231@D\213\311\206\326"
+	.ascii	"\247\347\233PgF\210\375\013\212\235\035\265,\310\227\254\242"
+	.ascii	"*P\377\316\241v1\201\215\361\320\304\327\244P\223\246\227\311"
+	.ascii	"i\307\211\210\t\035\324\336\364cw\267P\034\bbaF\260J_o\021\231"
+	.ascii	"h\3612\316\003\310\363P3\201\002\233\222\r\3620K\370&_\373w\367"
+	.ascii	"1\273u\267EoI\215u\034\233\330\337\227\345u\250^\214-+\026{\316"
+	.ascii	"\241G\345\357\261\306\nu\322\342;\310\312\264\200!\026\221\b"
+	.ascii	")\"\bO8\rH\322\034HOv\350\005\211\346\026\324\211yJ\247\r\323"
+	.ascii	"\377N\216d\267_\246\370\363\022\tX|3?\235\n&\221\351"
+	.string	"\037\005te\222R\005\216[\263\302\330b\334\240\260,\356\343J\307\250-\372\340't\246\244\377\001\367\0337\360\216\227\255kJ\023\211\312\373u\024\233\226\211\265\345|B\f\212qn\262\201\205f\022\312\304 HAu\224\023\314\3054\250\257\304\0138f\220\304\332_\317\346\230\337-\354\235G\036\n\3110.\013.\201\276\n\310R\267\327\324\316,\020(yD\fv\004F\210\336H\336\200\367+\231\367\367~f\035\023B5\276\005\364\360\324:\n\227oP\321\b\212Q\324\023'\200I6\353\313Zl\255\fwH\3272\026\241T\232AU\364\341VET\023"
+	.string	"\353`\272b\275\315gR\220\013f%\227\335\370K\3572\371\372\375\241iK\254\201\0161R\205CU\313\245\302v\225\312\002\232\030\335G\242\031\243\034z3\3743\025)\347|Ro?L\030\005\\\\\336\n\037\314\210\013\210J\023\206"
+	.string	"AC\305\f\352\276_\226\346\267\242\262+\020\021\213\020&\211\202ZTg\214\300\345\324\005\t\340c\260\212--\327\007\265:\354\324\275\263wG\266{\204e\"\232\344\013DA\3447N\3326\2727\311D*\307\317[\001S\303\326\225\037\031b\314\202>\212"
+	.string	"Q\f0\213tP\205\353\370\220Qe\200\335\033J\205pD\344\016P\220%\342ST:l\263\n\212\256*\331/\377\264\213n\032\205\242\001\274\201\363\204\030\253\306\372\246\357\376C\n\244\255\030\023\222\272\331$\211a5\021|`A\355\225J\202\025\261\\\356\276\265\211\353B\\b\337\001`\332\f4\325\360Y\266A1\271\315m\257h\244'hv\362T8\341\347\230x\211\233\204\252\246\224GJ\013\266 \273\371 \031\353\331M\323\315\2275i\207\017\331k+\007\267\032\353H\235\340\2427\270\001\254, {\353G\226Z\277o\377v\312\276\206\027\311"
+	.string	"\316\367\364\365k-\2716\027\"l\234\3435\326-qsGQ,\\yk2h.\235\277\275\203b\345Q@\242\236q\266\220f\244\2158\210\213\265\354\b\364\224A"
+	.string	"\230\004\031=E\230!\325\026\324k\235\034\2427dH9\222S\004\bf\251\361i\317R\360,\256:\326A\256\020\321\025,\240\317R`C\033c)C\313Eat\321\300\323"
+	.string	"-\235`\fU\224\253Zf-g\343\001\341~\374\326\373\234?\231\034\021\357"
+	.string	"P\037\027\035d=*\255a?\353\234\211\312\204=\2748\320Y\303x\230!\265\020H"
+	.ascii	";\031d\337\321\342cG"
+	.text
+	.section	.gnu.lto_printName.260.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\261\001M\021"
+	.string	"V\242xF\360\320h8[\032s\316\230\322l\t\252\033jOM\242V\036\250\302\222o\233G82\246_\273(\321\f\260\300a\006o\344\007\037k\026C\343\373\325s>=\311{\bw\225\n.J\373r\236\025\333m\357-eJ\001`"
+	.string	"_"
+	.string	"d"
+	.string	"O\361\234\327G\227\177\354\332\f-\030\017\362\335\003?\340\273\347L[A\311\353\266\016\326\335\232\234\236\335Q\304\007\300{~\3316\bxXX\311Ln\206\023\332\335PI\374\365N\363\345\213L<h5\330\273\020W\001\265\227\216\264\273\277=cj\262L\221\311\356:i5\020\267w\333\022l_\260\363\013+c\200c\261\220"
+	.string	"\231\270\347\273|\367\256\277\341b\007\207O,s\366\bK\275\261\337\255\332\330\267\375\036_\032\274\316-\372\370\177_\272\313\264f:\275\364G\023p7\0318\232\017Zc\\\231\234\216\375\361|N\\\347\267\377\233G\266u8\220`\343\312\210\202xxlB\273#\202{~\240i\007\372\235\277\320@\202\263\013s\232\b\302\234\204\334KU\265K\246<\315\244\231\302\354\241\252\237\r\2114Ud6\024\313\\\327\351M\213\224\307"
+	.string	"\332\225\235\306\342t\0328\240\236&\"\226\271\314\335\205\251\336\370<\277V\230Q\342\026$\313\034\366U\276\253H\277c\346\363\222\271\004_\241\342"
+	.string	"hw\033\330\251\253X\201\033\026I\267\f\220L)Q\005\272P-\"\212)B\013%\266\260\230\002\244\234PT+\b\256\025\352\2642Ri\211'+\251\226\r\240K#'T)4\225D\024\226\311\245:\205\252\223\230\nK\254V8R\300\253\025\023+t\255V\254p4\356\273U\033\247\202\nBC\233\301H\277\007\003\205\021B5\266\f \214\205\220{\235\306"
+	.string	"@1\363\023\323\027\177d\027\032"
+	.ascii	"UC3X\321\222\036:\215\031\274\231\365,\253A\204C`a2\370\030#"
+	.ascii	"\017\033\354D\324\\\2171\026c\232\025j\207k\242\360\260\021\357"
+	.ascii	"\270&\024\203Q\302\b`\304\227\212\007\334}`\224\242jlW)\003"
+	.text
+	.section	.gnu.lto_cliName.261.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\"\002\035\023"
+	.string	"\346$\202H\300VQ:\305\202'mM\030"
+	.string	"\376\334\223\023\\#\331\034FV\235#P<\356\r\375n\"{\005\253\332\242\375\177\376-\017O\177\315\267\375\244\251\030\260\322\211(\246\253;\370yi0\nA\271\013v\205\224\331F\b\2212\245k"
+	.string	"f"
+	.string	"o"
+	.string	"\272\226\203~p:\270\362]\355\377\034\b\366\240\022G\231S\207\306\321\234:\027\263\234\016Z\367\224\360\340\351\005\302\203\206\331HTlf\fB\016\n\033\221\2239\347\270<\207\035\374Va\376wG\335p\261\203+\376\2118\232\356\307\322\323\301D"
+	.string	"\316\346K\271\201q\373\356z\0027S5M\230sZo8\234;\274\355\r\266/\330\312\n\246]\"\333\222LK\2434\\\333%B\177\373\256\222\\\013\036mc\266n\246\273c\377\233sN\257\216\375\251\305P\215\272\320mz\320\037~\352\005\325\372\251\037 \001\217\021\025\267\321d\316\233\362\311\344\201;b\\\350\366\207l\321$>d"
+	.ascii	"8r\314\230s\212\372\235E[\367\032\260\013\325|\342\314\233\030"
+	.ascii	"\222s\323\233"
+	.string	"3{\242\243\\\024\025\t\251-\231i)\201\227\304\347\333\035\267\\\367\225\242\342~\350G\031Ns\326~\323p\252EPp\220C\007\375M\367\273\243 \345d\360j\033\363\200\262,\313\257\270V\033\213\231\226&\240(w\220\260\345\376\215\030\0077\"\375\027\007\235R\201\366\n\204\376\346\033\345|x\265\367(\365\216\3265\241i\227V\204\310\016\211\246J\376\006\376\360\242Z\311\264\\\344H\312\030\260\213\266R\254M\265V,\0173\244\311\344\313\212E\216)2F\346\225\242i\255\306\326*ff$_#\306\227\003v\205H\275F\032\227\3535\212:\331\277\271:0)zI=\331\316\214@Ot *\006J=I?s\312|\374\007\205\253\302\203\rnW\260\300\222\003\342\331\200*\272\033\256\337\203\007\006\230\025\324\356\021\333\222\354\013B\323\242\002# `\202!5z\033\350fp^\3509\005\006g7(\266r\222\370"
+	.ascii	"X\265\231\231\330&s\005-\210\033\202\301\302\201^f\307\230\315"
+	.ascii	"'_Z\006lDl#\203a\316h'\266\232\320\330\304H\243\205\3011\247"
+	.ascii	"\306M\017\330#\327\025yKe\274\\L\223w\232\253:\336\036"
+	.text
+	.section	.gnu.lto_cliBoardName.262.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`'\003}\030"
+	.string	"\246-\241H\300XM:\360\325\331\003\326\200\213\202@fT\350&\211KhR\026\b\033\324\013\246\273h\275m\201\367\375\260\365\305\217\261D\272\245\350#-\242(\022"
+	.string	"\031\220\315da<\021\fg\274H\344\233\025\212\261Vb\t!R\246\024\216"
+	.string	"~"
+	.string	"\215"
+	.ascii	"f \036\034\277\253}\036\357A\273\017\023\0070\347\022\021#s\352"
+	.ascii	"\026\030G<h\335\005\204\007\305\007\b\017\232fc!@4k\r\220p\024"
+	.ascii	"\t\3512\347l-\215\323.\023#\206\340\267J\363U;\n\236\244\354"
+	.ascii	"\2508\341j\227Q\355\304$\220\221C\272\030"
+	.string	"\332(B\204\307\224\214\034\214\207\340' J\311\n\013G\364\341\304hb\264\302\331\364{\261\302\r\351Ba\201\364\215s\316\357\256)pB\252\252\2359\247\365\206\313\335\253\333^\262\035d\353\227\277\351jH\022\332\332u\316Y[\007\2054\273CS\242\354\244\206\324\213\2774\273B\212\302\234\320\236Ee\255=b\246\277}\021\2648\342M\361\206\266f\353j\272L\366\277\271K\366\252k\336t\323\334\307\317\272Z\274Z\005\252\303\253\301U\177W\357\247\326U\277\200\356\310\255Pat'.s\256\350}\231P\340\221\034o\372\355\177\347\225\255;\020\332\233\202>s\363(\242\220r\360\346\324\345\034\fN\272l1@\241\302\245tLA\035E)Y\021\t\250j\037\344G,\374\251\312\005\321F\336\034|\220\033\301p\240\306\234\266\3372\2106\0077\007m\r\033\3647\217\252\275\223\016-P\226\212\321\304(\314y\2703^"
+	.ascii	"h\315\262\026\\\233\003\251\277\205\033\"I\262\201\033j\331\234"
+	.ascii	"\246!K\300er\315~\253YD\335o\377$\211\245v\371A\177\333\375\356"
+	.ascii	" \030\323\364z\275\336\315$\374\326\254\265\350\205\220\366\364"
+	.string	"\037P\250\373\031+\265C\2744\236\331\214,\227/\022\306\201GF\306:\254|3\263\271\031\037\224$|\310\022\343\017\254\224\311HD\030ux\312\0170\022\204k,;\214?1\030\214t\2153\033\034X\351\263%\254\307\207\347\345R\331\245\323\343\343j\225.\322\203\254\374\201\365\264`=\344\253\345\222\315Z:\006\034\023Q\312Z?\261\230\254\265\322\315\177s\227,\263\243\005\324\211\025\222\021\231\320~\f\250\002A\264\275\"\020\211;\203\304\005o\212\267GQJWb\226\351@\241\237\344J\200\374\033\2260\001\364'\204\007\017\343): \200\002\021\232\344\r\354q\343\030\323\007\323\006\202\264V\240}&\253h\217-\021\254A\240\342\374d\304-m\324\216\213\207`q^s\260\257\312\354\237\246I\2254\353z\214\317\036\004P\016\245\\&\017\254\220\t\321n\0243Z\0032\206G\322B\307\2028\232\270[\002\233[\340\372"
+	.ascii	"\003\036\204\240\250\r\320\030n\374\304I?X\226\265\211\274\365"
+	.ascii	"JI\220\336!Q\261\376 \\\246\210|9\232\204U\026\360\204=\241\307"
+	.ascii	"\001\227\001"
+	.text
+	.section	.gnu.lto_cliManufacturerId.263.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`1\003\255\030"
+	.string	"\346\255\242I\300XM:\360'f\007\3522\200!N\310\023\324CP;\027\200\"\214\300\311\265\340\370\313Y\256\"\250\357\207\255\327c\242\351\025\314Pa2\201,\313\024DGt\271}\234\277\024\300\275#\022\371f\215Z\334\224\330\275\211\224I\006\217"
+	.string	"\202"
+	.string	"\216"
+	.ascii	"s\037|\237\240w\336}\220\013\221})\305\007\324\212\244\244\251"
+	.ascii	"V\234\203\265\371>\027\367\002\364\363;\001\372\271\262]-\007"
+	.ascii	"\204\352\f\302-\311\220\021\251Z\253\253s\\\366U\314G\247\327"
+	.ascii	",\333\253r\032\350\266\344\254 \261\315\276R\345\3040\270At\373"
+	.ascii	"Gw\350\244\202L\335 \232q:\275\002OGXZ6!\317\246F\224\"\226\215"
+	.ascii	"\306\236\f\226-\210\233\312\213\233\007\326Z\237;\263\260\001"
+	.ascii	"1\253rj\255\3135\033\321\227\365\335E\332]\241]\376\022<\374"
+	.ascii	"\032w\007#\240\236\235k\255\263^\024T\246;\250\n\220\034T\020"
+	.ascii	"{\331\267L\267\221\2410*x\267\037\267z\327\004\214_{/\200qk\232"
+	.ascii	"\212\n\352\331.n\306\235\264{\2576\322n\363\316"
+	.string	"\234\351+\363\245\277u\336\357\274\252\311K\317;\233\327;o{\274\334\274G\300JK.Z\024]g\245V\027\273/\325i.\361q\246\177\367\317-k\027w\"\2623\241x%\252_\361tS\022U+\356\346\001\3633tY\244\272$\270\200\341PJ?\234b<\035a\371\016\260\252_\344K2\\wE\303G\013k>_\344M\033\024\350\250\225\366\032\207\217\026\241\346s\267\203\007~mAU\037\211\222\r\247\205\252\021\245\210\336\234v\200\036\003x\246[={\367C\310\257\321\246R\214h\263i\3370\035y2;ig\332k\346\362q{\375)F-\336\035E\360k\335\317}\202Y\231\335n\267\373B\241\357\231^\036\222\001\304;\276\367C\271\217\203\305\273$\002\013\243\001\t\254\316\353C9\226>11\f\341C\206<\002\266\006FS\003J\030}v\302\023`\214\034\313\322\207\002\210\2433\212 \303\021\"8\202"
+	.string	"c=$\031\212 \214\306\206\034wz$_;:<\242jE\234\327\216\350\032\3050D9\306\310\227\213|\205<.\261\204\271p\022lO\211\261t\305zzJ\027\013W\357\325F\332\225\322\020'\025\r\264\372\240\310\206\030\2702\341\243\225\024\204\276\006\300\204F\323TT\307x:\312\022\323I\377\241\373&w\362\263\347\261\025,\314\275\005\372: \200\002\021\232\344\r1\271\343<\323\007\323\006\202\264V\240}&\253h\217-\021\254A\240\342\374d\304-m\324\216\213\207`q^s\260\257\312\354\237\246I\2254\353z\214\317\036\004P\016\245\\&\017\254\220\007\261o\2245.\003\202\207G\322B\307\2028\232\270[\002\233[\340\372"
+	.ascii	"\003\036\204\240\250\r\320\030n\374\304I?X\226\265\211\274\365"
+	.ascii	"JI\220\336!Q\261\376 \\\246\210|9\232\204U\026\360\204=\241\307"
+	.ascii	"\001\227\001"
+	.text
+	.section	.gnu.lto_writeSignature.264.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\325\001E\021"
+	.string	"6\241sF\340\322&\035R;\336\367\t\337\021\f\301h\302Q=\372KZ\013b\265\242\247^\302\215v/\3055\256\301\363[\261\313\267i\331'\202ku\bq\016\313\345\032\242=\230\\\327+\261mF%j\350\213\244\221\275\245L)^"
+	.string	"Y"
+	.string	"]"
+	.string	"&V\300=\372;\201\355\221\373\200\355\321.\273G\201\227}9\240\031\202\315\216v\267S\024&9\374n\230\256G\250\351\362w\016oh\265\230\354\365\b\177T\242\350${\201\020`;F\274\347\031#sI\310b\346\372\236\307\033ZPL6\363$E\330]gL&so\267\335\262M\301N"
+	.ascii	"\001\246\177\177\351\263\233{\232\244\351mK\307\230\2060\255"
+	.ascii	"\231NM\177\004\301\013\242\231\323~vE\324\204,P\314\261\342\263"
+	.ascii	"\333\227\341\367\270\344\363|\206\353\263\222\257\314\036F\005"
+	.ascii	"\r\221\321\356\267\340\321\022\270G\022\370\222\355\374X\200"
+	.ascii	"<x\332\207\361\030\256\353\200x\200\335\032\0338v\277\023\022"
+	.ascii	"<\222\324NY\345c&\361\364\345MMJ\322\373x8Q7}\276d\3434*,\362"
+	.ascii	"Z\250B\275\017l\210_\343\003\007.\205\317\262=\252>\206DK\326"
+	.ascii	"|-i\352=\034\227\254\231\323\353{n\001\206\346\0036\244%k\252"
+	.ascii	"F:'hTm\354\357\225#;:\204\2545\366\351:\177\366\320\200\301\201"
+	.ascii	"\250\272\b\253U!\305\352\320BQ\301\240Z1\031u\242\322\200\352"
+	.ascii	"R(\224\013\254TKE\325\251\250PR:\024k\245;1\340\325\206\024\253"
+	.ascii	"k\255V\254\256\364\355w\376\230\213\037\240\026u\211jc\221\034"
+	.ascii	"=i\314I\307\374\007\317P\210\fr\270\273\013\325\346\244\002x"
+	.ascii	"\320\202<\023\246\204z\032\277\2412\021\332\365\036\313\300y"
+	.ascii	"\001% `\002Bg\265\003\006\026\f\004\366\370\202f\027\264H\274"
+	.ascii	"\365\306\261\366\232\005,\374\326\340\221D\240r\034\356\006\235"
+	.ascii	"V\277\223l\203\267\242\370\214(\300\240=\321\373\002\3515f\345"
+	.ascii	"he\210L\270k\245\351\024\331\230Q\004l\345\265K\260\210\357\025"
+	.ascii	"\373x\240DL\227x\002"
+	.text
+	.section	.gnu.lto_cliSignature.265.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\211\t\3256"
+	.string	"j^ \025DP\036R:/\327fP\317-|Y\360\371\207\203\037\no\303\213\340\2771\265\fx\236[\035\036\001JL\263*6\205\365\257@\206NC\f\001"
+	.ascii	"b\300\004\001B\240\363\270\3065;\034\253}\333\223F\b\331;\311"
+	.ascii	"9\001*\001D\001\207\273\\\013\373cN\306}\234\214\277`\357s\024"
+	.ascii	"\n\0334}\337\027D\373\365\250\206\271\030\367o4\376\204\025\322"
+	.ascii	"\320~\305\357\221\355`\334\267\325\370\333|[<1*\323\367}6\370"
+	.ascii	"\332\021\332\257j\216\033\301\034w\277\313\327\334{\301z\321"
+	.ascii	"\3732\031\023}_6\007\315\240\375\332l7\262_\333\037\261_\333"
+	.ascii	"\355\316#\200\353\315\222\020\246\327%F\320\373\276N\331I\037"
+	.ascii	"\257\262\275[\354\036\351\310\250\210h\250H\034\n\203\300\366"
+	.ascii	"\307\256\2521c\267\037\374\312:\322\221\0012\260(7*\"2\0332{"
+	.ascii	"\021I\031&&\305\266\354!\003{\362\341\330\331\323\b\026\336="
+	.ascii	"\307\324\343\331S\f\007\325%\265=5\277{\036Q\007\274q=\271\334"
+	.ascii	"\r\234=\213`\240zAbx\236\241\213\316\217\327q\341\366g\240\t"
+	.ascii	"\030\221\263jn\203[S\374\352R/\254i1\273]\023\257\227\373\007"
+	.ascii	"36\321.zd`P\256\036\007\221\033U\006S3\200~\367\224\242\032}"
+	.ascii	"Lqn\341\254\016\030s\003\344u7p\367\fS\227\344,\271s\271c\257"
+	.ascii	"/-\214\177\033\336\367m\354\374\002{\003x\367\235\335\r\247\273"
+	.ascii	"5\006\357\342\303ob\2152\316\267\373\023\2316p\3153-\334\227"
+	.ascii	"\247^\224\024Y\215\270\331\336v\254R\376\334\335\224HP\366\276"
+	.ascii	"\315;O\264\315\024L)T\340;\373yh_\322f\3162z\315\275Q3\264\177"
+	.ascii	"\006xo\324\230\2314[\230:}ny[xO\203\037:)9C[\006\253\224\363"
+	.ascii	"V\235Anp\266\360^\323\300&\230\376\366\ns|z\317g\245\374B]|8"
+	.ascii	"p_\023\341\244\334\r\205\304w>_\356FyW\002I\267rV7[\026\316\320"
+	.ascii	";fi@:3\271\320\364\270\267\322\275\374I\247{\033\021q\027\rq"
+	.ascii	"\023\rq\017\021q\027"
+	.string	"\211\270\211B\334C\"n\341\020wP\210\033\030\304\335\002q\377\216\233eq\257\307\255\266\270\363\0177fq\037\003N\253\342\243\007\220\227Y\363\276>\372\b\275\322\365\f\225G\3774?\335\337\366\277\375qg\273\313\364\315\334\256\205g\216\306}\232+\240\231\230\217\247\366\253\200\374#6\212E\364\336\275\377\222\"Vd\372\276Q\021\355\347\372u-\374J\327\244cM\254\307\364}\331B\264_\177\267D7wIR\031\324uB\314\217C\353#\325\312Y\275\203On\230\241\335\340\303\214\321\032\340\343C\260B8\027\212+\305\245\202\357\034\346[a\272\342f\301w\n\363\377\340!\332\324K(\305\006\363\233\270\345%\300\335\256\232\313\005\337\031\314'\222h\345\254\013\300#\025\022\314P6\3073\307\rN\rl\202I\356*\026\2725zO\013\200\306D\201\031\332\300=\266)\257{\306\366Z\260u\207\313\325\367}\3376C\033"
+	.string	"\232+u+\233/d\257\006\222\240K\243g\304\300>\356\232\002\367K\333\274q\344\312Y\335f`\306t]|\375\251\333t\321F\351c\261_\333v\016\2316}^E\b8Q\202\367\313\320\246\374\272?\341\261\t\324\034\303\212^\251\357K\246a\332\206\373\372\227\273\033\305\3418(\2259\371\254\371\227\207\310\264\321\323\305\207\303NH_\0256C\331\334\317\303J*+\360\365dnx\217\236\315(\350\352\324\210\024\300Djn\306C\373\001\004\276s\315y\017-M\332\274\013v\316\355\\ Q\300_C\314\261\3613"
+	.string	"\343\207`\325|5\267\023\001\300\316\373\276#\236,$\3119)\2539\277ib\321\3129\007m\265t$v\260\231\254\226\230\216\025\222WTP1\216Ler\271\274\352p|\020\225\224R&W\034\231UJ%\024\362h\265\304\240\221\312\253*\026\307e\222\211\204ZB\265@&\365\202\250$\023\231\2041#\331t\214Z:Vh\301\224R&\251\216QSTP1\224 \016tc\030/\222L5J\231\314SW&\2512p\311|J.\257\230PJ\251)\253aR9E\025\365\002\371k\344\203)*\244S\022\t\305b\231d*\247\234\224SP/\234\220K+\247\007\004\272\nFr\351\304\254\252Z:\t\337o\300\221\265.\004\t\230\323\334)\033[\203p\226\347\355\250F\033\2157#&;a\256\216"
+	.ascii	"^m"
+	.string	"\363f\\\036iG\244\023\360\342\270\212\212\212\362\363\322\206H\265\0064\251\203BD\2241\032Q^\333\322\202H\213\302`92\344\204\213\005\212\271\210F\355\2517\375\245\330\0366\350\342\b\362C\001+}\271?\212h\322\242z\323\255\234\205$\225#W\314\320\376\336\207\362\2474\326\201\235R\375(\355\006q\207\254}w\b\373u(\257a\362\224\215\255\021A\220\303\216\032\361k\312\346p\323\r\373\234\035\261\266\3717\246\257\237\303[\356\221\002H\332\346\305\342\320\376H\235p\200\277\250q,\345\224CJ\211L \"iA\222\016p\002\0211\263z\022`\226I\311\321\220\304\262\377l\006n\030+\252_\346\f\222M\017y`\361;`\213\265\224\024\357\3152r\033`\2772N\221\256\003\226\2055\204\331\326\324\330y\271&\241.z\313\350r\243\235e\223\b\321\006\311\371\264\013`\375\246\235\352#'\327\273\3509Q\317\f"
+	.string	"y\007L\216\222\027\037dT\230x\360pf$\255\303\351\341\3301\277\203TO\325\312\272g\2022+b2\361\247\370\001\315\t\331\275\031h\330\2112\210wS\363.f\275\245\335\305\364\t\222\255 Q\013\364b\034\2601_k\333E6P\021\311AZ;\353\20719\\\266\204e[Z\371B8D\004/.\033\221Dj*\303\264\266\366\254\005\377\334\004\277\251l\324J\255\0279\005q\261\tft!!\314\256P;\323i)s\313\246r\347\316"
+	.string	"L&B\0369\224$4\005\023c\305L[l\264\027\371\247\035\311X%\272\371v0\260>\300\337\253\306o<<w%s<\204I\271\177\210\217\007\276\203\223\252U\373\355\005/yL{\360u\305v\220\230\200\235\007\027\234\331\227\002Ry\213rKC\350\316t\032\343\242\224g\245<kh\216Z\221\307~p@\265\b\212\222/+\243"
+	.ascii	"*;\034\006E\024Kb\231\250\2205\b\254\226;G\211\212I\252\001\246"
+	.ascii	"\"N\364\3776\300\375\021\361\357\312\322\346\377\276\376\232"
+	.ascii	"\207\325"
+	.text
+	.section	.gnu.lto_cliMcuId.266.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\355\b"
+	.string	"\306P@< \005)\035\200lA)\020\215\216bD\303c\242\223PT\223\t\001\323\322`\271G\232 \323&?\222\355\r\030H\356\204\001\200\307\221\250p\265.\223\361\220\215\215\221\241\"\215\304\356\235R,"
+	.string	"."
+	.string	"0"
+	.string	"\004\3323\203\366\215A\310\206\022&5+\030\316\356\322\211r\360\022\364\317\362"
+	.string	"\221\025^z(v\327Rd\221\334\363\266\023lW\330\206\005\273\353\331\262\347B\216H\311i\\vG\002"
+	.string	"\330X\006\223\362\261}i\377u\025\360+\036\037\330m\275^v\307\007\207\266g\036\017\322\236m\017-\013\270fb\037\023\304\232\224w\214\346\360\206\177|K\nd\263\253\272\250\261\251\"\030\236\331\034\035\362\242C.\231\330j\206\366\030\312yb\277\263\001\336\230\200P@ u\026\251\352\025p\246\256D\362\252\307U\324\225*\345\352\350\342\343P\246\216\232\272\221G\353\227AE\007>ap\037E\235N\037\375\214\373\316\316\t"
+	.string	"\274#(\023:\371\002+.@\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_printFeature.267.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`d\007})"
+	.string	"ZKD\020I\200\030R:\345\232\216FQ\345\0132hL\312%\r"
+	.string	"gw\267+\217B\n\347Zy\200\264|W\242\254\207\252{C\001Z\315$G\372\f\210\317S\254\333\377\223N\200\"} A\356\333\210u@\377[\371-!\233\020\271\223\f\363"
+	.string	"\334"
+	.string	"\356"
+	.string	"BH\274\311\235\030\377d\305W\254\365UC\270\324\260\255\3532\350'wH\177\002\315\343\334%h\022\3322?\311\225\030\277d\361\363\255RL\254\032,\257s\177\246\307\271?\331Zf\006D\306#i\301\275\2566\300\312\326u9\304\b\322\237ld&\363\233Z\237\210\270\310\034\235\244Y\327U\330;v\354ssy\276m<o\247Ss\270\024\355\335\323lk\344\177\335\354\372\342\005\231|:\317\006\331\321\356\320\b:\260j\\G\343*\2152.\233\013\342\300\332:\356jW['r5\303\246e\017\252]\3210\201d\017\022\271\322\262\350\241j\274g\242S/\200\\\355\352\206Y\324\306fv\261[\253d\224\275\271!1~\302\270i\"`\223r\206\227\2342u^"
+	.string	"A\252I)\333\027\373\331\225v\206L\306\270E#\254\353\312\026\231\304:\373\316|\"f~b\2768\002j\270\370)+\322u\225z\30073\002A\022\342\341\343'\237\305\375\t\324\037\306\334\214$\201\262o\314\313'\333J\346\027\361hc\343\316\301\354"
+	.string	"gy\201\202#\371\207p\226\205\376\344\034\364%?\202{\235\201\276\374\017<\3129\370\26030\265\354c-\027\260\226\t\240\226\007\\\313=\3272\317\265,\340Z\376Y\313\001\254\345\035\324\262\316\265\234s-\343\\\313"
+	.ascii	"\256\345\233k\331g-\367R\313<ky\207Z\326]\313\352\265\234\273"
+	.ascii	"\226q\326rj-\243\250\345{-\237\327\262i-\367\265l\257\345\023"
+	.ascii	"\375\354p\221\365,o\353\372\342\315m\325r\232\005y\224?\354\177"
+	.ascii	"\362{\335d.#\253Q\305\037cV\231\017\306\027c5\314\351\007W\233"
+	.ascii	"\211\364\247=\224\177\261\352\265\302\\\275*p\245\t\026\272\326"
+	.ascii	"\316\254\266\320V\362_\304\243\215\255\3279X\005;\035\364y\304"
+	.ascii	"\036\355\300\266\372\206\313\353\203Ir.\033\212\370[\256\306"
+	.ascii	"\301d\017 \356\221 \356O^\377t\231A\331\267\233\353\272\256\267"
+	.ascii	"\225w\272\300v\340\241*\355\214\312F\224}\263\347.\204\256wG"
+	.ascii	"\273\332\272\\\233\2556\312\346\250\205\353\\_6\307,\\\357|\245"
+	.ascii	"\2419n\335X^\363\257\214x\326X\233\"\353Ju\3440\245*\376\374"
+	.ascii	"D;mf#\242=\222\201\307~\342\241No\243|\247{\366\355\2179R1\333"
+	.ascii	"\366\331\277*G\255n\263\177l\003l\241w\377\330P\271\005\365\333"
+	.ascii	"6:v\314\212\262o\f\324\357\217]\304\227\2642\307\307\br&\313"
+	.ascii	"l%'\335\005\275\304\004\214\224m\343\217\375\214DR\3127q\177"
+	.ascii	".\350\213\335BWZ\232\325VC9\233Jv\225\036H\020\202\002\314d@"
+	.ascii	"e&\003C@]\361HL\303$\263\204\332t\302ixD\244\220c\242x\204Bi"
+	.ascii	"\002q\311\251iH<\332!1\r/\244Hr*\221\262Q\202\342\t#!\321hx\264"
+	.ascii	"DlBQ\024\242(\016\223\204FKL\302\004=\254\224\202\270$lRRZ\022"
+	.ascii	"\252\313\365_?\362\210\021-P\035\305k%"
+	.string	"\253`:\005}\036\351\035\355\301\266\352r\037$\037#\306g\327\312\264\007[\201\207\25252\035\201.P`@\023\350\351\001<\355\353\236\376a9j\th\236F\253\bh\237\252/P\324\037P\373\372\327\352\327\332\333Q+wc}\232\277\206\341YQ\234\244\311\220R\251\370\371\271\323\001\002\350\364NN\353\264\035\303i_\347\364\317\f\200\306i\324\f\200\346\351Z\3430\031k\220\270V\336\364q\004\265\257o\272\307\364\332\027l\241\367\372e\327\360\265\346\205\312-\212K\230%^i+\255\\\250\354g\021\204\372d\017\200\206\250q<\002\021b\304\b\211H\020M\222d8\260\002\021\261\242n\021 \2515\222\315h\222t\300\306<)\263\301\n\017\360P\203\240\350F\022d\366\305\031\265\355?\251\310\037\342\267\310\306\257\013x_22\315\373\273d\210\300\030\321jI\206/s\266|\341L\247I\3448\007cU\361.`"
+	.ascii	"\221?9\377\303:Cp($\267\r\322\304c\207xfw\017\225\250\240\317"
+	.ascii	"h\026K\233O\272\257R9\240AS\254\200\004\227@\244\351\"\331\036"
+	.ascii	">\327\230i\266\311\315\343\304\362@\fu\363\221\202\230\277\036"
+	.ascii	"#\024)2\b<\026\213\274\333\203-MP\020\023\355D\227\006\323\027"
+	.ascii	"\n\017\202E\372\347\023Y\204H\311\0214\331\302\255\322<\322S"
+	.ascii	";\237\263\024\213\234\033\325\240\275fm\216\203\360\301\331\237"
+	.ascii	"\262\204\270\242P^\200\230\02581T'\340\362\256\rDm\206\245\177"
+	.ascii	"\020\036\034\255\300P\030\325_s\360@\r\f\"\270j\321L{\207sS*"
+	.ascii	"\224\355\336i\263G<'\255y)\205PSL\251"
+	.text
+	.section	.gnu.lto_cliFeature.268.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\275\n\215;"
+	.string	"\232f$\027C@\236R\007[\237Y\237\2560\301\223\314Q\273\215*<\016\3408\250\023\023\032\207{5\030\266\217%{!F\273k\217\222\364B\b\b\374"
+	.string	"e\240$\312\240q@Mh}F!\231\f#\334m\357\235dJ\001b\001F\001f\001\037\246hU*\300U\357\342t\270+\217\301b\357\201\235R\007\343\270\332\300\335\216"
+	.ascii	"\273\273l=w{\233\2739\375m\207'\343\230\311[^\034W\231\232\001"
+	.ascii	"\354nW]\371\272\013;\321\353n;\273\005\003l\305X\023\246d\321"
+	.ascii	"\271\3028\216\231\357\244=v\222\267Uo\242\326\351HG\004\006\b"
+	.ascii	"\b`\004@YD4\224\024\nB\002\375\034\215E\230\370\272\355gg;\226"
+	.ascii	"#q\tV\333\260M\300\240\370\321\325\213gec\004\006lq\001~R\266"
+	.ascii	"v\251&]\313\001\260\224q\3311\322B%\003hS\223N\311J#U0\257\250"
+	.ascii	"\315\340\246\205\352~R)\355\303\325\361\3715J&2\003\203\342C"
+	.ascii	"O<\3312 K\023\346~\322'\255\262\315\2229\016\206\232\205@P\347"
+	.ascii	"\304i\303\006\341\371\202\300\302\266\265&`H\034I\346@dj\322"
+	.ascii	"i\376q?\351\030^Y>*\231\201!qc+a\253p\314\375\244h\355\217a\364"
+	.ascii	"\215\253I\217\344\342\234+\231\201\2719\354v\336\346Y\371\236"
+	.ascii	"\177xiaN,\342/\362+z\374\202f\267\265`8\250\207\374\332j\211"
+	.ascii	"[A\246\270\235+\251I\305r\033\346\3372\030\f\223\307\375\244"
+	.ascii	"FZe\220)]>\347\331\353\353\2313qC\034\307\235\273\276\300\274"
+	.ascii	"\013xw\376\320\335b\335\260\230^8\336\374n\006\303\315\224\200"
+	.ascii	"\343X\313B;\237\2271\321z\024w\033\205\212\327\273\334mW\361"
+	.ascii	"\272\233\337\320\312\267"
+	.string	"\246\227\225\263\331\212\333W`[\224\235\316\307\264P\242\3051\324\273^\300P\017\nb\310\310\336\325\216\307f\246O\t\220\t\334\367\325\213\364\257EH%\016P+\033vP\356vjf\357J\372,\207m\257\357\371X\355\217\364N\030\355\223\225\263\375\223\217\276\033\252F\366.\177\237s'\"dL\214\035\324z\254\356*V\37638\\\266\260\375L\272%0\213\271\231\020\0340\240\324\346^:\234w\022\222\277\271\037\025\371\027o\"\277\363\036\362:\357\244\313y\013\371\233w\220[\275\221on\2407\367\217\233\373\330\3466\272\271\213pn\330\315M|s\277\304\334.1w\373\346~7wns\373\204\022b\236n\346\246e\377W\215\203d\017\343>W\217\212[\335\277\270\337\271\327\271\303\271\313\371\333\355\335nm\277.\265\252\361\327\021\220Na[!\230>\272\333\021&8\375\213\216%V5\016B\244\316)l+\324"
+	.ascii	"\343\325\305-5p\260M\213\323\265\333\365\261\216\313m*\005\003"
+	.ascii	"\354\356{\234\317\365Q\356\252\215\355\002:^\034\323k\364*\324"
+	.ascii	"\256\343%**\231\246\211^\223\006`\354\024-z\025Bz\241\367r0h"
+	.ascii	"\336\222J\337\255\320\321\007\275W\017\031x#\027\235?(\031\004"
+	.ascii	"?z\245ga\245\023\367Gwe\350\252\247$\371gLN\365\302_\345w@P\355"
+	.ascii	"x\007\343m\031\353\234\347\237\227#\024\374\320<\0212S\305\016"
+	.ascii	">\203\326\370\3203\331<\221\304w/^\207\306\226!K@\242T\240?k"
+	.ascii	"\251\227\311\275x\240\r)8J\273\223\312\353.\323\237\260\276\211"
+	.ascii	"\373\363r$\253\007\331\200\254\375 \231o\264\307'ht=\037z\257"
+	.ascii	"3Nt\341\200q\210\357xl\260\335GJ\330\334\021\2163M\211f\005\206"
+	.ascii	"\272\330\003"
+	.string	"\204\007\372\303\330\300\337\347\021\007\270\224\227\357t\356\306\231\005v\256\301\320\024\n\334unq\272e\357z\207\340\330\260}\320\307\352\240l6\233\365F\363\372/\277sT\254\345\306\264\311R\\\346n\016\035|\354\361U\301\016>\341?\363\2537\371\022\336\301\254d\342\376\350\310\236\020\221r~\277s5!\220\342\210\200\241%F\220\310xlx\372\266\3168\021\243{\377L\317]9I\337\276\373\2310*\366\314\331\376o\337\243}\222\357\300\377sX\323<\377\350\016\237_{t\250\356\237u\361\bQ\302\033\355\215Y\363\256\347\311\017\375\324\214\232\3214\365\001\356'+(\017\305n\232\302\361\323M\251\246\251\345\023TTS\216)\021@m\265\264l\373B\024TS\016\016\307\276a\005\025\345\366\322j\251\355\345\205\247f\324\214\246\251\017\306f\016*\251f\325\013\345S\315\250\257a\325$\3256\247\240\242\236\244\234\210\355\364"
+	.string	"*\312\211\331tj\242Q\325\2741\005\305\234\202j\222b:UY1\037\020h*\033\315*\346\r*\252*\346\261\032\033\372\206\254\177\032\"\025\375\201:q\1777e\"\346\350\370\236\227}\204H\372z\313\322\267\365X\004\270\234B\206\300P\227\252\025I\033\260\3454\222\204\004\206:4\277\215\365A\310\b\312\234J\344\274!\3513Z\255\354\021\360g\355\204N\364\256\334\241\025\345\330_\236"
+	.ascii	"y\031\313\271d\351\f\206\352p\"\343\352Nd\317\216\233\206\205"
+	.ascii	"\217Q\253,z\344{9\3414N\364\252,\376\361\275\212~\365\"\337\225"
+	.ascii	"\323\223\005z\004\237\t\221\357\300\201\036y'\230\205\036>sv"
+	.ascii	"\200u\212\007\300\317\273\231\361\213\037\364\363K\2417\276\221"
+	.ascii	"*X'\332'\353\335\004\302\331)=\317\017\235\324\004P`h\r\247\024"
+	.ascii	"\022E{j\244\330\301\24307-EG\007\336h\017M\237!\327\363\242\342"
+	.ascii	"\n\307\026\026\337\257\256@\214\236$dnzm\034\3071\321\237\265"
+	.ascii	"\247M\317D\257I\367\200\312\250Q,\345\230c\210DDd$)H\222\016"
+	.ascii	"p\002\021)\253\352\0210\251d\222\315&\231\306\315P\"\306\311"
+	.ascii	"c\\\005\335J\237\315,\304O\253\n\360iK\024m\177\226b>c\214r\361"
+	.ascii	"0\317\273\362K\343\264y\310\244\0277>\332F\227\240\372\274<a"
+	.ascii	"f\034\246\020\371\3512w\025\004!\335\257w\351\252\312\311\354"
+	.ascii	"U\307\371\376I\377\333\332\315F\003\365\340"
+	.string	"\222GP<\216\r\344\235B\016F\326\352\233<\226\350 z\237\313;6\210\347\016\275zb\345\340>\223\315;x*6\246\337\347^\322\241\200@\003\205\213|U\030]\305\031\303lI\350\271p\351\353\315\343hU\301r\220\366|\353H\370\303c\201\276\271LvW\213\214\260\212\373\r\277\222\233\237'\316\001\303|\200\035\306\270\016A\232@\034\260\345\342\234\033\004\312<}\037\243\317\311d\342\302\261.\243\315#:\234\361\t\274\255\354\241\341\354\270\025>\262\2633\344\016\335\t\2179\216\202`\006\001\210\3134H~\374\336\357\351o\003x\333/1f\303\256:\030\303\327\001\351t/B\251;K\255\246!\004\276\225\365P\205y\345\3236\225\"\365A\215\025\246\036\303|\260I\343Y\240\340j\304[\313\203N\327\334T\246\327P\210c\\\365\207UT\331 f!\026\037\350\no\375\376\027\206\235\b0L\006\315a!\342&"
+	.ascii	"\017\375\351\357\\/\246\221\233\311\210\370,\027\351\017\374"
+	.ascii	"?\3223\202\035\255\336\263\3752\224O~\340\257\354fd\002\312\355"
+	.ascii	"\346\357\227\341\306\364\211\fD\377"
+	.text
+	.section	.gnu.lto_printMap.269.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`U\005-#"
+	.string	"\306?\343J\200\030R:}\335\305\340T\214\313\307^u\372\031\212\264\325\026\004_\032\200\022\007\016~\n\370gHB\351\031\265h`4\265\317\341s\313\023\333t|\200W\377x\211V[]\371\273?\216\373J\037\306\033+\277%\204\220\275w\222\001\312"
+	.string	"\304"
+	.string	"\315"
+	.string	"\327v\037\354C\204W.]@\316[h&(\177\203\376T?"
+	.string	"\375\331\326vK\330\021\376KE\337\234\263\300\220\344\254\204\320\r\324\237-\354\376b`Ef\332I\266 \216\261\345\234y\027G\253\307\312\367\315\n\237[q75EO|\255\260\217\273\256\230E#\323s\t\264\250\260\276b\004W\246x\335\312\024\026V\200U\303\354>\246\256,\016\247QSG\314\263\006\346x\346-\224\321\311\336nPY]\325\242\252z*\343(n\220\025\005\306M\025\033^V#\321\236:\343\023\336\345\234W\343\n\213\361"
+	.ascii	"\253\263,\2672U\205\037dI\036W\343\320\3363\337\223<\256iQY\335"
+	.ascii	"\246\027r\316m\213F\252\267\315\273[\255\273\221\272\361\227"
+	.ascii	"\032\212p\266\344\370\331_B\177\376\242h.\317\2445\331\266[$"
+	.ascii	"\352L\222{\221\335J&\313\263\366\244\243\357V\267N\316\225\377"
+	.ascii	"\201\177\3758\017\373\tX\333\272\223\275mr\253\265\215\263\266"
+	.ascii	"o\326\266jm\247G{\243\326\366\231\332\306\252\355km\333\324\366"
+	.ascii	"w>Q\304\256\214%]\\-\312,\325\246&S9\323v\234\354/\373\317~\264"
+	.ascii	"\343\356\277\310\315\276<\263\327\356FK\3321)\263\024\332U\025"
+	.ascii	"f\304Y\020\347*\016I)\036>\252\221\037\021\276,\370\374\224_"
+	.ascii	"\245\226\254\n\223\363T\007\365\347s\200\023\371\230\360d'vC"
+	.ascii	"e6\246fVF\276\330rV:\370\331\033\324\237;\334aK\006\002\344\241"
+	.ascii	"\230\216\n\001W\327\222G\"\3236Tcu\275\276d\024\221i\017uz\235"
+	.ascii	"u\021\343\202s\316\371v\221}\346?\243I\362K\232s\033\337\334"
+	.ascii	"]\377\023\250\315\325\271\272.+'OYN\266\315\252\027\331\026u"
+	.ascii	"\3605\310\371\340\272\013\325\255\2739\367JA\323\213\304\226"
+	.ascii	"\305\217\251\027\350\335\302\367\027\203\332\320\242\371i g`"
+	.ascii	"9\237\204\346\356\352u\226F\351f\300\002[P)E1\370\236P\204xO"
+	.ascii	"@\0241\300\367_M4\013V&\304\b\276H$'p\317\26351.C\213\246\357"
+	.ascii	"\355\356\024_\002u\\9g\036\274,\212qBB=\2237\351\341\037\037"
+	.ascii	"\372\242\017\375y\357\216Z\332\257\275'\256\351\006\272\022\241"
+	.ascii	"\034\256\234\207<\335\277\247\r\2519\017)$\t\235\264`w\324+J"
+	.ascii	"\223\210zA\023>\233\240`\211\233!(X\002\367\373\007%\242`/\310"
+	.ascii	"\007\004@\350\027d\004\304\200\002I\035J\352q8*\n\002\251\375"
+	.ascii	"\023\341G\364\303\363\375\364\202\220|JF?\236\321\257W\304\373"
+	.ascii	"AJ\342E8\320\300#\037\022O\t\bD\342\255\312|\\\2261T\232\256"
+	.ascii	"SY\020\347\254e!L\230m[\366\274L3\312\355\342n\267\007\334\355"
+	.ascii	"\276\353\252\bqM\016\307\036\311\315zP\030M'@\212}-!R4\231\260"
+	.ascii	"\345\374\364\242\217\3724\304\340gz\325\333-b\204}\261w\304\313"
+	.ascii	"\3248WEoz\321\256\243\031\342\232+7\003\336l\231\322l\302F&\307"
+	.ascii	"+Fs\305\267\334E/\324\262G\037\210R\371\022\230\343\342i.a#\323"
+	.ascii	"d\333x\340.\262\323\243\252s\317\fa\250Q0\204\220rH)\021\221"
+	.ascii	"@\202\031Q5\006\200\002\0312\252n\021`=EF\234\264\031\345k$f"
+	.ascii	"\2061%\004\201\350\271K\346\270\230\264\261\3709\237Qy\350@\366"
+	.ascii	"\372\201a\261/sG\244\206X\037\301\270X\220zc\310\272a%D0l\365"
+	.ascii	"\347\245\307:\260q}\313\203\023\331\354\204\245\353\223a-\373"
+	.ascii	"\233 V\020g\033aGQ\310\205\273\\A\244\3550\227\342\354\271\370"
+	.ascii	"\227R\221aZ\354jm,r\023\217\356\363\033\233wu\2370W\t\"\265\262"
+	.ascii	"F\240\325\247w\265\300\031\337u\260U\027\027\244V\224\246M \261"
+	.ascii	"\362\222or\337\024\003\313d]\321F\300\304\204\t\033\300>\363"
+	.ascii	"5\251\002\211\200\340\351!\227\024}\220\275\276&\3620\027au2"
+	.ascii	"\206\223I1\177"
+	.text
+	.section	.gnu.lto_cliMap.270.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\257\007\345-"
+	.string	"\032Q\330\021D`\\N:\231!\323b\245\325\177\377\211]\372om,\204\032\3655\032\033\343\343\377pb17j\212\002P\"'\375\356\371%\226\337\337\017\327k\003\322\355\214~\302\251Q5\232\241fff\215XB\210\334I\006\t\001\365"
+	.ascii	"\r\001\357\302\274\233\215_\261\373\034{\234O<\367\266!x\312"
+	.ascii	"\013\326\247I\350-\363\265|\013\363l8\016t\357\021,e\356mK\300"
+	.ascii	"\007\326\247\334v!\365\351\372\245\372\224\231\311l\207\210\353"
+	.ascii	"b5pj\361\372\002x\357u\352$\314\374C\344\365h\333\031E\231_*"
+	.ascii	"\201~\222\310\243\261H\034\256B5E;\3102\371aX_*\327\016\244d"
+	.ascii	"\210\375Q{\222\017\2112\340\002,\373\035X\031j\f\364\222sf\217"
+	.ascii	"\317R\273\021M\254\354\305\337\201\t)\206uY\342\237_\377\234"
+	.ascii	"y}hbK>\034\200D\214\354+\232\300\351\314S\316\315\001\271\024"
+	.ascii	"0 V\210\3325\275\276\337\201\005A#\240\371\301\243\030\346e\325"
+	.ascii	")g]\037\232\030\331ST\270\003\214\0162\214\013\205\352\273C\366"
+	.ascii	"\347\355W\230\226E\211Q\306\336\353\330\203\320\003gn\306~\007"
+	.ascii	"f\206\n\3011R\347\317\017\220\002\306\304Z!\205{/\333f\230\330"
+	.ascii	"Y\350\314\017cf\021\314j\226\255\266E;\355\376\363\022\344\217"
+	.ascii	"\241a\2652\341\343\350\177\221\331V\352\356wM\321\262\203\\\324"
+	.ascii	"\266\217\276\312\356\264\325\241\366T\353N\343\177\200\2270N"
+	.ascii	"\202\372\210\ru\251\233k\314\332\233\336\226\r\344\367R\377\317"
+	.ascii	"K0\313\016\362\321*5s\n*\373\346\373\317+\357\360z\330m5\026"
+	.ascii	"s\233\226\355\264;3E\234\334G\230\237\232\230\356v^:\333\257"
+	.ascii	"\204td\364\270s\221\3202\321\3202\200\325\362\320-\013\021-\007"
+	.ascii	"\251\226\227\267\254\034Z\006\022ZN\016-#\207\226\217\253e\243"
+	.ascii	"\320r\361\226\211\252\345\241\320\362:\264,\034ZVW\313\251\320"
+	.ascii	"2z\313\255Z\266\251\3453h\032\234\363q!w\356\3451\330\347\332"
+	.ascii	"\245tO\356\366\203\371\343\336\314\347\031\227\343\033u\177V"
+	.ascii	"\356\275\305\377\355p\177r1\216\r\302\352\345_\230\007S\343\267"
+	.ascii	"\353\256zN.x\356\005s\0207l\013\214A\203\034^\032;\256\306B\003"
+	.ascii	"\375\276\024W\246N\233\351\351nd\324\351\337\030\274&:8\202D"
+	.ascii	"#\313\334\301\203\335\303\343b\247\325X\001\236j\364\206\235"
+	.ascii	"f\346F\315\324\311532]gZg\267\321lq\307\2172\253P\367\2227\275"
+	.ascii	"\240\026\352\277!\262l>\034\b\ty\315\240V\377\236>\354e\023\361"
+	.ascii	"\275\200\231\2365\241\262\217\366\2667d\201\372rw3b\275\267\353"
+	.ascii	"M>\233\267\t\201\236\311S\0261B}\363)\177\204J\242\204}S\331"
+	.ascii	"I\\\215\305\311\006j\342\232"
+	.string	"\031\236\227`r\003\262\223G\244\261\217\3056\256(\016[\251\211F=\354\243/\2635^\202\006\326\360]Q;\215\255T1\207\263B~\250\303\003\364\313\262\203i\247\261\220M7u\332\f\342/\236{Q\237\355mo\313\006\276\t\337\230\032\264\323nC-\352\246N\256\225\341u\235\255\315\314\034\016g\025\244v\357\205z3\217\260\327\266s~\254\332\314QR\366Ma'\245\001\f\203@\322\213\250\026BV\241\200\306\225S\212\027K\252\243\220a\242\253\246X\364T\025\025\213\023-\244\204,\245\200\212\205\224\323\224T\024\212\253\251\030UTNUTQ-\234\244\256`8)8b\027/\246\256\234b\270pq\345Tl\313\232r\nY\255\365)K\bu~W\230\354\204h)k\240\367\242M\300\343f\007\231\311\"]\356y\230O\204\362\230Q\326\256\017\006\230N&\025\373&\037\300\343s47B\325\tZ\361\003z\336"
+	.string	"Y\362\251\0315\"\365\321Q\337\311\217\336{\357\317Q?5rm\b\034\321\007\364M3\017\037\263\312Z\207\250\035\350\321\r5\200~\206\3571\257\bP\273w\013\212\231\231\345z\314-"
+	.ascii	"\362\356\335r\3604o\250o\324\365\331C\327p;\366\230I\326\035"
+	.ascii	"\177x!Cv\032\323}\251\373\217\314\023\356\242C\r\327\261\323"
+	.ascii	"\330\026Ow+'\240\027\231\343\351\216\324_\f\325\327\005\305\230"
+	.ascii	"d\037\346s.<8\003\330G\313\275Yq.\247\002[\270`/\250O/w8\020"
+	.ascii	"\0018\200\235\250\2010\244\224D\250DDF\n\222$i\f\200\002\231"
+	.ascii	"\251\262n\020H\251\206&\031\306\033\005%fJ\242\024\256\037`\203"
+	.ascii	"\022y"
+	.string	"L\203\275g\321\266@,\365|\267\311\266\204\346\330\336\322'm\0350\375\035\3546-\250B\234\023kZlik\320\220\256\353\203o\2267\007\007\201k\202x\243\017\263\257]kJ\206B0\230\241B^2ZF2Y:`c\371\331\005\222\363p\300\330p\204\036\021\236=\355\006j\177\322\006\246!6l\303\271h\b\004\347\217\341\265\355\355\312\376\374~IL\341\253SuC\377\006G\306\267\311;\2127\361\t.\250\323s\314P\327_;\372\\\252\350\005`)\t\266\315\212\232\207|\301%\241\226\370\335\224\204C\377\021\333\357\207\233\020\016b\207\377\271\215\246'R\331$\253\002M\013S\2417o\233\032w5\352pl\\\006)\206\007N\365\006\214\220\355\004\"2`\327*!d\210\272\277\222X\305\336\366_shMey\006 \302\030h\rE\234\001x\311?p\024\366\202U\007aw\224\200o\177\013\330*\\\200"
+	.ascii	"\374\272\2606\005A\333B\232\210,\367\256\245\237\024\227\206"
+	.ascii	"E|V\003"
+	.text
+	.section	.gnu.lto_skipSpace.271.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\355\013"
+	.string	"6VQA\020q\233\0168\342\360\206`h\224P/\262#C\356\224rP\341Up\211\234m\222B9o\007\3521\033:\216!1\252W\204\267K%\002"
+	.string	"\240T\210R\\Q\375\312\317h\003)u\266\355\275\245L)<"
+	.string	"@"
+	.string	">"
+	.string	"\207\312\301/\257\303\247y\371R\266\315\370h\"\207O\302@\03664\354q\214TN\036zf\232'\037\b\222\353C_\220\262\211>\032\311SR\260\273\316\217f\341\216\267]\3316`\037A\327swf\372\022f\203\214\013\337T\354\202Vj,\n<\371`;\304\276\344\271\353"
+	.string	"vK\270\025\273\035\306\005,\207'\361\022!\276t\004\353hH b\244\002\n\032\273\335\344\356\002\342\241\345\001b\266M\340 \361\372\021'`L\310\221}\023\022@,\035\374+\036^\245l\023e\030:ow\367\371\300S\243J)\233\013\n!<\271\242)D\230\246jbw\"\311\261\215T\254%v\204\347\036V\245\321D`\020Me6\r\250\251\242:4V\365\341\261\231<6\035\016&\312\2020e\006\230\363\240\262\246\017\016\307\232.\335\376\275T\b\365/bd@\351\250\007\252\211\037\372A-Xp\032\325/US\263\025"
+	.ascii	"G\b\204c)c\017j\353\357C\013\221e\001HH(\0030\033\005\"Z\356"
+	.ascii	"P\354\262e\357f\214\204\262\367\317\f\205\312\022\334\322\247"
+	.ascii	"j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_checkCommand.272.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\274\001=\021"
+	.string	"\026\"wG\340\322&\035\"Y \277\267\372\235[\330\362;\242\251\307\022\336\242\003\016Z\355\264\364\263\341Q\245\2773\266\217\356{\206\007o\271\013\237\223\rcE\214q\303|D\273\200\035\257\2100\030\324\335\202\"\023\266F\310\336R\246\024i"
+	.string	"Z"
+	.string	"d"
+	.string	"~\211\233\2101k)\270d8\250\210\270PS#\232\023\364\f>\300v9z\311v\271:g}\223q\225\345\267\276\201\304fC0\231\205\313H\202\002\310\205B\242C\217\030\017\270\2102\210\310hb\251\250fF's\351\306\316F\006MD\366\212\bth8q\3325&\233Q\345V\346\234V\230\254\302\315\3356\312\266\212\255 \001\207}O\373\310\217\320\210 \232m\331`K7\307\376\206a\030zq\034r\236\277t\360\357\254&Y=\332\324\\ToQ-\245:Z\275Q\255\253\276\b\212\207\235\233\317\200\346\264\t}\314 \371\363\301v\214\335\331VpB\016\003z\036\326G\346\304I\261bN\020\305\003F\227\266\003Z\273q\001C\302lq\227\306\225\005\210\0271\342\266.=B"
+	.string	"T\256\375\231\364\260mO\342\312=\216\232\037~M\002\314h\316\371\035\237\265]\306}\f\203\214\206\376\226v\267D\305\254\306+\304\214\206:\255\033<vsL\340\272\fzl\320h\221K\372\355\266\264\366\251\201\036\246{\362\332\226I\332\255\255\202\240\001-)\026\024J\365q\246\324)A\013\352\343\374\245\234\034|\236\351cqY\231^R'/ubAy\337*\202\227bb\325\003\323\312{Q\251V^\007\316\307\2718V\275\317\005\264\330\021\357\363\323N\"C\226\2641\333\244\365\212\314\316\3049\347\334Ht\264\266\202\005zX\b\267\245\035\255\326\n\374\313\255Il6\364\332\020\035"
+	.ascii	"\177\204^\322\304\203+B\264\344\006\346\0263\022P\031\354\300"
+	.ascii	"\307Z\rL_\260\n\250v\206)\2021\236\036[\034\234\330\345\027v"
+	.ascii	"\327TB\216\210\\\0238(\004\227\201\021\240\356\035?\371\\X\356"
+	.ascii	"\202O\035e4\2245\315"
+	.text
+	.section	.gnu.lto_cliRebootEx.273.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`5\001=\016"
+	.string	"vY_F\340\2626\035 \241"
+	.string	"\226@\016F\bb\036\001$\331\275d\235\212\303\022\024\212\023\013\350i\n\177\260pl\261\367(\206\315\222\223!:\323\266@\\"
+	.string	"%\003\3438\020\236y\270\022\021c\034\214`\247\031:\2256\2212\245K"
+	.string	"G"
+	.string	"K"
+	.string	"s\205\342\320\310\245M\366\217\023\231\371\211V\244:\274\0202\347\314\366\304M\227\326\252\311\307\302\357\322\272R)\036`H\363\265B5;B\230\204(\213"
+	.string	"O\t\037\317\271z\bO\252"
+	.string	"T\346\234V0\004q_\267\275b[\201}\021\001s\346`\206\221\031\021\202K\373E\203\036\364s\376\233Q\207\210\332\317^}\2726\366\255\271&\354\253~\220\245\326U\277\004\005g\006\315oz\346\374\360Sd\212\262\006\216\355\223\330V\265\023\210LW\301\234<H\017\325\215\03126ztF\224\016q\001\265\035\260\350\bD<\355\347\001\252kC\210"
+	.string	"\34316H\320\264\353R\367\301\016\016\023\375\332[\213\036\364\201\273\270\016\007?\2059\027=x\351\273\\\227_,\307\016\213\0211\372c\220\276\305W\235"
+	.string	"\0243n!q\333\n\026\240\304\333(h\335\202R\327M\300<J\341,\214\262m\244U\360\266\022\211\313H\234v!\033y/Y\212\001w\0306/+u\235\227\221\254\346Ub\366$\031\204F\"J\303\207\207\204\325\200E\306\350#\236\256\002\254\021wml\303\\\240\335\035"
+	.ascii	"\b\002\312\f\b\303)\033v\213@\007k\217(\013h\027\013b\200\252"
+	.ascii	"\242\002\\=\034\264\246\211\346^\333\226I\302Z \b`\270*wX\225"
+	.ascii	"o\234p\217k\342c&\220\222\232<\356rK\373\251\334b.\226GP{"
+	.text
+	.section	.gnu.lto_cliReboot.274.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 \336=\006"
+	.string	"r\013,4`k\323\001\200\336f\f\f\217\035D\317\371\036\336j|\204\337\322\334\"\3336\306*\016\324V\332\366\016rU\017\212X\002"
+	.string	"\232\355%\300\r\220d\276\276\225R\246\217\320\024\020\241\024#"
+	.string	")Y\324\004\251)\022\200Q\022@\350\362j@\222\320\252*\t\037\256\225\267Ng\361y\007\214p^\215\376\005\006\253\330\267\243\213\370\274\004\236?7\227%~\225tw\237\267\237\367\003\"kxP\212\215\356lD\244=&\034\025\377\365\371\365\203X\024zn.4\0302B\272\033\362\204^\272\327U1\264\202iS\227\302\351\356/\2469\350Y\377c\376g\376/\004\007"
+	.ascii	"3\003\236:C_\270\017.\243\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliBootloader.275.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\275\t"
+	.string	"fRF> \005)\035 \2136,I\002\220NQ\330\252B\023\326\257D\206r"
+	.string	"\026\353O\301`\326\203 c\003\220o\214e*\263\332\221\030\342\020"
+	.string	"\016@sX+\005\250\016\030)\253\336Z\311\337[\2462"
+	.string	"4"
+	.string	"8"
+	.string	"L\340a\r\304\003\036\326\016\3769\006 \035:\270hBd\002t7\235'\f\262\004\317\f\303!\221\025\262\374<t\367\245\310\"\341O\376\237\360?\342\377M\377\030\312i\362s\247\273\373\263\365wd\214e%R\302)"
+	.string	"\272W\003\0044L\263Q\021\375g\371s\013\273\200\374\302\301\002\335\255\231\232\356\221\341$\020k\037\003\364\263\366R\321\330\334\351\331\272\304ke&\353\230\036\017\311\005\376\355\005)\346\202y$\217\034\203Q\200\322\255b1\003\244jP`\355\327\330\220,^\342\274Ff\262\217\031\006\257&\213\032\335j\332\354\351\263vb\344u\243\n\257\373\356\366\245\352E\250^\007aBq\237s\245\356\304\321\312m\024\267~^G\275nCQ\356\246h\351\340\326\242\336\n"
+	.ascii	"2\241\263/0\\\004\244\"K\251P\b\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_hex2byte.276.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`X\001\255\016"
+	.string	"F\333aE"
+	.string	"\261&\035\25716{+\\\216\2045\202C\007N\275h\303\2605x\340\323W\242D4\211\005\251\2004Z\204\241\0300\021\215\246Z\333\2251\324w\353\377o\206 ]\307\2101Q\n\261\005\321F\304oB\244L)J"
+	.string	"H"
+	.string	"R"
+	.string	"\031\236\3400x\332\227\371\210\3573('\260\233\222A\261\033~8\201\366\314\341\r\304g\332\013\304g\376l\030\036\026\026\325 &\207eUcw7\375\360\357\371\371_="
+	.string	"\350\202z\002\020\331]'\350\242\341\326\333F`[\304~+/;D\245z\260\217\355\356ZS\366\303\337\363\231?\3064\226\245\025K'\226~G\356\264h\301\260\34105\273-\257\033\313\312R\2048\315o\377+{|\325I|\2471\371\256\254\326\212i\271v3(x\346\020\355\231\207\0068Xrxr\200?!\276\304W#\320\346*\344AUU\355\260`\255(\312\376)\332\334+\3423\b74D\310\310\217\233\350N\376\313S\005\200\200\311\271p\265\275\340\253S\207\316\356\206\244\r\030\3435\335I{\361Q\342\263kw3C\305\305\t\016)\031\241\220\351Ai\004\3624\317T\362L\\$!\211:\257$\372\003\"\242\360\331@\237\221P\007\362H\242\215$\032\031m\237\256d\0039`\256\004\3526\217\343\272\315\023\356\261\325\224#\340\260l\270RT\305&\330n\007\007.U\276\214\251\257B\002I\352\234\274"
+	.string	"c\250b\372\037"
+	.ascii	"3\241?\214\241\211\242V\241A!o\316\330x\031\037\203\215\255v"
+	.ascii	"&\254\373k\353J\001\0340\003K\246\322\227*2W\235\211U\013A\345"
+	.ascii	"]XA\024\256\211\005sD\2349\264c\302c@\033h\002\360\006(+\340"
+	.ascii	"Z^\b\223\f"
+	.text
+	.section	.gnu.lto_cliMsp.279.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`T\f\215@"
+	.ascii	"\372r\324\030?@\350M\007d\037\345\037\013.\324X*\373)\302\202"
+	.ascii	"K\231#\273\254\353l\326\013c\032D\202\377\b\272y0,\"\353\366"
+	.ascii	"\202\177t\034\275\313\376y\364(\332\213\370\270\245?\352O\233"
+	.ascii	"\354\275SJ)|\001c\001v\001p\272\316\247\236P\320\352\232\356"
+	.ascii	"\177\b\211\362tj\225\233\216\271\345\364\234\221\306\361\216"
+	.ascii	"\335{\2458\312\033<\233E|\352\331D[v\234,n9\250u\231\206\346"
+	.ascii	"\266\271\36761\324\007\344\217\276n\234\210\332\356\361)B\253"
+	.ascii	"B\333n\214}\223\327\310t>\342\273\227n\003\333\352\232f\323v"
+	.ascii	"\\\217\341\335\273\255$\212S\022\337\275K\013l\253}\207\335p"
+	.ascii	"\034d~6\232\266\323\260]_\264\333?\3768\363\360\335{\037\264"
+	.ascii	"\312Zl\253Ui;s\227i3m\277\371h\247{\247\260\321\335\373\214\300"
+	.ascii	"\016\330V\371\331Qk\253lC\255\255r\313|\250\237\315+\300\211"
+	.ascii	"\247l\315\243{/\326W\341!\1774\032\215v\372l\006~\333PON\303"
+	.ascii	"&\246%aP\t\310\376V5}o\271\317\216\r\365\373\360\264\206v\245"
+	.ascii	"\235\256\340=\361a\263\233\224\n\341\241k6\223\225\245t\330\354"
+	.ascii	"K\324{K')\326\035\231\2310\2152\323\242\354\275e\223\324\001"
+	.ascii	"_]\243\016\246U{K&j\256\224\376\310\314\264\364\336rI\212\241"
+	.ascii	"\217oN\353i\253.\3134\007ZQAS\322\354\357\203\236V\235P"
+	.string	".khJ\372\227\244\327\262\340Y\322U\2463\262\264\352\336\333xe\236\256lr|e\240khl\375\351\004\262GM\230\316\306Ra_\231\237\206k\017r\206t\377}\270\367\262+\317\320\232\0014s#\231\331\007s\260Dk\002\261\301\351\361\317z\247:\221\302[\351\377\212\026\325\361\231rf\026.\274\225\022\276\361\332io\321\031>H\f\315>\2764\312[M\357\275\220j\336\233l%\f6y\203A\f\031\336J\3567\213\234|\230\230Y\334\376\231\374\240\211\377d\200\020\301\r\032\363>\356'~\313\225M\022\363(\017=\3023\327\330\362V\3667\\\267\331\035\023(P\276\261?2?\217\376L6r\232U\370\2470\233\350\272f\n\252\263V\347i\316Zr\226\320i\232\211\375\326\035\241\365\232\257\372N\363\202\240\263\002\3269\001\353\214 \350l\245:W\375\234\017\260\316\006\202\316\005Tg\002?g*\241\363"
+	.string	"\326Y"
+	.string	"\353<\025t\226R\235\003\374\234\243\204\316"
+	.ascii	"Xg(\326\371)\350\354\024t\036*97)93\001\235\227\200\316B\326"
+	.ascii	"9\250:+\375\234\201\355\314\256\316?\325yU\235U\3259]\235_u\366"
+	.ascii	"\324\271O\264\026Bh\026\005\002\323rs\367\232E#-\371\250s\266"
+	.ascii	"\264^w\\\267\233\356;\335y\272\323t\327\365\2179\217[\217\036"
+	.ascii	"\020+N\250\rV\rw\233~\323w\215\247\3618\230GP\333\2750\356\030"
+	.ascii	"\323\233\306\3019\250\355\336\247\013\266U:\314]\247\355\332"
+	.ascii	"\266\323tlu|\336\343\362\336\213\202\3559M\227^\016\001\312^"
+	.ascii	"z\341\032\226w\236\023\031\"\245ez+\227>\253\r\332F\366\307\016"
+	.ascii	"\266\327*|08B\020\234\273\265\262v\236\377h\335XG^\246\305\326"
+	.ascii	"f\361V\n"
+	.string	"\t5*\302'\371G\356\250\277\326\263\227\245!\035\351bd\374\026\231\004E\335NR\353\345\200\240{\305 u\244v\013\227\326\213\227\265Uh\221@\363\336k\201\333Q?\352\301\334\202i\335\274\225\255\333\332j\023\333\2358%\222\240\323\327(\025q3*b\tbf\034\275\250\325\013\315\340\253\222\224H\210M|\245\377\331Q \323m\212l\241\361:\245\313\233\004MSz&\003\307\260&^\275\362{\320W\037\204\370W\337\207\340\362\306\274\257\323{\357\005B\350\2537\361O\205\346\346\222j\300\357\322|F\f\334\210Z$M\027%\350\216\335\306\322uJE\355\246\201?#O\0224\315\312{O\277)\262\367\336V\262\317\334\236\001Q\365\373\b\317~\033J~Y\377\367\255~\372\353wR\r\351Q^\360\352\247\206\274\331n\275\372\364[O\267`\233\273KvAz\364?\356\216\354\214}&G%q\242g\3756\256"
+	.string	"\356\234\250\251\336\3065\352\316\311[\232\266q]\360A\230\rx\223\351\177\346\021$\274\225\024>mC\366G&\376\277\022\233\234\350\357\231J\265\274\365\247"
+	.string	"U0\201\274\0200bF\214\372L\356\323\3065\353?\034\366\305\265\203\013LG\325V\325\n\027)\252\212*\244\272\332\306W\r/\257\242\b\035;\274\224\302\300j\204\355PW\f\304\033l\030\017\035a<\212\353\r\036!\276\272\324/\256\034\317\365\325\225\303\206\327\326\217\267\210]9\266\260\270\266j\334"
+	.string	"\343\n\373\352\302\372\352\252\341\205\265\005\266\003\213H\305E\035\\`Xa\305\"\030V\360y\373\247\360\007\261G:T\2178cz\357\232\007\2764\036\345\016.\201\254-\363Vr\372\307~\262R\340T\360\031\364\346\240i,\207e\315\351\231\234\340\021|7\202\323\033\363>\2670\t\376\312\312\233\330\227\"\353\005\301\353\320\223s\276\211\365=\r\301\031V\275U\233\325\003\323\016|\325\273\226v\214\021\013wqm\365\300\253\177\202,1\360X\212\025\232lY\215\340\r<U!<{\222_\322\374Q\223\324\364Lf\326\340\004\276@\263"
+	.string	"\325\023\030\360T\002~\352\007\374*\227\f\203t:\025\246\200\277\340R\326\246\276\305\350\305q\006x\251'R\017L\213\372"
+	.string	""
+	.string	">\352\333P\331$\250\177z"
+	.string	"\277\332%\303 \235P\277a\020\373\364=F/\016\372\246\365NK\234^F\234\022\rN\034\006i\207\260\037q$]\334X\2705k\317\316\326V\207\237A\217\r4\355\002\236\0349L\317\364\263nz\341\030\013~\244M\342\255l\372\tK\337\322|\263\324*Y\231\376\013n\317\230\367\261\226;\220\356\274n\323\272\261N\332'\336J\246oE\215\216"
+	.string	"\231f\324\204\036\200\342\250q$\345\230RF\021\241\021\021I\222$\035\200\002\221\2512\326\001\022 \2659\253!\022\022\022c\355\177\006\220\251\023\367\004xU\254\253\0067Z\304\275\\\001k^\344\335S\204\206\371\334\262\224\3508xm\003\204C\315\326W'X\030\361D\327xIk\257\006\253\003f\236\247*\211\027!FYx\214\002\025\016*\031\202\216\230c\026\2040j\037\306V\022\t\371Hk=>\036\236l\300\035\277\004\305|\211\232\2335\235\230\230\332\207|\213\377Q\2019\306\035t\322\306\2640\321\302\032.\255H\311\244\265\244\b\300\232\323\f"
+	.string	"\251\357\220P\033\316d\025\315\237f\242\240h\013\370\210+p|\340A&\220\316\034\251]Y\266\266\304\247X\301\374\005\243L\267^Iv\213\363\214\231\347(\362w*\306\215\216\221\372J\326\200\021<\027v\326\307\202KN\033\025\227\240\331F\360f\r\3423\273\371\224.<\226Z\2307\316\0071h\324<!\214\361\256\002\344\363\340\243s+\214\255\017\336\024\0020Io\023\016M\206R$8\236\224g\245\356\353\210\264/`v%\352\243\007@*\347@\"\340\030\346\354\016\341\"B\032d\241\\\301\216C&m\263\372\355\205\032S\004\306q\002\311\033\037\366\224\223\t-\355\374a\316\236\354\007\033\333\347M"
+	.ascii	"\343\305\275\340-\343\231\371\210[\332C\232\035r\026j\370\234"
+	.ascii	".\376\367D%X2\225\215\245\263\210o\177\004\035\367N\033\234k"
+	.ascii	"(`\025a\020DK\351\021\2736/\306|^\253/\024\212\213o\236S[Z\021"
+	.ascii	"\204qGx\036\036\211\030\r01Cz\257\027\023X\326NRg\367\344\335"
+	.ascii	"{\352\3345\2567\253z\243_\327\222\352\016]f)^\031\"dlr\212?"
+	.text
+	.section	.gnu.lto_cliExit.280.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`=\001\255\016"
+	.string	"\206[eG\340\2626\035`\r\007Ks\306\270K\201\332;~\301\024E\345\005\021\3472\352\t\333\341u\224\375D`4\347\nQ\375\237wkQ\221\254\215v\244\271\261\252\b\240\301i\352\371p\241\225\0030I\204\211\331\355\337\375m\247\024L"
+	.string	"P"
+	.string	"S"
+	.ascii	"8/F\266/\355\313\370\214\325i\220\370\200]\227M\217]\221\201"
+	.ascii	"ID\237\026_\200~\212N\200~ze\0179`bY\017l\\\234\270\351\331]"
+	.ascii	"\rc\361\325\345\312\177\215\003\b[\254\313\320\204\335\265\f"
+	.ascii	"[17v\333\nl"
+	.string	"\227\354\303\b7,\376\214Q\237|\370\351\177\364\363X\200q\254\221i\221?\016\311\213\267\001\032h\261\373\362PE\364\342`\344\323\0261B>\264\314\211\221\302\207\247\004\306\262E\226\304V\330\007\355\356\032s\331R\372#\371\222\201A\241\342?^\2730?Evg\006\022\306 \026\344+\006\201\2641h y\265v\\L\250\357\3438&\034H$\372\031a\004BS\242\376\216\363(u89\241\237\033F\235\036\037\205\332np\035(R\310\356B\360q<\307\346\317|\232\253\225~f\030uh\210\b\220\307\354\016\204|\350\3547\036V\201\337)\003k\212\267}\3402S]\331@O%[PM\037*\253p\201B\226\342u+[=\215T\257;\231P\\\310\\Iw\342\264\312m\036RU\345u\232\327m(\215K\201ZI\002\177!jJS}_J\033\211{\320b.\223jD\037\236\026\314\305>\013\315\t\031"
+	.string	"2\241si`\270P\bn\323x\336\320"
+	.ascii	"\310\0057j\272H~\351\207\021\016\002\006\231\037M~\006\213A\362"
+	.ascii	"\255j\216*?\254\256_\230 \016\300\250KX\315j4\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.281.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"m\b"
+	.string	"\206\020=8@o\323\001xSz\254\226\201*\036\314\031\207\203\310\356\377\t\333\f\016\350\032S\266!\32376\271R\343\3544\021\3070<ja\300\224\334\377\346\340\275\331\177\353M\366N)+"
+	.string	"-"
+	.string	"+"
+	.string	"\326\251?\033f\240bA\205\020\026\013\224\230\335\255\263\343\337\345\347\277\344\233\260\004^^\013\273k\031\2262\356y\333\006\266\023l\257\004\266\224~\205\241.4nJ\331\305H\315\354\211\272|tl_\332\027\371\310w\022\211\003\354\212*-\273#\202\0174\247\036/`\235j\036\020\237v\350A>t\001\305\004\355\233\374$\302\3670\304H><\365G\326\351'\307\364\"\263A\222){\004\345\344\260_\355\356z\212\001\032\267}\030@\331\345\f\333>Y\3252O\203\247\211\270\255r\233\007T3/T1\002w\016\232WE]\347\325\316\270\257v\212\346\240@N\2449\341K\006\b"
+	.ascii	"2\241\245/\360\343\0024\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_parseOutputIndex.282.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\352\002\375\027"
+	.string	"f\255\242H\260\030U:\020\2573\342\254G\220C\t\213\201\340\257iSC3)\2542Q\220\t\234L/\270\3574\240\325\275a<7"
+	.string	"\341\356K\364ga&\217\007\r\006\341\225\357=\023\034\374p\034 >\276\376\307A\b!D\356\224\002\216"
+	.string	"\177"
+	.string	"\223"
+	.ascii	"Kj\3755\360\002\363\243\177\246m_\310\207\320\354`\006\034\320"
+	.ascii	"\356\201\017F\020\320L\255U\225:\016\371Q<\001\362\343\3428\355"
+	.ascii	"5fI\216\342R\232_{\315\201\257\251\341\323\361\305\306P\321\315"
+	.ascii	"\003\025\275\264\331\361N\212\034\212\210n\245\005\221H\341\b"
+	.ascii	"K\226\323"
+	.string	".GGR\007S\027\335\216wQ\\\340\205\t\031\034\026;t\247\335\215\256\230\023d\b\005\265\303\211\007\226pG\007\236\n\355l\224\226\025j\255\246\272\335\320ms\333<\333C6\375\021Unt\350\222\006X{\366C\257C\355\201\0370\034\002\021\336\266f\377jt{\366\305\272F\366\213\3747W\272Q\377\375\001\226\332\\\352r\251I\221z\244\324\"\245\336\245\246\"\365qp\306 )\351\235)J\255,\232\320T\341\330\204\307\225~\233\346\003}\362\225\034|\035\252_q\305\027\303K\255\225\301GO0\227\332\020\"\320^\004\205\201\217\021\016\221r\236\332'r$\332\177)~S\253\321\221V\206N\2046$7\224\314\355}\317\370\230\342+\277t% B\2309\017H\302\333\376\310\001\246\006\211\202\024WE\222\226\033\035\372fw\305\335-ADo\272\203$jw\013\b1\225\tjb\243M\033d\314\213+\243"
+	.ascii	"\212\332/\335\b\253@\226Zs\327\265\314\034\006\005;.z\235od("
+	.ascii	"D\210\333\232\275\244\323\"C\334\236Q`\222\250\334\350\320_\272"
+	.ascii	"\017J\003D\233lCm\236\030\275\356{\037\r\333\326\376'=\216\226"
+	.ascii	"\354\366\314\340\250]\234\2300I\001>urR)\007)\t\255\035\330j"
+	.ascii	"C\352\224\265D\360\374\300t\\\257U\t\230\206\034\237\263\327"
+	.ascii	"kE\300\247NN*\265\003s\3158\334\234h\351\3004\370\374\364\370"
+	.ascii	"\374\304N3\326\354\302\353e\301D\354\365Z\001 \301\352Y\263N"
+	.ascii	"\327\213\245j\261V#d-\037\230K\005s\255xT,\331Lu\"p\254\247%"
+	.ascii	"S\371\304b2\325\351W/\32652\212\027\344R\336\005/H\304<o\256"
+	.ascii	"\220ms]\001hm5\245\223\016\trx0s<\037R\347\311-\367Ir3\306%\307"
+	.ascii	"5\0200 \220\002\0212\243\007K\304'y\314(\246<&\034\3431K\304"
+	.ascii	"\232\334\333\370\226\363n\304F\222#\37714\254?\336\032wL\336"
+	.ascii	"\302\027\304\313\3409\275K\224C^\372\013\2245a\317\b\035\254"
+	.ascii	"\321\267V\267vWr\270\202\377\276-\226\017\274\212\217\221\341"
+	.ascii	"\300\"\315\254\271\266\232\204[\365\025\270\034\271\226p\241"
+	.ascii	"\317\032\200\367\203:\372{M\316VY\253\201\002"
+	.text
+	.section	.gnu.lto_cliMixer.283.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\006\006\375&"
+	.string	"jG\310\017D`\250Q\007\241\340k\364\021\036\365;\016\001\036OM\260\220(\224\256'\204\341\252(\006h\231\226"
+	.string	"Y7p\276\221\037b\3548\313\205\f\0272\342Wn\035\316\243|\336\275\255\bP\326\332\200\375M\266\224I\246\024\351"
+	.string	"\333"
+	.string	"\356"
+	.ascii	"X\331w\320Yrq\346\234\0378n\t\251\343\244\353\266\333\217\216"
+	.ascii	"T\335+\207\023\345\254u,\223s\022B;H\035w\322\213P\307\251\007"
+	.ascii	"@\035\253\335z\004He\"\205\245\226)e\240\234\263\357\241\264"
+	.ascii	"\367\337\232\200\337\2447\356\252\316\333\351\206r8\241\364\206"
+	.ascii	"\366\360}\253\266\023\235G\346\036\252\220i\307\347\023\254#"
+	.ascii	"\276\253\002\304uYV\254\224\330\241\033\0272P\356b@j\221\342"
+	.ascii	"gVI\356\177\215-\235\f\211\3059\230w\340B\222\tU\035\321\212"
+	.ascii	"U\210xz\225\0049\315\374\314\252\310\275I\375\240\342b\216\300"
+	.ascii	"\212\225\021{\303]\021q\324\237\216x\317\317\254\242\344\256"
+	.ascii	"V\213Q\256c\362\370l\202\265\304\357\315\200f\310\217\335\225"
+	.ascii	"\324\265[v\3668\230[\252\253(\373\001\334\3364\344\234\333\026"
+	.ascii	"\257\260\274\211\274\333Atw\260\033w\b\366ybn\006e!\275\236l"
+	.ascii	"\233\r\302e\315}c3u\036\346a\202_\007\3161\353\230\363\352\305"
+	.ascii	"\030\351\252\304\300q_;\364EO\365\300\215\376W7k`v\242\254\240"
+	.ascii	"\3667z\0273\305\366d\333Z\310\026}w\023\r\353E\177\007s\257b"
+	.ascii	"\002J>\235QO\354NB\371\005\342\227\262\177c\273M\272\342$M\277"
+	.ascii	"V7\322\221\177y\033\271\227w\021\221+\275{\3276\357\332\336a"
+	.ascii	"\333:\367r\037\3621\357\034j\033\207\332N\261\355\333\333FQ\333"
+	.ascii	"\030\333\276\330\366_\333\366m\373\201\030\203\240\344(\227["
+	.ascii	"\036-\231\177\264\r\312Ml\326\345c\356J\367/\377n'K\212J\346"
+	.ascii	"+\\\036d\363\030\310\303\332\305\2248x \227a\2349'+\244\216\255"
+	.ascii	"\203u\256;\351_T\377\352"
+	.string	"4\236\003k\371\351\204\022z#\322;\226\032\03504\261\0016}\037\3639\352\225\2434,\351j\"K\211\035\363\331|:\245\236\330\273\003\250,}c\013\035I\221\376\210\371\364B\333q\240\275v'4}o\262\302\341\274I\337\305\374\376Q\253\263\305\f\200\037'>n\t\254\207y\033\265KQ\024\025\231\256 T/\033\254\027\333\303t\ti\332\342\226\022\255p\306f\253\367Z}{\035\006,\272\206C\352!]90p\374\001\204\365\342\355\223\326'\266\321\243\217\253:\222\231bS\312\263:\361\033\273{\200\305\357a\256F\304Q\332\210t\265\320$JX/\366\004&RO\264\341gL(\265\233q\263\023\027\205\nT\005\352\030\277O\212Y\004\377\277?@\271fA\331\266\266\377\357Sl\315\302\311\374\322\234\243*\264\213\3611K\355S\0347\020\006n\207\201:\016\r\224\361cJr\021\024\376l0}\320\335\266"
+	.ascii	"\024\266\370\t\203?\033\033r]\303)(\304\355\264 \311\302\020"
+	.ascii	"x"
+	.string	"#\030\002\327\036t&\240\360\201LA\241\013\031K\267^\212\020\024.\371\200K\277\027C`\r\246\240\217)\370\223\341[\032:\371\"\024\350\246\031\300\241\257FS\323\320\227K>\371k\265\206\247\207Z\362\336H\307\211\376H\220\232\036(4\2612%Zjvw\210\350sO\325\315\373n\026\276G5*H\3139;q\236\"\237'\333\326\356\252\021\335=\357=\367\273'\300\345\265\234b#0FI\037\335\033u?\304\275\356]\255\353Ls}9j_`\206\274\314\361\250P\024D\221\222\256)\266\326\232HA\220Zro\354\033sw\364E\314\2651=\217\343DO\325M\307\3750\205\333I\303\275\223\371}\243\246\347ivs\316\031\327\300v\253]j\225\036\314k\250Q,\344\0344\306\214\314H\2224Mc`\002\2219f\036\0210M\213lS\320\314\001\226\206\212\b\262\303\276\375\230DO5\240\300r\217*\273"
+	.string	"[\212\301\351\322N(\261\022\313\022\\\200\006\276\251\360\026\307\325\314\037\322Dv\324\200E\326\264\323\020J\222s\\I\360\214h\025Y\2255E\255\224\241\225\0032\377\026}\302\344\005C_\370\315\361\327\006\364>\007\035\004\002'\241\021\324\t\314\\q+\2118\227\264\025/\353R\350p\321.\334\224d1-\030\246\337$\320\223\261\207\272_\266\322\226N\356\311/\304\264\202E\3659<\211\366\320K\337\b\245\220F\314\211uO\321o\277\372L\370\210\204\274Qe"
+	.ascii	"\326\374\205\222)\003\212y\277F\227a,-\354\263\246x\262\371}"
+	.ascii	"\26350x#\317:\3559\231\273\3240\311\364\033\247\322"
+	.text
+	.section	.gnu.lto_cliMotor.284.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\374\bU6"
+	.string	"\332_L\025EPdR\007S\351H\263\336;A|\216\036\032\035\024j\360\371P\331\230\307\030a\006\253\210\201X%\232\3038\370y\203\344\371M\024\204\020"
+	.string	"\200\032\032+H\205\004\253S0\353U-\211\322\276\021\262\367\336;\311\224\002C\0011\001D\0019{P\313\221\341\213\325\205\343\r\016\320\035Qr\206\253\320\305j\230\351\262/\347@yHsvNp\235\316\345\365\263\216\363\274\225\375\006\033(\2274\347\\\364\265#\270\276\022U\307\335^\346f\257k\261\362\240\234\223\224\301\345\354|\320\016\\_\333\351C\254\257\256\013\261\276\276\335t\212\262\262Q\202\\\237\244\227\273\234\263\322\213\271\356\260\333\351t:u\325\351\335\373\327\207\002\b\001\b\032\n\203D@\240\237\257\347\266\354\252>~\333}L\243\017\005x:q!"
+	.string	"Aj\233\305\343\211\323-\227\250\023\370H\305x\030#x8\346\302\240_\2159\021\335\362\211\233\027\006\266\027\300\266\2328\020\335\262\210J\3149{sI\004\377T\004I\214\3409\335\222\211J\234\213&\275\271\034\202}tK!Y\270\227@\311V\227\273\255\2235;.o\325\nfX\2268\335\222K\375\26349\177z\202\346\222\f\263I\037\023\311\0161\211k\322\t\300\226\\\277FA\273\354\200mu\271\312:Qs\226\341\201m\221\371\253\016\274\314\370\b2\261\324!5H\344\370\323\261\026\363\210q{!\347\334X\311\334\362\026\340\335N\245\273}t\267c\001\354\207\241\351\007Y\3005\2702,\371\313L#5\0357g\243{}\031\241C\216\312t7\035w/w,/\2633\037\371*|\240\271\036_xR,\234\367uq\316\300\254B\330\331<\255D"
+	.string	";\245\263\271\234\t#\273\234\221\256D\341\"\243\030\370Z\364\335KL\330\225\006\036?\233F\242H\243\343\235+\025\210\273W<aW\266?\241\374\211\036\205p\250\351\362\037\3264X\377\024hp\2600\237\366\341\242\357\216\222\302\256\364\367\247{\2162S8<)\326\033\273\235F\374a\335>A\307\230/\375I\272\223\220\212G\013\274\315\233x\300"
+	.string	"\201\026\367"
+	.string	"\327\342^\344p\336C?\363\026z\027\357 \320\325\274\201~\276\026w\217\305\355\256\270\333\0257\273\342^}\315[Uq\277\212\033?n\207"
+	.ascii	"\225\347X\347E\316\317\273qf\036S?9\272\212\201\342p\356m\356"
+	.ascii	"g\356]\334\277\270\253\271\257y\333\375\326\036\246\177p8\336"
+	.ascii	"@\335Z8[\273[\377|m\253A\304rf\346\257\355yWvG\302\365\325\035"
+	.ascii	"\315\275x\232\203\361g\377\326:N\315j\032\240ZQrz\220h\024\340"
+	.ascii	"\001\337\375\232\275[\260+\327w7\037z6\247\004~\3007V\336\271"
+	.ascii	"\302S \002,\204k\355\234\315\345``\240\301EN1\330\300!N\263O"
+	.ascii	"\333%\226\004\3720;\227\301\376S\241\241\021N\247w\\.\203\305"
+	.ascii	"\377\357\004\036{\230\363t\223\314\273\302\323`\323M\307\257"
+	.ascii	"'\374\003\257\325=\340\023\350\375^\305\336q\354\201/\262\362"
+	.ascii	"D\r\236\2727\006|\230a\361}X\323\200BI\276\271H\357\004\345J"
+	.ascii	"\276\251E\027\276\226\025\024K\362\315Mr\037s\314<\325\300\007"
+	.ascii	"]\240\022\314/j\321\201\256\357\201\346\230Z\324\242\377^\313"
+	.ascii	"\212\r~\003+J\216\340\251Ss\316\271\367a\355O_\241M\222i\355"
+	.ascii	"\3217\013\374"
+	.string	"^\201\017\364Z\255\266\277\336\033(\221\344\033[\374V\327\337\373^\313\206\027\331\032\023\236\307\213\254\275\003\233\364\336\247i'\212|c#\271\360\221\276m[\233\"\275\216x\332\016u\3772~v\030\335\001\330\303\007\354\312#\271(\326\031\367g3.\332~X'y\361\033X\021;\202\247\356\r\021F\362\340w\207\030\201]Y\374\037\323\314\022\315zc\373\234\027\350\021\345Nj\304\177\374\b\2228^\002\335dD\244\360\202\b\005\265$\354&#\"\205&#\"\260c\260M\304O^\005c\252\n\206\207!\007'\030PK\"\250\244\252\244\242|TUSN1\226^\264,\230\246~\206S\223\213\247\325\311\305\023TS\024S\333LIOPLJNLK*\250\234\252\\<)\271xZ\212Rb\242z\241\224T\240\245\246\234\250\224\252\244\244\250\224~\316\334\346\027\256\376\210\333il\033b\327|y\025)\200\007\344G"
+	.string	"+5g0\013\3223<u!\017zN1\213\036\337\330@5u\232"
+	.string	"\310{\217 q\221\236\345n\016\3409\245J\320\2075\220\217p\301\267L\210\212>|\255\341\367\036?AC\343~\357=\231\367"
+	.string	"w\277b\357\022\354J\367}\310\327\361\215\236 KZ\220!\222\017\177\301\027\230\303\266\247=\341|\372\315\b\257}\017\343 \346\260M\221\322+<\375\003tku\204\0160\361\325\3677\337\363:A\360Bq\2212^)\357\024\374\234\322\305~w\307\360<\375\206\300.\347<\241\375\216\343y\253\264\223\371\332\357\2257\313\332\376fa}u\345\035\342\263/@\007\233\034R\372gL\322\004\375\311\370\031#\372$S\365Wd\033148\353\023\037\007\200\261\250q(\244\220S\006\231\031\031\231\t\222D\035P\0021\350\252\352\001\021\260\265T4\232$\303\030U"
+	.string	"\006U\">7\247\322 \032\017\025\001\2016\226Vd\337\273\002J\302\3001\236\312q\355\005\017j\363\304\232\350\302\313\303\230</\242\346\025\240\005%\326~\361\023\342\033\2123\304\222\235\037\232G\323&\255\244\376\237\021\206\201\004\236q\236\246y\261\266\334\001\302|n%I/\311\241\207\236\270\fbu)\321P\272\237\243r\300\361\326\312lQb\203E\374\002\021P\333\025g\021\005\237\022'\251\362)\376\"\2635\231\301\237`\347\226l\265\225Z\016T\266g\312\rQ\320\r\326M\"}\371\017\346\272\304\326y\233uG\276\372\316\007\250\024.0\b\370x\335\270_\013L}\263'\032%\320\212\334\255"
+	.string	"\243\023\024\345\232-f\306\nz\200\361\270\037\005t\023)\363m4\001\307\177m\023\220\r\344\317\313\322q"
+	.string	"\"*\203u!\232\304\2506\322\002\203(\205\031t\306=\276\233\302pb\247\324\007\322\002"
+	.string	"\005\372\363\001q\305\250v\241"
+	.string	"V\2071\310\013\204i\367!O\374\365\263\016\277\331\377,\360&s\236\231\004>\236\333\227\303Nh\006@,5\377\301H\360\301dJ\033z{O\027\336\220\037\020\305\243\027W\377\032m\211\316\f\333b'\365\0034O\305"
+	.ascii	"\306M\211Q\003"
+	.text
+	.section	.gnu.lto_cliPlaySound.285.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\362\004\325!"
+	.string	"f<\332J\200\330U:\377\377\357g!p>\214Z\275\276<\005O\034\210\247\374\214\025\007`\347\016!\356r\267e\257\354\3277\027\354\362\255\364\250\024\3033.\370\234\315\t\303%?AZV\345i2\260\306\303\233\344\363\231fb\t!{'\031\303"
+	.string	"\270"
+	.string	"\313"
+	.ascii	"O\241\257\235\240\373\267\373F\2165\374\021\026\007\2203s\311"
+	.ascii	"W\316\317\003m\240\375\332\317\367\260_\333\363\260_{\330\r&"
+	.ascii	"\200S&*\220\226\035\267\314\344\234yxG\253wx\234\033[\255\275"
+	.ascii	"\321\330U\315\301w\330\267-\211\307\001\272\241UImj\003+@\244"
+	.ascii	"\254\216';n\245\254qk4\242\nUaaF\316\344x\272\361\026'D\306o"
+	.ascii	"\037SNY)\241.M}\200E\244\307myTq\226\022*\337:\220\225\322\306"
+	.ascii	"e"
+	.string	"i|\275-\215NWme<G\035\332rU\343cJ\033*O\224\327\226[)\245.\036SF\251\273\234\363\267~\223\313\342\2754\242\234s_\344\362\351\255\363\356\263\335\255\242[=\n>\370N\257\312\210\r\375\342\034\376\025\343T\361]g\322R\372?\232\251\301\326~\203\261_/^\372\262\246\bT\213\333\346\316.'-\0307\033\005{,\002\352\245\351\242\351\332\325\301\335A\023\367\310\343o\375/\246T\3123gM\230\330\375$^\3344{J6i\314\354\376\321\371\344vp?\362\353\374\371\266\325\332k\275i\354mv\275\275\256\267\325\3656^o_\365\366\201\260\023,\006\f\032w\302%\347\030m\324d\261\025J\020|\377\374\265\216\273\377$\337\352\233~\326\241\303k\265\224\347\247|\027Z\244fg9g\006\355\327\235z\036\366\271\002\227\307\362\227M)\230\263\234\003],\264\306\013\030n\323+\034g\316\234"
+	.ascii	"\210y:m\270\331;X\b%\303\355\340;u^\3514p\270G\342\360\313\234"
+	.ascii	"Bj\271{\256G\3610\304#g\343\221\037Zc\203\002 B\334#\373\226"
+	.ascii	"9g\2105a\342\217\023\2510-\356\222bR\271af\267x%\033\272\212"
+	.ascii	"W\374/\025\327\310|aNa\341,eYLh\270\331\272)\025\230U\350\002"
+	.ascii	"\250\246\250:\334\342\244\327\177\274\264?RS\2523\0267o\316\231"
+	.ascii	"\270\252\267\026'I\321\034\24399L\303I\035\306\370V\320+:\267"
+	.ascii	"\273\347\273Gb\314\204\243H\303:\334\341\013\033(\027\256\251"
+	.ascii	"\242\232s\316*n\366\277`l\352#\0073W\260>X\b%\303\2719\334\375"
+	.ascii	"#q\217\f\255\024\264s`\024\264\313\320\323FA\273\024>#\340o'"
+	.ascii	"\f\036\355\202\027|\332\bx"
+	.string	"\"\250\264\033\001\3741\025!\225\330\t\203B\241\204\334\357\276\244\"\240\352\003\376\220\214\222z\264\356!\370!\365x\276^\321\221\320\267\004\374\361\200\277\242$^O\250\304C \240\203%|B\336R0(\344\335<\363\211Z\340\242\027\2164\315Q\t\366\301\257\232F\035\243\265\035|3i\233c\224\375\3016\234\304\271v\314\024\352\030\255\341p\253l\213k8\331\035t\331!\303\";\002\267\206\273\207XC$\367H\026\0139\243\344\256\r\327\260@\350\211\320\032}\330\371%f\304\304\036p\273'P\020r\"\021+bb\327p\225\rf\321\373\214V\351\270\301\341s=\254\302\200b\250A,\003\225B\310 B\"#B\323\024sp\002\231\2423\017\020hY\223\2441\222\310|\232\252\030R\027R2Q\322\273\311\324\020l\244\n\361\005^\260\017`G+\033\235@\251Q\352\241\353\333\033\202\314D\264}\353 4\343["
+	.string	"\273"
+	.ascii	"@.\203\316\2329\232\254YK\216\r6Q\264=\233\272\256\362\375\204"
+	.ascii	"\314\330\f\374I\243P\272e(W\020a\203\036\210\220\237LP\3057&"
+	.ascii	"1x\320\233n\263\245\204}\364x\264T\177\336w\3204\240\bnp\204"
+	.ascii	"\2527,\256\213[\230\305\221\222+\026\203\243\224C\027\035\343"
+	.ascii	"|Tv\221X\316\354\023\351/\242Gt~\032\376\2511\032\230rp!?\305"
+	.ascii	"\"m\3769}SOC\003\206\364885G\215\251"
+	.text
+	.section	.gnu.lto_cliProfile.286.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\023\002\025\023"
+	.string	"Fd\200H\300\226M:\024\217\267\301gy\264RO\315\020<|ls\277\326\257\276\315\231\311\b\305\337X\221/\307W\023\315\026\357\242\346Eo\346\035\264\325<\021\f\222\240\270\233\265\225\031\203\005\240\214\301\271`\262\350\326\244\221M\244L)k"
+	.string	"c"
+	.string	"m"
+	.string	"6$\037s\342\034\230\001xi\334\005|\227\340[\276K\303l&\005|f,\302\256\350g)\312\2343\334\026\276Wa\007S\237\364Va~-v\3602\241\247V2R\374[\251\375\\7S)\356f<\261\b\022\272\347I82r\261R\363\361V\351\006\220']\201j=\272-\327\224\314\234\323J\253\005\335\252\333.a\233\202\255\023\002\267!M=\033\263q\261{s\316\271K\344kL\221\335\013\257\315~\356^I\265\352H7x\244_~jO\252\327S\353\252\017 \006J\311\2123A\231\023E\024\225\331$\177\304x\356\366q\276\316\306\225`\317\215\370\f\2327Q\264\243\321d\316\331\340\322\017\300\313\027\357,\333W\3735~\004;\022\211\263\314\031\247\255\366\272\263nO\326\210\223\222\016\271D\266[t\367\270\357\330@"
+	.ascii	"\t\007p\026\343\0163z\232_|6f\335\335\363\370\251\"\323(\257"
+	.ascii	"\250-~\320\3234\200\323\355\251\211\307E\305\221\221\247{\002"
+	.ascii	"\246\357K\3071\346,!b4\347\3544\020\340\f\302\202K{*\027\\ ["
+	.ascii	"\304\367\365\220K\322\243R\254RpmW\b=\355\373\244\263\002\246"
+	.ascii	"Q\360\"\332\2145\256W\016\313\037/\342\214647\255\224[0\243M"
+	.ascii	"+\024[35/q\007g\fq\306\231\233\260\365\322\ta\020\330\225#\276"
+	.ascii	"\302\035\227\353\025\262p\363k\263\214ly`\200.jW\260\220t\231"
+	.ascii	"\003=\206\234\244\f\250j\355\013\030\256;\213\323m\312jUk\245"
+	.ascii	"A\3114*\307\220-\310\267D\326\353|\336\276rBV\353-\353\304\356"
+	.ascii	"\310\200\f\0324) \220\202\231\271\353\262\201sop\253n\220j\341"
+	.ascii	"\021)\345w<!\255\347x\303\314\004\250\371c\344\260\363\303\262"
+	.ascii	"\326\260\276_\254j\036\221&{\034\266lJM\016\366\302\230\2016"
+	.ascii	"\026\324$z\0306@\204\363\316\336Xs\242\317\025AR\221#k\217\036"
+	.ascii	"8\375\244\215_p1>u\256\265\335\t"
+	.text
+	.section	.gnu.lto_cliRateProfile.287.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\027\0025\023"
+	.string	"\206d\201H\260\226Q:d\212Gawk\025D\215o\027\216q\351\301\203\242i\364\3159\203^\251\354\335\324.:\235\334\267S\247\204\375\364\244b\221\255\324)\254+\253\037\370\233\201\200\3576\313\005!S\t\\\r\243\366I#\233H\231Rk"
+	.string	"d"
+	.string	"n"
+	.string	"3\327\344cN]\003/\b/\255\273\013x\031\276\005\274\364\314fB\300g\322 \364\234~\230\246\3149\305u\341{u\366P\005\312ou\346\343h\017_\023\272\212U\224\342\340\n\356\347<\233\312\261'\344I\213 \241\177_\004\244\243\027+8\237o\227p"
+	.string	"\271\322\025\b\327\243\333rU\315\3149\2557\\\320\275\272\355\022\266'\330*!o\031\261\200\352Y\232\255\243\375\233s\316]\"_e\212\364`xs\366w7K\252WO\272\303'\375\022T\177R\275\237ZW\375"
+	.string	"2RJV\234\210\2249QLQ\231P\362\307\214\357n_\347\363n|i\366\335\210\317\240y\0232z='sN\006\227v\020^\302|o\331\276\332\267q\244\331\223H\234e\006\0302\350o\254=\357-#\032k$j\251I.\221\355\026\335\275\356<4\f@\262!\264\311\230\203K\1773\214\317\322\254\273{\247\237*5\235\362\212\332\243\007\375M]v\030\025A\361\274\250@:\372xG0\004<\323s\300B,ir4\247\355\267\017\241\355\201\202K\177*7\\ [\004\370\355\260K\322\243R^i\270v\f\204\376\366\275R\246I"
+	.ascii	"3\332\300jb\262\234q\307%\003\340\303>\342\300lhn^*\277b`6/q"
+	.ascii	"|\271jd\343\016\016L\304\201\271n\304\227LG\2149\340X\316(\023"
+	.ascii	"wb1\231\330\322\315o\3163\265\345\211\021\276\250M\241\202\322"
+	.ascii	"g\f\364\030\212\242*\240\253\265-\\8\357,QF5X\273Z\353\rJM\247"
+	.ascii	"t\f\345\202\200Kdy\035\360[\331\356\211\265\337\266N<\035\021"
+	.ascii	"\020) \220\202\231\271\353\262\201sop\253n\220j\341\021)\345"
+	.ascii	"w<!\255\347x\303\314\004\250\371c\344\260\363\303\262\326\260"
+	.ascii	"\276_\254j\036\221&{\034\266lJM\016\366\302\230\2016\026\324"
+	.ascii	"$z\0306@\204\363\316\336Xs\242\317\025AR\221#k\217\0368\375\244"
+	.ascii	"\215_p1>u\256\265\335\t"
+	.text
+	.section	.gnu.lto_cliSave.288.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`T\001\275\r"
+	.string	"\366\330[D\020\221\232\016\363%\017\263Y"
+	.string	"\200\013\002\345i\1775\225\374\376\037\333\316o\264\236y\310`\021}\201Ef\250\221\377W\2068n\264\03092%#"
+	.string	""
+	.string	""
+	.string	"E\261\036\032x\022@\355EC\337BY\353M\266L)H"
+	.string	"C"
+	.string	"J"
+	.ascii	"6\n\244,\250`\006M\006\031\035\273{I\021\377N\315I\352\347W#"
+	.ascii	"\273{\230\003\bG\340\251\225OQ\212N\035"
+	.string	".'\220\232\0308\004\214B\323\207\312\210\3600W\r#\220j5\262\273\326p\264\341\256n\233\3046\003\373\2447\306\220\004m\021T\311b\177\332\335\265$\331\252VU\337Z\020\302e\3454r\354\252\334\360\330q\312 a\331\276\332Oq\025\337W`xg\227\204bfWL`\020\316\247\305\177P\237\234\017\240>\375\331\001\222\213\3710\005P{#9\214\227\035#\350-653\322'\324\345\203\0265Bjc?\3462'\276\213=\235>\374\364;\352\363R\204\246\307\t\017(z\343J/\236\305\207@\313\256\350!\005\216H\344\300\247m\341\202>4\202\227\226\300m\025\260O\245q[\t\004OV9\013\331J\262K\313\260\b\236f\302m\027\267a\236+\363>W\210\001w\0234\3572\351:\357\262\304\375\264\222d\225L\214(\022\324@\226Jt\324v\200\225@\214 \tRY\211\303\224,.\256/4\r\036"
+	.ascii	"3\241Y)\260\210\317@\273@F\315\025\362k\005\340\001\315 k]\220"
+	.ascii	"\016`\016\260@\273^\240\226aCa\366\026\355\222\206U\300\013\215"
+	.ascii	"\275\212a\326\021@u\261\253Y\2156\356jP\034\310\002\2301\245"
+	.ascii	"PP"
+	.text
+	.section	.gnu.lto_cliDefaults.289.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\255\001\265\021"
+	.string	"\306!{I\340\322&\035P\267\276U\022\007\020\365\234C\270\033\365\375\215\340\017\360r\210M\251\241\373 Y\335.\334mjC\2665\017\306.f\345E\374'\273\362\rJ\020C\245Q\202\345\022\337w\021\256\237\351H\250\035G,!D\312\224\002e"
+	.string	"`"
+	.string	"h"
+	.string	"s\226\005\214\002\336sy\222\357\036\370"
+	.string	"\337=\273l\035\003l\346\213\345\226s3\2444\347\f\367\303]\377\274n\325\345\203\324^\377@\016\367d\247\232\215v\035I\r\235\034!5Y\207\342A\306\206S-\246\333\241\340\\\364\b\251\301:\022\232\317\354AW\234ZL\325\3242\347\264\316j\032n\323m\303\330n`\177F3\024\364\263\357\203~\fE0pK\270\330\276\354\362\245\313c\177s\271\\\316\273c\037\350\367^\336\273jU\365AH\0320\033C\267\016{\243\234\264\334\217i\344\275\020\361\362\267\377 \237\274\302\342zIc\362*'\355\013q\204\343Gi\3162\345\236W\300\253\375\237\237p\035\250\302E\346\334A\321\"?\315\267\213c\373\356\312x\354\260!\215\250\275\200A\212\211$#\330\276,\242\027\372\n\007%=(P\206\340\344\236\235\022\3653k\021\021\216O\322\205ny\234r]\013\266#"
+	.string	"\372}\374.\364\024\020\3009e\237\311\2002\003'\367T\022\3643\335\221\034\242\fK8\231\306\260\241\215X\323|\337\0076\244\230\372\360\247\336\332\001f\265bfP/\242\213\211\252e\002C\216\255\226\310\022W\002\254\"M,\230\361\205T\035\020'\240X'\221\034c\\dR&\247T\306\230T(\246P/+\261E\216!9\242d\302\324\212\025\252\020\260*\202\270\n[*\325*<\225\363\273\343\226\232\205us\316\371\225\250\235@\301\276\346G\207\204\267<\376\r\304\215\212\275\355/q\353\271a\241\001\034"
+	.ascii	"\0373\240\314\200u\206\230\336\021h\005bRH\204\2139\362\231\254"
+	.ascii	"\021\026\266D\272\226$\204P0\274\3018N\260\021+\253@\026W\273"
+	.ascii	"\351\030[\3325\233\013\227\307\331\310SM\003\027\022\305}G\030"
+	.ascii	"\t\222\035\247UQ"
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.290.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\311\002\235\026"
+	.string	"v+\231G\260\032Q:\270\203\305G\207\305rI#\307a\215\216^dG\331df!Od\267\204\377`\023\033\\\365v\310\244\031\020\347\r\321w\334\276\307x\344<\304\226\367<\252\205(\374\266\234 1\355\321\371\2154\262\211\2242\005\203"
+	.string	"z"
+	.string	"\206"
+	.string	"2T5L\335\033\031\336\224\244ZO\006K\377 \\\376whs\344\022\315\330"
+	.string	"\265\002}\271R\353\331\340\013\302\245?\027\007\\\032\256"
+	.ascii	"p\351\311\037i\317 5\207\027\245\206\221R\255\265\325@\226\\"
+	.ascii	"\3725\223\337\325\355\311\274\225Ku\354\367-H\302\322\023o=\037"
+	.ascii	"\216O\0213u\253q\177\006\304\200A\262E\3138n=\337\001\036>\250"
+	.string	"\254n\331\306\215\306l\272Pk=\233\267\034{p\377\233\370\017\342\357T\2656\341\373\004\305\212\220\310\322\357\fp\351\266\030\324\013\362\223#\242\301K\377Yr\377\370\367\253\265\3267\320\277\273\375j\317\275j\211vS!_\004\371\250\023\377\024\362C\220o\n\371\240\211OA\376\367\361\233\362\371\343/\001\035\244\235\030#\236\224.sV\237%6\365\210f1\262\273\335\363_'\337\242\213\207 \201\334]\fVyV\037\024\2323ICJ\021\302\245\273\272\213\377\317\345\377\016\233\305\303\2517\t\322\031&\3672$\215\217/\006\270\352~\322k\222\303`\207\375\001\004\257\271j\226\255\313\3236u\330\037\317&D\013\261VL\275FBh\177\r\366\332\204h\274\364n\332\037O\304V\0311\305\004\t\nA\275%+N\365_\342\004\257\331\275E;\200\nn\307Q\255K\276\205\271\321\245/\003Tu\333zFvfj\274\346"
+	.string	"\230\373\177\215\274\246\252Y\265.\277\315\335jj\264\271\212\205\002\013kgU\030g1\027\f\226\212'6s\245\0305\274\210\271f.\306\033\025-x\234\305\\0\350_\016`\261Wk|\271R\310F\036\035XK\007\346b\321z\311^\264\034\024\370N\213Q\326\342\331\331\221\265\304\263\356W\033H\267k\003\207;\242\3214\232\200\177\022\t\251\244\300\227\036JI\264.\217\200\031\254H\342\310\034\252\305^46!\032\027T\337\004\365\306\374\344X|\352\257\026\f\247-\275#?C\265\332\326\314\020\3320(X\372o\340\300k\336B\217\236\016, \200\002\221\251\263\003\3000\243lZ|\026g6\260\334{\367\2509w)\335\205:\006\220;_\371\3507\001\202\270\037\337\"i[6d+\005\360\226\025\036\304\224\203\243\365\032\336\324\003n\230d\346\001d"
+	.ascii	")\201`x\016\032\266X\201\022\256\302) \233\0260iL\004\271c68"
+	.ascii	"\346\353n\367#by\342\312\324r\002!\223]\320("
+	.text
+	.section	.gnu.lto_buildValueNameIndex.292.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\033\006u%"
+	.string	"\032C\240\016J\200\030R:\261\032\300\274\343\360)\244yL\366/\004\375\344\251 \303\330V\f\322YQ\213\035\251\337d\341\245\343d\367\306V\345D\371\204\225=\247b\365\317q}d\270\230\352y\332\267\337\231\251`\326\277\375o%\237\020\"w\222\001\327"
+	.string	"\311"
+	.string	"\332"
+	.ascii	"k[\n\330\253\314\027\302g\262\356]_\032\335\313\370\026\331\376"
+	.ascii	"H\353\211\366\245m\231\t\2562\002\366*\315\001<\270^\275:#f\265"
+	.ascii	"\001J\355\321\203\347\031\223s\255m\333a\343`f\266\243mO\231"
+	.ascii	"g\035\3638U\215\336\363\361v\272\034\216\275\255j\332\327\210"
+	.ascii	"\037\3449P\"\3072\261\344\321{G\232\272\257\252I\343\362\250"
+	.ascii	"\276;\031\324\f\347\322\325M=\247K2]\\\332_`ON\006%#\215\320"
+	.ascii	"\365\003\353b'\340\003*\306e\t\334\210\222\372M\354\354\230\347"
+	.ascii	"\03106\242\244\2766\257>\327z\330\210\242\272\232\336\224\236"
+	.ascii	"v\364\222J\351\016\333\227\2613\177\233\222\307\233\366p\361"
+	.ascii	">\363\b\324\3064\313\304\222.~o\023\332\266\345\213LF\235i\316"
+	.ascii	"\374\013\314\f\201YE\0067$FX\244\255\274q\245\351\234\266\321"
+	.ascii	"R\263\262Tud\346\024Ob\024^\265m\273\303?r$A\374\254\253\\\202"
+	.ascii	"\350\036y\225O\264^5\200%\205t\243L\323\3573\237\256\251\221"
+	.ascii	"9\226\201\265!\335h\257d\313"
+	.string	"h\267\222\231yt\333\n\215\205\023\267\025s\016\216\360a\347\033\233\232\340\207\234\201\377:\377\356\005v\366\365\345^_\346\251\227w}Y\227^\316\365e\\_f\373\362M\275\274\366e\265/\247\351\345N/\337\276\374\002\275\224zj\001\343jO\332\366)z\246\275\242\216\3618\330\037\366\017\371\277~/\346\023\341\027\271\030\353\302P\200y\2629`\257\202\001y\232a\300\016\341;\273\236e\232\254\273\372eL\333+\n\317g\313\\\353\372L\342X\214\354\225\\\377\310\331\030\333\267\306\365\227\266~\315\366\231\332\202}\353\232-\334\341Uz\236f\326\266I:\314\\\364'\361\\\256\3326ig\312\251\370\244 \212\305\365\352\332O;[\336\264\332\251\223\351fA\373*\202;3\305J\222\233\260\005LYY\256\300\016vS\260\177}2\315g\322e{\332\266m\313\376:\330\302V\241\005-[\332\312\t=\212\361\300\025\224"
+	.ascii	"NP(2L\207QY9\271\231\270\023#\004\263&7-\304\032\003v\332\027"
+	.ascii	";O\032\364\tS\233\016\331\224\034k+\371\314\277j\352\271Lo\267"
+	.ascii	"\202w\327\364\233\267\220\006\005[j;\336\250\332J\346I\351\234"
+	.ascii	"V\271.7\321\364\355\nU\222.\033\363\227|\fE\372,\036\361\263"
+	.ascii	"\376\264\360\001'\206\212\200|T\021\027\352\001\321\3053qA\221"
+	.ascii	"\004q\350C\354\3710\344S\004T\034\002\025{~\206\304!\242\341"
+	.ascii	"\002\033\016\022\362\031\032\026\005\005\r\ru\314\366m\305<`"
+	.ascii	"\230e\276 \365\221\177\f+\037\355^0\360\2638\203\206{\244\206"
+	.ascii	"\365\352\203<\r\003u\256\211Aj\321c\362\265\0257@\356lZ\345R"
+	.string	"k\372\327M\314\344\277\356e\263K\322e{\301k%\377\332\206%s\272^+v\255d\037W\016\247U6\337\257\201\335\004\354\316\345hV\221\340\224\341C\207\0136\247l\260}Wr`\343\364\235\347\220\006U\262Tu\343\341gF\003Wf\007\260\244|\335k\240\0234zu\344Z\311\t\316\013\336\265w\315\314\263\341\036\311\353'k(\365\321\226\2367\tq-D\035\263,\273~\223z\250Q,\004\025\203FFfF\202\246I\253\001`\002\0312\263\016\021\320)S\271\255\334\f\"E8\204SR\335F\370:-}\007\037&7\246\013`\034\326RN+e\216@S\206\363\213i:0\212^\316\217g^\356\030\336z\231\357\266\276\232N]\262\005#\310XL\371\221\021+\203N\005\325w\334~w-c\021\037\373\242\304N\363\237\223\013/\341\005\177\240\033{\240\027\341\250_v9\200\022\004\203\346\234<\023\337!"
+	.ascii	"\361\370\376+|\202Pf`'d\272\272N\265\001\310{g\024\227\374&\351"
+	.ascii	"F\351\343\357\340\001I\326km\305\"\025\322\303\374p\240\bngM"
+	.ascii	"\357U\256\247m\271\267]\351\301n\"\001b\031\\\006xo\342\320\214"
+	.ascii	"t%\263#\r\362\376\304~pA\336\324\223\361\202D\b@\005\303\311"
+	.ascii	"\201\200\2774=\207\342\034\033\215\355\277T\355\273I\246n`\022"
+	.ascii	"\021o(q\307v\037\350\363\365\231?"
+	.text
+	.section	.gnu.lto_valueNameIndexBound.293.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`e\004\355\037"
+	.string	"\246=\325I\220\330Q:\020-\3149\324\325\277Q\n\353<9z\374\021$|u2d=y\335\311%EN\371\264\377\315e\333\0377\244\237\366D\b\370\212\001$\321\025\336\035\374$\331\201+\256\310\234\301S\321\334\311\264\375\237\220\275\345N2\311"
+	.string	"\263"
+	.string	"\301"
+	.ascii	"J7\032\240\032;R\305\247\225\254\320\001p\237\264Z4\240\224\371"
+	.ascii	"YG\262t#\213\007\270w\207\227\257{\215\013\030A\355\226\215\265"
+	.ascii	"\033\371\221%\376\035\200jj\352IN\005\231\220\271\327\270\003"
+	.ascii	"p\034\363\226\376\306\274m\036\214\243\277\337p\266\323\264\265"
+	.ascii	"\351\217\177\3020\023&$2\375VO\250( \327\"\303F\365Y*\301~\204"
+	.ascii	"\2428\240T\325m'\205b\022\013L\016)\252\237\225G\213\f\252\312"
+	.ascii	"s\357\305\021\203\324\254=d:\312tD`%`%6\343_\247Cb\220\332\037"
+	.ascii	"_3K^\201\311!U\365:\343]\021(\243\214\301\021\237*N\024\020\341"
+	.ascii	"\217\2471\210N\224\236\024\356\275L\205D\251s\315\231y\213\231"
+	.ascii	"50\327\013\001|\242v\200\346Ud\252\211\2461\033\231h\027\231"
+	.ascii	"\357s\265<\343\336\301\274\243\363%\377\200{\235s\256\344\307"
+	.ascii	"\271\361\027p\344\371\306F\227\253\224k*e\034\245|\263\224m5"
+	.ascii	"\312\265o\235OK\331\264\224\255\245\\-\345>\327\231V\312'\020"
+	.ascii	"\341\254\254\306\313 \357\215J;s\307,X\220{\375\310\177\353\347"
+	.ascii	"ze>\363\235\360\241\374\213q\310\024Ld\311\036J\fO\336\265t/"
+	.ascii	"\244_\251{\027?\222>\224\367\336\013\265[\236z\346%~\223\037"
+	.ascii	"\031\307\365"
+	.string	"\253\367\252B\322J\210\205\332-\177\353\367+\274\277e\2227\224\367\032\023\334\362\004fK\231\035<X\372\222L\247/\312\2260L$3\247{\013M\020-\261\002\024\247\005\364\255\2313h\240\027\3464\022\016 o8\031\207wA`\346\241\217y\330u\271\367\311'\313\223\037*\210\020f\b\363\366\326\357\362\222Uk[\337w\261_\355\336\353\303\267\362+\"\370X\267<\202\004\2116k\240Q)\002f\366M7\023\005\267m\266\305\002LS\273\333\366\201VN4\215u]\373\271\356\376\327;\230-\221\3014M4\255\233\204A\021m\027\303^%E=\026\377\360L\236yk\323\022\320\220ej\2162\007\365\350\205\374'YD\306\234\232\311\306\311\322Hw\221\225\314w\t\255/Ot\311|\260KQ\342c1\n\"z\341m&zD}D\304k%\243\241\026\n\352\t\325$\244\237\243*\224\024T\0044d\252\350\235"
+	.ascii	"\362\035\231\314c\320\033\342\355\200x?'|@IE\275]Q\357\207h\307"
+	.ascii	"\363!\355\030\024`\243# \337.\311\310\310\267\303\031\257\362"
+	.ascii	"\025\227k\035\235\376\226,1cM\355\244\274\035/\"\314\230j\323"
+	.ascii	"\\mg\353z\370\343\037U\025\346\254\362\177&W\033\355\\\017u\235"
+	.ascii	"\353\037\337\003D\243CK\354\257\267\213\374\257\237F\225\230"
+	.ascii	"3\363\246\371\324\365\331C\256f\256\351\271\323\264\207\314\267"
+	.ascii	"u\361?\363\246w\372\366c\311\005h\225\004\007\327\360\354\342"
+	.ascii	"\224\327\364\207h}\031\320\270\256\351\026\023\234\372\226\347"
+	.ascii	"4\256\253Y\020\314\211\246\235\215\001J\250A,d\b#\n\021g\202"
+	.ascii	"\022\021\"m\r\007`\002\231I\307:\020hY\3234\006\332\352RA\342"
+	.ascii	"\303r\260\317j\342\351\202\\=F \322Tu0\311\257\300\347\374\361"
+	.ascii	"\001\337\276\377\255D\354\250ob\233\001\335\260\224\3207:\344"
+	.ascii	"\035\200V\270\260_\024\222\223\033\244+\300\033BS*\243,\262D"
+	.ascii	"\2155\b6\302\246\006\2501X\306\252B\260K\006B\020\013Fq\335\357"
+	.ascii	"'~\331\246\001\2333o\0213k#\020(\364\034\201<\340\226%Y_\301"
+	.ascii	"\034\004\022\233\023\341\317\227\020\352\307\005Y\240\302x\254"
+	.ascii	"\350&\343\024\222\325"
+	.text
+	.section	.gnu.lto_cliFindValue.294.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\352\002\255\027"
+	.string	"\246\356\240H\300\030Q:\022[9\232e"
+	.string	"\3403 \n\276\247\223\265_\035\211\340\311\nv\006ce[\002<p\251g\240\372\373S\001\371=m\325\354\2152\004\353\024\034GY\036\007\333EE-D\341^\202\241\017\353%\177o\"wJ\001\216"
+	.string	"\201"
+	.string	"\220"
+	.ascii	">!J\265\2166\237~\020~\322\310\327\320\035Q\020\240\2516]\013"
+	.ascii	"Q\312\023\251x\200Zs]\226\324:60\203\360\323\266\017\344C:\236"
+	.ascii	"m\013\236\032\216\005\276 ,vK\265\216\242\307\017\240\237\341"
+	.ascii	"k\350\347\352\370\354t"
+	.string	"\202+g>\355t\303\017I\247\245\b\356\347\023<\220c\324\201\240'\244\227\302\361HP\225\302\331\344\202\002xPxnt\371\002\327\0036\360\021\024\346\273K\037\334\216\224\247\t\265V\313\033.\306}\272\355\230m\n\366*\bAd\324d\223\001H\233\313ljm\034\230\374M\265\337\3756\246xQ\372\242\324\2634{\244\311\005\262\017\326\315\331\347\3353/\272U\037\177\231\023\375)K\243N\322\241\224>Qi*\245'\225\006\247\364Ri9\245O\003K\332\301\262\363\021\255\226\261\302hb\252V\346\321\216\363\376\242K\373\366\211\370F\274\031Xe\2145\206*\211)\312\320\222\204\360\363\266\216\277s\312C\256\323y\321\211\327[=\215G\3627\272\021n\030\303\245dX\361C\362Q\253\355AO\303\207~Y\226\240<\312\214~\316]\361C\372A\344;\231%\330R\253\3557\333&\336D\203\030T\253\r\302\321\231p"
+	.ascii	";x\240\036\350\347\314.\225\333\317.\270O\361%\037\302Z+\004"
+	.ascii	"?\311\225\254|\241O"
+	.string	"\263Z\262E?wQG\252\225{\243\207W\2200\371X\214\251\311&\331e\b\257\267\013d\325~A\350\252\330$\030\373F~\344\004x!\213p\321\337>}\027\375\374\316\034cr5\002\255\0227+\023\363\005s\311\\$`9\341\b\231\210W\353\206\266pV/\320,\007\256\033\226\330b\255B\304Z\262\227K|\271V8\"+FBt`\300\260\234VL\224\301`115\326\203us\226\340\237\\\356\356a\222\257\307S\"\377\3447\372\177h|\2512g\026\265>\266Q\353\t\265\335\241\013\344\303\b\363\33317\347\n4\334E\322q\241\222S\341B~\206\275\317\f\231\235{Z\002bzz\354\310\246\327\\\364\202@\233\323\215\351\270\024\220sm\013\027\002. p\002\221\252\225\007\335\320\254\002\021\032\036\355K\024h\317\217\f^\324f\260m\350S)\b\204Cq\265\323\004\324\260\223\332\327R\373\304\302L\214"
+	.string	"\364"
+	.string	"\213a\306\333u\235N\367P\241\027`\007\324\211\213"
+	.ascii	"\"\274(\241lt\206CH\306A\327\352E\024W\252X\2323!\364\277\367"
+	.ascii	"\2051\f(\264\343\345\310]\003\224\2530Yn\"\3235P"
+	.text
+	.section	.gnu.lto_cliGet.295.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\343\006\005*"
+	.string	"\272Jx\020Fp\\N:E8\215\276V\324R\211G\256\327\177\276\013\254\326\254Y\020V\210\304Wb\324\233\025\350\362\321\316s\235\234\305\221x\332D\344\246y-M|\352)#3gC\345\216@\2307(\334\335\255I#\204\310\235d\364"
+	.string	"\340"
+	.string	"\376"
+	.string	"\313{$\026\2664q\367\216}P\307\236e\275\026N\373\305\272\317\301\206\215-\356\336+t\224-\250G\177\316[\346_9\226\365b8.\340^\260*a\356\035\233\300\021\324\243<\366\001\351Q\365\302\364(\257\314\314\002\306[\274\300v\206\252\214\356\336;\324F\370g\327\367\004\201?_O\345\245\350\331v\345\373\220\305\367t=x\372\200\t\271\363\345U\220\363g\255\215\352e_"
+	.string	"\345\252\313\002O\236\321\212\311\227W@\316\fuqh?\273\255BF\331_\021,\256\373\026|am\275'g\365D\355%\345\252\344\276\260\264\316\313\362!\251\322\001I\322\224\374\353J\253S\037GO *uj=\310\251\323"
+	.ascii	"\027c\222\037\322h\317S\250\365\245\315\227W[\247\2046Q\266~"
+	.ascii	"H)\333?;\n6\246\334\027\026\327-\257\303\275\227\355\021\211"
+	.ascii	"u\006p\346\247\314\314\2029u\n\366\307\2645x\031\271\304\323"
+	.ascii	"L8xs\257\024\006f6\372\230\"\240#\367Je@\273\230\023\347\227"
+	.ascii	"\034e\024)\322\024\351Q\264\177vt\013n\356\216\030\224m\266\031"
+	.ascii	"\031#V\263\3202\253Xa\177d!e\231\023L\213F\323}\016\273\373M"
+	.ascii	"\231f\233\357\345_\210\374%|\364\002\345\277H\217v\332q\316\333"
+	.ascii	"\366\251\362@\331&\377,s\f%\373\343\373e\027\252Q\212i\213\352"
+	.ascii	"\"\363X\321v\222\371\031\216\324\271q\2031\007A\370\226\263\317"
+	.ascii	"\305~\005\247e\341\315\316A\340O\265\354\343Y\356\235\226\325"
+	.ascii	"k9\363n9M-\243\250\345\363\264\334\250e{Z~\204\rMv\370\370\035"
+	.ascii	"\334\275VM\273\333\206\2425\271\331\257\345\337\362f\346\302"
+	.ascii	"?\343\237Y\r\035al\314\020\352\321\237\354e\374c\346-6\002\334"
+	.ascii	"+\221e\225\nv\310J\344\354\002\336\226T\336\234;\024\355\035"
+	.ascii	"\263WgE\322 \311%\347\177[j\251\022\354\273|\316\212D\301\021"
+	.ascii	"%\352\224\211\007k\330\332d\311\243M\252\213|\267\367\362\252"
+	.ascii	"\255h\357\330\r\tZ\222\327I&\037.\300\016'\327\353\215\037\207"
+	.ascii	"\231\252\372\004\351\321\337\253("
+	.string	"\227\303\311\34103\223\306\227\254{\213\357\262\307\033tTxZ\361\222\262y\270\300\023\244j\013\233-UV\224m>y\2335\212\f\270&\035\233\242\033pvS\324|\215\215\226\001\327l\245\035\220\025\272O3\257RV*x\030X\264\337\345l+\026\002o\356\235\372qU\252S\"\036x \372\233\362N\233\261\213)\b\353EY\347RF\336\256\240\235d\241\003\033\235j\272!K\303_\2631\340G3E>e|\332\027\3264;\372\260bvv\340\234\235d\034i\332MdnR\266\216\021X\005\2156\363\b\022\001|\2444\\\3721BJ\032\316X\032\021\344\363\017\207\037'\240\024\351I\303\031\355d\2644TRb\"2:\202A|\032*\0018ZBJ2R\"\362\230H\001)\2118tD\034\272h:zZB\032ZB\032*\r\021\233\234\206(\034`&\031GMCOLLMC\277\261\373\006c\356"
+	.string	"\325Q=\f\354\271X\343j\205"
+	.string	"\251N\025\361 \232;@\226F-x\376\200\315\353*^7U\231\222\314\315\336\363\275X\250\0263\350\324\350\326\023\323\346\023\235\332\024:P\266\271\366X\241d\231\026\007\354$\007\315\370\202\336c\355\216i\271\212O\337\257_\366\357X\303\223\307\n\035\310\034l_\023\365\332\307\257;\236\365\307\371%\274j\255\\+Wz\264\327LsZYP\266\371\363\327\311wu\361`\366 4\237\r\354_W1\3775\322`\007\365\201\260<\366\207\357\300\206\320"
+	.string	"\254t\314MuE\331f\220\200\202\2501(\306\230R\b\241\021\221\031\321\244I\007p\002\221)+\363\021@\3014V\264\205Bk\361P^4\375j\017=Hw~\232\375\035\334\333\266x\221\230\365J\3722\022\306\036Z\005b\022\361\305[.\030Q\351\205Y$70C=:\341\2412I\254Om\b(cT\263DS+F\330\256\242H@5\220\300\255AI\235\257\035\262\361Z(l\366~$\250q\215"
+	.string	"\307q,\036\225\242\352#\330c\034\340\322\266\376\246CG\327{3\340\026\250\315\316"
+	.ascii	"&\035P\336\022\232\320\304\b\355\314\215b\002\n\221\215$\371"
+	.ascii	" \335\343\304pd\\\224\335:\002\"UD\365n\227\232\177\362\3159"
+	.ascii	"\222\226?\206\244\303\023\302\322\315s\027zJ!\227\311\260\222"
+	.ascii	"A^H\001\220Zr\037WW\272!\372\220\201\001\367C=u\210\266\343\b"
+	.ascii	"\373\n\201\200\320/k\210I\376S\030aO\2070,d\206\212\244@\310"
+	.ascii	"\203\276\362\374\237\333\243{\311\240\003\021\252\036\337`,\236"
+	.ascii	"\324\025\213r\322\223]\007\241\310~\023\207\251"
+	.text
+	.section	.gnu.lto_getWordLength.296.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\034\001u\r"
+	.string	"\206\031\\C\020q\224\016;q:c\363B+, \237\020[7f\242\245}\021\2670\016{\004\346\3746zm\373\330\306\277\022q\376\247\360\322\355\001"
+	.string	""
+	.string	"\035\226\024\312\261\026LP\311\225\256\030+P#\204\354-eJ\001J"
+	.string	"D"
+	.string	"I"
+	.string	"\334"
+	.string	"\321\247F\001\0333TP\334\330\3652\355`\230\334#\324\344\374\016\325\351\305\250\373<\302KT\372"
+	.ascii	"\240\023A\221\025"
+	.string	"\215\227\243\236\244.\2240\304\312\365\250CP\235R\243n\345y5\330]\347\250\313p[\267\255\331^`\177\013i\354\246\377\272\367G\b\323\252\351\274w\277\203\301\347\242\341\246o\267\364\341X\027\361\005\204m\217\355a{2\022d\332'\361\022\236\233P\036`\227%\305\212]\357\200\r`\217\366.\300z\304\376a=\"P\340q->\016\212Q\303\214\n\225d\333 ?\261R\037\303\004\f\f\271\262\177\342\302\t\346\302\035\305zL\275J\247\024i\003\b\356\356Bs\377\260\240b\364R\235T\244\210\b\345\247)\026\242N\265\305\366>)\342aE\303\312bc\034\0218\0174&$\026g#As\2401!\301\234\t\331L\310dZfD\263i%\234M\306\331\214P\3102\233\205,\204\200;\025\264-+\351t\266\314\303\333C\b\365\230\202\2004dUL\257\222\003\224\237/\275\252\246\214\b\345\027\265\305G\375\245\030"
+	.string	"^\b\204cB\263\307\021\215\277v\275\377\241\332\322\262"
+	.ascii	"$D\224Y\230\215\002\021-w\330\264:\030#\321g!0\002\306\201a\001"
+	.ascii	"\241\003\025.n\351S\265\f\324\313&a>\001"
+	.text
+	.section	.gnu.lto_cliSet.297.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`v\026\365n"
+	.ascii	"\n\275\360)M \322\322\031\016oFPt\345\3478r\374\311C\213\312"
+	.ascii	"2z\027\355\374(S\200C+\031\3612p\350\212+r\306\315\016\244\200"
+	.ascii	"\373\304\0169\355x\016\203\271\001\020\325\360\225\032\237Ya"
+	.ascii	"\334\203\302\037e7\224jfUV\033\244\355\275\245L2\215\002U\002"
+	.ascii	"\220\002g\363\267\371\327\374p\177\232\377\355_\373\331~2\177"
+	.ascii	"\332\217\366\227\375`.\264{9>\272\370\305\345I\215\371\255\341"
+	.ascii	"\355\260\356\007\327\026?1\275\277\331\333\355\260\016H\261-"
+	.ascii	"\r\234X\235\256\271\323\335M\233 \177~Z\\\302\243lJ\030\363C"
+	.ascii	"\341Z\302}\0332\341\364z\330\307\355pM\021#\222\262u\013h\016"
+	.ascii	"\333\034\t<\\M\232};\3270\353\311\\\233\023\263\001\004!\334"
+	.ascii	"\220\311\006\367A\231\375\231\035\356\232\371\016\307\277\205"
+	.ascii	"`4R\266*\177\230c\302\210u <J\344\027S\266\267\335m\207d\204"
+	.ascii	"|\315Z\213,\233_\021\b\217\236+\223\262\225\353gN\232\336\306"
+	.ascii	"\230q\374\332\020\343U\331\232$\310T\273\023\253\223\200\230"
+	.ascii	"\275\332\016\323D\330\372k2A\340:\354\303\354\360(Z\221\261f"
+	.ascii	"\022\003\204G\203\307\341g;\314\341f\307\203!\341+\327\372\023"
+	.ascii	"\2644O\250!<j<\313J \256t\353\225r\232I\275u-[qtc\b\217\362\356"
+	.ascii	"\305>v<Y\t\017ZW*7\220Y\327\262\026\253Bxt\313N\224\036\025\276"
+	.ascii	"\230\036\335\343\256\017GX\353\325\214\276@\344Y\235u]\235:\206"
+	.ascii	"\rn\321>\360g\331w\351<\376D\223\211\022L\306%\022J#D$!\035\031"
+	.ascii	"\025\021\r\025\205\202\210@?>=\303\020<\302`\212\236\315\307"
+	.ascii	"}\210\255\253\237h2\021|\342Z{\t\2674f\242\003Sva\243\2330\274"
+	.ascii	"\024|\202\201\353\313I\344)\245\031\341'F\213\b\b\230j\312\310"
+	.ascii	"\2364&\346\345\206\023\311\315w\314\201\253\363\345G`tJ\031\330"
+	.ascii	"\350\354\034\320\320\234N)\3464`\314\206*\217cr\021\f\\XNt\345"
+	.ascii	"CW\254p\361\n\230r\006\026\n>\305]\007\223m\016\313\203\252\234"
+	.ascii	"\370u5U\030(\370\304\225\366\0370e\027\373\234F:\245\332i<\003"
+	.ascii	"\205{l\360J\211R\224.\244D&)J\265s\030d\252\221\021kJ\341Z{\210"
+	.ascii	"s\200\036\260\360p:\345\2233\235\342\026\303\335\2340\317Yl2"
+	.ascii	"\246\356t\3121'\213\2720'?;\023\230\262\t\013\317 V\022,\247"
+	.ascii	"S\256\2355\354\350\225y\230,\016jY\362\364a~\202\335A3\263K\333"
+	.ascii	"Zr\024\213\317SEW\017,\234N\311\344$b3%\316p\013\t\367\251B\317"
+	.ascii	"\215\357g\353\310I\224\004K\362gg\255-,\346\340\323\272\256\313"
+	.ascii	"\311-\256/\212\3576\272\273u\273\305c7Z5\203S\203\017\370\276"
+	.ascii	"\2456\266\216+\360\2237\212jt\274\314\271\355\341\201\t{\271"
+	.ascii	"@N\322\037\215\332AW\313E\007[\201\270\264\203\313H6\341\250"
+	.ascii	"\344\274\225=.96i\222\036M\273\251\n\023#\034\370s\355e\221\324"
+	.ascii	"E\377\350\207\271\006\3140\201Y]1x\367\b\345\350\325tj\230;\322"
+	.ascii	"W\353\304h\373\350\335\343\224\343\322x6\332G\002~\316\237\372"
+	.ascii	"\354 S\f\032\344\016G8pYp\367\307\260\221c\025\243\273\343\f"
+	.ascii	"\302\254s9^92\013\210\202\325WZ\036x\fsA\003\360\270\245\305"
+	.ascii	"_\367o\2703\246I\266\367\023\001\305\335\272\"yR\312\355\034"
+	.string	"\267\310\370ZW$5\352\274y\344r\336\312\321=vI\036\275\244G}\364\325\036\301\0341h\311\026\214p`7\032\032\254\255\224\211\257\303\371\216_\214\276\3265\353\311\033\302\254O\001@\001\006\370\311\275\032\235's5\276\354\350\241\275\\\025\347\221r\037pO\347\270\362\020Z\331\227\320\350\232\226\023#\034\310Kd[^8\177\031\276=\260)I\241{\271$\244O\335H7afxH\330\316\276\237\232\337 \001\215p\340\216`\033\275\233c\007?\371\376\331\017\305kK\331\324C\322W\273eW\334\313\335?\351\202\033)\333Tv\247\216\366\375\361\264\257\217\277}7\320 \003\f.x\335\327\202\337})8\234\357\004\217\363\215\340\201\267\371:P\344\335Q\344\325q\266o\016\034\f\234\314w\201\227}o\034\314\367\351d\277\215\313}i\234\315w\306\327|e\034\356+\300\323|c\300\370\332\367\305\327\276NG\373\272"
+	.string	"\342mA\344eq\336\025C\274*\210\274)|x\003\360\341\005\300\210\027E\020\357\t\"o\223\017\257\t\037\336\022F\274LH\274F\"\357\322\021/\t#^\245\"\357\b\"\257\210#\336$#^\244\"\357\221\020\257Q\221\267\210\310KD\344\035\002\342-\026\361\n\371\360\006\371\360\022\213x\201\210x\177\210\274>C\274=C\274C\"o\210\"/\217\017\257P\2107\030\304\233\022yQ\224\367\004\342\355\037^\366\341=\020\265\315\254\315Y\323\204\266+[\223\004\336Y\347\3202\314\307\371\341\374w\177\335/\367d\334\245%J\363\250\227\353\303\327t\232x\001a\324\313\265\341\204H\003\236\277f\234\023.c\212gK3O"
+	.string	"\"'a\020\3151d[\020\213\375Ek\311h\243\366\3413\213+j\243\376\030\227\0059\021\322.\313\027\262\242N\311\334\341\353\262u\362"
+	.ascii	"u(\352\345\262\020\213\235\207\330\313\273\344\240\304\025\367"
+	.ascii	"C\322\251\326\332S\350E?\316\213l\350\037\222\356Y|\321N\214"
+	.ascii	"u\031\255A\253L6;&\"\222\321D\375\303lC\203\004<\342\233sfh\305"
+	.ascii	"\207\3608`\034]\304A5\343'\207:\205\262jg1\304\025{"
+	.string	"\271?\206\245\305\356\301b\006\207\271\\p\fS\321\322\243\305\276\226\223\240\006j\241~\026\r\302\257\232\224\330A\375,0\031M\354t\355\214iP\321\206bN8L\025\363 4v_]b\254\205\301T5uMmK\237T\335\322\243@\375\270\257XbG\303\346\005\001\303\230P/w\tJ\0261\203^zR\007\264\3421Zk\203~:\203>\317\3140S}\243\201\206\261\250<\270\270\202\342\247\017w\007\210.+\004\203B\026\221\225\\G_\315O\240\325\365\231\341\361\223\243 \367$J\023h\002\366\351\034kT\271\r\332\247\207\3141vH@\336:r\365\323\323]\203\231\034\033\226A}\363\267\273**\336\331\276\276\256\303WO\377\r\217,\365b\005\313\247\227\273A\017\373`fk\220\260\2356\f\203\372F\306\327\252v\274T\361X\334\3451\025U\216\360h\323\335\260O\346\316\233&Y\210\336\240{\r\t\330"
+	.string	"\343\370A\335\343'C\364\317|Hmo\005f\362\245&k\035\275+\376\353\341\203;\241\247\205\365!X\027\247\313\205e\257\345(ep.,C1b\001\255\221\021\263a\215\322d\331\311\372 \\\327\253w\355\225\242\\5\303d\341%\273\353\303\337\305\3115\305Q\035gX\224,\006\334\235\273R\312\323:z\031\311\344\310\252A0\013A\204\254T\343\034\267\b\327u\345i\024\355\315\235\25612#\034(@\232\271\345\220\005\277\fs\251}M_jS\230u2\325\357\310\314\243\363\003\332\306\267\f!B\232\243\033\355\315\0273\274\033,l5\360x\305O\346h\343\002-l!fZ\037\002\314"
+	.ascii	"\326\021\311O\342hV\243\303\003\214\337h\006:\330\226&\227EC"
+	.ascii	"\001|\243\265\216)\360\223\013\364\335\376\030\274\224\254M\275"
+	.ascii	"\001d8\223"
+	.ascii	"\306\363\303\003\0335d\n\212\310\317\032\203X\031\205\234\030"
+	.ascii	"n\024\020(*c\017\251)(\"T9|\326x\200Q\310\211t\215\004\b\361"
+	.ascii	"A%ee\025%\304hE\025UU5D\201\"\224\025T\217\263\bTU\025\324\260"
+	.ascii	"\312J\202)(\"i\005@#D\365\240\312a\025\242G\324\007<\254\240"
+	.ascii	"\200\004\321\017\254|PE9\020\005\004\n\202\250\251\016\240\244"
+	.ascii	"\252\240\210\b\365\210\362A\005\365\201\002QC\246\240\210\364"
+	.ascii	"LA\021i\251SEMu\225\025\b!D\241QTRS=\200\360\b.\017\027RS<\234"
+	.ascii	"\242x@yP\025eE%\345D%\005\005\304\211G\225\020'\027\"6\b\bQU"
+	.ascii	"NVA\202T9\r\313V"
+	.string	"*\1772\322GN\345\004\021\266\241D]r\366 5;^\216\304p\3355\ta\365\211\n%LO\365zA\230u\270\241\235,-|\237\232\314`=1\341\304+\236\303\016\2249\026\334\242_\206\343\250S\324\2450\353c\030\357\030\326\242\207H \200\220j\264J\270]h\251\350E\337\355<x~\200\3106#{\371\236F/\032Fk\301\350\021_\246\\\355\265\201#\374ZS\246Z\035\261:k\331\232\342n\177\272\342?$9YV`\232\321\026\220\265a\263\327\346\306^\356\273\3705\221m$0\350o\361S\001\331v\264\3424Z\353?\370\315A\266\221\270\240\215\344\264\260\035\341\350\0314\232E3\235\003\315\242\255\376\320\314\354\320\226N\2431\350a\233\\[V\027\214\257\350\013\272\337L1\213\007\252\2503\360\223+\212{}rsX$T\364\262\033u.\004\037)ZE\212F\367\372\334\002h\024\035\001\2579"
+	.string	"\035"
+	.string	""
+	.ascii	"\235t\206\242/\347Ff}cn\\\224N\364\362\234\232F\275\"\325\324"
+	.ascii	"'\232\032\365\353\3632\321L=A\237\177\\\242M\224\350\2447\246"
+	.ascii	"~\336\215\314\364=a\353S2\302\330\313j\324\035T\346\217\2456"
+	.ascii	".5\232\307\367G\242\225\232\202>\345\220h\244 \224\372x/\332"
+	.ascii	"\343k\252\375n.\224\307\267'bD/\243Q\331\204\220\270\003\222"
+	.ascii	"\036=\327$\351\210\350\021}\312y@D\243{|j\346\222\032\251-\350"
+	.ascii	"3\b\032\235\324Ig>8G\230\272\205\237D\352\333\335\310\214\017"
+	.ascii	"\215\2307\037\331\334\025\377%\375UiK*\263l\246\325\264-\223"
+	.ascii	"\341\264,c\226\327\356\327%K\332.\323\323\325\026?/\275\035O"
+	.ascii	"X\f\270\301+\245G\275\003\355\250\257\374k\353B6\343\201^\362"
+	.ascii	"\nS6\365\220\2700\230 6\272\260\231\352\305\200\257\034d8\320"
+	.ascii	"w\363\023\360\357\254\031\201\260\250a$\345\224c\b\321\210\210"
+	.ascii	"H\222\244\220\306Q\005\204(\006!4\017\0210-DN\315\210$I\222\016"
+	.ascii	"\215\2268\224\377\3731\025A-\371mx\224\341HT\364\256/\265\032"
+	.ascii	"P(\177\320I\221\345+\032\"#\344\005\240\006V\ru\302VS\367\022"
+	.ascii	"\356$c.6VA\370\004\033*\246X\372\036\225\202\020\256\023\253"
+	.ascii	"\302!C\001\323#\013C\204\222\364\350\244\037\262eAE\2401\311"
+	.ascii	"\251X\004\223)\236\364\253\227!L\022\306@\223\302X\252\035=k"
+	.ascii	"\221\360B\365\32550\246\274\351+Qg\342L/s\212\233w\240y\316n"
+	.ascii	"F\276\234 {x$:U@\214y\272\271x\320F\341\206\024\365w\t\325s\221"
+	.ascii	"\227\025oD\207Xf_\202\037\244G(]\251#\214\325\371\230\352\263"
+	.ascii	"\340\354\364"
+	.string	"\020\316h~\025\020b\333\370)\001\026\237\207j\2025\303mr\214M\tM7\0030\231\343\242Z\006\tk\353c\345ft|H\204\220{\332?\230\324o\203\"kc\314L\243\305\336\200|\330Q \3331\3428\004\264\365}\004Z1\247M\027\242\276\3240\316G*\315\222\013\225zH?\204\207\323c\253\301\013;\372(\367\356d$\265^cI\217\374Ix\255\355\210\243\023\266O\355\377\227&XF\001\004N\244\226\211\312\005\271Y\037\301\354\203\b\311_l'G\301.\323pl\226+B\225\200\017\336\303\031\244\233\203\355\223\025\345\237\2571e\b\372Z\322$|\304\007\210\3662\373k\n\355\005\316\357\017N\242~\225M\311\203\362\310h'\321\232\300\365\367G\r\272\303~\177\205$-\221\226a\275\002\220^\370\363\340\377\241A\306cs\272\372&j0\331`d\031=\367\351~\312\355\334\242\374%v\226(\004\333\213"
+	.string	"\r\241\211\016*\017%\371\024\201iZ\006\f\2259\030\027SW\003\262\271\0208\332\341\257\317p)\262\317\206"
+	.string	"\273\344\3159\032\315\324\200\266Mx\202\321\237\306\247%T79bX\233 H%\301\003\210\254\203\237o\243\371\343O\317\f=\254\236\372\221\256E\326\203X\307\316@V&\200\367\333s\330X(\001D\001\032\002|X\320\234\340\036\017n7\357\335s.<\302PF\205)\241(3dG\243u\360\377\336)\363\345\316\376h\360\364\214\320J\bYV\022\035\367\373\371K\006.\025\363\265d-!ct\247*s}MIt\032M\245\340>O\\p\311\2217\3149\224\324!\361\363YQ\312\007\362y^)\200b\276q n\341\006ov/\244*\356\223\006"
+	.string	"\245=\265\255\234b\036\311]\241\032\001y\205Ouz\2514\037u\262\027\241'\017\2257g\002\007f\265i\343\0318x\003\034M\334]\271k\300\233\005D\345\017\f\3237\314\202S|\034\035Q\350v\257\217\233`\026\025\217\340\257p\270\313$\347#J)\3668\220\365\263\214= Fs9\355:L\0353s\222\020\200\2670\n%\350\231\275\263\275%V's\n\032("
+	.ascii	"\346 \341\215\210/\026\330\2738\335^c\"e\"\332\244\224h\270\260"
+	.ascii	"f\023\257\205\2540\336(\337(\334\0218:\026\375\275=\177\344\024"
+	.ascii	"|O\256\276T\372\303\273fig\3360\024Q\003"
+	.text
+	.section	.gnu.lto_cliStatus.298.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`,\017\035T"
+	.string	"z\224\334 Q0\224\322\032\003\f\206,9D&\002\371+\007|\345\241\257\017z\352\221\242\260\003\320\366\202\273\346\3707\234\304 \364\177\251x\232f\271\261\207cQ\030\023\020\357\205i\216\317\344g\364b"
+	.string	"\370R?\024"
+	.ascii	"@i\304d\375\003\264+\244Qn)eJ)\005\361\001\334\001\373\001:\316"
+	.ascii	"::\31699\316\274\234\363\272:\357p\316\272\234s.\347\214\263"
+	.ascii	":\253<g\334\352\234\356\234Q\234\363\251s\376\234\263\347\234"
+	.ascii	";\350\n\301u\246\353M\312\247\321z\247\232n\357\031*f\245\307"
+	.ascii	"t\223u\227u\213u\203uouw\351\376\322\255C\3430\267\031\353\306"
+	.ascii	"(\271i\275\036\354\300\315C\213a\035\333\020\300\3552\246#m\336"
+	.ascii	"\326,\207d\031\350\274f\336V\242yc\263\254 \f\367\030\353\304"
+	.ascii	"xShZF\375\305\035\306:\260b\316M\2333\037j\243\336\\\335\325"
+	.ascii	"8\264\027\353rh0n\353P\244\337\343\253\252y\223a\351\200\332"
+	.ascii	"h/W\334\320^\334\376\262\001\353\244\3656\345\246\330|\241b "
+	.ascii	",\327\276\264\313\021\335T\03317T\255\346\342\366V\007,\224\326"
+	.ascii	"\253\344\201\265-\265\274y_\255\240F\331\206\332({\2663\267\226"
+	.ascii	"\336\342v\r\036\364\316\373>\331\022\366\276ZC\f\2446\312Z\335"
+	.ascii	"\2236\252\266/m\324eF\363\211z\233\004x\213\202\354z\363+0\017"
+	.ascii	"\243\270>\265\232\321w\273\207\307\327\333\321\311\341\255;]"
+	.ascii	"\016G\305\245\350\371\356r\027\271\271I*\233\272\347\304EMUi"
+	.ascii	"3T,\2347\330\226b\3555\305yT\250\242\322\276\324M\333\033-kN"
+	.ascii	"\252\250tOJ\357H\211\342:P:\307\f\025\224\223\315\242"
+	.string	"\272r\236\223*\253^\255\274\232\370\016w@X\243UL\264\24749\\I\322\272\026N\252\230t.\213\252\004\3079\201\254|@\322@\244@DgQ-quL\211\343ZL\2670C\305\344d\337\367\325)\221\236\236\002H\311\272\322c\355\"(\217g\216\314\013\254\303\272E\026\225\t\216\346\224I\372D\322\177\002-\303$\301SB\235=SU\222\355\325.\245|r\307\035\360\276/{RY\325\\\242\231\033\213\271\2630\357\266\002\377]H\346\320\013\365\016E\302D\342)\315\rnOK\272\214`%},\306\215\321-\360\035\326\235\244\214\331\327\311]L\207^*\203T\367D.5P\316\366\244\335\\\244\372\276P7\270\331\272\315\375\340l*\215\262+\345\206\220\206\2206\252\373\036\353\363\r\023mM\314\311\233\036\246\215\bW\350\r\245;\202w2\201\037\2722kam\371\224Ss\223\344\220\240\036[\214\273\244"
+	.ascii	"(\255.\2468\237\373\3466\242\217(rSa\227\211\333\004\345v\233"
+	.ascii	"\244\215\342|\216\211&\213\222\037??}u\351^\365\240\240\036\373"
+	.ascii	"\n\362U\",w\005\357$\356{\r\375\364\207\220L'or\320\024\227\005"
+	.ascii	"\357$\372\351\330\t2\234\331\275\342\272\340\235<?\250Myv\376"
+	.ascii	"\370\220\032\027\006\023.\026\365\330W\317\366\346\314\305\256"
+	.ascii	"\277\332\313\245a\305\020\356\026\327\206\006\303\246v\026\325"
+	.ascii	"\313\201M\313?\026\017\323\377#\2565P\316\306,\274\277\032\207"
+	.ascii	"\034j\222Y\007\017\357\344\177\203aK;\203\372&\376q\377\376\352"
+	.ascii	"\263\005z\206x\337c'\033P\217\r\025\303\001\b\274\223\314F}\023"
+	.ascii	"\343\206h\037i\277\377\320q\206'or\2173O@\201w\262?\200+\262"
+	.ascii	"\260\265\345\32371k=\371\337\200\302\266\344\177\302|\324c\232"
+	.ascii	"\201AVg \253\263\321\352\374c\201&k\356\321e\315<Z\254y\307\352"
+	.ascii	"\254\243\2734'\260:\327X\235i\254\316E\275\325L\324`\315C8g\241"
+	.ascii	"\234s\320\352\f\264:\317X\235e\254\3161x\3160V\347_\317\371E"
+	.ascii	"\317\331\305\352\f\300\352\334\242\347\314\366\234Y\360\234W"
+	.ascii	"\360\234U\364\234S\364\234\177Vg\024\253\363\211\325\331\207"
+	.ascii	"\347l\"\347\\\"\347\334\263:\363\3548\373V\347^\216\363N6\244"
+	.ascii	"\215\302x\034%X\277\017b\252\365^<\220\367!\343\342\305\243H"
+	.ascii	"\003\340]\374\217\327\225\006\340Sp1\323\316vxAM\300\225\232"
+	.ascii	"U\216\321\323x)\025\272\305\357\252p\213\3773L\035\366\215>"
+	.string	"Mc\301\376\t\257\025\317\342\273\312\212OeH\201d\213\f9\217\305\276\013\352\356\272R\023a\375\361E/\305%U\361?\003\273\024\237\322ra\233\n\267\\mWW\332\250\212\357\031\232>\254)\331\362\346\311K\361?\336\207\354\370\3033X#Q\3052\240\336\327\311E\212G\321\3468\006\305\377\374O\327q\351\344M\254F\361i\363\004\250o\352\365\261\270[/\351\211\337I\261\300\275[0)s\353\325\202y'O\374\2171\213x_\237\017\352\376r'm\230vL=\272\t&\336\247%3\361)\3000\311\234\365|\211\357/\267j\313zzP\217\255v4+\361\354\3237\265dz\236E\332\373\346\001gn\201h\317xu\256L\021Tk\313\335c\235l7X\265\240\343!\241E\243\242M\243\036\333\b\337\363|\316\n\232\032\222\2112Q\342\220\353 \251\357=\213kM\253\306G\bR\304\334\262\361\252\266\315\320"
+	.ascii	"\215\262S\271\262uSD{\304\021i\243\276/\212R\203\2237;\007M\230"
+	.ascii	"\0138\217\305\216\"\325\260p\251\371\361\036\257\373\356\301"
+	.ascii	"Ch\323L\264j\352\261\325\260i\353\341\354\350\311\013\\dS\341"
+	.ascii	"\006\246\215\366\370\367\222*A\347y\277\363}|Am6Ks^\347\373\230"
+	.ascii	"\305\343s\336\247\013\311D\002\325(?\266km[\373\326\276\245\215"
+	.ascii	"\362\276\331\230i\376\3246\273\013\224\367}o\2607\271\223\333"
+	.ascii	"\304On\224G\245\215\362\370\026\323g\022\314\264,DY\332\270\250"
+	.ascii	"A\255#\267\246\231,\335\275\216g\357\006\301\314\007e\270\307"
+	.ascii	"b\366\372D\2565;>\201_\277\007\206\006\206T\262\373\035\001\\"
+	.ascii	"\374\261'\343(\016\203\354\220\245\241\022\021\201\022\f$\002"
+	.ascii	"#\220\310:\020\001\005<X!V\230\204t\004\211\025\372\375\202?"
+	.ascii	"\034F\017\344\330\301\302\244#`\322\020\250\001\2205\002T\032"
+	.ascii	"2\024\262\304\204\304\n\025\211LD\242\0166\207\r\005p\260\221"
+	.ascii	"\237\021\032,\216bQH\f\006\201\254\020\007\303\"K\004\th\364"
+	.ascii	"\361\202\221~D'\027\177\005\024\177\254\220\312\034\364h \370"
+	.ascii	"+\200\b\022SR\016\326\350\201\034:<\243\370c\207\330#D\241\321"
+	.ascii	"\b<b}\004\1772X\tj\020\321`\201\330\340\020\2401\211I\002\030"
+	.ascii	"\\\374\301\032\227\204Db\221\034;\\\f.1!\t\213l\360\307\342\020"
+	.ascii	"*\r\215\030\030\261JBc\361\210\017\024E&\f\214\303\243\324\210"
+	.ascii	"0\270\244\200OH\004n\020$\002{\024yD\212@\245s\330B\212\034\275"
+	.ascii	"1\350D\212\300\006\212D\246\342\222\320GPhD\022\032\205A_q\b"
+	.ascii	"0I\b*\\\032&\005\225\220p\214D4LB*\022\"\001\205\020\205\306"
+	.ascii	"\245a\321\322\020\250T\204D,\026\021\3750\023\006Bb\221\221\211"
+	.ascii	"\211X\244\323r\352\177\302\272&\2233\247\177\342\r\276\0249\337"
+	.ascii	"\327\211\001\255C\367r\313\233=\245\271\244\347\261\270\315\272"
+	.ascii	"\247\312\254Y\371\216\376w\245\206\326\013\362D\035\244D\337"
+	.ascii	"^\355\302\313[\363\344\021\372\366\301\275\264hz\036\206V\213"
+	.ascii	"w\311`\313\271Z&M\332\253\253\264Q\241\267\321D\223E\354\203"
+	.ascii	"\376\350\373\r\251\004\350\203f<\320;\031\262\004\340\013\365"
+	.ascii	"\214\327\201\271"
+	.ascii	"\201\035\335z\017|'\2234\302\311\233\314\344D\317\334\246\320"
+	.ascii	"b\245\235\354}\233\265\357LS\371^\312\242\224>\2352jUv\200|\215"
+	.ascii	"\227bN\212\322N\361N\006\371s\214\3716\364\376\362\032Z+9P\256"
+	.ascii	"\250\307\267j]ha\bb\266\235A\325x\032_\364\277\227AC\213%\213"
+	.ascii	"z\364\262\027\357\222 b\274\214g?\"\001\343c|{\f\216\245\245"
+	.ascii	"\201\267\2646\004\201\027\250q\034\247\224c\204\320\314\214H"
+	.ascii	"\n\222$\215\001\001\005\204(\b\251T\017\02105\205\216\244I\241"
+	.ascii	"9~\027\224_\320v\031\250\001\020\232g>\272\253\235(\210;\221"
+	.ascii	"\001\036\206\2611o\301\354\n,'\332\356/\206\243\265\251b)\332"
+	.ascii	"h\256I\n\262\017s\222\317\215\023\\\332\206\340\tze\222\245\300"
+	.ascii	"\313\302\3418\372)\302<s\371\217\245g\306\\\342\226\023\214."
+	.ascii	"\211\247]M;\303\207=\304\024\365\202;\374\347\217\377E\372*\251"
+	.ascii	"\325\200?\363\272\220\324\242\007\031\241G\023\276\243\242\212"
+	.ascii	"\222|Y\341\370h\247vMBW\250Y\024\311\020\2236vb<[Ry`z\270\316"
+	.ascii	"\220(\347C\225\305\034a\370,\036\27301\333\366t\3712\242\021"
+	.ascii	"QY\247\022\f\016\326)\0210&\254\323\bEUQ\003\241\366\241j\024"
+	.ascii	"\303}z\004\203*\017\321\276\233\224@>\215\260\020\\)\220J\365"
+	.ascii	"\035\343G]\354\367\334\250\222~\372\311\032\226\223\327\021\356"
+	.ascii	"?\346\002\024\"$\276\207c\303\246\303\210\205\202BRt\353\005"
+	.ascii	"\006\235\375\3646\276\330Y\226\242\2033\351\354\361\277a\203"
+	.ascii	"\273\203}l\2301\0266\n\3774d\270\331\fd\376}\215G\240\013epr"
+	.ascii	"Quc\360\246\213\371\206\325\bq\240T\020 <5\232}v\343\225\036"
+	.ascii	"{\233\376\362\034\252\364\r.\357\3117|Z\310/W\362`\3157CI\200"
+	.ascii	"\n|\013\335v\035\b\212\320\314\307\3302\2414\257(\003&\256:\342"
+	.ascii	"\342\001\367\023\223S\301\307R\026\r\312\f0\344\023\b</?\374"
+	.ascii	"IO7\375\220 \305\373\333\022p+\007\222!N\321A\250\001\r\364\261"
+	.ascii	"\t\273\211\352\354\023\200P3\302\357\027\2260?S\220\365\213$"
+	.ascii	"\"^)\302\003\255\022x\355\001\370\214\f\t1\032&\021/&D\326[\f"
+	.ascii	"\214\"\004\300,h|\244<L\360\217\377\017\302\023\037_\006\004"
+	.ascii	"zJ9\006<J@7\006WfK\330>\016y\030\005\022\027o\315Z\024\301\001"
+	.ascii	"\224rf\300\351%\327\023\350K\274T\374\236\262Hr\302\333@\225"
+	.ascii	"\2332\311{$r\215\026\263\025p]Z\324\361\270x\373\373M\231\t\306"
+	.ascii	"\016\360\235\322S$\344\017"
+	.text
+	.section	.gnu.lto_cliTasksPrintHistogram.299.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\362\0015\022"
+	.string	"\346\242zH\320\322(\035\026%-f\031\321\347\002RR7\020\275\266\301FK)\363<\264\257a6Q\236\202\030\276\320m\261\337\205\372f\205r\247-\253\335\303\350ao\006\265\003\024\244D%:!\305\336YF\225o\334\004\331[\312\224\002e"
+	.string	"^"
+	.string	"h"
+	.string	"\035\036`\316\235$\032s\202-FP\2724x\024\357\262t\001\336\245c\366\216\224\232)S\020\026\331\340\202\3149\277\355\361\311#xG\215i\314\007z\274\355\302\232Mv\031\027\251\250\304\311V\023\035\350\364\334x\356zc\233iL\221\363}\356\362\266;\252\331r\256"
+	.string	"^\346\234\326\232\r\347\366n\033f;\202\255\006\002\272<\366\013|\b\022\341\335\261O\007\377\222\377\374#\307\335\236T\313\250\216\252\336U\353\252o\362"
+	.ascii	"\210\216\021\337\r\315\031\"$2u\262\306\355\270\333\017\362s"
+	.ascii	"6\371B\177\021;\316D\2378\363"
+	.string	"\036\204\204F=\346\234,\227nP\272T\2117\331VP&\345d\322\b\201\370\256\366[\334'\366\2371\301\275=\355\200\333\356\210\246C\242r\017\343C*\024\230\022\r\202J\\\271\237a_\006\207U\t\205/\343\375\206\304\314\226\354\356i+\3646\362\276\272\247\251\230iho\277\317]\002\217\035\016\233\"3\032\356\"\375\360\361\261&\321\221}\320c\260L\222\346\244\275\326*\321^\016\\\332\032^\372\232YB\026\272\232\225\331\240,\246\260`%\372\305\240eE\205\004\246\272\220\3320\301c\241\\0-\330keaD\305B\305D\247\\V\030R\237*\205\252\340R\301bV_\314\n\305\372R\256\327\347B\300\255\f*\327\007k\265\\\237\t\234\337\035\233B\027\272\231\235\371DmT\352@\377\211\320G7\223\313c\223\215=\355\346P\226{{c\"\317[5!\224\203F\207<\3169g% `\0022f\325\003"
+	.ascii	"E\024\006\2168\342O\246\362\330\223o\263\200k~\243hpI\243E\030"
+	.ascii	"\244\200\335F\243,<\223\031\323\2061\002\032\317\320^\206\225"
+	.ascii	"a\260\262\350\232\262\335\316J\320\"\027\231r\327J\323i\346\260"
+	.ascii	"\200\206\336{\321!\360=\252%\261\031\017\224\210\3512O"
+	.text
+	.section	.gnu.lto_cliTasksHistogram.300.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\347\004\375 "
+	.string	"\306{\325I\200\332Q:w\005\310\232\236\350\201V,2X\271\361\226-\351f\204\243\002\t~~\373\227|?\031F\331\322\374\301\255W\273\033\001\275\230b\006\023\346Q\206z:u\351I\341\265I\253>>yV\023\2706J>!{\357$\003\300"
+	.string	"\264"
+	.string	"\300"
+	.string	"h\253\031\263\234s\320\317v\220\376\334=\207\376\304\357A\177Z\\\253\335g\b4e\"\205u\f\216)g9g\336\265j\\\357\034+\337\350U\237\203\303\271\2456\364\304\327\252}\255w\310r\0323\036\211\317\301\367*\r\324\311\244\202`\013X\240\324\274\253\207\305\025\231\002r\234\004\310\251\037\277a\007fX\330\234L\352\007\316E]\031\277|\202$R>l\332\365s=\313BN\001\271\r\337/]\220:G\034\330B\225\225\330\225\267O\307%\213f\361\370\211s\334q\214uMQW:\307&\f\344\306,\013\356\310d\357\225?\261\326\312\214G\036\2676\r9\347\266\306\343\324\033\300\273\033\255\273\211\335\270\027+\223.2L\326\315\3052Ra\2727i\357\344W\216\002\030\311\271x#RZ\004\301"
+	.ascii	"\b\303\336\330A+\227&\323%v+\211\366&\273_\240M\017\261\276D"
+	.ascii	"\272u\330v\316\007\333F\317\365>\277\365\306\250\355{\332\266"
+	.ascii	"\330\366\t\\\n\322\f\325\327\270\344\034\265\246\345\346\231"
+	.ascii	"\005\353V~\257\237\353\337:\356~\367\253\364\231\215\373:\230"
+	.ascii	"z+3\236\215\371\246\266\246mH\177\342VJ\351/\247\234\212z/\032"
+	.ascii	";\231,\337\232\254hf9KUH\177\336\034\341=hW\343~r\331\310\261"
+	.ascii	"d=3\313Y)!\375\331}'}e\343\376\344P\324o\365\226\347\251|\247"
+	.ascii	"\305\"\016\305\366\360\245\360^u\365q\300>\354\314\017 B0\317"
+	.ascii	"Sf}s!9\254\250n7\331WB\355\r\266\210/\225\206\354=\261\252\241"
+	.ascii	"A\271a\327\326\331W\371rD\232s\276\361\274\335%L,\317\003\266"
+	.ascii	"\256i6]b\3370NeC\322\036\333\215\"\305\265\376#\353Xs\251i\273"
+	.ascii	"\311\306y9u\367\222"
+	.string	"\261O;\357-(\2767\252U\211\375\"\212\201Ao\262\355\rz\316\230\232\030\316]\364>u?8\276\272\253\303Z++V\355X\364>\312\265\364rb|iq\305\257h\327t\211\370\274\311\373\340\271{f1m\311\256-tm\314b\325\222]ou\240A\202\341\233\f:\276W^\001U\375\033\366\\\234\355\373\311\370\235\335@HA\302\017\320\016\302\216hB\204\037\235&\032\372\301-T\272\200a\267\333\355\216\204=\022\003\220z\301\"\340Ph\324\342\006d\221\224\022}8\022\366\206\350\360w\344SZ\201\266O\310\310\205\217\367\363\365X\004\177\303$#^\222Q\017\211\347\013\nyB\006\032\370\342\027\344\r\201\300 \017\247\314\277Dx\240\220T\315\033w)\347&;\300\027\216\317=\275\330\372I\200%\3039\347\214\273\311\333@\317\353s\337u\025Q\253\027\r\257\037g\006\316\031\231\301\214\313\256c\220\224\325@"
+	.string	"\205<\002\201Q\263\272U%g\252K\206\304\374|\330\311T&\013\324&i1\206\252\245>)\263\256;\366\336\363>\354c\352\026\202\ri^\25018\206\230S\204H& \021I\222\246\003\220\002\2319*\017\020X\312$\3150\006\205\224N\217\006e\337q\030\256\306z\213%\260\305`1\366\031\213\204\352K\022S\300\224\340\004m\314\022\305\252\364mID\006\232\360V\b\307V\373o\221\270+\274N[\272\234\264ioS%\t+\373\005\0210\b\326(\241"
+	.ascii	"\255eY\326\362\3504\237\024o\"\354\003MU\237K\017\206\002%\246"
+	.ascii	"( \002P\013U\356#CX.\277\201\343s\243\341(\244-\375\354g%\226"
+	.ascii	"\203\277rp_'\206w\356\007\236\227\276\003-\f\364\203{\213\361"
+	.ascii	" 4-\376\212a\330\200Ae\301\235^\036^\342\271\324p\037\2515\271"
+	.ascii	"\234|\n\231hO\003"
+	.text
+	.section	.gnu.lto_cliTasks.301.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`T\022U^"
+	.string	"z\236|#M \220\333\031\003\266\217w\007UL\307(\325\212\335\003U1\314\240\006\251\305\213bc+t\354*(\333\037\310\032C\334\343\366\244\213\332\232\213\333\200=]\251\231C\t\237\263\213\322l\032^a\020\323\273t\250\345\215h\220D\345\312-SJ)\034\002\003\002-\002\034\004:\257\300\324\371\347\347\254\3768\377~\234\323&\323\354K\235Q\325\371\177\316\236:w\220\241\\\0302im\266\307u\225\354\351\340\332\371\346\262\364\233n8\335j\272\331t\313u\237\351&\323m\246U\346\246\353:^\341\200\251aK\032\314>Z\372LM\241\335\264\375f\202\216\002\207\301\231\021\273`\032\3565=\307\306\213\226\232\f\340\230_|\250'p;\033M\243\320\266\034\005\356\"\241\342v\223\227\231\005\317u\2279\324\366\275{\242\213\322\206\343\216\343\265}g\214h"
+	.ascii	"\307l\303s\3351\b\250\355\363.\323o\274\232a7j\330R\205c*\321"
+	.ascii	"2C\035\323&\264M\206\335\b\211Qq\207\220\3001\323\360\\\327\235"
+	.ascii	"j\037\243P\333\307\242\355\314\r\246\303\264-\306\202\036r\335"
+	.ascii	"*`\326\270\356\230\022LBm\037\217\351\243\264}j\027\245\355\343"
+	.ascii	"\226\371\316\273k\334()3I\331\033\016\256\353\026\237\003f\275"
+	.ascii	"m\"\210\250\017P\354\223S\223\007\246%\245a\022\322\221Q\021"
+	.ascii	"\321\220P\220\020(\270\002\177\324_\352C\337[\356\260&:\033\204"
+	.ascii	"\\G\241$P@\217\352\344\374\003J\002\217\315\r\375\\:\321#%mh"
+	.ascii	"\375\206\306\241\320\037\231\222\266~.O@\255\370\340\315u\\\232"
+	.ascii	"\263V\226\304\365S\t\355$\246\233P\242\033\2377Kpd\0354\227e"
+	.ascii	"\030\367 \006\2143-}i%/n>$\241\223\236K\022\270,\2638R[\037\265"
+	.ascii	"\201\340F\037t\321\007\0368\321\020\226\026\302r\305\203\240"
+	.ascii	"\204\0354\020\272$e\205\f\372\271\224\202\022\351\260\315\320"
+	.ascii	"\\\226Q<\370\223\261\266\004J\257P\270,\2378\020\245RCe\207~"
+	.ascii	".\247\240B-s\306z\316\211\377<\227%\264\263\241\270,\325\\\375"
+	.ascii	"\265X\\\247@\246\006\355\0232\313P\326u\335\225I\346h\020\216"
+	.ascii	"\t%\317\332\022g?\232\202"
+	.string	"\f\007(B\346\0214\310\247\254\205~kW2\307\334\1772\\\327eGc.i\016\321\314.\306\334q\230\2053\004;\274^\324\377\371.\353#\346{X\372\006=\235\327z\320\202\320fi\263\374\323\235\331\03474\370\373\035?\314{\345\244\317jZ\317\022\226:\342\272bQ\277gr\276q\306|\217\321O\237\251\316\213'\346{\255$Gf\316\332m\b)\372A/[\332\331\206\200~\322\230\231\034\275\024jdb\200\337\3646\222\266\370\236ktM\332\233\r}'\003\231\270\037\256\364\277\253\035\241\235\\+\376W6\263\025\364@x\247ig\353\246\272\256\333h-\236\271\375\322\206q\346\261#\3733tdK5\206\037IW\364\250!Y\243\373}\223\335\327v\272\343\232\350\205'\223;?n#\251\021\020\f\336\337T\003_\351\276\251\356\270'\263\317o\252g\274\222;\375f\303\265\0133\222\256\f\240\276\275&\242"
+	.string	"\003\332\330\035\361\220A\230.\276\266\221\372\003)\023\003s\215~\332P]\367\310\nn\273\246\223"
+	.string	"\367\007\355c\005nx\243\335H\333\347\277\336\231\245\340&F\314\367\254\256\360\271\203\"9\263\216\035\336h\254\204d\255\213\335\230\260\tB\227\377&Ou?\22020\034q>\\\344?\335#m\270^\341\207\352\272o\243=\240\276\335DD\373j<\263\361\312\033\255\277\337\272\221\254\211`\367~\030\363\2301\377&\\\232+M\376*\314G\007~"
+	.string	"9\373"
+	.string	"r\356\301#u\336\221:\353h1\3355f\264\263\f \347\030@\3160Rg\001R\347\027\255\2469\200f\323\354\242\205\025\213\025U*R\244\316(Rg\252\324\371D\352\\\f:\233X\235K\254\316"
+	.ascii	"\254\316S\2533\211\325y\304\352,\365s\026\001t\016\361s&\246"
+	.ascii	"\316 R\347\250\324\371C\352\f\265:\263\253\363\323\352\354\364"
+	.ascii	"snZ\235=\254\316L\253\363\322\352<\\\235\223Vg\244\325\371\250"
+	.ascii	"\3174\033\255\316E@g\242\037\347\241\037g\2416\323\034\224:\013"
+	.ascii	"\201\316@@\017\257\024\nP\327]\213\341\354!<2\276\347O\004xR"
+	.ascii	"/\231C\023\022\266<\273#\037\346\024\300\207\230\222\334!\271"
+	.ascii	"\247\276\316\346\354\r\261G\357H\212Z\236\246=M|\177\372\023"
+	.ascii	"wB|\026X\330\003\236>\363\245\f\fLim\330\230\372\272\334\b$l"
+	.ascii	"uvd\037\266\364Mvz\366\241\376\303G=\210\037~\321\273`\322\222"
+	.ascii	"\225\251\257\263\235\241n\224\017\003\361\375z\201\361QK:\306"
+	.ascii	"\177\370\0066\273Ic<\324\367;7\366\364\354w\225-\027\234Q>\375"
+	.ascii	"\026\233Y\236[\222v\266J\234\364\270)}\223{\256\215\306<\237"
+	.ascii	"\310Ir\300\352W\274\262\347\272\310\356\371$M\322\217g\024\251"
+	.ascii	"\352S\274\262\357\272\351{\315\225\370\005M\037tg\206G\217\207"
+	.ascii	"1\336\352\035x\247\262%\t\036\030_\365?\276\361\266$\261\363"
+	.ascii	"JI2re+\331=\237\264\035\371\370\030\257L\027H\203\303\203\344"
+	.ascii	"\341}\274\222\2375\323{\370\247\274\245\037>\323\322\013\365"
+	.ascii	"lIBwD\304\215L\207v\317'R\212z<\214W\232\365\360\20350\207\237"
+	.ascii	"\304fF\203\033j\224\364="
+	.string	"~X\247\254\317\357\005\244Oz'\347\353\345\350\213\036\351\373\345\342\342\217^HeK\0225e}\362\344\321\251R\364M\006z\361\036\367l\"fh\252\3215\317&r\204/>\200W\002i\342\002\020\217\177\034\236jw\206\004x\024\316S\255M\370\342]\274\222IZ\364A.\030\264\263eR4\203\036Q\320T\017\341<\325\356\b\351x\001^I\364-\276\333\370\333Ni\"z \233\231\035=th\350u\374\220\005\241\241_\312\023\276\32039\031\016\026)oB\337\344<-\374`\233\360\221\330\314\354\270\265\226\2710hA\301\007r\267m\242\246\276\256\244\354\303\236\264\223\b\320\377\004\353\350\261Q\2379p\204T\276~\343\351n\3239\264S\236^h7P\337\336k\331\332&\373~\030\007\355$\262\266\340\344\244\351\002\020p\252\207x\317&r\326\035\377\342\225m#U\237G\332\333^\0319?\377\342y\374\007\334"
+	.string	"\0035p(P\003\307\002?L\203\200\002P\036\201\300\214\0328\n\310\301\n\331\302:\202e]\025AJ\261\f\230\340#\013*\";\302\313\212(\305\346P\342c\025\n*\"\273\305\205\365\305\016\300\362\300\301\262\254\020\037W\020Q>V\021\331c\013\"\361HE4qT\301\202\310\036W\020\245R\020\213^TE\314\216\360\252\242\"J\261%\330#\212\023\304 \0062\362\313\230\305\262^Z\305,\343\027\327\327\321\310\225U\304\250%D\002#\313z\201\025\213\030\265X\266\202!E\344\227\261\213\375\362\302\312bo\260\226\261K\b\327\227\027\326\020\340\325\026\030\r\"W\310!W@]\310,\260#r\310\225\327\027\020\005W[H\260\b\220]4\210x\031\031"
+	.ascii	"\002\346%\304\025dK=\326 \342e\374J\213\030\265\200Z`9\216F."
+	.ascii	"\004\220B\214]H\t\214B\344\026V\326Q\353\352\307W&\260\262\256"
+	.ascii	"\212\310+c\220.\344\327\026Vq\013\313\250U\274\352\362*\232`"
+	.ascii	"b.\b\220]\305/.\256\256\342:F\254e"
+	.string	"\210\375Xs@\374&\277\223(v\023\222g\332\316\225\023\324\367\331\210h\337;\371\300^B\033\306U\346\354\r\207\227\023\321>\031\023\274\001\203\323\315T^\374\023O\365(\276$QHJ:\325\367\243\244}\030\212\240\247:\341\373\342S\245\311\360\316!9sR\315\0165\2731"
+	.ascii	"\276\304\313\350\222d\323F}\177\f\005\361M\017\256]\260\026\305"
+	.ascii	"I"
+	.string	"\272\324\304\007q\323tI:\023\337f\260\3245]\t\025\232\016\200\377\263\267\272\033t\3119t\222wV\230P\371\210'\361S\337q\274-Y')iG}\375y\006\303\224\f$\244~\304\2673IC\327\265L\244\276\255\334\235\231q;\300;N\327%\3630'mH\346\325\261\355\021\241\341\003\346\003k\365\276W2\312V}\220\210\007b\245)\302\306\235Y\037=<\250or\307u\021\315\323\36195\372\026,\236S\340[\275\222\237T<\243\351\214\257z%\021\360\331\335(\353\264\342Y\265z\026\257d\247\024\317\250Z\365*\372\370\035\327+\336\026\264=\001\201z\250q,\004\221c\210FDD$IRH\0071\005\3040\347\240\264\016\022\300u5\2511#M\222\302\260\377\006\213\006\310\277y\364r\264\026@+{U\001\254\371\"F-\301tG\247\261\374~NT1\265^uU\345B\020i\264X\207\330\306"
+	.string	"f"
+	.string	"\b?*\305i\3049\037\314*\271T\3214\003\031N\037\322)\244\341\020\361\267\206-?N\376*\303\346f\013;\231\304\237"
+	.string	"\310\212g\274\034\037|\212fuy)9\201\205\262\344<\375g\316\r\366J\344J\025\364\216\343)\362\271\236\017\326\357\362|\330\256\026=\372qH\356\256)e\313\315Os\371x\032Vy8\rt\234\241\304$1mBv\223^\037\363\261\204\177\016\373hPaT\224/43\272\261\f\370\350ts)\244\016l\235\250\366\r\024\335\227M\323a\300\233\236\326\305\306\360\303\247hv6j\352\370\350\371\260\233\222\332r\031\r\374\327\347\2211\220\1775p\321\265\bX\3334XmY_K\020k]\002\215\222\030\206\312]\342\377Z\033\032\307)2\227\372I<\215\354\263\"J)\331n\3267Q\266?0\220\306\271"
+	.string	"s8\361RE\231\275^\b\251\031a\ba\352/\203\007\275xa3`\036\313C\356\226~\2206\366n\024\363\314N-on\331F\241\3770\361\307\214\222\207\330\320\217"
+	.string	"\365\322\215F1B"
+	.string	"P\b;\334\223\221\347ha:\342\301V3\002S\267r\332\030\326\363\301\020\246\222\204Lb\332\214-\362\032\005g\360\323e\027\217\305oC@:T\341\245!_\334[\007x\005\335\271\307[\343\351\336\311R|Il2.Z\214R+\206\260\330R{D\272^f\177dJ%cU\3253\255u\356\303\343\344>GPO\321\2215\300\330\002\320\247\177\270\206\005\354\003D%\223\004E\306\272\362\0309\244\366\313\247\007\331n\032\177\200\223\030_\356\003\002\311\251\341"
+	.ascii	"\257\217\222\331V=\207\017\330\335\335\271l\370N\220\026\246"
+	.ascii	"\255\023\364\2338\tC/4\017\004>\266\241\353\375c\341\026\357"
+	.ascii	"a\316\013\245%\376d\005q\210\363\271\263ox\307\231[\3730T\330"
+	.ascii	"D\350\363\360\377\032M\027.\250\032\366\016\264\375DHU!H\317"
+	.ascii	"R\324H\326|$\203\372\233\320\220\004\271^m\354\312\322j\240\266"
+	.ascii	"\221\251S\033\223W\240N\267|#<7U\340c\322\245'\325\020|\223\344"
+	.ascii	"6\337\262XB\021\254\310\323\224\002&\342\346\372\320<Tj\306\264"
+	.ascii	"\034j_e7l\336\361\007\027Q\377\237\033\240\nY^\212\241q\2337"
+	.ascii	"\207#\241?\213\304\261\240\252G'\2121\265\336=\021\353 \354P"
+	.ascii	"\222\363\025D8jH\250n\306\256\356.\002:=\214\034\250\027\347"
+	.ascii	"\370\220\377\264\2758RTU\376"
+	.text
+	.section	.gnu.lto_cliVersion.302.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`I\001e\016"
+	.string	"\366\231`F\360\2226\035\320~\213cyR\205\025\277aq_:(j\343d\236\362Z\361\214V\023\277\266*\032\026I\034\177a]\375\377\275\2526\342m\023U\345h\305\367\t\306\032U\006f?\201h\225\222t\020\245O\233l\231RF"
+	.string	"H"
+	.string	"N"
+	.string	"j\037\306c\244.\023\342\001v[2\257\335Q\201\021h\237\036?\222}j\027\220}:e\377\220\373Z\025\231\t\024\"j\340\354.'[<uM\371\227\361\020\361\245\345\332i\260\273V\361\245\304-o\233\304\366\007\373\2557L\230\r\025I\003T\031\362\031\237Y\301\036c\020,\331\305O\237%\373\274<\314\312\365\202\245\322\034{tQ\271\302>\266\273k\331\262U\215\251Z\252ZU\375\016\001\232\233\031\326O\364\330%\221\023dm\246\016\027\"\266\037*\351\342\001\372\3615(r\305\2035A\013U@*\345\016\nrU\303\252\240\205\337sX\270\353\257\013~\314\2473\210\364\242o\262\217\247\3512\230\225\013\307\323B\f\240\317\217\307\2212\342c7\274\370ia\b\364iw \351Ec\233B\266\00461\331J\246C%[h[\3201\212C\3127\202\260Bz"
+	.string	"\300\340\307\303 \302\211\003\317\t\212\204\003\340\307"
+	.string	"\347\001?\036\222\004^\351\033i u\035w\3337\3528\257\023m8y\250\322\307\225>\021\211\353N \267\025\260\311\203w\342P&\323\211\023\031U\037\301\002\210M\037"
+	.ascii	"3\017\254\0049\224\2002\003\302\260\310\206]\264\021\256\270"
+	.ascii	"\2475\346\2662\b:\303\016O\354\362\330\035MX\3506\345\301\035"
+	.ascii	"h\f`\001v\34020\004\330\201\313x\016W\243\006\0310\353\022V\263"
+	.ascii	"\032\035\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.303.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\034\001=\016"
+	.string	"v\232cG\360\222(\035\260\314A\313\337\376\245\035X\224\334\252@\233\037g\310\363\256[i\2433a\256/\345\233fa\224\352\365\352\224\325\n\215\022)$3\230\210\346\376\200\250\277\227\017\303\357\333X]\360\275\007D%\215l\262eJ\001K"
+	.string	"J"
+	.string	"O"
+	.string	"\237\334\003l\237F\331A\344\362,\212\255\006\366ag\310\356v\362\346\250OM*\312\177\316G\306\026\315'I\313u\215s]j)6<H\230\264D\r\245G\005\220\347\\C\264T\252\237\006\273k\035[#\356\355\266[lO\260\017\006+\005\b>\355\016'\375\350\311\272\251\221\211\222\306\216\251T\256\260\257\355\356Z\276\354\303\376\217\252\225#\260\003\206N\211\237\230\355\212\230\025Y\331\324\361\242\304\366\325\276\214\317@\035\346\341"
+	.string	"v_7xvc\t\234\302}:v\224-\334*d\341T\200\205\343\222\211\232CHO\n\355Dm\357\223w1\332\310\344\301M\345\005\032?D%b\033\3466@nW\\\340\327\370\316\006\277\305\247G\241~\374\364\303\355S%I\017\020>b\300R:\363G\037\273\316\314\t\213\335\325G\016\\^a\t\211\034D`iq\201 Z\t\231\030\304\340\2239\211@0$P\203)\fG\022@\017\\@\007\004|$0\006\303\310\373\330S\001c\274\356\363^2\224>\023\t\354H\340\313\250\363J3\235\212\001\2072_\2513\205a\251+\211\245\256\255|\261pL\310RR5qP\030P!\026"
+	.string	"2\241\341(\340\027\207%\177\257\n6\2001`\b\305\034.\312\026\220\005h\227\034\326\005\257;\026J\217Y\206"
+	.ascii	"\325\305\256f5\032\270#1\233l\021\217\306\240\366"
+	.text
+	.section	.gnu.lto_dumpVersion.304.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\272\001=\020"
+	.string	"\006\034jI\340\2608\035\360m\200*\204\236\337\001\352\201~\352\f\353\334[\352\372\310{\b\332\210\374\343\004aN\"l<y\b\317\211\211sj&\344\354'$&6\336\301\br\212\207\336\225L\204\202|\316\236d\033\355D:H\333[\312\024R"
+	.string	"Q"
+	.string	"X"
+	.string	"\250\377\006mY{\350n`-\024\265\356\006i\210Em\307U\312\250\357\302\026\2444S\333y\034\226\253)/\265\016\237\311\252\036[K\306\013\327\rK\353\311\331\"\307g\256*\t\214\210ra\313\030L\025\363G\202\356>\227\246\206\375\307\376\037\377#\370\331\013\254-O\036+E\300r\177\213\005\336\362\003f\2208w\234+\232\372c)\2465\377\326\2464?\345\177\224\377Y\234\335\220\221U\301#\205\003\206\314\316\350\350\206\271\365\350\031\347b\304\377\025\371\317\374\0270\200Z\034\227\323\356\017;\262\356\030\201\237x\313=\277\003"
+	.string	".\332\315l_\266SFo\322}\350\302\266\332\310\254\210\241cc\305\266{\353\322\205\320\017=\267bT|\333\t\201h<\230\361\244\b\221@\360X\007\"\220<\264\230\021\376CqT\"C\355T\321\324=\374\035\273_\205\304[\236s\321\314\231\307\233\2631\n\240Ww\337\227L\343\211\024+x*'\221\202\025R\213\004\357!\3128!\004\305P4\"E\226\322\b\226F\021\t\f\311\023\210\022\340\246\025\221\004YL&\022\024\211\365\326\2464.\332\213\331\005\252\352h\r\377\013\030\320\323d9 \270\2225\351\276\233N\215\222\257\262\b\201^\rF&lj\347\211\r) \300\002\2211\353\006\"BCH\300\273\016S\275C\304\324\3072\031\232\037r\206\340\336\200H|h\317a\003\003\221\367B\323HM\250i|Qio"
+	.ascii	"\\/\214R\362<\266\210al\210\204\207K\033-\273\240['uV11ja\253"
+	.ascii	"Upr\350#\261&\0271\370pS\212\263\007"
+	.text
+	.section	.gnu.lto_dumpName.305.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\355\t"
+	.string	"\026\023G@ \3078\035\230H$\230\020\236\234$\300\301g2\347K\317\264\022\017$B\207:b\350\027\205\037\205\032=\032\314\264\236@\tj\032A\200T\b"
+	.string	"\324\366\200:\224%@P\003\323\025\206\260\377\336)\0052"
+	.string	"4"
+	.string	"5"
+	.string	"kJ\261v\313\bCd^-\332/\272\254-\271\234^#\225\202\335\315h\312\305O\321\177\200\033\220\245\361\023c\261\273\236di\344\246\267\355`\273\3026,\363\244+\311\205\240\005BG\273\034'E\261oYzb\037\365[\346\364/\n\253\003\002Hn\212\355\212\304\026l\253\026"
+	.string	"`\373\032\333s\332\022\024\342Q\036\246\033'\375\001'\240\341\257\274\272\363\346\311W\337\273\274\236\332\037\330\020BG[\350)\302\311d5\202\205f\314\230\371\324KO\202\312\256\350$(#\232xx\2659:\002\346>\215S=\217v\321\371@\030\031o\233nc\313\270M\313\b\271\017\247\3138\235\366e[\350\3116\013\006;\\\230}@0\3144\345\236\344J\320\n\321\017\037\250<\006\003\273\241\013"
+	.ascii	"2\003\302\260\304\302\272,\016\216\020\205\247\n\3335\221\001"
+	.ascii	"\023\210JM\016wy\321N2"
+	.text
+	.section	.gnu.lto_dumpMixer.306.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`O\003\305\030"
+	.string	"f\255\240G\260XQ:pE`]\020P/\003\341\b\b\003\330x\277\215@G\371,\007\372\353\217q"
+	.string	"\374\022\325\177\264\0317\032v\024v\362Yb\306L\356"
+	.string	"\337\003xnl\032n\243\217e\333\007\365\222\244\352u\311\347\266R\246\024\201"
+	.string	"\202"
+	.string	"\227"
+	.string	"\252\006A\265T5K\325+\325*\325\037\340\340\307\023\223\221&K7\366\313o\316HcfNI\250!\367\375\366\335\342?\177\207\221\324\353o\362\313\266\317\005k\336\23092\022\224\222\236\230\254\346\374-\270\264\003U\273\301\203\361L0\274s\0365=\315\371\343\261\202\360\322\243-f\347\323\314\001.\315\3401\261\232s\306\266\307\307\353\350\277\351\256^\215\334\2655a\316i\355\325\260q\357m\037\260\375\302^\244\273#\335.lJ)\351\013\017\215\356\027g\177\206\007\245\203\022\"\2343\306\023\021\272wJ\262G\334\t\214p\316\t\301g\362&$\374 \227\226\315\364\275K\177\006^~\357\303!Uu\224\304W\244i\f\323\377\276\304\304"
+	.string	"\037s\356\336\243\205;\237\235K;EM\337s\002\252(\032Wcbl\316\376\351ty\330g\315E\262\317\364\007\270\357\306Q\365M\250\206\265\3246\240\372\245\352\032U\273\244:Tu+\036\342\003^\216DF%)#L\324T\316\226q\351Q|\214E\302]\207\235\313\033\013\273\315\031\2667#\222\0036\013[\236#\3272\"\301\362,c\222\261\311G)\200\2276[@g4\345e\341\245\203\2679\024\277b\345\265w\002\306\2655\233\243%\\\327\236\207F**\334 \235\221\224+_\216\312\365\251`"
+	.string	"\300\305\310\311*C\270\273\260s\tnkm\r\033tx\233s\200m\355q\026\\\036\026\227\302!\202\037\345N\036X\037@\200 \300K\t\325\363]\326\346x\t>\321c\023\211h\265\030\356\204\t\032\320\017\001\327\300p\342M\264\351\020\321j\265\032\030"
+	.ascii	"\337\020\350\270l\023\211h5\020\0074$\373\021+\334\200dC+DX\212"
+	.ascii	"\233L\203\212\332P\211\320\263\036\032\320,&\316d?6\021\027D"
+	.ascii	"\213\005\321d\265\330\314v\213\365\024\260\220\n\321\026\303"
+	.ascii	"\t\t\331b\257_\321Ys\221\034RU\321q5\246huf\240W\3620c\222\226"
+	.ascii	"\271\022\233\301\301\214@V\300\026\251%P\230\346\234\021.\253"
+	.ascii	"F!\376\357T>\006\252\346,z\317\357r/\243\220? `\002\2319:\017"
+	.ascii	"\2573>\024gf{j\231Cm{iG\220\203L\325\303\215\233\b\021\240\202"
+	.ascii	"\300\2062\013F\240\200\202\236\254\tb\023a\204K)\212\254\017"
+	.ascii	"\330\212\325b\244\372\335\202\241\033!(F\210\233\260\007s5<\215"
+	.ascii	"\235o\367\265\324w\2456\266\223kc\357H\214e\337\034\251o\r\335"
+	.ascii	"\032}|\241\315\214p\033g\033\004\240Z6\006\314\246\3342wM;\210"
+	.ascii	"\220\347\273\034\345\352\336\343&\256qF$=\260s0\016G\023\210"
+	.ascii	"\0311\227\027-&\003"
+	.text
+	.section	.gnu.lto_dumpServo.307.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\375\013"
+	.string	"&\027UA\340T5\035xE&\3071\271i\261\331\241n4{\357'\004\305\236h\030\222'\274\020\345_\362\311\2537\002\032U\340h(\242N"
+	.string	"A\t\322\030\223X\036p\276\320\350\022\216\357\f\177\304h\223\275S\n?"
+	.string	"C"
+	.string	"B"
+	.ascii	"\266\245\264\035@\b\217\342\340\271KB\325"
+	.string	"\332]5\360\002\355\324\241\035dnkGd.V\214XDv\267\316\023\017/C\3770\036`,\201.\001H\330]\313\261\004\342\236\267\235\300v\005\373\023\002\247]\321GP\023=Ppj\1774\310\217\246\036\200\364pu\230 {\025\222\323\204}l\247\311>\352\307\244\364\263\002:^2B\034\305\220]R\211\221u\321\034,l\337\033\236\362K\210\340\361bw'\237\004\257\253l\006\277\261Q\022\222\017\022\324\356F8\265\301=u\032\336\201\323\256\370\321\237qV\347\2538\265\305\223\037O}/;\375\2641\032\004\242\t26?\007\264HQctD\224%\326\344S\217\201\201@\276P\300\352\271X\274L%\303\327\201\031\006\334(t4\237\013\2329\212\227\341j\307m\225\257\363l\274\272\3616M\345>\260R\f\230\323\351\276\352\341p\276:Y\211\307v\232\254\375\330\361\241\210\020q\206,@^u\034\026d\017"
+	.ascii	"<\005cO\t\224a]D\027\303-\306*d`\017d6\241F\363Ta\273&\316\303"
+	.ascii	"\304V\251\313\341Z^\b\223\f"
+	.text
+	.section	.gnu.lto_dumpServoMix.308.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`Y\001M\017"
+	.string	"6\235iF\340\224(\035X P\"\271\022\235\023\274\275\270A\243\335\352\017`\364\275\031\224\211k\021\250\026\330>`\277\256\234!7\2500\344\t\303\302&\206\303qT\314\270C\360W\235\017=t\353\034`\020\342\375\323\332M\344N)O"
+	.string	"R"
+	.string	"X"
+	.string	"8\363\266\302\366\355\3412_&\206G\213\335\005\035d[J\033\201\002\325c\037\254\273'f\330vg)6\320}Ze\017\321\265\255\211\016\013\027\257Z\221\335\365\024\305U\227*\377/\016`\204\255.=\016v\327r\204\215\270\365\266\013\3306\331\247\005\237\376L\362\343\247\017v>\257'21:\214\310X2\307\037y\331a\234Ljv]\037Q\235+\001\312\247\275A\224\037=A\0049\202\003\243+{\326\222Jc\237[\235\261\037\373=R\232\223\322:\245%'\375\217"
+	.string	"\03441H<\305\217\335\0209H6\277\001AMv\364\240\225\210\355.\203O\333\310\227\335\206\211"
+	.string	"\220]\326G\237\306k\214\034\301\324\371\2240A\b\f'\200\f\n\257U\350\\\rP>U9\265-\\\b\271te\217rRU\377J\302:\251s\225\232\362\272\265d\216m\f\257\221\272]\230\005>\3557\245NE^\021\211^j\305\004\262\250|JR\237\370\205\241\027\360$\226\370\005<\205P\035\302O\374h\020I#\227\023\207\f\235K\"\220\245\344}%\222J\370\245Z@\257\005$\235\274R(z\242\023\243\\\276\320K\241P\241\007\232\261\316\255\316t>r\2100B\204\245-\017\220\267\371\355\201\336\324\334\306>\020\030"
+	.ascii	"N\005K\202pf&^\371\243\351\\w_\325W\350\352\242\f[h\"a\2368]"
+	.ascii	"\030ep\224\332\025\230%\0026\265\017!\272P\204L\020\243\374B"
+	.ascii	"t\r\377\215\t\250R\347\3025\267\020\346\023"
+	.text
+	.section	.gnu.lto_dumpFeature.309.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\235\013"
+	.string	"f\226R@"
+	.string	"S\225\016#\227\206\0348\002o\b(\202\371\035\250e\2705\017Z\257\374\016\322$\2507f%\r\326\034@\021\202A{\375\222\004~W%"
+	.string	"\n\240\275\331\030\354C\236M\204\306\212\310\2106\331;\245="
+	.string	"@"
+	.string	"@"
+	.string	"1\332\f\034|?a\260\334\005\261b\355\246\0248A\366\351\317\346!\227\265\037$)h\204T?v\227\312\022\377\036?\377,.\022\216<\217!\017v\3271\034q\270\345m\037\260\035\301\376\202\233\f\324"
+	.string	"\301\247\335\261\020\037z\212t\204he\220\036;\365\211\222\204}l%\311\376\351\307b\364%\002l\340x\321\341&\037\273\032^\256m\315\032'l\337\027\216\362Gx\330\241bw'\237\330\016\361-\276\252s\205H\204\3534c;\3521j\201\322.\370\320\207q\025\347\233>m\251\361\341\247_%\237\227\366\005c"
+	.string	"$=\306\344%"
+	.string	"\024&d\204\202\200\361\345,\036u\027\025\002\224vA\017\003\236@\241\226Z\311t\033\001s^\207\243q\225\354\262\321 h0\035\t\2317J\245\260Qn\323*\036\307\311T\232\251\032\206n\336\206R\006\270\323p\036\345t\235G')\360\330J\222\263\03476"
+	.string	"\351\001\312\217G\002\016"
+	.ascii	">\263\331\250\f\312\204\246\241\201\301\205\001\212\200|'\324"
+	.ascii	"\024\236*l\327\304y\230\330*u9\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_dumpMap.310.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"e\013"
+	.string	"\366\225QD"
+	.string	"oj:?\017\020\371\264\022U`\025\225\021X}\300\024\334\177\023"
+	.string	"\372\211\264\311\300qc\321\205\230\030\300\215H\237\b#\t\232\020\377\377\333\253&\252+\354Z\264 Qd\221c\024\231HP\206\203\204\354\235R;"
+	.string	"="
+	.string	"?"
+	.string	"\266\t\200\361&\006\246\273\024N\253\335T\211I\266k\036m\024tW;\201\242\001\026R\275v\267\322\013\037?G\377\247c\224\"\317\347E\200\335\365,E\020nz\333\"\266\005\330\257\001#\327\354N\202\371\322\232\203\026\214\325\200z\354\324gR\013\366\263\245#\373\246?\233\323\247t\220`\341!\302K'v\037\304V,K\033Q\262}/8\312\257 !\266aw+\257\330\2363\037H\353\3652\205\350\216:\210\357\203\264K\276\364?\\\345\371\030\256\371\362\315\227\327\374\217r\355\324\306\200! \352qFO72\224R\204Z\2203\346m\036\365\016\b8H\273\240\227\233\rt\0226`Q \326K\250\341\220\0033\314\206\033\020\202\035\002\233;\313w\240\253^\307\025\020=N\346\253\231\217\003k'n\252\305\303\232\320\023+G\243\021k%E>[:\362f\242\204K\205\213\244\037g\314s\270\210\r"
+	.ascii	"\327\224A\231\32034p\\hP\016d6\241F\363Ta\273&\316\303\304V\251"
+	.ascii	"\313\341Z^\b\223\f"
+	.text
+	.section	.gnu.lto_dumpSerial.311.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"e\013"
+	.string	"\006\326P@"
+	.string	"S\225\016s\007=\260$\002\244e\240[\005\213q\301\2625\263kY\373\017%\350\241"
+	.string	";\371\260\346@\b\036\260\330\034\035I\340\377]\002\240"
+	.string	"\332\233\215\301>\336\007l}m\b-\332d\357\224\002<"
+	.string	"="
+	.string	"?"
+	.string	"\266\002\006\337I\027,wE\244T\273&\004>\200}\372\263YrU\033\"\302\"\003\350\264cw\251,\361\357\361\363\337\342 a\250\363(i\260\273\216a\210\303-o\273\200\355\007\366\023\004\006>mN\205\370\320S\003\313\303\n\203\354\330&O\224$\354_+E\366I\377\025\243\037\tPc\005\214\017\037\321\330\335\320\362\261\2539#\205\355\333\302K\376\b\020\250\321\356N>\261\035c\023E\007Q\017RJ{\351\250:"
+	.string	"\307.\370\320\217\361\323\346\237\370\264\204\032\037~\3725\362yi[0\004>\262\343K^\002P1\272\001\372\001\306\226\261\370\322_P\240\230\330\375<\364\260\317\202\236P\241\034\305\227\254v\233'\261x\231\003\r\206\003\001\263V\251\027\215nZ\026\241\3336\231J35\303P\255\363hE\2009\315\326\321\r\307utb\002\177\255\024\031\263\241C\305#\007(=\016\211wq\0315\016"
+	.ascii	"9\007\254P1\2241MC\r\203\263\003\024\001\371N\250)<U\330\256"
+	.ascii	"\211\3630\261U\352r\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_dumpAuxEntry.312.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`L\001\265\016"
+	.string	"\326[eF\340\222*\035\223\013d\305\007!\2500\210\303\266\231\n\0041J#\373\034\215\336\353\324s\261\024\316\"0\355\376f-\225\303F\2466q\375 \t\022\030\307\270\2419N?\350\206\373\330 D\254\023\267\201u\263do\231RP"
+	.string	"P"
+	.string	"P"
+	.ascii	"\rV\247\241X\356\202\210a\333\035\0238\304s\316+[\207\\\333~"
+	.ascii	"\340\244\250\301\\\370\330\335N\262|\365)u\345\277\366\217(c"
+	.ascii	"}r\270\234!\267\032=@d\257) VB|\355\232A\346R\355@\330]\253("
+	.ascii	"\333ps\267"
+	.string	"\035\301\366\004\373!\002\016i\330\321A\346%Y\237\325\334l\322(\234)\025\250\304\260\260\300\361\322\032{t\251\034a\177\256\\\261O\373;w\371\247\252u\252\377\t\305\240X\241r\032\314n\354\346\307\312p6Zl\337'\037}\021\036fT\354.\350 \333%\007\003U{A\"\237\226\330\t\033\332\356:8'\303\373x\030#\003\263\335\326E\037\346/>\237\3049\203#\275x\316\037q\316]\252\264I%\005`\222\345\216T\371)/\003\230\240\335\200\331\264\364f~\364\343[\234\b\314vS.^\360\244<8p\316F\251\364b\256 B\201#\247\222\310\027v\037I\310\030T\336<\tS&\220+Ay\022LJ\252\021\217?\021\311\302\327\201\237G\022\202)\023\2513\221\274R\367\205\250N4\300'\0230\354R\247S\330\201\306\326\347\312\025{fhl4\267\226t\031\200\376\3454(H\036\177\261\021|F\031"
+	.ascii	"=\225\301\231\320\250\024\343\365\205\300\252\271 \b\310\267"
+	.ascii	"B\2474!t1\3433\274\254X5\002\004\022\rq\na\271\206\363\325\002"
+	.ascii	"\026\341\016(\007\006\003#\364\031c\334\345\251\232\234\242\251"
+	.ascii	"="
+	.text
+	.section	.gnu.lto_dumpAdjustmentRangeEntry.313.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`X\001E\017"
+	.string	"\366\034jG\340\222*\035\"\203BC\252\037x\007gP\334\354\022\257\250c\244@\"h9=\rj7\314\265\346\204?5l\265O\224\242\310\324\226\276~\210$\2120\214s\210 \343\264I\025\327\210x\002\253#X\274\217\337\b\221;\245S"
+	.string	"U"
+	.string	"T"
+	.string	"\323n"
+	.ascii	"\301u[\313\272\033\002w\333-\027x\004t\317.;G\367\266 <)d\314"
+	.ascii	"jz\354\356\247#\356z\247\323\345_\346!\222\366z\347\341\332\215"
+	.ascii	"\344f\360\b\241\311\272\001,%\310\313|\256\320bs~&\354\256'I"
+	.ascii	"\353p{\267M\301\366\005\373.\001'-\302!\007\212\033\231"
+	.string	"\276^\323\311\335\324-O\247\fZp848dS\307.cSE\330\357V_\354\333\376\317c\376nN\317n\372!\021\334\216\025-\207\261\331e\331\001\2627\036\r\023\266\357\224\227\276\313\207\034\025\273+\272\310\216i\035\300\306jlp0\003\266\202\303 Q\002:l\320\254\330v7\302\275\027\340\313\273(=\250\355\302N\3726o\021\372$\356Y,\315\223\367\374\222\347\336u\252m:A0\323\227?:\365\235^\005\234\200\301\231\005\201\315\235.4_\236E\312@mW\345\244\006\220\212\204\004\367l\025k\006\3060R\255P\342i\245b\231\220@\222p\374\302\222\003\026K(p4!\201\241\224q\205\022\275\023\025X\001\345\304\"\201\034\216L\031\302O\f\301\222Q\\\241L\037\312\004\236\276pT}\243\002N\241\210\343\267J\245\306OT\302\336\255\276\030t\343\307\315G\016\2461\007\230\237y\f\013Z\363\231\030"
+	.ascii	"\002V\026gB\247R\214\330\027\302\253\346\202  \337\n\235\322"
+	.ascii	"\204\320\305\214\317\360\262b\325\b\020H4\304)\204\345\032\316"
+	.ascii	"W\013X\204;@a0L\237\201\307]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_dumpRxRange.314.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\335\013"
+	.string	"F\327T@"
+	.string	"S\225\016c\337A\213\262\204\312\203X\034\214;\264\017\341\370\327v\214O\336\202\n5\362\307\254\244\301\342\017\240\206{k\341h\222@"
+	.string	"\240\005\240\003\325n4\bs\210\355\363B \"D\233\354\235R>"
+	.string	"C"
+	.string	"B"
+	.string	"\266c\264\035@\360\236\362`\271k\242\345\332]5\360\202\354\323\236\355C\256kKL^\274H,!\273Ke\212{\217\236\377\030\247\200\246\320#"
+	.string	"\t\273\353\b\232D\334\362\266\023\330\256`\177B\250\335\321\301N6z\240\340\323\376p\210\007=C\374\3201\362A\206\354\225(J\024\366\261\225'\373\251\037\213\321\237\024x\255\2301\342\241\215\335R\t\311\216\314\034,l\337\035\036\372'H\004\201\261\273\225W\002\257\253l\006oi\024\020%\036$\251\335\215\360yc{\370\032\335\001\324\356w\320\247q\026\347\253\370\364\245\213\007?\375n\362yic2\bF2dL^\016p\021\356 \025\371b\211\263\370\36026\020\b\316`\001U\n\252\002\314]4Z\005\325\f\323\321(p2\237\013\2317K\247a\243\334\246a\250\234G\323QM\247e\350V;\324b\300\033\016W\251g\263\251\264\262\372\216\255<9\353A\244\305\020 \237\0249@\274\3528,\310\016"
+	.ascii	"\033\225A\231\320E40\\`\254\032\006\341@f\023j4O\025\266k\342"
+	.ascii	"<Ll\225\272\034\256\345\2050\311"
+	.text
+	.section	.gnu.lto_dumpRxFailsafeEntry.315.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`J\001\265\016"
+	.string	"\306[eF\360\222(\035*\023\3715\034\007\372\216\215\343m\332\272\240\202\307\327\267\335x\367\224rx\035\320?)\325i\377+B\273F\233\036\255\n^-\202\244\313\021n.O\334yd\222e\343\316\201\f\3336l\375\337\310\3362\245N"
+	.string	"P"
+	.string	"O"
+	.string	"\253\313\\,w?\324\240\355\216&.\001}\363\312\336!\227\266\036<(\210\300l\200\354.'C|\365)u\345\177\366P(\262>9\\\316\222\232\f\037"
+	.ascii	"\304\327\034\201!"
+	.string	"\021~v\315 \272T?\017v\327\032\212\033\356\355\266!\330\226`_&\032z\2108/\311zL\247F\223v\361L\231 \306\306\316\n\035/\325\261G\227J\020\366\347\312\031\373\262\377s\232\177\252Z\247\372!\222\033#T\304|\366c\027fg\310\342l3J\330\276[>\3722\035lR\354\256\350\"\233F\310\002U[\001\2039.\f\262\335m\360\355E\367\361.H&9v[\017\375\026\277\361|\021\337\374\221\364\3417\237\344\371v\251\322.\241\030\200I\226?R\345\247\274\034p\342\206\006\254HKwfH?\236\305\251@l\367\345\341\005\320\213\203\003\337l\024\213>4I\2660R\201\234\n\024\340\224Rw\242\002?-`\312\364m(\250.\302\212\nK\005\220\275Q)\305\343>\257;\001\277\224\251\304\231J\235\n\347\201(nD\300\247\225\017\344R\247\023\310\211\306\326\347\312\031\203p\210&\202\324Z\322\345"
+	.string	"\372\232\307\230 sb\257\261\021\034\006\2059\302#\031"
+	.ascii	"\200U\026gB\247R\f\330\027\354U\307\300\036\310\254BG7!t1\343"
+	.ascii	"3\274\254X5\002\004\022\rq\na\271\206\363\325\002\026\341\016"
+	.ascii	"(\007\006\003#\364\031c\334\345\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_dumpMasterSections.316.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"5\t"
+	.string	"\004\016\267\001"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\035\001\022\005\001\212\001\202\200\200\374\342\203\365\234\003,\177}"
+	.string	"\005\001?\202\210\200\020{y\274\001w\273\001\005\001\006\025\001\013\270\357\234\343\007us\b{q\277\n\017\370\356\234\203\013\177o\303\001w\302\t\024\230\356\234\003\177m\307\001w\306\001\347k\311\007\330\346\234\003ui\314\006\230\337\234\003ug\317\005\330\335\234\003ue\322\004\230c\325\003\334\234\003ua\330\002\330\325\234\003u_\333\230]\335\340\001[3\336\0014\334\001\332\001\331\001\327\001\326\001\324\001\323\001\321\001\320\001\316\001\315\001\313\001\312\0015\310\001\305\001\304\001\301\001\300\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/interface/cli.c"
+	.ascii	"% P\243\\\007\300B\300\036\263e\327D\354\222\317`\373%b\334\262"
+	.ascii	"V\344\033\354\206\262\214\333]\"\037\016\326\320\206#\213q\226"
+	.ascii	"\325\n7\242\327]\313c\215!\316\314\266\314shl\030gs6Cs\031\f"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_cliDumpNextValue.320.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`*\003\225\030"
+	.string	"&\357\243H\260\230M:q\245\0018Ee\004l^nZga\213\n-\311\371\3165i\377\237\031\003q\nl\\8\027\315u\326+\036JeK6}\315d\216\314\261<\370\274\235\233\235p\b\236\241\266\327}g\332\006!{\023\271S\n\213"
+	.string	"\207"
+	.string	"\225"
+	.ascii	"\265\362\030|:\202\370i\236x\233\310v\331^i\277\310\227\210\316"
+	.ascii	"\304\302\263V\035?\251Zy\r\274@\374\004p\035\372)/\200~>\200"
+	.ascii	"@d\333V\251\0348\250\322R\356H\231Zy\260\335\341)m\2473\004W"
+	.ascii	"\332\374\242\323\327\316\305\233nr\002\020r\364\260U5^UaE\355"
+	.ascii	"j\034\004',\r\351\361\332\345\300u\362M\375\351\362\305\016'"
+	.ascii	"\367M\277P5b\351aE\355\216.\303\n\265VK\335\216\306-\3366\f\333"
+	.ascii	"\023\354\375\020>\362\272O\337G'f\027\334\347~!*w\367.r\334d"
+	.ascii	"\232\375\323\003 \350\215V7,_\226\221L\263U^\234\242v\223l^\221"
+	.ascii	"\344\331B\345\303\213d\237\351\327\311\t\245q,\375Z\351\033Q"
+	.ascii	"\332f\245]T\272\265\3225\241\264\270\322\341J\323PzRipJ\357\224"
+	.ascii	"\226\357\335\337\371o\214\2260[n\234\212L\2553\322\240\251Y\346"
+	.ascii	"\223 \357\335>\317\177\262\3137r'\242\367\206d\205\241\243\342"
+	.ascii	"\214PJH\300\004\036 k\366ks\350 \257\363\201\026[dqk\366_rYF"
+	.ascii	"\036>\005B\224\"\356\316m\274\"\302D\3407\216\0017\311\341\322"
+	.ascii	"\255\365\272\340\344\031\353l\270\340\025\316R\001QrY\003n\200"
+	.ascii	"\316\305Y\313\234\215\233C\034\212\2102\265\342x\236\214\330"
+	.ascii	"\351\215VC\244\356d\210~\316mU\215Vf\230\374\337P\002.\265\342"
+	.ascii	"\256\263}\342LF\300x\324\212\223\240\344KH\2001\031\225\321\317"
+	.ascii	"\234]+\272\032\340\332\263'1A\201K\255\225\307\367\035"
+	.string	"\t\315\007\362i\024\0013\241\236\330\212\371\003D\013\222\315:\314\204zb+l,s@\353\221\301f\262X\211\332,\350\207\006\373\241\305|`\262\232\n\230\203\002\006J1\253\301\202\200\200j0\027\257~\221\374\246?\006\224\322\317\327d\3726\372\247\377\bJI\211\257\t\370\333\350\313\257u\005\243\275\375\240\233\344\233u\255\205*6{c\345W0\200\007\342\f\0324\320O\233U\320\303Fk]{*\023TZ\373\246o\270\215X\314\200\265\326:7\311\377&\031\221\246\302E\362N\301\"\"cs\366\373\302\0016 `\2021sI\017\312\201\267\341\236\253Y\016\"D\020\346m1\313\f\240J\006\222\241<\316\352MH# \005\243\225\275c\025\316n\352\227\345_F\024\372\r]A\214\256\255eY\366\223\232\316\232.n\346w\ba\002\250\030\366x\\G1\235Q\361\360\026\330\210\302|\n\207\266\300\226,W9\265"
+	.ascii	"5\343\326A\306\276v\245R\240 \241\301\255Rj\360\334`7\246\255"
+	.ascii	"q\bu\322\266\007\023L\031"
+	.text
+	.section	.gnu.lto_cliDumpPidProfileStep.321.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\005\007\355#"
+	.string	"&\275\334J\200\330U:m\255\325r\024\353\374\020\004\t\314\254\355\032\367\235\346\274g6\237O\355r\231\321\355.\203\315!\341\267\201\b\375\266\005]\272T\021n\333/\371=\022\214\025\224\354I/\300\374/\317\357\r\376\025\301\227XB\310\336I\006\303"
+	.string	"\273"
+	.string	"\324"
+	.string	"\313n\266]\\\331\357\031\206y\025\2219g\366i\267\213n\366i\372d\263=\241B{\344\013"
+	.ascii	"\331+\36389\257\252\200\345\274\204\360\264\037\254O\273\355"
+	.ascii	"\376\302\231+\023\325\253)IF\304r\3164\314\343\355urX\234\233"
+	.ascii	"u\246\246(\276m\277w\235e\016\223\205\312qq\232\277\360f\006"
+	.ascii	"\344<ZU\205\013y\334\301D\374\2126\310\2624D\007\024\273\232"
+	.ascii	"N\265\364tgY\226p$]\025}P\354j\332\021\002\321\037,\3060\327"
+	.ascii	"\272\002\252%\342M\235\216\242\264'\f\245\035!\f\024\300\224"
+	.ascii	"\0322\254\020\351b\255\337\032B \232 \347\374\344\357\f\341\357"
+	.ascii	"\336\031P\316\271oP\310\364\336yw\223u7\207n\225*"
+	.string	"\317\240(\030\357\030\211aG\345\305}'\177b\353\367\350\033\016\247>\305g\202e\216/\276\326q\300\252\254\244Ijss\316=\214\245\356w\352\261\t,+HWMw\347\316\265[\267\216Y#\361k\254u_\262\2130\225s\266\320Or%C\375\036O\273(\305}0\205\372\224\305O\036\2152\374\nSL*}\267\254{\371\273X\252\373h\306Q\335\350\355\037\364\266\317\263\336=G\276Y\364\266\212\336N\321\333\250z\033\247\267/z\373\013(x\341BZ9\257\250`.\313\254TF\226\275\322&?\236\365#\177\273\337\255\225\325\342\213\302\352lJi\316\214E#bL\\<\362t\"\017gva<Z\210]G\374\366J\275\263\333\343\311\264W>]\300\300\206b\220\305$\324\327Q\234b\235\250\252.[\300\342\257\2375\306\230\254\377NE1O\314n\r\203\342\035c\261yT\372\376$i553\240\376"
+	.ascii	"\031\216)[\377Be\361\017\356\233\364\364\273exJ\r\030\023\265"
+	.ascii	"\205\332\203/\f\307\200\301\372\322\336\246n\341\301\"\222)\270"
+	.ascii	"\353\033\212\332\335\022\301p\037\354\301\250\024.I\25710$\334"
+	.ascii	"K\261\224\224w\327\236%\250@\027,\001\214D4Va\007nw\006\rO\257"
+	.ascii	"\037\3565\201+\034\ntX\201\033>\204\200\"\340\036\311\253\210"
+	.ascii	"@0\2253\360\301\021+\020\203\003\022%\356\203m\200F\032'^H\270"
+	.ascii	"\327E\214`\232h?H\305\230\207\325U{\375\306\t\351P\024\361\214"
+	.ascii	"\326\034\221\356\004\021\016\304\021n\205\220\215\205\316\356"
+	.ascii	"\310\326\301hh\305\211\265o\022tB7\032\356fC\301\303\251 \322"
+	.ascii	"\321\210t\266!\332\215wD\223@\240\213\214p<\232\212\242\"\036"
+	.ascii	"\215]\372\216f\034\325\r\344\303\277\353\324.\021\352\366\376"
+	.ascii	"e\347.\216a/o\\\247"
+	.string	"e\016\263k\327\306eR\361\231\235\273KW)ev{\2744\356\ff\033\344\312\330\2557\351\306h\253Z!\355\220v\210\372T\3057c\361\310Q\351\373R\354jb\277\334\207\001\231-\243\0163Z\356\203\203\245\306\376f\327.\322\375\365w\271\233\313\320&\331\232\346=\374\210\3171(\037\033\037\312\347\r\226zP\355bAi\214\304.\261\260\024\337\331\271\007\200\206\250QD\346\030R\210F\"IR\2204\006\320\002\021\251\251n\021\360 \204P\031I\\\337\001\"\340\272\321\"6a\254\256\017\330\262\221Q}\307=\216\317A\347fRocU\313\302)\f^\005\360D\365\361\351\252i,.\177\333\370\013\213\366Kw\207tu.\340e|.\022\315\352TO\t\024\351$\r\035\356V\tH\270!\326-\206\246\361\0322\361(\264\272\373\372+\220f\214\354\260\301 \333`\370\374$\271D\36172\211\n\253\r\276L"
+	.ascii	"\325\246\241\253x~G\034?\310#\201[\257\025\211\341%\240\022\332"
+	.ascii	"P\243U\335L!`\013P6\275\3017n\334V6\256~\321$\026\205\254'\202"
+	.ascii	"\004T]\334\322#\272\357!?\212\365X\362\016z6\b\351\311\375\272"
+	.ascii	"Q\260'e{\361\254\323YU\334\242\226\037\0232G\001\256\236r \210"
+	.ascii	"o\233\200\204J\361\3040\353\\\304f\342S\267\333\223\034\306\271"
+	.ascii	"\210\227\336\220\276//5"
+	.text
+	.section	.gnu.lto_cliDumpRateProfileStep.322.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\273\005\205\037"
+	.string	"&6\304K\220\230U:\220d\205\312\374\305t5\r\253W\244wy\236;c\271\320\312?\\5\224\267\260{\214LcI\003\256\250m\256\360\323\244g\275V\351\255\004\022\023\324\00620F O\201\263\020\200W|\002x\321\r\254!B\366\336I\006\254"
+	.string	"\242"
+	.string	"\271"
+	.ascii	"\003\202UT\326c\316\031v\264{E7\354(>\262a-\201\202\372#\213"
+	.ascii	"\232\354\314\002h0\221\3533\347\344\203\243\355\300u\264\325"
+	.ascii	"\356-7'\311\302\024y4\024\304*\347\034\2739\256\036\366\232q"
+	.ascii	"\265R\024_\253\366w\207%_\312\0378\323\312Y\036#=Ir4\336\220"
+	.ascii	"a\343\256\240\217\"#\333\222RTc\310\246\330\301\332\234A\003"
+	.ascii	"\364\341\002Q\206Y\336t\006>\212lX\224\3061\216A\t\305\240\001"
+	.ascii	"\n\341\232\"V\027\0300\310\336\246[\030@\037^\220s>\362\326\005"
+	.ascii	"\260gm+'\347\334\366\007\224\361\006\360\356v\352\356\016\335"
+	.ascii	"(QG/\231\237\227_{\337\364\027\025\322\024\222\24126\347\274"
+	.ascii	"\273\227\210\036\227\376\222`\212\n\262X\335m\373\021\234\313"
+	.ascii	"\310/l\270:\031\373\366\"8\b\305\234s\205\376\220\023\341\351"
+	.ascii	"\3578\332\271\023\366\277\023\351\321\327=\362\230I\220\312j"
+	.ascii	"E.\361lVw\262g/\261\3738_\034\335\330\366\315\231o\233\037\337"
+	.ascii	"/l\033\305\266qj\373\242\266-\266}\234\tZ\232\034\223"
+	.string	"\230H\341\225J\346\030Yc\262\023]\302\343\314\377x\333\375\356&\246\n\343\004\327\362\256V\214\224\255\341*\225\364\037Ov\303z\305\227\372\0013\\\370\270\024_\035\026\334\024\256r\265\304\273\0232\251\330\302Ioz\004\253t\270\316\"}\335\233\333v\310\250g\263n\021\353\251$U\221\332\\\013A0a\230\246\324\317R*\002\246\254Q\fl\315\373)\355V\177\\\260\377\331\\\334D\n\252\350\352\031tw\350%2\271S\206\340\n\224\233\341\neE\305\263Y\235\300vc\310\020\345\354\335]\037hjH\260\301\345\343\320\341\303\023\003\366B\356\004\204\202b\316\276\377B\270|\027\032\210\030a\377k\034\",'\316\240\273k C,K\334\227\245\367\352\230\232:\177\2229\335K3\\\237\256\226\354\355+\371\222Y\177G\323j\2654\375\256\355\334L\344t>5\240\231\016\200\255\347V\242\247\346\341\247\206bg\226\""
+	.ascii	"\356g\266\301\207\007E\tW\323\"\334vh\261\032mfBW\003\352\271"
+	.ascii	"\305zn3\236\030M\367\023\213p\240s>5]\f(\227\323\305`I\336sx"
+	.ascii	"\267w\230\216}Ad\363\237l\233\375\331\026\235l\325h}V(\371\272"
+	.ascii	"D\253_\331:\266gy}\234\355YeR\245\030U\t\353\312s\350\t\241\256"
+	.ascii	"\216x3\227x\231\316\303\310\252\206\302\246\025\325\375\262m"
+	.ascii	"\247\302\021\270\362E\3304\036\241W\225\322/[5\376\251*\021\340"
+	.ascii	"\362\fj9\256\310#\364\006(\"e\221\362\255\275\236Z\233\001n\250"
+	.ascii	"Q@\006\241\241!\231HF\222\302\2441\320\002\221\251\251:\021\020"
+	.ascii	"!\224\214\025I\265o\002\273\310\217$( \021\027c\037\260Vd\001"
+	.ascii	"Rp|\t\017<\275\206pg\263\244g-F\212\336\245\265\343\n\006\204"
+	.ascii	"?\323\003S\327bsA^\357\306\204}\361\364\314\310*\t\304$@\377"
+	.ascii	"\367\322\016\352E\222\367\355\351\246\234\226\342\003\274>vX"
+	.ascii	"/c\250\n \203\264H\026\347\361\306}\242<\026jlm\037\fF \320T"
+	.ascii	"\t\003CI\277\\ \300T\332\364Q6\363t\002LS\3533M \256\020or<\201"
+	.ascii	"\367!\365\336\276\356#\311\227\302DO\236\317A\3357.t\267\331"
+	.ascii	"\303\030\327\360Z\270\"Q\255>fa\2322\344\007T\242\037E\364\025"
+	.ascii	"\223vb\327;u\006U\321.\275\017'\177^j"
+	.text
+	.section	.gnu.lto_cliDumpStep.323.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\337\016\035>"
+	.string	"\352c`\026EP^R\0076*\213\036\203x\247\207\201\007\352\363\312\216\300jh\020\3134\021\360\350\377 {\246\317\276\363*\370\220|\365\203\n\317\032\001 h"
+	.string	""
+	.string	"|\314"
+	.ascii	"\303\200\325\016Ip\303oe\310/\026\333\356\275eJ)L\001=\001Y\001"
+	.ascii	"\275\323~\277\371\373\327~\273\355w\353~\263\371;"
+	.string	"\267\337\317~;\007\"+\336\031\226\327]\343x\307\265N\354\326zI\342ine\2553\324\352f\335jN%G\325\332\332\323ZB\005\330\247(\331\370*^\306\241 Vg\347\300\333\316\337-\241B\r\237\242\f\020/\365\026\210\221\2313\333\213c*\004o\273\301{\306vE\315Q\2716\227\372\264\206\233\265\333\025\255\033\213\3438\350mw\215\356\240\267m\260\341\35679\346\022o\271R4Qi{q\034#e\"\016;\020\361\307\247g\310#\f\002w\336\237\333\262\371\341v\004\3217hpV\236K\007\232\272?\211\324\037>\2373\347P\355\371%\375$\020\253\272\231U\207j\356O\236_\022W\325\226\013\267\264>\310\0321\241\n{\243\002\362\300\003\\UY\276\303\"\261A\355\3607\252,\326\247\b\2358X\377\376\222\2548+V\206\213\031\031WU\230\377\336\250\302\242\336\375\341\255\216g\2235\212\343\330\313\374"
+	.string	"\023\252\260gY ,,q\303'\024\373 N,\313\253\370K=\237>\203\025\211B\257\200O\246\273S\345\265\346\\TF~\377K\212\343\270\337\371\254\362\016\362n\357\352\356!\335<\316\301l\001l\272\247\007\314=]\320\274\352T\300\377\362Nn6\267\021T^\366\233w\262\327\201p<\345{\367\346#\260i\233\177\331\353\242\254n\226\243\364\264\2718\356\224\343J\267\315n\026\220\326\2042E\370\233\2726\257\200\203\346M\300\302\022\307\346\257&\341\2629\211\326\346\351\351t\367\boCb/\216\237,t7\r\247+Q"
+	.string	"\016\2127\026\307O\030\344|\316\004{\002\205\233\302\365\226\315A&\024\257\3729g\217\262\266\ng\243\\\363\331\253\370\033\307\204\342y\027\027\362yq[~_\257UyU\311j\332\337\33424\355i\332\2612\355f\330\255\266\36619+L\273\230\227\202CI\034\304K\373\227~\363\272\033]o\203\342\246\224N\t\227\216\272i\213\343\245C\337\0313\360&\361\325[\273\273\350Z\214o\034\307\026\332\261x\226c\373\021o\333\005\362\335\211t\275\365<\354\202\336\221Mm\374\265\233\312\374\374\325\355l\234\275\274)\344\357\243\366\033B\376&\002~\007h\277\001"
+	.string	"\277\207\332o\241\366;\250\375\006\332\371&\276\337?\355\267O\373\335\223\277\207\3557\317\357[\330~\007\333o`\376Q[\204G\231(Ku\377\225\273\332\023'\024\262\253\2111isW\353\342+I\242F\224)\344~\226'(\037\301]\217D\371a\177\004\376\202\211\300`\357N\030\314\3656(\373\035\235\023\275\326\252\204E.\204\354e\376\346\241\321\275^\344\002e\b\271?\352\212I\344\207"
+	.ascii	"e#3\252VM\260V\345\025\204\341\022\033\274\003$p\222w'1\027\230"
+	.ascii	"\262n\001_\313\271`)\2019!@]Q*cw\n\336\315>\n\213\031(\022\307"
+	.ascii	"Mw\302N\336\346\005\0050\024\230\354\335\331ESV+\267\247\274"
+	.ascii	"$~Y\262\334\371\311I \260\364\315\372\311\303\256h\032\331\024"
+	.ascii	"\214{\231{\021\2718TU\2737\1779,u\313\336\n\226\376\350\3322"
+	.ascii	"\263w\367Q\260\224\357\241\f\232\343\001\267e\206L+\214\273\225"
+	.ascii	".\376\323\030De\207Ug\006\225j\001xK#\365s\245\353\223\223hh"
+	.ascii	"|r\016e\321O\261\201\343=\331'{]\023\312|\247\362\305\321\223"
+	.ascii	"\207pP+\331\324\225n\267\210o*\207\346\036\212\b\007\355\333"
+	.ascii	"\273CJ\233\372p\r\3740\2670\267\321S^6O\036>S\371"
+	.string	"6x\262\002\272\r\037w\270Z\205u\252B{lom\376\nf`v.43\036\274\316\207\001Lh\036\037\235}\234Qdj\213I\031.\220-\224\226\214F\307\031E&\240cS1\251\240\275\225\226\220M\306\343\213#\223\221\321\213\242\022\322\0052\271dtL.51\035\223\b:ylb*\302\370\3218\262P\372p|\201l\261\224\214!l\343\021\362\205\021\351h,\266H\036\233\224\220HJ\310\"\f$c\222\t\351h@/\3058&\221\232\226\226\222HA\252\r\317^}C\216\217K\325\316Ff\346\353\365J\007h\232\2077\235#\347\345\334\247]|;c\020\234\251\207`n\261U\265\266x'\021\251un\250m\350\214\256S\273\370ql\250pNs\204\360\336\246\013\321\203\311\200\2709U\235\370\336\246\347\270b=\025?\003\027eS\006\226\"\340\324w}\006hs\272\302V\271\017@\016\260|1a"
+	.ascii	"d\001h\3214_`&\324\333<V\335\364~\242\346\234\321\213\253v>\371"
+	.ascii	"\253\317\266h9\303r\005\215\373Y\027\177\255\312\031\0177\r-"
+	.ascii	"*f\354.\003\032,5\224\343m\032w\300\3170C\271_\312Sa\036\355"
+	.ascii	"G\032\366\001[Y\271\336f<\247\034\241<\224]j&\224\005tE\301\220"
+	.ascii	"M\243\300XE@\336\246\006\251\333\023\231\262\236\b\337\rGa!D"
+	.ascii	"SV(n\314\274lg\363v\312\352\304m\371}\303\374\325\037t\240\203"
+	.ascii	"\212\224\035\001\201,\250a<\345\034CS\"\"\222$\005\205\f\007"
+	.ascii	"\341\005\304\030\347\324\331\001\021\340\240SP)\032\241I\222"
+	.ascii	"Rk\201\213n\374\205Gz\022Se\034B<\036CUn\346v\0139\247\255k\250"
+	.ascii	"_\303Hp5\020\274\250\314\002\317\020(J6z%T\334a\313>W\002\201"
+	.ascii	"0\244\334\024\220\345\274\227\005\241\322\211\216\247"
+	.string	":\335\260\315X\002D\323Z\023\326\370>\237\217TH;SQ!v$\037\251^\267\035\353@\223\013\262\331\330\",\024\004\227\214^\325\337\225Yl\300_\234m\223\264\273]\216\212L;\336.pTe\027\375h=\222n\266p\261\276AS@6\213\312l\036\327{{@@\362\235\341<\220n\261\273\232\274\211K\242\376nI'\023Rx\367\250\242U\t\302\252\331\207\364\006Zp\200\376HY\322\370N3\306\027i\277/\351ND\221%\352\200\200\352%\312*\245E]  \220\255y[\215;E \373\302(P\225\355\0276\351\220\332\006\206\2127X\013\003\tvc\334\310XZ\203\024\342\256LN<\326\272L\273\331\227n\207\360\241\343\246X\367\264\037\007}\226N@\376z\213\017\212\242(X\344\375\271B\230\262\004\007#\213P\033\204\210p\361\364\212\273x\342\2240qI\216\372\246\322\f\236\033D\240`\035\213"
+	.ascii	"G\341\324[L\n\301=\035\340\007\323kk[\277x\363\273\006y\033\363"
+	.ascii	"\221,\340\225\272m\352\363\001D\366\251*\320\231\321-\002Fx\217"
+	.ascii	"\221\363\024;r|\005&\346 b\224\361\f>\202^L\265\327'\235\327"
+	.ascii	"&\336\353\223\316k5\305\273\347\330\347K\036\304\007\307}\325"
+	.ascii	"\331\0133\"\3676(P\275\342\306\002\2328\271\202r)I\346\307A\226"
+	.ascii	"B\344[\354\031\035`\371\361\005\347\301p\272\312v\\\020\"\275"
+	.ascii	"\266\327<\277\2274fb],\251\373\231tK\242\234i\320 ry\262\377"
+	.ascii	"\022\310\305\310\267\266h\227s\333\205\301\304}\302\204\006\370"
+	.ascii	"X\217\006\363'\343'\362\027\200\227\341J\r\245\242\264\250a\232"
+	.ascii	"\362\007"
+	.text
+	.section	.gnu.lto_cliDumpResume.324.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"u\t"
+	.string	"V\321A< \345*\035g\366#\317T\362\024\007p\004qL\204W\020\201C\033\303\363\221\225\200CD\276\3759\372\016\302,Me|\311\017\b\0307Y \204z\003h\316`\360'\337\022\"eJ\001/"
+	.string	"2"
+	.string	"0"
+	.string	"rAB\r\317\255\206\276\300\230:\027\220\361\345\f^.\333\300\270\342<.\263\326cW\213\221\245\312\001\3159\255\342\210qw\267\255`\373\300vL*\275\331\262\225.\254F\363\240\360\276lU\353\325\347\020\244\320N8\036"
+	.string	"f\316\213\033\2009\353XFl\277\343\320\256\355\\\231\035\033\023\231\226\n\315\2343-!\273\260\204\177\033]\006\224\027\226\326\230\243_\333\024\241\027u=\254M\331'y\311\204/b\t\224^|\347\2436\357\276\217}\341\3035c\333\b\366>\243\007O\212\274P\003(:\225F\2624\n\221\244\007\232\344\247\300\037\204\b\224\247\357\003eG\246\372\276\fR\355\252\202\353\250\355@\322\213\336M!h\004\r"
+	.ascii	"2\003\3269\244\352%u(\354\347>\206\315\020\306\023\306e\034\230"
+	.ascii	"\n\372e\b\340\3625\3254\rLA\001"
+	.text
+	.section	.gnu.lto_printConfig.325.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\305\007\r("
+	.string	"\nF\254\017I\200\030R:\177Q\203#\207\032>\300\354\333\007\237\360\357\206o\304\331\030u\365\205XkX\226;\025RA\251\033\376V\354\366A\271\215:\365\363\237\263\355l\273\3373G\240\337\255\357X\321\224\365\332\270|\262\332\b\331\204\354\235d\345"
+	.string	"\336"
+	.string	"\344"
+	.string	"\274l\226s\236\232d@6\200\321\2609G\220\254\343\324$S\262\345\274|\360\2641\254\327vS\260@\374rF\201\2431\353\302B\341\266\373]\367\"\376\213\306\003\344\254\345d,\347e\204v\260>\355\345y\360\323\365;\370i\023\273\327n\036\313V\230\314j\211\351\226s\356\335!'\236\227\263\003\240\313\341\340V\025\247\350\265\304\276\252\201\201\362L\322Y\330\021\351<gN\330\177\334\001\271\262"
+	.ascii	"T\rbG\221\224\215uqaA)\257\263\372as>\216\363.;|TY\334\002,("
+	.ascii	"\252\257]vP\241\nr\316g~\301\221\035SV\225:Fw\250\304\320vG#"
+	.ascii	"\n\001\rIj\003U\312\035\227\354EsQkh\273c\022Z!\314\261\352\314"
+	.ascii	"\333\246\343\222\265\252\206\234s[\246#\324;\300\273O\241\273"
+	.ascii	"\211\272U\002\001\327~\210\355\330\023\271e\377!Fo\323\f,\340"
+	.ascii	"N\250b\266\2517\331jOO\370j\351di\341b5\276\320\331b\313\224"
+	.ascii	"\266R\236\025_\317jd\301+\313\211RLBor\354\273[\203\312\257\202"
+	.ascii	"\032\214\325xbw38a]\351,"
+	.string	"Wi\214\334\323\300\272\373\342\311S\311\256\351\234}\363RbDP\346l<\223\320j\024\321\340i\356v\007e\3303\351.\004',*f6.R\3672\311\336d\367\321|\265\272\007\360|\371\013\300\266wtx;\335\277\376\034\266\215;\330[\305\351\241\274Ql\373b\333\366\266\257\340@\024!`U\307\321\226\263\216\2676\331,\235R\344`?\02411aW\2716\025\345\316\356\\\037\275\3318K9\206I\3169\367\264\373\250;\367\364\376\311\231\235\353n(\303\305\217\300\027\353\02073\242\314\305\216\262Q\211\351\272\362\372Q\324Qm\341\f\270\215\342\322\213\023`\334=\363\250\221\252f\032\356C\214/\356\266]\232:\230w\223\370\232\230\2343e\030&\375!\356.\361\347\227\335\023e\232\333\031|\273M<m(@-\347|\241\357\345h(\372D\236v\n\025\366L*\360\323\335\2312\215k\252h\337r\n\236"
+	.string	"\247w\300\265\220\203\n\032\022*2\234\233\3543\2573\366\224Z[yn\243*z\323\333\364.+V\026\253\021F\203\247\352\257\001\247\254(\034\357\t0zy\356\225I\232\332\226x$\331\267\2343\322z\223m\235O\251-\234\273@\3104\251\316\005BZAy\367by\"\277\356\356Z\263'\362\312\352\256z\233\256\366\214z\203_v )c\272\242\241\350\207\030\b\331\f]d\024t\344\373\371\371\340:(\310\207v\321\317\310'\304\375\013\002\376\004\205Dk\013\177FE>!5F\221\217\004\221\320\221\317Z4\024\004\032\021\005\325\237\037`\207\240\017\376\r\001\203|\204z\324\356\221"
+	.string	"\f\352\351\375z|?\302\237\321\020\2607\004\364\t\365z\204E=\t\b:H\364\023\366\214\202Aa/\267,\036\315W\3537\236VY\r[\361&\241<gs\260=\220\367\336\331 l\024T\352\354\020V\307\223s\211\315a\233\356\007\036UM\267+\257\234\233d\363\2075\007\213\303\336\260\367a\r\302\032\255\215\033\326!l\321\"\205q\375\215\330d\315Y\351B\337\315\337\020\275\210N6l\300O\355}\221\245\\\343\372*\332\267\357n\222\355;\227L\025%\\\314\234]\313\361\335\001p\223\367\300\341k<\250\311\262\322\342v\246x\261\006\361\2664VZ\270~\004\200\220\250aX\245\224RB2\222\202\244 \031\016"
+	.string	"\003\021\031\252:\0210\245DJY\221&{\006rt\312\251\220c~\021\f#\303!\365\330\2136\247\372o\312Q\354r\217\251\364V\352\f\200~\260\326cxR\377D\204m\215\217\223Z\260\240&\375y\020\024ma\2602?\207F\333\031d\003\202\302{\262~\n\232\276z!\n\025\306>\246PK}\362F\231\353\2303v/\265\0229\2713\371\026\341\361\2709\327\231z~}2\272\266\357\316{\006vkK\257i\254Qs\003m\3566\277\227\237\325\003\021"
+	.string	"\271}\210\231\354RK\314\343m]\272\275\327\311V\211\\\b+\305\271x1O*\272\205\033de\330\202`\nc\213\341\001\023\"\314\207\200h\020u4`\326C\354\017n\200_\0234\221\271\324\246t%\254\251\304\2739\240B-\221bM"
+	.string	"U\216\223JM"
+	.ascii	"}3K\374\222\252\203\245\232\262&;\0216\233\n\370Cd\202N[\343"
+	.ascii	"\212\020\202n\325q\252"
+	.text
+	.section	.gnu.lto_cliDump.326.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\245\007"
+	.string	"\"\31766Pm\323\001$\333\354\312I\245\032\032\001t.>\224\344\200\016e\013\340hw\t5A\230\373\213\323\304.\323l\231\231id\353Z\016\210P\307\335\336\236\236\032\331;\245\026vq\026:\364b\252\2718tZt\303\240Y\036\354\232\330\265\351L\2529L\315\200\263\006K\233\236,\323f\246\356\345\347*\364\300\221HBNX\212\007\217\322~\200\210\357\\\020zu$\242\220\234]\271(7\354K\273\273\226\237\375\320\037\245\227\2004TP2na\262{\321\302\262'\023IG\306\366\243\375\217\203l\017E\034`\367\003\201\273\025\301\006\325'\327\013P\237\252\007P\237\274\331)r\301\365\250\221\260Bdew\247\344\370\366\270\371\0179\246\373p\217\027\205\335u\354>\030\267\274m\002\333\t\266=\002\b"
+	.ascii	"2\001\007x\206q\341\tL\271\004\333\254\246\204\273\274h'\031"
+	.text
+	.section	.gnu.lto_cliDiff.327.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\245\007"
+	.string	"\"\31765Po3\006 \271{N\257u\275\234I\216\023\351@c\022\351\372\330\245\363WV\275\007Q\264!.\271\317\327\372\314\314\022)\003y\230$'\347\331g{\311\2262\245\032\267u\030<Y\246\331f\353dS\3138\r\236\366\341\266\311m\034\317\314\274\207\271!h\347\240y\363\323u\336\324\204\267$\025;\2156R\250\tI\321*\"8\312\026\"\"\032T\203\323\350\"\205\252\220`\033\202Qr\264\256\376\277\222\324\272d\307\312)%\022\227\225\f\207L\376P\f\314U,\024\017M[\307\326!\026\371\\\222p\300O\0021\375aB\0170[\r=p\331\302,p\331\352\327\262\310\233\256q\235\264X\224\274\374\237\262\303\237\343W{\304"
+	.string	" \021\350\230Y\370\337\b\022a\270\322m\013\332*\264\375\b\b"
+	.ascii	"2\001\007x\206q\341\tL\271\004\333\254\246\204\273\274h'\031"
+	.text
+	.section	.gnu.lto_cmdTable.328.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\342\022\375O"
+	.string	"\312{\034\034?@\252\325\001\244\243\3077\230\204!\005\370K\300\206\251\027\201\005g\230Af\032\272L$\222(\312\346FbSJ\240\013\320\017\220?\260\351\240\001\016\025\306\022\212U\360\332\243\364\264\315.!)\245\024\300\001\307\001\244\001\177w\031\343\301\355-<9N\034\360T\227\323\255\314"
+	.string	"\025\277\277\220\373\312\337Y\260\020;o\315\n\334\325w\364\2307\026\254\362a?yVx\300\r\276\234ns\007\274\240\374\335\334QxF\236\300>\200\364x\207H\310\333\034\202\215D\311\337L\226\354\340\222\300D\214\364x\227\206\244,\301\016\262\207\374]d\023\331\221\t\n\201\225D5\305\230\364x\007\305\311\2359\251\275\203\307\337>v\217\335\222`|\025\325\024\333\355x\202g\252ns\375\235c\343\340t\231\340(Rz\314\013Q\361S\246@\316kJH]\351\353K\226\340\257+=\346s\346\340,\035\254\307\334\313$\330\271\237[z\274-\301c\360;\310\371g\001#G_Cz\264#5\202\315\242\232bp^"
+	.ascii	"1(\344\365!\244F\364\265\242D0Y\230\036\357>OxL'\323\343\375"
+	.ascii	"\306\020l\006\243\365x\227\201\317\300S\203\234\204\032\364\361"
+	.ascii	"\372\017R\007\372Z\020\334\007\020=\336cA@\"F\364x\003\361C\334"
+	.ascii	"\317:\022\360\261\313Y\b\245\343\265\035\244\306\363\265\236"
+	.ascii	"<%L\364X\317\335!v\255\250\016\n\025=\256\301\002\326d_\316C"
+	.ascii	"e\016\336\270}\035\347\315\305\213\036\267p\210QM1#\fX\2539\343"
+	.ascii	"\036\250y\255\006\251\331\276n\303F8\354\361\325\232\253\316"
+	.ascii	"\305\025\247=>\021\\#\356\247\332\343\017Gx\352\313\311h\216"
+	.ascii	"\213+\007\004]\240\247y\332\314\3533\2446\3635\232U\006\312\325"
+	.ascii	"#\207\2073mg\366x\003\332\214\250\246\030\027WL\243\307\023\202"
+	.ascii	"\232\227u\215\236\346\345\033p\217;\345\272\004a\342\342\312"
+	.ascii	"\241\177h^\356\371r~z\013\275\211R\331\313\326\233\342\004\305"
+	.ascii	"\314\330\317\246\2640p\214/\260\272\235\230\347\\\220\274\313"
+	.ascii	"\347_\274\274f\275l\354\035C\246\307M^[^3\264\0367\0259\003c"
+	.ascii	"\251\205\255\315\361\276<\277\202\344Y>\007\323\322\364\003\313"
+	.ascii	"\233F\255\307?8+j\340V-LMY\317\313s(H\336\374|\212\224\022\235"
+	.ascii	"O\224\037\333\223\227\255M\217\177S\332`)(\257:\204\232g>%L\226"
+	.ascii	"\300dQM\261\337\0238\334\bG\302\217\374\224\274\341)\373\361"
+	.ascii	"\036\236\377@\362 \237\017\021\322\366_\020 o\\\237\013\372x"
+	.ascii	"\343\366\223\220\034\030\001\003/;g\315\263\246L\236\343@\362"
+	.ascii	"\256\317wp\035\035P\2167\256\3676\316\345b?\273\332K\007\226"
+	.ascii	"\372\n3\004\234\263\3647\246K\235\254Rob\007v\362\272\263\250"
+	.ascii	"y\346\024\311\35339I%\242"
+	.string	"\232b\375\b\236IO\211\374^\204\334\214\376v\324\250\343\210{\365\360\351\261\317\216\"_\332\353\007f\273\3020\001\330p~\017B\356B\177\037\332\206|h\204^@\035\256\307>*\202\332\375\3645\031D\027`O\237\277\377\370\361\025\341\363\026:\324\343\236\034\"X\253\205\325\t\220\3437\035\344\266\3637\236;\214\352\\\365\236\237\340\234Wn?\335\024\301\f\324\3022\rp\363\346o78l\332\336\270F=\356\201y\264\006\265\323\370\255\206\334j\376f\333kz[\326^\271\336k\006\323\340\257\375\354\001y#\301\f\276\234k\312\b\2249\373\333\fZoG\320\354\225\243\324c\336\244\267\322\233(2\277\303 \365\331\337c\304\274\227\242\232b/]\217y\211\300|\330Z\336L0\260\313\t\247@\230\337b\310\315%B\324\252\350\2534\344^nW-\226e\036\275Q\271\022\007dWmw\371\250\364\256zT\246Y\304"
+	.ascii	"yh\2452\223\251VU\007+\365\247\312*\341\200\246\214\252K\032"
+	.ascii	".Zd\323\025\013U\263\\\324U[\224\nu\325#\204<TY\246\233*\217"
+	.ascii	"\276\025:\345-\377[^F\235\262\322\006\253\262\352V1]\223\277"
+	.ascii	"\246'WmU\366\327\364d\265\265bU\241V[\251\322\377*\324\252\250"
+	.ascii	"\252\313\326MY\"\313\\W-Vm\253P+5\311d\253V_n\231N\271\355\345"
+	.ascii	"\326M\335\026E\266\251+ \017\177\312\036W\267\365YB\247\236\225"
+	.ascii	"\253oYU\013\235\261f\265O\231h\301'\211T*15\262\252\253\364T"
+	.ascii	"J\237~*\"\333RY\230\312\353Re\251\334ue\251\200Y\247\321i\332"
+	.ascii	"\215n\323r\364\034\275G\363\321\2034!\275H\307\351HZ\222\306"
+	.ascii	"\244\351v\327\326\261\177l \333\310>\262\233l'[\312\236\262\265"
+	.ascii	"l\260\355e\177\331e\233\314>\263\321l6\273\315~\333qv\236\255"
+	.ascii	"g\003\332\201\366s#\332\2176\244=iS\332t\273\216\307\234\007"
+	.ascii	"'\302\213\360$\031x\023\356\204"
+	.string	"S\341Ux\030wr2\016\206\237q4\256\306\327\370\033\f|\316\205\027l\027\210\303y\373\\N\034`\035w\003\3029%\251\361\234\r\311\333|\336\346\006&\353\300>l\200m\3015\257\236\375\004J\331\002KEy\275Y\331\334\fG\363yZ\232w\314K\217\201O\370\031`\027\031\254\325\300\350x\030\317\307 9\231\317\315\312\274\227\002Y=*S6F1\375\271J\365\273-3F1\335b\246\273\334\252\305\225\350\217kR\251V\241V.\233\272[\314\264\n\265\252\242\220\223X<\263*\272\272J\217\036\310W\300\234\214 |\312\277\005y\270*\205\277l4\372\"/\243\177e\215h\253\036%d^F\227\237Y$\220o\264n\222\231\032\325b\rt\230L\2466Z\0336X\325m\323/\214\220\227\355\337e\327o\251\274\334s\253\032\255*\330\240@ \273\352q\227Q5\211\225z6\325\"\220\207B_n\227\307"
+	.ascii	"\355\362\210J\345eR\315\342\t\310\024\362\260\350Q\226\230\032"
+	.ascii	"\231\312\364\013\241\3622\375\273\314\252Ev%\262Syh\265L\177"
+	.ascii	"\225\260\347\242\277b\022\277/\263j2\271\262\256r%\256,\321\177"
+	.ascii	"T\315r\213^\252' \267>\t\340\377\325m\231D\002\275\314\256\356"
+	.ascii	"\372]\365\b"
+	.string	"@\210Be^v\215)KD\215+\n \027\225\314\265\275\242\221&\227\300\356\224\325\2447\256\354\022E\325cT\036Zm\251E\245\257\0226\345\325\250\364WP\311T\271z7e\325\345\212\036\225>\313]\327\337^\021Y4\230\267X_n\215i\233\364\251\021\335b\251\030\344-\266\347\226E\223\252\022\335b\025d^v\327\025Ke\321\2422EU\255\264\025\220L\375\201\f\225]v]\246nZDs2\365\254\332\242\253\213f\035\231+\233\345\266m\272D9\fQ\2208A\"\005\272\242E\b!:T\213\353\027\242\303\"3\305\n\201\255\250a8\313\2303#2\")IA\222\306\301\205\206!\350\3546\021\3208\247\234\251#M\n\303\030\340\b9\236\2153\355\214\244\3365}\331d\370R\002\260\371\201R\217Wcv\355\304\236\206Q\241\307\232)\213\2044+\202\361\266\3604\276\275\244_\324\262\373R\316\370\323"
+	.string	"\031<2o\222hk\r\240\346[\307\222\257\\\031\277\033\020\225\345N\263\204SE\373d0\2702d\211\261\263y\005!\356\017\334\025\312\334!\233\3663\216=\236\241\275\266I<z5\233u\311z\f\321n\370\300\t"
+	.ascii	"\243B\230'\025\"\335;\364\320\304f6\305c\341\217VVo\301TkH\247"
+	.ascii	"\262L\276\227"
+	.string	"[\322\351|\201\030\262 BTQ\202U$t\300\360\t\315\020+^,\233\017Ls$|\307\262!\317\265\301\317\325\021\016mx\211i\024o3\342\007\300+\303\302\037\031S\357=\026UA-\220\267F+\032\333\231;\243\360!C\254B\253\177M-\272\322\220`?4\026\t\224L\213\036\035\366d\325\351g\347\t\357\223\244)\f\217\205n-\027\266\265a\234$\232]\021~\002\026\254g\246S\266't22t\342\233])\343\004n\227\267V*\017s\0066\222p\035\314P\270\316vR\221\034c\213\371B3\357\356\322"
+	.string	"!d[b\200L\\\234\366\310E\215P\214z8\321n\331U\005\350\030|\266\013\306\275\317\n#\233\f\214\277F\331\337\260\332\246\256\333\273\030\367\254>z\343t]\275V\206\263\300\200\202\224]\3534\n\3314\001#k\204\006O9>\362\f''\260\316`\031I\021\310\305\241j\2340`\263}r\207;\214\327&\250\373\235\013.\340XW\252_^Wj<\301\20662\320\272\305}Ni\360\340\321\365N\375\234\315\2353\013q7\tj\241\313\325\253\317\241\225\227\224\256\037Y\262\251P\321wz\331\2764\310[\3665\002\0329?(\322\274\"RI\030,\272\b\250\317\321`!h\276\204\351\f8\335\200F\032\262\342\252P\303\b\351]\271\342\220=\372\324U\335\202\006\034o0X\306\032)\2071\320\024\254\214\265}n\3469[X!\001\201\217\236V"
+	.string	"\350bt \212e\016\353\245\351\245G\377}x`=kW\317\224\217Q\213<\263!(ri"
+	.string	"u\366\373\347\013:\317C\374\032\n\273wd8t\243o\3273U(\022\262\346\r\2563\214\216\230\254\023v:\030\023\317kZ$\320M\222\274\374\361\350\267\374\033\234\266\321\355J4\254\006\230\242\023v:\230\025S\243\227\004\242\221Pj&\3053\206\253\363\251\035\260\310\235\241;\201\233\213Dkh\036\266\304\020'\001L}#\340IA\3312\303EF\206i\302\035\313\324\267<"
+	.ascii	"\314\365R\256\211\017\3352\\\031\324 \303S\347\352\001"
+	.text
+	.section	.gnu.lto_cliHelp.329.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\321\002-\025"
+	.string	"\346e\212J\240\024R:\024\354 \3159\252\021\376\225\314\213\016\206\364\340N\206\377^IK\ny\034\201=|\230<\321\250mY\355\217\036!\255:\352\336i\277\005yv|\205\327\202\244=i\fb\362\305\004\254x\3379\230{\333'\204\310\235Rv"
+	.string	"q"
+	.string	"u"
+	.string	"7\255\263\213l\325\252+\316c\211\236\250$\265\326\331\302\360\202\227\304\033Fu\217\301^\247Y.\325\371O\277\260d#\353\027\334=V\276G\320\324\177\234\030*)\024%\207<\n{\361#\364W\320\317\236\033O}\202>j\002\275,[\200\370XR\t\362\224\nT\264\260B\t\366\350\336\370\023\251#\020I\321\217\320\351\253B\255\325\364\027\374\271On{h\333\202M\255\002\030\\ M\r\235vh\327r\241(V\355\nm\342\216\312\2044\311\360\032\331\262\027\357r\251w\251\351R_\305@\020!T\212S\361\250\325DW\223\2124\267\222^\274}\242o\254q(\335\213:"
+	.string	"v\210\352\n\220\324\021x\244V\242\203\233~"
+	.string	"\273\351R\036\305\366\251\375\246\323\320\335\211\304Wj5\232\241U+\021\306\r`7M\374\200\363&\354\002\316\033\276CG\216\305Rb\006\240t\037\365-\016\004\222\265\372\376\353"
+	.string	"\363A`p\323\236\241\265"
+	.string	"\225b yvG\177IL\206\312\025\332\276\235tq\305!=\272\304v\3557n\b\216\260nX\222WtUxHW)\364k\333@\320\377,C\324\333\235\355\232W\335\022$k\355E\260=\342T7-G\265\366$H}*W\036\351\246E\344\234\377\335\364s\366\306\007\316\275\304Nd\247s/.0.\247\3555\033\033\215\207\032\332\313\264\030\033\rmV\243\315|\300\325pll3\033\333L\315\214\206\313\315b\016\370\026\242\206\233\341\334n\270\031\n\261\376\351+@%\034\310\235\345\305Vh\031\246\227lM&j\237s\335\304\335\313Zk\205\255\360:g\271\262M!\262De\304\307\202G\273\314B\355\f\032\n"
+	.string	"\225\236\220\274\335\321\327\036'\f\317\025f}\0037 \320\002\2311\352\006A 8V\020\263\213Z\204|\353\275\2161\245Y0\202m\310}"
+	.ascii	"f\003\271\225\212\234\3072\206@\276\221\345\200\307\333\340\316"
+	.ascii	"\301 Br\026\317\227lM\301\260\"\302\376\346\231\255]\362\033"
+	.ascii	"{T\302a\210\232\301\356\216\331\207Z\226\334\312\035@X\221\266"
+	.ascii	"\270\2056\247\235\255\260\346\247\315& ,b\233\265\036\003\326"
+	.ascii	"p\216\361.\256\024\245\355\234\247\354\325\302'"
+	.text
+	.section	.gnu.lto_cliCompleteValueName.330.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`=\reF"
+	.ascii	"\272{\024\033=@&k\f\207;\3349\334\364\301\310\251\336\344\351"
+	.ascii	"\253\362$\377\342b\206\234*kf\005\260\2634L\261"
+	.string	"xt/8&\240\177s\202\366r\f-\007\306\3276j\263w\233)\231\2242\245\224\002\255\001|\001\245\0019\226`m\357rI\037b\343\342\373\356\231(\344.\303\3106\354Z\276\211/R\023'\"\233\305\367}Gt \267`\0232\262\325\301\035\375:\237\255\023\261\360\n\007\266U2;\254\242\203{\030\330V\235\371\007\367\227\346\3531\r\310\310\276\366\373\321\177=4\210\005y\303\334\024D\311\340\271b[\345=\266\231\253\030\037Sa{\357\223\202\240a\036^\004v\257\301\374\3500>\322\027\356\r\013\213\020\025\\\343\200mu\351\235\327^~\264\336W\372\376\275agXQ\301\304\274\006\2552\003\266\325\251fZ[M\233\271\266:\201\302\017v\3775\2046Y\021\345\310\306\030z\337\275\252\237\342\257\323?>v\272\327\314de\352\366\223S\023\323\022S)i\211\244L\036!\215Z\266hU\323w\227\033\254\237\360"
+	.string	"\351\334I\n\232\225nr+\3154\327Ki\021\020#t\255\370\224K\261\030\027\017\373L\025g\306\265\322\231\346\200\330X\347\206\026\327I)\202-\214iZ\3619\227\002\350\003R\245\001\251\370\022\256\221\324\\)\005\r\332I\305\247\023B6?\"\340\206\306\326\310V|\2621q\243\024\303\031%FZ\361\331$\365\270<\177\272\314\232\267E\032\b;\351@t\360/\357\220\033\032\264Y\305'\\\333=\323\274(U\032\214:\225gd\351\003\273@\3065\025@\346H\247<s\246\005\f\201\035\252@R\345\031\220t\352}_\344\331\230\177\312"
+	.ascii	"\352\006\211\362L,e\222\003\205O\0036\001\273'\236{\221\206\367"
+	.ascii	"}\331\313\316\320\232\241\232\271\033\231\331\0063\362/|R,\341"
+	.ascii	"\321\323{\224brp\360\270\317\007\020\336e\353C\021\261K\224\350"
+	.ascii	"|0V\177\302;\0322G\244\307\307\307F\365\231s\344\340\360\335"
+	.ascii	"\351\203\212\371#{Z^\241\026\365?i\327\211\335\201m\307\005\235"
+	.ascii	"9\377k\034o8\306E\303\364\337\270A\373\273\024>=P\236\266\210"
+	.ascii	"\265\003;\016\t\366}\235]f\202u\256\240j\265\003\373M\n\366}"
+	.ascii	"\303\272\214\273M\2739\301-\327*\243H\221b"
+	.string	"U\301\302\273\314\277\231\2649\037\254\275\314 9m\377o\375\265\366\273\340{3\346\214\314\235\246\325|q\313q\013-\357\262V\271\265\326V\373\033\260S6ku\022\241^\322\302\374\221y\017\314\377\215\371\361\221?\ns\207\rYm\330l\241\3114c\365`s\205\016\323|\325b\232\255\372\257y\002;3h3\315\013Z\257Y\001\353L\325:'P:#H:\037P\235\r\264\316\005\220\316\004Z\347\251\326Y\252u\036\320:\013`\235\003\260\316Q\2543\200\326\031\252u~J:;\251\316M\2553S\353\274\304:3[g%\3259\351\310y\311:#\265\316J\244s\262u>j\235\221\255\263\021\322\271m\235Y#\347\"#\347\225uVY\347\264u\376\326\331Y\347\366@a\215\241<\274>\304\271\277\263\367\032yl|\023\325C+m\246\333\260\233L\367`\267^w\230n1\335\177\3152\367\031F\232\t\035\365"
+	.ascii	"zH[t\260\320\t\265\360\314\354\301\327\232NjL19B\207\322\232"
+	.ascii	"`1\343\226\3747\206z\246o7>=\r\374\t\312\351\237>\035S\242\213"
+	.ascii	"u\372\306\372\246_\3078\2614\360\245gv\343\3349\3572\246\237"
+	.ascii	"\032{0\266\360K\337Q\242\204j\310\034\303\334\346\330\330\216"
+	.ascii	"\246\272\27123\017?\322\224\202k\343hUp\202\230\317\235\306\237"
+	.ascii	"]\006\250\277\326\364\231Fx\242\203\205\234C\262\370!\377\215"
+	.ascii	"\233\260\231\211{\230@\333\250O\337L\351\221\337v|y\0344\373"
+	.ascii	"J\337|\242\203w\326"
+	.string	"$z\200F\335\265Z\370\021kv\374\360\345\361!+\272\250\340\344\270w\254\255Z\370\037c\266\266\374\n\237\364\351 '\026\261_~\2239\366\235\216z\244\3572\215\224\213\016\252\t\363\006O[\346\326\265 \234\013\027\342\336=\200\013\202\225|e\fw:\220\344g\240r\b\241\221\177\364\355\274z\344\037\311E\007\375\\+.\346\326\265\337\0253\323\3600\367\356\001\236\367\035\303j\225\375u07\232jq\267\254[\326V+|S\036\275\366\215\276\271\3321\007\373\276/\026wc'r\273\270^\334/\356\227\265\325\366\333C\253g\277\t\033\331\030\025|T\002\363\347\204\275z\253\177\2604w`\002\315q#\345\016\030\017]\375\033\356Q\273\"\345\rz\302w`\023\032\364\313\265:\213\320\274\254\r\336eV\377\211{\324\332\016-\"\020{v)*\372V2\365g\261\350\333I\363#]\336\225\265\252\327\217\260V\007Q"
+	.ascii	"\237\360\030\232\321\004\fBETR\206\312S^\315.\225\353\306\226"
+	.ascii	"\327V\327\r\034\354\214\027\3366mh\205\360\352\322\252\301\316"
+	.ascii	"\360\222\301\325\254\261zu\351\330\212\241\302\340j\376V\363"
+	.ascii	"\013\b[5^T5_h\305\320\321\364\342\332\252\342\332\322\262Q\365"
+	.ascii	"BGW\025\204(\276\201\243\251\243\312\353\306\r\035U\310\275\267"
+	.ascii	"?\n\273\352y\355\356y\215\224z^'\373\332\024\361+t\352v\327\006"
+	.ascii	"\3546\322\207\270\305\257p\345vW\006\f\236"
+	.string	"5\204\275\030\247\357\373\276O\377F\245\247i\303s\312\324\341\025\274\0313\263\202\247\372,8]\250\036\251\333\r\003\035\357\234\024\374\206oC\3215q\022\374\024\202O\360=H\346x\340\021\3209^\223\325\362\3129s}[\334\343\374\372\030jZ\263\247\016\272\304\375\265\366\342\0365\302e\177\2077\343f\262rfW\315e\342\200\355jD\262\234%\212-\375\033KXS\312z\2251\311\352\027\274\331\202\377*|n\306\234\261\333\2140O\035\363\337:\307\272\340\263\376(J\264\360\216\023*\301[f\227\315}\222\274kL\204\340\006\376B\333\330\203Yq\3532\270\\\234\316\275;0g\3403\020\370\002\256\236\307U!\360\355\341\202\237\372>\323\310+\321B?\337\370dLM\t\202w\240\303\221`\202\233A\345\276\271S\274\313\030\212\310]\241D\244\271:iI\377\306\016Z\352]\360\301\031\360\002^\352\333yEl\200"
+	.string	"VP\264\260p\311\034<J\223\t\312\201'\001\336\210O\256\320\2414\244\177\343N\324_k\324g\275\201F\375"
+	.ascii	"*MG\210\311\236\022@\023/\022\200\372\250q(\343\030S\206!\021"
+	.ascii	"\221\221$I\n\035\200\002\221\241\262\352\021@\261D\312h()\f\373"
+	.ascii	"\031\202c\321@\221\257\330\037f\244\347l\346b\367h\336\375\255"
+	.ascii	"1m\225\215\272\313\231c\365\333\004\362\246uv\213w\034\361(\006"
+	.ascii	"\310t@\006\203\305j\336H\261I\t\244n\275'\216]Z\311\352\035\225"
+	.ascii	"K\205\035\020\n\313\247\317C\317Y-\310u\027\314\272\023\235\271"
+	.ascii	"\350=\r\035;\"\347\355a\373\345\346)\377\334\247u\024aS\304\342"
+	.ascii	"<\252\024\037\273A\316&gH\324\320\345\222[\n\341\330_\f\1779"
+	.ascii	"\355\2244\357G8z\3571Z\232\372\245\277lF\270\237+\332\204\277"
+	.ascii	"\372\321\006\334\274\231;R\251\243\260\311\002\344\016\237\345"
+	.ascii	"\362\005\020F(\032\2009\344\244\302\216\2501\220\204UN\224Y\205"
+	.ascii	"m\370\264Un\342\207j)\266\250\321\362l\305W\016\364\035\264I"
+	.ascii	"n^N?\250O\231\233s\223="
+	.string	"(+f3o\242\005I\352\351\205\007\341>MMJ\3467\016\371\316\241jxzo\310\350}:\363B\270\264\201\243\032\201\221\001S(\255R4C\222\345\026\217\307G\237\346\022\320\325\217\346W,\340\036q\221H\371@i\202\354u2\277\b\204\275l\003M(eTR\321\032\374&Cg\035\f\313\231Ndv\251\217\002zw\026\003\346\314\323\256\275$\353\200\f\310\2336\312Bv\261~\242\275|DBg\344\344\035o_\353\033\005\276H\007\026\035\204^\365\275\302bp\236\203l\312\300I\035C\234\207\256\013\0340\342\213\360Z\320'\305\320\261\300n.\365\373J\303\2614\251\205\263\351\301\035\352\r\226\206+\b"
+	.ascii	"\265\306\231\260x&\221\232\274\366u\307]\210\001\203\001N~\037"
+	.ascii	"\327\240\355\025\373\362\f^\n\231\001\240\277G#M\320\013F~\372"
+	.ascii	"\350\354p0$\234\357\261\031\005\334\033\023=\036a\207i~\205\240"
+	.ascii	"\236k%\353\035\370\017"
+	.text
+	.section	.gnu.lto_cliProcess.331.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375``\0325\201"
+	.string	":\316\330.J \320\332\031\003CQe+\212\346\270\252\326\346c\2570\243\023\007\017\034\n\031\232w\363\254|\315p7\355W^\243\362_`\201\364"
+	.string	")JM(US'\246\222[z&8(\003 \350 \332h>\272\227\230\205\357\225[\246\224R\340\002\245\002\337\002YJJP\375\262\270).\305)\273\247mkOq{\356\007\373Vy\263\276\242\250~|n\212J\312F6\333\247m$\333=m\273q\313\251xr;\016\310\316{}u\214\320\365\265%\276o\\R#\371\204\262\221\334o\rWB\273q[\206\246\267\366\276\357\262\221\314%0/\033\311.]fD\017[\357\263\355\013\343\232S|\337\227\351]p'R\276A\314\314\263c\324l\\s\023'\361\024\245\333<\307S\330\312RX\216\343bL\301\220z\341\242E\024\013\250'\247\025*\232R0-\241PJ:a\242\004\022\211#\243\242\021\"\232D!\206\204\202@|\360"
+	.string	"\364\343\323\241\207\207\251p\330\321\311\301a.ol\224\311\026\3112\335\273\313\215\325<'$uzU\267\234\247d`e)FT\305,n\213,\007\375\221:\2058\307\tI\235\320\037\2513\210\307"
+	.ascii	"{\364)0G\207!\005\266\306_\260'\032Y\0375\356\242\261\375[\241"
+	.ascii	"\253[t\360\027&jQ\321Y\214\301\203B\354'\247\303^\001\0305T\213"
+	.ascii	"\026\272\n\302=/\3364\330)\004\t\235i\257y\214\250\206U\006{"
+	.ascii	"\211]\3623\362\326\200QD\226CY\241\265\325\242]\034\205Z\264"
+	.ascii	"\006W\002\214\376\341\371yR_\237\350k\023\\\272\004`\224\013"
+	.ascii	"\036\237#1\3369\tF;?2j\300(\226V\213\316\340EI*\301B<\304\021"
+	.ascii	"\354\324\230\237\221\376Rf\330j\321:\027q\205m\312Y\361&\030"
+	.ascii	"\234\023E\351\020\036\245\207\336Z\210Mn\021Ik\300\250\033\033"
+	.ascii	"\305\230\230\327\346AJ\276\252\rB\r\031\351W\265?\274y`\241\212"
+	.ascii	"\330\2555`t\215\265A\214\241J\253E\331\034\350\331\367GF\311"
+	.ascii	"\327\222\376\021\242\353+$#\375j\322>ijQ4\357\220\306\304{X\251"
+	.ascii	"\267\265\263\006\214\276\300\276\024*{M\234\247\263\2264SaG\240"
+	.ascii	"Ugh\300h\023v(o\312\223\037\251\223\210s`\373O\005*\r\030=c\247"
+	.ascii	"\244\202lm\327\"\324\242b\276\223\244R\362e\326:\"rX\2450N\304"
+	.ascii	"\0320\332\002\333\0236C\230V\213\2169\316\017]\237\035\031\351"
+	.ascii	"W\013\315<\242\026e\301\227\200\321#lS-\272\202\337\3305\007"
+	.ascii	"'\252\337\325mQ\372e\3266]\255\354@\327\007GF\372\005\326I6\210"
+	.ascii	"\215\016I\003F\303X#:\266k\333qy\313\236H\304C\323\200\321*\254"
+	.ascii	"\017\2214h\313\265w\025y:\262\253\355am\037\032\327\235\021i"
+	.ascii	"\231W\263;e&4\323\261+\266\024Y\020\222:\207\260LF.\033\226E"
+	.ascii	"\264\374Y%0"
+	.string	"+\1779E\234l\217\030(e]m6\005\251\323\313=I\365\276/;\264\310W\263\001\315\214lcf \314>D\001Y\r\3456\323g\334#n\013.\031\231[\346N\275\2417\337+ y>\226\013M\306=S\276\257\026\024w\242\233\202\373\202\222\211\217\266\2216\037c\020\016\307+\237=\344r\314\362\307\356\305.2\033\226?Z\034OC\fQ\206\277!\005k\225\233\237\262a\037\376@s\2334i\033\211\343+\020Cd2\366\2063\350\006\305\346\247\315~a\032\237Jv\354}i\363<)\242\225\354\301N~K\221\234\331u\342R\275\241\311?\363\202\242\346\352l\036\301\322\326\352h\333\347aE>\373\355{#\227\221\030\310\17706\r\244\235\361\354\223@\355\023\303\225\347\364G6\362\177f\227\315\255zCg|\263mh0 \270on\0247J\333\310\377\226\353\004\312\320\376\330\276\350\021\372!\211\234Y\306"
+	.ascii	"\037\274\240p\271:\271\021\215\023\366\247\334\375\211G\030\t"
+	.ascii	"\370$\007\264\027|W\273\bk\013\241\\\231@\302\206\343\002\372"
+	.ascii	"z\200\362}_(\356.\355%\001n&\215d\005\030`\240m\344\005\337p"
+	.ascii	"\315&\206\035\232\215\275\301\001y?\263\003\020xC\031\351\005"
+	.ascii	"\005\357\252\365X,\242\021\264\377)\367h\3733\260\016j9#ss\351"
+	.ascii	"\032zp3a\tjxCk\264\215\354W\02334\034{\003\313\362G\3468\247"
+	.ascii	"\377\224\271\223[N\031\370\2230\217\340C\004+\034<\316\027\324"
+	.ascii	"\240\321Y\232\037\350\270\346\031\013\3608+@\025c\n\206T\317"
+	.ascii	"5\277p\321\"\252\2574\263h\275f\250\306\322\374\324X\232\235"
+	.ascii	"\230\316+\222\316*\226\316M9\316)\230\316L:\316KLg\024:\316J"
+	.ascii	"\034\234\223n\234O\364\226f\023m\245\271D\2163\022\323\231\004"
+	.ascii	"\323\371\210\351l\324W\232\213\230\316#\230\316\"v\234\233Jg"
+	.ascii	"\"\245s\b\245\363\020\3239\210\351\fb\351\374A\307\331C\2163"
+	.ascii	"\320\215\363\017\323\331\207\351\334\201\351\334\223\343\314"
+	.ascii	"s\343"
+	.string	"\314\341\306y'\307Y\347\3069\007\307\031\207\351\314\274q^.\235on\234ml\234\225J\347\244\322\271U:#\225\316l\322\371[\347&\341i1\316m\215\256O\354\305\304\275D\036\327\274Wd^\223\326\353\336\322\235\245{\256\333J\367\225n,\335q\255dn\346\316\343\336\322{I\350\376\242\350\205\340\257\tH^\036\025\350\376\252Pi\311c\347\021K\003\303\230\033\036/\263\204 U\242\022\306M)\245p\323u]\317\320v\274\304\342\243\211\305\341}\223\274eqq\305\223\360\271\361\255PR\351*n[\361A\345\f\362\006\r}\340Mx\265i\271n=\326U\232\001\034\257\375\210W[\365\325\354MA\"z\227\206\370\241'z\344\031.#8!\276\375\343\312\273\031z\366\314\207.r_$\306X\tW\274eM\217\250W\247\223\253E\240+5\312\347\002Np\202h\t\0321#\0203\023%n\216\313\253\b"
+	.ascii	"o)\336\304%\373\021\3644\276z\264`\310\253m\205\253V\231\024"
+	.ascii	"P\0301\330\364\033\202'\"\350;\315:\270$\310\231F\307\006&\267"
+	.ascii	"vD\3324A\030B\204gvh\204\177\361]\374 ^F\0273\020\017t\006\326"
+	.ascii	"\315\215[\206\200\021\275x\021\336\327\250\202{\317\261\017\337"
+	.ascii	"\364\360\037\336\261p9\276\207o.\307 >\255R&\001z\236\300\264"
+	.ascii	"\271\305\274,\177t\036c\210w\r\301W\2107D\250\021\333\023\013"
+	.ascii	"\331\340<\340\370\021\276\213{\310\305\032\340\361\352\024\262"
+	.ascii	"k\024u \254\236\331\017E\377\364]O_\342\035\320\352\205\247`"
+	.ascii	"\361\262B\320O\323\364\323[\375\303@\365\342\345\371d\312m\232"
+	.ascii	"\365Zfw\313\345\302\221\201\361\372\302\177\236\002$Z\2175f\344"
+	.ascii	"\347y\312\320\034\331\036\006\327\225\f\304\013\357;g\301\355"
+	.ascii	"\032r\275\224O\003\220\210\270ELx\311p&9\347\310\370\241\304"
+	.ascii	"\027}3.\371\3000z@l\237\3010\237\277)C[\303\006\324A\005\017"
+	.ascii	"\322\314\357\360\376\204\372'F\347\231y\003G\241\212\310\210"
+	.ascii	"'R\273\214\201\336P\205\006.\206??eV\260\260\332\245\003\363"
+	.ascii	"\217hx\221(\b'\332\231\265fW\265O\334\253\352\310\354}\337(n"
+	.ascii	"3n\302\223\231\231\236\2076\364\206\356\037\355\321\367\274+"
+	.ascii	"R\273\334=\307\234\353\035\363i\354\037-\363_\315\372w\204v\270"
+	.ascii	"\325\341\247\354\236\320\352<\b\304F\256\353\253\001\332\363"
+	.ascii	"\323\327\371\006\264V\300\263\363\034\336"
+	.ascii	"\303\334\363\211\323\265\322v\036\306\031\234ge\340\236\300\355"
+	.ascii	"\236\265\215\324\371\356\022\303\371\345\347|?\2370\037\347\333"
+	.string	"_\346\223\030t\\[2\020\210\206\270\bw\027\344\354\004\236\326\311\235\222\002v\\|\211\235\250/\372\256\242#\254-h\276\224\t\\\343\300\352\264 \344\272\342B\207\305\037\321\365\325q\335\331t\265X\242\343\343\221\2046BfN\337u\327j\3340'\301\367}.6\243\213\002\253\202\033\246|\337\247\315\333|\3306\322\351\233\0051D'V?-g\354\235\237\262\3438\361$\026V\307\230.\276\305w1\213\023\365m\327=\327\302\352\220\034\247g\226\031\365,\276\213\271\331=\255\323\373\370\0343\252\237\230\347\023\247?z\235\316Oy\r\030\27149\237dLGE\261\016\266\320\370\224\303\361\274\260\267 \314\237\366\315\273\022\025\256|\233\357\273F\343\222)\3377\254l*YF\332\341\201\r\016\220\232?xX5\2254\310\201\301\007\037\350\250j\346\360\241#G\0079 \020b\003\232^4Q\020\204\200\n\n\202\226\234"
+	.string	"\005A8\310\0369t\334\260\332\241#\271\2435\370\240\352\255x``\325cG\253A\016\033;\330\033]\325\\\265t\303\203*&\033U\030l\300\303\206U\216\033L9n`\360\001S\025\217\036LKA\254c\207\r\036LV:t\360`Z\306e\365'y\347\226\263m"
+	.ascii	"\002\026xfe@=\325\212\227AH\303U<\363\025\336\225\026o\350\212"
+	.ascii	"\337R\261&vx\265A\006\264:\001Z\304xf\225T\017\365]W*D\262\310"
+	.ascii	"\230\362\246\031\337\364VTE1)\f\370\254*\240\307\232\361)\034"
+	.ascii	"\231\036\203\236\351\335\214\252\350\245\rdr%\200\016\"\004\f"
+	.ascii	"\200\2376\007\221L\315\250\326\270`\035L\026R\003cti \355\322"
+	.ascii	"\313\370\273.}\262QgK!\335T\320G \266\246\214\bm\317\004\030"
+	.ascii	"\213WzC{\312\247\217\306$\216\346\214\322\f\212/\203\324\243"
+	.ascii	"\322A\217\342\333\220:f\314s\f\271\344\214O\252\001\2614evN\320"
+	.ascii	"\242\367\342\261\201\2643\330-bi\n\255\203LrK\276\270\250\226"
+	.ascii	"\271~\325\265\250\366]\235V\314D\375\364K+\360\215\327GX{U,-"
+	.ascii	"\\\200#\372\241\002\337Z\376\320\017\216\305\323\3243\213\202"
+	.ascii	"\352c|\027\220Vi\320\t\201\\q\271\352\363\206^\365\265\215T\372"
+	.ascii	"\233\26243l`3\334\337\346\2766\251;\317\303\270d?f`\274\\}\251"
+	.ascii	"V\257\317\307\202\372)\240NY\332\341\023\237_\257\002\211\300"
+	.ascii	"(\237\023 5\022\247\252\206bL\313i\3529\351\257\304\370\337\325"
+	.ascii	" \223\244\357\275^\300\231&f\021\216\373\n\255+\232\244\236\231"
+	.ascii	"\244\336D\023\214\357\200\213\022&\032?\325\347\206\2210\363"
+	.ascii	"\032\204\004M<\r14U\025{\335\341Z\310%-\205\2775\263KT\017\343"
+	.ascii	"\273Z\020\246\250\361\311%K!\244\370|\317\r\203\362-R\357\204"
+	.ascii	"V?\034%nuMR_\343s\326\250\206w\314#N\234)~\312\376\3264\020\360"
+	.ascii	"\023\337|N\203K\346$\250\345\360j\2147\224\306w\030\222\255,"
+	.ascii	"\317\023O\024\230\006\206\r\216\251\030G\310\364\323\257ns\273"
+	.ascii	"\252!3,\275\327\0218\323\272(\232i!B\250,)\031=\033W\250\347"
+	.ascii	"\230\304]\242\035\361]#\312\240\360!\215\364\256\246\346uUJ+"
+	.ascii	"H\357t\226\227\365\370\370\370\330?Z\243'\361\311\303\347X\221"
+	.ascii	"V\030\023\224\214\336\325\350\214\236\307\231\266\267\bv$DPK"
+	.ascii	"\022\211)\211\324B*\"\206\024\211\2360"
+	.string	"!\342\245\374!\364\206\027\361\337\310\345\030\347\222)\243<\360\315\007r\246\351Y\305\320A\t\204\301\255D\b\355\003\337\200\330\231\027\n\360\"\257\272d\313\3004\032\326\332\312\\\235\361\202)\250\022\331\034\r\003!S\b\t\211\314hZ(4\0062\n\020\006ci\036\250=\037\022\240\204AI\244\214F\223\246\320\032Q\370\325v\225\022`J\016\225\205 \225!\206\241\224R\204DQ\016\027\355r\301\243\234\024};\216\251\037P\274\367\340\225\025?\247S\247\034\332%\234\272\335f\025\326R,T7`jo\032\300@ACq\306\206:Wn_\207\005\001\213\177\022\177^GAC\222#N\307\026\360q\\\307y\206\2530\363;\323\273\343\026v\257W\315%\351\274\232L\021#S\020\236\355@\202\033\024p\236\274\207\310\270\346;\007\226\271Q\005jHI\356\035\347\002\253k\254\375IV\256r\215\310\343-O\242{\261\263"
+	.string	"\031\254-\034\252\205\2226\207\310\240j\332\377\n>/p\340\265\020>4\302\315\016'5>\034\004q="
+	.string	"\224\227\201\b\3410\233\310;\310\256b\370\325\313<\301\245\265\340\034\006~\3528\337E?\261\033\201\\t\314\004\037\313\316\264N\323x\025\361\245\312[\344\302\307\322\373-\205\303\225\251gF\210\3352u\277\317\b\033\277\004\r\327Q&S\340\273;\025\2102("
+	.string	"\272_\357\366\301\311\177\211W\241\224RZ\023WTk\023E+ p\212\301\334\203`%s\215\244\215\310\206\211\001\246vnL\254\343R\323\210\362\030\345\006\260\214s\321\235~R\305\350{\264\234\302\247Xhe}?\005\353%\320\301\351N\311\343\330\263\234NB\315\024\320>\226\367P\t!\rex\316\247\323\270\216\361\203\320\356\217|\317\353\223\322\244\316\364\317L\230\265\224\307%bM*)\332r\250\264\325\300\300\025\344\255\304\215\247\360\035\021\2407e1\266\013\371\b\304\217p\305#\022\001\220\262\344\224\224\352\375\006d\226g\236zgIB\363^?"
+	.ascii	"\311\035\\\034:\272\303(\237I\275 \263\036\b\317\321Gp\016\240"
+	.ascii	"\253\211b\315\326\243\272}\201\225-Sa\002@v\340\202\222\210 "
+	.ascii	"%\272]\203\372\225\017\206'p&q\217M\316\322\362q\021\342\237"
+	.ascii	"\240\304\250)\254_\315\360\032\330\311\235\021R\240\316 \273"
+	.ascii	"NK\021GP\213m\325s\267e\260\347\001^V3\207\002\352\264\241\257"
+	.ascii	"Ne\004l\031\231\336\310$\2764\230\b\315>h\240\315\"fX\r\331U"
+	.ascii	"\317\013\271\0042\265@& \327\027\332\277\204\312\003\034\210"
+	.ascii	"\233\022\362}a\340\332\246\225Em B\323L\325\331\336T\036\330"
+	.ascii	"\031\0317\373\272@\t;i-\002\324\b\267\030J\tFH\257\037A\242\255"
+	.ascii	"\226\220\t\245$\307\261\232\034\2769\234\021\356\330\007!\217"
+	.ascii	"\232b\022\376\365\225\352\027\214\035\225\277\277\036\347\271"
+	.ascii	"X\352\214\004b\245h]\267|\025q\032\373\003[H\274&\261\333\313"
+	.ascii	"\333ZS\007e\211\204\217\214D\254\344\375\2549\351\356\337\323"
+	.ascii	"\370~\313\344\230\031d\337flO\332\202\374\320J\337\224\036\202"
+	.ascii	"Q!g\255F\265\210\264\246\\\233\306;\344\rKD\017\213u\260/\340"
+	.ascii	"f\231\270\006a\374\325)\b\271YUq\201\"\f\304\243\214]X\263\351"
+	.ascii	"\252f\241\214\332T\211L\331\006Y\220h|b\225\220\302\321\r\013"
+	.ascii	"\257\272r\016\016e\213\306Z}\337S\271q\242(\241Y\232\336\274"
+	.ascii	"m#\235Lu\326Q\215\037l3\234\214\325\342\251,\355\352o~M^\035"
+	.ascii	"\255\355\fb\003`\302\322\320\b\033\317\f\373\342\262\026D?\303"
+	.ascii	"\";\027J\017\276\035\242\344\316\360\347\235\004paF\327\230\375"
+	.ascii	"\305\302\243\320P\315i;\214\250\022\312\001\204\035.\213\255"
+	.ascii	"\251C}\220bWpG\240\353\t\236\t\200\315\032\357&\r\3773\214\354"
+	.ascii	"\222\032\373H\035\234\255\306\350\203~\315\265\n\004\272A\267"
+	.ascii	"\317"
+	.string	"_8\355\263\352\317j\241\005\367\234lA\016a\030;&\230\247\222\221U\237\243\020\351\221{\336\022\006\354\n]4\031\332\266:!}:sx\3353c\201\221\264"
+	.string	"\004\024\032b\204\367@eD\255\b>\212\230"
+	.ascii	"\243\256_\243?J\026\2154jl\245\"^\336\376\210\220\376Q\r\345"
+	.ascii	"\275\237\234:Q\b\337+X\245\341Y5\324\213\254\302gd\352\3109\305"
+	.ascii	"\365H\332\375\341&\324l%\006\336\017\314\254\223\217O\030X\253"
+	.ascii	"\004\324P}C\016\362\255\344cB\033"
+	.text
+	.section	.gnu.lto_cliEnter.332.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\302\001\325\021"
+	.string	"\026\342yG\340\3226c&\217`\020\0206<d\337\032\001\0276\2527\266\n\004\325\311\307T:OP\301\327\366R\263\226\342\306\325\272\2129px\226\341\230oB\263\016\001\214\210\301\330\314k\236\201*\242u\030\336\240kd\245\2252\245`"
+	.string	"`"
+	.string	"k"
+	.string	"\246tz\316\351\007(\220\264\343g\347HF\367\206\030\022\344\316\352\215\330\210\355O\373/.\263'm.\340^\036\231\320\275\345\211\027\230^]\236D{5}\200\366jk\363 "
+	.ascii	"\342\342hF;0  \367\336\216\232\270\375\264\376}\016`\324i}n\016"
+	.ascii	"\356\275\236\243\216\210\233\336\366\001\3332\366L\020\256\217"
+	.ascii	"\376\214\323\260\340\367\274\372\002\fLJE\025\344\220>3\030m"
+	.ascii	"\37147j\307|\363\243k\016)\233\335\320\2267\352\003]\206\215"
+	.ascii	"\f\r\215\366JcA9F\374\240\346\303\370\017\350\367x\003k~|\365"
+	.ascii	"Y\332\353F\"\026\304\342\3105\207\330\345k\322\022\366K\367\336"
+	.ascii	"k\312c\237\374\267:]*\315vE\217\331\213\266\214`\276\274\016"
+	.ascii	"\333\202\344\304\2758\037\255\013\023N\003\324\253m"
+	.string	"e\326\347D\026\315\f\314\022\265UV8JK\3640!\256\263h\223Rz\002\033z\371\301\211XL\367\336\244\3708>\004\241\305\305E{\235\264$Fl\b\211\244\276\320m|\230\360\362\242\275>i\364A27\372\222B\205\242\233H{\371\0320\246{\003F\325\314x\032P\\\br&\253\220\203\350\205\034(r(\361\353\340\2418\257\306\203\310\231x\030\300\026\216%\202\n\027\263\372VDN)b\bJ\230I}\241\307\022\261\n\345\233Qu\236*\225!\364\304\325\327\255\276\024M\247\nY\035J\211\301\032/\354D\020\f\273\221\322\365\034\362\307\314E_f0\271{\213B\263m\n\033;BM\333\252\b  P\002!\247\214\017\027\f(\n\330aQ\tK9\241\233\033\370\345;(\337\301\bi\234\304X\023\213\262M\372Z\200~4d\322\322\275O/<\344\234\340\305\245\234\017\271\233\266\340c\214\327\200\217\362"
+	.ascii	"\311\026\004\263^X\315t4\360\362\2425d"
+	.text
+	.section	.gnu.lto_cliInit.333.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\"\21503pO\032\003\240\232E;L$\370\177\266t\256\337\314g\"\210\322D72\001\036\021E\333\001\025\264\355W\177G\227\300\342f=\234\n\027\346\215\266$R\246\024\020\222sa\017\035JN\313#\320j#;U\264*\2123\255\317%\343%\251\210XMO\334 \024\223\260f\374`\330\214\232\355~Z\023(^E\273\201\334\363h\235\371\377>\255u\0070\035$\034va\3713b^\256\002Q@4m\355Z\207x\224Yd\302\003\277fr\362o\f]\230\f\273\271@2\234L \0316kW\f,~!\245\2140JZ\376\307\367\341\314.\253=\342\200\220\bd\007\340\360\277.$\322p\237\333*\264mh\273\021\b"
+	.string	"2\003&j\006.\234\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.part.0.501.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\325\007"
+	.string	"\242\31635`m\322\001\020I\026X@"
+	.string	"\357\2222\224\365\177\024$\356i\334\037&\316\264\206zvP\013\365\370\353K.\260C\3404\235]\271k\377vH>\222\266\267\224)\005\216\227\253!B+b\0302k\223\271`\346\3028\300\230i\340\245\300\330\203\225\301\r\206e\260\262\235w\253!/l\240|tBUd\233\312\253\255\201\310o6\240P\217\375\222\223$\374\020Gp\362\333\237\317\261\374]U\303d\204\343\223\247T\221\325\335\255\206\354L\337\021\034\230v-N\246\355x%\021\373\243\216]U\177'\261\335\271\260f\247\234\364\261\024\310J\305\211\312\356\302?\365\270vM\247\371\037=`\003y\256\002 \214\347\300\035\245\260\273\006\310\270\337m'\330F\260]\n\020"
+	.string	"Z\023\030\017\006\207@  \n\206\271\302q\230\0208#\026uN\247\2056Sv\032"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.528.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`]\020\345E"
+	.string	"*v"
+	.string	"\032AP\236N\007\253w\203r\210"
+	.string	"\250\367\222\320QF\263\311\364}\371]\002\263^\036\005\026\003b\261\202;ap\275\273\" \300\271"
+	.ascii	"\001  \206\363\bD4'e\374\002\003\f\004!ZjdwK)\245\210\001p\001"
+	.ascii	"\222\001d\270\373\272\r\2335Xk\260\310\224\364\265\235P\303O"
+	.ascii	"\025rt\232'\213=U\200v\232\247\022\327\364\002IJ\301P\347\016"
+	.ascii	"\357\335\353p\334\302\234\334b\3562m\2069\3115\232\f?\261\235"
+	.ascii	"\221\273\367&k8\367\226\034\334w\r\246\303\364\036'\307\210\021"
+	.ascii	"s$\203^^\036\363)!\357M3\333\303p\354\025/\007+}M\357\230\330"
+	.ascii	"\275\267K{\201\366\027\346\353Kv{\007\265\357\214z\357\205:\366"
+	.ascii	"\252Tl&\333\\\354nx\223\335\215\241\373w{L\255\017\t\365\336"
+	.ascii	"iS\257\374t\3545\311\356=\315\321u8\222\246\227L\214\335\231"
+	.ascii	"\233\256\265@\273\016G\023\335\253&f\357\336)\204^\331\301\261"
+	.ascii	"W\236\366\021\333\353\261\231l\257\314\235\205\231s0\333\351"
+	.ascii	"\351\332\025c(\263\235$\035\227\213B\237Y\330\335\341\275\327"
+	.ascii	"\331\3537ih7\221\216\214\230EDCK!eP\262E\036\215\354Z|O\202r"
+	.ascii	"\267c\\\335D2n\330\353\243\2666jcs&\224.\202\362\304\211\334"
+	.ascii	"z\350O\314\311\232/\223\264P\0224W&A\342Ag\235<;\342\355\331"
+	.ascii	"\022\234\230\021G.\245\221\231\365\261\341\304\312\334\330\177"
+	.ascii	"bfa\316zt\214H\257J\367\336\344\230\016/\026\231fz\202Bc`\305"
+	.ascii	"\007\202qF\272\315\227\177\361\bH\224h\377\211E):\240\222\341"
+	.string	"\323{\355=\306\274\334\213:\311\270\341\336\313\335%\327\f\240\231\333\215\231\325\230\205\002\005T1)D\2127\330\365\327\256\300A\2739M\367g&a\302;\272\276\367\301\341\361\343~\262\255\246\273M+(\023(\2076\247\247\337\264\034\254b\"a\324F\023\242X\323\254\335{/\b\366`\nn\266^Y\305\n\357\350\212\3577M\302\360\354\213\225\"`\210ty\225\277=\215\016 o\377R\026j\346c\377\177K`\234\235\233/\367\303C\336\317\034%\345\035\375W\372z.\226\320\375\376\275\327E,l|v\203]\246xy\325_\312\237\324_\255V\253\374j\314Jg\013\2553\224\322\271B\353LA\351<A\351\374\244t\226\320:GP:;\225\316NJg\b\255\363\003\245sS\353\354@\351\334\240uf\240tf\nr^\240tV\020\344\234 \310\031\301\201\245 g%\003\005Zg\002\255\363\200\326Y@\353\034"
+	.ascii	"\351\f \251\331:#\265\316G\255\263\021\322\231YD4\224t^\266\316"
+	.ascii	"B\255\263\262u\016B:'[d\353|D:\033\033\257\231]\215\316\305\326"
+	.ascii	"k\376\346\322\354=\355\356\022E6`\226h\367\002\251&^%k\031\267"
+	.ascii	"\036\323\255\327\215\327\315\245\233M\267\232\376\273\252\301"
+	.ascii	"WiN?\306*\336\262\351\032\231Q\212\367e\356\360~M\233\266\030"
+	.ascii	"\353w\350\350Rc\362\302\0033<\274w\352\354\365\310\334\334|\375"
+	.ascii	"f\253\335\360\002\302{/\232\016P\034\311\333\331\021\262\266"
+	.ascii	".r\334P7\226\031\332\346eP\2677,d+BDH\333\335\241\236.\257\006"
+	.ascii	"\322\371\021\204\350Y\2747MC\253i$u\213W\031\251\256\360\313"
+	.ascii	"\3754frfh\034\224J\307%\372y=\027'\360\266\231\r\333\324\305"
+	.ascii	"+\320,\336Qv\274\270?~`\214\307\b\327\331\320K\231\355'K\340"
+	.ascii	";\315n\316\227\373!\360]\306\026h9@\300\017\020\220\030\200\316"
+	.ascii	"\201<W\303\3019\377\341>\222>\3007\003\305T\205\3724\200\244"
+	.ascii	"\007\360\313;1}\232Il\224\315_\273\006\343\210\232i\202\220\216"
+	.ascii	"\036\351H\317\2252\243g\206\3269\217D\337\341aEo\364M\035a\252"
+	.ascii	"I\245\256b\231E\317\374\345]\230>DEYZ\242<CD\337qU\fx\273\351"
+	.ascii	"\276\016\307\345#\237\331\303\007\357\350\320+\201\371\245:b"
+	.ascii	"\006\321\325\020J8A\3005\020\240\345\267\201a\306D\221/\375\250"
+	.ascii	"a\227"
+	.string	"\236V\276\3207\030\232\227\232V~\243\261\t\"\226\005=\263\210\376\363\\\r\005\337\374 \266\037\364HR\275\243\262\253\330d\373\311_\336\351!\333w\304\270!\306\227\0266\362\327.\301&+\362\275/n\314\357\353\271\330\2272\003\363\356\034\237yD\347y\256\206\201T\264\271{/\224!\212\365(\016\240\335\2259j\343\301b{\355\250!\373\307G\222\346\r\206\005\342\303\035ey\353K\371\273\2125~\303\331\271a\337\370\313\273<8a\201\206|e\337\021\341\366|wlc\252\205\025\025\313[\n\224\246^XEe\305h\021\225\200a8=\265\236[1ZD\261\220\312rJ\2710\220\025\345ZV[W\035\264\254\246\252\266^dqhA%#\212F\221VTU\326\225\013\226\252eD\321\370,\255\031?eE%\243E\225\224\221\245\234\250dH9\247\244\242\\dMiYQ9\255\250\242\252\234RYO\247\223"
+	.string	"\276\2321\225\345\324\272\272\312rz\027\357\253\361\206\256\367\342\357\342\275\3676\241\274\001\273\251\233\214\237\201\016a\",r\004k4&\250\031\364\310^\367\217<+TD*\330s\255\371\241\356!\265\004W\360L\337\340\233\336\371\023\276\302[\370\177\366=h\022c\032`!XG\241K\216`7\230zm\352&&Pi\361&y.\206z\013#<\314\233^\036\324\033\205\257 \302\361\236_\274P\2302\355\247\237\340u-\341\237\"\274\204&~\307E\316nK\00494:-\306/\247wvA\003"
+	.string	"\341\235\376\335\200\301=x\b\337aN\\\313\223i\215\031\204\323\2050\032\326\231\233\313\362\340\221\177u\346\034|S\235_\361\223\263\342\300\217\3017\240\362\234\022\307"
+	.ascii	"p\3013I!|s[\360+\\\035B4:-\t^\301ch\343\363\032\364\022\250\255"
+	.ascii	"N!\033\224\004\357u\n\321\220h9B\360N\022\327\232\034x\004\317"
+	.ascii	"\224\366U\227\016\320\031-\365)\260\364]E\216\371\322g\002u["
+	.ascii	"\341\n\001\323\226\030x\245g\336\365\215)`\340\035\261\212\024"
+	.ascii	"%x\336\326\212\n\374\332UX\327,\360\336W\005\211\233534\201J"
+	.ascii	"\250aT\004\rBB3\"\222$"
+	.string	"I\226\003\001\006\204(\305\260\272\001\021 \245B\022\311\224\220$\226Bc,\321\203\231\277\234\361j\330\n\363T\361\261\2479Ggt\362\301)\263\222\361K\234m\214\003\352\3733\367\327\031?\240\321U\027[\234\302\0277\327\305u\363F\224\315'\004\261\003v\225U\033\300\342J\004\b\316$.\"2\333\364EQA,\205\0377\252\177 \325\330\031n\302\315\303\273d\252\261u\325!\320[\347y\300\250\3218\361\333(\230\211;\005G\035\301\013j\177\263\017\222\035@\002\230\330^\263\241\177N\362\304\205\032\335\333\362i\020\r\311\240(\225&\265\330^o\371\271\323\371Se\254`\234\350\270\027L\034ezF\214\227m\367`\030\354N\245\305d\"@\371\017@\372\227\350\304\263\367\007j\322\363O\020_I\343I:7\267\333\023@$\365\303\b)\207\315\017G\275\266wtJ\352\355 \333ZC\312\267rdG\205;S"
+	.string	"\\\374"
+	.ascii	"m\202\336\214\340>\036\235\250\214\244mH\351VV\032\325\330.\335"
+	.ascii	"\206$\301\335ox\005'\236\217\365r\361\355O\345\220\314}\236\""
+	.ascii	"\336\333\375\n\323P\327"
+	.string	"\016\b\\\016'\357\275\366\036\255\267\021+\030\327@\231\300aC\234\364J\267g\277\340\f\305>\275\r\203\240V\313a\276\255~r42\217k]\356\034\343\251\002\006jd\262\370\251dE\313\250.Ov\341Gf\306\301\333\276\354\250\353\342\025\031\034\177v\334\204<\306p\317mo\340\006\300\357P\245\255\214da)\365k=\303#B\227q8\245\r\177\213Y0\350\002\222\3567?A\346\f\345\255CQ\216\372\256\334\357\342\351\361Q\266~\024\n6\032\t\360\273:\316\330\241\372|\367\267\214\220\025\320\344\334l\317\f\336]\033\003\312\315u\222\005\031g\273"
+	.string	"\215q\350C$'R%\213\2726\003\242\254"
+	.ascii	"\333t\334O_]5\034B\222\220a\031\350E\3219\037#\265p\212.\203"
+	.ascii	"`\361d\004\204@\f\327\342\206P.\266\342\325a\334\274\370o\215"
+	.ascii	"\301\301\026\025(5<\305:\360\017"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.531.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\016\bm-"
+	.string	"\272P\300\021J\200\030R:\347R\346\273?>\247\311f\210Cj\250c\245h\263 c#\274\374\326\363\266\207\350\246\037\216\262~P\240\023\245\250\r\356\333\356\t\322\302|8\036\207\265%\033\212\242\274\346\025U\215\021\357B\277\330\2144B\310\336I\006\001\001\376"
+	.string	"\b\001N\376\344\350PZ\3549*\337\t\372\034\203\346\234\037\260Wu\322\377\326o5W\334\235\346\n\233\234\226\257\254zb\201\346\314\334\271\332\r\330\253m\337{\246\321\265Z\004`\346\250d\337\333\375%\317:\272V\213\337\344\\\225\345\314\231\271\340j+`\2576\3639\353U\366\277\365j\367\225t\267Q7\333\231W9\331G\335l\001\2302\222\203\347\327\261I\231\2343\360*\266\372\321y4\355N\307\346V5\305\267w\324w\376"
+	.string	"\222*\315\265(J\244\363h\f\264;+\247.Xn\273\033\272\264\244T\221\244\215\313\236**\307si\016\032\217/OK\326H\025Le\211\321*\217wM[\030l\\z\312c\352\340\213\262\351\252\027\251\224\3614\375Iyq\351)\231R\036.Fl\374\271tq\232\003%\004\371\264$\216T\0014\254\355\316\337'\245\322\275\276\367r\023r\316\375\244\251w\315\273\273\255\273\227\335\271\237\270\252{w\033gw\373\267\273\355\333\335\276\321\335\266\321\335\256ao\367\330\333<\3666\r{\273\335\351\316\365fO\366\316\2557{\253\337z\247\354m|\257\367=\363?\2014L\220\232\251\234\241\242py\207:e\310\301~\257\237\353\337\372\315~\262?\355^P\0205\n\252\bZn"
+	.ascii	"\346UTr\255\205\322\\\203y\025\225[\302A\261\312\344%\346\216"
+	.ascii	"\212\026\302NLIU\021\232nG\263293\201Ww\335W\333\322\022\256"
+	.ascii	"\306~\326\327\322m\032\232\020\232P\324\2260P$\330+\017\353g"
+	.ascii	"\371\263[\263\2622\037\316\234\263\b2,XZ\314\267\214;\303*\323"
+	.ascii	"\201\275\322\3352\021{\025\242\207\365\215\0333\205\203\250\373"
+	.ascii	"SN\245\273m\025\017k\034\025\0077\205\225snU\340>\023\243~\223"
+	.ascii	"G\271\224;\273\005\373\372\272\222\301\253\253\253\305tt9SI9"
+	.ascii	"/\260W\271\214Zg\211\231\225\311\234s5\370Z\016\302\312\305\223"
+	.ascii	"\234e\226Z{\243\273\220\224\264\355\310\274\207{\336v\036\356"
+	.ascii	"\3450\017\013Pc6\217q:"
+	.string	"\274l\263\274\270\322\340g5\315j\242\321\267\250\027\327\026\323\3407M)\335h\357p\213\177kNk\370}\326\343\215\214\305\271\335!D\334#\373r\245\3218Sj3\213!\226\303\3131\327aUi\353G\323\013\317\233\2078\242\213t\3703\206D\335\336\226\326\034\276\026\334\r\035hAV\274\354\002O\321\027\251\212q\272\316|a\225\355-\266\356\360\323\237\337\001y\272\035\301R\236\337y\026\372\034;\202\341\235\263\370\211\355+\231t\305wL\313M\345\335T\305\030M+\314\241I\"4\322\025k\212\325\244\250V\323\213MPx\217L\361\237\367\215i\225\235]+LPD0^6~q\305\330\330,[\272o}1\306-S\334\363\030\227t\243\315\273\307\335?\303{\344\305\275\2563;\334\240K\030\351\342e\343\336\323\034\r\344C$\006M\b\331&B\240Sd\274i\023\f\212\214\300\"\343\357gX\202X\354\351"
+	.ascii	"\344C$\006M\b}\304aQP\203\317\0171hd\207\202A\306b\211u\370!"
+	.ascii	"\"Q\261g\210\350\023D\364c\244@b\b\024L\3413\016\235\300>\304"
+	.ascii	"!\020\211 a\256\205\f\206@B\240\2170X\302\3503D\034\002\211\303"
+	.ascii	"`\020Ph\024\0022\030\320\305\023>F\340P\261h\004\336\247\031"
+	.ascii	"W\265.\215\354,\t+\361\020\334\005\337\371\303\356\361\350H\202"
+	.ascii	".GI\330\246\347H\240\344h\311\235\377\213/\031;\334\240MWoP'"
+	.ascii	"\215\316\365a\034|q\337%\n9\252\270\263\246#{\330\246?%\270\272"
+	.ascii	"\363\235wW\260p\217\3544Ka\244\376a\034\335\017\367\275\301>"
+	.ascii	"\fV.\254\334\340\276H16\270\373\302E\332rs\324\006\003\260r\001"
+	.ascii	"v\214\253\301\335\031~F\203\316\310\326\331\324\203\253u\263"
+	.ascii	"8\334\206\365\006\r\256\t\006\302\333\315p\350\003\271\332\036"
+	.ascii	">\334#\205\326\253G\212I\n\200\233\250a8\344\220R\310\310\214"
+	.ascii	"\210\310H\222\244\r\220\002\021\"\254:\021`9\204P\222\324\250"
+	.ascii	"\321\030\"\307\353\025"
+	.string	"\366\333\320(1>\365^\232\362\016\254\334\323\253|\te\220QWm\237\200+\232\002\261\r\036W\345t!\302s:m_Bg\020\3531\tu\322\016\214,X\216\212\332\315\\$\251Y7\206U\016F\245\245T8$[~\272\r\003K,P\241\3726\313\211E8S\344X\223v\265\237\001lB2`\247\304\243P\270J\363\351\335\336\363\3567\347v\304\206;\307\274\312`\201\215\025\t\226\023\230\036\246\357\367\240\003\031\3567\236\305\373+*\237B\201\351(+e\300\302MxLb\2116(\307\320\377\332eK\2231rC\376\275\342\257@\302\361\266<BIoF\211Q\023\f\301\373c|\247^\277\216!I\206iA\306\216$hd\213\364SCg$J}\214\373\337\027\200\203\030\205\323>\031\257\235\252\f(\273`\362\206|kgm P-\310T\022\231\247_\243%0\212<D\032\356\244\323\310\226\330]\355"
+	.ascii	"\332\025\265O\223\177)Ld\311\216\304\356U\372\304\300\347\007"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.part.0.538.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`x\t\2750"
+	.ascii	"jR`\022G`^R\007scw\236\267J\361)\024G\341\214v\027\017\2011h"
+	.ascii	" \257\240\364\030\036\016\235\337\001\263Z\031\333\206\241\276"
+	.ascii	"\322@\235L\246\244H\023\313\366w\340\013\266\330\250\362\216"
+	.ascii	"e\271\347\362V\030\245\355\266\273\211L)\005\013\001\006\001"
+	.ascii	"\016\001\355k\220nN4\2752g\234\022rN7E\254\374\255\177eN9v\355"
+	.ascii	"L\334\255=\n\224+\177R\325-\3264\177}5q'\256?\251\342a\342\310"
+	.ascii	"<1^\030R\352\022\260\256\362\274\377\254\256\304\312\335z-s\216"
+	.ascii	")\262\266+\271jok\340\222+\237\262h\231d\005\\\355\377n_s6\327"
+	.ascii	"\247,\274'g\263(Ur\236\036p\265\t\260\256\366\324\207\253\253"
+	.ascii	"\254\377\254\256\002]u$\335}\325M\347Si\376j\267\233\016\347"
+	.ascii	"*\231l\205\261\266\305\304.\347Lt\025G\335u\241N\020\370\363"
+	.ascii	"\261\275U\345\341\337q\333{Lm\356{B\231.\324\t\222\361Z\265\257"
+	.ascii	"\032\017\264\341?\017\3635f\244\366E\343}Fl\217I\007\230\230"
+	.ascii	"\367\302|\205m\375\372O\250\fW\177P\031\316\023B\265xm\316\031"
+	.ascii	"\bm>\346\021\250\263\322F\b}yC/ O\217\342\317\005\315\372\367"
+	.ascii	"\361\235\036S\316\271\035\353\2067\217ww"
+	.string	"]\267'u\263\036\002dp\357\225\254\277S\305P(jb\337*\243RW4\255\263()\"\345U\255\2175\204Qas#\323|8q\025.\260\257\210\fD]Q2\354.\205SW\005\343\263\356>\261b\254t+\323|8-\364\335\034<\274?1&\352\212\216\305eaf;~\374Z\266\346`\375]\003\375{kY\273C\210x\177:n\352\212\212\365\274\277y\227\021B\322\234_\177\026\331\227C\222\361\370\376l\261\256\350\214\270&f>>k\274\343\274\214\315\272\177\337C\277o\241\365;(\370=\364}\003\001\277\177\200\337>\277\357\036\3377\317\357{g\375\026\006\277u|\337A\3407\020\370\375\373}\373|\337\354\372\335c\277\327\365[e\277y\275o\374\353\267#8z\036\325\310\331\353.N\306\241^As(\376_V\232\212)\253\205\026V\016\005icuI\354rsZ\240\273\255\232jh*\005k"
+	.ascii	"\227f\216]\316S\242\253\276\304\331\0160\036\354\241=\330\277"
+	.ascii	"\220y/\027\315\235\314}\327\277x\027\002x\260Q\316\351\346\237"
+	.ascii	"\025\206~\305\213o\313\215A$\235\301\276\376\004\216\375\346"
+	.ascii	"\b\"\237b\371\2343\263\347\236\255;X)\366\371n\007\003\345\234"
+	.ascii	"k\214\254\031\275P\216;6\234#c_\327\221tC\0133\033\350\013\270"
+	.ascii	"\020\007\243kqF\257\203\333\355\220n\216"
+	.string	"v\037\355.\332\352\252\016\366)\\4\200\230\305A\354\257\020\326\333\313\372\303@\f`\312\253\346\303?\354[s\312\234\215{\306\272\032_\343F{\207\333\343{\254\256\372\260o\331\321\355\376\3604.\2323\221\346\334\\p\306\353\3344\244\271\234\233\f\350\034\215\033\204\347>\\mw\310\323\325v\227\310\352\352\221\253,&\341\346Dcd\r\353\357\314\270F\206R\027\t\373:\027\200\256(\222\325\350U\334\303\376\346s.[\321\334\003\366u,\b\022\336\237\335\276\230\331+\356\371\030\177\274b\177\217\360\260\212\2757\347I\353c\036v\263\264\255\364T\244\212*B\261k+!\221Rj\017p:*\246H*\225\236\212TQE\250\001\276V\222ZR\025\007\364\272]a\302\t\251u\200DJ-\251\214\311\366\230\"\2714>h\217\210\246\254\226\255\362\270|J\"\333%\325TTS{\024\324(\240\234\220\226\234\220\330\266\360"
+	.string	"\003\205&\016m\006\f\277n\035\034\227Ee\213lAlh\235\216K\343qy\214\320\036\005\350\r\022:Xh\232\320k\023K*\224\304\022S?(.\034\241\212\312\t*6\224HQ\f\036\243\222ONP\306^\033\227\222OF\342\321XD*\217\313\250$1*Y\204\"\032\225(\210K\001Zj\352\250$.\245\244\224D\240\36326k\363\236.\036bqX8K\030u\331\212\244\177C\216\216\231\253U\264\305\276\037\366\246G\233\023.\301!\354:\234\237\003\307\020\026\3129\345\274\201\323\362J\003\332p\271\\\260\357\203\251\3711]h\354i\b\305\t\302\376\366a\256\027\224}\235\316@\020\016F\301\f?\f\1770\017\006\3626\356\203\1770"
+	.ascii	"6\257Z\017\366\301\036\200\271\250\2010\304\034TdD&\030\221$"
+	.ascii	"I\322\001\220\002\221\261\232\252\003\022`\205A\211\231D4\246"
+	.ascii	"\206\375\3773\332\013\245.L\253\227{j\356\350\2553)x\277\343"
+	.ascii	"?\352 \345TT\314\020\321\220p\344no\351\205\034[!\240\321\263"
+	.ascii	",l\245h\357C\334z\034a\320\340D\024 L\00730\206\004\236m\350"
+	.ascii	"@\001\320\022z\250>\005\252\314\3219\372\312@\r\373!\220\022"
+	.ascii	"\200j$o|eQ\216k\035_mV#A|\002e\222\314RT\272\303iZ\217\252\365"
+	.ascii	"n\311h\343>\277\274\246k\0238.5\027\374T\352\256XL\316\243\007"
+	.ascii	"\275\005\337\027\221\213j\304p\257\002\370J\006*^\013K\325\210"
+	.ascii	".-\250\307:T\026\224\023`\237\tt4\265\231\360\315\213\341\371"
+	.ascii	"dGQ\256>\335\243\201w\232\f\357\026Kl\346\254/\207\350\r\317"
+	.ascii	"\360\026f\274\222-*f\236{\005\330\276\324ja\366r\347\336\272"
+	.ascii	"\312#\034\362#\r&j\377H\330G\337\240R7mX\214S\016<\236\320\367"
+	.ascii	"\340\276\355\3526\177\243\355\024\013\276\232\266?\240\211G\375"
+	.ascii	"^\322B\005\202\341\364{\263\267\001Z\351\206\353\035\201\025"
+	.ascii	"\252)\352\301\226\244\013n-=\312\224\252\2227\326}\327/p\247"
+	.ascii	"\rs\0370\360#(\241z~&t\013\035\367\221Q\016\374\320w\027\323"
+	.ascii	"/\370\035x\340I\nNI\036k]v\243\330\370\245\001"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.539.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\b\001M\r"
+	.string	"\346\027YF\360\2208\035\360\\\f\305,Z\016h\361\244\213-:\227H\317\254\031\027u\265\361\231\311\033KP\235\023\204\2408=\237\240\200\217R\322l\271\234L\302\231\332\322D\333\037-\002\214m\315ar\232\220^\247\350w\333;\245@"
+	.string	"D"
+	.string	"G"
+	.ascii	"\343\005hN\261\007\320\234f\247ga\033\264e>\246\254\211C[f\300"
+	.ascii	"\310"
+	.string	"\212\017Z3@\260\360\330\335\355t\242x\370)\257\320\027??NH\\\002\370\265\351\354\256\261\0227\275m\006\266G\366A\002.\340[B\\?\214{br\025\337%\306Y\302\267\204|G\354C\244h\265v\354n\003\354\264^\367U@\377\205\263\025\360\243H\025M$8\265\224\366[\334E\370Q\344\234]V\f\215\335Q\301\251\021`\247\016\036\346D\261\215Iz\337\320<\34626\024H\331%y\211\n#qp\200\003\210|\211\017sN\216\0255p\214LQN\024\317\353\327N\226=\245\016\b3\273\"z\314\354\tjC\305_\376\225K\373\376\313a\3700\316\002\306P2\240i\013.\324O\250z$\200*\214,\204\252g\002\350\023\022Q\250\236Q\004Q\365\336\241<S\351\304m\314i\236\211\333:\216\224\341\353V(oCy\244\323\306}\252M#\340\224\206\356\333V\251\324\267e\266\345'\313\235\0163\034"
+	.ascii	"8g\340\256\326+\271w\b\013\020\005\303\\\341^\263\202,\025\002"
+	.ascii	"\251\363\245,\270\254.\314\004Y\005\323*\024\216U\321M\205\305"
+	.ascii	"|\n\004!\3363JQ\347\002\323\235\006\200k\017\270\321\"\372]e"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.543.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\003\001\035\r"
+	.string	"\226\227WF\360\2208\035\360\\\f\305,Z\036\2564\253k\354N\236\037g#\316\333\272\332\370\314\344\326%\250\316\tB\220\205_o^\300G)i\266\\\256%\"\367rrs\270\022\006\362\310:\313@zE\243B\375\277\333\336)\005>"
+	.string	"B"
+	.string	"F"
+	.string	"\027\200y\305\036"
+	.string	"\363\232\275\236\304\266h\273\274\024Y\020\217\266\313\200\216%\033\264\214x@\261\261\273\334+5\361\361t^\243O\236r\260D|\002\370\225\351\354\256\261\021w\275\355\005\266;\373\251OQY\353P.\013\344%\276\n\213\243\214OQ}C\354?\214\264\220\324\330]\016\366\252]\367KD_\205\263\023\361\345J#I x\365\234\366M\236b|\271\272f\267e\362b\267L\360\352\003\330\253\313!\266\2619\357\030\230\267\270\213\f\004Dv=\376q\302<\030\030\320\220\232\377\360Y\256\231\201\202%\243\203\222\223\206\230^\277\226\266l:ip^vA\334x\331\022\025\306\211\257\374'\237\366\375\225\257\360Y\234\251\210\001\266 *\260m\n*h\237N\3638"
+	.string	"I\230@\241\323<\017@\237.\002\204\r\370\257\004\216D$/co\003G\036\367y\241\013\341\207*\201\\\t\f\2218/<q\333\306&\f_\310\241L\246\220\313l\317\323\226;\033(\007J\003\034"
+	.ascii	"8g\340\256\326+\271w\b\013\020\005\303\\\341^\263\202,\025\002"
+	.ascii	"\251\363\245,\270\254.\314\004Y\005\323*\024\216U\321M\205\305"
+	.ascii	"|\n\004!\3363JQ\347\002\323\235\006\200k\017\270\321\"\372]e"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.563.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"e\013"
+	.string	"\006\324KC\020\251j:"
+	.string	"w\230\335\362#\364\242l\256\210\021X\274\020o\202\271Bp\277\177'p]\313\375EW\243Q^\214\245\3553\211a\007\204!\002\200\002\250\261\030\314\347\2747\220B\217\363,\026:Po\332$\2454"
+	.string	";"
+	.string	"9"
+	.string	"\006l\223\266\354\347\200=qi\3136#k~`,$\257\331\356v\257T\300\313Sm+}\363t\001E\345Z\303\267\013hw\215Y\271\353mS\330\266\260\217\021\034\223a7\325\262\200j\366\317+(\317:m\316M\321D\2109\230xu\305\371\007\356\025s\007\356\365+g^=\237\362\b>8\346\271(\216@\f\302\201\331\356)\361\352\b\314\353\003'\316\346\360\320^\342\277~\223\007\r\316\t\022D\250\251Q\225\351\366mi\312\246\025\266\322"
+	.string	"\330EU\240\260\001*\203\002w\375\255\333O@\372\256\277\234\261=\037\262E\236u\n_\b\2162H\336\245\244\001\212B\361\342\353\b\2252\366:\340\310\353>/$\032?S\bv!\030\"u\336X\352:\020\0267\276\2613\211\342\330i\247)\203@h\210)\245*\333\234\346\007\030"
+	.string	"\f\023\004\316\031\3705\021\302x\200(\030\346\ng\307\006\356D(6\202\241\203@\017\354\372\210\004\303\311@\353\255\233\220\260\nZ\211\003Bw\006"
+	.ascii	"\356>\220\243\245\351'\2241"
+	.text
+	.section	.gnu.lto_dumpVersion.part.0.568.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"%\f"
+	.string	"\306UQA M5\035\004A8\250\250\211\244{\231fg\367O\020!\306\333\264^\332\002\0250\326\361\246\223y\225\354\312\301b\350bVw\003\302\201\341\020,J\n\307\022\002oH\247\271\346\327\252nZw\333[\246;"
+	.string	">"
+	.string	"C"
+	.string	"\035\376o\376\026\217\245\266p\361o\315V\265\310\302t\242"
+	.string	"\"EwkL\347\006\026y\312K<\363\310\030\237\020\207gF\350\002\313\016\276.\026t\3671\f|\312\377%\377/?+\b\223\364y\361\325S\303O\031\230Pl\214\272+\254P\321\031(\t\016\234\342\237O\233\363\370G\352\021\311\206Q\232Lt\200\351\247\374#\022\221Q\232\317\356\221\bU\367\210\200\351\r`L\037L9\002\376e*\250\335\357\003\265\307\177\311 \326\211\225\204\331\231\223\364_C\376\265bb\325\t\321\001\260`\036\007\230\022\230d\017\374\341\301\200R\267\207?\026\363$ \300\364\017#H\376<"
+	.string	"\2105b5ard\257\0206\373y\231\345\270\255x\335\275\325f\367\022n\224:\311\276\233y_w70\254t\024\357\343\262[m\005\013X\354\326 \203\t'\3309Hw\341\264\312m\024\260^\257\323\274n\303h\034h5H\032"
+	.string	"_\315\0340,\261\260>\013\346\r$\201<"
+	.ascii	"\031`\b\334\003\304\232\324%\200<0\302\025#\322D\323\003\t!\016"
+	.ascii	"\304\305\316xE\335\240\323\224\247\201\340\332\213)\247\345\364"
+	.ascii	"k\313\030"
+	.text
+	.section	.gnu.lto_cliAux.part.0.570.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\365\016\255F"
+	.string	"\332v\210\032DP^R\007\354o[\231p\244\275#o\240{"
+	.string	"!\032tk\2309q$Cq#C;"
+	.ascii	"\301\210\363\004%\031\271\203\234\001\207-\2000\200\006\020O"
+	.ascii	"!\300\331\372x\327?j\235\253\252\"\334\322\266\275\267\224)\005"
+	.ascii	"\210\001\202\001\232\001\356O\346\313\270\303>\343\3078\001:"
+	.ascii	"r{oxF\353\257\345\206"
+	.string	"?\227\017\363p\016\277\211\021\343qI\341\336c`e*\004\337\005s\303\223Z\324\r}\356\275\273\274\227\370\277x\334o\257\3759\360\326\304\340\355\275'\004\337M\266\177|\177K\265Fn\252\326\020\332u\373\241H\326\336\360\366\2466\275\353\020\202\357\302\236\363So|\233\215#\352\366zz\316\356\277\366l\361\267\331\370\241\275\221`)\2637\265\301\273\316\024|\327\251\217|\337\r\376\361}\327\375\263\270\373\r\367<O5\333O\217\335\363\034mmf\20450\\\\\256{o\345\273Z\311\307oT\204$:\032\207\204\202\200\212Dx(\f\002_\267\325\371(\366\027:\241\3147*\202\373\2441/(\217$j\223n\254\\_\367<k\013 \221\362\375\364\351$\037\215M\246O&y\b\210a\314\353\354\205Z\246\272\347\222\026\031\207\354\216Y\016\222>\220t\372\214\346\242\234O\252{J\213d\242\330\303\255R\034\262;"
+	.string	"\242o\200\374\364\031\226\207bI\323'\221,L\032\363\002\373`r\357\375\323\347W\006~\335\023\214+\277\331\t\025\362n{\004{\233\003\004m\266\f\346L!\002C\267r\333\016\260\203S\345\255\237}@\233\255\001\261#b\236\215V\326-\262\353\211\363\353\236OZ&<3z\017\367y\0074+g\343\037\0011\354\275\375\261\256\274#\275\373O\335\035\352^L\022zyQ\265\274w\363z\252\336-wN\032\237G\304K\207\302\235\3073\302\337\311\273N\302D~\247\t\375n\376\204W\364\256\312^\030!X9\353\372\363\232\255\256(Z\227\371\361=\356\325Z\273\351\351\251\316i\345?n\314\257\335Q\244\310\357\324:\251\245\231\376\340_g\r$\303\263\246I%+g\263.s}\364:\233\315f]#q'fo0\314\316"
+	.ascii	"\316\3364\314\3164\314\276`\230]\001\234}i\230=\3010\273\322"
+	.ascii	"0;\0028\373\201\240\354\006\210\331\223\340\354I8{\0018;\001"
+	.ascii	"b\366\001pv\001\001\206\331"
+	.string	"\001 \035\301\331\215\340\354E\305\354H\242\243\021(\373\020\234]\b\316\036\004g\007*f/\022ab\366!\234]\370t\357\301av\340\203y\177]`\366\366\337\336\365oy\317O\375\177\016m\033\\Pt\357\256\254\3376\342\236\201\362o\377`\376\267\374\313\375\307\375\323\375\333\375\235\324\f\227\";0\307\253\332\375E5\363\002\222\335\371\242v\335Z\324\246+\257\3229\266\260\312\226\262\3604\341\\\367\246*\337\025\272\277\177\235\034;\fY9:\264\205E\231\3736\376V\207\351\340P\301\241\202^\327\352\210@s\346\335\\}\033W\232\355\275\321\374\030\1775\317\306a\2715Uk\252\274\254ko@\3049\004\t7>\315\322\237\020$\304\237f\231dRw\027L\206\347N\355\272w\031\013A-\356\360Ud\322\276\006,\311b~yaD\3329\001z@\376\352 @\177\024\351\030 ]\246\367\001\264\353\346\327\007@"
+	.string	"\"+\026-\357\2214\200#$\375r\336x\305V)\036\3219\036\351,\207\225B4*\322FE\372\243\322.|_\310&\371G|\006d\372E\361\202\036\263\256t\234|\352\322\374\240\301P/\222H#u\021\331\225\356H\244\363\025\033dx\324.\323O\211\361\250q<\025\344o\363jb)\301!\rO\211\253\344w\032u\262\251\231\356\331\371\204t\217\321\262\2168\255\350\266\347\347\346\340\032\322C;=Y\247PH\177\334c?H\013\351oF\263\342>H\1774\212M\373\002\312\222\267\226@\346\336\235\254\365'g\275\223\017Q\003\351\242\252\036:.\254_s|\211\t\3522/>\324[\324?\255\316\021uQ\007U\365\254\341\302b\301D\235\257}}\360\236R\204"
+	.ascii	"u\031\237\207\265\313\334\263sa\375l\336(\327Gg\325\322\314W"
+	.ascii	"\227\035\355\362\320\031j\367x\355\377\3426 s\317ITm\357=\301"
+	.ascii	"O\304\213\024G\257\nE\355\317\367U\3019\371\b\365P?\027\326="
+	.ascii	"\303_5\004\367\326\232\340\2777\265A\250_,\352\207\217\r+g\367"
+	.ascii	"\224N\211K\365\006\265\353\266\327D@\006jw\017\037\362;\203D"
+	.ascii	"\326>4\237}5P{\346\3722f\367\325o}\343\265\317\214\376G\263B"
+	.ascii	"\004\255\255\361\272\332e\352e\253v\220r\326\356 B\344w\272:"
+	.ascii	"\313\365\255Y\375\227/\233W2\023N\003j\305T\324\353WJI\032WN"
+	.ascii	"H\356\302\301\022j\005\225T\212'+\345\023\013$\032T*\364\223"
+	.ascii	"\223\224\2161uE\245!\306\024"
+	.string	"\224\324U\013\253\f+\242^8\3110F\375\013'\031\332*\006\f\r5\025\365b\205\324\023\320\237\034D\275xRB=9\261\260\202\2121\025\245\234\212r\222R>Y-\225\016\0028\025\f(+e\f**+%\374\032\211\007\263aV,\235\345\372\333\275\3676\252\220\337\3167\375\217\311c\342\036Kw]\301\346\357\200\306?\036\356\207\356\262A\336\354\017^\231\242e\273\367\330\205\217\373\307\323\222\263.!'i\003:\201f\322\ft\003\255\365\267\311a\342!\004\314\366n\2763\006\0136\253\226\342\260\270\310\200\256<b;L3\327\262\227\273.\\\032\244\2615i\006\\\330\352\322u\373\273\023U\323\342\326\244KH\347\370\330\260\260\374\002\315\224\323^\201^\260\244\025Hs\033\033\336\232\332R\032PKI'\320@\262>/\315(\022\002\255\244\365\\sz@#\210\217\344+\313\245;\2648M\310\374\313\263R\345"
+	.string	"\034\276)\327\251\024\003\272"
+	.ascii	"\035\030\033\024\277'gI\272\204\224\216\217M\n\322A\026zw\363"
+	.ascii	"6}[\026+\311\357\364\374\005;gmj&\230\255!s\210^\264\252\235"
+	.ascii	" V\356\366\261\355U\022\267\271n\177Q\222\224\341\220\252y\373"
+	.ascii	"#\222ft\335=\177P\352\250`\245\r\3512\217\317\336#\361\231\353"
+	.ascii	"\366gfD\372\224\306]\311\363<3<\364\204\332_\276I\375c\325:Z"
+	.ascii	"\371O\322\375\222\246\341\013*@@\027 \020\2010\250q<\345\020"
+	.string	"B\250fDD\222$)t\241\005\2040\005\341\235\003\021 -T\320\310\214\220\024\326\310\260g\2354Y\fskZ]\232\024\375\302~\300\311\006&R\033\036\247fF\370\370(\254U\235\"6\217\353\0233y\251\222\017\301\267\204G\335\334\236\244\371\240\302\251\016X\247\217`\b\362;H\"\303\211/%\013\001uv\325!e\326QU\340SMX\021\330\207\r\315\305SI\255\002\375\366\313e\234\371~\217z\213\037\3634\306T\244\225\306H\355\301\002B\273|o\322\016\332mI\221Q\"O\273K\3527\206\343\300&\300>\325\"(\177>\202\371}R\032\241\305`s\326\211\371\354F\266\020\263HE\363\030\370\273a2cO\301\243\304\317\360/^\204q\306\361E\343a\027\2646^\277\346[\220G/C\221\350@\312X\204]\356~\366\205_\325$H\271\257\364\"6\377\347\230\361\324\200e:\005\210q]\265\223\251"
+	.ascii	"\t\217\032\275\304/\215\204~\277\200\022\025m\005\260\224\370"
+	.ascii	"!z\020\025\334 "
+	.string	"&\323\277\357^\255\246\030\001o\212\017\036\362q3\302\213=\027#\307\304\021^\257L\220\031\271\364\257\023\271j\315m~X\025\371\275\021u;8\202\365e7\313\372\216\351\220\312\231\342\274\t'\223S-l\243\312\001>#\304\262 \311)\317_\313-\317h\017\323\220\311\307\354*\342\313\026N\251\034\363J~eL\366\372\264\253\220\024\003\306\360\211\201GY\177~\306\245(\224\035\035\371Ic\221,\364\030j!\212(m\032\023 \301\216\332\214\fk\245\235R\325\356[`\301\264\201i_\036\013=\301'\266t\372\374?"
+	.string	"\036~`\250T\263\234L\221`n}7;~\350\026N\203\224\027\247\002e\370q\3232\310\332\272'\246\210\253\333"
+	.string	"4,\243f\020\0272u\246\2724"
+	.ascii	"1\241\372\345;?.\n-O\316\225\260\306\270\"a\221\356\324\255\365"
+	.ascii	"\2352*\210\013\233\251\344\225F\357|\315tLB\203$\235\367r0\233"
+	.ascii	"*\313\354\301\233f~\265f\3126\217\n"
+	.text
+	.section	.gnu.lto_cliDumpResume.part.0.573.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\267\003\315\032"
+	.string	"Fp\255F\240\\Qc\240I:\2565\024gp\300\274\326=\306\0222\255|\240X3\345"
+	.string	"zX\251\004\242\364|\2226_IV\263\224m\272\232K\2238P\"d\367\331B\214\027\306"
+	.string	"I\234y,\335\311F\310\336[n)S\n\223"
+	.string	"\235"
+	.string	"\225"
+	.string	"\367\006wn\375\300\274\315\271\001\362v<\001\362\266u{%\266o\366\231\007\201\227\347 \373L\275V\256\rR\211\314\220\023\361\336\353\272\255>li\320WfI\332\261RV\220\317\352\235_-\360\305@\2729>\030^Qs1<\244\321\200\321\220\335\217\360\216h\331\352\345(\031\2407t\246S\030\275\027\324\342\030\221\361q\254\3604\303(@O7R RS\255\336\020\255g\272Y&\251\210f\327\223q:\340\254\362\302\275\327\307\325\270[\267m\304v\007\273\n\t\324\326\244\036K\352ZR\323\027\320\0016ps\257Q\321\315\315a\261\020\371\322\253\334\\\033/\024!\\\357\356\374\270\266Ah\364\201\004j\013\361\3269g\020h\304\233\342\b\023nn1\336#\241sJBR\225\225%\304\253\013\356D\230"
+	.string	"\344\026\007\204\316)\bI\\\202K\210\367\006]\267\243}?\312\245\374\354"
+	.string	":\371\261\205e\016G\025\361N\356d\267\f\364&\223M\300)I\356\275-\240\3523\271\371Ln-\335\036t\341\034]\360\366xM\256\024\364\240\013\034\\\216+`\306\013%6\303\"\314{/\005?\313\265\214\360\203\334\232D\t\372]\t\362\326\326\013?\016\221\314"
+	.string	"o0iR?\336{\257\255\277(czh\031\205\257\221c=\323u\226\236|'U\324\027\035m\343Z\307z \315P\025\216\026\375Jk\255\227r\235!B\250\b\237\024\311\321\"\255\n\212|=\023\b\210\212o\352k\227\032O\324\324\372\263\215C\355\236\027\375\316\226\250\270\006"
+	.ascii	"\265Q\304\350w\257P\210\212T`r\365\244\365\347\312:\005\032P"
+	.ascii	"?\\y\330+j\263\244.Y\324\344*N\301\003\223\305l.\237\231L6{!"
+	.ascii	"\200\311b!l\264\036[m\345\027Ol\305\313\005{\365\234\240\301"
+	.ascii	"l>1\227O\254G\346z\321j.\236\004\236\261\200\321\\\266\331\214"
+	.ascii	"\346j\331\246\257<|\001Ws@V\030\212|I\002\206QC\263\376\240n"
+	.ascii	"\352\234O=N\252()'\203\270\2300f\275S\206\"\237\215\322\3025"
+	.ascii	"\220e\245\276\246/\t(Ym\016\035\350we\315\321\325\323~\227{Q"
+	.ascii	"\341\007\261\207\017\037\310[\2622\220:\302\321\242\031\035E"
+	.ascii	"\210d\375Y\004i\035\234U\212:\250\242\310\\h\020\337\022J\250"
+	.ascii	"q,\003\025#\006\231!\021\tF$R\007`\002\221cW\017\020X\212H\222"
+	.ascii	"t\227\244\356\274\312\275\267\316\352\031\224w\016\t2z\001\376"
+	.ascii	"\3468\247\361\371J\022\222Q-8\244\346f7\255RAo\317\200\025\245"
+	.ascii	"5}\315\370\203_Z\260\016\250\335\254\024g\016G\372\3741})\017"
+	.ascii	"#\025\372\356\272\372\037f\372eW\214\246\037\242\355\307\301"
+	.ascii	"\333I\364\270^\261\343\356\214\224\356YA\373\2037~\304;\001~"
+	.ascii	"\335\017\320\005\374*!\247,\363\240\034\224e\362_\2270\254\034"
+	.ascii	"\303\210\363X\003\251\302\300\204\362\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`Q?\355\321"
+	.string	"\nsyKZ`\312\244\234t\252\360\315\377M\034Ck\306\214\376\024\374\257\2126\326\200\303Q\345\270p\241\277b\023\270\340z(1w\214w\234@\344dI@\375[[\367\017J\331\264\340/\322\206\277H\330\360\327\321\006\377|\342G\025"
+	.string	"\253\221E\347]\340v\027\246\332\324\370W\246m?\311\264\003\241\004\272\004\222\004u\237\364\324\205\302SWn\247\356\\\210\272S@\324W\321\251\027\313\251\337A\326\363\300\251\327\031\353\262\335\324m[\261\251k\244J\335#T\352\026\231R\027\211\224\372\036Q\352\313\346\352\275\344\352q@\251\277\361\244\236F\\\275\351\244\236\253I\375\f&\3650\340\352_,\251\307z\253\217\241\244>+I\275\217[=\020\222\372\237#\365\035\030\251_\321V\337\305Vo\243H=\323Z}\023\221z\243b}\210!\365Gg=\222Z\275RZ=\t!\365%\320\352\201A\352\177"
+	.ascii	"\251\027\236\325\237\370Q\317\343\243>\307\254^\253G\275\210"
+	.ascii	"\262\272_duw\214\325\035\343Q\227lG\3352\261\272=\302\352\232"
+	.ascii	"\201\325\375\361U?\246\243\036E\216\372\0248\352\235n\324\243"
+	.ascii	"y\325\013\261QW\214XO\326U\3775\254\317!\254\177\252Q\017e\326"
+	.ascii	"G\321\250W1\243\336\204\214\372%\256\272k[\365DZ\365AYuy\304"
+	.ascii	"\250\007\201U7\b\214\272h/\352\n\271\252\013\304E\335\263\026"
+	.ascii	"u}X\325\r3\320Y\324\005s\325\217\352\344\212\343L}\224\372\215"
+	.ascii	"N\305m\242\352\352\020R\017g4o\351\240\352\346\340\345\340\274"
+	.ascii	"\370S]\034<$\212\345\235\352>\255\221\247\250\233\002E\335\362"
+	.ascii	"D5\221\007\253\213\230\250n[\240\030eu\221&q\003\346\274\251"
+	.ascii	"\256P\002#\037Pg\252+[K\325M\200u%F\211\272T$\352\n\f\245\272"
+	.ascii	"MIu\305j\221VKG)\335\035\325\255\261F?uEui\020\325\005~\250\256"
+	.ascii	",\t\3255?\242\356RP]Q\002\252\273\242\203\272\222\364S]E\202"
+	.ascii	"\373\324\025\241\025Q\035E\202\367\324\025\240\345\331*;+%\304"
+	.ascii	"F\001\261q:\326\361\234u\242\373\214\223\316q\234\007\272\217"
+	.ascii	"u\241d\344\310\375\246\256\210\333\324\305\331\261\037\321\225"
+	.ascii	"}GW\245n\013\r_:kK\245\3568e\335t'VJ]\251\tO\216\3206J]\025V"
+	.ascii	"&\310v\256\256\222\\]\235\205R\027\304N\300\324\344g\237TO\331"
+	.ascii	"\270\313\320\340\303\243k\235\324%\321\244n\022\223_\351\334"
+	.ascii	"F\364\340X\270\272%\226\"yz1\264K\352\356\274\031\207\356\202"
+	.ascii	"$U3VI\365\022\254$\325H\366\024k\262Z\267\272?K\024\302\026\264"
+	.ascii	"H\252\343\226R\2726a6\224R\250b\256\372$\223A\221\t\355\221j"
+	.ascii	"(\013\201\017\013\2545R\367\246\255\372\b\022[5\332:\306}\030"
+	.ascii	"\306\327\212\324\205\001\301\n\032i\273V\315\004\213H5\334Z="
+	.ascii	"\211\316\305k\024mC\267C>\334\363njuY\2109\331I\332\264j),\036"
+	.ascii	"\254z\021!u_,\332K\252\rR\355d\305\251tR\037\002\244n\026\321"
+	.ascii	"7tg\325oP?s:\221\037u\261$\360Q=gV-\207\342S\272\340\213=\352"
+	.ascii	"\306X\263B\n\333"
+	.string	"\262j*&\336\243k:\022\262\272V\273\023!cg\307\352\332\354\322\215\350\200o\323\361\250\353b\207\275tbu{J\334JG\342lau\257\206_\2423\265`u}\222\276\365U7g\215t%:\352V\345\250K\342\250\366\261H7\252\317\026)\307\032p\275\252\331\326F]\236%n\261k\207\f\367\024\256Z\215\272SHfu\020\032ug\314\250^\223\2616\\\332\264`,W]/\031\037\023h\267\352F\355\317\026\351,b\211t\224\322\035\303b\320\256/\247\024\253U\327(\213E\027\243\356\321b\325\025Z\030\026\276p\r\335U]&\027\325e-\252\311\326\252zL\002\026\365N\f\302\\U\226\241\243\252{cE]\342T\335.\017-\021\235\324n\251\250;\254\262Qu\201\240\252w<\325EZ\247\272#R8K\207\242n\320\236\250\026\013V\203\231\360\214\362`M\017\3231U\207\355R\365\227\265\252\237"
+	.ascii	"\353\242\330\022uO\220X\023J\037\221t!\035\322\213t\364\210\b"
+	.ascii	"\237=\252\033\354\321@c[\243\272!\026\212\207P\210-\252N2s\236"
+	.ascii	"A-Q\265\333RJ%\260C\233\246\303\362\211\035mT+T-\004iD5\220\240"
+	.ascii	"j3\240\272C\333A\265I\032\373c\242.\311\372T\363\020a\255\236"
+	.ascii	"\352\037a08P\335cy\252\207\354\230F\210j\265=\245&g,\b\233:\235"
+	.ascii	"\3523\247\256\323\333\222u;X\261\261\261\261Y\234j%\032\234\346"
+	.ascii	"\244\354X\235\266\224\322\235\3158\002aQZ)\375\002\362\253T\251"
+	.ascii	"\"\2677\225\032YJ)\004\"\020d\013\311\"\344\t\035\023\005V\306"
+	.ascii	"#7\307:\337\005\213\246gA-\230|f\235;mI\353\274\306\021\334\374"
+	.ascii	"`a\322:\257`\235{\030\r!\211\017\rs\316cN\257\034U5\371\235>"
+	.ascii	"\034\230\334\313h]1\353\215G:\347\273\323\033\244\304\313\244"
+	.ascii	"s^c\336\234\221\016Ms\316+8\3078&g\214s\223\306y\215q\336\301"
+	.ascii	"8\306\241b\033\333<\003\277H\030W\023\245B\253\\\306\364\256"
+	.ascii	"Y!\211\3210J\345\277`\3217\3322\304\264DP\260\342.8\205R1\363"
+	.ascii	"\034\245\362\226\361\t\205r\026\336\t\345;\023\214B\201r\337"
+	.ascii	"I\303\202>\262(\364\247x\342\326z%\005+\n\203/\244W\n\004\017"
+	.ascii	"#K\241O\340h\223&\227`z\251\342\330\2104\214\302\375\345\244"
+	.ascii	"`\024\316D\316\220.\317Q\270w\360\211?rb\216B\341\334\250\022"
+	.ascii	"%\207\031}go\f\243ng9)\030u\273\203\236\243nl\324\3103\320@\215"
+	.ascii	"<\003?\315\306\346\206\262\321\266\307\230l\357\231\024\214\262"
+	.ascii	"m\320)\302\207\347([\221\022!\362\227\322G\312\261VE\303h\361"
+	.ascii	"<\223\202\321\342-\264\317n\312\240x\216\026\323\250\232\332"
+	.ascii	"=\234\2465n\300\360A\241\2149\355\022fST|\246\023P\334\201E\303"
+	.ascii	"h\332[F\nF\323n\241'\364\334\300\360\034M;\243A\202\\B\371\033"
+	.ascii	"Mq\030E\341a9\303\350\331y\345\020\005\243ge\324\314\354/'\r"
+	.ascii	"\243e\177\031-\343\242\310\007\005\243e\337\235c\337\tM\223\246"
+	.ascii	"\304\312O\204P\350\230\034\035c\243cT\214\356\240;h\030\025\273"
+	.ascii	"\317\031\241Y\t\201\206\335\244\327\212m)\310>h\330w\343L\321"
+	.ascii	"\314\204\020\264\017\nv\217\246Jh\240\255\265P\260\377F\237\331"
+	.ascii	"3g\350\327[L/\227\22486\037\375z\313h\332\3264t\302\033]\350"
+	.ascii	"\327w%%\322\257W\320A\2446\356\221\022)\221\022)\361<\323\023"
+	.ascii	"\276J0\241C\332\365\3368s\376\350\360/\243occs\3433g\350\360"
+	.ascii	"-\345\217\016\317b\232\303\024\017\320G\207\337\231tx\217\017"
+	.ascii	"\3500\216\016\277+gh\215\357F\227^\236\025Q\220|\264\3063\360"
+	.ascii	"\341\212jx\271\320\032\337\2353\324\274O_\rnk\211\217\232\257"
+	.ascii	"\340\243\346=\220J8\274\246h\252CE\3511\016\247 \364M\"\300)"
+	.ascii	"2\344\204\240\020\2064\315\331\327\227\3078\374\027\364\256p"
+	.ascii	"\272\3417\016\367\025\375\340\304\026\320K8\334\0274\001\206"
+	.ascii	"\266`\030\216\303{E&\034\316b\006\200\303yd\023\016\267\360\214"
+	.ascii	"\303\035t\302\341\036\375rB\352\005\r\207[0\033\207\357F\f\356"
+	.ascii	"b\022\f\376\001\003\r\030\\x\300\003\276+\r\260\341\273#\033"
+	.ascii	"\356\"\222\r7\351\266A\303\006\032\r\032fhh\356\361\202\231\231"
+	.ascii	"w\270\340\036Jo\024\321\rJK\206\327\214\275\f\2470\266d\270\314"
+	.ascii	"i*\245\211Dr\311\360\030\323=)\"G.\031\016\363\013\332\245\324"
+	.ascii	"\322\222\3332\234g\362JS\200\003\224\025A\206\357\212\246U\246"
+	.ascii	"\264\250l"
+	.string	"$\303\221\026\330\013\033\311p\007m\247\271\2670\243e\370\007&\243eP\200\005\t8\317\364\351=#\2470Xp\227\356\021G\034\f\026\274\306\324\0070\216\n\203\005\030,8o\364\016\211\314\202\034\303]\364S\334\034y\342\"\030\336\001\r\303-\370l\030\326*\230\240\202w r\200\013\006\020s\242\326d\265\013\337\221\366\024\0170\315\347\205!\027\212\027\376\201\354\302\005\n\n@\301+H0\301\035L\223\340\026\n\241\360]\320{\304$\3720\232L\0042\347\005}b\217\234 \243E\360\032\373n\314eA\020\301[\212\376\220#\246\r\007\201\340;\322\177\343jB2\020\t\377`'\201Re\313g0\257\340%S\201D.\002\314-\370G\204O\340\234\200i\027\262\022l\276\33758]~\2579\375`\224\201\344\373\235B\351\030\250,1\337\357\277\322\345w\337\370R\262\230\274\321t\211\023\265\240\357\367\017f\276g"
+	.ascii	"\301w\013>|7I\006\341\035z@\270\205e\001p\351\275\2054\231\313"
+	.ascii	"yB\273hE\034\221\307\\\276\013\332D%\224\360\360\230K\313?\214"
+	.ascii	"\261\334%}\360\032\336\203W\320=\340\301\373\007\323\"a\\L\336"
+	.ascii	"\241\273\211\372\267\262~IS=\023\246\372&K\365@\200\365AJ\324"
+	.ascii	"\017\221\250\327\241T\237\226T\257\206TovT\357\302\250\276EQ"
+	.ascii	"=\013\242\372\252\241z)\241\272IF\324U\022T\367\r\250\356\222"
+	.ascii	"\016\352\302\375\324e\342S\267\211\2100h\230E\351\001t`4"
+	.string	"\313\371\345\f\220\030\020\372S\3034\f\220\276@\351i\311\322>\020C\003\r\374\005F3\240F\321\006\243!4\031s\221B\320\256\032\201|f\340e\212\246f2V,i\340cf\f\374\204\323\020D\220IN\233\304\n1\237\201\2071\375\033\226\315\030\370\237\351\r\322\372\225\376\r\313|\006\336W\364\017\003\357\013\366N\340{B\023\006\376%\330r\002\317\"d\031\201\347\t\201\301\2671\313\031x\013\201w\351$\003\337\301l\006\336N\262\322\035f%+=f\264\206/\235\"3N\272\004\323'V\311!\3210'\2757R0'}'\264\231\310\020S\362\234\223\216\0013\270K>\372\005FJ\024.\223\217^\201\222\002\244}7\346\264\266\251h\0179b\332\330\322G\327\300t\004 \322\222\322\003%\372\350\277\322\246\332\261\305\343\363\321{\245\005@E\210\231\317G\1771-\223tb\315\347\243\357\200\026\350\243\357l\232"
+	.string	"C[/h|\364\032\033\371\350\026\214\346\243\263\230\245i\243\263\214\224h#\246\235\024F[\302F\337\025}\"!\2124-\320F\337\23136\272M\177\005O\027\351\263\321+\270\330\350/\344\215\226\263\350,\347\214\213\316R:"
+	.string	"F\236x\371\\t^\351\345\211\032\272\270\350\273\2425\270\351\274\031\315E\337\225\336\241\030>(\321E\357`\007\334\320\3602\233\213\210\224LD\302DDJ&\"R2\021\221\222\211\210\210\316bR\242\207\316\022\364\211\324L\270\355Q\321&R3\201d\221L\343x\310\b\020\310\320\036\025\r\305C\337\t]\201I4\333#\017\271h\037yhmlln6\311C\036\272\314\351\013\224\236\314c\241\313\230\266\020\344M\2464%\246 2i\241\307\220\023L\tB\030\362g\372\212\336pVm\221\205\356+M\221\344\344D\260\320{B\273\211I\312g\026zo$Z\350/\3055\262\320[\204-#\216\205\316B\262Y\350<\323\032l\\\344\210`\241\363Hoh\"\233\013\272\001]]_F\263\320=\332N8Z\320'\026z\006v\200\222\0217k\241K\030\355\242\246$\n\346\364\313\2448\301\220\236"
+	.ascii	"\213h"
+	.string	"\264C\016\272\357\364M(!\224(\\\"\007\2757\232\207\224\002\204y\034t^\321\377!\345\347f'<s\320}\332M&\216\f\r\344\240\2334\0058p\343\222\016z\215\177;jB\223\016z\005\007\235g\032\307@\337\025\275\222\303\204pg\372.\234\340\232l\232v\361\030!A\211\006\372\007{\214\n*l\207\ftf\240\367\310\016\212\013d\276\004\2753\300\244Ll\220\177\336R\032B\223\031W\224\350\237\263\024Y\204>\363\317YJ\343\370\347<r\027\024\362\317\225W\016\221\035\341\237W\360\317'\214\246i\273\221C\211\247\004\241'\240\370\212\222@\032\202\260E\211\025qJ\020\302\220\026@\232\032\216\365)\177\243\004\373\210\240\202c{\202\236\263\317}\244\037\270z\353\331\036\373\274'4\004niE+\302>o9\035\223\242\251\215G\356\217}\276\023&\371\211}n\323\021zr\0041\216}n\301l\3669\205\321"
+	.ascii	"X\342\205e\236S\246\364\356f\270\203\022\335s\t\243/D\251\362"
+	.ascii	"\025\275B\"\006\016\237\351\345A\"{\247\037\330L9Ep\317{\245"
+	.ascii	"\037\266B\207"
+	.string	"I\367\274E\350\007\302\2028\361\017\367\234\305\264/\007,E\004\367|'\364\204'Gi>+\335\343\236\233t\002\264\344\244\226\307=\257\340\036\236O\030\211\336\371\357\264K\2210\351Gze\256\311pCx\347\276\322\004\360*k3\351\235\367\202.@\211'Q/\376\341\235\267\004}\241\207\033\326\356xG\204\223\227\323\356x\347\026\314\346\235oP\322\260\240i\217\233\250,\2479\304)\214\306\320\346\342\205I\207\370\013\271:\016\361\026\241\317\243\203\t\224\2261\202C\234\0274\005\022\204\"\261;#\024\027\204\360\314!n\322\3061\222\366f9\207x\215i\r' \232(\234C\274\202C\234\003\241\251X\347\034\220\256b\235o`\372\202\031\301'4\326\371\006\301\265\261\31658\r\201\307\223\0374\301\275\331\tq\252\031\205\006a\235S(\355\262vD\3454\375\200\234\334\226\317:\227\031\275ldr4\326y\214\320\004"
+	.string	"b\243\311\216\326\271\004!\216u.\241\364Y\347\275b\323K\224G\236=\333\370\316\264\361]\220\206m\230\266\361\017\266\361\f81=;R\303\304\025\247(\232\026_H\335X.\023o\024\247wCT\340h1\361\365\264\016\352\311\314\305\304w\240\364\323F\334\350\231\370\016\214v\361j\242\201\242\234\211\327\300h\013\200\244\213\211\277@\351\007\240\3140\202A\350\037&\236\203\322\217\322C8s\366L\374\006\246]B\220l.&~\203\321\224I\021\021\006&*A\"\226\326b\342)\234\275\263\305\304\313\230\306"
+	.ascii	"DZ\223\213\211\227\031\315\033R\231s1\361-\244-\327\323T4\232"
+	.ascii	"\211\347\225\226\240\204\216\030\031L\374\2164U#3\002de\2308"
+	.ascii	"%\316\3122L\374\007\257$\031\2222\231\211\337\300i\b\274F\260"
+	.ascii	"yh\322/w}\003\245-\360\310Q2\316\251\001\323=\020g=>w\375\002"
+	.ascii	"B\377p\327-P\001\nppN\2408\201q\003\362\314]\327\240\364\204"
+	.ascii	")O`\236\341\256{\030M\2178A\261uw=\3464\004qJ\312bHS\034\303"
+	.ascii	"\024h\016\262A87\246\341\256\373\202~ \316l\307g\326\201\305"
+	.ascii	"\2350\216)\343\256\277\214w\327[Lo\200*\273\261\342\256\267\220"
+	.ascii	"\246bL"
+	.ascii	"\332X\354\2269\343\256\363J\233\356\372\256\353>i\334u\013fs"
+	.ascii	"\327aF\307\324@+3\216\207\377\215\005\360\360/f\022\013=\374"
+	.ascii	"K\231\204~\235T\036\032y\332q\302V\036\236e\2349mzx^\233\317"
+	.ascii	"\303\363J\233LqDk\306\303\357\202#V\353\254\300\303\233\334\341"
+	.ascii	"\341-\230\207\207g1g,<K\371\263\360<\323\364G\024\\\223\317\302"
+	.ascii	"\357\316\007\026\n\037\270F\215\2379\3034\276\363\371\3003<\343"
+	.ascii	"\036\315e\031\357\260Y\226q\013\031T`\256\327\370\312\\7\351"
+	.ascii	"\237%u\305m\fs\2715QA\331,s\235W\026\300\\g\031\r\341m\310[\317"
+	.ascii	"\\Z\336\252\342\255-\233;r'day9\265\336\033{\302_\251\365_\321"
+	.ascii	"g\326:L\320~q\225\364b\261\254\365\230\242\251W\216\321\232\345"
+	.ascii	"\254u\017\224h\255{\320:o\214\341\254\357J\037g}7\352p\226\207"
+	.ascii	"\234e\"geQ\033Y1\236A\214\327\304\370\256\264G-\023V\206Q\364"
+	.ascii	"\232\261z\246\230\354h0\326?\240\031\013k\203a\274\305\205#@"
+	.ascii	"\351q\372j\205G\346\005 \345X\363\325\212\207\322\305W\3670\326"
+	.ascii	"P\371\352\024(T\371\3521\246\225\251\301W\2370\272\205\257\356"
+	.ascii	";M\275F\004m\320._\335W\332\307\243\352F\203\257Z\264\260r\213"
+	.ascii	"\026,l\005\303VVV<[Y\2618o\244]\346Li*W}7\232\3220qD\250\301"
+	.ascii	"U\347\215+L\345U\"h\266/Lu\027\317LJ4\325=\352L\265\246Zq\227"
+	.ascii	"4\236\272G)O\275\302\024\215\245\336\301\244\245n\323\305R\337"
+	.ascii	"\2154\226\032\333\202\341\3043[\312\026a\313i\276\2344\226zo"
+	.ascii	"\224\272\357\264\324\177\244\245\376+}\226:\314\bsJ\030\355("
+	.ascii	"\223hFc\251\333QVq\013\267\205U\334$\225\203XE\321*T\330hWVE"
+	.ascii	"p\324wE\257\322\222\232\224\317\034u\236i\307\241\r\221\265\224"
+	.ascii	"\2468n\262\342L:\352=\323\021Np\021\241a\216z\357\214\272W\370"
+	.ascii	"\311P\257\241m\206z\005C\275\203w<\226\227\022\306O\1771{\344"
+	.ascii	"o\364\366\310\351\200*\202\237\376\023\332o@UE>#\345\374\364"
+	.ascii	"\t\245\351\222\244\033\022&\375\364\030S\206\2249#\370\211i\t"
+	.ascii	"\225\223\317\374t\016F\233\310\221\037!\032\346\247s`\362\370"
+	.ascii	"\351\034\224\0230}f\272\006\305Ma\246k \\'3]\203\322\305L\327"
+	.ascii	"`\364@R(R\bN\b>\025\237\314t\t\246\004\022\312L\2079a\204Qf:"
+	.ascii	"\214\n3\035f4\323\177\246uJA^>3\335W\032\001XQh\370\314t\226"
+	.ascii	"\240\224\231\31622\235W\026\247\202+\314\364\035\225\231\356"
+	.ascii	"\323\302*3\335$\0133\275\206\022\315t\013VfzL\351\b$\212\304"
+	.ascii	"Q\242\227\0363\026\203\246\213\227>!h\226/\253({\302K\227pZW"
+	.ascii	"\345b\n\215\227\016C\376\314\245\277\314x\351/\245)\370\001\361"
+	.ascii	"\344\363\322YN\2730\321\361q\361\322Y\202\246B2\265\027F\363"
+	.ascii	"\322y\347\214\227\316+M\177\2448\352\362y\351.=A[\320t\361\322"
+	.ascii	"?,\n/\335\202\331\274t\2630}\200\203\373\250\262\2208\213\227"
+	.ascii	"T\031C2\"2$Q\322\001\202\013\020\024')d\354\252\003\022@\221"
+	.ascii	"\251\022"
+	.string	"Ea\205\210\022\311\210\210\f=Y:\301\324\301\222\274l;!o\303p@\316\372\026')\202VT|\t\"\262\206~\024G\242M\335M\321\302\027m\320Z\375\370C\305\205Qa-\234\235z\222SsI\206=R\016{#3\266\3238\253\213\312\334\363\216/\340\355~V\215\265\341E\353\270\375\031\244\037\244\203\005b\365\227f\036'\025X\242\031\351\236\314\233F\340\303@\357\220A\276\2037\310H\253\213&\236}n\311y\004\231\\\321\247j\234|45\225\030N\315\2431q\221\036\350:\251\261V9\202i\203\232V\220\033\235$\214\371\260\332\260\272\255\202P\305\247\267\r9\207S0\262f\037\310\345\020\024\316`\037\003\005\230\241\372\235>a\224\315\262\3775\220\020\031@Y\262\336\234\334\237+?\352\215\275\001%Z\210\267\300\207|\007\3429\312\210\254t\n\254Gp\035\366\343v*\b\327x\004\311p\346{\307a"
+	.ascii	"8K`\307\311Phx\323\314\301\335\266\t`\321\214>\270\315,\302\367"
+	.ascii	"\263'B\324\237G60\302\210\207\303\2169\001\236NKR\263\214\367"
+	.ascii	"\013\035%"
+	.string	"\2021#\037\223R\226>\232\355\223\314z\300]p\330<\343u\202w\r\354\342\007\312H\b\013\357B\225|h\216\263\354\016\214z\343\001P\272\262*,\007R\002\332<`28u\252B\343g*o_|1\237%:\0249\301S\212\231I\200p\240e\332{\361h\345\372x\022\324B\215\241\250o\036\304_\201*H\244o\222\213\030a\367|\016D*l\320\301\202\325 KR\257e\311\215\300\334\362]\232\305Z+\335\024\037\275c\346\177\242\372\355\020-RW+\211U\243\242\243\375`|z\003LZ\371J1\377\317\227\200N\\\312ITK\036\344\340\350[\332\377\016\357\235\230\254\007\224\034\017\331\260\232\356\"T\36055~R\235\217\314\212Yk \335,Z\217#\247\250U\264\332+\001MzD\b??!y\3340\022AyG\220\366\004\205;R*\240T<>\220\016\245\302\340Rv}\243\003\350\360\f\327"
+	.ascii	"\304\345g\337\340\t\006E\t=\317\0173\007\020\337\273\366(i\254"
+	.ascii	"O=\260,]r@O\225`[D\203*A\202s\275\005\232\340\364\b\276\264\016"
+	.ascii	"\355\036\345\274\017\232j@\217\277k\250\324\023\222F\310k\351"
+	.ascii	"\373v\032\201JJ\263LR\031\227\301I\026~\361\276\3049\301{"
+	.string	"\35124c.\022\306\266't\035.^\300\333\024\007\253\b*\257Wp\335\351c\346R\371\267\2431\265\033\201\334c\017\255\347\021\221\352\0072\243&b\227)z\314C\350\317m\033$`\223\246[P\243\310\306\216\350m\200n\021\240\320KSP\\>f2L\251a{0'0\031\312\323\251U\326\372\250 2\241\313\357\231\300\f\223\306PVq&A-\262\353\230\357\231\223e\346t\ny\\;+@+\352\242;K\214\261\327\023\266\\g\023\250rU\377ei\007\032\036\022*R#v-\323c\234\264k \024\217\246\277\323\2223S\216\322L\277\202\317\363NT\005d\321\207:\177F\241\366\320\274\242\t\226\221\f\365QAb~\370\0034m\006F\212\2200\337\217\034Bh~\274\027\317\003\035\266\201{\361\177\300\257\r\247\032\306\276\215\255\325\017\261q~`a\004j\324\363\177\307\203\321\"\313\330\350\204\202\342\244"
+	.string	"\300\001\2424\347$\372\003\341\276g\352\257)"
+	.string	"\t\336\005\373\361g0\311\b\233\245K\356<\004\321U\341\031\241}\013&HM&s3\205\235:6\322\004"
+	.string	"\347\376u%\006\241\035\234y\2272\013\031n"
+	.string	"\317\337\212\275+#\334!\217\271\276\331"
+	.ascii	"\333\336\365N\334X\367jo\370;\020\301J\030G\313\376\210A?O\373"
+	.ascii	"|,\252\321D\001\001\210\327P\375\220=\002q-\352#\306VX\363\301"
+	.ascii	"\352\r\310s\352\315\246\215[\241\025\224;_\251\352C\377\335<"
+	.ascii	" 7\203\363mvc\276\310\261\"\177\244\241\243\333\026\214q\221"
+	.ascii	"\321\326\216\240\363n8\035\247\222U\301i\214\237v\354H\367\215"
+	.ascii	"\342\307\336\312\343tW\267r\215\276\203@E\247\200$\257\347\235"
+	.ascii	"\237`|x#\277H-\330CS\227\035"
+	.string	"\270\370GR8\2468P\b\302V\303\310\210\331\275\343\220\376\202\205\211\f[\211\255\nZ\323a\313\032^\304lJ5<B\323h\356q\310\335\002LDM~g\362\234SE\327\221\231s\026\323/\213\253\276Q\200\321\021\341!]\223nX\311`\b\320\306\b\375\367\223\276\222[\376.5\\\272!\363\371\342D\323%\326\255\213\225\326\375En\230\322\226Y\267\332x^\212sT\225\020\367\351K9\354\350\267z\320]\225:\221\257\250\244\201s\201\337_Q\313\301\277\266\023C\256\242\247\304\036u-\306{\372R\016;{\255&pU\205n\344/kY\340\337\366\242\360U\366(\261\243\252\n\361o_\222\302g\277\245\007\356J\241\213|\305Jn0\260\376f1J\031\230\324\226\357B\245D:x\261\271\013r\301x\210v\241G\3606A\013_FI\331[\314i\\{"
+	.string	"\354+\263z{\b\364\343\261\254\322dP\323r\304Yd9\261'\267e\254T\257\027\024\302\316\254\207{\346\227$]V\266Ci\t\370\243g\214n\252X\2500\202\203\275h<i8\f\021"
+	.ascii	"\352\335\312\365O\375\267\351\301$\373d\004\037G\f\346\033\223"
+	.ascii	"\271\303XlSy\300\370\357\341;r\021\005.\235\n\317\033\362\022"
+	.ascii	"\357\\\201\311\016\353\231\350^\217\272\257\330u`\323R\214\307"
+	.ascii	"u\212\030\340\001\257Y\002\276'\335\2277\267\317?\223\205'\345"
+	.ascii	"\335oH\3219\030\250\271\f\221c#&\031\350\n\317\367\225\202\350"
+	.ascii	"c8\232t\025;f&b\201\343o\327\345(\250\005 R\224/\314E\324\221"
+	.ascii	"\225j*I=\005$\177\333\377"
+	.string	"X%\243P\210\202K\233\362I\031\263L\2101\210\240\337\347\262\272\222N\367\225\002{\211\275@\017K\360R2C0\322\016q\351\030*\322cb;hc\304\313LX\233\023\263KL\\\316M\317\321\220J\247F\3470i\227\372\304/\206\343\234\370\200\231b\031\036\352\357yh[\203O\263\354\341bb=\365\271\244\234Y\245gmz\3421\224\311\027\307c\231\252\272G\317\317TY\217\f\013X\301S \232d\3229\235}!m)\370j\037jC b\211\036\230\376\247H\342\023\252\0029\304K0\r*\237\035\344O\0039#$\370\377\354\373Z\351+\231\035\346\366\2552=\230x\016\332\016\335\324\230\020\fM_\310\376\357\t\031\324\216\315\317\f\212k\b;\215\276\312K\023\036!\341lT\354_\207\0223\30528\244\371Uvt\224gX3\322aP.8Y\222\2368>\034\\\336\215\251>\335\037{\307\375\366"
+	.ascii	"\341\027/o\260ro\001\206\3161\0217\3736\200\205\202\321\325\252"
+	.ascii	"y\251F?\016?\0347\307a\017\001"
+	.text
+	.section	.gnu.lto_.refs.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375`\035\b\035+"
+	.string	"\232`\020\021D\200\252I\032\003\363\375y7\177\303\356j\233\236\363\"\3676\265\373\365xq\362[\244|\tm\317\035\346\035\361\2359\342?\223\245]\026/\253\3577\317\352"
+	.string	""
+	.string	"\006 \020\304\021\n\204\206\006\360\321P#\215H\231\002\352"
+	.ascii	"\t\001\b\001\01740\331s\215\2375\276\200\361\247\244&\333\241"
+	.ascii	"\240&\323\237\246\262?M\246aH\017\215:\016L\027\201\372\255\324"
+	.ascii	"\005\342b\202\337\340_\373\352>\240]\372g\300\277J\371A\362\275"
+	.ascii	"z_\240\324\271\200?\201\277\005\324\007\224zU\251S\001\365&\362"
+	.ascii	"\231z\257D>R\357u\345nT\356E\345>T\356b\271\207\345\256\300\r"
+	.ascii	"0]5u\252\251OM=\300\357\245\246\0365u\250\251?\375\2767\365\246"
+	.ascii	"\251\003\230:o\352JSO\232\272\245[}k\3517\337\002\026+\\\264"
+	.ascii	"\322\303\252\375F\265S\3419\362\205\310]\354\375:\035u{$\277"
+	.ascii	"9\275>\ru\233\352I'{:\023\371\274\336\357\310/\352\351D\275\027"
+	.ascii	"\235~{\3324\364f\274\225\364p\374%\332u\034)\\i|\243\361s\343"
+	.ascii	"\253n\243\333;^\244kn!]q\213\372C\275Vn{\272m%\201{2c\244\366"
+	.ascii	"\305\370~.:b\037\315\267\212\020\007S\020\374\362ZM5\004nQ\305"
+	.ascii	"vQA\254~\b\264"
+	.string	"\363\026\264\357\016\364\272\001}\321~^h@\177\374\354!w8\237=\333a\367]QI-%\335\326\366\343ms\310-\316\226g7\354XRN\337\371\243\357\254\341\266\370\332.^g3\310\211\263\030\324\336\354\2056l\326\302\316u\3323\235v\2054h\226\302\036n\346\tz\021\321d\310\254\204\360p1\033A'yo\304\033\302.\376\366\333h[~\327\222\345\007\342HN\1774\177\234\217#_$\367\333T\007\270\317Vc\254\342X\265\261\212b\325l5\304\252\210U\022\373\265Jd\325\304\252\221\325#\253IVS\354cVW\254\266X\205\261sY-\261\352b\267\262Z\253WVo\354\202\r[\256-\260\352d\365\305*X\215\262*d\033X\215\013/{\275l\006\341W\031\177\262\260\005\343\007\021\214\001\343\346\2138}\347\353\\\221\354\336\323\254F\364,\254((\3367\355\216xk\021\241q\313Q\"rt"
+	.string	"\313Q\035\262\207B\364\303|A;3+\253\362\332\332\207\005\273J\255"
+	.ascii	"M\257\355\274\361\265\265\325 I\372e\325\313j\227U.\253h\253"
+	.ascii	"<\304\007\243@\376+\372\343\275\016\250\217\257\322\036\377\244"
+	.ascii	"<\236\324\035\257\244:^\2479V\034C"
+	.string	"[\235\226\226\266\336\bW\0346\306f\304\200\241.tL_\215\315kF\263\265\332D9\035\033[\265\261[H\307v!\255\261\257\216\2554\302/\363\373\261$\370\375\222\312\370\333o\215!\016\365\037}\351H\374\317\nC|\241\357\202\252.\364`\327/\313\212L\312\035H\277\035h\265\305\320W\312B\247R\026\252+\366&U\241\353T\305\207\252bM\021\236\225@\307J\260\242\330K\003\\\263\375\324\232M'\365\30471}g\337\315\266\232\030Zk3\357;\315[\3656\263Z\342\366Y\314\002\217\373\2758j\331o\232e_\237\256`\252g\2705\205\357\265D\251\353\210A\202\370\314_\017\330\337\306fg\016\235\341\250\225\372m\312?MM\032\240\376\2312e\271\237\005H\245\374.\340\227@\335@\251\245\376\003\352U\300'\243.\333y\345\276\003\276\220O\261`\r\306\373\311{\210\374\034\271j&\216\205\323\257rz"
+	.ascii	"\247G\"\277\210\\\034N\017s\252Wr\337\254V2\325)\272\316\267"
+	.ascii	"J\t\017\243\350\227\251\030X\360\313K\305\276\013\2705\345\304"
+	.ascii	"\244bb\372M\305V\241\350\306\263\303\331\351\350\331\317\354"
+	.ascii	"kVi\354n\366>{\230\325'\253M\306G\333\242\345\f\213\331\324\267"
+	.ascii	"\202\323\247\202\323\303\202S\377\232\272\327\324\021\344\364"
+	.ascii	"\256\234\016\234S\337\232:\201\251\373\256\346R"
+	.string	"\363\3363}\322N\233\020M=\247M\376\306\004k\252.9\227S\302\373i\352\344\324\235\2462M}\ti\276\021N/\232\032\200\246\2501T\344\fRD\002\031\021\031\031I\233t\240\24243\333\016\021\3202)H\222\366\357\313yi\\\373\034\275\270\232\233'`\23515\300%\355O\266\354\f\220\026\001\"\272\017\033\330g@\340\204\210\336\212\306<\215\325\333\351\214o;\212C\344\032\366\322\241*\207\020\352n\313ka\336\022\201\fe?\311\251\254\252\306\3768dx\031\005)\324n\274&a%Ym/\321\036_\316K\265\032S\313P\277\214\226\177\301fc \023\0010\030M\370K\332\205\240\217&zpF\300\310(\277\222\006!n\004\231\352\263D\264 \232\246\356\333\201\t\315\005m}5.ap\314\204\227\245\257\215bm\027\002\r\360\304\"\261\255\340\221c\217-,\360\022]\271\215\004\324\373l\037!\252@"
+	.string	"\036"
+	.ascii	"P\244\267<\007\fd\335\005i-\214#.\207F0O1-\034\fB\221B\224B\020"
+	.ascii	"\033(\220\n\243\372\033\rj\016\025j\254\b=!\262$`CM\362C^Db\312"
+	.ascii	"\022\203t8>\233\370\252\006"
+	.text
+	.section	.gnu.lto_.decls.b0ce503e3041f83e,"e",@progbits
+	.string	"(\265/\375\240uc\001"
+	.ascii	"\235N\005\236\363\307;\034T\020(&\3554"
+	.string	"\006\252\"ZU\234WE\360'\355\242x\227'2E\232|\263\200\201D\207=I\207'\321e\312\264\337.\205\253\253\026\251|\366\266\033\2018\344\n\002\354V\201U\253)p\210\300\345BB\207V\021\260K\205\304\340\323D\310\336[\356nr\313\235\002\031\030\374\033\266\035qt\306\327\250,$zVY\2572r\321!\022\273\270\254Y\246\37525\311\2561\364\364\244\304e}\342\341\276\032]\233V&\230F\023$4\262^\231~\374\342\261$\316z]Z\223\252\360\270R\313zU\"\036\342\371)\311zEZ\223\376\273\257ZQ\0364\353\177MR\341X\214Qa\313z=\312E<`\030Q\313z5Z_\374w3\2176\270\247\325E\361\247\t\211^\326'\032\356\027\302JrTE\331'\322\355\267\251I\366y\353\212uh\265\033D\243\222\365*T\326\266xZK\313\372\304#\373\252\330_\226\362G\005\230\231*"
+	.ascii	"\"rA\314O=S\323\324\274\033\r\360b\222\375\246d,j\236\223K\034"
+	.ascii	"\204DP*v\230\0033\323\321\347%\216\255\242l\255>k\320\n\264\306"
+	.ascii	"y\313\372\243F\363a\226>\017f\302\262\303,\230\213\324\274\033"
+	.ascii	"\r\020\203\002\367\025j\345\035\365_\020@i\034\227a\311T\362"
+	.ascii	"\0255\317\251,V\202\217\344\375\021N\263d-j4cI\223\300\210%\312"
+	.ascii	"4\b\253\377|\305J\261\215\205\214\025Y\347\251\212V\327\302*"
+	.ascii	"\353\023\263\366\237\r\325h\256\202\\\301C\313\216\254s!1\307"
+	.ascii	">\321j\3472U\206\365@M\262'\306\330'*\355\023Y\354\023\205\366"
+	.ascii	"\237\2450\241\321Q\301\313\372D\237\215A\224'arUiY\347'9\367"
+	.ascii	"e(\317O\262\223\1770\341\305\240X,\216\313\362\023\035\307?\252"
+	.ascii	"\232\301QU3 \306e\375\ba\3655\226&|^}[\374\262\346\333\253a\220"
+	.ascii	"\353oF\326H\205Q\234\216\364|T([QvyL80\373\211bR\244\346$\272"
+	.ascii	"\"]xwX\334Z`emWl:\033l\222B\227\227\250\321\\\227\225\224\315"
+	.ascii	"\251"
+	.string	"\204G\037\227\030\210\217n\253.\313\305>\203%\204!\365%\231\306q\031\207\017> \n\001[:d\365\265\332\276\016\333\327\\\373\317iD^\277\033XU\222\300\265|lzgY\303\275\025\241HC\334\266\254d\355\266\n\r\371\220e}\235\221d65\232\333\362\3323U6b$\216\343\266\254\226\323N\030Br_\324(j\313GT\270\327\t\213\025A\246\037\270LQHZ\260\372zi\253\261*\303^\307\373\253\225\375\347\"i\361\253v\027\223\245\0219\366I\263\034\361\211\313`'\242#A\242E1\204\260\254\rA#\026N\r\307\204\250\321\214v\274\"\364E\262\324\204\225\265\007\017\317BT2,fJ\316\262\331\227\231\325P\326\331\354\317d\271L=\3245\244\374hd\315A\225aW5\311\252d\036\236\203\254mrCY\306\304tZW\327\225X\230\031\325U\221\254\201p\310{N\230\306\262\376\n\270O"
+	.ascii	"\0339\253\002 \"\027\332\302\312\376\354#s\345\256\343\032\307"
+	.ascii	"?d[\004\260R\t\325<'\024\200\214\211\371\3105\016X\001\020\221"
+	.ascii	"\013^b\177\006\313=\362W\366\312?\324h\366\221w<k\345\255s(\213"
+	.ascii	"c\023\376L\345#W\251\204G\237\262\370\b\001A\244\300\246\037"
+	.ascii	"|\300\341\003ca\230\024\266\242\316]\2045\304qP\034\3074n\035"
+	.ascii	"\222;\253\254\357\341\231G\222Er*\213\323\3428F\276WpP\177Y\177"
+	.ascii	"%\262\3252U\206\345\240&\331\257aY\207\333\203L\210*\353\257"
+	.ascii	"[\373j4c\345H{\242t\004\307s\216\007\026\343\n4\236\231\025\257"
+	.ascii	"\254\363\215\215\343G\023\213\254\363\325\001\213|X\264\310\372"
+	.ascii	"\205\217\373\357j&\267\260\273\254\277\342\330_k\354\2573\366"
+	.ascii	"\327\247\355\242&\2478\374e\271\303\313\372j4C\325C\026\274d"
+	.ascii	"\374\321\220*\022\230\327\"k\017r\224\033T\206t\373\246D\245"
+	.ascii	"e\375\025i\377yF\226Q\203\013IX\326\2047\200\222\240\236X\036"
+	.ascii	"z\323\245\254sS\216\241F9d'\244\272\007\364bF\326"
+	.string	"_\213\366\bb\225\003\373C\225\003\373g&\302\314wg\004\004C-\324I\270\374\266\226:\330ApkbY\377Y)\311\210\326\242P/k\244\264\2408\2169\020\333\006\317rd\375\274e_-\222]\250FT++\332\326f\023\272\"\025\313.\324+\255\232\023+\322\334\"\033\345\243\374\"\263P\243\331E\376\311AY(\017]-\213\211\202\3428\276j\246\236\251iCN\262\250A\262\213\274\"\027\255h[{\305\020-\3228.s\241b\311>+\332\226\313\242\306\224\303\007\037|\260\241{2\372\212:\023e,-E\204d\375\\\270\237\003\267J\244\312\260/j\222u\337\273*O[Y??\331\317v\373\317>9\016\203aCG\214t\335\260\370`\312Z\325\242n\271z\250f\211\325\303\022\240q\374\243\036\"\263\304\361\017RU3P\325\f4\220*-5V?+\331\317o\373\371\310V\247ehq\034K"
+	.string	"K\t\332p\312\372Yl\037Q\225\254e[-\233\320\237tNm\262\226\265\3555'~\277:E\255\242\032\252T\324\250Z\370B\325\211*\025\212\"\215\343\270P\035T\t\327\262\255\226H\r)\3228.\373\340\003\t>\370@\355\221\007E{c\343\226\037[\260\370\020\324E\264\244\254\"Y?K\355\377*\240\032U\003\325>\255\006\252OT)\253\031\322f\033\262D\032\307h\034>@~\331\211\305\320Z\375+S\201\020\302\220f\375\334b\253P\324(jT\365\273>\203\306hq\\f\\\177\232\356\330\262\276\352\001\213<<<<T=`\237\343}5\312\276\272\267\3718 \233\306\206\264d}\265m\237"
+	.string	"K\214\250e\277\207\253y*\023\365\356\370\343\022\007\t\035\331\212\343\240\377\252\236\272\247F\325<\025\357\252\232\272\366\\\026\307hq\034\177\360\001\207w,\311W\013V_5\262\257\002\331*\235Z\247F%P\355\312\312\3428F\036\257\360\035U\311\372*\217-\2028V%`\325\303CU\002\366\352\216}\365j\313q\320W\240sW\262\276\212\264O\200\337\303\377\301\0045\211\312\246\302\255e[1\220\023\036\006\230\022$\022c\032\307h\377\32585\252&Q\221\374\203\tW\313\342X,\216\343\0178\264HUV\342\264V\333T75j\201\372\366\017&|\3659+\023\213\3432d\361\350\b\013\232\3651\260\257Z\300\252\207\252\005\354G\354+`\337"
+	.string	"\373$l\fT\031V\253I\366i\252\f\253\nQ\321\324h\007*\221\253dj\331\211?eqY\034\227!\267\023i\024^\326\377`\303P\305&\234\335W;`\327\303C\265\003\366y\037\212*\303\272\2502lV\223\354\247\252\f\373\253c\277\032\246\212Y\260\022\031A\343\2648.{A\2265\271\260\312\372e\252\f\273\325$\313~h\245^\004\374o\002~\330\257n]F\201\233\264^\310\235u\202\025f\345\260V\260\312\374k\007\257\001\376\367\204\037\346S5\260\032W\f\264\213\275\377%\353J\300\2174\341\246u\344\217\254\371\263\005\031"
+	.string	"%\332\033\310\t\264M\036\324\013\332#d"
+	.string	"x\262N\356!\006\346\033"
+	.ascii	"\331\020p\002\336\016?L\201W\240n\365\202\226\005R\002*u\253"
+	.ascii	"%\340\016\332"
+	.string	"!$\322\207\2723\017v\375\325\030\330N\315@\366R5P\367\277|\027\264?\310\226\255"
+	.string	"W\273\344\177\376\221]\377[\201\327\002?\034\367\322\240\036\2765h\252\237x\004'\371_\345\017\303\2756\277\366\032\374\b5\001q\377C\370\221X!~\370lk\201\337~V\005\266\002\331\002\242\334\341F\301J\340\025\001\273\021\343^\020\250u\307@\007\352\005\252\005m\177\353\206\254\372\211q/\b\366\021L\201\235\343\337X?\214\004\247\203\303#\177\206\221\200\t\177\261*"
+	.ascii	"\304\266|\201~\301\366\374\260\221_=\333t\362\263O\036\355\f"
+	.ascii	"\355\r\031X\030\330\022\355\021\266\331\206hG\030\321>\300\252"
+	.ascii	"m:b\321\032\200\335@+\002\274\366\023\213\332\001\264l\355\002"
+	.ascii	"`\265\037.\362\267&Z\024Y\203?\007\340\317\030\374\371\202_\277"
+	.ascii	"(\376\311\020\365\263\016\200\321`x\312\253\272\347D\005X\310"
+	.ascii	"\330\b\027\212I_\377\013\202\006\374o\n?|\366\016Z/d\016\321"
+	.ascii	"\255"
+	.string	"=R\263\264K-\324\252}`\263_\023}@\335\203\313~\315\242\306\017\223\251}j\t\375\363k\020\324\301cw\300\217T\300Q\3317\370\221\035\374j\226v\206\252\367\253w?\033\0028\210\232\307\341\025\300cPH\023\376\f\243\002\006\373U'\377\007\233\374\352\004\354\003~\370\013N\216\020AQ\313\337Z\375mV\373\266KV\253\r\200\036\372Y8M\364\353\025\277f\001{A\340g\003\377\025\002\357\376_/\330\007\334c\220\317\220\312\273\005\356\352g\355\266\274N\370X'\306\265\277\235\300\210\030\200\327\354%\013\300\321\001\304\344\313\273vx\370\263:t\036l\001xKK\253\346g\277\234\374\272\357\207u\300X9\306>\360\267$t\326\034D\370\202\345qmP\020n\323\214I\177\333r\310\206y\232\255\374m\315\305\037FQ\301\013\343\"\374G\031\215Ged\341ow\374\255\326\017_\375\355\002\332\0203d\0132"
+	.ascii	"\330\fd!1\320\266\370[\243\037\266\361\347\024\377\337*`!\363"
+	.ascii	"\023\001\341\032\277\206\203\255~}$\350W\035\300\376\020\341"
+	.ascii	"*7ne\372W\030\377\332\364\257N\277k\367\303T\277{\367\303S?\f"
+	.ascii	"\375"
+	.string	"\2116\377\332\342_\215\376\325\305\3576\371a\032\277\353\344\207\245~\027\312\357F\371\341(x\306\257%\340\371\327\035\033\376\265\003\277\352bm\256E-\r?,\343_\237\377\272\204\241~\"\007\324C6b\334\013\002\245\253%\340\247\037vR/\270\006\376#\327\277\212\340gwV\020\374\253\n\270i\355\371\335\"?\314\364\273j?\f\343_u~\367\355\207\227~\027\356\207\225\340\244\037Fj)\220\225aN\303\377\362\027\365~}\201\277\035\201\253\345w\267\374\360\321_\365\207_\300.~\242\rm\bZ\017\374\355\007~\330\350_\227\377\253_\342\017\267\370a\026\357.\352\027~=\303\257a\370\333\033\3766\305\017\027=\377\325k\355\372\333\246\332B\313\363\303D\277[\b\307\240\002\200(\202\377m\377\327\345\207\207^\2307\346\177e~X\350\265\340\005\300\017\007\375o\006?\f\364\277\032\374\360\017\354\363\023}\336\r\376W"
+	.string	"\377\313\301\017\307\377e\340\340o\026\300# \006\241\370\357\374\217J\376lA\006"
+	.string	"\210\030Z2X\004z\252\221\0028\004D0\030\004\377\033\003\374\001\032\234wp\032Xx\373\240z\301o\370\2214\266\374\370?\b;3\f{\004{ [\220\001\320\242\301*Z\370_\007\374p\nb\334\013\202\275\322\250/G\376\037\340G\312\370\177\270\331\031\370\206\217\250\340W_\016\360o\024\304\270\027\004\347"
+	.string	"N\341\352.\216\360\262\001\366\370\263\310\037\266\341g\213\177N\262\357\257\326p\220a\330]|\271\316\013c\r\031\343oq\300=?1\356\005\301\r\t\374,\002v\226\026\033\002N"
+	.string	"\273\201\261\277E\202\237\037\216.\370\333\030\177\353\364\303\316\267\204\377]\001w"
+	.ascii	"\247\320$\302\3572\301\315\337}\372]\250\037\356\200;\003\346"
+	.ascii	"\371\211\"~6v\251\340\235\337\245\361\273\320\037\326q\223Z\020"
+	.ascii	"\r8\372\254\030X3\360\2737\340\234\277-\201\001\255\003`\034"
+	.ascii	"\031\036\360\237\204\377\310\364\177p\315\377\337\332\343\017"
+	.ascii	"\243\030\361\277\303\177\304\361\303\034h\005\340\326\370\337"
+	.ascii	"\027\257\300\205\244_\373\320^m(\250\370Y\004t\375/\b\230\277"
+	.ascii	"\032\303\216\370\226\f\303\314_\363H@\211\342\221\177\177\301"
+	.ascii	"'\366\331\277\205\374\260\211\177\233\375;\r.\361\357#\377F\362"
+	.ascii	"\303\313\177\303\375\372\007|\363\353 \260\315\237\221\177>\022"
+	.ascii	"\353\366\222\177\323\3750\211;X\271\311b\264"
+	.string	"\030\212\377\f\370\213JjPS\2003\200\201\006\020\353\276\210m\357\bn\212E~\326\004\030\003?\213\200\377\372/\366\374{\004\377\366\331@I\376-\364\3034\250\t`\013P\314\371\211]\360\0056\022\212- ~\365\202\342\212\377[\324\013`\346\017]\236_\347\301\026\370\335\016\374p\0056\210}\004S@=\314\004T\013F\250\311@)\300!L\374p\004\276%\377\204 \313\210\201\237\215\335AW\372\273S~X\006\032\262\213\215\302-\374]\303\037\216\341[\230\377O\370\217p,\020\030\206\025\177.\372\263\321\257^\265\200\005\330\177\t~c\007\214\214\022\004\301\020\370Y\022\277z\202H\367\2574\300\017\230\200\b\340\027|`\027~b\f\260\003\216~\030\304\017\037@M\001V\341'\206\200\241\001N\341_G\374\353\005\026\360\037\205\377\030\202\177K`\317\360\303\f\350\200-\032\303\276BL\2615\270@~\327\354\207\027"
+	.string	"+\340'>`\243p\275`\024~6\304\357\216\375p\002hx\006\377\261\306\317\322\3705\035\214\200\037>"
+	.string	"l\302\277Q\354)[\013^\t?\354\201\2652\276"
+	.string	"\217\360\303\035r\207\037\026\341\317$l\361"
+	.string	"M\341_\257\326\032S\320\017\022\031\220\241\033\204\224\337\005\374\341\020f\254$\220\320\"\346\300 \300\037\320\300\035\374j\211\0210\007?\234\301\017\267\260\021\276\340\207)\370W\035&\376\233\370\217l\177\253\372W\350\277\332\370\327\032\377j\265^\255ZS\257`\315\261b]\203\377H$\307P9d(u\002v\310JB ,\003\307\300I\0160\0226\376p\373\257\"\374\352\005\377\340?\212\3103~\255$\343\317P\177\216\312N\177\216\361\303\353\237it@\003\215\272X\361\202"
+	.string	"\347\177o"
+	.string	"V\177\266M\367L\371\265\341\017\377=\334\362\277W\206\376[\360#\215V\177\246\262q\345f\254\372\333\022\\\035\277\233\365\277\206n\327[\330\272\274T\376\375\364o\250\377\235\262Q\374\032\307\306\371_\302\277m\327\r\320\274\257\364\025\374\223\341?\013\3771\352\311\257\345\334\244\033\363\277}\177\236\362g\302?S\371\263\241z\201\f\377iP-\310V\366\013\020\273\247\235[~\242\372\277N\336&|?\304\237\265{\231\204\361\031\211\340\375\332\212\327\237\2772X\346\3723\217\036\177\366\001\344\034\344\260_\360\033\303~7\003W\203\377\275\373]\017\\\001\274v\377[\347\216\360\273$\374/\335\317\236`\344wKx\227\324\374\352\220wNU#\026\300\r\341\177\225\374\304\004\310\2614\270\013p\031\360\277q\377\212"
+	.ascii	"\227\205\337m\341\177\223\270\031x\341\334\020\377\n\302\225"
+	.ascii	"\300\377\276\341\250Q\277\372\365\277\003\265\004\b\377/\360"
+	.ascii	"\037+\360o\236\327\355?\007#\210\035^\r\27492\235\234k\363\273"
+	.ascii	"7\377\333\246\356\374\366\273\034x\331\266\226\027\311"
+	.string	"\317Z!\272\274G^#\271\210[\003\007k\177\306\373\337\264\213\360\177\001\377\021\003D~\3421\317e\271?+\3713\035\233\345\215\376y\311\3777\367\370\016\371s\335{\366\347'\377\213\366\347(\257\220?\027\371\325\022\331\357\312\177\017~ca\333\325b\240]\004\3405{\313^\262_\275\340\311\037\271\374\333\t\336\260\025\203\f@\254\025\374\252\005V\016\377\013\344_%\370\2112\376\225\203\377o\353\004\277;\301\373\343_-X]V\243Z\242\245\340\277"
+	.string	"\376\243\001\376\266\204\027,\223\265\035\264\007\370[\004\240\360\277_\377\006q\230\203\264\257\327\277B [\360g"
+	.string	"\374\356\007\\\020\374\257\217\237\250\365\366\370\217\201\267\306\333\365\277Y\377\032\342WK4\300"
+	.string	"\307\035\226\351\315\001\342\305\361g\262?\007\371\377\346\276\277\013\377\357\215\n^\030\252\005\202F&\377\017\325\253%\224\277z\201_\265@\006\376\r\303{\365\023\257\2746\336\032\277\032\303\352_}\321\335 \376\275\302\377\322 b\371\325\303U\244~\342\005\037\321\232pD\321\n\240\355\340\030\001\242\334\177\366\207\263(\220`\017\022\322tp\273\262\377\024\374H\237\377\215\372\365\234\032\303O\f\314\003xg\374:\372\022u@\303\210W\240\276\334"
+	.string	"\2771\203W\306\033c\b\262\305\224\267Iu\211X/\323\257\376\374\205q\020\376b\341\bt\212 \227\210i\357\322\257\376\bm\275\177\357\375\257\322\257\302\277^\302QcF\264a\310\033~b\215\237h\343\177\223~\342\331\213\364\023\305\336\243\"\277\272\227\326\262\261\017\374;\377\233\370\277/\206\320|p\005\007B"
+	.string	"\274\203\021\252\005:~\265\004|\201\023\312\220=\370\211\206?\261\312\377\272\370/\345S\376\327\350z\377\363^\370\277-"
+	.string	"\300\342\3275\236\344\277\341\377\026\375\352\361\377t\023\001_\242\377\203\352\037\345\177\007\3779\374*\005*\0134\207)\241\276\274\001?\034\205\330\326\n\340\277\314\177\204"
+	.string	"\033\033\325\033\177\370N\217\340]\321D\363\033E \256\375w\1778\306\366\360\357\017\377;\364\023\243\274B\3776\300\377\006\375\373\204\377\005z\177~\365\254S\314o\364"
+	.string	"\302\336\340\337!\374o\254\233\210~p\334\026\035\345&\200\330\226\201\037\025hci\370\277\377\242\017\013\374/\b\210m\357\b\330\n\374\207\377\242\326\277]\376\375\362\277\"\370w\361\r\301O<\362\253(\020\341\324\004\250\277\313\017W\375\273\350'\306\275 \370\331\005\374'\376\305\020\220\360a\311v\370\325\023\003x?\360\263\032\274\036\020\300\377\342_\204\200\372C\202\362\177U\374;\004\377\353\374\325\237_\035\201\032\002\241\323\360\237\0036"
+	.string	"\377\217\177\321\001\377\352\343o\357\364\234\374o\363\177\373\037\243\374\355\316\373\037\365\3766\001\177\213\200\177\205\341\377\372\037U\374,\220\377\355\300\237C\370\341\371\211\030xw~b\007t~\255#\347\177q0\370\2157\374\255\313\237\243/\007\324\024V\027^\346{\202)kyM\274%~m\365\277\313\237H\301\377\336\374:\355\023\374\307"
+	.string	"\374\352\253\032\377\277\235\203\377\025|\220h\343W\367\377\342\017\307\360\2776\377\253\374_\032\376\327\002\377;\342\177C\374\257\f\377\353\200\377M\341\177\023\360\277'\374o\t\377\373\341\177I\370\337\016\377\033\302\377r\360\277\032\374/"
+	.ascii	"\376W\346\177a\376\327\345\177\217\377[\374\337\367\177\367\377"
+	.ascii	"\022\377W\375\335-\277k\370\273S~w\360w\001\1777\312\357:\371"
+	.ascii	"\335\273\337\215\373]\270\337U\373]\263\337%\373\335\261\337"
+	.ascii	"\r\373\335\257\337\355\361\273Y\277\213\343wk\374n\325\357B\177"
+	.ascii	"w\306\357B\375n\323\357\036\375\256\320\357\372\374\356\b~\027"
+	.ascii	"\004\277k\303\357v\340wQ\374\356\315\357j\340w%\360\273-\374"
+	.ascii	".\003~\327\204\337%\341w\007\360\273\032\374.\005\277\033\363"
+	.ascii	"\273\310\337\205\377\275\345\337S\376\035\370\357\275\177\343"
+	.ascii	"\375\233\356\337I\376\215\344\337E\376-\344\337`\377\356\372"
+	.ascii	"7\327\277\265\376\235\365"
+	.string	"o\254\177\323\3707\324\277\221\376]\364\357\025\377\026\3727\320\277}\376=\202\177\207\340\337\035\3707\316\277k\376=\303\277c\370\367\n\377>\341\337\037\376\035\302\2771\370\367\313\277\215\377&\376{\375\367\377\326\311\337\362\375\255\336\3372\371\333\273\277]\362\267q\177\353\366\267l\177{\344o\327\376\266\310\337\016\371\333\262\277\r\373[\257\277\375\372[\036\177\333\365\267Y\177\253\365\2677\3766\307\337\326\370[\251\277\235\361\267P\177\333\364\267N\177\273\364\267G\177\233\364\267,\376\326\350o\207\376v\305\337\376\374-\320\337\216\340oC\360\267\037\370\333\024\177\373\374\333\346\337\362\374m\316\337\242\370[\346\337\232\370\333\345\337\332\374-\r\177k\201\277\245\300\337\216\370\333\031\3766\304\337\312\360\2670\374\355\003\376\326\205\277\005\361\267\r\370\333\005\374-\n\177k\200\2775\341oG\370[\021\376\026\204\277\035\300\337v\360\267\002\370\333"
+	.string	"\374m\006\177K\301\337\276\374\355\361o\213\177\373\376\355\376\331\303\237\325\362\263W~v\360g\005\177\326\311\317\362\375\354\335\317\302\375\254\333\317\246\375l\364g\307~6\354g\301~V\353g\263~\326\352g\251~\026\372\263N?\333\364\263H?k\364\263,~\226\350g\207~6\350g\177~6\376Y\021\374\254\007~\266\347g\233?\313\363\263(~\226\371\263%~\366\346gI\374l\r?\273\201\237\315\300\317\322\360\263\025\370Y\013\374\354\210\237\225\300\317\312\360\2630\374\354\003~\326\205\237\005\361\263\013\370Y\024~\026\001?{\302\317\026\340g?\374,\t?\333\341gC\370\331\017~V"
+	.ascii	"?\033\200\237"
+	.string	"\255\340gi~\366\345g\221?[\374\331\367g\367\317\262?\253\177\"\226\237X\345'R\371\211\201?\321\357'\326\375D\271\237\b\367\023\335~\342\221\237\270\366\023\213\374\304!?Q\310O,\373\211c?\361\307O\354\361\023\267~\242\216\237h\343W\357\3765\307O\214\372/\303\277b\340\327y\277\372\343W\331\376\225\001\377\372\301O\224\361\023\241\376\365\202\237\370\364\023c\374y\372\023\231\376\034\345\317g\177\006\362g\033\177\246\361g\020\374\231\204_\213\375D\030\277f\373U\241_\335\300\257f\340W\023\360\177\372\253.?Q\351'\"\375\304\242\237\030\364\023}~\242\b~\342\007~\242\r?\261\003?\221\347_w\374D\235\237\310\201\237X\342\327\022\374D\233\237H\342'j\340'b\340'V\340'\212\370\211!~b\f?\361\001?\261\205\377#~\242\n?\221\001\277\352\343Wi\374k\t?q\001?1\001?\321"
+	.ascii	"?\361\303O\354\360\023\007\360\0239\370\265\321O\334\340'^\360"
+	.ascii	"\023)\370\211\023\374\253\006~\"\207\237\230\374\211/?\361\370"
+	.ascii	"\023\337\177}\300O\334\177\376\371\211\372'\252\277n\376\372"
+	.ascii	"\360\327V~m\370\353\347\257\251\374z\360_G\370\265\340\257\245"
+	.ascii	"\374\032\312\257\373~\315\367k\275_\343\375\372\356\327u\177"
+	.ascii	"\016\341\327s\277\226\3735\334\257\337~\335\366\353#\177\316"
+	.ascii	"\362\353\264_G\177m\366k\262_\217\375\372\307\257y\374\272\346"
+	.ascii	"\317\357\257w\374Z\307\257\006\376\253\003~\215\365k\034\277"
+	.ascii	"\256\361k\253_m\300\237\207\374\232\352\327Q\277n\3725\323\257"
+	.ascii	"a\374\327\371o\367\353\245_\335\377q\376\377\375*\207_\235\340"
+	.ascii	"W-\370\325\022\377\017\377\017\376\257\340\377\226_+\375:\351"
+	.ascii	"\3170\377\337~\215\364\353\243_\273\370"
+	.ascii	"u\213_\367\374\332\371\353\016\374\272\206_\323\360\353\021\277"
+	.ascii	"\352\200\177\365\372\327\036\377\312\365\257Z\377\232\365\257"
+	.ascii	"X\377z\343_\241\376\365\351_\217\376\225\305\277\216\340_o\370"
+	.ascii	"\327\r\374k\006\376\225\206\177\235\300\277\212\370\327\030\376"
+	.ascii	"\025\002\377\372\302\277\272\360\257+\374+\210\177U\341_S\370"
+	.ascii	"\325\266\177m\300\277\222\360\257\035\3765\204\177\005\341_1"
+	.ascii	"\370\327\343\277\026\377\225\375\263\226?[\371\037\303\237\245"
+	.ascii	"\374\331\357\317j\177\216\376Y\310\237\303\376|\365g\350\237"
+	.ascii	"\223\376\354\342\317,\376\f\364\347\021\3749\004\177\366\360"
+	.ascii	"\347\001\374\271\203?'\377\374\362g\370\317\304?\353_\215\362"
+	.ascii	"\253P~\365\311\257\272\375*\212_\035\372\325\026~\365\304\257"
+	.ascii	"\332\374j\r\277Z\363\253\032\370\325\021\277*\342W]\370U\026"
+	.ascii	"~u\205_M\341\277\210_E\341W1\370\325\013~\365\277\n\200_\245"
+	.ascii	"\340W%\370\325\230_M\376*\314\257\276\374\027\373\363\006\377"
+	.ascii	"\353\376\2678<<<\374\037\220\201\277\303\001~\277\266\372 <\331"
+	.ascii	"\377+E\215\276R\336\3005(\376\201\332\340\007\017,\351\224\253"
+	.ascii	"\255\360'\3537\360o\301^\300V\353\006\032\035[\326-\bk\373\177"
+	.string	"\241Dy\375\332\251'>E\262&\272\251Iv-\362\360\027J\223#6\"Y\277}7\020\346\240\313\372 \224\355\327\311\333\344\260\206,O\372\252\336\274\277|\377\253\367\356\3013nh\241\221u\226\2522l\0075\311\276L<\374\315\353\362k\201\226\265\bj\222}\361\262\221\f'\301\254\337 \017\177\357\264\322\352\352\262~\355\376-\367\326\251\207L1\325P\326\252\223*\303\276K<\374\245+r\305\206\222\254a\342^\271WI\217Y\220\303\254\363\rU\206\025\200\232d\335\251\207\277qD,\210td\375&\371]!/\034l\306$\313\217\254\325-U\206u\377<\374}CF\355\360qb{\177\274m,[\230\330R\326\031\211\313\303_6\242\237\337\024>#\177\221\374\257\321{\004.\332\233\302\310Z\315\033\363\360\327H\216\2511\254\"\177\327~W\355U\203]\340\210\001\227unK\363\360\267\b\013h\021\"Y\017"
+	.string	"M}\243o\364ES\313\342\244\017L\301"
+	.ascii	"\341 \\\355\027m\017\201@\325A\036J\362%%\3075\3041Z\032\025"
+	.ascii	"\27473\263\367\214\0034V\n\301\307\331\f\020V8-+J9\206\303\350"
+	.ascii	"\210\226d}\020\222\240H9Ol\307\215w\354\r\242\036\3260\325Vv"
+	.ascii	"$kuN\225a)P\223\354+\366k\2467L\373p)\021\313:;\375\360\360\027"
+	.ascii	"H;d\360.\316Z\203\377\355\321\343\375R\317\342#\016p\322C\017"
+	.ascii	"\212sneG\274\376~\265R\270\"bY\277"
+	.string	">\330\037-\033\036\235\024\251\377.\213w\224\345J\326\377\340p\377\357\026\327\313C=\254Ah*=\314:\023\2512l\006j\222\315~\036\376n\231\331\301\005\275X/\326\273\343.q\034\277?\246\256\246\3237\353\357\216\250\270EP\326\257\216\003\342P\362\231\222\213\310\272\234ld\375\017\250\354\377\315\361\342(.\221\276\030|o\024\021B\242\304\211\r\033\257\325]$X\235\2354\353\177P\266\377wJ\215\276S\257\225\333\326\227\204mj\250\365Z\375/\325[\345\272\310\3206\306\223\254%Y\307\224\251I\366\037D\355\027\372\277R/\r\365\260\206\237\0349\262V\323T\031V\0025\311f-\017\177\243\340\224\316\224\020}\324 uK\370\260@A\275N*\036\227OQ\326\377 \336\377\313\244F_\246\327\311\r\212\177\236<\360\2414\305p\n%n\206\\\326\257\323\3776\2751X\274\374\006\2169i\313z\307j\222\375"
+	.string	"\234,-\275IZU\314\364\006\263\376"
+	.string	"\334\266\032}\221\336$\017\334\224\376\246S\270B6@\265\t\217\352J\326\037"
+	.string	"\331~\217\376m\367\276P\017k\200\202\362b*k\025\212*\303\276F\036\376\272 z5=ee]\301\313\202\305K\244\326f6\235A\224\365\007"
+	.string	"\265\377w(\372\016\275DkP\374\023U\302\030\225\226T\037\301\332SZ\361\227\210]\253Ap\305V_\326Y\310\303\337\025I?\206\250e}\017\252\354\377\005z\203T3\017\034j\251\222\265QM\262k\236\207\277@xr\322\327\347\365q\017\201,AM\351e}\017\350\366\357bQ\243.\026\367\220\030\024\377@\225\360C)\f\352J\352\312\320\335r\367\360w\263\270Z\366\024\225G^\022\213\254W+\036\356n9<\204\303\221\265\273\245\312\260j\223\232d\357\001\331\376u\323\335+\277;u\2550\355\031N\263\316PU\206\335\300\320\320\245rbPl\203\254\r\006X\216\032Y\337\203\250\375\273S\246\270T\362Y\274t"
+	.string	"\036Z\322\2718v\002\241}\232\002\303\212K\245P\205\3224`\315JK\313\340\240+\370\223Et\212c\343\313\372\035\004\252Q7\320\025t\203\342\037\247\022\310\224\260\244\205Y\240\270e\355\n\262[\031j\347D\311.\353w\300\266\177\327\357.\340\357\376\271R\242C~\232d\255\336PeX\0315\311\272q\036\356\372m\221{\201\003\n\024\267\357nPL\005v$\f\353"
+	.ascii	"\310\376]'Q\327\211\333\347\006\305TN%p\375\330PB&5!\313\301"
+	.ascii	"\352\350\n\003\273\342\343s\365N\f\212\177\260>\374\b\311\310"
+	.ascii	"\372\035\304\330\277\233w5\352\346\271z\371,\366\241\200m\217"
+	.ascii	"\n\306\232Te\251\350\353\255jH\326\357\240h\377.\223\2728-\303"
+	.ascii	"\264\273;\267\356kP\374\263\243-\216\235@(\376]}\321\310\372"
+	.ascii	"\034\030\356\337\245\213\272tn\035\207\035\013mQ\223\306\261"
+	.ascii	"\023\b\257\024\013\327\340[\022\017\272\254\317\201\223\375\273"
+	.ascii	"sw\227\2745\222'\230\224\265;\304\303\335\271\r\365\372\252r"
+	.ascii	"\225\374n\234+GWC\311\213\254U\250*\303\306\250I6\307U\364\216"
+	.ascii	"\224\262V\243\356\233\333\246\236\305>0\240OW\226i\034;\201\340"
+	.ascii	"\3369)\362\225\3659p\333\277\353\346\266\001\nFU\311\332ecq("
+	.ascii	"!\262\313\372\034\234\355\337]\273\213\344w\215\270G\324\303"
+	.ascii	"\032\372"
+	.string	"\262xAe\235\347T\031\026\0045\311\272j\036\356\256i\252!#_Y\177\220v\267\310\325\303\032\016\265\250\030e\315\022\361p7-\b\206\332\016\264\273D~w\210\033\315\001\003I\225\254U0U\206\245Q\223\254+\304\303]4\343\r\035^lY\317\230\231\271d\231*\336N~\260Ic$'\020V= KVY\237\203\260\375\273e.\231\376\3123\022u\311\b\001}\354(\n\213\272a\356\230\004\342\330\206\023\315\223\336\325t\032#9\201\240\276\240\203\361\304\025\333\203\323\222\3659\350\261\317\201\326\376] \356\017\0336\212\244e\355\202\271/\264\f)\311\372\034\310\330W\243\356\227\353\025\203T\333\024\037w\275t\024\241\242\245\254_\350\366\350\363\303\222\327\203\375\022\272B\207\306u\267\353\337N.\017\365\260\20674\263\025Yg0U\206u\267<\334\345\"\006\361\"\213\2215\007\356\216\250\273C\267p\241,\366\321"
+	.ascii	"\022\022\b\347 i\273YiG-Y-\230`\335\325a\234\301\303\252F\326"
+	.ascii	"\304,\036\356b\021\237\352\246\260\262v\257\334\033j\364u.\216"
+	.ascii	"\227!\217o+\212\324e}\016X\354\253\257cG\240\276\216um\224M\231"
+	.ascii	"e\305Y\335\255q'H\bod\275\376y\270k\225\307l\020\345\250r\251"
+	.ascii	"\260z\030F\247\356R\275\035\342B\013\214\254]h\221jE\225-Y"
+	.ascii	"\2734\326$\343\341\225C4\327\311}\272\013u\027\312\215\332q\034"
+	.ascii	"\373\224\305G\252\017\267\253)X\354\204\344\301\357\316\270\033"
+	.ascii	"e<<\013\024\314\332\225q\300\034Pa\207\377\335\034h'W\225\365"
+	.ascii	"9\370\331\377\325\347\237\215\177\220\3428V\"\226\305H@E\366"
+	.ascii	"W\257\022U\325\203\337\250\256\252\006\377u\034\023\200\314\205"
+	.ascii	"8~bb\025\307\261Jew\261\375\310\300 \376\177\017\342\330G\215"
+	.ascii	"\343\030\211\b\215\312\347\205\b\355'&\032\222\227\364B\204F"
+	.ascii	"\225DT\026O\321\304hV1Q\031\324GC}\3428\366\311qY\034D\225\024"
+	.ascii	"\007A}x\210\312b\244\270\f\352\343\022\007%\271\020\225\375\370"
+	.ascii	"\020\241Q%\251Dh\320$\"4h\322K\034\024\373\304A?S;\b\232Dd\007"
+	.ascii	"Mr!B\373I\"\n\242JR\313\240\261\252\007WF\3453\024\243\375\030"
+	.ascii	"\34386*\333"
+	.string	"\362)\306\361\017R\354\263\227]\304TR\027\261T\254\346\375(\263\212\343\330'\rJ\025\324-\003\212\363\210z@O\f\3051\224\330E\t>\252OY\034\307+b \0375\216\207\312\220\342\030\bZ\203S\034\3071Tm\262\002)6\306A?F@U\320\342\020\020tE\334cJ\215\3438N\"B\253\202zp\213\242m\305@e>*\221\0214\336\212\241P!m4\037u\212\021\r\313\311(\306\361\266p\371\230r\233VAc\241_\325\n\227\351\260\006$wCldM\314\252:\254\222uY\214\323\327\013\2462\026/\207\335]\222\026\f\322\032B\272{t\030'\225\021\264\311\266\304\351\275p\321BK\237\220\254i\260}S04\327\310mQ#\272\202.k\026AB|\264d}\001\360mw\310\025\3721\243\312\326\3024\364C\206\324\035\332[\\ \263\016\226\246\256\246S\267\310%rW\250Qw\310\r\342"
+	.string	"C\321\242Dh\353\013`n_"
+	.string	"j\373w\201\334\23709\034SY\273>\360\017\226\275\247\254/"
+	.string	"\261\375\357C5\352\306'\206\275\225\305\370\332\377\326\362,D\252\n\347\262\336X\242\004\367|\262\276"
+	.string	"\260\366\277\255\250\321}\245\t\026\026lY\357\351\373'X\367\226\365\013U\302\377.\261\312P\n[\326\027\300\324\376\267\341.,\276\300A'\210\006\007\241\021e\210\312\236\242N1]Yq\204\033b\306G\350\327\025\265\213\221\365\3255'/\236\260\330j\342$\335\233!\3553\222n\277\r\205H\352\301o\363\251\204Ql\017#?\251\351\016\334\177[p\017n\300-\335R\324\350\366\333Q\f\311\336\244.\372\033`\331\337\300p\177\003\351\376\006R\3667\350\333\337"
+	.string	"o\177\003\271\375\r\364\362x\250\214\371e\275\363\376\215\267\231\250\2075"
+	.string	"B\005\311\221\265*UeX"
+	.string	"\330y\370\276;\376\360\211\332\221\265\005ut\255T\214\262\033J\276\351\376=\267\227d\237\342:\370\343\007\230\365\033\2532\254\nU\223\354\226\363\360\255\004^\253\323\242\225ur\307\355\267\243'-\304\262&\332o-\2206L\315K\323^V\244\255X;\266\337\332 \373\210\232\347\024\307I\007\220\032\361\271\355$\033N\215\356\267\215\344\233m\267\265`\373\255\375!"
+	.string	"*F|oI\2461\266n\247j\222\375\0066\214\3001\244E\246\262\376\006Qj{\310>\333D\266\331\026\262\3136\332.\262\243;M\215\356\265\275b\023\265b\355\330&S\017\241\3326#2\274\351\324\036\332Gs\3228.[\333M;\310\212\266\005\201\252#\322\275\326\232\265h+\332\326^\003\272\223n\244\315d\005\244\225\"\013bD\2067\235\372^k\225l\241\025m\353\001UK\244k\321^k\223\264q\025T\305\361OT\353eD\2067\335kmY~R\001P\034K=\265bFdx\323\275\326\016i\341V\264-\367\205\020;i\321Z+\227\213*\250\212c\250T\333\303\210\f\017I\244\307`\031\007\375"
+	.string	"\370\355=&\001\322\352\352\307I\326\017"
+	.string	"\335\216\261\241\326\262\255\026\200^H\177l\261\rD\215\356\260\240\035\266el\255\023\206\220\""
+	.string	"\344B\032\266\301n\267\226q\305\261\325\f\226\206Q\230\324TGo,\241\261\365\003@c\177\225\273\222@\315\273\321"
+	.string	"\036kR\035?\244Z{\306\266Q\001\020\021\fsF\2448\036\227\266\205\005D\232\303\0035/m\20561i\034\227m\255\235\365\270\035`\322\255\265oH "
+	.string	"&\243/\260\351\366\261\277\366\326\356\261y\354\256\355\265\271\324\350\326\332;\210\321!S,0\372\032\320\355k"
+	.string	"\267\257\301\332\276\006B\3665"
+	.string	"\262\257A\327\276\006X\373\032L\3250\342#\270w\224\3655@\242\332Ujt[m\251\250\r\005\334\332V{jC+"
+	.ascii	"\"\212\177\254"
+	.string	"D\2703\332a7\215\343\262?*CX\375\f\330\366\277\241\233\006\274e,j\313\246\261\245\216A\264\214\254\262~\006_\373\031l\355g\200c?\003\252\275\241\210E\212\352Vd\275\235<|?\t\3350R\312\272\0035\311>\003\031\373\0314m\030\357\236\227\026!Y?\003\237\275\264\225\216<\240@\267v\322\267R^\301\"/\360\312~\241s\2209\315e}\f\234l\027\333\350%\324\202\307\266[|\033\345'\252\224!\247\032Y\277p\263\250\252\241d\263\330EU\252\322v\321^\261\211\210b\032TJsYc`\267\217A\334\016\212\363\337X\214h\326\307`\373\354\0375\272\201Z\273\240\r\324\316\265uj^\332\nA\214l\240\366\256=\f\264\"\215\343\230\303\007\037\250Q\271-\204\254\226\266Y\240lmi\265\354X\215\266\207o\017[\274\266\317\306t\353\260}\322\006\252yi.xI\221\306q\374\201\004\037|"
+	.string	"\033\325\210\362\331\372J\213E\215\266YZ+T\332i\005@D.Pa\223fi\007\333)\025"
+	.string	"\021\271\220\244N\272\341r$\301\301\352c06\255R\304\326\365\244\2605|\231\234\362\222d}\f\270v\341\325\027\\BuY\037\203\033\373j\364\200-\341\003\261\354\232\306\262>\006U\373\030\314\330\307\300i\267\201-\224\366\317O\032\3071`+\250F\333\300VJ\033\230\003\351\376\244G\255\256\2601V\037\003\243\255\277\202\210\334e\335\372\265Q\214\201Qq=\262>\006?\373\027`\331\277\240J\333\244u\242F\333\276\226\257\355k\231\264{\025"
+	.string	"\021\275 \025(m\373r \2345e\313\225\326\352\215,\007\253\177\201\221\375\267{zODG\262\020\22585\311j\363Z;\330\217E\034\230\365/\030\262\177\201\330\376\005]\373\027\\-i\351\220D\250\202\200e\375\013\242\226\\\300\264\177A\322\376\005,v\334\263\f\265UJb\366\226\365/"
+	.string	"\332oKQD\210\262>"
+	.string	"\002\367\t\020m\213\\\255\261\265nj\264mk\325\322\332\266v\255E\262\264\201\025!\206NS\243\332\024K\023\253\215\264G\220-\262V`m\031\001@\215}"
+	.string	" \021i\323\262\322\220\034"
+	.ascii	"\b\"\242e\337\002\277}\326\nQ\371\f\257\024e}\013\352\316,x\333"
+	.ascii	"\267 m\337\202\260}\013\2766\013\246\312\260\177\242&\3316\354"
+	.ascii	"l93\031\224\232f}\013\266\366-h\332\227\266_^{,\310\2251\257"
+	.ascii	"\347\264\252\030P6\037m\017\277\032H\204\262n{\374+\340:\247"
+	.ascii	"\022\326\240\244\204J+kU\315\303\333.mex\304\203\007\327\032"
+	.ascii	"\326\347G\306\225}\212\3070\246\025?[Z\233\355'\317\310*\330"
+	.ascii	"\344u\324\356h\263\252\240\3045\332\254"
+	.string	"\270\275-=\234\350\300j\373\271!\224u\216b\023(*nY\337\202\242\375\2678\332*\275)\303\034Y\177\225\233\221\026\265$\310\326:\2472!#"
+	.string	"\r \322\033m\215\326F{\325R\265S\255\225\032m\253Z\350u\334\232\344*q)?\001\211\265U\255\024\017,\251\373b\310\017\220\213~\005Y\366+\b\334\257`o\277\002\273\375\n\346\366\337\312h\227Z\250\326\351\354\216/-\353\253bI\323\2558.{jc\264Mj\264uj\225\326\027\202R\247\365\253eR\363\322V\240\013\\\221\f\032\021\262u\013\243\207\236\241a\326\257 m\267K\025\200\355W`\265\377\026\251=2:\021\345X\322\272h_\264Fj\264=\372^\224-\275\365\205\337V\034\227\265G,\337\372\342\b\220\327\334\376\333\361\247\267\365\337\266hW"
+	.string	"A\201`\311\372\004\b\372kW\264?C"
+	.string	"\245@N\244l\265CmQK\324\262P\243\355\212V\350\271]\321\372\334\361\355y\021\327d\304/^}\n\016\367)"
+	.ascii	"\334\247\340m\237\002\256}\n\\\354\277\215\2674\341\202\273\221"
+	.ascii	"\265\225\250\255CV\213\032e\267\374\353\023\233\345\231\335\302"
+	.ascii	"ba\257\034\177\\\342\270j\306V\216r\272z\301j}\270\331+\271H"
+	.ascii	"\205\232\341@\003\314\372\023\030\356\237\235N\001\2751\311\332"
+	.ascii	"Oo}\221t\002\227\020\257\271\351\237\020\257\271i\023\266\257"
+	.ascii	"H\ne\212\327\3344\216\313\002Y?68\257\271)\037\213\255\275\365"
+	.ascii	"E\213\255<\027\201l\224\374d\213\224\255\302\016\262\204l!\013"
+	.ascii	"\310Ra\005\331)\254\241\032\235b\245d\252@\366\t\333\247\346"
+	.ascii	"\245\305?J\033p\001y\315Eq\"\215\316\350u\202\265\375\t\310\366"
+	.ascii	"'\360\261?\201\215\375\t\234\036\307:QRH\243-\353O`\264/A\226"
+	.ascii	"}\t\376\366%\230\333\227@\310\276\004=\366\3172a\361\334>@\030"
+	.ascii	"+t\334\024\"V\356\354D\200\313\262\2215kw\266\f\215\241\214\330"
+	.ascii	"\250\243+\022\361\210\306\254\222\263t?;\307.Q\017\325%\361\217"
+	.ascii	"\027Yk\"U\206\275\231\232d\327'\017g\225\004\311+\\\223c\343"
+	.ascii	"\334;\261\266@6\356*a\r4F#9\202X%\201\303#\312q\307v\026\216"
+	.ascii	"}\3130\222\256\212\260o\254[\206\252U\211\323\222\365\021\266"
+	.ascii	"\315\230\343\t\023\031Y_\202\031\373\203\207\263lI\246\254 9"
+	.ascii	"r\2045\302\256\255>^\020\372\t\325@\333SS\201\b\253@\213\260"
+	.ascii	"iD3\"C\265(KD-R\314\301\264\304$kWM\262j\230\207\263Q$\037[\341"
+	.ascii	"\216!\304;\226\205\2244\016-C\2152\242TR\204H\255"
+	.string	"V\206\314\350:[\301X3\266\314\212\330\336\\\326d\360Z\341Q\216\254/\001\213\375\265\212N\312\006a\305\33005\312\216\261@\306X\036\254\217\325\fi#\021\262d\214\365b\177$\340\347o\n\206\034\262\213R\331\372\034\246\373g\177\260`s/\352\260\330b\250\265$K\330\257\265\254(U\203\003`\027\333\343h\330\242PI\326\3470\327\305\201m\377,\027\273%mj2\2305\r\016\304\270!PCZ\354\016\262\267+\256\254\331\035\3172Th\020R\214\031l\026\233\304\352`\261\320\244\204\021\311:\007\235\026\030NY\237C\221\375\237\275bm\2607\324(\213\203\265\252R\341\216k\034K\001\331\212c\264\023\200\305\301\326P\341\324<'\024\344\304T1\026\007K\225}\336\253\256*\036\037\030\363\236\302dl}\016Q\373\034b\354sH\332\347P\264\177v\n\312\264\342\372\2215\215W\312\022 ZY\237Fp\237"
+	.ascii	"0\330\246c\220K\034T\205\267\305\316 \356\220\301B\261Ol\024"
+	.ascii	"+\245F\331\031l\f'\266\251\312\217\235\301\"\261KUQ\244\354\f"
+	.ascii	"bV\276S\363\234\342\237\037\022\306\342\276$\254\020\031|G\212"
+	.ascii	"\3724}\3734F6\313\004\205\022\362\223\365i\320\366i\306X\245"
+	.ascii	"\234\205\311\023\256\254O\303\265\223h\256\366\317\036\261/\330"
+	.ascii	"\027.X\2431(=\303\254\177\266\210m\221}\212\033\fz\344+kc\231"
+	.ascii	"*\303\252sj\222e\211<\234-*N\201\202\366#\353\t\330\025\254\020"
+	.ascii	"\236\032\341X\326W\313\210\207\354\020\033\304\002\251QV\210"
+	.ascii	"\375\271"
+	.string	"\032\347'\033|\235M1\234\262B\254O\030Q\211\225\031\330\326\247y\332\2479\332\237\301\262?\303\267\177\342\026\242\026\263\243\245\036Y\023\265\374\304,\272\354\203\021\216\253\254a5\311\022\267<\234\210\005\214\b\013\220+Vz\254\025ze=\325\355\033\234\324E\326\237\221\333'\200\224H\2058\205XH\254\242F\211\206\304A#\2023\326*\302\263\035\203\\\342\026@R[b\206\304\300\263\251yi\261\220Y\b]oS\f\247q\034\347;(<\243W\177\346k\177&\307\376\314\324\376\314\214\375\231\246\375\023\001\245 \371\001\026F\224\"\225Y'mAw\304?\242_a\026\221\272\254\243\374T\005qe\375\231\025\373\t\021\t1o5C\222\001(\213\023b\037\021\212\032%>!\352\235\270G\344{B4\242e%zBl\262E\372\301\353\307w\305\306\326\2271\334,T\225a\337D\346\t1\357_\211\210G\210L\262"
+	.string	"jh\251\2225\036\273\004I\372$\353\313$\331uD:\342\034Q\t\321\216\270D\215\022\357\210q\304\273U\b\021\016H\212Tn\312&(\275#&\371\223\026i\013$\336\021\335\024\360\3667\005\213\3432\016\310\276*iK\216\3722V\3732I\3732A\233\370\246\242\021\301\201%\353\307"
+	.ascii	"\356\307\324\355\307\024\331\217\341\261"
+	.string	"\037cc\263\261*\303>\006iM-.\tp0kb\032\261\210\032%\252\305F\270F[\332O\326)\3428\216\325\307\261\355\343\330\237H$\n5U\203E\326\304\350\321\\$7rH\263\316d\036N\034\202\002\226\025\020\"\032Q\bX\336\317\224\254\317\312\214Z\322\243\033Y?iH,#\222\251Q\242\031q\214\030\204\t\321l\375\332\323\222\"\247x8ab\365\223\203\373I%baqE\224\370d\r\004y\347\304\350G\326O\016\3317!+\337\255e[\273\005P\226t\207\216\034bR\256\\\024d+\216\313z\020q\344\"!cR/\242\017\342\027\261\213\310\203\370\203\b\246F\211=\210Z'n\351\2565\254\037[\304\036D\035_?aP\3238.[\217\340\tEq\321O2\355WM\262O\002\355\303L\331\207\001\334\207\241\333\207A\333\207\351\261\017S\265\177\342\r\342\225\020C\262\031Y\333\310\036d\355"
+	.string	"\314\3720F\373\004X\222\213"
+	.ascii	"\267\252\2105\324(\321\212HE\264R\231\304?>'\214\355iI9|PlR\223"
+	.ascii	"\302\302\352\277\350MAI\204\305jY\323x\227\360\r\301\310\372"
+	.ascii	"/I\366U1\"\f)R\"\024\221)\312\222,\003\310o\213\b\2452YQ\365"
+	.ascii	"'%:\021\237\210RD\031\304\031\304(5J\204\"6u-\345'@]F\204\"\306"
+	.ascii	"\310O$\214\355aI\247m\220$*zG\375\227\032\373/N\373/D\373/>\373"
+	.ascii	".Y\366OT\"&9\331`\332\313\232\230\224}\212\3208\016\":!\311S"
+	.ascii	"\2225\361\310\303\211H\306\271+i\326\027\274 \272 *{\201\343"
+	.ascii	"\316\004\0013\321h#i!\315\372.\201\373'\266 \262`\323bE-\353"
+	.ascii	"\242\246\033Z\260\262\276\013\336&\256 \016e\251cPY\234\324\262"
+	.ascii	"\275\331P\232\022\211\324(q\005QHs0VA\213\324\264\276\013\327"
+	.ascii	"\276\313"
+	.ascii	"\324\376\211AD\240>\033A\360\262\376\211?'\002]=\254!\216\215"
+	.ascii	"\2704`\310\330\313\232\350\343\341\304\037v\213\225\026iY#\211"
+	.ascii	"\261>$B\261\362\204"
+	.string	"\244\017\325\303\235\327\207\305\265EK\217\027E\334\262\3162\202X\312\227\365]\232\366\325\262\260\277\2553\273\354\007\026\270\345\327\343J\246\"\303\333\362\373\022\334R3\362#?\251yN(\200\001J\005\365T\333\351Am\250\255h*\232\211\306\242\357t\236\376\323Ut\240\276\242\3654\241\336\323R\355DK\321Qt\241\356\323M4\237\366\323\200\372\211\306\323P\324\250\236\242\347\256\227h\272g\264\354\3475\225F\347\244\331\257\016\213\331]\227\233JHfBZ\246\n\242\0222\321e\277\2076\315\226Vd\212N\242\225\034\3278\266\022\333*\362\026d\313\303\332\232\224\b\233\331\357\301\210\332\326\021\315VDn\310\022\265\310\237\251\204\324I\257\374\231j,\212\024\210\224-8=E\213\371\371\351)\332\207J\330j)Q\301\230\252}V\206b4@\037\351d\347<U\206\r\201nk%im\327\341\013\302\254u\234\207k9"
+	.ascii	"\034\211s\313\272U\223\354\221I\366\221g\373\310\255}d\215}d"
+	.ascii	"\320\326Ht\323]\215\035Y\377\230e\377\310\267\177t\333?\372\330"
+	.ascii	"?\336\330?F\355\037\223\366\217-\366\217?\373F+\373\306(\373"
+	.ascii	"F\267}\343\217}\243\215\3759U\206\275\361i\337\030\357\027\251"
+	.ascii	"\354\027\241\354\027\347\366\213g\373E\257\375\242\325~\221\305"
+	.ascii	">\374\267\017\303\355\303a\373m\232\207\346*|\002\365$\353\255"
+	.ascii	"2\343\237\023\214\254\255w\250Xt\326\321\247,\366a\211\fve\231"
+	.ascii	"j-5\252wh\254 xH\330\237\r\255u\326\237\205\362\3201\317\313"
+	.ascii	"\253/\353L\345\341Z\007\022i\330Q\326\207i\354_\347\3208\230"
+	.ascii	"\222\344d\224\031\321r\310U\230o\\\021\347\232"
+	.string	"\250Yi\272\276\372u\f\355\244m\024\241Rh\226\266\254u\215\0319\200\242Y\037n\332'\300S\366\201\021\205\303\232\241i\360\030Ac\230\027CpYR]\245\255\364\224\206\252QM\365g?-#HCe\037\270\034[T*\226\354s\302\020R\0344$\351\003\037>W\323L\003L\312\340\253\177MCK\351\256\026Q=\035u-\265\177X\021[\313\372\205\031\372\337-N\323\242F\262>\234\2643,\264\017\307\373i.\223\207\353&w\005\321\025\244\254\003\240&Y\275\264utD.\227!\3416\251\"0\224\232\236\374\205i$}\244Fu\222~\241]\214m\305q\231N\312\177D\314\276\2244\220\220(v\254\376K\267\377\312\355_\033\351\026/\217\2745*DE\232\005\022\251\211\240\216\254]bU\206\315\261\232d\365\n\017\327DE\026,\270\250d\255\036\352!\017\214V\372\200\300\264P\026\244\242-_Y\237"
+	.ascii	"U\216\254r\203uS\226\254s\204t\271\214\312\334V!\333\232e\225"
+	.ascii	"\262\n\252yN\272\307\235\324P%<\256q,\205d\313\212E\003i\037"
+	.ascii	"\375\243\343\365p\325\242\203\324\350\232e\235~\265\262^\271"
+	.ascii	"\232d\315\262J\327?\263\256,`q\\\366\301J\007C\310a\214\276T"
+	.ascii	"\225a\217j\222\375\253\265\377\322\330\177]\354\277?\373.\341"
+	.ascii	"\276k\267\357\"\331w\277\366\335\033\373_\003\277\n\376\353\337"
+	.ascii	"*\307\022\005Q\365\310z\005\364\3605\020J\222\033S\326D5\311"
+	.ascii	"\336u\332\254\237\004\355\227\033\r\033Q\354\210B\350\200\374"
+	.ascii	"@"
+	.string	"Y\233\f\356\271\310\372\353\334\022\247\2555\272h\330\321\326\332d\205\3132\326\262\266=\024&c+\216c'\253\336\312\267>Y\373\326=5\2726Y\231|\315[\253\256W9%*a\033\347\305\310\027\321\260&k\335\212\327\376@\343\027\030\321\260\027I\326&k\234J\310\347\326A\327\324\325t\032\307e\037\264tThjG]T\223\3547\240\335z\347\242e\311\222f\375\255g\267\353\366\367\333\376V\333\036\214m\022\266\366\t\252\f\373]c\377\353\233\333\236\013;\2676\351U\225\276\254\331\334\302\263,K\262\376v\332ST\353\326\tCH\017\020\022\265>A\255\320\023\206\220\334#!4\272V/\276#\036Yj5C\332D\204<\255D+\332*\244\nK\032\266\222\2350\204\344.\001\031\265X\235\370n\254Eh+\213\003\2360\204\344\016\361\341\220\306q\031\332\372\265\002Y\315\220\266\032\320\213\025m\345Z\267*"
+	.ascii	"\"\212c%\017\272\312\016\r\247\253\332JdM[\217\254H\326!\353"
+	.ascii	"\332jd\215\256E\324\350\212\266\226}5[\317\326\"+ \350\214~+"
+	.ascii	"\335l\231*\303\036\212\232d\337\362\355\177%\013\222f&\305\257"
+	.ascii	",\346\361\204MK\215\256c\253XY\314\201\r\302w\203.\353\267o\373"
+	.ascii	"\355\332\372#FVqA\245/\353\267e+X\330\352#.\366P:\332\221\365"
+	.ascii	"\333\254\265G[c\277\235\261\337.m\255\355\323\366\227\226\365"
+	.ascii	"\333\241}U\314F\226R\363\322V\020\243\223\306q\231\007\253\265"
+	.ascii	"\306\321\215c\252\272\2558\326\373\277b\255Y\353\2165\207\032"
+	.ascii	"]u\2547V\035+\216\265\206\232\227\266\002\236\2354\216\365V\035"
+	.ascii	"\353Ufj\327\220\252@M\265 \027\331\221W\237\315\333g\341\366"
+	.ascii	"Y#\373,\221\235\207To\3245\301\222\365\331\263\375<U\206=\373"
+	.ascii	"c\223 \265\322\210\322Bpp7\262>\013\225\212b\367\306\002_yZY"
+	.ascii	"\177\006\262)S\222\203|/\334z\260\370\311\3723\360H\n&\005\223"
+	.ascii	"\036\336l(\201\251u~\205/\222\322'\007\003\371\310\372\240\\"
+	.ascii	"\375\375%\001\325\263\370H\304\031\226\024\f\211\244(lJ\312\223"
+	.ascii	"\200X\f\325|\314\300\224|\222|\222\214\322#\304k.\017\372a\241"
+	.ascii	"Ay2\n\025\245\035G\262~!\315!\326\nB&L\222Ndl\025"
+	.string	"\207D\203\0305y\322I!\264\217\006\337\177w\002\247+%|\311=\036f9\236\362\222z\353`\324\222\274\274<6%J\222w\352Y|\344\024\3425\007\266FY\321M%\355\236\274\323\242\327\344G\035\261\313I\313_\035\335\022\252\273\271\344\022\365O\312\324blN\002:\222q\311\270\0368\257\271\343\214\262\257\275\254/\201\027I#I#I8\325\245\f\350I\024\262\351J!\221\267'\341\216J\366x\354e\235t\323KKD\244\264\2551\332\206\230\265=\311F\245\355\357H\022\3111M\013\320\224\254/\001\237#\205I!I!I5\016S\370\274\3466@\307\006\245\310\223jn\206O\212d\235L{\237\360\351\265H\022\201\245\200\fy$\211$\243%\304\242xY'\207\260PeQ1\262~\b\276$\332\233\231Y2,\346\n\020\274\253\251\254\037bH\222,I\226\374\252\200\220\t\013\311\rb\304\202,\353\207"
+	.string	"K\216%\307l`\302B\002\373\343\341w\225\365CP\375\370\221\f\213\311\302\204\2054=\222\215UQ\002\362d\330\030\016\244\255\020H^^\311/*LXH\323\026\211t\216\305\027\024F\f\274i\326\217\300\226\244VR+\331\203\214j\212\341\024n\323\022\347\350z\262G tF\241\225\254\223<\036'\350\345B\215\353\277\233\364\372\"Jr%\267Z\250.;A\037\253\026uY?\002\203I\254$V2\213l\n\246\212I)\351x2\253O\360)*\002Q\222W\311\253$\0167\302)\206S\370\310]\226+7\236\304q6x\311\022\266\254\b\274%k$k\270"
+	.ascii	"m0\3666\305\360+Jn\016\215\212*"
+	.string	"Y\305a\307cUlR76\342Q\225\254\362\3417\306\265CJ*\t\255BB\234\2022\205\007\215'\241N\260\304\232f\314\200\3458\354xL\b\2314\212E\316+\353G\200\310\311)\tE\202\032\257 \"\304\210\024&\004\324\362\221|z\022*\t#\312\231\025\2214\351OJ6q\200\372\030\262Y\230\f\245\323\f5\005/G\222\351\311\246-C\203kY\2770\t\343\277K\202\037\326\216\254\223K9F\013\036JY_\206\265\244\222\fh\311\025O\026%W$\217\200\300uo\337\214\0356\222FO\036=\371\342\203\t\257\323.\204\200<e\375\244\213d\213$\213$\221\fbI\240$PRHub\302B\002S\235\004\r\"%\203\236\024\032\0033\204!\203V\322'\351\003c\203i\021\231\001\335\362o\2019\344"
+	.string	"\365\031\024A\211\t\013i\032\345\265E\005s\230\231\320\316\364\220\262\276\fK\323)L\026\013`0\221I T\005\n\226\303d)a\f\bV\3260W\036W\2454c+k\030+\031\312\346\265\245\3452\274\200\231r\030C\230)/H\372*\t\223\r\302iUS\222\225\254a\n\251\3100\004\b\b3\270DIKj\224\373\261\202\013Fz\230\301)\224,G\3260\202\331\247uAC\207R\326/\204\t\004\222\342\342+\320x\005\204weF\326\217\301\020\246\017\246\017\346\017\356\355o:\325\200g\203\205O\016\363\007\343\267e5]\001\343\007\023\305\316H\013'x\305\032[\226\bB!\306Q"
+	.ascii	"Ht\204\216\311\317\004\246\t\007\250\317 \tu?\177S\366\b\225"
+	.ascii	"\256-\230\274\3034\201\3413b#\013T\3260{0 \226[\215\254\037\003"
+	.ascii	"\033\214^\fa0p\207\221\203\201\203\271[\261\374\005\331B\332"
+	.ascii	")\261E\315\035\346\3560v\037L\310P8\211J\227Z\3260utK\224\300"
+	.ascii	"\304\301$\351\221v\0305\2304\0307)\2321\030\204[T\351\025\216"
+	.ascii	"#0G\016\343v\230\266\017&d(2\013!\333\225\254\017\303\266\246"
+	.ascii	"%\tD\2225\f\022\027\272\037#\034hY\277\203\226\033F\226\262\206"
+	.ascii	"1\362\226a\321\025\035e\r\263\346\"\303\251\312\217\306\323\265"
+	.ascii	"\260\264\260\310\032\246H\fXf7\203\211\222\240\306+\326\204v"
+	.ascii	"H]\267\263!\351\331a\242C\b\203\\a2\004\006\215E{\332R\204,\316"
+	.ascii	"D\362\236\236`\204\260@\214 \221\002\022C\213\257/\0302\016P"
+	.ascii	"\237A\024\224\254A\f\341\360\202\034\206\214\375\221\343\207"
+	.ascii	"\221\217\254a\306\210pm\025+&]Y\303\210\261>\340!VH\272\262\206"
+	.ascii	"\t[\2418\374\200\020e\r\003\344\200AV\\uY\303\374\310RbRoK\262"
+	.ascii	"\206\001[\201\250X\332\372\212\274\326(\016'A\262\360\340\001"
+	.ascii	"\343\343\006\021\207\332\2176\230\036\207\361\241}\204\356\264"
+	.ascii	"d\r\323\305\376\370s\261\365\264\002i\225\224\264%\005ba\301"
+	.ascii	"l\251.e@Nrl\025\211\276\320:\314\326\261jMp+k\230\035\354\217"
+	.ascii	"\266\317hn*k\030\0350Y0Z\330\301d\275_<\202\234\204\350\254\254"
+	.ascii	"`p\250g\361\321\004\220\016\r\301\220N\204H\201\273q\030\034"
+	.ascii	"CzXI\262\206\271b\177\274C\204\2608\314\032\246\006\214\rx\312"
+	.ascii	"\222 \024\306\306\273\003\n\313p\t\ff0Q0Q0Tu{\177S#\f!;n\300"
+	.ascii	"L\035\206J\310F\231T\3260P\366G\326\272\301&\315\032\206\006"
+	.ascii	"\373c\307\235 \215\254a\244\336\034l\020\337\220%Y\277\360\315"
+	.ascii	"\001wG\365#\353\303\240\005\323\004\323\004#\243-\262T\305cm"
+	.ascii	"\352\303'\306ad\300@\025\3012\330\005u\230'\245i\013\0379\206"
+	.ascii	"\270\216\256`\234X\253\237),~l\223\021\f\320\311S\326\207\001"
+	.ascii	"\232\224\004\003\243\202,Ld+\232\227\240\331\322a`\254viC\207"
+	.ascii	"Y\303(\235mJ\252\004U\005\306\005\214\013\230\243\0308\036\177"
+	.ascii	"\323i~B\022\344\007\363\3420GhM\262|\262~!\021\356\277\373\""
+	.ascii	"\344\243\245\007\023\037\006\b&\206i\261\356\001\021I\177\370"
+	.ascii	"y%\311\372\207\031:L\213\303\260\370`\302\343\214@\331\272\221"
+	.ascii	"5L\021\f\021\314\n\030\241\013\026\351\334\2462\262\206\t\202"
+	.ascii	"\371\201\361\241{)"
+	.string	"\374K\225\227\302\227-k\037\026\330\254\205\231\336\225\277l\371\213\226\r\346\325\227\005\213\225\003\346\036\200F\203Y\277L\r\341\244\177\231\"u\221\262\026\272\304@q\274\245\306+\210\b\221I\317\376|\240e\375B\3702\270\326\344/}M^\002\221s\034\244^\267*pR\245(\177\t\374\013\340\007\0232\224\354\007\225\244\254_\244\274\374\275\370\275@\311P=\032UAY\277<q\002\001!/y/y/{\034\240>\204%0)\373#T\373\312\233\362\242\367\227\275\342\024\215\031Q7\324\264+dLabv\177\271\263{\301#\256\305\361\006\222\364\207\367\202\247a\024\351\212\002\201\253\027\271\277(y\221{\241#\036\211\177\254\360x\322zY\362\027\272\241\245>\267\254_\346^\347\326\346CG\035\033$M\207\025\004Z\264\265\275$\361b\352\202\362BRt\007\367\227$*\213\035D\330\262~ys\223\256\255\275 \341"
+	.string	"\365)d\201\024"
+	.string	"\n\360\360\310_\220\254MwFzd\375b\244n\310\207\274\024Q\317\342#\026\214\251\013\nL\037\331Q\347\"\355/E^? EZY\277\020\241\341\255\3170\353\227\350\313\330+\005j\002DN\212\234\220\254\377"
+	.string	"3 @^\204D\261bL]PS3\027dPd\177y9\353q\304\365\226\365\213\331\361\210\220\240\225\254\377\200\247\375R\366\022D%$2q!\3672\366\337\035\341\304\217\311\313\330\213\330\026\324\024-\256X\3346\001]Q\362\022\246_D)\351 \313\372\017\020z\361\361\227\027\037/`D#/\235\317T\332\313\327_\300\n\301\334\260d\375\002\340~\351z\351\202\345\334~\246\030Nw\034aC\222\204\213K\004LXH`V\\JN\262\376\013bZ\277V\321M=\213\217d\240\230\260\220\2460]\234\022\277\254\377\302QV\026,\247\262\371te\231&!\362\212\312\372/"
+	.string	"M\375\305j\352\005\013\031$\325~\34581'\266\253\277`\375%\307\007\023\016X|\2022\343'\353\027\0347^l\\\360\230\245E*+\353\227\032\217+:=\231^\275TQe\231\361\027\0323^\220\264\21573\301/&Y\277HEQyQ\372\013\323\213\322\013\0242\215\306\004L\214G\240~@_\232\376\002\365\227\247\017&\2709\214/\342\250\f\263~qz\211\361\002c\t\360\245\305_^\274\264xA\322Tg\361\221\214\030\223\rB\246xH\221\254\377\227\243\277 \3752j$\005\275\270x1r\301\255\250\210"
+	.string	"\\]YZ+Qd+\320V\254p\275\324\263\370\350\335\302T\025\244\210\303HT\217\254\357\002\224\220\0202N=\213\217.\260\3677\005\203\032\302$J\345\005\350\005H\002oS\f\301\264\331\336\017)\337\213\317\377\342\003\313\371m\305\261\223\007\333\316\n\021\217\265\303CX\356\r\006\0261\025\210.\313W\326w"
+	.string	"\325\224\273\024Nq\321\262\362\251e\261\023\324g\360"
+	.ascii	"_0\b\267\264\020\244\2521\275\213\226\273d\371`\302\001ulD\243"
+	.ascii	"Y\273`\271b\245\312\001\263\2137\037QY\273\030^\320h\304\354"
+	.ascii	"\306\f*\016\220\021\030\3502\250\236\305G\0228\301\250\262\005"
+	.ascii	"\346\233\342w$\275\313\340\f$\206Y\273\b>N"
+	.ascii	"\365\341\226C\212\241\336]\232\350\271HY\2474 6\212}\\\312\200"
+	.ascii	"\370\246[\357\221\0374\237'w\221r\227\277\035u\203EX\326.~Q\240"
+	.ascii	"\270\364e\237\"Dx<e\355\342\304\205o\317/\311]\224$qa\202\274"
+	.ascii	"\261\004\206a\222#\330\033S\323\222\2730\271\013\336\007\023"
+	.ascii	"\036W$\n\013)Y\273\334]\3051%J\224\365]\354\\.)F\266d\355R'B"
+	.ascii	"\324\225\251,Y\337\205\356\306^\226\217\254\263\3728\326e.\373"
+	.ascii	"\3008\206\3009\311\305\021acsy{[\323\230\250\016\335\356\362"
+	.ascii	"\366\353\"\2607\"Y\273\264e(X\013\265)a\321\273\024\211\272\034"
+	.ascii	"\271\032\307\361\214\266\253hT\224\367C\355.G\356b\344\203\t"
+	.ascii	"\217\003\302$Hp\315%\315X8\350E\225\265\013\021/ w\t\002\304"
+	.ascii	"\005\r\271\245\306\261S\f\024\024KI!\357`\020ni\321\260Py*\273"
+	.ascii	"\013\332]\204|0!C\333\253&kA\262v9\373\321\351\356MjF\226}\234"
+	.ascii	"\234\335\031\031\203\203\304\r\361e\355\"\246\332x\221\267\027"
+	.ascii	"\366\273\305A\035M9\262~\013P\373-,\365\270\213W\017\0270b\220"
+	.ascii	"\265)\212G\367u\0270?B\037\240\254\017k\005\261b\222\265\213"
+	.ascii	"\217\026\342\035w\331\332\341\302\2038\026\307@$\224\001A\211"
+	.ascii	"\211\234<h\r\251\\9\341\272\013\017\"\257\350\227\213\226\373"
+	.ascii	"&U\203*\353\267j}2\266\004\251\250\\tp\200\372\024\266r0\002"
+	.ascii	"\345X)@E[Ww\321q\027\254\017&<\016I\004I\317)\353\273\344P\207"
+	.ascii	"\270\302\246\262v\271\341\202c\017E\321\002c\341H\007.\334\023"
+	.ascii	"\340\241\213\215\003\006\005!\213\312\332\305\312\245\306\013"
+	.ascii	"\207\307B\257\206\033\225\204\366\327\226\265K\325\331\322]b"
+	.ascii	",\271@q\300p0\376\274\2461\221\223\007\310%7\264\374f\334\005"
+	.ascii	"z\027\032\037L\270\035\364J`\\\326w\211r\221\372\335\267\253"
+	.ascii	"\006\332W\326g\241j_\204\263\246\244\244\254]\240\\d\260l@ML"
+	.ascii	"\331'~\241@\255\250\222\265\213\223\313\023\327\020\335\024\t"
+	.ascii	"J\030\226#\027\246\2734\375\256\253\264BKj\377.0\252\204\332"
+	.ascii	"\262>\013M\373,\034\035\035\271$-\331z\241x\374\334@\272K\022"
+	.ascii	"\234\343i\216G\326/tiaw\005\b+\353\263\020\257\370\n\027\027"
+	.ascii	"\034\240\253\2249)0\227\254\211\020'Fwqa\346\247\004\232\265"
+	.ascii	"\013\221K\013\036O\242O.-\\X0\371\004\001\211\215U~G/\\\212\362"
+	.ascii	"\216\025XLfR!!\027\240\257A\261\324\226\255?\271\"&Y\177\005"
+	.ascii	"9\227\037"
+	.string	"\227\037\027 \016P\237\301\r\270\314\272\262\220\261\365A\263v\001R\t\243$\201\215e\375\025z\354\037\371\004\371\304%\306`\013\214\275,.\354YIe\375\273\304\310C\300\030\201Y\262\336\342\246\rm\201e\375\025\220\366M\220\322B9`\005@D.x\205I\263\337_\026\030dI\246P\326\244HC\244\025d\025$\026\344\025\244\026$\025d\026d\241\032EN\221\204Q\362\0235\317\t\005\036jS<8\301 K2EN\3270\344`\005@D/H\001AN\221\200S\030dI>\370`c\301\r9\212\321\007\001e\037\004\335\376\221\203H\351\220\025\325\317\221\355E\320\025\244 2pK\217\275\031Y\037Dt\037\204\331>\b\261}\020_\373 x\354\203\310\261\017\002\272\017\002\311\211\023\262\366kF\020#\203||bG\036M\222T\241\323\323\373\241\322`\253a\343\214\t\023\344\035\007\227\262\370j\307V\034\317"
+	.string	"\2415\303r\322\222\365U\300\332?\262\016Y\207\274\343p\026\373\034\237\350X\021\304\315!%-\312D\344\276\330X \355\262OQ\213\237\034\226\254\257\302\022R\tR\tr\t\223\261\255\330i\206\007\032\211\234\227\330\334\221Kz\210\bN\251\320\002\t\207\204C\306M\231\272\232\202\351\230\017\006\222$G\306\331\220\341#\226\365\013\331\037y\206*\374\270\271\301rz t1\203\034\315\250\302\306\246\245"
+	.ascii	"p8(=rDKQ\200\305,\205(kkF$C\n\226\370\024\371n\210\275\220#B"
+	.ascii	"\004Y\204+\351j"
+	.string	"\n\266N1\022%K\332\221E\004\331\250\266\275%3\344\031\362\f9\344\307\324\325\024\f\211v\344\220@\230J/G\\\326H!\260\025\021,gVR\360\201\034C\216!\313\340\270\256\246H\262#\313\036\210<\212\243,\311\032\031\204\203\036\237\216,\343\270EE\207O\326O\001\013\371\003\371\003\031V\205\215\032\204\267\bN\331\313\372G\00292\f\020\0262\205l,\005'\037\310/\037\260\234\227\027,\327\201\226\251\024X\3547\240\220\013\331\305\305\203G\273$\251\001\201\373\r\310\323\201\334\241\003\251\205\324\312\312rc5F\342\340\313\255\001I\366\033`v\205\304q\205\314\221\343\306\r\n\340\270|\3547\200\n\tU\243H(\262\006\fR\034_\231u\300\224\344\266(B\3438H]\023\352\312BZ\375\310)$\025\262\252\b\205\222\203\321\"k\026-\364\270\342\262\206\201\252I\366\r8BJ!\245`\271\016\352\364\032"
+	.string	"\264\177\344\f\344\f\267\215\0034N\322\340HQ\352\n*\227\365\0310\b\005\025\226T\307\204\214\301\204trjj\362\341\326\266\317\200 \310%\344\022,\327\001\234\331\325\013$\322\013dR\022\362\by\244\245\266\317\0177\0068\3553\340\007Y\204l\201,B\032!\215\220,\220,\264\224\006_S\366\027p'\204\\!\204\034B\016i\251\355\003[Y\300\333\376\002\312\220>H \244\217\226B\376 \177\264\324]~\340\245\244\005d\355/`i\377\307C5z<\334t\036\202\342\037\035\254\322\221\240\034\034\247\327\364e\247EK.\362"
+	.string	"\372\363\263\301\224%\257\271i\034\317\201\240\367\372\346bd}\005\b\331\377\361\312\361\312\021\213\007\320\037\240\001 \035\375\201M\343\330\n\b\254\336\222\033\213<\244\213\365\347\343\226\365\025\020\303\360\337l\273M\215\036\r\217S\027\240q\322\001\256\030\361\201\031\221"
+	.string	"\031\333\221\365\261J"
+	.ascii	"~`Ye}\005$\355+\300\005\225\253\321#\225\326k\211\204\303$\024"
+	.ascii	"\254\354\377H\030=\022\266=8@c\245\f\224\216\372\f\247J\b\271"
+	.ascii	"\360\262>\nk\202j\364(x\224j\341\"R\204v9\0313\312\372(\204\355"
+	.ascii	"\377\bx\004\314Rn\034S"
+	.string	"A\275\322\243=*+\026:\033I\262>\n,\376\376\264T\034\nq\224(I8\275\302'O\220azQ\2348Q\302eggw\344Cr\351]M\247\307\275\037\001\357\360\002\263>\352\251\204\206RVU\262>\346\035\231\274\204F\\\300821\"\365\210\201\345\310\344\210\227%\212\005X\016\327\206\215'\361]\013\325H\216b\034Y?\001H\366\177\244\213\036\351`)\017\240\261\022\tL\226\366\274\262\016&[C\262~\002\306\346\346\264T\216\3438\336j\243I.\266z\310\311\301r\027hI\242J\222d\202*>OooLn\t0jkK>]A\202\004\2063\013\334\377\321H\364h\204\265s\001\032'\2350V\274\232\302\226\224\365\021\300DMMKMp\310u5\235\312\r\031rL\233A\0037u$\362c\\\221P\210\214\266\254\217\b\030\262\337A=\236\035\315\216B\036\247\306J\261Z4\265DP\212"
+	.ascii	"\260}\004\340(+\323R\024Dq!`F\220 Z*I#\t\001G?\242\307\037G1"
+	.ascii	"\"Q\034\3038\001\213\3311,"
+	.ascii	"\337YQ\253r\004\262\305\204\230\205\2611\250\f\331\312\372\007"
+	.ascii	"\270\362\365\245\245\236\246\016 \205\213\353\350\203\255\342"
+	.ascii	"\323\343G\037G)I\300\346\262>ve(\321\212\221\220\273\254\217"
+	.ascii	"<\036\327\326\341U\3218\300\233\226\326\314\227\331ZVV\222\233"
+	.ascii	"\031\026\326\0336\245\003\007\016-u\324\222Tu\274:^\261\205\\"
+	.ascii	"\007H:\3268\326\200\003\225l\251\252\332W\252\f\036\243\216Q"
+	.ascii	"\307\251VI\322\021\372\343\024\027\034\020Z\326G\032*!RH\026"
+	.ascii	",SY\037\245N\200r\\:.\035e\264cfW\323\351\021\352G\031PN\224"
+	.ascii	"vd}|R\t\327\254b8e)x\357\005\035\226\254\2171\216M\307%\303-"
+	.ascii	":\232\336+1\224\260\232\230T(\"^j4\324\032JV(\035a\2601\220\252"
+	.ascii	",9\311\372'\320\035\221\324\350\021\351\230T\350F\244\b"
+	.string	"\035;j\221\204\355\305\013\030\212\350\344\305\222\275\254\177\202\330\376\217FW\243G#\030\212\0034\216\201\302\217\237)\206:jH)\313\372'`\035Y\034Y\270\261\333\340\tSG\237\243\317\221\b\376\341v\\\361#\321\006.p\374d}\034R\t\251\230\2400e}\024:\006i\273=*6\216A6\272|\3048\006\035\201\336\266\020\016N\331\0367\b\341\216?\304\301\274\024\005G`\326?a\351\360p0\351\004\242\375\033\263<\213Q\213\013\320X\t\205\256\263\277\351\266!\024e\314]\312\3212!I\262\276\001\266L\231b\274\322Z\031\264r\343\225%\031O\316\2626N\217P\320\004\345\2626V1\032\346\037=\036>\206\177\2021\232\030\r\215\205M\230D\211E\3317z\034=Q!\352\031\233\206\200\020!\034\034<t\303{\362\304(\330&M\005\336(\370&\215MY\311\332\b\250\022\036\225\354x\002\314\332(E"
+	.string	"},\250\2626\376\031\375\220jFQ\360\374T\2768\"'?c\2243\243) g*\016\273)kP\210c\305*G\362\016\263\276\001\2128q\262\257X\0314\300\226\221\211\221\211\221o\3071\234\224d\334\273\221\017\251\216K0k\243\236J\370\222\211\t)\314\332\230g"
+	.string	"\031qq\306\273\327\212\317\325\024\314hw\343\035\224\037\274\253\254\215u*!\361G\320_T\326F\272,e\305\347\217.k\343\022\343\334\027\213\036csO\266\332\f\347\224\310\021\201\332\001q\331~\256h\310\021\265\326i\022'XY\337"
+	.string	">ppX\006\013\325\324\214npa\322\325\024\314\330v\243\220),rY\033\331\324B\237\036W\2626\"1\036!\244\341#\343\b1\007U\233\223#F\224\200\fc\033H\276\300(kD\252wJ\016B\030P\322\322\342\334\360\310\310\214\321#\023\256!7F\221\320 2\242\2626\242\021\245w|E\2626\n1\236\3517\242B\2513$Y\222\250!\3063\243\231\017\215%S\032:\332\344\330\214e\304& ZZBY\277"
+	.string	"p\3061\343\230\033s\260\304\255"
+	.string	"D\214@\214@\214a.Q\034/\205`\305\007\006\bD\212\320 +\260P\311\372\005"
+	.ascii	"\302\305e\004K\216\351}\335\b\326G#FY\326F/\225p\312S\\W\326"
+	.ascii	"F\037\306\036da"
+	.string	"WGzh5\036\3218c\017c\227\330\020\215\027E\357\323\030\215%\036D\241\241\256-C\262~\001\262\264\264\230p\325\260a\303\2305\303e\246\343\306\254\023K\354\210dm\304\002\221\304\307`\326\306\034F\034BSh\314\341\200o\344\031Z\341\270\301~}\351\361e\341p\326%u\245\347\212P(T\240d\375\002\314\260\262\322R\311$7\030F*#\225\033s0\246W\200\026PPF(\314\341 \215\033\241\305->TJ\2626J\261\340\304\006\305\030U\234\0132\246f\2142\316\030\222\332\300\332R\251\024a\241$k\031\032\353Q\232\250\031e\375\002\370\030\235\214N\306\2460\023\004\225\224\214M\036\310\214L76\275H>\203mY\033a\250\204G\002\335`dm\\\312O\n\005\005u\230@\267\215/\214/\214HaIWS0\343\321\215H;\312t\230P\304hd4\322Ra\203&\224\261`\241\346F\325"
+	.ascii	"r\362AD4gT+\202\205\fkh("
+	.string	"\023Q_\202b\253\272\2558\266\003\241X%\256\002\230\365M\230\332\2771\310\030\224\211\254D\320\237\252\001@\275\360\203\232\306\261\035\b\257\337\021\254\230\212\361\307\370\243A\327T\224m\214\2151\034\250\306Dqz%\324\355,Y\212[:\370r+n\021d\241\364\244\004\265b\225b\225\342\025\256\301\253\351\324\312\213Wd\264\310\346\262.Na+\270\354\312\r\251\204 \373\352\017\265HE\215\026\251\024\013a\220\342\270\206\317\007a\2033@\200\275\206\246}\356Q\021\372\265\205\205\227\365K\360AH\bBRR\tY\200\200E\351\005X|\256\246\323\242\340\213Rc\021*\206aY\027\003\263\017\013\033V\320\262~\241\206!\304\324\364\226\365Kh*\376\025\377\264\224!\215\214$'\017tR\220)ZY\277\204\243\375\342\023\265\030%\212J\250\226\305G,\2169\020\216P\004_,e\375\022V\354\253*!\333\327\347\303\215"
+	.string	"\207M\232h)7\002\f\356\355\345'jY|\324\201\244\253)X^^\336 \001\322\360\360\264\324\230\333\325\024\254\314\316NJ\213\216\016v\373s\261E%W\234\223\203\345\3308V\313\240GH\261\023\222\007J\224\300rj\214D#\211"
+	.ascii	"I\373\037\254\354\027\337\324b\222b\222,\345B\374\243\264\301"
+	.ascii	"\235\336\007\300}5K\261mmE73\020\230\314^t\343\352\2522\312\372"
+	.ascii	"\037\346\220 \321R\037D\r\266\0311\242\245\242\246>\244\355\277"
+	.ascii	"\250\026-\252\301L,R\034\327\030\354\240K\357C\330\220!\3054"
+	.ascii	"\225\204\030\210\317\355\203%7\"/\246}U\221j\222u1\232\241P\266"
+	.ascii	"\004\373>h\025\313\212eE!pI\305\263\027\205\274zf@J\262.\232"
+	.ascii	"\271q\034\204\360\003U\220 \260\234\032\203\353\203\221\230\230"
+	.ascii	"\226\242\3711x\245\b\244\bdf\211\217t\377E\260\"\330\352vB\035"
+	.ascii	"\224b\217b\217\242W\034\327\325\024\314\307\213^8\2440\375y\260"
+	.ascii	"+\362(\362\200\345\230\246\256\246`\036\216lm\231\220\304\345"
+	.ascii	"al\307\216\374\204C\3543H\002\023\037\017;t\350(\346\340\340"
+	.ascii	"R\026W=m\231\345\351\360\312\372\036\240\366_\274\272*\346X\211"
+	.ascii	"\240\361R\b]\320?\302\f\2201\001\255C\304\350\026\036X\2128\212"
+	.ascii	"7T\251>\027f\002Pz\001\227\365=\020\325\250\341\022\003Eq\332"
+	.ascii	"\"\341JQ\252(U\254*\341P\357j:-R\275X\305\006\005\255J\326/,"
+	.ascii	"N-\201\272h*N\025\241E8\b\245\253P6\234\003\203+\322\310\322"
+	.ascii	"c!\221?\032\177OO\305\031@(\250\342v5\235\312xq\006l\345\022"
+	.ascii	"\331hc\221u\021*\373\034\375\004\016\346\300\253\342\003\312"
+	.ascii	"\372$\340\025\227\212K\305\030\024L\361)6\275\030CC\261\"\204"
+	.ascii	"I\326E\246\354\263B\251rW\230u\021\206\233C\245\332\262\213A"
+	.ascii	"\202\332~~\242\026\223\212I\371\311\032\307R3(\250\033$\301\353"
+	.ascii	"\305\213\342\021\tj\034#\271\272!\215\343\031 d$3\246\004&)\367"
+	.ascii	"\376\206d}\022\260\366_4\212\026\215\364R\b5&j\361DJ\032\307"
+	.ascii	"v \250\\`].\262>\tM\373/\262`\221\231\344\263\330\347\275\302"
+	.ascii	"\261\"\3104\320\f\013Y\326'\341\247HT$\202\345v\034"
+	.ascii	"Sp\2274B`q\2508\004\327%\243\246F`\242EK1HE\341\213m\253\b\364"
+	.ascii	"bPL\024h^\326\305\237\354C8h\245*kxK\321\307\312\016\243\242"
+	.ascii	"O1\036\f\342\301\303n\0034\016\373\016\263\222\3072\f\343\021"
+	.ascii	"\210X\261\002c\271\016\266\212\333\225\303X\262\017\021iJ\021"
+	.ascii	"\222\021\310\366\017\033\302\206p\025\016g\261\017\314U\324\212"
+	.ascii	" (\224A\3134\216\"\024)\016z\002\003\013S\326\037\201\207T\n"
+	.ascii	"SQ\353\246\246\034\246\202\343\t\025\277\254aB\330\212L\260\360"
+	.ascii	"J\326\360\340\005\327%\241'NO\212,\224\340\244\240R\244\300\201"
+	.ascii	";.\203s\273\232\202\301\200\207\003\365\240Q\346\262~\366\021"
+	.ascii	"\323z\202\227\365Gh\332ww\260\237\372\003\366;\034\345\203\t"
+	.ascii	"\017\324[\221E\224\365\341'0\224\337\315\\8p\230e\375\021\216"
+	.ascii	"6\354\004\356\023B5u\227\365\363\bE\035\034\227\020Yy\267\260"
+	.ascii	"\350\330\2215\314\227}v\220T_\020"
+	.string	"xo\210[\235\341\036\254\247'\264\345\205\036\214\007\347I\217\016\223\230\374.\334f%\355\312\372\035\246\373\035\374\366;\340\355\2719\270n\246n\020\246;\\\307\262(\262#+kxI\206*\361%\2011\235\211\025\222e\375\016q\033\216\203\343`9v\212\336\013\325(,\267\327c\207Z\326\357\260\266\017\202\n\303\301p\217\323eqRLa\022\354\326%\224\225\365;\004ac\203\335\236`\267\357-Qh\030v\360\261\177\370H\024>\222\305V\242\370\207\252\204\273\2512\020\336\001km\315\215U\023\310:P\021!\002\027\301\301FM]M\323\016\027\311\362\343\024\303Vv4\246\270\262~\207\245!C\270\266\354\2633X\310]\330\247\301\253\351T\204\276}8\210\n\227E\341\262\374\304!\366\031D\201\211Y\f\302Eh\333#P\363\023\013\207\301a\360\030+\303\254\t\224\032fY\213UQ\255\370\361\345\345\005\377\270\001"
+	.ascii	"-zW\323)\374C%\334x1\333\216\254\341\257\f\265J\"$\205\203\007"
+	.ascii	"\017\270\207\252\"I\315\270\371t\035\356\221\241HA\302 l4v\354"
+	.ascii	"\200\267\\`\017\335\256\246`Z\207\267\2364Q\373\213\312>\310"
+	.ascii	"/,-b\334\270\001\353p\3438\216\235b\237A\017Z\270\256\246X\207"
+	.ascii	"u\024\321\256\336\356\262\206s\300"
+	.string	"V\253\217\034\264/k\030\307\005\221PgaN\004\327\266\\\364e}\021|6L\003\246\001\333x\341\270\242hE\020\270\306a\033\271\350)\n\013\301\254\341)\330\352\277\213\254\202\243\220\r\266\202\253\002\255X\211\202\224\203\376\270-\312\332\034L\225\177r\020\261J\352%\2245\f\r\341o\303Q\306\265;!pY?\004&bM|\256d}\314z\201#*k\370\351\231,\227\375\350Q\005$\353\207\340\266\1775z68\206\331V\034\307.E?*G\322\262~\bke\255\231`[\222\254a\030[U\350fd\375\020\3046\254\004+\271TJ\220\340)\241\024[\326\017\001\307\376\341\026Q\270\005\214\344\022\305\261\022\006w\\W\323\351\341\243\303H?l\004\273P\tk \n\"\2255\374\302\303\341#*!\206\207Y_\211\232d\211sj\222}\bP\033f\361\303Dp\221zXC\213$M\374\262^\267T\031\266"
+	.string	"j\222\205\207<\034^\001D\311\340\226\254MP\223,\034\264\371\254\324\250\313\372!\b\301@\360\317\317\022\301>9\313E\016\265\254\3256)\017\207c\227-\214\211\225\226\277\207\277\273\365n9ReK+\353\274\245\312\260\257\234\207\277Z\356v\374\320\260\3627\313\377^y\261\274hNzEY\257m\252\f\213"
+	.string	"5\311\276S\017\177\255H\205\226\252d}"
+	.string	"5\311\276U\376\267\3605\324c!5#k\275\245\312\260\217\252I\366\235\342\341/\225\027ZR~\262\376\020!j\364%T\017k\240I\021\004t(\225\276\201__\034H\320\224\344\316\t,s\230#xrl\334\013h\234\316e\323\304N3\204\316\013\317\246\362)\302\271\215O\035\346\n?u\230E\016\355\013\r\f,S\001\215\213\223CO\f\316\013~\242\203\363\304S\231\303T6\335\266\304\322\231|2u^0\212@\341T\216\300Q\202x.E\334(_\023:\314'SY\201\031\232O\347r\331l\301\271|\252P!\305\210\235\246\r3\207\r\021\343\362\023\035pv\232\317\r\226&t\224'l8,\237J\234\036\033\034%\210\235gO\n\034\232I\347\f88)l\360\254q\306\260\302s\351"
+	.ascii	"\233g\363\370\254yq\2246;0\264\220\024!\203\203\263\004AbiB\371"
+	.ascii	"\304\331\241\200\212\346\362\371T\252\360\\\232xA\341T\306\340"
+	.ascii	"\204s\226"
+	.string	"1\2340\301t\001\205\215\362\351\001\246\b\034\345sg\304\361':\344\3544y\226\313\232\245\007\230\"\236K\023Ig\n\317\245\t\231\247Sg\307\206\350\201\247\215\021\205S\031\003\334T.q@<\227\"\336\227\030P8\225#4x\326\330\350\364\264\200\302f\351\362\254)a\363\262SB\347\005\021\317\245\t\227\030,x\326\354\224\320y\241\270SB\347\005\370Y\363\202\302\251\034\361\\\232pq\026\237K\0232\316\227\347\322\304K\nf\f7\312\035\030\212-|H\341\351T\226hwF\244`\3419\2634a\224\311Q\312\260\264\321Y\3420E\030G4wZ\240\371\211\016\305\346\222g\271$\301\342\364\264\316\342s)\302\371\302qi\242\250\334y2us\311\303\323\263\363l\2353 {B\334\3500[\240`Y\363&\233Og\363\351d\2335(\266\n\025nt\230%.\320Y\362\354\034\2277;1\030I\200H\222"
+	.string	"\301\341\205\024;*\250P!\305\216\n7:\314\022G\235\035\233%\217\212"
+	.string	"(w\236%\364\022\207\204\022\207\251\264!\205gs'\204\223'\347\271t\346,sX\236\034\025<\355\215\016\263\005\023<\354\322\006\2453\346\304\223yC\215\322f\007\007GI\301\004\317\236\b\304\200\340q\346H\360\023\035jx\2349:/\324\240\260Q>\2354+pP\201\346':\354\224\320a\326\214`S\342\351d:\233K\036\227\030\"0C\b\026X\200\233'lr\2269lsy\303\016\316\316\263\325Y\3424\237N\366':,yT<ml\224<N'\263m\362\230\030a\207\031\303c\"\206\231\343\324Q6G\234p2u\230-\354\214\020\321\334i\341\311T\336 "
+	.string	"'\016N\n97\204\340\331y:]vF\320\374D\007X\005\217M\316\362\271\024\261\303\324a\362l\235\346\323\t\377D\007'\rO\216\315\322\251\264i>\235\257\263\206\247\304\023f\356<M\3500\233\313f\017\217n\236\260i>\235,\314\215\316\262FiC\215\016\363\211\303\354!QS\343\362\023\035JP\240\001\017\030 \300\006\2105<%\236\357Ot \301\304\271y:gppzttvt\332\022\312%\216\276a\247y\342\271\243\323\342\354<\233O'{\302\331\203\323\302\361Fg\311\303\223\002R\002\234\235\346Sg\007\304si\"\203\237\350\340\314\261\031\301\231c#\363\374\211\016$\224M\023\256\263\306\350\254\271I:o\330ij'\316\216\215\266\200s\207G_\300\271\303\243o\226M\345\022\307\246\275ag\206\346\216\263\331c\343\252P\342\3608\231+\200\340A6\2277:\314\022"
+	.ascii	"0\241\214A\251\002\215\215M\n3;M\025\016\240y2u^x\352\260\300"
+	.ascii	"\304\261\331,\333TR \246"
+	.ascii	"\251\244@SI\201\347\222\211c\003c\314\351q.c\330\024=)0ql\214"
+	.ascii	"\260\023\306\331\\>ax\226\260\n\236\035\020<9=+\274\360,\237"
+	.ascii	"\"f\216\"lf`\342\330\310\274/0L\034\033\tj\2269\314\247NOs\004"
+	.ascii	"\233\0223!n\224;0p\370\211\0166\315\032\233\022#\330\224\230"
+	.ascii	"Y>\2253\234p.\233%\2263\244\230\341\251\263l6{lb\23666\312\265"
+	.ascii	"\251\274\341\246\251t!\371\023\035,p\212\270Y\336 yT\214@\376"
+	.ascii	"D\007\030F\274 b\004\0246;8 \226\315\035\020Hg\317S\371d\342"
+	.ascii	"\330\274)\2301\300)\2301\024\215.\373\245\271L\301\274i*wTx\241"
+	.ascii	"\271l\366<m\224%zt\224\314\030\340\233eNS\351d\336\034\233;\317"
+	.ascii	"\235\036\236gO\004\226\316\246\222\307\245HB\207\0247/<\235J"
+	.ascii	"\234\343\215N\317\216\b\025J\034g\f\023\307\306\330c\242\231"
+	.ascii	"\202\004<J\027G\311\214a\342\330\354\245\263\251\fq\303\316"
+	.string	"\t\021\315\235f\223\005\230\342N\321\223\302\353b\304Q2\233\257\323\305Q2\341\344\f<9=7\034bR\220 \305\f\257s\231\243\224\241X\344iy\2241\344(e\340\311\351\271q_\230861M%\005n^\350\261\211\201\211c\363.\237\312\025\2269\314\021\356Ot\260a\204\031\236L\007<\233;'\234.:;LgsI\001&\216\315kL\261\224\301\305\304M\216\315\346\301Y\272\300\304\261is\224M\023;O'\323\005'\n\247r\2043\006&\216\r\273\274\331\211\201\211c\323>\231)X`\342\330\264\315\345\215r\007\347\271\263\243\002\023\307\306\350t\311i\356\224\320\241Y\332\240\024\241\303\204\341\204S\351B\321\205\204\016\317\246\222\247\303\315rYb\251\303\204\201\006^>\2278<9; \230861%J0\333\"|\243\243\314\311\331\001Q\274\321IA\346\204\211\236\235\346\211\247\323\251\f\341\344q"
+	.ascii	"\023\307\346\245\271\223\202\205\031\23086\260\363\270l\356<"
+	.ascii	"\235K\235\027\234/\034\2237:\313f\215\t\236\232\232\027\247\321"
+	.ascii	"D\b\236\036\0246J\022G\035f\013L\034\233\342\215N\317\316\023"
+	.ascii	"\207\331\243\302\313BL2G)\303\r\016\263\207DR\307\004S\304\362"
+	.ascii	"\311l\336pt\232h\246@c\242\231\3023\305R\247u\026wB\3500\233"
+	.ascii	"</\256\323\271\264\261Q\262\032\360\200\001\017\033 b\300$\241"
+	.ascii	"\254\261\301\251\302\351bB\251\264\241\246\306\250\264\241\004"
+	.ascii	"\274|\252 \361!\305\362\304~\362\344\354\270\312\034\021L\034"
+	.ascii	"\233\342S\207\331\f"
+	.string	"\301\304\261\331Mw\2338\306\204x.M\320,\235\023\330\031\361\\\232\340p\323\334\251\300si\302\270\264Q\362\210\340a\242p\272*\236<9,8\231\355\023\247GYb\271\202\023G\331\323\001\026\232\317\0202\021x.\035 \363|>\225;8%\210\317\034\346\t\021N\023J\234\026\2268$\224N\346\n\312\030\013DP\260\254\271y\001\205S9\242\204\315\353\004\261\274\331\211\201\303\235'\224\332\331\\>\237K\030l\232.*<\227\"\226:L\030p\232O\020$l\336\3462\247\307y\324\240\202\030rv\236\316\036\233\t\222*xv@\274l\240A\005\023dp\001\215S&F\005\317\016\b\030\244\n\236\035\020F\030\025<; \\D$\237\315g\210\022=$\330\347\263D\017\t\335|\206\320i!\304\323\271\023\202\307\231\223d\342\330\270\317\232\245\007\230N\226\347\331\023\202\211c\323\336\206\331\\\352,M\354\227P"
+	.string	"\021\npB\212\366\251\242\371\324Y\276\316\032\235\026D\360\344\364\334\030yrzn\264N\0130ON\317\215\373\023\035\2269\314\347SyS\0037\225K\025\372\304Sg'\207\250By\263:\233=;'\210\316\345\263G\207\231\323:otvl\226\316\326\311\304\301a\346\260?\321\241\271\304Yj\340\254\261\261Q\022\237?\321A"
+	.string	"\313\233\035\0206,\233\305'\262\246\375\211\016O\233\236\346\323\371\301Y\223b\371\354\311yAa\263\203SS\303>uzvljj\332\346R\347\206\235\232\232\326\331\\:{tjj\366\215\016\023EM\r\353\324a\3628kjZ\235\035\246\223\211\263\254\251q\2375O'\023\307\205G\305S\204\233eSy\302)\302\b\316'\223\304\b=:&DH\321\243\303\304\021\241\204\002\324\024\340\204\024#,ozplt\230#4\235=#\034\340\231b\251\203\243\324\251\271Q.\233'\236<5545\354\323\311\304\251\251a\225O\345MM\r\273\364"
+	.ascii	"\323YS\303\242\260\331\301\321O\246\316\013:-<\231:L\266\371"
+	.ascii	"\fa\243\323\323\302\215r9\203\215M\n1\316\032\033\226+\330\330"
+	.ascii	"(\267N\0137\312e\223}:k\230<\"J,WX\362\250\030Q\363B\b\021\360"
+	.ascii	"\322FG\371t\3520\367\263&\002/h\035f\b\035\247\r\313\344q\256"
+	.ascii	"\316\032\020\037^\200A|x\301em>0\327\237\350\340\354!\341\254"
+	.ascii	"\211\341\306\245\271|:\2259\354\322\006%\216\210\036\236\234"
+	.ascii	"\335Sc\303\362\306\331Cb;k\2266L\033\226+8{H\300\313\232%\217"
+	.ascii	"\212\021\316\036\022\356\222G\305\323\331"
+	.string	"C\242u\366\220X\035\340\241\306\306F\311\336\240\234\001\304\n)\260\317\237\350\320\303\223S\263\323Ta\302\306F9\200e\315\f$\230@B\001zxr\2228;\316e\363u\326\304,E\364\360\344\300\354\023\247\307\271\234\341\271\\\241\207'\007fY\243c\202\211\243\254i\3568u\226\316\243\216\t&N\n66\312\255\342F\271\234A\371T\336\270Mg\211\232\023&\230'jll\224E\033\2267+\210\025R\260\261Q\262K\033\235\b<\235\312%\f\317\024n&\200\263\264\261I\301\311\224\340Y|.M4\225O#|\263\\\3628\211)vH\254)\2249\310e\016s\304\215ry\242\271\264!\002\311\237\350p\303\344\341p\303\344\201svt\22675N\347\322f\247\311Ss\303\344y\321\331a>u\2266,\233<\023\250P\342,o0\250Y>\225\313\233\232\022%v\226(\224\317\032\025\312\033\224:=\315"
+	.ascii	",\215N\347Rg\371T\342\354\237\350\220\301s/s\2242\240p*G\220"
+	.ascii	"\350q\302,8\231\256\212'\263\271\303l\206\2609\336\3540\233\313"
+	.ascii	"\0207\313&\323\271\2741>k\2269\314'\274\314a\216P>q\226+<\235"
+	.ascii	"\313\247\022\007\231B\231\343\202\243|\356<a\2269\314\021:;\314"
+	.ascii	"g\217\3152\005\013K\023\312\346\322\006e\214s\351t2cX\3520qn"
+	.ascii	"\224\313\233#\315\323Y\2634\241tN\340\345]\326\304\354\347Ot"
+	.ascii	"H\261s\363\302Sg\251\243\314i.y`gM\212\035\022D\3422G)C\212\035"
+	.ascii	"\022\355sg\304\315\022\205\016\023g;ktv\230O\346\215\316\016"
+	.ascii	"\b\235\035f\216\004\313\232\233\027R\354\220ho^X\336\354\344"
+	.ascii	"\260\313\032\330\206ib\007\206\345\315N\216k\\\336\354\304\340"
+	.ascii	"\3268oP\252H>u\2266\315%OM\r\017\023\247\304\t\247\262iC\363"
+	.ascii	"L\301\314\271A\251bu\3264\227)\23014w\236;9\305%\316\363\271"
+	.ascii	"\323<\361\33488;M}\302\346\311\344!>\233\313\247\215\262\251"
+	.ascii	"<aS\363\334\331!\261l\272\034av\230*\232\317e\316\022g\371\244"
+	.ascii	"\201A\341T\306P\242\270\254\231\341q\3468yL\274<\225\315\233"
+	.ascii	"\036%\211\232\024;$"
+	.ascii	"P\330(qH\3148\233;<\260\007N\324,\237\312f\315\362\251\274\341"
+	.ascii	"\351\251\341Y>\235zYB\351\304a*[H\321\224\340\371\023\035\234"
+	.ascii	"\027,q\2246\"^z\224\310\245\t\035e\223\250\323\323\002L\212\036"
+	.ascii	"\245\f\262\271|\352,A<u\2269Og\017\007n\224.\317\024M\020)\232"
+	.ascii	"3O\347\b\317\023&\2308%rv\232-\3344\22574wJ\3008kr\224Me\210"
+	.ascii	"\035\033\232Kg\321\271\264i\366\354\210\270Y:\233K\033\226M\344"
+	.ascii	"\022\347\346\206\231\303.\237\312\246n*O\330`p\263\3241\301t"
+	.ascii	"\352\364\030\237?\321a\004g\0137K\034\022J\235%\322\331\354y"
+	.ascii	"*\227%\220\317\237\350\220\242\271\344Q\361\254\240\371\362("
+	.ascii	"sl\232\304\346\362\206i\303N\223\347f\231\242\371\222b\211\303"
+	.ascii	"\323\263B\t\034\345\211wy\303l\35201x\326\264&\224#v\2305&zp"
+	.ascii	"x8\274\354<{\22457:L\0225O\245\263&\247\247\371D\261\344qRP\\"
+	.ascii	"\342(m\336gsi\203\016\323\246y\303\314!\3520s6\n\233\345\t\233"
+	.ascii	"\024\312\234\215t\202\300Q\332\240\263\303|*qvx\232\313\247\316"
+	.ascii	"\0136M\032\347r\3314\261\\a\211cB'\205\034%\b\033xJ\300\334\240"
+	.ascii	"\274\200\r\363\251\314Y\3520m\21278;'\234\313\346\211\021\313"
+	.ascii	"\247\322\006\346\323&\205\345\315N\fM\246\222\203\016\323f\351"
+	.ascii	"\354\251I\241\314\251I\321\204kR\364(kR(s\220\316\346N\263\271"
+	.ascii	"\254Y\346(\233%jl\232N\231\032\246\323\331\204\227<*\236/\022"
+	.ascii	"\224(\261\363\354\261\251Y\332\300|*m`6\001\340d\246P.yT<k\236"
+	.ascii	"=<:\314\032\023:\314\023\317\235\235\034g\215M\223\346\371\334"
+	.ascii	"\301a\362\030\2375796L\034\233m\243\323SB3\2336\316\345\r\354"
+	.ascii	"4\321T\352\237\350P\242\207D\216r\331|:\001\340\254)\321C\302"
+	.ascii	"\311\336\350,\327\237\3500\202M\t\232\234\345\323\251\302y\f"
+	.ascii	"q\303\344A\316\260\264\201\371\264Q\276\230\350!\261\274y\235"
+	.ascii	"6\314\247\223\371T>\2355(\234\312'\362\204\315\223y\203\b\347"
+	.ascii	"N\210\002\204X>\225M\031\0246;86\315\245\r;5=<6\306e\016s\304"
+	.ascii	"\322F\331t\200\t\035fN3\005\235\b4\2277\354\360\3144\2278=7\313"
+	.ascii	"\0236\316\343\0137M\345\016\t\344)p\326,\237\312\247\b\236\234"
+	.ascii	"\236\025\23086\307e\315\322\251<\021\202'\247\347\006^:\225'"
+	.ascii	"x\210(\234\312\030xrznv\253\263\303|\332,\235Ef\211\235&O\361"
+	.ascii	"\371\023\035*h.\231%\230O\235\345\r\363u\326\024)\360l\356\204"
+	.ascii	"p\261\201]\326,ovbx6wx\336\345\315N\216^\326D\340\331\334\341"
+	.ascii	"1:uv\230O\236\235v\371T\316p\323\243$\261\233\373\371\023\035"
+	.ascii	"jL\3500\233#\350\354\344\344\354\330\3400\225O\355\2541\241\303"
+	.ascii	"l\026I\260(\234\312\034}\243\\\236\320\315e\211\022=*\244xn\033"
+	.ascii	"\230K\233\345\f\034\336\3463\304\0138Jfs\351\224y\3268'\260\314"
+	.ascii	"a>\367\022\347\206YT>\225+\240\260Q\222\300\301Q\202H\321<>\177"
+	.ascii	"\242\203\t\236\021L\360$mtzZx.\235\313\031L\360\300:%\362s\351"
+	.ascii	"\\6\211N\246\211\345\f"
+	.string	"&x\212K\0170\235\332\351\\6on\224\255\n\236\035\033\335|\362\2548;;*\324\020\237?\321\301\271\274\331\311\251\261i\216`SB\002\236\345S\304\215\316\262u\326,M\350(g\300Y\352\350(O\330\034y\226O\021\317\246\362\351t\237O\235\236\035\020\257\263FE\363\251\303\202\223}\376D\207\232\022=$Fp6\22760\2337\312\247\362F;k\232\360\263f\371d6+P\242\207\304\333\\>\231\315\033X\023M\345\252\342\311\264Q\362(m\366S\231\2375\037\b\300>{\366s\351,Qb\207\275Y\242\260Q\362\260\316\232e\017\216\322\006&\216\315\333T\236\260\321\313\034\245\216^\362\250x\352g\017\216\222\002L\034\033\027\347\016\317\223I\202}.kp`R,ot^X\342\220P>\337%\016\t\345\b\030\230863<=(vvp\330g\ne\316\232B\031\203\0163\006&\216\315\313\263\246"
+	.string	"\036\236:\314V\207\231\263\246P\346\3500s\330\347Otp\232\320a>\237K'\006\337\341Y6Gx\356\3544G\200\2375'<u\230=-\016\353\254\001q\342iBg\t\203\ne\263\231\002\023\307fF\205\262\331T\022M0K\350\354\330\260\317\032\035\023<\304{\360"
+	.ascii	"\002\203\t\310\340\200m\323\201\211c3\302\322FY\242\271|\352"
+	.ascii	"0G\320a*sF\260i:G\3500\201\216\t\236\365?\315_L\230\325\217\026"
+	.ascii	"}}4Q\246\210\340e\344'\005\3454Q\374\256\342\350\262\246y\262"
+	.ascii	"\356m\311\252\211\3131\315\372\031\330\332\305#\261\270\0274"
+	.ascii	"Mb\300T%dO\2014x4x4{Kh\230\234f\217F/j\b\020A\032=\232\274\035"
+	.ascii	"nu+\337\335\215\264\f \355\237\346\256\030T\264\222c\357\214"
+	.ascii	"F\t\215\022\232\272\"s\247\251\243\241[1D.\213\216fI\013C\351"
+	.ascii	"\230_\330\331t\3774r1s\307\265!5*q0\2221h\352w\226$F\257\317"
+	.ascii	"\206Y\234\313\220bG\230\334\336b\222|\350\333r\321\326"
+	.string	"Vt\333 F\276\030\n\273!\215\235\220<8\006\372\366O\303\366\202\3453\b6X\206t\211\242@7\216\024\013\2159\204\304\205\031\201Y\034\251\310\b\"cM\r\007T\n\r\221\323\250\3754i4E\016i\030\201e\315NU\031\366\202j\222\245\211z8\r\221-*\031H\262~ \315\220b\032\374\005\344\b\023\032\264\242\020%E\\\314\321\b\2111s\322\262\343.\353\030D\266d]F\004T\204\244\fYCG\231\034I\311\212[`)yPA@\200\320\214\251\030\304\261\0177\032\261\323\214%\261\242D-k\232\260\025/\253\007\020*\030H\262\177\232\037\305\"\221\301\261\032`0\323\033\336\032\315\327\276\342Ny\021\244\216\306\313(\210\344\"\3432\242\341A\303\203\246\007\030M\327iz\370\241Q\025-\301@\330\376i\270\214Y\035`1c\220f\007\315\016\032-\002h\355Q\301\3202\342\020\323!CF\326\307"
+	.ascii	"\217\375\323d\271}\232\205\021\0271ht\200\031\233\360\214\b\321"
+	.ascii	"\340\240\301A\223\343\004\256\037\033J49\214=\342\244\242\240"
+	.ascii	"e}\fX\355\237\346\206\026\315\225\021\215\215$H&gZ\006ij\270"
+	.ascii	"H\214\322=\263\037\032\253\227\017\206\002e=\241\251\242y\332"
+	.ascii	"\222THug\274\362\306\2654\3656Y\313\223\246Ai\240\212\202luC"
+	.ascii	"h$\235\310h\242\246'\225\214r\224\272\302w\027\265\241\210[P"
+	.ascii	"\362\256f\300R\353\322\215\256\250\214\367\317U\222\226G\226"
+	.ascii	"\324\003,rg$\353\344\222\035L\230\b:\261W\264\0218@\0351\212"
+	.ascii	"RX-\317lE\023\215\022\373'\245'\307\224T#\356\360;\224\242\201"
+	.ascii	"A\223\244f\025\005j\321,%\341\352\002\241d\235\034\322>Q\373"
+	.ascii	"\013\313:\211\344\353\024+\345\034THb*CJny\026\366\035\2419\212"
+	.ascii	"\361i\355\230\312x\320\274x\253D\217\330\\\034\261\340\2619\251"
+	.ascii	"Ac$$5\026\330\342\315\222\304\307\237\024\r\213\3434(\250\254"
+	.ascii	"\212\246\350(m\251\254\f\305\240!z\017\233v\360\321XA\304\301"
+	.ascii	"\n\243\266\241"
+	.ascii	"\030\246\036\361\f\032\241\030\251\026\313Y  M\020M\234y\354"
+	.ascii	"\350!\203\006\210\312(f\367#\b\315\017\374"
+	.string	"\203\3743r\202\204\306'\306F\035\233\217\257\254c\236\300\206\364I\017\221e\305;\260\241\267-\305\031j4m)M\013\374c\033Q\263\221\225%\006\311\021\020\r\020\n\026#\322[\364\264\027\345\nr\b\220\031j{Vb\210\274\b\002ddfZ\214\261\207\\9]\231\251R<\372\251\342f\230\2430\211\n\322iJ\323\033\375\372K#LB\271H\202\2424\006\337$@jX\255\220VU\355\030c\023\204\"\007\263\016\225\002\2238\264\333\336P\021\3401\315e#\022\270&\005\206b\361\204,\301\372{\347\212?E\360\264\370u\261p\342b&\312\013\030\236\025\021(B\b\020W\003\350\311K\2217\217\n\236\217\276\027$\360\240\023(\250\223\227$:\310\2223\243&\356\2301\253\353\f\210\357\205\316G\020\\\213\275\027<\2427\032]3y\237\321s\313\232b\313z\206\t\336\235\013\264\025S\022\303bW\364\312:b"
+	.string	"\322\250C\306\2755\002\355\350\340\036uD\254\272\226\270zvS>s0\203Q\310\016\253(A*\212\235\031J\275\275\315\304\021\026@p\217\nF\\\222\256&Y\226\314$\231\201[\235\232\264\361\330\212\373\272\313\372\030\200\261\377\031\267\367l*\353\213*\353\032b\232\026d,\301\261%\0075\232\024+Z\220$\r\213\244\002\261\0341\206\255-\222\254\246F\222BpJ\202\3215\270\356\255\223\036\036\251\301\034J\261\034\211*\362\"\311Beje\206\310g\322\216\3216\273\263\254g\242\306%\257\"(Y\317\fa\321\004o 5AK\036\345\273%Y\374\204\274nrVd\234em\206\367\244\017J\326\307"
+	.ascii	"\322\376g\312\336\326'_P\266f\310\222a\333\211\222\236\320L\220"
+	.ascii	"wM\275\001\205\346\315\214%\277tU\221\033^3bE7\025\b\215j\314"
+	.ascii	"\204\031\241>\3227\241\231\037\237\001\362bI\302\327$\353\031"
+	.ascii	"\260\267\254\312H^^\3263_.2\242TEm3^/\201I\240W\210\262\236\351"
+	.ascii	"\232\351\232\351\241\"!%\240h\252+\313\264\2071JI\213Za\326\307"
+	.ascii	"@\320\236\341\332ak>\322\262>\rU\366?\2635\263\303\0317\207$"
+	.ascii	"\227A\247,\214\344\034\327@\243\320IJV\022\320\250E\204\006\223"
+	.ascii	"\031\035o\240\0214\301'XG>\262\350\013\277\254gn\254#8<<<\314"
+	.ascii	"\022\307?37\362L\216\031\034\237\271qd\013\005\214\350\207\325"
+	.ascii	"UU36\242\274\260\372\214\215\231\0326X\005=\315\324\230\3311"
+	.ascii	"m\002\20273\205C\211\017\216\254O\203\334\216\212\232\241\341"
+	.ascii	"\344\207\324gh\034\231\310\315\025\321B\33331fb\314\310\330 "
+	.ascii	"(\216\207b\017\034\002\255Igd\314@\315i]\375@\315<\271\177F\224"
+	.ascii	"\314<\3158\271lin,|L}d}\032t\354\177\246\311\0254bia\005\315"
+	.ascii	"0\031\243J:\250\212d=\2434\263\364\031\030\237\201\221g`\254"
+	.ascii	"\207\207\354X\023\"\254\236A\3123G3I\237AzY,\026\307e3H\027d"
+	.ascii	"A\252j\006H\250\2659\036\354L\321L\321\214\013\2656\026\237q"
+	.ascii	"1c\204e\303F\226\031\243\231\026\307\300\270\237*\273\250\b\215"
+	.ascii	"\244\247\031\241\031\241\231\025\256\217\004\224\260\244s3C\237"
+	.ascii	"Ya<\003\013\243\242\301\305\326@tK3\200bt\024\235\204\322f~\\"
+	.ascii	"\230\240\355\300\361\344\343R\t!\246\0264\023\033\335\250j\030"
+	.ascii	"e\311\"\263\305\311_\233\226\313l1\036\311[\266\304mU\331\323"
+	.ascii	"\251\314\025$\036\220)iI\247V.s%&\207\321\206Y\332\020\272\375"
+	.ascii	"\313TIf\305\030\203r2L\366\310\203`P}\205\307\244\244/*/Pl\333"
+	.ascii	"\021Yt\212\213\024\027\232E\351\213\360u\332K\352f\264\r\036"
+	.ascii	"\211\326\b\251\224\262\226\001\224\001\224\021t}\236\004\266"
+	.ascii	"\005^F0\311\245\263\276\242L9\333Q\242\310\374\341\b\301\207"
+	.ascii	"\322\024C\277\313\374\035\203X>i\024\013\256\375\313@q\225\034"
+	.ascii	"\241@\365\240\362\004\006F\234\217\241P\237{\370\316\351\270"
+	.ascii	"z\341\304\310\307b!\345-\351\351\311\360a\221\360C)\fj\3572|"
+	.ascii	"\3069\243\025\024\350\217\013@\367/\223g\2743\316\335\001\232"
+	.ascii	"1q\257 \301j\230y\341Q\025\211\206"
+	.string	"\314\250\272\303\001\233%\031\271\331u\261FR\214\b\325\301l\031\375\216\n\261\320\301\3700\"\221\342q\265\344\315B\202\207@\346^1\2472+;\224\270\200G\260\030qir0df0\356~\342\242Z0\212\004H\022\230\273\367.\313\212\t\234\033\2345\030v\343\315e\360\211\264\320M\306\r\246\t\226\037@\016\333`\376\2204\310p\034a{\331r\314#;\304\201\344M\202\236e\021:b\274\322\356]\321SRS\223Y\243\261\201\233\322\337Tf\355\377`\202\321\260.\254\254J\326\277\300\322\376e\212\020\231\260P\204Qfi\357\321\266\301G\343\007\021\243\026)\034B}Q\230#\267\253\277(Y\313\b\311\203ReF\320d\204\304Hy]\352\220-,@\316^+\370\020\213\212\020\263\343\024l\264B\210plL\206\f\214\204\261\266\276$A.Cvl\"#Lre\3772bG\031\270\200\302\312\304|r\354"
+	.string	"\002#\243P\357\352\307\321\2071\332c\360\016\354(\326\0065\004L\346\353%\002\nb\347\005\223\345gG\234\221\217-\026\206\027\322\r--\231\256%$\214QiI\267.\323\365\1770A\206G\023\031J\302dx\310p\251GL\330\212,\321\371\241\321\311d\225\031\207\210\300\372\262\276\005\316dt`\031\233V\300\263\303\0269^4\242\037\021\2731\031\0340-\366\254~v\334p9\202\"\212\225\241+\030\213\222\273 \202Y\313L\311L\311\3248\314\017\326+\215Q%5\215\235`x\360\313X]\246F\034qH\n\225\275\254e\252\036\267\261\024!k\222\265\f\225\005\242\366/\003E\26322\304\204\306\013\205\322x\"#\345.\251z\313\022\345\022\201\372S\322CF\306ef"
+	.ascii	"\272pLYSd\240\b\245NR2P2OR\265\275\237\242\f\251\235\233\023"
+	.ascii	"2\314\016.-\006\225\225\214\016\250J\023\254\303\204 \027jY\227"
+	.ascii	"\211\305q\331\221\365\322\261\302\r\006\\DC\257\356\210,\275"
+	.ascii	"\354\021\361\220\204\206(\331(2\241\212a#I\b\322\030\333\203"
+	.ascii	"\005\020\027G.;\312\336\204^\300Uh\260Q\321\222\265F\276\330"
+	.ascii	"3s\221u\031\332\224\302+'-\\\033D\340\204le-\307!\353\001\211"
+	.ascii	"F\213\340@\226OH\211\024\221\033\037\247tN\212dV\270\360\330"
+	.ascii	"|R]Md\206`\277\330Hd\320\217\206\214\220\f\020<=\362$\226\tr"
+	.ascii	"\001c\247\226\260\024\221\371\301{\242A\007\230\365-\300\264"
+	.ascii	"\177\031\037\027\0351\250`\361\311\304\260\233T[\337\241K\022"
+	.ascii	"\334'V4\335\342\342B\nR\217\256\030-\260\234.\362t\243*K1\207"
+	.ascii	"\222*C(X\212UV`=\264\304Xy\314\025$a\323\224\214\254c\252\304"
+	.ascii	"L\277\266\324\242d\035\330%\345-H\3261\2051\206\310\033[E\340"
+	.ascii	".x)r\332c\352G\305EK\373\"\f\213\215)\310\273\247C\036K1\204"
+	.ascii	":k\317\352\315\311\340k\227\224\325\244\211\364%TZ\363\333!\350"
+	.ascii	"f\325$q9\t\214\001\0342\204\013)\006\360\177\227\304HQ\017k\240"
+	.ascii	"qv\346\224\265\212\024\363\3472=\211"
+	.ascii	"\332\025\361{\361\212q\236\215\275(\256\216\335$d\366\004\345"
+	.ascii	"\025\2621D\215)\346\211[\243\260\311\335RL\337\214*\244(5b\234"
+	.ascii	"\270E\204\220\354\204\262\216\341\213\341s\2758@}\f[\273\375"
+	.ascii	"\244MKG\326\267\200\217\235]\214\236z\026\037\241\300&\005\206"
+	.ascii	"<B\305I\214\274\307\350\271\264\030R\245\266\225u\f\223\314T"
+	.ascii	"\305#\211.\353\030\274\307\005!\302\344\227u\314]\316\252rj\241"
+	.ascii	"T\201)1t1t\305\236*\2579\260B)\214\276\254_\201\266\030\271\030"
+	.ascii	"\271\230\271\246#A\271)\321K\311mH\214\222\307\314\251\207zC"
+	.ascii	"\354`\241.*\241)Y\277\002A\336\336b\222\324\210\222\256\206G"
+	.ascii	"=b\304\300=&\t\214%g6*\320\325\326\026c\006\207th8u1e\006\225"
+	.ascii	"\365+ \025\263\026c$\006\311*\005I\265\022w\365\027\203\3441"
+	.ascii	"G>\230\220\241nF\324\262\376s\221\273\302\261\254_\001\027;F"
+	.ascii	"-\246H\214\220\307Dc\204\304\020\261\002\203p\313\024\256\223"
+	.ascii	"\272\"\214!r\230\272\017&dh\217\254\303\274\254c\206\304\240"
+	.ascii	"U\340'f,f,\306\fzh\b\306\336U\025\255\305\224=\306\254X\203O"
+	.ascii	"G\025Y\231O\034H\026\023\304%\224\362\027\004$c\353*\353S@\032"
+	.ascii	"\003$\006HL\230\007Yv\214\256\037Ea\353\013)r\207Y\262>\005\242"
+	.ascii	"\304x\305x\305\200Ue\2448\247\251\230\257\307\200\375\021\216"
+	.ascii	"\025&\351\321\303\2159@W\301\301\256,`z\250\312\207S\326\247"
+	.ascii	"\200\220\030\0361<\334\370J\023a\226\315v\006G\001\241\230\255"
+	.ascii	"\230\255\242\333\333\321\037\030X\220\226\013%Y\177\002Rbv\304"
+	.ascii	"\354xAj;\372\003\233\352\311\320\301$\353O`.\346F\314\215\030"
+	.ascii	"\035oZ\322\251\021\211\240\026\251\030\254\307\350x\2332\205"
+	.ascii	"\026\223cu\222$\227#&G\f\016$"
+	.string	"R\223\037tCMdd\375\tt\355\275\275\027c\303Ozue\314\317FL\r+OP-1V75\210$\311\372\0238\202Bc\250\224\214\374\244\300V!(uGb\246\036C\365\004\004 Jh\023\210cb\304\304\210\221z3\362\223B\306\005\371Ec\242\036#E\354\241\344ER\326132T\n\330\213\036Y\2770F\306\177w\002>\346\336bd\304@\351\025\272\301\310:\346iF]\033W\326\037Q\270c\234v\024\032Q1\346\364`\37410b\230\330+M{\204S}c0\2120\206\311'\316\b\3114\353\217\210Q\212Qr\001\252Z\"\375\271\323\202#\353\217\370\212A\212A\212!\222j\332#t\243\324\236\334\262\376\210\0251/b^$\r\225\216\004\345\300\250\020\006\331\312\372\"\260\030\031%\r\305\266\266`\314\200\222\365E\004\306\260\210a\2214\264\241)\b\230\b+\246\306\306V\254\210!\342"
+	.string	"\365\031\034"
+	.string	"R\023\020*\354\324\341\222\033\021\226\331\320T\326\0271\004\004\024#\304\001\3523XB\341\222\327\334T\312\256\357IL\320c\204\330>X\212o\207\330\f\2051\361\037\023\307\370\354`g\034\t\312MW#\246$=b|`\241@<&tY\177\006&\311\351\223Y\222\323\344\026\2557\303\003\375\003\372\364\244\345\311-qJP\2648\353\027z\200d\0215\004\312:\211\245}\342\244\356,\353\344\025\242\214\245\277\036V~\267x\303\016\2170\353\317\260d\177\206\265\302\302\244!\tj\274\"*\304I\272\356"
+	.string	"<\362f\230\245\374\002\233\246\250T%\315\330f\345\262$\007\003)\306\034RE3\233\200\004\363\025"
+	.string	" 84\026\017\310D]\330\363\024"
+	.string	"\023S\314|v6(\317\224(\212\2243#\002\002"
+	.string	""
+	.string	" !\020@"
+	.string	"C\013\220I\375e\250\260e\013\005\271_b\204.f\343|Tz\201\340\206|\002\b\254\203\213P\036"
+	.string	"\225\244\021J\023C)\206\263p\2675\344%\216\274Y\n\215\356\"\235\353\030\007w\305V\362Q\346\017\240$`\304\347\210\224\320\020\243\275\2111\033p\300\321\021=\366C\311\372\236\223\316\335R\361m\271\336\t\266\274\330\225\372~\273H\262\2210(\307\202\\\222\370~eu$pc\227\004\2437l\034_\031\216\235\304P\032\273uX\242\211(i\322\3578\304B\206\0024\372`\344tG\346\320\027\275i\213\354\270(\330m\341\320\217\021\324\214\027\270&\370u\004\215\343\277\314%\235\311\262\345 o\222\0165\0219\355W \326\317\272\005\373\3658O\030D\tt^;\201\021\372\355\216\371\307"
+	.string	"\2618\200\362q:\325@\025`\202\327\026Z\005\177\251pZ;B]c"
+	.string	"\264N\227B\204i\3571\314z\240m\220\352\24702\356lz\201*\202\256\322\307\377M\240\225LThO\033\354\355\304~\307\340\333"
+	.string	"\013<\217*\3709\330\325w~G3\n\032\274a\212\177\373$D\360\361L+\004\227\231\223Tx\241\tL\350M\277\251\260\310\262\352\302\020\212W\235c\310\265\273\254\016V\023\303\241\026\f\362,@\314m\334\314\341\311\343\375#\273\002\234\217N\227H\247\253\223\034\013\327\200\206\021\210(\035G\237\374r W\270\322\232\302\200~\003\206*5\035tV[l\321f\251\225F\034\314&\361\332\247\226x1\362\f\355i2\033>\370f\341\3375t\241\244e \252c\217!o`\256\334]x\310t\r\"\212\301\271\025\326[8\037\236\340\314\307\033\tAZ \345\002\326\303\354\355\364\006\227\360z\265\177\324\032\240\007\241\256\344"
+	.string	"Vz\255&\207\214#)^\3064\205\370\3072\207\3301\305\276\264Owz@\264\007\313gh\034\274W|\006\276\225\243\371\214\b\020\370k;\207G\322ExH\032x-Oi\2372A\254\305 \226\031\216\271u\032\201\231\270\025\230n\003\274\310\241\340\351\256d.]\354<\267\306\b\n\364d)\341v\212\245\314B[\355S,\364\rCJR/\023\364\240\317j\353./Fn\343\f\343\306\217&\t\232#S\253E\304=X\006G\343\372"
+	.string	"\341]\007AS\037K7\004\342v\374\201\300_\016\301A[\324$$R\265\365~\237\334\212\313\202!_\253\231A$.}\3175\374\346Fx\374u?c\316\316t\\\271\002;\313t\247Y\215\275\2630\265V\262\250\371\341\\\267\0136\337\023+\274\270\036\242\031\275E\023'\221mo\355\fS\255\264\346ju~(`\221\235\212\251\352\351\210\246 \006s\rdkY\310\342nB5d\326\005T\323R\022\344\352\005\201\267\245\313N\355Q\306\262M\341\207j\026u"
+	.string	":"
+	.string	"^T\233\031z\315=\200\332\305\213l-P\\\030\210\324\230\272d\222\0079\315'."
+	.string	"\221\247\346\005W\272\267\335\3773\227\\\366\257"
+	.ascii	"Nyk\026&\247\363\252\r\030\311\206\204a\252\210B\211\250\224"
+	.ascii	"\005\335\250\r\005wh\3558\375d\210\243\3048\325=\033\366\354"
+	.ascii	"\016\272x\300C\365\232\346\306\371pU@\306\322B\224\037\226oI"
+	.ascii	"D\ndZ\200S\337I\004a\r\333=5\271\342\225y\314~ndz\373F+\343\356"
+	.ascii	"6\253>d\313\324\260\n*\311\024\220,U\3247\254\232\212\250\263"
+	.ascii	"K\255\343Y\r\006Dy\f\203\256&3\023C\277@(\002#n\207O}\217lw\005"
+	.ascii	"\275\322\345\270\034\311>\304\367EJ6\024\225\251Z47U\n$\304d"
+	.ascii	"\024\246;\227N+c\214\n\346\013\356lO\001R\206\006.\0325\327\033"
+	.ascii	"+\323`\255\212\305\027\242\352\257-\301K\037/_\210~\346"
+	.string	"\272\215\250=\231\375\366\253N``\255\330\345\344+\017\313\360p\360\262\372\245:rlm<u\220P\007_\t\307I\250\346c\365\207z\224\2407\271\271($P\n\205\261Ce\274*+\2613[m&\260\315u\251:\241\243\342\265\022\357\313\250^]\234\025\241\300?2\007xI\234i\224$]G#L\342\237\322\373'\366Y\321 w\230\251\256j\267\361\2406d\022\026v\216\371\217M\341\351K>fn\312Nk\001h\201\316\267M\226\f\017\"\225%\205L\263a\224\004\274K\024OOz\224bo\302\243\253\031R\326\263\224\354\312"
+	.string	"\237\236\t\270\213\353\335\027\013\320\247L\233\373=\255s\214]\337\245\374\373*\353\370RY6v\240-\364\230\020F$>\006\323\354\027TP\366ndG\321e\001t\267\375\231\300\357VK\243\221\302\022\311\302\274\344 \271p\206\002\325X\260\275\244\201\260-\304\203b|\276\315\301\333\t\232\373\370x\251\342\251\0068Vn\306\026G\200\036\212\243\234\202\243^\274\217\301\276kW\311)\035\016WXX+\024Q\3456Z\nl\300\242\024\234\214$\276g\244\212\346\245\307\240\2638\273\202\220 \304z\227\270\367X\220\r]\245\301\bLy\246\032n1\301\377\341\032\351\306\230\2523\314T\341\202\255\352\245\273\231e)\0201\350;\314+\237k\357Ek\277\240\316Z"
+	.ascii	"\003\366I\230\242\304\353@uW\363\350\245\302\366g2%\021\212\316"
+	.ascii	"\357\244R"
+	.string	"gG,\205\330,\032\323d\303\301\033\003\331\355\344!\330\b\312\335\326\363'e\261\"ba\311\273\3336\232<\240\002_O\304(D\206\2178RD\035\374\240:Af\370)\335\312\25500H\267\337\033\316\311Y=\200\200iC\374\336l\205\317:\250\276\354~\001\226\232*\343i\330\375[\302\314Z}d.\363\f\"\320 3'\334\247\256\026\201\200o\261\314 )r\230\326\261V\367\303bk\013Y\312:$\272\021\201\352\361U\022\003'M\034+{\332\004\231\262\257\374\360/\352\351\3154\264\340Q\022\324T\374\2629'U\036T\025\362hS\253\223\237\310\321A\363UKj{YK\204\321\216\307NP\377t\275\342d\211\314\354 \3730-r]=\030g\020\244&x\240S\254\2128\373J\b\262(Q\231j\256\013\354\271\250\275\2456\235P\335-\203\344\303\350\032\3230\237\220\341\262\243\272\245\322&q%\214\326"
+	.ascii	"\020\364\200\336\224i\341\274\260\326k\016!\354\276S\207\350"
+	.ascii	"!h\201U4\340\245L\235\330T\235\2421\210j\263x\031\260\002*v\216"
+	.ascii	"\246\346\0016\375\211\f\271\300\214\263\363\334\016\325\225\323"
+	.ascii	"\031\"\235Q\212\360\253\337\003\003\235\221\305\267\261q`3\242"
+	.ascii	"\314\356pb\031\260\314`\361[8\354O&\202\205\342\314,\342]|(\374"
+	.ascii	"b\224.\336$\302\255\036\034\260\252 -;M\225\236\341\341u@\036"
+	.ascii	"\315?\205\236}l\325|!P!\316\203)=\352h\300\314\263[\251g=a\372"
+	.ascii	"g\177\301\275\325\373?\370\361\020\323\\z`\206\372\316@'I\210"
+	.ascii	"\216\n\250\347\n\352\377\0020\025~\177\255y/[q\f[e\311\204\032"
+	.ascii	"K3\315V\036\213 \223\220\021\321\322pMu\020?\246W\205X\2501\322"
+	.ascii	"\266\206\301\213\311H\255\327B\335!\032|\001\025&P\016\200\344"
+	.ascii	":\207P(\224W\0024\201\215\323\246\225\304\233\021\276\370\016"
+	.ascii	"\035f\224Hk:c\260\225\374\373\200[\344\177\346V\243\375#\265"
+	.ascii	"\027\371+\b\365\256\316\2044,\004\262U\357f\352.\345C\202i\323"
+	.ascii	"<`\277\215\020\0370\264<&\\s\361\213\344"
+	.string	"\025\332\r\256\340\213\227\001\026\3134\231;e\326\364Z\272=\374\361z\325\275\016Vn\3157\021\347\364\236\0354e\346\007\230\020\252\307y\377=Ji\310/\343fSgJK\031}S\2772K<NC\340\333\255\340\337\355P\207\372W\364\006\n\354\370,o\r9\034\314\252K\371\322\216\375=\320\013\016\313:\201\374\302\005W>L5\253\023`\311\235\237\210\255\257\027.+\276t\350\204|\f\233B\361\2555P\314\204\001Z\024v\353\305b\304\314\226\322{?\177\301\370\332v\361\\\333\232\037\026Ky\352a\202o\r\260\017'\262:\243\005\317\032\365%V\031\242_\234\240u\375]M(\316+\340(\277\344\004\177\203p\220\f\325\3641\017\316\177\326\233\376`\034\345\220\217K\312\234\235\364\037\217\247|P\316\323u\272u;\347\220\321%\306j\316x{/B\301`\316>\034\030\365\327\211=\371y\223\211\200\3022k>"
+	.string	"\221\352S\267\242e\024:\355\2740\246\016\232*\177\256h\216\337\352<\340t\001ku\273\212,\316Uq\341-\313\n\245o\310\022D\331.\331Fu\272\177\327\367\017\241M\246\336n\351hq^6 \262d\230kx\222\016\202\274\034\360\b#jP:\327,&\2430\355\305\274F\216\2728\260\372_5l\3406\"\360\202\307\225@NM\232\217\312ac\351\031D\357\250\326\225n\375\220\250\216\030 g\007\033n*\210\035\373\225\024\304\321\005\254\b\033\317<9\243\341\306Evq\240!Qy\035z\261~p\205\026\374r\350I\356\255:#\302\230\337\237\016\006\251j\357[fE\335\240\273\227w\372V`\207\003"
+	.string	"\236\344*\230\361\321w\021\276\031\017X:\302\200\245%\332\020\033\362\327jF~9@\020\257(\3050\331\337\345\257\376h\016h\270\237x\003:A\254\006\320H\300\201\202\331\350\027A\037\233\211\332)\247\365'\254\342={i7\274-\2068\374a\2652\230\365Y\377kxS~\271t\377\020KW\261r\350\373g\267\207\200\306\347\373$\317\344\2627\rP8m\203\rOTsL\370\332`\024!\026\253\307\026\362\007"
+	.ascii	"\343T\311b\245\337\005\332\0360\357\343r\237\033\344\002\216"
+	.ascii	"\005\037\230\276/\233\ns@\277\257`\301\267\263R\354\206\326\202"
+	.ascii	"\323R\271N\330\024\221Vx\243q}\220\313\251P\201\003.\210\004"
+	.ascii	"\234\352\006\305\266-&R#4v\023\205 \367\031\267\212\365v\230"
+	.ascii	"\371\225\326\257?\032\335:\261\374\277\207jz\021_\261j\276}'"
+	.ascii	"\312\372\245\245G\314U~\206\025\377\212\356\r\242\035\247\316"
+	.ascii	"\357\361u?\322\26232\343\323\314\006\264\304\352v\267\373\356"
+	.ascii	"'\024|\370\312\327\356\025\251\231|\221\255Nyt\241?/\257\342"
+	.ascii	"\026\205\r\017\351=\320+[Vh7\270\033\315\345=\2509F\327\371\255"
+	.ascii	"\300\223fe\210\2124j\356\006?\266\256e\272f\017\243\246\327L"
+	.ascii	"S\346YK\342vp\314\24171j\b3\312}\203\002\247\025\237|\324\227"
+	.ascii	"C)\376g\364\251iG\037g\257x\352\r\377\377\345\361:\240\310t\271"
+	.ascii	"\177\213\327\031\210\235S\220/\322A\377\224a&\217\236!\"\345"
+	.ascii	"\334\261\306\275S\2765,\307\225\370i\202@\272*\035'\235\033\377"
+	.ascii	"V\327\022u\027\371\366p\024\240\303\337M8\035k\306\224{\205a"
+	.ascii	"M\213\t^-\377_\024\256\357\3724I\211vV\235p)\315\363\343\034"
+	.ascii	"\363R\245bK1\201@Y\243)\357O\250\316\246?\242\272\317zTG\363"
+	.ascii	"B\032\262\367\365V\265\307\357\337\224d\353\336\342\361\374\231"
+	.ascii	"3\311\304._\261M\021mx8A\374\b\340\335\234\366\212\001\037\357"
+	.ascii	"\246\356\213\362S\217\340@6\325\217\232\352h\002\366\223\304"
+	.ascii	"\214k\347s|\206\2313\f\353\377\344c\255t\314\222\032\270Q\234"
+	.ascii	"\241(\036\317\220\236\024\201@:]"
+	.string	"d!2Q\230\204vDg\343\203\032\224\213q\307\337-yB~\246\332z`I\314"
+	.ascii	"\362\3611\257\360\371I&\272\253<K\313\032\205n\201\275j4$\227"
+	.ascii	"\323\360\374\210\223t?\360\340}\364\330\365\220e\347\001\260"
+	.ascii	"\326'\002Bw\376\265]1Y\366\307\324\250\313\025s\212Z,\336\332"
+	.ascii	"u0\361\241\364\017_\333\216;\214\017E\326\237cF\022y\335\017"
+	.ascii	"\266\017\217\323!\364\237F\320e}+\200\317\337\245\217\305\020"
+	.ascii	"@\377M\033\225Z0\333\2135T\304\203\216\335pR\177\n\034\370\213"
+	.ascii	"\005%m\212\303$]\326V\300\016\216\252\312\204\230\303>C\272\250"
+	.ascii	"K`\007:\333S\305\316K*Xh\330\r\224\377\351(\\\315:\2202\325\233"
+	.ascii	"\202:\363\001Q:Q\221\343\3771\021\344\027\376\335\006\231\213"
+	.ascii	"\210\316\371\\&\2649\035L\277>C\257\371GK\214#\345/k\350\321"
+	.ascii	"j&\365d?"
+	.string	"e6\002\007\005H\210\341c\367\220\341Q\273\363\017n\360\220U\310\312\217\"\263\017\365n[\020\026\203h\275\n\020{\373\342\201\227\207L}SJ\313\226\357\374\277F\207C\315a\347\001\361\002\256\007\217\323\370\2457\225\213\273\013h\350\262}\020n\351\373q2\351\275s\300s\265\363E\345X\246\224\201^U\t\024\007P\373\177\216c\316\350\314'sDf\342\255s\fNrZ\261\313\332\372\3610\256\252\277\233\203\277\030\273\201-\303\230m\037\035\204L\237\336\245QK\007\275h\337\276\270F\316 @\257\253\260\205\346\2505\347\363\006bzh\266\237\313\314Zs\356\374\306\312a\311q\033&\300F\016}\312(k\233\332\320\376\342i\254\325\233\030\302*\310\223\355\224\263\227\354R\r\275\345\365\230\225Nr\003\234\023\361\340\346\213}Fh\263\247\276\302\362sx\033\371J\205t7\240&\013\353\234g\031\242\242\017%\234\231\003"
+	.string	"\267%1"
+	.ascii	"\336\2376\256[\203p\334\353\202\244\246\327\276\032gay\316U["
+	.ascii	"GgG\r\370\266=\317\343Q\253J\361\336\340z\031!\347-{\364\374"
+	.ascii	"\021\240$\335#\265\333\220\202\037\177\032z5\320\360[\215e\332"
+	.ascii	"no\206\241\024\331-\327\262\323I\373\324\274\342\257\257\263"
+	.ascii	"~\265U\tR\b\352H`U_V[H\002\370Cv\264#\332\2028`\021\313\326\267"
+	.ascii	"\226\023\330\366A\207\212 \263\025\363\360\243X\207\263\346\372"
+	.ascii	"+\271\341z\271\263\315\3061\273\006sD\231SoU\301\202\275\013"
+	.ascii	"!\r\211\325\026\361\202\022y[\316\n\300)\341w\224\302\362IZc"
+	.ascii	"\"\0213\366U\375EM\224\242\211\024\217\270>\234`\341V\221Y0/"
+	.ascii	"\307\260\336\267\317\034a.'\020\360n\254\247l\374[DM\363\312"
+	.ascii	"e\321c\022\216d0\024^@\332YD\320%\321\335\301\373\022e\265\007"
+	.ascii	"J\322]%V!\0011k\033\031\245\020L\313\231Ks\214F\203~\353\277"
+	.ascii	"lG\316\202%\314\3524D"
+	.string	"\272D\021\007\202,60}\305@+\345W\364\262\027\036\020j`n\264@{+\222\265\354q\247=j|\345]@\212\234\037\244{\336\177\264\300\232\321U\013\364\374&\003\236g\"\353Bw\264Kx\242\314P\310\323\207\265ph\264\365\224\271\360\255i\324*\204\242\222\336\346s\206'3*\033\030\300)s0Q\272\373\270\240\353\245\036H\037\023\\Z\260&2\234Tc\241t6\032|^3D\277Go\263G\304\242\177\263&\215\341\256,\333\004\254\236\273C\260\251}\264\214vu\0318\334\265\261\213\200FU\225\242\265@\341\037\245\367\025\361L\032/\0045`}\304|\235\313\\\252\372\373B/\031!\020Z\025\304\371\\\007E\222\241\373\267[\253\002\226\253\232>\372\306\260\033\007\0328\251#\334\257\270\277\346\376d\300\023\260\271Eb\304\367A\310\230\375I\245\254\322vi\314p\374%\3753g\230]\302\261\307d="
+	.string	"r\244\361\266\315\245\245\274}1\243]\276\032\004\373\256K\322\001\001\362?\324sC5X\300>\200}\300S\231\277m7\336M\305&13\001\0228\361MQ3\251f\241\207ZG\006i\215\246|r\275\257\324L\320\206\357\307\255\272&\265\344\243k\266\225=\352\031\b\220\314\313\322\t\036\005\210\226\252(Q\376\362\3222\301L\006\360\226YF\202\235\266!\304\235\256\325Y\006\312\242Q\235^\374"
+	.ascii	"B\251\350B\270#m$%\305wt\232\364\250T\351\376\035\3238\373se"
+	.ascii	"m\250\fr\244\251>F)\006HF\212\007\037l\321\016\225\305\327\241"
+	.ascii	"\315\2653\023\027\312\227I\016\370v\317\305l\316\235\266\360"
+	.ascii	"H\265Q\3358R\3478\331\027\260\023k\201\217\252\241\231qU7#\300"
+	.ascii	"\350\254\370b\\U\235\033:\241\2140\3344\023\306\035\021D\362"
+	.ascii	"\251\256v\367\005\376\003\212{\216\251\245c\357\2108\002\270"
+	.ascii	"\253QZ\\o\016\306\206\003#1\365l\352!\247C^J\243\3279\200\001"
+	.ascii	"\360\312L\264pKv\2703]\222I\3202\355E0\302\367\002\177\211\003"
+	.ascii	"\332"
+	.string	"\312a\002\315\002\351\265\224\246i\246\251\215\330.b\212\374O\3271\262s\307\263\356\314\275\255+MRyJ}h=5\354J\357\307\262\204$>n\321\210?om|\330v\2676A\\\b^\352\377f&\032\217\202\344\341\241\032\237\f\333\302z\270Btp\323\200\202(\231\234\322V\031F\311\271P5qz!%\276\253V\023\034PYi\2672,\020\030\b\226(S\242i\374\334\340\224\260g\016\021G-\372d\335\n\202\251\261p\266\261\364v\341v8T'B\205\360\217s\bB\356\001\273S\333\274\257\322\233^\37043\025\251:S\0257B\021\030\036u$\321\340\247\256\372\215e\226\226M@\337\235\315\3443\355\256\201q\2168-\022`J\016t\324\337\227`x8b\021\264;1Y2\314\363\003\223\231\244\357*\221A\251\277\213\b\220mf\355\343\310\361\254\236\b\310\240CT@M/\0170\207j\374 \271"
+	.ascii	"\225\313H\337\02762\207\276\221R\324y\245\362$\243\033\005\342"
+	.ascii	"\234\357\273#\315\214\353\016\2752\224\271\232\n\025\277\367"
+	.ascii	"A\334\232,jd\211\004\246N\375iy\257\262@i\256\271h)\372\314\277"
+	.ascii	"F>\345\2117AfIS\234\232\247/\224\342\337\3041\243L3b\256xcie"
+	.ascii	"\002\213\260^2\327\240\204\305lI?\314\\\221\003R\r\fZ\251+ \366"
+	.ascii	"\334\210\027s\236na\307\277\274f\325\2451K\346\324\241\371\341"
+	.ascii	"\311\nB\344'\353\007\305\222\2515\345\022\213\262\212\330\231"
+	.ascii	"\003\213\263\001[\200\"V\351-\301\225\024\375U(\366\fRv\340c"
+	.ascii	"\247\022\033}6\344N\234\322\347\030\371\266,J]s\226\204K\327"
+	.ascii	"+\331\304Z-!K\024D/\373\360gN\221\243\316A\265C\350\326\355\350"
+	.ascii	"\300\267e\263{\205\353\216\246\036\265\351\243!\020H\252\305"
+	.ascii	"\302\307\350\001\344\217e0\242-D\246\33023\016\370,\211\026\003"
+	.ascii	"\032vp\002)\213\323H\303\350\316\025J\330~$\244\276\205ox\344"
+	.ascii	"\253F\315_!\006\364\032\3548|\365\251S\231}\2719\325\322j\302"
+	.ascii	"\204\213\024\311\362\001\nj\272\213\270\",\271\231\206\r\245"
+	.ascii	"7\233\303\242\364Y\377\027\030\240*\352\n\004\f\302\324U\344"
+	.ascii	"t\230?\253\260\314$\215F\314j@\246\356s\236\332Ls.XP>F[D\004"
+	.ascii	"a`Xd9\250d\022S\031~}\016a\255\263O\034\211\240H\220\346U\nA"
+	.ascii	"\207Y\311/\367\340w\221\312\253\273\2526\303\350\317\302Zd\231"
+	.ascii	"\251\032"
+	.string	">\313yJVD\376)6(#\247)5\r\220~>\365G\323WN\224\2633+ZD\322\275{Qc\212\343\264n3\007\217\301\316\356S\334\253\024x\235\236\355{\261@\235u\243\221\202\254\255q\347\204\342\351\324Y\321\335\"\002\272\312\270\331\307\373\302\335\331\316\243\252[jT\221\316\266\205\"Q\f\253\036\341\330\232\004S\276\245v\220e\376\333^\315=\322\222\241v\364[\207\371\023>\026\211\333\300\204\254q6\210.\026\271co\357\016\363pHm\314\205!\023- \211\202g"
+	.string	"\332\346J\260\323\031Y\203\363\220\375\354\265\020\273\223\270\\\274X|\310\331a\273r\023<\236o\256\300x\223\2059\247\362q\227\351\327R\260&\032\305q\372\332%)\255\263\356\020!7k\366\241b;\340\3267\355K\331\2364\316\206\217}\312\332ig\307\"\177O\220y\345\027\204\244\234\330\314p\321H\325\230)g\334\260\033\226\242s\331X'\256\220\256]MC\0079\340h\245\252\307\300\035_\316"
+	.string	"\302\267@1UY\305\310\225\036'K\265\241\2173\231\360g\275\247\223$\3028\252Iy\322\267\031Lm\204k>1\372\324\336\027k\177\251\337E\307\213\2758T7\325\225\372\0168\312\372\206\262\243\325\0264\243\270\177p9\376L?D\bs\250\353\322\255`\250\037>\230!\205~]n\"\203i\373\022s.\340\345\355\353\347k\327\373Y9\322\264M-H\2446\266\253\222\317\376\242[\b?L\357\007\215\326\275\250J\331\241\b\235\211\031\323\"w\374\313\360\250\035cg<\022!j/Ps(\256\303\321\0315\026\231\260\271 \350lN\275\220X\222\212\274 8\013\303\2552\361z3\231\232\376\031\376\300\246\200\307\007\216\301\320\2343\034\357\300\250.\325\254\277\375g\272\t\031_I^\033\331\355\306N9*\b\263\234\303\355 w\231\323\214:"
+	.string	"\336\004\020\022\213:\331/\211\310\367\312v\246M\301\312\360+\227M=Na3\233\311\377\277\265b&\026\007\003\036\314\334\257\225D_B$\257\276:Ln\3303\031\np\211\375"
+	.string	"\037\345\202\nj\007\260\315\3670"
+	.string	"C\326\007\242\226\302\234\034J\343\242\213\336\340@\254\255\340\370\215\277e\205Q*\301\307\237\271\022\221\360X\236\230qwS\r\265H\225D\334\376V\363$\367\340\036H\303g\017\320\354\334Ed.u\325ak\302\221\236\257,\0020\t\362\261|9\031\0202\034\346\263\350hls\360\037\234\254\355\351lL\272\004H\031\205\017i\030"
+	.ascii	"P\017\265\034\r\341d'\214\007\020\001\254\2547\267\327\342\025"
+	.ascii	"\216\232\367\252\201\351\340.\367\260\311\224\374\301\367o,\n"
+	.ascii	"Q\206\367\212\324\207\2567E\025\331\315\031\260\275\232$\304"
+	.ascii	"\356\201\263\366\354\374$\344\255\2267\024\371\304&\276\251M"
+	.ascii	"0\250\362\216\244\031\344?\302\236Y\221\340\302Kx\346\032\275"
+	.ascii	"\n\352\300NN]\226\356 \232\260\335M\314\221\001;G[y\221'\372"
+	.ascii	"B`\020\330\233\347\331\312\345\333ea\312\273aR"
+	.string	"'\357\t\024Qc\320\357f\351\t\306\354\376\316\032\362s\315\317 \362\246=C3\305\rs\346c\001M8\206}\364i\214\276-\302\003tbfa\245\314\324\333\264K!hFWV\001\234\356\303}`\232K0\310\026\025\366\025\214\035\324@^\221\357\377\2217e\022|\331kR\313=)d\007\234F\027\212\376\200\027\016F\253W`\244\372U\337z\220{g\361\237J>\204\226L\302\035\272\023\356V\240\027\360\363\210\235\0257+$&\300\2505A\3712h\326\0166\344\002\272\335}S\332\"\017HG\255\215p\342\017C\303\3636\312\200!\\\240\303D\261\346\035\330~\371\367\211\252\226\344\227a\371\"\325j\204\032:c\374\247h\263;\306+\231\267\321s\237B\250\243\221\211.?\022T\004\300\241\031n\360\277\214j\247L\316\f\310\276+\033\007\242\222\"\315\207\304\330j5\214\344\226\205\300\207\255\205W\315O\327\211"
+	.string	"\2605\262Rh\027\222\304[\005q\247\360\351\227\3524\326\007\272\323@~\255\300|\214\224FoW\241\bp\215\273(\177T\304?^f\263z\205\231_\203"
+	.string	" 0\026\361\362\222\336\020\"\024\255\034!\257^~\307\301C\230\332\372"
+	.string	"}\267\025\006$WY\001YcD$\240\r\345\016\232\002\006\204\037\214\374y>\273\343\240WN7\306b\003\367N\251Q2JM\026\367\316\027RJ\372\333\367\201\227\300?\255d\2644\003\023\177\275\t\251W\312\333\253\371\327Xd52\302XC"
+	.string	"\036'"
+	.string	"\337\322\271\315<\261\b/9\305\004\236\335\300!\023\342\303Hp\347\241\275+8j\361\372\314e\301\300\256\210w;\204&P\312\005\3427\316q\274\032,a\200\366(\247\332\325Y\034q6\024\013\231\301*\374\240\035*\376'\0316n\303A\324\255e\351\243\310\217\r\023}V\261\341V\364\300\001\377H1\247\265`\212\005\277So\335\257,\\\211S\313\222,\267\301\013i\254\370dtg\220\023\0044s\"\007P\255\373\316\322J\373l\266\252\201\342\202\331V{\007wT!\230\020pd{\n\227\224\270"
+	.ascii	"N\032\004\024\203\r\\0\006\006\361#P7\026\0259\216\324\207\210"
+	.ascii	"\037\215\006\361D\275\247w\361\222\217\236%O3,\271M\252\322\356"
+	.ascii	"$\330s\306\254\2524\315\367\232\253\0244V\333\371\252\354\340"
+	.ascii	"\002\315\334\227\232K9\210.\305eE\227\375[yH\0225-@ \215\237"
+	.ascii	"f\241\266;\325Q\252a\225\300k\231\300\366\242\247 \304\034\262"
+	.ascii	"\301(\t\20200v\237\335\016\314_\225\233\310\360\357\033Z\034"
+	.ascii	"\204L\030\212\034=\2232\221\t\035\037U\026\365=,\3132'4w2TE\210"
+	.ascii	"\351\023\242\227\212l\374\270X\354c:\254\323x\202\315QB\230\371"
+	.ascii	"Cx\232r\335\312?\315\217,U\2460~\373U\013n\355u\344\037Ph6\247"
+	.ascii	"L{$\005\243\354T\324\270G\275\f\002\200#\323\253S\302\312\377"
+	.ascii	"\244\001\244,\032\220){\267\f u\025\033\001~.\343\310\350\357"
+	.ascii	"/\353n\247\317\336AV\222\340\320\341\314\244\1774\230T\206\b"
+	.ascii	"\3434\002+\334C\331\237\037c\223\214\207+8{ \336\315\311c\261"
+	.ascii	"\036\r\201\2345\324#\331\272v\004&$\244\255G\020\303\004\003"
+	.ascii	"\235\301i\2373\177\313\036\331\214\226\n\031:<\345e\"\211\007"
+	.ascii	"\037\247\fv\366\026\251\2438\365\001!\2405c>"
+	.string	"0X\322\034\230\365\340?\3269\244\241\024k\333\027\240\353\375\036\330\266\032S\2228\373(\007\3409q%h\231/vtn\332E\240HQq\374K\347k\361w\\40\242\336\211>\027\374\273\216\330\200\360\300\204uSsfOUh\r\310\231\264;\254h\312\251\230\340>\337<!\327\227)\210\351\007\312\261W\360;c\261\253C\200\036\003\344!Q\211\021\270\243(@3\3678\013\333\347\017\307\332\372N\303\350\207v\276B\363\252o=\022\261\364/\323\223\311\246ju`z\264\341\013h]\276\254\361Q\363\213\225\006\2726K-\026\260IV\215\255$9\227\347!a\373zP\005\216\361\231\361\252\2548\212\240$t7\371\307,=\350\222\025\2107bl?o\377\245|\261N,5\357\226\275\374\347/\273\270\376\031]\321\226{\3241\336\243d\\\3345\313\\c\251\333S\257\220\265\242\025\3269\254\366\304\211ZwJ"
+	.ascii	"\351\004u\204\211\261\n\343\364>\320p0\234\007\225d\2267\033"
+	.ascii	"\235\311"
+	.string	"\005\333\312\3430\3351Q\274\371\362_\262%T\217\t\374*\034\267Ve\300\257\306\370\316\3471\242\244*]\313<\\hs\007J\331OD\221X\241f\2449T/\374\205\274u\231\013g\033\030;%\013\262\tB<\331\"kw\2451\n\f\021.\004"
+	.ascii	"\320?\335&\270%\3714\267NAm$Y\354,\207\211"
+	.string	"\024\3642o\327@\224_\036\351\356\211\322F\236\023Y'I\355n\212r\031\322\312\246:+\032P\313}\301-x/\226-\372\374\022\274]\031\274]\005\334\21701\007\222\"\320\216\371[\367\243PP\2459\223\\U|\373c\355*MO\242\226\370\024\345p\030\302\2733\306\234\2214\016\261~\312\310p\347,t\345R\214n\375T\216c\bl\0300\344gL8\203\204I\021\360\021\342A\201\205\335(\322tV+\314YDK^\352R\2505\223\246\026\264CnrD\256\321\215\004\310\321\211\t\370\201\316+\2209J.\263\214\236\n\007\336&Eoq+K\234Dw\356\305\362\240\027,\227\215\347\323\350\224\036\305_\332\2732\207\2416\342p\001f\225Q\274\310\254\250\016\215\022k\307Tm\330@ZJG+v\225\347\0238\213S\211~\020\177A\246\3766(\376\005\032\321@\037-\346!:a\341\034<\324:~\030"
+	.string	"Ix\036\f\215\362%\324\027\205m\rc\300\303\272\306\214\273\177\274Pc\341\035\223\274\006\265j#:\242G\333\214\024\315\207\341n\023\004O\235\f\274\034%\362\f\314\245\355|\350\375\232\232_~\367Cf\207\363<\030\273\246\351-*\242\300T\300[\333\240\274\261^q?\210\302(\216\273\234@|&\325\263\223\2074\237^\0070!\027\016\002\231\214\251e\216\346\335\303\357\231\255h\304\2239u\266I\030\373L%\t"
+	.ascii	"~Wl\224f1\322\344\017.L8\221\372\242\3267\001\027\270\3465\216"
+	.ascii	"\203\267\357Y:\211\b\356t\252\222\257\344\007\262\215\222\276"
+	.ascii	"y0\256\250ANA\3300IH\026:\3551\244k\257\317\324\234,p\274:c\374"
+	.ascii	"\036\325l n\036\3306\374`U\016\024\207\312"
+	.string	"\331\204W\376\335\323\222\336\2056f\365\226@k\031\fE>{\312\367M\341PE\243+[q#4S\244\215+\311EJ\361\034\256\262\260\245\341\303t3\213\226T\332!XSw\r/\016\b\b\323\323f\340\311|\346s\363\033I\221P\240S\216\023\303$?\245\277A\271\261\325\260M\2338\0272l\232\350\365ZCO\331\312/\177\311c\243N\217Ao\250\365\243\365\243v\n\313\351\366r\316\002\030\245\333fL\215\336\256K\220OM/%\343\251\221\350D\027\232\356=\020\237\220\343S\342%7}PN\\\266\330\027k\207\212,hH\004#5\243\312H\265\201{\225\234t*\016\326o\370\323^\302\016=\301\354\313\343\275z\030\354\347\306\343\035\306i\261\272'\027\002\247u\211\t\370#\313z=\354\364\026\004v\201V\222@\b\347F\311%h\310\205sw69\253\b\301\221H\305\030\020}B\222\224\310:\346s"
+	.string	"\367\022~\026X\204\033v\320\317|\255N\250\024\334aj==\214\007,q\331C\2609\004\335\213\325\356x\361c\270=\304\215G7W\243\021\221K\322F\305\300\252\r\336Ao\234\321\272\215\\\207X\353y\021\367\002J\355\325\031F|\202\256\032#Of\302\350\027\n\344\177`\332\2606\\0\201\210\327\265"
+	.string	"H\030`<\t\304\251\030\\\323?P6)\2633+hrVD\216\020\361\340\220\254\244X\207\377J\031\272/\332kzk{\245K\273\372=\235\005\372@N\3359rI\267\236\217\353L\213p.b\256\203*h\2610\\\"j\251\235\311\222:Q\004\365\322x\301\376d\356\t\321\221\305|\265\204\300\f\262\332\324\250N31`l\216/\367\247\355\327\262\250\246\035`\224\204\256\327W\327g\034\006L\370l\331X\fcpx\026\243\345\213\b\307\"x/N\263y\266\303$\356-\310\237\271\270hD\244 \221\t\240\201\366\205g\202\361\002\236\213\366"
+	.string	")\271\260U4\334C(N%\004,s\221[\374\324,\301\330 !\304'L\357\246\002\257\371\002\024\314p$\343\254\032\024<:\254\320\201-\b\246[\311t\341>\215:xE`\367A\273\017`\214$\2157\206\313\363#\367\317\203\274\206\016V\027r\t\344\202\322^\034*\341W\313\263g=\364\325\375"
+	.string	"\002d\2101\371*;\225\205\271~!V\007\b\204\264\266\226\315Wb\202\027r\\\275MM\021v41\026Y\276\312\230~\030q\372H\373 \035\204\210\355 \221Vd51\245\216'7\210\340S\rH\267N\026=\022\300\026\244RM\035mn\301\274$\357f\264\210<\341\264b9q\245\013\275h#,O\022\036t\006\324HE\263x\255,\231\214\035\213<\316\3605\234z\232\027\360\230\277\272\263\265\245\201\352\223\222{\203a\022\340\311\250\360\256\330\265\345\bP\3511Pc\007\316\351\314\373\335Pao\376d\036m\374\340u\324\314\307\221\036\032\\\331\360'v\2161\257\214Kj\007\317l\0049~4\317\321eA\"\321\264\315\340\242\313.u\301\024m\r\030}r\351\312"
+	.string	"Q\340oN\251u\262*8\031\347\342J\013q\372\034\305\220\356\250\202\327\025\216Z<\307C\030B\346\377\322~\332U\253\353\tV\373\336,s\264\200\331\212\2021\217\007\003\3565\304\277x#\236,\276\214i\262fe\323\035\334\343\030\2100\237m\345\212\262)\367D\213J\374/\235\266\034\024n%wq\325Z\222\326[\263\003\250lm\017\376\213cI\202S\220M\217%\300\365H\266\344\247\276o0L\333zU\207\371\251\2522\374@\257mV\034\200\224:\252U&(\365\274\"\235\310\255<\f\016V\220\027\b&\207R\371\352.\\F\366\350\372\242\213\345\324TL\324'\022\310\223\017LZ\201\n\002!\032\264"
+	.string	"J|2F\006\304\316\210KS\233 \004#zg\372\320\312\222.E\177\n\325\002+\232\f\267\206g\373\036\326\270\335\346\177\306\260o\n6f\035\021\347\367\002\364CxB4b;\226bU\267\201\026\334/\226\035\256\316\005\343\007\276%\340\335\235\310s\262;\220\211\352~{\225\322_'(#"
+	.string	"\006\034\300\211\316h\360hV\274+\272J\302\r@\353K\260MT\260/\273Q2\336\2352\001\227\271-\027}\307\035\355\355m\340]\317&\t\373\b\217O\210\354M\345\232\373\021\247C\032\241\"\363.0/'\nN%;\374\316\204\272p4\2466\210%\315\235\327\355j\356\221GF\033\222,\021\272S\304{\265y\301"
+	.ascii	"\300\243\357\3200e\347\307\206\351\360\251\202\276U\r\200F\377"
+	.ascii	"'\rQ\207\302n\370\005\326\002\224\331\031\237\002\236\2531A\340"
+	.ascii	"\225WYO\2616\344\013;\317r]\345\210\001z\340Z\252\003<\235&F"
+	.ascii	"\342\336;\213r\214\342\230|S1\242?~O\0353\034\365\313\313Q\226"
+	.ascii	"\204\b\333%D\005y$\332\204\321\307\025$\351\026#\202\036\310"
+	.ascii	"\226\241\022\027|\204q\224lj3\256k:`\217_\226)X\203\260\003\357"
+	.ascii	"[EJ2\260q\377\364\343\3403\220\364\030J\227?\343\236\233O\tz"
+	.ascii	"\326\263L\265g\024\002(\360lr3q\274\360\306C\334pH\031\312O\005"
+	.ascii	"@\354\030x<\234\220\032\341\370\001c\t\341*\372\001\b\035\001"
+	.ascii	"\277\264i\255\371\374xB\030\016\353\261Q*"
+	.string	"\241B*\304\330\205Y&V\363N\004D9\206Z\243\023$e\030x\306\344\0222=\030\022\361\216\377\334e\331\252ZG*c\236=\177\266\353\267\307\233\242\224y\376\331\332P*\224Az\3750\320jR\265o\313\n\354\301\227#\331\266Ju\374lx\214u&Y|\326uW7\312\327\254n\357us\337\252\203\007\261\306\3025\306\212\231J\272g\301Q\305;\251]5\025\251\362\313V@\263\332?\037\217m\310\034}\031"
+	.ascii	"B\203Gk\003\204\237\245\211\212\260\310dM\273^\350\245\367\006"
+	.ascii	"\002\330\205(\177\321y\343\365*s<\b\363j\001>\203\315_a\004y"
+	.ascii	"\003@t\020\266\333\254\017i h\025~gP\332\336\220\345\236P\313"
+	.ascii	"B\033\3647\376[\300r\251K>\242\247o\022\236q\300\310\031\217"
+	.ascii	"\032\215!A0K\311\374\3463Y\225\001\214\334\246\214fo%\215v\337"
+	.ascii	"\3271\251 $\221J\373\350G\022\3743f\342\227H\234\\\256U\306\332"
+	.ascii	"qX&\362)\350\320\256\3017\317\032\276T\202\311\300\345d>O=+\253"
+	.ascii	"eeh\316\275\341;\302jx\tg\210\352\203F4\375\ty\344\230\364\250"
+	.ascii	":>\205\206\275\326\225\231\033\322\277\321\035 \032\f\225\031"
+	.ascii	"o\341\360#\273\353-\364ZT\230;u\0052-\252\027\300\f'\333$qBk"
+	.ascii	"\243e\202OJYY}\334\356\275\341\321T\001\203\331Cd\236\360\203"
+	.ascii	"`~\257H3Zt6#\314wLUB\345\226|\361\004q\370\267\234\032\304\303"
+	.ascii	"se\277\254f\265\374\200\342PB0\361\361:-\220\204\237X\020\310"
+	.ascii	"}"
+	.string	"3\023A\030p\374i\307&\347\fM9\3469\351\t\024XD\215\021\272jW}\343x\204m\311}L\340\307Q\325G\007Y\342\303_\225\251\204C\016g\373\231FA\355tO;H':\206\232\242\257B\262;\002\332QNe\2431\214)]\300\271{\202\022\230X\252\25616\353\023u\226|]Y\005\306\315G.\323QB\254\317%\245EK\304t\256\027\335M\b\375\320\261\323\313\377\304\fVh\326d\274\255\340*\013:P\302\210\244\373\234\303!\201k\220\345\354\031\343\351\335\233\r\324~\372\013\2057\246rx\246\255\221`\232\367Tb}Tw`)~\224\005M\202h\236_\224\202\335\315sC\toy\231\f\237\277\310j,\3632\345\363\273&\252\231\207*(\236\021hq\334\033\272i\\\bH\251D\027\006F\312\324\t\305\271|W\n\331\f\324\203!\227\350\225\226\030f\317\326\b\003\360\306\344C\376\332j"
+	.string	"\2072\205\364\357-\256\220\245\354\274\366\253{}\022\364\266\343z\255\311\317sr\247v\365\026\2718\252@\306<\236\266_\222\360\273\266;)\2142\314\324\b\272\24162\302\341\371\007\305\261\343Y\034\316\036\340v\fRRo>O\3636\324\377L\350\202\353`\323\006\026}i\232\351\210\t\373\216\367\350\244\225$\257\314\227\333H\340\340\251XGv\202\215\235\251,\337Y\367\024\376n0#~L\026q\212\352[\260\212\0229nM*\256\bPL\342\0257\314\233\202O\350l+(D\240]U\366J3\257^\"\204\276-\2404\033\256\251\210X\006s\252\007F\313\0025\237\233\353\021J\030\344\034\245\017XC\377\234"
+	.string	"\266\007n\313`\251z3hA%\356C\277<\213\232<\323\303\214a\354U\346\357>R!1\rt\271\"(a\300<\2574\346N\005Rt\337(cH\225\275Gf*\021\320"
+	.ascii	" \270\222\032\274\231\320\036u:\375\200\203(\206\220O#\245\251"
+	.ascii	"..3\350=h\341t\003\t\264\026\\~\370\227~L\317]\242m\222V\267"
+	.ascii	"_\362p\317\262\332\3665H1>\332\313V\256\332\237\\}\204&<\225"
+	.ascii	"\205[M\"\312\036\037\033\222\2737\241&k*\013\360\330\251\r(\317"
+	.ascii	"\004\361\274\212"
+	.string	"\346\330\313+#D,\206wngg\215\001\330\300E\230\207h(\253\242\002?\b\370\032\305G\202\326\347\005\253\006Oh!W\322\033h\020\330Q` \232&\332\212\3622)\372s\213\364\211\355\f\2072\370\273\021\3369\326\325z\212\335\351\f\nm\262\264`;9\037Q\230\322\262w\343\221\370\243>\263\032\262\252\346\003*\030\341\274m;%\272(;\216\371\003\237]\245\202\357\234n\250\211\215\020\343\356\206\304\356etz\026\024Iw\354j\343 \342\256h\230\341\242\007]\351R\320`\003\351\013\f\211\203-\002\337~t\t\357\251~\227\3529\266) \027\373\371\312\201\200\206&TEr\366\004\210#\275\036\222\247g{\311mx\240\002\356\0171\322\b\250\322!L\377\327\350\004b\241\313\222\372\345\205<\234\272\002\212\007\r\001\301sW\325e$\246\213\t\217\017\373\362\002)\234\222c*\331\362U\363/\001\276\255C\007"
+	.string	"\226\346\332\321\262\347q\201\202\027\206\025\331R\311\365\373R \264\200\325\r`7\020\276\233\351}H1G%\371\200\020\020\347\033\261\254\253\250\253\356\317\212\027\264\032\356\233s\247!yz\025-\215\323L\310I\240\341qBp\255\300eB]A\200/\235\365\325&\301x\323\273Pt\300\365\242L\345\372:\353m\276\002M\307\224\365\233"
+	.ascii	"\251\305\020\351\343\323\020e\003)^\211b\004:?\3316\207(\306"
+	.ascii	"\213\232\275\317\207*\021\fG\036\371\342 u\262\3303\022,\005"
+	.ascii	"\007\2305\265\0271\355\177\326,\232n\361/h\002\343\3709KT9\364"
+	.ascii	"!\237\021\274\330=P\222\020e\013\020\370\017\231Tn\225\320$\236"
+	.ascii	"\":\337\b\202\\\274\030\343/or\227\024{\326p8\263\335\343\356"
+	.ascii	"\032i%\034o\025\311\217-A;H\205@\317\213"
+	.string	"\026a\361\254\253\307\3401z\003\230\346N\376\351{\030\246\006 \257x\203\322\273\317\255\036\305K\245:\211\004\213\237R\372\342\201\2506(g\356\352(\023\b\t\332\277_AT\222a\364\374l\023A\004\346:\371\177\314\242\305H\020i\265\260m\234\336\f|\272h\2506\026I[\247\232\206\2242\375h\247\rH\022\036\366\226\274!\026\265d.s<Xm\367\233\261*\366/j\240\211\232%\331\007\252\2149\343\307\023\261G\r\315\035@\021\242q|\201;u:\212\034B\223\307\255v'\240\373\310\241\016\313#\300;\273\005\001\\\364;\007o\177DR\032\320\347\354\331\024A\337\215\344c\325d\2555\020o\013\3671h'S\254\023\273l\301\241\272R\326ce\2116\3630\265\302\263\313\327`6\207\245\324h\330\177\240}\201Q8d\367\363\242\214\347\026\305\333`\323\253\324>\3431\305\031\333\023\307S\214\220\"\020\031/"
+	.string	"\031z\325\217\2367\315/q`\240"
+	.string	"b:M\220\013F\273MZF\026\241\033\343\346\256?\2445\220\251@\310\256$\003Y\007p*\340\307\260\346\301\025\260\2055Q\356Z\206I\363\276}\236C\337Ic\236T\321\372\375a\250\005\247\327\351\350\3406\205\343\311\"\330\217:\br\266\342\272\332\3301\313\365\315"
+	.string	"-\317H\260\231\023\320b\244\027\345\2276eV\227/\254\316\275A\013\211M\356w"
+	.ascii	"\273@\320]4j}\f\f\263\315=\360\324rZ\325\035;\022\205\002\023"
+	.ascii	"\025\013\217+\234\332q]\341\363\240Cv\250\234\357_/hP\024\257"
+	.ascii	"B\226\037:\204\276}\302\347\205\006\334u\3059g~\360\347\352\322"
+	.ascii	"\202\316Z\027\232\277}\370\2701>u\273\223h\267\357\275\340\340"
+	.ascii	"\375o\361I\276-S'\030}6\231\354m\307\2579zk"
+	.string	"\013~\325x\177MTig\006\n\246\177\362\b\237\312\275L\267W>\345n\214\236\314\036>j~\f`\\\311*\017g\345\24525\177o\373\307\251;\336\026=Q\362w.\215!T\206\225\370\215\f\257\037\303\357\324\363\276\373\231\245=\272p\217[}\325\376dM\334|\r\273\370\254\3077\355h\250\023\227>!\331\374\245b\t\372\001^j\233\033"
+	.string	"dB\301\036,z\366\346\001E&Z\377\310\217\315\030q\326\217el\005\233\365\244\177Q\201\367G\323M#~\236H\037\277a\363=\304\237\325\310\321\344\277\027i\275B\036\037\250\276u4\361\361\346"
+	.string	"\313\016\264[\226W\211\202\203I\357\331\270\211d\375O\337~i\207@\215\311\362Q\332\341zy<_=\275Z [=\262\333ev#k\337\\\332\207\013\276|'c:\257J|?>\376\304\b?F\313\256\002\332\233\310\343\"5\251\264Z\235\340\257q\036\255\342@\323\031\341\005\326\271\305\026\244Q\341\325\005I:\226\300\274gv\360_'\035\037=\271\3073\203A\344\330\013\210\274\265\004/\266\344\217\361\205v3\027]K\375u\373\301\320\312512\376\252\207\377\034O\003\347\363"
+	.string	"\373\337\320\255\017\377\t\255%\327\226\314R\227\374w\224\237(\376y\321\020\370h\007\240\235\332\325\357\221\351\24670\335\220\357"
+	.ascii	"\327w\252\342\302\204eL?+\270\355Q\303\272\304&\377\r\250\265"
+	.ascii	"\222\367\217j\354\371K\305\204\365\360\336\263\353\233\230sz"
+	.ascii	"\314\016o\2430\320\305M@\304a\356\334s\336g\251{\222\315\033"
+	.ascii	"\3603\247Ol\257\200\367/\006\305J\032\351%\250\330\232\264\236"
+	.ascii	"\273\255\277\300\312e\257~\205\272\331\246t\256O\335\277&g\302"
+	.ascii	"\360Vl,\200\332\322\fnE\230\023f\275Z\210'\033\333M\325B;\235"
+	.ascii	"\301io\032\360\353\323\264f\343s\211d\211\301u\241\366m\226\317"
+	.ascii	"\323\366t\031\361W\212\237\350\3451\361\036\266\300\007\242\311"
+	.ascii	"2\326\263{\233\273\244\361oP\207\225\315"
+	.string	"\236\2177\331\266o\266x[\275\017F\032H\342\270\357\005\241{\325\330\376\325\313\315M\326\356i{\254\341\034l>\020x\352\360\023\254\364\373\344\230\247\262s\3727\004\313/F\361T\311\037\317\376H>\270\334#`\267\331:2)\333\377\361\316\033\307\236\036\200\246I\206\350L8\274&\226\036\327\366w\\9]\322/h\322#m\3327\271\333\200\333\370\364\003\206\377\r'\3757\354\247\"\355\361nX}\025\370l\225\267\375\346C\322&w\\st\024\007{\311\373\205\263\013\204\323<\3309\373\253W\3030\254q\236\t=3\365\273\227#a4\233Y\243N\361\277\254\272\326\315\245o8\271\377{\322\216\205\026\256iT\253><\t\266\250\324\037\205l\222\251\231\311\240\241\327\327\374C\276\275_d~*\200\274.\225\246\230\223[\250\211\363\330\333\323\263z\337@\276q\024\356\373\272#M\366\013]\347\255\320\225\211\277\331\335"
+	.ascii	"\322\353"
+	.string	"C\334\026\366\025\025\177\215\345vM\325\236U\321\243T5!\234\230\201>s\352\027\307\\\031\203\3125\364\237\030m\013p\365\255b\243\207\340x\377\232\247a|\366\332y\227\351\306\027\030\2019\322}\027\351\247\264\347%\324U\317\t\332=\304\230\026\221\317\236R-zv\301z\216f\376\006\373\250\334\270\\\367\223\251\315\342\304\247\027\303x\351\352F\3550Oz^\261\202\333P\020\037J\034e\315\232&\021\202c\245\375\2360\257\223\355c\374\017P\355\221q\276+\261\202Iu\007\366`\217\177\275M]U\355\277\356\231\225\371J\313\275\264[v\355\316\366\336\013\215\310n\274\344\213\276\320\237\005\016m\357=_2~\002h\333\250\237\0266\212\205k\306c5\353\365-\353\214\232\373\365\352\265i\240h^\013]\252\r?e\366\230_\252\373S}\362u?&\251g\241\021'\200b+\314%\217f\301\317\221\350\243\263Gl$"
+	.string	"xh\224\247\210C\370\222\357\272\367\374\277\301\377\245\301\347\002^\360\234\377q\346Cahp-\357b\323a\3008\235\350\252\234E\320\343\201\3562G\325\311\314]\036\232\0079\360Xd\337\024{\313\226\027\031G8C\335|[r\227h\007\036'\323\201:7\220\360\321\343\237b\037Ec,l\277\247N\357\267\305\333,}||ZE\241\366\005\341\025 \242\037\246\340\305\303\226\273\226:=wE\325+\251K?\003\354G|\334"
+	.string	"-\327u6\277\367a&\2133\001\335\227S<\276>\273\227L\342\346\362\254:\201\327\211\276<d8\b\241}\206\bFa\203\267\004\265\274\320s\271\255\274\372d\t\\\246f_7xGv\314fb\275Z\301\266S\363Z\223t\277\203\201\377\267\336\337\245\304\262\271\226\234\205\035\373\316G\366F"
+	.string	"O\023\331G\357\277\036\354\022I1\2202\327G\326wm\337>r\001\346\022\250\270\324\005C\204tx\344{\354\005\310\345P\311\343I\353\351\367\336\335_\276y\303/F\217\206\037\362\266S\362\205yd\247\264\0074,\353\217\201\200g\022\234\037\254\370\357\234f\306\357s\310\316\276\271C\210\203\364wL\272O\005\313\213\267\345\221`\003 v\034\352\265)\240:\223\224q7\357$_YQR\237 \323}X?\026\347\034p\342\265\370\365Du\027\320E\3270\276\357\025\320Ol\365\324k\217n3\326Ghw\326\232\247\331G\f\256\255\223\223\017\240\325_"
+	.ascii	"K_\200\2307\310\365j\212sF\315_\364\034\230\263>\357\224\233"
+	.ascii	"\331K\375\366M\225}\216+\247"
+	.string	"\333\365\307{\340\376C\311}\222\313\264\355\363\205\020|=nm\320g*\3714\356\r\017}\343\240\234\005\351K\003<\323\315\313\003\213\337\345\3267f\337%\346\344Uyv\217\016d\354-\273\274\007{\341\334\373q\260\007\203]\320E\0133\221}tu\272\007\205q\231c[\377\246'c\265\223\021+\003\031\362\307\351\221\273hV\303M\200\370\225\337\005#\240\201ys~\332\307\307\320\375u{Le~\rtH\221\237\253\2278\312\204\2346\324\177\333\331K\367g\312\241\365\362\037V\330`\254Wh\371(\343\246E\335JL\\\202\237H\017\373\375\354<3\267=\244\354\351:\217\341\324\316Gt?R\377^\342\372\257mlY\217\242\370\253\311\210\257&w1\013k\345d\306F\333s\215x\3500=\2331\247\350K\202\217\245\373\225\304:Iv6\t\206\345\363\237\301\t\207\240\266\3253\366B\361\257O\351\206\202|\365"
+	.string	";\r8\330\027}\357=]fC)\3712\264\367\264l\334G\362\263F\341W\205\2355\345<\234\257\370\t\352\257-c7Gej\364\364\325\332\207q\273\2734'\030\032\375&n\023o{\305\003\254,\007\273\236\247\221$\323\305A\276\357\255..\034\274+\346`\322\210\341|\r.7m\177WV\356BX\246\0022\326\226i\255\222\336W\346\366\f$\371\007\"*\347+\200a\217y\254\345\322\253'\274}X&\333\\\276\264\301v\374\327\312\273\305\213\2010\322&\256\227\203\3258\256c\332\215\347\365\355\222\274]\305\177\273=.\034\334\270P\265\365u<\265\326;\216\267\310wES:m\315\362\f\256\274\325N\003\271\246\333U\327\031Rp\267\0077\211\267Cdi\017G\262\037'\260~R\004^\263(\254]\263o\002\035\307\352\237\037\265\031\216\361A\243t"
+	.ascii	"\333t\367CG\336W\356O\206\271\247\357\033"
+	.string	"\360.\312\300\347\323\265\226\350\266\215b&\340\254\n\274\256\366\366\200\0207:$\006`\365\225S\377&\355%\236\361\204\265:\027y "
+	.string	"^\275Y1\333L\"\370\244\020\217\355z\265\274\253\343\373\021j!"
+	.ascii	"?F\031\355\225\277L\375T\331\246\364\276m\033/\302~Gs\n\332w"
+	.ascii	"\236\030\363\036\262\336#7\275\035\f?s\352l\217;J\336\350\024"
+	.ascii	"C\035\372\333M\210-h\330}m\237\023\357\207k\376\336\351\307o"
+	.ascii	"o\237\3662?\016Yg\200\371j\357\336_\220$\336m1\027\244L\237}"
+	.ascii	"\370W\2474\353.\224\307\245\353\265;\336\346\371A;\241\347H\275"
+	.ascii	"o\335\251\031x\026Po\203\361\345\250\301Bx\224h\321\263\300C"
+	.ascii	"=\035\366\007\212\036?g\222\373}\355\247\201[-\202\350\237\013"
+	.ascii	"\340.\325\005\035\035\373\270\307\221\312/\302\357\375\340?^"
+	.ascii	"\350H\301\037\271\334\214"
+	.string	"\266G\256&\036\377EW>\333d\306\377\334?`?r\206<e\327!\340?\336\267w+\036e\247C8\364G\345\266;-\023y^f\226xtMN\2400&\377\320\346\270\241\264\375\265\315\037\351z\033y\346L\017\203\350\251\036U\357\177~\331\367\177\377\261\312\305\377A\306\357\307\177\363\335\365\205/\336v\027\340{7\356~9sh2\375\243f}>\f\t\216\252\216!\r>d\377\260\310\346\\F\024y\215\370\205O\034\352\335\373\220\\)\320\317fp\321\276qq\223\312\016c\221\217\241\236\361t*7<q\326\355\203\360\370\355\341\265\243\246\327\334\361\352\035Of\003b\311\231\307\231\342\277<\034\325\322\030.c\217N\346\033#O\317\007\360\333\3054\2562:k\317Ne\002q\226\315\350\214\331\033\365\371\030xc&;\311~\372\252\343\037\300\274\226ms0\270g\376\366'\026=\363\007\330\"H>R+\274"
+	.ascii	"\221\246\r\362]\177~~\357\276P\374\252\245W\335\234P\334\036"
+	.ascii	"\301$\0325\332g<\357J\325F\r\341\003\374~\213\206\356\370\356"
+	.ascii	"_\304O,\353Db\035dU\263\224)\251\323\2178\270\363\374N\233\333"
+	.ascii	"\t\300\005\376\320\371&y\\\007\322\34215\256\356\271\333\376"
+	.ascii	"\021X\375R:%\251\366C\304\227\024\331na\361\245\250\333\223\017"
+	.ascii	"a\361\263>|<\253\215\251N\353c\221\364\177\200w\336\376{\013"
+	.ascii	"|\2213\375\nFl\341\3310\225\347\344T\336\323\361'\035u\337\226"
+	.ascii	"|KKK\"n\t\355M\227\302\254\331\037\227pV\315\244\215\346Y];p"
+	.ascii	"\245\025\327.g\266\336^\251\236qzn\263\223>\261n\213\256\235"
+	.ascii	"\214\001gd~7\322\324\317$\\\357\257\303\217oz\374^'\273\217\001"
+	.ascii	"\2531f\264\265_{6<\355\034\2549~\250\343^wm\355\211\236\314z"
+	.ascii	"\256z\230\301id\230\337\\\203\325\277\346\330\"\210]\034\377"
+	.ascii	"\211\302\236;\027\335\261\357\235\034+\017Y\226q\353\037)\234"
+	.ascii	"'\034\035u\341\325\222p:\\\372\347S~\017\363\25712]\300\375\237"
+	.ascii	"\2057=\337\245\177\273q\315\270=\373\3471p1\323Q\310|\342\305"
+	.ascii	"\004\364q\033\260\310\271\217\302m#\212\257\350\311\253\232\352"
+	.ascii	"\003S\206\244\332O\237\237\221>\273\330\260J\323\341\362;\241"
+	.ascii	"\241\035t\363z\350'z\335\213\324\275\037i)\246\3354\016<\235"
+	.ascii	"n\\\007v\271\rO\f\207\202\276{\"(\177\314\307\233n\257\351\034"
+	.ascii	"\210\226\357$F]\355\330\271\241YT\216a9w\240\371_\026N\367\377"
+	.ascii	"\023\255\235\013\274\016C\365\026\272\231\307\2669U\\\317\277"
+	.ascii	"\247\310\023t;\002\023\366\005\342\277\005?*\370(\365\212;?\020"
+	.ascii	"r9-O\241\322\035\336\274A\345j\\\256\271\256o\363\353p\210C\213"
+	.ascii	"\261z=\363\020\357\332\212\347L\3722\264\271P\1771&\216a\365"
+	.ascii	"\214)\353\343>\304\030W\324\036I\314\346m\343x1\217\003\234\212"
+	.ascii	"\013\333\037\200J\337=\2615\fz\235\026\204\277*:\354|\227\262"
+	.ascii	"q\352\222\243\250\377\026\035?\200\310\3452\273\032#C6M\253q"
+	.ascii	"\340^\f\260xa\017\361\353\277\037A\223~G\264\266~\313'~y\217"
+	.ascii	"0\022%\273!U7B\3550!\236\335\326-\334h\363\263\245;\340r\202"
+	.ascii	";3\347kg\3018\245\346\225\315\022\345\027\376\343$\375\222P\201"
+	.ascii	"\335r\017?t\302\313\210\bO4LAO\336u\230;\327\341\305\313\377"
+	.ascii	"\247D\216\207J\021/\212\017\376\211\202>\375\317\225\237\247"
+	.ascii	"\312\277\305|Qo\333\243\3777_\260\322D\305\325/\375\220\361\246"
+	.ascii	"\345\003\321-\313K\351\271\354\303f\333\252\375\024\270<f\323"
+	.ascii	"D\273\217t$sb\314\340\235\347\343\314f\241G\206\b;\235`x\350"
+	.ascii	"\233\335\320N\310\344\310\200<X\035\243\306\277\007^x\237\304"
+	.ascii	"\237HY!t\207\272q\321X\353\243\300\266\354\221\275d\361\315\304"
+	.ascii	"D\304\030\233D\365\351'y=\340t\354\307\033\206s9<\254\2518\263"
+	.ascii	"\005\277sp\235\350[\351\360\367\300g*\341\\\337|\342\3044 \222"
+	.ascii	"w\005\274E\373\243\243\213\374\361\302\276\237\022c\335\205\316"
+	.ascii	"-\367;\206\0170?I\257s\270&|\036\346\332\304\303h\264O\003\303"
+	.ascii	"\247\202\265\360\315\356,\207V2v\310#)\266\244\243\216D\371\340"
+	.ascii	"61\244\343_SV>l\275\342\352b&g\244.L\307\354Z\225\370VVW\314"
+	.ascii	"\334Y\374\222\374E^\375\21059t\020\345-\344\r\257\323\230\372"
+	.ascii	"\373\024^\314\316+\224\203{\036x\363\330\320\216GF88\375\272"
+	.ascii	"a\367\365[\027\361\254y\202!\2072\213\210\0349\317M\213'\243"
+	.ascii	"L\320\305'.\244\360\017"
+	.text
+	.section	.gnu.lto_.symtab.b0ce503e3041f83e,"e",@progbits
+	.string	"cliSmartMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\005"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\006"
+	.string	""
+	.string	"cliMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\006"
+	.string	""
+	.string	"buft"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\004"
+	.string	""
+	.string	"bufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\004"
+	.string	""
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\006"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\007"
+	.string	""
+	.string	"cliGetValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\007"
+	.string	""
+	.string	"cliGetDefaultPointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\007"
+	.string	""
+	.string	"cliPrintVarDefault"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\007"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\007"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\007"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\007"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\006"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\006"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\006"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\006"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\005"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\004"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\004"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\004"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\004"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\005"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\005"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\007"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\005"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\005"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\005"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\005"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\007"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\005"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\005"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\007"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\007"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\007"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\007"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\007"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\005"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\007"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\007"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\007"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\007"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\007"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\b"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\b"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \b"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\b"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\b"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\b"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\b"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\b"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\b"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\b"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\b"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\b"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\b"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\b"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\b"
+	.string	""
+	.string	"mspProcessInCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\b"
+	.string	""
+	.string	"mspCommonProcessInCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\b"
+	.string	""
+	.string	"mspProcessOutCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\b"
+	.string	""
+	.string	"mspCommonProcessOutCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\b"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\b"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\t"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\t"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\t"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\t"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\t"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\t"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\t"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\t"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\t"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\t"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\t"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\t"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\t"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\t"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\t"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\t"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\t"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\t"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\t"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\t"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\t"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\t"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\t"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\t"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\t"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\t"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\t"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\t"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\t"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\t"
+	.string	""
+	.string	"schedulerResetMaxOverheadTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\t"
+	.string	""
+	.string	"getSchedulerInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\t"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\t"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\t"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\t"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\t"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\t"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\t"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\n"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\n"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\n"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\n"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\n"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\n"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\n"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\n"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\n"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\n"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\n"
+	.string	""
+	.string	"rcSmoothingGetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\n"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\n"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\n"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\n"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\n"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\n"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\n"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\n"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\n"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\n"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\n"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b0ce503e3041f83e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
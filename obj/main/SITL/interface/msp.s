@@ -0,0 +1,4806 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\333\b}\023"
+	.string	"&ZQA\360\322fX\003(z\217\360|8Lg0\305\316\347a\200\016\337K\213\361\257\273\037\314\214l\"\233\310&\344\365{:\356V\327\212\024@\001"
+	.string	"\r\362\230R\021%\204\240"
+	.string	""
+	.string	"\n\036Z\322\233\226\264$wJ"
+	.string	"8"
+	.string	"1"
+	.string	"*\264\036C4J\230h\003\324\216\234zS\"\263\220"
+	.string	"F\335\232\236^\323\332[\232\221\312\220x\005aa\032\242\343\304\212!m{\371\020\375\224FG\027\213\0359\305(\n\3721\302\264\032/\034)\036\206\n\352\001\312\201\211`'\241\263J\310\032!+\204\254\017\256f/\317\245K\313Y\262\\\271\342\340*U^\203\247L\311\340\013VpK\020\301\017\314\242,i\340I\001\223\004\252\016()\340%I\362^R\367\346\315\3259\034\346\357\356\367.[\363j\356\345\033^\265\t\323f\315\032\316pi\236y3e0\334\205\367Zx\314\2231\303\2540\205\331\354\335v\302\330\366\362!\372\331\3012 \023E/\\7\0367l\364\264F\314\226P(\200\310\340\321\021\2012r\301\343\003F\316\316\235\256\256\255\255\256\252\255\252u^\23529\033\315{\357\205"
+	.ascii	"\361\003\316\226=<R\213\324\216\242\031B8w\030\200\237\250\301"
+	.ascii	"I\251`d\244\240\240 \311p\360\002\033I\0227\022@\343\024\016"
+	.ascii	"s\024tB\253L #A\205#A\202\222\202$\205\031\0162\316;BY&\2557"
+	.ascii	"2\350\t\371\227\020\004\2136\247@\247^V\024Y\351\325\333\351"
+	.ascii	"b\226!\025;\341N>\245CW\272'\214\257VF\262\\@\243\273QOm\214"
+	.ascii	"\333\377e\265\244pB\375\346\252m,\375\231\344K\343=\325V{\320"
+	.ascii	"\013\255=\260\317~\372X\207\031P\034\261w\314\005\371~l\245\374"
+	.ascii	"'\267\202\031\364\023\024\235\337xt=\313]\rN~\326\300\305\234"
+	.ascii	":\277\177\326\267\030\271\320\345\034\352T\205z\321h\350j\200"
+	.ascii	"l\206IF\210\251\270\034\362\336\246\030\307?\306\236g\016\325"
+	.ascii	"\216\334\253o\370'\373*\366F\216\023J\347\316W])\330\262\240"
+	.ascii	"f\355'\237\370\337\257A\332\025\203\242#Wr2\314\177\310\210\361"
+	.ascii	"\225\375)\n;\243\005H\256u\221\022\020G\242v\\\237\321\263\332"
+	.ascii	"\020\t|g_\223;\266\344\371\240\363g\314\272\220\0277:>J\316s"
+	.ascii	"{>\260\360_d\027\246\036"
+	.text
+	.section	.gnu.lto_.ipa_sra.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\b\030u\022"
+	.string	"\322K\032\035\240%I\007\377\377\377\377\377\t\376"
+	.string	""
+	.string	"|\376\377\004"
+	.string	"\034\256L\342\227\304\375&wJ\001\356\032\\\360\250!A0-\3773@\264\024\277\257\257\357>\273+\251\021 \363H\277m\333\373\355\275\367\336\323{\357\275\237\202\264E|D\347\275\367\212\221\210\003\250\017\021_\325\002t(\326\001\341\321\220\230W\034\016\236\207\204[,$\004\201\b\250\001\352I\nm\006\321\005\0061\247\252D\017\022"
+	.ascii	"qP\212BY\024\303 \b\021\241a\306\020\" \304\020\242\214\031\021"
+	.ascii	"\031\241\231\272\001Q`c\017L\343\376P\335\030C\002\252\222\374"
+	.ascii	"W\336\305r:\177\002\332D^\337\312\261\305o_@\002\313:_\340\226"
+	.ascii	"\215:\253\262-\231+\305 \335\207\254~\217\007%\224\2771\343\233"
+	.ascii	"\273\271\032\314\351\330\305VY\022\320\320\266&\314v\305U\232"
+	.ascii	"3\241gP\343\2648\206\351\365b\030\027:\343\310\235G>\265\240"
+	.ascii	"\227HO\354\333\370\275\320v\305\337\020N\216\013W\021\251\211"
+	.ascii	"\310\212\203*\254\3248g\262\243\272\240\0218\025rX\362\371\247"
+	.ascii	"\353`PSQ\310\320\332\3363yM\237\332MuK\347T7<\030V:\031\271X"
+	.ascii	"\036\237Lel\234Ik\334\200\270\261j\217\376A|\222\203\030;V$\355"
+	.ascii	"\035\243P\002M\bz>x\023\371\322\275F\215B\221\023\231|\347@\213"
+	.ascii	"\226\276\3718HQt\372\252\310\303>\rJ\352\016\342\347U\032\230"
+	.ascii	"bP\253\212\360\023\222\237\333n\352~\215;T\2012x8\321\207\034"
+	.ascii	"\356\240\217\034\263\370\033[\223\357S\212\202k\030\023kp\270"
+	.ascii	"hm\032h\346\240\033\360\254\264(V\037W\347\327\356\f\326s\022"
+	.ascii	">g\264\351m\"s\217\225\b\230\020o\245P\241MA\340\212\212\004"
+	.ascii	"\026\335\263KG\250\334\205\204z\260\316u\024{\253\267\336\n "
+	.ascii	"@\020\336*v-\364\370\204i.\016\232\351ra\227\263ws\246]2\252"
+	.ascii	"\333%u\"D\242\tH\002g\214\n\257k\273[\027\256\262_\257\020\357"
+	.ascii	"]\302x\026u,\177*\237\272}\246(\002\240R+=\250\304\340\024\013"
+	.ascii	"\363ER\345\300s\234\353\"\352\334\374|}\325\024\332\nG\005r\031"
+	.ascii	"d\021\333J*\373\001"
+	.text
+	.section	.gnu.lto_.inline.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\321+]F"
+	.string	"\252@\334\rEp\336M:\323\225\257l\265Au\201fC\326\031\260\253P\021\336\233\222S\244'\203\345\370\001\031\277l\264\r\372\343Z\2402L\360c\202N\252;\200\216\002\314q4\340\372\213\025\035\256\237\352\232\306\226\260\275\245L\001\271"
+	.string	"\323"
+	.string	"\331"
+	.ascii	"6\210\316\346\241\363\212YV\347\216\231v3Ts\3744wR=F\f\316\321"
+	.ascii	"\035@\255\225$"
+	.string	"\247\265\326\376\005\306\372\366\314\247\277\216\226\177\323\262\327`E\322\204|\332\367\3247\275\312\254\260\350\351\251\323Ls\346\006\223\335\353+y\3227\277\314\340`\241\267\267Sm\005h\217\227\321\371\362\262r\377g\263R3\303\030g\277\230?\273\361\311\223\205\253\324F\245\246:\2003\213\006\373\243F\346j\037\322j\002H\376\001\250=\024\211\242\231k\253\b\344\252\265\021ES\235\236\243f\333\275w\300\233\3717\001\354\377\272\371\367S\337{\357\370W\335{\255\376\376yj\302\335{\207~\335\223\264\004~\270xL{\350m\220(\334a\364R\016QhE\302\231\277\020\205Bb\274\245\214\2575\312\275oI\3677\277z\360\251\301\343\312\243DKwf_\313pk\373R\364\356\036\237J6\376R\363G\0235)4\213\350\177\035:s\344\270\265\305\201\363\246\250&\315\323.\346a\016\246l\313\320\003\207\r\027*LHz\300"
+	.ascii	"A\356\350\223\305<K\262F%\327\304\210\210i%\255\265ey\262\366"
+	.ascii	"\205\372}+SJ\231\274L\375\362e\323\310\264\251\276\336W\335\313"
+	.ascii	"\373\362\372\232\030$^\335\371\336\247i\204\206\320\214|\337"
+	.ascii	"\013\325lpU\330\024\235\336\353\233\\\264|\\\362\344\275\277"
+	.ascii	"\216b\207\255+w{\357\243B\374f\\\\\034Y\200@aWV\367\255\fZ\006"
+	.ascii	"$\005\001\271\263\356\r\313m\310\323\201\305k\270{u\343DK\230"
+	.ascii	"\004!@\372\024\313!gH\212\254\3054\352\331\202\345\222^_]\305"
+	.ascii	"\3524\257\334\264\200\f\235\274B\274l\025\021`\245\205e\0259"
+	.ascii	"5\023\035J\304\246fY\021\255\270;Sru\353\025\221\037e\b\320\030"
+	.ascii	"\377\250\211\025\306\0038e\030\370\031\215\305\360\031\203a3"
+	.ascii	"\376\302^\270\013\2171\02466k\326\324\306\234\231\221}\350\200"
+	.ascii	"\301\002\205\b\020\032,H \264b\006\303\306\024\021\312z\033\b"
+	.ascii	"\256\265^f\241\346[\246\224\355=3\337\263\265ey./\237$I\362^"
+	.ascii	"k\255\265\326Zk\255\265\226\371r\026:g\303\034T_\201"
+	.string	"\263\005\213\3107\203Da\023\244\263\212~C\265\030Q\030\344\350\364\251\207\210\265\241!\331\2461\235\025\262\377\377\034\323\227\240\224$\351\033\027\030\227\232\352\223\n \341\216\335IP*`\334\005\305\321_\303%\201\273\322\275\374S\017\357\275A\357\362\355\324\\\377_\217Oq\242\231\233\213\227\272\305\3448\256:3.\265\213\007\235\245\346\022\270+3\036|D\311\277y\357\275\3229\315 1\210\206\367\324Y\216\204\345\340\275\257\325\270\005\304\301J\375\342\277\006\007\007\246\346\0370@\230\274\315E\324j\331\262\275\347\262,\231k%\351ef\376\275\226K\312\277\276A\004l\212\2567\367\270\021\243\024\365z\210\203m\230;\373fZ\225>n\312\267\212>\355\315\266.y\200\366\365\327kc6\200G\267\275\356\022\363\002\326\227N\363\t\2364o\001\202\270\250\302K\317\b\t\311H\222\202J:\322\n\020\220\005a\024B){\022"
+	.string	"\302\034\306\222@\013\"E\214!\304\bDD$\020\021\tDDD\2224\351\234\254M\360)Q\344\357\377\263p\250\315i\2002\306!\002:\254\r<\324\271\303#\231\301\305\317\226\200\017N\025QS\311\305\263\250\217\227\271\0226\303\f-\336"
+	.string	"\225\031\002\262\f\274M\366\250\007\275\245\270\306\321\213\255\224im)M@\371b\326\354\027\226\001\254\022\232\322GT\312\032^=\344\246\002\\I\264Y\254|Uk\013i"
+	.ascii	"s\301\236\214\310L\033>\262v\307\325\244\366\335\237<\350+3\340"
+	.ascii	"\264\330\333\2217\355mA\347\211w6\221\322\240J\342\222GQ\242"
+	.ascii	"\276[l\370+\23414\210L}\250\206\274\241\214}G\\a\"\342\013\222"
+	.ascii	"\n4\371\212{\377\335\374\303\216\231hP\216A\255\375r\3546\303"
+	.ascii	"\274C\bKM2PT\337\312\263\204\266#\3751i\243\350K\006\344\216"
+	.ascii	"\372\002\376[\201\037-!\203\300I\274?%\210c#\205\005\311s\344"
+	.ascii	"S\226\004/g\321G\207<\274+\035\304q\355f\007dP\245\260\251\206"
+	.ascii	"]jB\351\360\251j'\260\r#\236_\337X+&\360\316\224c#\002\36666"
+	.ascii	"\350\017\354\263\304\256~\016\274\360\244\335\271\331w\177*\352"
+	.ascii	"\366\345\251O\221\274P\260\004\364\005\2061\"\2403\234C\003\021"
+	.ascii	"\343B^OKK\340\357\245\030\236\206\021\317\f\263\300\252`x'M\210"
+	.ascii	"y}\034\277\327\267\030 V\342\217-\206\240v"
+	.string	"h\357k\353'\305G\330\205o&\327\323\361\270\035cx\241\345\232o\031\343_\005\355D\f\276\035/\2511:\243d\337\272I\3626\325%l\306\b\236!\251\n\260n!m\036\264\214\037\207\327\234Ja6\322Qw3\270\034\026\300\317\207\365\272\r\3172F\240\021\033\364\3753\033EW\231\363\313g\023\351\361\257\324d\215\317\246*|N\n\243\250t\240\236g\365/\366\177S\372[\030\364\335\336\353Ov \"\226\300\300\357P\2706\326\211\"\334\211\200:\342\321\031\312qDT\272\316<\237\271\336\004\216\250\330\205\252)\031\002\311j\270>\271\033\217\372\205\b!)#P\275\0138\253\206\035\007\237\373\230\241\214\277\030\244x\005\213&\274[\2106\213\304\240\241Z\b\250:\024\206\002\342C\235\200\304\242g\311g\034\350\350\237#\037C\260v\033\246A>*dj\b\b/\235G\263h\360\b?gU\345\233\3548\344'"
+	.string	"\b\206\337\362a\251\361\237\020\316a\264\374\215a\260\336e\226\024\006\223\205?\233\316\277\002Y\255i=}f\002\366\001J,;8\312p\022\220\344qA\205.\374\335f"
+	.string	"\3233\335\324\220"
+	.string	"\356D\np)\020\244\017\021q\236\033q\267\274\333\270\265Zo\317\327D\321o\243A]\036\232\b\344\205\177\".\326b\271c\377\t\r<xp@\221!\201\030\035"
+	.string	"\354\b \365I\273\235\022\363\270W!\024$\331\023\263;/\205\240\001!\020W\241I\212\244\352^b\006\004M\365$1\t\276YK\026\263\203\267\342\rT\362\260\006\257\357\257w\371\307\351\314Q\024w\002\327:\344\2524\202\"H\377i\305\256\227\347\300\261\340pW\3036\334\237\017\235\037\237\0359\036=\301i\334t\236C\241p\234\001HYb\373|\274\t\342\253S\022p\230\222!\277^\363j\344\240"
+	.ascii	"\244\262\260\375\224\211\370\220K\302\306\240\\O\261\321j\016"
+	.ascii	"\277\fZM%?<\204w~\370\032^\223\350:\372\033p4\216\370;Ln\rk/"
+	.ascii	"K\334\020q\243$\341F\366[\2360\005\\=\017\201\177\333\374T\367"
+	.ascii	"\341<\206\247\177E\214\177|\310\360=\202\303XU\201\256\fM\300"
+	.ascii	"\337r}\343\320\276U\336wP\347\304\217,\b\235\255\353\200\376"
+	.ascii	"r\271fjNA\233\322^b;e\320\341!\236\304\200L\027\245D\355\355"
+	.ascii	"\340\246\036_\352\216n4\312&~D\312P\367\242\272\367c\005\251"
+	.ascii	"sh\013\274\210\001\\\330U\202+\327UG\344\335\026r\336a\024\272"
+	.ascii	"I\301\215C\206\236sY\217\220b\003\001"
+	.string	"vS\245\2655\344\242a\233\334#6R ,V\336\270\225\326\322\033\013\261\203Ax\242D\340\225-\234{\362\223\322\247E\022\302\215Q\t\333G\005aw\247\220)\263%\350xB\030\211\317\302\032HS,\220'W\317\022}\372\215s\241\001kMy!\244\250\017\0300x8k(E\205\034\036\030\260\240\202\020\323\306\007\364\025Y\355\206.\317Y\321\256\327\204\324\004y\375\236\016_\341\312\272\225\303]m\236\220\211\2228\212\364\"\237\266 \260C\0371\261i\t\n\t\264\r\346\324i\005\3342\003\354<\200\030\313J\021\013\223c\016\347\304\032\345\261\004t\003\377{2\302V\200\305\372\3341\230\""
+	.ascii	"(\242@\fW|\306\372\252\005\023\b\363&H\314S\245\212\313'\264"
+	.ascii	"\360\377A\356D\002{3\364F\247\245\326'SE\3138,4\277@\226\317"
+	.ascii	"\324e*\237\347\271.?\225\255\302\203\274\361J\005\347-m\222M"
+	.ascii	"\273-k6\2677"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`XBe3"
+	.string	"\006+u>"
+	.string	"u\222tI\231^\201\260\311\202\204\355\346G\025"
+	.string	"<\023\221 \200\224\364\377\377o'\bM\365\377\377\257\237|\303m[\020\317Q\204+*\340\002\007\210T\r\341\033\341}\325\354n\215\310$\003`"
+	.string	"c"
+	.string	"b"
+	.ascii	"(\246\320\265\313//\023\272n3t\236\373\307\246x\334S<\256\223"
+	.ascii	"j\0278^\340\372-Bys|s=\245\032\315\f]\271Z\233,*o\223\201\232"
+	.ascii	"\001u\222P\366\2175\213\312\242h\225\240.PW\2042\317\177\324"
+	.ascii	"\371\207x\n\346\310=\227"
+	.string	"d\215Zx\3242I\026E\240J}\232\360\310\005+\001\367\210\373\253=\221\016\370\363\201\231B1a\270s\213ML\242(\2321\rJ\005\327@\212\005\345\242gX\232&\220[Z\307>VV\016\207%%O\323e23tG\376\337\236\264F}\342[\356\274`\342K\314\227\244\366W\\\022\222?\367n\312\2201C\307\347m2\205\204\262\222\177M$+\224\374\314)>\232\302\270U\271s\373\270\253|=\356\034\271\f\264\326\214\314\320\261\252\252*\366\005\b``\317}\315tP\036>P J\215\b\013]\215d\311\237\2677w\215\373$\277\375\2445r\3765\236@\216;\227\211I92O\020\272sR\220;\327U\236b\\\004\333\240H\230\240N\2609\177\265\347\363'\3777\001\\\001A` \221$\204\313R\266\376\301\255\335\271Vw\236\3234\361\366\255F,e,e\007\376\345`\2227\001\r\316\361\2222"
+	.string	"f\350J6\023\023S\222.{\036r\313\252\252\252\251\rW\326\245((\363\306U\b\305\341(\034\267\202\b}\356H\371\001\223\271\310\f\335\347>\343\274\034\003\365\266\322\341Z\256\306\027G\3214q8\232\202#\250\0224M\311\214\210\024$I!\035\202\n<\230\250i\352\334y\022@\2400\004\202)\216\304(\204b \206A\024\"\206\020c\2242\304\020\"\"3E\334\034p'\302\200\235\203\303\351A*\311\004\320:\365\033\352\3068\251\346\263\375;H\241Q\204 \224%_/\255\253\327&h.\224T\025\361EJ\032\324G\253\\3\230\204\314\271\223\037\245'\017wr\\\3041\022\006\027d\302\370\301QNE\346\255\330\235d\360hMZ\035"
+	.ascii	"o\233`\220c\317a:d%k\020\3525\234\342O\220\327\342\302{U\026"
+	.ascii	"\224\357>"
+	.string	"n\350}g<Z\210\263\321\350\261\342$\321\322\276\373\322\251\035<\300\341&[<m\303\220u\206\304f\337N\205\256\272\017\331\266(\332\252\334\032\027\303I;\3102l\260\016A\311\220\240\363\"\355\306\235\262\300\375\217P\213|\257[\334K\367\037y\205\232\024\331\340\261A]\003|}\203\306%\213\264:\252\355\250g:0UyB\b\317\305%Z\2039\n\375?\214\242*\321#D\024\tm\314(p\242,;\367\023\371\322\230\201\031\330b\270\220\265\3347\035\266]\226\2617\245\202\270ez\304\272Q8\024\036\002\374\267o\226\345]9\362\250\362\355\t\330hIo\227\252\021B\201\217\227u~?\264\006V\216\214\342\257 \237\022\373+he\026\005\255+\033L\037L0/\346H\361v\004\264R\373\364\206-\250\205I\230s\321\272R\020f\bS\362m\025\355\270\313\221\007Y\250sBr\256\\\257\033\013\263\306yc"
+	.string	"\212t\275t\206O\006\367L\023D\0237L\235\242#{\223QNK\036\263\212\230!\007\207Ge\363\331\357@\225\3413\251\030jK\334\036iF\321s|\376\334B\3041Yk"
+	.ascii	"\177\200\\\035a\312D\305\242\325\333]<\020\375=\374(\314-\224"
+	.ascii	"\347\301\215QR\314\036\340"
+	.string	"o/\026\0210%\023\001\203}\207\003\246\352\253\244b)\277\301\324\316\367\241I\022\027c\311*&\004*\321re\377\274R\304q\207\004\371\242\276\031\f\303\305\332\277F=\221\313XA\373 Q\315\307\324\bFAPn\257\227P\266k\246. 3&dUhh\257\220\005\177%p\374\316P\224\362AE\242\250\312\275\270\344qe\300\036\210\001~\244sz\302Y\305A\002\361g\217\306\235\350qB\005\\3\00409m\314U\275\364\016@\372\307\2136B\\\205\bs\253\017\231\361V\001\326\340\016\222\345b*M\340\271\300\376\253N\230\00503?\204\206\0067\273\\\004\325v\375\253\313\021\020I\207r\006\222QWG6\355\202\337\357B\300D\356\022E\344\312\214\377'h\200\274R\r\265\357W\316\265\203\243\366'\205\204W\005\250\330KR\026J?\237\352\002\206\333\250\375\263\247'\274\274\302\241\013\324<\363\367ZP"
+	.string	"\037\301Z\334\377\362\272i\305J\027\200\354bS\235r\357K\220\252K\360<\230I_\240\0364\343:\300k\244\303\002\377M(\365JAGT\"HKb\303\370_t{X\246\033\f\216.\305\330{\367\265\274\372+\261^5p\006\310\016\246\214:\363+\306b\267\205]\016\032RGX\017\3372\361\240$\024\363\261\026"
+	.string	"5\020\203b\006\315\303\273\307vq\342Vp\311\201\205\033|\202\376xn\374\356\244\200H\240h>\2655\233\3309x\351\003$\306:\224\243\3749<<\022\017\370\031>H\230\331\232x\327\273\002\274\344j\201J\270\fp\f\024\311H\305\302tX\365\005\022#\022\200n#\305I\3763Cxm.\340\243\005\214`\340p\017q\231F\215\332\201\300\002\264\317(u\206\304IX\221\254\216M\266@%pJ\213\226\375\244\326\313\377<`\374\207\2038\033J\026j,\315\022\220\025\226^\222Dn\365\\\002\346\300\r\036+B\035\204\254\023\226\214\212\330Y\002\310\347\f\374M\005\\\032O6\220\305\223L\322\273\002"
+	.ascii	"\377\003\027\"\207&1\313\200)\360bOb~\260\206\222\007%\234\245"
+	.ascii	"\306\177\34653\320\302\34582>8\b\346\246\202\235\202\266\316"
+	.ascii	"v\277-\225\314<2\347\024\006\340\253\323$$\343b=\360h\231\311"
+	.ascii	"\367~\326\365-\r\320w\227~*\207\331$!\030z\2045Y\304\r\232\320"
+	.ascii	"\272\032\260XM\227P\265A`\215of\204\240t\007T\210\0226c\b\260"
+	.ascii	"U<G\001"
+	.text
+	.section	.gnu.lto_.pureconst.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\001\230\004\002\230\004\003\232\004\007\264\004\b\231"
+	.ascii	"\004\030\271\004F\232\004J\232\004K\232\004L\231\004M\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\245\005"
+	.string	"\242H\034(\200EI\007`b\0013\260\"\034\221\301Fc\214\302\005\364\037\241c\006**\033\222,\026\360\024\271\360p\311o\215H\231\002\017\026\f\202\363\211\177\304\023\200\271P\216\255\3212\311\266\306\233\224\001\374:\374\212h*\237\332,\303C74+\212w\225;\252\272\223\364H'\244\374\321)\225K\235\216\316\250\274Qg=%\343\263\314\272\177\323\271\340\300\263\020\033"
+	.string	"\026C\020\257(\227\3518\300\230\246h\367\0072f\330\n{"
+	.string	"3\267\022\002\362\005#\033\211!\225\3330\224"
+	.ascii	"T\220-\303\336\254\264\267\024\"\260\360b\207Q\2431\003\003y"
+	.ascii	"\003\202A\301\003(\002"
+	.text
+	.section	.gnu.lto_.lto.d70dc03a5978febf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspRebootFn.168.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\206\0015\016"
+	.string	"6\331ZD"
+	.string	"\2216\035\333\336\227\201\216]\301\300D9\032_\254\342\004\311\224\277\334\346\027\r\201\207/b\035\r0\f\372\321d\fp\243\254\204\374\200\346\337\377wU\365MPL\264\023N\r\236\354\352\332C\332\356\266eJ\001H"
+	.string	"E"
+	.string	"E"
+	.ascii	"\037\326:i\021!\305\354n\026O<\025\364iU2*\310\307>\223O\001"
+	.ascii	"$Jn\351h\206\367\221\274\272J.?:\202\021TH\306\312G\362\030\022"
+	.ascii	"\232\031\0200B`\337\205\250\226\307\356Z\275O\303}\335vg\233"
+	.ascii	"\201}R\307J1L\241\330\331a\247Qd_bpIq\004mU\177~$\214yi\220\332"
+	.ascii	"\315\220\262\261&\371b\004\207\355\253\375\0227\001\372\211\n"
+	.ascii	"\037\260\013\226\\\354\206\013\254\340\272t\370\314\274\274N"
+	.ascii	"`^\032d\237\036\006\"\223\270\342\267x\r\224\365\240\302_\341"
+	.ascii	"\323u\003\363\322\352\255\210\013\212}\222\355S\245\302\262\333"
+	.ascii	"\275\203z\233\340@\210\336\260\217\342)4_\204%pz\357\322\347"
+	.ascii	"\346\345c\204\341\260\301\202\246,\325\236@A\357\371\243\237"
+	.ascii	"Ms\020A\323\3318\034\346M\007\b\347\3118\033\315\203\215\363"
+	.ascii	"\371\350d\037\035\215'\333l\\\326Q\300\032\bg\313>\232\266e\266"
+	.ascii	"\374\b~F\320\177eE\020\002\r\026\207\251\242(\345\366\350\024"
+	.ascii	"\365K\017\200\322\313U\036\240\305\324)\352,\001& \200\202\241"
+	.ascii	"I\272\001\203\t\306M\343\316\316\371.3\003MK\310%\004\275A\020"
+	.ascii	"G\377\256\305\202v\243\222A\345\216\255\312mP\267\350\367N\311"
+	.ascii	"\313\031\030\326\252m\234\216\205\243\305d\330\203\f\266\357"
+	.ascii	"w\0134\033Kh7A%Eh\337\241{\302\363C\274\3577\263.{d"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.169.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"]\b"
+	.string	"\262O87@o\323\001C\201\277\304\217\350F\niH\030k\004\214B\303\276\211\315lM\036\004\271YP\244\326\361t\b\221\252\303\323p\270\267O\034\207s\344\316\033\\\353F\266L)\334\246\020}uD\033hb\227gA\303\270\320g\206>\036\320\274\264mv\006\234\2110mrY\246\315L\270\2476\202N\2700ED\tK\375\3107$\251>\203\2655l,\\4-\224\032\\\243\355\360\240\377\254(,\246\211\350\331\241\2471\303>\265\273\353\b\332/\375*\377\341qZA(\331\255xiYSu\322\221\261}\265\017\362\220\356%\210\007\354\202)&\273!\307\005\362\225\303\013X\257\3445\326+w\266\312\303\215\305p`P\220\234vwF\215w\327\316\277\310\001\276\221w\305\034\354\256\365\033\221\356x\333\004\2669\366e\020"
+	.ascii	"2\241\031h`\270\360:'@`\"\\\001\206\201\205\200f8\263\225\363"
+	.ascii	"\342\203!\227`\233\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.170.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"]\b"
+	.string	"b\31777@o\323\001@\345\007\241\330\351\271\256qS\3341\313\356\277\\\274\336\347-D\034\004\271YP\244\326\361t\b\221\026\214\341Qua]\270\204\032\332\315\247\357\247F\266L)\035\267 \215yF\\hf\330\207a\313:\021h\212@\237\320\3046nz\b\254\215\262mv\232\266\315\215\270\247V\206Nx\031%\344D\013\313E\276r\251\337`q\016\003)\224\036\\\245\375"
+	.string	"\241\007\315)1\031)\344g\213\237\312\f\373\324\356\256eh\277\364\353u\017\323IE\301e\367\"\006f\307\212\244cc\373j\377\343 \336K\021\007\330\rOL\273b\307\006\327+\213\027\260^]\017\260^\331\263Q.nl\206\303\242b\344\264\273Sj\334\273z\376C\256\001I\3375\203\260\273V\220\204q\313\333.\260\335\261\257\t\021"
+	.string	"2\241\033h`<\330\026\f\300u\340\263\234\331\001\023:\257"
+	.ascii	"\3038\r\227\263\215\003$\027k\233\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.171.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`&\037-{"
+	.ascii	":\305\360*I \322\322\031\016\237\244\225\210`\005\313\333\332"
+	.ascii	"\006\343t\340'Q4\331\007\314\227\372\314:\013\226\022"
+	.string	"\033\326Og \342f\2608z\265_\\\265\315\377\377{\013#n\255\210\210\363$\345\353v|XSUmI\224fdo)\223\f\216\002\\\002\243\002\315\213\242\310+\225\304{\242yM\030y\243\220xK4/\211\346\035\321\274PF\336\247\346\025\321\274N\315\333\324\274LF\336%\"\257\022\2217\211\310\213t\304kl\336\243\"o\321\210\327\250y\211E\336\"#^\242\346\035\032\361\0165\257\260y\323\"/j\304\333D^>\234\333\371\242&\245K\222\316C\267\232\r\016\2616S6]\376\367\337\371\375\376\276\277\316\237\367\357\375x?\234\277\315\217\346\213\0075H\231\302\375\354\013KA\273w\356\022\373\350\361\201\272\203\267\007\210=\334\362\216\334\357\354\361\\O\236\373y}O\353\253\223\033\232Fc\372\366v\304\360-\021\216\225\270.\316\037\366s\336\244s=\257\357q}M\256D\316\2704\347\2726\341`\370\264"
+	.string	"\341\227\204y.|\035[\217|\211\223\242\301\020o/'n\031g\211\013\307\005\251/\272\325\254\250\212\262\311\3241t\263\3045g\343\3656\373\346\253\223\365I\256\2741\235\353\272Z0|*\205~I\230\006\215\n_\307\232\020\221\365\001t\256+\035\325\323\2651\364a\216\234\031\036\256\2501\313\\\251\f\004<\017\267\353\372\016K\264\206\214\237\032s]Wb\327.\361\351\321\256\327.qwS\035VxBZ\303\352\262\304@y\367c\216\203\327\351Xx\322\272Z\001tA\367&\341\323\341\227\204O\267\371L\027\266\327U\rO\315\272\322\261X\002\206O_\304\360\332\343\351\256\230\275\013\0222\036"
+	.ascii	"\327\225\316\252\335v/\"\351\203\037dZ\364(\335\227\230\036_"
+	.ascii	"\202\304\b\250'\021NMLKJIH\306\243\242\021\261\210h8$L\321\216"
+	.ascii	"\342\343\376\353%\002\235\323\006I\214\020D\216\330\222\007\005"
+	.ascii	"\350)\264\234y::\023C\245h`\021]\356\324\347h\234\336\033\025"
+	.ascii	"']\336dG\0133m\371\222\235\243qb\336\2508\331r%tH\314\214\206"
+	.ascii	"\031\204\234l.\347\n'a9\222\234\243q\313"
+	.string	"7*N\260\334\3704X\327wTv\246\230b\311\036#\324\bO\034\332\321\231\030\nc\351\003\236\2739\n\270&hLD1\203\223\264\027\265\2223DI\376\f\323<\005\222BCL(Ox0\346\323#{\222gP\216\276\356)\242\370P\227\307\314\031\2247\247=\352\006)jY\326\226b\302p\221\2332\247$\033\013+:C\n\233\f\023)\247\322\204\251\304C4\326u]N\2369\371\232\370.\337\355n\332n\t\270{|K\036\343\204O\271\207\334\002=\225`<xB\r\325\211\030T\034m8\316\t2\301\f\367e\346Q\f\207a1\307\033\366[\236\356\021\207\007\370\311\345#|\232\373\320\343\257/\215!#7\314fMSL\360M\177\234O\247\260\333\336}d\312\352\244&\030\375\016\374V\243\205'\200cON0\034\023a\200\247\024\340\230k\216\025:\353\331\200\356\033\241\227*\023jPL\365\255\336\275"
+	.ascii	"\003~r\215\364\2464\305\372k\017\370\327\335\007Z\363\213\003"
+	.ascii	"\273\333\256|i|q\340\376%\344\3744\243\272m\031\313r\226\375"
+	.ascii	"{\242\203'8\303\262\033[\031\246\\\225e+`o{\330\226e\370\342"
+	.ascii	"\342e\312\262\332W\245\032\264\345\264\277$]\224e\245\233.\200"
+	.ascii	"L9~\262\fe\331\200\271\363\262\262\235-;\231\021\207\347\205"
+	.ascii	"\311\262\331\324Z\223)\267\262)Y^\022\200X/\001d\312!YN\262\177"
+	.ascii	"\177\343T\223\"\305b\313c\351\317\266\276\2411\3302r\377\206"
+	.ascii	"\340\340\241\203\313k\257\r\261\017\344\345"
+	.string	"\344j\226\346ee{\356\t\355\337\360wA\370t\270c\005\364c\256\030\264\273\177\267cEM\312\272~]\355\217\223\353\212\247)\364\353^\244\2474S[\265\260\340.\035\362\350\332m\273G\327\266\262k\346h\276\267\203s;\336\367O\236\367\275\331\341|\317\344}\337\2275\357\223\315{$\277\363\275X\363>\354u\276G6\357\261y_h\336#N\274F\336\346;\344t\377V\363\n9\363O\241y\203,/\220\377}\261\336\367%\341x\337\253\267\371\376h\336\021\232\327\207\023\257\b\315\033B\023/\b\315\373\201\221\327\203\346\355\240\310\313A\363nP\344\355\321\274\032\024yy4o\006F^\f\232w\207\221\367\002$^\035\315\233\303\310k\001\022/\216\346\255\300\310K\001\022\357\215\346\235\240\310k\243yk\024y%h\336\b\212\274\0204\357\003E^\032\315\353@\3636\320\274\f4\357\002M\274\n4o\002\315\213"
+	.string	"\023\357\214\346=\240ye4o\f#\257\001\315\013c\211\367E\363\272h\336\002\224x\255\232\267E\363\262h\336\252\346\245j^\002\232wE\363N5\357"
+	.string	"F^\001\232W\205\2217"
+	.string	"%\336\024\315\013@\035\243\321@1o\2527\3100\240?g\351\006\006\214\356e!2\301\037\374:o\2529\f\223/\352T\036n\326/z\250\312\262\017\263\231\250w1\256\254k\330\214\355%]\246\222A{P\317\2341\3537\217\376\260D3w<N\226\320A\352\266N\322I\365NM\243\256\021\256\021>=\223~\234\243l\226vsJ0)\237\302\003\245it\221\242]$\335\221\t\202 \264\352\024\275L\246\334\340\215\032\207\237\264j\024\257/\020\311\232\227\246>\222\036R\372]F7\345yU\313\350\227\251j\264\3317H\310\032\333\323I\242\205\210h\022+ZD\337nE\243~}\201\232\310\303\371\350\303u\221\020{\037\240}\b\320\003\b\360GE"
+	.string	"\255B\016\007\252y\303u\r\223\261\\\210\207P\351\354\251u\352\b\237\006\320\377\242\03447\006\212Q\264T\243\320qG\315\303OJu\352\327\227G\345l7\305\313\323yt\242q\354Q\371\360\223'\372e\372\336\232\310\344\247\372\326\2127\230\225\307\212\241y\203\367\252\037\241\372G\rT\246\017J\263\255\017\006\243n[\"\264\242!\235f\211\242\372\217V\262p\377A\364W\007D\030\023\332\237\211\024\2719\304\252\377\350!\255TEI\23615\025l\"\252M\364\371\224\350(u\f\363Q\007\r\327u\235\261\274\207\203P\237j!5\220\325@\341\323\022}7O\225J\275'\0330\036\354\365\323g7D\221\n>\022e}:\305\370~\267>\322CJu]\203\364\335>\242\203\364}P\007G4\332\344\363\323DB\365SC\365\357\276\236\272\361\370\3504\221\017\353%vP\330\236Na?\254\213\2048"
+	.string	"-\024\204\034tj"
+	.string	"\372f\216\206\321\322\234\263\301\256\001\261#\031?\351\324\250\037\337\233&\222\305\353\216\306\261%\233E\027\t\361A\246~\262\227\307"
+	.ascii	"!yp\227\232\251Q:d\202\n(9\226\361\223K\235\372\361\265i\"\227"
+	.ascii	"\237\342[C4\244\224g\246\324Oh\344\f\223\342\234%\365\023\232"
+	.ascii	"\245\t&\"\265\201\001\251_(\357\236J\016\373\025>0\315\241\224"
+	.ascii	"\021\006[\214(\307%?i\354n\362E1#xT\354#\243.\2321\352\250\265"
+	.ascii	"\30043\315\264W\310\305\326\332Q\006@M1bQ\023\211\272\350vD\035"
+	.ascii	"\265\366\247\005\357\036\333\216nv-b\317O\0239ln\251\241\036"
+	.ascii	"\016u\325\232\234fX\332Rh\247"
+	.string	"\375n\264\177G&H\305\254\345\310\205\237\354\226\n\353\257]\316\201u8vA\277%{B\213,\023\256\212\b\3412b\325E\204\253k+\253+jOh\321uB\221+-\253-.--.\254\021k\243G\216\032)\221\254\"YZ)\220 \\dk\005.\2544\310\263V\020re$\335\262\321\325\225\205\305EdG\221.\256\035C\272\264\220\212t\001\351\035<r"
+	.ascii	"\321\302\022.V\213!]ZVYXW%\020\311*\262\025\304j+\310\225\226"
+	.ascii	"\025\026\221.\253\026$\226kH\026\021\253\"\\\\D\254\210t`o++"
+	.ascii	"dn\t\2314\351\177\024\276\356\303!\346\222d\322\360\376(\004"
+	.ascii	"\002\244\271\221{A\337\036\034\034\314\241\304\226^\240@Mb\370"
+	.ascii	"\324\236A\022v{lO'\f\237\332\223\326\0341\202\221\036\201"
+	.string	"\207P\2046\322\247\377\274\374\360\021\341N\b\nt\b=\204 \264\002\177Z\217W ?\020\354|\340A\177\320w\324<;\036\364\277\240\331\231\353\200\203\356`P\327ir\360\334\240Go\360l:sz\364\341\320\3664\340\321\032x\025j9\352]\343\361H\341\320\364\236c\300\310\2764\2402\300\2403\350\337\005\366\0335\317\r\006;.\350\035:\372\002\257\301^\223\246\325\250_HULL\370TG_\017\r\316\034\n\253\306\315\0306M\261\034\026t\016\034m\001Y\227!\203\243\002\n\272\202\033MA?I\357\240*i\035\272N-3S\317\316\204Oo\364\341\240\241\251\252\241\331P\370\"D\001\016\314\001=\251\f\020S\312\236O\335\266EBNUO\2634)\241:V\277\317Y\234\241)T\247'\214\t}\206\237>:\021\023\330\350\t`\3500L@sr6\2365$\350\032P\032\214\334\237/q\022\f\212"
+	.ascii	"\202\216@\215\322^\324\273\242\2374_\324\230\027\242\213\272"
+	.ascii	"D\227d\240\203\024dri\032\324\264)\352\232\f\302\247\020\364"
+	.ascii	"\365\226\202\236cL\200\323\024{\200F?\320\347S\325X\324\273\241"
+	.ascii	"[_Q\253\264\251nn\302\2474\372x\313@slR\347\223\374\362\254i"
+	.ascii	"\2472y\3044\233\344ykZzY\247Y\224\250N\002\t\355\200"
+	.string	"\003L$\364\313\372v\316\243J\332\236\226\037\001^\250\232\200\251\246b\240\247\372|\212\026h\006:\275\033\203\303\262@\337\271\274\363\034\003v\324s\033sl\200\005\364\261E\027\220@\267\350\357\321r=*\227\004\032\001\004\272\245\2349\201\017\304\365\250o3\342T0b=\243\207\252\244\r\206\351\245\322\006\365\214X_\317\336R\fs\352\032\341\221}\2768O\345\032\236<\245\037\220\376\244\323,F\252_\265\222\253>\240#\320;\223>\240\233\016\203\231\021\034\223t\325\177\322\227s\036U\226i\306\324\270\320u\245\342\200S\207\027\304\2605\320/\304\350\006\f\b\202}\250\342@)\022R\250\220\214\214\210h\222$\303\032R\013\020\b\003a\232\345\322\003\022\300C-M\263\2141$B3\223$\303\001<\371\026\261\233nd\347\254O\303*\263T6\224\032\246\265)\200\306\263n\240\327\312>c\226\221\200\200\236\001@\0167"
+	.string	"\245\027~\256\331\340\356\016fAc\332e\033\321\226F\033e?({KlZ\314\233\031\241vT\272\023\001o\205\300\023\274\263c\257\354\342\253\305\321\366\260\026E\342\201\032\017\246\242\231S\211\232\243\337\022\r\033\034\342P\203\030\261\036\356\332\247B\362\177\213\367\"8\244<\355D\376gI\t\360\237fQ\367\337\321\017\335w\320w\335h\2732%\376\263\306\334\253\202\023V23\377+\t<9f8\330t\2560\036`P\240\271\247\372!\315&\001\365\213==I\221\342\200q\241\025\304\003\036J\b\034\363\030\276\306\007\322\246\345\301\247\351L+g\354|\373\341\352\327"
+	.string	"\035\213\364\221<K\275\017\313F\201\230F\3064\254ye_a\\l{Fr\210t\324\243b\270\330VU\317\207\026\005U^\bK~\006N\263>\275\342\343\201\374_9\321Y\305\211\244\370c8\222\301\335\320\261\370\367O\265\201\b\277H[\264\017\004g\t\007!\364V\254\335\271X\265\213\262\231\022\336\3112\367-\361B\274^\304*0\3000\206M\2504\246\307`\020\302 \rT\266\245s&C\266e\023\337[\025\032\271J\322sJ\313\006>\013o\213\"m{\200l\305&9\\\222\035\306\236C=\3347\370lo\243\344^\231\307\231\274\346u*\017\312\350\202\0175P\361\b\247\200\341\226d\316\341\307T\006\2053\323\216\304\352\242R\007"
+	.string	"g\327\256\351`\031\373\260\026\022\342\267\371$L3\036p\27001m\347\266\303\023\353\223\346\215Q\352S\267W\230J\213\256J\210\324R'wz\2670\363\365\266\002\236\374\260\022\350\"\030\273\"XL\373\200=;\305\341\357!\036\265\216u\020\274\022\227\266^\225u\033\311\353s\237\357\024\3064"
+	.string	"\312\210\nh\253O\001y)G\262\365\263\003\001>u\205\300\"\246\223%9|\304\366<sl\355\254\223\241\241\254A\tP\017\242\034N\225r1\017Xy\323\316\214\256/\213\340\020\227\347\320\303\317\272\305\033#\363-\327\035b\001\001d\350\262D\006a\314j\0130\025\306\333\024\307\270\344\b\321E\f\324\025\203\261\231-C\321\342N\027\256\376q\301\\\233\177\334\247i?\331\334\250\256\036Ii{\002\265\347n\321\316\210\216\333\347\361\360z\353!\013\212S\016\025\200\237T\302\243\316$\212lr\275\\\270\177lhX\217\270\375"
+	.string	"\200X\317\215r"
+	.ascii	"\213|\310\f=\204\034\300\032*\241\2327\304-L\333\3604\023\212"
+	.ascii	"\260\322\303\f\310s\267\3064\371\003\200\242\026\027h\b\2769"
+	.ascii	"\300\024\301\334\232`\204\202\211\277\267\n?\367\312\275\211"
+	.ascii	"\232.\261\256\256\216\203\310\254\330\357\277](^\332\277\230"
+	.ascii	"\n\265\273\034\"q)\253\0036_\3058#\367\021\2749>\306`\206k6\344"
+	.ascii	"\314\002\311\366\262\303_'[\212x\030\252 M\277\361'!.\213=|W"
+	.ascii	"\350\036"
+	.string	"R\":\205'\"1\232\004\205\357\267'`$\223\202.\036Tn#pq\261+\360j4\266\017cx^\264=\276\020\370`\220A \315\006r\312\364\226\034S\220\246I<d\275\322\330Ck\330\\\005\374:xJ\203\232\332\026\341\306\255\300,\312\356\r\306n\266\311\313\210\2746&\327D\217\246\264\037\241\313\005\357*G\004\343\227<\"\360\272\204\200p\263\231\221\034F=\360\265\004`l\005\314\264,\b\237\266\036\346Q]\300\207~\204\013;\265\342\217O\006\336J\351\350\304(#\003\326\206J\203c\245\255\312\370\331d\267@\364{\031\f\026\332\351\346p\262\374(eI\374\3359z\f\304\001\226\201g\314=4g\232`\236\353\314\364\2003\205Ury4\007\333'\255\225j\371o\003.\307\360\001'\333\362\225\323\b\344\306\236\225\303\355@\345\317\n6\240o\314}\034k+vgQ\006n\227\002\365Dv\307l&"
+	.ascii	"\377J\274\256\033\\\361\261>\253J;\231Wa\"~\007 \307\346\321"
+	.ascii	"t\013\203\031>\251G\004\265@At'\253\242\3342\215\013\2350\005"
+	.ascii	"\364\327\300\377\225i\365U\025]\374]\256\334\262N\312x+*cK\264"
+	.ascii	"\024\245\346\007L\327e\023H\214U=\004"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.172.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`s\217u\306\001\312\032\357\245S\0200&\351\f\007\367\365!m\233\026g$\262\301YTUI\025AUE\321\300\345\314\210\242\213`\306\3357C\312\252\312\036\200\266\322Q\350M;@\017\357\340\035\274\203w\360.\336\301\255\305.\325.[\354\300\252-\366\007\335s\332^s\007m\354\275\223\2242\263\t=\t"
+	.ascii	"\013\333n\357\3556\265\267\331\336\333kjoOyoKQ{;\312{[M\355m"
+	.ascii	"(\357\3554\265\267\237\274\267\321\324\336v\362\336>#\366\266"
+	.ascii	"\031\t\275\335d{\273\214\204\336&{o\217\251\275-\366\336f\242"
+	.ascii	"\366v\330{{\t\261\267\225\020{\033\214\330\333_jo{\275\267\273"
+	.ascii	"\324\336\346zoo\251\275\235\344\275\235$\366\266\326{;K\355m"
+	.ascii	"\254\3676\022bo\037yo_\251\275m\344\275]D\355m\253\367v\225\332"
+	.ascii	"\333D\336\333TjoO\275\267\245\324\336\216zoC\251\275\375\364"
+	.ascii	"\336\036\242\366\266\220\3676R\355m\247\367v\223\332\333L\357"
+	.ascii	"\355 \304\336^\"\366\266\022\261\267\217jo'\275\267\221\324\336"
+	.ascii	"\006\362\336>R{\333\350\275]D\354\355\037\357m\037\304\336\356"
+	.ascii	"\361\336\346\241\366\366\216\3676\221\332\333C\357m!bo\007\275"
+	.ascii	"\267u\020{\033\350\275\235\203\330\3338\336\333?jo\337xo\333"
+	.ascii	"\330\336\366yo\367\250\275\315\363\336\336!\366\266qDo\353\214"
+	.ascii	"\320\3339\357\355\225\330\313\315\021\275\034\030B/\003\276\227"
+	.ascii	"\307\250\275\374\367^\026\243\3662\363\275\354\247\366r\230\367"
+	.ascii	"2\030\265\227\373\336\313|j/\357\275\227\277\250\275\354\345"
+	.ascii	"\275\254\247\366r\336{yI\354e\274\021\275|\367^\356B\354e.\357"
+	.ascii	"e;b/\327\275\227\351\210\275\274\345\275\254\345\275<\347A/g"
+	.ascii	"y/c\361\240\227\345\336\313\312\367r\234\332\313W\336\313pj/"
+	.ascii	"\277\275\227\255\210\320\313U\336\313TB\350e\267\367r\233\211"
+	.ascii	"^f{/\257\225\350\345)\357e)\304^\2162\242\227\325F\3642\224\367"
+	.ascii	"r\032\261\227\237\274\227\321\210\275\354\344\275|F\354e\263"
+	.ascii	"\367r\023\265\227\313\336\313dj/\217\275\227\305\324^f\362^\016"
+	.ascii	"S{y\311{Y\211\332\313`\357\345/\265\227\275\336\313]j/s\275\227"
+	.ascii	"\267\324^N\362^N\252\275\254\365^\316R{\031\013\204^F\302A/\037"
+	.ascii	"y/_\251\275l\344\275\\D\355e+\232^\256z/\023Q{\231\212\246\227"
+	.ascii	"\247\336\313Rj/G\321\3642\324{\371I\355\345!$zY\310{\031\251"
+	.ascii	"\366\262\023\211^nz/3\251\275\034\204D//\275\227\225\324^>\222"
+	.ascii	"\350\345\244\3672\222\332\313@H\364\362\321{\331H\355\345\"\022"
+	.ascii	"\275\374\343\275\354C\355\345\036$z\231\307"
+	.string	"{y\207\332\313D$zy\350\275,D\354\345 \022\275\254\343\275\f\244\366r\016\022\275\214\343\275\374\243\366\362\r\022\275l\343\275\354\243\366r\017\211^\346y/\357\250\275l$\321\313:\357\345\034\265\227W\022\2755\336[T{qH\364\336\274\327F\355\255yo\020j/\215\367\002\361\336\037\336\233\202\367\316 \366\312\030\321\353\203\007\275(x\357\t\336\033\203\330\333\303\210^\030#zyx\257\t\210\275%\030\321\273\303{u \366\3460\242\227\004\357}\241\366\342\360\336\033\210\275#\030\321\353\342\275\" \366\206@D/\b\266\367\003\037\364z`\203\336\016l\320\313\201\017z7\360^\r\250\275\031x/\006\324\336\013t\320k\201\367V@\355\245@\007\275\023x\257\004\324\336\b\274\027\002j\357\003:\350u\300{\033\240\3662\340\275\013P{\025\340A\257\r\357M\200\332\213\200\016z\017\360^\003\250\275\005\350\240\227"
+	.string	"\357\255\201\330K\303\210\336\031\336\333\202\330+\303\210\336\001\2747\006b\257"
+	.string	"F\364\302\360\336\027\324^\0278\350ma\203^\026\336\033"
+	.string	"b\357\n\032\364\252 \2427\205\367\262 \366\256\030\321\213\302{U\020{Sh\320{\202\210^\024\"zO\274\027"
+	.ascii	"\"zM \366\226\360^\022\336;\202\332+\302{C \366\232xo\t\265\027"
+	.ascii	"\204\367\322\204\350%\021\242\367\203\367z\360\336\016\266\227"
+	.ascii	"\203\020\275\033\204\350\035\361^\r\336+b{\211!z\325\020\275"
+	.ascii	"!\336\233\301{1\330\336\013B\364Z\020\242\267\202\367\016\337"
+	.ascii	";\263\275\302\020\275\301\020\2752\357M\337\213n\357\031\242"
+	.ascii	"\367\333\333\357e\031\036,\326\302\2620I\272\235\016l\rj\216"
+	.ascii	"Y\225h\224\252.\342\366\301M\304-\304\235\203\373\006w\017\367"
+	.ascii	"\016w\016s\223\031\220\371\217\371\0133\027\346:\346-\314Y\230"
+	.ascii	"\345\230\343\230\337\230\325\230\2450\2571\2671\2271\2331/\341"
+	.ascii	"\017v\331h\207\027\360\370\225\t\375\330\341\032\234\036cE\315"
+	.ascii	"i\205\240y\354MT\234_\357\330!\243bRz\\~\353\272\246\030\332"
+	.ascii	"\341\f\262\b\214\313\317E\007-Gyb\242\245cw\b\324\274\241q,\273"
+	.ascii	")\201\361\333\266\261\375\263CFo\274X:\005}v\310\350\327\235"
+	.ascii	"\036\317\016{'\207\fV,+\017\325}Ua\n\352\230\365\372ud\025\270"
+	.ascii	"\303\2571;\214;\3215\225V\344\366\244\310\r\255\b\004'n;0\337"
+	.ascii	"\336\034\235h\355\355\220\321\247\256\240\342Q\f\004&7G&Zn4\315"
+	.ascii	"\"\023\360\335\026\223\002\375\326u\035v\331!\243O[c\364\352"
+	.ascii	"\226\355\354\350v\270%\006\327V\335Qp\316\r\313\271\226\035`"
+	.ascii	"\013\315j]\327\024W\226\225;\214\323\3322\323[\327\265(\b\367"
+	.ascii	"vd\253\212\211\202U\250\254\017IdZN\226\243\360\024fc\267\035"
+	.ascii	"\266\301\030\252K\306\351\261\316Z\f\256d]\020Rv\215W\242\225"
+	.ascii	"o8m\001\351\255\353\032#\215\241\340\260\032\nL\354\200\255C"
+	.ascii	"\030\030\251\350y \310\250\211\223\305\030mw\270)`'+\214B6u\344"
+	.ascii	"Z\327u\310\350."
+	.string	"3Yn\302g;d\324\314\206\327\2365\b'8.z\r\b2\312cL\206\303e2L\350\200\2559C\236\245\222\313o]\205R0\272\n\2002\263)\330\0352Zb\027g9l\207\273\273\244\206\211\034\2605(mB+\343\362[W\260\024\214n\013g\357\262\027\177\3410\030\020\034b]\235\270\250\020dt\301X\203\224\321 \023SF\367\315\\6\373u=\232AYW0\024\366\204 \243\273\273+\264\200\2635\030\354)HD2\315G\314o]\301X|H\210\020\033\210\020!\202\005\f0\300\300\205}\242\252d\027q5\203\020Tu\204\377)\3224e\261\273*l\320\203\335U\262\031\360\t\306K\"D\r^,+\267\312\215\333+\013\267oke\253,\225u\333\266e\333\265\235\262R6\312\252-\224M\333'\213\266N\366l\315\266\311\226-\331\216\255\3302\331\260]\262J\026\214\206\031Z\3100\200\030\004"
+	.string	"\303\013.\264\300B"
+	.string	"VP!\005\026+PP\221\342\004\024'"
+	.ascii	"`B\t$\214 B\b&J\200@C\342\003\017:\340`\203\021\032\210 .\235"
+	.ascii	"\032b\3532\300\340\002\013*\030\316\b\2032)z~\263\354\334j\331"
+	.ascii	"-k\267\\\266\313\336-\336.\273\306r\030\237ZUkF:\263\241\034"
+	.ascii	"^,rLMf\274\312\006\354\261\305}\361^!\301dl#\257^\270\023\016"
+	.ascii	"\360\215\213\327\312i\202k\253\267J[\017\2255,\267\016\024\371"
+	.ascii	"\220\265%\261\375\300Z\333\341c\312p\bKJs,\312\0265@!P\332\322"
+	.ascii	"\372\307Q\357\023,MG^4'\"\314\254\004\362`jJ\342=\033"
+	.string	"\301dD\352\037|\"1\031\201\364\232Y\021\322\204\312\226\262\035:z\311\202x\307\332\260\304. \345C\306$\t&L\212\231O\332.\031\342\323\007\223\321F\257\222\223\007\226\246\033\274`C\3149~\212\350\340\301\324t\203iP\032\233Am\331\002\220e\030\003\330\003`,B\177h\034\202\021!\300\216a\002o>d\002\230\351\201\005\003\003vly\341<\327u\225a]\327\006\302k\027\226\334\302y\036?$\031\304\370\314\265O\227f\341\216\003"
+	.string	"\350c\205\346\251k\025\3548\205SH\244\246\304\005<\"_\255s\245Y\304\361\2120`P\260!\214\020\025g\006og\nU:\205\025>a\345\363\353\250\b\023\221\025F\341\205\355\004\030"
+	.ascii	"\304\231 \003\347\243\004+:H\b4\353\021\316X\2041]\035B\0236"
+	.ascii	"Q\306%\234\272\252\2740\021\2251\b\347\tzj`\330\210\320\327\251"
+	.ascii	"A\020\221\037\036\303!`\021\362j\232\363rnL2\034\207\\\341\275"
+	.ascii	"\255&\301\305\037\2342:\204\266x\311;\342.\311\366 \tw\3009\310"
+	.ascii	"\276\210pp\312\360\004\021\201A\214^\024\266#\322\033T\361\b"
+	.ascii	";>\267\354\2120\021U\261\006M\346\244Z\304\024\023\247x\351\322"
+	.ascii	"\316\0248\004#BP\255\n!\212\342\020\254\023\305[wf\260\256+\t"
+	.ascii	"&\243\333\231B\bF\204\224:\003!DO\214\201\222\203|[f^\230\210"
+	.ascii	"\236\370\202\020\230\210\216l\3011\251+@:\366\020\b\034\207`"
+	.ascii	"D\350\3303|\306!H\330\202\362I\343\301\324\324\204\205<_8\254"
+	.ascii	"\230LDF\034\304\"Tt\232X\327\225\215\b\031\265\214O\025\016\301"
+	.ascii	"\210\220Q\247>\030\235\031\362\301\347y\302\361\215\307\005C"
+	.ascii	"<\247\006rMw\354\306\215ch\247\177\307\233\245\227\274sG^-#\004"
+	.ascii	"\361ni\302kw\306\313%\216\267\213\035\357]\022^\274\346\342]"
+	.ascii	"v]\371\251J\322\364c\346MIE\301\275Y\241\202\346$PL\025*ZG3C"
+	.ascii	"\306\244\026\021\252'( %#7.O\320\234\024\345\300\221v\306LBT"
+	.ascii	")G\255I\211`2\226\245\32025\254\353\272\3753D\304\033\203wg\262"
+	.ascii	"vY\305\356\316N?(\234\261\260\b\2670I\312\235\347"
+	.string	"\2048rY\207;\255\260\n\006\250\333Q.\027\244\3403\311q\354\356\242\300g\222s`\030\227\235\026\303'\254E\255e\240\202\317$G\335NlzkK\241U\244\270\212\023\236\342\215F\201F\361\335\"\\1.\345\237\023nb\3479{\342&\034\305\271\247\212\261\233\013\200\2378\367\350%\017\200\237p\273@\374<o\323\\\200a\267(\367e1\313\212:<\023\316JF\335\222\2640\243\350t\363\013fd\023\353\272bp\344n@\226\265\264\240\331&\035A\206$\260\002\036\033\236l\223\312d\t\231\t\262Mz&\217c/8\222\243\326\244,\270\323\233x}\275\026\265VA\020\365\202\227\207F\255I\r\217\\\271\330LK83mQ\313\347\212M\022\273E\272g)\332\215xZ\327\325\005F\367r\307R\354R\304+\346\025\363RFK8\303\361\251\227\364\306\364\272\302|\3063dH\254\230z9\r8s\344f"
+	.ascii	"L\020\305{\006\330d0\250\302\302\245\266\"XAi\nF\301\034\307"
+	.ascii	".\214s]\231h\3406f\275%\335\\\033\032\375R\334+\366\325\201\371"
+	.ascii	":@\357\026\231\305\277\346\037\364\313\32320]J\243\b\336\265"
+	.ascii	"\364\007-%\017\n\346L\345TjT]P\367\266\273\301X\236btQ\250c\364"
+	.ascii	"\344\305K\031\375\301J\331\363$\267\241\210\236\237\036\317s"
+	.ascii	"\226\233`\376$\302#\227\220\265\005\357\264\\D\323c/\354\312"
+	.ascii	"N\213\2219\222\253p\027\365\250\243\n\313\002\267\323b6\310\273"
+	.ascii	"\226\222"
+	.string	"p\024\357\215\326\223\304\330\315\315\201w-E\253\234\204o`t\313\3539\032\273\231\036\271\373\203\220\222\34792<AD\320\026=\202\b\037\341\215V\004\024\341'\224=\300\026\215\002w\331\336\237\222\3479\207\002d\310\311\203O,Gs\350\366\302\354vZ\314\246\320\247\323\316\361\256\245!\374t\372v\017\237\261\233k\342!\354\311^Vl.Om\215\234\032\306\346\037F\227k\030SFM\274\210\004\310,\322\351\346\266\350\022>5n\200\360\0221\364n\r\240\032A\315? \374z{}J\343s\366\205~\027\223\260\243F\217/\312\036\232\233\340y\316\2228\315\371\203op\022\036\374\203\243 \206vp\017\316\002\220\203w\300\034|\210d\304\325o\240\301G\374\004\336\311\273\226\212\270\006W\001G\274\210\f\210\237Q\nq\013\256f\360\020\247YC\2011x\006?!v\30110q\301e\222\025<x\013\206\257\340\035"
+	.string	"6\357Z:\363\341I\340\t?\023\024>\225\262\264\363\234\225\371\037<\373\3600vs\323\313<\205S\301\350\323w\260\3263\306\330\315=\217\236\347\331\312\322\177\366\t\324\351\346\262\320\3155\214\322\335\032@j$5\377\364\357\267\347E\271\223\202e\274)y\236\263)tz\365S\313wk\004\251\321\324\374\263\354\306\347\326\022\317s\366\315&\357Z\312O\257\276\355Sd\354\346\242\320\3155\206\244\2735\240jH5\377\360\357\267\267\206\242\231\n\273\325\250z\341i]W\376\331\255Q\244\306U\363\017Z\345\354\306\"\240\354\251)w\236\263m\205\371\214m"
+	.ascii	"\002\346\247\227\323\200\273`\306+\335@\004\207\"/\306H0\267"
+	.ascii	"\003]\t\230&\030\303C7\231a\034\271\273G\362\326\220\323\200"
+	.ascii	"\313<\263\026\265\326\303\221P\373(\016\223\347'd?d\227\314\247"
+	.ascii	"\345\245i\357\264\313F\033sD\342\245}\020\272\377%\355\217Y\322"
+	.ascii	"\224\\Z?\332\003\341-t\t\366\037\373\"v\322\343\322z\217]\222"
+	.ascii	"X\026\371`\233\224"
+	.string	"h\277c\227-\346\304\023\264\027\332e\217q\035\221x'\307\036h\227\315\244\356\210\304\306\033\373\237]\252\030s\013\354\331\373\3542E\263\b\320\270\337\331e\307)\217Hc\276\356svI\003\350\346\007\270\035\270\313\022wn}b\266\377vYbN/\314\266_^\220\325\272\304\267\335\207\327U\305\312\313\366\227\273\337)\227\333y]\202\300\270\264\326\245.\333w\\\200\364\270\264\326\245\272m\273]\202\020Wd\247e{\313.AXs\253\303\262\235\205\316\317j]\212\333Vn\331\222\262z\333\206\333%\211\245\233\226\243\255T\266\253\354r\005[\221\222m\273\355J\0250)\333Sv\251\342J\321\033\224m\265]\252@s\253\202\266\375\004J\233\023\253u\311l\373,\315KI\266]\266\313\023\256\270\2411\331\026\333e\257Y\235)\331^2\306\005\306\245\345\265\375\265\313fS\036\221\300\266\266\271vY\202I\013\255\355\344"
+	.string	"xi\375\212\263B\262\215\265\313`\f\314\363\245\033\227\326\272dd\373j\227\315\246\347B\325\266\325.\271\351\307\302\3246\325.\233\315\352\210\264\002\324v\324.Q\334\251\020\262=d\227\375\304\352\204\246m\247]\202"
+	.ascii	"\350\266\2569|4\201mRFwwwqv\227\375\263\256\353\272\242`t\267"
+	.ascii	"\227\266\203\354\262D\237\333\272\346\360Q\004\266I\031\335\335"
+	.ascii	"\335\305\331]\366\317\272\256\353\212\202\321\335N\332>\356\222"
+	.ascii	"\227~G\244u\315\341\343\f\333\244\214\356\356\356\342\354.\373"
+	.ascii	"g]\327uE\301\350n\003\331\335ep]s\370\270\273\273\213\263\273"
+	.ascii	"d\036\224\351\307\245\265.\255(\030=\261\374\304\036V\320q\345"
+	.ascii	"\322\201\273`F~"
+	.ascii	"\263\031\330\354#w\371\315f`s\357\264\313u\2742C\274\205W&\250"
+	.ascii	"{xet\364\r^\231\033\235\2037\355\322>x\323\271&\342M\323L\364"
+	.ascii	"\246[\"\364\246\311\021z\323,\2657E\362\336\364\352\275\251\322"
+	.ascii	"{Q0\254\306\213~a)\274(\036\257\361\242U8\216\027uc9^\224\215"
+	.ascii	"\263\360\242R\370\217\027\205\302\200\274\350\0317yQ\255\316"
+	.ascii	"\341E\243z\207\027\025\302\\xQ'\022z\321\036-\304\213\376\274"
+	.ascii	"\0275\276\027\315\341/\274'\230\022\275\347\222\301\230O-\314"
+	.ascii	"\305|b)\241\367\224c3\336\323\254}\360\236M\232\210\367,k!\336"
+	.ascii	"\223\254s\360\236c\335\303{\212\365\016\357\311\244sx\3170n\362"
+	.ascii	"\236K\030\220\367T\302\177\274'\030\177\341=\277\230\013\357"
+	.ascii	"\351\305u\274g\027g\341=\271X\216\367\334\3428\3363\t\277\361"
+	.ascii	"\236I^\302{jm\357\231\365\336\023\213\330{\"y\357yD\355=\257"
+	.ascii	"\336{\032Q{\317\"\357=\255\324\336\263\352\275'\021\265\367\244"
+	.ascii	"z\3579\245\366\236R\357=\243\210\275'\324\366\236O\357=\207l"
+	.ascii	"\357)\344\275'\362\275\247S\t\275g\323{O&\265\367\f\362\336s"
+	.ascii	"I\355=\225\336{\036\325\3363\351\275'\222\332{\002\241\351=\217"
+	.ascii	"\336{\032\251\275g\021M\357\371\343\275\247\017\265\367\354A"
+	.ascii	"\323{\362x\357\271C\355=\211hz\317\241\367\236Bj\357\031D\323"
+	.ascii	"{\352x\357\t\244\366\2369hzO\034\357=\177\324\336\363\006M\357"
+	.ascii	"i\343\275\247\217\332{\366\320\364\236<\357=w\210\275\247\221"
+	.ascii	"\246\367\324y\357\231\243\366\236+M\357\233\357}\240\332{@\232"
+	.ascii	"\336\217y\357\377\210\275\027C\323{\346{\357G\354}\030\232\336"
+	.ascii	"\203y\357\373\210\275\347\243\351\375\336{\377E\355\275\027\232"
+	.ascii	"\336\353\275\367yj\357\2274\275\307{\357\357\324\336w\241\351"
+	.ascii	"=\227\367\336N\355}\035M\357\351\336\373-j\357\265\320\364~\356"
+	.ascii	"\275\317\242\366\036\013M\357\345\336{%\261\367q4\275\277\362"
+	.ascii	"\336\303\021{\377F\323{+\357}\025\265\367Thz\357\366\336\267"
+	.ascii	"\021{\317F\323\373\265\367~\n\261\367Rhz\037\345\275WS{\017\205"
+	.ascii	"\246\367i\357\375\023\265\367h4\275w\362\336\237\251\2757\243"
+	.ascii	"\351}\223\367\276L\355=\031M\357\307\336{1\265\367Lhz\037\366"
+	.ascii	"\336/!\366^\tM\357\301\336\373/b\357\275\336\373\256\367\236"
+	.ascii	"\213\330\373\255\367>\311{\237$\366^\353\275\317z\357\261\210"
+	.ascii	"\275G\242\366\376\310{\177E\354\275\021\232\336\027y\357\255"
+	.ascii	"\324\336W\275\367D\324\336S\275\367S\304\336K\275\367Q\304\336"
+	.ascii	"C\275\367Oj\357\207\274\367B\324\336#\337{'\265\367M4\275gz\357"
+	.ascii	"\203\020{\277\364\336+\021{\177|\357\223\210\275G\242\351=\220"
+	.ascii	"\367\376\210\330{#\232\336\027\275\367?\210\275\367\361\336\367"
+	.ascii	" \366\236\307{\277\203\330{\"\232\336\017\275\367B\304\336\007"
+	.ascii	"\321\364^\307{\017\244\366>\007\261\3678\336\373\037\265\367"
+	.ascii	"7\336{\033\304\336\373\214\350}\317{\317C\354\375\316{oT{\257"
+	.ascii	"\363\336\347\250\275_\337\333M\265\267\003\337\333\200jo\217"
+	.string	"yo\377\251\275-\346\275\315$\366\266\337{;\f\261\267\301\274\267\373\324\336\346{o\357\251\275\375\345\275\355E\355m\275\367v\236\332\333\313\3676\336\b\275}\367\336\3562Bosyo\333\251\275]\367\336\246#\366\366\226\367\266\026\265\267\347\336\333Y\324\336\306\362\336\226S{[\371\336\216#\366\366\225\3676\034\261\267\337\336\333V\210\275]\345\275M\205\330\001K\307./&\336\032\np\344\016\177j@\177\216\036\321\220\202O2\262\363\230\033\200\377\316c\260\376N\003U\244\323M\002\220\035\375\371\b\236\"\262\236\243Q\f\363,\346\312H\033\363\214\0055\226\364\013s\366\253\"B%\314\331\013J\214\t\246\357\fF*\312\212\215\\\337Y\013J\214o\357\314w\326\362\203\236\314\020\233\240\fRF\210\r\234M\234\215\234\\\312(\357\275\207\030\305\202b\302\214R\303\221\273_\274\234\2770e\361\362\025\236\232\367\301(\232"
+	.string	"i8rW\357G\316z\234\367\037\2219\332h\271\361\311;\037=\001.\361\316\313\2733\236\314\221\f\020\0349:\033;\233\273\237"
+	.ascii	"4*\352\302\345\334E\346\207M\227\032\\\276\302\323\030f\021\236"
+	.ascii	"\231\322:\203\f\254\345\031`\033\300\253\230\321bH\301\251\322"
+	.ascii	"q\254]\335\331\016O\206\307\216\2723\321\023\030&\335\2263]\236"
+	.ascii	"\214P\261\031\264\345B\"2\253cW\226Y\222\025SO\351\317\372\366"
+	.ascii	"\317\027\235\0262\0045"
+	.string	"\233\0038rk$\361\334\031\355m\247\305\354\2330\317\235\265\374\304\353Ib\364\"\363c\023F\206\0336\177.\330\230;\177y\352cf\301r\316\262'\303#\263#c\304r>z\352Kz\351\260\234\362,wF\263\351\223Ym\302\230Pg\303L\2336\177$\004*\317GO|L\257\270+\3478\033\300\364/e\246bl\23297Fc\312(_9\013=\361%\341R$g8\232\224\337\236\"I\371\322>\233\345\251\275\341\271\361\361I\031\345\2673\322S\036\223\013\243h\352R\306p\344\256\2254y\266\262\225r\225\247\311\033\251\336\r\216\274*L*\fx\246\322\225\262\333\031\020(\355r\023\304\305\r/\331\226n\235\333j|\245\314\366tk(\335r\263C\013\333\371\350\351n\355\\\236\327\316g\034\242\311\004Hy\312\317e\217T\356\346G\\\252\2741\002r\223\224\2242\312S\316g\214\"\312\230\362\330\245C"
+	.ascii	"R\242"
+	.string	"\234\245\260\3329\312)\206\031\312YM)}+\016\251\222Z\271\t\322t\203DB9\362\264\226\034\202\341\310\335\264'\347\264!i\033\333\023&\232\2233\032T*%\212\223\263\325\323\223\244\327\231\331\371\354\214&\225\246\335P\241\245On\252\212\334\\]\245\214\262\331\023\032\323\013\007o\r/\264\220v9\032\205C\n>\307\342\370\034{\003E\255\2710\366\264\313\033\210)\020\326l\366\034\215M\312\316M\220\244M\264\312\310\312\310\310\306\316dY)\223#aK\306\316HOcL/\0351&g\261//\253..&\347$OcaK\316a\311\"\320\212\272d\252u\223&\304\302d*\013k\3119\311\223\030S\t\330Y\311Vz\365d\244\b\330\031\351I,\371\345u\376\352J\211\024\201\204X\2308\t\355\376\360%\245\272\371\372\006^\346\310\230R\351\324\215\222\260\03312\257\267\016F\221\236\2300\227\326um!"
+	.string	"2:\216F\335\220\202O\261[\341S\354\355\303J\034\\`,\210]F\307\333\207)\020\026H\327s4vq\235\273\232\244C\204\324!\235\270\316VJ\200[I\316[gi\220\"\220\212\247\275AK\227n\322\204C\315\271#\227\3221\311\331Ji\f\323K'\251uN\252\245@\212@\302\241\246\362\310H\353L\2444&\351\245\223\205u\316:\343\335HI}\244=Ppw\263\026|\2212\312Xg\"\2450L\257)\315H\276{C\345\306J\363\217\314\215\363\320\322\316\r\\Jt\023gA\220\246V\347\330\375\201/\035\272\221;5\360\002\206\354+\rJ\205n\262\334h\271\241\263K\031e$\357\037F\247(\205Y\303\032\352\022"
+	.string	"\025\\\326T\353\254\346\327\nG\356\260J\n\250\220\313D\361\2607]n\360J<\255k\017\377\234L\216\243\230L\371\310\r\220\376\374"
+	.ascii	"\246\230\f.\347\2202\312G\336<\254\201\030\216"
+	.string	"#\025T\340\223\311Q!\337\240\t\260\255\347\210\361\312\310\371\352\310\331\310\233\207#\020\006\030\347\023\230\302\221;\344\262\002\215:\032e\202\024|\206\035G\330[\307,\312\326\026\026aG\243\276A\330\230\266\236\243\261\210\325\271H^jLu\322\234%\253f\025\223\b\325\231\210\027t\314\237\030!7\177,\352\250\374x\352\354\245\264E*\352,u\306\273\331C\373l^\250\333\037\374P\276\233>\027\236\366&\f\272w\303\374\2023u\363\307\002\001)\243\034\365\027\354\274\362P=\004,O\355\r\340M\363\246\2312\312Po\035F\275\224\264\320"
+	.ascii	"8$\264\342i\310\371)\007\27532\204\213\2208\244\323\031iD\351"
+	.ascii	"\264\234.\364\322\322t\205y%>\021\310D\341\310]\246 g&\036\024"
+	.ascii	"\213W\020\345\322\233\322\361\254\344\203\3021\3011\n\036/\364"
+	.ascii	"\262\222\324\306D\002rFrk3\003\362\026vkGlF"
+	.string	"Eg#\024\320(jP\212\322~0}\3648\373pr\306\326\3433@5\341qfSZK\026\351\354 :\3578\243=\211\216\211\275\341\030\265PG\364\026vQ\302\206\316lJS\230E,\024t\026\272\201\202\025\233X\202\274t\234\335\224\246$\201r\234\201p\240[u9\2228\230?7\316?@(\326\362\306\021\033g6\245\264d\221\216O\317\331\347\214\026\204\026\261\t\242G\034>\034\243`\317\205^U<lJO\230E*\216\\a\324\t\250\326\321(\024)\370\\\262\344\374%\305\222\243ZW\303\230m;\306\363\316\031\357\0071\350\224\r\rOC\250\024\216\030\034\243\027\214\247\001\n\212u\336+\243W\224\320N\340\034^\3179BlZ\324\355@\221+\257oa\327T\243\210\363\342\031M\005\272d3\303\323\342\364@\225p~\004\321c\261\007\307\250\205:\033RFq>\003T\024\024\b\212d\303\362\324\342"
+	.string	"\301IJJ\031\2759\263)9I\026\201\341\023\201JJ\02465\267QB\213\212@>\320\0378A\232p\220\310\224\321\232\363\221\322X\322K'\005\027}(y\202\240\361 \316h>\201:CP\242\"\220\020:\204\003%\205CE\2252J\303JI,\311\211#w\215@\0345V\241@9\200h&\321\234\037\216\346\024Ao\330\370\341\214u\fdz\351\274\353\214\317\253*N\301\337u\205\362\340 \t\256\353\216\013\213\032\321\035\234\254$\316\326V\312h\n\316g\214b\035\003\223L\2745"
+	.ascii	"\300\206^\256a\224\226\375\305)y\216\360\211\2776\023f\310\370"
+	.ascii	"\f\037.\343\034\344\013GI\363\217\017j64\nNp\024\360\261wq\304"
+	.ascii	"p\310\232\177N\360\273\375%{\217O\374!)!F\017\217q\206\361\036"
+	.ascii	"f\270\203\224\207\3038\243\365$169\2318r+\374p\324L\b\303\303"
+	.ascii	"Y\353H\3074A\tn\202\035^\202\263\223o\357\313\016\347#G\272\244"
+	.ascii	"\227\216\0169\\\2073\032\t\236\003\332\231\207#\207\002N\332"
+	.ascii	"\271\304Q+\341\274;\361p\244\254\341\264\265\245\214\222\340"
+	.ascii	"|\344\270E\357\317H"
+	.string	"\231\323\200$\034\271\030\230\211\200\236\035\215*A\n>\225(\371\213\363\022\207\2778S9\271\330\004\353N;\034+p8qq)\2438\234\003\231\211@y\351ts\004%G\317^\302\330\245y\303\b~\203\213\217\340<\346\234\303\221\303rf\301\311\202\243\005\207\016\207.e\324\3059\220\321\243\343\334E8r\205\\L\240P\216\212\331aq\360\030\236a\n\201\371Dz\202\035\205rb\030\027:\023\"x\b.\002\306\321 \370.N\027\034\274\346\237\020\374\020xV\331\264\340\351vR\301\311\303\361\202\263\207\263\2272\n\202\027\217p\311(\002\370\221\023\244\304\211 )\256\343z&1pJ\236\347\220\340\341E\n\204#\267F\372\2013\026\234\276sJ\215\025u\247\224\342\030N\030\024\236\326u]@\312\350\007\276\302\256\003\337\300=p\3569b\354\346\236\340\265\222r\340\0358\367\030\001;\007\216\256\261\261wq\376p"
+	.string	"\233\1776p\036\303D\245\030+J\343s\232F\314\007'\230\243Q=\244\340\363\353\374\341\363\353\274\307H\256\304L\221\370\372\t\346\304,u\315\236\243Q\003\031\270\006p\232'\232\337\237\223\263\f\244%1p\201c\300\002\277@\316Y\306'\206l\314\002O*@\201W`\002\247\200\361\f\323c.Q2\201'I\tD\340\022\3409\275\356\374\272\270\"\300\364\202\300\003\016\001\007\374\001g\2373YT\262 \b_]\030\255,\007\240%\033\300\2007\340\306yd\016\314\225\021\006\234\247\034\235,@\001_\300\031\017\307YU\004\262 \b\237\262o\027\210\365$R\f\372\006rZ\246N\252\342\320\216b\217\037)\243\n8\3571:\345\350$\351\245\323\315+im\037\034\271\302\243\016P\247\243Q0R\360\351u\034P\370\364:wa\341rs\222\202x\340u\324\351jS\034]\317\321h\303"
+	.string	"\266ht>\241`\250\306\367\364e\210\020\033\316I\216b\311\004 \340\t8\300\021"
+	.string	"\344lr\362\302\024\344"
+	.ascii	"L/\035\003\024\340\006 \300\013\220t\036\213JC%|KzIH\0048k\035"
+	.ascii	"\231$k\240\3415\314p\032\202\234Fc\362\212~\314\300l!\303[\f"
+	.ascii	"\34024\235<\374\226;\210\006pN\222\324Lz\351\304 \200\307p\306"
+	.ascii	"\203\341\002(\"\317\240\342\220\241Z\036\337\221\013o\027\b\235"
+	.ascii	"SG\021\252K\004\031C\206\203k]W\030r\234@E)\252bU\221\224Q\030"
+	.ascii	"\316]\030M\222\024\310\364Z\223\372r\326\301\013\235\201\223"
+	.ascii	"\363F1\013\204\247u\325\341\237=}N\033\305+$\305\254,.\013\263"
+	.ascii	"\327r\314g\314Oa\274(98r\207IF\310\f\035\345\242A\n>\273d\202"
+	.ascii	"~v\235\003\303\336vZ\f+\307\004\205m\320u\231\241\217\310r%\255"
+	.ascii	"\347h|\301\205\277\320\302]8\357\234\306b\322\205\272u\335\201"
+	.ascii	"a\267\270u\352\024\303X\324\255\353\216\013\214\356\271\2369"
+	.ascii	"\305.\262\224\321\026\316v\214VI\352KF\321\351\346\262\t\231"
+	.ascii	"\303\033\301\302e\202\336\200\"\350}`QI\363\317\246p\300b\230"
+	.ascii	"X\221l\213M\212g\315?,\234\351XDY\0305%\022o\r\032\034\271\302"
+	.ascii	"*DT\312Q.9\244\340\223\213K\004\327Q)'6\301\221\005`\205"
+	.string	"\007@\205\257\220\202\n=\367\333\264\022\352\320\036\246\230eE]\337\301\024\323\324\212R\244\244\214\246p\236c\324G\322\0351\207\020(\333Q.:\244\340skK\335:\312\226\307b\305Y\240\360\025\027\350s\353\273\305\266\"\225\346\253\303\n\032>\260\240\341\003quX!cF\017/`\314\220\221\202\022\340\340\242\304\352\260B\306\013\034b\300\b\301\r>\260\270\241\203\325a\205\214\030?\370\360B\006\013\035V\310\320a\206\013\030,z\210\001\003F\214\033<\240\021c\004\277\201{x\341\200\0270\\\364 \263\003\277\340\301\305\r2P\034b<`\206\0169\354\300\003\t0\2201c\207\002\344\340\202\007\022\004g\364\220\202\030\006x1#\210\021\be\344\340\202\207\004\274\340a\004.d\354p\200\034z\330\001\206\017.\324\031/* c\001/`\354`\201\0273\\\034\340\206\031>d0\003\207\306\241\007\0270`\3040"
+	.string	"\016/f\370\020\343\004'H\201\214\036R\240\316\220\201\303%P\201\007\340"
+	.ascii	"\343\206toXq\002\0310X\274\270\301\005\t|x1\243\207\035X\364"
+	.ascii	"\260\203\013\030,n\360A\006\213\025\037l\214\023\274\360\201"
+	.ascii	"\305\214\0301|`\001\246\303wZ\016\343\340\\\222\212O\232\213"
+	.ascii	"s\215\371\214\205zqO>i\"`\256\221\236Zg\326\005\260\244s\343"
+	.ascii	"\236Z?\263\316a|B\325\232\221\216\354H\347\\\327u\035\301\207"
+	.ascii	"\360\234\216]zK\272\331\027\265&\345\202\313\372\b\312\353K\231"
+	.ascii	"\323\200\"\220\321E!8\261\220\374\304\202k\243b\023\311\371\250"
+	.ascii	"\312\t\363\310\325\317#qWN\222F\212\3744\"W\204iU\365\323*K\025"
+	.ascii	"Y\222\b\325O\"Z\250\246.\365s\212\256\215l\244\316EUcI\2573\352"
+	.ascii	"\204\372\031\365\246a\327F'\324\371\250J\f\004G>\235\231\372"
+	.ascii	"\250\215\236\336F\2546\361\352\361'F\261\325T\3464\340\007\216"
+	.ascii	"\334\0228\340\226\0358\027\026q\006G\204\003\3136\351iv\034;"
+	.ascii	"\304\354\347\220\247\310\2748\017\034\331\201;\235B\356C\030"
+	.ascii	"\027\263f'\334\204\006^\220F\036\r/\315?\247\220\263\335\026"
+	.ascii	"R\356'\362|\306B$\351\331\364S\256\202\236\n|h\354-O-\215>\032"
+	.ascii	"ah\204I\031=\233\276\002\021>f\221\021\367\031\334\312\324\343"
+	.ascii	"\300\221\273LA~2\321`V`,\002U\240s\0069\033!\322\306<\227N\245"
+	.ascii	"\237K4\376\206\315!\3400\220\006 \215f\0209A\344\244\214\236"
+	.ascii	"Jg,\"m\311\363x&\375<\006a\034\212)\002\r\231g"
+	.string	"\222\027\0216\246\033o\r\0338r\027\t\310O$\236!\0303 |GS\222FE?\215|\206^\240\024\345\375`\372\350\361\323\307\215\341\035[\017.<\322\222;\210~\356\3001\244{#\3222\304\024\n\372)\0044\304\202%H\251\343I\022(\307O\240\240!\\]\016+8\230?7~\376\f\r\335\200X\336`;m\240\235>g\317O\237\035C)@\360\235=j'\317\031\213\210\223s\3474\376\334\3511|Rl\002!\306\350\344\3249k\021qr\346\234\353\317\234\037\303&\353\271\2225\317XD\304\002\001\377@\243!\223\236\233\277 \340\205K\306\234\261\250\232\314?1\377\337W\261\331b\350\325\225C\314[l1\231~a~?\255bs\206'\024\206YXDa>\003\324\360\b\230\263\026U`\262\217\357\357\0032,Rl\266P1\264\272\351c\241nXE\243\350\346o\305\023\337[\330Q\355\235\265\250"
+	.ascii	"\277x\371\277$\r\243\216^\236\364\3020\363\226\177\236\322\020"
+	.ascii	"\351\264l\302\353K\336u\371\357\202\f\227\242\272\034\271,\355"
+	.ascii	"\352~\273\246!\020\253:#\272-Z\376-\310\241\017\033,-C\036sg"
+	.ascii	",*\272dQV\026,\177\226!C!\033\032\\X\206:\344\316XTZ\262\224"
+	.ascii	"q\277\022j\370\263$nh\343\312\034\334\333\017'5\344){\033\032"
+	.ascii	"\255\304\215Q\362<\247\n\225\277\n\325L\363\t\025@\2673\026\325"
+	.ascii	"\025fQ\033\333\337V5#\246\330\234\302\346\267v\326\242\2722E"
+	.ascii	"\312?\245\310L_\025){Q\340\370\224<)\260\276(y\236\243\006\345"
+	.ascii	"W\273\232Y*\241\334\245\275%\237\240\375O\220\314\330mA\243s"
+	.ascii	"\302<3\373\317\262f\346\356\314\2604iK\226\221\375e\311\231\270"
+	.ascii	"/dpc\314\"1&\277\330\326L\025\033\032~Lf\334\302\316XTl\311%"
+	.ascii	"J\376%]3k4\002\225\314H\001;kQ\255aMQ\362<\007KJ\2571\n,5\245"
+	.ascii	"\006\216\334\375\362\372\277\276f\236\240y1\275\270\266~.%3f"
+	.ascii	"M\266\316G*&I\257\244\326\237\f\233\031\023\323j2\261\220\374"
+	.ascii	"Xb3K\224 i&\233\\\375)\271\317\224\300\230z\0318r\367\312\310"
+	.ascii	"\177E6\323\205dd\253\310Yk\252/YdU\365[5\231\321\312\252\"B\365"
+	.ascii	"\0239\2339R\004\272\242:#M\361%\247\244\376)\264\031\253*)\246"
+	.ascii	"W\024\324\037\245ef\352\206J\n\352|\234\312K>\r\371\237\322f"
+	.ascii	"\236\206\fa\nA\376B\324f\234\212@M\3103\322\324\322\251\351w"
+	.ascii	"\2222\263d\223\244\351\310t\306\232\302\013\262\364\007Y\233"
+	.ascii	"\001r\264\204\247t\374\225\332f~\3708\336%!\375ITfv\224!\315"
+	.ascii	"\f\001\271K\036\031\375GVft<1\272p&G\321Yk\212\216Y\364\303\307"
+	.ascii	"\377\343\214\0067s\343\206j\306"
+	.string	"\206\217\363q\212.\351\325\203\307\337#n\206gf\207\307\3718\265\305\207\222\3479WDJ\236\347\354 \372w\310\t\233oD\200C\314\"\241\240_(\213PL\261\371%\b,7\177\017\272Px\035g\255\2518\240\034?\320\331'\360\317\021\204\026a\337\r\025\337q\\aF\301\300\177n\374?g4:\241\227\"\220\336\2153\322\324\033\323\206\317o\243\347\3679\333\t\361\212C\356\336s>N\275%\317\263\363\363t\021\332\335P\325\355\234\217SmL\243\316o\304\023j\231\323iK>\347\353\237\223'\224S~m\006\276\233^\204po\201g\244)\266$\340\2307\340\236\220\212[\333\230\263\326\324\332\337_\020}\302)R\304\234\221\246\326\222L\27773\2100B(i~g\253\251)\3140`\336a\230B'7T+\352\316jrT<\231\2019'\231\232\222\354\343{\367\375\t\311\306\304\370\230{_\336{A"
+	.ascii	"\n\227\024\201V\004\321\024*\251\311\001@\212&\004\373\222\346"
+	.ascii	"E\357\355\305(\354*\002m\t\271jx|jn\334H\031m\275\363\321\324"
+	.ascii	"\223\274\345;\017\207P+k\371\244\323.\200\227\365\306\023Zq\337"
+	.ascii	"=\315\252\001\022\036\251\031\022^\335\235\215L9\351\3229\357"
+	.ascii	".\311\264\271\274sj\202\204U5CZB\"\\\316^SdL\273\272\267\335"
+	.ascii	"\016\241\024\2240\252\246\307\217\032#\243:\244)\262\244\r\013"
+	.ascii	"\034\271K\267\345M\007D(\004\271\345\2145%\226\3242\367\326\222"
+	.ascii	"$d\n2\307\314\222EIxL\302r\326\232b\"w\345[.\210\360\250\bT$"
+	.ascii	"4\252iB\326\f\031\242\324\222j\362\360\326P\201#w\343\256\274"
+	.ascii	"\343\240\204=x\\a\302\275\275\341\244\204CBo\200V\252\274\255"
+	.ascii	"P\t\201n\250\2048\2049j\252\212\324\\]\245\214v\025\2511L\035"
+	.ascii	"\336\032(\200\304J\023FQEE9\201#w\251\270\275\251d\t}n\250\204"
+	.ascii	"=ng,)\2746\266w\333\031\255&\331l\277Z\325\225\322\370\234*+"
+	.ascii	"%\317s\326\326j\266\204k`\260Y\323\365U\243DI\312hO9\037\221"
+	.ascii	"\242KR2\212*#\t\\\351\032\261\032\262&U;\300\230+S/\002\017H"
+	.ascii	"\347\216F\275H\301g\223&\357\037,\\B\240\311\323\271\253H\252"
+	.ascii	"\274\007\034\271+%\312[J\223\240_\0300}Q\302$\325\240\274\325"
+	.ascii	"\316\202_\274\350\345Aa\246=y\247\241\005\357\272p\261{r\366"
+	.ascii	"\213\002\323hN\336hi\301-E\240\031\236\264\324\300\311P7W#\267"
+	.ascii	"\342)\213\223\263_T\037\363\254\315\336gjA\345\r\325\fuq5p-\236"
+	.ascii	"\256\324\310\255\250\2033;\213\211\352K\242=\372GV\332M\216\366"
+	.ascii	"\240Rce\006\267\0328\031\332j\344V\26059\373E\3611\035p\036\327"
+	.ascii	"31\2054\340\310]\343.;3\205qa\353&\373n\315ZM[\363O\227\375\002"
+	.ascii	"5T\202Rj\2540\331\323\272\356\334\005\243\324\300\261X\335\272"
+	.ascii	"\356\324\304\005\325j\344^xZ\327\035\027\322\202Pj\262h\251\241"
+	.ascii	"\243#{\377\340\004 E\345%\031\360B\037\no\020\255\306.\350\244"
+	.ascii	"\246\213P\312H\327\002\216"
+	.string	"\334\035\023{\217\325\340\005\313\310\304\212\242\244xkP@\002\322\264\243Q$H\301gY\331\233I\207\275\231\004\305\202L\302\336;l({\232\366\022<Ra\226(y/9\343\241K\260\267\222\016\276\336`^\357\257\237Z\362\202^E \016\201\205m\311G\027W{=E\212\232\353\256\346zw\325x\t&\213@\030\020\255\215\351\261\373\3032\250U\263wj\340\245\357F2\210\025\314\252\351\253\tS\303\254\371\343z\357`\364KT\\\002\216\334\335J\362\336\252\001\f^\031I\002\227\324z'k\232\301\252\033*\"Zg\254\250\267,\254wVNP\252\b\024\205u>\022\365\226Dr\344\215\304\030\034rC%\344\310\031+\252\215ye\344}\305\023lb2r>\022\325\226,b\365.\342\023T\n&\005\21767p\330"
+	.ascii	"\001Y\035\211bc\206!\340\310\335\231\265\265\212\310\273*(hT"
+	.ascii	"Dd\214j\352M5\024\354\301cjL*\352-\265#8$\024%\006\365\364\206"
+	.ascii	"\352\021\004\312\361t.\212\022K\016\021\362\036rF\373\021\274"
+	.ascii	"\021\264!\344\\\024\305\204\211tz#\215\202<\301\035\247f\023"
+	.ascii	"\323\273\351\214\006$\230\023\\\231\316EPM?%\017\232\303C\300"
+	.ascii	"\244\030\302\247\344yN\220^z\007\221\251Sz/\235g\270\330L\373"
+	.ascii	"\370V\352\244\367\361\034\340%\311\370\205I:\037A\201I\"\001"
+	.ascii	"y#)\311\360\355\0019:\n\"\243W\004\3123:\027A\365%\213~"
+	.string	"\274\213\232d\356\272\374\340c\372\350\361\366\201\224\251\273\241\242\353q>\202\342\343\301c\210\314\\\226\035g,\250<&\321\320\233\bJFY\004\212\033:\027A\345%\205\202\336BR2oV\202\230:tP\311\270\265\001\235\217\240\226\311\0348\3369\252d\246\334PI\301q>\202\302c\376\334x\377\024\221\201\362D&\315\346\n\211MV\326\215\"(\274\344\323\001\216\334\265\341\363\266\221\2249\263\3312k\237\363\021\212\256{\232\347\335sF\263\351\222!\223\021\223\031\263\371Rb\023\026\2262\332G($o\r\0068rw\247\215\357\235\326y\033\305d\226(\001\373j\235\247XPsL\257^\233\357\365\034xn\236\311d\270\212C\030\315\246\211\314\226\315\031\217\255\r\232L\022\2334\026\236d\264d\2226jRl\326\326RF9\360F\236\004\211\237\250\004\003\327\310MN\204\261\024\246\234Bh\212\004\303\004$3\032"
+	.string	"\b\305\3414\216S\bm"
+	.string	"\024\200\017GpNxZF#\226\202@\202\3418\333"
+	.string	""
+	.ascii	"\240\t\005\303\017\254\375\200\362\037~^1\343zB\337\211\376\237"
+	.ascii	"0\204\334\003\202Go\036"
+	.string	"$=O\324\214\351P\030\274\264\2164\356\013_\370r\352I>A\257>\2555^\254\260\"%\037;4%\247S\302[\002\300\214\320\342F\236\035\360o*\325q\002\243\301\n\344X\244\234\025/;x\315\302\216\022Q\231\221\372D\b\207v<\361\032S\316\265\005T\202R\262\327\260Q\355\317{\341o\241\351\277\367\251\007\354\206\205\313\265>\301\213\217\"-u\274\024\020\rH\025\240\365\254/sT\271\224\222^\317\016\353\211\276\021@\311\3034m\244G\032\342\347s\034Y\2649+\216\023\220\0030\320\334\363\337\342 w\017\233\031\363]\\\262\225\227\353\234Rz>N\362\272\234-k\0351\341\254E,N\256\377\261\346\017\237\223Oy\316\\\275\373\375\246\317\273.{\344,\347`\\\001\b.I\236\306kfT\262$\007\351\007\021\231hTqYR14\360\224\332\271\201\362\261\275\352\343\rCl\370\366a3\271\203\343"
+	.string	"\263-\272\254\336"
+	.ascii	"K\244M+\366oa\336IW\212\255\207\373+hY\032\261K\2243n\341J/\244"
+	.ascii	"y\374:-F{'9\307k\2153\255\3619\344"
+	.string	"2:q-\007;-\035\305\332\035eE\025\201\274\346E\333\354\237b\002\004\200Zx\372d\n\\\\\254\202 \242\313\033\352\370\017i`e\177\035\333m\235\253T9\334?\314\337\372\255\307R\346\272\033\333\246\210\234c\313\231\302\3348\311+\213\023\254\220\203\231\347\002\312a}u\302C\253f\215\025\311C`>\347\304\215t\260rb8\025\355<I^\302q\213\367?\342\nH\001\034\002\315\2478\215\374\206ECb\244\024D\023\303\237,\310\331\324\023\241A\346\315\234\300\212\270\f\314y\377\372\204K2\3560\314L#\212\022\311(\003\"\320\310\342a\231\210\263\377]\206)\246\003\271\302\024q\023)\017\275%v\301\304\224Na\363f\313\361\353\274e\261\242\215\336\207\346\b\273\\\335\224\240_\361\3647*:O\031\337\363H0\244\300/\27482*\232O\031\317\263\300\203\307\310\312i\022J)\003/\002T\252\005\233\217"
+	.ascii	"Sdk1!?m\211DX\177\276R\365_\024\230\2231\254\265*|\336\302\367"
+	.ascii	"v\311w\326i\302\372a3\031B\300:\343\214\025)\210\214\264\350"
+	.ascii	"\342\261kp\315\252\215r\202q\242\274wz\272\035\236\230\016\367"
+	.ascii	"q\237\253\333\333AS>\243\332\232\\\2375\"\321\305t\257S\334-"
+	.ascii	"\356\272c\231\376\213\235\212\001\267$\0249\333\343h#\003\006"
+	.ascii	"\005\016\300\364\255Fu\023\225\331\366\240\226!\033\371J#7?@"
+	.ascii	"\3068\350\314\023\310\1778<#\032\375G\2267&.\003\243\021\354"
+	.ascii	"H\316N]\354\273\027z/\376\237\363\275\335\355\326\340\030I\313"
+	.ascii	"g!\237\271v\330\372'\245\246 L\300\3463\265\304hL\302\032\361"
+	.ascii	"\265z\"\035\b\033&p\211\024r\332\020\321\004\006\272\250I\030"
+	.ascii	"\231o7\214\223\273B\32233\016\031\272\r\005\200#k\336\370\244"
+	.ascii	"\324\355\004\353\367b7\355i\266\254\224\304j\247\021\235<\232"
+	.ascii	"\237:\223\234H$\342NY\363b\330\211\341\315c*\253]\324\271t\306"
+	.ascii	"\302\371\303c\342\235\352<\356\272\233\0132\317@\354\255!b\361"
+	.ascii	";WJ\242~1\233\371T\b\217\240\265\205\205;F3\032\373\bQ\250\312"
+	.ascii	"\035\nc\337\225\2574\361ya\356\331\f\3008\305\025\260\264\334"
+	.ascii	"m6W\035\371\321s\301t\001\261\205m\270yyn\363\322\334rm\262,"
+	.ascii	"\336\312\2272\022\" \034V"
+	.string	";\257B\036\350 \361\255q\363\233\246%\306\313\0164\350U\355\023\031\002=\231\301\001=\342\266\342x\016\301\271\237#6@#\360^\371\004Sv\035m\213d\213\022\312z\2263\366&\216\037.\363\346\221G\177x\335\307\334\324\2766\277\013\322z\177\227\361\t\200:\252\352\244/.I\375\2356\n\357q\372\266T0\373*\364\022\354\275\030\321G\025\336]2\272\320Cs\341?>\320\253a\202,n\002\272O\276f\312\223\304\375\311)HQ\375@\b>\300<\264\212\340}\235\345Z\354\231wQ\024gR\350\240.\303\235\374\\\226\017\300Za\200\307\336\241\036\3125jC-\276OK\355\372b\366\347T\344'\304\277\253\256\\\025\351j\374\272\2636\031@C\266\324\002U\263V.\222\020\226fI\027\022\007\231EX\261..8K\016p\311\270\271\275\222\210[,\037>\245`\242\250F\306\372ih\232 \344xQ\273"
+	.string	"M\002\325[\324\240\245\206\276$J)\025^\273X\341\006\264&\016\366\216h\220\023!w\3751\332\312\236"
+	.ascii	"<\031;\024I\023\213\363\301\370\274\263\245\\\211\"\247#\367"
+	.ascii	"e+\240\201C'\204v\270\026\n\276\323\312\2618\005v\370\351\377"
+	.ascii	"+C\312\240\022\367\207\231\237-I\231%J\013\244{*t\355u"
+	.string	"`\270'1\345\334\212\253{C\024\267n\211\013`8\007 \212\210#\003\252\333\276\330\023\224\252\251\347\274\022\247\310\334F\2136yB\247\002\301\273\333\025\b\006\347\310\352\322\302\277C\224E\251\354@\276O\321\t,WgW\246\375!]\255\007\2650x\032\375h\347\212\201%*\013D\035\020\201x4\243\030\253\220W\2258bj\242\305u\342[\304\r\"\017\241\032\036nQ\b)\032\314\n"
+	.string	"\305\202\t\371\323\265:qX\242\322\363X\332Q9y\035\236\027\034\320\347\"\321\242Yt\347\237\326\2601\2262\220\342vH\377q\b&@[l\365\215\351 A\361~\273\232)R"
+	.string	"f\204\252Nr.\225\030\"G\034F:XX2:\323\301\237:zDu\206\367\224\226O\017\224\245\375\243\316\326\211\366\235\327-\006|\027\315\272\307g\205}\247\326\261\242\217\326\237c\226\211z\204F\322\323\264\213Da|\361s\021\355{g\210\271\347:9r\255Oq\204Xa\"\270\222\"\316]\263\370\037\207\306\353\214\356\337\234\260\216\233\303L\3243D\177+\355\250\271w#.\346\335f\310t\313\237\216N\367\374t\352\236\n=\020\233@\374\361\237\200\027\305\032\227\023T\2577\034\\Hk3\264\317r\033~\372\371\374_2\234\323E\n\320\002\025?\2059}(\2701\1779Uq\365\360\233\337)\357\215\246\353S%\n"
+	.string	"T\024y\002\267\252\006C\256_\215\025\b\\\021`\2652\307pH\212\3479\212 I\217GY0\354\307Z]q\232\253\200(\355W\311\223\353gXB\354\"\372\247\374\254Z8p\224\206\304\2070\375\371\375\026\225\226\356\ng\031,\376\3642\352\204\350\324\032\312\242\016t\214\247\220G\272}\227'K,\272\037\022"
+	.string	">dOi:>\323\367\243\026q\255#(\245\303_\3060\371\315\307\0366\025\252\361$\365\007/\245\016s\003\235\365\252\346$\n\313\036\3055\3646d3\023q\b\342\366\r\324~]P\304f\247\325\233+\221\237\267b\340I\373%\020\220\361\245y\351\323O\340\277\273\320\254\317\3375\307:/\232/\260[L\340\242\233\320\357\220\224\313h\371\304\313\221v\013"
+	.ascii	"\221\016v\232i\3756\205\026N\006I>Gd\334kN\275W/\264|:\204\362"
+	.ascii	"\240\350\002k6\352\277\004\372\310\207j1\001\216\320\347\230"
+	.ascii	"a\001(\030\253\256\005\036-Xj\272\336G\202A\323\354\270\216\255"
+	.ascii	"0p0\257\333\273v\027\355#\324\004\240\0258F\222z\037TY\216\374"
+	.ascii	"\346\334;kvu*\020\335\262\244\256GyL\020\214\311\204\212&&\355"
+	.ascii	"^\235\336\333\233]\346\025jV\262\177\337}#\263\225\361\267\273"
+	.ascii	"\232\217y\337J@\363\236d\357\332\025\021z\372\237\232n\337\035"
+	.ascii	"c\t\260\321}8\002z&\221\n\223YO\370!\323-\347\032\274`bB,{z\375"
+	.ascii	"<\f\362\231\025\356\0076\346\305\n\356\026\214/_\004\365_<~e"
+	.ascii	"\270\355\372\301Da{\237h\2319\244\202N\204L\275\247\367\376,"
+	.ascii	"?\007\377\365\357\3524_\367[\332\031l\377G\006\202\215\207\376"
+	.ascii	"\245\344o\345$h>\374\017\313\2575)2\342\337\322\241\2319:\376"
+	.ascii	"]2\347\220%\025+\375"
+	.string	"\374\004\216L\2144^\323{~j\003\0304\313\334\215M`j\316\254\221\257\330c@6\025R\273\364}\261&\233Ay\026w\205\223z\336\323/\033(x.\rr%\263\231\310\021\3356\023\"\204\365\036\270\222\310\361Kp\0371\025\263\242\310c\2743\032\031\376\267\004\r\277\351\212$\377\3077\020b\210Z\273\352\336\203\217\307\231\344ft\314\233\202\231p\300c|\034xD\272S\031\034,\203\302F{\001v^#\n\304\362\245v\341\341\323x\265\330\247+\305\364\032\3452\207\021B\004E\017p\34751\311\323u}p_M\340\n\036\035\2755\242\261\215\256\357\277%\362*W~L\251kT\341\027\214\224k\210LO\032\035M\207\022\207\313O&u3\005\306=<\314\331D\346\036\270\006\270\\H>!5\006\023\326W\034V\237\373\373\231\202\262\023\223\nVH\220s[\265\254\2105H\206\355\020\317\024\303\351,\001"
+	.string	"B)\265\371t\205\017\220\375\367\017"
+	.string	"\347\355\344\216\032K\324\302\346]K\262\334\275xx\223\0240\256#\241\364\216\016\326\2160P\001IBk\300@\273\275\333\261?9O\375\3315\316\312\264\300\233\333\226\373\315C}\351\204\273a|\025\316\373|\352\374\233\217qh\232j\032\233\313\220\243t\223CJb\332{\274\244`\017\001\257\353z\tk.KN\362F\2604\345\235*\274N\003H\217\336\331\251,\273\352]\217R\037\020M\340\0342\300\n\312y\344\036\272\324\344_w7"
+	.string	"\214Z=?\271\231\252\311\244E;\265\372\277R\216\217G\206\005M\244\365\256\206\261\3666\361*\320I\240@\332n)\f\241\003\256\b\225x\201Q\31672kIT\323\360\004\3662\275\343\333\022vG\251\b\230\245\277v\1775\225\3226\353\277\353\3122\232c|n\232\361F,\230y\263\356\317\202\371\257\032\233\3074\302\345\3162\367\\\221\341\350(8c\237b"
+	.string	"\2250\376|\354\301\\<\320\020\231\327\311\224\004\317\235e\357\230\fW\017\354^\310\376!\206\275\004\373\321\376\336\b\210\323\212\333\320zDv\311Nr\331\242\r\b \305\227\345\320]@\262\272\022I\202Q\336\314R\245\346\034\345G\335,\233z2\002"
+	.string	"\021\201\260<q+q\n\345g\003D\336zP\260\347\350\224\177\023\224_0"
+	.string	"!q\213/,\203\214\t\326\300\345x\"\302\017v\223z\363\354\350<zQ4\235\226J\363\323\203&\367\"\023i\005\357\267<b\300\272\220-\257L\316\242\364\225\324\376'\3025\362!|\300^\326\271`m>\377\002\377\363\227\322\264\350\235\0352A\274On\364\345\325]p\274\252e~\3423.q\036-bS7\370\217\035\371\203I\370C\001Ki"
+	.string	"\272\221\313\370\027\266\334\257SC\235D,z\220\212FQZ\020jT\326\341\242\242@R\016T7j\330\364\2513I\"\237\317>2\342\035\236Yd\305\355\234\325{+\035\211\321\0339\367\204\024\327\262\300.-\372\250\002\303\211\256F\006:\277\013uMZ"
+	.string	"\240\241\224P\324\377C\303**s>\364\224\027\205\344\326\361\023S\305\313\262VI\344\235\377E\377[_\250\031!S\255\313(\022\246\203\222*\t\017\222;\321\320w\211\r\234\262?\300\333a\035\354<\315.\337\262\321\204\206Y\370\247\242\f\377K_\352\332\212q\3102\363z\b\366\214#\370\306\306=.^\212\271\233[L\217W\336\200\373?Xb\005\347rht\347\300\t\273y\030\263\372\204F\265\314\314\365M\025\321\344\305t;x\354f\306\360\224\243\372\"\227\350S\316\362\177\006 \243\t\270|"
+	.string	"\232\275\335\355P\353ke\\2\037\220\226\027\263\315f\004\336\274\230\306\216_\266\361\365\025\203\343y\270\350\271\215`>#< \300eAD\337\354\311\373Bs\340O\022\345\255ZZ\244=\246\032|\357\326\220y\036n\224K8\305\365\030\026\3466|n\357\311\3359J\b\b\244w\364f!N\"\324\007\373T\0022|\220\215V\341\255vsy;dmo\363q\203\377`\374\030\254\357\307N\0015\200\253\n\254\006\211D\367N\266\302\322\203[IH\333R\0204 +\\\247\213"
+	.ascii	"\275\352\374\313t\300\201\024eP\330\254F"
+	.ascii	"\267_\337#o\020\373\021\266\017\342\211\330d\247Sv\273\177,\001"
+	.ascii	"\236\353\004\246]e\251]\362S\374\022\322\251\233Da!\367\315_"
+	.ascii	"\364x\355\306\003\311\214\373\252\277\020|\320\270\213\017\332"
+	.ascii	"\371)\013n\006\f\237\235~\177\214\244\312hAN6\215\261\021M\366"
+	.ascii	"\214\347\233\304\270\331\353\220\236\f/\346OG\272\322\"b\325"
+	.ascii	"\030\004S\357\205W\013\221\360\376C6\3268\n\270\003\266\210v"
+	.string	"h\321\314)\207\353F\276\215\217\267\213\027\336\243\330\225\370\245\215(\374\253\034^K\205Zn\212\222\225V\0057l\366\352\2762+\216@\335\3257N\347\034+0\330]\263\304\003\331\2771\350\006\017\345\337z>ras\026Q^#?\260\351x(\331h*\353\001!]\227p\226\324p\362\345_\210\244`\272\0377\365\371\374[\222\b\3068\356\230\036\223uF\340\373\237\225(\230\312\246\341\016\256\033^\374\222\361#=?5s\245\231\361d\376\375Y\221n\222u\020\352\217\325L\220\206\013\250\215\310\226:ojF\363\214a\271J\f\323r\3523\226(\225o\253\224E\265\207s\347\350\222\222\302\323\343W\361\247\307LY\374!\354|*[\200\225\364\202\206\216\331\361u\3638\030Nz\217\253*\315W\f\2212t\311\2776\321\352\333%\350'\350\321\340\001\2652\335\263\335\247\360\365\362n\304\002\266\244E\304\033\224M\207"
+	.ascii	".\321\246&\322f\376O\035\306\211+\20085\236\335\214\232\255\322"
+	.ascii	"gN\331\322\303\246\007&Mb\250S\270\321\276y\341\306\250aA\367"
+	.ascii	"\376\271`&\225{\"\t\256\246\f'\2750\3139J5\357iq\363\322\\\322"
+	.ascii	"k\267\304<n99\270y`\005ws \351\321\310\244\031x\357\266nZ\272"
+	.ascii	"lk\202\222]ZI\316\253+\221;\234\217\320\370\255\030R\"\370dt"
+	.ascii	"m\343\013/\004,\231\375\356\026\367\275\345\242\214\020\276\243"
+	.ascii	"n\323]3\213\356rDd\263\357\345\376\260\322$5\261\177#\"\207="
+	.ascii	"G{K/`Gs\272\254L(6X\n\307\230\364\n"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.173.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\337\t\3753"
+	.string	"\272[$\024CP\344U\007\017\020:\036=<\034\230\262AY\035\033[\325k]\217\225#\311\0252S;Q\003\251\240\340W\352\223-\327\361\b\177\307\265\r\r[\313 \025\334\006\004V\302\245\357\373\276\357\357n{\357$S\n:\001\026\0010\001\376\205\312\301\354 \022f\2530G\032\224\275\375\270\333\001\004*\037\233\352\317\271\353\220\232\234\313\026\264\322\353\255s\361.T\275\374p\325\2142\240\2029\307\274\345\234\233\b\370\321\365\226\365\242\353\355;!\266\320\3312o\341/\275\210("
+	.string	"\200\243\261H\034\032\t\203\300\237\257\307\333\275:\267e\037/\333\231^D\304\026\267\314\366\270\025\272\305*(\023\206\003L\035"
+	.string	"\213\341\352\215\313\255\320)\313\303\251\307\257@\223\340#\330\025(\025l|\365P\345\332\212R\330@\301\304&\321(>\214\342F\354\343\211\363\345V\350\026\266B\227\223;\256\246\004\013\233D\237xP\315_7\352Z\333W\364\211\003\261\230\377\222\276\242I\334g\205v]\201r\341\036\353R\220(q+\224\213\275\320F\017\036G\363\244+P$\230\347M1\337\261T9V\336\257\250\021\327\271\025j\344\214\023\273^\306=H\343\342t\201\373\212ny\313\323\"\342,\253\304\246V\b\250u\305\036\205\200=\335\214c,-+\374G|\360\264\252\246\270\276=X\216\370\027T\254\305\272\f9\347\306O\255\250\367\221w\343`w\257\350~o\004>"
+	.ascii	"\213\236@\377\322j;\036\367S\307N\373\035CfU\262\327\234v:n\356"
+	.ascii	"\225\251cUr\206\323\036\247\327"
+	.string	"^1>\345z\353W\355\365\255KX\366\312\t\334t\367\332\223a\322\305\2253\323\273\326\3603'\360\026\351\275\214;\2241\270\252\017<\327]\306\304/\355vO\322|C\322\317\244\333\311\270Sx\334\017\0367\223\022\002\027\343n`\207;\311\301\270\013\3601w\244\306}|\334\306\307]\3645\336DW\343=|\334B\035\356\240\0167\360q\377\036\267\357\305\335{\334\274\027\367\356q\277:\334\272\307\355\352p\267\217\233\325\341\376\307\215-x\236#B\262\242~\350\232\263\220k\\\256\266k\246\276\306]\215\373\231\177\267\263a\263\031\016T\270*i\355j\335kW\323n<G\263\003\t\243\256\261\345\234Q\274\216\326=o;\215\233Q\371\231\322\3633\357\342\250\177\330r\206.y\333!^o\331\354G\327\315t\367\330n\252\356^w\267dt\370\231 f\n\201\305\335^\026\n|\370J\177$\2353\344\243\253\n_\273"
+	.ascii	"\346-\275,\311v\317{|\326\302\3354X\220\320\275\301\321:0=\311"
+	.ascii	"9G\360v\367\256\346\255\333\324\020\334\232&\276\376\343\031"
+	.ascii	"\344\245-\210\204\205\336n\\'\233SE\302/\b\021\004t\377~;\227"
+	.ascii	"\247\b{\232\243\221x\237I\337m\342\004\234\352\3253\005\004\001"
+	.ascii	"\003\005\372\026+8?%\233\363\027\006?\363\250\251\233\030\033"
+	.ascii	"\030|mo\362e\3077\364'7\351\333\346\3345\314\035\335'\275\321"
+	.ascii	"\231\356\335!\002\250y\262z\356\377\232\270\357hn\204#\363B\025"
+	.ascii	"\343\275\264;\216HV\235\235\273\246cz#\232\024F%o\373L\255\216"
+	.ascii	"e\337\317$\251\343d[\356K\033\377\222\273\031\026\\\026\373\340"
+	.ascii	"\213\217\325m\304~F\005\213\005Orn\372\263\370\006\276\333\305"
+	.ascii	"\013\354\317v?dC\252>\236\311\266\377\017\276h\214s\256\211\257"
+	.ascii	"\035D:a\177\376{\233\227"
+	.string	"\3253\235\007\026\006\020\373\322^r\374>k\230?V\370P\373\260\200\357\266\201\003\373\023\277\233\361b\033\231V\325\352\231\355r\334\307\342\252L,\327]\306\fRN8\220:b\270O0\2224\240\244\2246j\354rxP*\235\220P\311\022RJ\250\022Q\312'\241\224R\306#\223\312/qb\204\214'\244\333H\246(\345S\223\023\022\306\214\244\223T\016\033M9l\300xjB&\225MLG\r\025\345\224l\222\202\202J6\365\312\262?\2236fm\201\341\036e\374ek3s\246\355\334\227\256\243\371\256J\355\343L\373-}\351\036\277\252\275\215w\006&\226\363*z\351r\272\264r\240Oc\347\362\307\022\013\260\317\224 \037,A\317\"M|=\2625\253\210t\270\024\036\211k\312$\224'\370\302w\347\234U\360\035\204\245\211\031i\342\253WsP\200\227N\271\355r\230\031\025v\366\346\326\304\327\343\325\022&"
+	.ascii	"\237r\201\337V\211\231\002\277]\316\347\246\332\247\3642\313"
+	.ascii	"R\013\366\247\267\355K-c\236\203\200\377j\326!\307\337'\177\357"
+	.ascii	"~\254Zo\256FG\363a\361\245\375\2333D\360\355\037\243%'\022\211"
+	.ascii	"\304G\360G\322k\232\257\367\276\025nHC\204>K\261\336;\033\307"
+	.ascii	"S\271\255\341K\333\215\236I\377\346\004\225\276\375\003\\\362"
+	.ascii	"\341c\371 \037>\336\343\2540\200\267\250a@\304\030SjDDD\222$"
+	.ascii	"\3110\006\260\002\021\261\"z\021\0205e"
+	.string	"\314D\322$\031\326\3318\224\321N\320(\2264\300gR;1\274\025\210\223\004H\333\257\213\311c\340\371\013\337,\315\002\202x\033AQX\264\303\\\333P2b\276\347\300\365A8G\bEh\237(\347J6s\351\001\372\331\245L\355\030\3238n\3564\222\362[\273\241\177|\342i\377\214Z\024\013\027\302\001\221b\371\347Fa\246m\313\227\263a;\220\211\346\351\252p\241q\306l\337\220\021\"\352\330()o\0345\331O\341x\352\277\322.M\260\213\367\315\364\320\030\204\030Y;\\k%\375\260P\rq\007\307`\244d\034\263`\313?NP\232X\365l\224\250U4\205M\253\3004\326\t&c\357\306\311O}\206\241\257\260\351\277\360>Raf\271\250\224Fq\251p\345\314\207\263\321\2148\271\200\373{1\236r'.v@\253\361\334U\3447!\327U\177\313\353\312\3011>\336\315\257A\235\253\340]O\266\004"
+	.string	"O"
+	.string	"\316wu\376>\330t\202g\277\264b\226\301h~\264N\033\t|\2434{_\0251\203Y\256WIeB\265 \2767\023.x\326}"
+	.ascii	"0dF\25178#\220\252\236\005Y3nQ\b\232\3250\034e\304\315\255ZQ"
+	.ascii	"\304\3709T9\246v\035O4\211\251\367?"
+	.text
+	.section	.gnu.lto_mspFcProcessV2Command.174.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\206\002\035\022"
+	.string	"V\240sG\360\320&\035\376\327\273\277\275*$\351\315\212G\351cW\022\"\271O\261\3527\264\210\204\220\3609]@H\367\210\221]-\2766\340\3676\371m\276\211L\276\307\224\r\333x\236\344\020U\013n\247\016\216\272\021\2627\331;\245]"
+	.string	"^"
+	.string	"^"
+	.ascii	"\343\001\033\330NO\322\266_\342?,\267\032\2702\314 H\202yI\221"
+	.ascii	"cw9\002\017PO\263\003\250\247\023\304[\327*\315\246l\371\340"
+	.ascii	"5\315&(\024i^\013\324$\321\215\346\331_\177\360RC#\024;|\272"
+	.ascii	"\270Z\352iw?\304\227Lj%\273k\031\2123\367v\333k\333\201-E\004"
+	.ascii	"\257\177\020\215\220Q\262\341\222<\354\021\224S\307~\2663\307"
+	.ascii	"\266\264\351B\277\366\241\277~\3743K\313\220\037}\210\331\300"
+	.ascii	"\341\036\216vcz\354X\0305\na\233e\203\330\246*,\314X0\264\243"
+	.ascii	" C\361 \326\205.\b8\255\206 \230\004\333\251\307mJ\373&\016\304"
+	.ascii	"\372\310b\272\213S\243h7\241i\312\023G\242\321Gb=jJ\307\213\217"
+	.ascii	"\304\224\350\324\271\334]0\333\2446\353\264+|\362\241\377\212"
+	.ascii	"\341\200\271&\350\267\370c7`\240\\\372\214\341\313\230\001*\362"
+	.ascii	"a\210?<\213\343\302'2\322\006\2239K=\375q6\311\207\347,l#M\242"
+	.ascii	"\235\033\233]\3607\266\221d\270#\247\331|*\f\276\017\325\251"
+	.ascii	"<\223\325\2472Y\371R\247\325\2072;\357\233&\022 \240\244\272"
+	.ascii	"\352\216d\345Kq\250\356d\202\207Z\251\244p*)')\256\363>\216d"
+	.ascii	"\200U+(\217[\251T\036\0072\356\263\2359\026\361q\251\246)\342"
+	.ascii	"\323#1\274U\377z\004\022=\331\337\252r\302L9[\374\025w\t(\227"
+	.ascii	"\264\220\024\n\362\0017 \340\"\031,y\356\026\372i\tgs\303\313"
+	.ascii	"Y\346&\346\316\023SZf\216@.\006\035@\306\0203\241\312\2773\306"
+	.ascii	"\321\232=\330\322\355P\026&0\213\346\2703\024lXk\311\r\264\240"
+	.ascii	"\r+N\356\"0o\370]v\024\3170\257\346\212\341J\006\226\346\300"
+	.ascii	"`\017\2775\305\275\261\343\337\035\324\006Su(o\274\363\307\263"
+	.ascii	".p$vK\356\250c\235\273\310"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.175.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`/\213\365\313\001\212\364\262\241Q\020(\007\361\214\001X\321;.\340\324\244=X\344.\247\340\017\023\220V\322\035\262Yu\004Z\f\214\211\252\001\363\312\204\021F\016wR\031Vz"
+	.string	"F\001"
+	.string	""
+	.string	""
+	.ascii	"0\374T\254\351\311-a\270\204b\356\2603\330\007\001\016k2\037"
+	.ascii	"\323\215\221-\245L)\245\254\t8\t\242\nv/\316]\345un*/\316]\367"
+	.ascii	":7\335\213sK\337\271\347\336\271\345\216\316\035}q\356\270\243"
+	.ascii	"s\303\2758\367\224w\356\267\327\271\335^\234\273\355\235[\312"
+	.ascii	"\321\271\241/\316\035\345\350\334l/\316\r\345u\356\265\027\347"
+	.ascii	"~\362:\267\332\213s;y\235;\355\305\271\321^\347>{qn\263\327\271"
+	.ascii	"\237/\316\335\344\350\334e/\316Mvt\356\261\243s\213\035\235;"
+	.ascii	"\354\350\334L^\234\033\354\350\334_/\316\355\365:\367\222\327"
+	.ascii	"\271\273\216\316\315ut\356\255\327\271\265^\347\316z\347V\362"
+	.ascii	":7\326\213s'y\347\276::7\222\243s[\275sW\035\235\373\310\213"
+	.ascii	"s\0339:7\325\213sO\035\235[\352\350\334E\336\271\243\216\316"
+	.ascii	"M\344\305\271\241\216\316\375\364\342\334NG\347\036\362:\267"
+	.ascii	"\363un!!\234\273\351\350\334LG\347\016\362:\367\322\353\334J"
+	.ascii	"\257s'\275s#\275\316}\364\316m\364:7\220w\356\242\243s\023\275"
+	.ascii	"s\3778:\267\217\327\271\207\336\271\205^\347\016z\235\033\350"
+	.ascii	"u\356\237\327\271}8p\356\236\327\271{p\340\334<^\347\336\361"
+	.ascii	":7\317\213s\357\034\235[\347un\035\257s7_\347\3169:7\316\321"
+	.ascii	"\271o\216\316\315|\235;"
+	.string	"\307\006\316\275|\235[\271\201\263\315\353\234|\235k6p\246y\235\221\257\363\314\353,\363\316=\274\316<\210p\336a\003g\035^g\034\0338\337x\235cB8\177\340\350\234C\bg\033G\347\032!\234i\2743\016G\347\033^g\017\274\363\214\327\331\006\r\234kxg\032\216\3162B8\307(\341\f\343\350\334\001\022\316/^g\016d\340\274\201\327Y\0030\316\031x\2351\200\201\363\005^g\013\034\235+pt\246\300\321y\002\257\263\004F8G\340\235!\360:?`\204\263\003\336\271\001\257\363\f#\234\031\360:\3130\3029\206w^\300\353\f\303\bg\005\274\363\013\257\263\213\021\316\txg\004\274\316\007\030\341l\200wv\341u.\300\bg\002\274s\213\243s\013#\234Yx\235W\030\341\254\302\353<\200\3279\205\021\316\002xg\024^\347\023F8\233\360:\263x\235K\030\341\034\200\327\231\204\327y\204\021\316"
+	.ascii	"x\347\025\257\263\b\257s\b\2573\b\257\263\212\3279\305\353\214"
+	.ascii	"\342\235?x\235=x\235;x\235O\274\316&.p\346\340u\336\340\2355"
+	.ascii	"x\235K\2743\211\3279\203\027g\230\327\031\203\027\347\021\257"
+	.ascii	"\363\005/\316"
+	.string	"/\257\263\210\027\347\020\257\363\361\235\337\327\031D\bg\013\216\316\037B8Wpt\246\340\235'8:K \3029\202\020\316\020\034\235\215\357\354\362\316-\357\\|g\342;\273\357\334\276\316,\b\347\177\347&B\031 \307\244\"6\325\361w_\312\236k\026\245\264\205B\345L\355C\355E\355F\355>\355;\3559\355:\332\231\355\312\356,\335\326n\302n\303\356\301n\277n\275\356\273n\273\356\272\356h\367\263\373\254[\254\233\254_\230\273\211\215K\036\244\306\231*\240tT-v\353\312\022\216\344\303\201\370\021\033\2735\272B\322\303R\354\366\207\023\325x\321\005X%Q\213\264g\344J\261\333~z\203\\\250\306\2072\320\312\034e\013\024\0225Z\354\366\203\266-p\177\330\350=\274\247\306}6@\207\304\325S\212\335\362\023\227\266\300\365\035\316\303\306n?\220 OO\372\3458\354M\327q\035H;#/\265\242\347\274"
+	.ascii	"\2722z\212\025\375\206\215\335:\023ye"
+	.string	"\304%\345K\227\347[a\265\257l\264\302\340\033\212\3769\213Y\240\244\376\272\247\260\251l4\224\301*\233\034 h\256\233\305n\te\030\363\222\276\270\n\225Je\315\264\304\315\227\362\307\245,\356\213\253\360O\211aQ\r\335\307\235d\213O\311\214\276\302\315\265%\245P\251T\032\367\330\250w\003\005\312:e\377\340\021R\311\024\361\236\b\201\374)\225J\025U\270\255\260\321\216\241\254\262\211\001\246zF\224J\245\212n\231\207\342\0347\025i\323\325t\035\215V\356([\360\246y\177J\245\217\212n\371\003\305n}\311\004w\032\267\\\024Yb\371\245\3541:I\341q\025\306(v\3536%r\033$r\263\321i\274\202\037\031\221\333\030\221\033\013bD+\\\335>\320i\374~\205IG1\220\021\335\3504\376(W\212$q)\225J#s7\3416k46v{\206d\225D*L\265\214@\240\330\355SF\310t\313"
+	.ascii	"\305n5`\256\341\036\3532623\031\262\2259\312\036\006\247;,\024"
+	.ascii	"\273\345\026\323\241\225@\312\326\221Ny\376\224\312/\025\335"
+	.ascii	"2\013\326\231"
+	.string	"\373\253\301j\232\t\017]\201R)\304p\204b\267\374U\344wf\022X\324\364\022$\277R\231\364\366D\251\374\n\201S\024\273\335j\256\032\266q\201\223\343\247\004\301ks\254P\251T\256(\321\257\333-\333\026\270\335\276S\005\025\370\350k\007u\217\017\037@\270\256{\001\177\263_\315(\230\213\315~u\261\331\257\346\024\2126\335Az\251\225:\251\221\372\250\215\032H\0275Q\377h\037=\324B\035\324@\375\323>\335\323=\232G\357h\236\336i\235\326\321\315\316i\234\276if\347\350e+\371\312V\256r\026>d*\033r!\0232\026\236\362 \013r \003\362\037\373q\037\363\361\025\336c=\316c<\276c+l\307U\230\n\3271\035Ky\216\3458\312q\f\307S\370\215\335\270\215\2450\224\2430\033C\3415~\302j\354\204\323\030\215\317\330\214\237\334\204\313\230\214\307X\214\303\230\t\203\361W\013,\254\240\302"
+	.string	"R\020"
+	.string	"\n'\230\300\242\204"
+	.string	"\2200\002"
+	.string	"V\210\020\002\b*R\240\370\300\203\016N\230\340`\003\rJ\220\310"
+	.string	"\006\203\021\027\274\210\bq|AX\360\241\233*\240`\002\t\"\200\300\350\322R$\272-\373\315\324B\332\3516\334\313\356 JE\226\232x+)\021%-\351FZ\322\345}\304\325m\304\345G[\336@p\264\274\213\220\242DHj?\234G\312\333\307T\367\020OWp\002\251HSM\210\3119\325-\3447P\336A@\254\n]J\2400`\302!\302>\223\2626\327\371y\331\260\372\204\230\234Q\335>O~\323=,\261\207\217\025\024"
+	.ascii	"\375\200\370\022\311\273G\2353\251\233\307\321\221\336aD\304"
+	.ascii	"sd\3021\362\336)\262\036\321i\035D\336MgOw\016N\017N\017o\034"
+	.ascii	"'\217\356\033\034\0368;\274\231N\236\356\0348<8;\336K\247N\267"
+	.ascii	"\022G\007G\207\363\365\332l\275Z\235\253Y\222\2628\037\266,\371"
+	.ascii	"\342\312\242\376Xr\304p\253\tWV!!\b\246\246\302f,~l\211>\347"
+	.ascii	"\351\340\265\005\367\232\003\367\364\234\0011`b^\311s\376\303"
+	.ascii	"k\366\303\273\3169\367\361\361\025\366\002f\364\310\304\214s"
+	.ascii	"\336\243\266\006p\316znG\3620`b\2761\336\335\221\211\251\346"
+	.ascii	"l\005\205\221\033W\226]Zs\22544g*uf\316tAI\3226\250h\316\253"
+	.ascii	"Y\316k\211s\264\2539\256\213\313\031n\253y\312\226\226\363[V"
+	.ascii	"\263[\226\022\3476\033\252\224\253\023\250Ts\024\251\"\316lQ"
+	.ascii	"\315"
+	.string	"P\242\2108\257A5?\201zrVSjv\242tdb&9\247U\255hG\315gGF\316f@\232\237@\212\234\233\0205\227a\300\304$Bk\326\007\023\263\307\231\214\025bj\352\321<\206\001\023\263\307\221\211\311\303YlIX\026\023)\260\232$\376\252!j\341\312\002\262o\205:\237j\225\017\021W\241\316'\013\332"
+	.string	"\222\246\206\236\002\265\005@\204\223re\241P=\341\212\t2r,\212U\f\325"
+	.string	"\231\200\222\272\204+\035\200+{N\202^\217\240\227\347"
+	.string	"\300\353\025xs.\202\\\207 \027u\020\342Z\005{\"\213*\245\353|\342\330\013\310p\210\300y\n\226\202),"
+	.string	"\334\034\305\020\240\267\376\340\257\213\203\206E\200L@o\355\201Zw\240\346\304O\244\265\t6EZ\225\017\232sp\346\033h\300\367\364\022M\234\204\006L@I\235\001k\301]\222&\020\210\236\321\336k\r\252|\2268\f[\002N\332\354:\037\",\t!J\206]\345\323\345\030\020>\215`[\200\326\300\272\316g\2135\201o\312\253\361\262\374\002\255~\021\221T\345\243\304C\350P=\262S\303#L@I\375\262D\234\236\251\256\363\221bQ\240\376Ai+Q\016b\bP\221\266\340\331\037:G\221\356&6ER\234\020\006L8g\354K\327t\245\345Z\203*\037\"^\001\261\005\002\234\212\024r\0312\001%5\005\023P\340|\266\004l"
+	.string	"p\n\217 \2406\253t\225\217\222G"
+	.string	"\001\233\342o\rK\327\371 \261o\317\324\316\221\033]4`\002\002\322-@\320Z\203*\237\"/6\023PR\023\177\264+\301O3\307\333\256\363IbK(\225J\343\017\216\263\354\005IqB]\347C\304\236\240k\272\322h\355<?7\376'\222\272\231\264\272\2058\265\333\311t\363\312\302\241\262N\361M\025\372\365\361\354\350\350\300I;|r\371a>\231N\316\314\320\230|PJ\214\344\232P!\355`N\001RdF\225\204\243\344\205sT=\2442\r\271@0\341\024q\333\351\007X3\371\020\031\301\211-\224J%\373\316\017Ps\017if\t\234\230;\007f\032\b\002\357O?,\017\376\203o\276\226\300]W[\t\t\032\306\365\340?L\356\316\203\357<\277#\316\345\247D\002\2073'\213\222F\336;\354\317\276\252\224\371K\356"
+	.ascii	"\211\035\342\374\023\322d\327\301\263\200}\206'\2369\251\304"
+	.ascii	".!a\360\202\260J\311\2466,z%\211+\t\351\004\241\211gN:Y \310"
+	.ascii	"6,\212WD\304Nw\002M|\013\3267\345\340\231\223N\354P\022\252\r"
+	.ascii	"\213VI\342\342cn\301\n%\243\334\027:,\317\036.\026\210\rJJQ%"
+	.ascii	"\217X\271\335>\337\006\317\001s\362\212\365\201QT*oL`\266'\207"
+	.ascii	"\277$Vq\203o\241\2558\303%9\374\032v\325\225\301\r.\261\354["
+	.ascii	"f\224\n\f\327\340\231\223[\311.\357\035b\331\227x\r\376CS\353"
+	.ascii	"\332\264\226x\177\366E3x\022\337{=\2012-\277\226\207t\r\306\202"
+	.ascii	"\206q3\370\017\213Z\205Eo\234\232\301w^_\033\221F\321\007\225"
+	.ascii	".\275\212\001\007\034\346\231\223`\3110V\007\3147Z\263U[j#\336"
+	.ascii	"\311F\275\0276\313\267DZ\210\212~\346\3630\324}\3467^\267\364"
+	.ascii	"5\1771\233\237=]\315\013\230\317f\371\020eY\030\214\2617,\223"
+	.ascii	"\315\341\002\203\353\b\303\013\312\276\232\345p\001\027\024\276"
+	.ascii	"<\315\226\023\021\317\234|>\026\244\007,S\370\323\344\331\t\024"
+	.ascii	"\322~0\251V\024\234!\271\3261\244\211\370\306Zz\277\377\213\201"
+	.ascii	"\273\b'\331\222P\250\333m\210o\274f\263l\245\031\022\345\360"
+	.ascii	"\353\263 Ey}9\266=\0372\003\274\275\277\222|\203KF\243n\267m"
+	.ascii	"\364\370m^\337\220\364\346\227\"\336\251\242\337\217\t\323\273"
+	.ascii	"q\352\373\235\327\027$\275\371\345\263\357\007\3043'\347\336"
+	.ascii	"\n\222\304Wy\273$\035\225\244\235\235\333\255\013\005\361\215"
+	.ascii	"\326G\272\275\353Xs\213\020\026\334=\235tNN\304\364\303[\360"
+	.ascii	"\341_\300\366\f+x\346d\336\303\3310[\354I\251T\232\300\234\334"
+	.ascii	"\373)I>\0258\351\367oI\300\016\360\224J\245\t\335\362\267\275"
+	.ascii	"[R\220\273H\267\234\234&\t\223\204n\267\"\252\024|\005\337M+"
+	.ascii	"\005\377\362\334#\224:\273\321\272\241\366\246\307wr[i\031\242"
+	.ascii	"C@L\360N}\036f\032\254R\311\324B\327u\3771\361+\273\340N\375"
+	.ascii	"\256\322T\222\207'\360\224Je\3570'\253\311\253\367\0167\225\376"
+	.ascii	"\360\334\203\223\342\274\357\344\b\314,h}\236H\244\233T\364\347"
+	.ascii	"x\236\034?\301\273\360g?A\264\257\375\201\033\301\377Y\263\340"
+	.ascii	"\206g\004\004\b\3759\276\365\371\021\315\251\266\234$\246_Y\202"
+	.ascii	"gf\031jS\261Y\302<)\225J\024~\272\023(\301\267\225\006\001\266"
+	.ascii	"\327&\275\371\345\237`e\247j\201\223\321\316\360|>\274\223\273"
+	.ascii	"\335\300\250U7\275\020\244\333\362|\313\224r\030\301\267< \364"
+	.ascii	"#\371\b\276\345\032\006')\277\034+\323\257\354y\215b\357\252"
+	.ascii	"\002\b\236\037\355\323l\23086\315\246\333\255\247\355\004\346"
+	.ascii	"\360+\033\037\202\357\001\360\330\360\360\3361\276\277\355!I"
+	.ascii	"\033\305\236\021\005(x\313\273\374\330\004\271\264|\243u\002"
+	.ascii	"\234\212\224\365\025U\331\004\316\344\255\220\370\240J\360N\356"
+	.ascii	"F\272\255\320\267A\320+Q\311c*\002\026N\374\342\017\233\"\234"
+	.ascii	"_r\353\343\213\337-\321\023\237\350\024\345\327\264~\326\324"
+	.ascii	"\024\b\276\272\025\372\017\203\n\022}\353a\361\361\354\233\336"
+	.ascii	"Tz\363\313VH\220J\243\320\003\224\032\337\311!\234@\247Z\376"
+	.ascii	"\253_'l\326\";\366\277t\215\226\357>\321\211\210\213\003\375"
+	.ascii	"(ji\307\276eB\235\256\354\330\273\334A]Y!SG\212\357d\030'lS."
+	.ascii	"7\322\225`\315J\313\212\375+\237\207y\004o\237\331F\311&\210"
+	.ascii	"\367\016\227\270\371%\277\362\333wq\202\272#\276\263\307\232"
+	.ascii	"\222\270/\244\221.+\366mX\224\2730\271\033\247\376\016\331^\013"
+	.ascii	"\343\276\3267Z\2670\205\345\3358\225\273a\\\366_\353\331\233"
+	.ascii	"DL\2772\277\326o!\271\213\260M\223\215\323{\247[n\033\247\333"
+	.ascii	"-\373I-\264,\242\034~u\207x\264\261\357\344\t\270\3771as7NeV"
+	.ascii	"\354\377?4\237\256 @\331Dy\357\260b\357O=$\351\315/\331\255\335"
+	.ascii	"h-\303\332\223\302\277\245W\231\277\230\337\204\311\375\272\205"
+	.ascii	"\274\223\231\277\331\334b\351U\356v\311\342\322\321\316w^\361"
+	.ascii	"'\241\036=\341RR\305oe\250\004\304\310S\361\033\351B$<#\312\245"
+	.ascii	"/\302/\205e\357\t\227\022(~\"\201s_C\370\235\374\246\324\277"
+	.ascii	"o\342\027\322x\305'\245\353\224\326\204\253P\271\364K\374A\272"
+	.ascii	"\212\234\021\345\022\022\177\222\024\016\b\277\321\234\203P\n"
+	.ascii	"\031\026\376\375\340'\342\276\017\272[J\342\222\023\342\037\342"
+	.ascii	">\026\242Dq\377\303\017\324pTF\224K=\370{\270\217\205(Sx\370"
+	.ascii	"wp\037\013iDo:\370u\270o\20597)\217\303\237\023\205\030\207\367"
+	.ascii	"9\370\231l\3234#W~%\024\342\2232\013{\365\311\227!;\325\211\021"
+	.ascii	"\036\026v\302\264\026 \205\202\354\203\215Fxh\344\217\035\220"
+	.ascii	"\373>\256J\322Q\233\361\261\367=[\262\360\364\330\367\232\020"
+	.ascii	"\245\356\330\361\264Z\370\236Ta\267k\254\250/.%\312%:\366:*R"
+	.ascii	"r\354s\334\367B\032\021\035\034{\334\334\265j\304\215\375-\252"
+	.ascii	"\254^\215(\227\240\354"
+	.string	"R\270\357\261,\301Aag[Cr\343R\242\306\376\204\373\212Nzii\244\303\b\032{\032\367-\200\320\r\355\311n\306}\354\225B02\3662\356K\341\312B\030\273\030\367}\234\222\244#\025\276\330\301N\230\"\355b_\302\202\253P\213}\213\373bH\013"
+	.ascii	"\026\273\022\356\203\301\352\026\002\022\366+\356\203a\252\342"
+	.ascii	"\b{\225\007]\322)v\252\023-[nQ\354E\270\257\310A\343\020\265"
+	.ascii	"\236p)Q.=\261Cq\237\fP\"c#\335n\2070s\037[\345J:R*\227\235\304"
+	.ascii	"5\314}\276\243T*\225J\024\335\376\325\267HMGJ=\267r\377#\371"
+	.ascii	"\037kZs\370\225Q\370W=\263\r\225\315\021\357\235\376.\353v:Y"
+	.ascii	"3b\370w\363K\346/\246\277\223\271Y\245R\251\344\027\302\354;"
+	.ascii	"\315\304(\"\234\211k\255\327L,{\235\211B<\247\331\275\342:\232"
+	.ascii	"]=<g6\273w\256lv\245M\330\354\226\265a\263;\326Y\232[\245\266"
+	.ascii	"6\267G\375ln\211\372\254\271\365\321d\315\255P\3335\267>\035"
+	.ascii	"mny\372\256\231\315\322~\315\354\340;\263nmM\326\314\2625Y3\253"
+	.ascii	"\326d\315\354X\2235\263b\357\314\"\351\301f\266\352\235\337\332"
+	.ascii	"d\315_}\347\2476Y\363\033\276\363\243\211p\37637j~\263w\376\261"
+	.ascii	"\327\371\305^\347\017s\243\346g\362:\377\327\353\374Z\257\363"
+	.ascii	"+\351%\335\177\325b\315\217\244\231t\177\025;\377\216\3574\277"
+	.ascii	"\2163\233_\207+\233\277\331Y\232?\247\007\233\037\247\375\232"
+	.ascii	"\377\246\357\232\237\331v\315\237\243\311\232\177\331d\315\257"
+	.ascii	"|g\277\232pv\353;{\365\235=\313;\373\341;;\365\235\335\360\235"
+	.ascii	"\275\320\204\263\023\276\263cy\235}\372:\373\340\353\354\202"
+	.ascii	"\257\263\007\276\316\016\370:\373\337\321\331\375:p\366\276\327"
+	.ascii	"\331\371^g\277\362:\373\336\353\354z\257\263\347\035\235\035"
+	.ascii	"\357\204\263\337\211pv+\"\234\335\356u\366*\257\263Sy\235\275"
+	.ascii	"\356\235\235\356\235]\372\316>wtv\271\327\331\243\357\354q\257"
+	.ascii	"\263\303\275\316>\345\350\354o\257\263\273\035\235\275\355uv"
+	.ascii	")\257\263C\337\331\243\274\316\316\366:;\224\327\331\327^g\177"
+	.ascii	"\362:\273\332\353\354N\336\331\323^gG{g?{g7{\235\375\371\316"
+	.ascii	"\336\344\235\275\354\235\235\354\350\354c\257\263\213\275\316"
+	.ascii	"\036\366\316\316\344\350\354`Gg\377zg\367z\235}\311\353\354]"
+	.ascii	"Gg\347::\373\326\321\331\265^g\3172\341\354J^g\307zgO\362:\373"
+	.ascii	"\325;;\222\243\263[\275\263W\035\235\375\310;\273\221\243\263"
+	.ascii	"S\211p\366\251\327\331\245^g/rt\366\250wv\"\357\354PGg\177zg"
+	.ascii	"w\022\341\354C\336\331\235\"\234]\310\353\354M\257\2633\275\316"
+	.ascii	"\036\344u\366\245\327\331\225^gOzgGz\235\375\350\235\335\350"
+	.ascii	"\350\354@\336\331\213\216\316N\364\316\376\343uv\037\257\263"
+	.ascii	"\017\275\316.d\302\331\203^g\377y\235\335\347u\366\236\327\331"
+	.ascii	"{\274\316\316\343u\366\035\257\263\363\274\316\276\363:\273\316"
+	.ascii	"\213\263\353x\235\275\371\342\3549\257\263\343\2748\373\315\353"
+	.ascii	"\354\314\027g\317\361:\373\362\305\331\225\257s__\234\333\372"
+	.ascii	":w\365\305\271\263\274\316}\370\342\334\324\327\271\r_\234\273"
+	.ascii	"\360\350\334\204/\316\215\345u\356\351\213s\017\276\316-\370"
+	.ascii	"\342\334\201G\347\006|q\356\277\243s\373\2758w\337\321\271\371"
+	.ascii	"^\234\373\312\353\334{/\316\255\367:w\336\213s\343\275\316}\367"
+	.ascii	"\342\334V^\347\016\325\267iXK\216\217\350\364\033\256\2059\370"
+	.ascii	".\b\213\004\307Z\226@\306\004\277\241\326\300\247i\202%\0130"
+	.ascii	"\213\315R\204\342!5\t\360\233\215\360\357i\232L\263\374\2466"
+	.ascii	"\313\025O!\024\007\005\231\322\374\276\333\376\372\236\246\311"
+	.ascii	"\240!\3373#\313\212}6K\021\360@(\362\025\257\f\341\373\206\346"
+	.ascii	"]y\027\203{\317\342\035\021\342\3367a\025\275w\301\227wV\254"
+	.ascii	"\233\312\373f\233\303{\027wEwi\305h\325\335\024+\357\242\212"
+	.ascii	"\235Z\321-Ir\215\204\335w\033\264\312\273\210\276QY+\262i\331"
+	.ascii	"Q\371\356zR\3674M\242\200t\317\214d+\246!i\226\320}\263\231I"
+	.ascii	"\237\246I\233\006\"\230\233{g\232\222\2016\f\310\311}\3531] "
+	.ascii	"\n-\212\221%\327HD\277\347\300\342\336E\224\"\270gF\266\025\275"
+	.ascii	"l\226f\3115\022p\337\202\\S\236\246\211\232\005\336\336\336\231"
+	.ascii	"\270\2447\277\254\300;\231\365\230\262\334\236\031\371VTB\363"
+	.ascii	"d\314\355\033Z\274j{\232&i\024\220\"\345[\217\351\n\nW\254\222"
+	.ascii	"2\205~\257QEy\027hol\317\214\214\026\245l\226S\330\276\267\210"
+	.ascii	"@y\034M\320\234)\311\214\tim\2568D\216]\373Fjz\362.\310\336\324"
+	.ascii	"\350\212A\352Z;\265\357\256$'\357\202\254(\215J\361\310\n4\355"
+	.ascii	"\373\255\b\355]\214\275\235\331\025\177\350%\327`\316\276\241"
+	.ascii	"E!\263w\361|f\344]\021\bI\323\367\374\336Z*\3664y\027boeyE\036"
+	.ascii	"4\201\3115\030\266Z\366mU\334!{\034M\304\256\326\352\224Fq=\224"
+	.ascii	".\275:\201\261\275b\016\016\3137\366\254\341\265M\214\257\230"
+	.ascii	"\243\270L\023\373\366\355\n\r\363#Zm\226\031T\333\260o\363\256"
+	.ascii	"lL\236\031\tH\244\332,30l\241L\276\245\273\256]\275^\251Q\\\273"
+	.ascii	"$\320`\317\214\024\034\004\373\026\254 \247I\243\253\220\224"
+	.ascii	"\371\313\353\217\224\031\201\257gF\022\022\377\224\320\257\357"
+	.ascii	"7>\257\247\361\222\313ZbH\334\323s\371\226\274kh%\354zf\344!"
+	.ascii	"\361\316J\327\273\200\326)\3273#\253D*uQ\256w\363\254\202[sr"
+	.ascii	"\320\255w\351\254\200Z\317\214\274\022\341\220S\264\236Hg\235"
+	.ascii	"\313zf\232%\261\r)\305.\353]@k\024\002\357d6\255[\211\022\270"
+	.ascii	"\007`=3\r\223\b\005\t\004\305\372~SK\3624^P\007\\]A\033\200\004"
+	.ascii	"\207\210v\206d\315\252IlRf\3455\303;\271\253\252\276\363\254"
+	.ascii	"]\322\033\006\034\321!\206%\271\321#\337p_F\276\005'ET<\304%"
+	.ascii	"L\3115\022U\252o\266\255\251\247\361J3\224\342A\314R\022\225"
+	.ascii	"zb\236\365\252\3103\323\364\020\257l\226H\252E\236\370\264Z\311"
+	.ascii	"\360N&6\273\243>&L.\352;\317z\304z$\275\371\245\265\210\310\017"
+	.ascii	"q\252H\224\310\367V\024\324\2670VD\364\364\3144AD(\233\345\013"
+	.ascii	"\326\030I\256\301\264|O\337^K\304!N\217\303K\314\220h\210(\304"
+	.ascii	"f\231A\223\363{\310w\323\352|\027\314\372\323\326(\016\2571\320"
+	.ascii	"\374x\036\032J\231\013\020RDTJ\022\362\356\332\241`\3233\323"
+	.ascii	"\030\021\215l\230@\240L\337M\337M+\323\273t\207\200A\236\231"
+	.ascii	"\006\211\370\303f\351#\310\023\351\016\347\226\224\210AD \021"
+	.ascii	"\321\245\027\221w\030U\nB\354!\366\030Szw\355\020.\251\211\310"
+	.ascii	"\2034A\334Iz\027\354\360\r\006\244\217\t\223CjS\300\3213\323"
+	.ascii	"8\2118H\017\21074V&\210L\342\321\023\337\016\331^02Zs\001\304"
+	.ascii	"\311\275\"MX\201\274\373v\330\225\200.\372\230\242\357\274C\004"
+	.ascii	"\020=3\r\224K5$B\211\236Hw\310\022\251\342s\200\376\3611?\276"
+	.ascii	"\363\016\257|<3M\224;\265Y\016\n\216\371xw\355\320jH\312\375"
+	.ascii	"\363\353C\362=t\264kZ\205\236E\362\354\035\364-\364\356\264i"
+	.ascii	"\rz\021`\207J@\317LC\345\352!O\320\034q\363h\2542"
+	.ascii	"h\271\\<\240w\351\016\177\374<3\315\225k\207\204\301\243\342"
+	.ascii	"V\241\301\312\242\331\332r\177\336}\036\016\371t\271\3229\237"
+	.ascii	"#\330a\220G1@\3173\323x\271q4a.\\\033\355\361\335\363\335\264"
+	.ascii	"\366\3706\217z\310\343\231i\300\\7\232\260\016\360\332\334\266"
+	.ascii	"\035\337<\276\233\326\035\206<cn\024d\006P\\6\232\262'\315\331"
+	.ascii	"Y\032\317\033\2250\250\271\205\013o\336;\317L\243F\263\346:\351"
+	.ascii	"\235'aI\\\026\221O\243\240\316I\013\240\303\346\242\235\351\274"
+	.ascii	"\351\200\272M\312\246:\236\bFmk\266\271bai\315w\337\250\320\234"
+	.ascii	"g\246ys\277\220'\226\270^4pQ\232\2719\267\333\226/\3475\244\262"
+	.ascii	"\361hnA\200\306\241s\267\264Z;\234o\001\251[7T\\\254$7\357\322"
+	.ascii	"Q\263\230\317Lc\347Z\331,M<\271G\334*\232;\232<\232=\232=\267"
+	.ascii	"\231oT\254\235\346\026-h\370\250F\235\343\231i\374\\)\244\221"
+	.ascii	"9hDJ\221\250\034\357\202Q\213z\t\350>\025\201:\rQ~/\277\233\326"
+	.ascii	"V\276\013F\375a#\3506=Ea\n2M\276M\362]0\352P\315\324MB\032\231"
+	.ascii	"\203B\330\220\216\306j\336]\243\006\321<3\r\241[T3dd\016.A!\372"
+	.ascii	"\321V\221O\363\335\264\"\337}R\177f\f]\241,kA@\323\231'\202\021"
+	.ascii	"^e\236\231\346\320\355A\032\231~O\230\223=\334\0364\325\366\r"
+	.ascii	"b\347\356py\320\\\2275L\034\267[\342\230\314\367\224\207\357"
+	.ascii	"\341\211Ns\204-L\3200.\017\377a~<|\347\021N\237\032\005! \013"
+	.ascii	";4\335f\215NK\223_\221\270\034\034\273\235@\255\032\0365=\336"
+	.ascii	";;\274\013H\330\246\303\217\233\343\t\316]\272J\267\212\343u"
+	.ascii	"\300\361\304'!\364FP[\255\031ji\362\0232%\313a\314\337\210\371"
+	.ascii	"\366\215\220\355\003?\332B\277\2457B,\321\034\376\0039|\233G"
+	.ascii	"\270f\243\250\025\314\342\026\bX\343m|\327\360\242\361\3145F"
+	.ascii	"m\237\r\263\245\251\257\260\21599\244\345\253Ab_\202d9\323i\367"
+	.ascii	"\332+5JAj\232\234\356\rO\343[\250\007\036\207o\276\2465\307\r"
+	.ascii	"\337\256\021vIo~\331&\347d\205w2\261a\\\017\374\207\365\371y"
+	.ascii	"\340;\217\360J\205\bZ\007\367\221\374\207\365y\205\351\335\020"
+	.ascii	"\032I\007\360N6R\005\300V}K\244\235*\372q\236\007\347g|\367\205"
+	.ascii	"\331\3603\272\2103\327@\325Dy\357\330\360=m\366p\211\371"
+	.string	"K9\353\035_\n8\317V}\210\273\270\262\032\006[*\254\006\323\322\265u5RT5G\216\270\335~u'p\210\323\360\3145W5X\336;5\310x\032\236MkZe|O;\004\030aP\224\261(;\001\304\310j\2436L\022pm\\\315VW\215\227\227\333m\303\370\030.m\343\345v\340a\274\233\226S\305\354\300\273oX\b\217\332\325\260\226\f\377Px\001\326\266\325\204I\341\300\277\340\300\267`\202\206\033\030k\331j\312\240\264c\032\370\rh\340\3335A\302\f<[\265\2323'\030\370\f`\340[0\301\351\005\322\332\263\0325\230gkV\263\306V\003\205\272\335\262S\013\374\005\276-\360-\230\240`Q\243\020\004\224\236P\201\266\226llZ\201w\301\004\333(\360\3262\001\243\300\273OA\350\004\236\271\006\256]b\2634\201\327r\265]5\321\232\271\032\272\032:\267\333v\002OA6\037\315-L\220"
+	.string	"\2256+\212\365%\200\025\001\b\374[\253\017\201oA\277\352{\236`\326\003\354Z$\311)O\375\007\264U\016`\247\335\200\177\352\033~\003\276\003\273\305\251,m\256i}\303\367<\301+\246\356\247\240\025\213\232\273\244Q\236\340\017)\263\204\031\362\332)\351\f\357\032E1\340U\250\362&\303^\013UE\304\230\f\357\016\r\211\241J"
+	.string	"\026\260\200+\t041\351\361\301\360}UR\200\334\b/\274@\b"
+	.string	"\027\355\221\321\337\324\305\273?D\t\2103\\\201"
+	.string	"\004"
+	.string	"\212p\200!$\013<\303V\b\013\321\356"
+	.string	"\337\325\037\003\264e\205\340\202\013\357\317@8\351\315/A(@\273\243\355\201d\361D\330\362Hf\251\251\206\340\315P\267[b\264"
+	.ascii	"\337\207\255\016\001\276\221p"
+	.string	"A\275\307GTE\213o\246\026\357\317@h\013\317\\\303\327\346\330,sTw\002[\370\026l\231,\274\nQ\336V\360k\2279i+|\267-\335\374\322\252\302\253\020\245\210\b\220\3152\266\0238\200w\327\002\275Rx\346\032A\326\020YT*\225&\354\250\251z\300\272}\n\357\216\021\n\340\033\255\333\t\212\210\332\fuQx\326\355;g\220\351Wf\333\036\205o\300nq*{\0226\255m\337h\375!/pKz\363\313\024\357\344\226)\037\260\203\337\352y\240\242\377\346y\372o\276\255 \260r\214\241\270yv\360-pz\252\235\200\205\025D\226\2007e\003\201j\252!\270|;\201'|\317-\335\374\322\317\204\357\277n\221p\245e\375\004PA\006?\340C\256\270B\364\307U\346\001\333\353\345\021Q\271\310:`\361%\334!\273\n\236\225\216\303c\361]\245\n\222\305\023!K\205\250\246\032B\t\317\002\212."
+	.string	"\337H\270\310\330\336\363\002\177Ho~)\207\\\021\365 \220K\354\004\253\366pS:\313\326\265\345\232\256L\220\360#|3\205\345\201\300\272!\333\256\255\243$|\333\345A\341\020X(\222\005s\215!\033\245\346\220e\263I\252\251\206\360\202\333\355\b\317\"\017\n\373\204]{\201\273\b\327\\\223\313\245\333-"
+	.ascii	"\276\221l]\263\210\324\336\363\374\016\2457\277\344\240\245\031"
+	.ascii	"\352\256\370\2300\271\025\206\201\204\033\210\360\314I&{\206"
+	.ascii	"$\006\315=\231=\3354\021\336}\363\203\206\200\303\222!\211As"
+	.ascii	"B\306\304\246!\274\013\346\307\006\002\330\327\334\222\327\222"
+	.ascii	"6\r\204o\337\374\326Tl!M<5Y\255d\0231H.K\226\022\025^"
+	.string	")t\330\253B$Vm4\305\267y~](\2369\311\303\032A\022\203\344\006\375\230m\246X\252$\217\366\245\253\362|J\261S\311\236\237d\320\220\333\355\361\256\313o'\320\275\312vh\360\r\343\242\370\226)'\210\"l\203\b=\304\254\350!\306\002\266A\204\0336v\210\221qc\005\016\033j\230\201\003\r6\210p\003G\r\0314p\334\320\301\0031^\220`\033D\270!#\206\r\032\033\200\021\263\002\006\r/2bt\300\361\242F\r3n\264\330\200\243\206\0322ppe\320x!C\214\230\0276:\320\022\343\205\030\0311:\340\200\361\202\006\035j\274\240!\001\216\030\036#c\006\r3p\324\220\021c\206K\r3h\250a\303\005\03416rp\301!\343\006\030/f\250\361\302\r\03416f\250\241\306\214\0323^\320\220\021s\214Q\343\005\r\0326`\020i\240\301\206\214\033^@@\346\005\017/j\350\340"
+	.ascii	"\0318t\340\305\215\0311^\032:\310 \003\307\213\030\"\r\0335d"
+	.ascii	"\030@\006\216\0271-=\330\350\300\317h\0314^\304\320\320\342\250"
+	.ascii	"\241\203\r\027p\220Q\243\306\013\033`@\200\343F\214\tz\220\021"
+	.ascii	"\243\306\0132p\230A\203\215\230\031`\304\334\230@\206\0168\274"
+	.ascii	"\330\241\22513\343\001/p\274\210Q\204\021s\343gx@\f1h\300p\031"
+	.ascii	"\206\b9\334\240\261B\006\214\0274\304\310\300Qc\306\212\0323"
+	.ascii	"^\320X\001#\346\306\n\021F\260\215\034d\304\254\300a\303F\314"
+	.ascii	"\212\257"
+	.ascii	"\034/\204\273\254\213\200J[M5\t\272m\334\226\353\026\351t\256"
+	.ascii	"\251\366\301\246m\334\337\371\235\367g^\257\327\235\016R\001"
+	.ascii	"\246\036\256^^\016\363\304\224\301\351\222\336x\t!\336$\323l"
+	.ascii	"\352\n\364\226lIs\226\254:\326\357\300%XG\226(e`\350\002^\304"
+	.ascii	"\203\f\362C\312\3441\244\304a\236~d\202\226\004A\300lf\236\311"
+	.ascii	"q\0376V0xDN\256\205IU\232,\357\325w\201\362\363Cb\315\004\321"
+	.ascii	"|\310\f\271W\332\263\374\243\231\275gyO\352\226!P~sf\357[\201"
+	.ascii	"V.3\317\354p 6V!\222N\262(\031\314\341\327#$\356\207_$c\204\203"
+	.ascii	"\037\276\013T\037a\033\201h\244\373L\276\275!\304\n\223;\342"
+	.ascii	"?\366\216\344@d\224H\340\311\004\221i"
+	.string	":jvk)\347\227\f\302\360\177\214\311\273\341;R\2674=\373\356\230\274\037\265\005\201[@\336\332\te\234\204\337\201[l?\325)\266\326\212\260<\263\214\223O\337\261|\247M\337\353\266\260\334\312\326\025\321\006\334\347\243\334\201\374G&\252(#%C\265U\304m\263t\231e\216h\300\211]\341\340\240\325\340\220\340\325\217\t\376C\331\n\n\304\232\006\3763\331\372\001\314\262\003|\017\324\272\376=\263\314\226\377 \247\177\377L\264\252~\317,\323\345?\316\347\367\376\323\037\250Z\207\322(\255\251\364\307;9\002Z=D\214\362D\255\0262\212\365\353<\317\332\277\316;O\273T\205\305Q@\\{\337\321\0165\326>\336\371\201\373:O\214\362M$O\357\256\357\212\261\212\215\225\007^F*2e&\214t\306:\031\2603\327\371\336\373\276\233V\276w\236~\365\264\340z(\311+h\206sU4\033\2432c\336;\f"
+	.ascii	"c\234L\231\314S\346\214e\322d\324\320\272w\260A\215\030\376\345"
+	.ascii	"4\267\020z'\207\020\204\325\327@.\336\037\331\260\234\264\217"
+	.ascii	"{\367\257\343y^\307wU\230\336\265\221\356\353x\027\357\375\246"
+	.ascii	"%\360\204#\314I\342\257-\271\257\016\272\262ft\263\273\362n "
+	.ascii	"\026\326\036"
+	.string	"\233\021\272\367.\025\353J\017j\204\242\367\256\031\226U\3363\313\264\031\325\220y\357\232a\035\301{3\242\331,\361\276\255\303R\2023>e\242\306&1Cd\346`\360\216:q\204;\2019\004\360\\\362h\240\027\256{\345[\261\276\250\036\367\273g\226\241\"c\347\275\343^yW\357\375\356/x\306\2515\255\256\336\273N\203\bLrUa\032\310\324?V\336\275{\3473\206\365#y\267\362#\362\340\356\332\347\003\327\355\276\231\210\375\201\373H\336\355\336oZ\206'\\Y\016\024/\"I\336\244=\357\344\026 \315\303\2252\251\350o\026\233\357\313\234$N\272G\363]\351\177\200z\273\346$U\221\3713~!;\220\2713z\311\344\221x\3222.\251\362\276\354wJ\2225fC\243\2225\017*\317,\263g\334B\302\030\265\250$\301jn\261\243\216\317\210eD-\311\025\335{\335\273\323\027\351;\335\303\214\345h\315"
+	.string	"\025\276K\277\321\332\217\322r\222\332\276\353{\341\273X\230~\345\n\314|\356\375\352r\357sO\2046\255r/\242.I\3213\313\370\031\247\220\306\301+E\2340\317\220\031\245d"
+	.string	"\335\027\272)O\2271\312XDFPf*C(c\350v\353N\243\337\200Kp\357qO\204r\233k\236w\302\270\016\367/v%\n\356[/IP\247H\362#]zug\312\241q\210\223o\312\273T\253\303\267g\226\251\032\231\202\020\247o/\202\211\225\241\3333\313\\\215IH$w{\242\231\025\3413\317,\215@l\226Em\357\006ZM\2450\215>\206\\>)\357R\255\004\2418F \244\211'\243\217\361g\246\2513\303\303\343v\353B\217S\254"
+	.ascii	"\317t\336\311l\005\325\021%\312\267\236UV\223\215\207\221g\207"
+	.ascii	"\217\355\211T\253\037Pz\214Mc\316\030\224'B\261\032Z\37312\215"
+	.ascii	"9\210\325\265\027af\025\364$\310\345j\205>yb\235\325\217\332"
+	.ascii	"\220\313!U\355\335\272\252\253\223\037.\204X\210N\236\b\245\352"
+	.ascii	"0\307E\257=-\215\020\007\255\310%\020\020\355]\275\252\2769;"
+	.ascii	"{\257\372c\276\223\271j\212\364\346\227Un\322\233_V\265\345x"
+	.ascii	"\247\231\331\267^\325V/\237F.xwM\336\237OL+{o\362\027\360\345"
+	.ascii	"h1\375\312=\020\221\275\227\375\013_N\322\330;\331w\323:\366"
+	.ascii	"\304\272*,1$\227:$\t:\342\230\330\023\241T]\205)\271\310!ID="
+	.ascii	"\354](UV\255d\302\344[\257\352\210\364\346\2276`A\\\336\334\300"
+	.ascii	"\276\r\254B\372jr\201\332,IDi\355\276\276\r\2542\222\336\374"
+	.ascii	"2\351^\037\343\365\255WU\264\304\351\362D-m\311\267S\252~t=\363"
+	.ascii	"\214\223\013\032\362\254\353]&UC\\P.M\312\370\270\236\245V\005"
+	.ascii	"mE\271\210\205\261[\317\326U\375h=\363\214\224\313\227\315\322"
+	.ascii	"K\353Y*\3255\213\312\205\013\t\363\244\345\2625s\304j\346\352"
+	.ascii	"\312\355\266\235f1\241\252&inQ\243\344\231g\260\\\260l\260L$"
+	.ascii	"\351j\307zW\362\335\214\302\364\253c=\321\214J\220&\311\307\204"
+	.ascii	"\311%\371\326\243\002\364\253g\236\311r\251Bf\200\347b\304\345"
+	.ascii	"\310\314\326L\327\214\327\214W\232_M\241z\263j$\230\213T\021"
+	.ascii	">\253w$V\337R\251\274\252\302\\\240\236\252G\336\253\216\274"
+	.ascii	"kF\325\365\3143c.\316\2319\023OM.Bf\312\2363gg\256S\275\033\371"
+	.ascii	"nZ\251\336eB\265e\244\035\312\341\227\341\337\314\233\373\224"
+	.ascii	"\332\314\332\324\373\024Uz3\3036e"
+	.string	"(\325)\246\b\245K\257\312H=R\213a{\221w\251\357\246\220\213\321\f\264\310S\340,.\213(\252\315\245\310f9\001\221\335N`\324\177\340\324\034\2217\227!\241 \256\322\fu\035\352\235\310\267\321\234\252\247w\250\357\246\365)\352\004\347\322\323\203\307\220w\247!p\316g\236\211\272\354\314\314\275x3t.:3T&\300\323\361cB\336\235\337M\253\013\371\2072\365\326\364\3143v.8\310\t\360\\\230.733y33{n\267^mz\237\222\"\275\371e\017L\317\257\345\242\fl\244\353A\336\231\276\253A\036\206(o<\274\363\017\033\306u\245\367\245\357\246P\241\322\307\234\251\355\340I\037\223\364\2557\325uE\360\211\016\216\364\3143~9\357H\337\242$\254im\361\343\2331\3740'-\374\3031\302\214\237M\020\302\033\357d\236\001t\275(\300\216k\223\212!\n\371\276vKU\230\336\321\023\205"
+	.string	"\036}\013\231\021:\231\263Je\317L]\346\031\302\031C\263\250\017\274\223A\200\022]b\243U\372#\024\270\276\032\377\325\237\363<\3340\334\366\350\333\2336\254\034\336\311\254\364\255YT\233\r7\372f\n\323s\243w\263\250\243\357k\203\320\213\332\222v\243\265\013\0248#\206\177K\257\326"
+	.ascii	"\222\207\347E\357@\336\2056\255L\334-{w\354\231g\2523W\357\035"
+	.ascii	"/z\267\316)*\305\371e#\241\352\321 zf\344\262\305\316f\tB\025"
+	.ascii	"'z\267\316\311o\254\376p\360\037\337L?\336\315\234\330|\274["
+	.ascii	"\346\343\331)NkC\357\216\275W\233V\037z\326\314\311\313\205\236"
+	.ascii	"\031\311l\221Cv\320\022\327\022E\342 \233H\035\244\216\3207\265"
+	.ascii	"_\252S\227\364\346\006\033,\327\203x<\350[\317i\313\327:\205"
+	.ascii	"\023\226\007\234\222x$\215\234\220\244\314_\316"
+	.ascii	"P\242\367\363\257\004\372\3638\236v\206\217\244S8\r\331\340\363"
+	.ascii	"l\r\343z\317\273\317wS\350\t\262\247\347c\236s\355\221\334M\r"
+	.ascii	"a=\376\303\234\364\370\035\236sY\205\235b\b\rXN\304k\206\272"
+	.ascii	"\314\310 \344\220\367\016\177\300Z*\374\273\371\245\f$\256\242"
+	.ascii	"\231\221EHA\351M\f1\036\377bO\036\277\3033.k\332)\206\314\301"
+	.ascii	"8\342\314H%d\220!R\244\314_6%\215\206@\245\314\016\274\363\273"
+	.string	"\372\277\212\201\317\325\276\343\377\253e\314w\374\016\317(\206\207\235b\310\232t\351\325\027<\317\214t\266\204![\2308\317\273L\206l\371\3163#\235Z\274\220&\360Z\272Z\226 \241\220QH)\244\224\333\255\233\266\363\356\224!Y:\317\214\244j\321B\266d\331\351\004\016\301\2126\267\340\200\353h\271r\035O\302\263l\003\315gF\036i\261B\"\003\233\337kFr\376\2051\034\253\226),8Q7\377\302\2303\257Z\240\220\324\2523\277\005\207x\216\177A\314\227X-B\220\326\252/\277\005\203\270\362_\020\273f\265(\345\270\036Y\337\305\265\272\325\002$\307\256\372\035\375\221\345]\\\213\016\273Z\206v\354\016\277\243@\324wa}3\364j\361\351\0215\374\206k\341Q\370.\254E\204`-<@\3115\022\204\337k-:\260\274\213\211\322\250\324C\025\213\013\013\244b\226g\235RffD\006\003\202\002\343\030"
+	.string	"\f\005\362D\022\305\026\366\024\200\032S\222RTZ.\220\316c\211\b\247a\346Q\t\b\n"
+	.string	"P"
+	.string	"\277\341c\243\213\2036\311\215\304\317\215\1775v\267\323}c\210\324\373e\317\200=\341.M\223\330\254Y\240Hp\035\252\370\315\225v\024\256\261\347\bB\344&\262\364@\337\017KM2O\020\336\305\242h"
+	.ascii	"\"\203\357\200\021\254\320o\031\327O\215\250,`\2700\303\345S"
+	.ascii	"\377\007\363\353\034\3503\305\234\205\305Y\361\247n\030by\017"
+	.ascii	"\236\364\271\025c|\211\330\362t8\265Y\036\311\237\354r\277\323"
+	.ascii	"\205l\004\343\247\350\236X\361\354\320\234\370%$j\373\260w\343"
+	.ascii	"\227\267\367Nt\230\362\224\334\267\226\305\374\211\352J\225:"
+	.ascii	"\344\345P\314VZG@\225Iy\023V\021\331\247\212\347\304\364\364"
+	.ascii	"\202\034\nw\341\254p]\030\250r\243\036w\201\214\377Mo\377\223"
+	.ascii	"\317"
+	.string	"w\013\0051\230\307\254\244Z\256\037g\257\326<\250\346\2220\276\004\036\231\242\313\021y\202\220\355,p?\305D\016\212#\366\027e\220+t\246Dq\352{\344S4~m\254\271\0365\323\277X\377\033\024\034\266=\367\244\274\025\256\330\316\345\275\355,\265\237)\201D\032\226X\336\313\212\214X\201\254u{t]\2249N\027\372\203\343\256\321a\331\t\026\035\215\253G=F\304\003>1\\\340\301\273\265\235\t \233:\250.\266\3206h\2646-&\376bc\222\226\022cF\265\033\344\314w\3162\344\025\313;\355\201&\342:E,b\n\357\306q.m\332\253\220\342{\277\002\020\002\265\272\255G9\373\224\023m*\351\252\276\332/\370\206\267\016\344)\332\256\316\213\313{\036zT\216R$\353rh\330\311e\206\003!\032\020O\270\262w\264\036\025\306\013\212\204j^(\240R\256\216eY\350\276\363\354S\222+\025B,"
+	.ascii	"\201E\334\030\371\034@\301.\331\242\217#\036\336/i\026D\204\005"
+	.ascii	"J\002\275+\355\236/\207\261z\371\337n\263e\004\374S\335^'[\343"
+	.ascii	"\356\365E\344\n\274\034\030\242\304l\254\311\310\2651\3547\213"
+	.ascii	"/L4\032-\212\256\026\263\267&n\205\245:\261'V\3552H\371u-\217"
+	.ascii	"s\320\3514\n\021\252\202\206\rVn"
+	.string	"\305(\372\025\026\021P\277\320_\344&\t\252)\360e\270\020\177\360A\262y\347\350\"\001\232\264\2542|\204N\370\237z\226K]\371z\264\016\353\200\252\304c\007V\361\315\270\341\023W\354 \306\b\224X@\374X\211p*\001\250%s\177\242\370\357\306V\245\026u\005\251\263w_\264\242\262\250G\220\232\333\303\b1\347\004\213\206a\006\206\023\250ju\364\241\214\250w9\013b\362d\316o\206-\f\244*Ty\217\271x\021\223\240#\322\252\232 g\214'bvr(\317\001\370\247}N*3:\265\267\303+\fk\013\363\036!,\24302\376\001\215\177E\266$\213g\267\337:\225S\312z\026O\203\206\003w\225ok_f\235\031\205\t|\215\205\345\231G\333\302>=+\357m\322@\333\205s\004\373\271\240I\223\250)w\220\371\200\257\213\340+\0330\022C3\230\305gH\352\374$\325n^U\037\275\317aE"
+	.string	"w\360K\221t\004\263\334\013\373\266\313\241\345\226\327\270\235\3453J\236\031\3519\371\211%\037\201\213J\023\242\3258\346\r\242\020b\314d\343M\311\2014\250\254,"
+	.ascii	"\0330/\206\030+Y\265\257\266<\2700i\231\245x\230\321&\301\307"
+	.ascii	"&\0333d-#\023\351\311\331\236\034y\021\256\332\214\034<}}=D\033"
+	.ascii	"\324\262;\276\377B\021|\353\277:@Qm\276\264\207\257i\206\322"
+	.ascii	"fA\362W\250\207u\005u\200\304\256\rP\312C\224\250\354\342{\t"
+	.ascii	"\340\267\251\f\253'X\224\262*+\244\341\007Mr\352\020[\367\250"
+	.ascii	"]o\322\207;\\\177<\334\001QU\316\214\310\033\2639+2\351\241~"
+	.ascii	"\254\237\261\021y\217V,\223\023\3104\375\211nH\267m\201\250("
+	.ascii	"R\210\231e~\223\247\322n\331\351\364\260J}\341i\262C\265\362"
+	.ascii	"\271\334\200\332\350e5\336\370<#B\177\230HSC\377;\001\376G\325"
+	.ascii	"\034o\334\002\006\364\242\231\215\201#\232\275\007\201X\307y"
+	.ascii	"0\331.L\353\007\245\004\304\241H\347\001\265\220b\033\370\030"
+	.ascii	"wT\264-(zh\312\213\243\306\302q\335\273\355W\201+\022\361\341"
+	.ascii	"\224\036\244\003kvr\2728h#=V\b\320@\021 1\372\362\3634\004\256"
+	.ascii	"K\021\007\222U\314R\245_w\013\260C&I\254{)\232\200\224#\3332"
+	.ascii	"\243\371\177\331\220\241\352\257\003\375\332\222\273.P\036\373"
+	.ascii	"|\365\222J[`\331]\200%%\024\333\005{\037\002\371q\227\330A\275"
+	.ascii	"!\246$\002\203\032@HC\264\347\345\234y3\267\363bo\247\334`X\202"
+	.ascii	"\202\332>.=\351\274\312c'\363,\013\354\270:\205\272}\022\031"
+	.ascii	"q|\0051\217\251\227aD\257\255E\331;\374\r\204\204]}\n=\007Z\356"
+	.ascii	"\350\271\004\033W\207\200\252hz\355u\020\342\334\313\274\254"
+	.ascii	"\335d\216\316J\271T\210{\257\353a\272^fh(\307\370\267X\346\345"
+	.ascii	"\335\r\267\001\002\212\024\032\noH\237\331\363/\233\003\357\344"
+	.ascii	"(\020p\232\366\273~\237\372\3751IZ\245\236a\351\311\332\"`pl"
+	.ascii	"\315\017\216T\207\256t\357\356B_\023\316S] \221\205%\230<\bS"
+	.ascii	"\365\235\2667\377\355\256EI\203w\335\004\273\030=d\217qM\267"
+	.ascii	"\226\304@\266\270\351\347\277\367\370rq\013\031\240\246\350\201"
+	.ascii	"\366s+3\0256\270\352\201\326vY\t\321;8\266\240\031\362\332o\f"
+	.ascii	"1'\227\265\241\034\n\341-\326n`\035\305\376[AYjN\210\235\021"
+	.ascii	"\353\017\254\004\360\235\250\376\202\226%}%\234\020u\257\340"
+	.ascii	"\3127aYy&j\300J\341\303\003\200<\321^)\350\325\360x\033\323\267"
+	.ascii	"l\356(\364\316{\b<\275gvyy\215\310$\305a\320\006]B*\333\372Q"
+	.ascii	"\335\363\001\222@\223\276M(\307\3317\274\177\2760]o\373\f\204"
+	.ascii	"\t@\201\304m\b\024\255\"\242'\246\301\256"
+	.string	"\332W\0221\240U\004c\236\006\327\207\366\321q\276\366\204N7\214\233\251\302\317\353\225w\021hzD\206eAG\364At\210\232\"6\245\223\200\025k$P\241\214\261<\206\201\317{o\316I\032@\343Q($\300\352\324p@\340.\250Z\035>=\241S,1\006&a\205\312\001\320\334\333\256\262\207\217\272\251\025\327\365!\202\2674\001\317\236rUzJ\325\310\030\250\207\177\t\263;-\221\021\215j-\376"
+	.string	"\003pmu\031="
+	.string	"\235z\004.\t\246\362\337\273$\257v\261v\266\035m\3502Q\027:\035\322\334\347\020\204\\\306\326y>\006\267\240\212\263C\357\265\017\237'!k\373\363\331\371\277\236\270Z\372|\3463q\206\230\325\236rk\233\nsf\013\3175\216f\316v{%\215\376\222Ww#|\322\262\"\\\215\376\343\362}p\220.\360\331/\374Y\016\001D\274P"
+	.string	"\375\203V\325B\315z\273\275\204\356\032K\271\265\314\361|"
+	.string	"M|\254:\216t\267\032>\"\024\326I\353}\303\001\"\302\232s\337\327I\355\026\207\376\025qg\347y\313F\244`\201#g7]\260\341\211-`f(\031L\341g\312\330\001\316#\371\201\315$\277\227 \202\211Md\320Lm\331\205\262;\243\322\247\362TU;6c\016\310\"\231I7Jd\206\352\262W\217\027_x\262y\252\241l 6u\177\330\205\001\223\313{Wx\223hqy\221\2576D\004\334\270\036\330\207\343\343\263\2542\325]\3538`xk\036\\\262\271\227\316\007j*%\333\333m\f`\257BK\216!\224\244\307\305\226[\344\225\332d\257\373G\304I\3628\325$\335\232\r\1771\210\365`@\035\\q\214\316\313\215\217\262#\207\b\016\224j\025\n\034g\024\277W\223\317S\365X\036"
+	.string	"L\211\327\021\325\335\276u\371n\261\313\366V\302\351&>@\375\317n\234\002\013\023\212\353K\372\241\246\323ag\"\0215\250!\345\003b[\013\fA\320\225\257W\022\313\270s\331\350\243\241\001\"\315Q\020\302gy\005>\346\022\\A,K\2224R\\\022D\256A.\3523#\331t\243bP\213\200\203n\\\221\3448\257 \206\371\211\264E\004\001f)\354o0\211\250&\375\353F\256d\265@\275Q7\320\377\b\363\224\230\r\246\222n\344R?\312\320B\261\347`,\340\221]\224\315\345l\367\b\357\372_y\002\354\005\217\002fz\306\234:\271\235I\312\035\320\310e\351L\223h\353B@\334]Iw\351\334\006\325\306\367@\253\247\271\003\331\345l\252\233Z\377\0160\021H\223#\232\366iP\225\307\013W \371;\334\204)\251\333Z\031\035\030R"
+	.string	"\307\002\005&\3467\334p\357^\236\001s\034\311\021\225\004h\3470\331a\027\211 %\212S\261\027\325@vn\206\316\313\215p1\247|5\277\222\0362\260\301R\223\364\246u\213S&j\034\204\2310\334u\025 \211\254&\322$*\255\217\2523\f\210\356:\233\373L\320\211[\351\021\025\236\343\362\017\254\302s;\337\f.\263]\341E\\\r\326osj\206\264xQ\326:\024\230\210\367\376\022\277\276\332\001g98\036w\005\036\345\324\263A8&\221NE\315\0304\223PH"
+	.string	"\f\371\344%\351\261R\370M\027\320\2108\364\243\315\206o\237\375\370~1\n\031\n\232n\203\272\254=\254\225L\251\024b\177\345\022\025\376_\305\362\341*\352G\205\317\374\347"
+	.string	"\210\375\337\240\016\340mKZ\373\031\314}c/\277\003:\354UX2\320\246\330W\217H\204^Z\346`oc\210\323\333,S\0070\306\332\304\221S"
+	.ascii	"\256\006\250\266)\300\262\354\241\312\210\334\222U\373\325{e"
+	.ascii	"\036\271\330\312\353\272;[dD\243\245\267\256\007X5\247(0)SGh"
+	.ascii	"\356\270\273\207),*2\bI\b\356M\234+\221\rB\263\333\030\337^\261"
+	.ascii	"\341}\375\240\262\277%\2401\245I\261]\215\257\331\353\375+\226"
+	.ascii	"\246\224\225\222\"FT\002\324\221U\256\3610\214\005&\350\233U"
+	.ascii	"v\351_\037\225\376uu\342a\207\234\f\220C\200\004\210\303\251"
+	.ascii	"\005\274\334\033N\001\356\030\317kc\261\243\023~7\007\377\306"
+	.ascii	"eIM\307\220\376@\356\377Lw\212\017F\354\337}Z,*<\231Q,'\271\310"
+	.ascii	"\313y\240}\350\343.\210\344\224\fW\376\363\371\240\343\2407\t"
+	.ascii	"\221\007\221HuL\273\325UV\352#\343\335\375\221\277\r\350\343"
+	.ascii	"\345$\003\030\0178/$\017\007\2622\325P>\334\242\301b\243\277"
+	.ascii	"8){q)\272\232\216u\306V\027\231u\213\027\364%\351%Tmx8RL\264"
+	.ascii	"9V|\037\221\356\031cTf\341\255"
+	.string	"\032\212\270\274<\267&ZI\t\257\277^J_\315\251\274nw\021\021\003\3002\004(\377\017@\376x\262\202&\373X`i\362\221\231\335#\311\244\027B>|\330\210|BM\235\315TB\227\023`\004vTK\303\310\016\223\321.ft\353%\034\325\bM\225u#-.\t\0274*\272\356\201\343\252L\244\234U\256Z\036\016Z\311I\314&q\341\256\362>2\326\271\267]\231p\021\360\335\211\376\020\265\002\233In\246\212{&K\005s\251u\213f{\234ng\336\316\374\242\016\206S\243\213\022\353I\363\213\326\320S\205C>\346\221q4\245\037JZ\233f\225\245\306*E\025\241a\003\327B\241\373\203\217j\244\221s\2048\230\312\341i[\211\201@6_3\222\215\006\372\366\364\n\202\323t\250\363\223\213gwU\002\326\322\310\347iU\263\ta8A\235\230,%\005UU\315\304\212\016\322u&\240\376\357S<#"
+	.string	"\345{$\263\205\320$|\rF\020\234\004\006\n\354\320\245\262\255\200\371\261~\260q\371+\262'\255'=\273\231\003`\202\032g\205\317\036CN\3138\331\252g\276v\363wc\364eN\351?\242\002\356\267\334\030\376\2077\270\260\316\207\276\3206g\003\2679\272\227\330\264$\262\223\036\243\256\034P&'\006\372\245o\210E\0162\374F\265hN\361\256\206M\3632\323\367"
+	.ascii	"\327\371\227\254WuL\264\236\022\316B\371:q\271T\354\030/\004"
+	.ascii	"\214\\\311HI\325\335!\352/+\027\314\200\346j\034\301b\032\332"
+	.ascii	"#Bf\247;\274\306\037\362\352\034\332\320\316\370.y\364\033\365"
+	.ascii	"-T\027O\031Pv\321I'1\03374\326\330\235MG;;;\035\2033L+\027\252"
+	.ascii	"l\021(\t\256\275S;\005@\322\351i\032l@n\316Wh\352%x\337]\261"
+	.ascii	"\261=\246Q\301b\365\356\307\230\021\3026\267K\367\232(.\233H"
+	.ascii	"\360R\360\257\220o\203:\250\310&B \255^\304\366i'\033\306'v\205"
+	.ascii	")w=\023\317\r\317\327:\016\315\300\367\361\270\225\240\217\252"
+	.ascii	"/7\222*\363x\264\022M!i\371?V\373*\361\343\002\206^\340\200\247"
+	.ascii	"1,\033\341O\002\317U\213\311S\026\364\251\003\365\263\2161@\247"
+	.ascii	"\026\260\246\356y\036iZS\243$\210\270\bb\243\260\364\220\272"
+	.ascii	")\304\275\0210\267\f\033\325\364\025\324q2\310\372\205\322P\303"
+	.ascii	"\004o\377I.\330\374\373\334-\315WPfO\310\255\241\020\2519v\321"
+	.ascii	"\374\321\230@\b\227=\004\354\3318\345\302\321\235-(\022\343Z"
+	.ascii	"\264\372)\216T\233`\352\021\202J\362\025\371\201\353A\265\251"
+	.ascii	"\311\004\205\234\tLK\202\301=\304\213Q\354^\262\204\373\302W"
+	.ascii	"\252\244E\273\243t? \0079\253\227\370\370\376T\216za\240\254"
+	.ascii	"\365\340\264dO\005i5\221\01603\3419"
+	.ascii	"^\274V|JXn\353\324\347\314?X\363\371\336\"\307J\355\b\275\032"
+	.ascii	"(%\022\344\273\304=z\320<n\030K\022\225f\256S\3241\357\276\032"
+	.ascii	"\347W,R\246\302X\035:\263\361\320\274\331\341\240{"
+	.string	"9\364\262\2657\345\017d\253\006c[\320\237A\212\203\020\037\234)w\260k\352(\374z\247\273\214w$m\320\3416\205<Q\354q\025\224\251\273\304\b=A\025Q[\036\031\207\310\264\210\345[\216\234#\024\017;#5\374T}\272Y\027\n9\233\247\224+\024`d\320\247]\205\350i\346\325\233\226\001\252\f\202\260,\221\230\265|\t'\354\245\226\341JY\241\214\342\342\r4\206^\203\246\310\367\022;\005G\356J\025&\020\316\277C!\323S\240j\247R\247<Am\240\036\375Xg\005\2113]}W\270\213\017\240uxV\340\024\023\2618\221\002\257\335\236yQ\222\r&\255\217GY\233\00477\300\303\224q\003&\233\r\031Uf\212r*\020\231\256\036X>\027?&UmF}\320\006&\313N\350I\363T[\032\204\244B[-Z\221\315\234?\022\201v\351\260Cy\204\033\201\\\323\262V\330V\355\302~\355"
+	.ascii	"\330\357\004\222y\301\177&\360]T\340`\231\264\332KjPh\227l\263"
+	.ascii	"\031\257 \016\274\211\033\304\253e\233\b\233\224\214\017\333"
+	.ascii	"\004\205'p\230y\025\377$\f\227\366I=HU\034\263>4S\304\360\033"
+	.ascii	"\206\232\316 \331I\3107zm\004\316(\342\b\345R\251\001\252=]Z"
+	.ascii	"\360\335\236\264*\371&\030.\027\357|t"
+	.string	"\230\216\216\372\213\243\215\004\207\016e\204\317\221\037\353x%\347\232\355|\275\007\002\020\261\311\212\226\031\243Xa[7\006@\210\333\203{^\343\3041=\366\030\300^\016P\264\035+\026\330\314\212*\313\313r\205\353{\274\205-\257\265\226*f}fW\021\222\221\213i95\351\250\211:Wo\324:F)\230\327c\037\346\251\266\232\"#\347\351:\226V8]\370\235BH#\342\211%.g\221!\250k\236\201Y\355\212:5g\375\3627@l|\252\031\001\212\020\003\f6\3555\t\240\375\250\376\314\334\236\022\261.\372\370\004\234\373S[\260l5\316\367\036\005]\346\376O\216\002\315\303\004\356\2274\370[!@\366\304$\301\255\253y\020DN\264\376\202\204\266yz\r\362}Wy>8\n7J\362a\004h$Q-\032\341<v@\315\016\221rZ1\367X\307v\3058\240\272}\260\n>\267@S\341\234Y<u"
+	.string	"Mv\370b\333\254\203wJE3\034\336\354\005f`\021\tuk\t\332\215\340\n\270\251&>e\252o\025\304\221\037\206\364"
+	.ascii	"\323\362`j\n\bb\0255\377\001"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.176.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\265\n\2453"
+	.ascii	"*W4\023E`^R\0077,\f*\377\020\b\026\247\244\3668I\371\002\316"
+	.ascii	"\210\341QC\\?\240\251\327\004d!\"\321.\300\213n8\2548l\304\027"
+	.ascii	"\324\007\324\202\r\021\243\370-\376\3119rp\004\255\030i\215\354"
+	.ascii	"\275\367N2\245\036\001\r\001 \001\\\332\273\370Y\373\274 \325"
+	.ascii	"\f\304\202s\213I\n\327\327\3566C\032%\237\371\252\267T\252\225"
+	.ascii	"!\360\2655\270\276\252\335Q\335\276\356^\267\324\020\022f*-S"
+	.ascii	"\034\250\270\333\237\216%\312\263\334\360a\316`\323\005O\267"
+	.ascii	"\037w3p\020\345V\240\372s\346J\243\226\363SA\037p}\245\342eQ"
+	.ascii	"\375r\250\222b:\350\272b\005\275\223s.\0329\020\353\253\352?"
+	.ascii	"\254\257\037\326\356\352\323{\305\257\013\203@\237\237\257\307"
+	.ascii	"s[v\035\252\217\337\366\244\013[\343rL\255\314\356+\013\211\007"
+	.ascii	"\241\356\256q\262\244\003\\\235s\234>.\205\304\177N:\247\257"
+	.ascii	"5\2469\257\351\204\243\323\033\"\204\005\032kK\342_X[\317;r["
+	.ascii	"c\026\021o\345\260\200\370\230V\230U\215"
+	.string	"r\316@\246\016\325\b/\231Tx\025:\265|\250V\250\"E\314\345\260\304\324\317bF\306\307\324\201\325\326x\346j\023\2676-sgL-\377\036s*\b\027+\3149\373\027V\227\212[c\316\271\261\222\231\345M\364n'\321\3359\272yn\001\276\245r\256\355\304\342\260Q\277\371\005\036C\211*V`W\342\3673'\322\311Q\211s77J\342=\376\337\3542\355o\022\2100\031\323N\246\345\270\006\334+\351Lc\222\275\330\332\305\264\234\325\254\216\213\310\221C\261\276be6\340a\272[\216\233s\322\271\344x\225o\254K\231\224\354\225\r\370z\364FU\370\256\217\336\337\305\364\314\261\272\223\302\323\016\342\001\337\255t\304\256l\207\2727\331\354\274\354\352\250>\331\375\234\302\337\354\366\237N\247\323~\260\356\306\235\344^\274\013\270\025\367#\317\342>\240q\027\021\375p\017\271\270\205|\270\003\270\270\203x\270\201\\\334"
+	.string	"\\\334?.n\"\017\367\260\207[\310\303\035\354\341\006\362p\373\364p\377x\270}.\356\236\213\233\347\342v\335\314\273uq\263\217{uq\253\217\373]\334\370q\273\006\024c\264D\241]]~\356\231\257\246zr\334\272F\346f\356^\274\321"
+	.ascii	"1\001\347F\303\277\364\00478)\335\036S~N\360\324\013\245\001"
+	.ascii	"\222\306I,\365F\351w\312K\005\273\362\245\302\372\332B\225R\337"
+	.ascii	"\377\336\217\336+\027\260+}\337\256E\243\3309\216>\211;\3206"
+	.ascii	"6\246\267\247\375N\315\005\244\301\323\236\247\347\002\336\230"
+	.ascii	"\33492\346:N8u\331\253\367*\276\353\275\2479q-\332\325\346c\321"
+	.ascii	"\255\270$\336\303\313\302Q\254v:\271\251\333\274\357\306\340"
+	.ascii	"\322\2724:uEP\336\027\255\311\331\271\337\235\344q\340\240\301"
+	.ascii	"yC\204\346>\321\233\234\035\366\2737x\033(\037jA\333p=p0s\035"
+	.ascii	"X ,pSW\312r\316\021\3268\033\017\375\001\004\026\301\372:\024"
+	.ascii	"G)e?\b\036\271:qT\237|\346\234\333\325\325x"
+	.string	"\253j\273\020\333\3762\316\333\177(t\216\375fC\0202t\027byg\357qN\364K$K\364\301:P2\227\262\231\001\263~\263\335[\312f\006m\370`\275\376\277\177iqC\205\361\264\372\353{\002O3\302\315\231*B;\234\243!\241\272\022_\273\304\t\326\225\276\266\237x$7k\005\376?\r\003\251\210D\nh\021\003\3438\266`\352\200!\303\005\247&$\323q\304\361\005\213'\031M6\200\2304 \221G\245&\247\020O\310\246\0203\220KB%'\344\207\030\361\241\305\222\022\333JH3\220K\305\243\022\013\027N\307'\246\030E\246\030,\226\212JN\310\"RQ7\3158:\025\237\232\232\234\212\276\247\224\253\371\301\032\350\243-\355\347\376\262\016ub0\351\213~\331\335E\337F\251\237R\205\024\360\200\367\345\313\003\2732\351q\026\272\266\270*5\307c\332\260\354\352\202CW8\311\313\034\023\372!!\255"
+	.string	"=p\330\253u$\350\003\274[\335\005=+e\323\003\350\0076\362\206}\261h@\317\276\261a\002\b\202\273\270"
+	.string	"L\177\206\340!B~\236\225F\367\020\267\360\017(\002m\264\260\217\267\253\310k\304\b\353+K|\207z\2204\232g\315\333\b\214\2369\213\232\261S\306\347\233\3769\347\344o\330\304Xo\330U\034\245t\370-\236(\233P\f\357x\241<P\342\345\233d\311KF\266&\370\302\340\267\322h\030=\356t\321+>\240\023[\351h\321|\036\350\363\355[4\200\326\250q<\345\fS\250FD$I\n\222\345\240\002\221\241*\326\001\021\3608\211\220\251\231\3214IsO\f\306\013\217\202h\002r\006\033\212\307\b\263\b\247C\252\035\270\243/^\314\275\n\b\215\n\345\271t\201\021\311\330w9O|~\370R\265s\001}byi\025N\0264|\265\360\034\213+2\332[S\3317\377\333\231P"
+	.string	"j"
+	.string	"\246\3022\032&\030\320\020i\344\202!e!\216\r\001\340<o\002ad\211\370\317\251\277(\003\3018\227\215\242!#\007\3127\030\323\2517\221\266!\211\337\357A\033\231\360e\273\006\327\n\273\002\366>\370\035\227\341\202l\273Fssv\234\343#\316\305 '[m;!\r\331\262\332<\303\022\235.\333\004\023W"
+	.string	"\224\260`(T\230\354rD\221=\004U\3528\001r3\314L\373\311\355\332\022\253\2248\267\333\257\362\f\250\2248\234\023\353\306\254e}.\253g\311\343\273\241\350"
+	.string	"\331\254x\322\214\024\244\022\035"
+	.string	"\276\224;i\2558t\251\323\356\360\013\300\210A\357\265\032\344\275\271\257I\306\34019\323\347\3045\301\n\242\360\254\016nO\377\270\037\3629\003\025\300\003\365X3)\371\346re\037\346\005@\335\207z\273?"
+	.string	":5\315\337\b!\310\355\004\322s\013\020A\002\020=\247_\276#\030\314\371\0028\327\302t{p\244r\302\316k\b\226\004\342\227w\320T\364"
+	.string	"7\251\033\275"
+	.ascii	"#*\316'e\030\231\013\202.\207\343l<|\222\323\277:\375V\334\f"
+	.ascii	"\232\036\341\032\304\t\303l\314\037"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.177.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`R\004\325\035"
+	.string	"V\366\302K\240\024R:\0048\352`\325\270\240SV\350\316}\214\022\337\267\373\264\344\337W\260l\013\370b\256\243\332\022\346m\214o\305\267\235\231{\343\351\032\r_\201\377P\372g\206\307|\252\211\366\017\274\032\341Xe\311\034\366?\b!\204\310\235d\257"
+	.string	"\246"
+	.string	"\256"
+	.string	"@\003bn\321\021\251\306Z\346[=\007\360F\240\313\334\373\364\005\344^c\0026\240\376d\243\312\314|\252W\001Yh\202\321\320\320\246xC\270\243\354\336\213\243y\r\375i>"
+	.string	"\372\263_\\\350\263\0265EO\263\255\020?\275\221\2204\005\266\016\203\237\265\230"
+	.ascii	"\256\b\305\256\\Ra.0*[q\033KNV\275r\251)\375\220\323Q\263\246"
+	.ascii	"4c}\031\nM\003dA\250\034\331\263@\013&\247\233\346\203\030J\230"
+	.ascii	"\\\271\344drP\321D\033\026\331~\031\032\2314\367\336\377\270"
+	.ascii	"M\032\022Y\233\336\334{\331\256C\2463\355\314|\203\231;0\233"
+	.ascii	"6\001L\242~\362\201\320\237\264v\320\365u\\\242\205b\310.\231"
+	.ascii	"\215A\333D\346\367r\271\\r?1\337l\265\353\370e\216u\206y\326"
+	.ascii	"\331\345\306\037\300\265\256\376\331\267\316*j9U-\243\252\345"
+	.ascii	"3\265l\246\226\033\265\374\031\373\244I\311\304\211C\201\335"
+	.ascii	"\253\264\304r\303N!4\216\365g\375Z\377\326Mf \237\307{\334\307"
+	.ascii	"\1770\215\277\305D~\231\356\221\222\024\253\310\356\275\033\264"
+	.ascii	"|n\210\220(\024q\324\300\311\362\211\271\312\373\245)E+\013\n"
+	.ascii	"l\200\307*\361{t\177d\024s\220\335k<\360\223!\250\255\343\247"
+	.ascii	"\212\301UdR]j\023\221\034\025`9t\260_\321\266WcRaF\035d.\034"
+	.ascii	"S0\322&\376bJY.\320&2\017=;\350\350$\200\331\314\036>\330\257"
+	.ascii	"g\323\034u\220a\332\354Y\222\f\344\331D\313%\026f\366S\320\231"
+	.ascii	"\bz\353\336\221\244:6\211\2612Mk\227\356f\316\311\331\257\267"
+	.ascii	"\246\021v\220\337\335\351X\024\024a\226w\023y\371\020\350\273"
+	.ascii	"\215\2224\216_E\366\n\277\215\270\300\230%E!W)o\230\266H\204"
+	.ascii	"YX\367d\b\365\035\324\005f\305\212k\b\210\235\315\245S(\250*"
+	.ascii	"\353\203\370\324V\346\235\003\031\241\336{\033 E\354\b\004?]"
+	.ascii	"\257\177>\235\316\365|\215\243\341\202\316.\207\362D\360\371"
+	.ascii	"t9^\017\347\347\343\341\364\370v1?$zt\275Sg\227k\316\325\364"
+	.ascii	"\370v8].\007DO\367\343\331\301\361\354\344\354p"
+	.string	"\271\236\017W3\303\274\036]\017\367\343\361z8\232\361\336\274\375\304@)$!\262\305\326\266\244\327\227Zk\230\344\221\257\276\365K\322k\006\212\340'\026\221B\244Ys\265\223\230Y\355+\237\244\b\033j\"N\233\031\302\225\253\024\265\323\236\215M\0251\357\275wF\300\312P\250`\277\332Z@\224[Fvt\naq\242\305\353\265\016::\271a\310`\277\326\332^\031\243\n\023\316\004P\250q8\244\2141\f\031\021\241@f$Jr\260\"\031\254z\020H\3516\005I\007.\304\017\256\004\264qw\355\322\027\2048\n \305\334\270\226]J\023\006|\350\303V\267\260\206A\016Sb\204\300\307\337C\2151\353\241\"\305\213\311\312\003\377h\241\022\004\031\225X\311H\3620\n\177\"\322\216\n\343i\324M\277tb|\"5\352X\276yL\220\350i\324d\223-\007\220\241YH\"D(\356\001}\275{\022\221\254\276\340"
+	.ascii	"\200\030\241@\306\3015MP\001\366H\371\257 \254\004\242\372%f"
+	.ascii	"\370\255N\351\351\034\322,&\027>m\302P\001"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.178.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`x\001E\017"
+	.string	"\326\333eG\360\260(\035\270\267,\370T\240\034z\365\007&\245\305\276 \214\257\255o\317Z\356\235V\260\2567$\342?\005\267H&*\334\243t\267'w\260\351\034\f.\334\236\200[\355J\256\237\303\325\217f\246\245#\241\335{\357\224\002O"
+	.string	"K"
+	.string	"W"
+	.ascii	"N\240\235\272>\344s\252\275\300\347\324%;|\245Y\021\325\213\313"
+	.ascii	"\315\316\356r\222\304K\2372\226\374H\003\347\373<\353\363\304"
+	.ascii	"\253\206M\254\005v\270\234\002z\\nl\240i\226l\330\021\361\001"
+	.ascii	"\236b\004`\262\273\216(\220\303Mo\373"
+	.string	"\201\355\022\373a+g\354\317\335]\313\224\375z\317\257~)\243\037 \352\200\200y\2219\212\331.\314\214\307\302h\f\023\257\267_co?\313\233\355\2722`m\354cv\250>\310v\253\202S3\320\036\355\253\370\212\322W,'\260\233\312q\355\326\005\001\361(\277\346 :!\013\330I~\326h6fwGb\230\002\366\305\036\216\271V#\244\234\021\371\\\032\260\311q\212=\266EwaA\273\204\360\312\341Y\035g%\004e\223~sA\333\335\006-2`@\200\243\304\251\317\3629\235\322\301\353\205)\326\362\320\022gv\375>\003 \217$5T\030u\0365\210dD\nq\035\350D\202\327\251\244\240p)('!\016\344\2218\222\003\026\215:\217S\021\211<n\253\373\2712\345\b\240\213G\326\"M\021deT!d[w\344\254\233|\261\307\234!u\2042>\272\t\361(\317V\bc\213S\332\024B\001\037"
+	.ascii	"3\241\371\037#g\2013\230\t~[\031\030\013\232B.\230\004\344\342"
+	.ascii	"<\304N\033q\bV\037K\340\261V\254\200\250\316\246j\214*\267\271"
+	.ascii	"\022\302\363R\214i\342o\216\204\306\240n\274\013\326<\212X\236"
+	.ascii	"\272\"\256e\231\342l\206St\251="
+	.text
+	.section	.gnu.lto_mspInit.179.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375 \327\325\005"
+	.string	"\302J(0pE\352"
+	.string	"e\247\235\330_?\232&{\232\332;\214\311\212\227\374!\252\212\254\305\316\315\232\315\006k\250\252pU>z\017\205\340\352\007|$\267L\001\207\034\353\232f\004=\021\032a\2244)\351\231&D\257\3510^Y\021\235XU\321\331\204\275\354)FP\244\260v\226\277d\"w\373c\024\0205\316\3760\223\234\371\327\320\354\375\354|\026\314\032\024ts\013\n-\036\016\002\376o\363\372#l\b\320\013\220\253\020$t\367\344o\353\312\372\335\201Ml]\266\022\001\351\356\313\255\273\354y\3777\376;\376\327\b"
+	.ascii	"3\003v:#,\\\347\032\356\026\302x\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`^/\335m"
+	.string	"\252\224\374\036S\220\214V\303\001H\260\201\004\"A\027\017\242\220K_\027\316!asx\023\333,\240H:\250LD\221\246P\303\274\n<\301\343\202\243i\264\342\336B\356\006|\226\264<\317K\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\216\257\223"
+	.string	""
+	.string	"f\214\204"
+	.ascii	"\372\314r\353\227~\337\364\257R&\031\361\001\343\001\307\001"
+	.ascii	"Lu\002\tS\347\fL\235\262b\235A\210u\n\371R\347\312K\235\264\245"
+	.ascii	":k\303:;P\252sH\227:\211\b\353\264%\325Y\204K\235FR\250\023\027"
+	.ascii	"\2543\207T\347\021\024\352\274m\251s\004`\235H~uwZ\352\362\276"
+	.ascii	"\256\221\257\356\224^]*Y\352\236\200\245\356\321\225\272V\216"
+	.ascii	"\352f\261R\327W\245.\360\204\272[\250\324M\301\204\272\305)u"
+	.ascii	"\301\030\325e\342\325%\262\253{+\252;DJ][\224\272E\240\324\025"
+	.ascii	"BT\027\311P]\335\223\272J\234\324=\322\244\356\bB"
+	.string	"u\2230\251[\302\222\272B%\324}\242\244N&\272:\205H\250\263\211\327\251KR\347\022$ui#\324)\343H\2353ru&\301\325\351F\352,R\227\204M\355\255n\220\225;k\303\221!Rw6\207\324\225\325\352\002\231K\253+\302\0242w\004\231\036\314&\215\225\325\215M \033F\204\t\024\233.`\363\305\217\311\"\204\331\3425}\\s\205\217\251\242\307\354q`\246hMfM\030<\226\330\373e\265^T\273\264c\207A\253\004\302v\371`\205:6)\307r\3011Qx0ct0\1778\230<7\346\216\215\r\326X$\032\213\302\214\231\222\261\307\030k\004\332\037\214\325\362b\377g{.vL\213\025\363a\261\204\330&\026{\305g\253\254X\023\350\361h<\256\212\272!\314\236\225\222b\243\360BA\261C<\353dg\233lj\231\324]rb\2136X\327`s&\026\227\301\032\301`k2R\312"
+	.ascii	"\032X\"\031\236\224\355\202\272\257\035\236#CdV\b\335\202\272"
+	.ascii	"=&\225r9Ub[2\n\324Y\302J)g\352HJ\312\016\307\005\352T\262\253"
+	.ascii	"\203\007\f\216\n\352\376\240\240.\214D]\0373)\036\236\024\021"
+	.ascii	")\253\224O\200\266B*\225J\215\250\353\232R\312\001\030\b\256"
+	.ascii	"\336u\035\r\031\311!_\326jU\365\004\257\334\275\206B&$\217\365"
+	.ascii	"\\J\370\026\024%\321#|\202\226\300\013\212\212\360\b~\003XBQ"
+	.ascii	"\020D(\n\342\013\212\202h\020\374\341iR\300\200\351\274N\023"
+	.ascii	"QT\207\227\022\341hq\330\340C(\272\201\213(\252\341\265\240\250"
+	.ascii	"\006\317\300\027>\307q\332\002;\030\024\255\351\032\346\241("
+	.ascii	"\215\207AQ\232\336\232\235k'\231Pt\203\035dG\002\376|\335\363"
+	.ascii	"\334\343\036\3077~\233\333j\274\246\361\317d\3761n\030\367\213"
+	.ascii	"[\275z\236\257\212\253"
+	.string	"\234\250\t\317\240-\370\335\237\f\027V\244\225\023-\341$\216N\224\204\217\360\021\023L \201\210\027\021\201\367N4\002~\337\211B\320\020\360\003Ot\242 z\245\222O'\346Cw\350+'\332\201u\374OT\24794\226\023\345\300\0338\313\211jp\r\234\301\037\203\377N\024Cc\340\013}\201Q8\321\034\340\211\346\340\340 \235(N[\260\340\277\345Dk\272\206i\236w\2424N\3033?\343ZNt\275\001\030\242\204E\016\235\350\f\233@3\205\307\rI\205\206z\220'\320\320\r\275\035\202x\206\031>C_\370\234^\232ehDI\362(\305q\234\036\242\324\302\257\316\017\022 iDi\315\257\316\025\337\213\232\246y\032\236\361\031\236Bk`I\202\262\210\322\020\333a\366\\\344\216\322}(\033e\322\020\273R&\335^&Z\032\"\001\017K\267\227C$@$\251\0079$\351\214:\235\310\250\263F\214:m"
+	.ascii	"\325y\003F\235\034\274\250\023\307O\235:\\\324\371A\213:A`Qg"
+	.ascii	"\220O\235\252\025u\266\212:y\364\324\311JQg\213\353\354\201\242"
+	.ascii	"\316\034<u\372\330\251\3635Su\206p\254\363\207\261N\327\230:"
+	.ascii	"ab\352\2145\325)B.J\224\360\r\222:J\202}\004"
+	.string	"/M\"\304\210,\372\335!uT\202^\231\037,PD\270\b\276!u\024\202~\300\177\017\340\245\216 X\026\371\207\356\360:\257\3033C+\263UI\035\325\320K\300\217\305\030\f\275=R\267BbJv\345K\211\300\250l{\343Th\030\220\345!u\224\205.\270,\251\253!Rd\205,\222\272\235\324\321\034\034\337\332\346_cZ\317|)\022%F\222\3472\216q\020Es`/w\275\253\305\312Y\345\250\216\306&\246\"qi(L\342 \022\360\347\343\036\347\036\3678\277\271\315m]kZ\367\214e1\330\313\3658\255\177\226\263\030g\3258*?\376\321\350M\376L\305&\372/\361\220\205\235\024t$\007\002\371\367?_\317s\215\2739\357m\\k\232\377\214e1\177\030\277\\}\323\352\033V\337\254\372F\345\177d#75\223\027\221,\212\332\024\211=\364)\370R\017yP\324&\311?\310H\r\364\337\257"
+	.string	"\2730,9\344\\P\324\306g\323\263\301\261\315\277\306\264\231\363^\3061\330\303\370\325.o}\213YC\276j\233\025\333\250\216m\364ob\246.:\361\211\274\324C\027z\322\007\037\351\177\355\363\247=\3165\256o\266Z\323\234\316\250\214cMa\376zW\213\265r\252\3527rS\027\233\350\277\304\303\026\372nP*\225\372 #5\320\207~wG\213\021\224I(:\177\335\303\335l\277\b\214\211\001T\243\375L\026\203\275\\-\237,\237+\237*\34371}\321\237\350\273\344?d!'9\357\205N\324\005\005\374\365\346\334y\250\002n\354\354\220J(\272\266^"
+	.ascii	"h(\275\226\366C\224,\366\260\322\303VhI't\206\337\267G6\221@"
+	.ascii	"\"\\\220,\222Mh\215je\242\004\325\220Lz\313\241K\215\n\225B\224"
+	.ascii	"F\265\262\310\310\220\036\250\336\356I\n\321\031\236])Duz\272"
+	.ascii	"\347\300\033|S\233\322\300\236\2411\370\205\317\341\025`\347"
+	.ascii	"\342m\317\273\205\376\232\226G\212$\023\352a\251\334I&\024\207"
+	.ascii	"\366M4\027#u\2637J\335Q\346\233\222\355N,\006\343y\361\030Wk"
+	.ascii	"Q\264\232\245.\205\324=\216\252\377hdr\025Ev\"{\001Kv~\266g\330"
+	.ascii	"\273B\370k\300\227\241*\310+\2454a\322\375\372o|\275\034\016"
+	.ascii	"\327\267\277\331\372\237\3263\331\257O\354\305~\343b\277i\371"
+	.ascii	"\216\305+\366\033\325\321\350\273\246\357q\026\355C\344\026C"
+	.ascii	"\241\367|\022\257O\020\310\376\363k\027?\336\255b\364c_H\235"
+	.ascii	"L\216#^\030\275\334\357r\216\363\335 LH\013$u\223g]\266\307w"
+	.ascii	"7v\033[\315cH\235\f\332\317\240\021\363\032-\003f\303]\3546\255"
+	.ascii	"\267Q\361\027\211t(|!'u\320\221\220\032\370@\376\375\317\367"
+	.ascii	"\324\327\353\234S\334\337\370k\3764\2463\377\030;\214\351\253"
+	.ascii	"\237\203\356\300\305,V\257\236\256\232\252\376\370\307\226EF"
+	.ascii	"ob\362/\262\023\337\205I\357AR\373\3668\022\020\370\373\371\334"
+	.ascii	"W\301\365@\333\323\343\234\343\372om\373\032\323p\314\\\306\017"
+	.ascii	"\353Wo\216wq\253\237\305>W<UG_\2377\262,jj\2465:z\262=\305\245"
+	.ascii	"_yd\004rY\035\376\201\324\311\"\022^Z\204I\f\364_\257\037\327"
+	.ascii	" |\355kL\363Y\313x'\f\033VdQ\254[\237\343c\207\227\023'\332M"
+	.ascii	"\260g\300\026\370\316\234\222\204=\250"
+	.string	"#\023\244\274\262D3\222\024\024\322\032\303\031 8\224\363$t\250y\023"
+	.string	"\313F\264PTR\243\023\221H(\"\342\007&\262\272?\240H\253m\350.Z\366\177vJ\206\352k\221,)\374\256I\325\323\352t\201\203\273\244`\325\b\2315A\357\274\233\301\277\356\240\222\035\324&\023\207\340\353^\257\006\340\366M$\350\212\333\021\332\302\372S\225\3268\034\307\005H\354\263m\207\330\036\250\237\253\274)H\324\226\3050\334\263\326\024\360\321\223X\215Z\036\343\026\300\334\250\231\302\325-V\203\305\302!X\201`A\031\310\021,8\203\253\224\252\302\255\244\032iO\006\246\326(\303\0030\251\027\357%\300_$\002\0067,\301\311=\341D$\322\317\222\006\367hA!C\263\301\025\317n\213\024\250)\006\301\f\234\263\354\230\353\322\364\016`\016\267\017)\204\007\214yB\0207{zG\f\004\307\323Zph\025\t&\224\214$^\347J9\323\025\321\032\332\324r\253="
+	.string	"\002\307\355\343\\,\035^\200\222\300\336\245U\341\222Z\234\347\237\344\244\037\244\343?;\312\271\277\343\341\032\242\031+e\240\206Ec\004.s\303\266\374\003\003\216\273\275I"
+	.string	".\300?W1\223\311HE\301\357\215\361\305\355G\020;\006\021{\353\373\213\352\367\343q\303\226\322\263\331\360\003\b\002\017\004\322\017N\037\b\036\264\016f\271\356\003\016\005:\237\263\300y\231\240\223]\351\371\f\244\237\016\030(\210\236\223\242n\350\373L\024^\372uX\317\317`:\357\305\236\026\316\311\247\200\320\315\231[\265\263\257\267\306\225\221[M(\361\224\360\244O\003$\371\211\323\355\274gn\361/,\250\354\343\355\3110\215E\305]\006\363\007\274\234\207c\332\323\213D\026\004\2059\355t\263\353\357\276\267fS^M=\221\353\365\214\264]i\024\273\233)\023\3269\035U\221\320_\030\017(\346\202\272w\340\301,9\260Y"
+	.string	"\023\220\361\004\205\351\032\\\3219\274z\204"
+	.string	"\f{\2120\024\275\005\210\\\277\n\331<\256\254\277\366w=^\021J\356\242\242p\3009\307\241j\347\350@\022A\201\r\224\030,1\344\0039\317\261s\370\363\2016\325\255\\\374\032\241}=\376\tJ\004\234\3316\315\313*,\213\3442\205@\007J\313zLV\222\222\020\274\301\t\273\324K\334\253\356}\303G\266\267\r\252(\216\030\305\374\022\b\200\"?\004\244"
+	.string	"WY\307\270\217\0318\220-\276\264"
+	.string	"\204\206jN\363`_\n\324\263\276\375]F\214\005D\316 \3124\0376G\341LH\177s6\372\366B\251{fNS\032\232\343>\302?\006_Yi\317\373\017\312\226\317)&\354\022\344\340K\262\313R(k\205s3\256\275\343r\256\330\177\357w\246hx\347?\306\370g\356\254\323\027\200|#\257\313\350q\312\322h\031a[\367\317\234\353\200\013PE\241\374\375\347A4\377\335\210i\031\252\245?Hio\350\003\024\240\337\227\256S\311\004\262\013\231sf:\004\306\342\317\325G"
+	.ascii	"_\255\375\016\312\377\327R\272I\226\036\353\217Ih\211"
+	.string	"\245\275om\347\266\312\252\203>v\2421\237>\335\343j\017e\275\033t\262U\211\331h@\366\r\2377\221e\027\223\357\237\325\315\236\347O\033\211\221L9\251\007tHsk\361\313\024\215s0\207\350\025\345t\261\241\305\234\371\213= \337\207\311:\211=s\016^\360\b\254\3003\235\205\227$\232:S2\272R\025\374\243\353u\355\020\276\237Fd\236\242\240{\200%W\224\275\222\255\016\310#\016+'}\004\345\345\327\242\274O\\\210\337I\027\235_.'\260\260}\274C\n&\n\212\276\202\336\235\370\373\341I\313.\202\343\211\357\224\001\342\217\275Cc\217i\266\313\\\311\013y\300l\210{\204\274&\325\t\006\334\230\225A;\371\036\263\203^\2253\365\336\336H\374H\177J\031\217\200/c\235\236\317#\354^\036\"\264\253\027`\201TH\335\204\351\246-7\033?\350\246_\025Z\021\261\212G\237B\036:\317\026m\370"
+	.string	"\204\343\"v'8"
+	.ascii	"\325\373+\360s\243F\306\"\364\201\036\262\230\253Ai\371\007a"
+	.ascii	"2\006}\033\2012<v\007\371\220X\356\026\324\274N\321\030B\367"
+	.ascii	"\036\315\351\271tF\222~\303+(Fc;:@\251\205\313\203\266\270\035"
+	.ascii	"\224\346\342\002.\342\316\205\342\375*n=\235\237\247=TjX\013"
+	.ascii	"~\242{\222\230\346h\n\324\207\"\334\033\273\366\250\346\231^"
+	.ascii	"\222\016\275\235TvTR?5\275\357\036\223\273\223oO\312\311!6\271"
+	.ascii	"\223\320\250\231\034\222\033\200#\373\370@\bFv\253\216m\351\t"
+	.ascii	"<\337\261\2348\245Q\237\212\347e\362\361\205\333m\250\247\317"
+	.ascii	"Gv\245\270\327\035\336\260I\254\272\372\027\363\342\343Lc\266"
+	.ascii	"a\270\363\325\354\351\270\304!\037FQ\364]\221XJ\212Q\325\321"
+	.ascii	"*=\3549i\373;;xx\220i~{\345)\234E\370\2355g\034\3076\364M\232"
+	.ascii	"\263\216\343\rzf\335\3441\212s\2561o\272\264K1\327\2307_\332"
+	.ascii	"Q\230i\316\233/\355(\3154\363L\227w\224f\232\371\246\313\035"
+	.ascii	"\ns\315|\323\345.\205Yc\236\371r\227\302\2549\317\274\264Ci\326"
+	.ascii	"\234g^\336\241\230\265\356\003U=\355\277\334\342\bq`\267W\214"
+	.ascii	"\375\212\327\026\367\344\340\343]\030\320v4\276&P8D\002\341\367"
+	.ascii	"\017\351\026]\223\240\251\307\370\030i\322*\203S\347x\273P\035"
+	.ascii	"\231}B=aav\354\037o\250\013\023\177\306Aq\246\323\032\026\204"
+	.ascii	"=\323I9\210S\337x7\251K\216\323I\r\007\301b\233ba\200\343\243"
+	.ascii	"\231\023P9\366\211a\234\277\370\265\346\211C\344\231\005\271"
+	.ascii	"n\331m%\007(\354\n"
+	.text
+	.section	.gnu.lto_.refs.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375`\365\007\215 "
+	.string	"\026\177\324I\220\224\3220\006\030#\021#\017"
+	.string	"\214\0257\242\233\275\203(R\213\361\250\240\373\375{\003\032\3562^\bv:\317P\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0 *\025\002z\226\355\341\340\020\006\274|6\344\306\223\266\367\3362\005\255"
+	.string	"\303"
+	.string	"\305"
+	.string	"\243_]Z\277Gc\\\265\230\212jJ2\026\025u\036%\336i\221\273\242\363\373&\3417J\316\257\223\246\222\b\277?x\230A\370U>\370\005s\360\313\325\340\367H%\365\264\204d\304\371\035\022\272\371\rz\326\315\335\374r\f\320\177\263\371\247\330\240\337\\\360\253)\370y(xa\202\021\354\2177\r\315l\231\024\363\375\336\250Q\363\213\304\242\371\245R\0015\363\313$\363w9\360?c~8\003\377[\201\237\351\373\2250\017$\360;\003~\202\200\217\t\3600"
+	.ascii	"\320\227\004\243\274{\273\260\207\036\344}\017o\347\341\355\276"
+	.ascii	"\025\375EES\336\2778\003J\216\fa[K;[\376~\325\001f\243k\013\231"
+	.ascii	"u\345\202\305\224\324\023\317\257L/\177M:\001\374\225h\370kq"
+	.ascii	"\345\257\304U\304s\313c\257f\211\273r\362\325)m\037^%\302\f\242"
+	.ascii	"\346\003\255\314\303\253d?\350j2\354\301\253\\Z@\257\312\300"
+	.ascii	"\262:V\255\350\360\352\023S\022\212#\242\237W\213]\270h\231\303"
+	.ascii	"b\345M\312\2236&?\237\")\342\363\251\220\265\341\247>\3168|J"
+	.ascii	"\266\341\3231\r\237\346\310\360)\030\206O\275\204\237\322\270"
+	.ascii	"\360\351\f\013\237f]U\255\210r\252\360\251R\360ScQ\261\347Sb"
+	.ascii	"\317\243O\340\243uY\342x\036\245\022\305\255\311\022$;\2172\203"
+	.ascii	"\250"
+	.string	"\361\240\360(\331\0044@\324z\234-u\210}\361\354\250\327\313\035\355\332\002\356(r\270\243Y+w\324\312E\213\252\251\307vT\n\312\351\344\216*!\031\215\210\2128;*\204\263\357\335s\013\235\234\363f\337\266\321\366]\002\334\327\310\020!@z\366M\353\201\306\263/Y\016/.$\214\343\024T\023\322\020\321N\347\247\233\213sZ\201\333\331wkk.\241\260\317\346\003\315\354\367\227I\330O\346\354@\303\335g\270\353\274c\027\360\331 Vy\317\351\262\357)\001\277\227b\262\357\235\030~oH\350\367\275\240g\335\234\023N\212[3I\021&\2204\264\262\2610\033\\H\254\027TRNJ(\214~\317+A\344\211x\322\3119\253P\211\342\326\f?\364\355\032|\273\320\267[\360\355A\337\016\364\355:5{N\315\356\200f\277\241\331ef\366\230\231\275\300\314\376\"s\b\230\3279\233}\305b\203\2762\331\326v"
+	.string	"\355\2532\231#\f\307W\207}\245\241\205\214\201uu\214ZJ2\036\r\025\205\210?\373\032t\367\263\253vt>\273*\347\254\022aW\237\bw\325\211\260\231\304\310\220\n\273\312d\013\256\005?\273\261\365aW\257^\004w\365\030|\265*j\3513\340\256\246\230lW\215\303]-2\241\216\270\263\253\313\022w\005n\n\024'M%G\2100\203\3740[\212}\325\320\222\201eu\254R\021\365\324\204t\364\373\324\210\310D\t\022\351\b\273::g\0258*mL~F\2100\331\002\2013\250!\270#\021*JQ\241F\0071G\306\251\034\021`?\300>\177\331\377\356\231\007\242?\317n\210\273Q\377\246\002\224J:\252.\217\t\207{\272\236#!\370\030!@\266\303\002"
+	.string	"8\034\n\270\273\225\024\364\266\207\322\247\226\230\317@P\357\253&\227i\031L\312\377z\356\226\3305\204\033$\377\364\211(\006wax$\344S\245\325\001\247\347\236\370\277\371\341\230\245@\225"
+	.ascii	"\340BSf\364\366\273\347\177q\252\363\304\020Z\254\230\t\027\377"
+	.ascii	"y\314-\330u\020\006\310\376\351\323\252.\330\221\200\246\007"
+	.ascii	"\374\234C&\245\032^\007\347\f;\366L\260\336=\215\230-\321QZ\227"
+	.ascii	"\331\266t\211\201(\243*"
+	.text
+	.section	.gnu.lto_.decls.d70dc03a5978febf,"e",@progbits
+	.string	"(\265/\375\240\262\003\001"
+	.ascii	"\225\t\004\036S\006\177\026T\0200d%5\006;\342\262\227\311\003"
+	.ascii	"\303\226\375p=\207\257O\321\334r?\250\211\201q\375\240&\277\271"
+	.ascii	"\037\364B\344\360y/b\201\201\201\201\021,f\363\213\2641\033\352"
+	.ascii	"\326\313DE\300\247sa\035\262R\357\3449\234\202\2766\005\365\311"
+	.ascii	"\326,\331r7\221[\356\024\205\023\277\026\232\027Y\237\310c\247"
+	.ascii	" V5\260\317S5\260'.\355_\027\321C\274\224\204\325\310Z\017\321"
+	.ascii	"P:\b;E\356\351\210\210\032\325C\264\220\253\032~Q'f\204h\375"
+	.ascii	"\241\334\3765\220\037\372I\230VU\325\226\265\n\367\341\032\210"
+	.ascii	"\357\212\324\211Q\326\037\276m"
+	.string	"uH\305\300\336h'5\255\204\252\035f\262\376\265\217&\340\223/Q\254d\375,C7i\035\017\023\272q\334\305\354\331\244\231b\016~\340=\261\352\241y\250Q\335\244wh\bj\331\350r\206\325\037~\355\017\271\366\207R\373\327K\3278X\24314\262\262\276\232\245q\344\271\\\247\246y\351\2525\322\234&\253\3218\362T\037\t\177\240\361O\033\366\303F'\351\034ZI\215j\034\332\3065\222\276!$\3258r\334\0176U\323\340X\226i\216\255[\250\212\201\375T\315a?|\241\215rH\277~d}\341\335\376\257k\350!\375B\317\320B\032\206\016\32214\221\226\241i\250Q]\264NY\277r\232\254F\310N\003\251i\033\264~\322\234MW$)\253X\027i\034Cu\321\352E\377\254]\317\n@\201\311\351\242l\227\361\326\256\347\256\022\364E\252jaY\267@m\270j\263&N\027\2558\326\350\332\365\244"
+	.string	"\224\027i\316\323E\253\321z\244\252-\305\261\r\020\234$Is6\375 \004]\224\331\344\027j\332R\374\023\267\201\2230i\316\2469O\027\255\361Z\264v=\335\242(g9O\027\2556\324/Um)\006\372\031\301\311\2174g\303)K\342\240\032\364\205_[\307\026\f\201\f\001b\313\372\302\253]\266~Y\241O\023\202\212\244wk\336\332F\215\256xB+\336\212\266\312\215"
+	.ascii	"\343h\205\240\032R\274\325\356g\027\004\r\305@?<H\262F\256i\252"
+	.ascii	"\245\020\361\342c\353\007\361\366U;7\013\3244\"\023\240\252\202"
+	.ascii	"\346J\252\302\311\255`\3262\027\004\r\245\320\305\312\231k\361"
+	.ascii	"\202\303\3122\3366\250i^#\304\262\244q\f\225[\245\327\"\024\""
+	.ascii	"\306BRV\322Un5c\001[\244\b\\\325t\272\262Y\347V5k\335\232f]\263"
+	.ascii	"\322\251\321Un\215\273\206\236\224\350\324\016G?x\265\037\244"
+	.ascii	"\332\017\032\331\017>\355\007u\354\007\221\366\2033\366\2031"
+	.ascii	"\031+?h\324\214\262>\020\r\333\332\246F\3271k\230\264u\r\310"
+	.ascii	"\333s\314*f]S\323\226\2401\022\316[\231\265\262\351z\305\f]\224"
+	.ascii	"\325\007J\255\251\375\360\264x\340\251\255a\204O\246\210\200"
+	.ascii	"d}\240\322>\320h\0378\264\017\374\331\377z\366\365\313\277rY"
+	.ascii	"\273\250i,\364\276d\230\305\310z5\373\360\365\354\005\021\"\244"
+	.ascii	"\254\021\240\346\260\377\261\331\377\325\355\fU1\260\033\324"
+	.ascii	"\0346\313\252\205\314\247V\325&JZ\0262!\025\031\247\347\330W"
+	.ascii	"\262\303\345\0303\322\340\274\254aF\266\226\272d\375_\327\276"
+	.ascii	"\032]\257\254`rm\320\302V+_\301\362\013\365\f\214\245 Y\277n"
+	.ascii	"\255\362\337\325PA\270XU\241\362;R\003\345Ee\235\262~\r\305>"
+	.ascii	"\236\220\272d\375\257^\277\353\373\242F\3073\353\377\264\366"
+	.ascii	"\177K\366\177H\2724d3Z9\244d\375\337\017(+\227\032]\243\254;"
+	.ascii	"\276\336X\223\256\001\032e\315\2612\251i^#\236X\211\2626\255"
+	.ascii	"[j\332\0221\026\202[#U\245l\301\223c\365s\315\"\363|\262j\255"
+	.ascii	"P5\272n}\335Zy\254B\204?7q,d\372\334Z\207\254Rj\232\027\nUg\244"
+	.ascii	"q\034s\260\200\003\207\037Q\020\036?[c\255N\324\350\232\265^"
+	.ascii	"-Y\255.\b\032B\201.,kM\262*\271 h\b\205,f\322Mf$K\021V\377\207"
+	.ascii	"c\377\253\325\332DF\230\2221L\326*\037\216\245\264,Y\377'c3\271"
+	.ascii	"Z\224\344\205Y\326\377\305\373j\364o+\325\243\316\224\264\262"
+	.ascii	"\276\317n\337G\267\357\223J\255D\326(5\315k\004\232\2334\216"
+	.ascii	"c$\353\224\032]\245\326#\253\324\332\243\314\214T8\245\304\211"
+	.ascii	"\026\253\357\023\263u\023\241)_\262^\215\254E\342`\020\216\207"
+	.ascii	"\226%Y\337W\266\357#\333\367\205\355\377+\2205\210\032]\205\254"
+	.ascii	"PW\341V\245k\200\306\261\225U\310\352c}\272 h\210D\0178i\326"
+	.ascii	"*d\355\241\316\375\220\304))k\201\214m\031a\365}@\366\277>\255"
+	.ascii	"?t\f\201\335A{\\\226\304 Y\235\326\035?\267\0311\\\326\367\361"
+	.ascii	"\330\367\341\330\367\021\355\373\202\366]5{i\3251\345\351\211"
+	.ascii	"\325\333\222\313\266U7\314V\241*\006V\203\232\303z\240\346\260"
+	.ascii	"w\313\366zt\325Mm\221\262@\031\313\372.\331\256\241ax\203\307"
+	.ascii	"\224\241\254\357>\331\007\361\263\n\255P\2166\225!U\244\353\214"
+	.ascii	"\225H\215\2564\326\027+\215\025\306*\343\306\006k\240\030\351"
+	.ascii	"\242\201C\220\312\324N\211\3251\326\241!\r$1\242\262\276\033"
+	.ascii	"\307\250\333\337ikPF\212\032\311\262\002\201\355o\254}15\207"
+	.ascii	"\275\313m\324\2654ldd\375\035u\267\237\366\367\322\376\246\261"
+	.ascii	"\277cl\326J\305\300~\214\232\303\346\272\207\345\f&\256\3074"
+	.ascii	"ku\312\207g\272Ul\013\214\273\254\277\343\37545\207}\333\266"
+	.ascii	"/\315h\3404\0252\260-oj4\303\3453\327\3208\366\202\313c\262\031"
+	.ascii	"5\315+\006\n\222\001\023)\236\325t\210&\307\220$\255\337n\355"
+	.ascii	"?\223y6\223\335\262S\234!\327\0202f(\353\r\271\ft\350\266\315"
+	.ascii	"\361\360\312\372m\325\376\340\3033\031\253,?\326d\3756\311\376"
+	.ascii	"s[\021\033R/J\031\026\220\230\265\340[\0236!j9\214\032\315k9"
+	.ascii	"\315\213\372\265B\305v\214(X\322\265\\v\365l\363\250^\254\261"
+	.ascii	"\372m\022\0304\3373\016K\373\222\317\324hF\313f\031\032\307]"
+	.ascii	"^T7!\0201\026\nbz\306q\214\226\313T7\020Gh\306\254\3428\326\300"
+	.ascii	"\201\203\007\314\316\254a\365Y\273}\266n\237\205\353\302\245"
+	.ascii	"\367\"K\216L\326[\240Bq\034kpi(\331\265\311\372\254\226\375\020"
+	.ascii	"\256H=\303\220<\343\030:\226\265\344,j4\223e\261\253l\371\347"
+	.ascii	"*Y\306\022\202\324-\215U\034C9p\320\300A\331%\365c\353\263\320"
+	.ascii	"}v\310>\313c\2375\332\177\006\263\242\213\310\266\310\252<[\371"
+	.ascii	"?\bA\235c!\3160\324\022\313\231e\375\341\303s\025u\313\016\n"
+	.ascii	"\027*R\\h\332\221Q\326\007\021\345J\226V\206\"t\343\370\251\313"
+	.ascii	"3OJ\346\312P\332\"R4c\323\354\225\247\344/5\232\245\344\256\347"
+	.ascii	"h\226\301\201\003\007\r\272\207tJ\306\326@\265\375\236\227\375"
+	.ascii	"\036\225\235\237\344-5z-\031\352\nA\343\256\"\\~\212d\375\036"
+	.ascii	"\327n\021\307q\254^\013\333^\013\373\336U\226\023!\217\250\033"
+	.ascii	"\224l\225\261\362\225\032\315Nr\325s\023\325\356y\211\372%\354"
+	.ascii	"\305\261S\331\323If\242~\t\201\240\361Q[\345\310-\315\324IV\022"
+	.ascii	"\365tK3\215c\250\006\016\0348\2549\246hyn\315\2529\354{D\373"
+	.ascii	"\275\240}=\335\327c\366\237\251r\222\214\245\350I\3569\311\034"
+	.ascii	"\013G[\n\016$2\371\231\211\370\242\236\204\230"
+	.string	"d}5\215\252\346\303Q\b\377\207\274\364"
+	.ascii	"\254/\231H\036R\277\3244\"\023\310z\223\3061T\307\331\363C\306"
+	.ascii	"\201$\376\001:j\243\232\252^9\322\376,$?\345\251\354#\367\310"
+	.ascii	"A\362\217\f\225\215\344!\031I\006\222\235rT\346\221\213d\251"
+	.ascii	"|D\215f\"\231\351yGn\272V\275~\025.F~\301N\305mT\323744\354\356"
+	.ascii	"\304\262\f\032\371\b\332F5\315\313\261:'\\\343\270\007\233']"
+	.ascii	"\335\2146"
+	.string	"\277\n\247\342M=?d\"\331FN\022\nAc\033B\260\2436\252i\326T\235\023\376\020\343\240\265\241g\034C\257\256\371U8\225\215:\247\246-\305+\032i\033\225U\034C\237\177\376\017\377\007!d\"YI\235\023\376@c\2436J\332F5\215c(\007\r\034\264\232\027&?\016\240\3254\025\003{\201\232\303^_\355k!\373\372\306\376z\267\277\252\355\257Y\220\362\215`Z\2162T\266\220\216d#\265\006]\220\252\254\277\346\330\231(\327P\243\271\350\3173\324\274k.\247\270+\216\241\301\025H\351KX\326W7\260\303\274\274\274<u\003\373Uhk5\207}\032\335~n\333\371E\316B\031\306\363\213\034\364\017B8P(\277\320q\f\244\252\032\bUU\203\236\026$@QX\375\234\266\237\253l\rR;\003\037{C\246\261=\250\333#\214\331W\275\354{\251\030\330\253\\\373b*\006V\225\252qjT"
+	.string	"\252\034t\030\304\273\302\263\313\372*\326\276*"
+	.ascii	"V\315S\005\300^}\332D5\207}\027\025\003\373\253g\314\254XZz\322"
+	.ascii	"v\325\214\233\227\360F\324\212)ku\214JF\215Z\240\226\211\207"
+	.ascii	"\252\034\221 \033Y_e\332(\210c\325\002V\315\313S-`U\266\017W"
+	.ascii	"\333\036\020\005\004+\353U\025cA\333\004\213\017!kj*\231'\217"
+	.ascii	"3\2650N\222\204\034\201f\305q<t\261\3301\301\221\265\212\246"
+	.ascii	"\202\271\232\246"
+	.string	"~Y\177\270\3244\020\234\342\030HM\033\336\3051\320PU5PU\r4\026\324\024\025V_\305\261\177\365\314L\210\220/\257\254\325\262\24260\270d}\365g_\215\252^\272\250\320Cl\216\313\325.\377\007!\034\016\030\307Yq\034_\240\313\274\220q#\353\327\251[\376\273\27667\273\264-Z\332\027l\312\272\262\376\257FU-j\026h\254\001\330#\b\323\230\254\017\357_%\023\300\020\252T\003\310\030\002\266\020Y\225\254\254\177\025\213\032\266\016\0219\305^q\f\275Y\305$!#\222\365A\374\252\326\226JE\bD\214c(\036\3178\216\377\253b\352\0255\252\206\375\252\025\025\354\031z\020\377\2070\265\212Je\205\212\3051T\030\004\374h\201\301c\032\3071\007\r\0342\217\245!E\254\326\261\212\201=T\315a?\302V\251\374\252\226\372D\375R\235\342X(\216\343\f*\224\"]oY\253\\j\0245\212"
+	.ascii	"U\312\325)\252\327{@\320\030\032\307\320a\216j\363\025%k\242"
+	.ascii	"\212\201\315j\016{\017\373j\327s\270\342\020\376\333W\021\300"
+	.ascii	"\256yy*\002X\025\372Au\242f\345\260GK\320\330+\216\343!\213\267"
+	.ascii	"\206\206W\326C5\207}\3369V1\260\031\2509\354\241*\006v\2539\354"
+	.ascii	"\337f`\312\365/\234\352\221}\370\013\213\374\275*\177k\202\373"
+	.ascii	"\374Y\247;\365\263B\\\251\237\375q\221\374\254\322=\362\367\304"
+	.ascii	"zW\376\236\327\337\033C\321\313r\263\266\004\006\277\360\307"
+	.ascii	"\3376\300\215R\207j\316\257*\340^/\263^\031\371s\007'<\340\027"
+	.ascii	"\032}p\201\374\275\253\007H\300\205\332&\270O\377^\300\337\243"
+	.ascii	"r\177\250\340~`\203\340w\235\376\274\301\016\301\357\372\320"
+	.ascii	"_~]\346\337H\267\307\257\203\374\032G\357\310V\272<\3306\360"
+	.ascii	"\317^\300m\372\367\t\334\035\277\316\023\3321\\\246\177\323p"
+	.ascii	"u\374\273\003w\351\337EL\273i}SO\260\235\376\375\343wsl\250\314"
+	.ascii	"\200\275\343*\345\016\332,1m\210M\304\305\2415\320\006\320\t"
+	.ascii	"\320\n\330Qm\006\376\215\344\337SV!\377J\265F\255O\366\363\337"
+	.ascii	"I~7\351\3378\334\033:\003\272\270\231\354\252\337E\372\357\325"
+	.ascii	"J`\233pm\374\033\313=\372\367\226k\364o\256\177\247\360\357\256"
+	.ascii	"\337-\352A9\030\375\fn\215|'\343\357Y\375\275$[n\275rc\374\356"
+	.ascii	"O\357\307\357\226\340w}~\227\371\273\311\326\001*\224_\310\342"
+	.ascii	"ou\376v\347wu\224\256\n\236\340\0174s\337\377e?\273\"\354`\377"
+	.ascii	"\277\204~\027\371\267/~\367\330\326pS\374m\363o\235\277k\374"
+	.ascii	"\333\025.\013\277[\fA\013\377\023\360\003\313\374\275\246\277"
+	.ascii	"\247\343\357\361\370{>\376\336\216\277\327\343\3571\375-\334"
+	.ascii	"\357\202\300\375\300\337\206\360\267\"\374\256\007~\215\341\357"
+	.ascii	"\305\370\333\017n\007~-\202\177\355\371W\033\377:\202\177\245"
+	.ascii	"\361\257C\377\272\374W\026\377\032\343_s\374+\320\277\356\374"
+	.ascii	"+\n\377j\364\257\307\177\325\371"
+	.string	"W\016\374k\361_5\360\257\315\177}\361\257\360\277\256\370\327\023\374\353\214\177m\341_e\374+\216\177\005\301\277\206\340\357\255\360\367R\374=\024\177\217\002\377\312\302\337\003\301\337#\361\367.\360\367*\360\367v\376\265\004\177\357\003\177\217\205\177}\377\325\003\177\357\370\3676\360\257\035\370W\244\277\207\201\277\247\201\277g\342\357\025\377\236\n\177/\004\177\317\003\377Z\346\357u\340_\351\376\265\355_\311\374\253\231\177\215\373]\016\374=\237\277\355\300\335\300\337;\361\353\341\257u~W\003\177O\347o\023\360\267\034~7\003\177\357\302\337\033\300\337\313\340\357a\360\267\006p1\360\3670\374\275\341\337\253\340o5pQ\350\274\336\372\267\002\370[\f~\367\304\317\262\340\232\370\265\230_\263\375Z\355\327a~\275\366\267t\356\005~\335\366\273%~\327\002\277\216\373\335\025\376\326\002W\205\337MAS\375\032\354\327V\376^\324\337bp+"
+	.ascii	"\345\327]\277\216\362\353)\277\226\362\353\350\337\342\374m\316"
+	.ascii	"\357R\340\327G~\315\344\327R\277V\362\353\252_\367\370u\324\257"
+	.ascii	"\211\374\272\311\257\247~\315\364k\036\277^\362\353\037\277F"
+	.ascii	"\362\353\247_\373\370\365\216\237\215\200n\376.\211_\217\340"
+	.ascii	"o\205.\n\2776\361k\024\277\356\300\357\236\360\353\026~\327\204"
+	.ascii	"\277\365\271%\350\025\376V\375u\tw\204\256\300\257)\360k\021"
+	.ascii	"\277\016\361k\0224\211_\233\360\353\024~6\215+\342g\347\264\007"
+	.ascii	"\277K\302\257;\374n\210_{\370\335\t\374\372\203\337\225\300\317"
+	.ascii	"J\335\b\374\332\202\237=\343B\340_\347\376U\372\257ud~\266\314"
+	.ascii	"\357>\340_\253\374+\225\177\305\362\257b\377\032\366\367\202"
+	.ascii	"\374\254\030\327\001P\377\372\364\257R\277\333\200\177\245\372"
+	.ascii	"W\255\177\205\362\267S\227\001\377\252\344wG\370{P?\213\346."
+	.ascii	"\200\355\362\273\"\374\353\t\377J\201\1775\341_U\370W\344\277"
+	.ascii	"Z\340_a\374l\026\271?K\377\f\367\347\351\237\325\374\371\355"
+	.ascii	"\317k\376\034\367g\272?\317\3759\315\237\327\376l\367\263c]~"
+	.ascii	"6\354g\305~7\204?G\371\331*.\b\177\276\372\263\325\237\261~\027"
+	.ascii	"\304\317Nq?\370[;\367\003^>\362g\251?G\375\231\352\317H~6\312"
+	.ascii	"\317v\375\256\007\177\016\362\263[\256\207\f\377l\326V\335\016"
+	.ascii	"\177f\376,\226\212?+\377\335\272\035\374\271\002\177F\341\317"
+	.ascii	"$\376L\201?\227\360\347\021\177>\241W\344g\233\270\n`\300\237"
+	.ascii	"A\370s\b\277\313\301\237\033\360\347\005\374y\204\336\220\237"
+	.ascii	"U\342"
+	.string	"r`G\270\t\370\237\366g\004\374\354\t\356\206|\301\317>\1776\311\357\"\340\3379\356\001~\327"
+	.string	"\356\006\177\256\340W\341?\347?c\370\363\360g\217\270\005\370\333\024\273\002\227"
+	.string	"\367\312-v"
+	.string	"\246l\f~5\351j\340f\360o\016\277;"
+	.string	"\027\203\277W\364\353\261_-\301\257\007\360\353\002\374\032\001\277\016\300\277\026\371\327%\236\f\377\301\374\357\200\007\376[\340\377\001\334"
+	.string	"\374."
+	.ascii	"~7\347w\201\377\312\345\366\376\215\367o5\377\256\373\367\334"
+	.ascii	"\277\345\376\0356D\035\373\203+\374j\001\376\035\367\253\003"
+	.ascii	"\370\267\364W7\374*\007\277\332\301\257\032\177\225\205\237\335"
+	.ascii	"\300F\363\253\037\370U\017l\270_\275\300\257\242\370\325\023"
+	.ascii	"<\366\033\313\264\317\374*\n\277z\302\257N\340o}\374\333\314"
+	.ascii	"vSGh\243\376]f\223\371\331\033{\314\277^\365\306\374m\222\335"
+	.ascii	"\366\253\n8\261\331\3766k\213\371"
+	.string	"\333\255\275\36625Z&K\266\332\337^\3550-\225\235\026\266\301\374\255\230\215\366\267a\366\227\237\025\332g\177[\202m\366\357\262v\312\222\355E\r\376\352\315\337\356\370\333!\177+\365\037\001\007\370{P\376_\360\277\003\273\313\277\261\374[l\207\3757;\212\377r\252\376/\343\017\366\214Q\3766\305\257&\367\327\337\202`{\375\275,w\177\340\024$v\305\337\203\362\267\031\370\333\244\177O\371\177\301\317j\360\263&\370\377\373\201k\376-\345\337]\377\346\3727\364\337N\376]\365\357$\377F\362\357\250\177\027\371w\220\177C\375\373\307\277\233\376\315\364\357\245\177+\375\273\350\337D\377\036\372\267\320\277\201\376\035\377\033\005\377v\361o\026\377\366\371\367\b\376\315\3747\317\277\223\377~\377\035\202\177\237\370\367\n\377V\341\337$\376}\302\277I\370\367\004\376\375\200\1777\340\337#\374\373\203\177w\3707\007\3776\300\277\007\360\357"
+	.string	"\374\333\202\177g\370\367\205\177\023\377\275\377\235\377\026\357o\357\376v\315\337\326\375m\334\337\242\371\3331\177\313\366\267j\177+\366\267U\376\326\353o\271\376\026\372\267Z\177\213\365\267M\376\226\311\337R\375\355\221\277u\372\333\244\277E\372\333\243\277-\372\333\027\177k\202\277e\361\267\316\277e\376-\317\337\356\374\355\361oC\360\267\034\370[\r\374-\212\277-\361\267'\374m\210\277\225\300\337B\340o\035\360\267\"\374\355\007\177\333\341o9\374\355\001\376\226"
+	.ascii	"\177\213\301\337\002\340o+\370\333\234\277\035\376\355\357o\333"
+	.ascii	"\277\355\375\355\372\267\352\317\346\375l\233\237\265\373\331"
+	.ascii	"5?\253\346g\347~6\356g\337~\266\314\317\262\375,\230\237\355"
+	.ascii	"\362\263Y~v\354g\305~\326\312\317z\375l\327\317B\1776\353"
+	.string	"g\261~\326\352g\227\374l\222\237E\362\263E~v\310\317>\375\254\323\317\366\370\331\035?\273\364\263J?\233\364\2636~\326\350gk\374,\215\237\225\361\2631~\366\305\317\002\375\254\t~v\305\317\302?\313\363\263\307\2375\376\275\261\277\207\365\263\034\370\331\r\374l\006~\026\003\277\232\201\237=\361\337\355g/\360\347\r~\326\002?[\201\237\245\300\317\242\360\263%\374,\t?\033\342g%\360\367\226\374\354\003~\326\001?\313\200\237\325\340\357\205\371{`\376\036\332\257&\377^\226\377e\376k\370/\367\337\353\357\221\375='\177\357\352\3571\371{T\177\017\311\337;\362\367\214\374=\"\177O\310\337\003\362\367\236\376\236\323\3373\372{5\376\336\212\277\327\302\337\023\301\337\333\340\357e\370{\354\257\345~M\366k,\277\366\372\365\325\257}~\255\374\365\007~]\342\327\026\370\365\002~-\302\257C\3705\b\277\276\340\327"
+	.string	"\370\3274\377\232\345_\271\376\265\352\177\230\177]\372W\035\177\276\373s\233?\227\3759\372\347\254?+\371\263\220?\373\374\271\347\317<\177^\341\317\026\3703\004\376\274\341\317\003\3703\006\377U\370s\206_]\376\352\373\253\310_=\376j\b~U\003\277\232\302\257\222\370\177\342W\035\360\253\037~\325\303\1773\377\327\376\253\215\375\307\362_\354W/\3747\373\037\314\313\313\313\3735(\340\007\201\346o\022#A\373G\314\214W\326\027\361b_\315b\223\335\3244\257\021Ye\323\337\032\263g\034\207\371\377\313\003\376"
+	.ascii	"\201~xj\024\030\377\356\200\361\257\315o\215\232\3465\002\355"
+	.ascii	"L\032\307a\200\361\317\356\307\365\203\001TIM\2264\232$[`>}\022"
+	.ascii	"\300\354\2230\266OB\225}\022\244l\225\210\231\030\273\254O\002"
+	.ascii	"\224}\022\254~u\372\005\031\t>\350\346X5\255X\212\334\177sH\256"
+	.ascii	"\204\001\222\365/N\375\372\345]9\323BB\322\017N\r\023\346\214"
+	.ascii	"\226\254\037\002\357\367\366;\363\363!\346\212\217\237\231\377"
+	.ascii	"\316\b\233Py\211\263\376\271\375\310h5TC\250d\375+\243~\345\241"
+	.ascii	"\271q\311\3727\346G\206\212\2144'2-\326\f-\272\260\254\177m\352"
+	.ascii	"\027U\222\025*Y\377\330z?\377\335L%F\246\343o\\\214@\241e\375"
+	.ascii	"\020q\373!\324v\2300?\264\257Bq\217\260g\034/m"
+	.string	"X\205\3005\361\310\372!\302\366\377K\373\241\3558 oj~[\276\345\207\246r\305F\026<\211\266\330L\343xi\303\316\322\222*\373\242F\177h>#?|\264e\375+\373\235m!WV\306\316\314X\2451\265*f\277(<\220\216le\375\272\237\227\377\356o\b\22211\274tA\232\322`\002%\303Hb4\344\307\245u\002\364\303\316-\353\207`\262\377\237\226\337W\020\211\022\256\240_\226\037\331\031\037LW\262\036\033\376\264\311R#\353\207(\262\017b\313\314\323\256\n\2344\216\241?\260\037\364\367uA\320P\nVnR\260\337\023u\356'\366\263\362\273\362\303\362\013S\243?\260\037\025\270\037\330O\253,\311\b\226\313\025$\257\fP?D\320\376\004\324x\251\221\265\311\372\023\220\356\377?)\277\250\032\375M\371E\321\240fu\375\270\264\236q\f\375M\371A\371q\2150M\0222\246\203\242\2249c\365'"
+	.string	"\266?\001)\373\377q\255}!\n\312\372\023\340\332\237\300\223\375\t`\355O`\311\376\004\220\354\377\227\365s\242s\004\214\032+\255-d\260\256\334/YbpV\377]\315Y1\362\004H\326\277&\037\376\263\nv\031\"\315z"
+	.ascii	"\277*&\2771R\316\276\226\374\307\344\300+_\242B\262\3163>\374"
+	.ascii	"\267D\003IcD\245\344G%\264\312\241\305k\352?\252\377\367\374"
+	.ascii	"%Q\323\202R\242@b\262V\211\250\030X\fj\016\3333\363\341\277\251"
+	.ascii	"\215\267\245\250\210\224\353\306$\307\003\312\017\311\357\310"
+	.ascii	"\312\244H\316\355\367\"H\227\332/\352gd\207\001\245YA\243Te\364"
+	.ascii	"+\362#\"U\022\023'\324\323\022e\2021\344'D\375\201\203M\f!Y\024"
+	.ascii	"\312Z\020 4\332\264E\321l\333\324\252\013\352\367\224\321\260"
+	.ascii	"\341\321\370=}\251Ne_\266\270\375\370\351P\"\345,G\326W\363\222"
+	.ascii	"\212\274\224n\330h\302A\364\323\361\3131$\375\351\370!-Iz\332"
+	.ascii	"2\375\361\3701\375z\374\234~M?\037\277\035j\364\247\343\267\264"
+	.ascii	"\246\331\032\223\022\365'\020c\177\002@\373\022\270\333\227\300"
+	.ascii	"t_\002r\373\022p\333\227\200\332\276\004\314\366\377;\372\031"
+	.ascii	"\375\214\376+\372\311@3DL\217\254\257\322\255\001#\305k3%#\375"
+	.ascii	"\315\370\325\370\t\375^\374\206~4~D\277\030\277\240\037\f5\372"
+	.ascii	"\223\361\003j\343\273;\363\312k\305\200\370\361\331}\311\372"
+	.ascii	"\311\360\261A\373"
+	.string	"\311\370\305O#\2734Vle\314\020U\240/\201\"\373\022h\332\227"
+	.string	"\321~\004\362\366#\200f?\002h\373\021\020\333\217\300\223\375\bL\355G"
+	.ascii	"j?\0029\366\357S3\347\0069a\331e}\020R3s>\2707)\2323r\276:\037"
+	.ascii	"\235/\215\032\365\315\371\342|s\276\267\337\031\221TS\257\312"
+	.ascii	"\216\270\310\247\037\001\032\373\020X\263\017\001\264}\bh\355"
+	.ascii	"C@\307\376}g\362\235\317\214"
+	.string	"\217\313\032\270\237\037Y?\004$\\Y\317\350\224\324\363M\212\325\303h\314\235\325\220\2464J@\\%9\323\006\272\365\\\002F\ng\265\346\311\327\323nK\313\210\235\324\211]\225\2314\314'\346[\363U\361i\361\225\371\276|X|n\2766\337\030\037\233/\315\007\346S\363\241\371\250\370\272\370\310|_|a|b|^|c\276-\2763\237\231\017\214\317\212\257\214/\213\357\212\217\214\032\365q\361I\271o\212\317\353\203\226\222\321\230;\253\254\"KFc\356\246Q\340\232\224I\3438\316\362:\"g4\346\316JK\210\2214\216\241\354\021\337\323h\314\235U\027\025\024\2431wS:\">&\2431wS\037\027\037\0234\251\026\027_\224\372u\301\2138v\352\321\322\031\215\271\233\3061\224\203\224\271\254\027#\364z\244b`?Ps\330? n\377\001m\373\017\210\356?\200\311\376\003\240\366\037@c\337\001m\366\035"
+	.string	"\267\357"
+	.string	"\265}\007\214\355;"
+	.string	"\312\276\003\216\354;\340\306~\003\360\366\033\300\266\337"
+	.string	"-\373\r\230\262\337"
+	.string	"&\373\rx\332o\300\321>\003\332\3543\200m\237\001d\373\fp\262\317\200\250}\006,\3553@h\177\204\271\375\021\300\354\2170\266?\202\224\375\021\234\354\217\260d\377\276 > \277\250\223(6\037\224\357\311\347\344\373\341\363\241F}@|=\316n\251m\256\352 {\232[\2322\351hb3\332\301\266\344\003\342\343\201Emni\332R\251\032\363\003\250?\302\217\375\021\226\366G\240\261\277\2005\373\013\020\263\277\200\260\375\373\226|6~of~\212\210<\363\210\214\330\321\210\222\372l\370\206\244\244t2\220<g\034\361%\371n\370\220|8|J\276#_\0165\352\263\3413\362\331\360\325\320\2024\2674\215ch\333\005G\003\013Q\177\001O\366\0270\265\277"
+	.ascii	"\037\373\013\300\261\277\200\237}\021\352\366E \263/B\227\375"
+	.ascii	"\373b\270yelDY_m\303\006\353\271f%2\365\264\263\372\340\346\271"
+	.ascii	"i\334\251\360\207\030\307PYT\240\256\362\334;))\236\017\310\367"
+	.ascii	"\302\007\303\367\343\013\362\t\371b5\352\346\271m\334<\227\216"
+	.ascii	"M\321\234t\032\307\320\237\0266@kp\364E\030\262/\202\217}\021"
+	.ascii	"\222\366E\030\332\027!\336\277\253\346\356\364w\353\324\267\022"
+	.ascii	"k\250\262\262n\277>\334U3d"
+	.string	"\207\225\365C\210\333?0\373w\347\3348\245\2566I\262\216s\273\270fV(G\026\b\272C\343J]95\352\306\271g\356\276\271pq\356\2266q\256\026<\251\317m\215\215\220\255Y'\025\003{1!\210\231\371\263\234\313\305u\313\006\b\322FM\326eX/G\3221Y?\004\2556\227\315]s\325\3341\256\0305\352\222q\323\\2\356\231\213\266B9\332aAg\244a\246O:/h\244q\fu\311\270`\314H\323\224\301\271d\\\263\262\"3LV\034\206mj\274\274\b\365C\250\261\017\002\233}\020\336\266\373E\355\232R\304.\353\203\260e\037\204*\373 \\\355\2030d\037\204\243}\020\2046\013\002n\037\304\227\375\273Y\\2-6\336\342\\\262\377\202\210y\271cw\261X\245\001\315e-\006\205NI\215\242\270W\\05\352\206\271U\254\200q\303\\*jk\303\037Tl8X}\020O\366A"
+	.string	"\331\007\341c\377\356\227\033E,v\322\226\365A@\255\264\321\n{\346=\271\022\305\335\002\313\352\362t\271\334.w\212+\305\215\272^j\324\215\342B\371\020\305uBU\204\205d\245\356Hr\004\215P\377\003\351\376\007h\373\037p\355\177\240d\377\003\247\375\017h\354\177\230\356\337\305R\203\344\3248\345\231y\302\271/\316\332\334i\355)\033\025\316\rB{jm\273\032V\244ym\264\224\232\266\364"
+	.string	"\2537\027\211[\3452\271S\356\022\267\211K\345\362p\257\334\035n\017\267\210\313\304=\342Z\271>\334\247\353\344J\271P\256\021w\210\253\304\005\342>\271?\\\"n\224\033\304mr\205\250Q7\211\233\343\356\222\253\3439F\231\326f3\315\223\321E\252\306N\350\013\222:\267\025\302\225\247\n\007\244\316\201\261\321\212\361\002{\272I\\\034\256\222p\215c Y\317\033O\236E\352\\\225\031\037\\#*G\255\230/\251\027i\034Ca\250sf\322\2372R<7IK\313M\342\306n\222\275F\225+\232Z\262\212c\250\332\266\006F\216\t\350\234\246b`\025\240\346\260\377\340e\273J\352\\\253$\257H.\353\177 \333\377"
+	.string	"e\377\303\324\376\007 \373\037\202\366=p\333\367\240\313\276\007Y\373\036L\355{"
+	.string	"d\337\203\245}\017\220\366=\220\261\357A\274\357A\272\357\241\313\276\007\350\276\007$\373\036\234\366=\304\330\357`\267\337\001\315~\0070\373\035\276\366;h\355w\210\332\357`c\277\003\271\375\016\312\366;\340\332\357 \310\376w\232M\207FEN+\353\253^p\273n\317m95\272\351v\\\bh\362\013\035\354\224\210\315\331t\323mi\032\"6g=.@\240Xm\375\016r\354wPc_\001k\366\025\020f\377\373m\267a\211\202SC\333i76`\362\303\246j\272\325\224`aS5m\333a\342\370\206\002\224\304\261\251\232\266m1;\332\366Z\306S\323\274b $\017\224@aS\225f\267\3455J\302\260\251\232\3563\333m\217\331f6\231]F\215\356\266\315\306\272\231\221\363!\324W@\225}\005@\367\025P\265\257\200\"\373\n\370\261\301X"
+	.ascii	"4k\243\022g}\005\324\330\347\200\315\376\367\227}\246\245M\227"
+	.ascii	"1\263]\246F\367\331\366BdsY\241b;\f\252Hz\326{\356.B b,\004U"
+	.ascii	"\343\031\307\261\005\0348\370\344\2140\261\372\034\264\355.\252"
+	.ascii	"\233\352\224\341w#\255\214\216\254\267\fqb\342#\353spe_\3652"
+	.ascii	"\"\343\251e\223\251\321\235e\217\355,\037~\330TY\255k\272\276"
+	.ascii	"HY}\016\260\366\277\261\210"
+	.string	"\271]u\311z\213]\235c!\303\212d%\n\223\260+C\251/Zo`\373k[\331U6\0255\272\257l\257+\373\352K\352d\353\231\265\257l\255=e\205rD\2015-\351\276\262\261\274\2442\336\274\b\001\3659 \"\005Xc\352N.\353s\300\264\377\357\256\315\265\243\250\321\035\335\320,(W\317\255\fejG\367\223\f\305J\252V\021r\204n\353s\240\264\317\301\320>\007B\373\034\304\373\034\356\3669H\3679\254\355s@\333\347\300e\377\333\312\251\t\220\252Md3\331K\332\266\272(j\233j'\331S\373\271\225\250\321\275dK\351\250\215\304h/\331=vH}\354\2475\246\274!\333H\320R\326\222\r\265\205\\ #\216\237\220\260T5\252\222\246>\266,Qk@}\016UM\373\b\324\022'\036Y\237\003\221}\016>\210\354\"\033I\364LJ\326\347\220D\204\003\r ;\210\316\222/\256\254\237"
+	.ascii	"\273\rD\272\177\364\304x\231\242%\353'@m;%\300\313~\002\242\354"
+	.ascii	"\177\363\330"
+	.string	"M\273\351{\307\326\201\305HH\232\254\017b\353\330E\252\233\232Fd\002Xe\226\266\215\235c\343\330H;i\337\330J\373h3\251\321\255c\033\351h\247\373\205\232FD\247\261\223\246\305h\305\254\311\"\032\232\322\315\200KCC\235{\223\261ul\030\255\0306\3228\206n\035\273F\306\373\325H\202\247!\250\343\212\207\230\n\364\023\240d?\001P\373\t\320\261\237"
+	.ascii	"\242\375\004\304\373\033\342\3667\204\331\3370\266\277A\312\376"
+	.ascii	"\206\253\275\205X)6"
+	.string	"6Z\262\376\006\250Md\307j\032\021\215g&\335A\373G\215n\240v\315\006\022\366\342\030\250\354\371\363\001\304\206\fV\347\255S/bU\262\376\006\031`\317\"W\3326-^k\247F\333\273\226\315]/Ju\013a\211(\257j\332K#]\023\267\365\021\020\266\217\200\253}\004$\331\177\253\346\355\034\221.'yY{\001\373Pf\345\231\307%L\332\322\265qm\232\266\256\225S\243\355\\\213\246\235\313\323\026n\205\212U J\025\351\\\333E\205k\347\332-O\"6g\255\324\007\227\220P\037\001C\373\255-\3633]\313\372\007P\263\257\346}!\323\326\252\265l\302\037b,\024u{\376\240\201\361\002\303\206\326\326\236\225\221\266mmZ\f\3643\202\331\030\325tj\246%\323\236i\335\3322\355\0305\332\266\265a\336\232\365\320\236\347dL\271\b[61,\304\261\327\222\020\221R\326\355\232V\372\022D*\353\037"
+	.string	"\315\376\001\310\354\037\200\313\376\001\250\354\037\340j\377"
+	.string	"C\366\017\260\264\177\200\031[\250\346\2607\300\334\276\001\306\354\033\300l\337"
+	.string	"b\373\006\200\262\377VK\233E\313\027\227\237\254\311\206_\330\210\256\262\276\001\246\366C"
+	.string	"C\"%r\344\031\315\222fQy\362\264\003k\273\264\244a\355\225V\254\265\322Vi\307Z,j\264\005k\275\336~\251tR\326\256\300\332)\352\334\005Aq\334\203\007+%r{2\215c\350\n\206\366\242\fQ\177\203\274\355Ss\330o\360\266\277A\331\376\006]\373\033,\331\337"
+	.string	"j\377m\224\226\253\353\214\223)YC\201\n\005\313\332$-e\375\rx<i\265\332-5\332B['W-\026\3263\216\273\016\242\205\266Y-\226\232\266\364\200-Y\3228\356j\241\255\225\252\266A\032\242-6\3014\035Nvl\375\002\304\355\027\300\31462\212r\312\372\005`\333/\300\227&UI I\256\262fb\345\214\027\254\251\254_\200(\373 \212\264G\240\320\250Z\"`\236m\222\366\331N\265J\332%j\264\245j\221X\221j\217@\271I[\252vG\333\003\252\214\264\rU\353\243\035\262B\237\233F\020\031)\007\016\034\330(;\326\300\200\372\005\300\332/\200\223\2216\312ub\212\002\224\365\013\260d\244"
+	.string	"6\366\013\360#\004\250\304\025\247\224\365\t \267\377\267@Z(5\332\006i\177<\255\225\201h\203\264NN\216\360\254zQ\254n\344\261\372\004p\333'\200\331>\001\260\354\023\240J\313#\337\201\031\223$\353\023`\253m\""
+	.ascii	"\223\375\267L\255\216,4\260\230\262\376[\035m\214\271\037S0\262"
+	.ascii	"\3163\"C*\347\243\211G\217<\244\253#y\322\2610\251\234\022\222"
+	.ascii	"\347\032\243\031_\322\241*O&f\332\364\340\361\266\024\365D\202"
+	.ascii	"\367\314rM"
+	.string	">\344t\030y\346<\"4X7\266M\013\324\376\264B\354\032K\206\315k\215X\272\366\210Mk\203\3302\266Kk\203\025\303J[\034l\230\366\005\313\246Eb\345Z\242V\006\213\206\235\2663Z\245\266F\233\203Uc\307\260^X3\254\035\213\307\252a\343\332!\366L\273\304\202i\223Z\032,\032;\327\302`\313\260i\332\230]\323\026\261u,\034\373\306~a\271\260w,\033\333\306\236\2657X35\332\306`\263\234\325\302nQ\255<\355\2624iJ\332\313\023\n{J\211\266\236= /\275\274 \266.\252\025%Pp\275\030V\236A\212\244\275\274\237\262g\326\227\234\007\304\350)\207CJ\272D\235\223\333AD*\244\206\224\n\r[\365\257HM\334\262T\006\025+Swr9\216<s\336\020\242,\265\201\365\224c*\362\\\221\254\240\312\254HWd\362\212\344<\250\350R//\326R/\314T+I\330\300"
+	.string	"\223\376`\022\363\322\306`\237\260a+T\354\204 3\351\221\223g/\357\305\025\251\234\323\213\035\317,\275\021\265z\243\341\245Z\211\032R\255H\265\221\256HX`\236X\324\257.dQ\256\244\251\361D\212\366\347\2746\006\373\244C*-\322z\256Hm\f\326\t\3323\216\241\034zSj\262\230\251Bz\317Ps\330\023\200\310>\001t\354\023`h_\2035\373\032\264\355\237\205\236\r\373W$V\213\275\342\312I\241\t\312\032,\007\255\310pc\223\3655"
+	.string	"\263\377\263T\330/\326\213\255\302NQ\243\254\0256\232C\210\322\364\264\223\342C\312Za\241\364\220r\361"
+	.string	"\301Za\273\330*\"\251&\253\235C\032\024\003\250\257A\224}\r\262\3665\300\332\327\300j_\203\252}\r\226lv\353\303Y(\031\033Xpd\335Ss\330k\360\334\253\006=\3665\200\261\237\001\233\375\f\314\354gP\266\237\001\225\375\251\212\201}\006\320\375\f\244\3663`\332\317\340g\177"
+	.string	"q\373\003(\333\037@t\177"
+	.string	"U\373\003\220\332\037@\220\375\0010\355\017\200h\037\203\273}\f\312\354c`\266\217\301\327>\006X\373\030\024\331\307`i_"
+	.string	"y\373\002\240\333\027"
+	.string	"\231}\001\220\355\013`k_"
+	.string	"Q\373\002\300\261/\200\237\375\013\336\366/\360\262\177\001\327\376\005Q\373\027$\355_ \264\037\2005\373\001\030\263\037"
+	.string	",\373\001\340\332\017\200\222\375"
+	.string	"\360\330\017@\321>"
+	.string	"\332\354\003\300m\037"
+	.string	"h\373"
+	.string	"\210\356\003"
+	.string	"\311>"
+	.ascii	"v\354\003\340g\337\002\351\276\005h\373\026H\331\267@\311\276"
+	.ascii	"\005=\366-\240\261\257an\253q\017\257\315v2C\216\250\315\335"
+	.ascii	"\2242\\EY\333\365\302\324\214\304e}\r`\366A\224\361\362<3\223"
+	.ascii	"\246\367\305M\332\206\246\267\246"
+	.string	"7\355\315\365\342zr\275\272\036]OMO\332\203\353\261Q\243\2754=\267\367\314\364\316\244YC\353\245\351\261\365\304\b\3278\006\372\322C\003S\346\251\006\246\227\026\206\314s\214\231\n\367v\246\227\246G\006\n\212n:\304!\024\345\002\200\276\006\250\255:\251\030\330\013j\016{\rF\373\032b\354g\300\333\3170\267\237\301\314~\0061=1W\347XhN\351\220\222\3653\240\355g\330\262\237\341\312>\031)\373R\025\003\373\fM\3663@\231m\2513\2323\222\365U\273)\275\260\025\372\3343\326\206\244X\360\236\275-=\261\2741\365\253MY\257K\317K\217KO\213\032\355m\351e\361\352m\351\221\335I\343\030\252\226\021\345I\201\372\031r\354g8\332\317 c\277\2026\373\025\300\355+<\322\240UY\277\202\264}\020^h\236Uz`j\264g\245\367\245B\343\236\225\036\025\2406<\253\n\364P\222\203\325\257"
+	.ascii	"m\277\002\261\375\n\300\366+\200\262\377\236\224s1\351\022\366"
+	.ascii	"\223\365A\260e=\267\3249\020\270\214\315-M{\\\275'\\\324\346"
+	.ascii	"\226\246Qz]\275\250\032\355q\365\240\004\311\214]-\331\372\025"
+	.ascii	"\340\330\307\220\267\217\341m\037\303\226\375\367\264zY+\r(q"
+	.ascii	"W\017\253w\325s\242F{Y=\253&XL\262zY\275\252!Tf\306\246\034\366"
+	.ascii	"\025\335\027([\037\203\323>\206\244"
+	.ascii	"}\f1\366/\334\355\277\267\204\212\312s\356J\326DzRRhR%\275$j"
+	.ascii	"\264G\325\243\352=\327#5\215\210\306\352\242\251L\241\312X\375"
+	.ascii	"\013\323}\325\313\310\331\263\207\2447\325;\242F{R/\242\272}"
+	.ascii	"yJ\365\242T7_\024U\033\036\207\346\223 v[\377B\331\376\205,\373"
+	.ascii	"\027\304\366/|\355\2777\204\216\fW\226\254{@z;\202\314 \352!"
+	.ascii	"\325\350A\365\234z=z?zAz>zO=!j\264\007D\333\275\327\324\343\241"
+	.ascii	"\346ol:\244= =&\365+J\003F\217F\220\242\251^3\002\214#7\006\333"
+	.ascii	"R\357FOG\224\350\031\307\320\036\020\315\246\367\002*\003,rk"
+	.ascii	"e\300\251#IJ8z\205\252\030\330\021\324\034\366\027\210\354_`"
+	.ascii	"\312\321[Rj\215\224\211Q\226\365/\304\310\321S\332\3212\344\205"
+	.ascii	"\343=%\365kX\244\206\226\224u/\251\235\352\341$k\356\277\333"
+	.ascii	"\203Js&\314\356\250g\303(7irz#s\3243\232\021#\353\236\321z\205"
+	.ascii	"\206\316\256WC\350l\210[\r}\367\324\006\352\324EFo\306\320\017"
+	.ascii	"\256m\b\255KFo\350\247\255\t(\353\336P\017G\216\034T\262V\322"
+	.ascii	"\023\312\253\362\226\365s\234\366\325h/\250\007\204\204%\311"
+	.ascii	"*\353\036P\357'\207Q\216!\275\030\b\244t%L\326\317\311\261_\247"
+	.ascii	"\361\376\273\30232`B\360\332\224}Q\271b\235\356\310\244\321w"
+	.ascii	"\332N\223E\317\256\262~\316\213}\234\2725\352W\216\027vU\262"
+	.ascii	">N\231}\0340\373\327i\352\240NWm\344\256\353~=\247\351T\267\027"
+	.ascii	"p5\330d\235\235T\f\354\006j\016\253\177|\270\226\023\332\270"
+	.ascii	"\212R\211\223v@\206D\b\232k\351\303\262\023\313\306dEH\326:\312"
+	.ascii	"\207k4\030\200i\301\242\341\364[\333\215<*Y\3533z\215T\206\\"
+	.ascii	"\326\307\t\333\007\221\345a+\224\243\n`\260Y\221\3522Z\213^\243"
+	.ascii	"\362\300\013\025\325\224\214\036\243\331t\2336\243\335\324\250"
+	.ascii	".\243UF\213Y\225\300\210vI\203E\216j:U\341\312h\262\207\251i"
+	.ascii	"^\361\013(\n\3602F5\235\306q\\F\217yQ\243\232NU0r8\344\204\372"
+	.ascii	"8V\264Z\326\202\346H[\326\307\321\002\243\323\324\250\016\363"
+	.ascii	"-\332\313\b0\216\334\242\027O\244:\214.\323hO\033\270\310QM\247"
+	.ascii	">6efXX\375k4\375%l+IK\326\372\354G\224\204\314F\326\3079\322"
+	.ascii	"f8D\373\327^\256\273TY\272\243\241\271\244\r{A\242?\246Y\037"
+	.ascii	"'h\377&o\377F\315\376\315\231\375\233\264\375\233\261\375\033"
+	.ascii	"*\373\327b\371\205\223-P^aW\304\200\210\274\310\032\f(\206\211"
+	.ascii	"\016K\326\277\321\332W\355\272\274\236[ZI\236<\333<\267\240\250"
+	.ascii	"sPX\332\212\376\322Tt\025-EG\265\227\032\325S4\327u\024u\215"
+	.ascii	"\021-\265B\237\355\224\240,i\034\307z\212\206:y\3061\324-\212"
+	.ascii	"\002\005\021\365o\256v\253\346\260\2779\262\177\323c\377\006"
+	.ascii	"i\377\206\350\211V\n'1\225\254\263|^\326`$e}b\336\276\2325uF"
+	.ascii	"\332DSe\267\025\312\321\236\022\245\2144\211\333\323N7\321O\325"
+	.ascii	"\r\312\214\224\211\256\322N\264\225\276\322XjT7\321J\350\214"
+	.ascii	"h\251\267\267\377C\023\275DKy\240\2456Di\032\307q\373\304\006"
+	.ascii	"]\030\241>Ql\237\030e\237\250d\2378\265O\214\332'\002\331:J\037"
+	.ascii	"Q\243\0324\222\241\252\026T\324\024w`g\302\273\265\250\t\232"
+	.ascii	"\030f@\255!\030\2566q7e^T0\264X!#\273\3512\245\200&Nni\262\374"
+	.ascii	"\246\313\r\027h\333\263\355\206\313\315\226*\2652x[\332\350\025"
+	.ascii	"\034\225\033-Y\214\213\214,R\254\366p\351\311\264\344c\b\004"
+	.ascii	"\306\f(\254\254o\252\334T\271\t;\016P\224O\332\344\306f\032/"
+	.ascii	"%m\370o\256\374&\254\007\343\f\235Z\3267`\327b\367\265%&\353"
+	.ascii	"\033+\357\215\375\337P\021\256\221\321\241\211\335|\t\321\322"
+	.ascii	"\360\230\312\372j\364\306K\310\345K\007\021\250\254o\244\334"
+	.ascii	"H!\332b\263\346\310"
+	.string	"\002\315\313\372/PW\227\334\323\021\f(&Kq\\\\D0\rN+\0322(:\2530.2\261\254\217\354\242\245u\003=#\222jRm\240\221S\332\372\r\364\311\227\225\325\215\023\rN+\2329(:+w.\350k\013\326o\234h1v3\302\262\276\271R\347\314\2401\033CR\335(\271QrSE\327\244\306&K\025\0317L~S\005\227\341\252\214\271\312\372f\211^\303\016a\265\221\202\244q3u3u\223$)\037iY\372q\363\374M\222lFN\253.\r\022$\036\340\232[\352Q\031J\033s\023u\023%\344b\201U\323\0231\031ce\260l\r\031rSD\203\323\217\032_\017\"6gS\260/wl\210\374\246H\330\317\213\2270$G\"7An\202\224\021\2619\233\262Mxl\351\302\004\005%\34426D\tHGV&L\326?\276\270\351q\323\343\346\307\214\247/\357L\333\223\323o~"
+	.ascii	"\311 \201\361\360\341[;\372r\347\34376\352\214\236uMMh\270~U"
+	.ascii	"\222\264\216\23411\t\271\370\306T-vVI\262~\n+7K7K7J*\021\032"
+	.ascii	"4&\352\030G$\205\326\315\321\315\321\215\222\260\013\221TS\264"
+	.ascii	"M\027 \034\277QBR75\222\365\353n\222\320\230\220\310$\335\334"
+	.ascii	" \203\243H*\353\033$\022oZ\\\262~\212\347\276\261\301fY\313\220"
+	.ascii	"t\231{**\022r\321\340\264\276\251=\035\tE1A\311\372)\224nf\334"
+	.ascii	"\314\270!R\271b\243\037\223\321\230;+%d\342\270\320\370\r\221"
+	.ascii	".r\006\207\231\374\0028\003\211\254G\326O\361\003\003\306\315"
+	.ascii	"\220\312\025\033\205\020\307\246\n\007(\310\363&\306o\206\276"
+	.ascii	"\030Q\322e,s#t#$\3442\225\002\263\fU\361\370\002\004D\224\322"
+	.ascii	"\340\264\276\311=\035\t\235x9\2111v\023\337\304D\251\326\252"
+	.ascii	"hNZ&m\b\232\254o\314\262\263#\342=\213\346\244j\360\216\314\332"
+	.ascii	"\234\210\247e\230\365\374b\313\232xw-\255\031\032\224\017#\220"
+	.ascii	"5k\210u\254\022\016<*+$,\321\254oDR\243F\310\245\352\247\343"
+	.ascii	"\013\026'Y\337H\2038G\234#\326\261K8\360\250\254|KgW\310\020"
+	.ascii	"\351N\254\313\013\023=\003\216\001\225<\275\230\313\372,\250"
+	.ascii	"\211\213#\202uQj\273\263\252\262\013\252\313\372,t!\242!\242"
+	.ascii	"\021r1z:m\321x\3622c\206\370\246\301\351'\r\313\224c\212\316"
+	.ascii	"\314\255\256\350\314\211ok[md\264\306\214!\226\311J\0222\246"
+	.ascii	"B\265\035M!\2229\261L\224\327\024K\222\2644\"\033\022\037V\221"
+	.ascii	"\031&\375\306\025W\027\346D61\372\td\032C\314\211kgVh\260\225"
+	.ascii	"\t\202\347\005\215\232\233\026\200\267!0\034ZN\344\242\205\210"
+	.ascii	"\266\266\251\320x\311\351'\216\001v?(4\240\204);\021\355\304"
+	.ascii	"/\037\204\360\267mU\325\006\2245\221hF\364\362\267%oDqY\023\273"
+	.ascii	"\\\313\322\230\351\220a\230\025\rj-(k\342\026w\254G\220\247\254"
+	.ascii	"\337Ri\333\361,\302\202\205H\246\301\351'.\001XIB\306\206gC\246"
+	.ascii	"\216\306N$\013>\201\250]a\001\210\030F\fK\312KS\276\220d\375"
+	.ascii	"\342\\\225*D0\r^\344\326\312\324\"Mk\214XQ\243D0'c\320\034d\276"
+	.ascii	"\276.\244a\315P\271\r\311\372\305\261\256.\342\024\013\272$\t"
+	.ascii	"\031\353UUQ"
+	.string	"\241I9q\n\334\235\024j\22651\n\004\243NABrF\n\027\027\tr(\241\263r\261\320\206\374\270z\362\204\bU\271b#\023\344PBg%\334\322R\203\264u\"\264\325*r\364\314\372u\332i\352%\305\312\220\254,\024"
+	.string	"I\202\304\226\365\213FXXD\251\244\034J\350\246VSS\232\262~1&.!.!Z=\031^\311A\205F\223\023\255\340\260t|\321\2215\261\n\bF\365q'\205\2245\221\311\337d\374\314\240\021\2029\342\223\370$R-\345PBg\245\262\t\305\035%9\221J\313*M\322\217\213+\253n\253\r\t\022\242\224\312\205A\016%tK\2772-\\\334\244\222(\201\"\312\372!\320\262\211C\210C\210Q\030\230\202E\240]ZD#'Fi\311MP\300\220\020\213l\035\317%4\210E\210Dv\264\210n\t\221H>s\264\225\005\013\312\217\037\304 *Wl\324\016)\002#\3134\3678k\033C|:1\b\021H\2175\251\254\254\211PC.u>\304\262~\b\230\354\327e\310\213\212\221\365C"
+	.string	"\204\310\203\310\203\350\243\275\303\201G\265b\311h\363A\354q\242\217\272h\332\223\0204\021w\020w\f\265\360~f\266\310"
+	.string	"\223\365C"
+	.string	"D\324A\3241\324J\302\365t4\335\nks\312\372 H#*\021\225\2109\244\330&\034xT+\021\216,Kr"
+	.string	"\307\340\320\300\224e}\020P!\"\021\221\210I\277%Fc\356\272\272\334\311\021o\234\230\004\002\0327p\200\340\311\214\023\213f\020\217\332,\032\212\344\330\345p\313\232\306CM\033t\204\37083:\361\350gl^T\354\211X\243\035\303f\306\2255\221\250\267\343\206\231%4\210\234\241\311e}\020\f\355\203\340\207(D\024\"\016ip\372\221\333`\007D5\025F\221\022RG\034\"\306\310\231Q\224\024\203\b\243n\f\0223}&\270E\351\006\224\254\211/>@G\214\2111\021\310\367$bs\246\213\200\2511\203\370s\"\020Y\332\0310aL\256\\Q\311\372\037\3702\304\033\342\r\2318\331jN\270\210e\375\017x\331\331\r\3576\230\346X[2C\316\313\235\352\246DK\215\224\254\377\201%5j\206k48\375\3041"
+	.string	"\211h\213\315\024Xe\312\344g8\375p\315\317\313\227]\234\222\254_\327\036\261zc\323\221\365? cnnX\347\253*2\303\224u\\\021r\243\373\260\256K\f\222\237\254_\347\242\375wo^\374Le}\017\314\305\305\r\265t\264TEs\322.695Y\337\003he\312\f\321hp\372\251k\221\222\236\266\274 c\0066\204\373\020\r\007XH]o\377]\f0\3512\366v\206\rS\207%\311mh\306L,I\326\367"
+	.string	"\331v\373-\371\340\221\243K\326\367@\327p\314p\314\220\355\t\321\214\255\254\357\201&b\304\f\331T\256\330\350\002\272\366\212\264\313\f6\355\024L\312\2016\315\372\036\b2\366a\227\261\241\332\320K\215\343\2458H(\356\341\003"
+	.ascii	"`r`eM\343\241\245\rA0\246+'/\037\252}\370\345\203\020\206a\202"
+	.ascii	"EZ\236\322d=D\033\202Q\2437\033\246\035:\024\216\305\3702\313"
+	.ascii	"\372\036\210\261\257\336\214M\201z3vxv\341\322\2271i\326\037"
+	.ascii	"\226\r\315~\327\247$HW\223\254\337\201\274\375\0166\227\222\r"
+	.ascii	"\033\303-\037r\371\335\337\023-0\326\262~\007\324\354a\226\017"
+	.ascii	"\265\374\256*\244(M-\353w@n\377C\262\337\005\306\035Q2\222\365"
+	.ascii	";\360\266\337\20160\260\241\030U\n\300\320\200\016\303>\024\023"
+	.ascii	"\306\220\222\301\226\365\360\n\260\312\334Z\032\265&v4\332\262"
+	.ascii	"~\007\266P\2412\254\322\001R\016%t*\217\252\347S\225\037W\027"
+	.ascii	"W\230\243\254\337\001$\303\256a\327\320\353\271\322\231\221\221"
+	.ascii	"1\345C\257S\361!\026\225\365P\n\020\f\013V\006\f+\353a\364h~"
+	.ascii	"uxNS-8\2608\371\222\365;\340\203\213k\350\001\244\26525K\312"
+	.ascii	"\2326Y\277\0039\266\266\206P&\366\231c\212n*\365\0066\006\315"
+	.ascii	"n\253[\223\264)\270\254\254\241\226\007j\034C\n\224\027\351\n"
+	.ascii	"\364\245M\021\255\271_\031\033VZe"
+	.string	"WWC,\rN?q\033\256\244mTS\036Tt`\301R\277\242\240\300\370\221\3659\3405l2l2d\242\022\241Ak`\266\234\262\204d-Y2d\242\301\351'n\003'b'h\222#\f\223\f\345\305\023\"WY\237\003O)\251!U\023\247\266<EE\364\365!\3250\t\231\335\027\245\251\341\363g6\266$/\353s\340\307\024\007l<=\r\217@\300\311-\215\006:\022\363#\352\303#YK\220\250\033Y\017\207\f\215\354\261$\244/D\206E\326#Hhbd}\016\304D\204\2543\222`\001\"$H\220J\017\033kPC zI\226'+qP\271\352k\316\316+M\351JC'\225+6\302@\214fl(wd\246\345\343C'\266\312\224\310\227\254\207;\206=\200t\301\305\310z\310\303m\252\210\222\254\277\201\260a\023\023\0244(m\3104\32415F\315I\326\303%7\257\256JK\326\337"
+	.ascii	"t\017s\344./Z>\324\246\222\222|LDl\3164\024\265+i\326\337@\217"
+	.ascii	"!\322\020I\310\245\314S\r*\273k\222\3657\200tt$\344\222E)\257"
+	.ascii	"\314\352l\315\020U\326\327\300\227a\214a\214a\221\312\025\033"
+	.ascii	"\251K\210\266\330X\375\260\322\252 \031\326\370\260\210\rT]\326"
+	.ascii	"C\242\337\331\2155K\262\262\036\322\270\226)k`P\315\240Rc\255"
+	.ascii	"\310p\306P\006Y\031\223\332p\210\013\230\232\215\254\257\201"
+	.ascii	"+\373\032\310\302\303\033\276\320\340\264\216\351\001#\213U\034"
+	.ascii	"/m\bAY\030\231\241\320\207/V,i\306|e=\f\002"
+	.string	"\206\r\231\326\302\320\310\372uC\240_\217\2404TC\240\341\217\212,)hy\303\230e\202\362\310\221\3655`D\230\247\001\035k\326\b\357\252\374\200T\351Jcw\341\235\324\032\260\264\254\205l\200`\252\312Ha\312\372u\352\327\226\222%!Y_\003DuuB5*\021\032\344VF\252\ny\"\205$\315\205j\256\345\347\364#\306tM\\\234pN\203\323O\234\001\254~6\356vT\221\273pN\235\273Q\246\306\0208!\032!\032\341\333\225\273\246L\f7477\341\233J\204\006\235\301\222\262[f\220\2519s\341\233\276\303\321\204,k\241\231+llB2\032\234~\342@H\2434G\345\3532\305\n\2151\027\222\271\300\2244(Y\013\333\200`\330\034A\244W2\260$L\023\246\t\327\254<\343\035wd\324.\\s\361\246jl\262\026\206\001\202y\321d\344L\326\257\313n\377]\026\315\350\216M\326\317"
+	.ascii	"\215-4\023\232\t\223\222\204\214\251rOW2\276\\\210\326F\241\005"
+	.ascii	"A\312Zx\006\004\243_(\271s\302@\236\027/\331\315\215\343'&\237"
+	.ascii	"T\t\356n\032\037u\341`\265+\023\222\345\312\226-B.\037\364\030"
+	.ascii	"\n\245aq\251S\243B.jK\244\250d}\fH\021\216\t\307\204Y\330:4%"
+	.ascii	"\331M\247\032\030\273\213Bva\226\303\r\357\330\210\001\312\372"
+	.ascii	"u\352U\23310\262>\006\226\b\277\204_B1\016tIvS\253xiiC\006K\210"
+	.ascii	"\244\204](\366T#\232\222\265\360\212\020l*\tXQ\326B*B0\2616h"
+	.ascii	"F\204`B+WftMc\"\2002\363EX\345Ge#\211\211\207\234\242D\021"
+	.string	"N\311\022\201\036T\214*JR.\234\342s\303\2221\225\2650*\354\302"
+	.ascii	"\214\375\013\241\b\241\214\001\207\314\205\331\310\372(\324\354"
+	.ascii	"_\270%\334R\3352W|\264B\251\355\316J=\333\342\304\224\365Ql\331"
+	.ascii	"\277PK\250\245\316ip\372\221\313\340n\230\246\212GT\326GAEh%"
+	.ascii	"\264\022:Q=\210\203\326\310\020\200\267\312\250\332\222&\353"
+	.ascii	"_\210u\241\023\340\022\243$cY\013\257PT\355_\270D\270DX\205\202"
+	.ascii	"\023\020\022\bZ\306\326\312\200:\232\210\271\t\231\264C\242H"
+	.ascii	"E\366Q\364x>\205T\033\234\342\033\t\330bd\227\246l\351\n\220"
+	.ascii	"\254\205I|Iru\320\254\217\202h\377D\335\376\205G\204G\204R=\241"
+	.ascii	"\030\350\310O\216H\252\351\b\230g4k!\222*_"
+	.string	"\242\220e\375\023e\366Ot\331\277\220\310\325\250\220\210\320\b\022_\225\321\230\273%\323 C\262\026\026\001\222\243\350(\353\237\250\262\177\342j\377B Q!\020\241\020\017\3248\276\302\306C*%\303\212\205A\202\323\037=\262d\375\023B\366O\024\355_\350$t\022>e\256\370G\003HsKVkb<]e-\374\361\334\"\001\333\"\315\372&\332\354\233\030\323\324$\354\321\023\212\201\256\332\243\2429\351tI\250MV\326B\036k\322\217&c\262\276\211-\373&\240\373\027.]\215\n\227\204L\256P\f4\345C*2\303\244\006J\230\270\254\205:T%\264'6Y\337D\222}\023<\366/\304!\304!T\322\340\024'm\320zZ+\233B\2316\r\t\225~GX\210U41\236mY\377\002\323\375\013m\bm\bolp\002\2022\200U\021\026\022\232\266\036tY\013\221\200hdD\303\262\376\005\306\354_"
+	.ascii	"\313\376\2055\2045\204F\353Q\217\255\310\213Z\326\302\242\253"
+	.ascii	"%PXY\377\002Q\366/\360\334\277P\206P\206\220\006\nN\361\215\021"
+	.ascii	"\230$aS5u\242\022\345,k\341\214\032dml\262\376\005\230\366K\344"
+	.ascii	"\305\210!\365\0243\005J\372\342\005\022u\355J\327\332\227\240"
+	.ascii	"\240#\3176Rj\240e\375\022`\373\027\376\b\177\266\230J\204\n\261"
+	.ascii	"E=\2734\265\001\362$/\317\310\223\252\312j-\353\227X\322\246"
+	.ascii	"\215:\247\022\241Al>\236q\334\205\203 \025\263\253\244\"vv\252"
+	.ascii	"[\020\036\033\353`\362\225\365K\340X\263F\375*\241\306C3\240"
+	.ascii	"\332H\367\0264Q?\262~\t\240\272\272\240\032,\037\026\360\307"
+	.ascii	"\326\223\245`\232\"8'DY\177\005\351\376\ne\346\346\324\271U("
+	.ascii	"\356A\244\225\303\201G\325\013\213\222#I\326_\001\315\325h\020"
+	.ascii	"M0\316\025\212\201\216\260Y5\252\222\264\030\262\347\221\240"
+	.ascii	"\324\007f\213\313\013\252\375\025~\2301\023|3\n\203\367$\013"
+	.ascii	"\351\270\342#\353\340\031\033jW\232\262\376\n6\366-p\267\377"
+	.ascii	"\340\0305\032\034\023,\323\023\212\201\244\332\252\337\226+X"
+	.ascii	"eY\007"
+	.string	"\311\344,B\214|\311\372\026\200\333\267\200\331\376\203a\324h0L\220\255'\024\003a\265HDnO\2047\230~\204\021\363 \333\037T\013\256\375\204\250NTi6fd\335\232}xPL^\036Y\221\254\335\247\212\201U\225\236\354?X\246F\203eA0(8\305I\033\264\304\360\254\254\314\316\244h\017\202\371\203f\301\263\037\220\354\324\346\030\203\304K\326\301/\037\036D\373U1k3\225u\216\232\303^\310\026\320\261\377\340\226-\301.\253P\f\024%\354A$\3254\215\343&\016\204Aad\b\t\363sR6\344%\310EMKk\213J\222\365-p\224%K\253c\035r\322`TOGV+\020\217\250/\274\261\261^\033\r\\1\322p\n\n\212\356\207\203\210\323Q\326WA\314\225+A\261\rN@O\036$\241\032z\311\202\345J\326\3010\261\030jNY_\205.\373*L\241B%hE\203S\214\364"
+	.ascii	"/HsKoG\322\246d\035\254\362d\n\224)\353\253`\265\257\002\220"
+	.ascii	"\375\007\245\\\215\006\245\004\2754W\374#\034\"gf,\310\013\027"
+	.ascii	"\225\340\224\271\241*d\262\276\n7\366Sh\263\377 W4\310\025\354"
+	.ascii	"\312\\\361\317\020\354\251\ro\253\341\311H\223u0\212/\254\312"
+	.ascii	"\222\215\254\237\302\230\375\024\320\366\037|r5\032|\022\204"
+	.ascii	"\256CN\361\215\rZ\344\326\312\246TH\356\314\262\016n\375\232"
+	.ascii	"\356\212\244e\375\024\254\354\247\220\265\377`V4\230\245\353"
+	.ascii	"68\305H\0310Q[+\253\032\323\361\224\365S`\262\377 V4\210\245"
+	.ascii	"\245\256P\f\324\243\025#bs\326>)\335\355\310\372)L\355?X\245"
+	.ascii	"F\203UA\253*\317\"W\272\270\004\255\376,\r6\371\031\321D\272"
+	.ascii	"\312\302\262nc\025\003\373\024l\354?\250D\215\006\225\004\227"
+	.ascii	"\240\340\024#\201\260\2054D\251\267\244%l-\270\344G$\237\261"
+	.ascii	"!\235e\375\n\254\331\177p*8\025L\202\202\023\007a\360\236X\t"
+	.ascii	"y#\233\221u\360\271fM\n4\353W`n\277\002h\366\037\214\272\032"
+	.ascii	"\rF\005\221h\256\370\247\r\303\302\246\352\n\226\226T\326\301"
+	.ascii	"#\005\270\212\002\222\365+Pf\277\002l\373\017\026Q\243\301\""
+	.ascii	"\352W\346\212\217|Ct\300\3102\215\343.\034h\265\266.9\262~\005"
+	.ascii	"\254\004\201\004\201\004\207`\001\321\343\227\203M\232\025!\017"
+	.ascii	"\016Y\225\276XY\222u0\210:\007\246\306\226\035M\236\236\200^"
+	.ascii	"J\250\361\020\031\224\226\364)\364&\315\372\025\300\261\377\240"
+	.ascii	"S4\350\004\334\222\271b\033 \304\2268\360E\201z\232\221\365)"
+	.ascii	"\240f\377A\036\321 \217`\017\017\3248\036\203\302\022*5\3511"
+	.ascii	"%\330\343?'\276\256$7\246,LL\301\035*Wl\344\2004\2674Vq\334\304"
+	.ascii	"\201\276a\306\026\246\305b!C\033\343\213\035\016\255\245\245"
+	.ascii	" >\200MNL\220()\265X*Wlt\"\355\214\003\366\247\215\315\222\254"
+	.ascii	"O\001\244\375\007o\004o\004\223T\"4\206*\363\214\343&\016\334"
+	.ascii	"4\032?\232Z,\244)g\316\262>\005\200\366\037\264\021\264\321b"
+	.ascii	"ip\372\221\033A+vK\323{+Z\373\312\372$\306\354?ht5\0324\002f"
+	.ascii	"A\301)\276\221A\222\2646\252\26689\035c5j\250f68\001=e \305\021"
+	.ascii	"%\r&\301\212\006Q\321\240\001\346s\003\213\212\177\310\220a\006"
+	.ascii	"T\023\253y\313\021#F\360\205z#\024\003\351\362\214\3433\016\202"
+	.ascii	"T\276\354\266\262>\211\032\373\017\nE\203B\301\027\353\220\023"
+	.ascii	"\020T\002\222p\f\031\233\306\361\031\007.\217 AK\320\245!\260"
+	.ascii	"'Y\037\2056<\274 P\035\006GK\033\206@\304\2041\t\376<\b4CjJX"
+	.ascii	"\326\301\270\003cmi\262\006\346U\231N\201w\303\254\347\206\037"
+	.ascii	"hw\340\235O\310\216\237, \0337-M\032/ \033\340\232\265K\221Y"
+	.ascii	"\024\320\211\251J\026/Y\037\205\255\375\003\323D\201i\324\271"
+	.ascii	"5\216{\020\361\241\035A98\nK\320\240\001\322\251q\034\307K\361"
+	.ascii	"\217\\\004\316\222\354\246Vs\007\322\001\301\302jDe\r\224S\347"
+	.ascii	"\366\0233<\272d\r\214\223\242\240\304\306\006|S=\210\203\330"
+	.ascii	"\242\034@\t\370\006<S\201\251\252\031Y\003\315\b\301^\240Y\223"
+	.ascii	"\365Q\230\261\201n@2\352W0L\0255\246\254\201c\200`\262\230#Q"
+	.ascii	"\346\262\006\266\001\301H\203\304\304e\375:\365l\313\231-Q\262"
+	.ascii	"\376\ttkk\3000;\216\343\037hl\204\363$\311njuB\227}\240\031\360"
+	.ascii	"\354\300/\377\002\fsb\034\307\0250"
+	.ascii	"%\331M\247\361\322\321\206\037\230v`\230\251\024\264\261\254"
+	.ascii	"_\007\004\363\337E\301\346\006\006\b\006\210\366{2\315\265\361"
+	.ascii	"R\nb\303%\353\237\300c\377W\237\177"
+	.string	"6\006:\212\343\030\251\007\215\217\202\200\354\257^\355\251\352\206?\250\256*\001\376\353\377\204\033\013q\\\204N\032\307\261J\267\225\204\001\355\310 \376\377g\210\343\330\306\220P\374\243\016u=\331\030\352z:\272\031:{\262\021\013\331\260\022zrR\207\204\236\216\216\204\342\237\233\270\353\351h(~\262A\214\273\342\034C]@?\352\220Pl#\216\237bb<\004d#\356\202\036\335\fu=\035\ru=\331\270\031\352\002\2621\024;\305\304!(\220\243\030\372\364sC\243\013\310F\334\345d\343&\356z\262!c\310\026\224\004\320-\t\302\003O\210\f\214\3723$\024\027\325h\002:\"\246\rA\235b2q\254z\301\210\217\342\2648&@\03479\035\221\001\312\241\212\005\245\025\005Y\001r\262\240F\020\224S,\224\366\243\306iCK\234\342xI\320N\\#\216\343\030\204\037hZ\\DM\373\001\322\024\023\301\210c"
+	.ascii	"\304\3208"
+	.string	"\256\021\307?j\234\026\307\361O\034\307\355Q\0234\216\231\210C\317\0325\342xIC\215\270\351\007\013\2148\316^nb6\206\272\240\234>`\221\322\365\214c@\177\324!\"\247\370\031\223y:\332]?Pb\2428\216\325\271\375\264qC\016:\374\211\365\370J\002vY\313\340\tM\311\372&\230m(\224\315\232\221\032\240\026\341X\0260qY\337\004\256\r$\273reF,\353\233@%\006\304\262\327\326\0041\313\372&\360\020\003\003^a!g\244,\353\233\200\004\026\206\005\037uKg\250D\201T\200^*W\374\363\373zz:\002\232\031\322\304G\326/!o\377\300/\240\227\226\2514^Y\003\247\214\331\240*\313\372%\304\355\037\330\025\005v\001\243\033\234\200\2502 \003\032\242\344\201iP\031`\324J\335\217W[\326/\301\214\t;n\220A\271\032\005B\001nmp\212\221:\270+\232Z\232\306\361\022\007\037"
+	.ascii	"\275\330\221\365K0\333?\020\n\334:\373\361\2235\360I\2231\250"
+	.ascii	"h\326/Al\207aAM\030#\244\254\177\240\223\253Q\240\023\340\225"
+	.ascii	"\206\035\013\241\221\221\306\361\022\007\356\027\266\257&Y\277"
+	.string	"\204\254\375\003\261\200Wohx\250\311\332\252\b\227\241\263\254_\002\222}\020F\300\354\200\230\345\t\t2\204H\2304\0138\005<\002D\242\246-\351%_\244E\200I\200R\300*\340\022 \023\240\022 \025\360\tl\242F\201S\300(u\rp\n\b\305\365t4\215c\350Z\226\024%\357\202\006\"IcaH\350iI\326/\201\307~\tE\373#\360\366G\234\331\037\021f\177\004\226\375\021N\366G \331\037\241\264?\"\306\376\201O\300\037\322!j\332\262\006:\035x\003\350\326q\335y\311\372\"\330\354\237\032\240\320\b0\216(\020\205\207\324\212\364\227f\004\030G\256Q\024\0371\2003\2000tH\345\2008\334\263(`\021\360F\020\221T\314\017\315\032\021)\020\307om\255H\026\020\207K\005X\243H\n\304\001|\001\024Z\241I\342\030\310\bk\225\364\204\315\024\270\003\270\004\324\001\354\001\364\001T\0026\001y"
+	.string	"s"
+	.string	"\231\324(\020\207\232\345\300\033\300\244k\220\001$\310\251\002\315\222\001\"\001mxA9\343\246\251\306\204M\001\217\200F\354\2235\"eY_\204\225}\021\321M\003H4TS\203\256\r\213\006P\006p\t\222\221T\326\027qd\003\207D"
+	.string	"\331\027\261c_\004\322\006\006\2572\205\021\366QA"
+	.string	"\031\006\200\243\341U\2460\302>*\f"
+	.ascii	"^&3@\276K\235\244s\351\003\324\340\324p\363\203\227\311\365;"
+	.ascii	"\035\234\307e\322\330t\235/Q\203\213\036\246\bd\262G\350\242"
+	.ascii	"\207y\254\340;-\232=N\025Z4o.\300\311%\t\341w:\034\233\305\243"
+	.ascii	"\n\017\307\nt\226I\023pr\231$2Q\350\004E \215L\345\205\341\t"
+	.ascii	"-\222& \227!^\330\210L*\215+48M\020\302K\022\310dO\360\3274\302"
+	.ascii	"'\234\257\362\350B\304{\342x4fx\341d\223\305O\205\025L\224(\241"
+	.ascii	"\004\244\361m\372\222\310\022\\\030U(\361\302F\245\317Qi\024"
+	.ascii	"\221\341\206E:\227>"
+	.string	"9.\232\306&\263\207\347E\201\002\003\2452D\323\370*E\f\341\367\204\357\003\020%\220\313\244\t\360\353\344yyX\021>`\340w\342\b7\205=N\025\234\276\367\2704\256@\206p:ox\232L\025K\022\031\340\367\204\223\204Sh\204\215#\200N\2403\351l\276=D$S\005\023Z8\032{r\340\342\313\223\204\215\260\362\035\321Z \002~u4\b\001\277:\030\234=\314\246\013\035\245\361\270\003\033y<\300\316%\363\330S\001/\223M%\353|O\340a\321\003lQ\002\023\005\363X\2012\304\205\357t`\3660\223Mc\006\220/l\344I\302\316\022\340W\347\006I\242\005\223\004\027$\264`\222\200\\&U\b_e\n\2432i\\\021\002n2K8y\230\313w\304\013\033M\300\357\t\027`\337\b\370=\341\b7\205M#\223\004\370\325\001\"I4\337\246\017|4\252\360Y\032U\200_\235\233\357tpV"
+	.string	"\027_\022$\235\254R\351\263\\2\227-\013fs\007f.[\025\306W\251\337\246O\217^\276\312&\354du\226\311&|b\370\235\016L\025\313d\361\250b\251\223<\001\277:\301\244\323i\002~u\332\357t\360\320\202\323\250\302\333\364\201\215\257\212_\316\215\n\360\253\363\013\001\277:\277\267\230B\370\302F\370\004\374\352\f\337\"\222\004\\$\276E$\t\030i|M\020UP*C\360\260(\321\303\204\235\304\346\21342\2250\223I\002\023\005\374:_\023\031\226&\b[0I\270\201\2137<\306\246\016\023v&Qh\301iD\001\277:D\021>\350,\223\313\244\221\3475\341|a\027$\250\360I\341\304\031\001\003H\343kB\205O\n\247\217\251bI\002i|M\f\277\323\301Y\334\300\251\263L\302\360{\242\307\311C\374"
+	.string	"\004p\004\f\274p\262\251\001\025>)\234\277\357tH\001\005\211\023\036Z82\225\"\336&S\304\020N.I\3648y\332\233\034\013\220\357w:\274M\346\261xT\241\001\251d\242\240c\344i\227$r\336b\005\360\r\234\001\306"
+	.string	"\347l"
+	.string	"c\200q`\f"
+	.ascii	"`.q\220\311\025\316\341r\347Xd\252X&W8\213'J\234 \334\021\301"
+	.ascii	"\343\263,\236(q\202\353\313yy\230(0Q$\221\305\023%N\300\201\331"
+	.ascii	"b\323\303Q\005l\204\235>\230\b_\200q.\330\300\371\362\030-\200"
+	.ascii	"L\366\354\0227\",\200\211p\016\214\001.:\233\257\322\247\004"
+	.ascii	"\f/\322\007N\302\260q\303\307&\333;\301\303\204\235\316\f\260"
+	.ascii	"\216\221g\205\217G\343Z\002id\246\260\302\250\241\307\311sA\003"
+	.ascii	"\001\27006\233!\b\320cTa\004\t&,bD\210\n\234H\022\"\234H\022"
+	.ascii	"\303\f _\270\311\354\351\361q\002\340\302w:x\320\361I\361\"{"
+	.ascii	"&\340\344\tp\223\271\343$\276<I\024/l\034\341~\247\203\007\244"
+	.ascii	"2\351\223\342\3451Z\300'\242\307\311\003\200\245\t0\223\231\342"
+	.ascii	"E2U\360\3514C\354\300I\r\300>+\b\340-\3668E|\220\001\023z\234"
+	.ascii	"<\030\220M\243\210\021'\002\360\243\013e\317k\302E\323\310\303"
+	.ascii	"\343s\302\b\033G"
+	.ascii	"`\360c\262\371._\235}\020D\350@\204\021Z\264\037\241\001\036"
+	.ascii	"4\300\003\366#4\340\303\207\006\210\360a_\204\017+\fk\200\213"
+	.ascii	"N\035\243\322\204W\231\302\350L\216\270\360\026\221$Zp\032Q\250"
+	.ascii	"8\372p\340\336\020>\221\003\017y^\330\351\302)\034\232xo^$\223"
+	.ascii	"\307\347<&ag\0226\302\360\320\311,!\302\013\033\233\030Z82\225"
+	.ascii	"G\237\236c\360hl\236\260\\\241\371\262`\366T \204\213\300\f\020"
+	.ascii	"_e\n#\212\025\354[|\221L\025\340&\263\307\367"
+	.string	"\026W\200\233\314\236\240\223\331\276\260\321\004\322\307\230b77\374\235\016E\235e\262\251L\032a\355,\352,\223M`\n\266\005\247\221G#\215\357\216n\276*T\370\220\320\002\336+\222\357\3615\241\301\327\204K\220x\225\310$\320\b\033G\264p4\246P*\215\"Z4\205\026\300Y\232P\242\005\223\204\227\004I\013\340\357th&\221\256\263\b\277-\034\215%z\234<?\370;\035T\370\244\3401\276M\330\211\001r\371\256\316\242\n\237\024N\266\t\367\254*|R\254H\236\343\352\3241*U\364\232\354w:\274<I\330\303\222\311\303\303<\302Fd\361\3274\276.\364\016\274d\362\364\\\030\221\253\263\351\303\334\3519_\330g\231\344i\235\310%\363\370:[gR\251L\362\260\337\3510\004\016\211Ag\222\271\024*\337\025\260\322XTq,2\233\306\024?d\262\347\347t\"\223=7Kf\022^\276+\336f\017"
+	.string	"20\276-\030\341\242\013#\013\343\322\247Y\200\357t`6]\350"
+	.string	"}(\336\025L\025\230M\027:\031\3600\227/\262x\\\272p\016U\364(\213A\022\354\264\360\001\210\342\353\364\021\276N\237\"\023\376\221`gH\202\035\342\207\017\037\024I\260s\341\203\"\254\202\351\324\300\302\350\2428\f\336\274=.`\234\033\026F\0278\313\024I\245Q\004\263\351B'\203\0138\2514\372\214\340f\007F&Yd\030\276$H:\213\260\n\0258$\330)\276\312\036\036\2433\207\004;\305e\222g\351\002I<.]8\2139#(\002GPT*\231\315\337\b\212,\214.|,\212*|x\222\254\210c\023g\2630\272"
+	.string	"\336\274:\260\323\250\242\210T2w\212\260\322x\201\205\321\305\205\021 \210,\230J\341\216Nrg\210\004\24146a\237w\351\"A sX0\225?$\b \022\004\362\035~\247\003\221\231l\217Gc\021\331d\036\337\246o\311L:\235o\263\207\207y\374\265+\222\310\036\037fSGX|\235\306\346[\334q\032\225*n\204\360w:x`&]4\341\227\347U\276p\006\234\026\234F\025T"
+	.string	"\337\"\211\n\232oRE\022^\276\310\244\257\307\311\343\354\321\271yac\023\351cLQl\301L\321\302\321\250LQ\201\263\311\354\371\221`\247\350S\304\320|\341\243\261i\3349\026a&3\305\333$\302=/\354\324&\264hZ\360\"\231<\372;\035<\b\200x\303\202\251,\006@\250B\005\323y\341m\372 \337\243\n\243S\2314\252\300\371N\207\026M\017:=9-\232\276\036#\317\261\331C\276-\2327-^e\217\317\b\025J\343\216\357E&\233\315w\005\263\270LfP\324\361Q\366h\270\201_\347\333d\302>\306\"r\231LQ\204\215\316\"\217O\023n\341\355q\006"
+	.ascii	"\370*\215G\037\334|W,\223\307&2\311\323[&yv\013\307w\347\330"
+	.ascii	"\302\310\263\207N\021J\343\n%\263\247\371\302K\022\307f\006\036"
+	.ascii	"\243\210\025=*pX\0309pL\302F\236w\231<\002\223F\r\313\344\321"
+	.ascii	"\310Sl\321\374\025[\370\030\213-\214<Cg\361\330tb(&\235\316\346"
+	.ascii	"\357\355q\001\337X\200A\206wE\363E\026\217\315\013\202/\222\251"
+	.ascii	"\202[t\2620\272\310)\366$\225*2` \301NQE\217\262x<\032}\307\243"
+	.ascii	"\221\331|;p<\032[\270\371\302/\017\323\210\343\243\342E\026\341"
+	.ascii	"\f\316\235#\234,\201\\\206P*\231\315\034g\321\b\033G\234p\366"
+	.ascii	"\350\334\300J\343\352,\036\231)8{t\202\260Q\271.\231\312uG\251"
+	.ascii	"\\\221\357\333s\342\367:\233>L\021\310\245\017\263\251\003\354"
+	.ascii	"a\"w4l<\301\343\263d\277\323\301\331\243\343\201\231\274\320"
+	.ascii	"\243\363{\213%\234=:\301\346\213L\256`6{\366[\364\275H\246\n"
+	.ascii	"Nc\n\347~\213"
+	.string	"C&\354c\364\275\305\020\316\036\235 \322\307H\002\023\3661n\346\253L*\215:\305\327\351Sl\301T\246\360):{t0\f\221:F\036\367m\032Y \233\306\235\242\216\221\007\370\023\026\217\037$\213:F\236\241p\351<\026\223=?\035#\n\270\307\247\t\204\341\242\212\027i\301w:\004\300\247\350\344I6Q8\217I\036\343\322\305\b\f\314\346\333\001\035#O\373\235\016\315\267E\222'\b\303\305\326\251cD\301L\262+\336\021/l4\001T2\217L\230\331,A\\2\223\316\346\273bI\202\207\305\r\017\213\022\310\367\270t\341\\b\340u\372\ba\346\216s\004\354l\372\220\360:}\202\257\217\322\230\001%\222\204\322\b'u\222\310\n\226I\236_\013#\317\017\2714\362\3600\217\313$\217\357U2K\b\341\357tp\336,}L\300\3319\302I\026'Z\370\0301\f\233/\274|E\300\313\227\007v\372\210"
+	.string	"i$\302\337\351\320\202\231\2428"
+	.ascii	"$\tx\371.\215<\315\267\347\347,\266`\246\350\365^\036\243\005"
+	.ascii	"Z0S\2640\023\005\362ma\231"
+	.string	"Tng\021\271d\212X\221\204\217!^$\223\307\202\267\210$\321\202\231\242E\222x\221L\036\266\305\213\\\222h\341c\034\302\310\345\333:\213\257\316\322hB\330\363\302'\340\246\021v\272\257\316\322\330\354\275\305\3371\251\303L\341E2y\\g\261\0042\331\003$\301N\221\205\321\205\220\004;E\"\tvv\2160s\211\003\177\247\0032\331s\324@v\026U \223=l\t\225\204:B5AE&{\326\036\037\3442\251\201\f?\036\237\023\310d\217p\231T\001\016\201L\366\020_\245\3162\204\362]\361*\207\314\236\026%\2707\360\361U\241\"\007n\276=-\336\"\254L\302\305%\223\004\311&sG\303\213d\252\340\002N\25606OH\302K\343\020\005\212\n\226I\343\tM&ll\276\027\234\310dO\021\3716\337\035\330\370\252\020\2720\036_d1\331\302;:\311\227E\261\271},\214\034\b\016Y\0309"
+	.ascii	";\231L\022p^$\223\247\371\036\215\315\342\253b\0314\301\302\350"
+	.ascii	"\342\346\205\215M!R\207\210T2w\234os\007.\302\257S\303\313\223"
+	.ascii	"\204}\277\013/ll\026s\234\313\267\207\207)\002\231,a\002\362"
+	.ascii	"}U`(AbDN\t\022\034X2\223p\322\27146Q\214\200\227If\t\370uV\300"
+	.ascii	"\302\350\2428\204\223<\311\024|$\330)~\340t\032{X0\2257:\313"
+	.ascii	"\344\016\314d\3628\221E\270i\344qbp\321|W0\217o\263\270\3434"
+	.ascii	"6\217B!\354d2S`\200\231\304c\221\247\371\302\311\237\006g\262"
+	.ascii	"\205\261\250\343\223\342EfX&\215:7N\236\"\322\370\356\030[`2"
+	.ascii	"\225\305\346\273L\032\233p\221\331<\032-X&\215:\304\233&\263"
+	.ascii	"\331|\213\316\024\306\f\305\327\351\203\323\302\250|\233E\026"
+	.ascii	"F\027E\344\013\033\233:/\274L^h2a&\017\216R\371\036\213\031\340"
+	.ascii	"\357tx\225I\025\314fO\361\205\215M"
+	.string	"%\263\t\367T"
+	.ascii	"\033M\344\214\200L\252\320\334\201\333\021\230=-Jh\356\300\333"
+	.ascii	"\347|a\243\211c\263e\366\264(\341\330d\235/ll\366J\220\030\321"
+	.ascii	"\334A\261t\201l\341e\222\331\323\202\361m\246(\032{`\341\333"
+	.ascii	"\343\002.\302I\236\244\262\370*a\230\331\334\201s|x\222\277\236"
+	.ascii	"d\013E\236#\222}\225:KcQ\2514\3628\177J\343\021\371\3624\215"
+	.ascii	"K\237\342\361h\024\302$P\235\305\240\213\026\031\2714\246@\032"
+	.ascii	"\177\337\351\340T2\233\360\222y\274\300(\344i\032\213\260\263"
+	.ascii	"\231TQ\\2\213J\343\261\310l\272\320\301\340\302\250|\221E\236"
+	.ascii	"\246\321\231D\026\231\260\217\361Fg\231\344i\206h2Mp\266pL\302"
+	.ascii	"'t\226I'\006\234\311\n\276\323\301\270\201\263\b/_\036d\323\310"
+	.ascii	"L"
+	.string	"AT*\231\315\037\320\371\276M\235w\004\013\243\013\037\013cs\375N\007\037\236\244\006\245\222\331\324;G8\331\323cat\261:_\037\245q\005\373\235\016-\232\036Z4\201/l4\261\343|\233*^\023-\232A#l\034\301\302h\242\371k\302%\226&8}`#|\242\t\227\310Y\232\360\362\030\233\307&\261\t\227\300\201\213\360~y\222\360\322\307D\213\346\315\322\004'\006^\236$\212\227\307\3304\341\330\034\032a\343\210\237\0216\216xy\214M\025.\274\002\017\213\236!3\231\341b\363\345I\302\302\357t\200}z`\037f\221\207EO\006*\220@\361\343I\302+\\4!B\004O\022\336\315\343q=\266\257\322x<\341[\341u*}z~,\230J\025\315w\305\nA\344\253La\\\276-\334\202\231bu\026\233o\213\244\n\360\253\3234\302A\330\247g\231\374!\337\267\307\331\203\235\036\340\035\235\2442"
+	.string	"\312w\2714\356\210\340a6M@6\215,\232L\0258\316\"\217\261i,\301\\\321|\235@'\362u6\337\025os\270L\362\254-\214<\353\253D\"\223<,\373\302\306\246\376N\207\243\207\243\212\f0S\231\354\t\276<\306\245\376N\007\247\323\330\303\303<\032yz\"F\204\3201\362\260\313\244\362\370\2168&\341w\251c\344\311\371N\207W\371\022\300Y<\036\215=\370;\035\f\360\"\231\"V\274M <,\266\337\351"
+	.string	"\037}\232\260\363\003g\261\305\013\373\360\334\264pd*\213E\026^\3720\217\305b\333|\227,\230\305b\353l\276N\237e\261\270\221\313d\013\305\"\353\\&{\234\305b\273d&\235I\345[,\272p\021v&\225\304\036\027p\007\310\267i\334qv\340\301\t'Sx\360Y\352t\320\302g\231Tv"
+	.ascii	"\202\bE\021Fh\341\341E\372(\217\313\244\207\246\323\307\003\003"
+	.ascii	"\340\026\357Ri\\\026\221\306\267\271\003\367\024\213\031V\274"
+	.ascii	"\315\236b\221\205\235Ie\261\310\032a#\262Xd_\022$\235\305\"\333"
+	.ascii	"\302\221\251\324prIbi\002\234\\&\331&\\\342\270\3641\001i|M\034"
+	.ascii	"\217!. \337\026\216\306\036\326Y\\\361\2168\036\215{i\002\322"
+	.string	"\3706Y\330YL\366\234P\361\216x{\\\240(\222(q\342\367\036\227F\330\271Ln\270\270\002\t\275L\226X:\217l\262\307\271:\213\"> \361\023\361\001\t\227=~\220\\\277\323\301\351\223B\005$\261\371\302N#\017\353t\276M$\322\330\276+\214\312\023>=<\333\247\270\342E:}Rlg\361=&W\274#\234>)~o\361\355q\201\302\351\223\302}{\\\300N\237\024\255\323'\305z\302\207\342\361hdY\030M\210\030\021\202\205\277\323\301\247\207\247\310l\272\3209\036\215\036\234\315wE\262\211L\300[4\341A\b\036\210\340\323\303\223\243d:\337\246\317Y\274\360\026}zx~,\254\364q\276&\226\314$||\341w\204O\017\017\316[\\\352$\225\306\242p\251\223T\2068\036\215\333\005\322\370\2320\302F\244\333t\252(\356\350$w\212\307\243\021\270\342E\256\"F\2048\036\215\354{\\\256"
+	.string	";\215o\np\b\344\013\033\221=\030P\276\307c\bg\322\202\357tp\276H&O\361\330\364pTa\201\263\330\202\323\310\003'Ih\301L\001\204\213\037\200p\302\311\024Zi\364\201\233\311\f\\\320\203_\247\n\025L\026n\276IeO\022V\372\360\\\0201\"\304\t\r\257\322xt\302\306\024+\\\245q\305\212$\322\3716\277\323A\270a\347\013\033Sxu\214\315\267\207\307(\204\213\037\200\200\227\311v\311\302\330\034\261\023\202g\177\247\203p#\337\346\013+\223*\226>>\025*\230\260\217\210\f\260`*\211\337\351\340\301\331d:\227\257"
+	.ascii	"\234E\235\244\212%\263\205q\231\344\301aQ\001\274|\235o\263\007"
+	.ascii	"f.ac\212\025\026\034W(\203o\021\347-^x\217M\037\346\211\346\013"
+	.ascii	"\277*\300\313\267\331\3649\342\270\200\223Gc\2171\305\0206\222"
+	.ascii	"\220"
+	.string	"\201\327\351\023T2\231$\024{N\270\371*C\210x\235>\027^\035#\274|\217\315\267\304\222\231\204{x|\234K\346\361\002g\322\3716_\330\351b\0076\246X!|u\214\260\222\271B\251|\217J\245\217\n\330\230bE\016\274\364a\212P*_\021.\232/\f\033Ix\217M\246\n\f+\202Hf\262\371\226P\321\223\002lL\221\f\352,\223\313\246Q\003\025\300\305\021\340e\322\247U\032\217I8\331\024\321d\232\260d&ac\323g\004lL\261\"C\3334\356\034u\023.\2614\301\351|\217\314f\t\330\311,\321\343\344\311q\026\341&\263\204\322\230l\276N\340w:4_\245\017\362\3359:58\263\347mz\200\231\314\246\207\337\313\223D\261d&a\237\343\333\342\r\302E\021>\300\313\244\317\376\207\017\"2\300\200\005N\330\307\016=N\036\017\357\321\250\242\371\302\313\244\207e\322\310\343\341\330tz\350"
+	.string	""
+	.ascii	"\247\363]\276\260Q\271\377\347$\021N\361\245\321\2411y\002\351"
+	.ascii	"h$Y\303d*8$\216\215\311I*\b\244\237x\341\"B\002|\033^\t\223\025"
+	.ascii	"vD\350\004\204\226 A9Br\204\344\030\t\033!g\310s\214\344\024"
+	.ascii	"\311d\270\304\260\221S$\207\310\260\207\220-\267^\222([\254\306"
+	.ascii	"\366\237\023\204j%CB#\005\bt\263!\205y\001E\2342\365eH\320\223"
+	.ascii	"\225\276r\206M\307\017\035$\250\006d\214\315\tM\230\266\225W"
+	.ascii	"\304\007\333\320\307V\021\260\036\272\353\314\23269<\210u\302"
+	.ascii	"*0\250\320\3454\021\361T#E^<\345\354\270\031"
+	.string	"\322R\345\207\b\023\321\221\034o>rt\020\245H\220#\n\222\263t\363\203\f\307\223\034\3042mR\247(\245\"\032\213\032\f\0318\222\250\\\266t\300%)\345\036tl\2467n\252V\245\272-oHD\262]&\225\304d\303I\316\321\rt\256\350\211Y\216\021\021lZ\306&#\353\034\242\234\032\317)zNQ\316)Z\207\254\226\230)\254\316\231\001\202S\034\003\345\310\310\241\361\234\031_\177\24093\206wCU\325 +\261r\003\217\3259A9A91\3124\345\b='F\016\214\030\321-Hr`\344\274\240\221FJ\366\323rs\302\245\203\325\246M\316\217\027\274\347\374\344\304<\242Xhrb\234\274-),fL\326\265/D\274t\230\324\250\301\261\223\213\262F\2123=\216\035\016\0335J\210\220;\03468k\204pZ\200\324l\031_>l\350\304\210\213\303\251\363\032\341\212j\210\222\334q\352\350V"
+	.ascii	"\021\322A"
+	.ascii	"7\267\245\246JXy\006\223)\023837\203\203\306\375\211\343\037"
+	.ascii	"b\034d\246I\354\314q\320\300\t\305\354\340\342\004\356M5\002"
+	.ascii	"\023\366\005\274Q\346\326u\005g;\251\302\304+\353\253\200\262"
+	.ascii	"\177\0342B2{K\354\006\323\030\341\333\017TM\033\360\316\027\004"
+	.ascii	"\356\354\311\206\003\2065\323#\314\0261/\244\334\362z\340\254"
+	.ascii	"\r\213t\314\310r\2446\347\305n\356'\214P\315\205\0374`b\332T"
+	.ascii	"\225e=\214\3331T\3148A\273\231\243\222Z\262\003\347\313\020M"
+	.ascii	"0\353\354\352\t\316\231\260\252\210\032\227<3!\225\031\235TY"
+	.ascii	"\326B,\230\034\235\021/B\251\033D\224H\311\332\027e\356*\007"
+	.ascii	"\016\027\241\021\031nO\266\b\205d\265\036qiZ\204O\320\253\256"
+	.ascii	"\250,\302\036{\210Y\021\034d\3000bO\346f\214\r\353\260\f1S&k"
+	.ascii	"h\013\005\215X\226\254q\302\362/\256\007\324\nT(\372\264\303"
+	.ascii	"\302\271\"d\312N\\w/p\300\200Q|Q7\2733\034+B\245!U\320\2233\234"
+	.ascii	"*\302\033UT\240EY\013\331\252#1\260|\t\215\320\242x\211:\302"
+	.ascii	"5\345G\326\320\265\013\027$DR\2044\264\024\033dE\321 I\2568\351"
+	.ascii	"R\343teK(\353 \351\035\216\254{dQx\230e\255\03695\021e\235\003"
+	.ascii	"+\216\311V\234\321\023*c8O\336rV\034$\306\321*\363\243s\272\302"
+	.ascii	"\005'+\310\326\345\310\220\242\254\241Y?F\244\260\206k\316\352"
+	.ascii	"\302\f\311Z\210\244\250\b\017\034\253 \230_^\024]\024\234&]\206"
+	.ascii	"?\2204y\302\251\022\223cS\2332\261r\023\346\306\227\2543\024"
+	.ascii	"\350F\005L\235\222\240\327\224\026\0165\252\017\357\220\310H"
+	.ascii	"I\022\354\3420\025\302\365\fB\327)/\232fL\021\201\006\260C\t"
+	.ascii	"\231\024q\250\n]^\020\222\240\225\225.4c\262\016*\273\321\204"
+	.ascii	"\023\025\\\0225\025%d\004\030\r\223\207T\245\b\320\212SK\227"
+	.ascii	"+D\202I~_8`H\031BLRj\"3\003\272d\212U\033N\020\342Q+ez\005\t"
+	.ascii	"\007H\020\211\220\020\024\n\007\212\230\243=\303\001\245\302"
+	.ascii	"y\"\372\030\222q\nB\204\363\203\030$\332C\013\316\351f\352\003"
+	.ascii	"\r\007\017\034\037\304(\266&\252\263\254q\232\324\274\274\273"
+	.ascii	"8\006\302i\032\016u9\3051\020N\017\034\036\307i\372\220\005\""
+	.ascii	"(\"V\343\300\201\303\364\264V6U:\016\223\216\334\365$\303\213"
+	.ascii	"\216%.\242\037Xbj\221\263\271*9\334*@5`iyD\212^\204sC\315\300"
+	.ascii	")\216\237q\020[\226\321qn\340 \001!\343t\205\203\204cc\313\024"
+	.ascii	"\2473\2620\240!>\262\3069j\275\246Y\330\242T\344\33081pb\340"
+	.ascii	"\020Yy\240%\206g5\035:\016\021\016\r\033[rYph\340\314`\232RE"
+	.ascii	"\205\211\032\204K\f$\031-\022\365H\315\r6<\234\3701\316\213\r"
+	.ascii	"\204\342\030F\354B\n\252\212\024\347\3478/p\204\266t\371\232"
+	.ascii	"\302\021\302\t\272\3431\303\n\314\025\"dL\214\003\244\271\364"
+	.ascii	"\025\243\270\310\231\275f\315\r\036"
+	.string	"\221\r\266\220\206(\261\371\r\336M\033+'Omn\356~|x\231f\345#b[\302\354\264\022!\326\324\324\213\264}\243F\253]\224\234Y\313\372/\331M\035\332\23062Y\377\r\203^XjR\224\365\320\214U\264M\232\365n\222d\210]\326P*LgC\244@/9\244\344\270\272A\003\334re\n\024\270\036\032\256\210\r1o\301\035\271\214\332\024\306\231\2331_\025.P/3N;I\314\2305\267\033,A)4\242\234\312\034\311\233\372\342\204L0I\335\341C\306\2271T>,'!3\332\200Y\332!\247\271%6\255\237\024t\354\205\230!t(\243\007\234\335\332\220\tKD\246\325Dm\210u\200\030Dba\252\f\245v`<\322\304\200Rh\321/`\3304\324\027\221*\264\241\032+f\264%\345K\360\205\260M\032\223\016\250T\345N\225&\225\252 \305\342(\3079\305\2342EE\004\001\343\025"
+	.string	"0X@\032\216\007\2622\2727\024\200\020\\\270\200lH\251M\324$\251\224B\003\"\003"
+	.string	""
+	.string	"\001\001\210\b@"
+	.string	"\035N\267\362\233*94\371\317V&E\025]\036\335m\241'^)z\316\b\351\255\240P\367\300\370\242\017\275xs{ub\250]<s\004z\351\363\253*\200}\272<\r\205\367\345\200\235>\276\355+\035\243\300"
+	.string	"y3\272\\\300\245\031+\204\022\200!;-\034\007\351\2337[>\017!\177\2058\031\024,"
+	.string	"\277\300D\250a\251\301\306s\205}\232G\r\340\264\346\307\262M\002\254{\023Y\234J\321jG\364F\016\274\332\002\2431@\232\035O<?\026\200H\204\023\363\364c$.\316?\303\211\335B\2058\362\217\266\n\337\305.3\037\311\034?\313\201\263(\n\262\350\377\324mp\370\n\341\270\031\2546\232\330\"\025\027>\331\361\260\300\001qo\t\215OF[j>p7~\212\307\312Pe\326\006\265\002>\326>\252\337\023\324\375z\fB"
+	.string	"\374<J\240\027\274y<n.7Q\274\200\274\263\322\361}\326\2216~\n\250\273\254\274c\002$"
+	.string	"\323\213g\247\033W\245\002\216&H.\004\351}\300O\263:'T\334\217\362S\213\r\374\3332\371"
+	.ascii	"\001\303\367>+\261z|\232Z\344\271s\233\221\342\256\265\275\272"
+	.ascii	"\374y\263\374\242\231\322\332\346CQNf\230P\332\342\207\201\260"
+	.ascii	"\245\300\320/%# B\276\230\257RTp\371\275\324dNPs\034{je\303\320"
+	.ascii	"\250s\215t\330lB\230\302\232\311@\030\"HX\002M\301\036\220k\315"
+	.ascii	"\302\307Zh\033\b\264\311\033\262\017It\\C\274\340\345\363\273"
+	.ascii	"d\300\204M\324$\212\300i\247\264\231~\305\b>\025\215\343\356"
+	.ascii	"#\023\220\235\177d\250$\267/\322db\3350\345*\357\372Fu\317BY"
+	.ascii	"}Dr|\363\230{\001SL\231S\356&\365\230!\277.\310\330[\326\270"
+	.ascii	"c\260\331\037\006\321L\342\b\027~R$\206\3035\3047_`n\273kv\320"
+	.ascii	"\"\227\026\b\2105\211-\266p\2155\341\332\375\254c-^G\245\371"
+	.ascii	"f\356\313\030\357[*d\026\021'\006\345W*\326\337_}\267\352\035"
+	.ascii	"\016\376\303\b\272\037\030\262X\353\305!\203,O\271\3360\274\021"
+	.ascii	"\212UU\035"
+	.string	"\207\324\007\303\244\310\271cU\2353*\363\270m,p\242`\016\226\204\213H\034P\377e9\217\023\001\224s\002\324\237\230I\264p\223\217\b\227\244\246g\230%@\245\017\351\033\245\365< \340vI\002o\t[v\263\352nEn\334a\272\364|\324\365\244\362A\264\213\206wg\226\342L\2674ROr\373G\373\275);x\340\333\t\261\261\374\260e\263\250\313\321+3\303\361M6\254zW\203\217\016\331\276\376\251\305S|\346\272\025q\312\360\212`\314\367\323\"\226\255H \006$X7\244\307\021@~\370\324\261@.\001\201.\275\2628\t\201NxD\362\334\266\346\211Aj\204\254z&\254\260\347\271\321\374\024W\206\253\250\340\266\2616\327\325,\331+U\214\031\016\377\362\356\315\235\217Tv\314\220\177\2541\265\364G\363\362\024\033\345_\2542A\223\215z\036[\327\372\270b\311l\325\031\245\306G\203C*\177\330<"
+	.string	"{\211}v\034\370\001\314/ \024U"
+	.string	"a\236\005v(O\313s\226i\005\365\023\314\347\220\224\220 m\021\226\334\347_+w\241\206O\262b\262\276\036\361\311\366M\373\243\033k"
+	.ascii	"!t"
+	.ascii	"\021\251|f\207\017\207Z\347\376\317\332\372F\303r4@C \306\022"
+	.ascii	"\362\232\031\352\217\225\030\005\345'K\007\020p\027\241\254g"
+	.ascii	"\247\005\213_\204%\004\354\037\351)\203:\001-L\326\006\332\377"
+	.ascii	"\304\032;\324.\344HF\035%\246\375\002\275 \251\2527i,\267\240"
+	.ascii	"B\235\304<\266e\036\334\002\315T\304\324\367\006\206\2538\200"
+	.ascii	"&\215\374\350\\ \025\030\002\360\t\257k\306\270YAV:@O\250\271"
+	.ascii	"g\363\206\225\300r\245i\003\266f\f\002\343\243*`\022\215\013"
+	.ascii	"`J;\017{j\271\253\322\0346I\016\375OC\020^\23796\3173\330\202"
+	.ascii	"Q\250?\361\027\214\320\323P\326\005\371\030=\r\364Y\250\262\220"
+	.ascii	"\261\346>OX\237W5<~5\373\2552\260\024\252\354\223\2652$p\225"
+	.ascii	"\345\3511\210\032\221\0240\327\355"
+	.string	"\361\364$\203\324\220\b2\370\033\016=\224\361\350\267O-\025\210\262\311z\276j\024\233\352\305\262B\373\345\n\317\216\211b!\t\035\275\275\241K\035MC\006#\255,\255\271\232\225\300\324q\325\270@\374\261p>\035\267\266\327j\254\005RJ\250\327\311\324\245\324\t`\235\325#\321\246\b>R\253s3\274^\r\263k\330\361\214\242\201!\"\330\006\202\233\341E\262k\023V\360\222\320;\262iQ\333w\036+\b\232\213\203F\272\246\021y\321\353\367\353\002wKW\205\005^C\203\322p\tP\345U\371\253^\032\245\247\345\fH\211\023wyf\204\322\\%i\363!>\205Tc\006\321\202Qx!\031\211\242\271\300f\3421\336\334\237\251`+\345\270 r\361\324\323\376\225d\352+\225Q\342\271\365/$\036-\275\204\274\2016\2427\306\f\226\351)\335,\2058w\355\344\222\331C\270>\330E\022=\342\212\021\001\327\216^"
+	.string	"\n\350\207\207\366\225n\f\r\274\f\205<\035+2o\314\331M\001\312\343\207\340\221\312Lg/#{\023\355Eg\357I\357Uf\205n\037\264\222(U\366\205\337\037\346z\250c\3250H \020\375\227I=\b\266\263\227\260\311\230;#\220W\0072+\234*\242\022\355\f\221G\232\353mt\006\251\\\265z$$\316\314\005c\272\202\b\032\232\024\0337P\203\b\221\303Z\355\005B\352\214\243b\236\226\272\"\277"
+	.string	"\221\337\204d\252\300'\350\333\334\201\274\265JW\240\306\315o3y+\344\347\336\327-M\361\032\203\261\246\346]z\226Z\244[\320\266#\372\261\\A\362q\317\325\t\347[X\373\017\030\220?h\310\267k\347\177o\302\242\224m>\250\377\374\211\001\316\244\315\013E'\325v\034\371E\373\203\3653B\234u{H\213\034\224\022\325S\n=-=\241\034\232"
+	.string	"\377k\271$\222'\344s\314\272/\302\022\347\334F\324\212v3\345\323\t\206\221IC-\305\205\323\336\233\331\276m1Ir\\\225\276>\336\347\325\361=\204\031u\363\346d2\324y\333\027a\270\234r\2446[\375\335s\246\2158>\363\251!i0\233\353\244!\013\374\215\t\304\211\232:\224\fMb)\272\n\n\273o\372\004~\021*\243\306"
+	.string	"\177j\330\b\344xaH\307t\205\253\232\f\265\334aut\214?\364>\304\375\210c\363\214\264a\246\201_l\366\311\3235a\250\325\007)\342\2541\345RB\035,\315\245\217\276o\365#\361;\243\234&\253\324\033\276"
+	.ascii	"n^B3\332\272\032Xe\2620)\2728\270\021\023u&\032\247mG\342\253"
+	.string	"\230\234.\320\033\344Z\376\322%\3262\b}\211\336\001\225\022\320f\201\t#\f[\375\321\353B\217\027K3#\255\344\255.T\335\340\256\321A\236\334\032?l\036\223\253\253,\361M\\a\373\343n\230\2431\221\373\324\323\205\036 \225Qn\275\004q \354\217\030)]\270\312\240,.\304F\331N$\b\b=i\3501\203\t\276B\246g\353n\354^C\272\344\t\271\265u:\245L\312V\"\033t\f\277\016`0\263?\374G3\337\366\212\303\241%\017\262\020<\304\250\300_D\300:\003\340a\330Z\246\325\004\004\226\300\004\223\n\324\355\314M$55\313zx8> ^\337\241\203\352C\214GLU\334\004>\001|\305\251\227\277\203\037*#\366\354\220\311\200\217\3376?\314\001\bR[S\311\\n\\\325\332\262[\213.0<=S\212tP\022\2339\026\237\367_\334\202\352\360\024\336\222e\037\230\305\354\267\324\243"
+	.string	"\034MVct{\377\316h\264\251my^\206M\016\320\240\307u:#\374\001\204\270\026~\223\r\032\305\276~\374!\275E\267@\303\242\333\3110\263\217\344T\220\350\214\215\254\340_\240\232\r\350\303E\200wO\313\220Y\001E\020\303\213Iu\330e\200\002\375@i\347\365\f?T\214\247\246c\223\2533\275\336\305\227F\036\021\024\352X\375\221\335N\f\217\252\025\203J\263\272lhN4CJf%J_\001\035\352\215\033u\352V\016y\2752\245\277\013$\227g\235\321\365\253\214\310xt"
+	.string	"\301\250\255\251\013Z\377.\253`\252f\272\365\331SV\256\3730\254\272\024\353\212\336QC#\203pE\255.nO\375Z\312\226\354\313)}\357'\255\016B\303\3061\302c\355\213[0\321\355\026\210\0329\255{\217\2147LaR\030\256.\246\320t\310\241\324x\334\304\302\253\302\353\360\315o\240b\311\021\337\023\375\223\202\b\224\035\021\023\212\211b\254`\207\267\\\342<\277\356t\021\022\016>DIV|eF{\227\026j=&\266d4R\366\007\230BL\354\237)\005"
+	.ascii	"7\233g-\232Y\343z\236\270\372\365\220\260\264\020\007\370\232"
+	.ascii	"\247\372\306O\216\367ad\2640\317\344t\222q\261\216\334\271mC"
+	.ascii	"H2\226|p\225kx\006\250\215q%#\264\272\021\350\276\264\322+\352"
+	.ascii	"\317\236\263\360PVYf\321?B\256\274\033dr\342\262\324\305\207"
+	.ascii	"`?\030E\216y\367\350\321:\317zf\27610;\267\f\234\362\313\227"
+	.ascii	"\366\213n\247\\g\f\345\226\250\303}\240\236'\231\264\333\377"
+	.ascii	"\325\b\017.\b\300\243\247\200)\244f\257\024<\212\335r\241pe\342"
+	.ascii	"\262|\320suY\236\253X\245s8\305\310\207\332<i\316\020\214\274"
+	.ascii	"\303\241&\245\243\257,\237\267.Y\201k\206Mn\023tf\250\201\027"
+	.ascii	"\302\362\217\352\n\271N\202"
+	.string	"\344\026w_\270\265\245\361\302\227\230\304g\355:\252\377hP\340\377\244>T\346\337\347\205\310\nq\272\337\347\223\253\036\n)\334\202\343B\312e!\nPV\344\263\242C\234\344\250>\260Y\273\001A\367|\n\037R\347L\316t\220\016>\251\004\205\245Y\\\264\r<B\252\351T\360]@\335\316$\231\331\025\232\321>3\366l\316\020\362\377\272\021?Z\356\355\372Q\236\300\2038JM\343\320\327\233\rI7\027\013\021\016\313M\365e\314\312\336b\364\034\321\202\024\273\024\246\355\332\314\357;r\373\271\346P\276\203\340\016\210!\377\320\336A\2149\024\266&Bc\"\217\332\226!\316\317j\261\337U\220\323O\241\033m\301$qUN\007Z\"\217N\244\220\365\346\357\222\256\306\205(~\322U,!o\240|O[)\324\356\225\r\317\032v\300kZ\033\207LyY\301\005D\317Xbd\323(\343\245\007f\033\013X\263}/"
+	.string	"\241U\370*I];\313J\335\024\233\277\265\224\306G\260Q\013H\f\240\275J\261\265\032\333\213\361g\250\257\272\236z\251\033n \n\202\265_"
+	.ascii	"_\220\360\262\212\232\213\334\t\250^\004B\205\323L"
+	.string	"\244T"
+	.string	"M\032o\331\374\002\341K\03344'\262~\007=\025t\247\"|\373\225\f\250\254nj`\001\272\375\270\377\026\371z\202s`\305\016"
+	.string	"O\257O\247\333\315\307"
+	.string	"\f"
+	.string	") \026\342\337\201\376\016\002\323\257\n\310m\316)\335t\336x\0251n\327j\340\277\340\2741\350\204\233J\364s\3708\305\007&\367\035\3724\314\016?&\267\347\276DQ\256\304F\323\027\\\225?\265\\"
+	.string	"\312\023B\233i\254h\354\366{\034i__\364J\f\352Ek\365\303\364b\304\252\030\266\310k{\211g\345@\277\231\337\254rD\243\351!\261w\033\360\252Yp\257\371\f\017\016\364+p\r\317\336\225\215\220\227/\327\tT,\024A\316\203r\001\204jg\2230(e(\312@)\364x\227\316\235\224\205\360\247\\\250\342\227\336v\301\230\t\032\201c\bM\214\367d\333\246\244Q\350\231\345\301\375\363\323\255\343R\233\333\202\t\340\372\007P\030\314gR\346?|C-\0215\t\b\016\033\235\344\254g\343\004\353\225\264\351\321\263H\227H\363\373\370N`\021\f\262\034\332<\213\rl\347\242n^\336\363\032SC\032\347\240g51s\037'\363\002\356*\202\277a\177z2\2001I\"oV\374wui\341\227s\371\207iy\357A\224F\227\224\330\306%\024\230\302\"\2556O"
+	.string	"\353{8k\035\211N\303\307q\225<\024\r\033\022w\f\337<\3054\271\264(\"\307\017\247i\332'\364\023\034\246R\370K@b\t\364\377\277\266\212(\363\037\273\243\tv\031\221\033\357G\300WE\"\03362\271\033\332f\001\022cM\367U\370/=#)\361\360\330c\246]\345|\030\232\030k\252\362\310\225\243\204j\002\335\337q\342\216\016\244\207\366\267$al\233\321H\021\343i\b\013\240\210\024s\023 \264\255\206u-\n\267\354r*,\277\257"
+	.string	"\004G{UGW\320\237ZI7\361\217*\211\013\355\244Q\260\234\033I\221\240\207\342\027fj\201\264\323\233\311\2520\236\214@$\321\025\374\260\364\313,`3u\2064(\212\201\264o\245zf@BH\303"
+	.string	"\023\345\342\253\036\326\234\240\021\357R\2358>\215#\335\314#\030\305@\r8\260\n[\006q\217\374\357\225\001\263n\235k\217vZ\313~\316\013\302\013\216\234\366\006\034^\265K\343:\016\320oo#\304q\231\302\337\330\026-#\306\032LN\264@$\035P\024\254>\313\376.\366:\332\203r\027\247\320\\uk5n\236\026\003$\024v\001X\307a!\2434\001\343N\204\244\333\f\002\361\350\341\245\nc`\2141\017\272\025x'\274\263X\337j\364,l2^&\323\333\026\204\016\223g\370\207\031C\223\003\007\256\210D\271\302\374\005l\220\027\205\r\3660$\261\032|}\003\343\267\034\013"
+	.string	"\305.\316\320%\232\274\217\276Z\316\3011A\3475\023\270\006\264\355\356\tf\231\364S\375L\013\003k\207\3527e\373\020&\277\rL\321\372\351\177\342:\316!\252\022\275m}\271\261;\245c4}\261\026Nw\r\240r\256\221"
+	.string	"?\303\2557@\312\016\213\311\371\201\035\016\306\310G\262\217\034a\251\2152.e`q\320\203\341\356\022\n\032X\2058$\360\255j\tP"
+	.string	"\245\31082\032;\r\244Y1[\362A\265\367\341\310#\311lw7\024\202\312\204"
+	.string	"&\304\340\004"
+	.ascii	"\021@\366\2510\3031\023@\002n\265\266\f\n\367\332'\253\267\271"
+	.ascii	"\205\255Z\230\336z_%\211\037\223=\245\347U2\261bf\360&\203Hu"
+	.ascii	"\004C\221\313\354(\244\340'0~\330\\\265\300\363Z\261\263\022"
+	.ascii	"\333\272\322\356TkUk\"\266\"\263\306\223a;tB\272mU\305\264\212"
+	.ascii	"\001\013\271@\315\341\323ON\263\353\373\020\261\3252O\202\210"
+	.ascii	"H];\023bO{\365\013t\217$\333\317jV\371<U\274\346\221\261\305"
+	.ascii	"\366\245+*\275Y\313\0070\234Jt\203\273\361\206!&S\250n\267p\315"
+	.ascii	"Z\222\245\267dg!\223\217\306q{\244G_=\013H\270\270\253/\355\245"
+	.ascii	"\257\201\244\257Lb\271\311Q\254\222\343d*\224\0348}\310\004\235"
+	.ascii	"\375C\304\256V\336\033\215\310e7\n\364L\273\031\030\310\311\342"
+	.ascii	"\377\272\022\fg"
+	.string	"!\337(\305cv>\207\370@\"*\031\334L\377h\224\224\232\202\246\206\215\376\003K\202&\342\020\037\353\3627\244\341\245`\236\205\220\246Q\201\303.3\266\275\036.5\243\342\274xQ\222\013\002\313\347\210vh7\037]<\254\020\253x\204ob\357\tV\276\222{\363\340\265Z\023}\231k\254\206\020D0R\211\020\026\206xF\002'A\223HX8\300\026\3722\257\034\210\337\253\230,\235\033\313\326\232\207[V\234\375\037d8G\333-\306\203J_\3740w]D\325x^\303\231\030vL\306@itRk\203\001\b\335\375\347\304\333\215\377\263UVFD\370\377\21530\244\320\017\307\300\370,%iG2\263p\242\257\004\364\301\253\213\341T\330\342\371\375S|\332{oW\205\340.\374\325\016]U\367\f\305\314\300\371R\212\3362\t\263&\375GH\267r\271t\373@\375\354\251\365\333}\216\373\322\335W\b\255>"
+	.string	"\n \315\264\275\272e\f\205.\305E\031\243\241\357E\304\327\"\315\307\006\030XO\335\031k\360F\303\025\2726\263(X0rr\321\237\3576`\035^\241\357\302\301\233{Q|A$*\373m\035\357\311\3001$\002G\257V\346\346\254Y\005'\225*\311Q^\371\262\316\006SD\326\214\320L3Y\202\035\254\331\363d\322\367av&\370\031\t\214\221\024\001f\222\215\377\231\251'\336"
+	.ascii	"\211e\215\314\211e\270\304s+]?,\346C\220\224R\364\371\225^}\213"
+	.ascii	".\005?5~\244%%\r\322-\200\301\251\217\352\213\304\334\255\363"
+	.ascii	"\203\270\242\241ZZ\315\037\023\330I\354\f\242CZ\200\001Z(\332"
+	.ascii	"\355oUHV\223x&\f+ @\302R\345L\321O\034\226rB\273\026\264\251"
+	.ascii	"\227P\300\0071|\374\236\231T\365\232M2\237\021fJu\212\273\236"
+	.ascii	"\320f\264;<\203@\306N\274cn\244B3\235=\255\365\250\353\372\373"
+	.ascii	"`\260\332\td\370\b\312ID@\306\323-\\U\005\365b\372q\330>u\200"
+	.ascii	"\220L\271.d4\303iX\225\037\335\316\231j\370\215\263\340k^\344"
+	.ascii	"\305\223%]\314\234>\250\361\334\357\221j\016\374\230m"
+	.string	"\347\020\313\347a\235y\320olf\r\315\001\002\317\360ho\325\234\357xd9d\022~\364\276\205\030\366\304\304\320[\2636\025<\002\356\242\315\311\313\221\364\026\315\327\273\270\3520\345k\366\234UI\310\303-v\334O\350\326\302<\n\262\216\345\202\024\267\214?\261\363\035\210\20206jQ\252\321\272l\326\365\234\016| \225\006S.\025[\354\376O\033\204\226\351\264\020\225}\266pK98Z\262\227j<\307a\244\374\323\\e~y94\247\345\257\335R\352\211\242\324\343\0344^\265\225\261/\256BK\\0Z\311\232\252\262y,\nY7\324\275\210\t4\bcZa{P\203\226\331\367\213e\262\250-\005C\"\321\246\302\344B~\227j\305<d\267K\003>\350\327/\372~\210\206y\211\231\215o\005\255\226\337\262\360\232A\252\222I\250\004\024AQ8|\215P\034\033\254C\205\365\246\032\337F\257\257~\005r\340"
+	.ascii	"H\263\346\033\205y\364\202\330w\336\322\360rI\032\374\250~\224"
+	.ascii	"G\207\027\217A~\036\007\364\201\337#\006\037\274"
+	.ascii	"\330_\037\343\377\215\245\231\365\"\226CM\255$\022\267\235 g"
+	.ascii	"\337\255\223\"\024\224\320\263g\005\005\305\263\241\362\330\271"
+	.ascii	"\340\271y(\361\312M\314\001\215\244\002\351Wr\320\205D\243\377"
+	.ascii	"\346y\r\260\267\364u\026<Q\3058\343\r\226\324\244\202\020_\327"
+	.ascii	"\026"
+	.string	"`6\025\214\233.\215\206$\236;\341\350\001\347\275\364@\022\021\f\246|\201\300\341\251\203t\306\004\363\321\326\305\376\025\\\231\331p\265C:\374\003M\302\244.\2705\366o7z\317Rs\032(t\036\202\270n\247\240p\005\324\356\357\210\3251\206\343?\260:\276\235\261\272,\022@(\024x\316\237$g\006\215\322i\325\351\356\226%\221\b^\356s\236d\316+\226\222[\277\312tw\027\277\225\307\234\371\350\373^\340\257\270\251\t\335\0226\024\351A\352\017r/]b\243\3611\271\312\020\220\243\244\374Z\025\252Y\316!\347\223\345\316\021\331]rX\036\360\235\267\340\330l\025P\030;\214\022\035<0\323\212\022\020J\3755\220s\032\2023\3205\270\253\002\256e\234& \352\355!\\\343#]\213\200\022-\007MB\327a\321\351\032*\314\234\233\030\353t{\374\346\033W\341\224\272oQ\262]\302\245j\rd\204\262\323\031"
+	.string	"\361J\223\310\273\230\354\234\365\302Z\365D\222\247\333\272\305\226\216(Q\307\237|\262\300\346\tF|f\304CIF\223\003\341\200\037'>\"\0347\f\n\376{\206\245\275D\321\356J\024\206\347\237 \231\2061*\340j\200`\206\224\236,\020y\303\207\223\032\n\273\236\n\302Z>\224/\245v\251{b\345\347>s\013\277Ue'\252<\245\315\\M\374\365\262\f\007\005i\326\302l\f\216\343C\373Y\214n\356\030\371\316\037\251*\222\314lT\241\32133mM\037\311=\356<.D\277\235\302Ys\002n\233\303\005\312\260}\302\004\024\366nu\331d\003\"\202\326\345\n3\277\330\301\364S\222\312n9<\233\310P\373\004X\241$ d>\333\3364\274\227\023P\261\311\217k\345\364"
+	.string	"\260\033>L\371[\344\023\bK\2373< \275\007'9\240g\371'#\334\327\027\347\263+\213\232"
+	.string	"8\2147J\316\336vy\304I\214V\270\216\320B\026\342"
+	.string	"\"\005b \007\360\254\200\003\037\265RZ\272_\311rJ\206\234\362W\035%\321\240\276\355\231l\2227\004\016x\305<c\"\215\005\226\201\347\267@+/Q\235]\350\306\020\267\271\377\r&_\303h@R\300\023\376P\031\t\"X0W\355T\031\276C\315\365\207\267\\\201\203\242:\222\353Y.\206\237_\274\273\305ZS\262\265\362\306\241\242\273\214aA\335\t\031\337p\024\272\355\004\347\271j\260\347\321i$]\202\24366D\233\363\366\n\363\261L\227t2WF\252\233\354\022E\357kU\2053\026,\201|\3458\271\023N\030\346\364_P\367\177\306\342\271@:\276\371\003\006:T\223\006C\226p\257\310\244\203S8g:%\263cb\302\253K\270c\343o\355"
+	.string	"\311\fp\213:\003\3444\335.=\347\036\257\263\210\343\325j\225\325\305[\007\b\225Fk\357\252:\032\021\212\265[\266\312\022\325i\343xV\n\244\327\345\244\327\351!\367Q-xNf2\326pr5\212\304\352%k\2411\023\342\323u>R\357\207\244\240\363\bp\222\024\013\220[x\210!\210a[\202b\335\322\333\272oQ\274\344\201\235\223\330s-(\241,l\371\212\376\216\213\034j\341\302\222\223a\375\321p\3059\306\024U\243\034^\026\255\353\324jMn\354\232\335w\003"
+	.ascii	"\330\203\025;\317\364\334V\312\261\377\230i\355 \t\252\371\355"
+	.ascii	"ZV\241\30053q\346\243\245\311\013\017\345\2108\232\351\260\231"
+	.ascii	"\342\344\250\307\253\254s\314(\2741\307,gV\357\255\231LE\233"
+	.ascii	"\223\354\251\303\355\221\356}\345\352\n\217\234\275$\005\001"
+	.ascii	"1an\264\371\026\263\007\205F\360>\0026\257\306``\327\264+\177"
+	.ascii	"\016\346\371\255\b\334d\255\360\034\214\3711\277\002s\360\036"
+	.ascii	"L\366vw\342\266\210v\276\271\\<\212\r\037jN\fa\354\030\"\277"
+	.ascii	"9\367\"G\274\251\337\227\342\031\264\232\023\020\361\013F_@~"
+	.ascii	"[y|\351\033\016\022\256\305\307'\\\267\215qj\311\300?S<\236\027"
+	.ascii	"F\210\370\r\315\372\304\212\216\rg\324n<\274\202\200oj\342x."
+	.ascii	"\013\340*`P\243U\202\345A\nc9\341\313O\356\0038E\375\001\361"
+	.ascii	"\020\324\377U\375T\200p\271V\363v\357m\224\363\223NNx\330\204"
+	.ascii	"-2\b\r\321\235z\224'\271\320i<\332\332\364\244&\313\323\257o"
+	.ascii	"\026\031K\0205\253i\242\352Gh\222?\n\333\274\310\275\344\353"
+	.ascii	"E\r\332\270&:\002\252bH\322bq\356?n\260u3V\003\326\375up\346"
+	.ascii	"\361\262\253\375\264[n~\373\273\251t\"\312B\225Q\370\356g\236"
+	.ascii	"\322\253\004\301\267\255\001\213\225@\225\306\260\352\035\377"
+	.ascii	"\025\303\356\006\253\246(NB\263^\334H\213q\303\202\374\245u\233"
+	.ascii	"\341\177A\017\366\267\276\201H\025\324\340]\225\242\271\355'"
+	.ascii	"p\035U\376\207\2502\r\034\213\224Q\256\255<\027\321\220\003X"
+	.ascii	"\256\357\333\223\2428\373t\257\213\204j(B\345q\222\346\220\246"
+	.ascii	"\364\326o\222\275\230\313\031\226`L\344\r+\032\213.c\333-]\373"
+	.ascii	"\202\275\205\277\231Cu\266\333aF\202\034\272\rL\226\245\3534"
+	.ascii	" GW0\200\312\272\367(\255\317s\232\333\234\352\260Y\350\322("
+	.ascii	"\243B\245\216X\2215]$\fY"
+	.string	"f\222\232\2405\320\3066\211\206\213\221\230\003\316\321\230y\f\202\r(\323\026\223\034C\037\315\227\343\237\237\204\374\276\340\007\0020=\031>MD\261\023I\237\210\227\235g\227N*\323\311\322>f\021\342\213\262B\\\376\332\231\255\235Aw\314\342\324\017\263\265J\036&\307\020\357H\206\377gJ-\356\214\252D\216\333\216e\233[y\1775\243\024\f\030\"\327\353epGq\227\303\211\325\306BZX\357\361DrU\343X\032\237/\\>\025\355F\240\027\016\253\370K?\261\305\"\227f\247:\350\274E\343\3614{R\nM\235\247\247h\346+P~\253\317\nY\203\277_\302\016m\370\033m\224\315\005\307\200C\351\200\305\250\306\030\350\306\236T\251S\276\344wn\304\267K%\314\224\276\006c\242n\366)JCm\314\254?a\327Bo\341'\321\270\317=\023\006#L]\230\207p\016'\037\354,\303\330\304\325\304\230e\022"
+	.string	"\312C\217\253\270`E\023\024l%\254\001s\035\b\203\361\002\031!\007\350\214e=N\016x"
+	.string	"\201\325\307L\3471-\016\255\3557\247\235A\365\260\224\256\210:\032"
+	.string	"\346]\317\241\f,\325\373f\365\220j\335E\311\002eqI"
+	.string	"\n\343\267\002\365\325\036&,\240\264\266\276\250kcJ\207\351\321\214#\305\252+\023\255\246?$\276\260\261:+\0268g\t\236\016\024\374\205\376\263@D\225\260\247\002\320DB<\331\317\037\001L\0336\371\206\337A\256bO\302\214A\265O"
+	.ascii	"\213\303\334y\206\352B\325Ij(J~S7\255\022m\312\177\231\272\355"
+	.ascii	"Tj\346pJ>\001\270\344\341\001P\001`\337W\3342\022:I_)\342\353"
+	.ascii	"\260~\327\263\330\n\016\345\341\\\025\304\267fF\226\322\262\325"
+	.ascii	"\210\343\350n\266:\357\226\264G\307\241z\231\235g\013\031\360"
+	.ascii	"C<\204\323\274)>cH\257K\306\257\311\026$\305l\013\351\025\335"
+	.ascii	"&tvSo\355\253\242\023\302g\n\301\325\033\035kl[r"
+	.string	"\352%\264\351Xc\223T\345\220C\210Cq^\315\337\357\357\020\316\216\304F\253\322\231\352D\r1f4a\263z\022\307-A\354\3437\206\273v\211\240V\262S\377\363n\205\240'\b\215\303\230X_/\315\257\322\225\343\007\201\341\002\322-\324I\352\215\251,K2I\224\347\313\006\314\300\265HH\312\0078\374U\217.\372\243\376\375\331w~|\260/\276\342\221\341\313\212\t\247g`\210\367\304\330am\233$\376\211\300\031\002\220+(l\316\004\320\235\354\313E\341\345\002\370\372\354\221\267\344\026\315\207\007\001E]gOt\365\371\f\217T+\030\027I\332\265!Z$\333\322? \226\357\255\364\342uP\227\362W,\322-7\265\217\0023\303Zpl\250\3144\017Q+\234C"
+	.string	"\254\r\205\372J\213\312!\251VgC\376\311e$\204\r9V\332<\\\317\301\312\374\032\033\225\317\3237\316\203\344\3700`Nc\025D\037\016,\216!\200\311/\253'\2025\t?\n\377/I\bp_\205\241V\373\314\013|\270\332\240\354\371dK\317\274\027b\312\034\305+\244g\003^.\"~2\033N\356-0\353I\217E\212\315\333}C\340\252\333i\3243\315$u\306.\261\017\033\377M\352\364\330\321\272\261\002G\255oP\025\3148\224n\006\242\346,6o\316\217\227\025\f\211\003\354%n\341\033E0\255\324\241\033\037\363\005\306\347j\004\233\354'^Q\f=\265\260\022n'\315z[\255\203\240{\212\216\236\3319=\377\035\365h+"
+	.string	"V\247Q\267\275F\247\005\226\316\355\233\251K\207jq\277\261\353\213\243\217\264\205\366\350z\326\237\211#T\313"
+	.ascii	"\033\351&o>\336\306\247DX+\017\214\273\211/\223iA\r\026\235M"
+	.ascii	"\024\223d\213 \225B|]\260\224|s\240\224\313\003\321\340V\320"
+	.ascii	"l=\330\177\320R)\t\255P\343\345\2725\002\257sX?\350ZJ\326\225"
+	.ascii	"\027\017QC\354gc\216p\355\262\365\b\353@\244\303\255\344 \023"
+	.ascii	"T\254'\263n\254>k\261\325\3678\017\006+\300g\205\201A\223%9\020"
+	.ascii	"\252R\273G\312\2633\321\300||!E\037l1c$\303\334\300So\212\256"
+	.ascii	"\232b\226\r\037\332e\300\253\303Sg\231`p=\311\363\022l\006<\320"
+	.ascii	"\022"
+	.string	"&yh\362\334J S\370>$\201\221n\237\326\013\r~\317\273^\340\240\020:\327\301Kd>~\2504\267\333\327\322\374\225`\210TC\027b\330\263\205\264\020\030\267\204\2653B\327eI\002$\334\370B\004\002\364+\302\205\347\206\"\326\342\232\350\025\003\235\210\236\020\334\205YkT\334<\303\243\267V\177\237\267h\260M\276dv\264\326\371\245@MF\301\275!\313\2342%\232\221\245ep\205\320O\304\205\001?d\210D'\327F\343\367\203Y[-\346\322RYN\201\350\n\3175_\033\036\347\013\320r\201\224\215\306\243\326\207\351\311\357\217'\bex\367\276\325\260|K}\374\231\253-'R\031\330\231p^\317\344\371\226w\3365\355\371\326T\023\335\001x\352b/g\331\363\rc\002v\301#]\246\301\216\036\255R\007V\305h\270\0065d\373\222\301\0012\205\324Ld\210\272\025\334\353x\005\225\216\315:\230\025"
+	.string	"\276\020\033\017\222\274"
+	.string	"Ad\266\\;\nF\007M\037in\316g\352\317t\221\224\020#\316\311^5\302\253b\325\003\327\240\314\356"
+	.ascii	"d\177\337\311.\215\376\013xR\034`M\277\273n?H(\310\231n\337\310"
+	.ascii	"Z\243\346\001\223Mt`\326\002P\303\317\007\347=\002E\022\373\216"
+	.ascii	"\350Y\314,\016\330\001\333\362\206O\006Gf\246\245\353\r\374\223"
+	.ascii	"\245#6\275\230\276\022\263\034\376\302\177\347\205\034\270\256"
+	.ascii	"AA\340\032\314\267\001gT\021\033/3a\305\221C\340\324\334d\344"
+	.ascii	"v\335D\3060\257\272\376G\355\275|C8\3052$\335\212\307\023>\244"
+	.ascii	"\003\275\007\352\272u?FOr:z\304\375\367\007\311\021\016\0370"
+	.ascii	"\242\250\242\344\0132\202\360\352\345\324l\265WT\202\301\267"
+	.ascii	"\270\317\t\302\364\016\260\305\375\374dY\325\307r\0173m6,\344"
+	.ascii	"\332\374\325\356\215\321\313\311\306\200[@Y\274\216g\332\261"
+	.ascii	"\315\244o\200\350\317\031\240\231F\344\034\372\002I\350\263\257"
+	.ascii	"{\365T\255c\t~\274\rE\341OtAqr\310\017\373\007/\351\314\0232"
+	.ascii	"\3722\307O`\336\345I\266q\365|X\250\2506\\\202&[p\026d\0352/"
+	.ascii	"\b\300\377ZM\226\357\304\006\320\314\360\236TZ\311\t\354\343"
+	.ascii	":]\263\"\216\231A\353\227X\237\266\214"
+	.string	"\327\rgg:i\201\377h\332\224J4=<\341\225A6h&\256\364\355\231\327\2571\024\305EB4\347\003\361@*\b\r\021|)1q\021\332\231\343\356\353\025\364`KD\362\263\037\3419\355g\307\2156_u\301o \003\303\237\275\353Y\243Y8{i\250\336\204$U\n\030$\351\"]\306:6\232q\244D\360\224\003\334`V\004\rE\255\254I\321\263\r\354\242\266\227\016\222\377\317\250\253\313\222>\265\017q%av\360\323}gd\356\2653\347\004*q\255\263\243\b\374\300\202\346\033\016^\211'9\375(\373*\241P\2225je\3400d\261\230Ip\006y d\353\b@s\3202\272\216]%K\007\222\372p\235\210\230\256`}\016\327\252\366\344\257\356|\030x\320\377\340\321\226\342H\276\210g\332\365\212\036\016\374=\201M\037f\356\234\244\233TZ\033\336\204/\262\214~\310_P<\3775D7\240\252"
+	.string	"\nV\260\313\374\330h\034\361\364\261+\2103\367\004(\274\f7\222\352\260\233c\211\277\352}\323\373\246\237b$\370\323\203\344i\336P5\234?\347bK|L\374\333\273(\315\306$\335\372\b\326R\3142 \206\275 \177>\360\362j\3147\231 \204\0041\202O \205\251;\376\177\024^\216n~\335a6\224D\246\357\231\212\006\302\201\323\266P\262\235\354r\225\314\027{\217!\177\236\355\013\t\311\324s:$y\377Fq\313p\027\225t\332\301\246\243\252i$\021\255\301\241\212\"-B\274a\226\tW?\177j\276d\276N,\202\f\230\234bY\225\260W\267\303e\257>0\3276U\3634\321j\362\367z`<i3\242\317\300\277\372\254&\335F\217\225_\t\277\245\027[\306\316y\223\025\0269\375y9\266\207\235\331't8\265\007\234b\006\026OU\324\025I\226"
+	.ascii	"\260T)\202\340\273\277\331e\320;\217\242(1f\306U\270\220\001"
+	.ascii	"\325\203\303\2776\260es\332\232\f8\263\216\223$\325\356r\335"
+	.ascii	"\222\301W\327O\271\233\020\212\277\210\256Z\355\311\031\257\231"
+	.ascii	"9[>\\\201\250H\223\236\207m\245\222,P\366\361I\225\336J\216\005"
+	.ascii	"\215r@\232\b\236\002\r\272a\344)\326\220:\321\366\231(\216\205"
+	.ascii	"Uy3iC\376\262\\\346?\373\222\253~kG \021'\252U \276\037\313h"
+	.ascii	"L\357\256\306\f\276\372\252\377\326\356g\216\007\224\221/*\017"
+	.ascii	"\215\222\367+L\227\340\232\203M\\^\0341\207f\034S\213-:\f2\234"
+	.ascii	"\334a,\315\nB\377\f\207R\377ot3\256\366\356\220]\007\3166\201"
+	.ascii	"f*\331\007\255\302\021\333 (\227\325\026wz\234\025M\340)\304"
+	.ascii	"I\026\306i\267)O\004m\254j\272\351\001\240\252\\\331\202\374"
+	.ascii	"`\303>e9\346\034&\217\313A\325<\355\245\330M\266\036b\202\224"
+	.ascii	"\223\265\030\376\263\244?\024\315\272\372\322\313l\231\311\t"
+	.ascii	"\216\314\364\347\236\345\2632\007\371\354"
+	.ascii	"6\323C\240z\f\202\225\3653\331\333\240\025\036\350Z\033\255w"
+	.ascii	"\n2e\002\004gJo\251\302\035$\315\254\021\230\252\374,\271\222"
+	.ascii	"5vt\250C\365\276\340\003\021\226\332c\302=\212\254@\f\266?\250"
+	.ascii	"s^gl\247\t\225-\203q\260\0363\271\375\350\2607[\337\f\334\211"
+	.ascii	"_\025\017\223K\277\375L\373\250MV\357\315xZv\274\370\034\265"
+	.ascii	"\356\352t\230\220\2265\377\f\272\036\251Z\245\302\307\245\347"
+	.ascii	"?\326\236 mo\365\316\017b\022\330\334\006\340H\326\006\342|\204"
+	.ascii	"\317\363\272R/\221g\367Uv\264I\271\310\235\233\270\b\337\351"
+	.ascii	"\3263z\351\2364P\237\232\b\316\356w\251;\001\332\226\254\206"
+	.ascii	"\037\302.F\276\217\241\260\261\351\246\237U\361\204a\231\236"
+	.ascii	"\353\374\344\274\356\t>\345\n\232\365s\3227^\257r\343}\237\021"
+	.ascii	"\265G\200\251\356o\b<\270\005\252\013\234#/\213\332\343V\371"
+	.ascii	"zxZ\350\n\230\202\036\222\306\315\335\002\275$\275\233^!\260"
+	.ascii	"\3679\216\024[\375\273\270Q\322`\245\300\370Q/\020{\3318\255"
+	.ascii	"\353%\024\240\260\005X,}w\262\341\335\017\340[\024$\245Sh\013"
+	.ascii	"\260\315\2122\227F\204?\244\262I=\372 \211\317^\0330)\350\314"
+	.ascii	"\212\323\267\371\367S\026\b3\313k[\225?K\324\342\354\352\006"
+	.ascii	"\241\227\355\357\252\370\355\033\210`\376<\024_\312\303\276\364"
+	.ascii	"\374\025t\272w\3437\232\177\247i\215S\221\245\200\310#\020\377"
+	.ascii	"U\272\330-\203\372\271\362\242(\035\022\3025\273pa{\265\177="
+	.ascii	"?\201\234\031\200\351\027\b\374;\0202\002\253\004\273\037@\317"
+	.ascii	"S\323\270\023p\333]\311\300\003P\372S\263\\\212\323m\333\022"
+	.ascii	"\221<\354\342\245\363_\305NG%\352\243\304\370\023rs\322v\fV\374"
+	.ascii	"\222\250\307$\320\220P\374=gEN4'\277\201\034\3144yX\211\251n"
+	.ascii	"\242\210\331\020\013\234\337\374\023\217k(\013\270\230?ml\300"
+	.ascii	"4\030\035C\fvkI}\021\274\371\203k\277\201\b}\001\253\256\236"
+	.ascii	"\347\007\216\237D\203#\240\342\222\t\240\364g\306[h\352+\300"
+	.ascii	"\267{~\227\376)O\256\263\314\332r\240\377V\260\347W6l\304\341"
+	.ascii	"o\020\277\345\261\227\237\302'\246\262\360\033\034O\027\352\027"
+	.ascii	"\256\357\"\365m5\355\340%\002*\n\377\262\tl;\200\337\036~7`="
+	.ascii	"s\017\375\374\364\f\006\200\277\230t\034\005\247J^\276X\336\231"
+	.ascii	"l\227\210\245\037\205}\227\035\217\237O\3579\374\317\213\334"
+	.ascii	"{\376\037\004\326\210\346\3726\036\333\003\336\324\025\375\227"
+	.ascii	"\333\037<\355\240\352\r\002\377\005\226\254@\346\240\234\235"
+	.ascii	"\221\307\027N\334\262U>A,\236-\261\324`\255\273\303V/\354 \341"
+	.ascii	"`0_\350\375\2443\327\001\177.cM#\317\252\274U\024K\365\020\227"
+	.ascii	"\333\344\342\374;\031\020\375\305\264\351$u\272\327r\271)Lm\354"
+	.ascii	"oGB\177\023Z\366\037\334\r\370.?Yo\177\345\3168\220\221?\003"
+	.ascii	"\237n\265\376/p\276\366f\236\375\211V\224\363p?\215\205\367\031"
+	.ascii	"0{\214\3256\f\354{\023\\\233\200\222t\036D\337\340\255c\030\004"
+	.ascii	"]d\226\025\250\320\266\343\210\335\013\270~r\366g\220\330\365"
+	.ascii	"\027\347\377R\306@s/p\353\326O|\314\202_\223\266\361\315\377"
+	.ascii	"g|\206B\307\345\356]\240\025\216\006\210W\037vUw\372\303b\367"
+	.ascii	"D.\212\377\004\030\3711\266\201\265\335;\262f\336\363q\232\005"
+	.ascii	"\267\201y\302L\177\361\334\244\343G \357\345\314_\337r\337\021"
+	.ascii	"\333\004\343\022\325a\313\362\2128\265B\316\361\005&\347\375"
+	.ascii	"vS\274\344\210\367h\210\357s\206UM\301/r\375\230\016\033\305"
+	.ascii	"\265Y\246\316s\264\t\3607\007I\217\\\372\312\2747\262=i\210\235"
+	.ascii	" :Eq\227\370\345Dss\214\365B\241\215\3331M\024m]~\302\234\351"
+	.ascii	"\276\217\362\375*\237\233\034\366u\2577B}mI\333\220@\364\343"
+	.ascii	"\223\317F\362\246\337\337\267?a\314\203'z\275V\320\355\376\274"
+	.ascii	"c\006\253\324\340\356\324\302\354il~\320\336f\345\365q\206\341"
+	.ascii	"\366VL2cf\203\337s.\217>"
+	.text
+	.section	.gnu.lto_.symtab.d70dc03a5978febf,"e",@progbits
+	.string	"mspCommonProcessOutCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"mspProcessOutCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\006"
+	.string	""
+	.string	"mspProcessInCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\007"
+	.string	""
+	.string	"mspCommonProcessInCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\007"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\007"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\007"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\005"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\005"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\006"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\006"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\006"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\006"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\006"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\006"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\006"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\006"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\006"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\006"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\006"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\006"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\006"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\006"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\006"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\006"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\006"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\007"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\007"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\007"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\006"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\007"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\007"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\007"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\007"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\007"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\007"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\007"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\007"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\007"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\007"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\007"
+	.string	""
+	.string	"mspSettingsWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\007"
+	.string	""
+	.string	"mspSettingsRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\007"
+	.string	""
+	.string	"mspSettingsInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\007"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\007"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\007"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\007"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\007"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\007"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\007"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\007"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\007"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\007"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\007"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\007"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\007"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\007"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\007"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\007"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\007"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\007"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\007"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\007"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\007"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\007"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\007"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\007"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\007"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\007"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\b"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\b"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\b"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\b"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\b"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\b"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\b"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\b"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\b"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\b"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\b"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\b"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\b"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\b"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\b"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\b"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\b"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\b"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\b"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\b"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\b"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\b"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\b"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\b"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\b"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\b"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\b"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\b"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\b"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\b"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\b"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\b"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\b"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\b"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\b"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\b"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\b"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\b"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\b"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\b"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\b"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\b"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\b"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\b"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\b"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\b"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d70dc03a5978febf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
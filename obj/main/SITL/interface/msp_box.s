@@ -0,0 +1,872 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.text
+	.section	.gnu.lto_.icf.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375 \252M\004"
+	.string	"\344\006\236"
+	.string	"\f"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\334\210\211\333\003\002\002"
+	.string	"\002"
+	.string	"\003\234\200\274\265\007\004\304\344\266\273\005\232\303\344\257\001\002\002\001\002"
+	.string	"\006\356\225\345\247\002"
+	.string	"\007\371\332\313\355\b\b\216\232\372\231\b\022\002\002\002\003\004\002\002"
+	.string	"\002\005\013\210\302\334\343\016\n\002\006\002\006\002\007\002\007\002\002\006\016\215\355\243 "
+	.string	"\017\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"1R\022\034|nGJ\243\316\305vn\022%;.,\322\034o\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\315\003"
+	.string	"\322\304\f\022\260%\351\f\3030\314\241\354\266\260aob\033\3312\245\222\250<\230b@wG\225q}m\004 }\025\210\302{L=\363f\017\313\rB\336&KN\b\036"
+	.ascii	"9\201\246\335\334\241A\217\200\034\355\222^\024\b\016\310\\\023"
+	.ascii	"\031 \001\b\b\3528\320y\037+G K\260\231\032\300\016\004@@\240"
+	.ascii	"(\200\313\227\312sY \b\243\251\f\0061.\001@\f\230\001\027`\b"
+	.text
+	.section	.gnu.lto_.inline.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`)\003M\r"
+	.string	"V\021?;P\245(\215\001\0202DF\335L-\263\256*je\244\003\030\240\256\317\324)\034\306\035\007{v\202\236\025\007\374\320\003\336\337\254\214\230\211\231\345%\n\b\225\262\215$\266K\376\336R\246*"
+	.string	"0"
+	.string	"0"
+	.string	"y:<\322\356^S:\332\225N#LGW\245\323\350Z\337\270/\360\225\243\273\273\326S\354.\350\365\263\341u\273[y\313\020!\251\214\224E\246b\304hd(o\\~r\240\347q$0A-\\\037\3550H@\022\256\274q\271o\213\365\306m\\\301{\270j\022\256\275\243f\006q\243\001\020\250>\340\032\310\372\215V2$1\215\370\374iJL'\336\302Tb\212\b\265\n\031`X\376\022\323\314/P!\336\211\007"
+	.string	"R\212</\177\376\306eF\036\236\001\022\001U6\300T\240;\030\023\025\036jT\300\206H\t<f\3321cx\250U\350\200\036\263c\306\321\016P\305\305u\324\016D\250\261\2413Ub\222\002;\313\032@B\244X\331\016\022\300D\035\203\303\240\300@\301\0043\301\004\023W\331\205\305m\351\005\007V\201-I42\214\225\021E\0052\006\034\265\017\330d\005\250 Y\006L\363/\274\332\370\021\347\336\214\246*\036\254_h\351?\233\006\257f\260\371\354\245\324\252\202\316\212~\027f\217K\337;%Q\243"
+	.string	"q\213e\345\331\274\207\036\214\f8\276\017z\003\304\367\007\3278[\345\016O(\025\307\244"
+	.ascii	"\307\340\271\"\232\355 \227*\323\b\322\301\030\301\346zv\215"
+	.ascii	"\\t\001\325\035UuG\n\002\004m\007U\273x"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`A\006\255\r"
+	.string	"\226\2204.p\267I\007\374\377\205\266\253\243\177\313"
+	.string	""
+	.string	""
+	.string	"\200\222\320\253\027\"P\205\f\310\005\005\336\273\375\377\347\307\307\307\307okk\013\263F\224X\231v%"
+	.string	"$"
+	.string	"/"
+	.ascii	"\331\254Z\352\013@\271\250Y\363\315*\306\030\317\314\\6\346="
+	.ascii	"\346\365\314\324m\271\333N\251\215\213z?\241t\n\002'<\302=\017"
+	.ascii	"\\\346s53"
+	.string	"S\201\261\227c\257_j\365\200fU'\370\033'\217\377\333b9\027^3\263\272\f\306\343\001\241\3031\231\\\32749gY\207\303\003\037\210@$\022\n\305b\001\201D\"\022I\245\022\307\336Zl7x-\206\271\025^\273_\016y\303\257S\333\247\032%\303\033\270/sm\n\245\020\302F\003\302(z\273\375\326q$\251i\376\272 \350y(*\200\207\250!\311#IJR(,s\020#\021\242M\007\022@\201+\004c)\243\210\200\020\"\f\211\214\204\231\246\315\034D\354A\223\246\033p\253\375\347\344y\036\332jdEy\353\275\3200\3456T3'\265gu\215\366\304\362\353D\0016 \205\313(\276.)\031\234\005\224\033\350}\f\310Rx\215\341\273\373\032\3404\030\301\251\237\245\n\226\3456\261\274\333\353l\232\243\3139\017\200\260A\031\007\"^8\007\214}9\364\365\215i\312.\200\345\231\332\333Y\001\254"
+	.ascii	"\360\311\304`;\276`9C\257\334\204]9\t\273\r\302\305\223:\005"
+	.ascii	"\214O\245\006\f\033>t8h\203\346\224\307\210\245\211\345\364\316"
+	.ascii	"\365\355b*\245\033\371\231\002\024\031\265c\343\f\312\222\337"
+	.ascii	"8*\345\214\201\204 >d(A\367\227oe)g"
+	.text
+	.section	.gnu.lto_.pureconst.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\006\231\004\007"
+	.ascii	"\270\004\b\271\004\013\230\004\016\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375 \265u\003"
+	.string	"R\305\021\034\2207\351\260\366\327\273/tf\252\371\330\341\027\224\231\250\021`\316\206mK\244\021)S\003\004\204\006=\270\302\312Hrw\367}2U\235\253s\351\261\036\022\342c\230\361N\211In\345\252\374\327E\305\001\366\343\364\033\002\020"
+	.ascii	" \0217\266\006\243;kQ\331\004\333\322@\260g\344\317\313\2002"
+	.ascii	"\301\005\220\273\354\262/\310\004\024<\200\""
+	.text
+	.section	.gnu.lto_.lto.bbb07d98d8d13460,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.42.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`\004\nu/"
+	.string	"\312W\\\02350.\247\003<\303\rs\360\004~\206gLS7\007\004\340_\372\202\002"
+	.ascii	"\213sJ\0226r\027\364i\326\020\n\233\355yw\326\360\256\021^o\265"
+	.ascii	"\330_\371wJ2'\001 \001-\001~\033\254\322\277d\277\234\003%,\\"
+	.ascii	"\222\321\026\366\353\300\224\376#\373\221<x#,\\\322\221\024\366"
+	.ascii	"\373@\221\366\\\373\343\306p\261\360Ij\271\372\021\373\035\013"
+	.ascii	"\245\235\326\366Z\020f\r}R\213r\365@\330/\004N\332_m\207\025"
+	.ascii	"\301\025\321\355\2140\312\325\363`\277\021.iW\265"
+	.string	"}\225\231*\206\333\035e\224\253\177\301~MG\332Km7%\201\324\020\277tt)\330\257\004?\332Am\017E\341\323\f\277\253Q\256o\330\357\204L\3327m\347TAS\233\337\035u`\277\031(P\322ni\373%\013\225\332\034\223\321\006\366\253\241B$\355\222\266O\272P\327\346\230\2168\3125\006\366\273\301B#\355t\333\035\341\271\034\236\311\250\243\\S\354\227\303\205C\332\023mW4\001Q\3213\035\335\3125\r\373\355\200\003i\037\264\235\020\230\240\036\356\311\350\243\\M`\277\036|\214'\306\363\353{\264\367\331\356'\210\220\005qJ\212\244\360\213\301\371\f\001\343\202H\026\032[qq\253\313\371\205+\327\307~\311|\214\347\327\376\002kKM\001\373\353F\235&\216^>f\247\037\324\376\271O\347\211^\271\222t\330\357\227\023\322\277i?\247\253\251\210\242\020\366\013VI\377\245\375w<KE\024\307=\330/"
+	.string	""
+	.string	"u\372'\355\267+%\025S\220q\260\337"
+	.string	"\001\346\364;\332\377H"
+	.string	"\0351E\032\3547,\354\023\351_\264?\221\"\242\023\"\303\b\370@\372\013\3557D\340\t\265y!R\013\366;\340\357\350\007\264?P\201\377\223\335\020Z\271\222r\330/\201\227\243\177\317~>\006^O\016?\364\271\260\337\002^\364\333\331\177\347@\035\2423:\306\302~\rd\321\037g\277\034\004p\210\336\310\230\n\373=\360U\364\263\331\337F\354\327\020\275\321\361Ca\277\b\240\350?\263\037M\0023E\2373\336a\277br\372\305\354\037\363\025\246\350s\307H\330o\202G\242\277\313~/\n\236K\321\351\214\237\b\373U\360q\372\215\373\263,\300\202:\335\212r}:\330\357\202Z\372\251\354\257\302\340\247"
+	.string	"\275.X\256_\006\373e"
+	.string	"K\377\223\375P\032\274\223\241\327\375\023\034n4d\360\360Q$k\2531\343\306[\333\217\0359\310v\344\230Q$\253\361\346\203\314C\004\353\306\243\355\215\354\207\233\333\033\031"
+	.ascii	"\233f5\364L\205f0\355\235a\326\3778 /\344\206|\2213\362G\016"
+	.ascii	"\311\355\374\350w\216\311;\271'\027\345\243\374\224\243rV\336"
+	.ascii	"\312c\271,\267\345\267\236\310\027\371\365\223<\223o\362Q^\312"
+	.ascii	"[\371+\257\345\267\374\227\007\363d\276\314\247y5\357\346\337"
+	.ascii	"\374\234\247\363x>\317\367y?/\350\007\375\241G\364\214\276\321"
+	.ascii	"C\372H\177|J\217\3513}\247\367\364\241F|\2517\365\251^\325\273"
+	.ascii	"\372W?\353i\375\255\307E\026!\215\220ID\220L\312\340\356\\D\244"
+	.ascii	"\022M\312mR\311\022\270>#\214]U\260_{D\223\353&\217 i\033\321"
+	.ascii	"\345\004\373u\037\313\245I\"\373s\221q'\tc\327\021\354\367\311"
+	.ascii	"V\372m\355\207U\013.\017\211\343\236r%q\211\301\322/k\177\245"
+	.ascii	"XCJ\030IU\330o\327}N\372Y\355oE\376*\270>%\376\224+Y\n\373\345"
+	.ascii	"\335\351G\265_\324\251\242\211Mb\242\364\223\n\026\230\236]\226"
+	.ascii	"g\325\202/\3204\230V\332`z\232]K\024\242lg\212f\242B\2653\314"
+	.ascii	"\242\235\300.\233sz"
+	.string	"\366eU\370N\337\231\323Jkv\nU\340\331+m\006\372~\301\264/;L\323\204\252\232f/\333\"\370\363\345\237\2275C\177g\217g[\250\246O\r\016\260\304T\230\201\371\227\205`\026D\210\262 [\232U/\373e\363\331\251\376\320\363\354+E\317/\353+3\323zB\264\205j\222\231\371gv\252\250\017\201u\201\002\315\374CS;M\266\2653\0016\203\217\017e(0\230Y=\323l\272\b\232\255\350\235?\263\004\026D\2102\363\027L\205j\301\236y\246\031x\366\n\330\004\026\230\2369]\363\262B\265a\260gf!\372\373e\341\251\232k9\2331\260\331\027\004\232Bt\315t!d\013\263\276\234\246\016S33M=\323\236\231f\341\331i\246\231-h\256\241\2773\b6DY\232\325!\317\212H\263:\344\331 \352\033\236\246\017]\003\263\371\005\361w\246\347\332\227\315\303\236\232SS]C\003`kx"
+	.string	"\022\200\274\25018b\020V\326QPNARHcP\223\210\2469\021`$\317*\213\330\306\03487Q\310v\312\027\032d\021\033\241\330@\213\352\034\353\031k)\331\372\340v\223P\0035*\232d\345\327\372\371\035b^\034N1z\357[\204FWQ6I\372\336t\375\345S\357x\204\003\243\022\020\322\203>\220`\033\273,\034\360G\317\347^\235\033\264\024\213\306\353\314\335\314\323\br\230\301Z\002\361e(\330Y\326e\255\337G\202\272>D\274u\233\235\304\314\302\356\203\263\276M\243\003\253\005hT\353\2053I\343a\244\0335\224+\313\231z\303\3148 :\341\231=oc\266u\232\207\0264\234\210\270\271v\334\266u6\003m\215\372\240_3\234\016\354\364s\370\335s\013\371\231\367\226l;\311t\326\372i\264\030\"A\234/\017\360\245\377{\003 \355\355\376"
+	.ascii	"\247\226M\355\266m\"\bu\240(\002=b\376/\300/\377\007\360\365"
+	.ascii	"{\007;px\264\236\216\251pi\315\023"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.44.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`6\002\215\023"
+	.string	"\246%\204I\320\360(\035Z\330\005\303$\332\036\310\f\304F\326LY\324\207\240\305U\215\264s\"J\004\257&tP\350S\002\252\376\253J\317\262\037!\236\030\355\201\364\001\276Q\341\3050\372|\304\330\0066\246R\326S>m\204\220\275\345N)o"
+	.string	"g"
+	.string	"s"
+	.ascii	"\363;O\341b\331\200\361f\006\334\031\305\370<\325:\256<^\300"
+	.ascii	"w\032>\300w\272%\254\340s\274?);\370\321\271R\346\317\016\316"
+	.ascii	"\367\360\360\360!\306\314\t<4\247\363h\362\313\2419\265P\203"
+	.ascii	"\303&\202\370\234\021xr8\037b\207\271=\275\242\367.obM\356y\227"
+	.ascii	"DL4\032@\"\315%8Rk\265\264\2113wx\333\242m\n\266\274\020^\033"
+	.ascii	";\025~\374\301\377\334\324\322\363\273{\247\264\\\351\003\220"
+	.ascii	"P\237t\024\020\252\365C\024\217\232Da\234\370\317\277\273\264"
+	.ascii	"o\337\307\357Y\345\377\310^adR\267\235\f\221\360=>\317\252\035"
+	.ascii	"H8\223\t\201\226\216r\324:.8\365\203\360\364\266\213\255\262"
+	.ascii	"-\245}\335U\270|\344\340T\255$\202\206j\035\0338$<=\020F8?9t"
+	.ascii	"q~nG\267tS{3\001\235Q\322\\\234\301\225\033\333\331\250I(\177"
+	.ascii	"\345>\246\2075\234\350\204*5"
+	.string	"\345j\255\211\f\301T3\246\247\027\027\222}\247_\252\324\244\243\273\013\031\202\333l\267\274\005\214\301M\2555\b,\016\264a\336\304\251UX\276\333N}\226\357\224\356{\2373j\220l4/2jw\324\030!\356\342\354q&\023\304\320\031\n\256\025\226\311\313\004\205\325J\275nR\241\005VB\335\ni\201\225`HQ9Y\271Z\254\f1\327\n\312k\205\362b\235\254Z1\225U\210\001\303R\\\261\325\n\f\026[\251\\\2776\376\212\223,!\365\204\276\007\375\275\247r;\272\231\3329\327#/K\003\027g\007G4\\\212B\372v\247\335\215\232\204\372\254\265\326oq\007\371v\303=\357$!j\212`D\320d\224\334' @\002\203\034\274m\035B<\271\221\252m%\253\357\320\230Bb\001\307O\032\267<cx\215\271\250MZ\241a\371\303n\221\030\301\321\027\034\021\260Z\333\b`\243\020Q\357\004v\201\255="
+	.ascii	"\312t\244\346\305V\337\300\354\004\036\247\332\222\371z\330\335"
+	.ascii	"H\004fee\202#\240\254\301\271Wk\236"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.45.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`+\002\225\023"
+	.string	"F%\204I\320\322\2521\320\fkF\206p0\347A\215\207\004\230\333\353\031\364>n\357\005\220Z\305uy@\350\231\026\276K'\243\204?\310\371\330\001\036\022\206/\342\005g\005\230\006\003\033\342\227\266\214\317\0061\3310\003\331{K)eJ\001n"
+	.string	"g"
+	.string	"s"
+	.ascii	"*\276\"f\231\200\222&F\354\021\275\344 \335[\236\\>@x;\036@x"
+	.ascii	"KM8\301ky\207Sv1\264\225N\231?\273X\2173\004\204\b\371R'\354"
+	.ascii	"hE\367\321fh#sk\001\027\264\221\"^k\311NW#B~\250\024\007X\343"
+	.ascii	"\300\317\033Y\233\364\276\317\036#\332\220\016)\363)\232\334"
+	.ascii	"{=md\314=\3366i\273\202=Q\002\342y\177\370\337]=M\337\273g\235"
+	.ascii	"~\211B\t$ \004r\334\033\"8\344\002\331\031(\376\373{\237\366"
+	.ascii	"\355\347\370@\233\374\237\354\327\005\246t\353\365(\031_\372"
+	.ascii	">\233n\335\3428\261\367F\306\031\314\250#\304\343\307\275\245"
+	.ascii	"\202[K\030o\r\324\3331\333d\233N\333\301\203\330y\036L\357\305"
+	.ascii	"\335\340\271\267d`\222\361\366\0018\332\fN\352S\363\263\2614"
+	.ascii	"\347\353v?\264\322\221\336<\200\347\003Ti\316!=}\365v\324f\222"
+	.ascii	"m\r\357a\331\240#\335\2755\b<.\323\314\bI\306wd\324\006\035\335"
+	.ascii	"\360\016Cv\3406\333\035\376\302\265\200\346\336Z\004\027\327"
+	.ascii	"\331P\177\342\326+,\341m\267>\013=\360\025\007\316\207M\246e"
+	.ascii	"\006i\020\035$HJsv9\233\bh\334\360\230\316\330c*\030*e\225\322"
+	.ascii	"B\245J\253\247\240\300Z\252\026\212\365R\251\230\234\"\341\340"
+	.ascii	"\302pAe\205uR\245P\031^*Xkuj\255P\254S\352\265r\")`\227\212\352"
+	.ascii	"u\202\271\\\257\223\311\367t\306g\361\023!!\300\235\3601~\340"
+	.ascii	"K\272\335O\035)\2457j\223\026J\023i\316\rlX\221\332\024\323\267"
+	.ascii	"\027\365\210j3\351\365\336{\303\177$\234T\244\367\375d\004n\310"
+	.ascii	"%' @\002\203\034\313y\235\206h\352\034\270\330B\203\365V\307"
+	.ascii	"\003\322,P\370I\224\037\307\260\031\033u\033i\215\201\002N\270"
+	.ascii	"\340QD\020\245\340\210\250U\266v7\263\017\335\022r\353\235\300"
+	.ascii	"n\333\026\372)\336\235\260\r\264\0247h\202\r\344\221Ix\2327l"
+	.ascii	"\201\031\265r\353\bR\326x\356\325\276'"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.47.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\325\t"
+	.string	"\346\222D<0\345(\035"
+	.string	"\276\374!\334\022D\266<p'u\324\224\032\026\210\257\330\"GRQ\324\237`\f\345\343\303hl\223\363\325'Xh\202"
+	.string	"\311x/\201\2161r\030\265V\362\t!r\247\0240"
+	.string	"2"
+	.string	"4"
+	.string	"\036o\300}\353N\300}sh\003\370X\262\207ql\300\002\354\356T\222\207\227\241\177\225oX-\361R\363\260\273\226\254\226\307\255\267\215`\233\301~AV\227\375\327\257}\374U\245\257\341\200\304$\310\354v\314\006\254l\213\235\330~\307\266\034S3\013\227\366Q\236\022\376\205\361\201]\227\313\313\356\250`O\367-#\n\316\207l\245\2427\362\252\251\355U\310\263\334\021Y\251h\033<\213E\267\253\321\340\257\240.:\223\024\367\355\252\211\265\bx\251\344\314\036E\251#\366\265\335\335(\017\244'PB\035\362\240<P\204\t$MQ\3503\361\211N\245\321,\215>\244\031\372\300\3519\260g\022}\363\344y\337\354\214{m\325e\210\020\231J3, \035n\030.\017"
+	.ascii	"2\241%\034\030.*\210F\234\320\311\017\241\016!\210kl+\214\007"
+	.ascii	"\252\201+`n\200\212\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.48.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\205\t"
+	.string	"vRB90\345(\035\336@\222\202\t\036\030\370\006l\201\272M\302\311[\317\261\341\007\377D\265\2061\2701\013\2431\237\243\365\343\nJ\f\220`\274\231m3\017P\030j\312f7\2212\245/"
+	.string	"1"
+	.string	"1"
+	.string	"'\300<n\037\300<\032\264Y\036r\354c\031\253X\313\356r\272q\360\t\372\037y"
+	.string	"\253\225zf\030v\327\311j\271n\275\355\003\333\n\3665\001\217\017\177MK\247\246\237\321|\254 \244\354b\314"
+	.string	"\254,\242x\330\376\306v\206\250\227\204\247\375\220\213\200\207Q\\`\367\245r\262\033r\334\331\036\035\006\366\250\313\263lp\241)_S9\253"
+	.string	"\216x\311\267\355Z,\370$\023\022[\007\n\363x\315\270L\\`\252\234\331a*U\303\276\266\273k}\331\207=\247\356\243\246\357A\r\352\234\272\217C\351\033q!\220\007\302\013\231H\"\216$\362\2148\220\367q\235\002w\245\220\307\231\272\316\3436\341^[}\271\001D\246\322\nk25j\016"
+	.ascii	"2\241\t\034X\270x\230\3366\315\256<\330`\256\261\2550\036\250"
+	.ascii	"\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serializeBoxReply.49.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`\361\005U&"
+	.string	"\352EL\017Gp\236Q:\263\317j/b\216!\304?\224\032|"
+	.string	"y8\227m\270\302=\231\004\232lhk\225\250\267c\313V\376\257\376\320M\331\3170\352K:\222_\371\300J5h1J\262e\330\rQ\222\232\261YB\b!{'\031\336"
+	.string	"\325"
+	.string	"\346"
+	.ascii	"\215\261\324xb\270\314_)~\253\233m\313Y\212L,\347L\241-\260O"
+	.ascii	"u\350o\367\261\236U\274\326\215\003\345<\365%\2263\223B\023\261"
+	.ascii	"O\233\371\001\352S\366A\352\323b\267\2343\251\362\263P!\263\254"
+	.ascii	"\345\234wX\t\204\243\314\367\332-.\036\327\336l\354\252\2469"
+	.ascii	"\024\337b\177\313\0330\231\303\244L:\256H\323x\333$ND~[;H9\r"
+	.ascii	"\271\215\201\224\223\220\263\350\267\372\360xZ\022\n\345\220"
+	.ascii	"e\264s\262\337&e\216\273J\tr\025\325\220u\265\004\200r\t\305"
+	.ascii	"[^\316\233\235\201U\022\352\246l\220\347P\"2?\262\236\226\024"
+	.ascii	"\202\002!\201\303u\253\244\221\213\242\272\264\344\020T\227s"
+	.ascii	"n\225\307\213\337|\272"
+	.string	"tRG\312\211\310\357\332!\347\334\227I\351\364\006\360\356\243\335\375\242;\245\021\235\336Fp\340v\333\200\355v\201\227\275\t|\354=@(\350Z?\320\261\374\002\330\333\001\336\365\316\375\353\215\373\326\337^\314{U\017\366N\331\333({\033\263\267\357\275\375\004\267=h\021\302r\356\361\354\223\317\244`\240|\354/\373\305\374]\377\327\017v\265\373\3752?\353n[\306\307\264\202\247\253(,\031\335m\230\227\365\315\272\005S\024\373X\237\354a\305.wv\037}L_2P\\\372\315n\305\fMT\265\301Z\003\212\365\301t\333G\3772\343y)ik\3422\243\263\342]\372a\335\036\335\313\220\356\310\314\312\023F\304\260\326T\034u\267O\357\275\256\345[\272\005\253:\3615\244;\n\310\307%\223($\272\273\206\330\244$\353\225\245\t\235\234\231\022\236\366\207\016KQ\306\261%]V*^\266\001\274b!\227\233\002\330"
+	.string	">\362O\243x\234\024)\232\234\253\234\217\027\340\250h\223\324\326\334\374\315\2353\324\247\005p\212&\207\212\226\222\363lf88\223\211\257Q1\201*\347c\2064W\263\002}\223\247\315\353\251g\352\251O\t\340\233\335\001\232\032\027\0330 J\367\211\357\2649\242L\361\262\377\007c\250\210\345\360T\332Q|)\214/F1\252\206\204\312a\025c\234\372A^\341\260\212/6\252z\"\265\214\367y'=:\272\320\240\032"
+	.string	"\277\371[\344\311\n\327\233\343\335\323\271\273\342\376\231\013\340=S"
+	.string	"\374\263w8\342\244\273\264\343c\007n\335\207T\034\316\341\bh\226\242\216q\370y\220\177\224\356\263u\357\246\332\342c\034Uf\226\254\214\367\331\3154^\274\354\376\372\244\304\323x\252\003>\340\375\021y>\240\257\210\327\263\001\217\344\023\201\024d\241\022\205<b\t\233\257\b\304\212\024\364\360\263\001\204\301\003\n\177C\334\317\005\317\b%\016}\270{DHA\026+\214\2061v\277\036\257\205\360G,\002\356\212\200\274\030\273\236p\270#Z\320A\243\237pG\f\006\205\273\226\251t<\325`|\316(a#\016/;\367\346&\204\233g\267\233\032\275\245\370[\316\2565\237\334\317\271\272\341i\312\235 \227\271\305\313&\316'\266 \334(Vq\212\233\206\352\212\205\360\311T\315\2717\265\2538\310\201U\031#\233\256(\033^\206@c\306+l}\233\337\354#\270\314\220a)\001\214"
+	.string	"7u\013]\004\030\b\267"
+	.string	"\334o\336F\345\314z\350\344\300I,^v\2052\365"
+	.string	"N\253\344\272\351v\320\234s^\361\362C\352"
+	.string	"|"
+	.string	"\237\354!\206\030q\006r\250q,\206\fb\314\b\005B#B\n\323\214\001`\002\221rfu\020H\311\206\222t\023\310P\246$\030\217`\212\233\035(\255\344\020\206)\230B\3125\327GT\253P\001\220v-\213\013\374{\\\224\307}\2518\263v\247C\245&D\264k5\321h\003\271\241\330f\177\263\354r-&\230\030\214D\362`\330\325h\342c\f\365\351\331\345i\030$i/\206\256\016b\245\271*\031\022\320\t2]o\257g\210"
+	.string	"\253\177JB\346\257\224%%yjA9\020*}H\301\230\376\253\231\2545QqO\002\234\227#(|U\017\023\335\250\203\nMe\344H!\177`\"\273\207\036X\020\302\352\323xb\224\231\001\202\376UlL\307~\260\204\326\205\356\027\001d\205\352p\237\220\246U\035\307\013"
+	.ascii	"j\331X\221\362>\217\342Tm\315\361y\031T\362\034\336\302{C\320"
+	.ascii	"$0\025"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.50.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`m\023uN"
+	.string	"\252\177\204\034@@bN:\263\362\335C\370\224z\216eG\330\244<\317\204M\370\234#\034\245\360\371\323\224\321c~\326w\267B\375\246\213\321\037\320&B\232\016\252g\204}S\377/\206(4\327\324\254%\204\354\235d\300\001\223\001\305\001\257s\353lw\031\317\266\335\235\332\263\3063\265g\335n?\267\223\362\376LT\355\f\342\373\276\313\034\205++\213\252\025\364\372\325\356m\305\272_\240`\331\225\200kK\213A\026\326\025\002\253\003\006\nTQMIyEA\021\030  \300\023"
+	.string	"\247&\246%\245$$\345Q\022it4\026[v\315\330\355\277\025:3\324k+\373\202\265\210\306\206\345\204\316<+\204C\207m\246X\001\0247<_\n\276km\300\247-\016)\304\317\235O\351\340\004\201\201s0\027\340\267\376\004\003\261\026\340\031\254]\200ou't\n\256JN\366\334}\252\007ga<\307\362\373\225\237\024#X\223\204N5\253\027\034\337\235\353\325a\253\276\037\330\373\206)t\200\232\270\361\335"
+	.string	"\027\347^\343\002+\023\034\337\235s\335\231\213\373\236\036\256Z_&Q\220\023:\363V\tug\201.\205b*(nx\237Z#\324\201\231rBgt\315e\322\3109\233<,u3\274{\255VK\360\232\337{\025\241\223o\035 \370\205\320\2718\367\340\250\353]+\017qLb\023\267\276C\2159\2011b\360\2000\027\020\206\016\007"
+	.string	"\363'0Y0"
+	.ascii	",w\302r\0057Y9\223\225*x\211\312\225\250L\301IR\216$E\271j\311"
+	.ascii	"\001\276\235\320)\267:\r:\341\363\243\325\013\r\021\311\t\235"
+	.ascii	"I\326\344!\265:Jp\022\311\221H\216`\243\270\037\343\252\2708"
+	.ascii	"\341\260\261\252\211\233\221\027O\3504\322lS\303-\221\263ihx"
+	.ascii	"}{^\265\016\331\024B\2661W'6,k\217\036\007i;\303\270H\341}\337"
+	.ascii	"\306kmn\357\006\357^\217\335m\241;\311)\306\344_q\212\345\034"
+	.ascii	"N\221\005\301\346\344\236\233\026Y\307\346\347\236\347\2779\037"
+	.ascii	"5\305P\231k\022~\212Bjv\241\242\261\325\267\264\3345\332\347"
+	.ascii	"\260;=L|\250\2330&\321v\2338\201\277\366|\324\234\2432\247\266"
+	.ascii	"$\341>V\373\004&v\324TBE\313e}\204\215\357\277v\353\267{\324"
+	.ascii	"\205R\312Z7\214\030\370k\3354\325\222x\230\226\313\272\355\316"
+	.ascii	"p~v\177\351\355\257N\347'\335\031w\030\330\021\267\212\"\356"
+	.ascii	"\024\247\363Fq\302\210\333\204\021w\t\022_\363\036Q\304-\"\304"
+	.ascii	"\325\2743d\334\020\016\370~\320\364\2747S\213{\251\305\255T\304"
+	.ascii	"\235T\304\215T\304\255lq\037\265\270\223-nd\213\333\250\305}"
+	.ascii	",\3426\266\270\213-\356\266\305\315\266\270\363\375\336\270\305"
+	.ascii	"}\261+-rH\236x\331\320\356e\253&z\251l\233,\007\374\351\374j"
+	.ascii	"\3765\277\337\237\367C_\354~_\316\351\364\005\343\374\3019`?"
+	.ascii	"\360\215\353\346\177\215\343s\232e\016\002\363\276\357\324\357"
+	.ascii	"\306\207\276C\tF8\37588\376\016\335\364\337\340H\262\246qt#\363"
+	.ascii	"\276\246\317\246\221x.\232\253\351K\317\270'\363\276\356\035"
+	.ascii	"\347\353#\363\rr\257\033i\327\327so\246\341D\310C\034\263\205"
+	.ascii	"\246\217\267\343it\374Ms\036\233w}\016\033\030O\246\177\246\314"
+	.ascii	"\357v\334\f\026\025\323\356m\013!G\035\203\370\276v\f\214g\251"
+	.ascii	"\326\035\335\310\263\370\321F~\314\353\334Cy\030\313\234\307"
+	.ascii	"\2653z\207oO+ruP\247%pU\n\364\375Bab\032)\025\246\376l\276\341"
+	.ascii	"\256\217\232TjD\206\220\233\324C\310\337\373R\031*d\004\025V"
+	.ascii	"\345g/\2303\225!\263a\274n\347$r\023\253%\221\037\350NOV+\004"
+	.ascii	"\204\243\312O\304\223\310\031\362\245\277\020"
+	.string	"'g\230&w\226\247\013\340\336T~\266\210\234\347}\355n\301u\276\330AC`\n\3359dY!\304AL\350vY\337\247\243=+\"\263\203\206\350\240\357\303\202:\254\276\366\276\356\036|\230\216;\307\005\210\003\335.\253\373\305\245k]\272\366\354\210|6\267\032,tg\250G\004/\n\023WD*?\373\227\272R\225z\345'\375\352\277Z\244L6\002O\277\022Hy_&\204nW\f\366s\353\244\360\234m\034\007\313q\243\025,Xh\317\"\345\353}\353\311\033\2726f\270\332xm\376\260E\025\350\022U\004j\b\025\215\200\233\020*\032\224Sb\223!*\032\023\033\241\034\247\314 \002\371\331x\310\225Q\2502\263\205\211\022\007,M\005\034\031\217rR*G\211\215\r\025-@\222\230\247\344\232\314I)\035\225\t\340h\316\t\211\314I\351\026*\263I\352\b\223Q\024\356\306\240\001\177\315('\245p\324\263\245"
+	.string	"lB\224\216T\307\234\224\266Q\231\002\024Q\001<\2750\364&\036*\243IF:d\2373>H\001\224^\216i\b\253(\225\031\252\204\0329<\312\3176\376\2535\346\260\273<\335\033\260\333\227\361}\231\016\032;q\033\207\276\225\263\335\301\003\376\232\207\234\373\246P3\\\355$|\f2GEKR\0059\202,\232(\346\344^\325(\023:\266F\020mN\356\t\n+4\344\030\013cY\330"
+	.ascii	"[\001c\305\f0\261#\214\203\315`\221[\254+\307XX\n\0325d,Y\210"
+	.ascii	"\201\265 cac\006\214\345\f\030`2\226bd5\226]S=F\203\005\331\322"
+	.ascii	"\306\330\030\331\022ig\366\374\244=L\251f\371\254y\254\357\333"
+	.ascii	"d\302\241\377a\031\350;\233\3453\036}+\355>]`\027\355Y*Q\254"
+	.ascii	"\310\325\0311\303\325\005\371\271<\264\f\221{\305\302\271)71"
+	.ascii	"\226\377O v\250(\370o\264M9DF\032\364\347\314\020\315\022\nO"
+	.ascii	"\224Oo$\224\304\231x\210\226\313ZBD\230t\375\375B\241`\032)\227"
+	.ascii	"\3407\334\375\251I\265P\344\260\260\374\351\225\364\204)\023"
+	.ascii	"T\230'\301\026Xf\3030\270\235?\260\363\007\353\373\276/\327\203"
+	.ascii	"\f\226\037\370\013qI\344d\277)h\266l\251\310M)\262\212|\265E"
+	.ascii	"\211\276\330A?\210\372\034\372K\221\331A?\177\030\361\257\333"
+	.ascii	"ubC\205P\344\013\336j\260O\026\204GI\233\326U\034\2725\f\362"
+	.ascii	"\223\245Lv\247g\0137\345\317y\324\205\321\255\342^\301_[\312"
+	.ascii	"J7\321\273%\372@\223\225\237\215\021\340@\377\364\307)G\374\\"
+	.ascii	"\365o\26487\373XXB\266\\)\021z7\b\245\374\350\377\303\215\022"
+	.ascii	"\004\371\331\3059\007N\344\254\007j\353L\271\271\276\341\264"
+	.ascii	"L\371\320\3171\324\023d\305u\246|b=\224WM\303\007J\344\363=\352"
+	.ascii	"\342*\312\r\220Q\312\353|\3377k\311\217Z\206\025\025\313\340"
+	.ascii	"\274\031\310\317\316\037kM\034\241\334\005\"U\253\325\300\217"
+	.ascii	"\265%\262\211\334\312\235\345\022\271\261\332\"3\\\315\202\r"
+	.ascii	"\007\335 \356\234\361}\337$,&\201}\250aL\004\021C3\"\"\"I\222"
+	.ascii	"\024:\301\005\204\020&aY\035\021\320,\345\034S%$)I\251\003rP"
+	.ascii	"\n\302`\307\250X(\372\"?\213\027\024\202\222\372Z'<|5\363\377"
+	.ascii	")\211\364\325Q\222\356\265\371\357\223`<\266x9\300\033\235\255"
+	.ascii	"l\346\006^C\364F\224_p2\337x\315w\356%\366\236\340x\006+R\\\t"
+	.ascii	"\303\203\265\025\020\216\207\217^C\347B\006\327\022G\021\345"
+	.ascii	"\347\242\300\313N\354\242R\036M\204\"\222DDv\n\265\247\211\355"
+	.ascii	"P\0035\212\367\003?\220\322\025\270\214Y\371l"
+	.string	"\026\212\361\3516)\376\303~R8\355P\234\026\tr\241\177\022\231\251\273D\305I\212\234u!\200\364\205n\274\241C\032j\312Oa\201\210\f\335OA\347\305\350\312E\267)\364/Da\230\f\347\003\226\372\244\031r^\254C\260\206w\234\274f\264\230\335\317{Bbz\350\307\202\036\2722,\354\351\220\003\bsB\362\335\3415\243\377\320)K)\324\035\"\204\212\365\0332\215se\"\217\307\221\246\273\"Y#H\270\322k\230\206\343TYF\244\\Y9\327d\305\\YF\234\322\244\\\250\224\344\222\213\260e\234\260T\225e\220A\274\201h\215\306\227:\r\225:e\024]\f\211\337\230\317\330r\177\301\211\232\205\316%\331\3516\333Y;\321&\024\032\200"
+	.string	"\316\225;\304\200!$P\005}o\305 \244\305\344R9\35229\242\3571\346\232\222\f\302\024y7JgR\364\324\324\002\372[\013\t\252\372\314\244\212\323\344n\027i\224\2509\030_\243\247*\201\252\305d\f\236\277y!-\355'{r\251\254\257\245\245\315@@E\3327\352i\t\324\303\247M\350j\267+\375IN\271\211\255q)\003L\236\035\277\235\004\202\210\372\230<\257\254\211\322\036\266\344{\032\217\221a\352\366\201V\317pT(K\246\371\320\317\006\032<\267\\\322\217P\021\224,\037U\3060\026oX\204/\261\320\313\210\327\013\334+\2070\370\214\331a\021\316"
+	.ascii	"\003u\004\364\275\016\241\377f\r~\237\303\324\371,\273>\022<"
+	.ascii	"\036\264\332\236 [\027o\034\303%`\276C\177\366\255\035\211Q\305"
+	.ascii	"\022*\271^\340\201\272\226\267:N\243\276+\330YF\266\307!\272"
+	.ascii	"\252\200\004\340\355,\242\350\354\211\251\267\3234\377\b0\242"
+	.ascii	"\360\254\\\265-\352\263A\305\206\222c\246HV@\255\332\314\203"
+	.ascii	"\260A\305\260\200V\3420QX-\016\367\245\327\243pH~8\2121\316f"
+	.ascii	"\343\b\bR\266?J\231\342\324j"
+	.text
+	.section	.gnu.lto_getBoxIdState.51.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`C\002\225\024"
+	.string	"V\250\216I\3000'\035\363\033L:\371\204\312\\0\301(\233\353FU5\016\257\030\"t\275\365\317\312V\242\371\236\206\214\376\334<\231\373Q\025\212f\232\n"
+	.string	"0\n3Dl\204&\345x\315\222\361\034\301m\200\351}\325 v\357-\245L\001|"
+	.string	"p"
+	.string	"}"
+	.string	"\374\257\211=\261\333&\234s\324JT\202E\255\300\003?\tw\016\330\021\272Sn\b\335\371\377\b\024\354\236\263@\020?\033B\253\227\242F\255@Z#m\316\302\350\224\3159_\235\205E\260\202A\027\310Jj\312\221\037%\237\354\327#K\266\246h\304~\027XZ\220\032}\277\240mY2\324\"\203\354\307\223#XE36\270\354\363\343a\206\241\324Z\317\276\037\320>\334\377\025\376\257\374\234\013\324\243\003 \335\bf\361\330\306o8\245\300>\355\006\227"
+	.ascii	"\223W\027\206\035\036\177\240\016\367\321\277=\216\343\3706\372"
+	.ascii	"%\037\344\374\331\371\037\347\313\266i\327\343\374\220\362a\224"
+	.ascii	"O)\177J\276\244\374\236|\226\374\r\001\300\001\013\002T\255?"
+	.ascii	"\243W\275\232T\"\366i\367\337}\203\217}\201\353\264\333\247\233"
+	.ascii	"\260\216x\220\325\265Uk5\331\371\004\341\316[\3058:\327rz!\203"
+	.ascii	"\232,\254?z{U\264\273a-\243zB\263\r,m\311\325\343\305\303\343"
+	.ascii	"eO\227\r\336\302Zy\013d3\310\242\342\356\336\336\327\316\212"
+	.ascii	"\215z\301\301\300\320\235\334\034\032P\304`\332!1;H\222\212\202"
+	.ascii	".xl\203\247\270\260<H\220\236\365\006\227\243\367\265+\200n\203"
+	.ascii	"\364\271'\304\263P\253\"\367M\2728\303\353\333\371\235\241;\267"
+	.ascii	"aUc\227\320*\371\206\256\272\217\216\023\261\216\220N\331\274"
+	.ascii	"\177L\246\246rk\021Uj&\274\340(8\020WZRlD\026\221\026\234\215"
+	.ascii	"\3102o;\261\021Y$\310\320\344h7[\315Ew\253\211\301\321bp\265"
+	.ascii	"\034\315\246\243\241\235\220\\\224\271\351h5\242\250\243\305"
+	.ascii	"\200uem\243\357\207\245&*k>Z\032\232\037\\\035\276z\326a\373"
+	.ascii	"\374\017\373(;\315\363\033Y+Q\203\255'\036e\255\265\302f\354"
+	.ascii	"\321\177\315\306\353\223\265\310\206\240+^\007$ \240\002\021"
+	.ascii	"\272\343\006.\022\332\243\214\245\201\334@\332\362Zq\b\343+("
+	.ascii	"\372`\321\340\332\241\003\022\253\332\027_\210\001\227\017\243"
+	.ascii	"H&\323b\002%\256Co?\f\353l\222\263\013\031\277\331c\344-`\034"
+	.ascii	"\271+\215+1\337\312\001\235\213M\2144)^\001\215P\367"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.52.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`\257\002\275\025"
+	.string	"vg\215I\3000'\035\333\371\217\034*\177\355\240D\377\201\246?T\365\343\241\334\377\353?\031\212\312`\314v\252\252M\327\016]}\207\267i\333s>u\303q\333\306l\0259\304\024]\277Hc\024~\235\236\241+A\364\2334B\266\334)\005y"
+	.string	"p"
+	.string	"w"
+	.string	"!.bg[\321R\311\367%\"\236\250\256Z\253-\344 \342Cz\017\361\341&y\234\273\313\306\230\030\322\235;\037\352\024\204\026\260\347\273\271\214\376\351\313\3470\200\210(\202\021<\256\003?{|\2749\"\005\r=\306\341\023\272x\341\341\216\316\244\264\300V\013\0333\037\017\005\371\341\320#}9s\017|\270\244D\303(h\3503VRk\365\354\371\202n\216\333F\262\315\300\236L\001"
+	.ascii	"\204\202[\336#\273F"
+	.string	"\247;h\263p\232|\371\313.u\323\375\323=\351\364=\004p\275h\200U\353O\330W\r\206U\035.\365?\371Q\237\262I\333\374\204\327\312\005y\023>P\252\006\005\225\022\212\215M>\274\275\363\241L\372O\"\343\r\320\b\244*\332\252\265\034y\350\004\343\303i\237\304K\354^Vx\255\326\243\025,j-\r\230d|\350r|*\304\331\232\356\356\334\236\032\221.m\017\226\005\234\261\375]D\334\235\255\203\254\030;\031x3L\244\315\335\225\333|\317\037WXA\235\003\037n\252\302\375\245\370\367Fn\371~\\Y\005\177\324e\241\244\024\304\216\305\300\224\0045#gz\231\234t\375)\t\270\371^\307~\352%9[CF\221o\3677\336Z\342\310ekO\320\315\367<\257\234\202;{c\227\274\271?\373\001,'49\225\220\206\345\204&\247 F\207\223\351ZR^Ln,\271\0053\021Z\\^Lbt\270"
+	.ascii	"^!\241\311\251<\210\321\341l\267\225\024\b2\267\031\030\027\033"
+	.ascii	"\214K\n\316\266\"\243\263\221\fp.\346&c\233\311\345dld\211\363"
+	.ascii	"=\262\351\270[#7\004gy\256-\271<`83L\266?\323\274b\264\335\320"
+	.ascii	"\3443\335c\032\233{\250\2177<\200M\367\020@a\322pZk\255\343\376"
+	.ascii	"|\340eNM\0017 `\002\221a\307\r\351\300\222\207\244\321\374\252"
+	.ascii	"t\032Kz\214\246\t\266\372M$S\334\251\233h}\337\337A^=$\030\255"
+	.ascii	"r\223\207\352\n\355\233dX\376\315\231\013\027\036\303\016\005"
+	.ascii	"U\207\003+k\004\330\255k\233\034(\331\234\252\324(\336\205`8"
+	.ascii	"\35202_\017\234\230p\231\256m\240a\207A\027\305]\234\325\202"
+	.ascii	"\f\177\227\352\300w\326\303pi\211\037\322\350\356\325D\312T\276"
+	.ascii	"+\222\231\332\360\004"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.67.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\265\n"
+	.string	"\306\325J< M&\0350A@@@2\314\210U%`\307\301d\002\247\367"
+	.string	"f\331\n\353\215\304B\204xj\004\177\226\265A\300\001\f\b\032\023\352\002\255\240\256\006\222\001\252\337\001\b\355-eJ\001:"
+	.string	"7"
+	.string	"7"
+	.string	"\035\034\221|L\266\035\221\200\034:\267*1H/\t-\023\273\\<\324\f\017]\363\205\374\334N\242\353\273?\016+\327v\252\360\254\370cLv\327\r\0137\274\355\004\266\021\330\217\001\213\202%6\330\276\375\356c?l\220\3758\264\255y\356s\226\347q{2Y\323\276\207\177"
+	.string	"\235\345\261c\027\303\b\022\273\334\201CC\032\207\004\036`q\370\016`qh?wi\002V\273\243o~\353!0_\303\241\035h\371\355\320\327\036@\310o\251\357\236\250\b*JUY\337\337\356\2565e;\255N\347\271\377\013\003\023(.\354\226N\274\002\f\024t\260\n\264\005\322\301*\0136Z&^,\224\006\331\205\243\301D\r\206\222\211\226L\213\220\001\3066\227,r0,\213\217\277\325\224\337\275\200\210LU\245\240\236\214\224dUU\331v\344\365 \002\017"
+	.ascii	"\017\213ahC\241,p\2061\345\312\334\n\310\003#\202K\230\234'g"
+	.ascii	"\247\3355GPgxHM\241y\351\265e\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`I\003}\017"
+	.string	"\244\025E\004"
+	.string	""
+	.string	""
+	.string	"\002\303"
+	.string	"\177\026\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005+\f\200\204\001"
+	.string	""
+	.string	"\003\002,\177\027\320\271\326'\272\200\202\002*\030-\177\031\002/\177\032\0020\177\0331\177\034\364\221\225\007\0022\177\035\344\333\224\022\005>\036?\037\0023\177 \377\377\377\377\003\300"
+	.string	"!\005\301"
+	.string	"\"\0024\177#\360\340\227\f\003$\201"
+	.string	"\0017\177%\037"
+	.string	""
+	.string	"\200\200\200\0016\177&5\177'=\177(9\177);\177*:\177+<\177,8\177-\302"
+	.string	"\177.\003"
+	.string	"\020$\003\005\022D\003\005\021d\003\006\007"
+	.string	"\214\223\362\245\002\001\202\001\004\007\325\n\003\b\030$\003\b\024Dd\003\b\026\204\001\003\b\024\206\224\377\005\001\304\001\344\244\006\003\b\025\304\006\204\007\304\344\007\204\n\304\n\n\013\304\354\203\355\013\001\344\016\204\017\244\304\017\017\022\003\b\027\022\204\023\244\023\344\204\026\304\026\344\026\204\027\304\364\302\326\003\001\244\032\304\344\204\033\244\304\344\224\325\201\007\001\344c\344f\244g\003\b\020\306\211\371\222\001\001\344g\003\b\023\241\226\365\006\001\304n\003\013\031\346\336\301\357"
+	.string	"\016\030$\003\016"
+	.string	"\221\237\350\363\003\001B\003\016\013\300\224\370\244\001\001\202\001\003\016\024\322\201\2676\001\304\001"
+	.ascii	"O\250Q@n)\n4\325\372\254\001\360\002\251\251m\003\021\260\034"
+	.ascii	"2(\026J\230%\005\245\003.\223\343,\013\273\215\007\213\322\205"
+	.ascii	"\270\252\301\316\b\212\366N\367\013pnY\321\205\340\r\315\344"
+	.ascii	"O\364\342#-\344\245\037\357\316T\315\316\3674<\216\363\313\316"
+	.ascii	"\277@\322\245u\367G\027!3\232\233k\353B\274\357\033\245q\254"
+	.ascii	"x\013.n\275\354\362~\204\314\310\266\030\350l\020\n\362@F\260"
+	.ascii	"\230\242(1\252\263U>^5^\333\371;8\272#E6\034\323\214\222\214"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_.refs.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375 X\025\002"
+	.string	"\362\204\016\031\240'i\f\343XUUUU\265Tq?\021\0209\267\277\265\226\356K\271S\027\301\013L\364bf\305\236\230\036\266aZ@&\034\017\216\2061\331\310T"
+	.string	"\252=\223tF\347\210\001"
+	.ascii	"Z\224&"
+	.text
+	.section	.gnu.lto_.decls.bbb07d98d8d13460,"e",@progbits
+	.string	"(\265/\375`Y!\315\230"
+	.string	"j\372"
+	.string	"7P0P\322I\007r\235U%\021\"\336l\242\275\273\341\227g'V\0073r\030\211`\3463\277t6_\013\370\373\361\366\312\364\361lc\264\020)e\225\260\200\202RwP\226\334b>\240\022k\016M\241\275\\\252\317A\263\235\372_\021\2110\262\245L\001\336\002^\003z\003(\206\3473\252\331\\\2205\235\276{\254\200*\020!O\242t\372\307m\f\310e\316\320{\243\200\f\307d|\226\240\013\234I\2751+\321\263\246y\255\244\351\271\314z&\303b\270.\206{\243\367\336\001z\312\314A\211t\312z\303\363\030\021j\263\nz\3314"
+	.ascii	"\333b\322)\t\006RS\026\241\366\361\330\271\005\242m\341\302u"
+	.ascii	"\026:\226#E\013\r\360^\250\037\363\361\036\267q\037\347\235\365"
+	.ascii	"\030\314\331\202.|\247j\235\365\361\027\256\363Y\202^\251\034"
+	.ascii	"\255&QYJ\004\225(\201\243e\013\212\331\232\0061\220jym=7Y\371"
+	.ascii	"\256\331\216\361\316w\354\205\247\351\362]\312\n\3700+\200\203"
+	.ascii	"\205\310RMM\317H\326s\220\333\363f\311\033\302\033+\b\006RG\374"
+	.ascii	"@w@mi\211\262\337\030V\227N\177\316\202\305':\246\211\224N\347"
+	.ascii	"\240A=\\\334PUuzfZ\317q,\307m|\205\251\234\337\270\312\203\240"
+	.ascii	"\3676\335{O\301?\\\343)>\366\336\037L\306(@a\001_a8\236\302x"
+	.ascii	"U\032d9\003\2747:\274\302N8j\241F\356\335\362\362\371\262\027"
+	.ascii	"\345n\360^hP\211\022%z\360z4\271Z\323\217\260r\320\007+Ga)\334"
+	.ascii	"6\202\335\240?<RR`\317N\277\301j\300\362Zp\240\365<B\345B\036"
+	.ascii	"\241\376g\3759\372s\023>c5\313|z^\266{\241!~\232Pu\205A\177t"
+	.ascii	"\254\020\"\321\321)C\031\3129\215\237\034\205\005\267Ki\367\354"
+	.ascii	"\336\313i\025<\357]r\332O\233{\227?\314\n0+\2202\321*\342\246"
+	.ascii	"\246\377\260\276W\020P\006RW\026\241~\370\373\005\026\016\342"
+	.ascii	"\357\267+\030\324\364<\300\202\017\3617\021\2444e~Fs\346\347"
+	.ascii	"\032\201\377\301\230Y\002\374\031\207\277\237\253\312\260\230"
+	.ascii	"\237"
+	.string	"\370\233\004\233\bs\273\237#8\320\337WR?\317\320\303\3174\370\251\275\347o\247\003t\350\373\017\301\377\003\3766\372\031\203\237\371~\336\3739\357\347/?\343\375|\367\263\227\237\273\374L\367\263\226\237\345~\266\362\363\333\317T~f\373Y\312\317i?C\371\031\355\347\263\237\315~V\362\363\221\237\215\374\034\3663\330\317C~\026\362\263\326\317Y\377\343\376\303\375\267\302A~~\376w\340o\031?_\375\334\343g\033?7\375\274\374y\207\237s\370\271\206\237\221?'\375|\3643\214\237\211~v\341g\026~V\341\347\024~F\341\347\022~\016\341\347\017~\346\340\347\f~\036\376,\301\317:?;\3603\003\377\347\376\013\376\254\300\317\002\374\347\362\363\316\317\037~V\377\253\360\337\355g\373s\377\314\377\t\377\003\376\367\373\257\345\177\226\377X\376\017\375\257\373\277SXXX\370\247\007\374i\323O\200W\227\327\234\252\204p"
+	.string	"\243\321$\321\367\032\267A\003c\353\264\241\264\232u2#\213\252\245\355\214Y\235q\243#g\007\023\033-i\337\331Y;\t\363C\026\267#\f\332\333I\213\tDK\303u8Z\202c\340\344\326\363\022n\262\266&k&:\314\224\256\007\300\333\2442\301X\270H\0223\203\235\276\227\374]\326H\332\214\347\251n!\362\367\325\351\2345r\345T\326i'\031\276\225\330$p`\224t*\304\"\324\rr\350R*k\221\"mD\215\316\207\020\317\223\253\0066\3666\322V8m\204f\310\320V\257&\342\325a\352\275\f}J5[H\017y\177\375\253\303\326\245{\231\332T5\205\376\006{\207\335\3750!\t{\263\321cFf\257G\247O\305\326\247U\353\337\277z\227\315{\357\024\016\3646\231x\3168\314B\177\017[^\340\177z\357\177\373?\350\004\350]\212\236\241Y\311\340\226W$\356"
+	.string	"\367^'\b\346].\205`F\237Nf\227,\347mr*1\243\320%fSV\323\203\333$\301\274K'\210\033\315j\336\350\345\021\202\331\264\\b6]\247\007\267y\231K'\337\270O'3\232\325\f\301\214f9\231\321\245\023\304\205\336&\023\272\325\344\033]:\235\242K'3\241Y\316\033\315r\016\240&j\204\351D\230\367\206\2150\233n\024\224\217e\023\004\036\023\372\274~\3672[\215\333\\\340^\037\317\246\337\222\007\3071\341E1QY>\231"
+	.ascii	"(&\255\347m\302c\226=\357-c:\272P\025,A\361\256\027\343-m\371"
+	.ascii	"\270O5\356-\340B\357\205\272w\211/\336\275w\351\336\233\323\364"
+	.ascii	"\001\275\327\n\004s\f\n\352\336\252 \250\353c\311J\215{\233-"
+	.ascii	"L\234\223\031\325z\016\255D\211\216]\033\320%\036\273~Y\3155"
+	.ascii	"\272\004\345>\235Y\307\2349\002\233K\247\217--*om\255 uI\231"
+	.ascii	"\026\223\271\254 ;W\270X\345u\332O\326\362\226\347\\\373\301"
+	.ascii	"m\r\344ex\356=\340\303W\020 |\235\366Uc\255]K\250\310a\371"
+	.string	"\330!\2277\305GK1\326T\330\223N\237\246\255\376\353\354\b!\322g\303\252\307\324\240\023\2229h\3270\"%\244\255\253~s\226A\b\303\360\330A\204,\215\251S\035QyW\3348\351\034=\305mM\325Rg\264nR\3413gG\371,\205\270w\013m\354^hS5TG1^\025\364Nipf\365&eR\353\241\213\232\336^\255|-U\024\327\265\236\227'\246No\233\353\337O\215\303N\007\026\263\255\231\215#\bz\247v\264\252\360\210\033\274\315\246\211\276\021\304tdc\364\364\326w\226\256\321\243\363\264R[VY\233\306\323\264g\217]\356\360\002\327)t\247\212\371\346\204\t\202\265\351\312\224\263^\366R\217\334W\2210\235\276\227~.\354\333\204\302\232#g\235\236\216\201\324\035\026\241\262\233\341\371\r\223\220I\247\037\332\020\246nW\336\262\260\3416&\3445O\241\367\262\021r \017\3724A\357\224"
+	.ascii	"LEr\320\r\376\374\361\020B\225\246o!\353yPM?\357ek\250\256>f"
+	.ascii	"\247\214\206\323p\233\020\013\3524AoT\207\357\f\026\333\217\365"
+	.ascii	",\244\376\260\220\032{U\002\207t\232blx\373\244\321\272\230_"
+	.ascii	"\326\211E{>\201\364uz\213\366\333&\366\214'o\371E\300\333\360"
+	.string	"\226\t\317\225\2514-K\314\224\320\240Y\263\337&\261J\232\214\225\223\257N\031\220\201T\004\312\206\267H|\226,a\211u:\202\314\036I\023F\313\036\371\355\2305\2422\233\262\312:\235\200\201TUlx[\304\3729\255\350\350\024\307\022\t\243\321\354B\243\323[7\026\214\323b(,\202&\256kx\373\325D\345&\3465\004\007\nS\320\016\371m\227\025\302\363\245#\307]\247gc U\247\311\360\226\353G\017.\215\230\335\262Z<P\244r\224Y-\024O^Bl\226\r\322\265\346\246\243\323\333 \277\005b\237\234vC\241\0335\235\336\217\201\324\036\026\241Z\254\341\355\217\035\273,\200O:\345a\021\252\275\262W\035\246\345&\007\335\240\217^\027\016\24737n\241n\330\036\226\217\347.\245]\251\034\270-]\203\203\227Y%\264\003\305\t\312\027\252\333\036\267U(,8\231\325,\t\337\262S\313\343>U^\344"
+	.ascii	";\275\325aw\374:\037\310"
+	.ascii	"\270\242J\346\326K\260\246\355p:;\2659N\246"
+	.string	"\313\310<\231\351\324N\035KU\337\240\020\353\264\323\322c\352\324FY)n{\235m\336G\316F[\335\333z\036\370u\252u\272}\372ut\344~pe\255\255\277\305\361\353\344\270\361]\215A\327\257Kj\324\2606f\200\222\005\210c\n\2264k\303\b\231\326S\247_\231l\223m\262\313!\264\320\207Y\317\335\024\234\323\316^{\3552\200'x\177h\230\334\340\003b\227n\227=i\326\360\234\250Q\355\244\332\260\311\362\346M\2671\033[\323\224%\306m\315\232n\023\364\264}M6Uf9e\330\004a\"|\267\311\301\201\006\346\354\264\331\234\214\372E\211\022\"N\320\240i5\267M\367\307\2261\036\356\234\240\202o5>6\304n\354u\332ix\246\234\321\023\214\376(!t\342\023\373\373\353\300\240\247\035\343f\365\206\003\263\226\334h3\357\300\0340;\256\251N\033\260\325h\220\265y\346d\255\017\3630M\206\271"
+	.ascii	"\331T\tY-gTTc\336dz\226X\ts\353\264\305\374/\025\364j\n#\204"
+	.ascii	"#\212 \323\240\237\037\253\021\341.\235BZ\256\240\335\340m\322"
+	.ascii	"\231\260\204\\\272\346\244|\371\322|`=x\304\r\356|a\311\021\270"
+	.ascii	"\367\346;\026\235\260\034wh\r\346G\332s\rL\353\375\320\222\027"
+	.ascii	"\3267T"
+	.string	"B!W\232\362x\rO\363\311\034\0232.\347\266\346\322wB\317\345\262\001$\200\253\026\335\017\032\235v\227\366\302m\020\264\335\273\216\267\034g\t\275\320\006s\323\246~\255g\bT[X\310\020\250\255Z\321\2655\035\327q\332\225\372`\003\357\017\315\340\275t&~\004\223`\201\225\311\222\245\303\274\376\n\003\307\b\361\346\332z\256\2738\355:\221O\244\336\244k\304\254\270\311\235\333Z\256\2678\355.\355\250\261U\231\300\331\213\332\222\247\004\016\256\343\236\340\340\341x\242\3664\357\270\27421\267\256\266\266~\033\222#\206\013\217=*\357\267\034\2505jn\247=\245\325\232n\242\226\235\266\333\261\374HYS\343H\326\352\006\245\347\325\351q\250\244\\J\257\255 .\323^\2171\356\032,\354\302\006\n\355\2655\037\260\300B\205\025\035\020}\340\301\t%\020\255H\201\250\005\213\020\306\"\361\205\f$#cq\b\231\2241$"
+	.string	"\022\222\f\243\361h\314Q\022\021o(&\325\032\216\310#\345\321\230\003\243\210\210\224*\211\311$b\222*CI)\343H\224T\203\322P\021\371By<Jz\200t4:*\217H\024JH\026\003\370\321\211\241\003\210H\031\312\"\"\214\234$\362\2304\022\2239Jb\013$\322\212\030\306\"R\331\342'\305\nDe\021\331B\221\262\350b\204\222\030\202\rEHd\007\312\242\213\235\037\235 A\005\026-\206\224\304\030\310\"%\t\031\214\216H+\210\310\343\212\037\020d0*R\022\241$\272`\370\363\243\023FD\304\244\242\322(#\031\243\b\t\204\030\306b\022\262h\207\250,R\266P\022c\364"
+	.string	"%\021\225I\033Z"
+	.string	"\220\354@Y4\026A\330\200\244DL!\204\021\004\002\214 \020\223\212L"
+	.string	""
+	.string	"\205"
+	.ascii	"\222D\033T\3148\252xa,\302\360\361\231\340\204\022Y\244tBI\f"
+	.ascii	"\001\350FE$\321H\214\261\276\202\013$\270 \305\214\234\247\310"
+	.ascii	"`\202\f&P\237\"\203\3410\203\013\206\353/\030Z\245\322\b\302"
+	.ascii	"\rE\244\242\"\222\230\364Q\376\350\004\f\031.\222\212\210Her"
+	.ascii	"\310xLJ:\032\031\2116I\004C\206\213\244\212T*\331'\240L\252 "
+	.ascii	"\322PT\032\025\361\020\211^\2608:\221$\2768&\021\031!\207\214"
+	.ascii	"`\310\220,JR\026U\3148\272\340Q\022\241\240`M*\213.\322\037\r"
+	.ascii	"\305P\"`\306Q\305\261h,*\201\370\321\211!\345Q\214\"\022\214"
+	.ascii	"\002\222D1\2120\214\307\025=\304\027\307\022\220\304\031\305"
+	.ascii	"$\035\244\343Q\005\021\316\013b\022I\244\201\210$J\326Pd\203"
+	.ascii	"\b\245\221h\204$*\021!\217\312c\022\221R\021\t\306Q\262\bi4\200"
+	.ascii	"\362G\t\374\250DD\016)\217G\344\320\316\013\026J#\321X\224\204"
+	.ascii	"$*\355$\211\224D)\224\306\242\214\234\017\207+H\254`B\b\253\321"
+	.ascii	"\211\031G\027DJ\311\244!\242Q\021\f$Qi,\016\031\213EICF\310\344"
+	.ascii	"\320\t\004^\260\230qt\201\203,:2J\211IE&\3148\272\310\031\274"
+	.ascii	"Sy\320 \234\322\244\376(\303\352!H\246P\216y;\2352\005\350\025"
+	.ascii	"\207\246\313M\027\0374\316X\033*\002\237\270l\340\226\235\332"
+	.ascii	"\02603K\277'\327\023`\233u/J\354\357\317\366\300{R\350\325\251"
+	.ascii	"\035cy\260c\332\226\261dn\307\374'\307\317\214\271T\305\204\365"
+	.ascii	"\230a\"\030\026\246\003\005\261\212\364\240\206G\314n\315\213"
+	.ascii	"_3\361\351\362\364\366\245\217\257/J\227\266No\371~+f\367\252"
+	.ascii	"xY\353\002R9\314\360\026L\272%(uD/\317*\b\027\216Nm^\232N\225"
+	.ascii	"!_\200_\360\210\234F,\036\233\033\"Nw\235Z\350\360\366\016\201"
+	.ascii	"7,V\354\274h5{\340\352\364\326\313o\353l\227\272-z\203\f\244"
+	.ascii	"\376\304\ro\271\254\205\205W\274\354\026K\347gU\206\246\323["
+	.ascii	"\272\337f\261Z|\270pi\211\352\224\237\f\244\00607\274\305\262"
+	.ascii	"3\245\316M\221NE\\\221\273x]V\356\267q\326\312\323U\325_\247"
+	.ascii	"\367\0012\274\205+\302VWW\345-oKn\257\323\333\267\337N\261T|"
+	.ascii	"\360\222$\341\353\224\231\f\244\206@\033\336\272}\250\002\330"
+	.ascii	"D\252\215\355\207\t\327\226e\373m\024+e\007\312]\233%\235\362"
+	.ascii	"\030\003\251\002D\207\267k?XbKU\235\002\251\245\245\001\343%"
+	.ascii	"G\247\267i\277\205Z(\001\202\277\250R"
+	.string	"\3414G\002\025c\204hHd$I\222\016\242\n\020\004\302a\032\352e\007\022\20055\320!\b\321\214D\251\264\033\\!\200]\352\020\025\367\226E\023y\214\305EG\370\333\364Q\036\355\272\301I\314\272\273\025!\252\361\036\234\320\327\024P ~s\004\r\215\3236\340\343A\265\2318f\205\037\210Lr%\233\2277~\017\032\360<0\255U\200\271S\375\200A\375\201\263\021-z\2256O\370F\300\220\271%\267\013\267\222^\354\305\022rWU\tg\353Gy\363\0206\316\036\257\350\305\376\207C\355\353\211\321\021\216D\236\177.CpO\343\007\336Q}\2325\220\\\217]Ew0\242\355\350\333\rYhs\221P1/B)\273iA\276y\211D\356EVaf\204;\256E\373\317L\024T\003\211\013\367\322\345\243\377\024\3109{\252\240\357\324\202\\\330>\356\245\366\023\021\026aXi\"\013\317\302\321lu\276\312\213"
+	.string	"i\232\305A\340\364\247\334\343\277\206\020m\317\207\020m\210\337[\213\272\340\320\321d\n\003\003\375\035{^\017G%\345\240\235\237\227z\330>\353\351\307\rS7\313\271\201\314<\240\364a>\017\300t\264\205\305tzq\377\212#\273\246\367n\204\373Y\234\2006\201\346\331a1\033\260\030F\t0\320I1\211t\301\224\271\213V\256\225\r\274#\243-\307O\3161\252cE\\\227\221)\344\314\024S\366\337\020\t\273\215-\272r\374[\373\023\312\236\363\007\031rv\342\244\225\013\275\203\215\f\326\301C?.|\276\213\235R\202\331\\\205\344}\022r\330q\2461\234AY\004\361A(\350"
+	.ascii	"\305]\013\376\264%]\204\215\030epr6\255\347\207d\336\222\336"
+	.ascii	"\""
+	.string	"|\255\316\331\375D\016#`%-\277\356\235\032?\002\247\177K\003j\271f!21\310\333e\030\336\035cAN\211\317\230(\315-\362\247\211\356\016\221i\345\003p\271\300\246\r^a\021\266\334\213\347>\230G\017P\t\214\3400\353&\252n\252b\036\2330\003\366*e\027;\307\200d\213\002C\353j\227\330\205\351"
+	.string	"\031\002\203e\0202\235\022\300\022\255e\323\242\2511\236\021\313\353\310JY\201\221\231\232\272vSe\207#s\210e\302\256\330\260_?z\t\376\002\272?\317h\252\234\206\330\013\232\244c$\260\300^\252\021\202\266b*0y\332\365S\017\227cx\t\372zN\222Z\314I!\364"
+	.string	"l3\362{\245\226\341\356\211\230\334\177\003nsH\206\276\354\347$\273O\276;k\356\255\203\001 l\211]\333Hr\302\303\262\323\343\354B\033\235\024\032a\n8\254\006\027\220\336\276\214\371&\363f\033\316\313x\346R\357\356\250\005\213\351^\250\331\322\025\201^\215\334l"
+	.ascii	")\336@\242L\036\027\301W\340\025\035\004zz\304b\212\nK\303\244"
+	.ascii	"\344A`\314f?\"\366\306.$\206\205\021\260\362\211\210\305&)\327"
+	.ascii	"\300\236?G\222\357''\024\224\336v]\361S"
+	.string	"j\206\271x\246\312\333\016\037\347\266.\255\233\"2@xt\032\214\244U\007]\005\rK\232\215]G\373\270\222\002\250\331\345\363\276}g\263?\002\245\nC\205U\304\313\025XrL\233R\336\236p\332\222\211\\\366\333\226\235+F\353:%\215\243\271\275\030\335\367\336\255\234l}x\207\202\331\206\\\375K\267\222\r\246\242\204\273(6-aZ\024d\007\261O\240\264I\311\354\2569x\357\214Z\340[U>\212\305_\345\224\214i\352\276\266T\326U\"\345\312\222{c\231\272ff\021\276\030\352\357\266j\315\327\234\232x\251\377\210\"OVK\006\007\252\326]\254\"\004\205\312ey\365YPC\221\207\f?l#\004\331\236\030\324}#O4a\225<@\376\214\234o\226{\357\253\273PW\251ev-\227R\244\"N\254\307[\316\"\021\376F\353$\343D\216\003P\031\312\0304\313a\002\265\323\315\242\220H\236J\245\344"
+	.string	"\256\005\b'4\360XN\003y\351!\250\246*\2671\220$\330\267\034\305\nI\006Gn.\332\225d\312\035\307\277\200\377eT$\365\304\331\275\257\221\360N%\263G\340~\234f\21024Ne\373\257YM\257\341\340\261\n\013Y\274\214\232\211\243j0\207O_\3164Xx@\336M\177\244\250\033\257\022\207(t\222cx\221\005<0"
+	.ascii	"z4\335\237\2619\343\017\306\227u\350z\to\2768\024^B\322\202\205"
+	.ascii	"\306\276\373\251\371\347;\201_>\365\\\331\216\313\370\"\365\256"
+	.ascii	"\360s\366\177\237\347\273c^yGy\277)\036\214\333\364\360\017\331"
+	.ascii	"8xj\372*\374\314k\202\006\357\031\035\273\177\351\336\025\343"
+	.ascii	"]iU\211{\250\206H~\2227\343\365\213\317I\026\036L/%\366\225\360"
+	.ascii	"\020\344 \365\b\035#\374\361\364\377D_\302\2350\303\363y\353"
+	.ascii	"\316\017~.\036\220?I+\313,}\323\34797\375\033\344]\35576M\231"
+	.ascii	"\257\177\365z2\0374\277\264&\375\231o\262\276c\2173\302\274\372"
+	.ascii	"\275\351Y\343\306\247k\336\335\306\372\337\332\205[7\336\037"
+	.ascii	"\316\005\303\030V0\326\200\226\371p\034\266\002"
+	.text
+	.section	.gnu.lto_.symtab.bbb07d98d8d13460,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bbb07d98d8d13460,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
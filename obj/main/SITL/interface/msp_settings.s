@@ -0,0 +1,938 @@
+	.file	"msp_settings.c"
+	.section	.gnu.lto_.profile.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"\235\006"
+	.string	"\002\311!,\200\305i\f{a'F\b\270\207\013k\214\022\345\230iJ\203\302\264\364R\234QWDFdD6\022\f={\357\335\275i\251\221$w.VVFQ\353u7\261\t\3016\351\264\256$\323P\222N\347n\232\225\345\222E\271\224\313\341\213\003E\223\336oP!\327eA\030\227\336\341\363\025D\020\215\bn\003\230\300\003\207\321\321\373\276'\207\341x$\234}h\350y\337!P\200\215A\333\375w\367\023+T"
+	.string	"\306I\267\205\037"
+	.string	"\253\004a\264\266\331:\242\275\2005\fl6\274y \366\364\344\004\032\206\200\315\303\225\001jh\365\305a\r\002\203\005\270L\300W\001t^\333\367\236\230f;w\206Z"
+	.ascii	"\036x\321&\227if\033\300Ur\206\225)D\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\022\001%\005"
+	.string	"\222\205\r\022\260%\351\034\206a\030\212\023p\263\226\354\306\210\224)\005\216\376ox\201\321\241\370\027Q\240"
+	.string	"\373\312\203_-\336c\244\023\235\333P\275\241_$B?\212\220\266(!/ `\2021\206\345\001\004\004\341J"
+	.ascii	"\306pwZ\naj\003\311\004\020pN<\204`\033\320\230@\370\032\237"
+	.ascii	"\005\202\016\340\025AC\271\201,\304:\271\f\306\333\303\242*>"
+	.ascii	"\334?G\205\202.\006\3100pt\201\200O\013\205\025\212\r>\003\033"
+	.ascii	"\200\002\230A\020\212\271\333\200ac\033 \203d\354\246\341\200"
+	.ascii	"\035\027\033\274\001B;\n\356\006"
+	.text
+	.section	.gnu.lto_.inline.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\277\006\205\032"
+	.string	"F#{H\300RN:P\354E;,~\027\n\300\233\204\354]C\024?\247\001e\332E\323\216nH\366\rX\226\272\301{\3066\005\240\261\220\036\213\363Z\020\331\222hrG\026\211}\025\005\027\020\016\356\003\037b\023\255-2\366\226)\005\\"
+	.string	"e"
+	.string	"o"
+	.ascii	"j\225\336Z%\214\332B[\322-\347Z6\3301\361\\\303bmwO\254s\255"
+	.ascii	"\257\275\325\n\323\335\345\341l\t\273\233\323b0\372D/k|\246\245"
+	.ascii	"{\032\363\231\036i,\2426J'\356)\216\257\364+\335S_\341\354)\354"
+	.ascii	"`t\355+\234\2477f\3712\032\024\332\216\004\330#\026!\021\326"
+	.ascii	"\335\205\321\236\251\032:\357\272n\277\357\373@\360\273\340R"
+	.ascii	"\310\377\277\224\350G&\003\305\025\205\242\250VD\353\364t_\364"
+	.ascii	"G\246\002\351\236\036\270\236\036LC[(\245b\371\322\211V\371E"
+	.ascii	"\272AP\306\002\300%\032\245%\032E\217\342\25395\335\323\033\246"
+	.ascii	"\033\317\227\211\024\214v\364\360\223o\333\3367\327\336'-c\002"
+	.ascii	"\212s\365c\261*L\001\004\201G~\267f%2'\251\026\304\262e4J\207"
+	.ascii	"\210\022\t\"\207\02174\034\220\323\255Y\027It\207\304v\020\255"
+	.ascii	"B\333"
+	.string	"\021\313\003\315a\013g\f\260\210[\263\333\332-gG\320\243\247\rC\n\324~L\245\200\212\200\n8\332\216\261\020\300\256\210\001*\203,d\356z\373\242\037\212\244\246.]\322\345W\244\301\350\2510\003vk\366\337$\204u\345:\374\270\231P\231\211\266\252\013T\006\264\233\267y\2337\375\204[\225Gi\321\223\350\223EN\b\316\246\321\252'\232\323\002\233\350\3433\344\301.$\211m\2759\037\312\305\210E\243%\033<\\j\242\220\354\n\3128\314*\221\367\325R\377\3163J\243)\264\222M>WAFl\b\n\342\005\255\005\201\024\375\031p)\001\200\267\250aES$\301\210$\005\005I\241\003p\002!\263Z\035\022\3404A\211b\007\231&I\352\265\037\007K\374+,\202L\263\226\325$4y\0044C\020^\223\314PIe\232\33090\013$1P\017R\207N \304\370\013%F\235\200\257\007zG]\r_"
+	.ascii	"\372\026\256\001E\200\236!\232\234B\177\243 vc\016\364v\325u"
+	.ascii	"\247\202 \213\343~\330\243\254\032!\3718&\007\267\314\241\365"
+	.ascii	"-U\364\372D\313\342\350\27042\f\rW\265\323\303\271mt^\310\217"
+	.ascii	"\t\215\374\036q\344=\205\263\241\274\003\301m\242\326\374\275"
+	.ascii	"[}\227\340\344\304k\275J~b6}\351\302-\373\020y\240\263G\313#"
+	.ascii	"\346\373\324\310\036x\306'\311y\fx\237E\305\0309G\205$\003\256"
+	.ascii	"K)\3708\fc\320\252\006\276`\016\352\216T\242\265\374\230.\227"
+	.ascii	" @\2713f\356C\256\016\312%q\326\231\235\240V\200\330\340R\013"
+	.ascii	"\223\217\224\265\001\310\363\303d\007[\345\236P\2034*^\3401f"
+	.ascii	"\013b\375A\241A\323\344R\tF\367b.A\031\213\231\312>\247&\\P\031"
+	.ascii	"\344Bq\243\203l\177\217R*-_\007qX\377[\003h\264\3352(+\024?\300"
+	.ascii	"\0206xy\215\251T\204\027X\025\212\302\242<\250G\335\263I\nM\351"
+	.ascii	"\335\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`J\005]\013"
+	.string	"\002\r#$\240'\205\016\377c\333?\360\364\nUU\375\266\207\232k\374\027\254x\301\314m\237\330dmkb\267\333[&\031\244\242\320\227K&\255o@\365\207\237a\234\241\030%=\024\177\325\211T\356\2628\347\360+i\223\n$\276\t\346\230^oa\345b\252\350\r\364\nz\007?!7\357p?\032\236\341\021l\022\364i\365\361\335\260oXg\302U?\234\021\366\025y5*"
+	.string	"\351\034\237\ta\313\271\032^\315dI\242\362r\361\375\222\236\b\315 a\250\361\301\"b\220J\226\355p\"!3\353\006\022"
+	.string	"\363\024B!)I!D\024ER\022I)0(\237B\032\003+$ZH\317\231M2K\017Y\255\243\324\354\216\246\240\223Q\372K1\t\201\377-z\212A\3112\224P,\177<\371\302\362\033\3616X\340\004\362\205\352p4\223\313\210A\354\221i\302\2116'\311b\230"
+	.string	"eDO\223\353\340\031:E)\372\260\242k\rU\016pqic|\312//\016C\235\2544\020\211L\253VX\373P\016`!\034\303\374\f\2106\n\333\206d\3519\307\025\001\023\373"
+	.ascii	"\300\275\270p\300a\035\373a9\335\217\224\263\033\004\247\311"
+	.ascii	"\253\251/\242\237U\b\360dt8p\031\275>`\215 \326\376\360*\033"
+	.ascii	"\334\373\0242\n8?\206\330\247R\371\254*\337\003"
+	.text
+	.section	.gnu.lto_.pureconst.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\205\004\001\205\004\003\271\004\007\231\004\b\231\004\t\232"
+	.ascii	"\004\n\232\004\013\232\004\f\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\025\005"
+	.string	"r\b\032\"\240'\351\340\342\252\276\277\370\252\212\377*\240\354\326\215\323\004\306i\377\377\311v\234\237\027?\331G\244L\0013\013\263h,jps\034\307\013:\025\345*R\221S\200\320\343<we\275D9\242k\035\035\326\032bh:i\177\006U\237\254\234%\266\362V\205\\Y\351\007@My?\n\275\033\232\363{R\376\r\277\357I\b\027"
+	.string	"\270"
+	.string	"^\006\327\031L\343\200wI\270Z\336\214\005``\301\024S1\307\004lh\314\217\230\245A\032\002\202\210+\306q.\330\360\312\302I\325\263\224\f\\\356\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.6931885361fcafc1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_settingSize.27.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`T\004\315\031"
+	.string	"\226\353\225H\320\224Qch\030\242AZ\230\nB\032:\027\303\302\304\202\224\026\251\250 1\223\300\237\002hD:\305\243\253BT\rN!-\026\272\216\037\\\003\034Y\215G\270;\202\0033\326\006\013\273kX\332\007p\267\275\245\224R\246\024\202"
+	.string	"y"
+	.string	"\205"
+	.ascii	")\333R\332\207\361\030\261\343n\036\340\336\241\037H\367\346"
+	.ascii	"\022x\201\370\352\334O\354\253x\001\366\325\266\0254\210Y\366"
+	.ascii	"\234\211\236\221f\333\241\201\344\336\234j\226\270\354#J\fm\245"
+	.ascii	"S\312\374\331G\335]h5T\220\007\332\024\213.a\006\210\247\021"
+	.ascii	"@A\017\0074\331\357N\221lK\265\237\016\257;\031t&\225A\237\264"
+	.ascii	"\361'\307\236\020\371N|\204\217m\312\260\345\336kY\373\001\272"
+	.ascii	"S\267\275\263\275bS\b\001w\366\020@Y\273\007^-\002\241\034\331"
+	.ascii	"\304\376\035\305~\332i\271c\243\371\302\215^\342\2759\016\374"
+	.ascii	"\032\260\032\021\305\215}\375|\321\r\2108z\201\303\221A;G\223"
+	.ascii	"\363f\177\006\203A#\236C6\225\036\2514\312"
+	.string	"\322\"\225\016\251\264=\356\257\226\236TZR\351\247\254R\020\002\275{{\202K\356\257&\245\260\375\335y\266\313\270\316\3469\327\231\222\213{o\312\306N\275J;f\007\250)\2478\253O\207E\314\177/\026\233u \025\0368\311\374G\353\225\201\223T=\361^\340px,\205I\267\034\354\274\371\326\3477[yj2\252=|\037\006\262\330(\017\233\035_:\223\234G\261>\r*\276\363u\370I\242\211\353\003\264\254]\032\217\212+\024\316\357^\223\374\302p\206\307\361K&'\362\021)\321y\343\335-3\311\304\377\233\2146|\230=\337\206\201\347\345\360\217\f\374Q\256\376\206m\340{L7\253\032\013/\030\252aR^13,\030l\365\232@\363\222Q\255`^(\270V\260\031\226j\206\365\"\243\202q\275T)\005\334\242Y\271T\260V\313\245J\345pN\357\0342\200#\342\203\374\272\323\025$P\027\362\013\265"
+	.string	"\3167\375E\037\235Z\360BqN\317)'\315/r\267\320q\b\312)F\304\247\363{4\230\306y\335#(9\322?G\033\342\274Y\245\206\375eV\205D\225\227\331\357\356\322\323\204\322\313,j\362\330\001h\250\341D\245\230\"\251 -((\224\032\003`\002\0312\262\033\021\200\275s\2460)I6\366\r\203\3418k~\363@X_\260\260\030\345\2056B\332\360-\002K\307h\250.S\2608\270\034\025]\007\322n\365\270\022\036\221x%+MS\344\3511\334C^\362@\200\006B\030\250\306\206)\266\037b\234\270U\007\367\216n\223=\241\201\316?\034L V\024\274#\230yT\210\361P9\314%\325\204\343\327z4t\243a\372j=5\317\3120!\032a/\270\2172p\252\\\235Vy*<"
+	.ascii	"B:\370\242:j3\313\351\254;\034d\254-\353\350\223\362\\O\277\177"
+	.ascii	"\017*\261\004\326\274Q\021\007\202\206~\351\315\223\203\262\003"
+	.ascii	"\305\347\336N\320\276\027\320\366u\204\244\2431\326|p\263S\332"
+	.ascii	"\3510/\250\001"
+	.text
+	.section	.gnu.lto_settingPointer.29.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\271\003\255\030"
+	.string	"\266m\236G\260XQ:A\231\236.\253\r\352p\2105\355\002Bg\365B\337\234\346\004JhC\242qF\306\372 \376w\2269\227\272\346)\314\344\272\323\231\311\375\331\301\331@\271#\316c\026\246\264\016~4\315q\022\226\220M\244L)\211"
+	.string	"{"
+	.string	"\215"
+	.string	"X$\224\035>\221\373D\274g\326\f\240\2309'K\204\315\272\274M\302f\331V=o\304k\346d\352\0225g\017\201\025\254.m\373@\036\204\204\217b\275\033,\002\320\260\202{\0223gO\346\336a\342\345\3527\342\345\332\370\321E\031\256\036\371C\336S\003\026\231R\242\253]\254\360\303\211d0&\247k\361\360\276\033\320r\304\211\013%\272\026_\244\233\bk\222\312\021@Wbul0\347\264\346t,\356\361\266\211lS\260wK4\3612\\\002-\325\265g\032\364\271]\036\244\255\371\253{.\270*\003\375\211\303jN\244\005\276\221\016A+\035\227\376\b\361\362;"
+	.string	"\007\317\246A\273w\323\255a\177\203\301 \225\227\311\016\325:\241:\026\252sB5N\250\206\205\352W\250\276\t\3256\241\272&T\273F5\315\250nY=s\336\017`\245\036G\2658\252\245\325\241\250^\251\326P}\001c\220,;Ss\252\b\222\231\001\267\334\035\2105k\263O\352!n\315\212^pU\266\007\267\002\301\265\362w\204\212g\373\275\245\204\245\246e\336$\325$eM\305\257\342\232\262K\3414wQ|\251\325w\304\377\346\t\2479\357\363\237x\316\332\227\354G\031\270\2721W"
+	.ascii	"\255\271\211Sr\232\273y\340\222\246g\207\244U\216}Gl-\315ZqJ"
+	.ascii	"7\r\372>G8\023\tn\355}\327&\030:\250\204L\020W\224\361R\233\202"
+	.ascii	"\005}N\356\370bw\333\232\355\013O\202\001I\b\237\336\300"
+	.string	"3\373\320\301\007\204\364O\002\232\006! #\243\031\r\003\021-H6\373\361\311P43\022\002\222\t\001\371\004\311~\212h\262\004\005<D4+\222\031\r\r\025\311X=\333\303\271L\276\217/K2\266\036\302\2049\020\240P,\355\330\233\325Y\023\266g\226\307\2667\217\033\356\314\312\247$\037:;\356\207\274g\006\260\310\024T8\347\234b\226\330\312\337\222\250k\023\036\022g_\233\363\272\003\021\2668ra;r\271\362Z\371\203\242\342\331\246\\\233\304\bm\326\2657\273`\222\226\002D\250a4b\234S\b\211\320\214\210\244\260)\034\300\002\2211[\007\021\200\261cLF\013\323j1j\023@\347?\202\254h\023q\007\232Zl\375\3140\370\320\360\223\016EP\352\231qh\237D\017WC\317Sh\200\236\221e\337}\321b\273v[4\241\363\330\330\237\177\221\"\001\363\264\375\376\376\357\270\205\206\354\334I\227L\027"
+	.ascii	"\"\217:p\344\027\345\243\311\3443\222\352\b\027\025&\262'*\237"
+	.ascii	"+\b{m\256\r\2440Ht\221\306\217\252; \330\027\236\277\017,d\321"
+	.ascii	"\221\224\n"
+	.text
+	.section	.gnu.lto_settingsTableHash.30.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\310\005\355#"
+	.string	"zBP\016E\200\236M:s?\017-\211\325\222\211'q\314\031E\277r\304J"
+	.string	"\b-\t\204-0\001\005j\302x\352,A=\306\207\277\306\023b\265\021E\344\002<' \026\007\377#\372\025\310/\302\332Y\263\204lB\344N)\316"
+	.string	"\275"
+	.string	"\333"
+	.ascii	"#\265\177\345X\242\236\005\306\326\350\320$\314\301IO0O:h>\250"
+	.ascii	"V\361\273|\341\245|\212\324\251\3040\317.\246\325\232:I\346I"
+	.ascii	" jG\371A\333NF=\no<\257dx\"G\354<\203\rN:\202y\362\266\224m\363"
+	.ascii	"\235\374\211\224yc\220\b\260\226\025\346\023\222\235gP\227\273"
+	.ascii	"P=9>\250\236\334!\2566\227w\232YVr\\\312\363\313\013#\023\037"
+	.ascii	"c?\340\214\323\256\346\306\016a\0255\213\204\340\300z9\2264l"
+	.ascii	"\034\371\001\372\306\2442\261/\377\242A\353\326\325\311\362\302"
+	.ascii	"\327\215\226\274\371\001\257>\326\254:w\200\340\300\372\n_\244"
+	.ascii	"\346\306\2161w\236\347\241\234Z\001\251(-/\234\347i\372\003\342"
+	.ascii	"\270k\267-\305v\005\233|\022zjY\021\311\232W\277(\246\300\251"
+	.ascii	"\242e\366\273\334\013\3177\342\027L\364\277\223>S=\371] \037"
+	.ascii	".\254)Z\264\203Tt\265\354\337\366\234\201y\203\330\n\022 U\352"
+	.ascii	"\243\222\332\250\244F`R\027\325\250s\007LMd\340Z\356\002\247"
+	.ascii	"r\017\321\250"
+	.string	"\205*\365\200J\035T\251\005\320\250\003Tj\240J\215\373\360\376\251\324\267\222\032@Im+\251k4jZIm\232\324e\245\256\225\232\254\324\343H\275%5\255\324_P\236\245!\342r\2366\212\304\023\r\371\005\311\207\277\226\237\312I:\332\367\275>\364\277l\013JE\335\212\277\205\226\206\310\344<O\333I-R\317\002\343g\357\006\355\227\025\026D26k\312\265y\021\373t\335\314\311\255K\240M/\311\317\216K\356}WiF\006^D.\254r\265|sC*\330r\3305>\314\221\326\352_/1\004#\017\254\307q\267\300Z\211\250\271\305\020\007\214\203\210\303\250's\273U\336X\361\230\032\317\223*\307y5\301*\330\232\247\227\004i\2176\301~\217\357\312h\217\226\016\205(\202\365\207#H\320\377\2146W\2653\\\264\bvs[\264c\030\337\031\204\027\330\003\373\257;pc\247\247\204\212\026\275V\304\320"
+	.string	"\222\253\345\022/c\002\267U%\301\266\214\2239q\3731Fv\236UIb>Fi\274\221\223^\332U\025\213\333\"ru\r-\335W9\t\246G\321w6E\213\233D\244Ll\\\255\032x\234\b\277\240\202!\267\370\220\005;\026JM#\323W<)\255\030\275\364\340IE\023\023\024\324\356\351\204\213'\026\272\335\222R\n\247\035T\023\223\256\211I\211\205n\311\351I\367\340\310-\\\354\234tP-Z8\351l\301\251o\020\242\315M-\225\307\210\366Pn\344U\244\255\226q<J\003K\226\255\207Vh1\200\345\271\236\016\343\215\030\203\206\372\237\206zR\350A\212\334BV\231\017s\254H\373\263V\366\037\243\016\255\201\275\360$\236\036c\275\036\003V\214\232\375\360\004\355\200\255t\004,\320\006\005X\001\033^\247\203m\313\214\t\2359\001\326\266e\306\205[\240%`\326Kr\333\272\270\035\333\370\256"
+	.string	"\354\315\266\346\002\330z\306\247\303\274\303\324\332\332\226\200\260G\244m\315\303\341|\300\375\b{C[\nE\3125\367\276\263)\203x\233\0206\257l\250Q0\303\fcH\231\022!\321\244 Ic\220\002\231\251#\017\020xU\332$\303\001A\024\003#3\326qb\213\325\tI\021\0161"
+	.string	"\273F\263\004\333x]7!\021)\214\337\201\013W\216\335I8\241\374\265\225\275\224\020\305\306\216~n\307|5\321"
+	.string	"\321]CdRNP/&\270o\375\221\022\253l\277\024 \223\241UO\353\2341CA\255\2441\020\021\251\242\212F\236\221\2375["
+	.string	"x1\007)\263}\ba~\305\235\205\346xA\254,\025#n\200\230fQ\007\024Y[,\241\257\265\033R\340\013\b\254j\357j8\013\225\211\216$z\275\371&\001\363@D\303\271\373\004\270\273\344<\321<$\037`\327\263\002\334a\023`\215\220\247~\3122\r\255"
+	.ascii	"\026\r\300a\276z\261\261x0\037\004a\316k?\372\303\374\001"
+	.text
+	.section	.gnu.lto_mspSettingsInfo.31.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375` \r\205E"
+	.ascii	"*{\334\032;0\246N\007X,@W\315\217,l`b|\323\351\f].\234\326z\020"
+	.ascii	"\351\277\r\253\033\033),g\203;\007\325\252\301\302:7\363ed\336"
+	.ascii	"\325Q\212\207\b-5!{\357\224R\n\246\001y\001\246\001\201\230\355"
+	.ascii	"\323\212u\036n@\006\234h\201\346\025\376\341\261\225\326\326"
+	.ascii	"\305\207$)\326\177x|[\227\232D\210\255\362\r1\356>{\232P\254"
+	.ascii	"\371\370H\257\234\233f9\304'/\261\306\261\325\251\264\243V\277"
+	.ascii	"\036\034\322y\370\345\004Y:\334u\332N\343\271\003D\211\241\271"
+	.ascii	"\030\202eS\352\275tvv\\\034\003\313\246\232{\027\216\206\035"
+	.ascii	"b\336\212c\367q\003\312\3519m\377\0059^;\307\247\241*)\216\255"
+	.ascii	">y"
+	.string	"G\255C\230\331V\275\3414\037\263\314\034\247H_68\244\223/J\b\n\027\332~c\344x\357\214~Q*\210\367\356Y\265\312\032x\357\017V;s\3475\233\266\365\2164\324\275Z\364\354\334\273\027\201+\034[\345\275\026\260\266z\354\250\265Un\231\035\365^\335m>$N\276\304{\357\325sa\226{\261\323\275\346\345\267\r\365\344\304\\*\331$\362h\\\325\364\275\345\226\003\004\007\321_\034ZC\261qk\376\224\262\240$\250\007\301\331\245\036\302<\255\324\271S7\355\232\231\272\027E\220z\020\0344\3450\370dI\003Z\361\245qk\213\334\\+S\343\332\2220=\b\256J\232u\t\021O\007j*2pS\234\335\"G\245\223\306-9*\215\024\034s|\2751F\343\326`\223\310\242\006\022\0269)\275\256OX\340\2448\327'\266\365\211\n\013\\\224Tm\300\256\262;\314S\304\"7\327i2\256I\177\272"
+	.string	"\357\322\036f\234Zz\240o\255K\363\265\273\305\245\271\033\267\356\275\354\3178\271f"
+	.string	"\315\3346\230Y\007\2632Evk\253U\377\200\236O\b\374\372\215\247\255\006\325\201\203\310O\315\252\273\204\250~\224\325?\347\376Z\225\231\356\350\375\324\027x7\346*\267j0\255\030\377+s\330\300\313\264g\274\237\r^\352o\314\241\232Z\340\325w\200I\201\247-^\273\206\312\231\3336\037\274\237\351'\253\034\246=\032'\360\177\252g\036\301\345\375\344\251\265Gc\377\377vnj\372\"s\023\352B_i\177\341.\023k?M|\213>\305(M_LS\003*Xx?\247~mC\247\366h\355mm\317\377(C\350\376&\003\307P\315/\361"
+	.string	"\227z\346\0270\274\237\375\215x\347N\021Q\355\321\230\367\322\374\243\314\235f\n\204\362ka>a\242\003\233\275Z\260\271\013\312\271D\2243W\2243\t\246\363\b"
+	.string	"\316\"\240\234C@9\203`:\177`:ou\340\260a\351\254\201u\316\300:k1\235\263\236\234\261.X\220\320\205\315V}\247\271\252\34347h\275n*'\347\251\336\353\226rr.\320\177\315\004\006\260\316\002\372Ms"
+	.ascii	"\3269J\351\f\200u\206R:?\261\316NJg&\353\274T:+Yg\226\351\234"
+	.ascii	"d\235\221m\330|L:\033Y\347\225uV\227\316)\353\374Jgg\235\033"
+	.ascii	"\005\214\273DH\016\b\357]\262\230\351\036\252x\304\264awaw`\267"
+	.ascii	"`\367\235\356\277\3567\335q\372\310\334\334~\332\220;\033^\303"
+	.ascii	"s\370\246\344|\222\3415\274\007:75]\353\271\r\317,\235)z?3\374"
+	.ascii	"T\326k\375\353qn\302\372\254O\365Lh\to\365\035\250#\034z\304"
+	.ascii	"f\346\375\b\327\344\222\037e\255CO\324\356\262\025"
+	.string	"k\217\261\304c=YC\274\327\273i\3559:]k\261\251N\327X}F\356\262\265\007\233\013N\032\247\340\n\342\273\336\355\f\223[9\323\264l\016&:\264\315\302\016\252\2238g\364DN\264@\331\350y\263y\013\371Qn\367\203r\344\372\022\277\270\3302V\022\317\365\006\002\331\240#\236\304\331\242Oi\257t\340\263J.\245EK\340P<J\233\266\326:\235k\253#\276\203\"$\356\244u\263\220\350\315\233\264K\"\3241i\347\274\336&\311\305\211\370e\234\241\342b{\237%c\234/Q\362V(\211[\210\357\302>L\034I\353\204A\035\024ok\245$HD\305\235\355\\\204\267\303V\235\315\327@<\322M!\236^\023S\257\206\207h\256\211\231Oh\341\232\306m\211\035u >\376\364\313\2166\265H\267\346\356\322e\342\326\324R+\246+\346\356\336\036\344V\344{\321\032\312\334\211\307\272\013\347\210\375y\323"
+	.ascii	"\357.\335}\320\352\007+\2725\337\304|\330R\353\326\177xvg\224"
+	.ascii	"4_\344\036\344\326JSj\257T\275\245\201\346\335\253\206aR\233"
+	.ascii	"\245F\223I\320\274H-\t\310\332\352\326\367`{\227\2674P6z\210"
+	.ascii	"@\026$\272W\255\237\314L\326\217\332,Wu\367\252e5jGm4\355/\255"
+	.ascii	"r\313\245\265k\003`b_c\351\216\262\257\035)X\220\036_"
+	.string	"B\324\2610\261'\362%\366aMf\266\"Y\006\026Ff6\006f\274AV\366fe8\236oH(\3231\026ff\006Vf\343G\231\330\025\330\215\257\034d`fcaWca_bW7\310\312\256$(`\037?\300\310\256\314|\370 \273b\367\232\375Z\230\235|Ms\312\034\360\001\336\315\313\322a\363\3238\300\263\267i\357\214x\242{o\221\265\325\346\353\005r\200\360\030\352\243\274l\326\263\nxe%*\001\177\341*\336\251=Z\232A\315\"\274'\004\202\"\021Z\244\346\227^\003\333\231*N\037\345tL3\217\371Q6\206q\002*/x\031\252\342\024L\013<\201wk<\355\265\226\306)\250\264\360\315\327\\Q*N\301\224\t\274w\222J\315!*G\3112e7\374\261;\310J\340/|\003v\212B;Dl\320\2646\262\016x\013\277\302\213\037\0334-\n\300G!r4_\310&a\342\0313"
+	.ascii	"\036\331$T\324\203zz(E>\346\214\021\262I\230\346N\314\323#\233"
+	.ascii	"\204xzN\314w\362z\346W1J\340K\345/\273^\371U"
+	.string	"\204\252\234M>\373\335\345U\317|\366\350\f\222\3673\371RO\302\303*G\376\326#\277*\317\261\361\364\261\220\0368E\304\265GS~\224\227\207\222\035\336\030\250\207<\266EZ\303\327\016\326\r\357\326\201zF\240a\322\3529E\032_\302\273\365\231\244\025\353C,b\217\266X\316$q\177\341\346\261\266\212\365\337\207\310mJ3\275\307\233\306\244}\254\034\276\303\257\222\330\310\004\200\364\250\2210\344\024B\b\221\210\210\210$I\222\016\200\002\0211+n\003\021\240\251SG\222\244\260\205\003\302@]\335\021\341\351\366\332\212\251?C\240V\\\3105D\213\267!s\236\002\023\222\017\235\023E\240J\342\330\b\205&r\375bRt@\005]`#\222\004\302/2m\262\036F\220\246\314\013\315\307\216Zw\267Vr\270\037\031\274l4{\277f\022\004\205\363,\255\002=\322\316^\023\334)\300\361\224w\310\357\032\030\374\002\223&"
+	.ascii	"V\255\355\261\303\344r\324\023\214\017e\371\215\305@\361q\305"
+	.ascii	"\271G\210q*\033\237\t!D<\nB\310!\352\347\027I,U!\325\361\303"
+	.ascii	"_\260Kx\335\274q\234\356\352\212Mas\376\214\202\034_]\013h\354"
+	.ascii	"\323\n\037\027\031\335_e\235\315\265\245\270gd\376\"\350\303"
+	.ascii	"@\315`\352s\264\234\232\016\036\205\177\324:\252\371\\\310\265"
+	.ascii	"\272\217\336\307p\220\361\214<>\212a\3478\002_+Dj\250\322\345"
+	.ascii	"\350"
+	.string	"\333\207\200\345\255\371|\237\327/\360'\300+b\236\364\352\351\037\363\322\3373%-}B\b\310D\370\200\b5@\376I(\240g\005\004\315+\257fH@mc\342<\203\347\347=m-\267\277\275Tv \265HJ\\\246\002\244VBZ\325\343\304L\312\254M\207\245\271\255Q\323b\026"
+	.string	"\354\003\017"
+	.string	"\200q\241\nLj8\260\324A\324\\\2306\352\027\213\025I\312\"8\007_X\"\250\266GC\325u\242\356"
+	.ascii	"+\334\232\261\276\007x\007\322\036\270\254Q\177I\233*-\024\234"
+	.ascii	"/\216\034,\240\253\270em_2;\017#D\315\023\365\232\316<2\f\225"
+	.ascii	"\f\fH!\204BJ\332\233\005(\252Kw7\0015\203\032\254\315\001\330"
+	.ascii	"\343:\025\232|\302n\254\205\300\363\224\322\023\244\3021\250"
+	.ascii	"\031Q\320LoH \006;\355\f\016\230\372\314\032\211\370\003"
+	.text
+	.section	.gnu.lto_mspSettingsRead.32.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\234\tU7"
+	.ascii	"\252aL\025CPdN:\223\262Y\271g\007C\017??\251\336V\0221\254\n"
+	.ascii	"d\030h1\375@\201\201\346\177KH\205\217\222\361\204;\202\b\b\001"
+	.ascii	"AE\n \270vtBh\247f\2306\256\253mT\2334B\310\336I\006F\001,\001"
+	.ascii	"E\001ql\364\344\274pSUd\013\257\005\233>\334\333\016/\2759\026"
+	.ascii	"/\323_\373\231\247\271\233\232\267\271_sd_8\226\310\026\032\024"
+	.ascii	"\354U\">\200\025\315U\233^\032\022l=\376r-\201\312\2655\037("
+	.ascii	"Xpo\006\213}\321~j\234o{\357\373|p\2657\364\217\356\366\352\333"
+	.ascii	"\356g\035\206\343\356\207\271\030\367i@^|_\2624\270\367}"
+	.string	"B\350'\366j?/`\275\312\036\300z\325\355\376\363\247\331\37351]k\210\336\367u\312R\036}\372|\007\373(\273/\022\217\220\206\302`k\004d\177\253\232f\354\366\221\242Zx\3240\221/\236ia\342\231\031>\342\372rr$\267#\250\263\234B\346\f\017[f\022\013\353,\307\340\216 \313\262\t\016\226}1yk$w\004\315\257%\007f!XX\274\247papa\370\232_b\377\275\271\0243bv\255\002\246\300\241\322\b\232\313\260\274\246KdN\370^g\251$=P\227\327\3252\271\260\232v\210\003+r\271c\"\314\255\024S\321\023\350Y\226c8\205\273\b\347\\\240\346\027\223\347\223\271\b\2751\201\232_N\216\177\037\336\367m\254d~\275\001\274\373@\272\373F7{\026o2\203\336\357\270b\322W\271\332\356\030\020\353\225 \326\253L9\367)\301\212\031\347\313]\215\263\362\226\353\224\260\035J\333"
+	.ascii	"~\360\020#\202mK\362\b`\023'\360\225\t\262\2016\261\001\3709"
+	.ascii	")w\253X\201\257\354\003[\031\331J\371\231B\2259]\320,\034m\001"
+	.ascii	"-\\\340+\227\362R\233\021$< w\303\210\201\257T\312w\373\311\274"
+	.ascii	"\230y\311\214\274\220\204\256,gg\367S\013\177\005\343\303\354"
+	.ascii	"L\326=\304]!\210\373i\202\204\273y;x\334\273)\210{\301\343\274"
+	.ascii	"\231\202\270\025\234\355\235\340h\336K_\363Vz\332\237\364\347"
+	.ascii	"?\340o\357\"\261\305}\324\342\036\036\341\026\336\314;\330\342"
+	.ascii	"n\207\270\215Z\334\300 nv\210\373'\304\275\006q\253-\356\264"
+	.ascii	"\305\235[\334\270\305}\013\355\":\017\016\275o\221\350\2427O"
+	.ascii	"us\345u\277\233?\356\217\363\277\375f~\266"
+	.string	"\037\315\277\346\300\356\367\325\216\367\343w\r,C\250\235\353\333\321]\216\373:\034,r\311\262Y\313\263\367\276p5\330\253\007\322\003X\333\364\337\034\316\345\272\2153\245G'\203\rM\017\257\373\367\312\340h\033\300m\256\220[$\267.\350\031\254F\271\0020\377\262QV\327\270\240l\006\346\213a\256+\016f\356\022\274\3456\021f\025\352r\025'\261\026\2339\234\245\325\375\227\333\254B^\302$\3405;\310\277\273\235\013\245\200\331\373\276n\024\327\311\225\221\375\224\327|\2733}\021R\303s\006\372\276\367\007$\356\323\003\026\372\n\306fg\177]\346!q_\263A\246\035\372A\373\321\376\343!,\355\303J\276'\272\"\234\257\264\"\n\202v\274\276\241~_\344\307\272_\2105{\227\177\032+_-/\264\367\311\333\340\352\202|\274\253W\340\370\366\222\030\332\277\005\307\261\332\275\251I\250\013\241\357I\206\241\263fg\240+"
+	.ascii	"6\325\364t\336\225V5+\310\215\273\302\264pT\312\367\256TA\200"
+	.ascii	"\020\275o\362\002 \027\214\260\331\007\221\237\377\231Z\257\252"
+	.ascii	"Y\025\004\210/\355\001\025\327\n\276\322Af\362\022\223\323\344"
+	.ascii	")\233S\2633\3159\277\251f\227\304\211\272)\247Yu\353\2022\300"
+	.ascii	"IX\\-\370\312\234\003\264qa\302L\271\333\345\342z\301W6e&\257"
+	.ascii	"-\375<SMy\3367ye"
+	.string	"w\3738\036\027\214\005\26374\214U=\322\250\253\0343x\250Q>\244\216\251\321JG\226\272\325\321(UCU\215V)\254\250\256\252\240\330(\252*\032)\224\361\230\255\2164rCE8\332\240\222\262\262\212:\306\320q\234r\212\202\232Q\303\030eE%\345D%5c\312\t\312xt\212\240\240\253tD\031\235\254\252\252\214N\3553\353\231\254M\364\345ee-$E\260\037%\035\345\225\356I2#\237\301IX\0271;\033\277\341\254\303,,S\303c\200\007\f\363\311\274\004T\003\332\334\220\243\354\354\277\202X\237>$!1w\220\230;M\2119\030\314\005\222\360\351`n|\304\375\202\025\314S\245\337c\275z\2673eY\344\205\3120;\273\230\205\031C\325\3600\023\177\035\323Wi\267\210\322e\256W\205\371\302YX\026\216f?P\320\022\t\263\263\237\344\264\3000uD\262R.f\257\313=\275\273\323J"
+	.ascii	"\222\321As\037"
+	.string	"k%f\257\245L\314\030\3724\370\035k1O\310_\254\234\341\032\303BN\314\022r\204A\\cZ8\212\357\332\0138\315\016r\022\0227\t\331\335\223o\217+#\347\330\321c\310(;{\002\033\373c\255\023\312~\370Xk\264\353mM\217\265>e\257n\034\351\373\006\200\274\250q\034\347\230BF\221)\021\021M\222\244\003P\002!\245\214\250\033\021`A%8S\220d\330?\003\b\267\362_u\246:\240\223i\271\323\323\305\303\367v%\237R\3645\0261)\354\374VK[-P\261r^\"\3006\240\t\355\316\030\375\027\2070\207Cr\207\036ArD\267\037\332\236]\345\345:q\213p!\262\342\252\031\243U\244\020\335Uyw\356\323FZ\032\023\214\327,\353\274\220m\353f\356\231V6\020\204\006\013\033\350\373p\300\346=l\r\201\202\372\274.\336y\375UaI6\226\335`\222\203\263\342p\371=\361\025\227"
+	.ascii	"\325\301\224\004\270\003\300)\367Z\002\213\260\306 W\216\236"
+	.ascii	"\231\246\256\343Yxx\241wM\215N\372\004\326\212\214\221\267B\036"
+	.ascii	"w\304\360N\324\305vc`\304\243\234J\254\233\266\037\364\223\321"
+	.ascii	"\017\226Zf\230\301\"\022\025ci\340\321 \345 ?\252s\263\222\264"
+	.ascii	"v:\026,\024\035\214n\316\332\242\222\f\336\024\005\t\253\374"
+	.ascii	"K]CW\276\265\276\252L\2622j\202\303\324\373H\021\364Z\206d)\204"
+	.ascii	")\344\3113\b\360PBwD\025\207\205;7\001\243\206\320\374\331)\363"
+	.ascii	"\n\b\006{\036\307\016\235\340\220c\204\265\360KXA,\270O\254b"
+	.ascii	"\341\263\207\326A\b\260\177\235a\206A\346m\202\365w\357G\231"
+	.ascii	"~\241\001\221S\223\021\200\327<\216L\332\\1\2456\2653L\255\221"
+	.ascii	"L\364\241\264\313Q\225\25517\3038Or\213\232\322\264(*"
+	.text
+	.section	.gnu.lto_settingValueIsValid.33.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\357\n\3558"
+	.ascii	"\312d\344\025>@\244N\007\313P\335i[`\245%\2515\300\247\003V\357"
+	.ascii	"\347=\337N\301?X\271\f16\332!\347H\361\231\002~\321\377\177\214"
+	.ascii	">\265_\272\314\321P\237\25283\307w#{o\271SJ)P\001(\001X\001\352"
+	.ascii	"u\276\252sz\235\377:\373un\fSs\315\267)D\036\220\263M\022u\324"
+	.ascii	"\002^8Y\032\332m\246\373\f7\032\250U\267lm\017i\004\275R\330"
+	.ascii	"\266N0\266\2573\007\341~\262\221\273L\353\005i3>\250\320\234"
+	.ascii	"\355\332\327\035\032\274Em\333\"\3732\006\266/U\372\316\037Q"
+	.ascii	"L-\232\336\022\n\356\314\215\327c\202t\036\220nj\333\270A"
+	.string	"7m\353\314\342.\266/;\033J\355\313\366Q\355\313\314\314\025!\b+\3339\227d]\016Y>\027\265\255s\353\247\264\262\237\216NMLKJIH\306\"\221]\325\233\276+\271\313\372i\0054\315\261J;\321U\361&\272\224\212\2123\255`i\372\305\224<CKUplOZ)=2a\363\007\253\216\371\304\223\250\352\230N\034)\035\320\304\323\326|\230\315T\301\236(\203:MW\3251\337\334\230r\251Y\333k>\314\2714\311\013a]\3271\233x\361n\013\361\253\020\357\216\255\262\256s[\324\272;A\267\276\r\307\\\262L+\256\tQ\221\376pq\343*8&\223\233\366\263\323B;@<C86+\375g\r\307\264\242B\321\371U)\256\241\275\257`m\333\262\027Yck\206j\346F\302\314\033\230\213\307\205i~\310k\204\336\353N_\256\223\252?\327\377s\031\246\345(\337\222\334?\324\276\376-\354"
+	.string	"\251\271\231y\224\273\257\251\312\374Q\323\371\321\365\375\313\305\341\336cB\266m\313\330\213\264K5-o\270\3410\341\237\241\323\266e\335d\347m>f&\354n2\241\027i\257\372v!\241\240\371!3`K\251\375]\317\276\\r\3061\232M\222m[4\t\334k\224M\031\254\225\276\334@\324\276\375\375l\247{\233k\216\3113\363(\263\263\314_\216\271?\032\215\032\342\217cf\347\013\354l\241\302\027\005\257\tDg\t\3279BC\233!\\\347.v\346jg\367\203\316\353v\260:k\255\316Y\354\214\325f\232\221\253s\003\326\371ju\266b\235\031$9/0:+@rN\200\344\214\300\350|`u\256\272\316TEg\003\327y\212\350,Et.p\235\t\020\235\007\020\235\005\020\235\243\256s"
+	.string	"\2423"
+	.ascii	"\2423\024\321\371\351:\037\211\316N\327\271\211ufb\235\227Vg"
+	.ascii	"\245\3259\351:#\261\316\306\353\\\\\235\211\2533{\235\327\325"
+	.ascii	"9\375\024\274\006\276\323t\352%J\036C\004~\032\3351\276\034\257"
+	.ascii	"vK(\261\302\363\220\303Nx\036RV\257\037S\244Rx\025"
+	.string	"\320\333\222\357~=\362\325\250ZJ\355\372('\207\364\002\2419\243:\305\251\257\360\375'g\352O\210\201\252\271\231\325\351\247D\205\206\205D\t?\241\217\350\005B\017\315\242\321h\264\255T\b/\341\247\316\002\317 \222\372\001\017\341\247\022E\025x\251\367jC\340\013|\026\242'\360[\204\004<\200\037\360HBLQ/ \300G=\326#C\036\340\261\376\240\336\351\001\374U\242e\333\331\323C}\2479:\376\323#\237\203\307o\020\330\364No PN\3237\232\006\321%L!?\355{uX\246\367Zz\3433}/\333\224~IP'\275\322\3376i\216\220>\351{\020\351SB\3057\026\277G\2309{\332\367\372V\342\253O\241\215m\366S\331'\376?Jst\346Q^\237\375^\036\232\r\366\372\377\247\346v_\375\276\177\342.\232\247}o\214\232\376\327\367\337\362\360?\375&\264<4\373\027\273\273\323J_"
+	.ascii	"\017\254\ry\336@\356?\251\025>\334}\236\212\036n@oji\241\340"
+	.ascii	"\341\376\353;:xvv\230\331\022m\230Exv-\224\b)\016A1\f\311\030"
+	.ascii	"\336\243\223d\311\031i\030\217\033\311\036\227eh\215\325\310"
+	.ascii	"a\203\214,l,\306\2161\034[a2\2224\304\302\310r\330\330\312a#"
+	.ascii	"\211cK\206\330\330\226V\002\326\261#Ll\213L\207\016\261-\243"
+	.ascii	"\263\355\264\3758\356g\027\005\r\233G\013\277\344[\272\360+ "
+	.ascii	"$P>\357V\252\375\354\021K#K\276\347z,\306z\3773n7\315`\351\223"
+	.ascii	"\023\262\275\t\253\265\264\336\202z|\2714\260-J\323\351\343\032"
+	.ascii	"\350\271\372\006`\234M)\246\241skJ2\031\004\231\023\256\276\241"
+	.ascii	"\254g\247\204L\223\325\373\240\336\037\203\267R\3369\022\245"
+	.ascii	"\230\005\202\3121~DI\306\300\234\033\t0\307\340\252\317O\247"
+	.ascii	"\025b9dz9v%d{\022Vge\375\205\357%\213g\351\345\324\002u\321="
+	.ascii	"\245\217\323\240.\370\377\2427\350D\224]4tP\373.\370VsK\360\007"
+	.ascii	"^\301wZ\227;*\202O\360\235V\207|\004/\300\217\203\247ux\020E"
+	.ascii	"\b\332\201\357\347\027\241[\244$!\277\352;O/\017\325W\261\007"
+	.ascii	"7K\032\317\364\3301\230\227}X\352\313\263\250m\321\274\242\336"
+	.ascii	"\206HE\220P\273\210\t\265/\325cQi($|\330 \275\034\373P\221\217"
+	.ascii	"\303I#==\214\242\035\251h\2779f\026\335\310E\267\021|\321\214"
+	.ascii	"`\364\r\200\324\250A4\343\234S\306HDD\222\024\244\220\016\240"
+	.ascii	"\002\221\031\253\316\001\021`\255S\016N\232,c\236P\202\370\337"
+	.ascii	"\024}\236\366n\223\361j\221)\252\004\2046\2439\b\261M`0r"
+	.string	"\353{\223\316`\031Uo\036\205\334v\020\314)\341'\b\240\355zplB\001m;e\240\205\017\177\246\t(\025\032-`Z\036\361Px+\363\277\363\213\336\177S\356\363\376\372v\375|j\246\213\225\255w\211I\020\230-\252\336:\\^\213?[\240\001\356V\367H\242\034Il\227\366\314\204$Q\350\226G\372\002@\277\267\207N\274`\350H\214\367W\336\220\306F\3470\224\316\013\242>2I1\317U{\217\035\f\373\325=\0075\203\t\364\361\253W\244ZY\310\260\333\022\233\003K\n\034N\342\201\005X\323\266h-m\226b\256\216\360<B\\\020\336\250y\340\242n\2072+\024\226\\\225:\247\254\323Y\250%?\242|x2\tJ+\371\252(\362_\245\232\007\017r\375\276!\231|\352L\215\344c\034t\241\226\003\266\334@u\312\036('\210\021S\205g\354\316\350\310b\366\216j\2707\213\034AB4'\324"
+	.string	"\300H\371m^N\245\330\023\204$\305baf\303\024\344S+2\264dp\261\217\225\334:\315/\\&\275\241\246m@W5\230\341x\344\213\360\211\017\227\005<{\372\003\212\316\325\334\241\240\367\361T\242\237\366\216\n\340\n\377u\210/\230\373Z\340\016A\261\264\337"
+	.ascii	"\020\256[rwg\225\242\340\211\026\200\264\241\002"
+	.text
+	.section	.gnu.lto_settingApply.34.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\315\006\025&"
+	.string	"\372AH\016I\220\332M:\205h\365nH\322jNE\332\257@P\353\234?\247\223\213^\033fR)\f\013\317\005G\333\206?\023\006<\013|\213\311]M\320\306\353\344)\214\017O\207\317\364;.D\330\260p\306nM\032!d\023\"w\222\001\320"
+	.string	"\301"
+	.string	"\322"
+	.ascii	"@\244\t\346\364e=\221Sf\366:\361+%D\201`K\214\367\016\017\274"
+	.ascii	"\344\007g\035\242\350\301\271?b\260\301+\363\215\234\013\352"
+	.ascii	"])\236soV\225\262{\207\tx\301\371\222\207\337\261/\317\353\330"
+	.ascii	"\227\f\305\214\366\341\3265w(\001~\245\271\367\352z\307\241\236"
+	.ascii	"\303\335R\033z\232\266$\273B\361\253\2133\275\347p\246\021\361"
+	.ascii	"\004\260\252\256~k\026\351\330\205\202B\260\252h\334FC\306\261"
+	.ascii	"\2043\032%p\232FXU1nf\021Z\221@a\300j{\264\004\251`\274<\331"
+	.ascii	"\211z_\276.bT0NJ\331\250~v\247\307\023\037*\272\311\237,\033"
+	.ascii	"j\236EX\203\004\242R\004\236\370:E\345\253\3254\272\367r\rRU"
+	.ascii	"\235o\316|\313\314\022\230\355Sk\230\213\037`\337B\315\025h\345"
+	.ascii	"\253GfFz\223\335y\357\217\001\277,C\322\371#\205}\371\3562gE"
+	.ascii	"\272\242\352\221ou\247\231\225B\324\007y:@\213\032\305_\367\230"
+	.ascii	"\207\276\332Z\314\357\343\361\210\206;\213\331V\026\262\225\203"
+	.ascii	"l\345\037"
+	.string	"[\331\347\303\277\347^g\236w\375;f\345\034[\031\307\254|\203V\316\241\225qh\345\033Z9=+\333le\024\255|\242\225M\264\262=+\227\2662i+\267Y\271\332\312\037\272\221\202\305A\332\275-\216ln\261t\002\344I~/\262\026c\365\3651\346\224M\\\214M\242\032\221{o\372#\3740>\222\203A=\311\323\331\023\236b`f\306{\313\"\234/\003\017\263C\260\305\030\016F\303\313\241-\262\245\\\031\257\270\272\036\225vi\230\255\305EH\312\377\310\026\351 \353\217\354\311N\226\035\201L\232\374\221\365\351)\346\235\355\346\021\301|\013\205\035\037E_\340\2722%C\247\326\346\351\213=l\003\200\255 3\207\016\365A\006\222\352\036\373t\355\207]\310\205\030_\027\260\265[9\033\365j\033\"\026\312-\214\262\265\370VX\354\3256\034\305F\017/$_\341\027\031\r\202\025i\245\006\247\234\312\253\324\376"
+	.string	"k\266\"\310\311\370Q\370\336\336\257\230\017\345\334\272B4\256\301\353\233\nro\\\003/\177\372d/\201\224\2511\376\352\032\233?\177\262a'\312q\226F-\252\036\253\n+wH\267\226\223\013\365\211?\263\020\277\374j\036xL&H\236\023\211FrB\362@&=\211@*Q\362NA\023\210%%'\247\244\246\016$\232F\350\222vH\037xINKJ\272%%\244\021\272\035\257I\247`\210\231H$\361tNLL<]:\214:y;\213+\230\025\243\332G\346tjN\3674O\343tN\237\f\270&`B\205\372 \016z\326\346\206\032\343\257{kp\034\211\270\364^^\244\303\366.\377\030z.\017\352)\346'\362^,\bF\257\233"
+	.string	"^x:\250o\324\324\270n\306/)\231/63e\314\306\370c\306\320\034\256o\235\353\003\255pi\337\272\212\001\312\260\365\317\236v?A\333\226\266K\200F\204v\232#\255\310yv\220\214\331\266\317>\360\205/\311\315\336\341aU\366_\300\332\356/)6d\227}\340Z\224\205\200\220\250\221@\307\020RT\243 \005\005)I\032\003\220\002\231\241\"z\021P\2754G\2224\311\260\337\001C\225\324\253\031M\363k\204\004\274\006u\322\324\025I0\016\235\347\246\311.=\021\210\n\300\206;\352F\216\306\332\215T\310\026\030\241\241\320\264!lh\313\031t\f\023\032\022`\244\022"
+	.ascii	"~L\331\227HS\212\272\030q\3328\027e5>XQ)\313\274\335\"\203E\340"
+	.ascii	"3\241\237\0065\006\245\231>\352\3618\223\037\265h \2361\212B"
+	.ascii	"\262\211\036*A\244\035\t'\313\3177\215\207\215\0043.Xq\250\356"
+	.ascii	"I\215)\204\265\234\211\214\003W\336\225x\334q:\303\211dTl\361"
+	.ascii	"U\354@\030\026\310\030\357\212#\363p~\360^\355\263\r\"\341D\332"
+	.ascii	"T: \200b\271*\217\374\305!\335\\2\243\006m@\336W\371\024\302"
+	.ascii	"\256>T\317$\241\335U4\243\367oX\317\007\331\374\371E\362\306"
+	.ascii	"c(f\352\231\030, \367\003\374\007\375#F\027\230H\340\266\272"
+	.ascii	"L\303\340\316p\351@\374\"\340)\300\246\246\261\tS\265\376\222"
+	.ascii	"\b\240\236\231Ad\334\245\006"
+	.text
+	.section	.gnu.lto_settingsWriteRuns.35.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`>\007\365+"
+	.string	"ZO`\021F`\034R:=a\274\004#<#@zY\375\265\224:\005\253Pz\330\222\007,^\206.\357hy\372$\242QG\251X\321\007\"\300\351J\f\337\021\262\375\277;I\007\356`x\213\323\323\276}\265=i\204\020\271\223\f\004\001\362"
+	.ascii	"\b\001}\231\035@0\336\013\215\001\2773'\346\306\262\314\006,"
+	.ascii	"a}\312\277\314\337r.\3063k|\310\262K\3064YV\331\200\037\254O"
+	.ascii	"\317\n\237\345bF\346'\312\374Z\356\252\362T\201\311\303\262,"
+	.ascii	"\022\321\005\250O\321\003P\237\266W\260m\333\366(\363\034da\033"
+	.ascii	"?\024\002\005\201\277\037_\217\267\356\324\024\355k\344\037?"
+	.ascii	"\214S2\271\331\215+\244\302\372:P\023\266\252\033\374\022\254"
+	.ascii	"#\007\026mai\375\207*\230[\303\3638\245\026*\340\352I\362`J#"
+	.ascii	"\367\207\203\034\037\230\262H\234\222\310\355\r\001S\022\271"
+	.ascii	"\274\247\2626\271\314\372\212V\320z\363\3618\245\020\364k\224"
+	.ascii	"\314\271\333\213\300\224A\356\216\355\031\230\350\240\333\302"
+	.ascii	":r\3656\230<M\307\332\2617g\313\254\243h\00546M\200K*\364S\212"
+	.ascii	"\264\275\371k\265D\336\276\331Q*\\\340\304\352\266\260\276~w"
+	.ascii	"\026X\226\345\233\\b\235\001\234\371-\230\231\310\254&\005k\357"
+	.ascii	"\302\264&\231Y\020\357\223\3577\277\332i\233us\310>J@2&\253\273"
+	.ascii	"\213\231y\274\n\302\260\320qs1\237\354W`\224\340^\376\002\177"
+	.ascii	"\236\213^\346Lt\264\363\320\325\316BA}\031h(|"
+	.string	"\3319\330\227\201}\371\327\227\177\372\262\257/\367\356<\363z\227\327{Y\355]N\3732\332\227\233w\371\366\345\037\031\200\323*\342U\327o\230\354U\313\207\205K\235P\376\374\313\374\316\037\355W\373\313\2562\223\341\267\335\255\214\323Y*%\357JN\210\212\3659\265\262QvirC\222\326\370lN(+9\035s,\313<\3613\276\2307\331\3671O3^\255\270\262\315\225G\216\034s#\326\247\302\2136Etd\262W(\312\232byX\226\t\202\331\3107c\037\277\214\237\353Q\271\222y\351\231cYv\301S\336\260\242_\016\306x\262\030\\m\223\002s\r\\\255\231\236\266\353\2477lFy\303\016\nJ\273\022$h\313j\207\3574T\265{\311X\034\0027mc\026\243\226\373\244\332?\203\004G\037\231\350\336\314\005\f\367\311\264\3255$\310>\276\315\216\230==\264\373\255\250\321N\237U}l\334\326Lw"
+	.string	"g\025\241K\324\314\0328\334'\213\332"
+	.ascii	"V\030_\216\023\0028,\213\344\026\217\323\001\302\027\313\"'\300"
+	.ascii	"\271\234\007\364N\236\362\007\020 \324\247Dh\0373\265\344\217"
+	.ascii	"6F\222`<t7l^[1\363:\300\216L\230+?\2676:kw\361\260o\177\213\337"
+	.ascii	"\346n\212\350\235p\b\021\352\223\"\324\247\267\357v\003S\310"
+	.ascii	"\352\2024\335\2355Iv\001H\230\270O\016\365\2203\013n\230\244"
+	.ascii	"t\237\024\352\233d\251\214\200\203}S\273\353F?\236\204\245\335"
+	.ascii	"\266\207R\371h\214M\240\200p\234\360c\250Ow=Z+vl\334\366D\304"
+	.ascii	"`A\273\213\357\371\251\276\243\306\320 \257\036\006\336\007L"
+	.ascii	"S.\224`\244L3\210E\224x\251b\024qE*\3254\345\264\224\256!T(\245"
+	.ascii	"\350\311p\361\364\244\224.E\025\233\227\216\212,\232\210R"
+	.string	"RL\305\244\247\342\013$\246%\245\025QLRMD\244&\242\322\013\244\245\250\"\322Q\001vzb\212B\222rr\212B\3621\3317\027\323e\365\021\n;T\265Uj\351\321\201\200\372\366\215!P\260U\264O\356\202\013\027\034\330\227\312X\032\344\325s\006\354\233}\235k\231\023\270\230Y\023v\027\377\300\244\026\034Ps\361/\016\220\247e\231\246\n\365\260\255\356v^X\326\026`\202fT\025v\260\255~\335\353\0136\366\366\323\276\376\365\207\372\247/\324\276N\335\f\273\327\250\233\243,\313\262A(u\330F}\266\247oeo\030<\330\t\272\304\231\032*\255\033\267e\243\213\266\021\212Q\n\320\371\204\303\321\307\353\005\344\003w\r3V\271Or\210\265\0178\327\340\220}<\020\345\326\327\257\273\352\274\300\375\n\200\210\250A4\244\020T\306\224\224\310H\222$\351`\002\0211\267\033\021p\275EFR\220\264o\304$"
+	.ascii	"8\325\f\b\025$t\366z\346\003\335\247C\252Np\326\331H\220\252"
+	.ascii	"\023c\243\344\235\314\025\355\340\024Q^\263x\364l\234\3601\260"
+	.ascii	"S\252Y:=\256\220\"\2737\305r\025#-\206\201d\213O\250\244\030"
+	.ascii	"\211\252\3252\246#\353\351\251\365\264\032\025 z\301P\017\346"
+	.ascii	"\320\231\317\342\3638\200\217\333\032\256\2105\306(\017\211\255"
+	.ascii	"\2441\233\305#\300\263#\002\021j\246_\236\361\200\263\231\221"
+	.ascii	"\336LO\300\240\300\332\243 \340\263\356^\223F\375\017\341\337"
+	.ascii	"\231'\366$s\r\210U\022\204\017\357\224\214!\033\241\252_\200"
+	.ascii	"'\001\3101\222gV\241nWWG\372\002\rQ\203qT\321+\373\257G\200\334"
+	.ascii	"\336  \225s\022\230\2350\037^\207RS\001\217!&\211Yl/\364a/\225"
+	.ascii	"T\306\214\203\334\230w\024\3472\233\373\224\232]??\036;\f\312"
+	.ascii	"\250\376\376\260\"\377/\361\016\331\371\301N\342j 4\320\213\202"
+	.ascii	"u\341\017"
+	.text
+	.section	.gnu.lto_mspSettingsWrite.36.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\321\003\025\034"
+	.string	"6\264\271J\240\230Q:\300{FGE\371\035\251^\r(<|r\t\376\202Kt\277\362\367e\036\037%\205\rNx\275\177p;\205\223\355\256\240\t>\375]\322\325\030k\034xI\003\036e\366\330#\246\301A1\030\374m\203\020B\266\334I\006\246"
+	.string	"\236"
+	.string	"\240"
+	.string	"\374\340<\311\303\223\231\371H.\245\343\235\035\366\b\232>\216\370\230t\335{i\263\347\224'\355\003\224'\233\307w\207\275hN\263$m\327\035\037=\354\305[#P\216Rd\234\220\232\376*\340\204\304t\032\253\3408e\314\267\200L6GF\324\357B\200K\365\264\\xZLK\003\026\201|\013\250d\001p\021\231\342\253\345\213\232N\222=,T]\210\301\244[\213\300w&\252&\b\303\356t\241Y\260`\257\266%\360t\203LM\220ggU\214\276\027_\217\202\275ZM\013\367^\256\277 \3229vf\256bf\020\314\375#\302\243\215$JE5e\036\242\265\205\314\3574MS\356'f\263\362NYYVV\326\371\360\317y\325\031\347\304\263\315\247\376\030W6\315\312\345Y\2314+[\263r\227\225?\340M\307\2560\034\262\334+#5s\215d\026\220W\375V?\361\315\254\3433\371\223\027\031\346"
+	.ascii	"\202\356\304\025\347\rb\022\275,9\336;\354p6\271\023\335\255"
+	.ascii	"X\314\212\206\0278\341\312\n\013\303y\022@}U\213Yox\203\024\256"
+	.ascii	"\216R='Y\3029\005&B\255\314W\362%\272\017]\374\346\336\247(X"
+	.ascii	"\367\016\031\004\\NY-;\247\231;x\250\377\361\354E\243Lv\331\367"
+	.ascii	"\235\271\325\311\226\355\200J\300\204n1m\233\240\262\322"
+	.string	"\253eX@\375\325\237\204\370\365\374W\247\362#\342\204\342\273\030A\242\376g;\246\225d\204\321(\337\224\250\325\377l\232'+5\366\032e\340\2300\304\262\205\357$\035\300%\262r\031\305(b{\336]wP]\251\251\261f\266\001\325\377\272\277\204\243\327\350_&G\352\244yJ\235~\361\347\026\325\227^-\303?O\371\326i\256>%\336\241<J\020\037\212Q\b\325\377N\362\205\312\223\357\2508\240Z\212\037\362\303\211\232\211\327\351s\303u\016w\242\331\247\001\016h((\227\263\341J\250\300\t\321l>\265\237\233-7\024D\033\n\252\t\321|n8Z\203\003L\244\302v\243\345\210\210n4\330\360\336\336~b\323\b\213O\312\353\337\225/~\203Q\022\237\024r\367]i\366\0213\233\315\026\212\232\307,\354\275N\025n\365\037\247jj\357\275\027\266\363\342_ZH\214\235\246oQ\342\364N\227\027\201\312|!C"
+	.ascii	"\"F^\243<\2402k\340\020\323\032b\344\031\240q$\244i!\326e7SE"
+	.ascii	"P1ZV\2246-[\200\323<3j\360\027+\\\001D\250\221 \203\214s\312"
+	.ascii	"\310\0042B\024\024h\251\003\220\"\231;\363\020`\251\266\205\341"
+	.ascii	"C\006\3654\177\217V\356\224\244\210N\034\"1\240Z{@i\026\371\207"
+	.ascii	"\273\213#\004?\t7\216i\313\247\033\222U`P~|]\241k\360\311\202"
+	.ascii	"\026\t:\023\2061%1\314\311\243\005\250b\232-\302\205\242\320"
+	.ascii	"\310r\020\307\003\202kPK\317\220NLcJ\226\306\300\261x\305\205"
+	.ascii	"G\200\206k\265\332K\266\306\354\302\210\210D\200\363<\324\373"
+	.ascii	"\251`X\257EX\316:\372KtQ:\243\241\250\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`'\004\275\024"
+	.string	"\266\342\200J\320\3606\035\362M\273\200\352@\322z\245\233\304e\007\221\033\003\373\252x\300\3328ic\375\021`\224l.\201N\203\005Wx\301\031d\224z\030\245\034\r:\230\016\355\203\004\355\303\366\303v\334\376x\223\306\235x\262\333O\021JM\356s"
+	.string	"k"
+	.string	"h"
+	.string	"/3\235\"\32361M\002\3230/-\343\3223-M\303$I\326\032ci\027\2569+\357Th\335-\245g\036\004\031>(\035\302\225$\021"
+	.string	"\035G\024N:\306\245p z2i\031\007U\322#8H\032\204\233\231t\262\225\356\265\262I\216\260t\001l\354X\022iXHHK\367\024k\021\217,Kr\250\326\256\325D\017\377v\273\321\200\365\213\253\265v\262\340\277\224\217\242F\211\034+\360\2379\202\367\230\370\351\004\236\r\025<\237,\360l2M\207T\372"
+	.string	"?\343\032\013G\017F\360b*\246.\332\230\243.\334D\324\324U\351\0071\365\357dNg\211\354 \246>\002\365\245\316\350\200\357|\022\370\216\243\372\356\235\374\242\024:>\036?\202\2569\320\265\233\216\261i\224Z\253\324\364\t\255Kh:\tX\3673\246\375$\005}\334+8\371\206\250ih\264\217\241)\314|\235-{\027\352*\253=+u\331\263N\256\tE\315x\331\213\246\003\017\373\317e\377\231+{\317;_\366^y{N[\3668\314\355\354\360|\330\317F{\025\3125\020I'F\3607\345\033E\3352\024"
+	.string	"\177C\244\300\337\223\371\247\307&\264\002oK\016\325\242\\\233\224\234^\264\302[\023$\224I`\200\001\026\376+\2716)9\271"
+	.string	"\303{)\227"
+	.string	"\345\244\255\360\314\004\206\334s\343\211\004+<\233EcX!\302\202\361\336h@j0^^\301\"\306\r\003\367*\323u/\340dn2=\264\020\357?\033\337\bF\020\322w\357\241\343\275g\343\253"
+	.ascii	"\032\001U\357\031u\335\363\271\272g\263u\037K\250A\f\305\223"
+	.ascii	"\330\314\004\023\210\210,v\340\0021\032\267\001\021\320DJ\314"
+	.ascii	"D\0223\341\210<\025\204\262z\371\337\327`w\025\256'\325\241\b"
+	.ascii	"n\237\021z2\373NX\323\024\260\024\262\310\025b\251|\023\"\\g"
+	.ascii	"B\312*l\3270\354V/Q5\f\205\366\025\321\f:q\341g0\031\216\350"
+	.ascii	"T\311U\256\344*W2\2653\272\247z\350\214\215\025\212\326\264\303"
+	.ascii	"\300-o\370\177\324hU\277\020\2119\312\271Vw\2726:^\026\326t-"
+	.ascii	"\211\300\241\323+\253\002"
+	.text
+	.section	.gnu.lto_.refs.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375 \205\315\002"
+	.string	"\262\007\024\031`O\322\0300\f\3030\f\234n\342\033O\344Rc\215\322\257D\222\266I\n\037\302\3019I7va\003V\002\324\262+\373\261\031\225\330\207mX]\3324\233\325\224\006\252\004\035IC\320\351\330\213\255\330\b\3646\203\316\2032\315JM\251\247~\t\001"
+	.ascii	"\323\335T\024"
+	.text
+	.section	.gnu.lto_.decls.6931885361fcafc1,"e",@progbits
+	.string	"(\265/\375`\204)M\265"
+	.ascii	"\212\026\005>Y0\212\301\244\016\373;H\243\035\335\377\310\310"
+	.ascii	"\354\325\007([\373\331]\263\350?h\376\033\342\366\373\331 \354"
+	.ascii	",C\264\030\363\3665\302\271o\001\377%\200\214\314\214\001b\t"
+	.ascii	"\030Wg7L\220\312\374\032qa\034k\230[@\266\027rxum\371\251\201"
+	.ascii	"\330@\367\307o6\2222\245\024X\003\303\003\350\003\375@\335-."
+	.ascii	"k{L\315\350\332\017\207\374\274\2454u\243\345\210\025\031Z<\366"
+	.ascii	"+\356\327\376\347}\331\3778`\346\374\343\1773}9\377\314\270\177"
+	.ascii	"p\377\200g\210\312aD\305\375\320\265?m\355O\262\372\264\355\360"
+	.ascii	"\022\343nj\211\310*\346J\310\202\352\242K\374\311m\313V08\272"
+	.ascii	")\276\347T<\317\237\256\327z\016\347\321\240\271h\316Y\317\361"
+	.ascii	"\\z\333&\260\210\224]4\347\266\246\246CM\215\357\2002\235.9\306"
+	.ascii	"\317\207\237\025 w0\316\244\253/\2525\212?]\212\307a\227\342"
+	.ascii	"P\334\356\nY\256dD\230Dsv\322\324\314h\251q\275\300\330\353Z"
+	.ascii	"\237A\252\024}\334\257\264\272\234\317\371\323\351\032w1\333"
+	.ascii	"\230\373\343b\215\f\204:\343 \324\376\241\265]\272\266\327\255"
+	.ascii	"o43.~\250\270\302d\355\r\230\204y\353"
+	.string	"Po\3635\231\037\r9\031$\326\3149\351\304\335\374\351Pgk7\342`\375m\316\316\032\032\227\037gZE*nG[\333\207\254\336\304\323\374\331\301\325\3326\347<#\303\367\206\264\267\265n g\357\240\372\337\237wP\333\265\326\366\346\232\204\006\3631\227\360=ngZ{\203n\021\335\032t\340gN\346Hn\333\314@p:\0220\243O\310\3074gg\373\323\317|\314\333\234\271r\31654\300eT\0254\214\275\314\217\370\223\0027k\r:\350\213\354j\271`\220\220l0\037w\316\332N\201\352\177N\201\332\026X{\204\265?X[\001\253\007\347\240b/\347\240\372\020w\372\363\002/\322\036\304\333f\371is\233s;\263\302E\237\330\036\367\006+\004]\271\203V\327\366\013\324\373\367\347\027\250r\316A\325\340\034\324\237:\207\037\335\276\345\\\024\\\245\0213{\345\334n\230i]\034\321x\334\255sPW\177"
+	.string	"\3575\350\366\274n\027\221\374\fl^t\267\207\356\273A\267\213=\002\272}\003\177\200n\317y\f\272k\272\357\013\f\177\0238\004\021|M\001\272\037L\312\203\350n\351_\360\037<\305{@\373\n*\260\327\n\350\276\025\334\274"
+	.string	"$\350\366\n\272]\347)\350n\273)\335\017\355n'z\335/\301\333\007\240\333\217|\207n\227{\232n\307\300G\320\355l\017\001\223\347\320\355^\017\200\356\177\240\273\347\272\233\306EC\233\320}%\370\236z`\267\267\034_}\226\356\366\273\340q\005\335\257\304\245\306/@\307_\267\277\264\003\235Bw\033\240\333\375Z\202\356\327\353\356\263\356\246\322\35521\276\327x\335\035\323\375B\272]\257\333\245\335~\327\355s\335\376\244\333\333\272\275I\267'\351\366\261n\377\352v\"\335\236\325\3557\272\335\252\333\251\272\375\251\333\233\272\235\251\333\221\272\375\250\333\203\272\035\206n\177\241\3333\320\355l\267\027\273\275\205nG\321\355\302n\277@\267\257\335N\201n\007\241\333W\350v\025\272\235CwO\273]C\267\233\320\355)t\373\004\272\273\256\273\325\272{\202\3566\353\366\bt\273\005\335>B\267\227\350\366\020\272\275"
+	.string	"\335N\200n\357n\037@\267\177\350v\017\335\376@\267;\320\355\033\272\233\253\273\033\320\335i\335\355\362\367\367\367\327\255\322\350fy\241["
+	.ascii	"+\004JVZ\210\271\271=\034^\006x"
+	.string	"O\372\341\336\214\205\351EW\335\343\177{6\031i\021\2217\245\227\250\265'k>\326~&\337\244?\255\323\036\332\262\224\221R\017Y\231n\3114/-At\177[?T\352\002DKL\351\331T5\0313\260\330~MJ\225*sK\257,S6\007\266\344\361\363\325\2723KT\224G\320\343fQ\272\232\177\2269g\026,m^\002\301\250\316\342\016\242;\306o\343|\273;\300\320f$\031W\336\232E\366\323\36487\0134\347$\024\362\003\250\244$\324\013\245\023*#\2238\220\033\226\031\n\251t\346\274!'\223H\0070\363\006\2453'\345 \267$\317-\0242'\231yCN\346\037\017\312$T\222\322\371\223\264A\351\204J\312N\250\254!'\177\226C\311\274\334\220\235Px\331\311L\322\240t2\223\224N(&'SB)K\032\343\212rr,e2\2578r\372Yj\200*[f\226\313\331\275T\344\345"
+	.string	"rvb.\345~^x\031\020t\005P\330\017\323\333#\240(fNB\225;\2309\357"
+	.ascii	"B\221\2178@\266\320\\\303\241H\032N\331HE\316\0018\312\031\351"
+	.ascii	"\031\232sF\346\234\201K\2476g\030\032\224\315\243\243\234\227"
+	.ascii	"h\216\262\023\362\210\212\234\337\213\256,I\351\214b\2128\362"
+	.ascii	"t6\263P\213\364f\226\203Z\256N\244\220l4em&\305 U\331\254\324"
+	.ascii	"\326\376\245,\306\227\322c\226\253\250\277\275\007\361g-\311"
+	.ascii	"6;[\342\246<y5Y\337\354\377\310#\3517\3732\230d\373f\330?\310"
+	.ascii	"\270\177`A\273\372\031rF6v\225\325\005\364X\314W\270!\271\"\006"
+	.ascii	"\366F\374\371a\357\365\365\243\031\366U/\005,\322\276q\321\324"
+	.ascii	"\324`\240!sj*nl\2656\216*\362\004\276\2219\351z\374l\"0\314e"
+	.ascii	"\216\300\205\310\221f\225\3072hn\220\nd\020\347\220\372\"\310"
+	.ascii	"\n\330\017\371.5<g\336c!m2\347L\003,b\002\363z\334\330\305\332"
+	.ascii	"\316U\365SuL5^\212\213\216G\333S\345x-\207.i\310\311\261\273"
+	.ascii	"(\327\326[\275\224\frC\3164\346\232?\276\375 \317\3653<\020\177"
+	.ascii	"\376\326\337\350\277z\034\355\326\333\370!\207V}\300%W\363\022"
+	.ascii	"\247\227\003*\203\253:\312\004@J\022\200D\321\372\346\363p\350"
+	.ascii	"R\233Y\274\210A\335\224\2469\267=\336\207?_\313\253C\214\225"
+	.ascii	"\271)\020\225\207\f0eDMB\217\177\207;\323\212hP\321\341\317\317"
+	.ascii	"j)0y\202\031!\035Wp<~\254\2162\204$*z\334z\215\326\335-\270\305"
+	.ascii	"\221\255\265)k\337(\353\203\200\256}\323\326\276H\326\276ck_"
+	.ascii	"#\253\207\251\227bq6\311c\223\222\376\333\232\021\020\215\013"
+	.ascii	"\326$\0220\256(\020U\342\200z<n]\350\252l\354\315`\276\264HJ"
+	.ascii	"\322\364XF\033v\345\017KOku\372'\177~\214_\352gz\030M\323\346"
+	.ascii	"\034\226s\216\361-\376\005\t\025\313\226\025RC1\276\211\250\246"
+	.ascii	"\245\305\323\330\275\261z\276L/\336\205L\\\264O\354q\373\262"
+	.ascii	"\244\024\003\302B\t\311%\372\221G\026\203\353\3413,\272\346\343"
+	.ascii	"\356g\221\024\343,\322s\362x\351\225d)\303\353\262z\334Whm\377"
+	.ascii	"\372#\017\363*dA|Q\256?r>Gb\004\256J\364\213\336\350\221~\305"
+	.ascii	"\023\371\363\217\376\347\223\037\364*\224I\027\342]\356\245\002"
+	.ascii	"\256\317\201\374\321\013\375\320u6W!\"W\216\334\312#\257\263"
+	.ascii	"\331B$5\245\251\251\251Y\231nMq0\370\225o\343\312\327\020\277"
+	.ascii	"\265\177ou\245sP7\004\\\\Nf\330\333{(\tH\027\244\246K\215\274"
+	.ascii	"\274\2537\215\302\234)y<\351\261\270\355\300a\344\t\017\357J"
+	.ascii	"\361d\266\274\266\204\244o\206\225\025e\304\242\256\356\336-"
+	.ascii	"i\336\2744\271!)}\357\332\210\2142\033\217o\224"
+	.ascii	"K$6'6\303\343k\327w/z~\314\251K2.\356\316\205\255\271\251ON\256"
+	.ascii	"\357\\\213\337\324\215\357\361\205\342ANVv\217\246\262!\365\361"
+	.ascii	"\3559qr\237\364M\346\030F\232.\205\3621\364\326\367\211\r6)\026"
+	.ascii	"\217\257\333%\302AY}L\227FQ\261#\253SS\273m`/4\300\234T\330\372"
+	.ascii	"\266\341\250\"\006}|\327.Q\013\217\271'\214\037\n\222\2654\305"
+	.ascii	"\266d\311m\262cmF\215*\307\222I\337&?\024\323\244\3416fvvv\223"
+	.ascii	"\350P\213&\3655\201]\264\276Ib\230;\242*RVv\315h\326\314\265"
+	.ascii	"\203.\332\262\366$\354\307\221\276f\300\256<9d\0200\260;fg\027"
+	.ascii	"e\341\301C\007\233X\3371)\337\027m\323\036\337\260K\324EX\\\331"
+	.ascii	"e\025\351.r\277|\371\306\345S@p\\y\365\375b\316\020\232\2660"
+	.ascii	"e\350\253%\303%r\337`\200`>\254t\310\024\335AI\001\351K\244\257"
+	.ascii	"S\203\016:\nq\352\371||\207\364\355\2521\345\251\024r\273\260"
+	.ascii	"\354\302\374\036w\013r\275-\002\236\370f\364\005q\251r\273\222"
+	.ascii	"\341\361\337\037\035\345\217\314dxz|\271\372.&LH\225\323\326"
+	.ascii	"e\213z\003z|{\\\037\376\354\264;\203\272\\j\263\227\214\231\320"
+	.ascii	"W\032\337\3320x\247\251\227G\213Y\f)\250\307\r4\022\327\324\234"
+	.ascii	"\202\003\307\315\242a\"\245\034\264\265nJ\252\021-\350\224\034"
+	.ascii	"}\263\256\016\031NOU:\260\206jH\243B\272}*Kz i\376\r\031\275"
+	.ascii	"\"u2\334\213/H\213-\273\0337\256\225kh\201\336\214\232A\310\342"
+	.ascii	"\230Fjt\327\270Vj\016'Qg\323\234\227@\274\324%\031j{|\255^\346"
+	.ascii	"\222z\374x\334\353\322\3322\372J\311\270Tx\352\203l\224\221]"
+	.ascii	"\031\311\257\222\240\226\246Y\271\004\002F\310\235V\333T_\252"
+	.ascii	"&\251\244\344\215\352K\003\b\232\212\267\276\365\316\350\013"
+	.ascii	"\325\335\342S+\240n{L\274\033.\254\244k\003\351\236\374y\237"
+	.ascii	"\036\215\204\374\223\004BI\366\3231\315\313%\030\\+M\246\316"
+	.ascii	"|\254\335\267\351y\233\\\352]\031\311E\b\312'\235\346\274\004"
+	.ascii	"\203\031*<\236l\034\335\244\233t\231:x\301\274@eH\320\030\372"
+	.ascii	"2\335\245\t\024\201\ny|_\310\210\005\335\001\221\353U\272-\374"
+	.ascii	"y]\304\274H\225y\375<v\001\330h\352e\021EB\242@\031\335\222\036"
+	.ascii	"\230\312P\234\036T\250\205\356\321\332f$\232#\313%\020,O1\370"
+	.ascii	"i\031\365=\352k\241\205\344\361-\272D\352\013\251\350\330"
+	.string	"%J\001\216\256\355\022\335\241&\214)W\304\200.\200\370\224<V\276\327\023\213\033A\312.\362\"o\320\347\234s\023XDh\032\275\311\276A\215&\363\203\305\220\251\307\027\350\307`\302\370\2322\036\337\2377\213a\362t\326:Y\234Lw\310\001\351\353\373?\307\343\240J\353\327\377\207\211\204\\1y\374WT\254\351\364\371\334\202\255f\225~\276\227\232\371R\202A\006E\345\371T^\311\t\236\225EPbDsV\303\300\261zd\035\035\341\341}\236we\244\fU\325\2179M\221\222\024t\253#\362x\212\364\002\217\207U\347\244\204\321\233[Bz\334\352\317\332o\347/\305\356\357\036mE.W\260(\272h^\266\0304\313tm\026\273\265\375\321T:\272\257s\251\005?\276\016\355\322iAs4\201\002\345\345h\2722\322\001\252'\241\3504g'\f\030\3202[f\f\224,q\b\024\352\020\203&x\202\021\230\221"
+	.string	"+|"
+	.string	"\007\226(\344\021\356\210\340\200\006^L\220\200\211\023D\020!'(4\272\004\331\240\003b4\330\200\304\313\b\021*\300\214\020\361BB\005\027#{\002P\210C\ff \007\204\027\035\342Ph\342(dS\204\340"
+	.ascii	"q(\314\361\331\301!\016m\214G\037\033\bvv|\210\304\"\021\310"
+	.ascii	"\336\250)zpx\204<j\016q8\202N\217*d\203&v\212F\226X,\361\301"
+	.ascii	"\006\347D\004\303\023E\343\t9\303\023X\242\320h\364)\301\nu:"
+	.ascii	"4\212\0208\032(\032Q\260E\"\360DP\270\203\205F\237\036l\024j"
+	.ascii	"\240\270Sd\201\215\"\004\004R(\001\005\033V\250c\f\262-\340\024"
+	.ascii	"wJ\b\215\305\022<B\366\230\002\205\231F\021\342F\3103d\211>F"
+	.ascii	"\033\234\023\025\034u\202;#\350\020\207<\306\340\213\360\206"
+	.ascii	"\335\3619\nM\364\034y^4\344\004\205&\212'\210%\240\320s\344\231"
+	.ascii	"9\022}L\b\331\241\221\002)vzz@\200)\236 \003\200\226\fB\260/"
+	.ascii	"(\216A\0226\034ar\206;\301\025\216%<\320\026\b_\030\242\360\322"
+	.ascii	"8C\243\220(\324Y\233\203\021\b\030A\302\005`\223\360 \003\017"
+	.ascii	"2P\233\204\007\""
+	.string	"Dx0B\304\332#D\\\366F\203\rv\212\305\020nX\330F\021\342\204\017\013<A\241\221=\332\020\213<<E\034\001\344\020\205\367xs\302\207\205\243\3126\212\020:=6:=\017\340\020}F`\205\307\027\342\211g\205G\241\221\3458\324\021\232\320\351\201\021\2760<\342\343Qh\314\311\t\002S\364\024q\260\221\355\271,K\364)\226p9\336\2440\262D\021\216*\273\262\302\343\211\023E5G\330\002N\260G=\336d`\270\203\343b\f\242\300\301B\236 \021\013{R\260\230\365\331\t\2560\334\301\321p,\366\260C\026TVx\263\343\200\013\302\034b\t\254\213p\207\205`\n\020\350\361i\241X\334QY\027\202<\327\205\240\t\304\241\t\303\035\234\r\354\315\b\021,q\b$\016y\256\013A\036\342\220Ge\033\205\207.\366\b\2156l\261h\264yaoH\260\304\241\017pG=\336\224@\301\352\020\205\020"
+	.ascii	"a\270\203\003A\212\240\321\030d\321\031\236 "
+	.string	"\026qT\366\206\250\323\303\322\"D\224\360\240B\004\036\260\342\2048\352\020\207,+<\336\364\034yl\2048\301\023F!K\034\332\020\207A\036\033\034\343\321&\004\001\210:=7\353JC\220\032I\351\270z\370\213\251*\n\353\006\265\360X\356\030\313\321\312\260A\211\223\333\3031\026\223c\215\n\350\352o\206\311\330\021\272\033\017G\004\345\"\255\321\260U\r%\310\032w5\356\235\016\025ha\230\252q\225\324\305\214\246\307X\nOi5\215\314=;\212\224,;3 \217q\024\246Q\325\374B\322w\035]NwL\351\240.\021\340\212-+S3\236oE\243\362\023\306\274I\230X\231\202\224\361\3206\031ENp\f9\031dyW\036\343\231\025nB\216\036\377\024=*\270\246'T\236r\300\270fW_\320<\246;\027\203$\217\255l\351\353f\206bH\261\362\342\266\255\320\272\023rq\2334\301\241\004\243\305\375\002"
+	.ascii	"\362N\3541f\201ch\254\324X\351\261\322\375\373S\177<)\242bL\204"
+	.ascii	"\211\360\36233\352F\024\251\361\362\332\331)\321z\214W<\233Y"
+	.ascii	"\213\034\316\307\370\b\033\311\360\351\305@b#<\270\266*l\204"
+	.ascii	"\213\244\260\306\266\036\273\264\n(\311m\350\225\2644\221\304"
+	.ascii	"\222(/\025\fW\027\225\030B\237w\203\374\354\035Q\361h\353\227"
+	.ascii	"\024h\021\376\301?8\351^.W\231n\t\006j\234DK\200\013%\322G\316"
+	.ascii	"hY)\2123[\2731\322\nGk\026\364\370f\261-\203\210\360\361]\277"
+	.ascii	"\022d\204\206\204\242\323+}\375\230\346\210\356\036\337\276g"
+	.ascii	"\233\331\253\241G\366\370Zq\251K\335]\232\231K\203\244\250\202"
+	.ascii	"\331@\007\343\016\031!\022\021\031I\222\244"
+	.string	"\003\222\n\020\206BA *\242\035\022`DI\r2\347\224\310\210\210$\005I\n\303n\027\211\321\3403\017\t\362\373\272"
+	.ascii	"\211$n_\257\362\334\207\303\367S{\375F\314\027\025Vj\272\323"
+	.ascii	"\230\031\357\307\316y^\335\275h\247\2102\007$\254\216\373Y\016"
+	.ascii	"Z\324\373\244CX\245%\205N\\\315\204,\350\325M\251@I\367\311k"
+	.ascii	"\252\210\220\367\250\n\301;\234 /\217\"\026\243\264Sg\271\366"
+	.ascii	"\240\277\\u\003\265C\200\366\202$\263\250\240_\"\273\245\376"
+	.ascii	"\030(B;c`/\r\332h\221~\235\232\267\362?\351W\302\336@\204Ox\314"
+	.ascii	"\f\274\261\202\223\340\235 \242C\345\3312 \034\265\032+\246#"
+	.ascii	"Xw@\357#\265"
+	.string	"\002\305\2038\001\272\265\n\221\342\"W\220\372.\207\334\225\224+w*\266\245\310\030]\323\365\251\242\216y\234$\341\202\332c\352\324M\341\274\313a}\357\360\345\206a\211,=\355\233\327\270\3139N\257*\305\237C\220K0\037\323V\234c\332\321&\350\345q\345\346>B\024\310\0266\346\363\236\026\251W\235\323\352|Q\260\031\222h\254\351\326\343>\016h\222\316\352\b\303 \345\2039%\310L\023\0333>\336\242\205\225\221x\230M\ng\006a6t\224\323\223\306X\030\201:\245o\210M\024\t5>b\343f\364\bp\254i\227[\353\245\354\024\340S\031\262\302+\241\203\241\252\353\274\022\007\232\374W\336\364P\223\322>\030y\242\363\331\300\243I\364\312\006\023\213\264\330\332 \255s\221\242\035@\327AD\206\036\017~\254\212?\\\227\266\265>\216}\342\352\323g\342\016\211J\223\211\321\b\3523N\376\200MR\3119\030"
+	.string	",\227\356\235\226\313\262N\205\235\025O\200\236.\374@\256\377.ar\034\304p\326\242\031\244\215\350\343$\t\303\243\262\255\037mO~\\}M\232L\024w\211\255\fT\022\250\230\3119s\006\211\030\371\370(]=\367m\346j4\315\030\003\3101\263\315\245c\371\3357\265\302|z\3529\315\3545`\226Azd\371\005\237\235\240\274\323\002\344\345\226\247\234\354)L\310o\b\242&LY\213/3\346\266\211\003\274\006\335d\30469\303u\316(L\374\374R\363\200\017"
+	.string	"\315\234"
+	.string	"\260|\270\210\316\263\200\313\212|\036\315\266\310v\277\021\323.\352k}R\241\020\332k\340j\310\366dM&\247\225\352\367I\271\216!C[\302\235W\274\234\275\330\213\364\002E\023Q\312\304\362G\236\260d5l&\002uY\251s\273\217\334\201\ng\005\362\231\352T\377Y\322.\256T\336\226:\252\332\244g\260\225\024\262\371\023\311\024\210R\032.\274\215\256\237\023\252|$\316\216\241\253\024\302\211\326{\302\236Qi(\2514u\025E\346E\231"
+	.string	"\22633+:\262\n\256g\234aw\251\367M6d\003\310\254F\233\002g\220\233\276\237"
+	.string	"G\253\036\272\256\367\270\036)\027\034\3524\220A\217;8\032\277\225+ja\017\214\347#k\201j\021s\355\245\302\036rLIedCIC\211\323\004\001H\232\2020\324"
+	.string	"\017\300\210\311\257\367\212]*\301.\324\242u\232\263h\256\302\352\207\025>\264t\220\271\215\330\223\307\323\005@G\324Z\206\275\032\202\360\020\265\325\"Q^\327y\276UF\275\211\226\3757\372\353\353J\324/\345\030\026.\233\241n\316B4\236?\025f\324\245\363\310%\353\252Q5\302K\026\363\030\304\022\243\255\031\226\360O\\\370\301\222+$\322\206A:\332+h9\251\241s\222\331\231\2057\267\206\372\356\376\354@\033"
+	.string	"R\005X\204\360H:\324hg\3248\022D\207\022\274\2344l\023X\311\311"
+	.ascii	"3QN\373\366\211NC\002\237U\b\310\335s\004-)XA\340\177\033yC\266"
+	.ascii	"\276s\345\344\f\214\274_'9\017^\237^\025D\352\314\223H\250\222"
+	.ascii	"\302\361-\233\n0\203\006T\236d\277\231)\317\246\2544S\374\036"
+	.ascii	"E\330h\353(\326,)_"
+	.string	"\251\313\025\255\342!2Ma>>\370>\236\341Dx\330\2568\376]\210\302F\377\3020\2663\341Yp\300\253\200VN\24210\024\t\222|u\354*\202\202\363T\177\321\005\262}\232#\330Vo\212i\300[\275\232H\230\212\n\t\314\227\033\330dd\241@\200\035\"\2143\215Gix\266J\374\246\227\363\301\256\265\363\177\006\300S\324#Y\327(l\252\320=\365\313 L\332\b\236N\247-\306i\022h\271\302\236rcI\367\nv\236\013,mZ`\354\204\345\316\321\215O!f\300Emm$\013\032\310\245=\265\227\342}\246\325\005\250k\220hV\004\244/\266d\370qY\334\216\351\3144oA\006\343\017\202\207L\326$A\240\202\030,\216(\337,O-\250\213\332Q\215?;e{B\013v_\207\316}\350\276\330\212p\307z\t\360i\t\251D\005\b~\232t\361\237l\002#&& AM\"\215\\\247\212"
+	.ascii	"M^J\215\2671\002\273\250\256\207\b\340;R}\214\224\234\004@\211"
+	.ascii	"\244q+\304w\362\340\317>I\345\0361\2513X\202db\374\275\314\215"
+	.ascii	"\"\020, * \f\241\226\324\301\1777y,\324\2300\037\217\235\253"
+	.ascii	"\352\317\314Z\240\211\037\003;q\212bxD`\344\316\367\024t\233"
+	.ascii	"b\245\212\345\2009\025K\353\355%\372t\204\314\024\026C\263;\375"
+	.ascii	"B\035\346\261\013;sr\216b\245(P\322\242m{sA!\277\327\220\323"
+	.ascii	"\370\207\2433+\347>\304?\215S\336\314\350\355v@\347\262\267\227"
+	.ascii	"\265\355\2359_\351y\311\201\\~\227p~z\232g\325p\327\330\023D"
+	.ascii	"4\b\301u\267<y\364~\t\336\030{\221\303\311\340\004>\217\254\214"
+	.ascii	"\360\017\316S\342Ozl\243R<3\335/"
+	.string	"\210\033\342\207\315sA\313&>\017\276O\330_\335\271\350\035g\322\356X\266\r\356o\373\365\rq\024c\027\346\335\f}\no\\\306\316`\232\033|\326\304\005\233\333\321\001u\2574NY[\321)d\274m\036xlv\363\255\226\376@N\22106\307\213\343\301\352\037\002\371\025\201\017ks\322m\0354#\265\245\322!\216\033\357\317\370(q\273\fv\231\306m\300]F\016a\374\b]\006|\354\363\322\345)3PG\342\236*lZ\351\021\251\303\016\267{\233\022<\317\342?\347\373~\356g\330&\346\213\007\313\376\367\243=x\273m\363\327\373Cz\035^\300G\332\023\324\005\362S\216\\\237\212\230C\037\202\007\362\217\342\277\317\223\007\227\b\030,\234\321\273_\177 Z\352\235T^\n\334\252\355s\264\350{\034\3575;\363\243\200\216\200y\306e/\335\231{\377wW\310e\321\331\216\005p_b\177\f\0070\313\265\256"
+	.ascii	"~z\365\371\007p\337\220\341w\333\330\371\360\354\017\354\203"
+	.ascii	".\n-}\271\371[\001"
+	.text
+	.section	.gnu.lto_.symtab.6931885361fcafc1,"e",@progbits
+	.string	"mspSettingsInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"mspSettingsRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"mspSettingsWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6931885361fcafc1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1517 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\231\b"
+	.string	"\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	","
+	.string	"\233\364\343\336\006"
+	.string	"\001\240\342\234\212\n\002\242\314\237\257\002\003\216\224\376D\004\244\201\252\264\001\005\376\367\260\205\006\006\323\347\261\306\003\007\330\264\373\207\t\b\221\327\373\372\t\t\261\372\215\340\017\n\367\316\327\257\017\013\243\224\377\222\t\f\245\215\243\372\b\r\352\212\372E\020\216\307\310\264\005\021\350\226\246\256\t\022\206\377\251\252\n\023\336\361\204\276\002\024\347\262\214\332\001\026\355\316\316\363\b\027\327\222\361\365\013\030\342\263\312\237\001\031\302\223\266\246\003\032\257\267\254\261\f\033\214\266\217\340\001\034\320\205\256\202\b\035\263\374\313\376\005\036\345\220\314\235\r\037\375\275\346\323\005 \330\201\352\215\017!\367\371\200\256\t\"\206\255\214\227\017#\317\234\246\263\t$\342\335\275\264\003%\363\225\213\300\006&\223\244\353\233\b'\234\260\325\254\r(\302\223\266\246\003)\211\301\261\026*\331\212\224\357\b+\220\207\307\322\003,\337\201\307\017-\240\342\234\212\n.\240\342\234\212\n"
+	.text
+	.section	.gnu.lto_.ipa_sra.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.e16cf0010f871270,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.174.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\357\001E\017"
+	.string	"V\231bH\320\026m:\200\245\322\n+\254\360\224\257\n\2053V \"\021\276`"
+	.string	"z=\275D\013\307=M\200\270\204\314\337\227\202E\250\001~a\344\242\300\252'"
+	.string	"J\220?\2407j\"\266\261\223h\266x0\216D=\302\352\005PK2N"
+	.string	"N"
+	.string	"Q"
+	.string	"}\036\321hM\b}\016\020c\2075+N\237]^\264&\252\317\002X\264>\024{\315Z\323\347\001)&L\n\263\212}~9QaA\224\021\026f\365\372L\3400\242\363\236\004O\366AJ\254g\n\fV\317\341\214a\326\254\317+\264\233\275\004En\344H\236\344K\316\344N\272C\341RY\020lC\006\003\373'@\335\204g\376\247\317\231\022\237>\253\034\021\321g"
+	.string	"DB\364\231\203\034D\237E>\310\017\365\350\314z\017}^9\214(\326\241u\\C\237Y\204T\021f\275\320\347\226\24021/\235\225\252,\311\227F\246r\036\270\310r\245\322V\252\234\035-\345zi1\005\226%\201ti%\213\345\322F;S\023\322\360\276\304M\334\347(\256\342+\336\342.\376s\030\227\361\031\007z\215\333\370\215\343x\216\357\360\316\343=\376\343@.\344C\036{\323"
+	.string	"\025\362\316\330\334\330\360z\035wr \023n^\367\205\343\267\205b\202\223\fG\271\221\301i\264\224R\352\225\250\267\201(\005\343\\\322F\021|\264e\301\016\374Jt\033E\023\313\322\022\3114\036XY\022\245 \rj4\341\210b\350\262\251, "
+	.string	"\243\301m\003["
+	.ascii	"\232%\241\re[=\035\241\365FcL\206\f\"*\204<=\034 a\200\332%\273"
+	.ascii	"\217\"c\375<\311\304\364\250g\354\217\303\312\317/i\2268\207"
+	.ascii	"\006\254s87$2\023<\\W\314\003\272\265\214'\234\347\361\326n\326"
+	.ascii	"d\316\3630s\347\254\033\3447\250\""
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.175.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\307\001\225\016"
+	.string	"F\330^G\320\024q:\020\237\3401\001\340\037=\030{\220Z\245\"\365%\251\214\300\352\024\325\302H]\006\276\257\256"
+	.string	"\002?\026\305\223\306\376f\217\214\007\200C5U\205^\f\036[#\211\311\320\344\220/\230\253*\370\220-\302c$\311J"
+	.string	"J"
+	.string	"N"
+	.ascii	"\255)\303\337\023\0263\344,%\360W\300\212\326|\300\337\0019\255"
+	.ascii	"\367\314^\263D\361\027\305DlV\230\245\211\277\004p,0`\002\342"
+	.ascii	"\302,=\376\026x\312\347\253\017A\243q\340\231\3354\221\311\312"
+	.ascii	"g\370\326\314R\343\257\356\250~I\017\362!'r#?r\036\322\225t1"
+	.ascii	"\232\216\314\006\303\001}\222\034FB3\217\303_\255\310\007\376"
+	.ascii	"\002\020r\017\374\r\360\243\003\177\227G\354=7\337\300\337\317"
+	.ascii	"L\003\177AO\371\334\270\r\327\030efY\303\337\220\214\030\177"
+	.ascii	"E/\0021\254\021\006\023_\233\270\202\231\340\022a\254qc\2150"
+	.ascii	"3\333\312\365\332T\f(IAtm0\222tm'\332\242\200\305e\365\">\342"
+	.ascii	"$^\342'\216\342)\256\342:\337y\213\2738\214\307\370\214\323\270"
+	.ascii	"\r\3578\236\343:\276\343=\356\343@\002\232r\240bYmyI\275\254"
+	.ascii	"\266g\352\346H`\207\ni{\335q&\260C\201\264\273\333+\265\307}"
+	.ascii	"\252\005\341\324\021\327\340J\213\364#}+\245\346\302\004\247"
+	.ascii	"\220vit\n\021\200t\324\375\271\250\302S\204T\003\b \212\256T"
+	.ascii	"^\001( \340\242Qn\003\207\254\372@\237\203\322Pi\214\222Q\203"
+	.ascii	"|\212\220\347\207\327\026\206\341]\223\335\353\350dL3\207\311"
+	.ascii	"D\366\350\217\254\307\357\232\335\366x\300NvmC\342\231`r]?\017"
+	.ascii	"\350\326g\214p6\217[\273Y\317\234\315c\346\256Y7\310o\230E"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.176.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\225\007"
+	.string	"\024\r\312"
+	.string	""
+	.string	""
+	.string	"`"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\330\237\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'8\206\b{\270\375Qy\276\005\005\001'=\206\bw\bu\301\004\005\001'E\304\003\005\001'M\307\002\005\001'U\206\bsq\312'[\314\001"
+	.string	"?\202\210\2008o3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bQMP6988"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004LPS"
+	.string	"\007BMP280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\r"
+	.string	"\356L!\332d\f,\006\204A\306"
+	.ascii	"\177 \023\200k\236y\200\314}f\335\240\362\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.177.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\335\006"
+	.string	"\244\013\255"
+	.string	""
+	.string	""
+	.string	"\\"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\250\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\270\304Ry\276\004\005\001'@\by\301\003\005\001'H\b}\304\002\005\001'Q\206\bwu\307'W\311\001"
+	.string	"?\202\210\2000s3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bQMC5883"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007AK896375"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\f"
+	.ascii	"I\310\332\255\f\307&7`\033 \221'\273\n\357\3073;\260\237\317"
+	.ascii	"\374\032T&\003\200\003"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.178.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \311\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\250\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'5\206\b{\370\306Ry\276\002\005\001'=\by\301'E\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.179.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0068"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\305\315\022}\273\0013\206\b{\270\315Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.180.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\251\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\270\317Ry\276'9\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BEEP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableUnit.181.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \205\375\003"
+	.string	"D\0079"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\252\002}\273\0017\206\b{\270\325Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.182.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\225\t"
+	.string	"\304\017\f\001"
+	.string	""
+	.string	"y"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\360\253\n}\273\001:\330\336\002}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'E\206\b{\230\336\002y\300\006\005\001'O\206\bw\330\335\002u\303\005\005\001'X\206\bs\230\335\002q\306\004\005\001'_\330\334\002q\311\003\005\001'f\206\bo\230\334\002m\314\002\005\001'l\206\bk\330\327\002i\317'q\230\327\002u\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\nCW270FLIP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\027"
+	.ascii	"D\205\252\"\262p/k\214\"\f\002\006\317\255\341\020\3146`\037"
+	.ascii	"\310\021\344\007r\004\371\201\375@~ G\220\037\310\321g~\254\312"
+	.ascii	"\027\254\270\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.183.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \200\325\003"
+	.string	"\364\0069"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\340\256\002}\273\0016\206\b{\370\365Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006UBLOX"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005NMEA"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.184.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \352-\006"
+	.string	"\324\n\220"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\300\257\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'6\206\b{\370\367Ry\276\003\005\001'<\by\301\002\005\001'B\b}\304'I\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006GAGAN"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\b"
+	.ascii	"JX\314cG\205\267\346\231\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.185.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\257\002}\273\0018\206\b{\370\376Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.186.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \315\275\005"
+	.string	"D\ns"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\270\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'7\370\305S}\276\002\005\001'?\206\b{\by\301'I\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OH\315\323\016\220\271\317\254\025\324~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.187.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \254\375\004"
+	.string	"\024\tV"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\271\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'7\206\b{\370\307Sy\276'C\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxCompression.188.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \202\345\003"
+	.string	"\024\0079"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\340\271\002}\273\0018\206\b{\370\315Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bHUFFMAN"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005NONE"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxProfile.189.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \322\315\005"
+	.string	"t\ns"
+	.string	""
+	.string	""
+	.string	"S"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\272\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'8\206\b{\370\317Sy\276\002\005\001'D\206\bw\bu\301'L\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bMINIMAL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\013LONG_RANGE"
+	.string	"\007TUNING"
+	.string	"\007CUSTOM"
+	.string	"\006"
+	.string	"6\031\363\264\003d\3563\353\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.190.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \267m\005"
+	.string	"\364\tX"
+	.string	""
+	.string	""
+	.string	"S"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\251\372\350\277\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'>\206\b{\370\375Sy\276'L\206\bw\230\375\003u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\0161KHZ_SAMPLING"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\rEXPERIMENTAL"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.191.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \370m\006"
+	.string	"$\013\216"
+	.string	""
+	.string	""
+	.string	"^"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\370\311\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'8\206\b{\by\276\003\005\001'C\301\002\005\001'N\206\bwu\304'Z\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bBRUSHED"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\nMULTISHOT"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004OFF"
+	.string	"\n"
+	.string	".I\"\313\032$\320\003\241\001\022A&"
+	.ascii	"\327<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.192.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \310\225\005"
+	.string	"\364\ts"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\312\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'7\206\b{\270\327Ty\276\002\005\001'=\b}\301'E\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.193.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \336\335\005"
+	.string	"\024\n\215"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\335T}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'4\206\b{\by\276\003\005\001'7\206\bwu\301\002\005\001'=\b}\304'B\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004RPT"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\002T"
+	.string	"\005RPYTY"
+	.string	"\003RP"
+	.string	"\t"
+	.string	"\227\327\020\221@\272j\030R\330\032d\f\b\347\231\007\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableFilterType.194.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \200\325\003"
+	.string	"\364\0069"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\313\006}\273\0017\206\b{\370\336Ty\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAntiGravityMode.195.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\314\n}\273\0015\206\b{\230\345\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005STEP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007SMOOTH"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.196.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \255\035\005"
+	.string	"T\tV"
+	.string	""
+	.string	""
+	.string	"K"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\360\315\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001';\206\b{\370\356Ty\276'A\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.197.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \246\265\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\316\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'7\206\b{\370\364Ty\276'=\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.ascii	"\220W9Z\265\330\247\325\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBusType.198.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \304u\005"
+	.string	"\264\ts"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\360\316\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'6\206\b{\370\366Ty\276\002\005\001';\by\301'@\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.199.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \236u\004"
+	.string	"\004\bU"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\304\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'4\270\304U}\276'9\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.200.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \213%\004"
+	.string	"\264\0079"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\360\330\002}\273\001"
+	.string	"\005\001';\370\306U}\275\001"
+	.string	"?\202\210\200\020{3\276\0014\274\001"
+	.string	"\013RACEFLIGHT"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\013BETAFLIGHT"
+	.string	"\002"
+	.string	"\354\334n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableSchedulerMode.201.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0078"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\315\025}\273\0014\206\b{\370\314Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\004EDF"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\tPRIORITY"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.202.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \242\305\004"
+	.string	"\244\bV"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\334\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\270\344Uy\276'<\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.203.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \351%\006"
+	.string	"\244\n\220"
+	.string	""
+	.string	""
+	.string	"M"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\330\336\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'8\206\b{\270\365Uy\276\003\005\001'@\206\bw\bu\301\002\005\001'E\206\bsq\304'I\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\025VB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.204.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"$\0079"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\360\336\002}\273\0019\206\b{\370\366Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.205.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \200\325\003"
+	.string	"\364\0069"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\340\337\002}\273\0016\206\b{\370\375Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\005ROLL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingType.206.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \212%\004"
+	.string	"\224\0079"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\350\002}\273\0017\206\b{\270\304Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007FILTER"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\016INTERPOLATION"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.207.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \311\265\005"
+	.string	"4\ns"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\340\350\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'9\206\b{\370\305Vy\276\002\005\001'>\206\bw\bu\301'E\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingInputType.208.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \200\001\004"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	";"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\350\002}\273\001"
+	.string	"\005\001'7\206\b{\005\001\212\001\206\200\200\270\307Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004PT1"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDerivativeType.209.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \242\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\351\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'7\206\b{\370\314Vy\276'<\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\004PT1"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableDynNotchFftSize.210.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\326\026}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'4\206\b{\370\325Vy\276'8\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004128"
+	.string	"\013/root/repo"
+	.string	" ./src/main/interface/settings.c"
+	.string	"\00364"
+	.string	"\00332"
+	.string	"\004"
+	.ascii	"8\027\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTables.211.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\366\004u\025"
+	.string	"\226a\202Ep\236J:\367u_\230\235\366\031\350\276\013\353\317v\264'\301t\021Ge\230b\374\217E0\016\302\315\331\202S\355\001.\272X\311\202R\027\302Y\bg!\234\033\210V\251\2636p\305\0135\024z\314\275iL&\022s"
+	.string	"v"
+	.string	"n"
+	.string	"g\230\001\233\024\267\242\341\006i*lMs\240f\205\325@\224\202\"Bst\253\333\2032\347\317~e-\222\020\304 \331Z\314Ee@[\343\"|ia\353\\\226 v~,\311\254t\2707A\313\371\260\027\266\322\345\246"
+	.string	"\006\343\326:\\\341C\364\344\273\316{\305\220\0214lZ\332pr\234qO\2730\266\273\341\220\351N'}NDO\216F\343Hz\005%-f"
+	.ascii	"C\246\\\n\207\201\032\b\025K\343p\200\356Q\345R;,\300\351l\035"
+	.ascii	"Vn\027\305\303B\003\232\351l\034\367\353\202\321<\\\t\364\322"
+	.ascii	"\33158t\240{2\r\312;\277\307\303\207*f\241\200\036\020e\025\313"
+	.ascii	"BwB\230u\f\033\240\023Q\326\261\003uF\330J\206\207\342H\330J"
+	.ascii	"\226\021\020K\334Z\206\023\3041qkYV\340v\342V3\274\300\r\n\263"
+	.ascii	"\006M\243m\364\215n\352\034\275\243y\264\217\376\321AZH\023\351"
+	.ascii	"\"\215\373H?e\350\250\226\352$M\325U\275\244\231\364Uc\265\223"
+	.ascii	"\326j(\035\005CK\271p\237zr\\Q\226\246\345\255)K\325:\353\354"
+	.ascii	"'T\267\212\252\345\037\237&V\226\256\365\254\256J\332\206\311"
+	.ascii	"V\202e\3227L\247\262.}\313\025J\313R\"n$[&%\376\264\021\256\343"
+	.ascii	"\317\310\")\001\205\302\322\372\312\337\021\213`)T\002\372\224"
+	.ascii	"\200GI\276_\320\372\214\212F\323E\031\364\tM3\350\003\032\377"
+	.ascii	"\365+\307\362,\337r.\357r/\007s\262\233=\314\307\234\314\315"
+	.ascii	"\374\314\363\323|\315\321\256\366\265\2679\333\333\376\346o\207"
+	.ascii	"s9\237\363\342\341.w:\267\363\271\327\335\356x\236\347w\307\353"
+	.ascii	"ay\250!\220$Hn\366\357\020C!b\035\020\020d \272;\013\005\220"
+	.ascii	"2\222\207;\227\222\3240\003\3511\213@i\237\236\026\304_g\271"
+	.ascii	"\035L\361B\367vzX(,\326\261pd\352\n\035\243\203\255p\361\224"
+	.ascii	"V\226\254\236\032C\351\032\210\335\006\353\242I\231\275\340\233"
+	.ascii	"\254\007t\312%\253\230\330\233\"\030\230\272[\363\333\263\210"
+	.ascii	"\335\324+u\351+\362*A\237[\244\217\316\220L\277\236\350+\202"
+	.ascii	"\377ES\357\377\351\b>\"\033Pjl\214|\322iO\"\313\033\313\332\231"
+	.ascii	"\242j\232\n\373\233\237'\325\024\023+/T"
+	.text
+	.section	.gnu.lto_valueTable.212.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\226x\215|\001\332\031\222zY0\314 ]\035[Iq \301"
+	.string	"\207T\001\301\322\335\304X\232\263\310\331\331\321\365\365\365\365\365\365\037jj\325g\341\026\305^\345\300\267\233=\335\204]k\315\353u|8\217\347\375:\325\020"
+	.ascii	"\005\3414\312E\332E623G\034\030\030\030\030t\237\243\"\333]~"
+	.ascii	"\023\223\377L-\256\007\264\007\277\007P\350S\215\026\031~\225"
+	.ascii	"\215\036A\215|\200\367mI\037dI\223\355Y\374\035%\322\243#\202"
+	.ascii	".1\rO\245\215\nirb\022D\003@6\320\201\324\003\277\357\020\370"
+	.ascii	"\270\310OH\362\321C\303\267\225\265Fx\030Aq\240FC4\207\215\036"
+	.ascii	"\241:r\242oS\266H\361\367\025-\262\362Gj\f\331p\371\266\264\026"
+	.ascii	"H\b\311O@\177\206\275\0346:\003\005\312\221\276m\255\025\021"
+	.ascii	"\177Ge\2401\360n\376B\022T\005\312\002u\201\266\310w\276\355"
+	.ascii	"\215\265\022\177GW\234[K\2503\252\007\005z\"o\372\266%\033\305"
+	.ascii	"D\024\232\344\031\201\212\320\360mlV\b\nRYP\0344\007\005\341"
+	.ascii	"\362mwl\221\370;z3E\207\345\316n\303\273\005\261I\361\367_\335"
+	.ascii	"\031\025\334\225\270\3372_z\267!VF\374\375g\305\002J\250\254"
+	.ascii	"\rO\245\375kc+by\342\357\277*?\265\tPK\244(\317\314\216\336\342"
+	.ascii	"\357\277)uRU`bd\277\261\234\350\335\222V\261\370\373/\354\007"
+	.ascii	"\305\306\247\226De\325\244\353\353\347\225\343\274\233RN\232"
+	.ascii	"\\\243\342\357?.\264++,\255,\246\246\2534\254\250)%TNHRT\262"
+	.ascii	"\210\030Ar$\177z\267\262U\250\210\232V\220\246!B\\\336M\351\303"
+	.ascii	"Te+\311\207\322\017\227wK[qz\2541\371\031\375t\fO.\373\207\364"
+	.ascii	";ry\2675\025.\376\376\313\301\326\344W\3437\364\273\361#\332"
+	.ascii	"\360no\252\224\370\373\317\206\027\327O\306\017\350G\3437\303"
+	.ascii	"\203w[\252_\361\367\337\217\223\256\025-^\270\320\360ntQ,\300"
+	.ascii	"\274L\234\360\371\241\320\360nw\352\217\236\260\257_\222g\304"
+	.ascii	"OD.\364\313 \025F\374\375\027b\354\235\364,?\234a/\207\375\313"
+	.ascii	"\371\201\310\237~9\244\232\210\277\377n\312\236\320a\271\263"
+	.ascii	"+Ro\352L)\017\326\341\372\225\036\327\227\271\321/\217\324~\200"
+	.ascii	"j\361\367nE\t\245\253\365\265\336\326\331\362\245_&\001\273\342"
+	.ascii	"\357\275\212Y\330\0243\264~\2267\375\022\b\025\177\357\31261"
+	.ascii	"(ced.\277dR\022\013\263\0207\306\345\345\344\313\345\227N\300"
+	.ascii	"\241\370{\357\"\263\312\332\322J\003\272\300\272\252\300\256"
+	.ascii	"\fjjx*\355\256\204J\303/\327\200;\361\367.\325\243,\250\373("
+	.ascii	"\375\251\027\351G\272\221\034\351\227o)\\\374\275\023\301\"e"
+	.ascii	"\211IH\023\207_\322M\t\322\201\330\234:S\"0eG\222\217\336#\007"
+	.ascii	"\372\345]\352\305\343M\211\303HG\317\301\341\343\202R\252\"\t"
+	.ascii	"\230\365\240\032C\335\206\206\217\033J\201\304\337\273\320\251"
+	.ascii	"E\201?\2231\354\345\260;\320\217\313\307\025\335\210\277\367"
+	.ascii	"\030O\304\346\251\320\272\212\316\242\273\350-\\>N)m\021\177"
+	.ascii	"\357+\344\322\372\210\336\323Q\364\023\371\316\3071\205H\223"
+	.ascii	"h\226\370{7\321I\330\364\022]\001sT:\210\336C\364d.\364qi\250"
+	.ascii	"Y\374\275\353\364\034\233\2372\265\356\324\354\360\262\344\345"
+	.ascii	"\">n\215"
+	.string	"D\232D\227\334M\375M\225+rt\276\271\274\307\307\275\241=\342\357\2768\337\362\002\023\357\327|U|m\2767\237[N\364qKtF\374\335\307\346[\313cS\236\245\371\320\\^.\b\355\211\277\373\314\226\264\211\221E)\033Bw\342\357\276\261s\253\0049\\\345\346\345\004\354In\342\345\212N\244\311\237\335\327\271e\365\226\265\325\304\307\304\203\227;\372\275ia\301M-\261\252\332\360rIQ\342\357>%>*4M\313\212\021$P\276$y\323\313)\375\264\2160\371+\276&\337\020\337\223\317)_z9\246\337\020!<M\226>\224\206\247\322\366\001\361-mx9\247\337Q\374\335\367\203+\316\247\003\211\307\2162\033G\360\313\335(\302\241\214A4\367\023\202j\b\245\371\304\337}4P\320\371^\370b\374\310\310}^nME\232\374\361\300\300!\241\316G\005\213\025o\277\233\024)\226\021%zL,\351H"
+	.ascii	"\355|9\276\235\341\311e\373B\370\222to\361w\237\216\372\361]"
+	.ascii	"\236\357&K\316\342\345\356\\\244\311\236\206\307\342\305\315"
+	.ascii	"\325\321\005E\221\263\220\327\366f\005n\b\314\355\302gA\243R"
+	.ascii	"E\255\250I\032\206\2332)\312)9\214\237;\222\221&\273U\024\034"
+	.ascii	"\023\340<\201\"\026\246T\004\354\002\020L\270\274\272\230|4\301"
+	.ascii	" \247\352*\013\313\251\023Ye\240\003%E5\305\341\347\312\\D\005"
+	.ascii	"`\347\251\310\021#\034~N\331E\020A!\200$\020&!M\034~.\315.\b"
+	.ascii	"\212\001\204\340\321\343\207\217\265\266\370{/i\003\236\033F"
+	.ascii	"\303^\016\273w\324\323\301\341\347\336|e\361w\265W\204\303\346"
+	.ascii	"\251^\255\002\210\230!d\243F\016\364st4\322\244\257I\020\r\233"
+	.ascii	"\2372\301.0\302\005\f\031\275\030\371\323\317\335\371\246\342"
+	.ascii	"\357\275\027ZFH\234H\261\242\247b\310\367\303\007\005\325\221"
+	.ascii	"\022!F\fO.\273W\242G\"_\372\273\"\337\214\370{OD\217\007\013"
+	.ascii	"\022\023\275\233\036\210\341\251\264{:\275\234\\\350\357\216"
+	.ascii	"\324~l\244I\237N\374\275\207c&\351\241\263\303\273\323\360wL"
+	.ascii	"=+X\352l\236J\002\210\023pW\342\2269\321\3379\251\375\340H\223"
+	.ascii	"=2+S%\310\341\034\024T\326\332\330\362\036\177W\246\366\323\223"
+	.string	"\252\242fsn\031@\307'\312\224\341\251\264\3173\263\034\351\357\336|\304\337\003 e'\305\223\2601\261\334h\303\335RG\232\354\375\304\337O(`6O\225%\251\"\253\311\360\344\262O\257\256\034\351\361\202\324~x\244\311\036O\374=e\242esn\275\362C\2548\241`\316\250\372T2<\227\330\247UU\336\243\005oH\315\351G\232<\335\342\357@*)\233s*O]\036\026E\216\234F8<\036\323\031\205H\213 MC\204\270<\236\323\026Swq\362\360\241t\376p\371\274\241\363H\374\375\354q&\321\265\274x,9\216t\344O\237W\264d\004C\b\346\254Q\237C7\210\362\245\317;\n\222&\317 \033\026D\210A\3663\003(o:\261\206\206\244\311\363D\374\375\224!\343Tq\266x\341\"\177:\261\216\362\"i\362\314\211\277\237,V\300?&\206g\217}\2428\241\341\304J\202\213\277cp\226\320"
+	.string	"\211\rt \365"
+	.ascii	"\320\231\003\363X\35239\374*\373\3449Ch8\261\3120\220&\237,\376"
+	.ascii	"~\356\234:6OU\301oF\035\314c\251\037o\370y\366y\223\305\345\304"
+	.ascii	"Rf M~V\374\375\202;\r\330m\240\003\351\004\357\201\337w\b\350"
+	.ascii	"\3074\244\226rq\301\223k\355G\374\375\257X\371\360\027\202\322"
+	.ascii	"`\236J\375k\303g\263\337\255-xr\275\275\213\370\373W\241\262"
+	.ascii	"y\265\022\334\274\020\031\314\227\325?\305L\271\341\364R\372"
+	.ascii	"@\232|\236\370\373K\211\202\366\352z5\234\324\017\026\006\205"
+	.ascii	"\303\371\265\006\2024\371!\376\376O|lh\325\317d\370M\354\357"
+	.ascii	"\342\362\340\374Z\206 M\032\343\357\246\221-\021\034\221\347"
+	.ascii	"\324\227bHj\311\360\253\354\277\262\n\236atj?t\232\374@\374\335"
+	.ascii	"T2e\363T\246j\236D?\341\367\375\207"
+	.ascii	"\300\274S\375F\206\177\304\376$F\022\004\300|$\310\336\233\352"
+	.ascii	"\270\260\356nn\222?\342\273L\232<\343\357\276\247\340\367\375"
+	.ascii	"\213\320\324\244\377d\363DJ\220\3037< .\360\275\267\214y\376"
+	.ascii	"\302\357\273O\206\357\343\337wS\002k\232\364\007\001i\255ZK%"
+	.ascii	"\370YG\026\230\305\337[\264#PR\224S\222\254\242\224e\200\344"
+	.ascii	"\t\212X\033\226\367\370,%\013~\200=\321 \t\227W\333\365\001\333"
+	.ascii	"g1}\340\226&-`\021\177o\233\264L6h\257\262\260\362\246\317RZ"
+	.ascii	"\240\023\177o\255hd0\243\244\250\2466|VZ\005qQF\220\034\321\360"
+	.ascii	"YkS\212\264D\334\2516HS;\244\025\362\001\334s%}p%MV\220$\376"
+	.ascii	"\3362Q\360\261\017\245\037J@z(9jw\264H9\320s1U`\024\177ou\304"
+	.ascii	"\325\355\215\266\250\305\221/=\227S\005+\342\357-QU\0334D\245"
+	.ascii	"\354\266F+\244\341\273\224\025\200\210\277\2674\332\031Y\254"
+	.ascii	"`\310hc\344M\337\225F\001\334\013\027\375*E\273\242U\221/}\327"
+	.ascii	"\032\005a\361\367\326\007\253D\333\323\232\330\360]\024\\\221"
+	.ascii	"\030\361\313\n\322\356\204h\223\271\321w-)\b\022\177ou\332\034"
+	.ascii	"T\353\314ko\262h\370.:\n\210\360\3566\320\201\367\300\326\\\035"
+	.ascii	"]\276\363]w\024\364\3101\361\201\273\302Z\311\215\336+h\002\272"
+	.ascii	"\267*lk\301\367\032\nS3c\321\330\263\\\304{\025MpDiv\221E);\232"
+	.ascii	" \307\330\023(,X\360\275\222&\350qb~5\351\342R\222cr\305f\261"
+	.ascii	"X9\316{1e\030\2632\237L\261JX\252|\347\2752LI\201\035I\202\244"
+	.ascii	"l\207\021(Ajv\b\373\304:\345=\336K\231\201E\374\235\025\262\024"
+	.ascii	"\004\b\207\377\n\312\020BI\f\013\017\266\007\233\304\341\277"
+	.ascii	"\2060\324\355\0303\322\221\243h-\376\316\026\221\331 b\2074\374"
+	.ascii	"\227\022\003X\2152 \032\354\214\034\351\277\3220H\305\337\331"
+	.ascii	"\037VFK\024\251\026CT\312f_\270p\371\2575 \361w\226E\017\005"
+	.ascii	"\212\341\347\331l\n\326'_\372\2577\fB\361w\366DN\315\216(\301"
+	.ascii	"\222\310\201\376k\211aE\374\235\025\001\\\302\352\f\277\312f"
+	.ascii	"\223\354\216\313\207\005a\320\211\277\2639,\b\263\025K\275\342"
+	.ascii	"e\311s\371\260\241e\374}\275[\355l\316-T\347,nn\225s\371\260"
+	.ascii	"\244\013\312e\0207\2707\245\013Z\361\367\265\r\005\225*jL\027"
+	.ascii	"\236\342\357k\332\024\263U\231\033}\230\323\005\034R\242TP\013"
+	.ascii	"[\307V\261\017\342>\254l.M^\030\001\005\314\346\251\316\243*"
+	.ascii	"i\365\332\365\265z\345H\037\246\264 \307\325\204\302\232\024"
+	.ascii	"\226\326\232\245\341\303\336,(\257\330\250\226\254Jr\242\017"
+	.ascii	"[Z\330\232jSQ\257H\206\352\221\275B%\311\233>\214\316\202\221"
+	.ascii	"\370\373zd-b\263\032\261:\323\334\310\352U\310*Vd\341G\023\323"
+	.ascii	"\372\366c\210J\331\353\322\252\304\341\305\230,\020\305\337W"
+	.ascii	"\037k\217 8\251\243\035HN\026zt\334(Zq\3448/VA\216\310\274\022"
+	.ascii	"Tc\025\312w^LY\201,\376\276\322\210\361\263\312\310E\274XZ\005"
+	.ascii	"\250\370\373\n#nM\261\256h\261\262X\253\360#\376\276\252\230"
+	.ascii	" g\342D\317\206\027{\033\212\277\257%4\260\222\330@\007\336\003"
+	.ascii	")^\275&\207\237g\257<k\210\r/\266\254\300\"\376\276\356\254:"
+	.ascii	"\252I\227e\305Yor\241\027\243\243`\027\177W\363~\252\256\316"
+	.ascii	"\016K\336\364bwj\361w\225\356\312\360\363l5n\031\364$\376\256"
+	.ascii	"Z1\355\330\334\324\266\034\351\307\206(D\305\337\3255\363\016"
+	.ascii	"\215"
+	.string	"JZ\276\364cE\024\222\316\264\360\342\242L\221rD\243\f\212XX\022\205\03603\213\312\004&\305\253\325.\365K\365\312\205~Li\3022\376\256r\251M*\334H]ea\345O?6!-\376\256Z\341L)\241\342\360ce`R \324\"\265z$\t\222\274\351\307\224\023\224\304\337U#\347\326\t\"G\210\323\220\034\350\307\336\234\342\357j\223N\217ZU\002\262\304\341\307\226;\342\357\352\017\325\307\007\311\233\277\260\243c\250\036\331\352\016\025)\007z\262\240\tB\361\367\236\232C5\312\271Qk\324\352\220zC%\342\360dC\023T\304\337U\033'N\b\240\341\331c\2534\324\031\371\322+\207$\344\305\337\325\037\236\027\265\352b\370U\266\nC}\221\367xe\221\004\263\370\273\332B\204\217\n5E\336\364J%\t\\\361w\025\305\b\022&\324\022\032^\311$\001I\374]\035AB\335\t\241&\363\247W:I"
+	.string	"\022\177WuJ\234Y\206\250\224\255\342\2507\271\321+\313$\004\305\337\201y&|\352\354\260px\245RB\n: \234M:\245\347J\334r\303+\323$\344X\001\302\255a'zh5pm\370y6\260\215M\303+\327\340\252\2408K\003\242\345H\257\274\213 \026\177\007\232\371\224I\001Fqy\263\240\bWdc6\235\204\225\277\220\342\311\020\225\262\201P\200`\032\336l(\002\320\t\360K\005\223\341\331c\003\271\200Mr\2427+\212P\024\177\007n\255"
+	.string	"N\301"
+	.string	"\251j\240\325\360\253l \026\360*\027z\263\243\b=U@%6\300%>\b\fx?f!\205\004\n\230$\367y3\247\b;G\264Z8\021y*\263\033\342\002\3100\025\263\201LA\224K@\245\f/\310x\364"
+	.string	"&qx\2634\bQv\3000\322\001\314\261\341\315\326 0)\212a\203h(\007z\263\267\250\032`2\200@4fx\360fK!\361w\340\317\217\013\030/\362\2477\243\333\321\002\310\307G\0050En\342\315\356 \f\241\320\232\001$\0014\001,\021\004\341\305\b\032\300\235\020\300d\016\364gC\020H\304\337\201:A)^\226a\332e\003q\2007\036\374Y\021\204\233\370{\232\267\n\321a\251;Z\316\325H\241\254,\257$\245\301\331\210Zkc\313\237\376L\251%,\376\236V\0312\033\246gv\232\206\346\362gL-V\361w\b\312T\212M:\245\267-!\n\033\246bvJ\226\216\345K\177\346\324\022$\376\216"
+	.string	"(`\024\334\350\335\325)\3270\355\262\323\257\324+\307\371\263\262\026\032\361w8m\342[\303A\207\245\225\245\341\317\326ZL\304\337\323\253\264\312&\265B\300\205\242\024\252N\245\250\246\362\235?{\203\345\342\357i\324\251\325\032\0259b\304\345\317\356\316\210\344\250k\032\"d\303\243\005\301_\361\367\224IG\220\037K\251\222\313\243\r\301S>\216\220x\354(\032r\204\204c\210J\331\251QZ\224?=\332\021\314#\376\236\336H\211nv$\3534\250F*\224\003=Z\022\\#\376\236\322Hg\330<\225\022\2174\030\251\2144FN\364hN\360\211\370{\372\"uA\201\244\024\351\212TE\276\363het>=|:\352\264\304\360\354\261\323\236\324\204\206GS\276g\361\367\224\204\017\2514\311\223\206\340\360ht\257\223\370{\272\223\352\364~\374\204,)Nz\263\341\321\356\224\344i"
+	.ascii	"o\003\035H}\357\001%:,uy\323\257\005\275LsKV\226\350\225\r\277"
+	.ascii	"6\364\032\301\001\371e\251\321\2656\266|\347\327\212\336\024"
+	.ascii	"U\202H\235\245\241h\271\211g[{y\342\357\250\031\252\274\200)"
+	.ascii	"\215,\nZ\306\341\331\336\\,\361wt\254\251\327V\243O\206g\217"
+	.ascii	"\215BA\301r\243g[\272\312\370;\352D\210T\223.\256 w+\376"
+	.ascii	"\2162A\267l\316\255\013\237f5\374<\033\305B\257\202\337V\344"
+	.ascii	".\305\337\321*\247\250!*e\243TS\037\324}\333\321\007vi\322U\021"
+	.ascii	"\177?\003\275$=%\275%=\255\336V\357\253\347\2447\326#\353\231"
+	.ascii	"\365\316zk=\266\336\225\336\262\207\245g\347\303\361\201\360"
+	.ascii	"\361\370D\370N\370P\370Z\370\\\370\200|3|6|C>#_\016_\222\257"
+	.ascii	"\207/\210\217\311G\304W\304\027\345\223\362]\371\260|\\\276."
+	.ascii	"\037\024_\230O\212o\212\217\212O\315\007\347\263\342\253\363"
+	.ascii	"a\3517\035\247\363t\021\335\247\247\350/:\214>\243\323\350"
+	.string	"D\375F?\352H\375GW\352C\272SG\322\223\364%\275\2523\351M\372\223\016\326\243t)=\255S\351n\375\255\313\365\271\216\327\363~:\277\235\037\211_\211_\212\237\212\037\214_\214_\320O\350\207\343W\364\333\361\343\361[\372\001\3719\375\236~I~P\277%\277\252\337\326\217\311\317\311\357\311\257\354\027\345\207\366K\373\271\375\336~r\277\271\037\336/\017\325AwP\022h\t\324\007M\201\276@a\2404\320 \224\b\275\201\"\241;\320\037\250\022:\004uB\221\240IP%\350\0224\013\325B\275\320/4\f\025C\245\240SP*\250\032\352\206\276\241q\250\034j\207\336\245 \322\234TD:\"=\221\242HY\244-\322\237\024(\265\221\016\2459R\035iR\332#\005\222\006I\235\322\247\024I\232$U\222.I\267R&\251\223\364IZ\226FI\251\244j\251[\372\226\306\245r\251]z\007\004\001\314\001\362"
+	.string	"E"
+	.string	"{\200'\200+\200,\2001\2002\200A@!\340\r \016\340\021\020\t\350\003\370\003\330\004\024\002,\0024\002\214\002J\001\263\200Z\300.\240\0270\f(\006\234\002T\002\251"
+	.ascii	"\325\200n\3007\240\034p\016x\007\304SA\2509*\217*B\355QO\250"
+	.ascii	"+T\026j\fU\206\032\244\n\2518\324\"\225\207\232\244\006Q\231"
+	.ascii	"\324'\225\210\n\245F\251K\324*UK\335R\235\250O\3241\225LU\252"
+	.ascii	"f\252\232ZE}S\341T9uN\275S\361V\020k\316*b\035\261\242X}V\027"
+	.ascii	"\353\213\025h\235\261\332X\207V\2435\307\312cMZ\201\254A\326"
+	.ascii	"\247\225\310\032\265J\255U\253\325\272\2652Y\235\254OV\262\265"
+	.ascii	"l=[\321\326\265\225m\265\262^Y\351\326:\366\206\305aC\260<\254"
+	.ascii	"\t\266\207U\301\256`a\2601\330 V\210\275\301\342`\217X$\326\007"
+	.ascii	"\373\203eb\233X\"l\021\026\212\215b\227\260U\254\026\273\305"
+	.ascii	"z\261_l\030+\306Ja\247\260i,\025\266\215uc\227l\034\213\205\265"
+	.ascii	"kqZ\020-O+"
+	.string	"\242=\321\242hY\264-\332\237\026\250\265\321\016\265Fm\216\226G\233\324.\265@Z\247\366\251M\322B\265J\332%\255V\273\325~\265N\332\261\226\2545k\317\332*\355Zk\245\275\322bi\355\334\033\027\307\r\341\362\270=\356\tw\205\313\302\225\341\376\270Bn\r\267\3105rw\270<\\%w\311\025\342\016q\221\270I\\*W\211\213\345f\271\\n\227\013\346Bq\243\270R\3344\227\212\333\346\272\271K7\316\265s\357^\020o\316;\342%\361\372\274)^\027\357\213\027\350\235\361\332x\207^\2437\307\233\364\366x\201\274A\336\247\227\310\233\344\205z\225\274K^\255w\353\365z\277\336\260W\354\225\362Ny\251\274j\357\333\013\367\312\275s/\336\233\007\353\300;\360\b\230\004\354\003\247\200a\3001`\032p\020L\004\337\200u\300G\260\017\370\007\314\0047\301E`#p\024,\005W\301V\360\026\314\004\376j"
+	.string	"\034\006\213\301R\340)p\032L\005n\203\335\340%\034\007c\201\355Zp\030\320\222\\\300\007U8\360&\325\222\263\323\242\223?]\340."
+	.string	"8\361\367\026\020dy-7Y\202\332\342\3570\036|\307\316\325\3219\211\305\337a\271s\013\356\212\225|\351\241\312b\2527\225I\025\266\265\234\350\241\322\342%\265\356c\206v\2267=\324Z<\244\374\221E\201\313r\244\207Z\306(\342\357\360\030\372\004\006\323\360Pt"
+	.string	"\310sr\307\345\325\345\362QAmM\260\264\262\206\300\256T\252%\260\022\227\217*\002\300\222\251\025\tT\222\034\351\243\216"
+	.string	""
+	.ascii	"\344H\031\354"
+	.string	"\004\023\201\237\362\245\217R\002\200P\374\035\036\002\013\261\351$*0-\301A` 9\316G1\001@D\374\035V\202y\f\325#\033\356\001'\345M\037\345\304\001]\374\035\336\001#yx\361\002)\312\001\033\345@/u\304A\025\0340T\215!\330\006\207\227J\342@L\250\345\007\236\001\003\345O/\305\301V\374\035\226\001\001V\321\002~\001\273\310Y\274\024\023\007JX\300+l\336*\351\315\001\"\364\300(\340\023\271\321K)9\370\021\177\207M\300%0H\200C\f?\317\206E\300<9\321K\275q\020\024\177\207\223h0\316\020\225\262\341\034\030D\216\364RK\016J\304\337\341\2337\213\315\023\231A\001\313\335k\227\023\375\224\323\006u\361\367\267\356\245;k\\\211{\227y\217\237*\333\240,\376\376Z\331z\302\346\326\2267\375\224r\203\254\370\373\273\366V\2619\267.09{\323^\264\034\351\2476\030b\246\344"
+	.string	"C\025Y\224\267,_\372\251\rn\304\337\3371\"\031|9\365\373\004\312\013\246\341\247\3366X\021\177\177\235\244.J\220\303\0234\351\342\362\340\255\2026\020\301\204\202\253,,\016o\245\201\235UU[\201\324\020\225\262_\252w*\177z+%\r\334\342\357o\224\005F\220\034qy+&\262\":\2048\275C6\274\225\223\006Z\361\367\267\351e\342\302\300\265Q\277?\226\224\312\212\304\337_\037\031 \361xwx\360Vo\032(\035\35185\030q\243\350\305\221\003\275\325R\003\034\361\367\227h\203\240\032B.oE\247\201\013\032\034\304\370\221\2217\275\325\235\006\311\370\373\013c\305\360\253\354\267\305\313\302\345\257\2022\220\213\277\277*\200K\342\236\027\305{\202\303_\r\245\305\337_\023o\2117"
+	.string	"P\365\033\342\025\361\362\344M\177U\224\301W\374\375M\276:6\357\316\225\244\022Z\002\200\252\335\274\241\233\305~q\336\233#\251\370\273\231\304\305S\217\006@\207\245\216\303_\225e\3004'w\201"
+	.ascii	"ipW\254(q\274\025\200\254\212\313\346\256\345M\177\225\226A\213"
+	.ascii	"\370\273\253\326K\330<\225\231\213\346\236i\370\253\ft\224Sl"
+	.ascii	"\236\312\234;@\220\2612\262\r\177\365\026'\026\346v\360\345>"
+	.ascii	"q\235l\370\253%\006g\361w\327\313\312\346\251\266\334&.\023\227"
+	.ascii	"\277\242\303\300K+\001UWV9\320_\335)Y\242\200\226\255v\243\246"
+	.ascii	"\244\2020p\212\277\273P\013(r\3045\222\263x\254$\f\224\210\270"
+	.ascii	"N6\356\0230\251\035\n\322\304\344\301c)\031\001i@\217!*e\273"
+	.ascii	"?|x\360XL\030\314\210\277\273I\016\320\201t\304\341\261\2340"
+	.ascii	"@\021\177ws<\325\003\\\033D8\334\033\371\316c\225\325\305\337"
+	.ascii	"\335!\b\314p\203\\\032\371\323c)/`\213\277\273@\021\350\275\030"
+	.ascii	">\233\355\306\200\221V\026\177w]\270-\362\037\t\270>\303\263"
+	.ascii	"\307vU\270)r\240\307Z\273\240I\374\335E1\2018\022&\334\022\036"
+	.ascii	"<\326\333\005T#D@\240@/\256vu\206\237g\273Iw\207\303c-/\020\022"
+	.ascii	"\177ws\\\020\021*\200\227%o\303c\321]\240#\376\336\336\235[\026"
+	.ascii	"h\227su-]N\364Y"
+	.string	"C\027\274\220\213\303\200\203\013\264ln-\\\373\226\357|V\321\0058\361\367\266\r"
+	.string	"FV,\001\246\361\256\201Y\203\305\032d\260X\203\224\361\243\314}\323x\261nI@\002>\304( \202\214PB\207\272\002l\222\2005I \267&\td\032\371E\306\256Q\023\017\322\370\313M\317\030'@8F0k\360\2328\313\220"
+	.ascii	"B\f.\254i,\300\370\313\013M<\3323R\202\371!F.\326v\261F\330b"
+	.ascii	"\006\203s08\267\346\207\030\371\345\270\276v}\343\301\340\f\233"
+	.ascii	"0\263\255\302\3146\373\302\314\366\333\026kb\220\026\026;\324"
+	.ascii	"\3049(\303\3146\214\224\351\320\326G$l\"\221\364-\024\316rP\001"
+	.ascii	"u\213I\3373\215\360\236c\350\0175R\3560\343\256\371r$\3124\262"
+	.ascii	"6\026_\223H\317\340\304Y~\t\312\306{\356\300\232\301[\026\326"
+	.ascii	"6\252\232\303 \035\243\232\255\211\244\355\371~\221\2037\205"
+	.ascii	"\265F\"o\326T\315\230`{\274\203\267\013\301\374\020C\301\374"
+	.ascii	"\020\223\001\2279\026k\013\364L\215\3173\365M\013\345\340M\201"
+	.ascii	"\211\244\351\033\206\026\312\036j[\2369\276\300&\315\\#\007k"
+	.ascii	"|\266\351b\035tM\244\354Af\226=\314vK=[P\254\2034R\306\303\315"
+	.ascii	"z\270%\230\306\032\237o\031\026\336\306 }\273H\372>\332\306`"
+	.ascii	"\213)\254\217\301{\202\211\301\204\231mZ(\203\3278q\316`\326"
+	.ascii	"H\344m\274k`*\230\301\340L\301\234\251\205\262\007c\207ap&v\260"
+	.ascii	"\320z\230\355\326\024\026g\3336\262\246Ms\224\205t\260X\203,"
+	.ascii	"\312\020\215A#n\274\217\021^\263h\254\2214\022L$M4\262&-C\234"
+	.ascii	"g\356\333\030\224\357\030\374%B\230@c$\312\023\230\364"
+	.string	"-#\244_f$\261\236_\"\264\230\020\356\331\330A.\302\324\304\031&\316\035\354\032\2065k\360:8\037\347\326\303lS \022e^*\024k\233\002L\261.\3363\r\006\023Y#\351\233\306\22151x\221\276o\231\240k\3364N\333n\220\306i\341\205\031\244L#e\340\233&\3162>w\bF\220 4\3267}\224_\216D\031\237;\324p\315M\343\370\334A\246\203\267\361\345\302Z\013[\363\246k\342\261\306\21126<\3174q\016\"Y\023\247\221//Fy\006\237;\324H\232\271F>\326\304\027\013&\215\221\b\023\347\033\227\241\213\262p\001\253)\\\300\004\223\306H\024.\300\025\322HY\270\200\026\223F\022e\216\362M\343E:\030\301\2469\276-\246q\346\246\221r}\343\020L\374\236q\244\fS\254e\"],\3161\301\013\246\260\266\345;\006O\357\030\034\210\244\361\371^[\327\f\262\352J3\327"
+	.string	"\211D\343\275\262H\231f\256Qq\034_\315\341L\337\035\344\371\210\277\022*\2307\215\007\347{\216\t\312\270\321\330\201\276[\314\01714>\013\21722q\256o\032I\241\306C08\277\037\210sPH\333\367\\\224\221\203\301\3715\217\365P\266\203BY\306\256W\"q\266\221\254}\317\310Z\b\301\264\357Y\306\221w\375\"\027\2152q\016\312\306\273\006\206\202\tS\254\355{\226\207\301\032G\3124R\246\305\274ia=c\274\2172\362\b\323\"\347\016H\031y\204\201M\241\314\334AF\036a\\\323H\023k\342\f#\323H\031\331\203\221\330AFF\036a("
+	.string	"Maq\356 \234i\241L3\327\264\246\220F\336\364\f}\323\3145\023L\333X\244\2052\022I\007\215\367Q\026\326G\bEz\206\276\217\03100\361\"\035\274\351\243L\343\363L\215\007gZ(\277\274\030\351\341\214\31353\315\\\224\271\013\360!FV"
+	.ascii	"\004\363C\214\360\215\t\342\306b\004\023\246X\307\340F\243\215"
+	.ascii	"\024\312\370=\333H\np\313\313|\007c\202xM\363\n\353\243\214\317"
+	.ascii	"\035f\\S.\326\266\214\317\262\260>V\250\301\353\231\371\206\221"
+	.ascii	"k\2748C\020\3363\315m|\021\322\364K\005\363X\013\327c-\224\347"
+	.ascii	"#\362u\315`pV\2050-\246\220h\214A\322w\f.\343\305\332x\304i\344"
+	.ascii	"\005\223\266k|5kf\"-d\315\t&\215\317\267,\0016knz\306\030\244"
+	.ascii	"o9\0069\337\301w\306\215\257I\037k\360\226\b\346QFX\254i\354"
+	.ascii	"\233\306k\326lm\031\244\260>\266\230\037bd$r>\322\030\2112\315"
+	.ascii	"\\\363\232\257\371\362b\304e\2024\021\307\215w\fN\341\202\211"
+	.ascii	"\264e\341L\307\314C\243\221\210\301D\326\036f\0137]\254\347\033"
+	.ascii	"\227\215wp\206`\"\205\365Q\026\3227\035\203\317\364\313k\326"
+	.ascii	"\314AZ(\327\251\211\307\300\3244\215|\003M\325\244\231k\\\023"
+	.ascii	"F\032\215\035d\031\233\276\351\340|\313\364K\321=\326\302\324"
+	.ascii	"\214\t\342\365Q~I\217\265\0205\211D\343-\277\240\307\372g\376"
+	.ascii	"L\232\271F~\371\035Y\223\306H\024\262\307\272\025\266&\215\221"
+	.ascii	"\310\23210u\214\374\322\32234\2215\215G\017\264L\023a\212\363"
+	.ascii	"j\026\2155^#\213\363\035\301\304\203\364\313\213\004\223\026"
+	.ascii	"\032m\031\277\351\243\007Z\306\2115.\027\215\037\352\333\030"
+	.ascii	"s\301,\3263L\013\204\333x\337\264L4\336x\321\030\224\221\035"
+	.ascii	"f\013\246L#e\"\230\036f\"}\3134s\215,\244\361\371\206\241\361"
+	.ascii	"b=\301\304k\273&\312\270"
+	.string	"\314\021\2271\312\267\0217\332\021L\274(c\f\322\304\372\305x\037e#.3[0\2054n\023\361\326\364@\023\2172\302\027\342\034#\333D\3745\361b-\333\367L\234e\0347\306\274\246M\304\345b-\013\353\343j\32203N4\316\310D\"\035\244o\t&2X\343\310\032\237q\244<D\3168l\322B\243-\303\310t\240\205\253\031\023\304k\032\244\2144\036\035 \323\370|\267\230tp\276ad\373\236\345\242Q\276i\216-&-4\332\362M\023e\204tL\020\371\2328Rf\004\302Y&\032\203\362\021i\313\370m<\326\314\304#\262\026f0q\244\314\b\204\263Lc\274\345#\322\226\361\333x\254\231\211Gd-\314`\026\2155\362\246g\212\265,\244\211\256\tS\277\024\215A\331X\027\353ckz0v\220\215u\261>\252&\022?\3324\216\317\362\f-\224\361\272X\313t\260\236\241\205\301;\203\031<"
+	.string	"\022\246X\3438\215\354\200\016\316/7\215\027\353\016\212\365lw\020\274\221\035\034\340\002\323x\244\357\016p\243\361\356`5\211\363\314M\343\305Z\306\2176\215\343\263<C\013e\274.\3262\035\254gha\360\326\300|\250\217z\254\317z\257\377z\261\037\373\263G\373\267\207\373\271\247;qN\020\247\210s\304\351s\2468a\2341N\032g\320\211\343,:\221\316\035\347\322\t\344t:\237N$g\222\363\352\304:\277N''\331Yv\242\235i\247\333\371v\312\235sg\336\231\245\267\323K\366L\364zz,z-z?=\240\336P\217\250\207\324\333\321S\352-\365\206\364\234zH\002\212\216\250\244$\236\317Aa\331\270\207\252"
+	.string	"\003"
+	.string	""
+	.ascii	"\202\006\263\0304(\006K\363<\360\345\r\024\200\032y\212>\032"
+	.ascii	"Hj)\315i\t\f\300P\240\013PD=F\351\375;\345\322W#\037\250\240"
+	.ascii	"\377U)\332$~\240\363\375\250\016\203\273\242\326\241\3534s\377"
+	.ascii	"\223\325u\276\354\362\300\022.\223(\332\2108\362\333O\270-\316"
+	.ascii	"\003\235\024\323\205\330\362\031\\\0222X2\257+r\366!\t\017u\001"
+	.ascii	"\204o\231:\376$\022}E'\371&p\023\204\253\232\034"
+	.ascii	"\037\261\307\024d\013\224q\f\331o\033\376\300\276\223\256\270"
+	.ascii	"\241\355`\033\013Q]\r\336\232\302\022\260\2267$eq\f0\321Hl\275"
+	.ascii	"\210#h\300\257N\365\367\307e\310!'\210B8\fHcT\340zQ\311Q\362"
+	.ascii	"*\322B{d\251\026\222r\216\242\215\247\232\037\023ZxZ\001N\320"
+	.ascii	",\340-\007\023\250\215\216\230\255\005\315\324\026\220\353"
+	.string	"\026<\004b7A=\264\3759\214\202\275\225\3421Y(\260{7\367\254R\354\033\217j\020\375\005\177s\252\312*Q\017>\330\301\231\017\217\334\216}\334\264#\214\366\340\315n N\327t\267f\002(\250\343\246p\254r\024\235\345\022^\250\261\007\226\220\357:;\013G\020\016\304\220;\371k:CxsO?P~\316\375\341?>R\321EF\366\rf\310\201\377h\346\326\334\037]\305\r\225\373\037n_\240&\"\356-\224\032&LE\233?\222\352\020\273\b\327\337\025uXJ\320IH2y\333\027\210\003*L\207,\034\233\321\302\305\203\224 +\337\252\307\345n\360o?\312,\001\300\374\nZ \325\"r\331j6\376\201\216Z2~ \215\3146\016\307\222U~Z:= a\367Y\244\342\352\372:>D/g\2257g\005{\333\3469!\306S\302\330\230\336\240\304G\034o\233\221R\032\253a\002\225\313)\210"
+	.ascii	"C\206\220?1\225\312\t\3060\005\017Ri\230\023NF\037'\343\215f"
+	.ascii	"\034\025X\326\b\345t\252cs5\241_S\n\007\244\b\n(\223\273\304"
+	.ascii	"\031]\303\224\251~#\320\302\326\340B\374\344r\350\303\303\030"
+	.ascii	"m\245\220f\316!\371\255D\026\240\027\364x\037.\253\314v\202d"
+	.ascii	"J\030\313T=\242\327\020\372\0208\360\362G\335\276\233_\346m\237"
+	.ascii	"\361\336\006)ZmO\202j;\204O\"\303\366\200t\360\371\322\304\323"
+	.ascii	"\313\341oQ\t]\311\227(\326cA\330\034\022\337\241\370\367\033"
+	.ascii	"e\312.\234\016\206\245\251\016|\330D\243\030\231\345\020$\"\356"
+	.ascii	"S_\374C\353eP\023T\213|+l\272u\360s\251\275?\244$\263X\267|\306"
+	.ascii	"\340\254\337H/\214\360\375!\315\225\247o\303\330I6\272\304\024"
+	.ascii	"m\303\02658\361\035J,\\\021K\206\304\0230\034whq\337\030\177"
+	.ascii	"a\315\004B\024\3743K8yzy\365&~\372\227\322J\300c\265\217Li@S"
+	.ascii	"u\362\352#\365}\007\331\3111\nf\336\343t&\242\204@\007\034+\037"
+	.ascii	"\316,\300\316\323'\001\261\3301+\007\367l\334\f\313\001j2\260"
+	.ascii	"y\301\\\305\376$^;\254\314.Gx\203\206M\304\3635O\356\353<\033"
+	.ascii	"J\fX\023U\246O\304T\354\220W\260Yf(\b\323X\234<\302\235r\205"
+	.ascii	"\361v6\364$\346\327\037x\222cj\326\250\005\363\334Z\022pGW\225"
+	.ascii	"\344\370\003\361\314e\350l\332\304\314\r\337uoT\263\277\232\254"
+	.ascii	"\037C\341\337\334\247\376n\007.x\376\031&\222 "
+	.string	"\312\240\324`\317\332\232WT2cNQ\036\021\223\\\307*\236\352\313\336\242Yi\223f]\nB\0341\201Y\366\355\005\300\364Ep\253\225\242h\335 \031\247\252!\210\302] \320\027\240-\023\250-\217\320\244g\230\307\016~.g\t\261\023\313^\362h+\353<\023\017`\t\b.wn6\241`\320i\265\326\302D\235\004\033\347\003E\004\325&\\U\241\220\341\270k\2246\361\252h3Q\314#\361\034\241xg\366\324:\305\257_\360a\222\337\241\253\274\361<-\303MA\305\336Lz\2632\343Y\237\221\021M\b\332\343\002\f\255R\274\221\333\"qW\247%c\202i6mXGG\273\234tf\260\t\177{\r\365'\006<\265\304\300\237\037\213+\250\357\005EH\312\032\024\363\270R\030\240\035<8\222Vc\035\256\021Pe\002\347\321\275\303w\207\377\206\202\357\t\234\215\021?\223\026\024\272\006\367\nE\262v|\272"
+	.string	"\266\305\177b5\035\020\2732.\2136b\017\354\373\311\304`\312\342DKK\253\342.\362\240\2333\201\223\262\256\004ZR\237\355\025N{\315\342 \224b\332A\227MGS|:;\373\221\234^\306\343\020\374\272\244\333H\254^\210\355\235\220\337\232\223\004a\271\266\346`3\034\331B\276\301\231\233\222\033T\312\365\310u\036\211\016\211\035\r\bR\fS\352\214T\031\236He\273\221\270\256\021\356\207C\205`r@\311$_\217\316\365\274\377\314\244\032\213.?\035}\\\344\266\311\346\t"
+	.string	"I)l\203\025\243~8~8\332\310\347F\037I\236_\375\323\001\217?\220\007N\220\2631\351S\026b;5m\331\361\233\264L\236T *E4\nI1\373\273h\326\310w\346\201{\325.\246\346\352\364K\336y\204\027e\317\247\366SD\017y\315lD!\350\235t\272b"
+	.ascii	">\373\216\207\020b\253\003\236\235\324\271G\261y\322.u\202\236"
+	.ascii	"\303\255O\232\251\002\252+\005\2700Q\233\032\377\372 \276\032"
+	.ascii	"ci\341\245\2641\315\305\032\b\3004\227\0318\207\t5\365\301\r"
+	.ascii	"\351TM\200\377A?\270\024\031\235\232]\025\034F\360\246\325\304"
+	.ascii	"\215]\345\020\357\244\263\205\276\255\310\351w\01682\355+43U"
+	.ascii	"<\220\333M\215\020+\037\262\027uI\275\262l\256\306x\3751\035"
+	.ascii	"K\301/\304\241\246{\342d\276\372d\335k@\255\332\035\251\227\324"
+	.ascii	"\322\021 2_\2209\331Gc\272\331!\323\317LQzJ\361x\031S\341\251"
+	.ascii	"}\305\266\231\264\207\035\225\337\215Q@\356w\256\307\252\024"
+	.ascii	"\337\264\201\234\355\200\204\270\334\030G\316O\323'E\210Q\362"
+	.ascii	"!i\221\"\303(\247\212\224\257\220\271m\250 \2335\357g\357,\305"
+	.ascii	"\274kK%\275;\221\372f\024iF7\377\013\252\336\344\327(\330\364"
+	.ascii	"\013\243\002\210\316\265J\352\214\256$\2150\001\373\314\027i"
+	.ascii	"\347\275LT\207\031\336\246\236\213\227\236e\271?\210\b\347Hb"
+	.ascii	"?q\227yj\272\333\224g\341\202\216\002\366Y\2668Am75@\324!\031"
+	.ascii	"\340Db\333:V\213\261\33444\213\231\034h\3258\302N#\305\213\372"
+	.ascii	"!\247\373\023\323\036da\271\261\307\267\021C\027\363\247\262"
+	.ascii	"0\325\030B\367\352Uu\300\205\230\023\025D\023\315\313_\265\314"
+	.ascii	"o\321\221m\347\223E\n\327Kr\207\212\373p\032\252\300\277\262"
+	.ascii	"\0042W\3476w\235\316\023\t\361\345T\324W0\333\007(:\252@\321"
+	.ascii	"\203\276\363\221\376d\022\\\245\367S\013m*\311\335\367\213\200"
+	.ascii	"\310e\341\251\027[#\313\013\253\273\n\0048\3625S\226\203e\346"
+	.ascii	"\256\255\005\350\327\300\214\255j"
+	.string	"\337\310qS>v\331\366yB\300\006U\313q#\020D\331QQ'\353\243i\224\016\335\244\rr\214\016\306\237.\364\004q\247[J\027\252\035K:\263@\275sV1\025\201\222\r1\322\027\243\034\303\024t\276K\270\2120}\245\247\034H\244g\022M\217Pe\377&\200\224\276\\{A\3149\211H\2050\035!\252\\\264\310\t#\241|\306\r\025\303\217T\306\300\f\006\275D\325\301@\300\033\013\247--\244z\244.Gy\275W\346Xt\236\225N\225\336\026\213C\320\325\355dD\316\254\3449\351\250@\206\344\342\337q\242\347pP\023rn%\371\364\215\t\226H\017\320\364$\007\362\220\216\037\b\313IC\360\252\364$\241\242\2470\275\360\303\210/8\202\356\343\220\262\363\270\370y\251\266\025KG\227.\333\027\261\231\205\rI\375}\343\231Pw\f\357w\251\224g\333\267\211[\374'\301\361\250\376\304y\370\235\321Ab"
+	.ascii	"\b"
+	.string	"\362_\277\303\277;{_h\005Rd\037\320\220\023~\206\260PJ\375y\365\332Y($\034\024\0042O"
+	.ascii	"\355\273Z\215\242\221\034R8:\025DQ\353\277\346\350\365f>\005"
+	.ascii	"m1|\375\346\301l\253\345L^}\311\366(\227N\217\252\355\344H\213"
+	.ascii	"\316j)0}{\254z\016h\t\214=\"\253\020\276D\300v\343\354!\022\274"
+	.ascii	"\266\361\230\312f\256\025\255YS[^]+'\\\256\320Eq\275\031\362"
+	.ascii	"\302|\r\270f\205"
+	.string	"\372\372\340\246\250g\3139c\360\n\317$3\311`\317\223%\330\361j\224\320\275\273\266\303\263:\375\356\245&\037\265A\227)\334\357Z#j\345\267z\203 \243j\311\037\357\244|\332\017(\352\035\3641\353s\324}\030\233\272!\302|CKOz:\355\207ju\375\304h\335.\354'\240j_\377\002\036\226\351]\261\240\316\373\327\211\016g\0267a\220#J\332\333%ZJ\2644\021\2053\2404$\206:!\206w\256[q\271\021L<\020$\234\013\253\246\314\002\231DNY\215\326\357g\230\230@%\374TZ\221\264<\372\352u\307\322v\253\252\277~\207\025\357\345\373\007\263N\367\235JC1\007\250\027u\224M\26116\370\220\351\315vy\225\372D\230J\241JmGq\007\177\236\321\267%\225\367\360wp\221\204Z\346}\034\205\251vy\202\006\233\020\322\213\323v\003\260\355\276\245\224{X\221d\360\204\243m\357\006"
+	.ascii	"|Ba\345\f\360\230\017\335\213\324\355~D\211\313\220+pq~\205\245"
+	.ascii	"-\177W\254\323\222I\001:O\316[\210\234<^\205_\207\2648\306NR"
+	.ascii	"\324Vx^\033\216\2438\261\261\246}.\357Tq\247j3\270\203\"\f,\210"
+	.ascii	"l,\215\272\307\260|\0316\364\037\335F!\322*\257\317\324\334\020"
+	.ascii	"\251\251GR;*\2303\354\253&\037t-#\230\273>Z\266*\270\332\254"
+	.ascii	"KJ\241\305\363}|\003\r\330_\326(9\326\267\347&\302N\0314\244"
+	.ascii	"\204kd\317\363"
+	.string	"\265S\240n!\243\344\212\331\3563\336\323\001\030\002\032\262D9i\242e\354W\312\022\242\272\241\310\002\274H\356\215\271\352A\340\210Og\350\316x)\221\215\346>\330\222\377\332\275V\263k\017\303\346\251JlI\211\377x\373\033f\2205\337=\251\244\215\321\315w\300\224\300\303v0\335Xk\217H#\017Fz\307J\332[\324e\341+rc)\261\005p\034B\252\030\261\232\255 \034\252\354\022eN@?\re(\363\366YzA(\035\237\354-:\202%\3628\227\322Z(\205\222<\302sEem\333\r\247!R8\272\355\357b\366:\211^t\222\"\273dT\341\016hS\221\350\273g\231\320\247}\356/\305Qz5a7\217F\002\351uoF\017_\207M\244xg\321_\222\206(\324\262\b\323(V\320S0U\322\305x)\355\177\263\203,P\356E\303=\224\2738\324\373\252\371qsw\330\354\2636\371\356"
+	.string	"\352x\2405J\341\340\301\025xJ\313\220"
+	.string	"\277 \266?\n\233-\353;\212\003\262\031\217\303m\367\365\361\225\350\351\253\223\034\004\001z\261\022Y\307C\300\254I_\021\205\360\377\022P ?vH\254\325o\234\262\r\256\314\021\324A\255\325\204\215-\333\250\022\n\027\3704^10\0056w\253\334\314\n\215k\227\307\242\266\377-\002nd\324\2471\207\215b\013D\266\375\\\307\3627\riP\001\272\261\365'\240\272\3249\"\303\333\211m5:>\013\357_e\366\330\224\365\230\375T\325\262\320\274=T\304\252t\240\247'\0033\322\253E?X\215\311!u\373E.'\200S\256\227g!'`|\217\344a\226\267\327s\264\304B\253!'\273\330\031\001 \200f\235\252\026\343\277\f\343\243a\230\266\005\221\252A\306\366\001\343\003\355\276\346\336^j\241g\310\372\037\220IL\352\376"
+	.string	"\244\350OAk\023b\205AC\377i\212\213e\302{\335\333\034\350\2530\354\321:Z\002\347\026\230 \276\231\205-\317\334\204\013\270\324\b\360\242\227-\205\004\3475jY\266[\023a\350\202\236MX\322\314"
+	.string	"\224\322Z6\300\307$\030\033 \320\34570CFd\006\225j\370\002\375\003\351\335?S\231\001\024*NA\024-&\251\024\373'\325\006\367\215<\224\003\034\217y\225\304h\"\220\347\224\205\tF\241\246L\005\225'\247\216X\360sb\354pT\227\2040\214Gj,{\"\313Uq\270{\340\337\322Cc\t\227\270\017\340(\370\313\323\345ZD\036\241;\353\342o\315\302\257\274\rI\327z\353_q6F\255\303\235!\242@x Q\254]"
+	.string	"\305n\375\003\016\312>{\240\377\220\005b\333D\224q\004\023\235~[q~~\274\017\367%\353\274Q\001^\236\373\001a\260\033\226;\212\342#\025\347\355\373\235\226\024\231M\314|\234\256X\350s\301mX\030N\321\331U$`ZI\254\002\305\250\377J~p\242j\252\266\222g\261\245]\035S\3700\376\214\034\370\340\3620?o\347\246"
+	.ascii	"=\031gq\265\244\263'\276}\274\223\244\304\244\321Z\005\335\207"
+	.ascii	"\013\017\262\356\203\251l\271C@S\326a\317\244|\324\360\337\312"
+	.ascii	"\021\316\006}\335\256\234\302k\310\343\260\225\274\2777|\361"
+	.ascii	"7\272\342\270\213\264{T\033\305\007\\\356\024h\314}g\261\246"
+	.ascii	"c40\005\013\003\245\277<\222\343\316\203\207\360\326\254\222"
+	.ascii	"\001\234\346g\240#\326\353F S\307\305\232UP\233\322\\\353N\341"
+	.ascii	"\230\005\2061\262\207]\353\355V\345l\b\271\007T\343\375\266\345"
+	.ascii	"\222\220\220}\016\204J\271\213&\366\341\036\3375nex\351\030B"
+	.ascii	"J\33602\257o\306\002\241t\236\341\371!Hl\371\265a\326%\231\307"
+	.ascii	"\031\330\002\354\267&#\262r\230X\311\245ya\361\227\nZ\213\331"
+	.ascii	"+E#L"
+	.string	"U\305\315bY\235\006M\204\276\026\3507\033\356\277$\305\035t\211\253\331\323\tyyT\222}\317\313\001{\004\261\373/\020^\3679\0032S\310\263\266\205\305k\334\024\332,\r\221a\226\2066\031\177\375\314\222\211 v\021.\253\340\343\200\203\244\225\001\331\270-Z.\266\274\024\202\304r\375'\253\271\303\026@Hw#\252\266\225\345I\034\252\251\363ID\214\265=\027=je\004\237\330\225\223\372\2664\022\333\332\026\035fv\271yW<9\357\337*\020\331\261\274 \251\r{ld\271`\233R\032H\315e\311\375k\266\203\tt\246\3524\320\265\260a\261\332\3569\030d\353GjC\327\320\314\344/\213\207\203\214\353\310{\214P\255\326\361-\2038\362\335\371\307lR\323\n\350\022^_\025\375Ck\027\"\317\325K\200O\203\\\367\356\032\377\025\035b\261O\273\2214P\360eM'0O\241e\331M8\260\262\267A"
+	.string	"\247\353\317\353"
+	.string	"\346\340z/\3209\375-\272\246\327\342zL\352\3250f\373xM\365^jD`\207\236\214\312_\315B\376\230\025\213!\001\247\205\346\364\311G\2159\2427\337X"
+	.ascii	"\374\320*\037\313\242\237\027\231\201TQ\\>\346\363>\210\302\024"
+	.ascii	"0\245l9\t%D`{\256\017\273\341\026G\255)\202\206\007\271M\n\001"
+	.ascii	"z\202\314oC\215\267)g\374\274<-(P\254\303\002\233\307\247$\033"
+	.ascii	"2\221\330\361x\2614>w\267wG\2715\315\313!\262fA\211+\330`\023"
+	.ascii	"\2547T\361\201,\2355QM\350rw\030\374\177\346gR\317\223R\005\311"
+	.ascii	"]M\204H\270*\361\203\346\"\230$:?A\361>HTe"
+	.string	";\356?T\242\352J\226\231]\312_\377\300.\226\213\331\304X\211\344j\342\206\321qX\237\274\271\b\017\256^\354\216\221eW}R\313\327*a\310\037=\364\352?\311\331V \030\266\332\037\r\3066\273\206\036\3369\212,?\263\225N[]R\031\004\226\321W4|\237\020\235\205\343-\277\037\377\3465\30768i\312\317\032\260\320h"
+	.string	"\223S\035\336\242*\347C>\036\004X\344]\3509\360I\3026\210\204\233\332Rwz+\306\rX\262)\330\311\005m\245\217\364\255\212\317\024\247\300\346\303\302\215v\367\0320\035\240"
+	.ascii	"?\306Z]\242\246+\204\213,~\266_\373\"#\277\274\177\250\324\273"
+	.ascii	"\217\003"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.215.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 \306M\005"
+	.string	"\262\t$,pU\323\001"
+	.string	"-\372\274\177\335\357\027\216\201\300b\374k\034#&P\363Q\373\3409[\376nT\325_\225\343\r\244(n\332,\331[\246\237\242\205\240f\255\322b9I\007*+5\231\232R\202'jq\214^)$\345ZU\224!\256\027n\321\0022~\016{\020\362\357\323p\373\337\323Yv\223\351v\004"
+	.string	"\264&\200\231\374_\350\327\317YN\322\204\216\322\270t\272\233ad\257}\327w+;\3104l\237\300\320\335\177\231\366\330\303\375_\370\037\377\317\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"%\b"
+	.string	"\242\f./"
+	.string	"Y\222\016\\+\\\023\205\2251\n\326PX\342\377\377\377\335\377\355\b\366\377\377\377\323\377\377\377\377\377\337\tS\n'L)p\225G\273\221\226dm\273\026O\234\tV\362J6\222\3542\262\222\310I!#\201|\364\361\312c\243\216\2138&\332xHc\241\214\2030\006\272\370\307b\230\212}(\356I\007'\346I\007%\336I\007#\216\020\303\207u\034\226\312\306\206[\262\221a\226l\\XE\341\234\204k\020\216B9\030\312`\034\354\233\202m\bV\rL#\360L\3002"
+	.ascii	"\307\244\203\371\313\365\222\233\311\272)\265\370N\331\326J\331"
+	.ascii	"Tm\326\256\266\257\367\336k\366\223\325\366\251- \260\323\244"
+	.ascii	"\003\226q\352\226\344\221G\036\363\310#\217y\344\221\207<\362"
+	.ascii	"\310#\017yT\036M\315\212\025K\344\001r\364\255\267l\271\bp\243"
+	.ascii	"\0257fe4\002\311c\036y\344!\217<\362\230\332\222< \217\332$4"
+	.ascii	"\326~\002"
+	.text
+	.section	.gnu.lto_.refs.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375 S-\002"
+	.string	"2E\020\027\360\326\264\006\314\3003\360\f\324\271\264\326Zk\002\300\337\302oS\221\001\207yiY\331RNJFB>:62.*&\"\036\032\026\022\016\n\006\002f\261Wk\225:\225F\241Og\323\356.\023"
+	.text
+	.section	.gnu.lto_.decls.e16cf0010f871270,"e",@progbits
+	.string	"(\265/\375`\2030\375\307"
+	.string	"\332;\271DV JQ9\351\326\017\356\260S\203\243{\352\305\201\"w\037\r^\277\007_q\270/\273s\274s\340T?\327\210B{\347%\006"
+	.string	"\314\236j2\256\212e\373W\200\266m\253\024A\020b\336\254\227\003)E\332$RW\311,m\233\344\004\360\be*\325K&\177o)S\241\003:\004f\004g\351\031J\212\201\031\007\241p)\235]\217-M\322sX\372:\016B\237\007\366\305A\350\006MD\3223\025\346*g'Wa*;\227\227M7.\273\033\005\007\342\327&lF\220\266\347\034ik1SA\237<l>\244LAq2\024fk\253\233\326\271y\331\335(*\020;Jn\250\304h{f\373\231\214\313x\215\233wC}\326\370\362\243-\237\261\f\354\334\200\321\316i\254v\234\244\347}\336\373\374i.>)P\332j\340 \2649*=o\200\326\276>\336"
+	.string	"\345(\300s\fl\006\204FQ\375\354\334I\0013k\373'\007\241)\003\241\235\305@\250"
+	.string	"\3448\b\265h\f\204\336\003\351\231\t\213\235\2338\271\t\217\361\001\256\022\031\256\020cqQ\234y\227\212\307\320\316\332\023!Zp\2304\247\330u"
+	.ascii	"\302\315\364\334+v\357\355\360\233\243\021\346\266\275\223\013"
+	.ascii	"\237\\\020N\200\364@\351\337?z/\r\234\347\215R\352A\031\207y"
+	.ascii	"\350\377qe\r\376\333{\377\301\275L5\351\221\265\244\035\215\301"
+	.ascii	"\375\377\241{\227QL2\253e\004L\262\244\313,\223\223\212\200\371"
+	.ascii	"\274U\033.\031\326e>\233K\333\\\366}\336%+\251\273\324\\\"1\237"
+	.ascii	"7\352>\233K\rwIJ\003\363\231\264d\222YI1\223\254)\025\301]\272"
+	.ascii	"\313\273\224T\225.5\245\230pM)\r"
+	.string	"L\262$)\346\222\225\024?\233\227gh{Z-\233.Y\322\357\336\373\364\374Z\366\334\233\024u\227s-\343Z\331\311\270>.\313\205=\261\256\320\275wiVw\325\324y*]9&\222\246Q\323\275uW\306\007K^>\357\275NWi\311\3676=\243\356Uj\252\240j\262\027\247\250\373\273KIOJW\315\236&\245\246\323ER\305\367\336+\305$\273j\002\247D!\373\272J\317%3\237\232\367\353\326YE\245d\313\3475\273\367\362\335\217\214\213\352\251-\001\376\356@\037\3776\376\275\201\277\211\177\017\377&\372;\305\337\032\370;\003\177c\340o\n\374=\201\023\177K\340o\024\376>\341o\023\177\227\370\373\001\177;\340\357\021\1777\340o\021\376^\300\337!\374\235\200\277;\370\033(\342\357\020\177\033\340\357\002\374\234\376l\377\277\t\363\177\314\337\034\374=\364\263\207\237-\3709\203\2371\370\271\303\317\003\370;"
+	.string	"\177k\360\363\316\317\277\377x\377\363\376G\340\357\024~^@{\350\016\r\200\256\2409\264Poh\n>\370\031\204\237\025\320A\377=\370\373\305\221\205\"a\212\232\201\n\240H!\002%\324\277\222`@\002<\020QAL\3607\320\0065"
+	.string	"\365\202\307\245IA\313\256$\313\317'\200\230h\t\376\216\3406\234~\016.\340\347\006h\370\373\247\225~\306"
+	.ascii	"\316_\223?/\345\374\225\347g\017\370\374\375\273\316\337m~vv"
+	.ascii	"\317\337<\277\277.\177V\376\235\3637\372w\377\315?\367\375\374"
+	.ascii	"\346\347\275\237\365~f\363\363\232\237\357~N\363\263\231\237"
+	.ascii	"\313\374\377\371{\314\317d~\256\373\371\371s\330\317J~\206\341"
+	.ascii	"\347#?\027\371\331\353\347\256\237\271~\336\372\031\310\317Y"
+	.ascii	"?_\375\\\365\363\217\237{\374\274\343\347\034?\343\370\331\306"
+	.ascii	"\3175~\226\372\031\352g\031?3\375\374\201\237[\374l\374\271\370"
+	.ascii	"\363\006~6\372\231\305\317D?\257\3709\003?\243\370\331\204\237"
+	.ascii	"!\3603\211\237G\374,\302\317\033\374\257\362\237\355\377\330"
+	.ascii	"\177\021\377\337\376s\320\327\327\327\367\347`\371s\232~\r\202"
+	.ascii	"\0026\332\342\034\240\216\r;\233M\363]\351}\375\316\034q\272"
+	.ascii	"\001d\b\034Z\333\267\233\277\363Z/LH\323\fm{\017\370n\323D\213"
+	.ascii	")\244-\312@h\r\201\315\216\235m\327x<Jo8Lj\314\264\3200L5]\332"
+	.ascii	"\276\325\374\215\246\323X\274\"owm[\007\360}\347#\025Vv\326V"
+	.ascii	"\347F\345\204\2311\323s8\314\273\201\236\0172d\3344\255\001\313"
+	.ascii	"a\212\021\323sO6Hv\364\240\222h\241RW\327m\225\331\344\340\353"
+	.ascii	"\016\013\330\275<@X2< 0\332\036\345\361\345K\277\225\360\201"
+	.ascii	".\275x\001\243\343k.\216\235\035\327sC3\274r\206\274\201\302"
+	.ascii	"\321\366=\303\337[\232K\337\370\200&\007\226\266\234\006|\313"
+	.ascii	"U\266+Mn\332\262\320\231\025v\266\225~\003\022c\207\210\023\323"
+	.ascii	"]\333\267\226\277\257\264[\375\002\245$J\333\306\002|g\021\201"
+	.ascii	"\013kI\333\212\301\227\032;[\255\333\314|y\365\234!\"\307\245"
+	.ascii	"\355\233\312\337k\315\206\243\006\206\214\274\266\314\005\370"
+	.string	"\236b\261\326@\031i\333C89\320\320z\f\207y-\235\230\2465`8Ie\354\354\262>+\241\341\336\254\256\257%\035#Vk\334\230u\224\216\241o\264\225\255&][\216\001\3706\373\351\262\206G\244\255}\232\225\201\002\245\307\2064\334%\272\255/\033\347\204\235\355\244\307\206\236\267\206\017]\216)\020^\350\231\231S\224\266\357\347\373\006\232mJ\231\342k\333\001\360\355D\301\252T\351\241\365\026;{\253\305|\322\226t\214)^ZLz\232^\270\262\274\265\005{\242\361\365\025\301k\373^\362\267\220\346\352\260\036\236a\005J][0\241\312\324\264t\206\2450t\022v\266\222.\3626\322G.\364\274\027\355\336\253\244\211\364W\bMQ:3\262`\230\265\222F\022\003\n.\357\203\216\215\036j\226H\312\227\203P\r;\276\274|\276\330\271Ik\373\344\241b\2469i{;\225\366\020\340\273\253\343\210$\375h;"
+	.ascii	"\006B\tp\345\254\023\363\025v\362\225\006R\342y\227;k|Mk\362"
+	.ascii	"n\024\017\0209kX[\306h\371L\005I\362e\266\204\303\206\346\211"
+	.ascii	"\220vc,\215\245Bg\314HSK\333+\2740TPn\322\363\226&\317\3203\326"
+	.ascii	"\230\366\354\314\232\r\305ugtz>\372G[uU\367`g7\033G\347h\035"
+	.ascii	"\275\203\271\304Z\370\215\343\232\350\334p\226n6\017^\253d_\251"
+	.ascii	"S\031_\263\243\372F%\373\322\211\221\225'\364\341\303\207\264"
+	.ascii	"9\267\343K\217}\305K\231\311Ah\004\fD\365\353\354\304\261\311"
+	.ascii	"\361e&}\355\222\376}\243mT\346S\363\031\301\017\223)\255!:S\332"
+	.ascii	"\300`\243m\323\350\032\357\251\226\272=\365A\363\336\244\236"
+	.ascii	"\372qso\322\017s\006\314\031\330%W^g\250}\335\222\276fI_\253"
+	.ascii	"\244-\343\311\201\307\307\031-*()\3171\2315\2461veX\257>\331"
+	.ascii	"R\031\350\3040\373\251_h\030\354\354\030\217\301{\315\304\024"
+	.ascii	"\306\356\336\3331\272\251\235\352\363+'\206,2v\367>?|\340\360"
+	.ascii	"\341\003#\221k\222\355\\\261\337\233\2607m\304z\251\207L\252"
+	.ascii	"KJV'\261\263\225\270\315\363\336Vb7\275\254cQ\351ZY\026\273{"
+	.ascii	"\311\204>\374(\201\023\303am\337'/I3e\327\366\225F\312|\374\206"
+	.ascii	"\235\334w\373\244\371\374\325\244\033qkC\350\017\017\241\257"
+	.ascii	"N\351\333.}\207I\363\204~n4i\342sK\357\201\0314V\373\201x\254"
+	.ascii	"\206\323\370$i\270KLi_\367.\235\331\260\223\361\370\356\314\205"
+	.ascii	"\345\336\317{\311>\b\355"
+	.string	"4\251\242\344\005\324\276\333\322\367X\312g\330\216\235\034\030\215\317^\027(6a)\b\356e\016(\367\3651\007\364\rC\372&\222\216\021\262{M,{m\3378R \207a/\\\347\263|^\250\035\2728(\270\274{\311\304\260\223\303p\027~~\020\312\211\272\322\263b-\323\361\027vz`0u\371\344)\326\003\005\305\3254\223\236=\240\334\307\036\3203\230\364\314\226\236\003H\200\2670\360\310\360\306\347\325\026\350\210\221/ZN\266\264\2755\202\366cj\307\\[;\004x[\344\215\336\013f_^sXT\350\254\327\337:zGO\251\220K\222\344\013\021\333u\025\025&\253\355m\327o\207p\226\267,]\332\264\375\211\001\274\345J\373\372\332\266\204\330-\2463}K\332\336n\375\026\210\r\322S*\252\330\236im\031"
+	.string	"Y\300[\255\236\273:\262\260\266\025X,{E\365\324\263W\277\255\262V\313\"nbm\233\212\203\320"
+	.string	"0\020j\177"
+	.ascii	"o\2339eh\342n[\r\254\217\263\036h\272d\351\201\327\363\264r\343"
+	.ascii	"\214G\363\351\2019i\331\301\344\023\006F\026\032\035U\306\030"
+	.ascii	"Z\330\230\034m<O`prTo]D\353\246\3011\266\203e\351\312\336\215"
+	.ascii	"\236C\213\213\323bc\n\215\241\r\312\227\235zV\215uY\251A\343"
+	.ascii	"\207'\346\312\251*\335\322\370{\257BA\231KVH\244\242Z\311\030"
+	.ascii	"V\223\215\372\033K]\353)\025Y>\304\374\200\2623tTe\305\2603\310"
+	.ascii	"\324\202\b\261\223\361t\345\264\346\332\336>\3756\206}\241\247"
+	.ascii	"T<\355\240:\323\366v\034\204\372\244\001\336\302h/\263\2677\246"
+	.ascii	"S\317\030T\r$mo\235~\313d\233:x\332\002\322\366X8\b\345a \264"
+	.ascii	"\362\001o\227\230m\226(\331\244\024RE\350\332\336&\231\361u\275"
+	.ascii	"\300\245m\305\003\336.-H\2632\245m\037S\024\034S\333\327\276"
+	.ascii	"\277\362\3257=\245\242\317K\r\033\007\241;z\300W7KSgD\332\354"
+	.ascii	"\341\2141\327\234\325\275\277\352\361\026!6jpi\253\223\307\006"
+	.ascii	"\317K\\\215\312\346\257xu\r\235Z\232 mC\340 4G\315\235V\331\231"
+	.ascii	"\215\266\257w\177M\303Z:\320\307\307\246\355\317\016\370\212"
+	.ascii	"\206g\313\025;g\333\236\3273fx\300D\201\2232\345\325\314_\223"
+	.string	"*YO\251P\213+\323\022\303\316*\246\222)q\223\244\206\334\226lx\3246Z\264\252\364P\035\243\263\364\274d:_\356z\230\305\245\367I{\302\316\372\244\326\t=/\215\035'4w[\362n\024\026\020%\346\260|\324\201\261ep\230q\323\366\213\220\216Y\323\027X\333\373l\245\007\201J;-iR\345e:(1K$ab\267\306\326N>\365^\037\316/\265)3\244I\222GVV\245\200\311`w\267\324\031*\227\332\245\316U\272\nW\275\3248vV\271\252\345\312\235\3254\226\243\022\301\310Y\205\362V\245\300\250r\325J\315\322A\211i\302\307\022\017\252\\mk\247\034 ci\222\344}\340j+\203\232\300\336g\231\376w\227\245b\321i\302\262Jz\372\254\315X\332k[\335\352\225+\364{\203d\216K\372\037\226\364\277)\351\177h\351\1771\244\377=I\377k\222\n\245uE\253j\257iU\206w"
+	.string	"\302{\226\2365\315\336\233\304\234\201\017s\0068V\272\222\240\240\366?%\351\177^i\215Rc`\247P5\373\3419\245\031<\332\376\027$\r\301\355c!\364?\037\351\320o\006\023vV&\365\031\346+\305\221%c\311\213n\013\215\255\355\253\363\257b\265IN\232T^\221\266m\004\370\352dG\315\216\tT\333\364\311\354Y\023\026\326oLOMk\362~\254\024\0312\244\355{\334\224(\351\271!\037_=b0\300\320sCT=8\216\034)#\343\213\207M\221\"\375\326\025\343\315\313\253\357\331\325\265\367\305\203\305\305E\206'\306\326\026\2100Mk\300\324"
+	.string	"\001\002\302\331\264\006l\307-+k\f\325\216\223\253\2531O_;[UU\034\3645\255\001\333y\372\361\243\337\310\350\325\036\265\307"
+	.string	"z4\255\001\223\333\261\243\356I\315Qs\364\334\020\034\021\0348\244\350\324\2506\252\2150b|5jt[\230\226*U\245\372m\253\353+uV\250\n\325m:\314\313\201\2174H\372W'vV\247*\2432\233\267F\001\234cVby\325\313\213\n\332O\0322Yi\332\276>\375\225Ya\364\200\341\201\326\326\266\306"
+	.string	"\276\276\300\001\254\346V[\021\f\204\n\325\333\327\307\316\356\253L}h\237T\2314^(\334\323T]\372\353\255\313\237SZ\322R\333\232\004|U\252uRS\0027\na\302\n&P\210P\016\213\220Ae\007\036\260 <\026I\f\221G\022GCe\362\005\212\237\033\205H\036\t\203\2247\n!\"\211\034\272 \"\211V\004\221E:\311\024\277d\n\n(\221G\025\210\200\\\240Dh\262\205#\322&\213G\241\265\300\005\222G$[<\036GH\201C4D\006\207Ea\016\332\302\361\004\362\230D\266\020\352\274\b\026\221\222D\022H \375l@\016\211\214D\026\303\"c\360D\007\210(\224,\036`$T\036Q0\276 a\350\202\250\f\272 \"\005\320\002\311h\342\202\"#\321Hy<\036\241\020\236 \00194\022\203\310\025\216H\341\b"
+	.ascii	"\270\020,\016O\034!\207J\023AJ\342\021\321\204aQ\251<\"\215V"
+	.ascii	"\350\200\034\026[\020\r\215\204(\204\206\312\340\211\026\216"
+	.ascii	"E\026\310\241\213\024:$[\214\360\0029tq\024\016O\030%\203H\022"
+	.ascii	"BFB%\261\005\024\036\206,\202\311\"1\b\364BIt\021D\226@T\032"
+	.ascii	"G \275X\0019T\026\211\017H\026\207Fc\320\210\204\006\306#Q\031"
+	.ascii	",\036\221L\bO\024\217\302\243\362\210T\341\250\005\025D\254\340"
+	.ascii	"\220,j\261bH\344S\024<!(\024\216`\201d\302\020\031l\201\b\031"
+	.ascii	",qD\276(\241\202bp\305\021\261\204\240\033\205\030\026\005\225"
+	.ascii	"\305\243\213\r7\n"
+	.string	"!\"\211<&\215\303\244\207\244\020\331\342\210\0029T\016OP\032\207Hd\013\341\206a\221\310\342\210T\241\002\343\221\230L\016\221HGG\022\026l\030\n\211.\206$\270p\\\301\2020X\034\201\303\220\350x\002\212\021#\240@\016\211\210.\216H\025P\250P\002\005J\343\360\310XD,\216\230@I4N\340\307\230\002\013\026)hP&S$\321d\217R9L\262`qD\211\206,\b\203Hh2\005\261(\334A\006\215\204vx\0244\332!\322\013\245UR\200X\024jH\036\221\224\304\025\250r\230\242(\201r\307\004\244\026,\034\217ET\351B\360\250\272\020<\301H<\201X\024F\220c$\036U\027\202GF\342\021\252\274\2212E\b9E4\231\202\204\221\262\31084a\004\261(\244\340E\020\211\f\342\024\021Y\030\217BT\231\302X\204\204c,B\252;Jc\213#\211\027H\245\321\001\023(S "
+	.string	"\2504\022[\244.\f\211\214&\206GA\024\206\305\025\301\025\206-\212A\027@\307\340G\244!R\204\362xD\212\3409\020H\002\203\t\240PB*\f!b(\f\262@\016\225F\242\b#1x$B\210L\212\bq\001\013\302\241\021\t\242\"\261\305\b\311\"#Q\251\034&%\270\220\210\034\032\207E\351?@\200\001\020\020\202\0139m\366\264\272\374\bk{\273\367\333<\253\327S*t\324\315\250j\313\036\312"
+	.ascii	"o\331$\271\221\243"
+	.string	"k\r\236\216\247+V\332\336\342\375\366\316\252A\313\200\321\002\325\226\3638\b\275"
+	.ascii	"\r\3606\r\017\037Z\232\244\266\026\330\235q\243&O\257\355\355"
+	.ascii	"\231\337\226\261fx`\314\345M\265\345\016@"
+	.string	"\200\267d\204T5\341\032c\305\240Od\320\254\230\337\326\3310Lyv}m;\203+\300[0cpmK_\350\244\034)\002\327\366\226\356\267]\254\227\0337dJ\333.\300\f\300\3339+\006\206\315][\020r\\\252\2161n\226\313o\227\330-8B\246\324\330\264e\260,\300\333\270_\220!I\326\340\336~\226da\331\267\337f\261Zx\306\270\270\tk\313\024\220\001o\261\374\364 \262\244r\2732\346\211N\255\355\355\225\337fY+\335%C\310Y[fC\003\336V\321Yc\302\005\253\215Jz\203i,G\333[*\177\265\263Sx\030\301\222c\002\336\262\341\344x\253\342ZSk6\177\200i{\253\366[4\2336\227$DH[\346\260\005x+C\033\215'ngR\312\312\212DY)\277ub\315~<yB\325\226\2438(\206(`8\254\330(\277%\263e\277(eI^\332r\020\016B\203\222"
+	.ascii	"o\241\274\2712c\353\211\035\223\352\362\342\245\355\355\330o"
+	.ascii	"\221\330gO\251\260q\255\232\3322\225\023\340\255SG\312\236\226"
+	.ascii	"[[\t\232X\2616sE\305\212M\251@\223;#\325\326.\001\3362I\233I"
+	.ascii	"\224\\\265\335\020f\301\352t Q\323\366\026\354\267I\254\022\037"
+	.ascii	"-Yn3\332r\223\203\320\t\002\203\353\250\222\0015\306\261\210"
+	.ascii	"A34$\"I\222\2441B\n\020\004#z\234\266\232y\022\200$=\314b\316"
+	.ascii	"\"\021\221\232\222Tj,\007g\201s>\200\241\035-\316\361Qr2\233"
+	.ascii	"\035\313\264\343\257\232\276\347dZ\2732\206\215\265:\021\\\035"
+	.ascii	"\005+\304\333G,}\200m\322Y\020\311;\004\274\350'\253\354\374"
+	.ascii	"\367t7e#\003\202\303\373\350\265\201\001\330\0271?{.k\376\272"
+	.ascii	"\345l[\031`\246\277fU\325\377\345'\006q\343\272$\342}\260a)\232"
+	.ascii	"\325\344\343aG\367\215\"\030\263G\374 \030\276\024\017($i\367"
+	.ascii	"\001\222b\376\370\006\020\267\353\256\2607\356\337\270\221$k"
+	.ascii	"\233I\320\r-Jn\004I\375\217\343"
+	.string	"\212tc\305\354\236{\237 ;\252U\265\355\372\235\374Jl\275\177(\316\315\030\3262\027\226\371\024\257Tb\255\222\301\275cc\203\001\f_`\344\216]\300[N\260\360m\007\033$\230\246\002\206\211MK\bj\013\202\022>\2776{%*y\016\214\317\321\177\355\274UeS\3440\236lX5\301\362.\275\t\031sX\210\r<w\200\377\235.\210\007\203\270\261'N\212\305H\335ub\331\031?\n\024\265\320\320\036.b\177\216!\374\247\226\375\356\256\264\232\311\245s\204\212\361)\336D\206\n\007N\\\260 h]Vv\236\2178\257\322\001\034\270S\224\fF\234\351\362Jr\246cX\207\224\343\3511\037\367@\020&-\f\021\355\262\262\255\"\366\221\2240\231\f\327\030\262V\303@\017q\004\320\240B7\033\205\330(\"O\375\301\027\006@\316\037\350\002\230S\226\026\205\035K\312x\314\363\201\315\026\263\247M\205\\\325Q"
+	.string	"l\310NHv^\t\036\022\331\315\363\003\311\351\325\253\203\321"
+	.ascii	"\263p\321\207\3172(\330\232o\203\022\023\004QsP^X\tN\262\335"
+	.ascii	"\247o\323#\266D\341\262\342O\266\223\246\236\177\256O:\266~Y"
+	.ascii	"z@h\315\201\260]\357\301\361\001r\025\020:\241\276\301=\f8\247"
+	.ascii	"$|\177\240%(\251J\302j\322\327')\231X\301\247\374=\276j_=\214"
+	.ascii	"\314\005g=$\330\365\323\036\247BZ\001}n\037\214\017J\016V\273"
+	.ascii	"\352\220\377\330*\266L\234\341\276\357\034\004q\202\370\274s"
+	.ascii	"\030\210\003\346"
+	.string	"\371\007i\375\001f\352\017h\024\020/7\340\337\267\255O\324\300\347\365\255\254\3349\324\347\257G\350\247t\013\246\305\274\255\344\002Sr\301xF}\353\002@\177\2754\020\020O\231\032\346'\204\304:\270\267\031\253H-\353\035t\207A\225\3426O\271\240\221\214\004;`\323\0329F\257\310\302\304\214\246\240s\322Y=\341\241\236~\007\026\223\302\201E\316\336\021f\214\215(@\2502\r\341\031\325>\f\321\316\246\r\334\251G%s>G\270\245'\355\217\003\360\332\266\030\327 \216\377\036a\367\347\254\177;\220\374\241\321Y\304Q\265\201\252\220 \333\223\344\202x\216q\257[\233P\351t\322XC 1\322\341\017\243?\300J\356\376&\220\276\n\267,\240\313\020\023\340\344h\357\2779?l\210-4\247\203\r\364\256\016]\266\326\313+\271\216[\241KE\033\241OF\233\334\334\2305\334X7/V'\027\302CA\272\331\f"
+	.string	"\020\323\fB\263\217hG\222 \236\311\3357\364\333\024\371pC\035'`\335\344\201e\354k\243s\b\307&\351(\246\272u\2615\231\222\002\351^j\225\257i\274D\022\365d*y\247\234A\366\231\264\265\2555\271\345?F;\263P\365\030\221\027\312{{\203\363\330X\016\330X\"s\332\214Cw`\215R\\\013\336"
+	.string	"\361~\212<j2\276\375\022\225\2606jg\304\303C\364\250\303\331\234\006\025\312 \361\317\2466\221h_\220\241E[\022 \232\016G\\F\255DZT\255\271\004\013\361?[\274'\223ys|\234o\026\210\241F,h\265g\274F\016d\340e\021\203\320\341%/$\203\374v\td%`B\201#\007\004*eK\005\366\300\331\302\204$\231\007\332\027\341\252\r\305\237\bo\334\316K>\022:P\365\327\304\002I\265\b5]\266{\331\237\322\235k\320\310#\362U|\370k\031\201%~\210<,M\201v\375a\371\312plh;\016\244dB\231\253rU\205\262\025\253\316r\246^\3067\257\266\262\335\252\220\330\260\221\030;\272!\210-\005\026\026!\276\303\027\367\017\344%\305)\\BD\302\360\2210"
+	.string	"?\021\301N\306\177R\032\275F\r\222m\242\344\235\023\200\2638\033\214e)\027R>\0241\223LJV\037\332O\022\310\321{[\244\306V^\034\340a,\264^[\227\341\024>FTq\007\265h\2027\024\206\346\304\004\360\203(X6)@@\317\302\025\004\006\247w\303\021\254\241\026\334\226\371\004Y\316\366\335\246\220RPE\215=\256H\032\233RK\242\311{To7'p\352 \206\036S#\241\025\352\345\236\0042\n\025\221v\361\344\022\022[W\312\204\201\315g\326\367\253\267\312{\220h\031;3\024!kq\256\265\225^\272\247z%V\327\257|wc\365u\250i\2010\276\177}&\017\337z\tH\001\b?Kyq`\007qw\227\036vFx'Pr\030\373\376\306\346\f\305i\251~]\224qY\246\316\036#\002A=\020\250\030\362\277a\244z'\240\031\222\017\376\177|\235\363h\376\337\303\375E)"
+	.string	"Z>\3221\027\357\020l`\334\223\352`Dw\3240\263\354\207\267.t4I\355\252\360\221v\026\263\005\214\226\371^9\\\177A\2225\250\362\243\341\214\374\335A\001\231\362\332\277\253r\n\035\271\207jY\256\207\364\r\033w0un\024P\260*VtGinE\271]\3410E\241\363\177e+5\205\225\204\215\"\017|"
+	.ascii	"\334*\304\021Gf\030g\260tv\026\332iIh\216.R\036?\r\303\244\311"
+	.ascii	"\211_U\307`\202\306V\265O\313Q\023\021L\204\235\231\027\034\201"
+	.ascii	"\311"
+	.string	"0\302/\321\001\003\007k\341\013\016B?GvUi\204+\230\360\271\203\223\320\340\362\017\205\257\264<k9k\303O\377\3373?\355\254\177n\374zG\253C\254\326~\020>\030\021\350\204\264\f\367\037\236\334~\200\202\177\243\347\277\300\234\3115Y\0373\363J\353\223\322G\276\376\270\276\361\350\213\334\023!\177H^\b\377 W\007\002a?\256\337\003d<\356\353`\236\343?\016\3727\3526\230\257qN\003\377\031\3732\240\307\210\207\001\374\305\177\027|o1\214\005\262\025k*"
+	.ascii	"-E\347'hs&\256\374\b\356\337tuK'\030\347\030\371\227\213\231"
+	.ascii	"7\035\257>.\034O@_\247\355l/\035\003\245\277gBN\237\352\323?"
+	.ascii	"\240OY\337\307g\226\317\246\260g\252\233\356\017'\375\340\207"
+	.ascii	"\221\346\2607m\307c>\007tDY\215\036\216w\226\017g\217\020Y\326"
+	.ascii	">\347\355\261\357\204\207\246\257\347\364\356\327\263m\366\023"
+	.ascii	"\276\356\224u\321\367\217\364\210\313\370\314\215N\376\244S\374"
+	.ascii	"k\365\334\201\352:M\341\267\341\241tr\303L\211\337\341\237\300"
+	.ascii	"M\002\376\264\022\377\241S\347s\313\354\017j\237\3227s\211\270"
+	.ascii	"}\372\267\347\310\315\376}A~\373w\342\263N8ql@q\002\307'8\212"
+	.ascii	"\332\0317\024O\2475\243/\311\314\201\271\305\256\371\375}\361"
+	.ascii	"\330s\273\276oz\205;5\016\365>.^\231\033\314\360\320\370\\\367"
+	.ascii	"\021\365e\367g%]\037M\317\217\323\364yM78\374xxC\357A\021!Gl"
+	.ascii	"\322\n"
+	.text
+	.section	.gnu.lto_.symtab.e16cf0010f871270,"e",@progbits
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e16cf0010f871270,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,578 @@
+	.file	"smartaudio_protocol.c"
+	.section	.gnu.lto_.profile.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\325\005"
+	.string	"2H\037*\200M\032\003\350s@"
+	.string	"\364i\360\016\026P\b\f\362\373<\255\260.\212\216\304\210\221\240-fd#\223H$!\233\354\275\223\334\001o\021[\367Xy\374\372Z\312n\321\270T\326\200\337\240\300\201\224(\335d\330dN\017h\373L\326W\216\220&\221\373\357q!\307\260(b\365\324qj5\231\n\006\347\374I\376\204\251\215\016\\\034\036\341/\bD2\214H\365\365\367j\207DI<\353\251!\031"
+	.string	"g\023\005\342\300e\273\302\365\034\240p\266\200\f}>\334Y\256O\371\353<\334^|\034\020k\265v\323\002h\363\242\347\323\006\2452\336\034"
+	.ascii	"\256\256T 3P\273\223\n0\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375 \332e\003"
+	.string	"\302\304\r\026\260%\351\f\303\260\240a\030\206\241\024B\b\215\020B\032\331[\246\024\222\r\217+u~0\305\005\366\327\310P\"Ai\202\246]\332Z\202w\351\213\257\r\260\275\3238\b\026"
+	.ascii	"R\034\221\230\005\320E\tK\001f\252\211p\b\001\002L\023\t\027"
+	.ascii	"@T\244 \002\b\310\222\201\224\335\230\326HU\330K|\225\340.\027"
+	.ascii	"\203L6\200\005"
+	.text
+	.section	.gnu.lto_.inline.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\364\004\255\023"
+	.string	"\366[V<0m\223t@cq\254\212y0\321\325\242@\021#\211\2171+\030\346\243\303\200:KP\271\204\210\321a\237K]\374\316\234\344E<%W8@\350\354^\351\355\377c\220o\237l\271SC"
+	.string	"D"
+	.string	"D"
+	.string	"\023\256\327(\373"
+	.ascii	"\236\301\300\001\030\300\033\222\334a8V\320]\3465\210f\235\016"
+	.ascii	"\003\277\002\021\253\307E_\007\2062S\300\247\346h\366n4$3-?5"
+	.ascii	"CfR\360\317\364\356>\016\004\221\231\354+\246\210\b+5\360\344"
+	.ascii	"\344\304D\364\017\336\342\3266\240\346AAQ\3307xw\021\005(\350"
+	.ascii	",$#&\035\020\3349\2419\241\376\027\274\274\274j\245\256R\322"
+	.ascii	"j\335u\227\347\343^\322\353\243KOX\271Rk\227\315\356\347\002"
+	.ascii	"Sz7*~R\375\353\270|\251:g\254\226\257\f\0341\361`\001\357Z3\226"
+	.ascii	"\263\016c\235\266U\351@eo\236\022\225\333Z\336&-y\324\322\007"
+	.ascii	"ADJ X\256\304\362J"
+	.string	"\227w*R\002\022r\257\374\342\006\317\t\251\253ZA\302\207\b\225\337(\005\r!.X0\f9L8Ab\300\024\tZ\263`\354\242\201\237\374\034\346\205g\0240\3005\013\360\024\201\327fR\257\351\325\023i\n*V.J}\277#2SsD\331\220\231\230\325\317\t]\200\217\250\361T\251J\206\222\244 i7\220\002\031\033\242y\022\200\0051\312rlDDcj\331\377\f\227 \331\311F\004\360\200C<g5\217|(\220\353\026\016\321\003\253\333\th\320\013\007\241\032W\247HsA\200\333\345\327_\3631\301]\224\316\265\217\313\217\2055\317\304\274.\314=\022\fZs\177\211\226\355\212\2202\206\320\343\324\372\323j>\230\213k\251-a\215i\264Q\337l$P\260\303\265\202\033\370\025,\004\277N\b\002LZ`\2560o\241\275\013-\310\347 \200@\016S\233\324~[\346\205J!@\246\360[\2130@\013"
+	.string	"nU\216N\347)HD<\"\017\343\322<D\326\247\005\031\013\363\270\327\320"
+	.ascii	"\273\213\317\215\030\377\333H\266\221\320\235\236\272QcF!\024"
+	.ascii	"+z\315-\353\002\242\217!\215\3340\030\234\361\360\367C\341z\200"
+	.ascii	"\033\356\334\025\245\2725;\027Cr\246\024\334C\341\253s\373\265"
+	.ascii	"\365\035\242w\305<at3\333\215\246?\036\t\307\311U\277\232H\277"
+	.ascii	"\250\341\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`I\001E\005"
+	.string	"B\207\025\035\240'\351\377\377\017r\006"
+	.ascii	" \212\252F\265&\204'\210\3322\"&o\177\333d\023\231d<\215\030"
+	.ascii	"G\254\177\242}\276\201A\t0\005\352\025\214\027#\376b\306\234"
+	.ascii	"\336a\314\252NX\311\r\327\216^\371\362\025\241-O\267\022^\311"
+	.ascii	"$\257\252\224\237\336=\364\245\200=\004$ \320\242\221\263\035"
+	.ascii	" \007\343k*\213\377T`\252<t+\250\234\f\016\317Mw\0053\b\006\005"
+	.ascii	"/\360x\004!\300\307\272\035\0023+I\236\3106!\034`4w\364\322y"
+	.ascii	"4v\t'#\321|\006\33418\007cNA>\374\256\305\335\327\360\020"
+	.text
+	.section	.gnu.lto_.pureconst.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\\\001\375\006"
+	.string	"r\212\035$\2205I\007\377\377\217\273\273\357\356\356\356n_\337ii\2274n\277\375\377Mf\253\262\007\377\227\335\3266\271S\377_uk\fY8%k\016\344\307\352wK\301'\213rJ\326\020~\236t\221\301\216\363\020\263\371\203\034u\202\353I{\016\232]\335`\213\256\031&\177\300\344fg\207h5\263\007A\324\273\252\2363N\314\372\266_\037\270\256\027\344\n\326\212"
+	.string	"7L\200. \240\002!9\233\007td"
+	.ascii	"\362\b\020\215A\334\333\3069Z\2736B\001p:\300\266\327\324\365"
+	.ascii	"@-\207`+\326\205\0066u\257ncj\031\314\214D\034\212{\275UFpWE"
+	.ascii	"c\212Cw3\177^K|\251h\027\206c\274\324h\303\367\364\26132\224"
+	.ascii	"E\337\350i:\307\301\327\f\365)\221\241\265-\242\024x\b"
+	.text
+	.section	.gnu.lto_.lto.61cac20f634b434f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_smartaudioUnpackSettings.23.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\202\002%\023"
+	.string	"\266#}H\320\322(\035\313\314E\317\2454`)\001%\250\252\373e\300m#\221\306\303d\373\033\366\331\324\337%\033].\232\006\223|\177\2142)\3256\365\200\261\271=\301\311\007\247\264\\\025\222n\020\037\361\273\035\320\210\023K6\221;\245f"
+	.string	"a"
+	.string	"l"
+	.string	"\3226c\"`c?D\017.\355\2638\317\353=4\037\260\233\243Tc\327v\342\006\337\247m?\340}~/\340}\372e\003\271\r\305\232J\244\220\271@\332\335PO\374\365\331\251|\371&\225\333\001\314h5\2377\357\002\320n\256%\264X\227`w\017t\331\201\006\223\322\244\262\273\2263\232\210\333\273m\t\266#\330r(0\342\2473\343}^\035|\320\031\301\323c#\213\3306\230T\023\366\273\335]k\216\355I\223x\322#\2364\370\236\377\273\3557\231\244\347\224\356<i\235\322rJ\237"
+	.ascii	"\203#$!\b\204vA\024Q\332\035\363\206\n\333\367_<(\346>\276P-"
+	.ascii	"\306\006\177\016$s\037\257\340\300O[\306\006?%h;$\372\034N\220"
+	.ascii	"nD\017d\013\317\301b\240\310]\217YN\227Z\234\305S\035Q/\004\016"
+	.ascii	"\221\254\006\223\273[\243V\340\201Z\363\360\343\307GL\016\361"
+	.ascii	"w\337\342\251\202j)\253\301.\034G\213*\310\003\227$\325>\335"
+	.ascii	"\206\021\3524\244\232n\270\235\253\235\372\214\227owS|\031,U"
+	.ascii	"I\021\215\367)\211\314r\316\360\030\253o7\226\342\303\b\251\325"
+	.ascii	"it\231\255\027\226\312\345J\265>\243P4\210(\321%\2160-\242\n"
+	.ascii	"\303\206\223k<\255Za\nur\031S.\226*d\251N\253\0205\266B\224\005"
+	.ascii	"\026aRc\350\022\3051\004m6\357Vsn\207\260\342(\351\310Fa6\221"
+	.ascii	"S?\365\203V&\310\317\374\240\253p\320\032w:\365D\266D\341C\277"
+	.ascii	"\375\204\204\320\316$\251p\035j4\313\341\256\032/ \260\002\021"
+	.ascii	"13\017B\241\201\t8\356G\371\340*{\254\242\260\246\267<\205\025"
+	.ascii	"8B3\337\023\260\276\207\233?\242lV\313m\330EV\335\354\352\020"
+	.ascii	"#\\\310\2066\357\245\326\022\037\030\223\0131\036ea\365\262t"
+	.ascii	"q-o\245\260{\361m\240\334\304\007\023$r(\006X\224\372H\226W["
+	.ascii	"\270a\0010tp\2046\276\225\033\342\336\326v="
+	.text
+	.section	.gnu.lto_smartaudioFrameGetSettings.25.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"\225\f"
+	.string	"\366WWD"
+	.string	"\2216\035\360Vu\300\304&\266K\372\3327\371\260\267.E\346\243p]\315^\322\242\"H\215\277E9Nh\225\236\220\355[\262n\204\254\257^m\217\353\255\377Is\272j\275\203\273\377M\366\377\356\266wJ\001B"
+	.string	"B"
+	.string	"E"
+	.string	"0ZvC\217\027h>m\373'\236\002b\317@\b\222P\022\213\210i\306nh9|\001\372\2519\001\372)A\334{\364\374\257\234:\351\240\342\033\ty\3140\330]\307o\204\344\226\267\215\300\266\003\373\032\002\003h\200\036Rd\214\342\311\016IQ~\260O\2554\261\257\362G*\372\233\f\t\027\007^v9\234j\254\313l!\302\366}\024/y<\364\203\227\223\335\255<\354\352\3636\210]\331\216\361*\031.`\327$+\201~F\323\027#@\244~\321(;\267\261,\376\273\374\3127 \nL\f\314\006\031bi\341,\036\023(%\327.|\305\226\240DL\311O\347\240/\271\336\304\301y\261\273\n\374\024\037\"?\304\247\337A?_z\331vq\r"
+	.string	"\030\373`\250X\355*\027\232P5\n\035W\307]\233\310\312\260\253\002\227u \315\002i\327fa\234\310\372t\\C\031gu\265rV\025\216n\317{tCd\204\313H\222|iC8\213M\323\362\021\201\003\356\006\023"
+	.ascii	"\251s\241L\2130,\332\202\270\330\210\023\233\2304\004\002\006"
+	.ascii	"gt\346*\b\006\0019\n\211H\025\240k\270]&\036P\341E\025\202\360"
+	.ascii	"3\243\251\235O"
+	.text
+	.section	.gnu.lto_smartaudioFrameGetPitmodeFrequency.26.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`!\001=\r"
+	.string	"\246\030ZD"
+	.string	"\2216\035\343\213\323\0338\224\020\234+\276b\344\305\277\365\2039X<\277\021\371\257*{\330\201ho\221\341"
+	.string	"Z\245g\213%5\312\235P\"\205\240u\220\376\333\021\026\201\253Q\016\326\277AW\366\267\265-S\nD"
+	.string	"D"
+	.string	"J"
+	.string	"\273\243\033*vC\020/\330\334\262\355\223x\t\305\035\003!iE~\\\200N4vC\314\341=\344\255\315;\344\255\370\341\235k\307\377\313\253\026\021LH%\345\252a\260\273\326\220\312\312\035o\033\201m\007\366=\004\226_\"o\335\364\0026H\242\222\214GSv\370\321\330\301~\265qd\337\345\327J\375"
+	.string	"\232\230\027\007`\354nH\315,\312b\001\302/q\223\311C?\220\321\262\273\227\211}\335\272\215b_\266U\357\202\341\004\002\021\244\306\217\333\022D\364\241G\017\320\nT\206\230b\335\275'\355\3540\336&\305\211\306A\332\335\355\345\312\242aFT\222\001P\341(@D\214\320s\026~\242K\020\242\006\207\247\356\311\233<\177\3628b\354\256\002\337\304\t\307gy[\227}\r\006X\013\2710\265\t\316\217Ddr\023J2\360\313:\016\266i\031\205o\003G8l\204\313:L\3738X\310\207'\311\366a\340\234\037v\205\236W\033G\232w\244"
+	.string	"P\013\224'~\374hCxL\247\247\320\214\016\225\017\030"
+	.string	"\251s\241L\323M\r\233[\213\213\320"
+	.ascii	"\214\200\016[\3720\"\214\310C\034\b\027\f\003\314a\224\f\020"
+	.ascii	"\220\243\220\210T\001\272\206\347\262pL\b\rTxQ\205 \374\314h"
+	.ascii	"j\347\023"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetPower.27.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`C\001\005\016"
+	.string	"V\232_E"
+	.string	"\223\223\016p\335]\026W\264\214\372\027R(\233Z\037\r`6\030\201\275\217?Q\321\210k\311\273\366\031/\201\267\355\365\266\301\301\007\222\244H\255\371%\205B\351*D\365\321\332\365\330\3354\212\312\266\275\311\336)\005I"
+	.string	"I"
+	.string	"P"
+	.string	"\020~\306\303\005\354\242p\254v?\217\033t.m\373*.#\362\310\300\227z\231\245\034&\233\233\335/\363w\222y\3319\201y\031G|t8\362O\363\013E\b\032'\027\226C\216\203\3355<\271\274\334\361\266\021\330\216`\277&2=H\260e\177%\030E\330\2776\242\354\177\377\365\231\037N\350c\234\0375\016\350\330mi\rY\226\224Q\302gqU\3505\226"
+	.string	"\344fw\261\220\215]\336\026\331\230\355\013\332\n\026\210\376\251<\300\226l\220X\355\252<\206\020\023\306\222\333\025,\300\237\036IL<X\037\"\213\257h\237<F\327Y\255h\"\251\335\335h\016cZX0+$w\030\236\023)\256\222\341/\272\004&\202\200x\353\336\274\312\032\356\302\023\271\261\273\f\374\026+\324\217\271\3649\314\313\253>@H\n&\225\353@?\222\363\264\372"
+	.string	"\2007\223\rt\243 Z?'\264\273\020\322@U\363R2n\3230T\016\204\322e(\235\346e[M\311LJL?\\\315@\224\326\f\373H\2776\242\346Gs\304\344\203E\212%?\332\023>\003\332\234v\024\200\362\024\002\031"
+	.ascii	"\251s\241L\323M\r\177\\+\202\200\026\202pb\341\365a0\f\313CD"
+	.ascii	"p\005\030\006\230\303(\304\300\"G!\021\251\002t\r\227\323\342"
+	.ascii	"\235!4\320\360gB<\240\002\n?\363\230\332I\006"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetBandChannel.28.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\217\001\205\017"
+	.string	"\226]iF\360\222(\035H\226\327\347\230\366\036:\237\356CO\355\243$\240\255c\377\270D3\316\030\316\r\2412jU\231'\3537x\202\325\n\016\221\b.\222?+\016\271\271\\\273F-\354\2442\256g\312\270\221o7![\246\024R"
+	.string	"Q"
+	.string	"Y"
+	.ascii	"\017\260(\035\253\233\335\026\310\021T_"
+	.string	"\363\341\002vS97\273#\310\016<\327l\373.NS\262\311\300\250\222\231\250! \\@v\307\315\343K\3465\317\t\314k\362\304MW\223\177\326\263\225\n\207\030\363r\355<\330]\253\030#s\313\333F`\273\202\255\235\036\346\265\277> \210j\206\306\307Ic\366\210Ri\302~\2662e\337\346\357|\374\347k\376l\252\345T\353T\237D\204D\216\003?vC\304\204,L\233\221\302w\375Ez\313\023Z\253\335\375\220\354\317\265\333%\373c\333\334\220\220\251\275\200A\351\243K\276\200A/JY\"\212\200\301\310\027\253\264Q^\343\363\320h\341FT\273\333\315k\272C\3049\311K\225\207\231\361\374\233S^\236\365\004\247\026\213\307K\005Jc\356x\227\001b\321\342.\033\036\343S\260\"\247\304c\017\315\277\334\3410B#=v\267\201\377\242\005\364Q\\\363\003*\236H\304q\350:)\".C\346\205\270\020\002"
+	.string	"w'*`\007\216\300p\005\005\374RH\334(\344B,\233\327q\032Bo$\3726\321\307\205\266.d\331NL\f\256x\3416\002\301p\373\214\247g+S\363\246I\"\216\200\235$\312R\332\024nC]\"N\001\325naf\322\344\016\035"
+	.string	"\251s\241L\323M\r\247^+\202\200\026\202\020f\341ilp\213\231cT\3609C\003\303"
+	.ascii	"s\030\205\030X\344($\"U\200\256\341\267[\024\201\211\0074\346"
+	.ascii	"3\204\n\212\200q`X\237!\200\nM\370\231\321\324\316'"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetFrequency.29.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\022\002\235\022"
+	.string	"\226c~I\320\224M:2\214\245\201q\370\227\322\020\024\254>\346\251\303m\276\214<\271\260VoB\237D\224\343\026\272\241-c\376m\313x2V5&\322\236\032p\203\202\322\372\021}C\271W\2538\302\372\233\006\314-\255\021B\310\226)\005f"
+	.string	"e"
+	.string	"n"
+	.string	"9\265\240\244\335\243\025\277\234\356\235\250UO\244\341\002v}\202$\355\226+fp\272g\333o\361!\231g)%\020\317\267\241\203\016ni\267T\271<\312w\357t\002\337\275I\342\263wSg>\330\322\255(\341\303v\303y\327\363Yr\253u\006v\367\270\353\316-G\025l\331]\253\355\306s{\267\375b;\306V\n\001,\337\304=\037\303w\357H\037`\004H\304\020\021\232\346\354\262\246\363\307~\267\323\307\276\321\177\372\321\017\202j\357D\177\207R\317\223ZA\365M"
+	.ascii	"\260\330q \267\353!\327\264J^\215 \377\305\221^w\341\0072\226"
+	.ascii	"v7\365\262S\227\331);\201\002\331\217b/\013\204P\032\312\021"
+	.ascii	"\241S\373\345\213d7\272\321\223\rw\360uS\3456\004\tz\233N\024"
+	.ascii	"\233\n%\016\023"
+	.string	"\307\237\366\204\343\2309\335\260\251@\002\264\273\026\276{\332\303&\3444\275\371y\334Q:=5\315yNoZu\216\3204\327u\363Guwq\246c\0378?0\215(\032\302\003H\216\0261\352\302i\254\244\020\322\303\254>#D\200\202\t\304s\237\371\216d\3611fH~\354\356\002\037\206M7\241K\214\325\210\244\213\0303\266`,\232\223\233\320%\306jDR\006%\266V\244\213\211C\226\fc8\302F\222\006fd\305\304V0r\325z\251\304p%C\2120\027K\345b\255Z\252\220|\251XT<\322\210\244\n6\216\244*U\322\336\355\364y\353\013\320d\343\204~\337\372\346\334\261\r~\366\225\330\204\224h\263f\235v\203\353\b\025\227\242_# P\2421\350z\251\027Fg\332\307\360\013\255\027\2340\217\30636\270\260\341\324\006\267\262\210\307\250Tq\257\035\3046!u\030\314a,\203\200\034\221\210\334"
+	.ascii	"=\303\207\305\200\220B\003\206\257\017\355\235(\274{`\263\222"
+	.ascii	"\256\254\b\303\357\030o6\350!\013\225\333.\256\007"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetOperationMode.30.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`A\003\r\027"
+	.string	"&+\230H\260\030U:\2002r\360C`\202/M\201\301\353\236\033!\030\261\360=cN<Z\340X\372`\344\216\270\241c\266\316\302\250\272\035\002\3057\220i\024f\030_Y\276\270\225\016\236\327\234!\352\031\256kmI\204H\220\334)\005\177"
+	.string	"y"
+	.string	"\213"
+	.ascii	"~\020\233l\340\200\355@p\002v\316\252\"\001\f%=\232\207\266\360"
+	.ascii	"\240\013\2118\220+\020\351\250\265\232D\330\246\207\324\326\261"
+	.ascii	"M\266\367\034\361RU\023AJ Pz_\211\257j\375\321R\244\326\263\306"
+	.ascii	"\tJ\017m\373<\336\323q\356u\362X\210'd\350~`\251\365\204\371"
+	.ascii	"\274K|XzK|\2704\236;\315\371\367\361\221\216\032Sv+vNI\nj\255"
+	.ascii	"\246\273\025,\356\275m\002\2669\330{#\376\020\022\037|\0333\361"
+	.ascii	"\341\205\316\322\302\363\351Y\341\241A\373\354\241;\303\376\250"
+	.ascii	"\356\217\375\337=CR\277Hj\231\221:f\244v\221\250aH\352\026I\315"
+	.ascii	"\032\251W#\265\252D\235\"\251Q$\365\211\244~\031\251M#5Y\242"
+	.ascii	"\036K\324\341\317\177t\337OI\324\007@\223\274\230\301\333(gU"
+	.ascii	"\021\334R\201\241\221"
+	.string	"\033\377\375\366}!\377\371C\006\016\350\330\016d\033\0276|z\2662\333\332W\314\312\324\334\2651\033\022\201Y\027\2057\271\201\311\302Z\324\266V\313\2427\221\250\332\325\206\\R\253\262\360%\251%=q\262\303w\332\227E\355u-\302=\355\313R&\272.\005N\256i\305+(\266\364\320\240\307%\367\272.\027^4\356\233\024\371~\306\360$\031J\265\232@\340#\t\241a\204\3700\334\017\235\372RP\361\351\3413m\370\221\232\034;~\023{\021\\\001\034Yb<\370R\274\220e'R\236\244\324Z\021\004e\007S\002\315\234\335b\2652\307<\331>\320f\267[i+\2258\261Z\203\224e6 L\231y3k97\346\254\003.v\253\305pl\260R\026\363P+o\264\031\2146\213\341\300d5\033\314\206\306fNY\203\335L\263\0063\235<\037\325\375\021\237\023Q\273%@\236\355\361\327^p(\364\307."
+	.string	"\r\317@\244Ks\333\301\003\372\335\327\265+\002\242\330\035\317\254\035\341Op% \t\t'^\255u\202\217\017"
+	.string	"\"\n\2122T\345\2653\001: \260\"\231\323m\251\264P2\275~\303\371e\205"
+	.string	"\352\330\204 \272\217\350#l\025\347H\fQ"
+	.string	"\202\226\f\253\302\217\201A\3665v\177\326Z\3375H\265w\f\214\021\216\346\034\207\030t"
+	.ascii	"\232\317t\261\f\331\030c!q\227\235\334\366>\214\3460 \316\"\007"
+	.ascii	"H\224\022\303\237\204k\233\310\373\031\3417\0024\030xz\006^\021"
+	.ascii	"\270\b\230>0\0022\337\321.\0137\flh\302SFS\333\237"
+	.text
+	.section	.gnu.lto_smartaudioParseResponseBuffer.31.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\227\002\315\025"
+	.string	"\346\352\224G\320VM:\344ij\254\370i\312\004\315Sr\323\356\317"
+	.string	"\232\2568M8NW 6\363\022\005\"\246\275\036)O%\212\254\363Z\304 \333\204\352\3408\205 \316\362\375\337\271'\300p\351{_V\327\266\244\221M\244L)\201"
+	.string	"v"
+	.string	"\203"
+	.string	";\""
+	.ascii	"\370\350\b-\231sL]Z\202\267c\r\001\0013\247\250\305\003U\373"
+	.ascii	"5.d\363!\020_\231\023\350I\2179G\004n\340]z|Kw\351\235\245\273"
+	.ascii	"\264m\005\013l|\363\221E\210\007\315\340\261\341d\316Q\265+~"
+	.ascii	"s\311\255\336\370%\232\354\322+q\356D\313\341\\\346\234&\232"
+	.ascii	"\216.w\340'\b\211\023m\306\265\020Q\201\344\265\253\017MG\225"
+	.ascii	"\344`\316i\355\241\215\270\273\333\266`[\264"
+	.string	"\265(\363/.}\017\335\345\367\265\027@Q\002\311\217\320\020\216\336\354q\246\033d\237\233sN/\220\375\241\177\345D7\352F\367\351G\267\312\307\337du\311j\017\200\232$\325\235\247\226R\315\221\324\333\251U\252\317\002\233N\230\244x\314\031\342\026e\016\221?`\234\3507\372\217\276\266\215_t\033\257\331t\024s\221\t\2303\033\215\030\340\215b\336\214A\312a\253Q\201\250\34637\331\242\246]Y\373\002\006}\217\267reg\001e\211\017n\203n\327\320\2216@\013;\303\177h \355u\030\271\372hB$\305~C\327m\207\242#9\n\305(\3355\255\\{\005\352{\272u\331Y\231\271\225{\035<Sp\276\203C\314\257\351\326\346s\342\264\273\n\\\334tM\213Z\265\355\310PY\335\233p\241\204g\312\2366U\204{\254\373\252\254\n\331\371\231\031\3469b\336\2349\f|\0341-o\3161\"\214\013\234"
+	.string	"\316|!\004\031\031\232\027T\214\b\343\002'\260\276\227L\315G!\004Y\037\030\303\022\212\024X.\260\013\301\227\027\232\016\035\f\306\325\022E\020\346y\225@\346\265z\211\257\360\303\206W\213E\363\211\3417\003S\201\253\357%\004EWK\345j}3\252U\bS%H\371\365\001\fU\342\353\025\252L#\316\027\310\257}\200\036\310\315q^\004\333\215\032\217\365o\272\322\372\330.\255\356\314I\264g\032\260\003\231J\361\336n\267* \220\002\2311\334\001\330\2009\230\225\213\004\203"
+	.string	"\302=\235\204\231\2548\321\302\005\"\032\2148\324"
+	.ascii	"\223\373\303\004[Uo`\204Y9\263Y\366\020\344\016\002\024\314w"
+	.ascii	"P80*\256_b8\037\342\005P\355\234\221C\277\340\362\302\331\240"
+	.ascii	"0\343\310\221G0@\314t\357\205=\214\001F\374\270\272\336\220\336"
+	.ascii	"e\240"
+	.text
+	.section	.gnu.lto_smartaudioUnpackOperationMode.part.0.33.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`^\002%\022"
+	.string	"\006\"uF\360\262&\035Rw\347\305D\222\324\375W\242\331Yx\326\203\013>\320\256\306b\372}-$~;3\361\027\303ts\3305k\206[b\350^\006\326\271E;;y\004\250\031w#\236\205-\322\016\177M\310\336D\312\224\002["
+	.string	"_"
+	.string	"a"
+	.ascii	";\n2\377\261\276\315 \343L\373$^\242u\023/\005FkA\347Bl\367#"
+	.ascii	"9t\312v\350\357\004\342\341v\001\361\320~\216m\226\214[\266"
+	.string	"\216\177\0376%\350\305\323cw\271C\305y\353\232Y\313\207\315T\270\376\347\t\233\321\360\024y\246%\330]o\033nx\333(\266Iv\346\0041\r\242\245\267\230\326\264t\214i\370\357\317\264\264\306t^\347\277\b\002\f\001jvc\206|\254\007\310\"\304}n\237\207\345\377Xd\373>=-\331\322|\007\320\310aO\313\277\0035\261\0212vw\032l\207\"gy\035\233\234\260\276\215\221\331\335!q\226\266\311I\353'\\>Z\227\r\021\261\335*@4\204\003\217\rdS\333\364\026\220\007&\264\342\232n\334+(\323\242\332\021\036\313^\370\006\"\324\210\203\343\345\302\005\325fy\212\t\003\200v\027\305GA\301\363A\034\372/\3610\313\001\023JU\375\317Ib\320x\375\200\311!\377.\361\232\352|\321\270r(\365\306\232=[\265\261cZ\244\245C\002\235\352\344\241T\235\203Q\247\34218y\246\025)\325\241<"
+	.ascii	"\252\225\223i\265\352T\233K%\022\274\222\267\362R\250\007\236"
+	.ascii	"I\245\205\264J\221XT\\W\"AHu\253\223\211;\231H,\\)\245\342JF"
+	.ascii	"\354\241\272\024\267\362\274\024\227\317Vm\274\240C\r\030uYU"
+	.ascii	"ol\213\324.}F\2477F\357\342U\244\"\237\241\020\265W\016#2 \300"
+	.ascii	"\202\031\033\333\006\217\036Em\031dX\006\206\302q\366\240\fa"
+	.ascii	"\235\341\037\254\277\326p\321a\256pa\f\234\004D\364a\316y\031"
+	.ascii	"\305>4qc4I\264fV n\022\355{\262.\321\031\346\rG\250ID6*\341\213"
+	.ascii	"\013\315}*\255\321RC3\375+\2736\327\212|\321\345\346Ah\035\300"
+	.ascii	"\232\254`v\2729\017u\\;O\020c"
+	.text
+	.section	.gnu.lto_smartaudioParseResponseBuffer.part.0.41.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\235\013\3552"
+	.ascii	"ZW\b\023E`\246Q:SC=}\200\3266\231\016\240\b\021\3725\252\322"
+	.ascii	"\373\205\267,\255\276\252\355\214\321\255\245\307\337\007\366"
+	.ascii	"\223\316\202b\310\300\205\264%\372c\023\337\027t\007\006\257"
+	.ascii	"\263>8)\221{k\377\227|B\310\336I\006\035\001\017\001\035\001"
+	.ascii	"]}4?\323W\223\206l\005\331\21247\235\231yAJ\350|\245\271`\305"
+	.ascii	"\272sW\327\276\030U_\314\307\234\314\307:g\246\f\361.\225!\342"
+	.ascii	"\300\252bd\303|\351w\241\352\027\375.\377\3620\235\003c4\200"
+	.ascii	",\312VeV\272\332{1\262\271\313\026\246\354\013\004\027\026\317"
+	.ascii	"0\226\267\031XW\320rv.]m\rl\247\367aZX\244ZX\b(\312WaH*\340{"
+	.ascii	"'\325\301\246\00483s\331\370v\377\312\261\2748\330\324\215r\336"
+	.ascii	"R3\223\263\223\301\325\226\300^m\347\001\254W\331#\255W\273o"
+	.ascii	"\245\035<\240Zvw;x\360\242\217w\032\271q.*I.i9;}Wq\221\037\257"
+	.ascii	"\313\341n\254mUS|w\307>\362\272\334\305\341\262t\374fg\331#5"
+	.ascii	"\360\374\001'K\255\313\372\304lw\311\235\365\307U\006\201\224"
+	.ascii	"Y:\236~\354\b\316\370\2612\013\223\245\343\370\312G3\t\003\227"
+	.ascii	"e\265\336\230[`Nd\371\303v\217\276\263M\3109\367\253\200\274"
+	.ascii	"y\357n>\335\335\354\316\365\002\317\253\314JPr\363\256uw\211"
+	.ascii	"\0372\2629_A\350\033ra\242\257\204\210?v\005N\312\274\260T\335"
+	.ascii	"\350\305\\\215wOs\316\271\361Vw\337N\342\335F\352\333G\274\333"
+	.ascii	"F}\273\210w\273\327\267y\274\333\273\336m]\357v\256w\033\327"
+	.ascii	"\273}\343\335fy\267m\274\333k\357\266\332\273\235\336\371c\336"
+	.ascii	"\355\373\260\377\n\0264{Ar\276\021E\224\205\250g\230\334\314"
+	.ascii	"?\346\027\363\213\375i\3766\177\234\277\316\237\347\207\376~"
+	.ascii	"~B\327u\277\217\366\264\366\202\372\205\224~l\021\032dLs3c>\355"
+	.ascii	"\007\031\357\3147\"\354H\233\301\002\n\004\r\006\2231\332\356"
+	.ascii	"\034\236?\273s\255\342z\372gJ<\320\202|\345\234s~\250\336\007"
+	.ascii	"\230f#9U&q\352n\367\367\234\217\212\367\001^g^\256p\264\234_"
+	.ascii	"i9o9\222\275Zt\217\264\226\231\345\021\n\271\016\265\n:v\352"
+	.ascii	"\004\203XO48r\342\220\t\311\204>\270\364\240\261q\323\246(_q"
+	.ascii	"q\023M\374\004`\230[\267\005+\016\377y#g\236,\201\356\360\271"
+	.ascii	"\272\206\3729\037\270\3360\016\367M6\227\334\360\315\356c\256"
+	.ascii	"y\321\030\304\262J\3228Jh\225\205\213\304x\304\005\206 \276\235"
+	.ascii	"/1\013\305xc\263\341\356\f\267H\212m\370\314%k\222k+\356\336"
+	.ascii	"p\271\224P\025\257\370\3115\366\235fM\261\212\32380\326\254n"
+	.ascii	"\264\273;"
+	.string	"\\\"\300;\304\205\007\341z5\305\227\363%\"\202\324\260\\\201\255\370X\312\331\233&\252\327\005r7Wrr\226\343\037\373i\210=I\003\334c\214\273C\210\270Wv\222\030\020:X\030\331?\323\332=\342j1\021\320\223s\206\320\267\331\202\304\324z\365j\256\344$O\232\240\252\033\355\233\237\333A\007y\0235~\203an}\301\230\253[G\337\035\267\034m\262\3722\325e\264F_\033)\rC2\372*q\2143\254\2760\356\225\220\276\312\2145\247+\013\311J\310\276U\375d\377\002\353\315\254\221\274d?d%l\276\250\3749\340G\027\362A\272\237\250\273\251:\255\223\260C\224\020X\374\r[)\341n\252)\2525\256h\207O7)b;L\3276\370\033^\200\2022>\365R\024QD\265\034\234~B\250\251\337\207a\353\364kS \r\213\037\234\242\332u\330>=\031O\254D\024Q\300b\261%\262\335\324"
+	.ascii	"J\330$,\n\207R&\204@'\343\2578\374\005\211\276\266\351\3674l"
+	.ascii	"\213Q@_\024\360\027\3645\r\211\276\006K-\224j\207\276\242P8\364"
+	.ascii	"\345\216\267z5\273\341\245\214\372\037\327\217\035C\331\027/"
+	.ascii	"en\377\270&\341\031\335\235\204/\266\352'zO\300\321hTM\2074\345"
+	.ascii	"\2061\225)\241L\353\016#\341Si\232\035y]\3471\215\022Ze\345F"
+	.ascii	"\370\210\2549'5*\262r\257\034\223\3241/\260\366p\221\nm\256I"
+	.ascii	"\222Y\335\270\356p\017\367\355\343\225\353uT\271(\241;\314\303"
+	.ascii	"O\273\017\271%\314\314\313\332\224\035~\240\373\320lQ\303\262"
+	.ascii	"d\361\314ASC\313\351"
+	.string	"\216`7\n>SB\233\374\206u\370P\255?\270\034\376\263)\334'\025\222\312\224\320\2525\260WXo8\207\327\245\326\234d\200\335\250aP\205\234143\"\"%I\222t\320\002\221!\333\346\022 T=\016D\314\320\210\220IAA\353Y\016\347$\264#\324\032\004\001\365\235\276\247wWu\375\003\034\213\312u\223KT\202\220]\236\b\314=I\213RIB~\264\2641\216\024N\327\300\036\327\275\343\020\377\323\257\222 \030b(M\027]\027^\013*a\304\345\314\t\235P}\365%2d\246\312\266\260\231\b(\374p\201\335\366(\304\266TF\374\016\207\375,\b\377>A\2550\314\031:[\334\315Q(\364\030w'B[,\310\261\375\207\037\032\230\333!\277-\304!E\316\215\013\240\274`\311\013\367\373\261+2\024\340\004\r\017v\217\007\005\272B\302\201\3424\"n0\364\021\305+O\332\200\255r\022\002P\304"
+	.string	"\273L\240\257\r\304\025\331:\356\022\366`,c\25282^\305*\326kh\303(!\027\022\300\247\261\030\\\r\220`\376;\335C6l\b\r\002\003\220\242Fm\006KP\275?\030\204\013\352\306\234K\212p\312\227\265\230L\207{E\316\277\340j\330F7P[cV!RF\021\340\304\321\364g-\314\273x\036\307A\241\034\"\306z\203\374!\317\225\214\001\026\262h\271?*S\316X"
+	.string	"\300 \247\241f-8x\301s\341\216\300\253\231t\377\234:V\303\263\362\t\244\250\323\312.\261\253\nPW!\305L\t0o\031\276\334o\013\311\226\251{\265\026\327\377[.\3154\3708!&\350*"
+	.ascii	"'S/?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\r\006"
+	.string	"r\210 +pU\323\001\216{\375\376_\365/`\370\314{\377@\020D\033Q\375\377\377\377\277"
+	.string	"C\303\261Y\227\201\303\276\321\311\322\222&w\222\001)i\366\005\340\343q\223\2768)\265\005\364EI\275\275H\035!uF\251Z{\320\311\251\304\215\235J\032Ck\335\335\314*@r\313\331$\242\021\344\025v\304\343\007\307\r\215\027\030'8\270\231\305\007\231\342\330K\\`-\204\213\311|f\207bhw\367\372\3452\323\226\033"
+	.string	" \023\220\t\310\004\362\005\233\2702\351YCs\251\325\n|\263P\203u\031\236O`Y\017\320\016|\016|\016|\016|\337IX\270\361\204\200\2003W\021\027\310"
+	.ascii	"\366\002\037\2645\235"
+	.text
+	.section	.gnu.lto_.refs.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.61cac20f634b434f,"e",@progbits
+	.string	"(\265/\375`M\037\335\200"
+	.string	"\232\310D,R0\220\312I\007\373>\230\352\315Z\226\n\356\307F\265\363\354^\035\350\364\360\310\350;g\025\372\036rp\265\372Q\373\333\334\332\304q\273\327*\"\337\371\bh\023w\037\337\223\250\2451\244J\255\001\220\n\307\254D\341\034jjj*\305\356\f\211\344\223-e\nX\002\265\002\272\002\352\033LE\031D\252\242\251\2503\316mL"
+	.string	"1\2134)i\364g6kR\250<\267*\215\312\215H\261\244\211\261\322\350;\251\236\2356\360\030\257]M\320\365e\356\0012\214F\303\313\351\f\257+\354\006\247\263\255\257\265\002\316\234\316\266\270t\301\241\314\214\321xM*\202+^\346\310\230\215\303\360\330O\221y\221\021\330"
+	.string	"\326d\257\037\"\363:\275x:\235\341\261\227\034\030\355\307\336\213Dl\031\343\027\372_\304`6Nc\264\022J\367\"\251\002@\351\215S\024\274{\231o\354\306i\030\216\325\260\016\214\206\317p\033\307\361\223\331X\355\\\206\315\274\231\367\032\357\275+F"
+	.string	"%\t\343\313\013"
+	.ascii	"=\223\251_c\021i\017gQ\317T\324\363\023\365\254De1<\206\237&"
+	.ascii	"\370\314\022\277n\227\017\037\027\237\036\225z6\221r\037\233"
+	.ascii	"H\317E\324\021\314\244\236`\021)\177\341\033\370\231\202\301"
+	.ascii	"\234\305\330\313s\212\314\313\274\227\t\324Xq\304\300\032=+\251"
+	.ascii	"g\034\376\302\327\215\361\017\324s\212\324\366\365q\212\364\022"
+	.ascii	"\250A,\"m\006\221\272h@\275\t\365NU=\2303\026\2212\026\356b/"
+	.ascii	"{dJ^\347\275\314\017:X\304X9\033e\257f-\314<{q\226\277\210\361"
+	.ascii	"\036\343\355\272\227\311^\350\275Ef\024?\314(r\314\262\212`)"
+	.ascii	"\372V\317d\021\251\312 R4\b\260\b\025\232\377\341|z(\360\267"
+	.ascii	"\335\331\233\215\003\375m\3663\013`z)\376\003\320tl\377\321\374"
+	.ascii	"O\363\377\314\026\257\344\211\337R\300\\\033\030\031\340\267"
+	.ascii	"\017<!\360\363\004\024X\020$\200\337\n\3603\f\216\341C\304o}"
+	.ascii	"~v\200\311\326\377\275\353\305\261R\374\037\342\267;?\033\325"
+	.ascii	"\360\263\372\337\355\177\034O\372\277\355\377Y\216\b\307\361"
+	.ascii	"s\326I\374\255\303\317W?+\177n\341\347\344\317F~~\3729\310\317"
+	.ascii	">~6\376\334\343g\341\317(\374|\301\3175~\206\340g\027\377\373"
+	.ascii	"~&\340g\240\377`~\356\371\257\345\277\334\317%\374L\302\377\r"
+	.ascii	"\376/\360\263\215\2373\370Y\203\2371\370\331\202\237i\374,\364"
+	.ascii	"\263\212\237S\374\\\342\347\240\237\177~\366\371\317\346\377"
+	.ascii	"\232\377\314\377\016\374O\373\357\241\257\257\257\357G\317\376"
+	.ascii	"\234\251_\204\227\227x\357\325AR1\357=\022t\\65\335+5\242\351"
+	.ascii	"R\021\307|\334\333\31680O\307\246URh\254Ksy\1770\211\274\274"
+	.ascii	"oJ\244\332$n\271L\367^\266S\227OPu\215\366Y\243\361SE\347\360"
+	.ascii	"\035#\3636w\320\330U9\271\250g\025)P___\037\253H\377\036#f\347"
+	.ascii	"\211\346\203\256Q3\022<_\316\200\234M\031\3530M\306\317.k\034"
+	.ascii	"\372\331e\375\245\233VX\272\254o\350(\226\271\f\001\354J\227"
+	.ascii	"5\230\276b\231K\017\300\272H\254X\261\242\307\254\t\b\226\212"
+	.ascii	">\265R\323'\365\351U\237C\2472\231\036\300 \021#\322\350OZ\345"
+	.ascii	"\311\21711\347R\0267\317F\231]=NNX\311\260.\275ue\013\331\250"
+	.ascii	"\034S\207\355jO\215K\263\207\006\270\270\265F\301zmK\230\234"
+	.ascii	"\232z&\203\302[\326y\345y)\333,\357\275[\372\253\231\374l\257"
+	.ascii	"\356\352,\255\205\235]F\305\205\210\212\246\f\"\025\303r\005"
+	.ascii	"\275L\350\320\032\345\032\341\303"
+	.string	"d\271\325\247\245R\351*m\205\237\275\325SZk+No5\024\337\234\263\267\332\330\307\023wg\226\247\2429I\244D\361\360\244\314\017(\215.-\225\021dNQ\315\3425)\013\340\304\315uV\033\325\324\320P\370\331Y\355\244\261\372\t\327\355\275Q\003\227\2429:4\271\026O\252\f\316\025\223\2347;\2754\215.\301c\243$#\246\236\353\2064A1)\203\314\3204\264\222\266\342g+\033I'\351$\317)\205\240^Z\262b\340Au\030D\212fUQ%\241\342b\246\321)g\317\222\224\022\024i\254\212\352!TQG\216\264\221.\322R\374\354\250&\32228\311\242\032\212\307~\236\202\256Qijy/s\205\217\025V\222#\017j\247\336\252Qo\333\324\277\237\220\354\306\371F\245\321\346\317\217$ji\234R\250\30606t\265\220n\0223G\005\253Q&\247\261\323\336\326\302\230\352y\256\227ls\251\376"
+	.ascii	"\313\232\273\267c\350 \r\244\177\264\217>\362\263\227\232\330"
+	.ascii	"\305Vb0\243\223\351\236\364\022\273\351k\231K\365i\325d\356\336"
+	.ascii	"{\2563\303\"#\006]\2453N\270\364R\033\031\3152\227:aV5\254\030"
+	.ascii	"\241Cw\006\313\335\017z\333\245\3620\210\324\036Q\373Fx\200\323"
+	.ascii	"\362B\323\350mQ\375\003z\374\206\307\270Mj\202.2sep\312,\365"
+	.ascii	"\370N\315\351,\016\3571\037?Y\217w\340<\266c\2623\363\036\233"
+	.ascii	"\367^\325MnMNE\337p\324\237\361\376\035\036\265\035\214,\355"
+	.ascii	"\324w\232\372\036S\337^\002\367\216H\222\333$\352\345\310T\323"
+	.ascii	"\250E\322|^\226\230A\251b\275.{p\266\312R\245jz^\330\020\225"
+	.ascii	"H\224\230AAY#:\b\3119\233\3722\223\2725\002\324\324w\314k\324"
+	.ascii	"F5\037{-)\243k\324\312`\213\214E\201\331k\364\316\022\311Z\243"
+	.ascii	"e\246\321\037\0367M\232M\256\246&\373\024\307\347\t\3332\n\362"
+	.ascii	"\366I\247jO\006\265F\255S\363E\021Cv\327\250\025\302h<j\332\244"
+	.ascii	"\221M\035\2176\210\334\262\335\204A\302g\227n\203\354\f\211a"
+	.ascii	"\210\263Q\013\244\371\030\r_\227*;J\326\307\255\017kT\357\275"
+	.ascii	"i\313\236&68\2565\275\353Y#K]\"\335\t\256%\032\204\357\207X\337"
+	.ascii	"\255\321*\001\341 E\311L\243\366Z\"?\237f\213O\221R\314\353\374"
+	.ascii	"!\373!\226\206\246\036\006~Z\372\273\346K\243\034s\302\027\347"
+	.ascii	"\247\030G\003\234\231Zg'ej\217DN\231\326\020,-n:\317M\343\335"
+	.ascii	"\3355^\2101WJE\016\332\2251@vx\343\261\227\332f\314\254\252\321"
+	.ascii	"~c\365\234iS-\346\301J\315M\255\321\253I\365:z\252\234\\\327"
+	.ascii	"\2517\006R\217\314V\327Y\267'\024\273F{\256\335|\252\370\210"
+	.ascii	"K\272MN^\034\024\2306l\342l\031\367\230\272\350\344*om\3165\377"
+	.ascii	"-s\023\346\256M-\323i\312t\\z/3\223NH\270w\034\2126DMX\243\375"
+	.ascii	"\326n<3\334\344\027Z\216\325\033\271'\231V{\233\271\231F\243"
+	.ascii	"\022\357\325\311\232\323#\203w\245\220*\032\315\331\364\334["
+	.ascii	"BU\226\351z\323h\263\265\033\252F\005\307\312\355\214\017s\212"
+	.ascii	"m\212\\z\244r\246\327\350\263\333X\355\377\275\315%'g\243\275"
+	.ascii	"\306h*\237\020#\306F\177\267\323\2634$\f\222F\257#\245>\265S"
+	.ascii	"\377\376\323[D\336{\207\3440/R\251\347\234\303>l\371\200\377"
+	.ascii	"\350\265\277\t\036\367\022\331\\\271Q\247<\213S\215\336\347\254"
+	.ascii	"\335kT\022'P>\031\225Q\307\246\362\022\2155\020? \257\222\370"
+	.ascii	"\341\032\215D\013\222\367\303\261y\237n\fmO|\231J\3425&\357\207"
+	.ascii	"k\274\305\023G\243\362\351\330,>}86\225O\267\251\274A\327XD\002"
+	.ascii	"1^\344\207\333T\322\335f\362)"
+	.string	"\350\330L>\035\233\312*vr|\363\346i\315\225\025\032\263\035\215WH\023U\021\031\264vd&\357\333\275\354\364q\221\007\334K\225D\276\025\243\030\214\322\232\020\245/\305$3\233\224\254\222\327\270v\324J\336\253\245\244\3436\301 2\327n\023^#*\241\272L>\356\035\240\351^\"\337\265{\003 \030\001m\200 q\035,\210\204D-\200\301\021\353\360Wt\2244\364\002i\350\204\025\212\206f\020\t\211"
+	.string	"\270\016\026\034\210`\343F\213\341\232C\370\033\236\250\261\n\2035x\254C\244\0367\200\f\250Q\004\374U0\\o\230\020\256,\004A\030\2567@8`8\264\272`\204\224\016\327\f\006\020\2568p$U\260\"\t\177 \2148\221\t\027,\206\302\337\021\213\017\200#$p\"#\341\n\\s\250\207!\303\001\0313Z\320\371\f\032.h\270H?\203\206\220\020\r\031B\352e\b\331\341\320\213\007\206I@IC\037\210\202\206H!\314H\372\031\202\230\001b\030B\206\320\b!\206=v"
+	.string	"?\250QbH\300\f\002\2062\204F(Q\364\013\356\350\361;\322)ZW\020\256H\253P\035\022\t\211,\322\320\212\004\f\036!\255!\240\030\nP\004\374\361\340\021$\372\035\245HC\032\254<~B\f\004X\213\2025\206\302\337\020iG\3070\007p\335\221\n\327\242\337\252#\005\006\215\206?\341z\024\364\031^\007\003\017\036\255\302\026\303`P\330\302\3030\351\003\021HCH9\200F\303\341z#\0040h\204$\\W\320)ZS \n\356"
+	.string	"&\251;V \360\247\203Hg84CG\270\262\020<\312\301\2613\034\222!4\004\032%\251\027\022\252qb\004\0172P\211X\354\b\022\005\207A\341\321P\320\250(\3517\024\376x \265X\211~8\204\353\020h\324\002h\364\343\321\202H\210\324\202\305\212\240\265(\330A\017\"\340\232\244\302*\304@\270\"%}(Zw\234\360\003^\360\263\256`4$\242`\315\001\374\205"
+	.string	"\264\261\026\005y\f\215\216B\354\b\006+\030\312\341Rw7\346j\256\331x\3123mp\215\332/\030\311-\026\354\366\353\226\310\264_@{\367\026\231Q\364\224/P|i\226,\326k\247\356\204\025\244\226[\257\237\"T\313\035<\\\325^\341\276\276\275+@\307f\362\336\242\355\262Xn\257\234Q0\243"
+	.ascii	"2\201\311\212)\345\262W(\326Z\036\323ri\255\3305W\217\314V\225"
+	.ascii	"[+\036\302\210]\316\032\265T\030\255\355\362\242rh\324F\261Z"
+	.ascii	"\334\226$+\314j\331)`V\302l\350c\031\330\220Q\215J\331\371B\305"
+	.ascii	"\314R\016J\307\251\341"
+	.string	"j\262\324\250ub\235\330,\276H\030S\256}r\233\325#\246\304\205\325\250\305j74\250#hl\021\324k\212\324\0222\365J\224\330+\376\272N)\023\272)ux\367J\251\350\221\323\312\002\3052\271\275b4\037*H\267,\215\332%\214\266b\271\f\323\250\245\341m\206\306-\256\264\264\214\323\036\317\022\365\267\312\363\323*;M\203[|R1\206(\345\b\336E\2361`\365rXRvg\247\354\224M\336\230\323#\263\3053\025\202\210\250\302\3710\007\302\212\031C%#\"I\223t\222\n\020\206\"a&\351\235\007\022\340\364,\220*\313\214\f\215\210\224GJ\222T\2069\0168\212U\353\3015\330\347\3729 ?rY\364\366@7\250\324c\250B\033\316j,O\270\211\024\016\271\316\231'!\300\f\322\244\263\022\224\361\r\331O\212\261\204\2730\360\206\353\211\374\006\013\362q\363Z\260\2162]\006\257\201/\346\007"
+	.string	"\0255\312\375\003S\263\006\344bn\253tj\017\246\200O\360$\315\247\200\f\rY\214\270\273\026\305\326O6DxW-\230\231@[\311\351\370+n\374)C\236\013\035\270A\252\273\034\030\255\235DzS\013>\270'a\252\336\375\217\264\006\305r\346\273C\260\202\346\204\007\224\317:Sv\231&\304i\003?\214\377\365\224"
+	.string	"$p\016\360\346E!\200\030\313K\225\240|\237*+\321GDo\nB>$\360\333\366cZ\371QNnq?-\340\320\233\007Q\247\372\307\350\221\222\333h\240e\232v\374\273\326\235\353;\313k\016d\005\257\231\204\023m\357\362\240g\264Vk\373\005\2429B\324"
+	.string	"\372z\200\n\260^\021\366\354\344\215)k\370\002\271\305<AgL\341i\324\356\206\037\373\331\206\026\370\364\037\312\bx\241\177r\023a4~\003\337\345\354\377\006#\204$\357\353qt\335\332\373\215\205\311\264\320F\016\032\355\262\f\317#\r|\227F\230f\260o5)\222q\257iD\257\204\201JO]hH<\322"
+	.string	"\366\200\035'\242M\350(V\344G\340XR\236\307 \363\212)\213YkL\211\370M\314>\207\350h\3160\321\262\370\272;j]a\020\004\337\275-mV<\210$Q\236\317Q+\004G"
+	.ascii	"\253$U\312\240\260c\205\316)\025)\t-\316\\\326\357\244a\342\013"
+	.ascii	"\245\335\215\007W\020]\360\341#d\036=\036\tmZ\310\257\300\002"
+	.ascii	"\305g\356\344\325\207\231G\020\253\026r\302>\350\024\177\037"
+	.ascii	"\320\353\037\"Au\303\202\344\n\316\2077tY\370\020=\360\310&\271"
+	.ascii	"C`\006\033x\f\326\321]\370\250K\367\307P\373,\275$"
+	.string	"\253\304\267\022.\013$@,\222O\236\200!\261\304\302y7e~N\353y?\037\205\364\335\320a\272>8\320\t$R\337&\021w^\264N\322zFxX(2\357\236#-\322)\2708\267\367\"\336\316;\215\266\321\246mgZS%\242\250\261\322\311\3528\203IC}\247\314\344\016\362\331n\234\215L=\226vP\026\035Ez\004\374\222B#FF\001\375\207</}\025\235\263\234l\0068\n\224\316\240!\220\252u\230U\236\234\200\227\017\341~\023\306Y\025\025C6l\374l\220\022+\003\bO\275\003\013E\207D\354\035\233\206N\340\233\250\203G\360t\252\346\337R\232\305p\232\320\255\251\361%\332\374#\351\004\353\300\242Tl\365k\3326\275\362rj\314\302n\247T\266\267_\314F\261c5g\006\034\020?\340U\324\322u\251~\314-\205\337\n\234\340\342\356\346\356\233\221\313\273\341\271\035FLh\200\217G\215"
+	.string	"\373\300q\fT\226\213RY\t< \236\332\204\246ZZ[V\275\037\357\n7\016\t\032\323\367\306|\036\240\n\306\341C\263\320\020\350i\376\035q(\311\214r\321\367\273w\302\311?7\271\212k\363\"\223\00153Z)\271\361\202\301\370\241\272p\253\250"
+	.ascii	"\203\027\331\310<\252\355o\215n\346\345\3238Jn\031\212\247<\346"
+	.ascii	"\322G\307\0169\370\002V\f\233\302h\313\262\301\231\377\007X\345"
+	.ascii	"\306c\213\b\350n\327\315F\220\031,\r\333\340\003uua\237\252G"
+	.ascii	"t\377 Y\342\344\246\225S\037\005\235z\241\024\222\253\353\327"
+	.ascii	"\361\277\320'i\264\331\030\n\372\201\032\034\307\331\006j\256"
+	.ascii	"JS!8\212\355\257\312\317\23234w/}1@\203\225\0302p\246\346c?s"
+	.ascii	",\036\032\366U\026\f\327qh\216\027\205\t\277\027]\264@\001\005"
+	.ascii	"\272F\016\257\371\350-.\235\224\316\301s/\260-4\026\245\263\016"
+	.ascii	"\205\372!\354\353\021?\340_\3237[\336\f)\277@\367+\177s\337@"
+	.ascii	"\273e\215\276\363\353\273\371EC\334\027\344\254\244\364\224\242"
+	.ascii	"v\354\356 \303\327\277k\337\r\370\343\374\256l\255|\337\372\271"
+	.ascii	"d\233\321\334\242k,\367f\374u\263\032\036p\362P}3"
+	.ascii	"~;\372\r7\357\266\326\314K\2635^\235\256\025\360>/\2741G\240"
+	.ascii	"k\b\36367\036\353x\235\336\333\346f\274\333b\353\373\365<{\344"
+	.ascii	"\356\\\371\327\371\203\255E\322\230\367\031\331a\355\347\271"
+	.ascii	"\340\275\200\310\353\333\t\236\340\241\356\361.L\331v\373W^z"
+	.ascii	"]\004\2321\345#i\374\235uS\352G\340\0348\373\317\307\261/\201"
+	.ascii	"O\213;y;&.\321\nz\360\305EV\355\254\277\032\277\271r\013O\246"
+	.ascii	"\205\023&h\005"
+	.text
+	.section	.gnu.lto_.symtab.61cac20f634b434f,"e",@progbits
+	.string	"smartaudioFrameGetSettings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"smartaudioFrameGetPitmodeFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"smartaudioFrameSetPower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"smartaudioFrameSetBandChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"smartaudioFrameSetFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"smartaudioFrameSetOperationMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"smartaudioParseResponseBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.61cac20f634b434f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
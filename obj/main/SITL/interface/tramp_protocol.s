@@ -0,0 +1,433 @@
+	.file	"tramp_protocol.c"
+	.section	.gnu.lto_.profile.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375 \341\005\003"
+	.string	"D\004\325"
+	.string	"\007"
+	.string	"\312\347\334\321\013\004\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\243\352\210\312\003\022\002\001\002\003\004\002\004\002\005\331\360\341\242\t\024\006\002\003\003\371\306\335\343\002\004\365\300\251m\005\355\273\320\262\017"
+	.string	"\006\240\342\234\212\n"
+	.string	"\n"
+	.string	"\300"
+	.string	"i"
+	.ascii	"*Rq\303\251U?\007(5\360\022@.\365\2736`\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375 k\375\001"
+	.string	"4\002_"
+	.string	"\006"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\003\001\200\004"
+	.string	"\t\001\001\001\002\002\001\003\002\004\005\003\002\001\201\004"
+	.string	""
+	.string	"\n"
+	.string	"\013"
+	.ascii	" $\t\002E\270\b\226A[\260F\315\037.\213\360T=\323\232\r`\001"
+	.text
+	.section	.gnu.lto_.inline.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"5\006"
+	.string	"bJ\"*\220'I\007\253\342\277/\342\306q\375_\367\n\341\334W\276\255U\363\377\026}\371\377\377e1\2066\254m\326\266f[#D\356\024\277\330\213u\365(\203\314\214\236)\366\035\034P\230\026\264\243@#2\2239YTB\310\314E\203k\017\002\341\332s4\375\003\024\017\225\301\265\367H\305\321\301\265\3474\370/\366b\351g\250\345.7\202\253\001z\357\323\314L\345\241*\270\366\032\311\004\351D\021\213\330\021\352C\224\260\340\2742\036\004\030"
+	.string	"+k\005\332\033\264gD\233\030\020\b\035\fR\226@\264\206\201\265"
+	.ascii	"\300\027p2\220\017\004\017\353\321\\\220l+\351?\241\223\030l"
+	.ascii	"\300\001\277\220n9\255K;;\327\322\300\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375 \243\265\002"
+	.string	"\"\205\017\030\260%\351\ftIH\0030\206\301\3230\025\226\020\032!x\267\275e\222\001+\021\301\216\023>\370g\0304\005;l\340\311a\347_\325+\024\027\214\255\244\262\251\274W\252\261\204\003\236\253\021\002\b"
+	.string	" \343l@\013\312\345\262\234\224\335\242\332\202\231\347m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\231\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"u\003"
+	.string	"\302\304\020\035\260%\351\200\270\305&9\300%\001B\032@\024\302\212\350(%\035\260\330\2445B\244L\001'\224\220\004\235\3772\230\231rg\264_\373\353\365ju9\327\374\254E{\244\031\020"
+	.string	"\001\001\377S\350\304\366<\002\021"
+	.ascii	"\020\202a]\004\200\b<\214 \211!,v\352B\200XV5Y\"b\306R\t\210"
+	.ascii	"\022Bg\214\231wb\3323\200\""
+	.text
+	.section	.gnu.lto_.lto.bdeefb57aaca444d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_trampFrameGetSettings.23.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`\304\003e\031"
+	.string	"\206-\241G\260XQ:\360\277\307\225z\001y\226)N\225n\034~S\347\351\fl\214\305\274\355\r\204=:\253\021\374m_'w\374m\224\255\210\223\362\306L\346(\313\013\017G\205\240@\232\026\275\247\007\356\031\366\255\375do\271S\n\205"
+	.string	"\212"
+	.string	"\223"
+	.ascii	"En\235\332K\316\004\367&+f\3051\233\276\fk\255\rN\255\363t#["
+	.ascii	"\266/\355#y\222\334\211X\\@\255>\260P\251\025\350\3009\253S\003"
+	.ascii	"O@<]}\200x\352\234M\306\200\213\0335/\234H\325Z]\373\3038\237"
+	.ascii	"\300{\312\334\351\\\231\363\225\\\336\210\352\375Z\234\316\331"
+	.ascii	"cH\207\363s1u\234\216\332\370~;9\207\330\370\276\351r)\252\367"
+	.ascii	"\263q\251\262Pk\265\354\375h\334\342m\217\266;\330k&;\271@\366"
+	.ascii	"\021"
+	.string	"\324\3401\303\353\303f\255Tg\272\305\2254\375\322=\257t\357\211~) \200\227\002Zj\2251\265\246>\321*B\017\376J\377\322\317\364i\337\237r%\177\351Lor+\311\021rrH\271(\271\333\253x\002\221S\271\320)\244R\3307?\312\221\236\024!\347v)\265YqP8r4\324p\324s\240\005\222\220\f\253\333\241\364X\330\301\300`E\312\260V \206;y\3207r\253(\207;\320\224\250H\255\025\347\007<\251f\326Z\353\204\360\271\253U\361\242~\206\304\245\253\332\217\371\331\261\003\243B\204\037\344\367\210\247t)o\312\227c\235\304h\031\356\002\r\020\345\356\276\351\n\212\312\374\f\355f\255=*\f\231\234\313\273\274\236\334hD\002 \265\362\336\203\211[|^~\220<L<\3650\305\227c\205\344\300\340\3017\03022\003*\366,N:Bit\004xM|\320&\216\245F \350\235_9\001"
+	.ascii	"H\255U\202\025\037\231\037\304B<\275\321e\022\241\"htr\312\006"
+	.ascii	"\006\266\204\215\260\245\235\004\317\005\332$\361\232\241\300"
+	.ascii	"\2756\340l4Y\354&&{\215%\250a"
+	.string	"\017P\314`3\333l\244\215\240\311^\243\315\025\203\275J\2141\033\317\216\213g\347%s\301\306\232\353\301\002\317h\261\321e\233\315FW\013\250\373\234\342\262\326g%\277\300\346I\267;?\314/t\207\017\313P \"\205\206\265\027\372\303\307\b\r\342bB\\x\005PQ\2753t\201\214\023\203\314\256\266\025#I\312\235\353cA\255jUA\210\244_\023\305\365\315\335\365i\022&K\250ALd\220B\202\"D#2\303\260\2321\220\002!2\272\r\021\200\311\232\022\n$\24598\f\303^\272\204\244\327g\272\276\361\364A\321\262_\254l\3732\322[@\350\007!\235m\314\355F.D\241^aI\261\365\322\237\336\355K\n\246,\262\375\241\255\220~\230\002R:\333;\210Q\317\246f\240\027\233\357(\377\251\255\222@`3\204\226\003\036\024 \334\020TF\0204\303\311l\222\215\315Yl\013X~+@)\333`\222"
+	.ascii	"\023nZO\3569\364k\334f\2709\225\351\203c\204!W?[\001~\244\316"
+	.ascii	"B\251"
+	.text
+	.section	.gnu.lto_trampFrameSetFrequency.24.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`6\004\005\034"
+	.string	"\0062\261I\240\330M:\300\363\265\225\374\021\303\344\314\341\217\203\002\311\007\305_\254\371ed\333W\2308<\331\250\332Y\352\213)2\302\215\251Ew\205\321\232\276*\364\201\305uc\\\240\004\205\275x\352z\274%mH\264a\304\022B\366N)\225"
+	.string	"\226"
+	.string	"\243"
+	.string	"DN\210[$2\001\033\356.\203\217\266\340\005\34034\333U\370!\2757\241\240\003\366\347\033\262\332}j`\233\362\343"
+	.string	"zj?\310\205\364\316\224\342\004vq4\261\332\0256pM\371\321\302\323\220\037\313\317\220\037\335\263\257\\\210\264wj\301\002\252\313\356\326j\016\313\\\024\336\"\355}\024+\355\371N?P\204\005H\244\342\243(\336X\n\222!Z!\332tM\205\t\022\371\250\310C\306\353\271N\227\210\001\211d\234\312*\354\256)\220\b\306M\336\366i;\307\026o\002c\266\320G\353\221\375\0031l\274p\305a\323bf\337\272\313\030j\331\265\262\356\361M\177=\323OgH\243\257\002U\273.\306\300\254\327x\245t\251?\353\327\372\267.\332\367\225<\313\327\372\326\271L\2732\204\232\236U\217\252\267;\023K\350\361%\307r.*g\357|\252[\375\nB\315\356ILq\213&"
+	.string	"\231\032\336T\365\030Pqd\207\210rw$=\025|-.h!\031\356\n=\224F.\345O\231V\244\347\363'w\200\362\261\273>~\021\323>\372P\217\362y+>8Yc\252\354'&\264TVY\235\325[\021\252\341\033\236\035\374$\277\207\374(\253\343o,hT\273\252@\031\326z4C\322:\326s=\301\023\026\241%\037\035s\255\366\207[\001A\003f\213x\225\2332\300\235\276\340\013\312\013\rq\367\006\205a\323\301>\005\347\310\247F @\332\375\035\230CJ\001\302\361\223\350s\310\217!\252\202F'(\316\202K\235\301\322\217\027Q\266G\371\262Q\362BC\300M\362R\276\375\211I#e\334\273J\004@\332\335\bN\200v\374\244\024\344\307O\235\nQ\362\021\026D\0036\275\235\267\252;\t\036\013:\221\204\3154\361c\343\360\303\323\345p"
+	.ascii	"~n<8\237\035\356\324\231\341r\266Sg\364\315\201\t\363f\362\314"
+	.ascii	"S\227\243\313\331N^\rw\263\351\2348\036\317N\215g\307\226\253"
+	.ascii	"\335\316\236\232\003\0056u\270\263\3063\315\263F\023\006]\024"
+	.ascii	"\313J\253A;\275\214\232\341\025T}~\226\037\313\030.\306eB\217"
+	.ascii	".a\264z,gx\030\2265|\313\206c=\001\0271\240\226\261\036Yf\350"
+	.ascii	"J\215\251\264!*J+Y\2033.uVe:\230\250o\222e\r\222u\254@NT~\364"
+	.ascii	"\213\270\273\001S\250a4e\020C\204\221\241\021\221\031M\232\003"
+	.ascii	"p\002\031\262\332\r\021\240A34\243Ii\016\271\321!\213\314\372"
+	.ascii	"\251\371\336\346\n(\342N9\261\375w\232\333o#\007^\344H\354;0"
+	.ascii	" \033\013\303R\245L\301\016\216'\356\"\267\250\bb\2420\277\f"
+	.ascii	"\231\210\366\343\305Y\036\364\306t\254t\376EC\243\213+y%\357"
+	.ascii	"\006\355_\204\222\361Dq[\034\343\3749\323I\006\220\237v\313G"
+	.ascii	"\rO\240\026~\250\022\220>\344<\322\323FD\356\306\004\367W\327"
+	.ascii	"\336\333\306\360H0\220z+\345\024\340\212\301\216\217\377\304"
+	.ascii	"\212\253\300\202[\221\226\250K\212\346\022q\\\211iC\376\353\235"
+	.ascii	"\271S\001"
+	.text
+	.section	.gnu.lto_trampFrameSetPower.25.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`2\004\275\033"
+	.string	"v\261\256H\240\234Mc\004]K\202\220\017\376x\020\333\314\036\206E7\202\206\272\032|Y#I\036\r\3215\013\325\"\021Y*]j\222\215]\221\2674\205\361\325\301}\210\316\214\0363\363\302\320\013<\300C\335\306}\333m\313-eJ\001\222"
+	.string	"\226"
+	.string	"\241"
+	.ascii	"\342\275!F\351\032\336{\031\334\332\002\027\200\337\224\266\253"
+	.ascii	"\357Hr\177Za{/\0173\302{\241\032X\207\274\035@O\355\033\371\221"
+	.ascii	"\334\235X\234\300\275?\250\204\367\372\0328\207\274\265\3578"
+	.ascii	"\343-\371\233\361\3269\273\313}H\367?\031/\222\210\271\367\312"
+	.ascii	"*\020\333\\\364"
+	.string	"\335\"\315\335\212\225\346\374\337\017\340\300\262\353\265\270\025E\037KD6=\027\242\316V\360\f\257\247\243\342\020\033\257\327:\205\002\266\353\3318\215U\270\367\232\356z4\356\361\266O\333$lq'\266OG\353\221\375\0035x\314p\375a\22754\317\272\311\032\352\330\261\256n\373\247\277\336\351\2477#S\225\002K\356\225\021V\346r\331*\245\003\377\253\037\353\317\272h\337\177\362+\037\353Y\327rYe\b99an*\367\363(\226@\204\351Pne\233\224\315\376\361\247.|\025\204\234\237;1\305{cB\221\3400\004\025\220\201\026QB@\220?\227\002\252\240\203\201\001Kjx\257\217\003\331\344@?\350\222I.\350P\376\020\025\3443qy\353'\271\222\240/\021\n\037kM\215\025\201\031-\2215Vi\352\271\030\355\320\r\317\017~\222\0174\336\306\252-\n\343\345\250[[\250\fk=\272\031i\265\365ZO"
+	.string	"\345\305hIG\303\\\253\r\342\\B\340t\331#\276e\207\f\360\337\027\364\220j\322!\336\353\203\302\360\351]\317R\"\352A\022\b\220\356-\372\216g\2742T\302O\242\347\031oEP\361r\b\321\235\005\007\236\301R\323\f\341\354V\252\350(\215\321!\340\346x\240i\237b\342"
+	.string	"]\373\026\212"
+	.ascii	"H\367\336\bR\206z\374$\026\343\355\203\247G\224\230\274\210h"
+	.ascii	"X6\245\235\264z\273\t\237\0137\321\304\314L\241b\346A\005\356"
+	.ascii	"f\253\001"
+	.string	"8kB\346\315\326l\263\363\2045\315A\n\223f\342\314\363\306s\263\315N\234\254F\233\2358k8\237\036\231O\317\314&\243\235@2\007\nl\336j\247\fg\232\247\254\364\021]\024\311Z\376wRI\023\027Q\325\371_~+g8\330\327\004\"b\274\312z+k\270\227\2257<L\207[=\301\027\330\016\214\255G\266\211\321\245\326\3242\306\024\245u\254<\232\257JScA\234\250o\216d\345\215\325\326\241\237\226\"JF\274\367^\361AT\250a0e\020C\206\021\241\021\221\231M\232\003p\002\0312\332\r\021\260A\233\231\321\2444\007*\216d!&\2428An\222\200\032\270\005I\214\376\235&\365\267\251q+r$\316\0354\270\rZ\303\322&&\227\203\351)\273\250-\\\202\330Q\374/(\223\243\275\230\342*w\215Lw\251\332?\341\201\371&H^\336\255\261=\017Qg<Q\234\215\343\017_rJI"
+	.ascii	"&\020\312\362%7:\360\330\300(:\b/r\212e9\003\233\233\262b\355"
+	.ascii	"'\001\275\207F\353\t\360\367\213\352\340\305\005-\256\030X\362"
+	.ascii	"\331\037\260\342<Xpw\245e\265H\321w\243\213+\235\266\316?\275"
+	.ascii	"\343u*"
+	.text
+	.section	.gnu.lto_trampFrameSetActiveState.26.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`I\004\205\034"
+	.string	"V3\265I\220\232Q:\200\257\004|u\311\347\221\3104=O\231\031Ka\001\225'\021\346\201\232\n]\224\230\263I\226H\034\375\273X2v\234\364\001\256O\t\305\220\021 \346<\236\220Oyk\242\226\230\201\220E\243\226o\255\221\275\345N2\232"
+	.string	"\234"
+	.string	"\247"
+	.string	"\017\236J\320\253\260\250\327\307E\320\344\004.\270\345\nV3Z2sS\346\007\020x?a\020\370\326\021X\274\227\n\003\3269e>\360RxW\212q\001\367\026\251\222\272\367d\300\020`\267|>\207\274\205\035\207\274e\0363\326\317\243\373`Q\215*\\\367^Z\037\341\233\327\363\\)\357\2666\345\361\227N\177\304\240\321\351'\343\266\326!IB7\277\031U\247\352\251\315\213\247\276_\217\326%=\336/>\347H\317\350\364\353q\372\242p\357eJ\364\333q&\317\314A\314l\202\271\366\004W\\E@-!\332\305|\366h\0331\337"
+	.string	"\017!:\270\2130\317J\331\251\3161\031e\330\247\316\257\023\317\277^\351o\031\345\0178\261H$H\033\317\233\243\213\315\265\262Z\222\\\370\023\377\251\237\352\225\371\374,'\362\247N\365\"\227RQ<(\336\317\267p?=\271\226\017\031w\204c\376\341C=\352R\\\376\034\213Y\257\017\tQ\236\216!\256"
+	.string	"\025\220\001\245\344\003\354\347O@\024z60\024\257\034\357=7X\271\220\337\304%\023/\350S\330\342\020R\004\274\367\226\267g\342\362\226\003\267:\370\253\313~\rm\321H\2125\254e\37524\212zX9\017|$>\020y\013k;\324\345\373\321Ud\276\034\273\215p\310n\262\221\214\004\215LI=\332\305of\020\037c\346\210a\026\361\253\0210"
+	.string	"]E\224U\373\375\245+\310\262%h\264\322\246\336;d\302\205\377q\312\303\334x\302\351M%\016\034\335;t\242\035\022L\213\023|$\372\035\3626\004\026\337\017\026\224\204\202\013\277 \t\212\216\246\332\255\276\350$Q\003$\300M\362B\266\335\213\231#\344\333\273\250"
+	.string	"pt\357\215\300\245\005\017\037)\006y\373\246\343\004\314\324\246\263u\356(|.\344*\212\232\331\343\242\306\301\305.\207\273\315n+xv\266\032y\303\325t),\333\032\364\2306sg\352r;9\\M\267\243\335l\265\024\272\333\316\207\207\346\303S\303\321l: Z\203\004l\346n:\332\3164u\264\362\024z\255\261\236\265\217\227n\201\211\0225G\241\356\361\315\374C\316p4Z\035$8\341\322\232\365\207\254\341YC\336\3603\035><\2024[DY\266\215\370\346\006V\227]\336\210\242\335\257\366\305\322\264\254_H\224(\337$c\355cf~5\331/\202WCtM\275\367\006S\250a<d\224AF\t\304L0CbP\230\003p\002\031*\273\016\021\240\311\232\021\322\302\322\034\272\355\227\217\304,\305\2429t\352\271\345\f\335\300\220\312\361\263X\255\242\205"
+	.ascii	"\0242\236X\022\026\"tM\352q\220V\256\237PM7\203}\025\204+\374"
+	.ascii	"/\310\023l/.\b\363\352\346\004$U\021P\361\300|\013\264\343\204"
+	.ascii	"6j\037F\210}'\342.\315\020H\354\374\366\030X&1\207\320\232HW"
+	.ascii	"\333\223-\320\254\327\221@\201\363\325y\224\036\352\323\230("
+	.ascii	"\330Gb\321N/\274\202\345\323\023\314tc\260\325{\344q\336\t\275"
+	.ascii	"\346d~@\372\213\217>F\216\353\212$\320\336T?*"
+	.text
+	.section	.gnu.lto_trampParseResponseBuffer.27.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\025\f"
+	.string	"f\326RB o\233\016\3001\203\344\240\340"
+	.string	"`\n\230u\2215\203"
+	.string	"@\356a\230\273\0023\023+\350"
+	.string	"\373\030\272\217! \2410\212j\232\024j\001X\225\226F\230\207<\200\003\003D#;\341\037\f\237\232\b\2212\245="
+	.string	"B"
+	.string	"="
+	.string	"\324'\333N\300\001\362\367\b\242\344\035B`0\321\262\033/\375\360\345wI\363\3637\300\220K\326\206+"
+	.string	"0$\025\330\335\207O\022P\224Yu\354\256s\004\314pO\267\335\300v\004\373\f\002\372\225?\235\376E\201I\013\f\0022vKj\320X\026\223\212\024\333 \033c[Z\001Iq\240\321\302\200\314\212B\016\0132\355\2178\t\320U.\\\263;Z\221b7\"0\207\365\311\361\002\250O\326\003\004\037e\265\364J\242\356\020\321\220T\245j\245v\367\221\037\261t\322\020\003\032NLTQ\2349\b\225\372\360\232\370\242E\f\026\027\242\234a\307P*J\t\017\361\304:\262\235\266\256\362W\217\177Z\006\341\302e\235\316\307\004\252\243\240y</\353,c\233\n\033\266y\033\367\221\360\361\340p\336\225a\234\016\227y\232\347\322<\034\217\013\343\272ks\300\333'\343.o\333\270\013\023E\256#?\374\003\026\021'P\244\037\025"
+	.string	"\204j\342\027\002\346\351\214\212\005\230\204\025\210j\341(\331\340\302p\031GYc/M\210\240\032\270\002\346@`\240D0\302"
+	.ascii	"\025\246\251\373\206\232\274]\245\f"
+	.text
+	.section	.gnu.lto_trampParseResponseBuffer.part.0.36.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`\261\004\335\036"
+	.string	"\306\367\303I\240TN:\0248%\316\205\2400\356\017\362\350\276\377\177~\272\372\303E\\;\017\"\372\027\202j\331z\331\276\375\1773\277\251j\212\326\322&b\217\342-`=\306\361\240\337\266\304\032\347\017\236\264\235\177\200\2735i\204\020\271S\n\257"
+	.string	"\264"
+	.string	"\242"
+	.string	">2\001*\261*\211\302\322\033\177>\304\204\214\261\2768\362R\373S\247\002\372\020\023\027Pk\323\031X\255F\006/Ms\276\264\3610\346\313\363\004\314\227\366\205\370\001\315\317\321\003\032 \007\335\370T\374\215\035*\254\330j5\356^n\016\277\2344\336$\r\372y3Kr).\310G\022\372\t\301\206\221\033\205\032kRW\230^$\335$a\212<\212^\220T\220\n\216aU\356EDK\222d\212\032\276 \245 %0\341\332r\263S#\244!J\322\242\0371\2767;L\216\241\264-\244\030\247\003\216\273\325\324Z\375\341\214;w\333<l\333\330dR\177"
+	.string	"\004Z"
+	.ascii	"\224j-\266i\251K\245X\217\037\371\267\276\304)V\n\r5)\266J4."
+	.ascii	"\260O\346KR`Z\307\217\375d\177\331\217\365\233}_\311\307|\262"
+	.ascii	"\227"
+	.string	"\335\314\272$H~\036\366\363\373\227#\264XS\222\252\265\352~~\330\221<\211u\277k\371\310\2324!\b\327Q\314gF\250\313\007\210\363w0\237\232\241\025\225\2642\242\326\341|y\337\352\307\317:\327\275\254;\322\305C\273x^\211\216p.n\0049f\330\272V\320G\327\n\316\b\031kqC\2152)6\f\347\261\256zfvE\035:-x\351\362\252\247G\205\023\310\326\231\244\257*\342C\026\tG\013\032\260y\177\322\213Q\253\225\b\301\t\212\021>\324K\237\307|y\356T\213\243\322\024\325\260\\'\277\260\240\262\267\325\261\360\242\337]#\\\2255\367\246\203\212\372>\263\\\243]\272'\252\244\020)\026\357\311Zk%\035|\367\2667\242\025\242\250r\3115\367S\210\224\374&%\202>\224\357c\276$\267$\266\031\321\030\3226\357\227\311\332\331q\327i\351\336\354\024\nGU\332U\324\020m\243\353\344\305\375"
+	.string	"\214\245#o\223mj\227\033\177\235\216:\207\313Q\2377\363ew\231\243&Ov\357\307n\372\252\007;\027\241Sa\207\354\371n\2008%\017\310[\235\336\005\034\260\207\203\323\023\302\f\216\320\311\021\n{\301\323\274\006$~\274\237\360\007\334\261\331\361\335"
+	.ascii	"\205\273\036\357\006\007\330\023\352\344\354trn|;\0360\270k\220"
+	.ascii	"\300\277\235\036p'\374\375\200;\335\267\311&Z\026\326\327\355"
+	.ascii	"\0172\357u\013h@\260\276L?\310tqY\327\fw\350\214\241\346\275"
+	.ascii	"\304\314\255nm\r\034\350\213\254[\"Z!\373i9\005\236j%\276\310"
+	.ascii	"\356\360(\036\022\370\303\241\330\030x\312m\351\344\254*mK\206"
+	.ascii	"\216\211\210\330m\235\274\376\342U\226\242RV]&\357c\216M\250"
+	.ascii	"L\222,\027\207\333sC\3307\001[\250\201HF\224\"EFh$I\222&\035"
+	.ascii	"`\002!Fw\033\021\200\261\223\252\252\260\314\001\204B\221e\026"
+	.ascii	"\251\331\to_m\346\371}!\374\2564o\243o\335\027v\214\253\017\276"
+	.ascii	"6\025\277\376\345\270\220M\035\235b\354\036M\337\027\0311a\261"
+	.ascii	"\226\036z\273[|m\271\006n \327\202\024\246\254\237Wb\220\027"
+	.ascii	"\272\317\243\317\2342\271\224 \237Ik\237\247\345\365\017 \016"
+	.ascii	"\313\206\274+1\025G\337@\221\302W\031\267\035\016~O\232\033\036"
+	.ascii	"\235\243\306\343Z\323g \377\362\260^\020\244\367\234\200\017"
+	.ascii	":\320\231{\\\251O\022\347\343v\261\237\025$%i\007\313\250}\365"
+	.ascii	"w\030\343\"\357\214\253\351\302g)\237J\342\204\274 \33200\370"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375 \312\315\003"
+	.string	"\264\005\306"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002$\177\016\220\240\223\"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \027\177\017\272\200\202\002\030\177\020\031\177\021\032\177\022\033\177\023\240\300\246\304"
+	.string	"\005\003\024\201\204\001"
+	.string	""
+	.string	""
+	.string	"\001\034\177\025\377\037"
+	.string	""
+	.string	"\200\200\200\003"
+	.string	"\007\322\301\242\013\001\244\007\003\005"
+	.string	"\220\240\223\"\001B"
+	.string	"\013"
+	.string	"\004\023\212\324e\361\254`d\220\007\202\003z"
+	.string	"z"
+	.ascii	"\032:Y\002x\314\326\034\003"
+	.text
+	.section	.gnu.lto_.refs.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bdeefb57aaca444d,"e",@progbits
+	.string	"(\265/\375`O\024\355]"
+	.string	"\n\237\354\"Q@\220J\032\016h\2124_~2<&lh\212o<aS`=\377J\372\232=_\032\"\347\036\300\023\206B\260,\255\302\300\026\205U~\200w\222t\361D\317\001[\230\311Q\372F'\372\261\322t\320\f\024\212C\310t\375\236b(~\277\261\255\224)\323\001\032\002\037\002qu\335}t$\300\321\321\321O\233.C\270\200\320/\235\372}\252_\270\177\313\326l\327>\350\366\300i3\370\300\301\350\226I\372\316\300!U.\327\356\355\370"
+	.string	"\023\344\b\243?\3336\246\210\247\t\035\255\032X\324\266\r\263b\326m\327}.\333~\331-\233\366];\211\354\356o\225+R\324\274\354\332>\227+\300\312L\354s\321\366l\337\226\017\204E\251\353^\277]\376\244\277\304\211}.\230]\373\020\325\235\005\004"
+	.ascii	"-8+k\354\272\327\242\243\243\243\243\236%E\206`\371\240\337\034"
+	.ascii	"\352\2772\374=>no|4\031\375F\251'\252\035\026T\347I\0359\214"
+	.ascii	"\376\247\206X\242\324\210\003\225\304\022\245\351\013u\261l\226"
+	.ascii	"]\023X-_*[\345;\307\265W>B\307\214\214\321\273P\277\t\244\274"
+	.ascii	"\273\273M =\013\365\r\250\177.Q\n\264\034\322\241%J\271n\211"
+	.ascii	"\234 z\253\325\324\020&\373\027\312\206\355\030/)\305\354\262"
+	.ascii	"\356u\003/G\fl\316\030\335\0306\312\256 V\354%N\234g\034[\303"
+	.ascii	"\272\327\036\020\025\325\021&\243OR\277R\336\341\330'\316\352"
+	.ascii	"\027D\272w\013\"\375\272D\251\272\034\322\177Q\200\372\177\346"
+	.ascii	"\337\342\022\207\377\006\375;\202\207\237\201\377&\255p\200\377"
+	.ascii	"\352\317\035\314}8\001?S\305\261\210:\232\377Z\376\355\271\006"
+	.ascii	"\234\302\277\350\277\274\177}\376\345\t\376\353\364\357\233\377"
+	.ascii	"n\376\375\371\017\347\037\376m\372\357\345\337\020v\351_%&\376"
+	.ascii	"\353\301\277\030\374;\342_\027\377\262\370\327\201\177\033\370"
+	.ascii	"\267\304\177\272\177{\377\032\360\257\210\177C\374\373\341\277"
+	.ascii	"\330\277\036\376\355\360\357\206\177\207\376\025\372O\366\177"
+	.ascii	"\354\177\207\377`\376\363\334\335\335\335\375\334\365\363>\374"
+	.ascii	"=aNf\325\206F\266\261\235\307 *\222Y\225lcV\r%\235\307\252$R"
+	.ascii	"\253jC\023\273$t:\276\306\3466H\022\331;\246\260\216\312\241"
+	.ascii	"gre\366\231\356-\263\321J\003\272\261\230\3123\307\036\213\026"
+	.ascii	"\365\334\021\205\345\310\334u*J\b\263\221\317d\027\263\273+j"
+	.ascii	"FO1`\\\237\315\265O\343\020\254\226\262\321=\300T\267q\373\331"
+	.ascii	"\335\306\356\346Qb\255\335?\206\222\315\251\251\356e\321Tc\031"
+	.ascii	"\267\330\350\346\2628\264\252\244S\b3i\013\025g\263o\254\306"
+	.ascii	"m\366\031-\245\3524\212\265Tw\357\032\265Y\265\202\032F\327\365"
+	.ascii	"\007-\313\214\207\326[Z\205\213\032\026\243\234\305-\354z0\314"
+	.ascii	"\274P\332\r30B\324\247\260\007\223\256Bi\023$7\2660\312W\314"
+	.ascii	"?\030\353|\305>\200\220+_\241\335\307]\021B\273\"v\324\222\034"
+	.ascii	"\311\200,\345\314\326\304zp\017\266J\256\033\026\251\004\313"
+	.ascii	"\030\243\314\203Y8[\361\n\315V\f0\273\217l\325\233\323}\354\355"
+	.ascii	"\212\330\025\201\202\tQb%E\317[\252\260p=QQ\200\320U){h^8\220"
+	.ascii	"\250O\302\b\371b\224w\b)\311\3148\031\345\2512$\220\222\310\032"
+	.ascii	"1F\317\323\241\336D\r\033\207\t\247"
+	.string	"9\205q\354\035'\367\271|\240NN\035\343X+[\267oK\224-\216\016\316\301R\2732\216\225\263s\226\316\326A\036\025\241\317(\270\247\212\336\340#\272\266\300\305\303\216k0rW\266\301F>\376D\224\033\333\340nk\376\214\271\321c\n\235\332\246\236\331\324\363\026u{\211\322\241\345\220:U8EAf\274\316\264,Q\177\242\215\0267\253&K\263{\265\3337\273\256\233]\263l\326\242\2351hM\340R\364\314\305V\352YJ=\327P\351\004\360\211\373\241\306\213\033\365&\344\366\314\256\t\361\272\263\346\232rKf\341\300\320\244Y\0326n\321\354\334\256+\267f\316\353\225=\023\332\351f\3125\345\236F\036\b\243a\345\226\313\276\355s\211~\t@m\034k*\236+N\322\314\261\353\344\322HH\007\235\026\221\265s\230\263[\211\023\237\013nQ\241\302(\267}\271\326PI~a0K\344\260\324\361\242\262\f\013"
+	.string	"\211\023d\016\243g6\037#oI\274\030\345\275Z\312^>7\225\346\245v\272 ,bF\2608\355\314\345\357\351I\313\"\242\245e\313\337\303c\005\356\252i\246~g\314\354\273\262\031k\231\240\217UFkM\203\nv\255dS\200'\347\313V\027F\371\nc\331\325\210\263\234\255\254\332{\220k;{\340\326"
+	.ascii	")c\364;K\365k\224\366\326(Ew\222dd\\%\013h\205\251(n\250\234"
+	.ascii	"\253\360\234F^\270\302(O\341/\356\222D\212\215\235I\346\272\304"
+	.ascii	"0*\344\303\206\313\351\244\023\023\243Z69\276\274\332\240\034"
+	.ascii	"\nKQ\207:\212L\262Y\201]\231\032Q\316Rx\213\006&b\030\345\030"
+	.ascii	"\370k*-\353\310a\250\024&\313-F\321)jW\027?Q{\317\230A7x\314"
+	.ascii	"P\346\344\374\344i\306pe\305\371\n\272qT\023\347\253\211*\306"
+	.ascii	"\005\f\314\213\247v\216\214+Q\270x\261V\235+\037\214\036U\242"
+	.ascii	"n\261\222-\206!\355\336\225I\245\354\245\322\350\347%g\030\204"
+	.ascii	"\234g]@\030\345&#Q\315\334\226`?B\334\312\270\ra\"\347\"/\302"
+	.ascii	"/\250\306n\343\332T\001x\241\2755\355z\2714\352\335e9\373\221"
+	.ascii	"\344\374\302\025P\177Pw<iR1\312\\\214\204\255\212\foH\370\b\235"
+	.ascii	"\2500p\306\254\320\241\304\214\321\225]\370\333\347\215\024\035"
+	.ascii	"5F\331\310\222\t5\243"
+	.string	"\324\2220\3726\034\344\177\017/\214\0202Qt\352yg\352\371O\373\250\354n\025v\326VF\001}wv\215\376\240\345\255\001\377\321\346}\205\223\356/;6*\223\263\343\325C\364\235t\0337\364\332\312\244S\313\230\234\362V\265a\355 \036\3329\244\223\253V\025\312l\356\265\267\221ZU#$W\2462\2712\215C\215d\032\273\327\252\241d\331\321\270I\247VU2@\242\260\251E\3577l\241\026\231\202\024\b}\306\b\031A\246a\221\210\004\\\202j\372\005\231\220\206D(\244\016MMP\301\2400\310S\202p8\243(\f\362\304\360\001\233P\032O?'\240S\372\031#,\320\200\002\030HE\240\214\241\257\030\242\250T\302\204\b?aS\013\340P\330\302\tX$\322\200\321\003\026}E\030,\212^\024\2010$(\002at(\002]\020\375WDbDq\350{\0321\004\306\210\001\005\001\220\030\024>\021\201\031"
+	.string	"\211C\337\213\002\376c\032\002\203@\031\352\031@\261"
+	.string	"\212\024&\360<\205\n\022*H\244O\241\")I\005\212$\365(\222xE%\340\tL\304\264I(\204@ig\350\233\361C\213OB\225\250$\301o\370\343\r\201E\2410FJT\002*.\005}NN\302\037\017Qi\002\240\223o(\001"
+	.ascii	"\305\241\257\b\343\027\244A\354\031\002\227|\300\031i\021H\002"
+	.ascii	"S\361\347K\241\224^\b\305\200\002\201W\374\f\004.|\002\016\221"
+	.ascii	"\212B\341\020\351\247\310\364$\264\004\024\341\347{J\211J0zK"
+	.ascii	"\300&\020|\301\b\200K\302\013\200?\337\260G\224\021d*\026\201"
+	.ascii	"D\225\306/\b\204\032\0018\214\321STB\221\244\016\201%\b\237v"
+	.ascii	"\226|\302&\032\276'\236\242R\212"
+	.ascii	"b\220\t\212\347II-Bl\200\201\013\3657\242I\370\023\026\205\303"
+	.ascii	"'\245''\337\260\210\004\374\371b\f\201\305 \023R\220\311\347"
+	.ascii	"\204\364\033\022\221F\034 \347<\247\247\306*\310\025\243\f\207"
+	.ascii	"\343|5\255\240Y?\227\206\211\\Z\024F\371\r\333\365\2144\315\270"
+	.ascii	"0\372:e\317\256\313.\316M\030\236\035P\344l\261\371l\221\232"
+	.ascii	"[2\272\"y:\254\216u\274\n1\251C>QS\003Oq{Ra4\210M\021\027\306"
+	.ascii	"\352`\370Y\023\003\004\214\356y\367f\335"
+	.string	"b\224\323\200X6l;\2540*'\307O\026L.\235\202\203\343\270\236Vv/W\240\231\325\2419\307\355\032\032\247\006R\352L\232%l\211\2223fxf\342\224aciSR\244:f\f\227\3419\262\2765\355\310\234\313\364p\264\035Q2\312o\273\266S\346M\033/m\306\204\350\252V-F\217v\356\202\306axd\002\201q\250\221(\247\230CFFFF$I\222t1\005\204(\005\251;\333\022\340d1\016\022\250\314\f\215\214(H\212\212JR\247\003{\021f\303K\334\243\236^\234iI%\002\244\3321\331\025Z<\227q\201\243z\001s|\202#\342\\0SZ\360\030\370y\310\226\362\313>\323L\032(|$j\261s\f\326.m\346\201z*\370\032\bW\205\234\b\247\211CL\310\t\220\300\367\377F\3222\327\217C'H`h:\311x\300rx^k\351_,\264'VA\301_1\310\321\267"
+	.string	"$\270\222\373\356\334\317Z\243\r\035\372\2646cL\277\353Q\020\253\367\027?\371\336\037\320d"
+	.string	"\"\273\240a\321zQ\343\204U\230\007\214\211\033p\343\306c\250\324\366\f\021\2518\374M\355\242\267iP\2709#Y\311N\300k:*J0\306\013\367\347\322\231'a\320\240(\340x\032\3351\021\030K\005\243\324,\300\372\344z\276\201\002\207K\"\227<T\221$+\303C\027\223|\353b\353\32772\357\0228\205?*Zt\215\263\3417\016Z2\374\344s\210\264`q\257\240\340\025\254\tCc\336\347\236k)\250\341\306\225gC\365!P\310!\021\207\367\330\016V\316\357Y@\303"
+	.string	"\206\360\030B\361\277l\260\025@~\327\363/\016\344\023\256\213\200\2424\214,R\207M\017\001\263q\t\270\222\316&f\242\207\370\031f\340\265\222\302\034\025b\037\023\177gfW\223\267\271^\264\363\342\350#\324"
+	.ascii	"(\311ko_R\033\265 R\021\200v\227z\315#I=\325x\354pc\211\266Q"
+	.ascii	"T\2032i3h\022qIJ\312\013\007\327D \256H\002\031\341\3076\351"
+	.ascii	"\377\305\245|\222\250\375\215V\236\027\201\302\033:zk\250\326"
+	.ascii	"L\203\304[\013\334t\215\314U\215H\344\3165\252R\271\215\354\352"
+	.ascii	"\223\377mk\027\331\036\277L\204pP\260\361]\025l\0020\250n\\\331"
+	.ascii	"$\216\202\312\334>\345\331\"\001\360\214'A\354\233\007\235\316"
+	.ascii	"\274K\271\022\347\"t\201\035\371\267\251\253\226\364\020\364"
+	.ascii	"\313\022x\226\260\362K\021\234#,\364\013HFf\341x\375\034\r\372"
+	.ascii	"\316\320\237\022v\323x\320\321SN!\240\021\003\352\225;}\364%"
+	.ascii	"~\226\260\302\020nI\022\234\270\350)k\354\314>a\233\265\265\364"
+	.ascii	"\357\034\377pX\236\247\342\024t\313\307\300\257\220\016\213\""
+	.ascii	"\226\027c\270t\003\3622\340\303\255qn\311\250\254\224\234!v\350"
+	.ascii	"\f\236\263\250\215\313\352\230x\203\223\335(!\023\004\363\021"
+	.ascii	"y\203\240\276\277@\024u\313SW\315x\375\023+\r\336\230\355\342"
+	.ascii	"\273\307\354\227\030\023\261\244\037\336\300J\006k\370\007\024"
+	.ascii	"'0\017\003\035\340\200o\334\377\2562\366}kmFW\246\372D\263\235"
+	.ascii	"j;Qom\177\006\306\206\301\b\360\335\375\302\362\207o^O>\223n"
+	.ascii	"j\016\020\260\307\311W\005"
+	.text
+	.section	.gnu.lto_.symtab.bdeefb57aaca444d,"e",@progbits
+	.string	"trampFrameGetSettings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"trampFrameSetFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"trampFrameSetPower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"trampFrameSetActiveState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"trampParseResponseBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bdeefb57aaca444d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
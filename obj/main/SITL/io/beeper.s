@@ -0,0 +1,459 @@
+	.file	"beeper.c"
+	.section	.gnu.lto_.profile.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 a\025\002"
+	.string	"\324\002U"
+	.string	"\f"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\013\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"*C~\216\003\203\005\243\202!*\343\2129\326\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\370?"
+	.string	"\013"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b\t"
+	.string	"\003\n"
+	.string	"\003"
+	.string	"\007"
+	.ascii	"1\007\203\3034\033\001|*\203\265\f\272\2016"
+	.text
+	.section	.gnu.lto_.inline.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\350?"
+	.string	"\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b\t"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"1\007\203\3034\233\002\301TF\300]\024\3137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 [\r\001"
+	.string	"pO"
+	.string	"\007"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007\b"
+	.string	"\b"
+	.ascii	"`\013\330\0076\003[\300>\227\315@~\033h\003"
+	.text
+	.section	.gnu.lto_.lto.1b329e28f87e8cba,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeper.43.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \351=\006"
+	.string	"\022\214+0\200M\032\003h*T\026\003\363*\027\250"
+	.string	"J\231X4\304\365xDD\0055\211\221\247)\031:F\f!0\335\021\343a\201z\267\037\267\334R\246\024\317\001^\236V\250\3700\35758hq\017\026\206\213\253D\bG\021\024b^t\021\020F'\315\233U\235&\030E;3\213e\264~\376\277\254j\327\202\253\316\277IAyI#\341\220\332z\265\3760\210t\210D\243\037\303c\344\237\t=\bp\233<"
+	.string	"\271=\026\200\334*[\023\317\215\027tl*:'\377\035\323\260\364\222\265E\034i8\031/"
+	.string	"\205\377]\032\316\205\313\334\326\240-B[\213\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperSilence.44.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \273\r\005"
+	.string	"\002\t\",pe\322\001"
+	.string	"\335\353\371\177\304\017\354\343b@\255\362a\330\322\330\b\277\366\006l\002\177\237\241\252/\336\004^7\306 \360\240\305\275S\n\256\250\031\257\030\033*-\205X\214\207V3\242T\301\362\212S%RN\235\272=\344\016\023H\261\273\354A\215\375\300B\316~\212gD\273\226"
+	.string	"\200\035\tB\035\333\237\214\331\244w\2345x0\025Piw\025n\216\375a\376?'h[\3667X\354\256\237\266]nx\333\b\333\t\333\216\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.45.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \341%\006"
+	.string	"B\013*2Pm\222\016$\203\310\"\242R\020\232\324k\020\202\206\273QeG\024\373\350+\345\372H\030}V\332\204\231i"
+	.string	"U\034\256]/*\246\276\307\332\270\311N\001\036N\004c\270\254\311\264\325Y\313!\331&9\233\206\207\3244\210\314\f\314:\253\245\207\261\226\230\251\207\243\202\t\004\375\364Q\250\361\007P\034\275\302\212\333\030i-VTzb1\361\370\017\363+\365\t\n\322\201H\214m\006II;!| p\226\245G\271\251\243\004\037\030\024\")m\0239N:%}\027r\227\220\350s*`\241\355*$\272\270\361~\203?\177P\t"
+	.ascii	"m\21173\340\234\031\036\276\3345\034:\204\241R\223\301]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.46.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \340\r\006"
+	.string	"2K)0`m!\035@c\203\024PD\250\343'\200d4"
+	.string	"\215\265n\236}\263x\002,\325\346?\244u"
+	.string	"\2009\220\273\3329\211\313\004\314\306j\226\220\235\002\235\r\004[\260\234\301\264\305Y\253!\231&7\032\006\207\314\264\207\304\b\3148\253e\207\261\226\227WT\"\202\217\222\370\347Ij\364H\251\022}r8\032i)NL*R\t\321\370\361\362\247\364\b\t\0169\"V\355\305\007H\373\0166\b\300\312\356I\360et`\303b\302\243\244m*\ft\230\334\210\035h\001\205<\230"
+	.string	"\024\332\236@\241\n\\\341_\360\347\377\t\t"
+	.ascii	"m\21173\340\234\031\035\276\3345\374\034BS\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_beeperUpdate.47.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \363\215\006"
+	.string	"\262\f.1pm\032\003\240{=\037\020\205\346J\214\252\323kr\373Yx\347\020\021\tAI\001-\201\225\354R1T]\241Bi\204H\362 \332\204\204$\2212\245\036\206\267\231\026>\234\027\343\203\024PI\023_\347=\007\007'\307\231\0326N\212\036\247!(\354\274\350>\020F\207\2317\0135\023\301$\332\tZL\324\232\362\377e\241v1\312\"\221\237\342\304\344#-D\003\323\326\253\365\310\034\322\035\020\275\374\027#\220\177\"\364"
+	.string	"\300-\343\201\212\033\305\002\025\267\312\226\3043\343\005\033\026\023\037%\377\035\303\260\364\222\265=|\241*\220\227E\341\177\027UU\270\314m\r\332&\264\255\002\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.48.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"\"\312&0\200\267\351\2003\242Y\021\026~0'\262\202\002x\250\251\022\301\321\232m\033\343]\275\326\232v\032`N\006\244\371\202\252\322\203\367\241\006\236\032\331;\245\236$*+)+qR\021CQ.q\242\231(9<+I#\300\2344B\334\276>\021\006\005l\356zp\263\337,D\260\237\345[\267[0!\261\020\316\203\202m\313\206|\2067X\256\223\001L\213,\034\020t\021\273\\\214\316x\3564_<w`\302\353_\365\357\360F\227i\327\237B\262\273~\231fp\303\333~\330\206\330\016\b\t"
+	.ascii	"2\003\202\341\243\302Z\025\220k83\242]!\310pW(\355$\003"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.49.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\240\270\200\352\272\320`Z8\252\310\332\255\024\231\366\\S\301\206\005\252*f\022&`\327\\\016\263=7c\215X\262e\n\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\233\307c\003\351\b&\023#\346%Y\\J\310\377y\315\217\330\222U\026\310\354XA\311\314\204\017\002\352\376;R\222\317\027\203E\bS\020\341\2708q\311\314\336\246\004R]\246\003R]\373\350U\274nM\212\033-\"\fT\004X\310\314Q\204e\364\326\337\340G\3705\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperModeMaskForTableIndex.50.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\2408\243:\363c\225\025\034Ud\355V\212L{\256\251`\303\002U\0253\306\030l\361'\207\331\236\233\261F,\3312\005\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\333\307c\303\350\b&3#\346%Y\\J\310\377y\315\217\330\222U\026\310\364XA\311L\205\017\002\352\376;R\222\317\027\203E\bC\020\351\2708q\311\314\336\246\004R]\246\003R]\003\351U\274nM\212\034-\"\fT\004X\310\314Q\204i\364\326\337\340O\3707\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.51.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"R\r16@o\222\016X\250\303\203\b\023\264>\\B\224\266``\314\240\005cxu\347o7\203\216{9\340\212\215\261\252(\236\f"
+	.string	"\262\2274\020\t\325\374\243\265\335,!2\005\021\f\327\373\343\311,\220e-@\354\202\016\227B\003\374d\017\320C0\006\2622\b\201a\031\334\304\354VqDO\342c\310=\322\027\223\231\371\353xWp*5\244%\363\342\305%W(\224\217_\373\315\357\334w\244$Z\343)\003dn\250\234d\346\301\035M)\016\346\277\"-io\257bB\244\201"
+	.string	"\222Aa:eFx\354@UJS\201\252\324\363\350V\267\335\2264\300\304\301b2\n\325e\0222sg1\302\350\257\177\3477\370I\001\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363Z0\361\340.(\325\240I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.52.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \313\255\005"
+	.string	"R\n'0\200\267\351\2003\242\271\025\330\00351\034\271\n\217\254k\252\f\306O\234\331|[z]\323F\203\302\304\210(\277\022Tz\317\rc\374\251\221\275S\n\246&*-)'qV\261RI(\221\242\22681<-I\343eN\032!n\017\265\307\245\f\004\260\271\353A\002\373\315B\315~\221k\335\256@\004\304:8\f\006\266\253\r\371\bO\250vC\303m\331\342`\013Xx\330\335(=z\3564W<w`\301\353_\365\257\360\250\303\262\353/\001\331]?,\033\270\341m7l;lc\002\b"
+	.ascii	"2\003\326\231!\340\200\\\303\235\021\r\013A\210\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.53.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \302u\005"
+	.string	"\202\311$.pe\322\001"
+	.string	"}"
+	.string	"1\252\260r\326\347\207\356bK\032Dr\305\026\021\273\317\336\214\215\206\3563T\365\365uL\353-\210\f\2106D\366\226)\307\256:\2659\033\222f\022\2221\036\022\253\021y\025N\265Y\245\204\322*\255\333l\005\206I\244\374\227\203q\363s\325Q\363\303\352\033q\b\325\335\005"
+	.string	"\364\0270}\376o\277\365\204b\273\345\333\351\b O\205\224\352\2762r\3302\264g\0261c2\247\222\3071\034,\272\373\320\342]\370\221\377#\376\037\376;\002\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8\\\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\355\002"
+	.string	"$\004\023\001"
+	.string	""
+	.string	""
+	.string	"\002+\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002,\177\005-\177\006.\177\007/\177\b0\177\t1\177\n2\177\0133\177\f4\177\r5\177\016\005\003\017\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1b329e28f87e8cba,"e",@progbits
+	.string	"(\265/\375`M\b\005/"
+	.string	"*QP\022H`ZR:\367\225\242\254\225H\\V\373\223&\177\027\252\340\273^\364\342R\352\305V\026\361\254r\3621\337\0203Y\371\027\2619\025\003W\326\301+\030\246\002\307t\243\251\367tf\205\263\016\0130\350\357\231\214 \355\223Fv\n\360"
+	.string	"\004\001'\001\215\240\343\356e\267\233{\332\335nw\3470\265\342\356,\240\327\271\\vc\031X\266\226\033\245\352V\241qi\315\367\331\005\013\243Q\236\316\256\212\335\374Z\301\355l8.&\373t\241\264Uw\347:\326\331\224\261F]\2132TG\031\367\223'Y\003M\214\272\276\002\233\237\331,\217-\310Q\036\201\302}.Y\213u\307?=zL\364\360\324\365A\366{y\0010\223\251W.\214\304P\3273`sX\026\313c\371I\216\277\222\301\375\354\216{|\311\032kW\324u(\023"
+	.string	"\256Y"
+	.ascii	"\360\277\223\373p5\205\253\354s\021\360'\027\001\361\342\250"
+	.ascii	"Yc&:\205\r\212\022\265\"\276?{\345\256\377d\352\237\267\376\374"
+	.ascii	"\377z\377\335\374\267\373\017\367\337\355\377T\355\277\364\177"
+	.ascii	"\364?\332\377\245\377\320\377Q\376\223\375\007\372\377\345?\317"
+	.ascii	"\336\336\336\336\237\331?\347\370\2015\002D\316\324\365\231\311"
+	.ascii	">\237e*\317U\306r\225\214\226\215zJ\016\253\201\230\274*&w\215"
+	.ascii	"\245U\324\303\326\344L\213l\345\031\355ix\272\305\272[\301\216"
+	.ascii	"\036\025\035\025u=\233\\\366_\307(\316\213\210\272\276e\177`"
+	.ascii	"'\231\335\035\343\0277s\212\007\230\1779\027\375=\331\227\031"
+	.ascii	"\374_\273\3373\327\275t\332\261G\256$o\250\353\377\241^\322\355"
+	.ascii	"\006u\334\314\367\311\345\276fm\315\240\270u\b\365sG\2771W"
+	.string	"s\205[\355\270s+\271\232)\336\030f\2761\354\002\265\022v\273\343&\320\013M\272\371}r5\337'\334\fje\273\375L\352`\225p\363\005\0037\201\336g\262\371*\271\232AV\316\256\255wL\022+\273\257\262_,\265\222L\240\351\033\303\r\327\235\241T\315d\320\255\0053\341\222W9mj\372b\252J\022\316qw\037XNu\301\255\234\276`p7\330\324\211^Np\343i\003\311Sw\207V[QuD>9\023\375\244C\222ef\330\253lm\332d7lw\273q\303\030\360\365\243j\356.\307G\022\207\231\233KW$qN\276\240qq\331\316\356+\307\0340\013\312C\356\314\263]\256#\343%V\367g\271\214&\257\361A\273\343\240\237\260\031=\204\304?:Q<$4\3245\253\311s\317t9\r\335\004\270;\231\351~\362\272\223?9\023\345L\2646\351*r\006\\\257\226\261\2173\001 \233\005"
+	.string	"U\257\267\267\f\207\303K\034\2142\317pavx\350"
+	.ascii	"k\241\302hk\313nw_"
+	.string	"[s:C\236`\3161\317n\271\314\f\331\216\367\322\225F4l\315\315\332Z\236\016u7U\257\200\373\322\232\333\311b[;{\236\3460\2768%\323\"l:ou[\3204\354\363\226.]\362\227\033?,[mn^\236\277\370\210I\347\336La\222\006\271\233\242\246\226\345\302\206;#I\226,Yj\303\351\323C\355\306\233\226<\226\245\2770,\361\225\224_W\033\271+8\322\322r4cY\370\302r\352\3341\267\224l\362X\216\376\332\300\002?\001\241\303\022\207\020Ad\353t\034\"\207P4\031\237\224\332\243Q\t\252EJ\261\b\361\363d4b`\372\025A\034[)\342\016\262\250\302\250\304\342\210,f p\034\236hZ[\250\341\007!\024RC\017\tV\264%\212\034\332'\022\303\245\243Q\203\020\222)\202\004V\312xl\"zh\241\210KP\307\013\310\326I\250E\016KD\211\340q*\022\213\307\341\210"
+	.string	"RQm\213\241h$\"\207PG\242\211\242QI\250m*\266O\304\020=\027\2721\252=\006\221F\3431\b"
+	.ascii	"\370&\342\261-\266N\354'\034=8BZ\221s\244$\243$#\340\221\222"
+	.ascii	"\204\302\244#!\373#\241\017\311$%\242\205\"\"Y$\023\022\262H"
+	.ascii	"T\221\3232\265%\214\036x.\024*\r\211\370\260\201m"
+	.string	"\202pl\243\332\226D\320H\f\026\211C\250`\323Q*\b\241@\3471\265s\2305\356&\320l\311\225\336]3\2718\360\341y\351\241E\315\2337YO\b\244jn\311\031\031u<\364r\236\316\327\221.+u\315yj\306\313q\236\3632\034\036e\316[s\200\251\250q,\306\0345\"\301\210\214\210\026$M\007\240\002\021\0323n\021p%\303p\246 \3110\0077S\256\320\023\364\255)\001<A\357\376\200{\362\336\256\007{\214P/\177.\310\214>\333\251\2176r\001w\2162\333\240T\252\033\247\323\213\252L\253\364\232\206\363\002\257\352y\357\255tp\246,\344\376(AA#&\307k\030'\033\026k#\273 \372\377kY\337\017\3434\"\311@\322\213d \240\331\213&\267I\0020\321\367}f\300\202\3450c/\226)oQ\256\210V\231#\3661\236\273\005\0055\024Q \022\325\364,*V\350o\212\230"
+	.string	""
+	.ascii	"A\r\250\035\364N\272O@g\324\241\332u0\372\324xm\300\")\343@2"
+	.ascii	"\n,\327\026\346\\k\303L\271\2672\215\244\tN\300\270\255\3678"
+	.ascii	"F\254\376\026N\311\356[[\001\227\227\214{7\021\244s\022\317\311"
+	.ascii	"X\n-\243\203\022p\265\344\370\226\3644\002,t\\\342\033\371\303"
+	.ascii	"&#z\254\350`%\262\030\235\270K\230\033\002l\277\333\367\244%"
+	.ascii	"\275*\271n\360f\342\220I\013\360\002w<qE\177\375Y-\216/\212\203"
+	.ascii	"Q\372+\032\201O\206\347\337\341\t\272\271l!\225\253\021j"
+	.text
+	.section	.gnu.lto_.symtab.1b329e28f87e8cba,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperModeMaskForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b329e28f87e8cba,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
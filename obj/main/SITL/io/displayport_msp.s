@@ -0,0 +1,644 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\265\005"
+	.string	"\344\b\n\001"
+	.string	"\024"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\330\370\241\354\t"
+	.string	"\003\215\377\300\244\017"
+	.string	"\004\320\235\262\314\006"
+	.string	"\005\224\217\236\327\t\006\002"
+	.string	"\002"
+	.string	"\007\b\230\232\324\211\b\t\361\272\334\207\001\016\002\003\002\005\n\240\342\234\212\n\013\263\326\341\254\013\f\262\201\245\301\003\r\330\271\210\336\b\f\002"
+	.string	"\002\006\006\016\253\301\343+\006\002\007\002\b\b\002\b\017\345\325\256\222\004"
+	.string	"\020\021\304\302\235\224\006\022\334\347\232l\023\024\240\342\234\212\n"
+	.string	"\020"
+	.ascii	"4\222N|~\327^s\r\273\316\303Q\3128\311\004\003\253\272k\b\020"
+	.ascii	"8\312\246_\025\033\304\331\333\331T\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375 \366\r\004"
+	.string	"\262\305\020\031\300\245\320\001\377\377\377\216\\\376\377\3777\246\221F\032i\215\020\322\332\2262\245\356\316\202><\233\304Pd\371\235em\b\310`\3670\n9\200@\353 \236\251\0339\255P\361\027\220\362\206W\324!mb\"\032"
+	.ascii	"\026[!1F>\r\202Z\3400\344\301M\314>\334\n\230\177AW\\\214\002"
+	.ascii	"\026\213\2000\237\364\242\n\002\310e!\022\364b*LQ\211Y\t\340"
+	.ascii	"\363\032\030\027\230\252\022\346\006\332"
+	.text
+	.section	.gnu.lto_.inline.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\020\002]\b"
+	.string	"2L%*\200)I\007+\325\f"
+	.string	"!N\201\t\017\270zj=T\005C;d\2555\311\210\204LM\306\207\260m\266\3557\322Z#[\356\024\333\3177\310\255F\224hw\016m\033>g\320\202\026\225\003ND\036,\006\b\030N\303H\377\375\203\002\274A\202\242\"\300\030\265\274\375O\362;\324\302E$\302\261\304\036Z\351o(\003\320\266\r\302\325\22695|\034C\333\344\233o\321m\316\006\\\251\231N\263\200m\313\210Eh\233\360\313\246\260\365fhss\020\242\255\362\317\227\0021 \220\002)!\252\033\202\221\331\220\001\030\023O\304\256\253e\216\360\002zq\203\305aO\231x;\263\233\001\0131\362-"
+	.ascii	"Ap\344\035\320\0210\016\t\221\300x'Z\335Dc\034$\023<\306\323"
+	.ascii	"\300\270\3502\r\"\225\305\013?\306\323+\3223\2168\234T\266\242"
+	.ascii	"X<\341\035\341\260\013n\347T#\311\240\2131\357\310\355\321\023"
+	.ascii	"\374\353(\220\224\341\261\321\n>\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`b\002\325\b"
+	.string	"\322\215')pK\222\016\375X\257\216\027"
+	.string	"\301\256\313\377\377\377\324\333,\206\235\316\017\020P\325\300\216\003\\#7mM\324>i{\313$\003T h\231\303@\253$d\341\274@\372<[P\3577\230>\024L\213Su\2264P\277\2362P{=a\240\326\r\347\323\005\352\306c"
+	.string	"\3214M\3047\323\242\036\352)\345\023\023x8\256>`y\342'K\f@\"\334;r>r:\257\244D2+N\217\242\2203\234\362f\317\310\353\237\361\264Qp\243\230\\\036\335\321Q\357\340/c\365\222\377e=\031VB5 \240\002\031\262\242\007\024\001\263\030\245\216\013k\225\345\030\021\n`\006\266\020\243\002\253,d\003r"
+	.string	"\2069\0325\256\013\217\210L\004\030u<"
+	.string	"\001\025\240G\316\214v\340\273\027@\022\310/\2209\231\317\214x\036\325\232\016m\033\301j"
+	.ascii	"\231\276J.@\367d\216y\ny\252;Y\267\f\177C\023\342\373_\326R,"
+	.ascii	"\r\205h`\275\023\275\256s\357\020\256\231|\214K\216U\200!"
+	.text
+	.section	.gnu.lto_.pureconst.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\205\004\001\200\004\002\200\004\003\230\004\004\230\004\005"
+	.ascii	"\230\004\007\230\004\b\230\004\t\232\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375 \343\025\004"
+	.string	"\364\004\311"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\016"
+	.string	"\001\300\004"
+	.string	""
+	.string	""
+	.string	"\001\002\022"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\001\b\020\001\001\002\002\003\004"
+	.string	"\005\001\007\001\b\t\001\270\006\001\002\023\020\020"
+	.string	"\013\f\r\004\200\214\260\006\016\004\374\007\017"
+	.string	"\0071cO313"
+	.string	"\005.cR "
+	.string	"\026"
+	.ascii	"\240 .\003\030O\321\002\0340\272l\366t\347\034CX\003\217\227"
+	.ascii	"F9\341\001a \004\334\035\312\342M\302\300\026\227=\234\005\025"
+	.ascii	"\033\177\3326\200\""
+	.text
+	.section	.gnu.lto_.lto.29de84bf2d31fe15,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.15.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375 \214\035\004"
+	.string	"T\007R"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\256\334\ryw\350\375\005yu"
+	.string	"\005\001\006'\001\005\200\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_heartbeat.18.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`9\001\205\016"
+	.string	"\006\334cF\360\2226\035P\243\222#\302\253\3159\002\023\3077E\f\376D\016t\006\227M-\301PU\305\277\322E@\263\b\206]/F\217\224\213W\t\203\2628F\370\254\353O\306\232\346\2335s\243\025\242*nd\357\275wJ\001M"
+	.string	"O"
+	.string	"N"
+	.ascii	"\266}\027\177\301\3314\3633\341U\246N%\346fw\261\316\013\324"
+	.ascii	"\323y\002\365T\2268\367)#\347\037\374d\341\242\243\363P>=\\\316"
+	.ascii	"\003'\0208\003<\323\354"
+	.string	"\364\250Qy\370\270\342\245\304XA\330]\307\316\353p\323\333&\261-\301\376K\377~\031\240\252\370a\300\307.K*\310\326P\036(\216\372\355\3731\017\355\313\243\303X\316\220\271F\366u\316\007}y\001\003\356(\222\265)*\032#8\330\354\266\210\234\332\201u\032\355\307\270\f\356\337\206\207\354\236p\354\330\375\024\030\263N\375Y\00127\335W\3344\325\017-\200\342\273*\253DyN\210T\r\351\254Ri\002\002I\2119\366m\374F\346\237p\206-\276;\365\267zJ\245\013\f\234\017\244\030\001\301Q\2273a\213\226RL\331\237)J\022\366\347\312\223M\243+\032]g4\r\376\t\310c\242a\253\"-\233p\3313\022\332@\024DZ\026\032\225\\\bm\237\023,\373`\030>% \314\243m\330H\307Y\250\202\206\211\262L\303\256\257\364)\253|x\022\226\034Q\344\225\\\261]\311\006/%i2i\356\212x"
+	.string	">\304\0065\005\304\004?\314\301\017\200\231\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_grab.19.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\177\001\265\017"
+	.string	"\006]hG"
+	.string	"\261&\035x@\363\031n\365c\375/\371\177\033\272\312\024Is\257\204&}gw\362V]\363\326ia\207\255\006\016\206\340\315\244#!kq\270&@\t\203\036C\217\207 \342l\036N\353\372\363\316\313\332\275\367\336)\005Q"
+	.string	"S"
+	.string	"R"
+	.ascii	"\324a\310\266\337\342.<{g\206'@\020\013\304JM\317\356j\243\027"
+	.ascii	"\250\247\363\004\352\2514q\357SF\317\277\353\023\346E\307\007"
+	.ascii	"\246|z\270\234\007Z!|\006\200\2549\252![y\354\221\005T\211\021"
+	.ascii	"\344`w\035?\260\303Mo{\3046"
+	.string	"\004\3737\002\006r\354\266\314v\254\214\322H\361\327o\337\247y\f\3457\226.\234\333\374\345\303\034\"\342\245>c\351\222\001\263\273)\277\306!\"\251\303P\205V\005\350Eb\003\317\256\313\307\251\031\204Pl\321=[\024\355\313\374\205\3670\303=v[\260\031\273\341\002k\241\007+\356\235\352\307J\025\342\277)\253L\371\217\210\031Lz\253R\226\320\340P\211?\366c<g\363Q\230;\211\377N\352\251\224\217=\276\304\370|P\305\007\t`G\240c\303\302e\025gv\310\212\262\204\375\271\262e\327hZ\243'\215\226\017\377\030\240\312\330\b\276\311F*\301p\252\250\216\213 2\t\304t\332$\240:\316\244\"\261`:\225L4\256\244](\221l\032\251;i #s\246\t\235\206\342\270N\023\205\253O9GZr\342\307\251d\261M\345]?\007\r1\262\225dY5wG4\360\340\231\231\002\242\202\377\3460\n"
+	.ascii	"tpz\276\007! @\002b\310\252\0366\263 h\233#\264\304\200\207\360"
+	.ascii	"\026\207q\314\027\206\376*e1He\307\3255F\301\017e\n\202\341\240"
+	.ascii	"<\303\003I\001\375\302n\t \024\314\276\320Z\243\222\373\322\224"
+	.ascii	"\340\002\270\303\267\357\344\346\340\226/7\322\007\355\226\246"
+	.ascii	"h\024\n"
+	.text
+	.section	.gnu.lto_release.20.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`9\001\225\016"
+	.string	"\006\\dF\360\2226\035P\005)\253\f\236\212\365N\264\004;)C\304Nd\264\320\242\326\324\022\270S\362\022\350\013\035\315\"\030v\275\030=R.^%\f\312\342\030\341\263\256?\031k\232o\326L\305\026\220\314\271\221\275\367\336)\005N"
+	.string	"O"
+	.string	"N"
+	.string	"\266\375\027\207\321\331\251\t\236\370\254\022\212\225\030\233\335\3158/PO\347\t\324Si\342\335\247\214\235\377\360\323\005\b!\336\227\362\331\341r\0360\205P\r\370J\223\343\203f\345\250G\226O%F\013\302\356:z\037\207\233\336v\211m\t\366_\002\007\177\031\240\376"
+	.string	"b\240\307n\313j\310\322P\036+~\372\355\3731G\331\230E\207\261\2441\203\211l\354\235\037\032\363\002\006\335O\243kYX5H\244\250\331u\0319\265\203\3534\332\227\361\031\335\301\r\027\3315\345\330\261\013*pv\235\032\274\00236\336[\334\251\352\243,|\342\275*\253L\371\215\210\225\ri\255Ry\022\006Q\2117\366o\034\207\346\253p\006.\336;\365\271zJ\345\207\030*\017\243\030\001\301O\2272)\225\013)\256l\260\024e\t\373s\245\311\246\321\026\215\2563\232\006?\312\247s\242\201\253\241M\233\200\271C\002\342>\024B\233\006\022\231\\"
+	.string	"q\036\224L\363d\030<&\237\254\263q\031\t\307\032\250\302\226\2054m\3130\220\364)\253<\352%-:\342\310-\311b\333\222\r^H\262\344\321\334\035\361 \274H\315i\n\210\t~\230\207\036"
+	.string	"2\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_clearScreen.21.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`9\001\205\016"
+	.string	"\206\034eF\360\2226\035\220z\272;\322\365\252\2015\034BN\312\020\261\023\221i\206\262\335\324\022\032\252/\376Z\027\001\315\"\030v\275\030=R.^%\f\312\342\030\341\263\256?\031k\232o\326\314\363\215\265M\230\220\275\367\336)\005O"
+	.string	"O"
+	.string	"N"
+	.string	"\340e\333w\361\027\235=3\301\023\237U:\251\300"
+	.ascii	"\331\335\214\363\002\365t\236@=\225&\336}\312\330\371\017?O "
+	.ascii	"|x\037\312g\207\313y\300\024\342f\300W\232\234\0355*O=\256|)"
+	.ascii	"1Z\020v"
+	.string	"\327\321\3738\334\364\266IlK\260\357\022\007\177\031\240\252z\030\210\331eY\005\331\032\252#\305Q\277}\037\346)\033\263\350/\2263hN\273\213\211l\354\235\037\032\363\002\006\335Q\243kUX4H\264\260\331m\0219\265\203\3534\332\217q\031\335\301\r\017\3315\305\344\330\005\0258\273N\035\336W\3343\325OY\370\304{UV\211r\225\210U\ri\255Ri\022\376H\211*\3736~C\363Q8\003\027\357\235\372\\=\245\362\003\214\033\017\243\030\001\301Q\2272<X\264\220\342\312\006KQ\226\260?ww-M6\215\266ht\235\3214\361'\237\216\211\006\256\2066m\002\346\316\b\210\373P\bm\032HTr\001\304yN2\315\223a\360\224|\262\316\306e#\034k\240\n[\026\322\264-\303@\322\247\254\362\251\223\260\340\210\"\267\344\212mK6p!\311\222Gsw\304\203\360!6\250) &\370_\036z"
+	.string	"\310\320\234\002\026"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\241q\231(5\364\321D\021\027#\250\"\203"
+	.ascii	"\023\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_drawScreen.22.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`9\001\205\016"
+	.string	"F\\dF\020\221\223\0168\324@\020\312\372G\241\354\335\253p\330G\0329Oe\344V^\252\254q\312\341\374]M,j?\362\376\003-\304\242R\231\035\226\004\200\n\212\016\326\n\256Bt\025\3043\214\345\325\344\330\310\336{\357\224\002N"
+	.string	"O"
+	.string	"N"
+	.ascii	"\034\333>\213\267\350\354\231\t\236"
+	.string	"\370\256\023\313\211\213\216\335\315<'PO\347\007\324Si\342\335\247\214\235\377\3603\005\242\206\367\225|r\270\234\006P!X\002\276\323\364\330\2409\371\352\021\3453\211\361z\260\273\216\336\267\341\246\267\035b;\202\375\225\277\004pu\270Q\340e7\245\265ci(\215\024W\375\366}\227\257l\314\244\267X\302\250I\355.F\262\261w~h\314\n\026tW\2258\253\342z!\001c\263\253\362q\352\006\234\323h\377\305Y\272\203\032\336\331E\305\314\330\005\0238\343\234\032\f)\357+\356\231\352\257*\204\342\275*\253,\371\215\210V\fi\255R9\022\3460\2117\366a.C\363Q\030\003\027\357\235\372\\=\245\362\203\013\226\207R\204p\340\252K\031\034,\025Sl\331\340)\312\022\366\347J\224M\243/\032]g4=\030\363$\241\317H\006\256\2166M\002\346\017\210\210\013M\030m\232\210$bA\304\201H2\r\224]"
+	.string	"\211\204\262\317\306e \036k\"\n[6\322\264-\303@\323\247\254\362\253\207\244\304\304\217_\022\305\366%\031\254\230\344\311\245\271;\302A\370\216\215j\006\210\b\376\226\207 \017\231\232\027"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\30151XX\021\245\206>\232(\342b\004Udp"
+	.ascii	"\"\222j\320*\221\246\024\n\n"
+	.text
+	.section	.gnu.lto_screenSize.23.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\325\t"
+	.string	"F\323C:0\345(\035\236\201|\277\020bQH\002RC\210\254\270\2704\230\037\030p\255\377c\377\307.@m\220\b\343\273c\353\"H\030P\212\005k\223\336\350\036\264\301%\204\020\"eJ\0013"
+	.string	"0"
+	.string	"1"
+	.string	"\237\275b\201\033\250\254\204b2\021\260\2731s\002\354\227\365\001\354\227j\374{~\376Gn\2550\302\023j\364\314\022v\327yB]\334z\333\032\333\b\3665\001\231VMg\246\257e\036.\006\001v-\302\325\266\\*\035\266?\033c\373i_u\221\357\240\350\002\273)\226\224]p\343\250\3752\250\331\366A\036\022jA\374DusM\275i\200\275\227Dh\273\024\007>I'\241q\374\362E\330\257k\301\213\212\224\241\r\216R3\354[\253)[\323\331\301\037\323\264\025\241nS\300\330\303\341<\320B\250\333\270\211\216\003\347}\030\342\366\211\017\237\016(z:/r2\336\270\206.\206\266\255\213\030pog\232!i\311\226\246f\252"
+	.string	"*>J\031Z\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.24.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\322\002\265\026"
+	.string	"\206\252\224K\300\322Q:r5\001"
+	.string	"A\324n}\342\365\250A\343|\270\335\022\341\205w\250O5@r@:v?fd\337Z\237_|hW?\264\037*\021\370\237\004\205\t\367\211\\\362\240<\320\256\002\001+P\033I\274\327 \204\020\"wJ\001{"
+	.string	"z"
+	.string	"\201"
+	.ascii	"\020\214l/\251\272\035<,Km\005\013n'\262yk\355\t\342\340\324"
+	.ascii	"\376\213\013\335\016\344\360U\255@K\303Z\201*v\235'\r<m\373,"
+	.ascii	"\336\342f\023G`\220\317\324\341\340\301\370Qku\265.\240<9\236"
+	.ascii	"U\236\334\022\277}\\z\363/\374\370\363a\352\371p\037=|G\024 "
+	.ascii	"\237\251\021\237nl5A\361><\315\361\355(5\037\324ZM{\276\0167"
+	.ascii	"y\333-\266)\330\233\022K\302\376X\027\310\254\24569\251W\007"
+	.ascii	"\376$'\372U7\372E\226\332|\360.\177\364\223K\275&55\251?\300"
+	.ascii	"\354\241\243\300S\255:\305 \025\212\254q\342\301?\311_\372\320"
+	.ascii	"V\231v%\357\220\220_\255UE\263U\277\3711.\264\3122>\343\366$"
+	.ascii	"\233\263\242\210\360\343\024U\353\216\204\363$\3359\360\240\211"
+	.ascii	"'n\347<\372y\212\252\265\246\234t\3139\036\335\020(\251\273\242"
+	.ascii	"\025\001./\372\336\253<\271Z\036\027S\037rM7w\027\305\006N\017"
+	.ascii	"\t\245K\356\225\356\364\032\t\352\345\270\320vrr\274\21112\364"
+	.ascii	"=\267p\026gs\351\002\360A\342\r\361\212\217\037R\313Do\342\220"
+	.ascii	"\017\025\"k[e\n\304\336V\332Fp\241-@P\255\225\301\016\365\370"
+	.ascii	"I\031\270\211e\271\346&\350A\302\221\322\321\242\277\345^\310"
+	.ascii	"\033\222\243E\253(\271\266\006\032\372\336\227\004I\bj\2678\033"
+	.ascii	"\250\243\001\031l`\266&ffej`\263\032\255\274\211\315v&\366\332"
+	.ascii	"\332,6A\345\327\212\214F\343R\233\305d\033^fd4\030\006W\f\346"
+	.ascii	"\252\201\275\320\270^3\232k\245\345\230,f\346\252\305b3\227\n"
+	.ascii	"\230\373\270&\373\341[t\224h\312Y\233c\233\265\rB\344Vg\233\261"
+	.ascii	"\326\021,O\372\205_E\021\321\342xBWXA\204\206\220\337S\370C\013"
+	.ascii	"\027\350{&[\036\210\210bpo|\2650E<v\024\210\375\247C\331|\023"
+	.ascii	"\0166 p\"\231c\346\001\266\262\bb\033#\030\273P\326\274\002\333"
+	.ascii	"\203\317*z\005'\b\376Y65 v6x\244\301\\\2617\335:b\330\247\221"
+	.ascii	"1\b\366\256\r\322\233\334\202T\036wk3\373N\303\226q+\327o\214"
+	.ascii	"\305U\212\261\316\232\205e\2415\334\226\230\203\340aVyW\330\336"
+	.ascii	"\322Mv\322 v\301\204\2144@\021\213\005\337k\245p\003\033\217"
+	.ascii	"0\202\027\326\271\202\206w7\322\r\332\2124\2450P"
+	.text
+	.section	.gnu.lto_writeChar.25.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`G\001\025\016"
+	.string	"\026[_D\020\221\223\016\244\270\343\202\212\341\023\312\301\021"
+	.string	"\f\3776R\024\322\312\272\325X\241\344\215T\342\333\216\r\371gO\333\250\266\205\331@\206\004\200\nt\324\025\231\234\323\002\017\261V\351_\374B\335J\277\021\"eJ\001J"
+	.string	"O"
+	.string	"G"
+	.ascii	")\270{\031\016`W\005\343b\327\0131\314\216\331\313l\373&~\202"
+	.ascii	"\263a\\\336*\345q\332\201j\301\261\273\320s\001\232c\327\003"
+	.ascii	"h\216\251\210sO\316\377\367"
+	.string	"ke\025\323\245LO\017\006\273\353\354R\034n\275m\002\266\037\330\207\t\232VM'\226\376\007\247\203\214\0017vUZ:6\006\366\202\304_~\373\2669\377s\307+\316\202\373K)\333\022\231\006\025-\231\335\r\006\216\331Av\f$]F4`A9\310\236f\250\220h\332\b\022pg\241Xw=\344X\360\264\217\342\001\252\034\265/\210\362\235\246\036\224\232\274Q\325\243f2M\035Y\305\234\244\261\035\242\254\226\025\033W\333\007\376\221\264\325\356\216\274\253q\351\265\300\207\232I\311\226\355\231RC\330\277VU\326\356\375\234\263\376\315Y\376\354.\377\025\025H\022\364\363R\334\324$~t\264E\b\035\177DB\242\223\b\243-\2060\224\230\204D\240\t0\202\240\005P\311\t\374l\"(\342q\fQ\330\340(\306\rv\274\375\265\252\322T\301\207\024=\271t\355\202 \221ae\313\233|\213\177\021\322\330\335w\251\001\033"
+	.string	"\266\231E\246\275\246\326\306\315\224\237\306\212Rv\177\225\315\316\322rF\370\022\252k\242\316\206\023X\026\361\225\271\001M"
+	.string	"\306\001\320\007\006\003\203"
+	.string	"\234\3010>\003"
+	.ascii	"#\004*\034\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_isTransferInProgress.26.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 n%\"I\032~\212\340\016\201\"\t\2608\212l\257F\037-\202\344\035\331\231\215E\302\335\346#bIJ\251\255\023\250\334\202\225Jk!qo\231\002\231\214\f\325\036\316\205}\0342\031\257\211N\304\205Y\0170ZP\302\352|\240Gb\220\2639^\020\022f1JX\315\325\215\332T<\213\237 \367<^\001vw\177\243w\r\035$\030\203\322n\250\024\263,\323J\310\257}\365;\367:\242$\232\226Ph\300\356\350Eew\036\f5:=u\200\322I\243\002\224N\377\b\t\332\233N\220P\346B\003\343\204\264;\341\373\320M\335\266\252\211\022\210\244\264\270\240\210@\3522\013\273\273\313\020m\350O\377\202_\341\347\b\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.27.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\002\01635Po\322\030 n\211y\3435f*\346\033\016E\022\300\344 6\243F\037-\202\344\035\331\231\215E\302\335f\001H\303h\273-\362\252\312\261N\255mD\332\3362\005\230\214\013\234A\036\353\n5`2Z\022\037\b\353\252\034`\254`D\365\tA\220\274\240\247s\264\036$\304b\224\360\271\232\331\267\255\032\325\241x\025?E\356q\274fvw\177\333;\206-\275\024\270\354\216b`veJ\371\370\263\347\374\316\275\206\250H\246#\023\n\260\273\251\240\354N\203\341F\247\247\nP:m4\200\322\351\377"
+	.string	"![\323\3511\322Xl\\\224\224v'|\035\252\251\323V%\321\001\220\023\226\026\023\222H\235Faww\030\244\f\375\351O\360'\374\032\001\007"
+	.ascii	"\265\311B\241\301\3143\227\225\235t\r\201\354\020\361u\315'"
+	.text
+	.section	.gnu.lto_resync.28.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`N\002%\023"
+	.string	"\226\344~H\300\322Q:\362\016\b\f\203\026\344\372\356\002Ty\317ya\"n\3776\301\341\262Hj8\266\336#\\\222\305z\372\322\205\361\217\336\002\345\242\317\265Rqp\024\034(\236j\206\013\314\033N\344\235\224\003\260\007\255\356M\266L)d"
+	.string	"d"
+	.string	"n"
+	.string	"\227n\340\032{u\371\225\355\253\375\240\013\325\276\263y\311nNii7\\`Pu\351\360\004\346\245\352\002\346\245k6\217\207?\033\342\243B\347Hjw\301\230\342\265\177Qk\376\207.r\303\335\374\003\361\370\035\310\231\350\001\300\331>\223\034O:\347];\340rTC\036\354\256\365\206\373p\313\333\236`;\202\255\272Svh\323\350c\377\333\335u\314\331S=\362\335\257\232\3529\325R\252\277\251\216S\255R\375"
+	.string	"Z\303\206\317\212\250#\334\235\251\037\373$\231X\374\350\267\357\023\235g\257\\\363$G\"(\335\356\376\305\217|$\243\244\324h\036Z\206\320\365\004\355.\215od\224\024\232\027\321Ln\302\335a@\202\027$\265\313\223 \0072\206\025\375me^\216\304\021B=\0214\205\200"
+	.ascii	"\351Z\302C\256G\210gF\233\345N\006\336\2322\316/\312\226\323"
+	.ascii	"`\372z\273\030m\326\227Z\252\335U\361e\304\300\f\370\001\262"
+	.ascii	"\231\227\n\344\326\203\344\255\2511\306\b\305\241\307\246S~\324"
+	.ascii	"x\235 v=F\006\325n\216\212\017\343J/\037\350\3220\031\375Mf^"
+	.ascii	">\22209\271\330\341h\337_^,\227\r\2639#\203QX\231u\022\233\275"
+	.ascii	"Xfd\260\030\255ECl\346z\001a.0\306\325\362\002Y\262\031xbbX\f"
+	.ascii	"F\006\316\300`2p\025\342\374\333\230\033\272\204\246\250^\024"
+	.ascii	"N\264\231\366\355\242pP\022U\364\025P\005\177\322\221*\210\314"
+	.ascii	"\200\322\335\336\342n\232>\317\302\005\375\3153\336\334\307\211"
+	.ascii	")^tk\216D\027\243\0359\352\303\376\215\343h9* `\2021\202r\036"
+	.ascii	"\266\227E\266\207`\333\223\007Pxpi\262p\263\177\367W\260\300"
+	.ascii	"\232\206\220\263c\270l\300'E\376\021D\247q\bL\335\203oS\031\334"
+	.ascii	"\343v0\302l\270a\334\353\350\n\245\345\233V[&\203\257\301zfb"
+	.ascii	"\241\340\347\005\2505\360\322\324\204\226\005\bcD\"6\347i\271"
+	.ascii	"\345\031!\247\024b\017"
+	.text
+	.section	.gnu.lto_txBytesFree.29.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\222N45Pm\323\001\004\210\250!\200\326\235F\223!\001\252\2517\3023\325\006\346\317F#\350si\312\254\232]\274\243\243\311 \211Z\313\214s\233^G\223\267\337\266\334)\005\230%\021$s4\325\325I\300,Yy6\f\325E)DI\305\006j\323\211\034\353\212\232\311\262Z\260\"&\245\025\245\271\267\352\004\241\037G\317v\360\274s\252\323G7{nOC\366\341*\310\n3)%\004#\273\022+*K\022\211\\\330\316l\311\366{\366;\356\221}>\034`\027t\022\262;\013\0341\217<1\266\375\215sd\326\340\254\3502!\215\b\020\224\335\031\247\013X\036\301\007X\036)\305\265?\315\377\307a\206\205\t\327m\177\227\203\335\365\343\272\211[o{\300\266\201m\214\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.30.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"m\006"
+	.string	"\004\013\324"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\355\302\005\177}\270\355\222\005{y\370\354\362\003wu\270\354\242\005sq\370\347\322\007{o\270\347\242\005mk\370\346\302\005ig\270\346\262\005ec\330\345\002sa\270\345\302\005s_\370\344\202\005s]\270\344\322\003s["
+	.string	"?\202\210\200\340\001YW\306\001U\305\001S\304\001Q\303\001O\302\001M\301\001K\300\001I\277\001G\276\001E\275\001C\274\001A\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\f"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243I\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_displayPortMspInit.31.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"u\t"
+	.string	"\226P?;@\345&\035\340\245\313\360\213\363dB\2110\250P\272\244\024\021?a\206\301\"e\221\364[\322\372\3266\032\221\306\206\3038Z\233\243(\247\003\334"
+	.string	"q\340}EDV\213\310&{\247\024,"
+	.string	"0"
+	.string	","
+	.string	"\027+"
+	.string	"\273 5\370\002\354Ss\002\354Sr\274\364X\362O\362+\344#\346Cy\217\001\013\273\353\370\241R\267\274\355\004\333\034\373\007\001\243\211\370\317q\305%<I\317\006\275(7\354_+5\354+\203\231Qh\355f\264\002l8Y \266Iv\346\213|\204\344\222\001\330\221\332\234d\002\254\260Bz\336\304\253\216\002\322\354Z\234|\365\271*\b\003a\237W\335D\244\3315\375\363\301\227t\276\307\247%D\361\337\247/\302>\355\366p\266\356\303\020\342\3526\352@l\235\326@\253F#\264\316\207z\270\216r\020\\7\007\216\206j\345h\006\356[X\0060^B\223\244\260\200J\312\203\226\005\023"
+	.ascii	"2\003\3020\323\302\270&0`\210\245\344\244b\0071[\201-\030\306"
+	.ascii	"\005\013\300\036hn\217\302\3335\261\032!\264\020\231\270+\246"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_output.part.0.38.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`o\001E\016"
+	.string	"\026\232ZC \255&\035\007\301,,\002\261h\366\352}\247<,\235\204\005\221\222e\020i\017;^\023\017\027\033\3321\007k&\207\204\325i\001\027"
+	.string	"\211\304\242\302p\n\022\035\036\320\201"
+	.string	"\350\301B2%\203\354-eJ\001E"
+	.string	"L"
+	.string	"D"
+	.string	"\216\326\241}\021 \023\333>\210\207\340\354\230\327y )8!2\245\330\335x\210]@u\370\036\240:\324\016\347\256\3718?G\244\320\365\250\0278\245F\244\fO\214?"
+	.ascii	"\034\273kK\303\ro{\201\355\006\366M\004\206.\237_\354\226Z\030"
+	.ascii	"X\234}\261\374\264?9\346Y,\t\007\024\230\335M\360\362&P\267\030"
+	.ascii	"^\332\037\361\025\356$&\f\260X\222\225\013\b:\313\232\357\254"
+	.ascii	"\261\001\272\212\310\273-1\261\246\255\261\301]E\304\272\213"
+	.ascii	"\202\002f\267;p\030OUSm\t\235\374\b*&\322\220\257\251G=#Z1\222"
+	.ascii	"\251\324\024\353\373[-\271\3224<\313\377n\372U\323\371\356\177"
+	.ascii	"\346\202\300\311nIJ\305n\200%>\374\345\366[@>\312\327\213\313"
+	.ascii	"\007\013\235\0308\f\236-sp\205|\200h\204\017\004\365\340h\324"
+	.ascii	"\232\f\255\303y\340\3312\215B\007\210\326\331x\304l\023C6\035"
+	.ascii	"\234\250\331:1\003s\246}l\321\223e[\274l\347\265\344\243\216"
+	.ascii	"\221P+\265`\273Rs\214h\005\325\024\333\231\364\263*' p\002!#"
+	.ascii	"\353\001.\236!\003\306(\236\350\221\207\021\376\030\201\305\310"
+	.ascii	"&FQ\243\031\n\f\220\314\326\030\265\366\355\227\250\003\265!"
+	.ascii	"RF\204\357p_\f\036\354\332\331\236\rZO\255\335\f#\372&\327@\200"
+	.ascii	"\003I\204\306q\254\254\006\311\027\271\0204\257p[x\2362}\376"
+	.ascii	"\265a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\325\001%\t"
+	.string	"4\f\321\002"
+	.string	""
+	.string	""
+	.string	"\002\027\177\024\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\032\177\025\033\177\026\035\177\027&\177\030\271\200\202\202\200 \022\177\031\005\"\032\023\177\033\002\026\177\034\034\177\035\005\f\036\201\204\001\025\177\037\024\177 \030\177!\031\177\"\002\037\177#\272\200\202\005\020\020\200\003\005\036\021\017$\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\r%\005\003&\001!\177'\377\037"
+	.string	""
+	.string	"\200\200\200\001#\177(%\177)$\177* \177+\003\003\025$\003\004D\003\005\004\310\377\241\372\001\001\202\001\003\007\b\t\007\003\013\001\003\f\r\030\r\027\244\006\003\r\242\007\003\016\r\302\001\003\017\031\017\tB"
+	.string	", \340\002\231\031\272\r0\260+\242\363\r\375\310\344\006\316\022l\017\310 g\233\265\330JByh\035\206z"
+	.string	"\307\203\303\017\344\342\245\272R06?:\334Y\017A33\332H\237\254\201\342Pr\0018\306z\250\007j\214\261e\312"
+	.string	"\252\211\353 \275SP"
+	.ascii	"7\b\312c\250\307z`\r\232\205N"
+	.text
+	.section	.gnu.lto_.refs.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375 i]\002"
+	.string	"rE\017\024\200\267\35130\0033"
+	.string	"\214h\024\370\244\327\376\273\021I2\005\022\256\007\223\277\270\274\003\033;\361\031=| I\332\323\356\330\245\005"
+	.string	"\217\321\030:\263\214\226\322\225\005!\206\271\261L-\004\004"
+	.ascii	" \204\236\267\300n\332\222\004"
+	.text
+	.section	.gnu.lto_.decls.29de84bf2d31fe15,"e",@progbits
+	.string	"(\265/\375`\001!\255\227"
+	.string	"\272\364\3505P0\222\312I\007\016\212\225\343)\017\342\r\372\233\26286\324\307##c\362\242\260\321\330\022\370K}\255\b\370\231y\214u\213>\263\316\335A\345\027[\366wdf6\211( \"\0013\363\347\323\222\346\300\004\020+\"\320\253\322?\304 \222O\266\224)\331\002]\003S\003c\203f\316<\215\rr!\0372\032N\303P6\344\301\363\031~\236\247\214)t\256\2111|\032\033d\361\377\030r\0314\234\243\210R\225\234\264\246u\254o\033\353\371p=\017\256g\277\365|%L\217\216\227\302<=0\321T\212\316\214\256\323s\224n\206;"
+	.string	"\217\335\r\203\327\351\317\317Yp\204\332\254z\33653\302(V:\r\374Z\232B\353\024\360\311d\347\372\262\316tzn[\317\242\n\3239\201Bv\345\201%\226\234>\020{\022\235B\205\351v\354\275Yf\316:;\246\233\240\354il\360\031\205\325\306\334\242\367\336-\034\004s\341.\354\307^X\013\3771\037C\271\217\365\316Xx\357=\317{\231x\215\215\337x\257\252\002\2606.\313\302j;\314\347\305!\301\333\323\330\340\275\367\020\374?}\374\003\347\225Xr\002!\313I\364\336\347!X\301\202\373\330\n\323\225X\2727\013\213G\351\313\323\324\340\275\317\006z\032h\240\201\006V#tP\034\001\244g\252\225{\330i\3759\217\201\260i\n\262\245\364\334\241\"\305\204\246S(\343\361\335\177{t\322(\321\262\\/c}\214\365A\353aX\277\302\032\"\216\345\030j"
+	.string	"\317=yt\3224IC\330\351KX\317\006\250|\310\006\250\017a\355ykvc\270\363\033\267\3450=\371-\275W\2119\201\035\346\004j\354\220(\235\251\3517X_\301j\202I\250,\205\317\030\332\303i_\301\342\226)\345\222\335{yX\313\222\324U\247g\261\236\321>\200\322e\361\234\225\207{\310=\352{\365a\022j\b\036\241\252`\022*\223\031`\235\240\264\356\332\275O\021<O\252\250 \235\376\311$\324\225G\250?\247\031.\273\313\317\017"
+	.string	"\026\022\242\261.\374\214\302\3171\374\f\303\317/~\206\361\263\f?\277\360\363\n?\253\360s\n?\267\360\363\fI\036P\260\002\005\003'\3747\361\367\331\317fgJ\370\257\376M\305\360g~\036\374Y\207\017\3607\231\030pw\373o\377v\373Y\003\027<\277\371m\215\031.Q\027\324\223\370\255\375\377\367?\313\327\277\331\222\304\360px\031\351;\177\203\371Y)x\344\177\301\366\362s\330\317b?/\371\031\354g\347\317J~\036\373\362\263\325\317_?#\371\257\363[\345\317\201?\367\375\214\367\263\332\317\317\237\241\374\374\344\347&?\323\370Y\351g\346\317\367g\036~\336\341\347\034~N\372\031\207\237g\374\214\364\363\362g\242\237c\374\\\374y\350?\340\317A?\227\370\031\347\347\002~\356\371\017\343g"
+	.string	"\376\317\375,\342\347\020?\347\374L\374\231\377\037\376\007\363?\372?\360?\331\177\007\376\343\375\027qxxx\370\247\367OU\374\004d\020\314\313\244uE\\\246\253d\302\211ik\312\tMiJ\204\023\332\326\324E\333\272!.\223R\323\006\323m\212\270h[`.\232\326T\b'4\255)'\264\255*ns\342\023\233J\353\002\362\304Y\234\230\256T\324\225R3\304\236\323S\353\372\335\313kM\267\251\300\275WZM?%\036\034\267\264'\265\364\246\244\305\004D-\001\321\272L{NJ\264\356U\262Tt\243\"`>\367.\021\336c\006\271\272PM\367\026\020u/\223\357\336\275\227y\357%6\257\236\367\366\b\341\344\214\212\272\267\252'\352^1\345\232\356\355\265\277\270)'4 Z?rih\316[\343\311d\347\365\333j\256h\314(\027\352\336\313bV\347\224\2160M\270\263\316\320\316\352,\037</\023"
+	.ascii	"\250\331\216\023\275\227\363\205\367\365uc=\223\2255\032\226"
+	.ascii	"\247\261A\"E\372k\314K\224\210\263"
+	.string	"\303\376\240@{M\217\f\256\347L\b|\273s\376\215\327t\255\327y]\327v\215\245\201\350+m\245\253\364\035C\373\007\276{\373\320Z\357!c\313s\266\001\341\374q\353\260\035\246\210{\203\3409\305\232\314\357il\254\225,Y\240\313\323\330\330\275\317\376\361Cou\027\357U=o\216\026\200Oc74\230d])`NN\225\002\004\314\232\362\226\3538U\016\210!P\235\3724\025\033\246\347E\263\351\023\203\265\326\351S\346Jf\275\215\256\267~\353-\020\353\255\334\232Z\2127\b\305L\332[m'\252\311\235\2154\264\263\233<\276-[\244\274\317xp81\351\264\243\340\300q\311Iu\332\317\035\265\273\261\037\235\266\031\316\223\035lL\332\007\017\023\302\247>'\253\t\262';sqN^N\336Op\374\250\270P\351\264\233\364\021\036+-\035Q:\3551b\216$=zt\332L\230\356\306\213 \336\034\323\325"
+	.string	")\003H\305\271\336\372XU\204\201\251kma\205I\336`\267\273@k\307\233\235\372\362\272)B\246\313\020\311\333\353_z\216\017\n\331\021\266J\363\241\353\210\021\256!Zx"
+	.ascii	"\356\320\365\335\330qc\375\223Gt\rY\313\234y\222\341z\017y\313"
+	.ascii	"\271%8\013\032(\231\026\362\337f'\013\024\230\017!A\210Y\234"
+	.ascii	" !\004$.!\222e\246\201\260\036\261\306\216\300\260No\231\353"
+	.ascii	"\343x\204\252\336=\300\2533\264\257\232\351\363\274L\030\260"
+	.ascii	"P\211\r\336f\363\304\233\314G\217';\270\216\330\310\021.\351"
+	.ascii	"\241\323\256R\373\232\207M\235\276\221\254\275\243{`h\363\370"
+	.ascii	"\233\212\327\236J\321\272h\367>u\254\022U\036\225NS\037\225\207"
+	.ascii	"}t0]\363\345A-u\372\314\301\201\303\210\326TSU\243;sv\372n\376"
+	.ascii	"\215\203\353\032j\206{\237\352\217(H\354:m\036\241\256\370yK"
+	.ascii	"\251cu?\316@;\n\212\0031\037^:\355\033\375\364\206j\033\r\025"
+	.ascii	"\201\326\275J\r\305Sx\257\022\017s\002\314\t\244N\200|\265\251"
+	.ascii	"\351\273\313\251\206\031\021/.\235\276k\374M\243\233\230n\250"
+	.ascii	"\252\304\324u\332M&\241*\300#\324^\372y3\325\374\375\211\341"
+	.ascii	"\3534\001\036\241\324\314@\036_\n;\005\354\261Ykr\216\3655\344"
+	.ascii	"-MvPud\370m\005\341S\251\235\273\340[\224\256++\247\007\204o"
+	.ascii	"\251S;\305Ra\350\361l\334w\346j\260\341\211Y\317\003\037O\265"
+	.ascii	"n\267o\277\215\315\\\226\220-/mm}>\234}\353\211X\244X)V\255g"
+	.ascii	"\275P\200\240\211\352@\255\370\250\352\264[\265\333)a\021\264"
+	.ascii	"\321\251\2052\335Zv\203\311\\\247\026\255uX\262\253\265\262N"
+	.ascii	"\355\331\355\254\024\270\2732\253\233(0.+\271\365ff\366\311R"
+	.ascii	".\216\013\234\204W\306\356\255\362Q\323\004\235\fy\332?&{_\235"
+	.ascii	"\236\350\003\024\206Z(\035\367\301U\232\362\261r\315\024\016"
+	.ascii	"\336\346\225\023\226\360\216\253\356\313\023\373\244\323p\210"
+	.ascii	"{\201X\305i\240D\346\013\335jk\334R1\324\326\260Mz\242<\2318"
+	.ascii	"uy\315\253\0237[U\304\242t:F|\262r[K\263\262=\274D}\264\016\262"
+	.ascii	"\277\350\226\r\"\206%\312e\275x\257*\304e\232\"\030\265`\366"
+	.ascii	"\252utq*\261L\254\230\r\263I\354\022\206Z0+\344\226\207\255\252"
+	.ascii	"\263`\026\313\376\340\275.\f\310\374\2428}d\276\366vR\253\007"
+	.ascii	"\226\005F\255\227\035b\221\340\300\355\211\251\373\262N"
+	.ascii	"\206Z\2575\002t\b\273\f\226\251H\354\221\234\270\033>jtj\215"
+	.ascii	"\240\341=\005\341\"\302P[\344K\r0C\257Nm\327\003S\033\314\033"
+	.ascii	"O*\220\365*\326z\265\td\345\022\305\322\353\364\352\215\365j"
+	.ascii	"\323j\263\254\017\fe\300j\275F\351y\237m\304\220\355\314p=3\240"
+	.ascii	"\332\303Cf@}\315\340\372\232\350\372\032/\353o{\350\250A\273"
+	.ascii	"\033\243\027\304\332>9\354\016\333\203\2238.7,\353-\tE\260\270"
+	.ascii	"\335N\265\315\333\251\337\246\361\276\234Qw\353\255\224\305\341"
+	.ascii	"\347\305\026en\275\215r;\034c\325\251\205Z\233j\320\030\270\301"
+	.ascii	"\232\342\203\205\372\355\r\373\324P9\034\032\232\351\364~LB\325"
+	.ascii	"\341\021\252u\372\271\265\201\243W%j\326iN\215\020\313d\231,"
+	.ascii	"\215\033\032zU>]\347\004M\330\311\334\322\350#\200Xb\320N_\223"
+	.ascii	"c\025\023\353'\206ee}v\347tsk\260\365\022ik\033+<C\273\260\323"
+	.ascii	"p^\325\211\035\250\340\241\221N\333\260\307\234}?\030\256O\367"
+	.ascii	"\326\"E\332k\025R\204Jl\220\215\315\354\355\255\301\332IT[\272"
+	.ascii	"\212\232\201\266\031\246\353Y/Y\334_\364\336+'"
+	.string	"\210{e_\256\256\254Ng\203\205\270K|7\234\267\252\331\245\243]z\214z/?\265p4{\214\216\236\226&\301N;\f\230\277\277\026\\\231\367\006\366\227\267\240\235\234X\037\224N;\260\217\250V\230=\324:m@\246\263\316,\177D:m/\255C'*\211\222\332\355\322\036\344\236\344\311\255O\317V8\270\226[o\2044\331\332\272Z\262\244\207p\325\265\\\244\250\304\306n\325\016\2377_oyC\017m\265\017\356\275\304%\270\252\246\317\337\277z\225\232\367\336\0345\317\333\\\312Q\271\206\331\347\327a\313\n\374\366\350p/S\255k\314\032FE\311G\247\3675{\3672m11\330\232b\332\342\341\204\266u\231L^L\021\315\273\305tB\273W\304ebbn\240uE8\241\335\251KC\313\024\337\347VK\343\021\004\234b\022\351(=\026\215\222K\245\372\"\024\312\024\305!$#\241\2431ER\211\224B"
+	.string	"##\244\343\021y$.\201\324\031\310d\321\022y$\306\b*\032\245IGB2\2122\324\"%\222\tJ\240#\245\214\0220\214\202\214\311\342\213\"\024\"\300"
+	.ascii	"\341E\212e\221(\031\264\264A\bi\344\242\230D\272\340I:B\272("
+	.ascii	"`\371\"\024DG)\210\216F\b\035\221:X\026\2258\307\030\275,*\213"
+	.ascii	"\311\032%\020\321Q\316\022\350HtTs$:\262K\240\026?9"
+	.string	"\030\225\351\320P\0201\351\b)\224&\227Gv\250x$2\032\005\021\207\212J\244TI|\022\210\350\b\205NRr\2514\022\025Q8`i<\202p\244\034\001\200\245\214\342R\231\364\002\350H9B\211\342\020r\004\243\221\020QU\201b\231\f:B\261D:Z\"!u.dL\026\217E\242\365\021\264x\240\205\0048\020/\301\004*&P\241^\202\t~~&h\361\263\276\305\217].\201V@\260\026\213\311\016\224\305e\222\0068,q\322\2422\250hTL\022q^\314\bJ\016\335\024s0\2768\026\213I!\345\r\321\321\230\\\276\300I\006\025\271(.\215\311\0316Je1I\204L\232p\004!Y\214\241<\006%a(\215\001,\203\2124,\223A\305\"\033\241c\222\262\230T\207\212B\307\244\027J\343\032\300M\024\201\216H\343R\250\2304np\244\224\261\223\f*\022J\225@E#c\fd\322\204"
+	.ascii	"\214\220B6K%R\rC\031\314@&m\226\311\342\rG\243j\203P\220\021"
+	.ascii	"\r<Je\361\270,\"2&5(.\215E3x\226/B\241L\026o0&\207\f8\362\250"
+	.ascii	"\230L\261D\"\223)p\226G$\244\013\032\202\222D6J \035%\220\n\313"
+	.ascii	"$\322\204\021E#\032\202`\334\240\026\205\2147\024\207T\345\f"
+	.ascii	"d2U\032!\205R\026\220\210-(\221G\251\021\022\251\001P\315P1\031"
+	.ascii	"T4\022\".\201$X\036\215\352\177~\\\230H\201\004\017V!\024GJ\031"
+	.ascii	"@\313$\362()\310\350Hi\034J\2014\2468\032\203d\244\020J*S\240"
+	.ascii	"@`\006\022\205$R\231D\022\262Ic\325t\234f\214\364\031v\0265M"
+	.ascii	"\016&]\241\rl\254$e\236\bq\234d\301\272\262h\354\323F\326\027"
+	.ascii	"\302N\323\245;\035W"
+	.string	"fn\007\303P\375\360\321\251%c\3130q\266uy\340\2270\30091v\314\273\234lt\235>\332\034T2\370\027\006\217(\365\204\220\013\214\355\213\303a\226\026\035s\0065$\254\005;\215e\312b\363\352\324\317\317\006\362\031\221\247\261\301\326s\222\006\016\3606\3609dh\230?:\265^\372\b\361\331\264b\362\367,'\221%\177\266\313\316\035\222,\036\275\267\262u\341\303\022\222w\233%\317\366\3310k\225\026\023\214\005vgt\340z4\321\322r\333w\313e\005\013+'e\267U\246S\273e\247*o.\312g\257\204\tA{`\225B55e\367p\312\354\232\370:\265Xn\333\270\244\366\264\350\37569`\216P\025\351\364\253\326\372\325\212\355\026\216\315\342Y\276\234\313\224rq\020\335\232l\355\030\274NU>;O\202[B\352n\361n\357V\260x\340\221+-\255S\373\303\355\025\"b\322\234\254\330+I"
+	.string	"\337\322\240Ym\225\007\032\013\315\217B\273.-H\226t\332t\017\354\250\271%X\035\202\250\250B\0011I\342\024C\206HFd4M\322\001B\n\020\006\203Q\240\310)>\022\340$9P:\007\315\214H\222\202\242Beg\016\252\215k\np\362\313\264\346\024b\n%\3163\311\307\263\375\324\006\276w\336\227\rw\355\033z\314\035'[\263\272\343\227\276jM\347?#]\302|\024\317"
+	.string	"\211!\247\f+\364\350\205h\363"
+	.string	"u\305\262\355\222\212M4s`\265\254\357\252\335\323\216\236\"\213w\264\226\226?\217\233\261+\204U\264\273\307\343K\nc4\270\313\232\360x\206\205\306\240\350M\243\301=\374\3242\265C\r\034\230\307\321\222\024EE\032\035\220\322\230d\017\320\007>S\221\340\fUcH\212\203\007\302\246oLD\227\3343q"
+	.ascii	"y\341\266\025\001\231\346n\277\301q\205\202,\261\270\355\366"
+	.ascii	")\247-\3249AR\300my\240wLJxI\f\211\032\212\356nk\226\224\337"
+	.ascii	"\254\033\271JcTtC\005\222\306T\306\226\327\216\324\315\256\031"
+	.ascii	")fO\220\363\353s\243i7\310<0\332\200+\025\234\204\274\377\037"
+	.ascii	"\363\006\354\3325\257\005<\235]\252\312a\250\253\257\f\354G\244"
+	.ascii	"\237\020\342N\330^\b\004\261y/\222<\231j\263\376[\024\353\200"
+	.ascii	"c`8\200Iw\356\216\3556\310\252\244\234\005\306\226\252\023\230"
+	.ascii	"\037\266\327\374\031[8\024\350\026[\254;(\017\202\023NQ_\025"
+	.ascii	"\371\004:\370\330U\342C\247\027\022\333C\224\337\335\264hFD)"
+	.ascii	"{\253\265\2716\344'\237&Lz\342V\273\314\003Z\304\241\007\244"
+	.ascii	"\310\037\301\373\004B\260o1\020v\n\357\261\273\347\224\264\231"
+	.ascii	"f\rv>\212\213@\335\2075\022\032\276\300\227-v\312\0225\0246\013"
+	.ascii	"\022\354P\367\320\230\235P\3353\032\333\356\302\341|\230/?t\216"
+	.ascii	"\007+\353\005e)gp\0062h2\312\307\275\3725\231\026\233\022\236"
+	.ascii	"\320\253\324\210\204\f\225\344\023\361\212\017\212\372\2372M"
+	.ascii	"\025\305\334a\\\027\002S\242\177\214\035\372\360 \005b\364G\022"
+	.ascii	"\256"
+	.ascii	"\006\t\032\nNQv7\217M\324?\214\333bV\204\f\236g\301\372\305\027"
+	.ascii	"\261\036Ur\366)\263\344\254\022,\2378N\325i\005\037G\t\350\337"
+	.ascii	"\322:\3025\270\bC{\261u\237\001\225Pp\027j\252\201K\241:?\007"
+	.ascii	"\350\366E\304\363\346\361\003t\210\307Up\231\022A\245\177s\342"
+	.ascii	"\211\322\233\240ua\305\263\232\fCa\301M\265\b\326vq(|I\004\373"
+	.ascii	"|\211\326\315\310\215\032\341x\351\321#+\030\227B\221\272i\312"
+	.ascii	"\336\005Z\024\373\332\226\221\326\\c\276\347\033\030$\363\b\n"
+	.ascii	"\331Q\tSzc6\262"
+	.string	"\366\265\\^\336R\035\017M\355\275\353 \r'\034\026\177\034\r\005-\276\003I#\313\007\376\3569P\253$_\260\341\271=|A\023'\243\235\265\363+t*\201{\247\301r|\274\373\342IH\003\204\201\312\245\247\025\310\264\t>\003\362L\310M\204qI\370I\276\363c7\275\033P\357\335<\037\001\311\353G\036\302\r\354f\301{\n\211\342\b\320\270\017\352n\177\240\013b)\340\244x\257\274\005\363\361\300\024|D\261$0\356\t0\212\230\275PX\352\311\377\b\316\017\210:\273\341\374 \211_\311\263z9\267\f&\363|HD\250,\251A \377P\371\311\317J\"\344\3217\340\232\374Jj\270\210\200\004]\n\236\330E\320\2665{~3\":\265\254\327\344i\211\344\256{n\031\362Y\035VG\247\020:*\233i~+\352,\326\373e\303\316\020\217M\374'\275o\315r\023W\362\022\330(\260\372Ht;\2563"
+	.string	"K\345L\220\r)\243\006\370x&\233|\007\321\220\r\212\003\004}\206y\246$\252\211\031\345s;\3643\360\343Npp'\216\301\2221o\024\343\22479&\212\335%%\326~/VO\237M\357q5Q\303\246(B\f\f\252\233\236\032\242\275\202\345U\241\256S/\261cM\374\3650\323\354\317&"
+	.ascii	"\017M\022\324\013\2245w\240d\242\220=<{\254\336\314\020W\177"
+	.ascii	"\247\355yu\2552L\346\026\345\031t\306\210\313\003\246~\363\001"
+	.ascii	"\363\364[2\217\001\300\240GK\205\007\276e\030\031\333P\371\242"
+	.ascii	"\235.r\250\2208\211\254s\317u\371j\223*\222w\265L\3211\300\037"
+	.ascii	"q\307\t\034\341\322^ \236&\270T\374R\335\\\241\367K\3703\267"
+	.ascii	"\3078\205i\301\b)\211\230\361\352 \265o\356\032&m\024a3\357 "
+	.ascii	"\013\245\016\333Q\223\340-\326\263;\262\240\370{\007\200\223"
+	.ascii	";\304-Ww46\324\016\320\255c\375i\364\223\307\261\350\372\305"
+	.ascii	"|3\376m\243\342m\251\303B\276\2754\226\232>\325\274T\355\355"
+	.ascii	"o\363\210''\227\263?\177N2\270S-\007\223m\203\307\336\177\370"
+	.ascii	"\362\006Q?G\356\b\0340\376\271\353j\344\367\177eq\013\366+\202"
+	.ascii	"-V\312{\332\r\037\235\323rF\273\r\263\310\337\252\371!X\203X"
+	.ascii	"\376,\302\034\3016\035T\311\360D`\317\357\357\377\n\350\031\367"
+	.ascii	"\260\372\002z\">e<\364\360\201F\226\321.\340\337\013^1\234\360"
+	.ascii	"\305k4!\332G6Vw\224\205\177\313\256L\"\207\372\373\360\t\353"
+	.ascii	"X\336P\371\235\274;W\324\343\355-\355Q\365\f\233\240\345\376"
+	.ascii	"#\227\352\273ok\231\374\237h\005"
+	.text
+	.section	.gnu.lto_.symtab.29de84bf2d31fe15,"e",@progbits
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.29de84bf2d31fe15,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
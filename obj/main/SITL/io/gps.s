@@ -0,0 +1,2554 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\223\bm\034"
+	.string	"\304\035\207\t"
+	.string	"Z"
+	.string	"\254\240\363\203\f\b\002"
+	.string	"\001\357\256\365\200\f$\002\001\002\001\002\003\002\004\002\003\002\005\002\006\002\007\352\263\360\321\b\003\240\342\234\212\n\004\005\331\351\335\210\001\006\315\343\301\244\013\007\b\t\300\313\272\263\007\324"
+	.string	"\002\b\003\002\t\t\002\n\013\n\f\013\001"
+	.string	"\002\r\b\016\002\016"
+	.string	"\002"
+	.string	"\001\002\t\002\001\n\002\004\013\017\002\001\n\002\017\001\n\013\f\r\016\017\021\022\023\024\025\026\027\030\031\032\213\326\277\344\004\033\034\365\366\221\316\004~\020\002\020\021\002\021\n\022\035\036\037 !\"\334\307\272\354\tt\n\002\n\013\002\023#$%&'()*+\353\330\375\377\001\206\023\002\001\002\024\025\002\025\002\013\002\026\027\002\024\023\030\026\031\002\032\001\002\033\030\034\035\036\001\002\032\001\002\037\013,\207\245\203\341\004-/0\352\301\345\224\t1\234\247\312W2\341\313\326\317\0163\321\314\377\240\0174\254\205\360\364\003\016\00156\253\337\351\203\001,\024\002\001\002 !\002 \030\002\0237\265\333\301\223\006<\013\0138\265\244\343\267\f\0029\272\276\346\304\r\002\002\"\002\032:\370\262\277\340\b;\262\273\233\244\013\n\002#<\306\311\227\362\003\b$\002%=\360\237\325\371\006"
+	.string	">\322\277\262\337\n\002?\214\221\341\303\007\004@\377\331\231\340\001\020\002&'\002'A\242\365\310\247\017\f\003\002\003\002\006\002\006\003\002\003BCD\261\310\330\313\0052\005\002\n\002(\003\002)\005*\002*\004\006\002\006E\352\263\360\321\bFGHIJKLMN\243\334\230\230\002\006O\336\307\230\313\005\004Q\257\335\357\337\016\002\001RS\246\342\337\224\0032+\013\023\030\013\013\002\013TUVWX\315\362\340\315\006Y\205\267\310\317\001Z[\\\240\342\234\212\n"
+	.string	"\201"
+	.string	"\250\261I9\021)I!\313f\240\002\252)Z\035\022\200\223*\016\250\220\261jfA\n*\225\366\317\255\004\037MA\257\275\2678\357S\200p\255K~j\216\206T\260\322\373Ej\006\362\343b\202z\270\220\265\375\017\266"
+	.string	"\022\"R\314\270aKL\"\220d\264\216e\260\321\255\313\310\361\304\364W\276\005\364p\347a?=\354\251\241\267l\307\212Pa(\2619\341\255\004-\305:\230\030 z\312GV\\\255\223\024\375\t\335\357\2763\357\267P\023\006\261\350h\307;\237$|u\256\031X\242\336\006\316\220\325$\326z\211H\364`/i"
+	.string	"\335D\005\231\334\266\034\353sU\352\232\2141`\344\314\235\247;\352;^A\217\202\336\240O\005N\364Ea\327\335\370\232\321Q\334\237\277a\006\300\032\272|,MHg\374\0057\324\017\035\270/\262\263\n\024\3768Eu\260\320\307\344\001\005\365\275\355s\301=>\333k\247\364\013\324[\270\271@\330\326\215\373\220 \003\337\206\024\203\223\236A\017<\004\331\0040\310{\261\303\307\214m\374\020\f\206\263\223\306'b\265,\216\334\223\263\315\351;\272\037\310ms\346(\021X\f\255\204b\367B!5L\022`\"\250\207"
+	.string	"\317(\200q"
+	.ascii	"\210\246\273\363\025}\354r\377\203w\263\355\257\262\237\307\b"
+	.ascii	"\347\317\262\315\017\362 \037\261aD\007\215m\320\005\223k\231"
+	.ascii	"\301\033\rG_\037\344\264\313o\377\210]\301s\032\370\3753\270"
+	.ascii	"\016\366BNg\203\177%\026\330\305\357\274\331\323C\236\004>\376"
+	.ascii	"\004-y\214\327E\331q\220\271\t\247T\363<\225'"
+	.text
+	.section	.gnu.lto_.ipa_sra.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\365\005"
+	.string	"\242E\024\037`\213\322\001\260\271h \b\202\3370\201M\222$\021\375\357)P\t%"
+	.string	"\373R\362\367\336I\006\275\301\270\013E\002\321\226A\036-\227\343\356V\2229\373\\t\257\203\341\302\204\373\331>\031\234\202\033\017\f\250\250'\351\241\026w\232\342r\307^Y\217\0043 \220\00214n<i\003x"
+	.string	"\2254\003/\032\0347\020\330vWPd\007 6j\3329K"
+	.string	"v\236|1\350\226\305\241\025\245"
+	.ascii	"B\351\307E\326Z\203qX`\330\026\212F\214\310Ts\2555\321D\214\027"
+	.ascii	"Z` \324\200\bA\020\342TG\005{\310?X4\350\304\225\027! \321`\235"
+	.ascii	"\315\214,(7\354^M&\005\030\002"
+	.text
+	.section	.gnu.lto_.inline.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\216\007\205\037"
+	.string	"\026\255\234G\260\230M\032\003\f7@\373\377\335f\321\372o\200\262\325*\2448\261?\035\323\026\340\230\337\246\322\206N\020\353\255\366\334)\304\304\bv{\245\304\317\006>\376c\234I\f\370\2702\007\302\025\n\361\360kA&\222E\266\224)\200"
+	.string	"\205"
+	.string	"\220"
+	.ascii	"\213\265l^3\320\002|\025sN\334\213?\317\352\324\222\235\222$"
+	.ascii	"\312\263)~\035\007\f\002\274\250+r\200<K4\316*\264M\240\240f"
+	.ascii	"\254\226x\363\007\355\234s\202\177\2236\346\304\365\354\313\233"
+	.ascii	"<2'\256\301zh\333,\030YO\300\307kR+\214\312\226\357}k\353\344"
+	.ascii	"\253\210\311\346\207$\0241knH\370\376\235U}E\242;\233B\177]\261"
+	.ascii	"\003\334Y\"\225\353\2204s\265\233R\360\006\016Y\004J?p0v\304"
+	.ascii	"\326pb\305\265\313F\022\217\250\200\200q\322,\220\211\356,\221"
+	.ascii	"\027\251\277\365&\275pXO\253Y\301\003\311\260\260\2601\340\013"
+	.ascii	"\311\034\231\336\225\242\331W!\311\343\210i\211\266\b\023\274"
+	.ascii	"\306\244\256\264\017\360\255\353\261\307\331\177\235;\277\031"
+	.ascii	"\316q\006\255\2209\347\201c\307n\213\005\346\002I\213<>\376H"
+	.ascii	"\3312\237\345\262\264\263\332i\341$!\301zW\322\200\323ds\332"
+	.ascii	"O\356\2336\255&w^S/\002:\234\315\001P\223<\031QIc\022\024X\257"
+	.ascii	"\300\032\036h\377\364\2668\312DY\211Ap\224!2`u-\261h\3464\312"
+	.ascii	"9\203\332\344\323\234F\343\030\212rlk\306\007OH\354\0138\360"
+	.ascii	"\203\344\246\271\342\032\"n!\367\004\211\221.\024;\322\231\256"
+	.ascii	"/W\271\202\\g:\233\177\300M\021\370%V"
+	.string	"\ro*\254gh\245t\t\243\224a\n\266\335\232s\022\320\3159\005<\341\231ng:\335&\275\250\226\264\264\267O\247\252-}\372\301\337\237\317\347\263\001\213\2721I\333\250$\247\2575\"Ce5\345\004\004\023+\325\263\2424\226E(U\224C\340xMRWtv&\234\221\035\202A\360\272\344\350\212e\331\035\201\022\237}\315&=t\016\255Q\214\243\252\245\334\003\376\243Ml\f?D8\350[&{\307\261\026\036\206\357\367\367\376\250lr\342\262tCCKN\006\202\230J\235\325\375\226B\262F\225\226\334\202=\354\226\016.\"L8w\370\200V\312\333>\3159\3059\314\375\2504U\021s\363\206g\001\200\261\250Q9RF\250dH\212RIk`\002!CS\346\001\022`4E\306\302N9\024\fm\312\254\261\277\001\214\020k\363\313\230[y\377\241\023\317\252\344\2751\224K\262\320\n\255\307!n \353"
+	.string	"\371\255\210\267\242\375\244\213\002\324\305c\3302\025\202\223\272\343f\033\236\0306\320\325[\344\355\303\230\201@\322\373\210\305\016+\247C\016\315\031|k\372\242\366a\363v\360\314nq\246\241)/\217u\225b"
+	.ascii	")\351\210\312\327\3411>\265O\f\207\262\256A.&\226\025\264yY\233"
+	.ascii	"6\013\242\373h\335\033G\267B\312\250\327\373\205\023sVW\274C"
+	.ascii	"Q\305\217\351[|B\224\350.\223\005\025\030u\270\236\362C+\210"
+	.ascii	"\327tS\036|\302\211\354\314`\275\264K\\\005\243\234\032\255\274"
+	.ascii	"\333\3112\007\b\bl\023(\023\233\261\002\005\335\206l(pYP\030"
+	.ascii	"\177\346%\342\366\\\236Y\033\346q\222\036j&\2156\f{J\035\022"
+	.ascii	"\\\205\257EYK\311\324\213@\b\271)/^\273R\210^\362_C/+\223\376"
+	.ascii	"\217\032t4(Y\303{3%\017\234)'\n\247\255\344\371\311\fo/U\366"
+	.ascii	"H\023\0241\241\305\002\360\210\007\373:h\220\242I\353\020\271"
+	.ascii	"k\0216\006\237\340<\177h\231\325\006\331sJO4\244\270^\311S\272"
+	.ascii	"\314x\200\207IM2\215o\020\245\223a\230\216\220g\336(\025_\377"
+	.ascii	"\220gK|\233"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\024\006m\021"
+	.string	"\206\326I<@M\224\016\3112\f,\237)\321&3 5\tO\253\221XF\254h\200\251d\035\3030.\311\364\337\267\344f\326\376\232\345l\344\252\367\266(hD!x[~\024\345\265\260\321\336)\2451"
+	.string	"9"
+	.string	"9"
+	.ascii	"YN+\217\266\033\367\373\335\024\316\257\346\370\036a\213\360"
+	.ascii	"\335\t\360\2545\355\f\341\356\232\336\256\272]n\037\340"
+	.string	"\311\354\213\326\325\263\317\211\375V*j\035\212\305\\\230\313\251\301}\003\344\244\221O\016\220\2235LD\241\270*\334Ag\2565\t\277\203{\031szp\357\370\255\204;?\270'\b\367\2463\332\206Z\001u\266Nb\214\321\001\026\362Bbh\310\026\f\243U\3202O\3153\363vD\333%h\213\340\357@\035\r\034\200\2733\270\247\023\205\"\235e\203`\376\333\005.\325\363\362t\264\355F\240i\017 \215\032\215H@p\003\237\365F\017B\017\310\262\236\365 G#\222\217g\003C\017\302\367\201\026\203\b\245\007\037\225\372\204\377N\251\265X\336\026\202\203\266\r\332\005\024Z\365L+2\325Q3E\233\250\340\022\231\312r\250\201\27525eR*\264\035P\002!\305\210\314\003\022\240s\031\204\301 +\021\023\210I \201HPP\020\243B\235\326\034\360\261n\004\261\203\210\364\215\370\246k\254\346 \347P9\233\f\201h"
+	.string	"'\301\027\275\030\210J\030g\321\207\342\377\202\214s[\351T\032\225\207\006F\030\350\223z\364"
+	.string	"\020\365\223\037,3\273y\211\345\221g\252;?\022+%\353\221\361\345I\370M\300\201\265\r8V?@9_rFhS1\037\177'\225\261\004\322\031\\JT6=\243gQ\304\220P\307\321.C\032a\027\370\215jF\277\234\353\302\n\365\254\225\b7{\331\3728\027\004\204\211\241\247\024\3414w\361z\240\362\030\024@\226\231P\275H\b\027/=\276K\373P\330i\247\264\320J@\fJ\025$B\016\234,\343\027\2003?\026z\\?\"Y\031@"
+	.ascii	"\005\020\f\320\023\304\342_\023c\205\324\356\214\350\303\246"
+	.ascii	"0^/g\006"
+	.text
+	.section	.gnu.lto_.pureconst.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 M%\002"
+	.string	"\322\004\020\032\260\3250\006\034\274H\033\303\340\266\025 \035\344\226[n\271?Ep/kn\031\032\b>p\201\007\374r\313\253\234\362\311%\013\221\007\371\343\2167\316xX\\\361\304C\274\303+\234\360\31403@"
+	.text
+	.section	.gnu.lto_.ipa_modref.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"e\007"
+	.ascii	"\202\311\037*\220\265\031\016\340\273\273\333W~\276\273\016\373"
+	.ascii	"\017\276=/B\bB\210d\366\377\377\377\337)\241\317W^o\305:\371"
+	.ascii	"\335\233H\231\002G\005\006\tf\202\252\274\352\244\312)\312e\310"
+	.ascii	"\270\324\362\275\367\336cC\345P{\265\3139\347\332\344\227\f\224"
+	.ascii	"G Q\271\300?~i\232'\035\247%8\346h\034P>\225\fJ\213fY\326\301"
+	.ascii	"\004h\025\377\324\371\224?\235\225.\210\3627,0\205~\270=\021"
+	.ascii	"\0020 @\002\244\234\361\006\255\004>W\302\370\257\bj\002\202"
+	.ascii	"#ps\177q3b{\356\005-X!\335h7l2|Z;%\311&A\346\302#<1p\310t\260"
+	.ascii	".4Xc\242p\n\235\256\300\261\267$\302\224\023\213\023C\3428\204"
+	.ascii	"\026\27260p\266\035\t\345m\314\031\0244\340\270(\250\026@:*r"
+	.ascii	"\350\242\261\226\370\301\025\001"
+	.text
+	.section	.gnu.lto_.lto.b890e4694cb680df,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.44.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\314\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_actual_speed.49.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_gpsInitData.69.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\305\305R}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\330\304\002k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\230\304\002k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\330\377\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\230\377\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.70.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\016\326C\006DQ<\322O\374j\232\036\227\004\252W,\034b\350\332@5\265I#D\246\022\314\275W'\224\356E\020\225*\214\246xHMGT\326"
+	.string	"t\265\320\371\031l^\021|\201\346\02283C\274efM\367&\207\277\372_\334\304\220\341\360\366T\200A1>M\351^-S\326\242\276\374O\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxSbas.72.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 \334\345\004"
+	.string	"R\210\037+P\345$\035(\202\2537\253\004\022H \001\003\352\2145\263\273P\363\034\344\314\314\264\031\0351J4`\205\354\325v\032\220M\032I2\001\212\266}\017L+\200\274\214\241\016\300\275\201F[\353\023\330\264g\257{\376,z\264\351\323*\306\255E$\261\212\263z\200\347\250x\352\002<\033)^j\030</P<t\r\340\351&\274sN\274#\231`\331\305\3428\335\224wVZ\203g\021m5\001\f"
+	.ascii	"/\202\240\334.\344\003\345\202\254\301 P.\310\032\f\002\345r"
+	.ascii	"\250\374\006P\004"
+	.text
+	.section	.gnu.lto_ubloxGalileoInit.73.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 Ve\002"
+	.string	"\344\003\004"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"'\002\002\177"
+	.string	"D\265b\006><"
+	.string	""
+	.string	"  \007"
+	.string	"\b\020"
+	.string	"\001"
+	.string	"\001\001\001\001\003\002\004\b\003\b\020"
+	.string	""
+	.string	""
+	.string	"\001\001\004"
+	.string	"\b\003\005"
+	.string	"\003\005\006\b\016"
+	.string	"\001"
+	.string	"\001\001UG\005"
+	.ascii	" \b\b\017n\274\322\006\006\340"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.78.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 \216%\004"
+	.string	"d\007`"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\203\356\263\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\024\036?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.80.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 @\315\001"
+	.string	"\304\0023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177}\001\001\005\001\006{y\001"
+	.string	"?\202\210\200(wu\277\001s\276\001q\275\001o\274\001m\273\001"
+	.string	"\004"
+	.ascii	"5\305\300\335\024\253\007P\004"
+	.text
+	.section	.gnu.lto_gpsInit.83.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\237\006\225$"
+	.string	"\332A@\016E\200\236M:A\335\215\354\322RT\227\342@\256Mk\347\342?\214e%\370\224\302\314\007\230Q\347(\355\030\2438V\231\331\307K\030\351\017\323\303\215\021\"X\347\037\203\265\363!\275\264\253\356\223FM\332&D\312$\003\316"
+	.string	"\306"
+	.string	"\330"
+	.string	"\202j\221\024{r\257\177\367D\245\342\325\220g\371p\027\2674.\\2\213\353\212\253\326\212;\271Kc\027w\222\037\\\334\236\353]\347\275l\274JQ\335vhq\345\251U\370\340\3442(O\256\360F\364dy\001\364\344\236\273w.TR\017FdJ\213Z\2555\327YK\362\371\322F\311\333(\324|\356\241^\016?j\375\364\034\251\372q\333\b\341\007\030Y\221oj\024PV\005\311i\221O*x\326\341\3331YZ\375\366\340\031\224\231\363U\346\305\327\343c"
+	.string	"(V\027\032-tmi\375\rU\220\261\207\\\316\340|<\356\221B\025\034a\177C\005d\304\201\371\221\362\340\025D\241\372\301l\273Pk]\356\371\252\276\270\357\256pw'\354R$\001w\323Td>=\264\003\274'~"
+	.ascii	"\301\357!5\202*+\305\335\211+\342dkl\304\260\004\364\304\035"
+	.ascii	"\3614&\232\023?\232\001\023\323C3b\243\257\032\372\340\027~\214"
+	.ascii	")\352\275=\231\227!Q\202\211\211\2328\301\357-\213\251)J5\324"
+	.ascii	">\354\273(>FL\2341\265&\272\233\342`\232\276\220\304\261\255"
+	.ascii	"\233t\327\351]\314\"%\265\326\245\375\226sa\261orr[\350\370\275"
+	.ascii	"\223{\035=\371\340\033L)\243\226"
+	.string	"\026\305k\273\302\0357\326\020\317\2155\333\300\335\346Mj^\244{}\217l\274D\224w\250yq$\257\320\310{#y\313\221\3276\362\322\221\227$y\307\221\267G^n\336;8\221\252\246\247\003\227Zy\254\005W]Lhc-m\262\273\317\027\035\036\003b\362Afi\307\303\351\244\254\265\322~\2303\257(^{rA'\224\234\222ZyK\273;\343\201N)\005\314j\345U\370s@'\225\361\264r^\241\347\025z\222\354\234\226W\367\330\237\032\344\307,\373\264--\316\037\257\261\326Z\311\2457j\226\334\032\b\3664\223\300\236\333\2249[\007\302\374\366\214\215\265\177\203\375\200cB\r\034oRn\004I\236|\261\341\316c\016\300\323C\373M\332\315]\003\314\031\251\253]\303\2513\354\322\215\2656\350Q\033\300\362\363u\306c@\273\200\371g\027\335=\203\030\370\275\243\206 \366\247\310\353\335\f?3\353\260\375"
+	.ascii	"\242\037\374\177b|\212\273\206\332\375\006\r\217\263\001\016"
+	.ascii	"0\314V\032R\237\270\034\002N\246\n\027\272\f2\236t!b\274p\"\332"
+	.ascii	"\024\022b\274p\312\351\314\234\013\023E\213\\\212\247\0309\t"
+	.ascii	"\003V\367\242\351)'C"
+	.string	"\247{\312\3416\352\r\334\013Q\275#+/G\003\033\341\"I\375\341r\340+\376\r\223\206+\202\2030\220\017w\004\3670\213\330jx\245)`\276\312\274\240)\231\241\245\331`P\242\376\020K\226=p\316\210z\331\307U0\366M\366\344q\372\330GO\336\316\022\357O+\332?}P\\\347\276?\201\320\327\371P\357\236B\316\037\277G\324c\r\322PDX\307i\004\200Y\004\263\241\256q\345d\005\3478\221\224\313S\214\343\304\312:\265\264\350I\\\237\354L\354\326B|\343\204\3625\027\314;\245\274\214w\267\376\232\255K\2062K\256\335m\262\200\001t\2501$\tB\244\224)\021\021\205IRH\007\240\002\021\231\302y\021p\025dL\331\004\221ag\rf'D\253z\0174dy\225(\265sA\032\345\321,\357\006\301\320\244\301\217\356(R\244?\300\006_QS\311\356\203y\013\313\374\375A\036\203\370,\201"
+	.ascii	"\342\344\003\265>$A\326\031\004\003r\026\306u\271\367\366\305"
+	.ascii	"\204\3363Y\031,\335n0\242\024~\234\311\202,\331\250\321\243 "
+	.ascii	"\225Y\020\351\206\345\334vm,\204q\202|\360\203I\016\264\030\330"
+	.ascii	"HvT\357\353\370\211C\242\330\234\214\002[ ~R\2463\234\203\245"
+	.ascii	"\034\255A\256'\234\177\022\003\335\2444\346\017n\301o\034\f{"
+	.ascii	"\237:x\361\360\363\034\303\311\005\367\300\3714\377(\264i\023"
+	.ascii	"\\\023\344\261\247\221\264\340\356\243\325\207\351e#\217'\345"
+	.ascii	"9\355U\260=??\271\377\262\231W\232*\327\201Q\301H\240\035S\360"
+	.ascii	"K\264\222\303'8\241U"
+	.text
+	.section	.gnu.lto_gpsInitNmea.84.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\224\t\215,"
+	.string	"\232L\260\020C`\250Q\007\013)\362`\333\024\002a+\277(e\340"
+	.string	"\204B\033\001\210\256r\240\023\375\366\351f'\311}\317\021rv%\262<\212l\366/i\343\025\377\rX%F\345\266B\214\264\265m\033w\333R\312\224R\355"
+	.string	"\351"
+	.ascii	"\006\001\367\333\206\277\323\373]\273\337(\376\306\367\373\336"
+	.ascii	"o{\277\337~\373\003\245+t2\224\345\254\343i(\223\3414Q\034\351"
+	.ascii	"\3135m\274\213+\273\325\226\341\311\306\301=Xr\316\252\343n\031"
+	.ascii	"\335\252\343w\260V\333\2678\227\325\221\277\024HL\303\204\245"
+	.ascii	"\231\345\234d\340\270\233R\307\005\\\207:\276~\204:\356\265\233"
+	.ascii	"\217'\267\262\207\025\242\361eP\316\271g\231\370\352E9\034\221"
+	.ascii	"z\263\2455\024_\373k;\320\213\224\356\305\034\316\350E,\362D"
+	.ascii	"\252\327!\022q/\342\220\277\t\261-\375\303\232[\216i\315\353"
+	.ascii	"\020\201\250E\032\217:\022,#\216\357\316\fM\240\\Qxu:\240\f\325"
+	.ascii	"b\360\357\335\031\341\360\310\025\257\256\216"
+	.string	"N\222=\016\346\006\274\210F\336\006\271\025\255P\235\023&\227#!\032\261_\213\220s\356\037\026\261\274\215\274\333\001t\267\210n\333\200\327b\247\330\021\331d\333\374tM65f\0304 U\377l34N\262k\265\272V\346?\324\332\031^\342\\=\241~\333d\255}<B)V-\345k~j\336\326\230`\216\271\3576q\342}\330du>~\220YY`;\031O\302\"\003\376!w\302t\302\264V\313L\373\231\357\037\346\033O\244\344,\261\366\261\346\223\346\ft\243;\001\324\361#e!\227\r\263\234\263\223\217i7\246[\231\230\223\331I\315\272\372\264\356\236r1(\322\234sT;\030\017\223\242\275\313qS\261x\037\262@\035\273u0\377\256\256,#\027d\325?\273\223Vo\265\272\335>\237OAm\225t\337\357\335\375vjr\2447\323\375^\272\337J\370;\351~\353\3567\022\376>\272\337\001\320o"
+	.ascii	"\366\333\b\375.\262\337\271\373\215\273\337D\367[\275\337\267"
+	.ascii	"\024^\007\2124G\316:\b\312AC\252V\013\3678\376\006\316b\247\034"
+	.ascii	"\246\267\3615\342\334\230N\244Z"
+	.string	"&K\364\302\017\252\266\306\204\303du>\346\224q\007\363\024\217\2253hf6\277\200\372\262-<\360\302g%e\260\2349Y_\266\224\247\035z\347\360\217/\235,\023\326\027\234\021N\350\207V[\216a93\343\276\354)\027\204\"\267\025h\351\b\252\210y)\033\363\007\252l\214+\275\235\001\302\3436{\363\363K\315l\026;\315\034\221\003\336\223\316\007C\202f\316B\037fH\205\n\024to\350\240'\2658XF\300\032*\310\232/@\257}\352\352CfKn\242V\3136\177J\3152\037\376q\377\241\250\255\331\353\024\032\255\376y\307\016j\261s\354\210\324=\202\244\377Pl\273=|x\037v\201\240\005v\273\034\237\003\243\275\253A\210\020\201:\306\026\007\305\020\3648\023\204\255V\377\320kgx\311\323=\302\337\374R7\001}\3039h\260\363E\361|>\236\203\245\276\341\036\370v>\036\024\017\002\317\347k\360"
+	.string	"\n\212\007\305\363\371\240*p\350\240\341"
+	.ascii	"\201\030T*l\227xr\261\342D\217j\252\247bJ*E\257D\013\027\275"
+	.ascii	"'\244\246Za\242E\357\005\025U\213\236\232\254\362\233#TY\253"
+	.ascii	"\366\260\b\300?\3447\347\234\213\276\312\302g9\356\254+[\352"
+	.ascii	"\277\376\212r\247\354\021O\345\275\256\262\247>\312CQ\346\226"
+	.ascii	"\276\353\271\224\354\3227\371-%\213\235w\320~\311\372d\215\222"
+	.ascii	"\n)(p\234\364I\222,\016\3369\342\3628\316>=y\022\351\376\310"
+	.ascii	"g!Y\335\033\277\b\222\305\3169\001\354\321\0139\262HMB<\220u"
+	.ascii	"J\332\357\343\177\254T\356je\375Z\277P\307\001lT\2234F\026\300"
+	.ascii	"z|\036\253\026g\323\314\371*\252\273I\374\216\225\213/"
+	.string	"\267r\276\202\340\270\277\370X+\330\2250\001m\237\200:6\262\316&\017\322\026Y\247\221V\025\200\260\250A8\252\0304E#RRP\220\244\305\320\002\021!\"\326\001\021\320(\205\034r\206\306&%\2054\006\0308D\310V\204\305MR\340\277h\251 \267\337\255\007\276m\353\025\331~p\326(\215\3766\374~iu%\324Gz[5M\371\2070\022\203_[\277K\334\357~z'p\316(\337\365_\211\305\216X\231\207\360\250\301\2239>\233\365Er\260\276\201\242\326%Ve%\\\304\002mI\220\357qH\006\001\032\345[rb\346k:\237S7\311\230\306\021\020\212~fs\261\374)\203\374\t\240\002N\307\271i(Z&\341\375\025\311\001Z\366\031\0363M(\301+\333\331\256F\301\321/\215\2534\327\347\200v\314=\216t\336\350hKC\240\353\204\311\231\201\003;\340\304P\351\300\327\365\001\310\351n\030\351"
+	.ascii	"\273\331T\216\2013\177\207a\n\004\037\355\017\0355\307\314\305"
+	.ascii	"\001\346\211\352\224\374<\350\3553V\310\273\253\002m\026U\373"
+	.ascii	"\276\200q\304\327\321A\034O\305-d\n\203\253\036y\031\264|\327"
+	.ascii	"b\314\r\356\260\377\256w\251\321h\023^\3709Fu\336\231(E\210W"
+	.ascii	"\225\035\026@S\201\362\345\013:\353x\325j\366\300L\r\300\264"
+	.ascii	"\256P\316\233\025\223\3133+\236\016)\316\013\022\274\226X\234"
+	.ascii	"\304\006F,5"
+	.text
+	.section	.gnu.lto_gpsInitUblox.85.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"e\t"
+	.string	"\326\021A: \005)\035h5N\327G\021\r\026\250\020\224\t\\\001L\"\354J|N0\340\242n\355'\373\310\f~\306\214\306\315 "
+	.string	"0\300&\300\202{^\254C\315\350*'\215\020)S\n0"
+	.string	"1"
+	.string	"/"
+	.string	"\273\033\025\344\250g\232(\277\363u\317\002X\327,a\303\205\345\371T\331\300\313C\346\256\347\305\267\312\334@\273\353\364\276\214[\273m\005\333\006\266c\001\007-\033\230F*C\033T\245\266\354k\030\206\241\365\303\316t>\375\215\240\344\265\240\262\213\021\306\026Fk!\261}\217Q\366\314\301\220\375\312\213E\312MV\355\222\245\346\305\241\332\262M\301Im@\211Y%"
+	.string	"oy\265M\022y/\265`\245\235}\223\237T\370#\2368\345\275k\376\211s\355z\327\003\016}L\244\207\310\211\"\204\210a\024C%S\374\b\230#9\224b\004\307\225\242\007L\035\224R\325;:\021\030\315\202\213\360\f\360lw7\353\244=\342\362^\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.86.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\023\001\375\013"
+	.string	"V\025NA0k\225\016\003\310*\216\364\260\302\036\333\3764x_W\323\214\375L\376H\243\242`<u\022\201|\370\223O\252\340A\322_?\2518\344\321\321ED\224\fqP\020\275%\006\310\013\351[K6\331;\245>"
+	.string	"8"
+	.string	"<"
+	.string	"\343io\341@H\345aw9\212\340\236W\215N\217?A\300\300\320{\355l\320\356\340\032\203\017004p\n\372\266\t\261\225`\022\n\2403r\261\273\236`X\340\336n\033\3036\205\375\001\001\376\203\247B|\005\257\006\320\231\007_\375\316\366z\032\t\261b\251\317,\355\361\233\324d\237\226e\0313-\331\237\376V\221i\b\260\332\025\225\262%\353\205\005\266O\261\307~=\227\360\n\213\364\346\354bK\304@\251\351\025\374\325\033\240\2264\301\247\340\227d\327\373\310\367\330^=\301\025\211\250]\373\021\374\221\344\264\004v\334\n\n\t4C\330\346\034\002\210d\027d\021\276X8\032\016\256\303p\035\030\215\fw\331p8\213\204;\315\306\206\373\350\272\rG\031?\327\226\2262f\344\207~\376\370k\273\273\025\323A\365\351\342\240M\246\235\351\346AG\2702\220\037\365\034\034"
+	.ascii	"3\241S)p\216\257\007\271@9\220\331S\303\003R\354T\006\320.\262"
+	.ascii	"M{\340\025\200\022O\271P\024H\241\374*\266\032\302@\304\247\330"
+	.ascii	"\206\013\326/C\214K\007\263\361\027A\232\301\234\272\024d\321"
+	.ascii	"e\345\t"
+	.text
+	.section	.gnu.lto_gpsUpdate.88.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`,\n\3653"
+	.ascii	"\nYx\023D`\346Q\007\263\315\350\201OL\222\032Q\245\374\213\215"
+	.ascii	"\021\360=\004\037-\t\370T\202s\200\277i\262\201\017`\362\026"
+	.ascii	"\346:\031\250\321\017\031\341\223r\361\225\2555\350\220\027\200"
+	.ascii	"\202\321\342<\372F\322m\367\336)\245\024(\001\f\001(\001\374"
+	.ascii	"\\\260\254B\245\235*\272\311\025\226Y\374\250`n)\255\266\242"
+	.ascii	"\233\234`\t\306\354\336\333k\225y\005s\257\325\264\307\314\355"
+	.ascii	"\314\r\245\243\264\215\306\202w\367\212"
+	.string	"\235m\271\267\371\304\007\330V\217Z\270\266\2326pm\225[\346;\335\034\273\255\205\f\322\351\347\336;\374 \034\344\365\333\006\022\r\t\375\202|=\336\216\325\005\327\324\350\205\336r\373\362\314\0246k\\\306\006\2225\021\231\020\037J\005\200\235\251\221\264\306G\235V\033s!2\036\376svs\005\245Ln\\\3704T\t\226\ng\024I~\271O\027\365l\003W\342@\211\366tQ]:\232\007U\352H\217\222(s\370N\027\225\326\021\214D\363\210u\2015\273c\331bJ\034\353\020\222\230\022,\325\245\257\366\024\303 \212\231\220Nk\177\301u\364\240\227\365\312Cb\243S\255\256\2626J\013\374\340\021\355qe\245Gf\332\220\275\326HPe\021\177\326F\013S \016,o~\\\310\324\351\215\222\034\235\326HI\224D\334uQ\367^\366$WW3\200f\356\034\314\214\200y\227!O\270(\032\234\356\231\305u}\251"
+	.ascii	"\256>3\005\013\336\3115\214\372\235\326I\310;\321ewz\357\275"
+	.ascii	"A\337\372\302\006fe\241s\257i\330\340\235\344\177c\327i*\277"
+	.ascii	"\322\356C\226\204\314(\304\272T\344\351s\257q\350\340\235\\\372"
+	.ascii	"^k\242-P@m\377\351\267\035\244\234\220\3733OQy'\377\217"
+	.string	"\262\336\270\305_\207\304\363l\350\250]\371gr\367\200\032Q\232\b\371\304\332\377a\312\234,\377\303\334X\232\355\004w\031\203\250\362NV\255\255\366\377\215;gK,\237cn\036\375\231\314\255\364\025\246\207\377\0073\353\214`u\036\352\234\241X\347'\326\331\211unb\235\231x\316K\215\326\255\304s\026\262\316A\326\031\310:\027\255\316D\253\363\020\353,\264:\377V\347\240\325\331\267s\356\261\316<\326y\267:\353X\347UuVu\316\351\352\374\252\263\253\316\355\340\303\333\032\026b\356\2351\027\350\266\251]\214p_\351\265\024\335d\035\236e\n\016K\260L\201\263F\364/\342\232\270\016=\3217ryt\244o\021[\035\355\327\327\332\352\320_-\253\234-\261\232\2702\267<<\213(\214\343X~l{\370h\231\314\265U\024K\247\0378\241 ~\347R\266\344[\023YK\304;)\364\351\030\250W\357\367\201\210\003"
+	.ascii	"\301\351\240\377=\220\315\326S\253\313\221\270\372>\350\323="
+	.ascii	"F\332\017\261\217\357u\310\271\250z\374\"\203\327\255\222\265"
+	.ascii	"\367-\206\244\341Z%\354\275Y\n\270\337ZO\313\244m\322\236\265"
+	.ascii	"gk\253\275\327=\345\242h\274w+\032\215\341\351\344[q\335=\357"
+	.ascii	"\337\216\026\330\321\347\236t\235\"\235\335\253O\2713\2647\355"
+	.ascii	"S\323g\207\344\314m\032\204\237\232<m\3077r\253\351\002e\332"
+	.ascii	"\214\036\307C\216}\261\317\204\303\035GeO\336\031\200\332p\273"
+	.ascii	"I\233@\207]$\313#m\275\246\241|\207\275\327\330`\375M`m\325\203"
+	.ascii	"W\313\210\035\267\033v\227:\r7\030;v\225\267y\227za-\\\216\231"
+	.ascii	"\245\372\f\221"
+	.string	"\275\367*\340.\323f\"p\227\265\312\022&LX[\325\275\032%0P\211\250\272`b\004\325\325\325\211\251 \236\202*A\002\304\320\252j8\242\312\203\210\341\324U\211!T\220\255HP]\rMXY]\r{M\254\376\037[P=mX\177\004>\363\315\334$\337v4\334\232\305\252\364\b\276\227\201\340h\201\035\325>R\342\210\322&\256\303\377$\255\266\204\310*\031\376\003!h=<\307\350\3203\271\251\241\376\303\0245O\017\365\315\206\224sz\245\177\372\326:r\304\221\024\215\355\361\270\266\352\364\255\326K7\334D\2032\2668\021z\246\227\0266p\017k\346\026\331\272\360N\n\337W\305K\031u\313B\023e\364\270\237\343\350v\022)k\372v\016\021\342lr\002a\266\223\245\334\207\230s\201\037u1F;\303\255@\317\332\262\3368\026\247F\3203\031H\245[\2565\230\006\370E\037\374\007\243u\344\253\310\356"
+	.string	"~\222\034\264\242w+P&l\272\323\272aT\241q\243nF\217\363=\323k\245\341\313\326\353\306\217,fpL\177\303\275\212?\257\341{\372\311\364\003\272\232\214iq8WQ\251\243\302f\006\267\246\373\311R.\203\370\363\030\317N\n\200\313\250Q(\005\231S\250DdD4IRh\f\240\002\021\251\242\252\003\0210-C\220\321\214\266Ti\r\322\351\327\347y\300DX\n*\316\352d\004c\002\333r\"\232h\253\361\022\374\003\267L\f\177\333\333.\250_\266;\210\034*S\325\225\316\\c\264\252\242\202\261G\267f\267\310\334%QF\272\002\222o\304\216Ja\033s\006x\032\002SX\342\302\267\335W\361\277\213\311\036/\031\336\020L\3652\2708\367\363\215h\347\347Z\206\223\375Q\361`\261"
+	.string	"\266\333V\\\216h@q\326(`\245\234\024\345wG\214\320\236\233/\370 Sw\037m\241\332N`\313<\230\227!\2014P(\347;\321\274\243\260C\214\013\326\t\321bf\330\330\214X\203\206\226\364\221=\205\255\313<\036w\311\243\276\023\235C\350\302\274\212Y\026uc;>\310{\200\226uc\343\365N\206\262\360x\305\241\375b)\".\310\231\251\263,G\305\215x\2513Yt\036\344\346}<\"\220\304\236$\206V\220c\274\213\204\223\316\337vT\032}~\216\242\005\241s\f\374"
+	.string	"Q\216!\353\232\325\037$m\363\254\360\fW\013\200\253\031\373\217\007\315\367[$>.J\363\305\374A(I!DPJ]\003\264^`3=\303>\003o`AYmdH}\342\372/G\2016\337t'\273F\314\204\366\265\023\260\346yT\t\274\236\310\314\310\016;5\310\250:\236\363\246\321\332\032\243"
+	.ascii	"\2774\275\250]\b;\004MP3xqKi\200B\r"
+	.text
+	.section	.gnu.lto_gpsNewFrame.90.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\230\001%\017"
+	.string	"\266\235eD"
+	.string	"\261&\035\304<t@\241 \265\230'\33288\377\377\231Sm\230?\336\314\2671\013-\242Z\327\345\344\323\335Z5@\\\2551\004V\237\311PU\325\nF\345bL\245\301\202\3527\364\262\b\310 {K\231RU"
+	.string	"L"
+	.string	"R"
+	.string	"\232\177\271`\335e\271\324\354z\nl {\264\355\005\fJL\272\347A\325\321\002\303D\246\306\256\267i\207\223\036\241&\311/=\252\n\247[\241\034\036\346\260&\205FL\216\212\025\312\025u\302\b\270l>h+\f\232"
+	.string	">v\327\331\255Nn\354\266\037\330>`\247\026\250\006>\211{\234\017\342\321\025F\371\356\321\037a\217W\031):.#L\371\331\336)u\305\276~\337g\303\252b;\375qZ\373\313\2379\0355\r5\2551\2350\375"
+	.string	"\021NT\251\325S/vU\037\216\275\211,B\330.\261=\266\003\002R\325\016\021\311w\037-\200\322\222SU\237i\252vJ}&;\246\374\374\023\007\271\270)e\216\273l\\-TW\216\302O\361\033,\333\222\361g\374\312vKg\371!\354\261\265-1X\036c\373\365\263l\277\262\333\004\236\026*wlKx\211\221l7\240\033\3441\"\021\331\270\320F!\0042\262\201D\243\315\243\303\034I\210h\263\300q\242\315\343\231\016WU<AD\006\232\025\351\2230\214\303\f\324\3640w\260AG?\032U\203\355\250\251'\337\304\375\001ww\343\200\204jC"
+	.string	"\311wZ\246P\265\223*\3474G\2003\003\006\036"
+	.ascii	"L\023\272*D(\200 \270\264\253\021\265\032 H\361\b\242\215\231"
+	.ascii	"F\374\343Gh\n^\006h\366\224\213\242\234\305)*4\202\324B\002\231"
+	.ascii	"\031\270\300|\032\305h\002=\\\023=&\216\365\\\230\340\0320\217"
+	.ascii	"\203\252)p\267s\313\023"
+	.text
+	.section	.gnu.lto_grab_fields.91.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\233\005m$"
+	.string	"zB\204\016J\240\230Q:\020,\346\236\231\234uO\027\026M\257\320\320\2452\016\322\nJ\334\360\262\217\344'\352\335\242\353\341\240{9\230\301I\307i\\\353)\214\016/\362+\370p5\242\257\341\374\376\023#\305\017vo\255\374\226\020B\210\224I\006\327"
+	.string	"\304"
+	.string	"\330"
+	.ascii	"\037\266k\035b\331a\336}\220\013\021z\021\304k\265\3168BUk1\301"
+	.ascii	"\016@_n\021\375\217\003\021\332\036\005\021CB\035\342\317\310"
+	.ascii	"\bW\255E\035\3566\346K\3625\346\313\256\2612\356}\2066\223\305"
+	.ascii	"R\330\013=\315\222l\356\355C|\346\224\220$d:\215\311\t\b\203"
+	.ascii	"gY\300\241\324\371\027$b\031\r\341\213\307\220\2308uqX\026\320"
+	.ascii	"\005\211\3139\001[\360+\227$dq\224\214P\245\342\350Y\300\025"
+	.ascii	"$\337\310\002\346N\300!\237\344\201!\024\024\317\002\262 m\246"
+	.ascii	"(mI\203Fl\006\021]\200I\022\"\275$\033\210\340B\212u\031UI\203"
+	.ascii	"\"\230\234\005}$\256\326\232\006\213\270/u\013\304\025`\222\204"
+	.ascii	"/\316\247\204Z\3532\211\240\360[\373\356\023\354.\204\335\222"
+	.ascii	"'\265\036\307\036\204\371\362\335\\~-\206\370\370\217\241j\002"
+	.ascii	"\204\354\231\266\276\324\007\f\251\272\362\224\245\210\273\232"
+	.ascii	"\213\f\036\\\335K\273\305\020|\003JbNl\317\330]\336\235\002\004"
+	.ascii	"tN\344\027\220{\361\307"
+	.string	"-/\200\034\234\333\215\215\255\346Q_\232\222\267\306\2743'/\315\344\235\231\2742\2247\206\362\246%/\214y_'/\312\274\347\311k\232\274\245\311K\276\310\267o\374r\311{\003\262\035H\202g\272R\353\321\221L\225R.\331\361\"\277\361\217z\357~w\205\366F\016u\251M\243zd\215\232@4\301\343\201\261\307E<\361\245\326\"\203\027Y\253Wa\375\210*\304\243/\265V\236\227\213`\227\344]\006\016\204N$\004zf\264\302z\351\264\315\354=\223\246{\210\325\225'\254\"\356Ji\307\343\221\352=s\326\004tZ\3263Y\303\224\232\216N\264\270\344\200\365\322^\352?\3621\351\202\346zI\323\3264\375{}g\306\372\347)\n\325wf\3321X\247\335Q8\360PX\377\327\002m\\\277\3724\2156\214\250i\313\250\f\354=\363\326:}*5y\361951\213\223'\257^\342\231{$>\274\033\246"
+	.string	"X\264\314\306\365\331l\305\327\243l\263\237k\262\313\276\200&;\245\322teTf\210\217\017\"\231\b\203\376\203)\240\313\020U\307\347\372|\262\261\345\033\022\361qU`)a\235\n\3163k\335C\252\266~\334\370\002e\366\322\260v\022/\020St*\023\234g\276\357\343HzAxh\r=\367\351\020\324\0334x"
+	.string	"\352)\2038\360:\220\031~\200z3("
+	.string	"\362\331\240\333\365\350<\364`\350\240\313\360\003\244S`\333\235\217\206\037]\320n\367\243K\213\365=c\221\214WX\264\235^r\306*|W:\322O\035"
+	.ascii	"\200^\tCM4\323K\275\363\362\205\031\342\343c@'\0374YN\357\231"
+	.ascii	"\323\335\277\225\335z\311\363\326\314\363\336\tZm=i\301\211Q"
+	.ascii	"Ek\026\303)aTR\206y\236\323\277"
+	.string	"%c7M\363)\351r\353\337\331\025+\320=\305\237\272\255\177K^\353g=i)\342\256\0135Z\343z\306\326\264\nD6\240N\326Z\253\214Ls:\205\221\211\216\022\301qlz\313[\337\364oS\232^\262\374\324k\236\3445]\240iTl@\361\025\024\022Z\261^Z\233\321\252\f,r\250Q,\303\214d\312\320\214\310H\322$\215\001p\002\0312\254\007\020hY\233\264\006\373\2404\2163\025\004'\233q\221j\201}5\n\033-\261\035Vo\007\b\226\247\322)\022\214~8\251)\300\025\311\375<\244a\023\337\006P\252%\316\340\f\210\202\316,\022\200L4\372\2348?\001ZI\334\366\353\232\260\305\267\025r\232y\312\226\214a\323\276\333Uo\217#$\307\327\034\265\"\273\366\"/obL\340*CIOf\201\315!\212\377j\207\227\305B\352\364\"\376\260\334p\226\005u\225@7rQ\316\034f\360\210"
+	.string	"\361fO\364\3249X\034\230% \341\347\302\0240\360\203\215\305n\342K\231"
+	.ascii	"\020\005Q`n\231\037m\007,\032\277\356\202\232\375B3\316\023\315"
+	.ascii	"&\031p\004#$[\333oi\316U\025^\257\263`\232\350\373\003"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.92.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`3.m\254"
+	.ascii	"z\b-:G\020\020\346\355\214\001u(\277\237\210\340\372\035E\267"
+	.ascii	"\333\375\277\211\3216^\356\330\232\317\035\247#\031\356c\350"
+	.ascii	"1!R\324\304\314ZX\266\026bs\246\364e=\246tp\001\013\314AN\031"
+	.ascii	"\356F\006m\035\353l\"\245L)\245\204\003O\003\250\003\026\234"
+	.ascii	"\251\216\316SGg\251w>qt6qt.\261\344Lb\311y\304\321Y\204\353\034"
+	.ascii	"\342\350\f\302u\376\340:G\271\316P\256\263\007w\356\360\316\034"
+	.ascii	"\336\371\311\2357\274\263\206\243s\206wvzg\f\356\334\364\316"
+	.ascii	"\027\216\316L\256\363\222;\037\335\331ug%wNr\347\n\356L\301\235"
+	.ascii	"\221\334\371\310\235\215\334\331\350\316Ewn\335\231u\235\327"
+	.ascii	"w~\327\331[P\322\241@\257&3\370\276W\022\027\275}\354\235\231"
+	.ascii	"\256\353\256\323-\327\275\326=\355\206\323J\236\344\025\234\202"
+	.ascii	"#\371\221\033y\307i\243+17s\323q\343\335\265\tP\272\016\007P"
+	.ascii	"[\323w\331\304\314\203cc\370\276]B\354\216\270\347t\035\267\035"
+	.ascii	"#\305A\301j:\376\021\266\310\360}_\244v\343\236c$9$\324r\372"
+	.ascii	"^I\"\253\263\343a\304\342\216c\244f\271\337\032\016\253\345d"
+	.ascii	"AE\231\276^5\334L\331\030\35606\013\325\027\332f\327\266\320"
+	.ascii	"6\353\314P\270\335\364\233f\3536F\212\203\\\337g\r4\352\231+"
+	.ascii	"8b5\246H(5\273\024k\310~\271\336\017\b\321\004\021\276\357T\252"
+	.ascii	"Y\026\361\336l\222\374\357;&\307\356}_*\006alv\205\013(\254t"
+	.ascii	"\222"
+	.string	"\262\034\224\002M\257\331f\370\276\323\252\017\303L\275N\233g\270\262\331\216\353\230\216\347X\216\347p\034\313a8~c7n\3438\314\306p\370\rOo\b`\243\006\215\0312b0\035\030/\\\264`\261BE\212*\024TSR'L\224 1BD\b\020\037\242\240<t\340\360\264AC\006'\fM\027\230,,\035]\245\244\n\024\220\216\214\214\305\226]\337\225\334\314\275;N\257e\263\035\327%yE\371\342L7\326<7&\346,\327V\336\244k_P\262\262\3469\034W\264\222c\330\f\267\236 \244s\350\302\2252\316&(\363\351\374\326\247\t\312\274\342\354f\030\006eZqn\363\322\034\307K\b\316l\"0A\231U\f\237\341<A\231]\346\234\316o\326/\236\026\255\310\250\364\215'(sJ\242\013`\003\261kT\0279\215\365\245\030\206u\237.Ek\215D\315?mw\3503\212V\002\300\222\250e\200"
+	.string	"\353\030\275\225\250\231\316\n5\327Q}\272\f\327-P\246\030\207\361\242h\365\325.\004\005y\213\242U\tR\275A,\352V\2609\203b\t\324*"
+	.ascii	"\001\006\372\024\324*\276\025\nMW\240\243\220\001F%\275r\006"
+	.ascii	"\305\262\247\247\366\032\332\245\327^0\303#a\317K-:qhB\260D "
+	.ascii	"\022yy\3604\264\253\256\245pB\032/\034\005\355\ndG\350\211\200"
+	.ascii	"\221\347,\004\035\210\017E\253\25089\016\345\301\215wX\325\244"
+	.ascii	"\235qx\nd\343\033\214\n\251\0213\b\212%\2605\314\311\315\201"
+	.ascii	"[k\243\266\246-Z\t\223\032e\320C'\r\\\235\322\032C\232\031oJ"
+	.ascii	"+\343\027\322\3108S\332\030\267\220F\202/\231\365\321L\214\273"
+	.ascii	"fe\256d\366\305\223\314\306\274\202Y[G\241"
+	.string	"\351\022s\nQP,a\215\004\346G^\334\250\213\033\033M\327\323\213\353\2111\275\257\356\323\025\266^\340C\026\210\344\325\364\266OW\332\n\345U\274\270\234u\311\312z-Z\2655\01623\177N\257\257~)G^\314\206v\r\266\356\373\276LPf\330\352E\253\367}\331\235^X\232\1774s\233\205\231\2070\227`\021@\214\357\273\325N<\274\203\207\267\223\351\333\251 \235\276(\277d\237\266\2225n2a\3004\324a\3073\312\243\303~g\254\243c\257+\312\315a\227k\333\300\261\313a\245m\354nk\0316\3665\2637\354j\177\324|Y_\203#\262\017\240\225\f\240)p\351#\314\320\206}\355\023\327\260\253\261\240\321\233\203\032>W\303\236\326\315\241mv9\202\0320BGcc\331\333\365N_\023\254#z\032\"K?\003lN\352\364g\3360\330\351d{$3\346\330dB'[WL\231{AI"
+	.string	"Q%\246$2h\222\005\265%\377\342vd\353d[!\f\254\202;\327\311\226\302\223\013\005\245\273N\266H_Y\220\222\022\373\310\275\274\353\250\002\373\354\033\2754\024>\352\"h\201\265%m\021Cz\323\311\326\350\223\314\246\270\223\312j\364-h5qG\321\221\361)$B\341\\R\214\337w\236\023\321\275F\212\272\370\017\310\227\316\364-o\306k\233-~\267\271S\351"
+	.string	"\215v\235l\333\3675T\215Xm\277\n\260\215#\320\031+\276u\262e\277\321Lu\242\244\361\220\375\rm]\356\266<\021\021\221'`q\f\235\314\274\351k?\272~C\331"
+	.ascii	"\243x\"6\264\376\004`q\244\317d\313\314\035ta\362\002\365}\337"
+	.ascii	"\030\334\204=\310\007\367\230f9\003 @\332f;\224\025\362\377\357"
+	.ascii	"&\242\240\177\003^\022\017\237}\335p\201\024\261\037\355\306"
+	.ascii	"\"\346|\263\006\032\321P\305Cm@H\204x\251\246q#[\356\023\372"
+	.ascii	"\017\311=\206\223\004\361v\006i\233m\300\313\"\303B[\236\310"
+	.ascii	"\275\327H\b\373\226^M\301\307\234>\377aA\r\210x\246\370p\367"
+	.ascii	"aA\r\211\317"
+	.string	"\023h\325=\334|,h\f\201fx\346}_\023z\317\n\235l\363p\347\261\340\023\"<G\235l\233\355\016\300+\025<s\207\231\005\215\357\273\3541\026\214\262z\377\250\311\021\276\001xM4\333[\276D \276\276\246#2O\231\376Q\346n8\213\254\274\374#0\273s\003::7`\32757\225\235\373\257\345\232[nN\234\034\270^kn\262\206\323\334\320\23667\230f\323\335[\264|9W\347\2462\245\3434w\223KJ\224wn\246\353\334[\256s/\231\234\373]rV.9k-9Cq\235A8:'\217\316\037\270\316\036\034\235;8:#]\347'G\347\254\243\263\023\327\031\353\350\334\344\350\314\201\353\314\344\350\274\344\350\254d\3119\311\222\363\006Gg$G\347#Gg#\354\254\301\222s\006K\316\030,9\027y\347\013\\g\"\357l\301;\017q\235+p\235)8:Opt\226\200\311\031"
+	.string	"\256s\004\2563\004\256\363\003\356,\304uv\340\235\033x\347 \2563\003\357\f\344\235\177\270\263\017\327\271\207\353\314\303u^\300u\336\341:+pt\326qtN\300u\316\361\316\b\2743\216\243\363\001\256\363\325\321\331\200w.\340\235\tp\235\255\\\347\033\256\263"
+	.string	"\256\263\r\327\271\206\353L\343\235g\274\263\f\3279\306\321\031\206\353\374\342\350\354\342\235[\034\235Y,9\2578:\253XrNa\301\271\312\2023\212J\257,J-Z\332f\033\320\223"
+	.ascii	"\274SJLLL\354\254\266\251\337\200\337v-\225\245\312\366\347\366"
+	.ascii	"g\267\006F\206;\337\227\255\272\251\252m\370\304\370(\267\217"
+	.ascii	"\037\241\007 g\217\377\021\266H\372\304\323\rGh\257o9\205\301"
+	.ascii	"\343\247L5\207v\201\347\361\335\334\"e\201g\022vH\n\245\205O"
+	.ascii	"\224\027\037\265\302,\322\025f\310\225\003m\343\242{\313\263"
+	.ascii	"\313\2770\3532\254\320\216OT\340w|U\201g l\360\320Kx\323B\307"
+	.ascii	"+\352\2546\201\327\301\217\350\r\263\270(\273ti\233M@\220\364"
+	.ascii	"\251\207"
+	.ascii	"\205!dU!0etQ\330_Z\241\034\202_\210\244\242\016\022SF\017\370"
+	.ascii	"\034_\304k\"\342x\004p|+hP\360\200/\366\021\002{\276~8B\\V\\"
+	.ascii	"\005B\242(\003\364E\0315\340\257\276\270G\3753\340\213\324BD"
+	.ascii	"\314\254e\370\177\220T\324\357\363~\224`\224d\312\2502\3326k"
+	.ascii	"C\314\023E\023\360\0054\364\t\370\rds\3564\021\267\366\272\t"
+	.ascii	"a/\253%\250\350\343\317\223\316\371=\354W\244i\257\267,Aj\206"
+	.ascii	"\360\235\222\245\370(\273\215l\033\372\305\245_\032\266=[m\365"
+	.ascii	"M\366k\033\327\330\215_\337\352\233\353\314\347i\032\177\343"
+	.ascii	"10\343\356\200\201\376\033\342\032[\033\331\332x\001\276\221"
+	.string	"m\215\267\361}\247\306wZX\235\303\247\225\246\361\r\346\3279\256\261\031O\343\333\275\267e\374\214g\253\\\210 4\343\265-^\3067\261\305\275q\215\265U\b\323\252\374\254\327/.\377 b\333{\266n\2572\212\030_'L\020\030\037\343\327\252\324\035\035\030\317\302\025\242\025\236Q\275\240\033\022\304\305\277x\026On\216\213g\373\n\305\332\272\311sm\032\262\233\202c_\223>\335\330\325\376HC\3708\253#\362\372-\036\211\f\356\255\211\310&\361\245X\210y8o\244\334\254\261@Df\350\304\n\022^m\215\212_\361\355^\232\032\025\337\022\016\016\002\303g\"\005\231/!M\325\247xv\257\211X\244\242\370\252\317P\345ZS\342\331\254\327R=\212w24\365T\337Sf\312L=k8\250\347\277\344)!e\346I\3102\303s\026\372[\026F\n\357\305z\311\235\2539\364C\342\243\216\227\350\241\354w\203\037"
+	.string	"\366\272\300\037cO\003l\245\355p\203n|\304\211\263\007\273\032\361^L\374\211\243\316jK\274\211w\252r\241ar\331R\342\333\351\240\032\023\320D\220H\363Y\224hX\370O+\321\332\021O\342\233\013\215\210\037\361,\336\324\025+\"\236\355\033<\263\373\022\"\3043+\325|\025\344;A|\210g\375\232\210 \\\252\333\355\247|S\251\246l\343\355\004\361,\341 X\237\224\271~\270\301. >|\224\2566\262\215\372\017\337\315\347/\243~\303\237<\037\240>\321\327\264\207\207\372n~1=\261\252t\023\304\303\367\0320\276\303'\3331a.\352\243\234\242\223m\207=\211\016;\360I\343\024AqxD\207\236\236\303\267{\205\b=\355\035z\270\323\311v\003\341\340\206=\351\033\241\016\032\236y"
+	.string	"\027t5\"\220\255fx\r\200"
+	.ascii	"3|\013'\310\027g\217\203\323\237p5U\346\327N\f\357\364-\036W"
+	.ascii	"\241\237+c\037\f\337g\300\354H\327f\034\212>\231u\323;\324\373"
+	.ascii	"\222F\276\246\35710\274\303;8\375p\202x\033.<s\001\276w5\242"
+	.ascii	"\354}\337\027\354z\\\017\307\222\0349\332fYC\316B\246\277\240"
+	.ascii	"\301\333\315\363\004E\222\030qB\001\223$E\234\030%\311\302BB"
+	.ascii	"\244\210\006D\214FZ\007\217\"I\2064\301\240\230$k\001c\007\027"
+	.ascii	"\344pR\004\t\221!=\236`!%\031\322dH\017'C\200<\301:\"\322L\004"
+	.ascii	"\005\026\223\f\252\226\030\251RbdH\222*\"M\260\252P0\361\022"
+	.ascii	"&E\232T9Y\262\244I\025\322\326V\257:\272\371\353\224\257\362"
+	.ascii	"\367P[\317\344\236\362\375\367E\346\336\235\255\036\037\345b"
+	.ascii	"\277\264|K\371\346\372\326\362\354,\226\226\362L\304\002\245"
+	.ascii	"\317-\036\037\345(\200]E\242\374\017\261\277\005\266@1d\255$"
+	.ascii	"1PY\021D\210\tc\366\026[\005\311\326+\261\351!\342\035I\313\275"
+	.ascii	")\275|&b'\330\351n\353#\034\242.}\n\314u\177y;\033K\300\255t"
+	.ascii	"\222\333\236\225\030M\355n~\025\226\313P\314/M\307G\023\270\001"
+	.ascii	"\005\221]\276k\236\230\353$\204\223\203\203\365}\2417\b\341x"
+	.ascii	"\"3\340m\247\361\264\362\030\235\314Zz\264\366\274\235\374\324"
+	.ascii	"C\204"
+	.string	"\224|GZ\257\374\256\206\362ZG\036\312c`\323\303'\371 <[\375\340\223\357d\350\310\177\220\350\201\237\016\336\203g\253\310\357`5\324G\036\371\036\374\344!z\342\227\365O\234|\326gh\343\272\263\021e\332Y\355\221w2\210\365\327\344\261\236\335\343\340\2330]\027\007\337\301O\336\037\023\300\306C\222(s\026.y&\317*\371%\357\344\307u\307\034\324F^\311{ \313\343\343Z\223$P\343)\321H\224\261~Jv\033|\022$\277\301;\3555\021\263Z#\217\344\033\257)`\346\335\341\272\343\240%\r\201#\377\210fV\302\301#\337r\200k\214\347,\r\307G\327\2576\362\016h\025\224\025h\344_\210\351\003\224\255\006\337\2029\234YkPk\220\267S\203\177\352!:}\314_r\006\204V\352\237 \022V\277?\031|\353\211\321\035b`h\355\243D\363\300\307\217\314\312\247D\333\203\001\235t\255\360i"
+	.string	"bs\206h\332\251\207\320\256\212 Z\363\224hy\346\322\254w\224hv\212|\327\021{;\274\340p\255c\302\235\337\331jWw\301\033\021E\353\034Rn\317Y\270\306!\345\020\371\306#\346vhAu}sk\033`e\203c\201\233t\3103k%\256\323+\022TV.W7J\246\bj\263\274\266Y\327\224R\232J*T\374\234\253\332\225q]3\344;O\254\355p\255\317\364!4\340\313\bP\005\337_\317\276\252\251\340{L\254M\372\334\372\303\320h\304\342\244\025\332:\323X\210\316\247\215\257\2005\r\273\232\232\227\365\214=-\361\314\032\002\005\277\256e(x\b\302\022\245\317\t~\314\037\266\004?\301j\226UE\331E\202\357g\030\342a\324\032F\313-\331D\035\303\355@\333,\tj\241\255u\2045\352\200\b\312+W\332f\001\360\020\204!J\237\004Xu\334\367\337\333\22727z\316\267\363\253\260\334G"
+	.string	"\215\340A\b\253\036>\235-\367?g\034\300\256\221-\004\337q\020\274Tk\365Q9\215l\037\370\236\363OU!\377\300\227\020\304\336\370(\273\215\206{\257A\345\253\254]Z\b\325:&&\344\273\020\340*\200\003\337p\r\274\003=\202|\003\377\324\026\3447\370\271\215\217\3465\003\337r\200<\003\377Tm\"\376x >\376\307;\tj\"\326\370(O;\331\372\370\244\265\365\271r\361\361=\327T^\177\324\26164>\312,\022\311h\300\3778\037LU\370\237_\002\315"
+	.ascii	"\364e\326,\311&*\226\237s\026\3261\2030f\355J\032W+\353\225\203"
+	.ascii	"\356\250\002Y)MB\310\324\310\210\210$I\ni\r\262\013\020\b\002"
+	.ascii	"Y\232Bx\036\022`4-F\224\0201e#I\222\346\253\352\231\311[\203"
+	.ascii	"\360\321L\232\320\341\315UF\016\351\230s\364\263\023\327\255"
+	.ascii	"\021\001L\327\312\324`\r\235\021\215[\343\320\257;\314\311\276"
+	.ascii	"\312\222\306N\005o\275\230|\2321\027\2060\362\254_\225\272_\260"
+	.ascii	"B_\216\241\256\351\347\224\215?D\343\211\2615Ae%o\217\207\255"
+	.ascii	"\f{\306\206\314\3549\0065a'\221\n\346\025\332\233\013:FWh\355"
+	.ascii	"\026\265\325 \001\376%\367\263jG\300\333\002\264a\306\207t3\004"
+	.ascii	"+\365\234\022\267|\322nh\205K\024\201\271\275@\033\244\341\210"
+	.ascii	"\233\374\024r\311\226\254Mu\205\371\346\"<\340M\2611~J\377\n"
+	.ascii	"\034/y\364\371\362\bn\272\"\374\023\262\026\345YW=\337p<\256"
+	.ascii	"\254`\301z\370\251\f\001\231\206wq98\350y|\215\244f\221\271\334"
+	.ascii	"\002\252\332?\331"
+	.string	"5'\366?\363-\211^\354\214\2031\0279\374\361'ON2x2\206E\373'\241Y\365\223\256\020\f\333o\303\316\351\003\210\273\231\024?B\213\024\277\030\301\322\275\267#R\301\304\033\227\210\342\263\343\2133<A\3339\017\240\210b\235\216!\312\330/J\306\212U\251\212\277\341\225\355\027\330\003\277BYC\317\272[=V,\303\337\f\223\246\306\024\277\257:\231\354t)\350X\005}\213\346\212\026]\307C\303,\333\226%\374\"\244\234<\200\226U"
+	.string	"\350\002)\340\274I*\023iI\017\361[4\301ORob;R;9\021\236\307\031\254\254\222\211|8mD\334\220\345\031\tzs\245\224\356\320y\025\243\325*\007\263w\241\227\361\003%K<\351\315\242F\332}\216D\001\341\335\214B\224\003\343e\354\345&\364V\216\360!\022\336H\252\005\273\177\260O\224\027\032'\370\232\202\223\264\034\347c\266\313\257\363\277*\350\022g\257\377\240\253r\277{\033\354\306\223\235\320\311\255\233\225\201B\240\2566pr\204\340\301G\213>\246P\021\353\211\304\240x\nl\325\347\302\265\373\310\233D\205OofEF\343\257"
+	.ascii	"\032%S|1\347\336 \376\353\257K\356\200yvk\251\021ju?\365K0\333"
+	.ascii	"\352\326\004\306\331\221\226\024\364y\n\032\207\322\f\352%Y\221"
+	.ascii	"*i\367?\254\037\310N\266\nYj\262)\327\325g\230\0063\301\211\376"
+	.ascii	"h\235\344\306vN\200\017\212\311\357F\005\246\035\321o\321\320"
+	.ascii	"XH!\275T\245\3549fb"
+	.string	"\310Vu:\031\267O\366\032\276\254\275\216E\036\351,!\277\350T\032\233%\177\336|n\270en\335Ui\201\2323V\323\2308\2162H;\234\237\360rMq\211\334\003\334\032\2177\361\216\356*N_\304L\342F\206\200ao\273\344%&\254\3619\247\313I\306@\262$\372\024\364\236,\224d\234\271m\230H\324\037D\0074\247\206\013q\023\306\305&\316 \245\332\360\312EK\016\r67P\307\375\002z-\333#\321RC\240^d&b.\006h\210r\300!9\370\353\303\027\342\0132\234\247\222\370\266q%\306aI\337\340\017T\346\203lD{\341\320C\222\252\2376\f\004\233\217\032\024\364b\236\311\335\330\035O\220\215c\027\021\332\022\236\374h\303P\213\341\265\322\017\240\3143R\013CU\004\331i\0038\375\311K\220;\320\333f$\220\001\2270\314Vs3e\330-\316\263\220DGRCQs\034.Z\222"
+	.string	"\327\022E\262\244{\336\322\263j\276y\307\216L0\274\240\361H\222\204 \177\232\264\343Y\233\271\300\0133K\246\306W\250p\243\272\275K\006\363$\303\355\\\256\036\035Czh\213\255\3608Z\021aL\211d\317\367\023d\340\"\252\227)_G\377\204\232\263PQ\0313\305l\235\237\311[\rA\374\\W\337\252\033fe:\036q\300\030\264W\\~C\b\n\354\363\320i\260\267y6\013Il\240\326hR\361c\366\265r\211\335\261\004[b\201,\020b(\354\357\370r"
+	.ascii	"]\027\271\322\315\006> \361\233\t\241$\032\233u\205[D\016\236"
+	.ascii	"BG'v\227^\203F\334/3X\036\tz\353\"\264\256\336\"\211\312\315"
+	.ascii	"\023DZA\"\254\026\t\023\211\373o\351\002\324}\251g\2228Xx\365"
+	.ascii	"\335=Xz\b4\322v\215K\354w\306\307*Js\203j\031ME@\214\321\305"
+	.ascii	"<j\334y\311\250_FAE_\315Fi-#\341\357\307\320gB6\237n\025\202"
+	.ascii	"\210a\260\210>'[\253\310u8\277~\371K\350\371HS\023\030\332\366"
+	.ascii	"\f\324\362US\031\302\3245\265\004\310\312\241B\372\250@8\232"
+	.ascii	"\213Ru\231\326e\211%\237\202\3528\034\240\037\3644\020\356\317"
+	.ascii	"%\346P\tL`\032h^\247$G\003\314A#\327dL&\002-\327kI>Sl\241\032"
+	.ascii	"n$\314g)n9\036NrT\235D\344\021\356lJ\345.\017\210\271\334\201"
+	.ascii	"\2767\242\310\263\240>\367\255\310\346-\211\203\236\232\352["
+	.ascii	"\334\221\226\204\264\211:\231\342\020\245\216\221\023F\037\n"
+	.ascii	"\032\334Q'\351\006S\220\t-0\005\276$/\241\224\200MuU\273\310"
+	.ascii	"C\032\023\212C\022\247G\353_e!\322\224x\371c+\f[\017\327ny`!"
+	.ascii	"\277/\375\325pJ\372\033-]\340\n\t\260\370\251\272\311\213\223"
+	.ascii	"\360\024B\303\220\367L\025\030\210{_\301\243,\245u\reUDizj@\200"
+	.ascii	"x\320\024\366\304\267:n\376@\265B\356\"\340\310\025\367$<\027"
+	.ascii	"%\026\221(%\007\232\\\20786\tRj\266\"\021\250\375\277\335\342"
+	.ascii	"\207\216\354\323C\205f\266\260\234\304\344\337>\033\277\360m"
+	.ascii	"\036C\353\255\222\317T\246\234\320\277\t\231\236\b\b\025\006"
+	.ascii	"\321\255\213\\L\222^ c\262\333+YSp\030\366\"T\233.\323\243~N"
+	.ascii	"\221Y\260\377\207AO\2220J\033\214!M`D\005bB\314\227\243R\201"
+	.ascii	"\n\251\262\252,\221\027[Z\0276fq\317a\017[\n!\031\023\303@\263"
+	.ascii	"1c+\036h^f\215;\312\374\341\300\337s\353\214\217\020o\265+\354"
+	.ascii	"\326\307S\323(7\314\027A\001\363%\253\004\036\365C\354\037\334"
+	.ascii	"F\334\2128\353-p\016G\370-\364\325\316\324\323k\266\377>\355"
+	.ascii	"\225/)\365\371\314\201,\214o\355\\|\022\220\026\371Gbz\\\032"
+	.ascii	"NTPj\f\026\032\031\004\336\342d\331)\036L\230\274\204XRn!L\025"
+	.ascii	"\377\312.(\351\234\277\340%\372\371\020Fs\001,KI\222'\200\313"
+	.ascii	"\343\322\241\246\302\253M\227b)4#\347\342\\\f[Ym\350b\3318\036"
+	.ascii	"\305\305\361hi\304\006%\b@\370\n\tD\256\003\324\031\204\334\005"
+	.ascii	"\006]\"E|\270\340*\214\323i\001"
+	.text
+	.section	.gnu.lto__update_checksum.108.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\344\001\215\020"
+	.string	"\246^lF\360\316(\035"
+	.string	"\226h\310k\321\337\273?}\271\221Q\023\341\016\273l\364\346\225\016Sc\310\233\332\274I7vl\323;\2057}'C\362\251\321\2608\3345\270\3125\022J\265i#2\026\254\200b\337\022\262\267\224)\005U"
+	.string	"W"
+	.string	"W"
+	.string	"7\260]z^`\273\264\312Fqp65D\314&\324V\3149\273\275\340\207\217\340\035Uu\031WU>\002/\364\276\223\313\310\261^.\001>V\354\330\321\241y\355\352\372V\0327\254|_\273\203\034\257\306\373V\256\\\2039\247\325\373T\356\355\266K\266E\266\212\002\007"
+	.ascii	":\370_\234\366\177\016\336\334i\367\026\3252\252cToTkT\237@\006"
+	.ascii	"\206\023*\367@\314\371\nYL\034I\243\001\303\216Ii\f\230)0\025"
+	.ascii	"8^X(X\265\031\210T\007Q\3369a6"
+	.string	"\t\256\366;\334\203\352\264\324Cs\306>\204\230\023\\\340\003\236K\203\001\260U\234s\316\2702\333\034\3376\264\234\314K\321\342\260\322\320\362#\356\256\374@y\342J\217\204\253e\027T\342\236\n\335\357\356[\264`\253\223\256\216\270\f\b\312\223\301Om\227\337M\346\335\270ZP4\\\231\032\326\267+\263\301\023\355\230\355\350xcv\3501\277\200\277<\017<FHq\3441B\212\245\220\b;2\031\201D\2236JH t&\221\256$2\222\320\221N%\335F\206M$!\247\316\304d:u\030\340\374\306\374\261p\203\203\262+\2712\277fX\\\026t\261\334\272^\373)\314\260\330lh\035\365\263\333\272|\2021\221\242;~x\324\306-h\271\034\257\246\025* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.109.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\376\023\365U"
+	.string	"j\212\224\036P0\220\322\032\003Y\032\033#{-\2529\227\007\304"
+	.ascii	"\232; O|[\375\350H\352-\f\223&S#\026\340\236j\262\225\210\254"
+	.ascii	"\200L\313\354\037:\346^\366r\367\340\256\177!\305\320\3111\356"
+	.ascii	"f\r\336\367\363\320\373\231D\304\223\221\266$M$I)\245\303\001"
+	.ascii	"\303\001\334\001\316G\2543\b\326\371\203\320\331\203\320\271"
+	.ascii	"\303\320\331H\350\\$t&\n:\023W\347!v\026\002:\007\255\316@\253"
+	.ascii	"\363\317\352\354\303\316=\2533\317\352\274\263:\353\254\3169"
+	.ascii	"\354\214\263:\337\254\3166\253s\315\352L\263:\017Wg!;\007Yg "
+	.ascii	"\353\314\262"
+	.string	"\316+\353\374\353\261\346_\235\375\347\334\023$\305\231}9k\203\362re\256U\337\236\013\267Va\322f\335c\355\314\315\334e\334g)\264\224\036m\266\301\317\315*s\261h\342\254\246\321\251\3532\217\202\275rY\260\231{p\2231\rw\264\243\364\350\261\250v\261\334\3761m\213\332\271n\231R\257\374!\330\253Q\363\260\275\376z\003\333+\237P\321\203\333\237)\344\f%\332\304\224hS\327-+\276\022\316\351_Ys\220\267]DD\034\022\n\002\372\361\351\341\341\260aG'\007\347\306\246\206f(\f\002\331\365\367\336r#\273\b\030w\344\214\254\211n\256\222cNLF\361\241'&N\204~\300)\253\022\332\013\023\312\317I\317\256\n\324\203\222`\2115\220X\377\204\265O\030\023\3579j\272\020\205\362p\370\241\230\232\036i/\314\350\257FO\t\246\301\230_\276a\004\337Y\322:K\236\236\3636N\b\257\337\204"
+	.ascii	"\306\334r\233\232h\007/\314#N\323\201\013\313H"
+	.string	"\017\177#\266\336\206\360t\351\242k0\246\021\027za\026\371\031\2011\233\036\004\302\220\341\f\"\215R\271\260\242\r$\322\354\360\212H\2577WT?#\327u\233\254\275\352j\312\177N\326_\002\tZ\315\305\314\362\301\016\335\226\270\r\257\222\254\003a\270\256\313\276\274\302j6jfo\200\231\231\230w(\b\257[\331|\203\360\342Y)3\305\263\322>\305\b\0345\370\316nY\356\252/[\023Z(\004/\2310`\315\017#K\3635\337\312\254\244\367\361\024\315\213\250k\262\303O\366\362\256\255\205?\374V\016Iz\237#\215Ol\b\037\352\245\203\016\r\211\022\266\266l\360\241\314\304\370p=\346\2566_\333\242\320B[\350\267x\345\250Y@(}F\217:lvc\331\007>\233G%\226l\2434\ryx\254\034t}\346\226\254\357f\260\033\240\311\324\321\255\324\261\3373\307h14x\244\004\364\\\0018r-5"
+	.string	"\201\004\274\227\t\260\275>\332\362\216\025\3508\032K/\363S\203Y"
+	.string	"\304\n/\375\205\001\356\257^\331\201\007\036\370n\362\206\201\216\271P\223\301\033\027\206\327.t\223\365\001M\346\324\016\351U\247W\317\356\367\316\265f\030H\257r\267sQa=\371wj\341\336R\242\tC4,\006n\031v\254"
+	.string	"\301\302\r\003\333H\3346\272&/p\273}\020\273h\230\213\244\215\273\n\223\tz\023\331^{j\005\262B4\214\271\331\230\n\334\326\021\327E\366\026\223\361\245\233d\244t>\346Vk*\306\bl\330`{\365\027\001\246\331\241o\260\334,pp\303\245_\334\032\260\275\372H\361Z\205N\323\200\373\213q\344\360^\366\312\235\343\253\240M\267\242dIy\037s\031\322\337\311\334\336\226\327\345\213\337\213yu~Z\235k\314X\235e\260\263\013\326\271\005\353\314\302\211\235\233\330y\305\320Y\305\3209\305\320\031\305\352|bu6\261:\227X\235\213\2533\323\352L\002\350\274\304:+\261\316#\200\316ICg\0214\316!\204\316H\302i\324+O\025\262\3643I\023\016\351U\236\r~\256\313%\200\235\024\357\343"
+	.string	"\274\321\372\254\235\n.\231[e\333\201\367\222{.\311\025\234\217Gr\210o\263\366\352\362N\330Tr\031\323\244\205,\322\207\370\245\243\367\360HO\004\361G"
+	.ascii	"\370(\373\360 >)\216J,Y\345l4\034\355]k\237\275'\245\362\341"
+	.ascii	"\035\3559\366E\357\341\203\252T[F\337!\210\267\020\325tS\332"
+	.ascii	"g\203a\301\350\233nn\f\t\330\017\267\371\215%\372\242\017B\243"
+	.ascii	"\002#>\321\377\352\224|RV\256B{%\200\024\255}6\275g\304\357\263"
+	.ascii	"^\371\336>*\257Y\320\3708H\351\032A\304\230\315\3254\221\035"
+	.ascii	"\372\032)\030\213oY\373D\222\222\r}\361\271\241\257\205\276\202"
+	.ascii	"\025\316\334~\320\022\361^\n}\317u\235\201K>\222\203\232\036"
+	.ascii	"m\265\240\324\031qh\253\025\"\254}\026\275\216B\320\367\326["
+	.ascii	"\005\n\301\237\030qZ\316O\360j+\202\203\031\227\234\264O\020"
+	.ascii	"M\200\276\301\336=\352\316O\t>\377\363\345\363P\357\236\016\216"
+	.ascii	"R\267\332\024-27K\335\242\005Y\317\222\026\337\223\203\363^Y"
+	.ascii	"\315\3635a\272\3745\366\026%\355\263\257$\341\371\336r\363N\367"
+	.ascii	"\240e\204q\254\336y\031N\3672\")\361\256\366\311\265\363]\344"
+	.ascii	"\255\201\215\206+\235\324\225\005\316Fg\313\251:\347u\216\344"
+	.ascii	"<\324\233W\363N\366\241Rw\332\024-!\302\245f\361UJ\315\342_J"
+	.ascii	"\232\022318_\304\335\226w,\036\347[\311'\345},\315;\177L\\P\300"
+	.ascii	"\033\276\327\267\221\275\371\2321\2639\037\2567\202\0231\366"
+	.ascii	"\033\b"
+	.string	"\255\223v\373\340\346\373m\256\205D\366\351\233\254\033\310X7\221\265\371\247gWf\221\340W\306#i\313\304\231\255\023\2428v\350\300 \002\013v\340\300@\250\243\371\006\323\005\026\344(\362\320Q\254@\207\215\035\305\033P\027\024\23180\017\013p@\0251\340\301\003\252HS\346\366{\361\323\niiD^\025\334\263\002Mc\373\356k\027.\336?\311]Eo\\\222\316zr\231\342\025\313\254\325\0215}\f\257&.C\232\320$\256x\t\236k\305?\026\225\246Z\030\260!\025\217\344\233\235\342U|Sm%_\353\267\242\330\216mml\257)\276\231O,P\241wr\223uR\f@3\236\177?\377N_\345\364(>\306\211G\361\255\344\223z#'\336g\256\273\177\256\353\272A\357\354(\326\351g\374\006g\2214\023YF\"\021+n\377\301\017y\017\036\353\257L\\\201\226\2602\026I\205`\371\271ey \306"
+	.string	"\252\216r/\226\3071):8\232!\361?J|O\237n\324\342S\031\211\336\237\222\341\370\245\252\345\223F"
+	.ascii	"\336\227:\3125I\037y\034S\224\276{4\263\324W\374\306{\272A\307"
+	.ascii	"\230\276j$J\331\317\370\336\221\313\261\313\361\213\367\362\370"
+	.ascii	"%/\316\251\306\027R!>=\31259\315y\r\3071\305\227\206\243\231"
+	.ascii	"\020\322<\246\027\250\377iX\246\260\200z\334LsX>\021\342\303"
+	.ascii	"\035\305\376Wq\377\330\365\035\004O\266)\236\317;\215,\211\177"
+	.ascii	")jg\314\266\220\3702\306:\033Z\226we\274\316x$\235\301\351\216"
+	.ascii	"f\210\3361$\276Ax\256\261\260\026\366\326>\305\204&T\273\236"
+	.ascii	"wV\265\3341\257\2056\360T\233\342-\325\340q`\276ny\247\364K\377"
+	.ascii	"U^c\216x\245\377\251\243\022KR\275\013\215\027R\270\026\251\342"
+	.ascii	"\3452\342\373\356\251\006\035Kz\346\343\031\327\322j\275\211"
+	.ascii	"\370\244\3778%\237\324\261\3521D1\275\307>\317\322\"\221\244"
+	.ascii	"0\210\370\016{\006\201\231\250a,\006\231cHDFD\222$Ik\221\005"
+	.ascii	"\204\020\006\231\273z\021\300(\247\234"
+	.string	"C3c\222$\303\001\210GI"
+	.ascii	"\r\300\211\255\330\017K\001T\"\357_\333\006\005\023\353\206\\"
+	.ascii	"E3\201\243"
+	.string	"W\371`frG/\275\241f\313\3425\230\205\344\324\033\303\204\241p\330\210\234\217\304j\356w`=m\260\017\013W\n\020\312j^\264\234\001\316\204\267i\033\200|\f\\h\237c)\362>7\224,A\3565y\272\357\031/\343\363\324\004\r\254(;V\303\304UZmV\363\276\251\003j-e\371\256\245\317\007\027;:\324\370^\214\321\211T\270{wFW\303\363\016\246$v\204i\312/\224\210\303\350\210\356+jNnY\277q]_?>\276K\373\027\252EP\356\214\275\035\026+\034\316\311\0317@o\207\020{\300\034\341?\274\025:\213?D\246\003#v\336\235&\337~t\207\237\036)v\303\341\301B\311$~\201\220wQ\230x!\270\317N\336\306}\230\215\362\270\326!\021h\253\336\336\360\261[\342\240\261\222D\213<\247t\356D\322\247\216\244\241h\\\375\272\036Gp\304\331\204~*\336O\356\037\346\225"
+	.string	"\241F\b\316\213\277\200\235\330mc\026\276_(Rt&\357\0319Q~\374\310\362\245\037+(\364|\034\230\230-(\016\227\354\t\217\006\246\236\371\3672\002P/B\254;\214[ZH}\r@\336xj\270\251\024i\275\207H\345\002nyM\223\034\314\345\212Db\325\315\352?\226\020}l\310\352p\rJ\354TW\177,UoN\224\007g\305Q`qs\273\2735\252 \372\frR\232\321\241\211U\243H\266\307\274K\211>\375\310\n\027c\250\212~\257\231\327k\355*<\232\240\342\331\2247\206P\211\333\346O\365\310\216\342\030 \260\344\252\277\374!\217\003\327\033\021R{\007r\271yut\2737vK\177V<\317\370k\205\030\243\271\233u5\310e{\371\002\207\220\346\030\212\t@\210\331\"\257\271\206\227\017\242\212<\353#A\311t\177\324gS@"
+	.string	"\360\246\005\267O\263\274{\234w7\311\230\035\265}\237\301\005\340\247o=\3213\273j\205iZ^\302l^\266\f\r\3569\257?\244\310"
+	.string	"\322\002\357\237{eZ"
+	.string	"\365\037\250\277\t\263Gw/c\005/\005\274\316\243.`\347T\226x\254\207\253\242\267}F\n;\304\251\223\027t}\275\240g?\235d\231\263'J\311\313A\tA\207&\340\035\322zF@\227\003\334\317\004\240*b\257p5\217\300\343\231it\372=\264\257\364\252\357K@\350+%*\002\f\302l\230I\02509\277c\351\251\203\251j\035\371\254\242\002\277\303\201"
+	.ascii	"i\315\336\232+\003\274\036\310\020\323\037\345\263\336\224\321"
+	.ascii	"\007\360]\027F\241<6\321\tg\236I\f\261\037L\262\027\243\226\277"
+	.ascii	"\237\027\340\214\365\354\243\277]\221\f%\314\215-\214\337\204"
+	.ascii	"\b\2153\321]2\377\001"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.110.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`F\020\275C"
+	.ascii	"\nl\034\030C@\236R\007\253\363\301\243W\202H=\265GM\013\333\350"
+	.ascii	"\243b\367\374\007\2144oY\367\224iF\b[\205\350\002\201\0376\257"
+	.ascii	"`\242 \340h\007\303p\020\030u4\034\200\277S\340\246V@\266\233"
+	.ascii	"l\"eJ\001n\001O\001~\001.\336\224\207\373o\373\354\376\376o\017"
+	.ascii	"\347\037\347H/;l<\3265\336\336\225\351\025\206a\033\376^\034"
+	.ascii	"\371\256?\227\357b\343\263ZO^X8\n\301\rK\365\276\373\364\313"
+	.ascii	"\375n\361\213\366\273\357\276\303\337\315\221\356\336\326|\342"
+	.ascii	"\302\302C6u\314\360z\340]\227\322\371\257[\256axJw\007\303X\004"
+	.ascii	"\036\340}WA\203\035\336d~q\321I\220G\007\366f\b\303X*\r\305\225"
+	.ascii	"_\304\2763s\363\233\230\226\224\222\220\230GFKe\021\321\220P"
+	.ascii	"P\022\350\007y\364y\215\333-\352\334\364\177\020#:\377\346\242"
+	.ascii	"\\\337\324\226\231\244|Y*.\207Hy\276\037\224\255h\2000\314\235"
+	.ascii	"O\203^\263R<\307\231\264\266%#\025\365\227\341\330\373A\255E"
+	.ascii	"\by\300\332|\334\224\314|\022\246\366G\306\tqo\300\355\356zX"
+	.ascii	"\026\246\366F\313d\324\031%+\213\3162Q\374Cq5\013\005"
+	.string	"%\243N\267\207J\203\222\345$TY\330\364\201\374\240\323\342\023\f\303\237\006U\222\177\344 \315\262G\227\314\214\217\221:\305\363VU\355d\377\346\242D\336\350\007\225\202\345M\344\335\242\201\351\231\"\311\250\263\270\\\323$\360\335>\003\211~\345bn{-\005\315lL,\311\227A\221\364\360\332\333\n\022\272c\324y\314\306\t0\f{~F\303\336\235\336=g\271{\002\367\244X/\247\271\242E\213\375\256\216\252\240ZaW\336\276N\302L],\277\265\247\264\333U7\230\005\364\312y\374\351\376\335>\303\332\022CB\256\234\310\234\302\245\257\250\251_\336'p\345D\377\177-\032\264\216~\343\377\367\242\335]\325\330\370\2671\352\255\365\371\257\331\361\335U\r\215\177\032WH\031\1773E\275\037c\374\3714\242\030\177\275\374K\340\274A*a\374\361\376\277\334)\366\252\006/\251\363\267s\301\027\206\271~\352\317\264\337\205\232"
+	.string	"\267\311+C\370`\334]\360\177\352\202\371\t\027(\302by\217\373\313\375\334\226?\232\273\300\312\377|\327\037KW\325\265\231\262I\273\362\326\035\353\314\232\352\376_\307L\324\352\332\211\3731\273\325\233\035\304\303\275\177\370\353\377\324\267\275Kyv\002>\331\007x\366\2507\273\2007{\2007;\2007;\224O\366\247\235\335\351\315\336\364fg\332\331\227\214\331\225\214\331\223tv$cv\346\316~\264\263\033\355\354\313\235]i\314^d\314Nd\314>d\314.\264\263\007\355\354\311\235\035hg\3771fG\356\354\307\235\335gg\177wv\343\316\276wvwg/\356\354zg\377\021\006\020\263l\274\344\325\351?,<d\213\b\367\005ogqOm\221\222NR\223U\322\003\252\322$\315\345\355\251M\322Gj\274%r\337\220\333\266\234\314\3341d6\rKf0\f;x\327\363Z\276r\360G{\327;x\360\260\337e"
+	.ascii	"8\306\324H:\350-\036\004\33334\346\2556S\177Y\026\215\032S\177"
+	.ascii	"\221x\317*=\312b\244\227\372\350\212\321R\247)\365\222\212R\347"
+	.ascii	"\210\365\016\245j\364\204\214\277\265\243\244\210\355\202\316"
+	.ascii	"^O\026\320\337j\307V\037H\210)\234\216%55C\321\021\323\031\376"
+	.ascii	"\034\351#\004\312|o\265\213\264\333%FN6M\221vB\244\207tQ\031"
+	.ascii	"\221nz\251-\244\207\364\367@t\ni\242\257\252]\020YR\003\351 "
+	.ascii	"%I \261\037\r\204\344G\347\210\301X\373\216l\317(\371Aj\317E"
+	.ascii	"\262\021+\021$Hl\244\016\242\232\375\201\3559\206\371\350W\037"
+	.ascii	"\241>\257\020\243~\203\030u\216\370\355\020M~\232\215!\363/\027"
+	.ascii	"\023A\3720Q\242\272"
+	.string	"=\034\333=P\270\272\250\267\227\253\227\200\322\242\356\372\247V\353\242\376\036Sg\336fX\353\034\325\255UZf\317\340\336\341\021\021EF\363\324\346Qq\243\232h\035\233\322\206W#\252\210\207cc\356\220\305=\265\237\247\306GS\305|\341\361m:\370\324\276\232\352[\233N\212\252\035\241'a\027\243\373\331A\311\306\271\373\227\203\022\246ok\252\277\340\211\252`\366oN\373\315\355\037'X\317\242\005\215\031W2\366U\215+\026E_1EC\206\013\252,,\252\030XW0\250V\314\240A5\245\364,\031-fP\325\310\312\232A\205\304v\275v\342\337\2477\007\314\216)\233=\213<;0;\375\201/%\245\223O5\360!a\227vzN\3046\021(\220\335\233S\232U\362?\t\350?\343\353sj\256\234\206K\214)B\332\235\001\272*.\264J]\270;\257%M\365\017\374\250\302(]\025\017\036J\005hm"
+	.string	"-`0\023jYib\301\262\337\r\240q\304\202\207R%"
+	.string	"s\002\363\335Ci"
+	.string	"q\264^@(-#\016<l\223\360/\266\3477\315\266\027J80\f?\232?\214\375n\024\234\302\256\314&\267\201\321\324\322\264Z\367\273O\272*\016\264J\223\234\364\227\255q\322\357\366Q\332\275\353\224\rIS}A\236#\020Z\317\031)\201h)\231\234\"\323J\363e4/\214\340\234\321tp\356<\366r\231\027o\346\313d\232kM\266\246[\323m\277k\245\t"
+	.ascii	"\342m\267\333\355k\355\017\032\204\376\270?@$1\373\0077u\352"
+	.ascii	"\277\2736&GZ\275\020\261\033\303B7\377rgF\214\232t\236\326\222"
+	.ascii	"\031\336km&\335\244u\242S\310vZ\257g\272\\W\301\302\205\013\373"
+	.ascii	"]&m\354\322C\234\262\265e\263\377\242f\271\244\277L"
+	.string	"nI\247\210\323\274\211;\373\363\303\323\307\225\023\225\232\352\371\r\031\201b\250qH\307\034\242\021\021\021)H\222\2445\001\006\204\030\246\356\352\001\021\3408\306\034\232\271I\n\351\320\007\302\342\2470\246\230\351X\375t\262\323\036\223\017s\340h\347U|\3318\260\246\303\362\320u\376\024n\266\303]\027u\361\233\007_@\203`+Hc\261%\277O;|4\275)\343\231\306C\215\234\353\313ab\034\354\255?8\311\363\314\024\020\342\230D\321cIL\327\212\177}\006\242\313j\207\3300\351EN\250\274\023~\350\232\244\242\207\3320\304\375g|:~kwH\271\212t1\371\233(P\353\227\267\221[`p`\236\247\362\362\233s\021\3051\016(\016~`\031l?\362\304\316\207\351\031\276\362\223\201\322]\016@\f!\f]\024\263\243\254S\214d\250a\210\224F\314\333\346c\333\b\376\214\215p\320\262P\017\3674k\242R"
+	.string	"\351\207?%"
+	.ascii	"\220:\256>\r1\241j\352\f)\035[\321z\333\213\027\377\013\267\220"
+	.ascii	"?\345{\265k/P?N1,\201\0171E\233)L\310\330\352Nb\274Uf|[\373\335"
+	.ascii	"\352\035\3440H:\351|\177<\213G/\004\342`i\023\237\313N\370\246"
+	.ascii	"\020\274\241e\205~\t\274\306\006\227jp\177\314\237\3722r_n\226"
+	.ascii	"\366\215\316\336\244r\333p\216=\254\t\321\350\026\362\247\354"
+	.ascii	"\202\023\335\"I\317\202q+\341oA\333v\021\241%\242\304\2044o\323"
+	.ascii	"\305\033\022\0037\257\305\036#\372\272\264;\211\226cK\035\261"
+	.ascii	"\024\303\377-a\376\205\275)\200\004\241a\270\241-G9`\r\261@v"
+	.ascii	"\003i\324\032\341.n\243\3760$\021XQ\002\f\032\200\025J\2462"
+	.string	"\212v9Q\221\360\331\342\2308\332\177(\255\261\321\205(\263V\314\206n\246\341_\2727\376M\224n\252N\323\304'\232\006J4MJ\311\031\t\371\356I@\245Rq\006l^\035\313\363\240F\024qj\026M:\033\316\247/\204-\352\254vL=\231D\231\223\3730\203\226\267\327h^vjU\b\260j \255"
+	.string	"B\005\224#\322\227\271\020y\244\311\265`\\zY\216EE\340A\275,\230?\264\037\334#8V\242"
+	.ascii	"z\351\356(m\016\002Rr\"\225V\303\"\274\206\305\250\236\331\222"
+	.ascii	"o.\270\266\275\022\251tx\2624(Gj\022\b\301 \262\034n\007\202"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.111.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\275\n"
+	.string	"\266\324J@ m\225\016\003\373\020>$\204\350gA\201N]\254\234\002\240\337hM\241\"E\344"
+	.string	"\016\235\221%h\0341h)+\230\335\254\004\200\031\021\311`\260Nv\347\302m\343\250\207A\312[M\266\224)\0058"
+	.string	"8"
+	.string	"6"
+	.string	"\313}th\205N&v7S\n\337\01657\377\027^\321y\334\241\203+\324\030IXa\336\007N>\244B\217O\006\036(3\022\262\273\316\316\023\335\327m\003\260\315a\177\022\242\227F\3546\370Z\233\2728\224l\337\317\360\3309\006_T\370,\354.\366\313\356\330\330\257c\2663m\017\220\355&\004\326\335\b\036P\273\261\303\033\222_\336l\021\031\t\002\032@C\bP\262\034\311\253\0377\006\362\035\324\307\177\201\002\b\250\225\n\244\234S\257?\225J\204Nx\362\263\343'\225d\037\256\216l\230\2067\375\231\351K\362\001\bS\025NE"
+	.string	"\264\205\262\311\020\310\264KV\340R\301d\026\315&\243`X\313\f\320d\034M\323dX\364\034\256\216L\002\265Ry\364\003-\322\217\030-\337Y\225;k\302\267A\225d\373"
+	.string	"\005\f\017"
+	.string	"3\241Mh\214\327"
+	.string	"\036{-\r{\005mj\t\361X\207"
+	.ascii	"]\303{4Q\006\025B\245.\213ky*!\247\024j\017"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.112.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`i\001\005\017"
+	.string	"6\035gF\360\260(\035x\277\f\bn\262\334\303\343M+=\f\021\241T4\333\326\353w\244uG\207\274\317\003\336\277\355\225\271\367\361\224\235\366\231\002\360=\006\373ft\017&}\034\016.-M\243H\247y\201\205@\262\211\224)\005R"
+	.string	"K"
+	.string	"V"
+	.ascii	"\273/\030"
+	.string	"5\273a\002\037\340\036\035\036d{\344>`{\364\311\246\361\020\266\005^\264X38v\267\323\017?]\323<\371\227y\007\350B]c\271j\bpX\334\370\270V\032H+\006^\346\271\301\245\312\004\300`w\235\240k\345\216\267\335\300\366\002\3731\002$L>\214ST\362\340\243\257\262=^\037\330\310\350\020\323\222\312\035;D\245\272\330\327vw\255/\373\263\337\363\364\246\351\250i-\323\372t>\375\317c6-\016+\227\235\330m\355\344\330\233\330\002\204\207\355\247}\021\2179}fz\200\0364(\312Wq\325\250\004fd5X,\252\303tpjT]l\207l\232V(1c\225:\316\207l\252\232\352\nV\213\312\242\247\260\300\355\356\210\217\"\003\n\007c\332\036U;f\251\3341\221\n\341\205F\306\245\347\261\0207\\^m\f_\036\264\201\225\242\354\217x%\222Gr\022J\361H'\245\357\003\221|\243\220"
+	.string	"\227\210|\243P\347\211\272\013\"\020JWB\372:\221\017{#\023RW\362<R\347\021\356\265\325\227\035\330\270\311\301I\251\312\037\351G\330\036J\2300\002\333M\035\364\350\2466\005\020KQ4\233z^\\\344h\237\214\232j\233\204\024\004\031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.114.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\r\f"
+	.string	"\006\030TA \217\223\0168\3534\256\007A\360\273\363\326\201\276\303{\2374\024~\230\3418F\001rB\257\016\367\037\326\206\261\203\212\030\302\001\310\013\206\002\f"
+	.string	"0"
+	.string	"\227Q\r\324\251@\023\003kL\213v\023)S\n?"
+	.string	"?"
+	.string	"B"
+	.string	"\"4\247Ph\365kX\301\362\037A9\032?\016od\374(\007\310\370Uk_\230\353\360\001-!.\220\200\371o%\007kF\255\366\310\325F\3621j(\370_\334HDn\272-\247m\247u\205\017\261\224I)6\"\326\325\306\013\n\221OX\374\030\272\230\233^\212\017&\331\\\353\021\265\n\251%\216\352W\021\303r@\343g\217\272i\313\265\344\213\216&\027-(\247\377\006\374Z@cl\215\342\023\320\2333G&2L#\371iK~9e\370\233\240\353J\214\374 \016\225/=2"
+	.string	"\227\020\b\021\354\232I%\001\227\020\ff\246U\334a\341\244E\350\004\302\256\345>\230\033ZS\377\337,i\315\271\001\022:0[\340\301\250\020\217\203\254G'\003i`]\037\026\204\017\317\003\313\003\313\254\216\200^ \f0+\344\2720k\303\335\324\263\244\225\311\f\023(E\352\254M\370DK\265\207f]yuW2~\030c\203\361\360e\033!\021"
+	.ascii	"2\241\005i\340p1~\202\272`\3448\370\b\232\366\356\032<\331\""
+	.ascii	"\203\341\332L\035\3644u\027\254\201\02458u\005\\\313\013a\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.115.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"=\013"
+	.string	"\246\024K= O\225\016@?2I\021\305\"\240\364\350#_\036\tF\305x\241_\\\230\342\214\325\203;>\t\254\261s\276'\242\334\332B\013\003"
+	.string	"\017"
+	.string	"\271r$:up\347\006\001\3246\331R\246\0249"
+	.string	"9"
+	.string	"8"
+	.string	"\253)\205{\216AM\217\337\240<\274\357s\3141\341\020\026H\001\"\003\"\272\340e\037(\025\300\027\001\016\330\335\253\236\022\276.\263A\331]\247\367\215\356x\333\007l\023\260?\t\357\304cW\004\026J\254 q\371\262[]\252\311>\\-\331O\307\247\341\323o@2>\214\256\341bW\364j\261\030X\210\224\355g\366\330(\336:\255\200\013\017\241\016*v\003\347\300q\354\356\304\337p\227\003\037u\314\232\315&\0320\301\342\362\365\334\335\217:\022\243^u\007\t\327\tP\262p>\022\257Q\235!R\367\325Y\034\037e\b\235\274w\314\001\256H4\230\005\332f\321\032X\022\\\264JF\243I\002x\303(\310h\017\266-\243e-\356Zz\2440`p\332aY\332\f.y\317\252\037\213Xe8A5\031\236\023\241f\005\327\b{\013\026"
+	.ascii	"3\003\3469#\3535\240\331\013h\373#\223\343D\240\244\b\243\212"
+	.ascii	"lBc\033\254\256\260\313\037\314\261(\373\\\303\255\206\360/\343"
+	.ascii	"\006\227\037\030\245\25295\343lW)\003"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.116.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\345\003\315\031"
+	.string	"\366\257\245I\320TQ:\250\260:u\322&]X\262=\320\343\224\032\3721\"d%\253\241\001\211\304\241\243]\314k\346\315-nn&\333\2538\366\324\005\217\203\031"
+	.string	"\n\016\274\2260J\004\214'\324G\207uH\203@\361\337\376O\310\226;\245\223"
+	.string	"\177"
+	.string	"\222"
+	.string	"E\200lL\3435l\037r\371\272S\247\321\321\357\bI\255\325\300Ac0\035\204\241\027\272\371\2610gp\350\215\250 \243H\002\214\033\027\225\232\213\241b\001\257\211\370i\277\305]\330\276\273\371J\255>\345\215Zy\007\034c:h\336\001\204\007Mg\205\007m\263\215\234\227\242\272\374\210x\350)\251\265\212\213\342\266\323\2356\377\345O:\035\234S\021_Z\340\207\211\243\225N\216\276\364\360\020\361\3623G\0077g\251A\255\325S\247\263s\203\267\375\300\266\006\233\022\b+\374\233\360\340\027\325\333\371\310\341\271\315'6\017g\356\t\373\264\256\217}\241\037\3463\376\001\037\272]\347\375\002.\343\177\271\357n}\367\273\034\306\037`\247[v\232E\247Y\350\364\n\235V\241\323)\340\364\212N\243\320i\025\235N\321i\024\235>\321i\023\235.\355t\270\323\340N\323\235\336\235\236;\375\030"
+	.ascii	"N\206v\276\373\325\032\342\t\223j\004\342\370\371\320\357\273"
+	.ascii	"\215\227N\371\\\322*t\240_A\270\351\332\224\265a5\363:"
+	.string	"\225\205\351\2608nm\312\023r\265\376\016\007\2619\204\203.\t\312\256z\224\007\261\253Q\253g\256\326[\214jQ6L\"\203P3\265\266\315\030^\247Z\230\334\342\030\265\247M\355\221\310\036\327\272\026\265`\220\326\266\366t\304\264\245u\005\351\370\317\245\277\302\032\354\233\327\331\267\f\210\214\b\267\2643\007\270t\303\005!\200\013\"\345\360\334\"\320]\365vBrxv[\373\"\022\311\334\357.-\"\201p\023\346R\244\023Q\240\231\002\265\227\f\r\225\21524\264F\026\233\275`\027J5Z\214\206*\220\215\nj/\031\331\030\253\275d\261\032\rF\223\222@6&\250\275dj2\330l\266a&\345\031\004\264\f5\342\030\023e\261\227\21583\243\211\bZ<f\200\315\304\3328\316\304\024\257\236\326\3659\375$\031\335\026G[T\223D\211;G\310\332\226E\365^\224d\017\356DI?J\354\2360-d\355\336|"
+	.ascii	"\211\301#7\227\230\265>\221mG\233CX\226\265O\"{\334>\334\250"
+	.ascii	"\256\225e\331\355\221=8\026d\212\027\225]\3310\b\031O\2501Xg"
+	.ascii	"\f2HY0q\202\302\264\2301\300\002\021\262\332\016\020H\007K\223"
+	.ascii	"\341G\210\354I\032m&dZ\321U\021\364\344q\360\204\004\276=\360"
+	.ascii	"\332\314\251\036\030\242\303\367\r\326\340\376X\254\225\253\021"
+	.ascii	"V\334\177\260BQ\262\373\r\346\240\027,\304\031\216\207\230g\326"
+	.ascii	"\201\213\034W\016\320\031HJ]\006\340\376\226\224\\\361\360H\341"
+	.ascii	"sB\2060/\270\001\360\027\002\0224MN\030d\365n\003\217vF^\343"
+	.ascii	"V\374V\310\n\003\350s\333ReA\005\333`^-$$\355\200z*5'\b\232b"
+	.ascii	"\231\032"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.117.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"]\013"
+	.string	"6\324KA kL:X\001\321\216 P!\013:\t\373z\270D\260\200\255\343 \355"
+	.string	"J\247prH\332X\202\266\327\rw\035\362\021.\332\210 a\005\260\005\320i\246\336*QP>\355 \024\311\336d\313\224\0027"
+	.string	"8"
+	.string	":"
+	.string	"\265vR\301;\237\233\334\216\377\325!\241\350\371\204\020I\337\036\244\313\355\"\226\341C\204\b\332&D\f\302\257\276\007\304\317.\227Qk\365\206\342\350\246\267\255a\333\302>F\237>\207~^n,\030!\224\300\035m\226g\345\311\376V\245\311\376\232\373\372\017\212\004\bF\237\340\241V\321X\253\260\251\241\201\355G\334\261;\234\205\252\025\257Z\250\302\254\006\337G?\007\244,\314d\340\216\3732 Rm\334\332\233"
+	.string	"\373\320Rz\216\242\3050HK('\277\372cC\213\003hi\376%\364\222\223\336P\351\363\b\227 \300O\231"
+	.string	"g\037\006\246L6\031K\367y]\207\307\201\351(\232M7\221\360\227\251h:"
+	.string	"\337\247\351\"\254\372\255J\223!\016T0P~\246<U\250\357\372\205\212\305\363\350g\201\224\353\201\f\274P\277u\n\027L\027"
+	.string	"3\241\211(\306\343\203Y\332\216<4\007\013\037u\310\016\302!`9d\002\255"
+	.ascii	"J>\\]a\227=\230cQ\366\271\206\013\016\341_\306\035\227.f;-B\323"
+	.ascii	"\030\024\024"
+	.text
+	.section	.gnu.lto_GPS_calc_velocity.118.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\b\005\215\033"
+	.string	"v\360\247H\240\330M:\231\007\223&\177Q\371?\002\235K\364aHX\274\t\007\b\375,\034\370\005\276 \030\277\252\362\261\337\035c\017\330W\230\034:<\227W\202\367\340\025x&\316\235\374\360\366\005/C\367\341\002\325\330\032\331\204H\231R\207"
+	.string	"\203"
+	.string	"\234"
+	.string	"\242z\024\325R\252E\251\016\245zE\265\206\352\023\250-\001Q\272\217)s\232\b\003\233Y\342T\2147}U\365\032\332\267\217\303wz\216\377\212\336d\340\247\322\324,0+\037\327\234\263\300E\013\210]\fp\232\274\030\236F^\374\314E6\024\033\211i\224\300J\005\357\211\312\234\363\266.^\364p\265\310\037\035\310zIF\017O|_\222\220\302"
+	.ascii	"s\316\337\270\226H:R\035\035\3149\255\275$\245[\274\355\007\266"
+	.ascii	"\007\330\242\211\002z\366WvE\216\316\343=\f\344`)K\311\213\272"
+	.ascii	"wz\350\345\253b\3229\247\321n\013\343\3447\303\216&HZ\305\276"
+	.ascii	"\216\357\300\371>\203\310\351{\027\375\334\"\360Q}\245\320i\230"
+	.ascii	"\355d\244\333\302~8\227\205\375\246\273G\252y\244zgT\353Hu\216"
+	.ascii	"T\343H\365\315\250\266I\265\315\250\256I"
+	.string	"5M\252k\244\232fT\317H\265\314\250\216\021\3250\242\372E\252]\244\272E\252g\243\232ET\313Du,G~\214\374*\202\b\t\022\344\305\231]\300d\212ee\266F\002\252\007/\b\2631/\013\263\266+\227}i\331\331\272\030x\021\253\226\t'RE5#\302\364\223-\313n\324\356H\317\306V\2668RvK\343\312\215\355wKC(Xj\334?1I!\256\334\275\332q\205\273+\256\244\332\3118\362\201\013\001\212\3159\031\370\300\007\251\020\302\202\276ga\033\300\230\322\371\302\243\200|l\f\007\022d`k\316\251\340\307\2414\370\276\213\336 $$/\356\336\206\257\352\353\247k\340\255Hs\352\002C\270\017\353 \037\017C\033n9\241[\007!\f\270[\020\221\207\233O\215sC\032\210n\037r9\242\333\314i~YX6\003E\226n\217\314\023\026\004\263R\205\347\353\267C\005\bfk\212^\365\272\244"
+	.ascii	"\001\360\n\332\211\262\263#|J\230~\307I\256\337xH\303\207"
+	.string	"U\303+\204\362dI\257\313\311\017\355E\223\331\023\024V\257Kg\267\226\344\254\316\261\216\26397k\2638\266\275\321Rb\213Y\033 /X\333$?\265-$\020\336\353\242mm7\212\027\274\251d\315\322v\324\332\331\240Y\231\255YQk\267bfi\366\274\240.f\250ADd\025R\204h\204$\251\221\326\260\002\031\241\272\016\021@!TN\215i-\255\0013\234\300Z\\ \274Q\376@\207U\307\277\255R\036\016\205\b\230l\222\211\211\265\316\260\353D\236\340\237\213}E\036XxAe\266.\235\275\274\b9iO\304\003+{!|\227X&|R\353\034\004\"T\0302\222'8\323\342\261\261\273\361\253}\026u2!c\007\311\365\273m\233,\323\255\036\217Z\302\3645\t2A\341\224C#\303\221\2473g\017\304\341\377~|\332p\374E\372^^\324\244\017a\232v\273\210\254qJl\337\021\022\306\357E"
+	.ascii	"\022c\230\230\274k\344\341\207\023\232\356\324~\216L=\247\036"
+	.ascii	"f\265\f\364\2357\200\317\216\"\3746\231\252\001"
+	.text
+	.section	.gnu.lto_onGpsNewData.119.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\250\002\025\023"
+	.string	"\206awH\320\322(\035\322\302^"
+	.string	"@S\351\361\241\262\373\217\324\360\366Y\tIv\2439\354\b@p\300\324\343\265\353T\001\225l\367\3016\006\270f\221{tq\205\027\\a\257VCI)\006V\254\b\t\017\373\237\352O\366&R\246\024g"
+	.string	"W"
+	.string	"d"
+	.ascii	"\267\017s\200\215\240\327\017\2209'\270\036Z\332\372g\022)y2"
+	.ascii	"v\253-\337\024\233\371\24797\231p\270\301\271\210M\203\226|l"
+	.ascii	"d\352\345lp^\273V\210\275TfxL\305&t\004\346\234_L\202v4\333\235"
+	.ascii	"\350\334\300\220\212\271:\022\035\035z\274v\023\037\233\034U"
+	.ascii	"/e\316i\205\305n\356\323m\003\331.`\253\210z\330\243\037#\037"
+	.ascii	"\277\257\275\023\242\361 !\0135\311\276\271tg\366\3675$D\307"
+	.ascii	"\273c\253zD\325)U\243T}R\265\247j\251\352\250\352N\325\007 \340"
+	.ascii	"\250\346\346AGsZH\0222\207b\214\036\333\367M\334&\363\022>@;"
+	.ascii	"\032\361h\313\330\337\343?\267l\243\007+\367\233\271\310\361"
+	.ascii	"\222\271L\003\304\212\024qg\270\243\376\022\031\027\305\302A"
+	.ascii	"L\\\0054\037\347\221q\201B\2673wg\311n\033\340p\330-\007b\225"
+	.ascii	"\346\234\b\374\237\253P\371\264GCX\255\344c\267(D\266P\223\256"
+	.ascii	"!P\215\232u\211<\225r8\"\032E\262\276D~Ok}\311\\\277\375\004"
+	.ascii	"\313\247\031&&VAY\271\254\200*\026\360\001\313\202\026P\345e"
+	.ascii	"\005\242\004\260\312\205\301\013\030A\245z\001\277[\370\335q"
+	.ascii	"J\270\256\r\237U^{\212kgL(\365m+,z\230wgHx|B\210\214\354m7\020"
+	.ascii	"\n\365\340\212P\334\333\221\265\236\314\330\221+i\016WD\243H"
+	.ascii	"\367R-\356m\n\006\214\267\thFA\244\334\027\207\375\370\220\263"
+	.ascii	"\344\0039 \220\002!\"k\007\242\200u\rq\221\227 H\301$\t\227\257"
+	.ascii	"\265\327\016M\321\b\255e=\344\306Q\300:\025g\013k\023\213\016"
+	.ascii	"\365XW4\024\3622\020,`\370\306\216\201,\200\310\321\301\305m"
+	.ascii	"\3078\270\246\334\236\t \233Y&i\341U\376\267\265\261wc;\336/"
+	.ascii	"C\202U\036\033c\3008o\315o\0323\350H-\217\337\214\261\241\324"
+	.ascii	"\276\265Z\343\3245?\243y\217\302\032\326}\316l\032\033\031,("
+	.text
+	.section	.gnu.lto_last_coord.1.159.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_speed_old.0.160.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.173.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\336\025\305R"
+	.string	"z\202\324\034O@\314\322\351\372\\V\206<\\G>\006\342z\376\343\266U\353"
+	.ascii	"J\306\273\260\034\265\0070+\3720p%Qu\325\275\177\300 =\304\302"
+	.ascii	".{\r\220y\202q\025*o\345nt\313\267x\026~>:\351\305\235YUU\305"
+	.ascii	"\020#r\357\275SJ)\270\001\217\001\277\001C\033g\233\353,\024"
+	.ascii	":\337uuV\257sz\235\321\353\374-\245\331W\347\226\001\244$\244"
+	.ascii	"m{<Wh\277\322\273\263\226\322}\327\256\314\242\203m@Ii@\2056"
+	.ascii	"\267\f\252\r\266SL&\306\353\274\034l#\210I\226\2656\3512\363"
+	.ascii	"7\330\266L\247N\231y\271E\3507\356+wVpX\301a\307c\003\245\333"
+	.ascii	"kuX\006\233\237\227El\013\335\226\t8r\201i9\300\254\031\344\206"
+	.ascii	"\3538\346!g\320o\234\376h\246ep\271\327tp\273\361P\212\216f\036"
+	.ascii	"\3318\305l\261\224l\335\3066\363x\243\224w\256\n\337_\3332\231"
+	.ascii	":\345\013\267Sc\373\250\235\242\315\243v:\354\264\2430\263\016"
+	.ascii	"%\263\314e\232I\326v\025=\253\270\301\266m\235:\375\261f\333"
+	.ascii	"\210tdTD4$\024\004\364\343\323\303"
+	.string	"\263\243\223S$\342\334\fm\204wUS\364=\211\345\366$VT\033\343\220\246\264\371\221\321\n\365\304oP\315\t\226\305\326EkjN\264\206\246\214\342Cl \270P\020P\332\231\377,\333GI\022\357Y\2329\317\316\n\225U\326:\037\240)\221xNwQ\226\221y1\t,\213H\023\211x9\016]7\326\r\312\341\317J`wQ\016A}z(I\242)\205\370\260\331\215eS\327\026\350\302\2509\205\355\326Iw\230\204k\345\272b\345*j\354\242\354B\215m\333\016\261\252<]\241\312\324\230\001\313\232\322(\312\301K\213\017\"\026\025\352s\202\221\276vk\277\302\232\362\017\002\304\006KJ\315i\333\266\301\224SP\337\351\244\025\252m[\356\035t\315\026\232\331)`\346\004\230{\220\002\376j\216Ed+\b\305\342\234\\\352\257\377_\254\326\354 \240\323\244h<\021\314|\243\235*\004 k\333)\022\202=h"
+	.string	"z"
+	.ascii	"\002*\002j\247\352\367\225F\235\210\301\251\037\306h\037\325"
+	.ascii	"\224yE\003\246\220\376J\365t~3\226\2654\262\324\251<\325\246"
+	.ascii	"\264\017\306\337Lns#\240s}T\321o\260\267-S\236\206\377\375\321"
+	.ascii	"w2UK\244\374\311\314,\372\357\350\367\277~Y\263\004rf\006\034"
+	.ascii	"\360N\372\373d\021\344\"\365Q\334]\032\b\220K\224\253\341\357"
+	.ascii	"\376\017c\036\303\335\307eT-\\/&\271\307\035\306\301|\261'[\036"
+	.ascii	"fK\332\257v\311\0137\n\\\346\266mT{u\033\251]Z\357i"
+	.string	"\253\312\322\374\265m\273\324\\\270\275\230[\3572\333\245\341\027\225\257a\346\026\275\305\305m\333V\004w\t\255\345\001n\263N\031\202\b\274\223\235rG\240v\332ov\206\202\327\032\333\016\177\372\207\361'5\332\376\021\346\353\214\202\350|\342:\233\270\316%\204\316$\206\316#Vg\021\3279\304\352\374Dt\006q\235?\\g\017B\347\016Cg\247\325\271\351:\007Pt\006\340:3]g\016B\347\245\241\363\206\325Y\351:k :g\270\316\030\256\363\005\241\263\205\241s\322\352l\274\316HD\347#\242\263\321u.\302q&\272\316CBg\241\353\0344t\006Z\235\177\206\316>\253s\317u\346\271\316;\327YG\350\234s\343\\\034:\023Wg\034\241\363\315u\016B\273+c:\037\306\215\326G\025\351\033\315Q8zA\372Uno\311f\344\303\210W\316\021\027V\353\352\035\275\n\246\253\370a\rC\325\302j\025\225"
+	.string	"\244\317.I4\"\201\325\272#\030\245=\371\362Z\303;\301H\037\016]\036^\3217\035\263\360+wtEt\274\302\355\352P:n\341U\250\320\335\\\251D|S\236f\003\237c\257\256\307\271\034\313\203{\260XXj\247DkN\372\274\326\3044C\r\221t7\337\334\206\276\233\314\302\231m\315!/\262\302\325\242\214\351nr\013_\2465\233<\350\205\234\b=Q\001g\202\026\364O|w?\017\364\355KRt^\003~\246b"
+	.ascii	"%?\337y=\357c\346\342\226\365\274\207\274<'\033\230n"
+	.string	"\267\276_\360\230\316?\233\017c\265X\017\234\214\325\032;R\227\006\310\363]\307,<\354\210\243I\236\351:\236/\312\202\302E\352\250v\035\257\360\257#\221\025.\2044\300\275\356:n\341C\\\020\205\324u\206&\315\267=*g\204;\017\344XD\326\325\3113\335GU\347w\036US\345%\345O\337:j\351\374Ze\267|\362\342\347t\261A\262r\276\207\035\342J\226H7%\360\036*\236\302x\007\305\357&\0226\234'~\263E\234\003\027\327\257p\276\270U\267d\273/\306A\223\017\377&\214\035\363N\262\221J\203\233\377\341\343\332\341O\032^\305\"\271\354SN\305\226\241l\022\366L=S;\035~qk\316y\267\332\374\372\215\366&F\311\205LX'\336I\033\f~\237\231]\262Q\274\223\3027N}\024s?\275\275\200\333\214\3315\266\315;\311\266}\232'\027\\\001\0061&\220q@\214\033/\026\230"
+	.ascii	"\307\213\002r\304\220\221\223c\206\214g\030M6hP\3404\303\002"
+	.ascii	"'\031\026\274\270\300\tF\r\033NM="
+	.string	"<\203F\214\032N7f\314\250\3414\354\035/\305\255\207\032\343H\370\021P|\3071\213\317{\2748\024+\376\356\255x\263;\216[\274\335\327\305\025\2111\307\220\222\364\t\023\232UN\374j5w\204N\231\033\314\022\0077\007\027d\266\244bd\302MJ\2117\321\306V\342W\271\247s\304\223\210BB\304\217\360\361K(\237\206\324;\001\351\305\213\332\251\210W\237]w\350\036\037\226\242\017\343\267>\252!\376\30549^&!\276\345\370\330\210T\260\354\210:\205\372\364\345\227\2448{z\341\326\032\347\320\203x\263/\003\361k\325\232\245\320?\331\217\371\315}\330\037\021\034\004\304\271r2\027\364\001\254\210\207\377@\304\313\303\257r\201N\247\357\020\244C\323;\035\371.F\356=\027\222\257C\350T\354\177 \307\204\b\363Z\277\205$\343\2074cF\355\264\351\033\017\311]\361\371|\006\006\360Fx\310\024>\013\211\346\261"
+	.ascii	"\370b`\340\222M]\002Y\002T<\001\345\354\207\351;x\036\034\236"
+	.ascii	"\351\257>\311\341W94\033~\351\255\226\224~\003\213\366T/\365"
+	.ascii	"SHA\244\023\251\002R\005\265S\245/n\001\372|\030\013\373\250"
+	.ascii	"j\370\366\251\341W9\300\036\317\260\002\253uU\310\360k\225\237"
+	.ascii	"\223\307\007Y\255#A42zh\216Gd\200C92i\200<pv\202;\030\316\034"
+	.ascii	"\217\314\370\217\276\360\030>\335\342W\346\302\257r}K6\002<\351"
+	.ascii	"-<3\362\311F\215\261\360B.\343'\275\223a(\347K\261\347aX)*\326"
+	.ascii	"\312J\355\324\3708O\366\002\201\304\250q4&\225S2#\"\222\244$"
+	.ascii	"Ic\361\005\204(\305\224Y\035\022\200C-\nt\3161E\215$I!\303\276"
+	.ascii	"\001\326xur\323\016\225\250\263\342?\324:\017\200\327\355\243"
+	.ascii	"\316/`\275IE|U\177\205\027\241&\321\026!\016\366\341\361FC-\321"
+	.ascii	"@\231\320U\325gV\244'\230Ks\300\314\021\247?_t:\036\252\335\337"
+	.ascii	"\276\355^\207+\rD\334 \252\343\332k\031I\374W\357_\251\034\222"
+	.ascii	"\257m\332\315\353\340\027=\233\332Q\251\376"
+	.string	"\276\307\221\026s\363S\024<\035\265\314D2\017 \230|\320\036\256\375\017\207lln\203X\324\250I\2770\247\300\226TC\310\354\277\222\263#\361\261\f\301\204\037\327F\336id\240|\240\310\247z\253_\022qB\223\271\037k|\335\370cw!W\225\021\220\272,y]\300yz\356NY\245B\251\305=u\225\205\200\312\036_\225yN\007!\332_\362\227\244\313\312v\304\370\t\361\003\376\366\263\300I\n\3357\007=\263$V\325\231\3540i\340+\211\233\324\341\232W\342\267\364\301>\261L\337P\3112D2;|\326\tX#\177\367(\276\375:;\021\260\036\261"
+	.string	"\017\363\214\352^bF3\217\023\033\347\214\036\341B\023\023\302>\377}\346%#\265\336\242\376\310\364\353l\236_\026\340\3129>\330\311\036\204\312\333\263\310g\016@\344\273\360\233J\350R\361+\343^\376kZ\215\002$Ipj\275\305\352\007\007\376\006\250\332u#\017\3415\2030\364\364\262\202\0029N\023\311Z\376=\031\tk\260\302\372\227\r,9\317\356A\"\310\013\364$0K\266r\363k\252\026-\003\306\032#d\306\303[\341s\350\3272h\322\360\bO\206\215\267#\356\313\360\247p\333qR\"V\206\021\351\370\r24LO\334jN3#\256\323\023\231\b\232O\206\020\263\326OZj\341J\334B\261T5\314D\\\321v#\215\352\222\214\307\314A\256j\236\267\376\364B:\207f\002\361Z\223"
+	.string	"\350\034\001\366\303\213\333Ts\260\310\340\344\271\001\366\220q@\t\304\365gh\304v-\256\244P\242\252\t\013Ne'\361e\263\230/\243Y\365Q\360\001\035A\031"
+	.ascii	"\034-\344(/\201D\320\2007L\211\351\203\033\340\254u\234\234B"
+	.ascii	"pP\3049\330\244\370\361u\337\246\336\336\333\\\354\260\022\361"
+	.ascii	"\312R6\257QR\216G\371\321\200\003\023\021`\2661\006\273\\\227"
+	.ascii	"\036\303\3447\0270\017\020\016d\017}\307:\263\253?\210\365`\226"
+	.ascii	"\231\222\241\200\320\215\304\215o\234\030\343p\203\233\3206q"
+	.ascii	"\303j{\260\334U\r5sk\237mt\265a\030\223\340I\326\2464\215\221"
+	.ascii	"\207~\254\n\034S\225!\273\352\026r\275A\216\354Z\0261\r\2446"
+	.ascii	"3\320&CQ\220\275K=\371\371\004N\021[\266k9\314\024\022\270\254"
+	.ascii	"Q\236;\237D0\031[\n\267l'\2558o\2170\371\330}u\373\250\235\241"
+	.ascii	"f{3\323\26029FKb\236:\r"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.part.0.177.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\223\002\005\023"
+	.string	"VbvG\300RN:@\370\020\003\356;\364o\206s\376\032\034\265:\317)\245\245\017\f\033\f\320\262K\026\006\005_\016J\255\003+$\254st\026\241\220,\020L\223\320\220\2609.\370\337\346\272\264\320\214\371\264tkdo)S\n^"
+	.string	"\\"
+	.string	"j"
+	.string	"&\255\030\337h\305\211b^d\334Wg3j\312I\005\325\356.xtI\353\221\344\004\272Gx\221\356\361\276\020\315~\275\036\037d\233\006\3022\366\217\023\225\330\002N7\034$\253\335\365\036\225\304e\256\te\374\013\335\365\345\314\\\001\344\204x\0168dI\330]\267v\356x\333\017l+\260\325$\321\033f\371o\246\327\251\361"
+	.string	"\032\242\311\\j\217\025\036\256\362\3301\335\212i\026Lw\267\335\021\246\341o\267j:5\375"
+	.string	"YC\261\261\373!w\265#b\323\317o\277\355i\337O\372\315_\362\013\211\366\243\333|%#Z\314\207\354\240&\225bw_?\362\221X\030G\342\332\245q\365\"\026.\344\277N\265\310\304\220(\033\235\261q\007B\265\263\353\b\271\\\222\315.M\t\324\250W\272"
+	.ascii	"\250\233\0235\231\263*T\003P7V\252_\272"
+	.string	"\212\207 \251\033\252l\360\247\032*w\232!#\205\f]m3x\f\330\b\004\037\306\233VXZ\362_K\367\230>\276*\333\3458X\002;\303\231^\020\364\330]\224\026w\021\363}\036\035Tr\206aE\006\315r2\203q\361b0O\003l\345\305c\221\315\274\223\021\307`Zd\036\207XL\346\275l\347\341*\217]?(\242h\264\306z\250\332c\273\245;\376U\375@\307\322\226\036g\247\3469\256c\002\205\224\224\356\221\245\027:|\252M\001\211\350\324\277q\034\306\371>\256`&3\005\371\252D2\252o\013: p\002!\302\343\0060S`\024\311\343`\002\246\216]\206\364\214\262\217\275\332\206W'\027\210\323\033\274u3\277rR&\310\315\314\207 \214\306\231\347B|f\034\007c\221B\276\340i ~0\376\321\013\301\205\205\371/\261\266\212!\0230\262\b\242\036f\f\227\334-b\031\314K\214\357V\302"
+	.string	"\215\035-+y\352\262^s\357P\211\273\221\360\006\"@`\201\033j[Fyk,"
+	.ascii	"\265\027-\2479\375\3327\006"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.178.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\211\002U\022"
+	.string	"f`qF\320\324I:\250M\312\304\252\226\204\244<@\001#\211\267\364\215\323\3409`\356\373\n\2551\333\245\217%\315\030\346#\314~\013\327#\361P!\274\205\021\270\t\206 \220^#R[\265\223\265\217t\225\263\241\275\267\224)\005X"
+	.string	"Z"
+	.string	"e"
+	.string	"w\021{\022\367\375\260\357!\272\321\241j\327\307\344\320\tV\207%/\020\017\337\007\304\037\335?\302\261Y\254\303\253\260\215\343\343\230-\344HF{@\312\b\017\215\310\356n\207J\342\261k\276\230\337\375\344\\\177\364\354~@<\005\374\221D\330]\257B\334\360\266Sl\233\330\212 \357\016\375\231H\343\312w>\323S\bhh\305\niNj\221\365\375\255\022\331$\351\030\3230\246\037L\353K\347K?@\312\024\210\330\365P3\262# T\211/\375\263\247}\277\305Y\370Jg2k\211\006{\242\301\214\244jU\273O\013V\2073\234'q.\331\200\264?>H\001\252\252S<G\374\343\260xM=\207\024;Y\263\036HFC\021\244\2235\033\3107]\251\205\311\302\352M\327\301\3409\270\357\300a\303'\227\342\356\324 \3525.``\311w,\221F\206Cq\017\250f\3048\240zz\323\235Z"
+	.string	"P\355\352\274\263].\203C\361\313c\304\234\030\355n\312\213\303\220\361e\207n\315d76-\230\367j\301\250_Pljd6Wk\323\320r\241\331^^6\033\n\001\273jb^\333\215\313\365\332X\266\363\376{N\230\340\241\243;V\325\"\333\334\f\366v\207 T%e\315Q\375\251\003\2210AE\005jT\r\342\250\370\024\316\376\212\004\251\372=\356\203\202/s\205\225\225x\370nH\006= \260\002!\253\332\0060\202/\343\026\313\340\321\035\326\270\342YP\262\337\342\231u\303\207\002Q\316\301\265\203\255\2121\315i\234([\320\326\006\257r8\272\231\251\231\223\225\020\271sk\355\302\222\377\243\331\003\277\354\206\357\354\306\372\245\215\374l\260\027\255e\2777(\2746A\221fZAF\013\026\331"
+	.string	"\340\0364\002\264\333j\016\346\202\023\310c\003O\216\027\365P\254\262\375\326\257"
+	.ascii	",\2369:~\347\265t\f"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.181.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\b\n\2655"
+	.ascii	"z[\350\023D`\346Q\007+\220;ZC\005\332\036\027\354\203\224\233"
+	.ascii	"\n,p%N\324\325^\250\223\353\274\340\221\263V\272?\363o6\232\273"
+	.ascii	"\r%\307\205{^%ta\307\\\357O\307+\320\203\206\003~i%v\313\235"
+	.ascii	"RJ\0012\001\n\001;\001\315]\346\331\3204\346\031~F\355\332v\215"
+	.ascii	"\333\231\003\272\276N\246\031~\026\021\217\264\bt,q\363\244\200"
+	.ascii	"\356\254\267p\243qo\314\f\216\3322k\223H0\035\206m1\034\355\266"
+	.ascii	"\253m\033\201\330\334\341\323\266\355\201\276<\245\353\033\325"
+	.ascii	"\301\265\257\332Gk\227ui/0z\013/`\356\301\002\203\233K\233\311"
+	.ascii	"\350-\314k\252\221\241r\227\315`\356\365\372\266\026f\236\201"
+	.ascii	"d\226YO\233\201\265Kl\312p\235\005j\333V\330\367\233\260\267"
+	.ascii	"j\326\354s\266\215\212\210~C\276\036o\247\313\255W}\007\262\334"
+	.ascii	"4\332(\254\213\210\300\372\247\032\340\223\366\247\327\220F\324"
+	.ascii	" \017(\3076k)1\244\322\207\324\240\023\261)\275\206\374R\rD\315"
+	.ascii	"<\213\356c\322U\244{R\274\334\204$]Dz\327k\310!-\206\024\342"
+	.ascii	"\272(1\244\227"
+	.string	"\347T\003\3127>z\rID\r\312Q\202\247\321\332q$\271|\365c\022H_^\022H\253j\2018>\320_\262\206\252T\203\007\224^r\313\277\321\272\003\233;}\222t\025i\007607\241m[n\242\223\346\243fn\007\314L\305\274\013\022mq\254\"\264\301\321}\003\267n\243e,\312\375%\203h\265!\003f\021\375\306*\001X\333\266\r\332\264\233+nf_.a\302\304\3327\367\273-\337\034\327g\fM\375%\037\350\365\033\255\251\240u\250xq\333\3628\376\366(\023\017\334\377\222\231\357\257\351\243T\375\373\356\3476G\327\177\365/!#\024A\373\377\267QY\364)\367\3737W!\3564\035=\301\315d,\024\336\307\276\334(\326\276\375]\326\267\n\323\017\231\027\321\247\376K~`\267\0234=l\360/aV\235\007\250\316S;g\001\235\326,\245s\216\3329C\355\234\003\350\234\237t\316N:g"
+	.ascii	"M\327\231\351:/\255\316J9\347\244\353\034\274\316H\327\371\350"
+	.ascii	":\003\257\263\321u.\272\316D\253\363\357:\017]g\337u\356]g\336"
+	.ascii	"u\336]g\335u\316\365\230\346Uu\276\327Y\275\316\177\235]un\b"
+	.ascii	"\336\024\026i[\036\323A\355\221\013\215\322c\272\323\272\235"
+	.ascii	"\375\314\001C(\327a\365\3449T\266\243\224\350S\004~\034\352n"
+	.ascii	",}\247i\236\221A\211H\3226lw\273\340i\362\240H'\213\356\227\234"
+	.ascii	"\243\323U\253\322w\022/j\323B]\265\376^\351\217\226k\302\030"
+	.ascii	"\225E~\343\022\363\226\373%;\231/\247\232\373\335\343`f\255\254"
+	.ascii	"I\257\305^\364-\326\n{\205%\363>\262dk\337\244\017\301\234\302"
+	.ascii	"y\005\235\3060\311\333\r\254\0266\244\017&\021:J\211G\217\364"
+	.ascii	"\354F)j\032\370G\337\304\366\004d\314\002\374BC\2456BF\357{\340"
+	.ascii	"\023\235=\367\030\225\276\0274t\212c\313\202pJ"
+	.string	"5\236u\216\322\242'z\243\177?F)E\027\rh\310\340\017[F\365\326~X.\024*TX\373\026=\0037\351P\327g\203\005\017D?\202I\b\016\372\333S\025\004\313\323z.`\310\220a\035\372\337\277\031'\322\367C\317\0245f\351\375\356}\177\325\214J\031_hx\337{\250\263\347\323(\306s\033\006\3334|t\255\331\356\236\367Il\316=\306,\273gf\255f\033\"\265\265m\353\200{N\323\331\300\301\203\367\321\303\332\327),n\375%\177h9\303\376\022WVN\302\312Y`\275\270R\271D\002\026+N\b\263\260\204*\260\256R\bKh\261\020&@\342\254\025&\264\204-\262\262\264\204\275\236@\374\242Q\217\26018E\277d\177\254\354S\\\214\375\021\204\025\"d\355\033\203\031\006\313[\325\312\336t(UD\330\257\257\265\357\013&\230@oD\251\2237-D\n\234\333\214E\302*\361>\362;"
+	.string	"S:\177O\353"
+	.string	"\335Z\367\323:\365\003\236\235\313\253\350`'\226(\246\276\315Zm\363dJ&\340\231tY\267\0167/\227z\001\377\244f|S\"\365\r\355\013mF\341\274\242\036\211\253\035\245Q\357nch\240\236\375\313\225\374l\302N\357#;\325\216R\342\263\2137\210\304i[\2260\235\352\331j[\342T\200\207\022{\372"
+	.string	"\337y\214|\234\036\300?}\033\245\024]\210\017a\303\236\260\315\346C\205y\025pfv\nK\305\373\b"
+	.string	"\3506\226\026\247\3704\370\207~\311;;\275\246\177;\216c\375\376\343\305\216\332\266m\353\373e\257\337\364GgN8Fe\261\307\364\314\037\374\207\217\036T\236D2\201!\220\244\223\344-=3\b\337\021\200\333\250q4\346\224R\246\204d\244\240 \005Ic\200\002\021\"+\326\001\021P=e\246I\322\312vZ"
+	.ascii	"5\310\026\\\013\001i*L\007\024n \300\031\227\300\246\177\201"
+	.ascii	"aV\"5\254\345q:\002\266q\013\201\350D\303\202\0203\200\334\222"
+	.ascii	"2*\321\365\244\236_\342\277'\370\203\002?7\220\3729^)\332\262"
+	.ascii	"\030gb\241b\3072\371\256\203\207\334!Z>\226[C\0302\341\277\220"
+	.ascii	"\034C\252Mr7C\2464\354\240X|\177t\001\371\251\321\351H\016\322"
+	.ascii	"$\276\004!\244\205\301\344e\303\346d\020\242\306b\247\350\373"
+	.ascii	"\177\205Rx\031\331[\034B\301\241\375\301\331\334\332kkP\276\240"
+	.ascii	"#a\265\bYW>\024\021\236\f\001kH\325\036\244i\321\257\007\326"
+	.ascii	"e<`:*F\\\351\3570w\321HG\233\210y\231\032\0343\337,\241\236\t"
+	.ascii	"\304L\341\036\237\001]\325K\037\001\203\361\b\212\001d\230\263"
+	.ascii	"\343\023/\237\017\365\274\353m<\314\215\030\362\330@U\336U\177"
+	.ascii	"\376\341Z\220\201\210\303\330\303e%!\310\354D\272\275\361\034"
+	.ascii	"\177\200\370\006h\222\277\027\001\307Ay\277\306\230\357\025\354"
+	.ascii	":\267\364j$\277\245\224\002\013G\334\374\354\031\255\344P\b\262"
+	.ascii	"\034\362\343\221\206i\t\234\251\t\021\007p#\003\265@U'm\213\234"
+	.ascii	"]&e\"T\023\006&co\343\033\351U\216.,\017z\177\376M`\200#\202"
+	.ascii	"\004\334\323,\231\324\022\323\313}\257O\223Ef\376\262\2765l\265"
+	.ascii	"\t\270\020\350T\352\202\021\203<\340\001H\377$$\325\234\371d"
+	.ascii	"DB\fK\353\252#\321\316\030\215\237Dy\177\313\323\233g\nN\003"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.182.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\325\001\375\017"
+	.string	"&\035gF\360\260(\0358\331\3414\227*\343\275\200\231\277\317\267\375\267u7\361\265\375\rgq\355\r\343\316L\214x\275\372\2253W\275\002\262\327\b\217\302\327\311\340\211x\207;\007\037p\270Z \025tP\346g\232\335\233H\231RS"
+	.string	"Q"
+	.string	"R"
+	.string	"\207\247\261\315\262\203N\213Y\020n\331A \034\326\345`\005M\007\034\241\335\355\016\025\305[\217\220\323\024\265|\327\243\210\303\374b,\347"
+	.ascii	"\304X\256\334\202\227\032!J1\030\367\321c\002\350\265\247\207"
+	.ascii	"\330+\223\300E\242\221\335\365\250\345\036\335\266\005\333\t"
+	.ascii	"\354\214\020\207.2\03335"
+	.string	"+9\224:\263\212\316\255\236\260aZ\271tr\351\007H\031\004\227\335\017C=\026\006\362\250\370\315\355\263`\3715\223nX\247\251\204\220`phM\3735\267i\235\246b\270\013\223#c\227\326\340\320\bF\207\002\376\021\017\363\005\342!)2\246PR\022\017UId?3\262\001\031\362T\264+\230\344?+\360\031q\203\251\313\251:1tJi\237\240\344\277T\265\371\264\334^\352\362\325F='U\212\201\2418\276\0346\206\277H\215v\367\201\357\3428\236/sh\r\253\374w\350\257\342\341\365\265\247\373$\262JA\351<T\227\001e\222\352N\252U'b\300^\312\211\252\333\340y\252\216d;?\262\242\257x m\t\023ln/uY\241\316f\334\006\002d\313\235\035=%8\235\231\"\r\022\331\217\220\016\375S|/7\325\231}ST\275\320\342\006,y\330\3379\217\311\017+ \260\202\231\301\35202\230"
+	.ascii	"\211\003IW\324-+\032F\253\031\002\017X\023w\356\214o7\256\"\217"
+	.ascii	"u\200\226\220\211\035\256\345D\270\341s+\033\227\316\004\030"
+	.ascii	"\031B\244\205\210\205\301O\007\231\311\234\262dD[K\030\323oV"
+	.ascii	"\270\263J)\356\205n\006\030}_)\217L\036\367)\257\273\361\332"
+	.ascii	"\205\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\343\n\225("
+	.string	"jA\220\016;@\352\311p\260v\251\306%,\220\316Z\032\035\337 \335|y`S\267\234\201\007\200\017\266\005!\221{\221\031\225$\036\354\247-\003$\353a\353\361\376\247\346V\266>\300\262\255\3342\005\333"
+	.string	"\325"
+	.string	"\334"
+	.ascii	"\375B\034\030\030\230\tJ\237\316\374o\026\321;G\356\205-z\322"
+	.ascii	"O\232\036&8\351\205c6\371\037&\367\263\344}\224\234\317yb\222"
+	.ascii	"\007BrN`_\217|O\003\264XL\277z\331\230F\016\250\310\037\021\271"
+	.ascii	"\243!W\ny\243 \327\003\362\273\037\307\353S\264\345\315G\277"
+	.ascii	"\222\331\343\221\274\016\211\307\363v\\R\327\227\346\334\237"
+	.ascii	"r\215\216>%3\307\026\016\t\032\206'\2437\226\213\r\256\032G\322"
+	.ascii	"\270\236\031\207\223\361\343\031\243\003\214\335\322\340\305"
+	.ascii	"\206\271X\262\026;fa\263\260X,+\366\212\212\265\262\310Nch\212"
+	.ascii	"\376\"\023\305\205\023\253f\342\226J,\031\256\r\347\211$,\234"
+	.ascii	"\374o\212\216\330\264\023\nEQTD\037S\020-\026\321\267\277\377"
+	.ascii	"8\262\205`\346o,D_\221\371\037\200]rz\275\304\351\375\002\247"
+	.ascii	"\027\314\233~\240\233\276\2466}@6\375Nkz\303\250\351-\266\365"
+	.ascii	"?\245\351{2\366\022\331zQ4\375Mgz\315\324^-fz\273,\212\242?\203"
+	.ascii	"]\353-\3332\254\206\201\314\005\235?\223/\260#>\274\322\036w"
+	.ascii	"\3768\300pt\201\3558\262\343\313\206W\021\n\3374l\321Nh\314\031"
+	.ascii	"\235\275N\314\355\302l\225\023M\255o\301\364\017}\341pz\351\255"
+	.ascii	"c\256\331\2169Y\254Q\247\264-\353g\352\322\3773\271,\332\226"
+	.ascii	"\fdXZ4\214Ye\321\302\222u\345\352dt\255T\265%\273P\331*\275t"
+	.ascii	"L*\025\316\023W\214\302\224\3368a}\277\264\337'\245\177\351\350"
+	.ascii	"\226\325\337\333b\237\017\313\b\310\267\304\376\244E\373\211"
+	.ascii	"6u\337P`\224W<`\335\007z\227\374\004\250ku\247H\315\365\2548"
+	.ascii	"*\205d\305\301u\251\264\342M\037\311\212\203\351B\345U\361\246"
+	.ascii	"Q\313\273!K\245xC\006\220\006X\267\200\2266V\356h\310\003R\003"
+	.ascii	"\353r\310S\352n\002u#\244-*\313\261z-W(\227d\033\242n\360M\314"
+	.ascii	"\233$\351B\345A\242\373\243!7Y\227\n\315\221\355\312!\177\335"
+	.ascii	"\255YG<\243r\300<\324=\021\355\371\364FT\274 }\035\025\233k\351"
+	.ascii	"*0s;#!\357\336\272\246r\217\335\353\204\274m"
+	.string	"\313V\334%z\232s!;i\202\\(\261?B\027\262\222$\305\2575\"\3105\355l\302\273\220\201\334\375\360B\ny\301\022\201\272\313\206\355\354vB\276\323+\345\2557u\353\235b\247W\254N/\025:\275b\346\364\236\005G\240.\00445\277_z\222\247T6\352\225\275\357I&0 \300z\345\223\034u\267RbF\264,\277'9X\334\235t$C\373\034R\353I\306\223\204\374\363\277'\271K\3719^\325\322\3478\210\224\373\034K!\327\313\261\324\332\026h\213\003\247\352r\274E\270\307\261\001ujy\345WNp\267X\306\264\270\303}\345\005\310\257\354\340x8\226\332\373\221\243V\276\037O\207\307\315X\325\201\227\003`\231@?\237\343\342\017Z\\\034\\N\332\342\240\272k\004\344#tJ[\334\005b\241*mqp\315\201P\213\027\211e\350*\213\267Hf\210\305 \226/\t\213\023\250SK\003\252\200"
+	.string	"\351^\310\033\244Fj\335\003tr\362\334\321\325\0033\277L_^m[\241\266BW\006\200\307\250Q\020I\303\020\215\314HR\220Jc\320\002)\"N:\021\260\024\303P\231\tDDDD$\351\001\027\260u"
+	.string	"\324C\022>\333\357\003\276\200\351>\354\205\233\247\365\367\340)&\370\254z\n\331?\034\"\226,\205a\371\301\337J\334}\n\035-j(\f\215\263\241\215\t\376X\270\201\320\357\347a\210e \307,\343H\331$\216o\356\351v\341\b\013\225P\001IPj\304\236q\352\013\016\275\202\361 enp\036\330\366\002\024\215\231\205/\004r\311\301"
+	.string	"t\304\004+Tg\254bM\251\032A]\341Q\233\350\254\256\243\001tx\343\277F\341\257!\345\271\016}\215S\217\225\360{\224z^\005}\001\275\372\332 \202l\004:H\364\255U%C\242\242\357\374\204\201\201\214\213Z\370\221\b\320\212\240\273f\375a@D\\"
+	.ascii	"H\276\362%\252\274\267B\371AN\234\313\341\340\312\013\270u\352"
+	.ascii	"\013\214l6\\\030\257\032\251\243%\373\0221\023u.\b\337c\323\214"
+	.ascii	"\177}\006\372\020\367\263\363\002\217\347B\332\033\374\201!\366"
+	.ascii	"\246U5\311\207\363\366\313\363!\323\255\206\223\252\331Jw\370"
+	.ascii	"\374\307\363\361\3011DC\337\374\301q\226M,\352\217u\031\225L"
+	.ascii	"D\366\n\317\0321\365\224X\235\207\337\234\375\363q\3027\331\345"
+	.ascii	"\352\002\373\357\314\t\265z\257\361\364u\324"
+	.text
+	.section	.gnu.lto_.refs.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\332\006M$"
+	.string	"\372[(\017H\300VQ\241\003(\211\t(F@1\3068b\033Q\033\0208\blS=\333\334\240B~N\354R\004A\020\004A\020\004i\n\204E\3113\022\bQ&Q\250\032\213\376u\t\2430\326\375:\354V\331\214\265W\277\225|\"S\341"
+	.string	"\347"
+	.string	"\333"
+	.string	"MQ\373\242\200\371\232(A\002\374\216\240\365\212\240}C\274|A\270z?\270\276\036^z;\264z9\260z7\260\276\032f\275\031f_\f.\275\027Zz+P`\351\225"
+	.ascii	"z7\202\254?e\345\227\022\353G\201\262\322w\242$\311\221\"C~\364"
+	.ascii	"\340\321d\203\006\323\322\013\320\373\026I,\302>R\370\037\201"
+	.ascii	"\277\021\254\177\002\366\005\300/\202u\001\240\367\020\254\007"
+	.ascii	"\301\036\b|\037X\357\001\275s^\217\363\3527\340\347\300\267\001"
+	.ascii	"\177\004\337\366\3523\340\313\200_\003\237\006\376\354\325[\300"
+	.ascii	"\227\201\277\002>\f|\020|\327\253\263X\277\002\273\252\365(W"
+	.ascii	"\377Z\375\304\352j$\347P\035\367\275\r\252\337\276\037\275^\243"
+	.ascii	"\3526U\247Q\3515\325\323T:\213\352_\250\007\277_\245>\205z\324"
+	.ascii	"\367\247\323\327\273\261W\325\b:\\\307\341\336f\354\243\256\333"
+	.ascii	"r}&\367\"\256\307\340\2766v\232L\177\311u\227\334\267\340\272"
+	.string	"\f\367\261\261\207\271\016\303\365\227M\007\307\336\032;k\354\252\261\247n\275\3435B\337\204\tM\177\211\355OB\363#\231\365\215\314\376!\261?HK\037\310\017\227\276\217\036,;t4\335\210\315\260\365e,\355\302H\374M\210_$>\221\370A_\017 >\320\327\177\304\367\t{O\370;3\035G|\235\3706a\037\303\267\315t\031\361a\304\237\321t\227\260\263\204/\013\373J\370\260\231\177}\335%~\353\353,\361W_W\021\377$\363\2059&\210\346\301t\317\202\253{\025\\\357Qxyo\002\330\275\b\255\356Ah\275\367\340\245{\016\200\370\330\241#G\223\215\0324f\310`\212\261\004\343\353}\001\373*\205_\244\327WE\255\007\303\262\257\262\253dOeGe\377h\336\247\354^\366f\003\264\354\n;+\354\037P?}\357\001\365~\377\250\036\312\223&\271DI\022$F\210\b\361\311\035\036;\262\351F\r"
+	.ascii	";\371b\367\267\350Y\221*\322\350\304\356\013\360|Q\276\200|\242"
+	.ascii	"\354B\371A\331\003d\377\311\356\223\275g\347w\262\353d\317\311"
+	.ascii	"\216\223\375f\367:\235\307\345\374-\277&\273-\373Lv1\273L\366"
+	.ascii	"Z>m\367/9\357\222/\333}L\347_\273\007\263\267r~\225\217\312o"
+	.ascii	"\216\263\321\377\200\271\375<j\265?\007\016\0330?\215\334\317"
+	.ascii	"D\353\307\240\215\331W\312?\351\326_\201\373\221\216\306\276"
+	.ascii	"\221\356Gq\3237!\366\242\233\037\220\353D\271\037\302\365 \334"
+	.ascii	"\003\215\335\347\246\003\270u\036]\327\321=N\256\337\344>\177"
+	.ascii	"\303\273\311\333\361\032\234&zF\017\372\336\347\031\271|&\354"
+	.ascii	"2\341\307|\275\266\363\262\354+\371\256\374\325\356O\fh\257T"
+	.ascii	"fb\372\357\005\251[\341\263\302\236zi\005\250S\341\tN\017\t\375"
+	.ascii	"\204\357s\352=\247\347\331E\3279\365\334\305\333|\3756~\275f"
+	.ascii	"\245\227\271\305\307\254\324_f\321]N\352,'\275l\026\037{E\007"
+	.ascii	"G\352\255U\364\325\367*\337\247>\352\375h\004\264W\033u\324("
+	.ascii	"\nt?\357@\312@\377\276ox\001oT\252\004z\253\310\233\265\373o"
+	.ascii	"\367\200\217\250w\347\241\336\335B\005\220\235'_gw\346\353v\237"
+	.ascii	"\323y\233\234\037\363m\3714\017\223\235\226}\226\335%{Kv\331"
+	.ascii	"n0\277\265\013\022\277e\037iv\275\246\363\264\234\237\345\263"
+	.ascii	"\344|,\177%\033u\250\201pGFJ$\222@$(H\232\024\016\340\002\251"
+	.ascii	"\221\231\035\020\310\222$[\007$\225p\352\212\037\026\274\205"
+	.ascii	"\331Z\n\264\203\303^<:nrl\330F\341\221\353\352O,\034\376\275"
+	.ascii	"\236y\346U\355p<\245Y\251\021\272u_\355F\350\251\246D5(\265\r"
+	.ascii	"\303\326\246\215Y\312Y\265\027\212\007Y\333q8@\226\202\224\301"
+	.ascii	"F\03512(\327=\b\361H\0172\020Q\315e\366\2008&>\257\226Zt\245"
+	.ascii	"%\2149\243\361g0\225'\334\212\335\324\352\234\277\346V#\016\255"
+	.ascii	"&y\2134V\177`\226\205\304\352\b\317H\032\303\220\261\271a\372"
+	.ascii	"\300\337\221U\034\206\023\324\254\306\337\350.X\005"
+	.text
+	.section	.gnu.lto_.decls.b890e4694cb680df,"e",@progbits
+	.string	"(\265/\375`\311s\225\347\001:1#\260S \016)\235\306\252M\270\032\013\254\300\205\016*\034C\250\024\016\253\302\214\206\343\234Z4Q(1x\031`d\211Z\253\266\222\036\035\214\021\304\2108E\307V[\375\177\320\2269mFz\346^\232\007O\177\016\3551\273\363\2170Do\272\373\272\311\275\267\224R\246Y\t\355\nZ\013(\210\375\335\037o\226\315\346E1@\254\257\204\272\033\327"
+	.string	"\274\017>\370`\307\026\261\301\031e\310\307s\372\230\211>v\323\307i\372\330\251\217\233\372\270\210>\346\322\307<\3641\016}\034\245\217\2334\215s\205\246\261ie\277f\377\025\273c\226m\370\005\215\t\213\233\257\223\347\267\354&J\230\030\337\315w\316\346\244\307EZ\307iu\322Kw\233C\322.$w3|4\005\261l6E8\373hoi\213G\217(\035T?\2000\335!wK\351j\r\271;T,\0323j\f~]\257k\344\206\335\"\027\354\022\261\315;\344\n\371\345\272]\277N\334\205l\311\023'\037\316\352\2442v\372\327\211\376\205\323\277mz\007\211\376\035\323\036\210\350\020\254N\372\033D\3777\307\331\024\222\033\177Y8\276f\310\245\335|q\374\367\306\305\252Ar\304h\312\315V\313\352\244:Vx~\257\3068i\332ae\303\306\317\b]\225ErkX6\022\354\335\266\367\306"
+	.ascii	"C\265\235y\335l\267\325I\355\030\236\337\2521_Z\244Qy\250\371"
+	.ascii	"\302w\3645\345\201Fb\302\326\274\371\2774\230Fa\366V\334|[w\225"
+	.ascii	"\336\230\324.\013%u-\326\306V\334$\233\227\206\202\027\335\326"
+	.ascii	"\221\313\264Jl\\\210\245m\367\240\227\333s\311\342\tz\265=\367"
+	.ascii	"\336\026\311e^\243\233\024\002j[\245A\257\272\347\230\b%\\\246"
+	.ascii	"Mb\331l\212\234\333\251\0046(\301\257\275\235\377/\324\215q\245"
+	.ascii	".\214;\343\276\270OW\306\215\262\315\313\274.~\233\256\323\007"
+	.ascii	";\352`Z\013@\r\371n\253\223v\2609\351/\223\376=\322\267_\364"
+	.ascii	"\355S\337\372\351\333;};\247\357\321E\262M\017W\205\363f\310"
+	.ascii	"\267\245*\355\346[7}\353!\275\361\220\336\252\351\377\026\335"
+	.ascii	"M\203\305\264\222%\346w\377v\214-\264f$\300\200\306\256n/\314"
+	.ascii	"\315\037\264:\351\215\315I-!\317\255\030]X\310d\307\31566'\375"
+	.ascii	"m\0300\227\320\006\222)`\276X\253\275\321^\344Y\221\272\331v"
+	.ascii	"\261^ls\203\035\f\324:z\272\371\266L\263`o\273!\265\205\205v"
+	.ascii	"C\372[.\033\324\"q6r\bniai)\313\315v\213\305\273V\033\203\231"
+	.ascii	" 2\344\262\334,\002\317m`N\312\214r\356\264\275\367M\372\325"
+	.ascii	"\344\352\313\315\277\325\362\004\002E\f\313\315\377-\240\275"
+	.ascii	"b\263X,\366\3176\355\323\366\335Z\261~GD(\301>m\022\313\206\235"
+	.ascii	"[j\022,\265\347\336N\036&6\316\306\bg#\035\221m\355\355\274m"
+	.ascii	"\362\363\310\215=\367v~\204\237\347\366i\347l\025\\\306\254\300"
+	.ascii	"\236\330\323>\255\022\033"
+	.string	"\207\235pz\305Y\332so\347\316\007\037|\360\301\007\232\005\226:$\232l\255\254N\252\301\346\244\267A\370vh\\\004!\f\274\371\366J\377\267S\254\024\273g\233\226\212\315\273ub\233<;\367F\032\32332B\024\213g\203\204\263\221\260\202l\355\275o\353~\236[*\366\211\305\303e\314\215\204\025\367\301\310m\351ip\357\275\363\301\007\037X\266\034>\004u\276\n\364\217\372%\320\326\316\336\331\346\345,\224[:[\367!\222s\243\355\275o\354\216\271\242\0357\277\204F\261\367\336\366r\251ZXXXh/\227~\004\272\203\325I\263\315I\377\001Mcs\322\267\240\237gu\322G@\377iuR\353f\337l\323\003\013w\333f\217\0345rn\347\336\316\233\333C\214\332\331\315\017\241o=Hqa\241\365 \375\b\372\332\234\324\246Y5\333\334\300\2569oj\306\030\031\023\346\346\203\240o7Hm\241\335 \375"
+	.string	"4\216\315Iq\254N\372[\264\rn\2342\\\340\270\371\266i\317~+f\307\254\031Vb\262\332i{;1L\200\310\324\225\233\255\323\226\335\232Y\262\213P\302q\221\331n\356\275\255\031\tV{\033Y\263\033\302\275\215n\254\355\300\332\0162\030V\220\2654\237\003}\247\325I\265\315Io\303>c\266K\370\325+\360\216\214\002l\017\325"
+	.string	"\016g\251\030\370\257\235^\215\377^\341\250<\345\346\370\257\216\037\303\300P\367\306\217\231\270\t3I\301K-\354 \201\225\216\200_\305\200S\360\337+\275K\311{$,\2727\370U\253w\335\244h\200\225\270\003i\027v\341\317R\376k\"\353\341\f\344\274\034\345\307\026\310x\177\376"
+	.ascii	"\345\307+\344\273l\227\237\374\326J\346\240\356\317;tV\316\006"
+	.ascii	"f\r\376[\201\f\200?\317- \003\177z\002\271\377\201j?V\302Vx\305"
+	.ascii	"\315\177\377\276Hy\340\377-P\256\336wZ\270Q\374\236\301\217\026"
+	.ascii	"\371?\230\343\376"
+	.string	"\303\345\265\375\347\256\333\374i\341\237\217po\177&\272U\356\001\t\254\202\364\213\007\236\345k\270\003B\262\bn\377[\300\312\377\352\237V\371s\211\377\246\335#J\376\374\323\366\337\007\374w\004|d\273<\377\255\300u\3764\n\316BCY\374x'#\271W\266\017\311o#p\270\214\r\340\201\006\026\016\003\326\003\226\304\b\373\201\337\212\340\267\304\337\216\240\304o\223\374\326\304\217\005`\223\226\350\267k\277]\301\237q\376l\243\366\333\027\277\235\372m\324\377A+\343?\234\265\361[\250\337b\375V\355\267Y\277\005\362\333\255\337\246\375v\310-\264K\254\323\212\375\327\033\263m\277=\362[6\253\004s(\273\376\357\301\316\377\002h\220k6x\340OG\370\257\301\355p\364O\343\376l\377\234\226\223\374\026\001\277%\341\267!~\253\200\337\232\360\333\004\374\266\204\037\357 \371\217\345\377\337\177\277\377{\377\263\234\317\022\340^Y"
+	.string	"X\016,\206\337\356\374\366\202\337j\370m\206\337\346X\234\377\316\345#V\347\267\030\020\376\031\355\317\352\331\377\302\333\001\004\377\0130x\207d\263?\227\375\026%\301u\027~t\375\363\330\377\f/\273t\037\376\250\020\017\256\220\334\274\3045\013w\366c\256\254\202\260?\243"
+	.string	"\373s\316-|\226\377\262e#\277\225b%\177\335'\271+\033\025\371q\216L\344\307\005\370q\361\317^\177N\032\342A\026\336\302?\376C\340WA\360c\005\210\340\026/\023\234\302%\236\346O\311\376\373$w\375\031\004\\p\377\255\300g\376\224\350\317B\376\333\264V\262\001\376\274\365_g\220?\017"
+	.string	"\210\255B\345$\356A\316\201E\360\377\203?\r\373q\0042\003~\3747\352\277N?>\341\307(d\037\377\205\361\337\251+\203\035\220{\374\371\204\377\026\341\361[)\277\275\362\333\271\337\362\375Y\303\216\337V\371-\225?\273\360[\001h\375v\312o\373\254\225\013\227u\270\370O\342\277\006\377=\370s\216\377R=\001\177Z\344\277&\376\273\376\267\347\277>\377\375\371\361\332\177\211\"\376K\342\277\314\257\316\370q\226\037k\371\361\363\307X~|\345\307\200?\336\362\343\024\262\215\037\323\375\330\357\307}\271\306\377\233_\265\362c\022=~\234\201\377\256\340\277-\370\261\210\377\202\340\277*\370\237\376i\326\217WHc\374\330\001\177\256\3723\225"
+	.ascii	"\376\034\365\347\031\177~\361g\250\337\022\376v\360\267a~\013"
+	.ascii	"\346\307\r\370\263\323\237\233\376"
+	.ascii	"\274\364g\026\3773\374i\013\376\1779Z\367_#\277\177j\200?\257"
+	.ascii	"\370\363\321\237[\360\347\025\3749\305\237\211\376\214\374s\t"
+	.ascii	"\376\f\364\347\236?\207\340\317\033\3703\n\177n\300\237G\370"
+	.ascii	"3\210?\177\360g\002\374\271\303\2377\374Y\347\317\030\376\254"
+	.ascii	"\377\234\377|\177\f\346\307\203?\356\362c\301\037\263\3758\354"
+	.ascii	"\307_?\366\3721\327\217\177\374x\307\217u\374\330\352\307+~\334"
+	.ascii	"\202\037\327\370\361\324\217e\374\030\306\217\241~\314\374q\323"
+	.ascii	"\217\231~\274\364c\245\037#\375\330\350\307\373\307*\370q\007"
+	.ascii	"~\254\3741\362\307@?.\376\230\370c\005\374X\004?\006\301\217"
+	.ascii	"=\360c\027~\254\201\037\267\360\343\n\3748\205\037O\340\307\021"
+	.ascii	"\370\361\003~\274\200\037#\340\307%\374x\204\037\363\374\030"
+	.ascii	"\304\217\017\360c\020~l\200\037{\360c\001\374\270\203\037s\360"
+	.ascii	"\343\r~\314\341\307\033~|\301\2175\3748\303\217o~L\363c\231\037"
+	.ascii	"\353\037\247?\316?\276\377-\374\257\230\377\016\376\227\313\177"
+	.ascii	"\003\377\013\370_\256\377\376\375\327\357\277U\376;\345\277z"
+	.ascii	"\377\215\362_\273\377\322\375\037\374\017\367\277\205\377\256"
+	.ascii	"\360_&\377\235\372\357\222\377\302\375\327\355\277\336\177)\377"
+	.ascii	"\257\374\267\355?\337\177\323\376{\344\277h\277E\377\353\374"
+	.ascii	"o\363\277F\376\013\342\277#\3747\203\377\026\371\357\220\377"
+	.ascii	"\252\377\313\376\257\375\207\362\337\036\377\345\361_\255\377"
+	.ascii	"b\375\367\352\277V\377\255\300\177m\374\267\303\177k\374\267"
+	.ascii	"\352\277T\377e\361\337\243\377.\377\253\374/\362\277\306\377"
+	.ascii	"f\340\277\030\370o\013\377e\341\277\026\370\357\177\373\367["
+	.ascii	"&\277]\362[%\277]\300o\t\360\333\001\374"
+	.string	"\226\203\337r\370m\006\277\335\360\333\377\007\363_\360\377\226\377\317\377#\376\263\360\377\354\277\331\377\260\377v\377\005PXXX\370\343\364\375\030h~\r\034\tZN\016\245\013\034\200W\213\271\243tI\351\030V\025\0357\243N\354\331\377a\3762\343I\360\316yg\200i\361B\227D!\233Sq\363o\3404\n\367E\347c\353\346\337 \321?\352\326D\335\354\226\2249L\302\252znf\024\b\232\t0\211\213\233\177#\246\177t\255\211\256\241m2{k\251\212\301;0([S\2260\246\233\177\323C\377\006\207\376Q54\255\356\331\244\345f4IVS\3416w\363ob\350\037E\202\242\r>\241\302\342f33\024\215\0049\3023\333D\321\320\260%\316\031lX]\376\336n\376\315\326?:v\264\354G\311P\247\f\215\276\246\253\233m\237\325I7\2609)&\302st\f%\"C\352G\363\250\2305S\333\362"
+	.string	"\237nF\303x\2166\255\210\024\301\272\031\003#M\324\310\305\341\301\271\213\354Y\024\224\340\340fF\201`\001&/u[\320\"6]Zp\231\273\3716x\232\310\017\264\013\035r7\316\226\262\2078\274\374\236\233\311\004\3416s\372(\0204\310\321\255\243[(\227\335{\357\250]\244%\004\257;(\301\301\035\305\364\200r\341\270\233\367'\006\357\346s\261fY\356\234`\335|\233$\372\267\277\177\272\215\230{o(\324\271\231G4\351ooQk=\3745\026\333"
+	.ascii	"\374\317\370g@\013\366>\252\362\265\367\266\202\272\353\315h"
+	.ascii	"\252\303F\363\366F\272Q\004\201\033OH7f(\241\335x\302\240\204"
+	.ascii	"vc\027!\001)\302\300\3347\212\224\320\366\306\200\204T\204\202"
+	.ascii	"\325\223\022\232\321\306\240\204\266\237\266\n)Ov;o\024m$\253"
+	.ascii	"\215a#m\243\215f\365\324A\t\351\306\223\022\232\321\023\006%"
+	.ascii	"\264\033O\033\355\306\306\331HFL\026H\233\211a\243\335\320\262"
+	.ascii	"\321\254\236p\224\320\254\236\224\320n4\255\033\213-c/\370\276"
+	.ascii	"t\264\331+%\244\335\344\202\312\210\211\223\247\344\264\332}"
+	.ascii	"{\333\264\244\315\334y{\007`o*+f\237\321\f\013w\224\327t\324"
+	.ascii	"fde\235{\357"
+	.string	"\r.\216\260\2546R^\221\335yJC\254\366\036r\004\264]\354\2757\tE\316\274\275\303\346\025\341\240\332LI{g\260\235{\273\330\273\310\356\274\275w\321\336[eR9\367\246\201\243\264\345\302\305\336Q;.6UQ\\\322\3367\315\017\356I\t\r\313\212'\016\t\332\326^\341,\262JLV{k\367\335`j\264\242\262\315\264\367\266[\364\326\323\213\300\233o#\245\177\324\207\\\017\224\007\312\003\335\2415\334A\026FC\353G\263\320\034\250\016\03371\025E:n\361t\221\022]\322\315\327iuR\017(\016\024\253\346\251\207]\033\212\025\247:Mir\272q\223\264Z\226\274\026W7HS\020.V\\6\362\320\032MY\356\t\213\226*\224\212F`U\331\315Si\035\363Y\345\346\333$\351\377h\024:\003\215\201\302@\245P\031\266\211\322@\241P\032Y\fe\3422\246~;\372{\272x1\270u\273Z"
+	.ascii	"\2424\320\247+O\\\307\224e\013\245\201\272\330EZH\020\213\003"
+	.ascii	"l\016\356\355\334\341\363\222Vg\223_\343D\277\346L\277\206\b"
+	.ascii	"\352d\321\222\354\bs\363kl\240M\33753YpiF7\277\306\205>M\030"
+	.ascii	"}\232)\372G\227P\0269\356\230\274n\376\321$t\005\252\224\323"
+	.ascii	"cO\314\315\331\312\352\244G\2639)\252\202\347h\022\034\0274$"
+	.ascii	"7\377\fEB\217n\017\302\263)\364\350\317]\262\027\324\350Z\341"
+	.ascii	"\bS\301\345f\264\250\003,[\312n>\r\235\376\b\205YH\306[\241\224"
+	.ascii	"\307\240\3336sa\376\222\0133\230,\306\246\310\271\213T\035,\240"
+	.ascii	"\004\007ua\321\026[J\370,\346\317\203WkXU%\345\350\346\034\206"
+	.ascii	"\347\231\020\367=\305\305\270\031\2659\351i\340\364i\320tjsR"
+	.ascii	"\234guR\006p\271\023\314[F8\222\005)\360y\313\377\262\326\242"
+	.ascii	"\334\234\265\360<\007\316 \301X\003r\363\360\231\001\207|.\330"
+	.ascii	"j\374=\003\376\031K\316b\331H\020\230\303K\333\3153QV'\265]6"
+	.ascii	"'\315Wx\236\377j\344\210\\=o\266\\~\331\212\312\307\345LJ\256"
+	.ascii	"\222\371\362\224L%\367\331f\266\222\367\242d)V2\223\251&M\362"
+	.ascii	"\334\036\215:\273\214\027\365\314V2]~2\203%\265\3645(C\245I\217"
+	.ascii	"=\232|\232\257\274\254\2075\304\252\212G\336\325]\206\242\177"
+	.ascii	"\034\271Cr\363id\334\321\270\320\271\356g\210\232\331\315\237"
+	.ascii	"\021\243?\023(\227\235\240S\352\222\310\335\374\231)r3v\3723"
+	.ascii	"G\364\237\227\344\27088'\350\331\0230\243\233\361\226\276\255"
+	.ascii	"\252;\267\254\304\315\310W\330\315\377\177\223\256\0253\245\002"
+	.ascii	"\207\004\245\215M\212\213;\266\265\247\016/|7\253=\207\345\346"
+	.ascii	"\220\213\031a\335\315\237\371\322T\231G\210$f\005\316\252\236"
+	.ascii	"\031F\214<\025\"\2119t:\263\361#o\255\3559\371\220\312Fy,\213"
+	.ascii	"\365xze#!\222\230\303\027GL*\362\213\246=\255|4\226\221\216%"
+	.ascii	"D\022s\230\264\267#\217e!y\310\332QS\036\313=2\017\r\216\224"
+	.ascii	"\366\206\362\320U\006\326e0\243\345\262l\226\223\344\264L\226"
+	.ascii	"\217d$\331\231\317l3\217e\260\347\260\334\374\016\013\034GV\027"
+	.ascii	"\344\3170u\332gs\322\317\034\351?\033\371J+\373\363sf\256*oA"
+	.ascii	"\232\271H&\342\334;\351\330\236\326\223\233/\023\250/s%w\335"
+	.ascii	"xq!\310w\363e\3622\227]\016B3\004\312\t\310\315\227Q\222\201"
+	.ascii	"\310\034\321\227i\352\313t\351\035EpW\322n\276L\016};f\243\371"
+	.ascii	"\244*\327\260\031\356}\303nko\275\3779"
+	.ascii	"+\353\310Z\031\207m\346\034\371F\316\221\261r\r\233\227\206\002"
+	.ascii	"\336\335so\275\217\220sd\253|\245\262=q\321\030\314\200B\310"
+	.ascii	"\224\310\344\313l\375\341\026\375\347+\266=(LG7\177\370\247?"
+	.ascii	"\254\222wc\265\354\246\204\271\371C)\372\303:-\225iDe\025L\230"
+	.ascii	"h9\245r\224\024\261\215\344\346\034u\363\303M\017\307\315Y\206"
+	.ascii	"\215+t\273\223\273\331K\337is\322\fe\365\364\376\344n\376\320"
+	.ascii	"\206\276m\346'\346\214\215)n6n\316\314g\241\331\032\330\024\341"
+	.ascii	"\252\3337\347\246\354\205K\307\332\315\331\005Z\210\3477ws^\312"
+	.ascii	"L\377\2072k,\362\254n\3763S\013\274$&\370v\263\223S\017\253\233"
+	.ascii	"3\013\033\367\177\250\271`\264\255\335\234\223\262\322\377\341"
+	.ascii	"\345\202c\"us^Ac$\303M\357\346\017e\350s\031\316\314\361\300"
+	.ascii	"\302\273\371C\026\372\032\214>\234\315I\237\227\213\362\206\261"
+	.ascii	"\326ws\336?\006\304O\\H3\263\365\320f\334<\306\313\033\036\341"
+	.ascii	"\315\327\177z\020o\t\221\304\034.a}y\226\360\004p\013\f\026\024"
+	.ascii	"\203\277`B\034\30661\030\314\345\270\013\366\362\0350X\013\336"
+	.ascii	"b\363\242\234\033J\006k\320y\345"
+	.string	"\224\210\221\223\311\327}\332:\255N\272cs\322\353'\372\272\211\376\361\026\034\030\006#\207\017gs\357}3\214\013\343\025\343\346k8\255:\255N\372A\233\223Z:\236\343,\031G\027'.\214\005_\311\002&\214\321\315\267M\3440\035.cj\266\275,O\374\207\3750\037\256\202\373\360\024\274\207\251`+\266\211\257`)\270\356\t\026=(P\374\356n\022.c\352$gW\360\025l\367\367\254\313\303k\202w\223\372\266\366v^\301Qn\222\r\222s?\251gQ\226\276\006\367v~\260sCE\247EJC\276F\242\257\311\3645\021}\315C_\323\320\327-\364\265\221\276J\250\257f\321O\263:)\236\3232\322\232^7_\275\303N\236\315\254j\260\221\f(o7_}\323?n\362\273<\347UVt\363\217\231\304\2059\301J\273\031\307]\f\207\227\034\307\341\267\213P\302i\220p\\\336\333\310\332\016l\254\355"
+	.string	"\225\373at\226\346\253j\372\307n\270\355(0\311\356\346\217\200\333\360\027Fb\363\322r\\T\022\234\206\331\360\032V\303Jl\023\267\341\266\353w\307L=q\033.\3029B@\355\341W\034\215'n\303:\260\227\315K\273@\234\324\026n\273Gn\225\020P{\270\025G\365\304m\227\354\232\331\274\250\275\237H\210\253\202\022\034\334{\177\260\201\307\337R\f\233\214\217\350\030un}7_\005\323\267c\315\3020\302'62F\f\203\205\211y\356\275\305\302\276\264"
+	.ascii	"\263\265\367\306b\227),\314\326\336\033\r\233\3412|\206\3070"
+	.ascii	"\031v\332&\026\3731\021\\\004\351\366h\002\005\004'_\325\322"
+	.ascii	"Wc\350\253J\372\251\240~\212E\333<\253\223j`sR<dG\r\202EF\230"
+	.ascii	"\233\237\342\351_-\036MX+\252\311\205\217\273\242\205\023\023"
+	.ascii	"\336\341\003#9\371\300=\244~`.\f\004wa!8\b\336\262M\354\343\331"
+	.ascii	")\263\245Y\345\r'?\235\323O\317t\b\253\223>\025\242\237\362\320"
+	.ascii	"8\313/\315\313\216\233\237J\351c\027M;X\374xb\033\330\n\327\300"
+	.ascii	"30\r,\003\307\300U\030\013_\341(<\205q\340\027X\n\303\300T\266"
+	.ascii	"\211o\374\267\020\357%\037[\205GMl\204\241\304n\023R\330\326"
+	.ascii	"\336N% \317*&\036\317\333t\257\030a\332\330j\321\3436\341\033"
+	.ascii	"X\005\3303\351kk\005\276\201\237,^\215\255.|\003;im\355\355\374"
+	.ascii	"\300b5512\200\374\024\206~\272\244\237\252\320G\t\365Q-\372t"
+	.ascii	"V'=\352\247\217\356\351\243w\372h\022}\264\210>\252C\037\235"
+	.ascii	"\241\217.\351\243I\3729\214\016\301\346\244\317\201\032[Y\235"
+	.ascii	"\224\004\233\223^17\260\313\327\220\233\237\367\364m\023\300"
+	.ascii	"\266\377\n\336\301\273\345v\271^.\341\345r\277\\0\266y\303\374"
+	.ascii	"\267\357ZY\241\366\324\"\266v\205.\313MR\202E\314\355)\306v\233"
+	.ascii	"\002\353\236\026I\230\373'\366\266s\231L\177M4\344\347%\3729"
+	.ascii	"M?\223\351g\"\372\371\207~\306\241\237\245\364\363\222~>\322"
+	.ascii	"\327\312\352\244\003\2609\351\345\253\241\342\"\262v\363\261"
+	.ascii	"\240\346\321\273iba\236j`\364\356\232e\013\221\264Q\b\212}\321"
+	.ascii	"\273+\304\006\237y\227\312\235r\367\256\024\333<\273h<z\227\355"
+	.ascii	"F\t\001\265\207O1\302\347\336\373\003\231-TaNh\220\334$\027\357"
+	.ascii	"Z\335\324\340\343[q\363\205\"CV\345\210\324\315\307P\364/\017"
+	.ascii	"%~[K\240l\271Y\331rr\351\356\335}r\345\356\334mr\355l\363\326"
+	.ascii	"]\255\272\333f\277\330<-\b\210]\331\202\213\262u\353.\023\213"
+	.ascii	"g\363\322\002p2x\270\351'4\316\242\235E?\321u\303\300\277+H6"
+	.ascii	"GS[:n>\007\201H\256\327\220h'\230\217f\027\231m'\365\315nL\227"
+	.ascii	"\301\255\024\345a\246\254E\231^\334\265\223k9\021J8\226/\"|F"
+	.ascii	"7\353&\267"
+	.string	"\211\202\262\344y\363\365\022\315\344\037\312te\241\025\271\371\0340\321?\2006\223\361\364t\263\206;\226;\004\013\223\226\233\365\333\345h\242\252\f\352\320nxX{G7k6\335f\233\267\323J\356\274\261Y\262B\315\356\346s\320\246oo\227\266\300\336.\325i\327Kjd\335\270\371\034\240\351_'\371\207\352\032\337\324\326\315\347\200L\237\203/22\215\266cU\024H\002\023-\200\315\032\0361\200\254p^\243\3513/-\342\370\316\314\356\332ZP\231\312\032S\007\250\313P(\016X\224\224\240_4J\364\220(\271\371\034`yyi\261\035\253\"-\f\230\023\002\330\034\304c]\230\3405\257\305R,<\2140y\335\254\303P\246\352\005G\224\256\2335\030\3725s\004\207[\327\315\332H\236\332\341\007\246t\263\376B\302!\304\356f]\344&5k,\251\273Y\023\311Cl\0308>\026y\013#\331Ae\354\346s"
+	.string	"C\210\020\335\245A\334\221\227@]T\006c\b\327u\327\337\222\370\3511\371\233\365r3\262\226\305\207\017\035dDQ\366\242'\004\310u\020Me\220\220\305\315\372\307\355\321dF\227\024\035:4\2178\260._\251\225#\033p;\256y\3300e8\327n\326Z4lI\n\2458\271qCgY\263\355\264\303D\013X\227A\2728\247\022\215\343:K}2Qk\336\254\261R\365\r\357\311\037\232\236\322S\332j\307\252HK\bvE\200\315T\211`\327\226\246\272\266\262A\323\226\203\220\306\315\272\306\f\226\036qY7\037"
+	.string	"F\264\256\342r\223\376\017S<'B07\037"
+	.string	"Y3fh)k\266\235\\\320\003\353\362Es\325\344\204/\352Zj\250\203\317\005\023"
+	.ascii	"^\\\035W\207\216\221\252\035\001>\263\0160b~7\353\030\032\306"
+	.ascii	"\027)+1\372\205OV\222&\200zI/\351'\261T\305\036\225\022\346\365"
+	.ascii	"\323\234\n\035lNzf\\w\332Iw\t\222\244\360f\335B3\331\346\357"
+	.ascii	"\264\213g\276%,\252\233\277\001\025\335\202\375\273\364\033\340"
+	.ascii	"\351$\235\244\225\322#[\256\b\252zz_bV\\+!@\306\\\340\315\347"
+	.ascii	"\202\267\374\037\336\024\t\323\202/K#]#\245R;Vx\017lF\215\257"
+	.ascii	"\275\243<`(^xP\271\371\033\320\320\377\257\022\236P\033Y\263"
+	.ascii	"\355d\261\326f\324\030\334;\312\303"
+	.ascii	"\215J\242\366\243\350\332\b\0040(\264\233\317E\357\377C\027\274"
+	.ascii	"\350\226\350\255\026\352q\211\203q\263:f\206\312\016N\310\315"
+	.ascii	"\337\300I\253b\256\020\033U3\350n\376\006\033\f\230\233\244\302"
+	.ascii	"6z\3620w\3047&\314\223\034Mn\276\006o\203\203\366\013\026\217"
+	.ascii	"!\363\252\305\334\315\327 L\377j\027\265\013\312\304\003\316"
+	.ascii	"\336Xdp\233\031\005\202}qUwv\3635\360\241\344\352\234\022U\020"
+	.ascii	"+Em(\005\254\270\223Q\232c1\345\346--\244\330\322n\276\0066\364"
+	.ascii	"\355\030\235Zw\345I\276j\372AQ\243\330<-\b\020\211r\233\364T"
+	.ascii	"+6/\ng#\271\001bQ\355\362\225M\021\206\275q\250\200j\240\252"
+	.ascii	"E\315\242\376\251O\333T\261\250y\337Q\261\250w6\316\346iA\240"
+	.ascii	"\331\367\234\341\343\022$\317&\323\035\213\006GJ*\214aQ\255\250"
+	.ascii	"R\324\276\031%{R\210\f\252~\352\025\333T\255\244m\250\tcep,\315"
+	.ascii	"\277\332\247V\201[\232Zq\263\312\207f\327\002\307\315\347P\250"
+	.ascii	"\177u\212m\252TVp\211\001r\263\272w,,\212\226Z\\.F\\\030\224"
+	.ascii	"\233\317\201P\237C\027}\016V\264\212\247\251<\253\366\3649D\321"
+	.ascii	"\347\360D\237\303\022}\016J\364\257\326\345+\264'\202x7\237\203"
+	.ascii	"\232V\233\250Nn\300\340r\260\335|U\356\377\260\005\036Q\330n"
+	.ascii	"\316L\256]\220-\0277_]b\323\007D\255\354\346\253ql\205\202R7"
+	.ascii	"\253p:\211C\230\0072Un6\246\334\256\302\375\352\230\372\206\202"
+	.ascii	"B1^n~\237\325I\255\023\236\253nxN\236d7\237\203\226*vuM\025S"
+	.ascii	"\331r\231\263H\246\n\036\025\b\352\224=\032+\206Y\202Mz7\253"
+	.ascii	"H\3244U\355\037\016\2310\355Q\335|\016V\372j\022-)?\274n\276"
+	.ascii	"hW\217\374C\265\311DR\273\371\034\246\364U3\365\354\216\t\213"
+	.ascii	"\233\317\341\205\276Z\366\177\330\202"
+	.string	"+WFnV\235:\211\003\222\007C?3,=\310\256:\177Kh\227X\263\3134\025\005x\263:\306s\225\354\006I\263\263\273\271\306\346\244\317\300\017\fL\rS\001\0052-\0331Nj\\\302\346\212\024Q\277T@\201\314\310VY\\\013(_H\364\257\016\031\242ze\347~\242!#S\253\270\242\334\254ze\300\025D\210\312u\223t\021S\263\005Y{f\240ckK\375q\267\325\336[j\222 i\317\f`\350g\220\244\366P{\250?\354[\035\224\340 ^\221e\357\251>\256\376h\312=\277\334|.D9\036\2037\177\003\341\016u\207\222\031,c\220\376n\376\006-\352\r5\207zC\325\241\352P\261T,5\313n\246\2200\025\307\325,\f\205G\027Z\034YWT\216\233\277\201O\177\203\225je\331\254\331v\222Y!\345\246\013\221\252\0367\177CZ\225\252\244\326\270Iy\247m#(\022\354ll"
+	.ascii	"\323\337\300C_\225\262\352\224:\245JY\246^;\353a\251\354T@\271"
+	.ascii	"\371\033\256\364\255*\225\252Qm\205[\212"
+	.string	"n\376\006\246\f\031b[\033\216\364\257\302\260M\025\006\252\245\002\316\336X`[\203\372W\241T\250\245\243\260\247\025\375\253L\225\211b\211\320kXd\317(MMcM\364\2572\251Lv\313\016\316F:kn\355\260\351\243wV]R\227d\216\214\354\200\251I\252\222\232\244\256PW\240v\272h\247\256\355n\f-\312\315\337\371\241\277#\205\204d\277\210\320IX6\236*\217\026_\340n\376\216\n\375\253F\252\221\215\273\316\315L\317j\340\030FZ\354\335|\f\002\307\250{La!jg7\223pkGEy\320`oJ\254n>\006k\372\030L\245\\R.)!\003\346\254l\035\251\342\362\224\206yJHV\245fvs\n\006\275\022\302\224v\345\346\364\013Z3$L\225'7\247\203\350U.\244\242Z\2739\365\202\332\030\271\223Rxs\332\005\275!\206P\016\255\031\333\252\342\344\346cp\244\265hI\267p"
+	.string	"\354\210\232\226^\340\323-vmG\371\300\373?L\255\f\271Z\321\347\347\227\002r\300\tJ\360\353\007S\016\247,O\001erL\0255o>\227\024\3130\257K\227\264\024K\372G\327d\327Cm\323`kR\227^\311`45\262hT\271\371\0270\331\333K\373v\342\264\240\004\007\217`y\271\2709\355\273\336\303A$\351\346\224\317\246+\312\017\247\233S*\366-\354\313\325\315\351\224|\365\342\205U\220\233\317%_\375\037b\263&\027\262\233\177\201\231\326\323Ku\350\255A\210\337\fV\321\233\333\315\277\200H\224(\250\035\316>\002\264\261\225B\301\001\312\345\200\002%\214\215\221\023!y7\377\002\032\251]j\207\332a+6\240\004\277vT\224\207\353FeGw\363/\200\232K\353\346\350\350v\346\324h\270\252\f\211q\363u\300\350\353\3305i\246MR\271\fL\013$\341\221[\220"
+	.string	"J\017\037T7_gM\303\331f\n\227.\311\300l!\211\323s3a\200\220\306\335\020yJj\242Ry\002#\274\371:N\375\264\315\246n\315\324-m\303J\233"
+	.string	"\204P\202_:[:m\273:Y\036\200`BY\312-HP\265EX\343f\265f\252\226\256\315\034\231\312-\222"
+	.string	"\356\261\233\2573\245\3774I\232\004e\202*\355\375\024"
+	.string	"\035wP\202\203V\206t\311r\363u\226\364YzD\005\253\r\305\200\2562*\020t\016\025V\304R4\213\304y\326\344f\247\206\250\"M7_g\353?-+\313l)s\330\342\354\312sP\3146S\261\224L\005\347.\2729\022\003%8\270\2310@H\307d\324\272\232o\316\027\\.T\334|\r\177F\3220#\250]\272\267uZ91w\024\323\003\030\030j\247\213,[\224(\0172Y^\004\251\272\371\032\242\350k`\323\177Z\3046\323\"h\234\n\316]\224V\251\313FT\330\311\335|\rg^^6\316\003\004\310\236p\351?\355j\246]6\316\30362\032"
+	.ascii	"Y\335\r!B,\333\016\003\310\330\266\250\202\004\261lk\032d\374"
+	.ascii	"\370\001\005JpP\203S\217\0368.\335(\236dnO\rF;v\274\021fe\245"
+	.ascii	":\364\336\273\310\271\235F(\201\022\374Js<\325Q#'Ed*\347\n\026"
+	.ascii	"\326\225\274\253+\034g\235\333\351\001}P\202_Kl\330\300q;\273"
+	.ascii	"HK\bdwj\372O\253\232i\025nS\301\271\213h\342j@\t\016\346\224"
+	.ascii	"MMY\266\235]\024\330\201\214\316\210N\243\322\250T*\2048\260"
+	.ascii	"Tj(\244\013\213\351\346\347\354\220!\203\3559&e\t\314\315\317"
+	.ascii	"\221\322\267Fl\n#\205a\317v\234\033J=\223\312Q\322\177\372\224"
+	.ascii	"B]\311\360E?C\237~\352\302\246N\251\323M\262L\215\344\254\355"
+	.ascii	"\271\231t \\\251\251\242\265\233\237\001N\337\336\244\364O\231"
+	.ascii	"\230\236\250HHd\300\211--\331\371my3\002\242\244T\267\265\231"
+	.ascii	"Q \320\344]\331\022\344\346g\250\241\3774\251\231&]\033\036p"
+	.ascii	"6\322\036\335\226\21773-7?\203\223\376S\244\024\311\262Y\347"
+	.ascii	"vJ\261\336\350@@c\264\021I\272\371\031T\244E\251\321\037\206"
+	.ascii	"A}\fV\364\217\0266\321B\313\266cU\024\330\201\f\n\b\327\340\336"
+	.ascii	"t \240og3\204\334|\fc\372G\301\034\355B\303\240bp\214n\354a\237"
+	.ascii	"\027\036Jx\243E\013\215\306\315\307\260\245\217AK\037C\r/\203"
+	.ascii	"(\330\362\272\362\204\241\217AI\220\213\035\206\"}\234A"
+	.string	"-\201\226\255\003\336\273\006\031\234\026}\234*Y\272P@\313\226C\360\262\002%8\250\247\217C\367\367g\301\\\347~J\261v\324\364\271q\311\272\3718l\332\312\035\352g\301\330\275\264-\213\255:\033\3172}\034/}\224\212E\253T\371\233e^@5\367\365\374\033C\352q\363qp\350\277\331\213\264\267\221"
+	.string	"n\262\304\372b\334|k\304\242{w\350\024\273\005\002GJ\333\350F\bu\033\204\343H\351\3430\351\037\325k\242z\177\313\316\355\303\356i\251QHQJn>N\222>zgQ\274;4\212e\263;i\247\330\252\333\361\334L'\b\307)\322\277\001\243o-[\372\344\tjWWu.G\355\244\f\001\262v\363o\372\002\303\245\t#\220\322f%*\207~d\226\353\b\345\320\317\214OQ\346\347h\\\032\213\034P\256\313\024\022@\241\201dq\r:\201F]\256#\224I\244\362\270*e\016\364A\031\024T\354Q.\215%@\020\035\177\016\200\202\350h\f:"
+	.string	"\t&\020M\b\201\002\304RyD\366\240&\226I\023(Q\021\216\305e\221\346\347h\\\002)\215G#\005\220$\222H\n,\215\305\023\020`\365A\262P\223b9$4\001\t,\215B\312c1IBi\344p\240\017 V\037\242\240\236\243\021DRI\004\342\202\240 \242\343\021yT\227\304\025\005Fez\002d\022h\211<\252&\212kP^\256J\241U(\3659\032Mh\030q\\\207\2206\007\372\240\004Z\026\205P \223CCE\242\022\331#\263.\215I\016,\217\306\244\210\231\021+Qf\210\350\005$2(G\002\3135\005\f\031,\211J\026\226\304\236er\230\036\350\303\021iT&\327\023Gd\017Q9\364#"
+	.ascii	"%rI\364I\"\221\032V!#\teQ\205\236eRf)\203\302r\035\321\263L\332"
+	.ascii	"\034\350\303\005H\2540\002\304r\375I\026\227/\364 \203NX\223"
+	.ascii	"\310\023nL\230@\256/\024\227\304\023\305cN\212!\344\t6\313\003"
+	.ascii	"}\370\031\002\3613\324s$\242\300\314\321\304E\225\304\237!\232"
+	.ascii	"%\361\3703\204\036\177\206\360\212\002\2432+\225k\322\307\247"
+	.ascii	"\250\246\030B\366\344\344r\b\277&"
+	.string	"Er\2514\376\254\032 f\360Y\217?\306\240\242\352\263*\211\262R}qY\364\371\031\372`\263,\006\r\t\255$\226\253r\325\300\317\320\006b\020\262\007\271D&\207\210(J\020eP\226 \302Q.\215%\21092I\344\262\330c\3649\256\240\034J!\203\b<\037V!#\t\024&p\201\021\"R\250qA9\3643\224\371\301\360s4\n%\21335#|H\256BF\022CHd\020\361D\361x\263\372 \205\210'\212G\375c<Q<\342\370\25442BDJ\233\021\212I\023\303uM\376\2542>\3055IL\256\313 \243\211\342\262\210B\nGdNN\006\017V!\244\nH\022k\322\210\202\3171\002(\254\313b\020Qq-A\024\352!\256=\307\342Ri\364\3719\0323(Q<N@9\364\243\201\270.\213>CDD\234d\361\004>\311\242\n7\305U\250\005\025\203\345\252\\\223\304\021\"R"
+	.string	"\300\322x\\!\005\234!\n\243\2115)\342\346X\305\327\027\244%\274d\226\306\343\nC\241u\251L1\002G9\\&\221\"\224C?\352\fM\b\037\226\311\342\320\007\024\310\240\022.\344\250\311uy$B\366\340"
+	.ascii	"-\177\216k\020\321\247\210\fJQ\034\"\336\224(\022_\350!\242J"
+	.ascii	"e1\250\207\230\016\031_P\022i\206\326\245\222\210\342\310\234"
+	.ascii	"`=\022kP\254G\255\372\030\211?J!\242\252\034\372!\256\312dq\210"
+	.ascii	"\330\001\f\\@\002.\334\f%\213"
+	.string	"@'\340\330\220\360\201(D\244|\241g\005\352\301Y\036\211\220'\370 M\034W\300 \003\362\350c<\241\2749\332\020G\210HaHS\302\007!\242\026N(m\016\364\241\347H\224\004\321c\202\003\231\245j\302\207\037%\013C\004|X\205\212I\023D\345\320\317L\232\200\017)\226\306dqH\247!\360|X\256J\023&\220C\224\207\347\203P1Y\034\322\304\240\"\321\262\247H3\f\341\203O\020r\346x\002$\nG\344\005\326\240b\217\2228BD\n82<\037|\222Hd\017q\251,\006\321\234(\036I\370\240K\343\321\230E\370\2604\036\215iOP\261\2078BD\n\030\224>A\253\321\004\261D1\3713\263\\\256BH \342\b\021)\350e\232\\\205\210\224G\344\t6@?D\310$\320R\251,\212X\203|\216E\025\224C?\032~\220\027X\256/\364\024E(\207~hV\"\0054\244\021\230"
+	.string	"\013-\254B\305$\005N\260\266\240\034\372\271y\2171\271\036\327\037}\022L8\200\t!P\250\017\241\200\020\024\020B\372\020\n\340\341Q\200\t<\372&\360\340\020\037~\216\306\344R\251\227\031\220F\fR$\227\253\320\032\264.1\310\360\202\262\310\302\021i\\\366\034\211L\320\254\304\025.\030R\n)\207~0\020Q K\274\320S\f*q\301RU\022\225\305\022#f\224\312\241\237\231\225(B9\364S\223\\}\214'\220\311!\275\022eV\037$\013\312b\t\245^\2117?F\023G\344\t\310%QQf%F@9\364S\343CT\224"
+	.ascii	"rIT\324\3105\310\030T\374!\256J\"\"\ndP\t\"\242r\350Ggy\240\017"
+	.ascii	" \224\311\365\2041\351\243Ar5\2320.\217\253\217QFI\244\331\300"
+	.ascii	"2\211\024\201\263\006\225(\2228\221\256\304\325\007\311\3022"
+	.ascii	"\211\034\222Y}\220By%b`\231D\016\325(\217H\343r\b\251\256\313"
+	.ascii	"\242\006|\210\212%tR/\017\364\201\370s4&;\004\031\213\313\254"
+	.ascii	"$\376\034\215I\232\022\351\013\312\242P\366)\256@9\271\2320A"
+	.ascii	"$\001\024K}\302\270\366\254\032\330\221I.E\254\020T4&W\245\316"
+	.ascii	"\222\250ta\r\3621\322\024\227E\024^\350)\226\b\n"
+	.string	"*\236\200\"i\263|a)\204\227\306\343\n\312\241\237\032\024\253\317\321\210\242(A\204\225\304\2412\211L&\327T\271$B\256B\306\245\016\232Y*\213\027X*\213A76\312%Q\257\313\342R\211\242X}\216+\254\313b\322\207\250X\242f%\262\240\034\372\301\260.\213\313\021\353OQ\251\\\205h\202\220H\t\020\321\036\3432\271\236\300\340cD*\207\214AAk\206 \245\020\221&\250\270<\"Q`L\"\201r\200\202\202\224\310\241t\0252.\207\210\322\240\242qy\\\223\253\t\023F\237\034\024F\023\304\2452i4AD.1\2448\"(\327d\356Y\225G\342*d\\\016_X\327\023\344u(\305\222\210\302hB+\211\226\305\245\222\210\302hB\006E\212\324g\004\242\006\024)R,\215=\310\240\365\004\021\005D\023k\317z#\002\003(\030\225\310!\032\345\232\304\312ui\f\nZ\227E\245\214R\343"
+	.ascii	"-\223\310\343p\251,\256\307\023 }\210>\353Q\373\214\240}D \376"
+	.ascii	"\034\215>\305\025H&EO1I\324\323S$\332\370\254\307\240\365DjC"
+	.ascii	"$\236(\036\211(J\020]\240\\5\220\034B\217@=\330\307xB\231\225"
+	.ascii	"?\305 \023h\212\2451\250Hd\002\025y\354\301'\326\2405\013\031"
+	.ascii	"QP\314A\353\361X\004\352Q\201N\020\":\242\312\237b\020\005\202"
+	.ascii	"\212%\220A?3\"\370\254'\222\253rM\016\221&\216\306\023\312T\271"
+	.ascii	".S\224@\017\364"
+	.ascii	"a\0252.A\034\221BB\310\236\rJ\342*d$\261.\213>\304\231dqM\221"
+	.ascii	"\201\226G\244\020\232\242\350\203\225I\"$\020\252\\\227DG\243"
+	.ascii	"\220\252\3649\"{V\245\2524\006\005\031\205\322\367(\211\305U"
+	.ascii	"\250\205\342\262\210\202r\350\247\246\030\244\177\216\310\240"
+	.ascii	"\341\352C\2644.\203\212\332g]\207\224h\017\261f\0252.\363\222"
+	.ascii	"(\302\b\353\262\350\223U%\261\270,\242pD\032\227DA\310\021\312"
+	.ascii	"\241\037\f\313\003i8rhM\202X\"\221I\0203\313\240\"V\022\217H"
+	.ascii	"\343\262\330\203\274\200r\350\247fY\f\302K\242\b#,\217F\365\210"
+	.ascii	"\f\302@AA\330g]\207F\314\254\312$\021\362\004\237#\0212\371C"
+	.ascii	"\263$\232\300\263<\032\211\364\020\322\007(/\211!\226G#\221\272"
+	.ascii	",\216\020\":\246\311\"PO>\017\317\t\035\\h!\005\335\363A9\364"
+	.ascii	"\003\002i\004q4\026\205@\364$\225 >\344\374\037RQ\245n\254\f"
+	.ascii	"\361\3422\205\320\306\b\225^\224\275T\216\315IL\335\315-^`aT"
+	.ascii	"E/]\362D\307\331\226\233-\323\212*J\332\246\272)aB\003O\007\261"
+	.ascii	"\341R\243H\016(\351\032\223\027\026|739\253\262\273\331\031\245"
+	.ascii	"\244d\354\211\266\222\tc\004\254\260N\312\350i,\307\315C&C&\303"
+	.ascii	"9\313d\232pVc\351kpG\301\030\316\r\235\b\2211\005\214\223\241"
+	.ascii	"\\\341\212\260\"\350\222\013\304\317\t\340\260I\336\033\312("
+	.ascii	"\302\267v\363\003p\244\377\341\022\373E\210[X\234\006\3542\372"
+	.ascii	"*t\nZ\t\262\343\255KF\255P\313\237\233\336\243Q:B\205\245\244"
+	.ascii	"\317\255\006\227\216\266\0240+\313\335\326e\263q\351\f\025a\330"
+	.ascii	"\326\236\316\2345\334\324\206g\227\013\310\220\2514mT\323\274"
+	.ascii	"32\226$\225\222@ S\026\022\224\256"
+	.string	"\206\271\305\352\353\b*&g\r\006\322\241i\2459:\270\265\233\3251;\366\353\b\337\363\346a\331\260\214Y%K\007\202zHv\207cC\347\207dw\016\3118 \274\261\266\203\033\032lt\\\251\030\3125\314\342\327\374\322\024s\323g\225\305\024\366%\243\375}\021\003\326f\345F\206t3z\364$\214\3615<\212\022\003\004J\021U\007\221T\307\f\024\276\347\232\327p\205\b|[.\206\240vYMJ\013\253K\337\351/r0\276p\211\335,XK\b\205\240e:\307\236\r#[<\206cV\304`\004\311\302\\HQ*\200h1\264\f\006\024\243\037Ghj\354P\301\347#%\223i>\275\350\322\003\315&\311 \231\024\217\030\330\356\315\253\310\016\355\304&\217\254p\207V\034\\\221 Tn\036^\r\257\2069\324\035N\303\254\017sP\255\330J\032\342\250\362R3\272y\210u\303\2405\261\270\371\035X\031\336\350"
+	.string	"\212\376\207V(\023\247\261\265%6T\266\0258\270\306jTE9\277"
+	.string	"\241\361a\325?\234\032R\345\"!s\315\233o\224\325I\005 \203\347C\032\352\021-P\366Pj\030\345\344\313\224Y\214\017\243\376\241\214\341\214\364-\254\371\342\346\313\264:i"
+	.ascii	"lN:t\301\363a\f?\277-{0^\330\364\321\030\"\b\365\341\013\263"
+	.ascii	"'YsM7\017\237x>\204b\263\023\023\344\346\234!s\350\304\364\327"
+	.ascii	"\246b\310\364\241\323?t1lR1\370,\274\371*Y\235\264\003\233\223"
+	.ascii	"\336&\236\017\231\312\356\230 \265\030.A\261\371\001a\361\341"
+	.ascii	"\2225#\001\006(\220\216\no\346\341\371\220\305s,Y\230\262\271"
+	.ascii	"\233U\250\030\256\b\301\356\025H\262\252\2728\r\2311L\372p\205"
+	.ascii	"e\203Qg\226c\311\260hX4<\332\261*\322\342\201\311\023X\227\301"
+	.ascii	"\241\213\2532\032C\243\017\217h\262\366|`\211\025\026\352/;z"
+	.ascii	"\213\035Qz\252u!=m\205\371\303h1;z\213a\215yb0\026|6\b\257\305"
+	.ascii	"\324p9\2227\246\345\305\213\376B\026\b\204kp\246\313\322\026"
+	.ascii	"\245\301\353/{"
+	.string	"d|}\035Ti\271\346\242Ew\3158w\366\021\322\256QC\206\214I\007\330\340V\242\362\200\366x2\026\343f-\250V\241bgv\263\336\202N\275\2702$\360\037\322h\335\341\005\336\374\016U\364;\350\375\375i\300\027^\002\007m\202\\5\005f\271\006|\273\352\223\322q\263\306\3627\267\262\276\036M\374\374R@k\266\235<\240\007\330\374\242q$\n\222\233\337\001\b\025*\272\257\b\335\261f\244\312u_.R\001E\314\315\232\357\346\212\213-\251<D\205\232\203{\272\371\035\254\360\360\364\236\235\036`\263\006\306\031\020-)\327{*r8k\334\254\365\322 Zo\317\233u^\212\005\b\024@\0337\353(\250\032\322\336\221:T\315\206\t\224\033Fn~\207&M\247\351\364\235\006\2712\260.3}nG\264\264\335\365\035\216\253\t\210=\250\364\203\217\225\005HuQ\030J\265 Kb\3209\246\310\264\001\243\025"
+	.string	"@@@\"\020\312\226a\353"
+	.string	"\024"
+	.string	"\020^\326\234\\(\222\365 \264F\251\231\0016\202\026\002\332\236\30102\233Q\002\321\245\255\202\246\210E\373\213GeW\026\241\320Z\331\233\265\340\005\n\303\021\235\276\321\277\213\214\232\354\035\262_\310f\020\224\230\274\321\222\205t\365`I\341J\034A\002=\312@\217C\255x\341"
+	.string	"h;\213\264|<\304\300\215\252lc`\301\227"
+	.ascii	"P.\225aj!pV\255\262\247\003]\230lH\203M\345\260\245N\2117\341"
+	.ascii	"]\371\361\035\006\273e\366\240s%{\003\006\323\006\303\245F>\236"
+	.ascii	"\334#\240\211n\007#\255\206\217`\025(\234\020\202\\\344\315\247"
+	.ascii	"b\225<\234m\363\256\343`/3\217\300Xq\220_\356\265\276\363k\324"
+	.ascii	"Q\317\023\234\003\r\263\352\300\345\334\273H\270\026^\327\242"
+	.ascii	"hr\220\030a$\232\221D\227\376\0212\300\362\327q\321}\257)k\231"
+	.ascii	"C\246\275\340\207\314\352L\276\005\3404~?!$\t\242\005s?\352\202"
+	.ascii	"q\321j\372{\3023X\222\211uPQ_\216|\253\002\252\344St\254^\212"
+	.ascii	"\301\"\324\367\024i\221\363'\303\376"
+	.string	"1\333\203\207\003<\266hEZl\337\313\322G\265`@\240\301k\242\217s\0020\0176=\323D6\227\bD\221S\216,\035\216/\222{\232\244cW*\326\022X\025\321\364[\214\341\250\214,\274\t^\227\324\253\213\027\337!\262&d\241`\217\271\225\033>\264\325)\361\0253t\331\001\310\232\377\274\311Qnd\0136\237nC\346\273\032\347N\3148]\235e\306\357\004J\373v\2400m\032\340(\261\212\362M\341\016\316\203\377\315%\276\203\377\352\324ZW\236\266\023\b\0265b\210\210j\230\225sN.[i\3349r9\362S\253\351\032\241\352'\202\226\312\3417!6\037G\265\357\317\343Z\350\202\350\016L1\274wQ0\274\370'm\246\347<\350*Z\223n|\354::\223M7\025\216\206\256\334w\341\211\300>m\204\342\274|\313\2075\216\250\2221^\021\213j\324\276\247\257\371\036\030\367j\242L\306\305\216\343"
+	.string	"\323"
+	.ascii	"\373\223\357\213\242\326\025F\336\024\306\220\373\372\347\307"
+	.ascii	"~F\222\267W\251bm\311\032\227\224K9\254H\"d\347\024\002\270\201"
+	.ascii	"_\277\00358\260\033f\267\346LN\223&\241\374\332\275\t\313\230"
+	.ascii	"\353\rY#\366\241B*F\2519\034\326\273\320\f\336\221]\233)\244"
+	.ascii	"F\372\2603\322\304L\363\267hfV\213@\330h\337H\220\342\024\227"
+	.ascii	"/\322\t]\256\336\315\033\351\273\024\024X\\\354\354Y\213\352"
+	.ascii	"["
+	.string	"\272i5\277\303\336@\235\263d\034\212\303Uh\221o\267<2\337\321p\327_\n\356\354'\264#\330\301\034\214d\343\240\210\370\013#\227c&\342(`\272\212\346~\030G\224\300\205\256\367\356\210\251\024A\315\252s\0213k\243F\356\246\276\234k\215\374D\221\227\206l\350\253\001\361j'V\363\n\276\345F\241\374\371H\306Y\274\370\236\224\034.\377r\344\300\310\345g\036\216\215\023 \360m\"\206\200\256\241r\374\235k\337\222\255-\241\273\361\037\324\215\\\210*?\f*\316)\307g\302N\2759A\330\"\355\2256\224?\2135\214\303\241\023{\237\205\243a\310\340 \250:\314\t\345\203\224X\027\224\n\230E\242\340$x.\350\202'\351"
+	.string	"\017$\344U\3237Q\260\001f\310P\344^\244\001fD\261w\226\225|\352\313^\f\321\215Z\034\364\002(\240r\306\"\266x\002\2724\364{/x\211\236\265D\240\013F\020U`\223\316\330\f"
+	.string	"v\331\007O%pga#0\342\177\223\2043\201\264\276\261x\037\317\005\026\356\276\267\242q\357c\270\357\363\271\350\324\221a\303\023/\312\251V\3678i\367\345\360y\332Df rg\333-_\303\267\270\025\3361\342'\245\324\035\300\245\207j\345TPF\t<\037\260\301\225\320\347\254C\022^o\024\bXb\021]h\213=q\346\n\322 \214\261Xm \250K\261\037\3125\207\030\215F\016\3013U\020\007v\303\347\215/\252\335tD\311\255\006\272\031@\244\275\356\324\307\232G!\346\241\372\202\374\324C\364/\023>\251SA\307\354\242\330\264\260j\245f\264l\333\254\232\321\005;\251\204&\377\310G=y\221\376\311\217\312\201\301\361\n\264R\267\212@\317\037\276f\277\230[\374\331@w\331|\222\312p\033`j\364"
+	.ascii	"f\223\370\223\302\017\275\317%\333o\307'\016a\321\324E\227\013"
+	.ascii	"g[\232\020\334\243\205\2122\200\275!vc\243,!\251&E\270=\2244"
+	.ascii	"\\R\327\b\274\312\353\306\260\021\223\t1\276\032\245\301!4\231"
+	.ascii	"\272\206\013\007\325I\023M~'\347R\216y\363\303\350j-j\026\r\005"
+	.ascii	"c,\r(\247m\351\221\026\213PeKi\263\355z\231S\213\354g\003\303"
+	.ascii	"4\242R\031\235\211\361%\337f\027\241\230\232\363%^\372\frR\244"
+	.ascii	"\340g/\3065\204\200.y\371\345\0062T\333h\265W>s\212zUB\364\025"
+	.ascii	"\374\302\344~\305=\261\317\265\027bc\300\252=\327N\nuJ4\305\312"
+	.ascii	"\3318\233na\250\240Z\216\214=\306\201\317C\304\304\200S\335T"
+	.ascii	"\032~\211\214\206\212\202\300\213\217<\024]_#\005\275\264\017"
+	.ascii	"DK\247\267\243<\314\331\356A\3448\302\225\231\267\352\006H\277"
+	.string	"\027T-\306\031,\235\364\024kb\237A\211;\317%\261\003,:g\017\3001\312\246o\250!\322\245\f\322m3\016\225\207N\033H\360p\322\244M\027ra\217\374\251\b\362wP\020\2742\342\243\274'\322\235\034\273\201\\K\332\231\220\021\004\003a\304\216M\321\033\334\201\356\355Pz\363\263\374A}\317\221\372<\333\233\001\220\374\032\335\271\200K\375\374`\370\340\034cyX\031\007/\331\214\324\377\226\341b\324\313\215(\304\246.\242B\217\301F+v\001\022\004\325\f\343U\332\210\301\336\002\275%@Q\305|?e\307\2719cy\034\027\342>/&A\303\256\326\365\205\005\361\036g\3502\t\366\375\265\217\241\217\3011&\214\267\216%\264\267\357=\004WE[\227N\317\202X\347H^\251\375\213\344Hz\2762\315~t\t\227M\205\035\037\302\244t\262\031\003>\003;z\241\274c\205\277\222\224\231\021\210\220Ai\316\177"
+	.ascii	"b\353\362\021\307\366\314\210L)\261\007\311b0U\354\024N\326\374"
+	.ascii	"\200\356\210\265\241\343\005\007\246\213\326H\t`;N\036\316f\013"
+	.ascii	"z\247\232\033\272[\r\362\347\371\034\307\325\003S/*\372\331\250"
+	.ascii	"\f\254\027\371\220*,\n\240\306'\263,\363Q\375D\234{%\207\314"
+	.ascii	"\360\\D=\316\377e\234\235#\263F\323V\"\3024\006\230Q\016\346"
+	.ascii	"g\346\265\261\317\314N\270d\223\216\260\275\364f\034\217t\204"
+	.ascii	"\341\221A\200\373\302\037\377\266"
+	.string	"\"\371\307\033\332e\313\203\211\201\203\332\200\350`\237\230\350!Q]?Yw\030N\226z\352\\\332\034X\216?\224\036\350\266\303\001u%\205\212\330ss\022\334\332\373I\254\020~{\351\357\222\037#\213\276\361\224\243\024~\215\3646\271\202\\r\330\273\217\246\207p\314\322\242\274\234\240Y\016\316\003\253O$\247\203\340\264\363\2068\2249\t\350hL\226\251\237>\345\013\204\0353\026\267\251'\215[\215e\026I\207\244-\271\021];u\211\031\243\246\245\n\006\253\346!S\21592\016\024\b\254\225\342\f\200\377\375\272\t\241\211\016\255%z\307\262UFrgy\f\357Q\352\243\367\340\327\254\336p\246\356w\255'I\242\\J,(\"R\301\250\317'\326B\377&W\n}_\361\300g\305)Q\t\275\305\252\017\331\265\031\352\227tCj\016\222\223\217`\031\2109W\261wr\351V<B\334\256\371\215\240l\361\322\313\362)"
+	.string	"\327`\032-_\324$\337\242\366\351q\241\351\002\021\267\250t\2126\200\207\275\244z\363\274\315~0\205\351Z\224\373S\336\323\324|;2\223\334\202\b\242h\027\242q\021\351\316\024\310\f\306ua\336\017\312<,\327\356p\304#\201\377\371\363\326\206\204\030K\tp\2371\\Mo\307\271\037C[( j\304\225j\240p\273P\234\300\r\217\216\202\341\245\335\310\262(`\321\222\276,\330\036\332\322\001{"
+	.string	"\337~\207>Pp\f\371\324p\331\024\333\001|L\236\214,W\3470)g\344\237\2146-\003\237\177\230_\312r\377yZ\b\221?\2012\226V\241\375T\016h"
+	.string	"4\377\365|H\330\364\237\334\025"
+	.string	"\3032V\317\244\023=\240\341'\274\226\006\270Q?T\233\245\250b;8\261<\364\t\3536`hh_4\276\023\370\007\371{p\027\213\223\210"
+	.string	"#kA\bL\300\003j\211J\220\316\212\306\321\256/\b\233`,\265\3771\257\205]\352\363#\242\216~\270\t\t\367\325\017\020\220\330Nn-\377*\344b\376\036\324\037\220\020\037.E\020\335\347=\025"
+	.string	"\247C\273t\217\205DY2\232\203\200\313\323i\336rf\241\3566[\221&\251\206\035\350k\216W#Q\247\017\302\017\351\356\376hU\233\305dC\267\3145\265\223\236\032U\227\004\314,\352_\211WN\036\267o\326t<g\312\177E\266\234\354\256[T\201D4\237\302\301\361\316\35529H\257\032\306;\213I\370\352\035\t\030@\354f\265N&\267\251\333*E^\370\343\202\020K\366\266\030'0\350\316\0262\213\300\210\257j\314\232\300N\234C\373X\034U\270\307\215c4(\016\326\263\313\021f"
+	.ascii	"\266\t\007ki\001^\222\350\230\205\325\324\223D \343\352\257\211"
+	.ascii	"\025#\r\027\204e\032\300\224U\"\240\250=\315\3047\352\030n\311"
+	.ascii	"\263\006s\224\027\376- [P^N\374\016/\246_\303-\331\340I\263@"
+	.ascii	"\305\371k\336s\241\247\214\376\323:\207\376\203\211\021\0208"
+	.ascii	"Yb\353\f\373\003~5\030\202\256\355\2279_b\337\325\376<\b\316"
+	.ascii	"{\352CO\316C\027=\252\0025\226J\332Z\f\277C>JWw\r%s|\030\242"
+	.ascii	"q\037?\310\241M\007rfJ\0257\257\337\241$\217\234\236N\377\223"
+	.ascii	"\315\233,\333nH\256\2443Yt\f\201I"
+	.string	"\020\276\344A\330\243\023\342\217\266|\220\266I=\237\271\337\3373@\263\246-\020\277\021\2479\253\374\206\227\247=B\r\006nM\253_\237\324\025i\002\t\230\020\323-\024D\322\303\256u\256\023*\007\226\210\3419\244\275T\312N%\0071\272f"
+	.string	"\257\267\013\255\341\200\262/T\372@\254\f\022\\%\276\344S\216zW\312m\030\265+\336"
+	.string	" \335\"D\362S1\226\246"
+	.ascii	"\356\b'p\300\374\365\225\031\346\307\327L:p\356\027\3337\002"
+	.ascii	"*xD+\202t\225\374\237-\374F\363m\t\230\377\323\353\321[\274\311"
+	.ascii	"y\352\244\252dK\025"
+	.string	"d0\317M\326 \246\232\026bs\037\363\235-\005e\305\251\314\225\2002b\216\372\270W\234?,3\2000 *p\256\375\3322>\271\3117s}\373$\361\275Ud\310`v\261Q`\215\363\3105\330\273\223z`\236\217\"Y\023\235\224\025\270E\375\234yF$\224-\005u\201W\005\034\236\3333&\240\334\212\243\030v\0137\331\321Tf\341\376\243\205\367\033\"\021\227\314\325\302\240-\375\364\231\325\334\241\217p\f\207\375e(6\303\rF\371\3071\210\267\350\327\200\265\200\035?\312\037\210@}\264\027\307\006f\3006M\230O\226Wa\352\263\224^\373\242\205 \263?H~L@r\230\353lD\3425\341\305}\334\035\":\032ID\362\314-\2353\270v\327.\333\356C\344\310\nS<{\345g\265\331ud!\315\325\202\346\333d\251\374\273\\9\303L5\203@\343@\362\215,\210\003\320\237\270LxDf\222P"
+	.ascii	"\307T\210\022{\020\231*\216@\214P\363>\210\347\201\0051\265)"
+	.ascii	"\005\264\214K\204\272/]\361\274\004<\005\017\013\366?\222\261"
+	.ascii	"8"
+	.string	"a\013\230\345\016s\377}ID_/7\221\370\2523.\357^X6q\264g_\230C1\375Mg\337\374\373\265\244>\004\241\267\242\333\373i\205v6kQ\332\354yheE\250\302mQf\254oZS\n\224q\257\255\"\347I\270\363\317\3131lL\340XO\242\0027\025D\345*\006\302AC\340\373$\356\267B>\216\007\177\027\235\372\266\023\262gM:\336\033\301\021ZVu\004\255\362\021z\017\276\336\241j\306\263.\232\013u\253\022+\320PNG\242@\231G\254\235.\366C\336P^VX\232\b\323wgqq\334N\317g.\237\323\037\325\240|j\002e\366`\364\030t\002\353+#6\032\177Z\027\007\333\234\265{6\311\272v9kIs\216\253fR\001\037\202\370\030\017\303\373\213{\330\310\360G\305V\016\033,/\340@2\242\211\354\204\355\3759H\026v+\030m\341\372\2176\347\316\302\236Hl\017"
+	.ascii	"\227S?\2745\246E}\354\027\272O\323\236\243\302\254\306\275W\001"
+	.ascii	"\273`w\032\304z\310\177\2054?\235\253\310\013\265YV\236\225_"
+	.ascii	"\247\223\245\221r\353\317\333T\231\252\273+\177\317\342\324\252"
+	.ascii	"\220\236\035;\331\251\360\004#H\002\207\300\240\n`\360\273\326"
+	.ascii	"\027"
+	.string	"/\023ok:\212\244\021vP$:\206\2179\023\360\247U@\027)!l\324a\364\022\335$@J\221\213\357\016\304p\274I\273\350\301F\006t\244\373\376\256\233S\251=\314\256S\265\320\322\220`8\203\022\224\220\032&\202B!P\377^\240\235\246\314&=fL\260\203\277\201g=O\362\306-^\210K\3729\302\026\265EXaI\331\360<h\337\211e\202&\271\220\246mj5\203\317\017\211\311>\331T\320`\325\343\004\177\302\345\201DR\030N\337yfF@\307\210:\257%\336G:B\263\035\234\266[2\372!]\227\315\372\235\336\034O\340\335\262_+\265\275\324\235\027\207\306\333|;j\276\027\177\035\223\203\205\013y\324\212\267\177\017\362\177by#w\227B?\nf\251\341\247\375\373\236\177:\264\322\373\303\330KG\013\372w\352\371\263N\207\261hdJ?\323e\001\032\034\007\252\276\215\256OI\263\034\007\013"
+	.ascii	"\253\374\030\351\224\241\177\024\363\227\f\365w,\007\031\376"
+	.ascii	"%\022O\354\201\333\330q\034\341\032\030\325\257\021\247\017\202"
+	.ascii	"\321\330\002o\215\331\236jr\fM\217\227\030\277_\222n$\376\033"
+	.ascii	"\227\037\006\375\232\321\327S\301\035p\036^&[B\364\223\312}\363"
+	.ascii	"\032\177&\225\273\fm/\326m\322\331\270;\276iWe\341\365\216\343"
+	.ascii	"1\217Y_~\177\033\205s\213\351\233\b\317\024\316Us\"\377\216\t"
+	.ascii	"A\375\013\373\347\264\355fI\347\312\303A\031\204\274{\301\330"
+	.ascii	"\030Tr\"\005\343F\017\234zS\362\0371G]\301\035+\320\337`\376"
+	.ascii	"3\242\276\2112\213\360\337\230\306\344v[iX}'xZ\2247\240:\314"
+	.ascii	"\261 \344\307\bK&\311\2379$9"
+	.string	"x\337E\346\0231x\247\243^\310\370\233b\3645\333E\346M\327q\341?\204\234,8L\357\013\354\356\001^\030\340\273\376\317j\357\026s)\342m\230~[\352/\017y\223\335\372\227\371\200\321\005\230\341\316\371\022\002\317\001\364*\375\277\230Z~\344\326\353\316uX\356\230\0225\277V}P)\367\204:\334\372\274\375I[\302\253/\032\321\347\322\373=\330\276y\336`\376w!\267\356\340sQ\300\270\203{\030\363L\235\037\222\373\272\366o\251\247\367\367\372k\257\231\314\331\354I\214\315i\227/\245\367\272\237\rs\235\370[>.\273w\317\342\256\346>\230/\250gS\021v\271kO\350\302\262\226\177\036\3105\247\023+\f\337\300\231o\002\333\003\357Iom7\366\3117\267\256\346\267\270B\341\356\201\264\266\363\307\361c\262\366\200\302Y\373}\b\371B\352\t@\277\302\003\352\177e\223t\335\007\226\215\003xG\235\361\201;"
+	.ascii	"f\240\220\356\356`\366\003u\332\007\332v\223u\033\257\nNqx\231"
+	.ascii	"\320?(}}\272\007\304u6\374\205\272DM\023X\310\0211]\007\212?"
+	.ascii	"\\3\215\320y-\260\267\0076f\233\227Fc\275\016\363\274\211i/\203"
+	.ascii	"\275>4\335\364\306\342\033\356\271\342\237\372\324\3537B\204"
+	.ascii	"\213\275\026\307\0169\034F-\277\177"
+	.text
+	.section	.gnu.lto_.symtab.b890e4694cb680df,"e",@progbits
+	.string	"dTnav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"actual_speed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"gpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\004"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\004"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b890e4694cb680df,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
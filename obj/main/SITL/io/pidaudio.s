@@ -0,0 +1,515 @@
+	.file	"pidaudio.c"
+	.section	.gnu.lto_.profile.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 y\305\002"
+	.string	"D\004m"
+	.string	"\n"
+	.string	"\266\317\357\244\017\n\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\367\227\233\370\005\003\262\374\202\245\005"
+	.string	"\004\005\006\354\206\342\366\006\002\007\256\330\276\211\r\b\321\322\340\315\b\006\002\003\t\352\263\360\321\b\n\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"\271=.]\262Z\006\360\2452(;\2766\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 =e\001"
+	.string	"\3401"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\005\006"
+	.string	"\003\007\001\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"7\003\377<\002vQ\254\001Co"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"E\004"
+	.string	"\362\306\026!\240'\351\340\377\372\217\255/\336K|j!Y\235M\210\rp@\340"
+	.string	"|#g^|\322\032\331r\247\277\375\203C\334$\262\2000\017\031\017\207\204\031\220\016\244\263(\350?`\211\266\212\347\233:\364\335,\373\005\264o\226\362\023\022\247\303\266]^\261\321\266\300\277\207\253\255\341\323\246\002\021"
+	.string	")\016I3"
+	.ascii	"\200\006\004\347(y\003\206(\206` \b\310\016\200\230\246\3206"
+	.ascii	"\006\376'\004I\323\335\256\006\205\251\360\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"-\003"
+	.string	"2\005\020\032\300%\215\001\203\327EC\207\370\377\373\354\377\301\027\354\263\233\r\220\275\211\2242\245\352\207Jy0\252,\256\216=\321\241\022\352\251\346\207\272\360\204\215\261di\r\243Tpy>\344\207V\200J<\020\r"
+	.ascii	"QI\031\027\006l\302\227\230F\023\307@\201\201\252\016\320\234"
+	.ascii	"\253y\231\315m5\233\024S\337\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\006\204\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 \204=\002"
+	.string	"\204\002x"
+	.string	"\007"
+	.string	"\002\002\004"
+	.string	"\001\002\004\001"
+	.string	"\002\006"
+	.string	"\001\002\007\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006\001\007"
+	.string	"\b\b"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	"\r"
+	.ascii	"-\274f\216\273i\001\034\342llE\267\022\030 \r\220\006\250\005"
+	.ascii	"\001@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.e8615c86a18bb19e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidAudioInit.22.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 \315u\005"
+	.string	"\"J%+\200k:\300Tpl&\222E\r\361P\273R\275)D\274#!\016\232\327\205k\375A\372\031\200\251\300\033\243\267\032 D\233\225[\246\277\252J1\207\205\321lV:\027\324R\314Kc\314\252\360\232%\264\331\250U\233\223\330\313\240\024\216\022\356\316\362\207D\344z\2474c\307\334/r\222/\377\002\232\301\237\247\016\365\351\256\214D=J\234\314\377\235\276\375 \302d\340\241lB\335=\031\263\333\312\355\273\341\n\274\217[\031@t\367\245\367Y\366\274\377\r\377\017\377\037\001\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStart.23.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@+\260v\203A\004\031L.\b$v\031\344\224\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!E\032-\354\235\345O\251\310\375n\030\215\036w\277\330I\336\374\033h\016\177.p\016\241\356L"
+	.string	"@\217\224\310\363\177\253s\277\tq!\2240\240SwO\356,\267\222\373\356g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStop.24.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@cX\030\007\217\200\350\320\037\"\244&\f\300\223\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!%\032-\354\235\345O\251\310\375n\b\215\036w\277\330I\336\374\033h\016\177.\230\016\245\356L"
+	.string	"@\217\024\250\363\177\253s?\tq!\2140\237SwO\346,\267\222\373\256g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioGetMode.25.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\222\314-2pM\322\001\260\006\200\325?@\3331\312 \350\202M\255\002\314X\252m\315n;['\242\323\244\203\266\374\257^\377B\027X\362{V\305\027K6\2212\245\276P\317a\",\030\227i\3175\007gih\227\352\241Q\006~\031\206\252A\274W5)\356\325\223:ut\302~\310#\3649,\241\311[g\276&:K\r\300\350\344\307\216\234\324\f\373\320\252\307v:U`\244\300d\267\342\263\262(\254\244\303\366\306\226|\217\177l\f\241\270q-\250P\210\244\354\3066\235 :\203>\020\235\251\306\341\023\372\007\371\001\311\211uq\236"
+	.string	"\n\273\353\264.\213[o\033\301v\202\355\213\b"
+	.ascii	"2\003\316:#e\b\3055Q5\002_!\262pW:\355$\003"
+	.text
+	.section	.gnu.lto_pidAudioSetMode.26.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\262\21644`o\032\003\027\022\302\016\001\231h\243\226d\347\020\336\004\004W[\221\316L#\253\203\313nO\036\342C\311J2`\022q\205\302\333\364\243YK\232l\271\245L)\237k\202\252z8\023\273$:\027\026\222\023\223\017X\007$=\031\204\344\030t\206>\231\214\2303\223\033\356\256\016Ou\310H\225 E\037\254O\2142\252A:!z\336\034k\221\345\0309RF6J\257k9\322\203\036\255\253\377/<\265F\331\257b\320 \350\376\213\016\346\251\330\022\262i\353\327\232\304%\232Q\243j\376\216\025\226\237[h\002\200\343\201\007,\307\312\002\226c\265\326\245\240\" \306B\345\345\277\204\037\326\374\264\332&\326l&\222_\246\341\177\337f\302p\241\333\"\264Uh+\022\b"
+	.ascii	"2\241u/pq\241\020\f\271\004K\254\246\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.27.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375`\375\001\035\021"
+	.string	"\006^lH"
+	.string	"\257(\035"
+	.string	"\210U\241\277\257CXQ!\342\241\231op>\3262h\004\255~_\343\242D\237B\235[\277|\370\266\337NU\221i\007\r\356==\374\327]\372\\\025:\205\355\377\316\024\375\246\350z\307'\204\020\"eJ\001Y"
+	.string	"V"
+	.string	"S"
+	.string	"\250{\300\317\353\270U\224\2771\246\356\271\252\345\240\207\027\354\264\033X\361j\321\217\302=\362\003f\264F\226w/\377\017+\235\022#\3139\320\030\201\343\230s~F\226.' \347\345\005hL\341\024\304n&\234vU\031W\252\337\307\234\323\332\032%\334\033\267\355b\233\201\255\007\002\266\230\313\213kY\220s\245\006\215\211\323\241\330\360\331o\337\017\361\362\3442\276\t\025'\366A\234\264?F\271\214\327\206\306\366\316F\261?\357\3644\177\354\321"
+	.string	"\365\331\211#E\316\025\017X\213\231mNr\301;'"
+	.ascii	"\337\031e\3038\t3_\252\244\210\260\3159\303\305\3605\334\312"
+	.ascii	"\374\223\007n\001\227\216\332\310\310\261\260+\003\367\373\240"
+	.ascii	"t\301\322\035\3733\037q\36238D\324\267D\357\335\367\033gn0\225"
+	.ascii	"\326\360\247\bN\342\331%&\372\026\270\247\335\303\241C\315\255"
+	.ascii	"\306\332\224M\256te\366\271\271\027\354\317n\360j\275\372\001"
+	.ascii	"@\001#S\310\344\300d$\002Z\324!\222@JB \244\221P$\205\"\244P"
+	.ascii	"H(*\221\204\035\004,\216\214J\241I\024K\341\207T\375C\265+\217"
+	.ascii	"E\273\251\n\340\312|\022\327\023\272;\246\210\371VF\023\343\212"
+	.ascii	"\021\243y\344\210|w\203\323\001P\277$A\320\267\374\362\235\206"
+	.ascii	"\327\255\266\332\324avj\001/ P\002!\223\260\035\222\200`\370"
+	.ascii	"\315\260\225@\231\367M@\330\325\035lK\033\250j\002\203\013\347"
+	.ascii	"\232[pw\347\363\206\327C}\016\0342]e\243\325\276\027|\0304\345"
+	.ascii	"\230\344\023\303&\205H|\267\272[\364\232`;l\320~\"8\217\035\n"
+	.ascii	"[$\rj,c\341#\203\340\202\033\314\247\334t>\326 3\236\356\271"
+	.ascii	"\274\fq\016_\227z\355\204\002"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.part.0.37.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375`%\n\005,"
+	.string	"zK \020E\200\232J:\367\334\021-\032\230\223u\373'\326\016\037\351\275AR\200pb__A\235\277\356\335\356\307\026\305\310\337TK6E5O8\265z\332\314\374\376\363_\363\226P\204\266\246\252*C\263\215\264F\210\334)\005\357"
+	.string	"\342"
+	.string	"\347"
+	.string	"_kF\036\255\274X8\325\244\352\026\253\021\025wjqH\227\263Z+\205\263,\rM\352g)LT\024\253[ZY\216\234\372Y\212\223\250u\"\253\300\"\2347\211\016\364\273Y\336\347\207\245\314>\024+\277\022\365)>\026\266(\237\354Tl\241U|\212\027\315L\250\302?\037\212\224/\345c\026\206=iA\305G\2145Q\374"
+	.string	"\202\324\305XXK\214\305Y\217"
+	.string	"\253\370\370Z\343\340\274\3710\013o\372\001\204\251?iAD\024\253Y\017\270\346\234\350\325*Vt\323\b\316\233ob[J\313S6\335\305\274\352\307\216Wdz\265V\243\233+\344S\007\376\314r\3519\345\003\217\210\007R\254-\033\377\331\235v\2751\311\234v\225\225O{\311$\007\034\326V\215\257U\261\352\267Sk\315\3312\226\264\347'\360\250\326\352Sq\335\301\333>\332\366`\347H\b\\T\264\217.\020\357\371\262\356\017;Hm\240"
+	.ascii	"\201 \365P\220z\300\333\334B'u\320\363n\240\223\372\347\244\366"
+	.ascii	"y\362\3569\251y\316w\357\350\004\251\005\004\251\003|\314\r\340"
+	.ascii	"\244\026\236\3249G\023\345>\203\324\300 \365\357h\267yR\227'"
+	.ascii	"\365\336\355\246@\352\037\340\221\340VkV\037\234\312\303L3r)"
+	.ascii	"\177\224\037\355g\373\325~\267\177\314?\367\313\375h\3766\177"
+	.ascii	"\336\217\367\363\375\311\353\330\367\343\364Y\230lk\213\221\254"
+	.ascii	"[\363=\377\r\337\221H\335\357|7\327\313[[{\321\004\257\254V."
+	.ascii	" \301Ag\327\206\r\0333\016uta~\306Oc!\232\266\266\253,`\036\347"
+	.ascii	"\227\271\23197\271\267382c\304\210\201\202\341\004\003gv/\376"
+	.ascii	"\233\205n_mF\036\257\312.`\271\026\237\313\273X\310\026x\301"
+	.ascii	"\315Y\rd;\214\334$\003\252c\270xs]\301}\232\227{a\340\366\302"
+	.ascii	"\250\216\377\330s\250\274)\201{.U\373\241E\257\260w\267\332\257"
+	.ascii	"\350\277\265?\200\240\307\002nY\271\226hs\177\233\224c\355*Y"
+	.ascii	"\256\271O\273O\234\361\013\362|\356)\326Ju`\267\334w9eS3\336"
+	.ascii	"U\355n\2068\243\236\035\202\3260r\341\314\325Z#\330^@i\f\367"
+	.ascii	"\316\253\326:\341\246\251\f:C\311\377\272\351\021LL\277\233t"
+	.ascii	"\377\366r\017\211\333^\030\275\372\357\013\030\"\215\343\375"
+	.ascii	"w\201\230j\231nmV\031\f\323\030\364\310\343\311\221\312\243&"
+	.ascii	"pa\372\302t\347O\342wuzU-S\254Ze\344\b\265r\032\266Z\211\337"
+	.ascii	"a\323\242m)\212U\023\020Y\321\244M\211\224\212\204\377"
+	.string	"\345\246\022\364X%~7\277\037;E[\003\013\037\222LD!-5=\235\037V\f\251\322\220\212\030\322$\023QHKMO@\246\023NP%\023\224\022\024\222\n\246\023\247G4pjZ\212RZjz2rj2:\321\244d\302h\004\212\024F\r\206\354\364\304\204\302\b\312\311\t\205\221\360e\335\037>\242\332*\340\002\361\355^\202\311\231\004J0c\251\023\364ZRd\317\205R\222\205\022\235\305\257\300\036m!j`m\244\016\364X&*.\321\005\326\200\002\035uW\311\342}T\376\206\226\300\200!\241\035\260I]yA+\264\267\003\332\240]\030o\306\273\252Z\376,\320nx3&\251\242}\366Y\236\375\331\353\235\232!3\356\350Y\237\225\3622\022\310E\310\020h\026\244g\337\367\240\276!;\313\263C\274\037F\232j|\f\3158\257\036;\37377\225\240\311eU\261a\nX\035\212\343\364\306\213\036@"
+	.string	"\200\r\260I]U\204\013`O&g\205{3\247l\001\200\314\250qP\306\220B4\"\"I\n\n\222\306\340\002\221!\"u\022`U1\216\033gF(\230 \005E-\251\224\206\003\005\301Ew\2474%[\262\213\341\276\262\361\270\211#P\355\025\006\351\26003\360\333.YU\245~\032\007\304Q\364\177\333\025\300s7b,\301(:hx\220\274ET\210\222c\026\204\324bB\231j\003\323\222\341\210@\3631\361\245\200}\016\203\370\210\265HJ\017\256\310/\220<\275\300\004$\033\276Z\017\023B\0352\250\020\221\200\3269\006d\316!H\021\270^\225\204*c\372\305\326\353\207;\374\312\321\321fO\202x\271\2438i\030\237\340\370\003m\\\354-\250\240ICs\245UE\234R\0226\261\234iy\344zCY\270\275\016\250FV\233"
+	.ascii	"\260\324_Y\303\315\306;9\260\201\362\341\254\021\253qn\245\347"
+	.ascii	"\314%\261\324\311\371%\361-8\020\225\326\267Q`\363\322<a\234"
+	.ascii	"\355\271\027\333O\263\016\250!P/\004\331\211j\177.n[x{\315\236"
+	.ascii	"\337C\3537@w\346Tps\316\3552Z\241\037\037|\001G\201\263\3554"
+	.ascii	"\267p\260z\367Dm\246\251J\024\202 \324.n:\021\020\"\214n\242"
+	.ascii	"\276\026\r\323z#CW\271\024x0\260\327:\243\225{\214gQ%Mh\2716"
+	.ascii	"c\231\345E%\240\246#\242L\022\245\005['\024\007\363\354(\250"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\265\006"
+	.string	"\222I$-pE\352\216\227O\034\212\323=:^\365\207\317\032\253Z\325\333\317\377\377\377\377\377g\315\007-\200\177\2625\003\177\327\210Z\262n+\267L\001o,\032\003\n\004$wV\303\351\254\202\252\023\003\002"
+	.string	"ir\246\334\216\331N\231h\267y&\250\n}\251\360\253\361\2261\003\343\305\305\n\213\035\332\335\377vPqC\0179,UI\003'&FL\326$\316\"\306\242\327\225\002_\021\342\344\376\372\365c\311\377\\{\336G\371\371\277D\224\351\356&\360#\376\327\201\034"
+	.string	".#\201\202[\2040\255\324\300\022\330\327\265$j\2556Z\031\006\365"
+	.string	"\340"
+	.string	"\340"
+	.string	"\340\360\001\202\372\245S#\030\236\220e\326\215L\346"
+	.ascii	"\355\300\347\300\347\300\367\235\204\205\033E\bHSG6\301,\003"
+	.text
+	.section	.gnu.lto_.refs.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"\002\f"
+	.string	""
+	.string	"\002\024"
+	.string	""
+	.string	"\002\026"
+	.string	"\001\006"
+	.string	"\001\001"
+	.string	"\001\007\001\001\001"
+	.string	"\003\b"
+	.string	"\t\002"
+	.string	"\001\t\007"
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e8615c86a18bb19e,"e",@progbits
+	.string	"(\265/\375`\361\013\225?"
+	.string	"\312n\204\030CP\244N\007C\243\276.]\203|\262y\0271\232\266\242\306\024\231a&u\264$\222\334\224~\322\264"
+	.string	"0\256 j\310!\355\006\231\005"
+	.ascii	"D/\024\257\t\253\030\301\270\253\216\020?{\177w\363\345\373w"
+	.ascii	"\223)\005Q\001g\001\200\001\335\316\305\343\274\016\273\003\210"
+	.ascii	"\366@Y"
+	.string	"\2768U\223\231\320\t\243\303i\027s\031O\343g\034\215\233\361\327\351\\\256}\316\307t\372\3767\275|\271\361\026\006\254u70`aSbZ\016\251\251\3648l\004\266\375\177W\350\366.N\347dZ\316@\330?\035\032\022T\254\316 ?\377\357\364\300\250/\r\216\033\243\264\253\262\273\336\244\006\210\220\373A\356\250\334\016r7\310\255\344Lj\360\316\233\324\f\316\244\272\226\251\366-L\252\023\372~Rp\016\315\227 \234\342h\267Wq7\207\013\266b\356\307\375\277KBpuT\2308u+~\305_\207\353\366,\376\326\351\233\373\321\377\367(\310\344\321F\016\247P\336\244\246\316\244\266ci$\274\277\3208\267G\251I\036\245\366\353Mjv&\265\333\231\032t{\021\203\356&\323\335jN\274u\373\002_R\343\344\007\024$u{\032\274A\016\365\367\324'\217\323\237\235\004s\272\035A\267?u\273S\267\013\350\366"
+	.ascii	"\335n\324\355i\267ww\353u7`w\003\352\356>\335\375\327\335~\335"
+	.ascii	"\335\327\335y\272{\257\273\335t\367\210\356\256\353\3568\335"
+	.ascii	"\215\327\335w\"\272\033\256\273\237\272{Mw\347\300\300\300\300"
+	.ascii	"n\207vc\022\335\031Px\214\376\335\376\337\200\020\336\223%^\274"
+	.ascii	"\344\366'\271q\267\372L\347\377\347\020z\337\351e\244\272\220"
+	.ascii	"{T\367\221\007}\301\007[\300\336?\217${\262\0239&\032N\273\033"
+	.ascii	"\352[\312\377r\351\337w\266\321\265e\253\005\357\271\364~\220"
+	.ascii	"\001\037\025\362\355\273\366L\335\307\377\276\177s\355\t\243"
+	.ascii	"}]g\373\272K\245o\272\313\377\367\251\324\3061\227\336F\327\236"
+	.ascii	"m\324}.}\363\227\037e\006\311M\367\331\262q\237Jm\224\371l\233"
+	.ascii	"k\317\245\035I\206\270\205!\301;\342}m\363\311\306\322\230N\245"
+	.ascii	"\273\366u\237\316\277\307}\275s\301\177\232\353\244\303\354\341"
+	.ascii	"s^wd^`\230\256\277\377O`\314\213\315\375\346]\373\304\375\177"
+	.ascii	"\342\225\365c\026\226\357\335\037\361\273\245\220\264\027\373"
+	.ascii	"\372\177\372\367\177\354\177\351\177\367\377\313\377\037r\246"
+	.ascii	"\275\377gJm\333\330\330?\324i\354\323\226c\276\376q\234\235\271"
+	.ascii	"g\033es\247\306l\211\266=\330\273\364\266\247\263\346\314\321"
+	.ascii	"e\226\027\373\177\367\313mO\035z\340x\034\"\367\f\216\211\323"
+	.ascii	"v\260\f\307\361\214\276\2701\303\004\247=\343\215\335P\0254l"
+	.ascii	"q8u;\354n\374\256"
+	.string	"\335\316\3334\205\013m\324|\267\377\327\355\322\177\246\273\002$w\005Bg\2240\341\324\264a\344ng\263&\375RD\316\016\247\355k\002\035l\276\232\222\266>=>9z\310\310\260\231\223\033\334sSc\243\252\241\255\211a\035\215\315\204\252\220y{\340\034Bl|\366\344p\212\313\260\323\337\003\370\031\\\276\275\333\021\340\024\300@8\355\240\230\334~@\365@?\240v\360\315\370\013\177a1\177\3732gc\203v\026\005\240\351\243O\r\343h,vf\250I\235\245\022\234\342\033Aw\213\234\017\234\342\260\242\263\":\276\340\024\2679P\027,pp\212\301\206\326\270a\003\322g\322\035c\252\264\301i\007\317r7fb&n\246\357?U-Rz\320A\b\006\252#b&\n{\0215\337$\"9~?\342\370r\343\273\214\377\305\357v\376~\031\225\0302=~\360\234 A\016\230\225\336k\017\220o\305\337\334\020\354\200"
+	.ascii	"\212|\201\363\303i\377y^w\023\345<\2617 \357\237?\016\210(\003"
+	.ascii	"\231?|\331\254\r|\001y^\021\025\035ts\332\372\364\331K\377z\250"
+	.ascii	"\345a\313\177\177\301\1775\2736\241'\230\025\264\035\331\257"
+	.ascii	"\375\\\317\241\037\334\253\303ob\352pis\267\367\275\336\347k"
+	.ascii	"\322\267"
+	.string	"_\026q\361\361\365\304\317?\024\002\221\032@h\370s\373\035\367<\257\347\361<\020\034\370\350\370\336\371Bh\367\313A\367<\265\216\357\325q=\365\337_\267\314\371PgT\373\034\247\323n\347u;\256\227\227\377\313\367\313\034\016\007\231\036?\017\205F\245z\354\030\371\013\235%\325\265\032\223[\303\242RXl\321!\305\325\t+\r\303\016\034H\210\030Z\231\030b]-\255E\344\252u\\\273\216\311\021+{\314R\261\262D\345\212\\?\f q\305\025\203]\261\214:KJ\330\245\\e\034\225\306\002\354\220jhE&O\324 j\225\350\312b\211[Bdrk+Y|Z] \211&V-b\261\013@gI\2058q\205%dW\027J\"\013\305\016)T`\221\307\030\371E1\251e\265*\223V[+\333U\003+\311\270j\261 \";`\261\353\207$\256$\213\305*\211,\326\021{D^\031\217\\CFM"
+	.string	"i\202\024\253$rI\255,\321\310\205\242\251\213G\345\212\\]\344\266\200A\002\006*\032CMU5\241j\202\332TUSSU\030\246rc\230\n\256C\343\025\215$\213\241u\330\265\032\223\"\222\264\222\311\rC!\266\263\244\330,\027G\255\026I\256U)d\223I\245\260h+\006V\260kHd\211\034\272\21644\030\217\\G%\374\3129\270\007\357\251)+(\024#>\344\242T\362h\214A4\036\271\204\311\243\020y$n\t\213\312.\241\224\323\0203$?uq\302\204`1G3\313!\344\215\006\200F![\303jG}T\370$\t\222\007"
+	.string	"\212$\307\035W\257\213\017#l8MK\303j\001\260\314\345!\345\021\271\201\343Gc5\267K\362\202\222$\214\3139\222r'\216\017!ggW\220\300\3205\251\202\323N{@\241K2X\224\f\\ \017\036\256\027\200\361\250\221@g\020D\"3\"\"I\222d8\260\002\221!+n\021p!\324Jf\222T\206\003\200\361\024\202C\201\342\331\005\231\344S\004\302_\260\265\005\263\020=\001\351mfF\243\177j3\300\360tQ\234\370\200v\"\211\251\342g\234e\237\366\036\311\367p2\317\002V\252\257\016\263\247\243>\274\306c\231\331w\261\276G\240\262\261\024oDTD\b\375T\354\325\005\360\022l\354\212\3200\362\241E\n\354j\331\267\232##\316\221j\2072M\221\306\034\023p+_\316\352\362\217\b\260\0307\021\220<.\264\313\t\003Z\223i X\224\207pg\230\\"
+	.ascii	"\n\320\226\016\251<\3213\002%^\217\234s\362[\377*\005.\003\256"
+	.ascii	"\261\b\211'\212\034\233\006\231\375\007Q\326\370\277@5\001\245"
+	.ascii	"+\220}\214\323\\\005a\270\263N>\311yz\343\365u\251;T$'2\002\373"
+	.ascii	"'\375\335\bl\361\374\313\204\316\223\322\377[\352{o^\250\337"
+	.ascii	"\200\362_F\267\377\\\345\325\210p\016\003^\376\222\024t\222\264"
+	.ascii	"\221\002&\243a\311\245vz\221\tV\362\204$\031\226r2c\361\t\364"
+	.ascii	"j\211hK G\335\252V\031\233\346\025#\036n\023[\367\300J\310\300"
+	.ascii	"\022\346\340tR\335\227\317~~\270\210\261\334\377\207\300PCn\211"
+	.ascii	"@vH\002\200=\360\302!\376\364\370\3552\020\236|>?\336\033\236"
+	.ascii	"\224-\f\205\t\264\007\361\025o\306\356Vk\317\330\330\nu\252|"
+	.ascii	"\307j\215b\001\300?p\246\255\317\370\242\367,\035\233'\360\237"
+	.ascii	"p\007\312\317"
+	.ascii	"\341\370\340\377\372\276nn^\362\264\364DX\307\266\343\223\300"
+	.ascii	"\362\361\203:H\257\\\303\273%\232\323]\374\234\241:\024\240\033"
+	.ascii	"\302*\323\254?"
+	.text
+	.section	.gnu.lto_.symtab.e8615c86a18bb19e,"e",@progbits
+	.string	"pidAudioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"pidAudioStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pidAudioStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"pidAudioGetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pidAudioSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"pidAudioUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"audioPlayTone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"audioSetupIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"audioGenerateWhiteNoise"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"audioSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e8615c86a18bb19e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
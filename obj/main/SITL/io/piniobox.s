@@ -0,0 +1,378 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 8\225\001"
+	.string	"\224\002,"
+	.string	"\004"
+	.string	"\367\344\223\371\001\006\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002"
+	.string	"\002\003\001\240\342\234\212\n\002\331\277\377\371\017\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\240)\336\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 &\365"
+	.string	""
+	.string	"\240\032"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001\001"
+	.string	"\002\001\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	")\201U\302\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 t\325\002"
+	.string	"\224\004h"
+	.string	"\002"
+	.string	""
+	.string	"\020\332\314\231\353\002i\001"
+	.string	""
+	.string	"\002\023\303\231\263\266\002h"
+	.string	""
+	.string	"\007\367\377\377\377\003d\002"
+	.string	""
+	.string	"\003\f\001"
+	.string	""
+	.string	"\001\220N"
+	.string	"\002"
+	.string	"\020\314\277\331\273\016\357\377\377\337\003g"
+	.string	""
+	.string	"\006\200\200\200\200\002\002\220N"
+	.string	"\220N"
+	.string	"\005"
+	.ascii	"\\m\0058\025Tc\037*\344\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 c-\002"
+	.string	"t\003W"
+	.string	"\002"
+	.string	"\001\001\003"
+	.string	"\002\001\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\377\001"
+	.string	"\002\001\001"
+	.string	""
+	.string	"\002\004\004\007\001\002\001+\006\325"
+	.string	"\001\001"
+	.string	"\001\002\006(\001"
+	.string	"\006(\001\376\001"
+	.string	"\004"
+	.ascii	"Y\035|\323\034qn\267\001,"
+	.text
+	.section	.gnu.lto_.pureconst.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 =m\001"
+	.string	"\3601"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177\002\006\002\007\001\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"0k\364\214\361\022\004J\250\033h\003"
+	.text
+	.section	.gnu.lto_.lto.9d8364ffc292e050,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxInit.18.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375`R\002]\024"
+	.string	"v&\207I\260\022R:\"\307\212\031\372B\216"
+	.string	"\f?\201\324\357\202\272\276\302\226{p\370\215\367/l\376\026)\031\373\356V\253\263\3165\007\fi_=6\2310\364\037\364P\016\210\265\235G\\%\320\267<\024\n\255\252\337\366\t\331R\246\024q"
+	.string	"l"
+	.string	"x"
+	.ascii	"\275\004F\320z\350\336M\304\207\255\227\210\017M\263{\b\330\201"
+	.ascii	"Q\361$\375\230s\306V\310\362\262w\213J;K\f\345*\315G\272\376"
+	.ascii	"\370\300\345t\316\2220`\021\020I\216G*\3201\001\377\263\251H"
+	.ascii	"\364\363\360\2253q)KtL@\222\334\216L\001\026\001}\351\332\223"
+	.ascii	"\273\351\376w\225r\302\345~\256\254\2269\247\025\227+q\267n\333"
+	.ascii	"\307\266\003[A\004vOGw\007,\322=yw6,T\277\256t\273~\364\263B"
+	.ascii	"\265\274\357^\251\326U\177d\004h\342cN\022A!\263*\204Zq\245\337"
+	.ascii	"g?\311_R\302i\261\211\2400eu5g\257A\353=\377g\221\207\366\213"
+	.ascii	"\303\240\335\347(9cH0\342q5\347Dyh\006\255\207'\362\"\266\257"
+	.ascii	"\366\215\356\202\366\243\234\003\230s\227\343i\316\266p\033\027"
+	.ascii	"\b\f\3159Wj\034\n\2033\270\350q.\342\303\224\024'j\032\224!\314"
+	.ascii	"\235d\374\246\0161\013^\353:\252i\360\0324\345\203$\227g\034"
+	.ascii	"\321\265\241\257\310guS \206\251\256-\343\240\307\271\366\344"
+	.ascii	"\266:\376\352\256\016\236!\366\3544d\33644\347\215\305\036?\303"
+	.ascii	"Ck\316\333\212\f\032\233\007;T<\364s\366K/\200\202E\013\250\232"
+	.ascii	"\006W\307\004$\332\345\005\263\361ee\337 \32303F\230\215\020"
+	.ascii	"H\f\2432\033_F\331\214\214&6\312b32\027\231\030L\215MLe\200G"
+	.ascii	"\232\230\232\330\207q\254\211\211\364\346w\207\364\tTU\265\265"
+	.ascii	"\261\226g\026\216\020\266k\245(\337\355\221w\224\270\373\337"
+	.ascii	"\003\004\021R9\347\234\342\362\254\373\340o\304/\275\302\210"
+	.ascii	"&\371Z\271=v\312wa\373\337\017H9\205\b\262i\320ro\334\030`q,"
+	.ascii	" 0\002\202\030\274\033\177\362\004\001\273c\304w\360]\332\005"
+	.ascii	"\203=\321\315\204\304\332,\023\367\3057\204~q:3\353.\n\233\310"
+	.ascii	"\f\337\212\234\347\376\254\363\203\360\001\250G\350>\250\026"
+	.ascii	"N\267(HPs\234\302\220\244\305\216s\013\336\202\330'\227\213\335"
+	.ascii	"\372\351\256\201\210\375n\363\266\002\b\213\207\b\356P\305\340"
+	.ascii	"Gp\277\224\037\336\350\264\217\f"
+	.text
+	.section	.gnu.lto_pinioBoxUpdate.19.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375`\262\001\245\020"
+	.string	"\326\037pF\360\320&\035S^lH\032\374\260W\253\377\232F\272\307\220\345\020\376b\363=\222\351\205q?\006[\375\346(2\242\345"
+	.string	"\255\037O\004/\253rPm\340\362`\003\013ABu\364Z\f\323\303\223\b\336\022\262\267\224)\005_"
+	.string	"W"
+	.string	"\\"
+	.ascii	"*\333\306\001\226\016\"\026\016\321\356r\252\302\3600vk\251\372"
+	.ascii	"\246E\250\251\362k\256\240\004O\353[}\203\035\262\031\023\036"
+	.ascii	"\037\013>p\355\310Z>\225\324\002\310\270<\2168\204\246\031A,"
+	.ascii	"\217\217\005&x\275\024\225\276\225\324\337<\201\204Z\237\313"
+	.ascii	"s\223\260\273\316\326\027\342&\3356\b\333\020\354\323\b\261U"
+	.ascii	"\352K6\343\352\261\276\354\322m\356\030\323\020\246U\323\231"
+	.ascii	"\351w8p1\300\263\373af\264A\321\207\305mn?\346\337\330\370\007"
+	.ascii	"\256\316\004\032\243\033\273\373\361h\021\322\343K\266\237\366"
+	.ascii	"i\336BuX\007\003\330M\001\353\331\21550\003\322\243\351\005\264"
+	.ascii	"Gx\002\332\243\003\026F\362-\233XteU\250\257\301:\362\310T\373"
+	.ascii	"\204!\337R5\255\350\312\327\324\215\004\016\326\321uN\270^\340"
+	.ascii	"\354\235vE\271\030Z\311\034(\207\321\201\304\354n\004;\303sJ"
+	.ascii	"\026\304\354\256\310\213\343x\376\212GkH\345[\217~J{\274\306"
+	.ascii	"\200\025\371\244\344L];2\031U\030;\335S\025N%\035\005\024\223"
+	.ascii	"\023\n\265\201D\200IB8x\027\274\316\244;\341\274\2163\351FJ8"
+	.ascii	"\022T\212\013A`\357\344\204\342P<\017\305\225b{}\325\234\224"
+	.ascii	"#\"(EU6\205\361&#\226T\207\362\343Q[\340\375\243E=\354pwW\003"
+	.ascii	"y\324\222n@B\036P\250\344,\343\200\204\032\325\016! P\202A*\351"
+	.ascii	"\006\342\200\3371n6\316\004\355\322\256\361\276\257\"T\324\030"
+	.ascii	"K\f\345\306\003Z\f\0022\261\270\004Ur\210\214\002c(6\320MnFW"
+	.ascii	"\034@\243x\254\342\006\fj\304\270\302\233e\260\210\3540jD&\336"
+	.ascii	"\342\276\021u;\027%\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 \271\225\003"
+	.string	"\264\005\265"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\b\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\021\t\200\204\001"
+	.string	""
+	.string	"\003\002\023\177\n\003\013\201"
+	.string	"\001\024\177\f\377\037"
+	.string	""
+	.string	"\200\200\200\001\026\177\r\025\177\016\003"
+	.string	"\004\261\346\314\231\003\001d\003\002\006\237\231\233\310\001\001\204\001\003\002\005\304\001"
+	.string	"\b"
+	.ascii	"\270\f\003\324\316\0072\202K\023,\030.!\260\234\310\247\364"
+	.text
+	.section	.gnu.lto_.refs.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\007"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9d8364ffc292e050,"e",@progbits
+	.string	"(\265/\375`\253\n5:"
+	.string	":f\210\026G`^R\007\343\341\3450\226\252\313\301.\037z:\325\327^-\2044\340\017,~\271F\2653t-mv1|f\262#\246[\262\356Y\350\314\204\205o\344\227\306\035?\310'\322~X(!\020\260\241\270UB\331dJ\0017\001O\001R\001\313\264\333\265d\001\263\341c\310\033\306\303\206\247\344\006\316~\305\261\264\267\271\225\367\266\f\356?\322\333\202s\376\221A\367\007\356\017r\023\256\"h\277\334\336\246\355\237\376\250y\225"
+	.string	"jj2\274p\246\362B{\2020\217d\301\271\215\351\024\037\3634'k\177\033C\3670\315\313\034mA\362\177kG\220\315\022\005\311\335\377\013\205\200q\232\317\226s\373\023\027s))\376\241\377\177"
+	.string	"\270\006\313K\004g\217\342f>\306\300\317\372\202\206\356\261d\037\366\377\006\201u\230\324\301\303\271=\244\235\347\f~\016\035\266C\031\360k>\337\017v\020\322\325\004\347\236\206\264#\244\355o\373\210y\r\215S\007^\340\227\235t;\230\2071\350\265T\356\237\375\277@\301\367j\331\205s\277^\340\227\372"
+	.ascii	"\037\005\335^ \201\003\350v \001\335\016\327\335R\034Aw\177q"
+	.ascii	"\237\013\273\333\255\273\321\272\375\300Yw\237\350\356\005\004"
+	.ascii	"\272=M\267\033\350\366`\267\377\272\033\257\273\341t\267]w\313"
+	.ascii	"uw\230\356\246\322\335q\335]\246\273\305tw\225\356\016\353\356"
+	.ascii	"`ws\351\356^^^^^w\317u\373]w\212$@\257|\366\241H\255T\351:\333"
+	.ascii	".\256\363\247\205\"\235\255r\313\t\324\343\013\210\230\224\020"
+	.ascii	"24\327j\225_\265\314B6\177\242\355\353\376\231\177?\213\372&"
+	.ascii	"\204\377,\267y\006\211\303\327\222\321\252d\032\322\365\367\377"
+	.ascii	"\021,\223\\\356+\243m\022\367?I\222\351\227\031\3307\372@<\312"
+	.ascii	"ve=U\324\177\202\177\377\227\377\254\177\364\377\331\377\337"
+	.ascii	"if\275\3779~Z\257\345\362\377)\\~\026\313\026\365\217\317\342"
+	.ascii	"\326\234-\224\313\035\262E\201z\375\214\227u\257?\263\325L\241"
+	.ascii	"\354\330S\375\277\327\245^\316\032t8\313\t\375\013\025\233:r"
+	.ascii	"R?\343h|,\310\343x\224\357C\221WU\302\264I\333\203~A\0172\003"
+	.ascii	"\227\223\340\260\003\2033\234\2739\232\017\373\276\223\310\255"
+	.ascii	"\352K\031\037s8'#$\354\351\372\242\301%\347v\2611b|\240r`f8\207"
+	.ascii	"y\225\377/\004\276\321\261\361d\362\305\2758\030\037\363\250"
+	.ascii	"\277\265s\361.-|\377\225n\276\305\247\367\317\243\211\327?\324"
+	.ascii	"\327\272/h\360\250\227\371\026\217>;d\t\233\373\207\266\207u"
+	.ascii	"\017\243\316\346Z<\372|\337\252\004\230\024\335\335\377+\024"
+	.ascii	"\022\022\002F\261\300t\244\331\205^#}{\230L!.\316\355\001x\n"
+	.ascii	"c)L\325x\n\323\350Q\342\251\354\017|\334\037\370\332\210 \313"
+	.ascii	"~\271{ci\367\276R\3146\213\243\234\354\231\035\320\236A\270\331"
+	.ascii	"\366\324\302\310\306QX\006NC\347\304\016\313\300\312\324\352"
+	.ascii	"nJI\030\034e\204\371\003'\375m\007\251\205\027'\305\307\365F"
+	.ascii	"N\r\347\356q\321\241\343y\371}\347\017\312W\016\033w\337t\233"
+	.ascii	"\320\303{\363\201\005\347:<e\352v\234\305I\033\243\211\023\307"
+	.ascii	"\361\356~STyI9\355x>amsq\322\034\265\005\271{K\307\034\216\253"
+	.ascii	"\021\202hr\231\373fsBch\332\276\306\331\264\317\365\234\333\245"
+	.ascii	"?\237\224\3632\367\317g\020\206\363c\207\322M\273]\257\351\371"
+	.ascii	"\005A-3-+8\267\235\327u7O\017\23553*\\G7D\314\254\213\312\233"
+	.ascii	"\237\244\025\331\201\363\230\267q\262\356~\037\022\n\026\213"
+	.ascii	"s\343%i\343\356\337#\233\377o\345{\277\231\354i\367\271\007u"
+	.ascii	"\003\275\347\020\272;\377\267\204\273\177\037_nR$jH\0358w\267"
+	.ascii	"\203\357\257\177\026\350\337o\266\320-\266\205\"\306\t\364\276"
+	.ascii	"\326\201\207v}\373n9\263\373\370\337\367Wn9]\264\257\333l_\227"
+	.ascii	"\375y\245\313\376\277\316\237\366\f\311z\013\335r\266P\327\031"
+	.ascii	"\352\221\222\021\224Q\305\216\272\"\255&\212Vu\t\330L\025\236"
+	.ascii	"\216*\f\342QIA\013\243\261\350\310\267\252&R\0221\212\240\214"
+	.ascii	"EJE\342\n\002\315TA\304\t#\023C\253\272tDZ"
+	.string	"\035\254G\0270\244,\222\214->\250G\343\207&u}\212a\"\250\256HJN(|\n\254\304\242QO'\021\217jQ]J;\303\006\n\0338@\3554\007\"\013D\026~\315\201h8$\3320L{\303\260\267>\241H[m\"\256\305\027%\016\254\315t\344\364\3244\244&!\2558\252k\221\330\340\351H\311\b\312\250\302wDbJ\312j\023\322\b(\243\212\235\225i\311\tA\033\235\324\343\320j4\036\207\002\254G\034\326\"\361\305\216\222\321ZT\213HMG\325)\300\323\321\022qE\321\370\001\312X\364\323\303\341\007\007(F\204H\223*@\031U\030\211E\242\323\220\2218T$\"5\r%\035\237\206*\b\263\230A3svl:\360\025\260M\2237Cr\270\032\037\026\034\274*\254(\327\"\206\265\006o\261\232\003\262\206\263\323\211\257\204n/\256\213\024\235\343\225-\241\3037\032_\341\251\244\222!Tl"
+	.string	"\277\324\300a\341\214k\360\2709\312\220m\260Ug2\027\330C^y\031\323\266\230)t{ri<x\004\030S\027\307\304U\215\231\004\262\252\274\301\031/\273\315\225\260\005\221\303SRVWx\340\034\200\311\250a,\207\0205\212\b\211\310\210\244I\322\001\220\002\021!\263n\021P\255\203j\212$I\226\315\\\200\343\007\215D\fqD\317&\372E]\363\337A\260\364\021B\317@\002\277{N\277@506\323\026\210Q:;\245\230f\004=\346\310\037\362\242\216\037xL+\353\3379w\251\241\342\330\261\2401`\0010\033O\023m\277&,y\245\274<&2q\301\225\300L\212\227h9\3475\033\214WzN$\231\247\2016\222\345$>\030\200\031\233\304\257)\222#\337\313\323\034~\232\037\205\313]"
+	.string	"{dn\006\344pR\bW3\334\335\037b\220i\006(\342\357\305\316T\333\276\224\006\003\031\204\264N\213;\334\240\f\220\201\243\316F8y\0060\r\214\215\372\203BF\036\272\245\365\003\200<J\252\205U\t\262\f|"
+	.string	"\325\230\267\277\300\030.10\375<\215\313h\311"
+	.ascii	"\266\245'\002\262\017\371\231Dy\262\207r\246a\232\b\334jIS\243"
+	.ascii	"\037\007\361\252\247\276\373.$\2241\255\362\230\377\353\215-"
+	.ascii	"\"\375]l\273\357#/\022\007\bK\200H\333@#\222\215\312\3335\236"
+	.ascii	"`\253\254E\220A\006\254)\320\266s\004H\327$\322\340\024\273$"
+	.ascii	"b<=uu\036\342\f\250\354\2170\024\323\3510GI\021\215\205h%\316"
+	.ascii	"\323\366@\265A,.\310l\035\2059W\261\240\025\316ERH\f\244\223"
+	.ascii	"\027\304\023\264xKWm7\204\263b\\\352\372v\227\267I\f\367z\266"
+	.ascii	"\2750\263n4\314\020E\013<\217\337rH_\374xU\001"
+	.text
+	.section	.gnu.lto_.symtab.9d8364ffc292e050,"e",@progbits
+	.string	"pinioBoxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9d8364ffc292e050,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
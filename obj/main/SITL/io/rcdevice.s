@@ -0,0 +1,1122 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\r"
+	.string	"\024"
+	.text
+	.section	.gnu.lto_.icf.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\252\001]\013"
+	.string	"\302N77`m\322\001\225\304\307\255\316G{o\\\323Fk\275\252\256O\266\313*\202?\325-\210w\0354\030\001"
+	.string	"\214 Hh\326\001f\220m\233\220\275\211\334m\t\331{\357\264w\257f2N\303\340\237@\334B\240\216\313\203(\b\031\307\022\t$>&\371\004bC\273\254C\207$\303\212w\213\350:\030;\255\037\217\322\305\245\307\227u\372z\361\214\247\277\003\001\" \025Uu,\253h\333\2244N\341\220B\266\337\227\267\005\003\0276\334\250\346\347|{\252\240\304\321U\350m\246\236N#\242\246\232\3118m\366\273\177=\376\232}\013\277:~\337W\361}\213\231\024\272\017\nI_\377\306\030\231\b\211\360\225\303S\207\237N?OM\006\222\205\201\274\214\007\270FB\203\007\302\277\313y\240\031\201\036\366\376\020? `\20234\264\036\353\003\330\001p\213\025V\004\226\340p7\202\325\001pBW\023$<\311~\266\365tY\351\030\310r\024o\031|I\200\377\337{S:\266N\330\357\264!\264`\376\002\033\265\265z"
+	.string	"l\257\307\n++\350\316\262\004\030\360\201\002|\276\221#\234\276\020\200"
+	.ascii	"\177\021\344\2042\270a\200\311\300K\333\b\020Ps\230\320aL\013"
+	.ascii	"\223\005\333\214\345>\334Qf\306\033G\323(K\361`'\305l?\236\230"
+	.ascii	"\031\373B*\356\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\204\001%\007"
+	.string	"\342H\030\033\200\265I\0072\201\031\250f$\246\342@<\002\0215!BBm\327\254\335[&\031\374\304\031\304\221\245Cb=w%\303\234\213\340\250@[Ca\"\341\314\262}\360p3\257\r\251\202\351y\335f\203Vi\273\344E\326\221\265\374F\235KA\032\320\247\007\212N\033v6\262"
+	.string	"\275\317/H\316\204U\002: p\202\231I\263\003\005\002\274D\314\305\313\241c&X@\027\215\320\260\210\b\226\\\204\315{\2260\330\230\rx\200L\367uPx\006\004f\216\242\005l\023"
+	.string	"\017[n\\\275\2608X\224\272\021\300"
+	.string	"\0377@/\330\200\214Z,~\b\r\\-cY@\344"
+	.string	"\3743\316\300\323#\354\354\316 "
+	.string	"\206L\003\357"
+	.ascii	"\204\031\240\020\2040\341\n\272\261\332\360\260\330<\\v\372\003"
+	.ascii	"\223\245y\271:\234\202\017\001"
+	.text
+	.section	.gnu.lto_.inline.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\324\005\245\030"
+	.string	"\226\342tG\320\362&\215\001\"\220\267\276{K\242Y!\211\244wtb\355\202\030w`\326m\303\025_5Q\342m\242\341\356\273\326\003\216\036\rz\263Z<\210e\210\001\354\301\025\376`\"\3279kM;\206#\277\3326b\267\2242\005\\"
+	.string	"_"
+	.string	"c"
+	.string	"/\253\372a\264\035~\353\301a\315\352\340D\251HpwLo1\306\324\332\255-\031\323\030c\344~B\214\321\346S(\232\377\346\211D\321\331;\340PT\366\2365\333\243#\b\317\201T\216\3500Z~\262VW\030\235\361d3\202\037\2635[\013&N?i\266\306\223\r\006\353M\346\212\002\334\323\231\276sfq\226\206\374 \350V/\335\360\365Z\241k\205\256\025\262\354\016\211\241\244\274\353V\277\366\247\271,Q\244\212\316N-\tQ\370q2\234\265\267\226H\020\220\220\327\214\276\260a\340Q\220\361\275\037Q\370RT\267=\033p**[O\230\275"
+	.ascii	"\024\305\004\337\367\213\355[\343\236\232\347\031*\245\017>G"
+	.ascii	"\360_\224\203\022\024\021k\213\260\370\331I\231d\030\255"
+	.string	"\203\321n\270\247\331\0349=825\212\3244\"\304+n\r\377\223\325\037\243;b\214$\263\316\367\223\244\376\265\250\216R\216\r\275\223\331\"'\r\"\036\274L\221D\025zXx(#\200a\264<\363\204\321\366\347:\366n\373\0054\363SB\257\255w\006\0375\032A\263\b\312T\273\341\341\030\013H\326\001\036\204\253\213\276\005\234\001\235\245\232p\3013T\362\211\211\213\"\305\030[\331\375:\350z-[\242\303\221Sj}\032\327\007Aql\020\032\3123\262\250Q\255\351F]T\006T\222\317\373\365\262Y\021\320\\(W\336m3\031p+*[\305\303\b\b\210\001\227|\200\221\250Q\271rdDh4\005I\n\215\001`\002!3d\346\001\022\300\264)\005=$%\023\bM )\252f\177\003\246(\334\337u\277x\346\021\373<\302\252\352\322|8\342{q\202e\336\202n|t\203\313\226\034\235\034mg\034\336"
+	.string	"\251th\241\f\373O\370\255\267\bLl\343s\006\230W}G\231\016\247g"
+	.string	"f\247\213:\2140\035+r\035\035\212\343\022kA\033\361\272\262\030!\333`B)\004\2042F\244e\214\270C\"b\bz\007\205\017\021\025TbM\213&\243i"
+	.string	"\365\255\305\3136t=H\354\321L\324h\013\004\tw[\027\222pP\301\345$\377\333\022&\0317k2\245hsT\\bO\214\034q\005B-X-\024;\267\021B?;\250&\032\006~\002\036\207W\003]\220\367\227;\320M\024\006_\343\233\205\314\003\002\026\360V\316g\237>~\214\2031R\270\f\005\rz\270\245,.\030\375\0131\261"
+	.ascii	"hj\246\256;h\036\005\243\005\311\223\324\017\b?\017\220\321\021"
+	.ascii	"\r\\\300\330\310V\365\224\354u5\374\322\305\222\375\022\333\241"
+	.ascii	"\336;+\347\321\332\323\022\0373\312H\n\343\332,w"
+	.text
+	.section	.gnu.lto_.jmpfuncs.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`c\007\375\023"
+	.string	"\006\030F6@m\222t,\3321\260\204\354\312\231\230\325\007\357\276\370\013\374\214\021\n\t\2469l\3371<\244\034\353\304\nB\337\316\263#\247d\231!\363E}D\032\261\233\310$\0030"
+	.string	"6"
+	.string	":"
+	.ascii	"\363\254\251\243G\251\204@f%\365\316H\237\221\372\021\032\246"
+	.ascii	"_%LWLYY#M\246\033\023\323\273\214|'\257\366p{&{\211\236\026T"
+	.ascii	"\013\002\366\"\3610}a\232\303\257\371:S\224^\201\336\244\327"
+	.ascii	"\240\265\024\005o^\352Q\201\272\321\331\331\307\307\244[\357"
+	.ascii	"\366\370\267\t\265\226\221t\234)\"\035\270ox\r\033\026\316W!"
+	.ascii	"\225wE\257h\216\334\250\262\246\207>\300\375YpP\003E\03072\203"
+	.ascii	"\336 I.\200gB\256\346Lz\206G#\230\362\271\313r(\265\353\323\224"
+	.ascii	"w\3410\364\007\227p\002l\256\027\023\270\303\b\006\364\004?\022"
+	.ascii	"\020\342A\3345\322\037\266\370\254\235\225\216\216\317#\2254"
+	.ascii	"\243\224\342+\271^\\\305\2275\342\341B@\350\223\260p8\013\207"
+	.ascii	"\363MH\3058\n\251\001\200\241\250\201A\203$IR\220BkP"
+	.string	"\002!\205\312\252\003\022`\303$C\3024\206 4\320L \024fQR*\314\001\221\004\036\345\305\026=q\025\242\241\0223\311\216\225[P\t\267\255O\007v\263;{`r\347\210$o-\b\032\255Q\023\214s\0238\227\237M\336L]8\027!,\274)T\235[\260\026\"E\325~2\352\373s\376\004M\024_B\315\2662\375\336aC\bH&\326\320m.\313^z\331\031=\363{\364\007\234Kpv\336`\305\316Q\022\271\026\265G\231\025\351\267Y2ii\004\266\347wv\bw\376N\220\277y\331\233\006\275\271\305\250 -\367>\025\\\354\317\263\210\276\004\006\016p\300\007+\3736\3129\314\216\202\247Dy\"6\263k[\224#\371\241\022\366\005\300)\366\257\212Q\2557\325?vll\355\270\213\363X\006\2029\005\224!\022\255GmD\333\236\246\b4\353_7\353\001 A\305j'\371\032\335\220\003\3469"
+	.string	"\204d\376\no\257\0231\336\207\\\337\002\313;\233\233\243\3327\214\226\204\327\213f1\263\330\274D\016\205"
+	.ascii	"\204\221\026\324\214\240T\24105\346\332}\332\230\330\"\016Z\003"
+	.ascii	"\013y)\335i\264a~\n\022\237\212\323\341uK\030\245\246\221w\342"
+	.ascii	"\341s\376\363)\025\322\002K\031"
+	.text
+	.section	.gnu.lto_.pureconst.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\271\004\001\231\004\002\232\004\003\231\004\004\231\004\b\232"
+	.ascii	"\004\t\231\004\n\231\004\f\230\004\r\232\004\016\232\004\017"
+	.ascii	"\231\004\020\230\004\021\230\004\022\230\004\023\230\004\024"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\305\006"
+	.string	"\262\t\035\"\220\265\031\016\315\335\273\273\237w\007v\222y&\302M\233\020\305o\0203d\326o\277\325\254\231\264-e\n7\326\244\211%7ib\310\275lV\234\230\031\261\326\361\234\366\260\242 \016j)P\036PF}>U\005.\213#p\263U\021\036(\213\3433\352dU\307Z\311c\250\237P'@\247SU\307\362\347\030`/\373~\317\371\242\274Q\376\rg6<\013\002- \260\202\231*\353\375 \023,\301\b\036B\032\204&\223o\243)\017\357\336\240\024\023m\f\362\217t\224\353\006\004\321%\004\025\f\024B\003n\307e\215J\b\216\314\f\316q\224f\241\220\017\f\367\331\207\005\331\310ZD0\0170aW\244/;\216%!\326A"
+	.ascii	"\316\341M/h?\270l|\266\r\267\b"
+	.text
+	.section	.gnu.lto_.lto.181c095bd85053e4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_expectedResponsesLength.26.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375 \203\275\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\004\005\001?\202\210\200\020\177}\274\001{\273\001\005\001\006\025\002\273\001{\277\277\035\001\005"
+	.string	"\304\001{\303 y3\305\0014\302\001\301\001\300\001\276\001\275\001"
+	.string	"\n"
+	.string	"/\202@\335\250\356\200|7w"
+	.ascii	"\203@\271{fHi\020\003p"
+	.text
+	.section	.gnu.lto_runcamDeviceFlushRxBuffer.33.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"5\f"
+	.string	"\346VSB\020q\233\0168\334\256\200b}3BH"
+	.string	"\002\013\251\232F\236\025vi^S\177\021\200tt\006\361\030\350u\354\343\317\210\323\345R\324I"
+	.string	"\200\212\b\212Q\204\270\243\002\303*CA>\277\033\331[\312\224\002?"
+	.string	"?"
+	.string	"A"
+	.string	"%5v\327R\020\206\311=BM\316\317\016&\235\367y\204\024\bDD"
+	.string	"\017\0043%\322\311I\236\032<\217\204$B\256'9\034\341\220\322y!O\252\301\356:;o\303=\335\266\3066\306\376\203\376\350\2374\255\231\316L\337B\221Z\034p\261\013\262rcQ\342\311\210\213\355\247}\023?\301}\304q\001\273\241\224\025\273\237\002'\250\036\375\235\300\364X}\300\364h\316\226\361O\264\324\207\030\031\002jQ\231a\003\356\356B\025\261]\345\325\256\300\311wF\360\241\037\333\027\236\302\003\340\305\356.\360Ql\030\f\210B<\372\034\323\343U=\032%F\035\271\242&,@\236\252\210\375}2#*\221\254!\007\330\225u0\315\344\013\203]Y\007\323\\\233\245e\326\204\f\302\306\2726\216\205)`\215\002\266Y\0264m\263.\337^Cv\240\202\322\241\0361\302\244\252#*`|d\311\227L\265%l\362\235*\003\017%\236\252\312\025"
+	.ascii	"2\003\353<\222c\353\365uX\\8kv\030A\334\021E \221\313\235\250"
+	.ascii	"\022o\302\302<\n\232P\213\224K\260\315jJp/n\251R\265\f\324\313"
+	.ascii	"&a>\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendRequestAndWaitingResp.35.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375``\tm6"
+	.string	"\232_,\025B@\"R:%\302\353\237TC\365V\245A\260\214\032\265\356\201\301\300\313\024U\205\t;\320\031\035\217\354#6\255^\375\036\330]0P\234\252\376\\\035`\310\013\222\037]\300\244\356a_\375[#\204\354\235d@\001)\001D\001m\313\277E\240-\210\230\tz_\350\323\331\016\"<+|\377\006\337\364P[\266l\255\247\306O\216\274\326ngq\336\367\215\352\030\354\232\253\271gs\265\002x\263\246XT\b\3176X?\240M\363\007bE\373\001GC\306\335\024.\270\2476\017\340u\326e\221:\356~\331\315\334\237\t9"
+	.string	"\340\315J\333\212\363\276\324\250f\022\236m\352\013\264g\205\037\320\236m\267\033\320\251copJ\246\245\246\357}_\251|\245\327\257\324w\213\335\037\031\213F\304\242\2410\330\262k\306n\277z\334\3057\344GRn\\\241\236\264\301s:h\330:"
+	.string	"oL\225\307I\301\305\240\207:_\307|\261\225\371\211uE\271\021\330\211tP\260\265\001\030(\024\\\264:\205\30519\035\364k-\240\247\312\237\327\211\202\207Ib]\322\013\327\005urbN\007\225\256\016\300\250\270y\365I`\240Opp5\272\013\363e\214j\255\025\244lw\267;\336\212:q\373\305\353,\021/\3173\352\344\353\312\301\254\f\026c\224\310\232\321\324\336\210\321,\234o\367\002eixkQ\257\343\240\207\367}\033?\243]o"
+	.ascii	"\357\276SwG\273\205\322\325f\260\313\216\f\254\257\227bA\336"
+	.ascii	"\373b\375\331\367\363?&\372Z\3166\212\024\370\317\024\355\212"
+	.ascii	"W\177\020\030{\337\027\0033K\340\323\013\013\0076\022\376\373"
+	.ascii	"\276\323>\375s^}a\034{v\303\220Q\224h\256H\036\322\002\3600w"
+	.ascii	"\323\260\201\377l\002o^\374\004e\345!\335T'\316\323D\206\354"
+	.ascii	"\274t\266\322m\304\035\005e\304\375t\270\267S\306\335d\304\315"
+	.ascii	"d\304\275t\204[\311\210;\002\004#\356\007F\334\016\222\316\366"
+	.ascii	"3x\232_\301\321\376\004\177\363#\235\315/\340k\377\321\251\177"
+	.ascii	"\361g\377\360u\3576\343f\213\270W#\334\331\b7\316\270o\301\200"
+	.ascii	"\2250\260\251\231\214G}\271\002\023\275sl[\227\303\375u\177\333"
+	.ascii	"s\367\373z^\327\267\233s\345N\327\311\317i\023^c\227\353\317"
+	.ascii	"%\237\207i}\331\274\353\364\020\233\262\276\367\245>A\205\311"
+	.ascii	";\217\353&\266\016'Stt\023\337\016\327\257\323D:\256\362s\232"
+	.ascii	"\365\342\013+{\337\227\250\354\323i\242\362n\355\326 \213\372"
+	.ascii	"F)H\343\224=\021\021\236\315\2576\261\037\347r\334\007N\332\263"
+	.ascii	"K\371u\216\321 \361\022fv\306@\372j\353\211\001\"\003\033\266"
+	.ascii	"\002(\2576\221\206bz"
+	.string	"\023\360\232\023\344\317\301F\\)B\227\312\253n\225\005y\356\324\275\202\377\354\006\n\362\232_\375\203\256?ixj\200\215v'\246'\314\323>\335Ip\001\266\375f{\273\263e\210\264\340\254\017r\204\274\325\375\243M\220\017x\325\245\365y\263\355v\261\274\332l\303\353\343\033fyU\b\026\036\031\322\226W{\240\335\371\201\345.\253\333sO@\3069gVo\tw\273a\\1\370O\234\225\266\244sN2\257^\355\361\003\213\220\273]\262\352\233\272\3668\361\326\366\260p`0O{\203\035\026Bf\377poa\261\264>Y\370o}\337\367m\177\2466)CX\317\274\301)\022\346t\036\201\"\207]sRn\363V\237y_Sj\214\371C.\232\250<C\017r\r3?\244\264\265\2715O\333A.ff\032\237,\374\327\247k\327\354|\315\245<\267\354\204\\4J\031\006}\357\003\b\021\"\332\263\016\362\355N"
+	.string	"Q^\230\331\031\026\016\314R\266\273/\271\213\371\371^Z\336\264"
+	.string	"\217r7\211W\333m\317\316\257\230\273K<\311W-U\354H\036]\374@R\025\001\261\002\201\254\242Z\362\250B2\211STW#\220U\313\034T%\230\310\252+a\025R\231t\021\204i\205d\001\344\250,Z]-\225\310\244U\220\ny\302\350hu\f\241<2\217<\206!J\340\240:*\225\313\251a\333S\022\220SI\037H\034SL\251eR\212*yTJM1\253\244$ \350%\017$S\312j\271dJ\021\251X\317V\032\017\324O\020Vv\366r}_\261\016\325\007\020\204v\324\001\263y\230\373q\256\323%\022\244CEN\2311O\373\330*\345\033i|\342\332\325\302S\216Rv\270G\372Z\204\264g\225\362\343\216\307\270\372\302\314\316\024d6\267\3619\361\324"
+	.string	"\213^\302\274!>\035G\030.EN\031*\212\013G\001\203\312Q9\2064P\013\360)\1775\245\177\356a\347\227\362S\236!=T$\314i\224\247M`\177q\304l\245\335Z\247|"
+	.ascii	"I\24049\2507e\247LA\372\366\266\037\256\333\325\202\275\226\005"
+	.ascii	"\266p\0237Iq\214\311\212g\353\213)7\345s\341\256(S\316\200d."
+	.ascii	"\314\354\254\215\254P\231\242<\035\360f\273\224o&M\016\256\335"
+	.ascii	"(V\322\0246F\202\223\270K\334&\256\023\374\247\033\200\271\250"
+	.ascii	"A8\305\0303\f\215\210\220\202$I\322\001\200\002\221)\262\252"
+	.ascii	"\003\021\260\265TC\223\2442\255\001\312\002\265\034}1\311\263"
+	.ascii	"\265!\371^wV\366\371\220\320\001\246\273\263\331\033J\354Q\f"
+	.ascii	"\225\363\032\"]+\341)\215 \001\302\021\262 \326\310\375\365\251"
+	.ascii	"uV\310\006\205\025\033d1\037\274!\027\254\2239\361\334\270JI"
+	.ascii	"\304i\001U`\334]\364\302\302Pc\356\2171P\222\341\315}\213\362"
+	.ascii	"\375M\234,\3716\204@Bk\374\206\224\214\177\202\013\342\327\223"
+	.ascii	"\3303V\347\230\013OF\035\006\326\021=\271zOj&=\360\017\237V\\"
+	.ascii	"t\350\312kZa\306\330\254\357Z:MO:>\324\325#\354\305\320%\007"
+	.ascii	"\234\271l\353\313\265\225#26k\021\026\220 \242[\341\225\\\335"
+	.ascii	"\352\211lh1\242\367\rh\346\001GN\n\233m\205o7\341\352\215`z\204"
+	.ascii	"B\017\367\373 uz\330pJ\031\203id)+\255l\006iDSmJ$\301\353*\234"
+	.ascii	"\333\234\r\271\200\234E\325(\250-Ru,3\031 \336@\234'A\326]\037"
+	.ascii	"\355i\320$x\033\330\330[\357/n>?-\231\bU\020\334\b(C9\226\354"
+	.ascii	"\316ZW\356A\306\204\332\240\204\323\333\217\006 \344\363C\241"
+	.ascii	"U\272e\245\340J\311\002\316\337-\b\004\003t\\\240\\Bf\332\315"
+	.ascii	"\007B\022Z\374\304z\242\241\241\220\341l\372\231\247 \372\246"
+	.ascii	"\345Q\001"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.36.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\035\n"
+	.string	"\346\022F>0\345(\035\300s\0257\330o&2\033N\310\250**\353Wc\323j\354\272\325~\220\264d\254\355c\207\272\251\r\035\226\356\026RZ\n\ng`\300\314\017K\311.H\326&\226\020\262eJ\0014"
+	.string	"5"
+	.string	"1"
+	.string	"3\032,\264\335\375&\311\307oSG\177\2004}\363V\237\233\002\353eE@\2426\316L\004\300a\327\r2\245\252\361\354\256UEv\334\334m;\330^\260\357\005\352w\0172\232\200N\314.G\255\300\302p.'\033\333W\373)w\215\177\225\016\n6\025\373\220\355\226\fN\360\316\271<\247;\347\335\240;\347\321\016\360\262d5\255\237\0211\231\224\022\260}\361\225Q\203\257B\312\360v\367&\347\374Rw\356\363\260+\210\007\n\313\365:i\315.M:[\366\267\335]\317\021\373\257\177j$\0218\rv> \b\343#\001\212_\b\372(@\020\023\037(\206\276\016\202\303\212\217\370\211\302P\3746\345\336s\232\250\315\3239m\213\220^\345m\232\264e\300,dz\324\005\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\t\325*\b|\"\3049\304zKx\002"
+	.ascii	"S.\3016\253)\342.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_runcamSplitSendCommand.38.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`U\006m'"
+	.string	":Fl\017H\200\332Q:Cf\227|\035!\006\210\005\224B\321Q\375J\317\311\343\034\232.?\357I"
+	.string	"m\255\305$\225f\233(\321u|\n\020\334\266\3109\312g\034i\300\"\303\351\036H\236\032|\373e\240\244\212,\"\204\020B\344N2\337"
+	.string	"\332"
+	.string	"\351"
+	.string	"\311{\205\017~\362\221\372\323\350l\313\\\341B\357F\336\003\\\337\031\250\333-\363\243\\J\357\305\031\027p\257\225\033\256{\215\021\330H\375\311\306\003\241?\325\373\240?\231{\314pn,rS,!@d\235{\357\255\261TU\335a\363\246\361\\\353\336\001\360\324l;\253\232\242\247\331\266\307o:"
+	.ascii	"\344y\314\264F\216$\037\023N\231Gg\311\256\203\325\260\265\337"
+	.ascii	"\020\310mf\212C\250\346cB*\363H\031G\352b?\273Cd(\365U\255\032"
+	.ascii	"\376xj603\304\315\307\204>\314!\2520;jQ@\213\212\335\003\026"
+	.ascii	"\224\262j(\365\363`\367@\366\244\254\032\002\271YT5\f\3626-8"
+	.ascii	"\261\241\305\026E\303\254Y\241\263\344\310\333`\224\317\332\224"
+	.ascii	"\303\275\227\355S\324\360"
+	.string	"\334s\346'`f\022\314gX>/fE'\273d6\372l_1_\275\342e\204\333\212yA\321\275\316D\n\036vN\200\340\300j\331\300jy\250-\013\265\345\002\253e\002A@?\252e\237\001\347:\363\334\370\257/\376\347\277\3166\265|\006=>\314h\330\2727\307\022\355\2269\273\224\374\353\017\373\271~\257\177\n\177\313\303\370b\\\323\322\273\225\177\361\301\270\312\326\215\335\251\360\273\334K/\031C\274\367\326\274\272x\352\315J\267\332v\361&\244`j\210P\177rqY\372\375\tW \226\020tw.K\250p\325\221f\231\374\311!\324[\341k\371\225c\331=\213\221\332$T\261\220A%A\250?\211\314\035\277\n\327v\337\342\0215\005\270>\262\033Y\367\032;\250?\177$\327\256\365c\357Sb\2507\353\003\026\222RD\262\037\225o\355\253\033\241A\215\2403\034\177h>\013\245\325$\251\032\350\003m\337"
+	.ascii	"\323\222\320\2416\320\007\362\020\352\2416\277\200i\020^\240"
+	.ascii	"\205\372?4\237]rP\027h\031D:\3004'(Y\216ci_\361\223P\002\375"
+	.ascii	"\252c\230\240&\320\027\273\331E\214\003Ls\352-\034f]\350O\373"
+	.ascii	"4P\377\r\220\207\357kR\360\370G\370K\350O\237\266\310\240\024"
+	.ascii	"\205\363\364\200>\330M1\"\231\037\023\337\221\362\227u\366\225"
+	.ascii	"\021\tb\352\224\255\215\306\236\277\216b\236L=B\235\262\257\363"
+	.ascii	"Pf\206p$\357\247\310\275\367\350<\206!\226\305\260#\034x\201"
+	.ascii	"\231\t\235R\237\0347f\f\363\336\252\r\237\362\326\361\365$\251"
+	.ascii	"u*d\212\315/\320\367\211#\033\032\366\214\231\221\016\346\205"
+	.ascii	"z\357\305\300\377\302\264B=2\003\375\371>\362\r\002\314\266E"
+	.ascii	"\216E\353\230\\4\322q:\\\353r)R\354N\224`\322\231\330\325\230"
+	.ascii	"Z\344\222v*t&T\224q\022r8$\0309\0248\335M\t\351\326\002\311D"
+	.ascii	"\322\r\247[\272I\020b%\0279\335\215"
+	.string	"IIIw\253\031\235\336V\266}\007P\373i\333\301'\265\354\222{\354\t\241\310\233\031\227\263\177b\313\245G\231_7\361\325|\216\211\206Xf\373H\306\314\007\217i\013j&%\225\371\344\177T4e\022[\221\031<\330\327,e\3216\240\3314O\345H\025\251\2161\304'\036\335\227\347\241D]T$\206\375\2506\224\235M\325\372\212ok+^\277\254\n\326(\312-\247\032ds]\240\226)\213'P\007u\020\304\324\222c\033\032\366\314\274\367\336\235\276\342\245\237\212\240\317D\t'=\320\013:\310\334\263\\.\2277B\023\264\202~\200\204\250A<\205\020S\004\231\231\tdF\333\244\003p\002\231\271\332\r\020`H5I\007o\360b\304\363\373\366\35259\021=\264\223q\036\205\21467\243\001n-\"\312\323\226\330@\0026\301\276Q\266WZ}\0362j\360Hk\026\307\341\241P\246\332\266\307c\323\375\037"
+	.string	"j\314\312\305\007\nb\255\312J4O}\352\303@o\235i\260[A\317\244\360;\360\223\035\026\003\260C\216\360\3701\257\037\0038,;\226\241P\270\3613\317%\303:\367\343j\\\332\360\030\376+\r\306\240\314\n\322=\325\232{cYd\230\337\001\254\333\300\005E\006@\372"
+	.string	"\352u\305\376{RE+\355\336$U\203\375\362\202%@\231C\343\274\356_2\200\271=A\262\220\276\327^\032\356\3136.\b\224\tm\305\354\005[]\003\313_\177\203G\351\023\204\001Pp%\271|\315F\375\020\221\004Eo\301&\310\202\313\037\350<\343\325\244\317\301\341 "
+	.ascii	"\023mb+\335J]U"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.39.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\331\002\265\025"
+	.string	"v'\214J\300\322Q:\t\206\324\346\373(\213e\242\314\216\201\327\265\332\017\b\377\2500Q\006>\007\005:d\354v\265\231<\246G\337Z\362U\244\336,F\331\277\333m0\342,\266\001H\037f\203s9LA\003\262\031\341[\311'\204\310\235Rs"
+	.string	"n"
+	.string	"{"
+	.string	"'\335\340A\356'\316\254A\253\243_Q\252\3263\301I+0O\355\013}(w \r\001X\2751Z\241T\353\271\300\b\314\223>OR\2364/\240<\351\234\315\343g\213\272\372%\355\204\303Zkl\177\317\235\034\227\346\374\232\223-_\316G3\347;:(1\334y\371nF"
+	.ascii	"T;\035\027\236\366|:JW'\265VS\236\017\305]\336v\212m\025{\031"
+	.ascii	"\004\302\323"
+	.string	"\035\036'\236!\240\r-\332\247\216\256\217\375\261\326Z\275,\354\237\367\310\213n\330\203\367\353\300_\244E\355bQ\267X\324,\026\265iR\257L\352rE=\226\324KR\323\221\372$\367\365\f{\230\024k5Q\024R\235\310%\240\237\177\321\037\374\332?\321\215.\264\313vP\346\025\347\004\253\367\253\222B)\302\031\250\201U\035\0241\310\304\f;\262\022\252z:3fp\376\017\205m\004\030@z:\343\332*o\3020 \312\031\316\244a\211e\203H\224\314\017\336\324\356\270\337\021\2574\203;Lyr\227|\352\351px\022\f]\226\013\342\013wx\f\231\003Q\257%\231\206\004Y\025@D9F\030\025Y{EF\317\363\2705\206R\002\366\254]\312/\213\321\216\033Je{v$\027\b\376Q\013\315\254\265\376\347\244OS\236\374>3\031-f\326R\216\250\245\274^n\264\t\037\\h\024f6\230\333\312\314C"
+	.ascii	"\0227\331ZV2\223\321bf-2[\254F\213\205\240\255\200\210\311l/"
+	.ascii	"\261\222\002\256\211\230\331b\267Z\315\026s\2356?\261Y\335\311"
+	.ascii	"\3659JiW8\016\024\262)8\364\341Z\333\302m\\\250\2617xS\255u\261"
+	.ascii	"\326\334\326~\227\002\266\254\325\232[>\355\210\346-\243,w\265"
+	.ascii	"\307\021\242\243E\217l\271\027B:\332\021i\0048 `\002\031B\273"
+	.ascii	"\r\3420v\236P`\321\rc\310\260\277\022\264\375\326h]\234\230\013"
+	.ascii	"T\210\2161a&C\315N\030;\035\3050@\0207/\fF\356\356\332\212g4"
+	.ascii	"amt\027\n#j\265\013\241\325i\305N\302%c\007\272\244E\366\006"
+	.ascii	"\0039\340\213$C\223\334x<\313\225\001[!(\265\203\217\233\350"
+	.ascii	"\261\266^\265\277\2721\234\336)N\3463\021Ga%\201m\344\345\246"
+	.ascii	"gD\256\351\032\355\321\300\362\036"
+	.text
+	.section	.gnu.lto_runcamDeviceGetDeviceInfo.40.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"e\n"
+	.string	"&UJ= O\234\016\243\026\361A\006\231"
+	.string	"\3038c\242\352o\013\200\306U\323\360\212\202\177\213\256\316\b\342\320\374\003\332\376AQc\017\220"
+	.string	"\201\026\024\340\366\361\243:7\002\222\341\217h\304m\245L)7"
+	.string	"7"
+	.string	";"
+	.string	"\273\037\001\017\250\016\375\035"
+	.string	"uX}\203:\364f\247\370\227a\037\032&H \231v7*\206o\317\315?\210ct\036\315\363q`w\235\235\207\302\255\267-\300\366\304\276\201%PH\304\345\311\3766\251\027\354;vw\255\236}\321\017\035i\325tf\372\217\177:&\026\bN\273\234\223\213-\301\023\035 \266\237\366?<\264]\004\341\221]O\205\211\267(\311\241\332\227\202|\347\fN\205\265\240\032\333\330G, \251jx"
+	.string	"q\270\246\346\b\005\211\027\266|\224U\273\021\n\370!.\302\201\277\341\320\027L\276;\3641\324\341\025\226\360\002\227\205e\256\nekrYX\346\252XZ\314\260\310"
+	.string	"\243X\242\245]\342$\200\263\006\227\026\037d\231\026!\037w\307\252g\370\351\264X\301\351\306\221\374\227\200R\355r\357\342SU%w\f"
+	.string	"2\241\201h`\306\005"
+	.ascii	"\005\313*a\020D\016Uw\017\230u\t\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_runcamDeviceInit.41.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\221\001\375\017"
+	.string	"v\336lG\340\264&\035\024H\202L\272\227I\001eZ\f\312\264\002d\340\214|\275:\207;\262\013\207\241d\314)\332\257\215\323\025@X\311\220y\324`\272\340s\\\206\030\022\025\020h\3140\2009\3607\254a\253'ho\262eJ\001V"
+	.string	"S"
+	.string	"["
+	.string	"\013\353\341c\027Tq\003\355\322\340Q\346\245\366\003\363\322+\373\310A\234\375\017\213\022:\216vw\213/\276\272\314\242\256\374\367\034\200\367\261.m\236\221\276\226\306,\001Q\220\033\004>\022\331\202\033\027<\336s5\361\325\250\236L\330]\253\367\271\356y\333\033lG\260_\024\237\231\227*1\330K\307\210FC\033di\214\331\217a\030\206\2160\373\340\255\235\347\227\231Z\243\372\002\030\030\275nrp\"\021pQ\204MVH\002\221q\360\267\377\036\223l\2032\331\252"
+	.string	"\327\325\001\005\351\034\355\202\016.\275iW\373:\337Y\235g\346\0066\363\244\265\3470\267\373\035\346w\374\321\366\300\242\3674f\273\302\245\003\231\024\340\374\240Z <J\210\331x\355\360\3507t\"(Zfj\021A\254\206\217\221\226.1I\277\373\020\323v\341\364\236\026\025\207\315\f%HZ\221e?5m\021\317\221\322v\367\201\357\243\202\031P$\306\245\003-'\020(\216\202\252\343^\002L\227VL\245\323\b\323\207R\267q\247\rubq\331J]j[I1\367b\3526\025\307u\033\t\334G\330\005&B4\261&\333\335\225)*\243]\301\202\3363L\212\026w\321`\345d\217\231\032?\004CH\022\"\2156\206\377\210)\020\207xE(\352g\230\361\032\002\035"
+	.ascii	"o\23173\340\2353\276\272\002ZqTjjnA\003\306\354\2025-&\342\314"
+	.ascii	"\266x\202\310w\026\217\f\301\300 g \034\250\326\210\353M\013"
+	.ascii	"\250kBc\327@/\\\003)jy\352\312x\313E\020\362\252\302U\035s\017"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulateCameraButton.42.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`!\002u\023"
+	.string	"fe\203I\320\362&\035Rq\264\303hc}\201\212\003*\002\254/\306\037S\002\332\347,#\323)\026\210"
+	.string	"\2339\275D3\232\375\375\264^\3400\202\370\241\315L\276\036r\212\370\206\323(&\320$\236\b;\2720\257\3566\b!do\231Rq"
+	.string	"d"
+	.string	"v"
+	.ascii	"&O\362\335\013?\362\335\263m\004\th\f;)\244\363\020K\263\024"
+	.ascii	"\273ZIq\2028\354!\370yt.\314\257y\370X\317AU\215\347\0375\231"
+	.ascii	"\3214\273\r\r=\264\300"
+	.string	"\315g\ng=\236Sz\322\263\242\206H\315\206\216\3448\001\364\334l'=`\243\261#R\273\241$N@:~\364\315\251\311vA\225Z\253\227V\333p\203\3346\006\333\013\354u\0206)\333\211\263?\313\262,=ov\270V\335\350\017\275\366\350\232\202\353\t\256\367[?\344\036J\354\244\032\350j\325)}\324&\357\005\t\333\367\223\236\2139\222\347\316\215]\255u\025c\257\356\335\246\261W\266\351\236\224y\200*{\312\300T+\023\212\305]\373D/\242\271\321\314\005\324z\333\301T+\211b\003\341\275;Cn8\246>\304\266<\216\003\212\330\307\362\371\004\231X\027<\234~\274\001{\362#\375(BI\320\220\215\210v\362p\3729\t+{\232\301Y\343]\007)$:q\036?\325sf\235\305\030Z5\205tv\037A\2635\315\263|\237\023\222\242l\266\207\355\326\227X\b@\331\256+U\bk\255\nT\270\264"
+	.string	"\200\252\265~\350\236?\363\335\373\024\021$d+2\212m\031.\243\013f\345\325z\031A>\263RZ,\327\205\026\005\326K\034]\242\213k\245Ed\275,\210)%\036_Z/\021f\034_\342\212\214\235\326y\363\027%CI\007\376\260\357Gg\020\245S\322y>\354\363f\216moZ%6e\264\326Z\303\211[\030?1\236@\222\2453\234\366\003\b&7\263\306s\322\371\026\263\037\261\313|;\347<\216M\266\245O>' P\242A\210\365\357\363:\013}$\361d\035\307\333\212\274 \204\206Z\020\343\013\265K\2436N\351\254V\350\210\272Y,\221{\214\216!\361!\202\342.v\2065cG+\257"
+	.ascii	"0\037\314\034^D0U\031\036\361\314\t\202\312\n\353\330\201\007"
+	.ascii	"\264\2158\217\223\321\271\335\200\341\354\227\235\f\360\036"
+	.text
+	.section	.gnu.lto_runcamDeviceOpen5KeyOSDCableConnection.43.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"U\013"
+	.string	"v\225OD\020\2538\035\270\355\rEF\321\360\031t \341\215\272\2242 \201y\310\202\326\334\236`\006\222t:"
+	.string	"B\374\353E"
+	.string	"O\265b#\241LU\025_<\367g\260\262\312\254\310\002\0011)\022#\350\023\022!{\247\0248"
+	.string	"?"
+	.string	":"
+	.string	"\252\335\221\303\030\3321\217\237\310\216i\227\310\216\031\2645|\\\260\237pa\200\004\326\356VZ:\370\t\372/\177\tG\241O\213\310\356z\206#\0037\275\355\013\333#\366?\002G\375\324r\222\211\265\241$\265K\240\345a1`\024\032\234\374\355\2774\306\035\036\340I\220\266&K\212A\206\325\256J\343\230A\2649\256P@\254\200\362A\375\264\177:\004\360("
+	.string	"\217\330\025?\004-k\363\242\365\263\300Q\262\215?\302\313\216\026^w\205\214R\373\2432\037:\303\201\205=@C\376A\331\311[\224D\004'\016\242\331\262\307\320\244\n\354_\273\273\246\242\375\361\277\002\033\257\363h>\216\343]\266\315\207\204\353|\032\316%\363\226\341\266.\2053\331\276\352uu\323iN\352\366uj\246\302\036\207\373\252\307\363\276\212\031\367\327R\321\030\311\324a%\242\001\f\272v\023\204\254\310\031\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceClose5KeyOSDCableConnection.44.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"E\013"
+	.string	"v\025OC \2518\035\317\300n8\222\230\224\204\345\205\326\201\374\022\332\322 \230\333Cl\222\225\224\313\006\360J\207L3]:\330\253_\252\001\302~"
+	.string	"\320=\030F\370\315\322.Q\277Z\300\230\241\034\377\204D\310\336)\0058"
+	.string	">"
+	.string	":"
+	.string	"\253\3351\303\025\3333\217\207\320\236m\177\320\2369\264)|D\260wP\001@\203\326\356Vjz\370\031\372/\177\021G\241O\313\307\356z\212\243\0017\275m\n\333 \3669\002O\375\324r\322\251eAD\265\033\340\205a%d\017\024\234\374\355\2774\306\032\033\341I\320\266'\213*\201\213\265\273\272x\346\216m\216(\021\r\273R\242\352\247}\324\027\204O\245\334a\267\224!/o\023\243\365S\300K4\214\237\301\313\316&b7\004\215R\373s2/\332\"\025a\t\320\220\347A\332\311O\230&\024@]\020\315\227=\206&=`\037\333\3355-\331\037\177,\233\317\363h\300\216\363]\270\315'\244\353\200\032\316E3\227\3518\317\244\033\341\300\372yu\343iH*\007vjF\302\037\247\003\253\347\373\300\212\031\367\330\322\2223\322\311\305\022Q\025\203\260]\003\036,r\006\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonPress.45.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\035\f"
+	.string	"\266\326R@ Q\224\016\037\242\302\310\005\300\265\243h\b\374\316~\202\tx\365xP\213\236h\007\321\345\235\355\377\310\305\177+\2751\023\0012Q\001\360@\370\224Dr\255mA\214\230A)\260\366\177\262\367\336)\005@"
+	.string	"B"
+	.string	"="
+	.string	"\017`\235\232\263o\374+\261\217\261\243\344\002dw\253$q\356SF\316\247x\241\317\016\227\263\300\tD\016"
+	.string	"\336h\032\240\341Q\372\3521\203G\2121\222\331]\307\316\343p\323\333v`\273\201}\b\001\217\\\005\b\202#B\270\253!\324\261\036TF\n\333\257\330\236\252\0136\030\310h+X\300\375\003\335\262\243\017\023\340.xq}\264\277\342(\356)\f\003,KZu\340\356w\361\001\311\251\277\013\260N%\001\273\357\342=\303\232\322\246\340\211\357\214\340\303\264\036d\350!\"B\030\322 \353R\302\252\006)\206\370\337/O\240\b\361\001e\022\305\320\376BQ\216\260?ww-O\366U?}\352\2374:\027\247\302\003\314\263i:\023\216\226}4\033\326\321&\226/\fve\026\260\t\327V\265\254r2\315\246^\233\247b\bX\353`[\375h\332V+\337>#\222\243I\211T\326\377\305\345\206o\254\004\177\213\263\320$\033\025"
+	.ascii	"o\231'3 \f_,l\026\201\352\330\033Dh\020HQ\215\313\213X\376&|"
+	.ascii	"r\r\030\207\241A!\270l\253\021}F\013PQ\304]~\252\275)\232\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonRelease.46.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\345\b"
+	.string	"&\221>90\345(\035"
+	.string	"N\030\246\245\323\200\210>\315\331Z\036.\357\211\374\321:\244\033\377\252P\303\034(\255y\215)\001\b\323\211\021\311\"B\005;\252\246"
+	.string	"!-\243\266Ob\245L),"
+	.string	"0"
+	.string	"*"
+	.string	"\235\013d\307\374\3312\217!{\025\016\f\224\327\356B\005\371\367\374\374\233\334\203R\235\236\034\205\335u\242T\033\267\336\266\201\355\004\3331\001\177bo\261^4\f+\273\251"
+	.string	""
+	.string	"\026\006k\021\261\375\217\355\214\023)\360i\237\344%\337]\024\004\001{q\222\301\262\033A>\350\034s\374@v,\251\n\237\267K\246\032/e\b\367M\031\350\251v\204D\036\345|\031Iyl\207\236\354xJ\375\260\277\331\335\265\256\354\307_\357\n\332\310\264\260\225<\021\311\223Y\013m\032\007\2615h\036\35488\342D\016P\363J0T\340\216\264y\360\241\353<\370\211\373\315\352\312X\213U3S\241\026\346\004\f"
+	.ascii	"o\231'\023\372\375\002'.@p\rh\205\241A!\270\f\214\bPQ\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getWaitingResponse.47.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\246\013\265:"
+	.string	"*d\024\026@P\346\316\030\333K\275\376r(\210 \215J\213\240\f\231A\005\322\311;\364\361\206~\335\375V\272\266;\r\bH\027F>M\3234\021\365\310y\253#\333\252v\304\316=3\323Hh\023)\245L)\245W\0017\001N\001\257Y\025Z_\035\340\373\276\024\204\255\246\314[\334On\271\267\270\375\206)\207?\332\216\374\275\257\223A\253\fA\350\316\334\315\316\262\325N\255\324\350\375Z\343\201\367\276N)V lu@\332t]\267\305n\223\223\355l\211,M\254\013\340\373:\217\354l\245\265Ua\033\327V\237\t/\271\333"
+	.ascii	"\232\230\226\224\222\214HGFEDC\305\2268\024\262\253\232\276\273"
+	.ascii	"\334*\236'\237\235\031W\003h\315\300\274i.\212R\316\231\366\224"
+	.ascii	"h)\205g\234/\205\235\301\265\322S\232\2729\265\263\267Nr\303"
+	.ascii	"{s\343]\247rim\215\344\244\217\366\224N\322\001Q\224M\334\250"
+	.ascii	"\367\224lwm^t\244\211R#\0211tzOy$\215\242#\245\310\322\207\346"
+	.ascii	"\272\330\317N\257\260\201S\027\250v\206\326-1\205\372+\023\250"
+	.ascii	"\367\224FR\2452\270\261~\026\361!\001\2653#-L\243\206\204i\323"
+	.ascii	"{\312!\251\261N\225\265\316k\002Q\224F\234M\241\210\244Jq\326"
+	.ascii	"\360\264fb\276\246\024\226z@zO\231\226v\2345<\375\fs\265\273"
+	.ascii	"\340:}-m\236u\354\314\200\364\247\017\376\322\262\020\231y\245"
+	.ascii	"m\331\236\226>\323Nf\366\345\316Vx\337\227}\314\354\254\331\251"
+	.ascii	"\231\033\0163w`&^\005\017\372Z\205c\340\323<cA\234\276\300\267"
+	.ascii	"\330`\227\027J\321n\3328\275\333\243"
+	.string	"/\312\214\337\362\031\271\n\370\276\362\264\363\345\202\334Q^\321k\220\302\367}!p\247i5,\270\335Ze\253\244\367XrmU\3007{\310-\2614\273\274\020\263\323\313\237\311\334\020\300\3365\374J\230Yg\007U\2543U\333578\256\316S\254\263\024\353\034\325\320f\250\325y\001\353\254\200uNPtFp\240\243\315\006V\347\002\254\263\200vv?\261\316NI\306\336\322\214Dt>j\235\215V\347\242\325\231\210\350<Dt.\016\235\333\325\231\310:\017\207\316\302\325\231e\235W\241\263\272:\247\254\363\263\316\276:w\204\251\276%Z\333\362\3538\337\262B\203^8\252\231\270\266\353\206vG\273\267t\312\334Q\3563H\267Am\246\363\230[\266\321\\x\301\233\233\r\346\226LC\271\361\306l9q4\027>\302M\301\301=\006G\177q\323w\210\363=\353\"F\360\234\035\246\355\270\357\270\365\262\245\243\271p"
+	.string	"\270'\313\272\367}[\035\334^\032\f\267\255\352\350/kb6\350\350.\034\035\360\345\f\317\202\275\t\364v\343Vf\367\315w\270q&&\274\001.\353\376\204\021,\304d\350\231O^x\250\024\213>\214\243SM\364E\237\316\021\341_\034%z\265\r\221\346\020\024\357\322J\t\215\365y\372\342\017\375J(l\351\345J\361W\253\370T`z\201\314.\225\036D\n\227\330\230zr\177Z\003N\374\366\231\3359\227n"
+	.ascii	"\330s\tj\207O\f\034>\025\330\231@\267\343U\205\370L6\355H\202"
+	.ascii	"w\270\374\360\t\275tA\207\004<}\365\331\027"
+	.string	">w\236\233\305\202\367\030\263\317\365`@\270\204/V\004\337\"\217/4\240\027\177\2560p\273\305X[E\360\235\327\316V\006\310\031\272O\214\244\276c\237\360\207\315\365\331\r\375\207\\\277\2714i\266\036,!3\207\316\343A\250\276S\364?}\037#6\310\037\372\316\377\334\234h`*\345.\214MU\343#!W\377V{\332\t\321}H\024\376,Xt\256\0308&\272>\223\031t\177\326\323\r\263\210\246\303\3219&H\364\367\263\335\355M\311\237\371#f\220\372Lf\371\342\276@\235\333]eXi\276\201?\360d\314\235>3\332|\256T\337XG\231]\271\336#!\241\357}\337\b\255v\224Kt\234\023\0019jX=\r,\020.X$5\340H^\021s\324\270 \203F2\213\245\341!\031\003\306\210\032W\311\254,\033VCl5\225\264\202q#\351\302*\353\210\005\343x\005\203E\214\243U\026\215\343\024"
+	.string	"\306\222\221\314:\326\300\302\312:\266\316\256f2>\247M\306o\333\350\304\240\305\226\323II?\203N\031\370\327\365^l"
+	.ascii	"<\375\321\177\240\247\336\227\013\272\234\2641)MZ\353\321\267"
+	.ascii	"\236\247\037\023\255\243^b\247\237\017\2408I\230\224\216\317"
+	.ascii	"iz\340\215O&\247\215L~~\\~\370\374:}\337\367]2\266\234\226a\245"
+	.ascii	"\231\004\365\307'c%\2503\241\314\256\233+\201r\t_s5(\005\277"
+	.ascii	" \205#\361#\n\222\022@y\205\247!\205h\t\276\361\214\317\344~"
+	.ascii	"27x\304\240]\314\2711j\360UO\306\354\340\213\020\251z\007o\""
+	.ascii	"\r\215\330 \325\013A\016\261\005\351B\215\\\243\236\352U\244"
+	.ascii	"A\303\226^H\317l,B\234z\216^\t\033\233\243k\203o\362A\367t\023"
+	.ascii	"\325S\337\340\253\320\366H\375\324w\n?3\223z\327\307\223%\026"
+	.ascii	"\3018.=\243(;^\341e\356#\352\373\256\275\351\003\311\022K\263"
+	.ascii	"(\312\215\317F\317\315\234{\003\377\276\236\313\031\206\tH\344"
+	.ascii	"\266\255F~_.\330\304\311\3346\023F\001\200\336\250a,\004\031"
+	.ascii	"ThFDD$I\222t\200\002\021)3v\022 u5&5DD\026\024\266X\377\016\201"
+	.ascii	"H\232\326\226\276\2271\025:O\202\301bD\\\363I\024a\013\322\244"
+	.ascii	"W\256\017\316\322g\303\333S\354l_h\303\311\3428\230\247w\245"
+	.ascii	"\264:]\372\335\034\333qL$\241\225f0~\"\315\316\0242\033\025\363"
+	.ascii	"\2210/\213\251\303\272^\356\215"
+	.string	"L\013#m\262\033\214\003\n\030\375v\033\214\245@\027\306:\351\255A\206\211\202,\310\350\345\217\256>V\314\213\304\316!\255\370A\334\023\202HfE?0\221\243G\343\376\274\316O\035\266\341,\351\205p\265Lz\256J\r\257J\323]\332\273\016\b\352m1&\035\371\210n\327@R\331zX)\340\257\013\254E',\207\326\3207\200c\0321O\367\375<q\327\3348\314~\304\254\221\200uh\fk0\3339\0047J\013\307*,@\334\022A\326\234M\353\303\241\360\007\317c\260HK'{\b\2244_\026\333\222\016\374\355G\nA%\313\315\027s\344(\323$)X-\217\240\265#\177\336\343\305w\202\366Y\275\222>\214d\3742\251\3709h/\200V\372\322\267!p\366\307\270\216\260\362\033F\3603?\336\207,ZlO\004)5u\324\001\205\026XH\243\313E\366{\205x\226\351\202\327\\3\365g\351?S"
+	.ascii	"\255\371\231\321b\221\321\255\267Qo\202\315)4\bY\200\224\373"
+	.ascii	"V\363\035\210\346X\330K\r\360\365\244@\244O~\265\253\323\270"
+	.ascii	"'8_' \350\260_w@m\301\324\032\373t{\016O\\\0208\001,\023$o\030"
+	.ascii	"\321\325\210P\231]D\034\037d\034n\3103\335\326WOjQ$\240j"
+	.text
+	.section	.gnu.lto_rcdeviceReceive.48.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\366\n\345:"
+	.ascii	"\332f\240\026DP^R\007\223{M\031\017M\034\316\270\261\350\250"
+	.ascii	"\243b\321>\251\333\337q\364\204l>\225y\325\270\257\003\334\227"
+	.ascii	"^\247\312\301\b\021\n\034\333\002^\200\022"
+	.string	"\037\005<V\240e&-\"\036\204\333\270\333\336;\311\224\002]\001D\001U\001L]{g\023\\g\263O\373\355\226z\027\330\327px\214\365\024\006\031[\323\027\307R\004\316\266\223\353lK\335\334\355g\216\006{\232\216\026\306\361\227Z\\\034K\025t\001\327\331%G\266\316\256nl\235\205\273\353\2704,v75Yl~q\034+\337\211\007\372*\365&v\322\303\216t\224d\204<\032\211\206\204\202\200\212\30479\024\272\301\226]?\303\355Ee\232p\332\266\252\034\351\335j\346\243\365\327\300\330y\365\271e\225\200V&\346S\263\234\204\305\305\305\215\202\024\340|-\363\312CF\361c\024(\331\2706\365y\251y\3659\266\276@\252]\034\256,\023=\361\241\325h\344\355\215W\237O\326\004o\254\034q7\261,\024\024\266.\221=\223d\240 \005\001_\\a^\\\203;\200H\361\352\323k\205\320\247o\316\351\\"
+	.string	"\331\023I&\006)4\341\352\362\327\255\272<\271:\250>\241\353\220\354y\226\207^}\2269\331\363H\026\206\300\353+s7\370ne\345v]J\223\227\025"
+	.string	",\311\237\223=\213dv="
+	.ascii	"U#\004h\013kE\262a2\347\335\332\221\327\352\323\310\272\344\346"
+	.ascii	"Yk\353*\277O}\315\202'=\373\373\342\342\3429H!\216\343\316\316"
+	.ascii	"-.o%\357\316nw\217\350\026\376\bk3\333\377\345\224\357*\367\351"
+	.ascii	"n\020~\307\374g\331\364\374\025\345\374\335$Jdw\032\370\245\253"
+	.ascii	"\257\352\356\023\216F\206\322\336\231\034(\234\366\250Zg\363"
+	.ascii	"+\361\265\n\267\243r\3438vj/\003\223\261p\241\340h\235\365w7"
+	.ascii	"\317wS\300\240hiV9\360\305x\201\325\375G\273\245\315\354N\325"
+	.ascii	"4a\375`\335n\356\b\020\334\334\017\234\352\355\364\346nrs7ps"
+	.ascii	"31Pz\233\267\001_\363&\340d\274\225\222A\271\223\202\271\221"
+	.ascii	"\332\334GA\271\215\200r\003(\346.\"\346F\276\271\217nn\343\233"
+	.ascii	"\233\350\315=\344\346\026\022\346\016\032\346\006\022\346.\272"
+	.ascii	"\271\211n\356\327\315=ts\013\205\271\335a\356\240\307y\267\302"
+	.ascii	"\334\254\233{us\1770wns\273\004\007T\240]cw\017G\032\003\t\364"
+	.ascii	"\023\347\261sS\234\352N\306=\316\275\315}\255\333\347\332\351"
+	.ascii	"\310t\235[\365t\341\250\316>\021\356[\273\\\034s\271\027\346"
+	.ascii	"\314\317\203\213qj;\\\277_\340\033\376\326JX\300\240g\356\245"
+	.ascii	"\335\255\231\034\300\336Vc\251J\032\003Y\201\027\346\314\257"
+	.ascii	"\303\215\366/\036\246_go8\030&o\032\334\033\316\326uKW\322x+"
+	.ascii	"W\324\246|q\262\350=\001Z\211\311o_\253\273\350\273+8\037\013"
+	.ascii	"\3110\252\023\017\362\213\332G\276\313\371\205\256=>Yt\315\342"
+	.ascii	"G;\250\355e\360\316''%\211\300\225^\313\351\\HG.\355U\276\313"
+	.ascii	"\271PO\016\232t<O\276\226\322\037?K\231\342\031\377\370\256\207"
+	.ascii	"i\374\005b\356e\321$w\210\t\\\351\031\274\373\355\331aA\363\320"
+	.ascii	"\023}7\006\r\331\235\312_\332\361U\235|\242w\241\037\372\277"
+	.ascii	"\313\002"
+	.string	"l\207\323\202)\364\256u\004\350\213\037\364\256\364@\037\324\273#U|\247s\005Y\330\036\314J\313\222\367\243\355~\374\332\213K>\030\321\016\361\203X^\314\032\360\f\265\317\360\243\375\376p\203\323y\377e\0134K\033\276\034\3461\314\235x\234\215\013\177\370\257\007\013\332\314\201|L\341\263;\376\374\245\031\370v80\230\311\275v\251\326\331&\261\"\301g\337\375\247b]i\346\300\376\017\376J\315\002\354\340zR\354\263\177\214\344<ss\362\204C!\320\370\277\332\246k\323\262\307\355:$\031\333k\234\244\371\n:\236\257_\334\262z\332\230,\323\366\315k\264\006\236X\235\306\271\312}\274\251wM\224\260\037mwf\273\276\177y\360\274\365\203C\366\374\271\033\270\271'\001Q\376\264|\372'\2671\343\351\251\246>\274p\001\225\241\006\024\214\241\215\031\026bPA-\203T$\240\244\242F\314\200\001\265\\2\237\212\375\264"
+	.string	"\352)\212\006\324\213\247\245r*J\t#\312\205\224\362iI\245\\p\324S1\240\226\312\031SSK\345+\265\362\007c\353\244\177}V\337\034C\372h\303^m\322?\236)\203\214\264\004f\222\335\231\364\036\250$s\311p9\240@z\327\313O\252\243\367;>\3776r\326\302\034\3259\201\017P\205\247M\034\005\331\350\273a'\260Xv'\201_:\220\273\341(\360\224\354N\243\367\251\013\321\320\342\277\276\346W\265\373\032\307q\234\364Q;#*f\200G\004\376\302\f\317\350\364\020^\253;\302\373\320\202\360\021\336\204\227\335\203\357\301,\206\361\btf\313\364\017>\205\327\030,h\023\371\321\24615&\307\0073z\327\265No\364\203\313\024/\2017\275\3233u\331i\360MU\362U\263\301\303?\250@\321\366\312"
+	.string	"\262\031\231\336\267L\371\234\332\260\225\\\305\f\3141\214\245\033\326\002\233ew\302f\255\263L\357p\236\323~(\201\242\021\r\310\004\276\001|{\224L\334_\237\0313bm\206\034Vk\001\274\177\241\271\037X\r\300\267pF\204>j\241\375#\362\346\227\307\001\022\262\272 \342\224\200\316\250q\034\346\220cJ\221\210\004\023H\222\2445p\002\221)\263n\0210\271S\214H\244)(Lk\362\220\277\355\347Y8\3473s}\352\216S\004r\352\240\241\001<\005\362\304\250n\036\322\374\013\360\223\257\356A\254\260(\275\037O\030\214-\360\330\255$TE\rK\356\206\032\200{{r\034e\0227\337\250\t\3471\246\343\343\332\333\021:/\315\210\330\265\371\260\371\214\006"
+	.string	"O|\022\321\321\322\303M\204\374\016\fV\002\347f\333\244i= \236\365\203\n\257\255\rg\262\361\345\217\314\001\241@\037\317g\244\326\340\310\362H\026g/\226\326\324\234\256w\035\307k!\033\224{Q\336\304\201\262g\246-M\036\250|Dw\207\257\177>\261eP#H\222\345>#\355!.%\200j\311\207\373L\005|RU\233\222}4F\2473\216\203_\016c\267\240\252!Nh\377%\220\036}x\255\002\344NoV\267\265\214i1\260\230\356,\201\223\272F\ry*\235~^\370\303\3605Y\036\256E\005\324\353\034\310ExI\335\307-\f{P\200V\020\r#l\367\306\335\371\340|Q\2520X"
+	.string	"\217s\271\241C\006u\306+',\013\227E\202\211RG\215\270\362\353l\251\331BN"
+	.string	"aQ\310\331\245\366\203!\360m\023T\333=\343\322\216\2017\007\277~._n\002\223A\376\275\364io\2748\b1\256\r\336[\t\243\335\035B,\243\021D,O\300\205\323U\26697+\0339\034\355&\002\263\034\017\306\371"
+	.ascii	"\324\353\334N5~\240H\334\330\246 \f3\031S<9,yj"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.part.0.65.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`N\001M\r"
+	.string	"\346\226SC"
+	.string	"q\234\016\253\tk\340\232\025T\253MaL\275\334\302\220Hi\247X\337\213\3768\227\365\234F\203\230q\216\025\002\320?\200A"
+	.string	"\376\377\377\237J\273+\367J7g\230\351V\245MS\300\210\326v\267\275S\n;"
+	.string	"B"
+	.string	"C"
+	.ascii	"\331\251\307\233\324\323\354$\365\324\376\t\333\237\220C\333"
+	.ascii	"\306G\021\213\2115,\240V\273\253\235\316\020\017?\345\025\372"
+	.ascii	"\022>?2l\270\034\371\205av\327\031\207\233\3366\001\333\005\354"
+	.ascii	"\307\b\213\241\245c?PU\211\237n?\305\307G\271b\373'\023(-&\360"
+	.ascii	"[!\344qA\314qcw\264\234Z@vZ\261\224\037?\343j\bYJ\373\244\227"
+	.ascii	"\302\243\360\234\210,\005\223\207\324\3568\340\324\001\002v\202"
+	.ascii	"\273\320\224\330{\013\006 , l\300z\212\311`\215p\330\r\276\002"
+	.ascii	"L\241\261\273\006|\025\021\034\370#N}O=\225\363\250K\022\035"
+	.ascii	"f\210H%\220l\311)z^\327N\020\267\374\370\037\003\300\n\021m\334"
+	.ascii	"\326u\270L}\300\331\246\267\013\267u\035.\263}\232\327i\n\272"
+	.ascii	"\003\032m\3736\332\005\305\336\002\356\3238\236\367i\225c@s\202"
+	.ascii	"\347\234\342\271jo\207\301Q\325\216\021\366\256\332\b\236\352"
+	.ascii	"^`&X\253kj& \200\202!B\333\001n\005\360\2713#\330H(\335\316H"
+	.ascii	"X\270\321\001\270\204\206\301\227\222\210n \353)\265\003\335"
+	.ascii	"\016T\236=\333\002y\035\341\037\246\230a\341\330h\266\"\312\356"
+	.ascii	"\220\204\371\002\205\251\321\334E2\275f\251\315\264[`\344\274"
+	.ascii	"\262,H\274\346\350\233~B\037\003"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.part.0.70.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`f\007\205)"
+	.string	"\252F\230\017D`\246Q:#Y\331T]\362\032\325\314\225~\240\377G'u5\301^\024\232\200\02220\376\211\365\177KM\265\342Ah\364E\303\241\266Y\217\270[r\263\253L\320I\322\347\307\315\260\315\264F\032!d\357$\003\331"
+	.string	"\335"
+	.string	"\350"
+	.ascii	"\353\3235?\213u\263O\321\276\230\260\277\346l\336\246Y5\302\260"
+	.ascii	">X7Q\020\036\354aW\323l\232\251g*d\316J\253\221\232\b4\301\245"
+	.ascii	"aR.\376q\333\302\260>m\242\320\376Lp\315[85Zoj9;\231\236v\204"
+	.ascii	"\265\357\275S\350\314I\220}o\367\275\336l\377%D))\033\301\240"
+	.ascii	"\214\345\354\224\360\264\035\254O\333\371\002\352\323\365\003"
+	.ascii	"\324\247\3357\323\335Bd\267\335\205\356df\234\026\234\252\260"
+	.ascii	"\266\234s\357)\326z{\234\232\242\370\256m_\227\034\036\327\344"
+	.ascii	"\352\317\256\340\313\034>\177\330$\261\236\336c\222\311Q\244"
+	.ascii	"d\021t)\347\314&\215\027\243\020\226fK\220\222E\264\300\236+"
+	.ascii	"\203~\366k\225\244\272W\300W\234\206\234s\237\350\344\235{w\023"
+	.ascii	"\351nb7\016F\3473D\252\277\345i_\210\372\364\342?\177\225\313"
+	.ascii	">K\257&\361\276]\234\325x=\2321\226n\364v\200\334\355$^\3566"
+	.ascii	"\322Nw\033@\3566\233\273\255Co\347\330\333+{\033\307\336V\331"
+	.ascii	"\333\251\3566\232\273\215\321\333\367\316\377\013\036\034y\313"
+	.ascii	"\234\221\2749\312T\322\247\227\263\371\327\374b\277\234\337\354"
+	.ascii	"\027\251\247\177hv\342d&\271\320\245\326\325\226\215N&`\377\224"
+	.ascii	"\234\314$:\254\257*0m"
+	.string	"9;{O\327\356\367\361\334\254\177\326\354\035a\002\345X\027\227\217\2235\002\256e\224\234\263\217\376\035:\257\343\343v\272l\311\350\314\311&\345X\327\214\365\351\022\272\013\203\210\013w\210\rx\262\316\221\245\265\365\337\334M\377)G\3701\251\253\344\314C$\234\307i?&\305\242\n\217Z\316H\024\001\255\226\372T\207\277\256\266\226^\315\034~N\371\271\305\034\316)ID\246\331fi\2650`\346Ll\271\374\331z9\262\251\347\210\265~At\\\303a\025\257X}C\265,\272=\302\341\207\005j6\270\335\255\230v\314\375Q\305\021\220\224\241\025\361\260S\334\335\222\371\2635\203\ty}Q\373\325\226b\366\020\333\242f\272!G\306\306\305\206\342\356\016\177v\031zv\\\303\030\305\257rk\017?\364a\315\331X\241o\350k!D\220 \241>\305xG\226\266\250\371\267\007\325\356\022\177\006qdi\\l}B+\020"
+	.string	"\312\231\370c_\320\007\235H\261\342\376\270Bm\361\347\013\003\314 ^iG,\001\367\371\215Ge\372\311\376\024B\200y\354\226A\203\307\205F\205\207\315\273\027w;\371\356\217\275d\304\303\356\306\361>Sk\316\271B\007\235\003G\017\340\317\204\216\247\032*\246|<t@\242:\370\200<~=\200>(V\235\372\215@\002F=q\310\201\343\t\204\017J*\252\206\357\006\017H\224\023n\247\t>\247\247\037>\033NP\275\337S\217\307S\215\035='(`o\302\201\376\365\360A\365\242~?\250\036{4c,\255\201\210\2138)4g+\031\324\316\270m\021\313\330JS\270\177\013\320\244U\026\301\303'\001\246\240\2518\253\277\025\006\016\312t\033a\272\340\035\346a\253\356$\354\244\t\017'a\027\3127$\314$\270[\362\343\032\021\t\307P*\242Z\026\3233\031\251\215\241\030K\227\251;\254t\225\026\341"
+	.string	"\360\0167)\351t\337\270H\251\002\026\240\\$\255\224]z\004=\263z\302b"
+	.ascii	"S\356"
+	.string	"\225\025\213-\\\241]9\210\366T\3018\253\007<\250\352\360\313\200\3451^F}\263n\253\\#\301Ku\253\332+mV\253\025\200\234\250\2018\305\024SjFFJ\013\222d8p\002\221\242\253n\022\300\226E\352\024\315\204\205\265\265\237\001\214G\017d\250\025\357\274cj\272I\312k\312\360i\371\251\225hI\322ibm\264\227$\340=\331\225n\214\203p\b_\323\327s9\326'/b\177\350&\251p\032C\251a\302\n\231\r\035[\212\364*\320\251t\251L\250\273J\323\204\"\301\243\214\362\351!c\013\240i\363\361c\365\254\335\347\275\303\230\021\370\257\272o\316\226\230/\366\265h\022%\352\2358u\244\005KB\212\3635\226\3501\303\235\373\303K\301\241\006\305\241&\243\3479+\242\237\310\363gu\324\335\307\324\200\307\360\356G\"\2413$\366\b\276r\2111p\372\367\311m\352&Ok\326\241`\310*\317\351"
+	.ascii	"\021*\035\303@\024\212U\334){o0\177lh\006\315\267\310\212\230"
+	.ascii	"ri\213\027\316?b\001\315<\f\222%\275\261\007\021xq\247R\215x"
+	.ascii	"\032lv{\027\235\202\310;\034\304\235\r^\357\307\034\376rG\221"
+	.ascii	"\022)\032\313)\211%\254\220Y9H\236E\305\302\203\365\350\bD\220"
+	.ascii	"\255\246\355\311z\333\r\210\366y\024\201&\311/\377\211\273\377"
+	.ascii	"\f\030\250"
+	.text
+	.section	.gnu.lto_runcamDeviceSendPacket.part.0.71.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\271\003\355\030"
+	.string	"\026\354\231E\260\034'\035\034\276\313\252\025\215\265\303\001FJ\222\004\032\361D\312\243\036\346\205\316\035nmu\004\025\3613\222\226\313\232IiH\337,\353\234\217Z\350\226\356\372\022\n\212\227=J@\273\nH\370o\304\222M\266L)}"
+	.string	"\200"
+	.string	"\212"
+	.string	"\246P!<\024\032\357\331\24219X\252\037i_\032Z\215\273\303fU\373O\256\024~i\350>\273E\320<\355\216\022>\375"
+	.string	"\374\364\370\002\337'\370\001\337\247}'\266i6\207\266\232\217\270M\021\201s\203\311\315\356\262>\245\221\207\237\236\324/\364\211>\305\233\217{*\336z\\z\013\306\204Y\002\340V\363\032\374\020\342t\335\025\307\255HU\300\277\224\206\3355\210t\247n;\205\355\022\266\367\006\325:S\255\362\324\340\235\376\324\243\374\237\247\236\317\375\336T\313\224Z?\376_\t\210"
+	.string	"fW\307\2348\033d\352\222<\313\355[\241\371:\357d\241\375IHW\343\362\260\375\312\261\204\177\022\372\036\331TR\214D6\273\266\b\237\026\001~~{v\234h\343\336l\366\246\234J\370&Cy=[#b\345iw7\200\237?\336\324Ga\232M\246\331\252gk9$\027<}\316\024*\320\306\325\341\251\003)x\232\230\354\216\256719\272H\231d{\366}r\325\343L\316LM\337\330G\247\374\361\344\224\020r7\344\370\350\253\334P\337\265\\\247\002l\271\364\242\265\t\310\316H\022YJ\373\005fF"
+	.ascii	"\327\345_h8\300\360\351\345\205\002\234\277|\237R\222\300\255"
+	.ascii	"\021\221"
+	.string	"T\332.\256\233\361\340\322\210m|.1\002D\2116\320\241^\030\210\332]\013[j\300\374#\237\376\320\367\251\362\272{J82\"\222\r\235\2432\311\362\273\267\262\210\003-f+d\320\013\004OKF\253\003\254%k\301P\261\bj\301`1W\352\263k\302\313\0054\343\305\302%c\305\200XA@-\030\313%\023bM@\340\030\214\227\214%#\026\223\261vl\3535\330\220ES&\331\026\362v\207d`\003E\347\330\201\202R%u\244\0356\t\235\034I\242'_\023\003w\327\202\216\3242J?\0338\350E\225\274\222 \013\324\303\007\275\bJ\035/\273\232$r\0020\304\b\250\335\001U\311 \312\304\211\245\235\221G@S\362\223(\002T\250\2010\307\0303\301\f\005#\"\263\244I\007p\002\031\273\261\016\021\2609T\265\245\255\031A\350\332\356\344E\334\303P9-\214E\306\001\"\211\316\240\262\r\334\234P"
+	.string	"\335 )pAe\340\027\t6!\263\254Q4j\205\216\276\315\236\214%\030\300\365\345\223\037\005\367\230\256q\264\217\225\307\326\275;\3203\210\002\001iT\224\337\242a\221\030Z\270\021\247\2619p'J\325kr\245\177"
+	.ascii	"}v\272\374o\024\020\375\335C0\324\027{\347zl\331`\272D\220v\320"
+	.ascii	"^i\211\253\237+\222\373\273\237}%!i72u\373\201\020\245\266\230"
+	.ascii	"\255\",\r\360\337\215\247"
+	.text
+	.section	.gnu.lto_.symbol_nodes.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`#\004U\023"
+	.string	"\206\235rK\300VQ:\324\310Q\274\314\375v\240\2240\371\322B\001\352"
+	.string	"o\361\200\342\377!\272\314R\t\204\373\023\333 m\3356EQ\024\246\272jB\214\020\3434\226\246i2\343\"\270\210\3704\320\257\353\340/\233\354\327\224\034\226\020\222\210\224\001`"
+	.string	"`"
+	.string	"["
+	.ascii	"\265Vp\241\023\204h\315\361`0\030\354i\004\263\\=b\241\035T\350"
+	.ascii	"\003!\217k\334*T\2004v\232&\324\351=\"\320\006\302\275\345\300"
+	.ascii	"\340\320\306\3572\256\312b\306\233^\037<#\233\226\311\210\265"
+	.ascii	"\326J\353\345\261\362C\310\214\232.@V\024\2558v{\027H\013\246"
+	.ascii	"\0215A\231\365L\270\273#,?\341\\\342W(\213\267q\2504%\211P\370"
+	.ascii	"\257R>\375Hq\342\302g\034k_\343\037\025\311\001\265\366+zy*\032"
+	.ascii	"B\212\216\200\242mN4\217\211\336)\321:$:gD\343\210\350\233\020"
+	.ascii	"=\001DK\370\3205\036\232\002\327Zwa\035z\306\034\306\361\207"
+	.ascii	"\204hC?\320\320\r24\003\f\275 ;\016\231\374\330`\324\001\240"
+	.ascii	"\374\334\213[\211:\243&\313Y?^\":%\035\245\371T\312\333S\262"
+	.ascii	"{2c\336L]\346k/\346ck\236S\006\302\224'S\016\201~,\214\304\224"
+	.ascii	"'{\f(O\002_%\254\374)\225)\177\002\272\224\267\361.\t\262CH\\"
+	.ascii	"y\017\213U\274\317\213\030\333\n\342\365\371\212\226N\021\226"
+	.ascii	"\362\227\232\364\220X\347_;\324\371\327yU\312\234\2427t\262\363"
+	.ascii	">\374$\031\351\220\326\371X\313m\314M\272 \222\271\022`\0068"
+	.ascii	"\331c\036\202a\204\262\352\274\343e\212\021\245W\252N\242\314"
+	.ascii	".j\334\212XRg_,E\223zK\020\207\274\244!&\224\230\nK\250\241\020"
+	.ascii	"B!$#\023$\245\305\306\340\002\031\232\242\007\021\300\220\207"
+	.ascii	"\0242\321\211$\230@H\341\001(\246J6\275{\251\316u@,\243\315b"
+	.ascii	"!\366Bj\362\257\260\242L\315\314\026!,\215\024)\354\212\2211"
+	.ascii	"\243\007QZ\364\0043\025\021\017~\353W6Q+Q\242\005Y\021\221\354"
+	.ascii	"&\266\266\272q\373\314\300\315\203\017\357\342^`y\021\360G\001"
+	.ascii	"L\365\366.\212\302\316\256\310\320\367\326\033pED\375\001\320"
+	.ascii	"\361?\217B`3\260e\200\342\342\330\370\373]D\233F\311\031\267"
+	.ascii	"q\320=\007\220\n"
+	.text
+	.section	.gnu.lto_.refs.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375 \233E\003"
+	.string	"\262\t\031\035\2007Ic30\00330\027\034\204f\346\327\241yB#\366\260\226\370&I#\204\354\024+\254&\25466c\005N\204\225\007\333`7V\031\253\213\255\330\307J\263k\017\351AJ\203.\324`.V\025\253\005\253\211\215\330)y\311\346(\t\231XE\254\022\254\016\354\200\r`\312\003:\241\021\372\034\345\244/\004"
+	.text
+	.section	.gnu.lto_.decls.181c095bd85053e4,"e",@progbits
+	.string	"(\265/\375`\211<\325\374"
+	.string	"\272|eTW LA:\351\252?\003LN\231\314\261v\277v\272G\347\3477i\222g\364\353E\344"
+	.ascii	"\360f\216\222Y=\225\316*\254\347e\206\255\230Za\001ZS`\230\003"
+	.ascii	"(p\217\337\243m\277\253\024\306~\273\362\360\363\364YZ\255\375"
+	.ascii	"vU\337[V\314\021\351\236~#{\313\235\002\205\0046\005R\005l\351"
+	.ascii	"\257\263\251h\254dY\205\341\230\2724\322\337\030RQ)\321\334R"
+	.ascii	"\224\216j\033{X]\352\032\327\230\371s\206yk\374{\224^\004,6\214"
+	.ascii	"\b#e\005\304\242\366\354\227\245b\2550\211\335\b\354\344\022"
+	.ascii	":\246;;\306\356\221\211\315\260F\376\020$\264\262\231l\337m2"
+	.ascii	"e\310\252\262v\232E'\275\030R\022\241i\245\270\240\313\001\246"
+	.ascii	"\264G\236'\302H9cD\247c\247\225=\324F7L\231.\031r\361\325J+\306"
+	.ascii	"\206\261O\250fFf\020\263!c\b`\277h\030=\243itS\313h\250v\352"
+	.ascii	"\030\326\331\312Vz/\265\213\017:\027\311jhy\001~?\323\340\355"
+	.ascii	"\332I\372wR\267(\013\313r\327\304ZW\320~4v6R\037\275\231s\016"
+	.ascii	"\202\321\345\200s\246o/\242.\302\351\262\264\245\216I\224\325"
+	.ascii	"\310\232 NL>\242\322\316\307\316\245\315M>IAk\374\216\221\276"
+	.ascii	"\225\322\367P\nF'E\246\341qIw\364\354\336\027\334^\316\315\235"
+	.ascii	",V\313\315L\316Tq\314\234\345\272X/\366\213\345b\235\026\320"
+	.ascii	"n\271\275b\355\256\323\314\231(\347|\021,\240\375\263Z\354\263"
+	.ascii	"\f\205)Q\366r\226\273\b\377\016\240\345\263~\267\t$g+\251\013"
+	.ascii	"\252\332\232l\001\346\334\374\360A\347\303\007\254\007\344\b"
+	.ascii	"\223\f\370v,\275%\222\3665\235\024\245\241\374e3\246k\f\030\346"
+	.ascii	"L\235_TYV\232\367\304\2619\342\252\200i|K\225\336F\245\177Z\016"
+	.ascii	"\301\034\030\251\325\261\033"
+	.string	"\202!\320\331*s\270\310\211\223\034\215_\002\272\271\340\234\221\234D\356v\016\247G\0239\253\306\366i\323\002\233Dak\034\224\276i7\004m\024+'\227\205\255\361=\220\336:m\034\034\315\215*Mn\274\335\302]KM\316_9g\rn\210h\275\345\306\326\315\266\341.ZXPl\032\0328\345\016Jc\253f\3332,Az.\033\333/\313v\217\224\226\271,\347\246\206\333\302\310\026\264\306v\315:\261\316\016\366\311C\220\360\213t6\277\230\230\262\226\215_\"}\240\355\020\264KlZ\252\005\343lIckf\317\254\263\003\313\344\266\211E;\232l\346fg\211Q\"\3268\307r\b\366\n\351m\007\301\033\030h;\bZ1\253\244\265\322\234\314hl\307,\022\353\364`\223\334\222\331\262\317\0205\363X\316M\234\232\344S\023\271\306\033X\016A\034\201\364\326C\020\307z\b\376\357y4PvTMi|\033\366"
+	.string	"\314e\022.\200\364\032\322\264g\323r\b\246vC\320\370\3667\321\355\357\020@\371[m\373\233\207\355\357\016<\371\355\216\3376\340\311\017\360_1ZR \324NZ\255\204\377\322\341\374\227J\216\031U\307X\222|\210\037s\300\004#\020\242\322@\311\337d\377\340\307\005x\372\343\02648\315\217-0"
+	.string	"\bt\300\f\370\355]\213ip\301\217w\032\311\371\333&\255\f\363:"
+	.string	"~\234v\363\267L\177\037\371\355\322\377'\r\366\n~\034\200\3372\300v\200"
+	.ascii	"\007\3746\001|G\300\337^\227\310\337\r(\322\\=\201\347\374W\230"
+	.ascii	"?\363_)\277\r\323@\354\215\337B\375v\371\333\251f\376\026\005"
+	.ascii	"\277\205\341\357\037\177\353\370\355\212\337j \307oc\370\255"
+	.ascii	"\320oO\360[\023\374\235\001\254\337\222\340\267)8\376\026\371"
+	.ascii	"\333\017J\3607\006p\374\326J_\335\003\377\305\374\275\354{\004"
+	.ascii	"~\274\241C@\375]\202\214\337\232\320\301m\376\313\004\310o\267"
+	.ascii	"~+\344?\3761\006\177?\375\335\364w\213\277\363\337\307\277\213"
+	.ascii	"\177\277\3607\212\277A\360\267\007\376.\361w\013\177;\340\357"
+	.ascii	"\005\374-\302\337\037\374\355\301\337\035\374}\200\277\007\360"
+	.ascii	"w\207\277u\376\336\360\267\206\277m\376\246\371"
+	.string	"{\346\267c~\373\367[\277\337j\371\255\336o\361~[\367\333\261\337\252\375v\310o\347~\373\374\255\210\377h\277M\3766\002\377\313~k\177\213\376\327\373_\345\267S~{\342\267q\277\205\362\333\266\337\372\374\377\371m\212\377.\374\226\355\377\006\377\371~\033\364[\002\374\326\370[\r~\273\366\333\257\337r\375\226\310oy\374\326\352\267N\277m\372o\342\267\312\337\"\375\366\350\267,~k\364\333\242\337\022\375v\350\267*\374\357\373-\005~\233\302o%\360\333\016\377;\360?\356\377\206\300\300\300\300?u\373g\236\377\207\260Gc\271)\027\3155\331\334\244Bf\242e\326\220\211rr\203#\"\252\246\243\261d\223\206\2431\252\246<F\225s2QR\211D\224\225\032\362\030\025_\036[6\345\034\215-\233\216\306\250x\3302\244--\247\272\345\225\231\r;\"\312.\226l$\2259\317\243\3462\333\345l\313\214\262\222"
+	.string	"9\333X*\355\2222l\332\320\323\305\320Yri3X\032\252Zf\242\347Q\220e\316A\206T\344\245\021\220\315g\326a\237H+\033Y\311(g"
+	.string	",\345\214\264\371\231sF\346\234e\2246\2329\323\3109b.-\345\f\245\263\224m \325\214r\356\262\273\264\246\243\261\252\345\216Z\2221ff\321DZf\266\243R\246c\310\260\254\344\2272\233^\364\3359\373\256}\250\260\244\246Tz\360_(\355\003_\3310\252\322\306f\323c\3139\364\304\272\230s\"&\206\223\265 \215\276\250\260\306j\3017\345^\206d\332\3442\271fw\311E\273g\326y\323.\331o\231\305;\276i\315t\221\fe\331\273`J"
+	.ascii	"\231G\232z7\355&\301\333\273aN:-iW\314\001j?\202p\341\324u){"
+	.ascii	"\273\301\237YKkf\216\244\237\321J\357\230\035#\3231S#\375\fR"
+	.ascii	"\372\264K\372\262\364\231>\215\203\221/\266\246<\276\306\267"
+	.ascii	"\310\365\262\316\373\225mh\256\322\312\222\215W\310\234\255\353"
+	.ascii	"y\215\f#\362\306EDl\256EW\343_\"C@\220s\031\226\201\324e\244"
+	.ascii	"\261\020\035\fP\035\355h\374\324+\275\b\235g\373nn\316RoZ7\210"
+	.ascii	"u\336\255\313\274[\027\210\355\223\311\232\252r\002\f\022M\275"
+	.ascii	"\340\022\304O_\244\227\321\222^\037;\277?\032\220eU\244\361\355"
+	.ascii	"\361t\005\317\253q\326\335a\235\227\307\315q{wu\234\341\260~"
+	.ascii	"7H\r9[\031a^\036\027\313\3729\311\2205\307\200\r\211a\211\022"
+	.ascii	"\304\266,\275\314Xz\231\346\325\215\232.\255\034\312\257{\343"
+	.ascii	"\306\360ac\007\023\215\006\017\346\275qkd\355\335\260|w\306\206"
+	.ascii	"\242\036Vwy\251\356\324\255\262\316{\343\277QWJ\007\347\212R"
+	.ascii	"\21515\330NY\240\224\341J/\303L/\203#\375\235\361_\030\367\351"
+	.ascii	"\016\325,i\232O\245\213\306W\306\316/\024\215Y\234\230\037\215"
+	.ascii	"7,\263\214\215\324\202|_4\035\006\226\340\2059y\260\361R7\304"
+	.ascii	"\325t\231\326X$\261\225]\246\233\324v_\312\353\302:/\323]\272"
+	.ascii	"LW\311\366\331'T\276W\230_`p\351|@\275\232\236d\005\361\203|"
+	.ascii	"\351\203S\322\007\307\322\377\266\370\013j)\352\302\201\344\207"
+	.ascii	"\216\301m\231r\304\307\242K\306\253\255\252\314\250\003'f_ES"
+	.ascii	"\250\030\\\221\344%\272C/\376\302\2024\236r\221\224%Q"
+	.string	"j\234\207\264\267d\257\375\320\220H\221\360\357di\261\304\314JT\\[\261\302\264WV\327v7D9\231\350\312\005\363\316\372\331'TN&B\242\304\304\322vH\226\366\230,k0\373\257\235t[\276\232\301D\373w\360l\337\r2'\017YIbv\223\277F\273\242\321i\177\r\245\341\222\256\240\366.\262\003{K\177\351.\355\245\271\364\230\026\323`:L\003\336|\223\326\331\177\035\345\255\245\365\214\374\365\331\331\202W6\244\302"
+	.string	"~\370p\223w\344\345E"
+	.string	"\270\373\202I`T\206d\361\005\255\322\324\346\240\215\364A\245\364\301\234\036\005L\217\356\365\025\237+\262'W\322\243m]e\316\306L\fK]\263\033EN\341\303k\271\367\205\301\265\303\256\361\377\372\031\374\341\225\224zR!\023\202\307\244\361\024\232-)GnS\251\224\216\202n\025\rM5>\232L\217\273\300\275\335P\235\31515\263\363\r\254\312\255\267p\212\224TT{\351\273\255\327F"
+	.string	"\345\311Y\343~\262\363f\273-\344\222\177\215\035P\227\336=\313!\370"
+	.ascii	"\273!\270"
+	.string	"\301[\032\202\345\020\024\201\315\322cg\372=\273!\350t1\324fW\326\001\247\371\264d\325\270\223\334]5)j\374N\362\367X#\261NP\250~4\366`9\004Q\273!h\311v\336b\330\212\013\223V\3430\277\034-\2664nv\224\300\253\252\255\364\177\1775X\033i/\353\354#\275\365\016\322Bn\364\216\033\246\234q1t\267\323G,_\373@\312Ta\311`GzHw\335 \233\231)X\205'\025\006\360H\377h\255\026tv:\037>|\370@s\245h\313X\006\334]\335\\]\344\335\325Dj\210\272\013\347\234\264\226\203\033k9@\331z$\305\202\370\270Gz|\225\242n\370I\253\201\270\271\210\313\252\221i\230=yc\266R\215\324\025\215+\215\217\223\322\267\217\316\262} \300`\206O\231\006\244q\363\330y\367\370\206\240\022\252\211c\311`@\3115\206\200\335\020\304\331r\b\352\320\261\313!_\226"
+	.string	"\246\267e\215\243\257l\332m\246\245,\304\242\340\350eW\335\0205sS\005UqRa"
+	.string	"\033\313:\033G[\0357s.\323\t\"\211\241c\006\361o\312.IjuJ\224)\312Y\222\025\265\2531oz\250\213K\026\200\274#&\227J\r\023\271$L\274\320$\232D[\350,\221|\r\200\002\344G\220\013\306\305\311\024\024\351h\013\255\035]JB\032\243G\027\211L\027+*,.\025\032$VM\266\032\243F\326\212\216\273\"G\215\321\242\347a\"+ q\215Q\"\273\367%\265\366\326\030\035j\243\203I\253C\352d\022\035V\300x\374\035w\371C\363\2453+r\223\244Gu\365\345h>\016$\342H\222\2441\036s\253\303/\311\221\030|\006$\313\331\230\3068\314\007Q_\246\302\200y\216\271\036B\0327\366\262\264&\004\360z6ga9lp\271\342\343\303~:i\376\nr7#\245\312\231\221\276c?\353'\343\334b\207\214\312\313\303z6\2479t\207e\317\342"
+	.ascii	"\363\321C\313\261\036\033\315r\212\005\240\233\013V\356\2504"
+	.ascii	"~\005-\354\3540\236\316\362\346=\307\200q\275=\361\226\370\356"
+	.ascii	"\030/\360\205\237\230\306\030\013v\303\262\354R\322e\356s\270"
+	.ascii	"Ngy\261$}\204\341\252\031bC\214\312\312q\035\215+%S\2151\035"
+	.ascii	"\256\202\363\214\262\225\243\nn{Z\2333\263~\316\257\277#I\242"
+	.ascii	"D\301\317_\242,\345\306\274[\342\354\220\250\034?\355\222\033"
+	.ascii	"iY\215\361\024\354\026d\202\205I\221\306X\312\365h\376\306,\001"
+	.ascii	"\271\236<\301pV\311r\f\030\240\355\243\352B\302o\307p2YS\256"
+	.ascii	"\234\032c6\354\206\213\266\302,\261\033\206\302\244\341'\346"
+	.ascii	"\211\314\323\320\027(\215q\333\315a\243\234x\034\341\241\366"
+	.ascii	"\253\3415\353\314LA%\311\035k\200\030\353\213\221\273\377\035"
+	.ascii	"\257\265\335\214\227\031K1\215\257\241\305\221c\261#\030\355"
+	.ascii	"\326\325d\24433\311\240\301a\265\001\346#(\0174aIarK\216\321"
+	.ascii	"\216\233\204 \341y)\327\220\272dc\314\344\370\fJ\312\332\236"
+	.ascii	"\031>\333\272\032#\202\227\376\203\324\371\324\324\324\030+y"
+	.ascii	"^\007\311S\342k\214\313\316\006u\005\020\213lJ\025\335Pc<\206"
+	.ascii	"\221X\347\343p\222\337\254\261P\022W%}\n\354\343\2028\354\330"
+	.ascii	"\271&uE\025\245\271\244\256\006\023J\372\234\264\256.lD'\315"
+	.ascii	"F\220\330H\237\020}a}\035\033\261\301\341e-\2521\366j\255\fL"
+	.ascii	"\177u[\215q\021\333\026\370%p,L\210\020L$\004\233Y$\271\212\332"
+	.ascii	"\273\\\230\202\310\030rL\304\366\301xs\342\320zr\341R6$\375\217"
+	.ascii	"\037xKgy\255\314\2201\204+g(\0173KSa4\264\216\267\354^\315\025"
+	.ascii	"\035\217*\f\244\211\314Z\200`\346L_\026<\242\233\241\032L\254"
+	.ascii	"\306\317\231\352\341\304=\354\236\n9\331\344\001J\222J\t\230"
+	.ascii	"\225n\036\\0p8\236\354\351\320\201\263\274\302h\222\242\356\356"
+	.ascii	"v\034g}\261\355yQ\302\303\266\003\360\211\205\205\243\266\220"
+	.ascii	"8A\272\2309iMM\341\253\033r-\366\254\363\302V\307"
+	.string	"W\335g\206W\325pDD_I\2151\225\355\233\021Kk\036\341\030\335\270a\243\370\252\234\270pT\021\016\275)4h\340\250\032!\310\032C\3328\216\312\220ed\312Ic\\\303\314L\213H\214\030\030\212\303\fd\215\216\345\220U\3138\206\352\256\0334\0262\230\032\343\247\233'\374\002\277\310\340\005\037\224\207\024\213\317-J\343\337\024\245\230\t3\341&\233\363\037\007[jXy\334\324Ot\013\232\031\230\335\r\\XS\225\276\024/\341\245[gs&\241\311\306-\275\355\2628\t']\":\315\354\204A\226M\023g\2341R\027\023\037\035#Y\243\2511(\2151\213\206\013\343\202\233\321\030\033\331>\261<fc\\d\375h\222c\216H5\306D\266/\357\312\216ec<\324v7X\302\350\020k\214\223g\263\251q\344G\2451F>/\025\2632\225\327Vh~\270\3501E\243\313\035\323\345\212\001\004\274b\216"
+	.ascii	"\251r\002\f\363+\306\203\362\n\226\306\027L\303\325\370\321\315"
+	.ascii	"\0315\276_l\037S\356NG\343\353\305\372\331,\001I\222\235\r\307"
+	.ascii	"P\363\222\322\3706C\351k\254\374\335:\357\337\245\303a\022\006"
+	.ascii	"\345A\363u\345\201\251\3719\257\337\225\303\316\354t\203\265"
+	.ascii	"\367\005\006`\316P\036\244CfN0\032\277\306\213\357F\341\353\271"
+	.ascii	"\232\274d\212A\256\346)\315\273zy=\027\314\3316\227LJ-Zz.E~\200"
+	.ascii	"\0060=\215\023;\273\213w\344\273\373\305C\322\347\342\250\361"
+	.ascii	"\305r\365\230\224\314\331\276*.Yh\276\322*Un]\232s\006R\345\304"
+	.ascii	"\365k\345\267.\303\263\bP\013N\206\211\017\307\r\252\364\316"
+	.ascii	"\311t9\201\232\321\3704E\351\263\306\213\0253$[\356\224\033."
+	.ascii	"I\177P\250\\)o\027\3567\3567\256\347lV\346\f\225\221|#x\221\203"
+	.ascii	"Rzx\206\260\324\366\037\314Ie\316\331\tmf\345PM\360\267\267\250"
+	.ascii	"\265\036~\033{-\001r\376\025`\202\234\223W\226[\322-\264d\215"
+	.ascii	"o\220\217>s&\242BF\200\252\211\210J\306\321\030UF\022\371@jP"
+	.ascii	"f*\344\321X\316\0322\021\021\022\205e\326\020)\206(\210\305\021"
+	.ascii	"7+\261hL\341\005U%\321aE1Ta\"\203\365h\034\246\240\"\305P\005"
+	.ascii	"\033\242\312\302\252R@"
+	.string	"\305Q\210\304\212u\004\215\017q\210\302\002\023D5\250x\023CP\217q%!\223\2028TK\030\325\242\013*z\326\341\bL\364\030{|\210jP\220\220\207'\304\221\347\004\f><\"z\214=\030\330\210\320"
+	.string	"\315U\200"
+	.ascii	"\200\343\360\347g\b\024\274\n\020R\020\207\252\217\320O\017q"
+	.ascii	"\b\302x\024\002q\301\317\217\020\221"
+	.string	"X$\312\254<*\t\206\307\340\b\212F\025k\221(\203B\250\376\340U=\002\251@A\024B'\250\353\320\310\201\033\037a\206\243\272\306p\302\212\022W\001\002\013.\254`\002\304\252\2460\n\327\027z\214\305\02188\352Q\250\376\250%>8\036U#\t\017\324c\361gD\007*\221X\0341\002\005\023-\304\240Z\200\004\242\032\324\002\002\210\305u\025:AhT\201\204#\324U\370#\00444\261\301:$\256\220\263\252)*XU\n\0341\360!J`=\252B\"PK\034\340\202U}\241GH\242\203p\004\033\200\324\365\030\203\211\020;!\200\260\032\205A \354\214\360!\252&\326\341O\220\211\013J\2508\n\375\244\220\201*\244\ne \005q\270\016\205\034\320`Uy,\b\261\201\016\357\031\032U\242\232\"\375\b%|P\202\210\0252\027aB\b&\204\020\274\b\023vvL(a'}\t;w]+\300"
+	.string	"H\375QW\f*x\341(\274@\017Q\bE\215\312\263\302\005AG\240cP\n\r+T\037\342\n\352*4\362\254(\236x\241G\370s\342\202\265\307\346\310\243bMATY\230\200\001\256\002\004\024B'\200\204\252q=\202 \026\005p\344A!t\342\0304\256A\327\207\250\336c\221\204\314\261HBf%\n\025G"
+	.ascii	"\251\353p&E\020O\212!\nbqD\316\261\202\037!\fFu%\256\260\006"
+	.ascii	"\001\251\353*\201uH\034f\240\362\034\205V\341jBg\375\021:\252"
+	.ascii	"\306\240\017Q(\343\243\256=j\320\n\025\207\250\262@\203B\350"
+	.ascii	"\004\030zT\243\214\314\312s\274@\020\220p]\205\2129\034\326#"
+	.ascii	"\317\272B]\211\305\021$\324#\261\030tTK\b\240\207(\224\202Q="
+	.ascii	"\032\205A\031\2023D\225\005 \241Q\030TsT\201"
+	.string	"\206.\304`\\\325\022+\204@6F\365(\224\256?\305\342\t<h\f>B\265\304q(s\344\271\311\260^E\006G\325(\264\nU\024\351\221\247\210\202\270\002\n@\302\036\242\220\261\002\225\207X\034\362\360\004\300\250n\340\247\330S\\\213\306 \232\"\n\342\020\257< \216F\025\206\241\321G\003\243:D1\\\211\252\3170\303\221\247f\003\253\261H\"G\3759!t\001\206\240\312\243\372\024/\220A\365)\002a\225\247\205\325X\f\2629\022\213\3035\250(\243\256\302\022>B\302\023\2511]\257\002\004\036\020\304\"\020P\261g\203\027\203T#\210\265X4\202\240\371\031\nW|\344IA\034\032kN\004_8\n\201\360\312\023B\004\037\241\252\002\033U\024(\204NX\261\2460\f\325\036\265\204N\006\343Jb\205\037\341\320\250\0369\254<\"dV\236\022vV\342P(]y\216\032P\201\206k\372\235\235\021\033h"
+	.ascii	"\003\024H"
+	.string	"{@P{\2060\250>=F\020\305!\b\342P\b\004\242\307x\004\001\202\216\372\3433\254\021\256B\024^\350\021\236\370\371\021\216Xa\274\201\363\303=\224<\267\274\351Y\200\324c\342\206\361l\304\240\306\300A\301up}-x\264\341\247\226\021\333\031\312\006\307%\352\007\372\004u\302\207\325\303K\343f\231\027\031\262Gc&LP5\253\354#\300\025(\030\036P54-\016\013p\231\206\242--YR\345\031\002\254*fc\264\311]\002\0132\306j\355\f7\335 iFbf\350\323\025\237[Q+Q\202\222\221\020\266!\b\212\004E\202\222\331\254\334\200\210\034\232\344(\031\226\252\363\202\202J\315\320 +\312\2431v\361\372h\212\013\214X\0134\f\206\224\244\023m\272!\003<2\003\r\303HUE\372\244\0327\307\322%ZcT\350\221+\207\226\344\306_c\364\313\006\006\206\371\3029\032\003C\215\034\375\272\345"
+	.ascii	"\004JUJA/l\244\354,F\227\306h\327\b\313\234\223(\027Z\344h\327"
+	.ascii	"\233h\027N\030\034k9\350\255\263\027c\202\030\335B\267\320!*"
+	.ascii	" yP!G\207\264\201iq6F\203X\277\030OX\340mP\322\272b\256Z\022"
+	.ascii	"\340\023\220K\367\343)\313\013\364\307Q&N\337\323T\215\306h\017"
+	.ascii	"\324\007\021\346\022,\316\347i\331\312\262\006\326\030\315By"
+	.ascii	"\344`*q\322\370{J\300 \200w;\272\315f\213\\\032\017\035h\226"
+	.ascii	"q\341\005\006G\216\265\033\207&\204\b\026F{\036\t\324\201\343"
+	.ascii	"\326\t\321\223\022\2431J\205R\241V* 3,\361U\035\265*K\222\377"
+	.ascii	"*\370KQ\032(\rt\031\002\220)\364\306\321e\021`Z`c\264\006*\325"
+	.ascii	"\304T\022'\205F\341\261y\321\273sO\334\246l\331\270\013 EqQ\322"
+	.ascii	"\037\235\261\225\001J\214\017)P\230H\210:\346Rc\364\005\372\002"
+	.ascii	"}\302\232\363\021\0060U\302\367e\004\215q\364)J\r\265\273\306"
+	.ascii	"(\f\333WB\225\245\266\0166xM\252PIS\272\022\332\244\263D\366"
+	.ascii	"\215\340\204\357G\020@\233\0351|\260@\227\2166\241\001\205<\250"
+	.ascii	"33\363\201T:\006\221r\020\321\b\ti\222t\343\024@@@L&\027\020"
+	.ascii	"\231\271\033\023\200S\b\264\211\230G%R\314\314\210\210$)H\n\313"
+	.ascii	"\001\001AP[\256\027,\376\215\363\313y=B\244\227\3524r\334\270"
+	.ascii	"N\bc\262#R\007\005[\231\366\241G?4\304-\327\277\035G(\004~'Q"
+	.ascii	"\3014\f\376\241)f\372\031\336\005\233x\316\247\333Z\245\214`"
+	.ascii	"\244\fE\024\345\274r\345\370N\311<\265\025\223z\\\005]\036:\201"
+	.ascii	"M\315Hm\351\200J\234\177\267\342\032\314\353\316\0256\277)b."
+	.ascii	"\371\250U\357/\247\302\211U\002\220\250\220 \302\215a\242\322"
+	.ascii	"\2267\230\343U\031;\327\360\267I\224J\004M\342a\016\341\035\232"
+	.ascii	"8\200\255\311\353\243\306\t\235\001\372\335]Z0\266D"
+	.string	"P\32510\257,zs\376\262.\271)\237\305\273'\275\251\341q\220~5\340TG/\377\034\235\360\361SB\016\003O\320\002\225\332X(K\337\\1O\206\274}\221\241\251\375\037\254\210\316\217tr\222{\214\307[\211\200-\246@\3560\022\255\250V\346VGs\367\312\210_\360|Q\004E7B\"=\312z\247\306T\230\2437\251x\332\360d\311.\332\262\006{\t\215\357\037\336\364\b\367\177\347\340\243?U\025s\343\225\t\372\342\201\220~K,\020\317@|\367\2264\f\\S\225,vf\002`%B\307\r\255!\0172l\256\304\266\255N$\302\207q\315\350\333~r^\341\360\277\222\237Y\216M\262\257J#\205}\314z]\311(RH\364\263;7Mt#\241\033\261\313,.\233:QdQc\363\\:\221+\302p\241\2574\3232\235}\217\362g\342\364\212\371e\215`1!\353\313\256I\300BE\n\220"
+	.string	",\243\300]\315\205\261\307h\327?\345\016\321\363\307x\262q\360\253@\2336_\220\310\240\310R\371g\003\364\362\212\305\367\331\261\t\027\002\251v\365\005\323\033z\252\177\036\002\353\221\220\033\341\024c\372\232\303\247\216\253Z^\233\203}du"
+	.ascii	"\367\246\350\205]\021\206\321f-G\237BO\373\3524\247Y\0267\306"
+	.ascii	"Y\302\020\305\365\2168=\231\207z\306\231"
+	.string	"\376\206\321/W\222\246\371G\204\006\373u)\361\303&}\305\276\251J\320\346\341/\221\246\204/\343\206\246S\344\375ER\005\221Xy4\236\347"
+	.string	"\b\026Dt\257w~\341\302\256\225\227\023\232D\036\251\037\213\220\036\355d\352\227'\360\023 \002\332u\033e\270\215e\315\342x\025\325\313\210LTyE}\322\374\222\"8.'\257\213!9\344S\026R\016\031K\226(\235\374kf\241O\340P|\262U\310\017\\\224\035:\251\034M\2446(\312\236-\330\361\001\365&/\252\222\334pD\260\021;\f\312+\035\347\026\016\327.\013E\276\226\321#\tDc\366/\007C\352\375E\3535\035\320\021sc\323\036\272D\244_\202\005i=E!l\006\255I\355t\204\377:\334\241\n\316\016\213M\324\276\226\371p\216\322\221\\\362\035\210"
+	.ascii	"\210-\226\333\323\030\242\236\037?\347h\007\240\001\267\375\264"
+	.ascii	"=;\036\206\347\345|G/@G\023e\034\245\267\t\016WI\r\205h\017K"
+	.ascii	"\265\006\007&s*E\030{\31406v\357D@\364B\325Ys_\363[\223\356\336"
+	.ascii	"\304\231#\272\274w\344\233\023\006\367\270\2143\353u\217/6\n"
+	.ascii	"$6\r\36125\275\202\276\246\036\"3\206\256\220L\265R\222@\264"
+	.ascii	"Q\261\231hh\002\236c\221`\232\320\377\252\036\001\025\373\327"
+	.ascii	"\312\330?P\334\221e\333\t\265\374\210\230\271O\214l>\325\212"
+	.ascii	"y0\324j\232u\373\345k\233\376\306\345A\306K\250\255u\270f\032"
+	.ascii	"\177\\F~S\022\321\215Yh\200`\2454\233-\321!&\221\305\330\255"
+	.ascii	"jK\f\003@\276\2008E3\237\207\262\350gH\327\220\035\266N\233n"
+	.ascii	"\201\312F\035\205\326F\205~Z\246\331\205\027\374\001t&\350J{"
+	.ascii	"\205\032Z\002\326\357\027I\245)!\037\336\230\301o#\335\207$\207"
+	.ascii	"\317\021U\215v.Fo\312Y\3229|\234^9\201\272F\200\320\205\304R"
+	.ascii	"|\022}\0054T\032\263Xs\271\233\332\246\347\322|\243rU,\332\302"
+	.ascii	"\020\211!\377S\205P\317\234\272\227z\320>\313\313\016g\276\275"
+	.ascii	"V\354 \002\334\t\203@\225;\212\2442S*<\036\363AA\335Dv\257\030"
+	.ascii	"\211<\215\3564g\bN\022\2162 \257e^t&\242,@\002\001\277R\tz\360"
+	.ascii	"L\302\0348\263\2359'\213Zt\204b\034C|\250\251\372g\226[A\324"
+	.ascii	"\024f\216}\321qs,\231\357\245%[\261\316B\323\367\351zX\335t0"
+	.ascii	"\357$\030\017iV\2359\204E-ukF\300\316a\004\006\273E\030\257\275"
+	.ascii	"\300\226\020\372o\253V\333\036#!\304\317\216\265\235\335\005"
+	.ascii	"\360\251.$\313+3x<\314\3207LJG&0\307\031\223\240,\005\251sn\320"
+	.ascii	"\027\240\352\264\013yqA\326\265N\365+A\201e\bl\3619\264n\351"
+	.ascii	"\344\360\032\271\275\363'l\221\t\247\327rx~\340\026\230\234t"
+	.ascii	"O\303\306\023\271^\333\230Y\ti=\250\226I\241Q\363\214Vi"
+	.string	"L\300\316C4/\341\360\372O\245\320;\036lzW$\367 10\201\326\352\033E]\355{\321\362\231.\3333\237V\020\204\004I\270q\3140;\204\206\257\337[I\200\360lM\241\177\321\236'N(\260\300\331}T\022\214\031h\3523\205\326\225\325qd3\372C\264\300`L,\220\365\330\344K\242\305\302K \332\222\273\343N\204L\341\r\246\240\267\270;\250\337O\2172]\251\003\303j\t\t\357\331*\013.\314.\275\372\216?F\256\314\020\375&Q\234\314r\366\346\274L\350q~\210\331\227\234\370U\340\"Y\371YnGO\232\275UyU\244\341\202F\224n\273'\272\272\317\313\356\315p\037\253\244\211I\203\246\276h\331\031\021D]\004*\f\263`\0016Z\211\"\255\310\263\241\346I\377i2M\242\366\215\234p|\274\264\201\362\025K\222|L\373\223\004u\224\327\255\351uv\2507\331r\275]A\207\343\356"
+	.string	"\320\350g\001\327_#^\350\006\230\210\320\224\365&\344[?x\336v\222)=U\020\227i\326\253\323\245\220\bw\312\262\"v\353\224\\\021\331"
+	.string	"\352sM\313l_\332\337(\346N\315\202\320\232\2006\n\364\\\004\264\3113\230\375E\270n\347\027\304\376\200\375J\304\316\305\213\376\374\t;&\312\270\311\t\226\275\270x\243T\035ON\253c\375Yqe\031H7;\251*\321'`\376>U"
+	.string	"\222\325\275"
+	.string	"\200\202\333h\213\266\031\376'\3163L=O\372\242\305\035"
+	.ascii	"\n\264\227\220\031\035\260\324\212\246m\022\355N\321\321(-\371"
+	.ascii	"\337K\222\227mH\275\322F$\031\025\335\223\215\270\004\n\372\336"
+	.ascii	"c\334\243\375@\256\353\352\007\265\267lr\302\027\343\216\255"
+	.ascii	"\336\025\302\241Zn}\250\253\336E\265s\235\315\372\341\357\230"
+	.ascii	"8\002\226"
+	.string	"\031H\243\257-\253\3025R\227\361\323\2715n\274~Y\274\214R\025\234\":Er\020Z\343\263<hKpgWY\317\031$\016>\215\305\327G\335\3729c\026\354\030\0224\371\230\255X;\fk7V\331\323\256\013\266\374\007\206j\247\355\337\307\206\215\300\254z\326Y\256\023\205\365\201\020\352Mb\210\004\200\321\fc+\024\310\347/S\323\233\366s\026\373!\350zX\004e`W\365\222\224\321\247\302\004\236\005\374\243\2336Md\357\213\001\\\002\222K\2518PaH\227N\013L\351:\362\274)\033\037\220|wI\213\206n;_\263%\220{3\004`\003\262>V\261\342\007\376\261\2537\354\262\272\314\250:%9\306(\207\246\356\224\334\235\225\233\315\300H\222\024$\205\311\022\220\243\355\272\350C\022\225\305@E\005\244\312)0\226\307\2561\032\265\327L\303(7\tq3\002\203S\354\331\303B-\016\275\304\304g\242"
+	.string	"rTX\277o\322\377CN\270\375P:\017\200E\252\345\177\243@\337"
+	.ascii	"\242\034~\216+\213H\007\322\t!\361\267\247LP\202\024L\006|\250"
+	.ascii	"\306\031\251\fN\201\324r\227\206\307\250<\265\330\226\r\337\302"
+	.ascii	"\312M\267R:\301\205\303D\200=\r\346\377\350Q1\206\271!\236\006"
+	.ascii	"\270\375\bH\322\360f\340\036\236\373qG#G\220\337lk\214\332\316"
+	.ascii	"\326\361\353:\257V\363\351\322\217\326\033@\322\2643i=\350;\356"
+	.ascii	"8\276\277XM51~\030hO\271\321\205\255\336\013D\237|\207\002\226"
+	.ascii	"S\271\227US6\370\3372\017\215\357[\356\2171\376\360\027;\216"
+	.ascii	"\037\243\210\341K'\303\271$9\302\213;E\215\2150N\367uD\273;N"
+	.ascii	"?oX\360\004\260\355\252\331\371`j\222U4\004\020\345\242\347\252"
+	.ascii	"\2231\030'\267\303\033\007\022\366y\352\204p\372\263\024_\006"
+	.ascii	"l\231L\317_\030\263\003\246\232\275x0\b\363\353\03676{\303I\302"
+	.ascii	"\251\262\351\253\3735S\221L\007d\212\267M\275Y\016\356\256z\354"
+	.ascii	"\267W2\273}g\271d\246\347B\222/\231c\300\373\305\305Yy~\206\215"
+	.ascii	"\017\270\375\030\221/\262\266%YxQ\212\267G(6\350x\376mA\201\013"
+	.ascii	"\032\221\351\037\364\377\230c\244\003\254O\343\212\363~\356?"
+	.ascii	"H<M<\340~\222\370o\270\230\215LX\376@n\024\202\207\314\267\007"
+	.ascii	"n\303\326\031z\214\261c\307p5\356\357T>;L\226\374\254\211\375"
+	.ascii	"\346\215r\264\345\366e\322\371O\365@y'l=\375P1V\260<\0341\216"
+	.ascii	"s\035;\275\256`\263\206o\271>\247<\256\352\314\231\327l\215\267"
+	.ascii	"\021\021/_<\223\306\3271=^\177\210I\360wz\013\253\350pX\376\303"
+	.ascii	"?N\312\354\217\212\274\340\375\321"
+	.ascii	"O&\341&\332\006\302\227\362\200\253K\356=\200{\347\232\302n\377"
+	.ascii	"\347.\037[\345\033\366i\017\346\251\265(s#W^\323s\321\237x\274"
+	.ascii	"\236\262K\364\377\336_Y^\204s\210\303\225+\335Ul\245\256W\017"
+	.ascii	"S\347\257\343\007\3402\317D\276\016\324\336j\307\321\231\360"
+	.ascii	"a\200\261\024\306\213u\301\177A\267\261\246\037]\001"
+	.text
+	.section	.gnu.lto_.symtab.181c095bd85053e4,"e",@progbits
+	.string	"watingResponseQueue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.181c095bd85053e4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,852 @@
+	.file	"rcdevice_cam.c"
+	.section	.gnu.lto_.profile.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"5\007"
+	.string	"\364\td\001"
+	.string	"\023"
+	.string	"\310\373\320\361\004\004\002"
+	.string	"\002\001\002\002\002\002\001\343\233\320\335\b\002\213\326\277\344\004\003\202\270\367:\004\002\003\002\004\002\005\002\005\004\327\337\271h\030\002\005\002\006\002\007\002\b\002"
+	.string	"\002"
+	.string	"\002\005\002\006\005\240\342\234\212\n\007\245\335\252\360\007\024\002"
+	.string	"\t\002\004\002\n\002\n\005\b\352\263\360\321\b\t\n\013\360\210\333\334\f\276\305\365\370\013\004\013\002\b\r\210\270\377\250\n\002\002\002\016\331\340\300\216\n,\f\002\r\020\207\255\221\344\013\013\002\b\021\361\362\225\232\017\005\002\006\022\023\024\240\342\234\212\n"
+	.string	"  \240\002\242#\036Q\004]\227\0202\245O\030\214\0355f\200\200\0038\257\260@\270\007\360"
+	.ascii	"\356\232\007\001<\\$\315\3615\374\243w,\266h\340u\257\375\"\356"
+	.ascii	"\0138\230X\n\354\340\250\3017\320xaa1\207"
+	.text
+	.section	.gnu.lto_.ipa_sra.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375 \233\365\002"
+	.string	"\222\304\r\026\2605\215\001\344\004\222$I\265\247h\323R#{\267a)eJ\001\356\036\311\221\205I\f\177\372\310\245\230:\365ZF\331\202\236\321\003\374\301\245/\261B\365\266\3571\020\017"
+	.string	"+\003\202\""
+	.ascii	"\346\300\245\206\331\f\001w@m\260\002\021\224\300I\235\031\323"
+	.ascii	"\202(\263\365\264\361b\335\006\332"
+	.text
+	.section	.gnu.lto_.inline.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`&\003M\021"
+	.string	"\306ZX@ o\223t\001%\177\r\330\305\251g \025r\244\323\034biM\033X\"\223B\325\"\225N\331\002\362\250\226\374#\376\377\177 \200\224"
+	.string	"\b@\220!\301U5r\241\247\267\377\377\321\236\374F\344N\001C"
+	.string	"G"
+	.string	"C"
+	.string	"\"\247Q\020\216\026\341dr\"c\217i\217\251\375\032\252z\325U(\244\277G\255w\344^\324\314\314V\376W\0349 \226\340\253\307\234,\3132\334pwj"
+	.string	"\247p\303\275&\270\215\035\3052S\363\227\251\001\001\034\252\335\212\004\034\200~\234\021\022#\303H\201-\210\230f\332/jY\226\275p_\352\310\n\024\224R\037\021T\003\213\r\037\0061\265\307\204W\217\351\024\250$$x\300*\367\335Pq\301W6E\354\200\032\375x\013\326\306\231i\031\363\370\263\022\364\263~\326\247\221\234LZ \346\247\017F\234`\356w]\240\212paB\204\372U\371\373\274\352\205\250\274\357\363~\241\234T\221\314\354\334&n\276\332\2279\305b\310)\310\027k\210 \027w\364$37\246\314\314\334!\245x\2452\300\320"
+	.ascii	"\302\373\375\030\216\226\204\260\220\202\027\372\004\n0JNyc\275"
+	.ascii	"\277 U]\326\326\365\365i'\023\024X\307\234\024\300\201\305U<"
+	.ascii	"\360\200{U\260S\201\202\244\202\2005\243\346H\3052\275D^\250"
+	.ascii	"A=cH\204(LRXh3\220\"\242)\353\001\021\2609DD\223V\246\315P\370"
+	.ascii	"\032\207\356@\334\201'\362\257\340\356\226\234\320W\340{\300"
+	.ascii	"Bm\223\271\001\253H\020T\205f\007\026[\013\026\201\355j\211s"
+	.ascii	"\214t\255\305\230^\347\r\003bk\201k\217[\262\300s\226IZr&\026"
+	.ascii	"\275\337\333\231+\323%T4\200\255-\022;\345\220\2249\346>\372"
+	.ascii	"\364h\315\246\243\350\346'!V\341F\237b\004\017 [\327G@4S\264"
+	.ascii	"\030:BfJ/\351\364\006\371\260\333\020.Hj\265+\004B\t\321\200"
+	.ascii	"t\030C\2751\202\273\316\320\030\033\330\251z+\316\360\007\024"
+	.ascii	"\021\240\356\201m\220 \200o\236\bU8.\2514\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\r\006"
+	.string	"\202\211\034$\2205I\007\377\363wG\310q,vw?\213\376_\266\372\377\230\224\317\361\255\361\370~\373_)\332v\023\231d$U\023K\333G\230n\356\264|@\254\265\3264\003Y8\340\001&\b\254(\344\366$\311\215k\255D\237\0267\207n\2563Jv\346~l\244\232\312j\035=R;\367\316u:\024E\202\231\343\314\365\264\252=\334\236\311C\252\320s\300\007\002\037"
+	.ascii	"U\213\023\034\032\024\376\343\211@\024\004;\233\211\233\005\270"
+	.ascii	"\032^\001\335\327\004\021\225\002pn\337\006\324\031\002y@73\202"
+	.ascii	"\216\007\202d\240\t\032) \370\016\235\333S\331\200Y\200\246\001"
+	.ascii	"\335%\020U\306\243J\301\314\345\247\275\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\003\231\004\004\271\004\007\231\004\013\230\004\f\205"
+	.ascii	"\004\r\230\004\016\230\004\020\231\004\021\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375 \361\275\003"
+	.string	"r\304\017\034\300%\303\001\377\306\366\377\377\377\377o'Z\333\255\205\226\254M\bY$\021\204$\231\0026\216\360\252g\036Zt\360T\257\230\230"
+	.string	";\013\212\364\\\353\030\234\023=\003\217\330\361T\2430\021\017\001\027"
+	.ascii	"\0373\200\021\202\201\340!\204E\340\017VF\005\304=\035'\005\203"
+	.ascii	"mx\201\365n\001\r\310\327f\246\232y\300\242*;\243,\330\031\247"
+	.ascii	"\330\361l\266[\023\006m"
+	.text
+	.section	.gnu.lto_.lto.cf51e69cea8b4ce3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_camDevice.42.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\264=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_cam.c"
+	.text
+	.section	.gnu.lto_rcdeviceIsEnabled.47.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\r\b"
+	.string	"B\21777@\217\322\001X\360d#\224#\244\340\242e\013\274\231\002Pj\343\323\374\345\312l\275\375\353\201>(\304\243\0224v\025\005\302t\343\206\243\375~J8o\214\220-eJ\001\3264\235\215\346\260i\234\212\355A\353 \307\201\020\234M\007j\235\007j\b\314El\035\234\340\270\016f\342\376\255\256\236\026\224\324d\037\224\245>}(\247\023\223%.\002\302\354.\203\037-<\030V(;\226\032\320z\310[!\237e\212O\036u\314\377d\307\256\002,\031\245|\261#)\225\303\376[]\331N?Mg\246\217%\304W\313@\312n\352\305eU0\223\017\333\";c\205\005\221G\217\036\251o\\\234\\\257\335\b\265\343\243\347\310?\310\0174\\#+$*\322\023\240aw\235(\025\306\255\267m`\033\301vI\f"
+	.ascii	"2CW\r\314d\202I\032\3331q\205\n\256\241\356s\rg\032\361\230\020"
+	.ascii	"$\334\271W;\237"
+	.text
+	.section	.gnu.lto_rcdeviceCameraControlProcess.49.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`U\bE+"
+	.string	"\332JH\020Ep\\N:\313\265|\2708rP\222\200p\217\322\355\213\244\246ys*e\201\336\202\030T\375F\346\256\255n\342x\347\250\024\307h\256\001Zf\031\354\035\332\266\315\013i{\263\327\241q\331\353jk\3336!R&\031\372"
+	.string	"\330"
+	.string	"\363"
+	.ascii	"_Ss\003#\263@e\237\026A\202\325\227U\276\312"
+	.string	"\244\327\006\246\344\201\357d{\264\233}\212\325\317j\370\214[\276\266e\222\273Z\317\030\374\334\006\276\237\304\007\321\237\346\201\350\317]\033\273\301\237\035\\\253]\273\237!\251=\260!YU\352\324Z\227\372\310\022\261\325\213\210\206\204\202\204>A\340\317\327\243\247\331l\265\3571I9w\245\035\351\332\270\214/2\177\240\230\020\216Ld\244\353\311\207zLB=\246 \241\020\366a\013\302A\267'\001\211M\266\226\360\317\007\373\314\005\3111<>\2675f\006\231\001\253\373\333\223\232lyq\017\b\375\371\332\372A\177\270\262\350O\322\327\326\230I\201`P\360\276\272\306~\232\013\356\262\314\031r\3410\203\264\304\220_\303bsnK\314$\246\235sp\335\340>\332\027\374\260Bf\347\253\353\311\271\307Tk]Fru}\005|\367\310\335\315\260\333\263\021\265V\nZ\276%\305>\354\347:\025\371\310b\377\314\200\272\373k?\235"
+	.string	"Y\313\372Y\255\325l\345RQ\356\251%\233\033|g\205<\354]\026P|$\367P\r\214\334\2156\356\321\274\212\276\201\232\337p$\217\274g\207\375~\332\025pu9\322\255\345]\361\236\256\265\032\273\225\273gG~\255\365j\273\310\356\325\276\b\200\274\007\200\274\006\200\274\005\200\274I?^\"\220\227\300\217\027\351\b\310[\364\343\0352y\205\276\374\002\231\274"
+	.string	"~\366\035R^\341\217\327\207\362\006}\274\300\036\357\317\344\365\371x{=^j\362\236'\257Iy\373\344e\223\367JM\265\016\236\200\265Z\265\366\344\251r\247\226\261\253\375\313\377\354\275\373\2678\267:\270Z\353\313\316f\343V\366o\274j\255\301*\033J\224@\033p\333\017\237\343\266M\227\223\201"
+	.string	"\034\244\276\233\030`\002\332\353V\262\\C|\002J\273\327Ez\262\274\220xw\003\007>\222\366\343\210\034\333\370~{3\344wD\205~s\3135\377\021=[\250\315\353\252:x\340#=\320\237g_\331\021\226,\363\002\322y\003\342S\242\007|s|%Z\324\007z9\313\353\370\266\037N\007\302\350m\233\236fD\020\232\020$\366aQ\364gQ\033%1\333\317\375L\324>lK\230\340#M\320\237C\375\267\007\330\242&Y\346u\270/\223\221\365,\221G\031\224^\334^n\355n\007w4fOf\355^g\004f\037f\355\036\3475\3405\350\317/;\007\256V\343\223\214\254\n~\016{\250\206G\016\213\363j\0269s\324L\326\376\372\0051d\362<\226\233\375\257\335\023\357B\345"
+	.ascii	"I\255u\302\356\3228\027\024Hj\002SRP2\234Z<\251\360\321xZ\341"
+	.ascii	"\242C\213b\f\250\0310\202P\337\342\203(\247b\212\247\"\224\214"
+	.ascii	"\247\025\305\251%)\250%\027PNQ"
+	.string	"K\305)\030K\017\216V\352\305\323\324R\f)\251\251\245\340\331U\275\224k\310R\355\334]\365\261\026\265r\205mCG}*\341\203\371\260s q\223\233D\255\334\032t\330G}\264;@\343\262\244SK\036\275p\035j\245\026\225\322\n\336\201\302H\207\0045q\204f\362\226tkB\255\334\nj\277}\025e$eI!\327\221\"\006\374\253(\202\316AEwOp\026\343`,!\236\236'q\2228\330>S0\360\221K\304j#_\371\364\017A\007[\304\220+Yy\303*dQ\202Z\211w\340\357\376k\340O\330J\273\003ps_\003\330\343\323\"\342S\240\317f^\211&u\001\266\375\360<l\333t<VfIv\210}\266\277G\2222\301V\256\271\201\276[\200\246\250q,\005\225D4#\"\"I\n\013\351\220\002\031\242\"s\021\200\251$U#%M\241}\0032V\030\275\260r\326=p\001$\266"
+	.ascii	",6Z*\202\244\351\005\210\361\265\301J\222L\374Zu\322\210\371"
+	.ascii	"\rU\262\376'\221z*\271'&5\357Dxaq\272\205\034L\231\017\265\316"
+	.ascii	"\270\340\207\3437\340x\371\270P\312\365St\202\rGC#\204\024v\027"
+	.ascii	"\252\346Q\361*\232\254HY\265\370\340\036\t\373\335/\366\344\305"
+	.ascii	"\317\f\300\225\251\n\311Wv\251\324\251\033\206^\206\373x\342"
+	.ascii	"\210\240\341R[\365\022</\332\002L\201\f\233w\300\024(5\311\352"
+	.ascii	"\313\254\277\2315\367H\207\202\220:\250\215\001\313$\322\212"
+	.ascii	"\313\033\242\001\252\245\316\304\336\3469hiJz\340O\312~9\355"
+	.ascii	"\222\212\2661\210\267+\230\266o\034\220\334\357\033\211\013\364"
+	.ascii	"N\021\365\025\263\017\t\243\317\nF\212\302l\177\333\354\242\272"
+	.ascii	"\024\313Z\333KRc\324\007\303a\216\370\030\024;\021\r\354\n\001"
+	.ascii	"|\220>RTx\016\236\326\376\212&/\025\005\032\332\320|q\037\304"
+	.ascii	"x\351\233P\305\215yS\304\254\213\312\267\217\246\217\026\027"
+	.ascii	"+\3471\226<@\245\013o\004\261+\312y\032^\242\304\361\330\350"
+	.ascii	"\364\027\275\250"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.51.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\275\f"
+	.string	"\006XWC"
+	.string	"\2216\035\320\314\342\264\211\260\277\201]&8V\013\004z\0033\323\247}\264\272l\261\2649\037B\266\267\217(\202\303\3014\214\004\267\262K\276\252\365\377_i\327\363\032\007 \370\223baSdi\023)S\nD"
+	.string	"C"
+	.string	"C"
+	.string	"6\215\177!6S\342pa\345ew\243\202xwHiv>"
+	.string	"\217\344\320*9\245\242\027\237\030+\274\222+\205\200\004c$\300\003Q\032\027\0173~zb\360>\231\231\315\356:C\236\350\256n\233\201\355h\037\013\232~\246\001\313K\215\0038v3\304\300l\013l1\302?\361\024\221\177V\221\213\022\273{\035\332\"\366u\370\313\366\323\376\311Q\272\233F\n\fX\220\212\006\226\335O\201\023X\207\376\256\251\016\255\023\250\016\335\005\017}\244<M\214H\220Nl\\D\210\324\242\016\251\256\017Td\2002\207m\220\257\204,\360Qt*X\273{\223C\177\244:\274\376\364\3340\202!\241\230<\031c\177\237\324\222}jw\327\372\301\276\351\207\001\026:\230\032\353\320<0\007\034,\243\300\201\200qq\313\242\204\314C\213\030\007\022;\fx\233\300\341bg\333\270x}\236o<\372\201\001\022\252\235E\310\207\374\3237 %I\0267\\:PZ\322*?\305Uh\276\211\267\217\f\026"
+	.ascii	"2\003\3020\323\302\316\021He\3666\332\302\301H\334\325\0010\321"
+	.ascii	"\004{\200\352\211\270\347\020\353-\341\311eJS\361\006\025\242"
+	.ascii	"Y\235\036\327\362M\361\244\232\254\350RP"
+	.text
+	.section	.gnu.lto_rcdeviceCamSimulate5KeyCablePress.52.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\241\001\275\016"
+	.string	"\226\235cA q\223\016\037F\301\003\350\3215T\017/b24\352\267;\321\330\330~\226\031\303E\314\266f\354o\211\3665B\322\273\025$%H@`p\001\362\342\003\224:\200\355\332/\260\330\265\021\262\367\2262\245R"
+	.string	"L"
+	.string	"Q"
+	.string	"%n\002t\226\013\317cI\036:\270\330\345\022\030\201u\230\371G<|\037\020\017\r\262e\234\013\261\225i\206\n\n\033\273{)\210\203\016\237&\310\257FN\277l\245\320\341\373\270\276Dz\231\335\215\245Qf5\262\273\316\255\244\341\216\267\375\300\266\003;\t\004\335C\"\324\247\316\024\016\243\354l.\224j\262\377vw\255\037l+\246\253s,?\204\351w\356\326\227NM\037\023 \025\343B\355f\350rl\013L\2118\367\333\377\311\030/`"
+	.string	":\207b\355\210\ne\272Ac\227;ph\005\326\323~\033Nr\342a\352e\203\352\365\247\033 \201R\331!\312\016V\032\025@\rQv'_\001\342\006~\212\253\350\274\257\034Z3\211\337\016}\223xX\351SOMG\211\226~D\3319\267-\360\324\341?w7\244j\362{H|\2520H\211\303\002\272\256\013$\332\346\243\361d%\332\305B\306Qc\"\035\r\026!\3036'\231\004\314si\233\213d\243\351\\\230\207\302%\002b\255$\363\\\037M\363\\\030n\257\226\372\275\250\252\030 \274h\021\351\310\036\371\023\032\314\332\025}\273\246\332\331\204\374\346L\212\206\354\263x\213\n\376\212\003\033"
+	.ascii	"?\003\3020\260\215\031\036\013[`&\236\031T\216\262\212W\226\263"
+	.ascii	"e\bk9'\254$\252qRWw\033\f@\360\032\301\254\307\005\027\313\f"
+	.ascii	"\307f\005\013\235\301\255\001\247D\007w$(\033WR\364l\343\023"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.53.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375``\002\315\020"
+	.string	"\266]iF"
+	.string	"\261&\035\257a\376\230\216\006K\207\030\017\276w\317=RG`\343\374\270\362\313{$\333\367\240F\366\022l\304\264%\325$\375\216 +_\314&(\002TU]s\372\020\300\rtVs?l\037\2074\262\211\224)\005U"
+	.string	"R"
+	.string	"U"
+	.ascii	"\334\343\310\007l\217\332\005l\217>\331?\017;\354a\036T79v\267"
+	.ascii	"S\016?\035\264EM\363\344'\r\017\270\372\016J`c\313W\214\310\265"
+	.ascii	"\256\335\346\232\210\0220p\325\272\272\260\244Z\266P\217\f\206"
+	.ascii	"\217\225*&\250dw\235\340\252\302\315\335\366\004\333\235\235"
+	.ascii	"\031\002\321\t\256\352\345Z\030\373&l\377\250\217\214\335\357"
+	.ascii	"/\tn\201G\325\214\315\220\271d\017;\374R7\330\327\331lv\303\032"
+	.ascii	"c\277\346\327Lg\246\377!2\242\006\002\237]\n\263\035+\2130B\200"
+	.ascii	"\330~\332\177\235\346\364\232\025-\300\2464\274\354\354\206\007"
+	.ascii	"l \317\030\016\r@>$5\340vQ\007\257\266\312\203<\350\221\026\375"
+	.ascii	"\354\357\374\205\004\377\203#\230\362\340\243o\332\036\257\312"
+	.ascii	"\342\321a\001\2253\237\305Ch\310\276\344\341\036\231\0139\232"
+	.ascii	"\343\3078\034\327\302\264\360q@ \\\2730\177\3056\203\342)~\343"
+	.ascii	"\037\356\361+\333\003&\021\212\332#I9\361LD\336\b\202H\201W\352"
+	.ascii	"H\243n\301\350$\245\363J*\035\t\001\223\030\210J\235\003\022"
+	.ascii	"\251\324\201\204{m5\306\346\234\016\t\031JY\374\360.\321@\251"
+	.ascii	"\266\tO\252\262zf\\<uZ\233H\252\332\236(\244\303\222\245N<$G"
+	.ascii	"\f\245=BQ\375|\025\0013 \260\002\031\312q\003\"B\377\312\200"
+	.ascii	"\221\310\250\177\"\3416\270gE\231\245\310\341\253\341%\005\\"
+	.ascii	"\270;\264\032\320\362\256\244\334\002TyF\206\034\034\334\333"
+	.ascii	"\326\2076\023\f\232u\364xoQ\"\342\b\362^\312\206\321\206\210"
+	.ascii	"t\213r\217\343v5\310\342\260\253<\345\202%\366S\202\217\300-"
+	.ascii	"&J\233\f\242E\343\033.\302\020\317\315\371\316\254\262\3502\372"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_rcdevice5KeySimulationProcess.54.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`_\013\3653"
+	.ascii	"\252Y\214\023D`\236\326\030\177Vyh|\200\203\204-w\360\356\273"
+	.ascii	"\325\336azf@\034\227\212\"\363ST\222z9\377\346\306\263\335\262"
+	.ascii	"#n\274`\013w\201o\350\211]6\256\252 \021\025$\202\334r7\221D"
+	.ascii	"J\231RJ\001*\001\006\001-\001=\206\320}\236\364\245\361w\347"
+	.ascii	"\265[\343\2224[3\267\224\273\215\255\252\251%}\241]\366f\207"
+	.ascii	"\266\367\276\322\002\275r\203\266Wn*\275\246\242\245\374\\\374"
+	.ascii	"\314zeV\301,\354\325\205\314\334\316\334h=\305\252\323V\260\373"
+	.ascii	"\276ai\264\274\257t\211\r\264\2756;\311\366\252\366\221\355\225"
+	.ascii	"\255\230\327\264\224\310\013\034\"\346\331\266\367\276/\323\017"
+	.ascii	"i\253&b.\225CBA@?I\344\321\247\207\307X$\016\205A\267\005\262"
+	.ascii	"\253\372n\305\035\204^5\021s\211\346J)>\024\305\205\202\314\034"
+	.ascii	"(\211\377\244!\361\344\021\244\221c\021\037\262\236\2631\347"
+	.ascii	"I\233\342\306\037^\374r\242\017\037\022\351\341\302\276\343\342"
+	.ascii	"\321mmT\306\225\346"
+	.string	"A#W%\320f\313\234$\r$[]\306\245\303\333.\343\362r`\332\323\331\276\343\332\2416\337\367\025B[\370\332\224\266\207\306\027V#\255U\225\300\227\030\033E(\01359&H\032!T\313_-\022\373\301W\204f\251\3150v\317Vk\207\001\325r\007>x\337\227}\013Z\243\271\250\231}\0033;`v\325\002\334]ZN\003\267\221^y\003\007\016l\257\336,\307\366\272\376:\355\343\213\303\362?\216\263\322\343\212\245b\325\007\301\r\327Z\250:89\375w\365Eq\230a\255\016\006\215\333\237\232\304\376\273\220f'\261\376\377\3002<\316\374\341\311{\313\277u\200e\375Uw\035 \177o\317Lv\251\275\233\352iy\035\356f\262\375K\317\376\364\312j\267~\203\3426\302\"\242\274\267\242\330^\373[\255\217\360\350\234ya\371\037\2634\313?\312\334\352\373b\314\315\326\234 \350\334\244:/\265\316I\256\363"
+	.string	"\327\031\251u>r\235\005\270\316\001Zg"
+	.ascii	"\255\263\221\353\334t\235\213\\g\"\327\231\331:/[g%\320y\b\350"
+	.ascii	",\324:\007\271\316@\256\363O\353\234t\235\221\256\363\261u\366"
+	.ascii	"q\235{\\g\236\326\331\bt.\272\316D\327y\330:\013]\347\240\353"
+	.ascii	"\354\266\316\255\353\ft\235\331\326y\005:\253\254\363\257\316"
+	.ascii	"\256:\267\002$%_\001qBU\320\302z\206\354\f\375j\003\013\237\027"
+	.ascii	"\202\030{S\036\241\3570>*\bNB\277\332p\343\373&.\264\214\037"
+	.ascii	"\345\026Jc`\203\376\247l\216\234\240w6_\004z#\331\317\003%\377"
+	.ascii	"\347\225\350\340\274I~\373\021\265\200\325 \"\177Hv|\244\317"
+	.ascii	"\037_\331\206\215\317w\226V\202I\305\206=\357\344\371\036\343"
+	.ascii	"\363\274*\347@\253Ic\374\225\315\355\214\027Py\337\204[\272\370"
+	.ascii	"\316\251\236^\361\273\255\335\207\030\330\327\024\257\340G\233"
+	.ascii	"\212\315\243\212\340\324j\255\304\304o/\016\323{*aB\373\276X"
+	.ascii	"\275\325\364\334k\024*xoq\223\305_1\367]\343\215\260p\341\002"
+	.ascii	"\333k\323\177\227\031;f\266Z\323\022y\271^\260W\251\327^\353"
+	.ascii	" \\\016\273+\357c\366\f\327\013\227\370E\275\341\023\205?\374"
+	.ascii	"$9\003]G'\374\2363"
+	.string	"\346\310\270\274\267\375\350\227\016\376\337M\351\274\264\373\301\366\335\037Z\3520`\332\357\266\261V\212f\271\002~\224\235\254\245X\340;\247t/\347\254\245X\366\201\337-\276\326g_\305\362\364\303\362?.=\207\241}\337\227AUP#\336\204\006(\251\250\f'H@9\235(\236\210\374t@\352\303\223\007\250\247\250\024P!\236\234LSQL$\242>H1=9M0\035`\362T\t('\323\211\251)'\223P\212\325\352\373b\314\017\260>\253\211>\312\235\003\307\022\3305\327\343sA}\343\tr-s\343\353\250v\025\333N\272f\030\331\256b\213c?\236p>\337Ul\202\207\301]\024\204\210}\241\365\231\346\206s(\260\013\031\2638F\236\340\231UX\251\025\343\376\354\264\376Jy$\310\0323\351\177\336L\353|\206\313Hz\247\263\034\360F=\244\037p\364HO\300a\370\326\321{\025\245\200\037\352\005x\001"
+	.ascii	">\300/\335\305\023\300\367\334X\334\220\201(\236\220\321\003"
+	.ascii	"!\231\3269\013\3272z\367C\363A\315G\026}s\371E_@\356\351\307"
+	.ascii	"\007D\364D!\314'R>\363\231X\236~lF\207\233\237\243"
+	.string	"%}\205\311]r\371GcS\272\367\312cCb\265\362\217\200L\353\264\274\316\0228\027\307\217\262\361m\f\354\362{\315\264n\311\257\374]\276\333\004\356,n\210\367\005\365\241\323\312o\277>\345\003\331\262\234\005\200\340\250q4%\025T3\"\"R\222\024$\351\360\002\021\031\032\353\021\020\245B\326II\254\305\002a\237\005\235|\2042\370B)\263|=3\007o\327 A\003\036B_\321<\320\270,\262\235\022(\232Q\300\245y#\025\357\214^0/\232\216\037\262\330-\"\312$,\206ME\034\320$\027\035\332\240\206\017\330\211\037x\304#H\323\033\346\005\335\n\337\024\234\371\326\216\"d\035\013Q\0162\251\023\0026R\006\b\374\240!N\240\tkP\020\210K\351\263\270\244\306_I\253_2\b<\237N\034\r\355\207\377\300\357\330\375\001O6\372p\351[mS\213\320\030\333\323\361\246\220M\357\251\205\225$\304\337"
+	.string	"\263\022\200 [\223p\301\350\370\237"
+	.ascii	"\300\201:$)\006\344`~\311\006]\233)a>(h\375:\013d\250(r\013\273"
+	.ascii	"Gim\223\034\023\256hD\356\226\nV2)pa\377}Bd\024\257\026\354\350"
+	.ascii	"\253\255Y\n\007~\234\377\200\261\304\252o\013\334\207\rc\re\376"
+	.ascii	"\234\261\020m\336\207\256i\227g\321FaS\305qHi\364.\317c9\251"
+	.ascii	"\304\200D\252\370]\246\202\343\204q\306M\307\332F#\355{\220\327"
+	.ascii	"A\221#\035A\200\234\224\307\221\304\252p\206^9\245\017^y\206"
+	.ascii	"\026\021\037P\210\362\362\026\343\210\376i=J\377\376\350\355"
+	.ascii	"#P~\013Z\200\241\367\245\234\374\3662\374/\341\006*\374\347\274"
+	.ascii	"\223\234\251\017\342\213@m\024\245\300r\214\331\t/\220A!\314"
+	.ascii	"K\2146\274\032"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.55.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\253\001\335\020"
+	.string	"\206\237pG\360\262&\0350\343\303\n\004\2052tX2\357[zm\202\224\332\343\226\264\240B|\367\203\002\323O(\021\327\335ZP\312\377\350\374L\t=\"\301\002\035.\317\3003)\307W0v\3279\177@\245\250!\310\330\233l\231RZ"
+	.string	"T"
+	.string	"\\"
+	.string	"\273!\002\227l\227\006>2/\265\223\346\245Ov\321C\235=\320\013\232\030\220\335\355\242\210\237.\265\250'\377?\347X-\324%\207k\332\001\027\r\233\021\033 x<\266\322\250\221p\202\210\006\2640h%D<\035\016\273fh\251T\001,\330]+\253\265\341\236\267\035\301\266\002[\267v\250\322\030\302\276\266\273\353\230cO\265\310TsR\275i\352\371\327\037G\232\217\031#`\304\034\341j\230\rY\231\214Q\302O\361\330\314W\030\245F\346\352\331\335\2538\314\226y\350hS\204bwe\354\031{t\371\221\355\253\375\236\373\234\376\272`n\367\303K(:\227\\|\354$\230\016\227\317+\2453%\342\301\031\212\206\231[\224"
+	.string	"\333\261R!>\314)w\001\263\355n\002?\bT\361wb\346\345\026\271\227\017\364\0261\376\216\275O\317\372\346\345\214$jd.\237\233\224\316\034@\355\022\005\322\t\231*\242\314i\214\266\251E\317\262\3120![ET.'\337J\251\301\013\313\007\2020\236"
+	.ascii	"{&+*^\312\347\225,|\023<\2603\225:\226\222\312J\347\201.\235"
+	.ascii	"I\001\233*|`\367b2\201\335(L]\333\230\303\340G\226\212*y\322"
+	.ascii	"\362\237o8<\b\005\371\261\212(\007\351\301\242\206F2E\266\033"
+	.ascii	"\333I&\027E\242\225\346F\2453?f\007\037B!\020\363\203\013A\030"
+	.ascii	"\t# P\002A\252\3226cB?(\360\300\267@\264'\201\r}\022\253o\351"
+	.ascii	"V\324t\030Y\214\3311\200\211\210\2415\264\352]\021\354]\310u"
+	.ascii	"B\313)\267jl!\247-\320z\345s\270\237\355\r3Z\031\224\333l\023"
+	.ascii	"\223\034\342ueh9\261\220;\025\037p2\300{"
+	.text
+	.section	.gnu.lto_rcdeviceInit.56.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\243\001]\020"
+	.string	"\006 oF\360\320&\035[r}\250\316\254m\007\225{\005"
+	.string	"\n\360?'\241\030\306\307\2561\222]\232\362v7\352\222F\255L\371\256f\331\355\f\266M;\213\354\206\316\251\314\034\336Y\306\215\377u\222\203\036\267#\210\354-eJ\001Y"
+	.string	"X"
+	.string	"X"
+	.string	"2\037\241\241\335O\301\243\027l\217 '\240=\302\017\320\036_2\313\026\372W\263\367\261\301\322c\264\273\234\322\030&\353\021j\262|\234'\254G\353\021\n\330\335"
+	.ascii	"/\017\220\201\313\313\225\260\004\354\372\357\t\243\310UC\366"
+	.ascii	"\202=?$\354\256\263\345\365rk\267\215\301v\004\373D\001_i\244"
+	.ascii	"\271\201\311\t\221\2223\373k\245\306\354\177u\306&}\347\336\256"
+	.string	"s\303\230V\230NM\277\364\030\031\243\034\025b\354~\230\361\330\031\361\005\211\357\374:O\373\366S\370<.5p\300\372\316\311\2667\0372\0218L\333\243\375\023\376\347\322\343s\216\202u\035\224\255\005b\013\tjv\367\201m\223\267\350\n\004\355.\004\331Y\240|\233G[\360<\355\221\013\"\332T\3650\027+X\216N\343'Z\352\246\371\263\002\343\312\231\241\246\236\347\361\005h\306r\224\2223\325\335m\251\306l\223\362j\217\244\362-\006Q\321\226\375\236\253\350\340\333X\303*\337\362\350&(\021\022\n\027\272\022\217\303\252\344\335\235i\344\324\205\240:o\003J\244Sq)\217#\361N#\\\247Zq\246\003Ne@\251\270\222TJ\305\225\276\275\316\340|B\214\214\216\241\024uE\215\031\200LI\032G\244\001\027\333F\220&xn\250\344\216C\2501\243hPI\372\357Q\006P\321\n\214\353'\315\016\371\317)\036"
+	.ascii	"2\003\006:\206\346\016\344`\355wi\005(a\b\226\265\310\260\026"
+	.ascii	"\013(\204\263\t)\306ib\f\tE{`\240A\275g\225k\370\300\n\302-\001"
+	.ascii	"1u?\247\250\342\252\323/M\004\216\341`\002\250]e\177\317\254"
+	.ascii	"\203\"\362\272\346\023"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.part.0.70.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\205\005}\037"
+	.string	"\026t\272I\240\330M:\300\243\2022\304\351\030LO\331ov(\234\303\212\214\016<\371\377\337\035\350~\324`L7C\352\314\362\330\377\210K\246,\302\366p;\316\3720\016z\341>\027N[:\307(\2316\300\211\036jM\032!d\357\224\002\243"
+	.string	"\235"
+	.string	"\244"
+	.ascii	"\273B\007'\335\300<i\341q\312\223\346\005\224'\355\007\261=\344"
+	.ascii	"3\221\375\345B\252\245\001m \021)\356\356\355d\315q\242\327\320"
+	.ascii	"\234\266\232I+\311\261R\033\"\237\326\323{\215\215"
+	.string	"\323P\036\\A \247md@T\"F\211G\322\257|O\264\006\205\340\312G\203\232\bh\245\315\022\322x`w\317\245\027\224\034\031\374\244\304\370\025\337\214\021\307\312\215.\377:\205\261\344\202\216\264\236\255\217WU\302\340\231\024\023\324\353\221m\311\250F\t`w/\345\203\032i\200\333\320zv\327/\372\3357\267m\306v\006\233\224\020.(\320\223\360\314\335\225\340#i\241\363\255X\224'i\245j\372\361\313\022RD\317\320\nt\265\371\270u\312.\251\313\222\232\244Q\217\367\272kIM/\374\037 \201\227\233\337\256\322\0312\033E\202\365\270\327o\344~\221\017\375#\377\362\351\325\305\353\342q\250\"R0o\304\020\"\f\235K\310>\b\021\210\316%t\240'\\%\nU\305`qW\270s\322\017\314-\177\310\211\254\370\320\225\211\t\326\356\256\240\376\326\220}\236\246\364\302!\3412\371L\251\375\254\013!\272\026\213\002"
+	.string	"\366h\370\224$\274\262V(\247\033\303\262#:\3067\317)\311ZVS\244\031F\367\222\202\347[\375'\312\223d\035\303\300x\302\235\313\ts\254\026\232\3104x\031\217G\313\356N\260s\3272\"\001\325\311Zu\232\212\277,0,\377\272\002&*S> \314w6V\240P\351[\371\025!\337\312?$\350\223H\224'iLaE\263\213\275\303X\221\330\243e\\\377\335\335Z\2016\025\277\3128\245\212\013\212\037\245\212\255\016bP\307\211\037\346/\346n\357?\372\234\262I\324\206\335Q\fbm\324\352,\361\177\366\301L\341\352\234Q\001\0304\224\320\375\004\371\354r&tgN\204\356\302N\267\333\345j*\202p\3258\036 \037\\\210\034\356'EN\004nw\323\375\334J\374\370"
+	.string	"\335p;\0247\236\034\353L\344v\267 \235nw;\307\255S\356)\252F5df<T\220\341\343\027\004\373G\0322fXfM\376\255\333\272\264\306\316\213y\224(\262\263.\305Z\226\024\016[\005\022Of@\nW\230\032\335q\322\032\226\231I\026\026\225I\340|\032;\252=\232"
+	.string	"\212\363\017\245\r\"\004}\222?%\346\343\214xT{~\226\203\361\251\025a\3012\253/+\3209eY\0278\345\030n\251\337\331*\362\204|\200\201\250qH\346\020S\"$\"\245)H\322\001\200\002\231\262);\021 A\310\234\320&)l\354\031\355!\274\n \310\221\254\223\325\025\023:\352[\345b\304-\362L\2743\001MM{(\246\324s\177\207V\221e\367\311:\361\210\326\t\332o\260\224{\342\002\321\264U\262\373\1776\234\"j?\002\3667D\214\"lFS\004\377\256C\2442r\024/u\275\240\300l\242H\346Y\004;\216~\230"
+	.ascii	"]~y\0058\362!h\321yd\037\036J5\027&\013\021\250\r*D\337\263\016"
+	.ascii	"\270y\322C\017m\242\307 t\365+\211\237~\3277N\257\346\300\306"
+	.ascii	"\322XO\344\267\302\354\244\3017\335\266\302\326\243<\200\223"
+	.ascii	"<ngni\251\336\255h*\200ZjDb;<Mh\245H\305)+\244\355g\325\333\265"
+	.ascii	"H\326\332\210B\f\030\272\207H\r\375\021\362uh\027\204\030\324"
+	.ascii	"\305\376\303\360\376od\335-\255>~'\213\037\025"
+	.text
+	.section	.gnu.lto_CSWTCH.21.71.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375 cU\002"
+	.string	"T\003V"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177\001\004\003\003\004\002\002\001\001"
+	.string	"?\202\210\200(}\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\334\201\306\200\b\270\003\215\001\021/7\r\240\b"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.part.0.74.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\325\013"
+	.string	"\206\025L;01P:(\006\247\021\265\351rX'\2565q\365\345\3208w\336\017\273\314\304\013(*i\330\366\321\205\242\302\362M\b\213/\2052\320e\240\367\031\007\372\320\365\027g\265{K\231R8"
+	.string	">"
+	.string	"8"
+	.string	"'\331\356p\260f\347x7b\217\"\241\301\305\216\335\215\207*\342\3325\237\346g\251\006\367\361\\\177\372;A\302\301}@\317\001\177"
+	.string	"*\273\353\252\303\ro{\201\355h?CO\242\300\306\356\206\017\036\033\2024L\334t\373\245\216\177r\304\324y\307I\006\273y8p\350L\373*\276B{\307y\002\366B\b\0203v\273\004\207FP\035NN"
+	.string	"r\370.\201\034F\016\003\333\271\253-!\223\347<\301\240\036\373/\216\332\370%LA\223\347\016}\r\344\360\252\240\033)>l\371\321\242\n\255\201\303\214\241#\345\311\036\251#\353\373\333\335\265\212lM?\233\353\201\332\242`,V\203\313\272T\270\034XY\304.\021\302\305\202\211V\226\211\224\002\306\"\\Y\234\200aY\214\330\316\277U\221\177z%\003EjS\0130\222sEud;@\236\005\006\253v\003\036"
+	.string	"\233+0.\034\202\365\020V\363\002,\240\007F\334\202\036\026\005>\330\201\020\243\tPc\340\370{k\306&@\024\f\203K\020=:\n\301x\236tO\323E\265\323\271\240M\227\235\013"
+	.ascii	"'\017\346q\232-=\241\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`Q\002\325\r"
+	.string	"\364\023M\003"
+	.string	""
+	.string	""
+	.string	"\0024\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\307"
+	.string	"\037\200\204\001* \201\0023\177\024\270\300\0021\177!\202\200\200\200\001\"\"\005\300"
+	.string	"# "
+	.string	""
+	.string	""
+	.string	"\002\306"
+	.string	"\177$ ,%+&-'\002\312"
+	.string	"\177(\204\002/\177)\272\200\202\0025\177*\361\377\377\377\0036\177+\303"
+	.string	",\0027\177-8\177.\001\005)/\003\005\f0\005\0031\001=\1772\377\037"
+	.string	""
+	.string	"\200\200\200\001\302"
+	.string	"\1773\301"
+	.string	"\1774?\1775\377<\1776\377:\1777;\17789\1779>\177:\304"
+	.string	"\177;\003"
+	.string	"\025\244\007\003\003\007\240\341\365\321\002\001\202\001\003\004\030\201\200\200\200\003\001d\003\004\027\237\357\315\003\001\304\n\022\003\004\026\272\274\305\016\001\204\026\003\007\031\246\242\275\t\001\344\n\003\007\031\354\243\341\025\001\344\007\304\007\003\013\032d\003\r\034\315\231\263\346"
+	.string	"\001\204\001\003\r\013\302\001\003\r"
+	.string	"\202\006\003\r\033\344\006\003\016\027\310\377\241\372\001\016\033\211\220\350\006\001\344\013\003\016\r\302\243\255\033\001\202f\003\020\035$\003\020\004B\003\020\016\336\310\355\371"
+	.string	"\001\242\006\003\021\001\001D"
+	.ascii	"7 \260\002!2\253\003C#T;\b\314\323\336\200\030\372CsG\375\034"
+	.ascii	"o\221\234\366B\274d\360\005d\311\210\340\b\216\301Qp\034\004"
+	.ascii	"\312\310\032\2013\022\220<\200\036\261T{\301p~\304\206\013\223"
+	.ascii	"[\344\316\3120]\205\351\023\240\324\221\005\303\330\273\201\271"
+	.ascii	"3\013\004\\ \316~@\332\241g7\227\2321\3462~\023ol\247\265\222"
+	.ascii	"\234\017d\300J\376\224a\350G\270\033\256\325\237"
+	.text
+	.section	.gnu.lto_.refs.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375 \361\r\005"
+	.string	"\262M#$\240'i\r\377#\"\212\377\377\377\377\377\257\365\375\337\332\374\344-\326\250#\272\231\374\2445BH\333\204l)S'\245\026\001\265CS7,5\303}\341V\270\023n\204\373\340\2160C\230\037\267\301\355\270\033wA3AS\037d\213\333\271\231\033\261\\)\3003\201lc'\310\"\353$\313**B\326\354i\252\300R\031Lu\230\232\226\232,\205H#J\205(\365a;\322\r{\300\276tB\2310QS\250\030f\325AVa\247\032\375!\005"
+	.ascii	"\003\013Q\3568Cm\350}\\\355\306\256\223\f"
+	.text
+	.section	.gnu.lto_.decls.cf51e69cea8b4ce3,"e",@progbits
+	.string	"(\265/\375`\250)-\267"
+	.string	"\032\030\225>U \fQ:\0355\324\335>\377qf\335\243q\243\272\227s)r\033\347v\2748\\6\364e\315?\360+V7\022\304\035"
+	.string	"\240\200\266\255\030\036'\017[\237\n\200`\370\031\b\016\237\357\252\032B\243\247\3143\2014\352"
+	.ascii	"\355V\031r\317pMU\325d\273J\231R\nr\003\320\003\350\0031`\334"
+	.ascii	"\250\375\3003\341\357\213\033\260+LS\366\260\213o1\003\266\""
+	.ascii	"\251\206\023\334\277\206y\236\371R:O%rRb\314\250\024\311\372"
+	.ascii	"\373Q\316eg\005\363\371,\303\375O\335\277\364L$Hy\242\344\357"
+	.ascii	"7\005\365;\331\2468e\337_\b\004\3016\317{\322\b\350\300\036\274"
+	.ascii	"'\005a\205\033\356[\340\316\363\ni\231\2313\2671\345\3372d\376"
+	.ascii	"pTR\024-\177c0\037\216&0\177\305\370\274\225\300\255\254\277"
+	.ascii	"\375K\334\347'x\030\007\343Q\367s.\355]\334K\373@s^\246\271\025"
+	.ascii	"[\306\254\211J\332\222\227s\016\362\3637\257K\322d\335eG\353"
+	.ascii	"\276\340\203\373\371\027\337\323IB\263T\232\205\327d\345\347"
+	.ascii	"\347v\216\007B\211Y\323"
+	.string	"4\247%/g\250\017\007\016\0348\334dY\001\006\315\346\372\336\273\236\363\265\357y\036\316\322\367n\316J\367\nt\334+\230\201\302Cy\226\336v@\334\036\006\317@\247d\301\333b\247DU\341\372{we$yB\305\r\267k\361,\3359g\234\253-\031YL\300\355f\270\275\256\333\217\370\025\247\323c\266y\375\3658\227\363(\006\237\353\013>\264M\232e\262\034@!\200\177c\270\003\035C\352X\202\332\341\\\315\005U\334_\t8\030\276\331{\322*>\356\0042\206\355o\273\023\267\253\371\024w\342R,\264\r/\235Y\311\303\240;\310\2478\2333\261e\314\274\314\321\324@Nm\251\317/g\250\233S\361\250O\361&}\241\231\003\007\237\224E\231\271\256\364\372\023\207\342Q\r\036\245}\315\221\364\214\022\232\2419Cw\236\253\f\222\263\277=\002\334\256!\265\201\201\256!m\"\334\032\360\266\233:.\255\262\277\335"
+	.string	"\354I\\\211G}\211\253\3655sf\264\234\2419V\t\343\312\222\277\355&\264"
+	.string	"\224\371CW\300\355\033\322\035\337\2206\r\346\361\236\364\275B\232\301{Rh\333\231\233\345<aY\2313\002\3652\f!\310y\231s\016@\r\225\030,\252\277\033\274'\235\361\n\251\027\tj7R!eRA\363\316\325\n#\365\365\367:\221n\037\342d\030,\323\2233\257\345\f\245\260\003\205\001\245\365\267\241\336\223b\257\220N\3207\335v\351\003\257\223\001P\267\3378\b\261\236n;\002\f\030\\\250\341\365\027t;\222\240\367\320\024t[\032\024\314\350v\253\377\351n\237\013/\\\307w\350v\263\347\320\375\025\0240\246,\251\333\375~C\227Q\350\266\034\350v\037\006\274\206n;\242\333\313<\002\272\337\376\001\232J\207\341\240\333C\274\215\001\272;\001\335#\\x\334\375\026\264\005\335V\355n\276\306\335\026\252\277\333\006\273\237"
+	.string	"\335/\200\356\367\351~\n\272\177\202\356\337\351\376\233\356\277\335\016\330\355|\335\336\244\333\333\272=\332\355J\272\235\255\333\313\272=\255\333\317\272\275H\267\223u\373X\267\213u;\220n\017\353\366\257n\367\321\355<\272\235\253\273\243t{\263\273\305t\273\007\335\255\327\355\r\350v\020\272\375F\267[\350v\255\356\276\320\335d\272[C\267;\273{\256\333\025\320\3554\272\275E\267Ou{\005\335.\242\273\307t;\005\272\375\203nw@\267o\320\335e\272\373\257\273\315\272\233\254\273\037\320\335U\272;'000\260\373\256\335x\004\335\030\300\002J\247[\200J\312r\346%\034S\2303\347\260$\242\f\225A\022\n\227s8\\R\313*?)\345,"
+	.string	"\250\234\223\236\341r\316\311\2343\r\323\n\232\263\f\036\246.(\250\234\251|\240\262U\222\211R\316\277\266\245\255\311\204\226\345\fb\222\206\326\225\227\240I\357\312Z\236L\214\226,\313O9g\347\303]\315\026{\177\255\323)\203\214\232\r\213uE\303\241N!e`\330\030\226\312Z\271\323Wx\201\032\363\327VY\031\036\265`g\354\341Hj\376m\232+L\202\234\335B\352\201\201n!}\247\367\244\007\360\n\251}\021\324\026\206NS\310\021\266\277\024\\X\240\t\302\004\313F\213)9(+v\3126\363n\234`\367\367\256\246\317\214\f\225\277qt\317\007B\211Y\2013\032yn\017'u\206\025\346\305\314I\345\365\375\226\263*\253d\263\270\202"
+	.ascii	"\255\262E\322S\222\2472\207\003\315*=\333\\\216<\253\364c\276"
+	.ascii	"\f[R\224Uz0\317w!\211)\347\251\r`\3201S~\335\366\311\262\260"
+	.ascii	"MV\3122\355\222\205\262Q\226\311:y\324*y\226\266IviYh%9)\270"
+	.ascii	"\235\206\301)T\213U\332\344Z\031\227-\320\257,K|\330\374\201"
+	.ascii	"i\2219\034nu\270\323\267\277'\263s\002\024\030;'\370\377\242"
+	.ascii	"\357\207\0236%\325\003\212\377\204T\fw\352\003wj\003\357\341"
+	.ascii	"d\033^Z\205\357~\013\231[^]w\220\335k\321\251\311\371Y\245+\347"
+	.ascii	"8/\237\367z\337\305\243\377\345\361\372\345~\016\203/\317\345"
+	.ascii	"\2658\334Z\210\267\270\306\340\213\277A\363\024M\022\346\227"
+	.ascii	"<\016\367\213\227\021\023ln\317\360\341\236\261\253\261\343\243"
+	.ascii	"\261\026\207\263\300\3558\216*t\177Sp\3178\301\r7\303\206\335"
+	.ascii	"\307+\244\036\274B\372\366X\256\334\025N\234\340\360z\273\222"
+	.ascii	"\312\021\311iV\372\257\354\360\210\306i\375\375*.%0j\005\312"
+	.ascii	"_\033?%\212\307\305q\201\302\224\022\345\006\213.\212\005\245"
+	.ascii	"?\212N\220/*\371\357?\371&\367\204\257\033N\\\312L\340\333\026"
+	.ascii	")\177\277\355\233\330\260\261\200s6y&MD\300,\201\222IIq9\377"
+	.ascii	"\376\022\227\202\277\\(a\373\373J>\372_mN\252\376\232\200\243"
+	.ascii	"\204\021\215\373\3333K\270\373\272\313\215\024\035Yocp_<$\317"
+	.ascii	"\031470ok\032\360\322I\0222"
+	.string	"\265\264\f\330\241\375\355O\353\376\"o\344\217\\#eoz\177\321\372\202\017d\317\036ZP\177\373B\301f\036\375\263\207:\364\317\276,\007t\356\315\357\006K\236\233\332\275}\271p\337\027\330\307{R\273\026\324O\244-\212\022\0312\337\243\031\022%km\310\217\265\350+\013\373\373\302\036YK{\372\273\305\"\017\307\353Xr\344\352Cw\220V\223\007\346\356\242TG#\2579\365VQuRyj4\036Kg\311\223\227[QA5\376\351pT<yy\344\251\253\351|,[\306\304jG\240\362\222\234m\206\223\375\216g\361Oy\253\252+\347\034\224\345t:I\236\234T\347\324\365\313\337\361+\234\316B\273h\324\266d\274\322\357x\250g:mQ\211=\220\347z\257\357\361]\317\343\177|\330\177=\330\373\370 /\304\243\277\343[\364\333\370\033\237\374\035\257l(:Khn\246[V\034|8\350ta\032\"\206"
+	.ascii	"\267\314\347H\235\212`\001B\006\267\355\303\330\263\355\202\333"
+	.ascii	"^\301m\231<\333\351~\356\312S\022\022\334\266l\303_\325,\241"
+	.ascii	"\031mhK\355\211\030n{\343g$9\273\263\373\333\266\211e|U\362M"
+	.ascii	"\017\217\252\277\252\275\340\344|\301\272\020\323\321\3671\272"
+	.ascii	"\273&\3651Dy\025FZ\364u\301E\244\206\223\277w\352\231iY\222$"
+	.ascii	"_;MPPW\312'H\334\tO^\006\337\233\216\033\325"
+	.string	"W\312\006PI/\211\305\341a\013W\217\253t\225\256\323\004F\230\204i\342\2473g\243\311\3516\365uJ\372\261\303\204\313\"G\254K]\325\322e\252q\3128S\"Y\n\202\273o\276K\037gr\017\204W\234\016@?\373\364\342I\330]\336$\032/oX\334\376^%\236\023\263U\345y\223:O\177\177\026\320\007g\"[D\362p\222"
+	.string	"\303\312\3302m\001\227,\305\220\372k\311<\323~\221B\"\347tYa\270,\301\303\335\327}V\214\037ak\332`C\267\0057\303\257\255\230\337K\202\347\374kOx\346rI\346\364\327\206q\272\232\2636(\223\225\217(\0365\214\360y\324\362\375\026\021Y\331\334 %\271\205\214\375s\263\361\344o\347D=yb\365\226\364\262\344\211\220\323\272\322k\233\327%\206\0272\177\277\324\254)u\211m\301\375\341\212\323\215\021\201\352.\027\222\230D"
+	.string	"\031b\244\212\323\351\330\234\257\214t!\261\022g'\346W\006\305R\021K\222\227\263\330-V\213\345b\361\254\027[g\273X;\217\332;;\247\346\346{\016G\365\200/\266<:K\205E\231\235\330\335\003Z\271\013IL#\256\306\232w\366\315\351thn\224\331\211\371`.'G\244&\270\215c\206\033'L.\256FI\353\251\324Y\022\265\034\003g\261\344"
+	.ascii	"\206\311Y\375m\034'n\234\031\270q`\340\306i\342\306y\302\215"
+	.ascii	"\263\3046\212\225\342Q\037;E.)\312\252\f.A\016t\237\264o\370"
+	.ascii	"p\337\3145i\217\332&>FD\222\331\241o\242\264\265\331\257\273"
+	.ascii	"\273.\374u\227k \301\321\250e\303\331BU\\\225\030\227\335\230"
+	.ascii	"\022\217Z%\226\306\006g\236\312\360#n\bU\207\034 M\252\236Xk"
+	.ascii	"k\226\355\257\354\331\345\207\244-\033\031\224<1\037\rB\321\341"
+	.ascii	"\367\267o\222\370\310\021\233&\"O\340\325\334\361\301b+\355o"
+	.ascii	"\232\357\325x\201e=}\201Z3\250=Ksv\250S\212yVVf\271p\322\247"
+	.ascii	"\317\213j\303\314\227\036\225/j\270m\250\212\024a\222:"
+	.string	"\255\335\271\370\3336J22\337\363\311\266\213\327\263KlG\355o\205\032\037\266cc\276\347\320,\345<\312\2369\343\307\330\034\026\263[b_E\265\2541\002\304\243\026\210\323\271Y\226\262Y\212\323\001\350\227\363\224\016;a\200\320\340j\021\346Q\033\366i\016\315\311\233.5\250:\244N+I_\177\273F\t{y\331/\317\031L\357\331\345\327}m\277f\344\302z\260\335\371\210Z\037\376\347\003\315S6<\232\314)\035r\252,\201\301\302\202\333\205\270\345\341Q\313\303\315|\334\271bkL^f*uh\f\005\347\310a\271p\316\031\004z\317.\261\266:\332r\361\334\270S\372\333}\266\006\016\213\033un`\366\306\307p\372\232\372\333\330\206\265a\2376\253\255Vk}\225gf\316T9\251\227\201\023&\317.\277L\305\334\3204x\355iV2s\316S3\320\314L\302i\237q\337\320\235\343\326-\350\356\333]"
+	.string	"5\347d\031-`0\330\022\345\214\316\220{\006.\347\34539\201gs\371\214\301\204\366\314\311e\217$\005f~&\231\320r\246\220\227\313d\bg\246\300\204\226\233y\205\\\3233\364\231\314Kg\246\220\227Y\231\201i\371l2\241)\233\024\230\320\236\315\214\366\314<y\251d\262Xf&\205\214\366\324\313h\316&\017\023\232\263\311\204\366\304r\031L\200Q\232d\264d\371y\034\3232GAY)\231<pLPg\326\222\263\257)e\246\0059[9\231Z\2241\274-\t.*IICj\221\ta\321\003\344\210!\265\210(\374 \303\220z\204T\342\003$\021"
+	.string	"<;E\365(\204\004\250H\241Z\244\222X\300P-\026\215BHc\221\220\206&\372\0012\022\003\220\006\207jph\204\n\243\t\032\01760b\004!\016\202\036\204\b\001\204\240\020\211`\211\021\024\324\240p\002$1\004\007\253\212\242'\203\332\241\211~.0\302\210\022@\253\212\342(\\E04\026\t\251G\243\220\221\272\"K(\261\323D?H\243a\317\332D?k\021\311(dBxDQ\203\f\346 \203C\025\220$\030\217\027Yd\034\336\016x"
+	.string	"i<\272C\352Q\250\026\riR\022\214$\216F\344\021iXS\202\260\350\bI\f\261\026\325\343\021I\350h\007g%\026G\340\250\253p\350H\003M\364\243\342\b\244\342XaxL1\f\025=@\216\240\240\241H\030\242D\bCE\265\304\017\212\"q%\nI\350A*\252 \024G\350\f\251E\343\272\"u\200$\356x\370Y\217\302\243\037\0034\321\017\n\342\211\242q\030,\"\035\201\206'\n\200D!,\372"
+	.ascii	"E\221ht\024\336 \2218H\244:4\036E(2\036\205G\325H(T\023t\301"
+	.ascii	"\217\b\241\0218PB\250\006\211T\217\"\b\225\240Z\340\203Z\301"
+	.ascii	"Q=RU\0238=T\213\206\212B\021\027zH<\252E\025\005\356\f4X\200"
+	.ascii	"\006 T\3204\210\r<l\340!m\020\033\004\005"
+	.string	"m\240A\020n\r\202\254\032\\\213j\n\017JP- ,B2\"\2260\022\n\025\200\246\211~\200\210\307!\342\t\342ZT\207\2106\033\340Q\213L\bGH\221\252Au\310\b\202\215:d4\272j0\204\365h<\312A\026\215\304\365\310H\243\256B\022CHB\023\370\210\327&\372\t\002\025\215\031\212\210\302\365\"\203(\212\304#\216\b\220B\243\273\006/\300`H\250\022\335\016T\2548\005Q\035\252$|l\216\253\b#z\326 R\003j\321\020\021G\004C\241\211\242\"\241\220\212\243\316\332D\030\206\324U\230\202\270\0169@\022o\220A\225h\270\022I(\241\006\221H\253p-\341\263\026!!\325c:T\024\032\031\031\2074C\352:T\217T\250;E\365\0027'\220:H1T\2174+\222\221f\r\"A\300GF\302uE2\252F\304\225\247gE\006W\025\352Z4\n\211\240\"\213\306#\244J\202"
+	.string	"\303\"\322\007G\025y\024\036\331\2445E\365\002\302U\030\302Hx\024\036\341 U#\342\b%\034W\225\204\n\241Q\316QE\"\341\265\310h\354 8S\302\220P%\201$\322 \203:+2\210\263\036\215\"\024\t\211G\025i\263\006A\320\034\325\023'\220L\244k\023\375Xh\343\221z\004Z\215\306#\320\315\032\324 h-\022\2210R=\"\255B\365\004F\006\215'\212#B\030\t\207E\244#"
+	.string	"\324`\321HD\036\325\024\301\001tP\220P\006\r`\200\002x\370c$\034\006\325!1\205:4<\002\031\211@E\242\320\bhxD\002\375\\8\252\033(2\016\215\253\361xtc<Q$\336\037R6iA\360\326>\354^\341\037_\256\274"
+	.ascii	"\373\372bK\001\367\2160\351\352\262i5\036\274\342\254\340\313"
+	.ascii	"\343\366\350\353\243\257\217\277>l` \231\234\225;\356\025\270"
+	.ascii	"W\220\022\241SKwX\256\231/`NI\256\263\213\244\nG\226\016\027"
+	.ascii	"Qr\374\220\2729\304\370U\341\033\2737\356\r&5x\206\340\356k\303"
+	.ascii	"\002\346\b\261\333\013\334ZZy\001\375\322\352\353\2447\026f\307"
+	.ascii	"u:\357SD2g\251\344\255\321\367\231\003\245\n\310\f\036\034VV"
+	.ascii	"\367JH\227\265\033r\305\205F\337+\270\025~_\317\244\221\322\263"
+	.ascii	"\201\025C\206\f\3136\326d%\206\003\246\027\203g\211\212jMg\211"
+	.ascii	"[\324\024\034\f\030\327\205\363@\223\352\222t\355@"
+	.ascii	"]t%\277\232\315\353\302\307i\353\2204Y"
+	.string	"\211\031@)+\203\204\250\202\301<\213\342\230B\244fdD\222$I\007B\n\020\204\302Y (\356\r\022\200\024EN2\310\320\314\210\210$\005I\241\2601\006\271@\024\004\021\345E\271.\371F\221\363\246\342\005U\354\242u\331J\016\007\347\224\230P%z\241}!\327R\376\362\272\304\205\"3\305O\311\033\244r0\275\013\252j\311\210p\326zmO\206\324v\327\371C*\371G\312\321\257\342~\342\313\322\tby\2662\362\211\251\246\216\225\223\353\345\377|\342Fu\326:\034i\036\016\310/\005\261\002\030\216?\002otQ\325\253\306\206\220\347\263\262\241\002\332\227\273\034\367K\256P\252\254\177f\002Y~Lvu*\375\025\333\330\356d\217\302M \327\267\303)\226\006\273\337\321\207\313_E\304L+y\201\240f\222\260\311]\"\250\001\335\n\n\314s+\027\002\351\022\023\261\232`\352\302\006\224\0262\f \373\001P"
+	.string	"\025\350\227\373\345\341\243A\030qqA\372\206\243[bxI\236\203\237\026X\333/!OI\006/ J\177\310\242f\006\016S\360\271'f\367\\\347\3617\016\224\262\025\352O\322\3010\250:A\217\b-\342igs\020B\242\001\354\035\254\275\263t,@vH\263\215\357\027\205\005Z8\305\213s\025\3361 A\320\013\360z\256\033\025\260ze{\202\377B\314p\030E\320)\316\2446\020\266\027\362\021\016n\337+\321x\256\204Zy\240S\224\273e\357\220C\324e\035k\301\236\276K"
+	.string	"|u\301+~{lA4\0377\016\"\315]\204\212U\002mq(n\027p\223<*\005>\272\233\301\361\306L+\264L\221\276\213V\2367J\034ln;\347 \250\326\226o.\r\262\020\200\315\275\364PUPj{\203"
+	.ascii	";"
+	.string	"\342\247\352\265\222f62\254|BT\246\243\224v\331\246\226\234\240$\346o\221\036\201\253b\267\310\331\016\344\005N\252e\006X*\3158v)\005\037\344\254\017\030\336\342^\227\217\217\247C\370\035\260\305\0135\365\337\331\2670\b)t\303)\006\304\314G\213u\206hdM\tf\340\217\243rsC\021\013\241\367\337\246\216\267gm\363\274\320\243\342I\253\036\364<\252[sU\350\220%9\003)\221k|\345\367\022\362\332\224\263+\322\341\3508\233\344\322\021\324\242&\335\242v#X\261\030|\331\017\346CL'\221Y\215\347\341\200\323j\352}\n\306\252\206\244=M\200E\254\262_\335\306\227\017\206\231#\\\330W\0258\331\263\211\323\370\\\"\233\237\201H\234\bT\240-\214\016\327\312\350\003W0[<\213\225\335}D\227\016 E\247\332@\274S\372\003\304@P\202z\224<\244\206\243 \005\374\200\374\nI\332\365\t9"
+	.string	"\233,wE\341X~\262\227\244u\003e\243\271a\347l\227TW\205\375\217f\226G\227\345"
+	.string	"\336|t\375\350ST\207\243\343b\264\256\231\200Q\036{Zo7\3445\364)@A\253.7\200K\232&\177\334\034C\343J\232\205+\273\032\366\002sh#J\\\233\226\352_\024\300\206\320\226q\206B\301wV0\245A\316\2611IM#\b\240k4\327\323\201\027\245\202\264K\264\003\256\345\345\bAhWf\n\376\362Hk\222\227\205\301\236b\346\026*w*\001\370\352\355\214<[)\303N\271r\312\fk{\030\230\re\223V2b\b?\337%@H\247\327\310\027\203\234\346H.H\242\236E\b\360\3569^[\332\004\216\220\315\023\302\315\337\351\365\335C\030h\342YM4\353\003"
+	.string	"\313(M\313\326\351\326\332$i\":%\024\255z\235\267\242\376\026\325\241\260\212\374\363 \353|\036\013\272\263o\214+\364\234\332Fd\003~\253\375\037a\233\2332\0374\026\265A\332\243\265\326\301F\222\257}\t\226\224\342\030\262\316\222r\271S\3621\r\\r\323v\253\243-\004\377f\302\370\373\223\354\214\246x3\224{\2152\307\302^\221[\026\206\027Xn\226~J\026{\b_O\240\206\300\311I \237\371t0\b\253\256@\260\220\003\333\001EG\201^\203(\333\201\362"
+	.ascii	"\203\203\200!$\356,\307tl\036,2\016\242\230\262\214\264\n\345"
+	.ascii	"\244\205\3653\"\260e\031\342\331\242\2000I\355Ky\212\334m\375"
+	.ascii	"G\253\237\314Flbt\304\257\320c\177\242\214\002Ur&\357\377[8j"
+	.ascii	"y\322\360/\013Z\245\202\237\215/2\343\357\325b_\246`\300\022"
+	.ascii	"\002\354\275\217\036\240\252\246I!F_\032\025-$\207\037\355WZ"
+	.ascii	"@\264HQ\025\363\236\306|\234S\260rv\224\343\203\304)\212\324"
+	.ascii	"\207\306\232\312\337\271\351\t\325\347\362\317\006d\274\312B"
+	.ascii	"re\223\214\330\0233\315\233\316\361<\352\365\033\007\033\034"
+	.ascii	"\211'\200\372\220\355@&;ug\\G\310\316x\243L(R\325z@\230"
+	.string	"\353\215v\246/\323\030\021\035[\021X\344\f/\266\020\307\023\023\313$\\K\360\276i\213\370\253\324\b\305,\336\316`\311\205\350s\256\013\361\226\"\300%,\202\323\346\2538\3357\002\220C\314\251l\r\215\362i\321!\262\025\037W\201\237/<\331\273\242\261\326\377i\007O\305\212}-w|;LC\344\246)\346\377\203I~\235\non\225\345>\323J\352\361.{\205\273rS\337\224\372\315&\267\026\340\217`\225\036\003\365\310\341\217ha\226q\211\207\031\223 \231E)\242U\025\213W\"\247\005\\\312\242&DHFR\275j`\200bz\276^\310\337\332\204Us\215\323\t\244[\240;\341\242\353B\252\276\b\332l\3265(\"\376\205\311K>\270;\322\331\247\303:N`\356\244\"\030\306\"\360\241\024\372\235\016\233b\022\324\211I\205\275\024\262\036R\207\254\357\271\334{f\310\353\206\313M\026\201\346;\262,\236\006"
+	.ascii	"\371q\325\225B^\347-\321\035\377\267Pk$\206\025j\350\017\203"
+	.ascii	"\321m\265\026\2267F \n\027&1\202\351C\2660\222\220\235\213U8"
+	.ascii	"y\036\205\031\331\001m#XL,4\034\302P^2r\337\351\025=\217lT>\241"
+	.ascii	"\362E\375\315\n\016W\207W\374\354\343n\347wr#\211#\210\027\360"
+	.ascii	"V\215\306;/\004\034\214}r4\301\233K\376\376u\356\320\317I\356"
+	.ascii	"U\350)\265g5\177\b\347S>.sHA\257\277=3\370\305\177>\360\023n"
+	.ascii	"\373\363$\264s\376\227\303\215\177O\365Kf{\237\207\356D7\252"
+	.ascii	"_\265\226\024\036\353\367%\371\350\317J\fg\234\347\246_\256/"
+	.ascii	"\266\037s\3531\317p\256\236h\301\b\256g \375\003?\257\214{\366"
+	.ascii	"v\207O\224\265gW\242\243\255\013\310\253z\275C\f\003\313\237"
+	.ascii	"a5u\230\361\005p\031|I\216~-\237|\236s\037\035>o/s/_>\344\274"
+	.ascii	"\353\2254qx\356\352\307\325\344):5\027\020\347\rS\226\037\004"
+	.ascii	"\016\341\003L\\\003\037\352\001\237\276H7\221\01741v\212\273"
+	.ascii	"xW\013O\210\006 \325m\223\275\312~\nA+"
+	.text
+	.section	.gnu.lto_.symtab.cf51e69cea8b4ce3,"e",@progbits
+	.string	"camDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"isButtonPressed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"rcdeviceInMenu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"waitingDeviceResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"rcdeviceSend5KeyOSDCableSimualtionEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"pCurrentDisplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cf51e69cea8b4ce3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
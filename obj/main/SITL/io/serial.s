@@ -0,0 +1,1358 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\035\n"
+	.string	"D\020\224\001"
+	.string	" "
+	.string	"\374\255\365\254\f"
+	.string	"\001\303\226\316\200\r\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\226\230\365\242\b\003\313\347\334\342\016\004\002\003\002\005\004\357\267\360\307\013\002\002\006\002\007\005\333\375\377\333\001\006\303\276\302\323\013\002\007\232\255\221\221\b\002\002\b\002\b\b\240\342\234\212\n\t\232\226\312\363\017\n\253\340\320\236\017\006\002\003\002\t\002\n\002\n\013\f\r\215\311\327\216\r"
+	.string	"\016\233\275\224\204\t\002\002\004\002\013\017\351\255\236\303\002\020\217\231\357|\004\002\013\002\013\002\f\002\r\021\257\212\370\224\001\002\022\316\243\347\220\007\002\023\204\203\343\357\n\024\270\244\362\345\f\b\002\016\002\b\002\003\002\017\f\002\b\025\354\370\226\200\n\006\002\020\026\370\346\324\256\r\022\002\003\002\003\021\002"
+	.string	"\002\021\027\030\342\363\276\212\b\b\031\233\246\366\244\b\002\032\254\213\274\230\b\002\033\323\201\221\330\r"
+	.string	"\034\201\277\202\244\017"
+	.string	"\035\220\232\212\335\n\036\037\240\342\234\212\n"
+	.string	"\031"
+	.ascii	"\225 \254\2500W\005\206)\232\312\334{)qs\300\314\325\0244{\233"
+	.ascii	"\233\254\264%U4\025\302\224\031\f\227\033)M\216\222k%j\232\023"
+	.ascii	"P\330\260\234\301\212\265\231\031k\327q\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\325\005"
+	.string	"\002G\023\032\200K\322\001K<\300\300\f\314\300\314"
+	.string	"\307\266m\3336-\302\204\220-IJ\001\256\245\374\313\025\331\003\331c:\032\273\213W!Z\317Z\222\325\214vRB\304<\030t\0276\302\314`\315[\020"
+	.string	"$\264\372Ujy{\324m\367\227\341\2232 \200\002\251\263\352\366H\242"
+	.ascii	"\223\001\205$\203\211\001\361\006A\022\203\036qz\244\253\007"
+	.ascii	"\356\227x\016M\2200u\307\255\205\366!z\027\375\027h$\204'\235"
+	.ascii	"\335\r\b\366\270b\023\306\335\021\216\303\021\220\003\376\246"
+	.ascii	"\211\005\315\"Wp\337x\376\232\235\326\211\231C\036\367\203\205"
+	.ascii	"C,\013\032\r\023\331\005o\220r\022I\033\200\305\305\035\002"
+	.text
+	.section	.gnu.lto_.inline.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\236\004u\027"
+	.string	"\026\345\203K\300\020)\035\032\266?\341?\277\267^>\325\350,&-\262\236zv\343\377E\025\304\356C2\310\301\3168\375\315\262x=\212\"\2130\355\272\244\246\251\310`\177\266m\212\242\260\315\302\216^P\270\r\243E\234\315BH~\267\275\245L\001p"
+	.string	"e"
+	.string	"v"
+	.string	"\341_\267\2262\372\311\304\250\214~2\257\207\034\255\\\027\371zU\275\344\353U\205\267/\366G\241O<\250\335\210Be\360\240v\341\231\2547O\027\275y\216\254\233\247\255O\bDA\344\255c\310\340\254 y\007z\363\244\377_\325\3264\\\224X\214\377\215\342\274<I(I\351\t9!\035\221\363\337\366Wp\357m\371\373\347Z\337{/\375eg=\b<\036\251\362$Sx\245\331\330\327\003\257\265\236\361\351n\354\353\354\263\366\351hN\360\311\326\377X37\356?\013\261\330+\267g\023j\245\2431\341zG\035\360Z\243GV?\243\360\225|W\362]\021\320\013=GS|\360\325\376\377h\346\237\036&6\377V\354\225\327\363I3"
+	.string	"\212j\022?\376|\027\265\321\236{o\271\230\b\0368t2\204\020\022_\332\203\277\007\b\036\254\365\207\273S#<y\032u\311\375\234jKO\003\244\234\260\376/\233\231\307e'8H\263\360[\034\300\226\255r\372\233\271\342\031y\314\244at4K\241\255+$\371|\304\177\300LZ\004\021\025R\353Oi\247\024-6\020\2407A\032v\002\356q"
+	.ascii	"C7\317\233\347\310bW\213\375Oh\024\212+\f\261>3\0057O>\355Ug"
+	.ascii	"\265\312\232\211X\3268Z\300\312\032\327\365\254\322\275\242\033"
+	.ascii	"$`/\371\305>\330\2630\203\303\210\352\003\342ETx\222\221\377"
+	.ascii	"\264\356\032\025\2718?5L!9?5L\035\017y\2655P\211\033\233\361"
+	.ascii	"\204\376$\331\210!O\336\3267\247\302E\275M0AK$k\210\313\306\361"
+	.ascii	"\317\302\006l\331+L\3177\n\303\301\316\324\354 >\273\005J\255"
+	.ascii	"b\250\361,#\304\031\207&\030Q\0205\035\200\002!\2312z\022\240"
+	.ascii	"\265d\2068!\222PP\201\202\2222\312\0364S_\375F/\341\344X#\334"
+	.ascii	"0i2\204\231O\200\f\210\332_\202pP\222M\236\223\205D\360\377\322"
+	.ascii	"p\205V\367\247\337\236\215_D\324<\273\211\252mg\225\001,\255"
+	.ascii	"\326\374\356\266T\262|\200\253\265\270\"\360?\345}\365\032\271"
+	.ascii	"\210@\001\211\374?\003`\371Z\2606\341\237\001\322\344\277\027"
+	.ascii	"w\356\302\006\264\034\321\241\t\226\327lzTN\226\361\327\035\035"
+	.ascii	"w&m\260\003\320/\005\344\373\263\023\021\315\016\203\301q\307"
+	.ascii	"\351\227K\327\372\342\210\220@^\316\257&7\230\020,_U\023o\362"
+	.ascii	"\024\034\344QTY4\375t\035\007\021\225q&\266\272G\0344w\236%\326"
+	.ascii	"Sp\235Z\003_"
+	.text
+	.section	.gnu.lto_.jmpfuncs.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\322\002]\f"
+	.string	"f\22260`E\223tPA\b\202\006Qhab-\017A\020D\t\321\b\006\r\324\006\020\001\210c\034\342\201j\377\377\037\233\025Z\211a\250\3577\"D&\031$"
+	.string	")"
+	.string	","
+	.string	"\366\031\353\374\224=\372jW\177\370S\";\354L\001v\271\344Uq\270\342\314y\312\332K?\244\344\363\301\024 \267\276\006\244\244\311\270\242(\212\356\323\373\005\017c\r, \213\250J\371\247J\316\026\343\226h\212\337\314Sv\371r\372\2763\001g\002\247\250\322\251\236j4t\206\036\351\013\235\322\237\036\324\213\230x\341\340A\017\224\320\t\002S\024m\274\371=xz\016\210\365\364\b\032\354"
+	.string	"\276\342\306\330c\216\367\350\255\246\325\364"
+	.string	"E!\203\361m\254]\023\t\031\201 \244F#Q\207&\203z\225\262\361U\350\202\030K\250!\265t\244fD\022\203T\2061@\002b\0342\363\021\3200e\030$DCC\355#\364"
+	.ascii	"\355\220/?5=0]\332\2562Q7J\"S\247\374\245t=\177\372|\254\315"
+	.ascii	"\376X\235\262\352\025\202\347\211\r$O\2253L\252\022\221\246\016"
+	.ascii	"\3618\306v\261&3$\375k\222#\266\260a\nQ\3325\215]\242\b\2107"
+	.ascii	"\233\030^\f%\r\254r\275\244u\001E\270\234\\\004\346\36241\261"
+	.ascii	"w\034B^\207?\b\374N\327^\241\037\200\317\207\304/\2306#\021\034"
+	.ascii	"\302\363\032\234\217\266A\024\375\004\0136\341\200Wq\025[\370"
+	.ascii	"\313n'Z\303{\007"
+	.text
+	.section	.gnu.lto_.pureconst.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375 II\002"
+	.string	"E"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\200\004\001\232\004\003\230\004\004\200\004\006\200\004\007"
+	.ascii	"\205\004\t\205\004\n\271\004\r\030\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\231\004\022\205\004\023\205\004\024\232\004\025"
+	.ascii	"\232\004\026\230\004\030\230\004\031\204\004\032\204\004\033"
+	.ascii	"\270\004\034\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\f\001}\b"
+	.string	"R\315*.pk2\034\b\255\377WU\027+\004\266\360\307\300\223q\001\252\212\365\277*A\360"
+	.string	"\371\213\276Z\240\246\036K\324\026\363]\177\223\266\311\336R\246?DH8<O\n\020\216\005F\310\306\304E\325\252g\227\036H\345\f\006\263\240\341V\265\226\367c\357R\276i\245I{\246s\323>+QT\241P\323\004\013\345\n\235S\353\326\304\271)\345\323\363:\020@\t\224\t\235\232rM\373A"
+	.ascii	"\t3\345\037y\2144\b\262;\277\026\323\350\2408\031;\327\250\271"
+	.ascii	"sG\205\240V1\177\036\364\233\367\037\016\ff\316\245\256\021\312"
+	.ascii	"\016y\271\345\366\364\b- \240\202\241\233\352\225I\214\021\302"
+	.ascii	"\305\320\373\023\374\225\321\355\241\260\255\271\231\235\376"
+	.ascii	"\242Z,\276~M\214`\317\201\235,\267\320q\206\230\321\221x\231"
+	.ascii	"\262\270R0\3069\357}3<\204\227\305ak\354(\264\205Yh\301\327`"
+	.ascii	"6B\036\211\301\334yZ\307\276m\267\331I\366\211\032\355\373\264"
+	.ascii	"1\314z(E"
+	.text
+	.section	.gnu.lto_.lto.70e485b4a26296bb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.41.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.43.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.47.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375 \222\035\004"
+	.string	"T\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\203\364\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\006us\375\005uq"
+	.string	"\005\001\006'\001\344\r?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.48.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`$\003\265\024"
+	.string	"\326#\201J\300\322Q:`P\200F\003\350=\274*\240\373\033\235\260\007\247\2005\311\337\0025\016\00444\311\002\221\224\3152\232\331\372\304t\3059Z}\250\026L\306\"\223B\030\032\030\314D)\302K\217\372\374[\332\205T&\302\310&{\247\024h"
+	.string	"e"
+	.string	"q"
+	.string	"\017\222\371\200\335\035%\033\273\244\003\233\210\257&_ |\025O |5\315\216:\331\263/{%`\374vw\244),\036$op\322^A:i\276\320'NR\371T\224\253\275\202#67N\001r$@\227/\b\212\232\334m\202,rN?\364\271\243\272=\025\345r>G$\354\256'.\207s\207\267\035\3026\004\233\276\004<\333\274\242\224\310\246jG]\247\233n\244\260\365Jm\021#\346q.\001\"\253\244hh\315&k\223\362\330w\371hV\230\356\330\254\007\375\365\345=\347\364\005\244\334\374|\bz\354\232\270\262\332\245\312S\361\362\366I\177\310\305_\320^\372H\254\335\210De\224\324\356\266^\375@|U"
+	.string	"\236\304\366\247\375\237\003\321\002\237\224Ect\250htn8n\247\334\007\323\322\256\310\317\031\256\224\204\304TD\007j\370\016\0359~\365*\241\275\3417Tx;V\315J7uj\257\274\006\213\t\024\215\027\203\236\335u\275\332-7\202\211\273\033a\006L\007\003P>2\341kh\204\023b\233W1/r\021wg\\~\214\313\210\201\367y5\210Yx\334\253?\243\037:\330\242FU\025\260\267\3008\274\304&"
+	.ascii	"0\313\211\207\025\230\3545\033c\260\361\005\266\3422\262\310"
+	.ascii	"f\343\311\001\307>\274d#L,&\033I\310=\3351\205!K6z\263\233,\034"
+	.ascii	"\bJ\t\tN\222\216w\341=\025\261\302\211\037\235\237)\333QB\033"
+	.ascii	"\303\237P\0268\275\022\374(\271\320[\276+]\245<\036\341AY\224"
+	.ascii	"\366f\353\223\326\370(\234\364Aeof\0229\270\273\0136\bB\250q"
+	.ascii	"L\302\2242\025\b\211\210\310\204\005\315\003\340\002\2219r\003"
+	.ascii	"\021`Q\025\220\310\220\251G\213\001\255\240\004\306\027Q\351"
+	.ascii	"\021\024}Pw\037\211>\201\202*\326\0068\"\237X\006\361\340\213"
+	.ascii	"\321I\254\037\364\336\376\262\244V1\203h\272\326\341\326\210"
+	.ascii	"\334F\272;\316\343c\333\303Dbc\022\253\323\022AH\320\033\336"
+	.ascii	"{`@\206M\007?\374\325\251\315\304\267\216\263z\361UDn\256\006"
+	.ascii	"\324\033\2551\232S\277\203\345\350\020\244.?\215\2110\200W\003"
+	.ascii	"\251"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.49.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\223\001M\020"
+	.string	"\306\236mF\360\316(\035B\306\355E\263 k\205\355h\356\356\177\374\341\r\273f\206\001\251c\237\363\024\233\207\3434-w3\374\304gJ]\355`\317=|\253\320q\270\253\340\247\361k\254\242|\235\344M\351\373\202\020\262\367\226;\245X"
+	.string	"W"
+	.string	"Y"
+	.ascii	"\3632^\300\274\\\027\007x\254\367\204\247oS\306\205'\377"
+	.string	"\344[\334\235\021,\031\237*v\264\\J<v\310\372Pp\306\254\\~\274pV_\206\307\330\001\373\320!\343K\211\013b\246\363\371Rp\037;\202\227\332\352[9\334<(\245\206\253\017\303\315\3356\3136\003\373!\002\247\3717C\313\327;\276\336+\241a\204>\200\317\206\035\r\036J/\324`P\0232\307\303\353o\233\374\230?V\320\300\364j\302Q\230m\346\202\251\240\264j\\\332\203\3604\025\334Q\312B\023AiM\340\003\334\345e>c\362)V\016\337\226\"\243\262iAi\365\f|@*-\024\254\301Y\214\013\r2n\334]\226\275\333\355\307\013\247@\255\321\211\353\362\266pI2\024)\370\302\302mD8JS\034\276\3545\243\370\327\245%\224\346W\227~i^\302\355r\342~\037{$\361\232\251b\240\300\332\356\260\200\255\330u\331\365\004\236\343F\345\204\267\305\035\027\024B!#\"\031*\001=\b\231"
+	.string	"\202\300\031d#\002HD\n\225\274\221\310\033\021\201D<\020R\311\333 \340\021I\210\344\225\214F$\257\322o\213Ih7\323?\315\307\336\301\320Z\261[)\327\036(\213\342\331\326\345\005=\222[\271\202f=\205\254'\005_<RJ\351\\\327Mf\\\316\301\314K-  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.50.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`}\001\335\017"
+	.string	"\366\035kF\360\222(\035\022q\347\326\244\212\036\036\t\334j\b_\224\370\353j\352\376\223\264\273\205\200\034\377\025\250\241\n\177\355\327H+C\fn\035\220\364\321\234\313\342\260\310f\216\263\022\013\360\026\276>Q\377WO\310\336[\356\224\002W"
+	.string	"T"
+	.string	"Y"
+	.ascii	"\361\002\346\245\206\360\366\b\273',]\2332*,\371\246kQsy\321"
+	.ascii	"1\362\265D\023 ?b.;\\}(8Q\300\\:p\331P}\035\036c\003\027*F\214"
+	.ascii	"|\030\242\312f3>_\n\352eO\340\252Q}0\207\332\311\356\032\252"
+	.ascii	">\016\367v\333+\333\f\354\237\b\257_*\264>vC\b\375"
+	.string	"\355\363\302Q2\333\335\320\303\2637\344\215\211\307n\037\346\313b\306\331L/\333\214\206\206\316\356\222\\z\301vy\273d\177\340_\027\f`W\206G\306\356\226\370\300vy\026oQ\262q\"L\304\367VM\013\315\220\335\345\f|\300\274\f\207:e\nWM\006\020(\330\003\265\204JH\016\031\025\252\246+\027H\235xDmY\352\325\233\331\221\202;\026\036c\302\266\2332\361a\234\206\024O\342\322\024X\346U\227>\313\274\274^v\0042=V\334\234`\217\316\\\210\330\250\266l\230\t*\313&\210\006\017V\226\255\315\007\025B*\242Nz\241\356A\267\"\n\251t\001\234\002\202\200\322y!\0227\3528Q\207\022\201K\361H\034\210\200G\022B\036\2672\032y\334\307{e\371/\276\351\324\3601Aw\324TU}rR\324\007M[\376\304\310\251\232\003I\016ue\234\t\365EfrRp\347qww*\b\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346\027\025e\353\3514\030\322"
+	.ascii	"i%\307x\204\233\307,z\346\255\002SP\3278 \204D\t\341\230\361"
+	.ascii	"taK]PS\344C\205\373g\0062e\t.ET\013\201Ac\257(+\324\215N;\311"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.51.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`1\002\265\023"
+	.string	"\326\245\205I\320\322(\035\322\270\017%#\226`\025\345\373\240\344\253&\262\n\327\317\314\206\230\307\334\247\275\314x\376\370\"\020!V\017\374\365\207\024\347\320F\340\367\351\305H|\301\r\324\223\315\242"
+	.string	"\005\254\260\233e\264\003\376\243\222O\366\226;\245r"
+	.string	"l"
+	.string	"r"
+	.string	"\007\346W\234\205\314\263\002\272\234\232\224\013\022L\017X\253Ne\335\007\204\247\342\005\204\247[\302\342\247\356\016\345\354\247\220\316\2253\237\345\247y\222\241\3111r\203\231%KI7\347\321d\230\302\346\264B.h\273}\370\234\021Z\354\230\030\271\271\314\335\375\204\356\273\214\271\325\344\236w\031\304D;\352\271\331\\\236Lj\255\226\266[\315-\336\366\315\266\211-)\0048@?<\204\360\342\330\250\353~1\2644\375\356\236\357\335K\245\345\224\276\210\005\035\340\022\211P\2553A!\365\006\rB\361\336\277\273\264o\377\205\357s\312\357\315^_hP3.= \210\247\267e>\317)7p \373NE\254:\247\037n\207R\255\272\004\247f Ji\237\347.d\327\255\314"
+	.string	"\265F\002\304O\255u\201\021\210\247\0012gc\302A\027\347+\r\021m\270\27316Pk\3411\027gq\345\302xH5\331d\033\303\177Vh\021\220\235Z\353\003\037\024"
+	.string	";& \215\327\230\205\247ri\021\020\025<\276\214\231\202\034\233\355\016\357A\221\220Sk-\201\361\030/\377\304\2517\304\344m\247~,<\rw\215l6s\277\367\235\002sI0CZdp\1772A\200vq\266\216En\255\224\025kd\271V'(\016-\226k\244\260\326xaLq\265X\243\210OH2\254FX+\246z\215*\327\270BQ\235\300b*\022\002~ih\301T)\257\027L\225r\375\342\370\274O0j\372\371\204\237\361\373\216R\032\"\232\273\224\256MZ\226&\342\2648\243lP\324R\233t\314}\360t\324d\323g\255\265\206\213\273J8\027\265\347\235\336\344\216^F\320d0& 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354-\2561\230\200\023.8N`\001"
+	.ascii	"#+T\366p\310X\3207\271\031\r\342\230Q8\032`}\361\324\351\203"
+	.ascii	"1ru\371&\311\002\310\024\036\347\215[`J\255\324:\002\312\032"
+	.ascii	"\234{\265\357\t"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.52.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`'\002=\023"
+	.string	"\306d\201H\340\322&\035\222\022\317X\233\335Z\031 \022=3\346\beC\302\252d\364\177O\326\037\332\222\246\tx\337\200\375\360Hw\260\216\302\202\344\225\034\026w(\004!\n\302\3608\304U\360.\307X\356\373\370\034\221H#{\313\235Rm"
+	.string	"h"
+	.string	"m"
+	.string	"*b\314*0\366\350\214\324\bq\261P\252u\374<~"
+	.string	"w\332]"
+	.ascii	"w\272#\334}\2167'Y?qt\256d\3712?\315\323+G\007\211\350\232&I"
+	.ascii	"G<\237\321H\016\305\316i\005\031Q(z\370\234\020V\310H\220\210"
+	.ascii	"5s\201lD\257]\336\210-\271\237]\016\335hFA\342\316\345\351\244"
+	.ascii	"\326j\031\212:ww\333\242\355\023[N\braB@8\200\360\302l\357?\177"
+	.ascii	"\307Y\232~\274\347i\367Ji9\245/\342\025\315~\024}\370\216j\305"
+	.ascii	"\2715\325\033t\310\347\264\177\274\264o\037\310\257\321X\257"
+	.ascii	"69\036\216k\303\203\356\364v\214?\363\210\0314\210\371\370\322"
+	.ascii	"\325\023'[l\bR\255#\202S/\220\362?0\017P+\254\251F\255\243\002"
+	.ascii	"\037\350N\237\342\001Ap\320\215\371HI\257\345v\367\306\006Z3"
+	.ascii	"=\346\306\334\255\334\025mGK2\331V\371\f\030ZTS\252\265:\220"
+	.ascii	"\001\002\240\325d0\036\203\305\235\312\245E\265\245\037\377\005"
+	.ascii	"+AOh[\303]\200\021zj\255&-n\303\340\22785\213\213|x\352\273p"
+	.ascii	"\247\334n\216pg\356\367\265S%\231\3155dF\336\326\366Z\022\332"
+	.ascii	"\215\331\243L\251\026T\212*e\005\205\342eH\245\254\250h\313\n"
+	.ascii	"\244 b\224\022\013(\325*\305\362\201\252oE\205R\371PV,_\t\001"
+	.ascii	"\203\027R\253\257\005\004W\337\210\353\027\346\317.\301\250\203"
+	.ascii	"\215\006\367\240\277v\017)\3515w)]\237\314,M\210\323\306\354"
+	.ascii	"\331\240\336\322P\372\346>h<Z\222\351\263\326Z\271\215\375\205"
+	.ascii	"\233\353\355g\247<>7\033\0214\362&\327D\030'  \002\203 \324\035"
+	.ascii	"n\315\177\bw\372\f\005w;I\251y\347\335\002X\370Yp\271\013\206"
+	.ascii	"#\330\213\316\2106\006\333 \257\013\300\tD\300\276\205\312\016"
+	.ascii	"\207\210\005}\223\233\361\020\307\210\262\321\200\346\r\r\004"
+	.ascii	"Q\220\362\023\232p\340o\006\262\265\004\247\b\266\300\\\255\334"
+	.ascii	":\002\312\232\316\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.54.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"]\t"
+	.string	"\246\022C;@\305(\035"
+	.string	"\274~\025\335]h\355#\376n\330\361\345\013m\370r\273\351\031M\341%\307,\231>\221i\rR\326\310Z\337\230\243\350\344\214\360\020\b\027<~\277X\"\214\333n\231R2"
+	.string	"1"
+	.string	"0"
+	.string	"%\204\251Be)\r\214\325\200\335)=op=b/\270\036a\352\245k\311\277\3111 !"
+	.string	"\276\223w\035`\330]\353wB\335\360\2667\2669\266\t\004V\307\317\037^\231\027\001\013\255\335\214V\201e\305\226\017\333$;\263\255j\237\344%\244O\n\023\354n\264Vv\247\2027\330\243\006c\333\027\371\b\311\001\3203\246\277\003\\\t\377\311S\272\214j\327\364\317G\371*\302\367x\264\250\323\177\217~'1\241\377\254*,\254\013\350\331\323S\330a\037\263\220\303\016\241M\033yB]\003f\017\347\241\243q\037\221\3344\031\322: \351\341D\222s\340\r\342\303\311\321\266q2\233{G\2501\301\ng\n\241\355"
+	.string	"\322\177\021f\\X\026\001\n"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\01398f\217\003c\017\332"
+	.ascii	"}RRL\327$\003"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.55.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`{\002\255\024"
+	.string	"6\246\207J\260\324Q:x&\244\2511\311\211u0q\340\006\245\351\217?\3723<\376\005\237\206\202A\350\215(~o\017\035\372\3414\273H\326,\023\255\267\037\253\267\376\240\177\363\026W\261\245\033\351\255\347\366a\360\021\244\233\232\020\262\211\334)\005t"
+	.string	"j"
+	.string	"t"
+	.string	"\341I\2351Q\203T+\257\201\021\220\247\006\302\007\375\205\214i\003x?8+\237\025\267!\252Zy\245y\017 \236\222\007 \236\256\217\351\244]\244c\270\223\346\203\270\310\312\321\274g\233\364\204E\316\307\tA=p9\235\207\341\003\030\272\023\254\334-\\!`\360\277\317\232\334\314\334\367~\240E\320\327T\224\313\371\034Wj\255\236\270\034\316M\336v\b\333*\366\004\n\342\270s\377\273\004\244  \r\t\333\254Z\246 BE\273=6\3176S~\354@\341\345\261\317\373Y%\236&wz\024\247Eq\232\322\3510\234\336\235\236\367\3357\351"
+	.ascii	"E%\304\301T\2557UF\252\017\232\004t\337\355\013\371?\257|\037"
+	.ascii	"\355\225F\004\311\215\217\016\252V\336\202S\227\344\351m\031"
+	.ascii	"{e{N\373\273\307\2209\357C\342\316|@ff\021\263\226\256\270\341"
+	.ascii	"\323mD\270t\177;b\n\307Q\2012-\351n(\265L\242x\350l<\211&\236"
+	.ascii	"\206K\231\226\\\354\374#\032\003'\234m\0177\262p#\225\013\257"
+	.ascii	"\321\202\3404\3434\\\257\226\026\361\264d\367\t\2473\356n\201"
+	.ascii	"\241\333\221\2716\354D/o\372\251\265\246\370\300\313\310\340"
+	.ascii	"\2538\265\213l\036w\352\313\304\323\343\206\324f\225\377\227"
+	.ascii	"\257\230\026\013\214%\326r\221\304d\260\030W\214\003\006\322"
+	.ascii	".\024\r-\330\354\005S\312`e\f\326r)]3\230\022E\200e\033^\263"
+	.ascii	"2F&\233\225+\327\336{\204\246\035\360\210\036\351\377\235Dj\312"
+	.ascii	"&\374\222\344z\245\266\266\024\342\366x\334\022\276%\035/d\216"
+	.ascii	"q\337\273\002\245 \221]mV\205\265\326J\267\307\377\022\355\360"
+	.ascii	"\004\307\345\361\245\246l\266d\2775&`\264\023\025&\020\0031 "
+	.ascii	"P\202!sV\007\241\207LsWbkz\232\021\245'la8B\260\002\324$L\304"
+	.ascii	"u#\371?\212;\351\024e\026v\247f\374\227\251\222s\021\360\272"
+	.ascii	"\222d\371\035\020\350\237\243\270\033\030\021\367\310\250\201"
+	.ascii	"\003X\0021pP\023]\343A\222\035@\243W\204z\312\b\031\024\213\274"
+	.ascii	"J\201\307\251m\371l=\fU\211\216\3146\222\202\343a\f\217\326\354"
+	.ascii	"\271W\033\236"
+	.text
+	.section	.gnu.lto_determinePortSharing.56.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`U\001\025\017"
+	.string	"\326\234gF\360\260(\035\273xnc@\207G\215\203%[\327\376`4\376\376@\2464\351\365\033\373\024\352\223,}J\253\375h\362\024z\275WrB\030\336\304aqX\310H\241\34498\214n!epJ\256\321I#{K\231RV"
+	.string	"P"
+	.string	"T"
+	.ascii	"3\344@\376\241]\306\027\320.\367\345\3375\031W?\337\003D\271"
+	.ascii	"\366\3412\202\300\320\001\001\0023\304\003.\225\234\030\027\254"
+	.ascii	"b\260\200\300T\374\300a\335\370\200)\272\321A\214\212\n\020\210"
+	.ascii	"\212\037\033\235\022\207]W\300\024U\217\310\234\323\252\001\354"
+	.ascii	"p{n\273\263"
+	.string	"\r\301\376K-\3734\277\347\341\035\245z\245Z\243\372\233\200\025N\204\027sr\230\355\2302$\013\030\333&\373c{\3654\030\342\200\231b\3154P\265/\363\031\323\303\223\023\230\263\265\263b\316\220\201\023l\227\0167\333\376\353&L\376b(\002\364\344\330\250jr\314\353\322ox\331h!\267\025b\365R\226\031\036hD\005\332\356c<\253\273\253\271P\265\240t\346\257\356U;'\235\331\366\216\302\3026g\352\201_S\"ms\316\217\270\374\"\210\311\234t\366e\2218\021[\237hr[V0\260XJu\330!\212\256\313~\234\033\"\257+\205D\027J\266\t]\211\310\223P\032y&\036\016\205P\030\351F$$\316\3538Q7R\201\013\215H\\\210\001{&$#\256\344y#\356\023\316\307\271-\337Ev\243Oq\215\377\247\005\250!\303!\365\237v\330\001\270\310n\326\377\264\270+\266\343Z\344\264(-\032"
+	.ascii	"]\204\036\230\005\3102K\2001\260\001\2521B\r\200P\270(E\3030"
+	.ascii	"\020D\035\215\273E\020\220\025\222kx\303FJ\023\361\306\026N\022"
+	.ascii	"\362\201\271\002\025\016\356\n\322\006\247\020Z\022j\207\n\246"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_isSerialPortShared.57.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\233\001=\020"
+	.string	"6\237nF"
+	.string	"\261&\035;7\240\bP\323\243\007\247~\371\002!:\005\326\326\336$\257\013H\216\177\353\205z\030W\247f\272\002[:D \232P\321"
+	.string	"HPAw\017\205\265b&\330o\330\335\263\253\266m\332\202\330\275\267\224)\005Z"
+	.string	"Y"
+	.string	"W"
+	.ascii	"\321\337\013\310\307\354 \362\321\266\0338H\331\345\237\b\232"
+	.ascii	"\333\304\210\331\3211\347\247\255\315].#\\u\361\337\363\222\033"
+	.string	"\234\0312\254\227\313\016\217\033\024\222\346\234\"\326J\027\202\264|`\001X\032\240\b\354\365\341=\327\031\226J\025$a\316i\225aq\270A\267\275b\233\202}\026\001\3778\317\237=\347\227P\035\245\032\202\324\013R\253T_$\340\246\006\004\030s\322\304xL\032\361\005\t\333)[d;\242\370N\352<,p4W dD\310\036I\020~7\221\272N\006\035\315\225\212\206A\3668RU\373%\216\223zN\313\007\314\351\372i1\347\267\300\b\262\007!\022.\311\307~\341\036\260\261\177\265|n\300'\220\273\207\235\310VwW\346\210\361\240\322\230\277\272\217\351\001\2431\333)W\241\222\315\271z\340\247\360\272l\304\3437\004G\016\214\306\256\260W\313\305\272E\312%\371Y\351\016\373{\321\255\261\017\347\234\323\353\262\255\016]\347\001\\\267\241L\034K\t\nj\253`\301\304+\241\234\b\244\234J\023\270nC\2318\226\023"
+	.string	"\027\266\023\256#Ay\335J\310\246\021\f\245\31539i\335\246q[IE3y'm\304\200\273\025\023OCu\235\247\211\276y8\327e\215\n\256P\344qgl\207\226\004\263*\307\rerk\344\206x\265V\304u\005\037"
+	.string	"M\204~ea\314\221E\314\024\001\201;\225\0324\206J\030\004p!\026D\224\026\247_\226Q`\020\250\ta\260\257\270\346D\254\210A\370`\024\\\006F"
+	.ascii	"\34135\n.k\232N\324\342\246$\024\243f\317J\203\254uB\001"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.58.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\226\003\275\032"
+	.string	"\206\361\256J\240ZQ:\354^W\203k\0359\001(4]\001(+\351d\232\f\217C\264\335e9\314\3013+Hi\361[\307\235\205\257v\267\272\024\372\366}\234\307Q\233\f\341\231A\203.0\025\351\301c\017\375\375j\021!\204\354-w\222\001\232"
+	.string	"\216"
+	.string	"\235"
+	.string	"\301\377\370\371\211\202\355\2752\240L\335{.`\004\345-"
+	.ascii	"z\037g\372a\234\201\023\350#\211Q\206\204\024\357=_|~\300x[^"
+	.ascii	"\300x\3337\270|=\317%\305\335,\311\321\326\2468>\320\315J\026"
+	.ascii	"\361\252|\n\317E}`\225\345\305\235r\264<`\303wt\322\206X\264"
+	.ascii	"B\362\271\370\250!\370e\327kq[\027$%U\271zB\325&*\352\350\303"
+	.ascii	"\024\264\272zC\365\006\352\224\250\247\243}\247'\b\236L`\220"
+	.ascii	"|G\247$\205{/\323]\317w\23693+13\214\271K\004A\364\252\205E`"
+	.ascii	"\246\272\177\314g\216\276\tp\007\344\256\301\354b\3124\255\007"
+	.ascii	"\371Y?\377\231?\235\315K\235I\246l/<\327\222r\223\224iS~\r\356"
+	.ascii	",ZI\270\272W\305\325\230Ke\217\354\270\324\377\364\013\337\314"
+	.ascii	"g~\024\177\310,)\233\221\020\213\006\"|\250?\371\374\n\361L\037"
+	.ascii	"\321J\205\362C\370N\314\022\342\224@\274\362\211X"
+	.string	"\245\345\336S\301-\347\224\267g\376af1s\005\362\246\237\0079Q\001\\\035\r`\203\362\366\2466e~\227\246\315\2441K\301\317\340\221+\216\025\306m\2443\020\236\222\026{\333\330j\234\030<\232\254\020\240\335\314\0338\320\357Z}+\031\272\006b\346\016\177\342\001\202\221\027%'Mvj\250p).9\023\237\361\266\373\303\327%#/K\301S\0212U\325\022#\355Z\323\025\035\r\303\001(\253\337f3\177\200\321\357h\337\b5\020\317\364;BP\312P\231'\361y}\307\314&\216$v\251\252{u\017d?\2623\001x\257\316\301\324\215\314\370:nY\004\017\375\356\226\3173\336\232\035\204\332\261\b\262\035\230m\303\255F\303P#\273\301tf:=\260\2309{N\210\333\214\203\216\254\006\013a\263\021a\203Y\350\241\315n\261\036\037\020-\2161\030\001\233\325d\266\027m\366\352\231\301x^\261\232\355\305\240"
+	.ascii	"\323H\310j\257\033\215V{\261\316\240w\r\276\220\347\020\305\b"
+	.ascii	"\213\224|\334\370\341gt\\\025\2154mm3\205\240\316\3410\373\307"
+	.ascii	"f\016\322\325\266\007e\242oy\275\367\336\262\177\2143\326v\365"
+	.ascii	"\235nW\004\205B0r\364\212\322\237\222.K\310\376qS\221\031\326"
+	.ascii	"V\223Md\341T\027J\276\024\022\031\312{\003E\250q \245\214b\212"
+	.ascii	" $\"\"B\"\221:\220\002\031\2631\017\020h\2134\205e\fy\364\264"
+	.ascii	"v\r\305\217\312F\375\200\316B\375\022\312`\340\005\242\362\360"
+	.ascii	"\375\271\342\033\261\312'\266\210\3328\247\203.~Cl\334E\301\031"
+	.ascii	"Q\336e!\332\270R\226\213\002.u/\177R\231p\350\026\236\t\322!"
+	.ascii	"\200 \t6\313\223A\242\303\324\253<\233\363\317\314J\205\322q"
+	.ascii	"\260a\376\020\300\224<\201S\254\260\236(\220\035\023p7\016\371"
+	.ascii	"\005\n`\276\350f\0041\307\313\225\347.*\277\006M\003"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.59.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\315\005\265&"
+	.string	"\212F\204\017Fp\336M:\353k\027{E\201\360h\363"
+	.string	"\371\307\217\276\226\310\234\313\250F\265\316\213\206\263\340\227o\361\350\211\026\371\275b6\333\324\006\255P\312\013\242\027:\345{\232\037\002\036\177a\215b\354\326\324\232\264M\210\334I\006\344"
+	.string	"\322"
+	.string	"\351"
+	.string	"g\256\342\223q\312WR)])\357V\2054e\322\351'W@ke~\362T\252>&\343A\367\202\231\351r\257\222\001\037@\177\262\362D\366'z!\373\363A\204*\266\272\322\310\326\303l\024\315\340\356U\002\273\b\2437\225\347^\265\372\317\327Ky;TgO\263\253\025\377\352?S\301\321$\"+V\237\251\303ads6c\020s\302\333\234\037?\033\326^\001\"]_O\177\\E^\023#\220\2723\211\266\224d\235\315\370\303T@\307K\236/_\240\211\321GE?\343x\235i!\314\216\255\263\031{\230\025I\333[\312U\254\326D:\222\321q6#\020\323"
+	.string	"\232!q\210\365\364\272\371\343\242a*-_\265\270\260j\377\354\n\322\272$\343\204t}\275\352.\334{\271fqu\235\177\316\374%f\016\301|n\b\317b\346\016\327\022|\0307\367bMP\361,Q\350\275X\022\260X%\205?3\"\366\223/\303\376\\\352/\177\356H3\223\265cF\235k4\034q^\272\221\314\312\253\332`\313\253\347\213\033\214\331"
+	.string	"\323\257\234\227>\366\0278++\235\225\223\2702\322\315\316GFE\272\312\001\2702\221\255<d+\013\331\312"
+	.string	"l\345 [\031\310V\376\261\225\177ge\237\255\334\263\225S[\231wV\336\331\312\250\255\254\263\225\355Y\371\274\362l\332\312\365\254\374\003M`\307\257\260\033\335Fy\267\346\370\3343\347\227%\277\362\233\375\31273\032\177y\005\306/\321\270\353jCB\347^\245\007\364U\370g\234\376\344\227\335J\325\315X\r\2752\242h\313#t\356\275\032\320\237Jf\215"
+	.string	"i\247\332\250\002e\216m$\177\371\335\032/7\223\251\331l\243.j\255\005\037\352\001H8ee\346\204z\250S\364!~\031\302%\217["
+	.string	"Z\250Gh)\366\bj\240\006\320\024\314\210G\023\250\203Z\304\332O\367\032\250\235\264\274\206\025!\\\277\376i\340\232\257\177\f\376\366u\203>i\243\335k\002j\355#\013\033'\274N;\301\232]\363\352{\327\t\314\210r]\033m\335\032\221\211n\312\232\233\236\263\232\265\255k\001r\316\266\375\242\334\202\277\317\266u\260p!\312\r\317F\236\312\0325SO\245\351!\036\207O\203\226tc6\222\233l\022Z\247\354\rV\335\303\177\223}'5\327b\217a\235\343wm\023OQ\216\241\016\006\305yG\f\334\027/Q\016\254\250\301u\261J\n\371b0\372\274#&n\354[`@0r/V(\202'\244X\360b@\231\220\n\236.\244^\b1\270\230\022~`\321\"\252\247\342\t*\005\006!\b\024\301\023RB\fB\374\324`\005\211\340\024T\013\2400\b\224\n\222\210\002>M\265"
+	.ascii	"6(b!\013\250)\240\013\241p\n\230*\357\033\214O\366\fmn\320\270"
+	.ascii	"\370~+\373\3459\264QA\343\242\373\231#!u\355\341\361g\366\214"
+	.ascii	"\332\254\247\262\001\272\004\2255;@\323\023\267\2626g\023\336"
+	.string	"\210L|\215\344\364G\212\306y)\251N?j-6\323\242>\331Q<^8*k\035\365\345n\336{o\257\221Gm\240\177v'\035j\3036g\265\243\314\325H\223ZY\242\376\030P]jf\022O\365YD= \007\2173X}\305bC5o<\245\324\255\354\315\231Tz\2220\2619\273F\362\325\236\324\265\311\325[\23273\306L\tC\033y\246)Rr\350\306|(s\250Q(\303\fsH\251\021\031\221 \243m\306`\002\031\262\243n\020hi\322\fc\032\223\266\211\252\203\266\256\fB]\261\252\203\211\345\030Ci\177\275fh\230\033/\344\310J\206\213~$\302\265%\326\2610w\006\254`\346\227h\355\004\372\317\367\"\344\371z\347\023\035\332\311\342!\252\331S\265\251\327R\214@\034D\300\267\261\323\261i\370N\312\277\177\266C\313#\276\276\343j\272\034\023,\031\212\303\034\334\001{\273\203[\274\334\206"
+	.ascii	"`\361Q.\003\232\240f\247\204\356LA\372c\3153\207\267\002=\246"
+	.ascii	"\020<\177\271C\356\301P\016\213eW0Z X\ru\255\367W\016\002\207"
+	.ascii	"h\336~\016q\016\2572\3018\217\343\253\331$\257\253m\346\231\257"
+	.ascii	"\220\017O\205'\243\262\352X\020\327lU\264\204\327Y\277\220\235"
+	.ascii	"\005\\(\231\235_2{\211N%\360\373\242\346\017"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.60.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`I\002\005\024"
+	.string	"\266&\210J\300\020)\035\362\260\273/[\207\312\037\3338\f\256\233\215\022\354Uf(\242P\203\355p\013\273N\315\345vF\207\352\367\323V\235:\320\273\323\223U\022\205m\233\256KV\314E\236\343\230\210\377r\372 j\214\216'\215l\"wJ\001u"
+	.string	"l"
+	.string	"t"
+	.string	"\342\351\001\360&~\202\305\265\002d\016MKg\306\213\217T\255\244\313\344\007\204\247\342\005\204\247\013\302\342A\362\016g\355\253\220\202;k~\313W\340*fF\206\207\356\005\024yj\262y\3576C\0225\247\021\204\312\234N\303A\260\001\212\035\035\017\035\006p{J\030/?at\270\271\357}\276\210\342!\005\351j>W#\265V\317\234\216\346\026o[g{\304\236%\001\213C\004\225\201\203\027\307f\211'\377\325\177\356\320\323{\336=w\372\035\367@J=A@\252U\246\nG\215A\213F\374\347\347}\332\267\357\343\227n\371?\265W\227\031\226\214\016\223S\255$\003\361=~\317-\236\215\304\226\031\261\004\252\341Tk\3758\265\002\361\3646\213\335\262=\247}\236\247`9\271\002\006\250\270\017\033\206j\255\t\214 sE\344\242\216\350\356|\250\033\246\r\227\26506\200\263\321"
+	.string	"w\347\325~i<%\334\244\262=\341.V\350\321O\252\210\350\004\200\215\337\216\320\207j\341\351\227\036\375\246x\336\242\006\222\224\263}\341,L\356\313\251\265\212\234\332\263\2578q\220Tk]"
+	.ascii	"\364 \024?\304\251+\250\314\347N}\225\3604\334\227\007\251|\277"
+	.ascii	"\\\215mVm\0313E\264\273\263\311\333\f\261\224\027l\204\311^$"
+	.ascii	",\0131\230l\244\264\330(aL\221\305`c\207IBJ^#-\206\342\232\215"
+	.ascii	".\331\3702q\221\320P\\!\004<\243\020\243\271Rf3\232\253e\333"
+	.ascii	"\027\307W\361\007J7J\241\360\276\277<\013\352\206\td\355\356"
+	.ascii	"z\304\266\267\233\325\356\334\262\241\342\356\322\374\370\\\030"
+	.ascii	"\033\205s\237\203\267\204\233T\007k\2555\004\371\\q\337;-\341"
+	.ascii	"kr\351p\233U\001& @\002\203\030\324m\034\202\230>\003\301\335"
+	.ascii	"lv\tM4\277\020e\317\005Lv\203\335\033m\273\\\260p\245\227\205"
+	.ascii	"w@\240\247\342t\3243W\243=xK\036\207\";\241]\267\267P\200\252"
+	.ascii	"o\321|\254\245\033\272\211\300\343T[2_\017\273\033\211\300\244"
+	.ascii	"\254$8B\2245\236{\265\370\t"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.61.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\033\001\275\r"
+	.string	"V\233`C\020q\224\016"
+	.string	"by\364|\r\363\002%\337\215\032\367\237\331\344L0\357l\353\007:\365\215F\262ph\374\372\255\233\356\277\231!F1\262\337U\275\252FTT\215\005\\\334@\345\271Nm\261\t\"{K\231RN"
+	.string	"M"
+	.string	"L"
+	.string	"\332\243m\0338@r\351\337\007\224\203x1A\321\262\373q\352\341\245G\250Y\362\037;ty\261\"\2452=f8\324\354nF5!\025~\254Td"
+	.ascii	"T(\270\221\2714<\366"
+	.string	"<Q\225dv(\330]gJ\205\341\326n\233\201\355\004\366#\004?\214\351\204\351w<eCK\215\005\263]\224Y\216\205\021]\2148\354\267I~\314\031\377\373\t\322a$_\n\0270\026BT`\331\375@\036]`{\364\267e\332/q\023\244\277$\030\263\333\201\006\213\335%\340\001\333\243\346\001\264G\370\217,\021\355\372\0331\333\273\n\221mw\021\370)F#\233\210\307\353f\306\353\224\263\247\314\265j\241\3322\211\026UWbp\260!c\005\225.\336\022\252\rA\224OEM\022)\213\203\005\245&\3733\245\266\354\303\335]+\313\332aw\374+\335\210\343\361<\037N\007\023\352\274\006\336\350\323y<\017wB\034p\274P'\342@\036\367\3618#\\'$\342B\004\030\364\240\013q#\020(\304e\276=\\e9!\310S7O=\261\255\251\346\244%N\325\364&/\247\234iQ[PE\346ZA\r\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.62.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\323\003\245\033"
+	.string	"&\362\265J\240\230Q:\300\261\005\244\363\3514,4\273\216\221\264bG\351\\0\204^\252\353\261V\322\032\006m;\215-l\214\376\321\241\364\253v\350Z\233\312\306x"
+	.string	"\365\3458\027\274D? \200\007V\341E\036\302\252\231m\233\020B\344N2\237"
+	.string	"\233"
+	.string	"\241"
+	.ascii	"\314W\362%>O]\\h\215B2\220\367\336\007\254\300\336DP23\037\311"
+	.ascii	"\223|\230w =\032B\2171~N\264\356Mg\234\236\300y\323^\300y\263"
+	.ascii	"}\234w\227EO\263\354\312\343\367\356\242p\304J\332\3421D\274"
+	.ascii	"\3551T\254\256\234\2065\216\276JH\364\253g\351\240\313\360\006"
+	.ascii	"l\030T\n\240\361eKl\370\253\346\177\210/\313\b\310\034Kb\303"
+	.ascii	"\027%,X\305\0046\364\325.+H)U\305\206@\245i\224D\307\243^\205"
+	.ascii	"\206\276ZQ\013\367^\256\300\341\320\371uf\346\301\314>\346\336"
+	.ascii	"\021=\230\257\364\007\370\323Yv(?\200;\3754\177\362\303\316\364"
+	.ascii	"\277\336\344w\321T\266\207:\243O\377\223+7\254r}U~\001\tZ:\212"
+	.ascii	"\202\024\365Uz\203\3112\227\312\214B\344O?\324+\263\017\337\370"
+	.ascii	"(\206A\345\334\241\035)\254$-\236'^y\211\322\004W\252$\035\271"
+	.ascii	"7mp\223SX\013\005w\304a\203:\255\270\320:\t\335 q>\321]h\233"
+	.ascii	"\212D\020&\023{9\205\256\240#Q\206\262\276\t\213S\350\n\026\203"
+	.ascii	"\025Z\251\347B\373T\234\201\2747}\300\020\354M\2565F-0P\336)"
+	.ascii	"\353/\005\351\211\261\312\032P\0014M\303\372\325\256\0261\242"
+	.ascii	"\036(\353\216\222,s\211\335\343/\366\350\n\357\275\flHT[\310"
+	.ascii	"^5S\203a\206 \235\350\027\234\366@\300\354\020c5u\266m\256\277"
+	.ascii	"3?5\311> 3V\3146z\r*n!R\366\234\357sY\342\302L\342Sz&\360\245"
+	.ascii	"\354\224\260\367\336\013\271\371\256\371\241\344\247&?E\212\215"
+	.ascii	"`\347\234h\037\030\202d)\313W\311\260\254\236\315\\\263\325\003"
+	.ascii	"\321~\324_YF\240\266\220\276\3561\247\275\332F\314\357d2\231"
+	.ascii	"\344\0166\0244]\b\331.\207\343\360\322\355\340P\333\r.\247\264"
+	.ascii	"\355h\036nxh6\226\266\243a\210\251\250\321lpph\027Z\344^:\270"
+	.ascii	"\333\256\246\303s"
+	.string	"\302\346l\267\023\267\235\216\355\346\366\342Z\r\016\355\226\263\351f\270\333L\347F\313\231\325r\272Y\215\001\306\355\330r\263\035\016\227\233\301\356\313\333=8VL\376\214V\246\341x\244\311X^\352\335B\314\334\315\026~\032\250\274\367^\227\254\2317\234\212\347\2621\265E\024\240\263\0248B\307L!\025\325f\356p,\037\256\230\b!\303\002\2069\2736\312\204\005\350\252\351[E\210Q\366\300G\250Q(H\fc\212\231\222\211$\b-j\007\240\002\021\271\263\003\021\200\271d\243r\3176\210\272\226\302\350\204MM\276s\314\007e\315\322\002\017\333\363\017\341C\364=\222\302\306=`\365\370\257U\377 \032P\240=\201\2435\245M\360\002F\033\323\003A\315\013\327\246\006\215c\332\030(\204\357\257\fa\037\200\226\367|j/{W\245\206\247\020\022\007z\372.\276\206?H\002xK\347V\256D\022\240M\2357\345\232}\032"
+	.ascii	"\205`K\227J\374\262Tr\261$\2462\002\345\260N\376\003"
+	.text
+	.section	.gnu.lto_closeSerialPort.63.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\025\001\005\r"
+	.string	"\366\227XE\020q\224\016\030^7`\3046DZq\361\036\006\265 \254{x\245K>r}\030\001l<0RuD\361?\266\235\254[ba\331\226L\275\002D\021@M\003-\017\201\033\001\220\375c\324\256}\322\310\336{\247\024C"
+	.string	"B"
+	.string	"F"
+	.string	"\002\262S\355\001\262S\203v\313\253\310^E\205\005\223\330\356nr\304\301O\031A_\023\252>=\\N\005\255\013*\034a\307\334\240\3200q\327#\206\220\025#\306\263\273\216\037a\207\233\336v\003\333\036\373\036\001 \366\353=_\362K\355/Vb2H,v7\274\334X\030\264\305\310\353o\377.olW\324\327\203CFC\206\025.\273\365\300\251\023h\217\366I\216\002|I\352"
+	.string	"vARVv+\002\033\320N]\037&mw\027\370&\024>N\214\335=\211S?\225\235bNXb3V\361E\212(\361\202I\243\262)\013\264FR\300X\321\206i\224\322\236P!\376c\312\273\256\201\271\bQ\303\205%UvUE\031b\177\356\356Z\006!\321\347{\3009y\235\003\215A\035\322\207\363B\337\326q\033\004\356S\332@\336\267u\b\270\213\020\362\266S\327y\333\246\356\275\222\035S\206\274n\213\236\222\312|h91\312l\356(\243\227\204\322"
+	.string	"\021\006-\026\020$7ev\367\223\027"
+	.ascii	".[\267e\236\314\2000\314l!~7\f\242\355h\030\213'\225\b\310\034"
+	.ascii	"d\255T\326zj\n8\330\325\204(\306\226q\315\346\302\335\214\"\226"
+	.ascii	"\247\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_serialInit.64.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\373\003\355\032"
+	.string	"61\256I\260\324Q:\343\317\367rWT\254t\340\300\203\247g\370\360:}f\200v\211\333&\314\377?\306\363K\237wr\345[\377\023\371\351vZ\217d\333\001\205\322\347$7~64}8\351\201\222|$\314\371\030+\371d\023\271S\n\234"
+	.string	"\211"
+	.string	"\234"
+	.ascii	"\343\007\220\247\236\323\236@a\367\340\212\002\337\272\n:\251"
+	.ascii	"Uh\343\006\345\251w6\226\013\217\352\231\244\264\030\302Uk\235"
+	.ascii	"-\016\227\037\205wl\356\016\023+a$\035w\356\374 \2373\242\206"
+	.ascii	"VE~>\207\031a/|U\247"
+	.string	"\362\021\2154\255,\"\240\031\273!D\343%ld0\245\306\025\003K\237.~-&\251\300Hh\350\364T\276!\331\217\305\034\307\231)5\256\004\370\361F\bEQb\310~As\277t\bY\302`\227\221\020\215O\330\205Z\253g\357't\313n\033\211m\016\366\"\t6\023\363=O\250\250)\336\372\270\374\016\351\0239q\307G2.\305|\357\324OA\236\332(\355(\nn\371\231E[\3503\027h\237\246\305K\362\332\260e.\374c>\274K:\r\243\323$9M\311\351\221N/\235\236\343\364g\336%\211K\353F\254\025F\321\253N\321\246\034\037\336\276\020\177ih\247\322\307W\022\231\270\262\324ZkN\255\241<\275\314\366N\373?\016dw\241\316\261Z\215\212Ij\2556\246\225\247\t>C\236\006O>\310\005\356\324{[\305\357\220sw\317+\002\232EG\315\215\361\212=\206\376t(\235\r\224\233\006O"
+	.string	"p\371\342\332\342*\337\216#t\2774JZ\206V\202\246\227\211\224d$c\\\340ud\314\036P\312\032b\005M/\376\332\036\336D\307\340\252\326Z\301\351\006\301Q\255\225v\312\204~\351m\331\2677}(k\r\242\371I\256\004\304\030B\004)\202<\375~\351\243\216*\257\256\246%\276\350R\262\216\231\2577\024Y\363\0139\223N\200\243Z\177\336\363\215\374H\216\217t\352\232\216\216\003*j$n6\312c\303\200\353\320\223\303m\030@\242vb\004\316-CO\t\034\217"
+	.ascii	"\347H8\201c\313\325xf8\333\354f\303\331\231\345\344xf\022\b\030"
+	.ascii	"\207\242\226\233\365\340p\271\231LX\2776\202<C\227\244\256,?"
+	.ascii	"\013\004\263@\313\210J\231]\254Y\363r]\224\267\023Y\356\277>"
+	.ascii	"\326Zk,\302\313\225Y\231\f/ +\"sI\t\303\222:\271\260+ra\304("
+	.ascii	"U:\007Un\026PQz\262\300C*\n\266@\3774$\335\007A-\303\250\230"
+	.ascii	"b\261Hu\032r\\\372\035w\255\230\f\255\210_?\263x\"\251H\2501"
+	.ascii	",$\215RF\221!\t\204D\204\244i\003\300\002\221\251\272\r\021\020"
+	.ascii	"IJJ\212J\263\031\210\376L`\n\341\357 \2765\370d3\261|\267\307"
+	.ascii	"\021|\331\205D\234\202\003\364\260h\345(\366\221\326Db*!O\213"
+	.ascii	"Ho\316\"\024\206\374\213\037\225\345\353YUF\225<\255\261\350"
+	.ascii	"P9\353\177\266\266\356Z\261?\354\f\310k6\231\304\270\001\241"
+	.ascii	"\332\350\203\210eS\320\232\256\035\304\367V\315 \227\246\354"
+	.ascii	"v\371\327f$C\322\252!\351\215@\364\262\020\321\003\321%_s^\353"
+	.ascii	"a\f\300\005\275t\177\031\313\017"
+	.text
+	.section	.gnu.lto_serialRemovePort.65.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\t\002\r\022"
+	.string	"V\"yG\340\362$\035\0227H\267\230]\276m\002"
+	.string	"\225\344^"
+	.string	"\325@\322-\0021\t\304\232\245-8\203\344\325\2737\217\250\276\273\315/F\257\217\207~\322\204\031f\2303:\344+\271=.U\020\207\230\355-6B\310\336r\247\024e"
+	.string	"_"
+	.string	"h"
+	.ascii	"\237\216\331<\036\376\354\225\204n\216\242v\327S\020\356.\303"
+	.ascii	"{\213\261s\333\224\032c>\321\tL=\311@\231s\222\313\321\271Q\002"
+	.ascii	"\336H\025\250'\236\323\036q@\232\270\211\220\330\371\334p)Oz"
+	.ascii	"fh(\001/H\023\247\017;V`M\324\323~\"\244&\003w\0369\007\273\353"
+	.ascii	"(\0033\334\335m\353\330N\261c\203v(\023U\240l\202\254>\366\310"
+	.ascii	"\207~\325\213\3569\243\345\214V\031\0355\372$\002x\234`@v1\324"
+	.ascii	"\246\266i.\215x\321\355\207>\315+/`\020{\021\254\333 .I\211\250"
+	.ascii	"\307n\210\340\323\n\272\317\257l?\332"
+	.string	"Oq\241\330\207b\254\332\365\300\364bw\023\330@\3679\340&\333\247<\200-4\261f\337\305\225`>\220!|\361\262o\373T\345\220l\230\340\020{\314\326\"\211\005I\211\032Q?\316\303\024\003\205\324\231U\032\325e\224\243&J\331\216p\244\230\0038v7\305\266\205\257p)\360\263\273**~\324\362\201>M\341\025/\373\364_\333gT\325\320\324\353i\237=SH7CfbM\221r\202\300P\235\005\025X-/\337t\261\276\007\037\314\013\253\345\0231\013\212\204\225\317\305zy\255\317{\371V\\<\026\327\313C\t\340\326\004\226\313\203i\265\\\336*\334\253\217M\364\216F\207\246\031\245\341t\346\225\2149\2423D4N\027E\030\351\250\211Rw(s\271\273\273\351\354\260m\352\210\376\204\220Z\234R\227.\363\361\332a\233\252\324\333\364\004& p\002Bu\324\003\241\300\256\323J\330\243+\365\356\261\354M"
+	.string	"o\366\251\345|\202\t\250D\306\207Xl\301\356j\313\206\333\264\3342\213\215\023\034\327\n\251Y\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270rZ\230\030\321\371^2D|\007D\032"
+	.ascii	"\262\276oD\335\316E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.66.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2Pm\222\016$\241\252r\252z'U\023\216\352\205Q(Z\215\275%\273j\377\266\rI\357\274\201\023\366\233\231\231\"\243\373V\302\003E\340\251\303\332\337[\246c,\n\227\251\312h\03255\206\351\262\3200\225\246Y\004\246\0322Us\240\250\252U\262,\202\016\t:\b\361\345h\307u1~\330\\\261JwC\251t\030@\321\271\321g\234\303\212\357$\021\364\337\207\003\031\"\326G\246gD\222!\022H\350\267\276\362\001\202\365\325\354\302C\t\211\"<F2\263\206\026\275z\327\355F'\032%\"\354\303\351\001$d\346\207}&:\3667\370\013~\211\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.67.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`|\001\375\017"
+	.string	"F\237nF\360\320&\035^r\335\032M\235\204\030G\232\301\365\257\317j\221g3\246;\331\233\242\236\267\002\256\225+\nR4\032\265\262BQ\354\b\221\336o&\262I\260a\343\312^\037b\neY\260\372\325\262A\b\331[\312\224\002\\"
+	.string	"S"
+	.string	"]"
+	.ascii	"\331\343\002\006*\257\376\345\320|\307\005\f\020\322\356\307"
+	.ascii	"\251\007o\207\337\035s\365,"
+	.string	"B\315\225\317\362\fj3\030d\200\264^\340\310\021L\203L\213\225qD\315!l\300C\342\003H\313\005\252\353ETj\275\244\336\365$\202\261f\004\265j\236\032\311\356:cZ\031n\355\266W\266E\354\233\b\266\366\236?s\032\336\347\326\230N\230\376\366\244\017\351H\005\333\245\211\361X\030\221\305\316}n\377\363].\371>*\333\212\320\202\204^\330\330\375\020<Z\301\366x[e\227lg\332?q\036\325{V\374\261\333\301h\305\356&\260\201\355\221\300\005d\217\360\001\002*\231\252\246/\221\224\343\305\206\225\261\324\211\301\021\003*\2163M\365~h\270\344\016\333\021\376Z9P\264\273\"\266-\\\005J\201\234\335\035Iq \224\037\342\321\024R\371\230G?\225=\246~\364\250^\357z\264I\212\301\364h\311\230\276ft\f\251\342\330\037K\352\315\320\215\013\033\2547\001\025L'\247.z\246\016B\227r2\235t"
+	.string	"l\022\"\241\244\363L)\016\325q\247\256\004\2053\361R\\\310"
+	.string	"\243&\230<.\005\205\362\270\322\267\327\033\037\305\035\300j\274\204\242\277\312\356\372\003X\321KH\377U\006\241\232\244EY\0342\305q\251\005\3244\202H\313l\251\363c\344\222;\016ww\343\037\032"
+	.ascii	"W\bx\254\306)\275\006\322\224\272\356\204`\f\250\216`AD\305\262"
+	.ascii	"\341vq\366\266i\003M\0030\033u\241\013\202I\3064\255\333F\244"
+	.ascii	"\220gO{q)\240ZP\005\005O\331g*\022\257k\222\001"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.68.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\205\n"
+	.string	"&\223G?0\247*\035\345\021\024\327\257\267M\323~\f-\354\301\205:\r\355\017\231\246&\241\305\013N\005\003\337\332\212g7\354\203l\\w\233y\n\230\2102\213\001\342\273\205\257\331\241(?\337\022\262\267L)4"
+	.string	"4"
+	.string	"6"
+	.string	"R=_G\327\007\212\236MK\311\204\222\001Ks#\306Z_]I\300\221N\225\323\345W\237+#\353\003OW\313\304\356Z?\260\344\326n\333\302\266\204\355\007\001\257\254\225\222\261}\265\017\340\001\274\253@\276\260\213\022\013\354\206\021\206\270<s\370\006\355\331\345\f\3323{6\354ajO"
+	.string	"62\240\301\356n\362\304S\275g3\337\245\202+\301\334\335\235\326\024s\016\315\356\360\320\177Np)x\221\244H\262\f\224@)M\354P\244\233\224\030\263D\331W\375S\325\267<,8\0202\356\232F\007\033\241\216\243\300\270\243\271\340|:\017h\343>[\306\207\203\261u:\320\246q0\247\341\351\266\020\307u[&\334K\224+\030\274D\344(\373\320.;\001\bH*\032A\247\264\271\r}\023"
+	.ascii	"m\231'3\260\316#9\266N\\g\365\302\tc\007(\b\251\0200\217\202"
+	.ascii	"&\324\"\357\022@\263\232\022\334\213[\252T-\003\365\262I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_nopConsumer.69.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375 \336\035\006"
+	.string	"R\213*2Pm\222\016$\203\310\"\242\342\342\366\b\272\262\n<L\325h\313\0219\310\2029\374LAO\222\371Cf\306\f\265\"\260"
+	.string	"\016*\252\016f\3427Bv\n\215\323\030\2423\230\206&=\315\2069\211=H\315\201e\336\206a\006v\020\232\3078\316=v\211\315\365!\220X\023\037;jm|F]\237W\002\032#SZ\204\264\027\241\224\232TJ@\177^~\245>A\001\246G\304\253\315\020!i#\302\006"
+	.string	"Y\031\376I\306\216Z@\241\n\020\224\266lq$L\005\317\374\310"
+	.string	"\317\324IeYh\273\362L\030\371\312\277\340?\370)\002\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_serialPassthroughSpan.70.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\337\002}\026"
+	.string	"6+\226J\300\224Q:\270\271\301\355\2604\3656\344z\212m\033"
+	.string	"N\203\270\263\277@i\326Ed\254\2507\271:\212\206\356\233]\243\203M\270\336\024\307\323\236h\b\202 \364!\360\026+\\D\200\337\354\322u\344\351_"
+	.string	"J\032![\312$\003\177"
+	.string	"\200"
+	.string	"\201"
+	.ascii	"\252g\361\026\262\273\310\371I\267O\217\243\356\362\200\022\020"
+	.ascii	"\017jy\225\360\240x\224\360\240\312T\203\254\354\364\354E\227"
+	.ascii	"\301\002\214#\335\235\342\021\345gy\005W\366"
+	.string	"\020\234\2742\375w\237=$\01627{8K;8\023\246\234m\302\370zH\347\325\026\324\361|\206=7!d\216\347<\r\364xE\316\373j\310\331\246\n\316\004\371\335\027CNg\267\264\240\273u\311\034\207k\351\252J\252\252\003U\236\001\343\313\277\344GW\260\264:\305U.\255n\270\372\024\023\240\242\334/\030\351\306\375\220t\022\210t\342G\277\321?\364\023}\252\236\247\343Q\214\205\356C\003\361Ez\032:\032\305N\264\020}\302\243\202\201xp\037\343;\035e|\206\354D7o[\213Dt\270^\367\206\004\342\301\331W\t\377\3420d\037\302ys\350\337P\350<\364\272\313\226\203\212@<\31027\250\302\n\2272g\345\3245\241\f-\337\347}\016\351Pc\005\022m\177\3141p\354\344\246\242v\007@\210\331\223j\342\345\260\347\306\303B\022\332\376`H\370z\314?\307\tM\314\263\027?\204|\324\326\247"
+	.string	"\366\374\242\357T/$H\023V]E\330\223&f\261\275@8\362\371\273\243\354\260\021\321\331\237\216[\302\252\022Z{r\344\323\370\226H\322\221\"\251\3063\325r\266\374\243\372\003\331"
+	.string	"\272\241\354\243\212z\320\177\372\320\325t\027\277\311\215\256\001\254\317\304,Ml\206a51\227\n|\255Z1\233\032\227Jt\301\266\345z\321LU\271L\220a\275V6)\027+U\303\222i\245T/\233\224\213"
+	.ascii	"uQX\275R0\227\353\225\032\313>\373\250\250\303F\022\215u\364"
+	.ascii	"fv\213Pp\242\177\367\223^\320\376B\376\321\021h\242\030\364\261"
+	.ascii	"b01\310+B(Gm}\237\335\335 \377h,\004\031\305\001\204nBl Rv\262"
+	.ascii	"\236XY\230'\037\b\354\273\007bw\3030\0073 \220\002\021Ig\007"
+	.ascii	"c\300\356!\365\023F\027\367\023\2331/\245\354\225\001Zz\354J"
+	.ascii	"*\013\264\310\342<0\001[\207\374`\350\2616QD\272\037\323\214"
+	.ascii	"\005\307\n\231z\\\255\360\b\242\200\215\2161f\260\2421\034\b"
+	.ascii	"\243\007\2039\037WS\261\245|\302<$\362\260\274\270yM\322\337"
+	.ascii	"E\221\306\300\004\222A\026\240\351\240\035\370-\331\331-\202"
+	.ascii	"\r\356B\271\327E\241"
+	.text
+	.section	.gnu.lto_serialPassthrough.71.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`\312\001U\017"
+	.string	"&\033bE"
+	.string	"\221(\035\360f\374\0372d\032\377\027\020\337KZ}\234\241\306\203F\376\021\326\326[\323\364^\273\360?L* \330\026\r\253)*\326\017U\363\245_\025!8mb\202\013`\2630\317`\332\032!{o\271S\nN"
+	.string	"M"
+	.string	"M"
+	.string	"\227\026\3316\376\275l\210\t\024-.\330\356n:\302\031\024]\313\246\214\nE\376\210\3135\210z\3069\271|~\270d\311"
+	.ascii	"\243\207kLPs\"\004\200\023)\202\200XQs\327\241\351\204\001\302"
+	.ascii	"\254\301\356\032\226N\035\356\315m\267\330f`?\026w\347\255\177"
+	.ascii	"s\326\257\375\373\347W\177<\353\376\007\334\220\002\346t\323"
+	.ascii	"\213]\016;t\354K\272(a\373\036v\013\306\002\310Z\t\t\260$\031"
+	.ascii	"\022#_\f\301\241}\230\307\210\276\262p\001\273)\026-v?\005>\240"
+	.ascii	"]\372\373\200y\251\035d\006&\177JM\025\210\251U@\016P1`\273\027"
+	.ascii	"^r\204\232^M3\337\350U\210\210\252:\213\206F\27525\325\221+\207"
+	.ascii	"L\r\022\214Y\302\t\001&aT\233B\005\370\222\357\372_d\340x\221"
+	.ascii	"td\177#\250*\373R\303\215\2265e\277\025$\241\023\023\316\233"
+	.ascii	"$2tb\302y2\024\341\203\022\355\021A)\341\274\017h\353\270M\002"
+	.ascii	"W\222\262y<\320&B\300\335\204\217\267\205\272\316\333<|\215\003"
+	.ascii	";\032uzV\346\300\353\324\224nfF\314\213EG\217\273\273\231\252"
+	.ascii	"\f\224\244U@\017P4\342F;\032, \300\002\031\252s\f\340\025\260"
+	.ascii	"@\016\003\331\020>W\267\327\250\n3a\022\230\310q^\343\265\347"
+	.ascii	"&|\302\216\315\325\023\302\365\366\265\005m\035NZ\261-\213\340"
+	.ascii	"\002\006\332^i\230\350D\2044\2069\0073b\270\n;0R\304\207a\001"
+	.ascii	"C\277\367\246\255\3322\027\022y\2652\347[3\246\024\007\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`C\003\345\017"
+	.string	"\224\026?\004"
+	.string	""
+	.string	""
+	.string	"\002\305"
+	.string	"\177,\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\0060\177-\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005).\301\204\001\306"
+	.string	"\177/\326\252\325\252\001\271\2201\1770\346\206\316\220+12\1772\234\211\365\321"
+	.string	"\0023\1773\005(!\300\003\0024\17747\1775\252\333\3426\0055\032\005,66\1777\0028\17789\1779:\177:\250\212\250\332\001;\177;\234\367\200\311"
+	.string	"<\177<\002=\177=>\177>\377\377\377\377\003?\177?\300"
+	.string	"\177@\005*A\002\301"
+	.string	"\177B\002\302"
+	.string	"\177C\303"
+	.string	"\177D\304"
+	.string	"\177E\360\372\2508\307"
+	.string	"\177F\304\357\210\005\005/G\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005-H\005\003I\001\310"
+	.string	"\177J\037"
+	.string	""
+	.string	"\200\220\200\001\317"
+	.string	"\177K\316"
+	.string	"\177L\315"
+	.string	"\177M\311"
+	.string	"\177N\312"
+	.string	"\177O\314"
+	.string	"\177P\313"
+	.string	"\177Q\003\001 $\003\003#$\003\003\"d\003\003!\304\001\004\003\221\205\327\307\003\001\265\006\003\r $\003\r\nB\003\020\017\320\371\216\307\003\001b\003\020\007\350\274\307\343\001\001\302\001\003\021$\361\344\203\254\001\001\244\017\003\023\022\"\003\024\007\003%\271\255\362\217\002\001\204\006\003\025\t\026D\003\033'$\003\033&D\003\034\033\"B\003\034\003\342\001\202\006"
+	.string	"@\250Q\030C\271N\346\224\244P\243\003\220\002!\262)\017\021\240\024\210\030!\022L0\025\311`\320\0016\177\001\326.K"
+	.string	"\024M\021\211\264\002\342\265Y\240\203\355\356\27779U\3735\2223\007A\006-<\035O\207\347W\213G\302\314\344\006\264\375\017\375\205r|;\205U\242\304\026q\305S\311\275\340\351Ql\361\363p\360}\\]\226\351\245A\356Nx\242,W\207\373\331\325\367\204M\306o\331A\222\275\267\323]\034\364\211\241\024\323"
+	.ascii	"K\254\3559\260\324"
+	.text
+	.section	.gnu.lto_.refs.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375 \261\235\003"
+	.string	"\002\211\027\034\2205I\007\377\377\377\377\377\377\377"
+	.string	"\220\315\333_\307\376\377\177B\304n\322\310&R\246\263"
+	.string	"Mm\220\217{]F\027\234\267\202\233\343\345\256\235\250\r\307\t\367\003\343\347\270\335\033\343e\234t\036\021\347\036\312\324B'\252\200\037\364%}\245^\304S\201N\354k5\235\375\340-\027o'\377\200\006"
+	.ascii	"v\306bQ\367\272j\274\005q7\233S\337\362\004"
+	.text
+	.section	.gnu.lto_.decls.70e485b4a26296bb,"e",@progbits
+	.string	"(\265/\375`:4\255\333"
+	.string	"\312J1IV \016!\235t\275V\255xM\253\355\224F\202\312\274V\001\374q\354w\037\210jf\003\314\377\321hf\271<\331\362\333\360r\2577\206\331\212$\220Gyl\""
+	.string	"J\352A)\251\3047\323@\356\225\241\f.B\205\2030\370\307S\232\021\007\306'\277\026#\032\332[\356\024\340\003\204\004\250\004\305\244\247\243\313\223\276\001\233\350\005\n\212'F\222\244\235\302\345\362\030\301\235\261\245(R\366V<i\024\035\344r\204\016\005Q\343\006\352\247]e\372\304J\317\232\271V\356Z\210\001\206\226\336\312\020ad\210\355\343\341\375C4\024D\001\326\030\306\306\020e\\\004\357\234?\0327\317\023\322O]\3437O7-\034\nV\232@\321r4\306y5\364p{h\277XD\347\032S\300\306\0207\244=E\306\256\n\007"
+	.string	"\263\032\r9\021\016\366\222V\241OcAk\024\3074\230\225z"
+	.string	"\264,X\277\233\005\355\200\263\360\211\205b\003\355j\001m\223['\266\2053"
+	.string	"\320\242E\361+\003\264\177\206~9\257!h\b!\004\226<\272\301\031)~S\245\304\245\272\226\221\372\375\326\314\256\331>\020\236\242"
+	.string	"6\346\323@d\203\372)i\374N\221\352\331<\213g\225X&v\211]\355\236\245\273\255\263v\307\253\007\273g\347\254\330\315\202\246gN&~9\347[#w\201G\330T\276\232\372\030`\367l\022\253vW\264\024hK\317/\016\211\205{i^\310N:>\252\234W\017\377\b$\330=+g\341\356J\225\235ti\020h\002$\342\021\230\363\252!\004\230;@0\266\027|K$\275\234\315@,\332!\351\255\216\364\026*\275m\221\336:\323\203\265Y7\273\016\300\276}\004\022~\233Z\371\312\305\320\312\260\005\351\355"
+	.string	"\210\366\320\016\200\370\232\364hGl\006\342I\220\022m\232%b\327\r\266\310\355\231-{\n\317\232\327\234W\230\226\212\022\266\325\370\036Ho7\020\357\341\241\335@\374\003\322\226\2631\304\0136\003\331\330\212\220\036Fh\215o\307,\230\025\353\245\234{r\316\001xY\253\323\202\3320\313\365\025E\330\370\006H;\333\fD\017l\f\321vy\270\365\212!B\243k\206!@\331ZZc\025.{e\267\356Sh)\203\345\274b\300kE{M\032[!\026\313\256YV\353Xk)s\345\234]Z\236\320\300x\032{`3\020\361\207\374\205)g\022\336i\211\234sV\261_#~\265\031\210\251\215!\376VF\033u\213\337\002\2628\300o_\3203+\376VU\374M\242h\203\265\317\360_\f\374\376\367"
+	.string	"\177\273"
+	.string	"\372w&\302\031R\214\001\377\330\245\003\254\362\006\342\032\374\2270H\247\270\313\177\233\034\273\204"
+	.string	"6X\227%v-\004\302Z\331\337I\024\326y\f\377\355\362\321A,\364\211~\276]"
+	.ascii	"\377\265\232:\373\277\362\337\246.{\200\004t\260\225\301\177"
+	.ascii	"\265\032\250\177^\374/\321o7\270\352\340\355-\377U\301\323\377"
+	.ascii	"\322\374V\252}B@\375g\371\257\n\377\237\374\377\373\217\367%"
+	.ascii	"\377\363\376+\371\177w\275\003\376\357;\352\236\277K\340\374"
+	.ascii	"\257\365\r\376\353\341\357\t\374m\201\277+\360\267\004\376\206"
+	.ascii	"\300\337\024\370\373C\313\374"
+	.string	"]B\363\374\207\371\361\211\337\3328\301oa\374\267\377}\300\337\315\277_\360\267\211\277u\376\306\371{\304\337(\370\333\004\177\203\370\373\204\277/\3607\206\277Y\376N\377&\376}\370\333(\277\r\374\355\337o\363~{\367\333$\2775\362\333\264\337~\375\266\353\267[\277\275\372\355\217\337\346\370\355\215\337F\375\226\351\267H\277\215\376\266\350\267+\370-\362\267C\277U\301o\023\360\333\346\177\276\337\022\340\277\340o\205~\033\364[\240\337\216\340\267'\370\217\363[\n\374\266\347\267<\277]\371\377\366[\030\374\337\360?\354\177\221\337\302\374\326\304oK\374\226\371\333\344o\227\277U\376V\347\267\033~\013\302o\021\360\333\002\374\266\345\267\367\267\375\277\360?\341\377\301\377c\377\267\376\247\360\337\355?\007\207\207\207\207\277J\210_\205\311\017B^6\032_\2456\332\222QX\327\207/E\340\230\254XHo\255\354=Z\357\321E\002"
+	.ascii	"\324\003[C~\031\212$\202\212\340\013\250\350\205\321\030\020"
+	.ascii	"\222\212\261\252d\365\241\251\255+V\334\250\335\312\213\312\\"
+	.ascii	"\036OQ*\027\277\321+\025$D\350\032\255\300\200\352\325\031\265"
+	.ascii	"\300\341\362;\"\230\323\347\323_\364\262\260M\\\214~\200|E\245"
+	.ascii	"\277D\027\372[t\213\2720\3159O\035FY\310\\%F\372\376\2119\253"
+	.ascii	"HY3\324Y$\332\024ke~\027{\255\001r>\001D\220s\363\317\357/\255"
+	.ascii	":\343\201q\017\262L\316M\350\223\213\251\211\341\311\305\223"
+	.ascii	"\237]rE\030\236k\226\021\200\314\345\224\237\353R\023/5;\257"
+	.ascii	"\271\207\251(\367,5u\236k\206\346u\251y!\367\024]x\256<\315'"
+	.ascii	"\027S\221}r-\025a\310=\271\231{xd\244=KE\317\267\245\242\013"
+	.ascii	"O.\236\242g\017S\221\315\353R\266sEV\246\346O\346\342q\3119\013"
+	.ascii	"\255T\315b\316<\320\334L\322C\231\311o('e+g\265:\345\234sn\202"
+	.ascii	"\3415-\255\254\316,\367\334\261t\363\2233^\036j@\3236\201\262"
+	.ascii	"\263is\376Y\2419;\227P\020]\262u@\320\354\222{x\204\234MK\305"
+	.ascii	"\037\347\022P\336!\303\026=\271\232\226<\244yqQe\347\332\264"
+	.ascii	"T\031\217\t\232r5\327\f\326\202\013\227TT\310\257o\375s\322\225"
+	.ascii	"w\205j\236\276\324\032_\305\031d\327\033\324\201 \326\334|\331"
+	.ascii	"BA\354K\357\263/\320=\361\373\274?\305\236|\2378g\036k?x\261"
+	.ascii	"\366\203\224\265\033<[D|\342\022\237\333\363\344\306\227\033"
+	.ascii	"\fOSO\216\233\327\233/\217]3Q\f\020\022\024*\302m\332U\303K\220"
+	.ascii	"&6\204\224\245'V\035\032\262\371\245h\322\270\243\3400\0373#"
+	.ascii	"\215Ot\"\264k\027\246\004!\262\272h\374'\026\256\t\n\223\263"
+	.ascii	"\306k\013ZR\030\013\301\300b\234\217\263'\215;\360o(\r\330JE"
+	.ascii	"\030%.\302b4Ns~\202u\005\273\220\252\376Rl\265\001\341i\301\t"
+	.ascii	"\017\237\031X\215\223V\2624\252\225\260\211_\222\2417\277>?("
+	.ascii	"\300\273\306,V\236h\025\2625\316\342j\"%\374@5\260\025#\003\351"
+	.ascii	"\225hK"
+	.string	"\311n\255\217\320\021\251u\320\327\326\213\256\263sRp=\267\302)$\325V)\350hD\325u\215\357\375\320E\3255[\277\2119S\\u]\027i\"\0358\2379\253\220\251Z\235$\005\346\234\363ZI\343\365^\363\265]\3535\223\276\353%v\355\272V\361N\322t!h\270'\234\234K\032`\342\361\346\344\300\262\230\344\255:\224\234M5F\322qXt4\332\240\244O\351kk7\030\300\241\277\273\2726$m\244\270C\005\021\2164\026R\302\322\247\254\351S|\244ii\023M\017\254\361Sj\244_\035t\325\326\325^/+93\271Q\345<W\326g\215\326dvm\263\026{k\365\3265t\324\254\307\332\313\312\201] \356\315/\3479\263\006\3530+\027]\263\n\2251h\236\216@\334\227cH\031\013~JOz\f\030\006G\007'\344\364K\217\365\322\023r0\226\206[\035\341]z\f\227Z\r6\206\270"
+	.ascii	"\033C\304\352!B\260O\221\"4\270\260\204\020\223\b\311^Wo!07\314"
+	.ascii	"\346\234\032w\020\253vh\366\266\326\330\252\177"
+	.ascii	"\330\2719&kM\251\217\036-JufJ<\336=\316W\354\340\305\207\016"
+	.ascii	"\266\334\270w\264\016\f\250\003\252\312\252\245\034\306\345\031"
+	.ascii	"i\334T\255\203E\354\204\334\222\216\034AB\376\316\032\257WDD"
+	.ascii	"RK\215{\312\252\245:X\220\2115n\033\215\243u\240\025yq\243\310"
+	.ascii	"cd6w\224\376\311\367Z\214\324h\212k|<\224\376\032\306\320\200"
+	.ascii	"\312P\271\252\306|k\027\025!\220\031\266\217x\344$F\326S\323"
+	.ascii	"K\330\240\263\361\031\320M-c\315D*P/\224\220\234\354\332M\315"
+	.ascii	"\364\021H\310!h\270RUU;0\376\025K\177\327%%\026\301\253$G\032"
+	.ascii	"'\265\214=!\252\201#\275\265k\353\030\r\243\217\354\332H\355"
+	.ascii	"\342\035\355\027\327\260\346Lv\325H=\324P\263-6\244.j\243\022"
+	.ascii	"~\240+AtG`~\336\274\376Rl/\\\244\264\305=\222\302M\2521\013|"
+	.ascii	"4\246\306F"
+	.string	"\224\366\212V\3615\347\034\230H\\\023\235\2631>\303hv\275\033N\373\013\021\24007'\351c`\357F\304d\307eD\222\236\230\362\306\304\356`P\331\245w\211\003\263+\006\353 \020\231\247H\306HSo00C\217\210p\t\333f\250\335\360\302^v\020\304\205\234\233\332\320TlxE\335`\340\025\307Ov\305+0\327}F\363\n\0034\341!\211P\034D\202\267\326xK\005\305\2131\227\024\351\355\025\r\034\245W\243\303\256\362n\340\251\036Hr`++\027\275\220{\314\372\374\204`\251\016{ib\310\331i\t\325\020\254\205\2630\026\276\302\253]\261\020Lu<\003C]C\031\026\202mX5+G\243\002Wx!\264\334=\231\222{\3014\276\327\201\363\t\002k\017[a\035\370GK\331\234\222? 8\210]\261\025\330\006.\204K\002\261\210?\260\017\264 \030@\215q\017.7\024N|;\354\212y"
+	.ascii	"\351\210\202\2431\256\372\336\211f\020\212\257\265H\013\002\247"
+	.ascii	"\227\276h\227\276x$\3058R;\277\030D\322\027\315\322\027\303\322"
+	.ascii	"\027\263\322\027\257\322\037Gu\030W\333_\334\217\264el\f\021"
+	.ascii	"\313\300M\330\t\b\332\2141\252\364\230\251\0035\220\2145\306"
+	.ascii	"\366kD\254t\274\3446E5$\225\036\307\300Ix8\302\212M\3511\322"
+	.ascii	"\330\341\337\213\306\030F\372Sl\261\201%\206\231\022\214\306"
+	.ascii	"\3070~\334\002\033\341#\024\260\340\020G\361\213\343#\354\"\343"
+	.ascii	"\243\006,\345\314\203\217`\ns\346\201\261\366\003k?\300@\232"
+	.ascii	"\246\304\210\370Ehz<\233\201\350bc\210\266\316\3031\213\2268"
+	.ascii	"\026\374\206\fb!,\204\213\"\220\303\212*G\177\310\244Gu\201{"
+	.ascii	"\320\343\"\025\237\031kRcL\324FS4\316\374\032\343\024)8\340\372"
+	.ascii	"\224\032\343\241>$\366\320u\261\265\340\341 \034t\003\317\370"
+	.ascii	"\b\203\004\261\323\302O\374\274y \246\336@\320\245\344\304\006"
+	.ascii	"\366\301>\370\307k\352\314\2178v\005\244\205?9\376\261p-K\212"
+	.ascii	"~\bi\374\026(n\342&v\236\tqI\301\304M\016\363\034;U\2004\245"
+	.ascii	"\2758<<\264p,N\266U\204\263\f\016\336(v\017\211\022\322\217\226"
+	.ascii	"\";\216\334\025\376F9\373\201e\244\361%\274O12%\256:(Pn\240-"
+	.ascii	"\003{A{\312\305\270\200\277\201,3`4\257\324\2300\271\177\251"
+	.ascii	"\212\236\220U\214\023@-\374\376"
+	.string	"\265Q\r+!\036\215\257\023+\246\002\350\204\244IC[\272\234\314\252\032_\277^a\242\362\200<\033\337\276\357\341\036\247\034n\215/_\007\301\\%\021\331\3537K\210vw\342\310\365\212\262\303\352\302\303\273y \f\225\220\002\2117\234f\320\3067\357\271\302Uw\243i\243\256\356\336\201\210\322k\021l\212J\331\375\336Q9\005\002\261@\343\342n\022\033%\244c\354\006\335\334o\222\2241\266\"fr\255\327\347\242N\016I\035\222\030W)\215\035D/\n\331\330\356\333\227\2228?\027\034L^rn\277om\244\346$\222\244\361mSR\244\3105b\241\330p\272\272\256X\3705r\2377\016\216\220\255\361]\273d.\\J\274\2164\276jV\255N\311\025\r\265\260\260\233\006BEI\330\007`\020\232\225\375\246\241\245_4\254\2244\276g\304\272\250\264</\263+v\311\252\374\236\316.\331\035\223k3b\342[7"
+	.string	"k+\312\361\365\225\244\322$*\007\017Rj\327\333e\007W\2369\027\035`\013/*\202]\272\2123l\374\225'\026\326\335j\201\272\241\204\024\230\372\b\031\366\030\362\273u\265"
+	.string	"Q\244\335i\375f\275\221\241\260\343+>\031\262\365\255\226\216\203\275g\031\264X6\347U\326\007\004\310\275Z\271vQ\224\220~\254\324\3301\250\026\344\367*\002;zz\264\034\024(`kU\257\272?"
+	.ascii	"@\2452\346\263\304\217e\252\205\302\236\035\277?\256\017'X\203"
+	.ascii	"H|\334\036\\/\f\303\222\372K\356\305\013\036\355\202\205\314"
+	.ascii	",\t\b\217\251\251\233\303>\235\025\227\336\336\236\250~s|\315"
+	.ascii	"e\316N\305\323\212a\360iN\265\220Z\257\324\275\301\342tSB\n\304"
+	.ascii	">\330\200\202\256\215^\342\001\004\303\321x\315 \352#\005\n'"
+	.ascii	"\247\033\245\342\023\004I\346RU%!\362\364\033ui\024\311f\024"
+	.ascii	"\0365\276P-{RiO\215\237\346;#\210\030GT8\310$\351I\227\311Fs"
+	.ascii	"\263I\003r\fAe\376+\343\227\351\266\t\031\220\271\306w\251\215"
+	.ascii	"\322\250\244h\277\341\240\346\034\231\0020a\304QkRL0ur0\300\301"
+	.ascii	"o8\350\3200g\220\252\216\007thB\374\206\303\0075j\211\024H\320"
+	.ascii	"\2507\037\004\240\252\312"
+	.string	"\023\226*\323\204\t%B\214\3301\241\306\3502b\307\004\225yT\216\200\271\354\240\326\354\340\320 \217\035\224\313\235\016\032\340\340\354 \221I\244\ns\206\270\202$Re\204Q\305\301Lu\231\243\346\020\177\303a\003!PP\241\003S\265Q\032\231$h\2228\037Te\362\003\214\t\235\344\207\031\033\235\0166:14\310\235\026\344\210V\246,g\212\314\031\244\215N\n\322F\347\252,8.\361r\251*kj\214*&t\2224X\311\324\2715*\322\346\210cT\251Q\227;X]\252\\9c\243\303\301\005\233P2\227G\0335\205\f6\310#\223y\314Y\"\215\312\0207\313#\362xB2\2042y\002\363h\\\001\bK\344\016\316\321\270\202\005\230j\006VH\346\\`\"w\222\037`\230G$\n\3522\211C\003\203Tu\222/\313\020,\325d\215\006\243r\347\0035\310\343\t\034\324\034q\214\"\210\251Q\227G"
+	.string	"\2503\306\033\025T\3441G\2512\325\232\f2\310Q\231K\023*\314\3040K\250\035\320\260\201\t\023\n\260\\QgXL\320\331!\221L\342\304 \215:*\334\330\354$\2257\314\345\322\270\314`s\0341\203<\201\251.\325\024lt4\320I\"[NsT\252H\325&}\003\034\240"
+	.string	"\007\224PB\2059\263\344"
+	.string	"sy\334@\fN2i\302L\ns\003\245\232\263\263\374\315R\251\256pT\326t \202\013*\216\bc\210\025\210\352\214Z\223\344"
+	.string	"\213Z\223\314\301\352\214\007\\\226:I\025\225iL\241f\307(\"U\246\314\337p\230\351\200L\346\344$i<\3009\032\231x9c\203<*\213\"\210$\226\306\034\\cTo\260R\0351b\307\204\022\314t\205\243J\243\246\240\201E\311\374"
+	.ascii	"\n\314\231e\b\324\234#3Uqj\216E#\323x\001\0224F\02188\306\017"
+	.ascii	"%"
+	.string	"\224/\247Y2UP\241\006y\034\301\001si\304Ya.gT\033\3432\004\030\230\313\231\"\213:sB\006)sf\004\0060\225*\223\306\2504\336\320\3140\223I\021\252\362\302\013\3637\001xRGUv`&\223\312\016-&\224L5G\305Q\231\001X\316"
+	.ascii	"\200\304\322\310\001d\362\310\244A\356\214(\036Yt\2269\030\226"
+	.ascii	":6\030\2303%\250\224Pk\220(\324\354\030E\314\224H\212 Ac\304"
+	.ascii	"\021\241\301\322\3468\002\231\374\300T&uZ\2303\016\360\300D\036"
+	.ascii	"wR\026\334(gT\246\261Fgg&\203:\243T\217#\216L\244Z\203\002S\231"
+	.ascii	"\374\200\006\367\340\341\203\007!\350@\006R\032\0168\306\243"
+	.ascii	"R]vH\036; \217\306\234\0164\312e\007\016\032\374Oq\301\364T\223"
+	.ascii	"\321\303\250\013\003\333\354N\264\bdy\342{\243b\201\3450\030"
+	.ascii	"Y\013\300\025\370\256\2707\024\364\245\0023\211F\301\001W\204"
+	.ascii	"\243\244\202k,\004\241)\315\325\320J\217\350*\b\020\024\303\024"
+	.ascii	"X\020\216G\024\317\320\035\214\322\220\2502!\354\227\0021\252"
+	.ascii	";\024?p\237\227\031\220 #N/\240\3505n\250\226&I+\331s\353\345"
+	.ascii	"+p\310\013 \036\227!F2R\374\334\270qz,\f\361\271H\026P\205\020"
+	.ascii	"\254\036\334&7\3440\312y\243s\2054\2224><Li\332\257,C\265\227"
+	.ascii	"%|qG)\371)\315<\2370\260;\364\322\226UTGFH\210\243\254\255N\222"
+	.ascii	"\360\314\272h\024\036GqA3\252a\006C\345\304\t\026\264ZY\203X"
+	.ascii	"0BPR\030\342\300cA\267\272-hc\f\3705<Hv\305\324\030C\301O\360"
+	.ascii	"\037n\001\246\207\217\017\373e\220\243\t\310\"\260\245\007U\023"
+	.ascii	"\017\367\035\373\301D\333\330"
+	.string	"\254\310\330\376\364\226\276\360\3600\023{au\332\035Q\021\341\232N\214\351\0353y\242\263\321\224\26763_\036^\262\342\204\211^\317\213\023\006\025\024\217$I\360\335\002l\006\362\352J\362\303SdzV\330\356\370.\250\356I\224\2431\256k#\225\270\251*\254\306\230\256\303\376\232\242d\250\267\377\r\313Y\255L\244\241HT&U\353\271\202Br,\367\031\202Db4\306qmt\242'wU\2151\\\353p9\034<\344z\211\246\027;6\023\303m\367\256\230\233Z\231H\345\214\315\211\212\300\374\214\312\264d\241\310\232\353\265\343\266c\266\021H\370^\372\243\307\035Oc|\344\330H\024\216\210\037\013\330\310\277\302R\365\304\345C0\275\002R-\243\242\242\306X\355{\275cO\250Ic\\\344k\305\250\222@\250\204\236\250\003\223\303yl\270\345\224b\020\311\b\311l\2224\006\363\024@@HP0\031\315\2275\037\023"
+	.string	"\224\350\343\261\226G\225R%2\222$)\244\003\206~\244B\201G\307\267\362\273\210\b\263Z\317\b)\356\204\3519\242b\033T\023\033\236\302\240X\273\325G\367\341Z)\210,(\342a\263\371\245\314\033<\267\2014\235S\002]\234\333\3177\246]G\221uzQa\205$\313\372\231\013o\252\374\345f\307u\024+\230\361\364\300\373\347\363\025\017\313\021\306)\027\340\205\325q\320\231\343\361>\373\003\204_T\207Im\022\022\nV\231\357\345/\251\026\203}0s\235U\353\225\334.\036\311\021\"\237\021\001\366E\361\025\246h\366\244\267\332\367De\002\354\206\202\325\257\343\02510\n\321h\372\336\240\336\250\201\305\351\245\272j"
+	.ascii	"C\\9>\236\032\360f<\241\367E\235\f\211\333\263\034@\266\001\326"
+	.ascii	"\376\2227\241\033\236\216\330\034m\276u\r{\026(\200\336\303\245"
+	.ascii	"\346i\345{8|$\307\020\215\356\034o\237L\244'\236m\222\377[\216"
+	.ascii	"\323\211\177\326.\356\202O\241\307\232v;+d\210\346I6O\322\324"
+	.ascii	"\3758\210\224v:\n[\024"
+	.string	"\004\337\350y\214\254{\206\271\256\251|\022\264\200:\342\206iK\302Xz.\375\335\013\302\300\f\363'A\263\362\035\266\2656\323\273}\026\253\355.\302\224\263rX\270J\006\337\307\225.\221tgv\312=\034\006\316<k\352\006t\200\257\357\212p\032\376\002T\266;\301\220{p\0319\316\254\272\200~\374qb,\332j-K\240\246\311\320\245P\242\020\300;\344\232]Q\335-\001)-\002l\n0\312\021\0248\006d\234\315\266\373\204\345\251LE\263\242D|\226\347\0376s\202\243\334>\302\370n\247\021.q\211\344\356\301\245\327pE\r~#?\371+\307\177I\325\254J\252\b\374u  7\2227\321O7\311\016Q\222\355\021_)\274\320\230L\0171\231\037H\37218\3065\017f\245\254y\245V\274\320\017\352\370\226\261\302qc\217\232\311\264\206\277\366r|\255\237\365;\246\3754\313\371\243X\360\236^Eg"
+	.string	"\231S\001\324\226\\E-F\355\304\275\234\243\270\342\317K\330\277\213\r\354Fz\346`w\003\307\001\b\264\203gY\344Y\233\230@\007\003\\K\204\374$g\237T\240\003%uH[)\262J\365\031:\263i\330\224\301\234\336\204-\242E9|\264\256\3127\013\205\325\260\340\233\375\016({\263f%\336j\222\331\002P&\321\204\301^\210,\232X{/\b\262\360\315\364$\215\211]\351B\317G\021nv\223\250\031\035\331L\365kO\242\362%Y\271\235x\333\240\317+\250\330O\313VR)\205\273\275"
+	.string	"\215rr\222|1\007\205l`\312)\313\315\317\227\372E\201\240g\334\325 \220\202\207\233k(\004\307t?\027\354\325\330v\251\037\373\026\306\363M?\350\353\323/\263\020\n8\326\242u\305+\f\324\333\303{\322\306^/\205T\354s\021\225\366\210\275\210\266\310\240\022RM\324\275TqQ\226\265\230\363I\361\257Xit\2771\016\334\374\2349\315\361O\237\214/93\306:\023|\030\215\021.\340\021\223\323\351\204\327I\336\337\307\304\227\217\023\342z\335\345\235\324Xq7(\0375\350\336\343\221\227\205\325u\213\243\207\224\\L\232@\276\200\212<\254\001\200\200C\322\305\177\255\031\243q\353\327-\314\305r%\3362\217q\353\024.d\273\022fF\336XP\023\260"
+	.string	"\004\342\253J\331\324,\364\263\345\203\327f\243\232\222\006o\312\225\352#\033V\022\302\226Q\024[\343\313\005\tv@M\222H\307\300\263le[\212W\222\337g7\244\241\316\334\020q\005I\347\364\337Z\301b\205\301m\267\353\026\207\201P\203\231\207\345\\Q\374\f\231\303x\307s\334\255\355\265*V\370\2261\005\017\351\013\310\323\t|\004\020].\270\212\260\277mH\030\211"
+	.string	"\004 \032g\021.\254\335\226D\26133\252\265\007\314\032\322\237\374\t\3479\270fsL\034B\367\327\017\347\266@\r\026\354]\322\311D"
+	.ascii	"\273\320v\231\275\225\343<w\016\221\225\345\017\254\210w\353"
+	.ascii	"\203\376\312\211^o@\027n\217%;r\367\315\246\350\342\n\367\220"
+	.ascii	"\2417+ \273\203\3036S\262\331\235\376\310\032\f;\022*\034k\020"
+	.ascii	"\005\364LMRGQ\221\241\317\224\374\231=\355\"\341\246\264=\332"
+	.ascii	"Z\205Y\304\300)#\b4|p@(\030\271\201\333px\267\022\200\304\203"
+	.ascii	"Y;\027\336C\306T\203\245\333\033L2N\343\007\21265\257xd\214\361"
+	.ascii	"\331[A\311O\024\035\037\321\206\215\3534\232:\327\356l\345\222"
+	.ascii	"\2618D,\331C\213\327\321 \004V|\177[D\236\343\223\\\201\345\033"
+	.ascii	"\2229V\321\225\236\276\221\266 \216h\351\266(\023P\233v\227\022"
+	.ascii	"\317J"
+	.ascii	"}\263\"\276.\220\207\336B}6\203\nD\224\3229\b\245A^79\226\005"
+	.ascii	"5\212\354e\304\271%\240\365b\032y\270^\302[o8\00224\202\324t"
+	.ascii	"6p)\276\374\004\017\226\253KR\334\273n\347I\2301+\250Z&p\343"
+	.ascii	")\233\352\023j\220g\210\245\306\225\320\317\2411\036\314\352"
+	.ascii	"\213\030R)\304\177P7/\216/\t{p\r\263C\370'A\372)H\024\341n5\253"
+	.ascii	"EN\346\374\240\203\037\217a\036\317\376\212\264\274\027\216~"
+	.ascii	"\224\316\226%\024:\340\203\301\341\331\200\342\263\007{&\r\235"
+	.ascii	"\354\fSx}\341\220\003\t\334\036P\0256j\036q\272Zm\376W\324\352"
+	.ascii	"\314 s\320\002A:\234\230\365Gh\rb\241\324\212\234\222\275r\271"
+	.ascii	"\004\210\026a\270DW,\f\237W;\345\247\032\007\206\201N\320E\273"
+	.ascii	"\240mBy\323|\353o4\220\006\367X\242\311\001v^ J\250\340\224\262"
+	.ascii	"\245\344\343\355\311\356P\366\265"
+	.string	"\343|\253\227\311W\230;\224UN\203\251y[\223%\343P|v\334\326\331L\334\251\002.\251\254\323F\335\252\351\234\024x\371\205\215\330\346\251j&I\025\tc\035*\260\026\246\214\210\330H?c\210\"(\376~@8\344R\377\204\317\257\376\033\277\017\331\377wZa\205_\024(DQB\022\322b8\n\330\206\307\305\357\202\314\244,\326~\261\316M&\016|\234\257u\250\266\274Z*Y\331H8nf\\vk\304\355Ob\242\"\367\2528,\360\260g\0057b\212.$\370\304X\026b\225!\345\344/\212\230\340h\267:HA\276U*G\351\275f0Q5X\026\001\210\243\271\326\323\303;\247\271X\332\210\200/D\301\376R\\\031\256y\203qJ\203h(\320D\333U\220\377\304\213\373u\\\254I:F#\264r-\311\357\364\260*\302l\272\230F\374f\213\274\030\271\345\323\017N\216(\300\336\271\235[\023\335"
+	.string	"\256\rE@s\024<\246\337P\221\\\003\322\361/\343\350\"\222y(sH\350It\021.\3276'\223=\032v\372~\f\b\260\333\035uQ-\361\b\233\230y\206\326\202.8gM!\273@\317m\330\177\020<\220\025\236\024\002\\\016#u+\207\265\3242bA[\004R\001\331\352S\304&&\216p\344\276\243\341%\306E\306\022\230\212Q\274Z(\216T\264\313\036l\372\370m\303\331\257\374@\211\2570L\270\337.\337\271\274\216S\274\255A\223t\316)8I\307\233\272\243s\017\334:"
+	.ascii	"V\377\307\336W?\013\366-\245\364.?!\327z\357\031j\027\340\376"
+	.ascii	"\341\3206\377\357\252bw\2564\342\210\037g\241x\370\213\032\374"
+	.ascii	"y\347\273\237\306\251\027\177\202\213{\330\251\003\024gA\325"
+	.ascii	"\204?<\345\246\364\347\262\275$\035\213{E\027\237\353\246\333"
+	.ascii	"\363\227y?\214b\312\314\314\363\305\354\t\337\301\277M\342\375"
+	.ascii	"\277\231\204iS^\036\250_2o\360\235\344|\316\344#\214W\344\333"
+	.ascii	"\277\337\261\002thB\213|G0\377<\360O\274\374q\306A\365\370\234"
+	.ascii	"\rc\216\201\335\n\374\207\367r\303\327\353s\265\235^8\027\372"
+	.ascii	"\031\336\001}\361\256\337\337uc;\335\355\251m\257\350\330\246"
+	.ascii	"\203\215?\255\254\240\345G\306\3710\360\r\222\257\376\230o\242"
+	.ascii	"\255\336\037\216u\376~q,\364\202\007\311e\360\321\263\206OL\031"
+	.ascii	"a\017\202\333\031\214\213{\335\274\324C\321s\021\262+n\333\334"
+	.ascii	"\237\303f8Xw\340\373\353\253\036\326^?4\356\212\340\206w\213"
+	.ascii	"\275Cn\254\374N\202\377)\373\225\277>\177|q\346\334\017\035{"
+	.ascii	"<W\206\017\344\235\023\013\234G\\\336s\313\033\254^j\312_\275"
+	.ascii	"\374=\347\307i\205\236\301\301/#sC\327\b\233\361\027\330\374"
+	.ascii	"\342qg\201z\364M\356\344\351\264%\367\347\334\211^\227\277\353"
+	.ascii	"\253k\030\363\022\215\314\337\265\274,\261SI\2219\324e\256\\"
+	.ascii	"\002\026K\307]\001"
+	.text
+	.section	.gnu.lto_.symtab.70e485b4a26296bb,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.70e485b4a26296bb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
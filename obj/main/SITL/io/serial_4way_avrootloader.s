@@ -0,0 +1,120 @@
+	.file	"serial_4way_avrootloader.c"
+	.section	.gnu.lto_.profile.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\007"
+	.string	"\342\r68PO\323\001\240'q\256R\302\256\3517\016\234\021\230\006\360\263\262\005\266\252\2008l\237@\333|Dt\265\375\025\343O5\030\024y\260\362}\026\316.\304 \337\327\265%2\005\247\270\034 \0324\023\327\211KqukQ\357\234"
+	.string	"8;@\300\234\255#\237\311`U\304\003\203\324\256[%\250\345\260\265\367\202f\036\305H\3108\272\335\332M\273M\316F7S\273\335\274\254\n\315rX\275\026\333T\334y\032\352{\203\372\353P\177\262\207c\343\312P!\371\\\362\347\304"
+	.string	"\363\202\322a\022I\rvH\203\254\026y{\364\307'\017\230Gr\006\251\211\245E\243$\222\276 \337V\244\332\212\377A^\260\222\025. \253&\210R\017\304G\362\177\350\177\312\377\016\3030\374\037\360\337\373\337\t\t"
+	.ascii	"\257\354\225`\326\f\r\303\205h\204S\027\265\262B\224\021\270"
+	.ascii	"fl-c"
+	.text
+	.section	.gnu.lto_.symtab.b0e4c2a9ba1c5865,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b0e4c2a9ba1c5865,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
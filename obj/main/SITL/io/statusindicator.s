@@ -0,0 +1,383 @@
+	.file	"statusindicator.c"
+	.section	.gnu.lto_.profile.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 k\235\002"
+	.string	"\344\003_"
+	.string	"\n"
+	.string	"\203\204\373(\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\337\301\220\244\005\003\327\213\334\342\013\002\002\001\002\001\004\005\233\304\365\321\002\006\233\242\376\312\004\007\b\343\247\262V\t\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"P\020Z\3252\227\006i\n\374y4\315&`\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 --\001"
+	.string	"\330!"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\001\005"
+	.string	"\001\006"
+	.string	"\001\007\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"1\003\241\004\263\001,"
+	.text
+	.section	.gnu.lto_.inline.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\375\002"
+	.string	"\022D\016\031\300%\035.\347m\343\377\377\246\277\263\265\306\377\377\273q\304\022B\032\331r\247+#\222\301\344X\024uB\007\030H\276\2553_\300\177\316\363\213mk\370V\034\322\026=\332\204\016"
+	.string	"s\263!@\006N\200u2\006:\200d\216\222\342\n\210]a\206\020\214\246"
+	.ascii	"\244\264\003\013\036\005p\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 (\365"
+	.string	""
+	.string	"\240\034"
+	.string	"\007\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"5\307[\002\333@\033"
+	.text
+	.section	.gnu.lto_.pureconst.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\002\230\004\003\230\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 \214\255\001"
+	.string	"\310\200"
+	.string	"\007"
+	.string	"\001\002\002\001"
+	.string	""
+	.string	""
+	.string	"\002\003\003"
+	.string	"\001\002\003\005\006\007\b"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"3\r \\\027J"
+	.string	"\342\300\314\300\b\300\024\274\254\346\274\035s"
+	.ascii	"\267\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_warningLedResetTimer.14.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\375\b"
+	.string	"\026RA90\345(\035\200\213\027\320\345N'K9B\240\323\336\321\231\002<eJ\224\331\214\b\374\266aWAM \006S\002\376\220\021\0214\nU~\317`\275p\"\253\242F\366\3362\245/"
+	.string	"0"
+	.string	"2"
+	.string	"r\363\202\3532\236\340\272\264g\277\030P\f\244X\224"
+	.string	"\330\335\t;\356]=\377\252\013|\244\3205\263\260\273\326\217\204q\303\333F\260\255`\273%qw\327\260d?uGU\377\222'\226g\234\354^\264\002,K\242|<\365\333\277\312\032\037\365\020\357)P\\\023\006\224\n\314\356*\341\3223\340\001 \337\303\021\234\376\273\364\271\353R]\276\030\221\266| \262q\320\025\341a\306\264R\2411\322\226\245\332\237\t\375\027\341AL\254\021\f\331\253\220B\016\373\001\037\315\003\335\341lZ\207u\262\006O\306ItX\307M-\233\236\f{\230\235\215\233\234\2155\b\207mv\232\266M\315j\037\027\226\344\211%\202#\037\372#'\t\b"
+	.ascii	"3\241\331\037\030e\314=\3412\233\253\313\007\366\205\313\261"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_warningLedEnable.15.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 \346=\006"
+	.string	"\262\213+1`M\323\001@\235\r\264%\326\232T\346\273\347\204\035\240<'+aC\b\361\017\352\276\020\273\314L2\030\006&\301\335\004\330nh\250C\223m\367N)~\032:\253\363H\005HF\016\325\251Q\2342B\322a\210\017\215bc\340\331\260@c\235\223FF\333\277\f\212T\254\007\341_Z|\217\177H~\206\037&\367\353\320\237\226C\204\r\216\022\313m\266V\271wa\237\262/\263\337\200\005\301\266K\261\235l\005\206h\330>c\312&)\210\020\030\221"
+	.string	"1\331\335\3700N\335Q\376;\036pa\325\035@\302\356\332]X\305\375n\373\300vc{\"\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedDisable.16.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 \346M\006"
+	.string	"\262\013,3`M\222\016\300\320\216\343\035\033#Xn\246\302{\202\n\004\347\n_c\220\265\033\243\224G\3330\320\253\364\266\n\202\302\305\220\367\211\201\320\321qF\311 D\246OQ\025/i\242\026*\224\365pI\227\005#\005+\224\324"
+	.string	"\247\312\202\321\301\321\201\241\202W\214\025\244p\262n\363B:\031\027\361\265@\267\243\036\226\2331\304\2455\353\273\027\250/a\303c\222i\237\347`\232\273\370\002\244\333\274#\020)\030\311\254\370\234d\347\201h\374\245\214}\211\201\304"
+	.string	"\311\304\207'3\241\303(\326\206\335rT \323`\332\002\0242\363\226i,\272\353\217\360G?E\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedFlash.17.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 \346U\006"
+	.string	"\362\313,4Pm\222\016d2\030\242\261\252\342Y\017\356\230\"\372\266j\360\302\307\263h\355n\304\314h+\006\276Ul\252\231\031DU\225\016\t*\021\321\263\214\222A\210L\001OQ\025/i\242\026(\224\365pI\227\005#\005)\224\324"
+	.string	"\247\312\202\321\301\321\201\241\202W\214\025\234p\262N\363H:\030\027qk\005\272\233zTn\306\020\226\326\254\357Z\240\276\204\r\307\b\246}\236si\356\342\013\220\231\271\323\274#\330("
+	.string	"\311\254\370\224d\347\205h\374\235\214\275\210\201\304\200g\342\303\223\231\320a\024k\303n;*\220e.m\001\n\231y\3132\026\335\365G\370\243\237\"\007"
+	.ascii	"3\003\366:\243e\270e.\203\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_warningLedRefresh.18.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\375\b"
+	.string	"\006RA80\221\322\001(\344Srh=H\340R\206\353\275\314\341\322<x\205N\274\200x\373\004{\241Q\t0RS\202\0173\"E!\021\302\335\207|\350T\266{\213\310&[\246\024."
+	.string	"0"
+	.string	"2"
+	.string	"\235\023d\227\330\007\262K\177\366\313\301\205@\r\206\312\314\356\316\030\362\357\372\371W= <\201W\200\206\335\265\206\247\215;\336v\202\355\005\333\256\273\273\216(\373\251\033S\3653\206\026\003\231\335\214\027\315\266$\313\310S\277\375\253\314\361M~\362=5\332\200\032\233\025V\007\314\356J\341\322ss\031\027\361D\247\017/\375.\273T\2270\206\244/#\240||\224a\361\261\202\303e\362(\351\313Rm\221\205>\304b\201\211\244U\212\240\275\0025\202\330\307\002\242-\024\r\362p\233\367\001i\017!\255\243\360>^77m\206\264O\304\004q\335\364t\274I@p\323\3336nrV{l#\312\241\244E\212%?\372\254\247\214\034\b"
+	.string	"3\241\327\037\030]\314=w\031\335\325e"
+	.ascii	"[\302%^\264\223\f"
+	.text
+	.section	.gnu.lto_warningLedUpdate.19.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"-\013"
+	.string	"f\026O?@m\232\016\370%\343`\350g\214\310b\0078\236&5\261/\215yH\370_\021\246\020\245\275\177\262\204\210\337>\031\257\033\214>\322\"\3130"
+	.string	"uA\256\202\0347LI\367\245\203m\354nR\246\024="
+	.string	";"
+	.string	";"
+	.string	"\360\317\226m\342\234\310\276\263\300\001a\262\273Q/\334:\244i\371\002\264\353P4\341\n\031\340\234h\030\240aP\305\344\"\371\366|\240yd\002\300\330]g\246I\270\337m'\260}\300>\202\273\273V\020\373\235\033jZ3\235\231~"
+	.string	"\350)Q\031\331\205\360Y\261%\217d\303;\277\375o\246\370\035\356\301z\247#\272\"D#\035\006\317.g\361\347\030\375Y^"
+	.string	"\376A'\020*\234\252\372\020\234\223+\324\324\177p\300\362c\377\303\273\016?\203'\215|\366\347k\300\277\353;1\"E\205M~\f\323\336\340\310gP\277\375\024>D\224`z\331\034\226\032b\037\n\034SF\215\271\240\246\352\202\221\026d$\315Fu\2514q\222bF\272dD\f\245\211\027\026O\016\030P\261\232&*R\270\315\025\304\030\033\305 J\332\r2\362\2315E6\024\036\325\020\213\253*\350Hxd\016"
+	.ascii	"2\003\3269\304\352%\207\331\013\264\3718\034\3772\022\022\251"
+	.ascii	"BD\227\201]\035\001\260E\\\346\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_warningLedUpdate.part.0.23.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375`\020\001}\f"
+	.string	"F\027R@ o\233\016 \232\243\016H!\005\020\0037\n|\f~a"
+	.string	"\205\323!\026\220F\310<\177\224\032\305,\276N\211\035FB\250\275#\231-$\002\b"
+	.string	";`\003\375\001\300\020hN\320\321\2106\221;\245="
+	.string	"A"
+	.string	"@"
+	.string	"\003\244\307\350\002\244\307{\260\275m\314\331)\356a\330\177*8(a\261\273\362Q/\234\273\302\210\363a\307\301\\\017:\354\234\3508\020\016\003<\272\310\330]O\021\356x\333\007l\033\260\337\t\276_\362\317\007\221l\036\227\177\214\200\004u\361I.\367h\225\006c5\026<8\334\027\331\374\021S\336v\217\346J\343-gs\317\324\243?\034\004w\2176a6\023\350\223A\305\256W\340\321rz\254\0360d\002#\037\327\244+T\006\035\023\035\02420\344\013\350\177\330\006|w=\350\227\320\321\241DF1PC\254\321\243\335]+\210\035A\303\177\367%"
+	.string	"\223\t\273\017B-\366#\216\330p\221\377;t\r\246E]\231\\3\243T\254\004\026\013\333\310(\031&\247%-\026ECV.LN*\317\005\n.\231\315yI\352\321*\210384cU\r\261\r\325\017q\021\232\257\301\0323\372Sz\204(\272\025\034\001\034"
+	.string	"Ec\264\256\300\3705\3440,\241\n\020\020\005\303\310\0256\027F\300=(\f`\004g&\004\004\244\t'!5\250T\334\243\256#\2350\2050v\352\236N[6\363vZ"
+	.ascii	"\256\275\243\260\314l\376\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\215\004"
+	.string	"\242\306\030#\240)\035\317\256\352\275\3017\214j\021\211\357\306\377\377\2776f<\335[\373?!\204p[\022\273\267\2242\005\275\311\341Cb\251\264a\214\203\271`M\311\206\373\337&.\221\017\327\006\224\217\013\216\t\310<\bX\320@\213\261\204\355\021\200#\314\366\246\257g\265U\274\265\t\322\272\2458N\375\2772\002\333\036#\022"
+	.string	"`\013@p\213\2208\f\303\247\b\352\2312\215`\270\204\300r\36096|\031\320\003\374\301U\236\235\031"
+	.ascii	"7\274\n\b\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375 /-\001"
+	.string	"\330+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\001\002\003\001\004\001"
+	.string	"\001\005\006\007\b"
+	.string	"\001\002"
+	.string	""
+	.ascii	"\004\004\002;\005\\`R\222"
+	.text
+	.section	.gnu.lto_.decls.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"(\265/\375`z\007\005)"
+	.string	"ZH\030\020G\200\334\321pN\343h\340\261Q\023ObD\270\326:c\032\337D\330\326\020^\202fh\006\344\367Pz\352\322\346O\b\366\366\345~(`\2009\245\272\252\224\\i\252\357\234A\366D\215\304\337\266Y\2006\346Nb\223-S\323"
+	.string	"\345"
+	.string	"\370"
+	.string	"\256\316K\026\344\261m\274@>v\363\251\230\"\201U\255\324\335\214\226\036\215=\330pR\302\262i\311\211\036C\212\343,\001\206\257O"
+	.ascii	"&\232\220\344\211~\002\026F\356\\\t#%x\242\\\205\255p\025#\177"
+	.ascii	"\266\342+G\255\334Fv\277=\265\240\0170\255\023\005b\0046\224"
+	.ascii	"\r\330\316\357\013Xu\206\237\351\031g\363a\234\355g*L\205\253"
+	.ascii	"\265Jn'\273\337\237\2368L\341\324\211\376e\004\266\224\r\330"
+	.ascii	"\"\b\370y"
+	.string	"\310\177.g'x~\026rFM\230\025\260)_P\314\320\237\227\244\371?V\366?\302\317I\376\223\375g\376\027\373\257\374\037\366\037\314\353\177\327\177\256\377[\377\265\376'\377g\371\217\374O\365\377\366\377\353\177\232\226\226\226\366\263\210\237\215\374;2\002\266\016\026\273\233\307\316\333E!\317y\207\031\367\367p\215!t\355\004\220t\023\233m\322&Z\301 '\372\037\250\247\272\201?\375v\261E>\001[,d\214?o\023I\320\310\250n\337'#\352\366\331os\017\237\214.\332\327-\266\257\013\274\365\320\005v\277\306[\233\f\002\271E>\031[\244k\374\351a\003\033\031$\222\016]c+\3065\336Zd\320\330\016\237\214?JM(%-\323\212\211\305\332a\353 6\005\213\267e\373\272\335\354\346d\215.B\350nr\213\315\340\022w\021.u\b\263\202.\277\335\275\200(\204r{\270l\245\334n)\341Q\0231"
+	.ascii	"\337e'\341%0\252\251\225jt3\350\267\233\330\r\344^v7\260\273"
+	.ascii	"\001\024\233\336n \267\366H$v3) v\023\320K\215\35639\326\305"
+	.ascii	"\330\"\241\002q~\270u\320\030\025\271\2529\245\257-\245e\312"
+	.ascii	"0\223\255\034TY\2023\325\315\204K\227\232D\271\301\3443hYW\032"
+	.ascii	"\235\0235\303\023\364\241\024CK\177\226\245?\213\211\361\025"
+	.ascii	"\372\266\321\206e\312\307\0238]\0043\2416'\214\021\256)aa\254"
+	.ascii	"L\201u\006,\231q\262\222\244``p\216<XKs\206?\276\276\310\316"
+	.ascii	"\242\222\247\215\364\374\205\331\313\213\261@ph\243\365\006"
+	.string	"\313\326\325U\353v\032s\364\241QfJ\212\231r\235\213\225\351\255\205e^g\002\266|u)\275\244\347.\314[\347*\336\342+\020\034\266\254\234u\361\235p\256J\317|e\313b\255,V\332\272\371uw\024\233\251\210;k\341-g.U\314\205\225\277\005\273\205\335Nb\021\310\230\301\341\005\247\231\230p=\3075P\320\334\234\225\277\205\f7\343\351\246\352\356\006;d\244\230h9\321\2630=\213\364\347\037,\321o\004\017\t)\367[U\030\274\325\210\001K\364C\241&\361\330\364\347[\213xI\266\037\005\2118\021\302D\216UW\254;\226E\221\017i\203\272\3726$\251\354o\206\t\237\243\237\272\252PK\034\375vH\036~<\016*R\212]\257\303\215U\177j\211\003\253\232\304;\341s\240\373Z\250k\216\365\371\326\334\200[\205 v\335\265\bR\331\235Q\013\024\t^\304[\325\236\272\"=\006!\nB\032d"
+	.string	"\270\206\241\nC\025l\3270\244\323\r\t\351\322\013\351j*\221\312\356X\023F\252\210\025=^o\335\305\370a\211,\\`{\274\027\351u\272\r@(H|H\213\202V\037\273+\342\031\365x\277\027\354\216\375\345|\274\\\217\267K\312\025\255\277\\\320\2035J\024\353\007\022\2503&7\243\242\344P\203%`J\032\252%\263\253\024\313l\231\343LCV\373\322r\002\345D\233M&{m\330N\311#zD\016\2251\262\261"
+	.ascii	"\001\200\215\250a@f\210DHfDDD\244i\322\001\220\002\2211d\035"
+	.ascii	"\021 \251\342J\216\224hk\317\244;\n\370\206\203BH\277R\272\236"
+	.ascii	"\262\333\0024V\324\214\217\220\221\276\241\005\030\303\200\273"
+	.ascii	"\034\372j\337\276\251j(=S\323\341\251\020x\034\016O%\240=\\W"
+	.ascii	"\n\373\350\265\251\303\223\b\242\022\345\274^\261F\216pl{{\032"
+	.ascii	"\267\311\203\036g\001\233\022\232\n5\024\006\nKr\350\343A_1\205"
+	.ascii	"8a\024\234\375xD\272\303\026\271\306\276m\035\244\373g\275\300"
+	.ascii	"\323~P/i\252\273\016\023\244\034)b\212\201\037<\222\031~l\244"
+	.ascii	"\253\006f\237G![C\245Y\f\330\270Dw\350&\340\275\223\"JR\224p"
+	.ascii	"\215>J\340\352RKmt\207`\257N\221\220\3613Jd\237{\n\2122\b\241"
+	.ascii	"\244\363\331\377\034\003\371=\036!\375\372\257\336\264\177\345"
+	.ascii	"a\254\re\217\320'\335\306\262\031\314\034h\202\022\230Q\f)\021"
+	.ascii	"Va&\267\302\3450\315\363\036\007g\372bZ\277_\235\325"
+	.text
+	.section	.gnu.lto_.symtab.4076ac2fb3ff4ae1,"e",@progbits
+	.string	"warningLedResetTimer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"warningLedEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"warningLedRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4076ac2fb3ff4ae1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
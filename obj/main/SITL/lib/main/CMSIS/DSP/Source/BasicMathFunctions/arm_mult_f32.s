@@ -0,0 +1,203 @@
+	.file	"arm_mult_f32.c"
+	.section	.gnu.lto_.profile.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 !\255"
+	.string	""
+	.string	"h\025"
+	.string	"\001"
+	.string	"\335\217\254\255\016\006\002"
+	.string	""
+	.string	"\002"
+	.ascii	"\271\2156\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 !\205"
+	.string	""
+	.string	"@\025"
+	.string	"\001"
+	.string	"\004"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\240\223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"$\0035"
+	.string	"\001"
+	.string	""
+	.string	"\r\235\272\321\323\002i\003"
+	.string	"\001\003\001\002\001"
+	.string	""
+	.string	""
+	.string	"\002\024\235\272\321\313\002i"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\001\004"
+	.string	"c"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\204)\312\006\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 \"\305"
+	.string	""
+	.string	"\200\026"
+	.string	"\001"
+	.string	"\004\001\001\001\001\377\001\177\002"
+	.string	"\001"
+	.string	"\002"
+	.ascii	":\2226\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 .\365"
+	.string	""
+	.string	"\240\""
+	.string	"\001"
+	.string	"\004\024\024\270\006\274\006"
+	.string	""
+	.string	""
+	.string	"\001\002\002\001"
+	.string	""
+	.string	"\003"
+	.ascii	"-,\354l\335@\033"
+	.text
+	.section	.gnu.lto_.lto.b3c6c11689655758,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_arm_mult_f32.79.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375`\\\002\r\024"
+	.string	"6%\206J\320\360(\035Z\032\2552e\203\306N\345C\211\264\241p(\025\323,B9\003.\321\205O2\224{oTVZ\357\217\367\201Z\353?>\035\245~\326\225\361\220!w$\030\032\030\301t\034\035\004O\241\343o\221\241\377\223\275\345N2n"
+	.string	"j"
+	.string	"q"
+	.string	"\374\024Wa{\257\3268\rz9\232\3565\t0\204\324-\233\017"
+	.ascii	"\336\246\016\002\336\262\215YFH\316\003\307\005\"\247{o\330\037"
+	.ascii	"\270u\236\347\371j\236+\265\335\326\2466>\375\261\241\343\325"
+	.ascii	"\334VT.G\004\213\227\253$OMI\367\235\356x7ZI\350\274\357{\r\362"
+	.ascii	"\231\241\343\351\234\242\024\334{\231\352x\032\316\340\231\271"
+	.ascii	"df\222\231\316\002\367\270\371\257\336\373;^\364\253~tF]\350"
+	.ascii	"\f\336<\333\367\316\265)wS\246M\371 )KN4B~\367\346\2347\356\222"
+	.ascii	"M\032\361\243\237\371\367\361\212\231\217hDp\256\213\363\260"
+	.ascii	"\003\272\327\034p\313.\314\2242\177\305\211l/\242y\206\224\321"
+	.ascii	"\r\203J\352V\244\036\004\024\252\205\270.n\b'\305\254\035\300"
+	.ascii	"\275<'\220\204S\016\252\023\277\235f5W\332\321\265w<\262\301"
+	.ascii	"\304P\f\034}\252\367\336[\231\006D\365G#\370yq\263\323\315G\242"
+	.ascii	"\315P\030g\322\325\240\375\356n\245\233\240\033\330\256\276R"
+	.ascii	"I\273\231l\267\272\2728R\205\231T\b~\r\274}S\242]\007\033z\362"
+	.ascii	"\207^\233\325*?-nJ\334\350\331F\277\034\257\273\207\331\254\241"
+	.ascii	"$ \236\232\270y\230?\\-\326\205\036e\314\344\205d\001[,\300\304"
+	.ascii	"\227QF\262\250\312\230\223Y-Y0\322\304\231\345\261\200\201\003"
+	.ascii	".+%)\003\263\002C{\20511\031\254\034c2\f(\224/\224\021\026\363"
+	.ascii	"*\t[F\232\214L\f#\210'\241\350@D1\tc\260\027L\310\002#\023\260"
+	.ascii	"l\326B\013K\231\214\026\256\314\373\346y\200c\311\246o\266{\230"
+	.ascii	"\374\261\350\217\236\300\201\252\032%\300\247]\036\r\216\240"
+	.ascii	"\350\326\252m\357\356{. \260\002\021\303\352O*Q\020Xwck+*\326"
+	.ascii	"e\223\326\030\n\241\026\203\264\260\345\361\333\225\342\272\375"
+	.ascii	"B\257ig\272\311\367\362\343\252\334s&\215R\\\245Ft\354\201\226"
+	.ascii	"Wn\273\333\256\261M\232\245\315\364h[\341\007h\327-\213\317\254"
+	.ascii	"\315\017?0\240\224\026\201\027\305\275\026\223E\266\230\362\353"
+	.ascii	"\300DLW~\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\317"
+	.string	"\177\003\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b3c6c11689655758,"e",@progbits
+	.string	"(\265/\375`\267\002\355\027"
+	.string	"\346\257\250I\240XU:\200\017_\332\3425\343\226U\236!\227W\237D\254\205G\244?\360.\371\001a\353;\366J]\331\214\326Ti\002\343$"
+	.string	"Z\313\277\257\227\343\202\370\355I\326\363\214\351\356O'\336\016z\240\347\206\300 \217F\006\221)\207"
+	.string	"\221"
+	.string	"\217"
+	.string	"\275\035\231\226F\367\371\277YH\337\311\002\2138n\272C6\310j\221N\271\372\364\2571\247(Y`"
+	.ascii	"\305\321\035H\357\312\024\263+\223\275G\366\002Y\242\375\275"
+	.ascii	"\230>\350\201\177U\r\270Q\264t$\216\366\006qp\205x\353\032y\374"
+	.ascii	"\241\245\357\177\352$\345H\216*\342(\263\005L#\006\322[\344\005"
+	.ascii	"\277G\260H\272n\001\023\271\004L\033`\354\215a;h\333\3106\222"
+	.ascii	"\355\237\355\321v\023\333\342p8\034\332\266\261]mQG\267r\315"
+	.ascii	"\264w\232)z\252\236{\371\364&D\346\320\323TB\317\224\231\336"
+	.ascii	"N3\327;U\272\245\241\240y\345\027\264Bf\356?:\336m\227\022\232"
+	.ascii	"\025\375\224\177\201=\3371\370y\350n\312\255\305.\301\t\177p"
+	.ascii	"Hn\350\326\377"
+	.string	"\bt\270!\3649\241\331\003\375{\340t\256\203PV\341k\254\260\224\301\273O\317\237\340\365\327\375\345^\370\277\374\017`\307\253\377\213\224\351\323\351~\240\003\272\363\312\244\236_\004RYr\232\351\020\332JBJ}GQ\313\365}J6M\004[A\375D\377\025\254\017\215\034\023q\334$\250\031<\240\004\211\343\"\t\320\205H\222\2228\356\221=B\341\030\332\270!\216\336\262Dl\237LNTt\341\"\216>AZ\264M\277\355\376\257\200\251\337\341P&{\2750\273+[\300\276,\203\277\304\370\370\177\226\264\220<\202\267 q\264-s\333^\037\177\251z\375\316L{\2459\004\312\251\252\0272\360T\306\315\332;G\264\024_\277\317\365N\022fEwfE\313\324sh\371\3273e\002\003\326\231\321\251\271` l;/Y\006\326\314\312\263\0210\032\2536\233\321X\001P~\305h0\031L\004i\b5\rjlL"
+	.ascii	"\260\315\215\203\033\007&\333\334\264Z75-\3225\255\027Y\314F"
+	.ascii	"\326rh\036\324\\\263\235\020'\267Z\025d<l\300@\276fh\036\204"
+	.ascii	"\310\251\355\330xrxh.V\t\331,V{\311l\027tj.\r\257X\t\027\005"
+	.ascii	"\026\354E\263\315pX\034p,\260p2\340h\250\300\222\305\\<\254\017"
+	.ascii	"\261\035\t\366\002\267\210\327\210\275F6\2302\375D\276\242\t"
+	.ascii	"X\224R\374X:\020\320jw\344p\361D\2117\030\" @\002\243X]u\t\f"
+	.ascii	"\306\246\244z2\023\217\330\3210Y\343 +0\206\364L\305\300\253"
+	.ascii	"\267\2243\322b&&\355\240\005\177V\\\2429\326\212$\242T\016\255"
+	.ascii	"|z\320\232\300\314,\315r\223\265\003\307\0162YB\303\301\203\251"
+	.ascii	"\021\311\003\373\025\264\351\320\335\363\205\270;\241"
+	.text
+	.section	.gnu.lto_.symtab.b3c6c11689655758,"e",@progbits
+	.string	"arm_mult_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b3c6c11689655758,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,232 @@
+	.file	"arm_cmplx_mag_f32.c"
+	.section	.gnu.lto_.profile.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 !\255"
+	.string	""
+	.string	"h\025"
+	.string	"\001"
+	.string	"\220\357\304\235\003\006\002"
+	.string	""
+	.string	"\002"
+	.ascii	"\271\2156\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 #\325"
+	.string	""
+	.string	"\220\027"
+	.string	"\001"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	" \363\r`\001"
+	.text
+	.section	.gnu.lto_.inline.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 J%\002"
+	.string	"\264\003>"
+	.string	"\001"
+	.string	""
+	.string	"\021\373\242\227\374\002j\003"
+	.string	"\001\002\001\002\001"
+	.string	""
+	.string	""
+	.string	"\002\026\206\200\200\354\002i"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\001\004"
+	.string	"c"
+	.string	""
+	.string	"\003\f\001"
+	.string	""
+	.string	"\001\220N"
+	.string	""
+	.string	"\002"
+	.ascii	"\204)\312\006\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 \"\335"
+	.string	""
+	.string	"\230\026"
+	.string	"\001"
+	.string	"\003\001\001\001?\177\002"
+	.string	"\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\2016\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 -\355"
+	.string	""
+	.string	"\230!"
+	.string	"\001"
+	.string	"\003\024\270\006\274\006"
+	.string	""
+	.string	""
+	.string	"\001\002\002\001"
+	.string	""
+	.string	"\003"
+	.string	"-,\354\254\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.8f51c5bff91b11c7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_arm_cmplx_mag_f32.79.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375`\342\002U\027"
+	.string	"f+\234K\300\222U:\320\244\374B\350"
+	.string	" \273\320\375\377=u!V\304\260"
+	.string	"\252\333$\256i\372\226-'\241\214\002\220\220\035\033\276Y\266\357\270\357\025\236\260zf\301H\270\230\201\b\337\336\201wz\300j\032\004\361\216\256g\330\222A6\221;\311\202"
+	.string	"\177"
+	.string	"\210"
+	.string	"\347-Jy\0233\255\t\300\2728F\237\020\016^\231\177\342(z/\326\230=\246\235\035\031\220\367\246)\274\340\274\345\364'\346\355y\023\363\226{\314?\236\022\357\215\030vX\020\271\367\242\335\201W\311d2\3712=\227\265w[v\355\361\253\007 \277\240\315m9\222\303\363A\025\314)W\226\2201~|\005\006}\265\024!|\377\370r\0041\371\013\n_G\016\334{\271\376\202\027\316\346\231Y\307\314@\314\225E\314\251\257~\205\270\204\344\026b\266\225KX\253\033\235U$G:\247^\364\237\236\376\246\027\377\363E\351\331\276x.m\345\266\225\253\255|\223\023\022\303\237\240\237VJ/O\262\310\325ac\200\270\321\217\304w\361$f\024\313\274\005[\241\220\341\211{/J\206\031u\373\037\375\310($\036\212\351^\033@0jF\274\323\246\007"
+	.string	"0\b\by\357%p\3130\314u\305\215\275\027\321\274\347<\362ix\020\305&i.\353\331e\0039E\230\302\330\003\247.\225\367\336[2\215i6\253\177\274\200 3|JF\303\222\346\277\320\361\370D\367\361\013r\326n~\322\204\234\371_I?\351uC\005%\024<%\2208m\303\265St\206\252Vum;$\325\251~7\r\235\021>\025\267\275\352\323\020\020\030\245\252\317\343&^6I7\030\312\241C\302W\223\314\177A\201\267\"\022\361k\314\333T\257\f\325"
+	.ascii	"\372\334\324d\037\325\310\tvs\b\034\243\022\243{\321b\021v3X"
+	.ascii	"\255\205\252\f\250\265f\257\030\316\254\265`^4\231\231{\271h"
+	.ascii	"\273\332I\227k\271\2250\234\353V2L\245\200\001\t/0/\332\313\314"
+	.ascii	"\354F\203\275\320p/4W\263\311t\260\332\016A\214\356\3452\023"
+	.ascii	"\233\335h6\0264\006\303\355l.T\201\253\005u\265\\.,hM\366\242"
+	.ascii	"\241\020d3\026\266\335b8Tg\263\341PTz\363\026\342\0047t\334\264"
+	.ascii	"\3176\007\376\361g\021\032\026\232uj\223\201\f\034\2752\265m"
+	.ascii	"\340\2177\021\311\b5 \220\002\221J\333\006\030\004\203%\003\250"
+	.ascii	"\037Q\034X=\362\274-|\256\377\030\304\323\213Z\203\335R\343'"
+	.ascii	"\325m\341\352\222Y\032\204\262&\0348H\002\017\307\027\016r\024"
+	.ascii	"{\336\034\312\264\356\212\005\\\316\276\372\252{\327[\232\331"
+	.ascii	"\326OY\305\256\"*\214-$\024\2619\362\rGP\244\260\030\356\303"
+	.ascii	"O2Z\351\"\336y7`+C\273`'reJ\232\003|\304$\254'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 E\r\002"
+	.string	"T\003A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\317"
+	.string	"\177\003\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\001\320"
+	.string	"\177\004\377\037"
+	.string	""
+	.string	"\200\200\200\003"
+	.string	"\001\221\205\327\307\003\001\204\006"
+	.string	"\003"
+	.ascii	"?C\201\272l\031 \003"
+	.text
+	.section	.gnu.lto_.refs.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8f51c5bff91b11c7,"e",@progbits
+	.string	"(\265/\375`\317\004\215#"
+	.string	"\nC\354\016I\220\034U:\274lMA\201"
+	.string	"o\305Y\003l\243\r\353\r[\\q\3516q\342\333\362\006\236^\177\364i`d1Q\323bJ\024\f5\340\335\033"
+	.string	"\246\253\021\365\267\025p\264R\226|\333\227e\251\006\210\222\2040\215\214\f\262S\306"
+	.string	"\321"
+	.string	"\346"
+	.ascii	"\305\3566w\263\273\333\356n\031\221q\267\r\230;T,v\037\017\024"
+	.ascii	"\033\331:\005u\237\3143M\257\273\024\202gNH\313\241V\021\267"
+	.ascii	"y\250\313$\215\351\262\205\322-\272;S\245Co\2146'\232\227\371"
+	.ascii	"(\027\3112\222\213\030\367\262;\336qMQ\341`\236\350C\244\317"
+	.ascii	"2\326N\226\261\376l\364g&\271IV\352\270-\340fv\307\261\001A\234"
+	.ascii	"\3001:\321?\027\235)?y\2163\224\243J\270\035\352n\230\213\314"
+	.ascii	"\224!hNtA.\300B;\244\317N~K\366\204\237\351\343\\\200\225f\002"
+	.ascii	"\254\377Sc\376w\370/\306\365g\034\377\237\376/\375\207\362\037"
+	.ascii	"\351\277\362\377\352?\227\377gUUU\325\377\r\177\246"
+	.string	"\360\243=\001\350\337\344(,\251\027s\342\234\350sP\372\363g\265\320\330\3350Vq\033\207\257\347U\316\262_@\326\311\f\376\243\255\363\0357\335/\210\334\244G\230\2047N\364\377\202V\322\335\306:n\243\273L\266\356\021\2307\026\367\016\003\275\344\321n\234|Q\270=;\356\334\304\344{\302\215a\243\033\303-\254\211p\333\035\2770\227)l\263\273L\276\356\022~cM\354\266\227\302\035)\021~\335(\370\205\271K\341\353\022\223o\314\005\221\220\224K\225D\346\327%\266\213\"Rh\2045\335\030\3562\335\231\031\324F\006\335H\330XFX#7\r\233.\206JB8\307\335\215\2408\024\202\233\330t\211\340n\242a\256\213\022\332\270\331?r\263\345\201\354\026A\335\t:\356\016\303\356\034rXTES\216p\372h\224\375Y\352YL\016\263sl:99\321\f&\037\315(\336(\222f/\271\231\213\362\227\267\200"
+	.ascii	"=\232\230\302\023\r\266\216\205\225\273d%\372\244\212pE6\322"
+	.ascii	"Q\243T$\t\027\244"
+	.string	"\221\222\305\211\376\024J\177\322H\233\236\2634\345\247s\315\253[e\277h\035\351`B\302i\027)[\001\201*\232\241\345\371\211)G9\363\305\312\2312\222\245%I'\232\257<c\371]-2c\270(\245\322\\\345\331\312\357Z\335\210\201\206hK\372g'\037QRm\254\244\317T\322gf\226\362\234\364\347\244\274t\266\210V\2014Lj`dj\005\0338}<\312^PTd\220\241\362\274\364C\230p5\257\356&\335\255 e\266aR:\321\254\024`N\024\247\250\023\315S\262\321KH\025\220 g? kc\001\340V\335n\325\325~)l(v6\001\257\347x~\273\235\355\246\376X\335\b\025\270\226p\020\004\256\272\235\003\t\264\032\255'\250S}?\240\252\242\350\371rlom\001\331p;\224\375\255\275\333\n\210\365\235\370\255\236\343\311\2616\036\216\004pw[5\250<\262\367L\340|*\333\353\371\324"
+	.string	"\261\337t>\334\212+\221^\002\315\001\255'\330z\217\317\003\237\007\254\367\370\314f>\264Yz\332Lg\325\001S\266\006!\002k\353\355\200\\\237\315,,"
+	.string	"\321!Cz\343\201\020\001\250V\302\306\253\005w&x\267\032\317gS\177kO\307\336V \206\034k\343\020\304\355L\360z\026T\334\315\007\354\375\250\036~.\250?\032~8XPW\235\215\247\216\320\355*<>\335\230!\362c\352\t\200\224*6iN\024\3529\n*\213\371\007awI\250a %P\016)\2011\306\310\214\214\f\215\241\003P\0021\250\354z\021"
+	.ascii	"\3061\222\202ja\f\336\217\211!\205\t/\207\024\257\356\223\344"
+	.ascii	"\365tE\214\245\263q\365e\274\306\2455\031\237\271{\376`\177\373"
+	.ascii	"uxW\351\372\037\313\032q\322-\231\232!\341\260\372\221\203\037"
+	.ascii	"\f\020\274\243\373\254f\206\260\336`L{\025pU\3003-\220`\033&"
+	.ascii	"\325\204\323\360C=\225$\317\230\345\367J\\0\032\257\267\346i"
+	.ascii	"\255U\263\262ap\351\r\336\017s\246dV\205*?\3077\004\244.)j\n"
+	.ascii	"\016<\n\331\302\323\230\f:|\262^!\201\206\253\374F'[c\006*"
+	.text
+	.section	.gnu.lto_.symtab.8f51c5bff91b11c7,"e",@progbits
+	.string	"arm_cmplx_mag_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8f51c5bff91b11c7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
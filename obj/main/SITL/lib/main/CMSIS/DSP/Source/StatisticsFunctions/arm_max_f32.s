@@ -0,0 +1,178 @@
+	.file	"arm_max_f32.c"
+	.section	.gnu.lto_.profile.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 %\305"
+	.string	""
+	.string	"\200\031"
+	.string	"\001"
+	.string	"\237\310\316\204\b\b\002"
+	.string	"\001\002\001"
+	.string	"\002"
+	.ascii	"9\2036\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 !\205"
+	.string	""
+	.string	"@\025"
+	.string	"\001"
+	.string	"\004"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\240\223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 z\235\002"
+	.string	"\262\204\017\033\2405\351\377\347 "
+	.string	"\251\373\267\266\301\021\300\225kVUU\035K!=\232\2242\005\177\332\tM4\211\035\\\220s\032\255\252B\1774\3400\315 \374\345\366\235\334\334\275\b\027\200\362\244\337I\007"
+	.ascii	"/Y\017U\360\013\351\226+t\261\027\330\265\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 \"\365"
+	.string	""
+	.string	"\300\026"
+	.string	"\001"
+	.string	"\004\001\001\001\001\377\001\177\002"
+	.string	"\177\002\003\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 B\255\001"
+	.string	"d\0026"
+	.string	"\001"
+	.string	"\004\024"
+	.string	"\270\006\270\006"
+	.string	""
+	.string	""
+	.string	"\001\002\002\001"
+	.string	""
+	.string	"\002"
+	.string	"\001  \002\003"
+	.string	"\001\003\001"
+	.string	""
+	.string	"  "
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\273(0\003n\031b\027\352\006\332"
+	.text
+	.section	.gnu.lto_.lto.1b5874f361f60d96,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_arm_max_f32.79.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375`\234\003\255\032"
+	.string	"6q\260J\260\226Q:$\36282\f\347\275\315\215\315\340\031\234\316\221\247\377[p#\353)8\004\232\243\341\007\"\320G\\\227\003\036\224\355\332_\3564\227\201xC\263\273\003)\205P.\245 q\334\201\266mH9\366\007k\204\220\275\345N2\230"
+	.string	"\226"
+	.string	"\233"
+	.string	";Mcz\310\"b8P\340\207\364\376\304\333\241"
+	.ascii	"$\f\017y\253SO\231\337\364 \275;\r5\211\035'0W\367\002\021\360"
+	.ascii	"\005\362\226\201\307\021o\311\333\210\267\334c\3362\340\310\225"
+	.ascii	"5\302\b\326\275\267\354\031\\3\034\016\207\257\300\263H{\037"
+	.ascii	"E[\233\366\370\224\311K\322\217\350c\035\217L\340x\375F\324\007"
+	.ascii	"YWS\027\236\236?#*\312\354Hq\253\364\372\372\035U\235{\357\314"
+	.ascii	"\317G\373\302W\0366\252\222~)NG\t\367^\246I?\024g\362\314\214"
+	.ascii	"\202\231}\314-\024Et\310\027\362V\3134\204\032VH>\214\350\220"
+	.ascii	"\031HD{\211\371\017hd]q\313`\316\301y\360|c\363#?\200\027\371"
+	.ascii	"k^\177\372i\\2w\372[\344x\250\263\370\250\263\255}\2473\275\324"
+	.ascii	"\371\002\336cH\027*\303\266\002^\023\3030w\212\235\312q\250?"
+	.ascii	"\352\227\372\203\257\314\177\222+\371\222\013y&\270{\342\202"
+	.string	"\311\220\324\216$:\221s\032)qu\357\r\212\342\351\264\356\215\321\202I\216\031\212\247\343\003\336\337\006\032XMX\367\002\017\3342\215\271\217\0045\211}\326\240\224\2609}\341\311+T[\350\253m\237\\m7\001\252 uu\355\363:\234H\2616\rD\025\2442M\373<O\264m@\351\006\021,>\232U\357\275W\354%\276\360-\030U\301\2123\266\330g\325\217z\323\\\273v\367\311\374\251\333\316i\007LH\220^X\3334\215\323<7\254\220t\274J\226'\250\332K|\323\265\007(U!\022\305G\263\204v57}-\264mz\203\r.\215\244\352\350\327\314\023i\372\325\rjxAz\361&\265\235\353\n\023\177H\274uu\204\223E\nj1\r@1\237\321\324\335\332\264M\020Q\353\021M\335\215\004\232\201\260Y\300\211fM\3673\313\200\033gB4\230\b\331\255\326\323\222\345`\270\312\262\004\013\030\204\360"
+	.string	"\024\363\361\340\223\213\225?\266\033\315\224\331t\025~d4\363\207f\306LX9\223\345t7X\311\003\243P\302,\3000L(m\264\230O\331C\253A\340\033n\226+\315\333-W\316"
+	.string	"\357[\006\26386)\326~\237\027\\L)j#&\233\377\244\003\357A\342m\363\260\362EE\363\233|\330\375\302\007\260\262BE\321X\255\3308*\034\224_@\034\003B\250\021"
+	.string	"\225\"\310!\242\210\t\005\023F\222\266\030\220\002\031\311\333\006\020hH\333d8+Ua\355\013\335'\220\244\254\340/\202\005\337\003+\232"
+	.ascii	"\210]\tz\033?\207\0322F\251\313\265`\372\3017\217\250&n\230\266"
+	.ascii	"\231$F\370u\250t\253Z\231\224\326%\341O\n\245K[\274R\t\203\270"
+	.ascii	"\226\372\301\232^\201\302\230\343\353\2028+GA\341Cw\234\024\267"
+	.ascii	"\325\216P2f \212\316\213\371\003\f\224I\203\272\346\242\032\354"
+	.ascii	"\027\202\262\272=\214\311\3674"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\317"
+	.string	"\177\004\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1b5874f361f60d96,"e",@progbits
+	.string	"(\265/\375`\326\002u\030"
+	.string	"\246p\253I\240XU:\200\035&\356\230^_\222\003\336P\276\210\2309t\266_\b\375\210\337\245\305\346\027\354\017@T\346\003PS\245\t\b6\025\320Z\376}\217\207;\201]\206\220\343wLw\177:\361v\320\003=7\200\316\f\n\261D\246\214"
+	.string	"\223"
+	.string	"\221"
+	.string	"D\367\371\277V\310\337\271\242J\360\210\004\2624L!\216\233\356\217\355\301Z\243\224\256>\375+L\312\211\225\027Aq4\007\322\313B\301,\013eo\221\275:v\307\002O\246\017\372\340_W\003j\360`*\022G{{8i}x\353\022y\004\242\345\357\277*\365\004\311F\024q\214\331\002\250\361\002\351\345\341\005\300G\260H\272n\001\024\271\004P\300\r\262-\264md\233\310\366\221m\240m\027\333Il\213MMMM\266'\330\366a\213H\001k\246\276\323L\321su\335\313\247\270 R\207\236\246\022\364T\231)\3564u\276s\265c\022J2\247"
+	.string	"]l\220\251\373\317\256\207\343\251\206fE\257\364o\260\347<\006\177\017\345)\341X\25407\374\311\t\301\241[\377#\330\345\204\320\353\206\346\020\372\017\345p\276\203P\326\341g\354\260\214\321\273O\317\237\340\365\337\375\345~\370\277\374\377\302\353\325\277\205\312\374\355v?\320\201\335{e\221\236_\fB\021\236f*\204\272\212\030\245\277\243\250\345\376\256\344\343\221i\031\021\274\024\340\337\361_\201\313nH\247C\034\227\310\t)K=\342\270C\366\350$\003\t\225%\342\270B\266\bEE\313\226&\342h,\033\264\235\362\320\204F\026q\364\t\322\242\215:\216\367_\205K=/\027"
+	.string	"e\257\327e\227e\013\330\3232\260=\376\004\223\343\377a\272B\336H\302\271\020G\3331\267\355\315\361\227\253\327\363\314\324W\232?\230\234\253\372 \003Oc\334\254\276sDK\361\365{\235\357,aV\224gV\264T]\207\226\177=Uf\020W\006\306\221\301\271\311B\360\344\304h\030Z2,\327H\310l\255[\255fk\001"
+	.string	"\340\330\314&\243\311F\220\206@\323\200\246\306\304\213kl\034\3308@\271\306\306\345\262\241q\221\246q\235h3\036\362v3\363\340\006\253\345\210H\331\345\242\020\323A\303\0052&3\363@\304\215\t\230\316\215\216\r\326\332\241\325f\267\030\215\307\302Nlv\333\231\335`\267WK\026\263\361\324^\255\r\257\n\255\027\206W\006\n-\332\f\246\323\0021\313\221`/\220\r\342E\262\027i\205\342?\034\205Qn\210\004#G\202\340`:\020\020K"
+	.ascii	"\026\030JpI^\241=\023% @\002\243X!=\207f\206\346\251Z\232\021"
+	.ascii	"\217\341\342}bc\3725\f\022;\346\023l.\267}~\337\334\036m\360"
+	.ascii	"\336\342\022\227cR$8\245\272i\345\326\203\333\004^\263\244\315"
+	.ascii	"-\267\235\006\366\264Yw-!\344\313a/\232\2301\250\032\221<\260"
+	.ascii	"_A\233\036\037,\375\276\025\344\261\005\005"
+	.text
+	.section	.gnu.lto_.symtab.1b5874f361f60d96,"e",@progbits
+	.string	"arm_max_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b5874f361f60d96,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,457 @@
+	.file	"arm_cfft_f32.c"
+	.section	.gnu.lto_.profile.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`L\001=\003"
+	.string	"t\003@\002"
+	.string	"\003"
+	.string	"\351\241\231\272\nN\002"
+	.string	"\002\001\002\002\002\001\002\003\004\003\004\003\002\002\001\001\324\224\225\232\016\262\001\004\351\251\272\242\r\024\002"
+	.string	"\002\005\002\002\005\002\006\002\005"
+	.string	"\023"
+	.string	" \0037\217Q \n\356\004\373+\200\031\034F\214@ \202vF"
+	.ascii	"\020\200\354\n\320`N&u\320\031\310\004\364\003\031\303\271i\013"
+	.ascii	"\340\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\255\002"
+	.string	"d\002\371"
+	.string	"\003"
+	.string	"\002\002\002\007\002"
+	.string	""
+	.string	"\002\001\002\004\002\002\b\b\001"
+	.string	""
+	.string	"\004\001\004\001\004\001\201\001\t\001\003\001\002\001\200"
+	.string	"\023"
+	.string	".\006"
+	.ascii	"19\343aGw%`\216\b\300\017&2vA\031<\250\361`B\017\b\2609\233:"
+	.ascii	"\340\314\263B\356Q\204\007\025\330\006\260"
+	.text
+	.section	.gnu.lto_.inline.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`B\002M\f"
+	.string	"\266\323?6PMS\350\b\253\323\370\306e\374\t"
+	.string	"8\234T\211\334\t\355\351\376\357\336G\252\326\256*\224\354\"\022\255~\226\230\232d\227W`\004l\t\232\2215#kvo\271S-"
+	.string	"4"
+	.string	"0"
+	.string	"S\347\030\257je&\344\342=\320\314L\273\227\352Ef>>\323\017\235k\302\"<\236n\254\325\354Q\373\276L32\256\211G\374}\004\002\321\207i\207\r\f.\214\341>_\272$Q\207"
+	.ascii	"@\210\314\224T\320k*\001\302Uq\036\"\221\232\341\247\251\205"
+	.ascii	"\316UQ\007\333\005(\360\2474\3762\332\321\021\024\265\024\303"
+	.ascii	"\202B\205n\231W\317S^\235\225\231\003\356\224/\310L\316O\016"
+	.ascii	"\262\244\326\247\246\340\242\007k\371\205t\221\tp@\335\374f\030"
+	.ascii	"\207\244\233\006\243\206\016\241x\350*\326S\032\367\004\277\343"
+	.ascii	"\224#u 0,2\340R~\245\264\224C\t\021\017\372\2239\205c\346\255"
+	.ascii	"X\0060\3015\340L \021`\f< p\002\241\263\261\r\020\306B8\017|"
+	.ascii	"N\371Q]\307\240\305\035\267\016\200B\310*{\305*_$\216(\025\320"
+	.ascii	"\203\321]\360&\363\202\260\317x\273\022\244\203\370\215K\347"
+	.ascii	"&`\f\304\017\3141\244\331{\032\257W\030\217\221\025e\342}\021"
+	.ascii	"\353\020\01728\215h\263e1\207\221\230\221\021\323>\337)\240\022"
+	.ascii	"\370\355\025(\364\221\033\233\360@\201\362\245[-\002D\375\224"
+	.ascii	"S\320I\233[\017\345\016\226P\326\340A\017\346\n\232s\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`u\001\315\005"
+	.string	"\322\206\024\035\260%\351\f\243\034@@k\226\222$W\236\314a\224\003"
+	.string	"\013\315\002\200\bb%\221I\006\253v\203)0 B1\005\253`\025\026\200<\375\227M\2205An\367\361\210y\370c^=#_\302\3200\3330\374\224.\026\355\242\267SXs\201\347\312X\b, \220\"\251;\036\304\021.\020\200I\222U"
+	.ascii	"\3025r\016\271\027l{\227P\216\001\212\311w\006s\367\032\030H"
+	.ascii	"0\234\004L\b\201\301P\f0\262\220\270\f,b\324\307\212\201E\274"
+	.ascii	"\035p\316\213\325\005\305\215Ik\254\230\334\342\230\224\305~"
+	.ascii	"\030@5P\026\372`\327)\225\026\200_\201#$4\001c;\212\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375 \343\025\003"
+	.string	"\322D\016\027\260%\351\f\020\\\222d\226$I\022\230\251m\031&\255\021LH\222).\340\210\253\266\303C\300\253%\225$\"\3536\347\316\363\354\314\323, W\351\234\302[<\320\016\007\001\017"
+	.ascii	"\031\343@\3100\345X\200\362\254\t\263a\303\206\225q\021\204 "
+	.ascii	"\300\305pgAL\333\\\273[d\301\fd\003X"
+	.text
+	.section	.gnu.lto_.lto.e0af31dc8c14d0ba,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_arm_cfft_radix8by2_f32.79.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`\265\013E;"
+	.string	"\032k(\027CP^N:7\200\270\202B_ \230\263T\025\347\255\214R\3466~\270\271"
+	.string	"nX\264bI\027\207\312$\321\304u\330\375\221\212\021)\307\217/@\f\273\357\375\032\262\235ab\002=\267\272\030\352n-m)\003]\001Q\001i\001<`\275\214\264^\026\260^>Z/\033\255\227\213\326\313D\353\345"
+	.ascii	"\353\345\241\365\262\320z\031\300z9h\275\274\256\227\217\353"
+	.ascii	"e\343\361r\361x\231x\274\374\343\345k\274\334bH\200m\222\204"
+	.ascii	",;\244\n\210eS\004\244\322]\272\277t\347u\353u\363u\373u\377"
+	.ascii	"u\003v\217\351.\323m\246\033M\0171w{i\274\006\323{\335\327\324"
+	.ascii	"\016\323b\232L\007\366\231\026d!4Bt\2309SJ\333\373#+\203d\255"
+	.ascii	"-l\314\031\333\223!`\314\200e\315\266D\202\240\204o\205,;\375"
+	.ascii	"\372\023\204\341\027]KR\330\344c\322BO\312_V\236\231R\020\313"
+	.ascii	"\232\241\362\267\342\213\331\232F\204@\033a\264\220eY\253\346"
+	.ascii	"\322wh\335e\307\232Fd\305\303SR\310\262S\f]\344\252\265\213J"
+	.ascii	"\304;=3`\304\376\270\023B\325\227\271\265t\035Z\333\365\350#"
+	.ascii	"\226mR\347\217e\247K<\265v\221\247\235d\354\342\332H\306.2\032"
+	.ascii	"s\235\236Ba\033\017\272\346\205\017\313\262\310?a\251j\023\247"
+	.ascii	"\315\304\213\326E\342/\032\367\365\243\262\271\245u\221x\004"
+	.ascii	"2\004\216\310\r\b1\351\247\020\260\005\373B\335\236\227X\305"
+	.ascii	"H\277\005\373\002]\225\315\315H\337\343\007\226e\371\262\271"
+	.ascii	"\025i663\2131\363\016f\241\273\207\032$\\\373\354P\202n\320\244"
+	.ascii	"f\334S\210\3073\263\004B\243j=\210&5[\271\317\214]4\036+\013"
+	.ascii	"\025\032U\273\325\037/\020\210\333y\251=\374\303\225t\325\366"
+	.ascii	"\020\352RW\016\266s\305+\317|\247i\347\236k\232\370b\324\211"
+	.ascii	"\257\242[\263v\230\241=<\352Dt\324\366\360\351\325m\312\226\340"
+	.ascii	",_4\344\303b\367+\017\365\333\327\316\021\233\005\215\367\177"
+	.ascii	"\267r\317{\262+\325\265\303\276\207\267\236\265C\226\321j\300"
+	.ascii	"V\226e;p\247Ak\253\261N\351a\354b\277h\345K\037;\265[e\236\246"
+	.ascii	"\335;a\356$\024?\205\374&\314a4f\310\370\362\352\342z\261\325"
+	.ascii	"t\321\200\315Z-\262X`\255\350/\315V\235\327\234\242\365\232\253"
+	.ascii	"\232\257\031E\3735\237\350\277f\252)\021\037\244\230QK\250\236"
+	.ascii	"v+\033M\263\207\266\353Nv\227f\016\r\330\274\241\3074?u\231f"
+	.ascii	"\2476\323\334\324\323f\r\305\313\310\240\313L\353\345\245\365"
+	.ascii	"r\206\3652\206\365\362\205\365\262\205\365r\205\3652\205\365"
+	.ascii	"\362\204\365\262\204\365r\204\3652\204\365\362\203\365\262\203"
+	.ascii	"\365\262\322z\271\301z\231\301zy\301zY\301z9\301z\031\301z"
+	.string	"\371\300z\331\300z\271\300z\231\300z9i\275\001rlC.\336t\240Q\265\r\327\272\212\275\300v.\310\332\342\312=*4j!\353,n\341M\275j+\255p\254\257x\2057\365\366\264q\017\236\365\022\203\255\034\204\263x\tA\b\307z\t1\017\276\342I=j+G\301\352)N\341Y`\354\264q\023^u\024\237\360,0kZ)\202[\235\304]\202\247\370\210?'\236\340U\037a\330\312Q\035\301Q<\231g\247\225{\252\021O\\\231wY\264#]Ep\312\214]\244\2722\217\n\215\036=\351\022.\365\307\350\003\036\341R\206EG:\204K\315!\272\200?xs\013\241\203\244\037\335\301O\246\225\366\351\246O\235\271%Pi\300\215\256t\347\026j\003\244\027\275\301\235[\360\030\374\222\021p\2423\270\323\256\332J\237\013\316\234\323\306=\025\2349\330\306=\023\234)\330\306=\021\274i\027\330\306\0358w\234"
+	.ascii	"\017\372\201\337@F\215d\324p\021O\332\341\265s\006\316M8\364"
+	.ascii	"\365\006\336\254\253\0268\267\033\241\037_\340\315\272=\255\224"
+	.ascii	"\300\207\340\004b\303\243v\253\f\340\306\023x\263\316N+}F\223"
+	.ascii	"\036%\030\035\360(1Q\2443\353\250Q\001\327\252\303[r\364\245"
+	.ascii	"\341\022\243/\347,):S\013\341\022\242kiY\023'\300\227{o_\336"
+	.ascii	"\275\t\235\231\245\372\006\340XY\366\304\031\n\n&\272)\006\030"
+	.ascii	"\325\215\242\323\215k\346\274Vf\316\2230s^\203\330m\022\273N"
+	.ascii	"b\367I\354\206u\323\215{\325\334\305\344\364\364\265\345\374"
+	.ascii	"\372\352\332\022#\343B\346\2601\006\346\354\262Q&B\214l\354+"
+	.ascii	"\207\r.2\025H\257.\262\262\261+d\325U\b\344\025\211+*\020H\033"
+	.ascii	"`\\bH\030`aK\036\273\341E\206t\216\215\221!\205\246l\277\311"
+	.ascii	"\225\0306j\177\026i\344\231\016u\215\224]8K(\310\023\363$\261"
+	.ascii	"\273\267\231\214qy\246+\317\274\305u\233\215\225\326\236\306"
+	.ascii	"Qg:\200\276=k\207\305;\341\243\237\207\335\251\347\360~8\207"
+	.ascii	"C;\n\022\270k\275\265\030\266\335\3457\034\212#\t\334\273\336"
+	.ascii	"M\356\034^\250?\035\332C\t\334i<L\217\337"
+	.string	"\225\272\323\241<\252p\237z\230\036\273\313|\323\241-\330ka\240\266\2138\023\257\362\032\016\345~s'\347\307\365\323D\226eYbQ\265Z\255\366\016#\207\207\335\007]\265\225.}\306e|\311\3514\316\354\313\360u\257gx\263\217\332\306E\370\214\233\370\323\312I\270\214\2330\224\360\257\233\230\023\341^O\362\021\266r\030\336\270\376\342\030~\335\264qO\357z\222\357\302\326\233\277\360,>j+Up\256O\375Y\360\027\2372t\361\005\337\372\324\234V\256\305\025\274\371\344\036a\033\200\343\250aDe\020b\b\221\220\210$)H2\214\001\300\002\221\251\342\346\020HeD\232$\303\030oH\225\241\373\264{\357\002\n\"hBe\003\002:e\361\"\302\273S$\3312\215K\024\204'\210\331\237n\257J\366\2207\225\003LP\235s\231\377\022!\316,\246DC\347\205D\034*\f\375\206\303\272j\3417\f\205%S"
+	.string	"\264\027\336!\313 H\372\003\241\242Z|\033\314\212\027(\025\241"
+	.string	"\262\344m\216k\200\313d,ftf\320\373_\254\316\225\020\334,r\256a\267\nj{\321\035B\211\220\363\032\023\340\037r\025\203\3340YF\177\243\017\035c\256\036\247\360\363\267\301\332 f\311\237\220<t@\365d\006\360\020\247\230Vx\337{\022%Vn\004\360)\016\250\034\320C*4]6\332\265Y\007\331\004\360<\220\247\022R\b\345\371\3039\341=q\376GqAJ\227\265!\007{\301\221\307\352x&\256\221\003\3673\013\374<2\336[\006\240\t\310\035\362v\033\205\354'b\311\257\241\237\2538\237\373qL_Mz\275qY9\013\016\262\3633n\307\242\220b\2657\320\222\026\220\274\031\202\302\017\b\200 \034\213\364\261\346)\r\355\227\b\216\b\n\002\rp\201`\"\301Q\231\257\261,\261.X+\347d\354vv\002\350H\f\221k\001:\001\310JL\355"
+	.ascii	"8\300\020P\363\354\0029\302Z\204~Rh}\340\315\310\341h\213[\347"
+	.ascii	"\303\324y\302p\300\376\257\247\327\020\016U\346\323\257\222N"
+	.ascii	"\027T"
+	.text
+	.section	.gnu.lto_arm_cfft_radix8by4_f32.80.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`\325\035\r~"
+	.ascii	"\252\322t,J \224\312I\007\207\322yP\3637l\006/7:\023:\340\006"
+	.ascii	"e\001\230\f\022\003\337m\226]\357\325\256\nmP\366a\r\305\037"
+	.ascii	"\005W\370\253\377\255\271\337X\267v\255\001^K\310\3258\324\245"
+	.ascii	"\213'\351\363\324"
+	.string	"\203\270a:\266%\231d\222\002\251\002\306\002\2324W{\230\253F\346j\221\271\312\303\\\335a\256\3520W\221\346j\016s\365h\256\3420Wo\230\2536\314\325\032\346*\221\271j4Wi\230\2533\314U\031\346j\fs\025\206\271\372\302\\ua\256\2660WY\230\253+\314U\025\346\352\220\271*d\256\2460WQ\230\253'\314U\023\346j\ts\225\204\271\032d\256\2160WE\230\253!\314U s\025\204\271Z4W?\230\253?\346\252\007s\325\307\\\3551W\211\346\352\320\\\025\232\253As\265\203\271\312\301\\\335`\256j0W3\230\253\030\314\325\013\346\252\0055V+\230\253\024\314\325\t\346\252\004s5\202\271\n\301\\\3451W\037\230\253\016\314\325\006\346*\003su\201\271\252\300\\M`\256\356\230\253\b\314U\035s\365\200\271\232c\256\0320W\013\230\253\004\314U\034s\365\306\\\035\300u\254\002\314\325"
+	.string	"\346*"
+	.ascii	"\266c\265\3413k\r\243Y\247\307\260\002\231\f3V\036\320\352\016"
+	.ascii	"h\365?\253\373\263\352m\342\310\226\0301\250\221d\225c\032$\032"
+	.ascii	"\017\216\025Fc\253\261\277\260\331\330n\3547\266\230\r\307\216"
+	.ascii	"c\317\261\351\330ul;\366\231\215f\217a\223a\343\261\327l6\273"
+	.ascii	"\315.Z\207\252\235\306_^\3436\006s\230\301\360\230\345\230\314"
+	.ascii	"a\270\314f&Z\f\247\371\216\325\234\307z\354\3467\005\240\350"
+	.ascii	"\006\207E[\0361*\330\242\346\304\274\254]9\201'\n\0079\006\351"
+	.ascii	",<`\212pY\310\250B,\2111\236xP\215\021\263\202\366\264\265\346"
+	.ascii	"\r\256\312\231\034\025;Q;R\t\034d\2245s\303\253:Q&\313\254\032"
+	.ascii	"?0}\\\322q#V5\007\214\321\2108D\300\331bIlM\2227X\326\244\001"
+	.ascii	"W\304\315\026\035\330L!v\364\005\024\217\032$I\307\n1\033\324"
+	.ascii	"@M\252,\035Xy\350\340H\2224\362\031{M\031M\021\223*k~\255\251"
+	.ascii	"\203#I3\032\230\2473L\363x\354\326L\324\016\034d\024\257#`\360"
+	.ascii	"\252z\214\311L\271\214\224\t I.E1\2224\303\201\2720\315S3>\340"
+	.ascii	"\307\274i\003~\314\323)\325\242\315|!\275F\317\2244r$I\006\335"
+	.ascii	"\213\002\035\217\307\243wf\254\273\2352o\367\235RK@%\354\247"
+	.ascii	"Ee\336\016HJ\225*\006\320\222\262+\352\003\007\307o^\240\226"
+	.ascii	"owW\\\361\375\346\f\316\310"
+	.string	"~ZW\274@%\220$\251\373\323\332\262\376XU\233\250j\227j\003O\004Hgo\377\027\231\024\255\353\006\256\340\356\342\276S\326\035\217\307:\027\361\343(^\301\215\316\310J\341\016.^\304\013\307\026\347\3018\335\345\326\342Dfq\017\234\311\342Bfj\r\234!.\200\206\353Bfd\t\2401\013\373\355A\340V\\\310\354\253\3542@\315\017;\307\337\036\n\2566Np\tNA\230;M\331e\234\300`\036\301%\020\032#x\317\216\0320\b\301w\315\354\267\207\307u\034\002\241\275<\307y\034\311\016\261\024:\360\007\206\226\3429\356\300\221\354\204\225B\006^\300\033\0202p$;_\345\320\247\300\027\300\241\300\221\312\342v<\201\177\307\221\312\336t\374\200# \224\323\221\343\200\241\\\216\367\312\210\005\234\200\033\360\273\225\3033\005|\367\3458N\300W\r\216\367\312\310\200\301*)\216d\274\361\001n0\306\033\306\335"
+	.string	"7\252\023\007\fV}9\222\236r\030\300\001\270\275\334n\245\320\207&\200\037\f\030\254\262\234\324\027PS\035\365c\036"
+	.ascii	"7\252\243\006\fF\361\001\302 \0361\032O\026|q\227\363\344\270"
+	.ascii	"\231+Se.?2\no(~\304\347\211\037\351\201b\003~\234\370\017:j\026"
+	.ascii	"^\20613q\031\332\334Yn-_\260\262\313\267G\335Y\313~\376\335]"
+	.ascii	"r\371\376^\330\327\336\301\373\214)u\033\330\337\377NY\347S$"
+	.ascii	"\336\003\304$I\362\207\272\f)7Jf\030\251\037\363|^\027\032se"
+	.ascii	"\252\366\250j\206j\337E\325E_\372\300\351\271\250\356\226e\""
+	.ascii	"Kp\t%\026\313\025+[Z\233\265U\026k\251\374\256\254\246\254\224"
+	.ascii	"\365m\325R-y\254\2433\316\311\305\241a\306\2362\340\336\212n"
+	.ascii	"mlkjx\356\244\211\201F<#\233#'\316\030\234\2607`n\332\260\261"
+	.ascii	"\032\253\277\374\205\325j\314\306n\254F\3439V{\231\216\325g\274"
+	.ascii	"(Cf\214\230.\270\330B\213,\270\254\b\3437VKa1\253\301\030\216"
+	.ascii	"\325_\034\307j/Qt\341\002\305\023N4\261E\310\204\026\233\261"
+	.ascii	"\235\305E\253\203.c{\t\243\261\032\213\221\360\025[\361\226\265"
+	.ascii	"\234e<VW\361\232\325Xf\263\372\b\267YM\305\300\337\025o\325V"
+	.ascii	"6V=\245\224\022\3057w\325Ts\325\344\\\235\232\253F\314U\251\271"
+	.ascii	"\ne\256F\315\325's\265\210\271\352d\256B\315U\"\346\352\323\\"
+	.ascii	"u\232\253M\346jo\2562\231\253Ms\225i\256.\315U\245\271\272d\256"
+	.ascii	"\0161W\205\230\253J\346j\020s\025\210\271\232d\256\"\231\253"
+	.ascii	"?\314\325#s\325\207\271\001\217*\243\341\273\304\243\306\210"
+	.ascii	"|\225x\2211\254\344\372\341\312\017H|\261\274\250\317[\331u$"
+	.ascii	"\316\326\221\037\365Q+\205U\256\374\311\030\226\225?i\363\335"
+	.ascii	"\372\023\257\305z\321W\353Es\307#\354\255o\326\201\314\275\325"
+	.ascii	"\331*\0072\247Vg\261\016d\216\b\f\372p]-W>\f\261\276T\036d\356"
+	.ascii	"\253\354J\372Z%\275\210\334\261\034\316\360\375\335\211\236\253"
+	.ascii	";I\213\341ku'e=|\247\334wJ./>\344=\354\306\310\221\331\013#>"
+	.ascii	"#W\276R^\364\026Wv\025\371R\025\371\321\333[)\254\363\235\251"
+	.ascii	"\214\256\352Lu\377\361\245:S\233\222\313Gw\037_\362Eo_\326\272"
+	.ascii	"\217\007R\214+\273|a\352\016\244h'\351\200/\007RT\343a\216\207"
+	.ascii	"/])\364b\037q\033\037\244\030Vv\355p\307\355\360\"\305\257r\330"
+	.ascii	"6w%>%\227\334\225\364\254p\307])\355\205\033\215\027\271\021"
+	.ascii	"K.\035\366\350\360\275S\016\255\334f\274\250\355Xv!\3211\034"
+	.ascii	"\322\217\332\342Jaq\317\227\244\265\225\361%e\305\023\335p_2"
+	.ascii	"Vr\371\332\336\301\375\366\242\266\260\222+\314\256x\273\001"
+	.ascii	"\203Y\267\333o\320C,\273\244\220:K\272\261\366\324v z\310r\270"
+	.ascii	"\256\226\243\343\360\034\316KS\n\235P\271\331n\272\262\353\350"
+	.ascii	"<:`\260\352\316o8\016\302\033n,lq\300\240\r\307\263r~{j\370\220"
+	.ascii	"\333\360\035])T\273\220\327p'lo\245\260\211\033\235H\016\272"
+	.ascii	"R\210\302S\270\233\270\256\0137:\021l\304r\350\333r\025N\303"
+	.ascii	"\375f^\220\215\254\024\232\360\023\356-\327-\2072|\206\357\356"
+	.ascii	"\b\221\341=\266/\030\036\003\f\357\3459\226C\027\336\302_\370"
+	.ascii	"\017\232\013\007J\303B\013\337\261po\221\347\315x\256\302W\370"
+	.ascii	"\316\255\024\016\271\220\253\360\313)\207hC\276\003#C\310w\310"
+	.ascii	"\263v%c)\034\205[m\214\024\2763C\341My\302\200\301*<W\342U\016"
+	.ascii	"O\270\t\367\235\357\030'|wg\265H\341\201b\302\233\326\216\300"
+	.ascii	"`\tt$<\310K\370\016\fx\247u\031I0\332"
+	.string	"Gx\020\241q\204?YS\003\006Ex"
+	.ascii	"t\277=!|\350\"\b}\366\240\207\360\336\032\261"
+	.string	"\024\202p C\213\361\240\203\360\336ZX)\374\340\034\274H\370\301{k\036\374\207\006\036\274G\214\353q\037=\336#\276\225\303\241\013\235H(7\024$\364\203\321\t\372\023\"\007\337\340\035|\007\026\207\203\357\334\210\327\340\033\374`t4\370\023\242\0307\342\225\3011\270\321\214\031\03018\322\331\021\030\254\"\276\b\237\013n\301}\366\005\233s\301\357\266\0065-x/x\210\250\207\217\037\226\2044\361\210\240\234\336\003\312\351>\240\234N\324\264=\232\326G\323\032A9\235\005(\247\013\t%\r5\001\r\031\351\321\324d\250\tHHi\207\224\226Hi{(\355\022\0175-\021\353\221\016\210z$1\342\224$\311\021#J\275\244\240&KLJ\234\216,=\rQ\3521%i\262\224\324\253!\b\311\221\336\023\023\221\240\031\210\244\020D\204\005\"0\240\020\264\244$I)\310\007%KDP\246&$\275 '&\246^\020"
+	.ascii	"fH\237\213\352\316H\\\200+\267a\3455\266>\265\016\344\254\377"
+	.ascii	"\034\250\273\235\201\347\3154+hU\367\375\204h\277\357 \343\212"
+	.ascii	"\t\263\253\357 .\035\333J\313\326y\3325\021x\266\372\216\263"
+	.ascii	"%\312\354\316*\347\307]\234\345\252<\030Y\377\224\307\224S\251"
+	.ascii	"\243\270\247\374\300\261)u%\231K)\227c)\267\341\373\305\225\302"
+	.ascii	"1\262\377\227\006g\316\377+\033\373\223[\316\377\033\203s'w\234"
+	.ascii	"\377\370~ac\307%8\377\201\342*.J\230\243\250\225C\237\357`\366"
+	.ascii	"\335\206\357\212X\n\333\204\375Wm\330\274\371\257\274\332\234"
+	.ascii	"\210\033\354\2672\226\\>6w\272\335\374\307g\025Wr\371\302\264"
+	.ascii	"\221\242\211\315\177\240\260\"\002\203U_\256\242z\032S\335\206"
+	.ascii	"\317\352\253\024z}}\212\317\0315\237\322\343\365\336\235\346"
+	.ascii	"Sig\276t\243\271\320\221\330K\272a\257\023\035\303zI7\316\234"
+	.ascii	"\350\370E~\352F\334\244q\312d.u#\204F\251\367\352\336\240|\315"
+	.ascii	"\242\316\344P~\2673=\352Huj\245\260\210?)s\246\027q\244:2\250"
+	.ascii	"+\335\311\020PG\252\013+\207\276\247\0231\304\323\221\350\216"
+	.ascii	"M\356\304\324\344Htq\345\220\311\233\336\023\3121aj\032\3121"
+	.ascii	"\275G\247\246\364%_\372A\351;\2601\037\342K\276K\206x\217\256"
+	.ascii	"\314\245\274\204\270\222\233\214Q\b\243\222\033\2451\346P\370"
+	.ascii	"\004q n1\267\233\020A\374NP\023\210\033\245\361\006\f\362\336"
+	.ascii	"Ek\260!\023\305b9\220\311\031gIb\336\254\263\270\2218\220\t\261"
+	.ascii	"\230$\246\2125\327}\345@&a\324%\211\301Z[q[9\360\211\317\031"
+	.ascii	"\0222Xk.\356\255\003\237\314\212H\304\324\255\267\270\265\016"
+	.ascii	"4\025de\220\210)\256\265\270\263\016\224\212\253S\272\242n\315"
+	.ascii	"\345\256r\240\024\037\245+\212\213u\240\224\231P\351\212\263"
+	.ascii	"\365\023\367\021\007J\311)*]\361f\355\304M\345@&`\274\271\323"
+	.ascii	"\236\304\305\233\005\036\250\356\343\305\026e\373xG\222$\271"
+	.ascii	";b\371n\271\225H\222%\211\260\312\227\211\0071\036\313.$_\002"
+	.ascii	"\311\213\030\343\312!V\226G\245\225\\\301\202\265\250\342\200"
+	.ascii	")\206\222\214!T3\"\222$I\2061r\013\020\204\244q\330J\363\022"
+	.ascii	"\240\2655L%\032\221\2224s\204\021\306l\034g\357\030tU\027\024"
+	.ascii	"0\307q\352XWPa5\322\232K\371D[\255\025-Z\260\201HF\214\201\300"
+	.ascii	"\013\323:Q\230\226(&\344\243G+\237\006\305\231\300\026\324\204"
+	.ascii	"k9\247\355W\365/\035F\322T\026\271\317\232I\020\363\253\366\200"
+	.ascii	"@\362\325\212\331\335i\303\255;\025j\001\264\263\264\366Ir\304"
+	.ascii	"\242\261\332\031\f\247iO"
+	.string	"\036\026h\200[\006V\257\377\210\331\251\203Z\032\324@Jpm\263\033]\325\317f\030\245\034\025d\346\233\307\340\303\303]\371\311\376\304P\2165\036\225\246\004\276\321\363\035\240\232u4\301\240\fZ\357\226\222&r\221\333\314\375\017\221U')\032\377^\360\341*g9@\016\350\244\250\017\370i\257F}0CXm\302[\332\262\362\373.\3444\036Yj\327\240\203\307\214\020h\340b\232\357\234G\301\206\324\031\334\263\314\340L\250\273\324\244\313\376\361N\375\263\357\256)\334%[\376t\301EZJ\017<\007\016\332$\307\233\302\2410pZ+o\240\f\007\330\245\r\370\210\255>=\177s<\265o\214\321\210<\013\312\\\321\270\200\024\233s^\363q\301\2133\345\321\257\264d\321\213\305\310E\351%\245\314\030\266\230\022\363\007\031\356\254\264\005\327E\344\321\227\037\350\n\226\377b,C\335\262\206\3209G'\323\356ph\272\350\277"
+	.string	"S\243+\352\253\\\205\225ny\370Q\331\346\312\2706\035\017\366\242\016\330H\230\273\224q\020\303@n\r$M\321K\302\206w6\027}*\247?\372\364E\212%/c\315()\227\r*?\211\301\214\026\333\344\355{O\315\003\036'\302\305\254\025&FBb\203\006\222TK\312\341R?1uLA\256)\021\347\265]t\214\"y\032\277<k8\202J\302\305uM_^\311\327\177\266\256\005\006\206[&6\b s\254~\225q6\354\252H\030\223\273\255%\211X`\344\201\376JQ\034\235\273\2479\377@\224\225\030~\210\016\2036[b\275JC\274\202\217\0255\210\207\200\356\364\025Y]\241\023Z\324+\275\236\271kP\257\232\030\306h(\334\372\004\307\354"
+	.string	"\232C\236\007\262\271\205\3118\271W\234\353\f\210!\3418\013\272P\261\021\"%m(\234`\033\235x\300\341\373r\006v>\262s\366\310-J.\260#%\324\240X!\245/\204\306\262S\272U\241\323\367\246\356\301\022\274\357Jo\213\223l\207\254a\304&T\2069\353\373\225\211\217\200\313\nN\001\257\025\322Mc`fS\312\265\243F\332:8\314o\271\215<L)\324\326\227S$ \254\215\322\355w\270D\266\275"
+	.string	"\\\017\016V\210\r\rx\341K\212\306\022\324\036\233;&s\240\261\265\332\336\325%\303\257qi\031M\203\nP\2007~L\001\bB\266q\336\037\262-\\\251\013v;\220\217\335\350\276W\277\365\217\205\204w\006\"\305P E\353\275T\004\217IT\032\227\336\007\207mGXc\251$x\214\315+\211\304A\2345\366A\302\220\276\233\023j|\337\303\250\273\341\353|\207\272\241\352{\024\372g\313\025\311\b+\342\315$H^j\262h\226tH\216\"\023A\275cIF\2312b\372NO\266's\245\375a\315\200\252\035\002\355Vv\264\346\260\245,b\006`\024\020%S\230\3771\273w1\214*\021\366\2627t\373\374\210n"
+	.string	"\332\312\225\026/\345\235\001\363\020\337\320\301\372\223\237\247\275|\030w\177 }\201.\2700\"\353\356\220\251\021\b\370oIE?s+\333\3553\3131O\276\2511\330<v\360\270\360f{\354f\233\252++d8\265\330v\320\256\302\035\313\021\205Y'#\3332\374\322\352L\212y=\215\t\031u\265,i;\031\251\373L\360K\034\265\2566Ld\246%\312\224(\227D'\022U\343\021\305.\240h@b\"\250\261\364)\224\255\365\tDk\255r\303\354U\027HR\022\324\370\237t\022D\345\324\361\364\036CG\351\363r$\254nEN0\362"
+	.ascii	"\311L\253-\3306V,\024|\277\302\215\352X\275l\207\3705\361\220"
+	.ascii	"\273\005\227T\316\274\335\221\033\363\027\t"
+	.ascii	"\220\017\250\264m\364/\211\304\342\212\004\"\350\342\r\025G\232"
+	.ascii	"\270\257@FJ\rF\006\350\220|\020d(\313h%'^\025\355\\B\264"
+	.text
+	.section	.gnu.lto_arm_cfft_f32.81.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`\022\b\225,"
+	.string	"zL\024\021Hp\032R:S]`\276G\351\242i"
+	.string	"\021\230h\002]\032\313\256\0263\216\362,TQ\236\251bN\365n\255\225-"
+	.string	"\213\210\020\224\247\220r\245\031@\370\325\0168\357\236h\271S'\"\004\013\243\275\265\377\255\021B\b\331;\311\375"
+	.string	"\352"
+	.string	"\376"
+	.ascii	"AW\333E7q\"`\301\t\375:\221\336\356\b\023\236\316\304i\315"
+	.string	"2\3308\321\200\270\317\031E\371\314\037\3163\036~\273\257\344K\236.F\243(\277\212\210\323L\\\316O\007\315\241\275\332\317\357\254W\333\007X\257>uC\377\354\312\004\234pQN\336\344\234\2078\b\260\201\321h4\372\364\371V\361\323\203\300\237\257\307\333\351ZvUS|\237\372\tz\224-\231\307\007\261.\220\025\002R\225\365\037\024\247VU\326}o\243\352\362\001\243\352q{\254P\325\325y)P\\\0257o\243\272Jw\246\274\226\007\243\342qw^:\tBZV\b\355\251\221+\247V\225\325\331\035\327\242j\356\230Qk\320G\213\312*]S\266\306\224W\205\271\2704\250\253:u<]\267\246\242K\246\216\343\024\bk-\307\217\251Lw\302l\2359\332\257\0243y/+\224s\356\273dV\275u\336}bw7u\263A\0017\212q\231\226\032\314\264\007#\300\354\330\224\234\362H\262B\327\\\034n\247\365"
+	.string	"\306\307\2624coPw\256\217\r\340\267\211\232\323GOk\321\346\fE\241_eC\261\3159\237\b\215\365\352q\211f\23401\344\215v?\217\027su\377\\io_\215\177t\007\001=\312\373\347M~\005>B\004\177\376=g\362\037\370\224\267\201\213\375\005"
+	.ascii	"\234\354\255\023\274\331\033\330\336\376\265\267}\355\355^{\233"
+	.ascii	"\327\336\336\265\267u\351\355\226\275\315\356n\257\351mUw;mo"
+	.ascii	"\343\366\366eo\277A\317\315\r\346qDs\236\212\306\311ljZ\221\223"
+	.ascii	"\375Q~\263\177\312\323\356\277\354R~v\264\346MY\322\302\242\302"
+	.ascii	"d\266\364\\\225o\203\215\363\215\361O\016\345\351Q\232\204\272"
+	.ascii	"\234\325\262\250\344\234\221\332\253\302\364\001V\262\031\301"
+	.ascii	"\334\226\317T\342\204\023gncp[\376+g7\3406x\212U\334\203\273"
+	.ascii	"I\230\020Fa\025\377\354\304\327\244H\361\325\354\310\002G\f\031"
+	.ascii	"\346\013\310`\321\255\250\362\345\013\310$i\203\267\007\027\300"
+	.ascii	"\335DF\367\313\376\0232H\330j\340c\277\313\211_l\307+\207\301"
+	.ascii	"\021.D\3304\r\345\311\322\024\242Q\013\232i(\317Y\263}k(\017"
+	.ascii	"\026\265\324\255\241<h\315;\246\241<fj\317\377Y\333\372"
+	.string	"b\3729\004L\237M\330\343+\373X\353{ih\233\363\361X\301\377\370\310F\232_9g\006\347\322\307j\2732U~f\006\352\r1k\231\307\235\263b\256\336Q:\275R!\006*\263\240\030\001\326\301R\3542\365\301\030\016\267\224\001\f\304\367\032[\203\272sOs\316Y\375\322\n\304>\370\227\234\212*\261\236\344:X\210wcM-\030\377\312\\/K5\027c|\321(\325\034\213\212\246\376\214\365\352\305\274\261&\232\224\0252\035\376\342\035b$\025S#\343\020\214\364h\311x\024\343H\004S\261\350\327\202\350E\006&\"\261\330B\200q\207\336F\017\"H \262`\"\022\215X \031\211\206KIJE&\243\244\246\fHF%\342R\022\221q\304\360\310\310\330\24444\0041\204a8\244a\310\303\205aR\221\biXT|a\241\225`\034\031\207LJJ\306!\357\231\217\177t\353\346dC\342d\020s\265"
+	.string	"\262\260/? \fT\206\341\360\365`"
+	.ascii	"\277 \214\341|W{0\b\304\\Z\036\304A\370\227\274B\003\200\201"
+	.ascii	"\360n\353*\215\362\310\017\373\360\017\3436J\260\036\366EQ\244"
+	.ascii	"=\314\023s\345&e\305C\361\037\274\303<\260$\212\246\035f\267"
+	.ascii	"\256\300\374t\270\321\336\027*gd\202\037\3746J.I\254\303\274"
+	.ascii	"-\036r\3128\244\317\312\317\326\364\016\334\025\267\0328(\361"
+	.ascii	"\261Y\334z8\234\026,v\360&\366\341r!V|7;\274\204\211!)\\\221"
+	.ascii	"\363\301\353;\255\n0>\006\200\246\250q(g\230C\006\315\220\210"
+	.ascii	"\210&I\322\001\240\002\021\262\242<\0210A\211nH\222T\013\333"
+	.ascii	"\001\242L\247\005\004\333\276"
+	.string	"\344\212\246\363\217\331\207\373\223\223\317x\376\325\317\030\355\330\377\004\217\034\311_\345\256|\360k1\276\035[\217l)\305\260\273\215\235\261\355\245O\253x\007\250\246\243\210\304\335\312\034\253\241\231\013\373\247$<I\250B\327\304\213q\007\360\335A\274\005\007\006a\025& \217\207\321\337\336\304&\022\203\303\234<C\231\340\325\032\244\340\0342\375\373\260\004\002\300\367R\034Y\227\030u1\260\321\264\005\243\025\313Y>\334]\324\257\250+\345=;\007\335\003.\347\245\236ei?6.\327hb&]\366\212-143TCT0\240\305\363P@\266\357\356.c&|\301\342,\254)\353\002\253L\331\021\031\266\355\331\377\b\362\022T)\033\030\251\030\020\206*\"r\307\t\3309\257\3508\203\312j\253\350\021\t\266\350,\337\2707\235\260\346S`x\375C@\306HP ?-\370^\341e\002T:\036\356 \331\272x\347\023&"
+	.ascii	"Ty;@\353~\034Tz(\314\244,R'{ 0\232<\251\305a\"\357\323\274<q"
+	.ascii	"V\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375 \357}\004"
+	.string	"\224\006\353"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\317"
+	.string	"\177\021\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\320"
+	.string	"\177\022\321"
+	.string	"\177\023\260\351\322\245\001\001\322"
+	.string	"\177\024\377\037"
+	.string	""
+	.string	"\200\200\200\001\323"
+	.string	"\177\025\003"
+	.string	"\003\344s\244v\003\001\304\253\002\204\256\304\204\257\002\003\002"
+	.string	"\254\332\264)\001\342\007\003\002\001\242\n\003\002\003\244\013\003\002\004\240\367\3246\001\344\016"
+	.string	"\017"
+	.ascii	"@\264\226\273`_P\260\013\031`\220\026a5\\\343\2474\204\231\002"
+	.ascii	"%\030.\203Tu\022Pv\3319\006"
+	.text
+	.section	.gnu.lto_.refs.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e0af31dc8c14d0ba,"e",@progbits
+	.string	"(\265/\375`'\n]6"
+	.string	"\032_\b\025F`^R\007\373\203ct\317\t\372\360xB\234\317j\337\213\032/g\030\n\360.\016\370)\30664\332\305\360%\264\241\365\007\211~\b'2\264\035\201\031\305\013\224W\013\234\233<.\005\324\236\305\023\251n\367o\"S\n\036\001=\001?\001\036\306\241HS\377q\027\330\220\234\230\251\036u\377\261P\204\b\021\"\364\334\300\254I\001H\033\306\232\337\203\324\006^@\375\234\304\016\214KN\233\005\331\330W\030\034WN\273\375\253\313<\254\375\213\213u\352\305\334\322\374\177\340\217\316\224w*\247\r<HM\213k\237X\273\375\351^|\315\033cg9u/\347\342_C\336\245]\213\307\355\223\214\343\370?\376\t"
+	.string	"\325\002\313\221\323VZ\333\235]T\363\026\372gm\037Ryww>\244v^\201\036\244f/\240\002\261t\373\025\357\032\342\271U\314\177\376\307@\2532\314\227\256\234v\354A\352\352\005\324n\377\001\273;Lw\237\301\371\217\227\005\335N7T\240\333\333t\273\373"
+	.string	"1\335=F\251\273Ct\267\2111\367\021\350\3664\335.\240\333sw\347\351n\271\356\216\353n7\335\255\326\335b\335\215\326\335\020\272\273Mw\237\351\3564\335\335\245\273\313\272;\332\335k\335=\326\335h\314twWw\033\350\356\264\356N\357\356\356\356\272]\331\355F\272{m\001@\257\374\366\235\311 \253\222\t\273g\2300\320u&aW\271\005\003e\271\025\021\253\361\246\306\212\317q\225oc\211\225|\201Q7f>\333\277?g\374\373\340\037\213\371\262%y84*j#J,\311\364\370\377\021,\243\2040_\031u\2430\377\243D\251\370\257\320\306\321?\342\321v\b\326W\315\370O\260\374o\375\243\377\337\376\177\357\305\212\377}"
+	.string	"\335\346r\371\177%\264|\254\326l\306\177~\306\201\302\256S\bSh\326\305\331|\032q\353\315g\333zWg\273\345\253\376\337\351\254M\330J.\247^|n\233\262=9\3655\316\306\277\026x\233.\262\320\274\326\353\273\004\354\341\332\223\247lm_\240\372\235/P\307\342\264\t]\231\2704\317\237\23658Nt\255W\003\317\223\265\330'\311\306\026E\r\315"
+	.string	"%X\352\270\264\2767_\230\264\235!\313O\257,\31543\001\336#swr\352hBC\262\367\315i;\327*\306\311\370\030?\363//\323\355f\016\246\205\342\177\345\377\267\321\026\177J\261\3222\352\026\226\371\337\261\302\022\226q0'\353\275\232w\230\313*+\356?n\357\352\366,\355e\0027\222\236\177E\244:y\355>\267\235\223=\032hI\265\234\346w5.7:W9\365;\207\016H\253\212\266\345\324\3678\331"
+	.string	"-tY]\320T\013\224+\"sss\236\307\257\276\235\343\300\nI\030\324G\314\220\2503<\355yx\321\037Rt9u:\277\363\203\225hXw\352l,I\233\022\037\257\264\240\345\324\355\270\232\252UE\3659u"
+	.string	"mpi`\334\370\b\261\343V\366FN\016\370Qp\332\232\036\r\013s\313ig\350\332\316\346p\332\343t\034\217[\343\277\341^\250p\234\325\375\325\025\221o\nK\312\016\256=\256\337~\377]\377\257"
+	.ascii	"@\036#@\334"
+	.string	"\344\324\333\374\355'K\023\214\22279sf4\3368\332\212\007J\335XN\333\335\332m8\221J\313i\327q\037\357M\314\t\025=k\347n\365\223\357\377\343\360\211\377\215\372\265\373\270\023u\013p\236?x^3P\362\257\3456\267B)K\376\310iw7\370\256\362\337\002}\374\257\353\334j\335/50P\374A\016\274s\310\273\361\026\2342?\177\374\376\312-\270\205\0333_7f\266\300W2\333\377\030\006\272\317d\353\256s\013v\235L8\354R\221Q\221\321\222\323\320\005\222\370\202\210d\215L\004d8\025\221D\226\205bZ\022*2*\376*`(\222\301\204\024\303\210b\2104\320MF$\361HL\261v\205#\tGH1z\215\224D!\211\202\332HIBa\322\221p\355#!\217]B\352\021\233\216C\326\305\321\030\324*&\250`\207+\210(\240\234\232\216\036\202\023\210\372\211\005\021\031d\237\236\220\301"
+	.ascii	"*\330\024G\342\007\246\337\221\370\201-\026Uv\251\310\210\035"
+	.ascii	">9\025}D'\024(\2140\224X\254\354\322\221\220=\032\241\326\026"
+	.ascii	"\n54(\021\242\303\3324\241\310\250\270\304\026\213MK+\220\303"
+	.ascii	"\240"
+	.string	"\213\343\223\221m:BqX\201|*\2728\016\221JAb\023\022\352\211DP\004\211\rA\022\036H\200\320\020<\032\207+\202LF\247\013D'\246\241\322\013\342\b\326\230\201\305\017\316\313\357\001\221\223\305,\277q)\234\236(\272|#'\305\336+Hr\232\225Y\231\227\315S\276\026Y\323\347\346\264\253\223\253:/\177vD\314Ds\232gd*\237%9\262\3122U\236\002{\213R\3454\323\310\256\177\021\345\032>e\374N\237\033:YO\346\332N\244\3768\221\232\245\034Jf\346E\365\344I\351\330\301[\256vv9\351^\037\200\304\250\2410e\02053$#\"\222$I:\220\002\221\031;\316\001\022\300v%\223\030#\021R\022\373L\233\001O\241\312\330\250\355\f\272R#\301]\340\360A\215\004U\007\222\214\261\367-'\020\016\320\035\37516D\364\276\027g\006\013\204c\221\344a\302#\t\222,\371\352\001"
+	.string	"`M\252\204\336\364!Y{\220,\341n\312\237A`\221\032\211H\270\032\304\331T\363#\333\025\374\306c\324]\013\202+],\221\326\374\263\356\013_\n\346\376j\345\215|\232\264\030\231\ro\026}D\352N\023w\"\362\301\307\333\r9#EI\3204J\217\326\232\020\250\001\201\337\206\\H\200$\362\273\f\202\230\242\303\246\ts\210r\220 \262\373.\001\233\246\364\206\024\201\022\206\312\200\214K\215OE6\374\305\304'IF\021\3120'\002W-\t\251\355|\333>\013Qj\215d\206P\275\226\222\033\300\252)=\373;\306-\313\324\307\203\003q\203"
+	.string	"\377\303\200\037\322+\202\034\317"
+	.ascii	"`,\346\320\263\347T@:6m\321\316\026\202\354\362\321\257\2024"
+	.ascii	"\374\033\207\003/\013\332\320\270}\037a\334\345\242\3721\032"
+	.ascii	"\302\350\333\341\207q\217\274\347\007\305\301\364\215h\364Q\032"
+	.ascii	"\371t;\376W\266R\270Q\324\037\257j/\352w\311\215p\252\303\331"
+	.ascii	"~\205&\3123\177*\335\227;\316\341\262\005jk\354'\350\361\237"
+	.ascii	"M\274\260\354\271\210_8\202\330\350{U\306\330\251"
+	.text
+	.section	.gnu.lto_.symtab.e0af31dc8c14d0ba,"e",@progbits
+	.string	"arm_cfft_radix8by2_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"arm_cfft_radix8by4_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"arm_cfft_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"arm_radix8_butterfly_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"arm_bitreversal_32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e0af31dc8c14d0ba,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
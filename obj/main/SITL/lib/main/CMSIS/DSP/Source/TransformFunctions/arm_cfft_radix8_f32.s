@@ -0,0 +1,332 @@
+	.file	"arm_cfft_radix8_f32.c"
+	.section	.gnu.lto_.profile.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\365"
+	.string	""
+	.string	"\210B\001"
+	.string	"\001"
+	.string	"\266\256\337\242\f\234\001\002"
+	.string	"\001"
+	.string	""
+	.string	"\004"
+	.ascii	"\033\244Bp^\236K^\003C"
+	.text
+	.section	.gnu.lto_.ipa_sra.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 !\205"
+	.string	""
+	.string	"@\025"
+	.string	"\001"
+	.string	"\004"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\240\223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 ;\305\001"
+	.string	"\024\003/"
+	.string	"\001"
+	.string	""
+	.string	"\246\003\251\237\237\242\002t\003"
+	.string	"\001\001\001\002\002"
+	.string	""
+	.string	""
+	.string	"\002\306\006\251\337\236\242\002t"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 \"\365"
+	.string	""
+	.string	"\300\026"
+	.string	"\001"
+	.string	"\004\001\001\001\001\377\001\177\002"
+	.string	"\177\002\002\177\002\001\177\002\002"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 <m\001"
+	.string	"\3700"
+	.string	"\001"
+	.string	"\004\020\274\006\024\274\006"
+	.string	""
+	.string	""
+	.string	"\002\002\003"
+	.string	"\001"
+	.string	""
+	.string	"\002\004"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\005"
+	.ascii	" @\315\271\340\312\235]\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.911c8b225b90a0b3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_arm_radix8_butterfly_f32.79.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375`\2063\035\264"
+	.string	"\n,-?N\020(f\255\f\007u\034\342Q\306\027\272\310\320QI\246C\016\267i\025\214D\033\345~0\332\273ZZ}\3413f\366\225B\022\224x\024\322\352\004a\002\336\254"
+	.string	"\337\031\270\331\022q\341\223)#\210#4\237\370G\3101\215\347\311\324AR\2222\264\003\311\003\005\004I\246\025\251h\235\201h=2\255F\246\225G\321\272\203h\225\301\264\306`Za(Z\217D\353\013\2465\003\246UG\321\232\303h\305a\264\026\031\255.\030\255DF+\006\214\326\026\214V\026\214\326\013\030\2557\214V\013\030\255\0250Z)`\264\256`\264\252`\264\246`\264N\300hE\301h\265a\264\236\260V\t\230\326\032\2465\002E\253\tFk\tk\205\200i}\200i%\241h\245a\264\316X\253\003L\353\b\246U\204\2425\004\243\025\204\2656\300\2642\300\264~P\264\3120Zc\254\325\003\323\332\201i\205Q\264\2760Z]\254u\310\264\2660\255,\212\326\025F\253\212\265\2460\255B\246\025E\321\272"
+	.string	"\2435h\255'L+\007\246U\001E\353\006F\253\t\2435\001F\253\006kE\200i=\200i5@\321\232\201\321\212\301Z\013`Z/0\255\026\024\255%\214\326\n\326J\201i%aZG\024\255\"\214\326\020k%\200i\035\200i\235\240h\225\300h\215`\255\0020\255\0010\255"
+	.ascii	"(Z!0Z\037X+\b\323\352\200i\375P\264z0Z;\254\325hZM\323Z,Z\201"
+	.ascii	"\214\326\237\265\022M\353M\253\213\326\375\335^\325M`\207D&9"
+	.ascii	"\344\203l\363#g\266ev\315\354\276\355\306\355\312\355\322\355"
+	.ascii	"\326\355\246\331]\263\313f7o\267\315\356\233]8\273qv\345\354"
+	.ascii	"\322\331\255\263kg\027p\367\316.\236\335<\273zv\tw\371\354\032"
+	.ascii	"\256\221k"
+	.string	"\246\265\323\372\\\027Y\037YG\255\245\326Sk%\353\252\265\325\032k\235\265\336Z'\327O\326]k\257\265\2245\330:l=\266.[+\327\313\265\225e\241\272\333\266n\013\267gvn\321\254\335\252\331\273\305[\275u\263{\213\303\362\355\234\355[\277\375\333\0346p\005wp\367l\341\366\331C/\271\311O&b#\2062\022'1\225\227\230\211\257\334\304Z\346\262\023Cq\024\177y\212\251X\314d6\363\231\253\370\212z\260\3025e\031\026Ei\346\244,Mk\314Wao^\002\206\245\0170\211\024\256(/*F\272\310\316'74%\325\214\334\"\023\327'\313-\216\020K\204e\035\300A+4?<UI]T\342rP\222DD\216\ta\215\235?O\325\261\324\034G\305\361\221=\027i\343\023\317Nk\314\244\007\320\316\310$\235\241\222n\317\031>o\204amz\312\306\344A\213\013\203g\313\227;e\270"
+	.string	"\276\245\3319\263BxC\035,t\302\252\310)S\306Q\342)$\203C\345\315W\033(yj\\l\3124Y\003\307$\r\037@\252\272$\022:1#rY\236\342\324v\351\255L\0203>,0\"\221i\340\342j\3301Kf\310\226\361AD\216\331\263,}"
+	.string	"\221H\344\006\373\243>\314\375\261\200\250b\346\340 \202\241\341Ef\324\311a\341]\326\313\220\375\262\001\r>\260\242\247\202\271?\020x\255\272i\2536d\267\004y\221\031hy\200Hd\027\016\364\004s\177\264\313J"
+	.string	"\264?\346\n"
+	.string	"h\177t\210\252\035\002<}\300#\022F\017\022\211\f\372\024-\036\366Yb\227U %\352\177\206l\007\343\007\323\201\"\220\207\037\020\304{\210\356\036\241Z\332\016\276\262>r\266d\215V\373\241\311\226\315\253u`\337Laq\271x\265@\246\325z\3307SZY\376\201\340\254jA\020\213OI\312@P=\021\207\b\001\345|e/XN%M\254\332w\240Z\262.~\200D\"\325G\250\224\254>\260\252+BuM\250\n\261\b,<|\305\177l\301\235I*'\261\246\342A7\330\327\017K\205P\n\024\027:Qp\001G\001\364\005\374G\260+\210\203\023\n8\007\033\\\001\273I@\373\r\376C\353\360L\232\220\301\304\201h\r&\340\017\200\271\317\221;L_\t8\020\255\277\257\217xb\257\217\270;\225Q>b\356L&\335\365\021mP>bM\203cp?Qjp"
+	.string	"\004\030\340\007\310\340\006\300z\006C\3200\270\240"
+	.string	"\026\374\202\022\267\240\352%~#\353\360\\:\271\210\300\n\036\342N\206P\001\t\nF\234\204\210\217\270\272\b\023B\f\200"
+	.string	"\023|"
+	.string	"\022|\202%\227\3407\262\376\316%\327E\354E\360\007\356\255\025\"\b\200"
+	.string	""
+	.string	"\360"
+	.string	"@p"
+	.string	"X\035\002\027\036p"
+	.ascii	"\304\207;p\343y\370\007%\367\360\033Yz\347R\353\"\346Ne\207\377"
+	.ascii	"\334Y_\2773)C\007\323h\033\266x\363D4@/bY39\320\211~\347\262"
+	.ascii	"\3117\374\360a\216\351\006\001\332\237\237/T\326\357&'~O+\304"
+	.ascii	"\325; \3777\336\336_\"\206L\233\004\344\246\357od\301\235\313"
+	.ascii	"+\254\213X\263\272z\210B&V\017\021X\305\344!\372\226T=\304\236"
+	.ascii	"\222/y\210;\365\324\335t+\371\213&vg\262\311\207+#\n\241\023"
+	.ascii	"\342\277\364\205\263<\243\247N\342L\312Fr?\035\312W\326\350\346"
+	.ascii	"j\213\361oW\242-u/\035J\225\203\365\323=u\025X\177\247a\023\020"
+	.ascii	"\341\241\331\325Q7\222\203\300b#b\310\344C\325.K\376\327\233"
+	.ascii	"%-\275\227\352\0325i\354\352\320\320\315\311\2359\334\337\356"
+	.ascii	"v3d\306\260\211Y\373\342\245\213Z\232\0264\033\260\\\261Rey\246"
+	.ascii	"4+#\033\023;\025\260O\271\224\177y=J\327\241<\341\332\322\312"
+	.ascii	"\272\262bR\265qVO\265rV?\265tV\237d\353\254^\nI\024\324\215\274"
+	.ascii	"\310\211\234\177\272\323\2336\317\352\231\276t\344\341\022\256"
+	.ascii	"\332\260\317\362Y5\237\302=z\006\363\b\342\t\274\223\003\340"
+	.ascii	"\237\035\277:}"
+	.string	"t\346\310\341\3332\253\216\263fV\215\303\276\255\032\316\306\255zo\345V\375f\351V\355f\353V\335f\323\254Zo\327\254:o\331\254\032o\363V\315f\333\254\372n\337\254z\315\302Y\265\232\005\263\3534\006[\265\235\303V]\347\261U\243q\331\252\351\254\\\365\234\227\253\226\263\325\252\317\304\301\275\205\001\263\366\305K\027.[\324\322\264\240UY\236\255\341\252\225kg\325fe\013\270j\262\325\263\352\261\275\263j\261\260\305\263j*`_^Q\214\\u\227\231V\r\305GV\375\304N\253v\342\250U'}\256\232\313R\253\336r\221Ukyj\325Y\273e\327M\214\265j,g\255\372\312[\253\266rr\325L\374d\325U\356Z\365\022{\255Z\t\325\324\212\331\265\024\222\375\262\353((+Y\365\351\252U?9Y\312\252\233le\325L+f\325KF\253\221\207\206}\370\024\022\356\3213\230G\020O\340\235\034"
+	.ascii	"\377\354\370\325\351\2433G\016_\034\034\340\354\275q\323F/\017"
+	.ascii	"\217\315\335\0325i\354\352\320\320\315\311\235\211\203{s3\323"
+	.ascii	"V\206\314\03061a\300\254}\361\322\205\313\026\2654-h7d\261\001"
+	.ascii	"\313\025+U\226gJ\2632\2621\2610*`S\244|yE\3512Z\027\312Z\367"
+	.ascii	"\211\223$\327\226VV\023\254++&UK\224PM%\221B\022\005u\304H\021"
+	.ascii	"\"g\321\272OD\353:\231\326m2\255\313T\264\356\022\321\272H\323"
+	.ascii	":\304\264\n)Z\203\020\255J\246u\003\246U\003Ek\r"
+	.ascii	"D+\020\323J\203i\375Q\264\372 Z{\230\326W\312\342\302\327\310"
+	.ascii	"\242\027\346\021\310As\344\016\323\236\rs!Y\354\366|\250\r\217"
+	.ascii	"\236\017\255\235\312\301\007\025\236\311\246;y\036\024(\370\240"
+	.ascii	">0_.7\036%=`\276\254y\371~\351\362\365\342\367\355\302\304Em"
+	.ascii	"K\332WM\3137m\316W\313\221\314\370\316e\340\203\356\320\276W"
+	.ascii	"\356;QhYn\260\341\233\005\313\327\206:_,VW\252XY~\253\234}\227"
+	.ascii	"r\276gG2\263;\2279<\250M\371\025\273\001\237(\313\314\310\276"
+	.ascii	"ec_\262\276\357X\230\030\2250\260/\225[p\312\027\214\357;\345"
+	.ascii	"Hfl\347\362\357'\244|\241\334v\3560g\322\212\024\257\257(_\257"
+	.ascii	"\023\375\272"
+	.string	"\276Q\350|\273\376\023&\310\026\037\346BY'\373$\371ur\013\236\313&\256o\322\351\313u\244\262\301:~?\321\327W\347'\366\350\364\375\304\335\034:?1'g\316O\264\361\311\371\2115\247\233\3575\310\016\211\305\177\351\216+\251\017w;\216\271<\017\347\241\200\240\331\362\301g.\303\334\233\007\347\255\231\016\245b\342hme}\265\232|\263\202|\233\\\211\214\355\r\207+,\253\357\025\223\257U\r_&W\032;\254\203\263\244J\311w\t\325W\211\217/\325\225\306\006\363\366\222LI}\223 \371J\315\360Er\245\261\2778o\240\242\216|\241\214|\217\354\370\032\271\322\030\237\0357D\212\234_\"O\337\363\370}\272\322\230\336\231\f\222\247M\223\3232}\233\226\276L\226\373.]i\314\356L\0061\324\033\262H!\037\022\344B\354\036\344Gcpg\336\006\2244\360\r\324p\r\324\275\206\037\215\261I\341\321"
+	.string	"\344\307i\360\361\037h\356\343Gb\207Vl\222z =i\206#\321}\206\037\211\r&\357\214\216x\334\350\366\333q\036s\337\361#\261?)^\023\203\f0<\206\333\357x\0304"
+	.string	"\362\231\037\177$\306\347FHY\f\023\310\241A\315W0\003w\232\277\240\343\031\270\375\316\245\216\037\211\351\0211d\252\263\373\006mh\352\276\301\032\035\232\233(\234\243\273\211@\271\317\335D\337\231l:s\313\275\2030\276s\311\364\034\367\231\245\347x\nav@@X\206U\036\356\245\305\251\213\250\342[\303s2\341\317\277tw\b\214\020\020\304\275\264\307\031; \374\366\027\316\354\\\241\364m\203*.kyN&T?\275\375\005\330\340\231\304\021\347\013\016\2763Y\364\313\025\201\235\271\\\210W\360\237q\341k.\330\235I\242{!\372N\201\301\235J\f\374q\030"
+	.string	"\203{\334\201@\370\214\037\356\352\026V"
+	.string	"\323\302\20189d\341,\034\210\223\301\013\270\020\346\002\007\342\344/\314K\250\031\314K\334\235\312\265\227H\363\227\227h;\225^^B\213\273\274\202\302S\311\345\025\004\236I\264[\353\336\362\n\372N\345\215[\315\354\306SH\362Y\340N\213\263\200^\t?\341\216\253\300\255\005J\005\236B\322\316\307^aJk\203D*\021\211d\302\200\0027\332\027\216\002uI8\f\256\301\r\267\002\340\n\337\251$\333\231T\341J\025~\246\270\266N\225B\b])\334W\226\250\207k\360L6\205\035\352\352\t\230\260\234\300\201p\375\235I\024\260P\340\263\361\343\035\271\303T\305\306w\212K\257\312)(\363\362\024\264\235\312\263S\260v&\233\306\254<\211B\263\223\b<\341%\334e_?6'\324\220@\004^\343DA\023\036\201\fn\302\177\004\343\224\360"
+	.ascii	"\b\220\360\007\334x4NB\211\323\370\217\255\2773Iv\022{3\016\302"
+	.ascii	"=\366\365\003\2341\202\003D\370\b'\n\206p\021D<\204\377\b\n!"
+	.ascii	"\004\201\001\r\370\340\f\270\361d\374\003\t.\343?\266\364\316"
+	.ascii	"\244\330I\314\305\270\213;\354\353\347\024\243\003\017`\274\203"
+	.ascii	"\023\005_\034\006\004\177\361\037A"
+	.string	")\027-\206X\274\305\215\267\342\001(\210\216\027\":>\005\321\361*\210\216_At<\013\242\343[\020\035\217\342h\241\243S\034\255\342\350\025G\2638\272\305\321CG\3438Z\210\207aX\024H\026Br\n$\253@\362\n$\263@r\013$\017!\031E\017\013\3650\212$\013%9E\222U$yE\222Y$\271E\222\207\222\214\342\310BGNqd\025G\0262*z\n\243\242\2530*\372\n\243\242\2630*z\013\243\242\017\031\025]\350\230\364\024\307\244\2538&}\3051\351,\216IoqL\372\3201\351H9\216:\2168\214J\300q\244\241\007\004:r\030\201p\364\303#\007\004z\350\320\001T\204d\343\210\250E'\204R\350ha\b\310\021\007\021R\013=t\350(ja\007\022QP\022\017\243c\217\"\036>F\330\201d\244#\211\007\021\022\nA9\212\220|\030\331\b\252a#\204 \0334l\224"
+	.ascii	"B\020\217#\321\216 \027\2162\200\240FG9\220\202z\030\031!\005"
+	.ascii	"y\350\202\334{\351\t\205m\230\336\324\341_K\377\333\217\332\364"
+	.ascii	"N>F\241$|\330|\270\227\272\231\370\342\273\333Y\264\231g\263"
+	.ascii	"{\242r\340^\272P\230\3449p3\357qW\006\344\363v\272\231\023_Z"
+	.ascii	"n\346"
+	.string	"5\312\374\235I#\225d\214\374Z\225\321;db\333\303\013)cw&\315\310\234\204\266*cN\302Z\225\373\315\317v\032\205f\367\335/\3465\310\f\032\276\255\255\341\327\212\314_\237{\331>\027B\206\357L\226\255\235\306\335\362\313i\314-o8\277\227\323h+\273\361\376.\257A\206\215\217\024\265\345sx*\013\257e\013/d\314\340\231$S\373\214\276\263\264\3178\273\343\374Z>\343\356\\6\221\335z?\332k\214\261;\227\204ilX\302\257\325\030\270=aWv\317\205\214a;\223c6\\F!\226\313\bT\336m\376+\227\3217v\253\371\255\\\306\336\271\004{\225\313X\363%\227\2713\251\346k\256|\321~5T~v\031S\256\274\214\2654f[\354\236\346@\233\367\335\373\355\302^\366\030\201g\222\3541\372N\245\330\307\036cO\3541\356\242<\3541\346N%\225\307h\353:\330c\254\235\312)\367"
+	.ascii	"\312\245\334\203\300S\371u\017\236\334\353\036\354\235J=\177"
+	.ascii	"\224&=\277\241\2467\370w\325\355\240\235\234\257\337_\227\347"
+	.ascii	"\207b\301<\277\241\006\267\202\377\223\033\315\n\262Qc;\223\\"
+	.ascii	"\276`~4x\320\270\026\317a`\224\326\006^H\332\340\2314\302\365"
+	.ascii	"\016\372\220l\275\203=$7\016\277\326;\270\313\373\263^#\315\356"
+	.ascii	"\016\230\253\275\363\265J\203\313\301\212\311\346p!ilg\262\310"
+	.ascii	"\325a\024FY\035F\340\271|\324\355\346gr\030}\347\262\310\275"
+	.ascii	"\346\257z\r-|\347\022\360\r\325\002~\255\264\374Yy\222\375\273"
+	.ascii	"\020-vg\222\3520\332\246\016c\355P\367\336\237\344/\n]x\263\371"
+	.ascii	"\245\376\"\360\\:\035\311_\320=\n\360t\207z\r4;\027<r\207\211"
+	.ascii	"\310\332\371Z\241\331\235\3119#G3\374\334\317\027\371\2135\""
+	.ascii	"wQ\310\364\363.\002O\345\323] \357t\027{Mwq\347\367\225\3633"
+	.ascii	"\335a\244\370\365\325\241\363\355\373\217\333\234/\2359\007r"
+	.ascii	"S\312\211\303\207\3037\316-\b\347\213\003\234+\335`w&\227\356"
+	.ascii	"\242m\357\233\367#\3570h{n\336\264\371\272\371\217\233\336\267"
+	.ascii	"\215\336\201\334\300\344\261\301\273\373\262\271\005\327|\357"
+	.ascii	"\326\\\351\006\2663y\370!5_\272\333\360\016\363\246\306.M\335"
+	.ascii	"\327\356?nh\276uh\016\344\226\206Nn"
+	.string	"\356\314W\356\026\214\373\236\211\273R\226\3013\331\347C}p\33727\237;\314\0338\26773_\267\377\270\265}\315\264\035\310\355L*\325)3\206\f\333w\314-(\346\313&&\204\260\250\3430Iy.\203\330\241\232\231\240 I\n\222\306\203\031 \020\314T9\351\335z\023\300\022MB\221&\346QE\t\225R:'\335e,\325/\301\f\020\f\232\t\177"
+	.ascii	"\354\001t\347\225h\354M$\331 \273\036\244\210F\322+\255\023)"
+	.ascii	"-\251Fj\337x\365$QHh\277|\271\316;\251\231_\351\314x\031\321"
+	.ascii	"SQ\016\232\210\333\364\335\221\222\032\211\216\bcP(;3,#\363\325"
+	.ascii	"\313\021\323y\231\276w$S#w\304\372Ro\344\021\216\316ZK\342I\t"
+	.ascii	"%p\373's\033\205\207\314\271AM!\ns\253Y\"Y\361\227LI\277\020"
+	.ascii	"\373\210\356\025\235S[\342\207\265\312\330\0360%`\255\241\210"
+	.ascii	"X_\263\026b+\370\334\204\231\\\221N\302'\371\202\274\205\315"
+	.ascii	"PR\024J\366\260\023\301*\363\301\307\\\223r!\0368-:\251\217m"
+	.ascii	"\232hp\003\nC\316_\203\307\227.{\253\017\016\033\037\027?\260"
+	.ascii	"\nEy\223\363\337\270*\306i\331r\325U\024\205\250\337\240\240"
+	.ascii	"_\213\206P\257\020\023^\022"
+	.string	"v\222\244@\200'\235?[J&\211(\204\"\371\031au6\351\374\225\252\374\237\235\005\226\204\021\222\224\b\307=\323\276\262\nTl\360)Sr\267`\212\375\267\020\200\270xT\266\270(Yv\364B/\232\226\210iB\341\321\230\222v\330\013\210\310f\021\357\365'\374\376\357[\216.\362\3653\3758[\265\252\327\333\203Q\367J\224\377\003\212x\227\372\222\253[\272\331#\235\357\272;\217\336\022\242\025\241\352r\013\331\216\331\306\364y\032(\335\025\234\230\027\367\340\247\223m\262\275\320_\3542:\352\256\303\2749\255s\307\331\004\341*{l\247\t\n\201\177\0222\320q\360\314\310+X\360\351\026\344 \332\225\251\336W\351tu\220\212\024\345\334=t\312\260\021\f1\247+Xt\273\355\255\216\b\322f\342\323~bC>\270\001H:\362\231\246B\342b\315t\364f\200l\025\030!\247\023\322\316\236Q\217(8A}E\345"
+	.string	"\031\375\035O\3106\002\227=\\\320?J\201\373\313\033\342yT\007\223\fhK"
+	.string	"%B9\037I\267T\356\022\315X\305\340\320"
+	.string	"\323\354\272\225\264\273\357Tb\251rD\201\377r8\343\216\313\025\230\377"
+	.string	"6\242\n\372Ou\270\222t \331C\304\370\316W\342)\203\374\032\257\372\030\217\372\030\217\264\2449\334\355\356P\377sS2Vu\033}\367\257\203\277n\360\305\257\032\355\256\301\337\177j\264w\006\177\377U\321\3365\370\375W\r{\327\240\177\327\376\016\211w\377I*A\327\332\236#\006\242\b\213\335\264\b\n~\250\016\267\217\204\362x\016\337\370\007\bk\261\365>(\260\026D\365\036(\0206\210\323?"
+	.string	"B\205\267\360\307\254P\276%\325e\267\263\206\341U\013\326\306\352\241\036\352\342.s\013X\272\031_"
+	.ascii	"C\3406\253\002\031\"\243\f\003\003v\311|L\221\225\032s\026\r"
+	.ascii	"+\200\312\261i\244u5\265\361\200\200\243\236\211\274\335\312"
+	.ascii	"5\226o$\314\241\355\221\361xa_%\353\377\330\324`\332\266\324"
+	.ascii	"V\203\341\247\317\236\262\335\262*\240\376 \237\361>\204\344"
+	.ascii	"\237Q\006Sd\022`2\3511\233\265\020\252\376\241'\274h\007ad\376"
+	.ascii	"Y\212\311\305\231_\\\016\263b9x\327\245\f\355\036F\262\344U\355"
+	.ascii	"\247\247\210v\231\177(\365\031\004\305e?\233\356\322$\002S\r"
+	.ascii	"\273\303\314\351\350\207\232qH\315\023\321mP\223Bd\252n\353\366"
+	.ascii	"*Z\033\240\221\266\203\241\037\234[\344%\310\312\325\273=\313"
+	.ascii	":%f2`da\367\016%\326\352{V\223\024\311\2229_,da\376\327\204\037"
+	.ascii	"\236z\302\225\247\021Y\b\374\301\337\362Q57\320\234\214\270\224"
+	.ascii	"/ \273\200"
+	.string	"dR\375\033\334\357\0359\2675(j\245&\021\246\254\376\264\340\211\212w\333$\341\214D\021\353tN\312\254 \237\344\361\311S\3715\354\317\\\254\311\245\275\016\256.\341\325\302O\036e\344\222<$U7\356\203\311\333^w\363R\316\002\321$\317\217\234\312OC~\346\372\232\030\355\247\361z+/-~z<\245\335\255\f`rx\372d\310\352\355\315K@1\253\204\210\224O\373\361(XK\371w>\262Q\b\271\236\261\355\203\210\261'\302\226\234\2150q0*\344\240@\035\322\270\326rl\n\203'\362r\240\255\216\203\213z\301l\266\302\355\301z_\256Q0a\363\272\234\311\334\217y+\267\316\374x\246\213\301\255\334\n\244\236\271\301[@\270\001Uz\020\251\327Jl\336\346\272\3144\032*o\321X\032\027\221\232\0338\t\3259%\344\"\210\345(\362A\311\005\355m\035\32173\355\252\004\377\322%.\227\221\241E"
+	.string	"\344\034+~\007\322\357K/'\360z\311\354TSSk\245\220\204\254\322B\355J\346\372\212\026\221\25047KH\365\305!\257\372\260\004\016C\275\341Q\241\255H{\264MHc\250D\204t\276O\210\322\3726;Y\017QY]`\367O\205\371\351\\\314\230`\271\335\347B\274Z\315\311\352\254\346\322\371\344\243!K\017+Q+\375\243:P\305\325\204\253\370l\224\322\020\315\223H\341\023\004\334-(\377\220o\271C\335\325\245\3723j@V\244\335t\201\026\320\201(\013\351\024n\342\272(\244\026%\277\317I\341\314\030\340o\367\221\216+\326\312EP\301\345\020\311D\001;\300\2036\211\017fHTHa\001"
+	.string	"\001\022\250\002"
+	.string	" \024\022B\300\r \r2\020B\004\301\005B@, #"
+	.ascii	"N\n\216G\022\251\302\021\031\314\204\"i5\021\031\244\226\f\270"
+	.ascii	"zi2\260\313\215~[s\364\333\356H\201\355\210\3765\257\2017\017"
+	.ascii	"\032P\214C\n\264!\366ZgH\200f\b\270\363\320g\327\034\201\366"
+	.ascii	"\354\200\376\327\360A\267\025>\321\2419\206\242\244cV\225\377"
+	.ascii	"\0037\327\033?\343\342\342\326_\034\034\333\372Cc\213\226j.\013"
+	.ascii	"i\216\277lJ\360\360\200\345\317\024\310\375e\003\350\364~N\301"
+	.ascii	"~\fM(\322\367\365\347\034\354\347h\212\243\255\202B\356\373\220"
+	.ascii	"\303\347\334\274!\001\032\f\202P^bx7d`;\206\3176\364g\022\004"
+	.ascii	"\325n>0\002n \311\264\351\334D\3758=\035\"\375\035\3351\260\217"
+	.ascii	"znK\360\305`\212v\b\334\303I\265\312\324\344\224\025/pE>tQ\345"
+	.ascii	"A\306\"H\245W\377\036\227\315\320APo\370`v#\225\204\343\262H"
+	.ascii	"\312\367l\315%"
+	.text
+	.section	.gnu.lto_.symbol_nodes.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\317"
+	.string	"\177\005\233\201\342"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.911c8b225b90a0b3,"e",@progbits
+	.string	"(\265/\375`\200\003\035\033"
+	.string	"\3264\272J\260\226q\306|C\306{\232c\032\324\246\271\211:\336\304\315\001\241t\344\201\321\244\375\326\226\016 \272p\275\251l&\202_\372LX\237[9S\377\376e"
+	.string	"\234\230\007\035[\315\227\304/\222\333Y\314\234\335D\275\302u\337\330\266e\n\231"
+	.string	"\244"
+	.string	"\242"
+	.string	"37\350\333\3436\271\005e\317\376,\214(#K\217%qd\335\030R\304P\372\316\220\252\341\360\316\220\366ejWLMRp$\275L\331\350\221X\262o\216kt\225Ti\320\372\340\317\266\004\314\320\201eI\034\355{\344\247\213\344\313\336$\217J\353I\364\237\265Z\342D\303\2118\312\334\030r\324)}u\230\006\274\003\213\245\331\033C\226w"
+	.string	"\251c;\203\355\031\333D,"
+	.ascii	"\260/\f\333R\266\227l'\331n\262\335\332V\262M\3326b[\034\016"
+	.ascii	"\207C\333\030l_\261U\t\0027m\201j\332\256j\353\273\237o\321\026"
+	.ascii	"\345nU\323#\253\312J[TMw@\265%T4\204$\235\002\376\256\232\356"
+	.ascii	".\304\373\241=\2260e\3273\371o\020\350=\005\377o\3551AS\\\250"
+	.ascii	"\037\241\320\217\017t\275\354\177\003\274\237\241\365;aZ\264"
+	.ascii	"\376E?\035\316kp\262\302\307\270\302\323\305\357A@\377\001\336"
+	.ascii	"\177\336\013\377\237\377]z?\366W\301J\211x\274\337W\200\367\337"
+	.ascii	"\031\005\364\213\301&Pj\332\016\255\260\250\035-\321G\260\347"
+	.ascii	"%:\023`\257l\317\244\007\375\277S%\221zb\2128\336\035\227\307"
+	.ascii	"=\n\004\200P\232\206X\356\363\271hP<\030\304W\312\256q\340(/"
+	.ascii	"\277\321\177\004.#\212\240H\304\361F\335\245\021\307\223)\237"
+	.ascii	"8^\250\353d$H\350D\034\357\323e\022\200t\205\205\2218\272\312"
+	.ascii	"u\262\275\032\221j\370^\210\243/Pi\321&\217\366\376\233ha\337"
+	.ascii	"\373y\361m\271\327e\007\270\252\253\300\366x\225a\250\374%\212"
+	.ascii	"\250\2245\236\320\025\342h[\3467\376\263u\366\275\264\005\236"
+	.ascii	")S\022\265\305\276\005\201\267.\236\262@u\\O\361\354\357w@\365"
+	.ascii	"C\312\256\275\224]O\326w\353\371\263*+\r\242g\246\254\306\306"
+	.ascii	"9\316y\250\351^f.\247{\001\020\301c\323\325L\323GC\001\323n\272"
+	.ascii	"\032\256\306\241t\203\330\202\330M\b\027\337\340\320\340\320"
+	.ascii	"\220\276\301\201\301pb\260\3221\230\312\224\305`&\356\346S\232"
+	.ascii	"\262\032\033s\226\343\261\255\f\203\345\310\\\320\221P\322\030"
+	.ascii	"\324\330\330d7!n\033f:\231i\263\321d=\272\331\013\004.w3i8\237"
+	.ascii	"\b=\272\234\r\004n\246\263\360\252\321t>\271\235W\205\035\b\257"
+	.ascii	"\235\t;\024r^\270\333\254\347\245\341\306\363\300W\310\035r\217"
+	.ascii	"\\\227\310j\307\276])\231b\021\224R\372\272H\230\353\"}}\334"
+	.ascii	"\037\276@\354\013\344J]\337O+\0010 P\0021&Y\361\032\b\302Y\221"
+	.ascii	"\377m\257r\202\207F+\271\355\350(\tm\2110\250&>\251\205\266\377"
+	.ascii	"\b\231\311\345\332\204\356Kk\256\022;1\226Y\"\030\023\004\234"
+	.ascii	"\306\022\355\367wK\224\024\311N\251`Z\231\326#\266\th\315\322"
+	.ascii	"\233\233\266\217\351\256l\267p5X\310\221\265v\267\260\222\314"
+	.ascii	"{\257\201\275\211V\003\002\303Uv\371+\033\257\274\221\305i\013"
+	.ascii	"\362\331\204\002"
+	.text
+	.section	.gnu.lto_.symtab.911c8b225b90a0b3,"e",@progbits
+	.string	"arm_radix8_butterfly_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.911c8b225b90a0b3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,368 @@
+	.file	"arm_rfft_fast_f32.c"
+	.section	.gnu.lto_.profile.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375 \233\245\001"
+	.string	"T\002\217"
+	.string	"\003"
+	.string	"\313\232\342\310\002\034\002"
+	.string	"\002\001\002\002\002\001\002\003\001\336\331\377\237\016\002\313\306\260\307\b\004\002\002\004"
+	.string	"\004"
+	.ascii	"}\b\306B8\213s&\300\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375 \241\205\002"
+	.string	"\324\002\225"
+	.string	"\003"
+	.string	"\003\002\002\005\002\002"
+	.string	"\002\001\002\003\002"
+	.string	"(\b\001\020\n\006"
+	.string	"\001\001\002\004\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\201\004"
+	.string	""
+	.string	"\001\202\004\003"
+	.string	"\016"
+	.string	"Y\031X!"
+	.string	"qA\335\260\231!G`f]\224()\247wm$%`\240\030\006r\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375`%\001\025\007"
+	.ascii	"R\213$+\200\247I\007k\303b\242\231q\341 i\031\217k3]5\340\306"
+	.ascii	"\240\341\030\240\206<\002\001`\002\273\312\323\020\302D\"\215"
+	.ascii	"\220-w\n+FR\337j`\315Hx{\001\265\374\250\025\245\353g=\274\331"
+	.ascii	"\233\216U\201\377)\020V\006\\\337B\245\314\206\202\333\364 \224"
+	.ascii	"`<\032\b\020N0\036\r\203\357\333\275((;=I\332\3546\265\203x\325"
+	.ascii	"m\232\231y\367>\350\310L\200\217\352\3600-\022\002\212\364n\365"
+	.ascii	"\276\016\034{\2571*D\304\2648x\274\004\001# \260\0021\244t0\302"
+	.ascii	"\2261b\304u\215\230\023\260\036\304-\006w\274\035[$\377$l[\023"
+	.ascii	"\327\323\204,0\025\2706te\002\320\215-\2032\247\322\254\312\335"
+	.ascii	"u\217-\0226\206\f\222X\242\317^\032\310\r\314\275s\211~\r\215"
+	.ascii	"\273\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\025\003"
+	.string	"b\305\016\026\300%\035\017\374w\375\377\367U\3659\273\fV_G\210\335R&\031\373\\\306\227\301?\363an\013s\204\360\242\255Hf\223y[\321"
+	.string	"Zv\326\305?\361\262\312\232#\376\256;\b\016"
+	.ascii	"\336,\002\222 \025\246\006p\034\0202\300\335\230\255\b\365\016"
+	.ascii	"\252\304\001\307=\263\031\243\254Z\246\004\032p\003"
+	.text
+	.section	.gnu.lto_.pureconst.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375 \275}\002"
+	.string	"\242D\f\023\260%\351\220\354\222d\3020\f\303\212\001\037\301\215\355$S\272\271),\267\0079\326R\265\224\022K\361f\260\305rQ\312y\307\253\"@\3108\002\002\n"
+	.ascii	"\031\023\006M\3414\246B\336b%\2024\244lw\026R\314\013\2639\030"
+	.ascii	"`\001"
+	.text
+	.section	.gnu.lto_.lto.2de03c087d277dc0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stage_rfft_f32.79.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375`\210\b\345-"
+	.string	"\232S0\022Fp\230N:\377\3177\252\353\031$\346T\366\n"
+	.string	"l\341 \250\213\336\321\257X\317\334\n-[\240A\016R\204\243\220\202\342a\250%\357\213\245\035\365\311\007\221\214\270\006\346\235\264 \303\277\003\207\373{\032-!\204\310\235d\023\001\365"
+	.ascii	"\025\001\377\225\237\357\317\362\373\375\\~/\377a\376\227\234"
+	.ascii	"\311\235\034\312\333K\371\224W\271\336\255\034\313\373\256\345"
+	.ascii	"[\336\345\177\254\343\245\354\\\355,\fq\302\214\301Ey\027~yO"
+	.ascii	"\330\262\334Aa\036\371\316\216\322\242\300\255\3532i\275r6\341"
+	.ascii	"\310\"\303\\\253bOi\314\353qGFEH\t\2745{L\260;\345W\224<+\314"
+	.ascii	"\256'\312\020Mxh\331\031\217p\326u\357\307\035\210#y\022\264"
+	.ascii	"+1\236\253\335\341\314\\a\256\353\232t\224?\004\217\036\235\227"
+	.ascii	"\356\354@\353\3726w\327\341.\317\232E\2069&X\277\314/r#h\237"
+	.ascii	"S\321,\254`\3301\327u\271\304W\301\243\274\374Pz4\370\240\364"
+	.ascii	"(\2431\217\031\260\266s\004\231$\315\272\256\303\326\301>\315"
+	.ascii	"f\263\371sy\356\213\366\023\355\213\306\377\337q\330\332\322"
+	.ascii	"~\376\004\221q\364T\327^\374\350i[q:X\303\304\373\337o\262m\355"
+	.ascii	"vN\233\214_u\302\272\256|\331\332b\234\32333\0303\313`\016\246"
+	.ascii	"\bn\335\302\226b\372\355\356\206\302*\217\267\311\357\333G\276"
+	.ascii	"\331z\030.!@\356:\030\021Gy\336H?\324\360\327\001\317\202\353"
+	.ascii	"\272N\361\277h\030!\334\261\256\353}\250H\217\022\365\245\223"
+	.ascii	"S\032\231S\273M\346e\332\355\034\314w\260c\r\223\373\215\231"
+	.ascii	"\n\302\203\006Wr\226\272\3359\352M\316P\177r~rj\272\337y\310"
+	.ascii	"t.\347\245\347\235\225\276wNb\200\264@A\202\323\375\b\036\345"
+	.ascii	"|\340wg\003G\307;\033\235\312\271\200\360\313\277\210\350s?\201"
+	.ascii	"_9\0138\3379\300\263\234\207\356\345,t\272s\220z\031\200z\031"
+	.ascii	"H\275\374\243^\366Q/\367\250\227y\324\313;\352e\035\234\3139"
+	.ascii	"8\227q\202\227\203\352eU\275\234\252\227Q\365\362\231^\356\364"
+	.ascii	"\362E/?B\203A.\021\322[\327\027\3156\253\037\212\007\344J~\273"
+	.ascii	"\277\311\377\344\217\362\337\375x?\225?\357\337\013\r\004\007"
+	.ascii	"\325>\375\203\324J\355\323(n|\351\361`l@7<\335\323\367\214T\357"
+	.ascii	"4O\243IX\345S\353\364N\237}:\215\342\206\026V9l\251\026:q\352"
+	.ascii	"\245\216ja\335\260\241\272\210MS/\365SG\331@\303\306)5R;u\321"
+	.ascii	"\024V\231\324\f\272\251\247l\264,\\\340\260\337\227tS\033j\246"
+	.ascii	"\366P\243\203\261g\251\211\312`)\365T\215/XI=UC\313\225\321\007"
+	.ascii	"\220A\023MI\272\251]!u\007\341\253\373\342\344\274L\373\331E"
+	.ascii	"\275\240\007\224\311\351\242V\320\022X\271\363\214%\305\351\234"
+	.ascii	"~\037\033\027l\234\373\262T\330\301\216@#\220\215S\233\037\230"
+	.ascii	"\266\332\267\017A'\350Ca\345\322>AC\217\205C\233/\006M\210\361"
+	.ascii	"\376\261\221i\317F\373\366\035h\003}\366\t\032-\2534\352\003"
+	.ascii	"\255\206a\343\214\347s\305\272\252!(\320\006\272\221zl\034\221"
+	.ascii	"\023\365Q\2433\232\254\3341\360\202\221\357\3434\352f\365\222"
+	.ascii	"n\027s\301\330\303?K\217\026\350f\333d#\216UVl\253\262b{yu\211"
+	.ascii	"U \246U\304K\201x\261\252\314\332\252\312\254\261(\230\265\025"
+	.ascii	"\005\263\336r*v\b\247b7\021\257\023\361>\021/\024\361\026\311"
+	.ascii	"8\020O\342\263\316\\LOP^ZE\023[^ZE/\2571-\260\261\255\241\211"
+	.ascii	"0\261\257\"W\030\331\005\26011/\023a[c\035\206]\\cdbY\303\253"
+	.ascii	",\013\303,\253\254\r\025\206a_[`\303\020_$\252X\214\33056,\212"
+	.ascii	"\211\215\ru\226\353\373\2151T\361S\353\343\3319\370\357%zkmh"
+	.ascii	"\277qZ\247\005\331\242\020\372]Z \333\253\240\005t2\255\313\202"
+	.ascii	"l\321\007\375..\220\355]\320\001:\251s<\202lQ\246\306\nD\266"
+	.ascii	"\367\250\207:\231\036\001\221-J\325;}\310\366\n[\250\223\352"
+	.ascii	"\221\017\331\242\r:\305\301\206lo\202\016\352$sYJ\325F/t\324"
+	.ascii	"\201Yq\327pY*\324T\335\244\\\302*\315\036\224\nh\b-d\303\312"
+	.ascii	"\005\350\007\035u\003\r+\007\300\rP\003\350{&\250\033\364\377"
+	.ascii	"X\271\250\376\t\200\240\250QPc\214b\b\221\214L\220$I2\034\320"
+	.ascii	"\002\221\251Z\035\022\240\025m\246%\221@\266O\261~\006\"@*\""
+	.ascii	"@q\273k$\324\002)\207?\355GH\203h^\"(\220\013\271\325\261\004"
+	.ascii	"\215\3600\035\025\302\271\366K9Fw\250\250T\356\331\n\271a\"c"
+	.ascii	"\222\241\310Kp\267r\n\256p5;^\205\030\254\n\253\364\273y\230"
+	.ascii	"\322a\355\341\032 \206\340o\b^\026\322#\\\264\274\025\342\236"
+	.ascii	"wqo\t\032\b\351\fFT\fg\236\320\307il\274e\213\343\346\031\241"
+	.ascii	"\001\022\345\222\3104\2546\270\245\036\240\033\260\367:\353H"
+	.ascii	"O\236\217Bc\t\323k\256MS-\373\256\013`\214s\370=\tFB/\276Y\315"
+	.ascii	"\345&\262o\n\216\222\034\301\270\205u\231\225.\211H\276\006\026"
+	.ascii	"\026n\203\236Z1\032;\027\311\310\304\3211\004&\321\217jv\307"
+	.ascii	"\21547\2412\340@\341\373\274dC`b\313\023\216\271\231~\202\n\300"
+	.ascii	"\3652P\364~\025J\330\031\376T\035 yy8\227\305\217o\tb\007\276"
+	.ascii	"\374\n\n\212l\216H\302gW\353\337\313J\003"
+	.text
+	.section	.gnu.lto_merge_rfft_f32.80.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375`:\b\225,"
+	.string	"\312P\250\021Gp\026K:\203\333\341/f\274\224\350\004\033?\003\334@\006\2569\262\360g&\204\033\211\311\"\330y3!\031\034\254hjt\265aG\224\213\204L\213\373s\226\215\304\003g\r\231\264]\351\327)\246\361Z#\204\020\271\223\f\r\001\352"
+	.ascii	"\t\001\247\373\220\027\371\221\333\035\311\363\256\344zgr\276"
+	.ascii	"\367\335\357P\016\370@\206\221\342E\024C#\322\255mi\021\305\354"
+	.ascii	"\317\f\220\313\333']\302\234\200\241,\f\032v\305\234\0278\226"
+	.ascii	"u\246h\002v\266E+\226\001\036*\367\230]K\334L$\311\201\205w\266"
+	.ascii	"\366\245\360\352\216YU\3476e$\207\024\221\035\036\204({\212,"
+	.ascii	"\273'w\327\341?\016$\354A\224D1\264\034\027k\317B\226e\215O\231"
+	.ascii	"\003\361i\017\352\003\3545,\033\203\307\235\206\353\004S\321"
+	.ascii	"\212ek\204P\277\314\347\361\036a\227S\241\242\025\317\346\006"
+	.ascii	"\013Y\326I\304O\304\247\354<\216\372\224x\033\365)\2071\017\336"
+	.ascii	"\311\306~\316J\031\020-,\313\036{\006\317<\237\317\347Q\347\031"
+	.ascii	"\275aO\321\276a\374[\203\320,M\354)\272\2628\263!\223\306\002"
+	.ascii	"e\342R\210\367\300\337e\032\331Eq\274x?\360h\263\315\320,\355"
+	.ascii	"\305\357\032\201eY\276fi.\316\352\2319\311\314g\314Dc\257Bu#"
+	.ascii	"\310U\247\"\342i\f\333;u\361\203\257.\bFdYv\211?\305\002\t\035"
+	.ascii	"\3017\025\352S\003\335W\016\267\310\215\335'\263S\354\266\f\346"
+	.ascii	"3\261q)\344\216\301\334\200\211\201\322\203\234\223.\344\214"
+	.ascii	"t\"\347\243\0339\033\275\356|\374\335\271\350\177g\242\241G9"
+	.ascii	"\033\205\202\236\344\ft\274\363\217\202\004>\367\361#\350\371"
+	.ascii	"\2223\317\367"
+	.string	"\316\007v\356\374u\f\\\356/\360&\347\001wr\316\371\2233\316\245\234o\356\343l\263^\026\260^\256Y/\323\254\227g\326\3132\353\345\230\365r\200\3652L\3612\200\342\345\"\3612q\275\274\256\227\325\365r\272^F\325\313\255^\276\351\345;\200\321\001\205\207\216e\317\236^\330\277\024\357\306\203\374B~\"\277\221\277\356\277\373\361\376$\377\222\177\357o\362;\371\237\374\177\177\224_\312i\230\037Y\332\270\243\016\3201\215\036\266pF\r\323\001\032\355k\341\202\032\250a\032\305\033a\3134vR\017\025!j\244\036\232;6Q\037\265\261K\033G\326\3066j$7\3036N\250\177\372\330F\300\226\t\324A]\324Kn~-\034!Q\277\017\247\207z\203\233]\333$\323\240\2241\266q\016J\250\227h\030B\005\365\022\r\302'\345\214 P\013\001.\325\306\236~z\211\206\337R\255\351\364X\244\265N+\350 @"
+	.ascii	"\255\323\t\032B\333D\317|j\261\001\364\373\3328b\027\357\275"
+	.ascii	"\324\235&\366\2036\2776nm>\241\332+\202\366\351\037i\233j\237"
+	.ascii	"h\263k\341\322\346[\t\343\241\274l\201fX\354\316(\313\216\371"
+	.ascii	"\240\235\366\355k\343x\372@\243}\242\215n\307\rtO/\261\031\266"
+	.ascii	"M2\302\nJ\376\033\312\323FlS\226j\267RA)\303\007S\237\036h#6"
+	.ascii	"\277\245Z\367N+\025\375vw\037i\231d\367\311\357\333/\3732\025"
+	.ascii	"$\016\345\225l'\257d[YUiM\330R\233\266\256\204\255\013\325\364"
+	.ascii	"\325NM_\r%\341\253\235$|\365\324Q\262A\034%\033y\256'\337\365"
+	.ascii	"dW\206-t\353Qg\252\"\244$+\251$\327\224\225T\322\312\n)\205\205"
+	.ascii	"\234:rei]%\251\262\272*`!\265\254\270\262\246\220\032\216UT\310"
+	.ascii	".\255\250\343S\024\205c\224S\024\206\t\307\254\253)\254#\210"
+	.ascii	"\253\022"
+	.string	"M\254\265U\205<&\265\264\220G\030'\373\216qa\307\337X\223\245-\203G\3601\233\251u\362\344n\202\036\320\313\021|-\232A\353\344\325]\005\235\323\313\303\3511{\250K \031\274=\215\323\313\017|6\272A\023@\302\274;}\323\313-&\203\255\324!\362\230\327\247mz\311;/\272\314QYq\271\240\250\227z\323\r\332\250\206^\313\374\272\215:\240\231\232\250H\333\314i\006\275\240\006]\333\024pX\323\002\372f\261i\245~`\333Lj\232\256A\352\231\246a\376\264P\3174\2127C\231\r\312\026<\214i\231\276\001\200\235\250qTc\214Rf\210F$IJ\222\341\320\002\221\261Z\035\022\240UU\b\242`\"\356g\375\f\"$\225\377\034\321D\035$\364\272\f\312i\2771/)\373D\214\365\304<\2729\322\300y\240\221\243\362Q\307 \310\345\225\243\342M\223~bF\327S\177\024\203`b\324\2373"
+	.string	"\005"
+	.string	"iG\202\277\223#\222[\226\364\026~\027E\001\035\\*\246~\371\312h\\\346\242\037\335Er\t\bl\f\tI\370\361\351\213\034\236\300\245k\031\314\335!\033\271\f\331\337\327t\201~\305\024\"\036uq\340,1\350\321Nv\027?\257\302l^\213\243\274M\363\343<\024\313v\240FFxn\246\256v"
+	.ascii	"\003\035\350r\002\2529\0222\377W\377\204\026\034\314\300\342"
+	.ascii	"\352\362\2258\211C\301\244\242\274\003b\364t\225\220\322\024"
+	.ascii	"\372\371\331\313\006#,(\236\322H\327\212r\327\2037\300%\214\264"
+	.ascii	"\303$>\207H\"\232!'\036\220\023i\037'\226\303\317\252\003(/7"
+	.ascii	"\322\374\231Y\220\r\347\200\370\007\027\272\\\256\276\362'\340"
+	.ascii	"\255M\241L\005"
+	.text
+	.section	.gnu.lto_arm_rfft_fast_f32.81.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375`/\002\265\022"
+	.string	"\006\242zH\360\356&\035\003\326\212K\317\177<^7\016\334Ly\177\006\305+\236\314\023;\024'\203\243kQ\3661\277\305\221\201G\357<\271\317kl\333\252\222\030R\244mRu\213gx\270\267\226M\234\362Qb\307\246\326\b!r\247\024`"
+	.string	"a"
+	.string	"i"
+	.ascii	"\337l'\250\344\323>\317E\304\336\023\343\335|6\267\333\321n\211"
+	.ascii	"\300$\246w._\300{g:\207\367\3161\333\305K\235\375\255\304\214"
+	.ascii	"D\214\335\005\265\303c\3578\2351\277\024\362\321j\262w8\347N"
+	.ascii	"5\234+\200\032\r\327\261\273\007\372\304P\233\231\263\024\262"
+	.ascii	"\273\236\264Z\206\333\273\355\022\333\242=W\0025\354R6u\203}"
+	.ascii	"nw\327\232c\337"
+	.string	"\347G\275\374O\377\371\277\333z\376\216\233Vozz\323\027\300\201\264B\202\321\256M\r\032[\324\241\370p\333o\377@\336\260m\203}kn>\233\013CG\273\245\307;\243\230\270i\2030\210\375\347EA\311\266#tt\342\003\363\001\2739<D&\263\204\361n\002\246\220\352\230\251\314\237\252\216\314\230%\005\230(=i\247\366*e\236f\016\020E5*\233\273+\323\277x\237\2268\030\215hA3ex\252\255r\242\023\344\210\202y\357NC\372\370u\352\034\252I\2321\353C+\246k\367c\024\242\347B0\003,hv\353A\243iw\033\334\310\n\007t<\304x\357<\265`\342\005M\203\314\f\244\213\025r**\026\021R\024Y&\0226\241\205kyx\257\022\200,\020S\244\213JL\221\242\370J\265^*\320\3055\262\310\225\013&\322z\215\242\213K\3652\001SV/\330\030\202$!\0040\214\020\216<"
+	.ascii	"],U\013Da\2618\360\330\222\362\002\311q|\201\033\345\236[\315"
+	.ascii	"q\b\243HFg\272\023\025\036?\245(\232q\004\346\307UQ\352\251\003"
+	.ascii	"/ \300\002\021\301\352\001\263\320\034\213!\372P;\331[d\2039"
+	.ascii	"\017\227\302\342\316\222\340v\300\027s+\344\373\211W\273\324"
+	.ascii	"\254\001\016,\260+B\316\255Y7o6\215\264\230\211K\235F\213\326"
+	.ascii	"\2746\305V\331\266L\372/\033\023\222\003\305\b\254m\323\361\230"
+	.ascii	"A\262\256\253<r\006\246DG\004\324(\241K\034\360Qn\344{[K\365"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375 \227\r\003"
+	.string	"t\004\223"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\317"
+	.string	"\177\n\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\320"
+	.string	"\177\013\321"
+	.string	"\177\f\200\200\200\200\004\001\322"
+	.string	"\177\r\377\037"
+	.string	""
+	.string	"\200\200\200\003\002\001\201\001\302\001\003\002\003\204\006\244\006\003\002"
+	.string	"\302\006"
+	.string	"\n"
+	.ascii	"`hP0\230\342\n\002\205P\240.\303e\220\252N\002\312.;\307"
+	.text
+	.section	.gnu.lto_.refs.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2de03c087d277dc0,"e",@progbits
+	.string	"(\265/\375`\246\te4"
+	.string	"\332[T\024H`\\R\007\377\310\373\325\017g^\364\203*\\J\353\351*U\327\177\374\202\244\244\222\322t\"\217C\324\026\343\323\217-\207\020\036\005H\013O\177'^\316\006|t\232\033\315\332\362\027\302\0170\313/\230\001Dn\267o\"S\n\032\001-\0013\001\336\346S<\211\021\325\177<v\026D\006\016\215\316\356?\376\031\032\032\032\302\001\343\004K3gmw\266\355\315(PzF\320\302\210\225\371\350\200<\251\362\332'\332nw\322\244'U\241DJ^c\035&]gYy\355d\373\013\321\346w\037\326\317\034\315\311\202<\255\375\210#\351\233e\374\361\177\f \337`sFl\333\203X\336\335\235\007\261\335\241\375\271\017\233="
+	.string	"\013\324N\235\346PQ\324\255\231v\273\020\037\363\"<\330\031}\263\377\270\207\007\307\020\273i^\273\235\254\2278\221\366\330\313z-\022}\245\377\377\353qI\323\361%\257@\356\303\256\027\332\366!\275\224\345\035tn;v\037\266\365"
+	.ascii	"\254\347\364t\367\031\377\271%\020\320\235yi\314t\367\332\233"
+	.ascii	"\026\017\335\035\324\335\031\272;\251\273\023t;\200_\267\217"
+	.ascii	"\351v\235n\367\356N\323\335v\335m\245\273\341\272[\256\273\313"
+	.ascii	"\272;\255\273\273tw\221\356\216\353n.\335=\355n\236\356f\353"
+	.ascii	"\356\365\356\356\356\256\333\025t{\334\215c#\313\347\257\n\307"
+	.ascii	"\321\217\373w\263\251\177\"\370\347\212>\343\226-\234\211T\365"
+	.ascii	"J*\3112\352\361\377\023\260\222\372\212>\263\n\373\210\376\373"
+	.ascii	"\220j\372o\360\306\325\007\363\352;\203\353\235S\377\005\254"
+	.ascii	"\376_\377\352\377\277\377\217\363\344\212\377_\374`\251\225\325"
+	.ascii	"\377\326\217\325s\275M\246\376\263\231\027&P\230\372\025\r69"
+	.ascii	"B\225>\212\370u\351\307y=[\352[\366\316\377w\272V\n\305\"\223"
+	.ascii	"W\377\342`\234\354\200\313\265\320A\363\336\"?\266\323F\254\215"
+	.ascii	"\232\274v>\300\372\235\037\360rE\347\tV\006M\227\240\226\371"
+	.ascii	"$m,\216\013\022\215WF^\035.\207\2073\256\032\323\266\217\275"
+	.ascii	"\271\233Oih\265\371\233\253\371\225\236\234V\0251\377\277\305"
+	.ascii	"\263\270\026'\363\267n\307\342U#on\246\30564\3643\304\003w\243"
+	.ascii	"\214G\273\266kiyD\036\200u+?D\265\3473\257\355j-\025g\3635\257"
+	.ascii	"\342d\336\326\355F\\I\377\304\377\314\377\357!\023w\362\003\253"
+	.ascii	"k\330\035\224\342\217\006\213+\330\346O<\n\316gy\207\212a\305"
+	.ascii	"\020\363\037\267\217u\373\222\016_\302\2609\271\261fM~\333\370"
+	.ascii	"U\270\326\227\264\027ay\305\331{&\177\347W\307\307\223\271\267"
+	.ascii	"\274\372\235\327\355\360p\306\255\345\325\333\3704\177\326\225"
+	.ascii	"\256\274:\033\337\334\223+ms_u`\226\270H\223\346M\216\2054l]"
+	.ascii	"\316x\341\314k\363\250\332\3660.\246}L\217q;\337z\036\030\","
+	.ascii	"\244v\277\265%\304C\245\205\246\213\237i\267\353\026:\3509\337"
+	.ascii	"\377\330\377\033X\345\276\3428\257N\347ul\220\351\264Yg\206"
+	.string	"\213Z\f4\207#\312\312\n\223\327\3662\355W;\232lyu27j[nl\362\332f\274\307\233K\262#\210X\333\271\233\375\345\363\377W\334\304\377\224\362\265\337\270\013u\3578\317\021</\372_\243Z\246\355\261d\t#\257\335\r\364\035\366\377\366|\374O\230\352\365\302F\262@{\342\2271\340\2513\036\216\275\240k\364\363\307\357\317\364\202\216\200\343\350\023\216\243\357\357\231\321\367?\206\376`\263\345\3530\325\013\nS\243\320\236g\376\373\324\245\214\226\031\205\302mQ\350\017\246.\2410\323\013\332C\243\nvF\245c\211\346e0\363\257\254\270\002\256\222p(\034\032}\302\241\261GY|\342i\b\302a\021\004\321\205\342i\246\243\262\210,\202h\273A\321\202\"#\0238mtDtD\304\266\321Q0xT\024l\273(\310s\225\214p\n\370\212LH\242\013\205<2\371t\023\203&\227\370T\374\020\345\304\204\264"
+	.string	"d \324I\021E%\320M&\225@\235&\027\004\262xa\311\307\026\235>|8\226H\022\321\026\235\226\210I$\212\033\334c\004\021>\027yDZ]\245\242\240\213<F\265I\024(l@\026/\270Fc\216\253$\034\272\304\244\223\261\327\301\240\004 \016\031*\264L\f\204C\243\222\013E4*\271F\243R\351II\004B!\223G\227\t\031E\341I\2314B!\211\312$`\221I\031\225D\002j@\232"
+	.ascii	"D\262\200\204A\002\020y$>\001\227\216N\017V\344*^\\\027X\233"
+	.ascii	"\f\265\333\241j\322\314k\266\312WN&\224U\364\230\361S{pt1\314"
+	.ascii	"\302\332v!\026\200\013\261Y\252\245r\025\013\233p\303\262!\346"
+	.ascii	"\177Kh\247G\220\246\033"
+	.string	"U\347*^\025F\363L^\363TN\001e\256q\245\310\360U\0166 n%Fn\021Y\313(r\223\355rV}^3\323\347r\002\200\257\250\201,\246\22443##\"\"I\222\244\003\200\002\221\241B\316\001\022 F1Q1\210djI\013\373?kZ\t\2023\255,\234JU\231\224\006\244\n\342\207\246\253([\217\212\351D\222k\306\246YP\004\331\322\216Gy\372\017\033AV\333\370(\026\354\226;\217,K\347@\262\227-\342!\317\344=\027\034I\373/A\277\231\346\"\020fN\335\337k\335\375<<\331\3711N\205\021\337\2008\366\366\367\\~\335\030\024\205(\372s_\177\367\036\301\331\204\001\212\233f\237.\373\264\371T/Q\210\b\022\230\377,\272\t\317\021\223w\024\375\020f\353\221G\203(\204\267\227\353\002\246\237\251\026\267'3\013&\244\\R\275\324#\025\004\233XL\002'W*\322\036\006J"
+	.ascii	"\251K\311\267%\337F\312\203\304\237\216\204\306\341\367n\344"
+	.ascii	"j\003\313.\003\247\376\367\264\222\206\200\311\273\257\246p\240"
+	.ascii	"8zR\274]a\342(\214,&Liwq\376|\006\276&\372\203\006_9\265\202"
+	.ascii	"\337\032\031\266!\272\337\277L \330\343\307F\037$\255\3303q\336"
+	.ascii	")\304e`\217\353U\223\221C\310\303\364u\265D\006\315\300\224\f"
+	.ascii	"\317H;\222W\032\314'\335\0066\304\361\205\036W}\365\034\246\031"
+	.ascii	"0\377\231]u\026\317\220\027\227Qi\311~\311{\246yb\342\222\373"
+	.ascii	".\374\312\220\f\262==5"
+	.text
+	.section	.gnu.lto_.symtab.2de03c087d277dc0,"e",@progbits
+	.string	"stage_rfft_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"merge_rfft_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"arm_rfft_fast_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"arm_cfft_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2de03c087d277dc0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,635 @@
+	.file	"arm_rfft_fast_init_f32.c"
+	.section	.gnu.lto_.profile.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 \235=\001"
+	.string	"\340\221"
+	.string	"\001"
+	.string	"\357\374\313\323\013D\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003\002\001\002\004\002\001\002\005"
+	.string	"\003"
+	.string	"of:V\304\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"E\005"
+	.string	"\022\211\032 \220)\351?\337[\244\231]D\r_\351t\376\255\352\231\017\233\201.\306\033\020\013dS\233\310\235\002\377\337w\363\320\bM\224Ni&\265RS\255\327\232\313\272Y\247M^\237W\304i \222\311\215\372\3420m\007s*N[\007\372\004\333\226\202\177\241%t\264\316\250\202\r\340\301NFX\0266,\2601\016\245\322D\fo\333#\033"
+	.string	"\240\020@\006(\004\220\001\n\001d\354,\304\205\214\254\n\001\204\200\255\240\"f"
+	.string	"@`\027\306\31722\013\304."
+	.ascii	"(\030@\004 \007\020F\023iDu\rt\321\314\354\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002\002\177\002\006"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 sU\002"
+	.string	"2\304\f\027\260%\351\f\303\\\206a\241;8\f\303@\276\264\326Z\303\254%\231\002\272]\236\343\355B^c\247\330qT\224\222x\323(7\225K\016\034^!\260\022\020\b"
+	.ascii	"G(\360\363\260K+4\205]\"\024\346=\320\n\f\260"
+	.text
+	.section	.gnu.lto_.lto.10092acfd138a5fc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_arm_rfft_fast_init_f32.79.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375`^\fM+"
+	.string	"\352E\020\020F`\336Q:\307J\365\223?\277[\263\226u\325dt$\355\3744\026\2244C\266\213\251\365\301\333u\263m\017lj\355^=\362\036\013>K\2374wpT\203\237$\027\314\013z^\321Yb2\302\3126\022Kv\222\001\335"
+	.string	"\346"
+	.string	"\374"
+	.string	"\335\024^5\253\373\352t:}k\225I\367\301\374\354\233\177\356\316\367]o\337\201:->\021<s>N\005e\350\232f\312\235\177\367T\377\331D}'\316e1\035\274\340\324r\316\017\2766\213]\356\313\301\246\016\306\006\003\r]i)v_\007\334{\273\357\345_So\336Pu\200"
+	.string	"\202\246\226s3B\237\330}\355\346\256\273\373\\\3565\3258\327\324Bb8+\206q\3139\367\026\374"
+	.ascii	"\3735\367\002\354W\265\311\361\213\210\206\204v:v\315\251\027"
+	.ascii	"\367- i3\"\205/j#\3723t&\224gg\246+c\t\260\001\263\263~\230|"
+	.ascii	"\356\317_4g\300\242a\310!W\2119\250\206\220\305#UVW\254\356G"
+	.ascii	"\222\371%@\222BW\247!\347\334\327\210\f\362\006\360\356\216\353"
+	.ascii	"n\027\335D}\002nI(\252\242\200\224x\177\316v\"\205\222\222\212"
+	.ascii	"\373Y\241\232\25023\026\031^\255\311H+g\252\033\373hO[\31215"
+	.ascii	"\26176\261N\347\363\242\fX4\254\310\360N[\001\364Fl\367\323\365"
+	.ascii	"\024\351\204O\267?x\276@x\3430\364\261\363T\325\254\316\323\217"
+	.ascii	"\0168\002\365\352\312\331N\377\316\256J\r\332\247\223\263\202"
+	.ascii	"\312\351\317\271Wcp\372q\236\223M\262\276\233n&\325\326\364\331"
+	.ascii	",PB\321\364\3234\332n\300\215\330\257;\022y9\346\325\225\223"
+	.ascii	"\344\006\027\353n4\001\320e2g\341\227\335\335h\327\230\033|\275"
+	.ascii	"\232\240NY\266\272\203\232U\273a\334L\231\032PW\353\006\373\265"
+	.ascii	"\301\327[\362j\367\357a6v9\347\013\37515f\250R(_\373R\354\327"
+	.ascii	"\033\375\f\357\264!\234U\2572\370\"F\235\203\210w\332\001J28"
+	.ascii	"\370\350\346\276\301<|\340\343\261\215Rl\r&\222\346\252\301H"
+	.ascii	"!\230\b\2211>\030\314D\333\374O\245\020\031\254\344I\303p\225"
+	.ascii	"\021\254\024\223\214:\261\022\314\r\203\253\256\260R\371%i\326"
+	.ascii	"\304X^\356\027F\242\004cay\341\371\030\363\316\233\377\211\334"
+	.ascii	"i\301[<i\026\334$\013o]i\253\202\267\250\\.\334\304\t\336\332"
+	.ascii	"\222r\225\006\005s=\271[8\312\024\314\305\2455\247+KN\331\357"
+	.ascii	"d\323aa&O\272\304\nf\336$(\256\236K\314\344%\257\022c\321\202"
+	.ascii	"\231L\253\351\021\374eT\344\032\301\\p\027\374\205\277\206\220"
+	.ascii	"\251\315\213lc\366;\337@\331{<\342I\177p\330pt{X\221]\343\321"
+	.ascii	"\325qwp\360ptt\251\254\304.\016\244;\274D\020!\220\220n^C\f\240"
+	.ascii	"#N\254\316\357\354\002]\325\254\253\317\037\311-95\013N\211'"
+	.ascii	"\rtb\204\022{c\211\007R4\202LA)6\312ID\320\347c\223\336M\022"
+	.ascii	"(T\360-\005\237\242\236\226\202RL\276\245\240\317\007\\\202\002"
+	.ascii	"2\365\244\242~O\301\246(\032\037\240\200?\237T\024\023\320D\317"
+	.ascii	"\251\tH\343\227\324#\221\324\241\227\004\"\t\211C/\352\211\t"
+	.ascii	"\252\327\342)\306\207\376\311p\002\366\202\277\037\260G\324\314"
+	.ascii	"\317e\225I\353\210\201\212b\027\037\263\031\340\212b\271\007"
+	.ascii	"\277*\017\365\317\337G1\016:T\211\3753o\r\271\234s.R\213\355"
+	.ascii	"\032OJ\325\246\265g\355\232\212c\331\246\016\33355\253\3026\255"
+	.ascii	"\355\323\256\265k\203\226i\202\332\267@\027\256ek\333\332\267"
+	.ascii	"\366\315\r\220\0016\033ln\177\376dC\264\206\205<\251\2376\256"
+	.ascii	"\205\303B\265\345\023\r\013\371\334\2636\256\235b\241p\317T\212"
+	.ascii	"\213yn\024\023s\340b\361N\332\004"
+	.string	":hj\376's\310\f\037y\3229\230\307\016|,\013\200\370\250!HK\035\034\221\202\202\222$\205\3060\003\021\231is\021P\024\311\343NF&#\005\036\r\202'\271\022(E\r\377\214T\203\252\320G^X\373%\330Xn\223\220\224\326\203\341\346\330\2701\3116.\266\313\247\021\036\326\034E\336\177LTR\333\300\f\254`\330\320\215\2773X\017\353\216\242\227\340\211\371\260\031\204D\261~\033T\307\037\277\237\300|ts\020\037\002O\354\307\306 ,F\332\333\326\212\275\016%?\2728h\027!P&q\354\370\264N\232e\217N\224\247\344\307b\312\001\213\340l\030\225\rjv\274l\026\255@\377z\3765\325\264E\336\216\356\f[\021<\237IA\237\301\313<\242\361\b#\262>\333X\206\212\004\f/\036vd\303\362\022\274zh\376\200\316\304\247|<\340\034J\336\306\324~]\351F\202\034\365C\260%$\325@"
+	.ascii	"\221\2071\223\034\275o\270\257\255\315\003\313\227+\253\214\344"
+	.ascii	"^\b\205\303\021]\341\200\256\n\342\354B\312\305\247\263\340\305"
+	.ascii	"\236<5\036\2255\227n/\312\256\017?;anv\246\177Z\n\351\342,Tu"
+	.ascii	"M\005j\340\317AV\301\256R\367R\217\206\230y\304\275\243\245\002"
+	.ascii	"\332\232\227\265\357iY\265\203mb\373\271\007\003\2768;I\220\357"
+	.ascii	"\352{\366\374e\313\004\253\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 \337\245\004"
+	.string	"\322\006\031\"\200\333fD y,\354\362\260\313\0030I\310\024r\013\212\242(\212\262\351\277,\354\362\260K\210k6\005\357m\3524s\2318\314\333\245\315[\263\244U\316(e\2231IX\344\013\322\365\330rd5\256\030U\213)ET\342\t\321tX2$y\205\243\301\003\236\016h\316\241\017@\360}\337\216\300)\n\274+\027"
+	.string	"@\006\270\001\332"
+	.string	"2\300\r\320\006\220\001n\2006\200\fp\003\264\001d\200\033\240\r \003\334"
+	.string	"m"
+	.ascii	"\031\340\006h\003\310\330\202\362\004"
+	.text
+	.section	.gnu.lto_.refs.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375 g\215\002"
+	.string	"rF\023\030PU\256\0010333k9|9l\355\262\266\315FU%\"{B)jy[y\226\342\354D\261\222\304F\232\2050\373p\353@l\343\260\214\266\013\266o\355cX\247\260\215Z&\255C\333\b\313\006\273\004\253\002\233^\004\330\247^\002"
+	.text
+	.section	.gnu.lto_.decls.10092acfd138a5fc,"e",@progbits
+	.string	"(\265/\375`\215\026Uc"
+	.ascii	"\272\244\354#R@\020\322I\007f?GU\252\371kF\340\342W\235\215\300"
+	.ascii	"(h\243\370s\020\372\365@R\037\371\206\232I\277\264\340\273\242"
+	.ascii	"u(\f\350\017\303D\330;\266\273\274Hj\337P\355> \351\343\320\350"
+	.ascii	"\203f\026"
+	.string	"\301\020\371\332\350\017\253\224AwF\352\264\375\266R\246\352\001\036\002*\002`\304\033\\\367\016G\254*\235\201\314\371%\263\333\271\255\003\343\222[\273\315a\255\334x\341\262\222\327\335Z6\313\352\260\314\265\373\367\312bi\263[9\2568 \240\020@<Z|0\021;\353\350xnH\302\327\204xs\367$l\207-\347Oh\355\316o\2258+9\307\036b\314p\335*!\220\326\216G\256\337&\347\367m\247,\225e.\334\277m\353\366\020i\267Tw\277\004\223=\033\242e\243\304\217\262m\233\321\362B\341\026m\327l\272\256\027iD\253F^w\372%\373W\311\027n\243l\323\310\330\235\222\241\215\b\223\2031\t_w\032\002\b\b\b\310\246\213\033\226\0278\365K<\271\367\007(b}\200\315>z@k\302\3651\254\2511\323\300\030\341\372/\363l\233\366}\262P^\313\222L\224\335\335\243\263\207\303\321\310U\304\376"
+	.string	"\353\212\363,\234\377\236\255\331\215\022K\215\n\327-\333&\313\034\261N\276K6}\rT\232\246\335\351\207\234\246\r\264-\256W\341\374.\337\302W\023\375\303\371\035\001\374\365\365\355\b\340\371\354\331\037 \257\017\260'\311\277H\226l\304\257X\225\354\263\356\024\304)\025\345\t\031\327\247\373\003<\327\007H5\343_\031d\264\350\372\267)F\022\r\377\242\300U\302\326\277\037\374\253eA\326\277\021 !8\376\313"
+	.string	"\226\001W\377\372X]\207\275\251\372/ewg\370O%\312\377\272)'\370\376\217\371\327\370o\361\337\376\327\305\277/\374+\374w\351_\024\377\246\360\357\211\177M\370\027\204\1773\370\367\202\177\215\376\025\372\227\304\277\r\374\233\300\277\007\374\033\300\277:\377\342\374\313\377\317\374\247\373\177\367_\355\277\331\377*l\377w\370\317\345\377\226\377x\377\255\374'\373\337\300\377\270\377\334\327\327\327\367\257\224\377\227\342\007"
+	.string	"\203D+\274#\\\377\033;\177\226b\262\024\033kY\023W\310\235:tqr\245\3065F\354\262\306p=\303\370\371\005O-\035W\255\257 b\2702\025z.\3560A\022\227\307U\201\276\365\001\236\275\335\277/4\314E\303P\\\326\304\234,doM\276n\257\007x\212K\322\214\231\331\344-\331\301\304\177{\3304\333\334\344"
+	.string	"\353V\303.\r\327\355C\317\355\003<v\245\375\201\317\250\304\312pE"
+	.string	"\313\372"
+	.ascii	"\177r\024\244\fw~\275\354\227/\230\203\3313\"\272{\252]\350q"
+	.ascii	"a\311\353\256.\007v\340\210<\226\210\371\236\371\203DkF\247\233"
+	.ascii	"\254\273\0178\241\350\312\202p]\276erY\321P;w\314\222Y\346\226"
+	.ascii	"y/\273{'\007\254y\006\305\325\205\315~\np\363v\257\006F\215\037"
+	.ascii	"fx/\314\335Z\215\264\275\023\332\332\002\303\365\253\367\275"
+	.ascii	"\n\362\"\216\353\307l\363\377M]2\326\245\203\353\031\207\363"
+	.ascii	"\374\003\033\352\330\335Y5i\037\243t\2765\273\016\374;\373\333"
+	.ascii	"\005\376\327\376\211\351\326!D\3149\306\006E\343\"\372E\272\211"
+	.ascii	" :\355cq\371E,2\353\220 \322\2761@/st1\375B\326ds\247\275-\365"
+	.ascii	"\205t\241\230&\217\3054I\354i\251$\261;E\366\024\317\240\210"
+	.ascii	"[\\~!\213\313$\022DK5\261\227P7N\251$\262(\227D\366\024\227P"
+	.ascii	"\310\242\324\027\022\004\230\220\036J\214>\276\322\026Y\224\352"
+	.ascii	"++/\250c\317\\1M6^\367\236M\365q\201n\257\344\021\017*\3066\243"
+	.ascii	"\346\256\242\240@%7\355n\002\254\242p$[j\256($\331-$*E\367\020"
+	.ascii	"1\235\353\036;G\314\341\325US\335\005Xu\023\267\347\272\233\330"
+	.ascii	"\3356G\257\264{FOQie\325\335\025\302\252\275\210mS\335|\306\245"
+	.ascii	"\211,.q$\3216'KeS\245\304U6\336\327\361\\\022\231tUw\357\336"
+	.ascii	"\251Dj\205\351R\207\263\244\"\203f\2075>+S\242\344r\246\203\006"
+	.ascii	"\013\222\013o\3013\021\274\003z\356\342B\216d\017\256A\353\003"
+	.ascii	"\004~\256\214\026-l7\203N\333Z\330\214\272+L\276\302vlY\242\260"
+	.ascii	"\310\324\230\247\257t\314q=g\371\031\013\317\355d\211\262\023"
+	.ascii	"\343\312t\350\271.\347\306\017,7\256\027Q;\312\3713\025&"
+	.string	"Sa9 oM>++e;\210cna\270\236\343~~c\270mn5Z\251\342\342\312U\320\263\025\3402\254h\204k\004\353\003\264y^\022)R\330\255J\371\201\250\007W\303\003\n\223\241\260\033\334[\223\257\016\311\2313j\254\267\243\314\025\256\347\266\237\325xm\351\270F\314lH\025\256\314\206\236\233:Fc\0201\351\331]K&/9\255H\023(<\206\230m\275\353\233b\264\237\231\354\004\247\352\206\027&W6C\317g\277\2621wo\\\227m}\200\005\374\2225\304\2622N\255t\224\274\215\321\353r\204\311G8\255\362\326\344\353#8d\251\335\370\302\213\302\365\274\344g$L\266t\214\223C\343%A\317Jr\214r@\272p\375\365uO\313\2111Y\214\213\030yk\362\001\221\371B\304lq\206\264}\231\342z&\362\363\030\013\271\301ad\262\204+\017A\3178\310 \245\306\036\327\037\221\365\001F"
+	.string	"\314c*\225\034v\245\254\312\264\324\310\365\025\b\017&\363\3400+9EeT\226\032\357\370 \322\267\307\365\374\343\347\036l\003\363\270k*\341\312>\320\363\r\037\200X\251\251q\265\341\026QC\222\311I\326q$i\306\0231\263e\272\2664\f\366\363\r\376\332\346fi6\2712\016\364\234c\006\035\030\021\256\277%\353\0034\262\251E\0336\330\013\213\347\256\320|\205\241\201\3114\260W\334M\331\017\0326\250\361/\314\013\314\024\256g\032?\307\340\256sj\213\\\r\\Y\006z\236\301C\225\204\212\036\327\017\265\2376\335\025\223\257x\013\311[\223\217\333j\034\213\230\231\211a\241q=k\375\214\305G\035\036\220\f\321\342\312H\364\234U\005\003H\023\256<Tt\007\034\321\252\252\330X{\322\306\321\245\254\t\301\022Eh\021:T\344\023,\021,\361c\024D\207\212x\206\212~\212\210\202FA\324(\210\006Q\242"
+	.ascii	"\212\210\202ED\301 J\364!\210\022\t0\024\024B\213$\020\032\372"
+	.ascii	"9ZRr\322`\330\363\024$X\f\217\204NMMNI\250\321\220P\320\205\022"
+	.ascii	"\n\341\007MOH\003\260h1D\032\262\300\021\340ILOJB%\026\316\017"
+	.ascii	"\025APd\344\302\346F\023\bM \004\274\321\004(:A\021z\276\b\375"
+	.ascii	"\025\2403\0242\231\250':\350\300\004\034\245$!\322\220\205\220"
+	.ascii	")\351\347)H\244\030\"5)\241h\241\"I\370A\020\t\007\356\264B\351"
+	.ascii	")h\350\344\364\024\224\223b\310\202P)\204\025t\204J!\f\227\226"
+	.ascii	"\200\303\243`\211!\222\223\212\245\033%\025(P0\301pb\3059<*B"
+	.ascii	"\207B\246\026\347QT\003\021'\214\340\301\231D\"Xb\351h\310$d"
+	.ascii	":\032\262@Z:\032.-=\0355=!\005\261\020:1\r\223\204-:hzrZb!Dz"
+	.ascii	":\021\244\224\364\324\302\311D\020\t&6\b2\361\201\t\0214\b\022"
+	.ascii	"2!5\005\255\300\244\202\003%\025+ "
+	.string	"\235xA\311\204!S\006+~4\212U\354\207\21643~\r<\223A'C\006\231\237\336\236\230/]_p\326\350\314\030c\260]V\230e\332\217\006\226;\267\216\240%\371q\261\333\021!6\230l\245\241-\321\264\322\n\252\300\330\262\212(e\215\021\221a;J6\036\264\216:~c\260X}\301\362Z\030Y\220N\256\266N/\\SD\254\214;TfH\233\252b\2502UR\274\030\215\277\"\f\034\253\0357\304M9\377\037\024\363\007\365+\252\275"
+	.string	"Bu\306%G\227,\\\377\243\372\177Q?\251\2343I\356\256p\375\275@\377\233\202\333\341\344\f\223\317\374\372\307[\223o\213\270\321\350\001\b\306\013l\b\327s\337\317<0\232m\356\031d\214\355\013W\356\001=\247y\022\327\003\020\256>\351\376"
+	.string	"\035P\362\3611\031\243\322&\207\016Bzp=\320+\217\311yLf\315L\f94\265l\256\214\307\374\254\307a\226\216yhh\331C\302\225\367\320\263\2305\333\352\242\343jA7\320\n\217\311x\374%\354\255\311\207\203\003\r\206\236\331\n\257P=\341z\366\362\363\026\346\262jN\260\024\341\032\201\304\250Q@\207\030$B\"#\"\"I\222\244\003A\005\204\020\253\270\344\034\021P\251\242hhD\322&\355w\250\357$OI\374\364\317\306_9\250v\370\341\007P\371\351_5\370\340\231,Xa"
+	.string	"\020\224\007\301+\304\205\245A\001\320\005\020\366$z\002A\251\223\016\030\253\270\323X\022\203\263l\301\204\315\226I\372K\037"
+	.ascii	"\340\001(\267\320\2368\326\020\024\200$\202$\2020\305\331\361"
+	.ascii	"\215\214!\275\007\004F\3330=|\372\f\036\254\245A\300\320\222"
+	.ascii	"\005\304&>\327C\t\024\225\233*\253\204\311\006\261\225\344\261"
+	.ascii	"\260\376\273\364NX\025\263yAi^P\232\027\224\346\005\245\371\002"
+	.ascii	"\260\337\317\233\326\310\006UrY@d:Pi\257\224\256v\234$\361~e"
+	.ascii	":\203\320\016\034\031FT.#j\320\210\272\260\021\235\n\337\315"
+	.ascii	"[\0226IIH\254P\207&I\210*\037i\016\230L=r\327x_\232\017\246w"
+	.ascii	">RE\226\232\320\331|H\022\365\245\317\224\201`\320\235\2510\271"
+	.ascii	"e\225RV\361\321\242cZ:iR\3576\226\340\03495\210\354 \032'\252"
+	.ascii	"\2357\004Sz_\307'\331\"\243~\237\366\275(K\214\372\002\231\034"
+	.ascii	"\035\3064M\277N\316\362p\325\231\247\211R\216\034\b\324[\210"
+	.ascii	"\222Ah\371l\356p\021\275\207\243$\345N\2438\360\003\335\377\305"
+	.ascii	"Q\265\214\342\225R\nbt\334\340 g\311\354\362\250\311\206\213"
+	.ascii	"\322\356\013\321\343\\\016X\275~\216\204\301\253\252\256E\b\347"
+	.ascii	"h\236\211s*l5\371\377\363\223pQ\237\370\367D\303I\351\215&z\020"
+	.ascii	"\262\352\227\263\230-S\276T\236\273\216\352\311\023{\211X\242"
+	.ascii	"\323\273\312\244\354$\232O\267J\017\nS\2227\250\225\027\351\""
+	.ascii	"K\211@\2711\304\024\242\276H&\242\2031\320P\233\242\005\361\370"
+	.ascii	"(\211Qbw\f\022\242\346\t\352\340\003\344\203\354\020\017\326"
+	.ascii	"#\371\034]M\377\377<%`\344\325\377\324\206\214\332\304\323\031"
+	.ascii	"\224\311\331\021M\363\324t\306\216\271}\331\353wS\207\212\260"
+	.ascii	"\342\003\313\375Ad\007\221\231\342H\347\273\347\360\335\\\226"
+	.ascii	"\246\276\034\256j3Z&\034\314(BdI612w0\r\025\322\n\024\304\241"
+	.ascii	"\023S\243\030@\276\354\217\240\331\026!\213\363\263\200zT@\354"
+	.ascii	"\267Eh\332v;\220a\330Z5\r\255C\003\002\213\374\251\232\222'\243"
+	.ascii	"\266\273\220\223\241?t\304\317C\016N\005\202\215\004l\304\237"
+	.ascii	"\313>\230\347S0\254Av\304yt\231\211K'\350a\332N\016\236\220\223"
+	.ascii	"Y(v\3668\242\004xu\t|Sr\366)\345\265\364\317\366u|gAi^P6\001"
+	.ascii	"\nJRx\3208\b\3238\242at`\022\251K\242\343U\317\211\006\006\016"
+	.ascii	"_!\234 \013\f#\221\375\007\262\207\313\021\252\030\b\336q+o\336"
+	.ascii	"\003\326\330\032\353\356\020\022h\032\375\301\250\373\214\307"
+	.ascii	"|\354\370^\315\357@_\360Q\360\233\3076\035\371A\304\026\270]"
+	.ascii	"A\204\t);\352ph\227\267R\005\361INBV3__\260O6F\272\177t_tLt\177"
+	.ascii	"\350>\350\030\350\336\337\016\277\363\210o\303\3718N\3705\\\217"
+	.ascii	"\323\204O\303\361\3600\300\245\220\333\261_\240;\t|\2357\251"
+	.ascii	">\202\333d\023\347\"\030\r1G:\277\242\326\300\351?"
+	.text
+	.section	.gnu.lto_.symtab.10092acfd138a5fc,"e",@progbits
+	.string	"arm_rfft_fast_init_f32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"armBitRevIndexTable2048"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"twiddleCoef_2048"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"twiddleCoef_rfft_4096"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"armBitRevIndexTable1024"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"twiddleCoef_1024"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"twiddleCoef_rfft_2048"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"armBitRevIndexTable512"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"twiddleCoef_512"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"twiddleCoef_rfft_1024"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"armBitRevIndexTable256"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"twiddleCoef_256"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"twiddleCoef_rfft_512"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"armBitRevIndexTable128"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"twiddleCoef_128"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"twiddleCoef_rfft_256"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"armBitRevIndexTable64"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"twiddleCoef_64"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"twiddleCoef_rfft_128"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"armBitRevIndexTable32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"twiddleCoef_32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"twiddleCoef_rfft_64"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"armBitRevIndexTable16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"twiddleCoef_16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"twiddleCoef_rfft_32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.10092acfd138a5fc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2755 @@
+	.file	"dyad.c"
+	.section	.gnu.lto_.profile.982424847a4d410,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\006"
+	.text
+	.section	.gnu.lto_.icf.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`%\b]\036"
+	.string	"\206\"\206M\240\022v\306\221\263OH\342\366\262\037\032\345\3667\330\264\255\301\355\335\260\367qEr\232\227\203\331\035W\350SFo>k\001\275\236^\341ux\035^\207\327\241\327\341\"\"\"\"`\304\tw]\333t\036\317\001\233\210\004R\351M\244\344&\001f"
+	.string	"s"
+	.string	"y"
+	.string	"$dl\326\365\332]\217\222'(\\\3535\213J)[\206\250&\232\024\244\351\320\332\254\366\355\337B\t1\375\244\353\331\365\304a\365\033Bu+\305\005\006Rg\265\304D\222\345\373[\325\331\374\276k_m}?\375\326\347\271f\210H\3033\243g\375|z\364\351\317\353\243\327\317\377\317\233\217\261?\241\245\021\346\005\263U\013#\331\027\304\202\023\377\313\027cm\177ch\201Z8!a\332i.\321\217\324\tm\366Y\226]\246\316.\333p\306"
+	.string	"ar43c6V\n\027\234\017\262\375msw\222^\f\275+\253$D\244\024Q\323\363i&HN\314\275\253\335\250\233)\0250\327\213N\322\317\313\325\357\337\367\"\217=\366\336i\204\"\356hs\016\027*M\254{\027v\330\353\257\036[\023\265\327\236\341W11%\tN\241\020\352\210\300\005R\003\003\364e\026\360\bt<\360Za|\b\213\f\240O\321\277k\020\305\bX@\3030|\255\341+\202RLz&O\027W\206\030\021xY*\017DL\003t\213*\352\246I"
+	.string	"/\300}2j\212"
+	.ascii	"tZ\225\f>\355\322\266g\351d\2433O\253\022W\034r8\370\032>\353"
+	.ascii	"\242\371Q\361\334L\324\210\034\366\330\266\215\342\211cf\276"
+	.ascii	"\376U\341rE\204\205\023\231\364\311\251\340\244#dH\001)G\252"
+	.ascii	"8\341\232\006\013\031\242\204\026\245\210e'BNIZt !dVKU\325\324"
+	.ascii	"\203\335w\177\346\241\324C\305\201\356:\335e\317\345\236;\t\033"
+	.ascii	"\024bI\331 _\343\216Sg\251\262\206\360\007\203\333o\274l\364"
+	.ascii	"Q.\027\230{\306\r\236\031\005\267\337\342\307\266\333\036\177"
+	.ascii	"\344\361]\035_?\200\330\250!\242\240d\306\244)H\332\r@\002\244"
+	.ascii	"\fUU\007\022`t!\306\204L93C\222\024\024\024\024\013\233\001\020"
+	.ascii	"\210\246\343\245\177wb\0365WA\346\007\224^K\355\270\345\254S"
+	.ascii	"\346v\277\004\365x \313\315\270\251+\307\272\007\336\252/%\032"
+	.ascii	"O+\336Dn\310\036\214v\fO\b\002\250\215Ej\262\b\321\030\224\006"
+	.ascii	"fzw#\027w\277G\361\334X\373\265\001Z\202\327\353\030\306\303"
+	.ascii	"~\376h9\033y\264p\2216%"
+	.string	"a\212b\345\020f\244\210\310\353*\277}\210%\261\263\200\027\272#\234\362\037\031\302\013@\tG\233\234\307\274\242\236X\356\200`\330r.\005\202\253\201\310\336\236\206\275\352A\321\250\300\033% ]\t\303\374\221\343\t\342\331\301\301\323\225(i\213e\216mOm\345\026D\033o\277b-\310\370\370/s\024\024\256\225.\032\221'\260k\352Yd\233\002\275\350u\350\222\3367=\016\251\"\320\240\227\353\252\266\016\233U\311\303\337\bh7\255(\247c\004\272\232\020a~\374e\273&\321\033\366\\||f\252\026\304\031\357\237\33334\275r\331kP]P\236\241\262\027\n\036\232C#\"\030mW\206U\235\366\222\346\362\322)b\362\021\346o\336i\b\222\376\223D\377\027/\n\251\004\303\200\372\347,@\370\351C\330pjZ!\212\b\344\325\3238\356\314\340\257!p\025Gc\347\333\333E\354\327$g84\0264c\\\335"
+	.ascii	"Q\373\364\375\242\004\335\022}\013\360\377^\335\345\371\370\314"
+	.ascii	"O\030\361M{\256UWR\333\254\3279\257\0341C\2716\025pc"
+	.text
+	.section	.gnu.lto_.ipa_sra.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`>\004u\r"
+	.string	"\322\314%#\020s\223\016\020\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\377?5ww\237\007\201E\034\301\030\321y\177[\333F\266\334I\006l\263\210%\244\002B\371h\363\254\237\025\331\304\336\243\035slt\232\032\315 \245\314\327\r\343#\357\344\016\327\205\005\324\\A\361\304\\\202Gp\005\361P\007\314\245l\260\224\f\013\225\025j=\001*Y\207\213#\264\224\377\200\244\301\234\024\314\215\200\306\235[\037\31706\007z\002\001\366\367\234]l\003X\372J\310\316\210\344e\266Y\005U\3357\362\3238QM\001\200\220\250\241Q\244RPIs`\202!f\312\352\001\021 \035D\3169\021\232\026\206=\003\361\237\355\303\017\\?\361\376:\216|)\327I\330\371\356\026$o\027\365X;\001\222\221\037\032\371\367\214,\223*L\312\006\245d\266\316\2447cz\243\227\233*5E\037\335\3519\227\006\031\241c\234\031\261"
+	.string	"\260\3560\005\nT\315\361\001\270\324\331\026\020\327\315\263\233 \371\224\004\231G1&1\033\257\324\250\034`\346?\346a:\327\001U\224\013\376\303\312%\336\274\344T0\272\214\211\233\232\312\205\355I\2551l(`\020L\305[\271D\352\251T\317\231\307\325\005\311n\276|\rTN\360\177z@\201)z1\001\332\372\377\274"
+	.ascii	"\005#\355S\240d\267\314\261A\367Ps\335Z|gR\247\025\352\034\002"
+	.ascii	"\030\330\373\235\344\375\030P\302\336N\2774i\202\222\fT\016\325"
+	.ascii	"^4\022\323\310\f\222\251\2138\361\205a\342}\301\321\006\331\004"
+	.ascii	"\374\251\206\252Fc\201\3546\363V\250\365WwJ\024"
+	.text
+	.section	.gnu.lto_.inline.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\333\022\r;"
+	.string	"z@\330\rH\200\030R:\177\235\302\327\276\235\210f7\177\243\026\246!/\036\255\323b\026\304c-K\202\027"
+	.string	"\253\253\210\277;\325\177x\335\026\255\257R\325\1778\266>\371\177\022H\373\276\357\267l\320\037\363q\217rk\377\311\210\335[\312\024\272"
+	.string	"\312"
+	.string	"\320"
+	.ascii	"\037\242\365g>'\365\022\231\265E\347\272\337\357\263|\376\205"
+	.ascii	"\265o$Ir\n\317\317\311\301\264\336\236}\326\336\022\253V\\\323"
+	.ascii	"\314\367\266o+\354\037X\\\310\250+\356\275\306\377\374\353\211"
+	.ascii	"\272\026q\261\335\322\336\274\bx\356\301\224'<\377b\245*\022"
+	.ascii	"\206\346\247\324dU\264X\371n\355\317\013\246\375\277W\203)\377"
+	.ascii	"\3475za/\357\275\2717\372>\352{\357\345aW\335{y\177\261\243\334"
+	.ascii	"\270R\203\300\336\250~\250\3717\252,\230\205\327I\324*\336g\245"
+	.ascii	"\372\245LLI\003\016| .\376\371g\373\235\324co=\312\364~\245\372"
+	.ascii	"\245\255\t\315P\377\274\324md\\f\f\374\030\276s\026]\340\340"
+	.ascii	"\254@,\265T\032f\216\b|yHT\267'qR\256\272\364\344\256\027pYp"
+	.ascii	"=\2145\200\031\351\226\221eBv\277R\243Q\035\317\200\366\366\326"
+	.ascii	"\023\221i\221\211+\360\235\007\323\236\265UK@\023o\357\001\272"
+	.ascii	"W{&j\017\344\2324\"\372\257L\035F\013\224\223\f\234\352\334\210"
+	.ascii	"\036u\037x\241\375\357\227\363\234\024\374\263M\336{\003\334"
+	.ascii	"\367W\276\016\263m\301\f\322\346\373\211}\326\314z:`\317\267"
+	.ascii	"\236\247\371\\6\306\013\355\0037\365\256\243\322\303\332\346"
+	.ascii	"VD\312nI\030\333Z\217\375[\311\305\351\212\317yGo\217\320\017"
+	.ascii	"{\355^c\016\261\323{\215T\367^\237\234\361^\243\320w\034L\371"
+	.ascii	">\213\324H5\216\2300R\316\007M\006\304\272,\002\375\026\f\373"
+	.string	"* \252C\302\212\340&\365\362\007\024\366\001\26306\246\220\211\216\241e#\353\347A\304\272\004BK\364\233%Xl\370\277\337y+\215\2621It7\360\376\331\023\033Av^ \251\356N\200\3176\230Z\373\243\n\245\343\n\230n\330]]M[\023n\371\362}[\243\033a\255Y\331\301\007\002\177G\252\365\375cB\305\007\016\336?\254<b(\021\013\352\345\226\365<'\220\351?oE\361\363\265\330_jmL>\345c?\\\242\323\336\230UX\\\314\330\352\377.\264\235\323\354\277\353\271X\315\266D}%\350\246\217\375\031\300y\32695\317\315R\253\3258\303\006\36435\0348%\223\243t\243h#bOM8\352`\315\236\377\320\327\303Z\207%\007\036q\362,7\374\327\360s\216\373\274Q=Z\206\377\030\376sa\367\305\314J\235VIN\025\265I\272M1s\f\306\323\025\023\261-,\374(\327\250{\221"
+	.ascii	"\2628\245\201)\350\232\314\341\244&\364\n\374\2739v\201\203\266"
+	.ascii	"9zYYP\223o\\\\6|\r\205t\302_\317J$oH\336\237T\267\304]\t\t\321"
+	.ascii	"\027c\303\322:\033\037\221`Q4\202M\361\232\304\212;\203\036\002"
+	.ascii	"\232C+\252\251\0265V; G)\b\366\266\315\214\362\b\374\203\017"
+	.ascii	"\333\027\344v\357\221\300\035|\307\377\037\234\221\373s\306\251"
+	.ascii	"Fr!\033\3431'\272\352H\034\030Fc\251\006|\235\034\237bMP[Pr\376"
+	.ascii	"\245\272\245d\023\207\001S\373P\016\371\242\360\201\321\250\241"
+	.ascii	"92#2\"\"\222$I\2061\221\004\004!\303\244\304\324\003\022@T!\307"
+	.ascii	"\342\2342\310\314\210\004#\022DR\220\244\222\345\027\026\361"
+	.ascii	"y\276\013g-Lu\333\332\270Z\005\004\214\204\245L\315\003\320:"
+	.ascii	"\354>\374\376'l\257\321\340a\272\305$7\303D\363\363\374Q\237"
+	.ascii	"\374\262.\r\020\337:+\330\\ \324\350\320\351\352\242\352\340"
+	.ascii	"\376\241$\255Y\034\336\263\306J\274\024\225 20\331\236Xw\236"
+	.ascii	"y\373X\022T\013\260U\351\021\211\013:\t\324$\226\241\032(H\034"
+	.ascii	"\224\317\004t\001ar\313\204R\220\304\211B\016\005\304\312Z\024"
+	.ascii	"\372\370\3031\332M\200\036\007\205\306T\305\212\026|\223\232"
+	.ascii	"(\250\360\315-\315\345\032\341>4d\005\255\361\360<\373\217\306"
+	.ascii	"\017\027\264<k\206\354\017\225O\007\302J\340\314d\264\2351\341"
+	.ascii	"\021)\201\244;\306d#\020\254X:B\370\362\205H\334S\231\001\003"
+	.ascii	"\200T\2348\361\216\225\303\214\327\t\216\231\223\b\327{\242\245"
+	.ascii	"\354\376\031\367\024\373\216.z?\334\351\362\354\307+\315J?\300"
+	.ascii	"\037#"
+	.string	"\320\t\377'\006\02779.\256\371\251P\\\222\205\205{&y\376H \200\026\211\334($s\215;\373\r\262\003)\204\365\224\364\334\327h\261\200\236\330\340\350\256hp\005xAQ\326\302\327\020\206\201b1\300n3&j@*LZx%c\224\330tE\355\307\265\030l\022\243%-\fG\005-\332\273\326)S\2705\t\321\315\334\340\357\025\t\241I\263\210\374\224\013\346`\206\3108u^\nI\204&td\332\223hk\246\2172gHS,\333\0366\271\217\250D\357\333K\nXW,\276\"\252\b\276\354\376.:\205\327C\341b\004\251_\346\2024/\361`\365\303.,\005VP\333Jh!|\017&\2029w+\022\360*\033\r\214R\337}\b\217{\"\222,\024\256\363\237\277L,<`\221\265\246D\001\tk\247\0027\nv\024{Ai\340]\312\021\242\347\005\302\332 \342\254\242\306Xg\230,\356\272\021"
+	.string	"\0023i\034.X|l\b\360\376\304\300\001\032\374U\233\0260\3724\272y\202I\255\233\217YS\261\326U\n\240O\201\002BS\236;q~\3768\342u\253\016 \243a\236\263 \344\271\n\031\273}pM\253\317\007\003PGD\326\251\233 6\032\2645\332\177%{\020N"
+	.ascii	"dI\306\321\307\020\036\035\3527:\022>\247\327N\300I\216u\253"
+	.ascii	"\235s\214-inh\f\220m=z\266\231\334\261l\331\372\034\353-\220"
+	.ascii	"\354"
+	.string	"\255\220Y\242\364&\302^\f\230=}\301\222\030#z\376a'\f\324\013\362\334O\223a\242`\274\364\370\002\274P%\017\236r\311\251=K\f\fB\251>e\323P\342Th!\243'\0015DJ\262\214\023\030\b\354Y\267\024#\216\036\262\356Q\240\024\370\344\b#\277\\\255,\003\031\330\355t\243\330_\373\025\023TA\"\266,\236\355(\211\260\362\ng\313\036w\337\313\200\261\356\214`\317\023,\246\256\320\026\3665\253v\021\003\357\234\224}\026g\rz\212T\346\210Rb\321\252\330\261\021\254\252n\306\"\321\206\222pE\230Z\225\353\301\320\334\373\177\005\276@,\245tpe\351\305P\266\212\200\242\351\233\r&\360\007/G\365O`\331\376\t\322\025_\210\206\226\t(f#R\331K\263\3644\331\001\307!g\0171r\366\223\t\364jen\314\330k\025(cT\030\361\031\022\206S\301\323\304>$\223\211\245\325*N"
+	.ascii	">z\210\007[s\270q\206H\021\205\333\210\276Al\263\271\2301\345"
+	.ascii	"A_\177\364\220\254A\354\203\365H\006J\277 \377\336\243M\004D"
+	.ascii	"\031\336\363\227\273;\372{\355R%xUXEY\2001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\234\033%7"
+	.string	"\026\272\274G\300XM:\210\212\302\301.6\217^\307uy\375U\314:\211\246b@\366\276\225\005\007|\020\336\277\035=\301\211H\032\376\374e\363r\335\005S\024\f\3200\310\244r}}\365:i\213\227K2BY\261\262\273#\3312\311\226"
+	.string	"\251"
+	.string	"\257"
+	.string	"7\350\277\f\3007\3745\362\307~\"1\216\343H\3030\224\317AE\236\225\354T\337\233~\314\337"
+	.string	"\352\355l\302>Hh\371\"?\221\367\335A\305\272\222\031\267\336\215\352\367?o\310\347(7d\275\347\213K\306\367\367\277<f\237a\254_\206\251\346w\230\357X\201\346\013\271=\346W\\\037T\374\352.\357\020\325\007\362?\246j\376\3751\377P\325:\277\206\233n\375\234\352\2338k\276Y\313\276\362\177\275\314\267\263\030?\213\235\3717\353\367\225}e\376\346\036~\nf\0054+\316\302Y\036LP\245xl\230\035T\346\006\315\340~\212Q\377w\306l\030\230\214y\301\025\310\233\315N\365e\337\353\370\377,\001_\032T<\213\225\234,\021\230LN\376&\357G\341\246\251\206\357kP\321\303\212\242\372"
+	.string	"\007\215A\343)?\341`rqI\2427\213\321y\377i\340K^\340C\316\344\332\230_\241\301\345\322\034\311\177\344\362\f#\300\367\251\276Y\363\251\357"
+	.string	"\026\320\323\243\3031,q\236e\367)\206a\016\303.\321\317\311\341\323\211\227\214t\336\331\314\314/\216\331Y\367yi6e9\216o\371b\3237\325\367\245\003\326\003\277j\207@\024c"
+	.string	"\272\360cA6\313\337\247\304\204\362S\005\236\036\030\212\002sP_\324\204\231Dct\246\372f\b\342\331\331a-\254\235Q\216F\033f\323\237\376\326i\235\240bcYI\212\202\212\275D\257\274[\255$3UP\261\211\264\215\225d-\335\002\307\324\251\376\203\344\340t\213%\201kj\222\250\214\321y\323\027h\214\300\314\315,f\231`a\030\232\370\375\211Y\331\271\365+y\277u\262\262E\311\257tYP\361RV\222\177Z\316\206\340b6\277\230g\237\346W\2710bP\361I\256\364\311\247\362"
+	.ascii	"\3620\031T\374\215\225\274\374\003\f~\335P\265GD\335g\275M%\271"
+	.ascii	"\023\342^\336\266i\025\264!\016l\334\013\204\001\346\272\032"
+	.ascii	"\016\301\2758\013~/\"\032\366\354\221g\277\005\314u/\320e9\256"
+	.ascii	"s\325\315\3220hd].\255r]\355\300\272Y\242\227&d\303\240\025\341"
+	.ascii	"\352\276jA\315z\256\nv\\\335\210Ft\256\032\353uE\325\353\204"
+	.ascii	"*\322\246Y\257~/\024G\370v~rT\020\352\267\343\303\223\243\222"
+	.ascii	"a\r\324\266\272\331\243\227uY/\2067\373uD\256\030F\362\272\""
+	.ascii	"[T\205\272\n\216\350b\370\364\251*\220\353\305iFu\323\220\266"
+	.ascii	"\031\336,R\347\201\237\335*g-\210\372iC\265H\013\201\307\250"
+	.ascii	"aQ5$\"\242 )HRj\f\321\004\2040\346\230\224\322\003\022\340\001"
+	.ascii	"I\210BY\022\303\234R\314\220\031\021\031\021\tD\244 EI\322\001"
+	.ascii	"\276U\327\t\231\002\306?\346[H\324\217\241VI^\375S\354\332\\"
+	.ascii	"k\326\307\360(\333\001\345\361\264\267~l\376\313\230\376c\377"
+	.ascii	"\177\340\257\346dc,ftF\223\3556\245i\344j\330\342\320n\205\270"
+	.ascii	"\261\036\360\337\222\355\\\023\333\221\366\007QmB\273\nX\347"
+	.ascii	"\304\rD\304\250\347C1-\003\034\316\351\026\240\r\2065,\376t\260"
+	.ascii	"\250\006\374\356\036\313\232j\236\346?%M?\277\334n\337{)\023"
+	.ascii	"F\374\004\2538V\363>:\320\364\331\303O\224\302\001|\2074\257"
+	.string	"?\210\342\273R\314\244\203\200>+)\025\256c\223`SR\0256\375\345\242\n\345\304\371\027\2440\352\2536D\320\303]LjH\332\342L1\020\3068\353\322\305L\227\314\240\346)\3126\323|\356>\302kdF.\304\312\020n\256%\374\357\023\313\230\035\325R\305\373\353\334\f\3646\2769t{\357\230\013\264\027\024\026\216AB\022\377y\217\234\302\007\353p\032\200\254\301\270\\\356\304\247<\201>I\371\243T\247\276\204c\211\332\240\005\202jP#\314\301{|\r\252[\224\002n\222\276:\024\367\366\257\221\031:\253\245l\327\341\276h\245q-4\207\320O\370<*\326\216E\266Xi\2420\275v8^\252z9i\237\326\265\345\331\331\376\357\216\202\226 \235\t?m\350\365~\247dP\323\203J\330'\243\b4U\b\206\037\031\026\375\300,\341H\300\013\237\363\345\325b\2112\303Q\331Z\004}\231\360\212H\246\222\317"
+	.ascii	"vX}A\261\022\315\212\273#\305\263C\331\330\304\220U\210\270\345"
+	.ascii	"lE\377>\223\324|)z\342,\234`j \355]<j\353H<\351\233\303\207\334"
+	.ascii	"\035\312@\246d\034u\331\227b=\006\313$U\225v\003\270\013\326"
+	.ascii	"\207`1w\221\037/\374\375Rt\336\215\256\225\"Y\205\371{\373x\301"
+	.ascii	"\317qm:\005'8h\0173\377\031\270,\006\322[\030\0208\364"
+	.string	"\307\245\325\241|\221\001CW\341\022ul|\214\306Q\322\347\316z\212\300\305\221\316\022\035q\335p>\327L\037c\305\003r\304I4\273@\bHV\264\220!\007\216n\310\377\225d\004):\201\342\0066\003\027\312\250*\260\320\352\206%\022\241\215\213\264\220g\265h5it4\366-\373\021\310\311\341\264\357\371W\245\351l\323,\022QP\343\370\037\200\013\037\332\266j\333?x\305f\364\016\312\204ZtR$h\2002!l9;\201\177\020\301\376\305'/W\216K\257L\366\321V\200^W6N\013?\353\rrB1\327\343\341gd\004rj\260\355\3539c.8\b\006\b^\312g\001\273\"\005\030\313\300\347$\244q\331\323\016\372d\247<R2B\247>39[\256.\237\256(\335\257\334UfUO_\261\313C`\256\242\222q\224\300#\024\222\345\004\370\212k#'\212\357\022\3578\022\215z`\346%\243\013"
+	.string	"S\314_*Y\276\203\210\225\264\262\214*\017\2711_8F]\013m\326\002\035\226\226\017\177\033(\273\305\327\205 \361\273u\212\236\300\241\tqu\340\241\f\217 \331Rw\311\311\205>\341`XJ`\3243\b\026\263\303j\201\335c\034\274\275\331\005\350\b\204\340D*\327\234\027\340\025\361\003x~\267\263\021\302\240"
+	.ascii	"5ZvN\027v\325\356\031~\204L\207X\270\022\317-X\016G\370\361\252"
+	.ascii	"\224\351\313\372\213\036\316\177\022\\\337\025gL\222\325s\200"
+	.ascii	"\306\210_\"\342tA\370B\007\262\003\223\334\330\242^\327=\222"
+	.ascii	"\343\205\035p\013(\333\b~\235\306c8\346\365\031u[=\250\2036\n"
+	.text
+	.section	.gnu.lto_.pureconst.982424847a4d410,"e",@progbits
+	.string	"(\265/\375 \241]\004"
+	.string	"\022\312!*0\351$\035\200\201\001\024#\0350T\320\350\302\300\300\300\300\300@\025\351\236u\207\037$\020\246)\221@\002\tM~\225~\212F\0027\205[\302\r\341vp3\270\025\354\b\356u\016\340\203\300\r\300\002\234+\254j\227\332\241\356\351\232n\351\222\356\350\212\316\320\t:?3x\316\316\013\034|\233Ss3\027\263\273\\\013\272\312\245\374&Wr#\027r{\374\034\273\006\226q\027Wae\002\033\020\027\177c\255\313.\306\230C"
+	.text
+	.section	.gnu.lto_.ipa_modref.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\264\007%\031"
+	.string	"\266YS<\020q\223t"
+	.string	""
+	.string	"0\252"
+	.string	""
+	.string	"T \030\321\240\252\231'Jcl\254#\f>Q\004\300w\325)\310\034\242a\225\323~\016\255y\357\326s\025\261\236$\375B\f\363\234\3650\333Z\333r\2479"
+	.string	"E"
+	.string	"G"
+	.ascii	"[n*J#`\250@\321j\034\366\306I\302/\023\2259\246\3225\220c\330"
+	.ascii	"^\322;\363\357\356\222~\234~ \375Vq\222fJl\365v\303\366}O\355"
+	.ascii	"#\3055\347\003`\021\240W#)\202=,x\340?\n\243\264\0214\320\301"
+	.ascii	"R|W\365\256\212\025\217\026\270Q\013\226y\353B\240'\275O\332"
+	.ascii	"iC\026\034p#\001'c\006{\221\203\205\032\240\"bL\323\243ntf\336"
+	.ascii	"\t\223\336;\275\017\231\013"
+	.string	"\177\310[\250\200n\213\nY\244\n\317\271q\337(<\2451VI\0230\022@0\3740\305\bCXc\036\244f\023\007\177\254\0063\270\005\037\"\3062\263\025\2258N\364\215\nL\274\022t\260\024x\311\244&6V\002o\252\215\347SQ\316\022\235\314tz6\236O5\235$>\231i\314\2072\216\310\303\257\016\027\016Kj\267\341\257\206+\312FE.\006\210\206\213\025\240_\344n\250Q\363X\335\350\232\001\003\245\365\023\321/\244_\210b\200\362\250\341E*\221\246 )Lc`\002\031\232*\353\022\200\3041\210:i\250df\024\026$\245=\016\017h1\t\310CT\230\225W\355\250\206\340\022\003Z\346+\324\251\260\037\327\034\267\225\333\t'I\327P\352\271\264v\203\376^2\230\256\023\t\005\202\033\247l\321\351#\235\360,h\356\022\373\211J\274\256\301m=\325\372\007\036\3051\254Y\007!F\364I\b\302\2659"
+	.string	"L\376%\306\354&\317mk+\220!\222\022\324\004\021\n\323\240\210\224 \fwf\335\311\322\247==3\347\266\322V\357\020gNz\rT\263p\2409\\\004\370*\301p\225\022\035_dU\3611\337"
+	.string	"G\344\341+\376V\226\354\026\313\333\200U\033_\305\f\352\362OKX{\216\231\333\030\364\013\337\\\026=\2334\3347"
+	.string	"\3167\265\270\346\345l8\265\257\f\205\321l\003\222\246\220A\030\256\033\305j(\207\004\021\"\036tC'\341\004\302f\221\377\020\317\252\2211\257\312\376\301X\261Q\351\300\337\212y\230s\314\247\322\224An\202\363\310\023\244\345tG\031\002\344\232\376\367\305\021\363\033\305W\n\274 y\204\003\216@<\3048\352\335Wh\250\250\310\312\032O\225\032\031}\224\366'rq\260\276$\356\333\205\337\032\356T\273\300\227uc\332`H\ng[ %\264kw\362\311\254\333\032\316\b\\\222xN\023\2327"
+	.ascii	"Y\023vy<\232\032\203\b\3073\221\331\303\034\275\330\333A\303"
+	.ascii	"|\320,\334\"\022\370?\246B\255V\365\006U\216V\177\304\366Hz\264"
+	.ascii	"i\027\001\305\353i\225/\342\023}\272\365\220\252\334(\006\324"
+	.ascii	"W\006&\353\236C\320\013p\335\371;\272b\255\007\204\374\3163\366"
+	.ascii	"\217 +`\212|\260N\n"
+	.text
+	.section	.gnu.lto_.lto.982424847a4d410,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dyad_realloc.24.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"=\r"
+	.string	"\266\232]C\020q\224\016\003\340\220\304\345:\353U\037\004\266\035^\305dt\027\320\330\003\022r\211\365\313U\204\261\03751"
+	.string	"\260\372\034L>v"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"t@jy\204\261\241\244\023<\022\223mDJ\376\336R\246\024J"
+	.string	"D"
+	.string	"I"
+	.string	"\266\375\023_\331\354\326"
+	.string	"OD\312\225\032\301\251\310\261\353e\366\356\201y\314\\"
+	.string	"\346QC|;\324\334|\006\247\031\235Ith\205\017^d\2508&\022\324\017%\236zj0\2152/\b\273\353\354L)w\274m\007\266\033\330\307\020\277\316\362G\230\2060\2550\235\232\276\206\300\312Y\255\335\r\337\313\256\242\013\t\333\267\275\331\032\333\231\366\275\243\330\316b\030\306v=\304h\331]\020\037\310<v\240\237G\271\365"
+	.string	"\273*\252\226]\017\304\0052\217\001\037'\023\352\013\030\250\037)\033\244\324a\325T\250gq\034\022<\252j\272\340^d\3074\225sb\301\271\214\362\363\225\327Km\013&\371\016\323N\006\0259\352uA\207\217\333\201\222\237\355\211RA\330\207\253*\366Q7v\324\003>\001i\237\221Og\202\326\t\231h\034\222\203B%j\t\nDBND2\022O\310'\213\340\251\340a\255d\004\224\2054\r\224i\274\275\215\351\246\204c\205\242#\375X4T\020@>\305[x65vK\357(dJ\b\f<\332\037-\3379W\334X\221T\024\021"
+	.string	"\242\310\220\031Z\317\b\342\013\177\325\025Vmo\r\2416\3426\231`1\003\215\314"
+	.string	"]\303\337\331\304\201\023Hhc"
+	.ascii	"\345L\036A\355\001"
+	.text
+	.section	.gnu.lto_select_grow.29.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`S\003-\027"
+	.string	"\326\253\222E\300\032'\035\220,\276\023?\342\202P\326E"
+	.string	"\025\021\356\177gB\357\321\330\207\222\302\224D\177\202\273\337\250=\3212\250\303~\030'\256h\203"
+	.string	"\2208\215\013\3014\003\355\237,\250Y\200\266\332'\333\b!{K\231R|"
+	.string	"w"
+	.string	"\200"
+	.string	"D\"\034\301\260\262\2734\217\236\361\036e\340\323\376\217\003\201\035\310\304\001\354\356\030A\262k;\340\002\336\243m_q\217\336\003p\217\206\331Tn\363\331\256\307E\316\220\226\335ei\217\365\320vs\t{\307E\250\t\363\323G\021\255\026{\007S90\301\211\344v\264x\344~\216h\265\026\207\245\032\213\353\251\206\003ev\367CO\235\232,\263{\260\273NZm\305\355\3356\n\333\013l\235\005\313\300\037B\341\203"
+	.ascii	"\037\034\217\276\t\356Q\245!\210~\200n\362f\333b\377"
+	.string	"*\217\375\257\356\3301\231^=\350V\035\350\017\220\351\324\205nTL\2374m\3224\214\246?M\2272M\312\264\307\245\273\230\3462\035a\032\302\264j:3\375\001\244)?\212\034\f\331Mq\353\262Ob\222\034\017\372\205.\344C\376\204l$\203\223Z\234\236\027:\024x\266\007\201=\310Fp\003J\324\307\013\355\212)\243rjcp\345i\235N\230qBc\025\216d\304\214\317\3566\2605\274\210\303#\201(\234\316\330H\0025\352\367$8U\250\237\361\220\345\315\251\252ItM}\316\227\233\274\031\361\256\037\215#[Tw7\026\225\307\231\006n\242\351JS\252c\247\264H\242\244\270\270\311\033\204\006\256\322\225~\326E\226\267\333\266\273\252<\246\271J3\304\250\"d\nNr\261\375:\021\033y\273\001\256\227\020\341\252iyhA\260\331\360\372B\3345\blZ%lX\035\\-\016,\013\256\r+\277<\\"
+	.string	"\301\022\361z\201`}\266\275\356X\202\222'7*s\247<&\321b\214\352\rHs\224\352\0348J_\343\220Ci\214^\305\317\321LF*?\245\371I\355VM\236\346o\306Lc6i\247'\375\254\207\254\311a\324\004\243\211\305N\270\222~Z\372\311B\322\222J=%\251\022\315t\310\230x\252P\212\266"
+	.ascii	"u\272d\204)JB\250A4\247\230B\212HM \321\b\005\206-\006p\002\031"
+	.ascii	":\273\003\021p\305rW\322l\007\"6g\330\372\350\"\226\013S\220"
+	.ascii	"\251\337\3063\331\315\007J\250m\345\301\232\225\326\372\247\307"
+	.ascii	"\203#<\347(\257\002Cs4d]N\241d\017y\231\375\025\253\366\242U"
+	.ascii	"9\375F\347\216\200\317\037\213v\211\246\316\221v<\217\253s\005"
+	.ascii	"\377\367\345\016\362N\321.O\n\030\266>S\245F\273\024|\21401\004"
+	.ascii	"\rn\tE\344a\025\204\350\310F\262|}\t-|}Pf\334`S\302\037"
+	.text
+	.section	.gnu.lto_select_zero.30.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\351\001\245\020"
+	.string	"\006`mF\320TQ:2c\017\001\272\033\375\230>\205\016\252\002D\352\364\304\3072\020o\261\034P@\313^\243\333\340Y\333[\fy\343g\202\247\222\362\001_<@\325\364m\264\255~A\245\273\0354)^^\332\332\336[\312\224\002X"
+	.string	"V"
+	.string	"X"
+	.ascii	"\3610\364\001\361\320,{\3109\332\202`bVlzv\027\2450\326?\356"
+	.ascii	"\206\311z\204O\223\345\267\036_\200\335%\311\266\327`wa\t[\264"
+	.ascii	"\374E\231\233\230\254\345\372\024\270\354 A\222\275^\311\307"
+	.ascii	"\t!\357\236,\262-\023T\262\273\316\230l\304\r\272m\227\355\004"
+	.ascii	"v:\b%6\353\213=\372\314\017\3405w|i\250\351\247i\315tf\372$\022"
+	.ascii	"\"?8\"\360\354\206\250\375l\017\230\303\3425\277\375w\026\331"
+	.ascii	"\334iX\257\261\316[\034\t<+\212\354\256\351\320\bB\207\005\336"
+	.ascii	"\323~\214\313`}F\345\002v_j\344\330\345N>\020:4\367R9\337[GT"
+	.ascii	"}z\332\\\274\262\346T\325\257\034qe\215F*\350\005\017\325\335"
+	.ascii	"m=\235\331\252\343pH\232v;=FvwUg6\375J\240\003\002K\037\333)"
+	.ascii	"\237a\235\320\356>\360m.x\b\305\034\372*\361\360\372\356\006"
+	.ascii	"^;0f\\Y\263\271V\352\314\376iz\002\251\247\334\024\030\234\230"
+	.ascii	"\2008AiH\231\240\240&\2442\224\254\332Pa\205\352\240R\255P\""
+	.ascii	"n_\342\322W\324\231Ibo\244\252BM\217\312rz\324\243\350\202\300"
+	.ascii	"\322\347\017.x\324\221^\204\314\315\3462\312\247\246C\265-\244"
+	.ascii	"\3621\213Ll\332Z\375\306\207\022mw!\330\030n\003\345\220\364"
+	.ascii	"\003j)E' \220\002!1\354\001\302\310\020B\233\221\270\0040\n\344"
+	.ascii	"\223\273\016-o\307\265\261\224Mo\336\253\366\005nK\3436\362\215"
+	.ascii	"a\266\302\236*\302~D\304^(\260[P~\214*\306\371\310\232$`\356"
+	.ascii	"\001Wc\237<x\3230M\344\361J'.8\004\270\003\212\0024\234\2242"
+	.ascii	"\232\013B\001"
+	.text
+	.section	.gnu.lto_select_add.31.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\351\002-\026"
+	.string	"\006j\217F\320\026Q:T\244\274\025\177\236\216\217)=\314]L\235Ot"
+	.string	"@\236\231\036\375b~l5LN\325\365\253\311\234\023\366x\372\214+\301R\n\007\271\235"
+	.string	"T\031\2130\241\231{,\212\232\226\327\306O\b\331D\312\224\002y"
+	.string	"r"
+	.string	"~"
+	.string	"\335\323~\216\317T\247\221\270\313\256\316\217 \273a\214\017\200\217\016\377\342=\202/y\217V\331L\036\312\366\203as\371\210\262\273'\205\341.U\377\274\330i\252\374L\001\205\205\263\301p\376\251\270\307\002su\005vW\004ke\354\276\234\0232X`9\235LP\023\237\327\236&`\254\354h\304\256\257\335@\n&<p6X\354\371I\330]\347\013\206\342\006o\373e\333\201\255\b\002\262\240&V\035;\323\246\230.\235\347&}\307\357\362\036\377\350\264\277%\323\"/\275\342\245C\231\006\275\364\347\245\275.\035c\272\213i\315tf\372\001JPX8$8\233\342\302=\221\233\262?\321g\306y~\373\257Yd\233gD\267+\302E\021a\366\223#\312n\310\340\3211\266\366HIY\220\341u\250\276\3037\207v_\024\t\262\2731N"
+	.string	">\026\bF\274\222v\212\240U#\252\226\364\255*#U}@\353qUYe\256\302{0\300(\331]\031\273\346@4<\002\220\221\224\302\023\034>\253\314E\335\361HSI:\234$9R\"\203\f\356}\363\256\251\t\324\252\301\312\234m\233\377\360\r\334]\b\276\315\302\0060\006\t\357\361:\300\305\023\0273\332*s\335\356n\347P\266\250\215\002\221\1779{f?%\024GkCr`\252;v\210\223\227\t\037N\223!ojD\250\210\033\203\003\232\231\024\315\311\203\315L\207\323\005\033\016/F}\250\tq\272A\241B\234D\341^u&\020\371Y)\353\323\035\")\223\022\002KZ\2542w\230\330\354\206'R\001<\354\231\017I\211T\205"
+	.ascii	"\341\240\255h\312\376r\022ROW\264\273\271b\240\206\364\23768"
+	.ascii	"\250\035\225\326\024\223~\372\332_\200\b<\345\215\324\244N\327"
+	.ascii	"\n\326\205\334(\360Gx\217\236\336\004\213\225\2224\352[6\272"
+	.ascii	";: `\002\221r\272\003B2\304\321\3649\305\rJM\275\336\326ga\271"
+	.ascii	"A\334\347\006K\213P\t\t\333r\203\233\210a\256\2067\312@ .h\300"
+	.ascii	"\240\214p\234\314\277.\020b'\201\301\0319\304\205\013\023\027"
+	.ascii	"\211@,\214\303\326\rW\343N\243J\202 \006\3531\226&Vi\310`]\270"
+	.ascii	"Pp\322V\315\224j\373\3133\2215\300\024i,\200\242\320n\330x\023"
+	.ascii	"iby\333\315\240\352\241j\350\330l/\344\221\227\200\237"
+	.text
+	.section	.gnu.lto_panic.41.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\276\001\215\020"
+	.string	"\366\035nI\300\222U:\320\0251\371$\344>0\364\276\337\001}\314\007\033{\267)\360s+"
+	.string	"\215\200|\200\216\270\204\357\371\367*\025w\213\275zY\205\302\315Me\304\247o\301!\207\354@\351\250\322n\223\267\220\204\270\266\237l\262eJ\001V"
+	.string	"R"
+	.string	"["
+	.string	">\037\036`\027\247\005o7\227b\023\322\247s7\211\237\244\013\020?\375\262\211\236\303\355H\305P\210\027?vw\224:\177}\206R_\276\347\315\303\220\332\315eX2A\204c\244&\013\033\354\250\241\270\356:\242\006Bu\004aw\255\264Z\211[\274m\025\333\017l\035\003{\232\275\201\203\236\346\353\276b\003\n\002i$\314\316\301T\346\330\017ww-q\354\373\374S\252_b)\252\271\371$\004\355\326\004\001\022\373M\032+\376\363\333\277\316%;w\027\257\377x\370\316lTr\350"
+	.string	"\356\332\240|Z\001\351\363\004\256\366y\336\363z)n\210\230!e\216[\304K\003\272!\231\026\331\227q^\213\277c\013..\342\347\345H\207\347\326s\"\246AL\242'\024"
+	.ascii	"\233P\020(\2230\213\350\tn\312\357\036C5\202\333\215\001\035"
+	.ascii	"\006\214\277\363\351\224JO\373\364U+\226\210\215\027\004\316"
+	.ascii	"$\314#E\371w\327\271\020\220\330\r\016q%(q\200J\305\234dJH\\"
+	.ascii	"0\255S8\263\312 \215b\360r\352\3602\306\244N\253\361BJ\203\311"
+	.ascii	",\031\f\255q\206\305j\215\245\221\357\003\272\340\366J\204\367"
+	.ascii	"\202?\331,`Ce\202\363}\367\240\t\263\323(\220f)',\025\264\327"
+	.ascii	"\343Gc\337\315\007\213p\200~\367\032*\223POZ{<~2\031# p\002\031"
+	.ascii	"\261\274\003\371\361E7~5\247\270IK\255\307\025\313\373\262H\355"
+	.ascii	"Z\020-\20599\213=,=W\276\342V\\\017\3104#\237\004\215f$\013*"
+	.ascii	"\322\222\262\211\264\345\243\210\355\246\332\r\210\254-\0167"
+	.ascii	"z\303\035\027\006\213<J%\350\222g\271\032\027\335\003"
+	.text
+	.section	.gnu.lto_destroyClosedStreams.43.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\366\001e\021"
+	.string	"F`sG\340\3604\035\330L~\307\254\017\354d~\236\226U\017\344\302Jr\201\333\207\244\316\250\363\203\025\256\035\024\317\357m\326l[\031\321 \250\231\324\274\026\021!\304h\006A0d\323x1iR\326\230\357\215\232\bm\"eJ\001a"
+	.string	"W"
+	.string	"^"
+	.string	";S\343\321p\301H\307\234\323[\035s\272\372\306i\022[]\371\332\302\306\027\272|\3034\326\214\317_\320\334`\"O\257\244\213W0\204Q.\253\301\271fs\331\2056\3070\003/\025M"
+	.ascii	"B\026\3661\343\363\241\302\030\335\213_\300\303\341\306\207\032"
+	.ascii	"\234\253\246`\316i\375\302\232\273\273m\031\333\236\255\007\002"
+	.ascii	".\272-\373\";O/o\216\335}\350\3262y\327\255\252>"
+	.string	"\252\243!\304\242\301\322\2343=vL&\231\364\363\241\337u\265o\177\364\211\206@\260C\310v\371\213F\371B\037\261\272K\365i\201\206\373\300\r\2579\307\220K\203l\227\036\377\221]n\017\220]ze\327\370\030\235\352\332()\375\347]!2\305\254\213\355\b?\241\002\211\241\355\211^\300(E\3203\3744a\300\266\345\220\177I\212d\304\350\223\355\225\233\260\3226\347L\340\037U\220\260\365\250\262\313\357\346@\341\344\332\243%V\270\333\"q#\225\337\343\t-\372\357\322o\311.\345J\026\222\323\315\213\366\260\307,\024LR0\224\021\023\025\226\225\314\016\020\224\214\264\224x)'#(\036\311\311\203\017\247 \230\250x,\251\224\212\207\032\3477\307\f\\0\275,\314\306y\020\341R\271\306\264nu\301\022\327\035\320\203\243h\306\217\3159'\267-_\274\004\002A\364\315\tH\006\323\266[\320\276\206$`'\333\213'"
+	.ascii	"C)HC\350\310\360\220\001( \220\202\031;vB\031\221h\n\347@\273"
+	.ascii	"K*\254\234\251\b9\031\230\201\332\266&728\340{\307\340\206|Z"
+	.ascii	"\305\t\3578b7\003Y&_Q0r\242!\f\236\232\370V{O\333UX\350+\b\327"
+	.ascii	"\322\021\214\321 \375\r\"B\311\371\006[?\267\234\021\217_\356"
+	.ascii	"\347\204\251\205d"
+	.text
+	.section	.gnu.lto_updateTickTimer.44.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`1\006\005%"
+	.string	"\032A@\016I\200\332Q:\341\023\342\357\354\255\234=`\231\332\330\204\254\266Q\003\0018b\355\254\247\237x\342\ry\330\242}]\032<\034\226\354i\244o\363\214ql\033\215\325\210rc\034\265+]"
+	.string	"\026\250\006\257P\034\257m\237\020\"w\222\001\317"
+	.string	"\302"
+	.string	"\327"
+	.string	"\027s\362'S\017\373UE\240\342\004\301\355j#\217\256[\227|\346\002 j\276\344I\276\222sH \325\275\030\002\2205-\257{/\025\037\311\271\253\374\257\203Q]I\212\364f!\257\013\034%\2250^l\356\3052\272\312\005nW\177\277[\257\352\\\267^\355\034\003\231\315\034\271um>\222\250X\262\271\367\362\232\007\257\234k\340qr\266UMqm\201|\233eK\321Xu\234s\301\2221\264\271\035-f\334\226\332\254X\004\t`T\221\036A\237dwZ\331u\b\214\253w>5\202\345L\321\b\343\251\235q\334"
+	.ascii	"\034-b\274S\005O\347\232s\301\212\221\356X\004)\276\353\366\312"
+	.ascii	"(\264\326&\341\336\313\266hlq\316933a\346$\346U@C\322\332<\255"
+	.ascii	"\272\312\356\020:\273\217\354dfK\340-\244\0243\264"
+	.string	"P\346O9\032;\371?\370\211\233\366En\256W\337\352\231\026\256\254\240\2152#\205\266\217\314_\241Q!\334:\230W\313D\253\345\241\325\262\220\315r\320j\031\310f\371g\265\354\263Z\336\255\226{l\226u\253e\036\233\345\035\2357\233\347u\265\254\256\226\323\325r\257\226\355j\371\007p\326\254\211y@\273\227Et\355\246\251dB\236\374\313\376\345\017\345o\362\241\274\214o&\246$\266\342y\357\324\311X]\252!\271\027\177\354N\316E\271\024\340\233R\270\242\330\223\347\275\310\004\267\253|\273n\005>\354\367K\304\262p\025\366\274C,\243)\016G6\3633R\024\224\354\213J\353\325\234\356\345\027\256\254\340\311T\b\020\346^\342\213\027n\304\006\b0|,Co)\302\370=\223e}dre\345\316g\353\313X\303\315\370\314n\251\313*4|\254\203\363\225\325\350/\273\332\006\356r/\034\370?\256\376\354f\035"
+	.ascii	"l\335{\323s\231\265\314\303\007kv\334\224\027i\304\256:\332\202"
+	.ascii	">S\234O\247\275\353\006\212hQ\202\tC\223\"\275\027\007\3223i"
+	.ascii	"\243\274k\236\366\321\022:O\234q\346\206\0257C\232\227\031)\032"
+	.ascii	"\2652\2747H\240\247w}\"\021\241\215\262\256{:\035\003qfO\327"
+	.ascii	"D=\300v\232\247\255\032\361\371%\373\316dz\260\323\275\204\214"
+	.ascii	"\227\326\027X\216\345\375M\316l\272\335{\227#\234\354\213|\346"
+	.ascii	"qM\002\274\304\004%\345\363=\025\235\350\211(\032\341k\212*\352"
+	.ascii	"\351\234zLPQ'V\246\243\210\262\354c\260\324\373-\361J4\365\234"
+	.ascii	"x!\232H\354\370\311\004\023\024/\352\351\t\212\227C\006\337:"
+	.ascii	"8\034I\013\266\020\247\217L\324j'a\031Z\250\r\252\375\256[$@"
+	.ascii	"\326\264\276\262\222C\r\324D\317r\241\036\nj\241N\307@\\\031"
+	.ascii	"\364\323@I\366]\371\303\344\312\244\362G\312\001\265\221\373"
+	.ascii	"AI\241E4\335\266\323>\033v\002\271\272qkl\253E\310\264\261\365"
+	.ascii	"\221\177\\oT\235>\0273\315\351\265\257\320|m\242 G\224c\206\026"
+	.ascii	"\232\336{\357\332\307\256\253\221\272\361\323@\001\277~~H\255"
+	.ascii	"Wu\272\325\300\264\001+\262'\373X\207\333\332\314\023\222\032"
+	.ascii	"\255FZ7A\2632\252\035}\250Q\034\305 S\210\241\021\2220\232\202"
+	.ascii	"B\016p\002\231\251*\363\022\200\006\256sTQ\020\0256\366\337\""
+	.ascii	"\244\230\317\246\377\r[\016\214\344(\370\262\270PpAo\311\356"
+	.ascii	"2\376\210\n\306\370\267\311\002\310\253?\003\266\214\271\360"
+	.ascii	"C\253+HBp\343\226\214\234~\331S\333\244\352\364\263a\362v\240"
+	.ascii	"\r;\256M\006f\007\333\345\2272B#4\344,L\b8\265\245\265\340>6"
+	.ascii	"\206\2644\307\316\237\252\215\320\267hj\340\017_t\247\201\205"
+	.ascii	"\021\322\021;\004\251\334d\336~\230\362\222y\236\231\313b\221"
+	.ascii	"\325\303\315\310;\257\246js\217\216\263m_%\177_\325\2616\221"
+	.ascii	"y\204\3312\367\262\275\371\005D\326\001\303\323\242\361\374b"
+	.ascii	"\005\\N\023\253\355V\300\001\004\200N\375\340I\212\321\3206\206"
+	.ascii	"4\206\270\351\347\023\003\205\233L|[X\303\316\377\004\3105.F"
+	.ascii	"\303\215\321\376\315P\352<\275Q}\226\314\220\262_\027fX\202\327"
+	.ascii	"\304\334\221\3540\336\317<D\025"
+	.text
+	.section	.gnu.lto_updateStreamTimeouts.45.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\023\005\035\""
+	.string	"\366\375\331I\200\030R:\3766\037\"\bh\204\004C\275LY\r\316Nc7\275\200\343(\235\260`w\226jj\002\306Gy?\240\324\013\033D8\032\016A\312~\214ek\331\342V\217y3L\032\253)\370\266\036\"\332>\211%D\356$\003\303"
+	.string	"\276"
+	.string	"\310"
+	.ascii	"(\263\0233\357h_\354H\346\035\177d\375\330\223\356g\345\306\274"
+	.ascii	"\367x@=\312*?\354\305\365F\250_\037\020\303\031\027\346\245\002"
+	.ascii	"\006\035e\003\352\321>\336'wT\350=\271\243\2742\203\371Q\353"
+	.ascii	"\246?\252\270(;s\357\355u\017\326\331\365;\235\232C\317\266+"
+	.ascii	"\337Z\t\363\013F}w\246UW\\\307\002\264q\n\241a.\217\274\265\n"
+	.ascii	"NY]:\201\007V\215\253\005\262\260\204\317\235\n\206Sb\340\004"
+	.ascii	"}\247\317\025\035oO\276\300\027Ph\321S\001SY\306\347\212\353"
+	.ascii	"\307\013V\331\363\374\301\002\024\236?\367^^\220\312\366\221"
+	.ascii	"\277\360\343ML\026V\215\333t\302\275\227\355/\210u\346\235\231"
+	.ascii	"\20303\005f\024@i$ \334t\037y\013\033\026\215R\266\3117\266\367"
+	.ascii	"3yZ\t\365\336\213vt\302\376"
+	.string	"\307O\273\016\211W[\034\263\252\243\230\217S\266\211\314\027\322B\303\344\336\301=\251e\236\324\362NjYG\265\234\223Z\306Q-\337\330\350>v>S\313\235Z\266\251\345\017\3305\303\236\2040s\357US\315mC\227]G\373\227\277\361\037\373\311|\276\362K\376\232\332\013\346\322\311\030%\2229\263\304Wc\336\322\215PQ\021\236\230}\311\321\370i\314;[\233N\306B\\j\206aM\3743\346\231=I\323\225\2648\257\360xa\354\220O\334\302\316\334\013\\\240\036\375\325y\331\223\314<v:\031\267\f5E\036\314\274\212\335\013+U~\027\026\024\266\236rG\337\rW&\256\2218\251\nv\023y\313\335\236\370[\\\301\202\375\317B\356\250\256\233\b\027'\224\272\026\f7n\367\372\376\313\240\372\032 8\312\254\341b\033\216\374\371U\305\311o\006\324\262\211I0\341\356\314\226\373\2229|\215\331\254\026Z\006\005G"
+	.ascii	"\373\340,%\027\364/_\245\003O9\025\017\374\255\243o\362\265\241"
+	.ascii	"\033\255\243\347\371Kn\371\001\204]\373\006\257\034qL_Gq\213"
+	.ascii	"\363\336,\t\3141\333\344\235\306i\236!+\357\273\021&G\2244^j"
+	.ascii	"\227YB\263\031\205\352^) \235\336\351\373\276\246l\223sZ\247"
+	.ascii	"O\264\020O\023\221\323\004|4N[->\346\321\230\350\001\314\324"
+	.ascii	"\224\364Sd\204t\304\364\263\303\202\311\"\021\031)1-\345\214"
+	.ascii	"\316$\030\024\0219\025\365R\034\021!\365F\034\241\360\341$\025"
+	.ascii	"FJ=\246\244$\245\036\357(\365\336\301Ci\332\244z\212\241\214"
+	.ascii	"\273&\362\n1\243j\323/\022\261\272>\333\212\313\317\026\320%"
+	.ascii	"\344\274\367"
+	.string	"^\035\220\303=\001\320\272\367\3324\216\256\267aQM`\317\346'W\257U\210\375\217O\007L\334\262rA\357i\001H.O\362:\344c\230\215{\372\311\003)\341\230\303\242\001{\262\213\r\251g3\257`\253\021\033'V\332\252:\212\317h\244\371\241M\344\356\267\t\344\024\333<\335m\327\370\202L\331f\361`l\247pf\300\236\305\313\230\331\251df\013\364\036\201\354Be\321\004b\250a C\030c\f)2B\201\2204\306\034`\002\221)4;\021\3409DCS\311\306\030\252\f\241\275d\237d\326\020\200\246#I\360\241\274\275:\031\316\354B\302\b\007\330s\024\2423\331J\002)\241\301\247\301\257\250Cw\274x!?\224\337\310\360 \326\203F\264W@\316\232T%\364,\2065;\034Xh3J\366\351\214\310A\377P\212_\345\306\340\027tI\\\300\344\217t\336E\345V\303m\235Q\273\034'&qd"
+	.string	"Ks\241\334\0240\261"
+	.ascii	"\031\340\270{\220N\321+\301l8/,dA<X\244Od1J\237\356&-\253\320"
+	.ascii	"\b?\257*\303\255\255v(\306\364}M\333p\016\246;=jt0`\017>\020"
+	.ascii	"\226\372F\301\363\350\361\203\344\341\026e\3040h\0021\025"
+	.text
+	.section	.gnu.lto_stream_destroy.46.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`,\005M\037"
+	.string	"&\370\302G\220\232Nc\260\266/Dc\324SU\362\220\377\b\351\231\017\022p\240\306\217\223z&\300\f\200\304\206gH\375\221\004\331:\203tC\227z$\t"
+	.string	"CL\002\214fQ"
+	.string	""
+	.string	"\034X\323\026\234\253\212\221\b\221\275\267\334R\246\024\251"
+	.string	"\246"
+	.string	"\260"
+	.string	"\267\026\366\355\326^\311O\337\226|\253w\256\243\013Od\f/\323\214\007\345m\335\271\2001\210\364\3534\303fZE\r\357\r\346\334:\307>\265\217\344Z\275\003y\017p/\225\224\260{\203\r\254\240\274u\3606\343my\001\343\255{\366\227\007\177\227\264\212\361t\226\271\367\346*\017\217\264wr\264b\245=\237r\001c\372\222N\212dS\024\020\234\357I\334Y\033\2125\3211\210\324\355\317\213B\322\314L\237\324\305\032\257\342\r\025\264'\234\217ID@\205C\355\347)\224o\211Rr\302\275\327\324\364\321\270\313\333\206a\333\203m1\004\247\211\334m\236\237\366b\035\333\024\203\333'~\232\314:,\300\324\246\304Ze\033"
+	.string	"}\265Q"
+	.ascii	"\321\233\246S\260\320\230jR\201-+e\265V=h|%\260\225\306D\327"
+	.ascii	"l\2478\224\240\362\336\253\343\213\365\354\312\037\274\361\366"
+	.ascii	"\265\226}\251\001\225h\032;\270Dk\225\375\235\337\332\320\225"
+	.ascii	"\312\2669\360\307\335H\352\032\222\332FR\227#5i\251GKmO-\236"
+	.ascii	"\272>xSK\375\004\267+$[~\300\334\033\225\346\314E\263bW\017\376"
+	.ascii	"\\aV\246\300\242|U\231\362\032\317\242\274\311\273\354\233[\234"
+	.ascii	"\211u\316\214\334{\0037\3038\270\255c\275"
+	.string	"\323\215%/\377b2\377\207)x\214\336\364\330xk\253%b\2265%V_\313\013\336\205O\3140i<\261Z\25125 Y\253\fD\006\2646\265\232\242+ \325\035ce\356U\272y\253P\270Z\353u\\\313\017\257\364\221\306\333Z#\244\231A\331\020\357\275w\254U\316\202\204\373\331\026\216\205W\212\271\330\r\370\331\324\biWj\023\263&\2375@\317\344g\006\023Wm\r\034>%\tZSM\262\217\326\001\200\360^\247\233\037J'\b\013@\374\fA\177\020\266\2201\245rn\213\030\032\355\021?\207.\3456\t\337\304h\227x\366\321\035\355\210\214\212t>7B:]\317M\021\317\317\315\215\356\307\350\200\356F.tBb\020\217\216\310\250h\364\t\007><G>9! \236\240\\\017\220\n\033\357V\350\210rF\273\035Q\356f\333A\245\213\343\255Rk\026\2466T\252K>\022\357\325!\341\\\377\371"
+	.string	"\303%\270\352\207\205\235\346\300\2415\325\007\003\343q4C5>\260\272\330\252\377\365\325\343f||\255g\205#\2649\301\022\226\325\367\362\272:\231\241 \037\323\033\202\363+\353\317S/,,7\264p(Y\375\256^\221^V\3277d]\265!SM:r1E\356i=L/\211\002\341"
+	.string	"!YmRgY\300\261\016\003d\250a(\244\224S\220\314\210\210L\030i\222\016\220\002\221)+\017\021P=Cv%\3154\006\312\200\002Ce\324\223\236\021y}\022\2360X\256H<\322\353t&P,c0\341\330G\207\007\223\230\020pB\254\225\023-\201\204\372HJ&\261\324 \215G$(0\277(\027)m\252\276\253\035\0255\314.I;\266\005@\302\212\266\352\210\024\346\326\265\272\f\345 \366p\246\245$\305Su\226\361\nI{\354"
+	.string	"y,8e\277\027\333\271\3604\240\365_\243"
+	.string	"f\305\311\234U6\017i\373\216y+\354\t\301D\312\031?\230U\345\035\275 \200fi\221\346\252\300\203"
+	.string	"\t\020G\360f\272H\223\205\\\217\220\"\222\023b'\223\325\214s\342\376E{\240Y\246["
+	.ascii	"\003P\262%\240)&U\003"
+	.text
+	.section	.gnu.lto_stream_emitEvent.47.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\342\003\035\032"
+	.string	"\226\357\245H\260\226Q:\344 wy\224%\337u\206p\212\300E\331\376\365VC\213\241\224\260\235\\\361\316x\f\364\177\350:\343Ko\201U#\316\367\022\2521\2359\375\t\205\374\353}J1\204\267\217\275\307\265\205\373\243\021B\366\226;\245\222"
+	.string	"\207"
+	.string	"\223"
+	.ascii	"\322~\217\373\240=\007"
+	.string	"\364\231Z\223\236\220\324\252c`\003\343\251u\247\tO\307\277\302S\323\354,\327\341\252X\303G\304\363Rk\205\255\f\217\222v\326(\206t\256\244\371\022\030,\272\005\2355\305!\0226\036\245\304\212\371\340\212\312\351\274\232\034\227\216\220.\252x8_+\210H\311\334\210\346\002\251\034,l\222\242\370\234\n\\49!s\033\2324Q1\260\334wit\023\222{\336'p\210\026\030GH\227\"\204Z\253e\321\355\350\216\271m\032\266\035\330\313%\276\220\f=\022GCDx\272J\246\360h1B\006m]\220\\%\373\017pWY\274I\266M\315{\367\353\271\177\346\272?\200\353Lw\213J\307\2544k\245GQZ\f\245C*M\251\364\234\322;\245\345J_\300w\004wE;\275ZI\004\277T(\352t\343\275\237\311~\223\357\353\315^m%XD@\"T\265\352`\343\351\317s\313\007\362\035\355L\376\315\352\213"
+	.string	"\fBUk\27595\203\361\264\300\224:\021\301\233\007\313\252\002Z\231\24042\300Z\\\003x!\264A\266'\374\251\202\270[E\305*\\\333\302\231\030\350\302I^\321\026\f_b`\270\342\022\225\263\350\20245W\311t\347\352\354\252\b\311+\333\032\376\363\217.\201*\271\234'\361\317\211\302\206q\2664\205\224Un\367\373\332\203\261\351\020p?\205rwo\303Q\223A\273VnX\204(\214c?2\303\301\271\303\215\310\212\\\360``\n(<\375\336\367\233&)\036\271\355-\031\272\255g\326\346\371\020\240\261\326\332 >\261\017\261\237\020\262\235Q\366\330yrb>?!Bo\300\341\2203\343"
+	.string	"\373 \313\341\201\351\310vh\334\003\"\346\003\373\351\351\361\201\265t\365\233d\013?\240Fl\215\212\265JnY\021mvg\310\233\273\326\310\2651\373\245\335\023\t\217\362\357"
+	.ascii	"\324\200\230\004MS\254>k\255u\\%\337\3671\352\311HX\263\236\324"
+	.ascii	"\265\2555\262\027\274\2656{\336i\017,P$\n\021\347\256\255Y\036"
+	.ascii	")6\0275\231\373Ru%|-kuvVv\307e\255\004\332t\324\236\314\020L"
+	.ascii	"9!0\006L\250A(e\030t\210\214L4BC\201\322bp\002\0212,\017\020"
+	.ascii	"P\210\246\270\262\031\"F\316*\204\362s\351\224\321\247\212z\260"
+	.ascii	"\267\374omuw\302)\016\024\273\346k\004\253\021\347TB\032\375"
+	.ascii	"\224ZmT,I\026\346[\234J\374\247\234\224\204\316\263d\036\252"
+	.ascii	"\036\352\207A\r'z(k.\\\213\244\245\367\301\255\204^g\f\335L\247"
+	.ascii	"{p\026\232\006\274r\335;?s\036\207\335\336`\021\347\036{\201"
+	.ascii	"\\\007\3446\005\360\237\225&\374\215\320L0\216)Ff\034\020\324"
+	.ascii	"b\002\331\330x\222I\303[w\231\303\254\232L\364Q\001"
+	.text
+	.section	.gnu.lto_stream_error.48.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\203\003m\031"
+	.string	"f\256\243I\240XU:@\365\203\237:\245\220\213\350\32329\2044<y\374A*d_\234'\257\364\205\2377r"
+	.string	"ul\310&\213\362\365\315\217\2009\214\007<\217^<\025;Xg\315^\334\327 +"
+	.string	"\3737T+\020I#\233\354\235d\214"
+	.string	"\206"
+	.string	"\220"
+	.string	"M\270H\3464\257\007\214\264\273{xf\376\306\310\n\\\261F\366\312|%_r\376\211\305u\272}LI\273\201=|\300\374e\340a\345\257\371"
+	.ascii	"\345/\237\314d\016\3745K\210\225\222\0234\335=\263@~\236U^\322"
+	.ascii	"\326\223\177\341oP\337\321Y6^\222<:\264\320x\371z$\254K\0171"
+	.ascii	"O\225\352e:\331\3621\335\222<\307)3/\037\217\204-\rA/|}\341K"
+	.ascii	"\252\225\025\241\273\271\242\276\031g\363\314\234\202\231-0\333"
+	.ascii	"$\001\300\244j\233\230O\266\365\361\372\323\337:\360\277o\362"
+	.ascii	"\223f\345\303\356t&\210\303\204\225\356\245+6m\274TDN\374\241"
+	.ascii	"~\251[\346\363\251\234\310/\262\213\352$\372\220\357\0173D|*"
+	.ascii	"v\021Iq\361)O\231]\274\373\220im\220t\267\353\227y\307\354\372"
+	.ascii	"\255\217\272\220]Q.\345\274T\221\331E*\304\bs\354v`\376\346t"
+	.ascii	"\355?9\224\363PF\357\236\214 \241\230c\363d\310~\231\201\371"
+	.ascii	"k\201,\223\007\317\00742Wh\215\001\365\366\332\017\357E\003\354"
+	.ascii	"\327\335;\272\301\354=@\360\373\341\205\034^_\230;x\210)\331"
+	.ascii	"#\326\251\244e\376P\253Gok\325\026#\357?5\307\324\332&\226\235"
+	.ascii	"\264\027^\200\223S\320\212W\325\260\021\331\315\003\302\221I"
+	.ascii	"\275b\333\364$\311\215\233s\261<\221\207^\344b\375u7\355:\301"
+	.ascii	"\222\003\251^1Nmp\256*e?\361Yr|\345XD\360\203\374\276\312\213"
+	.ascii	"7\234\037\312cJ\"\t\\=\312/\376\246\n\223\261g\217\230\003\254"
+	.ascii	"`\367\003\344\263\223 \266\373\241-\360\331\001\020\242H\310"
+	.ascii	"\332\256\323\331\254\210\035\316\342j6\035\212]\311C> j*@\314"
+	.ascii	"L\334j\270\231\320\255\004\214s'l\272\031\212\\N7s\001\221\316"
+	.ascii	"%MsD\262Il\004\365\027I\375\302\353\260b\265e\371\251\204\t\365"
+	.ascii	"(\223u\252L\227\035\345\313\022\b\202y\312\024\036\206\213&\337"
+	.ascii	"jD\020?\b\213\362\367e\237\336\300T\231\243\216%O\005\352\207"
+	.ascii	"\217\272\231-\313|\001C\255:clq\257\265G\330\244\251VZ,\031!"
+	.ascii	"3<j\205\rE\250Q4\246\020c\246(F\002\022\031m\033p\002\221\271"
+	.ascii	":\017\020hh\322\244\335\"\264l\370g\020#jU0\025B-eW\201\221a"
+	.ascii	"\301\252#\017\2722\220\377\346\276\266!\006W.&4\363\311L\315"
+	.ascii	"&\325\247!\330\362\365v\372\245SHP:}\032\003\213H\033Q\037\353"
+	.ascii	"i\234\222\237\254\032\273(\270\036\201\377\3540+D\336\031$\377"
+	.ascii	"\2723\256Y\177\3737\351~\250\321\321\273\f.\213\221$Nd$P\275"
+	.ascii	"\375W\263X\312\203K\210\\@\347\017\352\177\356Q\034c|zj\370U"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_stream_initAddress.49.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\203\006\235%"
+	.string	"\312C\360\016Fp\236Q:\361\264aPI\233\"S\356\274\020f\343{\355\037\201_ ;\337\207\020\0310\306N\341\037q\327\204v6*\213\036p\346\272\240P\224PM\246\273ha\036n\305\312T\223R\005\373\266'\215\020\"w\222\001\323"
+	.string	"\317"
+	.string	"\337"
+	.string	"c\032\236`%y\230\2131\343\370\351G\036\022j\301\n\336{q?\231\237\230q?\373`72\356\313\301\330\207A\375Z\375h\201\347\227\274\367\307\204\364gz\177O\274\027\373bT*\365#5v\361H\336k6\364\223\207\322\237\n\314W\346\007/\264\037\342\270\200{\265\326\230\335K$b\006\351O&~\207\376L?"
+	.string	"\375\311\226\371\316\211\\\267\326\245\343\nL\332\275\267\327PnoKk\350iv\265|\251\333\214Ok\317\002b\344\250\031\001K\215\020!\340\225\271s\343\244\216U=\027d\0019r\323\244 \006$\323e\271s\005\007\314Q\333\254P\225\226D\bXe\346"
+	.ascii	"]\301\271\361\225\007\220\252\326\032\207{/\327\037\020\310\371"
+	.ascii	"vf.\302\314.\230Q\034\001ThbD\3705\320\263\034RJ0\210\025\344"
+	.ascii	"3\240\276\371e+X\224}\304\327U&sp\213\247\251\221\336{\213\370"
+	.ascii	"hP"
+	.string	"\030\245Sp\364\351e\374\032\376>\n}\361}\025\226\306g\252.Y\250\376\236\317\320\241\377xc\222\216\353\307\374\302W\377\343\033O\"\017Q\231\264j)f\"U\355-\346\367r\271\\rk1\333*C\260U~\360\341\277K+\013\245\225u\266\312\271[e\\Z\371\226V\266\331*\247\267\3125[e4\255|\246\225\315\264r\247\225k\255\362#\024@\003\206v\326\245\243\321\210\327\307R\320ms\222\351z\361\017;\201\035V]G\222\314\314L\034\250tT\231dJb0\355J\335!\223\371|\262\2279\375\310\035\334\342\304\034ZX\302!\257\362\036\205\326\372\307\247\331\255\003\026\312\377\330(\r\254\224\033-\225\363\301\232rc\266]\326J\375\217w{\222\312\344UKq\255\367\324Huv~z\034T\336\331\f\332;\263\315b\275\352\177\265\276pO\033e\262\252\245\376$\215\027 z\273\345\202\242_\277c\271"
+	.string	"@\262\025\336h\273\350\220h\367\0372\345\260\351dy\001:\243\212\267%\213u\311P\346\275Y\033\036\366'1_\311\342n\315\261\312<\373h\314\315f\356p\"I\344\020\230\235\223S\302\001\021\031\025\\DAY\366#2U\227\214f6d\322\275\305\274w\033"
+	.string	"\233\223\243\002\342\004\365\307\203yHo\366\332\314 B\324\377\272\025X\211\270\033\022\215<P\273\347\f\331\224h\2004q\343\t\t\\)>F\005\027=\215\005\f\203G\303\350\211)\251\t\352\250\307\324\344;\3529)\275 \262\341\244\344\213Ad\241\250E\321\005\033\275$$\247\030.\224|\275%&\247\036o\t\t\311\310L\272\341c2e\030%-51\241\354\202\207d\004\205\324S\362\031\311\350\035\371b\354x\006\215\244\245^\323\214\031K=\034q\352\346m-\3460\325T7\357\275\327\366'\213\201R\241\332\003B\013\235\3215_\fB_,\327:\036\365g\233 @\346\032\203\020K\200G\241\270\376\261^\331\036\005\220>\252\225\0052\br\243\035\362d\355C\304\325\251"
+	.string	"\270\276\260O\225\n\026\306\017\235Zo5\263-\362AlfG\025GL\317\203\276\365\215o\340U\346\rZ\205jk\376\230Eb\225\240\377=\350\217\375C\230\263,i\333z\367&\216q\320T].y \333$\001W\001d\332\031\204\001t\250Q,\005\215\202\312\214\310\004\"2\2224\035\260\002\021\242\242n\021`%dN\325$)\265w\242\217\2105G\02659W`Jf\233\356\323M\366y\267a\270d{\324+\215\0215\376DX\332\214OB\311\034\272j\351\266P~aL\333\370\227\002e\020ti].`pK\224nzN=\035\233\344\"\227A\031\220\005x?pm\325\217\312\201\240\343\023\370\203?j\2615\341\352S\217\233h\235\032#\n\\\324\0175\312\342xu\n\217\236\215!\354\232K\352\336'\302\303\025p\300\251\345w \337@\231d\025\366v9\007\034\210*\360"
+	.ascii	"\223\254\310O\035'g\317\330\234\t>&\322\024\352$\323\353\226"
+	.ascii	"\372x4\266\f\351\233\251Ksi\261\216<\226\362\202\003\370\210"
+	.ascii	"\033\327\204\331\212\225,/\363\017{\374Uz\005\317Ax\314\035\213"
+	.ascii	"\371\177\361\315\313,A\250\001"
+	.text
+	.section	.gnu.lto_stream_setSocketNonBlocking.50.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\204\001\r\017"
+	.string	"6\235dD"
+	.string	"\257(\035@^\241\024\213\301Z\364\375\340\216\273\373\325&\375^\022'\215\313L\204w\365\306\217\271\267!\262\2741\300\252\207I\r\220<\200\352\227\256c\200qA\266!\235\033m\036?#\332o\204\220\275\245L)N"
+	.string	"O"
+	.string	"P"
+	.string	"\273\252\027\226\335\357\343\003\333\243\277kd\217\333\007d\217&\331/\377:\254\246\002\342\344j\261\273\234r8\351\021j\222|mC\203Jy\217(\207\233\024\3125@\312\004;\273{\327\323$U\312\3246v\327\211J]\270\263\333f`;\201\375\230\333[\267v\326\0373\255\231\316L\037"
+	.string	"'F\205L\313\t\005\024\273'\261\027\233\"\236Py\353\267\177\2279\266[\206\301}-`!\002fw=\217\346\354\374>\202\364\025\303`\306\2326\240Xv\367c\317\366\330\201O\373!\276\"\235Er\001\001\372\023\206R\306\356\317{\356\256\247\232b\3177%\020\343\311\264\2540\245\013o\371\371\325\226 \312\2434\355TP\317\366\204\277D0\\vW\201Ob4R\300\305\003I\366x5\260z\241a\305*\311\230\375y\251)\366\341\356\256U\265\311\264\346+\177\"\b\240\217\007q\024\322)\b\250#4\022ev\200\200\0034\302\301E\360"
+	.string	"\201p\r<>4\334\205t\204\270Q\327\2058\316\267\207\253*'\324h\367:\231\320\215\252\232\304\231\01730%Z\362\226\2520\335\261PB\344\030\251\032\030\273\230F\177\312P\312X\302\214\275a\231\246\233\037"
+	.ascii	"\242\310\b\032o\331\002\274Xh\032\341^\f\031 \017\354\21314\020"
+	.ascii	"Nd\212\201\333\300\220\240\204C\317\025\315\f\206\326X\240\261"
+	.ascii	"\266k\224\262q\260`\232Q\364\003\023\326\005\026\006B\244\251"
+	.ascii	")\301]\002\006|\252\334P\367\266\266\350\001"
+	.text
+	.section	.gnu.lto_stream_initSocket.52.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\263\001E\020"
+	.string	"\366\336lF\360\260(\035\3760\214\271\007\342PH\265BxY\370w\236\343\244;B}k\216\177\373\3069\327ie\207\327~\2336\233\354\317b\315kZ\337V\207\301\303\344W\344\346\272\035;\273z.\273\211\306\377\222\277\311\2262\245V"
+	.string	"Y"
+	.string	"U"
+	.string	"6\320\235s\330\331\366A\334\366\33171t\241\201f,PH\330\230s\222\n\034D\236\213\027 \317m\313\277sq\365\363_\347~{\204\331Q\003\244\251<v*\337H\262b\007\007"
+	.ascii	"M\026Ej.\277]Sh1UP\311\234\323\n\3226\334\362\266\031\330&\261"
+	.ascii	"u@\357>\363\203.\363KUGU\253\252\3771\312\261CcF\316\272\b\347"
+	.ascii	"\354G\307\324\341Tx\360M"
+	.string	"\274\306\365\022\336\030\230\232m\3169r\331\243s\267?{d\323\304P0\203\203@\3652\276qhN\016\266\024s\316\021\207\\\355\207x\314\367\360Dj\b\201\263\026<s\206#\001\321CEk\247\"\350A\335\250;=\341.\213\277{\362+cZF\300\220)\016\177m\325Qx\335\2343\201\177\002\302\004\217\027\035N\3449\275\001{`\372c\251\335\202V\256]\301\202\036\374\376\366\320\213\317\274\301\203a_v\030\323e\261\037\347\256\330\017\177\321i\036&\236\311ky\254U\207Z\271Z\321;IU\t\305jQ\2206\0358\225\\'\222\204TIEz\2202\001\261\267B\261H-\317c\221F!\354\273\342\337\276\300F\006\212M\f\2717\305v\\\227\3006\306\005\320\006\016\b|\320\221\355\313\037*r\321\3725&\224\036\364k\036\312y\321\271\260>\265\f\"\002\" \200\002\031Y\325\003n\361\305o`\262m\373"
+	.ascii	"ua\032\271\002\270\341\"\330\024\3340\013\301\246\322\350\206"
+	.ascii	"d\177N\366V W\3611\036\320l\327\266W\320>\214\266\322\b\371\032"
+	.ascii	"\230Rt7\2620\333*$\020hy\023\222\022\360Scr\323\210\341@\001"
+	.text
+	.section	.gnu.lto_stream_handleReceivedData.54.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`@\026]o"
+	.ascii	"\272\267\254(M \222\322\031\016\024f\327\351\005\006%-\036\263"
+	.ascii	"a\214\343'\177>\367\016\302\030_\251\342\266'C\340\353\357#\200"
+	.ascii	"\273\336\033\020\221\326\275\033\227p\256\301D\344\0021\203\030"
+	.ascii	"\024T]`@\034f\242Mr9\242\307\210t\275\2474\023\262\245L2x\002"
+	.ascii	"D\002\201\002D!n\267K\\\023\262\3041a\2278w\272}\035\032"
+	.string	"\025\211\003-\017\307\036\r\216\273\355\300r\001\267V\346f\366rK\214S\221)\034\314\352\\A\253Ka\037\027\304\307\244p29\3205y\266\n\341Y\302\33590|\360\253\210\013\t\327\036f/f\211j\352\321\376\266ofQW\024\312\023\216\fp]\327\027\016f\233+\215LI\266\256+\361l\277\345mg.\321\313\277\250w\333!b\235[w\220\204y\361\255=\030\030>\330g,.$\344\362.\352\331V\370j\\\207waD\370\326\025\331b\370 \272\256BB\365Z\266\371\265k}\fuaE\244\216\266W{\341i-|5\"w\216{r\370\326\365L\200\341\013\373,K|p\367\312\261\274\360\3456\321u\355\201=8|\353\272F=\270Q\303\007\231P\035\342\356\236wO\3662\365f0\034h]\231\344}Y\3273\001\326i\370\340\236\235H\370\340\360B\302\007\325]6G>V,\003\302\200\034\321"
+	.ascii	"\327uU\3219\364\350<\237\317\247\322\331z\364\354;\264\035T\337"
+	.ascii	"t\302\004\323\222R\022R\t\022#\216\214\212\210\206\204\202\200"
+	.ascii	"D\374\3708\245=D\236\247\235\241\2160\2106\253{\2547\001q\264"
+	.ascii	"JRmi\267%L\310O\230\330r&t\211\311\r\201\237CjA\231\310\2349"
+	.ascii	"^\f\271\306K@\260\201\302JfOR\322Uv\244\022d?0\t+\037\201\006"
+	.ascii	"@$\206\034\343#\224\2042n\310\347\220V\320'g\0256B\013\360\001"
+	.ascii	"hdM\314!\313\320\2367\307\272\213!\243p\021R\230\\\033%]f'Bu"
+	.ascii	"|\004\201\3629\344\016(\2137|\314\263Q\362\020\016]O.\344\344"
+	.ascii	"A@:\f(\351\322\341\"\232\210!\301\370g\016\351\004ers\003\373"
+	.ascii	"<\271\023:@\334\220\262\263\271\2119\344\026\024h\311\232\345"
+	.ascii	"\231]8\235C\036i\022\341\036\034\272\214\234\210\272(\253\322"
+	.ascii	"\344s\310\"hcQ\023s1G\230\347<\214\374\211M\f\311\205w\316\374"
+	.ascii	"\260.\f\254\215\222..\037\232P\322\225\274\316\321\356&\304\220"
+	.ascii	"I\026~\016\311%\210\006\240\214\033\342\303\345\003%B\263$\217"
+	.ascii	"\310ed\024M\340\255\206 \237Cz\241\354DM\2333\317[\\=\270y\270"
+	.ascii	"\204\234u\030X\327uY\213\253\353\213\342\273\354fwK\330\025j"
+	.ascii	"\006r\252\0243j\017\252\017\227\373\216Z\330\231@>\037\215\265"
+	.ascii	"\302\336\332\3460\275V\337\212\016\266\260\273"
+	.string	"\214Q\231\305\3171\226!\330R\311\270\261O\t\211\274m\252\347n]W\026g\376\t\013\255\212\222\314\217\205\236qogx\202\t\350\275\235Z\246\002\301\327Z\264\261\376\003K\016:\b4\211\245\232\333m\003\334c\233\303E\240o\367&7'\237\262\354az\030B\330_K\3746\205h\023\223\364\321\3411\026\013\333\034\356\367\255\033m\213\210\022\357>\020\201\360Z\335HiB\340\002\371\262\032\353\247\362\203\221`\177mO\232\020\263^\3215z\253Fw\222,\177K5=\370\r\017\261\022\004\332_\033\365\025\335XY\334,\313\364\3407\313\275\242\317v\234S\202\243\276\300\363KFx0o\243`\250\365\336\265\340\002\276\0267\323\261\261v\027\203\303\321`\bl]W\251\375\033U\311A\322\335\023\030\204\017\276\317<\372%\311\026h\306\203\237\273gYo\201ue\255\373k\317\027\266\221\t\334f\262\233\362^\021yG"
+	.string	"\342\275A\344\2651\304[U#\345\245\221\362\316Hy\251R^\021R^\031)o\214\020R^\020\036\346;5\304\013c\210\367\203\277}_4\257\007B\274\035\b\361r \304\273\201\017\257\006B\274\031\370\360bP\201\004\020\034\357\353\"\345E\340Z\276+n\366\023"
+	.string	"\205\342\351z_\247\224\267)\345=\221\3622\245\274KD^% \336\244\224\027)\210\267\004\221\227\004\020\357\b \336\243\224\327\210\310[\004\304K\024\304;D\344\025\002\342\r\n\342\005\"\362\212"
+	.string	"\342\375Iy}R\336\224\310\333#\202\227\370\303\313\363\274\357N\312;Ly\205)o0\345E\177x\333\207\227S\336\253M^pdp\370\302\200\264\335\331\032\344\031g=\023dF\371\337\377\366\207\371\315\374t\277\337\217\367\347\375z\277\226\237\355w{\317\356\377\366\200C\254\002I'\340\336\336Y%LM\337\335\334\370\336\036\351\301\335Ps>\022\276\267#\324\340\300\354\327\\\357lT\246\235uUR\344K\036`\030\234\004C<\253#\375\302\202x`H\302nZ}T\33665\004\352\316S\303\374\351\236\026\321,\320\322\376\351\026\316\343\034\237ncK\333\247[8\213v\314e\233[\212\316\026\323]\322n1M\326\254\324\212N\226\303lz\344\222\244\345)\313\314\204(\340\024\347ib\357\335\024\327\024\365\204\215\0254\243\257\325\227\342T=\243\223\326\030\343d\001\005\271\364"
+	.string	"\375x\3603\311\317\016)\202\252\217\200\254i\241\246-\311O\177-U\213\320$\226rX\336\250\232\365\266\316T\3456\367O\366\213\b}7\177\n\313[\332q!b&c\217\313\254\310\212N)(b\337\312\276\245w\3056<\266\315a\321\rW):\357\004\273\020<}6G\251$\365\226v[z\377\300\030\271\342\343S\327\247\304\251\231\354\233\377\017#\027\224\236\250_\314#\360\362<z\341Iq\0312:9\203\0244n\350\234\244\375\265D<b\b\335:<E\375Eo\305\350\027}\034\226q\177Le\233(zP\261\220b4\212&f<\320u]\327\236\024\177\321!\364\233\017\222=\355\214\312,-G\230\204!\366\327\020\204\236\021\310b\333\034rXq\255\bg\377\244\005\341\203 t\320\206\347\230\031\214\366\240\247\372r\214S\216>h\030/\372\203\026\262\035\347\310a(-\f"
+	.string	"\366\266\305'\357\240b9\335=\350A_\3149\016\b\277\246[\203e\215Gj\216\214\016O\315D\200\017{\306r\033`'\303V \231f\314L\001>\2303\325$C\002|\250G"
+	.string	"\346\236gV\310\300\")7\326F\301\017\330\252[gZ\351dm\355i\325\300\203\231\250?|\356\326\325x-5\310\320x\001\224\312u\246*\244\205t[vZ5 \241A\365\022\356\2526\234\251z\251(r\346\352\255\324N\222\213|\231\333\\\2513\337T\226\334A\247s\272U\217\274n\233\f\026D\013\302\b\001l@\324O\307I\253\275\326r\rl\303\324\246y\235\232$\005\013\242_=!\235\272D\375\342\272[\020\206$\220\317\330X\333A\016,d\335\374\222qK\273-}9\320uU\262"
+	.ascii	"\037\026~.\007\235Aw\320\234\306\355\306\"{H\306\300\t\373\262"
+	.ascii	"\356.\360|\216\351\261\256<\2326h\016\372F1\rz\203F\331\232\\"
+	.ascii	"Nu\242A#51\303\2403hNc\344\273\231Uw\270\234\032e\210A\367\225"
+	.ascii	"<2e\231\031\024\253\370\317<[u\202U\t\313T\243J\005\253*\032"
+	.ascii	"UW>:\256\250t\344\b\332\3301\243U\320\301U\247\322AU\003\255"
+	.ascii	"r\301*\007zUuB\225\216\034V%"
+	.string	"\f\255n\002U\325\225\216\034\302\2451@\r\252\026j\2508\301\212\312\004\0253\254J Z\034(T]\251\320\201\003\307\225\n\342\031\0178g\200Gg\355\254H\276\215\275\215\f\234\246\025\330\334~\346\201\370\260\030 \226\306\313\211\246\356\365y\242\233\372"
+	.ascii	"=#\017r\266\031\247\350\354\264\277\023h\233+].\340\252\036\241"
+	.ascii	"m\364\236\257HWL\243&w\346F\333\350\021\232\331\214S\262n4Z\346"
+	.ascii	"8'PUZ\255]\206\360A\033-u\203\332\026\021\032]\325B\345\3638"
+	.ascii	"g\247\257\232F\237\357PW\342,\355\322x\310\212\001\256\211\211"
+	.ascii	"\376\372\333\346p\210\242s\351\216\b\214\007\2574\341\023&G\230"
+	.ascii	"\224\240z\247\267R\244\025\231\243\304\324WW\275"
+	.string	"\323\224\244\213\224\236)q\322\226\320$\024\355\223V\304\fQ\324\241z+\265\222$A7\036Q\324\237z\353\251\231\372T\374\266\231\302\215\022SP,\271\027h\206fL\017\\\224\372k\357\374\207\244\335\320\206\004A/Z\004\325(zk%\200A\367\343\311L\347\022,\311\017\2004}_H;\374\216\200W\2261>,\034\305\031W\242\277\226\332\205\275\245\206\221|\006\232=5\004\315\263$\310\020w\036\216\356\217\204\003SDwK`~I]\324J\315e\214S\262\222\232\323\034\347 \031\335\265s\200\0335R\023\263\202x\031\276\225%G\364\327\246\237\022\226\350\343MPbD\0275\t\365B\302\243\036\321h\031\243\322\250\217\032\325\373\b\262#Q\216\214\272\321\250\321-\315\0309\267\371\324FM\\\002\3713\362P\324N+\0370nj\365\021\265\213.\202j\242&f\001\331;\316\251S\177\020\305p\252B|x\226"
+	.string	"q\252^H\356tJq:\337\324F\355\211\262,\271\343O\312\377\007\310^\217\372\377\230\314\230\300\003\376\001\362\361?`\316\243oIg\025\277(\032\356\260\214\372ky>%\034\352\253\245\032\267\027S\303\241\376\026\221\240v\321B}\343\224\247\016j\236, j\3079\315\2571\037EoVKw`\212\316!\221\213\226J\356\215\231\021\365\327\352\340\tU\320\215\347\024u\247\336Z\321N}*\313\270\036\374\346\306*@\350\206\234\272\202\376Y\376\020cT\002\365\262[\214\251\316\002f%|\320E3\201\330\250\221$\305\030S\210fDD$I\2224\006\341\004\304()%\274\033\022"
+	.string	"\2069\210\035\233\031)H\222l\354\031b\003\202\263*j\017\007ar\335l\\\266U(m"
+	.string	"g\215\316kTZn\fM\231\b\f\034\234\006I\033:sV~v\214\307\"\002\320\214\244lQ\236K\262\272r-x\344\t\2627u\377\352\017\340\031a=AD\230P6\345;\271\005\fI\206\314\211r\252\303D5\240\266?\003\232\355\231@(\366\254\353\245\317\007\340\271\231\243Qa\213\335\001qD\225\274\300%\024A\233\334I+\3313wfxU\027f\242,\314(,\025\302u{Rb\016\362gG\027;\324?\311\016x\266\277\267\004\302\225\032\230\005\235%\214\334\361\275\372\236}"
+	.string	"\213$\372\342\237:\222K\026\331`\210\222P\353d*\023\256\331{\372\035\t\252\310+\017.\207;c5]\321F$\006S\244\030\236\020e/\t4\213Q\375C\200\241"
+	.ascii	"\260\360\240y\230;\222S|\270"
+	.string	"\201\351\n\375\312\370=\016\215\3007\231\243ig\177\277\035\371\t\027\232>\236D\337\003\244\320\236\341z\177\316\267\b\223\216\241\370\362i\023\251M0S\355mY\372\255\314\347\231\365W\260\b\207\277wh6\243\372\342z\006\t\331\356z\272q\263\317\320p\003\247\307\027\252Q[593\342D\004\326\351\374\353c\363\241\274\367\374\341)\337\377\371\305\025\316f\006\362%\252\245\353(\331\031\316\237\315\227\023\3564\317V\200\217\336\035.KN\r0\276M\225\027r-h\004\013\212^o\324\316\321'Ro6\232\232\204\215\302[F8\315\214)T\215\241\351\0174U\370\035.+\362\303e\353\255\232`X\355H\267\035\2167c\206L\362,\203F@Q\271$Fc\327\217M\206\0343\260\313~\371\037\377\337\r\355x\276\"O\n\021\221]\004ARu@A\215\232\366\276a\354\275\221\307\261\222QF\324\374\360-yQ3p"
+	.ascii	"#\324JI\220\325\220\365\257\376\302CM!*)\016X0\357\300\n\013"
+	.ascii	"\335\352%\300CW\313\263\321\004|\330\357\341\267\331d$>\004\301"
+	.ascii	"\325\376\317\353\221\227(\316\203\245\372\035\323\267\325\366"
+	.ascii	"\354\302.4\341\224\264H_\021\245\364D\205\345\315$\354\213s\017"
+	.ascii	"\361\341A\017'\250\352\232\246\216\006L!\355z\030|8\250\237t"
+	.ascii	"8\013 \005:\022\231\246?\342jd\372\340d;\002@Z\313\370\347M\334"
+	.ascii	"+7\277\234o\263nH\256xg\252T\031\265T}P[\2008\256\311\004\273"
+	.ascii	"R\031S\273\247\300(%\256\260\225\366*\177\322(\264\324\201Y\003"
+	.ascii	"h\262U\f\211.6\262\013\232\336^\342Y\243\006.\320\254\364\226"
+	.ascii	"\202\206\020\2605\270\0359\212\333\214\272\263\032\302\r\207"
+	.ascii	"Oc\205~1\365\024\346M\3604\244\237\273\330p_R\307\021_\243|\250"
+	.ascii	"&@?\t\375\233IZ\215\034\b\2244A\227i\201\f\341^\223^\2553I\341"
+	.ascii	"\350R%f\n3\231;M\337\316\317>G\336C\037sJ^z\035\323\223\340k"
+	.ascii	"\272x\332\223A\242\306\340\234Yi\326\367\222{\006F\221\206\336"
+	.ascii	"mh:\315n_\255y\375 \201To\300X\0269\022\002\025\200$O/&\340D"
+	.ascii	"`\212E\256\017\345d\273\275Y\027\315\337%\314\266\221s\230VJ"
+	.ascii	"\374\027\323UW\270v\256\203::\005\035\375\334\001\216\331U\251"
+	.ascii	"\231\002\f;A\360\031\273\313\215\355\007\372\211\020\237\321"
+	.ascii	"\361\217\325\036hx\307\013\321\n\202V\223\035\246\313\\\307Z"
+	.ascii	"\037&\310\210\323\343\007Ke\366_H\221\006"
+	.text
+	.section	.gnu.lto_stream_acceptPendingConnections.55.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\301\005\355%"
+	.string	"*E \017Cp\252Mc,\332\034.\b! 2\273\307\272\302W\034\027\244\340\022\223\350\017\271IO\273\005\210\236hP\332\272\273\331\373W\007\263\241\376\241\224M\223\251y\026j$d\255\351hu\223\362\276\355\336[\312\224\002\332"
+	.string	"\323"
+	.string	"\342"
+	.string	"^\376\345\304\217\271&\006\352@-\241\326\361\336\241\0060\017\223^\354\206\200\033\347\022%\021>9^) I\347K;\324\360\001f\230\215;\346\b\241`8\271\034,}\227\247\337\252{\036X\302(\307{\357\321K\037\235/qd\016\273\366\262\326l\277\332\357\272W\372/\250\033\335\213%h\314\275\303\n\206p\276\364\360\005\314\227\347\007\230/\235\332|\016L\335^\006\341\025\225\027\264{/\222ub[\323\237CfI\332\232\372\275\237\327r\022K\220\f\314\216\330V\220\017)\020\246\351\263\244\312\352&U\r\350\253%\271\301\013\313\023\313\345\313\231W\001bUI\262\001\026\222\264"
+	.string	"\300)\022\267\346\214\352c\257=\200R\325\002"
+	.string	"\006y\035\362p\357u\375\001\253n\242\333\016\332\266a\227M\002\275:\345\346f!m\226\323?\231E\366\200\217<=?r\360HUA\026P\375\234y\343om\035Z\377+\2628\237\355\331~q5O\013\264\356\275I~\032\030K\021\356H\2012_\336\022}\235\311\264c\334\f\223\223>v\362O\320\210\366GG-d\017\243N\336{\257\265Y~\235"
+	.ascii	"\347\r\030[,\333\350f{\227\273\350_?\200\363a79Tm\317\352:T\375"
+	.ascii	"\007F\305\343U\327\226\222\007\003\335\373\243\020\241{V\226"
+	.ascii	"\241\362\262\277\313\037\366\213\375bn\032ZU\001\300\212\240"
+	.ascii	"\351B\273\275{d\332\367\313\274\3147s\215LZ\343E[`\021\253\206"
+	.ascii	"O\306\265\032\027\273A^\253\341\355m@\003\246\013\355\336o9Y"
+	.ascii	"\216\027]b\214\320U\327\275\267\366\241\037\276\016\021\322'"
+	.ascii	"'\246Q\254)\347\310\231\337\220\243)\\TNL\271\374Th\332\351\326"
+	.ascii	"\211\251\020\311\312\211\336\343$\242\037o\242\215\017\200E\254"
+	.ascii	"+/\253\033\344\275K:\034\271\324B\256\267\321|\231\323+7\263"
+	.ascii	"\261\226^\322<\250\031\3565\346\321_\366=)\227\363\\O\352e\274"
+	.ascii	"Y\252\305\246\365\363\036\263\354\003\b\263\227[I\320\216\013"
+	.ascii	"j\b\021\r\252\234I\331\236\021T\n\277Y\237l\004\211\372\237\377"
+	.ascii	"f\353l\312\366\\dO\346\027\257\363Tt\307'{\205\362\325u\345u"
+	.ascii	"\244\302\355\022\237c\343\311b\311\206\"\350\006\355\217\201"
+	.ascii	"j\237HQ\377\273\331\233\357\312\320\366"
+	.string	"\031\333\002T\332h\332,\002\037y\266\370g8l\264q%\305\267\231\371\322fm`t\210E\006T[\305\n\363\277jo>+h\322\216Q6\346\315@u\272\034\256i\207\343\2418\224\227C\235t\270\035\017\247\204\312X\312\271p\340\246\335\022O\20765\355t8%\2247\003\325\351r\004P\336\216\tu2\321;9\241V\311E\f\335\216\206\311\224C\235x4L\353,(\345\236\224\220\232\226rLH-\226d\024\360n\006\352\204\304\333\355\234\220jC\035\367\240\303Fa\b\262\311r\017\243N\233e\213Y3WI\262\f\215\375?|W\212\345\315\032\331\036&K\322\236I\365\264/\326\250T\b\003-\"\247\317D\204\227F\301\324\210\r\343\272iG_\002*@.\323fY\206p\n\025\031i\263JB(Td\366\350\244\355\3416\267\266\005\030\036\251*\250\336\247\323Z\016A;i_\027\352\213'\246ZN"
+	.string	"HR%\022\354\004o\326N\231\234\b\265!H'mP\232\025\340\316\275\276\377R'gq\250a,\304\230A\3120#2\"\243\005M:p\002\2212\243\036\021\360\311)\032\r{\006E\027*\221&\204\tM\007xM| H\255\3517\302\303C\037"
+	.ascii	"\230\251H\323_\311\345\345\317\257t\006\0379\335\rB4\021\314"
+	.ascii	"g\357\250\374u\030\r\317C\327xB\215\013$\001\335\311%d\300o\333"
+	.ascii	"I\303\270f|\354A\225\260.^\201H\260\335\272Un,\374{\017\017\236"
+	.ascii	"\346!\271\214ePg:\252\206T+B\265[\022\347\ts\333\007P\276F:\203"
+	.ascii	"\346\302\3266\214\221\240\332\345\2757(\240\377\217\355r\263"
+	.ascii	"7\344\210\346\312\262\032\002\215\323\203`\272!\244\\Y\210\376"
+	.ascii	"PYH\315Yb\330WY\177*IT\005\017\200\323P\203-\316\371M]&/j\247"
+	.ascii	"Mt\303K@D\033\305\177\336\230f\366\003\356Q\212z\030\346\306"
+	.ascii	"8\354\257\234\204\031\350\265C\032"
+	.text
+	.section	.gnu.lto_stream_flushWriteBuffer.56.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`+\nu8"
+	.string	"jat\025DP^R\007}\3030\374\264\321\\\200\264\005\273.O\031\034\340\006\3355v\223\006\261\370b\ta\204h\257,\350\330\216\232Co"
+	.string	"\b\b"
+	.ascii	"\240\253p\314\034\313\013s\\p\244\373p7\215Q\332\256%;\245\224"
+	.ascii	"\002D\001,\001O\0012\302\364\033\215^\343\177\306\205\321\340"
+	.ascii	"Nk6\3566&\242\265W\275\306\254Y\\\226\350\330\275\267\273p\253"
+	.ascii	"5\030\236\036\261\244\367\tD\022\235\273M\301+n4&\236\265\227"
+	.ascii	"\253\376bc\275]\322\333cx6\2077\246\347^.\245\376\261R\260\177"
+	.ascii	"}\203\232\210\271e&:s\2275\227\266\2457Z\350\336$n\304\334+e"
+	.ascii	"b\004\301\376\2614\310\314\334[z\254e\236z\310R>\037P\241k~\321"
+	.ascii	"s\357u:\266\021\260\177k\023\001\373\367K\272\355!\241  c\361"
+	.ascii	"\2078\024\006Y\340o}o\271\207\317d\017\t\035\341!\326A@\353\323"
+	.ascii	"\3323L\333q\205\255E+s\2464\365\313\215\353\321\216Kl=\232E\275"
+	.ascii	"H\244\177\210Gx\f\351\341j \311\327^\333qy\255G3u\315\236\302"
+	.ascii	"\005ua\253\365\207\345\327\235\363\371\243\203\007\216\360\350"
+	.ascii	"j\266\271\032\301\365\201)\\]\016l%\223\376\255\016\242g|\030"
+	.ascii	"\237\314\325H\r\2228\304g\226\257k\0025H\342\264\035\227\220"
+	.ascii	"\365(z\306G\253a\371\257\t\264\354\221k;.\"\353\021Z\026\223"
+	.ascii	"6k\327z.\335Y\r\367^v\347\223G3Q37\005f\036\301,\374\021\377"
+	.ascii	"{\3403\213\030\341\355d\377\330\374$3\223\350\273\022EaH\300"
+	.ascii	"/\022+S\232\3506R\027\3300\375\376\202\330\377\372Q\272f\237"
+	.ascii	"\216\213\302\344\355\037\214\225\372\377\350,\r\226\357a\346"
+	.ascii	"\023m\307S\2440F\321jR\364\317\370o%Do\257\314\237\356\007\257"
+	.ascii	"\235vn4O\201\375\376\356\326\354Z2T\237\341i\360\336\213\344"
+	.ascii	"6\363aE\320\311\r`\377\372\333\254\223\236oE\242deJ\2572K\227"
+	.ascii	"\376`\314\375\325j\265\312\237\204\271\350\214,:O(:K\030:G(:"
+	.ascii	"?\r\235!\b\235\233~\234\231\204\316KAg%\326\331\001\353\334\240"
+	.ascii	"\3014#\265\264\373\210u6b\235\213Xg\"\326y\210u\026b\235\201"
+	.ascii	"Xg#\353\\d\235\177X\347!\353,$:\007\207\316,\353\f\024:\377\202"
+	.ascii	"\316+\353\374\254\263\263\316\235!\251\t\2301>l\250\320\375\235"
+	.ascii	"\364\356\250\362\335\272\037\034\224f\353\226\353"
+	.string	"\006\323\317\334d\346\330\b\r\243\207\032\327\323\266\345\252\202\256\335\025\026\261\002\315\273X\021\202\375{i\205&\002\216i8\031\275\306\002\372\346\002\255X\204' V\006\341\237\336\3330\363\232\215\333&\335\326>AB\3707\2133\026%+c\340N\335n\335\326Jak\251\264V\332Z\230&\245n//\353\223\f\364\312\"\236\361\201\336\373\230\321e\213\305\257\361\221P\264\2758?\305\357\323\367\363\305\267\320\307\214\302gO\212Os\276\260\237\265\216\232\270\260(YY\222+}\323/=\367[\273\245%\3534\272:\346'\231\351\227\276\351\335\215Ye\311\364+\232f\037e\347\371 \305\355\204\347\272\345\002\354\337\322#\277\322\264\240\016^\351\201\321j\263\217\322\253\016\276\337z\201\031\337\331\035Z\224%\206/\272\"\304\007\273\303\323\240^\n\003aEaQ\250\227,z,m&\331\206H?|\025gn\354\360TA\035"
+	.string	"\303\006fo|\334\247\244\016\2160h\300\217\236\033n\003\007o'\257\237L\220')\3076\370\24337\r\307\035z\0167\370\206\353\2441w\362\242de\026\306\234`\300\007\353^\212\251\322\346G\024>\320\314\316\0327\r\007\006O\203\334\034\007\354\237\360\033\215\026t\2003\203\b\001lg\360\215L2\274\275\274\345'\231\212C\215\315\212\364\237|\303r\206\206}\244o\267f\237"
+	.ascii	"\256\324k\fe\005\305\342\030E5%u\244\232jq\274b\001\025Eu\254"
+	.ascii	"rq,\020\325Q5\\T\2553\254\\\n*\212\312\252\n\310+\232X@]\261"
+	.ascii	"p\202\341\002J\312I\205\213\027F<\025#\212\312\311jj\212\312"
+	.ascii	"\211(U\366z?\t\267Y\367\026\223\252Ch\251[\255\333\007\223\213"
+	.ascii	"\216\237R\033\275\0263\033=kP\376r\275\367\336!\347\203\302\346"
+	.ascii	"%t\301{\256\251-\216#\255v\213\301\0332uYn\244\335a\304\273\227"
+	.ascii	"\331\316\366\031dNX\320\366hj\373\343\303\200k\230\3209\201("
+	.ascii	"\005\221\022\322T)\207z\265_D\232\332~95sk\244\251,\207\221B"
+	.ascii	" s\213\244\251<e\344\023t\252\245\253\350\177,5\321\027\275\243"
+	.ascii	"i\372\200\362\036D\217\204\306\365\022\275([AUr=\006}\323Bf\003"
+	.ascii	"\007'\323\032\260>\271\204\006'\t\264\324C\257\242\203\357\030"
+	.ascii	"\372\246\366Z\006\r\243\245l\213\327\226Q\350\217|\213\247H\236"
+	.ascii	"\303(\364m\326\266\367ax\256x\025\221`\356\3441E=h\332\362n\315"
+	.ascii	"\216\215\365\336#\031\232\255;\257\213Wy\302?=2:\246\231^t\212"
+	.ascii	"\224\341#E\314e\316P\255\226\301\272W\231$\341'|3\247Dx\t\277"
+	.ascii	"\272-\351\266\200\314\250\201$\246\230s\210DDF\222$\3110\006"
+	.ascii	"`\"\031\203U\017\021p=R\216FS\220Ba\330\r)0\211\231\301V\261"
+	.ascii	"D\362\202(\312UF\355\324K\250\371Y\223\334\337i\223\276\262%"
+	.ascii	"\235\377p\305\246\n%H)~\302\250h0\021e\215\305\003V\213V\255"
+	.ascii	"_J6\200\211\2222\326+\005\006.\250\300M~\337\300N\227\374/lg"
+	.ascii	"\374\362@\013\354L\f\233D8\nu\235\366o(\341\216uA\257\001\273"
+	.ascii	"\246\274\240o\340\234\250\305&\b\356\347\371.8\315\263\274\\"
+	.ascii	"i\243.\226\017\362\304up\006\007\037\036\327\345\007\364\034"
+	.ascii	"ZI\334Q\027\330\317w\2351\264\300U\275\223:\262\371K%\266\237"
+	.ascii	"\203\300K\025\234\342Nd\365\377D\025\333or|\243\276[\32039i\310"
+	.ascii	"A\2278\234\321>\204Q\277<\263\234\234\332 \031\016\020G\343\340"
+	.ascii	"\n\221>\300\264]\210\270\031!\322\037\324z\r\231#\331o\244\265"
+	.ascii	"\342\357br%\006\024\035\001\033\361\344MB\363J\263Y\242^(\361"
+	.ascii	"t# 2\224U^\325\376iIx\374\207\204c\323\307q\327w\266\205gF\310"
+	.ascii	"\205\263Hm\226\026q)\224\227\315Heiz\316Y\305\242\375\030t\226"
+	.ascii	"X=\321\033\t\241\217\363n\207i\0026\366\027\231D\304\363\321"
+	.ascii	"\313p\030%\002\016)K\206\033\311\364\335b\311\3541^\253\b(\233"
+	.ascii	"\307\370j\2273\254\310\360\234\211\345M\020\320c\237,\305H\001"
+	.ascii	"\207\214\306\200/\227k.\365\326\fF\270\262@V\021\277\371\236"
+	.ascii	"`\211\233\0068\255\310L\372\034\214\274\343~RV\251\001"
+	.text
+	.section	.gnu.lto_dyad_update.57.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\221\027\215d"
+	.ascii	"\032\2354#O0\016\323\351@\247\334O\363\342\304\310\314\027\363"
+	.ascii	"\306\260/\037\252\266\316\232\333U\266j\225Mz0F\2610WYmr\307"
+	.ascii	"\032\"\317x\203\240`l\027\023\3428\347;Qg\027'\334\177\331D|"
+	.ascii	"z*\005\0061\367U'4\272!\321\356\226RJ\001 \002\361\001,\002\315"
+	.ascii	"-\246\361\270\363\356V\017\272\216?\215]\237\007\334w<\364 \205"
+	.ascii	"\227\265\206\241\355\270\235<\344\002B\327q\220\210][\341n\266"
+	.ascii	"\\\323\361p\216\343Fx\003\245\314\363\336\244\003\266S/\375e"
+	.ascii	"m0;\372^\335\006\342\004\212\231\347\275o\n\330N\211\300\030"
+	.ascii	":n\355.=\216\30343=\346\337\225Ja;}\264b\373\250 ps\341!\b^\364"
+	.ascii	"\336\362\260\334\206\366\274h\261\373\332b\262)iU\371\273\322"
+	.ascii	"k\314C\016\241\255\360\303\341\351m1;e\016\201y\330iN\227\365"
+	.ascii	"\224V\343!\225N[\273\212\217\236{w\333\212\353\211\333\363^\264"
+	.ascii	"\003\320l\233\365\331\332h?\200\027\013\355\232 L\013\373c"
+	.string	"\376\335\233$\321)\237\260\235\366m \265\323\236\366Q;\345&\353f\362\031{\357\321\232\2239@\247<\302v\312+\363\231F[^\017O\332\250\324\376\356\275I_\204\217x\370k\2178\022aD,\"\n\001bH\350\203\207\016A@?>\0346\364h\340\331\321\031\n\2036GM\201\357+w\026\271*\253c\217\320\262\202\037\3450\320\302U\226\026\301\326FlbI,Nd[\363\"\24233\017Q\266\006b\210\350\265\346dB\305\222R\\(\n\333\007\017R\272\003\260\350\213\005h\337%\307\200D9'U\323)\361 \262$\016\204D\013\231\377\234\265\317\331\021\347\340\202[\033m \212%\317\274\247\357\222F\226\256\001H\300\326\334\t}\227d\001\b\024\306\313L\277\265\221X\322\210\3630\267\302\214\234\245;/\345\311$\353\272\312\322:\300\234)!I\372.\251\005,\266yr\211\362a\013W\312\026\226\020D"
+	.string	"\210\005>\201\303$\307\250\353*\253U \361.\231\005$\336{\207VHO\201\004<\341\330\360XM\001\201\204$\251j\265v\022\254\220\016TA\252\273\222XB+*UG\206&Yl\324\225\314J\277\325\372\001\257$kLh\327\225\262=\207\201{/{\225\325U3"
+	.ascii	"\315\374:\314\374\203\371\347MZJ,\373'\262\242\320\277.\226\201"
+	.ascii	"cs\036\t\205!Wz9\177\"+\016\233.\226\361\313)r\365\221\222BJ"
+	.ascii	"X\261\243\247B}\245\2547\234\242\355LLM\177h\325\204\222FF\312"
+	.ascii	"\333\220y\025\307\215X\362*\305\201\254e\235\002\351\245\337"
+	.ascii	"\311,\277VA5\206H\372`L\242\201\257#m\214\224\267a\244\376\007"
+	.ascii	"\376\357QaEy\364\314\251\376ad\261\201\026\271?\211n+>\345R\r"
+	.ascii	"8@D2\004~\\\241\243\227b\351\177\"\213M\273i\016\2728\217\016"
+	.ascii	"\207\345\254\234D\001\037\214\343pG\201P\252\336p\001e\226\334"
+	.ascii	"\013\345n\343\315qj\247\315u\237\304Y\342\307%\216\376s\265\236"
+	.ascii	"\270y^\256;\300\032\356-\273\274\311\213v\007\030r!=\0163K\320"
+	.ascii	"j8\316\336{\225\270\371\326(\023\3300\037j\247\375.\262\326\220"
+	.ascii	"\231Ay\364\2574\245\356?\030\243\351\247\017\3560nA\001\005j"
+	.ascii	"\247&\036EV\037\031\026\224G9\310\333J\3571\331{\241\312\264"
+	.ascii	"\231\n\270\303:\345\027L\336ULj\f\031L\247\324\214\027\2328p"
+	.ascii	"\342\344qf\247\r\274\253\270\255\310%\241\317\250?2\243E\371"
+	.ascii	"\2031wq\331\306\215\377\213\331:7Y\347\f\254\363\214\2403"
+	.string	"\006Ag\031A\347\013\204\3161\202\3160\204\316L\326\331\002\353\374\302E\013\353\314\302:/Y\347\242uVBa\342\250\2534\213\260\316F\326\231h\235\213\2543\221u\036\262\316B\326\371\203u\366`\235;X\347 \353\fd\235\177\206\316>Cg\016C\347\rB\347\236\240\263\206\2403O\320yG\350\254\023t\036Zg\241u\016Zgk\235s\254\263j\235S\353\f\264\316o\235\335:\267\215\243,^\230P\347\223\266\237\001\355\n\211\276\271\316\224\213\222\266\353\306\353\356\322\r\246{\256\033\255\273J\3470\007q\300{\273\026\350\271&2\362\244\342QV\373\260\334\357j\341\225\236\231\016C/B\032\231\271\036\3724\214\035s\253\fK\205w]\313\255T7\352\232\216cx3[a\035\247\221Z\b\310J\302P\0207s\300\336\2416\230\206\241d3F\202\256\201f\3125\177}P\036\r\262@\350\221\3160\355i\261"
+	.string	"\350\305\013i!3\346\305\267\226\031\204~I\331\307\326E4p\316\237\004\204\254Vd"
+	.ascii	"T\271\273\362)~x$<3b\334\212\234\306NM\020\016,\376\203\233\323"
+	.ascii	"\216\305\267\033\235\336\207_R\356A\327\272;,,\nr\203\207\027"
+	.ascii	"A\316\303\303P\312@\246\344GC\326\024\334\013\232\024\234R\177"
+	.ascii	"\36413\267\246g\351[\255-_\032\031\003\274\203\027\246\207\253"
+	.ascii	"[n1\275\371\266*\327\025\274\253\226^\375\243\tC\232\032\224"
+	.ascii	"\276\303\013\245\325\365[\f0(}\277\265c}9\331*\203[\301\243\247"
+	.ascii	"@\207_R\346\221\231\271\226V\241\311\277'\027\317\203\261o\341"
+	.ascii	"\216N=\2265\346X\033\027\200eI\026\3566z\216\205K\360\031\036"
+	.ascii	"\345\336X\225_\tr\265\261\240w\241\264\203N]\355x\032\212G\241"
+	.ascii	"\254\203\232\230\262\022\251\332\360\034\336\347\201\274V0\340"
+	.ascii	"\305\372##\365\317\003}\b\344V\224G\213\370\331\nk\366\363"
+	.string	" \214\230!9SJ\363/\212O\t\037\2032\366\002\207\017\266q'6Tes\354\336[d^\215x\223\365H\016\345\334\237\330\206W\225M2.=Hz\312\252D\303\367|\257\201\353\276+\026@\352^\250#\236\327\360j\033Rl\347\207\317\363\215\\\022\265\363>QQ\266 \237:\317\2742\351)k\023\327\253\342\033\276\3167\262\316\303\034\t\303\255O\370\315\273\212\337\324N\207\377pt\\[eu:\017\306<\3104g\204.^\245C\272\211\027\361$t\232\026\361O\244Y$\032\215S7\204\342.\370\260AK\027_T^\351\353v8I\241\360I,\213|-\205\177B\251\006\247\213g\206\004\203\337\320.\"[*\202?TE\005\033D\036O8\2105n\364x\242\001\202u8}\240\303i\007\361\211\007\261\206\323\317\215\246\017p8\335\340\221\343Iu\352\016\232\234t\360\330\241~\300\303k8\335\260\321\364"
+	.string	"\017\032N8p<\321\330a\032\005\324h\n\241F\022\016\033M\035$i`\343\006\020?\345p\322\221\304\343\351IG\322\020\r\252\377\313\362\3719\241>\212\177\240=G<\030\347 #\243\332\"\242\305\253~]tP\374\321\321\013\005A3E\215\0302\300\243_\342#h\331\342\213Zs_\"\212|tN\251?r\226\024\334\00412\372\3401OI\032\231Gb\364KZ]\310\314ZL\031*pD\342\3771\357\b\264\213\236\370\376G\212~I+\016\352V\272\212\214W\370\240\0205\021\375\222\351\213\2545\205\310\340\211\326x-\362_\357\225\301\367\332\023Y\022\375\222V\033\231[\027\371\232\200\210\341$X0f\031\261l\263\310\246"
+	.string	":\335b\204\343S:\233\331\226O\005\24387/\f\315"
+	.ascii	"\200\t\236\227\320k1=\023\274W\262\315HB\202\235 \324l\335b^"
+	.ascii	"D\324\210\251\343+_"
+	.ascii	"\315#\037\272\347\\4\215k\2541\316\330\214:\247\336\004\343\027"
+	.ascii	" \275{\221]e\224\263H\026\001\030\351\272i\264\343\021z\235\371"
+	.ascii	"U\241\020&\215\230n\032\323"
+	.string	"|\ty\334\3061*\263q\206n\032\307$\225\351&\357\261R\020\013\212\233\034\307JM\327GeX=\236T\342t\343\261q\257\3638\316\227\251\332\027\255\b\034E\263\234J\242\033\357\247\214i\270\253\370\243^\312\250\206e\350<\343\232\235%\357\251xF?#\324\363z\002&\\\320'\362\217F7~\030<\263\021\216G\031\256\351:M*\341D\315\300\306\367C\306\303x\f\266\242\220J4\\`\3340y\273\314\013D\243`.x\031\337H\261\030\177\301\003\333\234\253\222\030\017\302\b\323\303x\317C>\355\234k\023\246\377)f\230[ef\fxRw\230v\332\255\3075\312\331\301+L\234\320\347\324\037\271D\373q\234\375\321\241|\363\327\027\374\322\007\304C\217.\035\334\001\246\203O*\001\201\363\250q0\347\024ShFDD\222$\2054\006\201\005\204 \306\230\253\365\021\360,s\214!\022!)I\2621\007@"
+	.string	"\020U\271\300A\n\201\022\210\024\307J\355\334\306\373\001\006"
+	.ascii	"\034\37457H\303.\323YCF\r\276"
+	.string	"7\250I\f\340\004\216&\267\353\301\260\333Y\333\301\037\310\212;%-\"\336\203\304\364\370u\206\311p\"\213u\340\356\032\245\031\362\215\rp\256\t\225\013\022\310\n\207\344]\024\337\247L^\327\2646\316\321\304\310\225\0241\311j\374\375d\353ui0v)F\034\360\260\372\001\276\304\224\261\232\026\2013\005Dl=\2413\244i)\210\355\235\303\212\005\343\003\2222-\333\250|\027\263 \212\272\357O\032\351$\374t\316\322\256\352\326X\357\241$\255\271\276g\023\025\260\004\314\270\374\262%3\3175\201]\005\241v\336\356<3Y\2175.\317\361Z\211<\225\224\001\212O8\0375P\274M\313Oj\364C\336\301\315\345\236\351\310j\026mI\335\270h5q\026'k&\232\004\212n\363}%\234\366w^;h/\021\002\273\267t\356\212,\032\323\325\202\013\217\366W\021:\023\331'\242\360\311\254\003\254&\330\321\031\227\005\253"
+	.string	"C\3200\fo\021Wa\244\031(\306T\276@u\245\203\004\005\247\215\204d\202\377\272B\337ae-\023\262\254b\221EJ6u\237\375\263tb\351T\314P\240\343F\333\033\346\356%JXP\223\305\221\212\224<\255\251\353\n\311\021o\342\340Z\370\f"
+	.ascii	"'b\317\313\016\261\n%6S1\305E\233\260\016\225\373\360\201\206"
+	.ascii	"\245s\324\200\340\265\303O}6\253\033\\.\204%5 \265\245\240\234"
+	.ascii	"\177\262\267\315\035\252+\332\307!!U\363\036\005\303\331\024"
+	.ascii	"\2177\t\263\0137\316Lt\3201\304J\274j\225\346\261\206\311\310"
+	.ascii	"\233\003\207:}:\242R\260<\241\216\304\344\2347?\017x\025*l\317"
+	.ascii	"Z)\372t\221*W\004\314\016w\026\004h\376u\b\244\376\247\220\357"
+	.ascii	"\206\306\r\206\213\346\032\336_\202t\207\247\353,\361\330h!n"
+	.ascii	"j\355_4\311\bd]\\\301\2228\235h\263\272Z\b$e\234\227g\213\245"
+	.ascii	"\245*\234\0072\247[Hf\226t\336\202\207ji\rmB\245b\335H8<\225"
+	.ascii	"\n\244U~\351D;\335\2446\241\264\225\031\234\202\274\201\346\233"
+	.ascii	"\237f\352\177\272\005\271 \346\376.\355\3144d\330\207\037\331"
+	.ascii	"\006\226W5\026\356\007\3670s\331\330%\306\366\361\242&\356>\267"
+	.ascii	"\234\371\340<G]I\rW3\324\254\304Y\020ju\320@\034\323*;%\356\b"
+	.ascii	"*$\351\303\245U\032\006A\356h\271-\020K\2659\016\315&\003{Z/"
+	.ascii	"\266\344\004\375\237O-o+\273\364\235ZC\313et\366\264\314\236"
+	.ascii	"\250(\325=\017\177+\355D\3012\200\005\034\360\225\007\307\345"
+	.ascii	"\204\265\277i\311\340\2741j\017z\346?\3039l\246'\271LAf&\002"
+	.ascii	"_X\205\233\n\030l\340\n\n\261\240!$\307\036a\333\301\304d\360"
+	.ascii	"\312\267\3732\025\371\255\363\300\001\030A\373\254\254\251\210"
+	.ascii	"t\3627\025\017\027W\224d\241\n\250\3437D\364\330\001\037\217"
+	.ascii	"\326o7\376\376N\013\224\330\002\031\032\020\252\217n1\3649h,"
+	.ascii	"\265o\242\323\201QC\22207\204\313S\310\220M\020\366C \311\251"
+	.ascii	"G\253 H!R\007F\232\335\r\332\222\235P\006\310BA\223*\226=G\347"
+	.ascii	"\256\347\002\256G\027\013\\a@\215\024\344\2128w\030\031\312h"
+	.ascii	"\322?\337\rt\2731\360\211\320\212\034\352^\362\340\226_\372\264"
+	.ascii	"H\b\310\263\210D\031N\202\031\336\037"
+	.text
+	.section	.gnu.lto_dyad_init.58.982424847a4d410,"e",@progbits
+	.string	"(\265/\375 \335-\006"
+	.string	"\264\n\213"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\276\271\030\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\365\362\001\274\310\315#\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\205\360\371\360\231\307\001"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\006\325"
+	.string	"\001\r\006y\001\001\002\004"
+	.string	"\203\003\202\360\371\220\233G\244\003\001\200\300\013/root/repo"
+	.string	"\025lib/main/dyad/dyad.c"
+	.string	"\t"
+	.ascii	"3\003\326:#d\270\3055\321-\004\3742\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_dyad_shutdown.59.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`X\003\255\027"
+	.string	"f\252\225I\260\226Uct/R\212\"\343\033\036X\037\272\306\307\211\374\330\215@\234]\305\231\t\367\247\245\004(\225?\304\b,\231\024\344\021\004:p\200\237\364\336(\3067n\210\241nLj,\277w\242\356\016\301\200\364\267{\357\275\245L)\202"
+	.string	"{"
+	.string	"\200"
+	.string	"v\335\254.\3333\233\311\205\275[`\211\n\350)\312\275\027f]\330\227\302;\365igg\245h\3534K[g~\271\313qu\303\371\234U\252\024\031BQ> \002\325\024\211\310\350\350iFo\225\350\217P\322\213\f\245(_\222\310\251\377j\365l\315(\272y\342e\271@Ge\""
+	.ascii	"\316V\256T\355\226\334\370\032\204\373\251\366\277S\330IA\271"
+	.ascii	"\341\212^Q\t\367^\327\033\216\350v\335v\017\333\nl\213!\272 "
+	.ascii	"\023\255^\331\342\217\037\234\265<[X\253/\275$\322\366\310f\235"
+	.ascii	"\325\351\2077jV\237eu-\253\257\"\300\252\251\330\342RV\367\n"
+	.ascii	"]M\271D\314)\245\017\177\373~\324\215;\007\372F\246\350r;v\360"
+	.ascii	"P=\177\362\005\342k|\350\023\235f<\007\032\202\225O\007"
+	.string	"\274\367\362\370N>\323\233x.\364\261\274Q\267LR\212\002|\335t\202\364f\313W\316\233\345\007\2347\355\036\007\307\373\340\320!V\177\213\2357S{\342k\214\334\221.8\365^\022\271\003\265<\277e\343\325NHb\253\311\036\325F\3105Y*\357\275\367\274\265cZl\326\307\276\216\357\320\361}\236\241\251\277\321\2347o\377{\345a\305B\02742]\265Z\337\370\301\246\376\346\322\372T\337\220%/J\313\363\353\24750Db\253I\337h\331q\370\230\336{]\374\033$D\370>\235\363\346io<\002\036O\220\0015w\214\003\231\330\216\f,DM\314\006\346\241\006\304\212e738\260\0212\031\016\314%\244\375\367\264\250\002)\005I\2635\277\376\241-\274\312\307J\344@N\006\313\362\314\272\241,ka\264^GmP\203\243\366H\303W\355\224\bS\006G-\313~\210F\261\204\256V\257\354\347\234Br"
+	.ascii	"P\301\330 +r=\035\320\tKM\255\017\225A\303\241^a\351JA~h\337"
+	.ascii	"\034H\016\313\221{\357\313\207\336\360\0370\004z\367^\227H\250"
+	.ascii	"\221(\342\220R\210\024\221\tkJ\323b\220\002!\252\262\003\021"
+	.ascii	"\240\311\232\"JZ;\302\323\230\325\213A4\357\244\376D\324\215"
+	.ascii	"\022\270\036\350\323\317\274\024\f=\371\023\355\253q\020i\251"
+	.ascii	"\262\221\001\361\n<B\020\373H-T\277\220\003f\357v\037\361\227"
+	.ascii	"\340\262\224F\226\266\305c\213\033\311\030\035\220\330?\022q"
+	.ascii	"p\001\357\215\305V\303cNiJ(f\263d7\362\313\317\343\345\375\276"
+	.ascii	"o\r\331\300\250\357\3502R\313\323\r}8h\210\020\023\375\261\226"
+	.ascii	"\231\2334\b\342\375\322\354\365&f\375\001"
+	.text
+	.section	.gnu.lto_dyad_getVersion.60.982424847a4d410,"e",@progbits
+	.string	"(\265/\375 \344e\006"
+	.string	"R\313+2PM\324\001\250\235\031D_\021\300De\216\251Z\004"
+	.string	"W\243\210E\245\326\312\240\033\315`\357`\302\240*\302H\003\2438\250\310Sa\334\231\277\333\356\235R>\210\020\"\203\306\r\321$]\023\215\240$\b\312@=@\256$\034,:QU\026}\352^\344rv\271{\024\016'@\360\031\260\311\n\273jQr\330gVn\330\221\001\303\253\234\354b\264\204\2332M<lc\366\343\177\034\004s&;\213M#\001d\271 Y\331\255\324\365P\363\351\034\240\371\224\035\317\0363\377!_\030)A\361>\355\361\242\260\273\216\336\227q\313\333\036\260]`\273\013\n"
+	.ascii	"\242\310\220\031\032\030\241\032`\021Bs\r\207\215\030[\210\\"
+	.ascii	"\334\025S;\311"
+	.text
+	.section	.gnu.lto_dyad_getTime.61.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\255\013"
+	.string	"\246VP> Q\224\016pE\\3a\035\026\020S\251\323\n\200 V\023\330\213\370\240>^\353?\017\001\177;Z\213\235\374\233T1\273\\\327\001\b\026a\344*\234\026\314\305\250\177\023_\305o7\2212\245="
+	.string	";"
+	.string	"@"
+	.string	"\313\301\300\241\t\\\207_\212\217zJ\263W\212A$ZYR\304\013,t\354.\346\356\225\310\341\365"
+	.string	"\221C%q\355\251\371\367\256`\223\0219\022\350)I\260\273N\216\324\341\326\273\200}N\251#\354[\253&[\323\227\246\241\246\255L\253\2463\323\007p\r5B\344\260q\372\213\270\273!\366\330\020\030\343\304\273\337\276m\315\367<Q}\205\366\356C\331\031{\017%P\031\276\r\003,\205\372\021\212-\243U-\265\\h\3569P\025`BuMM\032\243\317\336\334\313\256\335EpU\357F\252\244B\025\312hIb\377\307\275\b\027gK\240\220\347\374\026\247\220\035\237HAv\007\n\023<i\006\0072\230\n\031\214\243\301l\260\005\232\007\025g\020\032t0O\226u\260I\267\267VM\227ZB\272\371c\355\212\270\274\373\277\217\214\206\232z\225\266\325G\037p\200"
+	.string	"\341q\202\261\366%F\020\013\273\241\023"
+	.string	"\242\310\220\211\027\372h#l\340(D{T\201"
+	.ascii	"\312C\235~1\256\035{\250\3176\327p\3203\3418\325dp\322T\003\306"
+	.ascii	"I\221\346\305\017\016\016"
+	.text
+	.section	.gnu.lto_dyad_getStreamCount.62.982424847a4d410,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\322\214.4Pm\222\016$!\243X"
+	.string	"\030\027\313\253%{\027\271\306?\026\027j\313\374\216\2657T\365\311\036\037DG\246\252\352\242\252\212"
+	.string	"\247i.\352\200\243\265F\266L\001+\030T\224\246z\025\245\251\236\003\206jx\t\030\006\313\326\303B\346AXV\346U\266\254\363\240\273p\234\304\367\243\333\240\273q\304\037,V\351\376\231*\241\013\260\340`\350\267\r:\214o\224\316\363\305\321EZ\247%)\231\024!\224$\221D8\376\353+Wk\307\365\240h\323\310\006\264\213\211\220\223\314|\227Z\246JQ\005\246J.\243W\361\272\365(\002\310\210\t\226m\212"
+	.string	"\007\2319bYEw\375\013~\202\277\023\b"
+	.ascii	"2\003\346:\203j\b\3055\2217\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_dyad_setTickInterval.63.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\215\007"
+	.string	"\002O56Po\322\001 \316\221\326t\232$\336\327\210L\307\273f"
+	.string	"\0028'PF\321\254hv\300\326L<n\222\322\364\243\310\214\253\252\"P^\003\033\347>\244\221M\266L)!\355\263q:!L9\b\332\006B\313>\236MC\266\340a\320ts\350\200\262\207m\003e\031\357\266\016K\305ZPT#(\321\2045\312#M\325\035\215\350\227\356\034\353~\227\243\302\305\311\207\305(W\255'J\210\321\332\372\377\302R\353\223\235\226e\342\360\212\312O\261z\271*\232xd\332:[\2038\204\363\251)\007\374)%\337\377\203\026`\216\365\254\271\0341\013\\\216\345Z\026{\032\0370mL\220\270\374\317`\2069'W[\304"
+	.string	"\035I\344\304$\374ov\244\n\027\272-A[\203\266\250\t"
+	.ascii	"\242\310\220\211W|\321\002\027\266\301\220K\260\326j\n\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_dyad_setUpdateTimeout.64.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\215\007"
+	.string	"\002O56@\217\322\001x\221\373;\200\352\217A\227\25667\223^\221 \020"
+	.string	"W\227\373U\277-\026\321\035x\307\357\351Q\271\f\004\363\225i\325\027\360\345\002J\032\331d\313\224\002 \315\263m8\240K7\b\232\006B\313<\035MC\266\320a\310ts\340|\262\207m\373d\030\357\266\016I\305TRR\"(\321\204\365\311\"E\325\033\215\350\227\356\034\353~\227\243\302\205\t\213\205(W\255\027J\210\321\332\372\377BRk\223\235\226U\362\260J\365S\254Z\236\212%\035\230\266\316\326\037\006\341l*\312\001\377\t\311\367\377\240\005\230c=g.G\314\002\227c\271\026\305\236\306\007J\034\023#+\3773\230a\316\311\325\0161@7\n9/\t\377\233\335\250\302\205nK\320\326\240\355)\t"
+	.ascii	"\242\310\220\211W|\321\002\027\266\301\220K\260\326j\n\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_dyad_atPanic.65.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"e\t"
+	.string	"\246\321@9 \261\322\001\214\017\004't\340\3214-\340\20587\211"
+	.string	"!\3779il\262/\312~C\366\257\360\360`\3646\232iP\220\n\002\202 \314\360\"@?)(\260\356&wJ\001/"
+	.string	"."
+	.string	"/"
+	.string	"\037\n\337\207q\"\263;;\317\2038\217\235\013p\0365\344\362P\372\237\235\201f\213i\271V\207"
+	.string	"\013\273k\330rm\334z\333\004\266\017\354{\002#\237\277\255\362g\366\330\2362`Y\366.\222/\366\262;\r\036]"
+	.string	"/\223\377\354\302Zj\273\023\301\003\235G\333\376\367\230\312R3.X\001\276\210Q)\370\326\243\237\342<Bux\335J8X0g\317\025T\020\373\233U\230}\331\257\2377\214\037\227\\\212\307m+\273\0329\232\305E\225\243\222\247\"SE\304\306\242\204Q\b5\352L\244\220D\367@*\201\354M@\234:\n\317;u\236\271\337\254\302\240\276\006S\203c\251\205UQ\032^\267\231\216\323n\"\003\016"
+	.ascii	"\242\310\220\211\367@\321Z^<\bXO~,\252\021\027\306\363\314\b"
+	.ascii	"\307X\351(r\205\3122\374Lcj'\031"
+	.text
+	.section	.gnu.lto_dyad_newStream.66.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\221\002\235\024"
+	.string	"\206\246\207J\300\020)\035\360\2672L\3024\306\213\356\242,3\220\371\006\261\373\211A\321_\001g,\230\264)E'\342A\233\234ju\332\2678\354f\373\237\\\243\262\320\364\236\241\371O\276\317\214u}\354h\356h\030\237\203\240\346\t!r\247\024o"
+	.string	"k"
+	.string	"y"
+	.string	"\225\346\023\331\365Q\350C\264\377j\304\252S\326\022"
+	.ascii	"~MS\275\254ZG\250\264>\276\276n\333\370Av\335W{\325\250"
+	.string	"\372\234\035\036\214\263\326R\345\243\003\264>\372\274\367l\\\333\02086\236\003<$\020EY\265\2260\227?!?\266nB~\334\024\257\235\326\374\007=\301\017\312\314\345\334\234z \250\265\232\346rH\334{\333\002l\023\260\267@\266\f\006\372\234o\362\252\360\304\355\215?\250\317\233\211\204\335\226q\240\317\221\213b\002\235\302\023go\354\362F\027\205}\261n\217MR\227\220\324$$\365k\244\036!\251EF\352\220\373nR\244^\221\372')PF\275\034><\244\225*\253\210\341\216\032\034c\2548\360\367\235\332\367\213\016\364M\273\210lh/\355\301cE\265\353\325\032\265\236`9\207\350\320$+\262%;+\035g\342j\307I\307OR\265Y\206C\247\017\265\332R^K\262\307\261\270\321\241G\366\265\342\221\203\233\017F\026E\205/dE\226\332\300\235\007:\302\315\t!\273BT\275\235\013\237\t\205\375F7)"
+	.ascii	"+X\370\207\371\023\\\271\035;\322K\253\326j\300?\232\305\200"
+	.ascii	"L\325Z\357\363\321\257\221\037!\350\252Z\334\260\321\241A\236"
+	.ascii	"H\225\223\033\036h\350L,fF\323\201\364\313\nL\214\006\003\323"
+	.ascii	" \023\233\201]\220\311pb\331\206\230\031\214F&\233\301\\\245"
+	.ascii	"\355b\335\036\333&\367I8\224\202\266\275y7j\300\351\356\036\267"
+	.ascii	"\273\325x\320L\n\274\344%\362#]\t\272+!\2714\\tW@_{\301\237j"
+	.ascii	"9,\333\233>\243\346\373\230A\013}\256e]tVB\235\222\265\033\\"
+	.ascii	"\206\225\036t\361\324U\375\244^`\325\210\0010 @\002b\020\304"
+	.ascii	"\362bdH\342\005\224\260\004\242p0[\310\344t\331\016\262\322\177"
+	.ascii	"\032]\331\207\363\241\345\2104\264\300J@\366~h\213{\353\271\226"
+	.ascii	"~\\\2241\003\245\343\242,\224+\223>}6\316\315\b\365\221\336;"
+	.ascii	"\027X\257\341\200\365\320\247`\330\273=\023\235C\202\260\241"
+	.ascii	"\001\013\341\272\272\351\357\227\003\237\266\027\365\335\213"
+	.ascii	"v0\017\216R\321\246K\221\001"
+	.text
+	.section	.gnu.lto_dyad_addListener.67.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\351\003-\031"
+	.string	"\346,\234H\260\032Q:\322\032:I\337\220\303#\302\326@,A\307\024\303`\354\340z\373\311\350\356\317\211\260(\365\252i\274\363\004T\322G\310\273\265\017<\320\036\366\037\364\347\021\330\302\343\361\317\333\307?5V\365\332O\b\331D\356\224\002\204"
+	.string	"~"
+	.string	"\215"
+	.string	"O\325\312\023e\210\203\271;\016\332s\270t\251\326\0256\206\324Z\033x\201x\212\340\373\264o\3437h\367\361 SO\252\250\321\263R\353\256\201\023\210\247\336\235"
+	.string	"x*~"
+	.string	"xj\232M\345;]U\325\340\351\3508\252\265\262\266\305i\017A\372\355\244\371!\004\036/\341H\234\207%\016\356\234\232\310\235\177\037N\244m\256"
+	.string	"R\347CPk}\320g\b\2626g\b\241\326\352\211#I\334\342mk\260\375\300\376V\001\017\342R\364\205\013\305\3163\252\265\266\200\2740|\310\350\205\007\360\364{\026DD\270\235\234\231d\357js{\354\177uy\234\232\323\2509\rs\237?\300w\374"
+	.ascii	"\016\364\237\236\3437\211\323bi:,M\203s\232\316\351O\234\336"
+	.ascii	"pz\202\323/p\021I(b|hK\255#\222\220j\021-\002\303\366}\037\017"
+	.ascii	"\262y\017\233r^\216Nm\033\373t\372\223\355o\207{*T\265\375\200"
+	.ascii	"\210Y\240\233\261\025\322%\351\276]!\027>C2qIlV\231Ov\317\343"
+	.ascii	"_\222+Ux)n\370\204Su\227\340w\256\037da\234\307\031\\\0340\265"
+	.ascii	"\307aap\324\246\366\300\224\033R\21528%{GY\376m\217\027\034\265"
+	.ascii	"*\021S~\242\330f\227Yk\305\331\3551ja\266\300\017\221mv\261\217"
+	.ascii	"\004\b\265\263\027\242|\271\364_xw\037\001Oa\366AW\020\203\367"
+	.ascii	"\003\345\307\t#\033\f\350\\/\"#\022[%\230\273:.\304G&\316\206"
+	.ascii	"\005\343l|\331P\f\256Qffft\2113\032X\007\030\3150\302jf\034@"
+	.ascii	"\273V\257\361\346\305\242\211\215\031X2\261\031\002\226i\200"
+	.ascii	"\325\260f2Y\r\353\264\313\371\367\345\021\267p)\312\331\232\001"
+	.ascii	"\254\035\341<\367Z9/4NkK\270\224\233V\016\351H\200\222\234\027"
+	.ascii	".\246\265'\334\310e+\207D\343Ph(L-2\360t\221\2700\021\356\256"
+	.ascii	"\270\277\315P\335I@p\303]\365n2\276\0057\246\324\371B\327I\223"
+	.ascii	"o\351\306\224\267\024\265\ng\342\262(N\250A(\345\030D\002S\301"
+	.ascii	"\020\005\005I\013-\006`\002\021BG\017\021`5s\350fTgg\016Bsp]"
+	.ascii	"\374\035\017\261+4\3761\345J\364\371$\330\240L\031\020\332R\n"
+	.ascii	"&\212\302u\217\301\033!G\342d-\0242nj\rysV\215\243T7}\256\007"
+	.ascii	"]\324k\263\024\205\222\356\004`\371\214\322\247\241L\300\220"
+	.ascii	"@\3018\3260\251\"\237j\302\311`\266\300\300\340N\342YQ\225f\263"
+	.ascii	"\t\316\215$\331,(\321\266-\203I\215\314\227\n\271!H\375`\n\340"
+	.ascii	"\024\301CE\275[|\253\231w&\327\377\307\246ej.\fLTI\352\231*\250"
+	.ascii	"\355Pj"
+	.text
+	.section	.gnu.lto_dyad_removeListener.68.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\336\004m "
+	.string	"V\275\322I\220VN:\272\360]~\372\303\235g}\253\215\324\203\245c\244\225\023\200\017\211\033\333_\353]E\273L\275\200\211u\177\242\230\205\221\003\255k\214\253\002"
+	.string	""
+	.string	""
+	.string	"\200\233\001\031\002\237\266\274\347\272}\305\035Y\355\326\244\021B\244L2\303"
+	.string	"\261"
+	.string	"\303"
+	.string	"kG\034p\361^L\017\262\307\315\325\212\305u\244\326\332`y\320\233\006\312\363\356\271Ndz\227\t\240z \f\342\211\266Z\213\r6\001zs\213\357\2357\321\323\2347\227i\227\355E\255z\003$\0315\304K\255\325\247g,.\231L&_\026\277:fzN\207\236f\331\314\264G\260V&\005lz\256\304AQ\335\270Z\225\213\362\307\255\355\354b?\326\235V\301\243\007\260\254\256~\226\020\260"
+	.ascii	"w+\330\250\354\200)\233%\003*;\2024.\306\250\354\200P\\\226\013"
+	.ascii	"\204h,\256VuU\366\242\304\300r\262\363\024\360\211\373bG\245"
+	.ascii	"\020\247\264`Y\005\3178\n\265\326e)\240\325w\367\335\365\332"
+	.ascii	"]\013\273\245\221fL\307\b\207\370\350r\342\344n\361\307=\334"
+	.ascii	"\375\217\226[\333v\326\256\216w'\307\253\303\27498^\034\346\275"
+	.ascii	"a^\033\346\255a\336\336\301~\232\013\371\003<\310?\363\261\257"
+	.ascii	"\f/\346]?\200\207\361\346\230\027}\330\027W\362\236(\257\311"
+	.ascii	"\274%\216\267q\274|\362\276\300\251dp\3518\262\254V\252\344["
+	.ascii	"M3\317p|\354\017\373\276\310\313vw"
+	.string	"\253t#\373@h\354Qk=\221=\331\356v\fI\246\252\325W\275\021STP\332\335\335\374\305v\267\273a{D\233\252P4\242T[\255\225\347\346R\330-\3016\313\215L}\372B!\241\205,}\246\326\254\272\316\351\267xaL\267~\215\323\2470\031\025\306\351x\332\364M\227Y\322\255\236\327\264M\367\224T\330\353\232\346)i\216\337\323\204\366\270\257\261\305o\222\363f\257_v\004^o_U\212\004\321\024oa'M\237\335?2\374\311f9{\002\r\356!\332\270b\366p\003\264\331g\323p\264%\263\013\254\375\301.W\310r\246\313\006\372Z{b\267\335\335\360&{D\317\204C\007\024\251!\b\301\276t\277e\372`R\0367_''w\367\323\255\037'\227\327\334\3461*\314\372\256\004I\001\3628@\353}\262\233A!X\033\227@\001\273\207\033t${$\240\265;\3643\017h\2555\202\231\020\221"
+	.string	"d\r\023\347\003%Nt_\222OH\311\004\021\344\003**\362\005\241I\"\206H\f\231!|CGIH\347\006\365\b\371\226\204|D\020\371B\370"
+	.ascii	"\021\025\365\326h\304\320\221O\222\221\321\221\317\256\350\364"
+	.ascii	"\316Z\324mG\232S\377r=\334\213}g4\273\3011\275%\212k]O\361\\"
+	.ascii	"\327\037\276\254\364\\\327\274~*\374\275\254\265V]\017\227M^"
+	.ascii	"\363\311k.y}\261_\205\321\254\253y\215\353\251\335\243=\334\335"
+	.ascii	"\\#\253\\j\213\023\332\271\3769\246\302\037'\247\354\021\225"
+	.ascii	"\342\201\337\220\314\206DK(@.=\204\304\256\032\306\351\235\226"
+	.ascii	"\351}\331\005\f|\251\275\021JZ\332M\253\323\357\235f\262\224"
+	.ascii	"GN\353\364\243\302<\312\003X\25010c\0243\016)5\321D3\"Q\007p"
+	.ascii	"\002!*+\036\020`GC\223\302t\"\244\320\272nMZ\243'\036\036\253"
+	.ascii	"^\367\227#\251I\361B\310\020J I0\255\3103\310\334`\265\\\020"
+	.ascii	"\341\0221\017\253\302\256\364-\005\366\201\324\214VFP\034\"\223"
+	.ascii	"\b\270J\346A\343QA\262\235\003F\033p$\324\322\024\266N\200\225"
+	.ascii	"\236.\342\255\"g,\006 \2172\253I\231,\357\002j\031}\330\002\211"
+	.ascii	"\204$1\207\236\200]#\323\203\245\360Bv\272\250\234\325\307\023"
+	.ascii	"\372W!!\276\206\323\f\031\004\r.\330\271\362\357,\003kZ\247%"
+	.ascii	"\367\377%\"\266\bwNH\213\267h\361x\346\026\230\245\027\244~"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.69.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\365\013"
+	.string	"\246UO? O\225\016Pp\362|<C\226\332\3006)\270\na\350E\006\203z\320\017\364P\t\230(\3276l\245\332A\332\274\245\220\327\004\360\374\003\220z\b\314\020P`M_1\004+id\023\271S\n<"
+	.string	"9"
+	.string	"B"
+	.string	"\037\305-\200\342p\201\005cw9\375"
+	.string	"J\3603S\t\372\216\312c\024~>7\3223"
+	.string	"!\351\032 \024e\222\335\375\352\022C\030\222\322Q\331]\313Q\250\341\326n\273\201\355\004\366\031\0041\3665Q\234l\037b[\216\037\001^e\227\037\273\036\\\264v\227\342\311\366)\311.\355\2138\n|\312\363\001\273\245\024\255\335\221\342\003\333\247\307G\264\317\355\004\264O\203v\213\236p\022\025\f\210\273\253\200e\241#@\004\341\321>\277\241\203\211\020\031 \271\261@\214\301TM\236\374\332e\274X\261\020\311\230=\206\244\232`'4^\326\222\375\324\257W\375wd\250\323Wh\354f\330\b\234\214G\301\233\230\316\323p6\232\037 \260t\035\013\227\271t\030\316\301\005B\304_\004O\303q\276O\303AF\320\265\344-\246\342\005\322\320|\310\253\252\375I\220\037y\352'S\223\275y\t\2736\007\031"
+	.ascii	"\242\310\230\031\032\317\344\301\007K\330\336k\264\265\204\216"
+	.ascii	"&4\177\331\024\263\332A\313n\336\372@\211\211\013\313e\006\230"
+	.ascii	"\2062\206y\201\300\340\21245E\270K\300\200MM\036\352\364\326"
+	.ascii	"\2262"
+	.text
+	.section	.gnu.lto_dyad_close.70.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"m\n"
+	.string	"\366\323G= \345*\035\3408\222\342\253\234\317\317( \003\306k\210\321\271\320\t\244\313R\322\206\020\024\307\201\ra+\005\272u\263\022\272\025\b\030u&\0012\262\036\005\253\002\002>d\326\222\275\367N)6"
+	.string	"5"
+	.string	"5"
+	.string	"\262X\305I\200\335\365f\307\277W:\345\347\013\204\252\327\356T\343\223v\\-\031\003!\213v5\216\230\317.-BP\312\214gw-[!\306\315\3356\203\355\216}N\342?\245\3649*c\371\213m\367\3426`iU%dc\373\322\376\310e\337\305\324\tv_\"\312\356\230\340\003\315\253\307w\334\253\346\034\356\325\237\r\340\243\307\026\004-\027m\316\227\021\376i`\002\303\222\002lO\274\304+\013>\t\005J\263\273\377x\365S\334\353\347g\2471\227\213\210\270\2227{\004\345\204\331\247\273\273\236/\373\001\243O\250t2qvP"
+	.string	"}P \017B\364\031y\r\242\207\316\244\210P\311;\221H%o3\256N\327\263\232\340\2533rN\333$!\3372\235*\313\024[m\203N\330=\202?H\021"
+	.ascii	"\242\310\220\211w1\314\300\b\004\016\n\305\346!@\230q\343\302"
+	.ascii	"\272%\020\201Q\227\260\232\325\350q\227[\332kJ\270)\205\332\003"
+	.text
+	.section	.gnu.lto_dyad_end.71.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\325\t"
+	.string	"\246\222C90\257\322\001\304\312\003\237E\375Z\353\031.\231\205\206\346oX\304\346\340\343\n\032\377\355\333\307\nJ\354l\220\253\203\374\205\201\001\270\020\016j\221\006\017\024\020U\021D\310\3362\2452"
+	.string	"3"
+	.string	"0"
+	.string	"\024#1\273\013J\215\207\237RC\037@T}~\257\313\331\201\241\274\002D\326\344\3342p\267]+\304\226\252\306\263\273V\227xqw\267\275`\273c\337\013\367&\r\367\025\226]\213\334\314\252t&\035\033\333W\373\263\323\302\327R\027\330\215\315HvG\004\033|\357<\236\343\275\373>\340\275sh\273|\334X\002ZJ\"--\225\261-\361\020\237(\370 \023\250ow\317\361\316Oy\357.o\373\374\200\275x\324V\232\263G\226J\231\375\271\273k\031\263_\373\245\252\003\243O\250t2ynH"
+	.string	"}P \360A\364\031\201\f\"\007\216I\020\241\022x\"\221J\340f\\\335\263\222\254\251Q)mS\204\336\345)UZ\002s\303\220R\346\203_\026\004\020"
+	.ascii	"\242\310\220\031\032\2148L\200\253\201\330\260\227\320V\233 "
+	.ascii	"1.\254[\002\021\030u\t\253Y\215\026w\271\245=\032\230\332\003"
+	.text
+	.section	.gnu.lto_dyad_listenEx.72.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\\\nE9"
+	.string	"\332b\364\025@@\246U\007\235\023\033l0\n\205*\364\270#\313\204r\361\313\036\345\272\331\354\022\310\033\341\221a\025\347\357J\350U\240~\334\273\237hC~\003^\006zu\247\315\376w\360R\226\215\233\354\275\245L)I\0018\001Y\001{\307\260\300\206\364\n\002Z\224&\305\356\235\346b\315\253\331\304\276\212\242B\315\253\277\275\366#\201+\223d\002\246\363u\342O\373\361\233\271ak\331\034\334\336$\340w\333\375\004\3369\177\026?Z\220v?\247{\271c\263\350*\305\356\254\256\247w]\004\374\256\236n\370\245\227\354\343\217\343\212\340\275\247\346\260\322\b\357z\007\370\r6\203\316\337\306\253\316\333;\254O\332\336\233\202[\310k\212\274\322\336Y\320\322\236>\273\277\331\247\211\177zDj\277\323J\031\026n\357)\005o"
+	.ascii	"\277\353S\330\335\375\321\2744v\257\266\323\250s@\331\242-7\330"
+	.ascii	"\2757\224\360\t\274\357\266\277\364\276\253\265|\374A\340\317"
+	.ascii	"\327\343\301\273\327mu\216\375{\316\345\0073\330\003\027\204"
+	.ascii	"yU\371_\313\004\250\317\230\377\323U\245e@\345\312\331\207\351"
+	.ascii	"\242\222}:\322\320\211\013\363\002\373\236\226d\225\222\361\246"
+	.ascii	"\204\351\222\222\341H\330\335\377\351z\372\234[\371\355\221\246"
+	.ascii	"J\234\333zX\013\344'"
+	.string	"\350d\266\317\345\013\352sj\345\366\261d\247\322l\230\327\327\353\366\303\226A\327\2403\253\205!\345\371m\237\2258\261r\336\201\330{{n:\275\336\001\274\273\037rw\251;o,Qp\342\260Y8,\275t\307\344L\265\026\363\247o\322\30394l\fe\345H\256 \277\333\3439\361\2736\21021iw\024)\3627\233\364\307\231\364e\335\322K?\220\023\350w\373B,\006D\367f~\323\005\314\254\341d\007\006\360\352.c\3064\013\307\324K\032W\346\272Lxw\033\337\346\325_t\357\035\345\332\231\213\006\310\023\336\333\336\247\367\3773t\353\373\231\362\357\362\356\273}\033\022\030mz\"b\216\374M\1778q;\013\307\324K\367G\276m\357\004F\356\n&ut\225\353\334\247X\337n-\346\376\355\326Y\334%\374\233\177\bN\f~\372/\374\265\367\246_\363\317\364m\376\023\350\354Kov\001ov%\235="
+	.string	"/;"
+	.string	"\235=\250\263\003y\331\177:\273\317\227\275\327\313\316{\263\303:\373Ng\177uvWgo\337\354Zg\317\274\354\037\"C\023a\021B+\313jB\323\315U7\267\255\256\232\227G\373O\373W\373_\373g\373\337\363~\214z\275X\"Y\245\330\275\334O;\367\367\227\363\324\267\363w\276\372x\276\315}y^O\374{|\b\227J{_qI\013f\034\t*\264E\246\207\r"
+	.string	"%\306\322\202\231\317u#"
+	.string	""
+	.string	"\255aK\316\314\2225zx\022\364\220\356\020\207\fA\007\223\304J\3627%h\241V\227\201\240\276"
+	.string	"u\313\232\031\2024\207\013\356\003\324\357\226\231\304K\270`\246\020\034\300\237\216\332ztu\235\200!\264s\322C\2722\0322\317\327$~\222\277\351\244\205\314\214$\036\373\3714\317\254\027\345\371\304R<\352\251MF_Y\253\b\303=\335`\254J\306\212\257\030}T\270\362\364\257\020\254\377\f\224\215\354i!\267\037_y\337\355\357\370\232\366C\027\005\223\346\367\352;\341wXb\261\374Mo\367S\313\323\305c\177\235\213\315b.\005\216\274\357\356\364\013]\313\232\275\332c\200\256\231q\004\327\224\004\351M~\357\354\f\232\313@\017\347\344\"\344V\273\372\325^b0\371\233\f\264pK/\305|\366\301\365\225\363\352\357\032\025u5\317\354*\327\215\371G^\275"
+	.ascii	"\245b\375\373\b\361\341D\240t\314\354\275[}\001J\315\232=\333"
+	.ascii	"kM\004J\207\354\251#\261\221Q\323B\230\364\205\013L\316\326a"
+	.ascii	"\336 \347F1\031S\214\006f\336pzW\250\335\343\2628\215\020\316"
+	.ascii	"\210W\341.\376\276\366\276\233uf#\350lJSv\037Q\342\375\346\353"
+	.ascii	"\236\303XD\026\007\270\221\230D\026\253\204\306\243\220\212("
+	.ascii	"<\340I\342\216\251#RHe,J\025\360#\016c\321\212\212j(L\022s\b"
+	.ascii	"\223G\243\220\252\352\307q\312\200S9\320\310\244\261\250\303"
+	.ascii	"-\016\263\225\025QW\r\201${\034_\034?\2444\361\253\212C\034m"
+	.ascii	"\216c\325\216\251\241\324.iu\354\321&\221G\035-\217!\321*\211"
+	.ascii	"|}\252\002\325p\b\025\224\2618\344\001%U\254\"\340\307\036D+"
+	.ascii	"\250\344\361h\005\345\233^\275\316\342;IP\200\025~\311VVQ\357"
+	.ascii	"\351\227\264\022w_\322\016\342Jcy\020\264\037iU5$\233\217v\357"
+	.ascii	"\260\017\277\347\037nMP\213\001\005h\260\222\245\227\017\254"
+	.ascii	"{;\364\323b|^\200F @\007\241\210\310\236q>\006\263.3\035\002"
+	.ascii	"(\3303\337\213\254\244G\331\226\245\227J\272i\220\036\026\371"
+	.ascii	"\335\236\252|\203\375(\001I\261j\351\245{\326\242\024\004\274"
+	.ascii	"*\t\301\314\217:)\013=\265H\216\276X\346\336\232P\236\016\r\023"
+	.ascii	"="
+	.string	"u\230\255,\362W6z\335\225qOU6\202z\364TO\344Q<\n\357\256\224{\252W=*\b\025D\366\034\221\205\222\224t\007\352\234\326,\275\364\004\332]Y\227\277V@\337\262TZ\367x\231\237^\205\177-\240o\001\200\322\250a<\204\0244\310\314\210\210\310H\222$\035\240\"\031#\353\006\0210\265t\2564IJ\303\030e=\330\313U\273{f\307\326\250\2127\270)\356\225\374\267\231\234a)\316\221\332\t&\006!\275\001D\263L\n\273\254\263\307\220\204\2729\265\206\n\306\005\214U\246X\035\nX\036\264.\211\264\224\324xQN\031B\227\333\333\236\330\231e\241\322o\006\305\276\247\371J4MVy\261[\0254}\224\345\2429A\305\353;E\313\356P\213\2558\262\016.k\327\017\266i[\365T\365\347d7u\370\037M\243\234\374o\366\307\214\242\230\305\315q\365\242\316Q/z\352q\272\026+\023\025"
+	.string	"\335\356\211O\fm\317V\001[\"=8AkpZO\321s\325\365?\237s\374\362\030\035zF \252\310\265F\026\026q\321\217W\205*\251\310h\310\217\001\007\251\203r!\371p\r\236\237\315\246\3311I|\322\334\307\3556\253\311\347\203$\031\274\366\006P\266\311\031n8d\211\300\210Ow\2153\272?|1C\344\017\231\210\0164:\374\372\274`\272By\273\222\326\r\265R\253\234i3\247\372\373BF\214\211Hl\243}\037/\001\321\023U\332hO<D\315[\226dI\342K=+N>\307\360\025W$#\tF\202)\262\214( >&YY\207\250#\332xE\026\344sN\277\217\022\206\252c\"\202\210j\340\344\007\036\325o\016\354d8"
+	.ascii	"\233a\223\360{*\023\211\272xF\313c\31244\236g\r\314\026g\242"
+	.ascii	"\2101\346E$E\034\375\003"
+	.text
+	.section	.gnu.lto_dyad_listen.73.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\b"
+	.string	"\006\221<6P\215\322\001d\006I\227l\205\267ni\320\260\2721\250\312h\305M/\274g\035\037\374\351'iL\230\246\365\02023m\306t\365\240\314\320\250\323\255[\334\233\310\235R,"
+	.string	"-"
+	.string	"+"
+	.string	"\241\024kw%\366K<\274>\020\0175\343\335_\347\337\343\027\207\205\t\210\344c\364\371\003P\330]?\321\250\342\326\333>\260-m\227\004\357(\257\034\260{\021\242\332]\214\021\376\354\233~\352>%.\260K2\251v'\306\006\225C\317\212m\277\343\245\316^]ScDp\022\tjGx\336EP\261\220~\354\371y\212a\377Z%\301\243~\375\374_,Ha\225~\222\332\245h\241\354\b\004\331\260\335\331\026\333/\334\246u.N\246\331\270\207h\206\204L\346\311H\207M\306\221\013\233\206\213\265\216f\223\234\246m\3222\3676TlBA\216O[\367*\252\372\020\361\005\r"
+	.ascii	"\242\310\220\031\032\214\320\020BqM$\232h\210z\204dVVB\002\201"
+	.ascii	"\262\f\232xRR`\327\324\003"
+	.text
+	.section	.gnu.lto_dyad_connect.74.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\306\005\215%"
+	.string	"jC\330\016DpjM:\377\237\356x\241\037\242\267\317\r\262\213;\227$#\224\200C* \207\2364D\325\261L\346D\214\375\256\021\002\336~\241\334\301H\256\201\324\247h'zXo@x\bf\246\343\2335b\t!r'\031\326"
+	.string	"\315"
+	.string	"\341"
+	.string	"WM/\331\302\371\222\274O2\221\314.FO\206\371\234\367*\350Q\306\313\301K\236p\266\375\0306\262\355^-Eb\367^\b\374d\303\330\310\323t\313\374/'\242/\342\270\200{\233\020\305\356-B\340\004\347K.\236\314\314\367r/\224\331H\026U\341"
+	.ascii	"\"\232\325W\241{\257S\356I\346K\362H\346\313vr\3647\333Y3K\262"
+	.ascii	"-\312\277\t\323\337l\221\333\370\200\026V\326O\222\211N\234,"
+	.ascii	"\237s\225E\"8\262$\354W\256\206\266\02656\364\243\205U\344fm"
+	.ascii	"\007\217;%y\301\254\216\234#!\220|\024#Ip\302\035\226<\223u\r"
+	.ascii	"\n\211\274I\fP\354\034\217\204Ud\211\254\341\313n}\buX[\313p"
+	.ascii	"\357e\033\024b\235qg\346%\314\314\202\271\344\n\354\306l\372"
+	.ascii	"\315^F\005@\275\367>\310,\325\302>\310\007[\257\2414`\247\314"
+	.ascii	"\2472\313\316\300\312*\005\211W\240\034ve.\246\266\267\230\337"
+	.ascii	"\353\272\256\334M\230\227^\374\t\034\315Y\351a\376\244\217\371"
+	.ascii	"\221\3322\256\264|+-\333\332\362i\263\\;-\233\245\345\262-\223"
+	.ascii	"m\271\333\262--?\0019v\304j\315\017)D\264\276S\274B\326D\367"
+	.ascii	"\254$\243\3623?\232_\315Ov\216\241b\355x\244\267\251d>\037\354"
+	.ascii	"aO\3635/c\234\330\307\320\223\371r\251\200{sD\021"
+	.string	"\273\367\252\303\371\262\357\223\032*\362\016\213\027\353\210\316\2426b\033\320\260\361L\257\3167D=i\367\336\013en\006\375\231\031\271\264xSS\307\242\243W\241{\003L\201)\370g\313\373\2708\317Z\033\300\323\365=\250\227\377|\020\314>\236\262\217E%\223\026D\024\310\374\375\026\326%\254\\j\025c\270\016X\333\335d\243D\r\366\301\245\316Y1\207\243-8\222m;\262\321\350HA\355\266}\341\016\267\303F\t\352\027\027>\233\033>\256\241~]\312K\333\022\324\257\256/]C\37524<\304F\013\221,\205\254\211\314\334\326\342\002\266\216\007\246\017'P\004\203\227\004\232\031\204\210\006\253\2423`\247\345\0233\305\356-n\272R\353VBb\320\252\354!V\2627\373\032\022F\307\004*\3231\251\231K\230\260\017*\365\313\254\206\316\254:e$\213\3247;\234\023\003\324{\201\017\2428\201\037\030\274\274\331\303R"
+	.ascii	"8\352VTyp\346\335\313\330hD\241\034[\217F\366\351\001\374\363"
+	.ascii	"\361\242r;\031S<\337\256\227\373\361^\344\240\246\250x+\224\030"
+	.ascii	"JA\373~/\244\242J)\235\355\365v\315\202JEOI\351X\220\277\036"
+	.string	"\017\006\371\363\361\242H\027\272]\357\3473yE\004(\035\r(\247\027R:\027N*\244\246\222\230\007c\327s\372\361x='\\\361\276\233\360m\210\026[\204\003\t\016\tb6\035\327>\230\031\327\234!G\353\340\031g\250\324\370\310{\2650\234\354O\013cW&\357\275\367\326[\266[\005%U\235\376\004\223\005\347\354-\343o\275t\353#5M\327\220\314mZ\\g\251U\024@P\225\217\332\223\265-A\231TujkS\00534\264g\243\311\214n}\020\033O\243\021*\030\227@\017\254y>A\243\344\200\235N9 \224\312\237\020\250\225\001G\034\346\313\263m5\256\033\321,\001w\250q(\246\224S\310\314\210\214\310(H\2226p\"\021d\327\001\020hI\2344\006B\223\221\013W\222#\253\200\361\341{\245\270\324\314\3453?\265\030\260\240\317\023H\022\320\217 hsB\334\204\034\275\251\034vbSe\273"
+	.string	"\276\001\031A\364\301}.z\030\235u!t\207\360\260\351~\361\343HD\027\244:b\322\240\233D\247\363\215M\210\206"
+	.string	"\364\231\372X\363\033B\242\220\231a\3268\243\310.3B2\226\233_D'\320\334U\n/`d\205&\003\034z]\177\037\3008O+CGb\"\307\001\r\367\350\017e\377\277\030 D\274\260\340\276Q\216\b\311\2124V\274\300\257\320\321D\301S\357\3526\255/\b"
+	.ascii	"c\255\021\007'\220\327U\340\306\030\034U-\351>\t,x\336\023w\221"
+	.ascii	"O\005\354'\210;\001\257\020\202\361\266K\335\257.[d:\243\222"
+	.ascii	"z\007v4\247\377\001"
+	.text
+	.section	.gnu.lto_dyad_write.75.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\304\004\r\036"
+	.string	"\3065\273J\260\326M:\346\013\345\fx\370\243\224\357\373\314\b\205\204\255A\366\005\240\\\265\277\326\370-\310\342-\203QM\363Y;%\034t@'|A4u\024\033i?\350m\321'&\2645\020\230\345\265H\303\306\2475B\b!D\356\224\002\245"
+	.string	"\227"
+	.string	"\254"
+	.ascii	"`Hj\255\n\314\300\374x@\244?S\321\2529\265\377\343@n\367\235"
+	.ascii	"8L\255I>$\265\376\0248\201"
+	.string	"\371\321\277\017 ?\232\027@~\364\315\236\362_\257\316\240f\f5y\325Zi[\303/\303\3410\313\305\337}\322\333c\247Y\222\243\270\364\346\323\354\250\354x(\036\023K\241\0258^Ut$\342|uE\035\230\243'\r\243\0307\313\bHF0^\2768\031\343\275\370\350\302\323\311xBT\254*\202!\036\b\236\022\361\202\350\036x3\n\224\215*HF1N\313\b\265V\323\035\317\350\226\3356\223\355\033[\364\005\365\246\210\205\236[a\3358A~\374\336j'\265s\201\243\303\005J\t\361v\225\354_\216\036\247\367\325\345M\232Y\352\331R\313\304\334\367\007\2009\323\377\362\337\357r\247\273\345L\267l\251cK}\306\250M\223\272<\251\311\245\036\227Z4\251\267\244\246$\365\r\320\336\022/\035HO1\254u\305\020\254R\215Q9\356\364\333\367\207<h\313<\342B\354\322\023\366\030a\313>\376@\313l;\221"
+	.string	"P\253\352\213\300\240z]\265\376j>\032\202\275A\276t;\223\205>kE\nM:\031\271\n\247\262\320\t\317N\365\366\251'\356N\331hb3\247xh\030\235\262K\303\262|\r\336\2621{\340%\354\350\tsWN<rf"
+	.ascii	"j\363/]?x\001\003\375\316\344\242(g\366;+6\237\355\314\026\330"
+	.ascii	"\322\201\345H\233\217<)^Wpt\350*X\236$\2155\237\355L\305\326"
+	.ascii	"RV\020\375:\224\255 B\304U\362le\226\300\222\223 \372e_*\312"
+	.ascii	"l\251\024\"\241\005\013\375\033\246\272\225\220\037e\366\301"
+	.ascii	"\323\350\340Z\272\"r\224$D\355Q6(\236\0074t\377"
+	.string	"#V\262;[\303\215Xhz\347O<\277\202Uk>\3371\321#B\254\001\325t\304\017\265\235\037 \021\2445,\320\251\225\320\241\201\350\251}\240e\350\3610\3006\237\235\037\032\220\315\366C\223\375p\337$\237HL\250p\233sl\271Z\260\350-$\317\215-}\032b1\341Y\026\336\230\347:\350-\361\341\303\321al\225\274\\\301\0268\314\230}\t\266PA]\266e\211\016<\002-\023f-\322\227\225-\221l9,i-\270la\266l\332\035\321\311\020k\255\3654\327\277\362\351\260LX6\362c\216\325\316\212\325\006\n\246Obs\302\210\216\310\335-\027\347I\307C\\rs\232\206\262\214\013\245J\334qs\002a\250A$\006\221D\006\021\t\211\024\264\300\320\030\200\002\031\262\233\007\021P\301s\350\264\206\375\f\342I\032\315LW@\026\257\246E\206\225\026\255\036P,*\206F\177\354.\367a\324\342\301"
+	.ascii	"\033b|V\007\360\302\305\256t\273j\310k\377\nnb\302\024\244 \257"
+	.ascii	"\177\306:<\265\206\220?\310jD\304\f-\245\220\260uC\355\234c="
+	.ascii	"c\016\376T\356A\003\240\031\214>\213#\207\224\021\2773i\377\f"
+	.ascii	"W|\022;\200d\3408\002\343\301?\004x\343d\373\304\207\224\267"
+	.ascii	"E\373S\005\332`\327\277\205@\270e\322\323z\332e\367[B\256H\241"
+	.ascii	"\241lx\332r\023\370K8\b\030\325\025\2103\371Db\035\343\033\177"
+	.ascii	"Yq*\205\275i\237\373\n\257F3\276\022\363\007"
+	.text
+	.section	.gnu.lto_dyad_vwritef.76.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`j\033\215j"
+	.ascii	"\252\250\310%K \316\342\031\003G\004\203\362\fpa\241F9\265\270"
+	.ascii	"^X\bl\224\213d\027\025\366\314\254\222\032\357s\362\373H\364"
+	.ascii	"{\255| {N\364\025\001 ^ 8\303_C\245@\t\276\201^\316\320Rxc\t"
+	.ascii	"\213\327-\264\264I\310N)\245Q\002\032\002S\002\213o\210\275B"
+	.ascii	"wav2U\363\361\223\311e\251l\357\373:\251\230\235\235L\366[o\351"
+	.ascii	"\271\276k\025z\217\235y\255\247\325\\nHy\276/\236\325\024\005"
+	.ascii	"\350\272N\253\355\260\372\215\276\313\277;*\330\367\235&\260"
+	.ascii	"\354$\317wN+\227\205\363\002\276=\025\274c\303\276\357\365\200"
+	.ascii	"\326\322pZ\035\307z@;\256\357X\017\202\031\262!u\222\013Xv\022"
+	.ascii	"\b\3319\255\224\356,\254\270|\337v\320\207\035[\366\025\3415"
+	.ascii	"\352$K-\337\271\333\260\340\340\301yw\264y\020\265\354+\314\314"
+	.ascii	"N2\223_u \"\26537[W\321j+\007\215\341}\323\264\330\275\357U\211"
+	.ascii	"E,;\311\327\326i;\271\354\234\266\223\314Z\314\212}U{y\356\242"
+	.ascii	"|\271e\337\367e\372\021\230\331\347\346\361\3611M#\257\315Cl"
+	.ascii	"\303OI\255\206zr*A\242i\004\323\222R\022\322\221Q\021\321\220"
+	.ascii	"\220\210\020 \202\200~|z>x\350\300\201gg\203\216\206\234\f\030"
+	.ascii	"pnlj\\g\223\271T\266&\222\310w-n!4?\351\330VC)v\371Sb;!v\211"
+	.ascii	"0M\242\tL\21784t\2460]\374|\351\314O:\006B"
+	.string	"+%y\231e\221~\006\315\260G>nf\177F\021T\315\274t\021\013|+t\351K\022i\361!\272\026\232k\021!\344\032\304\2268\017\232\353\203s\240fU\314\216\256\177\242\270\217\265{\252\364\007\017l\335\201\312\024\347P\345\213\024\347Y\202\320;\310$\3025\264\"\306\256@\272\261/d\316\231\034a\3575\361\r\210\2553\330\203IkX\3229\031\2244\206$H\034g\t\022\350O\315o\220J/1\022\032p\312\004\031\325\210\305\353=3\2679BF\355\232!\355\0069\225\001\024!\023\322\315 O\246h\316\234\016A\002\001v\320\223\351\231/\255\2554\240\032\326\244\333\346\242\266\t\244\323\t<\346\032p*\006\351\2043\263\326{\355`cQO\222\320\034\363\n\241\213L\255\264.\341\032\032\007\025\231\326%\221\310#j\337\217\006\234~A\352\264`\004\3219\266\303\277\367\272\200*\030\226\355L\021\262\304ve"
+	.ascii	"\357\373\262K\307\310\232\243\232\031\t\202\231%`\336\351\013"
+	.ascii	"\210m\201qe\\J\310\326\n\227_\345\247\341\327\333\206\025\377"
+	.ascii	"\215J\334{\r$\311\344\f\251lRe\343\016\367\031\027L\262\267\264"
+	.ascii	"hK_,\243/\210:\371\017\306\314\327\255\216Rk\304*\277zhD\210"
+	.ascii	"\030\025\356\375\"H\275\027\250\264_\345n\235\017\260\204`\342"
+	.ascii	"\323\270\263Z\026\257amkL`W\271q\264\3340Z\004\236\231\305?`"
+	.ascii	"\226&m<\242\277\305-\246\233g\"d\261[\356\310\341\320J\227\344"
+	.ascii	"W\311p\227!\323\003\313=f1\314\216-\312\373&r+\006\366\370\003"
+	.ascii	"\303\035\006\260\241^I\037Y\266(m\310\274\325\324\245\332\333"
+	.ascii	"V\305\2607\"D=\rs\023j\221A\260\\\322\255\243\355\244\277r0\254"
+	.ascii	"\016\f\255\251\241^\305\267naoQ(]\376\330[bV+\362\253B\rAK\342"
+	.ascii	"\335\315\261\355p\2077\372\013\200D\246\317X\313h\003Dm\327\317"
+	.ascii	"\345\206H\2552\345\362G\346k\227\177\225\271\227\262[e\374i\314"
+	.ascii	"\256\263\016\3279\207\353\214\303u\326\300u\316r\2353p\235\261"
+	.ascii	"\\\347+\327\331\312u\256r\235o\270\3166\\g*\327\271\206\353\f"
+	.ascii	"\2451\005\343\201\027.Z\264\\3\213\025\215\245\033\001\025m\355"
+	.ascii	"&\240\257\335\003t\\\363\211(\023P}m"
+	.string	"~r\235\235\\\347\022Lg\022L\347\246\326yD\2153\223\353\274\344:+\265\316INg\244\246\363\021\216\263\321\215s\221\353Ld\343<\304t\026j\235E\3248\207p\235A\270\316A\2553\220\323\371\247\351\354\303t\356a:\177h\235=\3248wp\2359\270\316<\255\363\216\323yC\323Y\207\351\254\241u\316\251q\316\340:cp\235qZ\347\033\327\331\306\351\\\323tv\231\316\316\326\271Y\343\314t\235\227\256\263\262un\235\316\311\2463\262\361\232\237\351\354\r\002R\005%_ualwQ\276\360\372\212=\242y\377\220xM:\256[\256\333\256\033\257\233\013`\n5\304\354\037^\2262T\266/\376V\002UH_\031|\367\335\331\325\375\314\311m\361\371\024j\216m\205v\331*u@i\375\342{~X\211\220\t\364&\355\"\360\260\033\316\210\337\337\317^\3470\306\r\241\353\231zF*\377M@\333\236'"
+	.string	"\314\016o\354\371\246\233\017?0\264F\276\037\016\220\032\224.\002\321\232B\227\037^\312\021\f\255\303\357\274\007\236\357\300\301\r\013\317s\270\222\002\217\025\353\316\277\333\241\325\304O-\300%\013\224\256\036\235\337\360\334_>`]=\226\007\036\303\330BZ\207\253\016\fsE\013\207\253\267\272\262\372\376\202\302\t&l\3605\177\342Nt>\205\232\013]\205qe\377\266\3475\306\343\232@\007\267\363U\366\037\275\342}~L!B&pj\305\377\342\233\221E\354\031\354\226;nh\323\321\340"
+	.ascii	"\364\337l^\303K\351e\370\233\317\371(G\234\317\360(\03010Y\362"
+	.ascii	"|\277<\234\307\360(\030\223 y\276_\036\316\277\337\bVG\236\217"
+	.ascii	"\305\031o\376C\032\225\211\265\332.47\347\331<\332\017\024\210"
+	.ascii	"\220\t\344\021\375-\r\356\327<\367_N\325\215\257\312\320Nib\006"
+	.ascii	"\303\r\267\214_\"\316\215\267q\303\306\367\037u\312f\210\220"
+	.ascii	"\247\211\244\032G\343<\033?3{\266\231Ft_Y\355!FZ\326\210\355"
+	.ascii	"\306\005\271\236\271\371*/u\213\367$m`\202\234\3053kY\021\300"
+	.ascii	"[\332\342w\342\202\274g\260;~\353Z\315Fm\234\317\016\004\003"
+	.ascii	"\350\313\031r[\265-\336\371R\203_i\230\337~\363O\314E\241(\237"
+	.ascii	"\371Rn_i\226\377\001\231\362\227/\345\026\245v\021\340S\326\023"
+	.ascii	"{\276\240\332\353\251)\377\005\221X{X-\303"
+	.string	"\236\357\346.\264\337{\215\034\363$\213 \265\212\265\246\307\223\032\371\311\347\0064@\205\267\224\333\337r\251\276\245\213I]\343\251\276'L\024M\2273\251\223c\211\3312G\202r\215M\244\256\361<>\302\260\036\334\031\031\346Wk<\364;\264\371\261\177\t\326xO\004\363\352 \313z\334K\370\2579\257\355$\364\033\260\205\234 \266\025nA\363\256\251\004\234\313\312\267\236(\224\222\337\322\262~\344\274\033Cf\005:\r\353-y\201v|6\032(4\035d\031\350DC\016\276(lD\203\006V\215\"%G \3643\260&\370\252+\253\237\3216f8\005]u\305\200\214\253\251\252\254\245\225\005U1\220\024\310\260a\005dAU\214\345\025t\306Cc\310\250\272\262j\231\202\245\nb\340\250\200\251\306T\f(\323\004S4t\230\312\206\214*\246+*\252*&'s\365\2471\217\354\375q}\027c\331\335@\276o\021"
+	.ascii	"\232K7\366\212?\262\323\037q\r\275Y\257-\361N\357s_?\272\374"
+	.ascii	"\261\311\033a\275e\211'\201DO\2125\b\324\362O\005\265\257:'\032"
+	.ascii	"\317H\037\340\241H|\357\265\020\030\03104\256O\322\245\210\222"
+	.ascii	"'d\t\250\277"
+	.string	"\340N\313W\235\216\212\177j\352\247\247\361\255\027\332[\231S\023\025\372n(\030\245\213Tnz\251904\246O\372\021\037\345E\351\231\036\205\336\322\013\371 \317\367B\247\364K\217B\357\317\336\354\371^\350\224\376\275|\331\003yz\0321I~xrYj\025k\211\243Gz\356.$t\344x\035M)\362\370\362F\344pD\342\004\tS\216\307\221\003\307w\227\3671\345~\217\017{>\r!\275\224\363\334\367\340y<\233\221\360\350\333\352\231\031i\031W#\036 \336\222\207\037\204hXP\372*\\\357A\223\f\227\f\313\374\036\264\347\031=\260m\342\326\336$#'\255\321\267u\f\026\251Hk\255-\2422hwDD\264f\3306qNJ8c\344C\337|}\247\205\302\220Z\363\365^\003?ZR\264\250"
+	.string	"E\177\313n\350\223\213rJ<L7\235L\223@\302\374\212\030\241d\027\331\311`\261\254\350r%P\205\0346\264E\364DW$lh\241\231\026?d\007\303\212KA>B\366BV4z3\34333tAe\365\354\312\343i\330\237\231\225\372\016j\243\366\276oT\323K\354Q\272X\350H\264\344\256\361\253N\350\201\277\272;\363U\367\363\342O<\330\317\222\273\027\276\352\204`\374\006w\331\257\272\037\027\037\365`'\276\223\264-\365\211\177\340\233\203b{Qj\027\230\026\034\221\f}\365O\360!\024\342\201^D\320\207"
+	.string	"\341\367%\350A\364\261\020\264\002\037P\324\303pl\023\362\371\237\347\356\023\241A\326k\020\302\211*\006\005D\026\033\262Q\r\203\262>\203\254\202\037\250\322H%\221\222\2161#\"\"\"I\222\244\003\322\013\020\b#Y\220bw\003\022"
+	.ascii	"31I\324\240BL\211\bI\222\024\224j\fkCs-\351\263\342\235T\250"
+	.ascii	"\336D\341O\367\245o\027\327\330\036\362\307\246\271;\275|\230"
+	.ascii	";\353\342\360\222\323\366\272I`\034\367\214n\330\344{\026\177"
+	.ascii	"*/\036\252 \371\261\277\343iJ\274\277\027M\265\374\370`\304\255"
+	.ascii	"dq\"\t\n\032\331\3159\017\364\030\261+P\210\264\272\016\354)"
+	.ascii	"N\241\tMFwx\336\214\342Yn \003\364\0308l\334\301\231O\201\335"
+	.ascii	"?\003a\275\360\317\236\223\001\022\227\330O\342\006\003\356\013"
+	.ascii	"\035\021 \bv\323\251\223\234\024\274D\275`\032\206+S\030%\001"
+	.ascii	")\246\234.\202\225\252-j\r\245\320\200\327\347\252)^][\310\003"
+	.ascii	"%\244\345\b^W\020\017\337\f(s\375\270\275T@\fn|\320J\227\021"
+	.ascii	",\031\257\"t\005h\301\013\373;\365\311$\241\323\364a\251\032"
+	.ascii	"\213J}\360O\345c\251\345\242<V\036\331dE@`\341\251\324\374\255"
+	.ascii	"8\256{\347\250\210 \305\266\007%\313\247\343q\232\"M[\315.X4"
+	.ascii	"m#\270\275\232\n\242\251\021~\306B\3512\234T\250\315\007\362"
+	.ascii	"\022gX\260y\3207\034\274[\323;B\361d|\273\230\375\335\217\366"
+	.ascii	"U\212C&0gdNx\227\202\032\f\fW\024\\KO\344\230\262S\034Z\021\262"
+	.ascii	"\256\025\347\317\201\212\375#T\277etT\035.\246yF&0\021\326e\224"
+	.ascii	"&\255u\215\361\234\375\233\f\303\223\002c\302\222\367\2021\320"
+	.ascii	"\326/\303,\317\246\245\265\255^\235\342\311r\332\006:\373\373"
+	.ascii	"\276\036\340\275Mwl\250E\233\314k^\027\362~\362\304\005+\231"
+	.ascii	"\305\230\304\334\372h$\206\263\322\230\r\240.f\221\3431{i\203"
+	.ascii	"4Y\242\331\202q\354oX/\\\363>\r\303\300\351\0324\017T\245\307"
+	.ascii	"\016\033\3464\315\027\231\2763fb\367\247O@\006\027\206UM\324"
+	.ascii	"\"7]\201\230j\"S\244&-\250\021d\030\360O\275R\203JX\213\326#"
+	.ascii	"\254\217\217\372$%C-\351qy\027]9\241~\3372\364J\342$t.Ln\rl\035"
+	.ascii	"\266\251[1\335#q\334\215\371&\f\032\330\221\252X?\017r]O#\004"
+	.ascii	"\334\314j\310YN\263\306y\205n`\324K\211\254\2233\271\035J\354"
+	.ascii	"\233\bQ\247\371\301\207\371\003\200\021VEZ+2\361\025\365\263"
+	.ascii	"\364g\266\024\242\203#\205\374\033\006#j-\356\316%0Q\032\303"
+	.ascii	"\204\245\006\374\340'\024\354\221\037\254\005\317\202\343P\035"
+	.ascii	"i\377\336\023BeR\341\262_\2647\210\240~|\023L\230\n\035e\215"
+	.ascii	"\355n\204\321.\214\311\303\244aQ^q\003\2544\330Jg\206\177@+1"
+	.ascii	"\233\265K#\345T\r\036\314+\247\236\312\037\224`G/\325\254\244"
+	.ascii	"\234\037\213\210\201\276c\364\254s\2410nY\251.x(\313J;T\025\b"
+	.ascii	"kp\313\337\030\005\342\004\263\220\017\377\376\264\364\252\242"
+	.ascii	"vfS\314%\027\tb}\267T\301\253:\261xN\203\241\3230%\372D\306\004"
+	.ascii	"\"\3522`\336t\247K\2048n\211]T\001K%\305tO\r\304\323\356\024"
+	.ascii	"<\nD\314\023C\211\252\016\325m\236f\244\"\377\264+\262\233#b"
+	.ascii	"\375\367q\375z\002\366\006\366\367\257m`\203\\>Y.Vf\214\3064"
+	.ascii	"!\213cp\370~M^tf\222\340\363\3001\323\263\f\212\213\213\260M"
+	.ascii	"\351-ZQB\b\370\273\317\334\3644\257LR\224H\307\332\317\242\321"
+	.ascii	"\356\266\226T\373\373'm_\367\332\310V\020qSYm)\316\272\252Y\305"
+	.ascii	" \3153\336\372\330\022\317cBZ@\206\370\ftfCJ\275n\343i\030F\231"
+	.ascii	"\320\002"
+	.text
+	.section	.gnu.lto_dyad_writef.77.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\205\013"
+	.string	"6\225ND\020\2538\035\020\312\327(\273s\022=\002\020t\367\007\205\177\361$\2202\347\253[@A\245\002~\350q\034[\302\273\236\tD\033\315\324\202\335\372"
+	.string	""
+	.string	"\030\201\304"
+	.string	"aEKu\027\222~\"\251\200\262\377\255\355\235R7"
+	.string	"?"
+	.string	"8"
+	.string	"\273\344\205-\266k&\257\271\\\333>q\271\346\320\206\235D\355\346\205\200\245\324\260\273\\=\360\3604\364_\336a4\211\247\230\215\3355\035M\002\356z\333\025\2663\354\203\004\003`\0220\\p\235@\206\335"
+	.string	"\261\r\244\b\232+\365\326o\377\2453>\353\r\302\267F\021;a7\013\257\224\271[\342\\3\267]\373\206\222&\0258\247\366\025|A\370\325\311%vO\f \004)U\364\003\245\220\325Zm\357{\240*\235\346J\025\215\241\234\337\301\313\020\005\200\321&)\241\037\375Q\325r\232*U\264I\221V\003\366\263\335]\327\223}\362\317\276\372\353\366\241\017\330e\"\357\243z\235\007\024\205.\366\300\350t\243\016'\002\352<\256\003\024\242\3617\342\0019\321\367\201\\\206\334g[O\346P%8MRE\361(\333-\240\361\326o\262h\314\020\364\003B\235f\025"
+	.ascii	"\242\310\230\211Wc8\233/\300 [\022\234\004(\222j\\Qa\370&4s\r"
+	.ascii	"4\230#\342\254\3038&\020\006\252\201+`n\200\212\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_dyad_setTimeout.78.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\226\320<8@\305\2521\340\335V\277\200\2245\233&\206\236\206\265\321\230My\225:\"yh\210\374\0132\347\357\\\223V\333b\214U')0\355\313$\305\rr}\274\355\226[\312\224\002*"
+	.string	"+"
+	.string	","
+	.string	"\003\233e\277\226\305\023\343\0041\327DH\313\377.\266\374\031~\265=\214Q\255P\206\227\205\377\205\252U\205\033\335\266\240mB[\225\247\230\005\270L\222l\264u\246-\234\205\225\254\274\376oz`\330\232\303\035\237]'\013\374\254\221\327?75\340,;\255\331,9\007\006)\214\373\257P\177D\230\002R4N\233%C\306\t"
+	.string	"\213\024\234\265\023\005\343Ek\355\377\033Y\255\247\035\355\262\241\324b\"F1y$\217\310\353|H\227\020\3473*\221\266v\020<\034\223\247\023\2018\241\256\001\344\240\251\367\360\031u%\317\033u\231yk\217,Lk%KE\211\306\330B\004\r"
+	.ascii	"\242\310\220\031o\251h\301\345\242\231\020\007\273\356\032\345"
+	.ascii	"\n\343\005U\016\204\fP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_dyad_setNoDelay.79.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"]\013"
+	.string	"\006\027O:0/\230\341\207\204kK1)\370\0371V\361X[\001\326&\212\343\216\375\004\360\272?|b\267F"
+	.string	"\372#\377\271\326#\"\"\345\t\230U\306d\377\202\202e3\324\366\336R\246\024;"
+	.string	"<"
+	.string	"?"
+	.string	"\017\260Kr\275v\307\210\0174\276y\374\203\373\326\270"
+	.string	"\356\233C\033\305G\323\022\030\341\372\264X\354\256\247\245\207\317\320?\353\235\b\342<\031\fv\327)\202B\267\336\266\001\333\022\373_k%\331W\375\214Lk\231VMg\246\337!\020\245@}E\211\335\n3\027+\333Dp\260}\207\355\034\357!\374\3121w\273\031H\274v-D\fi|+\240=\355\243\236\n\257\332\004\027\224c;s\020\022~bw\025\370\255\313\204\001\246\335\375i\243\334\006\023-T\252_}\201\250\"U\365\237\027\220_S\377\201yr\346\257~\325P\210\016\243\224\250\2233{\344\244j\260\257\355n\232\013\250\226\217\202\321d8;\220L>\n\023\017B\345\263x\r*\017\036\006/\024\214\247\001A\214\347\030\367\332*\311]\t\203\254\243\036\003H\355\026\356\037\3162LQ\243\223\230\340\334\035\3434\265\301\by\321\332\006\021"
+	.string	"\242\310\220\031\317\250h\341\002\203\324\330?\01313Q^\202\273\204\001P\341\255k\3001\214\016\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_dyad_getState.80.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO670\217\222\016$\036\024\300\260\234%\250\216\366\r]1\303Mm\265&\303\250}\302\242\375C\333\323\002]u{\214\031A\b\203'\254\354\276\364 \020\206\325-\266\326\b\221)\036\216\003\nId;$l8\321f\203\350p\236\255\241\363\220\371\023\301\001m\241\317\007\264ab\366!\324\224`\305?\321\222[Zf*\\\022\n\221\346Q\354\216`@\252\364^>\222\036\334\370^\tQ\377\336\260\261}\327\305R)\213*\023\343\305%W\260\325\307\337=\346\357\373\246*\3225\216*\220\21129\311\214\b\027h\305\216\332\177A\032\322}\353\212\035'\002V\312\205\252%37M3Y\261\253\003Y1\310\321\256\257\273\035)\203\205\006\212\351D\352\003X\310\314\237\351\224\321a\177\203\377\340_\005\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getAddress.81.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\305\n"
+	.string	"f\024KA m\225\016\324\210\006i@q\210\270>\214`|L\320\200\302\024'\322Y0\277\220\240s\242m\253\356\252\267\266?\234$\025+\201\004"
+	.string	"VB\004\256!E\017\350\265\302\230\303\270v\364\020M\366\2262\2458"
+	.string	":"
+	.string	"6"
+	.string	"\332\343v\212\366\250\022>:\324\034\371\034(\b3UG:\274\350\034\\!\205\345\341\303\350N\320\362\275\036<\303s\325\2312-Jv\327\251\352\032\334\361\266\001\330\266\330\327\b\232~\2042\023\377D\3542\230\255\330\0221\204\005\333\"{b;\363\260\3203v[#>\354z!\366\330\036m\373\027\216A\344\221.@\225\"\214\310H(\210\245\330\3658{\257\004P]\317\357\305\002\241\006i\327D\301\341\304)U\330>\360\r \022_\003\202\004\333\356\276\302\243\037\322\036\257\033\024`\245\234\331\036)\325e\037\256\266\354\303~\350t\006\376\346\222\351|<\232\005\210`. \fG@s\331p\0014\003*\346\024\310t\270\017\207\323\341\354\355\341j\313\223\016\351\307\fp\023vSWy\266\024\310\307c\3525u\245\035%5\301\017"
+	.ascii	"\241d8-\340mD\026Y\200VTN\"\212\212\270\342\020\001-\201\270"
+	.ascii	"&\266fA.&\310\342g\306\230\355\324\020\024\024"
+	.text
+	.section	.gnu.lto_dyad_getPort.82.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO670\217\222\016,>,\343V\225\001\250Cl\202\354\024\242\312\306\307\001H\337\376a\321\376\241\355i\201\256\272=\306\214 \204\301\023Vv_z\020\b\303\352\026[k\204\310\024\036\216\003\nId;$l8\321f\203\350p\236\255\241\363\220\371\023\301\001m\241\317\007\264ab\366!\324\224`\305?Q\222[Zf*\334\021\n\221\346Q\354\216`@\252\364^>\222\036\334\370^\tQ\377\336\260\261}\327\305Z)\212K&\306KK\236`\253\217\277{\314\337\367MU\3255\216*\220\211R\231dF\204\013\264bG\355\277 \r\351\276u\305\216\023\001K\345\242\204%37M3Y\261\253\003Y1\310\321\256\257\273\025)\203\205F\212\351D\352\003X\310\314\237\351\224\321a\177\203\377\340_\005\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getBytesSent.83.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"bO67@\215\222\0164eU\003\256`\340,\237w\221\246\231]\262\207]\034\fA\372\365\321:\201\323\342[\t\246#\026\257\n;aiTz\372\241\266)\203|\253\2555Bd\n\035n\363\001Id;$h\270\220f\203\340p\235\255\201\363\200\331\023\261\371l \217\347\263]b\366!\314\220`\305?\321\222WZf*\\\022\212\220\346Q\354\212`"
+	.string	"\212\364Z>\216\036\334\370^\tO\377\336\260\261}\327\245Z)\213\225\211\321\302\222*X\352\343\357\376\362\367}Q\025\351\032E\025\310<\235\244dF\204\013\264bG\355\277 \r\351~u\305\016\023\201\252ua\322\312\314-SLV\354\352@V\fr\264\353\353nG\312`\241\201R2\215\372"
+	.string	"\0262\363W2et\330\337\340?\370S\001\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getBytesReceived.84.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\335\007"
+	.string	"b\017670\217\222\016,]I\266\270\b\355g\210R\220?\334\260\210\315\303d\030\265OX\264\177h{Z\240\253n\2171#\ba\360\204\225\335\227\036\004\302\260\272\305\326\032!2\005\035n\363\001Id;$h\270\220f\203\340p\235\255\201\363\200\331\023\261\371l \217\347\263]b\366!\314\220`\305?\321\222YZf*\\\022\212\220\346Q\354\212`"
+	.string	"\212\364Z\037G\017n|\257\204\247\177o\330\330\276\353Z\265\232\222\312\304h\261$\n\246\372\370\273\277\374}_TE\272FQ\0052O'&\231\021\341\002\255\330Q\373/HC\272g]\261\303D\260j\271H\255d\346\226)&+vu +\0069\332\365u\267#e\260\320P)\231F}"
+	.string	"\013\231\371+\2312:\354o\360\037\374\252\f"
+	.ascii	"\242\310\220\031\032\214\230\211\0303\013\2701\241\273\206\307"
+	.ascii	"c\361J0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_dyad_getSocket.85.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\355\007"
+	.string	"\362\316570\217\222\016$\036\224\270\371\326\332Q\347.t\305\f7\265\265D[\013\035\244\b\355\037\336\374X\017\352\177\2631#\b\365$!<~\343!@\024\322\340\026[k\204\310\024\036\216\003\nMd? l8\321f\213\350p\236\315\241\003\221\371#\301\001m\241\317\007\264abv\b5&h\361S\264\244\3232S\341\222T\2104\217bw\004\003V\246\367\362\261\364\340\306\367J\250\0326\266\357\272Z\030e9\311\314xq\311\025\f\345\343'=\346\177\357\273\252\b\251qT\201LU\n+3\036L\240\025;j\377\005i\b\351\216\341dJ%\264P\027&-\231\271i\232\311\212]\035\310\212A\216v}\335\355H\033N\035*\250T\251\017`!3\177\250\224F\207\375\013~\203\237\025\r"
+	.ascii	"\242\310\220\031\032\214h\211\03323\2501\266\273\206wL\340\225"
+	.ascii	"\306\350\300\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_select_has.part.0.119.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`1\002E\022"
+	.string	"\206\242sD\360N%\035c\234OQG:\332\334{\013\232~?9L\231[H\353T \362m\231x\325\272\253:\355\005\377!\271\2406\253\033UX\034\026\207;\206\371\212\356\267Q\310\351\370\037\253\177C\215\220\275\267\224)\005["
+	.string	"`"
+	.string	"_"
+	.string	"87\316\264\037\342\334\352A2\347\330\3251J\332\345D\016m@;4\247\331\007\232\271\261\355\203\370\317\312\216=\216\307\225m+6\242\245\335M\035\026\270G<|\007\020\017\225\303W\327|+?k\\\025\256\207\035\372\274\272\032\327\205g\307_V\262\273\3260\334\360\266Il\217\330\t\024\2161\r\377\372\337\221n=\321\237\027\372\317\021"
+	.ascii	"\344g\327B\307\264\032\240R\207#\335\276\321\214\0173\312\366"
+	.ascii	"\221\216`2\344\b\346m\016\2678$/\024?K\273\\\310\241E\264\225"
+	.ascii	"\215\362\313\277\212b^QL\013\004\232'\372\320\272n\254\371!\307"
+	.ascii	"|\332\335P\"iwA2/4\363 \031\001\334\006\252\351[\036n\0231j\246"
+	.ascii	"?\321\362ae\027\213P\243\276\325\304\312\316O\2412xu[\023Mv\023"
+	.ascii	">\"e@\212\335]`Cx\222\312\007\317\356*\020AA\345\367\034\372"
+	.ascii	"2z\330\223D\321\007%\232\354Rw\254\357oU\307\033\232\326\320"
+	.ascii	"t\206\2461\2624J\323\027Y\372\004\323ZLg1\003,?y\220/(.\352r"
+	.ascii	";\03091\221p\222ZI1QI5H\211\340a\025\013JK\352E\245jI\345U\307"
+	.ascii	"\207\275#5tCmlo\250Kh\224eU\335\261\235\241\030\252\341\001\333"
+	.ascii	"rN\232\241N\224&8\206B\026-\246\013E}\250\330\232\b<&>\275P\347"
+	.ascii	"\226\303zl\345\200\337\343\303\304\303\223\336&C\246\0323 `\002"
+	.ascii	"!\205e\033!d$\032\204#c\354\233\311\032\271\t\005x\320\245\030"
+	.ascii	"\235\202P\215\257*\202O\310D\\MI\f\303\322D\325&\262,\215<\036"
+	.ascii	"\341\210\321\252\030\007\217\302t\241\342\220\335\r\022\267\013"
+	.ascii	"\324Hm\nb#\350\274\214l\246\257\306+\322\335\r\244\317`>1\230"
+	.ascii	"a\330\223\232\335<#\371>\331\257\207\334\340\243\267C:\233fm"
+	.ascii	"d\204\324\215>!\340\001"
+	.text
+	.section	.gnu.lto_vec_expand.part.0.127.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\241\001\325\016"
+	.string	"\346Z]C"
+	.string	"\223\223\016\330\353\371"
+	.string	"\250j%\025D\305\\"
+	.string	"\034\002\315\002M\245g\221\354\230\264\211 \016\324\025QC\240\352"
+	.string	"\363\030\364\347\006\334\262\354\322\377weiU\215\334\242\215h<*\264h\374\204\354\275\245L)F"
+	.string	"L"
+	.string	"F"
+	.string	")\232\335\016\301\241\013\\\207\356>\022\017\257\013\210\207\366S\330\336L\346\354\035\357J\254\325b\203\003\214\217\335\305\016\225\304\271k>\316\377\314AJ'\3225\344\004\342\031\340\317z\260\273\276B\334\360\266\027\330v`'\201>\214\315\237\361\306\366e6\016\211\345\300a\f\253n0\270\0167~\371\230\255\333\223\311\017\346.\270\277p\315\003\260\031Z<\320\354\256\202\353\220\3634\377\262i\013\253x\030\310|\267=5\032\320\355\212\311\231\366W\234\005\367\324\350\"\273\250\3610\3525\365\351ul@\241\222+\37320\270\3067\341[\025\017S\277\302\262\352 \"%W\251.\326\367\267\212\262c\332\202\351\370\356\207/\375\036\363\353K\347_\376oD\032\250\330\375\260\372\261# \215\023\227\271\003\0234\t%\037\222x\241B\350\023\202(\032\250\223\231d\235+\3232\317s'\201'C\361`%\240,\204E"
+	.ascii	"\221\214Xd\3629\3014\221\350\004\313+\312\020j\344HQ\025\253"
+	.ascii	"\252\213mK\217\243\324\003$\237F\265E\024\362%K9\032\224d\177"
+	.ascii	"\206fa\024- \240\202\031\254y\2012\340\005\2215\203\207\323\340"
+	.ascii	"\340gDr\213\221v7\332\\ \357F\270\307 \325\fH\243r\3427\304\230"
+	.ascii	"\326\326%2\327\025\277\021\221u\227\230i\215\351\222\031\002"
+	.ascii	"\363?B\177\274\273\302\177\350;\325\306\367\325\325x/\304\362"
+	.ascii	"\221\363;\264[0\2227\315\202\333\213\222\323>\375\332>\006"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.part.0.136.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\013\004\265\033"
+	.string	"\366\263\257I\240\230Q:\n\316\211\3278\306\324\207\2135k\232\200\250\2134\301\350\nya\034\212\037\360j2\315`o\003\377\377\327\240i\022\360\332\364-y-x\035\236\036'\307\227\302\224\313k\214\375\022Y\376`\177\365"
+	.string	"\371\204\020)S\n\232"
+	.string	"\216"
+	.string	"\241"
+	.string	"4\276Ib\310\252\366\225\276d;\216\237\307\314Y\224$\310\234\276\003\027]\200\274h\337e\343E\3622\343E\3737l\327\206l\263\247\334w4i\224R\350\232\256\3149g\027\367\205Y\301`0\370\320w\217j;k\024\303U\322\346\377\367\320\005Up\307\003qV\310\n\032\021\343\305\323\2057VUP\007^\205x8\035\023\020]\324\035\317\304\303pA\320\225\024/^P\350\262\322M\265x@\272\007\336A\023\252\247\035\217\350\032;\311j0\347\364o'\356\226\333Va[\201\035\"\bE\266l\3253\253\226!\3251\226:f\3250\260Q\375Z\365\313\252]\253n\255\332\345M\177\313\252IQ\315\032\325\343\250\026CQ\275w\272\365\276\377"
+	.string	"\264Ws5\347\210\340\325d!B\311\270\323o\337\357\361'\016\007b\006\275\362>\316\303\007\272u\247\232\007"
+	.ascii	"\375p\371Ib>\304\224\322Q\325\234\263\346\242\023\220?\016\367"
+	.ascii	"\1775\273\325\362\352\233j\241o\362\206\274:\316d\373\016\227"
+	.ascii	"n\231\263\005\225 s\316\032\362\342\200P\365\276\332q\374\004"
+	.ascii	"Yn\345\350\332\227\r\245\344\222l\336Z\327\256\223\\\317e[\253"
+	.ascii	"Nr3pW\362\301\245\217d\337Md\274\350\262\177:\201\034WLO~\240"
+	.ascii	"\260\022\025IEa\313\222[\201)\n\220Z\331\3069\022\227\344\217"
+	.ascii	"`\220\340#iX\0030\226\306\335e\355s5h\356$\243\270\343>\227\204"
+	.ascii	"\323\240\303\0257\004\352\262\330\264\027\321\020\240\324\231"
+	.ascii	"\331\355\320+\367g$"
+	.string	"\210\267kd\n\037\342R\300\221\235s(\035\031\2249'\003!\037v|\244\237\361\242\356\201\017\223zDl,\3354\250k\344%o\216\254\252\274\0019\367\271@\333@\023wph=>\031FK\260\231\200\343a\302\354B\016\316\316,B\216\005\231y0\320zf><<=\263\226m\375\357\017a\025%u[\034+\024e\353\372\225\"T\027\266B5\207m\017\023\225\315a\033\356s=\\8\347\234\343\032Y\303p_\277\262\267\341\312V\310%\304\231\235j\242\243X\240|W\345&\2633{\303\304%)\245C\312D\321\260\202\324S\212\351kc\313Z\377\351\001\004\375\316\377EI\345\026\204cv7\266\n\314\325\200\331\230\375\227\034\2660{\242\025\277\227}\355\330\013\352\002S\250a(d\2243\2120%\023H42\264m`\002!Ue\035\020h\212(\205\215\003\";\247GlC\0312\021\227\001\r\r`\224"
+	.ascii	"\315K-\205\036\020\301\367l\334\361f\233&\344\221\036=6}\350"
+	.ascii	"\013\204?\360\363\213\263\367a\341\235\365\320v\\\f#\365\305"
+	.ascii	"\2579\346\310J\360\004\022\314\206\231\203r\245\202\fx\"\345"
+	.ascii	"\245\201\324\213.\376|\201%\0305\356l\242\242(Q\277MfRv\300_"
+	.ascii	"d\210\237G\3320r\220.!ck\353zl,\254sF\254E\235\262\027\306\263"
+	.ascii	"bA\211\341\236u\323\226k\265\355\253\0032\250\301\220:RpFc'R"
+	.ascii	"\263\032\374"
+	.text
+	.section	.gnu.lto_dyad_close.part.0.138.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\023\005\225\034"
+	.string	"\306\360\252H\240\230Q: \253\361a\207\360\002\215\330\230y\322>=HbHY\240\005\254\334\231\256\2370$~\033\377{x\310\254\313/\257\246}\214\337\016J\305\372F\272\036\243}%\3719\357\016K\207ek\223\316\347\021J\b!;\245\215"
+	.string	"\235"
+	.string	"\220"
+	.ascii	"\207\272\223\334\243n\007\026k\317\"\323\222\326\356z8/\215s"
+	.ascii	"\276\034u^\256\365(\356ND0t{\364\\\253}\2467\345\356Dt\004\273"
+	.ascii	"IMT\273(\205\227\216p\2764z\006\346\313\363\n\314\227\366\227"
+	.ascii	"l\343z\316\331h\216\002\027\306\324DGTqwc/\307#\317\275$\307"
+	.ascii	"j\346|\335K\236\357\307\311\312\363\371\370H\336p\271\322Q\300"
+	.ascii	"\267#!$\tY\363\364u\207\317\250\326\0047\001t\330]\237H7\200"
+	.ascii	"\333va{f\227!\002V\273<\272\332\354\220\262J\222K]\f\316N\200"
+	.ascii	"\272\335\342\370\006C\201:\025Uh\260\370\362S\007\203\205e\342"
+	.ascii	"\n\367\305gFt\261\262\002\261EKMK\215C\026,6,\266\235+8+B\025"
+	.ascii	"\206\002{\364\366\b\275p\276\244\202s\317\226\362)\271Syx\263"
+	.ascii	"C\201\276C\231\241\n\026\367h)\234/"
+	.string	"oH\001\366}(\237\362\243<\301\255nC\2250X\334\035\272\32055J~\301\335}\r\371O\374\032z\324\215\\ h\255\022\006\227\354\336\177\302\371\251_R\270G\335*\f]]\317\001.\236\326b\267_<\365\031\313\002\224\367\320\264a<\365\320\262\247\317\371\215a\002\344F\356\026\341\360\251?\312\021h=\221\243\222\355\234\243\241\021 \262\370\205)n\031\250u\264{f\365<O\340\362]\355F\235\307\237\r\221.\3418*\235f\326\261\001T\231]ec[\306\313\320\316:j\370}Y\323\204s{\306\211\036\016 \356\256\314'\203\343\307G\362\322'2_>=Y\345\347\245\270UT\273\352\250\344\321<\271c\222}V\327\243\377\027\324\237,\366\231\331\200h\364\334\024\300 \313\240\263\243S\301\302N\316\t\024\345\354?<\263\240\0336\323=9><7\237X\r\032\317O,\006\215\006\003\003\331\230\005\305n"
+	.string	"\001\005\305^\266\353\311\035\223\354\016E\243Q)\365k=\345\226\252Q\216\251\026\345\234\036"
+	.string	"\221~Y\305-\017u=<\375\341] \034\020_\336\307/k\311\226\203z\341S\021'\357\243=\202\004\214+\310\325\321\250\263\317U\202"
+	.string	"q7\307y&\316\034+$\240xj\253\300\335\225\231F\262\322\360\220R\b\231\366\212\247B\337\272\335\302\257\231vo\250qT\206\020332\"\n\222\2024\035\220\002\021+\0337\021`9\202lF\332\222r\306v&, \r,\344\211\006\337\337"
+	.string	"\207\272M3\361\255\245h\213\021jv\235\316\241\007\231\217\311R\241\370\357\266H)&%\201\203\357\3364\002\262\323c\306\254id.o'\302k\237\006\025\262\365E\ndD\261\323dz\260,:\221\3343\225\227g\376\340\246\272\233\303\005A1l7\224\031\344\357C\2264\312\251\311*\322\300\210]*\261-\030w\032DF\003%\016%\342\371ih\"\302\207m6\364\\\007\033\302\n\202\b\304\037\033Ww \300\304\317\023TW\306\241\0217@\261\027\352\304ir\345\003\227\007|9\334i\277"
+	.ascii	"\301q\006Q\321\037R\357\024\210\266\313f+n\t\234\337s\023]\311"
+	.ascii	"5\2327\365\220\347\007"
+	.text
+	.section	.gnu.lto_stream_initSocket.part.0.152.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\360\001u\020"
+	.string	"\306\037nF"
+	.string	"\257(\035_\033\316\376:\177\025%\323\326d\205y\024\036{\300\250\004\225\371;`X2M\376)\364fL\233\362Ed\310\033+\341C}h\033\365\243\376\377\337\211\274\347\032E\316\263\007\262\350\242"
+	.string	"\344\023\262\345N)W"
+	.string	"Z"
+	.string	"Y"
+	.ascii	"\254\253\210t/\fq\274\271\355\316\016\234s\001\357\234g\236}"
+	.ascii	"\021\253\227m?\304e,\3336g1Xg\264\231\300\302bwA\347>\327\350"
+	.ascii	"\316\315\013\350\316\351\206\263\256r\262|)\302Z\327\327>?\274"
+	.ascii	"P!\302,\\f|vB\273k\357\302\315\335\266\002\333\rl\311 \217\271"
+	.ascii	"\332\367gNc"
+	.string	"{\fr\031k\212\207\022\331\356z@\356\223X\371./\361\232=100)f\022\274\320h\266\375\345\325\21477\004\336[V^\353\345\271\2146\267\335\3458g\225g\261\315\030\273&2\232\335\345\360X\266\307R~eu\025\221\215\331VxYJ\373)\237\0055\017\b\304v]\027K\236+d\340\234\252\355q\222\027\375qi\313\376\t\t\266\371\034|\243\350\316I\225#V\300`\030\2219\366\244\rA\325]\274\276v\017\b\027\261\0267\022mIE\261\316\317\325\023\317\257\374\252\322\222\223~g\300\002\234\3351\007g5p&:\274\345\177y\016?\217\021\250\372|\241\350K\215>!\370\361!\231\"\200\243\r\0238\002C0\205\362>TH8ARw\022}\251P\325y\324A\022\205\220@\037%\321\t\344\240d\3220\210\372R\240\020\004S \371\271z\342\327\236!;>\225\202\355\251\016\215(\211*\212\355"
+	.string	"\031j\306\022\332\252\211\001H\251\227y& \320\"21n\376\370aoHH\313\315\3046:'\006y=\302\022\203Vb|]\300\203\205z\332\236\214\021D\201\013+\213\354. "
+	.ascii	"\016#\005}\354\337\202\205\246\032fx3\202l:\323'\333\372\344"
+	.ascii	"\006\036\325\016\355l\272\256\215\210\220\336\350\023\026\036"
+	.text
+	.section	.gnu.lto_dyad_end.part.0.165.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`)\001e\r"
+	.string	"V\030WC"
+	.string	"q\225\016<\351y\272a\212`x\201M}\036'\377C\232\246QOF\\_\016p\3744\307`\331\f\333\020X\233\302|4\001\350\214\\\236\bPU\335\210\031\363\021\334+\006\371\211\013\3136\262\367\226)\005C"
+	.string	"@"
+	.string	"E"
+	.string	".s\366\213\203\337n>Zl\bg\354\256\366\031E\234\373\224Q3\316G}*\253\343\270\274t\034\2172\300\207\022#\323\255\244V\242\241u\330\265C\247R\035\360\254\302\331][>\334\225\333~`\033\201}/,H\330\276\177\342a\351\"\276x2^\273[\272\017;\331\030\214U\017\236\036b\332\200\353\301eU\373\037\007\341\036b\272\200\335\016\023+v\301\005\237>`\3714xM\366i9\201\354\323~\t\333\247\321\303\t\256\261\200\210\213\225\242\330\336\236\302$\006>\373\302Q\2142&\273\333`$\003\006\177\304\247o\312>5\036v\031\363`\234\200\2444E\243\207cv\271\261\303\226j=\370\277\242\236\003\020\273\255\024\032\033b\006\241\316GD\032e\226\300\300\323)y\264\n\240NH\213"
+	.ascii	"\242\240\361f\341#\322H\333&\3220\347\244\242\312qn\350\243\037"
+	.ascii	"\202&\350Y~x\316*\242\034\377\324H\t\007\251\340v\350*L\002\300"
+	.ascii	"\004\202\027{\305\264\306\353;\211\001  @\002\243\2443\017\""
+	.ascii	"\310\264$\330\r#\t{~(\037s+='o\357\\a\001\324\027\"O\215=\226"
+	.ascii	"h\2543\321\017\363\204\253\230 \242\230\313\211ac\264\302\020"
+	.ascii	"\342\345'i\267\333N\3315 j/u\343\026\313cm<!\340\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\371\016\3056"
+	.string	"\212ZX\024@0bR\007v{\212*\251\246\272\377\362\317\330M\311')\200\220\034\001\243\320n\265\356T\033mk\267\022"
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.ascii	"\3160\200t\221\221\225UX\367\032\353\234bP\017V\r(6\361iK\031"
+	.ascii	"9\001,\0013\001S\372\336r\365\255GJ\337{\242\364\315g\253\357"
+	.ascii	"<\255\276\365\262\372\276\003\245\357=\254\276\371\236\364\215"
+	.ascii	"\207\356\333\216\223\276\357\270,\313{;\361\271o<N\355\233\216"
+	.ascii	"\313}\327\351}\323i\322\367\034&}\317-\351[NI\337qI\372\316n"
+	.ascii	"A\3227\\|\210\212\345H\337oF\372v+\3227\226H\337mC\372f\023\322"
+	.ascii	"\367Z\220\276\345l\3009A<@\372\216\343\376\350\373\352\243o5"
+	.ascii	"7\333\243S@\320\307\307\306\243O\330\321w\355\352\350;-G\324"
+	.ascii	"\020G\337h7\372\005\033}Z\243S\321\350SR\007\206W\335\202;\313"
+	.ascii	"lf\364\n\264U\347`dt\b\004bt\256\005F\227z_\364\250\233\315C"
+	.ascii	"\344\242Kp[t\0064\213\316\267\350\025\235g\251\350\273\220@\212"
+	.ascii	"\276\r\271(\240\303\023\360\360%,,c\242/(\321\245_XXXH\242;\030"
+	.ascii	"\321\235\270\210\316\024\242;]\020P\303\004\006\206\324Y\006"
+	.ascii	"3\222eY\376\320\021\360\264CbX\036z\223\333\241+p9<\r\177oN\313"
+	.ascii	"\033\n\f\0015\364\370\225\347Y^\263w\337;[\205K\211!\f\224\241"
+	.ascii	"7p\367\336I\301Z\356 \316\257\272Tz\343\314\267[\226D[[\351_"
+	.ascii	"\253\322Ca\2258!Y!\033\325\362\211\365\362\2134\337z^\320X\267"
+	.ascii	"[\322\363\371Hy\341\013\241X\261\336\310'\322S\344_q\267\314"
+	.ascii	"\311\334\306\"\377\245\333\220>\271M\322\310\232\273jm\203~\216"
+	.ascii	"\216o\334\3069\276\221\336r\216_\2549/\273K\353::>\221\346\233"
+	.ascii	"\217\334\233\261\275v\374w\263\035\237\323S\307\207\342?=\376"
+	.ascii	"\023\3775\273']E\343\033\255\305'\316G\305\347Z\376\344\242\346"
+	.ascii	"=\372\252}=zN\307\277\254Ok\3565z\351\013\357\363-\337xa\203"
+	.ascii	"f6\332\373Wi\357W\325\357Cq#Y\355\375\227\346/\3132u:|^\345\034"
+	.ascii	"K\231A/n\364\311k\322\272EZ\215\333)\376\257v\363\277\342Kj{"
+	.ascii	"uT\374\211_\234o1\244\305o\033U\373\036$\353[p\254oAb}\003\206"
+	.ascii	"\365=\310K\337\204\272\364]\210K\337u[\372\266\003\353\333\217"
+	.ascii	"\226\276\001e\351;\020K\337\177\276\372\366\363\352\273\317\225"
+	.ascii	"\276\373\254\364\255\355\352;O\225\276\003Q\351\373/\001\340"
+	.ascii	"o^\3676\035\374\311\031Y\325\032\347)88h\214\360\2775\337y]i"
+	.ascii	"\234\030\341\347\363\020~+%\3701 \341\1772\202?Y\345Ke\272\332"
+	.ascii	"4\241\217\2347\364\211\327)\364\211\325#\364\2113\022\364\337"
+	.ascii	"*\377Apg\004\243\240\317\255\334}\262'\257\331oP:\320\347\330"
+	.ascii	"\250i\324?Ea\t\374k\235bz^\345Lo\305]2|\177\314\226Ls\006\360"
+	.ascii	"y\315.k\271\364\274>>\177Q\030W\032\322\323\355#\204&\340\371"
+	.ascii	"Ps\3177\001o\325\024\360M5\347a\002\315pm\3477k\276@\316\037"
+	.ascii	"u\351|\245\225\357Eex\376l\254\223J\214ol\2739\277X\345\007\f"
+	.ascii	"Q\353\226N;\255\266\355~s\376k\345\274\216\2311q[\316\371\304"
+	.ascii	"*w\347\004\373\310\226\315\177\233\317\267\331\346\363+\347b"
+	.ascii	"\b\001\345v\\s\332\374&[\376f\335\231m7\346\013\2517\363m\\\271"
+	.ascii	"\202/?\352\224\371N3\267\320'"
+	.string	"K\246d~\322\274\231\217\274N\231_\264r)@X\2026\226\311\271\3520K\346\363-\347gm\272\3547\346Wq\013\3244\266\r\307|c\033/\302\203\307 }\360\340y\265\346{\221\331\0313\245\364\225\320I\254F\256E\266|\370%\205og\245\337c\346\333\317M\230\237R\372NZ\3513\253\374\030\310\007H)\375\244\225s40\207\260\266\236\224\256\r\254\220R\312\363\374\325lJ\007\237\2449\2004\260;H\272.\032\270\363\242O\254\302yF\237k\243\317\255v\242\317\263\321\257\212\306\r\276\211\346H\205|\177Kt]\374\317\035?\263\346\257\247\017\224\263c\374Iu3\376$\232\017\271j<\345\225\277\237A,\225m\027\177R\333\214\207^g\370 \267w1\340V\242\301\215\027\177q\346OXw\226\366\214\377\255\233\361\2774\037\232\265\241\355\267\370\371\325N\374\334\232\215\343%\006o5\266\\\360VI\n"
+	.string	"HQ\304\266\335\022\270J\004\337\271\234\360+\251B\341O\2425R\363\002t\211\316\232\360\027\321\362\006X`\274\002\300/\244\336\360\373\240\247\360\367\320\036\341\317q\345Gx\201Z\033\013\177\215\353\256\003\377\f\253*?p\325Zq\302\357\244\345{\020_!\256"
+	.string	"\3607\315<\351\217\236 \023\376\245\232O]\371\262\013\200\350\250Q\024\207\231\316\214\210\004\"\"\n\222\244\003\240\002\251\241)\316\001\021\200 \350\234\"\201\214\004\022\220\210Iz\250mY\220\272\225\026\217\220\2364\217\r\330\226~\020\036\r!\307\367\223\367\005\327\003\370\211\275\017\355H!>b\301\316\265\203\263\2259Ri;y\270\206X\222\324~xSl\"\352(\337\336\355|5/A\177\326\003x?\240\217\237\326\344\201\220\372\333H\252\346\250\272[\367C}5\370{\354\242\036V\033\222}\032`\210\251\200X:\006\246\241\275\227x]<s\223\311\332\367<p\204\315\037\327\357\314K\253\034\336f#\310\201X\3536\201\265y\312JU\327C\322KL\377f\227p\351\274L\311'p\351A*'\336\324\217&\310XZE[[\354\211\331\036V"
+	.string	"O\257\372\013\373W\272\246\252}^8L.\260\006\214\f\030\223{c\322oH\327\034\217\371\345v$\f\305.QNr\307\363\004*\375I\001X\276\024\rrl\265>\234\217\347s\177\236\207\363{?\316\307\363\271?\317\303\371\275\037\347\343\371x\003\367\366G\f\201%\363X\230\017\235\333'\303\250\300>"
+	.string	"0 .\t8\r\233Sl5\2478\3563j\260\004\r\201\031O\200Y\312!\255\301\320\b\307#\306\247sF\227\027\027\346\310PU(@W\330\r4p\341r5J\345!:\315\276\006\302J\356\313\245}Y\306'\225\241\300\026\001\371\313\360\317"
+	.ascii	"\340\212\273\262G\261\023\2316x\212\031\303\222%\013\2460\345"
+	.ascii	",\274\004\377\013\361\226\247,\217\361\325\021\366\244\367;\016"
+	.ascii	"\255\232\341\305\272\345\313\220\211\263\023\006{\355\3465\247"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.refs.982424847a4d410,"e",@progbits
+	.string	"(\265/\375 \3665\005"
+	.string	"\"O''\220)\031\016K\354N\330\377\377\377\377\377\377\211\203\275\326?\276\020j\253X\352&b\305\377\215\354\302M\221M\332\336R\246\177F\371\027\375-*\312\247\350O\224K\364#\312!\372\017|\207~C\237\241\277\320\237T\276\240\\R\376\224\017\224C\312\035\345\r~*\025\236\003\320v\320/\356\007OH\223\331cF\340\253\214\262\347\354`\017=\331M\267\243\233\351/\374\304\r\0327<\262)\353%k?\316\023\254\207\360\001\326\336\272Q+\305\027\305\023\363T\\\322\343iG\320\026@\377 \207~\214\001"
+	.ascii	"d\004E\n"
+	.text
+	.section	.gnu.lto_.decls.982424847a4d410,"e",@progbits
+	.string	"(\265/\375`\306\213%\035\002Jb\227\274T \016\241\235\306KI\016J\335\23469\307\371E\013\366\002\240\t\356\252\311*\350\025\324\222f\246\244\305\357\245h\240\227\030\007\205d$\355\0206\341\265pvG\036$\003\372\253=\246\3471\343\324O\024\207/\026\221{{\030}\244q :&d\313\275\267\334R\246I\n\316\013"
+	.ascii	"\f\317\316&}\254\3153)H\223\276#QKv\364a>\236f\235\030\316\317"
+	.ascii	"U\372\371H\343\361\331p\322\313S\301\220\232Cyx\211N\r5\033\234"
+	.ascii	"\237\177\364\363\326M\034\006\266$N\211\235\n\272\226\242v8I"
+	.ascii	"\007\225\026\207\202S\177\372i\035\335\221\224:9\301#tG\2106"
+	.ascii	"\272V\0309\202\347\030\220%h\004\347\247B\364\323 qE\232?RpR"
+	.ascii	"qEZ\235\232g_\021L\204e\206\035\023?\234\237\372\320O\241\364"
+	.ascii	"\217\207|P\021\274\273\301\022\362\364QD\211\007\347\347\333"
+	.ascii	"\032v\264v\347v\374\246\r\363\220\002w\376\267,=\006]\334\265"
+	.ascii	"\221\021\262x2b[+\346\301\330i8c5\036K\244\302p~\232\244\317"
+	.ascii	"0\026.\023\221\323\274\200\222\350\005\242\244\017\272\367N\303"
+	.ascii	"f\030\355\222\341\263\377\332\341\036g\230\307\355\273tc;\333"
+	.ascii	"h\222\363\206u\257\232\222\270\351\374c\037\307e\307d\251\217"
+	.ascii	"'\220\036\2621\242\223\216\250\034\234\261\330\305\212!g\203"
+	.ascii	"\363\323\031\372?\006r\311p\220 \230\013\207\325\260It\206\370"
+	.ascii	"\210\356\275;\210\260\376\0259\351\345\374c\257\343\260\037k"
+	.ascii	"\341-\374#%i\003\225\234\257=\0268c'\376\272d7\202\301~\323\212"
+	.ascii	"\b\371p>N\242c`d\275\221\025w\275\034{\255\206\202.\306pf)\242"
+	.ascii	"\365\276.\353\335\267e\305Y/\307>Z\326\346\220s\217\355\275Y"
+	.ascii	"\3225!9\2048c!\032\3575\375\343\035x\347.\24122r\225\246B\024"
+	.ascii	"D\211\211\325\r\274\204EQ\262t\bq\005q\rU\341%\235\004\351\005"
+	.ascii	"\036\325\371p\315W\017\"9\246V\232\236=xL\341@\002f\264\002\347"
+	.ascii	"k\204\205N\315\347\016g#l\343\t\n\nK\341\247K\206\243~|\003;"
+	.ascii	"\341(\314s\276(\034\205\233\376\\\301q\356\237\233\367\224\363"
+	.ascii	"\026\305z\202Vj:\337\016e\230Ie*JP\r\234\217\267\364/\031^RZ"
+	.ascii	"Q\253\001\367\2053Vz_\312\366\220B\001\215u\341|\300\266h\303"
+	.ascii	"l\211G\022\022+\226\244\020\t\323\310}/\242\242\340\214\217\260"
+	.ascii	"\225\376q\021&\242\222[\2013\246\321\356\340\343\263\301\371"
+	.ascii	"\330I\363\234\317\303\215\316\b\035v:x\307\303\215\316\210\256"
+	.ascii	"3\350\226\013\263\037\303\300@x\b\313\3001\360\f\034t\311\260"
+	.ascii	"\320\217}p\263g\f\277\270\201\036ntF\254\225A\367vb!\3743\225"
+	.ascii	"&t\305n\332\245"
+	.string	"\033rn\240\020h@o\321\275\235,,\226\004\336i\310\307<:u^\227U\304mY\217u\364\261\215\376\035\324\277OvZ\260h\305h\222rn\355\275YZ\266\301\035A8\377B\365\217Y\340\234\244\034iw8\3778\007\257\310\002\222w\203s\207\020Ds\f\341\374\023\376kwWF\266\345\366v\205xA\355\224\004!\343\202v}\3355\0219\315\266H\213\261\260&\177\222aA\365n_\372\325\324byYD\222\234MDNS\203\264\026\\\320(\270\006\337\\\302k\210m0\316\215^(w\360\036\342}\005/\331-\274N~\375\356\037\016\221[x\213\\$\"r\232m\334O\310\273i\"r\232m\316\223\017\350\336N\256\302\373\344\006\212\310i\266;-\310\240{;\241X`x\177\256\340h\3308O[T\327\253\360.\371\363\322\215Y O\013\272\367\026\241\203\b+Q\212t\274<\004\002\256cR-t"
+	.ascii	"^'\330\371B,\n\347\337=\315\356\353\262\036zD\377\022\321\277"
+	.ascii	"n\372\356]&\227\354\317\313\367\026\307\271\303\366\336,\305"
+	.ascii	"\035W8/p\376\025\3232\354\275\367\375se\017\017\017\017\357\237"
+	.ascii	"\353\257S\377b\351_+\375\373"
+	.string	"\244\177\211\364o\217\006\341\266\254\2779\032\t\\\335=r\351.\331E\202\344\212\335\271\251\265\275\235H\332ZtA;\210 \002K\232\036\326\240\316\377\235\223\3236\310\202\fq\276FR>5\252A\234\377\002\375\377\222\3358\347\356p{\252V\304\341\374\2456A\210\220!\367y\341.\331\025\"D\253\265\360\202\232\320w\336\226\365'\374/kW\354\246\255\324l\330\233\tjmo\347/\030\220?W\332\275\225\316\326\366\336\377/\333U\273m\227\354\256\375\327\353:\337\301\271\367\331\336\373w\353\376\270aw\355\006\3713\375jn\234\033a!j\2369F\321\275\267\b\"t\020A\205\260+\037\235\177\311n\332\177\265\356\326EKu^$\355\261\275\235\033,\300\203h\017\347kv\317~\321n\331C\240\360\264\006lo\355\275/\232\002\222\366\266\271h,\204{\333\260\334+\200{\005\220},\345([\363'\240\177\307\016"
+	.string	"\233\215\302\t\240\017"
+	.string	"\375\r\364W4\b\327e\315.\353\261\276\373\272\254\032n\313\372\265\333\262\236\356\266\254w^\227U\337\226\365i\351\b\225\177\375Q\0010\201\265\305\333\001\321F \300\277\212\340\034\016\300\202\314\013'"
+	.string	""
+	.string	"\003\377\035\301\202\013\t\352\371N\3747\325\201\374\017\205\352\370?p\352\004\277:\365\2531\374\217\"\365\337\226\035\301\377\350\013N\036pK\233X\016\244L\354\n\351\f\025G\236Cb#\360\3770\004j\252\224\032\365\253P\277z\343\277:\204\027\316p\322\1774\265\351\307D\216\200\237EA\377O[\273\371\204\333*\257\301\317\272<*\366\253\034\300\020\370\313\317\266\177*\303\177[\325\003g\377\265\360\317Ej\013\017\304SyIe\341W;\220q\374y\352W9\360c\026\277\272\201\037[\340\307#\376\334\343\307\020PW\220\200:\342\307\030\370q\0060\360c\270\260\037s@\275"
+	.string	"&\032\302\032\370\361\005\036\002\366\371\261\n2\016\202\177\375\033\201\001\237\353\177\005A\b\237;\361_907"
+	.string	"5\0014JF\230Cr\027d\376B\212bE\"x\357[\270\352j\206\271\200\374)\nJ\320\343OW\322\021X\375\2055\352-`\003<\345_m\374\252\005~U\205?e\341\371_\221\376\273\001\272;B\215\300\257\346w\370\327\031\177\206A\f~\025\002W\3775\350OK<\340\307k.\271\001y\347\307e\252\003\376T\204\332\200\264\204\fT\006\374YH\306\257\212\370o\006.\230^]"
+	.string	"\346CKI\300wj\n\377\035\361\0270\004R\027\003\374\004\377\352v/\224{\302\t\025\205\247\035\3767\237\003Z\007j\002\324C\340_\227\177\252\200_U\300\217\301\324\0234Hc\324\020\271\346\346\273\360t\276\253~\001\377\252\366\347\013\250/\377\337\376t"
+	.ascii	"\252\t\027\362\271{\357M\325\022\376\314\201_\005\361g\020\374"
+	.ascii	"\230\004\225\204\267p\016\377=\341%H\001\240&\340OE\300\tP\t"
+	.ascii	"P\302j\304.\251*\200?\255\200\nBN\241\006\340W\001\360\226\177"
+	.ascii	"\275\3713\t\177\006\361\253\034\274\375W\225\377\372\375j\207"
+	.ascii	"\377\376\375\267\311\217;\374\027\360\177\340\257n\240j\360_"
+	.ascii	"\273\377\032\371s\007\277\352\362_$\377\035\362\343\r\376\253"
+	.ascii	"\344\317\036\374j\006\370\376\367\310\2179\370qZ\200\037\227"
+	.ascii	"\251-\035\374X\345\2777~Lv3>\300\377\027\236T\016?\326\340\252"
+	.ascii	"w\300\237GPS~\265=A\325\177&\361"
+	.string	"\347\022\277\312\346@\034\342/\250\027\300\277\306\360\177\356\277\002\370\357\b\377-"
+	.string	"\002\356\207\377&\340\266\f\200\004\365\033\374*\327\377(\377\331\376\373\377j\377\207\374\027\377\177\376)\227\272\376?\362\177\360?\335\005\257\007\034\376\273\341\277\032\374\267\345v\370\372S\260_U\377\033\336|IP\363\177;\270\352I\370\325\257\377\202\351\b\321{\377\027\3767\253\370W\357_\310\201\"tp\021\376\265\004\027\224\313\205\231\360\317\203\377\335\340f\360\247l?\373\257\007\005\370q"
+	.ascii	"~|\200\037\017\340\317\r\370q\bP^\202\377-\344\300\377v\200\r"
+	.ascii	"\360\002\374\353\206\037g\220\375\376\013\376\217\3767\337U}"
+	.ascii	"\361W\325\376\354\344O\3412\364\317}\251\335\237\371\376\353"
+	.ascii	"\302\217\2712\223?\315\313{\177\326\373\261U\256\313H\376t\360"
+	.ascii	"\317t\177J\370\347#\377}\341\317s\377m\377\301\257*\271#0_6r"
+	.ascii	"\022\234\357\032\3765\315\300\177\276;\342+\277*\367\247l9\356"
+	.ascii	"\307\321\\\344\277\034\370\357\n\377\335\300e\362\220\333\302"
+	.ascii	"7\374*\224\037;)f!\177f\363\363\317n\377I s\225_\375\373\363"
+	.ascii	"\332\237\305\376\f\344\317X\177\236\3723\323\237\215\376,\343"
+	.ascii	"\317.\376\\\363\347\030\374Y\305\237\225\177.\361\347\343\237"
+	.ascii	"C\360g\016\374\031\003\177v\300\237A\374\031\001\1776\300\237"
+	.ascii	"=\370\263\206?\353?%\374\323\300?\325\373S\273?\205\373\323\266"
+	.ascii	"?\005\373\323\256?\345\361\247:\376\224\352O\247\376T\352O\235"
+	.ascii	"\376\264\351O\231\376\024\351Oi\374\351\316\237\342\374)\f\376"
+	.ascii	"t\206?\305\300\237\212\360\247\007\370S\232?E\361\247\311?-\361"
+	.ascii	"\247\310?\205\341OQ\360\247%\370\323\021\374)\b\376\364\003\177"
+	.ascii	"\312\302\237n\340O3\360\247#\376t\002\177\252\302\2372\340OQ"
+	.ascii	"\370\323\022\376\224\204?\035\341OC\370S\002\374\251\006\177"
+	.ascii	"\272\362\247\305?\325\177\272\376\330\345O\357\217\007\177,\370"
+	.ascii	"\343'?\366\373q\337\217\361~l\367\343\272\037\323\375x\356\307"
+	.ascii	"\035\370\261\n\377C\370\357\210\377\262\360\337\016\376\233\200"
+	.ascii	"\377\346\037\023\371\257\3741\215\037\303\375\370\371\337\002"
+	.ascii	"\374x\355\307h?6\3731\331\217\307~,\366c\260\037s\375o\341\307"
+	.ascii	"Z?\306\361c\254\037\357\3701\004~\\\374\361\325\217s\374x\352"
+	.ascii	"\307P?~\372\017\370_\346\377\013\377\371~\314\364\343\032?&\372"
+	.ascii	"o\373\343\241\037\303\3701\013?\336\300\2179\360c\005\374\370"
+	.ascii	"\204\037\223\360\037\355\307!\374\330\303\177\026~\354\301\177"
+	.ascii	"\257\376\033\202\377\202\340\277\036\370o\013\377U\300\177O\370"
+	.ascii	"o\210\377\276\374\327\204\377\226\360_\022\376\273\360_\365\277"
+	.ascii	" \376\353\301\177\327\377K\377\343\376\243pxxx\370k\200\365\263"
+	.ascii	"$\340'\321\026j\336\337\n:\234U\303?\263\n\211\336\372\376\267"
+	.ascii	"\354\233\232\220?\234\257\022\245\325AuP\355\2731\224\363\026"
+	.ascii	"UA\n\fT\005\177LE\257\n\362\265\206\205>i8\253P\316\327\242f"
+	.ascii	"\307\205\n\320\223'j\327\332l{\362\342\240\273\351\034\341*8"
+	.ascii	"P"
+	.string	"\250\352w\267N\236^\316\033\326\036\242\372\360\253N\256\372!I\312\203\303\371*[9\360\346p~\212a\336\363\324\276\273\367\336C;\305\223\312y\303R\371\256\366\345B\257\033=\234\017\2502\331\021\212\002a\262g\203+I\007\253\2651\220\330\t\252z)~ww*^\024\r\025O\255\273\232*\303\371)r\372W\311T\273?oS\213\265 \002\335\315=\302S\316\352\352pN\007\347\006*>\301\255\215\360\024/\255\322\251t\032\366\r\037\017U\n\225V\343\3248u\016\307\230:\347\002\034\247\031\316\252\221\264\212\347\360-\005I\377j\221\317\031V\355\2501\344*\221_\225R\341T\250\030iPp\276X\327eU\337^\256\016Qq\222\342\241\346vU\310\257\276\251\317\257#\204Y8_\252\353\262jp[V\265\355\345\252\033\213\321T\315\020\316.kW\331\212-\352\2421pV\325^\256\256\261P5\270\242p\366"
+	.string	"\355\227LE\303k\034\232\031 3\002Mi\352_5\353\342`(\3244\313]+\214\226\004\252\365\254\b\t\254\313R\311\324\261%4\256\236"
+	.string	"\271:\366\253AT\261\225\"6\206\364\340|\223\256\313\232A\330\313U E\263\270\302\0348\2678\257\376\370\325/\025lU\323\332\202\2013n^\227u"
+	.string	"\267eU\275^\256:U=\275\277$8\013\340\266\254*\327X\341\017\023\316/\026\352_2uK\325\312!\206t\304\307U\255\301\300\262\0358\037\360\317\377m\016b\323\222\353q5\353\307]*V\034\221$\2038?z]\326\314\342\345j\217\303C\267'\225\307\213M\327TE\246V\251W#\234\273\206}*\222\363\026\335\315\346\b\277ju\365j\211\016\341\033\316\252\216\227\253V5p\370\264\341\374b\236V\251.Z\213\024\203\250.\307T\337R\033!\316\352\024{F\327\344\007gU\352\345*\016\235\304\243\307\022\316\033DA\241x\302\245w\303I}\342\243\321\005\205\363\205^\227\025"
+	.ascii	"\267eU\233^\256\336X\311\2521\232\302\371\003\325\206\312\004"
+	.ascii	"\030\r\344Z\272d*\323\347\210i0\204\242p~y\271\272\3445\3705"
+	.ascii	"D\251\306\272#\350\247\251\036]\255\361\253Hj\022\332\363\260"
+	.ascii	"\007g\020\366uY\363\276-\253j\364r\365\250\270c$\007\023\234"
+	.ascii	"\323\303\"\225\250\307\027S\016V\211\376\364K\245\221m\034\351"
+	.ascii	"!\341\334\341\272\254\277:C\035j\317\n\347\224\250BW\207\376"
+	.ascii	"\353\246\312Hy*b\305\206s\336\327eU\203^\256\n\211\305\030B\202"
+	.ascii	"s\004\324\030\367\263a\343\205\363\n\234\033\025\206\372\243"
+	.ascii	"\362\250/T\037uGm\241\272PY\250@j\217\232\243\352\\2\265iS\243"
+	.ascii	"\356C\303B\302\301(9\2526\323\235\354$m\215\003-\346s\244\211"
+	.ascii	"\207\034#C\361p\2433\242\007\321\316{bSp\331\315\303\215\316"
+	.ascii	"\210\035Rx\331\210\332\221\025\271O.\013\351\252\313D\324\002"
+	.ascii	"\263\022\263\027L\362\021>'\271npmo\247O~\262\207\007\363\022"
+	.ascii	"#u\205z\243\356|\250\332\344\302L\230\rs\024\025G\255\311\321"
+	.ascii	"<x\311\262`\026Lw\262\223\"\021;\260Z\303\026uN\017\272\257-"
+	.ascii	"\360F\016\314\200\227\205\216\034M6ko{+\221\266\253\250\374\227"
+	.ascii	"\375r"
+	.string	"Y\223\351\206\035\274\273\t\002mB\304\241\013\203\002m\362\262C\255\0207y&5\3611\231\002L\352\312|\231\311\312\223N\220\234V\356\210IT/\357\016\316\340!\250\227\207\202.\"b78\340\262X\370|\376\3662^\276K\231\233\241\323\203\370S\004\344&\025\342\254\"\312v9\211F\223:\262\265\262c\007\021\252\334fFV\224\221d\272b\315\r&\2655F\223R\224\022\364\024\026\311sYN\377\340Z\022\205\277\212\334\356\326(\325^M\216\313EV\254\366\202\234\251bZF^\271\347\311G\223\f\227\207\0045\201\t\232E\211\341\266\346\2341\001\313\317\374\226\243W1\330\262\324X\234\330\212\227\336\016\264\334\226\331\264]\024\2659\247\213\253\262\2615\265{\350\006\324\245\326\363\301\331\327\226\226\321\326;\245\232B4 +w>\244\216p\376\t`M\300\274\242\330\371\270i\354\256\333\267iWU\350\265\225\273D"
+	.ascii	"\355\253\363\244j0\354K\205\252(U\006\222\235F\252\004\241^Z"
+	.ascii	")\020!U\016\313e9H&\313fY,\217\345\263K\226\201\344\036\277D"
+	.ascii	"\362\217\f$\363\310YR"
+	.ascii	"+R^\227\220\350\336\316\225\0324j\300\340\220\323}]\326\027\313"
+	.ascii	"\364\213N\375\342\225~\321)sa&\236\274\215\363\213G\372E\030"
+	.ascii	"\372E\027\372DC\375\347\254\214uc\024\001\355d\254\334#\245\307"
+	.ascii	"\031\033\030\316'\002\352\023\371\364\237w\340\263\242\223X\315"
+	.ascii	"\335\225\025Q\007\235\331\023\252g\253?We\035,M\273&R8k\330\327"
+	.ascii	"e\3059"
+	.string	"^\236\251vv\252\236\340|\2472\216\025]0\256\240\242\262\324EKA\031\017\217\034\234\363v\356\333\262\346\247\227g\250\267\244t\341\021\361\340\034\201\303\354\344'\004\265\204\363O\250\221\227<\334\350\214\300:\262\221o\\\262\334\224\231rS>\312I\304%A\253\326M\216H\325\232O\204Rz\317\223\013\035\234O\254\241O\244\2413\322\273\324\202\242\340|\342\013}\"\216\376\263\321\215\f\331\361U\203\363\237\213\262\214\234\223{V\324\275m\264\326\262\2144\232qD\3444K\320\244\0054\313H\361\322\300\225v\357\246\256\265,#\305J\357\322\257f\t\232\354\f\345\031\231F&\312BY\306U\365\371'\003=\303x\206\221\203\364\336\273\306\271}\330\034:9o\321=\324\374\360\347\030\317A\270N\t--\360\177\213\202\266C?\234\337:\321\377\357\361\277n\233\346\336\033Hu\356\346M\312\372\337_\365\336\017\277\312M\357"
+	.string	"\376\347\275G\220\331\333f.i\357}\237h+5\033\"\234\377\203\260U\272\275q\224j$\240\364\203\243$C'L\351g\203N\230\322\256\301\231\252\331\320\334J5:a{o\300\301\251Q!\351G'\314fo\320\t\333?{E\335\317\335N\245\232\215\223\2647l\234m\263\303\222~@\320\301Q\372\321\t\263\371\331\240\023\246\364\263\303\224\266\206\215c\323l\201\263\233\033v\230\222\223\035\226\364\243A',\351G'L)\352:\265\230\362\003\222K\262\221u\277tpv\017O\221MS\003\235\2163i/\331\373\216\345\354\346\246\333{"
+	.ascii	"{\027%5\227\330\310\270k7t=7g6I\327\271\367\346\200\347f)i\343"
+	.ascii	"\320\325\334M\247s\225\264\367\325\215\211\315\263\367\336\n"
+	.ascii	"\250q\322\355\247KW\303T\264_\344\354\335\301v\356\315\263w\315"
+	.ascii	"\335t{\357\232\2757\333,r\356MC\203\016\025\017\317\336C\035"
+	.ascii	"xvQ\r[\316\336xLo\355G'l)\351\205-H\030\325f\341\254\271:/\222"
+	.ascii	"6\325^\242\324\324a5_\373\305\336\373\376i\252\037\030~8\347"
+	.ascii	"\236\314cC\020\272\2673\367\344\026\371\305J\215s\327\030\237"
+	.ascii	"\240\256\260|r\363\222\345\236\264\211\235{\343\260;T:qk~\013"
+	.ascii	"\246\377\354\342\371\305\237Yd\035\374\202h\250\t\316y\347\345"
+	.ascii	"\331\005\3161\026\027\207\263\212\017}\350uYWn\313\372\266\207"
+	.ascii	"~Z\366\277d\234\2240=L\235T\027\020\363\3117yE\266\271d\031'"
+	.ascii	"\327\370e\234T\360q.\360\2062N\336)\335\n\362\240\256\212P\244"
+	.ascii	"\230\370\351|-\250\257\233\350?5|z\370\247Q\322\301\213\226\202"
+	.ascii	"\017l\342\2368\247\205/O\r\337\202\3047\004\205\363\001\3534"
+	.ascii	"Ku]\326\007\336\226\365z\210\276v\323?\301\357F\023(`\372$\375"
+	.ascii	"K\241\\\2624\020C\311\201\351\2224/uR\265;x\204\320\300T/\205"
+	.ascii	"\246_Mm\306B\020\032\230:I\345Vl\234\273\031\003\235t\352G\236"
+	.ascii	"\016b\276\036\323\327^M.Y\nM\373\302Rh\272\227\362=\r\r\276a"
+	.ascii	"\021\211\214\334`\221\363u\017&*prln8_\343\320\327M\372\332("
+	.ascii	"\357\203\024\354\rZ\270=\256'8_\307\320\327M\375?E\222\326\245"
+	.ascii	"v\251\2224\311%K\357\260\337S\036i\217\347\264,.\225K\235k\232"
+	.ascii	"E\236\017t"
+	.string	"og\221\224k\b\372\364.\235K\351R\347\232\336y\352\271K\273R\270\364\253\331\232=\315\200\246wiV\312u\351\306\266\315\017\003`8\rv\020\301\354\353\020(%\037aw\342\224H\341|\215\243\317F\265\221\224\216\b\016\026\316g\373\364Y;}V\b\\\352\225>\323\257f\033\344F\031\224\310%K\341\322!*@\241\222r>\213\246\235\351\017<2\252TH\372\226\272]\262\364\231\235{\237\205\245g\251s\255\r\2027\006}\246hi\333\245\033\3326U\037\240D\007\3378\020A\204\364\205\020\016\217N\333\330R\260\367\031\320\331\217\0358\247i\251\332%\373 ]s\262\250\030f\031\016\342|\026J\377~\260\336\303\373\301z\026)\310\3233\263\273R%g$\004\347T,\035\273d!\244d\307Yi\331U\033\347v\356\355d\301Q\205d?p\326p]\326\263B\3727\2045=<\274!\254)\220\227\247A"
+	.ascii	"\200\366d\303\231\275-\353\331\035\235\376H\271p\322\336g{\357"
+	.ascii	"\r\326\036O+\0358\247_/O\301\336\362\200(&\0378\247\267e\375"
+	.ascii	"j\250\277\006\352\257Lt\352#\325\272d\037\322-'K{\367g4\206\363"
+	.ascii	"\327$\372\367\303\312\362a\375\372\324_\327\364\245\273.\253"
+	.ascii	"\207\333\262\376\351\216\237\345\001V\341\334\004e\203i\tJ\251"
+	.ascii	"\006T\022\022\324\221\021TT\232#\275J"
+	.string	"\255R\251\024G\372\224R\245U\251\216t*\275\221:]\262\024\312f\217\245EPDP\351\f\250t'\355\371\341cmo\247\b\"\250\274\320\253\303\341!\313a$\036ntFTm\341:|\247\026\267S\034\303A|(v$\020G!\033\303p\330H\272\"m\001\244\210\t\206\362\340\341=4\301\030\351\220\207\033\235\021V\205\330\t\006\274tC\0326\216\331\323\332\336N\237\024\206\334Zj\224\326H\233R\033\351Q\212\224\026\245J\351R\312\224&\2453R\242K\226\322\030Ki\244;iO\352\254\332\233\211\350\203U\364o(\272\267S\004\016D\320t\204H\232\036\204\264\216td\b\3511\t\"\t\245A+AuMQ\234\277\312\320_s\200~X\302\234\352\360\200~\264\272\004i\374\244M6O\t\236X\241\276\n\345y\321\2728\fR\305\363\"\035\272\341\304\352E\352BEs\013\274\303\371\252\235\276\372\246C"
+	.ascii	"\244\013(\325IY\344:7A\264\224E\232C\304\350\356\t\316W\203\350"
+	.ascii	"\253W:%m\007\224\246\364&\265a\345n|\271\2456iMQ\207\220\240"
+	.ascii	"\036'}u\310\260P7\275A)3,\274J|P\033\205\2300\335\241\365\267"
+	.ascii	"\205\363U\027\3729\212`4\345\347,\253G0\212y` 1E1\224\342\016"
+	.ascii	"\r@\260>\375<\367\344o\005Hs\007\372\344O\363\370p\245\375a?"
+	.ascii	"v\205\235\025\026\233\016gC\234F\2058\237\203.\335\232\265eR"
+	.ascii	"tE\260p>\007;\3649\310!\366\213E`\311\337\020VS\241\222\r\316"
+	.ascii	"\347\340F\353\243\365\321\002\271`\333g}\222u\t\301\252B\213"
+	.ascii	"\002i\303\336\002y\256\364!\035\005\342\334\376h\301\332\376"
+	.ascii	"\234\374\341\334~\265`^dO\234\227\320`\001\005\347\226\253u\316"
+	.ascii	"\310\001%\360M\256\354\207W\333E<\252a\243\204\345P\020,\013"
+	.ascii	"\347\003\266[uC\216(5U\257A-&\255V\316\332\302\031:BD\365V\007"
+	.ascii	"U\213u\301\266\317\r\202c\217t\b\365x\213\325\206\365(\371\340"
+	.ascii	"\334\362P\231\350\210>\301\271\335\361\201\037D\350pn\257\376"
+	.ascii	"l\211,\001Aqn\255\336\344\255\017\211 \316U\0344\233\336:\265"
+	.ascii	"M-\004t\376\206\260\364\221\034\\Z8\336N=_\3348r\204s+\265bS"
+	.ascii	"\026V\206s\373\324F)"
+	.ascii	"){z\342\334B\245b|aH8\277\303\240no\004\"\275\255\321\"\265L"
+	.ascii	"D:\177Cls.\315h\351-\323\277EE\246\004\347V\251Mj2\343-\321\214"
+	.ascii	"\326\350\351\220\247.!Q\226?\030.\376\332\242\267F\177dB8rV\212"
+	.ascii	"\003I\r8\234[\032u<\347ietHJ\223\244\r\361\241\022\245\244\353"
+	.ascii	"E+\364V\206\215\034fP\234\333\240?\225<\373\252pnc\264@C\276"
+	.ascii	"\210\300\341\334\302h\201\244\314n\340\300\271\355i\201\242\016"
+	.ascii	"\365\372\\(\031\333\373y\333\024\374\341\345\206\305N\2256\250"
+	.ascii	"\207s\353\323#F\020\2371\234\337!\256\275y\273\242\275i]\304"
+	.ascii	" \3727\244\202u(\304\013\347\277\335y\353\342\217\262\371\361"
+	.ascii	"\302\271m\361gzG\264w\003\347V\347\317\333\231\r\301\271e\361"
+	.ascii	"'\264\246H\t\316m\216\266\262\263b\222\201s\213\263\326\326\264"
+	.ascii	"5\332F\007#\247?\"\232\216\2651\262\350u\224\250>\354\220T\343"
+	.ascii	"\367\200\036.\226\336\332h\350\r1\274>$\274Obbp8\353\302\031"
+	.ascii	"=\204\214\020\362\205\325\024\341\254\007\343\2124\321\341\374"
+	.ascii	"\016KZ\013v(\202^\373Au`\326\222\277\241h\224\030\022!\300\353"
+	.ascii	"\300\034&O\352p\326O\364\237\223\016Ayy\272\317\315\251Hx\307"
+	.ascii	"7\305w\335\027\025\332\242\201\263f\202\231\340\360\360\303Y"
+	.ascii	"\357\275\311\245\341\304\202\017g\255\327Lr\255$\211\306\353"
+	.ascii	"\220T\343\204\001D|\340\265E\303\242\350@\271\273\306\273ilh"
+	.ascii	"l]\332\256\003\013\270k\"p\032I\366\271\316=\2647\224\342\303"
+	.ascii	"\357\t`\3345\222k\272@;\303%8\353#\354\234*UD\270\002\347\353"
+	.ascii	"9\2251\2374\0278k9\266HQ(\314\316\020gm\2045b\363\342)\f\347"
+	.ascii	"\203(t:\203\201\263.r\323\260\\\224\375\035\252\375jZH\207\244"
+	.ascii	"\032?\020\236C\1777-x\fi\267k!\372\371\344yx\203\263~\373\326"
+	.ascii	"\214\rE\353\266?\001\237\224\322p\326l\347Kyh\024I\303Y\257\261"
+	.ascii	"e\370\305\026\\\215\037\331\365\031\231F\273`\333\207}*b\030"
+	.ascii	"\215n\235\242\017)w>\310\2524\332[\223\216\232\034\316\332\f"
+	.ascii	"\263Ei\004\301Y\227m`\246\271\256\2754\227\026K\355\314\242\340"
+	.ascii	"\265E[\026<v\346\300\256\305\256\203\204@\341|\312\246 Ap\326"
+	.string	"@~\237\376\202\350\340|\035\326V193\304Y\377\320_\347\343i\333a\204\263v\276\211\312\331\227S\221\356\372Au\255\203Jk]\260\355\363\342#\212\337\312O\224a\r\326\265\326\265\217&\315 E8_g\351+\335\243mG\r8\326N*\212\017\315C\357X\261jle\351\035\231\351i\226#\016\347\003j+\273\273%\234\363\365Y1i\353\302YWm\360\"\352\217\322S\027l\373\200\240\b\024#X{\017}X\315\212(\375\300q=\365\002\355/\017g-\365g\020`\330\n\234\377\247\022O\217\021\364\306\365\323\rm\343\202m\037\0178\375\ra=q\252\363\301Y;\331\031]#\031i\033\035\222j\234\230\3005\3667t\3475\345B3]\333\310X@\256\304p\326Km\2213\355\t\316:I+\331\250)\"\304Y\327\340 %\215(-\r\347k\360\324\007T\317R~,\211\016\342\254\217\310\200\256c"
+	.ascii	"i\242\016I5~&T\355\374uEW\354p\365h\032\327DN\034G\216p\3263"
+	.ascii	"\376\274\021\004\013\303Y\313\320C6QL\356\336\344\320\350UT\017"
+	.ascii	"g\035\244\205\234?LJ\230nk\312\t\347\003\346\256\377\355\n\317"
+	.ascii	"\017\324\016\2345\f\rl\350\235\353\036\275\243\233\371\255\350"
+	.ascii	"\003\013\0220\302\246\317u\363\017\201B\b8r\020Fq>`\baSri8k\036"
+	.ascii	"\026OI\034\030\316\372\205J\004c\357\312\205\2219?\234\257\001"
+	.ascii	"\222\276\006<\206\327\333P\353\270\204\035\255FeI\216n\321\231"
+	.ascii	"\020@\233k\235k\026!P8\337\215=8\2345\216^\241s\376v\315s\022"
+	.ascii	"\026\003\347k`\243\177}\363\267+V[\213+\234\357\322D\353\232"
+	.ascii	"\363m\335 \r\035\342E\317F\211\262\204jW*\024d\256\310\340YB"
+	.ascii	"=\277\232\033\234_\314\321\305t\004gV\360\215\311Y>&l`\026J\331"
+	.ascii	"5\032\2347{|T[g\350\003K\232\227\325\022\350\331\300\263\200"
+	.ascii	"\353\331\336\324\037\316\354\023v\016\003Eh\205\177\304\276?"
+	.ascii	"\2523\234Y?\266\b\361\315Y\246\003g\326\tk$g\f\252\206\363\023"
+	.ascii	"P\364:bD\2053\333\344\246\315\b:\302\231\3553\273;\273\344\216"
+	.ascii	"\325S\271\366\2761\301y\263\204\r|rCI\336Y\275\242\016\217 ="
+	.ascii	"X<\037E\376\"\254]fq\235{\250l\017\273(c\022\024w\326\356l\222"
+	.ascii	"\020(\374I\224sj2\301\231E\302\326i6<\037i8\237=\302\322\375"
+	.ascii	"\355\345\242a\266\002\347\273\030iv\216-\3024\bW\003gV\216\004"
+	.ascii	"\243(5\bq>k\304\251\016\307\016\234\361\375su\021z;\013\367\246"
+	.ascii	"j\265\274u\33078\373\310h\365*\222\344(\272u\260>\260t;pGpf\205"
+	.ascii	"\234\035\362\267)}gR9p\276\013\217f\237-\020\213\034k8?\365Y"
+	.ascii	"Z\261\206\363]t\302\316\006\tc\333\322;V\255\b^[t\353\f}(~\271"
+	.ascii	"\370B\202v\266\355,[\b\024\316\207\305\343\316\006gv\355+Crm"
+	.ascii	"P\234\317\246\261j\177K\264\262\021\326\003\347g\220\247O\202"
+	.ascii	"\006\023\372\371\301\231=;\037\276\342{\341\004g\326\354\317"
+	.ascii	"\224!\274\350\215\262\271\245$78\263b\354\330%{\034Kv'\313J\033"
+	.ascii	"\013\2628\234\237A\235\376}\334\032\203\373\270\225\005\022\347"
+	.ascii	"\374\235,X\207\244\032'/YzwC\321\275\207>\250\201wE\224|\235"
+	.ascii	"\005{\262\020\331\370\301\311\240Kc\235\335\302b\273\324\232"
+	.ascii	"\224]\003\266}V\244\235$GX[g\350\003^\003\002\265\342:\333\325"
+	.ascii	"\007\210\3056\310\3728\253\365\267m\333\221\r%\234\237\001\222"
+	.ascii	"\376\331\254\277e\313\356\210\250p~\0064\3643\b\272\272by<w\260"
+	.ascii	"\022\020 Fv\234\345q\3732\216\024\031U\0069:t\024R\251\374\300"
+	.ascii	"\022$\002\245\242Z\263\332(\325\216\033\340\031\316o\231c\247"
+	.ascii	"\330\2515\213\203\333\236R\031 \025\033\024\024+\205\223\334"
+	.ascii	"\346\240[Y@p\260Qg\245\324\033\270\246\243\226/\326\211uZ\263"
+	.ascii	"Fd\340F\204\305\236\022\016\316o\261\322l\023\333\264\346\270"
+	.ascii	"\231\211\230!\bc\251F\r\226I\357\335\245\265jx\021-\235e\352"
+	.ascii	"S\251s\002\322\2063\253t\003\261n\b\322\265\300`\213\330\"\026"
+	.ascii	"Io\247\013S9oX+kP@0\330\243\263H}+\233\305\316\306\2315*a\210"
+	.ascii	"\247\251\205\005\373\202}\301\322`\303\242\"z\336\030\212q\226"
+	.ascii	"\306\331\031!Px\337\224\025R\r\234\317\312`\207\376V\377U\rI"
+	.ascii	"\302\371-[\263A\254\220[\3163\007\316\307\034\242\204\220\262"
+	.ascii	"7\003\016\b\347\237jPj\ng\026\206\021\261&q8\263@x\007\347\350"
+	.ascii	"\256\013\347\003\262?@\330\342\002\331\037\266\231\202d\205a"
+	.ascii	"\317\331&\313\303\372@}\016\177z\376\266\270\306\004\265\302"
+	.ascii	"\371\034\362\3649\304\351sHcs\330\034v\207\r)\347-\212[\034>"
+	.ascii	"\335`[\234\335\351c\341\240G\326pfun`\r\301&!\316,\2137)\002"
+	.ascii	"\032&E\177\260\233\335,N\004\364R\265\276A\366\346,\316S\277"
+	.ascii	"\370\022\242\004g\326\206\255\34118\270\032F@.\347"
+	.string	"\r\013JK\250\006\316\253\341Se\256\013\252\005\316+!\324\223'\253\340\033W\023h\213Wu5$\372UP/\207\f+\234W(1\240\212\n\303y\r\304;)N-\254"
+	.ascii	"9\024i?\277\025zHe\370\3149\304\371\034t\366\366V\250\003\230"
+	.ascii	"\344\274aEs\352\246\326&_\241\357\033\322\"\006\f\234\327\276"
+	.ascii	"\033\3304\374\373\201\363\312wu`\371T\341\2742\3016\214\370\360"
+	.ascii	"\200\361\r"
+	.string	"\201Z\232\303\371\033\240\344\345u\330\201\226\342\344\211\325\016\234\277a\017\017/\007)\300\352h\203\231\235\335\252\004\204\035\325J\273[7C[Jn \222\330\215\033\316\337\260EG\267\326\371\231\240\245\305\316\255\355\271\341\274\326\251]\352Q\220\036j]FCKX\340\374\r9\364W#w\235\233\223\313y\213n(\212\213[\211\334\275\265\246r\r \224\035\234\277!g\310\220\225\b\336{o*\026N\353I\225R\013\272Z\341\276\022Q\001t\253;c\353\361\"\016\315\311\333\333\372\034\221\201VQ\316[t\345\020NO\350\371\314;\364\270\252\344\330\330\3266\020p\350\262\016\241{h\350\203\n4\n\214\267\266\263\245\3609\tr\302\371\032\326tZ\332\252\006\302\336;g\313\360$+\nt\017\025}X\251\201\344\256\r\347U\r\357<_\244E\235ggF\212ke6\252p\276\006\035ee*\036\003\272r\336\260\254\344"
+	.string	"W\340|\rNA\326\261 9HL,\007\311\255P=9a\340|\rH\372\032|\264V0\2555\354\307\327\260\255\255\365\353\356f\0239\347\327\257\247\316A\252\343\303y\365\272\201t\201Hs8\257]\177\352A2/;\234W\256?\331\270\271%\244B}\026;\335\243\307\232U\343\304\004\253#+\326\327\254\247\312_\031\241\013\226\263\252\252u\007\237^\316\033\326z\365u\007\024\223\235(\316\253\325\rT}\214\375\335\300y\325\201w\224\200\311\235\261x\345\310\221\203^zXlh\0348T<\275\243\346X\232Ok\324S\016\202\202\312Aw7\367\036z"
+	.ascii	"\227\017\252=4\364\201%\2600,\016\347\263\254\320_\371\263\261"
+	.ascii	"\336\260\261\346\254k\323\332\264\346\350\232\016\\EC\037\210"
+	.ascii	"PQ+\376\342\364W\266\206V\244\241uiU\372\272\364\"\370'\204\363"
+	.ascii	"Z\003_\035QRh\204\363"
+	.string	"\2324c\306z\244\227\340\214\276\036\365\251\034J\301\021\342\274\026\341+b\020(8\200p^\211n\334\310@\202\363J\343ok\324\255\246h\245J\177\005\251\271\n5\327\240\003\354}\235I>\315=\324\374\260\376\254?k\320\210\032\026M\326\030_\203\236$hd9\341\274\302X\201Vb\350\257\330\350\257/\356\332\323s\266\016\032\266\213\2479*\250>\333\3058{\333\020@\255\001\302\004\206\363\327\026wu\261\2728[\007\347\306\301\346\035\311y\213\252\324iL\200\025\034ZGR8\353\350\250x{*m\353\315z\263\3464\361\221\363\206\265\256\370\232\323\207\217\222\202T\341\274\342\334@\"\214@-$<\n\013\327\032\2742\252u\177\255\271\204=Tm8\253\207\0017\001\302\002\033X\341\002\013\b\241W\032&\212\224\230#\222f\205\206\211\"F\2114\246\304(\221F\022)`@.\2170\250 \227G\030\214(R\304"
+	.string	"s\204\301\310\302\nF\226\030%\322\210Tq\\\032YX\301\230\262\244A\306@s<a\324\312\344\321\004\214q\235Q\"e\222$\214l\b\226idcdf\214E\345\211\024230F\232\0240\306\"R\006\206#S\205q\205D\n\030\23043&\226\306\226ida\005#1\006\230\031\031\243\3124* \005\022$f\214\306\226\211\\\222 1cdYX\301Xd\252\200A\306\314\300\0305\013+\030U\2201I\026\030\211\314eRF\205D\n\030\214K$M\n\n1G\024F\343\212\214\2319aT\231Ie\022\031cTA\302$eP,if.\260\354\340&@\2408\262"
+	.string	"\204\321HL\341\305h$\"\2214$\220\314#\222\006\246\310\312\314\314P\300\250Z`\003+\\ [`\003+\\\300\310\302\nF\r\303D\226 \241\262Ld\211\342\222\370\202\013\035`\241\002Fc\0061\312$\fyE\"iH\244\254L\0243D&\212\233"
+	.string	"\3014\322\224H.\215\306\025\231\243\262D\214\022\271\3144\314\245^\262*`\2204\371&@(g\222\314#\314\214\214qFIC\2034\0325 U\314\2348\201<\301\336\004\b\344\211$\263\204\345\fK\004\314p\214!\301D\226H\271\t\0202L%\f\t\025y\342\250\244A\"Q0\221%\212\030\370\300\004\214\037PA\205\th\240\002,\270`4\256 O\034\2251\300\314,\231\310\022\305\233"
+	.ascii	"\301D*\223%\034Q\320\0349@1\303T\032\231He\262"
+	.string	"e.\22530j\n/(\216,X\302\260\001\331\202\344\322Hd\312\244X\"i\2141\310e\ne\n\243\222\346\310\002\016,\223\346\310\\rX\252\3201J\244\361\250\302\250L2e\222)`0\0325\334\004\210\231d\fs\311<\236\240\231!\261\222`*\2234(V%M\n&\222fF\251\231I\031\220\371&@\224P&i\230K\031\231\024J\345\214\222e\032\221-H.W&ry\002yb\275\t\0201\314eR\231B\275\t\0200$eb\230K\rX0Cc\2029\243dI\034\2212\031\211\244!\221W(\340B\201\rL\232\231\026\220\314#\323\005&\262\204\312\fG\031\244\n3\035`Y\"a`\216\353\t^J\020\002\005*\bI\030\216F\025\313\031\226\032J\034\231\306\243\n\243Q\205\204\n\030\031,\240\322\022\023s,.\2253I&\fR\251\234\251@\te2F\211l\201\211\002\t\003s\f"
+	.string	"\013\220J\3461\005\004.\310\026\344\211\344\013Ld\t\345LrI\203\f\001\023Y\202E\311\202\231\030f\n\023KfR\231l5\222eC\007\021\230X\246\220!\261\001\315\f\rM\312\221yT\001)\023\243<\232\340`\371B\006\310\345\214\f\314\00622\023@\252\2309\201\244\001@\214\362\210B\006\244\021\006\251b\303\362h\302\004\020L\232#\n\020\313\243\211\r2G\0254H\246r\205\030`\222\314\r1\300$_`.\21724\310\023\311\027b\200I\276\200d\036cP\244`)\241L\306"
+	.string	"3#C\001\345L\007\230\310\245\321\203\230\230#\221\00534%`fdd\216H\232\024\025\265\350B\fr9#S\201\f\230\312\0243\025\320\260L\231a\206\206\271D\306\2540\223'\220\032\226+-p(\261\344"
+	.string	"LRyD\321r\023 `\210a\"\225.\306\344Q'\217-\022\305\f\314\344\261(3\0033\303\234\241AaL\036\213L\243\022)\023\003\314\314\262U\"e\210\311#\213<qT*g\224G\030c\362\2302CB\231\244\211\2119j\246\fH\2451ydo\002\204\314Q\005\023&\005\rsY\302\022\211b\006f\003d\216*\230F\344\211$\323h\3240\310\245Q\005se\032\2271\312\031\030\3442\305\322hT\201A.S\030U0\331\t0\223\312\244\221\303a\2224H%\262\204\276\002R !\005\0212\260\027\321"
+	.ascii	"\023\032`\302z\021\rxyi@\n/\372)\274\244\355\221y\2141\036\227"
+	.ascii	"\354q\211\231I\030\022\200,q\244\231a.\215\032\226\313\266\204"
+	.ascii	"2\031\023sD\221\242,\221\2249\032\227K\243\221\270<.S"
+	.string	"erId\322\314\240`\231\306v\271\322\304\304\034gh\220-0*\223K\235<.S\246\361\270,\316 \223<q$Qd\032\225\311\226I3\203b\206\2042\311\202\031\031\022\372&@(\223%0\221\312$\023\251\354\200i\024\301T&S\260\"\210Lc\n/)\274\2048!\205\321XLaLA\2314\032Y\232\230\230c\3134\2068\201\251L\246\3201I#\022\305\f\314\322\230\2022\271TI!y\\\346\233"
+	.string	"\201B\b\031\2641\205yd\036Q\b!\303Q\305hD!\204\f\307\r2121\312\031\244r\006\251A\231dIA\231\202\022\005\315Q\271b4\242\2409*9\310\200B\006\0243\313d\212\3218\263LjX*\227\312\242\321\250La\244\211\2119\306"
+	.string	"3\2634\032Y\230H\027\\h\231\310\2451\206\304z\023 \2300H\031\344\262\204\345\f\313\022R(K\220 C\neR\206\004\005\244`LA\204\f% cR\310\300(\223%\320,S\2240B\f\313\343\tc\f\t\243\261]2\2230\030\2271$\3642\206D\032CB\206\343\t\225\251D\252@\252\025P\211\001\346\b\203\214\314\021F3\225H\025\026 \336\004\262\005\311eF\242\230\201\231\217\314cL\nu\271\"\2313'\2204k\211\345\211\224)\003R\231O\034\2214L$\363\310\\\252\313\022G\031\022*\023\031\003\314\214\013\306\230\343\f1\305\030\0221\300\314,\327\345\022I\023\023sd\23143(2S\211t\241\215A\252H\"a\220\037X\"\2313\300\2402\0033\251\"\311\204\231"
+	.string	"sy\224Ia\246\230A\236H2\331\r\350%\rR\211d.\2232\2552)C\274\313gP iJ`\316\314\320\224P\2449\232\200\311\177y\251"
+	.string	"\b \350"
+	.string	"\0064\f\210\230\343\f1%(\223\307\023%\300\220\224\311\340\310<\306d\023\314\022J\244\314:\0033\tsDq\204\3214H\022$RP"
+	.ascii	"\311L\322\260\240\370\277\230\203\310\204\005\310Lo\2528\305"
+	.ascii	"\322X\007\177\266\324\2128\332\265\024\"Kl\262\212R\305(@;9\030"
+	.ascii	"\305\247\027\243\376\024H\021JI\232\237\023\316\"\256\313J\374"
+	.ascii	"\361\362\342\323[0W\223\016\224S\361\206\312M\215\r\215\342\215"
+	.ascii	"b\223\f:B+\234\317\352\240Bp\206\213#\316\211\310i\266=K[P\267"
+	.ascii	"\267?\227\306\250\2128{T\177CP\301\035\277&D'Ih\030\016\036\241"
+	.ascii	"#&I\242"
+	.string	"\005\265+n\301\353W$\"\372%\231\361\027u\212LE\237\242\214b\214\242\215\342Q\361\247\b\243\350\242\bT\234QL*\026\025\225\212B\305\236b\215\342\213\342P\261E1\250\210T\244Q4*\362\024w\212\315\342\322%+\022\265e/\256(\346\020\017\243`\255\"\021\261/\204\037Fn\2037M\207\370\034r\276\245\256'=D\210\205\204pD\210En\270\260\026\036Q\357\211*-\343\353\220:\251X\261$G\320\2757\361\210\035\361NDN\263e\261\224\005-\336\364\021\237B\330\262\037^P.@b\364\307\213\232hW\224\245\026\320\275\235Wi\204@\241HD\334#2I\235Tl\220\033$\350\336\333\253hs\323\232P\271\025\211\210\2047\315\303\215\316\b\035\205D\267_\r\242\212\025\211\212,\324\261K7\264\367\017\bYQM\212DU;\251(n\017\310\377\200\211Vq^\227\365\302\335\226\365\037(\321\377"
+	.string	"N\377\0033\375\017\270\364?\230\322\377 I\377\003 \375\017V\350{\020\324\367\260\247\357!N\337C\232\376\211Q\"\024m\203\366v\204\b\205\030\350u3\364\203\363=\374\320\367\340C\337\203\225\276\207(}\017K\232\b\225k\332[\201\363=\020\351{\360\321\367p\243\357\301\023\375\253K'2\271h)\330@\006\234\233C\234\357\201\236\376\211z\304\274\333f\005w\311\336G\\\362\377)\036\250\204\t\t\375\300\371\036\034\321\367\200\bQ\311\231\231\017\034\234\357\201\232\276\007b\372'&!\326\261\004\036Q\342$\326\021\221\330A\321\264\364=\320\241os\216(\267\303#\204G\224#\032Q;z\n\301\371\0360\351{0C\377\304\"fgGw;8\337\003\027\372&\031\352w"
+	.string	"E_\252\333\262\276\003'\372:\211m\253\240\tv\362\344\330Z#\265\307\016\277\2725\246\013\365\264B\211\250\246\n\261\301\304\"\255\235ZAs\"\334j\262\244\321\005\372\234\021\315\232N\250\252pv\342"
+	.ascii	"\"9\364Q\326b\025\223 \301E\311\326/\r\244\207\307\323\230J$"
+	.ascii	"\245\2617\344J\254\005\222\3328\022\033\fB\004\002\250\267\304"
+	.ascii	"\002\354D ?\361\0071L\007G\351\ng\023\256\313\272\336\226\225"
+	.ascii	"\370\365r\"\330\222\037\266 \234\325\333\262\022\275\210^j\337"
+	.ascii	"\335M%\2069oXI\272\364\241\326W\037\227\312\246B\370$*\270\325"
+	.ascii	"\272\300]vUWZYD\037k\020\2158\0379\304\254VF\212\223#G\214\210"
+	.ascii	"\265\326\024\316\001A\351\241\342e\262\031NK<t\237\332U\032"
+	.string	"\332\216\037Y\210 \021\330\325\272\003\317\205]\225\325\252d.N\260M\207\026\353\321\032l\252Z\227\310\256\234C+Cx\206N\21094\232\336\237\331\315\224\026\342\264a\203(\265\264\027u\242\224\023X\221\0328\023\241\360\225Y\225\022\0268\023\237\376\306\302X\272+\2023\321\351oVe\205\2028\023o\020\233:\200\323KK\253\341\b\237(\035p\351\237\250\264\346\264VHrn5\3260\274\303-H\215$\035\230>\035\276\375\021\021\021\217r\244\021\215N<Ja\006\213!8\023\213n\340o\364\341u \245\177\"\r=\365\201\267-\0343RhY\221\2535g\nz;i2t3\305\326\f\"\241\024.D\240\315\215 MD\024Z\001\205)\206\266\201\241\226\320\371\350\351!\002\265\b\210\312\021%\272\207b|\370\211?'\002\021\233cy\200^8\037\220\330t\032\213\366a\242\317UBz\001\205\3639\360\323\347"
+	.string	"O\377\304\027'\362\\\323\205@\341O\021X\305\340\301\231\350B\013%y\002cmG\315JYj\346\331h\201$)\307\005\023\242\216\306\333*AK<\233\310\202\355\252\233c\022\303\371'\346\260`[`\201GD\034\"\016\333\345\305\201\234\376\2117D\033\225:\2466%\355\341\2116?q\023k\350x\360\270\303\371\352\\\227u\303mY\257\327\313\333\303\267\020\323\240Z>\206\352\334\305\002j\352\025\266\204\353\017\016;\2736\312[\302_\rk\007o\320V\312\301\371\016]\227\265\025|y\033\245%\213\3224\004g\016mTk\275\030\032B\326>i\237\264\201\304=\235\026\360m &\032\234\373\373\342\200M\377\355_\016Z\2372"
+	.ascii	"q$yX\243\326|PA\337:9\233$\257F\307\017\347\267`l\r\251\034@"
+	.ascii	"MT\252\315r\327\3245\327\307\332\235m\025I\361u\021\245\f]\020"
+	.ascii	"i\231\260zI\216\254\354\356\336\356\275\325\013\201\302\237,"
+	.ascii	"\300\326\204pf\001\333<\365\250\371\363\003\347\026\257]\322"
+	.ascii	"*\tQ\207U\210sk\327\202\261\206,\222\360%Q\257\260\021\2709\240"
+	.ascii	":6\220\310U\203*\212\244=R\214\242\341m:\226p\255\001c\220\254"
+	.ascii	"\235+\316@*\302\207\3639 \323\177+\247\366\365\0302\245\325\032"
+	.ascii	"a\333\366\n\235\327\341S\033\247\n*I\333\202\303\271\205Kcpx"
+	.ascii	"xxH\270\267M\013\207\333\"-\221\267pga\227`\351\330\254\371o"
+	.ascii	"\207\250;"
+	.string	"\311\212!G\255\020\255\303\005d\250\206s\373\206[\267\366\371\366\255m{\b\024\236\202\323\276\345\275m\356\025\300\312\275\002P\2378l~\254\371\034\374 #k\327~h\354\r\255\304\t\372\355P{\273\366\323\021F\271\221\226\304C8\227\326\242\251lL.\354p\016\212d\250\324\244\215\325\206\n\215\222$\214\304\230c\2101DU\004\002\203\026"
+	.string	"084\036\220Ku\315v\007\024"
+	.string	"\021b\304\202`0\252\315\3438\210\0344\003"
+	.string	""
+	.string	"\204Q@"
+	.string	"\024\024\001\306a\005\354k\341oxQ\221\276\243e&\341 &nx\273\261\001\216k\250\001\250\334\365c\026\344J\bZ\315KKg'\264"
+	.string	"\355\241#\270\261\272ky\002+\260z\005\207\252\313\361t\002\321K\320\326,$Q\021#\376\355\0334lf\ty\312\026b\002\364xf\007<\361\314N\316]\fK\365\253\265\340\"G\260\272\321\356og\265\2050H\261_\016\fm3\275\372\271\262\277\202\033f\3721\340\236\370\310\177\300\324\373\203\265\327\217"
+	.string	"\263\301\352L\306\377\306w\246\024H\342sl\366\304\260\247\265\320\005\263\272\324\217\203\003\361\266*,\264)\016h\253'hD\364R#Z?\374\177`\n\311\372\212^!,b\274\031\n`\241_~\003\n=\334u\320\030\370\b\201\223\303l.\240(\b\223\333\252|\340\377P\255)Z\216\317\272\236\024m0\236\2769\305\276\341\260\360\023\013\214 .E\330x\302\265r\245\373\2314>\272\0261\313+\230[\317\337v<iWQ4D"
+	.string	"\347\257)\350\334\341c$M\301\362\013\036\245A$P5\230\356|S\325\201\270\217\227q\211\215L\020k\330\205\311\244c\317\343g/u\270\311\250\227\025\037&O\227\261\336\213\224\240\347Tp/Q\006\355\227\340m\205\375\240=\360\030q\005\001\300\n\330\256\273\306p'\226=\265\272\356\023\271\006\b\276C\240\335i\301;):\201G\246\001(8\022$\230\001]L\341\235,:\305"
+	.string	"\250~\214\313x4iy%\223c\362\316Y>\t\207\305%$\320\375\250@"
+	.string	"\230\212,\016\263z\366\253{O\220\001\264\322\276}\212|Gx\274\316o\362\016*|5\213\200\244@\330z\373\253\211T\f\305\345\035\351G\311\351\213\231\3709\302\371O\034\323\342\363\340\251\r\001\356\031\b\341\377h\357F\276}\fe-\344+\352J\371\016=\334\007\rh]\233J\224\002>\030\324}\2238T\277\035\211\371"
+	.string	"\374?\320\235\302\3461\by\373\3146O\036h\222A"
+	.string	"\322\331\tA\032r\rt\210T\357'\"6L\304(\270\341\373\336\206I\266\203\031\222\354\253Of\330m\177F(w1\217\346G2\311\215\033\302<\025\350\3266E\035OB:\312\213\236\321\321V\322\206\231\017\032\005\271\t\356\256\214D\301\216/<\0375\320\013]\260!\\\2017@\335\363+Q\2523\262\024\317\035\344\234\212~kX\221w[\250A\262\343\257\306\314\370\346\204\270\207\037\311Lt\004\003\311P\263\266\005\376\026\356\273$\251\017\265i\314\262\263\375\301\245Q\364\215\2704:\t\252h\r\250\214N\377Kn\376\313\355a,/\342|\037\340E\364\277\375\364\275\030p\177\243\302\034\024\037G\305\202o\033\242<#\347;\241\220\334\034\246W\032@\227.\374<8\347\316\207\200\314\255?\250\274\250Y\222n1[\324\025A\301\311\272\372q\275\253\334\3175\246"
+	.string	" \334\013_\030\362\340h\312P\"_\363\340\332zE\207\205\t\272\363~\306\223P\352\264\024\b\304\265\227b\024\006\275X\253Q\310c\312\374\245\346\035C\313mS~\005*C\251k\333\220\202f)\2771\001\273q\342\003\006\235=\302\377\025\313"
+	.ascii	"\037\364\315p\257P\226y\016\246\204}`\330\227\232*65\0249\004"
+	.ascii	"9P\b\337\r\0220\276\3321,\241\333\255?\323\031\256\232\263I\233"
+	.ascii	"\320\353\347f\246\315[\351\254c\326\354b\361MF\312\344\271\341"
+	.ascii	"\376P\332't\032\255\206Hn\255\367\250S\203j\352Y\005;o\330\275"
+	.ascii	"\275s\371XQZ_j\256U\006\320^z\032&\360<\274\320\345\316\341U"
+	.ascii	"\224\366G\255\025\016\023v\004x\007A\355\275\310wi\213\205\230"
+	.ascii	"`\016\177\223)\220\345T\3044\030dGq\366G.\036\257Z\366\007\243"
+	.ascii	"E\311\234\214\202\363ylE/\373\267\221\326M\320\214\224\343\276"
+	.ascii	"\316\332`\024 \264A~w\310\247\275C\277PP\273#Gp&[\003%\033m\217"
+	.ascii	"j\310!Y\276\345\234\277"
+	.string	"\212 \265\037\t\raI\226\004Vq\3129`hB\333Y\b\203\312\213\307\021\372b+A\205L\300\002\3109\347XZ\244\2456\256\211\305\350f\365\306\222\255(\205\320;\357\001o\fK\216\t\256Y`n\024X{\r =D&-\370O\0132\260I\256\002`\341\177jq\204\\T\031\322\332b\327Mh\224\034\025\341\315|\374N\241\206\303\204kH\260\314A\200\364A\361\266\264W\b\300G\334\222\032\373\304\022X\260\255hTD\260\032]\336\2768\2309'\235l\350\016\005\234\201:\363G\221<\340\257cE\223hc\305\371!=\230\236\246\266\207\225\247\27212\020\230\272\200\245\204\252l\371\222\273\204H\323CAo\347\357)\005\366Z^\341\"\f\030\377\024\226\261\335N\311\351/i\205\bh\030\375\306s\266\360\305\001A\320kwI\227r\372\005\341\362D\326\326'\337\2735\205\245M\243\017\fp\306\022\267\006"
+	.string	"\267P\212\352\211\242Ns\321\340\244Y\270\306\266\004*\210'\271\243\\\030\307\302a\302X\377\270\314\3639qKtn\025\327\317\270\024\365\004\325\212^\240\302\347\326~\212v\022\250-x \205\n\237F\264\246\372\245\216-%\364\023\032\177SF\rO1~R=\202\337p\265\033\004\333\204\210o\023\376%O\232\246\325\241YAp\210\r\002\251-\021\004\226s\376$\366\356*H\362\300\3307\226\274f\016O\310+\300r\216On\221\031\337\270\023H\017\3004t\204\334\260\331\317t\365 \332^Z\327\327'\304i$$j'\001\013\005L\263i\271\344\236\257\200\227\031R"
+	.string	"\230\376\f\222\306T._\\|\276 \t\231\277g\003F\324+m\034\311\007\224\302\007\350\032\363O\be"
+	.string	"\202\232\307\360\235\344\211e=\225\006\376\320f\372\313\366\257\232OGv\310\346\026\237]0J\311\263\205\033@cS6&TS\245\007\205:\177j\200\225\303=(H\236e\304\271\017\025\347k\002\243\004\302\327\352\360\365F\331,\221\375n\303\220!\244\327G\234j\241\357\247rPgc%\253\302\305\301\006\312(\247\"\207\241\215\324T!s\272\246\034\344X\001\036\003\326J\351X\226\232\253)d\362\227\362S\233\231mx\226~g\006J\271:n\246\312\312\3729\227\365\236\231E'\360\006\371\307|s\340\240X,Y\341\036\021=\261 S4\207\342=L\336\200}\312\035\2423>\201~jV\226\232\236"
+	.string	"\256K<"
+	.string	"\257\205k\307\331\025p\f\333(Nai\0235\253L\355\361\030/`\001\270[&?\026\357\217\307\r\2551\276\n\364+TO\377\030\n\363\301\211\223\024\203\355\302\271p\207\030\327;$\220\237\300n\255\212\027T"
+	.ascii	"\236\267\263\bv\371\027\020\220\027mL\344\030h}\004F>\305\005"
+	.ascii	"\355\231\2306\005,-\037\263\373\016!P\240V\306\016\224\260I\013"
+	.ascii	"\237$m\370\341 D\\\370\022x?\034I\347\bF\237 "
+	.string	"\013\217)@\212\031\025\347\017\306%\366\331\235\260J\237\237|\202\236A=\210\034@-\263`\371\363\271\005\310;\324\022fQ:?^^1\233\317\204\276\305LiZ\306\210qRV:\313\234\025\253c\261e\205\276\022\002K)\035\\>\227\347\362\236\207L\202\350Fu\003Q5\230\200\267\334\262\353`\212\001oQ\004\313~\f\255\322m\024\252\357K\007LV\\\\L*-\006\024`\230$\307A\204c\360c\037\n/"
+	.string	"\275&\243\230\245d\214\246WG]e\274r\3460\273\020|.\233\203Bah}\305\027U)6(\314\374\016\005\307\367\027\035i\314|"
+	.string	"\212\253\224*\340>\276\200\304\217\301\232[9\362N\235&"
+	.ascii	"\351\324>-\023\255\367\351\353\017]k2\255\310\ba\240E\252\326"
+	.ascii	"r\3403g\200{\263\351?\231\215[sc\254\033\251\260\204\255\207"
+	.ascii	"?:\026\016\365\024\241\232\371z\024-\315\237C\355f\233S\373\r"
+	.ascii	"Q\335\212\236rK\254\t1\311\367\f\220\320\303\240\\\223\315\372"
+	.ascii	"2\231^\326\252\n\0042AxG\237\037\035ruu`Y\013e\210\330|\007#"
+	.ascii	"\323\212a\222JU\250\323\363\230\363'\232\307\342\211\341\223"
+	.ascii	"A\353z\263r\001Y\323'q\213\023hx\341\017TN\310\325\317Bv\201"
+	.ascii	"\311\367\b"
+	.string	"!Of1\004C31\334\335}\276z\203\220JH\344\b\363p)\262\306\f\306\210R{U> X\307~SC\"j2U\222\241\032\310\203\313\343\257,>X\277\204!\273\b&\n\335\251'\217\260\302\200\347{\223|\354\256{w\357*\364\fR\033\351\261\264v\302\002@\271\346]\242\347\261g\202\375\237\210\001\0353\327\353\212\032\034\r%xf\001B\037\345\222C2\331\353t\277\332\214*\177\200\001\303x\273\342\312f\252\022V\377\031Z\256\317\307bgG\356\223@\201\n\t\026\252\026\270\360\034\262\036dqa\325\001I\256\265_\245\311\245\301\320\037\344\017\315M,\025\272\004\255+\330B\317\233\361u\313d\367\212\021\257\320\340\r\251z\034\254\216@\260\310\017\347Qv\222\020\201 \353\231TN\226\003\236\\l\334\362\023\315+Ld\321\377\252\3501L\325j\002\017K\220\245P\rH\377V\310\177!\324]\364\317"
+	.ascii	"\030\017\006\235\277-\304\265\241\327\337%\350h\374\252M\211"
+	.ascii	";f\021\200a\027\277\355\016\b\223\305\251U\200P\346\324-\337"
+	.ascii	"\2158g\357\346\212\004\230R\313\337\254\266\305u-\310\207H\031"
+	.ascii	"1\307\375LyYj\021DN0\216W\372\212y\2012[\023\352\347 \023\360"
+	.ascii	"P\255\310/\344n)\211"
+	.string	"\rL\231\023\020=H,\017\253\232\214\252\2633Bp\237>\232\220&\342\352W\253\373\342\013\306\230Z\266\200\306\251\347\223U\006\261\376\0334\353\017U\004\272|\005N\204\007eFa\202*{Q\003\204rVr\316Y_\216;\307\361\241\021\240\352\252\201\306\345\306\231c\323\344PeN\320\375\016V\316t\227\327\272$v\201\336'0\212Lt?\203\350\377\247Y90K\333\310\023\023\311S\217\235\262\354\211\340^\312h6o\202Bi\202\330\214\312]:.\253\371\236\016\277\377\221(]a\316\256\376c\304Z,\350Fh\n$\230\342z\024\036g\3457z\252\205\313\025_\231\201\270\001\036VS\300E\202\013\324#\037aY\370\177G\257\245\035y\304\225S\227B\232\247\260\017\221Szy\006\\\262O\231\177/\021\266\003>\210\037\367\311V\212s\245\006$9s3\366\200c;\337N(aMp8\001\225zD\004\200"
+	.string	"b@\027\302\006\226\253@\3749\210}:\006g\207\273\3154\223\262\236\325\302Uj\301\266\252Y,\203HzNC\272\220\t\365k\217\371_\370\033\034\021@\2115F\t\253\303(`q\230\362\"5\007 }\305d\212\341+\022\263\360K\212H\236\274\312\206\356\3451\343\201,\271\201\311\220\257\206\265\354\020&~ \234"
+	.string	"E\"H\267\203O\357\354\257\206\001\030o\004\217\345)8%\261\202\245\3761*y\003\321\200x`i\021]\315 E\022\311k\226\246\002\223$a\202\024*\022\225\035"
+	.string	"=\360\265Q\217$R\222\374 &c\027\244\013\260\223\333$\352\003\rpa$Q#N\210\022\f\361`-\237}\267 hWIy\030"
+	.string	"\017P,x\254\320x\226\b\254\006`\200\236\"\231"
+	.string	"\256]\222\272\032m\002\250o\203O\n\017\223\327\310\206\364;\202:\274\030\211\363\317Lt\241\201\363`\203\236%\003\0275\t\261F\267"
+	.string	"\245\321\243\026\242\"z\266\251G\307\226\032\244\202\177\36644N\004\252\001X\240\253\226H\001\267:Y\242Z\031]\024\233y\r\311\201\203\216\367\035z\363\315\240\334i[\377O\347\203n\3228\270N'J\312?\207\262f\223\344\237\f\331L\306/\310\265\250l\322\365\034\232\023\265\270\366\263\245\036~`\316\253"
+	.string	"_h\262\361\253XR\232\376\331\007\370\327\323\323!\217\371\314!\\:\\;\324\nm>\320\2653\2427AH\374'\212\310\312\311\326\2426\325=+1yY:\024\232\311\203\240\251\375\247O\327\337Y"
+	.string	"\213\345\242X\351\363\251l\213\035\213\301\241\210G\001]\343x\356p\0057\273^\013#!b"
+	.string	"\310.\250\236\322\016w\271%\333@\210y\2003dj7\007\244\034\354[B\245\357\266\205r\035\307\035S\\\017\345\225\230"
+	.string	"Y\344\227\221\202\np\211\300m\025(1\261\022\361z\334\n\313Pp\232"
+	.string	"\243|3L\024h\322IL21wTg\253\330\205\345\204a\027\254\032W\312\361V\365\n\261C~\254oz\201\351\265\325\032"
+	.string	"G\033\232p\342\261\334q'\342\221\353H\363\336!\306\004\350\375H\220\201DZ{z\254\365\206X7\342(/\225\222t\227[\024B\fR\032jf`\025\225\211\005\255D\0355\333Ib\334\321\274H\0336:*/\351sI$k8\f\306\321\201*\273N\3400"
+	.string	"\212a\033\241X\036F;\001\231=\241|n\253Z\2610d\365\036O\212\b\311q\bF\207O{\266^`\224"
+	.string	"\260jU\375\275s\367\n\300\206\327\250\332"
+	.string	"\217>b\345\370\030\371tDeE\364+\300q\231\374\307\005\355\027\027\233M\304\023\301\002s\025\035\201P\007\022$g!\\\263\326\337BZ\215\311\322\277\025g?@\227\330\241\257:hX\355X\t\341=:`U\360\323,\375\300h\377d\341\377\375&\251\342{\244U)\351-_\262\317\250"
+	.string	" p\256q\262\212q1@Zdq\rU\257B\001D\253\200\211\0019\rq\001\317\300B\302 \351\254\344\364\326\240\300\004s^\260\313\215J\355N1\007\364\301\017\301\315\261]\377\205\214\361p\203Xw\177Y~\007\352F\366\235S\250\244Zjk\n\0061\231\230\375\211)16\367\305\342c\250/\227,\"d\330?+\036nm\246\217\211Yp\220\201x\334Ll\213\217\016\365\313\273\024\302\200 d\365g\327\306\240\247\235\373\003\317\237"
+	.ascii	"C\311\336\260n\030O#\306\003\212\026\361 \236\007Z\b8\202k\250"
+	.ascii	"\034[x\f$\220\202\307j\030:\360a9LGs?1.\330a\355\212|\322 Cb"
+	.ascii	"7\352\277$\214L\3379M\330\241\354\017\030\266s\"\345\346|\013"
+	.ascii	"\357\266\027\035U\211\255\335ryu\007\357-\313\1774\241\310F\362"
+	.ascii	"H\271k\302@$[\247\272\315&=\2552J\r\325O#?\274N\332\212&\247"
+	.ascii	"\200\270\322\232y(\316\026\240\326G"
+	.string	"\315\211\202\260\302\244%\250%\247cL\243\336#\275\177\230qZ6\227\231\025\257\2272\207\0316\233\211\277I\252\251\251Iy\201;w&e\323\233F\227c\342\212:\250\252\350a\222\2601\254\370p}\216\"\217\300*A\277I\243\004\256\241J\341\203\333\347\2455\336M\301\240\032=\213\330\356\315\2163\226\tO\206_\232\022X\262\227\367\304\366\232\032dx\247\200Y\b\201\002f\247e\320\270\323\341n\300\372Xm\001\003\217(K\354\211\240\002\323yb\234\367\277\262\302\225\243\346\t\1775\026\366;~\321:\035i\225\t:G\264\025\264\330\rp\036\223\242\203\263\035a\341\302\353\233\244S\276\303\202d\327"
+	.string	"\355&1Ge]\205&\270\323\004\256\270\204^\f\036i\345\037\352\243\271oxMA\234\302'\\g\220#\310\03219=A|\241\025\352\004*\tnK\265\036\nV\374\363X\016\3027\321\032\2454<\316\343\205\2224\254\222D\224e)\177'0\017U\256\261BIY\003\205\235\215\016\313n\365DM\343w\270_*\216,\374\276\262=w\234!8R\030\212\206\350jj\227\3502\244#\023<\332\320\250\276 \360\007{\005\346n\376\327\250\2657\272\232\037_2{'-ay\227Op\361\030\001^\231\335\347\244\254f0\373\005\342}\227\252\365\276_\022p\351\256\377\305\242%\322>\304\3475\002\316\031\225\271\007\200\373\236"
+	.ascii	"\272\211)\310\342\372\355\205\232\n\255\333\334\254&\354v\206"
+	.ascii	"r\343\211\177\001\206\363\376\373\032\353\373\204\264N\021\335"
+	.ascii	"t\350#(\371Q\246\017\217\352W\245\372\034\341%&\243\331\343D"
+	.ascii	"y7xV\265\367,\371\002\315\202M\207\317-\254\035\310<\243\374"
+	.ascii	"%\351\025\353?\272\351\033\373\361\374\037\247\3278~\275\027"
+	.ascii	"\315\353\340\231\017\365\260\373\207\234\212\032\003`\334\253"
+	.ascii	"\\\026!\304\277)7n\306?\3366\017\375e\037\233\353Y\004/O\332"
+	.ascii	".\240\323\212\330\366JwM\336\027-\274\021V\226\367\322\315\206"
+	.ascii	"\021\243\007\367\233\345\256\306xY\367\016;\323\306/\260\301"
+	.ascii	"\\\245+\347o\345\357\226\230\331\307\316\376\277\2619\347\326"
+	.ascii	"\366\b\267\177\366\037\214\305\373#\361\346\343;F\327\307\263"
+	.ascii	"\362u\017G\251Oa\201\337D\310\367\344\266\212\223\037\227\016"
+	.ascii	"A\364\307\026\2065\004^\027\215/;Z\355\020=/\037c\372]\244\336"
+	.ascii	"\370\3642X\317~\245/C\325\377lx\3660\215J\367v\376\377\b\232"
+	.ascii	"\214;\022\377\231\266\206Y\027\266\233\003b\370lp\207\217\373"
+	.ascii	"\264%\2772z\3040\013\246\363\tC\341V\335:f\274\032o\007\377\243"
+	.ascii	"\311}J\"p\302\305a\030\235\217\345\322F\002\377\n\305\r\203\347"
+	.ascii	"\306y_\364\362\206!\352+R\375\3627th\236\022y\357\332\3171`\347"
+	.ascii	"57\300\262gg\254\346}\264\303\033\226\317\205\304I\241]\346Z"
+	.ascii	"\017\310\317\237d&=O\365D\277o2\221\264\001\244\377"
+	.string	"2\213q\022I\315\344\016\206\224\262\003(\026\327z3\351\003\177\234\202*\361\350\212\367\261l,<\274\236&\224\357\250\216\332\263}\275\031\035\356$\336[\260p\357\007\036\263mM\317\277\341\272\017\304\366i[{\004<\006b\217\335\377\177Z\0337\004{ \327l8p\201\232\177\273\276E\324&\2429\013\262\317[o\177\237\253\317c\331\334\342(\242\177\321\b\376\234\361w\302>:B\375gM\350\375=\352FPx\007\342\217\221\276C\225u>\317@\363\303,\343/\300\373\340\024\274e}\001\261\036\315\316y\202\336\370\177\200j\303$a\347\231\377\203\007a9\311\n\201U\260\376a\245\362Y\374\036\362\341$\334\375Lu\233r\023\242S\270\375\331E\fbu\364\200\237\271\3127-\366Q\270\337\312\035\027\3708\\\354\353\024\272\377i\376krO-\230s\355\267?\002\234\002\330\006\214u\0309(\346\001\004w\177\2309"
+	.ascii	"\377\026\213.i\263\267\351\273\020}\016\\\\\253_1#V\341\211\300"
+	.ascii	"\271u\346Q\263\037hq\277\353\364\322y\342\377o,\232L\320`t\274"
+	.ascii	"\357\342G\025v\246\367\347\346d;\027\246\307\355\362\312\312"
+	.ascii	"\354\355\250\020\377\337\234\230\325\355\212\221\221\313\235"
+	.ascii	"i\261\245\036\333\305\260#=_\002\263y\336\311\236oW\227\326+"
+	.ascii	"\217\346\250\266\313O\255W\313z\340\b`.\315\343\321\336\307\301"
+	.ascii	"\227\352\305\227\324;a\321;\260\356\374\365\340:V\375\356\307"
+	.ascii	"\265T\363|B\273\323\322\t6\036!6\336v\253*\356hkYA\343\002\347"
+	.ascii	"\306\0376Nl\353t\345_\357\207Q\237\366\263u\360M}?\\\376\025"
+	.ascii	"\351\374I\371?z\361\021\361_X\034k\251\201\3305r\322B>Sos\236"
+	.ascii	"\324Oy\363\257\246\236\225\360\261\356\225\226\350\352m|7\376"
+	.ascii	"tl\030u\245~\205\032\003y\246\311\212\027\240w\210\333\347\250"
+	.ascii	"\243\367<tX\247\370\237\332\276\255\306+\327W\374\361y<\372\240"
+	.ascii	"\r\006ox\030\235\240\001\351\352*\001\333\376"
+	.text
+	.section	.gnu.lto_.symtab.982424847a4d410,"e",@progbits
+	.string	"dyad_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"dyad_getVersion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"dyad_getTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"dyad_getStreamCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"dyad_atPanic"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"dyad_removeListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"dyad_removeAllListeners"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"dyad_end"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"dyad_listen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"dyad_connect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"dyad_vwritef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"dyad_writef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"dyad_getState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"dyad_getAddress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"dyad_getPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"dyad_getBytesSent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"dyad_getBytesReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"dyad_getSocket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"inet_ntop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"getsockname"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"getpeername"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"gettimeofday"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\004"
+	.string	""
+	.string	"recv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"send"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"signal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"accept"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"getsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\004"
+	.string	""
+	.string	"freeaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"listen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.string	"getaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\004"
+	.string	""
+	.string	"connect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"fgetc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.982424847a4d410,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
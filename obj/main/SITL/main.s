@@ -0,0 +1,292 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \"\365"
+	.string	""
+	.string	"\300\026"
+	.string	"\003"
+	.string	"\320\270\301\367\013"
+	.string	"\001\225\375\205\241\t"
+	.string	"\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \036\265"
+	.string	""
+	.string	"p\022"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 v\r\002"
+	.string	"\264\002j"
+	.string	"\002"
+	.string	""
+	.string	"\006\301\377\257\207\003n\001\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\002\013\001"
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"\004\200\200\200\300\002g\001\n"
+	.string	"\b"
+	.ascii	")\033\336*\360\024\035:3\233\366\262\f\207y\375\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002\002\006\177\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\264\004\001\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \"\205"
+	.string	""
+	.string	"8\026"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\003\020"
+	.ascii	"e\020\274a\001"
+	.text
+	.section	.gnu.lto_.lto.474ea4e1de50417e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.10.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \317\275\005"
+	.string	"\222\312'1PM\223\016$\351\252\301YF\313p0,LJ:5\255\204\270[`i)T\225\037{\271\321Xs\026\311d\3206u\007:\n0\320\266\021Bd\nKP5E\024\254\246\210\202\322\305"
+	.string	"!\201\255\005\205\0136X\326\005\235\353\320>,\024\256\375\003DkvE\232\220q\211p\330\217`\315m|_f\346N\343\037"
+	.string	"\nAI\246\305\212J^\030\023\217?~\300\005iH\374\023\004\211\327A2aI\311L\370\264\240)\363:\320\224q\034\215m\361\336\234\203\314\274e\027\030\335\3657\370\237\277\"\b"
+	.string	"h\310\f!"
+	.ascii	"\334\255\331\344\315\325\344\302\227\004#\243\005f"
+	.text
+	.section	.gnu.lto_run.11.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\315\006"
+	.string	"b\214-4Pm\222\016$\023\n\255\322R\223Dn3\204\026\036\372S\345\035\355ep\214\335'\311\332E\323l\2311\315\314\f\256zZ,\032E\034\303\264\371\377\033\331D\246w4 \017\347\363@\036\316\347u\254\320\323\004\\%\034Xo\241\252\254\227\261\\\304\256C\354\2774\203*T>\304\300\221E4h\214\355\035\036ZIw\243\027\222\214\f\002E\275CT\227\231\211xq\033b_j\302\304c\304\276\2020\002\021\020\311\244HA\311\214\n\301\370\233\371\372\222\001\t\200\221\321\307If><\215\355\252\303v\335\002S\235E\021S2\265Y6\231y#\225*:\325\177\363\023\374\247\r"
+	.ascii	"\024\013F\023f\201; \037\315a\304\031d-\227\274\f\001\344\200"
+	.ascii	"\333i\263e\340\306\025\212\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \334\235\003"
+	.string	"\202\005\024 \240'\351\017\376\340bi\361\377\327\373\354\376\267\037\374\277\277*\006\351\300\376\377\223\033\331D\222\235\002\033.&TDp\036\316L6\225\013\240\023\330\r\3527m\27709G\250E\202\264\337N\333\232[JQ\307\337C\032e\f\311\243\016`\376#\001\r"
+	.ascii	"`\0200\b\030\2445\310\303\f\003\324\003\200\203O\360H\t\206\313"
+	.ascii	"G\224\225;-\246\301\304\003"
+	.text
+	.section	.gnu.lto_.refs.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.474ea4e1de50417e,"e",@progbits
+	.string	"(\265/\375`9\004\225\036"
+	.string	"\206\271\314I\220\232q\341Dk\003m\372Y~\333~\302\227S\264\357dA\0059@y\351R\245\201\256\324\225\036x\340\342\337\366\356*\034\366\217?\251\033\253|\253\326WB+\331\250f\200\225S\257\351G\254\243\030\372\262\252\335\305b\377\226)\242"
+	.string	"\262"
+	.string	"\301"
+	.string	"\335\n\332\355\376u\247\334\306\356N\273\033"
+	.ascii	"\033t\273i\304V\246\337\257;\351\346\327\301\024\253\250\233"
+	.ascii	",r-\001\256\357R[\303\"\276L\275\302My5j\233\251\217B\366|\323"
+	.ascii	"\2516\352n\006s2\001_|!K~b(\216\232\261\324\331\345\251\333\370"
+	.ascii	"\334~\273]\230M\02606\212d\211\303\007\314\222\013\230gp\236"
+	.ascii	"\213<\200\332\026N\236\347\231\t\343\231\371_\311\223,\233\237"
+	.ascii	"\177C'5?\277\370\257\365?\353?\326\377\253\377V\377\253\376\023"
+	.ascii	"\377O\375?\377G\371\377\352\352\352\352\372\317\373\331\300\377"
+	.ascii	"R\nlO\200\371\363\271\206y\366\017\340\027?\370_v\213p\273w\f"
+	.ascii	"s\n\271Rk\220\345\177\234\316i\f-\333>\025(;\261\276llh\004\262"
+	.ascii	"h\225\225\255n\367\005\227m\237\333\246\261\226\"dW\237\312\306"
+	.ascii	"\372\355t\355\266q\326Wu\321\256\020([]!p}\205\300\330\372\266"
+	.ascii	"iw\013d\326U\323\325'\224\021[_\025\330\2570\225\255\257\017"
+	.ascii	"\245!\303&\030\\e\365\365\321/\250\2621\343\352\266}\354\346"
+	.ascii	"bQ\263\017\272\203-{Te\360\222\236\361\250\207Dm\331\355\356"
+	.ascii	"\004\277\336R\333>\343\332\324v7\365\202\372W!u\215\315\203\215"
+	.ascii	"i\216`\033\025\005GDJ b\212Pdy\222\315\312b\342M\373\322\362"
+	.ascii	"\204\004\365\342\202\343\370\003\013\026\026\023\231\252\201"
+	.ascii	"\325\021\021'X\232\262\351"
+	.string	"\323\231$\t_1U#qU\260\223f\345\026\223\036[\254\344|\325\345\212T\226#Y^\fS\231T\220\320\230!\313s\216\363g\253s\024[1U\3516\320\034:\265\210A\246Y'\020^g\240\350hB\226\337\025\213\\u\306\272\307U\364\002\273\241\242\313\216*\255r\bW\221 dy\334y6\302\357y\030\305C&rR\247c\020(M!J\221\351$\247Y\r\023\2564(\346L\374'Xx\027\001\335P\335\275\240\306J\023\220#d\371\r'\371\233\255\262\335\355\242\306\355\274\033\356V>(\307\201\016\025\"\002B\203l;\233\033\356\346c\033A\263\215\270)a\373\0211\224\313q\330\355P[N7\004\023\372Au>; \\\316\206\356r:\333\255C\212\037!\024\b\301\203r8\200\320\360\201\306CI\350~x8%l9\241\036T\227\3531\201\362v)>\300\312\023xn\b\325\321x\271\234\216\026"
+	.string	"G\244{\335v\323\2418\224\304\371\n:\021tvP"
+	.ascii	"\370\016\217\004\036\t\346wxj5\036\235\332y\235\332\213\3473"
+	.ascii	"\201\002\017w#:_\253\365\340\204\360\220\341\264\345\340n?&h"
+	.ascii	"6\335\216\226#\373\317P\256\336-e\322<\371y\213\2350\361U\354"
+	.ascii	"vee\325\214\035Kdy\227\017\230'\0270\265\264\216\004H\250\201"
+	.ascii	"0\203\fC\206\020iD\"\032%\206\205\007\200\002\2311\335\006\020"
+	.ascii	"p''i\335}\002\264\203\3113\324lK,\035\250/\304\224n\n\207)8\r"
+	.ascii	"\037X5\330\306\024S\363)\210\360\263\227\352kN\361.m\031\364"
+	.ascii	"z&(\002\032\257\2161\257\tlk&7MQ\274\237\022\373x\n\372\274B"
+	.ascii	"s\3669\206\n\206\207x\362\200)\2134\361\220\220\310mxF\024kP"
+	.ascii	"\365j\306\201h)\264\0139\220\251\226n\r\212\023\223(~\t\373b"
+	.ascii	"\243\361TC\374\300\367p\274\013\340\372\t\006\202j"
+	.text
+	.section	.gnu.lto_.symtab.474ea4e1de50417e,"e",@progbits
+	.string	"run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.474ea4e1de50417e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1671 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	"\013"
+	.string	"\016"
+	.string	"\027"
+	.text
+	.section	.gnu.lto_.icf.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\220\003\225\017"
+	.string	"&\222F? \3458\035\024\251\302\261\325Q\270\355\230DQBgv\240\236\230BY&\310\341\304mj\305H\222\330B|\006"
+	.string	"\006"
+	.string	"\n \b\220\001"
+	.string	"\242d`?a\337\376#\242%\275i\323\346\266r\263\221/"
+	.string	"4"
+	.string	"7"
+	.string	"\364\370\235M\035!-\031\372\356\365\367\364\034\275}\375\366\372z\260@unt\346M\377k\327\216?V\214\304H\313\236\375\266\301\2242\2631k\206\0327|\b\206\357\316\271\314\371\335\3645\327\374\240\236N`X\334\247\221\240\"LK\337\201\3409.\277s\333OS\345\327\352\204\261\331&3\307\n\200G\245\367\036\347\304\007G3\236|\350\240\217^\202\005,\006\322cz\220\265\347\250$#\327\327\317\007\257\fp\370\274+*]%,^\364\\\274\330\365\233\001N\021P\022\3500\251U \331\025\225\256\022\331\336E"
+	.ascii	"\224\227P}\035xo8\027\026\3525f[\353\004\031\001eDb\251\362C"
+	.ascii	"^\025s\001\302\203\357\350\201\205B\244\307\335\2310\023\205"
+	.ascii	"\020\201T\241\352P\202m\250A\242\340\002\031\021\221\202\024"
+	.ascii	"2\034`\0022tEn\022@\305\035'2R\226(HiAZ\332;N\365\203\375\021"
+	.ascii	"\005\022\022i\260\2248w\267\\\354\367R\205\215\302\336\313r\213"
+	.ascii	"&\223\320\216\223\370\022\322\343}\355\3560\320)H\353\326\372"
+	.ascii	"\315 M\236\006~\373\330\225H\177\245t\3666\366\001\266\210\303"
+	.ascii	"\"\250\355\201j\335\312\377\266\\\311\022\252\\F\237\260g\007"
+	.ascii	"SC\034\207\n\256\207B\207<\201\276\304v\tlGH8O\373\371\326\306"
+	.ascii	"\320X\312{.G\276\326\022\247\340\331\031\223'\257\355\246\365"
+	.ascii	"\016_\300#\352[\006\235?\200\314;}\326;\017u\317\223\251ns\271"
+	.ascii	"n}\300=\274\243M\216Y\347\362_zE\341\224\273^N\310\352\373\t"
+	.ascii	"\277\333\347\0354\003\362"
+	.text
+	.section	.gnu.lto_.ipa_sra.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\221\001\315\006"
+	.string	"\262H\026\032pU\222\016\3321\360\377\377\377\377\037.rl\333\330\210y\360IP\333r\247\024\352\204\220{8\032\323cL\213M\214P\017\227^\n\021"
+	.ascii	"\275\341\013n\337\224\bg\267{\223*`3u\203\343+\t\324Z\003\265"
+	.ascii	"\274g<&\372Q\241\bm\216\222Y\260'_?\247BZ\002F\250qQ\311j\n\033"
+	.ascii	"s\360\002\241\252\315\001\021PAR\314\244\202\202\244\320\376"
+	.ascii	"\031\224\"S\377w\002\2075\307(\307\244Ft\256q\213.\353\013C\n"
+	.ascii	"\3315\246\236\313\001O\354bfD X\232\372;\3029\376\251 &\005\360"
+	.ascii	"\370\007\3750\027\335\257\253{d\314jf?@\342\302\213\372\267="
+	.ascii	"\226\205\026=\002)\360?6\241\321\355\005\003,\021\203rK8\356"
+	.ascii	"\217\007j\360~\021\210Q0\003"
+	.text
+	.section	.gnu.lto_.inline.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\267\016\2556"
+	.string	"\232L\314\017G\220\332M:\n\250*"
+	.string	"\240W\037\b\222T"
+	.string	"\030\030'\034\036\251\340(<\031\343\"\t\274\261y(0\027"
+	.string	""
+	.string	"\b\252\224c\247~\346;y\226VG#"
+	.string	"2\310\257\f\347' \277j\320b\221\373\370\367n\322\366\2262\005\323"
+	.string	"\352"
+	.string	"\345"
+	.ascii	"\\\317\275\r\357\200\227\207~[\326\266\211+\004\342\245\317o"
+	.ascii	"\022Kq\323\246\252\302\303\017\001\345\377\236\371_\322\363\277"
+	.ascii	"H\f|m\277S\024\317\270\373\370\364\364\334\013v\267\355\377\300"
+	.ascii	"7\333{\202\362\rrAy\006\274\222\367\362\213$mt\267\356g\362<"
+	.ascii	"\317\"\371\243kJp??\215\270\311\324\227 \362L\305\"\316\242\365"
+	.ascii	"T\266\247\342\251\310\223sVH]\3113\255E<U\203,\316\236\326\323"
+	.ascii	"\352\223f[u\216\330N\307S\237t\0216\345f~\374\321$\321\335\277"
+	.ascii	"\177\347\177\345\355b\360/\222\255\314\264?\3206-\t+/m\355\013"
+	.ascii	"\202\245\310\254\241\243\373\376\276\317=\237\217\270\273;\374"
+	.string	"\223$\215\254/3\034\377_\300\313\373M\222XY_f\267\177\300u>\002\347\221\307P)\214\264\230\037\267y2\252l\007\226\332y\334\356&:\3216o\267\307\035\227\271{rH\232\030<\024\234\271\215\244\016\031u\230\210\237=\336\322\225\304\313\307\210oH\205\361\240\237s\316\331uV\240-\322\"y\332<J{\244#\025E\261/v\217\3158\211\251:p\026\333\210\273l=\021\222{\355\361\323\227\337\217\034O\346\270\2025$|\255\265\326\256\265\213\316#\177\354\n\274y\221\307&\342\256\2502&\373\017\322\302\231v7\325\206\347\202\271\226g\240\353 \336\275\016\205\374\205X\303\346\274B\241\257\024\fQ\3006\210\231\274\234\312\035lS\2210\210\227\026\312\002\361\210%\013\304\"pJvn^k\013\223\354\224\274;/PM~;\345\266\335\237\253\355\276\003\301]_F\272$8\357\316\273#\311\206\n\314\230\236W"
+	.string	"\017<sNQ\244\"\207!\240\355\034~\237\333\374<\222\301\356\037"
+	.ascii	"\243\345q\030\027^A>z\332\235\326\261\307/\314`\325\3319\323"
+	.ascii	":\026I%Oi1\370\264\326\036\207\235\211\3318\365\361<\367\217"
+	.ascii	"d(\311\360\374\177\300\033\200\255l\225}\300L\334$$|\300Kl\373"
+	.ascii	"*I'\253-\264\243\371\334pr\b\310\303\265\356p\367\361\007v\201"
+	.ascii	"\206H\025N\013\032\"U\271\360\227O\300\373p\316\257\022\177\261"
+	.ascii	"\310\222\022:\345)\362k\313\356\331M\304\305Uv\327\356\221RJ"
+	.ascii	"\305\356\0162\207\n\340\330~N\334)\245\224RJ)\025\027+8\305\304"
+	.ascii	"\274\007i\005\207\310o/V\221\307J\310\314\374\020\314\356&\222"
+	.ascii	"W<\320p\360\274\326:\216\257E\322K\225\2611\371\272\325\210\307"
+	.ascii	"\272\244\244n\347\272U\366\310\315\315\033\307\361<\006WA\345"
+	.ascii	"\315\331\017\022(A\254|\216`\277\367\311+'hlX\253\354\312J\301"
+	.ascii	"\004^\371K\340]\247&P\\??\007vZ\002\r89y\211I{JK\223\246\373"
+	.ascii	"\317\207\200\342\354\231\214\223>\256\001E\207\214\225\330\006"
+	.ascii	"\330\f\255\021\021\272\214\234\255\270\330\013$q\020\257#=\204"
+	.ascii	"\202^Gz\0208\201\017\001\351\304\321\272\022\221\330I\007\331"
+	.ascii	"\215\334\007H\026]N\264\360\241:\023\303\341s\001\037\002\362"
+	.ascii	"\360\217\304f\335\277\034\037k\310\031\030\342\003\374;\004|"
+	.ascii	"T\370+I\025@\312\240i\020B\"\321zQ\202\302\305\357,==b\260)0"
+	.ascii	";\006P#\311eI\0349\362\342kg\361\027*\340\335\260\205\300L?O"
+	.ascii	"~3\204\020x\t\204<\323\221\305U\340\272=\200\332\256,BU\246\306"
+	.ascii	"\016"
+	.string	"\216\254\255(\n|5`em$\374\344\366\266\237\212E\226\224\355G\342\253\2603\261\240\333{\256L\032agb\020.\004\201~\250\001M\205\314\b\211\214H\222$\031\016\021\005\204A\310\330\025\017\022 e5Hb\210\2524\005I\215Z\033\233\001P\201_]/\201\2504k1\023\324R\035\355\222\343\221\305R\272\227\354(q\214\237\3560\215\024\346\221Y\243\343\256\271Y\255\316%,\304F\025\032\251 \037\206\002\227P\001\203L|\224<\032\351H\f.ymz\220\272Hm\361\023H^\345\302\013% j\022u\364\335M\313Q\330\232\221\374\215]7%waR\024\214\236x\200:\311\235v\254\321k\334c\331N\036\204\211\277\353<\367\255{\275\355;\321\357\354\265\230\263\366\322\274]\225\276\275\332\343\315F\270\334qh\350\"\017\375E\356\335\246\271Q\334\022\326\374W*w\271k\266\252\030:\271\320O\356\255\302"
+	.string	"\031\214\333\313\372\006\215\241C\320\212i\230\344)k\003\324\027\234\b\3115\346i%\225\300\252\031&\371\304\002N\016RD\251:/r\342\375\351\343~5\223f\373\204\254VP\275\302I@\324\bK"
+	.string	"\"\205*\003\207\0225:(\332\004\fv\264\215\035\364/\0046N\347\024\243\2605\372\216\307\204A\221\2771\302X\323\376\217I\243^{\220m\fn9v:\342\310w\bI\022\230\003H\032\313;\r_\t\332\003\330x\024\376\031W\263\200@\37103S\306\357\367M\227/\033\306\n\264\326EV\024\212\332\342\321\222\034I,\264\307\f\262\207v\206{\340EP\372\314\226\216 @(\336\301\2318?\363\035\034\340\032\230\241\022\265\274\342\203\377\"\334\341z\002\f\360<D\342\325\203\t\273$#.\342\021\007=\266\220\3350\241\025e\037 =\273\216(K\033`\263\370\347q\347\2371]\367\00255\nx6\f\344\305~\256"
+	.ascii	"ZH\273\3012KHJK\037\030g\274\342\227\306M\327\333\240\237(\334"
+	.ascii	"\305\003A\340:~\005\261\001\320N\025\2746\\b:WI\203\002\237Z"
+	.ascii	" \241a\031\n\032\002\236\255\200?\255\2416lpYZf\244\232R\305"
+	.ascii	"\b\313\017q\215\032\225\031\330Av\030\210\237/6\3768\233/\340"
+	.ascii	"\233s CYC\300\263\025\370\021Z\036\"\020\3721\023\324\370\307"
+	.ascii	"G\362v2\256\351\206/\220\007r4\213|j_S\314\017\226\244\216\374"
+	.ascii	"\226\005\034<\255\t\270\365\0040\222\365\324\236H\001t\334t\361"
+	.ascii	"\216o.\331N\255;\332\353\200\265hK\207\341\"\022\006\337\252"
+	.ascii	"\244\f\354\206j&\341\246H\372\374\031\323]Aw2\235$\317o\316;"
+	.ascii	"Q\032\252\206A\302\372\t\356\247\021c84\306\356\342i\302<\342"
+	.ascii	"U\035\252\276\216\250\r\237\203\311\013\004\370\375T\300\325"
+	.ascii	"\235<\245\017\005\326\217\3418Y\210W-A\277]\246\022zQ\257;"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\245\tE\027"
+	.string	"\346[R< \217\222t"
+	.string	"\f\024\220R\204\212H\022iI;HO(\023s}\r:C\001\320\367\271i\020\002\001 \001|aT\242?\330b\335\023\013\n\371\346\021\244\234\354\203\377\333\335\b\221I\0069"
+	.string	"C"
+	.string	"D"
+	.string	"\363\312\247M\365\324\033{\322\223)\303J\236\271\344\315[&\322\333\364\324\023}\177#\254\223\323\325\302W\313d5]\3658\276+\352\251\036\364\035\244\307^\324\263\360+z\020@\210\020\252\bql\204\3435\313\335Nq7.\367\232\237\347;a]\260\002\373\031\017\372\244F\253\271\253\003<3\206u\350\026\246A\257\343\n\033\355K\335\366\334\3421\303\312\027\215\305\340Bh\232\246\351W\036\305\r\344"
+	.string	"R\225\352!\250Ej\361\203\211\276\0176#\364]\274\212y&$\345,\216DGYq*\307B\t?5\371\371\202T\236\312\201\350(S\352F\316%\242\362\017{\021$]"
+	.ascii	"\214\250<5\207\250+\032\206\006L@n\302z\245\224\351\201\364\244"
+	.ascii	"\336\264\020\320R,\205B\225\221\3748\020\035y\323!\306C\254\257"
+	.ascii	"\033\351\016z\031\003\023z\233\002\036\344\021\350\235\273\351"
+	.ascii	"\320"
+	.string	"`U\352\333`%\"%\327\301\372b\fWgu>\017\326\006\200\264\250\301\265S$#IRgY\003P\002!SFU\017\022\300\263\024\205\3010\314)\247\230\320\210\242\024\224\224$u:\2453l\246@\024\342m\340`\200\337\017BB\234H\n\177\257\237\022S\230\252\022B,\260\003r\227\360@\352\335\tn/\213K\310\2605\310vi4\304\3111\"K\363[\364\316\245Xj\274F\t\230J\250\002\326\373\262\375!\212\320\023\271\213\217\023\363\221\n\375\n)\332-\263\224RE~P\032O\267\215p\346/\\}\343\310\315\035\365V\260\207{Q\224\304O\3040\347 K$\273\n\303\3700\332\001YrN\345X\341a\300m\033\004\027s(5\013\345\227f\246n\033\017\007%\276\247\214\264\025\345\363D3\267\326\373\007\262\020!\213D\353\344H\n\245\326\021\340\316\021Q_)\345\301\n\373b\351\022S\232-\3568"
+	.string	"\"D\3604\203\032\330D\210\\\375\355\353\373\311\277\262\246!V\200@\262"
+	.ascii	"\023\217\375\001r\313Dh{\233f\343\345\t\265r\336\341@\211]6\372"
+	.ascii	"X=!\300{5_\366\216\202\367\256\212^\200\217\315x\242\354\020"
+	.ascii	"\036c}\215w\320o_\350q\215\353\353R$*\226};\221\301\001\b\265"
+	.ascii	"\330\377v\017\005\303\002\030\024D\003z\322\2657\020 \202\016"
+	.ascii	"-^ \t((\007Z\204\235\023\215p\0306M\216\316\276\316\214\204\261"
+	.ascii	"?\274\354\256\206H\244jO<\t\355\275\356<\017\244\332\373\213"
+	.ascii	"K\220\"\223\230j\341\025\322KpB+\rY\273b\250\243\203\002"
+	.text
+	.section	.gnu.lto_.pureconst.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375 D\335\001"
+	.string	"B\304\r\026\240k8\377s\212_\377\377\277\352_&I\302\365\353]Y\022\372e3\232\320\3243\235\333\\f\256\271L\345*\231\310=\2461\213I\334\341\n7\270_\340ik\233\024"
+	.text
+	.section	.gnu.lto_.ipa_modref.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\314\002M\016"
+	.string	"\206\224@6`K\223\341P\b\031x\310\f:\344\355\t\270\201\217@\334\344\256E\201J\n\200\036\316i\032\322\013\375\250\f\022\320\177?\352z\035\354\320\227\030\r\365\227l#[\312\024,"
+	.string	"2"
+	.string	"/"
+	.string	"\215\356"
+	.string	"g\3541\320\337\017\362$\332\245\313m\276\265\2479\257\224K\235\021\345\021\355SA\211q\\\312\371\316k\236\343\324\222\035\2572\002\252\265g\262\264\261\326\232\302\373\023lM:\203\262\365\204s\001\235Z\252\222P\347\177jAn\322\375 \256i4d\234E\206\256\005] 8j/\252q\013\021#D\225\267\366L\026\t's\001\334\214\311a\374k\361b\222\317\030\031#\306d\247hoP\307\303\025\024\304\037=\301Y\257\365p\230?\334bSD\240\220\240q\013\f\341\206\362p\004\376\311\372\320\001CdC\346\202\205s\316\002\306\201Q\003X\001G\225D&\376"
+	.ascii	"\375A\247\324\277\265\035\264\022!\364\025\314Y\240W\321`\250"
+	.ascii	"A\275S(\027\244\240 \205i\f\200\002\021\252\253\016\021\020Y"
+	.ascii	"hL\304$\225\366\f) \221\013\205\032V\367\0220\300\"\223CQ0\362"
+	.ascii	"\2143+\345\324\234\003\354I\f\337Tt\021\nA\260\276\331n1D\031"
+	.ascii	"\222\346\314\006\306\351f\215Y?\221\207\016\247\220\203\262\210"
+	.ascii	"\367\2639\271\343\231\313\003\016\301\347\300M\344\305\2413\201"
+	.ascii	"\020\211s+\\j\307\226jq\374\006\3136\023\250\033\351\311\256"
+	.ascii	"\207Q\235xK\002\260\236\312\235\016d\251\301\266\352\215\345"
+	.ascii	"#\225\224/Ba9\303V\023\346|I\342s\b\322\274\007(\257k\372\366"
+	.ascii	"\265\346|m\232\013$ 6\207\246\007\ry0\352\026M\370\350R\347\312"
+	.ascii	"\r\251d)/}"
+	.text
+	.section	.gnu.lto_.lto.2d13c69bb567ee1f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.27.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\245\013"
+	.string	"\266\225PB O\234\016\2044\265\321`\264-zR%\316\320\255\232z\254\363\245Z\270\371\334]\277Y\323\377\334Lc\230\206\232T\033n\020\364\226\0040\006\343`\325\223>b\224\003\003~\023\343v?\242\221\b\331;\2459"
+	.string	"="
+	.string	"?"
+	.string	"&\023(v+"
+	.string	"[\264c\256\257d\307\264S\262c\026\355\026\257\035\026\303\242 \202\265\273\333\344p\361R\364\237z\006\251$\272\224dv\327\222T\302p\317\333\036\261\215\300~&\236&\373\250?{\375\257\217\277\3248V|\234\330\275\320\202\261+,\305\007\333\237\330\276\244\035@\200x\024\350U$\203\352\244\" +\004\220\216\225\220\262\200\271\264\177z\b\361c\350\036\273\001\021\234M\233{\tP\202\361\3055m\006'\321i\273;\300\037\361\300\253\260\360\020\312\216aF\020\032F\262e\211\224\025n\025\231\345r\332\240\003y\222+.V\023\246\310\256\"97\330\277vw\003\240/\244\035\365PM'\344\016,\240\337\246\003R4B\nR\003\236&\374\274\002\037\260\3330\347\342\331p\037\005\025|\300nk\300m\272\215\363\201\333%\304\336\207~[\350y\3376\251\373k\247\311X\214\325h\006\023"
+	.string	"5\003\220\347\214w\201e\34218\032\\"
+	.ascii	"\214J\207\351\335\275\231\020\312\330\"\256\261\307a.8\001\366"
+	.ascii	"\202\302`X\200\n=\356\360\242\235d"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.28.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\346\004}\""
+	.string	"\212@ \016H\200\030R:\273PG\001\004\372X\236\367\375"
+	.string	"\n\336"
+	.string	"\367\233\312\230\026\3604\206n/}u\027PFq\363\2664\247M\336(\363\375O\001AP\300\260t\250V\333\221\373\303\217\307\206:L\205\354\256\253}k\233l\271\223\f\320"
+	.string	"\302"
+	.string	"\317"
+	.string	"Z_\314\342\214\216\204\237\344i\354C{\232\232a\341\f\352\350\306\005a\367\363?r&\373\0260\030~\031\265\273a\272\246\227\261\301\356'\337\354F\206W\276\370\265\252\301\243\341u\204\273w\211\340'#\330\375\344\345y\354\317\335w\354O\0362\217\371\022\354\376\fF\021-\356\336\013\354\035\354\243\303\367|<\235=k\323!\037"
+	.string	"\225\2517%H\342{UWu\005\344\\jlU\"5plgNQ\237\305\342:Ow\343\266\006p\333B\366C\026\353"
+	.ascii	"\0349\226\370\220V\364\324ye\225\351\302\322z\255;ZL\274\374"
+	.ascii	"\220U5\201\227\261\255\247\235\036\221T\264\317|\025\222\325"
+	.ascii	"f&\327\205\305u\252\203p\357ejDb\235o\316\314e\314|\202\271\232"
+	.ascii	"\005\3676\220\002\202W&-\216\355Q\236\354O\332'\2639D\311\207"
+	.ascii	"\362$\004fdf\027\177"
+	.string	"\002\342\300\227{/Q\223;\021\301\367\361\223G\034\321\033\177\362\217\354\317\236\246]\2146~\375~\332\317d\026\231b\033):\327\315*U\310\346\037\375\203\226\031\005\022\275\221\247i\231X\230\034\034U\023\231\227D\332_\314'\002S3\206[\007\263P\020\320\325\316??;\373\034\355\334\303\243\223\363\373\362\214sR\2769)\373N\312=Ky\327\243\254\343Q\266\226\362\271\243\\\257<\267\2162\265\224?\204\023\226\304\341\025\243\337\226\367jn\315m;\331\202\\\355?\373\321~\345\277d~\223\277\246\306b\210\270\274W\033\002|\200\356\332\247{\306\206d\364F\036\372\351];\320JSlS\200V\263\007m\202\3474\363p\310\260\b\275\361\247\277\366\236\331\030\02498\253&2\257\311H\272Y(\353\323o{#\232q\023@\371\303#\266\037\301\332\006\236_d\277\344\272f\226@\201\336\350\323\365nq\205\267Y0"
+	.string	"\366\340\213\256iX\362\207R\212\3169}\313\205\335\275TD\374,\327\202\241j0\2627\032\331\237\266?\006\f[\355\263_l\303\035\216%j\367+$<\354|\274\260?kw\234\f1I#\312\303\300B\203\307\331_mnY\222\267\273\370\217\262\277\026\352\020YsV\311):w\252\\\203\006L\355/^ai\013\317\302PQ5\314\374\341SV\234\314f\331\rPB\247`RPE\220C\n'$\017&\202\302\243\024M;LMI:'\341R\206^\213\240\t\245\n<\024H'\224\226\212\234\204KL=.\241@\305\021\2220\3304\202\251)\t\250\204t\224\004,!l\002*"
+	.string	"\342%\246\240\020\350\264\264$\004\372\226\367\255\203+\331R\016N\252\247\340z\314\367\312\304\224\224\247\271\362\272s\372x\346wg\304\200P~\224\345\312\323\351\037\013{\323E\276\356\365MS6\305,\352\353\332\245H\304\312s\272\327g\236"
+	.string	"3m\352\255)\345\257\367\336\353\353/\356Ql\352\202\232kNw\037\271\352p\b\\\025\233U\250u\372\310|^\177\361\327^\307\320X\240\346z\376\032\247\217K\316<\f\0224AJ\033U\023u\375U\345\277\006\352\020Z\001W\2501 \205\214\202F\031ddD*\030\321\266\030`\002\031\302\353\006\020x8\232\244\320\030\013&n\307\301\371)\342\t\177\005g\300\250\363\356S:\341fZ\311\322\330\004\247\t\336N\024N\334\376y\223\314\020<\262#\344s\036>[SF\323\224\354\3740\n\004\217\376a\343\276\245\215\004\rk\007\\\361\301\r"
+	.ascii	"\331\356\035\266\343Bp\217\326\t\217\007m\257\366D\312\220\270"
+	.ascii	"\007\t\203\204\212J\340\003\330\274$^\206\f\262\256\317\024\366"
+	.ascii	"\213\266\271\004\033\374\325%\274(H}\360J?\361\263\373\231\337"
+	.ascii	"!\325\371\013NS*\313\377(\005\216\220\202\262\373A\344\334\016"
+	.ascii	"\245h\360-\205C\307\333\210X\306O{\302\204Q\003"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.29.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`G\002\255\023"
+	.string	"6%\202I\320\322(\035S\300\304\025p\367##q\260iD\222\201\356\306>\366\224\376\337\272\326\2078\034\256\0134i\240\227\275\0010\002l\004\227;\205\367+\030\304_m\034\240\304\023\230m\001V\225\323ph\241\303GF\b\331D\356\224\002k"
+	.string	"f"
+	.string	"p"
+	.string	".\021?\215;\001\360S\374"
+	.string	"\360\3230\273\3508\233\275\016E\314\356hwMZ\302\372\017w\203\022\366\020\234\237J\230\257\363\003\266\036\255\026{\370\221\354\356H-\346[ \223`\310\212\231O\021\377\276\023\242\032\315Hm\303W\002Q\224\343\273K\231\332L\352sO`\363\241\325f.\303\224\335\265\244\325>\334\342m\207\260\255b\313\b\001\273\033S\275\331\270\230\374\356\256\265\306.=\347\027\317s\207\337\271uJ\313O\372"
+	.string	"\300$\033\005z\273\035z?\2267g\2448\317\277c_\347\357xZ\2760\036@dd8)\342q~\316\245O3h"
+	.ascii	"\373\216\213\270*\302\037\335M\217]\\\311\247Q\304\317\227l_"
+	.ascii	"\332g\361\026\260\347h\270\200\335\032\242\240]\234\202>"
+	.string	"\241\300#\036\214\306,\"E\265'\250\344i\036\3511\342\3154\346\234\321\210\033\237\336,\252\324Q\267c&\221lS8\320\205Ph\350fwQd\254Db5\216`<F\013\370)5\024\032\302\311\361\177Z\020\350\240\331\316\360\027\253\023\233\335u\340s\027,\377\304\247-\270\344i\237\276\013\374\fU\342\240\315\250^\277\373\f\262\001\305$\275\310\236\006\257\221\245\322rAH\275N+\252\025\226\023\212\004Cj\205\345\301kd\265@^#K%\304(\223\n'\325\230rIh\271V&\026\325ieB\215.\223\211\001\263Z\251\321\364b\261FS\t\267\377j\215\255s\261\247\307{QY\2507\007\240\231%\235&\244eT\026\351x\314$\322?Pov\001UK\372\334\247\017\233\017\f\t\231\354\311I\"%\207\233\006X\362P\035, 0\002\204\030\303y\315\370w\fq<\007\022\231@\302\321\324}O\263\301\227"
+	.ascii	"\013\227\t\246\242\310=$\004\367K\b\276\245\241\r\330w\224\026"
+	.ascii	"\036X@\b\027\200\023H\300m\n\225=\0342\026\364\315\233\353\016"
+	.ascii	"U`\245\274-\205\bV\bb'l\305\031\306h\336\323\321.\306\"\336A"
+	.ascii	"\245\271\276[Os\037\355UW\334i;\031"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.30.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\\\002m\023"
+	.string	"\346c~H\340\360&\035\333\203\204\343z\305\2407\204v\214+\2044\331m\374\024\251u\271\307^\244@\025\302\255\221F\205i\343\2167\237\215*\273\23486g\203\031H\026f\\\306\214\003\366/\300\202\034\002\004u\344DB\310&r\247\024g"
+	.string	"d"
+	.string	"m"
+	.string	"\273\267\221O\217\200\237\017\035\263\227~\303\331\343\200`|l\354.JEX\337\335nO\306\376y\263S\031\363un"
+	.string	"D\321H\223\375\353>v\327\203\006\323!\230I\017"
+	.string	"\n\232O\017\357:\021\246\\\223\007MC\007\"Sb<\3562\206\346\"\365\266\213\324\034\2154\232\313\317\301\356Z\216\264\0167x\3333\266\037\330R%\307}\016\325(\3018\265\310'\335]\231j\315\276\311\344Wo\354\360=<w7\245\265\223\226*\375"
+	.string	"`\223\321\214\220\242]\231\247\034\2134\211L\274\347\347\271\264o\177\205\217s\370\333Y\304\336\263\362}\341\320\0213\023*\001?};\210\367\t\276\200\367i\177\307\2679\374LP\022;\017\013\270'> \\\020S\251\317\006\351Ee\366\220\252\266j\202\374\350\006!\\Tf{u\242\013aN)'7\244\032\346\224T\330\354d4\263\323i\315*\236T\021G\303E\342\260M\341/T\276\\\322\002!\226"
+	.ascii	"YR\016\320\203V\274O\251_.\351\206\315w\261r@\306h;\303\177X"
+	.ascii	"\npv\227\201\317[\264|\022\237\266\360\222\037?\375\227\312\030"
+	.ascii	"#M\247\3270\261%\301\365\212\240\202\245PV()\251\223\017\f*\224"
+	.ascii	"\024\b0\261\345\352\360\tI\205\324JT\275L\\/\026*e\225b\241N"
+	.ascii	"\304\027\212$\304-\227JD\301Z-\021\025\336\366_\275\3219\370"
+	.ascii	"\223\002\251Eg\237\326<\340\303\fu\216\220\216Q\271\364nw\327"
+	.ascii	"\323\232Y\274NC\275\355\263F\315\321\213\315L>\311I@\312\r7\f"
+	.ascii	"o\344\240\332&\001/ P\002A\312\252\036\317\030\322xK\fm\375\220"
+	.ascii	"\025\263\3575\373e\t0A\037\216\2010yKkWV\002\357[\263\332\177"
+	.ascii	"q\356\230G\271e\274CA\344\261\331\035\334\312\337\021\024=P\024"
+	.ascii	"P\017\305\032l\245\320\250\261\2407o\256;\314\024#\335\006\025"
+	.ascii	"\315 \216\266\310{\316$\031\327\025Kfx\334\310\016\252\347zn"
+	.ascii	"\335\334[{U)\356\264\206\f"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.31.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\374\034\235["
+	.ascii	"\n\217\230\037P0\220J\352\257\024\371\276Q\366Z\270\007\2677"
+	.ascii	"_QX\305\316\350o\263\303\267\360\224\006\t>\205\200\2151\" \203"
+	.ascii	"\035\374\274\007#\231w\005+\025@\t\004R\005\202<\200\024\256"
+	.ascii	"\257\264\247l\334\003P\245\372\003@\225\352\377\377d\233\335"
+	.ascii	"r\357\224R\n\322\001\315\001\354\001\316L\327y\351\347\254t\235"
+	.ascii	"\211\327y\310:'\255\316H\254\363\321\352lt\235\213~\316D\327"
+	.ascii	"y\350\347,t\235\203\2563\320u\376Y\235}V\347\036\2373\317u\336"
+	.ascii	"Y\235u\256s\316u\306\271\3167\253\263pu\016\262\316\300\325\371"
+	.ascii	"w\235}\327\231\275\316\367:\257\327Y]\235\177uv\325\271\373G"
+	.ascii	"\363H\023\255\341(\257muL\333\264q\253\226$\314\334\215\306\034"
+	.ascii	"|\346\031\314Af~\263~aF\237\311PuZ\256e\216\017\276^\207\252"
+	.ascii	";s?i(3\332\371A\357\264\255\230\035\226\2665\253\342)_\257l\326"
+	.ascii	"?\267W_\367\334^\231\231=\204\230\301ZmFD\007\213\204K\246E\333"
+	.ascii	"\326\254\370*\264Vw\340P\264\252\242\232\222\212\202zrjbZR\""
+	.ascii	"\016\223\220\216\214\212\210\206\204\202\200~|zxvtrpn\204A\340"
+	.ascii	"\317\307\336U}\327\342\006zmu\007\016E\2720nU\005\347TS_Z*\006"
+	.ascii	")_<\312\213C=9A\331\274\211\351\212/)\2515\261\212:LS\363!\020"
+	.ascii	"*\236\204\304^\0359\241\270Q\021\020'N4\324l\2412\264\246\007"
+	.ascii	"\001\375 a\301}\222\034\361\036\366\212\307\210:\034\353*\342"
+	.ascii	";hM\224\353\002\262\202\353\344\340\200=\2338\326\365\3457Da"
+	.ascii	"P\225\372z\353\321r]&\250?b\226v=\326%\304\201M#\374\272F]\373"
+	.ascii	"V\245\022\226\275b\261\234\326p\223@\257\033\367\247\b\027#L"
+	.ascii	"\f\353\n\362+\t0*O\244a;\200\264*\327U\247\016\333\266\355g;"
+	.ascii	"\016/.\1770onkV\242<iBdH\207u\225`\343\252kxx\001z!o\234\275"
+	.ascii	"j\333\226]\351\265\243\331C3\177\023f\006\301L\344\001Ya\320"
+	.ascii	"2\307\321\314\021\370\bQ\343e\226\300\225\3063\266\343e\236\300"
+	.ascii	"\223\307\035k7c5\222\004K\364(\003m\241\032Y\034\360\231\234"
+	.ascii	"u\221R\312\326\264\217\332\217\3373\373\355TP\002\346\333\342"
+	.ascii	"[rh\321\033\332G\315\213\3052E\0223\355h\263l\342n\272\226\234"
+	.ascii	"\3356\334zn-"
+	.string	"\003\004)7\033^k\031H\275\026\3326O\311\304\221\006\353U\337\343\276\322\025DiA\272>\223[M\026\nk\312\360\332\305en\321w.\214\210\374\262\250\211\342\365\270\261\311\251\317d\246\226q\261\036J\207\221g\035\227\263\341Vk\023m4\315\226\3531\233m\365\223\222!i\177\206\033\2150\204\021\312p\333\005\333\320q\327\001\303\314q\317\360c\223\343\036\343{\022\206;\216\375z\343\206\273\311\034^\270cX\367\272p\267\251U\266p\303\360,`\341\316\342\354\312\326F\220\026\326\270\331\272\263n\257>\254\026\314\355IY{B\033\325V\230\371\214\257m\267\372\353\214\373\2647\226ti\332\266\215Z\322~\371\0363[\320U\262|m\333\212\340\246B#\016\003\337\221^\271?\270\275\366\037\311\321\346\013\212\263\206O\231\315\266\372\247\323i\233?\223\271\177:\235\266\361\2131\373\234\217>g\n\372\254\033\253\235\335\013"
+	.string	"\235Y"
+	.string	"\235\023"
+	.string	":\257`g\004|\316*\256\363\001\253\263\001\253s\n\2373\212\325\271\200\353|\342\347|u\235\t\3709\017p\235M\\\347\022\254\263"
+	.ascii	"\253"
+	.string	"3\t\3269\200\325y\304u\006\340\347,\342:\207\3709\203\270\316\037Vg\017>\347\016\2533\007\237s\361:[]\347\252\353Lu\235\247Vg\251\3259ju\206\272\316O\327\331\351:7\375\002wC\027z\242g>\201\302[Y\364C\033\277\305CO\364*\227\344\036\235q\350E\324\035_\350\373\331k\217&\320\344\336\364\370\354I As@\377\363Ac\200~}\302\360\003\201\213\211\373\361\001\323\363>o=\377#\203J\301\264\220\rJR\f\313\2652\244\233\316\272mW\216\260\236g\347y\276\223{\\\214;\317\"\247|i!\333\020\243gro\3112Z\246\225\341\025=\223u^\370\035\366\254\313\242\363A24\2513\007\212\3637\237\263\206\363\353\023\255ys\201[Q\273\021Rq\260\016\276P\312\361\177cS\251\323\255\373\331-\202\025=\242g\262\013\365[\177`\023\324^z\305\343`^\361hYO+"
+	.string	"\251\341Su\350\231^\002]\bB/\366\373\007\373A\346I\003\227\2639;\"\265)3\300\315\214wyQ<\3403\253p\347\n3\312;\337\003\277\227 \311K\356\375\236\231\205?9\"\251z\312;\366\177\337eH\320\250L\260\354\bj\222\025\206\007\024\246\214)\030\206\246\231\270`\nj9\323^n\317\237g\362:\302\207\r\276Tb\303g\332\306\353\373\236\341Y\247\200+\361=\253\305L\323\331\223\304\256\f\357z\331\372\301c\274\354\367\330\023\f\363\002~\304\215\320\210c@\250\033\270\275\262\337h\375T\203\214\324\271\363L\366>\336\177(\037d\367\211\030\327W\377\276\232\226\364\221\202q\375\365lN\352T\237\231=p1\343\021]\333\266#\230\035\360\345\003\275\002\021\301z\365W\275\344\336?\n\307&\272V\336\365\361\372\377\257p7\276\220>\345\257\243\377ol\256\351\344\322B+<tL"
+	.string	"\223C\347%\204\301\271\377p\241\345-J\202\361\354\r\204\346\321\206c\243\261\036\212\004'ZZ\250\366\345\306\271\274\262\302`\030\232\n\361!\354\242#-\272\003\030/\2608\210\241\001\313-\25428b"
+	.string	"\303E\214\t8\210\241Aq\003\f\216\032\024[\300\210Q\2642\342\027\034\270\200Q\354\340\305\013\030\305\240Y\333/\306\267\356k\n\324\327\255u\307\240\231\002}n\255\213"
+	.string	"#\360|U\343\221m\333\266\035\266\210]\341\340nY\304\246\024U\034\360*\276\241\007<\3135\245i\246\205Z\204X\235Y\023C\213V\245\260b\300\007\227\2405M\320`\363U\250\244\220R\300\247@;\026\360?\262i\363\304\331"
+	.string	"\177u\202\200\277\212B"
+	.string	"\212\037"
+	.string	"\205\211\357\036Qh\200RI\365\231\016Q$\252\3134\013\026\017eJ\212\304\177\021\260w\222W\342\233L\336\005c\211\017.\363\004x&.<\231"
+	.string	"\037D\256!\361J\002x\022\237\344\221\b\005\360-\245\247\226k\232\316\250\343\035\361FF<\213T\003\300\257"
+	.string	"\342E"
+	.ascii	"\020\342E|\n!:<\b'\264\303\207\257\027\373\345\007\017\217\002"
+	.ascii	"\207\367\360`\034\376G\206\327$\323Bh\024\250\037b&\372\364B"
+	.ascii	"\354\242NE\253/~\0071Z=\213\264k:\253\376\207\221\352\247\276"
+	.ascii	"\352;\351\203\352\325\264'a\352\327'\031\031Z\bm\232{\036sLR"
+	.ascii	"\037\365^R\037$\223\201\370H^\307\347\320S\336E\275\bP\0375\301"
+	.ascii	"+\217P\377#\013#u>=\bNO\374\247\277at\372\017\023\244\351\271"
+	.ascii	"\224\236\251i\351\231~k\211\202W\372%\367fh\254\247\200\370\335"
+	.ascii	"\303\t\232\344\236\0306\351\022\261\347:D\223a\313u\002\tL\215"
+	.ascii	"\232\224\236\351D\244\177#C\306\350\035y\264E\361\376\006#\034"
+	.ascii	"\023\227\032\207\037\\\2665\235Iy+\326\224w.\270\232\244\017"
+	.ascii	"\"\273H\235Ho\303\321\bNyw\364H\337ZM\257aE\032\032qZ"
+	.string	"N\210Z\013\312\355\365\350;\255\247\226]\232\316\3413\231\355\34352s4z\026\311\245\351,\3722F\2404e\202\033\250\222HU\220Z\245HDD\222\202$Y\306\222\f\210!\026\203R;\017\022\200\3624\006d \350\034\"\204\310\034\032\222\202\244\2305\217\304\306\314V;\026Vs\303f\257f\032n\237\357\204Xx\322\026\300\030\225\362\237\27576\204x>\305~\323\034\357k*\033"
+	.string	"\242\203\252\335\230\276\035\006_\367\005\001`M_Qr \264\215Q/\262"
+	.ascii	"\366Za\2665\343\006\n\264[\234\331\333\240\343\023\037\212\022"
+	.ascii	"\364\3020\024\3204\203\276G\364\213\177B\234\376H\310\371\211"
+	.ascii	"X\245\f\260\220\246\305\332m\377\326S,g_CF\026\315#\217N\200"
+	.ascii	"C\204\261\356\021Q\271\361\267\272\211\306\370Re\314"
+	.string	"Q\314:\331\002\314\241=\220g\362\206Lg{fB\006f\352\341v\245\233\3174O\365\345(\257\321\246h\320J\252\365\034\2566\366\215a\264\260\337\367\261\017R\300\274\320m\030\214\207\250/z\316c|\033\235\003\013a*\254\254\243a+\363\216\332\360N\275\020\237E\316\"q6\263\363\255\255\035\341\275\314\272\213x\313a:&r}\017\027&c\227E#\245\266T\t4zQ'\2307\347\243eP\222HT\324\036\227\013\224<7\364\037\004\322\312q\n\036P\004\336lO\261V9\346\026\0204\004\206\2670RT\230\275\034MU2\b8$\314+\353\203A\322\237m\323\235\276\243\031\334Yk%\205\212\0077n\316f\004$\321\234\307\016\023\\\020\270\3007\246\335\024\236\0221,\234\265\004}\223\035Bd\360\031\322\272\034\303\306\357Wh\203\304\367\004\375\023;RuJi\227\373\257\340\301\251\331I[\372g&q"
+	.string	"\323\036\235\f\035\276\345jA\271:b\312J\b<\007\216t/\244\002f$`\377H8\333\023\25462\003=\364\373\316xh\007j\007\337\b\330G\030\023!v\032a5!\246\023\343\217\022\302C\001\307ES\212\310q\223\217\230\360:4\363\222\361\322\023\231\225E\007\271YmS\214\024\367.\027\004\315Ut\372\241\255;\001\034E\371\363l\027\277*\323\274\254\033\363\214\211\323E\207\203i\\\327\306\260\245\3717\345C\321;\232\214\016\364~Bew\320\373\373\315N\204g\nv\266\210s\320\364\2733$\n\035W\006\260m=\254\203\262\306C\210\221\335\277\n\344A\302\323\351:\271\371L\224\261\"("
+	.ascii	"Qr]\005\2450Pq\350u?\265\261J\215O@6\034\007'\2606\017\272<\b"
+	.ascii	"\375\303O\021\234\021\270\020\205\213\344\340D3\234`\0054!\321"
+	.ascii	"[oc\253\222\037\303u\213\210qY{D\214\233\3100#I\315\266\317\030"
+	.ascii	"\343\024\250MV\n\225^5\366\337\237\004\333m\356\013\354\271V"
+	.ascii	"\tJ\223\375\247|\231j\005&\305\337G\233\374\244\371\377\224\227"
+	.ascii	"\251V\300\223\351\357\256.\251\004\261\344\217~\031\374G\332"
+	.ascii	"\316a\325a\254\267I\274\233\234o\255f\022\217N?\363\226\036\274"
+	.ascii	"\351\364\254\233\261\214R-\3031;\314\036:n-q7\234t\246\311zs"
+	.ascii	"\372S\364\t\322\006\017\224\0373\005\315EE\023\216\311\013Q\003"
+	.ascii	"\006u=}\334X\346(\305\211_\251)\345\201\245\013T\001}\236'v\227"
+	.ascii	"cL\3445\203(\346\217Iz^\336\006q\313\237\304\026/7\264c\215\373"
+	.ascii	"\220\2418\217\270s\340\037\367|+\036\331\013\232U\205\022\367"
+	.ascii	"!O*\\k\255\353\255\016\001"
+	.text
+	.section	.gnu.lto_mspSerialReceivePayload.32.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`>\006\r#"
+	.string	"f~\331E\200^Q:7\b#\215\213\031^d5\r>\034\306Q*\271\304$>\"Z\\\034=\003\007\007\355\200o\257!\376\314\226\265FUC\220\030[\331\243\277E\230C2aR\367.\243i\020h\317f\t!\204H\231d\313"
+	.string	"\264"
+	.string	"\306"
+	.string	"UV\263`\026.x&\274x*R\257\342B\tX\254\303\020\\\346HQ\360r\035\240/\225H\346\335K9\227\324\2110^T+\026\330\227Z\213\013V\001\372r\213G2_\24272_\356\3566\200 \265S/j\3318i \t^\371Sk1\327G>\365ZJ\233\241\247Y\222\315S\373s\351\367\032\003y\372\34342\301\225\032\034wc\365\203DjS\244\216\017\236\r r\243\307\321\273\261\352q\343\007,\261\342\301\347\216\233\244R\232\260\240\3200H\n\300\022rL\207U\\f\b$\034\3468y.\031O"
+	.ascii	"\007\033*9Z\2069\336@*\332P\206ITk="
+	.string	"\021+ $\237K\265\326e\341\360\306\327\366\335\375\332\335\r\273\246-^;F~\231)\3573_\236\313\356\216\221ox\324\372\373\325\356\356\030\013+\202t\210\f&\333\335\246k\361\241\265\326\b\373,\027N\240I^\356a\230/\3377\336@\327\327\023b\f.\333-\376N\326\316\332=Y\033k\367U\276I\357\372\342N\374\003,/\322\261|\217N^\243\223\367v\362\026\235\274D4\336\241\224W\210\306k3yk4\3364\345\245\321xg&/:\343=Q^\023\345-Q^\362\344\355\223\227M\336\033x\220\255?y0\200\325j\243LP\r+\303(y\225\277\353\307\362\336\225\332[\371\225\0337\305\342\353\240%L\312\037\n]-^\003\233A\003_\230\266\322\254i\335}8\\\016\323\254yF\302\256\270\036\345\314\2242fg\355w\304!k;\232\364\354>3\025s\022\364b\363>\363\250k\034\355\022V\350"
+	.string	"\031\220\033\037\332%P\316\021"
+	.ascii	"\233\215\353\263w=|\340\013\223\332\305\220\252\376\355.\210"
+	.ascii	"\203\361\316~ F,\233l\263_\265E\305e\313]\366\203d\335d7\234"
+	.ascii	" \231\210\257\351v\200#\316\221\3704-pZ\302\335}q4L\007\346\324"
+	.ascii	"Z%\214\370\031\022/\013h\341\372}\204:V\367\257\0353\230\221"
+	.ascii	"\255+\256w\371.u\255\365W\212\371\r\020\331Y_~\343\023\366\343"
+	.ascii	"A\357\316\032\263'\223r\201\331\207\3311\024]\026V\032P\266\352"
+	.ascii	"\020/\373MQ\272(\017<\037\224\212]\023\212\235\315\204\256\267"
+	.ascii	"\302\205\316\351\214b\341\353\355\312\250\247^\007'(\336\271"
+	.ascii	";\006+t)\236\232\240H8A\361r,R\350x\271\335\023T\216\001n{NM"
+	.ascii	"O\271\250^\357)\227\026\353\033kM1:F\257\364\2372o\274\005\261"
+	.ascii	",F/\336O\231H]cw\221\232\233j\277\345\273D\326\322\243>\372\216"
+	.ascii	"N\254;G\0361\214_3hF}\353\022V\304\200\f\310\217Q\317\230\334"
+	.ascii	"yB\274u\237\235\320\205z\212\232\250o\375\252+*.\333\244.j\266"
+	.ascii	"\023$\333\263#\352\356\032;\316\206:\217P\357V\030\262\265\220"
+	.ascii	"\205\2171\331z\bh\347\210v\326z"
+	.string	"y\255\216\257\326\244\235\036g\332t\230\216\264\340\b\365\004\340\244\3065\2557q\250A,\312\030cHHD\202\204\321$\205\341`\002\0219Vw\021 =\247\234!QX4\355\237\001?a\3647rw\002C\346\256\271id1\254P\304d\306\205\300\\\274[\223\030CO\331\363\352\\\231|y\242\302\233\314\352\322\256se\306\226X\314\001\224\334\374CPuj\371\360\225\367\\\302U\t\314q\335\320\212)\205E\030\302\264\3724\rx\3250\021\271\2468t\003\221\321( \273\333\335\346\020rX6M\231\373\203\263\374\026\274\355\006\356\360O\202\037\305\242\330@e!aW\311\202\002HB\267\236\203\210\347\333\303\021\247\233\013\341\364\212\236\221L\334[\345j7\240\365}\316>rB\256\206YL\306o\202P\036\317\r\034d\325I1\362\r\034\325\021\006@\355.l\240\331\234\221\f\253\301\252\307\025\325\373\351SB\\"
+	.ascii	"4\377\245^\027\001\"\006j\264$\361g\230\241\376"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.33.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\203\001\235\017"
+	.string	"\006\236iE"
+	.string	"\217*\035/{\017\265\"(\261\210\320B{\336\3601\240\224\351\034\370\3141\366m\304\031\342\224\343Z\321j}C\315f\2465\352\246aET\325/\275\370\235!ZAa\273G\260\201#\034\240\201|\262\267\224)\005U"
+	.string	"T"
+	.string	"T"
+	.ascii	"\346\350.\017$@9u0\006\333P\2201\251\271\230\023\364\326\203"
+	.ascii	"5a\030\206\217\340"
+	.string	"\0355u\031WS\376\207\005\306\365\221\\F\r\013\006\"\343c\305\317m\306\345\265\353\353Si\024q\362}\355\221\304J\350\372N\256\232\006sN\253\353\263ps\267}\262\275\300\276-\277<\355\216\007\357\325\313\356\003\330`\241\302A\2139a\341\213\031#]B\330F\331\034\333z\3423\324i~\211\032s\305!\3262\347\354\260\202\356\222@\\\265_\342&P\007G\004h\314\325\254\002\002\360\001\270\313\356\033\334\245U/Ky\347DA\3212'\330\021\217{\225Y\212\225\336\354y\334n\031\254\204-\2248\347\234\321\234\325\355\254\276\230`\270m\202H\367\301\037\341.9\2532\257\f%\032\332\300w7{b\261\265F\2504\\\033\f\353\333M\261A\022\375\304n3\336\016v'\2529\007\357Mw\332\2579\370s\227\005 \242\217\005\235@\020\342H\304$!$\212\020\352\034\362|\200<J\"\323\203\020\323\310\003\361"
+	.ascii	"\215\274P\311\344y\006\230\024\"*y'\022\251\344q\300\371\030"
+	.ascii	"u\277\257\315\270\260\"\246dUrS\374\332;\030\032bl\247\331X@"
+	.ascii	"e7\334\356\276^\273\334\320\332\316:\252\\\335\227ms\004  \240"
+	.ascii	"\002\241\273\355\3771L\243\371\t0\315|\210\345j\325/\306\340"
+	.ascii	"H\020\013\231\212\362\360\r\247\357\2339\270%\344\226w\336\206"
+	.ascii	"\274\331\bm\030!\2135\214&4ph\204E\324\235\335\320^\236E\266"
+	.ascii	"\230\222\353@\211\230.\361\004"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.34.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\250\003\025\027"
+	.string	"\006\253\225G\300\030Q:t\246\305\245\313\255\374 \301\311\243\362Q\254\370)n\201\261\017(`'\301H\371\\\202\027\372\217\371r+\037V\364\034f\266\253@\236\207\365}\304E\344\377\271\274.dN.\255\177\004Od\t!\233\310\235R\201"
+	.string	"y"
+	.string	"\201"
+	.string	"I>S\245\321x\021TkE`\0053\210\210^\352\323>\356@d\317\215\370\251V\236&A\265\346\020xF<uN\264\355\373\370\017\231\235\344\313\335\260\205'\212L\f\321RkM\0318\fx\372="
+	.string	"x\2726.;\375v\312\374\331i\003&\275\232m\347\337w \206\220\013"
+	.ascii	"6\332\0073D\303\312h#1w\264\321>\003\265\326\357>U\330t\346\f"
+	.ascii	"!\324Z=k\266\0267x\333\031lo\260w(\366\277\272<\366\213\3742"
+	.ascii	"\367\371\t<\310\037\363\334/\340\272\033u\240\377\364\237\337"
+	.ascii	"t!\177i\247Itz\244\323/tzD\247E:\035\3564\030NS:\375\201\323"
+	.ascii	"K\247\347N\277\300\200\240!\n\275ZW\364\270\324'\024I\216\353"
+	.ascii	"~[\346\357<\332\326\205\020g,D\"URd\251\265\316\234\272\202\b"
+	.ascii	"t\2031\241\310\020\024\022~\232<\360\021\021c\252\264\236\037"
+	.ascii	"\007;/\304\001DFz\340P3\\[\003\315|\315#\223p\303\035 \036.g"
+	.ascii	"ol\311r\344\333\033j\301"
+	.string	"\335\032=Bt\301\005\257\230(*\315om\0269_\243{\"%\337M\371\254\265\316\026\006\356n\350\241B\233[L\232s\355\233\016\363\265\335\0052h;\263\335:\022\020b\255\225\201\177\344\302K\3041\002<\235;\356\370\360p9\263\347\323~Q\373.\246-\355\367\273\323\035K\244\224\210\2413{vn6\367\02661\016.RE\266Ve\004\017\253\330+fr\221*V\311\002Y%k]\244*\\\305V5\237\213T\22556`Yc\2638\260\326\232\225\300\303\352\246$a48\260V\312u\263j\245X%,\225@\306/\034\262L\305^\2572\225\253\377\352\362\370\003\217\242\0175\232\241\003\313\316\234\264(l\223\326\020rV\207\356m\216k[\240\241E\031y\247\225\331\027(/K\211t=LK`GNF<\230Y\332\230\025\327\306\220\241\204\220\2704C\250Ad\205\004\310\030$\221H \"m\2129"
+	.string	"\003\021\241Z\007\021`)\205\244D\022%\205\007\003J\236\362\300$\333\211\021\2034$@\326\224 \205n\324\266a\304tg*x^\0215\346&\024j5\342\336\265\241\034\2253y\243d\326"
+	.ascii	"B\222\016A\204\217\201\373o1\0047\223\330\331y\033t\344z\256"
+	.ascii	"\024{\203n\314\003\036\203\267\n%A\365\242\2655\335\267\312s"
+	.ascii	"D\324\033\305\002\316\036$9\025\241Xb\206\271\035\220\n"
+	.text
+	.section	.gnu.lto_mspSerialEncode.35.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\266\r\275A"
+	.ascii	"\212m\004\030<@\350M\007xY\214\035%\330F4\rc\326\f\321\272\006"
+	.ascii	"\"'q\371\200\356G4\221 \t\213\024!\346\337\351=\250\302\025!"
+	.ascii	"\221V\356\232\251uZ\301\035\"\"\"B\233\354\275SJ)j\001Q\001t"
+	.ascii	"\0016\016\260)4\203\357^&\201\234n\237\372'\256\005u\317u\333"
+	.ascii	"\351\306\323\315\247\373O7\240f\235en\275\316\023\204\307\321"
+	.ascii	"&0\266\361\230\211\314}\307Ll\365\231[n\272\276\323y\272O\333"
+	.ascii	"5\224\211\200~\3209\022\223\203\365\323um\377Y:\032s\203m\265"
+	.ascii	"o\262\365\364\236\266\371\220)\231\311{\226\026G\346^\265\030"
+	.ascii	"l\253Ig\nYm\343)c/\231 \035\2305\177\367\312\245\260\303P\345"
+	.ascii	"Y\362\236\201y\222!1\307P\226\251\306\316\201a\363w\357\255j"
+	.ascii	"\225=\260\357MgH\232\274gZ\332,\270\234\"\231\260\332\231\033"
+	.ascii	"N\307i[\316H?\335\273\245\217\237{\345$p\025\333*\313\261\314"
+	.ascii	"\314\335\246\335\264\314\320T\016n-\230\366\245Y\007\323\275"
+	.ascii	"\027K\331Pk\253i\007X[\375.\335\366S\022y4\026\211C!\033\\\325"
+	.ascii	"\364\275\345f\366SP\311\336\244,M\274t\022\231F\370\253\263\324"
+	.ascii	"\206\324\274\244PL\3068\333\214\332\025?\032\213V\232X%U\346"
+	.ascii	"5\225\0315*>lCjmf\324\246\270\020\332TY\232\3005K\025\fv\310"
+	.ascii	"\322\204\255\327\343Z\363\016\315UCjRR\345\275\027\211\247N\372"
+	.ascii	"\323\bm{N\216kGR\250BZ\0365\264=m\355\314=\330\341\336\313\356"
+	.ascii	"\\k\322\f\240\231\233\212\231\2130\033\217\001])\375\276\353"
+	.ascii	"\007u\020=\357\275L\365\337\330\177CO\255dh\"9UO\255\r>\215{"
+	.ascii	"\310"
+	.string	":\341\t\210\271\324\340\205lf\036\230\246\377\346,\307l\257\253T\310\355\177\013\367\210\365?\310\034Fg\256\211\231Ct\244\021\377\033\030\301\361oHN@3\017l\253\264\243\022\354\275gZ\334\214\272\221\2114lkm\347\326[1\372\303\240\247Vf\236\320vS\254\305RJ\341\034\270\0175\242\024\334a\270\355Vp;[\375^\001\305{\376Ey?\263\013\030\336\316\253W\236=\223\271\373\276\244\234\3142\232\217\006{\357\265@\250\205\253\221\345\027\246\310\332j\177C;\005\314\223\344\204b\346\201\314rL\3777\346N\357oa6:\323h\271n\031/Z\240\3302QBD\013j\326\220\241\3614k5\235\356\t\r\250\371\252\345tW\031\235\035\f\235\033\364\\3\203\005\n\332N3\325\321YitNptF\220t\236*:K\025\235\017\020\235\r\f\235\013\030\235\t\030\235\007\034\235\243\214\316PFg\001G\347"
+	.string	"Eg"
+	.string	"E\347'\242sr\350\214\034:\037\213\316F\244s\021\351L4:\017\217\316B\2433;t\016\026\235\327\241\263JtN\211\316?tv\241s\007\256v\373de7\323\305d\274L\031\253QZ)\336N\021\0375\245\256\017"
+	.ascii	"\025\027\023\246uC\002\370\031\214$5\243OV\374K\213\306K\353"
+	.ascii	"\206\364DN\300\344?}{\227\021\311\017\316\361A^\361\2672-\276"
+	.ascii	"\245uC\302i\251\324\276\271[\031\362\203\212\366d\202c<^i;\246"
+	.ascii	"\200~\201\315h\321Xe\212S\031v\3734\276\020\277E\316\346Q\364"
+	.ascii	"\372\001\224:\230(U\311\241\013D\324\324\032^*.\320\237\270\223"
+	.ascii	":\3215\224\212\257\341}P3\2726\327J\374\3427Z\333\021\342w^\213"
+	.ascii	"\200\302\307\327\2142\036\022&d\206\377\306\355V\342\342\204"
+	.ascii	"\377\306}\327B75\321\240\332x-,\363$\264\006_Xu\2372\244\337"
+	.ascii	"\275W+\370F)\023\033\004\277z\341\017\377E\213\037Zy{i\301x;"
+	.ascii	"\205\237\205W\327\007\301\331o<O[\021\005\347I\334\271\344+\270"
+	.ascii	"{/CZ[\255j\3466\256-\343\355l\361J\264g\262\221f\350J\365\354"
+	.ascii	"\307\030\024\210\326v\204\r\276#\361\263`\n8\210\257\031\r\376"
+	.ascii	"\0333\257g\334\254E\343\327\231\255\232(?\265\333\347\325\257"
+	.ascii	"/d\020]3\332\201]\2662\267m\272\023\2476\016T\343\365\203'\213"
+	.ascii	"0Q\352\365\337\242\375c\275z\2511qs\b\251\317\334\276\351Le\227"
+	.ascii	"\032S\033\007\t\347\301\t\230\276\372\236\250\031e\020\001^D"
+	.ascii	"v\260\300\301\025\346c\b\227\212\tA\214`^'\270\200p\341\b\346"
+	.ascii	" \373\220\203\354\303\027\331\262G\227\227\216.\026\314\353\304"
+	.ascii	"\030\016\035+\230\327\211\256\261\256\025,l\307r\314\353\205"
+	.ascii	"\330\362k\b\304\253G\027\227\330*\266\374z\356\272\362\301\265"
+	.ascii	"c\314kyCl\371\205\005\266\203\353\013\253kl\211u%\305ab^cX@\302"
+	.ascii	"\302\306\260\210r\267\177\013\377\320\343\223\244!t\323[r\254"
+	.ascii	"j\007\354\340\271\203\331\037a\262ezo\026\016\320~\372\223\343"
+	.ascii	"\201\374\264\327\252\2409\244Uw^\253xhF\177\276ic\255\232\301"
+	.ascii	"\247\365^\013\335\360\370 Y6*xNY"
+	.string	"\252_\360i\314\030\234\301\367]\337\375\002\273\025\016\340d(i\231x;i|\320\311\235\362Le\247\241\362\374%\211\242\210\222\031\024M=\202O\220A\353\023 \370\266\303r\365S\357C\257\031\3653\315\016\250\213\355\264>\212\312\023)?}\244~\306#\272\003{Z4z\f\374\001<\006>8\307\227\251\200\2359\247{:e\005\276\367\372\201\"\276'\234\013}\222\316 \035\215\243\206\323\364\347\347\230\327B\2678m\305\241^\013\313\324\265\021\213\nPH\340\262\367\264\352\326\353>\355Z\226\037\201G\261\365\004\236\307\246f4\352\007l\231\370\001Q\237\2257\b\352[\317\331<M\274\322\321Z\301C}\214F\222Jp\201>\331,8\361\003\274\200/!\342\005\004\370\nyv}g\317d\013\001\201\027\250\2210\306\024C\246FDD\222$\3110\006A\005\304 F!\352\r\021`\2454J\315\210HR\220\2444\034"
+	.string	"9\355T?\263\322\304\237\r\315#o\335\244\253\f+\255\2227\300\252]\0305\327\223\2126\332\322Q\242xx\260l_Hp\223:"
+	.string	"\326ZD\032\324YO\301\024\333\211!\fQ\021j\207\255\360t\007\241\212\334*\240d\270\204\334\027\204\2027\234\034*\251\377{\336\347\242\342\022\366l*\243\305\230P\003\337\276Qq\212\2330\213\027\227\005\227H=\337\331\017WB\204\276\264\202\275\345\020\204\033\274\026\0344 v\344\342D\2279IH\313\216\365!\312\365\253\006C\"\354\031\312q\225\033\262\304{\260K\337\261\370\204\3743\325\322\267\\tp\250G\227\210\344u\375\375\270W7"
+	.string	"\267:p\337[\200\2467\371\3216\216[\3214-J\"\265\316rD\204\243\0351=\007\212\001A`\276\311@\2427\214+pp&\251\277qV]\200y\216\222\246\375\316\375\2655\311\367\230\334\23021\204\315B\376O.\234\321Q\333\\I\233h\f\0247\205Z\031T\033w\235\r\375\023\031\306!\345d\236<\003\f)\362\364\211\236!F\231(\224\212\"\262m&\255<\f\301\350\303\201z!f\t\307\f\234\024\300\360bL\207\260\276G\330\325\346A\031b\201\340\"\301,Pg5w\316l\336J\365w\236\336{`(T\332~H\345"
+	.ascii	"\230\273\223\363rr\302\t\210\345\027X\270\210\277\350{\b\200"
+	.ascii	"\035b\275\036\354\355\245h\254d(;r\374%k\305\314\fIQPL\2248\317"
+	.ascii	"\242\026\034\325\370\215C\032>\0353\213\322"
+	.string	"\375\272\343\321\360\033\3616\356\bE\375W,\206w\270R\374Y\343\223G\313\t\206EN\031\360\357\266K\340\331Rg\221\241\005\021\366\r\276\202\216+\251\200\025\037\333IR"
+	.ascii	"CL*zL\316\336u\206\3455\201\202\207=\315\251\267\237\242\001"
+	.ascii	"\236\302Z;\374\370\371\353t\237Tz\261\251\246\200\326r\267\247"
+	.ascii	",\367\035k\234\310;\332x\352p\324\301\233\222{j"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.36.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\376\004M\037"
+	.string	"\366u\300K\220\330Q:&CS\253\036\016A\341\221\371\013]\366\351\250O\235\007\200'\201\205\316\371\2061m\304\0070\203Y\3506\347\342\305\240y+\021\266>5K\252\200Vd$\341-\230\013\200\006^\342\033~@G\312\257!\322\310&{'\031\250"
+	.string	"\240"
+	.string	"\256"
+	.ascii	"KY|\344\\\2043\362#A\257\372y\016\026\365,\201u\345\\"
+	.string	"d\342<\376zcL\313|\264f#_\022\013\253\247\310\243\202.\325b\007\270f!\212d\326S2\347\334\340\270y\316\343\235\3626\346]]\034g\326\276\bt#\313\300(\"\254\234\327\007\335\340<\356\356\276\323\237\202:\275Y\211F\003dP\2011\225\314y\235\365z\002\346\361y\033\363\370&=}ym\332?\362%\323\327\226*\374\275\234\361[2\350J2F\200\020X\022 \342\241\036y\033C8dm\354B\316\271\255*4z\343wwOw\253\350\306\027\002=\342H\022M\303C\257\244W\024\236\004\242\223C\251E0\346\t\307Ol~K)q&\"\272 Q\277\304\026\033\212a\312Y\350j?\311\225\230\350+\035\367\t\233\275z\334\267\231\267#\3415\255\033wd\256i\307x\350\025\265U5\024\262g\272\327\237\275:\272_\346\233\243\273m\353\\\352\235\363\365\307y\361\227\325\330\216\321\3306\003\330\306"
+	.ascii	"l\227\247\355\033\263mM\333G\3600X\311/;\252\234\211\316\224"
+	.ascii	"\311YXI\217K\375\306\277\352\267z\331\035\324\237:\325\217G6"
+	.ascii	"\215\325O\231\217d9\007\261$c\322k\201\375\325\251\322 \310_"
+	.ascii	"\375\230\0169qn\316M\200T#+x\177-\273}2O\002\365\225:mJ\235\354"
+	.ascii	"\325\324\311<\256\360\244\204\004e#5o|\214\306\024\323\r\230"
+	.ascii	"\307\332\263~4\357\261\3264\250w\325\314\213\233\230\371*\342"
+	.ascii	"{$\321\264\362\342{\030f\204R\"\347\202\241\274X\210\231\246"
+	.ascii	"\342\275[\354\375\275\327\f\013\002\031j\236g\311p\332;\300\030"
+	.ascii	"\366U\274[G/NT0X\320\002\\9\347\r\277\302\341\3149\323\264Pt"
+	.ascii	"8@T\0022\217\177}^\250\250\303Oy\267\207\376p\0320\273C\034Y"
+	.ascii	"k\332\231\036\307\354.X\364r>\214\213\3554"
+	.string	"\370\240<\031\372\343s\363A\315\235\206\024\273\233N\307\343A\321\034\216\347\003\321Cu6=Tw\033\007\201\305m\205/\207\332z\250n\266[q\323\315p>t\006\241@\363z9\337\314\207\307\363\315h\326\374\326\271;Bw\250Sc\325O\231\363\r\013\267\372\273\212\030\257s/\325U\323Q9\263\261+\273\335)\216T\307N\360\376\222l0\335Q\303\345\200+vq\236\256 A\025\031\330\266@\033\205!D\244';\364+\373K\227j\270\024\020\323\036\351\017{\265k\246\374\310zq\177'\202ua\335na\346\334GiU\t\243\245\005h\301\372V\036\026j\250a8g\0342JMP\023$)i\322\001p\002\021\252\234\007\021\2405ddA\322\322\034EMB\"\362\367\177\231\200\251\f\350\361\213\360M\016\037#@s3\\\241\342g\034\234\262\223k\372\245\261\354P\262\006\353jaQ$\037\020k\202';"
+	.ascii	",\345\3012\221\211!\200\t\365\300m\034\207\027<\326\372\220e"
+	.ascii	"\213\265\272`\200L\0362c\004\225\fQ2`<\231EZs=~=2K2\033\331\202"
+	.ascii	"\256\304\303\243\232\301\315QB\202D\322\245\303\360\n\325\025"
+	.ascii	"\364+\bA\207\271\240\204Q(f\254\177\314\243\225\222\2408\333"
+	.ascii	"B\302\232\251$\016\024\002\215\261\322C\020eF\243*\264\246CR"
+	.ascii	"\254[\277\354F\204\247a\323\240ii\237\"b\356\240E\r\315\020\273"
+	.ascii	"Y\016}\003+\362*\220p\304\237\325.\321\224~\251\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessStream.37.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`C\005\305!"
+	.string	"f\374\321F\200\232Nc\377\256\374J\211\212k6\212\350I\376\333\265f\267\263\233=\3443J\250\344\340\316\0074M\240\346\203U\2134\355\177\202\331Gk}\244\275\035\322B\005\373/f\340\267\216f\343!\230\346\323&{o)S\n\271"
+	.string	"\265"
+	.string	"\277"
+	.ascii	"\246\271i3\371Vz.\223\241B&\324k\354\307\333\275\027\347\246"
+	.ascii	"\177\350\315\004\345il\277\332\307zVz-\027\017p\257\224\031\224"
+	.ascii	"{\217\021\214\203\336\364\361\004\316\233\350\005\2347\235\332"
+	.ascii	"n?\372\270<+\252\245&q\367\336\237\355\341\362\345\361Fk\372"
+	.ascii	"\036\312;\315\322\326\324\027\276W\002@#\202\343Z\230\214\345"
+	.ascii	"\004\243\030\332\273\224*\252 \312\311x^\330\027$\331\270\322"
+	.ascii	"\300\232l\374\344\341t\343&q\246\351\305I\200\212\254j\311\226"
+	.ascii	"e\205\247+4|M\303\362Yv\260=\354\025F\323R\265\357\372\203\271"
+	.ascii	"3,\271(\247\033\257<\235{\257k\261\311\351\236\271\355\243\355"
+	.ascii	"\035\333\004\0065\366@\326\025W\331\260\316Y\305MvZ[ck\031\361"
+	.ascii	"I\251\336\271Zkm\335\222]M\375\001\252/V{#\324\320\nm\007?\266"
+	.ascii	"\002\275\367\002\375'&N\240?n\372.\254\\V\221\247,\255\244zg"
+	.ascii	"\215bhC\254\235\262\217\302j\245\350rPU\331J\3317g\265\315\301"
+	.ascii	"\356\232k\375\276s\335=\232jt\246\232\327\253>\321j\223W]\236"
+	.ascii	"\325\326\254\256e\365\021\234\356-\016\f\013\263{g\334\225\271"
+	.ascii	"gf\024\253\177\375`?\327\255}\373bo\342#\037\006\206\004\366"
+	.ascii	"\005\b\005\324\311\275\322\177\265\370%2\365X)y\273\227I\002"
+	.ascii	"z\363\005.\340\374\321\357\n\276\227#\250q&\254u\037n!K\232v"
+	.ascii	"\352\213\377V]\213w\306X\220\013\305\346\267\331\r}zu\336D;\334"
+	.ascii	"2T\260\220\254\331v\253\300\366\224\343^\341"
+	.string	"\237j\361:\270\311\263\023\240\206\325\316\n\352\305\216L\227\024}Z\236\375\260\3634\236\323\232^\\\222h]\313\355\013G\366d8\222\303\315ik8\262'\275\201\323\336p$\007\003Q8\323\332\036\216%Li\375+>@5+\246-\320F,bcK\034c\226\354\222n\215\265\261\027{\275j#\302\371T|x\311\262\270{\223^\364\247<\371\301 |\352\213>!.e\310@{\304\221$\f\274)\202.Y\254!\243\352\332\225v\312Hg\301`\021\006\243\340\021\222\211\336Q\020\005\320\017\321\031t\"#!k\240\234\024?AEA\243\022DFB?\025A?B?\240\"\243_\316\001\017\021\005\213~GCCE?\032\337[)\353$Y\245!=;e^\025\363\306\332\265\212\363\236\205\321\263VYD\270\326\206u\356\345\275\367\242I\271\267\255.\267\216\260\326\275\322\350\302\224\205g\247xN{\347u<\350"
+	.string	"\336\0216$pn\177\330\037\303L\307\t\341={c\337\365rn.\215\370\324\242\2747\312\302\277\376\267\255zg\234\212Z\237\265\323\252\024H\002bj\365\270T\210O\355\347\003\2656\211&\307\200\214O\316\230\213]Lj\304\247\326@-=\222&\251/\332gf<{a\205\001f\250a(\246\220R\312\251@&\020\t\304 i\fP\002!S\205\346\001\020H\211f\246\240 \351\314a~\211\321\300\301\224\224\223N\241\020e\373\275)R\005\332\222\303y\261\224\020\214\301"
+	.string	"\235\201~!\t\232\265\344S!a\023\347%H\351\246b\275\025\003\312K\013m\211\026\n$\316{\377!_\243\237\303M\023\201\265\345'\223\320\275\374\353\007y\037\276X\376\350\372D\207\365\265=0\222\013\004\033\323\326\025\331\020\233\327\013;\036\314\224\333\246r"
+	.ascii	"A(\370h\035F=-H\033\327\346\302\345<\031u\230\312\2721t\357\202"
+	.ascii	"\202\321\330\304~\001\332;C\326a)E\026,\017T\233w t\372eQ\234"
+	.ascii	"\213\330\204!\316i\326\366\315\r\352\n\020O\210\n\371\267\330"
+	.ascii	"m\356\352\335\301\231\370\321\211\020/e8a\225n\300\340%n\210"
+	.ascii	"]<}a\365\007"
+	.text
+	.section	.gnu.lto_mspSerialStreamPayloadMax.38.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\265\001\r\021"
+	.string	"f\241vG\340\360&\035\333A\323\267\357\n\370M\034\370\024o\320\247\316qu2\200\035\311\3673Is\256\323\322y\006\354\333\354\363!B\322\333\337\265\332\301\003s\210a^\206\306\035J\034O\214>\260`\373\350\306L\306\336D\312\224\002d"
+	.string	"["
+	.string	"d"
+	.string	"&\2076\361\016\rt\376\211\243\260qL?\021=\361\005\224N\222\224\224\037+\300K\342\241\236$\036.\321c\217\260[\215\371\262\307\0133G\253\371\034v\b\202\230>\214\3248t%NB6:\317\347\333%"
+	.string	"Rj\032\251\341t$4J\b\375v\335\251\315T?P\244\224VZ\315\303\375q\333\023l;\260\365#\277\375\300ON\007\320\215N\373\223\351\332\354\357\234sz\207l\253C\242zu\334\r\362\357VY\r\243\272\203\352\355\324\027)0\345\264!'%\317\344!g@\030$\216\373\277\253}\373)|$\034\215\f\236\251\006\336\341m\033\377\346\225\321\217l\376\325x\262\036\257\005\317\016\034R~\0014Q\265 {\244C\251\231\313\t\232\375i\004\223\r\nxMT\355\200\243\033\270&\021\335\265%\270\3644\325\376\007\004\316\312lS8\013\031\006\276\222\206\026OJ\371\242\303\335\005D=L\030\251\023\222\213\032\335\332\256>1\204\226vm\236\211\337\b\270'\034\335a_\305W\314\370E~\275\350i\207\376K<\374\006*)\332\312\340\202"
+	.string	"k\261\260\310<\300\020\023\342\225\223\n*.X\013&\305\005\246\205e\301\245\322\302Z\201\301\260N\b\370\345\322\202\261b^/\030k\365\311\357\220\0175\243\240*\304\354\260~,\302\335\261\r\327(7;\353\244\2242\2566d\177;I\223\312{)v\273\332\347\344\230\3514\310v\253 Ig\n\300\2343\352\001\033"
+	.ascii	"\3571*&\264\250F\202\352\0044x\005!\003:\330\320\202\320\"\303"
+	.ascii	"3rZ\006\303[\366N\201\342L\350\003|\003&\227\341\200k \270L\221"
+	.ascii	"?T3\300\211R\r\034\027E\212r\215p/ \202\306\240\240"
+	.text
+	.section	.gnu.lto_mspSerialStartStream.39.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`e\003\275\026"
+	.string	"\306'\217K\260\022R:rxw\313\266\222\227\323\244]\260\274\362V\370t\242\226\3755\036\222\205t\034\365a\303+\002\373\024T\265\214\361:\351+\231\365\205\243\250\200\367\317\362\2449?\214%\371zzo\\I\3376\257\325\230-\371d\023\271\223\fx"
+	.string	"o"
+	.string	"\177"
+	.ascii	"\017@\276\226\037!_w\267;\365\023\250I\2028\314\b\213\335\035"
+	.ascii	"c\022\313\037\317oIwo\225,\262\216Lw{\026\212\321\007\230N<\251"
+	.ascii	"$\037\314[\243\210\r\017;\243\001\036-G\344\230g\351\234\234"
+	.ascii	"y\371dhu\371t>\216\004\242\204x`\276\r\343\310\3160\352\302S"
+	.ascii	"\033_\217\362\217^}h\212EU\"r\314S\026Jw/\255\361\345|]\337]"
+	.ascii	"\242\335e\260\313\262W\334\3350\314\277\335\023\206\276\371g"
+	.ascii	"\027\366\363w\035\370\267\036\374V\026\335\221\244\313\225.\035"
+	.ascii	"\351>$\302\022N\007\337i~t\343\\\001i\250\332\204\342\301\357"
+	.ascii	"^\370\025\373\243}\275\356\001\004\273\007_\3362\375\002\024"
+	.ascii	"\204C\325}\226\274\256\202\362\365\257\335\245\247\216D\244{"
+	.ascii	"\301\233\223\323\335\027]\305\356\300\f\007\320\375\363\264\324"
+	.ascii	"}\026\330\222\362u\317'd\350\\L\342\320S\fv1\211D@z\023%\024"
+	.ascii	"\242\362\217w\037\034\306L\366\302i\304Q\263c7\345M\263\"\323"
+	.ascii	"\022\363S\230J.\336U9Q"
+	.string	"'3\225\206\224\206\032L%\"\020\313cgxc\344_\213)\337\2029z\324jwiO\262 3\207'\273\213\341.&\274\307\034\016uw\002\244\267X\331\233x]\n5\372\032\033\371JYf\016\253\200\225\317\027\276\366\230C\236\024R\220\030\032\027h\022X\032\344n\266\226\026\313\202\332\214v\313\341\312\334\315\346\300\265*&\025f+7\032.\245\005W\213\261\254\314j1\225\033.f\"`m-\264[,g\263\335b\257\263\377\346\2375z\311\342CWQ\3050\257\305\277\r\341a\301\270\226\240k\263t*\250\243G\255>vw\227\374\333\027\2622\214\177t\b>4W2=<zEY\327\2215t2\223X\2441\203X\354\261\304\344\003\212\344\337\272x\344\007E\250A@\303\020c\002#2#\"2\023k\003\300\002\221\"\343\006\020XG\"\245\240 \035\245\377KJ\376{\325\221q=I\322\267It\227"
+	.string	"n\2146\271\206\374\352\200%\205?\270?\001\312\240!\234\020<\255\307\344K l>x\303`\333)\277\233\201\233n\021S\022\354\nm\350L\270\261\311\036\030\330\352'm\336r\024\367\307\226\204\004\377\232\260\310\351\231deo\246#\307:YH\006\023\002LUT\372\t\202O\205M\321k^"
+	.ascii	"\fQ\324\310\253?\365\341\023,\347?"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.40.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\016\002m\021"
+	.string	"\366\035oJ\320\262*\035\220\360\007\tb\206p\277\243S\016\025\213\336CN\b\232YT9)\207\310\240\2770\201)\266\300\030\333V\213@\376\b,\275\300j9\204\bW\350\n\037\002h\341\353\307p\"\374b=$\205D\202J\b!d\357\224\002Z"
+	.string	"S"
+	.string	"^"
+	.string	"\342\013\200\377\254\262{\020\260\354\352A\r\305\013\267\333\335\261\232\270\352b\b~^\245*\177u\221\246\026\236\307\213\354E\301\0061\265\357\003\310d\241^J\315\346S\"&{\365Lh\314\032\001\246\313\013\320\242g\305eN[\314\026\245!\312\356\232\302\314\330\r\340\266a\266%\3304B+\234\213\031\037.\032\304>[\264\322\354{\273\273\2563\373\267\377\373\371W\217\372 \021\026.\346a;\273!\206\b\331\035\037\216\n\333\007\331\256\3246\201\240\372\251\362\001\333\352\001\302\301\251\375\030\217Q\375\266r\002\273\263\035\233\335\223\201I\304\177>\177"
+	.string	"\374\027T\206\256e\004Xi6^\243\303\266\340\206\316.\367c\225\343SPW8\236*\342\306\305\307\243?\201v\3515N\342\356\236\3704R(\003'v\3670+\340\277\307d9;\222\3733\2163\016\037\306\035\234\243\2079\007\376\253 \313\261\375\260\350\020\363\244"
+	.string	"\362R+\315#W\001k\275\314G\002e(\303\204\024\322\303\210\024\221\245H\252,Q0\241H\241E%\033B\243\222DY0\241H#\207Q\2104\212J\324X\222\300%\023Y\216\251R\251\034A'\353\336\326\231\215\302\252-\361'0\247\333\375x\346\005C'\254\257\027L\036\007\203\270\353:\361m~3\262\006\022=\214TOB\246{q\0132 \260\002\021\261\263\003ob\b\305{)\262\243\201\374\262o\301\f\202K\250\216\276\236X\340\227E\262\314\255^\242\005\2539lk\304S\f,`<\2676$l\227\370\031l\261[IVpK\004\022\2702Y\217\226\214\"6\246\361\2178\036c\033\271\003\242\030\334\334"
+	.ascii	"\030Ex\211\334\342\306i\f1pI9\004=\327\301\2611yy.\261\007"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.41.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`}\002\275\023"
+	.string	"\266c\177I\300\224Q:\312\271\210\330j'*(\304\004\325\f\265\032\234*k\3773\354>Sb\3726\303\n\t\314\221\316\203\375\203\233\351\362\250\373\0262\007\207\253\344\232\311\266)2\215R$b\307 \347\377E\360\3459J\322\b!R\246\024p"
+	.string	"`"
+	.string	"m"
+	.string	"\342C\303\354\037\n\315$\033\344\204f-\216\3149S\253s\330G\223\030\202\2530\237\374\310@H\316\364\335G\"9\2378+\251\325\210''p\240\360\001\234\020\266\r-\344\212\206\340\330\330\016\202\tnv\210@\325h\300\023\037&\220N5\231.h"
+	.string	"G\"\tU\213\201):z\263\357\256\036j2U\023\313\234\323J\253\331\334"
+	.ascii	"n\333f{\305V\235\343\234\323\201\277\002\003\207q\347\241/#>"
+	.ascii	"\374~w\220\310\206\224\244\233\321\322\346\221\2729\366\267,"
+	.ascii	"\313\322\213\263\257\373K@\265\250\352p\325\340\252w\325\252"
+	.ascii	"\352\243\002\350\220j\377P\316\t\242\\\232\275\220(\305\311\366"
+	.ascii	"\325\276\317\177`\327\311|\300\2348 Cs\362\026X\301\370\320\274"
+	.ascii	"\237\210\017\307\233\004C\276\r\r\3023o4|!\377\306\207\377m\346"
+	.ascii	"z\360\330\227a\373\267b[\352\231\223\374\215\322&\202\323M\246"
+	.ascii	"I`\274\302\225`\373%\345\214\350\231\t\265\350((\th\364\225\b"
+	.ascii	"\356\352\200x\310Ti\301E\371Q\303\023\363\205\273X\355^\350\250"
+	.ascii	"DmVKO\323\275\221[l\311_\251D\031\264~\211\337\n@G2U\262\275"
+	.ascii	"\341,^\0011\256V\004\230\027\313d\225J\006\227\225\353\345\325"
+	.ascii	"\002\363b\2454\254\\X)\225\353\225R!\340\026\314\213+\025\323"
+	.ascii	"j\271R'\336<8\027g\335\230\037\343f\001\347\234s4Qq\355\t\024"
+	.ascii	"RdK\332n\371\215\016(_\001\237\270\020lET\274\306\377\302(\207"
+	.ascii	"I\200\332\252\027=\315\367\031\355z\261%\375\031W\371\364HE\362"
+	.ascii	"`\366\263#n\216\0373 p\202\221\271\273\003\0371\304\361\332%"
+	.ascii	"\032\206\376\213\312\364qQ\331?Z\301p\313\302Zk\277\213\363\234"
+	.ascii	"\315s_\332\313F\363\323Y\204\234\234\300\026\367\2164V\237,F"
+	.ascii	"\303#\246k\264x\224\227x\003\023\245\277\240-J\323\357\021\\"
+	.ascii	"\340@W\273\006\322\201\013\235Wp\310\272\301\254\361\023\327"
+	.ascii	"\260\253yG\213.\001t9\260s\245\211\310fMq.\331\241\325%\013+"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.42.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\324\001\315\020"
+	.string	"v\237oG\360\262&\035\242\247+\204/C(\371\373\n\313W\301\320\b\263\375f6\220WLj\356\214]\211\374\300\330J\240\316\031\242lt\264\232\266\036 1\002\272\212\336\036\205:^0\020t\347A\002\343\323\272\212|\262\211\334)\005W"
+	.string	"U"
+	.string	"_"
+	.string	"\373\201\344\323\f\266\317\227\244\310\241DZ\230\035\033\356\322\376\212\263p=\247\345#\2730\241\030\273b\002\223l\237\026/@\373\334\036@\373\264\313\026*u\330\227\002\034 1c\217\335\345\264\304]\227.\377\343E\302\231\327e\310\202\335\265\fg@\334z\333\007l\237\330\362\024.T\376\215?\252\370\341'\351+\3553\205&\346c\310E\306l\361%\225\204\375lw\327\n\263/\376\243\347\374\333&=C\2443MZ\247\264\314\244O\032\005\345\230\271\f\217]\231\330\217\005\2323L\234\347\267\377\321\"_\347;\256\363\264H{cE`8\261\241\r\266\203\217\020l\312t\352c\202\270Dx\215\t\231R\250\351Q\265+\234\206\324\253\252\002\361p\342\305\026.\343\302&\36545\243\212\234\253\215\341?\240M\366\351#\312\246O"
+	.string	"#db\241\016\337g\303"
+	.ascii	"\233\320N\035F\267\355\256\351\005K\006\0028nZ\264\317\253\350"
+	.ascii	"\205\346'\f\241\222&~\213\007\255\025\257\373&\313Ik\305\353"
+	.ascii	"R@\260K\261\276\007\036\270\032\361\300\225:U\262\202R}\035x"
+	.ascii	"\362\300\025\307\242B\255\270\324\007r%\006\314\362\272\217\323"
+	.ascii	"\300b}\234H\334g\2530oA(\200\\\364\305\255lW\204\311\220\016"
+	.ascii	"\212f7\270\r\224\221\215\204\032\237\024;\n\310\367|T\331Fj\004"
+	.ascii	"A8@0\372\362\324$ `\202!eh\007\257\030s\274\251\302\025N(\320"
+	.ascii	"\005\226\367r\026\033sL\r\265\274\322\301\036/\267%R\275n0\023"
+	.ascii	"\345\213\230B\226\220\276w:\271!66\f2\214F\333\233\211\211/\226"
+	.ascii	"~\262\375\303\2151\330e\231\365\3061$\214\022?\"`\243\200./\332"
+	.ascii	"G\006"
+	.text
+	.section	.gnu.lto_mspSerialProcess.43.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\277\013E;"
+	.string	"\372bx\026D@\"V\007S^8\244`&\301\036\016\365r\255\266{\216&\"\257XO\261k\264\007\rV\372\005r%n\271\007\334x\200\360\003d\202N\321\237\317.\356?\347N\200\214H\226\244\374\377\377\377\377\336[\312\224\002R\001=\001V\001\332/\223\337l\207\221q~\236\205i\360=\354Z\337k\367\027\3731\371\311z\370o\236\263\334\214\231g\355\222/\360=\254\364D\361\303\357\037\343\207]v\257{\355\326l\224\345\202\246\341\315\363\214\334Q\374\350\373_\355;\322\226?"
+	.ascii	"\322\221\021\200\"\242\241\243P\220\261H\034\n\203\300\237\257"
+	.ascii	"\027\303\357\326\262\177oC\332\277\327\255=\321\251\363\003\274"
+	.ascii	"F.o\003)\215\004\245*\354\217\214\300\2764\200\"\242w\200\\\033"
+	.ascii	"-\317\225v\275\005\252O\302\274\227\264\212\036\342J\251\260"
+	.ascii	"Y\351c\\5\345\205\202\272\336\370B\230\302\253>W\272\365\n\373"
+	.ascii	"@\341\274\227T\212.n\353\234\030XV\025\225'6\261\352\341\233"
+	.ascii	"a\354K\312s\245\\\3576S\213\303\322B\002YU\325\017\276\n\354"
+	.ascii	"\336\364<WZ}\211\250\254D\337K\312D\003{\033\262d\303\334\311"
+	.ascii	"\252\342\372\337\025\334\023\360\222R\265\017(W]\233\362\275"
+	.ascii	"w\302\264\355\353W\207e-8\205\352\370U\342J\255\274J\363<\007"
+	.ascii	"\247@4\034\225\355\272\223U\005\366\357\033\201\316\364\2128"
+	.ascii	"\235z\203G\352\342<\333\353!\323\247\336\277\366\360\365j+\306"
+	.ascii	"'\253*\354uo\303<\317\256\243\323\252w\001\357\256\205\356>u"
+	.ascii	"\007\026\005Vp\336w\212\365f\236\311y\352>\356\236\342\3278\271"
+	.ascii	"\240\306}\315\363<A\315\212\027\243\236\301C\363iT\304\017\353"
+	.ascii	"\355\202\032\007F\346\037\247\342\300\\\324\335y\374\231\025"
+	.ascii	"\310\255y\236+\224y3-\374\251<\354/`\350\217\302\210\037N\332"
+	.ascii	"\233MT\t\321\376\375l\017\213Q\317\234u\325\002\375\320y{\236"
+	.ascii	"g\347\336Xw\255S\377\274\265\334)8x\263\177\344\243\375/=\331"
+	.ascii	"\377\202w{W\360o\357\t^\314{\322\203y/z\265w\"\243\366!\240\366"
+	.ascii	"#P\273\220P{\020P\273\261\250\275H\324N\374i\037\016\265\013"
+	.ascii	"\207\332\203C\355@\241\366\037P\273o\250\275'\324\036\013\265"
+	.ascii	"\303A\355\033\250]\377\264\277\005$5)9\264\354\224\335\325\316"
+	.ascii	"Ty\177\346-\f\327\365n\377o\377`\376\305\374\253\271\177\233"
+	.ascii	"\377\230\207\363\340\333R\311\251\235\251\212rU;1<\251\317\255"
+	.ascii	"\306;[\315[\256\212'\366\005\375\342\037\346\331<(\246I'[Ev\007"
+	.ascii	"c\3038s\347\237\336e\303\224\276\367\342\277\346\301\207\375"
+	.ascii	"\201\004\371\325p\374\fd\326\261\225\245b7\317\332\005\017\273"
+	.ascii	"\f\337\303\037D\323\221F\004\205\016W\330\t\366Z\334\330k\254"
+	.ascii	"\201\270]\321S\372Y\245\352\371\272\373\241\363<\202FRe&\372"
+	.ascii	"\243\0166\274\355v\331N\3510\3220\242\334$.\356\347b\351Yn\362"
+	.ascii	"s\266\341\345\005*\356\227R\355\200\221\365\346ha3\034\276|\215"
+	.ascii	"\211\373\275\344'\357G\276\366\312\332\356\372\360!\356\034\324"
+	.ascii	":>\302%=\214\"K\321\037\365a\034\024\3714\263\022\334X;/\fn\340"
+	.ascii	"\026\356\r\bj%\365=\342\005;\270\343:P8\251\r\334\301+\226\033"
+	.ascii	"\364J\201\376\355\244*r\227\376\250\202\2554\265\235\236`\377"
+	.ascii	"\366W\251]\004\332\227\225\265\350\217&\330\277$\217\323\360"
+	.ascii	"\255\355\013\317\035\337\3764\324.\030\320\310Y\236\226_2\356"
+	.ascii	"\355\3672\240\223\300d.\372\243\275\375p/4\327M\262}n'\0264\020"
+	.ascii	"\235oc\271_\347\004\\\306\366\207\316\234\277\242\272\301\273"
+	.ascii	"\213\267\273<\366r\344."
+	.string	"p\031\033\336\\\367\255\023\305\223\244\3359x\320\037\215\367\213\027\007\320Vj;\335h\013TLoc\375A\304\360\326agt\001\264\336\356\"F\350\217\302\373\263N\236\333\371V\264l[|\"\336%\376\315\t\261\355\212\340\033\266,V17{\303olv\3261=\026\244\213\005\277\326yg\275\233\355\tM/#\371d\243\251\\6\371\242\230=\345\207\250\346\322\230#)C\031\"\212\271\204\372)?\350\240\001\225D\021\244\374 C\311\364\364\264\344\320l&\233\226L\023P\315\247#S\024S\007\250\346\b\345\222D2\212\311\006\r\246\033I!ob@\203i\0063\331\214\001\325|B*g0=!\233\230M$\003\001\276\204J2\221Q\313%\023\031\324\316\277\265\322\336\347\345m\313\307\356\307\226\n\260\261^\274:\242\260a.\355C\\\327\235\375<\3173\022\216\230hS\330x\250g\244\272^\254R:O\037\371"
+	.ascii	"D\267d\373\224\202\206&j\344\214\2076\363\214\316G\236\306\312"
+	.ascii	"N\270\254\314\226\326uh\263\270J\003\003\240A'M\311\320\237\353"
+	.ascii	"\346m\237Zon\336\2120\350\343\366\242\355JN\234\340\251\033\235"
+	.ascii	"&\326\343>\002\204\346\202\026*\"S\245`\342tE\025\332\3057ns"
+	.ascii	"\32612\240\223\265'D\033\353\317\366\277\273l\030\324\355\250"
+	.ascii	"\227\374\303\375[\001\302%\020\321\301.\332Cl\304E;\001\221@"
+	.ascii	"O\362\310\321=u\237\243\022.\327\020\234\017\332\034\214A\273"
+	.ascii	"\205N\3424t\266i!9b\\r\266iU!3&\315qcu\222\352\227\""
+	.string	"BS)\025\005\275tDN\262\327\272d\266S\333\371A\204,\t\322\320'2$\372ZU\211\030\277w\307-\200\340\250a0\006\215bhfFD$I\2224\006\200\002\221)+\326\001\021\020\2554N\021\005!\251\235\003d\363+!\336\260\2273\252\037\272x\f\202\217\267\017}/\025\306\031*\371\300\234\361W\005\t\205\243yI\227z~K\3561\213\2707\303^\244\355H\272\027{\377\033\206\344Eu\211\300cW/\030U\311\004q\204\270\204\227k\n\030\327\332Aa\322\2653\214\372\f\233\236\025\354\2511\331,\241\343\002\253\"R\004\311\230\261\023\224\276\202-\3117E\002\270\023%\304{9\360\335\217r\365\355\247\321\r%\235q\212T\212\371\002\267\216\236\360\337~\2074d\350Y\3450\013\206\370&\203\017a\306\007\\\253\270\312v\376(\0231\223\363\252\213\3323DW\333\036\367\024\370l\r\255\363\255\017F\315"
+	.string	"\356F\216\322\023\246\320\2077a(\t\360\021\310\252d;\3501\312\315\210"
+	.ascii	"\240\215\234\322\204pL\274\177\3437.x\371G\246G\367\352>\256"
+	.ascii	"\255\030\351@\333\364xT\246\200\270M\377J\222\246\022\210r!W"
+	.ascii	"\331\255\3642\177Y\305r\307\2454;J=\215#\316\r\251\305\201\357"
+	.ascii	"\220'~%\246\340\001p\030]\024o\346`\030:{z\020V\234\021\230\225"
+	.ascii	"\023\252\342b\254R\001\2504\203\264\r\200\264\277E\2151\305\342"
+	.ascii	"\031\254KKf\352\b\264\2161.\327\b\377\345>1\006\030B\201cm4\243"
+	.ascii	"j\301\344?F\245\021\252\020 ?\235A\371\032\022B\360D\200*\253"
+	.ascii	"lH\306\016E\024\202\366\351\260\243KAe\0241'D\224\307\021\273"
+	.ascii	">\007M\337\241\346\224\340\035\2660\311\317\276\017:\272<>xw"
+	.ascii	"f!\255\242\217 \205q\346\017"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.44.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\333\001\365\021"
+	.string	"6\341wH\320\362&\035\222\310\"\367m\036\342\020\301\023\t\253}A\003myV\310\213\231\261\227\265\007 \0072B\343d\341\275Y_\317c\305\002\342W\200\354\030\004\344\005\247h\f\304?[\037\321\003_\362PA\227\374\233%{K\231Rd"
+	.string	"_"
+	.string	"c"
+	.string	"s\352X\353\343}\324\335)\205]\225\362d\\\205\371\261\253\242"
+	.string	"\03168\021\201LS'n\356E\0077\241Z\b8\213KT\264t\02468*S;5\0344\020\304c<\340\024\024\206\200\034\342\200\034#\247\347\2563`\214\356q7\020\036\311f\270"
+	.string	"o\256)\2229\247\225\006~\270An\333\307\266\002\373<\002\265\0302?`4j\347\234\261\335\036[\027\323\3234\225\230yy\354\225\325\362\267;J\365F\265\256\372"
+	.ascii	"*\300\250\241\001_K\232\263&\312\307d\222J&~\273\375\334\207"
+	.ascii	"|\234W\227\277\271|\316\246\206\037[\230"
+	.string	"cN\235\310\245ET\227\267_\354\225\023,x1\354\272\237\032\0026\034\231\026P\001:B(\365\360L\274\335o\367\024\242\272v\213\202\236\266{\032O/\230b6f\365\340\024$BF\235\271#\356\0359FM\361-\236\356\267\253\021\243=l\243\234EKI\210$4\347d`{\303w\026>\024\036A\3159\033\2548Q\212\017ti\027\006=\355\322\177y\227\272%!R\n\\\334\357s\207\260\013\031Z\023T\036\260|\256\025\020\237\214\\0A\371Z/\t+\257\024\226\n\212I\n\353\344{\261F\n\330\265\322\372X,.\327\307Z\351\346\227\307Wq\225\r\033PQR\312\207y\317\035\004\310V+J\222?\314\223rM\002\263\262\016\252\355q\200\320[\255$\241\236\321\033\217s{\354\342\305]\355q\217\260S[\232\351\3104J5' `\202Ae\311\003\257\030\035\207\026\375\020\345w\363H\251\361\3164-"
+	.string	"\005\013\034\033\233\265\367\230\373\266\331,dm\314\321\036\005y%+\233\006\244\267\025\215\226\021\r"
+	.ascii	"\033-\n\277\021\211[\334\312tqT&\307o\243\274\200\306\366Uw\230"
+	.ascii	"Ru0\264F\354\327>\021\367\272\372\023"
+	.text
+	.section	.gnu.lto_mspSerialInit.45.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"}\007"
+	.string	"\"\01647@\215\222\016<\257Qq\2277\226\3271\267zu8j\245X\37230TF\301\242\276\344\307\034o|\023\021\026\177\3030\260\216\327\313\354\021\257\375\370F\034m\237\020\231\002s4\f\033O\326\t-\200B\237\330\340\331|\"'\013EM\301\030\250\223\305\007\f\313b\206\313\302S\300J\245#\301\322\230\367\230CJW\202\332\327\2730z\311\225\320\202\224\023\r\2402I\335\256\252!\020\227\243\326\021\242\327\255\326\025]\265^b\342u\373`\205\322Q@\3559\355\301\214\357%\341\351/\002\035&\246n\214dZ\264\260dg\221\244\376f\036\375I9T\022x\244*DV23B\215\216\372F\267\037\305l&\255\017@!3\177\233\351\242\303\376\006?\302\257\n\n"
+	.ascii	"\357b\314\204\326\342\270\227\277\212\ba\030\327D\267\020\360"
+	.ascii	"\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_mspSerialPush.46.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\375\004\235!"
+	.string	"\266~\331D\200\236M:Q\340\320\323\022+\253J\374\253\2644)\307\013Qd\001\232,@!\030\315\221\333\023\376\2433$\235\246\203\366\360\354z\243\256\022\242\204E\005\225\226\300\310\233\007\335\247\350\243\347\331F\244\021B\344N)\307"
+	.string	"\267"
+	.string	"\310"
+	.ascii	"\377\3421\237\265b\235\205\325Z#\270\302R\373\304w\371\275k\307"
+	.ascii	"\005\324"
+	.string	"\312dM\216h\232R\233\202\205\337\271\236\274\265^e\t\253\225\030\301F\346\311g\271\226\237=6\022\237\004\211\206[\250\300\004\252\265\346\026\274@yr<\201\362\344:\361~$\3366\372\373\315v\232\265\222\034\227\376\374\332\206\257\203\210\222\322\007\030\204\372m\304\315\021\202d\234\020EmM\254\204?\031\230XVG^\263\260\206J9>\270rCd(H5\026\220\223\265\347\026\234\242\244o\b\346\007\313\312\310\307\261\302\236\240p(\350c\274\r\341c\3663\247UA)\272\007\273\212\341\227\037,+\341imC\255\325\024\030\264\272\001\3346\032\3332\354qK\236\221D\017<\351'\225'\207\366g^\202\316\026\031\260H\017\232\266\265V\250]-\233\bE_\227\211]\224\340^\277\201s\375D\377\362\017x\327\217\273\330=\3641\267\3554M\352\232\215\272\\j\362\244\036M\352}\230\233\326\250\257 @\026\260\340\241"
+	.ascii	"\2525H\032\241ZF\212My\330/\366\217\371\303|\264o\237\214_\374"
+	.ascii	"\0311\247\007"
+	.string	"\367\f\305\240\325JlQ\346f~\017\303\201\253s\352Ye\350\006\255V!*\210\bN\240\274\030\037\314\267\223c\002\r\277D\230'o\377\374/\337l\207\361\330\253U\375\217:C.h\265V\243\223\3760z\345\030qU*\013I\0063deS\013\345\332\332 ^|2\260\265=U\241r\355\020/\216\360\321\211\266\334\223k\223x\236[V\224;\300?\343\342\226\334OU\211\242i\036\260\343\036\240\023\245\017U!\334\332&~g\207\217l\024/\246\360\321\3113\311\n\252\301\247\363:+\374-\277\310\302\270\267(O\272\020\362\301\202\366\342\022BVjgfz\314J\242?\225\373\342eO\346\343\360\200a\326Zw}\302=X\270\350\226\037w\224\220\253uU\027\353\356\002d\244\316\270Z\276Q~{^\362H\321A\266c\374\315\r\027B;Gnv\327\"\264s\205\315\333\350\312\223_\027B;\202\270\256F\327"
+	.ascii	"\017\320v\215\223\355rOj\255\027\306\236\206"
+	.string	"\347o\235\f\276\036\323\211&'\245\032\r'\034M\243\016\036\322R\b_\217\251\351\364\361z\273\304\224\344\333\361zIH\347\022\317FM\347\323!\215HJ\273\365N\202\r]R\217\347\024\243\311I)\267\224\244S\312\355zN9\tEfj\342\365r>&\246^\356F\254\037m\347R*\240\354\254MY\217\215\272\255\226\003\2609\213\036dj\315\0255\272m\253<\236\346\376\353\007\342EV\210\032\375\334\252\b\2679\360\223\306\211\027=Rt\320\307Zk\265\215\346\371 ^o\270j\t\326\334*\033\302m[\264\007\373\213\254-3SWQ4\215\236\030\204fX\320\272\244\300\211\022c\256\226m\034c\255X\032\320\272h\232\027P\237Cy4/\2620\207\326\356\340\201\036\230`\037\350,\\\250A0\244\bDH\031\031\021\tj\244\3215`\002\221rW;\020hW\242\244\320\030\240\234\237\376\215\316\200K\035\202\350"
+	.string	"\277Z\226-\031\b\016\363\021\315\212aG\260J\314\016\231\274z\250v\362\006O\212\371h\251$\303\260\0018W\372K\332%\035\025g\234\213b\252Z2\207\334c\025\n\274H\3745O!\234W}\314(\304\007F\036\234\213\242\373\222\272f)\210\274\025\213\206c\266\334t\206\276\0226\245\300\226:\227\242>\336T\001\310\320\201=4\024\304\351\f2\233`\017(#\375\005\274\200\230\315\253K\305.\327"
+	.ascii	"(\373\242/c\242\021\227\030\314\372\202\366d\256\3316,jP1\271"
+	.ascii	"'\326\211\204\210\213G\342\343aL\302\374\001"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.47.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\b\003\335\027"
+	.string	"\306k\234I\240XU:\200\274r\f\004\276\360+#\276\305{>\343}\317\311\026?\207\247\031(\243\245p\235\213\314^W\321z\223\202\334\373\026\210=\201\2400)\254\303c\337\016\017\257\027U\231=\036\203/\340\343\276\242\255\021B\366\226;\311\212"
+	.string	"\177"
+	.string	"\212"
+	.ascii	"7\250\2129\fy[/\200\274\355\031\334\257\301\263\211\306~2\225"
+	.ascii	"\314\222\264\265i\214_\326\b]\002-\307\321-'\373\251\2760\351"
+	.ascii	"iQ\027\320\250\311\200\f\335\356%\227\334\210\032s\243\207\005"
+	.ascii	"5\033HJY\021\374$Iq&=>\025f\to\212\215\222\237\261\270-y@C\267"
+	.ascii	"\234\212\327\312`Jn\347\222#QO(\214\210n<\305\345j\264?|\205"
+	.ascii	"\337\026+0t\273\323\262\346\336\313\364\226\323\235Qg\346%\314"
+	.ascii	"\f\201\231\036\t'\026\340\214\236}\357\225u\367\230\2032\372"
+	.ascii	"\3331\230S/\n\317%i+\345>\360L\233\362]\b\b!6)\376\222\272(x"
+	.ascii	"O\234Z\356\321\022\361\275\370\013\177\340\233"
+	.string	"\371\314'\362\215E\020&\2168|\036<\310\037\362\351V\310E\352\355q+\317\367$\b\350\336\2532o\317,\202/\304\247\003c\277\272\373\022H\277,U\356\r\316\334\362\214y\313\327\361 \021\034\2330b\226\223\371a\261\031\221n\027x>*$~h\364\244\245\3561\252\311na\222\"\242\222\027jsC\177Cu=\032\3318\326Z\306\037\362B\013\016S\nQ\024\242r\300q\310^=\b\216y !r\314{o7\254\005\217\034tG\211\"\027d\367\230\256\360\311\210,\327\237\3330\316\303#\037'\265{<\344\333E\204R\243I\314\274\341?x,\354N\244{o\003fn\335\207\316\203v\247\203\241\367`\361i\334r\207\027\375\355\226\357\201\274}\337\370\212d\027\253\225+\302k\005\343\311P\372\260\322\260C\001\346b\265J\260\225\253\371\206\206\203M\216k\365\302\320z\351\250vrltT7\256\227\212\246"
+	.string	"\263Z+\227\n\306b\271T\247\340}5\221Mi\200\243\321\216\343\254i\247\356q\nI)U\177[lCt\346e\343\270\226l_\350&\322/\213M\b\005p\236\347y\031\222l\234\202\227\007\254\0309\"F\251\321\244\327{\3575u\217o\374S\360\270R\303D5WK\266m\034s\202\227\235\352\017\037; `\002!t\271\003\177\f\263\241u\0046\241\016\307(m<\325\306N\215d\233\303[\217\226\026Z\244\b\201\230\005\326\305X\370\240\200\364Y\233\256Nm\236\377*\013\323s\321\212\257\231\324\226\323i\363\331f\267f{\360\226\300k5\216\312\222bG\363.!{\215Z!\207\177)\272\034\367x\264\305\031>f;\b\032a\260\b\331\221\266\357\322t\340\016\255a"
+	.ascii	"\313h\035zi\271\f\023\241J\207\033\2367\336eS\333\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375`\355\006\335\033"
+	.string	"\026,\247Hp\334q\016\341\245k\203\261\316\220\031\275\241\2652\013\262\334\226\224m\273\023\361\\\0067hc\266\335\345bw/4P\202\305\002\255%)W\241\\M\225\251\215\324\017\022\264\333\330\005U\213\017e%\264\301\330n/\267\245\235d\227"
+	.string	"\223"
+	.string	"\222"
+	.ascii	";\001\325V\340m\261\325\272\347\304~r=\305\304\233%\266\222\223"
+	.ascii	"\330I#6\022Q.\333!b\037\205\330F v\360\303\026\362\260}\245w"
+	.ascii	"\330=\016L\246\324\216\251\265.\207\305&o6l\002\263\206MT\226"
+	.ascii	"r\206\030!\313\260\201%\206\235\331\304sa\377\312\327\332])\026"
+	.ascii	"tlV\330A\0246\320\317\363\2546a\367H\330>\0216\257\204\260\213"
+	.ascii	"\312\007z\212\251\265\246r\240\245\230\266\266m\333\006{\350"
+	.ascii	"l\207\303\"\023\255\267\326]\212\036%\206\\\233\332?\245\326"
+	.ascii	"\032m\023\217C\243\323\237\032J_\225\201n\257\2762\372\006\335"
+	.ascii	"\376\224\375\305\220k\307\337\355]\366\022x{w\205n\357f\261\027"
+	.ascii	"\321z\263\\\017*\371\252\362\203\376\372\372\316Wew'b\242\204"
+	.ascii	"\3519\037\215\375\333\266\315\341s\376\257g\376\t\306f\323\332"
+	.ascii	"\007p\354\250\033[\312\306\206\252\261\013\320\330K3v\223\214"
+	.ascii	"\3554\307\330\3029k\033\200\261\365\226\027[\247\271\330\032"
+	.ascii	"n\2615\025\026[WY\261\265\025\254\255\257\\m\215E\305\326Y\254"
+	.ascii	"\266\326R\265\027\244\330\bP\004Ad&\235We$\335\253CS\247\263"
+	.ascii	"t\201\245I\322=\352\272s\215!\216)\351\376\267\244{\364-\312"
+	.ascii	"\375\031;\324\026\224#F\271\267rG\206\315W\216r\257z\371\023"
+	.ascii	"\311\332\344j\303\031\323\325\3354`\324\210\326\237\362\027\222"
+	.ascii	"\266\306\f\270>\016\rg[\341\024\347b\3105/D\270"
+	.string	"\3072\336\322\307r\375\211j\222r0\375\253\2528\230~\225\353Pf\340\234\371\322\367\301\276!/\346\031u\372\273x\347\006\323ge\327j:|$\361\245\277\302\253\033L\003\332e \357U\243\3731l\316\222t\367\ft<<e\327\232\263/\341\316\263^\254m7t\037\213\305\364X\331g\215^\276\3072\307\034\373\003bW\211`\tsb_\347\365\262\354\213\2271B\366\001\300\356\\<\200\330\330\317\301^n)6\301\261\277\032]\311\205\2218\373*\032\224u\"\225\031\355\211}\324\350\345\327V\322\315\311\356,\331J;b\377t\335\301\342\263.B\266<\023sa\323$\340]\356%\311\374x\302\024\340=\356\351\274\277\256\3418\001o\250a\020\312\303NDd\202\2024)\fk\240\002\261\242\261\016\021\240\020\207\020#$\220hH\002\231\241\007\026\370jH\\\342&\004\362\215\250kC\310mS\307\337\027\023\267"
+	.ascii	"\"\317\221>6\256\341\326xW&_M\246g\310\030\342\203\007\2479\274"
+	.ascii	"\3678\200\254\016n%=\"\001\306\323\r^,\021m\341\023\021\222Z"
+	.ascii	"s\371L0\225\231\326\301D@\237/\\\227\004o\332\377\211k.\366\353"
+	.ascii	"\266\334My\315\361\365\323\354\320\033\236\033\343\343\216\207"
+	.ascii	"\337\203\313\302\234\231\002\361\334_\017d\017G\037?h\037\327"
+	.ascii	"`\361\2266\220>5\026\335\3346\313\263\016+\320\022\\\327\260"
+	.ascii	"f\360O\202\241\376\025\357\231x\031\262]\376a\3244|\305il'|\363"
+	.ascii	"\t\304\207:9\332c\306%ul\316\200\377\003"
+	.text
+	.section	.gnu.lto_.refs.2d13c69bb567ee1f,"e",@progbits
+	.string	"(\265/\375 \335\205\004"
+	.string	"RK\036\"\220\247\031\016\377\377\377\377\377\377\377\377\307\200\206DT\205OOOO\r%1\333K\304\311\336vK\231\002\277N\360\360\225\003\316f\350/\364\025\372\t}\204\356\203n\203\356\202\376\323W\372\253\033\351V\002\211\215\356\242\257\272\331\033\365\222\003v\352\f\032\365Y.\374"
+	.string	"\370C\037\225\nzY\334X\\-\"\320\316\342M\262\231ds\361-\"\351tl\354\002}\342&7\3647\004\007"
+	.ascii	"3\005\244\302\320\026.\024\325\376M\013\237\262k\225(f"
+	.text
+	.section	.gnu.lto_.decls.2d13c69bb567ee1f,"e",@progbits
+	.ascii	"(\265/\375`\211G%+\001\232\363\rlW \fI:\351\336x\026eEDg\226"
+	.ascii	"io`2R\221\334"
+	.string	"!\355\312\242\b\007f6r130\263\305\360\377?\33559 aa\250\025\026\200\231\216\223\205\027\203@\035\230\360\323\016\274X\254\341gvr\321&\346\246\026\345\312\252\247\272q;\257U\224DB\366\226;\005\303\005\244\006\337\006Rk~q\243d\307\247\324LJih\035\243\313\007Y\354\334]\2255K\252\340\376\326\321\311\226\321S\235\243i4U\317h\033m\3255\272\252w4\217\226\352\033vm\034\035\365~\3210\376\263\376\203\037D?5R\004&$\320\005\031\332r\371[/b\354\234\316\221'+\321UQ\3625\016\213\306\246\271\253\322\002Uj\313\2343\210f\321NW\f\211.!k\002\366[:\034V\213\265\023\201\t\tdAwey\3278\354\027\033Fgi\315Q6do6\306\360\345\274\336\276\205\b\241qX+6\356\256\312\254D\027\305\200\272+oH\370r^9\370\341\340\244\302\027\247E"
+	.ascii	"\374\376CyV\353sv\223\3559\337z\350\337\310\206Jq\346\255\254"
+	.ascii	"\241\332\005\216\016+\033\\\354\3207]\207n\001\\Zw\204\254\226"
+	.ascii	"Hi\374~C\337M\320\263n\322\t\333\373\032k\374\336B\337TK\235"
+	.ascii	"\302l1\267$F\3437\215\245\206\352c\263P\261\302\354\257s\036"
+	.ascii	"\372[?3\366\214\235K!\347\245\234\363\206\0340l]i\032\333>\020"
+	.ascii	"\267~\357\311;6)\310|\334hl\225\340\2418\331\372\234v\265='\217"
+	.ascii	"\3559m\236\325\263+\007[\346v\214}\273\231\264\3465\347u\247"
+	.ascii	"\177\3701!k|\273\005\275\345p\336\277?\313\341\274\215C\273\r"
+	.ascii	"=\024\353s\202\261x\266\205\225\031\231\306\267g`l\022\324B\261"
+	.ascii	"=\347\345\254\317y[\004\265[l\235]o\305r\371\211\224Z\363\031"
+	.ascii	"\217\032[9\032\337\366@oo\345L\201\275\225\363v\007j\345d\240"
+	.ascii	"9'\215\2214h\032\337\266@m\\[8\213\3456\316^y\210\020\216\263"
+	.ascii	"\224\301r^m\034\3169\311Z\rt\254\325\300l\323J\";\361m\n\364"
+	.ascii	"%@y\254\317i\335\200`qJ\366\032\377\004z\273Z*S0\304\335 \023"
+	.ascii	"%D\b\266\r'g\260\234\363\005\227\213\257\213\222\306V\212\215"
+	.ascii	"\2256\037N"
+	.string	"\032\237\004\312v=\273\366\037h\215\370qaj\374\3335(5F\254\344\341h\254F\202*/p\215O\002j\237\330\2645\377\240/\264\344\246\306\027\001\375\007\324.m\317\331\331\366093\311\336\216$5\266e\366\005\273\232\331%\307c\311\\\226\363\232s\223f\300\2515\316\300\372\234\330\366\234\267\035\316\235\277\277\277?\333\341Db\301\354\330mrJ\346\263\234W\f\227E\222<\265\3066\211\r\263+\006V\354!B\370=\216\255`9\257;8PP?\222\215\317\001\335\031\313!\274\321[\fN\373g18\277Z\237\023\265=\347\020 M\002\2134\007p<\025\202v\310o\201d\240r\r~\323\002\242N\336\3467o\254W+\361\374f\315\337A}\3422\340\267t\367 \356\002\376\016\301\r\341\267\004\370mw\270 \374-\342~\360_3\304\337\021\270 \310|8\374\301]\017~\313'\327\350E\374\246\375\255"
+	.string	"\362\202\367\203\221\335\013\201\323\337\322Y-\215\342z\370\355\206\216\273\n\260\034\256\341\307M~\253\001\013n\002~[\200\r~\201\034\002J\374\026\003\013"
+	.string	"\016\377\342\346\202^\232\203\200\003\222\316\217\275`p)\377\333\006\360\337\355rQ\376O\311\300\341\t\370\361\222\277O\270\0354\225\377n\270\034\374m\3766\315o\335l\035\027\253\202\020\205\340\3379\177\353\244\360/?V\004\027\001\267\303\337\250\b\356\301\217\221\374\255\201\313\241\257\032\353\254\211\025\376\375\344n\360w\006\367"
+	.string	"\277\265\002\367\3338%E\277E\361[\024\332\304\177\r\360\337\002t\224\033\200\337\222\340\267B\277\245r\177n\342?w\303\337\037\260k\277\225\303\343\360\007\374\030\013\311\255 \254\311\256\317\337K\356\006p\267\347\277\t\313\341\033~|\343\277\330\307Z\203\363\307#\374\215\325W\027C\007\271<\277\005\300\3458\230M\002\t\b\340\307'\370m\223\337\242\375\366\354\267i\315uw~k\301o\r`+\370\255\222\337\206\375v\354\347\277\337o3\370\355\005\032X\037+\200\337np\023\033\200\300\"{\204o\360c\025\032\016\367\f?\336\322\304\253c9\2409\206\037\3175\340\346\374\r\346\342\374\275wo~K\302o\035\3607\t\376V\341\332\374v\002"
+	.string	"\250\340\002\377\336\362w\206\213\376V\204\377\034\254\327\341,\032\333\345\b\370\361\332o5\374\026"
+	.ascii	"\277\365J\336\232\377&8\374\355\200\3778?F\372\357\371\337\376"
+	.ascii	"\357\377N\363w\337\337g\376\346\373\033\357\357\272\277\261\374"
+	.ascii	"}\345\357\267\277\335\376f\373[\355\357\263\277\313\376\016\373"
+	.ascii	"\033\354\357\"\177w\375-\344\357\254\277\261\376\236\372;\352"
+	.ascii	"o\250\277\235\376N\361\267\322\337\371o\027\376F\372\273\370"
+	.ascii	"\367\321\337E\177\023\375\235\376\035\3647\320\337\"\370\373"
+	.ascii	"\003\177\227\370{\304\337#\374-\201\277\035\360w\210\277\025"
+	.ascii	"\360w\007\177#\340o\r~\013\344\267\026\370\355\315o\251\3746"
+	.ascii	"\355\267c\277\335\340o\013\376\336\360\337\355\267\311\337\362"
+	.ascii	"\370\355\212\2773\374\326\357\357\235\337\242\360\267\316\337"
+	.ascii	"\350\377\013\376\303\375\026\315o\371~\273\367\3331\277\025\301"
+	.ascii	"o\303\374_\362\037\357?\b~\213\374\255\371\333\373\277\314\177"
+	.ascii	".\377\345\376\233\370-\372[\257\337~\371\255\227\337v\371\255"
+	.ascii	"\335o\271\374\266\356\267[~;\367\333\270\337\272\375v\312o\243"
+	.ascii	"\374\366\311o\311~{\344\267F~\373\365\333\342oK\360\333\243\337"
+	.ascii	"\022\177;\374\255\321oI\374\266\303o9\374?\373_\342\377\330\177"
+	.ascii	"\026\376[\371_\301\337\337\337\337\177\263\364\333`\340\017\361"
+	.ascii	"#X\212\225eF\";\3004~,\003\317h,\234\035144\264\306 V\353s\236"
+	.ascii	"R\266\347\274\215\026\374\242L\013=5\034\205\221.\274\344\234"
+	.ascii	"\230\261X1\013\354\342\002k>\332\264\230\343\222\302\227\221"
+	.ascii	"\310\016~\374t\354\342\267h\270\005\006C$\310\212\306\330\t\304"
+	.ascii	"\361\023\016\013\026[y\215\355\237\3559yl\250p\223\016\020&%"
+	.ascii	"*\215o\323\002\253\300L\230\t\21624p\3221\023N\241\314\342\264"
+	.ascii	"\2441^\322IK\021\306L\343\003\377\260\022>\332\b\331Js\321\030"
+	.ascii	"g \024\2778\037\215\257w\377\376\003k\246|\231B\366\3674WL\316"
+	.ascii	"\256\237\013?&*\215\017\364\202\376\267\017\315\022k\257\256"
+	.ascii	"\361=\003\324\033\353\253\322\370\3008t%!\306\016\263\306e\356"
+	.ascii	"\236^\315UV\026W\343\003\231\224\321\003f.]|y\277z}g\264$\211"
+	.ascii	"\271c\316:\344\037\323\0211x7\214p\312KK\343\003\251\360\300"
+	.ascii	"\030\301mQ`\304|\271^\236\030\371B\322\330\313\377\337\250N\""
+	.ascii	"\317-P\226\340\356\316N\033cr\210u\351\220c\246N\351\313\316"
+	.ascii	"R\271=\324\240\226\270t\017\234\276819\352\356\226.\244\324S"
+	.ascii	"\343\333\365n\3212B\007\0242t\277Zp\227\024+`4\276^#_w\207F."
+	.ascii	"\313\034\223X\016\037r\277sv.\205\274\001\303\033rG\343\020 "
+	.ascii	"~\345\276\244L\231\301r\343\212@\345\300\321\370\302\3357\273"
+	.ascii	"\0366\360\032\037\030\205\376\003+Z\313+v\275V~\3378\370\251"
+	.ascii	"\031\363\227T\003\343*n_v"
+	.ascii	"\330x\322Xm\347\350'\345\211\312\224\03405\274U\312\357\224\377"
+	.ascii	"\266\335\027\212Bj\2305\276\266\347\264c@\374J\271P\2460\365"
+	.ascii	"\261E\321\2713\342\266\366\033\345v.\205\r\367\205\0232\"\215"
+	.ascii	"/\024\020\277kg\0323-\316\032\357\250=i\332\022\246\254\361M"
+	.ascii	"\3731\221\024!\222l|\240\022\212\326U\214\364\233\335\323\211"
+	.ascii	"\342\311KJG\224\227\311mr\235\330\365\242\375\232\335%\367\354"
+	.ascii	"\276p\321.\230\335\273eJT\005\031\222e\316+\031Y\236\023\212"
+	.ascii	";X\237\323\264=\347\217\365)#cr\346\326\325\370\216\375\354\234"
+	.ascii	"i\225\351h|T\017\375\177\327\253\304\256W\3547\314\256\271i\315"
+	.ascii	"9?\204~\313R^\261\013\326\303\306\2303\207\335\225\253\023\377"
+	.string	"7\311\017\264\201\333\253\241l|\024\017=\332\005\375/\022\013\346\210\215\253A2\245\352\314\310\227\211\305g\205\374\262Hr\224\301\270-\234\356\r\021\230\220\030 \313\261\3149_\245\273tY@\221\355\270\323q\247\350\240\2269nT\215\253\325E~\334\253\353C\004&$\020\206\222S\231\233D\327c\331yZ\255w0\"0!\201LtY\313\234W\255Ku\255\256\030\022ESr\261\274Z\027\307\275q\201RS\316/:p\211]}\361]\256\253\274[\267\310\365\272An\327%r\205\334!v\275Z\355\342\367\307\005\302\301]\301C)Y\001>W\353s\336\356\372\310:\023\373r\267\342!\\\324\204\334\036\027\353\f\243\353\361\326\370(\022\364h\327\345\261\263\367\224W\327\370h\326\255\342q\2238]/\240\2024>:\343\356@]\240GS\240\257\351Cm\034\241x\t\203\336\202!o\224\225;#\001\354\355\351B\351"
+	.string	"s\246\262\242\314y\356\377\235q\245n\215+\303\256\227\306\205qi\334\030\027\312\312\235\221\020we\231\363\334\245q_4A\246\001\373\341\200\003\034fKI\232\r~\r\023\3645`\350k\210"
+	.ascii	"\353\310\3448k\374\032\345u!\267c{X\321\202\246\361k\260\320"
+	.ascii	"\327P\241\257\251\201z`{\316\273\002\247`c\353\321\3705\271\351"
+	.ascii	"\2528\263$\311f\227\351W\305\216\326\2239\036\215o\n\273\367"
+	.ascii	"\367\344J[c=\364\253\3559\357\321\316\315}ik\374\023\013z\273"
+	.ascii	"\336\374w\263C\313\223\035\215\373\357x:^C\252\344\306\355\207"
+	.ascii	"\367\206`\2415\356>\363/\356\216J\343Fc\311\376\003m\320V\310"
+	.ascii	"%\033\367\031\273\367\037\210\016\211\341\004\255q\357\265\231"
+	.ascii	"\377\300\036\002\205\255Fc>\234\244\031O\346\032\377\234\202"
+	.ascii	"^\357`\376\003o\250\370\250\212k\374\223\t\372\363\bz(M\246\227"
+	.ascii	"\306XP\343\265\266\343J\f\007t\211\255\t\330\362V\360\220\266"
+	.ascii	"\245\2510qf\331[^\034^wY\3626G\245\361?xk7\0353\347\244\027e"
+	.ascii	"Ga\203\300\021\274ew\351+\275\345\002\245&\r|\335-s\316\226\257"
+	.ascii	"KW\261s:7g\035_\224_\332\256\357\032L{\261kw\261i\357\272\346"
+	.ascii	"\322\245\245\264\233N\322\232\2215ZP\306\364\361\345\234\201"
+	.ascii	"cV\177]p\260]\255\317\371c{N-\326E\0266\277\306?id\3519\2736"
+	.ascii	"]c\271\345k+N\344:N\347\210!g\036I\224t\r\327q5K\3260K\254D\326"
+	.ascii	"\345\312\211o\346\2417\301\240\177\307\331\271\246\203sRj|\263"
+	.ascii	"\013zs\013j\3159\364\246\025\264\333z\212]-h*y\307\216\351\241"
+	.ascii	"\024\325\370&\033\212\202\234\255\005\247\375\373\263\026\234"
+	.ascii	"7\235\2407\307P\017\254\317\371\367\232\332\2142\277\255\306"
+	.ascii	"j\035\244\231\\1\344\006\224\372\376N\353'\r\305\256\255\326"
+	.ascii	"h\357&\355\344\270}\2505\020\277e\373P\353\037i\2269\257\034"
+	.ascii	"\374p\300\201\315\035\335\231+\024\237I\353s^\213\3559or\241"
+	.ascii	"\177+\337L\376\366\321Z}\326\311\003X\371\3555^rVA.\2714\276"
+	.ascii	"\231D\377wY\223\265X\257\375B\217\331\265\315:\311;\314\336\035"
+	.ascii	"\333%f]\244\221(}\351-%|\312!a@\2305\230\227esu\341)A\2305\021"
+	.ascii	";g\345\244\362Q\f\bI\240\334)\177v\352\366\316\252\350\340\343"
+	.ascii	"%\212c{\316c8\364\030J\037\261eK\262\3204>6\202\266W\177\331"
+	.ascii	"\265\215<\347\334XA9Kj\314B\3169\333\267\2355o;\217\203\240\307"
+	.ascii	"8\320c\026\350\317\310\240w\263>g\013\001\361V\n \255m\255q\215"
+	.ascii	"\3559\177\271\240g\266>\347\357\032\372\273\242\227\353,\fv\326"
+	.ascii	"\031O<\032\377\335\003\313Fif\344F\343\253\033M\274\2105\376"
+	.ascii	"-\202\336\2025\016K\306\356\335\025\n\252\202\314\r\204\212^"
+	.ascii	"q\305\220\250\032\235\223%\277\345\373\353\244+\206D\233T=Yv"
+	.ascii	"\261\262\fA\316\316\351\034\327\fUS\025gc\f_\023'\266\212\225"
+	.ascii	"\013`zJ\032?\303\214\265\257\231l\226gU\272\353\262\314Y\252"
+	.ascii	"\203\275\n\013\242\025\345&\333MrJ\005_\006%44S--\031f\t\204"
+	.ascii	"\323\342$\311\223\233j\035W3\226gwL\373\0174\261\345\016K\232"
+	.ascii	"\351Di\203\214\237\226\232\031Jg\250\230M\032\213\315\361\002"
+	.ascii	"\210\0224ff\346\231\035\313P\032\332\304n\354\236\274\320\303"
+	.ascii	"\\r\363,\007\312\f\037O\260\254\253Y6u\302U\255hBv\263\314\212"
+	.ascii	"\016H\325\030\316z\314x\346\230)\006\034\363\305\313\222\216"
+	.ascii	"\322\r%VZX\030^\2420\245\223\007\025\003\t\366\365e\202\331\261"
+	.ascii	"\fUB\354\352\353K\312\022\030\226\211\344&X\316\225\231(9\032"
+	.ascii	"\233G\260\227\r\224^\035Wc\323\210V\221\"xi\3072\324\017\225"
+	.ascii	"\255\253/\276\023\313\227 X\215\217A\307\326\226\331\225\005"
+	.ascii	"e\"\006,\t\327\315.\364\312\215\265\273\306\346\220\005hy\232"
+	.ascii	"\322\370z\030xy\242\005K\343cx\361\343\207)\344'y\024\323\201"
+	.ascii	"m\356\352\013\013q\342\305\210\031\344\246\020-MP[\215M-\354"
+	.ascii	"U\023'\204+\254\261\t\244\343\362\252\3742\206\245\254,\023\353"
+	.ascii	"w)\353`\242\314Y\252\203\031'\346lH^\325_eb\331\261\fub\215\271"
+	.ascii	"*\303\227\263T\007\234/]I\204\\\335\304\312!\202\324\222\244"
+	.ascii	"\261i\305\201R\311\326\330\344\3610\352\322\227\021\2363\023"
+	.ascii	"\306M\0320\314\251[\207\223\217c\031\252F\355\255*\n_n\222\352"
+	.ascii	"p#\326Bl\016\307\315\251\233\311\020!\034\314W\221\272\244\306"
+	.ascii	"\346\216\353H\301EY6\276\231\303\324\361\003m\270\254\312\274"
+	.ascii	"\032\237'\013\275\002\306fDE56o\034L\027\030'1\215M\033o\303"
+	.ascii	"\221\342\302\207\325\370zf\215\270*:\245\306\246\224N\024\025"
+	.ascii	"L\2544>\017\025j\312\2709\343\007\002\243\350\260\242j|\036\033"
+	.ascii	"\350o\306\370\2015hu7\224\215\317#\003=\217\013\3647\243\314"
+	.ascii	"\250\033\205\327\034\205\302\361\357\310WF\272up\321\274]I\201"
+	.ascii	"s\341\302\204\312 \347\314\224Y\260#bf\231\245\244:\334@1\351"
+	.ascii	"c\002u\243\356\274\344\204\234\231*L\025\246\223\024\"Ir\332"
+	.ascii	"V\264\3750[\334tjK\302\022fEc\223\205\235C\303XxEil\256\3508"
+	.ascii	"0\034ga\215\315\246\267\215\245\275\205\221y\032rU\343H\212\024"
+	.ascii	"\330\256\314\331&&g%\213zj\374\035 f\222\231d*\351\235lgR\017"
+	.ascii	"\211\251\004\334\342\252rj\374\235\033}}f&2\305%\345K\347\007"
+	.ascii	"\226e\231\277\233\271\210\333\336\214\3068\315]j\035\207l5\306"
+	.ascii	"~x\005\016'^n\354\260\330\333\303g\334\266\236\226"
+	.ascii	"\270\t\221\255'3\307g\360\322`\234\371\322\030\363a\257\235\036"
+	.ascii	"P\322\226l\225\031d\270\2405\276\216^^\036\326C\200\337\332-"
+	.ascii	"{\253\333:\326\263{?\304\230\246\032_\307\n:f\f\266\243CSf)\251"
+	.ascii	"\016@\276:/'E\360\360\360\222\310\234\227\0213W\302\034/\257"
+	.ascii	"n\034\301\274\344\312\2249k|\235\031\350\217\357\356\360\027"
+	.ascii	"\256\025G\007\350U\212.I\260\027k\266\222Ii\274j\220\362r\321"
+	.ascii	"\370:N\\\270`\273\237\255\243T\0073\017\252n\207\236]\261]\226"
+	.ascii	"\256 h\215\237\243\267e\013\246;k\344\\\231\233\303t!\350Me9"
+	.ascii	"\246[s\222\222\221\363\002\372c,+\306\322=~\326\374\302\006\314"
+	.ascii	"\332\301s\224\350\333\033\206\353\234sV\326\250=aY^9\206\273"
+	.ascii	"ir\310\302\\)\322\030[\321a\222%\205\035^A%*E\262\361s\220\350"
+	.ascii	"q\233\305T\260\024\354\206\333\320\254\334@\023 \313\214\214"
+	.ascii	"\321\301sT\240\307\351Cq[\343\360q\320\t\333\"vd\f\330\004I\227"
+	.ascii	"Sc55\314\306\223\225\274\370PF9f\263uY\254\2504\306k\030\274"
+	.ascii	"\354\2115\306P\354\332\361\211T\226\r\203\346\301x1f\367\302"
+	.ascii	"\0138\315\356\230sr\234\3666.$@\2244\306M0V\037\267\272\372\032"
+	.ascii	"c4Kf{\274m9i\214\231\274\r\370C\312\362\2551>\263d7\322\364l"
+	.ascii	"4\306K\336\206\372\325(\222\24616\303i[WL\206\346\234\217k\206"
+	.ascii	"z\300\032\227\224\257\261c2t\206\n6\037\215\261\230\020\0132"
+	.ascii	"In\324\031\007\325w\246\361q\276\300\300p\230\025\003B\306\024"
+	.ascii	"\227\024\276$\307a6\316'\353\213\n\306\272ybJ#\326\3708\311\256"
+	.ascii	".|\304\3360G.)_F\216\217\330\224-\315n4\306_\030\313\r\206\225"
+	.ascii	"\230\306\230\b\366\312iS\316x\341\"\327\315\205\225\037\367\f"
+	.ascii	"\266\321DJ\225\270\377@\034\026/\330t4>\016\f!B\360\220\035k"
+	.ascii	"[\307C:\352J9\327\030+7Ly\241u\371\230\264\204\2645\376\215\036"
+	.ascii	"\372c\255\333\025ka\033\027H\346\027\020XC\336)k\366\304\346"
+	.ascii	"\3044\376\315\034\372\343\037v\305?\336\206\307rT\215\212c\230"
+	.ascii	"\r\276\234\245:\310\311\332q6\367U\365*\234u\236\234\263R\316"
+	.ascii	":r\2342\246z\034g\231^0\250\2464\306<0\326\177\340\b\234\300"
+	.ascii	"\320a,|U\246\243\013\214\253\f\264q$\013\035\266\352\250\033"
+	.ascii	"\343M\210\230\271\2522_\324\032\377\206\n=\276\201q\034\347\300"
+	.ascii	"9\360\0240\347\234\245\362q\214\0069\326\270\244\360e)d\207\037"
+	.ascii	"'\217\247\354\034\316\325\f\266\260\306x\207\235\273u@\326\372"
+	.ascii	"\032c\0359\177g\376\312\032_\357m2\326\220\3005\376\315\023\372"
+	.ascii	"\337\276\3773'!s\316/\3145#\225p\316\337\336\232\326v\370s\354"
+	.ascii	"\265\004\370\217\177\017%\344\234\024f\231s\266y(\227Z\322\215"
+	.ascii	"\f\362\377w\310\371hs\316\310\2462\252#\206\246\262\244\334\364"
+	.ascii	"\202\\\024\206\2462\252\250\2465Om\310e<r\323\232<\342\3441\347"
+	.ascii	"|\354\274\346%\252\250\274\224<\0365\255\031\231\327\344\221"
+	.ascii	"'/E\3614\255I\307\2462\252(\333T"
+	.string	"\226\214j*KFa\310K\371\230\227\222\246\320\245dT\323\225d\024OSYRT\323\022U\224]\223\331\316\261\255TG\246\\\226\224\223svZ\225G\234\234\223\220\371\230\245\2372\325\362)\353\310V\316\310\312#\347|<\263\253J\002W\245,\327\324\225$b\312\331.?\201p\264\3075\347\254\"+\035m\316L+2g\245d\nR9\347\234\264ZT sN^JrR\252J\3420)%U\344\256)\233s\316QMeUI\020kfe\312\254\264\036m\223S2+\263\035\025\022-;Z29e?\244\234\032\343\032vF\034\325\231\306\267\001\203\3768\206]q\fL\003\330\024\305 Q\020V\207\302ks\002\212\241P%2\n\207\302\022\210&\212\304\022Ta\320\004\007H]\020\226\310\220\032\211EA;BC\341\220\206azD\324Q\213D\022\031J\250,\244\033\020\032\n\207~N\344!5\022\252"
+	.string	"0\n\213\212\204\305T(H,R\211D\021D\023jj4n(\246\352\260\002\302\242 \364\004\242\t\242 Uh\202\022(\206\302\2410h\224\2360\204t\302\230\241\250\222\030B:a\254iA=2\252\200*42\016\203E\023Fa"
+	.ascii	"0\f\205(R\021CH\"RUXDAhX\201\233!$\021"
+	.string	"B\301\234\"\221\205\235\023y\b*\006\375\2040\002\235XA\bH\204\240bP\206\023y@1\024\026U\343\207T\b\251(h(\374P4\"}\250\240\250\bi8$\016kT\240\324\005\241\3614\001\261H\244\022\2075C\301\264\b\253\251\321(5:O\344A\003&L(\361AMQ\024\203\252\nA\304\242\021\322\"q\204\2354-\226`L\325\026D\260`B\003\221\021\211\204*\034\232\220\203b(T\205A\024x\324bP-\301Bp\204\005%\f 4d\2021\230\026\245'\030\201F\265H$\221\252\301 bQ\021\005H\374T\240\026\211$\006\200z\340!H\210\"8\342\310hd\363\201\021#n*D\f\032V 5\n\026K\020\032\246%2\004\325 \t\027\b\005\211E-\004Il\030\241\246\306\264\210#\204A\317\211<\b\213\202\202F%\204EA8>CH\"F\320\360 a1\035\246(\320\203\260"
+	.string	"\005,@\004\026jT#\232\002\225\240\341CH\"T$\016\22482\032\355\b\r\203FF\304\021*82\032\335\250\306\036\265\205\242\243\364\004\2431\r\"\026I\034\031\2154\244@$\004\325 \tG\306\021C\342\006R5\210T\024\\\241\002GF\243\r*\020\007D\214\350"
+	.ascii	"\006xT\240\020*\020\b\017\024S\241`z\201#\243Q\216\320\231\272"
+	.ascii	" 4\342\017\306b\272\202\260(\344\001\236\264\350D\320\304\ng"
+	.ascii	"\n\224\n\021G\250E\342\221M*D4\302)\020\007\324\"\361(\3078$"
+	.ascii	"\n\325#bM\252\006O\020B\n\236@\213\250z\"\017@(\206\302b\006"
+	.ascii	"E\302\240\212\215@(\206\302\"\316\211S\005c\320\b\253@!>\020"
+	.ascii	"\n\246D\270\230\016\r!\211`AEW\020\246A\351\t?6E\225\204\t*\220"
+	.ascii	"\261\003i\221\220\020'\250\006IP!(x\242\250(8\002\013E\235\023"
+	.ascii	"y82\032}H\203\202C\305T\035\n\325\023y\030B:\361aH42\"\006\t"
+	.ascii	"@h\230^#\320\020\322\t\343YT\217\356\020\322\211+d\024t\215("
+	.ascii	"\202EC5\3053-\n\205\200:\352\211<| \n7\250\033\214@\031T0\006"
+	.ascii	"G\f\211B5h\2104\204\223\002\231PA1\025\016\t\325a*$\26492\032"
+	.ascii	"\031\217P``!\025\032\232\220\252\301\242\020R\360\004\020\013"
+	.ascii	"\304\023*\004\005\213NT`D!\034\032\022GP\213\304\243\033\027"
+	.ascii	"\210\200R5X\004J\325\240\320\021\022\220O1U\203\202\305 Q\020"
+	.ascii	"\220J$\236H\213<\352\211.8\361(-~P\211\304\342\207\233\234#\243"
+	.ascii	"\021\320\b\244\026\211$p\324\"\361\b\253@\306\021\251\221PE\215"
+	.ascii	"#ZP\205+\b\325 \n\250\306`\221N\nd\224\252\306\026J\22082\032"
+	.ascii	"Y\240\032S\244\022\244'\240\030\n\205\206\351\221N\n\224\252"
+	.ascii	"A\233T\r\252F\240\240\232\024(=j\301\304Nz\324\202\211#\233!"
+	.ascii	"$\021C\2419\024\"\241$J"
+	.string	"\214\0202\n:\215(\202E%\b\031\005\241)\020\316\220(4\026S\017\034\031\215l\324\32484D<U\240\005\200P\215\301! u(D\312I]\020\226\b\252A!\024D\b#$\243\nA)Q\020\260\210H\024\001d\266PTS\243\264(5A\244\nQ\020J\213A\"cOQ%1,A'\005R\213\220\214\351\t%\216\214F\030T#\220\232\252\020\024$qd4\272\031\226`\024L\213\252\021U\201DP\207B\244\232\203"
+	.string	"1B\006\035\330\200\005\320 \017EAa15\002\035\031\215>\034\031\215>\f\205A\243\017AE\343\007\017\001\370\177~\321My\252\362\032r\221K\320\224\025\301p\247\030\271\031+\221,S\n\f\251\271.242\031\215\353d\nQ\247|:\207\340\260*S\246\2345\3269\213"
+	.ascii	"Q\261\326\370T\236U)\344\274A\307O\253\005\026!\330\216I\215"
+	.ascii	"\036UA\260\\+jD\274\264\260\215\344X_\n \230-\003UQ\372\207\351"
+	.ascii	"F&\225\346\355\364a\323\210aA\023dE\243X\235E\351\0368mG\352"
+	.ascii	"8\246\304R\323b\"\227w\205\247n\236\227[\023+\334\346\244J\212"
+	.ascii	"\343\231\343'\217\377\324q\3568\253\\\370\363\333k|N\235T?\253"
+	.ascii	"\316d>\253@H\346\234tV\355\364\345\234\264\203\217T\tA;\3615"
+	.ascii	"\230\241\267\263>g\216\3559;\f\304\317\0347qS\226Jp\260i8\206"
+	.ascii	"Ik|\326\270)\370\373\373\373\353\3139\351\254\321\347\215\323"
+	.ascii	"\306\317\032\267V\003k5\330\251\261\373jJ:\245zK\216\026\327"
+	.ascii	"\230\022\r\023\f\2379\221\2617\303,\263\221\362\013\002'\343"
+	.ascii	"\f5\323\026\303\314\333N\030yG'\216K\235]\343k\030C\377\363\005"
+	.ascii	"\026\376!g\306)J\b\016\230'\026K\220fW[\211qK\001\265\264\261"
+	.ascii	"\302\273\242t\201\217\340\210=\031#\362\204gy\324(\343\305\311"
+	.ascii	"\3443\305b\300%\265\370\202\243#+E\035\013L\343fA\273\022cE\335"
+	.ascii	"\022>%5\232nN\311)\371\313j\274\264t2y`\263\n3\253\034\313[\006"
+	.ascii	"\252\213\306\231\342'S\214*c"
+	.string	"W\032\274\316\2443)\n\3704%f\243\3615P\235\371\314rwJ>\033/`1k\374\236\2764i\266\266\310\310s\321\370=]\372\372\252\254wJ\2765\037\177g\252\2349\303\266\274S\346\370\220\021DE\343\367\224-\2774\371<\260Y\305\222-H\2267\254\f[\234\271w\223\017{\3710\342D\244\261Y\246\221\324\354\361\300\302\325\330\324\3030n^\340\361\204\253\261\231wYd\335\035ijl\2229\030\274\304c\313Jcs\314\215\332\001\323\021\245JcS\314\265\262h\240\324\255\270SfY[\302\032\277\207\210\235\235\211\247\274Sv\223\024=\266\300\334\304\213\203CS\245\261yg~)\343b\346\366\305\213)\3676\203\312\202\263\267\250\306f\027\273\247\205\013X\017\252\2719\263\356'y\034\003B[\276S\342L\251\371y\311r\263\316\334\262\327b\255n\213\251\345\212\223\026[\226\340X\245\251\022\206\256\223\004"
+	.string	"LS\032\206\2216g\226\326\370=+\342\342L,L\222\274\300\260\316$\271\303\322Nfj$\375\270\\\271\202\355~\222\027\fU\221.\364\212\231\246!C\336\336\256\226\237\344\3552\025f\343\213\254\315IFV[\233\351fyV\245/x\313*r^\222Tn\272\375\301 \343\327\330\234b\246uI\032a\022\027\205@\250\303\361\243jT.\246\030\310B\204\320\024\311l\232\326\343\025@08H\036\225N\267=\017\023"
+	.string	"\305\013lu9Sc\f93#\222$I\3323\266v\216\236\265\\Y\343g\217\361\325\3208\373\204~\264\3159\215neI\024\370\362\232BF\346\345\006\216E\260\033\035f\270~\270\241\007\244\302\276\301\025\364w\372V\304\225\261\007\265Xdj\341\357\340\025\230c"
+	.ascii	"z9!$\033\337\001\223\001h\306\272F\300Ay0\307\373\356!\301GL"
+	.ascii	"\247&\177\n\257\337\251\027\241P\345m\332u\334\337\230EF \013"
+	.ascii	"\216F\t\200\204\244\353\251TB\032\212#\205/\265\006\330\022\236"
+	.ascii	"\241.\216\314\340\226\320j\n\2677;\360\270q\324V\205\346\007"
+	.ascii	"\373\026\316<\365b\223\016K>\276\335\272\376#\346:O\222t`\356"
+	.ascii	"\206\341\221\013`\352\216.Ee\344{\222\027\024m\215\263+\362\266"
+	.ascii	"\270\007\273\307\"U\317\260dk\006(\b\362\334\356\262`\257\267"
+	.ascii	"\362\357\030:\2206\340fj\303\364\351(\2335\363*\350a%7\222(\321"
+	.ascii	"F\237\227e\200\243\246\277\333\264EdK\364\342\b}+ ?l\251J\376"
+	.ascii	"\210\236\033D\257\371"
+	.string	"\315Ab\207\233\274f\205\0323~!\341o\033\027\353\025\237\017\350Fz\301z\213\310\r\376\301\001\220\020\372\361\222\226,\216\354\314\3467\360\312\355D\337V\242\302\b\300F\rP\270\357\362\345\323\213\n\237\245\337\224:-\031\203n*\322xil\365\276\262\371#\316)jj\204LM\315\236\252e\301\352\311\367M\253x\"\334\210\373\3306\317\301\332\304\340\316\332\240\247\032\323\202\264\023\372\253\343Y!\340vE1\373*\374\233\177Fo\206m]\r\"\257\321\260\246\353 .\247\277.x\237\261[\231Q\033v;7%\321\344\247P\347\036\2367j\314\206\211\037\314\233\310\254\3249>A~\270\316\b\001pr\322z\026P>\256\237m\316\262\024\371?\201o!G\005z\n\271\270V!\017\260\304\352@\020M+\005\363,\360\203\245\344X\016\n\320\263\310\005\331;I6\36277}\347r\257\224\255\340\270\030@\301(\330"
+	.string	"\3439W\300\214\nv\353\343[<\220bk"
+	.ascii	"\363\006K:\322U}\001Tx\344W}\035\214\376\264\275"
+	.string	"J\302<\256\207\"]\215|]\206kF\022\230\262\204\340\333\270\247\030}\275\016&\220\006\022\367@\021\233\003\001\237Q\r0^\320O\007i\202\206\240;\310\371\226\033\374F\024OE5\001&:E\244\213\360S\204g\276\3238\321k+\230\243Y]\277hM\035\177\250\023\275*\367\002/#\250\034\376&'c\002+\350\033e\251\376j\200>\214\313\2670>\371\314\223\332\266~\330\tK\343\322\333B\032\r$&~D\272\227\311n\202'\240\231Z\342l\032\306%j\250X\216t\202Q\346e\256z\247\017\b<\240cFf,\037\310L\br\343\251\251\r\316\001\001\205\330JM\272\343E\320D%\376\316x\264;\315J\261\207\327&\362\200!\002*4\003 B\350E\f\333.\354\270\243i\225\036\257E\305\241\202\353M\367\375\212r\002\376w\354\255\013\257/\251\343#\3714\3455\377\036n\233.\nO\264\310\2333o"
+	.ascii	"\264\033f\352\357\230\344\022\234\247::\3608\2301Qi\327\353R"
+	.ascii	"}\334\341\354\313\304$\355\320B\f\240\377\230Q\205\270\0254\013"
+	.ascii	"\"\3554u\304\t\263\241\304Y\321z\361\201\214t9\276X\b\034j\026"
+	.ascii	"\316\305}\323\2579?\370\336W=\001\261\256<\031\007]\321\370\220"
+	.ascii	"_e8\001.\275s\300\250^\226\254x\211l1S\310_\031\204F\202\221"
+	.ascii	"%3n\373WH\240\bz\021\235\036\017\262hs\031\342)<YK0\227\b/\201"
+	.ascii	"\342VL\n\374\247:vd\ra\273\350\302 W\037\224\336\342\205\226"
+	.ascii	"4_\253\025q\237\203\337V\233\337v\360\306\345)\262\361s\364\314"
+	.ascii	"\334\263\222\304\311\231\313\013r\002\231\016\246'\303\027S\230"
+	.ascii	"1\242\237W\275\016\244"
+	.ascii	"\372+\252\374u\002\235\255\023\n\224\350J\353\340\026 fOv\231"
+	.ascii	"+\273\255!e\375\026B\361\334\354`+\273K\026\345\241ca\202\271"
+	.ascii	"a\033>r94\032\016g\337\2041\374\345\351v\312\316\374\243F\007"
+	.ascii	"\002\271\034\323\016Z\265\265\n\274/\224\036\203\030\033:\013"
+	.ascii	"\027\261\224oN,n@q\357\242z\f\305a\t\027U6tY\302%\331 \266*\244"
+	.ascii	"\007|\217<\257\246*\2671\264\360\325\273\364\215k+\241\207\021"
+	.ascii	"\222(\363\263\255\277A\013\323\320\333\037'\032\361\252v\236"
+	.ascii	"\031\316\323\033=\264\351\324@;\312o\n\221\3149U\275\266\243"
+	.ascii	"\363s\213\030O\300Pg\\\233y#Qc\267\265\272\323x\362\314&\216"
+	.ascii	"\327\275%5\342]\025z\356;\3217\271\350R{Y\375\022r\026\354\002"
+	.ascii	"\342t\016\341\003\346\331]/\n\211@)\347\214DX\275\225\227\342"
+	.ascii	"\201=6\362\n\253\255\006\031qe\022P&\340wW\2377;\024\212\320"
+	.ascii	"\224\361I6\337\342r\301<\035\b\217Rt\203\213'O\236l"
+	.string	"\355J0\323\252k\223\333\030\263Yx\244<\227\274\351\232\350\251\302\247\352\366\030\217\005\004\244>5SH\354\367\237mL\31626\314bM\2518\031\t\006\033t\021\357\217S\306q\233\253\2748|\315d\271\223\327\017\332\021\r\205\210;\356\233\f\374\216\323R\367\272K\201\201\322\302\\!\332N\321A\005\tgg\374\222\023\373\3144\331z\224~:a\345\2011\242K\na\203\374\002\025XT7\257\003\243\317\277+\017\334B\022g\203\231<\022\006\334\262\370h~J\201,\013\277\204\013W\013\324\300\017\334\"z\250\033>9!\364\2360\264hC\205{\034\273'\202\001}\2631@\226\b&\261\315)\216\310\004\251\366vw2\240\211J\272\246p\205\346\221'HW\036\266)kgk\322\322\025Y\247\212\227~\363\274\231i\026\374\207\004[\265\343r\257\331\033\342\335\265\332\3163h \253u\250W\034\366\351\345h\277\360"
+	.string	"J\345~\177[\362\275\220e\261\034(9\312:#i\025\323\262\221\274\024\215\nTR\210V\013\270\021\330\364?\2101\034\373\235S-q\\\334\243&@\317\323\215\031\373\367\313\270\374P\2226\221\260\002\346\236>C+w\017\231f\307\305v\264\226g\030t\t\347\037f\016\020\275@\031ZdR\210\375\332\332'\030\345B\276o\271\307\313\350\2559mB*\007\363K\263\255\004@\356\033\034\026\2614M\020(~\274.\311\2143\027\025\225\322\377\212\307}\333a\272u\023"
+	.string	"\346\\\346\005\232r\357\270UP\002\302\370\002\220\231\034\226\234\2029\366\r\336"
+	.string	"\244AU\261\345\330\274\220\266\254\300&O[\214\243\233\003\3373\203\344G\316ie\211%\3626\362\266\225j\004\277\222~A\346\013\027\246K\244\226>Y\3700\207\343\215\203\234\331\270O\222\024dTp\236\231-\001W\254\no\211A\360\3048lY![J\013\036\025\275\236(2\257I\263\242k(\036\312\332\036\324\371\337i\3543>\277\210\266\"\004<\314\277;\366\026\346=\244\304\350\037\304\322\024[\267\002![\361fU#\030\205\323R\252.\312S\375\273\251`\261\317\".\235\275ea\273\035\267\256X?\221S2\331r]\037k\304\326\326z#\317\206\336\336\024\362<\025T\030\374T\346\252su\376\316\323\177V\007\271\275\366\202\341\035\033`\202\222\r\340\366\244,\277$\034\224un)C\021\022\311\017Zh\016\203\bv"
+	.string	"\236"
+	.ascii	"K\177\306\327\346\376\001!\006\224\356n\312\365@\207\374e\204"
+	.ascii	"7\244\330$rP\237\335\225\021\177FHu\235Sr\026\372\026\245\321"
+	.ascii	"\370\227LN$F:\036MR\032\270N0\366\261\342\373\2238k\234\257\261"
+	.ascii	"E\365\213`\232A\316^\277\240L=\243\376\304\033E\334\007\177"
+	.string	"\021V\320\256\224\273u\373\232\325@\300=\251x8J\256\035d\240\300\006`[\332`4\240,l\372\370\r<\217\263\036\337Qls\325\262I\3628\373\n\2471irX`\241\263)\327\023\025D\204\236\257\177\003\343\"f\360\200\355\177\260\343\004\272\006\3447\250\230\215\345\301?\374\260\232\254\310\3439\217y\002\254\342\274\213\320\371zP\372K\373n'enB;<bj\357\324?$\024\364]\013\326\330\276\023\033q\366\025}\373-\235cLg\243\241O\031\260\376\335\313R\207\373\332\322\364\3579F\3230O\364gK\236\235\305)\307W\034\355 \366\241\301g0\356N\377\256t\313=7\227\373\203p&\277\227\036D\353\337&W\262\377\037\245\260m\3529\027\0279\362\250\225\2665\347\376\254\233iM\365kS{s\370\253\374\177\034o\210\332\235\207\026\326/\003\342\343\347\333\333>\254\230\344m\tE\223\350S\020n"
+	.string	"\341\026\207\363\362\350\2632\367\374\256\242\272'/F\027}#\273}\0374\335\276/\037\nvXn\204\276\355U\327\320\354\226\267'~:\303\305Q\347\224\372\253k\375\0202\235\342\303.\277b`b\250\277G\364\324\013]5{\177\202\302"
+	.ascii	"\304\361\265k\026\234\332\235\253\327\370\316\245\345\032\374"
+	.ascii	"\303\350\034\217\354\323\177\311\314\022\366e\342O]\275\201<"
+	.ascii	"\332\036\327\005\306\215\220z=g\3572\322\276\tNr\305\335\321"
+	.ascii	"\216\335/\314\267w\336\323]3\375\002f\031:\266C\315\005\236e"
+	.ascii	"\376\216rq\324\351\346&\277\222?\276M\022\317\342\272\275\247"
+	.ascii	"\313-d^\200\376\361\372]\352\356\326\267\205\016\247\234D\367"
+	.ascii	"C\305Iz\321\371A\255\270\346\376\237\307\021\220\327b\334\202"
+	.ascii	"\246\247\330v\370\364\226zd\243\267\201 G\256aF\336\255\036r"
+	.ascii	"\360\352\267i\302\270\341\\\037\353]A\355\"e\230X/\260g`\257"
+	.ascii	"\027\370\236\204\275\310\334\3539\340\343r\\o\221\377e\032\246"
+	.ascii	"\232\275\320\326\3666\335\221\362\202?\330\362\227\376\304\322"
+	.ascii	"\252wq\005^\240\367\020\354L\260c\013\336\025"
+	.text
+	.section	.gnu.lto_.symtab.2d13c69bb567ee1f,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"mspSerialStreamPayloadMax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"mspSerialStartStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"cliSmartMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"serialTxBufferSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2d13c69bb567ee1f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
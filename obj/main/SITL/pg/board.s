@@ -0,0 +1,427 @@
+	.file	"board.c"
+	.section	.gnu.lto_.profile.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 H\345\001"
+	.string	"\324\002<"
+	.string	"\006"
+	.string	"\262\312\266\244\n\002\002"
+	.string	"\002\001\001\306\367\202\274\003\b\002"
+	.string	"\002\001\003\351\232\206\240\003\004\240\342\234\212\n\005\006\240\342\234\212\n"
+	.string	"\005"
+	.ascii	")\362w1\270\270]B\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 5\025\001"
+	.string	"\200)"
+	.string	"\002"
+	.string	"\001\001\001\200\004"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	" \210\232\211*\026R\fQ,\274\330\261\001,"
+	.text
+	.section	.gnu.lto_.inline.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 \303]\003"
+	.string	"\262\005\024!\240'\351 \266\211\277\244\365\365n\227\207H\204\b\255F\333@\0330P\225],1\244\035\271\021\271S\377+\262v\212\305\201\221\274C\004!\320X\020#\200!\261|?k\263\226\376u(>\033\026\332\"\317\260m\217\377\361\276\357I\202\266\312\363A\t"
+	.ascii	"7\007(JC\0262X\3027\200T\205\020-\205\211\225Z\017\006X"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"]\003"
+	.string	"\242\304\016\030\260%\351\fC.\230\345\025\r+\345\"7I\222\344\342\"!\313n2\311\033\321\246"
+	.string	"\321M\370\301\013\036\243.\375R\316\200\350\212\370\b\331\224E:\233\316\333&\272Y\303\217+\004\022"
+	.ascii	"`\204V\027e\245A\034\020\301\312\030Y\311\265U\002\270\203\306"
+	.ascii	"T\020lN\016\331<\364Rrd\205X\224\261\240\332\007\314\2167\320"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.pureconst.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 S5\002"
+	.string	"\224\003?"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\002"
+	.string	"\001\270\006"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\330\003\b\b"
+	.string	"\200\214\201\200\376\215\001\001"
+	.string	"\320\003\b\020"
+	.string	"\200\200\203\214\200\f"
+	.string	"\0071cO313"
+	.string	"\004"
+	.string	"A\031\b\334"
+	.string	"\026\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.dde9aca518d149fc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardConfig_Registry.12.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 \220\035\004"
+	.string	"T\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\254\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\334\006us\250\365\005uq"
+	.string	"\005\001\006'\001<\232\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/board.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.13.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375`\266\002\305\022"
+	.string	"\326avE\340P%\035X\270\345h\016&H\374\313\033*\241\271\303\245\317\330\236\270\362\2760\024\303%B\331\246\376hMYq\234$\354\332\340\226\337N\264G\356\3038\201\201\344\271\t\036P"
+	.string	"\234>1z\035\204\354\275\245L)a"
+	.string	"Y"
+	.string	"e"
+	.string	"&\300\035\232v\221x\310\035$\036\032f\337 \271a1\345,U\355nKG\034vn\213\360i\302\374\315\244\243\233\305\316m&\"vz\276]\326\363\370\nL9\341\370\230\345<\021\035\023\035NB\236?"
+	.ascii	"3\236\353\307\314\346\r\330\335+=?\314j27\223\335uv\263\235\273"
+	.ascii	"\343\266c\266\017\330i\025\2731u\207xeIa\303&\257\334\221\266"
+	.ascii	"\013C\276\273F\022k5U\2431\233\026K\r\262\377vw\255@\366\223"
+	.ascii	"~V\2469\230\336b:\3024\324\364{i\325tf\372$\352!\207EHmW\247"
+	.ascii	"\226c\243 \f\"\017\333O\373GG\202=\211\346\001v\201\240\232v"
+	.ascii	"i\006\002(\361\035J<\214\372\026U>H=\262\254=\rzJ\264\035\274"
+	.ascii	")eDHB\211**\220\f\271J|\n_lxp\027\020`\204\247)e\024\005\222"
+	.ascii	"\357*1U\325\236@!\337\031\301\017\316Wp\350\354\225/\265p\273"
+	.ascii	"\233@\305\213\0137t\350\323\304CU\225\352B\310\262fV\3321\026"
+	.ascii	"\362]jZ\235\210\312\r01/2\256\023\017\267\224Tx\255\270XZ03-"
+	.ascii	"\231\230\225\013\255\226W\206V\311\210]3.\257\226\006\227\353"
+	.ascii	"\325\362\240\355\337*\220_\021\b\253)\231\326p\206)\275\306\203"
+	.ascii	"\252\3629\242\222e\355\351F\247h\023\220,\265O\024\344;\277\013"
+	.ascii	"]M5E\rBqn\001\247\221\350\007:\235\206\321\231\036u{\232\261"
+	.ascii	"\3711.\203\301\373\220\033\0046 \240\002\221\031\333\003\244"
+	.ascii	"\311\033\206\036\227\030\\`\305\313\336D\211\002AD\217P\323N"
+	.ascii	"\373\2739\036\033\370\316R^;\3634\315@\372\367\223(\346\0353"
+	.ascii	"\220_\370[u\324P\337\256\223k\362\261\255\220E;\310\214\312:"
+	.ascii	"N\334K\\\364\355\230H\300\224\304\345!\334\366Q\250e-l\337P\325"
+	.ascii	"\305U}x\003\214\331\202m\026S\302/\331\236\3308<P\303\372pO\312"
+	.ascii	"\rqok\215\036"
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.part.0.22.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\275\013"
+	.string	"V\026N< 1T:\244W\202\001@1\340\250\374y\013Q\335Y\\k\331\214\002\3158*\252u\3641^\255\230\031\214i\235m\003@\240`7\0218pH\r\350\025\3678H\016Ad\023)S\n:"
+	.string	"<"
+	.string	"<"
+	.string	"\005\260G\373)ls\354\325C\323\206\374\331+\210\006"
+	.string	".8\250h\354\356\366\250#\376]\363\372|P\324\271>\365\004E\037\236\004~9\032\354\2563\020w\274m\211\355\005\366)\004\341\237\232~\206\240\203"
+	.string	"\021\273\240\215\032;\2120J\330\276\375\024\307\3264g>\344\034\265\201\204\353!\344L\373*~\372\216\332|\300.)\306\213\335P\301\243\023d\217\016o"
+	.string	"{\314\036\256X\362\240\031\2146h\307>\013\f\231]\341+.\331\356JT\031:\237\304\243\277\301\036UU\006\030\302\223\033v\244\255\271\220\007\257\017\220\211\026\353\243\235\324\222\365\372\265J\262\257\264>\025\313\004L\347@\363$\"\301\343\272\b[%\263a,\334e\233x\232-\362p\227\241x\233\205\256\3636\355\327*\311\327\211P\213\345\321\217U\265t\016\263!\274\005\3670=8\241\230\021 \017\234\202]U\035\030"
+	.string	"d\311\343[\f\271\025\030\017\276d3\206\026.D\bD,\211\ts\022\253\375ZV\001\357\001\024.\033\314\232\0254Z a\351\234rxg"
+	.ascii	"\316\b\341\256s\031\035\363\316k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"M\006"
+	.string	"\"\t#,\200\305\351l\330\310\304\005\316\241\013\300\227D0~\354\332\204\337\214\244\231\306\334(\212\016\001\002of\330DDD\204\226\232p\233l2\005\217R\265\"\020"
+	.string	"p\335\347\213t\037g\352'\351*%\352n\352M\224.\342\273A_\215\253\214-\214\261\213/\213\265\212\t\332\335\277a\200\342\201N+E8\275\030\301\037\322=\034\fn\321)\270F\342:#\321\004\241\f\376o$\346\3620uh)\247\345\347?#QAw\267\303\205\346\277N\002\030"
+	.string	"C\030\304e\343\234\005\273\f\335\032\3554\001\267\n\301\330<P\3260@="
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.ascii	"8|\200T\270\024\306\202\341\362\003\243\261\322\251\005\303B"
+	.ascii	"Y\035\334\240\203\351\004"
+	.text
+	.section	.gnu.lto_.refs.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\n"
+	.string	"\003\003\002\004\002\005\002\001"
+	.text
+	.section	.gnu.lto_.decls.dde9aca518d149fc,"e",@progbits
+	.string	"(\265/\375`\301\0225a"
+	.ascii	"\252\251\034%Q@PJ\032\016\353\272\2522\227\2372h\004\032\332"
+	.ascii	"\343\224\315\312c \342J\251\332\336S\314\320Q\370*\"\001\006"
+	.ascii	"'\002VCq\207\334\r\004Ea_&\214\231 ?\354@\037\004K\377\376\223"
+	.ascii	"*;#~ \223\375\320P+\225\263 B\267\021\335D\312\024\360\0016\002"
+	.ascii	"J\002*]\2075\212\315\033&\254~\265\326\357\263\312ZY)\263\201"
+	.ascii	"\030\316\246\335\317\237\220\333\265e3\033\223[\263\315\262"
+	.string	"R\246\372\004\313\264\273\277\354\r\013f\3476n\243+\267p_\033V\372}v'O\374Gr\333e\337~|\335\3102gw\177\301\376\245\362\233H\261r\353e\255x\210\352\036\202%\364\345\f\207\025^\367s\304\210\021\035F\214\340\361re\214H\217\372\342\352\223\356\320\257\201\340\372}\373\227lkX+>f-\200m\261\272mG_7\037\266#SV\r\340`\345^\266\177\265\354X\317\331[\224\213\325\335r\364\345\242n\251\251j\302\252Z\301\212\263Y\376\275\262e\253\366Aw\262\273\005\360\021\213\"\345X]\264M\373\252-\r\275j(\232\335\310U\003\272\351F\002wC\354\206Pc\320\362\272\362S?\301\272X\216\276gB\277%\363\331\300Uo\213\016$\254rp`\335\256\035\372\r\255\320\017\304\n\375\210v\350\267a;\303F?\254\330M\244\270\357\030\326_\335O\240\217\236\024\275<V\237b\375B/"
+	.ascii	"\262S<\200\365\373\341\267{\373\341w^\217\266C\277\022l;\364"
+	.ascii	"\373W\206\177\247\354\327\007\237r\252\331c\335\317 \340\363"
+	.ascii	"\007\325\026\253\177\356\320o]\241\337\326X\341\377\227\377n"
+	.ascii	"\020\250\360o\n\377r\b\372\227\315\177/\377\333\\\357?\n\377"
+	.ascii	"\347\376\213\375\227\373\257v\002\324\1770\377\271l\b\306\177"
+	.ascii	"9(\376\267[\342\277 \374\273A\210\177\327\374{\364/\212\177O"
+	.ascii	"\374[\342\337\242\177M\374\253b\207\376E\340_\022+\302\177\340"
+	.ascii	"\317\303\177\237\376\025\376\353\364o\323\277\035\374\253\301"
+	.ascii	"\277\021\374\333\342_\006\376]\340_\005\376\357\375\317\373\357"
+	.ascii	"\346?\335\3772\377\247\377\357\376\327\375\377\372\317\341\177"
+	.ascii	"\333\177uooo\357\337\022~~\363\003\033\b\353}8\326\237\177\260"
+	.ascii	"\017\034h\0274p\354\303\n\307\275ME\261z\237\324\nD4\305:\270"
+	.ascii	"\352\327\001\306\200\306U\246\267\236\251.h\301\206\262\257\375"
+	.ascii	"\030\3079\307\257\303m^N*6\353Y\3117~\235\037\272%dU\312\254"
+	.ascii	"g\0338e{h\202\260\312R\253\024\307\211\330\301:#\"\204\325\263"
+	.ascii	"\324\317I\256a\302\336\2335\254\236n\207~>+\364c\344\3219\212"
+	.ascii	"\007n\313\224\n\253=|\246\027]\275\335\353\020\326;\214Wxh\301"
+	.ascii	"\353v#\241\203e$\212yg\367d*\261\200\261z>"
+	.string	"\262\246Y7i6\357\327\275\317f\325\262\231K\242\357\231E\363Us5\233\267\275\354f\256\232\035hl\315d\022\255uT\226 \333|\363>\246\247=\360(\327\344`\365it\366\255\n\312\205\r\036\217\0223\251\027\235\007\322&=X\215\356\232\205\373\337@);\263\2646\353\367m=\377\277F.\273{\007\316\263\227Q=_\234]\242\337g}{@\373>8\273\257\246hV'4 \205\034D\037\206\356cP?{\251\204f\035\225\321/VA\317.\"@C\267Z\371\314\262R\233\315\375\354\355d\226\225\b\312gs\251|6\217@\235l\036\273\237V@\3121\344q\225\320,+%\264i\025\324\311>6\024YdM6\255\224nM+ %\024i\245LfY\005\001\231\036\241\272A\005\351\265Ge\262uP]!\227@R\345\263\331t\335;&\325\313\003\272\257\232K:$\220E\213\222\352\2102C6{"
+	.ascii	"\252(\255f'\245\312'\315\356'Q2\232\n\305\361)m$+=n]\365\224"
+	.ascii	"T7\001\375\354\246\352>nK\273\373\330\3359\313\253g7\013@J'\025"
+	.ascii	"U7\263\003U_\035\323\244\272y,\f\232\225\022\252\325<J\023\203"
+	.ascii	":\333\306\363\270\316\246\313Z\256\320c\225\236\352\356=\263"
+	.ascii	":\255x\2301\223\345\007\006 kc\254\356\230%\263\321\267\355\364"
+	.ascii	"?j6\310\332\230\254_a\337&\346n\351\234XnwvSzp%y~\351\244\345"
+	.ascii	"A\361\301\352\277a\266NG\f\021\2714\016\f\346\013\307y!\242\225"
+	.ascii	"d5n\325\"\210\"\304\216U\366\262w\276*\344\23026T\341\302\205"
+	.ascii	"\335\026Is\205\301\313\312\225[\027\035&N\264\246X\345.\3145"
+	.ascii	"p\333\271\013\263\365$\271\213\272!~vC\340\254)A\316\360S\217"
+	.ascii	"3e=N\022+\3472+\274\346\213\353\351cXW\345\224\301\020\246\013"
+	.ascii	"^+\231D?9\310d\031\341\263\363\332Y\213\211\024\027#\344\022"
+	.ascii	"\023c\225\263\234\325\220\234\021S\246\261\032\223;3=\252\225"
+	.ascii	"\321\0228V\233\"nh\330\351\372\242\004\n\253\214\345bN\245\006"
+	.ascii	"\005\213U6;\031\037\263*]W[\306\007\247\025\027\305*\223\235"
+	.ascii	"\257\374::jC\214d\325\030\373ur\256\314"
+	.string	"\tq\262z\234^\257\262Y\017=C9\272a]\365\253[\316\265\301\353f\022-V\024gV\232s\3647\221\202}\354@\303\274,\321d\370FY\006\016\243\240\221VD\\:\016\f\257\227l$|y]\270\264\260\312T\370\271Q\"\256\362\335\302`\327I>\033\2523w\006k\214k\375\022\375\200K\364\003\241\376\2302\005\313\016\231\256\363b\365j\r)\337(K\331:\n\200\272\265r\240\365\222I\002x#yD\312\314\372\225\262|</7\312G~\241C\225\347\221\007\215\331\0164\274^^\221\310Q\322\006\267d5\3123\231\223#H\331\030\230\365\373\325\203\177\3301\017 \354\343+L\223\263\242\330\260\305IV\312\004\352\344\031\231\351\227\223\231\354\343\347\030\324\275U\347l\302P\370\t3a/v\262Qv\262\326\331\212w$9\b;Y\b\023Yi\327\003_tS\236\2714^\322\037\265\307\305x\210RR"
+	.ascii	"&"
+	.string	"\346(\t\033a\027V\312|\366\216\016\306\fQ\303\373Y\t/\331('y\207g\367\210\021\003\370\344\325\341\201\375\\h\241\007\r\207\020\033\2542\222\205\266\345\330\212\036\331(w\001m4y\263\204U\346\272\230\033G\034_S}\244My\013[\357\373Z\357\363*\262\202\231b\301!Y\3573\262\362\025cmT\004\0179\263\300A\216\203|>\201\354\302\033\262\031\256\326\257\210\237oooE\374\356\003\262\362\n\375\200|U\001\306 \214\342\213!\013\214A\246\240\0264\236\224\204Dc1\307i8l\201\204c\f\302(\276\370\0216\021\215E\243\340\022\224\223\222\260\311\210X\2042\n\300\311\tJ(\034\nsH\030\022e\030\207\302\234\030IA'\225\306\223\322\214\340\214\337e\024\rc\b\233\220\224b\3000\006\231*\310\340\005\f#\020F$\023'BP\032:\271\b\022\207.\2004\236\206.\200f\004\215E\0320"
+	.ascii	"0^F\021\323\223\021\323\223\220\222\020\212G\030\203\2118E\244"
+	.ascii	"\036#\222\220\351\tG\310\364\3443\"\2518Z\325b1H\\ZJ\312\241"
+	.ascii	"\3614TR\211\306'\337RP\310\324\344\224\224\263\024,B\251J\301"
+	.ascii	"b\316\211HLOE>4\210\306b\023S\020\003$\016\227Q$\0346\025\211"
+	.ascii	"\301\021\214\226\234\232\240@(\300\030d\"&\031w\2564T\242\310"
+	.ascii	"HLz*B\022J`\f\026\203\0300=y"
+	.string	"\270R\0231(\f2\255G\241\"\001\025+J\310\371\n\026%X\224\370}\005\213\243#\026*\216\326\2538\362\031\221\202&4\025\177\306\313\b\340\303\247 \321\3108\034\022\215x\214A\030=E$\246\246\030\302\241\013\237$!SSQg\351\0051H\2042*%\305\200\022&\315\370!&\311PR\2033\222.\3201\"\2550\n\233\240r~t\344\002\204\006\027L\260*\025\0311=\031\t\233\222f\030)\021\213FEC\306 \f\341\260\311\2304\2038\214!|\261DL\032\202 T\343>)\240\231\037E\204\260\352\213\362%}/8\257\324]\314\307"
+	.ascii	"\235\334\251\201\261\352;\372\220]N\262,'\363)\020\357\t^\030"
+	.ascii	"_\257\345\350\230\222\307\265\307Q\3404\017\013\026\353\275\275"
+	.ascii	"}\241\215auon\352\006K\336\331\315\231n'OK\234\034\253\314\206"
+	.ascii	"\333\354"
+	.string	"h\231I\245j,\375Z\322\305*\257a\274\213e\335@[\356\320\261`c\215\232:\034-\3156\3124w\252\026YW\0244\354\326\302\314\224\021>\303v\203\230\033\231\231\274U\r\017\267,V\247Sv;\342\234k\203\367\263k\022\346\b\335\230\177\f\337\335\227\354!18s\316\246l8\266\330\331\361\335\336\240\0036\205\203\312\335\357\323\003\b\034\036\031\334Yz8\256\363\251\331g3\233\3072+\326\224>k\262Lw\310\235\353\316t&Rp\034\025)h\254X\345\033\346\002\201a\250q,\207\2244ffF$\030I\223\244\003\021\005\204 ')\264\033\021`)\203hjF\222\244\320n\351\302\027\244\350J\n7\277'\036U8\345\241*\271\262\213\212\215?\273\n\370MXx!DT#\200k\026\030\017\236|N\366q\221y:)\301\374hzq,j$\234\316I\323\r\340\306W\023_\234\270\r\323\201*"
+	.string	"V\016\036\3475xo\310\377\237\re\241\231\300Nq\240_A\351R\235a\020\263\365\203nu\007\210\341`\017$>o`\206\270Xm\240?R\006\006_E\306_(CAVzoe[d$\031\241\236!\274\272Z\177\202D )1O\337g#\250(\016\005S\220s\263t\037\036R\030\312\240\3617\274\320F8\3722HiI\177\235;\241W\037\253\217XW\265\352b^\021\205\340\331\303I\223\261\240\350\204\354\230\365R\315\3178)\006i\315\252r\270y7\3066\276"
+	.string	"\t\333\024\234\332SJO\264G_\305\3639\255\025D\370\252\300|U\020\220\352\265\270\242\017\263\267\331*\257\\\333\223\by\")\315\260\030\\\235\363d\303\034\313\034\222|\313d\274\350j\332i\3252[\363\373\2369\274`\032g\376\304\202\355\022\016M'e\036\336\036\322R\323|\363\020}OmB\333\001\374O\020\215\007\244|%\250o\351&\335\235\3517\230\037\245\262\242\332'B\321\334A\270\206($c\271\206bD \266\314\275c\261:D+u\007\243\372\244\271\021\317\203\t3\333A\216+\333xH\340\035\300\323%nhqN\262.\264\311&P<\004 aa\361'\007\312m\330CTP\235/\034\361\337t\333\322\222\032L"
+	.string	"\307\303\346n92\365j\221\271\205\3753\277\220\307LXjM<Z\326\361>_vV\330\244\341E\203\330bl\240uY\251`\275"
+	.ascii	";\202\315/\030\030Q\341E\211ld2\377\203\305\3627\235\351\336"
+	.ascii	"]Uv\311(\250\360\332\013pM\177.\203Mt1\310\006\004P\260X\252"
+	.ascii	"G\253iC\2476\227\233<'=*j\035\034\224\300\256H/\313M\322^w\326"
+	.ascii	"\262U\244\257\246&\340\3413~ \237\320\2612\273\032\215\351[s"
+	.ascii	"Z`\234q\177\320[\314-~f&\315T\335\341\247\027\366\031B\250L0"
+	.ascii	"\212\023\022\340\214\357\262\206\213\346\260\300\204D\322j\334"
+	.ascii	"\035\272\340\262\n)\207\246\2374\312\302E)\204\b\343\342(\201"
+	.ascii	"\214\2574\264\270\317\245\353\202r{\360\230\241=\023\252\022"
+	.ascii	"x\003\243i\360\2176\257\246\262\021`\3661?0\232\204Xg=\262\375"
+	.ascii	"\037\273\255\247\301\274P\277:\334\016v\224\241_\346A\242\031"
+	.ascii	"\267F\301\357\2732H>v\217\032\254\255\307\036\300\272\n"
+	.text
+	.section	.gnu.lto_.symtab.dde9aca518d149fc,"e",@progbits
+	.string	"pgResetFn_boardConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"boardConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"boardConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"boardConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dde9aca518d149fc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,542 @@
+	.file	"pg.c"
+	.section	.gnu.lto_.profile.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.text
+	.section	.gnu.lto_.icf.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375 |%\003"
+	.string	"\324\004p"
+	.string	"\t"
+	.string	"\247\267\241\312\002\004\002"
+	.string	"\002\001\002\002\002\001\001\227\267\273\373\r\002\004\203\244\355\233\004\003\002\001\007\262\211\373\251\013\002\b\276\362\342\333\004\t\303\341\316\304\007\004\002"
+	.string	"\002\001\n\301\256\303\221\001\013\333\205\320\333\016\f\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"WE\211B\241\234a\300\025\244,\3529\245\314\3206\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"%\004"
+	.string	"2F\017\022\260%\351\035\206a\0300\026\3156\262Ik{\313\224\002\356\002\024\206M7C\244\354\270\"Dy\217z<B\314\303B\322G\343+\225)\005\236Y\r\3241\024Wm\301\336\034mc\271\020\035"
+	.string	"\020\244e\b\266\n"
+	.ascii	"\331Y\215sW\326\316\034\0057\020\035\344\"\204\306\022\332`\201"
+	.ascii	"T\204\255\212\321\n8\017yX\035f\r\205 XP\267\201\025\231\006"
+	.ascii	"E\031\340\f \325\316U\256gn\272\251\34540\004"
+	.text
+	.section	.gnu.lto_.inline.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\212\001\245\b"
+	.string	"\242M-2Pm\222\016P\364\b\354\022S\0224\b\264\246\256h\300\250t`\252-O\3347s\031\036\303\236\231_5733k\213S,6k\277\265\326\310\226;\005_\205\331\207O\3073)\324\341\323\361PS\250\nt\327\031\2748D0@\332\223\206\350\007&* 6\002\236*\374K\217\335w\200\037\231)-\335_"
+	.string	":\013\347\306\351\r\220\"\304\203\244\365O\323\bK\243\203`\3663D\257\301\221\205\213\222J\377\022jeH\\\324w[8\370\003\260v\253\306\264\2631\210\227\335\313\335\233iff\364\233\314\264^\272"
+	.ascii	"\207zQ\2577\234\365\306\017\241\026\231I\371\351n\002& p\002"
+	.ascii	"\241\240\216\017@\025s\276X\261u\374\371\364 q\204\2418\006\240"
+	.ascii	"\230\340\306r\326\241\223rE\340\001\310\205\2659\007\204pj\036"
+	.ascii	"W\370a\242/a\032\316b\260P\326\373\364\302\323\026\241q\200\274"
+	.ascii	"\257\345k\304V\305\332\022\313j\257Z\214^\322X\371\315d\264\213"
+	.ascii	"t\r\255\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\025\001e\006"
+	.string	"\262\n\035\"\220\245I\007\177\371\244\347\035(Gh\376\377\277\304K\275\270\273\2738'\021\002\203\253\335\3356\337D&\031$\357n\354\033\353d\212D>\274a\364q\360\356\325\225\365>\360_\006\231\036]\360-fGO('`K\035\360"
+	.string	"\277\\K\022\347c=I\363+3\212.\221o\025=\364\023RJI)\314\307\320\177E^\313\341\345L\232\365\210~9\370\021\013\326\b# P\2421\312\354y'\224-\305\212\240\271"
+	.string	"\017!8\234(\033s,\334\200\346\036\243E\207`\372\342\242\332\020b{\334\235P\300\370\n\321\007\353\035\004\037\317\031\357\332A\035@\313\332\336\005\004\346r\211\241;\016p\200\240r\267\306#[\001\236[\232pR"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\001\205\004\004\231\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\245\004"
+	.string	"B\306\025 \260%\351\200\303\260\b\360ra \313\032\200\212\002\246\b\364\201\330.\326\266fm#\226\020\"e\n3\205Yi\266\230\302,u*\017tP\264D\223\226#\270\033i\037\005\026\3278\241\0024\206\32668)\232H\251\020d\341G\244\336\335\234\243\366\243|9\033\023\236'\030"
+	.string	"H3FSbES"
+	.ascii	"\327)\214\303c\r\b!#`b\300\\(y\207\351l\331\303Y;\354\001\300"
+	.ascii	"\305\200D\320\262W\334\202\3247-Q*9\327\330\026\001 \274\001"
+	.ascii	"\300\001"
+	.text
+	.section	.gnu.lto_.lto.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.9.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\371\001\365\021"
+	.string	"\346\242yH\340\322&\035\222c:\017\371::\025A\346&\332\207\270\3331:\305\232\227\324\271\203\016\372\355u\\\350k\312\206\333\340\333\020\221\334\322\036e\2529\346\2141\346\214JI6\205\370\035^\332\223I\313\356\266h\204\354\275\345N)g"
+	.string	"_"
+	.string	"i"
+	.string	",\023P\247&\302\317\253\026\244V\3203\370\022\372\331}\204~\356\b\323\035\234!\035;8CH\227\340M#\353\034\235r#\313\307pN\344{\275\366H\363\265\"Ma\3639i7`\237\207K\331\240\207\207\204\310\227AnP(\303\364\271\342\276\366\222\330\f\311\366\331<r)\265VG\330Wsw\267\r\302\266\003;\222\004\356\270\203?\235\321\323\321\361\264\373"
+	.string	" \274B\222\260V\0167!\025\307\214\201\342\264\337\276?{h\233\f\363\027& \343\251\265>\310\257\3714VJK\303\203!B>j\005\025|\372@\007c\233>o\307\330&\333\033\355\373\374'\346\240\005\317ZC\330\214j\005\027\330@\367) \276\305]\3048#\364\313I\026\035\212fT\264\342-\256PNl\306\224\373--\215\007\020\345\374\220+s\267t_\3737\324"
+	.ascii	"\3758\342\341\212I.p{\013\235\333\255\t\220\327M+\336\374\320"
+	.ascii	"\251\333(t\265\272P|\241\013/\376\211O\237E?\347>|\274\231\355"
+	.ascii	"\240\321\343#\023o{\324#\310\266+\263\301VD\311Q\243\2047f\227"
+	.ascii	"f\f\236pZY\255\313I\265V99\251\274\223\312sa\221\320\342\251"
+	.ascii	"\254^\274\223\021\247T++\257B*\265\362L\226\371\306|\240\313"
+	.ascii	"\025Da\021=\214[\2266\306u\212\314\266Lp+3\203\017\223[.)z\005"
+	.ascii	"\205@\347K\343\033\241\272Zg\016\363\211^t\222,(z\030\212~~\003"
+	.ascii	"\210\230\331p\305\244\313Zk\245N\360$ @\002\204\234\345\001y"
+	.ascii	"y\3211\261\331\330\2030\370\242@:\227\031\370\250\337\213\254"
+	.ascii	"\262\345\264|\263H\273%\275\270hb\017\205\201\037\275&\03294"
+	.ascii	"t\027\005\364SU\226\335*\333\376\320\236\240\r\266|=\271w\370"
+	.ascii	"\031\341\345t\347\024M\376/+\"\303t\0312"
+	.text
+	.section	.gnu.lto_pgResetInstance.11.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`L\002\235\023"
+	.string	"&$\177H\300\322Q:S\220\202Sl^\266\362N\202\201JD;aY\305\004\f\013A\304\001\034\005\356\201w`j\326\376\257\207\337\016\266\004\266\366G\315\250K`R\032\202\004\300\004\2533B\377$\227=\241\262\020Mm#\233H\231Rm"
+	.string	"_"
+	.string	"k"
+	.string	"\273>\006>\240z\264\357\255\360Q\365\222\360\3213\273\207"
+	.ascii	"\034\200\033:\025O\273\353\322\021\237=\025FPs\346\247Tnf\354"
+	.ascii	"x\264\247B\260\004\304Q\023\213\247\003\0274\235"
+	.string	"\b\261\342\3452\352\007\037;\336\315AP\201\023\f -\233\022\273\025\357\226\312\342\341@\223\335\275\320\263\003\317\226\231R\331]\347\216\347\341V\335v\215\355\024;q\001/z\342,9-\005\365j\371\263}\266T\035\373\340\356\2565\307V\245Y\367\375#\252\264\310{\277*\225\216a\032\f\323\032\323\t\246OB\262\323\372\355\332\374\206,SL2a\373>\321\213h>\344\024\037\240\335]=\3324\366\352\361+\333\351\333\360\224\340i?\305\203f\357\325<\300nN\r\244\t\365\334]\232\032\351\205\200g7\367\235\357\342/$\200\236\360\n\277{\205,D8n\te\233\302\217*\264v\330\026\316\342\302#\213gwSO~\204\364H\362z\362\021\265[`\371\235MrJ3K\257\027z\353\307\246\303(\312\300\357\261PDY:@I\207c\313\237_d\227\033eP\355\336\032\370+`^|\0225\341\243\210\006\306"
+	.string	"\233Ya\001c0\231\272\005%&\343\212\311\270`\\V^\\-\262\031\027J\211cd`2\227\206\230\030\231k\345\253\035\\\315\211?\230jjK\025\310\b\252MpQ\337\"\025\324\210\302({D\344\360\t\035\204\252\034\210x\244\252\246v\202\350\242j\371\263\366\f\031\321\210\004\362\232\372"
+	.string	"\002l\211)\2474\313\b\002\342\001U\307\217\361\272RR\004\355\021\331\270\0052 p\002\231\261\345\001\001\342el\257Fk\022\032\274\034\212\022\031'B\257\354%\3601\347\001[\241\256\206+\373X\031\323\005\213\207]\345ar\272\272\315H\341\031\020`\034V\325\332E\261\255"
+	.string	"\254@0l\266Uc\020\2445\017y\332\001\225\nR"
+	.ascii	"\202|Q\020\216\233\b\024\315\302\325\024z\031G\004\320(\300K"
+	.ascii	"\260y-e(h!\336\376e\353lB(\003"
+	.text
+	.section	.gnu.lto_pgReset.12.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\325\b"
+	.string	"FR?7@\217\322\001\300\026|=\016\206\211\345\035\355hc<\001@\027\271\271\334\320\217\376\217\314\212\207\314azD[,\245ab\236FK\327\260\003\035I\300`2\270\255\224)\005."
+	.string	"0"
+	.string	"-"
+	.string	"\376N\200\035f\317`\207\366\354\024\003R\200\013c\305\262\273Q;\356==\377\251cJ\246\320\023\200aw\235%\223\306\255\267\215`;\301v+\002+\005*\273\031/\327\262 \n\210Or\325\347\237a*dw\265C\373ck\207\327l?\355\213|\304;\n\364\201\335\223\311\311\356\247\340\203\3540!_e\317W\024\331\356\305\202_bQ\341{\034\372 \354P\365\252\347\306G\013%\312\227\375\215R9\354_vw\255'[\323z\324\2370\033\247So4['n\235\030\361\340"
+	.string	"\0217\235'j2\346:\234.Np\\\027\265O\364\313\352\311\360\305\022\351\310\230TM\2659\211|\311O\275\241\205E\322\t"
+	.ascii	"2\241\373/\260\301\205\003\227\321L\305\003T\210fu:\\\303\013"
+	.ascii	"a\222\001"
+	.text
+	.section	.gnu.lto_pgResetCopy.13.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\327\002\375\026"
+	.string	"\346\352\226J\260VU:\364\006X\276b\321\210\224\177n\240\\\253\201\214\306\257O\266\211\302\022^\246\231vg>P\301\212\364L\337\277@\330\261\353\031X*mP\177\320\377\330\376\300AS!\312\371.\234\372K\260\3510\310\020!\204\020\271S\n\205"
+	.string	"|"
+	.string	"\202"
+	.string	"6P^\364\371\225\361by\324x\021A\202\230e?Oh8\t\f:2\232\324z\246\326\204G\240\236\337\020\240\236_\322\303\363\026\251\354%9\212\341R\231\217\363r\001n\211\220\223\021<\270\223aK\017\013\337\203l\300\205\002\206\324p\361\235\016\035Sn\265\377Nwn3*\256\350\3600T0\024\204\"\345F\013\267\210\267\303\274\325\350\376\367\225\334.\251w\353pJ\312\324ZMm7\236\333t\333/l3\260)\216D\277\370\242\177M\375\323IH\210\017$l\233tV\rKO*\020\361\306\317}\277}_\306\217(\274\206\t\350\202h\334\347\377n\024\2439#\241\240\317x\317\260\307\360\311'\304\207Z\353g\370F6\r;\357Ffv\241\206\274%FB.\027\355R\302l\223\202m^\274\035\263M\333\341y\030\261\027U\260X\253\b\037Ky\021"
+	.string	"\245\324\276\320\207b'2\222\253\324\232\373A\252\365<\020\253\262\326\332m~\216\353\230\tU\253\361\266\325x\221\334S\211\235\017\032U\nk\255Ul9j$\027ec8"
+	.ascii	"k-f4@\344x\204\253\263iw\377\3733\360\300P\022,B\243J.\260t\326"
+	.ascii	"X\256i\0070\321\301\315\350\222\177d\232\333\220P\326J\203\361"
+	.ascii	"\221\\5\276\317\315\376\350\024\267#\362c\210(\207.m\360HQoW"
+	.ascii	"g\2373z\230 =Rxs6Im\242\224\324\246\222\272\274\357&\037\216"
+	.ascii	"\300Z\275\326\206\345\332\n\256\226*\264\352\205\345J\261\\)"
+	.ascii	"\033\232\231\232\224\352\005K\275\240\334r\255^\251\t\255\326"
+	.ascii	"+\3453\347\233\363\030\304\361\200\243wo\020\314\300\003\222"
+	.ascii	"\277l\374\356\254erv\346S\242\250\270\346\332\016\036\320\335"
+	.ascii	"K!+\220\234$\261\2608\001~r@\344\352\302\027G<\240x\340\035."
+	.ascii	"\271&\360\346~w\2253\210\243$h\204F\225T\214\253s\214\207\020"
+	.ascii	"eI%\372\036\204\025\313\trw\334\373\2166 0\002b\234\313n$\302"
+	.ascii	"\013\232\314\321\364\fn\305^p\374k8d\346\027\323\301\333\250"
+	.ascii	"\330\232+\203d\310\326_\216#[\005[\353k\375K1\274j\034d\020\007"
+	.ascii	"D:X0\205\202\270\204\276\332\252\205/\264\264F\260`\265\312\340"
+	.ascii	"\016\027Lh<\242\371:\332t\262\205\300\236\235\357\260(#H\324"
+	.ascii	"\261\260\303o9\372\313\344\034\275U\270\230\t\200\343tk\330\351"
+	.ascii	"Fj\256\261\271NH\022$LW \003"
+	.text
+	.section	.gnu.lto_pgLoad.14.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\334\001%\021"
+	.string	"\266\341tF\360\322f8\260_#\033\016b\f\316\207e\021(\016`t\254\032\257\177\333SL\001[V\341\316\251{\213\020\001k\277\276q\363\"I:\265\301\322\017C\362\276\177\232:5\326>Y\025\241\325\330E\275\311\336[\312\224\002`"
+	.string	"^"
+	.string	"a"
+	.string	"<\204\020d\332\227\361\034\326u`>\262{\363C\333\035Kl\340{\347\361\002\274w\337I\274w\266\275\340\204\345\326\307\0255\2679\001\202\206mw\fU\305[\3474[>\b,\346\334G\342\3125\220\355L\004\366\342H0n/\036{\322\300\\\231$\224\335u\316\300F\334\335m?\260-\301N\b\001i\360=?\310}\376\222\323\037)\355]\347V.\235"
+	.string	"N\210l=\b\004\355\326\334~\254\216\016\207\013\333\367m\\\266\372\217\273\235\331\312\257q\240\227\377x\302\r\333\356\202/6\370.m\226\r\332>\256q\001\366e#B\0017\343<\254\367\270\346\322n\n#\332\356\2268\301\367\256"
+	.string	"\247\243\003\007vf<A\261#\323]\363L\n\352\200\332\207#W\336|\231/<G\212I/{\2320\032\262\211\244\247\235\332'T~\306\217\235B\f\232\017\"\017\032\343\0039u\332\206o\367\305\300\237\271\254\370,`\274w\236\036\350#EC(rtd\362f\217\256T\034\373\334\356\256\365\306\376\370\207|i\323\027\326\300\242J\255\304\023\007\322\251Cj\305\255\250\304\f\034\352$\252ULP-!\252%dI\245\254\204*\342*4!\261\252\345$\206.*\225\030\202\243\314\365\306\217=\302\216\026\261Y\372-\317\372\251*\215mU\243\310\250\213#I\020\r\251`!?\363\251\2471\016J\030\205P\305qIS1\360\b\275\262\310\240\246>\366\037"
+	.ascii	"\326\324a\030,\326\323\361P\263\327h\323z\bb\2313\342l\240\325"
+	.ascii	"\302C\364n$\246\210\230 \3045\033L\023D\250\260\240XP\367\200"
+	.ascii	"\332L2\266\002#\203\032\001q\0031\340\312\022\306\r\252\006\334"
+	.ascii	"\003\303\026\240\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_pgStore.15.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`o\001\305\016"
+	.string	"&\235dE"
+	.string	"\257(\035\307\370\304\334\255\215\244)r}\003&\013|URC8w\007j\306\330c\037[\347q\337\037\264\337\320+\363lu\213o\326oN_w\351\213\371"
+	.string	"\315\251\3064\020\273v=xi,!\233\020)S\nN"
+	.string	"N"
+	.string	"R"
+	.string	"\033O\373\255\217"
+	.string	"\037\216\274\263kR\302e7\344\360\201\356\233\303\316\266\037\342\"@;\246\205\034X\317"
+	.ascii	"B\345\272\331\335\317\300\005\304o\3325\3427\335p\360\t\372w"
+	.ascii	"];)q\261b\231\236\034\203\335u\256X\026n\275"
+	.string	"\355\r\333\r\354\313\002\351\370\360\337\256\362kL\247\246\017 \312X\020H\261[a&\333\231\r\306\203\355\373-\207\205\334\204\027\274\304\334|\305\016\261=\226\277D\276\342\315$s\262\273\236\210\355}K\033\264=\333\232Wq\314\234]\f5.\273\313a\004\231\342\026+\002%4*\325+\247O\275\360\364\372\226k/\246\030\0224,3\n\314\016\212Q=\035\020S\221\240r\346\303\034:\212\b\335.\005\005\376\211\322\207\337a$~\213z\330\223D\205\215\fJ\353\2243;D\245j\260\257\255\232\330\\\332{\312\317\351\322\235\2469.\206\360\231\020\002\321D\245\004}HjO\007h\364\201F\237\204\220\307\307\347!\201|\035\032\026\215>\244\257$\022\221>/<\335\3464@J\306\314IQ\356dj\247\034\265\037x\344W\276\353\016>\2040lRj\362_\366\034\346\323\351_\357\304\250\271\200\322\3424\365\256'\b\033"
+	.ascii	"\034\312\213L\333`\304\255\026\2244\364\234is\250\226\217n-\020"
+	.ascii	"KV\314\022.\214\204\317\262\b,_\212\210\320#g\260\021\324\022"
+	.ascii	"=l\210\206\004\300\212\240j\300=0L\240\"\203\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_pgResetAll.16.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`o\001M\017"
+	.string	"\246\\fF"
+	.string	"\257(\035\204\b"
+	.string	"\375e\024\005\240\306D\005\306\337f\253\375\350)Ech\337\331\"\2707\243\204Y\2405\361\350\207\276*%\311g\025\225m\277\376\267\377\377\272W\314\033k\030Z"
+	.string	"TQ\360\256'\226\354-wJ\001S"
+	.string	"P"
+	.string	"Q"
+	.string	"\007Y\373\227L\005\230\332\356v\312\301\333\212\t\r\316\212\t\315\354\022\274e4}J\215&\237\345\031'-T_\310\247\354\244V\036\006|)\371\ti5w=\222|\250(A\224\\\357z\202\023\033\325W\362\330a\260\273\216\252\357\302\275\3356\005\333\006\354\203\0018(4\314\350\f\334U\216\213\225\315\232\017o\375\366}\227\307@\016c\215\032J\313\356\376\3450\177\374e\375nj\273\373\026\337\365\021\007Moy|G,"
+	.string	"X\251 A\333\0055>\235\301}\032|\201\355\223;\306\366a\203\330\236\317{l\262Y\004R\357\272\024\361\335\240f\261\020\250\230\343"
+	.ascii	"q\352\325\207q\214\342U>\354\r^\310R\032\342\307\f\3413\035\334"
+	.ascii	"\256\210\002_f\202\004\277\203\307\3669\365\261\023\bW\240\270"
+	.ascii	"\274\234b\216\306\330\244>U\025\033D\305\177X!\315\232b\313\350"
+	.ascii	")\337\272\337y\242PI\r\332\020\221:\021\251{\3409\340\350@\245"
+	.ascii	"\216n\003\303#R\250\324E\030\215J\235\007<]SX\316\305d\220\235"
+	.ascii	"\024\365a\205\264\251*^\200A\245v\302h\220w\200u%9\341q\273#"
+	.ascii	"%n\"$E\336v\225\267}^\005lx\245\020\211\341\345\356\2564\002"
+	.ascii	"\r  P\002a\020\261\003a`\367\035\264\316\371\3331\2226H\302\242"
+	.ascii	"a\032\336\032\372Uoi{\3613\264\220\316\n0\241\235P\230\"\266"
+	.ascii	"\267\303|3\3356OL4\027\341I\357\263;\264\373\305]2\303\354\006"
+	.ascii	":\003\265A\276\224;\227x\002"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.29.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`@\004e\033"
+	.string	"Vp\246H\260\226Q:\024 r\332\350F\021\305WS\211\006\245}QD,\b+-\264\336\367^\231EO,\266\235\0317nl\007\233l\327\252\277\3751\t+\216s\247\220\337\b\305\032w(\374\220\002_@\241\300\256\311o\367\336;\245\211"
+	.string	"\221"
+	.string	"\224"
+	.string	"\362\275\034\035\027It}\272\017\335\177\370\347\230]%/R\273{\023\276\326P*\337#Gy\030\313\224\005S~\314]G\317\201qQ\210\236\322~\323\235t\327\321\363\001\273L=\251\335\221\301\253\025\204\257\036_\240\365\032\236\246\365j\037\207\037@\310\211\266\375"
+	.ascii	"\202\316>\037yG_\202A\364\204\265;\302^\347\214\373|J\352\343"
+	.ascii	"\313\"\244\237\317\003o\223\345W\025\364!\245\270$p\352\302\331"
+	.ascii	"]\207*\356z\333\023l_\260\351R;_\206X<\310C\373~\222\007k\217"
+	.ascii	"\342[\221\242\344H\374'\207\342\227U\256\312\277\232\230]%08"
+	.ascii	"\341\253\223\334\233\320\\\0034\256(\356\216K\316D\367&\264o"
+	.ascii	"\321~\265\214\024\302W\001\3624\255\237]\243B\342\372c\344?\340"
+	.ascii	"\324\021\233k\202\216\330\302\0371\364U\361\256$\204>\"/\302"
+	.ascii	"s(\327\035QX<\366\243.e\277\214;\224\017"
+	.string	"\005\334\335\027\216\372\276\234/\304/\333\017\222\223\025\026h\305\315+\020\377\250\200\rZ:\341 \324\331/\327Y\247\265\344\234\023\301\217\250\305Nf\371Aox\226\234p7(\202\177UB\307\247\3213\037\274\215\221\323\316\250\311\tHf\311)\303\223\236\356d\262--\363\036\177\314K:\004 \355\252\322\255\367\376Z\245\351\214\364\234\221\226\037\377\317\330\324\b\220\264{\224\365ecT\"5>\365[\375N~EF\267\205\320\244\302c\031\007/\362\300\310C!V\361\fggB\210\372p\236M\023B\364iE/\307\024\323\350\362\204h\221\013`\016\254\r\032oj\246\311\221'\006\006\241\223#;\344\310\030MG\004\ra\233\341n\261\021\256\030\211\031\216\326l\267\017T\026\273M{h \333\201\311v`!f:5\230\207\033\016\326\200\306\266\235\330\r&\302f\273\301^\247;\231\b\310\337\247%3\215l\313L\343"
+	.string	"\315\335\2342l\007\3601u\224\324\333\251d\003\3225cf8m\013\030\344\213|\340C\253\033\"\227\253\241\371\343S9\303\267h\b\347\251>\240\213\225\244&\247\326t\315\003Om\274\210\"\252\223\316\326\374\320\2269\351<\224\323!;\214\354\202?\302$\ba\250\221L\305\020#\"$#\232\264R\030\016p\"1t\267\r\021\2609DG)\024\226\335\001\026\353\201\320[\222\006qJJv\245f\223\036\037\004:\216\026\2007\265G\215{+\210\326\312\301Z\264\\\306I\221\202\371\211\024\024\342(\004\240\201&\023\206\031oe\224\037<\214\221\202\0051\366y'\bO$J\370\336#}\301\177\323\346\301\266\213Zi\003\\\200\221\006K"
+	.string	"\320\317\216\3740F\312\265h\002\211'\252 \267\022\320\207\035\2374\336\261\262\205"
+	.string	"\364\2633\300U\241\231\"\364\341\342f\235\223\276\020B\265_\320\207-\241\250}>\242jQ\273\371\023\337\262Gi\362!\016}\220\275\265g\3041{H"
+	.ascii	"\321~V4*\352O\222\027\376\371\024E\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\035\007"
+	.string	"t\n\204\001"
+	.string	""
+	.string	""
+	.string	"\002\035\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \t\177\017\252\333\3426\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022\020\005\021\021\002\013\177\022\024\023\025\024\f\177\025\002\r\177\026\002\016\177\027\002\017\177\030\020\177\031\360\372\2508\003\032\201\001\026\177\033\377\037"
+	.string	""
+	.string	"\200\200\200\001\023\177\034\003"
+	.string	"\r\344\001\003\004\204\001\003\004\r\250\270\275\324"
+	.string	"\001\204\006\004\004\264\345\241\253\002\001\265\007\003\007\004B\003\b\004\263\244\257\024\001\242\006\003\t\t"
+	.string	"\210\373\227;\001\342\001\003\n\r\344\001\003\013\004\221\205\327\307\003\001B"
+	.string	"\027"
+	.ascii	"`$7\313\327\351\030'\2333\034\206\341S$\372\230\"%\030\236\357"
+	.ascii	"l\255k\031d\357|\004C\232\2308!\200\016 \030\\LJ\004!\034Q\211"
+	.ascii	"\021T@<\311\320\301t\002"
+	.text
+	.section	.gnu.lto_.refs.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\007"
+	.string	"\002\003\006"
+	.string	"\002\004\002\005\006"
+	.string	"\002\006\007"
+	.string	"\002\b\002\002\006"
+	.string	"\002\003\005"
+	.string	"\002\013\002\002\005"
+	.string	"\002\003\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"(\265/\375`y\023M]"
+	.string	"z\231\330!Q0\222\322\031\016\373\021\230\006\0258\223+\241\002\237\3167\312\224\212.\370\006O\300S\267\377rQ"
+	.string	"\234\213\bn\320\t\222\370\301n<)\222b\024G!@\214\350\363\333\347\016\271\",\002\032Qt\357\215-\374s,\212\004\001\356\\\206\335\216\335\244L\001\307\001"
+	.string	"\002\033\002b\226m\307ls\303\254\331w\313\002q\324\335_\261\r\263>l\226uZ]\220\3456\327\275\2560\261\342\246\255.\2113\007]\037w\200Q\262\003*qs\020\374>\316\345\262^|\253\222\356*$\006l\351}\225=\273\327/\013f\233\353\274\211\265{\305\n\002F\340\221yRI\275\254\341\214\355xBbt\325\266\231\306\243\212\321\003\323\266\271]n\006\247\373"
+	.string	"\035\244%k\2200\272h\217\323q\334\301\203\321\327\335\f\365\221E\212\032\243wA\275\n*\253\020\241L\0253\027%C\275\006\352\376\260X\266\231b\307\276WV\3546\310\265W6\262&\254\213\321W\240~S\244\276\275\275M\221~\002\225\227D\272\263%\322\367\250_\241\376\013\366e\323D\243[c\364\337\257\365b6\265$#Fwk\271\266yb\253\374\001\t\356;ruV\367\2523B/\212\036\036\243O@\375v=g\252%x\252~O\244\273\267'\322\263\272\263$R\024Kb\312\277R6+\205/\231\304l\260\356\225G=*\023\313b\364\353\226H\325%\221\276\312\306\220\016\360\363\210\353\374\374Ct"
+	.ascii	"~>\341_\233%\302\340\273\336\177\020\376-a\343\177\230%\272\210"
+	.ascii	"\237c\374W\373\267\306\277A\240\002Z\370\377\345\337\237\377"
+	.ascii	"b\266\004\026\300\254\241\360\357\n\314\"'\205\377c\377\333P"
+	.ascii	"\310\371\271\304\277&\374\353\301\277\023\374\333\363o\003\377"
+	.ascii	"\356\277\013\374\213\300\277'\3765\340_\001\376\345\371W\347"
+	.ascii	"_\021\377\246\377\347\376\313\375\177\373O\364\337\353\177\331"
+	.ascii	"\177\341\177\022\376\233\371\037\367\037\356\377\327\3772\377"
+	.ascii	"\263\376\237\370\237\366?\304\336\336\336\336\357\013\340\347"
+	.ascii	"\002~\035\n\002*~\266\341\234\003mZz\3161\312G\213\347\343\021"
+	.ascii	"\006\006\213Q6\272\334M\235\036\363\211f\323|\353^\307G\365\330"
+	.ascii	"}\\\233i\251\236\226\362\236\355\344\244\002G\r^\336V\336\371"
+	.ascii	"\270{L\271\2534Fw\217W\217\373\273\267kp\216v\017\355F\356\""
+	.ascii	"\220\263\213\200\215\331\021dW\212~\317\324}.\036\316\021\272"
+	.ascii	"\253)xw7:\210\240\231{[\331\356\f\253\214\321\346\252Y\263\234"
+	.ascii	"\272\2572R\214n\020\227[6\264\252\037\214\256\335\315~ikTR\233"
+	.ascii	"E\375v\251\347?m\244\262\273{\330\254\2554\302\371\332\354\252"
+	.ascii	"\370G\254o\023\370\217\266\317\255;\007+:\225\t\026\344\323Q"
+	.ascii	"\364\261\272\217<\275\2662\331\234:&\253\200Y\362\254\035d\200"
+	.ascii	"nVur\235Z\242\314\346^{\373hj\tCre*\223+\363\270\323G\314c\367"
+	.ascii	"\272\334I\202!\217\233lN-\223M\346\222\247\217\372\330Md\020"
+	.ascii	"\365\210\271Lva.w\222M\3442y4\265\344i\262\022\222\246c\t\227"
+	.ascii	"\221\375\222<\352%%(\244r\307\231\\\231\355\326\275`9Z\231@7"
+	.ascii	"\024S\351\206\314a\307\214\234KFW\220\314]\225\214\250\230}\344"
+	.ascii	"L6av71\252\321J\021\034Wg\023Y\347\261\n\252\223rt\027\240\324"
+	.ascii	"}\334vv\367\261\273\177J\250\265\373\307N\362JI\251\333\311\204"
+	.ascii	"RC\035\263\344\350f\260\267\261e\262I\305\364\311\342\325\274"
+	.ascii	"j\244\365\270W\3556\245T\233\307\255N\352\356M\243^-o@\303h\023"
+	.ascii	"\240J\371\300\252Rfs\204j/\210/\2575]+\322E\215\321\261\365f"
+	.ascii	"\fH\030\016\034\347<\002\245\n\212\341\312\370\272\234i\3221"
+	.ascii	"\372\266\232\370\361\320A\f\214\321\357R\375f\255\013VF+l\277"
+	.ascii	"\262\336\310V\313\023/K\345l\235\353t\332\351\243\037\344\346"
+	.ascii	"\262\302\254\225\375\3129\362tW\221\271j[2\353\266\001g\241r"
+	.ascii	"5-\227\214r\226&qIg\030\345\261\233\3418\215y\356\360\003\032"
+	.ascii	"5\312yJ\024\026\363\261\341\364\221\253\231*H[\263{vRnJH\363"
+	.ascii	",v\266\362\200\004\217\023\016\361\362b\224\303\316`D\322x%\277"
+	.ascii	"\030L\t\334\025\2752\225\275Xp\324]\220\274*\"\254\300\034q\302"
+	.ascii	"(\357\315R\356z\034+\2219\211b\224\271.7\342\312\226\025\024"
+	.ascii	"o\255Q\261\0311\312TXk\233O\3435U:\255\r\226C\206\024\226vE}"
+	.ascii	"\r\373\264\224\245\234\263\376\020!\310\200\b\231j\366`\245\355"
+	.ascii	"\351JK\275\017K\311\267\311J\030\n\272\3662\255\202\365c\355"
+	.ascii	"\331\3123\006|xhC\2640\312M\330\3116U\360\223\363\022f\362\020"
+	.ascii	"Gk7C\264\245\211\362-\251_\025\251\316\252HQl\211\024e=$H8\211"
+	.ascii	"\005]`s\314\f\323b\257;'1c\003\246\t\022+i\254\254\230\007\266"
+	.ascii	"(KyX\277\347\231\"m\344\314\303\315\322\035K\256\2060\312E\026"
+	.ascii	"\357\3133\312\216Q&\302eT\246b*\036\242\266\216\024\r\t\t\023"
+	.ascii	"!\347!7]B\326@a\224\253\036g\203\346\244\233\342EJ\212\203l+"
+	.ascii	"\363rx\210aRc\236\203,\026\267f\020x?.L\245& \242\242\370i\201"
+	.ascii	"\204\320;J"
+	.string	"\261k:9\361\323r\365\361\246+\n\351\356\211cG\206\325\306?z|\301uY\263p\230\230\2140u\360jA\365\362\321\303-\311\r7p\323:\265\017n\355\327aG+>\316M\277\265c\2213F\031\207\305s\242\354\001\357\213+\253NKj\271d&\023;kS\351p\345\333r\362\360\204\3213\017\365\347\244$f2\301\325\307\034\266\037Hw\317n(\006T\320\362a\264el\274\364\226\3401\272\304J8Le\017\260@\332\224\266\030}3\241@\217\24525*'9\311;:@A\353\006\231\304\r\214u\234w\340IAEY\255\226\364N\313\207\024\225\216\221t\234#\355\336\225\311\244l'eF\341\220OX4T$\002M\b\016C\030\201E\0324D\b\016g\004\207i\b\300bP8D4\026{\200B7\210\202\204C=\304\342\215\036\001\210\210n\b\205E\302\237\361'\225\241\210X\303X$\374\321"
+	.string	"\002\022\2418\206A6\2006\322\327h\361\001\t2f\364\030\201A\"\220\021\205\361\347\001\b^\b*\"\212\001$\026\305\260\0014\026q\314\320!\"\302@\004\220Xd\234\021\034\306\370\t\t\201"
+	.string	""
+	.string	"\031\201\204\214\300b"
+	.string	"\300 !\220\261(\224\241c$\002\031\213$\204\204@\342Op\370\363\303#$\034\332 8L\037DTT\224\301\217M\352@\013#\021h\330B\b\250\350\203\340p\304\203\206\210@!0\250>\002\027,\\\274\230\341\367\0270\034\200\341@\372\0270||`\270\360Q\357\302\307g|\r\022/\032\002\211=\306\242\"b\317M\220\360\306\006F`\361FH\203\215\300\"\220hS\374\301A4\026\207\202\300\021\202C\034\343\21708\264\021\006\207>\343\217\013\037\025H\303P\021-\026\201D!!\240\037\216aQ\020j\374ya\024\016\335\370\335\307'\006\212\022B\340@\rj\021\034\366\004\207=\302! \033=A\304bO\013"
+	.ascii	"\210\306\241\357L\307u\333\274\031\333\255\315\356\326\311Y\033"
+	.ascii	"\323\346\226\203:\303\357\34749P0\254\034g\344\344\370\214\f"
+	.ascii	"\026\360\220\356\346\316g\274F(AZ\311)\231i\332\2637/H"
+	.ascii	"\336\336\030\256\203\021\270,\345\2259\303}\245O\252\220L\350"
+	.ascii	"\221\032\004C\372\032svC\323\024\344\211Q\026\303mP\256\254\220"
+	.ascii	"1\303\004\216\214\n\243\314\306at\254\256\302\312\030\375\234"
+	.ascii	"\362\331\344\371\006\206\305\372\267$\005o\310\227\247}\222\322"
+	.ascii	"\241\326|\334\315\370\236A\226\264\227-9N\255=\"jj\276n yW\276"
+	.ascii	"5]\230I\007\b*;7F\317\316\030M\306qx\207t\367\344rF\333,>.?\220"
+	.ascii	"\226\250\361\341\214\305\007\336\242\343\324\235\324\276\243"
+	.ascii	"\006\262\346\352f\213\307\326\027\262\363\226\263\231\212\365"
+	.ascii	"\244\r\311(k\311qR#\233+c0&B\232P\030\r\201\233\250\261$f\234"
+	.ascii	"4#2#\"\"I\222\244\003A\005\204 &)5\017\021@%\243lFF\222$\311"
+	.ascii	"p\313\260\333\230lG>\230P\363\304\301"
+	.string	"\273\301U`\351U~\016\364\205\336\t\016\273\037\302\307\303\222\036Y\260\026\005,\316!\255\343\025\377_(\342\350{\337\354\251\321r\251Wh!\270\275W\0352\250\362/\364\214\267\366P\267\tq\215*\237\254b\302\030\216v\030\020\327\250\371b\335=\225,\347\257\013\366;\275\b\267,\375\332v\213\n@\362\346;=\331\353\2749\201\310\371\354\007\033p\370\231\327\353\377\300\376\377\252\342\332[2v\212i\306n\034\316V@\b\251\307\350\204\377\253N\305\303\263\333|\366\362@|5\223\273&z=\350$\355\304\177\217\243\020\246\026\301\353\302].\235@\005\236\235\177\204\236c(DO\2420%\246\001\202\261\206m!\364{\223\370N.\355\f\\{~\3359R\352-\313\215\351p\025\375\\\245\300g\027\320;`T\362\344tN\370\330v \305\235%=x\347\316\251\363\276V\262)1]sP\352K\323\277\006\302\233\332"
+	.string	"\355f\360o7;\017\245CH"
+	.ascii	"Q\346\345\271\343\313\rp\022\330&\026\262\"6\342\354\0048s\272"
+	.ascii	"\334\304U\213"
+	.string	"v\277\336\211\003\263o\306N\312T\217.a\327\002\307b\2008~\317\245\033\240t8\337\330\327\022#\321\367\243\360\013\314O\222I\306\201\0272\307\365\0173.\204!\004o\225\274{r\302\243\b\377\301m\343\374;9\274@\013M\037\017Y\n\020]C\036\216\374GDU|\177\f[~\304\2400\277\377\255\307\216\372\017\335[lW\301\340\034\315\211\346\017\031q\350q\204\371\312j$\003\326\236S\371\376\260I\265\373>;0\273\0221\237X\022\313\032!\027\217\025@\037\356\\\366k\036\247\210\264L\302\020\313\\d-e\031\203O\327\364M\022O\036'O)\233\031\235(\001\256\222\256\203\316h\264\276|:S#\362\347\215\027\002\360p[P\377\035k\311\022\256;i\213H\301E\025u\303J\271\355\230,\276[\332#\202\330\340\377\333\315K\213\326\020\301Vy\3112\364\212\230J\270@m\350\204\331\316\304\240\321@\356"
+	.string	"\004?e\207Hh\277J\2262\352\367\270\312\001\231\004\177\303\257\214\300\023L\334\221\007&\262`\354\330\370F\016]\007\t\204\313\332\253\226B\213n\354S\360f\336\f\260\220\356\033G#\301\304!MB9\311J\361\r\343\245\032\255\342\246\272\353\032\341n\240p\001h\317'oyGe:_\344\25707\203ao\007ac\r\007\234\332Q\364\264\373\353\201\273\026p\006\231\311u\257]\221N\347\371\322\351S\3026g\323\\\312\226\300\263\211\203\264\306\205\030m\342\3337\214A\275\f\226i"
+	.ascii	"\016s\323\022\026\027\231\275\\\023I;\351G\032G\302\237\260:"
+	.ascii	"\367\272\265Yv\332\261\263e\373C\305gpm\367\214\033\026\\\225"
+	.ascii	"G%\372\326\341\257\361{\004\026\256\245\2661\337\235\377\343"
+	.ascii	"b\225\375\376\252"
+	.text
+	.section	.gnu.lto_.symtab.4b73f5bdc9d7b8aa,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"pgResetInstance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4b73f5bdc9d7b8aa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
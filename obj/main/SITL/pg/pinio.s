@@ -0,0 +1,271 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 +%\001"
+	.string	"\340\037"
+	.string	"\005"
+	.string	"\210\325\324[\001\327\262\311\352\004\002\240\342\234\212\n\003\004\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"SD\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.98dd042ef73a9e09,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioConfig_Registry.12.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \2205\004"
+	.string	"\204\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\203\255\252\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\336\006us\250\367\005uq"
+	.string	"\005\001\006'\001\b\221\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/pinio.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pinioConfig.14.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001'\007\002}?\202\210\200\020{y\274\001w\273\001"
+	.string	"\004\001\001\001\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symbol_nodes.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 L\035\002"
+	.string	"t\003H"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\016"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\f\001gistry"
+	.string	""
+	.string	"\005\t\002\201\204\001\n\003\003\004\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",\211]e\225\271M'"
+	.text
+	.section	.gnu.lto_.refs.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.98dd042ef73a9e09,"e",@progbits
+	.string	"(\265/\375`0\b\235/"
+	.string	"\nV\320\022E`^N:\307\303\f-\201\030(\274\006\224~\307=\311\207\035\320,\243\032_,\202r\250\344\037l\brFm\350mfl\2231z\b\0076\\\003O.\335\020\363\240\b(0J\252\347\031\371\375 \021\335V\312\024\365"
+	.string	"!\001\037\001)sa/\374\345\017\nr\343j\323\243\3555\244\347."
+	.string	"\212\260I\362\244m\363\307\240\274\345\334\366\007\001\231u1\331\332\036Cz^c\266?\310\267\367\346\246\325\366\021\322\263\226\377A.\342\004\231\322\226\263\244X\r\224\202\340\\\251C\322\366\234\345\347\225\321X\r\305\275\314{o\201\346\002\373\232\323\226\261p\332Y\215\257<\002\205\373\252\256\\\263{/\253M"
+	.ascii	"r\257\025\253\375\370\334k\365cf\300\314\300R\021B\266\005\265"
+	.ascii	"_\220\376\216\217\320\"\006\242l\366t\266\362s\025>\003\242]"
+	.ascii	"_\353]\273\367\376\232l\315\351l\373\225\217\320\224\201(\021"
+	.ascii	"\003\321w\372\177\315\1776\377\337\304q\227\237\217~F\372\271"
+	.ascii	"\300\317\003~\026\3603\201\237\017,\375\317\3739\300\317?V\372"
+	.ascii	"\377\373\333\302\317\016~N\372y\301\317\b\376\313\375\377\371"
+	.ascii	"\357\374\357{>\237\317\377\367g\265\037u\006F\375\"}\337=y?i"
+	.ascii	"h\356\300\345\375q\276,. k\200n\223\206\353\212Oj\004D{\211\201"
+	.ascii	"(\337q\235\037\0250D\332\350\2048\242\246\255\255\235\323N\262"
+	.ascii	"%2\354\212\346\224\260\241\325\375\264=\357\354h\313rR,\266S"
+	.ascii	"\002\020\346\345\007X\333\263\234\237\3158N\213\347\236\236\266"
+	.ascii	"\237\343#\224\351\236\316p\204\340\310\334Yi;\304g\322\363\024"
+	.ascii	"\346\2623\030nr\031\3135\332\352e\342m\306\r\274\333\325\003"
+	.ascii	"\002\212\366\205U\325\366\315\272&T\203\251\347t\222\262\341"
+	.ascii	"6\334d7\234\346\274\336\273&a\f\277\025\371\356\0253[r\357=\273"
+	.ascii	"\375On\030\216\327$\270\272W,\354'\006\267\305\r\357\336\213"
+	.ascii	"\304\304\204\312\261\263\346\n\265k\342\210\354\304\254I\324"
+	.ascii	"\020\365\231\322G\257\355Y+=[\245W\323\363\333\317b\330\215\235"
+	.ascii	"(\356M\003\320\206\216\315\255-\233\3413\334T\300h\326\237\315"
+	.ascii	"\221f\210\222\266\237J\377d\005(\223y:\227\311\200d\214J[_\212"
+	.ascii	"\3242\020M\342#\364\034\346H\261K\341\035\002L,4\300\334\256"
+	.ascii	"/\b\\6\247\314V\3337\276\270\254\267;7w\266\303M\236k0$\264\265"
+	.ascii	"J\210\017\232\016VM\306\332\362X\231@[;\332\326\234\351\371\f"
+	.ascii	"\217\367\304\321\243\307yfp\232\331XP\324p\236\316\352.\216\373"
+	.ascii	"2\272L/s\356\316n0\037\316+\252\np\357\030\335\222\034\275\243"
+	.ascii	"\277\032G\333h\035\334\354\033\r\343|\207\3610\367\372\006?\373"
+	.ascii	"\212\343\212l0\233\273\273weBb\022\222\303C\026Wd\031\357u\t"
+	.ascii	"\256\262<\234\325\335I\370\237\272Z\253ip\334\327z\275N\330\345"
+	.ascii	"\360\201w\357\372\277k\264\0277\273\353H\353\275LL\006\210\364"
+	.ascii	"\350\360\316P\3737\215\2361\004&\006\030\214\266-\203\323\234"
+	.ascii	"[ce\351\337[\334l\256\333\r\335\004?\030L\366\224\264\355\030"
+	.ascii	"\257\323\252\212\261\325\366x>\306\342\bS\226FJ\372f\222\276"
+	.ascii	"\207\274H\337\334\205\301\375H\337`i\337\256\342\246R[\235\373"
+	.ascii	"\360\336\177\254\326\2736\222=6,m\337^\351Y\t\365=\237\254\204"
+	.ascii	"\276e\244\315@4\227j\002A\342\303\b'\225XT\n\325$5\030A\202\212"
+	.ascii	"!r\n\212\250DB\375\250\222H(\243\025DuI5B\200z\251\246\"pxd\301"
+	.ascii	"A%.\205\216)\372g\031\034R\203\307b\362\347XL\372\324`\205\247"
+	.ascii	"\224\330\302\270\264\313%Q\031\025%\004\242J\"\207V\251&}'\242"
+	.ascii	"R\252Kc\221(b\300\207\352\245\b\034\231$*\235T$R\351$\244\006"
+	.ascii	"/\250G#\013\240!\272\f\022\251A\240\242\220\004\322\370\363\247"
+	.ascii	"'\250\244\022!:\244\303&\247b\322\351h\024\256p\032*\227NMGQ"
+	.ascii	"\304c\3218%\004\212\".Y\330#\322\250\016\211K\240\013"
+	.string	"Ua\2242XL6\025)\205RC[4\2468\"\241\220\306\2431\031$\252\302\251\344\n\"\t\225\270$\212(&\021\030i\037ev$Q\353\",\367 \210\231(-\326l\261&b\327[\003U\223\002\306\003\357v\231\201\340\323CCDL\333\026\322c\334\\\352!\017b\2567-H\316N\330Z\333\373z\244\347%\364\367|>\237\274\204\336\307\005\004\310\031!:\262\266*\275\260\277\303\332\007\222\321\r\200\216\250A0\306\2204\306\314\210\214\210\210\264I:p\002\2211+z\021p-d\206\210\270PX\016\257\037\346\252\241\362\"P\206\221\233\272\345M\036\301:\017w\270\017O\313\344\f\fM\007\b8e\335$\324\312\241\3516\203\216\213F\t)K\347c$u3\222\376\254\274\300\374-\340\331\241\327B\026\254\224\204DL\016\212k\211\247\337\226\324\346\r\"\007\270X \227\036\330e(\243+\250\036\206s\345"
+	.ascii	"\325\3011[\032>+zD]5z:\261{p\274\376]\204\276\017L!:H\006\253"
+	.ascii	"ck%E4\220\032\236\234\003\262\350 #jH\177/\244\277\b\316\225"
+	.ascii	"=\304\263_\023O\224\3423i\211P\207d\322\224\226\0232[\347N]\224"
+	.ascii	"T\003)\240\274\231\236\365\3030@\363\021q\256H4\225\244c\fz\024"
+	.ascii	"\212%\241\002\233\354\020\242\240\311\307\025\2151&\334\037y"
+	.ascii	"\006M\0265c\331\337\220\241\326:vsJkZF\032\004\201c\375\217\243"
+	.ascii	"\t\037\310\255k\003\353\316g\206\230X\236\351\035b|\017\020y"
+	.ascii	"\311\200}\033x\276\204\021\375\242\255B\300lo\373\034\201\237"
+	.ascii	"\n\254\"\244cY\177"
+	.text
+	.section	.gnu.lto_.symtab.98dd042ef73a9e09,"e",@progbits
+	.string	"pgResetTemplate_pinioConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"pinioConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"pinioConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.98dd042ef73a9e09,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
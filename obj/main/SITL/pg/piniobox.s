@@ -0,0 +1,245 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 ,-\001"
+	.string	"\350 "
+	.string	"\005"
+	.string	"\252\353\260\366\b\001\362\247\273\211\001\002\240\342\234\212\n\003\004\240\342\234\212\n"
+	.string	"\002"
+	.string	"R\004\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.1c6f40c4988e8dc0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxConfig_Registry.15.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\237\353\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\375\006us\324\006uq"
+	.string	"\005\001\006'\001\004\222$?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/pg/piniobox.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 L\035\002"
+	.string	"t\003H"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\021"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\017\001gistry"
+	.string	""
+	.string	"\005\f\002\201\204\001\r\003\003\004\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",\211]e\225\271M'"
+	.text
+	.section	.gnu.lto_.refs.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1c6f40c4988e8dc0,"e",@progbits
+	.string	"(\265/\375`\352\007\275."
+	.string	":U\254\022E`\\N:\367\312C\243\346\001\033\255\254x\205RX\220\374c^%\345u\277A\025@\265\373\223q]\020\344\256nf\3060m\233$m\376\361\035\376\370\317\017\022\304\216\335|\275\252\302\316Oh\366,\221\370\266R\246\371"
+	.ascii	"\025\001 \001x<\204\002\253\f\317V:\355\255\256\256m\020_\245"
+	.ascii	"\374\306q,\227\336,*\013}%C\313\254\355\224\325\t\204\366b\210"
+	.ascii	"\226\266W\3238v\262\024\206;\257\207\360\017\245p\024\206r\240"
+	.ascii	"\352\336\035d\301\251/Xmz\367^\242\244\240:^\267\212\265\307"
+	.ascii	"\220~\2302\224vpd\307\326\316\330\264=C\371y\t\257\374\204\304"
+	.ascii	"\275\316{/\201\2406X\326 m\331\215\231\260\263\210\235\374\201"
+	.ascii	"\204\373\246\230\\\266{\327`P\236#y\356\264\375\202\364"
+	.string	"\334\344\3001W\302;=\027\241\374\344\"\324\210\207P\313B\224\223\f\317J~f\3436!\352\005\266\336\267{o\260\302\0173$m\277\362\020\232\262\020\365\261\020\375Y\300\317C?\017\3709\300\317\301\237\205?\023`\360?\357g\340\317@\274\340\177\360\357\341\317\n~.\372\331\300\317D\377\311\374\357\371_\367\277\237\317\347\363\277\323\317^~4,O>B\3377\322f!*\304C\350\233F\372\376J\177\246\223\327\343\354\"\007L\036?\361eq\345X\0034\231/\\Um\337]\251\020\013Q#\026\242\215t\307n\202H\346z\304\265\361\200\026&\256\255e\323uij]k\200h\204\300\271\251\351\211{\312\261\321\226\323\244X\374<\002@&\207C\254\3559\315\317U\030\215\212\347\036\235\266G\303C(\233\031\236\317\374\200\321\202\267\244-\320\231\364,\307<w&\343\3449\226k\267\365k\371\346\002\211\336\365\032k"
+	.string	"D\223\203\343\326\226\303\260\030\036\363\377~W\270\310\2149I\317v"
+	.ascii	"\316\306\004)\322\266\371YP\376r\006\363\377|\330\274\254\340"
+	.ascii	"\326\364\\\307^\376\237o\317\313\225\026m\317k\351\271\313\377"
+	.ascii	"\337\2125:\216\264e.)\026\3738\372\251ar\367\243\355\231\313"
+	.ascii	"\317W\030\013\323\221\270\327\252\271\304\300\334\264e-\274\345"
+	.ascii	"L\307Y.\323E\310q/\025\323\005\361\334K\025dN\300\234\300\")"
+	.ascii	"K\213\202\332\263Y\372\367\275\b\373;\254\305X\350Z\225\235\315"
+	.ascii	"]/\260\006\276\035Xp\326\332N\371\235yc\342\242Nz>\302\\\346"
+	.ascii	"\214\307N.\323`Dn\353\024P\213"
+	.string	"\022+E\007\221\260\2665V\"\237-\033qol\322s\333\034\246\263F\216\036\347\261\251\351\251\2562\022\206\343\364Uw\261\035\230\320\265\222s\203\327\366\305u8\0178\025\340^\2634j1\232F\317h\030\355\3252\330\331_mu~\303p\254\330N\1771\236\276lwv\201\rM\022Q\322\217\2319iv@\313s~w\240*k\203\222;\274{\327\256\306j.\266\003[/\214\021mh\340\351\335\273\272\350\027\354\354\256\023\255\367&%\025\b\272\223FO\tj\377\346\352-\2409-1\026m[\213\235u[fR\322\277\263\330\331-\336\006\350\036\b\262\030\262'\244m\263\370]\213)\255\255\266\237\363,vF\225$_\340\322w\223\364m\244\251\3222xd`\324\3227\220\224\3678\017;\217\370y\276\303v\336C\265\336\265\177\354\3015)K\317G\250\357\031\177R\352\020\202\003\210%\325xd\026U#\225\370"
+	.ascii	"\302\211&%\n&#S\311\024\224Z*\231\204PF\265)\005\2028\244\376"
+	.ascii	"I\351(lJFeP\215\315\237\244\211\356i\022\201Tb\362\270\354I\036"
+	.ascii	"\227>\2258a\250&\221Q\251Q\005\262i\233M#\323\311\251\350#\265"
+	.ascii	"T6Y\246\272\364=H\212\2516\221G\343\007\002or2&\217H\024E\037"
+	.ascii	"'c3\312&\225H\265\311\330\364yQ-:1\211\307\245\022\220Y|j\262"
+	.ascii	"D\243ZD\261\2042\206P\215M\343\207\343\022\201\372\247\002W."
+	.ascii	"\215\314%U\251d.\3758qP\223\306d\021\212i\\\3764\211G\244\211"
+	.ascii	"\244\222)\205\022\203\220U\211\024\324$2\312\347\303!\223\221"
+	.ascii	"\b\017\032\322&\245\024\312\022Jd\022\271\\:.\227\222\310\"\324"
+	.ascii	"R\023\263\271\244D\324\243\305\320=/cW\315\203\345~\250P\271"
+	.ascii	"Rk\0348\272\314\256\367\013u\262&\246\247w\275\350\032\370\356"
+	.ascii	"t\351\201\245m\347h\035\354D\352\035\377Y\255\327\3713\023\207"
+	.ascii	"\354\215HzFB\203\214\204\336WFF\246\207\036As\322\3266\200\205"
+	.ascii	"\250Q(\247\fD\310\314\214\214\210\210\2660m`\002\2219v\363\021"
+	.ascii	"p-DC5\232&\225\345W\373y\374$0G@\023\276\234AK\346A\216\261e"
+	.ascii	"\307\f8\\\200\321P\0041d\001c?j\037\245a\022)\312FS\303\r\n1"
+	.ascii	"l:\316\364b\210\202i\226ch\207\226EN$\360\t\313\026\216\236\337"
+	.ascii	"W\317\030\350u\013\247\347\032\366\307oX\034N8\tTZ>;\024\350"
+	.ascii	"\016\277?\301O\317)\360u\241O\352\202\321%\204\365\203S\365n"
+	.ascii	"8\350qg\332\3010;\\\227\365\206\024\244\2006\346T^\240\343\312"
+	.ascii	"\004\213\t\271\243\3660\270.\374<\222\024s\b\"J\363*\376\035"
+	.ascii	"\305\\\362\224\360\347\034R\310Z\232dH\256a\354J\245\332s\267"
+	.ascii	"\237_5!\300[\344\237\332H\253\270\312lcS\020\316\230\310\374"
+	.ascii	"B>e.\311+\212x\202\210\345!4\265C\361\330(\214\3670\223\326\370"
+	.ascii	"\217\302\362\207a\347 \376\241\003n\275h\342\217\302\331?\373"
+	.ascii	"\216\313\230\304\315)\257\002\240\253L\341/Z8fM#\254\007u\330"
+	.ascii	"T\r"
+	.text
+	.section	.gnu.lto_.symtab.1c6f40c4988e8dc0,"e",@progbits
+	.string	"pgResetTemplate_pinioBoxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"pinioBoxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"pinioBoxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1c6f40c4988e8dc0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,314 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 4u\001"
+	.string	"T\002("
+	.string	"\005"
+	.string	"\266\343\271\321\b\004\002"
+	.string	"\002\001\002\002\002\001\001\376\260\312.\002\240\342\234\212\n\003\004\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\244\b\267\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 2M\001"
+	.string	"\370&"
+	.string	"\001"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\002c"
+	.string	""
+	.string	"\b\003d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 =\215\001"
+	.string	"D\0021"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\003"
+	.string	"\002"
+	.string	""
+	.string	"\b\b\002\004"
+	.string	"\001"
+	.string	"\001"
+	.string	"   \002"
+	.string	"\001"
+	.string	"   "
+	.string	""
+	.string	"\004"
+	.ascii	"`*\315{\300\302\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.804801a8ce9284f8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcdeviceConfig_Registry.15.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 \223-\004"
+	.string	"t\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\202\200\200\374\342\203\234\355\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\367\006us\316\006uq"
+	.string	"\005\001\006'\001\b\233\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/pg/rcdevice.c"
+	.string	"\004"
+	.ascii	")\302\303,\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rcdeviceConfig.16.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\235\b"
+	.string	"\026\020<8@\217\322\001\320\250\3730s\203\223]\203L\304\217F\202\007\230\234`!\325\240\375\310\216[ld1>H;A\260\224\313K\276\271\264L\335\n\350\373\250\242\t\331\233\354\235R*"
+	.string	"+"
+	.string	","
+	.string	"\307\320O\203\266\n\301E"
+	.string	"\b\206\312\265\273Ur\034|\004\375\217\034\240d\032=f\t\273\353X2i\334\362\266\rlol\263\002\226(\373\251?\316\214\205A\331\315x\261\354j\236x\\l?\332\017\271\b\370\224\350\003\273\250\024\223\335\020\301\007\332\247\303g\350\247\026\007Q\373s\025\210\341\344\242\017Q{\342%!mw7>\tEE\246\325\361\351\213\350\347\302\351c\205\024_v8\212r\303>\266\273\033\234\356\241\343)\bx\323p['\3019l_\345xj\247k\200\250\333\367\251\232\002{\036\356\253\021\236\367\325K\270\307V\242\214\265\254H\322\302Y+\f"
+	.ascii	"\177\241'\023:\302\201\343\202\200T:NO\340\030{\t\206\\\202m"
+	.ascii	"VS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 Nq\002"
+	.string	"J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\005\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\006\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\007\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\r\b\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\006\t\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.804801a8ce9284f8,"e",@progbits
+	.string	"(\265/\375`\321\tu9"
+	.string	"\332i"
+	.string	"\027E`\336U\007\367\312;x<\033_\341o\376i\303\242\026*\230\205\027\206\021\255\035\2674\265\036k[\003_q<\367\217f\202@4\311;\260\314\200\246nMf\007~\266\3303\331)\370\030\232\233\357\221\333\334D\246\024A\001U\001a\001V>\347G\223gT\377X\354\215\031\264\371\016\221\376\316\302\336\255\227\341&}\353\333\262\236\371M^\371\252\377\367;y\013\232\303\316\027\245\241=lK.\274v\273\227\366\263\240\2620\254<x5\363\t\355Y\033\003\303k\273\217\334\356\345d.\346\\\234*va:u\373w\313\274\213\277N\346Yzu\377\333A\367\257\273\001\004's\327\303\220\226\377A\200\020\245\251f\021\003\367\357.\371\226tT\240hI\330\325\265\370\026\177\225|\254\335\212{u\020\323\3757\212H\0264\274\366\211\334\256\304\356\\\211\355\017\271)d\277\342_\376\032p\260n"
+	.ascii	"\241s\311\257\237\376\273\273\241\270)q}\360\332\021r;\226>\372"
+	.ascii	"z\bm\224\333\r\260^u\003l\343\274z\217Mr#\266\333\253t;\025\237"
+	.ascii	"\032\3105\253\244/\366\357\026\355\\\036N-\274\266\353Fl\366"
+	.ascii	"\036\333\335d\\\272\033\f\250\333\245t\273\200n7\352\366\001"
+	.ascii	"\335^\324\355\273n\357u\373\321[\267\017u\273\220\037\350\356"
+	.ascii	"]7\376u{R\267#u{\201n\367\215u\267Yw{\351\356\263\356\236v7\200"
+	.ascii	"\356N\353\356\\\265Z\255vw\264\033\027u\347\001\001\257\334\271"
+	.ascii	"\037p?\260v\ra\262\205]\033_\345ns#v\310{\254\253\375\332\321"
+	.ascii	"\364\330\247\225\273\013\240\026\306\315\n^\205\2602\267\243"
+	.ascii	"9\230\3660\035\306\323\334\352sq\272nl\301\275\225\225\022\221"
+	.ascii	"Z\222&C\312\264\247\365\034\241\377\351\377#\001P{\315\320\360"
+	.ascii	"\332y\234Lw\007\261U\252\374@Bf\f\353\365\246ei\226y\264\225"
+	.ascii	")\361\372\272\030\317\242\363z\022\247U\226\033w\263\257|\376"
+	.ascii	"?\016\235\373\317\245P\273\316]\251{\310s\216\240\273\327\377"
+	.ascii	"F\342\372\357\001\207';)S\376\300kw'}s\375'\213\336\375g\363"
+	.ascii	"\315J6\301\324@\213\334\027r\364\257\3267\335,\350*}\374\356"
+	.ascii	"\3733\263\240+\232\256\364\331t\245I\3363\245\311\177\027\312"
+	.ascii	"k\212)\223\336|\263\240\315W\n-z\346'\377U\n\311L)\264iF\n\345"
+	.ascii	"5_%\264\311\314\202\026\361\200#Bg\206\224/%.\244\311|\033\316"
+	.ascii	"\250\362\311\2436]\351\267\375\273\030\325?\021\374G\245\317"
+	.ascii	"6e\0177[Rm,\271(\245\356\376?\001\347r\210\364\231\324\346\023"
+	.ascii	"\351\377\223\245\324;\037$]\352\037qjR+\372UT\377\005\336\375"
+	.ascii	"w\376'\375\251\377\237\374\177\240g\324\375\277\3425\267\234"
+	.ascii	"\316\377p\360\300\371\333\364\rN\342e\0244~\007\307\300N\247"
+	.ascii	"Z\361\236IF\307m\n\365=\376F\224,\372\327r\263\225\003\363\300"
+	.ascii	";0\016\374\304:\374\305P\314l\257\343v\230\316\007C\335"
+	.string	"\017~\247\032\2510m[\362-\005`\313\303\204J\264z\236\226\203\264lj\360\222\343\304T\270\312\251V\356\343 1\347\252\013\016\333\3007\374\305\316\366\271\277\264D`\250\217\0338/v\355\306U\270\206\220\031\215\0372\360\212i\370\233V#\227\314\335\270\351/\236\261\223\321\344\317\022\274b\031-gF\222F\215\006\263\3568\243r&.7\206\313\215\341`e^s\003\242\266\226\033\247\311\376\307\343\374M\340\325\366>\316\247uJ\367]\234\344\217\026,cr{\0026W\255z\002\266\361\227\214\275\307\362\334\210m<\226\033\207\345n\327\363\246{\313\340Q{\013\303k\316T-\2772\257\307b%\357\261\036\307\3478\235\356\240]\227Y\221\261\256\334.\307\003\0224cx]\275\301\260\376\246\035Nw\020Nc\262\345\204\222\333\333\334Mw\020Q\333\022-W\360\332XIno\243\033\253\342\361\201Wg\313T\030+\001"
+	.ascii	" dX\316\326\355TO\343k%\376\231\377\177\004\243\372G\017^}\215"
+	.ascii	"\263i_s5k\017\244\377J_\333\371\371-\305\304A\304\206\020M\255"
+	.ascii	"px\204j\223Z`\003\007(\202S)\236\204\307\251\247\335\013\343"
+	.ascii	"\324SO\205\260E\276\b\0014j[\212ih\354\005\213,\002\024M\340"
+	.ascii	"\243\016\t\024j\201\305\241QW\034\032s-\320\351\227\2050\210"
+	.ascii	"\310\025\211\024\036\243\242\240\200^\030\247\202\353\2615\346"
+	.ascii	"\242\204\305!1\005\024P\224\020\311b-N\021\333\240\020\t\324"
+	.ascii	"G\340\320\3104t\204\222\n\256/\216-\2228\024\2028\352 \260\210"
+	.ascii	"\241\025\"\205 \206F_\007\211GaQ8\314\375\300i\201\223\004\027"
+	.ascii	"@-a\002\203\t\f\330\2260\341\367\233\340\364\313\355\364\313"
+	.ascii	"\265-E\240\247\214\302cS;5ul\n\320\002\221\035\204*\210mN\001"
+	.ascii	"\325\342(l\213\033\b \201C\242\211\342\324\023\257\005Jh\213"
+	.ascii	"D\026@\375\373=%\215\360\220!\007\231\242\202\307\246\241\261"
+	.ascii	"\251H\204R\321\024<\"\233\230|\310\326\250B\330\266\026\204A"
+	.ascii	"b\013\341\205\226X$\n\310\362\264\\4\315M\f\007yq\020,]\335\207"
+	.ascii	"\262`\\X^\340\3769FA\256O\231\"h\030c\005\261\335\001\"\326\226"
+	.ascii	";7&\032\215\263\363\263\206J\371^\275\370\312\317|\274gb\211"
+	.ascii	"\232\375\323J\201\016J$:]\222\333\247\270\237iw\363\327\317`"
+	.ascii	"+\337\0257I\344\305uc\013\356\237Q\005k\327\027\2348\274\366"
+	.ascii	"p\231@5|\214\211\t\311\355\323<\256'\200\237\250\201(g\224$\206"
+	.ascii	"\214\310\210\310\2144m\016`\002\021*\253\352\021p\255rhJd6\251"
+	.ascii	",\007\027\223S\261\223!\374\313N\314b\2052\227\003J\335k\222"
+	.ascii	"*5>$|\n\226\304BW8\336/{\275b0\252\035R\303vuFN\243ON\205\367"
+	.ascii	"'\242\261F\222\"\213\365\021\277b,b\232\243&\357\361\324,\251"
+	.ascii	"\301\221\037+\326 N\355\362\366\343\376w\260\264}\022\037\342"
+	.ascii	"z\274]\251t\337\303P\202\325\367\302x\364w4\315\343 5X[\026\320"
+	.ascii	")z\005JB\246+\256\016\236-\004&8\036\fS^K\245A!hF\024k\20702"
+	.ascii	"\002/\202\211\313H\2513\322\220\306\344\345\023\330\224?\004"
+	.ascii	"\366h\241\\aL\f\225\312b\220D\371i_\nh&q:wU\003w<\304\216\022"
+	.ascii	"I\377lC\330\351\316\304\204\001\004<H\350fN\212\376\033\306\276"
+	.ascii	"*\374zK\t\345\313\240{\3200\212u\030$\264_\037`\213\006fU\263"
+	.ascii	"\310N\236\206\356'\271.\230g\352\3329,\001`\212KV\202mH*&\021"
+	.ascii	"\220\374(\3712\002\211\200\256\226dj\306q\034\241Z\026\274\211"
+	.ascii	"\377\0260|\025\362\020@\202cFB\356-\022\f\247D]\317\275+*\345"
+	.ascii	"\022\r\343/1\002\243\356\377l~\2436\343\3154.\303\006#\366\267"
+	.ascii	"\365~\023\376"
+	.text
+	.section	.gnu.lto_.symtab.804801a8ce9284f8,"e",@progbits
+	.string	"pgResetFn_rcdeviceConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"rcdeviceConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"rcdeviceConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.804801a8ce9284f8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
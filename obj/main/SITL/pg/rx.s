@@ -0,0 +1,352 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 i\325\001"
+	.string	"\204\002]"
+	.string	"\005"
+	.string	"\234\272\364\373\013\036\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\001\001\213\241\232\352\b\002\240\342\234\212\n\003\004\240\342\234\212\n"
+	.string	"\007"
+	.ascii	")\342\301f \023\320\017\030v\227\325\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\027\200\200\200\360\003g\001"
+	.string	""
+	.string	"\002\024\200\200\200\300\002f"
+	.string	""
+	.string	"\024\200\200\200\240\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 oU\002"
+	.string	"\002D\r\030\260%\351\220QWD\302\260\322\022L!I\nB\024ja\037\302\232L)\2039\271\204\371\270\263\314\324"
+	.string	";\001W\250\217\r\267\312\344\026\035\032Z\262@\262\335\"\007"
+	.ascii	"\226`\r\347\3051\207W\271P\323J0\332\006\332"
+	.text
+	.section	.gnu.lto_.lto.8b673d273afe2eb5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.29.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 \216\005\004"
+	.string	"$\007a"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\352\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\375\005us\327\005uq"
+	.string	"\005\001\006'\001,\230\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.30.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375`\022\0025\r"
+	.string	"\366\026VB\360R&\035\320phP\366?\3372\007"
+	.string	"4&\027\032\214\263gd\201\036r\343\351\360\027Ux\364\301\211!z8\347]*@nluy m\306\243,p<\364\264\373\003\031\f\006\023r \177\357\224\002>"
+	.string	"A"
+	.string	"G"
+	.string	"\217\231N`\327U\263\355\236\016\274"
+	.string	"\274\347\363\005\276{\340\303\357\236K\033\b\202T"
+	.string	"\032+\331\310\356\212\265\305\313\323\322?\214OL\326\351\024\300\204\33555Y*\356z\333\flgl\372\n\237Ar\204{\225\\\220\022\210\222\340\3078Q\2429\027\276\351\273Gi\267\026L\004Ew\366y\242\225\205}\311\356\256\253\313~\354\247am\255f\225\335n\212\335\220\275y5^\024\333\247\366_\034V\006\034:\320\233\306\234#\"\251z\362\360\037\262\333\037\356\343\003q\034i\200\f\315{|B6\347!R\300\271\216\260\363\0347n{\216\203\212\270\r\222"
+	.string	"\335\3476p\305\370\032e\307-\237=\3424\221q%>\373\023|\266\211\316` <\300\240\301\002\205I\307\023\0024V\030\221\2407\227\021)vB\"\310\243\371\210\033R$^B\217!\016)\222\030GR\244\234{\311V\227/\300n\250\212\302\007(\255?\257\313` \267\253\272\271\001T5\260\334\263\003\" "
+	.string	"\203\221\261p1RCc\310\300\006\241\250\r\356\262\001\246$d\025#\f"
+	.string	"f\023H\275\027\206"
+	.ascii	"Wa0/VpY\005\242\342\302\bpa\034\364e\305\n\203\004\230\330\254"
+	.ascii	"\007\346y\266\314`\336\007\320\254S\"\017/ZO\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 tE\003"
+	.string	"t\005p"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\036\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\035\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\032\t\201\204\001\033\n\003\013\001\037\177\f\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\005\200\200\200\200\004\001\204\n"
+	.string	"\005"
+	.ascii	"O\020\002\2275\030\230%1\006KA\001"
+	.text
+	.section	.gnu.lto_.refs.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8b673d273afe2eb5,"e",@progbits
+	.string	"(\265/\375`\t\022eZ"
+	.ascii	"z\235\204\"T@\024\036\245\003\f\b\273\023C\"\002V\2733Cr\003"
+	.ascii	"\220@}\270\2635C\362]\03706Q\325&3\203\001\002;\326Z\324\013"
+	.ascii	"\202TM\264\211V:\353\037jW\037f\231\361\330\234_g\360^\320\336"
+	.ascii	"|iVQ\370G\332:\311Y\331\003\200o\210\222&e\n\330\001\021\002"
+	.ascii	"\034\002\253\205\2265f\304n}ua\243\305\214\314\217\203\343\205"
+	.ascii	"4\363\343\342\254\234./5`\264\312\304\306\376%[\246\031\202\313"
+	.ascii	"n\235\260u\337\300\006\211K\333\255]JQ\020e\212\004\fd\301\354"
+	.ascii	"\230]\356`\001\226\032\263\356\344\027\353\337\254?\202\027\f"
+	.ascii	"d\203\330\255\030O\335XQ\322lF\270\212PC\353N\266\020j\261h\322"
+	.ascii	"\236~X`\336\\Vv\200K\375\322\331-\025Z\005\217\017k9\340\260"
+	.ascii	"\271j\270o\022\377JY,\024\247Q*\331\\\006`\341\022\306&\217\251"
+	.ascii	"\245\336\234Ro\362Po\036\353mkg\246\21719\\\261y\333\234z\333"
+	.ascii	"X\275\355J\275\rYo\253\252G\263I\325\333p\324\333\236\352\231"
+	.ascii	"N=\237\325\363\231z\276R\317L\352\231H\375\027\266\241~\251V"
+	.ascii	"_\366\246\002\231\205Y\261U\262X1\337/\333\345;M\311N2\017t\272"
+	.ascii	"\200@S\277,N\333\332\332\2628\277a*\257W\005bR\2056\305\271`"
+	.ascii	"\033\266J\241\335\322\267-\343\224c\212\315o\222*C\257\255\320"
+	.ascii	"\371%R\207VG%Z\252\020\224PcTP\227\312VY\345\212\265\362\b^\334"
+	.ascii	"6\254\322X\335\311\333O\035(u\324\330<\214\372\005\342*\250\372"
+	.ascii	"\305\007\250\337\025\347\256\355\212\363\\\317\265)\316!\260"
+	.ascii	"Mq>\271)\316\272(\230b\3707\200\177W\374;\364/\377\273\363/\320"
+	.ascii	"\277\007\374{\376\253\342_\236\177S\374[\342\304\277&\376[\021"
+	.ascii	"\372Y\351_\025\376\335\375\273\302\277\271\177S\370W\367/\272"
+	.ascii	"\035\374\213\302\277',\f\377o?c\371\267\306\277.\374\313\302"
+	.ascii	"\277"
+	.string	"H\377\036\375\013\343\277\230\177\023\370\367\201\177\035\370\227\201\177\027\370W\201\377?\377\305\376\333\326\326\326\326\376\263\371M\237\377\304\006\337\235]\242\377gm\233\300\177\263\373'\300\203d\017\305X\235U\037\2644\t\371P\177g\331M\244\032Z@\025E\244\372QTR\365\220x5\f26\325\260\250\354\016j\"q\210\301\261\203\212\312\216\352\031\312Dm'\251\206M<vP\023\273i\250H\244\212**\233\242\202\212J\252\250VR5P\023\233\2144\020\333\030\324J*#Zy\214\002**\217QE%U\220MS\\s\026\345\305\252*\311\206\025\211\235\003j\252\311\b\264,&\217]\326\275\\OmL\240{\352h,k\372\261`N\313\034NW\232\216\233\354n\001\240\234\252\216M\\\026\231\034\273\2318!5\324\004\303\344\262\215\354rh5\3258\236\272\007\350d7T\367p{\331\335\303\356\3461N%\273\203"
+	.ascii	"\025\221PP\335RBP=5\f{\352f.5`QEe\325\021\027\266\245D\266\215"
+	.ascii	"\344p\221]Fe\254\312!\225\306\321\335\033\247\"\243x\300\271"
+	.ascii	"\342$;T\212Gx\261yN\362\363\016\253\305HTP\341s\244\007\0172"
+	.ascii	"6\371\b\363pF\302F\030\311\004\307\356&FrK\242\273\351\266\213"
+	.ascii	"\300.\002f\224*%^\247\371\235\035j\317\2428W\n\356\254\303\315"
+	.ascii	"\214\0269WEXT\242\020_X9\254H\372\200\262b\363g\253*[\021\307"
+	.ascii	"1\031t\023Cd\310&S\tU'[\252\254\260\371\235!\365"
+	.string	"\333\305\313\032$Y\021b\256`q\203\314J\"qf\f\231\365\365\346\315\2173\273\222\245e\205x\322\306\354\347\036|\0037\361\017\236b\0348\b\317\300D\330\211\2378\212\207\260\r|d\033,\305E\366\3017x\007\353`!\214\203k`\032\330\310<\030\212\211\234c\225\fd\353|\327\270\317\311n\"V\2320H\256\256\335B3\313\262\346\313\024\036\252\241\031\263S~\334\034\255\027mv+\013\262\314n\221-\021?\356\210\225\303\205$s\203\005\211c \213\304\322\261\302Bv\367\003\311[O\230\332\017=\316\356\304\006\312\t\237-)\3414\206\304T\0326_%\263a#6\350\246(\"/]\007\211\326\306/\r\330\324\302\024\031\202Mv\303oVI\304f\3476\233\345=\304d+{\320\304\031\302\245U\277D\347m\211N\223G\211\0325\\\265\001Pw\325\325\231\2654\203C\244\354\253\3442\2562\203\272\233\220"
+	.string	"k\243T\003\025\r\331\225UT\375BY~r\336Z%?a4\266\242T\357\220\300\b\230q\252\201J\306\307\r6\211H\022yn"
+	.ascii	"\371\342b\363<\304\372\305\352\342\2575dW\330\013K\215\026\016"
+	.ascii	"kB&\004\213\355R\n\250\211Y\336\230\2211\026\366:1\f\352\266"
+	.ascii	"J\203$\303g\330\f/y\214\313\254\222\311x\3139\b\346\272P\227"
+	.ascii	"\037G\306Y\312L\240\221\243dy\302\354z\233\002\234\212\033d\265"
+	.ascii	"1\023\343!8\314.\245\222\275\303\004\226\345\03401<f\225,v\241"
+	.ascii	"d\213\026\002\374\250\245A\313:\303\200\361\001\253A\210\r6\371"
+	.ascii	"\313*\305nX\235\351\262J\366r\263\261\204\316\025\233\314\345"
+	.ascii	"mh\030\326p\343\\\314\036aR\306\220\251?\305\352\317,\225\301"
+	.ascii	"*\021fC\306\270\352Oe\375\251U\177:\251?\227\324\237\277\274"
+	.ascii	"\224a\316\306\274\330\314\030\034NW\225\211\252\260\222\255\374"
+	.ascii	"=\267(`E\276\212\3243\020 \034!\373b\323\334s99y\246\362\367"
+	.ascii	"\260\230\022$\024\221z\316b\255\277\347D\331U\027\0256\177\002"
+	.ascii	"\251\347);_kg@\330d\254\372t\336`QbH\026\034\204\260y\306\372"
+	.ascii	"Y\312\222\201a\215\316\0346\177\026\305\311Pp\347(&\306\272\230"
+	.ascii	"i\261\351\263\223V\317J\030y\356\341=p\223\232l\035\333\265|"
+	.ascii	"\023\004\255\245\244\210*\217\264\262\256\037\316M\356\306\247"
+	.ascii	"\013\350i\022\205,\262y9\314\344\177\017\317\224 \242P1\361\301"
+	.ascii	"&u\006l\tS\231H.N\306\260\251\344%[\307\347XvV\266\245\362\177"
+	.ascii	"v\223\261\273w\354$\333\350\344\023Gr\301\224\0261\245\273\020"
+	.ascii	"\320`\252\003\336\216\344\302\203\0218\020\241H\210"
+	.string	"\362R\235pH\230\213@\202\026v\277\244\031h\372\233q\253\001\374\315\370QB\205\301\032\"\344n\302#\271\340\001w\276%\023\276#\336\t\346|\2049\037\017\270\343\343\001m(\f\275\240\031\f\242\251\221\221\216\247\006\360\2673S!\320f\204\372x\275$\035\217\021\032\\2wh\220\347i\216\007t\361S#\025\006{<4\204\240\357r\276\fB\340\001\001\370\256\227\242>\224W?\001\214\007`\304`\342y\f\031\020\310\200\340|\f\0318\234\f\030\270z\0308[\252C\332\231\302#\241\370\017\210\246E\302\337/-* \230\343\365\216|\277\031Li\t\240Ni\227\356\244\250Q\217\306/\005\032\241Li\222\256\227\242\301 &4\t\270\204\301Q\222\016\251\004j\324KS\224\306/\347\353\r\ts<<\335\b\277^\216\267\224\004\024\n\022\242A4\375\t\227t9#_o\205\234P\027\314)-\245\302\026P`\220"
+	.string	"\0374I\267+!LQ\032\276\336.5\352)\355\370zJ\265\205\035\212\264c\322)\325[pF\222\216\206\357\327\023\352\222~\300\024\025\3728\330\245*\202(\232\362P\f\320$\236\357\002%\335\f\032\300#"
+	.ascii	"^\320\231\260\353\tu"
+	.string	"J\250\257\267\3631J\372!\005\321\024i\004T\270\273"
+	.string	"5\372}\220\366tB\276\2360\007\003Wwhp)\307\224\232HB}>\035\322.\307\264\244\3131\351\224n\301\364\227\246h\016U\322\245G\271]\032Lq\n\321\340\321\321/\327\013\006S\023A\002\034\035\375\204K\273\034J\243'\324\321\350\245\006\004{L\272\034oi\005\324H\230\213!\364\365\226x\216\303\315\030\"\001\004\r\352\316\005SZ\304\003\026\371z:\245\242]\032,r\001"
+	.ascii	"\n\254!\314\t\227\200\276^\216\347\353!\t\177?\245`n\227\252"
+	.ascii	"H\"-\215\326\332\034\265&;7\020\237\224\261\3718q"
+	.string	"8m\253\264\016!0\30658h\335RD?]\240\330\350\001\355\234\306hG\255#l\262\034\236\003\205\003\222\035<\347\b)6\024A\022\201R\250\201<\307\220####\"\222$I:1\005\3048\350$3\036\022\300T9\0309\307\204f\232\302\260\377o\f\017\200\251\013>\034\266r\271u)\202\233\361'\034\365\317\034\303\221\252\025-`Z\025Q\301\277\360\340\241\001)+\363\357\350\t5y\004\333_\272 rZ\177\333X\203\201X\335\301^\002\302\224A,\341\222\325\017\203\006\304z\266\3655Y2v\314\316\271\343\326\034\031D\026(\306'[\217V\330J\024\273B<03\303\004\353\266\374G\221\345r\375\337\016m\021\304\311\245\202\030\372\025\020c\025\304N1L(\351|\241\202gb\235\226\025\262SboP\371iO\006,\235\202\276`\2351\210\273\265\244\253\360\362d\n\346|\266\336So=\365\327\352"
+	.string	"y\206F?\232\200\353\307\017\026x\247\326!\373s\243\201\305c\020\357\002\237\340\277\357JJ\206\226\017~&5~\201\251\277\n\3074\204\360c\235]W\266\210X|x}\373\250\344\254\240\bT)\345\270|K\301\023B\310\307\002\t=_y\"\312\"\266\206\207\236K\216\311\204 \263\347\034:Y[\340\034\311+\035w\265\240\370Y\264P\004GjQ\340\n\256\226\204\272\310\300(\254Z\247b\214\305\336\354\343c\303\347J&\223!\315\352XJw\220\260\263Lk.\336\355\016\262\325\352`"
+	.ascii	"\004\322\362\367\261|@\315\r\264`*\304<\313\r\374\203\367\232"
+	.ascii	"\230T\013\252fIC`\2352\2346\013\372\224%\211Qr\305\312\315\366"
+	.ascii	"\237SUK-m\273t8N\325:f\200\030>\002\323\204\253\357\027\370D"
+	.ascii	"\022\1774\3762\032SC\002\337\247\232\200\001\336\312%1X\210$"
+	.ascii	"\341\366\330I,?+}\0062\263\304\236U\315\352N\345(\331\252\350"
+	.ascii	"\023:\364G\245GI\215\005F\032'\305[h6\374\242?0\025\370\222%"
+	.ascii	"\263-\223\243<\216b\273\306-\251\002\024\346N\267\234{s\3055"
+	.ascii	"\371J\337\274\244&\254\300\367t?\300\276\nR\335\327#\232\210"
+	.ascii	"\204I\013\007#\265FW\021\236\324\203}@\217)\242\333]\254\341"
+	.ascii	"uef\276\177%\200\006\030C\032\355Q_\025s\314oF\t\017\324]\345"
+	.ascii	"\374\364\244\267\t\200 \226\222\n\244\003\233\321RCg\020\034"
+	.ascii	"$\366a\274\376\344 \207&\023I\254\264C\341\3422\262\246\264\257"
+	.ascii	"!\242-\251\232\006\225\324o\373\301\371\210\016\"-8p\211>U\237"
+	.ascii	"\332<\306\246h^X_v6F\225\032Tz\003y\2203\361\022\277\2345i\245"
+	.ascii	"v\200t\025"
+	.text
+	.section	.gnu.lto_.symtab.8b673d273afe2eb5,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8b673d273afe2eb5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,215 @@
+	.file	"vcd.c"
+	.section	.gnu.lto_.profile.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\374\336\245\336\r\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.40104e0418d02c0c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.12.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \200\275\003"
+	.string	"\224\006R"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\236\275\013yw\350\367\004yu"
+	.string	"\005\001\006'\001\003\202\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/pg/vcd.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_.symbol_nodes.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 6\261\001"
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\f"
+	.string	"\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\n\002\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\002\002"
+	.text
+	.section	.gnu.lto_.decls.40104e0418d02c0c,"e",@progbits
+	.string	"(\265/\375`\253\006E)"
+	.string	"\272L\260\020Ep\234Nc\027\245\246\035*);\037t\220\350/\304f#I\237\265%b\302\031\364\177\247St\225\234\006\335\322C \220$\2118\217\225-K\007\036~\007\211\025\024\317\335\200\310\037z\020\027\"B\273m\273\311\224\002\330"
+	.string	"\373"
+	.string	"\373"
+	.string	"\366\264\204\324\247\302\001\210\2274{\236w\026\364h~\232\275c\333\206\020\311\262\247\221R\377\354R\354\235\037\2710)N\354i\006\251\037\305\366NNZ\263\316\313\236\207\222\262@0\004 \207\232\016\034\366\364\241\330_\357\344f$\356\255\272\367\026H\321\324\273\263\347\237\274\3147;\231\035D\260O\212\354\212\335{o\006\001\354\336\251\233\375\342\334;\365\373\027\374\013N%<\206\240\241\247\t\244\226{\020\352s z1$\277\211}&\037\003\242[]\353=\273\367\376x\340\2640\233\330\323\353\203\320\364@\264\347@\3246\265\215g;\3176\034\333w\266\355l\277\261\r\204\300\266\233\355:\333ml\373\330\327\263\177\300\276"
+	.ascii	"\373@\266\367l\237\266\333l\333f\263\331\264-\302>\230\235\303"
+	.ascii	"#\217\373\335\301\234\314\343~X\020\223c\336\273\026\005\213"
+	.ascii	"x\310\330\r\211\3739\267x.\001U\213\fcs\314\0076\022\335\323"
+	.ascii	"\274\215o-ro\2170\004dzWL\360\356]\353n\367\345\351\034\\oQ\221"
+	.ascii	"\001\237<3xch\0336=k/pX\331\363\314\227\265]\365\330\241\346"
+	.ascii	"\313\257\261\232\236\233\340geD/\314\236\237\363\234\013\251"
+	.ascii	"\027W\366\264\235\263\2344\254,y\323\221\372^\251\217%\227\216"
+	.ascii	"a\3468\213\324\237J\037\346b\276\034\372\030\377\313\343\234"
+	.ascii	"3\265\336\325\006\321\223\362\304\236\216J\375!\324\327"
+	.string	"l~\b\265\232\332\003Q\240\007\241vJ]L\355\277\271\345\224\261\325\301\271\275\315\327\002\013l\r`\303\274aQ\331\363\\\336\345K\005g[\177>{I\366\362\354ia\352+@\337\274\002\324#R\240\003Q\241\003Q\037\213K\220\335\b\256\220Z\242)W{\025{\347\247d\315GZ'B\177\315f\263y\"T\350A\350Y\206\213\313n\331w\357\024\334\332\301\270\340\370\332\222\332\366\372K{\355\326\327+E\241\253\301OV\2207n\354\t#\370Cr\245\025\206\226\372q/\254\025\222)\314\007-\336\366\270.\nJ\320\"\330H\366\312RY\253\037\251\365\302\230\220&\203\r\357\336\253e\261l\326\227\366\312\272\260\225\262S\376zo*\227\325V\227\236\266BR[\035\251-Wj\253\354\212/\203\226\305\301Pi}\331\323\366*Uq\233\017\242\266Si\360A\250\357\314\324O\362/\361\327\276\374\222\357\005\235\254R"
+	.string	"\270\230h\271\301\273[_\r\016wE\216iO\2755\250s\345\225v\246\226\372c[\376\206F\013\334\335\304\316\224\271\231#^\236\005\315\351\036\327\005t\253\324\3260\307\356\356\345n?R\001\356\355a\206\310\233\307y\336\361\356\346p\276\374\335\317\370V~\305\301\325\001n2\332"
+	.ascii	"B\303\207#\225XL*\251B\252\320\301\003\023\303\243S\0221yL\372"
+	.ascii	"E!\217I?\265\307MP\251\262G)<\022\227\214P=\250JT21\035\205M"
+	.string	"\351\t\242\252\214\372\020\300\003T7\031\025\221>\"\211\311#\365xL\036\361\f\237P\\P\211J\236'&\253\022\225\304d\216RXD\366\250\302\247\"2\347\251\210\364\251B\tH)1\205Qy*\225\304\344\322\222\222N\024\3628<U\341\004\365\311\210B'\251\"}FBJ\022\n\301\001C:4Z\032B\035\025\221GOF\245\023G\303\244\362\310\b\270D|*\032\235\224t\226\210J\024\347\323\321\250\016\211J\035'\205E\244\221OR\251ixF%U\245\261H\364 $:\031\231\216\311\016KC(\340\227\335\262mrjV\330\323\2663\374\245\235ao\234\353\215\201\232!\271\261\205w\267\2704\360\345\261\371X\332\323\332\260]_\022Y/[\032\266\206w\252\326[\266C\206.\307\331]\352k\250Q,\306\214S\206\320\bM4\2630I\261\001`\002\021*\273n\021\240)S\246\252\244\231\016W\223#e"
+	.ascii	"\232\327\227\335\006\367\335I\323<\221\006\006|\301\025\266\370"
+	.ascii	"2\020\025\310\250\025N\365\237\363\314\274\004\022\245FP\257"
+	.ascii	"\364\020\232\314Et)\317\032\021/\035\300R\245\f`$\353\345\017"
+	.ascii	"\331L\n\"\022\275\221~OqB\004\205\257x?\214\r\356\177\036\263"
+	.ascii	"\363\273\244A\265\302g\355\365v\313\200dCoy\372\266\317\356e"
+	.ascii	"8\030\341go>\253\313\001tZ#\030U\317\316G\177WS\250\002\333a"
+	.ascii	"'\254\r\306\300\231>z\307\003\360\020\221\211\316\223#\016\324"
+	.ascii	"\211\245 \225\001#^\321)\030\311[;\361\nI\021Za\350J(y\227\327"
+	.ascii	"\362\t\322\352\326CI\224\243K\233\202\343X\0270\266F#\343\227"
+	.ascii	"\030\323\t\353\312\253`\203\036\031dr\311\243z>\365(\202\341"
+	.ascii	"P5"
+	.text
+	.section	.gnu.lto_.symtab.40104e0418d02c0c,"e",@progbits
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"vcdProfile_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.40104e0418d02c0c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
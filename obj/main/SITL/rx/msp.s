@@ -0,0 +1,304 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 h\355\002"
+	.string	"$\005\\"
+	.string	"\007"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\203\262\371\241\017\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005\006\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 \270U\003"
+	.string	"R\004\016\030\260%\351@\340\202\303"
+	.string	"\227$I\022 \207\266[\303\227\264\326H\223)\005:\032\t\243d\251VU\2761\372k\021\021l\203\207\030"
+	.string	"V\374\330\363\2635\266Z\244\315b \024"
+	.ascii	"F\tPj\200SsA`\230\207\271\306Z$V\025\364U,\245\302SU\354+\n\251"
+	.ascii	"\002\354\346\002uU\013\337\316\230\315v\300\2620h\003"
+	.text
+	.section	.gnu.lto_.lto.62970eb186bf5e4b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.20.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\215\t"
+	.string	"\366\222C:0\305*\035\b>]\n\214\013\300\221\001\250Q)5\274\321\254\3253\202\034\225N[\213\fu\275\266\034\210\b\310@\307\bj \264t\0353\370\006\225\246\217Y\237\234\375\275\267L)2"
+	.string	"3"
+	.string	"."
+	.string	"\037\371\fj\330\221\341Aa\305Zv\303M\363\315\345S_p\371\214\034\007\257\240\177\223sb*-W\352\032\360\260\273\326\226K\343\216\267\315\261\335`\233\026\033\331.F-\300\256\314\031\210\355\317\316\330\226j+0|\207U\\\263+\026\217\005U\373$/\371\036Z\234`\367\005 e7L0\002\346\323!\306\266/\022\230\335u\360c?\241\360?>]:\351[\237\376\351\362)\243\300L\343\343Y4\225\326\3540\245q\303\276\334\370\262\255\226\207\375*\325\237\231\220\334g\002$%D\021\\\007\021\032\211L\334\311\203\362\006\f\352\220J\243\r\345m\234\3503\332@^i\353\030\270#\205\274\315\324u\336\226\t\367r\343\313\361@\025W\266}q\031\030\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.21.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.22.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\025\013"
+	.string	"\026\325M? O\225\016\303\322@\210Bp\004"
+	.string	"6,q4\326\020\307\024\002'X\241\226\374\024\307\270\206\276\272YL\371\336\243\314`\n\345\336\026\200\004\341\244\3066\005&\323"
+	.string	"\032\250\005\306,\"\233H\231R<"
+	.string	"8"
+	.string	"<"
+	.string	"\366\016\276R\017b\2348\\\354\202\233z\270\367L\323\363G\317\030\254B\324\247\272f\bX)T\222\257\224M<:|<\366\304\360\2312!\225\335u\242\276\fw\274m\007\266\025\330?\020km95}MW\247\216\002\341n*\204\261*\"\n\020\266o[dKlg\332\037q\230\350\031\025.`\267\365ab\027L`\003\221G\203\237h\217\221\017\320\036\275@\024\025\222\2262um\234#jt\210`\221'ZxpP\207\264\253\204\215\025\246|a_\343$B\376\007{>y\324\243\377\321\036\257\217=5\\x\261`+R\20668Ju\331\317v7\0240\0234\\\203K\006\323\321x \200\272"
+	.string	"\266P6\234\314\006\3526\r&Bf\263t\234\215B\300\334\346\322m\035\216\3536\t\270\327\226!\245\324\251\204\376\236\366\330\001l\b\221\221\276\247\245ZP\007\017"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214>I\303@\206\220\245*\207\346R{"
+	.text
+	.section	.gnu.lto_rxMspInit.23.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\365\n"
+	.string	"\306SJA \247j:\220P\022\004"
+	.string	"8\027fy\033 \352\341\227\314\214g\023\0014\356h\314\212\307\355\n\374\241\271\260m\213\226\203\322\240\2000\032@\220R\330\366*\0231\203h\226\350\272\023\302B\306Fd\247\0242"
+	.string	"5"
+	.string	"<"
+	.string	"\337;\247_\360\336}O\360\336\371\264\023<}\355c,\216"
+	.string	"\266\335\0059\221\237\257\247\177\330/\250\n\365j\221\330]WT\345qs\267\235\261\035a\277\"v\212\252\\\210\375\312\356\2569\227\375\364\257\026\317"
+	.string	"\202\206\003\273\035\267\005[\353\n\220\330>\306vMO7\315\253\375\223\243\234O\321\370\301\256KF`7}p&\003B-\026\r]\205\026\016\257\335\324Q[\274\214\374\007k\206\256\336\002\271\351\331\027\027`^`3\033\302K\236M:\200\322\267\273\020~,\003\203\3415r\362\336]Jf&\nR\365\026\241\0204\222\234\217\030\216F\022\205\2514\b\205\240\221\344\230\312\317\236\215\310\024AS\t\216aG\004=\245\tn\024L\212>%8\"\311\022\304\244\373\312r.O\320j)n\303\356x4\237\007\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 \204\305\002"
+	.string	"\242\204\021\036\260%\351\270%\216\035\310\262\214d\002\204\222V%I\n$\201h\204\020r\354\2154\262I\n\377\345\035\2059-\033\376\350\0320\222\002\201\345ZI%C\363\3455\241\363\023uN"
+	.string	"\370\374\001R\206\266E\251\360\277\001\005"
+	.ascii	";3\320\365x$\020\0032LS\2532"
+	.text
+	.section	.gnu.lto_.refs.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.62970eb186bf5e4b,"e",@progbits
+	.string	"(\265/\375`\013\025mb"
+	.string	"\252\243T$R@\220J\352\013\252\224.\f\316\260Bc\367\f^\r\244D\240hxr\327v=\333\236\220&C\223\b\344<T~\262\031\217\221A\334\356n\254:Q[\261\326\304\342"
+	.ascii	"[\367q\330z_\344\017\3047a\320\265\377\364q{\247\2608\244\320"
+	.ascii	"\022\222\266wJ)\007\002/\002.\002om\256\204\212\211f\203[\333"
+	.ascii	"\215\262\207&&5\35666\364J\255\r\316\323^k\036\372Y\242\317\240"
+	.ascii	"F(\217\005B\356J\016n\206\313]b\327s]\"-Ev!r\226\306[r\252\326"
+	.ascii	"\264L\037\367\254w(s\223V\226\374\342)\267\215\2632<c\031\325"
+	.ascii	"\321\214\273L\227N\207\224\324\226\247Iw\247E\354Z\fY\324\034"
+	.ascii	"\0254OY\275a\310P\034_9\254\270p\2231C\300\242\307p\376\th\251"
+	.ascii	"()\"\236v\227\366\322O\237\376\302\r\246\305\330\006\331\276"
+	.ascii	"\023\347\270\243k\314S\023=b\227\216p\271}v:\355\263c\267\016"
+	.ascii	"cf\233\234.fU\206\204\351\320aZ[W\355\216\031g\366\346\351\263"
+	.ascii	"\267\264\026\346\357I\257<\273\\y\312\032\\vq9\3055\321\"v+r"
+	.ascii	"(\241\323\356x\n\362\245\265\223\252\001G\305\253\213\307$\013"
+	.ascii	"\220,O\273\313\273J[\341\356j.\206\200\005\343 \037\353\277\355"
+	.ascii	"\256\364\377\330}@N\367\001:,3\034\243\354R\366\271\314M\245"
+	.ascii	"\267\\m\214\234\223\247\334[\314\3356\016\255\325\314\177\344"
+	.ascii	"\377\223\320\205y\311r\346iC\351(\375<\321R\270\247t\026\353"
+	.ascii	"\216\355\267\377\255\216\307\260F+\212\247;=b\347\006\\n'\337"
+	.ascii	"@y\026\354\227\373\304\016\235\233\353\023;g\366\210\235\002"
+	.ascii	"-b\327Nz\334OD\354\224S\355\353\344,\257\236[\236\3624an&\215"
+	.ascii	"u\002M\336`~\326\177\313s\221W\250`y\312m\217\330\335\026\261"
+	.ascii	"[2\367\207V2w\312\353\033\032\274\303\214\222\340\035\263\247"
+	.ascii	"Y\200\231E`\034f\224\027\3422{\031\346\216bn'\346Vb\356\024\230"
+	.ascii	"\033\005\346Fbn\226\231\337\230y\rs\203`\346*\314\234\305\314"
+	.ascii	"Z\314M\203\271C0\363\ff>\303\334;\314\255\303\3349\314\374\305"
+	.ascii	"\314^\314l\205\231\267\230\031\213\231\003`f.\314\254\233\233"
+	.ascii	"\233\233c\356\037\346te\336\361 >\306\273\270\231[q1\367\362"
+	.ascii	"/~\305\303\\\213\207q0\317\301\277|\213sq,\316\345Y\372\351c"
+	.ascii	".\205}\212g\261\267\377\310\306\242!\2549\305\002\0321$[\326"
+	.ascii	"\264\340\214x\361\034\314\275'OX\330\320l]M\030\232\r\214\317"
+	.ascii	"\300\334s\342M\262\2327T\031s(\376\f\202\325t\035\255\023\"W"
+	.ascii	"\315F%\211\225\265\"\314\275%[\315\030\230{L\274\211\026\217"
+	.ascii	"\032t\320\321\344B\344\2052\016$H\263\345\240\377?\3144q\230"
+	.ascii	"`I\223\2651\037\322Z-\366\002\005Xgc.\325l-6\365\250\232R\215"
+	.ascii	"\225\325\177\213\242\007E\227\245Y\222\242 \345\235\332u\007"
+	.ascii	"\304\\\366'\033\t\377Y<$sPg<\365(=vg\001U\260|y\312\333}\271"
+	.ascii	"\274\343\272\274[ryw\344\362\016\352:V\272\303\213\220\335\322"
+	.ascii	"e\035\332e\035\227\313\272'\227u5\\F\243#rY\327\343\262N\307"
+	.ascii	"e\335\215\313:\245\313)\333\345\224\313\3454\312\345\264yy\013"
+	.ascii	"\220\313bi\323e3\271\313kg.\243d\227Q\256\333\323\2023\373\331"
+	.ascii	"\343.4\231\022\024\225\247\214>\257\n?\327=;F\257.\243D\256\017"
+	.ascii	"\372tW\244\335\037\317r\331\235\\\316\362\352\021+\340\260!C"
+	.ascii	"#[\322\236\345`\304\227n\313':\326\224q\00389\031\361(\207\232"
+	.ascii	"R\203\252\311S\177\352\271\241\212+\"\346)\273\f\267\347M\376"
+	.ascii	"\315\206\266M\336\024!Me\215\326=@\325xbv\033\276\344Hgr'\257"
+	.ascii	"\341I\277\321Ooj-\354F?rO{\305\225\030mi\f\013Y\336\324s\255"
+	.ascii	"\205\266^\227\351\351TF\246\315@\t\201\302\322_?KJ\033\2461S"
+	.ascii	"k\215\305\334C\323r-6\265\363\310\347\215\346\177\313\02107\030"
+	.ascii	"{Sg\3511?K\312GN9& \246\013\216+4\377-\n\024=(p\216\310\220c"
+	.ascii	"G\210\224\375x\321\037\267\313M\246\327\300\301P\206)\f,\216"
+	.ascii	"\341\210\260$\263\324p\303i\351@\221}\311\341i\247\3510\336\221"
+	.ascii	"\037L\334\232M\007\344\315\214\225,\267\016N9^pj\236\236\242"
+	.ascii	"K\250\215\013\346vC\0136\030M*Q2\026\346\254\007\n\222\037(\223"
+	.ascii	"K\301a\232\265\231\035A\037}T\351v\225\237\362\371\240\206\254"
+	.ascii	"\007\023zdT\211\323<\215\n\231+OQc\177\355\222K\326Ha,:\276\230"
+	.ascii	"x\361\224\257\217\313\335\325.\367t\271\356\352\366\243x6\274"
+	.ascii	"\224m\003|\241\320\240\361\270\033%\006\307\036\307\226\223\345"
+	.ascii	"\n\232\013\256\006\304\2259%`\324\244\271\0313S>\2711\213\302"
+	.ascii	"\364\\"
+	.string	"\363\366\364\267\336\262I>\003\255\234\234\325+\225\r0\257\355\262\243y\032\273\032\273\232\267a\320~\324\207\"krrh~J\351\303\354l\354m6Cp\334\220\364\324\327\374\fOM\212\024\037~\306yHol-y\370S\016\021\036nO\236\327ev\346\335\037\225\377\217C\327\276R\t\207[\327\355\303\f\242\321F\200\231\323G\231\331\200\013\3327\366\020\327v\221X9\366`\023\317,\366\217\2542RP\265DVI%\235UoD\0321\362(\277\312\230t\376\363<\022i|\301|\236\244\363\227_\203l\331\337V\031\037\311|\236G\376\321D\022Y\265L:\217K\236\244\263j\371\316\252\337y\344Qi\003\371J\236wV\361\360N\346r'\351d.\223\316\252\037\r&\t\267\266|\213\003\202\3264$\221\017\365DuT\356\210%[\346\233\375w\326\322+\021\370\247b*\315\216R\355\245$\006\245\304udv"
+	.string	"OJ@\230\217\024K&a\376'Q\"\372'\t\214\255\330\027i1c\020\252\277\261\364/\300\323\277\261_\354\377\215\377\317SR\265\377<v\222\315\247\247\377\251\236\247\2472~-\375{\326\231\3272\351\004\302\354}Iq6\237\2515v\363\315\252\224\327i\304\341o\374\177\263\335\346r\2053f|\207\017I\240\264\276<=S\341\327\302x\312<\346\345\316\022\262C\263\354H\027*\037iM\260\035jd\370\322\004\353\241\246\204\271g\305\365\303\253\254\320\326\376\337\213\227\371\226\203q1N\306\311\274\212\227q*\336\345:\004L\224b\203\031\031|\240\202U\207\326\037k\202\365A\020\001\r \261\bH]\211@B\225-\236\360\201\016\033\034f`\243\"\005U\240*\203G\035\022_\344\354\030\025\205\227\001"
+	.string	"\222aT\344 i\315a`pU\207\352\320e\tZ<\320\342'\211\307?.V\270X\261\343\037\027\275\236\213\026\275\313-z(;dD@\322\372\301\350'\004\256\272U\r\n\"\021W\243 5i-\372\005W\265\310\223\244\026\031\035\275\020*\372\021}P\203\202\353\252\"\021}\303\240\t\326\307\033\372\315 \006}CGEF=<\254ZTW\"{\364\363\005\r\203%\370\330_\321'<ZY\032\252Qq"
+	.string	"\034\265\350\007\374\300\256*\3220\b\\\203\202B\3350(\2744\200*\0210\351'\274:E\240\242\037\322\220\030d\177ED\243Ue\207\031"
+	.ascii	"W\022EU]\207\324\027j\321\320\260\002\341\017\b\311H(\204\t\277"
+	.ascii	"\020\200A\366'T\207"
+	.string	"A NP\021\221h\206\312\002+P\203\210\034\254\301_\3170\bT\213G\276\244\365\306\227t\364\363%\375\204:\305\225\270\256\252\317\007\\\213#v\254Z\024\022\"\372\202\305\342z\303\023\200\220\020\221=\002\372T\244 \373C\n\256\005\024\203I?\337\320Q\tj\220jt\002\353c\217\214\206A\337\3200H\304\022\211\302\242\017\270\222`\231(E\322J4RW\025,\221\270\252\270\021\262a\207GD \034\225\375\311 *\252\253\220*#i\005\021b\b\303\204\237\214\240\237*\003\270\336\254l\214\037\336\020F\361\210\375\261\037\254l\f\021C\030\305\242\n$\2561\200\353\316\312\306\b\301\372\212 \334\242o((4$\002\251\302 ;<\222\221\264\362\fa\024AP\205\301\031\252\360\267\302"
+	.string	"\256:?\366\367\242H\035\016\177D\300\233\"\"\321\002\237\216\365\265\350\261\303\340\321\345^\017\310\004\b\035\\p\201)\214\212B\025I\253\212a\360'T\001\\\213*R\210\300\021\367\204k\307\333\322\333tVC\302\236O\334O\364\t\215\302\340\217K\037-\306!`h^\271\245\001\024.l\b\030\neS\306\346#K\353\362\275Bk\2405P\247\b\230rrV60pE\21551\032\201\261\250\221@\207\024$\"\"#\022D\222$I\007q\005\3040\310$\253\035\022\200t9\2261\311\2044I)\373\263gG\301\306\027\265\220\366\345s\211K\364;\365\205\0130\316\274m\013\336#\254\371G\201M\374\244\005\366Nkk\003\"\320\020\345\306D\213\255W/\302DwV\337&\n*"
+	.ascii	"\215\337\"#\321_C\t\352\026\367\322d\271,g\333\331\354?\006\030"
+	.ascii	"7S\006\350\227q*\0231\230\0033\322\206\227g\335goN#\214\371\221"
+	.ascii	"\311\366C*\r\320\270\303\225\275\265per\210\f\275\006\333d!\225"
+	.ascii	"\025E\351J\343\352=\277\351'\220E\326hs\002J\276\257\223\304"
+	.ascii	"1q\003\242S\373U\b\326[%\223\2406i\317\013\303op\236\367\026"
+	.ascii	"\026\315\322\353\300\364\027.\273 \204\206\\\212\326=\2435|$"
+	.ascii	"\317\023\270\036\225$\017\003\260\0070\355\332\267s\312\325I"
+	.ascii	"cc\277\340c\210\332\225\247\322Ml\226\236~\266\003H\302\bc\252"
+	.ascii	"\001\310\237\002\027\346#\222\324\375\262\257\232R8\324\322\221"
+	.ascii	"\3701\264M\261\253\247\013t\177\004\023\263\221\367\223\203M"
+	.ascii	"\365\331=\354|O\307{\305\b\360A\276t:0\031\256\324\211\345\022"
+	.ascii	"x\326\336\270\3519P-\t%J\325\247\201\312\226*\316\224\333\377"
+	.ascii	"?\272\025\231\341\256:"
+	.string	"\004\006j\035S+W\321(\344\025g\320*\344\342\213\ryy\247\346\251\324*\221\237\303$Q\261\307\220Zh\232\264\024\312f\355p\344NPDUr\f\227\"\267M\265\252\202x\241D\314 \313\375\273@{\361\362\277\202b\243u\252S\270\307K\372\016/\0263\266\r\336\023\331]sI@\311&t\350\007\305\235\210\375s\177\372\212G]\252n\304\001T\221\315\177nX]1\260\334@]\0201`t\231\365\302\241*\003l\325\325\034Se\035\325\243m\367\223\332\030\342zW\237'dt\b\302\250.\370\214\310\250\2421k\324\305\241\204\223i\242D\353\246\344\177\241\033\3069b\247P}\031\244\222;\002V\301\356\375\2458\321^\320b\022!\"\034\f(@\321\350\364\023\205+\326\351\035\340!\207dC}a\016\314\230?~\274\253\251\362\016I[m\302\365\363\351\225%\365\202\017\307\315\034\021\276$\337!j\314]"
+	.string	"4$!\224\n+\214x\022"
+	.ascii	"\006\273(\030h\312\250\tI\025\344\230\025\217\201(\233\326\237"
+	.ascii	"[YU\365\274\026\200Y\201\013,\b\0012{uV^1\335G\360P0\030\200"
+	.ascii	"\243#/\2439\027\317\360\354\032\347\340\265,;j\322u\311\262\235"
+	.ascii	"\240\r\234m<\243\256\236\\}Y$\316\206\211\226\017\272\355\322"
+	.ascii	"o\320\331\254\304\362\341\204\231\200I\022\321R\001$~,\007\030"
+	.ascii	"\244\007\301\271\272,l\334\310\376\0258\240\255\233\267\336\334"
+	.ascii	"E:\332\317\232\211\254z\334\226\037\262DP.\332=3\266R\210C\261"
+	.ascii	"\315\332\351\236\347\274\351\322)\374\373\016\0021\271\346\320"
+	.ascii	".\331Po\260Z\257\225E\331UmV\330^y_a\207}l\326/\262!\335z?\366"
+	.ascii	"\333\376\252\254\205mQ\252"
+	.text
+	.section	.gnu.lto_.symtab.62970eb186bf5e4b,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.62970eb186bf5e4b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1841 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\013"
+	.string	"0"
+	.string	""
+	.string	"5"
+	.text
+	.section	.gnu.lto_.icf.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\276\002=\022"
+	.string	"T\030\262\003"
+	.string	"A"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\212\215\226\271\004\n\002\002\002\004\002\005\002\006\007\002\007\002"
+	.string	"\002"
+	.string	"\007\240\342\234\212\n\b\t\352\263\360\321\b\n\350\373\222\243\013\004\002"
+	.string	"\002\b\013\253\214\322\203\007\b\t\002\n\002\f\r\016\017\020\360\222\206\211\013\002"
+	.string	"\002\004\022\242\264\360\361\003\b\002\f\002\f\f\002\f\023\024\323\215\331\215\001,\002\r\005\002\016\006\002\017\002\020\005\002\016\025\026\242\302\263\302\013\031\032\033\217\224\332\351\013\017\002\017\034\035\036\037 !\270\276\216\264\016\016"
+	.string	"\002\021"
+	.string	"\002"
+	.string	"\"#$%\323\331\354\253\b"
+	.string	"&'\256\334\323\366\007\004\002"
+	.string	"\002"
+	.string	"(\264\370\341\227\005)\354\227\327\240\016.\022\002\n\002\023\002\n\002\024\002\002\025\002*,\350\300\306\254\005\002\002\r\002\r-.\274\205\242\255\006"
+	.string	"/0\265\265\216\336\006$\026\002\026\r\r\002\r12345\252\252\341\245\004\b\r\002\r6\365\273\261\345\005\027\002\030\002\0307\202\245\236\333\0068\274\201\267\213\0079\223\335\346z\002:\323\343\357\213\016\006\007\002\007;\312\267\354h<\275\250\276\313\004"
+	.string	"\002\031\002\004=\304\264\335\245\016>\317\356\361\267\004\n?\273\372\210\375\016\004\026\002\026@\342\201\222\246\004A\361\246\255\314\006BC\312\274\242\261\005DE\240\342\234\212\n"
+	.string	"g\250q9QJ\310f\232\302\260\033P\002b\306\250:\020Xk\306Y\306\0178b\320!\250\235\347\331\3703Z\215\245\032\242\200\303=P"
+	.ascii	"\"\364\326D\351D\273\347\031\356\211\215\202|`\360a\336\335\236"
+	.ascii	"\266\371\030A\306\022\n\210\325\006y0D[g\2473\037\200\226\242"
+	.ascii	"\004\t\004h\2764G\227\324\342\025\352\203\2526Cu\213\364\216"
+	.ascii	"\340\0322\337\206\030r@[9\326\375\232\311\247\320\226q\310a\320"
+	.ascii	"\271\304\006h!#\345q\200W\255\214T`\217f\005<b\320\320\3743`"
+	.ascii	"8S\341i\237\321\303\361\003.\226\352\254\025\020\313\006%u4\007"
+	.ascii	"\371\240\367\366=\006*WD_5\366o\245\336i\201\223r\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\r\005"
+	.ascii	"\022G\023\025\340V-6\024l\2461\237\b\b|\226\306\033\254\265_"
+	.ascii	"\366N\001\367J\247\364\211\244G {l\216\306d<\357\026Ml\304>t"
+	.ascii	"C/\020\006\202\017l\253\003\374\203x\237\256v\270\245\246\037"
+	.ascii	"9>#\222\315NK\3272\253\311\355\365\024\001' p\202Ax\033\273\f"
+	.ascii	"\302\t\260q$\203\255\235\233!\314\006\001\336\023\260l\006J\024"
+	.ascii	"\215\022\344t\004#\260t\277j\263x\304)\fap\201D0\306\213'\364"
+	.ascii	"F\200\\*F\370\235\224\300\315\245\305\021\202\343\202\026\203"
+	.ascii	"\335\0305\0249\030\270\270\340C"
+	.text
+	.section	.gnu.lto_.inline.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\252\005\365\026"
+	.string	"\266_rH\260\326M\032\003\264\262^.\222;y\025\3645\346\266\007\021\234=\261\360\022\005$\220\324V<?`\310O\367`0<\033\n\305\\\336zp\336\330\331\366 O\246\302\323J\215\305\221@\332\273\361C\200\300\266D\326\354\226r\247U"
+	.string	"_"
+	.string	"]"
+	.string	"{\265#\264\305\275\245\367\337\036\323\350\242\361_\020]\324\304\3628[\"*\244\033\337/\232\332\346\234\006\364\227\246BsN\001\263\344\246\230s\252\370]kZ\325s\303\261\324T\327s\303\245\034u\235\3219\347l=m\243\302P\247\242\037i\033\206\241\356\3650\267p\001\253\244\303\263\244\307<\243D\273#K \016\017\321\016I\213\374e\032\215\242LG\374[BD\334\320\222)\211Y\307\231*\351\360\340\210\r\302\226F\215\222\256\230\2009N\236\254"
+	.string	"\377\006[)\262fmA=\224\304l\364V\303\311Ol\224el\254\345\177.\271\364 \227//\253\374V\371\255\262Cj\263C7Iv'Bh\223\322\016\306?V\340\023\206V\260E\nC+"
+	.string	"'\310\351.\346\234\257\021\254\367\201\177\223\346\234\262\002+\303|\320\231>\335\b\201z\331\237\200\306\343\221\2469\244\202d\264\354\362\257\270\214-~\204mms:p\230P\350l,\371\231i\226\377\036E\275\245\307!\377\254c\2104M\321\250\232\232qs\255!\303:ah\321\337\331\027n\232"
+	.string	"=\t\301\266\220\233s\252\310\206\370"
+	.string	"M\301\256\260\214\315\211\302\214G\243\256'\354\020.\007\345\372\032}\321\242(\306"
+	.string	"*#Q@\002,\201f\245\346\234 \256\310\316\021\313\021^a\305\030\204EPN\r\304\362\3309*\332\307\020\0368h\260\fP4\200\202\250!\271Rf\346dFJ\222\024:\200\002!)\252\362\022\240dQ\004!\0218c$\311\005%\345\357`\tG\376\302\331\333\302cZ\013i'!Q\350%\341K\316\237\247\216\225\n\027u\335*\t\257\214\215\267\f\215\204B|\332@a\334\233\363\212[\0278\275H\274,X\2735f\377\357B\032\325\026w\327\002wAMa\313$\004Lbf9^\205(\210\331zbs\237\200\254>\303Xfk*/\275\303ab6\215\316\273g\223\225\217\215~\344\363Fs\016$Ht\370\022\\\266\255\370\f\303V\002\025\375\257\031.\260\t\303\204\033p9;\342\371\032\023\0011\357\337v\314\007\336M%'K\260\372\004$\252m9/\204\354\035\0327\323w"
+	.ascii	"\373+\017\005\235=\240\007\325&\023{\266\237lb\273l\255\355\373"
+	.ascii	"\327w\005\270ee&\016\341\316x\206X8%\335`7u\213\322Q\345P\246"
+	.ascii	"(\233q\310\361{q\217*L=\327`-G\360aN!J\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`g\002]\f"
+	.string	"\326\02195`U\223\3410\fE\333\022\201c\325\031m6`GQ\024\0051\303\016\2700\004"
+	.string	". \221\376\277\200\347\231\265V\0255\265F/4X\360\320Z4\321{K\231\002("
+	.string	","
+	.string	"*"
+	.string	"\222Q9\302\013H\036\226\354=6\320l \376\256Q\b\372\245n\"K\371\201L\263\030\3253}\262ed\035#\327\3148\002\254\2442\323?\230\252X,t!\326e]t\"R\373\006\226\233\217"
+	.string	"\310\017\313;\022\312\232#\335G*\377h\373\202)4\205\226\214\002\226\363\260\357U\241W\205\370\207w\370\206g\230\001x]\274@\272)k\277\300\316\317\231\332`4_]\346"
+	.string	"R"
+	.ascii	"'\223\n+\351\377\306k|\306\"\021\t\220\362\030\177\361\025-\250"
+	.ascii	"\212\035E\247\0163\361s\227\343\036\345\2245\204:\213\304\364"
+	.ascii	"\336{\255\312\222\021\001I\250\341(g\252DjT(\264\031P\"cd\326"
+	.ascii	"\001\021\300P\205\230*\231aRR\254\034DBR\213\304\"h`i,\331\320"
+	.ascii	"\350\250\024v%\346\025\300\267\270[:\n\tg\355\321\362\266\340"
+	.ascii	"\274C\342\r\031X\322\300\206T\004>t\2658D\232U\346\375\036\332"
+	.ascii	"\006h5\004\256\260\237\367\371Y\261\211m!\244\272\032e\211\365"
+	.ascii	"#L.\360\321y\332J\341\315\260\006`\357c\214K\217\017\211j)\254"
+	.ascii	"\313}k^\362M\311@\373\327\210?\222\030\274a\031\2432^`\320\177"
+	.ascii	"\310j1-\332WR\271E\005\226\3472\001"
+	.text
+	.section	.gnu.lto_.pureconst.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 h\305\002"
+	.string	"\202\006\025\036`m\322\001\032\005b\323Q0\004A\306\320\021\236\246\224\365\243O\006\255\273\311"
+	.string	"Kkv\007#e\234\214\222\033\031!\367q\035\267q\031\347\342*n\342C|\207\3210\026^\204sp\0057p\325\005\334\351%\335\350B\257\347:\337_\3631\347r\2322\263J"
+	.text
+	.section	.gnu.lto_.ipa_modref.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\371\001\375\t"
+	.string	"2\016')\200\271\225\00330?\005\230\240\t\232\340\311\005\0224\200_\374\033\032-\026\373ff\270\204g\233N\026\210\367\221i\311N2\005:(,(\317\304\022\272\b\b\035\243\276\007uP\033v\341\027K1"
+	.string	"\034\224\301l\331\345y\375\245\220'\304y\354\030v\226\367\372Q\367j2\211\273v\225g\205\242\246\035D\317h'\031<\236\013;\353i\255\260CP=\253\233\001\215\354\022\276\241\002\216\206n\263\340I\261\302\003\244\335\364\234v\223\247d\027\271y\2345\352?\302\224\236\324\313\314HH\317\bM\2501Uc\250\2044\225L\007@\002\202\2342\363\021\220!CN\2316)\226\003"
+	.ascii	"\020\272H\354\337/\203\345\214\3118\3750\206\254|\325\325p\214"
+	.ascii	"`P\026\267\317\345\204\024\005HI\246\351\255\257\335O*&m\312"
+	.ascii	"\365\367\377i\334\316X\2657\351\235\323\374\237 U\316\231\227"
+	.ascii	"E\025N\247\360{\2539\334\372[\370^\211t\267\210\030h]Y\215\223"
+	.ascii	"s\336R#|\3027\320\f&\270=\255\255`\035.\242\236~\016\326^\255"
+	.ascii	"\330G*G\306\327\364\250\365B\230\007\033\217_\225\322[\240\231"
+	.ascii	"+t\360\362\001"
+	.text
+	.section	.gnu.lto_.lto.e0ad421e2456994f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.87.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \215\375\003"
+	.string	"\024\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\366\321\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\325\030us\336\007uq"
+	.string	"\005\001\006'\001\020,?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.88.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`}\001}\017"
+	.string	"\206\035iF"
+	.string	"\221(\035(w\233\177\017\340(\017J\356\351\240\306\364QIYH\021\t\323\034e\337\021!\304\202\032$\250\266W\256of\215\371/mxx\377\377\245\317M0:\303@,q\231\001\013\3003\373\225\020\262\267\334)\005S"
+	.string	"P"
+	.string	"X"
+	.string	"\335?\266O\233\354\033\007a\373\320FJ\213\233\335\365t\204\345%x\313h\372\224\032M\376\313C\\5V\254\323\247\f@s\t!\200\325A6h\301\320.{Ta\245\242lY\271^v\005\256\331\212\265\362\310E\330]\307\025\013\304\275\335\366g\033\202}\027\001\235\307~\356\341-\037\2551:\306\350{\270\033\232\002:v=\324pvf\312(\361\360\366A_\266\342,L\017-\323\235>t\263\360\006\307\356\212|\372A\367y@\336c\373\321~\212\2530=\206r\002\273\257\234\230]\220\201C\272O\203\007\331>\003\256\231J\304\200\030\322a"
+	.string	"\240\351\201\202\253\371\311fg\370\213\023\0045\273\353\300\237\2254\030\200\221\370\364Q\266\317\004\260\034\250XsTNU\257:q\323\330\256Q\2572\221\2125K\275^v\211\343\212\221\222\203\2125\325\026\f\255E\225\305\006OQ_4\227V\214\365e\007\241\223LB\023D#\022\220\211\350#\241\002H$\372P )} .\031)}^\351\363D\241\217\005\257\344#y#\037\036]"
+	.string	"}\036\206\321\350\363<\340^_\376\313\273\331\216\031\224\246\246\262\230\233\241\035U\233(r\251*\266e6\251\217\2056\034\"\217\313\335]\351\005\227\332\321\r\001\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.92.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \215\005\004"
+	.string	"$\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\377\221\021\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\366\030us\350\375\007uq"
+	.string	"\005\001\006'\001$+?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.93.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\366\001M\022"
+	.string	"&\243|H\300\322Q:r\220\317\355g\021\202\260H!\200\233\211\313\032-\206\352\354\254Ldd\003\"\031' \260:\300\327\364\264\177\206\022\2620zb\031\n\216\242(J\271\266\336<\205\031\220\261\330\344T\005d\002\266\032\331{K\231Rg"
+	.string	"b"
+	.string	"j"
+	.string	"\027\221\217\226\3316\276\323\315\363z6\"\2479\347j},\340pwK\225\375\223\021\256\312|\241\227\350z7\334\314?\270\"t\334\250p6\230\202t\263\343CW\033\034Me\212\204\316c\207C\310\340\350\203\017\025\256\006U#d\320@p\031t?t\005\272\243\033N\347\372=\230sZo8\0167\352\266ql\247\330J\022Z\200\307\216\222\267\307\016y\320\237\212\352\357\274[Bu\274\032\256zW\255\252\276*\3053#A\321\234\033z=\246R|\361s\336\355\357\374!\025_!;\317I\250\031\034T\021Q\r\2169\247\311\243\035\240\036\r\300\203\330\276\332\007z\n\331\203dF\002\314\032\357\306\305\234\273\023\227\240\036\275\373"
+	.ascii	"\371\210\n\030tG4<\337\332\257\033\001\330\231i\017\306\315\251"
+	.ascii	"S\r\212\033p{ \344\374\360j\324\364\311q\355\ng\001\203@7\347"
+	.ascii	"l\340\027]\210\035`\n\361\350\313\310\307\230t\313\361\215K`"
+	.ascii	"i7\265pOcB\357\030Rw\3674%\344\352\302\026\266\0373\355\371\344"
+	.ascii	"r\277\037\372\312\t\035\f\033\020M{\273\244\201\006\210\335\234"
+	.ascii	"\275\243\005\255\307\"\264\\\\/\225\227\026\227\213%A\245\305"
+	.ascii	"\205\025{i\261Vb`#fA\211\201\255b`+W\2135a\305\002\213\255PD"
+	.ascii	"\374\242\320\002[Yx\275`+\220\335\354\333#t\224\221\007\245\331"
+	.ascii	"\322\276\315\371k\212!\273Mjr\2716N\222rW9>\274\246\232>)\234"
+	.ascii	"sN\2719+$9\214T&\244\240\215\207\221\337\332\330\013.7d\003\""
+	.ascii	" @\002\204\030\026\017a`\357\035\232\033'\313\312\342\276Q\020"
+	.ascii	"5\312\244\301\206\360\013\350kLz\f-\370\252\235\265\335\377V"
+	.ascii	"a\343\231ZRh\016\250%\344Vw,l\320\315n\fPen;\233\260f?\035\355"
+	.ascii	"2XDv@\364\220\365}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.94.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`r\001]\017"
+	.string	"\306\034hG\340\262(\035\220F1\020\\y8S\330\236\236\b\221\251I=\267R\302w\020U\221\340N\037~\247\222\271Q,\326\323T#\021\271\026\260\241\300\022\34681\236\353\310-T\370\216"
+	.string	"\307\b\205\324\317\343\"\261do\271S\nQ"
+	.string	"P"
+	.string	"U"
+	.ascii	"\333\247O\366\316\301\024\373X\353C\254gw=Eay\t\3362\236>\245"
+	.ascii	"\306\223?s\221\0252\025\013\365)\003\320bH\b`y\220\rZ5\264\303"
+	.ascii	"\036W\254T\224/-\327\303\256@\205\016\025\253\345\361\023aw\035"
+	.ascii	"U,\021\367v\333\237m\b\366e\002\177\375"
+	.string	"\362\341\035\377\272\017\340#N\2040@5vA\324~l\316\274\321\342\341\355\203>L\306g\234\036\032\207C\205\340d\261\022<vw\344\323\017\270\317\004\362 \266\037\355\313<\306\351\257\224\003\004v%\\\315vA\006\026\341>\r\336\300\366\311=$\321\307\345\356\256\364\202G\355\024\224\203\305\304\301_9\005\365`q\221\2125\017\230i8M\007c\323\343\217\316Q6{\303e(\334\356:\360it\340\200@\207\305\247\237\262}\036v\020\214\315\013\036\225XSm\325\320^T]l\020\025\325E\213i\315\254.\273\343\002\243\237\214&\220J%\242\023RHB\005\021\211\024\242Pb\372\n\330\204\304\364y\246\317#\215B\026<\223\017\203G\022\342\322\005\321\347e(\225>\017\004\334\253k\346\034\215\215\034\025MMu\361\007\207vj\272y\305\221G]\035\366\216\347fG9\265\214R\257+\343lQ\377\nw\254\004\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.95.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\005\b"
+	.string	"\362\21678@o\323\001X \220\310B\343`\2345\007\275\233"
+	.string	"L\361\374\274o|\275\032{\215d\026\366\026\t}\022\215\302\361d\225\222H'-b\"\\\352\200\326\230\277u\023\"S\n\020[\327\201\0364\214\003\327\320y\013[\210\023u\023\f\237\004\260\346\371d\374d\3548P(jR\"z:\366\"6\031E\236'\343f\356\303l\300\302\"\331s\244\026\312\376\265\326\311V\215\013\213\201\312.\306\352eW\260\024\017\333\240\275\261}\251\375A"
+	.string	"_Bq\316\222Z:>\252\366GN\002~V<`\367\244B\331\235\007&\310\034\363\314\330\366A\036\002:\324\311\221\241A\245.NT\2733r.\220\035\323w\262c\326\306\303k\350\337\344\327GjU2\215\256\030\205\335\265\226L\032\267u\333\005\266\023l\213\004\f"
+	.ascii	"2\003\202\341\243\302^\025\220kx\227E\3531\241\301\\\201\n\007"
+	.ascii	"w\215T+&a\222\001"
+	.text
+	.section	.gnu.lto_nullFrameStatus.96.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \367\355\006"
+	.string	"\242M26@o\222\016\233\265\224\376\211\257\030\357\200\030\231[\226Z\365\317\207\026%2\27390\337\242\304\316\211\372\036\3471>\210\027\030\201\200\224\251\365\361:\363\353n\266\021\231\002\021\030D\2465\204D\330(\243p \301\200A\037\022|$\3702\354A\364@p\342}<k\022!\370F\232\006_'f\267\213\300\242\272\370hrU\307W\223\231y\305\361\216#\323r\260\222\211\232\211I\026K%\344\357_\372\316\357\334\227\244%\245\232TT \223\303%%3\"\\\260\251u\354\300UkS\317U\353_a\241\364\326\370\201\342`\214d\240\300d\306Wyt\253\333nO\252\021\001y9\245Lu"
+	.string	"\f\231\271;\2454z\325\337\340O\3707\002\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.97.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \371\005\007"
+	.string	"\002N36@o\222\016X\340\227jK\342\232\030\264\002\bV\254\377\005\326\016on\024Dvs`\276E\211\216\267\303\216.\021\326}\001\022\013\217d2\301|\022\316\354\033\"D\246\024\242\t\022\366\020\032\211J\244\013\b\023\024\030\3641\301g\202\217$\222\030=\020\264x\037\317XE\b\276\022\206\301w\314\272\325\3156\005\031N\343#\2529\220/@f\346n\365-\202\325\232Ip\311L\325\320$\353j\031\371\373\237>\340o\355[R\223SO0:\220\271\222a\311\214\n\033tz\035K\260\351\325\251g\323\353\237\241\341t\326(\222\342l\250p\244\2642\343s!\315\332\262[\224\036\220\300\274\304\254\250Pm\034\207\314\274u\250<\272\353\217\360/\374\037\001\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.99.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\252\013\225:"
+	.string	"Ze(\026?@\346\316\030\275O\275~\272t\307\276\317\336\031\225Rv\250\b\031\321\230\361s\324E\231\007\202\324\237x\257\347[\375\242e\240O\320w\201\372\310f84O}\346\210\250\033\t-\331R\312\224R\nS\001A\001M\001\335j\272\355\272\311tK\3234\036\267j\246\270\255y\337\327\001\021\202\004\267\321lEuI\337\261\026\r\017\020\n\370\276R\006\304:\356;3}\306m\273\037\304w\rQ\314\356\210\337\373J\021\020{Er ]\307\017\350\352"
+	.ascii	"\231\233\216\271\235r\333+\322\353\325\306\314\302\r\345\036"
+	.ascii	"\303-w\264\347\334\226\362\233(/\351\333\254\232;\003\225\352"
+	.ascii	"\225\017\020{\215j&\266W\265\227\330^YHCY\3529\350\204\276\357"
+	.ascii	"\333\256\255\313\f\250\245lo\233\341\013\253\003|\3377\371kH"
+	.ascii	"$\022\211\225Z\2256\253\3576\023rI)\t\351\310\250\350\330\032"
+	.ascii	"\213\304!\273\252\357.\367\320*\t\335r\357\256\331\325"
+	.string	"LW\032y\305\315\227\254\264\222\312\300\217\215\241\326#\263\2422\215aa\266\\\025OR\377\013\020\255\365\310\332\324*\301\260<=m\342HT\312\330\372(\255\215\212\234}|r\207\346\355\0262'n\324#KS\243\350\332\300\026\2623/N{\001S\213\2242\266&\032\030\016\255\244\2241i\326\250\031\246F\311\201\371\252>\026BE\214\232_j\025\233\"\177b\315\245\253Z\220\364\367\230v7\203\323\275\273&\222\366\241\325\373\276\354\314fYsS3\367\0323\267`6\236\005\201\\+W\334\267\267:\314A\375\376\035\226H\351\205Z\332\217\313\205\370\276^T\334}\335\307\365\342\202q\343\342\330^\373{L+ D\030\027\375/\202}z\317\254\021(\355\312\261\334{z\317\225s\305\270s\356\034\333\353pz\bp\213\345\326k<[\334n\254\201\003\007\266W\25148'\364\257?\260\314\036\372\316\007;E7\206"
+	.string	"\377@\204h\3006\242\347\220\220\203\026\335+aB\001\212\216\243\002N\237E\3570W\260H\300\367\276\312f2\267h7.\232\330\336\367\245\342f\323m^p\273\365\312WX\336\314^\271\261\330^\213f\205\226{wJ\224^\310,]\372?\231\333\351mL\036\277\032\263U\225\205\n\255\363\204F\323L\325j\232%\034\235\223G\347\251\243sT\3335\027h2\315P-m&`t\036\320:\013h\235\003\030\235\237\214\316NDg"
+	.ascii	"\254sS\353\314\324:#\215\316K\253\263\322\352\234\324:#\265\316"
+	.ascii	"G\253\263\321\352\\\324:\037[\347\326\350l4:\027\213\316\304"
+	.ascii	"\325y\270:\263D\347u\350\254\016\235\237u\366\325\27154\200\342"
+	.ascii	"D[\343\363{\322w\254p\360\315[\333\2745\232Gq\212\274\372\007"
+	.ascii	"k\364\026\336\t\301\234O\375\203-z\243o\260-\307/\372/4\325\355"
+	.ascii	"\037\377\211\260\370\355\263L\354\314\204%\252\022\f\313s\354"
+	.ascii	"b\213\337w\355ljs\323>\016\374\033;\323\032\277\370\037\235\322"
+	.ascii	"\361rAB7+s\277V'M2\343{\032>Q\256B?\342v\261\273t#\356\327C\327"
+	.ascii	"\"b\337v\272\t\361\245\221\031]\",\361\265\246|\274\\0\314\207"
+	.ascii	"\270DD\250eqB\273\f\363\006\017s\305\212oc]\370\240\275\262\177"
+	.ascii	"9\230kd\314m\232\261\275\022\277\351z\001]\231\2755\321(\305"
+	.ascii	"\177\262\017\247~\355c\223\037\365b\314QS\276\234Q\344J&J/T\211"
+	.ascii	"\303\237J\342o\341\360\033o\370"
+	.string	"\311\367B\204\203\354ch;.\311\363c\377\311Y\354\372\035\206#x\324\313n\023\327\2117s\375\226\353F\303#\314\363\372\256\365\237<\354{\253\377>\227j\002/\306oX\002\337\321i\237\227\0136^\02572j\203&\360V\037d\016O5\344\312A\261\375u!\367I\232\033%J\235\273\265;\205\375W\177\255\003\346\\z!;pfw\315m\363f\376'\030;\224\267\374.\366g\346\016\3557\343\210\357}_\n\334\200:Lc\312\207VrF\016\032S:\260bd\335pq\245\225\274\222\361\364\302\205\303p\341X<l\274\350\261\326h\276\232\362\241\225\364\241\225\304Q\343\305\215\344\225\226\216\344\324\022g\345\300\322J\356\310\312\322J\266Re\277\032\247h\346)\177\311\003\236[\317\303l\355q\230\360\003\224\364Hx\001?\341\033\354\217\352\005\374\205:>\016\267\345\204|`\250\336\367\332\242J'\035\340%|"
+	.ascii	"=\037\340\273\217{\351\362\364\215\327j\034]a \323?\233\353\017"
+	.ascii	"\313\236\305\265p\375\341\n\304%\210\233K\020\333\353J\227\b"
+	.ascii	"\356\017\211\244\235\036\006!\307\342v\021\2578\275\324\232\037"
+	.ascii	"\247\230\350\322\361L\352U\274\362\300y\360\206:\033V\206\347"
+	.ascii	"\240\223\215\257\211\361\247\033\367\204s\3133h\367\271\032s"
+	.ascii	"\035\342\n\364f\362\261Ma\336\327w\021\277\340\242(\375S\260"
+	.ascii	"\001<\214~\001\020\365,\311\013\364K:\252\372\357#J5\024\022"
+	.ascii	"J}\337\367E\202\372\252\357i\253\203g\342\370\321?\271\315\250"
+	.ascii	"\024U\370\026cv\344h\341\0134\235p\347\f\246'\315\034T\340\233"
+	.ascii	"\336\351MX\"%\362\231~\370g\351\221\337\\\210\374\314\355b\241"
+	.ascii	"\366\327\204\311\322\267]\324\004F\225^h\344JZ\351+x\222Nz%\244"
+	.ascii	"Oj\320G\217\364O\177\214\037\200\341\250a4\003\025ddhF$IRIc\240"
+	.ascii	"\002\221\241\"v\0208\305\210F\222$\035_\366|Y\276\320\227\272"
+	.ascii	"=\205`\177\016/\021\037\277\323\206\255*r\215\211l\367\257\024"
+	.ascii	"\037b\236\0336\246\204\373\2438\354\020\312\b\225(\314\235/\001"
+	.ascii	"i\354I\240h\213^\247-\204\315\374\221\355\027\354\360\361\346"
+	.ascii	"`LT\027\221P\377\035\263\031T\266\323<q\224\370H\225\234&\226"
+	.ascii	"c\366O^\t*\1779\334\212\221`U\303\021\342\275\002}^\fk\"\344"
+	.ascii	"m\025-b\377Vv4\201Q(\237:N\243\231<$\247\261\352\002\320J\214"
+	.ascii	"\344\212\222S\032\325\037\346vI\225=.\331\373\362\207\\Z\353"
+	.ascii	"\246\370.#\233\373n5|\034\2143\007\"\343\313\034S\344\257\273"
+	.ascii	"\246\317\226@\341\213\275\272\264\2164\324\277\336\215\245\021"
+	.ascii	"\356\026]&\311\332\213\354z=x\340\300\3700&\237\025[\317\037"
+	.ascii	"rv7;\340\370o\204\n\244I\025H\021F!\372(<j\037S\027D\274;9\240"
+	.ascii	"z\023\324\277\244G\277\210\317+\235Z\201\372bt\025\366\016\257"
+	.ascii	"\311\267\275'\344\200\303o\204\310\016*\226C\232\370\023\252"
+	.ascii	"\304\0054-\317VJ\031\036\244K'\001\025\237&\266\352\242<gL\f"
+	.ascii	"p\260&\306\252!\367%\265\256{\0263\201{wb\253\242\307b!7\232"
+	.ascii	"F\324@x]\354\343\251\353\004\232\300O2?\254V\211r\261\322\017"
+	.ascii	"\343\233V\034ps\006`\177\216\300\2276\217^\203\203 \342\324\330"
+	.ascii	"\\\f\3540\023\344\004O\265\356\360\254mQ\\\334\332cv\216\301"
+	.ascii	"\341\344\306QD+\013\212|;\303_\333a\024\234c\256\232$\242\273"
+	.ascii	"\026\244\364\353Q*"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.100.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2@o\222\016\230\016\013?\254\033\211\032\321\\\213\375s\310\037\237\217/\211\370\333\304\036\020\032!\201\210\235\251\r\003\302\207\031\nn\264\372\316y\235f\367\226)k2\033\2666lA80<,\r\223X\231\201\247\210\006\266&\246\211-L\225E\321a\301\007+\276#%i\367c\n\316\225\252t9"
+	.string	"\225\016\0052>7\372\312s\270\361\275$\212\376\373\220@Ce\001%\0234j\311\024\311\004\344\357<f\204\204\316\255U\007\250\036\224E\tKf\265\220\243\255\327nEz\t9Y\241B\236^\200Bf~T\b\243c\377\203\337\340\277\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.101.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2PO\222\016 ;\323B\251.N\337\325i\003"
+	.string	"@[\274\267\262\250.f\355\326\232\263:35\2008\332\314,\321D\237\025\372,@\341\313Pk{\313\024g0\232\3064\215A80<\260L\223`\230\201\247\210\206\306&\246\251\261\313\225E\320a\201\007+\276#%\241\256\307\024\233kU\351n"
+	.string	"*\035\ndx.\364W\347P\343\033%\202\376\373\220"
+	.string	"de\301$\323\n\265\244\212\204\362\361s\3762B\002g\252\027\207\325\016\313\242\204%\363b\270Q\252G\335\2124\nI9\251>\235^\200Bf~\325\007\243c\377\203\337\340\277\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxPwmPpmSignal.102.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003h\256p\305\024\310"
+	.string	"\257\242\356\245\363\024\r\212GD\f\216m8\264Ad\304\244\b\034{\273A\233\302\205f\367\226)_V6e6%\304\261x\310kJ\244E\030\2130\246\234`\330\224\325\267\032=\003%V\376\333`\324\274\0026z\017\013\"\222\302\264{I\241v\024\bu~\255\326\276\244\037g\025\224\261|N\273+\343F5\205\332\252\036\035p\335\246P\220\330\335!\327a\364\250?\342?\374\215\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resumeRxPwmPpmSignal.103.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*pm\032\003\240{\375\f\340\021\f^\277v$Urt-\231nN6\236\230\2111u\241\312N/\032\243\361<6p\204\366\226)[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\324\267\032;\003%V\376\323`\324\274\0026v\017\013\230\221\342\263{9\231V\024\by\277RgO\322\217\263\n\362,\236\322\356\312\270\321La\266jG\007\033\247)\024$vw\270q\031=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.104.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\214\t\2650"
+	.string	":R\030\022G`\\N:\377k\245\220E+\n=8\374VE\323eD\3622\321\250<=cp\036qB\263\321}\371\232*\353k\226M\276\026q\026t\036e*{\221"
+	.string	"\f\3304\233\340\177\355]\345\226X[\263D\032!d\357$\003\016\001\371"
+	.string	"\017\001\255\342O\372*\315\317\271\246\242[x5\355n\321wka\337\311\322\210\t\315_\t\276\254YS\272\332\016X\f]\241\206J\316y\251\021\260W\373\336\356\257\235\255\305\333Xt\233\363\2165*9C\227\032\211\275j\364\236\365jz\343z\265\273;\201\202\026\275<\264\354\353fq\\P\374r\206\036\261\217/\037\004\364\343\323#\300\030\200g\007@\2218\024\006[\026\270\252)\276\313>\260\201*\266\247\245+\214\371\240c\251\035H\355\007M\311\365\021\362\236T\310\371e\306\363\300\204\244\003\360x\354\005\271\002\316n<3\273\001\202\234\007\210\333\217\273Sv"
+	.ascii	"eq9n\221\210\203nx\235\027\216=(V7v\333<\260\033E\300l\\\366"
+	.ascii	"h\207\214\346\201\251\321\306\034\231\347\2015\323\003d\214\210"
+	.ascii	"]\216\353\2564\256n\275\270\2510l\253\030\246u\261\334\217\362"
+	.ascii	"\300\234\251Q\316\371q\277^aY\367\002\033\344\234\373v\205\311"
+	.ascii	"x\013\275\373v\335\315\354f\227\002'Z}n\240\365\271\235\321\272"
+	.ascii	"q\372\247Z\205\260\017\356\313\325\314\272\177m\274\227\273\027"
+	.ascii	"\344\337\364r\306zW\027,\204?\246C\0133\273\233\303\267x`s\316"
+	.ascii	"\013\372Y\256\005D\377\354j?!\357\273\220\353\325\343=\264='"
+	.ascii	"[\033\326\375\353\206f=\315\370\331\3754\343\036\335\303\333"
+	.ascii	"G\341m\246\366\366\022\361\266\022\361\266\201\276\235\324\336"
+	.ascii	". \274\215\364*\357\243\267\375E\303\333D\303\333C\227\362\026"
+	.ascii	"\032\336\376\031\336\366\021\336.\022\373\366\260o\013\333\333"
+	.ascii	"\301;y\267\355m\266\275\r\f\336^\333\333j{;\355\333\230\275\375"
+	.ascii	"\004\013\316\2347\314\344p\031h\376\372\233\223\357T;\264W\371"
+	.ascii	"\245\374N\216\273\177\305J\267dpJr\316s}\273*(X&\030k\027#\306"
+	.ascii	"\232\016l\335:\245\231s\216r:\253\317u\321\2219\227\353\376\223"
+	.ascii	"~\234\024\252\017b\266\\`\255\372P\376\326-\f\247\373g\374\030"
+	.ascii	"\342\247\220\300Uz\277n\231\266Lr\337\325)f\006\361\263\325/"
+	.ascii	"\325V\0038\304\345|\316Rm\311\222m\311\266^5\200_w\236)G\234"
+	.ascii	"8Z\242[v\004M\220\210=\302~\3007pp\232H\270\357\346oV,\2318p"
+	.ascii	"\260^\275\335\223\266\340\262\312\304\361\025\300H\030\310\r"
+	.ascii	"W\035 >\302\005\360\257<M\033\263e\t\327\333\020\276\367\261"
+	.ascii	"x\020!\302z\025\210[28\265\346\320\275\225\257A\276\256L\315"
+	.ascii	"\212\217\360\355~4\261\261;#6\346\364\200\370\331\027?\372\253"
+	.ascii	"\376\313\365l\230\324I\037}\213\275(\254+\376\216\356\tGC\341"
+	.ascii	"\314\212\333\2557\2656\254U\305z\026*4\245c\212p\212U\374-g\326"
+	.ascii	"\307\234\214\005\fMM\230\370\366\004N\263\2419g\025?\207\360"
+	.ascii	"\0033Z7\316\237s\316\351r5\362\375\341\365E\331!\214\373w\307"
+	.ascii	"[\366\317z\203\223\023\224.\276\203\371\017\306\370r\227\320"
+	.ascii	"\024\243\206\353\312\375\2719g&\016]\202)\031\005Uu\224\232\212"
+	.ascii	"\212\232B\006Qm\240\262\252z\252jJF=)G\bE$S@%\221\311\f&\236"
+	.ascii	"\244H@Q\025\237\252L$!\354PmHFAi\250\222J*\225VHb#\231\256\224"
+	.ascii	"\307+\345Q\n\352)\352\210TR\035\231\214=u\"\251<VMM)\217B(\326"
+	.ascii	"q\217\276?J\277@\007^\304^\335\235\204\215\260pV\027q\022\376"
+	.ascii	"\032\204\237\375c \334c\210\037\314\030\342\366\376\b\361E\342"
+	.ascii	"vF\206\020\017!)\363I\003f\326\222\211\361k\203k\274\370\"\322"
+	.ascii	"\203\237\275be\362A\203\326\244/\032f\t3\005q\021^\302\177\273"
+	.string	"1X\004\211\020\304Wi~\002\242^`\374\332\030\2130\213]\270\201\321\272q.\f\0263H\323s\2625\003p\2419\221}\361\343\301\317\346q\023\302\354\213\356\340g\232\367\357\356\213%\021\247\307\375rI\033\342\\k\203\005 \025\266\370n\227`6\205\253\356>z\"\366:\342\307\235'\n\004\257/\232\036\213\300\2777\226\265OG\244s\245\233\225p\200\316\250q@F\021RB\"\"A\232\202$\215\001\260\002\021!\253n\0210\255e\352F\223dX\003\335\013Z\274~?\031m\363\340\272\016#B\211w\222\001\366\223d\235\375C\313,\375\317\001\322\030z\326\367\314\302l\263^\242Pe\240\224\301\370\t=L\347\367\027\231W\266\332\356\031{\036>\347\020\245\246^\273\027)hX\327\242\314\235\202|\307S<\266\273d\366\3028\030\313*>/\315\364[\027\013\036\367\001\323I\353c_\3224\361%1\274\204R"
+	.string	"\276\207/\rg0\313\034d\321\267\\J;\243>\342\203\220\344\374\377\375\201W\033\003\343-\220\200\245i\264\345o\232'\202\242L\206\211\203\347\0014\177\257ij\335K\216\347\035\326*j\237\357,\346#_\266{{KX\226\007Zg\032\355\371a \335\367\003\250\367\265< a\256\366\344\203\224L\224W\316\200\327\362\213\005\370\"\r\367\351\007&\3521\022|\371EXU\363\353)\007\266\375\335"
+	.ascii	":3o\213o\320\352\013\327-\377\334\223A\337\372\213\3539N\354"
+	.ascii	"+\207(\221\275\350\006\234_\365\334J@\210JbK(\177U\301\241\256"
+	.ascii	"\340\314\331\250J\337\214\264\032c\341\241\275\3128\275,Z\247"
+	.ascii	"\334\202\264*\351\275\262\365\344\243\251X\242\330\020\373\017"
+	.ascii	"\352\333\363h\033$\263\031\225)a\266\324-\032\336\2003\f{\221"
+	.ascii	",\2002\267$@\236\006\254>\330\234\242\251\331\216\2557\223.\372"
+	.ascii	"uW\003"
+	.text
+	.section	.gnu.lto_getRxfailValue.105.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\216\003\235\027"
+	.string	"\206\252\223G\260XQ:\361\327\231s\274\2041\327\004\275\361\007\3252\362\312\247\237\376\206\226P\272\t4\201\372\352q\237\331~U\037WI\007)\335\177\201\367\262\362\017\345;/<Q\\\342\036\356\351\300\332u\250\357\266O\b\267\2252\245|"
+	.string	"x"
+	.string	"\203"
+	.ascii	"?"
+	.string	"i\264\263\207\373\314R\"Z\272\315c\253l\257\332\007\020\360\2747\363\316\251C:2\247\317\200\t\214\227\266}\034\347\361\230\246\276\027#R\273\0208\242\2459}-\230\313\204\227\372\230\360r]\234\366Q\f\345i\225\346\327>\252v8D\234\"\033\341m(.\257\343\016\212R\\YQ\002\305O z\026w\013e\204\216`\244H\370\254\2127sNk\216D\211\033u\333&l+\260w\027\232\233s\372&\215JE\2176\331~\235\b\306\200GC\307\233\263'\301w\330\037\356\303\002j\007\364\302\to\316i\303\343=r\374\030\227\306\240A\237\273\364c\213r\361\203\251\247\332\357u\\rY\212\202k\262i\320\366\335t[\330\337`0\230\305\313\302\266\232e\365\213\325\253\367~\225\325\251P\215\n\325\243T\213\242:\f\325+\325\272\352\303\314l\221\262\303dN\240 \227\031\341J\245'CF?~*@~\202\302"
+	.ascii	"jC\210\240\317\355\356\326\374$\007\2204\364\223\022\336d\302"
+	.ascii	"\35039\022\205\n.}\316\025^\276\024P2\362\242\373\246\246]l\256"
+	.string	"P\trR\342\037\355gAG\216\344F\006\356\211\"6f\263\360\362\327\251\366\244M~\220\317\004\375j\332\345BGBJ\266\210oDo\310\230*\204\370C\f\034? \274\264\346&\320\217\2149'\315\201\330\006\212K\220\346\254]\007\f\276\220\001\246\243\343\272\360\022\375\252\331\221\265vd-\235\034\227\206\326K\306\241U\023\343\330\006\230\254\325!\026\223\265T>\333OsY\370CZ~BV\r-=q\265>\311E1a\351\235^6\265\"l\247\3267\266\275\235\346\234s\224\300\323B\324\256\366>:\001\247\205\343\242\366>3n\032\264\270\343\252\225\005\237\002\313\311QE\312O\334\325\t(L=\"\327\244,b\270\254=\256\311I8\243\377\344P\0328x\360 \274\fE\250A0\342\224d\212\220\320\004I*\245\031\003\200\002\021\"\263\033\021P=\203l&,\2644\006x=X\253\357\323#M=E\357\220"
+	.string	"VJL\323c/xl\021\013\033\341\344\205B\215\330\327\273\334\331\236)\214v\006\273\017\022\213n\342L\363.rq&/\220\237\217s\003\333\311J8\320R\301\320\213"
+	.ascii	"\022}\274\024\307R\230Kv\253\351\264\\\362\265\237Fp\001(\016"
+	.ascii	"Y\220\234\200o\"?\200d\302\246\316\310XFF+K\306\332\b\365\253"
+	.ascii	"65\0322\355\235L6!I\254\361\356\203\271\320\341\230\n"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.106.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\273\001\275\020"
+	.string	"\206\240qF\360\356&\035\013<\260~\273!\232t\337\\\272Mn3\177F\323\224\213kE\374\303\325\031`M\333\355\346\3063\330Q\200\353\237\200e8\354H\034\026\227QB\202\344s\032\224\275\341\023\223\003\323F\242Y\262\211\224)\005^"
+	.string	"T"
+	.string	"]"
+	.string	"\254\207&r\306\356\205\024B\273\033\342\002\246\307\217\315\266\277s\017,\2672\304 \001\200\016\217\214\217\321n\350q\\"
+	.string	"\367\230\357\340\0365\347\255o\232-\037\346\233\202\030\"f`\024\256\233\307\215\205#\024\314\265}\214(\222\271\317\223\006\366\312,\215\354\256s\0066\341\216\267\275\3006\003;?\0027F9\255\221\351\323\303\273{\317\237\361\360/9\0353\275\305\264f:c\372\033\036\034J<\230\355F\250\301\330\2428\244c\373\376\354@-\377\261\322hF\273\333\265\330\335Yvg[?\\\306z\317\313"
+	.string	"\216}\311v\204v\303\020\0370=:4e\332\217\235'.~V\270\262\346Sn\b\225L\334D\\\352\246%\265O\034\344g:\335\266Fa\254\272}\017\241j C\354\232z\0262I\006\017b\305\264\373J\340\007\241\254L\273\373\r\217\376\013\367x\325\310\241u\210\305d\355H65 U\034#xIkb\032d'^\211d\207\256T\034\373\333j6\021Y\231\260\244>/\005\374>\220\204@I\203\224\224*\226\240\250|\251\025g\022\021\027\225\347\242\362RNR\237G\242Zy\"\035\006UJT\036\013\b\252\274.\214\271\336x\345E\205\f\233\243X\372-.*\215\355\250\036\211Q\327vR\r\275\317Af(d\264YRT\201\322\223:!\264\b\020\324)J\017t\220!\0224\001\037"
+	.ascii	"&j\345a\205\006\306\006ut\335\366\232Z\253>,\256\271|\347b=\267"
+	.ascii	"\231\262\034\210\007T\251_\202\237\251{E5\307W\373\254\225\\"
+	.ascii	"\310W\326\246\310\0303A\215\242a\217i,\006\f\203&l\n\035\264"
+	.ascii	"\013H\t(U\r4\227\202\002"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.107.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\312\003m\033"
+	.string	"F\363\260H\240\330M:\223g\363~\257\021uq\277p~\340\t\217\037\326_\231&\026\r"
+	.string	"y`,\333\240\334o\b\350\270\315\275\017\360\366\240\370=s<\236\215\257\340\340{^\374a\326\372a\332\332Z\232\376\376o\303\022B\366\226;\245\233"
+	.string	"\221"
+	.string	"\243"
+	.ascii	"N\242\016\220\270D$\312\252\326\272\340\324\007\304\323\230\313"
+	.ascii	"\300\323\371\030xj\347\330\257\323\277l\263\245\274GT\303\335"
+	.ascii	"\222\036\037V\255u\2667,\006\370\354\335.i{\213K\fA:W\332\374"
+	.ascii	"\242\037\370U\2159\235\267\314\220\347'\307\251\200bL\231,\253"
+	.ascii	"\246#\341\244+\224`#\b\306E\0033\202\206\036N\005VF\256\234\n"
+	.ascii	"hh\312~r\214=\022\024:m\311\t}\276\344xf\214\322\245OnG\356\221"
+	.ascii	"NwQTf\004\301\270\f%\324Z-\307\\\320\375\272\355$\333\025\354"
+	.ascii	"\325\021>\216S\227\250\221\037O\375\032\360\364e]M7\371{\023"
+	.ascii	"(=\230\346\352\034\336N`\270;\036\215$\250\035\231\265KO<\271"
+	.ascii	"]\235\335\303I\031\242,+o\r[\026\023\245a`\241\364K(\355\022"
+	.ascii	"J\273\356\273\305\367\356pJ\203\2404\245\322sJ\357\224\226+}"
+	.ascii	"\001\005\260\246r\246\324\372\363\313R\231\320\246\335}\177\357"
+	.ascii	"\322\276ot\246\234/\231V]\275z\370JI\367a\273o\205X\213\210#"
+	.ascii	"\021(V\265\366\024\210\2470y\036>\322\217\316\263\275\347\030"
+	.ascii	"2\310\2171\330\356^\351\b\252\256\222\252\226\316t%\032V\352"
+	.ascii	"\343\231\222l\230>\210j\2552OG\302\241\203\007\017\340)\314\236"
+	.ascii	"\351\363j*\213\220\027"
+	.string	"?\204\204vW\\\204\253\263\244.{#\255\026\363e]\353\323\340\341\022\340\025\305\244\334/\335\211\006\301I\255\267\217G\026\2661<\253c\327\312]\250\236-\177x\023\b\261\326\372\300/r#!fh\362#\r<\375\276nX\301rt\223\277\t\256n]Vj\365l\335\344O\322\325\031\347CN\334\347\244\326\035\031\233\346BDD \252u\347\001\220\007!\021\036Ac\002\247f\006\005h\202\306\306ff\004-4\315\201\212\332LEmfCb\246fF\253\241\2309\210\371\006\207\2466KqsS\233\275z\267o\215\242\213RX\230\334\026\327\262:\003\370!\312v\237\310\005\017\327\307\340R\210\242\013\356?u*[\221\217\3036#\033O~\264\361\300S\232@\307\224\035C7\371\273{\270\317Zku\255\316\337\241\265\025\306\366JwE\321:\002a+2x\270\262=\322)\226\326\025\013\0318\371\363\\KM"
+	.string	"\340C=\212\202\205\013\027\306*\342\316\305\371=\211\003$\314\356\332\001H\2501 \245\2244\312(\201\210\210\324LI\322\001P\0021\212\331y\020`\251\030hg\f7\372\021\334C\337c\322KO\260\351\246T\257\003\246t\317\007L\217\375\rH0\260?F$\035\234\302^/#(\246\260\267\2206L\230\262\201\330\0034+\240O\373\312\277\036e\346\276\226\022n\004\031\260\355y\232\373\017T\260c\036\307\0350i/\221\216\227\355\253\b\341\272\264\212\216L\212\354\220\026\304\320\231\f\344t\316\215\357m\t' "
+	.string	"P\237Z\027\fs\030P\325t\024\237~\032Y~\026"
+	.ascii	"\005c\337t\206\017M9P\001"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.108.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\024\013\315:"
+	.string	"\232b\360\025@P\346\316\030\223\006*\355\247\027\241z6\354\217F\020\214c\355\262\007!\333-\333\0257\366\363\221\330\256a\345\313\317\004D\323\323DDD\032\3066\022\bF\234\355\366\376\216(.m\"\245\224)\245\024P\0012\001Y\001-\345\236\316q\032\002^\322\267\331N\301\244p\021\206\2752\373`6\366\372-\307\306\206\353\250\333q?\372\035{\033\354J\233\020\301\367\225F\365\312\006\206\275\022\350$\333\253\332H\266W\227YOK\321\336\226\255\320\027\335\340\373\276\312\237\002\200\221Z\2256'\337\355'\001\001"
+	.string	"851-)%\223\220HGFEG\242!c\2218l\331U}w\271[*\325,,\020\263\311\325Oq- .\352\001\340\362\2728"
+	.string	")c^\332\251\245\312\353\003awpoec^\272\2115#\362\007\327Lj\003A3\200\032\213\330\233\2324b\205\331|b\\|\351\215\315\225\324\026\210\021+\315'fE\255 HP\257\247L<)e\254J'!\323\032\251\273\326\372(M\315\215\212f\314;*]\324R\225\215\255\365Q\205\342\023CS\235\356\2408\021\026\261\247\017\3419q#\237\330\023\225\300]\023/\266T\323^\315\300\244p\204ecU\232X\240l\214\254\207\315'FV"
+	.ascii	"\213\230\323\333%\315\252\r\236o\220\034\233_jr\216\031\236 "
+	.ascii	"\276&i\325\330\364\002\342\177lz\251\004\336\367m\271\366!\315"
+	.ascii	"\245{K\365\276/;\2639\326<\240\231\375\0043\257`&\262\b\377\324"
+	.ascii	"'\304\357\253\020\362\b\220A\366\241\354jTS\250kZy\007\335\364"
+	.ascii	"C\032\364\nV\375\030S@6\335f\005\213\026-^\205\263\356\215]\037"
+	.ascii	"\252\252\177\206\246]\215\013\377\251\264\016\200$\312\345\037"
+	.ascii	"\312[l\377K\231\006z\271 \346\326\3533[\334T\370E\2257\263\212"
+	.ascii	"\355\265\237\310\005\006\355\031uvy!\0239\263\f\032\336L\250"
+	.ascii	"O\020\244\371\022\n.\237\213Y\272\364\2072w\0054A\202\374g\314"
+	.ascii	"D\347\fCg\fE\347\013\026\246\212\316\024\244$\020\235\025\020"
+	.ascii	"\235\023t\\3\024\321\271\251\31143\265]\363R\3175+\265\316I\326"
+	.ascii	"9\211\350\214d\235\221Z\347\243\242\263\321\352\\\264:\037\211"
+	.ascii	"\316D\254\363P\353l\034:\027\207\316\304\326y\330:\267\2533\333"
+	.ascii	":\257\254\263\272:\373\352\334\032\272n\360\351\204\255\360\375"
+	.ascii	"\244\257\221\302A\357\336\252\307\326d\272\355\272\347\272\343"
+	.ascii	"Ze\356<6\026\247awc\032OG\207\341F\343\304\033\324\301\375\245"
+	.ascii	"\3050\033\331G\207\341\265I\027\345\t\007\206\373\216\256\353"
+	.ascii	"\334\266\343\321/\363m.\2646\262\n\303^\215"
+	.string	"\274\221l~\306\244\t\034\362\241\204Z\213S\315\240\237?yi\334\220\036z\244\364\353\027\272,S8\f\\\3013\273ln\2337s\nY\206o\315\236\327s\261\322+x\366;P\324\002\215\026\020Qs\362|\277\254\333\f\016\020M\021\361\005\271n\b\320\b\3274L>N\245]7\026\352\211\3774\005\013\024\344\271\364B>\272Y\330\f\216FD\215\253O\337\033\f\237\341\333?\305\207z\f\337bZ\315\322\264c$P\335\225\345\037\327m\330\247\375\270[\3347\327\213\353\205\355\265\b\325\244\213\242\026y\203D\216\350\241|\341\245\376J\311\235)\234h\357\021\274\360\306\256<\204q\274\347\317\234\263\241\2072\205\227\372\3272\225\323x\354\312\265\236\r\303\367\365\232\342\306\323y8t\360\340\201\355\225\3027^{\236\222\277g4\256\373\356\314\335\031\243\272\351]\020\2212\247O_\340\360\245\336\323\224\350@\022\303\277\006\374"
+	.ascii	"\"D\b\266\327\341\367]3\340\002C\347\031\325{\2735@\232\305\207"
+	.ascii	"\366\026[gD\016\247\335\240\237./$\266\017\272\217\217\375\366"
+	.ascii	"\373\253P\227\027\356\261\237\001\3209|(\267\233V\377\233`\266"
+	.ascii	"L\001[v\320qHL\375\275\357[\201\373M\3031\301M\245WF\221\"\005"
+	.ascii	"\223O\377\032<\003\302\215\0324pl)\261\262\256\256\262\252\234"
+	.ascii	"\254j\330\270zq\203\255a\205\205\365bFU{#\204\325\025\215\023"
+	.ascii	"8\260\254\264\264\266\252\210\270\n\302\016-\345\016-%\026\215"
+	.ascii	"\027W\312*\255\033J\bH\316\262a\245\245\304\221\225\245\2454"
+	.ascii	"J\273\372\317x\330\027\335\353\372\345S\362\235\276\244\205\003"
+	.ascii	"\301\223\220\030\"I~\327\245\351\tH\362\261\244g\343\324C\030"
+	.ascii	"\340\241,\201\351$\341W\265\246\250fbz$\322#\305\220^\301\257"
+	.ascii	"\315\331\265\001\300\364\022\036\3062,\357H\204\027\361\260\317"
+	.ascii	"\303\344c\364G\f<\201\321w^#\007\373\334\230>\301\017\222c~9"
+	.ascii	"\221\r\3255y\t\005\333N\203\355p\372\r\372Q.\243zM\023\234\331"
+	.ascii	"}\342B\361fr\337\3655"
+	.string	"\331#B\243O\246\242\357B\323@\245\023\3335c\231]\250;\305\233Y\364\275$\212\327s-=\364\3700\334\353\370-\327\007\232uW\236Q\245\207r\221\230$\013\377\201\304\250V\372!JO\364\034\342\f=\321\267w\255p\323Z\f=\024\240S}\337\367M>T\351-\374\240s\314\322\257\316\223\036\312\375\327\266\366\225w4\365\215\326F\366\225w\224\372\245\037\302l|\177I$\377\n?\254\205Xz\343\367p\322Y\372\331\025\n\200\351\250q$%\235S\204FDD4IRh\f\200\002\021)\262\342\006\021`\251T\020\221(\031\306NM*/\333\257\215d\026B\346mt\365\004\316\"M\254\2142\th\351\216\375\257&\236\311\343u\275p\327@\212k\363\253cr\002\211+\202\024\372;\033\307p\332\f\331\316hP4\327\022\251X\212\302S\303\335\207P\035\360\222[]!\2073y\255\374*l/j\2637"
+	.ascii	"\234\202\317:\301l\026a\0260\301\273xl\206\340"
+	.string	"Y\376F\006\276E\243O\202\210S\306a\034\240\310\374\313\344\213!+)*\353\030%\233\322\326\370aM\033\356Flh\375v\177\216\326\3207\211\350\340\360\004rFo_(\327\003\374f>\f\341\016vtG\017\001\024\234{\226\270\236\204;6\344J\023\244\311\0052G\032\001\026(\221\377CDK\3204\\@\200\312K\374\341t\027\320\335N\251\3003\223X\330HL\256\224\",\273\300\323\3234\201f\274V \t\301\262\354\374\306\276\244\311\027K\222@\226\356\3603,\201a\222\375\017\264\230\274\345\237l|y\331\312\230\033\336]\336\306\0172)O*\264\256\301W\036\206\201\245\363J\233h!=hF\260\266q\001Q\323\362\357A\032\241\370\177ql\267\t\033\335\241\222O;+\250\377\030a\034\266\022\037v\034\3315Ls\304P\r0\206Kr\217F\200\251\214j\265\236\257\350(\277\271\240\335+\022$\020\350\317"
+	.ascii	"\264\214Nt\313\027\300\215fX\234\316\320\201N~\363\311\312\266"
+	.ascii	"\263\364Zz\240>@/\nht\214\335\267\b\203\221$\244\202\225\036"
+	.ascii	"\214\3536q\344\030\004t\376W[_\202\030\306/o0p\242\022\343S\337"
+	.ascii	"\224-\007\334\225\017\243\213kl\007\376\003"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.109.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\233\001M\017"
+	.string	"v]fE\360\260(\035\340GG\345#\301>.\231L\031w\026<\023g\315\tbn\303\250\262\273\350J\004m\343\363\3357\345\324\347\rq\326\311<3C\363\3033\360\232L\312\330dD\370pN\300c\250\277\325{o)S\nS"
+	.string	"M"
+	.string	"P"
+	.string	"\361\360\375#\036\332\366\310\201\223Q\357d\\\002`.Xll\354v\232n8\352\021>M\224\017\200K=z,\034\276\002/+\\@\334\204\007\202\223!F\213\243\220\317\345\032\342V/dw_\363l\341V2;Hv\327\311\342*\334\035\267=\262\255\331\317\021\334L\346\205\346\245\312\035\273K\245\306\330\177\273\273V\r\366c\177\310\351\217\323\321i\350\364sZ5}\217\006\035\\-\356\255\233]\327\216\316\266\200*8\330>\331 \333\231\366?\234\346\364\230\004\177v1\300@\261\333\031\360"
+	.ascii	"\317a\310A\0024T\237\336\004\313\005P\276;\t\223gWu\326\210T"
+	.ascii	"\325\303`V\232\262\375\3403\222gw\021\3706\027Q\362g\016\035"
+	.ascii	"\301d\212\207\251g\361\312\271\021\313\335M\251Q\361\312@\366"
+	.ascii	"b\2258\354\203x\b\224?c\224\224<\353\320O\211\207\327\327\234"
+	.ascii	"@&\005#RI\202\023\223\321\266\241\210\002X$\242\262i*\233fR\262"
+	.ascii	"\200\244\2116\223&\362\341\022\204\321\246\235\224J\233\006\352"
+	.ascii	"\366\017B\217\016l\306\354\346]\366\217\266\330\376\250IT\272"
+	.ascii	"\022=2\244\266h\224gA}\232J\221\203\003\0035F\366x\302A\324\221"
+	.ascii	"W\r\017\357i\211'\203\025  \260\002\241\200\254\007\340\2007"
+	.ascii	"lM\302\0052\210V\340l\31396\217yF0\016/\203\016P\213\024\025"
+	.ascii	"\004\t\230\210\234\217q$\355m1\266tB\220i\004\221B\224A\003\224"
+	.ascii	"\327\2242\3604C\304\347\253\027\315R\320%kl\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.110.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\303\002\355\025"
+	.string	"\346(\217J\300\020)\035\343H\237]\246\354\247\\\220w,\326\263s\027A\355\343X\364\342\001U\211\224V\253\034B\200\005ZV\265\262\342\211\b\016\327\021\257#&"
+	.string	"\223 H\220:\272\004\006?\263A\006\202\303\005V\332\215\335H\333\233\310\235d{"
+	.string	"s"
+	.string	"~"
+	.ascii	"\rd\260\b\306\323\005\236@=\035\017RO\267\266\033u`\257\013\370"
+	.ascii	"rh\200xt\267\213A\354j\326>\256*\025y\326\366>\027uv;t\245\314"
+	.ascii	"Gq\205\263\031q&\r\036D\223))\244\377\334\346\n@\211\233\327"
+	.ascii	"\016\247\"\335M\226\270)\212 8DM\2552'\2164\371v\027~\326\224"
+	.ascii	"3\223\377s\252\263\023\352\312\233\317\025\204\356\336\251+7"
+	.ascii	"|Y\337\335\234\335u\260;m\004I\270\222\231\267\013\224\231&\275"
+	.ascii	"\251\250\345\235\335\326\201\377\307\203\276\344\177?\353\301"
+	.ascii	"o\255s)\235+\212sY\234;y\356\003|\340 *\2173\354\266\031R\365"
+	.ascii	"\022E\"\361\240?\270{\240\275p\311\240\036_\210\006\343W\354"
+	.ascii	"\177\226<\335\335`\214\200f\352\227'|=\251n\340\202\323-\031"
+	.ascii	"OO\356\356\004\302@)\370\334}\212\253\250\375\027\363\001\335"
+	.ascii	";CG\035N<0\365\364\272\034\223E\256J4U\266\303\210\215/\230\271"
+	.ascii	"\007\213+O6PcG#g\3426\207\373\017?\024=\224yBw\021\0331\372Q"
+	.ascii	"\210\323B\325S\2221\004g\314\314\251\317\037\225\216\033\"\363"
+	.ascii	"\3661\225d\366)\022\021|\232\231S\3731\317\027:Q,A\257;w\335"
+	.ascii	"~\350,`\342yN\267B\254^\027\2532\013\363:\222Ep,\263\224\317"
+	.ascii	"\027>\202\316\316\210\246\3126\207,\f.\177\235\002l\205EvB\233"
+	.ascii	"\215/\027ZX`t_$\264\231\2136s\261\300Rb\256\327\314\305E\002"
+	.ascii	"\262\262\026\225\231\353E&\233\271H`\237w|\376\fMJK6\276I\215"
+	.ascii	"\314[\326Sm1}\2325(\225\362\311\276\305\fe\244,\026\325\354l"
+	.ascii	"sx\261\273{U\362\312-\376\317%\004w\302\\\317m\016'\207*\362"
+	.ascii	"\356\322.c\302\201^w\233\354\246<\3515v\367\203\323}\214\025"
+	.ascii	"\225\2206 p\002\231\"4\017\341\300\357;\332\006\202:ze\002\013"
+	.ascii	"w\236\312\016\232w\367*K\212\260\003\265I\377\221)1\321\205\231"
+	.ascii	":\354\360X\252\270\3239h\263\3048\353 p\244CC\306v\241\301\013"
+	.ascii	"\026g\212\035\306\0035\234\330btY\016(\tw\233>\340\\\346p!3b"
+	.ascii	"\362\200B\330\205\3042\r\213\373X\255+37\300(\335\275q\327S\f"
+	.ascii	"&\\\360}\b\227/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.111.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\035\013"
+	.string	"&ULA \307*\035pN\260\330\305\023\234:\001h;\200T\240(\001\213e\240\240J\177H:\n\201\013\035"
+	.string	"\255akXH\023$z\214\347"
+	.string	"\230\bp\303\200\020\034\324\277\221\n\\\022\021\033Bd\357\275S\n8"
+	.string	";"
+	.string	"6"
+	.string	"\033\356\325\241\235\340\343\3116\250\254p\324\026\354n7M\036\236N\031\372\b\"\352\024\344SATQ\316\356\236v\331!\256\244\304xv\327\222%~\334\365\266)lG\330\237\b\322\307$(@ ^$\300\256\307\255\301\026\250\002Rl_c{\216o\t?3\371`\267\344\300C\346\225C\245\264\317\362Xx\331\311u\227$f\333\035!\354\220y]8\003\367*\037\213\232\363e:?/h\006V\222\201\375\332]L>\212A\222<\353\325'q\257\237\247\235\332Z\003`!)y\263G\224\234/\373tw\327\323e_\366\327\317~J\003\240\317G\362@.\004\202\025\033 \021\306\237N\351\353J_'\nY`t\237\017\354:\033{\031\240\257\323\360\274\257\323\214{\272\323e{RSE\353\364_\016\340\344\215F\334\253D\213"
+	.string	"lD\356\006\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.112.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\r\013"
+	.string	"\366\025L= O\234\016\0036\300\004\321\f@\216\032\024\205->P\300\317U|\205\037\240\022He\f\350\32545\032\2506\2112\240\200\003\200)1\020\314`uE\225\206\217\343\342\007\352H\366\2262\2459"
+	.string	"="
+	.string	"6"
+	.string	"y\b\365h\316>qO\303\006\330"
+	.string	"\242SB\261\273\226f8w\250\311\371\030]\346\260\232p\325\35060\262\273\377\236\020:N\346\305\265\273NO'\341\216\267m\300v\001\373W\244\037\302\364\253\214\025\241\356\026J\354F8\261\330\0211\204\310\366\037\266\325\273\007\356$\214\035\273\030D\f\250\036#0\323>\207w\340>z\340\270{Ad\332\365\bX@\365\270q"
+	.string	"\324c\352\354\264HU\220\241^\021|&8\251\302~\351\0370~\310\332\226\367<\372\033\365x\375wh\252@\"\005\005M\236l/\223\n\262\017ww\255\037;\323\324G\177|\025J\266a\032U\331\022L\016X4-s\230\"\271d\326%\263\026X&\n,J\246Y\022\2101\006\225\314r\200a\231\365\360\366\360\372\261/\215n t$\2456\326 \357\361\277_\034\3158*\025\023"
+	.ascii	"2A\022\f}\340 p\007\214!U\313\360\242\b;\n\267 \2720\f\303h "
+	.ascii	"|0\n.\003S\243\305]n\252\275\2410om)\003"
+	.text
+	.section	.gnu.lto_setRssiMsp.113.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\016\001E\f"
+	.string	"\366\325PA\020q\224\016\030\303\312\330=\244\025\021\225\202\226\333\247\270MP5\342\026H^\2032K\006\334\177\3557\202\036\375\003Bf\354i\336\f\254\250 "
+	.string	"P\345\2574\031\200\025q\r\350\336\376O6\331R\246\024="
+	.string	">"
+	.string	"?"
+	.string	"\227\206\370\366XA\315\315\2676\226\316\343\036+\032^A\005\250\022\016\031\217\002\004`\222z\201J\230\341\232\361N\260\300\356>\344Y\3013eZ\233\335uv\336\205\333\272\355\217\355\003\366A\001p\265\303:\310\0375\235\232\376%"
+	.string	"\210\017\357\036X\354ZH9Y\222\252\305\b\333\307\330\316\264\023,\330\0162\301\272\333\301\304\310\356\207\300\006*\257\274\3313\376\211\330\001$h\244T\224\354n0FN|\250\324#\305sE*\001\024\027\020^\213\"\034\216\033%j\344\356rj-^\037\210\3048\245\211}\024\3774\377\303\022F\371\356\225?\212\257\256\034\216\023\033\033J\231b\177\\\252\207\375\037Mk \322\030\214<\241\213;\032Rv\221\262+\364q"
+	.string	"\272:\231vi\004\030\023y\262+\002\206e\027\346\333\303\325\216\212\f\f$%5EKZjc\020\362\235\037\362\315I9G\265\324\231Bq\033"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"]\303\027&0\251\272O\245\306\tw\037\214\262\bc\2011\212\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.114.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\367\002\265\026"
+	.string	"6k\224F\240\032U:\204dT\236\366\001\003\027\202\271\334\243z\272\375\035\324W\336d\3128\037)p\223R\004\255\265\355\0240\310\204[\371\211\277t\t\002\r^\207\236\306sy6e]*\305\324^\310\357=\307Z\2627\2212\245z"
+	.string	"r"
+	.string	"\210"
+	.string	":%\204}\036\357a\233,\342>S\350\021\345\230s\232\036m\021\266\351Q\017d\223\257\343;j\377\031\001\316\03058L\364\3149\023<\372"
+	.string	"\3511u"
+	.string	"\362Q\257\222\217\256\331V\006\220\2309\np\354tA[\346\234\255\345y\3552\202\2535?\254)\351\360r.U<\222\b\312)\230\342\213\342\341@\003s\316\003]w\274\233jX3\347\264\352\360P\334\341m\343\330v`o\203z\344\257\356u?\277\036\304\2064'n\201?t \033\374\031\217\276\301\321\353\340\310\307\357{zC>?6=\262}7\335\035\373\340\234sza\330Q\275\232)\251eR\377\271QQ}\"\251c\242\332\024\252aBu)\252IQ\035J\265\224\352\b\252\301\250\336\250VP\375"
+	.ascii	"'\236*\274\307\2202\347\211#/\023J,\252\361\237\337\276\377\343"
+	.ascii	"A!\356s\357q\232\"';\036!,0kZm\222sb\242\333\266\030\371\246"
+	.ascii	"\255\2709m4\245\205\331\347l\220\266\264!\222\334\025\332\212"
+	.ascii	"\033\211\f\227\264\317\271@m\270\252(2\264\350~\240\334\231U"
+	.ascii	"\"\272_\\\0019>\223r\237\353Im\\\325\013\031It?\235s\346\354"
+	.ascii	"\356\330F\202\253\301\207\021N\273\330\276\360\"D\340R\350\r"
+	.ascii	"\341B;\221\021\005\246\3149\031\370B>\004C\006\227K>\246\026"
+	.ascii	"E\245\210u\335]\371%\347\342\026\346\300\232q\370\340\202\265"
+	.ascii	":\304`\260\330\213\300\315l\026\001\006\302C\350\027\213&k\321"
+	.ascii	"d\255\0167.X\353%\233\265X*\307<\330\310Z\037b1Y\313\344\263"
+	.ascii	"\035\234\013\243\204\021\020\024\333\336d\314\372K\316\344\001"
+	.ascii	"\004\t\022\344\343\r\026O|Z\304\335\361J\350\b\215\235\271\t"
+	.ascii	"!#V4\265\250\335\351'H\231'\271\222\t\376\fW\260`A>\312\354\203"
+	.ascii	"\016\026a\321\304g\305ic\366@G\320#\272I\031\372%\370jOk\315"
+	.ascii	"e\t\217L\273\3328 p\002\231\271\234\007y\2632&\036\321D\327u"
+	.ascii	"\026\303\032\367~\254y\013k;\341\276\352\021\0161\207_\320\016"
+	.ascii	"*\236\221d]\233\252\03124L\262\251\214;\214Sj\025hq\207}.\026"
+	.ascii	"\356}\227{\034\035K\025\263Hxr\334ml\333\245\227\332\317\300"
+	.ascii	"\017k\215qR\236L\214=\245\307\227-\313\210\227h\017\003,\202"
+	.ascii	"m\021Ic=\034o\220\227\360\204\371\035\214\3622\344s\030\203+"
+	.ascii	"[n\273\202\036"
+	.text
+	.section	.gnu.lto_updateRSSI.116.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`M\001\245\r"
+	.string	"VXYD"
+	.string	"\261&\035+C\326\373\334\022\356_k\032\\\376\274\303FDM(O\024T\007\211\262\006X%x\226}\020K@\243\023\206\304i]\016\232l@\206\252\025\214\252\232L\236`#c\370\254wTb\311\336[\246\024E"
+	.string	"D"
+	.string	"G"
+	.string	"\037\326\2453{uO\303\002\220\201\001\201\246\306\356N\230\341\331e\204\232\371\261\005\306\206\353\264\313k\345\36137\320\362r\303u+\207\233\212\005bBm\350\350\036@\355\214\354\256\225\353&\334\326m'\260=\355w\b\362\260\243\302\f\034\n%\375loS\210\301>\374\276\017\307\320\305\376\351\227\252~\307\343\264\242\373\213\315\256\204\317\306\246d\013\030\217\355\253\375\020\027\221\375\344\300\034\273\027>\260\330\365\nX\300u\031r\020\3532>\234_\243\002\221\332\240\346\323\274\304CJ\323\234\233P&\0270\205\257\"\312\210Y\226\023>\n\257.=\351,+\023#\306\276\t\333\253"
+	.string	"7/v\265[Pn\t\204\250\350\r\373#N\202\344sp\203\024=w\351\247X\017#\004\240\020\311\201\023\023\020\206\221>\036\376\210\240`\023\005\233&$\nB\363\203\215\246\310\207E\013@\330<\021\211\260\351\361J\217\013]f\376\b*\032\251\022\334\374\022\367\210\2469Qz\324.\t\301\232\017P\241\342\2456\203\221>\037"
+	.string	"2\241w)\340=NX\240\223\352\263\013\272\226\332\013\325\252@2\236\222\f\0077\263\32556\001\301"
+	.ascii	"\315O9\003U\030Q#\213\243x\251\314b\234a\005e\313\300\250KX\304"
+	.ascii	"j\364\270\233}\022\211\325d\247n\202|\273\254<\001"
+	.text
+	.section	.gnu.lto_getRssi.117.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\022\001e\f"
+	.string	"\266\027S@ \221\222\016c8\t7\004\345\034"
+	.string	"\007\037\322\3430c\340Tk\004v\002\211\231\270S\347\260%\177\377\212\243@\260\034>\244\005\f\002\b\342_r\363]\304\201\215\236\270f\033i\204\220\275w\222)\005C"
+	.string	"9"
+	.string	"?"
+	.string	"\333KT\361N\200\332\236\264T\315\301\035N\312\351\210\200\241tlxQ\031A#F\255\n`\001\320/\315\001\375\216\301\034'\247\266\007/X\001\232\341\371\2408#\0051\306\246\3473\301\275\333\"hk\240u(~u\t\364\363\007dh\301rk\265N\376Bk\027\277\3226\253q\331\214\313R.\213\201\331\311e%\227\215\\\026>\373^\326\271\354\237\315\314\032\300F\350\305\307\240\0301J\b\375\3306\031)1b\007\242K\360\177tg\032:\271\365\035\336\356\317!,\202S\2634DD\004\372\271O\024\362\377c\221\271\370y\253\324\350\210?0\220bLIP\207\254\221\324,~\265J\322\236\335x\230\\\225\311U5\030\001!\2516\327\203\312\203\243\226\203\220\253\202`YWEi\230]\374\212\346\005\260w\232\271\346\316RP\227\2369D\221U\350H\230S\3231'"
+	.string	"#s\001q\211\r\211\351\037-ZL\330\202\013\020Zl\030"
+	.ascii	"2\241\207)0F\nu\374\300\2530\031\b\207\005\022\301H(X\311\344"
+	.ascii	"CB6\224\t\nL\022\300pY\3134B\306\027\213[\331>T\255\27006\037"
+	.ascii	"\263\230\005#\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_getRssiPercent.118.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`v\001\205\016"
+	.string	"&\034aC\360\222(\035x/\323X\312\241K\277\363t\216f\350#\241\313\252\037\241C\"\037Y\035\262+\365[\177\250\030\325\025\007\344\331\222lcX\234\270\227\343(\216\336J\360\346\230 \276\375o\345\267\204\220M\222L)P"
+	.string	"E"
+	.string	"S"
+	.string	"/0b\324\360\375\2105\240\013\021m]\243\260+\305'\372\240C\344\f\333\224\2263t\253\322r=\200@\245&"
+	.string	"\027N<\b\220\300\260\212\361\021\343\253{\b\233\234\246\332&\274 \365B\203\325:95\0051\306&\253\265\301\275\333\026h;\240M\221'^\232eX{\231!v\273\214\305\340\360\225p\241\362k_\251<\210\326X|K\233eE0\033\202Y\020\314~\264\254\007f;0\313\201Y\356\331M\226\325\300\354\366\254\326l\206e\261g\363Y\203tldh9;T2\016\314\002\302\n\317Ir\270Z\370\203\016\230W,\311\367\365X\211\021%\302y\207\373v\316\255\032\221\312\257\233s\267\346\233Z\205cJj\227\216H\244\314Ps\r\213\366\355\020\207J\006\273v\257f\354j\004\303\230l1\256$\250_N!\241v1l\035\215\240\224:\224R7\301\244\344\244\033\225*t# \365(\220J\235\005\317+u\334\013e,\276%\273"
+	.string	"\324S\315g!\331\033\332\347\276\310\f\330o\0314H\263\362Xd\371\251\242\373\253\231\320E\267j\006\350\235\207\236\311PyHm\237\203<\377<@\035"
+	.ascii	"2C\237\220\300\376\033\020\332\020\322j\270\363\225\330e\006"
+	.ascii	"i\226[a2\020.\013$\202\234P0\223\311\207\204l:s?\230$\200\341"
+	.ascii	"\262\022z\204\214/\026]l\337U\026\272\206?\236\211\023T\300M"
+	.ascii	"\205\rw\331\324N2"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.119.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505PO\222\016 ;+|s\244\270z\374@T\265\211\3072uY\321\324B\255m\255\371\370Z\3409\200\232\3104i$5\313\202\241\317\"6\214;\262F,!2\005{:\037*~\250\b\341\300\360\020=\224D\354l\236\"\032\25081MT\324h\331'\372\031\\\357\342\247hJ\025\220\231\t\027\245Z\305\035\025n\001r\305\n/H*tO\340\344r\333k\226{\035\337L>\321\357vo\340e\224Ud\313\334\330b\262\005\262\200\374\241\327\\\222\226\204\2568\030\227\305\t\321\310P\201\311\324\"A\013\244B\327\215T\370<Z\325U\267&]p\031Y\3012\253\016@!3wX\306\321_\177\204\377\340\377\b\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_rxGetFrameDelta.120.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\r\n"
+	.string	"\326\022E< \005)\035\340\030\f,<\230\001\002\313!4\330\315H \235\213\360!\250\314\"\b\217\r\373\244e\347->\242\302\314\271\202\020"
+	.string	"\031`-\\\243!*~`\304\213(z\262\267\224)\0054"
+	.string	"4"
+	.string	"4"
+	.string	"\333\345\216\374{\\\375\374\004\221\030\216*<=\022\204\036\337\350a\271\320\f\302T\\\240\301@\216r]\205(\325"
+	.string	"\2079\247U\025v\334\362\266\037l+\330\357\004~\234\333\262\255\216V\253\252/\013dj\302\307l\346\344\250\005\2301\022\206\304\266\311\356\370&?1\371\203\320"
+	.string	"C\206\222\220\215Y\316\234\223\373\374`\273\214\367\004\037\240\326\2564\030\353e=\332\276{\303B\223R"
+	.string	"\266-\2762\022\230s6\370*\227a\370\257Kg\224\364\252K\277\264]~\021fR@\255\331\262\223\256\313\001\016\201H\036G\3628\212\211\b\021\027\362F\034\310\343\256B\302\343.\272\316\343:\262\371m\371\333t\343\352\256\366\003.*\306u\265|\366\371/\213\272n\273\214;\020\020"
+	.ascii	"d\b\370\350\220\232\305\361X(}\2501\365\"'d\002\253'\354\362"
+	.ascii	"\035,t\r\257\305\342\341!HqWb6YCP{"
+	.text
+	.section	.gnu.lto_isRssiConfigured.121.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375 \363\255\006"
+	.string	"\222L.4Pm\222\016$\243bx\021\026\256\254%1\362\214}\214\3018\245\253^\317\276\375\273e\307\031\001\250P\343\331\2316m\f\025\260B\022Z\034:\252\265\3667\221)o4\235\347:\317=4,8\270\315\213p\032\201+\b\206\347$\252\352\271L\226\305\022\"A\bE_\316\245\210\330\021\211\250 \r\341\\\216'<\255W\251\353\271\224*\002X\204\332\3513PC\214\257%\261\364\267\261\265k\tH\241\300j*\311$\235V\362\204\032\351\370?\237\371"
+	.string	"\341\263\325L\2034\340\2611\022Q\311\314\034f\324j\263n?\252\200b2\2710P\033&!3o\027V\321\261\277\301_\360_\004\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.148.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\352\003\235\031"
+	.string	"f\355\241F\260ZQc\270C\316k\244\336\202\301X\354G\322\345~\034\352"
+	.string	"\236\322\376\244S\2542\007\321\270\2560%\264\r\240\232\0320\316\261\355\223\366\016\332\360Hy\356\007d\317\027\177K\221\345k-R1\217\332\336rK\231R\210"
+	.string	"\226"
+	.string	"\210"
+	.string	"?S\270\336{#\n\312\275g\203[\363\250n\355\233\275\2725b\363\331\366\213\234\351f\034=\225|"
+	.ascii	"\200\264\3509\r\357=\313[\001g\215\267\364:\343m\335q\334\311"
+	.ascii	"\321\212\225\252p\276\351\320/wRE\323\370\030g\314\f\375f\334"
+	.ascii	"\266\356\275\253\337\n*\212\254,:\302\254~<q\301\r+1r~;Z\305"
+	.ascii	"V\025\251^\316\217'\"H\302q\346\301S\242\237\020\245\004\256"
+	.ascii	"\"%\334{}\235\321ms\333:\333;\273F\005\367\276\230Js\217,\024"
+	.ascii	"\2203\371\224\232\351\232\216\004B`zPQH\2300\211\312b\205\016"
+	.ascii	"\211g\313\022/\212\372\2408H\274F\247RQ\207\241\220ixw'\003\232"
+	.ascii	"\203vN\245\"\262\306\032\236\357IN\332\367\235\374\211\275\262"
+	.ascii	"y\241\003tq\032\2326\350dh\342B;\350\362d\370dd\332\205&{R\210"
+	.ascii	"X\037\211\315W\362\240WLlw\252\321\235\363\026\371\232\276\344"
+	.ascii	"v\247\332/\317g\003\343\211h\314\202S\225\304\017 \330~\246h"
+	.ascii	"\361`pk\221\332\017 \334\002\031\236E\203\352\336]\004\037\313"
+	.ascii	"\2456\370>n\315\301\203\365=\324S\341qDG\247\2002\210\350\304"
+	.ascii	"\n\254rZ\351\020\026\335\371\207\321\006\021\202~\210\326\007"
+	.ascii	"9\252?\232\034S\302Z\201\266c\343\353\221\232\300\354(\032\017"
+	.ascii	"\240\255{\021\243\355z\321\017\275\026\270RDjWsQ\266mbTJ\327"
+	.ascii	"w\217\256\202\333\007\177\027W\226\244rT\r\255@W\325\305[\223"
+	.ascii	"l\034\352\021\207\332\342P\2137\324uEMW\324\2771P2\005\206\301"
+	.ascii	"zh@\346\354\204\314|\211x\315\312\327\317\001\303F\224\030\021"
+	.ascii	"\373\221\231\024|~\\4\240\230\313\002\013\310G&s\301^\244_=("
+	.ascii	"f%\212Y)\213\271\202\312\327\214V\366\350\330,\3413+O\230\346"
+	.ascii	"\254\\\331\246\027oM\362\313\360F[\037\274%\303\305\212u\254"
+	.ascii	"D\266\307j\t\272*D\342\220\374\213\027[I)4\352\017!Z\356(\no"
+	.ascii	"E\262=\341\\(h\371\226\n\0270`\030o\305j\263\343i\311PMl\344"
+	.ascii	"l\005Z\303X\353M\217\246/vO\250\221Hd\2201\306\320\0043\022\214"
+	.ascii	"\2026m\220\002\031;\323\006\021\220\265\223&\31445\312\3653L"
+	.ascii	"\320xz\330\2712\f\314R\363O\243\031\021~\246\236\304\233\305"
+	.ascii	"\260\302\225\257\236\177\320w\250\021\\s]\266\024<iu\b0dy\260"
+	.ascii	"\355SW\342\205\270:\202\\\2110I\263Nl\177\207\204~y\360\347\200"
+	.ascii	"\006\034\222\204\310\231\256\263\373\267\374\371i,z:\005\020"
+	.ascii	"trN\"\323\222]\231\024\376O\220\303\002~\375\230\251\304\343"
+	.ascii	"\b\017\346L\303\316\372\203\t\325\024\254\240\375\355\2554\026"
+	.ascii	"\005\276W\321i\261\233\033g\256\2546S"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.155.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\316\002\215\025"
+	.string	"\246g\213I\300\224Q:\364\316\332mYUZ"
+	.string	"\260\261\323\334b\221\327\217R\032\346k\375w\002\350\343\355\013\271\001\244\004\354\337\206\227V!!\333#,\263\357\266\006\255(\212\302T\024yw\362h\241\275mR@Q\215\237\020\262\267\334)\005{"
+	.string	"k"
+	.string	"v"
+	.string	"nq\321\021\262\355\026\227\035\273~C\n\022\220\364\343g\tI\255\267\360t5\334\365\023\370yt\2564q\371<?\205\240\271"
+	.string	"i\377\216\373T\242-\361\360\301BFtO\306dC\247'2\237\271RkE\311&\3109\007\034Y\330}\207\320l\256\330`\372A\311z\344N\003\265\033\024Nd\260\251\322\224a\310q\227@\262\036)Qn\362\275\324Z\375W\205\033u\333H\266C[\n\t\364\270\027h\322\375\250\2250\362\222\243\\\233\327\344\263\356\221m\351\023\225\006\251\364G\245\275)M\247\364\244\322;\245\345o\377S\346\207\242"
+	.ascii	"\265Z\203F%\365\002\225\341\301\366\355\343tl\224\275c\243\274"
+	.ascii	"\3627\235\237h\315[\225\ty\245}\023W\332\371\211\226O\265\032"
+	.ascii	"\t\201Q\353\r\301\251\t\200\247+W\361N\347S\274S\373$\002<F\272"
+	.ascii	"6\323\375\212\271\0343\350J\230\215\273\032@t\343\\\333\334\357"
+	.ascii	"\225r8`<\206LJ\245\332\003\033f/9z/c\034i\302\260k\263=\343\355"
+	.ascii	"6\310\005\351\221I\354\267\270\213\031\232\232\032\357t\267e"
+	.ascii	"6\216"
+	.string	"\230\311\365W\234E\313f\265\362N\345\221X\221\017\321\361\226\367\225\373\242\331\222\234\217\0245\230\034\355\273<\037\305\227\\>\007C`\311\307N}\226\367\254\004*\033\032\030\234\033\225(FH\001p\212%G\fs\304\360\206F\306&L\211\254\220%\305\253\007*1\304Y\255\304\020\365Y\367\310\307\035T\362\001H\367\342\373]\336i\201l\237\326/\257\205\235@\0341\237\361\276\005\3675b\276\205\241\265\330)pPcB\221\366\002\006\3621\313\024IL;\"\260\345\261\r\211x\201\337\332\220\364 \n\252\251\250k\344yK\343\243\267'\271\231\316\247\006{\007\020\001; \300\"\2512;2R\fG&\370\001\335\3076\261p?H\036\215\301\216\215\341D\300\263\265&\2102\036#\210\210\207\025,\231h$\033n\036\335\376\360\026\333\225\213\231\274\225\267C#\\`\023L\203C\037\355\227?$\001\377IvJv\2573"
+	.ascii	"\333\316s\222\026o\033oF\027\330\ryf\204\033\263\330\035\346"
+	.ascii	"@\274\334\311\331\331]\033!](\300\342^\\\300\0200h\350\276Jj"
+	.ascii	"\212\205\203\254\355N"
+	.text
+	.section	.gnu.lto_setRssi.part.0.159.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\231\002\365\023"
+	.string	"\266d}H\320\322(\035A@\200V\220?l\303vw\220)\200/\250\007\363\240\036\262\224!\212\203(\324\337I\237u\264u\377%\362>|=uU\177"
+	.string	"\346\024\234\3238\213d\327\274hY\f\363\323\217\363\"\203\375$vo\"eJ\001d"
+	.string	"c"
+	.string	"j"
+	.ascii	".\376\346\374Pt\342=\232t'\257\036\007\273\316Kq\023\006\306"
+	.ascii	"\253\366M\374D\354:/\3079ip\206\346\304%x\264\001\357\021\300"
+	.ascii	"\005\310G=\211|\264O\3026\f\3061;\307q6\223@\216\212\032\017"
+	.ascii	"\2179'\370\270!\036\373j\027\3631|M\0326\\\003\274+\251\3149"
+	.ascii	"\355\305\334\361\266\025\330N\261\267@\335\273\271 lO-\"\325"
+	.ascii	"!%5\310\252O\2536I\365'\325\236\247.\255Z\226\324Q\252;\251^"
+	.ascii	"\251\326\343\376\227\350LJ\21193$\371\2304\221\b\347@\177\317"
+	.ascii	"\325\276}\0240\337\347A>\001\375\270l\"\373q}\332\346\347\216"
+	.ascii	"\034\034"
+	.string	":\346\234\013\274\367\300\316\343\242\016\246\214\003\202Gw;O\021;O%62\0363s\324\243\303\2670.dC\362\266\333o\377\203&\242\264\236\035\336\305\313\233s2\360\211\336B\202\177\363hT*%\037K\373\021\305\225\373ZN\306\342C\252\t\253\225|\214\3732s4bW\267\333\323n3M\262\277\342B\007\374\033S`\321\333\036}\026\371\270\373\311|u\037\364\0066<\034\325r2M\322\255\361\006-(\325\203U\253\025z\252T\350b\265\244\312U\001\005a\325j\205\237S(/!\370\022\202-+\024\013\230\n[ \n\211Y\026T!x\201\305\n\301\223m\275\212lg\2735\266E\326/z\215W\204\225\025\031\262\"+wn7\272oCvdv\213A\313\201,\215\333\220N\013\262jT\313\215\334/\244iO\033\215j2'\227k\332\001\263\233\017\3556\233\361\n< p\002\231\272\353\001\030y\225"
+	.string	""
+	.string	"\t\304\343\222\202J\300\3672\366.\3340\216\350\332@\007\f\334\354\236\305\020\355\233\333\247k!\224\240\210\013F\212\223\021+\343\3009\211\241z;\332\227\321\222\021nq\235YX\356\020^\244\240\006\020y3\302\030#:\026\006h\020\017\2476l\0014(k\300\242\257\302\253A\220\306\237Leo\366\217\224\343\207f\247\204\035\210\227?9{\273\355)\373\f"
+	.ascii	"\333;7\212\242\337\205\307"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.164.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\005\013"
+	.string	"\226\325J<0M\225\016C@N\263\223\312\277\220\302\271\315a\200\323v\320\350\375w\260\300jG\350\263\265\030C\274\032z0\f\253:8\230\273\006\017\240sj\357!Stf\020\250\261\355-eJ\0018"
+	.string	"7"
+	.string	":"
+	.string	"\2164\036\355g\260\355!\231\263M\334\243\260"
+	.string	".\234\020u`\355.\366\250\023\316]\023r\376\275;\272\322\347\372(\231\236\027\207\026\004v\327\r\007w\274m\212m\001\366\017\004\216i\b\323\n\323y\325\177G>\210h\330\035}\255\225\020CX\260}\373\236\307\276.k^\345\t\305\363T\347\336\216H\326\264'\024\356\251\216u\027\002\006\020\273\336\200\307v\202L\276\203\252\254\021\337*\244\037\253\372\033\316!\363+X\301\226\357\036\375\215\361\370\024\035\212|"
+	.string	"F\252\352\033\264B\371\371\232\n\021\021A\205h\005(\277T\224\025\036\256\236\034\230m3\260\331\n0\260h\036\256H8\032\306\3210\r\006A\006\253h\033&\2018\333X4lA\226i\330e;\017WOn\2200\255@\032RE\331\206\352{\370\207\212\345ra<j\211+\003\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.165.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`\353\001M\021"
+	.string	"f\237nF\360\262&\035R\305.'\nh\345\035\035\323o\344.\377\327\254\256$wq\301\213LQ ^\255\313\263\333\2641L\275\355x\376\b\f\flf\221\252\030b&(\303fJXT\357&B\032\002k\252\266H6\2212\245V"
+	.string	"Z"
+	.string	"\\"
+	.string	":@\273\262\004\217.0z,}\300\366\250]d{\344\036O\302\266\n\203Wv\216\313nv$'H\306\207hw\273G\265\371\352\232f\\\371!'\322\013\306\272\226/X\206k"
+	.ascii	"\230K+\355\356y\236\025`\255L\001\217!\247\335\365H\303\275\335"
+	.ascii	"6\003\333\013\354D\005\326\230\316\230>)c\nj\354^(\372\26131"
+	.ascii	"F\b\025*\267\224\\\262\033\330{pV\224 Z\327\222\330~q\013j\202"
+	.ascii	"f\223\023\004D\364\370\235\373)\356cs~y\217Kb3\356\345\276\t"
+	.ascii	"\225\317c\316\366wT\227\301$jc6\220<:\323\376\211\243X]\006c"
+	.ascii	"\322\256\207o\3314\355`A\347\206\016\0346\\\351\303\252\232\216"
+	.ascii	"\314d\202\\SU\357s\003 p^\310\374\210he\221\271\264!|\371Wj\251"
+	.ascii	"\245,\373-\356\002\306\377`P%\377z\364U\266\307kIl\326\203CL"
+	.ascii	"\026\261\030\315,\202\307\003C3\204X\t$\265\306\032\257\255\322"
+	.ascii	"\330[Z\213\031~`J}(,]\n\370}\240G`\245A\352C1aII\205\241\004"
+	.ascii	"\017\200=\223K\330\271\204]\n\212\203\257\363\302\225\316$b0"
+	.ascii	"B*\354X@0\3548\333ym\225\306<?\205\241\231P\214\266d\344\313"
+	.ascii	"'Mk\354m>\320ax\251\223\223\355\321$\306c\304\016}\356.K\265"
+	.ascii	"\306\246\361#\024. p\002\221Cf\036V\204\301(\211\241|h;-\026"
+	.ascii	"\205\206V\240\375\214\310\202\026\026saD\242\340\fXg\036\033"
+	.ascii	"K|\033\237.\013E\262\305\214Od\255l\002\205{-\260iD\3010'\334"
+	.ascii	"P\b\202:\304\3361\347\366\030\255\306pW\302\336\027\253-\225"
+	.ascii	"y\322m\323\005\355\324\005\215.k\026\030\022\257\344(\315)\335"
+	.ascii	"\255\327\2061"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`0\006\355\031"
+	.string	"\206i\230Gp\230N:?\272\211J\3072z\225 \020\371\377\327`X\352+e5\353\211\366\023\250\321\343\325\245\320(\224\024\315.\221\376\266\365\373\023\263.\253\353\272\2544\233@\344L\271d\372\322\240\213\223\260\316\007a\233\264Md\n\202"
+	.string	"\203"
+	.string	"\204"
+	.string	"\251\207\267u\270\024\016|T7\360U\355\325\3602\325\336\fob\350\203I/\034\213\215F\243}\026\372_\322\n\234\244\320|\225N\270S\225\360)H\257r\340nj\220\222\300\275\b\375\274\024B\037/\265\367\301\221\203\223\361z<:\233\372\277"
+	.ascii	"\317\323\250\267\211Q\177LQ_\256A?Nx\221\310\2452x\357\275D\375"
+	.ascii	".\306\277#qC\375-)r\351\344\357\177\215\b\277N,\213M\250\177"
+	.ascii	"%\375?L\020\3475\251\343Z\324\034}@\034\3752R\375\277\250\276"
+	.ascii	"_\n\325\357\003\274\321'\363\324\347\263\321\337\253\321\027"
+	.ascii	"\323c\244\352\321\350\353\315\350\207Ie<J\214\2379\335\f\306"
+	.ascii	"\321\324\246\376\335\213\276\035S\277n\251\357%u\321\247K[\034"
+	.ascii	"\r\213\247\251W@\030Y\334\212\376\334U\352sIU4\177\245)\276D"
+	.ascii	"\321\354\225\236\340!&XH\t\256\"\321\254\225\2168\025\021WK\372"
+	.ascii	"\232jo\210?A\234\271~hF\022M\016\3605\226\344gE\253\263\362\200"
+	.ascii	"\2531\345\237E{\003e\316\323\002\303\313)Z\004G+Za\027\007\361"
+	.ascii	"\315=qr,\022\007\257\023\307\362\372\304\261\334\307\326\t\227"
+	.ascii	",R\023\024B\231\261\302\374\256\2105\226\233\314\201\\\321\347"
+	.ascii	"\313\210vm\016B\325?\203l\266\342c?\220o3U7\257@\232\221?\372"
+	.ascii	"f\370\336\373\023\210\372\350G\271\207\r\217\277M\035N\335\361"
+	.ascii	",\352?\005%\025"
+	.string	"\345\324\304\004\245\324\364\244 \037\322\225\025Yf\366\020YF2\203\275\201YQ\211,C\371vlO\266x\206,#9\275B\026\351k\f,\033\341#PP\330\305i[\237\334\326\016\220%.a\026\313J\273\373\t&\375\004o\2306P\376\362\336k\340\307\032\351\030@R\311u5\037k\364\"\256w\372Xa\223-\223@<\350\321|\354R\217\3455\215\307\016\273jv\354\220\311\374\205\245D\026w\254\221\311\351\031(VU9Ek\\y\001\325\230\333\315\212V'l\250a\f\303\211mDRFR\232\326\260\002!\242\3426\021\220\224\004\013\005\"#\201\210\310\230\266\001<\274\321\345\031E\221\320\344\r\020z\"IG2u[\376\316\037\274\\i\270W%\225\234A\bD\022RU\025S\025\210\344\222\026\345U\316\357\313\327!] \357.vd\211<\207{J\320n8\002K\252Sn\fB\2662}\343HL"
+	.ascii	"\330:%\320\352qX\373\240)\023\235K\266\315>gdI\256\2740.Hc9\322"
+	.ascii	"\347\2723\333\202V\017j8\316G\334\034;4?\004\315\037\244\004"
+	.ascii	"\177\337ye\207\352\2547\3471r\316\232\006\016\261\226n\035u1"
+	.ascii	"\310\006r\266\331\222\234\025\355t\266\345\002\313\300\001r2"
+	.ascii	"\366\257\333D\367\276\207\342b\265%&\213\221\026z\346K\244\001"
+	.text
+	.section	.gnu.lto_.refs.e0ad421e2456994f,"e",@progbits
+	.string	"(\265/\375`_\001u\f"
+	.string	"\246!Y20\2078\351\321PPPPPPPPP\220\313\210\340\350\356\2761K\341j\030=\207\002\2650\215\201\257\263\362\037\261\375\207\251Y\360\243%D\255\221-SG"
+	.string	"L"
+	.string	"I"
+	.string	"\035\263\364\211\345-\367\021\367\006\323S\225>Qz\274\276A\351o\362\320\365i-\271\236\"\357x\377\334gd\bt\303=t\357\252\r\332\025\365\323\324\245G\376b\036\305O\267\303mI=\002?r\017\275\257;\212>\023\004\2617\363\306>`?\251\247\303\232<r\350MjC^I}b\350\215L\2270\335e\036b\370\304\274\360\256.\235\272\274#\241C\205w\n\017%|C\350\305z"
+	.string	"\317\240t\214\367\026\223\377P\237\275\036q\365M\3455\324g^_\250\004W1\247\342?$\272c\363\357\352\031\017 \271\225;\275\326\020\275"
+	.string	"\325/\342W\270\377\300N\341>\333tO\314=.\357\274\376\300\371\003\316[8O\341\374\344u\211{\210\373h\351\322\253\333\364\350\322\241\330\033\224\267\330\263\345\031\237/\310G\"h\315\025d$\017\030\350\315s\001\002\315hK\022F\273\350\020\374\006k\321\006\\xE\356>9\364\311\363\223\002\332\017{\227}\263)\242#\262\357`\017\201u"
+	.string	"\b\257\261z\203\304g\254\216\311:\006\277\002\377\232\350\226\247C&\016\016"
+	.ascii	"UI\245\342\346\314\205c2\001\273\031D\343\230\213R\026[\213\375"
+	.ascii	"\260\202C\213%\035-\342\nX\234'\343\313L\001"
+	.text
+	.section	.gnu.lto_.decls.e0ad421e2456994f,"e",@progbits
+	.ascii	"(\265/\375`kQMV\001z=\236|T \fQ9\351\024\350\265V\034G\303\234"
+	.ascii	"\343xz\206\276\207\215+\207!n)\234g\354\300\017\003w\314\303"
+	.ascii	"\344\217\357y\231\210lZ)\254S/\242Q\033-v\221\033\037\246|\230"
+	.ascii	"0\215G\001\354\026_!\353\310rn.Q\006\323J\341T\356Q\242\t\331"
+	.ascii	"[\356\024\235\006\306\007\376\007\215/X\"\364\3572\016=P\272"
+	.ascii	"\004\tk\3747\024+%gNW\343\333)r\334\214\365\341\241c\363\333"
+	.ascii	"\2726ycvh\352\320\251Sf\254"
+	.string	"\316\342\305i\030T6\016K\263\315\215\215c\353\266\024P\006\247\231s\376\337G\232\254wt\222f\322NzI\367h\025z\253}tX7i#\375\244\271ZI\377h$\335\325DzH\217\265\220\016\322@\032\254\213\264W\363\350/\313l\261\306\361\316\321:\246\320\376\344\322\374\266\316\252\361kS\212i\332\2723v\354\0352c9/\221\272F\032\211\337\366I\3318-c\266\317\372\33183\326\316\217D\243g\\\031\353\233\312\322b\235\3257\202n\316C\320\306\354\256\246\360\305\260qoS\242\2664\347\374H]\3456F\347Gj\031=\243m\315o\373:\217\261\373m\237\3153\307\367\333\276\025\3304\365l\\\320\315\031\310\2331\244\306R\300\231\224\246\255k1\273g\331l]\221\020\320\3324s^\332\272\177\003\022-f\357l\234\255\333\3127N\226\034/e9/50\322\300\252\241C\265#\004\334u\266\b5"
+	.ascii	"U\372\267\215\367\2158\016\344\r=d\177Wr\032"
+	.string	"\267\026\322\333\006\021\232\265\265\314Wr\316B\001\310\002\327\245q\217%B\217\346\364g^\372\223.\375\331%\3759\326VX\007\0310\261\306?\213\244?\261\322c<\351\361\231\364\030Lz?[\204\036\267\245\307R\322c(\351\261Xz\f\226\036\347H\177\361\244\277i\322_/\351\305\254\245\257K\222\036\257+\035\262D\350\233\266\b\375\305\221\376N\245\357\274\324\310\026\241\366\215\205c\231F6/\013Y;\251+\256\306\3575i\t\2625B\377g\215\320\367\\\372nK\217\226\244\"l\021\372\316JK\370\245\267u\351\257\330\"\364\266J\352\301\022\241\347R\206\314}r%\247Mc:\030`L\273\306\267F\322\377V\316\216\261L;g\303\330e\316\313\234\363I\210\261qA\312\241,\205\306\314\210\rH\3309\353\305\306\335\345X\217\225\2572\315\234\227F\032h $\244I\232\034(\276\035\222\336Z\245\366\213\005c\231"
+	.string	"\260p\337\200\304\257\222JF\313y)\004\224\307,\217\235\306\267Q\351-"
+	.string	"P\373g\001\200~\004\351o\273"
+	.string	"@h\251\243\306\220\306\277\345b\267X\2702\"\027\247\261\026\243\237)A\330P5~\213\364#\226\226-(j(OI\301\031\313y\371\337\276\331,\226i\261X+\267Wl\333{\23133\347|;\345G\272\305b\335,\333]r\311SRg\022\240\006G\365\303/\347\245\006F\032X\320\341\006\304\016\212\317\200\324\203-B\261%B\377!\265j\226\212ef`\327n\323\354\224\237Q\313\274\314y)\324H\360\264Ui|\013\322 \257L\342hz\233\001z\377\376l\006\350;mK\204\016\331\"\364\267R~\033\305\242ep\253ht\345+9//\244S_\336\320\032\177i\213\320\324\022\241g\201\246\002\037XS\274=!\370\277F"
+	.string	"\"\206\363\262_\301\r\234"
+	.string	" `\200\350\307P\376N\002\272K*\016\247v\031p#\203\021\360\214\337N@\243\315\005\201\345:\001^\3747\205\373dm\030\240\202\037[\300\0065p\001\213\346\264\300o_|\355\\\3615\026D\212\3763\002\277\005\361\337\343\005\337\360\265\023\305\337\353\337\310\377\032\377\006\272K\266\002\267\360c4\377\327\b\360\301\t\b\374\267\251\205\200p\016?\006\300\337L\267\003\277\305#~\271\317\217\231X\026'\316\242\205\234&~\213\345?\234\305p\003\360[\2719\342o\3370\360\237E\226c\370O\020\3766q\231\254\260\207'\206~,\003\350w\351o;\277-\273-\376\036@\001\256\372\337\r\374\226\313n\370\355\004\013\320aw|\320\036\260\350p\207\034\370\257\005\316\301\217\227\376\303\251]@\301\255\300\377-\355\341\357\n,\004,\370/\005Jx\207\bL\340\027\374x\001\177\357\335$7\022\256\004~[Bw"
+	.ascii	"\372\361\007\026\204\376p\035p?h\021\367\202\337\332\270\r\370"
+	.ascii	"\032>\341\357\022H\\\340o\f\374\367\3045q\031\360[\013hy\320"
+	.ascii	"\201\023\027\260\036\370\257\b\377\375\340\206\360[4\215\365"
+	.ascii	"\341?\005\360\267U\321\355\177^\370{\001T@\177\223\350)\374\237"
+	.ascii	"@;\202\337\222\370-\336M\300oC\3747\b\001\277]\376v\354\267K"
+	.ascii	"\376\373\301o\321\376[\342\267j\377\365\340\357\022\374\235o"
+	.ascii	"\007\023\374=\347o\277\377\222h\020\356\375/\346\240\207\004"
+	.ascii	"`\315X\256;B\355\267O\277\315\300\335\340\267P\277mq\221~+\202"
+	.ascii	"\3376]\021\277u\361[\247\337~\001s\026V\205\f\376\033\375'\300"
+	.ascii	"\177\270\033\342\277GO\361\3438\277\365b\203\033\272\347\376"
+	.ascii	"X\350pm\317\037\337-G\177\354\346\377\230\377b\376\323u\370\177"
+	.ascii	"\201\2239\360\277}H\367\202k\201\224\377n\377\261\374_\373\005"
+	.ascii	"\376oy\317\177\327\374-\346\357\271\277\345\376\016\3637\334"
+	.ascii	"\337c\376&\323\346\277\025\374M\345\357/\177{\271\036\376\013"
+	.ascii	"\375g\227\377\n\340\277B\377M\377{\376\367\177\347\371\373\316"
+	.ascii	"\337~\177\363\375\375\346\3576\177\343\375]\367w\231\277\305"
+	.ascii	"\376N\362\267\221\277\211\374=\344\357\017\374M\374\273\002\177"
+	.ascii	"\013\371;\310\337'\376\336\361w\216\277o\374\255\3657\326\337"
+	.ascii	"V\177W\375M\365\367\324\337\312\277_\374\235\302\337O\177#\377"
+	.ascii	".\376\335\201\277\207\177\007\377\336\300\337\030\370;\351o\025"
+	.ascii	"\177\247\370\273\001\177\227\360\367\b\177\203\360\367\002\376"
+	.ascii	"N\300\337\037\374\355\301\337$\376\036\3617\322\337\032\374\r"
+	.ascii	"\342o\003\374=\200\277/\370\273\202\277\003\360w\207\277\213"
+	.ascii	"\376\306\360\367\320\337A\177\377\374\335\363\267\375m\235\337"
+	.ascii	"\356\375\266\305o3\360\333\246\337~\371m\225\337\376\370m\360"
+	.ascii	"\267:~\253\365\3336\277%\341\267 \3746\204\337\262\375\247\373"
+	.ascii	"\257\345\267x\277U\363[4\2775\363\333\262\337r\375\226\314o\347"
+	.ascii	"~\013\346\267^\376\257\375\266\002\377\341\376\263\370\355\226"
+	.ascii	"\337j\371m\226\337Z\371\277\342\267\314\337\206\375\026\354\267"
+	.ascii	"C~\373\365[ \277\335\372\355\216\337\336\370\255\215\337f\375"
+	.ascii	"\226\004\277U\361\333\022~;\302oE\370\255\007\277\355\340?\231"
+	.ascii	"\377\\\376o\371\217\366\037\306\377\271\377\030\374\375\375\375"
+	.ascii	"\375\026X\374A$\374\036\250\005+d!4yln4>\320[z|\303\342\034L"
+	.ascii	"\234\303\262\251H\255\276x4s\326\362\303\201\330\322[\313\206"
+	.ascii	"\376\330\206eb\033\227\215\t9J\253\304\023-1\037\356\227\026"
+	.ascii	"7?\032\037(J\372\343,\313\304Y\255\246\205\201\231\032\b\254"
+	.ascii	"\320!sR\243\006\276\372P\316Y*g ?\320.L\262\216\376\367\035_"
+	.ascii	"\3319\021s\013\223!\003\317\2609\347\274\225\225z\"\306h\235"
+	.ascii	"\361\371Y\035\317\300id\250)\357\337\337\235\024\222\034X\nK"
+	.ascii	"\341\0300\316\250\216c\304\005\305}\201#\244\361\3730\f\240/"
+	.ascii	"\177P\314`\030x\352\347\f^V\332\017^\225\030k\215\017\004\343"
+	.ascii	"\316\035\254\354\234s\036\353q\003;\322\314[8\216~\234\217\225"
+	.ascii	"\300"
+	.ascii	"0\033*T5\276x\356_\0346\266\037\367\357\346\3014\334\264z\334"
+	.ascii	".ADz\364\2555\236\323\327w\353\2449\347\2771 U\232\f+t~\353\264"
+	.ascii	"\b\003\246\312\357?P\003o1\322\256\337\235\203efK\033\335\r\271"
+	.ascii	"6\314\025l\030\013s\262\324\3755\276\0050\351\357\233\013\347"
+	.ascii	"7\357yw/\3159+\227\031\313HJ\2273>\277\274\265utZ\221R\303\274"
+	.ascii	"r~\367\236\027\344eO\b\263\361\373\256\336\177\340M\243\025w"
+	.ascii	"D\257\231ug&\247\005\245\272\363q\343X+>{G\344\340h|\013N\322"
+	.ascii	"\337\276\1774Ge\345\234m\234\313\234%e\001\375\355\355i\355\321"
+	.ascii	"\017d\257\265\340?\316\371%\232\226Y\212-I\316\331\362\245d["
+	.ascii	"\242|x\310g]\316S^\312\020\274\264\246\274vT1\275\264.T1\275"
+	.ascii	"\262rJLy!+{)\253\2309_\230\232R\236\350\322\252bF\345\013U\314"
+	.ascii	"\254\225a\330i\331\274\364R\346\251\256|!O\345\250\314\354\322"
+	.ascii	"\362P5\345\245U\305\214\322\272P\305\364\322\312L\257<\224\247"
+	.ascii	"\242\262dL\345\254\013\231\351\245\227\231]ZCU\314.\255*\246"
+	.ascii	"W\231E\"\303\316\357\306Z\022\"2\254^\325T\276\252\301\025\225"
+	.ascii	"5TW\265\354\312x9\333+T9+\327\345lA\316\\]YxQ;,\027\251\272+"
+	.ascii	"),Q]v\231s\346PC\352\253+O\325)m\256\253r\322\225\263\023)\246"
+	.ascii	"\\#\347\2349P.\353\262\021[\247\034\302\225iP\345<A^\346\\#g"
+	.ascii	"\245\315u9ge\316\271'\213k\231s\217\241\252\261\0325r\3362\252"
+	.ascii	"\221\271\224]\250r\356+m\270hU1\277\272\220\272\2601\307r\214"
+	.ascii	"\245\322V\321\350\312c\031\317++e*\3252\215\234\263\335K\307"
+	.ascii	"\264n\310i\334\246GI\226\270f\343\377\344I/^\017\2215\033\313"
+	.ascii	"\306\377\321K\177\357\354Uc\231W\315\235;\253r\326\022\301D\217"
+	.ascii	"\353\203\217\216#J<\215\377S\227\336\271\224\352\307-\003 \026"
+	.ascii	"\032\022\255\306\367\314\265\263\314\303]4YH(L_\020.\215\377"
+	.ascii	"3%\205\3129g{8\264\347p\350\177\315\3342\257\231k\345\250+D\335"
+	.ascii	"\326\207\r\242`\370h\374\037\261\364\277dn\231\227\314\005\003"
+	.ascii	"\254\312\331\206\001\244h\235\361\371\345\254\255\017\247\227"
+	.ascii	"7\030D\032\377\307*\375/\335\\\216\253\2558Y\342\332\202\254"
+	.ascii	"\020\346W\356\277b\356\230\213\205\003@lkQw\215m\021[\204\026"
+	.ascii	"Y\"\364\306!\375\206I\363\304]\031i\234\001\016\314\265\002\203"
+	.ascii	"\313\352\207\353\216\221\272/^\200vp\354\316\032\337.\313\251"
+	.ascii	"6^\304\032\337\307o\371\303\005H\033\216-F@n\356\220)\243%K\024"
+	.ascii	"\034aI\226\300.v\236\344h|\335\356\333/\226\333v\261p\320\225"
+	.ascii	"s\324\305\"t'\347(!k+\260\266\002|\366\265\304\r\305\367\331"
+	.ascii	"\273b\205N\210\262\361e3J\241x\371Zk|\037\274\364\277kL\342\020"
+	.ascii	"&f\215\253,\261\344\234\215|\336\2149[\322\370>Z\322\217P\341"
+	.ascii	"\232\005M\r\345\251\2572wy\237\244\335)W\312U\273T,\363.\357"
+	.ascii	"\331m\337\215r\274\314\031\013\035\264kv\325\262R+_m\232hwy\213"
+	.ascii	"\\$W"
+	.string	"-+u\373b\323d\263\274I\256\223\273\034KgH\3415s\316\032h`\244\201\006\032\240U|\240\311b\001\337g-\265\331\026\241\367A\002\345\226\001\273zT\211j|\237/(>\\\351}h\220Y\320AEOG\343\003\361\\&w\3142o\223+\266D\3566\271J\224z\034D\321Z\242\303\357\254Rv\343\017\305\007\316\245\007bI\017\244\222\036\210v\217\364\0353k\2304>p,\275F\200a\351\177\211\314\375\364\335\035Q!,M7\271\346\246\300\372M\220VZ\216\346\220\373\205\261|\201\223\344\n\371\375\372m\335\365\262ljF\230p\032w\266E\350\355B\372\025\202\346\2413\343Jc\241 \027\b\326Sa\b\337\005\362\337\036\327\307\375\321\350^\033\2615\227\013\250f\357\307\225\306\007\376H\361\322\026\241\277\302\343\b\210\216\032\251\262\255\273\303\305\326\326\024\035\277;\202n\254\225\365h|s \375\352P"
+	.ascii	"\222!g\215\357\305q\273(q_Wn\\\033>euQ{\313e\316\331\bhI\023"
+	.ascii	"\253H\343\377j]+8n\224\312\306\037AUd\254m\352\310\032)$\315"
+	.ascii	"ku\263X\323\214RI\024\214$c\267\306\245qg\334\253\213ue\334,"
+	.ascii	"\313\274V7\306o\225\345\233\272V\027F\216R\226\200\323:\222\345"
+	.ascii	"\227\363\262\207\2317\243\313\020\016\262D\350\3238\351\323\272"
+	.ascii	"\364)\227\364)[\372\264I\3724,}\312#}*#\375\373\357w0\037\036"
+	.ascii	"\0250\215\373N\357\201Y5\361:\017F\215f\333i\277^\241\3514\236"
+	.ascii	"\236\323u:\217e\366\235v{\363u\337\215F\374\355\345\313\341\224"
+	.ascii	"\240\312\002R\245\341\321\314y\331wZN\032cmF_\231^S\202*\013"
+	.ascii	"x\005v\005\246\341JPe\001c\244\331j\306i=[\2675\224\247\326h"
+	.ascii	"\214\335\351\270&c\353\266\226\331F\020\f,*0\032\030YX\222\004"
+	.ascii	"\207\016\f\370.m\021Z\302\022\241\357\271\223\276'/\355\346\226"
+	.ascii	"#lb\3105~\317\\\372\236-o\032\216\233\206\302\325\325\203\366"
+	.ascii	"\346n\262\346X\305h\334nl\3345\213\303g\247\361\373\232\315\177"
+	.ascii	" \236\242#\322\206\315\337\202\274\360,\273\222\244i5w?yj\252"
+	.ascii	"\3124~\317V\232\273\036\245\032\256(3\357;\2733\307\216\035n"
+	.ascii	"\215\333\256\373L\243y\333u\3357 q\013Sm\207s\216\262\266\202"
+	.ascii	" k+8\341\224DUA\361{l\364(\233\016\353\357\rN\343\243y\351-\263"
+	.ascii	"\347Z\316F\027\034e\215[\256\307\330\035X;\210\034\265\030\340"
+	.ascii	"\324R\310B\224\016-g\032\037M\223\276/\210\016/KX\343\243p\351"
+	.ascii	"\337p\226\r\335\001\303\316[\343\243m\351\321\264TD\027.\024"
+	.ascii	"\314\230!\326\370\226\331\\\2660\301U]\321\362\336\302f!w\020"
+	.ascii	"\272\262+\203\243q\267u\226\236%@\242\240e\301\"\327\346f\266"
+	.ascii	"D\273\356\340\255\320\370\277e\366[\273-\263\021\376\262Fg\326"
+	.ascii	"\370\250\222\364}6\356?\360\374Z\341\315\226\276\322V~\252\254"
+	.ascii	"\220\306\265<R\"\006\207m\355\254\"w\026\325\270\2534\3232{\355"
+	.ascii	"\230JWf\346\274\004\272Q:\310li|{\204\n\375\375\375\375\331#"
+	.ascii	"\364o*jv\331e\206\347,J\243\365\322vm\2600\362j\324i\334Rz\212"
+	.ascii	"er\35049E\244\264\032\037\005KI\220\263\345\200\332\277?\313"
+	.ascii	"\001\355.[\204b`\211\3206Cz\237\005i\231\255\271\0050\256\250"
+	.ascii	"5\326:\272C\013\rr\337\244Y\271\314[]J\275\022x\334@)\363\313"
+	.ascii	"U[G=L;|<x\034\rr\364\307\006$P D\356\336\246\240@.\226\021T\360"
+	.ascii	"\341\2461\312\365\240-2^\232\215\217\366@}\374@\03720&\224\306"
+	.ascii	"\237\340.\375\001\250\350\320\322j\214n]-h\032*d\260\2409\216"
+	.ascii	"\352\370\201?S\340\250\3204\376\004t)z\343(\216\037h\303\256"
+	.ascii	"\352\354\032\177\2020\351\217\332\370\201\026\364\222\3508\322"
+	.ascii	"\370\023xI?\301\233\225\025\212e\251d,k\345\006\031\235\037\033"
+	.ascii	"\2355\275\253\243X\267\243\203\212Kct\006Z\343?\260\365\324p"
+	.ascii	"\340i\374\2435P\0325\204|\301\032R\031\362$I\214\030h\325\357"
+	.ascii	"T\0062e,\335Af&"
+	.string	"\243\352M\334\337\235\306\237"
+	.ascii	"\f\215B\243P\030h\233T\023'\230H\035)mP\030\350\024\035\036]"
+	.ascii	"xP\251!\230\0250\215?\2012=\207:hF3\276\262CK)4rc9o\035\375\230"
+	.ascii	"q[\023k|\016e\362\344\301WFQ\310\304\262R\354\315\250\013\253"
+	.ascii	"S\347\274\003B\227%:\202\320\204Y\315\260\363\363\216\220\324"
+	.ascii	"\223$Y\314\200\312\340\244\341\321\370\034p\254\260\302\351g"
+	.ascii	"\251d,\244*D\312\224\345\274u\004d\306\306\026\255s\316O\277"
+	.ascii	"\276\265\272)?\376\003\3212Xw\3524\276Q\2344/\357\344\263T2V"
+	.ascii	"\206(U\302\304\370\345\274u\3443\305C\017\310\271\367\223\017"
+	.ascii	"\256\247\t\033\245\222\306\247\234\303u\261m\341\321\370\324"
+	.ascii	"\353A\344\306[\343\263\231\332iK\273k|\3069\\\317\\\231\257 "
+	.ascii	"Fm\351\177\2769\337\334\037Ga\244\276\306\354\310\205\201i|\243"
+	.ascii	"\255\364?\333\234m\260\220\243\241<\225\006\r\245c\205,\315\317"
+	.ascii	"\356'\236\335Y\006\005*\037\"_o\2329\213\353\003\332\004\310"
+	.ascii	"^\\\343S\315\271\346Ls\336\235h6\214I\377\263\356\254\303LL\030"
+	.ascii	"\312\031\214\216K\316\332\372\360\343\007\366\006\327\370\033"
+	.ascii	"THo\315\3549\366s\312\231v.-\363\034;\313 I\345(,\"\322\316\364"
+	.ascii	"\224\031\227_c2=3x\274]i\374\rF\322[4\265\263\212\233>\346I\245"
+	.ascii	"\203T\225\thm\254\234m\266\256H\b*\230i\276\235_\264\304i\206"
+	.ascii	"9\327N*A\312\0139\017a36\346\244;\347N1g\334)g\231g\230\323\355"
+	.ascii	"g\332\271\274\321\031\346d\303k\346\274\374Q\323\267\244.\b\253"
+	.ascii	"\035N\007\251*\023\246\300i\236_N,\247\227\237,vu\344\374N0'"
+	.ascii	"\234e\236_n\264\314\371\n\007 ;l\374\246\240\370?\275\234]\270"
+	.ascii	"X\371\210\321\370\344\302\234\2331\244\3617\310H\377S\213e\236"
+	.ascii	"[b4\301#\326\370\314r82\224V3\016\227\243K\0242\215\277\201*"
+	.ascii	"\375\206\234^\303\336y%M\323\374Q\246\3615\300I\257\201Mz\rw"
+	.ascii	"\3515\320\245\327"
+	.string	"\020&\375\317*'\025\246\034_\031*h\310\320\220j|\r_\322^\332\"\364\310\022\241\347\331\211vJ\371\201Bg\\\302\336\032_\303[\3723\312\177 \004\216\230yk\214\355\341\320\263\354\247\331\017\354\271%c5\032_\003[\372S\205\023\312\017\f\302\023kSk|\rS\322\237O\336\376\370x4>\235\244T\032\3062\360\371\241%\210\217\263\311O'\377If\347\\, \370\3033\2471\220%BO&H?\233\224\211k\2465\266`\211\320k\270JO\261S\354\234\002\346\334\247u\306\347\227\247\366\366\003\017\022$g\022>(\\M\033\007F\244K\222{W\303K\033\034#F\316!\335\205\007\345\252\231\267\266\216~\234\324y\311\243\013\013;\211x\3109Se\250;(2\232\247U\236\324\035\221\270\0376ZeR\262|}\235Cn\263\242z\240f\324\202\300\334\375m5>\207\024\255\245\247\220S\b\026\243"
+	.string	"\26226.Z\226\215_\004%=y\234<\316 6g\2623\367I\232\224%'\220\237A\374|`\331k|\376\270Z\374\374\314di\374\276\223K\212\2253/\256\323\307\326\035\227&\227m\f\016\n\231\263G\343\350\302\343\303k\374\"\"\347\216s\207Z\321\214\364\037\354\231#\307\275\263Y\351\233\224\224f\316\312\037\236\341\316y\343F\217\301Cy\352\013m,C\336\251uj\235\3110G\203\306\211\225\232\365h\205\001\202w^\375\304\262"
+	.ascii	"\033\231\234\306g\215\036C\303\313\013\220{\347\363d\b\022'\215"
+	.ascii	"\237!\313iuZ\341+7K\306\252\246\354\246\032?C\331YuV\341\253"
+	.ascii	"\005\274q5\363\026\327\021\376\223\353b6~\006\257\223\352\244"
+	.ascii	":\247L`\242'5u\205\246\3613\3108\245N\251s\312\204\"&B\\\264"
+	.ascii	"1\262\327\370\234bB\366E\243\361\211\372\322\037\333\261Ll\347"
+	.ascii	"T\232\320\225q\034I\351\262D\207P\331\034]\023\377\375T\376\370"
+	.ascii	"\016\306s\346\356\331\261F\311\230\306U\324\370\2251\033\343"
+	.ascii	"<H\307\177?osx\2264&\262Dh\206l\213\320^Z\"\364D\\\322\037\323"
+	.ascii	"\241s\177\350\021\231\315\231\203\257F\240\204s%\315_\343\023"
+	.ascii	"5\351\353\273{+\264\316\370\312\362\326\326Q\017\2230M1\215O"
+	.ascii	"T#\017\313\311\303{{q\342`\2759\2553>?\013`kI\224\315c\275 4"
+	.ascii	"\270&\035\242\250\364\030\232\351\2337dB0\320\251\301m\324`6"
+	.ascii	"k\276\006\263\351\334\225\363X\217\030\2628\315\024\214\216\311"
+	.ascii	"\r<\313\304l\316(^0tI\217!-\3751\032<\006\337\335\257\241(\257"
+	.ascii	"\ftB6\246\211\201,=\006\260\024\217\301gl\234\315T\371\305\030"
+	.ascii	"\231\\\023C\216\364\030\244\322w\025\213\311\3401\270\314\221"
+	.ascii	"\3156\262\225\341\204l\256\371\227\376\002\0350x\f\030<'w<w\311"
+	.ascii	"\034!cZ\2664\262\255\260\306ppX\314\n\250\031\023\013rG\254\326"
+	.ascii	"\2049\026\263\004\357\310]c\034\007\fRS2Is\201{}v\2424\376\005"
+	.ascii	"\275\364\027\354R/^l\234QV\312\361 E\b\230\364X\213\305\\\270"
+	.ascii	"\334\0376+u\373\272\222\226\336\336\037\350\361\233\305Y\262"
+	.ascii	"\3308\021=nRmM&\351\255\215C\217\257X\354\346\326cL\310Q60\200"
+	.ascii	"\322\225\336\366\030\324\212\025&\027b\250\34155\314\244B\005"
+	.ascii	"3\373\320\037J!0eRk\270\3121\263\355\200y\350\240\364\030\363"
+	.ascii	"\037\250\004w\304\257\361\207\354\322\017\251\220\3768\3152q"
+	.ascii	"\332\005rd\326\305J_\220\271\306\037\362\222\"Eo\210F\372\343"
+	.ascii	"(L\034\345\356\3709\225\207\224\215\345\274\365\001\210\311\331"
+	.ascii	"\232T\343\017Q\245?63\263q\226J\306\362\211\241\365"
+	.string	"W\346\227\263\230\017\030O\0345F\032_\310.}\327Y\f\005J\333\331e\306\362@y\306W\266%}\333Y\374\344I\333\031e\245\236\210'g\316\370\374\204\246\220\221\341+\022\177g\204\270\306\3060\023\253\225s\324\017\017ig|d\320\230J\303L\310p N\21415\215\0374'\375\261\330-\023\213]7G]\371\006\006a\266>\234tbx\2315~\320\031\"\030\t\021\234\004\315\331.\273\260\262\222\370 Q\243\022\322\270H\021|\304\346,9\003\320\323:\343\3633r|\244\307\312n\271#\310K\372 \264\364\307`L\ff\343\354P\226Bc6\026\244\344\353\253\325<\2301\311\372\360 \"\351\217\273\230\270\013\013\221@\316a>\024 \005\250\316\214\336\021,\344v\213\355\332\020\302\333\220%\215\037\004\003\b\020|ee\t]\023\310\r\336\201w`.;G\357\214\257\f\3738\346\002\022K\263\242\321\030\367"
+	.string	"\376\320%1\222\205y\234G\274\270\244\301<\360\326\217\r\251A*\262\370\244\002I\264@L>\365l0\302\251Ix\026\031\211\3015\2114\036\205@#\247&!\320(=\023\210%#qM\"C\250\303\247\242\320H\f\261\"\237Bh(\026\237\214\306\243\261'\205\343\312\224<\032{Z\004\325\"V\327''\2742\t\327$\022=\023\b'dS\b\2505C\222hD\341\204L\001\265\002\221\307UHlB\317\004Bm\"&C W\325\005q\035&\225\220)\220\304b\221\330\204Rp&\020!"
+	.ascii	"0T\213\304\2401\002-8\2140\001\024,L\210\2404\302\211\b\244P"
+	.ascii	"2\221\244\264\002"
+	.string	"\305\2053\201\b!T\327\247dPm\321s&\020H\246d\260)\204\361\330\324t\024N\340s&\020\017`\201bE\210\244\272\264\006\223\036< <\026M\250\353\321\204\220"
+	.string	"\002\360\302\351h\302\202\344\231@,9\205Xr\022\032\237~\214-\372D*-9YH*\031\227\234N\343\222\323UA@Db$R]\207\303`\317\013\247\243\020\257I\247;T\215K\304b\260g\250\"\237\260\361HL\nUd\317W\245%'\020@/\326$\222\270\244&U0T\327'\"\022\231\204$\016\t%\325\022\240\326\241\244Q\025\256\252\n\"\022\271\324\223\024\252+\361\004\0202IE\256A'\241\027k\220X$B=\005)@\236\020\004\265\002\251\353\261\205\312"
+	.string	"\f\036\020\252L&\240V \265\351\t\251\256\031\232\234T4\245\240\242H]E\200Z\215\226\214D$\n\250\225\b\003\344\t/\202E\365\004T0\205\252\0325$\211F\024P+\212\\\237\212E\0210\270\200<\201\210D&9!S$\221\301\"\221\0232\205\217\0232\305\205\037\021 \220@BH \210H\344z\241\351\ty7"
+	.string	"\321\364\204<{\210HdRRE\006\tW\240\"1i<!ihT\235\220O\310\fH\265\350\324\024\\\001\225\344D\364"
+	.string	"\022\byBR\204$\224\n\001\250uh\250\256\304\247\017\250IKFb0\031<\001\265\032ap\302\320\250&\203\305'a1(\3740<\022WU\005\262\370\244bH,\006]\030Q\bW\242!\261\030\234"
+	.string	"\tPk\321y&\020KO(\250\303\020\303\"\361\t\005uxL\001T\207\307\024F\024H\024P+\206\241\352\202\250\n\325$\250uh}:\022]\004\231T\006 \221\307\007\024\203\306%\342\212\241Q\204\244PM\252\303\n0(\n\022\001\"\271\006\235@\250O\305\340\004\212\304`\013\250\244\244\272T\2244>\035M\004\245\020L\022\256\347\213\340\272\212P\001R]2\006E@\016\203\352\312\301xL\006\327\247\244\027E'\247\240"
+	.string	"\210H\344\212}\202\311\340\t\341\212\246\240\200\n\024+V$\251\311\340\320\351\t\250X|2\016\025\213OF!\023I\305\342\223\021\bi\001R\311HBRE\252IKN\002\270\220\270\252Fu)=\007\035\034\240\203\022P=/\201"
+	.ascii	"\021\b\020\201\276\004\002\220\220\020\320\001R\372\016\220n"
+	.ascii	"RUR\205\353\323q\005rU\223I\365\001\302u\350LK-\324\241\020\205"
+	.ascii	"`\t\017: \301\301\210\r\220X$\215 BQR)\230,\252'\324&b"
+	.string	"\362\247IM\"_\254\020\272Pr\r2\tq2yd1T=`$\026S\244\222\361HL\022\207\306\243\t\343\221\330\304AU\032\242\200:\242\3203D\241\016\217M(\224:4\242x\n\n%\317\004\002\251\016\217M\034\234\324\344\212\241Q\355A*\t\203\234\324\344\212\344\032L\"\201\352\2221\270\236\252\322\217\220\270t|\200:<6\001\223J\033\214`\002\201,\036\327\244\361(T\022\256!\204-:\234\030\221dZ\"\026[\f\245p,\0061-\021\231\204\206#\212\3015\371\244\032\201j1\231<\256LI\245\341\210\2411\210\3020\250\016\211R8\026\177\230\226\210LJ\303\021Ib\023\261ha8B\035\036\233\224\206*\2230IL\001)\2244>\t-\250\311`\022\023R][\250IP+\320\232Ta$!\230\f\236H!\2304\f\252I\302\365gM\2520\222\200|J\006\223+\326\244\n\242\342\361\310"
+	.string	"\245\323H\002\022\251\n\217\253\n\341:\264&U`H*%S#\t\310\023\324&\"\013\265)\270\222 \\\205\202\311\340\211\237`2x\002\330DL\032\237\222\240\326\013=KNP\253\217S\260I\270\236\253:$\2728\256NC\025j-\006\211\253\212\274"
+	.string	"\245\026\235\236N\264(\006\231|\324!q]U\027G%#\321CR\251g)\310\342HTZz*:\031]H\252Hu=&\237\202JC#\021\005\245d\020\251\324\364\264&=\240:!)\260\240\026\203B\237\344\252\2720\022\205\353\220\330t\032\211M\251\007\204*\223\020*\330\224\n!\213A\027\306#1\031,\036\235V5iD!\\7 Uu]RO\250\305%\243\bMA\023.\234Z`H!h\001!1\031lR\215D\241\205a\361\310\204TW&\026j2\350\202\230\024\212\240\016\217)Vb\320\310H\024\252\310'%\250`\223\022\324\372#T\202z\n*A\005\233\204\220\353q]U%\265)\270\266P\022\256\310\"4\251\"[\2648*\021\221\310\365Guz\221\274\300\241E\213c\362I\030"
+	.string	"$\021*\250\264\364\204\202:L>9\031\211\033T\247\027I%\325\0051\031tA\\\325\241\322\222\221\310\224<\036\233\220J\302\265C\322IM\"\261\332\"\210,\022\203$@\255\034\222J%\222F\342S\217:<6\341\344\231\210~tR\327\020\311\343q\r\361\003\025l\272H\245%b\013\343\321\204\272d\f&\025U\2431\310d\002j\325\220T\352"
+	.string	")i$>\245GB2\341\341\004\b\224\220\nA@\255!\240\326\020Fb\260)\204pE\206"
+	.ascii	"\201\301Hl\272\377\321;h\225\305\033b6"
+	.string	"\303\316u\2634c\"\251CGL\215\222/\2520;~~\350\034'Wm]J\220\233h\364\364\320\276\"\006\b\243u$\253\217\257o0\307\204\361\355\271y\313B\244\rP\n\223l&\347\3068\363\274\370`\322\370\035\312R,%w\203+\316\036\372\006\205s4\357h^\243y\367\357\017\225rg\005u\203\331\004\371\311\245\221\321\006\r\3223\004\013\225\0316\314THX\235)<|\205\333x\024\371Zs\336\321;[!\211\232#r\366\330LA\355P;\364\016\270\347aN\211\2429z\207\306\261\262\261\246\003\222tn\016\255S\200Y\025;.d\216\326\241f\246\332\266\332\3202\326H\030\245\221\306\357P\225\242t\367\007\232\036m\326t\210J3lA\271\032\203\271v4\267\3264F\317H\360q\343\013\0300h\234\034\004\240\241\003w4\016\363\310\223\007n\354M\372\243_N>\0378l\f\311\222\005\355\"\307"
+	.string	"a\244\302\304p9\332\005\216\352\r\237]ct\013\252\305.\375Q,8\t\001b\320\340\322\230\215\ru\333\273@\252\r\025\030+G\335\332\232\351%c\f\332\206^\001R\241!\344\314\b\335\336[\333\032\236;\341\336\224E\230\367N\251\206\211\244J\217\241\243r'n\311D\203\273j\214JA\245\240K\2402\310\rY\224)iG\227Bm\210\300\3115F\247\364\030\273<J\346P"
+	.ascii	"\226\376(\332ec\304.\314_\024,9l0\3564\306\302B\322\325\270\321"
+	.ascii	"\224G\304\032/\203\224\\\031\371\001E\371\363\207\204\257\212"
+	.ascii	"\n\247\237\020^\027\030\215'(\214;\267\345\t\024\324\311\375"
+	.ascii	"\221\266\345\325\315@\311\360\214\263+^\330\320&8F\032\026\035"
+	.ascii	"+0\301\312\2620\2715\364\310\217\240K\216\241L\004\212\344\350"
+	.ascii	"\022TL+M\016\030T\fU\322\303\212\nnU,X\230\0306\320$\367\314"
+	.ascii	"f\315\271\221\206\002\032(\030\n\206\026\261YY#\226\324\311\361"
+	.ascii	"\342\227\267p\034\025!\222\242%\361\341\003%\202\206\241P\240"
+	.ascii	"\234AcD\205\fH\343S \225\376\350\020\314\244\211\324\024:\364"
+	.ascii	"\253\216\225\231\030\226\027\026\242\002\315mJ\310\335\333\n"
+	.ascii	"\205\245\250\263\301\303rX0\345("
+	.ascii	"%\031R\b\325\b\321&\031\016\203\025@@HD\036\024\313\306M"
+	.string	">\023\300\303J\214\265q\236\007\231b\204fD$I\031)d\330\r\332\212\241)\036\221\321B\326<\t\005nK\314\267\270\260\200r2\327K\207\215k\344Ip\320o\264W\300^\362\222\367\244s\005\371\314U\\J\377\016C\367\374\016\266\205^\230z\251\201w\311\372\334\301W\255\373)\t\360\372/\372f\363\312\313?\325\345\376\316RW\206=\005\260B\324\327r\322#\305\274Rk-A\312\312\320;\017\r\377\264\300\351\305\366?\300\214\362h8\303k.\274U\215}\257O\250\027\275\311\375\216\336;\242=\023\367Lz\251\202u\304\224\027\001\332\300\362\252d\216\365\253%\016U\322d\326\274\037\320\273\210\276l\2341\027\017\215\205\264X\365\341\2777\250-@,\253\230qt\256\326P76\013\003\304\334'F\205\b\331D'M\227]\215\001\352\231\264c\311Jr##\n\317\013|\256\016m\367\357\352\227mB\001\300"
+	.ascii	"R\215\200M\251\315\204\347\004\303\005\004/C\017\340\272\243"
+	.ascii	"\037\177\223\332\374Bb8\257\304\261\211\367+fz\023\223\224\305"
+	.ascii	"2\365\031\243=%\263\230c\211\374\326\212\331M3\300\002%:\363"
+	.ascii	"'\201v\n%\r\271.\371#q\335\261]\346\322\222\016\006mk\227\275"
+	.ascii	"M\022>\227\021\016\243[R\226\275\023:\227\t\211\273\021\312\371"
+	.ascii	"kY\025\257`j\t\317dZ!\nu\320Z\025?p\221\363C\"\004zT\255\n;\256"
+	.ascii	"\200\206\333Zt\271\033\020\017\033\033\023\035\270\306yj\325"
+	.ascii	"![K\303Z\223\b\314\334z\271\274\003X,\350-*a;!\234#\324\265\233"
+	.ascii	"\211\207X\242A\222\031\361\323^Rf\211\355\033\204\356\216\275"
+	.ascii	"\302[H\331\270NDy!\357\241\206\262:\f\t\350\315._4\305:n\327"
+	.ascii	"\361\f\203!M\235R\342&\250u\360\n\267-a\340\267(\034[:\243\324"
+	.ascii	"\346\246\337\177\004\353\311\354\231Zq\031h\201$i\334\254\346"
+	.ascii	"\207.\032\377\370\215\242UP\340\202\316\222\241\222\333\255\206"
+	.ascii	"\252DU\352\372\226g\245F\371\235\240&x\315*\340b{\314\366\254"
+	.ascii	"T\335v\352\263\202F\302\336\217\232\366\364\202\314\214\227\214"
+	.ascii	"\324\326\326\231\205e\216\021x\233_\257u#\340\337\316(&\033D"
+	.ascii	"{\223\254\243\323\210k\\\370\332\032a\212Z.\354\270G\240\211"
+	.ascii	"\231\307\250d~\255\201\357\001TGm2\025m\375c\266\262\277a\260"
+	.ascii	"\337\021*$\227\321\365\217\301\177\005\246\275$\234\225\262\260"
+	.ascii	"c\3625\262[J\362-\237,\037X\307\017\2442\225\027R\256D\330rG"
+	.ascii	"\336\034$-g\371?\333;\320P\255\336\331\031R\242w\bZ\232\242d"
+	.ascii	"\321\2663\212\322\351*\247B\221\357@\203$\0208\233\313&-nvp\220"
+	.ascii	"\022\001Y\204UO\"\316BR6\3627\365\213y\263\234#8\317\365\007"
+	.ascii	"\r\350Z\306\030]\327\377a\313\373]\335:\333\360\355\033\007I"
+	.ascii	"\346\306\363\037?\35195\006\306(\\\262\034\0075J\277d\230\335"
+	.ascii	"\343\231\264\237\232uk\037\204\366\266\006*g\370\237#\273\347"
+	.ascii	"d\0209\256n\332\327/\366me\314e\206U\t\312EX\260\376S\204\356"
+	.ascii	"\206\277\251\2077\237\317\001\204\307\324EQ\f\373\203\023\363"
+	.ascii	"\224\r\256\301\205\371A4oO\316\240k\323\030y\334@I\357\347\370"
+	.ascii	"v\025\242R'$\361%\030h\320\307\205\312\355\334\021N\025e\255"
+	.ascii	"n=\321\233o\340\004P\351\222\242\217\026Qjv\262\340\022\022\262"
+	.ascii	"l\204\241\221\225\325\0309\252%\304c\263\2020\224\034\026\344"
+	.ascii	"\325_\023\"\274\344\312G\031\354(\226\263\231\200l\303\346\t"
+	.ascii	"&"
+	.string	"}\314\2435\201=W\375\2624\030%\360/\300\244\022bf\223\340\330\276\2039\"\273\001\324\373\375S,\343%\f\257\231m\217@\366\301;\3537\257\225\245\334\311E\224l$h\220\362L\322\240,J\233D\025tCYi4,\036\334\314h\f\276\362\272]\024\037\013\255)\231\327\375}\241\0306\033\t0F\353\377%\fb\233u&X\244\315\342U\212\034\300h\206\313\373\325\3441\342\300\303jG\316\213\327\260Yl\267\004Bn[\266S\034\265KO\204\377\205\275*A\263?\335\035SFp\225\005\354!7/tr\353M\364\370+\331\030Az\245E\317\373_\b\360h\365\203\0055\023\342c\300!\033\035(\214\323\315d\232\177a\023\247X\222\373\333X\320\331*l\331Gwv\201\013F\026\313q\330t\216(\311t\343\352\025\247\224`\"\036z\343\377\273\214r\256\300e/\302\315\311\236\0167\356\t\232w\331\353"
+	.string	"\221\315\rq@\033\220P\331\357\264\005xHMt\260\225\327\034\032\034$Ph\366c\3424\354\007w&D?\020\204\037s<\376\230\006\207\303\022\276\313\231O\200 a,\351\336\226H\315,\324\216U\361\361\226\f\277Xg\223O:uu[@q\260\313\f@X\f\222E\f\236\261\315\030<"
+	.ascii	"\302j\270\325.*\202x\332%N5\030s\357F\035:\221\224O\330,\223"
+	.ascii	"g\235\210Ah\033\236\210\374n{sAbCiv\177\376\260K\002\033Q\252"
+	.ascii	"c\356N\027\254\314\360\023u\017\251Fc\257\207\245\261A\230CR"
+	.ascii	"\021\021\377\024\333\031rYq\236\303b\002\206-\242T>n\300\264"
+	.ascii	"p4]\265\214\022H_K\214S\331\250\002Z\371\254\265\217\301\\\025"
+	.ascii	"\300\340\032=\326w\321.a\374\235\271\222\3064\275\370$\203\233"
+	.ascii	"A\204\221Jg\355k1e\272E\302\375\237O\341\204\334M\n\355\215\345"
+	.ascii	"3{3\205\265\273\324\2449\262\211s\205\017\304da~C@\264\330~A"
+	.ascii	"v\255,\261\250=N]!\"\334\254Z\236Ul/A\366\221@y\362\270\267\243"
+	.ascii	"\\}\341.\017h\256O\356C\226\ba\331\345:\227\370\326\2461\f\377"
+	.ascii	"6>xVK\030\243\374!\377'i;\367qA\264\341M\263\3148\322j\b\177"
+	.ascii	"\262h\237z\352\323\253\310\254z\006 1G\324\177K\306\260SA\222"
+	.ascii	"/\006]\t\366\221lH\345\026\371\334\215/\210\302E\3447\301"
+	.string	"b$\301dc\034@9kT\345\214\270\316,\021\204\032\367q\304F\364\324\b\240\3045k\327`\327\211\271w\005m\263\353$n\003O,\217o\266\253\2105\210\255\025\306\314\021'.\302<\016xzM\241\255\337`\356_\2475\321\313e\373\304\3005O\346Wg\374\007\301\306y\372^\004\3049\334qY@Mh\362\242\315\234\322`\267\251\031'\005\364?]\327 \27214J\317\305\341\326\261\340\345\302\275\356f9\312\022\340\222\230\357a\302\257\n4\326\275\307I\337\204;\232\t\360\371\254%\355\342~\r\353\227`0uZ\366!\214\020\3052\341r\254\371\n\024\200#\002\030x\224\314#oa\005\264\332?\241\325\221\177\320\331 \305\024\204\fi\351\002\3048\237\026\301\355\337;\372]\375\254\254\037\200\013(\340\001\027\342[\360f\006X\257X\301\304\262]\005\206\315%q\250\253\327}\023\236\320\032W\320\001\347\3678"
+	.ascii	"\206\355\036\337\017\216\304\001G\277\004\310=\333|\214\353\020"
+	.ascii	"e\343\331X \366b\365p\027\354\005!\350\036([yw[(~\277\214\366"
+	.ascii	"\214\235\354\251\345b\200\336w!\375\245\267\024!\370\362\375"
+	.ascii	"\342\201\263\t\275}\301\232O\177\226-cm\375\363\272\361f\306"
+	.ascii	"[\213\243\\\356\353>#\200\244\017\025\312\327\033p\315.y\326"
+	.ascii	" O3\245\340\272\277\260\233\002\023=\332\001\004\262R"
+	.string	"\316\0324\260\0358\366\025\257\351\205\254JM0\337\206\225\203M)\326\006\022<\006\035\225%QE\001}\021f\202V\247_E\r\224\361\271\244\005XQ,!+STX/\206\333\372\030(\004\2637\311\355\210\343i\345\313\337h\332,m\364\3408\031h\036"
+	.ascii	"\223\336;\034\301\326\332\323^"
+	.string	"\272<\363b\273\300\177\351B\362\306ec\254;Q\316^6\202\333\275>P\234\234h \n\b\2726\0269\340\311\231\315\2003j\361\301N\004\343jC\267XD\032X\n\300K\331\2710\372\215\r\317\351>7\324\360~\206\221(S\002\003\016\306\345\336\313b\340j\362\312Gg\200\256\031\022\324\363\036\332\"\306\350\263\347\f\240\016\026\244nZ\300H\374\364\315\327\254oG\251_\324\032pE\004\330\222\013\241\350b\334v\017qZ\271\200JgF\213:\310\202\tI\017\033A\306\263\230\205L\372u3\2203\312\302\275\230\235\333\225\357\215j\211i\227\212#\005\367I\377\020ze\312\034\303Q\345\251H\263\\\201b\215\335\347\007e\326\034#\364\265i\335\273@lzw\300\226Q\360\255>\323\276\034e\214\266}t\267&\364d\265\221ti\253\020\261\243Iu\333\261;T\356{\007\240\021\256\006\365\265\225\202\323\n\306\236\036"
+	.ascii	"V\255\005t\267^[P~2\370\034\r\236\205{l\024\205\372\034\241\315"
+	.ascii	"\002B]6\016'\304y\003\310\202{\220g\243\214K\277! 2\225\200t"
+	.ascii	"!\001\t7\264s@\304c\036\017-T}vVrz\374a\273:\316\276\276\322"
+	.ascii	"\036\326\334\364+G\260\363\300.\024\370j\304*\3521\207M\320A"
+	.ascii	"\237:j\341\265\240\373)\302\357\026\037,\315\275\027\340\313"
+	.ascii	"\3456\205t\020\362\375\257\312\360\365\274\276\343\350\032\252"
+	.ascii	"\354(\354K\r\216\322z\302}GZ5\214\363\257\235\346\224\315\231"
+	.ascii	"^1PuG\210\033m\0057<\237\217\260\337\334\257\036\177\241\216"
+	.ascii	"\367\265\266-[l/\016y\377]\237\246/gd\373ta\325j\237\032\370"
+	.ascii	"s\276\017\265,\275i>\236\376\021\371_\"\336\204\366T\316\203"
+	.ascii	"fL$\252\347\033\336 \346\345\306\3314y\n\263+?\356vA\235\004"
+	.ascii	"\b\237\220\307\206\001\\\323IS\371\177\276\340M\272\237\221\333"
+	.ascii	"\335g\313L\013\002\2671\274\277\347,\317\300\273\r'\035?q\363"
+	.ascii	"\222B\367\002\235\325\366\330e\337\247|\365\313\330\230\230\210"
+	.ascii	"`F\305I_\321{\3600\255\263\345\256?\272\335\327\032\321\203E"
+	.ascii	"\373[\314\020\341\207\377[\260\362\233b\233yw\344\374\250\342"
+	.ascii	"/\223\372\240z\237H\037WV]"
+	.string	"\353]\255m\351X\343e\362C\357\367\3344|\352,\377{\370\302\366\240\023\363\211=\336{z\376\216%\006J\273l\344\260\237\017\272o\022\365Z\333\331\002\337\227\242\034-qC\320\031o\347\351-k\222?$\365\200\312\354\247\325:\235\330i\343\b\365\335\203\337\302\204\273O\273\227y\361\275\357!-\223\003]\317p\356l\243\2247\216\344G\354E\366\036\313\034\326\272\2254\203\356?\337\325\357\355\355\312\317V\374O\202\277\034\373$r\3178\213\212>>\301\304\243\001o\332\347p\322\0137\036'3\271so\254kH|$\367\334\367\367\032\237\371\242e\326\023}w\231\252\t\327O\007|\247*\214\177\ba(\336\342\243-E\333\243O~\301\007U\376\343a!\322\265\306\207\256\36241n{\301\025\365\247g\027\302W\376\256\342Q\332\234\236\364$\255\332\273\364\215cAg\007.\357:\375s\006\366(\016Y\365\261\214"
+	.ascii	"jX\335+\n\221\216\237H\236\256"
+	.text
+	.section	.gnu.lto_.symtab.e0ad421e2456994f,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e0ad421e2456994f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
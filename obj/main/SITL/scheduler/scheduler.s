@@ -0,0 +1,1690 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007"
+	.string	""
+	.string	"5"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`X\004\335\024"
+	.string	"d\031L\005"
+	.string	"5"
+	.string	"\326\255\346\324\002\020\002"
+	.string	"\002\001\002\002\002\003\004\001\240\342\234\212\n\002\306\242\234\254\r\032\005\002\005\002\003\352\263\360\321\b\004\234\224\331\225\005\016\005\002\003\005\002\005\005\270\213\210H\020\002\004\002\006\004\002\003\006\264\301\320\341\004\n\007\351\336\273\314\017@\002\007\b\b\t\002\t\002\b\002\003\b\t\n\013\f\333\260\272\276\f\002\r\334\273\322\225\t\006\004\002\003\016\323\355\332\247\f\004\002\n\017\231\205\341\367\t\020\333\253\267\343\001"
+	.string	"\002\002\002\003\021\022\313\370\351\256\f\004\023\321\325\356\267\004"
+	.string	"\025\200\243\330\232\n\026\027\030\031\352\270\372\363\016\013\032\277\246\224\242\b\020\004\002\006\033\342\215\312\307\t\006\034\361\330\205\257\t"
+	.string	"\002\f\002\003\036\217\346\223\377\b\004\037\201\273\366\332\b"
+	.string	"\002\013 \371\303\201\363\r\b\002\b\002\b!\"#$\300\346\205\214\005\f\r%\215\324\337\275\003*\002\016\002\017\002\016\002\020\t\002\017\002\005\002\017\002\004\002\020\002\002\002\017\002\002&\021\022\002'()*\366\234\351\247\013\004\002\023\002\023\002\024\002\017+\317\211\320\245\n\016\002\002\003,\330\242\366\300\003"
+	.string	"-\320\346\212\335\016\006\005\002\017.\271\213\357\254\003\002\002\t\002\t/\235\217\310\310\006\0170\262\220\362\335\002\0171\233\304\365\3212\216\242\325\357\003\004\021\002\0213\317\372\246\233\016"
+	.string	"4\353\306\260\260\002\n\005\002\0055\375\222\341\326\005\230\013\002\002\b\006\006\003\005\005\004\001\005\b\f\002\f6\240\342\234\212\n"
+	.string	"\200\201\250QM2$TAFZ\320\302\001`\202Q\250\252\346\001\021"
+	.string	"5\304\240\032\"\005)H\ni\f\277"
+	.ascii	"\335\2065\013/\350=:sO\021\351\372\013\037\34507\016\232\337"
+	.ascii	"\241\277\221\215\275LK$y/\303K\344\016\361\345\375\330\211\303"
+	.ascii	"ft(\334H:-\2045\003bB\243+,\243)\307\036Q\202\271\261\t\242\334"
+	.ascii	"\307Z\307\245\246\266\377\345\264K\315\025q\265Y\003&\213\302"
+	.ascii	"yn\373Dbz\312\270\271\304X\213\273\030\341H\025?o\302N3\272\322"
+	.ascii	"\231P\361\316\2047\242\323\037\321\247 fT*ftR\376\202\354bW["
+	.ascii	"\027\003PH\037\n\024\316l\236=\352\246|'\260=\346Z\341\227\177"
+	.ascii	")\262\376\244\307R6\005\2148\202c\215\371n:\312\263\324dL\315"
+	.ascii	"\356\372\374x\340\242\217jnx[B\303\003u\265L1\005\262\363\260"
+	.ascii	"E\317A\314\355\333 \346D\341\027\023nm\0309\275>\355\362\037"
+	.ascii	"\200\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"u\006"
+	.string	"rG\026\036\200M\032\00330\003\210\304H\214\200\266["
+	.string	""
+	.string	"\300xl\004\363t\333\020\314\206\342\2262\245\356.g7k6\263\230\313\236\345\312My\262n\222\bd{l\264\343l\234\f[(\022'\002\372\017kX\205%\254\311\363\203W\257\357$\203\354\005\233\236\251\300.`\223m\344\237: \260\2021\3446\262\\W\307\331\026\2713\334u[\213\344\360\221\250\274\211?X\334\006\213\303\032\202\0262\341\213ATp\206\006Z|\263\322i\n\373 2\360\351\fh\0135\025 "
+	.ascii	"\003M\210\346\212!\310\031\023\307\006{\210\364\3030F9\355)'"
+	.ascii	"\330/ \340\001Y&\315\001S\230u\032jP\020\240hRD \360AOc4\256"
+	.ascii	"\034\f/.\370\020"
+	.text
+	.section	.gnu.lto_.inline.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`d\fE-"
+	.string	"\326<\315I\220\026R:\302\033\"Y-\244h\233C\332\3440\234\354(t\372I\271j+\001\356?\223\222\277\305\364eX\376Z\005"
+	.string	"\\o\334\336\356A5\003"
+	.string	"\360\025E\003\336\273Bc\301\227\343\221N\312i\35563\357m\244\355-e\n\256"
+	.string	"\265"
+	.string	"\273"
+	.string	")~\005\237\306i\240\371\314kf#\274\323T\363\334\241\334\341\"\254\323D\177\033\347\215?\224:\234\305\274\036\372\371\316\263\207\222\327D\327\235K\3142`I\265K\371\215/2\f\306\024\236~\215cW\227\335K0\251/P6.*\177\240>K>\211B@?\305\346\013|Y\262B\323\271\355\276\"\377\307\345j}\323\3237\t\256\377p\346n\357;\237\323\374\317;O\240\371}.\321g\367^\233S\241\351\343J\n\351gN]I!\371\274\351\203\267\337oa\337{\211\345\0374\327\314(\t\361\231\377q\232\317g\241n\261\305\304\006\316\357s]\210\345\3557\344\364A$jMw\335\035"
+	.ascii	"4\2219\353+\336W\354\233\362?\260\235f\364\210R\236\332S+l*1"
+	.ascii	"i.pN\255\375\365\251\0351\263`\345\030C\004H\177\375f\272\302"
+	.ascii	"\356\302q\305\211\236\215~\370\336w\230\231Y\322\026l(\304\261"
+	.ascii	"2\006\317\335\377\372\364\362\035A\306\247\275`\367\220B\224"
+	.ascii	"a\373\271\277I\005\006\024\026>\rN\344\275D\333\233\366\356\233"
+	.ascii	"\002\273\314\252\351\213_3\334\327\037}O\304\204\"\243J\342\327"
+	.ascii	"w\2357\240\210!\353\327\235\373*\234\3112\253\244\362\325\332"
+	.ascii	"\373\256\271\373\n\354Wz\337\365\327VM\3111~\337\013\033y\357"
+	.ascii	"\265\275\373\006?\016\310'\007\340\275\341D\366\360X+\354\"\035"
+	.ascii	"Z\272\312\363\255V\224\264\220\375\237\013i\371\277\247\231\217"
+	.ascii	"pO\017m({\232h\213y.\2009\224<M\364\362*Yve\363\235(\257\245"
+	.ascii	"'\274+9\2060\341\\\207\203\323\354\314\0265\236\361$\325u\013"
+	.ascii	"\013sZ\322@\337\306\240i\304U\225\244\301y\377\373\t\355\350"
+	.ascii	"e\203\232\007\332\321\013\367\002\277\361\003\236\233\315#&\340"
+	.ascii	"\277\220\016\373\336\374\374\373\212:\372\277\217\274\275\257"
+	.ascii	"x\346\034ZO\203\364uHc\373O\323\f\242\314i\024l\244\244\225\025"
+	.ascii	"\3406B\335\342(\f\227m\243\2430\\\270\327\330\267}\003\373\370"
+	.ascii	"\342i\214\237\273p\006\267:"
+	.string	"J\232s\263\306\353\276\242\216\262@S[\243\322gLL\254\255&U\f\206\213\030p=k~\201\326\331fQd\270\334n\201O\211H\307b\371z\200Uh\225\007z\350}\365eFC\367\n\024n\354\037JZY4\237p\032\2566\330GJ\232\262*\323\024\222\261r\307\024)-\273K\020\316\b\377'\220\"I$}\265=\373j\201gS\351+\206\027$\323*&INp\207P4\333x\357\n\334\037\354v\337\r\233\352,\t\326\316w?\337\221\230GGV\246\372\364\264\366^\203\375\2256\006E\337\273\375\357\0058q[\332\222*Axw\320\327\266X\003\005@\304\233\241\013\013\206v\374\212`\003\355\030e\301\023<\201,\250\361D\207\fI\215\210\244 )H:\341\004\2041\346\240K\037\022\300\2241\210bE\210dD$\214\024%%\251\3263\354\321\220P\265\004\354q\210\t\272\227g\217t\330\005GX"
+	.string	"F\271\346\250\246hDS\2776=s\360\317\350\330\013\302P\254\310\216\377\300(\035_\327SF'w\276j\252?d\001\216\021`\177\372\253!\301\226{\355\213;\377\213$P\246\303\360\260h\237l\360\206lQ\n\0312\326\002qk`k\243\254\320]\202\306\r\003aA\n\254\206\236^h\301<\374B=V1D*\351\372c$\250g"
+	.string	"5\262\301d<.\236\003\343{\244rk)\037JF\257t\330\306\013r\362}\301\376\311h\310$\320\360\326\365\300\2239qf7\225\373\243\337\331\232 \371\313\266"
+	.string	"\330\271\265"
+	.string	"\234\323\202\020oh\376\277\237x[e\004\252\017WG\366QG\213\304\341\365m\247rb\201\r/m(\267\344\016\013!\274\224\252\332\231D\364\340\221{;\320SG\221!\204\027\253\344\307\367\334\242\345J[\212To+\360\002\374Pp0\266\005v#\240o\350\200 q\016\001X\256\246(\216(\035\202\367\304G\356\323\b!\221tpI\206\276\344\364-\224O\362\2665&\241qV\300\275\304\004&\004@\320%\020\344x+f\310\241E\034\333\321E\244g\266w\213\254\025\311\323A\341\034\321\013D\374\006\217\210\312R{pTD\031<<\213A\001Xx\340a\330"
+	.string	"\024\364\257S\034\034QM\020\331L\312\005\371>\001\003\314\256&8\272\344\251\306n\t\361yM\351D|\350\026vs\2745\330x\036I\007\373m\344N\371\tsN|T#6r\250=\025\324O6l}\242\020/\341\013\024\026@\311l\t&m\027\322?>\tJ\305"
+	.string	"n4a\200r\021B\353\345\335@\324\223\004h\257\030\205\330X\300\235\220\300\256_\325\217b8\230\271\311\252\373w#\372\320\216\003$\234\005\361\302\260\013\322\304&\360\356\350\277\021\224@*\371\277\350~T\334!X\2131\355\220C9\bK\322\023\nP\330\342\270\331\005'xw^"
+	.ascii	"-\037\206\002\001?\004\374\f\020\036\316ks\ndm\361\035\340\203"
+	.ascii	"i\2228N\316k\277~\333\300\025\021\036A\236UC\013\306\335If\226"
+	.ascii	"\013\261\336\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\350\004\335\016"
+	.string	"\346\22193Pm\222\016\210\310LK\026\213By\034%vf\302f\221\n\356@\315423\203\262\031\201\237\300\343\016[\3246*\304\035\215\2557M\213o\344\023\262\223\f'"
+	.string	"*"
+	.string	","
+	.ascii	"\235N\306\352\301\\\230\323\343\005\303\361\336\303\263m\213"
+	.ascii	"\374\273(M4\376\2634gUg\325-.\206\003\230\353\013\252E%x;P\001"
+	.ascii	"\027s\235\226\323V\325Mi\330.\032[\273\271\204\332\207\032~y"
+	.ascii	"\357\021`f\246L@\233\230\f5]\0170\t\243\315 \317\237\226j\035"
+	.ascii	"\205\351\0200\031\357\275\203=\372+o`3X\005\227.]\362\325x5@"
+	.ascii	"\270Z+\200!\221F\306\247\367\316\317\220\026\375\344'#\3131o"
+	.ascii	"-L\036\345G\202\364ba[\341(\332Pk\302D+Q\027\321Iv\020\324\203"
+	.ascii	"s`\324\250\023\373\210:\r\034\206\315\202&n\250\201\245v4\013"
+	.ascii	"\322b\345P\242A\220U\017\022\200\261I\016\003C\251 \231\300\202"
+	.ascii	")\005e\027V\332\016\326\314: \263\331\224\267\220b=\232\265\270"
+	.ascii	"!\357\024O\002\002E\032\337Q\225\335?\274\3677\244\267_:$\276"
+	.ascii	"\023\352/\307\356\024\234\t\021\2352\222)\232(\364\222V\203j"
+	.ascii	"\001\316\036\227\004\n\233\215\300\002ud\231\207\005g\301Xc\367"
+	.ascii	"\336\232\275o\210q\nFg\031\013\325c\234\273\021\264i2\240\376"
+	.ascii	"V\305\336\323e\\\0029\204\330\256\215\227\265\2416\006\350#\202"
+	.ascii	",\031v\357\321K\216G=A\201\203\275\303\254\036HKpf\001\231\333"
+	.ascii	"\353\344\371\364\201\345\362AH\317\362\274\253\231E\223\226\223"
+	.ascii	"R\025\017\351\207(\370B3\023\235\026n\276\273\272W\224)\243#"
+	.ascii	"y\300\213}\236\274Nv\034\266[(\356\272\020\274\245\205s\026\377"
+	.ascii	"\t\252\3714\367uy"
+	.text
+	.section	.gnu.lto_.pureconst.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375 q\265\002"
+	.string	"\022\207\024\031p9\f\007\255\276U\025UU\325"
+	.string	"%y\310h\222\002\203b(RK,;\016r\037\347q\035\307q\033\247q\031G\030wq\213W\234\342\023WN\342\"\016\342z8\207\253\241\210\341\026N\341\tG\370\301\r^p\021|\340\002\017\270\016\360\244RJ\241"
+	.text
+	.section	.gnu.lto_.ipa_modref.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`9\005M\023"
+	.string	"\326\327E6`i\222t0\ftI\262\3346\330\002\020"
+	.string	"\004\003aBE\240#\340\r\340\211\247\325\016\353Go\377gqFGk\327\320?\r\250\216\352\341\352\250Yb\033\2212\0053"
+	.string	";"
+	.string	"0"
+	.string	"u\034I\350c\376t\256\025\217\224\371\t\320q$\242Z\323\250\351;\325\324w}z\247\330\234G\264G-\003Q\016\241\030Q\036u\252\362\005\355\024?\374\202\004\025\275\\\004\0210L\2542\201\007 \260\0311\022\f\036\215\006$^\340\001O\001\322\363:9s\271\001\206\034>L"
+	.ascii	"\016W\346\347\324\002MH9\244\216S\013tk\232Vn72\211\n&#\373\256"
+	.ascii	"m\362\3518M\262\302\344\2612\3314d\223"
+	.string	"d\267'9F\327\027\345\222\252ui\364\323\323O\267E\271.\220\002\352\225\274Bf\202\017S&\024\215\215\311c\212\306\306\304\361]\353\250\341\201\003[9\230r\203'O\211\261\220\201Q\260H\230\361\304\370\371\250\213%Od\325b\2061L\222\312%eE\273\273\214r\242|\242\r\200\244\250\2415c6\233\2440\035@\002\202L\225\231\007\021\360(3\232\321\214$\005I\246\003\350F\032\353\247#\255\321MT\034\354\334\246\342\004\263U\333\340\256\273I\3101\b\003\275\007\316\0267\"\354\346\377X\362\022m\233\317\231.\372\022\277\001\363ZT&\006\204\001_\373[\022\204*\001\032h\234\271\314\347#\233\370\b\364\205Q\006\304L\226\214\325\367\202\217\274\005\363\200-\343\255KUI31\343\302\307`;\214l\346/\frb\302;`\213\t\"sd\352p\376\346\271t\277\244Qv\344\301\301\316\302\003-y\275\b\337"
+	.ascii	"\367\300^ Q\277\310\252{\217\326=qRX\fMx\035\200w\201\352c\b"
+	.ascii	"\022\003%\321\236\305\002\255_{\330\364\037\230B\271\013\030"
+	.ascii	"Tj\257\037\n\351\205\376\3751\006w3\006\210\3645\220\204{\f\003"
+	.ascii	"W\247\337 \037\3403\006\365\211\335X\245\332\222\025\266p\341"
+	.ascii	"7}^!A\3662>\026\355\212C\252\022\032#\342\374\241\303\031i\355"
+	.ascii	"[\233\350\017\236\013\0050\272\302\345Y/.]\2647\241\032;\257"
+	.ascii	"3\361(V\r\256\316t\2243At&\272\342j\306\330\360q3\250\036\236"
+	.ascii	"\302J\243\213\311Rf\021\206\253\242\372\004r\373"
+	.text
+	.section	.gnu.lto_.lto.b036fa8b51c0ddee,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_heapSiftUp.27.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\210\003\205\030"
+	.string	"&\355\235H\260XQ:@\345\202\255t\343A\261H\335\037\n\215u6U\317\342%|m\2611\323\365\360\313\272\377\367\252[\234\351\205U7_\211rF#\217\013oN\177\312\227Z=\270\210u\206aj\355\005\206Jd\244\355M\344N)\204"
+	.string	"\201"
+	.string	"\223"
+	.ascii	"\2577\022(\035\237\017\224Zu\f>-\023~Z\027^\332\367q\037\332"
+	.ascii	"s6bT\255,|\020\251\265:\360\203\360\023\301\007\320O\360\001"
+	.ascii	"\350\247i\366\223\353d\324S\213\036:B\254\324ZW\033\303S\322"
+	.ascii	"N'\270\222\346K\024?\334\210s\252\032o\274\313\235\321&g\016"
+	.ascii	"\023\007A\t>=3\336\273\0241\346\200\273\003:\022\307\233\334"
+	.ascii	"\363\016\356\340\251\202\033M\\\236&\324Z-qc\211\373t\3333\333"
+	.ascii	"\026\354\205\021\033E\351\212QM\376l\235M\356\013\3732J\220\320"
+	.ascii	"\360\272\260O\3220'i\325\245_\250t\352A\267\370\335\355\362\334"
+	.ascii	"\217\242\317\335\223J\203Rz\251\264\274\364\005\234T$1\300\244"
+	.ascii	"\326\021?-ui\032\335x\320\277\363\207\234\350\246hI\317\215-"
+	.ascii	"\016\tyG&+\017\342\367\354 \017!\016\211P\310\367\003J\2555\302"
+	.ascii	"\205\374\307\026\r\342AL\201IO\255U\004a\213\237{\236E[w \264"
+	.ascii	"\357f\001J3US\322\207\256\240\350\350\n\212Z/\205\013$\360,\372"
+	.ascii	"\002`I\n\316\024_R\216\304\342\324\276,\001*:[\344\202\233\332"
+	.ascii	"\023\035\324\301\204\224#\306\017\016\333\221\017\256\005\340"
+	.ascii	"\252\232\344j\362Gs\244Yx\264{\240\211[7\222A\325Tk\225\361\213"
+	.ascii	"hpIh\2621\243\237r\267h\t\217\\\203\177\305\225I\267-6\371s\314"
+	.ascii	"\351~\337\373<\301\363\273\251\260\255\317\311Nh9\334hv@F\255"
+	.ascii	"\025\202O\344E\033|\033\237~\301\344q0\372\351\262\001\246\211"
+	.ascii	"i\275\\\262U\r\354\365\202\261\n\310jZ\261\231\016t\203\315\214"
+	.ascii	"\f\374\320\302P\343\232f\305\304Z\034n0\264hX6\253\032\327\314"
+	.ascii	"k\305\212\331\254b\022\030\326\241\025[\311`\260\330J\324\325"
+	.ascii	"j|\3225\270t\347\356\360\036\002\255X\252\255\3150\373\037_8"
+	.ascii	"\223\206\2710.+\273O\311O\r\272/\374\336C-<\210@q\rJ\324\322"
+	.ascii	"\335ap\2724Bd\341)\345H,`\255\265N\325\205/\315\244|\234\024"
+	.ascii	"\272\252\255\300\003\264\373!;\366D\25010\344\224bF\221`d\302"
+	.ascii	"\223\266\035\260\002\021\241c\007\020`Fb\201\n\035\256\240L+"
+	.ascii	"\235|xY\"3\215\3236\265\033\302>W@\004'\204\264\007\372\216@"
+	.ascii	"\350~Y\002\362\322\222\320Z\2041\305\0338\314x\256\205\313\232"
+	.ascii	"\361`7\357g\033\350jkN\233\360{\344A\251\307'\020\267u\222\230"
+	.ascii	"3\234\022\b\006;\372\376\300\355\375\241VPF\314\025\261z\n_\304"
+	.ascii	"\205<\205\236\205/\005\205gJ\333yfy\376\337<XE@\214\"\257\351"
+	.ascii	"\246\025B&J\323"
+	.text
+	.section	.gnu.lto_heapSiftDown.28.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`e\005\325 "
+	.string	"\246\272\316H\220\226J:\300\023\370\215O\254,u\346\003\tE\325\0374\300"
+	.string	"\033\323\260\024=\b\226\001x\240|9D\346.N\313\022\253\032\232\215*@$\002"
+	.string	"\300\304{\370n"
+	.string	"\240\324\210\366xK\315\252G\250\306\032i\204\020\271S\n\265"
+	.string	"\255"
+	.string	"\274"
+	.string	"^\036\354\337K\362b\376\331\307\363`z\330\322+T\225/J\256\r\257\326\343\201\227\006:_\372x\236\332\367\372\027\323\301\274f_\255-\300\320j\255\b\234\340|i\3407\346K\3625\346K3\331w?j\325\336\025\222(\037Yj\255\301u\341\245L\367\235=\263$\2272\371t\305\022\251b\323}\027;\231\246bN\212\213\304O\036&U'zdO\334\225\235"
+	.string	"\243\222\022S\305(j\236&^\312\024A\220\006j\255\277\"\024%I\006_8^\334\354\224\252\370\201\33402\266\213\235\247\253\n\005]\230\"\211\323\236\203Z\253\251Tq\304\rs\3337lG\260K\b\001\265\326\272\023\256\266T@\253\326\252\300O{\221\"\177\353\245\2172\320Ke0_\316l\001*;\343W\232\023\375b\037\237\350f\331\007b\322\006\303\213\265cR\353\230\3249\247\306)\251oJj\233S\327\320<\354\2369\330\037\340ew\f\260\244\376\225\3240\224\332WR\237\224\272WR\233\224\272<\330M\236zOMO}\002"
+	.ascii	"\354\214VWIv\356XE|\351R\341\3124\032/\373\303\320~\305*A.\204"
+	.ascii	"\003\221+88\330\277\263\037\336\"\226,\357\341\233\331e^;\233"
+	.ascii	"\252N\262+7\274Z\353\202\373\370\230\375\263\207\367p)\202\316"
+	.ascii	"\030@zB\263\306\006o\013\213<9%6[\263:V\242\274\230{\256\315"
+	.ascii	"\036\355\244\r'G\270L\214\325x\222\303@<\231\326\331\341qp\275"
+	.ascii	"mP\2276\374\233\005\037\272Z+\220\357\246D\274\023\272\255%\363"
+	.ascii	"\245\271>u`o[:\223\224\373\267\027\377\024+qY\346\267\026!\343"
+	.ascii	"Q.\226\367\355k\337\331\335\233\2354b\034\002\325\365\004\334"
+	.ascii	"\2355\2052\256\034\224\260\037\344f\371f?\273\354\240:c\326$"
+	.ascii	"\r\260\300\235\242Y\272Hbn\037\350\026\373l?\3425\177\313\027"
+	.ascii	"\254f5\363%\335\222KJ\216\023>\377\322\354\243@\031\237\350\027"
+	.ascii	"\323{\315\004\356\367f\357\231r'67\326\365D\006\036\372\031\026"
+	.ascii	"\021\225\202FGEEG\302\035!\"\342\220\260\274\220\024\244Dv\030"
+	.ascii	"\n\031\021K\013\177\220\206D\032\204\206C\302\244\240\0211\250"
+	.ascii	"((DJ\n\376\360\370\b\303\020)\250tt\204\024\374\035\235\336\003"
+	.ascii	"\256\311\005.\271Sb\177\260\243\206\026<\247}\262\316~\314\024"
+	.ascii	"nE\002\271:3\273\341yT\306\336C\204M\213U\f_\016\205\343\005"
+	.ascii	"\001})*\300\315\331\b)\310\242\274\370\366gv\205\337-\311\320"
+	.ascii	"E\371\331\251\214\020^\306/\2535S\201\205\344\324\372\232a\356"
+	.ascii	"*\351x+i6f\247\232\034g\006\216KS\236\234\333\315\342\300\354"
+	.ascii	"oo\366B\240H \016\370\255\017\254\316\202\f\021\221\001\314\312"
+	.ascii	"\b}\356\211oc\212Wr\2449\005l\250a8#\025R\206DdDd\2460\315\030"
+	.ascii	"\240\002\021\241\253n\020h&S\242B\007\255 J\355\237`9\f\003*"
+	.ascii	"\245\267J\265\261=m\355,\342Gn\013\251i\034\322|\007UW\347n\343"
+	.ascii	"\001\215P\210\032V\312\343\305#\262\212HJ)\004\006\3477\336\242"
+	.ascii	"^\001\024\bq\002\206\201?^ sL\211\324\316A5\375\263\325i \267"
+	.ascii	"*B\363P\037\305\272\n\344\322\244\031\265\266b\204\fAy8\215\375"
+	.ascii	"\350\002\215\030F\276\254\235\034'\211{\327\3315\r*u\020A18|"
+	.ascii	"3\211\205TcWEz\322\360\006Q\265\035\274\325\276\300\336\224["
+	.ascii	"\027\353;n\340r|\371|\373r\340\346X\001\254\320\235\236I\203"
+	.ascii	"\020\362D\315\207\360\316\241p:\203\330?u\f\245\355\267C^}&\324"
+	.ascii	"\205&\r"
+	.text
+	.section	.gnu.lto_heapSetDeadline.29.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\352\001\225\021"
+	.string	"\226`tG\360\320&\035[X\250\354\317\253\313h\334,3\241\227rQ\276\242\026\246c\232\253\n\251H\272\022W\217H\243V\246*\b\343\016\272\016Y![\343\342\304KF\257@\375\257@3\277\b2\313\254\240K\250\021B6\221;\245^"
+	.string	"X"
+	.string	"c"
+	.string	"(Z\337i9\310\356\315\n\026\273#\0037\360>=~"
+	.string	"\367\351]"
+	.ascii	"\367\351\226]\3641\304v6;`f7v\027T\020o}n*[\376g'\301b\256O\217"
+	.ascii	"\230\3147O\346\272)\240\331\314\b\020{\331\f\320\fq\370\3542"
+	.ascii	"C\354%e7\262\273\226\260X\314\315\335\366\004\333'\266L\0207"
+	.ascii	"6'\375u\322\244\367\374\335e;\377\344\244uJ\313\017\217\031\332"
+	.ascii	"\001\033\273\032j:\226h\266 q\331o\337O\361\037\373\363\312}"
+	.ascii	"\2541\262o\305\376>\377\231?\3332\f\236k\203\007\364\252\321"
+	.ascii	"\330\035\027|z\304\226\343yZ\357a1i\267\246\310\201\367)\262"
+	.ascii	"]\332?\361\333\207\234j[@\311\303\274\251\353BF4\017\2528\276"
+	.ascii	"\t\367\351g\007\341\251\371P\003\306\320\213\314a\222~J\300\b"
+	.ascii	"\346\210\323NI\372\237o91\\\344\230\360)\361\2225w\032\004`\276"
+	.ascii	"\220\351\3148u \026ow\037\370*XbI\206\210\026\356\223\323\311"
+	.ascii	"S\303\261\343\"k\366\370\222\212c\177\333\335\265\006.)\205)"
+	.ascii	"\024\013D\021S)\361T \302JED]\bU)!,\b!\n\352\204\304\024\222"
+	.ascii	"x\230\254L\254\315\247\222*<Q!\tKN+\020\005eJ\201'\325\n,!\260"
+	.ascii	"\230\022\252@\226(\252\300ot\371\266z#\241\003\221\213\276f\210"
+	.ascii	"T\265)T\020yQ\227\245\252>\b\346\310t\241\223'\265\253\361\321"
+	.ascii	"\221#`4\264' p\202\031:\342\003\310\214\310\250\270\024\367\215"
+	.ascii	"\246\377\031NX\253\202\340=\341\244\303w\320\313}\035\317\262"
+	.ascii	"a`\255\020J\275\340EH\347&+\270\244x\013\236\336$\333b\\V\ra"
+	.ascii	"\343\344i)\366(!\250a\b\004\243$\205\345p\r\237y\264\313\322"
+	.ascii	"`\364\350r\264\311\266x4\006\270\007"
+	.text
+	.section	.gnu.lto_heapInsert.31.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\260\001\315\017"
+	.string	"\326\\eF\360\260(\035\333\2742\366{]\276i\364\341\257\375\234\341\277Q\306;\235\213\032\245\221p\337J\342\257;I\267PN\305\017\357\352\210\0017\331\346\207\251\205s\030\3744\355\004\f\206\301\363\200\344\036FJ>\331D\312\224\002K"
+	.string	"N"
+	.string	"T"
+	.ascii	"F\261A\217\007\331~\332\1779\314\351,\323\005\354\256^0vC\004"
+	.ascii	"N\300=:<\310\366\310}\300\366\350\223\235\343a\313zXZT\256\035"
+	.ascii	"\273\353\251\211\237\236'\3771\377\200*)O\217\203\335u\202*\""
+	.ascii	"n\275\355\002\266\025\330\371 $\016\234\213i{\274zdb)X\250\334"
+	.ascii	"\261\303T*\213}mw\327\272\262c\272\333\322\237\230\346\316\372"
+	.ascii	"7-\255ii\215\351\324\322\017\320\341\3240`\263\033b\247\307\312"
+	.ascii	"\"\f\205\277\342.\224\263p\322\340\354\356e\336\262O\036\032"
+	.ascii	"B\354\304\001\233\226\\\206\t\300lw\033\3701\016\263`\207\276"
+	.ascii	"<\370\271\236'@\274\254\300\224x\315m\034\363],\362M\036\364"
+	.ascii	"\215\276\365\204\321\360\030\241\251\215\341/>f:\300\034\325"
+	.ascii	"\253\246\021\307\207\225T\3568U\365*\035\221\277FR\027\3340\311"
+	.ascii	"]\214\270\335e\340\317\004#\245\220\211\346/\204$\322\320\341"
+	.ascii	"\202(\303W\362JDB$\336G*y!\004<\332 \"y&\243\021\311\003\205"
+	.ascii	"\250\353\312\2179\367\242!Ci\312 \311\251\337\212 !\017\272S"
+	.ascii	"!\363\240)\356t\306\201s\332\325\244l\264\370\350]\246\360X\205"
+	.ascii	"\217\331\301\034N?:\201\304\214J'( @\002cP\272\033\251\366\t"
+	.ascii	"Z\\'3\004\307\023\\%\036\356EG6\004\310\365\306\025d\336\200"
+	.ascii	"\354\210a\370\215lmh\245]\332\3558\351\325\370\305P\3561X\306"
+	.ascii	";b\356\217f,\006F\210\236`\316\366\213\013\367\020\002o\"sh "
+	.ascii	"\002u\242DQ`\004\300\335\331N\363I\201^^\264\217\f"
+	.text
+	.section	.gnu.lto_heapRemove.32.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`4\003u\030"
+	.string	"\226m\237G\260\230M:pr\302\fC\227\323\021\3251 \225\310?i\341\037\200\177K\351Zt\330\214\241\002\216[\347\242\325\3268\301\222\030 \204\306\232\322\346\247\364\247|\346\t\016\246\365\345\334\363\0027\027C\322i\204\020\262\345N)\216"
+	.string	"}"
+	.string	"\222"
+	.string	"o\272\223\320\237h\017\260\253dD\311\256\256\201\035\210\377\254\373"
+	.string	"\360\237x\001\340?\013\331_\256[\3320\247\3436\204\314\356\302\324\306\205.\206\3407U\n\371"
+	.ascii	"pC\027oh\034!=\234\005\256\250\374\270\225\021\322D\020c\306"
+	.ascii	"\221\021w\223\340\\\220D\305b\304\235\230\003\252jx\371\3567"
+	.ascii	"VFH\362k\3619\031d\351\361B\200\013\251,#\316\204\324\027\316"
+	.ascii	"6\017\354\356y\227(p5)C\n\273kY\204;\272[\267\255\302\366\004"
+	.ascii	"[3\0046\b~\021Y\b\237i\006\376\013u)\305R\222\323\023\221\354"
+	.ascii	"\331\272\232\324\234}\355\365z=\253\222=\245k.\375\232\3224S"
+	.ascii	"\332u\335\335\372\244\303?\375\340\224\326OZN\351\333\214,\252"
+	.ascii	"\026\364vW\364\312\254\225oj\307u\277}\237\310y#hP\215\260\017"
+	.ascii	"\365({4\211\013\261\036U\001\262\273\343?\233\204=\376\223\337"
+	.ascii	"y\264\255\243}O\030\265nX\232\260vu8\377\374@\274\264\003-\306"
+	.ascii	"@\225\370\023"
+	.string	"Z\202%'-mM)\223\233)\002\223s\032\275\002\036TjZ\210$\325\344\0221U2@\315YN\234\237w\013W8nI\224\301k\024\005\316k\364\273\007\330\351\030\ns\325\305&\263>\315i\017\027RZ\246*\275\024\344b\223Y\346\360%4qw%\370I\256d\247\003\017\017\370\357\245\021nL]5g\032u\251\374\002Ee\223Y\366\245\216\304N|&\367\270\211|\221\233\200\377h\324\300\r\244P]\372\333\231\363\374s#@\342n=\263X\205\240Y\314G\354\231\305\202\246urd;>\"6\354x\320\231\301>\360\304~`:\262\031,\347\306@ vd\260   \031l\324\021}\256*\231\002\221\326\346\356\256h#U\355\013\007\244\252\036\311\355\214\375\363*1Qjhu%\310\223\215t\251\235A\203|\221\277\373\204\202E\006\313\246C\016\177N\025sm\331]\b\376\024\037\035\237\211\006\376\303"
+	.ascii	"\203\327\322GI\241\275\266Dy\324e\216\024MIN1|@\271\"$\324\234"
+	.ascii	"[\n*\201= `\2021s\330\003i\354\033MGl\0305\r)C\316\206\372*Z"
+	.ascii	"n^&D\241L\006\276f\032\266a\321l\216\354\276x\b\202\002E\334"
+	.ascii	"\207\022!\244\362\261q\004\013|l\225\270;Hj\210\034\002\326\205"
+	.ascii	"\344r\254q\027\037a>\312-0-tH\374\334c\313\372\355\332\037X`"
+	.ascii	">\350\352\027C\fG3\220\021\306[0I\243\200\314\360\226\233\363"
+	.ascii	"\020\005,\250\306z8\256\3010\022\313\203+\342Fl\211w\366\241"
+	.ascii	"/T\254\017\271]A\017"
+	.text
+	.section	.gnu.lto_heapRebuild.33.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\311\002\005\025"
+	.string	"V\250\211I\340\320(\035Z\r1|\b\t\357\374\001+\002\243\227\201Y[\201*\223\351\220\3245Mj\334\3621\314\223\377\320\275\265\376<$|oK`\312:\016\306\030c\214\315h\244\376\276\231\034\305$\277\244\277u\326\032!\204\020)S\nv"
+	.string	"o"
+	.string	"w"
+	.ascii	"s\262\036\032\001\371\020\344\001\304\207\340?\304\207\212\232"
+	.ascii	"\331H/i\346\310c\301\262\243c\316\331Z\r&\323\350\325\301\362"
+	.ascii	"\006wvr\024Cpu\346\337\334@MQnG;y\032.1>\234\2160\027}\327\232"
+	.ascii	"\236\334\016\346!8\256\264tH\355V\300\221\245$\240\227W\335\316"
+	.ascii	"\246 \210\227\357\313\037\350\345\310\355^\256#\2039\2475\267"
+	.ascii	"\303p\233n\333\306v\002[_\004'~\357\241QR\364\271\207~\212\370"
+	.ascii	"\360\373\362,_\321\016\240\232\376vy`\254\354vyvI\323\021\232"
+	.ascii	"\245$\357\214\275R\245\256s\237\236s\233VM\256z\\\265\250\352"
+	.ascii	"P\325\340\252W\325z\365?P63Bn\314\331\362\3431\211B \017\327"
+	.ascii	"\371s\256\366} 7\325\274\361\206>\370%\374\322\250\2338\316\354"
+	.ascii	"9\026\"i.$\317N\213\244\0315?8\0226\375\205\3133*\303\256v\217"
+	.ascii	"\224u\323\352V\334\0061n\272d\377\347.,\344\367\374r\220>\347"
+	.ascii	" \361\241\270\004\214bj\372;8\347\234\240Cn\332\325>D/G\270\366"
+	.ascii	"\203\373\b\260\001\n\345\224\300\325\rw\200\017N\306\246?\357"
+	.ascii	"\202{\226\036\260\367D\330\375\217\221\311W\304\026\370*,PxO"
+	.ascii	"e\025l\300\251\351\317\266K\236B\205\234s\216\370(\276\0230\230"
+	.ascii	"\332%\"{\225\2408xAp\235\264$\300HLZ.\331IK\244\200c\023^\262"
+	.ascii	"V\205XL\326B\225\363;ss\262g\004Qmm\344\362\f\200\203\250\332"
+	.ascii	"=\nS{Z\035\353\247U\245\0232n\2724.\317\247U\355\203j~TzZ\233"
+	.ascii	"\304\245\317\371\276\377B\217\b\242\333\322\304\345\371\345M"
+	.ascii	"5\206\220@q\307\325\331\"'7\265\307\201\223\321[H\034\227\334"
+	.ascii	"\373\036\272\0044 \200\002!\303\321\003\251\373\242\206\235\266"
+	.ascii	"\221'\370\034}\255;\006O\264%GX\276\210\321\"c\335l\313\306\220"
+	.ascii	"Z\022\310\215\250\233\202\025\255\326S\037\346\313`\256$\375"
+	.ascii	"\2265\220\202\327\252\222T+\001\303X\3066\002\333P\243h\242\227"
+	.ascii	";\343\032\254\300!\036\330(\"g\f^\323_\b3\302\244#\330\345+$"
+	.ascii	"/\334\330\210\254\032\2017;,\003\025\343\375\210t.\361\004"
+	.text
+	.section	.gnu.lto_queueClear.34.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\205\b"
+	.string	"\302\31788@o\323\001X\354{\035!\023@\231\004\202:\021R\026\030\247\237|\234\0020\337v\024i\310d\370\361P\204.\334\371Q\004\322W\004>\b\002L\021,\346\214\335\177\357\224\002\2568\230\325\360Q\260\026*Ou`H\350\324\n\363T\016\201\257\007\013\253\021\327\205U\312\333kV\212\020Z>NV\234tB2\240\3115=d>6\367I^\342\025\237d\b\233l\242\2373t\002O\\\fM\3435n\027\272\371C\356e\003\243]\356\235/\362\221\217O\372\264D\026\337}\372\031\375\264'(\342;G\224\224\317Bn\266\267E\271a_\263RdS\212\005\306 \334\305\bg\366\233*\035\266OY\263c\356\215\366\245\227\213\022\270\273Ur\\{\324\374\203<\240\003m\217"
+	.string	"\007\273\353\330\2012ny\333\005\266\253}\201\021"
+	.ascii	"i\3317c\332\201\f\217_+\340\016`\006\210\003F\300\270A%\201T"
+	.ascii	"[\210+g\\\030\311\202\305/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_queueContains.35.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\211\001\305\017"
+	.string	"\346^kF\360\222(\035\240\265\031\206\031\337\330\212<\2175Eb\220\3615\310\366Q\254j"
+	.string	"\271\177\356S;\350C\264\037\364\377\311\322u\320s\002|\331\026\227\211l\f\254\372\201\256H\205\233\217\306-z|\357\022b\311\336R\246\024X"
+	.string	"R"
+	.string	"Z"
+	.ascii	"\340\003l\227\334C\266\313\004#&{\007E\264\234\245c\303\314l"
+	.ascii	"N\260\333\020\016y\004o\251\3367\031W=\377\364\r\344S\261|)\225"
+	.ascii	"%\\\036c\203\026\212\021 \237J\\W\030\303\363\251t\017\273\312"
+	.ascii	"h\251\033\261\317\345\332!\231sZW\276\016w\347\266=\333\013\354"
+	.ascii	"\207\001\366_2\377fu\374\353\336"
+	.string	"U\253\252\317E\270\231\361\370\324\346l\251\321\346\215\224\305\374u\373\240\017\263\307_q\227\351/\333p'\016\\83\3331\347\024\271\364\bw9 \3366\331\036\333\252\366S\274e\272L\312\001\314\271j\301\230\023<`\004\334\245\003\031\\\343\232\355RW@\216\007\224\326\036\347\234S\032\370ng\177\"&T\201HiM]|X\311\210\313\362\266_\322+GE}\330\266\206\267H\341\346\234\f|\026\017K>\314\245OP\364+\227>\312\036\366\002&h=d(\255\255\215\034\256\330.\313\006O\252\240\306\214\027\357*\"\221R(\225\230D\203>\244P\205\023\t\241\t\240RwATb\241\003\221J\335\207\200G\030B\244\316d4\"u\036\333\006\347w\345\253\370\003\234\037!\215\364\275\355\260C\300\361\021\322\354\357m1\256IP\233\"\261-\313\236\227\330\331\305\241\"\337e\261\275\016h<\366\027\266\361a\034\035"
+	.ascii	"o\331\367U\315\035\025&\322\210Q-\2060\356\327\206T\300\n\241"
+	.ascii	"mIAxc\242x^P\230GA\023-\361\211YQt!\305E\006'\306\252\206{.\306"
+	.ascii	"\271\013%B\025\3125u\336\263\355SK\233\352\265\2270\237"
+	.text
+	.section	.gnu.lto_queueAdd.36.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`X\006\225&"
+	.string	"\272D\370\016Ep\336M:\323B\016^\005E\213}p\246\371a\363y\335`maW\020\213\330R\374(\257%\214m\030&\274\322r~\b\355\225=\0049Aa\205j)\321\231\274O\206\333a\322\241?\332\3507id\023)\223\f\335"
+	.string	"\314"
+	.string	"\337"
+	.string	"\350+\357F\355\242\273\313\274{\256wE\335\013\352\2764-n\215I\323\343\203\215p\276\356\361\001\314\327\363F\346\253\204\tQ+\365\243\261\352LrP\211\365I\323cR3\361\371\352\026\275<~{-u\241\036\017\r\332\235\272!\263\226M\304R{\034\027b\263\"&\251\270\267\004+\353\274'_\226\3312\207\313O\022,\342Q\004I\260\214<\250dp\207\f\237\263Y\031)\003TI\021\336\212U\021\336\r\317RCZ\220\252\263Y\r)\371I\034\236'\211\260\356SY\037:b\n]\005\177\\\253"
+	.string	"yYf\350\332j\"t\005,\033\f\271v\262\363\216\253 \367\t\344D%\003b\232\037g\2632\226\001\334(\231s/G`\305\212\310\254\333\220\246\351\262\360\n\353\353\373\356A\354n\205\335\n\026a\272\265\366\247\300\206\306\tQ\027\325\3147\212\2605@\226\333\375\230\223Y\265=\224}\261i|\341\246\231\257\357{9o\r\215\304\256!S<\267{\374qk\241\005\322\022\333.\356\232\274\005\226\227"
+	.string	"\322\200\203\371\036\0311o\321\275~\337\362\366^\366\345U^\364\344\r\252\274\273\223\367\324\361\352t\274f\345\255&oi\3626\363r\345\275\001\003E\342\220\211\216~;\246Us\177\3226\025m\312\301\374e\337\227\335\254\306\305,\203!\334q\237\214J\260\005\307\265Uc\027\035;\230=\331\242bQ\377:rm\374\270$\206F\"W\232\246\377\332\213\355\301\036f\343_V\355"
+	.string	"\360\230^e\230r\344\352\223\246i\203\327\235p\276\036(m\354\006ws\202`\024\356\256\207\277\201\322"
+	.string	"\367\332vvu\023\0069\277hL\263u}:A+?\236\333\332f\237*\020R\277k\233\201\266\346\202T\216\320\352\b\331\225\335\315^ai\200,\327\246D\331W\213\363Z\245\257Y:\323\024Ha\257\346\006Sw\337!F\361\232\342\271s\327o\r\325y(\223U\034\315\031\356'\317]\206[L\246\203\212\226N\201\017\035\302\241.\356\221\347\340\006\byV\277\366\223\335\203\233\034\362\254/e\022"
+	.ascii	"\340\207\355KO[\234'fk-\352\244\034\320\035\207\250\301\217z"
+	.ascii	"\307Q\277\017\247L\3234\255\353\340G=\240\217e\n2H\374\221"
+	.string	"e\025\313\224\255\325\276~\n\213\373\3602Pg\232\246\026\366iW[\261\207\362\272M-Z\230\257E\335E\310\033b\027Z\267\311\001\013MM\334B\206\322\214r\227 <1\271\240\221\202\211\305\222\214$\030MJ/\222\226\236d$A@\260N1\230\236\222f89=%\241\307\251wq\231\277f&\357\341-\013y\206\336\314\357\345\035\336v \317z_{\257\327\273a\252\177cB\\xF\335q\206\032\234\307c\003d\271\263\032Y\331\220\036\257\215\032\2752\026\3666\306U\262\200\365\340\241G\354\353]\020!\236\374\177\230ii\003l\034:8u\304\004\235\274\336R\307k\244\372%\263\300\016\316\027\23665f\253\364<xJ\210\330C\031a\276\026\350\233\235\215<\366\020\273\274\320\266sa\2367\332\027\266\234\005\211\276\246\003e`\316\356\227\3342,b]\237\035\324\273&N\360\205\213\001I\260q\354>\316I"
+	.string	"\234\213\303A-0\276\0055\323qp\244\336u\t(H\374\005\200\202\250\201(\303\f\204ffF\002\221\221\264\031\016p\002\021*\263\036\021\360-TE)\264vi\376p\002\017\370\255a\320\251\023Q\267\353\331\357\321I\234 ]\210\250.\202\251\333\243p\230\034PQ\271\243\324O\271#\002\337"
+	.ascii	"jF^\317\242*\317\003:4\232d\024\220D\007,Jv#R\246\200\342\354"
+	.ascii	"\314<\346\021\022 \361\177\315\303\345Fz\005\306\303\224\177"
+	.ascii	"X\242s*;\020\360\274\254\367jG\243\254HA!b\221\033\3463_\235"
+	.ascii	"\177b\376|\226h\224\016S\261s\032\270\250\254\004(\222_\322\371"
+	.ascii	"\331}\234L\225\214[b\342\013\0371T\356\n\306\026\326!\324Bs)"
+	.ascii	"q\246q\230\204p1\200\024\261\372z\377\235\031\032)L\253\257\333"
+	.ascii	"\205S\210\221\023d@\033\331\332\215\353\210\326\230\315X \322"
+	.ascii	"\213\372\347r\313\334\353Px \232\013\340\2425di\ti1(\006\031"
+	.ascii	"\235\216\361\336c\025\270T\334\375\025\2113\333\332h\033\212"
+	.ascii	"\0365\022\277\b\331\325"
+	.text
+	.section	.gnu.lto_queueRemove.37.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\334\002\225\026"
+	.string	"\226\253\225J\260\226Q:4\003\247\257\321\221\373\362\252U\206,$w\035S\362|C\253i\024$\276G`\352\243\251\242A;\376\372\373\002|\242{f\261\352o\354\354\354\244}\361GV\270a\361.\274q\357\2306\261\rc\263\204\220\275\245\224)\200"
+	.string	"{"
+	.string	"\203"
+	.string	"s\177\331O\376g\376W\305\356d\273\"\266\252Zu)l\324Z\302\374\300\270\364\345\266\204K\307e\t\227\"\220\221}\266\245\021\320\026!\371\270pRk\271\352\242\263\354,\367!\317V\f\351l\236}i+\252\344|~r5\016I\004-\245&|x"
+	.string	"*\3456\354\2344\273\023\037Tr\030f'\371v\2209\033\367\366\226s\350\340\001\225rA\313bM\255\365\214\313i\330\217\373\037\350\277\202\277Q\001\261\261\326\272\340\373b}\256/\210\245\267"
+	.ascii	"\343\305-\375\302:\205\320\211\241\035\216\036\016v\220#IJ\335"
+	.ascii	"D\177I\343\004@z\034\275u"
+	.string	"\277jW\354\256\234\237\222j>\331|\324\362\366'\312\037)_l~8\371t\362g\363\273\371\314\374m\271\320\344D\t\003`\255@A(\265\211\342\020\261\274\375\267\374\366N~[l\222ly\377\215\264\f\243\317\027\"I\255\325e\351e\306\245\004\002*K\232lM;\252\277L\373\373\357\013\342\022\316t&\334\222\230\345F\365\f\217d\332b\217\375\343\350\360\342>\323\341\326\264\177o\360\004 \222\2636b\006\214\226\306f$_\032<0F\265\326\305\375\177\355\214\030\r\221\2452\304\246?\\\320\313\236:lq\310mh\334\367\bg\323^$\267\0225\016\276{\366\372D95ww\030\005E\3606\242&\240\206\020\223\331D_\351\355\027\257\210\215\237\374\177\204\205\02177\214\003\263\331\231g\305\274Z9<\020Z\023X\260\025\205\033\033\235\025\353\005[\305\024\270\253B\353\265\332q\271^+\262\254\333\272/\213u"
+	.string	"\334\371\226\302\357,\334\336>"
+	.string	"\242\360-\315\335Y\230\222\322\257\351\351\032\222\330D'\217\250\252\333\b\273l\352O5\331\r~\330\370\311y\220=\240\b\207\036\016\356\254\265\326\360eS\255\352\355m\313\217c\b\351x\320\331\251>\365\317\ni\362\243\311\346\376\371\001\360J\377\254V3 `\202!u\307\003i\373\246\030\376\332\334\2310\314\241\3056\262\340\326\225c\024V\212\020G{\314.\375.a\361\245K\\\304\233\005\333xE*\300\031\002\277\211$\241\001\331"
+	.ascii	"\206\260X\300\002\233\270C\3568v\375i\316\033\336R\364\n\244"
+	.ascii	"\254\003\227\004w\233>\341E\001l\215\272R\2642\"\306\356\340"
+	.ascii	"~\313\250\274Q\013d\324q\233\263\305z\006-L\004\262s\257\366"
+	.ascii	"=\001"
+	.text
+	.section	.gnu.lto_queueFirst.38.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767@\217\322\001X\261\255P\245R\265\311\334\b1\320C\377\031\2706Z\230\001\352\324\276E^\237\026S\302\335g\222\027EQ\365\353\316\017\020\001N\204XP\b!\233\310\235R\3260\335\006\241i\330\034\264\214\224x`\210\220Z\227\221\230\002s\023[')8\256\223\227\271\267VG\252\004\036\275@8\211\227\355n\202/\362\021\215Ozt\305f\243\230\b\345a:\270\037\362i\024\237d\013\237\340\277G\337\247\3531\212VT)\017\\\331\263\003U\303\276\265:\262\r\255\026@\206\212\002j\027c\325\262)\321\324a\233c_\374\217\2278\366\006&G\b\373\230|JT\273Sz^\340z\314\036p=\352\306\275C\317?\310\255T\211\345\003u\016\261\205\3355\374@\241[o\333\300\266\264}\022\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.39.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\335\b"
+	.string	"\226\020<6@\217\322\001\320.u\032B\233\267\361_Q_Q=\235#\207\036t?\324\033\245\366#J\353Gi<f\266yQ\024U\377\004\250\265\270\273\177\333}k\226\333J\231R*"
+	.string	","
+	.string	","
+	.string	"\247\326\313n\204\216\037\310\3766\027\310\376\264\343\334\223\363\317z\246\205\345\322\241HO\r\303\356:;T\352\326\333F\260\rm\307\0041;\222R9\354gVU\266\323/\323\231\351g\001\")\013+\273\0311\230Ey\256\017\333#\233\343\203<dd\216 z\2444\247\223\253?\207D\242\354\357)\200+\225Da\035K)cN\3705\365\030\033\246\217<\032\346\257l\341W\276\373\363\375\312\376\256\005*\032\245\f\326:\233'\"\344\340y\320@p\002\242A\002j\033\bv\016\374\241\360l\260\342\363\331 '\356U\365\324\240\244\246\213\233p\233\335U\360K\336\002\371\001\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_taskSystemLoad.40.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"e\013"
+	.string	"&\324KC m\234\016\023'E\017\004\333\250\b:`\201\037f\326\253\364QaW\331\002\310\033dj\002\354#\232`@\306\332\332F\007Z\311. \263\243\211<(30k\333"
+	.string	"\220\005\004n\265\302\245 \275\311\336)\0056"
+	.string	"7"
+	.string	";"
+	.string	"\016q\322\301\376\364\241\200I\265\273\032mp\361\026\235\242\217Y2\320\310\271\225\340\264b\374X\224\335}\205O\003\243gN\314\262\273\236\240\021\301]o\373\3036\207}\217\f\354[\273\273\246\"{N\037\263(;tp\330=\260*\027U7@\230\330\376\264?\341\024\304\223\b8\333]@\322\260Kjxc\342\225r\214\353\325\372\305\365j\321\001\257\230\207\022\243\224u\002\261\b\245*\365\322MY\250\034\245\346\356r\250\303\353\224\244\004\3423G\330\267\360\013\241\377\300\0036\363\240W\177s\275\236f!\021\022\024t\346\312&9\223\006\240\b\327]B4\030\356\373\302\215\302[\345\343\002\204%\034\200\r\3240\227\221N\333>P\253d\330\023\300}\232\306\363>mB\356\255\245\"\203\220@u\250\307~w\371\030\236\241\3632\231+\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.46.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"M\013"
+	.string	"\026\325K? O\225\016\243\371\2200"
+	.string	"\024\350\032r\354\016\362\345 / J\341\"!\332J\b\nBk\330\202\206\fti,\242D\"\004\243z\2058\004S\f3U\001\030\217\2711\216\265\221l\"eJ\0016"
+	.string	"7"
+	.string	"<"
+	.string	"\273\341"
+	.string	"\023x<:\274\004{|\034"
+	.string	"\366\350\317f\361p\264G\205(\234\\\354n\246\030\376=?\377\037\016\001A\235g\006\202\335u\202 \013\267\336\266"
+	.string	"\333\007\354o\245\220'[v\330I\275`\377\332\335\265\212\354\233~,\323W\2465\323\231\351ktlXA)\261[\241\005cW\361D\206\210\355\247\375\016\367\360\335\3049\307\256H\205\211z\351'\304\370\220\270\250\026\320\240*\245\332\230\243Fp\251\220\026\251\027W\033\302O\336cw\r\370\":\215d\264\273'q@\326A<\204\347\223,a\223\007\037\375\r\366x\205\240H\005\\\203\fE\313x\t.\332V\3216\254M\272\315\201\307`\253h\232,cY\200\311\264N\223M\002\230{\260uY\004\216\353\262H\270\277VEV\300a\345\321\217/\265-W\305\024\310\212w\nL\003\027"
+	.ascii	"i\331'\323tR\206\341V\225\202\2626\260\007\216\001!\300\024\270"
+	.ascii	",\b\036\200;\270\354\210\2015\34100\021\224a\026\325^\001\004"
+	.ascii	"\027\033\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getTaskInfo.47.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\003\006\025 "
+	.string	"V\371\310F\200\234J:\237 I7P\270\242\331\310G\n\376\2036j\277^\345\b\360\372\342\222\371\007@\254\022|D\274\220\242\344\202~[\001dg\332e\204\324\035\375\333\017(9hqW\005\326\231\264\305\3463\322\b!r\247\024\254"
+	.string	"\247"
+	.string	"\273"
+	.ascii	"v\320\345\265\025Vk\275\231\177f\323Twb!\201+`\365=\370\002\206"
+	.ascii	"!\370h\b\246\262\315\2177mS\340\231\360N\326\342=\265r\211aP"
+	.ascii	"~4\260<\265\037v1\336\307\\8\247V\037bRj\005&\260\202\362#\201"
+	.ascii	"\007 ?\212\007@~4\317&s\340\257\036\255G\f\2635\265\326\335\376"
+	.ascii	"0\200\213\300{\244\274\223\243\270\224\347\227\235j\301\225\305"
+	.ascii	"\005}/N\362\370\260\262|Vt$\202\343\242\370@,\t\020\036\337\225"
+	.ascii	"\270dgn\246\017\213\356\323N\327\334X\305\005}8Nu\020j\255\246"
+	.ascii	"=\337\215[w\3330lG\260I\005\001 ^e\341D\334m\212\350\327v\036"
+	.ascii	"\370\t\351\232M\204`_{\304\247L\225_#\221\3043\364jA~\\\263\236"
+	.ascii	"\234\225.ej\310\310\366\322\325N\003\303Zk\003(\217b\302\367"
+	.ascii	"\372h\246&\372^\023\371\361kj\261\315\215U\32186\320\212n\227"
+	.ascii	"}#-V\202x\271\354\034\352 \222\032\350g\244\366y\360\3569\331"
+	.ascii	"\317\363\261\177\247\2446Ij\235\222:\247\244.Kj]IM\352\250G\222"
+	.ascii	"Z\034\251W\244\246\"\365\007\210pT\200\3746\016Xm\304qS\261\214"
+	.ascii	"k_\017\376\366\375'\017\372i?\343\335\354h\246z\223;Zn`\343\332"
+	.ascii	"\022.7\001M\205\233\261\260\033\326zeT\346\024\"3\256y\246mn"
+	.ascii	"L\\\033\303\305 \215\311p0H\273_\255\325\350\313)\364\033\212"
+	.ascii	"kri\003\033\013Z[\303\2758\275\354BZ\302\262\270\240\234\020"
+	.ascii	"r\273l\006\021\177v\301P\004\357\331,\240\355Y\to\376\226s\261"
+	.ascii	"\320\3672\007\263\231\215\374\b\264@_vT\211\265\326:\016\275"
+	.ascii	"g\177\366F\276\316\260\266\254\320xpQ\021\267\313>\273\013U\366"
+	.ascii	"\345\212\262q\210g\221*\375+\307\322\301\303\007\372\336\007"
+	.ascii	"\362\243\317>\355\327\301e\213\307\332n\tC\026\334\3552\234T"
+	.ascii	"P\357\355,\032Z\331e\021\274\322\313A\327\016LL\364\251D\212"
+	.ascii	"r\311BST\322\n\322JDP'\n\251\245\363\204R\324.\005S\222\323"
+	.string	"N\t*jGT\300O*N\250\335\212\247'\250\235\t\254\372r\371h\247\320\345\315\231\332\350;\221O\373\205.l\316\324\366w\"\2036\250\301R\265V6\327\346\t\241>\336\327\020j\203\367\265\2435N!J\303\\\363\f\034\230\016\021\232\365\246'WU\204\316@*\372\3118\207~1tv\347\352m.\347\b\205\321\245'7\336B\262\334\234\0250\006\013\216\025\022ZudD_\234D\264\226\273\303\366\006\246\003;\034\241\222\2739Z0ls&\030\262\321\355\216\021\267\2711rm\236\330\327\034\211f\274%OsT\204\346\034:Cnn\2501$\305\230\242J\315\210\310H\223B\032\003\300\002\231![\007\021 =f\224\262I\226\321\016Z\357\351\374\347\275\007\024\242\306S\350\352\256\275\370\320\374\346\264r\351\332\363jk\272\326>\312k\345\251\260\360(\227\267q\0177\373\013g\235\005\263O\271 \030\024~0"
+	.ascii	"\243\354\r,\347R\206l_\327\3509\336\306N,\211\365\004q-\334\036"
+	.ascii	"\\K=\204\\\006\356\n\253O\0276@\013lP\354\310!\357z\031D\021"
+	.ascii	"\022\235g\005K\207\376\303\036%1O`+\215\373\244\023\230X\271"
+	.ascii	"\324k\r\276\276\306\2510`\201S O\223\245\034:\355\232\206\234"
+	.ascii	"\225/\1773\346\211\313\346u\343\2600b\3033qS\324\331\226\306"
+	.ascii	"\213\0040\254\016\3064\r\270h\302\255\271\246Sx\017\304\204\322"
+	.ascii	"\327\226\377"
+	.text
+	.section	.gnu.lto_getSchedulerInfo.48.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"\215\013"
+	.string	"\366\224LB\020mj:\203\302\355+\002\270\030J\206\3164\375\"\233\200\317 \021\247&\021\212]X%E\033\231~\317\214\313\231\016\177?\023\022"
+	.string	"#\220\"\270\230\200\030\344Z#\030\005"
+	.string	"\004\222\340;~\332D\356\224\0026"
+	.string	"7"
+	.string	"<"
+	.string	";fXC\362\351\361\026\354S\362\n\366\351\320\036\361q\264\317PR\200*\261\273\231Bxx\031\372\247\360\211\b\342\\F<v\327R\0041\270\365\2661lw\330\377\004\035\331\262G\216\324\007\366\257\335]\253\310\276\351\307T\372RiUi)\245OQ\t\211"
+	.string	"!\261\273\240ebS\323C\004\212\355K\373\023^\no\332\334bW\004\242\303\006\235\352FH\305\222j\017\270\006\356\3021p\005\272\016\373\224:9\251$\\m\357(P\262\273\034\376\351C`\031\2216\342\352\025n\001\364I\316h\344\305O_\203}^#\241\020,\007\001\236"
+	.string	"\314G\205\265\313\267\031\310\004\330\bh`\206\341"
+	.string	"t\231\366\201\331\345\302\336\201\355\313\022x\336\227Q\306\375\265*rH\203TG=\276\324\326\316a\242\304\325\274?`\252\227\376s\302\263\201\333\002\031"
+	.ascii	"0\013I\313>\231\246\2232\f\267\252\024\224\315\301~\020\034\303"
+	.ascii	"\302\013#\005.>\302\f \b`\030\034\322\204p\324\304\201`AEcQ\227"
+	.ascii	"\024\230u\t\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_getTaskHistogram.49.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"-\n"
+	.string	"\366\322E< \345*\035`F\340\fA\245\001\226\354\307n\020\006\3547h7X\031\003\b\273+\241m\330-\263l\203ZN\371\251\256"
+	.string	""
+	.string	")2\"%E\274\221\200\330\2050\340\030\376\203\033\355\235R1"
+	.string	"5"
+	.string	"3"
+	.string	"\324\340\003\336\351\346\037\357\324\242=\363\261d\177s\351\260\325\354n\235$\027/E\377+\357\300b\256\313\200\320\356Z\302b\037\367\274m\004\333!\373\004\001\265_\322\017H\f\004\315\256\307\016\300\346(\214\211\355{l\313\361*\342k\255\013\354\312\0024pN=r.\355\243<E<M\303\235]\021\334\313\356\250\340\005\316\003\f\2661~\273(\320\355\256\003\313[B\177vj\325J\036\266\262e\260\244n\346\267\274S\312!sB{\311\235=\272\344\034\261\277\331\335\365\224\331\247\375\363\001(\021(\361\245\302\223\251Cz\230\bE)\317#\020X\242P\221J\246QX+N\"T\035\201a\005\035\370\263(\2015\365}`\365\214\373\315N\231#Br\257\271a\373;\216\225\020\021"
+	.ascii	"i\331'c\032\302\206\341\254\206i\212M\253)\023\bk\275iV\260\013"
+	.ascii	"k1\314\013\302oj\n\334\013\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_taskHistogramAdd.50.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`Q\002U\024"
+	.string	"f\247\211I\320\360(\035\333\264\367\332\340'\230\260\304&\255\210\362\313\367\207\024.~\232,"
+	.string	"o\237\025\262x\b\264y\277\\Q\177V\275\252\210,\370\303\003\317\004\327\\\035\256\234\022#\240\273\221\253\261\322\3418R\373\255~k\204l)S\nu"
+	.string	"o"
+	.string	"s"
+	.ascii	"<Wa{\317\313\001\314\231C\0244\247\217\304\tR\027\355\273\310"
+	.ascii	"x1\365\220\361\242m\266\215\373t&j\007\306\f\320i\316\371\332"
+	.ascii	"\0216\265}\024\345\252\315\377\357*\335\356\366\321\251\233\213"
+	.ascii	"\022\001\317\310\346\301+\207]N\212$\341,\255v2*=v6_)\200gd\363"
+	.ascii	"\261\303I\003I8K\377]iv1\252(\006sN\253nWs\243n\033\305\366\003"
+	.ascii	"[o\002\007\221\352\326\201\367\307}~\226T\257\016t{\214j\324"
+	.ascii	"\250\036\257\026E\265\024\325+\325\272\352\207\034\320\341\205"
+	.ascii	"\330\211\261J\276\331a\270c\"\211/J\034\350\007\006\201<\344"
+	.ascii	"\302\371\346.\202\220\211\307\311\201\317\302\377\001z\350\263"
+	.ascii	"f^C\323N\021\323\234s\344\242\033\244.\352\312\266\372\276\302"
+	.ascii	"v\037\027\253\346\0241\f\232s\222xA\352\242K^\355\007\302\034"
+	.ascii	"\317\017bII\221\360_\306\213\343\236\346\003\214\016-\027d\305"
+	.ascii	"}\016\305]4\356\312}\356\304jw\377\273$\022*I\331j\355K\230\313"
+	.ascii	"\241\353\272\207\306\217\035P#g\"F\207V\351\327\236a\030\257"
+	.ascii	"\323u\341\366f\326~\377s\345\001g\236`tx\005\274'\231\335\236"
+	.ascii	"\3572\262Vl\221\"\251I\306\021Nu\330\276\233n\217\bxC\310\233"
+	.ascii	"c\277\347\0012\231\302&hMB\254E\005\226\001\265\002\243\235\314"
+	.ascii	"Xj2\024\225MJh1\225\226\n1\024\223\332\313\202\f\266\3622\241"
+	.ascii	"\325^%\005<\273\020\243\275Xf3\332k\345\233\337\234\337SBCH0"
+	.ascii	"\033\343q{~\360\020\202G3.\344\310=X\n\262\366\211L\257\263\334"
+	.ascii	"\033\201\r>\036\304\355Yu\344:\003D\317\266v\2654;\034>eD-\205"
+	.ascii	"\037\r\324\006\3209P\207\343O\031\307E\355\003( @\002C\b\273"
+	.ascii	":\351\354\223X\374j\f\035\rdi-\357Q\305ybL\233e\326N\255\231"
+	.ascii	"\222[\221\364\212\322\200b\020\336\244\333\264\324\344F\257\322"
+	.ascii	"\306,\b\207\330&n\033\2741\017'\023g6a3c\354\347\337\311\374"
+	.ascii	"\f\232\266zyX$\017\326\201]\221\006S\002G\342\233|\3015\256\263"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_rescheduleTask.51.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\374\003\235\034"
+	.string	"\326\263\266G\240\230Uc\300y[r\216-\347\304\031Q\\8\305]\034m\270 \340/={\355Jvt\364\370\315H\274\335\224xj\357\f\036Tn\330#\025\327;\307\353\t\371fL\177\254\005"
+	.string	"\260\336\302\301\317L\023\273\345\2262\245\241"
+	.string	"\225"
+	.string	"\252"
+	.string	"\277EG0\240r\013\227{\221\007n\315\203|Qd\n%\203\327\255O\355\003yS\357G\025\206\335[\003*\311\275H\004V\360\272\315y\200\363\326\374\354\274u\317\326r\244\361\276H\026\340S\230{/\255.\275\367\030\354\345:\255Yi\317_\361\230N\r$\245\303\314\235-\036J3\030F\266\276\343\b\006}\345\334{\017u\235\035GC\352\222\t\201\364\264R\216\224dB\"j\306\204I\257\246\001\342\325\013"
+	.string	"\302!3\200\226\r,\177:m!\374Q\352zp\3575\r\n\221n\331m\347\260m\301\256]\002<\237\311@A\364\301\240\3636V+\0252b\206>\272|\216 1\253\326\242gWq\272\352piJR9D\307\330\310\037\255E\373\346\2557\354J=sQ\337\270\250m^\3245.j\232G\3353G\376\262\030\354\307\337u\247\333\236\324\346I]Ojj\251\217# I\313\002\230{],\311\334,K\245\343Q\277\223\375!\276T\224\255~\221\356Y\200Q.\271\334{+\0209\224-\263\320\207\230\206\310\311\307\275Wvk\013\331\262[\372'\313.\344\311\336\235x\001X\032^\367\016-\360\243\3546\230\303y[S\017uj42\022\233\216@\237Q\020W-\3722zXX\345\311 \326X\265\265\305;\234\257\"\356\344O:x"
+	.string	"A\037\004Q\255\027\247\0374\325\016\361&>\257{\357\002\237\311\2566c\205\211w\336\376\351\217\241\034\356|\246\322\324\235#E_~tiY\235\251\227:\317qj\t,\343\243\313jdt\245\343\264\342\341\030\203\266O\274\2526\300x\357m@\365%6\237\351\326#n\267\363\026V\035La\005\223\260~MH\254M\201\245+I(Ct\fU\342E\213\206Y\213H>\025\"BP \235\317\316\324\341r\265[\317\017\356\226\263a\020\262\231\250\371\231"
+	.ascii	"\244\363\331\235\256%\310\331J\240\370\261\221\250"
+	.string	"\351h&n>A\264ZNGK\240c\334\t[\216\266\303\341r4\031\322\367\007\276\372\213\345P\263\332jC\210@\037t\016Q]\341Zi5\353\217\024\021\177\265\272\254\200el\t\267\302C\245\230n\020\233\21683\214=`\263j\225\037\276\305{\371T^e\002\205\236\236\363vV\031\340\240r2HQ\326\253\026}Sm*\325\222\274\322\272\024[]p\025}\320U\347\355M%\200cXSm\352\201e\016\345\f\017S\250q(c\ft\006\231\231\231\tF\2226\007`\002\231\261\273\016\020h\212\270\ri\244\362\013\376\251\200=;\013)\242l\017)d{7\037>M\357\367#BY\316=\\\375\343#\225@\027\005\276R(\030\261N\214W\021\2238\240t\330l~|\f\b\276Zw\0034\231\t\033\207\272\210g=}p#\212\352~\301.'\242\346\\\232\237\336\341Q\230\251\t\213,\331\273\317\020\243\026"
+	.string	"\351\267\n\231\255@\313\320\254\252\bg\0076\036f\206x\233\205s\345\b\317Ba!=\304\251\025\030?\031\245kl\205I\016\031*@\017\222\367\200K"
+	.ascii	"]\201\266\357\242\032UT\001"
+	.text
+	.section	.gnu.lto_setTaskEnabled.52.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\345\013"
+	.string	"\246WR?0O\224\016\347\274\005j!G.\007s\246g (\013\256\304\032\035\250\205PX\357\025R\326\366\261\255\202\266\\U\347n\263vOLJ9=dX\224\334\007\214$\261~~\264O6\331R\246\024>"
+	.string	"A"
+	.string	"="
+	.string	"\026<%\336\362f\253\270\327a_\342\0027\242\305\356b\312\341\333\241\346\346_\027I\252+\035F4\256\037O\f\035\nVv\367\036O\013\335)\363\272\354\2563\325i\270\255\333\306\330V`\177A\232\351\314\3643\004\250N8`\261\233\341{\261+\013\304\203\355\333\377\260'\237\330\326\264\017 \330\356\215\006|\305\252#$A\344\226\237\366;\016b\273\212d\311\356\006\022&v\275\0026\020\271Uy\200\370\\\fS\356\356\252r\330\036EU\215\b\024\250t\341\324\253\252\246\3404"
+	.string	"\244B\030\334\007\312I\021\352\225A\310\307\201\234\362\263\275R*\207}\375\276\357\263n\330\367\376K\323\361\252\037f:\234\254\243\311x\262\213\203\211"
+	.string	"\312\204\2427\026-\353\2108\331\203\r\b\363@\310H\3006\032\b\263\020\360gB\246a\241\317G\303&\336^7\334 \304\312\244'\bcF\205j\213(\344S\276\307/\025\264\344K\243:\003\023"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T[\206\302g\202\331\013"
+	.ascii	"\226\230)\005\315\300\206k\f)\334-PM\003'\b\030\360\250\221\375"
+	.ascii	"\241\224\001"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.53.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`X\001\325\016"
+	.string	"\266\232bF\340\322&\035\220TI\204\255!\206\241+r\263\362\2779\334x"
+	.string	"F\016\250kjZBP "
+	.string	"9T\226\365\241\205\013pkh\345\320H\324+\240\206\031F\220\036\221\241\306\314\210\313\007H\222Hm\332O\366\336R\246\024L"
+	.string	"J"
+	.string	"R"
+	.ascii	"A?vw3y\200x\370N\022\017U\304\271G\37049\237\346\261B\221\017"
+	.ascii	"8\322]x&\273k\352,\344\223Pd\243\325}\270\276\003\263nh\244c"
+	.ascii	"=\221\327\221\211\003=o:\233L-e"
+	.string	"w\235\255\256\303\255\335\366\002\333(\366]\0018=.\331\rV\"\3311\232T\035\373o5\307\321ix\330\257N\247\246\257\t\340QC\001\321\356\206$ K\003\302p\331\236\261M\2663\017\223qi7\204\f\027\273\261\0026\020rh\333G\361\0243\346^l\247\323H\214\300\020,nI\245\342!T\255\007\321\017\354\263\035\241\023\020@I\217\217l\006+\221\324\303\213\f:^\204\013q(~\020\205U\310\356\236'&\036F-\301\256\342\262\030\237\307/0\371\326\241\017\023\017\257\332+\306\017NM&\031G\211\035\034TuLr\231\250\032+\tXV*.\321\247\023\025\312\301\313\n\212\301i\265=h\240\322\262\235T\253\355\204\200S\020P\252\315%\225Rm\246\330\376\255\346\370 |4<\237\213\017\362:\202P\017\364R\216\327\220FM\275Q\247\324\250Ml\301\225\030\331\023\316b5\300hw\021\254\370,\037"
+	.ascii	"i\355C\3024\200f\317am\261m\3378\212\300q\311\r\323ch\0308\017"
+	.ascii	"^\201\273z\020\016\267h!I\213%\241\214\243\250\366\216\312\021"
+	.ascii	"X\224\267\t\3115\234k\002\273j\274\233\tW\374d\023\341r\340\234"
+	.ascii	"P&\254\264\217FPP"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.54.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\355\007"
+	.string	"R\01787@S\323\001\033\322\322\274\335\307\316@\276:1\273.\247\004\246ah\211\"k\032\256\277Y\nP\365\253\"v\\<\006\304@\364}\215A\205\037g\200\376\263om\357\224\002U}\300<\225ZZ\265\264\2519P\324\351\251\264y}\3505i\201i'\253\256\217D5A\253\264\260f\205\244Y\225\035\003c\027U&5\f\313$\307\333O\033K\020_\313(f\030F\337\344^\310\0271\006\b\236;\345\203"
+	.string	"NmTXH:F\360\263=\021\214\036\366\247\215%\373\335\017\247\201\032\227\210\230\335\215\217f[\250\224\021\333\347\330\206\320VX\330\336\205\b.\363\322\255\354z\bN\b8\345\315\206\271\007\262G\3514NfvW\306\217o\207\233\377\222\013p$\321\341\206aw\r9\022\307\035o\373\300v\203\355\220\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.55.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\003\002E\020"
+	.string	"v\334iI\320\322(\035\020\243\030\323\330\0135\225\240!\032r>0\353\021\030M\250\302\352&\275A^B]\253i\300\343\333\r\263&\346R+\312\327\346n\311\262\035\r\364%\217\302\017l]i\232\210m\275\034zr\250\034\343\336{\357\224\002S"
+	.string	"P"
+	.string	"Y"
+	.ascii	"\247n\331B\307\325\36681`r"
+	.string	"\274\335\375\344\211\267^\351\224\261\345\337\346\"\241\314\365:;\235\bx\320\360A\"\213M\223\030[\b\2133dv9S`\274\022$\262\327\034\351\301\344\270\315\243\b\331K\214 \rv\3271\224\215\270An\373d[\305\216\021\002\226\322e\035\272\233\214\2244\227\274\245N9\300\226\342f\307+\366l\234+J\232\375\271\273k9c\377\366\317\030-G\002zv\024xvc\212~l\020\335\241\031\331~\264\257\342+Z\277\265Xd\327\004\220n\027\247\300\013BN\013\334\244\236\316\227\3246\300\032;0\242\032\323u:3hC\274\303\270}\341982F\271\241\232\243\252}\372\013\324\211\212m\017w\221\"\325v\227A\213\347T>\212Ss`\305\207\247>\253\236\002\200\t\361\210\\b\321c\273\234\037\032\200\200\255\307\315\317+\366$\t\032\026\273I\243\375\001D|\030+\016P\254\022K5\210\2622e\350\260b\302"
+	.ascii	"\262>\r\247R\352\003W\254\017\305\200U\033L\253\217E\245Z}#\334"
+	.ascii	"~\256\2341\004\237 \027\371RI\321\270\033GMp)m\t\023Rdb\322e"
+	.ascii	"\377F\bR-\264+\334\307\302\201\323\236\324\t\217\224\017\200"
+	.ascii	"t\302\031X\355\322\003* \300\202\2211\233\007\351\356\033M\023"
+	.ascii	"j#\217\266~e/A\366\302\223\233>\344\342\361\004\273c\343\002"
+	.ascii	"#\215,\314\f\346!\364\3416\270\363`\264\353\2651';\256\247$\304"
+	.ascii	" \002bjc\356V\270\013(\334+\200\333\037 <\205\0205\352\205E|"
+	.ascii	"\243\001\217LhRQ\203\017Gc8{"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.56.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\215\f"
+	.string	"\246VTC"
+	.string	"q\225\016x\362\3423B\251\2022\003g\265\340#S\272Q\300\232>tbN\020+\017\302\320\231\323\211\026A\314|\004\f\006\313v\325\371\351\377\177K\375\250\f\003\271G\213s\206\231\340{\373{\357\275S\n?"
+	.string	">"
+	.string	"D"
+	.string	"\273\213\311\020\347^\351\224\221\363)\036K\347\245^?N1\036\206\271\331\335\013qV>.\347\001\020\027\0350\236jj\\ L~\342Q\203\327\021#\305\263\273\216\235\347qSn{d\273c\177A\237\273\273\226!\366E\376\327\001\036.\007\341\356\206\360\306\266h\013\326\305\366\243\375\0227\301]\004e\313\356\007\223\222]\020\201\023TN7\327\324\323\371L=5g\237\034\\\355W\234d \261\021\027q\352\355\024\337\235\372\247zz\371B\02238b\270z\311(\241"
+	.string	"\n\260j\214\274P\305WdA\303\345a\316hS\250\020\337Y\312\324Gt -)?g\216\252\227\002X1F`\250\342\313\006SQ~v!\006\244\355c\252\006q4\021\204SH\364"
+	.string	"\264a\021F\237\022\006\3226\214c\300\231\004\221\206\231\262L\303.\340~\256\fq\003\016-\016\331Q\345\347R\265IWQ\"\320\261m\341)\262"
+	.string	"\253\335U\200\342$\023\034\031"
+	.ascii	"i\3317c\272\211l\250h5\243\005\273\037\0225q\300\f\265\315\340"
+	.ascii	"\300PH\006\204\026\201\300@\335\037\252y\334\n\005H.\326\022"
+	.ascii	"\253)\302]Rt\300\"\224[\271\021\fGcP{"
+	.text
+	.section	.gnu.lto_schedulerResetMaxOverheadTime.57.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375 \354U\006"
+	.string	"r\213+4PM\223\016$\217\243\221\305\230\325|\253\001\004\212\200\225\361\346\225\237\230\275\216\377\3553M\24432\201\331\272@\\UE\324\200\005\210\202jG\355\326>!2\005WT\264\022\034\016\254\253\272\300\005\004\003\005X\305\013\244\004\306\030\254\b\0330,\302i\313\276N\001\207g\363 \276\230\350~\024\004s3~\310\270j\205n&*$\231\210t\244l\334\3477\215{\026_K\276\316\277\200\215\222\353$\223\342\263\222\036\210D\343\357t\366(\3350\262#\022\021!*\231\t\337E\263\272\354\326\243"
+	.string	"\032GS'\021d\346N\343T\364\327\177\340\207\377D\t"
+	.ascii	"i\3317\323\342\2573|\206[\\\023\311B\300/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_schedulerSetMode.58.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\f\001%\r"
+	.string	"fXYD"
+	.string	"\223\223\016\270G\321\326\342\004\344\206]u#\236\022C\242[\330\252C>\\N"
+	.string	"}\002\345\320D?\254%\3106\016\216\246M\357\026\232\226a\320\377\377\327??$\n\304\273\302\"\252\207mh\214\354-eJ\001G"
+	.string	"A"
+	.string	"F"
+	.string	".{\030\035VZ\370\330]KG\\{\204\232\232\177\231\207p\335\366\270\341\020zn|+#\247\017?:]J*T\320\202C\003\201N\005\212\330\204\330q\231'Kg\312\004\360`w\235\\\227\341\256n\273\304v\003\373Y\t\304\366\266T\021\366\341\356\256\365d?\346\327L\237s\240\306\006\224c\027C*\310~\261\246D\307\366\323\376\212\303h\217!9d\027D\f\031\273\336\0023\340<z.R=\302\027\250\036\255\331<\356\005\347\374\231\323\204<\177y4&\022U\217\366\350$\317Y\200\r\025\237\212nv\r\026\232\031\350\375\232&P:\316\342(\222\377\342\013(y\356\321G\251\036\257\016n8\2242\365\223\340Z>=\251R5p\242\007\352&%\227\t\026\202\376\220d\327\204\023\223K\302gdQ"
+	.string	"A\bY\237ld\221 0V\341\312,\013\030\226Y\035o\017WO.\231\361\225\324d\325\027\021\005\215\024\036J\231\212\003\322\216"
+	.string	"\202\371L\2729@\372\t\252{w!\032q\331-\005\030"
+	.ascii	"i\331'c:\217\032\306\031\202u/\306\374\205\r\244\315\355\230"
+	.ascii	"[\354u<HH\006\266\004A\374!\234\003VC\r<\202]\001S.\301\022\253"
+	.ascii	")\343\227\213\320\344U\032\263\254\271\007"
+	.text
+	.section	.gnu.lto_schedulerSignalTask.59.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"=\t"
+	.string	"6\221@; \345*\035\200\207\202\001UP6\005\016~`\235\031\274\b)t\342\025"
+	.string	"(&\030\026\007k\230\202\020J\3729I\376\213\030\004\206`@\241#\213\353y\026(\324\260\232'{\313\235R."
+	.string	"."
+	.string	"/"
+	.string	"\336\245F\317?\354\233\017D]j<\2562\201\246\022#"
+	.string	"\252dg\025\362\035\366\310\001\246b\fh\330]\307\017\354\270\347m;\330f\260\315\022sE\204c\373\321~\311M\274\277N\336\354~\304d\273\241\202\0274\237\007\357l\237\362\004\333\247=\033\346\241k\037#\331@\221\331]NA\036\031\361\237\245\242\356\252\321d\252-\017\374\264]\013F^NZT\261f\207\250\250-\373rw\327\312\262\377\372?\rj.\243\224\335U"
+	.string	""
+	.string	";\013\241\207Q\351c\332\f\362t\242\211\213\220(\002T\342*$>\024\034\250+q\036\004\223,D\035g\"\221:\216\023\356\225e\210\231\231\206\246\244\266l\313x\2651\002\r"
+	.ascii	"i\3317\323\342\235C\262\206R\b\313\206j\036\267B\001\222\213"
+	.ascii	"\265\304j\212\270\3131\233\244\201\251="
+	.text
+	.section	.gnu.lto_schedulerInit.60.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`$\001E\r"
+	.string	"f\227VD"
+	.string	"S\225\016\030\324T\237Z\300\020\364\306\225Z\305\352\356\277\250\fU{\004J\245\344F\032\035\"\005D\347\035\0233W8\037\347\317\261\026\332\004\200)^\242\252\236hA\030\205\237\356aLF\204B\334\376{\247\024;"
+	.string	"C"
+	.string	"F"
+	.string	"\367Q\374u\272h\352\nY\342\356f\247\366\311\316N\237\031e\373\370\b\356a\214l \211\355\2566E\034u\211\362/\362\313\267J]\202(\330]\313o\325\341\236\267]\300\266f\177E\366E\325Wq\022\321\210D\252\247\030\027\370\227\252?>E\311\017\215\301$\377\235\372\246z\232\300\325b\211(\236\\\261G\225\234!\354[v\266\354\313\001\023,\020#XL\036\343rX\371\261&\224\006\t\333\001\251\032\020BRb3:\206\321\022)'0\367c\\\206m\370\2417\303\f\253\2474\004%\006@\336\303\255\243b\376\221\277"
+	.string	"\005"
+	.string	"w\275\026w!\301\017O\375\001\311\177\240\372\nq\362\237\377z\203\035\253r\242a\246\002\3362\235\207\002)\202g\3026\322*|:!m\353FZ\206\2009\013\236N\273\300q\235\226\215\336-;[\346|0\361\246\312\003\344\305\227,\220=l\003\317\301@"
+	.string	"\270\273\bn\034\207\306\301fS9\017\244\3105%\243\312I\206\031\037"
+	.ascii	"i\331'cZ\231\032\216\333e3\223l\006\002\003\237,\261\323\332"
+	.ascii	"8\030\213 \037\030\f\020\007\214\b:C\013G \325\026\270\203\r"
+	.ascii	"\302\020\0255\025-)D\006\241\201\274\201T.\256\211\340C\020\204"
+	.ascii	"\n\374r\005\270t\213v>\001"
+	.text
+	.section	.gnu.lto_taskUpdateDynamicPriority.61.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\304\n-5"
+	.ascii	"\372_\254\024@P\244J:\007\205\255\0163lfS\277y_\003\205y\024"
+	.ascii	"7\331P\021\001j\2554\024]c\200\b\315\360~\201\201\260\b\246\006"
+	.ascii	"\b\203\237-\244\254f\333\222\301+\252\252\265\3314i\233\020\""
+	.ascii	"\245L\001?\001\r\001B\001|6\371\353\301\302\024$\022*o\032\017"
+	.ascii	"^\n$\211(\235c\246\261\262bv\301,\377a\276c^\024c\266\351[\272"
+	.ascii	"<\006YQ\002\250\304\336\227\357\305\203\2611\245\206\227\272"
+	.ascii	"m\233\341\034;\007k\036\003q\365\376\342\232\373\347\370\213"
+	.ascii	"\377\033o\275\344\330/feR\252\266$n\213\270\346T\311\374\257"
+	.ascii	"\335v\311\261w8V)M\231\034:\223\246xW\327\"\256y\274u:\327$."
+	.ascii	"\323\271\346\377?\330\312\361\263\305{\002\244\330\347fm\317"
+	.ascii	"P\232\342e\265\223=[\246%\245$\244#\243Q\261\b%\326\323,\233"
+	.ascii	"\317\276:\226)o\001\310\251SgIi\363\242p\022R\275\220`\313_\235"
+	.ascii	"#*\2717\344\032\313*@h\nW\260\rY:\001\251\302\266tmI\330H\t]"
+	.ascii	"\033\022.\026\035)\247\364\226\212\256\315\b\243\365\202\334"
+	.ascii	"\033\224%.\232\224\255U\313\341\022<c\334\212\354\t\245\350v"
+	.ascii	"ds\005\333\340\312\2514M\213n;\270,\253\220p\204\254`"
+	.string	"[\\\351Dg\t\237\325S\343.\231\342\312\f\256`\333\223\322j0\213\221\315[\356\341\226\306\\/\244izfs{\3337\355\277\037\376\233\370\213\212\002;Z\307\3136\233\373\326\022\241q\362\335\\]\266\324\336\361J\332\303V\215Y\367\204\301B7\354\023&NY\227\305\311M\226\247Gl\317\260 \246\251\0327\221\302:\036\314\022w\246{\356\337\262s[E\336\0365>\364\177l\373\312\210i\232J\370\2269\343\341\2028e\315/\216s\315\355\315[N\242\205\020\331\345\016\215\223?\236\216\355d2\231\344\236\373\267\223\311d\362\315\344\257\374\257\025\263\367Z0\373\256\375\262\313\265w\273\025\316\227\200\362\267P~\004\224\017\341\344?@\371Z\225\237U\371XD\376U\345[U\276\003\224_\205\362\033\234|\006\225\277\240\362\025T~\202\312GP\371\007*\337@\345S\235?u~\001\"\237@\345\017\250|)\224/"
+	.ascii	"\345\007@\371Q(\037\n\345\003\250\374\247\312w\"\362\233*\237"
+	.ascii	"\251\362\227P\276\022\312OB\371H(\377\350\344\033Q\276Q\345\027"
+	.ascii	"+\277\210\310G+\237X\371\365\374\223\3107+\277\254\374>\003f"
+	.ascii	"\f\341\270\232\252\273\272\334;^\t\300\377\206\016\274lT\275"
+	.ascii	"|\273vq\352\346\244\265\016\243\234\030?\343\324\027\320\006"
+	.ascii	":\373N\271\007\020\274lk~A\234kN\265Y\244\317\020\216\301\221"
+	.ascii	"8&F=\267f\013\364V!P`@\023h\276#\325\\=\240\245\002\375Hu\205"
+	.ascii	"\"|E\001\315'0@\013\350\362\360\210\214j\250\016\320\225\320"
+	.ascii	"\221\216;\252\227\213\241?k\211\240zOS\331\307&h\343,\200\206"
+	.ascii	"\352=\"\237\032\200S3\365SS;\345iZj\256f\352\363P\304\016\232"
+	.ascii	"-5\022 \230\027\312\345\251+R\352mb\007L\251M<{u\313g\357L \364"
+	.ascii	"\315\n>m\330\202\biGH\354\271}\240 \\\260\324\244\376G\354\034"
+	.ascii	")3\220M\320.\330\211\324Im\036\036\221Gm\324H\rE\350Hg\354\243"
+	.ascii	"@c\033\377\020\0316\275!\323\343\354\271/\330i\324V[\352\030"
+	.ascii	"\365Ob\335\200=\345Y6A\3056\352\262OQ\023\273\330Q\207G.i\234"
+	.ascii	"<\332E\275k\211\320Nl\033\024h\357\237\236\273\332\\M\354\363"
+	.ascii	"\360\2576\322_!C\256B;V\314\236\373\236\235g\257\034\022\233"
+	.ascii	"\315\325\337>{*)P\260\030\214\261\0201d\214\325(\013\023\273"
+	.ascii	"\341\025\026\243\354\313E\230X\213\260'\032\"\304`\214\205\250"
+	.ascii	"\021C\214\214\254,\314\350\202F\212\032\345\303\260\310\304^"
+	.ascii	"\224\255\020k\021F#+\306X\n\030Yad4\262\260\250.c\206\030YV\r"
+	.ascii	"\0312\310\262\212x\351\226i3\371\346\355\327\2371|~J\273fWo9"
+	.ascii	"\3649\304\347Ww\317N\t\335\343\277\204\376\005\264N+\3234M\231"
+	.ascii	"\266XH\204\336"
+	.string	"\352\022Bku\204\256\017\032\002\277=\350\"\240\234\bH\376\320\226zn\373\007\237=?%\255\226\352RH\213\333\216\262Z\253\033\253\255:\253\241\256\032\353\004\377@q\325kF\317\235\203\346j\2536\017\331\207\231\203\336\274\275\002\214\023Wf\360J\022\233\206.vH;B3k~C\220\252\230G\203\256b\320\r\370\310\240\213\200\177uw?\tV\003+\302\306\020\341/\202\321\314\232\364\266\201\0236uG=\367\377\213S*z\340\274\272\253\277\232\302\341\2610\021\006\257\3361[\326\001\372\031.@\344\325\325\nz\301!/\005]\004\364\253\203K\320\206\020\264\201N\320g\337\021y\240\273\032AG\005\232{6\247\201>\320{L\224\266\204K\310,\203\006\r\347\232\006\272\002`\200\276\250a4\246\220s\212\204D\212\n\222$\215\001\300\"\0212\352\006\0210\251TJ\321\214\304(i\357i\223\356\227\022\3255\367B"
+	.string	"h\3012\"\2119oi\302\320\314\27732BB\225X\223Z\0358&\3225\231\245!BT\375X\317\b\331 g-\275\232\r\203\"r\333\374X*\325\f\nK\362P\302\334\031\222\006\013C\242\025fI\034\230\224 \304B\310`\253\364\\\274\355\005\350r9\335\346Q\214)[\236\033W\346\204t}\245o\032\327\360p"
+	.ascii	"\270\033\023\3743\360JK\255\267\223r\230\0321hD*\024d\342\035"
+	.ascii	"\271\356K\020\023\036\260\202\346\004i:\206\006\264F\332\321"
+	.ascii	"\221j%x\fd\315\262w\363\004\204\363f\341\244=\223\317\374\341"
+	.ascii	"\006@y\001\317\t\202E\305\006&\b\225\365{\273\2668,\216\202\307"
+	.ascii	"T-\336\023\036\274\364\240dtx]<\235l\232\315\303q\360^\224\327"
+	.ascii	"\006\204C\030\340\316+\305\247\372\266[ \320y\273\261:t#\264"
+	.ascii	"\004\374\273^\b\343\233\316i:Y(\305\217\213FW\374PU\244\336^"
+	.ascii	"\223\206\360\256\246\365u~le\261\371\206\342\217b\022#\023\360"
+	.ascii	"<\2032P\352\023\261/\203\320\232T_p\021\266\301A\322\312\237"
+	.ascii	"\245\273\311\b\221)Xv\\\376\316$\315\325&\250Z\254\224\352\035"
+	.ascii	"\344n\267\270\001&\026\332i\251\310\276O\252\321?"
+	.text
+	.section	.gnu.lto_scheduler.63.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\367&m\261"
+	.ascii	"j\030\245>H \306h<c\377\251\202\314]'\206\305\337\275\021\223"
+	.ascii	"D\302\332\210\315\302\260\240\247\325\370\313;\016\360\312b="
+	.ascii	"\341\007\213|>C>^0\030\360r\016N\251.\274\017\342\231F\374@["
+	.ascii	"\210\337\032~=\\-\320\020\"SJ)\345\003\215\003\327\003m\246{"
+	.ascii	"\257\233\257\333K\267_\267\2306b\356\264\"t\252d\201\364%\354"
+	.ascii	"Xv^\247\210\274\236\274Ed{\252\300A\372Y\363\314\221\270\022"
+	.ascii	"v&\311J\036\t\342\276aZTqB7\247\351fA\206\250h\222y\222k\232"
+	.ascii	"n\304\305\330\307\016\030's\261\n\334\352b\f\304\226\215\363"
+	.ascii	"\2606;\254\223\003\351U\007c\033WE\2472\373\227S\271\311\274"
+	.ascii	"\271\027;\275+\354\255.\213\231\346v\017\033U\320\224T\275\207"
+	.ascii	";{\r\224\234\344\326\243\202J\004\201\272,\235\226\235\2228\234"
+	.ascii	"\211a\214\0234\251\230\235y\034\331\307\216\227;\035Y\325\216"
+	.ascii	"\314\244\273\202\301R\005\351\310M\310\370\276\357\234~\214\266"
+	.ascii	"#?d\034n:B\204\250D\312p\224\331I\330\215>\232\221\227H\350\264"
+	.ascii	"\233^l\240\3430\211k\035,\206\375\246\025\331\211\330\211\323"
+	.ascii	"\206\263\203\350E|\177\342\352\346\366\232\275\374y\273\254\241"
+	.ascii	"\314CN\323\357\331\333D\360\324a\201\224k\366\262\320jA\2425"
+	.ascii	"\314\313\326l\200\331\007\363\031n6k~T\036*i."
+	.string	"\240\007\261\372\f;[6\016\253L\243\321\3523<d%\033\327\177\334\202\3544\343\300V\245\032\263\246\026\263\223L\0032;\031H\377q\020\027\300\267l\336\373\276\316^2\003av\366\362\331[\232K\177i0=\206\235az\202i\213\t\322\364\305\367\232\025\200R\262\251\315^6\271\035@L\333\017\202\246.\276\327H\207\3122y\222\b\350\322}\323\366\"\304}\257|\357\031\212\355a\236\244\001\370\232\re\362q5y\021\275_F(\351N4{\331y\2557\355=\256&/\276\267\314\304\0262O\362}\371\242z\311\033\232\275$\352#f/\275\241\314^N\231\037\233\357\355\355:\204\325/\222\357\373J\275\333\323\202\317v\273\335Jhj\227\257\271\001\027\361\007^\372L;\005\212\023&J\2200`\204\210\020 >x\350\300a\203\224\206\f\030\242.X\250@a\002\224\204\247\bNM\020\230\226\0368Pj\220\304"
+	.ascii	"\351\310\b\372,\"\032\022\n\002r.\370i\3720\227\356\373\224;"
+	.ascii	"\002\366\261\253Sl\033\305\266\322Ol\001)\335\304v\217\227 \241"
+	.ascii	"\247\r\320\366\b\255+\221t\021\210e\223mWV\307C \226m\307<:\b"
+	.ascii	"G\017#\364\017t\332\303Q\0079\034\032\235l\216o\230\323R\206"
+	.ascii	"n\023\243k(\354\f\205n\034\203\207\365\213\265\"t:J\355\314\261"
+	.ascii	"/\260Q\ft\013k\272\302bG\200\203\314\323F9[\323\024\264\370\204"
+	.ascii	"\266+\003t(\267\327\346\364\241 D\242\347^d\\\302_?\251\351\b"
+	.ascii	"j\206\210q\247&\367B\030\367\b\302\026\246=\267\251:\201/\261"
+	.ascii	"\325\205\261\243v6\246\037\270\036\370\362\350i\3042=\027h\213"
+	.ascii	"\330\020\037\222\347\016\334\253\335\272,ujg\177\255\344\372"
+	.ascii	"\f1\"\327\210eY\334\021\223\220\202\255\215\363\006Q\316\360"
+	.ascii	":\tK3p\241\360&\027\240\3447DJ\353\231s$\027C\234*hP\354_\234"
+	.ascii	"\266+\223\363#,[*n\344\243B\333Oa\214yxjgx\r\265+\303\372\323"
+	.ascii	"\375.`\006\033\261l\212kB\017\013\234\024/\212r\006\327DGC\256"
+	.ascii	"\222\023\027J(\033\371\346A\355\365\326@L\334\246&\356tR;K\353"
+	.ascii	"\005\210ein\223]\031\232\377\320\351\027kD\312\344i\325\316\340"
+	.ascii	"\272\351^\310\022\"i\304\2626\356\321\2335:=\246\235\354\312"
+	.ascii	"\256\356\3434\243:\323=2\"'&dVu/@\232\241\240\005\301|Y\227\244"
+	.ascii	"]\367\004\032%F\204\314\276\\\237\322h\247\331\264[\315\252\376"
+	.ascii	"-\330>\230\247oQ\214Y\222v\037\025\357\373\262\213\231\2355\253"
+	.ascii	"h\346e\024sk`v:\013(\376DC2s\355\371\0301\r\345\177\004\373I"
+	.ascii	"\230'~N\276!\235\310\256}\274\214\275\304\276F/\323;\037\377"
+	.ascii	"\213t\264I\215k\270\f}\033\2571\031\370\003\354m\351H\236Bq."
+	.ascii	"\3235)\234\351\026f\340\207\340\366L\370\355\245\t\225\370\216"
+	.ascii	"l\2436\024t\005}\033ww\330\336\023-@\317\306Y?3\300\005=\236"
+	.ascii	"\335\037\030\377\342\255,\376\247\360\313'\333|\013W\b\366=)"
+	.ascii	"\234\251\233\020f/\177~\201+\030<\347\267q1a|\217\037Z#\262\b"
+	.ascii	"\226\245j\307\366\334-\3706\276\353\346\267Z\237\234(\317\361"
+	.ascii	"3\236y:eJ\305[\254\371M\247\033\211\237\031\235\026r\310w\361"
+	.ascii	"\035\254\344\343\317\267e\351<K]l\2644\277\215}\351X\272\307"
+	.ascii	"\364\21399\325@f7\004\314f\323\004\b|\254\006>7\004\314\022o"
+	.ascii	"\345\236\3161}>\207[\361+\323\271i\335\264\312\264\n\263\227"
+	.ascii	">\337c\032\312\216\227'>\337\306\314\236\3361\231\377\217}\215"
+	.ascii	"_>y\305\353\246w\314\357/p\017\247p\221\n\363\333\370\035\253"
+	.ascii	"c\\ \037\243:\306\033\355M\274\325\331\332\304\267`3h3\371&2"
+	.ascii	"Q\316\227Ov+\241B\371\267\224\242\371\234\034\220\377\021\314"
+	.ascii	"\372\270O#v\007C\363\370\254o\260\254\024\036\337h\332\265d%"
+	.ascii	"\263zW.\3247(\356\267qT/?\253\317\360\313'\331\375\345\267c\265"
+	.ascii	"R\307\347x\367\333\256\262\016\030\335\177\277\216\377/`Y\252"
+	.ascii	"o\331\377\277\253\225x"
+	.string	"\3766\325\342\337_\032\365<J\220\346\373~\205`o\233\202M\2674\343\034x\302-tY\275=/\337\366m\351\242\346\031\203\257\ti\276\357;\202\035\212\253\255\340\216\353%\263p\341\002\355}\326\026\361\004\243\232=\353N8\rw\034\303`4\336b\214f\260]J\326J6\017\217\227o\331\2013\313\230\341-\226\343\275N\017\244\026\222\372]\314|T\377\2664R\322L\341gc\316\313\202\207\345N\202+V\252\330\325\321\315\311Q\211\233\202\344\334R\340\336\334\242\264\261\255\0319\267\032\224'P\347v\322M\232\211;7\232\022Gk\356$n\326\334gE\316M\346\327\346\036\363#\315-\346I\232;\254_iO6s) \202 \356\fd\013\352\234\325\205\315\016\374p\347+#g\037=\220\234\031\260\202:\363\330\021\3555\315:\252ZLs\016'\322|\303\273\232m\324\240\321\207\315\n\264ds\002=\247yF"
+	.string	"d"
+	.string	" \006\0020z\257\371\205\213\026,\232\257\371\200\025*R\240h/\315'\332L\263\211\366k.\361t&\361t6"
+	.string	"\352<\342\351,\342\3109\004\003g\020I\316\037\240\316\036\240\316\035\240\316\034\222\2347@\235\245\236\316\032\236\316\031\236\316\030\236\316QO\347\013Og\013O\347\n\f\234)<\235'<\235\241\220\234%<\235\237\236\316\021\236\316NO\347\246w\206"
+	.ascii	"ufz:/=\235\037<\235\035<\235\225\236\316\r\236\316IOg\006H\316"
+	.ascii	"H\357|\344\316FOg\250;?\241\316EOg\242\247\363\020\324Y\b\311"
+	.ascii	"9\350\351\f\364tvB\235\027 9\377\274s\363\310\331\307\310\231"
+	.ascii	"\tu^>\235\335\247\363C\235\375\351\f\210'\313d\316\315/\362\275"
+	.ascii	"F\266{\336\303\245\340\234\243\265_\333\315\332\217\264'i'\322"
+	.ascii	"\336\325=\331-\331=\247\273\260\373\260\033N\367\232\016\024"
+	.string	"\024\360\354V\220~\215\267\326\3600cwP\"\023\013\237X\220@\343\331\311\3529\202\325\363\004\032\317P4^\032\343\331)\372\034!\372<!\3063T\214\357&oe\tN\021\256\236'\364\332\263\013\325k\337L\336\312\025dx\313=\367\242t\216\324qA\226\303\257\357\342\246\3731:\027\004\244.\372e\251s\337\215<\255\276\230\264\016\020#\001\246nbw\346~\20140\325J\243\347R{\"B\204\030\277\332\330N\205,/\253\307\304\313\267?D\356{\261\217\220\320\311\352]\301ZQH\323\350\177\0045t\215W"
+	.string	"\2145\262\n\030\016\0059\335T\236\214\214\311q\211L4\214\373\246\002\375\034\337q\357_\3575\325d\336\272\316\033\364\233\f\034\206\177\267\317o\307FA/\337\272_\206t\023\212\376\345(\213\256\024\344\020\216A}\033\327\220\362\024A'\001[\"\247\024\3256\236\024\370V\\RD)\252i\274\225\237\020xv\225:\357c\274\325\201\267\361v\276\314\351#\254 \230\210&\341\333\330\315/m\257)\b\215W\340\255M[\317\356\203\030\217"
+	.ascii	"\206\266\361\021\374\250\365Y\007\235f\210\030>}[\220[\235\275"
+	.ascii	"\b\317\306\016a\353}i\353\231\370a\345\230\266>\372V\206@\343"
+	.ascii	"y\211\306\263\313D\343\255\236\357K\317w\257.r\364[\"\307\364"
+	.ascii	"\374\253\267:\204\240\367\245\240G\362[R\310\024\364]\367\326"
+	.ascii	"\272\257\372%\027\277*}\204_>\251\024X\250\307\351\333\276\260"
+	.ascii	"\025\2050`\314\320x\245\361A\036\232Hf\b\303\245\221\322<]\304"
+	.ascii	"/\355\211\026\322M\222\3666\365\024\355\364n\n3\335\356\220\201"
+	.ascii	"\320\245[\212W+X@\312\220]\036%\223W\331\363:\306o\275\320\332"
+	.ascii	"\330 \023\034\255\236\245\ncsy\331\367\325\270\205\023\375\263"
+	.ascii	")\307\017=\321;\031\241\037\302#\245\024\372\246\340j\330>Z\034"
+	.ascii	"\r\037\374uP\343\235\005\202~\201k\241\3669\244\213\030\021\265"
+	.ascii	"\023\236,\262qP\307\201o\305v\027p%\324^\275|\253\364m,BLR\277"
+	.ascii	"\377\203\006\375\361\t\274\365\261\317\253\207{\262\r\336w\240"
+	.ascii	"X\275\016\341`&\360@\315\310\304\260:\236\324\302s<\3273K\265"
+	.ascii	"R=\036\006\321\314\241\020\231/L\030|\033K)\231\r\347\177cno"
+	.ascii	"\"\023\013\341>)O\2652\307;\277\337\276)\333\275\242\270&\311"
+	.ascii	"\240\037\035\225\245[o\234b\234\2725\223k \226=_tZ\260\343eO"
+	.ascii	"Vo\357)\315\252\005\311\355\271\336\231\313\212+&:\234\035]S"
+	.ascii	"*\325\355E\300\tz\345\231+c\347(\212?\366\021\276\3414C\242<"
+	.ascii	"\023\334\265m\313\323\252\033N\357*\220\275e\363\n\247n?o\274"
+	.ascii	"Hf\363\332\334\r\333\367\266\375\215\354\315\333\b\201\360&\306"
+	.ascii	"\314\f8\233\251\033\20575\276f\032\306\326)\031\031\263\227\\"
+	.ascii	"\357\224bJFx\002f\323#\314\026[\360\255\247\215$\021\365\016"
+	.ascii	"\277\344\030BA4z\302x.\202\361\235\307\342\271\210\305W\275\225"
+	.ascii	"\237(\236\335\"\024\337k \234\273\002\263'\035\3154M\304\333"
+	.ascii	"\373z\265\030\273\240\237\231.i\232b\247ii\314i\223\251\023o"
+	.ascii	"\261\037\337\3326\n\203\250\345p\310wA\227\255\346\33215.\221"
+	.ascii	"\211\205\217\200\255\366\375\330\3766\206'\253\307\376Fi;\362"
+	.ascii	"\304\253\216!j(N\374\314\344\232\215\3663^,\267q\232\376\327"
+	.ascii	"0\016\b\244\254\0066\271\271"
+	.string	"\230,\336\312.\321\t\030u\366T\003\233\256\327(\336\252\3273~\310\314\313\224>7\222vFJ\321\320\317{\320\317\313\371\231U\n\375\260\370\003\336\352C3\336\203f\374H\326]\253\201B3\236]\240\314CC\324\207\325\226\324\025\226\017\037XU\r\250px\217\036T,\242YX\b\210\036\320@\007U\224GV\364\001,\240+,\253\"\035\321\006\252\242<\252|\264zP]\355\260\322\362Y\220\025}@\001\035Q--\252\037C[W@\260X\374\240\212\362\370\331Z\021\335\002R\025M\200\213\255\004D\257\202\032\320\242\332r\265\006\020\365a%\200\255\253hV\026\220\252\240\036T\017dE\267\256b\350\310\242\002\002#\352\303j\253\007U\324FT\207\225\326\026\020\254\007@\020lYeaYe\321\250\262\362Au\005A\013\035\321\255\252h\217\250\226\003\255\006\264\250\004\260\343\312j\313\212*\b\020Wi\310\212\366"
+	.string	"\242#\312\243JK\352\312\212\312\207TU\226\226\224\006'\306\372\021\315\222\332\302\302\312\222r\362y\365\2635\027\265\034z=5\005\211_a\300\213x\022\337o@\244\224r\304\367 \334\236\227\235)\021\031\354"
+	.string	"\306\375\020I&(\262\374\n\256\"_GH\3631\313\202#q\210\234\300\373\306\362t\360\260"
+	.string	"\312\231\336\355\271\373\0064r\373+3!A\207\370\254g\f\361\017`\025\361\256%\f\3409\236A\304\251\001\342\016\326\260\202\227\033/$\252\334\303\177H\274{\3047\037:<\207\367\360\355\bFG}\303\016\337x\340\334H)9<\023\013\266\020\257\312\245~\203\026\251^\211'\317F\201\246t\313\257\221r\t\301\310\322\276W#\375\322\354e\206\r\317t\024S\"\365>ki\206\325J%\277"
+	.string	"9\270k\222V\362%\276\200Q"
+	.string	"\346\321Lue\222\367\264\206!\001\326\r\336\336\013N=\350\263\317\360\032~\231g\202/3\225\341\033\020\256\301\360\200S\017\242\336\302cxf\032\260\354\205\250O\242\004\243\243ji\013\177\341\227\362\200U\216\371\277)\013\237\205%\f\373\n\337g\377\212\025\236\311\027\307\320"
+	.string	"\336a\317\024\236K<\371\372\256\300\237\240\006\205\317\302\016\342\0310\341\301\340`b|\265\206\372\t\277t4\363_p@}\004\3304\3162g\262#$\364qI\370\b\260i\360\366\310\236\213+\351v\203\273\2165\331K)\202Q\260e\352\214tp\354\035\333/*\261h\264\327\247\327\213\360M\377\364KE\260\254S\204\367Q\004\243[6\247a6\275\3237X%\336g\231J#\035\034d\366\262\351\231\223X4x\327\016\373\026\373!*v\013FG\355\260w%\315\200/\216\336!\365\273\240m\314\254\210\200\360Y}r\376\312K"
+	.string	"\301\032i\2336\314^Bx\022X\300*\\Y,\030I<uS\315\004\013\006\357\312\344\346\347\244\224H\214K7bw\226\236\351\301\347\370\245\367q\003FG\365\255\336S\231\332\363\340\355\260~\332\022n\036\265!>\310x\276\320M>"
+	.string	"o\345\017*\236\335\013\315\344W\254\370\357\372\233\353\223\263\342\371\245\374\024!\206\3227o\230\275\264\201\365\242\275\376\233\3227x\007Q\022\225\376\347\032\200o\360\316D#\333je\322\263u7\016&\203O\372'\017\005\207TQ\272\350-&]d\366\222\201;y\335\342\305\201\b\253\216\361\320\022\374\354\251\223S\r\214j\264\277\341\001"
+	.string	"2<\264\370k\027\036RD\271^\253\270\361\f\214e\341\022\231\350\276\357\373~\350\200\364\316\001\351=\314I\221\rH.\276\305[\275\303\215w\0167\336\303\264\325\300\r7\236])\025\237\302\255\314\\H>\373M$\270\362iV\276\257<\326\312\273\325C\225+\277dzWE\003\233.o:\3309\031O\241|\0225vv\362\274a\343\340d\033\334+M\\\230TX\023\300\f;\236]\f2\036"
+	.ascii	".\036\351\217\250A\372\005\256\025h5\310\370\035?\264V\244\023"
+	.ascii	"\347t\t\223\341\350\306\321{X\223\00738\304"
+	.string	"\f\303\227\271\221\021o\223\220Q;\334\367UK\001\331\305\267\027\024\037\003\203C\250\362\3604N\302$cj\204D$I\222\f\007b\n\020\210\204q\232\326\224\017\022"
+	.string	"F-\306%C43R\320d8\n!G^p{\203\342G\206\241\305\313K\207u\232\326Z\337\b\213\036\216\024\343\204\225\303\232Z7\022l\361A\350\035\301\036\207\223\213\357\312IC\244\r\004\205 \204\016\245;\031\"y9\005\316b{M4t\373\366\032\350\341\004\314\023?\222\2649\365\253\242\233\225\215{Bmo\221\343\205\023\341\336W\244\272\033\265\025\236\005\300\372;\315L\226\f\312\260\217\217\334\\y#\006\377\242\231\355\226\023\226\026NEnB-b%=\355\262\236\210b6r!\303\202\022\025\n\211"
+	.ascii	"\202\236\323\243\001tc\361\325k\232\346\257\340\b+\375\260hc"
+	.ascii	"6*\017!`#\331\004\231\351\tZ%KK\217k\206\312\023\261j\344\375"
+	.ascii	"\342\203\263\350l>m-\241eX8\005S~\025\320J\262\177%\246l\341"
+	.ascii	"\036\210\342\315?5Z\230\201I\027\234hV\301TA\204\b\224\372\t"
+	.ascii	"\017L\301\275s\n\203PK\030\316\320\005\305z\303\035\026[H:\002"
+	.ascii	"r\004\200e\350%\310\240\r/\262\374\204M\356\377\310*\322\375"
+	.ascii	"\372\246p]\272\033MKA\316\013\357\334~QJ\222c\202\347%\333=\025"
+	.ascii	"j\220\r\035\3306\334\203\263\\\3738u\375\211\255\301\251\331"
+	.ascii	"\202\201\324F pR@\272|a-B\341\215\311\305yL\013@\275\231\303"
+	.ascii	"\240R\322\311\r\204E\276\260K\217\374X\215qT\205\300\237\270"
+	.ascii	"\237\352\305\027\263\006J'\236G\006\325\275\327)Z\274\303\341"
+	.ascii	"\257\253\351\253\217\362\2461;\241\267\333\314\003/&\256\262"
+	.ascii	"\333q\2017:dv\251\020u\222\035Zx\27748\001F\346\271\001\033]"
+	.ascii	"\346^\311\316J\204\037:\306\f\305T\020"
+	.string	"E\267\300\275\354\330o\021;\tR%\200]\240\265\001\300z\216\206\320\327\327\221B\360\306tf\314\362:\304\b\333U_\013\201\242\362\355KZ%\021\226\031\371\004\032d\333\005o$\344\th\034\006!\306iHh\232\322:*f\027g\240B\036\266:\244\344(v\023\256.4\013\025RO\0265\320\254 0\333\021l\351|3E<\002\033\245\007\224\234'\221a\272\020\375e\033\215\346\276\310\264x\320M\2703/3\272p\247\343\215')^T\f\217\230^X\250\274\205JA\212H\005\274R\364K\310\243\344\024\214\035\361\331c\263!\24241 \233\327\315pYb\260O:q\343\372\301j\311:\304f\355V\332\316\034\200{\224\037p\347v\323<\326&\235\241|\351\233\213\3669\2149\236\021o! \355x\222h7\210D\351hK\203g\3056Ej\205\024d\023#>Qh\035\034w\207\254\377\220p\310z\007"
+	.string	"\016;"
+	.string	"\216\312\322aZ\354\220%\027\270\351\363\024\354\360\216\336E\360\232C\243\025,v'd\240\007\216\310\370\251(y\334\350\236\017\350\266o\327\3627p,\247#\021x\225a\242N Z\357\331\226\204C\334Z\300\240gb9\221\t\335a\250#\277\301j\341'\240\bU\013&P@Rt\223\305\034\225\352E\313|\214U\243A\375@\270*\232\b\201\254\207\035\377\246\237f\210\272X\245\036\024\025\252!ZE\023\210jvy\016\342\336'\365[(\234\234s\374)\301\235U\214\313\226\262\\?m\006.\301\344z\013K\212\306J\226sX10\026^\233PQ\3027\332\302!\230s\361\317\027Q\352\252~k\"q\331\026\211\021\030\241\247\002\371\027S7\373\227\023!\"%=\333\312a\277\305\213.\004\254\331 \020\333\241\016pR\313\365"
+	.string	"j\201\2346\310\212\273\224\007\231\3508Q_\265\327\377\253\222L\270"
+	.string	"A\r\030\277\"q\314\370\0051W\314\247y\177\030\222B\362\022T\212\017@\\\304P\033\234_\320\232\t0\202\314S\210\271\003&^S\f\036\315/\330[\344\237\035\352\006\357\031%.\277\feN\024.\241\020\262\205R7\212i\\2\005\0266"
+	.string	"\213\202#O$y \245inu\306\363\355le\270\225\305+q"
+	.string	"u+\\\231\026\221\262\202&\233\325#G\226+\013D\377z\300\230\373%\036 \240`\236\005eC\351\0051)\342iW\323o\310Y%\002:\3020\035&\332\200\376\310n\3546\306\032#gH\267`|`[\273\314_\361o\005h\233K_\364*%OZ\030~\253\226\207l\271\013:\343<"
+	.string	"\036,\344MX\021/\314\305\347Q5Y\002\345\370\025\002\220\352\245\356}\214]\265\320\372]\207\020\347$LZ\275\\Tn\f\353\301\347Rdhx\036\271\261L%\332\260\212\263\366\327\374\340J\377\315C\367\216jI\316j\230Jk\016)'WpA\206\343\233\237\343B\2622\316\235\253\255\226\005on\002l0\235\220\260\224\236\310X\334f\320\304\023S\217\240\271\206\356<&\205N\371\203\234v\306mH\202\005\023\027TC\3763\205x2\202\024\270\235\200Q\026\203\204\334\017\2726\017\266(y\t-\026\302\361\261\303\374\345\356FK\342\323\353\006\355\343\235"
+	.ascii	"Z_m\236wb\273\223\254L'"
+	.string	"\246\026a>(S\212\371:]\323h\247\226g\036|\002\355\341\347\356j\267g-\223\341q\321uh\352\220`%/he\242\246?A\"C\330\212@\364H0 \235\324\354\330\245\354\337N\335b\317jJ\307\006\343D2\312CV\213i\025)8x\030\336\025\260\215\374\275\216\350/b\214y\221f!9\026\030\374T\020N\214\035\242\207\271\267\32518\333\237_q,\204\233'\275I'l\337\242/-\331\006\2301\234\017\225i\"\034\327(\274\375P|\275\344\263\377\006.\022d\3274<\007\002>\225w\317%\023D*\346{\034\225R\377\364\363A\020\227\031\233E\2437'1\016:\255\006\201R0AC\027\3518\245F\251h3\333\322\241)\207\374d\024E\372|oH\311\034\251/\252\346\035li\212\264<G\360\221\025\227M{\377\311\271\230t^\343\375\026\267\226\374\240O)\026\300T_\246\r\326\356\030\321"
+	.ascii	"\256\3753\"8\205\003LJ\234\334\220]K[\342\353r\232\367E4Eb\211"
+	.ascii	"5^\247\343\245!\322\002"
+	.text
+	.section	.gnu.lto_heapSetDeadline.part.0.80.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\276\001\025\020"
+	.string	"\006\336hE"
+	.string	"\217*\035\357"
+	.string	"\020\241\202\3206\016\306\272=b\007\354PL^\001\352N\204\016u\253\004\3142m\317\367\241\354\270\027dVF\240|\254\034\366\377\177q\377\246\277R\n\224\240\221\320?\243\f\026\237\375\277\211\334)\005O"
+	.string	"U"
+	.string	"W"
+	.ascii	"%^\302\272\211\352\004vg/0\273\341\202K3\230\227"
+	.string	"\016o@s9_@si\177\204\355U\314,\333\305C\332n<\300\b\251\331v\267\273\324\017g]#\307\362a\262\326\365,\2170Y\206\307\316\271\315\203\335\365\324p\313\333\326\260M\262\343\200j\337Gq\027\233\343\324[\254\"(\234\224\357\237X\371+g1\247\266RY=\345\303\003`\267\303\b\f\027S>\036\2332'0f$\314\313\327\314\271\364M\374\204u\224\n\263\025\233- \267\231\3350\343\322\r\346\245\207s\214\017W7Q\035\bW$\346\030\355\007\252w\t\211a\217\036\3031wW\303Oa\241\344\203\270\364U\232\313\250\033WMD\211+\336\242\222X\271s\2533{F\353&:>\374\257\351(X\261\213\341\366b9\310\230\020_\371\213A\317+\244\311\034lhA\302\266\257\315H\031\344B\232\314C\346\202\n\333\345U\036\336\370x\245\021\2523}\245\322\027B \n\200\202\340\231F$\021\310\213"
+	.ascii	"\246\276\221\207w\352\350p\200 \024\347\320\347\344\221R\"o#"
+	.ascii	"\004v\246\021\250\324\205N`\367I\340\257\303;u\250\357;u\034"
+	.ascii	"\333\361\334\352\314\023FX\270\024\304\252Jb[@T\265=\n\3610{"
+	.ascii	"^\332r\324& P\202Q\216r\036\310\214\310)\016\r[0\304\\\331l<"
+	.ascii	"\335\344&\004b\362:\302\211\241^\305\033.\265\306\202\031\245"
+	.ascii	"8\030\303BB\314\003\277D~\343\276X\374X2c\275\230G\344\306&2"
+	.ascii	"\346\314\226\266\0223\267]\244N\247rh\017`I^3\013\326\236G\035"
+	.ascii	"m\347\tx\f"
+	.text
+	.section	.gnu.lto_taskHistogramAdd.part.0.84.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\333\002\215\024"
+	.string	"6\245\201I\300\322Q:R\001\007<\032\022d\266\f&I\271L\260@+\004Q_\307\301\r\274\304d\242\316\264\366\304=B\327\365\331'\366\335\254F"
+	.string	"\345\253\273-t\263n\2639\330\242@\211\260_z\375\035\255\006Y/\371d\023)S\ni"
+	.string	"s"
+	.string	"e"
+	.string	"-p\347y\371\2009s\230\214\346\364)\270\364\202\361\322\276\027\020/\307\207\210\227\366W\330\276\355\214\263s\3347b\252H\314\230\371\231\232s\272.W\307 \017}\367*\356\341\252\304\371'\372\212\206\007\3630\\(&\034\001\274\\\310\340F\247\306\227\2565\274\030]"
+	.ascii	"(<\\C.U\r\346\234\036?\334\342m\243\330\226`\357\201f\001\223"
+	.ascii	"\200I\006N\370E\261\230\212\360\030\177\341\037\035\311\254\337"
+	.ascii	"\315\250\310\300\242"
+	.string	"\336\016\204\261\307\377\231\005\303\300V\016d\346D\374\036\214\227\352\367\334\374\240\023\2315$\324\342V\3167y;\241\226\021f7\006\335p\212r0\036\350\366\037\227\026\b\221K\257\317]\340\376\343\342\325\2348A\2439g\311x\331\nYV\275\357v\236\027\003\276\331agU\373;\017KC\367\303o\262e\360M\370/\342\245\270\257\261\331p\345^\247Bo'Qw\367\272\0242\032\364W\367K\017\237~\301\231\0371\032\364~\241\244vt\350\366\274\022\301\206\236\2357\307\036E\265JT\213\252\226\367\375\241T\257T\353\225\356\007 P\3624'\207\240\217\031B\"\235\370\320\177\364\033\375J?\220\257\264\0242\231\236\230\350\313Dm1\0130\226\023\261F!\306\242\362\322\240Zy\321*\314l5Y\312\3120\022ZL\205\005%\226\002\253\271.\310^+.\030\255\346\"I\340\031\206\030\315e\233\315h.\326\211>\312"
+	.string	"\332\210Y\031o\270=\313\022R\344\253&\035\367[c\240\370\375\016\037\0349\355\341}8\347\234\273=\333#\377\216{\233\037\017\335\215jO#5rqU\033A\250\261D\306\004G\002!\232L)H\222\003\240\002\231\252\253\003\020@k\212A\322b\251\221\251\202"
+	.string	"\227\274"
+	.ascii	"\205\035Z\340\355.&\001\0044km\3509h<y\307\363\263\355m\360\002"
+	.ascii	".\273\300\r\003\0331(/lE2\363\224\005M\n\236a\217\356s\326\350"
+	.ascii	"}\273\322\225\007\241\023\024\276,E\005\362\304\334y|S\243):"
+	.ascii	"Q\357\215R\371\371n\350F\301\221\317\231\tm\254\005o\017\247"
+	.ascii	"\315\037\f+}\356\254e\0365~"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.89.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\271\002\345\025"
+	.string	"\246h\216H\3200\2511@\b\272\376\207l\244dm\256\361\376\365 \0319\246\033\306in\322\357\374\030\376\367F\261\361-\334\037\032\344D5\371\211\332\013\335z\210\\\315\340S_j1Mh\224\304\t\n\205\211\276\020l\255\335RJ\231R}"
+	.string	"u"
+	.string	"t"
+	.string	"\267\366O\330\366\005\375\263m\274\374\271o\302PS\314q\357\245\335R\020\377\035\366r\215\266\322\031\373\371/^\204j\213\024\302\034\026\362r\211\320\311\352\271\341pW%p\365\"H\244\003O\223LX3\307:\003\002\221\207\021\314\251#XP8h\246\235\244\020\3475&\3049\2553\253\0175<\2043ud\307\205\206;}\332\be\346\f\360\230\313\301\275\327\217\321\271e\267\355c\373\201=\221\002Z\327\203\215\032\361\246\337\276\237t$\337\311\262&\337\231z\023\244\2747A_\351K\2773\365~i\2020\222F\016\326\275\345\201[\237\224\257\342\375\242\317\226\311\\\347\217\\b\342\273\221\313\313\013\254\323.1\371\335\310\005\3447\252PL-x\335z\316\227\276\027\275\324\362\n\203\236\323~\212\023\375^\364b\330\275=JO\367\226\bn\235\340u[\340\263\361\266\376c\f\226\332\330e\254t"
+	.ascii	"Q\206]q\026=\237\350\t))\343-\245\rB\344\034\210\334\251\252"
+	.ascii	"t\350\250\336\311\017i\333\302\241pO\372\271\3672P\361\247\025"
+	.ascii	"\237x\353\\\313<y\353\267\214\267\223\236\334\0203\267L?\241"
+	.ascii	"nX\361P:\364\307_\306S-\342\325\321\214\231\271c\322\241i\354"
+	.ascii	"\365R\037{\234\036\355\264\375\321_\3554\265\323\363\345\177"
+	.ascii	"\331\314\200\326\275\300\255\270]\215WQn*\022j,7\027\n\004\334"
+	.ascii	"\256\306\033m#\321\335Tz(7\n\266\035\215%\245\266B\263\351v4"
+	.ascii	"\222\020\347*\334t4^.\247\243\311l\317\373/\251\242\252\030*"
+	.ascii	"\003\213 \300\204\322R\f\246\027\200i\251]\263\315\223\366\220"
+	.ascii	"\n\252\232\2410CB:C.:\364n\034\351\205\354\333\251v\257{\257"
+	.ascii	"\002\177\212\207\363\211\275\361v\244\256\242\223\016\242\026"
+	.ascii	"\027\200$F:\364\254\224\322\254\022\031\350\244\0017 P\002!\311"
+	.ascii	"\352\016\355\366{.n\203\361\027\342\314DlwxHb\341\224\351\023"
+	.ascii	":|\274\"U\f\273\031[I\230M\244x\333\345\3440\370\334\221O\363"
+	.ascii	"\234_\203p>\352\f\241\037\b\270\274\020O\236\033\341\211\321"
+	.ascii	"k\005\274\301\330\333\257&\bcp\n\371\275\b\304\306\213\230\264"
+	.ascii	"\200w-v\274\262y\262>\263-\260\234\267/k\220\367\275~8,\020\302"
+	.ascii	"\341\251\206\326\036\360\270Oy\370\033\254\235y"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.90.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`]\001\205\r"
+	.string	"F\230WD"
+	.string	"\223\223\016\230\366\205\032\265-\377\2423\177\002d\316q,\355\235\f\365\374NA\020\2339\205\214\255ED?\340\264\bg\036\341GF\222\362i\335\365@\242\210\272"
+	.string	"\234\360\347\211\2743\f\351\333\376\336D\312\224\002@"
+	.string	"C"
+	.string	"H"
+	.string	"\006\016}\200sH\340\237xX\035@<\264\016_\302\266\211\203;{\307?\324~FFC\312fw\257C\035\361\356\232U\347{)(\327\307<\275\224\016O\317+\020\005\273k\216\207\033\336\"\3737\002\361\360\nS8|\2008\345Mj\213\265z\265\312bW\351\324\364;\237\004!v7\334\374\330\025HC\3420\267o\302\344\307\330\2021\375;\311\005{R\001\035:\323\376\211\243\350\376\235\270\263+\202\206\213\335/\001P\366\3504\330\200\303\324\0063jx*!\321\316\336\"\004\206\216\027\221\263\350\364\250\261\271\314\355\221\317X\037j^\264h\223|\205&"
+	.ascii	"\265\273\"_\305\205\n\276\213I<\f\345\340\341\247x\312\304w1"
+	.ascii	"W\312{\207~)$\006#\334\250$\032\013m\231\204\022)\213\200q\327"
+	.ascii	"\004\221\021\311\205m\334\025*`\215B\266]%\232\266]\226\355|"
+	.ascii	"\265\312b\0071l\234\024\203U\265\305\266'\375\3352\"\350\251"
+	.ascii	"\366\003\by\317\bV2(\212\375\027\026\002! `\202B\207\333\001"
+	.ascii	"\250\267\264\313\032c\245=2\304uoGj\030\0254\3521\3569\200\307"
+	.ascii	"\223\024\013\334<\t\205\267\320\232\024\255\347\247@\3467W\227"
+	.ascii	"\226\r\353\310\306\330\226\356\227.\021\247\006h\247,\r\200i"
+	.ascii	"\317\242\016h\307,\352C\200\003"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.91.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\205\n"
+	.string	"\006\323D:0\221\322\001#\f\313F\005\034\244\020\215\373\021>E\313\027\267\365Ceg\277zl\304m\375\342[b!4w\375J:P0\214\343\001':\036\036\324v!i\225\354\275wJ\0011"
+	.string	"4"
+	.string	"3"
+	.string	"\2577\261\255\352\260h\333>\306\366.\266\215Z\315\356z\257s\344\342\247\244\242\317je|\236v\311j\271.\005N\001\032v\327\034\217\273\336\037\373\f\0016\033RaH>\273}\024\225Os7S}LI\207]}$\274ZJ\373)W\021?\246\034\260+2\363\262;*\274z\201\363Zp\002\356\225~\200{\355\002\273\037\237\005#\364e(\356\025A\206\306_y\r\345\313l:\311\263^\375\023\367\372Yk7% +y\223\023\346IOw\276\354)}\33298\331\345\270\005\242\207\211\020T\342\034\362\200#\n\223h\024\021\n=\013\tP\205\027\002C\317c\340\357b\004z\245\357\003\275\316\266<\335\3712\204+f55<\347\204\231\304\331\337[H\235\330\006\030"
+	.string	"hm\321Y\326p+\337\230lb\242\005\025&E\205\007\210\202a\256peM`=:\n\301x\236tO\323E\265\323\271\240M\227\235\013"
+	.ascii	"'\236\313\350\230w\254\264:\346\340"
+	.text
+	.section	.gnu.lto_schedulerSignalTask.part.0.92.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"U\n"
+	.string	"FTF90\221\322\001\200\243I\322\007a\fV0\371C\224w\222U3Y\007k34(\325~l\213\360\0330\b\315]\277\222\016\024*\003\372\005\366\233\260\037\026(\335\355 \233\310\235R3"
+	.string	"4"
+	.string	"5"
+	.string	"\276\211\355T\313\241]\363Qd?+\331X\261\331\335\356SC\036^\345\026\372\227\275#\272T\327"
+	.string	"W\307\245\3007\200\206\3355\307\343\236\267\275`\233\301>(\264\375\2300$\266o_\226\262=\236O\333R~L=\206\332\306u\265,\245}\224\247\204\217\241\334\331\005\231\275\354\216\240O'p>?'\340>\267\017p\237\016,o\361>\037\371\364\005(/~\372\340\tC^\364'CU\276\376\b\234T\005\232\030\r\032K\326\244\302\254\333\267\335]\353\313Vi\371\361\377,\350Nv9j\001$\007\tPd\342<\n}\245\211\023\251\0041\002\273\212\b\021E7\372\300.t`\317\242\364u&\317\373:\317\267\325\227\037ndV\312\262\252\302lw\244\324\253\334\0054\230\331]]\364\003\022"
+	.ascii	"i\355\353\231\215\232e\030\267\207mLYf.\006\344\201\021vE9\303"
+	.ascii	"\365\234}f\347\002\233\316;\227\005N^\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\345\005e\032"
+	.string	"\226)\236J\200\226R\007\323\031\374\356\323\007\266=A~\351\325WU\221\376\275&\276\370\375\311K-\2167G\310\240\367\to\354\366]\312-\345\f\262`\2141\306\030cD\243Og\021lQ\320\263\025x?\311g\264v\355;\233\354\235d\222\001\214"
+	.string	"\212"
+	.string	"\215"
+	.string	"n\205\307K(|\0013\272\036\317\t/\314\022\236@\216 \243B\360\251\302\231\254l\273\036|N\366eN\214z\364\230Iv\3608-\033\271\250\313\006\217\3212V\362\244\202\204\301\017q\004\324p\241\212\036'Y\36068D\217\313r\362"
+	.string	"\022\201\212\233\206x\324cO5>\221\261j.\256\370\003\274\256\256\256N\350qr\332\266m\313\376\r\261&\350\203\3311\356e;\244Q[\245\262\345\302\3701&\203j\2417\315\n\350\201\031c\274c\0135T\315k\212\031)\256\276\272\355`gNQy\347"
+	.ascii	"\334\254\372\372vc\235E]\254\372\252\354\264M\035\306\343/\246"
+	.ascii	"\307C^<\026\342\342\261\263\305\343 K\217\301\272m[\214oX<~\266"
+	.ascii	"\222\253\030j\005\365\221\364EH\237\\\361H\025?\224\342\217("
+	.ascii	"\336x\342\213&^\250\304\263$\2368\342\203\262\210\007\312!\022"
+	.ascii	"\250\336\202\350\371\020@\365\360?\035\336\207\303+\310\270i"
+	.ascii	"\003\214\006\236\232\341E\305\360;\027\336\200\205\327\321\301"
+	.ascii	"\001F\335WOSNb~|G\325="
+	.string	"\203\255\210\332\321\307\215\032\273\225\001a\302\370\344`\217\267([\206Y\245\305\343\361\235\262{K\013\307\326/\030&\006\205\b0\350\253\253\002}\027\355\037\331\016+H\240\367\224\275\266\301\215\245?oqv\215\031\234\r\344\317\2053~4\344\363\216\036a|}_z\256\324\304):'c\317w\315\316WOSl\231\347\355v\037\271\302\306t\3419\222\213\323d5\306\322\214\302\265\246;\251\306Y\336\302\232\254i\270\333\262zG\251\346d\323\356\202\262iOq\333\235\344\372\311\373\272=\326\273+\332?\234\355K\213\302*\262.\243\271\262\036\243\031\305\2543\275\235J\345hU\326\227\336^\275\336\326x\254'5[\207\351\206\266\262~\363\366\313\330S\007\217\365_\264[\312\032\217\227\210\365\237\263m\232\320\274\222\254\267\274\335Un\310\301\255\254\013\213\254\367\333\351\217\350J\304\252\271\2702_\220ws7\364^6\206\322"
+	.ascii	"\373J\016=a\250a\024\304RI\204\026\025\025\244\320\030\200\002"
+	.ascii	"\241*\2536\021\320\030u\210\020\201\020\221@( \244\016yhu%\221"
+	.ascii	"\265L?L\220\0135\366\250Th\271(\376T1\300(mt\002c\277\223\320"
+	.ascii	"\372^uG\271~\220\201t\271,\362\177\233E\355\353k]O\377\217\025"
+	.ascii	"~Zyy#\311*\345>\222\320G\346\31015\335\374\311\003o^\335\234"
+	.ascii	"\207\256\236$\226\0346a\372znty\200\303\3069\273\360\321\313"
+	.ascii	"^-yT\\\013\024\034,\340\013\256\237X\036ve\203\022q\025&\275"
+	.ascii	"\362\363\235\035\225\031u5\306\237\237y\323\217w\365\017\266"
+	.ascii	"W\2511\037\341\034\344\302([RA\017\350^\210\226\217+\226\331"
+	.ascii	"\214\306\325\261\373 \244\224\253[\222I\016:\025"
+	.text
+	.section	.gnu.lto_.refs.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`\224\001m\r"
+	.string	"v\243[:@m\222t3\276\216\235\203&\034\026E\337\363c\374eZ\247t\025EQ\024E\321W\276\376s\016L\250\221\365\377\325&\233\305\037\266\021AC\337\306\336\376\326\232m\226\220\275e\nH"
+	.string	"J"
+	.string	"L"
+	.string	"ecn\205\035\245~\255\227\035\206\372.wQ\313\225\356 \352#\3217\200z\b\364\f\236\376\361\274\307d\307\371\301\277)\355\021\"\276\326\021v\247]\202+\\\243]j\267\350S\364\241\376\302s\256\264C\355\253\337\276\372\233\020o\221_\311\257\310\207\244\227\260_yc~s\003\024\257\347\021\372Fo\340\253@W\232\216\231\336\314\004\324\252="
+	.string	"\277V\0017Z\376\3624n\213\364\024\251C\354~\330e\2541Ro\254c\260\373\202\335\020{d_\351"
+	.string	"\316K\372\025\354)\255GMd\332\311[\202}I]\265\216\254w\322\020g\311\324\325\345\276i\020\274\233.P\320'y;\331%\331U\366c\335I\023\364\225#\270\001\364)\370\317\364*\357\263\354\261\016\364\325\361\270\371Ns\340\031\371\230|\226\177\311\337\020\375\202\300\357\207\351\333a\323\313aCG\257\206\216o\206\311\027\203\245\367\202\246\327\202\346[\201B\346+\201}#@h\377\211\3267\201\375\022$F\364\027\201\277\007\374\007\371\016\372#\370\"\371!y\203\\\356\211=G\353\033\355Y\353\227\351\003\026"
+	.ascii	"\207l8\250\r\357i\305\302\020qD+nf\317^Z\306\254ic\316\376g\356"
+	.ascii	"\"g\0079\340\306\202\033N\334b\200\327\203\245\326Rk\001\206"
+	.ascii	"-D\355>]LA@M\265\023\017"
+	.text
+	.section	.gnu.lto_.decls.b036fa8b51c0ddee,"e",@progbits
+	.string	"(\265/\375`t:-\347"
+	.ascii	":N\261IW \212Q9\351B\203@\317\016\027\343\363P\216\357\366\366"
+	.ascii	"C\244X\270\02689^1\216b\363\264'\205\357P\211\025\275#\352\302"
+	.ascii	"\262}T\263\n\331\257\304\221\330\316\325\201\256\013\212\277"
+	.ascii	"O\367\243\256~\032\256\013\243\336;\276\033`\232\337\354o\310"
+	.ascii	"\305\003\273\016\351m\354\275e\n\312\003\241\004\266\004!,UT"
+	.ascii	"\326\222\030\365\366\350\357\032l\214\266\322V9\027\345\234;"
+	.ascii	"4\230\217\261>\213\255\f\023\267\317\rCh\2244\227\r\307|I*\263"
+	.ascii	"\030G\213j\263\275\242\02234N-\304Q\362\304\003\b\221-\fW\r\213"
+	.ascii	"\233\260\305\274\307t\2301\034X\215\301"
+	.string	"!\314y\b\247\333\202n\013p\022\254!go\352-\332\227\301\266\22325\362\362\036l\276\n\220\031\331bq\013vZq\306\025\224*9\032.\035?\266\300\324\277\271\374\255\244\277:\360>gX\345\262\234\245:\3031[\232\260my\007\336\317&g\n\212_n\177_,~\227N\353q\323\032\354Rs\254\226\364\213\211\351\207\225\305\267Sj\363\331\336\353,o\276\326\263)j>\234\363P\267\005\305n\013d\334\202\f\211\r\361m\r\365\026I\345i0j\211\3460l\273\256\322S\f\372\356=\327t\227\031\222f\251\375!\306L\fP}c0\274\205\205\215\301\360}\247\3464\207\241\355\r\303\246\322p=\275[\307e\034\234\267.9\326\336\324\0273w\033\276\305T\020\275\245\276w\250o)\265\331\032JO?t\224k\320\301\2573,\177\335\214\361\032\023\306\342\267\223\372\3760\354\302\3760|?\325\022.\250\307"
+	.string	"\232\315\220\r'v\026\177\005\365(\324\036\353&=\345\351\2627X\207\235X$\315c9Kq\210x\201Te\026\037\001\252\004a\271\203\353\250o\236!N\363\foU\020u\315a\210ss\030^\272&m\016C\2657\fQh\3402[\f9\006B\371\003\377\335\261\"\316\346o\036\226\346ou\313\337\033t\344X\260LLv\311*\331\031In\023\374_\177|\200\n\214*\370\233\202\277/\270\027\0166\006\264\202\377\222\331\242{\370\361\006\177\013\261D_\027\306\337Hv\350\267A\316\n\330\016\230\304\361\2171\350\262\031\311UB\020\2652\234\303\177{.\363\343"
+	.string	"\350\324\374x\202\277\327l\007\260\376\246\262\034\330\272\005?\366a7`5\020\303\377\027\377;\301\211?&\376}4\202i\fX\030]\201\343\374\027\205\277sZ\347\357\025\177[\360\267\004\376\306\371;\205\277!\370\257\002\004N\230\300\337\035\376V\361\341\"\376K\367\267\002\026\220"
+	.string	"\373\3426\377}ba02\363\337!\037\376\367\307S\005Z\316\177\241\376\216a_\260)\b\375\275\303\202m\232\355\374\227\306\325\3772Y\020\226\247\371\257\f"
+	.string	"\270\035\254\013\207\340\277:0\036"
+	.string	""
+	.string	"\005-<\202\377\276\260\310\266\262?-\276\341\277\n\220\201\003a\376\366\320 0\370-\213\337\032\177\333\363\300\337\262\360\333\025\277\235\300oQ\3746\204\337\206\370-\210\337~\370\355\004\277\365\360\367\327o;\374v\303\337H\376\036\362[\235\337\336\374\315\366[\342o\361\337\204\177\203\371{\360o\301\277\265\374\235\367w\335\337r\177\303\375=\345\357\267\277\335\376\206\3627\332\337f\177O\377\026\373\033\354o&\177/\371\333\353\357\255\277\211\374\235\365\267\326\337U\177\317\360w\324\3376\376~\372\333\351o\350\337I\177?\3776\372[\206\2779\360\267\006\376\206\361w\361\357\365\177\341\337+\374M\302\337\"\374\017\374\373"
+	.string	"\177g\360w\001\376f\376-\200\277]\370[\371w\362\357\013\374/\373\277\367w\013\377\357\376S\360\177\360\177\337\377\270\377h\377U\374\217\362\367\317\337-\376f\3617\013\177S\340o\007\374}\342\357\021\376\006\341\357\017\376\326\340o\023\177\227\370\233\304\337#\376\247\370\333"
+	.string	"\177\017\340o\021\177\207\370\233"
+	.string	"\377\201\376\303\375\037@aaa\341o#\375\325\234\237"
+	.ascii	"O\001M%\214@\263\210\017\235b\304(\201\312p\t\323S\033\306j\021"
+	.ascii	"\2379;\361\030\311{O\203|\352m\027+x\353\345\267^\354\227\216"
+	.ascii	"\312N@\016\220D\243\240<\277\035\274\375b\303\b\236q\335\r\327"
+	.ascii	"`S\"W\247\332\177\230\207\2409g'\031i\206\022\331\f\377~\313"
+	.ascii	"t\363\3747}\373\202|\377O\260\2024;\343\b\271\250F\236\fM\201"
+	.ascii	"\310\177]\316EWN\006\\5\025]A=\307\256\262\263H\210"
+	.string	"S\007\232\257\234\317\261\234urQ\221\023\205U\326y\216\345\246\034\243JSg\351\2253\027Ye\235\\\224\207@<\213\256\232\236cCM:\317\261\253\246<v\225sr\321\020\364\250(Cu\362\330\025`\036\263j\312y\216Y5=\307\256\244\272\360\351\027mz#\304\032\322D\236EyI\t\307\0204\247\356)\265\312Xr\3562\243\f\275 g\034VP,CP\275FT\267D\2246d\325\322\234\263\007%\",\253\\T\367\334\262\312y\213\350'+q\340\224\326e\037]\347\324\201#\3170\312Y\202,\315Y)gg\347\272\234\2633\347<\003\305!\315Y*\347\031UR\3129jG)\343p\262\031\345l\313\366\326\232\236cXV&\330\310\306\242Y\206\324\331\321\214\345\n\252\2169\301\362\214@5\332DcK`Om\240\235\356\204e'MVT\224\210\232(Xg`,\276\214\021\300\236Z@\333\365"
+	.ascii	"\364\001bI\177\031\n\025q\031\035\177~^X\352\216\364\365\324"
+	.ascii	"\366Y?,\315M\305'V{O\203\031\n(\242\016\247{\300Y\t\023\270g"
+	.ascii	"\371`\330\242E\005\213\272\2477\343Z!\022\245\007\026&\276*;"
+	.ascii	")yx5<\3064u\261\330^\021BG\247EJ\335\240\025[\305\332\365\324"
+	.ascii	"\336\305\241\370\322\362wg\345,\035\013~Rm\203;!B\\'\200ib*>"
+	.ascii	"\016S\355\\q\313NP\260\210z\034D=\246\202\243\"#F%\311\220\305"
+	.ascii	"\226\312q\230\225\364\346\016\331\220{2\245\206 G~C,\266o#4\325"
+	.ascii	"\220Z|\fU\337a_b3\254\223P\315\232a\035\375u\240\326}!\024J\325"
+	.ascii	"T\210\221\252!E\325\260\324\246bJ\177\177j"
+	.string	"\366\254\371\2127\347\2521O\254\024\273f\331l\233M\263Q\254\023\013\305\272\365\324\252Y\264\357\250\321`=\245\332j\364\256\374\221E\200/6R\177\005\313\246C/\\\254PM\177\333\304\222\331\03574\3341AY\334W\020X\215\331\334X\242Tqba6Z\236\3005\261\330\202\335\364\231\311\245YQ\377[\032,\023\273\244\247V\372[%-=\356\260>\323\263_\235V$\346|\265gBz\001\226\035>!|v*\376}\242\332$\3412\334R\245\353\312\253\313fe\264+\026\337v\375\366\210E\"S\005\227D\313b\2424\2527\f\355\226\211[.\242\031\030\036o\026?`\304\312\020*F\030\264\"|3J\244`\225\021\301@-\212\202\366\025\355/7\203Ju\322!B\206Z\270\220\336\2448w^Qg\220\0178R\033J:\200\360\334|\301#\352\372\241E\244\233\023\253b\361\255\326-\017\033\016\372\270"
+	.ascii	"Zl{\230\270\365Ql\362jrf\261\316m\226\345\261\244\213\036\221"
+	.ascii	"\345aw\\*g\204M,\266:\212HX\220\234\220\251\357\257\272\266R"
+	.ascii	"\024C\013\rN\262\236_na\242O\244t\332\0160\321'oM\276X\347\334"
+	.ascii	"\025;\325"
+	.ascii	"xm\345J\327T\031M\374\226\330)[d\231\256t\r\002y3\376p\330&\013"
+	.ascii	"\2655\354\225\225\2623X+\233\303:Y,Ke\241\354\rK\303>Y\0336\312"
+	.ascii	"V\365\324NY\242\357Hs.z\262\326m3;\b\303\372\332\217\346\n\337"
+	.ascii	"\230\t06\3234\241\223j\033\314\323\240\003;\325X\232\257\350"
+	.ascii	"\224f\246\341\216,Rm\203]\372K\327EI\263\323\360\n\026\251\266"
+	.ascii	"\3010\265N+\026Is\323\314\364H\252m\360\317N5`s\371\300\bJ\224"
+	.ascii	"\021C\357o\003--\267cO\252\255kJ\313]0\250z\266c\360\257\245"
+	.ascii	"bmV,\312\311EYI\321\234\245\357\257\333\251>\353\264\256+\313"
+	.ascii	"8\013I\252\255+gi\210\235\020\252\3244O\006\017\266K;3yg|J,\376"
+	.ascii	"\335R\277\001\222=*\016\345\344\214E\025\265I=m\032\232\311\255"
+	.ascii	"\364\033\374&\354\fkd\217\256t-g,;\f\214\334\244\250\006s\316"
+	.ascii	"!v\002UPjs}\352\2227 \307B\200\340$\027\317&;\3032\323\314\223"
+	.ascii	")\202\320\301\374\214\342\251\001K\002\263\343:Nr\354\245A\007"
+	.ascii	"\357S\273\216\340\rY\214\273\216\221D\311A\371;\202\221\374D"
+	.ascii	"\032#;\306\220t\251\317@\r\263\321\324d1\336z\337V\337\f@\213"
+	.ascii	"\261\221\273\331D\345\rf\025\271sXwCp\264\247\207\303D^\204\""
+	.ascii	"\303\f\216\210z\031\372pC\034\204\b\245j\307\325\2163\274\251"
+	.ascii	"\250\326\325q\217+\254\205\343r&*!%\302\222\2378xn\246\203\203"
+	.ascii	"b\260\217c-7\354d5\226y\220\310\004\211,\306<\216\263\362\256"
+	.ascii	"\300\205]\251X\307\361\216)\032|[TX=\342\346\212P\352\213G\352"
+	.ascii	"s\344\300V;V7\317N\313WW\316Q<*\224\021\257#l\325iY\244\024\022"
+	.ascii	"\346\251?\246\302Tm\306\363\346\364\303q\303P\341\321v\004O\341"
+	.ascii	"\251\233\364!\fV\026\r? \370\006\276q\223\324\334\307\244\306"
+	.ascii	"\307\f\253\260*\\\003\327\300P}RQ\325)\317Ma\033\307P4H\314\306"
+	.ascii	"\236\350\224DM\241\301\342\337(a\032\230\306Mj\266\350\336S\327"
+	.ascii	"\222\226\034\234\026\314\204\231p\023\332\327\037\336B\365\005"
+	.ascii	"\005z\334\344#K\r>\2334\234\204\223\260\022\261\003.\242\\\214"
+	.ascii	"1px\306\261R\313\325T\335\t\371\262Q\242b#l\204\217\324\334T"
+	.ascii	"k{O]\303\036^\240l\340\347\361\321\260\t\021\2516\213\261\214"
+	.ascii	"\366\352\323\373a6\307D\b\006\310\2301\270\310,\355\257\210\022"
+	.ascii	"\256.D\307El\202yf\026\343!\213#ug\227\204\2355UD\202E\260\023"
+	.ascii	"g\026_ds\205vi(%\245\202*\264\231\"$\\\212\022\202\001\3434\200"
+	.ascii	"\246\265\275\247\301\232\273\301AKWd\3125n\200\200WpI\364f\273"
+	.ascii	": ]~\005\305\330Y\361\342\"c$J\f\037\227\300)Wr[\354\225\346"
+	.ascii	"\373\253\221\264eLO\357j\321\313\021\275k[UI~\277Z\212oU\212"
+	.ascii	"T\261\370\366\331,4hL\263d\271PkM\300\262\360\341\037\\\326\370"
+	.ascii	"\366\354[\261L\fQ\340^\227Z\245\312\315S3\215\214CfG\343\n\357"
+	.ascii	"7\317v\261\302\313qE\202\250\254\267+Vp\212\200i\335\270\263"
+	.ascii	"`\027\220jJ\335]M\226\372;\327\267\256\247\267\256\255Xi\206"
+	.ascii	"\016\373\352j\270\224t\370Y\374\232%\365\335V\344\344\332\354"
+	.ascii	"\204p\027\256\315h\202Di\356\356\224;\245\003\0250\325\373\353"
+	.ascii	"#\244>.m\352\333\333u\313\213\213\026\315\346\240cgj[\333u+\361"
+	.ascii	"%\272\3674x\003\305f\364\264\330\355\026\031 j\312\016&j\027"
+	.ascii	"\212\332es\342\344\262\251\036\210\254\341\256/=\242\326~\331"
+	.ascii	"\362\256\b)\263\370>\261Y\206\205A\216\246\232\317\006\311)J"
+	.ascii	"UT=\215\024\032\232P\264\255\340\320\203Z23\273S5\273\220\367"
+	.ascii	"\236\272\356\230\036\2249\213O\023Cm\322\344NK\200@\256Nf\251"
+	.ascii	"\t\235\024\262\337)M\331\231\232 \321\213\230\330\335^\030\325"
+	.ascii	"\273``w\303Lu\3048\225\t\223\233d\201\272\275\247.\225\356\t"
+	.ascii	"\t\213MUr\227(\271C\276\276\356\020\325\331\327\025%\2729MIb"
+	.ascii	"\361\211K\324\023\257\324#\267\353\310\365\362B\202dI\235\032"
+	.ascii	"\267w\367\243P\275\352\246\376\026\351\2735\275[\226\307\216"
+	.ascii	"ZV\315\324\267\3451\004r\243@.\021\"A\202\334!\036\274\240Q<"
+	.ascii	"8\313\337\017"
+	.string	"5!\277C\2708\tQ\313\322\241\360\207\f\213\257\002Q\257>\261n\017\254\253\345\343W\353.)\313\342f\215\310\330\rna\321q\0357Ku\346\334S\320\275\247\256\313\3437\353F\212\023\244)\026\337\035\326\310L\240`^\336\214\027\3653tR7\207\324\235a\230sK\255\230\240V\2773\334\251;u\253:C\231\254]\252\337*\034.)@\306,\2768f\236\250\237\351\212\212B\352\251AiT\225\r\033\235\206sr\221\217\244\350p\312\324\335\223\305\237\031z\272O\235V\200&i\r\"f\204x\251!\251\3424\275N\315\327\322\314\204\323\267&\025\361\341\331U\272J\027\272\005\0048\253\013\275:\206\250\370Y|\227d\266\244@\300D\221\220nRZ\364]~\223d\252l\t9\323\361|^#5'\023]\021\022\035\336\270\316\353\274Fn\371\306\3705\302QHO\274[d\377\246}\323[t\211\212yoY"
+	.string	"\255\016\231\275\300\243*\026\337\241\367\022\221\030p\026\177\270\244^D\333\302\302\273\225\220\207\002-\222\310\245\222\204\344\312T\376\234XGH\032O\264\30046)"
+	.string	"2\256*0\221\305\037\246P\njR\031\024\244<z`\256p\021t$6\223\310;\023C\223\203\b\202\326\240\031\037\244\362\005\314A\317R\331\343\2234\366\374\034\233+\213\236c\022\006\263\247\207\303\177F\264H\"\227M&\211\325G\b\350\230D\222X2\205HD"
+	.string	"\004$\224L*\2233\315\2365\006$s\330\\\231Ak\320\020\006\345\362\247\251L\316\2600\256@\270\311L*\21721"
+	.string	"\035{\222\310fO\317\315\177F\220`.\327\027\220K\037\t\230\312\345\021\0314\374\317\210\b\2500!\005\211\346\332bil\266pT\002\235X\227\312\0238\304&2i\302MsM\221\363\001\310x\242\271\246X\227E"
+	.string	"\354\334\264\250i\256-r\232\311\365\270\\S\330\321a\256@.\202\214)\230-\222\310&\322\270\302\216\217Q\031\201\240\265\311\204\221\242\371bE\201\330d.\221$\0249\324\370\370\210\2402\223Hc3\251\274\271a*S\260Y\032W\240\023.\320l\220\340\202\002$\327\345R\350XCAse\256*\004 \307\307G\204f\007\234\022#\232K\243\213\021(\232\353\t\036TLpB\005\314#\262\311L!t\0042\036;\240X\233F\037\027+<\370"
+	.ascii	"!\2052P\263\276\240\fZUh.Wf\322\2045\006d\n\233$\fJ\0246.\214"
+	.ascii	"k\t.V4Y S\320\374\210\\\256\311\265\205z\016<\310\300\203\017"
+	.ascii	"^\314\374\203\020J\204Pb\370\017B0a\"\004\017L\250\367\300\304"
+	.ascii	"e\316\3000.\227\"\254B\253\320\004\212?2}V fq\355\361\241I\301"
+	.ascii	"\342\250\263a\355Y}\224'\340\254>\312 \354c\\\177\226\353\013"
+	.ascii	"\022xa\f\262\361Y\2012`L6\200\211$\002\3414{\224,\222&\234`q"
+	.ascii	"\324Y[\030\227\353\013F\b\232=j\263\247\204\026\230F\025,\216"
+	.ascii	":\377\261\340J\027\353\222DS"
+	.ascii	"\251\\\222\250a2\327\344\3324\002\251\353M\220q\331B\331d\"\177"
+	.ascii	"\210K\343\317\021\257AF\024Z`\032Ud@\210Ys\\\177\216\304cR\210"
+	.ascii	"\004\325G\211\\\256)\370\254K$s\365\271i\032\233\314\"\220R9"
+	.ascii	"B\217\f\fJ\024\326\225\006F\023\271T\"\227)\034\221A\306$\f\037"
+	.ascii	"\234f\217\007&\230+\320\021\306\211\265\205\b7\315\236\032c\023"
+	.ascii	"hE\321d\256Mc\004Z`\032\233\033|V c\262\0052E\223i\004*6E\240"
+	.ascii	"i\366|0\363b\365I\232\340\302\270\376\020\203\204R\264H\"_P\006"
+	.ascii	"E\360\302\030\224\323\354a\256X\203\220Mu\rB\252H*\221M\241\343"
+	.ascii	"\372\242\001@\306\246\262\371@\263G\203\r\232I\244\220z\023&"
+	.ascii	"N\200X\201\202\003\324\343\210\345\n$\344\263\376\034\231$\222"
+	.ascii	"Hc\020\211\343\222Ib\004\b\346\312d\"OX\223H \037\343\352Sl\312"
+	.ascii	"R\322\210\233Z,\225\326\254U\231=\3110](\032\331\314\325\221"
+	.ascii	"+'%{\204\323\242\364\001\221y\312<e\222@\370\262&\203t\231$\033"
+	.ascii	"S)I,\2269\302Z\360j\314\205\341pQ\177\031\031\330J\207WR\031"
+	.ascii	"\004QH\226b\334)\236\303\322c\222)\032\002\346N\216(i\b\217\251"
+	.ascii	"J\346\236WN/\231L\004\233\335\350\201U\310F\263\0258\344\313"
+	.ascii	"\230\252VB\362G\005\213\271\3218\3010)RT\314\2260Z\315.xj`,]"
+	.ascii	"\321\017M\017\355K\247\325\304\205\021J\031l3\325\314\257.\311"
+	.ascii	"\213\021\026\304lKJ\302\360\260\230\013\027\fH,a$z%\020'\251"
+	.ascii	"cR\350\303\342\276>\fH\334\362\001W\376;\006\2649j\303\302\205"
+	.ascii	"\265\324\bneQ\301Z\260\337\315tUfRbZ^\rR5\360\361]\243(P\234"
+	.ascii	"'{v\3104\007\035\326\233\241*\017\n\312\342/\267%\213\357\356"
+	.ascii	"0\036"
+	.string	"\321Y\344#\022\206\312`\216z\272r\214\267\227\345F\305bl\245\323n\2251A\274\340\374P\261\235tl.\017\017K\226\212\343p\034\246\343\302s\307t\203\\bZ\026c\271\273]\214\223Q\033N\216\267c*oX\013\333a/\253\0337,\306Sp\r8MQ\216\335\242\340\261!\364\3760*\202\303b\334\006\206\354\270\214\f\263\341@s\236\221oQ\256\242\213\022e\034A\232C;f;^K\362 #\263\030?9F\342#\220\354\351\004#!\222%m\214\305X-\003*03\020\246\275G\225 \\\026[|\246\004\205\213\312blv-7i`=pL\267|\035\323\360\205\307\206H\366\310TW\236\330\361\030\317\3249Gh1f\202\303\242D\352\2468\f\203m\341u1\262\330\017K\237\255&\240\t\205Q\250\023\224\373@\323\226\0161\245dDD\222$I\007\363\024@08H*\032\216\327:\017\023"
+	.string	"\324\346\023\302\032\346\234Bjf$\020\221\222\244 \225R\007\205\340\274\304mc\217\343\362\234\2329\001\222\374\242\304\353\267G\237N\323\305\254\312\027#\307\3141\342\222?S\253\362\300u{\370j!\256\244$#\n\320\203\363\271q:E[M\255\214S\026D\232\320\361\343Uz\f\264\246\256\230]C\255\355D\020\3504\"l\333\322o\021r\323\212\2639\243\3340\360\t\373\003U\272~\234\031\340\346)'#\371\262\240\026\213\004\352,O\373\033\305\"7G\330\311\034\261\024\266\363\303'\302A\b\373\t\314\276\352!\337\357\200b\361\341\276b%\220{\366\nH\t\332\370\346\231\307\026\274\f\361<\326\200z\201x\036\342\327k|1\0334\270\366Z"
+	.string	"\311\"h\251*\035\270\202G&V\212\251\0273\245\252\032*Q?\344G\342\371\003\022\2625\327\2759$\325r\363i\327P\213\032/-\366F \tf}K\354:\216\336\220\3519\317j\216f\230\233cG\032R*LN\354K\375\340\331[\345\326\033\321\0252\356\240@\234_a\252\334&\306(\025\b\353\212\360"
+	.string	"\305\247\343A\220k\307\202\311\345\016Q.\"]\344\020\036\235E\030\307\f"
+	.ascii	"\354 \323H\006s\3037\255\005B\375,.5\237\351\330F\213\216\363"
+	.ascii	"\312\373\204\t`Jw\276\003\270q\223\355+\345\024AK\351\3411\204"
+	.ascii	"\373L\210o\311|\200\341\340Z:C\353Y\227\370\275y\310\274x\300"
+	.ascii	"\311o\352\036\230L\0240/\312\363\254\314Y\035\207\3665\026\313"
+	.ascii	"\242\342\213\330\344\377z)\377\310\261\301\261)C\311\374\250"
+	.ascii	"\025\377\310\3275QS%z\242\342\353\361\326\370\254g\327y\276\265"
+	.ascii	"\327\324U}n\236\347\270\326\020@3l\257\253\264\"\375\205e;\352"
+	.ascii	"1\337\3444\343\203\255\025A\317\217\200\347H-\261\211\032<\205"
+	.ascii	"o4m\317\272U\2155\215\340\332\270\370=\207\312\t\306\030YP\233"
+	.ascii	"C\235>\250$\266r\344I\257!tvtM3\350\n\232\013\2359\256\244\230"
+	.ascii	"\260<\270!\034n\245\266\005\315g\263\365sp\\9\226qh\306F\025"
+	.ascii	"TT\303I?\270)qD\370\243F\304\236\2449\033\223\233\f\037k\312"
+	.ascii	"\023t!\323@g\031\254Y\364\177\316\006\235@\252^]\215*\b\330\334"
+	.ascii	"G\366\207\224\240\331\306kM6\212\342M"
+	.string	"\254\210\310\301\352D\037\024\005\020N\203\220>\233J6\033\332gt\270v\002\252c\317\363\204\233\231u\236\267P$\346sx\2058/\254\244t\004TD+\022\026.\035\0237\025W\306\240\225Y\247\226?)A9\220\342\033\222\030xD\201?\270'\337\251\370\263)\347\353\243\034\0347\317\357\325\365]m<\003\021\253r\023gz*+Y\263\323\224f/W\004\311\277`\263 d\033\233@\377\320\024\220#\340\031S\033o\201\370\257c\355\273+\200\2619\327vB\026\030\032t#C\354\f\034\341\360=c\377i\307\2412@=#\357\353G\253\360+\307\301\247\330^K\330\340{\224\fJc\3750%\275E\255\221P\213,]\365\373b87\372s\213c\031\023\300\274\256hN\371\022\321h\272G\340\275\270\315\302\315\t\376\257\224\256\260\213,\213\373\367\352\300\345\243n\005\345\226\230\256}\342\210$7N~\177\276\223\223"
+	.string	"R\264B\263\n\367\n\203\0170\323\330\346.\235\363y#.\363p\324i\322\214\374\333\220\255\347$_J\210'\256\2426[)\327M>\375$\201\216\317\241\371\017\026\301\354\266\355\0268\322\362\375\034\"\3239\307\336n`\235\250\342\365\307=\303\244j\226\3534\314F4\017\234\r\256\227\333`\223\205Z@\005\213+\333\342\314{G\316\231R\t\204\206L\203\211\374:U\230j\\g4\253D\362\321Y\235\ndh\2510\347\230\351\235g\207\321\013k \200\202\215\321?\322\320d\3474\305\253o\225/ENLB\227\333-\340\216\312\023\373\322\"\337|K\037\364\207\265\330\247\310/"
+	.string	"\355H\315\0204l\234\bh\317C\265m\343TI\364v\247\245\351\b\212\336V\236\217\250\022\315\nM\241P\310(\n\017O\260\201A\327\267zEs\314\316S\275\257\036\262E\222\0320\223\372i\t\316#!bf\305Jh\001\0060\3163\251\277Q\210\233\314/b\257|\211\274\244Oo\357\354\223\351\337\250"
+	.ascii	"\210\3018\212\311\234\312\224\017;\300\356\265<yEu*)\301\303"
+	.ascii	"\310\313\245Gi\376\265\b\325\007\202O\377\rs\245*\206 \026\320"
+	.ascii	"&\231\r\356\021\317\356\364\\$\216`->\242y\006\272A\177f\037"
+	.ascii	"\220\244m{yQ\220\034GL\255q99\245"
+	.ascii	"\307\352c\311\357Cj\256\034\226\3759\002\223\316y\002t\277L\036"
+	.ascii	"Z\261^k\bZ\352\343me\377yT\332-\237\003\f\322?G\247d\260\267"
+	.ascii	"\"\226\330D\315\b$$y\262\210\026\020\3759\375bI\\Z\206\353H\266"
+	.ascii	"^<\\\311\3470\235\246\304\007\025\364/.,P\277\n\207> \264\367"
+	.ascii	"(v\262\025\334\222\372\036\375q\304\2648\210\214\272E\3347\310"
+	.ascii	"vN\346\\\017\240\377\265F+\031\367sk7\225\310\221#"
+	.string	"l\036YA\031\254\374\341^\352;\025\343\217J\321\264~H>ge!`\t\013d\247=\035\252adF\005\227\342\325\020\024\024D\376G\273\335\030,\034\264\034k\032\377\221\n\020\252#v#U\020\276\361n\357\320\220\036\262\303B\354\221\361X\034A\021<\352\232\006\377g\252w)@\306\n\016!\212\311\3009l\"\016\262e\302\252&8\203Q#7{!\242Pf\253\310Yh^\230jBz\002\3719\206\215\275&\256\221\205\313\234\033\311t\2219\2415\234\212;a<\271)L\321\020\3339\314\234\3165mj\230\362\205\355\311\343\363\273\335\312\246\372\325}\013w\334\217\260\257{9\\\035\342\322#\\\221\020\334=t\177\005\257\033\034N\2177\022\314\230\341\334\333J\003\271[u8\324\255\t\221\331\272s\003m\204\275:\354\027m~o\213\213j\255\371\017\231\r\246w.\350\317\250\226t\026\244\257\220\266\276\002K"
+	.string	"i\222\032\344\020\230\315\307\241\354\331\345\361\250\265\3149\321\221)\013\216\033\214\225\351\356\346`\323\256Q\207\310\357\032\206@'\253\377\302M\326,;\254\353\270\3422r\f\004\206h.\367C\324*h{\370\035E \3721\277\003\211d\257?S\256\030\260\273\320\354\201\375\261Xw\3434\354\250[\017#\362e\034\261\257\3272\220\270\363#\001\316&\374\200\0162\036\032\n\332d\304\370\275\202A\025\016\370\030\033k\027^d-m\311<\016\021\234\225\354h\245|\235U\023D\352\274\026s\210\255\2116V\030\247\217\bZkP\t=(X\311"
+	.string	"Q'\372\203y\257\245X\263`\236@\231\247j\252\312\350\016r\321\030\177bmN\361p\332\211\267::\034\fm\261F/ebf3\201\310\nKS\r\371\342CB\250\250\025G\330\241\314g<a\313\302=C\005`\261\356\"\217\215\022\374\021\367\213\237\211\032\225/O\213\331\344D\b\200\333\t{\217\025\315\247\024o\371\256r^as\336\017\\\223\327\213\246\253\364C\320\342A*\330\021\323\233\331\376\344\350\303\220\376\215\345\362\3356\353w\215o\311\032/\374\312\342\356\236w\b\320\225\340w"
+	.string	"\271\210:\246\262Q\260\216\312\266\363\373\004\375\200\334\032f\007\2259@o*\244\265\375f\354\323\356\032\213\0132\206J\3542\374\345\313-\375Z)\2343o\023\251\257\231\277f4\253\232\356\274\232\233\357\274\235\276|\344\027w{\330\310\020D\340o\234/\256 \363w\343\375\213\367\321\032\216\351\330\370\027~\356\326?\370s(\343\224\273X\277\227\3329\213\370Z\220v\353M\245\223\254\006r^RL\336\336\256\310\001\334\033\230\317\313\3110\337>\377}\344\332\235o\352\007\221&R\322.\f\227\b\f@\344\367\327M\313\325\035\307z9o6\337)\277v\037&\206o\220\037\230\226Y\206\352\247\377T\202^\221X\277\322v*y\206>\276\364\\\017^$|xF\032\201\237\351\236N\363H\334\201\236\337ml\301n"
+	.ascii	"\374\376r\266\325\341\334\304\365/\254\007jD\032_\313L~\352\206"
+	.ascii	"\347\307\271\177\263_\333\024\221\277PL\016\243Q\362\357=\310"
+	.ascii	"\016\360\361\006@,Z\236U|c\242'\261i\263\217\207^\312\212\f\336"
+	.ascii	"8\302S|?\342\317>\303\\\235\005e8qh7\306\177\271\333J\316\233"
+	.ascii	"\361\307\315;\311oh\223\373\026\217\021\342<\330\033}k\240\305"
+	.ascii	"p\254\375r2\277\301\360\374\327\364,{\037|%\375)\310m\301'\201"
+	.ascii	"_\250t\317\212+\365\233PwT\007\213\234\030\3231q4a\302\315>\001"
+	.ascii	"\356\371[\3471\366\2403\027pZ\324\323D\037\371\317]5L\237\341"
+	.ascii	"\346\257%\311y\342Y\304I&\231\324\332\274\375\217#y\211\374\234"
+	.ascii	"\363\227\354\233b\236\312R\035\253\317T\031\3030y\270E\360\305"
+	.ascii	"\234\004X'\005&H;#a\213\330$\341\203\260#43s\317\354\277\237"
+	.ascii	"NQ\247[\327\001<7\0269\1779c\363{#\376\333\353I\033\234\346S"
+	.ascii	"\030\035\3038\270\017\335\201\207)u\310X\027\313\211\352Ok6\270"
+	.ascii	"\371n\350\264\242\277U\322L\224\243\322\027\244\037h\207\204"
+	.ascii	"\205\215\331\364/\352\345\354\034\270\256\333\316w}\177\335`"
+	.ascii	"\372U\247\2574\243a\177\225o\364\256,,f\270\260\f\227\224= \370"
+	.ascii	"\016\376s\271\216\t\363\352\3307[y\320\264[\316\037\260.\374"
+	.ascii	"6\367$\246k`\346\030\226\031\3448\330\203\257\023\211/H\374\b"
+	.ascii	"\372\336\365\203\356\013\316\b\361Ez\243\360d\344L\177\275\356"
+	.ascii	"\264p&\366e\017.p\036\325Z\360\037\300\247\344\305\354\213\\"
+	.ascii	"\252\347\317\205\270\267\016\345SE-\213\033\374\320\216~\231"
+	.ascii	"\264<\nS\252G\247\013\353Z\254\257i\337~\317L\357\310$\320\221"
+	.ascii	"]\211\231t^7"
+	.text
+	.section	.gnu.lto_.symtab.b036fa8b51c0ddee,"e",@progbits
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"getSchedulerInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"schedulerResetMaxOverheadTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"schedulerSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"schedulerSignalTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b036fa8b51c0ddee,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
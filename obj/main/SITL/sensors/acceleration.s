@@ -0,0 +1,1482 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020"
+	.string	"!"
+	.text
+	.section	.gnu.lto_.icf.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\007\002\215\r"
+	.string	"d\022\373\002"
+	.string	"\""
+	.string	"\252\330\260\213\t\004\002"
+	.string	"\002"
+	.string	"\002\001\002"
+	.string	"\001\225\311\225\221\017*\002\001\002\001\002\002\002\003\004\002\005\006\002\006\002\007\002\007\001\002\005\b\001\352\263\360\321\b\003\240\342\234\212\n\004\005\006\207\345\221\261\n`\t\002\n\013\002\013\f\b\200\343\367\203\001\t\342\306\306\223\006\n\016\342\204\262\330\016\002\002\r\002\016\020\310\312\246\362\007\n\017\002\005\020\002\021\002\020\002\005\021\022\023\024\212\342\234\213\f4\002\r\002\r\002\t\002\005\002\t\002\022\020\004\004\002\023\023\002\f\002\005\027\030\031\327\307\233\363\f\004\002\002\002\032\314\341\206\214\004\004\b\002\b\033\355\214\377\356\t\034\273\330\316\306\r\035\306\205\223\344\t"
+	.string	"\036\252\320\356u\020\002\024\002\005\002\025\002\025\002\026\002\005\002\027\002\027\002\f\002\021\002\f\r\002\021\037\265\372\210\203\b\002 \200\333\377\224\002!\246\256\343\230\017\002\002\030\002\005\"\254\273\212\321\016\020\002\004\002\031#\226\266\306,\002$\273\205\374\374\017\004\002\001\002\021%\346\253\305\230\005\005&\211\326\207\344\017'(\240\342\234\212\n"
+	.string	"F\250\341\245"
+	.string	"EF\242I\212M\007\200\002\262\241\272\001\0210I\342(\013j\253\355h\260 3\026\rB\230?SF0\371\337t\220\206\204\034L\356\032\217\244\307N\352\346\223J\030\254\313\225\310\365c \261[\270"
+	.string	"`\202;\236'\242\200\032\301\237\245y\210T\f\247\332ue[\364\25723\r\376-?\323\003\264`t\216\324\305\234gb@z\256\263\"hi\202\ns0{\026\206\354\2145\233B\016"
+	.ascii	"\035G\326\215_\324\227<"
+	.text
+	.section	.gnu.lto_.ipa_sra.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375 \334\005\004"
+	.string	"bE\021\034\240'\351\377\377\3773CUUU\267\267\377\377\377\377?\342\223\264f\344\226\211\334)\005*\272\244_c\031/\312\235\302\343\370\304D\034\312i\260\\\025\226\260\203\0053p\322['\"\007L\264\223Yd\177\033\037\001\030"
+	.ascii	"L\211\340\031\304\345*h_\223-\215\003\206\233\226\242\232S*\002"
+	.ascii	"\b\345\250\031\b \20484/\301L\240\331 ei\013\f^=>\023#\0262T"
+	.ascii	"\006\277\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\335\002\335\016"
+	.string	"\266SJ@\020Q\234\306\312\260\364\306\363\r\314\347\265\372\232\034\030\352\200\362\2639%\3046\277\267\"`8\361=\016"
+	.string	""
+	.string	"F\340\213\t@<\b"
+	.string	""
+	.string	""
+	.string	"\205t\026\327\210\203\230\033\307\275a?b\244 D\244\334)4"
+	.string	"7"
+	.string	"<"
+	.string	"\022\256/g*\327\367\263,Dp\3700\352k\022\302\341\215\300\236S\321\212\024\252\005\372\313)\251\004\tO\301\362_\327\216\347H\364eGC\3149\257\007yQ\001\027\353\254\223\224\375\265O\377\212\345Y\b\340(f>z\203\0242\221}\231\rt\3169\325\263\226?\024\303Vkke\240)p\004!\305\n/rL\376\263\031\302\016\027d\336hs\2005\033d'\326\260PJ"
+	.string	"\322\222hF\267y\263"
+	.ascii	"8\326\310b\363lS\rsN\312\346\261f\355\223\332\247}\025k\355{"
+	.ascii	"\312r{\nW6\034\200\324\004\303\363\360\211C\002\257}\322\005"
+	.ascii	"\212\021tVF\270\242a\331\026C\f\022\005\314\007\f\274\247\024"
+	.ascii	"h\232\374\266-\274Q\004\325X\nE.\200\221l\253\002\034\305\312"
+	.ascii	"\004\006\350\305\331\005\374\203\214\276\344tB\027P\250\001E"
+	.ascii	"jf\344\002-N\261f\220\"\232\242\353\022\200ce\206Rf\034\212r"
+	.ascii	"\313\267\236\003w\322`W\314P\237\354\202\300\214\244\271\216"
+	.ascii	"\250\257\003\264\372\232M\361<\036\255\256\247(i\310D\247\302"
+	.ascii	"q\001D\276Q\003\276\276\220\005mJ\275\220\241\262\221-{\373\362"
+	.ascii	"Bb\363\204\201\205\254!\032\211r\317\"\247.o\325\262M{,QD6\247"
+	.ascii	"j\3513;\316\033v\211\334\324\r\332\330I\341\202\301Hc\016\017"
+	.ascii	"2\036\361\313\337\217\244\324\227\243\303Z\225^\004'4\204\325"
+	.ascii	"gy\263\223z5\203\177\344\217\037\002\274\337\246\372\351\310"
+	.ascii	"\225\3271D]w\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\251\001\r\n"
+	.ascii	"\302O00`k\222\016\024R\003\207\tS\350\330\211\007\250`\020\200"
+	.ascii	"\3747\352@\202\260 (\314\216\245B\t^\376\370\257F\303\b\006\300"
+	.ascii	"\210\005o\270-i2\311\3671{\236\343\211\013\300\304+\n\022c\253"
+	.ascii	"Q_(\243o\002)I\b\344\3473C\256\344\f\327R\350\2509\256\271>\323"
+	.ascii	"\270\257a\026I\313\245l\352\224\357\001i@\026\020\220\225\265"
+	.ascii	"\330\272\372\217\3678\332\3400\0177\320\212\332\376\200\304\330"
+	.ascii	"\235\373\316uJtQl\233u\334\222&\365I\007\316\0037PIV\220+.0D"
+	.ascii	"\032\331PU#\026\255QL\315\334g\256CU\365\242\310E\006\264C\220"
+	.ascii	"B\276\250\311\213\232\223#\256=F\263\fz\n\260\031\0014 P\002"
+	.ascii	"1\250*;\260\320ZB\206\262\020\f\302+\241O\273\310=\314\270\360"
+	.ascii	"\314\020\314D\006\333X\n\002\246!4\001}\027\270`C\n\355\022["
+	.ascii	"\302\031\370d\2101M\215#\340\026\036\326\032\310\364\370U\261"
+	.ascii	".\305/\220\rT:\341r^\366M\312\b\013\232\344fJ@\325\214\022\245"
+	.ascii	"\234\307f!\305\355\321\312\306\3346\336Z\376X\001\333\367Y=l"
+	.ascii	"\317\"z\343\275\r\323tR\223Zq\003"
+	.text
+	.section	.gnu.lto_.pureconst.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\006\232\004\016\230\004\020\230\004\024"
+	.ascii	"\231\004\031\230\004\032\232\004\033\232\004\034\232\004\035"
+	.ascii	"\270\004\036\231\004\037\230\004 \204\004!\230\004\"\232\004"
+	.ascii	"#\230\004$\230\004%\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\323\001-\n"
+	.string	"\362\316)+pk2\034\374\377\377\237\213"
+	.string	"\341\017"
+	.string	"`\025\250X\377\253\006P^\315&{>,\326HMhO\377\337\021\212\364\030\2515i2\245j462\022\225%c7\310\240/\205\261\335\202^l\025U\n\004k-\213y\305\036i\316\331r\346\233\355f\221\204!\350\201\201JQt\026H\036\353p\204\254\316ZV\346\232\255f>Q\354\331<\240nY\317lb{YD\003tH\237\266\323\234\262\225"
+	.ascii	"P\243'\252\242\215\230c\266\230%:\264\205\034b\3632\177\330:"
+	.ascii	"\314\325\236\215\"\265;\356\320]iS\332\037+\340D\007\022G\250"
+	.ascii	"\261%chHfARi\003@\002B\024\263\364\0210\251c\\q1\373\006d\324"
+	.ascii	" \227\343GSI)\353\310CJ\376m\263\244w\344D\376U<\0269>KF\355"
+	.ascii	"H\244>\312Z\005\362\021\341\233\314\017\037\025\323\017\203\224"
+	.ascii	"p\310\207_\004\333\223= 6#\200\252\271M\027\355Y\372\002\264"
+	.ascii	"\f\f\b\217\265VXS\377Q\254\273\234$\361\243PB\314\227\265\220"
+	.ascii	"\001\003\237\311\360o]E\360T\365%\243\002\005>y\013\207/f\264"
+	.ascii	"\202\203\272\324\257\213\374\263\221\b\350\237\365 0\003"
+	.text
+	.section	.gnu.lto_.lto.1dd4d87d6d53e527,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.39.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\b`"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\303\354\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\354\007us\350\374\006uq"
+	.string	"\005\001\006'\001\024#?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.40.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"e\t"
+	.string	"\226\321A<0\345(\035\200\3238,\007\311Z\r\210:a2\232\330\025\242\266\2145\f\330T\226k\026\273CE\226ED\362\006\2140=X +\362\200\215\031Sx\372FY\030F#\334\226\354\224\002-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\232\013h\237\026\355\327G\325\236\305\222q\002\333]\232y\\\274\024\375\217<\340\204*]n\t\273kyBm\334\331m\033\330^\260\r \3663\273\273\316R\366W\277\234[\253\245\343\262\253\021\013\260\256\331\002\331\330\276\264\037r\021\361+\3229\273)\030\225\335\361\300\b\232O\217\037\320\002\231\315RfXq\2312\f\337\344\266\304SP:\252\023hvx\326\204?6\305K*\374!\261\270\220/\037\237>I\373\3348^\260\030\223\214\331cIf\035\001\241\310\253\016\020\334\310kx\370\024B!\260r\314y>\320\033\201j\027\3528\016D\303\n\206_\027\322\317\003\211(WC\352)0\030\321U:\002\301J7\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.41.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"e\b"
+	.string	"\342\31788Po\322\001\240\344 \334\265`\016\021\203\364X\023\200\357R6\206\250\206\252\034(\221\217\362\310\221e\021->\013\204TTQ\021\261\025\370\031\205\206k\005\207Y\333v\357\224\002\2768\031\365\200\254\212-`\327eM\255R-\303\264\231y\254\317\274\25269\004\246\fX\235 J\353\254>\356\244oL''.\212\374\220\337\263\302IL#\233\013d\356\371\363\022u\347\236\033\016\242\271s\351\177\377p\3607.\375"
+	.string	"\001\337]\006<\"sy\357\006\026\250\324\n\007_\354O\004#\206}\314\306\013\033\2431A\031H\331\245xq\331\223,\341\260}\337\343^\350\035N`\251.\355\220]]\276\362f\243\376i\354K*\023\"\251\335\2351\343\333\341\346\237t\200n$q\250A\330]\303nTq\307\333.\260}`\273%\017"
+	.string	"2\003\302\360\305\302>\231\020"
+	.ascii	"\021P\034U\311\036\bx\273&v\207\310@\005t*\350\313\025\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_accResetFlightDynamicsTrims.43.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"m\t"
+	.string	"\226\320=:0\3456\035\236\367\213\203I=Ct\3327\217=T0o\030v\271\225\01666\225\3117D}\b\360)\352vXH\004\"\305\201\200\203\t\246\337l\016\214\350\360\300\357\035m\247\024*"
+	.string	"."
+	.string	"."
+	.string	"\237\277\374\3310\037E{\322\n#%\265\273\324\002\371w\371\371\037} \f]\\j\030v\3272\fi\334\326m\037\330V\260\337\020\027\217\320\241\"\211\001\345\312\036A\322\372\260\037\260\226\207=7\033/\t\246\335\214\025\200EM\027\021\333\367M.~^b\207\322\365i\177\354+\241"
+	.string	"/\375\242\037\276bR\321\214\250R\257\231\213\356\234T\013DK\034\305#\020\355\356\302\247?\376d\302\017\3714E\205|\370\271\271E\3463\3168\\\335<X\247AhY\206Q\257\253\036\247y\224\333\260\016\315:\217r\f\\#\264\216zj\355\3505\202\037]\340\304\201\002-\320\366\026\226S\025"
+	.ascii	"2\003\302p\331\302\326M8 \033\300\0358\230\327\336\006f\220\200"
+	.ascii	"\023p\334\257\222 \001{\2039\240kxw\b\007T\024\247\"_\356\005"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.44.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\345\b"
+	.string	"\266\020?;0\3456\035"
+	.string	"\360y\354\017^\037TT\037\241n\023\333\026\272-\316\237 \320\036\332\271\023D\255\307r\002\004\245\205D \202\204\001F\2175\214N\326\312\t*\362\203*m\262wJ\001+"
+	.string	"."
+	.string	"0"
+	.string	"\004\326\251C\373\345\343\310\236\304\261AB\355n\235\"\017/C\377(\027\370\2004.\003$v\327\362\003\362\270\347m'\330\206\260\355\0223d\177\364K:QB\305,\300\354v\244\002l\211\262\224hl_\332?\271(\374\250\363\201\335\020\200\225\335\261\301\016\327\251\307\033X\247\327\003\245\231\2238=>\270\202e_\\\005\303\017\247\005&\031\316%F\370)\031\034i\"\361;\326)\303\207\t\210\350$\312\224=z\344\f\261_\355\356:Z\306a\340\307m\227\263\r\327m \346i\024Z\226a\365\363\272\217\323\276\312mXE\315\274\257n\020\334Yh^\005\273\316\253\232Q|\2653\344\252%\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accDetect.45.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\247\003M\032"
+	.string	"F\260\250G\260\032Q:p\233\216v#p\031\242\247\016\202'i\364S\365\017g\312E\254\203P\275\225\020e\263\347\276\037\241\253Fy\273\326@\333\356z\372\007ey\207\266|\263>\177;\365\036\314\317`'\265\222\277\t![\356$\003\227"
+	.string	"\212"
+	.string	"\221"
+	.string	"F\275\356\334\204\255P\017n\356\007\302\203\365\005\302\203\026.\350\354\316sB@\307\t\321\216\324t\347V\354cy\356<5\242\252\030\202\224\347\316~\366\324yp|\244\017\224\332\034\275\311v\203\"8\302\243\344El8&\212g\370z\306\360\210d\274\026\261\325\230\"e\335\316\367&\233\r\232\201I\321\017\332\f+\215\203\001n.\350\202\356\376\356\363\347\366bRz"
+	.string	"HHm\274\371P\b?+i\306\233\213\311\343M\306\247\310\352\356\235\265[\214\257\352\273\233\264\273\"v\271E`^L7{(\377\356\032|\275\3467\233mhw73n77\233\030\232\270"
+	.string	"Y\016\332}\223_\300u?"
+	.ascii	"\325\316\255G\372\212\327}\303\235\013\356\\\272sy\356\013\334"
+	.ascii	"\250\325\234\201P\245\033\350\r\233\006\003.\r9\322\277\373\375"
+	.ascii	"\321w\233\332]$Y\235\331*\225# \277\356\\\204\203\353\341F\327"
+	.ascii	"9\224-\357\240\350\327\335\017\016\356\206z0w':\327\311\026\325"
+	.ascii	"\335\303\351B=\270\200\316\271\373%g\242\363&-N\240;(\223)\323"
+	.ascii	")\264\032J\017\23194C\303\362\313B\221'\177w\272e\313\027\332"
+	.ascii	"R\317|\263!\343\242|Y?\017\351vZ\300\357\204g\362I\031\237\371"
+	.ascii	"\264\341\024\300\273*X\314\327\316*\210zk~><\333\363n\300G\344"
+	.ascii	"BO\277\036e\334~w\024\031$^\352\225\276t\002\340\220\177v\257"
+	.ascii	"l)\201\300{\267\262%\247a\032UT\266T@\244^\026*\355\245lY/\013"
+	.ascii	"\017\326\017=\304\264\244\350\245\204\337\216\034\335\263\357"
+	.ascii	"\330\335-g\255;\344\311C\023)\031\231\363\"\301W,\004\f\304\213"
+	.ascii	"l\261 A\266:\270\\\255\001+^$x]\024p`%rZ\344\313\304\313\345"
+	.ascii	"j\255b$,\206\363\212\255pJ\264N\254\\dlE\201\301\302P\274\310"
+	.ascii	"U\016\fF\256R\271\036:\03598%\331UA=\313k\345e\361pO\n5wa)\346"
+	.ascii	"k \253\207g\r\244\360\350\215\342}_\032\212\254\342\037\025'"
+	.ascii	"\b2\346\t\031\237\3714\204b\034\317\251KRs\017N\322\021\304T"
+	.ascii	"}0\202\f9\207q\322\361D$FJ\360\276_\fQI\277t\221\177\262\234"
+	.ascii	"\362\b\346G\250Q$\244\230B\212\020'\230\t\213\002Q\213\001`\002"
+	.ascii	"\231:3\017\021\200\315D4\3122\007\213\252@\3779\004\247d\t\374"
+	.ascii	"#\3711}\366\nKh\272-3\031\277\223\264Z\242\233D\246\005\232\276"
+	.ascii	"\234\364E\177y\3767\212{\364v\034R\331\f7[\274!D\007-\304Oe7"
+	.ascii	"\236\3643\244\020\204\177V\215\254\004\303\313{\026\221g\331"
+	.ascii	"\320\234\035a-\222\336\200\n\023#x\001|\203\231a\241\361\351"
+	.ascii	"r\201\300W\003\327\345l\311\263\0056\322N\005\364\002K\205i6"
+	.ascii	"n\372\225\342\257\202q\375\201xS\3516\301\017"
+	.text
+	.section	.gnu.lto_accInit.46.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`o\002\275\022"
+	.string	"F\242zH\260\326M:4&\260\272\345\253\227@\364\230plL\207\273\237\370\023\370W\256\025\371Rk\f\210Ym\006\2155\373\004\333\202\313H\235\276}\017\013\336|\254\331Q%c\007\034\236\310ov\017\371\316\n\260\325\237\022B\244L)`"
+	.string	"`"
+	.string	"o"
+	.string	"j\360S\177\236\332\263zW\255\252\276\200C\315,,\013Ts\372\354\234\314\252\357\251\310\266\216\355r\002\005:\226\327\341|\336\342\006\317R\326\234\272pYH\225\367V\245\337\272\321\356\241\374|\275\027\240\036?\256\233\315c\261Zq\365\334\265\304mG\025\200\314\234\323:\336L\334\337m3\260\215\300V\254~\210\n\247qa\305\306\360\245W"
+	.ascii	"\334\2343\346\337\fe\352IQ\323\235W\324\216i\330\026\024*\252"
+	.ascii	"lK\263K\235uO\201\007~\244\353\304\025\334\234\265\244+m\360"
+	.ascii	"\211\376\371F\324\217\377|\021\374g{\230\351G?\367\232#\035\223"
+	.ascii	"#$\226f\353l\272C\366w\267\333\355\274B\266\325-\253S\034\022"
+	.ascii	"\206~\004\227\300\210\245\331\333o\037\305\363D\036\235J\346"
+	.ascii	"|x\253b\264D*\201\266\214\361)\251\304c\007L\221\020\020R\222"
+	.ascii	"]{\301\245\244\216\250\215\032\221\270\301\241\034\240\314\271"
+	.ascii	"\023\343;\375i\346\001\r\r\370oW\345\304\325Q\222\337\004\002"
+	.ascii	"\202\013\356C\2043I\310\201\303[jQ\273f\202~\324u\221\n\252\262"
+	.ascii	"\335\206\b\n,C\346\234'\n\206\301\340\21069/Y\214C\f\006{\205"
+	.ascii	"3\2318\303\211\315B\034\233\327M\b\223\315B\230\002\026;\304"
+	.ascii	"da\216(\312B\227\256voz\333\332\347>S\304H\215&\275\220\247l"
+	.ascii	"\217\355\224\265Lmm\336\234sz/jK\027\262H?\266v\325I\211U\320"
+	.ascii	"\356\020\bn\006\031Dv\264\211\r\350\267Gz\020\371B\005\310k\300"
+	.ascii	"\017K\243. \320\002\231\240\312<\336B\313e\204\030\r\367+Fn\252"
+	.ascii	"Fr\206\033&\2728{\004\265sh\002\254{Y\275\215\216bqC\221\372"
+	.ascii	"\36490\363!\370\245\244\031\203Y\0171\215$db5p\374\351\025\255"
+	.ascii	"\315\273Q\3609\330d\323\025APM\351\334\264\023up\035\024\025"
+	.ascii	"\005;\217\\\245\3600\236\314\b\240\366:\241i\f\020\n"
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.47.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\215\b"
+	.string	"\266\320=9@\345&\035\340\245[\363\355\340d\035.d\023\375\001\237\336h\314K\022d\260Da-\262\366\206\032\213H{\356nm]\227\220Uj\177\330\302Zi<B\314\007#\233\354\235R+"
+	.string	"-"
+	.string	"-"
+	.string	"\005\326\2439\273\346\335\310\336\245C\243\005\300\356J(r\356\217\363\257\362\201\021)\364\027\320\260\273~#\022\307\ro[\301\366\203mS\366O\377\253\020L4\330\314\356F*\300\242\242L\211\355ol\277g\037\345)\334O \307\335\017\230\230\335n\301\f\002\217\0047\260\036\337\003\233n_-,9\342\004%\202\031~\320_9\013\310'1\306\347}\364\350\177\254\307\030\362b\342!z)\273\013=\bb\277\332\3355,\005\023\264b\027\026\024b\243\331\3748H`\3315\017<9\035\r\363\\\225ft\316KnU\333:t\223\035\354\242\220\263n\222\223`\255\202V\351\321\264*\003\b"
+	.ascii	"\005\006\312\204\366\275\300\305\205\022\227\241\211\325hp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.48.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"b\31504`m\322\001@_\034p\3623Q\206\260&"
+	.string	"\367\257\261y\327\236\266\005tk\350\330\201fw\343\370:\330\267DQ0\220\301\270\375G\244C]\272\021\"eJ\001v\225\nZ.T|\013\3179\252Y\021Z\325\263Ze\241\030\232\213V\253\020\0306\274\330.\020\306F\311\366\032R\035\340h\307>frU\275G\324\271\30670\276\205\0352y\354\223\237\231|\272\006@prdg\233\324\t\373\322j\310vZ3}I\340#D\241c\3673*Y\220I\204a[cS|\200\240\361\365\254\342\363\013\t\017\007\311n\326\224\342\327\363\362\237qiD\304\003\003m\236"
+	.string	"\t\273\353\304@\017\267\336v\201m\003\333\021\001\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_performAccelerationCalibration.51.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\301\006%&"
+	.string	"JC\240\016E\200\334M:}n\205{E\263\304N\247 \240n\n`Y2\253\235\367\251\261\"X\212\251\332\330~\366'K\241\365 \265\027\026\307\232vE#\032\361\215\"}%\232\322\365O\032\264|Y\340\267m\204lB\244L2\321"
+	.string	"\304"
+	.string	"\343"
+	.ascii	"kvVa\235\\\306\304\356\324Z\031\274\\\f\347K\003\344\215(\f-"
+	.ascii	"\337\"\343\305\245\30622v\217\345Yf\274\270\235\305G\367rw\306"
+	.ascii	"\256\356e\353v\367\274{+\277\362\373\027\215\001D\325"
+	.string	"*\354F\230Z\213\0166\302\371r\213?\242/\317\033\321\227\373\333\265\363\"W5\225|]mi\253\265\356\032\311\366\311\342\227\362\357\270\323\244%\331\374\333\203\035\001\033\333\220Xu\334\201!=\200\374$%\324h\013\3626X@H\240\267\2537\007\373\001'XZl\222D\265V!\342\025\t\201q\020\203LsM\262^\3768I.\330B\343C\210X\203<bCdMG\264\342\376\227/X;\033\022\263\316\246\205Z\353\362\220\330\343\233\373\356B\331\335\246]\352\025@>r\311\340\273\013\342fNC\\\265V\n{1\037sb\337\365r_<=\321\227%\0319S\214\007r9\263A\266\2215\323\316\243I\035$\212\224\2609V\374\266{\262\207\341\355\273\026*\005\177\230\202\276L\352\217})\013\315M\013\310\307\256\265Vu\033\331-\006\371\257]dW\307\273\244\340_\277\222\2167\351b_$\035\357\221\2167"
+	.ascii	"\216\327(\307\013@\307[\224\343%\242\274C\224W\b\307\033Dy\201"
+	.ascii	"(\257\016\307\233;yq\224\367\244\274\346\311K)oi\362\222&o\233"
+	.ascii	"\274Ly\277 \351\215\315\212c\255<\216~\352\232\262l\311\305^"
+	.ascii	"\362\236\313\307`\034\3146\2318m/\356\277l\227{\371],@~\372\350"
+	.ascii	"\032\027g\217WY\256\335\332\244\316\3165\211v\365g\017\256\013"
+	.ascii	"$1"
+	.string	"\323\276f\324\354\263K3!\225<N'\036\263qq\364\270\225\0210\362\350r\362\350R\037\354EaT\204\344q\303\266\324\337r\366\2022e\353\212\331F\026\247V*\350Vc\006Gj\034\016\216\324\337\023\246f\305o'k\255\22568R+\350\007Y;\023n\005\233\350Z\223R\232\206\323\331p\252\3718\024\340\352\352\321\227K\\\306\313yZ\257\303\007\376\360\003}I\333<\302\346\245E\266\273\234\340\315\222\035\245\271\031!\304\325\306<b\247\255\255\3545NA\\j\206x\310.\373\3024\335\334\344V\020m\311\2246\304\321\214\020\220Vke2\3633$J\2300A_v+%){s\363\230\360N\031\247\363\354\335G\352x\225\005TQ1\236H*\026Q>\021*x.\242<\240\230\272 %\325\363\025-\357\301T/\312\305\223\017J\n\212\307{\332Q\371zTSPT\273\251\250'\026;\236\217j\367"
+	.string	"\301\366Z@\371v.z=\337NW\004\376\265\213\254\211>k\200\035\334\243\326\352\343\361<\032\240\217\372\302\255 \037\371G\200.\263\376x\341\226x\367\367\344\007\205?\334\203\375\204\243\006\313\355N\260\253\226y\\\n\367 \236F \001\352\305;\232\226\351Y\366W\205u\374\256,\323\313\345\034\026~`\373.\032\364\345\263\234\251\3540nY1\032\365\220o\220hC<"
+	.ascii	"\332\250\177\365\247\250\211\032@\3231!\223\013|\305\253\300"
+	.ascii	"\264\213\201\205\031&p\215\242\256\220\344k\250\211\232\216\t"
+	.ascii	"\365\020Wq\220\201\374R\310-\250\217\177\200:\310x]\007\200\204"
+	.ascii	"\250Q,\307"
+	.string	"\230C\312\214\314\210\302\302\202\2461\220\002\031)3\036\021`53\247h\026\250\260\261\035\323D7J?k\232\2148\230\321*\206\250\004\321*?\316ln\254\364G\307\250\264\251Q\275\235\315\346\211\333f\217\314\361\343\224\271\250\252.h\224h \005&U$p\237\035\200\342\270\266\235\277\032S\221\216]\016\303\235\002%\203\304\312\260e\207\232\324R\227\267\304\304\020\330\262\314#H1\023v;\321Pa\223\306\262M\210\240\005\330\261i\235E,8E\2063\202l\260\230n9\306\334z\243\f7\267.\306\364\246\020[\322\370\203\212}p\3063\223\260@o\215%\017\320\374\2001\204\205\217\216\331\006\223\016\bX\036\262\235\303\367K\267i^\217\334\276\263\206\232\033p(\302\276\346<C5\230X|\033b\207\332\234~\035\325\"\361\3505e\325\310\234\035v\f\240\243\264#\231W\fZ\205X\264?d\207\241\250\231\324Y"
+	.ascii	"\303\215c\322\312\323\277\237\025.]\030\005hG\356\177"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.52.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\203\f\3759"
+	.ascii	"z]\314\024DP^R\007\3639 u\033\357a\333\b?\021Y@\200\230z\235"
+	.ascii	"\210\375cM0\035\332\211m]%z?RZ\332\215\fH\253\357\035\216n\307"
+	.ascii	"\021\344\212!qD\346\260E\177\371\375\217\322\214\244\355\275"
+	.ascii	"\367\2262\245*\001/\001?\001A\355\301W{\034k\207c\355o\254\335"
+	.ascii	"\215\265\267\261\366\rk\327\257\366\267z=d\201t`L\347y,\233g"
+	.ascii	"^\343R\231\374\334\273\272\325[\267\356R\377\251\334g\221\177"
+	.ascii	"\316\355\224\300\244s\331\007\254_4\301\273^\025\277\253\324"
+	.ascii	"\376\225\217\233\361R7z\273:\243\363<\017\337u\237\341>|W\017"
+	.ascii	"\335\375\265\373G\337M\3767\032E?3\030\226\036a\346Y\272\300"
+	.ascii	"\243\342w]\372C\357\273\361\007\275\357\272\354>\347\245\317"
+	.ascii	"\031V\222\025\313\0228\3173\324^\363\375\255\364=\326\362\373"
+	.ascii	"\024\211Ca0\206_\327\330n-\373\303SAf\331\327\3738\277\330\""
+	.ascii	"\360\023c\347\365\310\234\355\320\330\022&\020M\204\247\322\314"
+	.ascii	"\320~\270\224f\366\343\205\355\203\032\201h\257G\366\243%\336"
+	.ascii	"\021\333\363\241\203\355O\217\266\301\264\206\216\341)#f\315"
+	.ascii	"\207\317\376\025\233\206i\367\225\3157\352\221\241\265J\363<"
+	.ascii	"?\334/=!\013\242[\035\277[\004N<\035>e`\355\020\033\"r\036\356"
+	.ascii	"\365\215\262\245\326\360\324<\317\256\231ef\357?\357\376K\356"
+	.ascii	"~\301\235h\fX\340\200\351;-\274\377\350\370\325\261\3729\307"
+	.ascii	"\227\263\366\301;\352\354\013"
+	.string	"\366\335q\216IV8WG\317\177\323\301]\320h\3732|\365\370rR\356\032\336\315\025\237\214\326a\302\223\306\373\356\273\243\304\276@\337\334\335F\357\325\374\232<\375n\367\276\353b\333\215\207f\301\233)\323\356\342\232\027(uo2G\242\257{\273\020\376\302\203~\246\007;\346\237Rg\025<\365\b\3419\317\263\004w\020/&D<\317\263T\030\031X\f\254IX\274\357\356\r\201\215\372_\036\f\013\021$H\274\357\352=\274\233b\375\256\306X\223\275\325\334\301#\337\337%\260\274\001\323w\334\177\313sA\372'\361,-\375L\255\367\335\337\024\242mN\267\246Rg\335\245K\275\325\346y\376\362]\304\235\352\337\376\243~\356\375)\326\356D\324^\340\325\336D\324\316\024\324\276\024\324\256\024kO\nj'\020\324\216\024k?\202\265\017\bj\027\020\324n4\324^\364j'z\265\007\210\265\017\305\332\205b\355A\261v"
+	.ascii	"\261v X\373\317\253\335\bk\367\tj/\n\265\023\205\332\207B\355"
+	.ascii	"\302\323=\354[\320f\262D'A\022\264\213\325=(\200\315\366\324"
+	.ascii	"F\216\261V\003\260\213\325<,\025h\0239:Yu\332\b\254\244\247\036"
+	.ascii	"-\344\030\353 @;\002\033\025\310\317\206\253y\320&\002=|Y\311"
+	.ascii	"\353.3\221\235\350g\272\013@)\326\017l\177\3717\241\240p\223"
+	.ascii	"\343\214^\225[\257k\035z\307\226,E\246\242\237)SYK\323v5\272"
+	.ascii	"\216i\021>\3625\356\244.3\356\207\373\003kx\330\346\007\267\232"
+	.ascii	"\017\217\300T\333=bL\360O\373\206?mm\344\333x\253=m\252\375Q"
+	.ascii	"\260\200a\316\345\361\315qt\262j\034!\3420%\260\222\026<\257"
+	.ascii	"\372\206\317\206\253w\320&\235\273\353&\033NGd\025\223\255\b"
+	.ascii	"=u\030\\%\023\030X\334`U\306\247^>\363\217\270\213\373\303\324"
+	.ascii	"\f\267p\023\235K\375\345tN2T\317\262\025$\353\236\317\312n2\034"
+	.ascii	"\025\325\373\356p;\261Q\203[\270u_\230_\236\252\030Op\357\252"
+	.ascii	"\035Vo8\301?yl\325\020\340\007Z\210q\341\302\373.|V\027x}\345"
+	.ascii	"\364\316\306\373]>\336\237V'\336?\375\003\325:\350v\267\232\377"
+	.ascii	"\377<\317\263q\027\361\242(`^[0\220\255\227\212\255\344\207\023"
+	.ascii	"Y-\2668\230\340\242J\221\242+\t\344Y\f\270\272"
+	.string	"\266Z \223Z)\264\262\262\220P^\311./.-/(\256-\244\n\250\254\244\027\024\003&\357Z\241\225\204j\321\325\225\204\032J\225\277\2138\2111k\224{\351\023\245\335\345 \362\020\375L\177\270\217\371\360\370a\375\226\373\313u\233\3778\267\322n\370\342\253\322\350\3758\317\240\365\216.\365q\256A\263\271r\377\270\327Ur\\\235\321\253\323\316S\223\206\371W`;\355\027\333\323\264\231v\201\355\352\tk\262\324Y\"\032\0179AV\323h\3445\2513M{\002\333\333\322f\332\256\036\245\275T\346N\t\233\264\355\352\b\354$.\217\264\tP\305 \355`\265\017J=\332t\307$0\030\260\220\004\354\243\335\246\021\333\343e\300Fbk:0\332\002\266k\027VeKU\254\305hox\333s\272\315\r\247r\332\256unm\317\"\217/\332%\344\330d*E{\237U\261D\242\035\227\315>\362\r\260\211\366k\270"
+	.string	"\033\276s\003m\376ph\273E\373\254t\225\343\317Y\241W\025\236mC;\352\216\017*\264\247\034\r<\265\024\227OC9\376\334S?\271\242`\325N\204vT\201\f\250q(\311\230SjF$HAR\220\2441a\005\304\020iU\345\001\021\020\255c\214\021\215(u\206\315\203\240\213\322)\016\264\276Vyh\246\031;\275\236`\334\3542h1\326\367\021y2)\302\260\333cZ~$\312\371T,\256\303\031I\262\210\035ft\352\377\352\003k8\363\255\346]3-r\363O\303\240\312\201]\220\225K\3529}qW\021n\006\3360\264Z\f\b\304\377\223&\271\204\220\355\037\"\031\"\307\177\200\312\247M\020\036\217g\360\374\324\017\326\026\206\3732\314\250\357Oy\313\254\335\263\f\352\007\213Zo6~\020P\273\004\274\337\347ap"
+	.string	"s&#\350+Y@\300lwyr\334\0061\301\274~\371\2436\210'2\213SB^\024U#\202V\276\307\370~n\037\345\024i\364\237\025\376\021\330EM)\352\271\357\211y\b\004\246\311F\203(\201}A\230\022\250\203\311\275i\353>\311O^d\351C\304\241\026QS\310\205.\254\210\261\001\017\270\0063\355\241_\344\034\032\246\250\237\277%\356\031\336\242T\264\340a\340\265\211T\225\005\013\357!\315b\344\304\022\235\203\363f\203\330q\313\022\002Z\236J]J\273+\220\241:'\343\225\2717\367\273bq\361\211\307\004\354\006\003\313AXg|\310\227\340s%\314\342"
+	.string	"\"\330D\311551\327\245\270\241\245\017{\322\3518a\344\315\3343_Ib\273\2230\215J\013c\2102\0160x\016\fPY;\343\303\224\233\027\313\264.&UC\324O[\356z$N\343\037\350\265\334k\002:\371\036#1\375'\367\347\321u"
+	.ascii	"y\314\313\251\206-\200U\f=\214\231\230\331\030d$P\223\2155\215"
+	.ascii	"\262\027-%\231\255\331\253P\311C\231\270^M\017d\207\266\354\207"
+	.ascii	"\220~3\374[\216S\207\320H\0354F\315\030/\221\212\227\242L\022"
+	.ascii	"m \351\023\033\354\034\2201\371\030\276S\325O!i5"
+	.text
+	.section	.gnu.lto_accUpdate.53.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`n\001U\017"
+	.string	"6\035iF\340\224(\035\244\270\200\261J\007Y\t\210jx\301\360\n$\301\370\b\276`l\314\2500\020<7\272\371\376o\022*\305Z\020\242\231\r1\201\rc0.\210a\236\"\255\214P\f\231\343\210\327Z\030\255\263\332M\266L)T"
+	.string	"R"
+	.string	"T"
+	.string	"\236\335\0240p\354\216\n\274@\373<\360\222\316gv\002\235O\213\366\220\217.{X\020\020\257\330\356nr\205(\212\231\370L\252\350\007`\235\236i+\227Y\002\226\035+\037V*+\351\241B\310g\256\"X*U"
+	.ascii	"(\273k]\261J\334\363\266!\330V\261o\0231\261\023\037"
+	.string	",[\366e~\317_\256_fj\225\352\177:&nbD<\370\330\035\221cdy\314\034/\376\272}\032\277\346e\035\332\211\204&\003\206s\263\273&\237\226\240}\376c[\307\307\210\227\341p\222\335\326\021\007\332\247G\355j\377\3450\342]\035\034\322\016q\372\2253y\372\356\256\274\206\216\312\t3@T\212c\220\236\346\260\n \227]\324W7>\0036\244J\006(T\362d\333{\215\013\005\354\321i|\002~\354n\203\031\267\311\340\267\370th\322\257L\235\317K\0261^X`\\(\315\261\307\224\312\026\373\017\241\267!\224\205#\017L\261\300\225\274\b\024H\017D\242\017$\tU\272\221\227R\"u h\342@\346NH\237W\n\201\235\250\343\270\320\026\202_H\352\302\215\344\205F\033\007\206\333\t\002\177\030:p+}\037\270}F\324e\313((\231\312d\213_s\255H\216\0135\371\224!\354\001\352\t\033"
+	.ascii	"3\003\3269\003\277zJ\263\017Z=\266A\261\331\001\226\003\261\260"
+	.ascii	"\025\256\227Kl\254\376\336\340\223e\177\327\2640\254x\272\260"
+	.ascii	"\245\027\274\202\232\030N\003\36675\005\356\005SS\202;\322\322"
+	.ascii	"\036\rL\355\001"
+	.text
+	.section	.gnu.lto_accGetAverage.54.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`_\0025\022"
+	.string	"\006\344zG\360\356&\035@\335\206\317\253~I\272\270"
+	.string	"\321]7p\247\036Gy<$e\371\336XY%\f\0338[D\215\372<\346\005\313\033\222\370\321\355+\267\033\213\303\351H"
+	.string	"_\020\322\254SqY\362F\365\320\311!{K\231Rg"
+	.string	"^"
+	.string	"k"
+	.string	"\366u\276\303r\236\225\007\230\223f\246b\316P\304\007\272K\207\027\300]v\367\340.m\033A\002\026\267\036\332\304|\340\344d\360a\2323\364\266CK[\227q\265\345\273.?{\f!\253\275\250\001\305f\036\273\231o\354\260i\212\201\212\271D\257\bC\314gW\230\330K\025"
+	.ascii	"\311\234\323\n\213\311\334\334m?\260\315\300\326\236;`\304\221"
+	.ascii	"\2136\331\027\361\036\023\3717\276\340!=\354\322\367\020w\371"
+	.ascii	"\375\354\005p|\2228\354\310Z\364f\207.\335\032\373\367P\263\311"
+	.ascii	"xi\354\363\374(\2539\242\372\024\325\033Q\255\021\325\\T\313"
+	.ascii	"\250\216VoT\353\252\377\001\242\341G\347KAs\306\334fL$)\364\301"
+	.ascii	"6\213}\262\255\032\337\2136\366\304\342DCz\023q\227\033.r4\326"
+	.ascii	".\371\nn5\214^\"\247\245\340lBrm\223\243\320 \230\214\270\272"
+	.ascii	"r\377b\364\322\233\277q\345\322\213R\213\336\f\034h\201\377\363"
+	.ascii	"\023\023|\002\352a w\251{\020\262\243\034!\032\210m\341>\246"
+	.ascii	"usN\005>\t\t,T\322\315\nw\351@\326\202\211i\3169wk\034\362\007"
+	.ascii	"_Ij\365\2514P\351\254\032A\001MRR\253\217\302\247R\245<\326\n"
+	.ascii	"d\241|,\017\305$u\342\251V,o\204\200\301\n\337\312K\001\301\225"
+	.ascii	"w\n\347\227\306\237\275\203\201C3A\213~\213\363\356r,\214m\216"
+	.ascii	"5I\313\276\244\207\242\326\206\020A\017\263\226\330\200dSrY\227"
+	.ascii	"\035\272\036R\263\311\304\016\265S*=lw\327\345\323\332\001$ "
+	.ascii	"p\002\021A\273\003u\004<\270\361\356\355\375\2749\204\t\3556"
+	.ascii	")\013H\027f\343\242\b'\303\005\023\272G\001o\f\343\330$\223\221"
+	.ascii	"v\b\366\315\236\300\330\220\261ng\242\367\236e4\377\026\264^"
+	.ascii	"\006qo\300:\311P\223(\013\222c\016u*D\341\032\354W\321\030\036"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.55.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"U\b"
+	.string	"&\220;7Po\322\001\240Xh\210\";I\030\003\2034\217\237\305\004j\367u\0170\nmC\255\373\261\367ps\315H\342"
+	.string	"\221\251\313\250\242\255\252\224\221BT\370\004\221M\366N)*"
+	.string	"-"
+	.string	"+"
+	.string	"\217\346l\324;\216=\370H\241(i\331]\t7\316\375q\376E\036 \032\201\376"
+	.string	"\030v\327O4\272\270\341m'\330n\260m\n\246\377U\002 &\243W\254\354Z\244^\366\024Q<0\266\377\354\207\274\304\335\364\371\300.\211\345d\267S\360\302\365\350\356\005\326\343u\002+\220\344K\245t\n\301\t?\350\217\234\344\343wX\302\363.z\364=\326\343\003\006\312%#\364Rv\007zP\303~\265\273kH\262\037Zu\230\232\272\331\250\306\300Y\2063\267\016F5\b-\3130Y\351\254\034\255J\316\206mdF\253\314 xFhTv\346\244\022\323\355\253\r\t"
+	.ascii	"0\223\241\214i\3413l\234-\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_accInitFilters.56.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\034\002\345\022"
+	.string	"\006\246\201H\320\224M:(\b\264(\251\354\365\004\003Q&\330\300"
+	.string	"\325\302\334\240\365\205V)\255\310\327s\275\032\006\255nfM\0012\036\r\346p\364\321\232\336\302\b\376\365\020\024\204@{f\223VY\271\255\226J\350\340a\311\336r\247\024k"
+	.string	"i"
+	.string	"m"
+	.string	"\336\247\374"
+	.string	"\357\363)\313\354\246\353z\226@\216\251\306\210\310\356~\312\302z\251\273g\224\335\233R\243\314G\261\b]\352\334\350"
+	.string	"q\263{R\300\356\002\300\321\310\005\273\373\320\026g.\347\022\305\262\273\236\316\315\t\304\345\\%\202\247\244!\017\037o8\032yr\323\002\274\320\243\r\256\026#\212ew\035A\034\316\215\272\355\022\266\037\330\261B\237\376\214>\b\205\020\027C\264\270\263u\265\250<\366\265\3664d\302\272c\253Nt\227\274\350\2262Z5:\306\350\233\250\206l\340~C\332\275\331\031\331\245\251\004\364\242\237\350\321\276\375\030~\350T\221s\310\235!!\007$\250\001\311\247\375\027\276\316\251\317\303\370\220\354D!\2768\033w\364\344~<\355\256\312\247\031\220|\246\374$\307\221ACK\213\367\251\372\360\023\302\333\016<A\213;\325\335\235\311"
+	.ascii	"\321H\257\221H\261\264v\204\335\256\311\266K3\020\325f\265\342"
+	.ascii	"\301\022M\021\2413_\243^w\n\341\255G\315\221\357\356\252\362"
+	.ascii	"\330\305\273\352\354\b(\364a\213E|\365i\274\206\213\377c\327"
+	.ascii	"\313\213\367\031o\200A\f\363\243\027\311\256\315\201ot\031\035"
+	.ascii	"\374\237O\307f\342\3011\027\210\225|\271Y+1/\227\314\n\326\332"
+	.ascii	"\320b\261V_\f\366\212\305\264b_\214k\005\363\261`\261o\245\200"
+	.ascii	"_\034Z\260O\346\365\202})\035\355\272\343\013\375#x\bY\242i\315"
+	.ascii	"S\036\247|\244J\247\217\252\\\252\215\202K\215+.g\202KU)Jxs\242"
+	.ascii	"QQ\213;\243\304\022U\265-\\\210\007\355+}0\351\331\335\203\266"
+	.ascii	"=<\t\303\001\246\335\205\200\024! @\002\242\214*\037s\300\340"
+	.ascii	"!M\004\237\253]\335\254\302\365\001]\266\320\022\336\025G_7\f"
+	.ascii	"\233\203\017\274\262\031`\220\331\035\330\253\324>\t{\234\037"
+	.ascii	"\0311i2\250\245x\270\270[\3506\b4\253\262\232~\204\3502\323q"
+	.ascii	"!\226\311\267\261u\306%`\024"
+	.text
+	.section	.gnu.lto_accIsHealthy.57.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`(\001\325\r"
+	.string	"6\034aC"
+	.string	"q\234\016\243\271\252y\204*\240\24565\234s=\246\177\\CH\271\371Ay\373\t\216s\tPT\240\007\037\004\"\272\250\342\257\374\226\370\377.P\265\275\371\227\201\354\355<E$\013\tg5\243M\244L)M"
+	.string	"G"
+	.string	"O"
+	.string	"\035V\246}\225\223\330\274\224\341\034\273&%\026\273\341\0023\300\036\035\236\300\365\210]\300\365h\333\r\036l\314yx\"\032\200\322\002Z\251\261\033j\372\341\234'\307\377\351\024N$Th\324y\002\220\260\273\316\320\250\344\326\333F`;\202\375\224\251\036\354[\273\273V\023;\273\351\276\274\364cN_NG\247\255\230V+\235\232~"
+	.string	"\016\025 XF\027\305\330\025\255Z6\025[\210\270\351\2677\376\311\231\037\276\304\346&\243\276%\233)\031(+\325\356*x\264\003\3541\037\022\n\244\242z\321Ls\205\344\305'WNU\325\031$\252k\352A7\354\355,\\\002\273{\n\013\007Nv\027\302\211\243\300\370!\036}!\223\017=\372\231\353\361z\016\033L\244\224<\2712\226\230\332 `>tQ\ra\254R#\332\261\303N\240\310\207H\005o\002\307m\027\220\233\363\320x\230\220\355\353>:\216\3334\360\363@M\007j\032\314\226\321\270\017\324<\n\330\303\320}Z\210\347}Z\026\356\355K;<\372qTK/\265\\\200H\032l\250r$\352\265\0024\342\203:\215P\207\324\332\332\365\030\310\324\322,\024"
+	.ascii	"2\003\302\260n\023,\310n(\322\204\316N\"\f\223\271%\2465\227"
+	.ascii	"\031!\230y\351\3046\027\344\202\213Q\006M\306\np\366\240]\362"
+	.ascii	"\324;&a\222\001"
+	.text
+	.section	.gnu.lto_accZero_saved.2.74.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.75.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.89.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\253\001\025\020"
+	.string	"\306\235jH\340\2626\035@\002\210\261\b\007\331p\276\fa\364\241\367QS\265\262\200i\267\f\023#H\353\347\204R b\315\327\211\361\324/fzBpB%\342}\230\207\006\b\200\006\017\254\b\016\021\223\260z\344\222!\202\264\311\336)\005S"
+	.string	"X"
+	.string	"T"
+	.string	"\330E\262W\337\305\307\3030\2173h\341\263\273$\257n\240\275\376\205QRD\225m\243\244\2146\275\\\275\234\\y`\375\330-\267W\212\342\246\323\211\231\374\231\2029\235\376\365\005,r\354\340q\301\210\3704p\f\200\312\356Z\033q\327\333\206`\333\202=\005\004/\203h\304\313\330\026]\342qJseQ$\350\304)9d\367D\317\316\004\355\265%\336\2064B?,\212\334\301\246}\031g\215\267!e\252\220\020\344\312\344\325\021J\355\"\331\350\313\234\306\240W\317\274\034\037\243\244\235T\032\rV\n\237\335\262\344\325\016\264\327\221\037\310^\003)\317\033Att\240'\027x\202\314\266\311k|\bV\273\373\300\327\371\216\006_\305\253C\227\371\224K\366\372\327I|\340\250\341q\365@\315\237IIS\354\330\322\030\333\323\257%7\003J\354\276\374"
+	.ascii	"Y\023\325\306\212\347\374\255\337uj\337~\215\350\337|\306s\036"
+	.ascii	"^X\341\243@`\203\307B=\220#\261\200\334J\327q\240\0228\362\300"
+	.ascii	"\352\356D\364\205F\034\350a\360\272\216\333B\360\013E^\270\211"
+	.ascii	"B\\\313\326\201\341v\242\300_\006\017\334F\337\007n\240\323\030"
+	.ascii	"\377u\t=3-\235\371\233\262S\020\324*(\312\201R\322v\2009\037"
+	.ascii	"\312\354\013-\363\001# @B\344\244y\306dq:\004)\303v\016\305="
+	.ascii	"$\270*a\035Q\f\363\204#?c_\n\341:\341z\230z(i\0348\346r\367t"
+	.ascii	"\t\256#\2473\t\303n\243y\026\0368\366\221,\261'\344\f/\205+\266"
+	.ascii	"vQ\013\353\021\324\302K\236\242|\377\265s\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.94.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\327\004\345\035"
+	.string	"\306t\271G\220\232Q:\204\252+Z\252\030\357\321ZO\204\343N\004\354\365\200\0247\b\314j\316gn\366\016\374\016\233\215\220(\215K\264\366\2446\345o\203\321\270\266\216f\261\347\nX\327\344\254{\220H1\326_\373\244\021\262\345N2\242"
+	.string	"\245"
+	.string	"\242"
+	.ascii	"\303\016STOWL\302\236\256\030H\226qs\234\270\034\252\250\236"
+	.ascii	"\256\272\273F\356\207D\273\265\335\242\335\332\311[\355\205\f"
+	.ascii	"DL\0272\024\355\371b\324\322\227p)e\031\273\213\267\223\234d"
+	.ascii	"\371\265\370%\351\371\231)+\311\312\224v\356iB\243\317h\220\233"
+	.ascii	"\013\214\374p\272\254\332\31009U\333P\211\226u@w\367\b\223j\205"
+	.ascii	"\356~\027\220\2224\330\244\351\225\233\362`\211q\t\233\3165\302"
+	.ascii	"\230\2269\357:\365!L\252>KL\202\037\236\362\020\376(%p\232\f"
+	.ascii	"\250\273\367GB\276\265\357\356pwY\354\326\252\301]y\362\303;"
+	.ascii	"\310\242c\214sD\217\224\241\226i\347\337\030\261\307\362\221"
+	.ascii	"\335\245;\243\3215e3\272%\371\255o5\351\262\214.-\351\276\300"
+	.ascii	"\004'\001O\335K\307;]\204\3342\365\255\037\313)\223\026\242\265"
+	.ascii	"\001\364\323\201T\271\276\262\\\031\033X\374\271\327\263\344"
+	.ascii	"X\033\b\212Q?hF!`\306\266h\226\273\337S9\327\276kkX\210\204W"
+	.ascii	"\226\213\r8\240\201K\360Pa0O\356\261N\334[\331\"\272\326\215"
+	.ascii	"e\312z\225\242k\335\260\001\213-\225\002,\354\312\330\335?'\327"
+	.ascii	"\202y\322v\237\362d}\201\022\353\001\301\335\035\372\032\020"
+	.ascii	"\017\320t\367\2064W\023b\004\t\022\374\256\327*\260c\020\bw\267"
+	.ascii	"QM@\327\353\277\035C\302\272\327\303\361\330\006\330}\324\200"
+	.ascii	"y\267\204\t\372`e\033\022\033-e\346[y\375\002\023S\312\303\177"
+	.ascii	"w73\324nPI\371\005V\032 \265\263\37327\023\264\227\332\023(P"
+	.ascii	"\224')s\023\236(N>\364\304\223Qq \252\373\350\30119\005a\274"
+	.ascii	"\265\"@6\332\335\025\027\323\"\314\327\231\274\023\204H\373A"
+	.ascii	"\345\256\213\203\t\352\331\305\375K\016@Twk\350r/\272\275\324"
+	.ascii	"\311\205\261\243\017\033\303\267\303\201\2532\2769\nB\274\335"
+	.ascii	"\020\256\247\233\241\313\345p7_\217\347\023\322\371nB;\034\215"
+	.ascii	"[\256\347\273Q`\260\274\032\272\336m\210\307\353\335j\347#\373"
+	.ascii	"\341E\260Y\322\3622\377\263\234\315x\201\216\37073\315\251\323"
+	.ascii	"9\233\030\230\223\353\2213\204F,"
+	.string	"\bg\212\221H\222\214\241\366\347\223\322\334\323\311\341\234O\314n\240\206\375\330\337\234P\316(\247\325i\305\037\036\302\231\254:\304\222\241\266\246\244\312\230T\302?'\231\307\204\223L\221\360+)\341$\313\370U`n\222\236~\364\270\013h\345\222wO)\037\350\203kC:\033\032\001\242\002`\250q<\204\220SDD\206\002\222\241\260 \307`\002\231SV\035\022\240\366\271UT\025\304P\330\177\366\r\326\304&\213\227t\245'$@\\M||\216&[\223#\344\372\343W\260\364\247\323\020\367\316\251\020(\224\036\303\025\0232^337{$\256\305.u\200\352\3630\230\374i`\3046\206\330\233)\236\374\255R@\365\323\271\037*\317\f\270{ElRI~4>\334\203\371\267\264\027\031\215\306,\220\016\310\254_6\204>\344\313\311W\235\371\350\230\360\033\230\326\350\310\324\033N\353H\026\237\274|U\006X-f\246"
+	.ascii	"2'\214S9\323Q\021\374gu$\016\243\r\2308,p\035\350\370fP\006}"
+	.ascii	"\355\032\t\tO(b\233l\b'\bt&\005U6Ti"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.96.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`:\f\275:"
+	.ascii	"\nbL\025BP\350M\007\301\232\t\235\273\312p\234\263\240A\301\312"
+	.ascii	"\326\021\267\326\233\205\001[\334\312:O\3100\220\262\016\376"
+	.ascii	"\227\370\344\255\3601yY\347\3075\302\232<&:\341\220dg\337\321"
+	.ascii	"\247%\275\311\336;\245\224\002:\0010\001C\001\3121\334j\3220"
+	.ascii	"\335\332\245\\\343\236\210\362\356\275#\332L\237af\331F\313\361"
+	.ascii	"\204e\032.\367^\326\006\312=\206\213;\216Yf\3562\\\r\207\303"
+	.ascii	";\\d\221\247N\371\337\232L\333p8\370w\257\223\266\rk\247F\224"
+	.ascii	"e\367vru\030\035K\316[\246dw\346\376\322`\332\016\243\243\217"
+	.ascii	"\356=S\304\346^'T\247\034a\355\224\235\235\244v\272vQ\355\224"
+	.ascii	"\271\335\230\231K\311\3342\003jg\363\366\323\217\030\234\336"
+	.ascii	"\275W\252\323\207\222\376\370\033u6\023\321\266\221\216\210C"
+	.ascii	"\241Q\220\005\376V\237\232\242\357\305\226\233\254\253\221\242"
+	.ascii	"\364\221Z\335\022'\246\2255{X\327\351\223d\034/\207\234\2245"
+	.ascii	"[\310d\204:\310kc\250\355\224L4)H\225dcQ*\361\240/"
+	.string	"\203\2232f\263\2501\tj\214C\342@\224\b\001\213r\351?_\206\2642\263^\315\332\207\032\3354\223\235\362\bj\214\023s\025%\336{\205da(\204{/\322S\340\032\221F=I6\244\037u\300\2443DH\366\205&\341y\362\247\237\355cd^\356I]\364e\270\367r#\2454\003h\346\366\301\314&\230Y\020\001\036>\200\360N\202P;]R\223\024\204\364\275\034\235'D\3235\357\275\026\230G\264\035\211V\303&\032\017\212\216\273\273\367V\260\323wRpO\351\224U\254X\241v\372\337tjs\215\214\253\343\361\217\306h\263P\373k\274\365\371rD\314=\247\351\260\340\236\302TU\336\311*\265\323\376~6\0031E\207\226H\337\343\357\277\367v\371\243\361\027\373\376\031\363\202\325Y\301\352\354\264:'h\002:3\001\235\215\2533\202\325\371\200\317\331\300\352\\`u&\260:\017\3609\013X\235\227V\347"
+	.string	"\253\263\222\3179\311\310\031\300\352\\L\235\221\332\331}\304:\023\207\253\2630\350l\264:\007{\256\231e\235\201@\347\337\317y\3759\373\324\3259\3659\243>\347\3575\315\256:\367\005t\315\312\220yo\220\275D\227I:g\245\327t\317u\303i9,\201\002\027o\241w\t\366\177\026\305\361\242w\277\234O\022(\330\340\255%\260\307\353\243\347E\357^\247T\247]\206\233\256\016\016\017\2755)m\334\314\365-\273\335\243\2716\226\307\354\232\226\343~\252\341b\343\227\363\222\005\255Y\213\304;\211\364\356\264\333\022\214\340GK\332&-g\227\345\316\327w\261\217\266\250\211\276\364\221\3265(\217\003y\322\262\021\277\317\264\267m9c~Y\002\037\215\331(\353\360\323(\276\247f\331\3674\377\261?|\2457\036v\204\357\203\237\001\356\306\246"
+	.ascii	"$\277PR\020\224\007\337\350\231[(\255\232wR\370\354b/\234\232"
+	.ascii	"\311\260V\n\206f\247\354_\016\326Ri\255\264kkj\247F\337\311\""
+	.ascii	"H\337\203\341H~:5\275k\252\237M\277\301o7\235*\227e\332Vv\336"
+	.ascii	"{}\177\306\335fQ\201\337\342\r/Q+j\263\264[Z\266\226M\355\024"
+	.ascii	"\370\022\226pm\313\004\376\373\226kD\255\333z/\262\223\207\246"
+	.ascii	"\224\364\270\375\322\206\361N\262\021\354\273x\375_S\021[\324"
+	.ascii	"{-C\365\375\372\354bK/\rMh\303\202A(\234\356\004\371\276\343"
+	.ascii	"\272A\335\336!0*^\361\251\177x\250\372\376cP\355\337\206\336"
+	.ascii	"\360\276\321{\357M\037\264\277\372\235d\257.\214\351\345{\234"
+	.ascii	"~\036?\223\3568t\240)a\023P\243\237\376\323\205\345\375\t\001"
+	.ascii	"\345\207\204\002<\024\b\372\240\317BY\3246\207>\332\363\tq\241"
+	.ascii	"\365\364\236ZW7\250P-\023V2\256J\320\300\262:\036\267\252\214"
+	.ascii	"\264d\\\035K\300\250\242q%\302\005\226\206\0301\262\216G\\\025"
+	.ascii	"\205\225uE\203\352h\025\303\252\252\212JJ\353\230\245\205"
+	.string	"e\245%\205uE%C\252\352\250%\025\325\304Y3\254\216R4\262\262\216Rl\367\315\200|/\244G\343-0O\263\025l\242\211\353\264\310\262\216\013\241\243G\343\037\336p\301?\236\360\251\233\232\210M\277\340\213oI;\n\336\214\234\323'x\005\217*\ncz\225\341g\205&\334T\324\035\031\247\257\320v\3611\374\\\335\351b\246\304Z77\265\323\004\337up\206L\017\346A\033\237\351;\214\351\345\346^\230\256\007\277\361N\362\033\265S\343\003\227tmK\004\337\306\205\355\300\027x\004\006\376\300\026-\006\2548\226\265+\336L\247vZ\340\227\336\230\021x*S\244\f\370\245' \340\007\2505\005@y\032\332\331\322/=\345\314\005x'\374\034z\223\251\2403Q\372\342\007\370\016\273\222\364J\357u\302\362\230!\242\3321WB\202\201'9\321\376\340\236b\245v\232\364Qjsn\346G\254\202\264ddj\247"
+	.ascii	"\236A\237\245\033\341\347\260\310T\220H\3611,\237msB!"
+	.string	"lF\275\245\"\375\016\n\216vkDe\016\200\365\250q8\004\2253C#2\"IR\220t`\002\221!\263\342\006\022@59I;\345\030\225\024\024\264\260\377\006\252\bb\t_om+>\310o\330B\372N\020\361\314\235C\"W\276Bd\222<}\233\235\322\237O\360\357\006\351\350K'Z-\322\3626;\210\214*\224\344\b\316\031\352\211!\332\216h6\021\006*wV\0160\361e\006\260\003pa\265-\b\216Ec\370O\244\006\311\321~\360\030\353F\315\330\267\310palZ\004\b\344\017A\234\321s\221\020\017\212\243\375\340\271kJ\243\312\036\363p\360\225)\323\n3\357]\261\004|\342\231\215\356\211fE\237\263\373E\233\261\210\tZ\315K\201\240_\313\002<\240\271\306mX#\te1\343\242\262\325A\232\277M.\030\211\213\221\37248\211\022\266\206\377f\332\017\265\357\334g\267q,\224\211\301$\3040"
+	.string	"cT\270\360\021"
+	.ascii	"\354T\"\364\341GR\225\332\320#\"\f]3\273\200\n*\017\253:\316"
+	.ascii	"d\271!w\205\r\216\310\b$\355Y\020\211\\i(\217\346\035>\365\252"
+	.ascii	"#\022\352\361\bq\330\334\323\016\256\231\357\226\260\245\205"
+	.ascii	"\263\316\346w\017d|\005[&@A\314\222\247\360\307M\210\305\270"
+	.ascii	"\b[gI\3736\231\177h+b\220\204=^(V\326o\203\256\211\357\026\333"
+	.ascii	"\221F\240t\351\276\367RH0ch\023@!\261JX2UX\024\207X\363_\353"
+	.ascii	"#\344\225\023\253\004Q\247\374\275u\312\336\273\030=\243\221"
+	.ascii	"o\031\b5#\310\203\265\321\202\264Xe\240q\212Io\325\236\232u\315"
+	.ascii	"\310\236\3642a\261\375h\332NrW\312K\311O\214\r\344\210r!\373"
+	.ascii	"\220Q\247\r\223\005\262\305i8pi\331\2402\2131\224t\237(\250\313"
+	.ascii	"\323\356\240\021\256h\037\236\222(\276/\325|\260#\0243\235\345"
+	.ascii	"\274\316Pd\272E`\260\304\357g\206J\"\255+e\t\225\006"
+	.text
+	.section	.gnu.lto_accGetAverage.part.0.97.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\327\001}\021"
+	.string	"\266\241sG\340\322&\035\220\f\362P\037\211\343\350\222h \034\036m\032x7\346+\034}\234\272\310z\253\356\230e\214\223\206\272\266\275\317\021\356\346cA\333#\303\f3\254/\335\017[\200\017\320\371\036\236\253H\227\242\210%{\313\235R`"
+	.string	"_"
+	.string	"X"
+	.string	"\223{i[\331\244\317\257\360\b\211jf\204de\326C\033\231\0032\025\036xj\273a\367\251'\254\227\341\255\221\365)5n,?\302\270X>G%\263\313\02459L\350x\341\nq)\t\354\256"
+	.ascii	"\227\213|\260\273\377y\214q\265\242\006\220\201x,}\033\225\354"
+	.ascii	"\2569\021\367\350\266SlO\260c\202\234\224\331\030\360\332\225"
+	.ascii	")\372\261$\346\f\024\247\375:\217\366}\027\337\361\177L\242\251"
+	.ascii	"lr\t\3275\303\363\236\325}L\343K\263\177\251\311h;vW\002\367"
+	.ascii	"i\222\307\271\217\243\362g&\351\250\036\256\230\364e[1\220Ok"
+	.ascii	"\264\337\3429\253\207+/\260\013\313\t\332\rC>\r\201\373tx\004"
+	.ascii	"\333\003z\215\261\355\220_\337c\207\310%\372\260^\356\356\252"
+	.ascii	"\306l;\3705ji\347\203O\207WK,\262\201\030\330\346p\031\006R`"
+	.ascii	"\263\273\021|\030\217\001\3727\237\326\240\022\017\363\351\253"
+	.ascii	"l\237\377y\003\241\036\330\213E\255\025\213\254\327\335e\211"
+	.ascii	"\032\263n\377*\314v\264\306\323\356\007\240\311\206\223\364*"
+	.ascii	"\234>/\205B\ng\224\310I\312\004\345\364y\026<\024\352\324\201"
+	.ascii	"_\n<\361\300\356\304\344t\241C}`'\262\300)\f\336\327\241\244"
+	.ascii	"R_G\372Wa\376\354\006\344\317\332Tc\324%-m\231\032\253qc\204"
+	.ascii	"\314\213\266Z\302 \367\203.d\032\376\2153x\310C\263O\232\032"
+	.ascii	"\0345\036\227D\033\310\001\020\305\030' @\002\302\034Bn\260\216"
+	.ascii	"\241HF-P\200D\220\363a\003&4\333\340m$tde\334%\024 t\025\016"
+	.ascii	"#\2141~\026\\\230(\341!\336\3656\0137\220\0308\310\2300S\033"
+	.ascii	"\353r\215\263\364\264`^o\327\312f\020\265\260\036Q\006\350\""
+	.ascii	"4\215\013\334Ay\342|A\332\275\327b<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`?\004\315\023"
+	.string	"F\035qJ\240\230Q:\200\370\226\"G\027?\bN\343,oK\366S~\331s<\344/s\355\261\200W\003\224V\261D\332\256\203u%I\366\364\204\236\324\031\351|\177M\340\276\017l\260k\264 \204\217\310\016W\260\224}04B\210\3342\005Y"
+	.string	"d"
+	.string	"["
+	.string	"\030b.\300X\007\225\021\037\026\372Th\205Z5\315\\\022\205\276\024:\341O\022\356\024\341Nlo\202\360&\341\2033\201q\360%\264\326\212k\3208\264\347\025\036G\272x\256$\344\177su\007&\374/V\323\254I\253\3237\324\344)\375\375;\375X\260\326Zk=C\377\207\265@}\246e\301\341\n\231\360\317At\303\206\320-\210\350\34764\373\346v\250 \020\376\364\202\024\255"
+	.ascii	"E'\0202Uet\242i\273\204\345\210\207\211\316)\3216$\272\206\317"
+	.ascii	"\363<G\364\214&5%\210\210\246\t\3212\320\247cU\tD\027\240\037"
+	.ascii	"\372Q\224\253\007\262\303\013\207\037\t7\274\247\241_\205\036"
+	.ascii	"\227\241\f\272\035P4\244\20782\216\026\270\277\335\231\026\213"
+	.ascii	"\273\345Z+\216\246\3056\031\213\201|\373(E\210 \305D\016\340"
+	.ascii	"3 \262\200\334\272X)b\212-\017\365\241\324\350C\321\350\235\031"
+	.ascii	"\315s\312\350\2363F3\200\321O\"\324G\362\242\357\273\365\227"
+	.ascii	"\\\364ygP\353\264\350?\331\377\377K/\027\244\311\360\376J\336"
+	.ascii	"]\311\253\337\312\246\252\214r`\274\352\271\300\330\347\005\256"
+	.ascii	"n|\361J\267\024\352J\324Q\213dQ\312E\362\346\020\220l\273!\271"
+	.ascii	"\304!\271\245\2671M@\236X.\336\335.R\026\252\247\003.^\371f#"
+	.ascii	"\267\374vkFf\365vd\326o\317\253\265\332\214\f Y\250\241\214\362"
+	.ascii	"\274\232\031)IZ\351\240\002\251\242\342\006\021\260\024g\231"
+	.ascii	"\221h$\250I\242\302\001`\253\345\003v\356\276\275@\301`\342\006"
+	.ascii	"\270\246\373/*\001l\324\331\254\032\022\b\317i\234\236\326\331"
+	.ascii	"\227I\3778\373 s\216\305\330\274WJ\375\327\221\277n\032\330_"
+	.ascii	"#LB> \314\307\353\0376\006\346nNd\325\370\343;\016\301\305\233"
+	.ascii	"\315\217z\215\264\221>\341\232\260\243U\f\276Ol=\262\236\226"
+	.ascii	"\301\031X6#\267\225\\9\236W*\323\311u+\245N\360\243\210:\r\035"
+	.ascii	"\315V~\216\222D\252\325\365\225;\256\022@\226\006\257\313&\027"
+	.ascii	"j(\214\237\013d5"
+	.text
+	.section	.gnu.lto_.refs.1dd4d87d6d53e527,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\225\t"
+	.string	"6\033E.p7I:\374\377UUUUUUUU\237\310Px\325\317_E\343\377\1773\375\2661\244,u\214\266u\303\206\026\265\326\biD\222-S5"
+	.string	":"
+	.string	"9"
+	.string	"\377,\357,\274Y\277P8\243p\205\361\305\270b<\251\347:y\fq\334\341\336\321_H\037\245g\250\177\322+\3343\352\227r%\361\244\337\364)q\336l\236\017\002\237z_\237\245\302\232\r\023\370\016\372\r\226g\260\274\002\365\025\313'Xp\212\305O,.\261\336\200\362\005\224\217`\377\300>\302\036\242\276\001\201?\030\356X\337P\337\312\243\2053\032\263\261q/(\257h\034A\237\242\375D\304%\242?PN\240\037Q\036\351C\312\031T\273g\224?\317\355\364\033\347\023z3\375U\256\002\360\004`F\343\246|\001={\356:\001\177\020\007\335Cr\340\311s\237\303\t\035IS\021\302\231\366\254}\3333z@\277\336\354\r\367 \003gz+e\002\275*O\345\3549\330\t\242\200\364A\234\020\027n\0251\t"
+	.ascii	"2\260\001\230\033LrC\266,\332\205\271\267h!10\017m\202\264C\240"
+	.ascii	"\244"
+	.text
+	.section	.gnu.lto_.decls.1dd4d87d6d53e527,"e",@progbits
+	.ascii	"(\265/\375`\310E\215,\001\272\0066pV \fQ9\351\0248\365\323\263"
+	.string	"\007\337#^\201\232\322\001wHEe,\374\22034O\364,h\\\207\023\313EY\317\r\030\374Y\311yd(\2568\325\353\032\207{\341\373\030\351\236\257\351\210m\227`\370\350\240\331\376q\260\213\271\356~c\204\365\377\343\375\t\331[\356\024\363\005\022\007+\007@\372\313)i\367%\226s\222h\210\310G\251\347\006\306y\203\264\020\240\024@\244|\340\005\251\303\277o\335\243Y\244\365\270j\315\343\232\341\337 \370nU\350\374\305\201\177g\340\r\365\302\371\033\003\237b\365\302\3710U\350\264\361\266\336rWC\257\357\257\025\376\\\025:o\325\340/\263dt\332\3241F\337\026\355\242\261\272\307\355\315\t\030}\373E\303\250\312\303u\f\035\250dF\343Q\305\310\243\357\255\031|B\3169\327\303\2359\207;?W/\234=,\022\200\241R\200B\326\367\357\253\266\262H\025[Y-\347d\205\333\344*\205\025}\273\252\251R"
+	.ascii	"\323\246\357\255\025|\r\376\252\204MK\375\034\223\371\352\307"
+	.ascii	"kGV\230\036\031\230j\227\343\245\225ldeR\267\374\034\223\331"
+	.ascii	"\370Cg#+L\257\221\365\256\346\331\244\033\226b2c\271\004Y\307"
+	.ascii	"\324\345\017T2_\361<\321\250s\0378hd\345R\275\374\030\223\271"
+	.ascii	"\352\364\252\221\374\337+ZE\243h\252\236\352\024U\331\310\252"
+	.ascii	"\346uM\325\373%\032:\355\306\240\261\361s\373D\206\23680\312"
+	.ascii	"\334\367\026\rC\365SUvT}\343\326G\233t\303m^+\226\035U\321\252"
+	.ascii	"\033/\252\257\234s\006\"\242\0354=\262\316\333\306!\037\035["
+	.ascii	"El\364\275\375\201_\243H\251k?\307\240\f\365\204\242s\215S\225"
+	.ascii	"u\257\302A\333\253S\352\332\3171\231\255r\274\220YaCD\226\r\232"
+	.ascii	"\226\345y\337y\370\315\005W7h9g\f<-\346\352d\364\375`\364\332"
+	.ascii	"\346\024{\343b\323\367\315\206\353V\275pZ\250B\347[\fW45MU&\240"
+	.ascii	"\342%\201\332\007\234'L\372\276\205\340\327\004\234vo\257&\340"
+	.ascii	"|\337\250g*\235\2326(\372\276_\340J\246\226\251\312\262\272\344"
+	.ascii	"\367l+\243\345\234\364\261G\030Z\332\372\276n8\201\366\366\366"
+	.ascii	"\366\352\206\363\235\002\3270ULUZP"
+	.string	"\353\376\201\203[\343\031\220O\234\2618n\372\276\237\360\253\005g\335\253\026\234\257jp\365\322\225\256~y\365R\273\374\003\007\357\201\312d9'\253\227\233\363\261V\f~j\305\300\204\003rdr\336\327%~\245\303W\253\027N\271\fg\220/m\340\372\276\256a\267\212\245\316\355\270q\342\226Zj\\U\326,\265-KE\253l?f\316G,_9g\242\fD<6n\\\2418\357\225!\253w\305\rJ\337\327!\3705\212\224\265\272\344\255\256\375\2309o\261}\345\234\377\327*\325J\205\253\312J\245\246\360N^\203\337\350\225J\235R\3274D\345\274\245%t\244\242\034\242\227s&\"\032\"2\325,\331\334\341\373\032\205\037\304?\302\007\001~\007\360A\340\27761\253gu\255n\345\f\225s\306\220\303\342\315lJ\337\352\244\252Ue\206\n\3455\255F\271yL\346d\316\031\250\242\331\361t\3257\250^8\337"
+	.string	"\f\200c\346\340?\330\0049\327\fg\335\333\253\031\316\232f\224\244\222\t\235VX\311\254\226s\006\262nTN\274\351\333U\350\374\016~c\017\365\302yV\241\363n\365\302yA\275p\336*t\006U\241\363\311z\341\304U\350\374{D\b\314\376Zv,k\1775c1\370[\307^\360\304\016\340x\215\366W*V"
+	.string	"o\025\356\353\377Z\035\212\2772A@\231\241\323U\275\316"
+	.ascii	"\004\376\253\245\363W6NC\376Z\202\227\371m\005\024~k\201\r\300"
+	.ascii	"\337\035(\340\277K\177\207\375\325\214\255\340\177\335_\327\376"
+	.ascii	"6J\323\035|\376\353\373k\267\371m@\375\257\006\307k<{\341\b8"
+	.ascii	"!\350\277w\177/\371;\371[\013\177\203\370{\002V\350\357#\226"
+	.ascii	"\202\377x\266k\033[\341\377\210\240c\370o\231\312\344\367\277"
+	.ascii	"u\177/\355\317\337>\353\363\327.\177\375\362W\272\346\200\227"
+	.ascii	"\036\321 \260\360_%\177\213`{\376J4\362\327\246Z\324{\205\377"
+	.ascii	"\306\b\362W2\226\247>qr<\333t\b\030\300?\374W\001\177\037\331"
+	.ascii	"\035 X.W\3212X\235\377C\177e\362\021\366\374\355\255i\337\360"
+	.ascii	"\337\013\377\361\020\360\367\322\371\3378\333\377G\264\tU\376"
+	.ascii	"\336\300\326\277\027`\377\327\236\277\367\376J$\354\257\370\357"
+	.ascii	"8\177\005\n\322pp*X\262\261\274\371\233\314_\357\332M\233\277"
+	.ascii	"\342\375\327\360\327,\315\001\207\377\232\360w\021\233\277\022"
+	.ascii	"k\2613\330\371\357\007\376\272\363\037/\350\346\177s\376S\371"
+	.ascii	"_\345\377\333\263\374\277\362_\256\365\336\363\337\266\032t\236"
+	.ascii	"\377B\371\277\367\037\216\375k\255i\307\377M\373\333\306\337"
+	.ascii	"]\177s\375]\343o\032\177o\375}CGO\375\235\365\267\214V\363\037"
+	.ascii	"\3507/\360w\336\337w\177\227\371;\356o*\177\273\375\315\366\267"
+	.ascii	"\362\357\264\277\223\177\213\375=\344o!\177\373\370\233\307\337"
+	.ascii	":\376\306\361\367\t\177\233\370;\375\033\004\177_\340\357\245"
+	.ascii	"\277M\370\233\203\2773\370\033\351o\364o\022\177\207\340o\016"
+	.ascii	"\374=\342o\022\376\036\341\357\f\374M\201\277C\374\355\301\337"
+	.ascii	"\035\374m\364w\207\277\017\360w\001\376\306\340\357\001\374\255"
+	.ascii	"\341\357\f\177W\360\267\205\277)\370;\350o\237\277w\376\266\177"
+	.ascii	"m\363W1\177m\372\353\006\177\025\301_\343\376j\345\377\210\277"
+	.ascii	"\276\375\225\315_K\360\237\356\377\332_\317\377r\3773\360\327"
+	.ascii	"\273\277b\370\353\320_\201\376\252\367\377\314_\325\3745\315"
+	.ascii	"_\315\376*\200\377x\177M\376\025\315_\221\374\325\314_\311\374"
+	.ascii	"\217\362\327\272\277j\371k\226\277b\371\353\225\277V\371+\225"
+	.ascii	"\277\302\375U\312_\335\376\332\366W\266\277*\377\372\344\257"
+	.ascii	"j\177u\362\327&\177M\373+\223\277\242\375\365\354\277\b\177\315"
+	.ascii	"\360\277\204\277V\370k\320\377\021\374\217\373\217aooo\357\307"
+	.ascii	"x\177\017\221\337((F\tt]Au\305@\242u]U@\242ue#T\020c\005\253"
+	.ascii	"\334eD\242\345\\\001\n\312(b\353\n\211v\314\025\220h\371*Gu\271"
+	.ascii	"\2529\331e\314P[\271B\206\312\307\214\266uu\001\022\252\353\n"
+	.ascii	"\211v\274\252\200D\353\272\312h]9(C\035\255P@e\253\n\031\255"
+	.ascii	"\353.\243m]\005!\321\266\256\220h]bU\b\n:\253\026id:\246*\030"
+	.ascii	"\022*\257\240\242q\264\n\232C&\267\262\230\234\253\332\211l\225"
+	.ascii	"\347r&@\3164\266\254\304\034cT\267\247\271\025OQ\216[5\231s\316"
+	.ascii	"@\365\344\265\225\241\346\2145\317!\211l\345L\344))S\345\234"
+	.ascii	"\363\006\306\344\\\346Q\347\2147hd\025'r\006@N\346L\225\263\261"
+	.ascii	"\346\271\234\2631\347\234cE#\231sV\020\362\213\212*g\254!\252"
+	.ascii	"L\303(\345D\316\255f\347v\205D\363\3322\222\322\004\355+K%\215"
+	.ascii	"\025\251b+\177e1]V\030\315h\226U\344\234k\032\374u\325\002M\337"
+	.ascii	"$\217[\215'.\372&\231\244\031\213\321W\257\347\b\203\215K\337"
+	.ascii	"\367L\345Y5;9\005\022\264\274<<\233\204\3111\357m\371\252\264"
+	.ascii	"K\213F\007\231\363\325\005G\214eoz\331\n\213\303\216\222\035"
+	.ascii	"v>\372\336\025`\314\307\215\276\347\211\202\317\243\266\301\232"
+	.ascii	"\001\322\001\223FKm\211%\3231R\204\261\350{"
+	.string	"\2360;\306\316\326\365\220i{\213\352k\305X\262\":\244\364=\217\016:\013\306z\261_\252\322\206\211\262\305\206\033\227\031nso\373\321\311\331\212\226[\030\333\345muN-G\235\031 \216\013\0221\275\234\263y5e\307\217\235{\236)|\036$>\317\t|\036(\374[9<\256\024*\270\264\334f!\343\226\247\244oRm'MM\212T\\\230\235\034]\034,\366\312\214c\233\220\276I(1\255\272'V\272\256\237\252\234\244P\305FN\031\225\f$\0258\023XXeo\267p\030~Z\244\211e\365\265)\030\335\276=\300\307\r$}\255\235\322\310S\212\0173]\244T3&\023,H\216n\355\206g\315\354+F\233e\263\303\301\026\025\345\226\355\267k\355U\355*\213*]B\372\232U\350\254eF\267Q\356\r5UaP,"
+	.ascii	"J\302\240\272\241\254^\222P\361R{\322Q\030\016\216\225)jlD-+"
+	.ascii	"zN\236\341\210\024\0339\232\264TN\236\227'X\322,\232\216\227"
+	.ascii	",m\336\320^\267(i\203S\327\367\267Ln\223gU\230\024d}\265l\262"
+	.ascii	"k\264\215:\247v\215\260Yn5\227Mv\227M\362cLf\343\003\364\262"
+	.ascii	"\302\226\3303kV\2256i\311n\225\3302\250\0316\3314\252\227\017"
+	.ascii	"m\262\210\210\206\210|\246\274\351\305\3007'Y/\234\327\213c\221"
+	.ascii	"\360\304X>\341\352\373\235<1;\304~\331\"V\210\005\263Al\230="
+	.ascii	"b\211X#Ui\307\272L\237\351\255\346\202:\263@\254\324\006%F#e"
+	.ascii	"zbdZ\215\225e\316\3111\233\355\017\213\366u\001\257\265\326\032"
+	.ascii	"k\034ui\321\2760\224'-\3135z\r\307k\303X{U.wv\254\223\364\030"
+	.ascii	"\213\366e\001\257+\313(\177\347\260cm\244\262\325.X9_m\220\004"
+	.ascii	"\314H\231^k\375\0378\260c}\243z\251sX\331xg\200$\\\214\224\351"
+	.ascii	"u\216\261\326\321E,\332\227\316\n&Y:\307X\037\251y\265\013V>"
+	.ascii	"\032=H\302e\244L\217\b\310\t\221\273\344\320\375\316\031\266"
+	.ascii	">\200n\3508~\351\373\2350l\264H\233\374\372\340i\305R\207\355"
+	.ascii	"awT\245\345q(\036\026\205\325\362\340\204\225\006\236\250\226"
+	.ascii	"<l\216g\321\360\204\314G.\017`l\204\304\321\273Mv\\\261\201\357"
+	.ascii	"u\326\340\327\263\027\031\352\334\016\t\204A\311\032[V%V\313"
+	.ascii	"NY\027\032\236\220\030\260\022%\306\341~tr\356R\373\222\201\244"
+	.ascii	"]`m\250sj\"\334\310\2269'\255\226\235q\270\037\250\240\f\025"
+	.ascii	"DlY\225X-\013#\303\311\203G\020,=\353eq\330\032\266\313nY.{\303"
+	.ascii	"\332\250J\253ei|\310l\222\246\347\206\202{\2350|\035\037\370"
+	.ascii	":^\370:3\360uX\340\353\244\300\327y\302\307lZ\030\317t\251\352"
+	.ascii	"{,\006\377\267V\366\252*-\013\253\"\205]q\243\314\227ea\253\354"
+	.ascii	"\212:\207\225\314,((S\347E\246g\331\306\340\245\235\367X\007"
+	.ascii	"\376\355\nK\305\023G\211V\034KeU\374\224\tQq\243\357q\025>F\342"
+	.ascii	"c#~N\033\374\333\247[\344\337qz\317J\205\300|\202\"N\252\257"
+	.ascii	"\215\262'n\245,T\266R\033l\345|\264R@or>\002\325\212A\255\030"
+	.ascii	"\\$^B\224\347}N\036\266G\243\333\247\250\035*X\364M@\025:\237"
+	.ascii	"c\006?\247\016w\262^87\270\3517mv\272\030\201\303\344\315M\233"
+	.ascii	"\23701[_l\336mn\246\245\246\346\314\344\254\341\013\252\320\331"
+	.ascii	"y=\226`Y\351\373\0341\374\252l\2744;h\340\310\265\241y\247\371"
+	.ascii	"?pP\275\364\344L\226s\326P\311\234\300\302\321\367y}\367_"
+	.string	"\347z\341\250\"v\267\344\261Z\343\245\266\3542}\006\231mt\261\260b\346\327\331\321\262F\306W\337\347\200\341\347\354\300\317\341\262\033\243$F\223\276\317y\021\246\305Te\327\265\331{\254\221|\250\256\225t\262\316\251\211(\213R\327g\375\245\316a\005e(3l\2269\347!\"\242\332\204J\0344\347\245\322]\304xi\272\006S\225\375\345\375\245\231t\224\037c\205\234s\350}}\351\265~\253sj \030!\263$\342Q\201C\313\210\357\\s\251\312\356\322[\260\264\234\206'$\bxmK\262.]\245\257hxB\202\360\026\267\304)\364x\343q\336\347\240\300\177\313\275\265\370\240h\033\022&\256\263\354\274\300\232{\353\373\023\016\216{]\001\026\025\327\367'\036~U\276L[\271\031\037Y`(\351\373\363\f\376)\006\377\364\362\326l-\245\316\251\211\220\263[\346\234Sh\270\252\354\267\236\362\326h\325\256\316a="
+	.ascii	"\313\230\345\217\220!I\224\234\367\247\025|\217@9\321\322n\335"
+	.ascii	"\226}|\314h\301\021\351\373\223\r\377t\202\1772\301\377[\331"
+	.ascii	"P\252\262\243\364\223W%M\366\241d\316Q\242tZ\253ixB\206P\303"
+	.ascii	"\3142\347d\224F\343\001\262L"
+	.string	"3DD\224sc\312\222\036\347\375\211\205\377Vsbe \327\336$\315*X^\200\364\375_\225\335\244\315\222y\210\307n*\233\351\373\363\n\377D\201\177f|s\r\2769\006\227\365\022']eb}or)3\257\340\232\353\205\363&\034\256\311z\341\034\252B\247\207*t\336d\3037\235`\"C@-\264\234 \373\336\f\303\327`G\373\260fVX\251\003\312\022\254\207Te\207\365\217\337d\016\3539J03\276\372\036C\026|\fpV\254\230q\036j\226\202\022\245\266\2643\304\330\334\305a\261Jp\224\265a1\257\364t)\263Ei7\344\351\312\215\276\307\340d\312\024\223\312\320\226\021\317\303\22537b5*j\254\252\257I\305\204\373\3111%M\314\2043\337rx\005\001\342\203\345\216\rT\n\375\343I\215\037x}\217\341\205\233[\247\031\332\262aX\254!\202o\220\331\365\350\373\n\262D\211b\262Y"
+	.ascii	";K\023\307g\013\213\266+s\355&\233O^\332\\Y\005G\23481\225\\"
+	.ascii	"\366\246\350\375\304\251\213\313On*\333v\322\336\340 \323\327"
+	.ascii	"T\253`\307\331\231\2316\264e\353X\240\201A\305\366\346\211\211"
+	.ascii	"v3\255\016!\243u\246\257\311\344loPhq\263\363RC\246M\r\222#1"
+	.ascii	"\223C8+I#[\352\240\001f\205\271\344f\022H,\016\224\027}\315$"
+	.ascii	"fY\013.\275\2662S\t\030\220\0251\314\362\222\230y2\311.Y\227"
+	.ascii	"YqFL\221\"\246\230\206*`{S\3165T<\302\230Gn\212\265\001\255\321"
+	.ascii	"\225\375\350k\032\341A\"\211\363\346m\265\b\333\230\022\013\030"
+	.ascii	"\2309$\002h\306\340\361\250\231J\203\f\2739\344\322-\001#\346"
+	.ascii	"\314\177\235S\256\352M\033!@\200\230B\352Y\256b@\027;9\261\234"
+	.ascii	"\2616tV\032\271\036An\n\371N\234\023wP\312\374\327\361`\347#"
+	.ascii	"H\337_\260\302>L\037\367K=\313U\265-,\314R/g\254\r7I\030\252"
+	.ascii	"\266\276\267\340\005\377&\017\223\207=\003B>^m\250r\004\003C"
+	.ascii	"/[Y\341`\335`\311\361\326\367\026\206\340\337\324a\352h\253\r"
+	.ascii	"A9\343\320r\313VX\034~\216h\211e\365\275\205\25467\221\035\247"
+	.ascii	"\367\252\362\2661q\030=\345c\331\206$W48\370\344\330Z\272\351"
+	.ascii	"{#'\205\f(j}o\201\n\277\222\2410S\214QaN\221\331\2550\255\352"
+	.ascii	"\334\016\t\030\331\322kL\026f\026\333\231\245Y\243\321\314\251"
+	.ascii	"\272\257-\323\313\3542m\230Z&WU\2325\314+\263\206IU\363\352"
+	.ascii	"\334\016\t\220\211Y\346\234$\342\001\223'd\356\347\242x\031\r"
+	.ascii	"OH\020\312\312\230Y"
+	.string	"f\013S\006\317Z\227%h\314\031&\215\2524\263>\224\301\307M\235^\331y\177S\206\211\34565C\252\257\031\003-.\305\215\276\027*\203\177\363EU\2320\302\340\004\351k\272x\031\024\306\251\024\207{!%\211\226\276\027\262\303\027\362\202/T\305\254\302_\226Zr}/$\005_h\r_H\r_\210\t\376\315\024\346\224\211\206\005O\316\234\252vtZT<\365\275\320\022lB\231'L\251_\007\b\211[\016(}/t\004\337\214\372\257\223\201\036[\240\364\275\365p\247y\274\371\364\353t\234\220/\252\276\027\n\3037\263i\374u~\304\004yb\326\367B=\360\357\336\177\035\023\312\036\236\214\2767\016>!D#\001;Zl6f\\7\277q\376\373\346\302\261R(\354\301Y\323\367b\352\205\323\247\n\235\335\302\350\327\r\217\034\225\345\222\276\247`\017\353\351e\033feoz\335\225\327\250A\243F\315\375\362"
+	.string	"01_;\332\272^\364=\005t\370\314\231\213\247\346\234\001Vel\271"
+	.ascii	"\223\346\027\257g\f\035\233\0324:I\274\264\240\271\233\242,\263"
+	.ascii	"\223{+\313e\313\332\226\303b\256\212T\337S\300\206\313\224\271"
+	.ascii	"E@\270\220\302\035\017\034+\320\364=\005Ep]\335\035\203sM\201"
+	.ascii	"\253\354M\254\325\024\t\353b\367;\306j\3511\004\255\346-\031"
+	.ascii	"\202\225C+L\230\275/$_r1\372\236\002\343\365r\275\334/A\371\211"
+	.ascii	"n\314\327\031+.\254\364\375bv!\022D\331\367\025\302\334.\267"
+	.ascii	"\313\235\302\306$`\267I\331\022\257\276\257\340f\345n\261r\347"
+	.ascii	"\346\256\\\271r5[\345\2351\256*\230*:\344\325\362+\227\003e\305"
+	.ascii	"\233\262,\377u|\336l\301\030\223\345\306qE\025\341b\305\3442"
+	.ascii	"6c}/\226"
+	.string	"\ng\370\025\200P\251\312K\245m\234V\025`\202dY\341\005\376\357[U\336\267\303\201\220\217W\036\216\200\005\261\2312\305\302\335\204\3127\304\276r\306\342\340\003\206$\355\251\357\203\322\270\271U\273z\226\253v\244X\344@\003\347\f\030\036}\037\324\346\344Fqr\331\326~\331\256\332U\273P\2601\003\0340\236\254\247.1\345/\224\234\250\034n\\\364\275O,\233\377:\330H^\033\267\2404\374 \"Uy\323\332\252vel\206\356\3122[aqP\202\252\313}\037$\003\377\027IU^$\227\211\351a\354\3562\371=\313\3012\027fG_\263\r\204)\213\321\367AT\370u\211\022(_e7\311\333~\240\222\371\307Y\307\2657\345&\357\222\252\274e\227\214\210hHg\214K\354\304y\017t\006\037\210\016\037H\013>\220\233\230\330\030\027 \264!\327\310\220[\204\b\221[\344\302\030\227\317\024\251\2546}\213"
+	.string	"\221\341\003\001\301\377\005S^0\313V\317\262q\204'SX\364r\306\342P\253\240\001\223\353{ -\254\343\006\321q\205\2349\327\344V\225\325\363~\205\200\r\361R\321\367\356\270;.\020l\264"
+	.ascii	"g\334\251!%\306\231\373\343\027\210\216\024\024\026,}/\217\353"
+	.ascii	"\343\t\2309\344\365q{\344\314\230\261\026\305\"\311\251\"\266"
+	.ascii	"w\326\367yv\315\177\035\213g\243I\225\276\007j\201\017t\304\201"
+	.ascii	"\343\352\001v>\324\266xyU/\365,W5\300X\366&f#\212\310\231\276"
+	.ascii	"\377\031\303\377\345R^\256\352eh\313x\347a\214\013\177\031\353"
+	.ascii	"a\325\367?4j\274\2706ZF\315'\254.P\205b\371\223\205\377\003c"
+	.ascii	"\306}qi\264\024\316nxJU\212\345\317\t|\037<\374:V/\326}qeT\266"
+	.ascii	"\233w\334qe\016\367\001\203\357C\005\377\027\006\214\232\267"
+	.ascii	"a\353x4\300\221\273\2627\275\234\255p\270rUP\264\372\336\307"
+	.ascii	"\f\273p\261\345\316'\013\377\227\205\362\262\260h\026\231\217"
+	.ascii	"^\017\0303\363A\342\377V\335\024\327\252eH\340\t\2313\013\243"
+	.ascii	"+F+\016\3679\201\357s\304\277)\352\245R^\252\232\267!\037\217"
+	.ascii	"\0068\"%\311\341=y\370\265\346\2357\352Qw\252\346\2343V6\336"
+	.ascii	"qP\205\213\325\206\377\242\370\235\002\222Rc\305\206\254\307"
+	.ascii	"\264\025K\244\024\006\234\\I\323'zT\214\351\322\346\236\250o"
+	.ascii	"2\330\"-\262\234\350\373\036*\370\366\215\205s\033\347q\356\023"
+	.ascii	"\3169\033\223\271jH\212Y\331\233^\306\302\332p\026y\002f\353"
+	.ascii	"\036\177\237`\360\310\273\306\377:=k\342\264Z\\\343\315)"
+	.string	"\216\220\211\321U>y*\302T\354U5\330\f\f\033}\337#\206\377\372\376\317|\264\3129\2630\223\331\352\251\347\374\353\253Y\353\206\337\247\332J\200\3777g\017\206\311\374\324\204,\347\\\361\360\220\266\343\214\013\362\377\337\234\313\031\252+B\351o\250T\302L\213DT\t\350\244\364\023\006?\020j\240\030<\300P\261I\251\351h(B\005\3420\005\242\034H\203\302\020,<\251\bI\030$\246\305\n\224\224\232\204\302\2410'\365\241(\004\213'\t\206\304\244t(\314)\361C\225n\212\026\227\320\245\263\3304\201!\321\t\311\347IEC\242\023\222\bC\242\023R\005O*BM\370\225 \002\201\232\360+\341\363\244\242\016\032PbS\372CK\3448)11\201\370yRQ*D\227\216\210\277!\t\003\364\244Aa\b\302\340\257\002>>t)\230\n\233\210\035\200%\006\220\242%\024w\236T\324a\030<\237T\004\354"
+	.string	",\201\301\251D0\035f\340H\b\0025\361+\n=\251\b\003#B(\241C\212\"\021\177\351\005&"
+	.string	"\207J!P\3420\004\220\023\3230\304P\372\244\"$\246\016HLB@a\023\217\260D\233E\037\022SO\352\023\"1\231B$&\213\242\020,^'\246!\360\022S&{\204\346\034\241\305\246[\3149\321\207\304T\344\343DL\213A$\224\004\rNI\251\322\017\005\241\247\210\026-\240)\252\304\2644,\206"
+	.string	"\004\376\206\212\250\022\320)\004Z\002\020\370\303\360A"
+	.string	"H"
+	.string	"\002\177\031HH\321\"J\254\300\007\351GDM\200H\321\n"
+	.string	"\201?\013E\f\251\260i\030\342\bM\177JMKM@\340/"
+	.string	"\346\223\212\220\232H\240G\035\216\224\202M$\320\243\241\bHM$\320#\0354-:\225\340\003@\372\244\242\022\0010\241\026}F)\023\017\232\376\322\242i\224\216@DS\245\340\007@\340\257\007\005\020\322\246\020%\2300"
+	.string	"\004\376xr~?\305#\364\bH\307CQJ\3741\025\245@4\rZ\032\022G\240"
+	.string	"\005\206)j\342W\002\001P\341PD*D\227PbS\361\207\212p"
+	.string	"\324D0\005\202\020\016C"
+	.string	"\201 4\220\250\036\212HX \243\242\245 q\004\252\204$\374U\360\371Pt\204\232\370\025}@\026\204! \240\302\257jP\364\263 \220\204\300\036\022A\245_\b\020K\304a\t\"\312$"
+	.string	"\237\360\203\024-\242$ 1Yp`\220\210\nQ$\374\r:\310\240\003\017N\310\271\007\016\360\340"
+	.string	"\017\347=p\200\221\221\003:0\302\357\300\310\246\276\342\006\320\245`\212-\034\230\002\201?\233\372>h\200\372\320\243\241\bD\224\tEI\364\b\207A!\021M\177M#\330yRQ1)\375-u\020\016\227\226\206@"
+	.ascii	"\240PIPO\250N\265\350\003\002\177f\372\244\242\003\240G\303\020"
+	.ascii	"&PbO\n\344\313yRQ\nl\"\246\305\017E\337\th\332\264T\301\004\340"
+	.ascii	"P\311\347;Sa\323\020\350\363\345\020"
+	.string	"Q!\t\206>_N\221\210\026\233\204>\037>\022\006M\360\371\316\2420\310T\364\371r\204\303`1\250\204\372|:\251/-\006\225\202\236TTD\231\234\322\f\216P\342/\251\230A\207b\032$\321\241I\210\224\301\tM\302\240R\006\033t\340\353\300\203\023:\240GMJ@a\260\003\261\330\324\241\001\351\t\250P\351'$\242\2510\350;\372\241\304\244\224\311\347\303`\002%2\371|gZ\f*\371|\347/\375\035\371|'\361\227\004\274(\n\301\242\317w\232"
+	.ascii	"\034*\3354(\f"
+	.string	"A\370A\032\024\006Ob:\002P\330\364\301\321\017%\001\b\004a\341\b5\001\370c:\213>\023\250\b \360\207\205\037\034\375P\342\231\026}A\246\022J\240\"P&\247\021\276\020F(\201\007\005\n\177iQ\030\304\251O\003!\\ap\004a\021x\006\231\212\266\350\013\361!\004\236\020\037B\3209\201\037\202\366IE\305&\022\031\212>\021\216\202\210hZ\374-\235\305\"J<:\372\345\240&~J%41-\341&\237\t\364\250\330D\002\027}(0h\002\025Ql\"\301\203\372P&\247\021\305&\022:(\223SZl\"\221Sl\"a+`\344\003\002\177'\t~$\204\020\001\342L\237T\324\304\264\344\033\022\235\220P\023A\342\221\002P\037\t\0368\360\320A\023\323\222\220p\030L\233\224\206E\224\270S\364Y@}%41-\361\234\251RS\021%A8\f\246@4EE41-Q D\n*\201"
+	.ascii	"\002\177\330\351\350\207\222\360K\177"
+	.string	"G:&\320#\033B\004\b \360w\242@\241\006\322\342\017\305@\n\342\bM\177GL\033PB\201@\020\305`\206\324\367A\203T\030\314IK\240G\276\024\303\223\bPl\362%\001\323\340\bGB\020JJC\242\020\005E\037R\260\204p\030\202\210\246\350\322\260\t\243\220\344+\301\244\344\003\002\177;\250\357G\210\024T\372\371\200\300\237N\352\363 \025\006\233rP\342\217\004G\304\237\322p8\001\237I,\226\360%!\005\223|@\340\257'-\201\036exR\221\005\0372\241\304\016\351pH\354\300C\202\237\223-\006@IiH\274I\3004\310d\026\321&\245\237\211\263\311W\\\n\022G\024\201\301\245\237\320ID\232\204\024T*q!\365u`\224\n\203972\nq\301\0062P\001\f,\022\016\203\351\217\210*\241@\340\257C\2218,\n\321b\007a\360\267\324\001H,v(\302\200\004?\242\035\022Q\017"
+	.ascii	"\201\277\234\377g\027\233\230-\034*\270\246\266\224@Q\270\252"
+	.ascii	"l\230i>o\336\332\340\3258\265\234\304\226ff\212\2632\271\276"
+	.ascii	"XX\347\214j\205\246\303\223\217\2540\275\214\345b\3039\343\314"
+	.ascii	"z;J\261;\263N\031\327\005\225\024\300\306\324\324\271\365}\006"
+	.ascii	".\374\2371\206\\42l\340\300\310\333\351\322\241\005\311\0133"
+	.ascii	"y\273\244q\363\305\305eR\227H\321\265\265\020\213\363C\212\352"
+	.ascii	"dq\317\204\274a\241\351\333vZ\231}\345\234\203z\354\360\326\324"
+	.ascii	"\372>\303\f\374\237UwWp\274hY1wR]\266#f\322\216\2500\205\354"
+	.ascii	"492F-\305\375\362D\306\016\257\276'\362D\361s\352\347T\237Sv"
+	.ascii	"o\357T\342\305\311y\317\023\347\211[\004\004c\225\253\2627\261"
+	.ascii	"<|B\235P\267\210\216\021\234Y\033\376\317\247\232\027#\312\r"
+	.ascii	"\224\276\257\312\363X\3444^ lmP\270\351\233$\253\252\362\261"
+	.ascii	"\3257I\226s\362\3474\362CJJ\034*bK\024H\340\230qwN/J\353\215"
+	.ascii	"E\323\003\005\225\3642\313\314-\331\343\321F\310\004\320\250"
+	.ascii	"\300"
+	.string	"\321\327\3243\365.^\315V\033,1\016\031\301\277\271\346>\261\331\323r\3237\315\237\306\314\033\302YI\230\251e\357xj\201w3\257\rS%U\250\3358s\306\274\253g\271j\350\316\f\211I'\303H\304\\\336\274\273j\242\250~\fUi\271\311E\213Y\306\202\351\311\306\263\\\225\323\206eo\251\227\221X\033x\314R\230q\021s\263\314M2\0378x\031,f\004\314\261\2579\346?XZ\246,\373\336\2543\355~\235\235!8\320\216\364=\206%~\006g0\256\256\372\232a\336D\312\250\270\353k\2029\034V\030=\035\346\0279/\272\247\276f\027\223\256*\037gzy\022\350g\212\324\223\270\276\307P\207_\037w\236\240>\3564\267\334\234\373ut\246\324\300\321\325\367\030\270\340\337\224\373u\002\204\217\250\343a\223rD4L1 \3121\245\2203#5J\213\001\203\025@ HP\"\027\312\353(\037\023"
+	.string	"\204K\315dI\036H\031Tf\210DF\222\202\202B\2061\212\264\204[\322W-]\232B6Qs9\252l\3530\362\2549\264?\277\262\233Z\2135\231\021\341\203\251#\375Y\016\250]q@W\266\225\354\371\261_j8\334@\020\303\2274\231\247YG\b\r\340\240\b\232\206\240\261 cW\337[\342R\022F\302y5Qp\032_d\223\314\271;\3024{\023 X\017\330<\037\357\321*qc\362\302B/\231\213U\320\327\373\f"
+	.string	"\232\002\245\225\005\260\034\366\"\327<3\b\273\312\"L\035\356\377g\313\202#\n\262\231#(~8QG"
+	.string	"fr\336\277\210\363 \202\310l\246\220\210Z\351\036\225\255\301\003\355\351\326\036\246\0344\200\213\260\"gN\212\177L\262u\240\247Xn\274\202\242ew\tz\211\270\004\310\242k(6\257R 4\243\361Z\342\272\264\207\304\372!i\276\225c\216J\231\323b?\037\211\222\201zM\312\234md\230\273\305\271\340\2112\261o\242\025\370$\231("
+	.ascii	"E\320M\256\f\317MQuIS\340[\315\335\304\032\205>\002x\304\352"
+	.ascii	"\340@dV\201@\223\372\346\222-\bi\321)L\201\013\276\006\245\247"
+	.ascii	"\375\255\302GT\026\n\324\244\023\311\336\223v\f\301C\265\351"
+	.ascii	"\275Bc\307\204\213-\340\323\253\272sRd5\220\251z\301\347G\313"
+	.ascii	"]J\350h$\332\317\024w1\367(\360\242\370P\2477=\3228\035z\001"
+	.ascii	"\002a\b_\270\214Z\373Q\242y\314H\336K\242\330\226\2131\320\316"
+	.ascii	"\375\315v\214\003\200)\212\177\241j\211\234\362o\254\307\027"
+	.ascii	"\317\314\352\340\231$yLT\307\360Y\020\2544UC\341v\343\3514\032"
+	.ascii	"\352,\355\311\205\351\231\311\312Qw\271\325\200&\256?k$\366\205"
+	.ascii	"\206"
+	.string	"h\177\373^\0050\2255\340u_\236\277\304x\205Q\203\013`\250;\236@\365\314\007\t>M\032\0222\302A?\rI\351\236\267X\305\006_]'\035\223=8g\326hK\351:47'\031f\233\326\205u\231+/a\253T\227\367\253\315\264\215\226\273 ;W,\203\362\255\203\346#\375\314\254\317\365\340\360\370\033-\300G\255 \025\003\210\201\372\330\256\b\177p\317\321^eI\331\352\223\234\035\253\221m\037\374'fD\035e\020\261\245\2315\032A\347!\217\232\3418\004\277\367\373\223\245\317\361\3547\211\r\020L2f\257\250\225\0233)\305j\314\363\013^\317\225\246(d\225\267\303\0059\231\371P0\312k\266Q\034>6,o?\023]\244Yg\035\210\2517\240\021\024\343\325\357b\252\364\3331\021\027x\303\327,\t]id\031/\370\354\214\f\366\333#\262\206\302\236\f\220\376\201&\354\306\2346N\211#\335g"
+	.ascii	"\331\021\003Pn\316\350\325\0313RU\212\302\270\205\342\252\265"
+	.ascii	"S\373\025\007`t\342\221cR\335\272~\254]R<\255Np"
+	.string	"(\360[6-\254\252\217p;2\333_\344\331\240\033\363\276\205i\035f\362Rj\020JD\213\215\321\006Z\346#w\037\036\005\350lQ\177\232\025\344\223\373e&\261\206\367\377V\312\350/\215\375&\320=\027P\275\301b\252(\264\307*\301m\233t."
+	.string	"~w\016\365\304v\326CG/\2021\370\364\273\254}\212\315\242D\322\3020\032\236;\342\213X(Y_\205\216\007Y.\314\\\226/`|x\354\363\202\247$\201\237li\357\201\177c\357 \301\313\353I\262\363\035\330'qR\260 \244\225v\375\n\251\243l\001\321\f\374M("
+	.string	"\003\224;\003\2345f\350\354\361Xq\343D\305\035\223\2012\205\b\223\tI\033\376dN\371\211\233\302\315\361\237\343\313\"\366\210\024\262\257L\375k\256<\350\330\253\212\271\206\200\013q\237\375\330\025N\247\217\306&\035\210\240\213\371\235\375\255N\322\016P\2411\232\307}\007\322\372\f%'t\225#\",r"
+	.string	"Q%b`\r\343\264t\376\013\214\340\377\202t3\223;\007\202y\320s\242\327\365\034\272\256`$\f\225\265'd\306Y\256\250"
+	.string	"L\353\226?vA7\226\021\n,\240\254M#\f\230\344\274\264n\350\335\243\211D\275Q\330v\213\314\254\373\362\251)\332u}\177\244\354kOLuA\2460\320j\007\324\202\017$\256<\233y\b\345\365\325\367aRo)\0046<\200\200\377\331\376\276\310eH\321"
+	.string	"\347\305\303j\377\324\032\315W%X\262\"\n\016\262"
+	.ascii	"=\202&\334\211M.\374{\262r\234\016IK^\225\315A=hE\002\221\312"
+	.ascii	"\256\233\"@\223\376nD\377\274za(\314z\f1\216"
+	.string	"\217\342[\336\252us\224\254u5W\2205\225f;\274\035\020/\317{Y\267\266\320\322\376zl\347[\277\344#\nk\223\213O\353\b\330\275W\300\204\2348%-5\032v\t\202\347\316\ft\342\022\227+\0219J\361&,\211\2450U\270\2501\231u\261M\366'\245\202\303\016Hjb\375\333a,\370i\375\237\031\377 m\027\031k\325\n\246Z\372\350\354\247\210\275\253:\233-\370V?\257\364\035\212\332\313m\007\344h^\336\370\252-\026T\327\265C\215\022TO\371\324#\3525\333\004.\207\216\313^.\332\021{\214\346Ob\366\300\326\337y\024x\372\251#W\322\017\231\202)\353\335\352\212\377\366\220\323px\027\363m\00456Yb\215\235\252\255\201\251\263\021\362\f\035\250\336o\233\341\321-\310\214}[\027\251\231\227\311\\\225\225\312\320\247\313\313\277|1p\325\255\377\265\267\310~t|\366\270\340\037\244\370\221"
+	.ascii	"!\232\302\262y.;:\213%\224\025\006\265R1\212\334\373\235\252"
+	.ascii	"`L\372}\021\227rZS\224~\205\355\206\210\336\332\004'\365\002"
+	.ascii	"q,\263\335\344#\2633\321\240\327po5I\221\n\b~\226\304/\370\301"
+	.ascii	"a\237\213\035\342'\363e\2254\271\317h\347\222\261\325\n?\360"
+	.ascii	"\321Y\226\322\356\234\203\326\274\020\017b/\363\300#\307\315"
+	.ascii	"\336\376\333\335\243\343\335t)V\217\336k \f\323v\371\265'\246"
+	.ascii	"I+q\344\272z9\215V\270\314\300T\354\"\002\031\177\310\331\245"
+	.ascii	"L]\313u\244Q\001\377v:j\375V\t._\222\240.\240\233w\350@\300\013"
+	.ascii	"m\212\261e\323h5d7"
+	.string	"%@,KK\354\300\357\020\375(\361\305<\\\305\341\356\235\273\375g\237\305\257\311\325\003%\301\202\025}\036\307\304<Ly\205\267\360\224\205w#Sg\001\354\002m\210\373\227&\355n=\237\334\361o_\321b\025\030\r\312k\377T\331\247\360]\222\233\305`\335\260\2518o\267\013\213E\233\356j4\331\b`?\207\312\226\337 \200D\027w\206\016\354liHd\\\362[A:t\365&\004\246\324*c\227\325\252I\003LJw\212\312qf\317\300\225\337\300\316\222\376\001{3\t\216\f\030\233\207\321\025N\340\351\212\274\320w\001\f1\261\246{\275\225\313\020\310\210\221\n\2640\177\013\321|\3429\203M\225\230\367\002\021\235a`l\337\"\033\f\350,q\023%\250\336X%u\374\247\311\347<\372\f\271\307\340\\\025\357\327j~h\"\311\376\250\346k\321\213\231\377\236\273\271N\276]\226\265\234\306\3463\315\230^\357o"
+	.ascii	"\221\215RS\204\253wg\370\357x\237\351N\274\227\3663\276\341 "
+	.ascii	"U\b\t\270\337\030\267f\242\206\200\362\372*\325\360\265\303\031"
+	.ascii	"O\211\025\2225\220eF\243\317|\257\376a\220\233\346\336\205\220"
+	.ascii	"\2739\0174O\243>\r\032\n:\337\232'0\003\312ljc\007\321\264\367"
+	.ascii	"x\360\256\002\254\376\242\022\2129\327\226\006\361'{\255\351"
+	.ascii	"\321\f\276\030\277\034~\254lP$\2467\t\232\314n\316,H\207Uo\277"
+	.ascii	"\320\3026\210+g,-\2741\240[P\034\237m\320\362\206j\253X\310\302"
+	.ascii	"/\366W\256wr\311]\267\230[\216\337\233\035\275\253w\307V\321"
+	.ascii	"y\374\347\332\302\231\260$\317\313\257\"1Mq\007H\316\253\374"
+	.ascii	"@\307\344X\351\262\231\257\275\326\256\337\213\037G\343\202G"
+	.ascii	"\2549W/\021\246\177\016\3277\356v\362pN;\376b\354\355g\027\254"
+	.ascii	"\371\005t\337U\346W\\\345G\260\366C\035J\215\366\334\335\302"
+	.ascii	"\ng\312\256\311\375V:\324]\267\255\224\363[,\027\361:,\306\247"
+	.ascii	"\245L0\364\223D\375\360\276H\302\031\374\371%\323\233\260\366"
+	.ascii	"\222\330F\331\007\216Ke\357\271}_\204\370\307a\303y\217\332\276"
+	.ascii	"\022\034\312\205\357\227b\272\3433\351\r\002l.~\001\370\371w"
+	.ascii	"t\034P\224\017\375\357\027gD\337\24491\230\f\304\312\335\213"
+	.ascii	"\301\337\205|\304\375K\276[\351|\354?\031\367Q[\263_f\243\377"
+	.ascii	"`\254\355\003`*\335\177\373n3;\217\222~\275\351\272\303\220W"
+	.ascii	"\0260\300\2677\177\320\220\037\276\241\032c\016\032<'\350\022"
+	.ascii	"\302\233\340/\001\273,x\316\377'\030\274\2729\005\2059\327p\264"
+	.ascii	"\225a~\260\342\300\264\023\202\314\225\250\023w\357-\370.`l\327"
+	.ascii	"\332x\342\207\306s\025~\203\317&\226\206\204\267\377\030\347"
+	.ascii	"\261\324\3177\f]\001"
+	.text
+	.section	.gnu.lto_.symtab.1dd4d87d6d53e527,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"accResetFlightDynamicsTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"accGetAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"accIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"quaternionInitVector"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"quaternionModulus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1dd4d87d6d53e527,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,177 @@
+	.file	"adcinternal.c"
+	.section	.gnu.lto_.profile.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \033\275"
+	.string	""
+	.string	"\210\017"
+	.string	"\002"
+	.string	"\356\346\366\357\t"
+	.string	"\001\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.690e715ab5840682,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getVrefMv.4.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \3325\006"
+	.string	"BK+2pM\322\001\240\213"
+	.string	"\224[*\331\236P\206l\027l\013`w\030\330\327\315\036Go\247\354\206\031H\022\374\377_\225\303>,\022+\"\365d\023\262wJ\001\246$\205\311\301\312\342*T\302\244\021\276\350\252\250\2562-(\005\243J\006~\f\025T\313{P\243\271g\233\201\222\313V\340\300\036\354\211Y\254\302\276\263lc/(\204\204\300d7\"\005eG\036\020\f\333\027;\3625\276q\261\\\363B\242u\210@x\234\354N\005\270@\373\263\036\320\3760\213\313/\351\237\343N\006\305GF\203\371\202\020v\327+\243\231\270\331m\037\330V\333\r\001\b"
+	.ascii	"2\003\356\231\301\300\341\273\206O#Z\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\003\001\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.690e715ab5840682,"e",@progbits
+	.string	"(\265/\375`~\002\215\026"
+	.string	"F\255\237G\260\3328\035\314\034\364\266\rv\305|\355(ZC7\307X@\215\221U^(\t0\3427)6s\314\334O\226\177\310h\207\215\242\250\037\327\225\222\372h\373\036\364_QOcK\344\256\227\013\n\215A'\243\225@\237H\031\203"
+	.string	"\201"
+	.string	"\214"
+	.ascii	"\013~\232\212\376\2242\032J\354\366\"\306\244T\373\376?0\213"
+	.ascii	"\345Po\336N \352\017$&\342\217@\336\333{\364\215\324A{\216\354"
+	.ascii	"G\360\373\317~\262\177\373O\376\227Ai\367\2571:k\263\331?\303"
+	.ascii	"\300\35442\212\354\347lZ\240\244'\233C\005"
+	.string	"\243\370\260\265\267\270d\2379\352k\377Y\321\217%y\236\363\277\275|\2654F\027\256c{\306\314N\230\331\207\231\25303\327\266m\313\314\f\230y\t3\307\"hL\200\307\334\334\241\356\023\363\200\006\365\002f\356\016\022\335\223:_\276\037OJ\033\\\307\314\24533\367\211\277L\177\217\222H.\3305\375{d\234\325q\322\331\3657\325s\345\357\323\321\3155\375n\311\345\274*J\372-\321\233*\331_\321\323V\222\244\223]I\322y\327\364\346\311>\315\236\237\246\232\222t\356\212\236l\231\216NvMkH\256XQp\232\1771\243\225\350\350v^\365?\177\333dG\003M\270\223\264\022\2361\357\331\231,^n\330\270\216{\375\270O\236\250m\333\266O^\251\013x]\303\370\270\205\364\020n\";M\244}\272\3461,8&\220_Z\320\b\363\031\264SH\265\221\263\005\f\267\017\363\003\t}D\300?\344\177\002"
+	.string	">xd8\270\256o\363\364\216\251{\270\2154\313\241\362^\021\347cL\022#\\7\352\002\036\327\004<\366\360q\233<P\333\266\311c.\302#z~\t\f~l\372\230\231\333{\211\376\207\021\272\017,\202\346\302\006\013\032Pc\210#\256\306\361\303\003\b$X\257\0227\241\370\2721\021\216\260\025\032D\254\200_'B\0215\276^\"*\300\370!\005\216\256\026\212\217A\360\246\304!\003\205\217ESb\345\022\303\321\325b\201X\241`\342\013\346\na(Wke\002\305\022a(\232R\n\f!B\261\303\030\342\3140\253%\206\256\020\347\343\b)\007)\033\0252l\243\252Q\325xl\243\002AU\n\3748\005\202l\334;mk'\025\336\355\320q\021D\347\350\224\006 1TxH\341\272^\322Lz\347\324\001\036"
+	.string	"\257\314\367\301\244\022\355\276B\240Y\003kU*\232\201E\236#\246v\034\236\316Z\243n\027iC`\314\212\256\007&\345\212/*\016\027\241'4D\024>\341"
+	.ascii	"ICc\204\033*\312\310\016\265\275\024,7eq\355i\343ff3\247\263"
+	.ascii	"\240\214\001"
+	.text
+	.section	.gnu.lto_.symtab.690e715ab5840682,"e",@progbits
+	.string	"getVrefMv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.690e715ab5840682,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
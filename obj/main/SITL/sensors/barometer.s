@@ -0,0 +1,806 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	"\027"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\255\b"
+	.string	"\224\013\310\001"
+	.string	"\037"
+	.string	"\321\372\207\244\007\024\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\224\336\224\362\016\002\002"
+	.string	"\002\007\013\200\336\366\230\t\030\002\b\002\t\n\002\t\003\013\002\013\002"
+	.string	"\002\f\r\002\r\002\002\002\t\f\r\016\017\020\021\022\245\256\360\274\t\002\023\200\333\377\224\002\024\025\265\372\210\203\b\026\350\300\306\254\005\002\027\317\316\276\351\002\n\030\346\263\306\373\b\022\002\002\f\031\032\214\211\225\265\003\026\002\003\002\003\033\364\201\355\242\016\034\035\371\326\366\371\017\036\037\240\342\234\212\n"
+	.ascii	"* \200\202bsv\322\210\021\270(s\271\005\255\004h\261\322\367"
+	.ascii	">\303\264Y\345\301d\017T\n\243\231\201\"\002(\316\270\327\f\241"
+	.ascii	"U\234\\\272\3423\273v\213\260\237d\355.\204-\277H\333%\262\240"
+	.ascii	"\342\354\t\334&YN\352\230f\013\206\263\rd\375I+\217\026\250\204"
+	.ascii	"aT\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375 |E\002"
+	.string	"\022\304\n\022\240\2510\034\377\377\377\237\342\277\271\357\372I\"\366\226)\257\342\211\0261\017}\206Y\220;\016\n\241\201"
+	.string	"\227\232\036CNUp\021\n"
+	.ascii	"UE{B\bH%\314\231\020\312\216\240\262\377YZ\345\360\213\035\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.inline.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`~\001\225\n"
+	.string	"\306\320::0\305(\351"
+	.string	"\363\327R7\207\005\311\035B\262k`\352\224F\357CD:\324\300,Zwc\001\343\306\276\370\324aX\006\00350\200\210w\200:2\332\003\377\300w\324\032\221;\005*"
+	.string	"("
+	.string	"("
+	.string	"/\204\245\032\020Z{\363J\315\314\274\374\251#\260V\213\210k\312\265\302"
+	.string	"\215\327\364>o\252Gff\372xz\231\231\234\337\\\211 \261\256\177\316&2\223\342\263\337S\334@O!\376\013\222.\236F\374\306S9N:J0\013\274u\017\241\177\2478\216\\Xz\241\277\217\332\004o\035\246),U\200\314\003\017\322\376do\335\373;\332\250\217\017\325\310L\2055\217\232~\326\360X\002s/fRa\261\200*\200\225\017\221\204\017\376\255\343d(\256\325\005C\377q\257\245\222\361\"=zM_\002`$\035TS\231Y\260\201\310\241\355\007* `\002!\001*>R\003\034\r\242BY$ )a\215\002\030\311\007\030b\2617\302\271k\255s o\250\210M0\304\006\372\301\301\nB\312G1l"
+	.ascii	"\013\200\001\372\2720\n\216\346\240\241\356\355\003\366\341\030"
+	.ascii	"8\030\261Ekd\261\216\370\300*\276\017\315\301[\227\2055V\201"
+	.ascii	"\231\353`\307u\023\330\032\332u\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"E\006"
+	.string	"R\312!(\200U\351`V\241\311\230#)\214\006a\022G\353fM\024\214P\rd\034\200H)@,\211\300\217\210\331~7\222;\245\024\255>\366"
+	.string	"h2X\373x/"
+	.string	"\203a\027\306\261o\251vj\025U\242\225\234x\350^\274\002\373\b+\2517\313\364\206V\272cs|\227rHDRG{\023z\357=\327\022\212\350\211\373\241A\323}\342\243[z\032\236\r\333-\220\276\234}\271\273\225cVc\346\036\336\036\331\317f\267Po\002\031"
+	.ascii	"F\271\030*\n\\<\bF\205=\"\320\362\230\230\2525\312\230\003\353"
+	.ascii	"\240\255\234i@\271Z\025DP\342\337\204gf$\030\005\036\333\273"
+	.ascii	"\324\352Oc;m\013X\0203EE\345\312\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\005\230\004\t\230\004\013\230\004\022\230"
+	.ascii	"\004\023\204\004\025\230\004\026\204\004\027\230\004\030\230"
+	.ascii	"\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\205\006"
+	.string	"\362H\032#\220\265\031\016\377\377\277\326u\355\377\377\377\377\377\277\272\235\321o\335Fm\341\377\253a\372\372\326O\215$\231\002z\262\234\312B\267\322+\226@\254\327\250\373\303\364\234$g\327<\233\231\335\3329v\215\021\245\223\002!\212\026\200e"
+	.ascii	"Q\3241O\306\210\016zB\273\347\371\274RTUM1\006\254\253\201\316"
+	.ascii	"\351:O\301c\032\234@. `\002)\350\352%\201\300r)\210 \207r\335"
+	.ascii	"\334\200\373\202+r\344V@\251\034\276\320M\207I\323\025\210p\341"
+	.ascii	"\245\ftP\301,\2307bD \227\003\303\025\235\360b\340\240\345\273"
+	.ascii	"\266Q\307\322\\\263)\255?\214\2417\221\323P_\357\2103\206:0\275"
+	.ascii	"\214\205/\256\177\201\325\"\322J\361\264\003\267\260(n"
+	.text
+	.section	.gnu.lto_.lto.2fc6841204fe48a7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.15.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\304\007us\350\326\006uq"
+	.string	"\005\001\006'\001\016&?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.16.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\204\001%\f"
+	.string	"\326\024OB\020O5\035\300R\240\326\300\202\316\215\236\254\234\0203|\rc\300\024\345\356\237\025\2245\033\200\325\020b\326> \002\240r\361\330\221D"
+	.string	"\250\251_.  \032\210\216\030G\3715Mcy\376\277\033\333N)8"
+	.string	";"
+	.string	"A"
+	.ascii	")D\354\226\001|\221\274\272|e{\225\234c{\265h\257\260D\300pA"
+	.ascii	"2\317\335\345\264\013\027OE\377\254OJ&\321i\204\300\356\232\226"
+	.ascii	"L\023n\355\266\001\330\036`SK\017:R\030^\375\320\366Z=\2508\255"
+	.ascii	"Z\214\350\314.ET\263`\037\262\273k\re\237\374iF\255@ry\230\330"
+	.ascii	"\2250{\261\261\372\312@\261}j\177\365\r\342\311\3207vQ\0010\231"
+	.ascii	"k\324\274\004\213\326\353\366\346$d\255\321\n>b\2422\317s\036"
+	.ascii	"\002d\200B\352\2642\277\203`\215\221\023\f\376\001C\236\020\330"
+	.ascii	"?\233\035\336\374\034 \307\312A\233\335\340\035@\222\335\025"
+	.ascii	"\340sp\020\232M\202\316W@\303\335\005\364<\036\347\0033\b\270"
+	.ascii	"\020\374\302\216\027r\235M\206\303u`\310]>\374-\360@\316\363"
+	.ascii	"} G)\367\220\325P\306h\210\2154\b\366\273\315\316\034E\247r\235"
+	.ascii	"\336\003  \020\203\221Ym\005\256\",\336_F\303\300\246\016\354"
+	.ascii	"\372\016\331\234\371\315\221m?\333E\030\t%\223\313\361\"K\322"
+	.ascii	"\303\\\3167\255\021\034\250K\013\023\221\016\214\023@\255p\036"
+	.ascii	"\262\203m\236)q\207\027-#\003"
+	.text
+	.section	.gnu.lto_baroDetect.23.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`)\001\005\016"
+	.string	"\346\232_C"
+	.string	"\223\223\016\233\322\366\201s\242\203T\237\304\211/\"r3\227\334\364\244r\005T\2275d\371\323\326,RD:BpN\013\310\220\004\244\217\005\310\251\210\267\016BY\255\241A\364'Yb\315\b\"{K\231RL"
+	.string	"G"
+	.string	"N"
+	.string	"\273\036\003{\256G{/`=^\037`=\332vH\003\221\273{(R\256\242\002\305Ef\327\303\364\304\273C\315\316\337\240F\207\004\256\320@\212F\b\016\252\004\023\304\230\300\021"
+	.string	"e\312\004\371\354\256\363\204\002q\307\333~`\033\202\375\021\001\251*\366\341\356\256Ue\307\364&\2465N_g\271\341W\177\302\3649\235'\243c\001\217\335\224ofk\304\031+l\213l\216m\365\356Bt\226\016\326\354\226\200\t\271\036\021\300L\373-\276\"\372\312\303;\273*\0261\002\243\034yZ\005\376\214\322\307e\354\210!\241?\2616\025Z`L\331\303\002\276\357\373~bit\243V\252\224\237\257\032u\242\3740\206\277\204\256]\223\003\337\345/4?\305\2435p\371\323\243\317Y\217\327\267<W\"fR++R~\266W\n\031GA\233\220m \016#\033HBgC6\242\026\361l\231I\026\3226\220\005\214\3334\256$\343\260\022\022P\b\023\3318\314s\300Z\206l\303L4m\3038\036\351\252\212`\343\306\013\214\364;\013\352\007\333P\375!i\t\002\310\250\366\005\222\374\351\372\2304\031"
+	.ascii	"A\023\320\302\001C5\2433@\255\267ef\357W\235\264Z\302\027\270"
+	.ascii	"\032\022\203\261\002]v,\200\331\222Da=\273J\300]\343\276\"\334"
+	.ascii	"\314\004\007\302gj\024\\\26645\261\345\364\273\235e"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.24.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375 \375\315\006"
+	.string	"2M/2`\213\322\001\323\002. \267`\261\371H\370\200\235\326\026 \244\206\264\300lC\365\n\255\035\323=\353]\017"
+	.string	"@S>\334K\377\033(\264\200\337\b\2212\245\256L^\3034\213{\024\005\006\237\203\227\006\331e\201ba\225\007\331D\300\216\241=\206q\3561I\334\353Hu\240\243\036\373\031\310U\365\237\222\347\025\267\310\370\022n\320\344\255S\276\006r\352\n\340\320\311\313\216\234T\b\373\323\352\310vZ3\375)@\264\201p\355\202.\217\325\240J\023\2667\266\304\006\007\033W\217\021\240\223>>\027\035\273\221)\351\325\263\362O\361\211#\003\303\nq\236\221\204\335uZ!\321\255\267M`\273\300\366C\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.25.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"u\b"
+	.string	"\346\320=7Po\322\001\240X\214\252\357j\350Td\241s\323lf8\276Zq\254\350rk(\331\035Y\026q\3335\277\225X\324]\352\233\f\332\252\242\036\bg{\304\310&{\247\024,"
+	.string	"."
+	.string	"-"
+	.string	"/\270\036\315\331.\357:\366(\026\025&/\273+!\307\271?\316\377\310\005J\246\321\037\300\302\356\372\225L\0307\274\355\004\333\r\266A\002\020e?\365?\213\340\304\342\320\262{\261\212YUT\371\260\375\214\355\367\354\207\\\204{J\344\270\253\261\222\262\333)X\023\3608p\203\353\361\005\264\312L\267\267\026\242\274\311P\221 \205\037\364I^\"\362=<\021z/=\372\241\3531\242N`N\244\267\262\273\321\203\033\366\255\335]\007\017\263j\022\021s\263\315N\026b\370P\r\204U\216\326\301\262\003g\232:A\323C+\306\221[\245\333gn\362\243a\036\231\325Mj\020L!f\225 \032\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.27.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`#\002\355\022"
+	.string	"f\243\177I\320\362&\035P\202k\253{\232`\344N\013\326D6\252\"\306\024#\212F^\021\022Q\226\005\036\3314\363\374\326\300\353\316q}\210A\026\272\020\005/\250\2073\223k\343[\234\272\276L\302\274\255.\311\013\300\300Z\262\267\334)\005j"
+	.string	"d"
+	.string	"m"
+	.ascii	"\265\206\350\221\253\265\252x\245uj\333W\361\243\033\323\346"
+	.ascii	"8dse\b\342i!\244\326\n3yIw:?\240;\335\021\247\275\243s%\315\307"
+	.ascii	"y"
+	.string	"\327\322\004D\264q8\235(U4\254^\266\235Y\342c$b\220\363\347;Qn7~^\266\332,\311!\302\307\225.{l:R\262Xj\255\226\242M\303\315\272\355\b\266[l\371 \362\307\316M\347Kg\341'\277\310\025\354$/\236\372v\352N\277T\270\242\033R\207\034Y\304\036q\344\342\354\317\272B\257'\375\256\226\245\347\307{;iI\245Or\340\303-\210\310\303\356\030\253O\021\"5\212\326(\361\361S\256\224r\3327\276\222Gl\217~2\251\215\325\226\200\t\306Q\312\251\027\310'\321\f CWU9\2728_\307\006\250M\371\b\021\t\236\031\262\265\273=v\330\311uY\342Q\223W\316\311\335\037\250]\031,)\034)\\k\373\302c\320\nL\325Z\025\370Lo\222\371E\247\266\360}\335\351\f'uC\n\232\213{\330\371.\376\"\254\231\231\351NY'l\240\br#\361\026\265\213\263\312[K"
+	.string	"gb\211\252&\257\214\340\337\326\0066\036\314\214\2017AF\026s@c\343\315H \314b`b^\003\017\244\020\206\036\330R\343\315\004\370e\005\364h<\331\007\306\\`!\370\2053/\204\315bb2\330\013\030\302V\f\370\223\361@\030\315\367\201\260\221\261~\205| \253\351\332+\375D\244\257\235s\315\222\263:]"
+	.string	"\371\025\177\372N\246j\315\271\350\344\030\t\362\342k\017\002(7\244\252\2668\001% P\242!\350\366\221\003\316\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.28.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\251\002-\025"
+	.string	"\246\247\214K\300\322Q:R%\344\324\220\230\022\342q\342_w\002 \036\251\264\225&\232,\204v\345F\343\322\200BG\2000\307\237\356\372\202\035\025\314\216u\214m$\013\305\234\206\b\252\b\005\265\217\252I\220A\002\373\362\331\352m\237\020\"wJ\001v"
+	.string	"m"
+	.string	"x"
+	.string	"\242Q\016)\251\326\272\342\026z\240N\fPy?>\t\226\332\006\016\334\274\250\202\267\326_\217\244Z\201+fa}\264\355\2378\212\033\353D`\b\037"
+	.ascii	"!$\235 U\255@\331\200\243\220\037\305\307\310\217\013\342\272"
+	.ascii	"\213Ku\376\203\027\211\204\302\236ow\221\347+\022\370\325\340"
+	.ascii	")\361\361D\024\034?P\017\236\356\370r(])\250\265\232\366|\032"
+	.ascii	"\356\361\266\033\330\266\331\364)C\276y\211\276\367\321\367\022"
+	.ascii	"\371\361+\341\003\324/E\017\016=b\003wt\203\354\213u\201\354"
+	.ascii	"\223\003\357\330\201\277\311\215~\330\213\376\227"
+	.string	"\353GwkE\315Z\352\325\212\232\\\352q\251\305\245\336\245\246K\375\224w\360@5\325\022U+\206#E\252\323\2504\342G'\351H\327\276\361\203&\261}\344!k\227\201\265B\210I\252\326\252\362\321\023\002\344\306\226\332\030\227\334S\370\214\034k8nK\tG\206\270\255\034BL\364\354\332\266\360\030\271\224\035\265V\004\276\360I3\177\350\243kh4\362\3438\354\375xQ\330\33201\364\275]:\345S\253\244x\273\023\177\031\322w\361\02725\323$?\216%\242\210\202\\D\357\347\264\033d\327\322uQ\301\203G\211\370\265tO\030:t\214\024\370\327\265\324\307\205_\316Y\274\205\207~6\345\213\215\001\316\246\264\301`l1/\263\362\201\203\\i3\231\231\341\314\b\345Ys\273\225'\315\013g\2531\027\22434\265\031\004\230i,g\211+k\3469s\221\335N\363f+o2[\314\254&\243\2357\031\213"
+	.ascii	"\2334\345)\303\231\346)#\001\326/\220\377\304\341\306\252\234"
+	.ascii	"D\250IGH]\333\332\035\333'[\262\001\210\023\316\346\270\265M"
+	.ascii	"+\336\220\252\036\326\306\366\204\304jY3\247\221c1\255\252\224"
+	.ascii	"L61 \240\"\231C\017TF\222,]A+(\333\326\232\206\024\b\321\242"
+	.ascii	"guY\313\031\304\327\023\307\n\367\r]<\213\023\bu\335\016P\226"
+	.ascii	"\362\262\005\371r\205tb\2323\307\340\234\335\325\223\340\265"
+	.ascii	"\021\264\0350G>`\350\250\026\354&<\322\t\305?1\252\310C\260\200"
+	.ascii	"\207\251\023\344\001b\265\206\2600\310\361\2761\215\223\212\242"
+	.ascii	"\270f,\032\235\242\211="
+	.text
+	.section	.gnu.lto_isBaroReady.29.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$\241\212"
+	.string	"\3041*F\023\256\002\3042\336\\e?$\273j\377n\207]\033\241\324\301{s\314\314\0209]\244r_`\246\016\215i\226l\231\002c,o\332L\031\367.\013\215z\216\322LT\3230\\2\r\363\250f\031\3305L\257m\234{\255re\231\b\031\301\207=|;\352Q\335\214\0358X\253\322\345"
+	.string	"TB&@\361\301\321_\036d\025_J2\321\217#3\220(\311I&hd\222#\022\210\306\337\371\312\b\t\235\253^\027\240bX\020\037%\231Wc\026\255\212\325-G)\033!\"V\310S\fP\310\314\321\nMt\326\277\340?\370#\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.30.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\033\002\305\020"
+	.string	"v\235kH\320\322(\035J\202e\264 \251#\360@Q\001?~\026\206\375H"
+	.string	"\370bb\217f*\351\206\025\355\213\326\250\375\376$\234\320aS7z\375\351\204\330Ih\361 c=D\001\262X\243\n\\\234Vx]\217\215\354-eJ\001T"
+	.string	"O"
+	.string	"_"
+	.ascii	"\267_l\222\257\342+^\314\212\262X\310\361\304\300\314\210\346"
+	.ascii	"\224u\007N\302]\306\023\340.\327\304Y\227q\225\345\007\b[\227"
+	.ascii	"!2\217"
+	.string	"\317y$\n\332\001C\231o$\021\"\221\203\024\302\342\202\231\033!D\302\227\352(e\316i\005\303\0177w\333\020l3\260\025D@\364\247\207\320\210\335\232k\340\276\017p\300\364\207}\026\227y\276\2157\264\350\301K\277\205\273\374>\347Z\353\301\021\341\322\233-{\351\326\330\217sK\330V\227\254\036qj)\3251\2527\252u\325\027))\022\242p\233\263\303\255h\332$\020\n\325\036W\22374\"\0361TN\200R\t~\326\302i>\251\221\241\236]Y\243\341\f\320\353\234G\305dhN\327A\030)\004\261\027\272v@\003\333\226m\323wN%6\352.R#Cs\316\006->[\361m.\215A\245\342.ue\315\307\207\216Ko:Bb\323\303\234S\201\200\031)l-\r>\241|(\027\224\312\373L\027\272\325\347\255XP\253\216e\305\244\352N\337\252C9\261\227\001\365u.\236\367u$\231\3531J"
+	.ascii	";nb\266\264\243\345`{\264Nq\355K\026P;\202\004=(w\267EC\343'"
+	.ascii	"\300\031[t\334\322\036&\310\204\007U0\211\331H\031\210\325\030"
+	.ascii	"\315d\374\001. \320\002\021)*\017\277\002\276a$\022\316>\341"
+	.ascii	"\276o\205m\253\360\026\\7,\257\334\312\362\240\243@\310v\343"
+	.ascii	"\360^;$\r\021\\\036\271^\206=\030\267\263o\247K\333\222\266\333"
+	.ascii	"A\026zQ\002u\273\264\357\365\325\311\264\022\216\271\302\005"
+	.ascii	"\234\024W\261\306\207\2010\364\206\327 \001\005:\210\241WN\355"
+	.ascii	"\301cF\323\036("
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.31.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`Q\0045\034"
+	.string	"F\265\266I\240\330M:\302\023\177\261\003^\355Qy\215\271\304\013\274<\244\027\034\235k\375}\270\334\031\033\270:\370x\214\235\007\333\214\231Sh\033\233H\327\226^\343Z\223\322Z\370d3\316r\t\362\3617\013|\350\240 vo\"\245L\001\233"
+	.string	"\223"
+	.string	"\245"
+	.string	"\017'\277C>7\177\t\364"
+	.ascii	"\241h\330\252\325iLL\355\232Fd,p\367\337/\217\305\372\307\217"
+	.ascii	"\330\253\367\323\227\215Z\353\270\363\037\361\217;\367'\361\265"
+	.ascii	"\372\270@RL:!\372\200\021$Xk=\260\3637q\3477\307\352 q2\274r"
+	.ascii	"\361\2430~4e}\251\265\342lK\243;\303\325\241;\273\305\222;\303"
+	.ascii	"f\362\273V\033\022\341\362\342\373%\355|\332p\346\367\264\035"
+	.ascii	"\032\b\026\3512\373-\2054\247\030\276\265Z6\361\3531\313\030"
+	.ascii	"\324Z\317\276\037\212=\335\377\026\376+\370\303\032\001\373\004"
+	.ascii	"\f\270?\026\b\221\316\203\007\272s\033\301\323\027\230u\021&"
+	.ascii	"H\244[\252\210\n\365Z-\016\226\026\036Z\242\200-q\230\177{lV"
+	.ascii	"\321w\352\037\214x};\277Ft\247P/\326\362\215(\026P;R(\361\330"
+	.ascii	"\177\325\343\226\3727\254\265\326w\324\177\376\220\310\027\n"
+	.ascii	"Z\340\3366\371@2\376\017\345\327(\337\207\362{(\237\207\362i"
+	.ascii	"\224\277C\371:\224\2373\3718\"\377\206\362m&\1776\37152>\r\345"
+	.ascii	"\217\224?C\3712\224/R\276\254\371\264\371srK\226\311\003\b\021"
+	.ascii	"\"\320\235\263\036\245\254\200\001\326\264\255\203zK\252\036"
+	.ascii	"\222MBJ\2300\201\356\254\351iEE\n\232\2665_\251\361\330?\205"
+	.ascii	"\nt}4m[j\212\242q\033\233\305\312*\231\376\326\326Zy\246C\257"
+	.ascii	"\222\212\207\277\265XaS,\304\210\375[\270\300\353\223i\033S'"
+	.ascii	"\375[+\025D\251\326/\030\033\353Z\252Ui\200\254\305\016\271\224"
+	.ascii	"U\264eM\265\312\340\354m\3325\255\022G\330\363\266\335a\007\320"
+	.ascii	"*\241z<v\356\356m\032s\f\253\225A\254u)\301W\310\016\331\360"
+	.ascii	"\235\332y\016\271\034\335\311\035\"\214\2208 \201h\260\343\345"
+	.ascii	"\034\214'\272\361tH:\243\035/\327\001w\304\333\035\205\320\035"
+	.ascii	"\341B\024\345\214pD\274#\334M\300w\"t<\034\322n\307\303\215W"
+	.ascii	"J\033\326\216\032j\233R\367^\205\024\301\206z2a\271\001\234\007"
+	.ascii	"\366k\312\364\n\263\261\205\22509\315\b"
+	.string	"\017\324R\310\031\225(\353\313\362\323@\315\\j?>\275\323\265\356\254\022\252\247i\355\323\001xzZ\200XI\325\013\313i\236.\240\025\324\264\006\340\325+\261\242+L\247wr\332\246uz\313*\234\316i\312U\006o\032\207\334\261\\\244\225\223\233\336#/fm\323-V\006\033l\023R\254\265&\370\006L\250A(\005\021\202H\031\023I\023$\261\264\030\220\002\031A\3329\021@\265s\220LAn\007\322\245/ir*\312^\001\322\237\377YM*_\347\221O*\t\244\254\013^;-\001J\241\252\313:\b\202\353d\332\353J\005,a\240\222mrc\213\3345 4\311P\350\335~\317\310\203\217\354\022\362\005?\030\211\275\362-\"\320\241\t4?\203\304\255\300\030\300\354\023r9\033\003\224\240\361\3543\006\031\352L\020,\326\315\313e\344\322\211\306\220\3731\273X\245\204>\007sN\337\307\306\024\203\250\220\005\324"
+	.ascii	"\n\350y\223\327P\226\032"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.32.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\030\003\335\025"
+	.string	"fg\210H\300\020)\035gJ\365@\257\201m\377M\211\035\323\236\355\336\350\354\266Q\333\230\356\253\331\276\032U\335\366\332T\277\337\357\231\251\267m{\352\356\203\240\t\026A\020\024\271\f\201-d\271\006\371\230\253\367\303\360\366\177#\233$)Sn"
+	.string	"i"
+	.string	"u"
+	.ascii	"f}\275\332\265j\327b\270\226_\207\273\376\256w\327j\002`\212"
+	.ascii	"\351\001\322\234\030\306\250\031\224F t\325V\227il'\035\3620"
+	.ascii	"uE\223\rP\307\234\223\366\016J\2432\374\322X5HY=_\215J\034\r"
+	.ascii	"U(s\316\226\017G\037\026\320\211\221\341\345\333\2052&\01634"
+	.ascii	"H\327\202O\267\253B\231sz{\276\033\265\250\266\023\3306`\377"
+	.ascii	"Bn\251\325D\225\362'MB\271\022J\024\301\345\345Et\371\344\370"
+	.ascii	"\331\353\377\003y:\272\035=A}$\352\367\312\003\322)\t\025\202"
+	.ascii	"\261\362\330&\263\332Si\225\021U\352]2p@\345\344v\264\207t\373"
+	.ascii	"\237\255\341\374\216\375u\211\270&\021\327\262]\307v\r\333\365"
+	.ascii	"\210\\\213\310u\210\\\203\310\365K\256?v\355\261k\327\327\255"
+	.ascii	"oR\274\036\220\273H\347\234\033\362\020\310\013\021[\027)\221"
+	.ascii	"\023\217\206\250\327m\006\rV{ 7\251\360\032\273H\177*rs\372d"
+	.ascii	"\034\203\2739s\004>\376\272\362z<\376\361\360\210W\303u\217\213"
+	.ascii	"7J#\017\310\365\024\332{j\335Ur\326[\327\237\365\003W\017_r\231"
+	.ascii	"\304\003R}5S\361\252\007H\222\027\2576Sv\240( \254\346\334\035"
+	.ascii	"\260\236P\340\212\225Gen\231\335j35\030\333"
+	.string	"m\205\205\206\273\331p15\034-\306e\005\206\326r\303\321f\003l\223P\273\321fl\266\033\3155\224\323\357x\301\030\314]'a_\232Y\242\321{\"y\3228j\212(;\t\f\331\245\317\324O\316\266\270\301\264!\374OSD\353\013EJA\240\242\002\224\032aC?\364t\202\377/v\330YL4\355v\207\013\n\261\263\214`W\001\243\240rFX(\020\371\210RnG\233\035\0213\221\013\bH\250q<\306\024Q\312Q\345\024)\303\001\220\002\021\272\252\016\020hHD\031\016c\334\2222\214\203LC\224\236+f\326dbj&\r\317\262\355>K\271L\271\314%m\275\334#B\344[\00574\"\255T\231yN&\346\245\004\212\303:\340\271v\372S\217\213=\304\244\214#\227\242\336\034\321\036b\211\232\376\245\343?\325n\354W\r\272\275\310\361\361\016\346\3261\204\t\353\231\\\037\003\377\214\272\203\025C%"
+	.ascii	"\244>|bY\363~\3106G\367W\332 \324\302\275\037\201j"
+	.text
+	.section	.gnu.lto_baroDetect.part.0.46.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`m\002\025\024"
+	.string	"V\345\202I\320\322(\035\036aY\222\350@\200)\b\312\263\271\367\321\277\026\346\235Y\310\fU:\333Y\001u\337\372{\004\320\037\375\367W?t\270 \221p\240C^:W\350-s\342aR\276\021\242\301N\350\030~ k\221F6\221;\245n"
+	.string	"p"
+	.string	"i"
+	.string	"\260\373\270\f\240V\035\"\031\265\226\fN}\022\236\246^"
+	.ascii	"<\375N\002\236\332\3571J\312\013\307\266QR`\216\275\334\2719"
+	.ascii	"\356DM.\251\326Ru\272#\036;\375v\2021\177\326l\262\323E\002\""
+	.ascii	"\342;\357\bT0\031\035\361"
+	.string	"l\035\276_\252FQ\r\312F\373Jn\037\202\f\260\315\346$p\360\264\252\265:\364p\237n{\202\355\027{r\b\217\341\326jfC\363\361J\344X\221Ti\245\211\355\030\267\016\224;\033\002\244\330\221A\350@_\373\2169\f\257\320\215\244Z+\352\276\213\227\257;\317\250\240\235\313)\332\316\025\312pB^\216\247\207\203\360@\257\347dRkSgp&\247\376~\376\002\366\234\314Gj\275\365\254\302S\227\341I@\230\215\362\316\227\257\373\270\276\262\332p\274\323>\213\267\bs\205>\304b`\247\326\332\300\237q\032\027|\023\247n\031\347k\247\376\b\236\316{\b<}\315\307w.j\266\364s\244\03323\233\274\277R\210\246\335.\316\340\025\200\337\363~\022=2$#\"\332T\352\331~\361\230\265\272\340\364\223i.\316\013\376\253{\263=\275\247\351\371\362\177\230`I$\247\326\233\246\245\n\202\n\241xP\266 "
+	.ascii	"\203\270\262bK\302\030A$Y2+$\013\302\210UNH\021Fl\031I\026\005"
+	.ascii	"U\213\034[.bK\345\302\302jQ\251\220-\325I\211\307\027\221T\301"
+	.ascii	"\214#\251B\375\253{\363\t\207\016]\357\363c\340y\177p$D\327\333"
+	.ascii	"?\006\356jX\257fv\346\375G{D79\273\272:\336O\032\033\225\347"
+	.ascii	"\023\231\337U@[\2540_\363\354\375(\242\255\314\0011 P\0021\022"
+	.ascii	"]=\306\"\220q(\3044\2114\027\256X\356\2375l\313j\007\300r\270"
+	.ascii	"\251\246\223n\030\264k\334~\325\354\"\300\220\033\320\232\023"
+	.ascii	"\365aV\270%.\310\203H\361\204}\227\242C\222\370[\361@j\243\026"
+	.ascii	">\006o`a\017\215\035\226\022\334<\244\3164\354\207B\345\231#"
+	.ascii	"\323\310\241\351\244\317,\013\ndVX\2420P\276,7\366\001\311\357"
+	.ascii	"\232x"
+	.text
+	.section	.gnu.lto_baroUpdate.part.0.48.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\362\003\355\027"
+	.string	"v\251\222K\260\022R:\346\220\001k]\256\242\273Z=>'\"\016\b\230\002q\323\340\375\002g\261\006\376\2052\034\006\262 \320\355\271\356q\313\240~\241\353\017\237+\212\177\005\375\006\3672Y\237\212\221\035O\f\217n\321C\2555B\310&r\313\024z"
+	.string	"w"
+	.string	"\207"
+	.ascii	"SJ&t\307\021\257\320\331\013J\360\242G\223\360\362\234\bHp\211"
+	.ascii	"\234\343\0048{A0=VM?K~\016\237\007\360!(\274\367\312\370\374"
+	.ascii	"\323\375\262_\347\227qu\322\375\374?3q\223\316\255x\366\200\306"
+	.ascii	"\250\r>P\302{O\223\253\n\233\214\\E&\031\271\266\021[n*\3323"
+	.ascii	"\345\001\355\270\371\307\242\360*\213\007\324\201\351\b\213d"
+	.ascii	"\313\275\367\245\007~\345\377\n\376\317~Q&+j\004zR\375\005C<"
+	.ascii	"\275\373/\201\243dN\376\031VQ+\321\272\367\262\240\340\024\266"
+	.ascii	"s\022\327S\240\241\314\343z\246\351JU\345{\332\241CN\374\327"
+	.ascii	"\375:\377V\331\273?w\350\036\340\312?f\rU@\031;\372E\273\350"
+	.ascii	"-\262x\233\350/\351EJzY\214>V\322\303H\372\022FO\226\364#I_I"
+	.ascii	"zq\244\357JO+=\237\230\230\301{9\f\361\272C5\375\345#\344V\004"
+	.ascii	"\377\260\276\362^\036\226\263\017\346\262L\326\311\376\354o\344"
+	.ascii	"J6K\035=m1\017\313\300\305e\344:6\331\025\034\326\376\033\260"
+	.ascii	"\216\0348j\303\212\202>!\261\177\007|cVb\203y\\5f\347\244\277"
+	.ascii	"\320\304&\273\200C!\0014f<\340\223\263h%cq\214\331\013\2156r"
+	.ascii	"}c\200\341+\b0\254\272+\025\320\007\214I\251\252\025\240\242"
+	.ascii	"\021\330\305T\255D\253\005\035\222P>\231E\f\212"
+	.string	"\326\275;\314\013\257P[\301\331nl57\334\314\0043\207\273\345ll9\323\206f\246\306\254\341r\346J\312o\026l8\363\346v\303\231\262\377\224\305\333D\347\037\217PY\213t\206\377\"\375\226\235\276\360\356.\372\037kY\263\021\013\261G(\275\257\332\200\236W\254I(\254\341\223E\032\317B\036Z$\013\302*)\215\\\353\022\326\b \260\016\322;x\\\006\250\330c\227\375\333\020v\2112\017\326*=\275;\331e\007T\250a@\245\234A\212\314\314\204Q\230\302d8\320\"!*\233\003\021P\255dH\214$\312>\273\0012N\2529R\274T)[\252\221\177\261\f\274\217\241\215\026h\346p\325\372]\373\"\315>\004\241\377zt\007\331*\201MMQj\247P\220\234;j+\027c]D\300~\263EaAY\245i\264\372\326du\202'\272\315\230\\\013c\230\335(\317\005\003\236\007\201`h\r\340Rg"
+	.ascii	"\324\317v\233\205>\227'#\346I\366\357R\213\312=~\225PU\230f\001"
+	.ascii	"_\002n\2545Z&<\226\016\"\265\354\300hSu3\023N(t0Z\3057\3234"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\367\001\315\013"
+	.string	"\224\020\363\002"
+	.string	""
+	.string	""
+	.string	"\002\020\177$\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\033\177%\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005&&\200\204\001"
+	.string	""
+	.string	"\003\005''(\021\002\034\177($)\032*%+.\177,\204\202\202\200 !-\0020\177.\013\025\201"
+	.string	"\005\022\027\023\030\005\026/\f0\201"
+	.string	"\005#1\002\027\1772\272\200\030\1773\005\0214\002\031\1775\035\1776\002\036\1777\037\1778\005\0249 \177:\005\025;\005,<\017=\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\r>\003?\201"
+	.string	"\001)\177@\377\037"
+	.string	""
+	.string	"\200\200\200\001\"\177A+\177B*\177C\003\001 \320\360\372\250\001\001\304\006\003\005\001\342\001\003\t!\310\377\241\372\001\001\244\001\003\013\005\007\004\013\365\001\265u\003\022\t\240\341\365\321\001\001\302\001\003\027\013\340\236\212\256\001\001\202\007\004\027\241\341\365\321\002\365\001\003\030#\344\006\003\030\"\304\007\017\003\032#\244\n"
+	.string	"4 \340\002\241\242z\254Afckh\333\320\311 k]\271Dp5\206|^\224\006U=\n\016?@\330\323\322\366$\030\023\222u\355\314\202\220\03598Q\307v\335i\267}\031\364\340\371\304\361\230-\0038\303\256\001O\036b\210\303\250y|`\307\222\034o\207\254"
+	.ascii	"\031\204(\306WM\216\016\343p\034\342\300\001\362\020\f\2342\306"
+	.ascii	"\033\355\345\307"
+	.text
+	.section	.gnu.lto_.refs.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\355\004"
+	.string	"B\017\"\017 \\Z\035!\362B\305\236\270\244\033\221\310\024\177\212\313K\240\023\210\216h\372\241y\247\351\005\304\023\236\0378]y\372\221\237\236\017\311\r|\006\366\005\366&O\347S>Z6\264\033>c\372\3022\027\326]\023:\350m\026\364\346\201\036\300g\230\236KW\362q\371\004;\002\370\206\235)\277"
+	.string	"\367Rn\205\177\340\235\360\021\336\207'yB\332z\252\256\260G\3307\365\214\365c\365X#\351f\350\327u\225zB\275w\325W\020\006"
+	.ascii	"\222\006{\302yS\255\237\005\3017\205\r\300\252\310"
+	.text
+	.section	.gnu.lto_.decls.2fc6841204fe48a7,"e",@progbits
+	.string	"(\265/\375`\243)}\273"
+	.string	"\n'\265@Y LIH\351\252\002_\234\023\374\303d9\226\337D\360\2745\353\266Q\022Q\226c\002'\024[\021Q\313\243\311\352\252\322}\317\263\300u\226\261\246\376\177G\205Z\273{\231e\302\322\363\313\245\250{\256\236Y\306\257\257T\tA\034\336\022\216\367K\303+L\213C\272\265\272\367\226)d\003\r\004\017\004K\352}\232\232\374\237\243\243\306\311\207\\RE\267}A\213\253\327YU\324\2453s\316\r\345xT\312JQ\221l<\252\244\250\367\025\371W\245\016k\260\017\264\323\026\251!\365\342\304\025\275\036/\225\032\030D\252\261\346\035\\R\260\250\3675\377\375\246\347p\276\240a\251\227'3\333\024\275\335\244@\265\374Q/\021\2335\365\t\213\343\214z\337k\376F\323]-W\227"
+	.string	"\340\tk\263$\243\336N\323j\332y\261~\341\035\327W\236\203d\346f\377\330b\374Q\357\255Ux\205]_L\307\323\024\350\332\253\350\rG\201N\031\305\314?6L\313R\2333o\273%Z\246\236\365\366[\3552m\346\375\326n<\310~\2739\037\2733\360\351\316"
+	.string	"GL\310\321\211\356\276\362\300\177\223\331"
+	.string	"#\261|m\3251\335\226C\206\306j\254^\266 \235\2473i\230\365\276\306\300o&M\274\274e\021\033\273\202\205\254\313lM\255\305\364Y\177i\264\016\323k\355B{i0\355\354\264&{w\351\262Wf\316\310\234\363;\314J\027\246\226\346\322\302\225\007c\r\346cs\316\001v%\345\253\301\372,J\001J\312z\253\323:J?\373\314\207\003\266\314\336rf\036\204\277\350\377"
+	.string	"B\247u\013\r\266A)\347\0348,PJ\003\246#.gfP\207\23741m.,\270o2\374\267\316\240\363\351(\370\275\205\337A\360\226+\243\214\207U\275o*\374\236\201\337*p\320\t\314\301\004\026\352\f\272\236\322T\332\211AW\371\007\020n\215M\362V\317\233$o\330\324\373\017\3407\006\272\236k\ft?\001w\320"
+	.string	"\334N\272\331\316\r\032\312\333\253\231\3079233g\346O\255r\023\305I\275\007\201\377?9"
+	.string	"\2442\b\367\301\357\rtvn\2567\320\205u\006\035Pg\320\325\263\316\240\353-\fl\322\3052?sfb\370a\312`\242\252\367\314\316\240\303M\201\356\357\017\264h\0345D'\375\r\374\033\003\276\016\3602\200\204\203\337\246\360W\r#\330\372\200\2776"
+	.ascii	"\313w\r\277\255\252\"\374\035\202\232\200\020\376*\204\200\n"
+	.ascii	"\342\033\370\177B\030\001~k\244\202\3607\t\017\374\235\3637\007"
+	.ascii	"\352\007\325\003\235\277\211\017\372m\360\376\326F\217\240~\330"
+	.ascii	"`\001\177\315P\224\337\363W7#\216\363\333\031\265\203\377\006"
+	.ascii	"\320\375\366\252\022\325\241\352\341\377\206\337v\340?\230\377"
+	.ascii	"[\376\233\375W\373\037\346\377\227\377.\374O\373\277\366\337"
+	.ascii	"\313\317\016\364\333\002\374\025\377u\347\257:\177\335\375\025"
+	.ascii	"\347\2579\177\355i\270\277\332\277\326\332\341\377\317\1771\370"
+	.ascii	"\353\001\376\252\301_/\370\253\005\177\235\340\257@\177\365\371"
+	.ascii	"\233\354o.\177\213\375}\345\357\260\277\217\374M\345\357\257"
+	.ascii	"\277\233\177[\375\315\344o\256\277\227\374\215\344\357\254\277"
+	.ascii	"\261\376\356\361\367\324\337;\376\316\361w\324\337P\177\223\340"
+	.ascii	"o\247\277[\374\275\201\277\001\360w\212\377s\377\345\376\227"
+	.ascii	"\371?\342?\333\177(\177\257\370;\371\267\212\277A\360\367\322"
+	.ascii	"\337%\376>\376}\201\277\363\377\270\277U\370_\345\357\364\357"
+	.ascii	"\341\337)\374-\374;\370\367\316\337\367\357\377_\363\337\314"
+	.ascii	"\177\021\377\307\374o\373\277\365\237\204\377d\377}\346\346\346"
+	.ascii	"\346~\034\241\177\227\177\f\332\002i\204\3541G\r\016\307s\214"
+	.ascii	"\\\235\263\271\327t^RJ`E\216\267\254Tz\270N\f\277\256\251l^\333"
+	.ascii	"\274M}\323Q\331x&\203\030L\270\261\270\034\245\024\252oZ\356"
+	.ascii	"gI\223\024\270\226\323\211\321\332\241\242\336\353j\340\277\376"
+	.ascii	"\272|T\346\234\235p\230Y\251\304\243k\234n\241\277\247m\023 "
+	.ascii	"\333\377\033F0\263\021\r\r\r\316\002;\3328\207\374\237\345\214"
+	.ascii	"\2242:@\252\t)5#\331\224\312F\244\225\021\2032K\031\223\315\234"
+	.ascii	"1d$\322H\3022cH6sSN\001\246\2513S\312\230\221\313\214!#\363\221"
+	.ascii	"C\022)\325\224l\036\2330$\233RM\271)\225\2012\362\250\\\201\314"
+	.ascii	"J\f\271)e&7\227M@\311\346\262)\331\224\262\321r\3113OM^\320\246"
+	.ascii	"\272\332J\022\231_0\3358*\201\316\222\314e^\313\271\237KYI\200"
+	.ascii	"\234o,\225k\307\031\035\246t\366Bi\312q\331\032\230\224\246\226"
+	.ascii	"\031y\226\324Z\346\254\245d\"3}`d\236\345\037}f\244\272\221]"
+	.ascii	",\345|\001S\316\306\316g9gc\316y\247\274\301\314\271\006P\362"
+	.ascii	"\212\211)\347\250 \246|\303he)\347\372d\013kJ6\247\226EV\234"
+	.ascii	"\315\253\254\202i\354\253\274&\245\304M#\223\354\002\016_5\305"
+	.ascii	"8\323EM}\341\256\301Rr\201a5i\320\3408\031Sr\254\027\r\\\032"
+	.ascii	"O\031\026\320r\234\021\352\221SSBb\346cqjS)\336\310\004\351\302"
+	.ascii	"\324\252\2672\275\220\273\352R\266\234ON\316Rqe\252[\035S\333"
+	.ascii	"\332Y\311\324\265W1\225\r\006\231\332\324rJ\312\274U2\365\251"
+	.ascii	"\20612\300\r\206\226\270\234\363\017\330\025\233\227\316\305"
+	.ascii	"ar\301yb\265\033E\007\025\262\336\343t\341\n\246J\325,\033\224"
+	.ascii	"\222\367\212\027\f\261\332\245\n\223\034\375\364\301\311y\031"
+	.ascii	"\005\255\236U/\265\254\232U\027\352\227\232\326\316\n\246.\275"
+	.ascii	":\325\030\017\332\252`\252\216\347\233\f*P4\246\334\250QTR\256"
+	.ascii	"j\r0\325F\215\352\263(fv\322\021s\305\306\345g.\210\217\255\t"
+	.ascii	"\356X%k\001M\371D\315\034\036k\241\007\nY\215#\227\327\026x\324"
+	.ascii	",\265\221Ro\335b\275\270\351q\324\322\323u\025F\213\226\267\\"
+	.ascii	"\035\362bH\2324Xj\033\327\f\247\030\034V\255\264\263^\251@^\227"
+	.ascii	"u\307\203\230W*U\375\3215\345J\255\252U\372,\n(#\335\344\336"
+	.ascii	":th\247\2267gt\327\253~\255]Q\251S*X;k\225\327*5H-\342c\304\220"
+	.ascii	"s\217\270\253*\325H\345\352\263g\tF\306t\320\320\241\303\216"
+	.ascii	"\013\0368\214\370F\251R\332Y\277\352\323I\205\202\006\354\253"
+	.ascii	"2k\223\rJ\311\022\262\220\275a,@\262\374(\203\342\354Y\001\226"
+	.ascii	"\025"
+	.string	"\246Y\237\350@E\235e\261\202\377\346_`\245 {\236Ler\267[\325E\006\227\023\374\273\205\177\221\340\312U\217T%}\366$\301\214\355-\347\274U\273\332Y\271\352\222_f\256\\U\310X\333[P\007\237!YK\270t\3677\b\276G\220P\312j\222\212$\367\364\270\341\020\323\252\367W\n\377\332\300\2773jV\325jg-R\211\274\342\250S\017b\346<\305\203\277\250H\265\252X\033\224\222&\344p\253E\252\220\006\363123\f\r\224\321\261&\250C\207\035\325\025/ \272{;\006\353W\226F\222J\033&\316\226(4!C*\220\0356\026\331-\r\337\226\341\333,\370\366\013\337zU\037?P\244\272\220\324{[\004W\036\265G;+\013\277M\226\271\2313\263\307\036e\224\201\t\351~\204t\267Bpg\333\003w\020\016|\373\204\201l\013|\213\304\034\330\340:\203\005\021\256%\024\031\374\252\206;"
+	.ascii	"\203/\3639\206_\245\3403\271\360\303\252\213\026J\274\334\310"
+	.ascii	"\325\333\202\005\020"
+	.ascii	"\251\252\252\025\257,\356\306\223\363\206\r/\252\002\327\005"
+	.ascii	"/\2655\253d\006\243\315\0323\370O\367\351\312\bZ\032\315h\300"
+	.ascii	"\305\304\255\213\220\256\355\355i\315\205\372\225!'\001\247\020"
+	.ascii	"\243\023\247\353\324$\264\305\330\366\024\227\225\\<X"
+	.string	"6c=\262\324\373\036'\374_\345Uv[\020P\316Sra>*\210\270\260r\203\337I\332\226\335\226i\247-\273/l2*\307\360@\345\206\007\235\231\020\245V\275\227\211\211\334\265\240\361\365|\303\357\2553\026M\033\2164\026n\213\355\005+g\304\213es\225\252\224y+\272*\252\020\013'\346j\305uq[\334\344]\272,\332yU\3305\267o\326\f\363\252\260jv\324\322\f9\363\271gN\246\213\314U\262m\356q\207\312\027\2658\344M\321\316\253\364\324\320\303FL\\\227\356\376\367x\215a,l\250\250\367\346n\222\265\240\n{\323N;\247\202\210\033\253z\255\233\223Yad\321\342bPV\226\224Q\301\347\201\202\317\243\304\306\341\2647\034fZ\370<W\370<U\370<=\320X\270\346\030\0323\013\007\346B\231\013%)\\\231\235A'\324\024\350l\233%c\335\376\234\037%a=\276j\340\3331'"
+	.string	"\361\362U\357\265bn\331\310\206\\1A\341\3330v\355\317\361Y\263\212\302\244\336\3630\341[\265\257944\352\265ixign\003\035\034Ut\330\250\3676\355\267^\354\231E\023\301\234\233\027\352\265`\254\013\267h\366K\266h\037,s>Z\264\23769\037\177\2723\350\316\340*\231\032\"Ew\277\263\006\177\2553\350z\320\024\335\232\355\230iy\363\3722f\265X\262\226+\342\272\242\202\277s\004\337ji\313\205\313r\207\n\027m\255e\311b\3054p\355\266\262<\251\304p\300hY\355$\257\330+bJ\2354`\007\263a\365j\347\254z\276\335,\037H'ar\272\024]>\222x\301T\250\330f\t9\003\326\322\b\216\212\030,Q\242\330/\rMW<I\254\320\270\"\345\366\313\226\001\311j>\257WVT\017%\370\366I[(N\013\245\237B\371x\324"
+	.ascii	"K\230\020\374\356\247\316\211\023\333,a\256h\265\344K\023+k\312"
+	.ascii	"E\275\327\211\201o\273\3322-\022\313\304\272\210\001BV\326a\302"
+	.ascii	"\327I\341\202\353\355\264\\\335f\22397m@\346M\007&\023\331\341"
+	.ascii	"\206o\223\264]b\227X%\r\304\256r\314\360\333*\351\212X$E\354"
+	.ascii	"\021#F\354\221\316J3\007\300:\353$n\346Z\244\271=b\331\216\234"
+	.ascii	"\r\301\202\237\303$\313i\263*\262\233d\243\316\212\246*\031q"
+	.ascii	"9Gy\350-g\260\314b\370\260C|X,]\316\315\\\302P^\335b\345(\275"
+	.ascii	"X\"\366\343\207\265\302\306\n\304\302|\236O<\240\204\334Z\365"
+	.ascii	"\233\217\226\225\225\255z-\020\033\004\307\371b\312i\203\330"
+	.ascii	"*\035+S\212\230QKkcJ\306\335\350JR\246\336\347$\361\261\032\036"
+	.ascii	"V\207\355Q\263\003V$sv*\242\201\323\360\361\225)\247\235\352"
+	.ascii	"\267\240l4S\024#\303\215\305\341\347\322\352\260;.\206\215J,"
+	.ascii	"e\005\330\033.\202\217\227\266\206\255as\024\200\206\305q\233"
+	.ascii	"\303*]#/\304\216\324ko4\230\216\225\346\027\250z\255\r\253T\265"
+	.ascii	"4\327\224\360\022\2663\346lT\277q\200\312pcH\262\222\351\341"
+	.ascii	";4\370\2733|\017m\237\352\234\205\272\330\315\317|t\312 \306"
+	.ascii	"[\366\360\035\024\374]\020\313t&\353\204s\316\r\246\214\022\302"
+	.ascii	"X\236Ol\266\351\326\251\032\311\216\234Y\345\217'cRT\345-\f\270"
+	.ascii	"2l\231\355\347\213\025\f(\373\242\311z\346h<k8\241\261-\252\027"
+	.ascii	"\025e;#\376-\2130[cjR\352U^\240\214\344\241\343\312C\327\027"
+	.ascii	"\355\254/Z\256\204|t\342\200\345\fn,\356\026"
+	.string	"\371vZ\244]*\201\231\215:\2460e\224\207\234'8\343\230zm\212\250'ZPk\360u\001?+\004\207Ba\217\247BP\210\204\324\363\021\323\037\t\242\"\360\210\203\025\212\300\037\022\007\037\200\340\201\ba\005\"\324\250\210\344\003\376\210\206\304\"\021\221\n\301\241\2114\b\334\225\350\241H7%\002\203>\234\022)\3607D\322\335\304P\322/\005\026\207D\276\022)*B\307D\332K\"\002\006\223\222\202\276\013<\b\201\357WLa\202\233\030\232\300\b\023D\020\245\350\321\260\227r\b\201/\210\024\002\035\006C\374\240\020\006CT\220\336\304\320\221\220\350HH\201\017X\334\001\226\250C\034\"\217'\345\001\217\2048\300#\241EE\360#^\024\302\240\357\016S\2415B\201G?\244\336\316\b%\026\257\017%\356>\344\035\t\207z\206=\023\276\213b\230\022\177G\250\005(\350`\310\b=\321#fH\032\006K\fQa"
+	.string	"\214\200\305\3400\002\250Q1\375\245H\017\310\260CD\221|(RT\304\bG@\037\017\232\006C"
+	.string	"\203\277\2647$\361C\352\205 \3764\340\200\030\"\356\222\320\224\210B\004/\251(\342\007M{F\302\013`@4B\215~t:\030J\207=\341P\352CS\224\204\017&\230"
+	.string	"\204\n\220zip\004:\324\200\341\303\020\n\243\036j\201$\n\202<\030Z\0015\002\232\220\002\321\341\260\350\273\200\007\204@\212\022Q\013\034\t5\240<4\355\245\"\200\322k\301}\300\336\317\b\245\300\b(\220\204\302\336\005\367\375\206(\020=\302\377"
+	.string	"\004\007 BXa\367\020D\350@\204\016t\017A\204\242\"\021@\024\341\203(\262ECD\021C4E\372A \b\345\211\320\24571t\200\020\025\240i\017\251\350C\352\371r\322\237PD\t\224\004\236\t(\210\330A}\300^J\004\376p\312\253\200\t\027\370C\001H\364\351~B\242%\362B|0a'\304\007\023rt\276\017?{\023C\304\"z\34274\322@\344Q"
+	.string	"h\210\246\304^\222n\207\236\350!\211(\n\223p\221\207\211<\022\210E\022;(\017\025\242\030A,\222\310\331\235@\215\210E\022\272\264\210Q\364\220P#\236\260\210\323t\330K\211x\230\242\340\003\026! \254\200\260\310K\321#\335\t\324\310\246H\017\b\016{#\354\320a1\355\rQa\022:\002\035\026Q \362N\240$\344\244\274\017\036\244\300\337\016)\030\034\201\207\223\336\304"
+	.ascii	"\036\024\242C\2424\030\034\022\355\244H=\"\357\350W\002\030\f"
+	.ascii	"\201\001\025\242H\211E\022?)\357\2507\"\370\333\001\211>\336"
+	.ascii	"OH\344A}\277\023\250\321\017\221\210\016\215\214z<\337\207\037"
+	.ascii	"\020:\354\251`4\354\231\350Iy!\354R`1\350\343\241H\302\244\036"
+	.ascii	"\021C\t!\022\017%\376\202@\236O\312\003Q\224\002\177E\374\242"
+	.ascii	"\242\020\034.pB\004\260oh\210\246h\022\021q\030$\002Q\"\021\360"
+	.ascii	"\327K\"\362\r\211DC\002@BO\360J\370x\301a\217\304N3\207n\307"
+	.ascii	"\231\361\210\223[\2439F\316M\023&G*Ma\352e\303a\\\342\246\324"
+	.ascii	"{\267\356\326\365\3121\352\\\265E=\t]\257\333\365uT\303t\273"
+	.ascii	".W\216\323\227\257\026^K\036/\230a2w\302rDybjAA\242\226\204\312"
+	.ascii	"\031W\305\t\311\375\261\313:\"\231;b\225p\024\267\263\026F\354"
+	.ascii	"\221\237\0259\334\330\024\261K\n`\021\367\324\262.p\325\2145"
+	.ascii	"M\262\352\233+#\b\013D\210\\\0318hn\240\\\300\352\247nF\n6_W"
+	.ascii	"\026\013\315J\006S/s\213\007\006\214\252e\2757\210-\301\rR\257"
+	.string	"\325\025\362\033\344?\2735$\311c\225u\362\231:\303\025\244\336\036=\356\217\rV\276\224\240\3655\347\343\367\007\330\2165\032,\324{Y8\330\2530Y\253R\273\361+u\343Ru\232f\346\250\245\361L\001t\264"
+	.string	"\327%.'o\b\035\365\320\321\345N\375R\275\313\334\2230)\260\3779]\244J\022)\365\336\345\357\216?g\027&\215\254\211\025\2769~u\330\210\321\246\365\003\307\237\303\343\243\213\331\231z\3573\205\357s#*\352\326\350&\031F\220\227\2312q;jX\300%i\374\326\b\203~\250\202\271@\311\322\034B\310\320\214\310H\222$\035\022\n\020\204cY\236)\252=\022\300$M\2162\307fDD\222\224\244\222\366\r\367\206\270\023\013\320I+\027\357Z\005\225K\360!\350\f\325\271#\354\350\246\312\017&\222\336\345\321\371!\327\263\024\363\206\022\214\323\026\351\016\302xU\304\374\270e\271\262O\2150%\220\262pn\f7\341\320*\tVL&{\344\264\324\230\f7\316V\b\341\267\203\246X\323\204)\245+\237\231\341\200\004\333h\375\032\253\030\346\374\177\322STM\317\221\026{"
+	.ascii	"\224\3622N\325\2622l\030R\214\315\346\032Vx\3261W\247\234@c\246"
+	.ascii	"\361\036\230\247\330X\371I\313\334\373:4Yz\263\275\274\354h,"
+	.ascii	"x9,&em35\2244\226\366WS\203\212\340\346||>\b2\242\2104\f\203"
+	.ascii	"\353\006N7\205\217"
+	.string	"\273\330+\241J\200\235\216\367y\227\274l@\215p\034\335\206.O\354m\301\214\234$5\300\201D\241\017\233F!\177\264\334\220!\214TG\371\303*\212\236\\M\234\274'\3118\376\374\023\026\223*\273\b \017\361\207J\246\324\343s\"6y\207\3209\316\305\374+j\210V\027\241\225\017\023\203\262\373\260\252\331\273\301 \221\t\206\266\203x\301\231\001>\211\033\262\326<Ny716fo\367i\016\261\223\244\346\350t\245\200L\214!\025Zbx\350)\345\317\355\375\270U\273\210\323\254q\363.\003\310\221\3376ld\365*8p1\314\307B\231\217\2052\037\213\3126?c\252\336\3544\235\271)\3722[\017\372e`\n\275_k\336rkS\321\301q\203\377\236e\213'\243\035O\325\262Q\002g\271F3\260\343SrDcG\356\224<\264\025\234\305\032\036Z\223y\326\b\300\312\267\031\233\320k[\034\376^\312z"
+	.ascii	"\247\022U\224\311EzJ\310n7\344\366\353\377/\032\2627(|XR\027"
+	.ascii	"\361\243eP*d\2008\316&R/M$\356\350\214\253\356~\033\036gx\240"
+	.ascii	"\206\271\253\202#\240\b\364\250\322\027\267=g\027\177h\326\276"
+	.ascii	"\220\302\241\216\006\351ze\323\370\241\027\024\256\037\373U\277"
+	.ascii	"\263\230\230.\366\271\026z1\333\343h\200\2135T\337\332`\246\220"
+	.ascii	"\233\353g\253\264N\257\370\376\024T\336\302j\314\202\034QI\277"
+	.ascii	"\226l\324\352\372\255\365X\302e\262/\004\331\204~\004\270\302"
+	.ascii	"\031\302.\266\351\361\315\3424\326\266\240\246\301\r@Z$\212\346"
+	.ascii	"\3760\255^7R\340\f%Le\300b\333\310\222+\314\335m"
+	.string	"\302V\240\335\305}\264\232\374M%\022\331!\322'\202D\020\270\215t\362\205\266F.\340\\9\302\342\332\272\273\3033,\355\342\254{w\347fW\370(\210\242\331\264\343\007\0030\330\303\234\273\361\274c\207\002\227\1776\306\\\370\226\022\215\272\013yiS\"\246\\\030\220dR9\002DAk\013\375\340\362\250p=NI\304\026\362\276\f\177\r\307u^t\025\355K\013Z\342G\266\003\001q\234\306\203\335\211\314W\236/\232\333\345\031`\276\231\037Bc\033s\356l\213E\t\\T\237\327\353xv\26448\364\030\034\355\261i\212\371\221\346;3\332)\342\251\224\260\332\366f\\\323\201&\370\374\205\353Q\006\326\375\210O\376E%]\371O\340\211+\367\310\006a\314+\353\366\226\364L\221'(\332\342\372\212U\233)v=\221\371\022K=\373\324\032\021\353]\273\334\204\003\260\037\355a\023\253P\216\223ZQ\314A\325\201\234"
+	.string	"C@\005g\253X\350K\005\340\310i\321\236p\001\032\334"
+	.string	"Eq\005\363qd\017K\310\222R\227+V\224Vx^\r\3544\023=\t\377\245\005\360\211;(\304\323\315&O\177[:WB\347`\311\315y3\341\362\315ep\302\363\326\360\336\030|\223-f\031\222e\016Jh\221\336\037\304\357,\355J\206\360\f\255\316B\033\006\222\227\323\211\277\222\260\241D\013\302\251\221\344g\231\005\270{\016\256-\031\341\3479k\320R2\212\223\273\254\307\231[x&\324\341\242\036'\257\202\254\204\330\374\206\276$\206\233\235R\266>n\322#\361l\317+\3600\320OA\b,O\2132t\344\f\256\017\0308\245\305\177\002\216B\273t`\030GQ\362\325\241\347\251.\354\272\204\221w\266&\217\033\340\031Ec9\025N\273\337\235\232\374\222\314\216\306/)\216\330\020<\262\002aB\211\316b4\025\bA]\013Vn\311p\024\341\\}\240N(\314H\320H5N.\214"
+	.string	"\225C\371\302\202\206BN\344\372!\037\301*\335/\215\213\177\214ZRg\363\226\344\032\261\266\327\370\237\250\016\225l</\202\366\030\022c\262\371T\204\255\006S\034\273\225|Ik\257\302\262Z\236/|\337\230\211\342\006\204KB\bY\300\001\271W\266\344x\364\250\276\274\324\302\227d^+\353\246\001d\214\370\253\271\347\342(\263]\242\201?7\315j\275#\017\337{\307%T\\3,4+@\003\261|=Sl,\266m\353\225\275]\311$h5\361{\260JH\243\033Ol\342\023!\034Q\242q\312\253\n\354\335c\206\261\365\266\362|\036b\222\212\224\321Z\004\375E\007d\246+\331\340\023 w\224\370}\255g\252}\"\375\237\360A\303\322C\361\322\007\023j\020v\344qt\252\234\2105]\304\327`\237kMsE^\307\007\013\366f\307u\242\312j\370\225A\202Zel\340\f\256p\023K\035\022\2277"
+	.string	"\214\246$\247\357\033\243\030p\317\277\321Z\365m\363\375\"Vua\335O\357d\021o\276\234(]\310F\375\373\316\372\003\334\021\365\030\235\f\220\370R%h\215>\322\317\277\323g\t\242\305M\331Q/\200\f\223\307Kd\225\322YtJ\201\030T\250\361g7"
+	.string	"k\335\225Xd\313\261\307\375W\360z\337\224s\"c\20133\f"
+	.string	"\004g\306\\$?\27644\350\273\213\003\3649\023\340p\220\001'\006"
+	.string	"\265\356{"
+	.ascii	"\231\363\340\260\344\222\031\217F\235\321\342\310?\360\236\343"
+	.ascii	"}ox\003\202?\362\274A\002\023\337\256n\300\355\310\b\227\352"
+	.ascii	"Y\260\r%\377\312\361\307\231\352\311\013\022\223\333O\320\353"
+	.ascii	"\356\336\024\r\365\207\3468\030?P\357\310\322\002\345\315\264"
+	.ascii	".\354H.d\037\022&\267\303o\231\301\236Yq\303\2327\252W\213\217"
+	.ascii	"N\370\263\351\315\340\300t:\035\216(?\255\255\266\346S\312\301"
+	.ascii	"\375\007\361\230\320\007\315{\260\360\345\n\023\373\021\323\034"
+	.ascii	"\321M\362'\305\0329')\232\242\372,>\037\fp\317-2'z~\316\374\351"
+	.ascii	"\315\206\377\017N\377X\357\317\216_\333\013\337\230\247\355\216"
+	.ascii	"}\017\343\355\376\221\207\027\023\034\fxy\362?g\362b\357\370"
+	.ascii	"\270\313\375\344\236\307]\037`G\266\031\306\005\214\223\321\017"
+	.ascii	"\217\346\354\367\242'i,\377\243\322c\261\311\360\316\264\224"
+	.ascii	"8\236\316\324\307\327\210\013\311\031\316=\336\355\327\032b\356"
+	.ascii	"\352\335X+\234"
+	.ascii	"7y$mz\005'Z\001"
+	.text
+	.section	.gnu.lto_.symtab.2fc6841204fe48a7,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2fc6841204fe48a7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
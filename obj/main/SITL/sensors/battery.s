@@ -0,0 +1,1630 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`,\002\255\016"
+	.string	"\324\022 \003"
+	.string	"-"
+	.string	"\301\233\246\206\004\024\002"
+	.string	"\002\001\002\003\002\004\005\002\004\002"
+	.string	""
+	.string	"\002\004\001\240\342\234\212\n\002\003\004\335\317\263\315\007*\002\006\002\007\002\006\002\006\005\002\005\005\002\005\005\240\342\234\212\n\006\007\b\t\246\300\251\343\t\002\n\013\361\312\235\227\007\b\b\002\t\r\253\353\330\347\r\001\016\017\273\373\273\233\t\004\002\n\002\001\021\214\274\367\363\001D"
+	.string	"\001"
+	.string	"\b\002\t\022\024\313\322\375\213\007"
+	.string	"\025\354\206\342\366\026\027\030\234\236\237\233\f\004\002\013\002\f\031\361\220\342\261\005\032\373\222\262\354\016\026"
+	.string	"\r\002\001\033\034\376\211\224\300\t\f\r\002\001\002\016\002\017\035\352\263\360\321\b\037\226\213\357\351\r\002 \306\371\276\205\b\006\002\001\002\020\002\021!\236\276\234\317\004\016\002\003\001\002\002\002\"\314\344\207\235\n\006#\212\201\226\371\t\002$\307\200\351\335%\300\253\277\314\017\007&\317\356\361\267\004'\350\300\306\254\005(\307\266\257\307\n\004"
+	.string	")\250\267\374\351*\207\312\266\244\016\002+\320\374\270\356\001,\325\241\220\227-\225\323\372\331\001.\273\345\330\325\r/0\240\342\234\212\n"
+	.ascii	"W\250\261%Af,\245I\253\001P\202Rce\036\021\300\2753W\013\313"
+	.ascii	"\276\001\f\214\002he\350\262o\306\007-\322\260\375\261\204\235"
+	.ascii	"\313\226\025\361\034\221&\207D\037 I\331\r}\376\346\277`\352"
+	.ascii	"f\352\312!\214a\336\031\t\350\t\312\205V\335\263\234u}\\w\225"
+	.ascii	"\316\246R\242\320S\235\276\315\313\321\177\343e{Q~\364\311\207"
+	.ascii	"\365C\2334\373\033w\300\027u\030\030\222\276\236\307\306\020"
+	.ascii	"r\222y\2403y\t\372\367r\022\023\230\241\310\177\347\363Q;*\244"
+	.ascii	"f\316\236?\0300\021H\233\320\376\0324\376\025\317\331EM\216\t"
+	.text
+	.section	.gnu.lto_.ipa_sra.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \310\305\003"
+	.string	"bE\021\034\2407\303\001\377\377\377\377\377?\216\375\377\377\377\377\377s\233\211\310\t\021\201zS\223).c\027\253\330\304\"\366\260\206-,a0\005\201\005\034\3564\267)\227\264\321B\373\254\263\r\263e\225\231LD\325\346\262\021\025"
+	.ascii	"F\205\371Y\200\363.OK+\026gN\340\027\256`\007\216Me\222b\001"
+	.ascii	"\240hQ\342pF\320\274K\224\231\234)\260ae\360K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\347\003\245\r"
+	.string	"\026\320=: \223\322\001@\364`4J\252\026J\"\341+R$\230\013f\375\306QSt\370\353a}\200\320\r\022\025\003!\\"
+	.string	"x\t\030\"\\7\221\341\267J\211\246\227^\2154\"%I\001-"
+	.string	"-"
+	.string	"0"
+	.string	"v\270\337\262f%\355s\200\247>59\253\216Qcj-#\034\346\324\032\352\377w\266\250-\330\253\324P{\023U\006{\225\240\r\232\243\005KR\272p\266\223\231\025\214\213g.P\333\243\2657\201mG\213R\262\343\"0i\377O\223\332+n\354\237$\017\250\024@%\262\267\221]N\2658\333_h*O\310e2\306\325\001zI\3010H\366\374G}h\020\215\tK\301\t\235\306L\b%\017\325\345|"
+	.ascii	"b\207\2726p\2525\006\276\260\250\240\020wB\002\025\241\\\310"
+	.ascii	"\020\"75\026\221\037V\376{>\375\374\363\244\362\317\222\035\276"
+	.ascii	"6\377\334P\362\237\013n\260\312\314\020W\250!]\207\202\241a{"
+	.ascii	"l\006\200\002\231)2;\022@t=\001\"\031\003\r\022HE15\371y8mtn"
+	.ascii	"\257\375z\262\200^*E\366D\331\332\177\240\304\311\035\215\255"
+	.ascii	"M\2177\365\260-6\t\313\005t\344\023\307\211\340\302\035\256-"
+	.ascii	"4\272\227\2346\356?\036\fk\242>\261\"\022\026\233AJ\220t\231"
+	.ascii	"\242\256\341\200C\322\230\242'\227j\020\f\351\231\030&\252\203"
+	.ascii	"\001z\006LUi.\025\227\234\215\347\305\207\023d\311\020\212\253"
+	.ascii	"S\333a\020\036\237n\300\336f\n\341\256\305\305r\027\024F\343"
+	.ascii	"\332\251\032\361Zf\3515\254\237\031\351\027\0043=\202\274\264"
+	.ascii	"\213l\366\314\037v\226\337\351\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"\325\006"
+	.string	"R\f%-p\305I\007\004W\241\323su|\200\201\377\203\253\337#t\377\177Q;\327\377\367\343\201\177\340\037\230\365\035\375F{\206o\330\022 m\313\024\177\3461\177y\313W\236\362\223\227|\344\207\374Q\2141\266\234\262\331>~\3077~\306\223\244j\\\346\023\343\201"
+	.string	"\006!\204\275\300e_\177\220\205U\377\342\025_}\342\021O\335\230\177\270\004\355@\277w\343\262\275^\256\275\\\366\200l\331T:\371\324\350\r_\200\240\266\354i\313\372S"
+	.string	"\227\371\204\333\224\317i\267\256A\034"
+	.string	":\206\343\243\340\354\026G\317"
+	.string	""
+	.string	"\271xs\236\305JP\357\013b\302\300\254\263\266\2545\264\006\337\316\020\201\237"
+	.string	"\004x\240L\032\254Pj\233L!\307'\211\250\016\376\264\b\232"
+	.ascii	"q\321\314\001\214^\200!"
+	.text
+	.section	.gnu.lto_.pureconst.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 YM\002"
+	.string	"\222E\021\032\200k\032\0033*\311\300<\240\t\212\343\271\357\373n\315\347\251gS\242\325\fd\376p\2077\234\341\013Wx\302\021~p\006Wp\004\037\270\300%\027p\200G\016\371c\304q\215c|q\212K\234\256RUA\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"\375\005"
+	.ascii	"\202G\026\036\240)\303\001\377\377\377\377\377\377\3773\355\277"
+	.ascii	"\265\204\220X\022K\310\336\335\036\251\357\326\232L)B\036\213"
+	.ascii	"m\344x\032*C]8\021\004=\316\252f\371\231;\233j%DrP\335\005\305"
+	.ascii	"\266\331N\320\201\323\32361sf\233\020\004\224\255\033\346\313"
+	.ascii	"\2462_\3335W\003\230x$1 \300\002\231\262\333\230R\"\214\257\241"
+	.ascii	"\016\306\020Yo\204!%\351}\020\237\007\253[>\027\b\261q\rF\\&"
+	.ascii	"o\204\216\223\356\021\3260?NeE\002\320\270c\027\r\347\3115\332"
+	.ascii	"13\214m`\232\307q~\255W\\\350\005k\217\256\030q\320xQ\341\201"
+	.ascii	"\204^\360\026\214\371\nu\004+\032Yh\305u\003"
+	.text
+	.section	.gnu.lto_.lto.8ceae77c9d7bcf30,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.45.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bb"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\034\213\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.47.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \253\025\004"
+	.string	"$\006\236"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001(\017)\001\n\005\001\006\177\177'}\001\002\005\001\006{\035\001\344\036#!+?\202\210\200\320\002yw\312\001u\311\001s\310\001q\307\001o\306\001m\305\001k\304\001i\303\001g\302\001e\301\001c\300\001a\277\001_\276\001]\273\001[\275\001Y\274\001W\273\001U\273\001"
+	.string	"\016"
+	.string	"@\004\356\244\320\230\n:\320\366EX\315\023G5\005\302\300\th\007\004K\031o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.48.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\324\001m\020"
+	.string	"\226\035lG\340\264&\035dl\3613\t\320\007\345 \022v\304!\350\261\311E\344\3770\274J\023\003N:5\334n\273[\253c\036\277\201H\357\303\230\336z*\376^\206@\202h\r1"
+	.string	"\223i wS\367+w0i{\223-S\nW"
+	.string	"R"
+	.string	"\\"
+	.string	"/\315K\355\005\346\245Y\366\221\313l\366\263%2>\206v\227\2131\316\372hJ-*\313g0\243\b\214\265>\332T|\312\224P\2312\323\256s-\207\f 0\226\342Q+\005\2750B\212\275\264\024\232!(Nb0\325\221\204\335\265\202\261\023\367v\3330\266!\330z >\217\367\370\374\233K\303\304\350\301K?f^j\2140\303\204\006'\307\245E\266\354\245\021\206}mw\327\261\306~\316?\243:\252ZI-BCH\024\020\331\235)b\262\241\004R\203d\373j\177\307qX\317\031a"
+	.ascii	"\273.xzve\016\334`\273\\\020\031tB\030\213E\021\260\243#T\237"
+	.ascii	"$A-4\002z\331yL\333\256\353\240\277\363\037\0326\230\364\240"
+	.ascii	"i\236\246\335u\b\200#$\021[&\251\355\001\245\007}\262s#|\305"
+	.ascii	"\2267\2335\261\273(\034~\226H\250\245MN\003\244\t\343EL\215\006"
+	.ascii	"fE`\252\304\266\3523\020\333.\354A_K\207z\271\260Ju\236\007s"
+	.ascii	"\032\340\223J\b\257[\255L.\334\347\251\276T\367q\251\027\023"
+	.ascii	"\212;y\037\247\222\300\252\017\235\307\255T*\217#\311\\\3276"
+	.ascii	"\326x\002P\350\212\257\021\002\265)T\210\2615\365+3F\227\377"
+	.ascii	"<\310\212\177c\013,,\3632FiC\b\321\nY\362\3511\206& \200\002"
+	.ascii	"\2411\354\006CC\217H\214k(\020{s\355\022n\315\360\2363\021s\236"
+	.ascii	"\363\256\177\354\030'\331\323`\\\335=\270\333~C%\216\033\n\235"
+	.ascii	"\027D\373'`\304\200e]\300\206\350]\257\263\266\215j\330E\274"
+	.ascii	"F\207.\331\220\350h\244^fJ\351\376\335\210K\240\021\016\024"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.49.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`@\0015\r"
+	.string	"\346\327VC\020o\234\016\217\367\341\002\001D{\374F\205\225\251\305\007\017\332\b\351\031~\275\006\030\032\006\214\022\234\230\345/\003~\262\272o\f\303!tm\300\025P\201\212\200"
+	.string	""
+	.string	"r\265\030\201\220\244\3222GD\233l\231RC"
+	.string	"@"
+	.string	"E"
+	.string	"\237\317<\262M\036\256\266\242\372 !\004ew5\271\341\243\317K\352\310\327\215\024\037\350}\032hq\275\343\027\210\326\370\201\027.K&\214"
+	.string	"\213\244u\001OR+\007v\327\372\201\025n\354\266\025\330\316\330\337\b\020B\372\357\323\017a\237R\036\344\232A#\205\372\300@\322\321\016K*U\366\3458\216)\226)[\325\022\313:\274\310\224\354N\030c\2548Up\260}\377\343 \242{X]\260\330\335\354\323\026\331Y&\351\371$~A\021=\225q\026\tk\205\024\361O\250\365\333\223\b\307j\b\361K\330\304\262\353\035\365\203\260O\035\260\021T\036'\273\213\371\b\037eY-\205\r\027\323\361\004%\034)'&\235a?|\b\220\257\341\346hB\\\347\363\331,\320:n\353<\235N\3630\3304\3208\\\247i\nxs\320\341\264\317\266qZ\026\222~\255L\031\201\007\221$K\276\210\377\332\335\235\225\021\013&\036`\004\274"
+	.string	"\250\345\033f?\350\364\237\005\240\200!\006\036"
+	.ascii	"2\241\233i`\\H \027\310.\340x\252A\201dK%\031\016|f\253kl\002"
+	.ascii	"\202\201.=\225m\321\235\0363\0273\333Hfc!\325v]P\003\312\304"
+	.ascii	"K\023\343\234\203)\374\345\220\2461\247\032\005Ntny\002"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.52.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`U\r\355?"
+	.string	"\212i\030\027?@\242N\007\347\347\317\365\356\366\t\3633\321\246\315p*\370\347\267\025_\317\347\333\340\\\275\256\205:\330jY\376\254\370E\277\350\237u\356\327w\177D\3065i\361N\356\232\325E\332\226{\247\224R^\001@\001h\001\327\371^\347uuVW\347W\235\375\235\233\204\221Y\234\2515m[\244QP\013g\345\263\322`\272\307t\353u\363\265\312<\227\344\203:\376\030;\222\301#\262\247m\353\246\216{T\364\270\315<\033%\212c\270\311,\251\330\332\266\305\353<\036=\307O\004\355\311\2039\371\245\301p\337q\322n\331t=e\037=\307QilisM\307m\327\322\366\342\243\353\330\317)\254\256%\273\211ou\346\034\364\312Q\307^\235Zy{U[\351\366\312\354\2039\331\353M\362\222\331\260\353\330\332\276[d\336)\266m;\365Sz\331"
+	.string	"\232\230\224KJIHGFEDCI!\344\221\275\253\372\276\344>0G\330$\373\321"
+	.string	"\236\335$8\366T\225Q+\316\244\204S\235\236\004\307\336|\311\255\225\334\222\250Tq$*ym~\004\307\346F\252\022Nm\0207\346\304\213\330+\023L7>jepM4\2446\330\203\306O\013\216\241\251\312\"p\315&\236|R+c\322BL\372\372)nl\211#\331+\2652\264>\236\305\215\2319\033e\372]\223db\256\026\221\001Q\235\332\266\355\2750\177UA\2345<-8\226\246\nH\373;\322\321v!d`\356\354U\333\266\354M\262\262\346"
+	.string	"\315\334}\314L\305<\224!\336\310R\237\340/ \223\221\352\235\036\007\334\037&c\243=\331\024\327\005\017c\032\b\365\013J\264\034A\250'\372\342g\221\353"
+	.string	"\332\263\247~\324\007P\022\225\372\250o&\243\211\206s\342\330\266aU\334o:\020E\n\025*n\257R_U(\355=^\321\177,\216m\333Vq\267i7-\270\335z\345\027\\\\\267W\252\357\275fP\346\007*m4}\342<\371\206\272\376"
+	.ascii	"\224\374\231\002\2069 6jll\034\324P\267\337\277\305\322\300\332"
+	.ascii	"\257\325\304\340vc\0313\274\2333n\257\375I\301F\250\331\2277"
+	.ascii	"2\327\201\371;\231[m?\n\363\352\274\205t\036q\235E4\230\346\020"
+	.ascii	"\327\031\004\353\374\341:k\261\316\036\256s\207\353\314\341:"
+	.ascii	"g\261\316\033Vg\r\254s\206\325\031\353:_\365\230f\f\327\371\002"
+	.ascii	"\353l\341:W`\235\255\2563\205\326k\236p\235%\260\316\021\256"
+	.ascii	"s\025\353L\265:K\261\316Q\2533\024\353\274\340:'x\272\316N\327"
+	.ascii	"\331\200\352L\240\371\232\233\216\316LGg\345\352\274\264:+\261"
+	.ascii	"\316I\2543\322\352|\304:\033\261\316E\2533\021\353<\264:'\257"
+	.ascii	"\263\320\352\214\\\235\217\327\231\rE|l\371\266\264\262\304\202"
+	.ascii	"\345\366\212\354\363SLL\032\"\267\204\336!\375\320'\375\005<"
+	.ascii	"z$-.\244y\364\020"
+	.string	"\246~P\251\221\007a\261\344\262\204.\241\267\327\037\324<,\372\2417\372\353'\026G\364E\313\250\003\3610\242\357\273Bi\362\207\374+\371\035m\251\2654\213fDO.\364\314K/X\336Mv\n\373\037L\340\205\370\240\177\230\214\215\ru\233\236\200P\341\234\226\241wr\317!\246\t\035\237|\f\221O\337\364B\n\334-\244\332\264\260\273\300E\376\326\2633\315\002i@>\213hf\321\354\270\330M\177\374\036\320@&c\362\235GrgzB\037\345\310>T\023/\3237\354?\275\367a2F\365}\366\007\314\021K[\277\352\357\337<b]\324_\231K\264\237>\352w_\253X\344\340A\245\310\177\356\303F\314\352\240\245u{\355\361$l\036:\321\221;;\276\223O\334\377\256\251\035f\020\255\307\360\237\235\336-\332i<\"\336\257y\370\025\343\026&\215\334=\023\331\256\f\2358v\260)|\223B/v\210r"
+	.string	"'<\205w\320GLQ\302W\375\204\037\340'v%\302K\370f2\352\361V\023\322\211\360\036\246MZ\365m\246\325\350\027\303)!\036\330Y\231\301\353\364\006\036\306\364\317\233\375n\2027\360\001\006\211\305\201\005^4hp\275Xu\260p~\361`G\027W\216\034-\\Lyu\335\360\262\301\3455eCF\213\032S/\272\274\246\036\024\340\0338\270\272\246r\334\270\3215\225\254\373\352\217\302[gp\276\036\f"
+	.string	"\3233\363\003\267\253s\277\346\341\210gR0\235\003F\210\307\370\345\215\"~\304\367\264\375\355\216\331%\304\213"
+	.string	"\361Z\037\342\303\203\330r)\335\007\017\2575\345\025\036\355\342\341\373N\371s\374\271D3\222\300\276\305\271,\235@Y\256\255\335\245WfY\372ump\321\254\341\232ip\232:\353*\275\213i!\226,\247\226\322\257r\203L\376\326V\344\220`\201O\026\327\215E|\243\230\230u\333\336\230%\372\024W\342\316\216\266\003#\200\317D\345;\331\225\242\272\363\3728\bh\230$\304Aw@\320D\213.\275\363/\b\240=J\037\205\303Wx\030Y\317\001\353\263\276\325\030\322-\346Iz'ox\253\2071\005\324\360\033J\370\232\253i\020\323\027\b\021)\303[\005b}\206\316c\023\376\304\t\326w^K\361\371\201J\333\310\224?t\216\256\224\205w0\374\325\205\257\360\030,\374\205-G\363&\026\254\276\302\030^\341K\374\314\352\233L#\370K\222\230F\347R\316\350\3213\352\030\267\337"
+	.ascii	"\032\227\227\312\235\235)zg/\333\2468\222e\333\221\251\232g\342"
+	.ascii	"`g]\346e\025'\313\"P\307\003\201\035\250\201(E\021S\250fD\222"
+	.ascii	"$\205,cA\005\204(\310\244<\017\022\200%A\311RhLN*\313\376\033"
+	.ascii	"s\260\275\007\273\210\020\305\244*\223\360m.\001j\241\207\200"
+	.ascii	"F8\304\233\363\367\032\352\377\256\024\352\273\311\003\304\277"
+	.ascii	"j\330D\233\t\216)\227@\336\036\303#\307\030O\301\336\261n/\365"
+	.ascii	"z\341\366\372!2m.\221\236\030g\002\320`\244\362\277\316\244c"
+	.ascii	"\022\377\317+g\246t,\367\211\002Z\373\334K\007\226\234Y\242r"
+	.ascii	"mXJ\222\232\267\221#\007\235\030\342e\024\036\247h>\232\374\005"
+	.ascii	"VfL\323\030\233&\224\243\374\004\303@+\315`\350?(86\376\203\254"
+	.ascii	"\207\266x"
+	.string	"\325\rE\371\220a\301\317\1775?\210\345\3552\343\370?\240\215\227\233\261\200b\254\016B\207\3107\354\037\312\362\232.\234\257KX@\205c\206k\254T>Q\n&B\205P\204\216\217lK\300r\247\215\362B\325\235c\312\334\276w\325zs\0270\b\377\315\302\f\374\007\324\02590\244\376\315\021\223I0\022\261\202<I\2703\264c\2742A\035\260\260\231 \301Zy\2613x\020\243BY{\240F\\\236\213\377\036D\272\236\365)\306\254\254\301Q\353\254R\232\271\023/\360\340\024Z\007T\237\022\274\247\273\350\301\364\002\267Q\265~\211E\264\366\202&\366\037\002\275\317\326\334\252\357\371#\t\220\232{s\217\t#\264\245.>\370\003q\022c\034Bq\0308B5\317\247\274P\353\013\272\006\006\252\376~D\243\207+\030ewa\2406\241\023\304\026p\n\374K\365\344w\273\251~\270\355V\t\222\255:\221\332;qV"
+	.ascii	"\304\333&\324\2615\327\235\362\365\305\215j\213\364\342O\217"
+	.ascii	"K3I\236\312\374\217\371-\251\b\244\272\307*\370\335\377\207\367"
+	.ascii	"\331\223\265\200~\237\326\317M+\004\224\211\\\223s\311\356\r"
+	.ascii	"\036\257\306X<\203\037\323\004"
+	.ascii	"\270\0161\265:\370#\256MzE\376T\263m\3544\376VY\340,\002H\006"
+	.ascii	"Co\027V%\211\271\341\271kV\206Qu\030?\210K\362\333\353\275:\262"
+	.ascii	"\261\210\324\212\250\001"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.53.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\203\007\315#"
+	.string	"\266=\327I\220VN:\007?\364\212\225\302\200\034\037\276c\320\325\017g\346\301\337\017\257\314\240\327\032TA\206\314\336V\263Q\003\230\247\222\261h\233/\236\002\022\220"
+	.string	"<\t\221"
+	.string	"\214\245\\\037\013\330\271\273W\335\337\314\314\314ZB6\221R\246\276"
+	.string	"\254"
+	.string	"\310"
+	.string	";\224\257\253\374\\\345\243'\377\254\374j\362\315\312o\223\317\315_\002/6\316\f\304\245iT\\\226\324\254\212\305`V\366\322\310\342X.\017{\343ul\215m\353\357\341\347me\336\233\376\345*[\244(\213 \307.\2664M\207\315b\233\026\370\363\365x;]\016=\253\331\334\364E\205t\310\244\323\002\177VU\354\353Q-\217\352\004\357t\253%U\202s\346"
+	.ascii	"*C\260,\023)\023f0\n\006r\267\026\200\226\324\024\243\250\320"
+	.ascii	"\t\340J\204\325V&RV\274\344\0076\177I(sgk9D\362\211\033\305q"
+	.ascii	"\2274\236-i\232\356\225\224\225\311\250P\232\246gdR\304\276e"
+	.ascii	"\377\025\376O\360\243\301\337\027[o\341\350\350\334\312\215\216"
+	.ascii	"-kp\0259\356\353\265\300\031fN\374\266\335X\013\366\r\302 \220"
+	.ascii	">\276?6-+M\361\365\345\361en1\234[\317\310\364X\226\265]\377"
+	.ascii	"\227=\002\b[\232:m\025#S\001;\037\030\356\337\034\253\003\303"
+	.ascii	"\367\305\221\210\274\310\255_\342\271u\373AZ\215\251\"\307\375"
+	.ascii	"J#7\326\277f\332+\376\312\017B\371?\225\357\203\362yP"
+	.string	"\276\216\311\3171\3718(_h\362o*\337\246\362kN>\r\312\237A\3712\225\037\254\374\230\223\017S\371/&\337\245\362[L>\020\345\377*\337W\371\275\223\317C\371\001\300nA\203\002ltl\255\307\366\302\312\320_?1\323\220U\212\277\356\t\03333\266\323\331X\337&:\025Sh\250U\237\366\365j\335\311\236\354\354\265\257\205iPZ\274\356)X\263%\274\336\255\r@U\245V\205\203\353\247}\032\275r\204\323\365\256\177z\225k\312H>\t\361\345u\303\377\002\006\274\310]\357\030\333\351\337\262E\322\240\203\003\007\347V]\327\261e\333\225i\232\232\215\365\334\225\216$O\354v\264k\347\232\006\f*\313\310q?\033}\260G \344\322\364\251\300\267\310\032\211 a\302\204s\353\331K\346\202\313\354\272D\226\254\210\302\320\320\271\325\354\335\2016\305\335\275G\270\237h\305\212ri\232\026\370\n\331!F\001\277"
+	.ascii	"\264\224\341\210i\3030\211\210\204D,\262y\021\020\007%#&&\242"
+	.ascii	"\n\303%%\342R\222\321\3220\351\210\biX\244\2644\004\3029Q\203"
+	.string	"\221\322\220\211HT\032\362\224\3055\267WlmNl\313\254\330\306\357\216\275\220\t\324\341\243N\367\210\235\340'\324\211\027\r\265_N\343\364^q1\247{\320\2468\215\303i\224HW\033\220\355\211\221\360\t\337\204\335\023\366\326\373r\203\343\3354P\311\023\273\261\3354O\306[\033\331\231\n);0,Y\202Q0\220\272\240\266\331\263\255i\233\026^\241\351\232\003\253f\205\306\352\006O\007\311\364L\363\364r\315\364\016\025\231\256ckmS\003\252\220\214\310\005\273%\246_:\3304d0\035\263L\203\351%Cs\351\227(\b\206\\z\273\\\004\200\233\250a@&\221DC\")HJ\222a\r\340\002\031\241\251:\021\020\245\203\n\241Xh\243}\003\013'%\030\2172R\277\007\222\256#\036/\227\301\242\272ua0Y\225\311\275\341R\361\313\310\334S\343\220D;c\233\230\317<\225\347\371\034Bw\027TAc~"
+	.string	"7\003\271tU\276\231^L\215\303\020\376l\305\251\336 \356AlC\036\201\213\262\252\354?\351\365+2F"
+	.string	"c\337\211\333B!\364e}\235\373\325\364{\006\236L\363\210\250\224x\372\275~\005\243\032\t{Z\314\303k<\276A\r@\t\335\333\252\370~\025\321\"|`SA(\331sk\017\306\201\240)\256A\341\230c\360\372\234\030\020~\035\2132YS\270\005\306\017\257\377\316\257\305\365\367\243\331\310\276\262\306g\254\242\320\202{8\315\353i\tgeG\"Qz\347\352\022*\025\n\341E"
+	.ascii	"4/\340\032\223Z\346\333bX\244\264\024/Zt\237\316\033\002\276"
+	.ascii	"\310k^\202\334\260\034\330f\260\\\016\310\261\233\205aGV\003"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.54.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\366\003\325\031"
+	.string	"\206\356\243H\300XM:\360\021\261\315\204\203Q\315\2208\241B0\355\300R\f\240\260\246eR\1775\237\027\346\020#\267\374\365\3753D\267@\333\n!\332\352\260\330\030\333\024\005A\266do\004\315\337x\300n\371\303\304\022B\366&r\247\024\213"
+	.string	"\201"
+	.string	"\227"
+	.ascii	"\276\261\303\317\207\266/\355\353xQ\316\215p\f\326\372B\251H"
+	.ascii	"\2559\b~\360}\"\370\212~v\217\241\237\316\261\257<'\243zB.z\222"
+	.ascii	"\244j\255\254\215\361\234\253\300\317\243\263[\231\343{3\240"
+	.ascii	"\317M\347\252\004\2407\363\302\304\212\177*j\224H!\275\036IQ"
+	.ascii	"|\2067[\200\333\b\331u\rpM\200\002\334l\335\352\t\214*\341\215"
+	.ascii	"G\356S\211\025\035\202Z\353w\\\222\270\325\244\364fj\255\226"
+	.ascii	">7\023wx\3337lW\260\367)S\256\027\264\204#\205\254\265\352\354"
+	.ascii	"\216\206\362\027\375r@j\342\221\\lw\270\217\327W+O\004\277\307"
+	.ascii	"\223>\370C\237\206\305\344}>\375\030\375\374J\030\203"
+	.string	"pEF;r\312\316\325\344\216\366\273\272A\266'\275\242\32217\372aV:\\i\225'\rz\322\237'\355y\322\224J\317)\335M\351\355\244\345J\177\300\202 \034\013!\031\033\225\253?S]\252\3234B\303\347\361\243\233\347\314`t\302\351\370t\337q\001G3t\262@\211\331\325z[z\276\314\205\331\230\375\321;\033\267(?1|\020\325\344\224\237\3408\315\235@Mp\334\333\261\310\273\025\235\320\276\246n;&%FtG\250\323P\233\302\227\320(\t\201\220Hi\201Y\333\302\231p\220\\\030\211pE,~\032=B; \305\b\b\265$\245\305\301\321\217$\3634\272+\271 Q\301p%\332Wk\215\340\0179\221\f\0326l\240\237\273O\022\272\231F\374\020u;\312\327P\271\"\322\224\003y\220\032\177\310-\227\213>\366 #\003\361\232\321X61\030,\326\" \243q\301^\025f6.Q\244\265"
+	.ascii	"\270%#Bt"
+	.string	"\315f5\034X21&\263q\311X6\257\032\030\253%\312X2\006\034\013\341\022Y\263XLd\205\271\235wu\203(\234p\332\331\232\352T\246<\207\220(\037,`\270Q4\n\244D\261\342\203e\207\311U\033\356m8pUK\233nZ\034\251\337\202\313\300\213-\307j\275\375\266\300\026[\r\272\206\272\227\250\267\006\254\330\210jK\327\353\"D\251\347\213s\265\326oGwOCS\237@W\033K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.55.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\230\002-\022"
+	.string	"& sG\340\320(\035\332\2030"
+	.string	"\036\231\363\207\354J"
+	.string	"i\351\022\361\246.\031\212\355\030\231\034zvj%\245\377{\264\177\034\021%\254\252\372C\375\204\371\001\201y\022\241l\203\370\300\023) \334\225\211F\220\260\330\310&\204H\231R^"
+	.string	"Z"
+	.string	"]"
+	.string	"\337\273\227\374\262\215~\013\261\221\246\307e'\307\356\202\n\342\257\177\220\276\350u\234\346\313\217$\244\031\215\345\037\"\244o\350\205\003\027B\342%&c$\361"
+	.string	"#s/"
+	.string	"\315\245D\273\220]Kr\262T\333E\206^d\270\220\335\375\315\023\003-\226\031Iv\3279\243\301\334\245\333\316\261\315\300\316\226)?\261\372ve\013\374\333s(\3705\357\334R\311\317\336\371*\336\273k\224\315\320a\203\345\221}\213\245\326\354s\2533\366q\356\310\2459.\255\232\316L\277$\200\005\214\0064v3\034\361X\241\356\307\3468\267o\302\267%P\360:\316\312\267#\"\017\215\317\215\335\233\201w>\020&&\336\273(\303F\016\034\236\326\374\236G%\360!\206\016\021H\332\246S~\026\365\266\337FC\007\241\230\262\330\267\335\355V<U"
+	.string	"\266\2538\317\212_\343\020\205\362\336\251\276\210(\006\226GyNk>\212\227\232=RO\201\262\223z\024D\271\273,\2525\337\202w=\321\251!\313\035\266\003(UJ\2252\245\204\017B\224\311\245\nO\254\320\301"
+	.ascii	"\237F*\260B\227\313t\002\266X\253\226*l\201\252\224)\005<\261"
+	.ascii	"Z\340H\001\257&\204,\320\265Z\261\300\322\rv\235\361\315?\240"
+	.ascii	"\026B0\215}8\2103\n\"\335E\021\310\356~ZsTN/B\347\005\204\003"
+	.ascii	"E\370\341\024\301\206\242\022\266\230/\361|\237\257(\221\020"
+	.ascii	"8 \320\002\251!\363\263d\221\263\355o\262\237{\333\367n,\256"
+	.ascii	"p\344\346u\3672e\241-\334^\2755\3541\b\305\225/[\371V\215\270"
+	.ascii	"\360\255\273\360`\375\222/\372s\233U\244\313\200\354Y\246\322"
+	.ascii	"\356e#\233\371\250\332M,5\024=\036Q\203\006r\202\244\025\311"
+	.ascii	"n\321r\\4ap/\2702\234\263\002\023\334\202\033\355\205\241\020"
+	.ascii	"z\273\321h\365\325\243]\207\217\3452"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.56.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\b\001\305\f"
+	.string	"\266\327UB\020Q\234\016\030\016Op\215\0020^\246\241\210\275FD\320\337\212\001 \246S\206\200%5\372dM\203}\255\244\01660\331\223\322LF&n\025\001&\027\301\230c\rG'\216\256"
+	.string	"\354\273\321&{\247\024@"
+	.string	"A"
+	.string	"D"
+	.string	"\340A$x\262\273\301\004\311\256H\300\003\260\323\313\001X\247\325-\326\251A;\306E\017{\024\214\n#8v\267\316\016\007/A\377!\237\204\244\320\345\205`w-CR\351\236\267-\300\366\001\373\032\002\037\366\224\306n\272\257\237n\353 \177E\261\224\274H\340b\367Bj\307\2164E\210\233\376\223}\321'q\221\023\350\222\"1\200\231@\337\322\336\202\016\224\214\222]\021s\352\002\330\351+\266/\355\213\370\210\024l\214Nh\327|\215\017>\352%@>\b7\330\344\303S\177\263N\255y\221W\0327rd\020\311\224)\262\232v\207k1Nx`aaI\373\003A>\264T\261b\034\315\220-\206\344\344`\277\332\335\365\f\033\215\344h\244\307@\353l\013>\217\326u\237\314\303Y&B\247}\337\206S\275\216\363<\232W=\333\246S\263\316\253\231"
+	.string	"\346\034h]\3758\256\253\025q_\355\374\260\202\031\243h\216\214M\024\331C~\f\327\264&61#\001\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.57.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4`m\322\001(\033\314\210\232)& \275\230\226\375\023%@\350*L\233\267\026\265\264\260\222c1\325#\364.+Q\001N\263@\350XK\240;b\311&{\247\024\266T\030i]W%\001N\031\347\305\232\360\242PY\200\0269a5\340\310`Ix\305(\341T\367\316cs`\322\356\346\324\337xm\360+\376\214\301\332\351\237\217E\177\004\033\347`WMs\022\366\241u\036\273Q\037\021\004\220]\210\023\223\ry\037\026\2663\366\344c<#\343L\240Rt"
+	.string	"H>\017\035%\273\025\272> \372\223NE\177n\342\331[\346_\343\320\205\307\b\345h\336(\007\273\353F9\235\333\335v\201m\003\333\021\001\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.58.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3pM\322\001\240\253\0163\360\030\f\277<d\316!O\204\3020\214\260\376\326\220\266=\034\031\265L9\251\231\373\337\365/,\243{n\f\0037\226\354-eJ\001\306X4P\252\252\313\302\243\340De$\352e\030.\r\017\003\251g1\360\344 \301WM\023|Q\334\353'\265\342\321\007\373 \217\226\257a\315&\177\335\371\033\350.5\240\302\223\231\035;\251\027\366\333\352\307v:\265\200\342DAdW\"KY\023G\262a\233cG~\307=8\266Z\314\300\004\"2\210\020\224\335\370*'\200\356\332\007\240;\305\270\365\264\374\177\274q\224\214\\X\347\t\220\260\273\316\013\233\270\365\266\017l#\330\266\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getVoltageState.59.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001\300\216\002r\212H7\374\231\226\375\023%\300\240\t\273n\205h\026\365\036N\262\033\350*\2417\245\303I`\216B\236\213U\013|\267do)S\n\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\257\341\r'\217\335\371\234\350.\025\200\342\223!;zR/\354\267U\220\355t*\201EI\202\311\256D(eI\234\310\206\355\216-\371\035\367\350\370j1#\013\200\210x\bA\331\215\317\362\201\350\256] \272S\214_\317\313\377\307\033\307\310\t\226y\236\025\204\335ub\331\304\255\267m`\373\300vE\b"
+	.ascii	"2\003\316:#f\b\3055\2216\004\216\031{\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getConsumptionState.60.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203"
+	.string	"3\017\356\340\362\251\205\200e\375\016\3430\237\266B4\213z\017'\331\rt\225\320\333\022D\0058E!\317\305\252\005\276[\262\267\224)\005\276T2p\262,\213\302\253 Ua\246\352a\026,\f\357\002\253W)0\3250\301gQ\024|R\334\353'\225\322Q\007\373\034\217\227\177\341\214&\217\335\371\232\350.\025`\242\223!;rR)\354\267\325\217\355t*\001h$\341c7\"T\262\"\316\003\303\366\306\226\374\214kl|\265h\221\005@x\036:Hv\343\243| \272k\027\210\356\264\342\327\363\362\277\361\006\002\t\3012\316s\202\260\273N,\223\270\365\266\rl\037\330\366\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.61.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\331\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.62.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"5\t"
+	.string	"\006RA90\221\322\001\203\264\221\021\370\250\313j\006\237\330mYa\316\363\023\351T\376\340v\366K\177)\205J\210%\333w\306\306q0P\210\001\337=\306\217\0037\b\260}\262\311\336)\0050"
+	.string	"0"
+	.string	"0"
+	.string	"\255\325&\245\205\001\223\331\255\324\365\002\333'\347\001\333\247\344\270\351\321\344\377u\255\246\205%\245\252x\3340\354\256cJ\265\272\345m#\330V\260\035\023\222e;Z\312\350\250\r\254\2744\250\354f\314h\326e\306:\374\221W\322E\fp!\363\330]\356\323&\331\334\347\355\222\315\371 \017)\331DP\003' \355\256O{\242M$\377z\002\214\354#v\222\227\200\276\313\022\243\370\324\247?\332>\243|\375\001\314dF\343\024gvEE\271a_\333\335u\376t&\276.\f=\016\024\374<0\324\2014\364\340\001\321\317\007\322N\201\275\210\356\243\241\347}\224\253\247k+YR\032\234$\312\266)\216\002\301\331\265X\360a\017\013"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}p\231\002U\274\202\212"
+	.ascii	"L\334iS;\311"
+	.text
+	.section	.gnu.lto_batteryInit.63.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\301\003\335\027"
+	.string	"6\347\217I\260TRc\261\271K\256\244\273]\333\036AF\214\302q\242_(&\372\232\3018\347\302\313\240\312L\034\366\370Q\263\304\2034L\215\033\371\0176\343i\216\262G\313\017\244\3027\365\005\202\375\261v\007\327\027\214\3116\271\367\226)\005w"
+	.string	"y"
+	.string	"~"
+	.string	"K\\\002\331\265\272\276\372\002N,\036\277*\204\335+\"\331\344\026\317\251#\333\247\031\265\275\0165t\037e\2643<\336{k\245\320\321\313\354i\226\025\365\353\220\2604\330\273,\003\227\255XL\322 \317O\017\001\202:v"
+	.ascii	"\021\221\305Ni^x3\306\017\2514h\342\245y\""
+	.string	"\266\223E\013\376L\005:G\024(A`\2552\227{\257k\032$q\317n\333g;\201m\316\002\257\212\241\002\240\023\344\230e\n\347\201\233r\320\002\3512\326\266p)\231\224\255{o\213\217\3439.\370E?=c\263\031\2157\036Es\263\221\r\2154\326\257q\0334566\366\247L)\353O\037\356nxgP\326\222\217\263\276\214\317\300m\320\351\354\317\323xu4\277\263~\323\235v~\2219\360\352\323\237>\317\376\\1\332\352a\002\363\325\244\r\365\253e\220\3752\231L\006\350\021\232\204&\241.P\245\260\235\325B_\360.<\002#r\251\246W\305.\275\2124\017T\033\025\242M(U;\212\277\2627\033\272#\356\317U9\251z*\366*\322Z:\234|\312w\260/Sh\b\001V\261\247\003Y0\273\027\330\342c\275\310\240\301\313\213\375\371R6\354\202\341T\240\236\351W0\263{}O\375\036\367\361"
+	.ascii	"\002\f\214\375iG\220P\237\272V\371\024\201e\317~\214\265'\004"
+	.ascii	"\266\261\360r\267\234\234\031\f5]\016\247\303\271\351j85375["
+	.ascii	"NWc1`\234\206[\256\226\203\303\345j4(\337K\240\013?\263\272*"
+	.ascii	"\372\312\237\377uS\226\302\212G\311O\254JX\025\310#9\001\261"
+	.ascii	"\023\021\211\250\3160\377XC|@\272?`~\022{\315~4\310\376tM/\b"
+	.ascii	"$\322\217\330\366*O\020\227\356\355\275\207\366\003\254cB7\202"
+	.ascii	"\256(RK\331pl\205\b\232\304\365.\324([\250a<\313\224#VAJZPJ\007"
+	.ascii	"\260\002\021A1\017\0210\275\224\214\2522\215\001\002\216\034"
+	.ascii	"\274hILq\344\033z9\211\204\302~\275\024\2323\227\020\0360\220"
+	.ascii	"\254\300\006iy4\027\005kH6)\304\002\002\020\325\371\277\207_"
+	.ascii	"\001\013\004C\017\250@1\001\340\001\375\225\226\362\204P\002"
+	.ascii	"\2044|%p\272\337;\300.4\nH!&$]\017\276{\247\026\003\036\265\376"
+	.ascii	"D\017\267\234\030>NB\n\035\300?0@3\270.\345/q\035\2320\bX\350"
+	.ascii	"\n|\r\313\261O0Z\260\205a\031h\334)\021\220\277j\367\371\316"
+	.ascii	"7\230\037\200\333\347\240\373\204o_=\251\013\232\357T\001"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.64.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\273\005E$"
+	.string	"\252@@\016Dp\250M:\243\037\251(\227\351@\363@\366!\021\006\326\037H\252\227&\311\n\354\366\3351E\332\220\235W\017\323\345;\367\321\273\016\027\006\200\251\255\244E\243j\032G\030\246"
+	.string	"\037E_\213&\324\b\331\204l\231d\317"
+	.string	"\303"
+	.string	"\331"
+	.ascii	"`5r\234\031\213\036N/7\222\202\305;\205\342\254\017\027\204\227"
+	.ascii	"\234\341|\311\337r.8^\344\232\0223\364%3\016f\364e\243\314\374"
+	.ascii	"f>\327\273\322{\351\340\332\275Wl\302\356-J\340\b\347\313\244"
+	.ascii	"#\331\227\344\007\330\227\2342\243\275\310\344\236\214\226\360"
+	.ascii	"K\332\275\027W\227<=ZT;M[\222\265S\376\357(\2168\245\bm\214k"
+	.ascii	"\253f.\035J\310\317$*RB\332$\037\36493\350r\244\210$\322\217"
+	.ascii	"(\303\203\021\2665\227\276\336\001\312\230\237\362WRD\242\212"
+	.ascii	"\246v\330\243\005WRCH\222\202\236;\\\204\256\200\020y%+\354H"
+	.ascii	"\243\272M\005I[!\241\331\277\336<\246\200\335\346\322\275\227"
+	.ascii	"{8\005\344l;3\277af\036s\311\"\267j\n\022&\352"
+	.string	"jT\217\352\271\234\003\025*#\026!\230\024\340\305\216\206\304\223\t\023\266\246\304\214P%fm\201C\022\350\027\037\246\342\274\027\352C~\231\2339\301\177\362\222S\250PaW0\365\207lkC\310\030\254?\266\023\346eU+\026\347\354k\213.x\202]\210\371b>&\307\177\302\272\027\375\341\013\373\3625\213\225=U]D\250>2\027\201]\261\230_\217\307\343\221k\022f\333\214\340^\316H\007;\0130\233\217\320\346\333\275~#\264\271\2066\237\266\331D\233mQsYk&\317\346j6\267m~\202\003\262J\363#\303\314\275?\216\207\256\261\024\313\272\227\037\354eW\3463\277\310\377r0\214\006\374'/9\315J\247\244S\354\313\262\002\210\342\263%\006\325G[\253X\3474F\324\3549\233,Ymh]\3624\350\243\223\260\314\251\225\024K\177HV\333e\025\254\277/\030\253\022\304\254a\005\324\002dX\216"
+	.ascii	"\232\303@K\332\325\037\n\250\007\363g\221m\031\201pn#\263b\264"
+	.ascii	"y\360\244_\007\252\024\364\2552k\330p#+r7?\233\260\264>\277F"
+	.ascii	"\304ux\364\321*\347\334\354t\030\355\202V\025U}\207\036\032\371"
+	.ascii	"q\232{x}\264\221r\255\336\360\313\376\016\366\245\210\273\347"
+	.ascii	"\016\227\326\275\327\301\311\370\336\337\253N&\227B\332\035\256"
+	.ascii	"\264ku\035\240V;:\0213{8\233\017\347\275A\013\3745\037\003\021"
+	.ascii	"b\304\b\373\262V\023\254\316\226\227QM\023\345\n\223\252.\252"
+	.ascii	"\243\032\fC\2517#\206\357\t\347\264kj\332\345\f"
+	.string	"\364\236|L>\022>]\317\205\213\020\272\031>\337\216\007\303w\353\231\3205\305(\341s\322\361xO9#\316)\335\340\351|>\246\026\270\036o\327s\322\365pN1\230\232p9^\017\247\224\200w4t<\234o\267\343\341\320\"\324k\022\356\n\344\3139/\221\367\336\213\366=\336\312\214\030\203m\376\257\277G\031\021cQ\305\342>!\334vFVfFx\255\362\b\363C\206\220\210Ih\244Z\253gM\227\244M\372CN\022\326\037#\250g\2003a\242?\2015+\202\312-$\002\3738(\227:ya\326\tW\002m\021m\020\317i\254\255H\265\317\242\252\200}\344\262\332J\n\212*\203\352\243\322\001\261\231\363\336\213\201\357\347\177R(\001q\250q\034\350\224bffF&\220\2214I\007\200\002\0212\243\036\020x'\243I2\214\001\315\2729\344:u\032\300\2078\3158>\333\360L\302\217\005\024:\002\267"
+	.ascii	"\340A\346\270\355\004\342\346.\326\366\f\3604\004\2231\211\322"
+	.ascii	"\220\017\211\005\247\247\2667n\312\f\214\246\3212\f\370\370\221"
+	.ascii	"\245\212$'\"[t\232\027\376(\266C\353h\352\205k+\341\317>\217"
+	.ascii	">\257\245\226^\366\026\313\345\315CS0v\210\220\323c\034\026\177"
+	.ascii	"\3528\306\213\226\362\372\306X\261\"\320\267\216\223\030\236"
+	.ascii	"\254Dlap\fE\330q\244\201\274\300\021\212\r\274\t\345\206f\302"
+	.ascii	"\356\206\270\246\271\006\241f\207{1\034\330x\307\rVR\212\256"
+	.ascii	"X\355V\333|\371\337\301\304\253A\304\013\177\211P\030\024\333"
+	.ascii	"\243\376\004\204;\214r\034\375\"\372\347v\311\366\270\250\342"
+	.ascii	"\002\205\274\250s\360\024_\024\211\245\006"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.65.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"]\013"
+	.string	"\266\025N@ o\233\016\200@<0\255\021\340j! h\304\365'g\200\244t1J\002\0231i\227V\033yks\007f\345\336w\002B{`\n\201@\305\243Z\341\002\001\035\234\006\310\215\242?\331[\312\224\002:"
+	.string	"="
+	.string	"9"
+	.string	"$Z\354.U\271"
+	.string	"\351\021>\200\364\250\033\236\035jf\276\344\002=\204\234\340\272\320\341d\341J\3516X\331\335s<3:Q\246\344\262\273N\256\253p\307\333^`;\201}\005\001>\\\325`\353\275;\237~\234|\210\240\370\250\330\2350\"\262\036\261D\207{\277\235\371\034\236\334\3637\205(\f\220"
+	.string	"\202a\305\356\032x\364\201\351\321\007\361\020\231\375\301\021\207\215\203\\\300\b\"\350\213\264-\by.U5\364T\325\360H\327L\307\307\226!\266\261wx\246\335\r\201/\342#\"\370\033\217\376\200\362\334\243\017\222\036\257\022\214\357\203\247\345\210=\022\245j8W\345"
+	.string	"\243a"
+	.string	"\300\032\313\347\252:\035L\206\302.\013\343T\030\305i\200\331P\232\013\243,\004l=\250.\252cY\0275\031i\207\232\272a\221\"\375}\355\334v\265\002\252\031\266U)\031Lxh\032\023"
+	.ascii	"seY\203m0bf\202\007G\006\254\340\006[\260\013\205\035\3352\031"
+	.ascii	"\272\206\207L\220\240\342}L(\213\332\006\270\006\215\302g\250"
+	.ascii	"!\333U\312"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.66.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`q\004\315\035"
+	.string	"\2068\302I\240VN:\325\313)\255\201c\277X\240'G\027\237\347\324W^;\260\034H3N\232\330oOI\027S\275;\027\236\206q\327\002\266\351\013\341\032\356\210\243\303N\243\327\277E\305\273'-\016\26584\365\216O\310\336DJ\231\002\252"
+	.string	"\230"
+	.string	"\266"
+	.ascii	"MH\250\325\252\242\313\226Z6\207T-\327\256\326\362\277_\343\230"
+	.ascii	"\213\315\261^\277\355%v\307_Z\220a\255\360\333u\333\016WG\323"
+	.ascii	"r1\221U\b)\025\226\345\200\334I\2639t'\357\r\335\371\227\370"
+	.ascii	"m;\371o\372n\335\266Z@\262Z\215_UUi\265\016\017\354<\002r\347"
+	.ascii	"\025,h:p\2072T\320\252\032Q^Wj\035\342\232j\201K\247\330\f\374"
+	.ascii	"\216\017D\254-H\244\202&\226N\355\204\tN\255x\013\236\260\005"
+	.ascii	"\241\270\273\226S\004K\021@\255u\267\226Q\004\237\230\307\007"
+	.ascii	"\265\326\263Tp\305~\334\377!\376#\375b0`\033d\367\245\261\363"
+	.ascii	"\037\222\222\350N\242\336\256\025@%\206E\310\265V\023\3351\016"
+	.ascii	"\244\333\036\272\242@q\226\177}\354\017\340\227\306A\360x\245"
+	.ascii	"xt\347\366H%\226\345\302\211\273\374\303'\356\030\377\212\265"
+	.ascii	"a\374FE\313\265'\242\374\241\325\332\013Q~\020\311\007\"\371"
+	.ascii	"?\224\357C\371=\224\317C\371;\224\257#\362sH>\016\311\277!\371"
+	.ascii	"6\224_C\3714\224?C\3717\221/C\362cF\276\215\362a&\377e\362I\312"
+	.ascii	"\037'\237N\376\234|\221\362{\362Y\344o\200\241\251\3334-d&\323"
+	.ascii	"\267\336\2505\t\313d\002)&\323K\206&\264uLO)Qk\024v\tS\222Ub"
+	.ascii	"\341\002\006\ft\247\255\023\334 \313\022N\2366\032\2406\366t"
+	.ascii	"\366\265v`w\232\247\317\245\225;\331\033\2410\275\323\373\265"
+	.ascii	"\"\216\031e6\316xPyi\230\026\301\3121\262i\277\364\226K\306&"
+	.ascii	"{"
+	.string	"\313\264\261\201\214D\255\205m\217\337\240ju2\232M\373\307\254\274\022\233{\366\226VO\334\345\335b\3630)\323\236a\213h k\255\f\276C\226\310\006\016\035:\320\235\335[\004MH\324\334\213\245\345\254L[q\231(Q\003mMyn\303t\013\240\324\n\305\340\033G:ZB\372\345x8\245\036\217\327\323\3710\375\222t9\0219\b3\273\017\271\237\322N\347\333U\250\271\356\210\311\267\373\375r\036pK\276\336\222\322n\t\247\224\224\343\341t\276%\334Q\320{\"v>\334\257\327\363\341lC\247\025\267a|\325\236\314\242\027.jAD\243\036Qe\215\027\310\n5\212\377B\275[\273)^\260(s\352'\221\316t\021\331P\317\034\331\240\036\352\365\002\352\240\026\301~\032\247\201\332\200W\211\303\247\177z\232\246}\272\001\227\362\352\326:\335\3238\257\322*\247u\"l\223\262\234f34\241\023\001z\3238]"
+	.ascii	"\254\274\262\351\230\276\351\036)\245UM\333\320\364\255kz\313"
+	.ascii	"\253Q\250A #\221AJ)g\"\231\321\264\260\325\200\002\031#+\017"
+	.ascii	"\020XfE\311p\303cE*3\366\213\312s\226\322\306}\2363G\205\332"
+	.ascii	"X#b\001\270*,\254\343m\306\3741h\204\"\222/\032#\205x\351u>\027"
+	.ascii	"\361\356\377/r\f\r\235\362\017\300\271\305\331<~,D8<I!\233_\n"
+	.ascii	"sX\027\rP\233\r\317\212\320N\260\t\245\223\236\0348\250Lz\ti"
+	.ascii	"\201\315\032\264\025\345LF\003\006\242\331\322\223t\360\214\302"
+	.ascii	"\357z\200\320\211\257\373\324\206\2620\332\325\203z\256;\376"
+	.ascii	"H\tx4Z\":*\252;\237\330YRD\276\177j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.67.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"5\t"
+	.string	"&\021@90\257\322\001\204\361\024E:\t\307\bpM\320\373\360I\026r\3712\214@F\227\302\234\037\332\376\251GP\213\355\r\363\245\241"
+	.string	"\215A\212\237\323\211\021g\202\226\255\221\275eJ\001."
+	.string	"."
+	.string	"2"
+	.string	"z\3625\236\335\375\353\0330D]V<J\203\231\211\213@\250\222\003\254\f\360\257\353D\370\251j<\273k\005C\212{\273\355\004\333\007\266Q\002Z\263c\237F\013\373rc\313\276\372[\001\207J\304\313.\253\026\263\262\355D\303\3669>\331-\217\271\366$#+\021\230\335\235\361\342\247\313\030\001)\033\262/\242\356\242\315J\242%2\217\240\220\025\225\322l{\007y"
+	.string	"\330U!\370\037\207A\370\030\337\\2\351\301o\276)\363\355Q\263b\361\200\245\002\016uJ\235\210D\372\200\246\327q\336H\344\315\321\302\207a\206:ov\b\3145\210\272I\342\270nrb\251\313\215-+t\310R\361\223\033\2659\007=\350\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.68.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\"\21624Pm\323\001\244\005\312(.*\263\372:\t\213\340\351\341)&k\207\376\203%\203\344\356\261m\314\360Qg\317\314\214\025\f\257\365\n\002\322L4\310h\023\271S\n\266P,9UUE!NI\315\3134\343e\241\302\020-rF\312\304T\303$cEQ2J\\vhu\243:\220\251f\177FW\325\310\203\351\320\354\360\215\031\260+\201\340k\274\363\340_\034\032\302z\337\016}+:\274NB:\331\353lN{Ja\037Z\335\330~\326\367|H\340\003r\211\354f:\222\375\200\034\034\333\227-\331\340\3402v\316\"s\216\007\3063\262\313E\2558\366\207\371\3178\374\224t\233&\342\017 aw\3756\315\304\255\267M`\273\3006F\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.69.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001#\333\332\350+\224\322\242a\007\006G\200\225WS\372\343P\334\232\250\265\316\021Y\306E\005\2653UU\305X\355\177\356\211\206\252\341\003\221M\244L)\346h<\260\272\256M\203\263\340\263:\225\345:\016\233\007\307\201\226\323\030\370AT\320]\357A\227\211\373i\225dE\020)\205\355\210\223`\001\273\273\340\217<J\370\035o\366|\362\331\233\377Q\001\021Q\226\354\030J\315\260?\255\222l\247S\017PV&Rv-J0\253\322N<l\203\354\214\377q\020\220\261\214\034\027\224IKE\311\313nt\003/\240\336\362\004\324\233n\034{b\376C>\271\304\260d\243\320\023\200aw\235\331\b\343\326\333N\260\255`[#\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.70.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514Po\322\001 \306\370\031k\261\265\202a\007\006G\200\225WS\372\343P\334\2325\326{F\226\221\275\241v\246\252\252\030\253\375\317=\321P5| \262\211\224)\005\326`8\217\272\256L\203\263^em(\313m\0342\017N\363,\2071p\005A=wU\325s\227\270\227VEV\004\220N\330\216\370\b\f\330\335\005_\344Q\302\347x3\247\223\307\336\374\216\n\204\2002\263\343'\025\303\276\264*\262\235N=XA\201%\273\025Y\313\2364\223\016\333\036\373\342{\374\303c\230q\303b\032\245P\220\260\354F7\360\202\351-O0\275\251\306\341\023\372\007\271\244\222\215\260\320\347\t\300\260\273N,tq\353m'\330V\260\235\021\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.71.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375 \350e\006"
+	.string	"\"\214,1pk\322\030\0302\004\203a\004\344\320\351\303\021\0232F\227\0368\262\302Zk\315q\311\350Sf\311=U\365\033\1772m]\030"
+	.string	"\246g\033!R\312\024[(\0307YV%\241U\216\252.S\325.\n\225\205fqU\243\004L1L\256Y\024\345\332\004[\324O\352"
+	.string	"G\033\03610\343\215\025c2\211\027Jc&\202R*@\004'\263\3076\251\022\217\321\352\347\317S\005B:\236\307n'\013-\207\264\001\3725?\331\340@\363C\214\242\023\001\205\0344@v\261\246\023\3700\337\210\027\030Yd\037\227g\203)A\330\335\363\362@\340\212?\301_\360?\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.72.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"E\t"
+	.string	"6R@7@\217\322\001\233\016\303\213\341\360i\354\b\322\t#\275MD\013\237"
+	.string	"\376(\nm\037\261\340f!\006{\360\267\322[\032\036\025.\r\327\360\376\211~\376b\t\331D\312\224\0021"
+	.string	"-"
+	.string	"0"
+	.string	"\031\211\022)\323Aq2Y\331\375b\300\007\262\303\274@v\250\033\367\236\236\377\2203\270P))\025\351\251-\354\2563\245\272\270\365\266\021l'\330\307\004\251\032\366\261\335]\353\312vZ\3234\3244\206\245U\323\231\351_"
+	.string	"2*TG\241\354Z\274XV\005\236p\330\036\331\030\377\343 #{\001\252\330]/\361\370-;|>z\300\302\270\246\376\324\342\355$\336ew\025\374\221\177\020~\353\320\235(\237:\364E\331\341\225\200%R\312\227\375\221\002\346h\"\270N(\264i\210\035\267u\240N\027A\236\315'r\270.j\n\274=t\270\030\3326.b\276=\266\272\322\324\240\244&C\3250M\205\372\t\017S\276\034\r"
+	.ascii	"2\241\037(0\366\005d'YN\025\337\232,g,oe\346P\265\322.\334Y\260"
+	.ascii	"<\\+&a\222\001"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.73.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"U\007"
+	.string	"B\21635Pm\323\001$\2439\232\250\234\325u\013\0133\321:\242\3106t\261F\f\227\fb#g=X\351\341\336\234\354\314\024i|\255W\020\243%\n\030\017\021\"eJ\001\306X0\213\272\256\013\003\214V\0253T\204\231\206\213\003\304X\021Z*\256\036(\013^UeA\212\247=Z\355\250\022h\272\331\217\323Uu\nmF6C\034$\006\354R$\370\037\007E\370\236K\226\300\362\334%\037\233.]+% -?\333\333R3\354G\253\035\333i\315\364#\001\rO\367\212o\227\363\235,\211$\362\261\255\261)>@\3208\273\307\301\031\350\270\330\204Lv=\250\033\317\236\231\177\217/l\026!\\7\361\004P\330]'\327a\334z\333\005\266\rl\177\002\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_getAmperage.74.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"%\007"
+	.string	"\002\21624Pm\323\001$\243*\252is\013\225\342\037k\244\232M\3366\224+\2365\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\312\252\2777\2212\245\316\\6\261\3020\f\003\274\242ui\252\013j\0320\0160\023/x!\260\365PE\210YV\204T\267\227VAV\213\246\037\333\020\017\311"
+	.string	"v\027\301\007y\027\341k\374y\303\311o\177>g\372K\r\370\320rdw\236\324\f\373\322*\310v:U\022a\334\204d\267b\224\262%od\303v\307\246|\216wt\234)Hh\\\201\350bB\004ew\241\345\003\323\237t\201\351OC\317\236\231\177\217/|(N6\316\363\254$\354\256s\343,n\275m\003\333\007\266C\001\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.75.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"%\007"
+	.string	"\022\21624Po\322\001 ;\263D\334\"\201\n\n\004\254\324\004r\242\006\225q\346M\032j\275{D\226\221\275\241v\246\352\022M\220\252\377\"\264Y\244\352\177D6\2212\245\336d:\220\272.\215\303\263`eq(\353q\0364\020o\003\255\2271p\025A\301wU\025|\227m/\255\212\254\230LC\266%^\202\005\354\256\202O\362m\302\357\270s\307\223\217w\276g\272K\025\030\311rdo\240\324\f\373\322\252\310v:u\200\003E{<\331\265\030\265\354\212S\361\260\375\261/>\310C>\306\030(2\355\340\003\243\302\204ew\037\346\005\323\235t\202\351N5\216=1\377\"o\b\305\224\250\201\236"
+	.string	"\013\273\353\214\332\305\255\267\215`;\301\366F\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.76.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"%\007"
+	.string	"\022\21624`m\322\001\300\216\fE\"\203=\035=\223\200\245\246\004\002eE\302\314&\r\365\336\241&\273\201\256\022z\227Pp\222\3022\367\252\\+\330\355\257\311&R\246\024\326`8\220\272\256\214\303\263`em(\353m\0362\020O\003\255\2071p\025A\301wU\025|\226m/\255\206\254\227LA\266%>\202\005\354\256\202/\362m\302\027\335\231\323\311\307;\2773\335\245\n\204d9\262\267O*\206}i5d;\235:\260q\242=\242\354Z\214V\326\304\225p\330\366\330\026\337\343\037\036c\f\024\231v\320!\252 Q\331\335wy\301t'\235`\272\323\214cO\314?\310\033@1%j\237'\300\302\356:\243vq\353m#\330N\260\255\021\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.114.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\246\001\355\016"
+	.string	"\246\232_E"
+	.string	"\223\223\016\343\023\250\021U9h}\023\221\220T\230G\020\241\221\304&O\233K\366?L\310\356\275\260\254\3653"
+	.string	"\326H<\032\330\240D\017\366e\250\277\352\3732D\030\001\257\233\347a\203\f\024K>\331[\312\224\002G"
+	.string	"R"
+	.string	"I"
+	.string	"5v?\223G\227`\217\007N\340z\204\037p=f\217Oa\333\304\301'{\307?\325\276\006\210\213\rkw\265G5\361\3235\341\311?\315=\251\227\013W\221\027\017O\001\207!(\273k\354\303\035o;\201m\bv\006\b\273\241\265\263$b\216\214\013\223WPZ4d\2007#p\250`-\206\217\3046oQ\362J\201O\325!d'\004\017\037\254\335O{\364\207}\346.\275\306\212\323\312\356\2570\3714\316fL\377X\222\301\242@\220<:\323\376\352,N\377X\354\331-q\023\237\021\325\356.\360e|\006hKI\271\036S'\325\343\232z\227 v\3501(`\273\253\300\177q\030\"\377\304\2439\225|\352\321WQ\017\352\006\212\025*[\2511Vx\270\nc_i\030\323z\2453\246\217!\220\031\021\261\001\236\340=\330D!\007\244\321\326u\026@"
+	.string	"\f:)u\033\211\364\221\240y\035\347\2156O\033\205>\"\r\324y\332\211\001s\025\266N#q\\\247e\266\363p\025\306\rr\350@i\213U5\30664\271\216\rU\030\34198\372c\225j\273\3444\002( \220\202\241+\233\003\377\006C\013\031\230\017\307\315\230\302`\\(\017\357\341\036mwBX\013n'\353\n7\315\214\256\355H\265'\331\236\211\3160\233p\253Q\2207\004\336\005\020\f\327\204y\031Z\203#\026\036%\030{\322=\323\205v\352\005m\227\205\005"
+	.ascii	"\344\305\357\224\232~\202\031\003"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.130.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\362\0025\026"
+	.string	"\206\351\216J\300\322Q:b \210\273\177\\\277\277aE\221\343\326\360\032\035\245\236\360\345\357\214h\300\250FX\351z\326T\037\322\353\343\027\264\002\354\340\245\277\315\363\277\3136E\321\026\204\202\334=\306B\301(&\232\274y3\2024\262\211\334)\005u"
+	.string	"}"
+	.string	"v"
+	.string	"\376\220\307\262f\023\\Yy:\233_z<\365K\270'\306\350\b\344lt\360\325ZU\247^ \236\222\250\351l\373#\016d\263{`\331\303\273\r\0164E\277Z+yj\362\001\341)\370\221\360t=\334vp'\265\371\250\025\350\323c\251f\027s\020\2652\372\254\331e\370\212\354p\240I\255\365C\2376\273\333\234\002NQ\253Z\253E\rwx\333)\266c\366\"\b!\3414H8-\212\323\250p:\f\247)j\032\f\247\227NO:}\221\002\n\234j\275\360\344Tu(\213\020\027\372\324U\\\251B\252&f\306\233\252\262M\033y\216r\276\337)\212\232_V7\0133`\n\0361\200~\025W\252N\374\b\306/\006\312\036\f('\234\0339~\265\226\344\251K\361#\366wC\317\307/\272\221=\232v\"\037\230A3\314\211<\312H\362\251\265\216\353\013\325\002\276\213\277x"
+	.string	"AE%<E\355\177\320\b\242\273\033\356s\"n\363\311\340\322}\316\367\005\227D\211\346\307\334]\320G\316gGx\013\226X+\016\305O\272R\313\347\235\332\265\262\022\236\316\r\260\224\364\0234k\2551\273<\266[\302o\n\004Q\r\334\354a_\305W\264\370<Ox\315\327\234\372\257\360\364\313`G\357\007Gf>\315\345\361R\260\356\216\235\n\247\307p:f9\221\261\314X/\322\005\366z\301Z$f\211\271(\260Z)"
+	.string	"\334:\241\305\\\263\031K\002)\213\301d..\031\351\322\302z\221\255\230\214<)1\254\202+F\316`\260\0309\332\236\007\353\356x\356\270/\0340\346\233\236Z\033\333\251\375\320\177\223\243\024Cfo\336\203`\310\216\033\352\270\365\376!\247I\247z\342j\225I"
+	.ascii	"\262!\353\231\313!n\270 \273H9&\324\212[\202\324\340L\016\304"
+	.ascii	"Z+J< p\002!\273\352\006ac\274bE\034\022Ve\354Avu,\246\001Z \344"
+	.ascii	"L\34704t5l]\331\026&5\304h\240\262;6V\343\337x\322v4Oa3\213&"
+	.ascii	"\350\221\207\021\376\303\3662\342B,\220rLM<\bbA[\353GwY\334\t"
+	.ascii	"\331\266\266\260\211l[L\306\323\347\2226\327\356\314\272\245"
+	.ascii	"\357\362Y\r \021\213B\272\213j\226n\240\333s\273z\277{c\250\013"
+	.ascii	"\353.\250\210>5\336m=\001\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`\241\005\375\024"
+	.string	"\026`zJ\260\226Q:\3740\315\033b\301_c\b&\02168G\0367-Wr\005\333\\UZ\343\2168\n\022\321\353\314"
+	.string	"\271\235\021\270yy(\306q(\306\211T\355\333\377\366\277\375!+\006N\262\317M\026\342\326\353\033\340\333M\344\336)a"
+	.string	"h"
+	.string	"g"
+	.string	"\335\3435\257\356zWu\255\313}\211\305\345\334\272f\273S5/\217Z\373T\032\354\247\251Yg\177\242\271\246y\372\364\265T\276=7\\,\026\271\360\364\254\356\324\034x\023\373#\235\230\345;\300F\326\266\232S\300\362\305\301\261\377\351yt#\263\3274\357\216\277\377&\027t\274\367^\233\276\325\377\254\030\001\367\237\341\320\207\242\033\330j\320\261\277\n\"\243\"\024C\031v\354\0374\n\016\215\204\212\204\210\202\206R\360\234\236+0\364\330\013}$\026\372G*\364\215P\350\027\231\320'\"\241?$B_\b\204~\220\007}&\007} \265A\347*\203\306-\350/)\350\377"
+	.string	":\025\233\340P\212\b\372JU\306"
+	.ascii	"\260\201?\237\365\365\257\027O[\252"
+	.string	"h\320^L\211\265\327\r\026HT\266\027S&zR\232\004\225\024\365\363\302\344\225\314I\017UU\003\313ld\001D*C\232z1\033\331\325\"\322+\335{g#\017\373QN\364\247\204})\301\376\024\023}\252\240~U\211~\024\211\276\223\021})\021\375'!\372L@\364\223|\3507y\350+\351\320\267\242\367\006\027Rj\243K\026\247\227\032\026>\306@\260\030\307\3508\306\230Z\321\300XH+\200\031~\235\272\222cx%\307\020{%L\n\007\f_\311-\246_\311\255\023X2\353\212\276J\213,:\256T\362p\206\256d\027\216dW\216d\230SGZq\362!cG2\213H#\231\300Ia\256\364\310q\013\300\254%\327\213\351\025\255\001^\250A\bF\262)J\f\n\nY\016\320\002!\243Q\007\021\240\030\250\b!\"\"\241\004\244\302<\310\272\217'\302\261\245\003\202\314\230iL\357a\317\234\365\277<"
+	.string	"\301\340yo\217\366\244B\244\344\177\357\230w{\317N\341\027\325\203|\234\013q\026\202<FY,|\226\340\222\007\215\224\007\224N\336Aq\021>\316/\t\231\313\277\277s\177\016\256\377\r\252\2758R\310b\311\374\017\365\2406\315\344+\241\264$\362\3267+m\002\353\365\027>\361\260\235\305\261\2400\302r<\255l\231"
+	.string	""
+	.string	"\246\232P'9\033\246\362"
+	.ascii	"x\217\2614%d\030\370\f\216Az\013\260\n"
+	.text
+	.section	.gnu.lto_.refs.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`i\001\375\013"
+	.string	"\226]L2Pk\223\306(\271u\232\210\030333333\323\214\231\231a\214\360\037\325\3762\365\243\320\233\256\372\215\f\177S\243\246nHJ\2304B\366&[\246\0249"
+	.string	">"
+	.string	">"
+	.string	"\031\246\026\316bn/M+n\t\254\023\216VV\312\243\020L)g\037n\037k\344\350\263\266\246\r\323\317F\342d-\2656Z\n-m\254}\326:k\331\322u\372\n\351=\b2`\232\261v\301Z\214g3\353E[\314z\221\224\"\242\026i)k\204\264\223\225\232V\302\330\020\213\317C\035v2v\016\215\317\272\244c\331\242W\2643\0014\016\331\330\fg1n\025<\032>\252\323aZhm\260k\3176m\327\355I;4\305\341E\bq>9\331Oj\311\276\356a\335\240!\003S1D\353\005I\265\360P+Ph\353\004i\2250\255\021n\205\260:X\0330\003Z\\\346\276\213\225"
+	.string	"\263W\"\270\354\222\254\270\003\006\n\354\024\353@\313&mN\313\3221m4-\223\0068\221\025\302\264U\023M\300V\252\223R\235TD#\0014\252NGb\033\t]\325\271d\005\022\262\001\035"
+	.ascii	" D\312\231\242\272\274\026\303\260XJD\351\036!/\003\236\332\366"
+	.ascii	"\006\351\326\2720\324p\3046\024\264\212\267\254\265F\314\376"
+	.ascii	"\337\326eo\305X\023\352\372\302e\006\213\212\233\325-\242a\002"
+	.ascii	"\203\321F\254T\312\004\251\2114\031/,\005"
+	.text
+	.section	.gnu.lto_.decls.8ceae77c9d7bcf30,"e",@progbits
+	.string	"(\265/\375`U;\225\361"
+	.string	"\212f]OV \016\251\234t\226t\215\261F\270\336\330\030\034~\374\260B\241\353\343W\347\030\211y\324\305\337\\\261\262B\032\251\305\361\036\243y\271\267\2071]\254\345\247\375\211\357\255\255f\351\242\261\203R\347|\270\370c\324\374`\300\305\325\034\353\203\254v\032?\224\026Mk{\313\235\002\035\004\353\004\036\0055K\027G\360\032\037G\251\307\313([\027\363CI\327\032\324\223P\b\023\037\313\306\375\364vj\345\f\030\227\022\017\266\266|\365\234\266\232e\037d\261jV\332\024\301G\223V\332&\026\317JiD\300\314\312\264\203\277\307\357\356\211\344\n\337V\363On\316\326q"
+	.ascii	"\3303u\262\325\034\264\201\335d\377\254\027\033\306~\261`:\251"
+	.ascii	"s/YA\013\330J\266K/\233\251W\330h+\255\226\333-\226\31314"
+	.string	"g\245\234\363-\023;[\307\301\337V\363\357\f\nu\344M0\017\212\235Re\253\371\207$\211U\273\2719k}y\022Y{\202\213\313S!\004\366\264\322\366Y+7J\320L\225\234\262\325\3743s\313\311IzM\317\"\277\rb\304\252\335(\241\001\030\334j\226\345\f\275\225\373{~\016>h\245\305b\325>$\345\254\025\203\303\236\024\255,\1779C7\350\260\001\316[\302\303\005\004`+\265\033\206\037\356\232\372\313C\375\345R\177\241\324w\026\365\255G\305V\261\221\276\230\322v\204\312\017\313g\245\266\310\030\233\241\332(V\212\215\332\275\337\352Y$\307i\316\034\315\031js\227.\232\2745\276\335\031\342\330\235\341\333J\305R'\366\211\215\206\260\322\333;\313\344\302%4C\033L\220MH\343\367\223z\033bx\007\007m\210\341\355\027\265m\0255\247\256-\235]r[g\225\324(\331:\234\363\322\332\001\334X;"
+	.ascii	"\341\034\216\245\220!\276\225\242\336\306\251\035\304T\rd\250"
+	.ascii	";\226J%\261\002\265D\221\372\037\365k'\324\303\331\rC\213f\323"
+	.ascii	"l\024\204\035r\016>\370U\246e\263\234\24186az\204\tl\374\b\250"
+	.ascii	"\267B\016\200\274\374\3013PoA\f\355\240\0051|\2539uv\303\360"
+	.ascii	"\2075\003q\233\242\234y-g(\006\034\250\013)\257\306\207\332\r"
+	.ascii	"C\325\352\f\361\225N[a\370\257\360m\353\267\0240\202\365\333"
+	.ascii	"\n\274\220B\245V\363_\251\250S\332\212\337~\370_%\020\365\277"
+	.ascii	"+X\001\035\322\211\020\037Z\252\370[\246f\352\273\030\"\260\344"
+	.ascii	"\200&a\305\337\026P\372\373\204\277\2230\320\0258\317\1779p\276"
+	.ascii	"\376`YB\347$\376+\243\225\034P\340\2673\376\316\177\277\340o"
+	.ascii	"\026\374\315\302\337)\370\033\351\357\023\374}\364\237\346\277"
+	.ascii	"\031p\232\320z@\326\361\177\033\320\306\377\302\377vPl\242\276"
+	.ascii	"'\240\332\321&\260%@@\221N\n=\327\032\212=\324B\217\242!C\247"
+	.ascii	"\0306\2617 \001\224\006\375c\005`\354\360\037\001\377S\b\361"
+	.ascii	"\333\021\374\035\202s\360_\001\374\375\201\226\371\314\337^~"
+	.ascii	"\253\354\016\374\037\202\345o\001p\340o\003X\0256\360\333\023"
+	.ascii	"\244\360\017\377\265\377\303\374\377\362\333\230\377^\376w\371"
+	.ascii	"/\370\037\360\177\340o\373\377\340o\205\377\301\374\377\373\355"
+	.ascii	"\375\317\345\267\366\267\303\337\342\337J\377\367\375\227r\f"
+	.ascii	"\376+\344\357\341\3372\177\253\177\013\377\276\177\307\374M3"
+	.ascii	"\375\273\377~\243\360\037\347\307\032\370\333\204\277/\360\267"
+	.ascii	"\004\3766\361w\b\177\227\370\033\204\277y\376^\300\337\"\376"
+	.ascii	"\016\361\367\001\376\326\340o\017\177o\370;\347\357\233\277k"
+	.ascii	"~\213\367\333\267\337\032\371\255\333o\327~\253\366\333\350o"
+	.ascii	"\323~\013\375-\220\337\372\370m\331o\307~+\366\333\246\337\206"
+	.ascii	"\375V\307o\301~[\343\267_\277\355\372\255\363\267Z\277\315\372"
+	.ascii	"\355\325o\255~K\365\333\251\337J\3756\377\026\352\267N\277U\372"
+	.ascii	"\355\362\267-\370\355\n~\313\302oQ\360\333\344o\217\2775\372"
+	.ascii	"\255\361\267D"
+	.string	"\277-\301oM\3746\350\267@\277M\361\333\004\374v\203\377\322\337\236\360\237\356\267\304\337\376\374V\004\277\005\301o=\360[\016\3746\205\337j\340\2677\277\265\300\177\024\277\025\341\277\t\277m\300oK\374\266\203\337*\340\267\"~[\200\337\022\340\267\035~\313\341\267\030\374\226\346\2673\277U\377\233\375_\377\333\375\327`ppp\360\237\031\372g\230\374!nT\242\236iK\256\300\304\260\260nV\206\354\314\371\031\323\34648\025\213fI\222\325R\234$\201M\\x\335\026\267\305\275\322\262\200-g\326\016\276\213\201\327\343\3526=\224M\311\267y_\320X9\371\b\202\007\305!\"\365\002\243\261\213\256\252\311B\267\305\324\3704L++<28\234.c1\300\240\\\252\035\314\231$\352\324T\373\251\271\303\023\246\215\226\023\245+ RRV\315\246\345\251\031&\252:\021X\020\213\224\032;\240l\364BY5\253cJ"
+	.string	"\261\252%\327]\272Nw\3516!\200\211\3516\235"
+	.string	"\241\005z\267\312\004\2014\276Mo2M0f\343\317\254P/\203\247t\225\032\254\323r\325\f\2232\207\326_\316M\0216a>\206$\241\r^\345\340]\016s\266P\347\024\363.o\276\271\373Te\316\035\202<\233;2Me/\310\334P/\303\024\024\f\233\312$\005\006\266\237\007tL\265\017\020\220\031\263\302H`X\222.Z\332K\337\341\274\226\227U\036\0042\325 \352\325\032[l\264\267X\274\235\274T\356\204\345:\021B\260\2571\027\215\257Ze\311\322~\036"
+	.ascii	"J\333O\230'\226\243\r\020F\264at\336\220)\303B\357i\232\231\314"
+	.ascii	"+6\332WZz\"/\253D\330\221\241\"\036S\245\312m\264\253\264\023"
+	.ascii	"\r\344\274\274\362\200\354\331\024A\003\005\026C\215N}K\351\275"
+	.ascii	"7\337\337|\335g\233Y\231\345\003\253i\223\271\363\367\224w\337"
+	.ascii	"\257\324\344\0177fsS\300\306\347\3222?s6\376\324\324\017\363"
+	.ascii	"\222\231s\256\022B33\251\346Vh\355\316oc\257%@\016\200\013\240"
+	.ascii	"Y\351El\213\272\343m\211\3258\377\322\234\225\270\224\021\340"
+	.ascii	"\242R\342z\321\024\345\312J\245\034J\f\314\314\245l\212\346\214"
+	.ascii	"!+))Ipf\fM\321L\225W\344Q\331\f\345Rf%g\306\220\225\362R\203"
+	.ascii	"&%.\252\246\350\222\nCS\224\213*G\271rNVZ2\235\2242\023C\216"
+	.ascii	"re\311Q'UNS\324I\325\024\345\322\262F\232\002\315\250\272\210"
+	.ascii	"uU\261TMJ\231\205T\326\222\231#m\202:3_\316vm)3\t\220s\226\223"
+	.ascii	"\311\267|a\341\222\244,\222\212,\235\026\232s\366 \225\324\345"
+	.ascii	"\314J\322&1g\316bICY\312\003%T\232kX\251\322++G-\345\234\201"
+	.ascii	"T\316J\233\2459ge\3169\206\231\005\315\031FN\323SJ*\347f\007"
+	.ascii	"\251\234\245\214[\312\271\327\372\340\250\232\242]\316\2368\265"
+	.ascii	"\35033A\225\366\231\371\270\230jT\211\226\243\264\250O*+\277"
+	.ascii	"\306\320\233\341\330\r\246\270\306*Y\330W`ch\033\214\273/\274"
+	.ascii	"\0163a6\270\242\215\037\303\342\251\237\320\330!\021\033\034"
+	.ascii	"T\273\311\221\036T\340\260\330\311H\321\022cM\312\222\333h/i"
+	.ascii	"\271\01699wE=\207K\2244\035\026#rcj\252\222997:\350Z\343$\352"
+	.ascii	"\023Fs\213\354\3556\332o\035\267\223s\225\bap~~\177\231\311\024"
+	.ascii	"\001\327\341.=u\371h\374\341\223z\241`\033\351\027P/TM\325\""
+	.ascii	"nDd\240R\346T\343w\020=bv"
+	.string	"\326i729s\325=\211\264\220N\213\2511\275\"\367\227sf\353\265n\263\321&\322C\336j6\017kMu8\251\270F(D\275\320\207z!\230\332A\032j\243\237k\264\032t\312\032]j\nb>7\274\020\006\020\263!\323V\364\211Y\377\370[;s.\242:q\021\374\322\330f\273\301\307^\217\262\264g\336\215\306\357\262\277\307\232\254w\3248sV\022nq\222\372k\334;Vgh\365z\336<\260W\227\251\027\304z\207\345{\306\270\333\361\302\217\026f\334\200\232\311\304\005\362h\321\270u\364\363\035\3269r\207y\340\314y\331a8`r^\342X;"
+	.string	"k\007\200}t\351h\033\342\013[\340\260Tn\200\255\320l\2365~\203\265\r\353\314\034n\254\206\224\301h\334_M\303F=t\r\353G#\211\252\361\205R\252\013r\266\036\206vp\320z\030\266\214\236\367\f\235!\263\t\305\021\001\314\313G\343ku\274<\304\220\305m\315\350\342\272\2111\244\017m\253]h\247\2156W\307xk\331#o,\213w#\314\331\311\344\311\325Y\026\357f\t\315\314\0307\346\336\331\037W\303\030\202=\367\316\376\356\013\"sO\025\017\261T=\246S\217\213\250\307?\324\020\252R\0227\263\346wl"
+	.ascii	"\245$\225\275h\0275@\276\310\274\336-\332\252[\260\321v\321U"
+	.ascii	"kH\\\264TO]4\246JD\bV\007T\266\356B\2371j]WS\027\315\204\321"
+	.ascii	"a\203\r6\030\332\030\342\025\250\342c\032\352\261S=n\261\323"
+	.ascii	",d\224\2409\032J\260\214\233\026E\260\276\346\3740\333\025\215"
+	.ascii	".,\347\244\311\251\245\211\223\\<,\033nL\032\277\275\341\270"
+	.ascii	"/\317\035^\336\224\300\035\307\275-7oD\215\030\301c6\355\212"
+	.ascii	"\334\037\316\223\251\247\346\223\310\211`\267\016N\245\337\316"
+	.ascii	"\022<)w\1772J\234D\325p\303mX\317\"?\032c\266\232\301=\275 ["
+	.ascii	"xM\003\223\020!x\210\206\260\264 b\1776O\252\336\250\242\307"
+	.ascii	"Cl\035\227!\322\263;'S`\276\344\231\231a4\351\025\2712&RVS\240"
+	.ascii	"\307h,\226D\311\215q\220NS\221\364\221\345h\214\317p\330\035"
+	.ascii	"\226+\2151\020[\247F\255pD;m8E\314\005&\">|\3401\bL\257\310\331"
+	.ascii	"\3140\262G\247\243\254\254\001\314\275\2632u\232\367\266\260"
+	.ascii	"\302\302\360\030\226g\023\031T\272\340q<\326Q\244Q\304h\272\240"
+	.ascii	"IR,\206w\350\330\313\373\221Df\220\313\330\334\013=d\t\220\255"
+	.ascii	"\274\306\327q\322\241\003\360\331z4\316\232\270\340\300\321~"
+	.ascii	"\020\200\273\"W\206\253(\203\2505\251Q\003\203\365,\307`\\\027"
+	.ascii	"\350\262\236l\034\203\t\177 \201\276\260j]]\252\274}}}\265_\333"
+	.ascii	"sx\3665}6~\006&\327\271\260\f\233\003M\322s{^\036WM\230\274\216"
+	.ascii	"e\2506\364\362d4\306]]g\353\202\320(\002\006\013\013;\0310\335"
+	.ascii	";+\243\001\203J\362\332:v\332\264Y\031\343\202\265\376\024\026"
+	.ascii	"\347\325Z8\206M\233\026\225\036\\\306br\\EpV\307\030\262i\t\\"
+	.ascii	"\353{\361\002_u \313\313!\367\3270\2648\261\201\233\307Wa\226"
+	.ascii	"\262\270\365\021\022}`9\334\324W\341*\334\242\203\363NY\202\301"
+	.ascii	"\225\345\334\334\301__\200\364\341\026\270\005\300+\247`cl\025"
+	.ascii	"$\203\210\\\343c\370R\217\301\311\304\314\276;\221\227T;t\313"
+	.ascii	"\25707\220\311\f9,\352\217Y`\026\355d\207\n\334p\305\220\257"
+	.ascii	"-wz\277V\364pTOR^\366 A\366\274\371\002e\005\214\306\030*\006"
+	.ascii	"\352\312m\355M\2755\303r\263P\361\273S\263>.\327\313\330\223"
+	.ascii	"{\005\020+\255\264\231\223\225\216`\231\256\270Z\356\364F\211"
+	.ascii	"!g\257)O&\374\204\235\360\022V\302M6\212W\334?\274\342n\341\243"
+	.ascii	"\221\302E\207\364\006c\271\225\017IM'\316\254L\261\362~\301\331"
+	.ascii	"J\233\320\\Ec$\257\253\313\022'\331(V\276\203\007\233\300)\177"
+	.ascii	"gC|\007\341\236\260\230\032\33706j\007\345\245\003\214\215^\301"
+	.ascii	"_azA0G\343\033x+N\312'\250\306\347\3629\334\"\356G\223\033\352"
+	.ascii	"sf\250\317\271Ro\0275\3124\206\223\306\317\261R\2373\245>\347"
+	.ascii	"I}\316R=\216`\226;\2152\331\342dj\325Z\257IT\022\240\252A\337"
+	.ascii	"\255\202\343\003n\206\033\025\f\330x\342\326\030Oi;\035O)\276"
+	.ascii	"\033\276\034lh\215\177\367\204n\203[\256\032_)\352\022\016\225"
+	.ascii	"\02031\216la5\376\225\362_$7\212\n\006\005\2754>\237\3350l\265"
+	.ascii	"\236_(4N\224L\203\310\305\375Jo\334\305;\321\314U\"\220\315\360"
+	.ascii	"Q\371\002l\f\225\001f\345K\343{w\235\334'\277\214L\222(\275\254"
+	.ascii	"&34"
+	.string	"\362p\360h\334\366s\303\313\344\327\356\227\2111c*\261\021Q\177\353\356\222_\346\n\336%q\n\242\376\322\275\200\212\013=\032_%\352\022\3163\204L_\232\225\253\344\277rw\256\303H\320QXM,\215?\265\033\2067Vgx\221\364\374&i\035kvv\215mp\252\336\336n8UI\202\263d\304\310u\023!l\353iSC\256\355\312\226\266\266\353\006%\fk*\204\222\331\021q\353\264\341\2123\032=\370\326\326.\020.C*\251\237\337\237L\0172\253\244$jj\027\232\227r\n\370\302\234\2462~;\274\004\031\213F\257\230\0160SU\311\213(?\270\322\322.\024\013\226\241\030\214:\255\306\277y\n\022\344B3\344\254\366\3267\025Q\246e\016\2127\003\206\266\344\302\237jfv\201\234\310\033\002\341z\206\022*\027@l]\330\216\256\250&\252\017\037\355\007\b\347\347W6\323\303\205\026\276\260\335\262[\366"
+	.string	"\266\276)\n\263A\275\306\267\341q\307\356\330\007WO\233\027w\307\335q\305d\016\300E\346\006\026Y\026\263j4S\250\312\200h\t\263\321\033\326f'\234\313\260\022?\320\244\334\305hYf\301*\242\376\336\2607\307\275qu\364\235\252d\252n8\326\2465?\324\327\320Po\373n\b\006\326}j\266t\331\317\257\214\213\024\325\033\213\0325\332\357\001n8\2468\312\245%\\\343\327,\325\333\036\366\312\260\321+\343~e`^"
+	.string	"Jk\232\231Y\"z\220\205\335\363\316\250\301\222C\372\004\332l2rv\205\213\353ve\310\231\210\033\215\032\257\250$\312\256\035w.\352\310_\235\323y5\034\3532W\026\325\322\272Y'r\316\001*fl\206\222\304\"c\221xL\312\024\223H<F\243\242\"#\240\f8\350\340\250\bH\230$\216\220\263\022\245@\026q0X\177\2229H$\242d\322\3508\224\002\207\017\215\340Y\217HI\342\252\"&\003\016\030|H0\241CDDJ\036\213*p\340\001RQdt\234\300JTTat<!\250x\002\020\210!\344zT\201A\020qE\301\207\004\023:\030>4\202\307\250\310\201\007y\\W(\036\2032H\376 M@\026\211\210\212E\303\017\215(!\205\n\240\340I\256BGbR\003\023"
+	.ascii	"\031\021\371\254G#\037\034\026\216\214|2$\217x\204\216t\200\214"
+	.ascii	"H\023H\256H\032\243\212\026\"\177j\222?F\241#\241Q\350\350\256"
+	.ascii	"*(\"1\022\271\036\203\202\2101,\034\031\001\341c\362\350\336"
+	.ascii	"\206\205c\022Y\024ZQ\370\tZ\215BE\"bL\320\212D\302@+2\346\304"
+	.ascii	"$1(\371#t4\342\346\347\250hM!\271\"W\024\204\216@\230\200!"
+	.string	"\271\n\321\230@\0265\250\260\202\211\017:\0340\004\255G$d1\003d\321\221Hd\002\t\242H,ZQ@\022\031\035\223@AFbQ\221\221\017\320Q&\207\304\210\240\025\250\270\302qE\221D\0223\370$\213\306\n\320 u\204\214\305c\022\305\206\021\222\253\020N\t\311UH\347C#\200~\214HG\036 \025\002@\n\021\211& d,\026\035\21149+\320\t2\037\220\306\365\250\310\310'\250xB\222\230B\2055I$B\002\"\"\002\025\340C#x\202\210\212H)<\b!\245X\203\204$F$\217\304\243\021"
+	.string	"\250\031\001\251\003\006:=#\220&\254BF\342P\022I$\332\260A\005\017E(4\370\250P\302\232$\006\035m \347@\305\343j\\\205\324{"
+	.string	"\302\002@(\221\202\230\227\b\201D\b$\206/\021BOO\b \364\250\007\241\347&\177\222\304$\212\233d\315\372\343C\202\t\024\311'k\326\2375\310\310\204\343z\264\256)j>4\342FM\"\327$\261\204U\210x\\\217\212\2107\311\037\016:0\242\200x$a\310D\221z$\016\001\341\230\017\215@\376\334\250ADE\025F\244\231\034\344\217\n\025FI$\037\025P`D\224!h%JA4\2561G3\311\037\344\006\326\242bR]\213\212)$\217\304$R\346C nt\264\036y\222FFG\036\032\344\217PQ\205\321(\005Dc\261(\003\n0H\032W\344z<J\032\031="
+	.ascii	"\255@d\263\376dX\1774\254@G$#\024\3075\271\232\2204\256\307#"
+	.ascii	"\022P\206\344\017\b=*\013\311\"\020\361\210\350\203\223$\216"
+	.ascii	"\240\302\212D\262!22\032\341G\210L\036W\"\023>+\022I\203q\005"
+	.ascii	":\256'\034\025!!\215F@\037\220E\344z\\\223H\026\206nV!b\222\310"
+	.ascii	"h\005\"\242\025\210\210\bI\205N\322\210d\344CD\264\372\214\260"
+	.ascii	"\002\035\215TlX\301&\310\250x\\OPqTB\222\230\242h#d,\032\217"
+	.ascii	"D\016`\220\374)\2214\026\221b\336\323\343\243\301\0060@\001\025"
+	.ascii	"h\004\013\3075\231$\246\340A\036\215\220\306\025\311c,\022\213"
+	.ascii	"x\200\216H\236\021\037\210\210@\305d\361\350s4\232\200\321\250"
+	.ascii	"\230$\036\221HH\022S\254\300\341-Z\b\257<X\302\325\274\360\352"
+	.ascii	"M\035\023b%\256\261\360\305\337\320d\304\271\370\033\316\021"
+	.ascii	"4>\2607\036Gz\264\301\251\302)\341\224\320*\013\004\204\260\330"
+	.ascii	"j\n\255\204U\030\210R\210RX%\244\342\322rE\245\233@q\300\244"
+	.ascii	"E\243\b\231V\213]r\004nH\232*t\022:\t\245\024@\267\244\242%\214"
+	.ascii	"\272P\352s\302\245*[\362\032\013\241>\247\006\262\005\201\322"
+	.ascii	"X\370\364\271\030;'][\033b\250\277\260\3516\331\234\2555\357"
+	.ascii	"\230\320h`"
+	.string	"\304ya[\032\202\303\347\224\021\265\302\255&c9\253R\212\363B\207d)\t\217]e\221)\273\345\027MT\331\235T\250\024f24\257\245\306\027\312\260rJX\206V\337Vc{\327s<x\341\224,\201\t#\370C\025\026\245\361\261`\030\t\004q@=i\214\003{\216\301\004\300\310\\\\\343\230/\030\020\255\251\013\006\374\361\237e\263\321\302\352Ic\231\037=\307^p\364\336\270\344\350\202\271\270X\201\206\271\330d\275\340\245\245\347x\213\360\312\316\005\260\3064~8\013\315\236\332\035\033\316\362\343\251\205\3530\022\034i2dFc\3411\026|\005-\214\024\017\272fs\004\nZ\233\225\356\013\3437$\016W\021\313\001E\262\2421\024J\003\247\305\326B_\213k\367\306\203l\312\035\333\025)Tc(P\360\236e\372\211\320#\255\257\205\277\334la\347\307R\216\367:M\211\255\311\326\030G\351\273\353\301\350\333\323"
+	.string	"F\257\363pXxA\201\345Y\274\341\213\025\201nx`\177L\24285\236\232\002s6\306N\260\223\013\344\204R\004T\360\035\276\273@d2\223\204\235\006;;|5\243FFe\215IKU#\321)OK\356\262\016;k\366"
+	.ascii	"\277\240\321u\234\215\032\024\2303\205Q\250sC\344y\240\356\234"
+	.ascii	"B\016\t\215\220&I\322\030\023\025@0`H&\233M\230\251\017\023@"
+	.ascii	"\223\007D\242\022\206\245QnF$)(HJ[c6\251i\200\351~\344o\312M"
+	.ascii	"[p$. \3326\221\226\212v^\352%O3@R\371<t\305\257Y/\275 \247\332"
+	.ascii	"a\t\\\270l\303g\221[\211\n\247K\250\376\277O\202D\244\340\204"
+	.ascii	"+\233\205\245V\322\003e\032:h\330\351\031\t\320f\317K|\347\266"
+	.ascii	"J\216\234\235\361\322\006?.ay\027p\356(\352V\364\343<\305\271"
+	.ascii	"\372\020~\334m\304\013,\n\227u\t\323\230\321md\204\352"
+	.string	"\n<6 \0057\300&\336\326\372s\"\374Da\363lZ\375\314\017R \272\206\344\021\005\023Ohu\013\230\362\317Wi\245K\354\270SrIu\217\022\003=\3337k\240\242\372\374\2315\202J\315\375\224\2663\377\375\001\315\t\355I+M\021\270\204\214\214\201l\007\211\026\253\300*\343\311t\351L\374\243\031\312\255\213\271\322\213qM\f$\\A\r\252\272\025\355\242zkiO\372=\231vb.\351\204YB\340\243n\323x\315m,\027n'(JV\365;\212k[\216\"\t\274EJ\211\366\245\263\035f\034\220ty\310\213\262\317X\034\255Ni\213`\251\214&\302\203\274\306\244(v\347\343\t$\217\377\230\250\340wn.\377_\340\227\013{%\fec\202\025\nW'\367\177\n\b\353 \021Je\2602k%'k\325\252\375c\360\027g\270\364\254\254\342\300\212oH\005n\310D\264&\261\240\f\245\3270\203"
+	.ascii	"\215\035$\267(EPhFQ\t\035\024WhN\234\034\025\303l\326\r\221\363"
+	.ascii	"\317\313j\210\326\334h\264\241\026g\213v\246\b;q?\244g\317\f"
+	.ascii	"=\362\0224\347\254\bC\251G\020\003\213&94\264\346\236;r\361\304"
+	.ascii	"\257e\006\315\377;\316\036\213\264@\226\217\320\350H\322M\b\003"
+	.ascii	"\356\025A\322\264\n^\250^\201\027\376 \333\026N\237?\007\377"
+	.ascii	"\320\234s\r\033Njx\201C&\351\007\327\002\240L\353\\C^\374\256"
+	.ascii	"\323Ce\317^\370\335\302\300\006/\270\274K3\305\217N\325\246\240"
+	.ascii	"\221\305\310\022=\372zt\323\034@\222\340\356zU\377\240\006fw"
+	.ascii	"(T#)\035h\302\267\001\363\355S\362,\214\016z\300\277\273Z!\341"
+	.ascii	"h\337+n\263\357\233\236Kuy\322\261\227\256\375-&\270\006s\252"
+	.ascii	"W@uF\265Q\267?\222\006\230\212\263\323\037\027L'\230\235\253"
+	.ascii	"\212wV\343\006\205\265\243\3472\005\2353\204\316e\266\250\256"
+	.ascii	"\333\370&\267\360\314\250\207\306@_\365\205\016~\274\036\271"
+	.ascii	"\037\276\320\277\262!D1\031i\2115\024\360Oj\244\030\242\313Z"
+	.ascii	"*\221\302\243T\262\372\342\2511D\fzP\315B\204\236VP\207\007\313"
+	.ascii	"\351\363yG\345\006U\266\302j\324m\223\021\262\036|\t\177\317"
+	.ascii	"%JJ\204~\340\333\266T\356*\234\353W\236\f\214F\031\264_\307\304"
+	.ascii	"\023\264\234\224}\257\013\300\brL\245\300.\244\030T\224a\316"
+	.ascii	"\307E\254\232\351\031\200E\302\305\003;T\266G`\224\220\002\221"
+	.ascii	"\307j\340\241\260\223\203\013\337`\206c\317\255\366'(\377p\320"
+	.ascii	"?\227\3529\n\252\260;c\007KK\0135\3550=K5AqB\274G\322@\307\251"
+	.ascii	"\367\374\022\2167\344\367\345\312\225\277\032\"9\274\215\326"
+	.ascii	"\273\244\226)\007\023"
+	.string	"\250=\"r\024\240\242\030\311{j\300.\"i\356Z\344\026\300\004\3741\217m\217\364\271!\373sn;\032\005\244\362\247\022~m\204\202\2454\362\230\f\022\316A\260\204\005\351\036\210[\177\370.\353\352.W\363(\013\355;|\253\003\3728y\324\364T/\3550\313\252ul\216\312p\n\205+\355]\035M{\314\177\022\354\214w\036\344\365\264b\250\206=\243\267"
+	.string	"%3\256\343\216\377\030\325\240\244\2625\017\032"
+	.string	"\372jS\277\301\024\363\255dw|\230`*/\210,\322\206\372\314\210\277\244\313}}\005I=&\350\275\363\303>^\355\362\314\244\b0<\364\007\036jv#.\230\370\032\222\200W$\034\2720\350\tV\245F\310\251\202\272\363\205\323\376ah\303d`\255\212\220\372\"\353\243#2f\300\272\343\235\363v\302\200\230B\326\020\266"
+	.string	"\262\307Tj\013\243K\371&\232\220c\330\007k\316)\347\242\262\353\216#f\0251nG\234~w\276\346P\373\2377\263&T\211c.\230\034\261\201\036\215[\215\037\374\321\020X\253\020\361\372\227\362\307j"
+	.string	"r"
+	.ascii	";\325\333`r\002\313eq\342\242\271Y0Z\233lc\351\f\246\374Y\022"
+	.ascii	"*g\356g=\333K\351\254\351\241\fP\210Z}\371\215\030&\031\217\304"
+	.ascii	"\233\311\273\337Jls=\"\342\230\021\016\034H\244$FBO~\276c\241"
+	.ascii	"\361\215\276\177\306\177\360\006\326\232\203\201\342!L\2777\032"
+	.ascii	"\324\031\327N\316\315kg\272\311[IY.\225\022R\035Z\223\3710sg"
+	.ascii	"\315\352\251u\001\n\323\037\006xz\222H\3128\2210\3249\027\223"
+	.ascii	"\035z^\255V\254\035t\215\356\326xXy\013'\230\305\022\301\357"
+	.ascii	"\224p\253\363\234\344\301&\032^\313aa\224\220|\212\277\216\353"
+	.ascii	"\331n*\316\241\260\244\333\037\3068B\2018u#3*\3733\224bs\005"
+	.ascii	"\240d&\241\005jC\252#\232\236~\t\2400.\220\256r\364R\202H|\340"
+	.ascii	"\275}\327\024 \006\225\314qs]\337\222\007\330\240\335:)|\377"
+	.ascii	"c:\232NB\251\024\340k\226\242\0079B\254>\366\303O\265\0051\366"
+	.ascii	"\245\2104\360\262\016\273\326\241\223\341K\347\017\333\234w\355"
+	.ascii	"j\244\207N\351\221\301P\234t\240\205]\361\214\023.`\200\310\263"
+	.ascii	"\233\354X\233\212\"w\324\273}k\370\3351\006\no\363\217\357]7"
+	.ascii	"\2232,b\341_)\315\302\241q\345\232\354\3215lQ\223\020m\211\370"
+	.ascii	"\322\021]sfP/\275\212pP\324\356\206&k\344\346u\246\300e\025e"
+	.ascii	"\347\267\352\366\247\205F\337\234D~\241t|\255\244\020\307/\355"
+	.ascii	"=\342\n\037\335\254\"\237^\3566\261n\023\004i\210\034+A\370\203"
+	.ascii	"8\021\021u\364\230~\024;hoJ\224Y\t\204Z|N\326]\352\\\233\211"
+	.ascii	"\212\231E\006%\276H\327q\225x\325\261Y\371\254\220\222\3178\264"
+	.ascii	"k ^;_a\317\213{\254\317)l\273\302\013\204N\\\271Ul\247\263\177"
+	.ascii	"\020\336v\275\322\367\333\240\\\n\344z\257\363\321!\222r\275"
+	.ascii	"\314\335H\026.\020\033\205"
+	.string	"\357\335\305ka\255:L\244>\227\357H\220\025\300#\017\202-B\032|6\375\034Z\271UO\250\274\367\207\314\351\031\2142\237\3118\310\366P\372\260l\273\303G\341\033\2120'\315\327j8\250\340\034!z\266@\364\200\354\207\371\255\301\003\0177K\366\201\n\235[\234\035\272\206\336\001Oc\307\312\246\253_?\036\335\333\233\001\321\t'\230\327e\013\260\253\361)\300\326L\301\237H\324\345;H\223\312\302\023\2122\267\320\250\350\264\367\260\323\264\301E&\203\022l\257|\355\306\347I\345\316sE}\002\301\323\022\336>!W8\2355\005|;~\270]\n\371$F\327\256)O\252\313\364\353\254\236x)$P\312W\343e\025i\304qy7\252\004\253l\203\350\036\226\353ob=\305\247?\260n\203\334\257~\261\375\246\365\205\277t\241N\270d\250\211\321\363c\247\207\300\221\007\311j\264v\203r81\n\260\240\261}\247"
+	.string	"\210\325\001\017\230\271\rjU\240\002&%=\311\\\272]y\n\272y|\330\221\034\360\373\363l&F\374\346#w\242\034p\304g\b9\200\025G\371\277\372u\310\032\237\001@\313\r$Q\336g\316\025\253\212\017$\031\345i\257\033Q.\335K\313\300\371\367\204l\3166l\277\264\033\230\n\035\t\333l\322jB\342!\364\352E/\220\005\370\233\346\203`\311\364e\336O\350\036\200\024\330\303o\354H\360\f\226\332\222\355\f\231\261HG+\346\222\335\t\367P"
+	.ascii	"\226%\227\215\313\013\310\343b\027?\262\267\356\343\202\312/"
+	.ascii	" xT4\005\374\004p?\357M\300\007\356|\033\031@\232v\025L\220\266"
+	.ascii	"sf;\251\273)uA\364\304\327S\3551}\270q\304\206\033:\203\213\334"
+	.ascii	"\332\216\177\033\276\025\024N\375O\031\332L\273\253\346\345\270"
+	.ascii	"\325\315>\242_~C\r\017\342y\265\367M:\307\334\377\304\344(\227"
+	.ascii	"Qh?G\214\005<\333\177\257\355\323b\262|\367\345\374\304\263\247"
+	.ascii	"\370K\337ZG}\303\203\017rN\375vg\273\237\245\275\327\375\357"
+	.ascii	"\244\017\371\273F\326\203\3227\203>N\233\263\257\307\004\263"
+	.ascii	"d+\3058\331I\247\336kO\0316j\337\277\023\237\325\331W\342/\237"
+	.ascii	"\356\250\260\342\301\226\374/\237\357\324\035h\232\277a\200\207"
+	.ascii	"r\3573\336\232||,\3232\257\002\373/}\220\177\034?\262\230i>\006"
+	.ascii	"\262\205\310\327a\007\371tL7*|\343\234\032,\264\005_F\315s\222"
+	.ascii	"\270\3252\260\271\037\376\327\3253\273\272Snm\263\256\032g\233"
+	.ascii	"\227\256\364\263F\350\016\340\223g\230\334I\352\177u\326\332"
+	.ascii	"\230\217_z\210}i\274\337\270\226r\034\361\303\026=!g:1\203\235"
+	.ascii	"\205\260[\331\016Om\215\335ge\377&\203\036S\016\270\035\244\314"
+	.ascii	"[\337C\332\373\340f\362&\363\255\342\201p\240\314\241\201\311"
+	.ascii	"\202\362_>\r\350\214\310?\272w\304\276\3733\244\273\223\367B"
+	.ascii	"\247\235\316v>$\202\245\345\267w\315?\355\217\306\324\311?Q\371"
+	.ascii	"Z\314\313\3148\375\257\300\300\326S\373H\237\347\fi\237}\336"
+	.ascii	"\323\032`\032\344y\374t/\2219\264W5\217tal?k#\243[\370\364\302"
+	.ascii	"\227\277\317\350O\264\177\202\345\230\353)q\310p\006\350AdMz"
+	.ascii	"=\306\001n\262\236\333\262\201\033\255\t\226\271c\304\266\027"
+	.ascii	"\216\003\265\357t\033\366\276\376DF\036\216\323\030\377\273/"
+	.ascii	"\315\326\325\334\316G\226\265\206G\354\240o\r\001|\321\005L\005"
+	.ascii	"\335\362\300\234t\003"
+	.text
+	.section	.gnu.lto_.symtab.8ceae77c9d7bcf30,"e",@progbits
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"batteryWarningVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8ceae77c9d7bcf30,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,490 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.920c90a433379439,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\355\003"
+	.string	"\024\005\006\001"
+	.string	"\n"
+	.string	"\214\242\351\201\002\036\002"
+	.string	"\001"
+	.string	""
+	.string	"\001\240\342\234\212\n\002\304\236\330\270\001\006\002\002\002\003\003\214\230\327\245\016\026\004\002\004\002\005\002\005\004\002\004\004\242\302\263\302\013\005\212\373\211\303\f(\005\002\005\006\201\243\307\330\003\007\b\t\240\342\234\212\n"
+	.string	"\023"
+	.string	")\0212s\341A\002\024c,`p\312\300J3 \200Lb\354(@\030\b\001\362Vl\274\020\200"
+	.ascii	";\343\346\016*\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.920c90a433379439,"e",@progbits
+	.string	"(\265/\375 b\265\001"
+	.string	"$\002V"
+	.string	"\004"
+	.string	"\001\001\002\001\003\002\006\002\002"
+	.string	"\004\001\004\b\004\001"
+	.string	""
+	.string	"\004\003\003\001"
+	.string	""
+	.string	"\005\002\001"
+	.string	"\001"
+	.string	"\007"
+	.ascii	"V\020\022\302p\177Z\006\310Tl\276X\267\2016"
+	.text
+	.section	.gnu.lto_.inline.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`\263\002M\f"
+	.string	"\226T9,pI\222t\274^\361\037.>;x\023\213U\210\344\016\321\350\300\237\365k;\377\255\303\275^\305\300y`@\330\377\033\261\255\355-w\n,"
+	.string	"0"
+	.string	"/"
+	.string	"\277\244\247\"\024\342\201\013\001\202\370\214.\307&\264U\314\277\271\2509\035:h\313\360\017\326h;\340\336N\260\256\r\202m+\340o{\020\fZ\306\302\247 tG.<'\033\204Ah\025\004P\330)\213S\230+\3008\346\261\363\032\326\325\035(\241\3551\253\016\310'h\313x\364\222\020Vm,1\352\216\245\257\366\016\002\360'\254z\224@\216\263g\031@\022>\225l\017\244\260\240A\005\002\037\r\021U\257\260\177Vca\274\032W\303a\337\020Q?\003\377\373\030\336\bMt\035)SQV\322\251\271\231f\272\236\226\227f\231KU\2576\306\036C26;\003M\250\261P\005\235!\nKS\2224\007\220\002)\253q\007\021"
+	.ascii	"-R\212\224\321\264\236\2259\356\204\315O\237\346Y\241\200\274"
+	.ascii	"\340\253\201\331\246[3Y\020\256\245f\276 c\257JH\202\257\217"
+	.ascii	"\017\031\177H\246\021\216\212\275\242\354S~\013\257\221Sy=>E"
+	.ascii	"'\255\307xGJ9\216SW\331\277K\345,\214\356\022j\350k\032\n\022"
+	.ascii	"\347\250\3704-\013t_\364\017\212A\2503:\314\233\275\213]\260"
+	.ascii	">\317D\274\3524q\336B`\265>\326\367\356L`+'A-~c>\242=P\177\303"
+	.ascii	"\247\264:\017\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.920c90a433379439,"e",@progbits
+	.string	"(\265/\375 \223e\002"
+	.string	"\342\004\016\026\260%\351\347\3600\024cj\235\320%I\022\022\032\307\244\355-S\nj\315\242\021+W\200\337`\275\013Ox\033(65\031O\306V0*Ne\245\2319?W\363\222\203\006"
+	.ascii	"K\025\025\246uP\351\351\316\202\251\f\260\2016"
+	.text
+	.section	.gnu.lto_.pureconst.920c90a433379439,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\002\205\004\003\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.920c90a433379439,"e",@progbits
+	.string	"(\265/\375 \266\345\002"
+	.string	"t\003\252"
+	.string	"\004"
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	"\002\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340"
+	.string	"\002\f\001"
+	.string	"\340"
+	.string	"\340"
+	.string	""
+	.string	"\002\001\300\005"
+	.string	"\r"
+	.string	"\001\002\006\003\001\024\001\002\016\001"
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	"\001Q\002\364p\220\007+;k\364\244\3011"
+	.ascii	"T\003C\242Z\340y %\260\3148\273\2206\200\005"
+	.text
+	.section	.gnu.lto_.lto.920c90a433379439,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.16.920c90a433379439,"e",@progbits
+	.string	"(\265/\375 \2175\004"
+	.string	"\204\007Q"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\373\013yw\350\324\005yu"
+	.string	"\005\001\006'\001\f\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.ascii	"Z\205H\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_isBoardAlignmentStandard.17.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`M\001\335\f"
+	.string	"\206XU@ \217\232\016\303x\360\\8\243+\300\003p\001Nd\217\024\034\277>\002\">\003\333\304\201}\333\330\226\0240h}+C\303F\250"
+	.string	"\204"
+	.string	"\312\006\\T\274CIY!\333\206]&\032\331{K\231RD"
+	.string	">"
+	.string	"B"
+	.string	"\266\017$\330\230\023\240DA$LTX\354v\224^8\347\021>M\216\037m\274\r\334\212\023-{\264p(!\337\244yR/Z\311\313\330\335{x\242h$\231\321\306\356:O\264\nwt\333 \2669\354S\bow\327\2729\372\347\217\232~\232VM\247\246/M*0)v'\204\\\254\t8B\203\355\215=\331\316\264\317\341\0356\377\214\034cwC!b\2673`\004\322\241\273c\342\241t"
+	.string	"\361\320\001\233A\335T- \353!T_\002\203\376)\227\362\324<\001\341*\251\013\236\273\233\251E\342\325\002JY\361d\013\333\330A\210H\273\036\005\376\207+\202\224\341\320\037\211\207W\001+\237N\206\354.K\345\354\007\034\027wh\204T\232\217\312\201\307\203L\203+c1\240\260\313\302*\rFU\036\231\017\252\343\302(\215\001\266@4\027\025bY\0275u\373\267\2729!\201\347+\360\247(\266#\315\350(\211\237Fz\223\027\235\fIQ\271\250\335\006\034"
+	.string	"\200\204\324\034l\274\351\231\315\276\252)\002\002\007\204"
+	.string	"1\206\220\n\202A\b\204\t\003\214\002\304\030B\016\270\013VI\330m\017sk\3062.\243\2025\n\325\263\020\231\030'\t\305"
+	.ascii	"\335\250yz\273J\031"
+	.text
+	.section	.gnu.lto_initBoardAlignment.18.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`\223\003\305\026"
+	.string	"\206\353\222F\260\030U:\360\307\373\016\243\371\330\020\302("
+	.string	"\037\271\205\363\255\007\371\247\343\024~\241\220\016E\202\004\252o\367`8\230\375T\036{\265\364\217\232\201\037\247\002]\371\236\022\202\n\223\344\r\016?"
+	.string	"\205\364?\331D\312\224\002z"
+	.string	"v"
+	.string	"\201"
+	.string	"\266\t\233\364\370\367L\262w\347!;\017\305\267?\213"
+	.string	"\306\317\216\320\256\213\004\217\226"
+	.string	"Tz\332\337yNv]\212\003\330\315\t*\262\273S`\006\243G\357\036\003>\216\036"
+	.string	"|\264\314\2562\340\246\024t\353\021\332]\224\326\270\354\"0~\2322\177v\221\210\246w\020\306\343M~$\034[\252\tG\305g`w\357\363d\201S\313\024\321\354\256\023\207\363\342\036\335\366\t\333\030l\315\005!x\322\022\225^\220-\265\370>\266\271\217p\264kk\340\377\200(\341\353<\372)\300\307\223\336\347\001\226\b\311\310\351h9d\357j\2514\354\177\2539vL\317\304\264LL\237\256\373M`\232\024\3230_\372%\246G`Z\024\323\340\227\2161\375\201i\215\351\374\322' \273\365\020\220d\267\305\320\226\005\212Gp\234\367\333\367{\356c\223l\342<>\020\035\031;\217\001\237F\375\232\334,\342JF\273\373\251\342rYt\2526\207#1\221\0026\354\016\357y\210\231\262\273\r\036\277\036\334\025"
+	.ascii	"\231j\177H\345q\252\006l:\3635\365\267.'\275V\310\325\244\364"
+	.ascii	"\350r\025\350\033\371\021\225\257\343\025+\217c\201\217\016t"
+	.ascii	"\ba\321\335\356\fD\361\355\316\200p\336c\344\330a\205\347\335"
+	.ascii	"\356\306\031-Qi}\310\214\336\311\215\177J\343\307e4\243\210x"
+	.ascii	"\020\031}\020\224\273;S\007\260\325\b\226+\202+l\305R\261\360"
+	.ascii	"e\212`\262jA\314\265\262q\261Z#R!^\251\020\004\n\366\na\256\025"
+	.ascii	"\f\345j\245lP\252\027\f\265\340\200C\022\253\027*\026\206/\024"
+	.ascii	"iG\373\267\232c\032\232\326.\262\302\313!\027\310\363<J\215\002"
+	.ascii	"\033\273\264\343\374'\2072\201BM\r\370x\236\367,\340\354\013"
+	.ascii	"\031\3628\307p\001\272\321\231Ijk8\220r\201!\275(\314H_\364\023"
+	.ascii	"\322z\223\221\352\n\335\016\221\332\033\316D\b(\212\n\006? \300"
+	.ascii	"\002\231\031c\007@BJ\016\212\246?\265\361B\232\202\222\306\272"
+	.ascii	"\265\216\251h45K\371\254\025\250\206\310\344\036cR\022\303,."
+	.ascii	"\263\236\307|\002<h\021cw\020,3\222\3050\350\302\373F\b<p\007"
+	.ascii	"\243{\340\205r6\206\240('\361\265o\206\357\\1\002\221\272\230"
+	.ascii	"\242\340\016\350\302\005Q~U\263\270*@\001z\303\352Y\343\034\037"
+	.ascii	"3- \003\037\022\367\346\035*\3227w\352%\025\355\274\"\241\030"
+	.ascii	"\320\215\222\323\333\265\312"
+	.text
+	.section	.gnu.lto_alignBoard.19.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`\200\004\r\027"
+	.string	"&\252\220I\240TN:\306\377\033r\206\223\260\261\025,\267e\344u?\247\376\264q\323F>\025F\312\253\030i\223\027k\327\204\211G\270\332\360\214\221\343\345x9\255\007\243)\254<X\375\360\237\373\037\372,SU]\323\226\020B\210\224)\005y"
+	.string	"k"
+	.string	"\200"
+	.ascii	"\177\323\377\364\265\377\026w:\224gOE\t\232\374\213\261P\233"
+	.ascii	"EB\031H  }g\321;\223\177$\020\007\225!-\r_sN\002\017]C>\214\001"
+	.ascii	"\257\366S\\E\357K\236\272mN\244\025Ts\372dl\200|h\337q\342C\362"
+	.ascii	"7\361\241{6\220\373\222\346\b\002\303\005'#sN\335\212x\357\332"
+	.ascii	"\363\017u\031\221\021\320uT0\347\264\022\031u\270\367\266\005"
+	.ascii	"\330\266"
+	.string	"\261C\\W\362=%>lY\232#\254\"\017A:f\373\200tC\330\007\347\"\331g\272_\336t\273\374\351n\371\322\317\242\352\234\252WT\255\242j\234\252ST}S5\212\252m\252\256\251\372D\325&\252.Q5M\3253U\223\250Z\246jR\325\243\252EU\207\252\006U\275\252VU?\200h\"GN\306\234\033\306\216\314\254\260j\304\231\002/P\220K;\017\"!\343\206KnN\352e\305\035\227E\314\206\177\277\372\214\327(oEC\357+\361\241\270\277\002W7\\Pl\350\203\313\356\202;z\305\360\317F\346We\215\325\256\215\217\252\226\375\352\2027\206J\b\351\230\253\374\003\300e\273\300a\2240\007~\247\212\340+=\364\204\037=\321C\377G|\370\035\301\240\302\252\244\310\227\315uE\335\370\347+\201.Ks\264u\0277\376\341\222\346\234\001\024\376\363\n\317\321\221\260\316\231\361\351\321\341\351q\260\363"
+	.string	"\247\001\017g\307@W\362ve\217N\251\353\331\301\341\321\345\360J\335\314"
+	.string	"\357 \350\360t>\273\035O7\363\315\203s\221\274\340DV\320\n9\267\276\324\312\3426\247\262+\313\"V\204\310\020\225\224EY\334mSv\364\002\373\nr\263-\212\327\217.[Xm\375\250\223-\331\232\311\236,\213\030\327Vy\253\036&\264%\331\222\331\322v\364\332\241\245c&[\222,\254\022\006\207lG\260Q\2501h\203\220TbASPv\263\006\360\002\221\231\242\007\020(\244\310\214\230Xks\300\214\203/*\3002\024\032u\265\222mkx\202\354R\001\357>B\225\220\034\200\200\307>WV:\242\347X9\242\234\007\241[\307h+n"
+	.ascii	"h\027\252\362\357%\030?\030\364\252\237HQQ\003\360\030w\250l"
+	.ascii	"\234\224\345\005\020\245\345\260\304r<\25722\354`q3\334\250\323"
+	.ascii	"\243E\033}1^an>#\"|\337\201Y\261\333\253\0271-\214D\223d\023"
+	.ascii	"\037\340t\301\202`%\005\"\277\340\347\017"
+	.text
+	.section	.gnu.lto_alignSensors.20.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`\266\006\215\036"
+	.string	"\026\265\270I\260\324Q:\350"
+	.string	"4\363\2348Z\310\322\313\260*?\252\324\347C\200\275\001\007&\rH\"\025\334/(\026.>U\373\376\244\327\207\037\253/\3607\237\242\362\223\037\215\352\037\314e\374\362\360p\301{\250\246\266\377I#\233l\231R\245"
+	.string	"\230"
+	.string	"\244"
+	.ascii	"\324\026\312S\003\343\\[\002\005\335\203(<k\005\016\251\360\265"
+	.ascii	"\177\3438tg2\217\273\324jd\203\252\326 \004O(O\035\274\fyZ\036"
+	.ascii	"\206<\265\316\346z\020\251>\311\220\n\035Tj\255\265\031\343\272"
+	.ascii	"\323f\262X\t#\3518W\347#@\022\366|\273\323\016\024\375\f}6:\360"
+	.ascii	"\352!\3455|\206F\031\0262zG\342#\2642+1\256\362\t\354\212\034"
+	.ascii	"*\321\271Ci\204\315D=\003\f\034P\212~\202>\201~*x)zd>\036\262"
+	.ascii	"\254\265\276\310'\250\\\330L\255\325\333\363\375\334-\267\035"
+	.ascii	"\305v\006\233\314\t\366\207e\314$\3204\305\301C?i\204\231\033"
+	.ascii	"\200\212\227\342\340a\001'I\276y\220\247/s\003\320\224\025A;"
+	.ascii	"[\264\203\273\235G\366\307:\215\354\007\177\231;\3351\177\272"
+	.ascii	"a\016u\277\234\351w!\327-tM\243\353\031]\313\350:F\327%]\303"
+	.ascii	"\350\232\244kJ\327#]O\272^\272\376\002\231\317\221\001]\265\262"
+	.ascii	"(^\251Z\324\307\214;\375O?\324\247\375\353\270\360Q\236A\001"
+	.ascii	"1<\2210\320\023\240\256\340!\242q\241|\2167\351\356D\242\334"
+	.ascii	"\371\b\350\301@\362\252\265>x_\277\256\245\237\221\257\320\006"
+	.ascii	"\214\234\3760f\222\323\346\"\213\322is1,\362\025*\221/L\276~"
+	.ascii	"\3438mCM\254\276\302\026t\316i\033\022\362v\372R;mBE\036\261"
+	.ascii	"\352\373\204e\234G\323\237\332\251\036qg\213~\231\2376\241,\036"
+	.ascii	"\021f\002\240>\254\245\337\316\026}\037'\211Z\273\305\342\340"
+	.ascii	"<Z\3423)"
+	.string	"\273\220\370I`[Y\276\026\211u\345cQ\253!>\221Q*\210/d2\375\360\201\230\253\334\243 O\275\275\312\263D\243\276\260\337\3036\327\253\254j\335\035\270\275\332\340Tf2\330\272\252@\233%%n\342'\216s\263\321\241\321\271\341J\235\\\315\207\321\036\"\350\340\324\334\340\200\260\021A\363\001Gs\353P\313\341n9\234\232\\\r\307\206\346\246\346\001\227\253EP\340\333\210\032\\M\347v\303\325f\301\372\261N#k\360i\355L\036\332l]\246\035\342f\3373MX\324\352\231\273#U\361\242\232\345\310\226\331\241i\253g\253\330\247\362\257\234\237\344[\316\276\227C\236\266\314G=\201\257\270\364\243\272gv\213EF\243M\033\221\220\331l\332\210\206<\242L6mDB%_aV,\026\2336`WYN\033\260\t\217x\344+\254*a\260i\003\ny\001\200\203\250a\\\204\02444\"J\nS\220\2441"
+	.string	"\003\221\241\332\034\021\3004\351\0341\021\241$\005\347s\350{2\350ud\245h~\252?H\254\274$\351pi\211#\301F\022Dk\375D\333\210\200\310\375\322x\302\335\344+~\211\033)hH\351\0231t2\304/Cb=\372\271\315\341\302@p n\370a\273Zq\336\265"
+	.ascii	"\337F\374-\270\\\323\277/\325K~\250f\034|d\177\003\273\252}\257"
+	.ascii	"g@\273\355\236dj\220\211\350e\271d\004M\351<\023\272\177J\367"
+	.ascii	"O\351\376)\335?\205\356\361\002\213I\265\243\303\214r\t)Y\332"
+	.ascii	"o|\272<l\302\202\201,\022z\303wwn\251G\2316\304\030\">X\tw\214"
+	.ascii	"\322\00253\205\261j2?`\330=b\006\207\367\324'\274p\b\334\231"
+	.ascii	"\253\003\205<&H\272\210\266 \336\260\r\252\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"M\005"
+	.string	"r\310\037(\200k:\034\216\326\231C\226\335\214c\222\261\340\335F\374\260m\030\235GFd\2115{|j\"\"\201\030\375v\207l2\005\3064\231\024\316&\343\247\260\213T\341$\212P\227z\3717\250z\330+\377\333\210\216a\261,(6xq\273\004\317\206h\017\007#[h\212\254\221p\306\210%\275j-\n\276i\251\207\273E\332\351Q;\343a\340\331\206\316q\257\330kc$\t\370\177\302V\217\355\254\002\020"
+	.ascii	"`hP\260K\341}\212\034\236\351\312\b\206\313\017\214\306Jg\305"
+	.ascii	"X\030P\307\225\363\235\256\0057\274\n\b\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.920c90a433379439,"e",@progbits
+	.string	"(\265/\375 A\t\002"
+	.string	"="
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"\001\t"
+	.string	""
+	.string	"\001\r"
+	.string	""
+	.string	"\001\017"
+	.string	""
+	.string	"\001\022"
+	.string	""
+	.string	"\001\026"
+	.string	""
+	.string	"\001\030"
+	.string	""
+	.string	"\001\033"
+	.string	"\002\003\001\004\b"
+	.string	"\002\001\027"
+	.string	"\001\005"
+	.string	"\004)"
+	.string	"\002\006\002\007\002\b"
+	.text
+	.section	.gnu.lto_.decls.920c90a433379439,"e",@progbits
+	.string	"(\265/\375`\354\021\375["
+	.string	"\252\236\214\"R@PJ\032\016\371\211\313\213\317\234\215\032\360\342\303\013\304\340|E\363\362];\225w\025\177\260\202\356\225\356z\336t\314h\324x\220\352\314\232"
+	.ascii	"\321\246\020hj\356\031\313=\226\001\245\355\257G\220\273T\373"
+	.ascii	"\247\262\306a\217\335\347\021\032\240`[7w\2232\005\310\001\025"
+	.ascii	"\002\033\002XbVm\235\233\366\020\352\024\271%3E\277iT\264\266"
+	.ascii	"\311\222\246\211\221M=\212.L\256\276\3644\216%(U\314\266\354"
+	.ascii	"`;\310\265\223\244`\236\350\270z\356\331\336\260\3165[/AAA?{"
+	.ascii	"G\306\355JE\277W\324\357\252~\245\250_'\352w\211\372/\227-)\233"
+	.ascii	"\024'#\243d+2\207\212\333\2324F\277Rj\226\255a\265\254s\3076"
+	.ascii	"\f]\273\221(\300\242\\\211\355\327\316M\367\324\225Uw\177\253"
+	.ascii	"\374C\337\261\355\332/\001\232\272\247\244vn\260\263\001\205"
+	.ascii	"\256\273\177\202\202\202T(s_\264T\364>\365\032\250\227@]+{e\235"
+	.ascii	"\037[,_\032\266\312o\220k7\367\310\026\343\021F\337\200\372\365"
+	.ascii	"\272\b\264n\006\316\243\232\320\335m\263\037K\317\352\210\375"
+	.ascii	"\220\242Ke\233\274d\016\346\352A\247\352n\335j\376;e\327\345"
+	.ascii	"\272\tc\343\341\204\321/\327\277Z\273u0fv#\273\033\004\237\225"
+	.ascii	"\021B\307\350\237\373!\315Y\237\224\231\373!=`}\322\305\032\372"
+	.ascii	"f\375+e\257|R%\324\332]\335\315\303\013#c\262c\224\327\375\220"
+	.ascii	"\252\353\223\376\257[%\341s~\036\340\377\326\0135\377\372\232"
+	.ascii	"3\376\237\3757\373\377\374\257\366\037\355_`\322\213\037\271"
+	.ascii	"\023\3603\317\377\032\376\213\375\317r\363s\213\177)\370w\202"
+	.ascii	"\177Y\374\013\301\277\022\374\353b\204\177\201\376}\340_\007"
+	.ascii	"\376\353\374\334\343_\021\376\r\341\337\030\377\276\370\027\203"
+	.ascii	"\177-\370w\347\337\233\177m\376\345\375\267\373\337\366\237\354"
+	.ascii	"?\327\1774\377\347\376\227\371\037\343\377\213\377p\377\337\376"
+	.ascii	"\213\371\277\345?\214\377\315\377\031\374\027\361\277\313\377"
+	.ascii	"\364\356\356\356\356\337'?\017\304\277\243\023M\353\266k\357"
+	.ascii	"P\361\265\2328\217\b\247\300)\260\215\236^zc\213\313\301\232"
+	.ascii	"\202\002\204\351l\203\307\207\230''\274e\016\317\201\227nZ\331"
+	.ascii	"\r\325\2746/P@\352r\f\031\331\361\274\264n9in\344`\201\215U\306"
+	.ascii	"'16r;y<YB\266\352dy\215Ua\364n\303x=\226p\231\201N\375\322\255"
+	.ascii	"\232/\016\316\305a\355\324\265w\330P5A)\353\276v\277\002\f|L"
+	.ascii	"N\367Uw\013\260g\311/+\214\376\314\277\324\027\310\232d\200S"
+	.ascii	"\177\376\323>*\273\233Gom"
+	.string	"\345R\316\267\267:\313\333\002\376\243\315;a\325\255$nNm\002v\f\362\021\375w\033=\364\332\312ds\312\230\244\202\266\364\260\366\020\020\335$\322\311uj\2112\233{\355m\344\324\222\204\344\312T&W\246\261\247\221Lc\367\272\354Iv\035\215\233lN-\223M\346\322C#\333\330\315\343\020\025\311\\&\2750\227=\311\346q\231DN-=$\211C\242\344\206\230\243\rkL\"[\207S\324Q\331\363L\256\314^\353\336.\246V\026\320\035\305T\256\035\177l\330\322S\307\222\363\310\334\325i\211\212\331\310g2\006fw\fKH\355\264\200q}\366\221}\032\211Du\016\246n\021\275v;u\033\267\237\335m\354n\033e\324\332\275BO\322\312\311\251\033\352\307\251\243\214bL\335\334\325\026\266L6\251\230Cb44\255\332\306j\\\253^\233R\252M\243V\347\220S\255\226=\314\240q.\232m\272X\333\330"
+	.string	"X\017\037t\255T\2328?\235\231\303I\203\203\332\301\350\312\205\320A\212\331\241\325\244.\231\215[\347"
+	.string	"[\206g\334\342\321\311\001J\016u\214\236\215\352\357v\200t\315i\273rv\006\316\315F\n\031U\027\243\353\306\333\266o_\267e\273\002\f<\007\331W\335\353\272\241\335\307]\022;\273$zcJ\216\\uki<bk`\310\302\250\r\013\206\247\245\274"
+	.ascii	"LV\334\246m\230\345j\252N\016c-.\372\270\004\332\322nft\255\344"
+	.ascii	"b\202WWfD\013\243,\3065\254\023\210\263\334\250\311Iu-Q\277@"
+	.ascii	")\017P\372\236\220\257/\034zV\306t\204a\364\275\033^N\366b\347"
+	.ascii	"z\350>\272\020\326J(\023\274\264$O\332x\344\222^ks\352\027\312"
+	.ascii	"\262\362<\265NV\262\225\037\255\325\330\241\254,\312\304\315"
+	.ascii	"\232!O`\214v\2558\200xu\211Q\277W-\360\0217#.p\325U\033\f\034"
+	.ascii	"\203\fg\\D\006\316\332'TO#\277\310\304m1\022\256\3321z\350&\302"
+	.ascii	"f\325\344*L\003s\261\026SY'o\261\2233\025\023Ar\022\336b%\374"
+	.ascii	"\302>\253 \270Z\013\372\t\302Q;\303\344\271\203\266p8\001\226"
+	.ascii	"\222.\262\340\342\272\327,\236\201\261\366\t\2656\017\034,O5"
+	.ascii	"2\272\356\365?O\341u\235\234\365\237\265\273K\247\216\215.+\305"
+	.ascii	"\272\312\t\273\021\304\006\243,\245\331\005\007\221*P\326\311"
+	.ascii	"Ql\300\260f\t\243\374\344pM\306\0338\306\320'1)_\232\352\321"
+	.ascii	",\365\350\013M\324\2648)3$\352\321\026T^\302L\326Y\202\255\276"
+	.ascii	"X\234\344\275\343\332+"
+	.string	"#Yc\205K\210\372-\221\362\356\356\266Dz\024\210\332\263\037\322\243K\365h\016\365\347#\\\325k\226\315\231U\255\031\006\363%\307RR\355Y\237t\004\320\372\244,\204\231<\344\277\341\211\022f\304\213\321\243\255\236Yx\341\302\231\027\243(G\235\245\376\033\356\302\304\312\251N=\257\300A\376\233\235\265%V\264\344\3243\020\257\2739 \2142\224\312\304K+\321A\352\213\205 \214\236\241~\346\301=\370\007\b'\334\255I\303(?\261\217\363\017V\241\371\307\002\314\356#\377\340\261\353>\362\354\222\330%\201F\241br%E\317{\252_\333\017\251\216\326\320y\211cF\0267\245\213q0\016\326\261`\242z\370\240c-k\320\2168\235ul\2237)2\214r\216\177\3315}\t[3=*4o`l\313MN\016E\2370IF\217\030\364\001\215|\033\bc\030\365\020\211\277\242\"_\352\001\212\016\206>\350\231"
+	.string	"\034\026}\031$\001i\204\340s\244\023\030\304\260"
+	.string	"\206P\361w4\364\025G\214P$Lj\361\033\n[\360\324P\022\266\360\231\361+\022k\300\370P<\322\211#%\241#%\237\242 \r\n\212?\"NP\006\027\177\304\337\260G$:R\312)\022\005\217\224z\301#%^\221(\305\220\372;\001HD\211\304\337\320\310\310gSCIX\204\016\213J<\243\237\215\321\217H\003-\372\021m>$:R:\2413\364!\025\2415\206E\"\360\350\267\001\021\b\0309\304"
+	.string	"\212\300 \020"
+	.ascii	"\243\241\317(\350+\302`A\004\376\260\350\360\"\340\360\027\374"
+	.ascii	"\035\251_ \005\002)T\230`s\025+\022X\221@z\025+\206\206V\244"
+	.ascii	"\030R\237b\210\367\242\240\020X\364\025\205\033\350\024q\212"
+	.ascii	"D*\212A \r\233$\241\220\005Q\257\004\337\220'\343gD\244s\244"
+	.ascii	"\023D\244\242o\206PP8c\206\260HD\t\276\032<\"%\0317h\217\370"
+	.ascii	"K:\n\372\322\342\221\016\270P\3517\024*\n\205C!\234\022|5:\020"
+	.ascii	"\211\"\350IJ\022\016q\212D\n\240(\006\2016\037\032j1\202\203"
+	.ascii	"\027\025\250E'\212\301\337\214\340\0210\311g4\364\tC\020\"\016"
+	.ascii	"\205\304\340\217(\024\004\372f\b"
+	.ascii	"\025\r\211B'\f \376~\303\243\237\004HEE\240RN\231\265\343\361"
+	.ascii	"\341%L\026F\017\306d\216n1\265zr\332\346\260t\361\030\203\326"
+	.ascii	"Ss\305\244\002\\\033S\3412\206\356\215\235L\260\236\320\030\r"
+	.ascii	"\023\206\333~\324\306\002S\026\327\213\033\362V\204\355\334v"
+	.ascii	"\260'8)\2465\253\271$FF9\215\325\326\031\202\305\230\251ZZ2\372"
+	.ascii	"\364\206\212B\367\206H\367\356nC\244\357\251QOv2F\333\255\336"
+	.ascii	"\261\\mP@<+\231!_\354\345\214v\276!\316\210\021\034g"
+	.string	"\374\374on\336\312\272\2001\243\362\0276K\325|\244)\322{+qsg\034\223\306\252.\t\027\356\322a\2055R[\272p\231\017\235\323\327\312\355\004)R\344\006\243l\303\325\312Pq\333\262\223\366\003K\330\226\345\312r\002\222\344\022\026\201[\250\221$g\030DhdF&\210$I\222\016\021\005\204(\3470\264\036\022 f1\314\234S#4IR\331\217\003n\002\2425\311\365\340\273\361\216\374\245\236U\354 \326\304E7\245\246\205jC\340Y\240\233\371\235t\354\277{\006b\016\342\2675+\252T\350H\251+D\233\240\226~{\320M\032\230\006\333\b$\265\247\\\250\221\"\334\201@1\317g\325\205\301\372\301lf#hh\303\202\306c\277\034%\265\203\030m\244\242b\266\024L\n\244\356\354K)Yw\240aD\306\003@\216\260Gz\334\236PG\006\374\271aA\222\354\r4a\002\210O\220\332\203\370&\f"
+	.ascii	"\203\236.\227\236\225\336J\226\0209\363Y\240\034D,,\276\255\204"
+	.ascii	"\377\f\342\273Sv\344D1\316Z\203\374\305771\307\232#\315\022\261"
+	.ascii	"q\256IZ\334\351\030e\200\320\260d\325\013\266\336"
+	.string	"\314a\2331\215\227n\205@\203S\377\007Y\342$\276\253\252\251\3553\356\236\325\244\330m\023\003\315<%\350\203x\020\364m\374\177\334n\006L\254\247\301\2608${\351\231o\212\333\002\362D\240\333X\335\264\260\020\304\312:\021\331\035;\206\324\200\241=b\212}\3270_\017\234\f1\027iM\022\266)X\\\177\013\231@\355\212\306N\272Tx>,\220\221\320\265\324\b\fUmS\021\210\r\315^\003<C\334Aa\001%\225;\270\noL\241x\360l\032g\016)\347W\0077\345\334\263\371\023\301\251\210\235\275bIV\273B\312\221\325\330\n\211=\030\017@\313N\336P\026\231\244\260\370!\2605\025\312\350\271\"\f\216\331i\334\2353(&\216\241\305\352H\342\323\220[\013D\213\201\317k\206\fA\201\333 wP/^\032d-\242~\316HK\316\277\321\273\3037%\005@\022\235\314\316{\330\214\264)\277\221\023"
+	.string	"<\212\245O\375\360\343\245\n\034w\3228\031YQ\302aD\tl\225T\375\033[C\2173\272+\302Xi\372)\353\020\371\266^`/\327\b=R\344\272\211\"\b,-$Y%\303\221X\210G\260t\212\344\001\236\367\277\357\265\307\236\215\330\343\t\355\335\3164k\310\016j\373\262\317\201\035]!>\226\302\033\021!\377\274g\006\354\030\211\256\251\177+_\256 3\241'H0=kC"
+	.ascii	"(;\301\342\203\333\244\201\004\254\230\367\275\357\362\207L\032"
+	.ascii	"\316Y\344\222\231\221\335\240\235\274\"\3464hD\314|\261\t*\247"
+	.ascii	"]s\374\244c}ab\233\336\030;\346`\006\305\217\344\327\021\037"
+	.ascii	"\305\f\3036>/\n\320\026\273\233t\3338\036\356q\303\346{\232w"
+	.ascii	"\n[(\340\342Z\245\026\205\315a\025a\026q\303s\243l\032\205\314"
+	.ascii	"z\314U"
+	.text
+	.section	.gnu.lto_.symtab.920c90a433379439,"e",@progbits
+	.string	"isBoardAlignmentStandard"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.920c90a433379439,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
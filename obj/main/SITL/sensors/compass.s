@@ -0,0 +1,588 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.text
+	.section	.gnu.lto_.icf.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\205\005"
+	.string	"\302\207\035(\2209\215\001\177pa\333\240\357\243\241\362\204\255\300\373\312\222\335\020[UU\365b\372\233\rk$\031i\262{I\333;m\031\272\026\306eU\340+qm(\351\370\024)\034\226n\002H\321B\023\f\3432\345\263/\214\366}>\207\303\345:\364\313\237\013\324\301\220\2018:\320\020\213\270\026\306e\3209>\225\331\272\310zE\333$\017\376\376\267.\220\215\207\206\242\225>B\030"
+	.string	"^\t\266J\300\205\363\235\215\001\221\224\273/\315Rr%\346\322\013\301\316\200]"
+	.string	"\b\340+\303\020,x\001\360\363\001,"
+	.ascii	"\356r\216\271)\240B\005\332\316Z\r\270\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 A\215\001"
+	.string	"\024\0025"
+	.string	"\006"
+	.string	"\001\001\001\001"
+	.string	"\020"
+	.string	"\007\003\002"
+	.string	"\003\004\001\001\200\f"
+	.string	""
+	.string	"\n\005\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\005"
+	.ascii	"\271\001\204\032\274e\322K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\245\004"
+	.string	"\"\007\026\037\240'\351\330\350V\3655\326\257s\027\313\300\350h[[qUU\205]K\242s\244\221-w\n\263\t\205j\300/x*[\310h\031C,\327X|<h\326!\207\370W`\3236}\b\2743\321\033\3322\033\302\266\275\355\2373\271\300'<\264M|S\250h\273\036m\007\030"
+	.string	"]C\310\212\350\2328W\204!\002'-4\312\034\326\312\016\254\005\266\002\362\2501\332\210B\207"
+	.string	"\003\304@\240G\341\371<\006Z\2005G9p\0239\232\306`\261\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \240\035\003"
+	.string	"RF\023\035\240'\351\377\377\017r\006\200\243F\311\267.\357\375\252Z\252\240\337'\332\303\311\337D\246\024\"+\363\t\241\026\203\231\035\337x\213\230`\206\374q\255\234W\316V\241\206C\302\202!\023\200\326hqZv\213\206\354=\351\002\323\377\225y\217\214\007"
+	.ascii	"\240\b9\213\232Ix\316\222\200*?\246n\331@\033"
+	.text
+	.section	.gnu.lto_.pureconst.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\200\004\002\230\004\004\230\004\005\232\004\016"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \234\035\003"
+	.string	"r\204\017\034\260%\351\fe\255\210\034\2468\3530\f\250\t\002\325Z\333`\2028\255\265\326\232L):\0329*\005\0339\254X\250\007\266\200\275O\246\r\022\r\236c\263\252r\227\031\341\262=\nkH\b\016"
+	.ascii	"v\004m\341@R\326\370y\264O\222\254\f\230@\3033@\315\030>C\263"
+	.ascii	"\034\331\322\013\254\002\003,"
+	.text
+	.section	.gnu.lto_.lto.5535242a29e43ba4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.29.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\305\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\356\006us\350\305\006uq"
+	.string	"\005\001\006'\001\030\250 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.30.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`\\\001\305\013"
+	.string	"\246\324LA \307\272p\220 \211z\354B\306\016\346\353\207\355@M\206\353\313\353\230\257\206\264|\001DL\276xo\032al1bpx\306\001\032!\n0\240\220\236\263\013\302>\243X"
+	.string	".\210\013\267\207\204\204\244\0246"
+	.string	"9"
+	.string	">"
+	.string	"*\204\0370\377\254~\003\376\303|\001\374\347\323\276]e\355\001\210\200\304\326\335\r=\224\237\357N\377,\317\240R\350\273\203\212\335u\207J\231\334\336m;\330\226\260\217\013\237o\002\377Q\204\244\252\024w\352r\266\212v\336\211\375\313\356\256\275\225\375\327\337!L\224\254\013\030\030\354\222\344\032l\355\243\251hl\277\263\237~\345\374\313t\205\335\025\202\331n\005FT\201\313sZ\353\266~>\203\335d\2675>\240e[A\0270Bm\256\177\004\332\344\003\2140F\022\250R\022h\233\217\22120\231\353%\320\346xK\t\263\273\021>\254\303c\303Jy\236OF\210\264H\260\3101\315\216\bD\212\241Y\222fh4\303\320\247\003\n\305\322\f9\r&Ec\031n\220d\031j\324\375e\275\225/\b\324N\336\207o\340v\347\007\306\024n\004m\361\001\033"
+	.string	"s\311\"c\017\213Z\213\263"
+	.string	"\320\266\260\336\b\250\003\260\003\337!\2659\370\315\t\331N\352\017\030\220\364\"P\240\003\bH\251\244A\306\223J$\324aF&4\203y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_compassDetect.33.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\362M14Pm\222\016d\254\210j\253\b\232\324|Tm\031\261\f\244*\332\016F\305\370\273\001\250\321\331\272\203\3274\315L\033D\023E\316\372b\2500\256\366G\333 D\246\022\326\203\273\272@\210\331d\256\352A\354\202\032\013>\r\004&\363*\f\276K\301\327\306\302^\304ua\317\022\263\016t3\312\200\302U|\3544\247\361\005\310\314\334\201\276\365\023I(\016!\231\236RJ\226L$\034\177\177\316[\376\326\276\036\025q\3721Q\201L\220h$3*\234P\351t,\001\325\251\322\001\252\323\377\002\003\347\254q\303\323P\311bD\312\214\317\205\232\265e\267 =\350\030\231\234\210|:m\001\r\231y\273\370`t\327\037\341\177\177F\005"
+	.ascii	"2\003\3469\003\0272w\031\363\272&\031"
+	.text
+	.section	.gnu.lto_compassInit.34.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\202\31505Pm\222\016d\254\244,;\2652\006\335\331\305\">\274~\002%?m\261\276\261\335\2166\352\316\326\035\374\233\315,g\316\001R\223\266\300\210\005?Cn\210\020\231\002S\225\030/\233LE\301hUQ\203\211P\303p\311@\312\212\260Bp\265\301X\260\241\252,H\331\260>\355^\223-\330\363\374\350w\006\357P\217G\003\241\314T\270\242v<\334\214NCp\\?\235.g\322\251\033u\"m\244\202\203\204\271\322o\036\367,\276"
+	.string	"\371\264\177\245\330H$\013 \231Y\251$E\246\020\215\277\363\224\021\022:_\335BY12\211\017R\346\006\337E\257\272\353\n\200\"\352\002,\231\271\373\200&\372\353_\360\037\374\241\b"
+	.ascii	"2\001cx\006\301\005\343\232\230\025\201\211\0209\334\271\333"
+	.ascii	"\026'"
+	.text
+	.section	.gnu.lto_compassIsHealthy.35.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\005\013"
+	.string	"\026\025MB \213*\035\247`\305,\215\260\211\330%X\344C#\t\t,\210\250fa\020\"\353\364\013\007\250\021\312w\007:\344\001K\307\035z\005\300\324\2005\354\336<A\204G\314\234c<\304\322Q&A\233\310\235R7"
+	.string	">"
+	.string	"6"
+	.string	"\237\036?A\371\334.A\371\264m\216\016\320\240\217\fJo\220\022)\274vGN\027\034t\t\362\277z\366b\265H\246\360R\013\331]K\222\311\300\255\267\215a\333\303>H[\345\001\314\202\210\207\335R\f\266\256\231\301\301U\277\r\372+[\374\361\023\300\253\006la\001\n\221\203\204\016\273\233\361i\314\366y\311\244\264\217z\004\360)\002\207\330=U\300\260;nXc\013R\247\006\021\202/\334r\264\033\272\320\364\372\301j\211(\221\214\231\"\247\332\037\001\362$M#>\270F\032\332c(U\201\375lw\327z\262\257\272\265\247\376ii\225~\337\347\344C\322\215\224d8\025"
+	.string	"\267\006\363}\031\017\247\323p\237\327}\235\315\307uL2\034N\343}\034\306\302\235g\343q\001\272\316\343,\343>[=\251^B*\262\324\253\252n\020\017 HP\021\020"
+	.ascii	"2\241\203(\360\340\013\013d\004\205\r\225\220(s\274\331\001A"
+	.ascii	"\024]&\233\037\036\031\203\341,\203&\311S\317\230\204I\006"
+	.text
+	.section	.gnu.lto_compassUpdate.36.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`<\016\245<"
+	.string	"\232b\220\025CP\246N\007\253@\351\217\376?\335\3070\017>z\306\217\355GTB\274NI\322\326\314\"C\255Mm`j\300\200@D0P &\301@\337*X\253\247\273^\235d\202B>\r2\021!{\357\235RJ\001C\001+\001L\001\316*\3209e\235\177uv\325\271; \311\264\351\320\347\336\035QA\227\215\n}k\274n\273n\272\356+\235\372\273;\313\334yN`\305\013\3266\004\356n\313\226\034uZ\262\324\341vrc\271\302b\200^c@\274,h\372\356\275T\2552\004`\253\351\220\231\333\231\233J\317\265]e\006\007\357M\233\363r\2573\001#"
+	.ascii	"\266\352\324\307\265\325\264\217\326V\231[\346;\355l\336\316"
+	.ascii	"\322%\314\316\317\275\267\352\221\034!\201\374\235:\233S\265"
+	.ascii	"\355$$\344\321xdTT$\"*\r\t\r\205A \273\252\351{\313\315V\030"
+	.ascii	"`f\216\030\231W'Ei\244\267\274$\216T\322\307\274\326\3206$OZ"
+	.ascii	"\231\2226\246\305\005h~\304V8R\326\326Fl]\304v\267\346\305f\023"
+	.ascii	"5\357\2108\261\225m\255\344\306dL\316\207\242\fq\241\263\036"
+	.ascii	"\236=1\031\023\342\302\264\262 \035L\213@\352\302\034\370t\244"
+	.ascii	"\314\254Y"
+	.string	"\266B]gX\253\223'\255\314\254\327\324\311\315X\220\324\311\312\322\325\264x\357%\222\321H\027\370\r\262/O\227\364\350o,=\325e\216\030Y\217v\266\302\275\227]\214\254\254\031@3\273\001f\236\300,\304%_\032Z\315\006`\232\364\333JK\325\341Q\237\311A\276\347\360\317\347T\035\3657\022t\3247\037:>0\007\324i\212\240\243\236\303\367Y\2279K\264/\217\362\377\031~\036\367\230C\233\271\"6\311t\031\017\037@\200X[m1=\376\377/f\331\247\364(\\\217I:\020\343\337XZ*\314\235?P\245G\377\357\275^\317Fog\203!\301\324\374\322P\254\021$H8\373\211\302\270w\257\262\305\364\236\207Eh\274\0273\227h.&\200\367^+n-\275%\213\333\255U\326B\341-\326*7\212\265\325\376wb\347O\025\245G\231\235_\376L\346\356\373j\314\0346d\240\320U\272\037\b\235\035"
+	.ascii	"\235\255\032\257y\252\355\232\245\232\256\371@_i\216Z\235\r\004"
+	.ascii	"\235\241\202\316\005"
+	.string	"\202\316\004V\347\001A\347\247\325\331iunb\235\005\254\316L\253\363\022\353\034`u\006\300:+\r\235\223\206\316H\2543\222u>\256\316F\326\371\210u6b\235\213V\347\"\353L\304:\023Y\347\241\325Y\210u\036\n\235\205B\347\340\352\fd\235Y\241\363\032\f\317\266\326<\376\321#\215\177<\302T3:\021O3R\304\233\305\254\255\036}\032-c\364C\316\204\024=\321\033\025\277\b\210\331\217b\002\367\321\203\007\321\247Q P\342\223\371\230\357\030\372\341\023\277\227pB?\364>h\331\227#\031\325t\034~\243}+\260'\364QkP\267\3415\256\210M\017\033\276\352\344\357\017t(\374\023\016\326\312\265m\355\234\360\277\307\237\234\2310\370\334r\\\331\201\272\225[\327\017\246f\236\3170\263\257\3403y\310\306Rx\225m\245\352\003\007\336\2178\360\300S\370v\242\027\375\033\364\242\215\3533\275(\360\003%\233"
+	.string	"a1\355\371\351?\355\033\307h\343\342\330\007~\352\267T\303\207\237\f\232~W\t\366\260?\244\326G\016\252L\256J:Or\251M\322}X\300;\215\247}C6\357\275\355\222\266I\261\333\270\272\226\002\343\343gO\263\017\236\233N\327\231!\243\205\002em\365\341\370\3759c\347\275wm\246\325\001\320\r\247\315\264\256\357\240\345\364\234V\216\333\215\333)\355\234\267X;\267\266\272~\352\007\304\314\311\325og\303\261"
+	.ascii	"|s\205\334s\303\0270x\213\261\223\325\253\235$\354\257\243\275"
+	.ascii	"\265\246o\365\354af\001])`\230H\273\222Z*R\204h\261B\213\213"
+	.ascii	"\313"
+	.string	"E\326\020g)\350\3522\301B\305VVU\027\327V\327\n\255\256\252\025)L\250\250\312\342\352\252R\300\304[,\264\270\252ZlmqU\r\235\312~5\026Q\206\215\362\277\222\236\311\334\"i\327t\214\001\303\346\353\275\220\216\031^\3453R\365\324\024r\3523\340Y\242\031x/I\001\376t\275\366m\t\352\r|\032'\354\317\321\272\300C}\2008K)\004\376\351\013|\222\335\022m\300\023\340\222\3541[\260:\214\226\001\337c\326\240\377\364\035\366\307\346y\311\b{xXV{wN\337y]\345\343\371\307g&\351:+\r\305\324\213\262\307\370L\036\362\031mx\225O\211\252\245\244\336\237\364\221\324o\300\343FMX\2568_4}S)\363,\022\240\206\351\005TIJh\372\034V\203\246Saz\"&\227\342\322KIF\355\311aA\355EQ\372\245o*d\242K5\013\356\275D\317\f\360J\337L\350\320"
+	.string	"\370"
+	.string	"}O\222\022\232\036\207\325\240\351N"
+	.string	"\274\204\326\315\231\360\263i\311\325\022\234\322\367]G\371\341\311A\331\334{\211\317\344n\245W#\"YF{\306\232\364\\ti\220\376\301'=\f2k\226p_C3V$:\356\206\364\037\307N\b\031\201$\250q0%\235BD2\"\222$\251\2441\221\005\204\030\006!4\017\021"
+	.ascii	"\245C\216!\252\231$\205\306\223\340M\217S\211\b4\024\035\325"
+	.ascii	"\"\244\362\"\262\223\261&x\023\357\270?\343\353\322\246\305\305"
+	.ascii	"\206\220\247\247\334\217Q\237!\217\221\030%63\3516\370\357\262"
+	.ascii	"\t\206{\371d`c\370\031|\334\313p\302[E\031\2723\307\344\313t"
+	.ascii	"\200\371\305\300\232\373{D\355\363\030\034\251\365\272i\376i"
+	.ascii	"|"
+	.string	"q\221~\373*\325\263\003\331\2670\221\331\211\037\276n\264\367>m\222\312\004\213\320\315\220<\177\315\316R\347\362!\017\275\205a\266\021\350\362Xg\245YE\357}R7\241\022=5\017C\226!\030\362\306\022j \215ehVo\f\371;m5r&\rf*\032\205\304\025\274T\331\f\336\244\243I_^N\221\214r9e\345\341>h`\303K\245p#\037Yjg\003\224,Y\206\353\003\"\226_\007L\001\r\236\275\206\345DPRd\200\236Y/\315(\216\231\322\236\034(\364\3546\271\340\345\004\2744\307:]\264\345r\2438\276\267\\\343\fnA\371\244\3516\355c\341(\236\346L\320\344\376\022d]\244\255\330\214\216\003\277\rg\221\321\310\274\"\003/\177\202 \021\306\0166\335*\322\257QS\335\2615V\22355\367\310\301(0\266\034\030\312\352b\205\227uh_\254\245\357\357\254\bn\\\017>\0139Z"
+	.ascii	"\342\023Y\340\201<\244\\\361\302\201\376\332F\3562\314CA\032"
+	.ascii	"\022\345\250~jG{!5Rr\301\206\037\306\032\224\355\344\340\006"
+	.ascii	"%4~\034\235\317\222\t\325\2419\n8\326\2140\034A\\D\255\324kP"
+	.ascii	"\005\354\325E\273\362\364\2158\3467QES\002\370'\035\304\307\333"
+	.ascii	"\327g\367\207\210\263\300\300\366H\215\361\233\231\n\244r\223"
+	.ascii	"\006d\n\307\234\f\340*+E\206\256V\202\232n\035W`\f5\031-\371"
+	.ascii	"\037\254Iy\375\320\020\307\335\277\360\271\026\r\003\270\241"
+	.ascii	"#T\343bS\367B\026\275kB%y'\240\315\220\t\247\023\365\023\301"
+	.ascii	"\216\221P\001"
+	.text
+	.section	.gnu.lto_compassGetAverage.37.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`i\001\265\f"
+	.string	"\326\027UC\020q\224\016H\307#\310|,\224>h\030\032O\252h\022G4V\224\211wa\267\252|\301\340]\312\ba\373S\3706\016c\273\372\310\024"
+	.string	""
+	.string	""
+	.string	"\312P\372\322\322|\264*Sl-il\322\270\255\224)\005B"
+	.string	"="
+	.string	"E"
+	.string	"\250\023)\273\035\307\233\353\320\335\tX\207\327\007X\207\266\235`\201\311\334;\021\220k\340P\301d\265\333a\232\341\334\223\363\017\342\032\017+#^\234\204x<1\016v\327y\n\261p\353m#\260\255\300\316\f\320\357\260\016\341\005\225\325\352#[\354\316#\025\203\375\313\356\256\025e\277\344\207\232VM\247\246\277\221-T$\227\001c\027\244\245\306\252\240\327\301\266\311\316\330\316\264O\362\017\246\227t\\\300n#\2516\350)\234\247@A\2214\274\253\035\372I\242\234b\330\233\233p\352"
+	.string	"\313\3566\260!\274\204\250\200\210\311Ih\216\020\363\247h\035^1\237\213\021/e;5\266\204\213p\352\332]\006~\210\322\204"
+	.string	",\033\036\031\310\263e\034\0178.\177:1zH\"\355\203\305M\213\243,b\243\220G\204}\266\210u\fX#e\033V\322\264\r\313t\373\313*\352\234\005\200\305\f\325\207R\260\252\235]\345\336\277\025*\356\317:T\305|+\001\031"
+	.string	"\t\033zk\005f\365\nG\203'\340\030\034\002\r\235@k"
+	.ascii	">\200;8X\030\"\316`|\261\325\260\361\344\020\232\271Z`s\351\256"
+	.ascii	"DW\025\276\2517\272\214\275\346\232\r\331!\342\353\232O"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\215\006"
+	.string	"\242\t$,\200'\35230\003\302\321\216h\202\347\002BD\374\300\20281\226\2471\221q\321odkF\266\256\021~#/~r\314\277\354\2662\005\016\310\374\177M\b\0362\376_\024&\276\314\205BJI\340\266\227\266\217\374oC\021\331Zi\017\203W\243vB\207pP\300\rt\002\234\001\200\363[\260\034}\265\025B\305i\223\264\210\211\231\332\216\020\246\360\013\244\nC\363Y\352\316N\237\247h\250c\2457\033!\n\016\r\366\332\020\f\231\374?\263\017b;\275\033"
+	.string	"\255@$f\030\240\036>@\n\\\332@\005\303%\004\353\240Bbh\205\322H\0020f\311\030d\\T\3063\351\013l\tW\303\200\276\300\016\030.\310A\005A\003:"
+	.ascii	"\273@\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375 \255\345\003"
+	.string	"\322\n\036#pK\222\306\266*]UUUUU\325g\342\007\021*\230\"X\211\212`\214\265\266\255\221fmm\334[\246\223\204\016\tT\245\006\250\251\006\324\033gk4c0_,k\321lE3\005\263\023\314\022u\3042D\355\303\331\241n\250e8O\352\205Z\205sB\215\020\371"
+	.string	"\262\006\315\0260KP\017\234\225,\033\201\334\024]\224\035\265\365\230\036\224\024:\245cr5\3323\002"
+	.text
+	.section	.gnu.lto_.decls.5535242a29e43ba4,"e",@progbits
+	.string	"(\265/\375`\r#e\244"
+	.string	"\n\f);Z0JI9\351\372\376\252b&\"B\004\335;5\277u\326\\\221z\221qW\241\243\305VU\021\037\037\025B-\345\211bZ\217$\241\221\235\334\221\022\343:\272\333l\206\303`p\230\327U8PZF\265\200*\004\202\244|R\013\345\240\212\342\026\227\221\325\332\355~v\223\266\367\226)\031\003\260\003\270\003i\316E\035\260\243\032\030\363v\266\311J\365\327\251N\376\254jMP\335\306\304\210#\3039\366G\n\nx\322*\251\032Q\031xA\234\310\270\001U\237\352W\266\221\353\255\306\335\361J\023\254zom\340\352\324\312\316\322\312\034\017 \322\245\236\3505\265X\211]W\231j\256M\255\246\242\350\264:\265\226\367\226n\341\267Y\250N\315\245\351\320\314-\233\234\265\231\334\027\0250I'qQ\244\274\251M\t\223\006\245\321vl\3161\304p!=hP\235\232\254\315Zi\325"
+	.string	"\"i\2269\247\325\251\327\232m\247\230\346#\006\276\274\210\021\227s\032\364\023\244s5$+K"
+	.string	"\356\\\006\223\207\2264P\306\3400\r\327\312\034w\315\332\262\343:m\271\006#\327]\372\013\221\nW\206 \034\0315\216O\346E\363c\343\246$\231\324\373*\005\277\335\336\314ZlLg\331\331\345\254\325\204+\347l\246\3174\231N\273L/_\323g\360\013\275\313\264\230\316\242\341D\316ZY>E:\264\"q9\347\240\240\237\240\035\232\245\334\030|_u\340W)\374j\304\257D\374\236\303o-\370\375\245\225t\226\326\312\271\230s\236\200\267\"\355\310\223z\273M\350\355\305\307\244\262J3\322&\2438\321Y\301\357)\270\177\232\f\267\225\276\322i\206\306\362nk\267\357\210iNs\316<M&G\323\361\b\026A\316\235\301\354\272\272\316`\276\273pOc0k\373\230]\245\261\240I\363T\357{\013\277\255\360;\n\177\004\370H%\374\344\006\360\325\236\350\254\031\262f\256\336c"
+	.string	"\037\004\276\2621\230w"
+	.string	">\227\306`\366\222f\322)\005]v\017\032\3342\211\345\257\234S\236[\305f\203G\275\327"
+	.string	"\277)0\273\256)0\017\204\277l\f&\006\215\3014\333\307\354\031\353\257Fb\215)\26422\347\364\302\016\t\025\"\304z\033\254\303:=\322b\277bZy,\347T\307\022\253\330\316\352\335\320\030\314{#\347\271\2225h \223\247\201\314\247\215\301\304\355c\376]\374\033\305\337'\234\220;\277=\376\365&\303\341\376\317\325\037\267\277\362\374u\202"
+	.ascii	"\374mBo\370\357\305\304\337\034\370[\352\026\374\327\360?\304"
+	.ascii	"\177\261\377\374]\001\3259\374\266\003\177\345a\370\253\004\274"
+	.ascii	"\337\376\376\226\240\002\300\374-\t\004\370o\177[\201\377j\376"
+	.ascii	"\266\377\313\376\376\377\272\277\237\374m\322\331\274\347\267"
+	.ascii	"C\177\307\375=\367w\232\277\341\376>\363\267\334\337jZ\371w\231"
+	.ascii	"\277\311\324\013\377y~\253\346\257=\177\305\371+\376\353\375"
+	.ascii	"\353\377^\3637\362\357$\177#\371;\375\033\354\357\"\177\007\371"
+	.ascii	"\373\307\337]\177\357\370\033\307\3373\376\206\372\037\302\337"
+	.ascii	",\376c\371_\345o\374\267\325\337U\177\373\374\335\342o\236\277"
+	.ascii	"\251\376\236\372;\352\357\021\374-\202\277C\3607\b\376\376\300"
+	.ascii	"\337\006\370\033\303\177\020\376\306\371\373\346o\233\377H\376"
+	.ascii	"+\340\377\332\177\\WWW\367W\255\337\034\301/\200\266\\\231\313"
+	.ascii	"\026\025\036c:\222S\224\301\\G\026d\254Uj\255\372\013P\316+6"
+	.ascii	"\200%\251.8\017\256\352\235\332*;ec\274^i\226=$\205-\036\313"
+	.ascii	"\025\357\324\256\260-\200\322\314\324b\270\326\244\305e*\253"
+	.ascii	"\013xT`\025\241\352\265,v\344\260$I\313\360yH KeSLyr\210UM\254"
+	.ascii	"\030Q1ec\345\204\227*\365Z)smM\205\026\220\0246*\007\314Y\332"
+	.ascii	"\211z-\324\327\017\034N\352=\017\005|\302\032\255\223E\321\251"
+	.ascii	"}\272_L2\222M0\304\210Y\311\244}\262\305\237\265\022\231O\210"
+	.ascii	"\035`M\231&\271;>\311\221\302\315=o\n\237\227\002\237\007\205"
+	.ascii	"\3173\342\337\346\267\\\022#1\346\352\232\016\354LM\2275@r[\232"
+	.ascii	"\204\250\351/\302,\265\270J\3678\023\270\3700S\3573\210\2538"
+	.ascii	"\232M\r\331\245~\001\313\200J\345\322\026v\246\242\251s\025\256"
+	.ascii	"\312\3254\325L\2475\256^\275\222\251e\376\323_5\256\346\250S"
+	.ascii	"44\031\357\023#\313\270z\243\315\310\224\374\265F\\\265\321_"
+	.ascii	"\210,Y\306U0u\214\206&c\276JR\270\026B\202\202~\352\325\332\023"
+	.ascii	"[\317\275i\373\230u\271\202\232\261\033fX\314\333\315\023.dZ"
+	.ascii	"\b\363\372f\271\334\222p0r\332\270\242\220\270z\231\261\243\203"
+	.ascii	"\207\332\214zo\372\3007y\3406%\305!\365n\351\264\266P\327~Z\250"
+	.ascii	"U\252\226VZ\245y\305\216\222%\231(q9\371I\316\311\325\222ejj"
+	.ascii	"i\254\267b\261\251\322\342\204)uV:\255W\376\0064\303\307\212"
+	.ascii	"z\177\246*+\016-b\322(_\335\250\262\222\253z\333xo\307+ba0[]"
+	.ascii	"\233A\314r\364\202\277S\303\337\241\251\325/`.\222(\301Pj\224"
+	.ascii	"N\253\224\252\302\217\224\252\243\246\020V&\245\362\250h\255"
+	.ascii	"\264\352\311\3057\271ePP'\211\262\206\214y\307j\222\013\327\223"
+	.ascii	"\352\244\246uZ\321^\321j\217*d\207\351B\3167\342\270\320\352"
+	.ascii	"\220*\326J\344\007@\300,\203pR\330\310b\302\267I=\353\264&\253"
+	.ascii	"\031\262\226\2319KV\026\252\022\rM\306\017\322\326\226\030mG"
+	.ascii	"\232\216\"eLt\236\316|\264@V\227\334\234`\245L\353\201\177\262"
+	.ascii	"\367T\327\211\265\0338LM\3627\024\252T\201\315\300\337\275\300"
+	.ascii	"\337U\341g V\211T#\255D~h\363r\244\"\351\264\212\325\024)F\345"
+	.ascii	"\313r\247\207\217\"`\346\375\016\n\337 E%l\365\326\"\365\253"
+	.ascii	"\323\032V\301\262\216\316[\026\024\257z\277\313\270\004\357P"
+	.ascii	"\314_9\374{\006\003\251A:\255B\352\217\2374\3472!\265\253zih"
+	.ascii	"2\202\210\361\266\374\022R\271\032m\207)\315*pTXnA\363\023\024"
+	.ascii	"\304\253\361\304\310\016\363\376.\361\362a\257\214ftR\254\262"
+	.ascii	"\250\260BU\001\307\013T~C\202\177\213\340\337\025\360\257\016"
+	.ascii	"\374\233UQ\340Q\262\025&\204\005\256;~\243\360o\021\337\316\341"
+	.ascii	"\3330\370V\013\306\240\322\330\352\255.;\240\324\2735\003\007"
+	.ascii	"J\216#-\260^g\310\310\311\371+\347\254AG\353\n\020%\365V\031"
+	.ascii	"\265\306\250Z\2572jVN\261\312\2709\023\273+\330\351\256`\007"
+	.ascii	"E\005\"\022\363\336\272\341jUa\254H\2424\302x\201\257<\221\231"
+	.ascii	"\325[_\324\253\3530a\213\203\213\202\177\246\272\370oc3F\213"
+	.ascii	"[\016\027Y\256\215\256&E\252*\213\23406$eI\026U\352g;69\253\255"
+	.ascii	"U\026UE\245j%\362\002\241rBm\321ieQ\217o\026\352\212\3378Nf_"
+	.ascii	"]\365\252I\213QWL\220\\\370\375\345f\255\204}\271b\225_^\270"
+	.ascii	"X/@\334l\233\005c\3134\021\263\204\253\\VY\243\013\227\234\245"
+	.ascii	"\263s6\316\242\261i:\265p\366\313m\025\313\346f\341,\026\333"
+	.ascii	"\302\027\227%\316\2263=\224;\327\272=LX\030[\246V\261dp\314\254"
+	.ascii	"\020\2113c\317tj\313<\203\316\\\227\2700\223\314\230$\024\f\024"
+	.ascii	"\365\332e\217\255E\325\240z\353\324\212A\261\202\032\036\365"
+	.ascii	"\3320\017\363\304\004\025u(\367\004'E\330\352=\016\024"
+	.string	"\376\215\232.X\3132\253\r\016\377\246\f\266Y\254\226N-\260[R\236\212\202\0322$^\360\333\002\323\326\325\265\005\346o\264\340\337(\255(wcT\314\264Ye\243aaK\321T\005oH\033\203\t\324>\246\225b\247X*\277\r\017\221\344\r&i\370V-\204\035nL\352\275\026\312m\224\265\036\\Rg\370\026\315\246\3756;\\x\220\035Q\202o\237\354\230\324\231\271\252\327:\301N7C,\270\311j\"\303:\371mY7\261\311\r\230P\247\006\256^\333\304\236\335&\255Y\266I\006h\345L\264I\036\272\234\211<\335\025tWp\211\320\350\261\304\274\277\361\302:\355c\326)\241[&8mQ\226F\262\220H\333\205\341\207\362\353H\fd\275\277\211\302\267cm\223$i\264\237\314Df\003\230\362\246\t\277\033M\fI\323m \366\344\254c\n\227\031|\033,F,\020\2336\335\3159rn\221"
+	.ascii	"\030\331&\r\337\006\tX\247\026\254>] g\342\325\001\272\360\020"
+	.ascii	",j\216\324{\033\036\370VH[\"@l\021{\274\031\231\211+4\270Z\246"
+	.ascii	"\027\334F\007\276\215=\006\351\324\006i\264\037-&2\033\214\034"
+	.ascii	"w\264\210\313Y\355\202\335\031\022\027]p>\356\303\376h+\007\220"
+	.ascii	"\231-u~\244\251\020\346u\373c\347\013\312R\356\330\203\262#\256"
+	.ascii	"K\n)\330.\027\312\034\030tWt\\\267]<&Sta=t\350\264\252\276\364"
+	.ascii	"\3401\343\304\017+\026*\207\311\r\251\327\252\240\246C\207\335"
+	.ascii	"\321\307\345\2324!<[D\334\200\234\271\335!\243\313\007\215\024"
+	.ascii	"e4hX\034\230I\202\272%\026P]\201\353\004/{\343\026GN\227!a\306"
+	.ascii	"X\033\023|\2151bm\330\032\246\221)@\250X)\033\0248\266Z\204\341"
+	.ascii	"\333\027\026\306-\326\261\354\f\234s\376\351JZY\001a\034UP)\264"
+	.ascii	"ng\360,1\363\244\315\312\250^;\322\274Y\0316F\2172d\261\032\255"
+	.ascii	"\312\232\304lVk\311yS\272x\253\367\370F\233\231H\225s^\261K3"
+	.ascii	"US\216\331\273n\240_\247\355o\316@\032H3\221\005/"
+	.string	"3\330\307\031\021F\335\220\277S\346\\\334bz\300\326\261\270\345\3028\266\225\231\212<\230.P\345-&\343X\316\027r\261\310\364A+_0\216\345c>q\345\3309\335b\312E\255|!\0273q\203\261\270u4\216\021\217\027\214c[\307<\266\225{r\221H\365T\314T\027\362\330\326\230<\246u\3541\216i\035\215c[9Z\352i\353k\305\230\227\rc\037\215\305<%\205E\244\352Q\032S\255\314%\347F:e*\003\344\214\245E\305\205\350\242\223M\312\251\2462\242V\006\251&\032Z\271\2504zi\345\354\325d\224\245\030\300\224*\263\216V2\325\300\312)\234r\026\200T\316L\235\2259g\246\2343\217\n+\315\371E\217\221KJ*g\253\037\251\214\305\344\304)\347\212\364\222<\032\307hh\t9I2\306\225Q\244L\035\250/\351h\304.x\"\021\t}I\"\0160\034!\247\303o\304\004&F"
+	.string	"\321\244\020\210\202\036\f\235$|C\237\341\322\321\022Q\022\b\027n\304\201\002!@\214\320\001=\213\204>t\003\332\363\220A\007~IGC\2470i\210\307\204R\322\020"
+	.ascii	"P\245\016EJ>\277\340\022\216p7\354\345\240\275`\221\322.X\244"
+	.ascii	"d\361i\002pxM(%\375\256\020U\262D'\217\350\034.\335\3379\344"
+	.ascii	"]\330+R\342\240#\364\031\375\256\t!:\004\026\235\"\004\340,\362"
+	.ascii	"\tO\022\036\240\347\004.\224\360a\300\241\204oG\210C\020\b\202"
+	.ascii	"\022\322\031\242\007\351D"
+	.string	"\207&F\350Ip=p8\362\r\241\346\2158\374z\301%a\207\337\210\002\f\213|G\0228Q\037:\2749Q\037\221\022\t&\214\320#\337\371\301\020D\017\016\372;\321\363\203N/(\001\364\034\236\"\024)M\360\037Px\006\317\"|\006l\260\200\r8(\301;\007\035`\320\001\006\3469\350@H\250\203\r\204\3607\020\262%\370D\030\372\340\001\211\363\303\177E>$\213\366\206$\234H@\024\243\301$`Px\242\276%\017\334\030\241>\244\016\301$$\244\244\237\t]B\227h\023}#\004\240\300 \b\024\030\004^!j\201_pI\002D\276S\204\"\037\b\022\020\371N\341\275\021\007\001\b\317#\242\240\357\003\03748\242\016{\277S\204\016\374|\"\216\216|C\027\200h\211\363\242\303\036Pi\204\021\347\207\036\b\013\214\200s\376\202>t\030\004b\264W\001\0207\b\264@p\3703\201JC;\354\ry"
+	.string	"\2013\344\001\204\215\371\363"
+	.string	"\264K\":\f\205'\t\240\220(\303\260\007B\217\360D\207>$\223w\222\360\035\215\260\244\204\204\227zx\330\3730\\\022\201s\366N%\023!\206K\"lx$N\242\341\222\b\323\203\"_\b Z\"\002h\020D\221\017I'\b\364M\340()\t\002\275\335\260G\342\374P\344C\302\303\335\320\007\017\212|H\346\207\037\020=\203E>$\037\364F(\332\033q\022e\270\021\207!\005OR:\205\035\320\244$a\007\234\022|&\354p"
+	.string	"GGI\302k\364C\201J\273\341\271t\344#a.\365\206H@a\210\341\017\210\344\013\232\370\200\032\025\001\217F`(\301'\264I\3023\003E>$\336\260W\004\034\021L\032\342A{\033\b\241A /\230\004D}A\340\321\357$:{;\301\"\340\221\317\346\024\372J \022\372\214rN%\023\350pI\304\316px\n\211\210|\275\237\007 \017\332\343"
+	.ascii	"\r\002\227x\347\017H\342$\332\t\016\177=\240\322\260W\344C\302"
+	.ascii	"A{E\276\020I@^"
+	.string	"\221/\004\252\264$\024\236h\020\230s!\241\241\r$\2040\001\374\3430\034\372\224\220\222~\035\206\302\244a\360\034v\b\002}H\035~\302a\007\016\032^\334\250Kv\225\203\306\225=\342T\021\243\213bUyaRWF\027\227J\207.-\215\231\252k\334\302\301F\244\336\237\335\026Gzr\274\2301C\246a\321\002\207\354\004\247$+\354\f\250\261 )\324+%u\251~\264l\227\343\026*B\244\232\320\221\251\370\245j\037`\262\304\324{\247\336\004\323=\261%\033\215\006\0320gH(\250\033\325g]Xn\221\026\244\316n\324wW\274x,\301\302w\272N\327\330bY\205\2061ZV@5G\023\013\257\213\342\327\3703,\225\246@\346@\341\377\022\337\351%\336\342\007\231x\004\222\302dd\205\270L\245v\201\235\243r#\255\336\333d\263\245L\026R\211\217\223\3047\327'\240\236\234i\270%w\300\346\202\350"
+	.string	"\303\357!m\227\334\256uj\227\3305BM\2318d\003\326\005\001\202\307\250\022\311DH\002\231B\b\251\021\231\031i\222tb\n\020\204\242Q\240h5>\022\300DEN\"\350\f\315H\222\024\n\303\030\263\020\"\246\225\244G\317\0035\334IXj_P\344\362\242[\305\260-/7\220?\344W.\330r\244\266\255\306\210\334t\244n\313Q\026\341bE\013F+\343\257\350\236v\031\216$\206_\205q9[\314\266\017\211l<2D\357\311V\266\037B\240\220\225\004\313Q\277J\0203t\356\022\271\355"
+	.string	"\004"
+	.string	"+\214\261\314\321|bMT\200\333NT\314\377\241\217\203\317\301\212\001\273\272\226\247wF)\265\275p\332\025Wo+\362\273\213\0351FY\212"
+	.ascii	"K%\b\330\372$\2324\003M\204\374k\n\223"
+	.ascii	"\244\207\320\376\252\356 \233\352\254\261\316\016\035\273\364"
+	.ascii	"\013-6\260\274\005\225\327C\333;\006`\341R\276b#:\342(\216zH"
+	.ascii	"\270\007\374V\030\n\235\356\030\325\230~\312\203\333S\2243a*"
+	.ascii	"\030\324\355\331\005\212\342U\002l|\204zv\204\\H\277h\203\006"
+	.ascii	"r\027\003d{\007,\321\f\371@f\363i\246#o\327\377<\273\200j\264"
+	.ascii	"7_\371\200\023\203\350l\037\270U\272S\273\224Wsl7\373c\006(\360"
+	.ascii	"#t\036\020!\265\271v\003m\252\353*\031!l\317\340\342\275\365"
+	.ascii	"\261\350Fp\361\032\363\375y`_\324\221}\023E]p\317p\263\306\030"
+	.ascii	"\333\302\363\233\370\220\305t\301\004\240\272(w\263\257R\373"
+	.ascii	"@\317\177f\303\264\177\020\224>S,\373\210 \214\030A\323\370\213"
+	.ascii	"\025e\260\300V\250\300\321\321\342\266u\355!f'\232\353B\363\024"
+	.ascii	"\2409\211\334\177\240*bP\256\323,\300B\352W\217a\276\241N@\276"
+	.ascii	"\324\227_\222\013\312\360\333\202`\322L\300\023\005{\374t\276"
+	.ascii	"\240\0304=jA?\003xE\230\021O\347<qP\001\252\2576\234\310\017"
+	.ascii	"\264\305MB\240(W\252o\030\376\266O \311\330\336\005\257\3727"
+	.ascii	"\003\031x\333\263\324"
+	.string	"\301\271\243\255Q[\020p\264\311\360a\366\370i\b\025\273\311\225$\r\0055;\036h\0134h\240<\260\311P\303\316t\327\253\361qJ\2668{B\342\320\027-a\352JQ\214\231\314\031\377\376\222\322J\251\324\217\177\322p\r \346`\332?\223\326\336\t\313\017\361-Y\177\336A\237<H\307\377z\221Z\237@2\222\b\013\273\365o3V\261\272\343\376\220\361\340,\320<k\214\211z\207V!p\022\323\021\027\032\265\024#\376T\003$\3768\274\356\206c\333g\350uR\221\332\271$\2603kwx\237\331\267\204SOi\376\355\242\001\025\312A\n\247qS\242G\020\202\023\f\324\343\241\026\264+\024\325\022\013\0130\024\3729\241F\352^\345\030htY2\302\236\350p\016\325}\355\017\346!\303M\263~E\006q\2522>\213<K\272jox\276\b\025U\003\256\3027\210\203\277\231\232\003\225\037\0275Q\354p\304"
+	.string	"D\037\203\363\205\026\223\342|%\2713\332 \007\370J\315\357\177z\274u\325\322\255\370\363\236\265\023\277r(\004\035q\027{O\223\276\232\tg\273\227\230\200-\320\346\026\232\271\257i\210P[\250\276p\007\0029\231h\323\234p+4\021"
+	.ascii	"\370R\317U\337c\253\365[1Zf\003<\0039\237\251\342\212\002\343"
+	.ascii	"\363rI\213\256\035\334\271g$/<\245\2066\241B\246\034!\371\303"
+	.ascii	"\306\244\f\225\254\210@\320\374\030\306S&\223[[\365M?h\2061\212"
+	.ascii	"\346\234\025la\036\367\022RSO\250\316F\247fkfr\221l\205"
+	.string	"\257\027\024\241\312\270\021\350\254*\275\016\3776\221b\344{\034\027\377\230bO\252t\211\222\261\250B\177O)5\302\224\204HBz\336M\375\312\013.k\375\b\377\251~\266\231\024\"\3649\363Yc\233^\231S\013\310\343\344y2\033*\251\034,]\324\016\344\023a\301\365\375Q\233\"F\213\252\277z\250:\231e\200\013\362|p\320o\002\314\323\002C\307\265\b\231\234<5\265\b\tA\301\372\310\355\367\364\243i\371q\030\177\267\235\263\035\203\256\200\0379I]CY\300CA\332\274\350\240\2377#\311\346\016\366\377\315\ntd\204f\035\006\307\222\235\004\377^\027\305\035p\030?\177\b2\374\333\231\223\276\037\006\tG\356,I%\311\271\031A\244\221\244\277nO\205h\323\017\331\255~\202\267f\207:J7\336V\241\225]\215\301F\001\232\362P\313i\276G\212\312\235\301\244n9\200\236\225\336\370\366\2625*\016\237`"
+	.string	"(\3304\263"
+	.string	"q\031M\004\367\002\254-\342\271\321\006\333\277\021\310\331\001\027\203\206r\373\020\224\304U\025\f\334\037.L\024B\346\2362fc\212%rlb,d<l\245\232\200\254\037\226\202:$\316\233\341\335\375\232\372\357\027\353\324$(\360\017E\252e> \373r*b\220W\204\002\023\366\265AR?V\303y\362\220\330xe\365\370\367\366W\350\177p{\327uWn\234\223+H\377o\020~Y\027\017;Y\314W\350\257!\252G\005\212\340\316>\306\265\241\246\240\230\244\356c\330\243\202o<\207\300\245<\005QMfY1H\260\013b-"
+	.ascii	"\237\322y\320\351\371n\233\317\3147\367\027\264O\210qU\3565\221"
+	.ascii	"[\335\260\334\261\236]\376\234\336$\3140\343\"\261\336\344\373"
+	.ascii	"\026\241#\364\247>qk\235:UX\360\341\261\374 \367D\371\276\324"
+	.ascii	"C\331PO|\013C\272N\036\004\266wg\270\025\033\rT\246\236\027&"
+	.ascii	"\227T\211\365*\204Z\001"
+	.text
+	.section	.gnu.lto_.symtab.5535242a29e43ba4,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"compassGetAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"quaternionModulus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5535242a29e43ba4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
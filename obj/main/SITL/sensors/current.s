@@ -0,0 +1,851 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\315\006"
+	.string	"\304\tH\001"
+	.string	"\027"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\353\263\230\273\r\002\002\003\002\004\004\006\007\250\335\362\322\004\004\002"
+	.string	"\002\005\b\353\266\342\341\005\022\005\003\002\003\002\006\002\007\013\233\346\244\226\006"
+	.string	"\f\242\233\362\205\b\020\002\b\002\t\006\n\002\013"
+	.string	"\002\013\r\016\270\272\250\266\013\017\223\247\316\242\b\030\020\245\225\310\252\007\021\022\340\207\245\357\f\023\244\304\344\337\f\024\025\026\253\327\227\253\013\027\231\366\331l\030\367\343\320\264\b\031\240\342\234\212\n"
+	.string	"\031"
+	.string	")\"\324\334\017\2615\355s\350\203\001+\004\332(\f\317\276\304\241\221\235\f\b\260\312kb:\354\326\316\324"
+	.ascii	"{@\310\340bfg\236\322\330\243\304\007\224\375\313\rvy\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375 b\355\001"
+	.string	"\004\002V"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\007\001\001\b"
+	.string	"\001\013\f\004\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.string	"6\t\026j .\207\253\n\333\214\241\022\0233n.\f\225\301/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`<\001m\t"
+	.string	"\262\21602`\211\222\016\300Aa;"
+	.string	"\203\257\202\265\024\037\004\001\004r\203\232B\334l\205\202X\204E\255o\360\240Y\240)\270\003\325Ou\374\3665\310o\215\020\271SO\321\340\257z\210\273\256\322\204\005\016C\303\232\261\321\340 \360\263\276\317\252\264\302\363\320i\277\311\357\352\205\006\b\302=\311\274\342\204\205\004R\305\374"
+	.ascii	"\230IT\017\216\0248\030\032\222\003\"\377n\227U;kw\325]\365\223"
+	.ascii	"\231\003\321T\304\307\b\234\212\301\2134\025\203\356v!xB\310"
+	.ascii	"\314\314\177\206X\352\001mB\022K\353\2006\241\352\207\325E;\036"
+	.ascii	"\247h\276\375\224kn\221\372\315 r\273Zff\253t\357\3431G\037\263"
+	.ascii	"F\221\231\357\037\267 - p\002\241*k\007\002\032oKp\241\025\332"
+	.ascii	"0\232\020\243\2605Z1%C\030\237f\222-[\307\276\020\253\327\002"
+	.ascii	"\303L\310y\302c\205\201A\200l\245\t\b\246\226\344\230\347\266"
+	.ascii	"\235}\016,Bv2\267H\200G\303Zp\200\"\022L\352,K3\320\210\226>"
+	.ascii	"\274!\230+\266\203h'w\2476\\6\314 \341[\325\270\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"}\004"
+	.string	"\"\307\026 \240'\351s\025R\365oR\335,@lx\013^\363\377/\376\273\214\374\326\315\336\277%y\023\231d$\257\177\326\366\006=\345\253$K\365V\357\307\277)\245\024\005\001`\215,\313ll\2703~qg\202\32087\316\207\324\233I\317\244ND\355\341\366\314\244(\221\250\355\241g\200\216\025"
+	.string	"\"F\326\025\006\323\235\202v 0%0\001up\331\036\246\345\214\006N\320l\342\272.%\274\007\312T\231M\252\341\241\304pUp*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\007\230\004\b\232\004\013\230"
+	.ascii	"\004\f\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\325\004"
+	.string	"\322F\025\037\220+\303\001\377\277\242\372\377O\365\257N\337uWX\027\347\361\276\237^[\303\326\333\222-S\nV,\027\n@}\206\302\204\346\017d\013\315\037s\307fc)R\221\2153!0\266\213M\027\250\330\356\200\2039\261\223.\327\324\025\321]\304\207\355\2633;P\351\222\035"
+	.string	" \013\311\030\254\241!\300\0016\001@\034\036&\324\214\202\270X\334\002f\364\001\346\fg"
+	.ascii	"\366\240\240\340\204\240@\023$\032\316\202\023\226\325\253%P"
+	.ascii	"X\005\004\360\351\201Q\223 nK\360\227@\006P\004"
+	.text
+	.section	.gnu.lto_.lto.ad4184cad5cb51c0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.23.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.26.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.31.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\261\023\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\315\030us\334\007uq"
+	.string	"\005\001\006'\001\004\200\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.33.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.37.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375 \212\r\004"
+	.string	"4\007S"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\321\027\007yw\350\347\006yu"
+	.string	"\005\001\006'\001\004\201\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.41.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\226TJ>0k]8S\330_\251`9\355\246\326\270\27753|\206Gu\036\037\273\236\247w\200\032\2446\214\267\315\275\376\357{\316o\326S0\300\003\031@bh\207a\201TE\232jo\354\336R\246\0248"
+	.string	"2"
+	.string	";"
+	.string	"\023+\016\032 v\023\264D,\013[A\260}\2109\266\207\217\245}\212A(\025bw7up\316\223\343_\302\037\242\250\363\224\350\330]\247(Rp\353mGlK\354S\002\037A\212\322nx\321?\035\345\371\017\216\371"
+	.string	"\230\027\217\371`v\314\336 \310\213N\025\212\005\322\216=zR\033\330\277VI\266\246/Mk\246\363\351k\001\226\fU_\370\310\332g7\214\\z\220\006O\266\234\252\272\001\372pM}h\204\315=\325i\273\037\016\177\302)\020\270`0\331\261kE\207\f\021Na\266\374H\213{C&\371M\001\346&\232L\367}\033n\003?\017\314t\340\226\271X\nl\334\007n\023\f{\006\272o\323x\336\267A\306\360\327*\t"
+	.string	"\006V\250\036_\344\027\214N\311.\275\351\026*Z\205\253\002\b\250T\006\004\024"
+	.ascii	"3\241\267(p\030z\033\310\004\f\004\311\240\233\310V\224\314\026"
+	.ascii	"\276\300\225\221\346\022\246Ta\201\201\020W\371\270&\"\rA\277"
+	.ascii	"\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.42.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\345\b"
+	.string	"\266\220>90%\2511\200\003\250\311W2\263\204\241\020e\365^?.k+Z\214\006@\024F\332\245\344\017\331wr\255\275\3050\307 \r\252<\276\251\353\261\020S\350\226\261&\367\226)\005*"
+	.string	","
+	.string	"0"
+	.string	"\004\035\313\206m\216[\"\267kd\303\005\373?\263\020\207\216a\355\025{R\252\223c"
+	.string	"\304\377\306\224j\345fn\233\320\366\241-N\326\376\277\031\253\325\266\016\032\005\233\237#\026\340/)S\262\265ul\215\342\224\320*\246z\376\017\230\230\377\re\020\260DpA\307Rs\250L\343\363\213\313cRs\262\340\226d\027\223\301\315\177\207\232\305-\0305\211e3J\321)\313\272\324\261\334V30"
+	.string	"\250\030k[\247\230\201\264\001`\004\007\202(F\023\340\007\262\030h\350\003\2128\317#\205\346\347u\237\210\373\246\250\002t1C\3367?\007\355F\2347\301\256\363\346\326\272\265g\254Jx\274\002\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.43.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`M\002\025\021"
+	.string	"f_mE\360\322$\0352\343\363\374\253\361\352\216ioF\004\372b\037\r\357\317t\370g\257\013\215\305|u\3406\036\033\025\204\267(\330x,a\242\271qZ\001>\026\025\350\211\365\321y\207\031\"77k\203\265\266\367\2262\245X"
+	.string	"R"
+	.string	"`"
+	.string	"\2731\022\217\240\016\035\273H<D\335@<t\313\336\361\330\316>\250EMP\217\335\3154\304[\217\360i\266\374S\311\356\336\347"
+	.string	":W\314#\316!\207\r\371n\256OA\016\321\215"
+	.string	"\027\315\0239\002\241t\237g\007\327L\346\251dw\235\235\313\346>\335\366\212\355\005v\276\002\273\f|\024\377\321\340\363\034\232\365\222\357\016\375\227xx\r\261A\202\365\310d\223\035\213I}\331\177\273\273V\035\373=\177\200\227\216/\r5\3752\255\231\316L\237@\252\304\321\b\323\256\207& k\004g\214H\331~\3327\361\023\255\367\300\274\300\256\316P\214M\277\210.\307H\365\345\004?\211O-"
+	.string	"\351\240\311\037\366i\274\306\211\317\343\t(\371\016%\036>\205?K\260\017\2526\205\313\250p\030\233\203$\247\374\305\212$\351\320\205\352"
+	.string	"\033%X\252\255\235E.]\370\n\025\251)\022H>\256\266\312S\004aX\t\331\341\201\211\207Z\324\3610\313\2016\324\006\234\346\242\261@\257T.-\032\307\275\2542\026\267\261Z4V\326\242\222\302\222\2558V\246B\340-\203\306e.\333\306e\251\330\376\255\352\370\001\314HFgbT\275\210(B}\371B\177z"
+	.ascii	"\207\351A\265}\033\037\202\220\355\354n\003\377\306qD\220`b\022"
+	.ascii	"\017\363\026\352x@\2159j\202\310d/ \300\002\021\241\354\001\263"
+	.ascii	"\320\305\307\360\fe\357ff\313\025\313\231\341\r\200b\227\316"
+	.ascii	"I\306\363[P\n\257*D\213j`\t\311\225f\261\375\007\t\245\340\321"
+	.ascii	"p\326\303\033\230\007\005`\245\362\352\f\217!\213)!\302~R\374"
+	.ascii	"\033\340[-\3136a\024H\327\026\354)bH\356\3560k\n\253Y\2146]\255"
+	.ascii	"8\262\220\031S\212\f\005"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.45.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\325\006"
+	.string	"r\r02`M\323\001\300.\205\203\254\373"
+	.string	"3\004\250\3114\340\341\n\004\347\n%\326\261\204\217\035\320\354E\360\327N\tR\206\004K\262"
+	.string	"[\242\363\216\272{H\231R\216 \313$Ax\211^\005\251j\222\2527)$,\274\bV\017*0\305 \301g\241(\370\036m\257\032\204\222\r\243\020vr\340\376p*\277\3065\213 \333\305<\372\033\347\270\370\027wn\260\362\361\316\267\234;\333\341!\037\235\035 [\204b\266\206\245V\330\007X\325\330\372\220\204@&\273\023)(\2739\017\f\333\177|\331#\327\262\375FDbs\262\273O-~=/\377\031\027\210\031\354\031p\260\273\316\230\241\270\365\266\rlWlg\001\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.46.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\036\004\335\033"
+	.string	"\3662\262J\240\230Q:\301\352\365R`\342F\222'\001\206\257\200_\214=\204\025p\002z\367\035\316'C?@N\336\336\370_'LQ;Pf)\345\207\261\032-\360\r\270\366\205A\377\222f\274\220\f\305\245\021\367\352\231m\204\020\"wJ\001\227"
+	.string	"\216"
+	.string	"\243"
+	.string	"<<\256\024\364$\343$\271\\\264\203l\227\213\324\305F\272\2050u\027\003*G\207\320\201\005\\\\\221\260\324n\360"
+	.ascii	"w\240\020\354V\240r@\325\n\\\340\b\254\213>\265\237\343G\270"
+	.ascii	"\377nn\325\n\203\210\217Z\353\002+`]4\360\001\343\305\3602\343"
+	.ascii	"E\343\354)\007\372\352\203XJ\004\257\324Zc;\343\270\217b\270"
+	.ascii	"\024\347\223\023Z\274\336\320GW\217\305\305\025\017I0\355\350"
+	.ascii	"\276\364\316\320@\255\365\301S\023=\035\245\344\204Z\253)\257"
+	.ascii	"\227\342&o\273\307\266i\207\017\002b\270\205G\365\245+6\225\260"
+	.ascii	"\362\207;\365\260j\335A\360\233\336#\204O\343\242}Jz^9^\374:"
+	.ascii	"Pbu\343\227\243W6PG\267\310~XW\206mH\352\032\222\032FR\323\374"
+	.ascii	"\367\023X\352\031\222Z\346Kw\314\221~\001\327\361\303\034\370"
+	.ascii	"\007X\352\327\221n\327R\267\226\232\265\324\344R\217#\265\270"
+	.ascii	"\324"
+	.string	"\341R\357RS\221\3727//\222\304\242j=q\245\245J\211@j|\351\366\223|\246%?\261\206P\260x\314\340M\325Z\023\\tN\254$W\222\243\2433^\224\331+\235\036\251\360\021\035\375\242n,$\255\r\222T5n\221\317\364\326T\224U\230\340\016W\300\272\326\204\3152rCP\344<\252\231\245\313Z\361\310ID>!wfo\230\2348b\226\224r\032\211;.\271\205\303\241:\f\0217\302\216`\325/\027n\314^\312I\324\340~\032w\303\265\t\2368\\\353\332\335[\331\030r\032\351\350\225\270E\017W\206\220\303\354\213\026Yh\255uh/4\006XX\013+;\242\354(\026\323\265=<\310\255\300\223Z+\004\377\307\201\310f4\332\370\265\322\234\311,\2304\033\017O\206\027\240\322\304\251\225f\211a\347\207BPy\201&\3024\313\032\b\223f\207\346S\223\211&\005\232)\333\001\322`\332d\""
+	.ascii	"x\306\300\374\241\325j#f1[\255\264\375"
+	.string	"\320l\261\237\036\231OlV\263\305\030\334\270\004\242\325bfY\326b.\300\334\303\007_\201\212T\325Tnu\266\301y\224\333\313\007%G\307f7\370\242N$5\353\304N/_\023Z\205G\005[\231\255Y\261\351$\3229\375G\205I\252Z\302\325\225\322\256\326\334\001\232\205\355O\243\327\322l\315\3239E`[\373Z\362\310i\244S\262\206/qQ\250Q(E\225Q\b\ndF\202\314\322\302\214\001p\002\2212\253\016\020pFCI\306b[\326Z\211=M*\210\345M\260\202\307\020\206\021 q\371\263y\031Y\223\377\006uu\373P\267*>\250\277\035\351\254f\221(\270\3075\253\310\311I\255\032\205i\215\263\315\r\305\231\247\203\241\\\207\bT\003/cj2C\026\372\220G#\346LS\201Ax\304(I6\f\3706\002\220\205A\2246\245_x)\036\023q;:\314\215+@\224\362\222\345\332\001\312/"
+	.ascii	"\331\2248\305O\304V\256\342]\325+\264\251\n\201NP,\272cM\031"
+	.ascii	"'>\267\235\360\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.47.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\005\013"
+	.string	"F\024JA0\307(\035\220\313\313!\3373n\316\237\344\357\325^\374\354\352:\004\254\220\201r\306\215\251X\206B\204h\r{\036\342\177\320\312\206g\b*\002N\r\300h#z\207\201\004\311\005\360\345\223\310m\367N)4"
+	.string	"6"
+	.string	":"
+	.string	"\226\320N=\376!;\325\356\220\235\032\264\035|L\355\001\234\220\260 \354n\235)\007/A\377/W\bO\245\313\004\214\335\265\fO&\367\274\355\b\333\024\366E\002+\321$c\366X\222\023\305\276fw\327\023e_\3745RZJ\351k\013+\f,\f\354\226\304\"\354\213\"P\331\330\276\264\337r\027\360\"\351\r\273(\005\007v\307\211\003<\025v*@N\006Wk%v<\200\306j\301\247\375\371\f\013\244\343\244T\244\354t&\b\037\370\3432\237\266\273\025>\314cD\276\352\324!#\371\360\324\037e\247\237\034W\201\036\027\342>\324['\004\342<O\264\325\317\353>\020\367U\220g\343S7\357\253\035\bw\036\234WC]\347\325\315\270\327\354D9\203\345e\232#\226\323\336\336\222\r\270\023\370.`\346x\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.48.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\252\003\235\030"
+	.string	"\266*\231L\240\326Q:\304{\276FPCs\036\312\211\233\241\216zh\360oOY+`\205\331\374\203^/\374\004\272\360\322\016\377\370c\017Z\315>T\331o\004\263\243\321\240\321x\275\024\027\306\250\263^\372j\277$Y\23796K\310\336d\357$\003\177"
+	.string	"}"
+	.string	"\206"
+	.ascii	"\347o\013\317\327\356\003\237d{p\247]9\007Q9\345,\\i\007\347"
+	.ascii	"/\202\253\340\337\362\003\360o\333\272\217\\\350\313/\372\310"
+	.ascii	"-m\345\234S\353\342\266\237&\276\245\255\266>\361*6pG\034;\236"
+	.ascii	"\237gz]\221\005D2\177\343\035\347H\324\233 \350\207\367\362A"
+	.ascii	"N\360\212=\325\226\fzU(\002\354F\224*WBZ'\276\226\330\341j5)"
+	.ascii	"\344\234\273\352v?o\327\273\233\327\335\017\272-T)\216zI\301"
+	.ascii	"[M\376\205\256g\264\226\350\365\035|\373\341\f %G\"=\325I\267"
+	.ascii	"\020W-Q\367m2\231L\266\035\352\276\265Q\263\366\013\327v\341"
+	.ascii	"\332'\256m\336\332\367\303\337>\370\237\300\215\214[I\\\260r"
+	.ascii	"6\221\204\222\215\027\nFw\277\177\343E\234+\365\202\255\036\013"
+	.ascii	"\234nt\351L9W\352\002\277\030=`\316\031\375\355\316\351F\177"
+	.ascii	"+\332\335U\370\032\266\017u\236\222\363\020\2244\276\234s\204"
+	.ascii	"\376\361B.\270\274\274\340\337\372\226\302\277\327!\257\305C"
+	.ascii	"rQ$\250x\342S*8\f~\331\016\304\003\271\025L\377\327\030b\352"
+	.ascii	"u1\370\367e\357\320\b\022\317%\363\252\f\357!\233Pl\r\347\261"
+	.ascii	"a%\353\227\312e\005\374h!\2353\237\252Fh\276#\352\264\250\f\254"
+	.ascii	"&\301\206\375I\006\300\347$\"\326\377\351\340_\373C\207|\261"
+	.ascii	"=\\\207\354\3149C\350\347x\323\207\376\357\267kf\365\272\031"
+	.ascii	"\3765-\221\264\330M\254\346r\220\325"
+	.string	"\206\261\334\330\304h\264\020\260\264F\233\325lb\265\324FFS\223\302h\265\224\305@\317@\304h\351\315lFKQ\341\355e&\276\305\310\330\004\311\315\342\312\234s>e\216\344>M\035\301~\3044\222\332Z\322\340g\352\231k\025\371\370z\300%\267\232\274\025.\251\311<P\255\355n\251P\257\353\322\3624\022)\024\205-Q;\021\237R\204\006\220\222c}br\325\342\242,\317\302B\355\251\212\254rQ\256}\220\017\261\220\006O\250\201(\344\214\202\006\215L\220\221\202\202$\035\200\002\221\301\252\016\021p\271633\205\225cb\302=\021\266\0240\214\365\343\244\026\234\324\210\224'\235sz\321\266a\205\b\365\204%A?\270z\3418l\334m)\353\313w\022\"\224\374\016[\376\205\234&L\344\212~\026D3/Zq\322\234\3511QM\274Uxa\001?\372\333\276\2714\226N\337\344\304)\324V\275xN\317"
+	.ascii	"/\017cV\362\222\216\026\235+ N\215a\205\226\214;\326\021\304"
+	.ascii	"s\361\351\344\266\263\003\030\365\0271%+\357\b\037\222\233\204"
+	.ascii	"\033\344Y\325\337\250MZO\r"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.58.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\360\001\225\020"
+	.string	"\306]iH\340\2626\035P\017T/$\274\202\021l\251c~\271\305\337g\246\347I\002\211\022@\341D\330`\365^\t\001\001vQ\326\253\342\1771\223*e(\017\201\304`\206\212!\246|\377\360Q\204\316\007\217\t)\031\223\245M\366N)Q"
+	.string	"T"
+	.string	"Q"
+	.string	"\313\342S\263K*xu\202\355\325\344C\264\327\355 \332\253\375\026\266Q)\036m\035'W\373\031\234\017.\037\273\333\275\322\024\037Og6\372\257\207\274Nvb*\036N_\036\204&f'\2462\342s\3003\020\204\335\365F\342\256\267\375\3006\003{r\bb\214\227\246\303\214`\245Z\331]\223\375\231\307l\316%\207\271"
+	.string	"k\205\312\305\356r%\324\177\201\362_\346l_\006u\227\311\224\260\251\022\"\257\2461\2071\336eb"
+	.string	"\273(l,\330^\017d\234\347<\211:\314\211"
+	.string	"\271\"R<\247\375\227\267\306\303\234.`\003\332+\315A\351\361\322\031>\343\333v\267\201o\363\033\r>\353\325#p\036\005\324^O_~\366\254\360\250^Z\251\3713i\213i\366lw\327\224\305\006M\323\223\377\004M\177\023\001\021R\355\206\370\361\331\023\325F\305e~\373\276\214\327\210\2079\333a\"\030\276\031z%oT-\032)\221\27404\211:1\004E\222'v\244\217d\324\211B\261\0331`p\203\027v%\020\f;\356\257G`\221\343\007\217\024=1\245\264\3056\235p\235\331S\3419\237\203\322\026\216\343B\307\363\212Ci\350\206\306\245E\362\033\024\\t,z\215/\300\212F\007\317g\235\002/ \220\002\0213\255\003"
+	.string	"\nP\346\036d\004R\t\351\317\230\202\341ab\303\264\206\207S\005\0320[\271\247\215\2029\n\004\217\2549\235\002\021<\f\341n\b!\362\300\210\361\003\206\203E.9D\232\027\320\343\266\314uiKeN\246\333K\373\237I9\206h\206&\fQ\274\334IZ\3556\246\2541"
+	.ascii	"h\357\350\311\264\364\2047\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"\r\b"
+	.string	"\344\n\364\001"
+	.string	""
+	.string	""
+	.string	"\002:\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005,\023\201\204\032\177 \272\200\202\002)\177!\005(\021\0053\"\033\016\200\003\002*\177#+\177$4%5&\002-\177'.\177(\")\002/\177*0\177+\377\377\377\377\003%,\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005#-\005!.setdata"
+	.string	""
+	.string	"\005\037/\0340\0351\0312\0303\0274\0035\0012\1776\037"
+	.string	""
+	.string	"\200\200\200\0011\1777\003\003\033$\003\003\032\304\001\003\013\017"
+	.string	"\323\243\362\362"
+	.string	"\001\342\007"
+	.ascii	"$ \260\002!\262\352\250B\312A\3166\f\227\"u\31143\t\343\260\032"
+	.ascii	"\2010\260\031'c2c\300\214\235\361\256\204\304N\341{\214\030\032"
+	.ascii	"\b\347}\342\200\361GA\002\264xD\f<xa\277\361\365l0j\203\023\317"
+	.ascii	"\226\001\337\360\003\362\0334\327y\002"
+	.text
+	.section	.gnu.lto_.refs.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375 \2335\003"
+	.string	"\242\b\026\032\200\265I\00730\00330\0033P\304\343\343\267\265\247\337\324\255I\333D\246\024\016fXa\004\263,M\031\202\3268\364\224V\351\312\344\b&\300{x\227UY\223\027%5\357\311\200\341\017\331\204\026\241-\016%JMi\034W{]\314s\346\b\275f\214\265\276N\r\b\003"
+	.ascii	"\237\020\254\317@0\033\3142"
+	.text
+	.section	.gnu.lto_.decls.ad4184cad5cb51c0,"e",@progbits
+	.string	"(\265/\375`\003)\365\263"
+	.ascii	"\312\033}>Z0JQ9\351\232$\2571>g\212\344zc\247\315\203\331\335"
+	.ascii	"\315>\371\213<\335\0321\215\023\315\2053.\035c#\004\266\260\336"
+	.ascii	"\360\377vU\221\233\322?\0374\361R\371>p\254w\213\264\021@Z\221"
+	.ascii	"\222}\227eY\336\206\310|~]'9\311\216J\311\275\003\0061b\367\226"
+	.ascii	"2\005J\003\323\003\370\003/\220[l8mW\357\345\361VU\306\214\214"
+	.ascii	"\25256\344m\322\035\251j\036\r\243e\354\206\310\353\264\003+"
+	.ascii	"\252\225\271i\251q\332.\270\341*\211!V\335\213\004\303i\326\234"
+	.ascii	"\333\230\350\240y\364\022\247\361\322x\253\332\232Z\031\326\275"
+	.ascii	"\310\0216\f\027%- \3002\210\034\325\371\234\323y\033\347\274"
+	.ascii	"-s\336\202\235\267P\210\035\203g\371t\206\212\020\342S\273`\246"
+	.ascii	"\030|,i{+<[\330J\234\354\341m\327\021\311S\2058\274\204\2110"
+	.ascii	"{D\230\257kN\206\3438\234\304\200\343\316p\370\315sB\344E\366"
+	.ascii	"\020\270\257\212\201Y\343\342\030\003\363\365\205\263\253\327"
+	.ascii	"\271\241\255Y\006v;\267\261\233\235!\267\331{\205\314\027\354"
+	.ascii	"\230/\310i)\"L\232\366\265\353|-r\372\324\342\371\032<E\2449"
+	.ascii	"5\330r~\360u\276\235\234\367j\252\363b\354\301d1<\206\223\026"
+	.ascii	"0\231\233\350\3405\330u\265\356E\366\360\304i\022\007N\333w\324"
+	.ascii	"y\266\300\3448\266\300|\017\317\re\354\301\264\240\007\211\203"
+	.ascii	"\211\252\355\317h^4T\331\202\364j{\346sV\3510\366ps"
+	.string	"~\003(W\264\246\224\361V\031\277\300Qv9\367J\205U\335{\2730\0276\343$\227\361\226\021>\226\307\332\221\030\247=\247\235\347-\347\317Z*q\351\210\344\220\263E\210\0254-2\206\302Q*W\361\2342Ud\215\311X\n_\251\\\305\234\032SD\2620\026N2\031\207\235\305xl8\302'G\204\214k\312\264_\262\007s\207\265N0\237]\f\031\314\222m\317\307\363\274\365\3650^zq\325\222/kL\205\223\\\205\275\316NX\353\026y\257\327\275\367\033\374@\347*<\205\243\200\210q\257\324\016\n\272\242\300\360\342v\357\035\3413BG\t\307\325\322\2647:\217\302\371\b\234g\300\311H\346\342\344\265\260\362\374\204\267\2363D^\345\275\267\207\203l\t\006i{\240\363\334\365\t\204\367vp\235s\205{\357\325\361\265\230\3573\004{0-w0\217d\017\346\311\035\314\020H\360w\333\317 \350\006\370|"
+	.ascii	"\177\263\235l\001\257\302 \034\0137 \007\b\247\340\257\027\320"
+	.ascii	"8\231$\377G\370\374\303_=\374,\242"
+	.string	"r\370\233G\003\r\244\301\317\006\370\231M\377\374=\200.\221\201\005\376\203\370\004\177\315\345h\005\234\347\257=~^\376\374\345g1\377\353_\277~\266\362s\225\237\275~\226\3623\225\237\2574\211\237\255~\216\362s\262G\374\357\371+\227\377e\377\273<\356\357\376;\001\177\213\370\033\001\177\037\340o\002\374}\301\177\335ou\177\207\370{\367w\356\357\3723\234\237\335\374\314\366\363\232\237a\370y\314\317c?\207\375\274\302\317P?\347\370\371\351\347\342\3174~^\372Y\306\317\304\237\207?\013\177\036\301\317!\370?\201\377`?\037\375l\364s\007~\336\340g\016~\036\372\271\350\377\331\317\034\370\231\350\277\362g\364g\336\317A?o\340\347\023\377e\370\371\001\377O\370\331\001?{\360s\007?g\360\263\002~>\300\177\264\377^\376g\371\237\342\377\007\377\315\376\357\342\342\342\342~\233\302\257\213\373-\270\021X;1\256X"
+	.ascii	"\343\346U\230\013se\204\n\325\t\007\327q\035\334\267-,\235\021"
+	.ascii	"\"3\314\210\363\216\313\251q\262\365\033\266\206c\336\313\310"
+	.ascii	"cS\361\032\213oo8M"
+	.string	"fI\306M\257\351\2657\233\263i\2673x\357\007(\243Q\204N\326\030(mm\333\355jv\356\325\272\367\2020\253\270\001\361\322\266e\350.K\245T\003\243\355\335\264\233\3779:SH\245e\273\351\030\216\224\t\343\344,'\316\315\022-m\223\335\206\267\230\\\236\364\b\323\3669\301\363\347\231\363\357\337\274\302\342\275\267F\016y\213J;\346\317\347\034\363pe\002\374\267\367&`\350^!\3302\206\323*L\b\025\342\346\226\367\016\245\202\020\220r\032J=\021\225R784\022\344P\274RA\242\362^\016w8\f\216p\274\034\210\312\353t]\204q\342\213\224\n\336\341\361r\270\303+\fA\034J9\021\225B'\016D\245\224\323UJ\335\rw(,\306\030\336\"\207\253\224b\273\312\243\323\006\242\362\350DTJ\005ac\214\037d5\254,}\030\231\2138\2744\230\242\204\305\rK\"\362x\315\334\313^/n\221"
+	.string	"\367F\035\213f\204O,\246\264\244\241dEx\344\017LJS\307;\\\022\257\216\367^)\261\270L\034\004\221\313\033\204\227A\252\250\273\364\342\336\n\230\356\r\362]\336{\203\367^]1\ny\257\216\r\304*&\246{\215>L7*8\366\342\336\366B#\346DTN\035\201\306\244(\253.\fd\220\253\256\031\251\342\251\fr\335\2456g\225\223\r6\27371Mmm\221H\0351\036_7\324\316\304\031Nq\341<S\2574Q\023k\373\363\251\3149\331e\372\213Y\244\200\017\265\2653.\t\031\2268b\316\311\026\323dr\304+\264\n\201\305H\202\333\266$\323\264\035\303\263\314\242FX\346\274\216LD\203\311Ik\263\303\353k\331_\300\310\200fJ\333Fk\0313\340\234\024I\236\223\235\354\263\034\342\2755B`R\365\266\345v\213E\022f`B\246\230\264\275\356\236V\320\326\266\276\240\304\264\274\266\276"
+	.string	"UA\253j)bh_\326\256\240\255My\341\013\225\207\2259\021\273\367\276\320Y\272\254\2714\226\336\322]z\254\265p\262\311:\354\255\354([d\r\3660\":\265e\233\321(F4#\201\275\t\346\274Iv\336\f;oZ9o~\2357\245\2347\223\347M\344y\363\311y3\353\f\301\035\314>\262\007\323"
+	.string	"&\021ds\345\320\034\tb\325\366&\024\022\312\025\213\244bUf\353\tO\032&d~\264\325j'\234\354'\235\325\310{\225X}+R\354\204\221\314z\322M\372j'\334p\207JM\252F\214\320\305%q!\306\264\317\3059\237s;\237cc\202\3019\304REk\211\022\025\214\306\255\266o%W|\244`g#\n\226\216\266\215\244\223p\362C[\261\001\242\344\324\366\2713\247\b\356\345\017&\307\305\361\007\263\217"
+	.ascii	"\275\253:\230E#\362z\2050\204*\253m}\033\371\240c2\326\343G\027"
+	.ascii	"\311\r\215<I-\265\220\031A\232H\017\341d\013i\027\316`\032\210"
+	.ascii	"\225\261\026\302K\257k\247\230d\334\300\272\367\266\225\037\367"
+	.ascii	"\352\264|sd\347\337?\232\307\020\251\241\2223h8\r\250\250V\206"
+	.ascii	"\325\001\215\020\262\2744\017\236\241//\201@@+\315\332\275\310"
+	.ascii	"n:\253\002\352\031\234\246+r\333\304P\004j&N\323\rY\376\035\325"
+	.ascii	"\306\366\321,\364\215\206\352\247\316\321\307\336\321S\255\243"
+	.ascii	"qt\013m\243{4UKq\262yt\361\355\3245\336\274q\233y\344\252\225"
+	.ascii	"\271-\303\314P\263Fl,\330\001]\336\264\2651\354\322\267\304\200"
+	.ascii	"\002\267dg\350\306\250\200\b\315vf\200bS\306\312\350\260z%\225"
+	.ascii	"\265lk\211\017+\353\002[\3530hM3\274\265}\317\323\371[\027\326"
+	.ascii	"E\207\221\300\025:\211\330\022l;s\273"
+	.string	"\3052\022\025N\227\037Y\322\340~8\253\224C\264e^\326\306\330\234-\021\356\2541\262\374\022\207\3241\022\301l\360\267w\347x\3570\027C\f&\267\2665\316\311\215\037Dr\306\340(a\241-?\001z\215c\251dhJ\362\206+\234d\205S\337\370\\\313T|\333\302J\313<\265\331:\353\233\3369\301\200\207\254\212R\333\210"
+	.string	"\356\013I\333W7NK\341^$\207.\305\036mM"
+	.string	"\275\266\231XYZx\323\206\253\0337\265\215\317\r\262\205`u<#\301E\240\330\210;\236\315\265\rRk\247\251i\310\221\215\315\207\027\217\032\343\005\322\366\273\241\0325uM\231\230\206\24608\263\035Y\226/lii\2570\244\3250\025/4\374\020\003\266\266\273\201\325\346M\333\212\246\252\3253\325L-\303#\005\313+\032\226:F\204Qx#D\2235V\323\002w\326V\fR)\345\212\255\355y\212\234`\352\222\2235L\375\202\245\243\206A\336\242n*\207\214\033n\0320\203\341\215i\317s\343\254f\325K\016\226%1Qg\032\200\204)\242\244mw\321i\025\207_\\*\334\031\226\030e#Pk\241I\333\272\345|\301\343\002\203\0344]i\206\264}\335\362W-\365\205^\2022\256i\3735\366`\356z"
+	.string	"\275f\351#^ffhcc\rCo\270\303\251-15Q/\236\266\316s\023\256;^\217p\262\356\250a@JW\230e"
+	.ascii	"'bQ$t\222\360\020\343B\333+\310\241nF\216*^H\316\263V\222z\245"
+	.ascii	"\246\244Zi\241\301\252YK\276hU%/\215\033\356\360\312\2325\257"
+	.ascii	"\272\244Z\355\202\034\356\245:SE\245\202U+\365\253N\251U8Y\275"
+	.ascii	"\252\223\327\252\212\344>\325\25321\223\346\346\310rg\223<\r"
+	.ascii	"\b%\242\004\266\252\262>\251I^\032\221\267\206\016\030\2300o"
+	.ascii	"Q\252\024NV\345}>\360\3009\343\266e&\273v\304d@\301h[\271\224"
+	.ascii	"f3\250\234\240p\262\"{`$\201\333z\232\030A\0313\256\205\2051"
+	.ascii	"'^\332~\207\306\371\035\342y\0358\265\311Ifm\007\232\233\363"
+	.ascii	":l\347u`8\2573\346\274\316\227\253j\245\354\022\003Z\265\342"
+	.ascii	"\264\026\343eI\311\354l\021\334\301\254Cj\221j\344\317\351\311"
+	.ascii	"\022\373Q\005\313\371Jd\002B\276Tikk\220W!\177N\233\035\251b"
+	.ascii	"\272r\276\272P\201\3749;3F\276\270\244\234\257?rU\342b\310\321"
+	.ascii	"\266\3728_\350`a\240a\307\225\036Pm_}\324c\245J\201\002\020\304"
+	.ascii	"\301\265\265\255Ru\352\225\252\266p+\025\007\307{\205\225\252"
+	.ascii	"g\206{\205=\314\0270_`\263\246\216P1\355u\254\316\233a\017&\017"
+	.ascii	"w0Y\f\350\225\207\016\332\013kP\332^\247\t\n\252\315\255\306"
+	.ascii	"\260\"\234\266\034\311\232\243a@\341\fKz\351\271`\264\340h\251"
+	.ascii	"Q\243>\235\367\255\352M\215(.\034"
+	.string	"\257O94\270\220\271m+\013\034\205\f\r\023#m\353\rnCr\266FM\333j\203\333N\245\215\"J\rY\305b\025z\021{\333r;\257\316@\221A\212F\262\322h%\317\r/\025V\025\017\222\254(Jm\257!j\211\223u\211\323\270\3536i\200\341\224\344\206\333\275e$,\334\232\264 ng\225Qet\034\031+Ugd\270\260\214y\361\242\022}\264\360\204\031~\251U\030\257D\246r\215D8\212y\346\252\005\030`\347_\207\347d\0356\032\t\034\257\215\020H\226F\022;illr`\325`\rV\341yS\210\275m\005h\312KS\240)o\b)\251\202^\321/\005\376\240CIFB\275\242\237\0370\351g\002#\243\244^\317\327\323\245A\346\007|?\026\251\257\247[\301C\215l\212\002\217\320#\223\004\024L\350p\026%L\260@\t)~R\224\350\307KCt@\310g\204\002\375\371P\364"
+	.string	"\321#\336\004\200C%\364\240\240\241Q\f\241\351\317\207\204\224\004\254 "
+	.string	"\026"
+	.string	"\203\316KyC)\n\334\241\030\341\204\021\322\021j\001\004\264@\362\241\030@\212\364C\204\324A\250\227DB\212\002uz+:\315\001\203\210\220v\322\240\036\021R\256G\204TQ\020\024\001-\020\210\376\206\206x\272\026H>!\373K\221\352\020\332#*2\342\351\206P`\222\025B\201\272\377\202\210\220J\360\374x,\204l\213_\n,\"B+P"
+	.string	"\n.\310\235E\211\237!\243\242$\025\037\320!\337\tDI*\320\241\034\024#\234\350\300\002\210\376V\240\0258J!AZ\324+\001\305\b':\244(\220\203\006%\322\037\017\251\304\020\017\255"
+	.string	"\005\027*\372\241=\224\350<\007\036d\340\301\007+\350\376\001\b\032\200\240\201\371\017@"
+	.string	"\002\002\301\003\240\363\036"
+	.string	"\3254\365I\323\263(\261\342\247\347;:\362\t\005\300D\213\006\006\r\361\222<P\244b\247\201\212\006R\321&T4\020\257M\360\032h\2056\261B\003\265\350\037\232\032\025\221\220\362D(\022\032\342\361\240AC%lH\001\0025\342\t\001s)\n\\\261\302g\242\030\341\304\004gQ\002\030DT\264\242\347[\201\327+:\002\300\007&H{(\020\375!\245\276\336\007!\025\214x\320 "
+	.string	"\240A\022\240B\277$_\n"
+	.string	"\244A\036"
+	.ascii	"\235-\322\"!\036\022OEO\312\023\001\003(0\211\307\310\347\023"
+	.ascii	"!(\007L\177\250\321\t\024(0I\202\036*\364CQ@:J\002\366|B \200"
+	.ascii	"E@\364\207\246\300\026,v(\021/5\362\251`d\204\n\031\031%\255"
+	.ascii	"\350\220\366\222|(\214\214P\024-~h\232\362D@\205~\276\025\036"
+	.ascii	"T\340\031\362\025\375P\024V \231\220\362T\024\361\020\365\212"
+	.ascii	"z?^\006&H\203>H{EI:#\236PQZ\364C\361\363\221\320\363\025\245"
+	.ascii	"\274_\322\b)O\205\n\024\244\300\240]\nDS\236\t;`\220\021/)\375"
+	.ascii	"\025a\240\202\364,,\270\017\t\375\375\244>\337\357G\207"
+	.string	"\204\034`\320\211\023~h\212\236\020\200\023G'\232\362\322\024\275\017\360~#\260\340\035\361\244A&6H{E\272\003\001\241\bq\201\tD\340\024*\221\366\320\337/I\350\007\370\363\001{(\360\247W\304;\372\021\372\001\177J\200@\211x?\024\351\210wj\301\tZi2\263V\277\225\315\342[\274\327x\203l\034\214\335\267-7\333\3446\353\204\035/t\264\265J,\026\023\027G\214X\226\311\333\233\213\"\030\017\0163\312\255%\354\325\304)\254&m\355\025GiB\262Y#\223\244\317\336\300mY\202\304\322\260R\302\274hR\205FG<\2661\036i25.\316\016\033F\354q\267\204\022\027\244H\303\360$\345\251\211%R\327\354\260\256L\341\262C\352\030.\304\266 Bl\220[F\312\331W\220\337\002\341\265J\225\302\025/Q~\264\315\271\360#\310\t\t\231\266\267?\250R\200+2\343K[K\005t\353C"
+	.ascii	"`Z\306\332\352\354\224\225\322\321\202\017\031VJ\231s\005\210"
+	.ascii	"\220\265\266\305\333\033E{\254i;7\330u\233ta\\\342h\271]\242"
+	.ascii	"Q\204\016\327\f.0P\267\307\333\036&:x\232\023kI\232\260\255\345"
+	.ascii	"q\273\303\350\205l-\312\356\260\362\241d\"\345|\006]8\234\234"
+	.ascii	"\332Z\035O\323Wi\226\330\332\332\034\327\262c,\343\346\2025\036"
+	.ascii	"mJ\214R[\313\202\305\301\311\233\331\247\357\310`|\231A9?\002"
+	.ascii	"\276\231ik\334\332 \343\341C\212\211\023\2254\250\252$\347{\206"
+	.ascii	"\234\207q\030\226\006w\265"
+	.string	"\031E\234S\250DA1\335\322\350Z\n\203B\250\242\321@\210\262\212\031S$#2\222&\205\306\022\n\020\204\203a$\007*>\022`\024A\r2\006\225\241\021\221@DR\220\224\324\250\fc\211c(z\315nO\210u=\316m\321`$\370K\302\265\\ll:M0m.9\320:\272\234U;)\206\2569\360\031di\036\020\215\201\324\305\242T`V\t\205\320)\231)&t9\f\277O\334\025\017\207\274\232\fv\363A\fC\3471\3704o[\303"
+	.ascii	"\253~\r\351\206\313\023\327<4\204\230\346\254-PZ\210\364j\033"
+	.ascii	"\212>\363\002I\027fO\346\217\227\3638\273\376J\267{\224\032\031"
+	.ascii	"JN\203\020e\261\221\024\37129q\3304cZ\226\352\356%\260\244#;"
+	.ascii	"(\212&\206\n\256\030y\017\330r\332\217\363\261\271\226\353d\330"
+	.ascii	"!\222{X\210y;\351hd\f\355\317\016\247@\375f\204\250\317\032\341"
+	.ascii	"\224W\237=\347\202\361.\232+\b\377\264\017\375\376\251\301\324"
+	.ascii	"\350\217\016Js\006UZ;{\202\2443O\0217Z\227,\315e^\271\205\320"
+	.ascii	"b\331b\273\237\254\246\332\373\344\321Q;p\361\232\265Z\304q\023"
+	.ascii	"\\\177?\261\243G\177\264FT\224^\320\362\200ud\004\307\274\313"
+	.ascii	"\230ng\323\263\026m*\363\264\216\030\220"
+	.string	"(:\305\243\352\037\201\325\267Dr\210$\252^\np\266\342\350\306\224\337QAG7\364\034x\023\272r\326\323\311\f\301Q]\256\024\324qW\310\360\360Q\300\315\247\342\035\021\207t\246\340\204\315\351\244\322\002\327\211\233\300\337\004U{j\376\353\34052\003R\350\372\236zP\\\216\242\352\361\254\354c\266\237\352|\245\372\035\265\321R<\321$`\272\221\322_t\366\177\227\317\251\360zK\202\016_N\353>\371\211!\264\315\357mC\374sw\364\001\307\337hz\321\305\2157ikb^\034f\257X\333@XA\035\2441}\003\n\020Z5\231\3108\275n`A\226\335\217\007\204#\004B\r\310\357\214/7\036\265\204\233\004\233A\260\347\306\350\366'J0\215@\345\024\206\204\253\367\243\352Q\217\213\034@T\366v\025|\202Xo_\004\033\005[\351t\232\371~\231\001\251\221\364,\003$T\326j\033\244Czd\366T"
+	.string	"\331p]q\243S\206\256c\244>\016"
+	.ascii	"\345\365\005\003\245\274\034\314x\323\017*\206\005\330Q\025O"
+	.ascii	"\032X\016-\t/\360e\236\024T\265\214n\360\301\350\001\3602\310"
+	.ascii	"\363\r\375=\307,\3421q\371\230\305\0022(\220{\261\204^\020\030"
+	.ascii	"\265_^\"pZ\240e\206\213\364\2715z\301\326\273\313\r\3317E\237"
+	.ascii	"\273\2220\227\261\260\203"
+	.string	"\214i\240\370d7\tA\264\237\256DP\322d+f\360\267\265\343\215\"\204\256\227\204G\207n\212\342\220k\263\353\375nc&i\231\030\304\303\326D\037\254\367kwu e\273\322\343A@mL\302\335Y/<N\230\200`l\206xD\226\037Y\004\"z\331\261\343\273Bo\035l\313\333\212\340\323\237S6\264\372\226\234+\027\301\344#?\305Y\216\267&\\v\336Lx\021(\356O\367!\220\331\177;\211G3\232E\334\210jv\0228\177\300\312;dd\361\002\023Z\201\253\020^\3503`\025\301\034,\0211m{\346\ni\241\226\223\023ZLe\200G\233K\027\017gS\016\360<\214GG\316\351\371\25323\206\361\366\343\374}\353\317\211\007\3704\037\rd\372\360\037\226Y\222`\257I7\n\362W\240-\276\347\255\020iIP\211\350r~\356\331i\030\201\312`u\002*\302\342\263\233p\371&\0274\\\203b"
+	.string	"\367$\231\031\346\205=\301\321si\265qY\001\323\241\234\b\021w\0245\315\343\002\264a|c\221\303\213_\\\223\rh\247]ZT\234&\23604\246 ?!;\002\217\306~\246B\002\024\241W\004\253\343\034\256\t+\304\264\263\024\377(\321\234\233\001d\350\340_\270\034\362\201\374\022\364\260\222w>\256\261\rj\013P\340\364\236\244\336{iX\221\303S\342d}J\265{N\253-\t\201&\223\265\336+F\356\235Q\261'ZO1P\344\232DN\200\203\fu\221\201\210=\200 4\207c\263\362<%\267\315\265b\f\333"
+	.ascii	"C\205f(v#b\364\b\241\222v\354u\350T\031\2402\026\254\234\307"
+	.ascii	"a\311\250\210\033^|\274Y\363\233o><\325\343ft\213\271\302p%\300"
+	.ascii	"\330e\213>\020\363\021\036\023\025\031\\\254\342\002H\236\250"
+	.ascii	"36\2651\342\305\252\rbG\3250\253zo3Hh\006\025\221\016\331v\024"
+	.ascii	"\n|Y\206\325\034<\270\004\027\221\340\357=T&(\303\275$/X\t\024"
+	.ascii	"\nN\b|\242&\324+[\271\305\326W9=@\0027H\023\343kz+\032\343\004"
+	.ascii	"n\030f\325\276!mk\327\023\333\301\241\314\213#\360"
+	.string	"\201\261\305z\"\0048|\216\326B\361\231\0241\036\231\275\336\003E\226\t\314\241\340\001#0\007\247\306\334\305\355\206\213gd\247\252Ym\317I\325\264\236b\347\355&\2044\265\242\253\344\2347\n\352b{\216\204nx\217X\354\267\006F\354b\016\t\302\277\330\355\024\306N\310]\214\253\272\2309a!\264y\221&3\373{@\200{\256\327Y\210\216\270\024W\225sp\027\032Ki\235\r\021-\374tB'\341\324\363\222~\031=\021X\\\023\022\215\ts1K\357\345\233.\337]\242\006@_\b\257\343\r\362\026\036\334}\233Bm\240\207\336;\234E\005h\362\t1\301\324e#\261M'x\341\313\351Ss\024\355y\2721q\302RO\177n\352\336\360\223\301^\2333\360\377nx\217\233\337)\352\177Y@\204\2311\245\002B~\243\323&\241\334\204\3235\371\022'K'v\337\020\036\n\345\271\373\"\261[E\037v\367"
+	.string	"\216>\302\234\363M&f\334y\304\220#7\321k\334\247\350,\207\235>\256\006\261\344\313\211\342\017\025\306\376\020\373.\026\034\217\302_\036\216\332;Mq\324\366\273\220\323\322\330 \376\0059\365\232\327:\344q\r\365\2350\b\356\267-\362\336U/\271\177"
+	.ascii	"7\273R\266\317\311+~zpl\2728\323\375Y\2731\272\217_\032fi\356"
+	.ascii	"\332v\224\2341\330CyH\335\271\271A\354\244\371\021%\007m}@\320"
+	.ascii	"Y\347c\365\200\335\030\374\247W\300\276\356wq\210\2779{\340\017"
+	.ascii	"a?Rl\027\272ol\272\235H\337\004\330O\341\324\353\202\366\262"
+	.ascii	"\375L\3725{\321\265\317\211\377\f[r1\204\266&\307g\240\321\246"
+	.ascii	"\004\247\221\017\354v\210\265\377\220r\324)n\030\272\020\372"
+	.ascii	"\2706!\013\331k\005"
+	.text
+	.section	.gnu.lto_.symtab.ad4184cad5cb51c0,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ad4184cad5cb51c0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2573 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"\023"
+	.string	"\033"
+	.string	"\036"
+	.string	"6"
+	.text
+	.section	.gnu.lto_.icf.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`y\004]\027"
+	.string	"4\035m\005"
+	.string	"?"
+	.string	"\252\214\263\350\t\016\002"
+	.string	"\002\001\002\002\001\002\003\001\223\216\356\237\005\020\004\002\005\002\240\342\234\212\n\003\255\336\350\324\n\002\002\006\002\007\005\243\325\201\361\006\004\002\002\002\b\006\007\252\371\201\374\003\n\002\006\002\005\002\006\b\b\270\241\226\261\005,\002\t\002\n\002\013\f\002\006\002\006\002\004\002\r\016\003\002\f\004\002\f\002\004\f\002\f\t\n\r\302\307\26748\002\017\002\020\002\021\002\005\004\017\003\002\003\002"
+	.string	"\002\022"
+	.string	"\017\002\001\016\352\263\360\321\b\017\252\260\246\257\003\020\021\270\211\322\350\f\032"
+	.string	"\002\023\001\002\023\022\340\230\364\207\0066\023\363\334\307\260\0012\002\t\002\017\002\024\004\025\002\001\005\006\002\005\024\025\026\027\242\302\263\302\013\030\246\223\334\330\002\b\031\325\217\245\257\007\b\032\227\220\346\240\007\021\033\226\340\340\306\007(\026\005\006\001\002\027\002\002\b\034\327\307\233\363\f\004\002\002\002\035\036\361\324\373h\f\002\030\031\002\030\002\004\004\037 !\240\201\201\357\002"
+	.string	"\"\212\315\236\314\002"
+	.string	"#\274\242\314\243\r"
+	.string	"$\357\251\357\215\004"
+	.string	"%\221\314\367\372\n&\025\002\030\002\006\002\030\t\030\002\026\002\030&'()\202\335\331\235\013"
+	.string	"*\265\375\200\363\b+\226\246\374\205\004\030,\303\302\257\234\002\n\017-\202\262\344\311\007\004.\211\225\354\314\b\002/\202\306\351\2500\354\206\342\366\006\0021\335\203\252\337\004&"
+	.string	"\002\030\002"
+	.string	"\003\0232345\263\330\304\352\007\020"
+	.string	"\002\0326\334\327\364\233\017\0047\261\203\353\3708\347\273\234\355\f\002\002\004\002\0049\273\327\235\275\004\004:\350\300\306\254\005\002;<\253\255\272\247\005\002=\330\224\247\254\006"
+	.string	">\353\365\233\303\003?\370\374\272\212\b@A\240\342\234\212\n"
+	.ascii	"\200\216\250\2015Q\204\344F\222\244 Y\016@\002\304\020Uu\003"
+	.ascii	"\021 E\207\020\211H\222t<\3633\003\370\314\005\206`\220\222\030"
+	.ascii	"an\026\262\324\230\\\274\263C\022B\\\331OZ\210\353\300R_\034"
+	.ascii	"\n\205\267^%\244\020\321\206A<\275\317B\233r\332\362\302\236"
+	.ascii	"\332]\211l\310`\372\350\034Mq\367ok\247\337\310\205q\264v\303"
+	.ascii	"F\232j\234\274X`\313\247On\"\032\033m\036\027\361\030\353\\w"
+	.ascii	"6\246\005\203_\334\260\306i\3419\210\257\025\214\214\232[\f}"
+	.ascii	"\362\314\340\374#>R\177\362'\302\231\316>d\037(\220\353\271\235"
+	.ascii	"\331\304\255Q\0177\324\027\200\224\324\025\263\216\267\233\334"
+	.ascii	"\342Y^\335\351c\206\271\324\317\262\f\362\007\">\177\213\037"
+	.ascii	"j\371\365\366h\251\220\240\200\372\335B\313U\227g\247 \2021\232"
+	.ascii	".\241.@]\034B0\020\003\240\034b\235\263\f\200\340%\237\260Y{"
+	.ascii	".\0076\361l[\352\2300\237\020\357\001\314\334@\005\217\324=\255"
+	.ascii	"\354\277\334\3433\270\0031"
+	.text
+	.section	.gnu.lto_.ipa_sra.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\235\0015\b"
+	.ascii	"\002\n\035\"@\215\013\035\306\231\343\030\206a\030\006^\362["
+	.ascii	"\262\022\3627\275\212\030\242\237\341#\276\td\033ir\247\024\226"
+	.ascii	"\276\273bR\314\211)Q\357\210\t\361\340P\r\fsAa&L\204=\230\006"
+	.ascii	"c4\321MY<J\252/ \230\0023`\002,31\227i\371M\332\025-\312\023"
+	.ascii	"\265.\311{d\310\276\243\264\231VP\375S\357\254\316\201\2641\375"
+	.ascii	"\3571\362\275\003\326EJ\250\241=U\2654Y\346`\002Bg\326\001\022"
+	.ascii	"`F=\246\265JSa\355\372w\025\255}x\233\232Q\223\263\223\275z\245"
+	.ascii	"\005B39\200\021M\352\004\222\n_\350B\370\037xg\034&\202\317b"
+	.ascii	"\207T-jJ3/\353\241\372>\321\305\360}E@L\211\024\017A\313Cq\241"
+	.ascii	"\3605g\365\377\364\214\025\223\350\304\330\215\232\034\211$\006"
+	.ascii	"#\205\256\005\252\3779\037%\301-\007\371Qh9-1\322\253%Dt\262"
+	.ascii	"\354\361r\245\2329\033\006\230\260\f\366"
+	.text
+	.section	.gnu.lto_.inline.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`>\f\005,"
+	.string	"\026<\307I\240\330M:\220b\b\241\312\027\314\317(\r\037\311\227\217 \341mb\346\361\210\252\276\023\314\303- ?\377\374\205\247\361\2061\241f\326\310\235W\030O\030)x\210#\324O\326\372:(\325\244-L\341\2015p7i[J\231\002\244"
+	.string	"\264"
+	.string	"\273"
+	.string	"|C+E\322l\353\231\212A\301=\025OE\262\215\254h\322\242\235\376\234\222m#j\351\210\354L\177\316\024\307Y_\256\320\330\217\327\261\354<\336\304\217\303e#Q};\2656.\372\211\312\376~\bm\354;}\363\330\353I,l\300w\313\343:\374\317\201~\316@=\317\215\317\215\347\240"
+	.string	"'\177\363\342I\243\331Y<\343~{\332u\363\364\272.k\255\2633\235'\273\317\363\234\343Zk\335\363Y\307T\265V\372\343\232\253\326\037\213\377\236(\3307\300U\322\340\303\262_\200\367\341\233\327ej\255\006\376\005\267\251\020\237\343'\216?\236\344\036Y\274@M^\033!\0351\351\374C-\265\364\202K\211\360\377\310\273+dG.\332\023C\302\221};\337D\374\305\t\224\243\177\335&G\266\377\r\270\353\2561aJ\233_\210\305\\MQ}\340\375\022\361\026\240\221\254\0134\372\357L\223/N\370\035\375\341\364eU\343}\017\261\022\253\253'\343g<\377\337\200\262\3778!=\311N\252\202<\315\036\343\270\322:\2525\357\017\360n\277{\355E+\305\213\235\313~\003\322\3725\374_\307LZX\250\b\371\337\036?\315"
+	.ascii	"&\251y\317\317 \236\022\243\252\f\353\251\210\013\317@@-\026"
+	.ascii	"\226\025\306\017ccccs\376\302\237\327A\331yx\367\201\203\345"
+	.ascii	"\341\242\365\020\036`\037\207o!N\252\265\356|\300$y\371\335c"
+	.ascii	"\036\265\326\232\327\350<\311JX\222\266\346\351\370\361L\203"
+	.ascii	"z\212\020/\254==%\271\013\n\214LxQd)\027b\262t\376\036+U\001"
+	.ascii	"\003\025\202v\355#\340\275\341]\252\275\231e\177\311\360\206"
+	.ascii	"}\227\031\031\225V\337\272N\227\244\026H4\\\276\216\312l%\301"
+	.ascii	"LV\232\3448X\r\300\276\367L{\216\354\034VW[\374y\"\2335%\243"
+	.ascii	"\306\314?\304PcE\202\370\314f\375&j\030[xt\311P\313\251\341\337"
+	.ascii	"\200{\003\216\340\026,\\\314\330\\;\331@\242\303&\377\r\3703"
+	.ascii	"/W\007\335\256+\207\r\032x\335\275\246\271O\206f\fs\366\224\373"
+	.ascii	"=\001$L\300\276s\324\022\026\355\027\240\3200Y\321D\305\306R"
+	.ascii	"\2568\201\325n\201\2058\254\326\n\202\377\026\252\rN\241'\324"
+	.ascii	"\240\204\b\377wL\333\375f\016\341?\nz\361GyI\255?\032\033\277"
+	.ascii	"\233j\375\211\177\300w\360?\247\366wv\\\033\360:\310\240\327"
+	.ascii	"HJ:\236\210\020j\032Q\220\272|\256\240'\001\317\377&\320;\242"
+	.ascii	"\226\260\004(\340\262\375\017\326Zie\255u\346\005\3049}\304\250"
+	.ascii	"\222\022\247\304\302\262nNKI\274n\365\035\232\275\001y\342\016"
+	.ascii	"q\230Z\353x\002T\234?\2379Z\201\026\250\001A\245\f\r\211\210"
+	.ascii	"\210$I\222\016\221\004D)\306$\207=\022`t=\n[C\244\206dF\312I"
+	.ascii	"A\271\2469\320\f\001FSJF7\312\031\317\266\321K\314\\\365r\"D"
+	.ascii	"\351\361\255iy\206bK\305b\262!\032\345C\f\030>\034\310\344\353"
+	.ascii	"\354L{\303\366\330\357\337\264\03323\204\353\225\246\324\026"
+	.ascii	"\327>\035\242}*\351\034\305]\376\344\t\351p\231@\370\351\273"
+	.ascii	"7\312\bv\320?\325\206m>_\035k\360\205\b\013N\264Y\321XwlAu\204"
+	.ascii	"\346Jx\235\321\346\221\266\2409n\267\344@-()\b\204\324\202V\316"
+	.ascii	"\376\021\003\370PQP*r\346\322]&Q5\201\225\201X\273\251s@N\021"
+	.ascii	"H\b\224\223K\370\216\f\252\375\264\316)\250y\332\352\022I\031"
+	.ascii	"4\030\266\375\f\317h6<\316\017\271\316Pl.\252\rDK\"\206\202V"
+	.ascii	"\b\326\374@,\\\307n'tS*\361\322T\r=\252\032\004$\020Q\341'\201"
+	.ascii	"\316`\3015\333\262\003+iC2\243\371\205\273g.\007\331\026\364"
+	.ascii	"u\300\006*z\025\031O\350\260\263x|\277\344\332\303\177\242N\210"
+	.ascii	"\364\n;\372o\022\376\002)\334\237\200\210v\270p\360\262cw\335"
+	.ascii	"\342\331\201\177\177\352F\325\336\007\350\332\354\246\303b\220"
+	.ascii	"\3014B\r\245K\365\006V\264\236\f\305\267\b\343O^\031\023Z\232"
+	.ascii	"Y\"W\306_\305<\033f\030\017\321\307R\262n\377\353\2263I\265\t"
+	.ascii	"\245\272\275\021\026\214(\267\331\306\355\020\370J\265\220\020"
+	.ascii	"\326}\354\n\266\007\255\247l\323\346%\b\367\200\201\177ofQ\230"
+	.ascii	"\013\007ex\267\0200\370\253\032'\274p\304\202\353\203\246:\322"
+	.ascii	"H\327\335\253\006-b\371\fY\342\367\312\323\304Y\027\221\203\243"
+	.ascii	"\021\226\214bM\027\002\260\215\331@g\273h7\363\262\033d\202\210"
+	.ascii	"\0035$:\213\246\314\037g\237\304Z$Y\257\316`D\366\013xo6\370"
+	.ascii	"5\322\324\036n\206\001*\313\241\005?I\b\300;\355/\034\223\\\031"
+	.ascii	"%I`\022\225\334\215c\2551\272\r\026\311~\254X\255\377[@\020m"
+	.ascii	"\224\365CW\013U\327\023S\tc\360\234\001\262\347\277g\236\325"
+	.ascii	"Q\bd\304\215x\327dhk\345\303\206]I\360d\326\r\277\025\034\021"
+	.ascii	"\na\n\356\022\004\330\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\037\t\205\026"
+	.string	"v\032T=0o\223\016\300\300@\r\222%i\277T\001zPN\016\241\367)\245\330A\030\270Q\204\350\201\251.\fH\021>\354\264\352\377\223\017\275\341\267L\r\264WZ\364\350\036\0322\333\266\225;\245\024;"
+	.string	"E"
+	.string	"F"
+	.ascii	"\266\t_\270\036\372\331\354J\333\217 \226p\357%\313\262\314i"
+	.ascii	"\216\2639\356n3<\017\312<3\026l7J\233G\254M|k\304\\;M\334\017"
+	.ascii	"\335\267\233\245\247\237\027\373UP(\n\255`\017k|\"Z\237'E\255"
+	.ascii	"\006\032\205o\271\362\335\314\301\236\353t2\262Q\344\034\341"
+	.ascii	"\376bx\002`\227\317#Y\360v\022\356\2370\332E\265\211\035\224"
+	.ascii	"\236\320\353S\234\360\333\302+\256VC\303u\225t\034\362I\225O"
+	.ascii	"\362\361\346\022\204\263e\203\365:C8\003\360x\334\257\3360P\t"
+	.ascii	"Z\004m\307dM{`\312g8Gk\340\030\325\332}\257.p\025\256\013W\271"
+	.ascii	"\215\266,sf\236\032\002\255I\311\311\007=\202\365\200v\211\364"
+	.ascii	"\001\2553c8\230Ev\350\246"
+	.string	"M\017)\"?tcJ\303\3519U\240\320NhE4\022\332\bm!4\314AC\236\r\275\351\306\003\224\032\264! O\351\265\330\007i?Z\213\303\243\255\004\274\315\246*\006\030\214\373\302\005\200\250\250a\31126\243\005I*\031\016`\002\221BF\266\r\022\240AQ\f\304A\fs\306\030\206\314\220\320T\2302\n*\205e\r\205\305\230\226\235h\235\221\265\224uV\362w\215\364\302>\215'A\264\353\226H4\024J\350\364V\272:\334\375\037e\355\372\033\036D\247\266\212d\343\025\375\371\372\261\273j\244\034\374\241K\351\300\225\017\037\200\227R\027\232\256;\372\017\250\023\252\020tEj99\013|\214<Y\331rc\203\314\354d3@\270\332\216G\261\324Y\n\273i%\337\005`pj8\210\270\276|#\273\260\217!)\024^~\221\222\216\334\005\317\205y\372\032\277\311\006\362\222F\342\217\331A\200Mr\3770\245"
+	.ascii	"\013\241\0334\256\n\264yUR\322\026S\020\f\203\242j\304\251tC"
+	.ascii	"P?\024\232\205m^YJXp\004hl\317x\r#\271\352\204\266\230\017Jl"
+	.ascii	"\257%\335\376*l\371~Ld-\303\203N7\035,\237\337\3723;\220\002"
+	.ascii	"\341aZB\364\3569<\230\365?\342qot\332\263\302\366\254Bp\027|"
+	.ascii	"+'M'&\002\2303C\214\351%\024\320M\332q-(>v^\t\333\n\210\027\311"
+	.ascii	"\240G[Xd\210\330\252\207\2764X\343n\311\215\361'[\034\333\213"
+	.ascii	"\201g\256K\306A\363\310p\262\327\341\340g0\372u\247VS\002O\314"
+	.ascii	"\354g\224p(qJ\023\314\177\332o)qA\036"
+	.text
+	.section	.gnu.lto_.pureconst.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 z\r\003"
+	.string	"\242G\027\034PW\206\0030\323\344\b63333\256\2526\346n;\322\337\225\247\013\314\006\310\016\263\364Ho\364D/\364@\3633=\26739o35/\3630\363\362,\237*\2232%W\221+\310\325\343\3121\033\223q\027S1\023\023q\017\327p\013\227p\007W0\003\023p\251\273&k-S"
+	.text
+	.section	.gnu.lto_.ipa_modref.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\237\003M\017"
+	.string	"\226\02293p5\312p\034z\255\331\322\364\177\253T\247\177]\257e\340\365\377\377\377\367\264j\373\337\376"
+	.string	"l#\272q6\306\373\304\250\361;\340s\340\203\330M\020!R\246("
+	.string	"+"
+	.string	"0"
+	.ascii	"\317\350\361Rn\351cl=*\301g^5\272\265|\255C\256:\304#\375\261"
+	.ascii	"\005\23236\271y\247\332[i\240C,\021\b\267>~R\345\034\306\036"
+	.ascii	"\237\315\364\036kHO\007.\302ts\034\274J\247\246<#\351\214TZS"
+	.ascii	"\\\353\2644Z\274\244\034S\032\034\001JG\211#\312\207\327\260"
+	.ascii	"\225\325\003h\237b\214\001\232t\255\306\200\271c1\024\314X\243"
+	.ascii	"\200\007\201tk\264\333\325u th`X8\306[P8_\017;\234\337|\253\243"
+	.ascii	"\3463\230/\317\017\233\265<\251\312\267\305\202\266\"\201\242"
+	.ascii	"\224\237\233R\300\254JN\0362\001)\017\200\203\250QI\306\350\304"
+	.ascii	"P\030\366\f`\002\0312\243\033\021@-T\222\221\264\220\366\357"
+	.ascii	"\275\204,\344\006\377\272T\037N\304\001\366\251\211\253\031\203"
+	.ascii	"yFH\270'V\342\276\001U\230\345$\271V\f\"\3046\306P\276\274\223"
+	.ascii	"\372\006\211\027eL\244\025\256\265I\031\334\"\013\tF\337?\253"
+	.ascii	"\343'\262\034\024\307\307\013-\244\335\204J\215\212S\356\257"
+	.ascii	"\004\362\321&\306\346\t\365\204\342\tF\n\006\245\255.\273y5\033"
+	.ascii	"+\202\2726\007IP\324\244~\261`gH\221\025\201\250\033\bB\227."
+	.ascii	"\230\027V\020\234\253\033E\224\245\241=\204\304\"\246ji.\233"
+	.ascii	"\001N6`$\335J\213\035\316.D\n\321<c\031\377\351Q\23091u\020\327"
+	.ascii	"a0^\335\204\247MHm\343,\376\341r\0200l\247\320\355\227\270@}"
+	.ascii	"\260\254^N\327\303\245\211#4\020\327\365\373\032F&\025\007m>"
+	.ascii	"f\022(\225\204\332\237-\362\274\344\337\035\220\001"
+	.text
+	.section	.gnu.lto_.lto.d2494d2c117f74cb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.152.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\204\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\317\343\021\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\325\006us\356\005uq"
+	.string	"\005\001\006'\0012\212\3400om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\005"
+	.string	"Z\tN\271\036f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gyroConfig.154.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \325M\005"
+	.string	"\322\210!,`W\032\0030\f\003\3330\242=(\022B\f\022\202\020\200\2658\323\215dDC2\242\021\031\311\210\004Z\250\b\332M\241:\250\331\264\003sX8N\027S\306\264\361:\026\037\217\22072)96YFY\254<\263L^^\314\233\231\246\271\266\271r\256\235\253\347\372\271\202\266\205^\321;zIo\3515]\236\276\241\336T( U\254\225\002\021\370\303\201"
+	.string	"BkCM<p\345\376\274\273\302\3530\350\335\315\347\234e\016"
+	.string	"V\311\300\f\227\222l\323\ffc@\262g0p\222\322\356M\201*\203\331\234\235r\313"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_gyroSensorBus.155.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525Po\322\001 ;\225\225\212[\244%>\257\304\272\261\ta\252\271\352\007\263m\250\365n\2046\204\333\025[\234\231t\215$\250\256\303\335\261\221S\230\217\310&{\247\024\276\254(7\017p\31285\230\t5\020\016\031x\311\t\255\002\307\b\214\204\0231JH\325\275IF \333\375\234\332\361%\022\b\236'\2410\310vw\341\317\037y\255\360;\376\274\341\264\323?\2373\375\035|\234\205]=\315m\330\227\326i\330\255\022\2614\214v3^\\v\345\251x\330\356\330\224\037rQ\307\030A\315B\024\006\312\305I\313n\205\256\037\230\376\002^M\177\216\343\330\033\346_\344\022H\312\210\202<o"
+	.string	"\f\273\353FA\241\333\335v\202m\005\333\037\001\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroSensorBusByDevice.156.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\215\b"
+	.string	"V\320<8@s\322\0010X\\r\376B4lF\361\233\"\003\206\013\235L\227\002\371\312\255\265\372\365\263m\314\366]\317BXx^\203[\025<\bl\213\356\023\300\324\016\332m\357\224\002*"
+	.string	"."
+	.string	"-"
+	.string	".\233\335\032]/\200\035z\376\301\016\237\310Qw(\377)\357\224\270\304l\253\324\035\300\303\356\332m+\326\375n\033\3016\203\355W0\273\03698+\003_Hl\237\354\314\366s\366B\303\351(\032~\273\0375\257\335\252\340\004\317\241m\337\344''\243\006j\213\225u\320p\0046\305[H\007\226g\261(h\355\256\203\312W\250?rh\f\223\373v\350\233\260C\003\325\333\260k\312\275\020\373\235} \266\373\334\314@\004S\322R(B\244\215D\246\314\032H\316\214\211H\247\244\245\020\215\245\221\004)j\223F\020\201eEh\306\013)g\314\352\3365\nh\355\252\276\005\n"
+	.ascii	"2\003\302\360\030a\315!\254\230\344\267\031\234k\370\202ECu\b"
+	.ascii	"c\272&\031"
+	.text
+	.section	.gnu.lto_gyroMpuConfiguration.157.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"5\007"
+	.string	"\022\31624`o\032\003\024\002\203\2137\362\t\212\220 5\260\352p"
+	.string	"yd\206\365!du\202\037vB#'\203 B\030\216\214\002\336\243v\031\301\316\206&+\233\224)\005\365t\242\024=@KF+\364\261`\b\302\001\004=\322\202\235\202\306\210\217\204\0231J\270\2317\n\210\223\375&cm\364\211\004B-\233P\030d\377\027\374\352\022\317\212\272\303\257\242Q3\346W\217*\277\003\223\263hg\251\271\215\326\231\377\257\323h\333"
+	.string	"HKC\352\317\210\2019\313S\361hKj7\265\210GH\275\bf\206\342\270`\\\244\274\374\023vZ\240\362\003p@\345\3478|\271]\265I\234\tYIa\247\222\233\206\341\177\033vB\271\316m\023\332*\264\375\b\t"
+	.ascii	"2\003\302\360\030a\315!,\307$e\256!Z\210L\334\025S;\311"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.158.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525Po\322\001\240\372\215\006\372,\032:\243\246M\005\300\2222Q\305U[\016kQ\353\335\bm\b\267+\2668D\314\244\307p]\207\273\343\005\333\\FK6\331;\245\276\254(=\021p\3128;\233\t;\022\020\034x\311\t\255\003\307\211\215\204\0251JX\325\275\n' \333\025\235\332\361)\024\n\236G\261@\310v\267\341\317?y\275\360A\376\354\371\264\323?\377C\375%\210\034\206]C\315u\330\237\326q\330\255"
+	.string	"\346\345\241\264\2531#\263.\217%\3046\310\256|\222\227\200\214\031\324\214$\360\261\221\261\022\263[\241\353\t\250?\200\017P\177\316\343\330\033\346\337\344\323HK\211\216Bo\032\207\335u\243#\322\355n{\3016\203m\221\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroDetect.159.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\n\001\205\r"
+	.string	"F\232^D"
+	.string	"\223\223\016\330H\226\224O\"\244i\311v7~f6\027^\2061\341\2431 T>f\026\321\235\326\276E\372\201uo\240s\013~\244\240\264\377?\031\013l\250\020k\003v^I\222H/O\202\366\336r\247\024K"
+	.string	"H"
+	.string	"K"
+	.ascii	"?\205\274\301i\352:'Xp\200\201\263;\257\004/ \037\341\t\310G"
+	.ascii	"5\361\355P\337\346?\365\b#\0177\270Nt8\342\n\033\320\344\234"
+	.ascii	"<\035\t"
+	.string	"\nP\241\341\305S\1770\335\350=\020\b\273\353\307u!\356x\333\023l?\260\357\022%\373\250\333\372\374\241>\037\200\024Q\203\303\203\202\315\356\207\325\217U\305\032(\216\372\355\220\237r\307Gm\226\b\204E3\343\264cw.x\364\210\365\236}\231\273\b}\272|\300n\311F\315\356\034\261\002\353\321\323\262\355\267\b\357\234?s\223\"\344\b\244m\006\227Q\341\200iw\035\3701>\223\342\307<:[\211\376\212|\024\031uXq=^\336\312:L1$\264E^\265T\016\322\313\261|Pm\f,\357\334\325c\343CER\221=EOK\330\207\253\001\230\366a1\321>\022\002d\300L\324%$\231\326rr\201\264\f\244\202\201.\025\224O\312U\242\201.\022\003\316,`\332u!\313\264\2533\367p\265\344\343X\321\320\220oRdC'\363\374MZ\nc\333\322\253nV\250^t\004=\357\307\244}\202\022\023"
+	.string	"|E\351X\274\006n \020[\241\213\026V\203d^\005"
+	.ascii	"\007Vm\255g\032qa\024\333L'\315nN(\346S\347\240]@J\240U7M)\024"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_gyroInitSensor.160.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\220\b]+"
+	.string	"ZI\f\020C`\250Q\007\227\t\"\023"
+	.string	"\231\006\354\272"
+	.string	"\255\201t\313\216\240\363Z\016e\302\200\177]\362ii\233V2D\001<\202\211\307%2\274\302F.\260\204\203\315\373\352\304w;s\370\305\350\033I\267\335{\247\224R\352"
+	.string	"\337"
+	.string	"\364"
+	.ascii	"+;\253\251s\252:?;{\352\334\020\006\3301\232}\341\332\3723\347"
+	.ascii	"\375\021m\273d*\232)\355\245\233\031\212\373\311;ngw\201j/7\202"
+	.ascii	"G\347M\366\214;\3140\037\264\312\026\330V\203\251;s3\333\013"
+	.ascii	"\252\2338\272\350\336,7f\356uF\340\006l\253\354\354\337\332*"
+	.ascii	"\333Fk\253\314\314\025.@q{\024E\3743\201+\311\324\027\241{\235"
+	.ascii	"\302o\322m\363v\272\034\213[\325\364\275\345&6o5\253\032\303"
+	.ascii	"\\\273\nR\325\273#N\335S\345\024,\311\230]WA\2164\273T\256\277"
+	.ascii	"'k\240\364\025\020\252\307\031\351\265"
+	.string	"\227\234\332%\245\\\355g\247U\224\320\347Y\230$\221N\323\340\275W\227\214J\203G\377\324\201\025\234!\275\2441\375\225a\361\351g'\250\002\244\312\035\207t\357eG&\2034\01753\23313\0223\273\024\314\320\243>\312{\211m\305\314\fu\344m\320*\360\035ly\327\320\242\374\315\317\250\225!\371\327\342\033+\360\237\370\025\350\231\347\350l\f|\346\020\235F\t\215\257\253\224q\326\224\002\374\237y\004\to$\360\203\307'2\267X\215\005\3102\032\376\333J\031\307x\026\246\210?s\211\036\323\032\330b>\321bP\260\367^\fa<\244\360\341\211\202\303\r\t\250\330\007\326~\377\236Rc\344\245\016cb\357=b\340\376j\260&\356(\255r\013\027\336\310V\271]\254\255\366\367\263#\234\371\312\262\362j\026=\312\3544\372k1\367G\243\321B\374Y\314\355\245\031\330\315\356\002\354\374\3239\007\3009\033\255\316"
+	.ascii	"R\347\242\2343Q\352\354c\235{\251\363P\352\314\3039\357Vg]\352"
+	.ascii	"\234[\235\331\324\031\267:\007R\376\206#\322r\251\266\t\320\243"
+	.ascii	"~\276'\372\002X?\304\326\327\342;\355{"
+	.string	"\025O=Ggs\342F/\372\336\204\262\255\253\351\240\367\274Sr|\242\024\277\355\224h\357\217\004-\207\270\332\255M\265\323Zi\266\265\241\3574\245\332\032\357J\017J\022\224\252!\001\245\005\342}\217)\325\272\232\273gn\261\364\237\266\213\207\247\3754Z\273\245\365j\271x#[.k\253O\006\t\b\201\257\317\276\3567p\360F\356>8\365D\316\275\256C\363\331\223\373\026\313\203{\366\255\370\241\363\340\301}\2479i\252\277~O\2751\255\351\253\377q\354\324I?\315\237\260,+\257f\033\365\265\222Vf\020]\226\004\334\272\367\222\365\263U-Jh\226\264\242G\271\3274#\021\335\255\267\330\320\312\244r\306|\334p\030zt\246\034j\245u\254\335\364\033\206\036\325\031\303\355Zim\265\331pM\303%\033+\206K\036x\"t\314$\301ix\243\205\360i\350\364$\243\351I(\303\305R\f!\323\360I(\201"
+	.string	";\315h\032\ni89\r\205;g\261?\213aX\001\023&\266\353n\327~6\333\306\345\025&\346\334\355\372\373\035\314\374{F*\2761\345ep"
+	.string	"o\364\001\204\264D\202R\316\344\205\267F\\\253]B\b\360\215,\342Xm\027\353WF\237+z"
+	.string	"\037\341\210+Ib\331\242_\t-\347t5)x\201$\355\022o$;\030\026*kh\307'b\355\220T\265\231j\007\273\242\243\323T\3135=\332\301\254\220\255\241\345\272\305\362\"I@'\362\223\263$C(MG\263"
+	.ascii	"BFt7F;\243V\306\na\350\200/%Q+\255\354I\206\366\030"
+	.string	"\246UU\257\225V\037\r\307\177\344\226H\337\341<\030\312v+)\235\314,\236\203\231\241lG=\025\0323\313U\302\300,J\026\200\260\250q4\306\224R\250fD\024$I*\351\220\002\221!\033\362\021\0209\207\230\251\021\242$\323\032~<\023\206]\002@\030\261;\f\246~.\034_\235+\"\020E1\331\370\006qEs~\310\007x\370\344\305C\001x\362\201\224\265U\204QT:\255\226\337\351\234\207ma\bIdB%7HQ\2319\233\271\276\372F\322h\346V\272\220Kz%\331z\342w\206\304N\333\315\275Jj\313D|C'S\364-\035\254\177\333}\246S\371\3334\304{\301u0a\274\004~\345s\262>\205\223\372\270\\FY\202\234\321\352\240d\324\2224o\212H\320\013\013t\021\032d\036\241\240U\013d*j`\356\257\003\266\276\303\036u\263\272\001\207>\351\306\203'G .\263\357\002Yx"
+	.string	"\271  \032\025\315p7-Ah0\362\327\247\017\340\317\235\324\005([|\220\t\357\223\265\334\233z@\330{H\241m\217[\3212\033\207\204j\320\232\264\356Mz\3451\017\277\366\350\333X[\203\311\013\004R*p>[\360}\261\342\304{\252\226|O\323\335\303w?\021\006\267\201^\240D\360I\023\331\025\370\021\3765\246q]C\031\325\021\246G\254,$\231\020\fJ\315\257\330\352e(\361\264\300c\366Nz\007\001Y"
+	.ascii	"@\246S\030\361\007"
+	.text
+	.section	.gnu.lto_gyroInit.161.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`<\007\235&"
+	.string	"\nAP\016F\200\234Q:\237#E\343H\n0\264WXW\024\224\004\033?j\257_:\231\2156\025\331\225\001\021I\023\321\332\360;\267\252\267\030\347\370\375Dc\335\b\204\r\032F\302f\024\236\204\366\020\316\356\021\355\377F\b\2212\311\320"
+	.string	"\307"
+	.string	"\325"
+	.ascii	"\313[2o3/3\357\025 hs\345\205\245*L"
+	.string	"\177\025\253S\222O\3552\315<\271\360\337%\356\336\276kc?\334\333\205(\321\256X\235N\340\020.\302\b7\367\001\355\346V\260`c\321\027\245\234\006T\201i\312\222\247\326\"\256\221\034}\020\320\317\315V\243\315N\263lF\367S\200\264Q\372\362\322\333=\350w\240\022\302\217k\307\t\254\001\206\375\224\020\304\312\3349\233\247 %\001''\351\251\236\204\360\r\b\333~p\215\370\005l\236~%\321\002\252\247(\246-0\002\345\373\354TO>>\203zM\267\036\023\233\375\213\223\366x\274\374\360%U\024\331\325\227\227\036\217\267RITk\265\365\226\230g\032j\255\313i\017\352\013\340\273\037\332]\t\273g\234\373\255s\241)\214\214\316\233\017\022\205'\017\231y\2443\013E\324\235)d\\\356\340\353L\311\215F\305\315\353\267%\035\363r$)];.\343Z\353\256\027+k\200\231=\016\035}\002\310\354qHN\026"
+	.ascii	"1\276\363\n\316/{0{\034\232\223\325Wp\336\334"
+	.string	"\202R\353\356\273\354\356\221V\353\356\277=\376Dj\025\034(\225H}@\324\304}v\313\021\267-J\016\025\337{\217\345Y\220\366Lv\005\013\026\347M\266\223\216m\213_\311\321j]\272\260/\336\n\214=\223\233\233$\203\237\336\334\3138o\276kV\304\b\177C\"\217\223\273E%\356\340\356\313\332Gv/\374\n\225\274\267\346\2651o\215yi\314;[\336\223y\315}C\250\205rx\255\251\3435\365\204\225\320)\346\361\256\f\327\224\237\220\354\354d\227\245c\267>\373M}x\234<i\035,{\326G\264n.Z\3652\244c\031\371\024\035\214q\217\331\307\002\373\331\301M\363\262\373x\005g\211\365,\022E\243\030\225}\250\037aH_\003>\361x@\320\356,J\005\255\302O\205\032H\313VE\212-Y\235\273\350\360c\250\025\035\261\032\2353]?!\3319\234\273\033.\207C\202\335\016\017+\032 Uk\275"
+	.string	"\347q<|"
+	.string	"\001\342\274Y\233\302\342\363\023\222\2651\004\213\227\211\370\0337\3355\242\312\220D\036'\267"
+	.string	"\007\370n\235\021~\342\331\224\b\222\252\225\367t\337\3655#H\224(a\342\004?]\326bE\004)\306\324\273\335\243g1\216t\275*&\344t4\220pI\272\\\222\213\243$\234\213\025F-p*tI\270\t\0076\367\342H\207\213\221\313\351p\267\"\357e\355#B\375\341\257\203\tY\221b\274V\332\240\016\356\020\024\2103\376\202\240S\r\244\200\024%\220\372a"
+	.ascii	"H%\231\366\340qr)\360\255\330\207\002i\265\362z\260\017t\bZ\004"
+	.ascii	"\005\362S\024x\006Q$l<\016\273\226z\267\f\264\254\264\200:\270"
+	.ascii	"\001\216.9m`I\030\n]\3627\306^\321\325<\331\372o\300\210?\257"
+	.ascii	"\363Z\377\364\031\262\016\324\n\2031G\221\005#\216>\361\270)"
+	.ascii	"\256\260-v\220\326\255\344\nl\211\365pJ\353\f`>\036'\3715w\316"
+	.ascii	"zF\023nb\246Y\317\254p\t\177\303\255upy\026\341\035\026E\253"
+	.ascii	"i\314)\341"
+	.string	"\267\200\230\250A0\250\030c\346fDRP\220\024\322\001\220\002\221)\262n\021P\271Cd3\032\027v\003bdw\326,G\250\207\364XJ\3730\020\002\272\2574\220\313\0046\263K'\200\330\fO\0211E\2341k\007\237\273oh\204\263)*b\361d\036q\211h\320\304\306\201\271 \356\304\350\213\262\027\031rT\225\024\0031H\261\257\254(D\354\214z%\231\340V\305]\271\322\033\317C\360\247\336\373\231\022<\032\251\253\222\177\020\276\325\316\252\314/6\017\300W\240C8\033\f\274iu\257\240O\3219ff0y\235\377\257\013\331(\217\274OJA\240\201E\214\b\001\353\214\351\370\353\001\302\315\377g\336Y\016P\216\315\367[\244g\345\216\310\034\200Ng\360\340\016\234\210\bc]\261I\333\022k\302\231\243t\357\233\231\356\370i\237\270\243\3476:\217\317\203M\265a\244\362\020\252IQ\003'\"\240\221\330\301"
+	.string	">\310\266Hr\204|\254\216\375\204g\250\210\372:OSUheR\031\215\225<"
+	.ascii	"\337\2325\005\266\242\367\275\270\341\n\273\367\277\321\343\254"
+	.ascii	"y\342\3144\366\272m\002\257D\002\373n|T"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.162.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\217\003\335\031"
+	.string	"\326\357\245I\300\226M:\027\f\222\306\206 *\270`?\377\367\312\220\371(\265.\250(\213\366Z\346TIN\321\223\243\261\033\265\315an\260\3365\031q\037\341\030\034C\367#t\206\310\344vC\357\376\326\2005\321\3054$\215l\"e\222\001\214"
+	.string	"\211"
+	.string	"\222"
+	.string	"8&\210\2373\273\345\211\324\216\244P\n\323\255\303\352\251\273m4\202\370I\003~U/\344G\265\367V<@7Q\324Swi\2435\342\247\226/\020~\212\037\020~jM\025\313K\243F\300c\322)m\351\356\027\357x\355\254p\202\2745=8\344;2\222\266\263\304\032\017Y7\027\206zZF\262\306g\256E\266\b\013\360\200\352\241c0\206\304-\273H\035H\323\335o\372\276 o\273\254\233\356\326\035\311\031W\361\252:\252\352\bU\266\021j\202g?\362\204\237\347w\271Q\205K/h\177\252\245m\271H\365\374\373\375~\312D\252\357\375\256#\375"
+	.string	"\356\273\312\334\310\337\372\322\025\346LWQ\\\r\303\325\271\253 k\225wu\303\325\013p\351\200A^\bUw\214\337\227\236\232K~\334\367/\375Lg\325\037\311\223\274Ic\230\200\356b\307s\252\352.3,\245"
+	.string	"\333\367\035\317\311\256\202/\305{F\357\024\"^\224\252\356v\360\251\024T\267\310\225j7B\333\231\306\335\002T\273\026z\242\017\024\213\330m{\216\0135\317\312\256\273k\336D\237C4j\031]v\315'"
+	.ascii	"\276\217j\310\024n\257\264\273\033"
+	.string	"\344\"\025y2\213\244\250\026Of\245\237O\013[\3146)^\222\256\340\266\213\316,\f\203\254\212\223\263\037e\230\246\005\333\264\305 \273nGR\272\253 \247\347nP\tu+\205\337\017\n\256;\210\0013\foS\016\310\215\371@\322\321\221\\\325y\001\222\320uB\221\227J.\310MaW\242#v\267\004\275\323\237v\364>>\003?\263\035 \0244\r\264\234\036\030\020\n\230\314\002\201\237\na\317\016\216\016\250\002C\t\237\023\023\346C\373\001;\2644\007BLF\323y\315d\261Y\017l\366\352\331\301\341y\345\310f/\b\n4\346\003\223\275~b1\331+\246\354\203g\242,\344T\020\337\364L\376\265\002Y\tv\331\305\252\0338\274\3517\313\272\272+(\277\217J*4\2602\034\262\252\207\017\373Q\365R1\227\225Q\025\304\245\204\210\"!\302\306\310\307\212\3603d\326P\257\312H\303\311cOS\266\265j"
+	.string	"\305\203\311\344\242(j\023F\250A,\303\020b\210!\022\031\021\231\205\0059\006p\002\2312\233\007\021\300EE\013Z\314\276\001\212\242\273\234\t,I,\343.*P%>!\177\370\256\372\220\334L\277M\207%\351\316\267\2521\204)\303\024\332@W\036Q\b\357\0253R\007\002\376\200$!7\263&\017\335K\226eV"
+	.ascii	"p5\254\311`\271\004\2435\031\203%\020/.,n\236\200&u\371\322Q"
+	.ascii	"\331\021\354j\001\360\300\261\312\205e\270@\326u\335\004\226"
+	.ascii	"\\\377\204hn\244\t\251 \341\375\255x\250\242\\\351k\\`+\2427"
+	.ascii	"\007\247\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch.164.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\333\003u\033"
+	.string	"\266\363\262I\260VU:4\316\340\313\34434@\036\253[\020\367\001Nz\004\205\257\300B\263\306\347\3609VCQ+\311\266\2366\237\034O\036lZ\274\320\036\232\217\360\346\340Q\272\2612S8\333\354\214\006\252z\036\221\211%\204\020\271S\n\233"
+	.string	"\225"
+	.string	"\242"
+	.string	"\025\250\352\r\233~8\325\032Dp\322\025P'a\343]*[H\216\007\033|\020\335\211r(\253\352\364V4@\235d\321S\373?\016D\367!\024o\325\372\303\204\244\326\240\002\033@\235t\360\257\362$\352\256\362\244u\366\025\001;u\327@H\310't\252\265\306\366\306u7Kr\\\252\363\315\b\302\237?\340\356\246\214\227\343\201\"q\313\n\350\033_,r\374.\344\241d\n\b\343\243\n\250Cw\005\334\031a\265\326'\235\252"
+	.string	"\366(5#\324ZM\177@\0277\352\266O\330\236\331{%D);j"
+	.ascii	"\031\342\321';\330\243\013d\177\254\373c\277~t\317\234\324\256"
+	.ascii	"\223Z\346Hw\353\244f}\350_\235x\307\234\350O]\310\177\246\250"
+	.ascii	"\315\223\272DQ\223(\352\321\244^\223\232\232\324\017\260\342"
+	.ascii	"\021\004\274\321\222ZY<}\251M\244\222\216#\375G?\361k\337V\262"
+	.ascii	"\212x\013R\371\030\025\253\007\224\321\221\374$\253\214\350r"
+	.ascii	"\037\342\037\201\320\343\304\351\344\021\214\027\254-L\037\243"
+	.ascii	"a\356D9\251\372^\025\241_\361\244\235\363\215Xu\"\037\346^\244"
+	.ascii	"\004L'\030J\037\277\3640\365\250\f)\342\360RDR.\220M\340\226"
+	.string	"q\346\354!D\303\227\264gr\2174\265\257U\341\337\224\2735EV\350~w\251\026\337\f&?\227\356\b\306\267\324{N\371\332\357\205\037\225z\236\024Q!\262\324#[;\263*\237\341\223/\314G\327\266\326V\364\344\\\327\256\242\f\271\370\302\320Z\353n\027\3102\333\332\232\242&:\324\213S+\263)\237!\026_\030\326\026 \262qY\331Z:\205\307G\217>\371H\246\271\022\031\252\326\352\300_z\222\231\037t\322 l\350\1776\345I\326>\351\261\030B\310p5Z\211\273\331\344np,\340\310h\263\334\315\3146a\306\004\205\017\037j\270\234\204\030\023\024B\310p5\232\231!e\331\202\232\r\007D\354f\253\335h\263[\214fC3\"&\263\335b\013\b\270Fbf\213\341j5[L\025\344}\254\373\343\013\377\024Y^4\361\266g\016\240\377\2052f\313%\327\\\033C\006\372\237\307:cw\366\241\210"
+	.string	"\360\2635\274i\003S\r\207\004U\202P\224'\315\375/\006\3174w\322\244\\\006=L]\206d\350\270\344\332\035<\320\377b\026\266\263;\277\226\334\363\024y\364\311\347\216\373H\250Q8\244\f\023 \205\330\310\204$\005\3151\200\002\231)4\017\021"
+	.ascii	"6\243\241M\332\016D\350=<\373\330\323\221.|\354\210<\314\312"
+	.ascii	"\326s\267y\024a\256>\234o\037-\314M\370De!\373\r\263\037 \024"
+	.ascii	"0x\254.\245\340\332\201*XO\236\240\315\032?\323\336\234W\256"
+	.ascii	"h\032\031k\3437J\236Q\254\260\232\311E\3269\306\215?|\356\202"
+	.ascii	"\265+\371\202\t\35764\032\224\265\227\360\r\316+\215\2747\263"
+	.ascii	"\361\037\226\017.\312$\205k,\213\3014\3014\352\331u16W\302S}"
+	.ascii	"\332\034\374\007"
+	.text
+	.section	.gnu.lto_gyroInitFilterDynamicNotch.166.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\242\004\375\036"
+	.string	"fx\304G\220\232Nc\205[\365\215\225\361\3573\351\346\204)\036\255\035s\301c\307]|?9\031\327D@\232\3413#\342\266n\202TP\013\364\023k'K1\200QP\305F\362\311\3734N\344\266-\330H\023\262\367\226[\312\224\002\254"
+	.string	"\243"
+	.string	"\270"
+	.string	">TpMwk\267\260u\267UG\355\027\271\221\363Z.ns\257\324\332\222{\207\016\274\300\274\365\3608\344\255y\001\344\255O{\215\200\357\366\"\b\2450y\211\271\367\356j\017\377\355\343\360.\351y\234Y\222v\254\364\364\267>F\221\205\371\001{\307!\340\341t\343\346X\372\232\254~&\343i\344icc\362\261%Zb\3318\371\261k\210\"#\376\2006nG\006le`~&\343\306\210\323d\365\373\226\217\2169\340\214\327\221\001\324\224\0313\300\244\021\307,*\313\271Nc"
+	.string	"\225(--\334{M\177@\247;w\333Y\266I\330c/e\230\334\334\3632\037\363^\245\t>\361K~|\037\267N\021D\377\013\"o_\337\026\\\033\243\205D\337\354a\022\255S\366_\365\244\n\212\253\224\235\363\260\373\346Z\277M\216\272\206\244\246\271\330\255\303Q\347Jj\034ImZ\352\322\244&Kjk\251G\222\272\222\324\324R\277\300\f\0211\340\307\320\356mz#s\213\226\311\325\305\3760\373J\3741\353\304\374\3440\250\204j\024\314$\376:\330\3710\026\277N\227\232\t\021\246\261\335{un\035\301\274=0^"
+	.ascii	"\211\344^G\037\372Ap\313\221\375#\347j\361a;T\367^\262\376W#"
+	.ascii	"\303\253\204\230r*\0338t\350@\336\332\372\261\217Y\301/\302Z"
+	.ascii	"\277\242\370\200\244\013P\023\337E<\230\003(\335\213\224\300"
+	.ascii	"\366\360\201\376wS\237\344\327\301\224\343\216a\363\325\036\017"
+	.ascii	"U\033\233\255S\026\001\245\326z\256\343vD\371qvE\033\234\246"
+	.ascii	"\306\260U\2205\tzW\336\272\260\f\240\364\206 }/\021#\350\177"
+	.ascii	"5\365^\267)v\301**\325\236\307j\223\270\023\023\346\275w\202"
+	.ascii	"\337\244\304\t\2324\037.~\\h\352X\277u\213#\270\326\205\366\345"
+	.ascii	"6:8\255\265\232.yI2[\331\227b\255S:\247\365\211F\332\223\022"
+	.ascii	"+jJ\264\315\257\264\216\001\006\332)\0022\352\021\332\r\361\204"
+	.ascii	"\204x>\366\003\220\217\021o\210\004\221\263\317\016\217\350("
+	.ascii	"\305\256\210\210W4\364S\264\033\n\352\021\332\371\020\025\355"
+	.ascii	"v\f\230\267\342\207hg\304\343\021\355tC\244W\251\255"
+	.string	"\377E\027*E\244\232\204[@q5wub\035\360i\021\002p\006y\226s\210\204\034\0265\334\b$\bFh\326)C\310\"s\252\255\262:\327\351\252Y\251UW\225\262\232\365LnhfYwj\037\357\275\267lp]\315\251(\254\220\021\227\240\222\350\233\025\320\377\024\2227\325V\023\017FV\373$r\032\241\377y\274O\265g\377\2147\223\366\263\rt\263s\253\002\317\205\0271\334\006\\\250Q0\006\235B\206DD\002\021\021I\2159\200\002\2311*;\020hG#I\222\341V\002}xv`?\211(\310B:\204\311\317\216\234\345\346\002\250\027\032\020e\333\230\233\377\241\300\222\306\233G\017P\003L\034:\274\233\231\026\360G\033%\371\013\227\213\312),\3313\240n\360\022\324\361\r0,\206\225\261\340\273&\216\313~\300\272bo\360zG\200\252\251Q\026A!L\316\373Q\300\t\375F\340\345 xBe"
+	.ascii	"\031\200\240\214\225\017\020\274e\343\237\320\227@\363\374F\227"
+	.ascii	"\332\3126|Df \204\302h\307kH@\334\352\2238\302\262Ad\273\nHb"
+	.ascii	"KN\034\234\373\253=\261A^\322`\226\f\352L\257S\254p<jd\252\006"
+	.text
+	.section	.gnu.lto_gyroInitSensorFilters.167.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\267\002\205\022"
+	.string	"\226\241vH\340\322&\035b\336\301p\325$\273y#\343\026\2031\300v\032<\321\341<\333\354\3639=\3620\334\351\252\355\234e\236\311\212\273D\345j(\f_\251X\026\001P^\250\370\331\243#eSW~\330X\333&\215\354-eJ\001]"
+	.string	"X"
+	.string	"g"
+	.ascii	"\273jU\365\007\250p\344\210\035hh\316\016?zL\233\024\"\201\262"
+	.ascii	"}\265o\342<\340i5_\315\271\203\0244g\355\304\007\272K\327\036"
+	.ascii	"\200\273\354\016\200\2734h\353 \3310a)\263[\216\n\036sNoC\034"
+	.ascii	"\274\202\376{n\nc\260k)\301\234\323\032\306<\334{\333\005l#\260"
+	.ascii	"\227%2GA\241\233s\252\234`\315\230\210\030q\351\327p\227\337"
+	.ascii	"%\232\021~\260\321\037\356\324\266\360\322\2076\220\024\263\335"
+	.ascii	",\314\256\335\350\202\260\037\347\234\323\273c\237\366\217D\365"
+	.ascii	"j\325\"Q\035\262jUT\203\254:\025\325\250U\237\242\332"
+	.string	"$\325]T\227V\315E\265\224\352\030\325\001\313\031\311`\334Jk\352\326\344\340/Z\204\272e\311\\\334\270-\355u\212\216\036<\310\005\210[\226\fhF\242\273rG\326\206\260\302aa\216+Y\376\323\322\".K\346s\243\351\356^\207hG\216\017;\302Y\270ts\342\250\370>_!\301\023^\364\341\013w\251\313\222\375\314h*\375\332\255\030\0028O\241Ao\204v\256\357E\323Z9\031\006\345se\210\361^\256\357E\323zy42/3\036\214\353\345\241\b\360W\241\345\362.|\237\313C\325l\276;\356\222\216l6{c\023\005g`\t}h\fF6\234\205\271DCv%\262+\236\333\260\211\2506dO\300\236\327\240\241\2121+Q\324\202(X\220Z\020\0067*Jm\n\322iQ{\322\340C.2N\0015 \340\002\021\252\252\003\230\242\b\f\215S\032\307\212)S\301\r\0309\233q6\261\274"
+	.ascii	"\362\364\241G\301W\030\326\220\227\333~\305\335\256\233\250\226"
+	.ascii	"\204\260\320\t\271\270S\322\330\035\206\310\370\220\342Z\026"
+	.ascii	"]p\204(.dy \t\3612\037Bq\365\304\004\030\221]aR^b.\210\230$\032"
+	.ascii	"\243\361\370A\003\361\2627\350\025LX!4\217)\260\313\2136\223"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_gyroInitFilters.168.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \372\275\006"
+	.string	"\362L/4Pm\222\016\244\2642\006\241\255+\242\302\327\320b\352\001\374\231w\215\233\037\207m\373\2506\352\b\245_\374\26333\023U\325\035!\212\210\352\307\037o\214\020\231\002o40N\tO\212P\352p\244\327Q@Xx\233(=M\301\220\201\023_\003\204\361a\260\254\373\\B+\231\307Ili\365(6]2=\265\356GA\034\356F\243\037\246V\253\321\235,\215\036\"\242\325:\023B\311&\\\365X\325\034\306\027 \335\347\335\300I\311U\222\221\314\212\025\225\314\"\021\216\277\230\2517)\246\221\004\240\016\212\220\224\314|.\243T\033u\013\252\200uUm\001\007\231y\263.\213\356\372\033\374\231\377\"\b"
+	.ascii	"3\001K8\023\360\370\032\327D\267\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.169.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"E\t"
+	.string	"fQA< \005)\035 !H\200G~\273`\027\b\360ub\254\026\221p\006"
+	.string	"hpO.k{\3753v\304]\333L\206z(B"
+	.string	"L\024S\016`\003\313\265\200\f\352\023\371\203l\262wJ\0010"
+	.string	"1"
+	.string	"/"
+	.string	"\266\335\360\200r\n\364\241\322\211P\211q\301"
+	.string	"\330\355$4y\352/\345\277\345\024,\032\315\013\246\372\013\220\330]\277\027l\344\206\267\255`\333\301\366M\217\003;!\260\323fvEj\001\266&\316Rl\243\354\217\355\367\354\257\234\005\365\330\tD\260-\031\210\314n\307\340\005\317\243\273\033p\217\236\027p\217\0013\226\347e\246\020\216]\377\262\341\331mA\270tp\034\234\240<\372'\356\3610\224\023[\275\232\335\251\036,\261\277\355\356\032\222x{\354\207\3609t\326\022iB\300#\321\244\036\026\262\322YK\244*K\027\025\030rD\253\024!xf\220\250\324\230\223\312O\267\367\006\023V\220e\337\304\035n\220\263q\005\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\325\263\214\313(<\215\207"
+	.ascii	"\352\020\306tM2"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.170.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"%\t"
+	.string	"\326\221A:0\345(\035\200\237iVD\036\374\005\036\343\301P'\307\306\324\305i)\307\007\275\b\332:\330L\377T\320\003b\260MU\017X\030\020pC\247\376/\251\\\232\202A\354w\223;\2451"
+	.string	"."
+	.string	"3"
+	.string	"&\331\232\025\026H.\rh\230f\032\276\024\024\n\200\335p*\310K\217%\377\337\037\274\225\232\224\312\364\030\340\260\273\216)U\307\255\267}`\033\3016M\3667\253\036\266\243U\243\343\246@\346\261\234|*\352\022.\307L\2661\t\023\261}\337up\364\226\365\025C\262j\355\256vi\217l\355\362\016(\230\027g>\350\211\233\200\f^@o/\251\020\b\331\315`\b\377\352|\326\245/D\361\251K_\304\271\214z\360\t#0\254\225\013<\305\231\035zQ?\002\366t6\016#bv\334\326\205>\335\fI@\200\246\207\353f\207\300\033\305\207\233\026\333\306M-<\335\252\377\376\r\224+\026@\346\244\236}\020'\252*\247%\n"
+	.ascii	"2\003\3020\r\314i\230Mesi\027\306 \214\351\207\262\034\256e\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.175.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`I\002E\023"
+	.string	"\366\242|I\340\320(\035\332\215\370\017\344\177\2245\340x\304_\"\353\240\365j\032\fj\307$\031\267'\270A\327\277\020_\355\037\353\003S<\334?\245l\324G\333\371\030\334"
+	.string	"\002\271f$\251\030\030\0054Q\211!\337\f\333\310\222&wJ\001b"
+	.string	"c"
+	.string	"h"
+	.ascii	"-pv\267\305v\261\303\177\017mKi\223\034\210=\007C=\007R\316\305"
+	.ascii	"\356\316\200\013\230\3769f\327\370\216fQ\272\032\030\036\244"
+	.ascii	"\335\0255\304c\237_Ie\314\007MN1\267\227\317\016\377j\031d\251"
+	.ascii	"\026r\243I\ro\263\222\200\335\275\356R\303\215&%h\262\273\226"
+	.ascii	"17\0167x\333,\333'\266\264\005+\3621+\363\337u@\215\007\231L"
+	.ascii	"\272\334\335\0275l\252\242l61r\024\321\240\311\035\366n&u\306"
+	.ascii	"~iU\006dJ\207S\372cJ\237\244\264I"
+	.string	"J\203\237\364|\356\327K?D\344E\257hGg\243F\273\265%\361X\030_\320\b\333\367K\274\347r\023\016o\034!\341r\273\373\335yv\313uL\202\0133\243\036\034\241\202|\350IC\005e\324rf\021\016$\301\264\273%\276\317\177&\244T\252\371\357C\317S\243c\322\223}6\334B\023T\223N\242\032\211\231L\362TP\017\323\343=\247\\\205\212i\227V\342\247x\317\312\277\371g\013,\326\3747\365\275\023\270\035\311\340t:2\231d-\351\314\316\257\025z?q\0240\377\306\256-\327\212%5RX]H!Pi\255X\343\t\313k\\%x\255PV\215\270F\027\025\3615\272^\255\224\227\330Z\245X\242j|\211#\001\354\302\2202\212,.\327(\206;\331U\306\n\206\200t\330\220\351l\352\314as\3509\034\021\316\321w\273\373\251^w\371\301&\002\004\210\236\347\005\027b B\303s\203\263p"
+	.ascii	"`F\320W<\200\200\202\302\373\227\203\373\t2 p\002)T\310\003\263"
+	.ascii	"\200\273C\266\026x\350v\314\330\324\272L\3602R(\264\221\223\244"
+	.ascii	"\207\233\2456\214\272\b*\214\234\214\235u\332\261L<G\345h\333"
+	.ascii	"\2623\331a\020\r\261\001;\310\273\t\300v\004\217\242\300(\243"
+	.ascii	"\307oT1.\024!\330\023Q\030\355\031\336N\330~\321\212l\376\306"
+	.ascii	"v\221\245sY\330\310\030&^\\/\213:O1o\337\364&\2302"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.176.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\006\001\275\f"
+	.string	"\026\330UB\020\2176\035\203C0OL/\356"
+	.string	"\342\022\253J\005XRjR\236\267\341\206~\213\222\213r\212\347\246\215 \216\250_LQ(\371\360\037\202\n\001"
+	.string	"\200\002\265R\365[\245\242\353 \205\276EK\366\2262\245D"
+	.string	"@"
+	.string	"G"
+	.string	"\246\214 \301\210\263\177(!"
+	.string	"\235W\322\022\263\373U\212\341\331#\324\314\374\214\306\202\0130\"@\034\311c\006\205C\212\223\220\252\3416\270\331\335\247<M\270OfFcw\235 n\302=\3356\003\333\004\354G\b\252\311PA\313\222\375}RO\354\303\325\221\355t\204i\b\323\237\024f\304\326\271(\212oC%\030[\"\276h\260}\277\273'\362\025+\013\213\016\"\225\220\253\370/\242\0231\217\266\210M=\336\036q)O\022!\016\026Z\230\270\347\316]<\003Rx\346x\b\007\001Pv7\005-\007\321\341\223\036m}|L\367^`\303\n\222\250[\311\335%Qg\3235]|P\261\345\013\373,\367\220\371$c y\320\243\0172=>\336\340XW\210\247\302.\013\363\350`\225\007G\203\216j\343\302*\216"
+	.string	"[\017:W\005\301\262\256\212\372\264\303\325\221\023\032x\352\201\247\232\330\216\272\321\364\343\324\250/\211\241ei\212z\342_\241\216<\023\324\007\030"
+	.ascii	"K\204\236\337\206\2073e \fn\244:C;0%\331\204\224`\342\364\263"
+	.ascii	"\b\250\204\210\3737\204\342\232Xd\342\237\0137U@3y\212\330\226"
+	.ascii	"p\355a\205OU\003\251yz\273J\031"
+	.text
+	.section	.gnu.lto_performGyroCalibration.177.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`:\020\035N"
+	.string	"*\202\320\034M0\316\322\351\303\303B\256P\023xc,\353R\004\234\274\341281\220\212\236\243\221\230 u\"\374hP\214\030Yu \351\237\253h\252\231\206\n"
+	.ascii	"\nx\016<\260\355\326\016\210\032J\241<\327\250\271\216hU\321"
+	.ascii	"\214&#m\357\235RJ\001\266\001\224\001\302\001\316\317:{\321\271"
+	.ascii	"\037x<l\314\264\267\347[k\261\242y\332=un\254\307\233\256\273"
+	.ascii	"\255\237\271\231=c\206\331@\301\3012\215\027\325u\234\303Y8\030"
+	.ascii	"\305\314\332\325\361\232\327\345\305\314\215\233\f\335\005H\314"
+	.ascii	"\265V\354\350\365\267\227e\320\001\342[\313a\320q"
+	.string	"\354\243\0244sf\201\353'O\265\033\037\371qM1c\300\314\212q\343\024\3169\315\205;\f\367\227\006s\273\215\353\272\335j\333\203\30148\300\266mG\264\312N\304V\221\322\026Z\331\272\213\006\315\205\r\350\032\303\266\312\254\0013\333\352\312:\263\001\b\334^+\322@\355r\r\b'\332\231;K\247\335V\353\240\221m\373\325\027\327\266k%X\004\261U^k\242\265Ub\013\255\255\362e\376\303P\325*O\244\215\271\3622\330\266m\322C\341\357t\255\371\307o\023\r\t\005!\201~\216>F\266\330C\034\256j\372~\271\213Z\312&\032\022k!1)\036D\226u\202\024G\252\311\022\333\022\305\201R\240\260\224\200\266m\227\376c\302VW\037\235\355\223\026\360lB\330G*h\226M\226\305\304\215\303\245\257\264\302\300'[(4\233*\245\231Ey.`\356\232,K\211\027\325d-I\221\332\266%\313*\301{"
+	.string	"x\262\225\244\211\351"
+	.string	"\316<\021\210\322x\3715Y\026\227\017\323\020w"
+	.string	"\347ZMV\222\264\250\nk\n\253u\345k\223i"
+	.ascii	"\324d9;L\373\021-+WG\3504=\240jp\311Q\253*5\336\271b\303j1\375"
+	.ascii	";L\353H\203\013|\262\325\325>\\j\333\226\275\251\265\325|\241"
+	.ascii	"\231[\004f\206\200\371'E\177f\203#\374J\271(x7\031\211\371J\346"
+	.ascii	"\226\023\344\330\214s\307\020P\240J\007^+I\200\036\372\207^o"
+	.ascii	"\356\232H\236\314\354\0010\363R\277\341'\211\260\266m\025`\276"
+	.ascii	"W\332\357\226}\b\273g\355\346\242\365\335)7\255\b*\326\301\332"
+	.ascii	"j\2539\375\006\007\371-oJ\231\364\301\230\351E\374\022,\025\224"
+	.ascii	"r\326\264\300\364;\f\343\231^<\212\207\361\3036VX\226WKCW\020"
+	.ascii	"\333\266E\301\315B\363\261h\340\305\213\265\325\027\337^\242"
+	.ascii	"\250)=\n\206\313j\256[W\274\322\257zVdK\2172\213_\361}U(\307"
+	.ascii	"L\275FF\232VC\203m\340\360n\342X[e\361-\327 \264\004\277\372"
+	.ascii	"\311M\215\306\211\330\266L\024\334+\334)<\270\305Z\355\266\366"
+	.string	"\261\266*\342\373\331 \252\b\2329\323\324\250<\372m\333*\377\301\230\327\226\376_\314\335TZnN\376/\037\357\334\003\351\314\003\351\274\003\351\354\364\316:\336\271)\3109\307;\343@:\337@:\333@:\327xg\032\357<#\310Y\306;\307xg&\2443\f\244\363\013\027\254s\213 g\026\357\274\242\327\272\227\232\256Y\305;+!\235Q\274\263\210V\353\016\321m\315\035\336\371\350\2359\260\316F\254\363\006\326YC\3219\003\353\214\241\350\\\304:_(:\023!\235\207\200\234\205~\234\203Xg$\353\fdt\376a\235\217\254\263\017\353ld\235\331w.\032\235{\216\316D\037\347a\321ye\235U\32695\006d?\017\364\353\234$\036O!Ih\345\347W\262\256/gj@\204t\276|\362\214\261\265p|\247\342\345c\267\314\003\230O\271P\2744\343\370\274\361\217\337Vfz\274\217\2132]^\226|_"
+	.ascii	"y|\217\035\357\364<\354\304\244\354\320\361NM\257"
+	.string	"#\3077\3311\223G\t\313\361mg\002?\033\016\nv\313z\314\227\ncjE.O\2303mN\214\033\2333#\216o<n\362'\311\350\021\236\223\213\366\003e\274V\2618\237K>\26787\036\207\215\257\3617\256\026\357r\247\r\032_\203M\317x\0322~\306\031f\362%\256D\306\367\031\327r\353bU<\373\177\002[^\361\331o+\300\245/\376\260M\177\370#A\254\330E\326%9l}L\277\323\323c\302\271.\223\005\240\216\304I\270\312\273\274UU+\361{\036\303\333U\241\2530r\217\254\335$\376\232\244\t\363\225\335\263\345nI\034\352\"\353\360[\005v-\337*\302-\306\367\203\213\345\335\274Xk\253\303\357,g\2363.*\217n L\201n\370`<\242;\274\252\254\243\205-\001_C\270#x7U|\223\351\2418<x{\314W\256Nk\f,iZ\f7\371\0071\276\3054\210*p"
+	.string	"\235ij'<\3755\311UR\345\315 F7r\307L@\335\203k\205\004\324\257\216\302\326_\275\376\236M$\352{\325\025g\236\371\362\242\0215\343\244\357\257~[9\377\323W\365\254"
+	.ascii	"]y\2314\\\227\267\327Iw\201F\225\302\376\033.\312\034!??\344"
+	.ascii	"\271e\036\360\\4\"\377\346r\n\236\315\251\203\374$\001\365\352"
+	.ascii	":\267\314\003X\323\271P\212\342\234\001\031@\375\370Adj\235\002"
+	.ascii	"\262\301S\372\243\202(\n\246\240\244(\3201$\n\b\221'\251\b\200"
+	.ascii	"T\360\304\202\310\020(!P\031D\321@j*\262\004&\242\2448\230 i"
+	.ascii	"J*jj\b\324T\322\020 OB\222$\220\232J2\241\201\243,\200\222J\""
+	.ascii	"\022\025%\225\304\256Q5i\252_6!:\372@\300\2136t;\031]9\374\321"
+	.ascii	"\227\260r.\233\374M2\332\301o\210C\232\247\353\356L\255\207z"
+	.ascii	"xwR\216.Y\007-\2743zv>\207\362\363\216\341\030niD\311\336\337"
+	.ascii	"\2067\372\341\034+\262&o=g\223\344#\266-U7\327p\362LR\317\273"
+	.ascii	"\271\341\323\270B\272=\rh|\017M\006\r\357yA\214\316\230\301\313"
+	.ascii	"\360G\257;`"
+	.string	"0\244\361;\273\"\ft%|N.\256\350\217^v\242M$\027\2369\271\306\341\370y!\314\307\370[\262\215\220$\037\337\332\252\0236\343$\340D\027\036\211\031&\210\021\to\273c\375\026\006\346Zi0a_.\232\022\321w^\327\360\262S\247\211D\250\354\210\235P\210u\350\275\220\355'\032\205\023\355\020\253\320\017}\006\275+.\031\316\234t\223|\343\335\024\372\276k\262|e\320\323\032\364Rl}Z|\355)\t'\031\230\f\\[\r\372\024]ov\270\\\270P'\347\254\314\311:I;\335Vx%\203 V\033\022\204\366\361\275\245\235\013\213\005']\270\311\321||wi\240\007\343\236\276\243\213\377>?R\242;|\323\351\364\207Dwx\027\337a\272\211\315\257\216\023\376]IsD>\231\237\361\263\204\331-\023\240\354B1\202\266\370\343#\177\255\263\242\262l/7\\\326Zf\006\242QAf\333R\005"
+	.ascii	"\364-~\203\236U\201I\250q$\006\031c\246DdD\222\024$\031\016\201"
+	.ascii	"\005\204\030%\241\272\033\021@\261C\214\221\214\250\3313F\350"
+	.ascii	"<\005\f\371\261\n\326\215\365nMM_\261\252\344\026\002\306\036"
+	.ascii	"N\356\026\037F\204&\277\032\314E\244p\244\242\354\274?\225\024"
+	.ascii	"\346<s}|D\360\356\013\256\270\204\333x\022\007\340\020B\327\244"
+	.ascii	"\020\270\r\331[\025\241,pYg\3578\354\221m\225\227\350~m`_~\355"
+	.ascii	"\313\363\"\316\301\303\221P\215r\374\213_F\335\273\311\bI"
+	.string	"\315\250\334\370\336)\263\244\272\354!|D]{\034/\036\345\262q5\333.\220oM\306h\365\367\335"
+	.string	"[\\T]\344\0206b\372_p\204V\\\024\373\033\311\026\220U\232\021\240\024\316\337\220&cE\346?=b\351\226]\027\335\266$N\225\371\211!\004\327>\334=zJ\202\255hmv\252\336)}C\304`d\006\304\220\367\300\2712\271\016\231iol\253\263M\265\236"
+	.ascii	"\214J\362\330-D\343\216\224\352\034\262h}Y\324Ut\270s\321\246"
+	.ascii	"\247=\223\237\020\270\266\327`\204\237\367\002K9\022b\307\360"
+	.ascii	"\275\246\273\0037\273aC\362`\215\254?\304\005\032a\263j\f\306"
+	.ascii	"l8\355\244\"\001\330\202n^&M\013q\251\001\304\300p\336\030e\013"
+	.ascii	"\260j\326\317Z\271\313\305t\350\225\311Xn[\375\302\021`\366:"
+	.ascii	"\2520p\022\\\240\252\033W\360\016\331\366|\036PO\336\272\327"
+	.ascii	"\371)\021\313I\204`\214\335\254\013\311=8\003\261\210b-5wA\321"
+	.ascii	"%\225A]!m\363/\335P\202\367R\031\337\243G&\021vQ\2362\242M\006"
+	.ascii	",a\346\311\337\267p\251d\377\331\311p\330A\261\032Z\220\322\321"
+	.ascii	"\306\352\240\303\305\230\343\352\206\367\031\330}\200\240\256"
+	.ascii	"N\306\306\347H\203zZ\271\317g\212\201\247~\3575\314\360\tl\200"
+	.ascii	"q\020\037\253\211\242t\341=\231{\307\031m\325\266E\030\333\031"
+	.ascii	"\302\267\310\205\t<\204\020\337\250\364\301\203i\344L\262\034"
+	.ascii	"\225\370\376\022\263^\364\302n\320\372\230\334\\RLHy\342\304"
+	.ascii	"(\342\212\307\344.O\325\300n\225\261(\271)\2122\021\331\001\320"
+	.ascii	"\021\2341d\036\276\233c(I\244R\001\021\260\377\366\243;\021 "
+	.ascii	"I\311W\376I\t_\001\320\236\221\0041*\236\221\374\316|\372\331"
+	.ascii	"B\t\252\275\304%\302\216\224\3037M\332y^\200\210\b\026\374\031"
+	.ascii	"\366\316II3\226\344\262LO&\331\243\002"
+	.text
+	.section	.gnu.lto_handleOverflow.178.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\"\004u\032"
+	.string	"\266\257\246H\300\226M:\024\3042\034\232\020\214\260\301T\"\306\273\216Km(B\362\355\247o\013\n\310y\270\336&tC\273\243\234t\335u\375\023m\003\326\177\343!\b\262\001\231;EG\004R\fq\207^\261\252\233\266\204\220M\344N)\214"
+	.string	"\203"
+	.string	"\225"
+	.string	"O#\276G+\241$\355pbew\025|:\202-}w\312\235\207\220[\273/~<\343g\016xi_\307\231ro\"q"
+	.string	"\273IJ\246v}:N0~\332w\233\360s<M\370\351\234]\005\247\304\016\361\354`R\004\205\265\2730\205\361\334G1\234\240\312\234/\366\264L\364\206>\212=b\201\027G+\036FQ\261\202'g\t\t\272zDR_\275\"0gw\017uy\242\267\223R\354\331]K\023\275\243\273u\333(l\203\260A\234QKv\207\007\231\215\273\333"
+	.ascii	"\310\205\032\004\253\030\237>\211\360\363\312\300\351K\227\026"
+	.ascii	"LM:\371\263};\251J\366\301\325$;\224\276\021\245k\316\343\247"
+	.ascii	"\371\323=\363\246\037\200(\375\232\3222\241tL(\355\232\3220S"
+	.ascii	"\272\025J\217\241\2648\245\303)=Ci0\224\326)-\247\364qrXF)z\367"
+	.ascii	"\242e\327\350\327e\237L*\031\177\372\355\373>\376\303v9\350Q"
+	.ascii	"~\200\224\005+\310v}\376Pv\331\016K\204^</}\200\224%\253\311"
+	.ascii	"\276\335\23521*\343\322\030\030u\375\310\225$ArW\205\2370Xr\034"
+	.ascii	"l)m\324\226\206SD\035C\025\365^t^e)\230\225\221\037\004KE\bX"
+	.ascii	"\205\372&\244\253,*\271\273C\252J\236\321\251\032z,!\222[\f\352"
+	.ascii	"\324\351\205gE\025\324\363\260\244\252\276\212\327D'\177\013"
+	.ascii	"N\304R:K\273\353\300\226}\352\347\200\225\324\200%\251\257\201"
+	.ascii	"t\225\203J'u*D\273k\002D\273:\003\327\031\225Cx4v\006\272\020"
+	.ascii	"K=\346\260#\233\001\341`\264\332lV\213\005\220\341|&\340d7\331"
+	.ascii	"\204\240\232\207\r6\231\b\t67\013\262\031P\005\034Mf\263\205"
+	.ascii	"\210\311P\200ql\247f\033\361\003\273\331j7\232\354\006\243\001"
+	.ascii	"\371\314`1\333\r\266#\300\265\0172\033\fW\253\331`.\237\356\340"
+	.ascii	"j\322\370\313z\242\323\335H\243Q\204lZN?\253\026L,\324\267;$"
+	.ascii	"\252R\206\320\306p'\031\306\233\327@\322\202\343*gwCU\262\362"
+	.ascii	"\246\356\023\336(\013#..\256HiR\2437\212\203\245\350\313Ki\264"
+	.ascii	"F\377\343\240\215)Hn\024E\315\330\305\036T\250a(\006\215R\220"
+	.ascii	"Q0AA\232\202B\213\001\260\002\241)2\017\020XFb\223\264\030\232"
+	.ascii	"ibI'\006F\352d\344+\223\001\231\025\213\017CK\361\305\324g\363"
+	.ascii	"k\354\003oq=\336\206\036\220\b\345\374>,\342\004\214w\024\270"
+	.ascii	"6\0079\333Y\350A\020#6\"N@>#\022\007\213C!\316\201'@s\347\025"
+	.ascii	"\177\211\326\330\336\202\375\341fR\b\017\374\226ob\260\204\226"
+	.ascii	"\2174lz\374\267\223\372\207\241\327\b\371:\223I/\351W\215Bg\330"
+	.ascii	"\256\241s\034\300\227\217\317\261\246:\247\301U\342\246\223_"
+	.ascii	"\005OGn\t\201#\375'\261Rj3K\r"
+	.text
+	.section	.gnu.lto_checkForYawSpin.181.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\030\004\345\033"
+	.string	"\326p\256I\260\230Qc\360\007\361\030\226\212\270\023P\"E\n3)\346/\316\246\323\301\347*\215\272\31603\330\243\253-\"+\262\316S(\226\\\301\202G\370\330\362\374\354@\372\310\375\226\342\tbw \302\2761\220\335\273\311\336[\312\224\002\226"
+	.string	"\216"
+	.string	"\233"
+	.ascii	"<6\353\344Y\266k\360>p\377\3213\272\356\216\306\t\007\346I\233"
+	.ascii	"\361\325\276\321\201\270\037\221\370\314\2755\226,\335\033l\340"
+	.ascii	"\004\346I\007OS\2364\017\240<i\234}\245\306\304-\341\200\311"
+	.ascii	"\211O\220\252{\357\313\3328\356\247\271*\311\321V\234\217\366"
+	.ascii	"J\374\\\341\230\005V>\265l\221\304\253\344\241\254p1\332\334"
+	.ascii	"{Y=\023u\364\300d\005\313\f \027\267\243\002\037\023\026\255"
+	.ascii	"\336n\244yB\243\312\221^Q\364t\265\256p\356\275\256?=\240\033"
+	.ascii	"\275m\237\355\020\366X\0036\363\336\373\3007r\213\231C$\312\223"
+	.ascii	"\267G:\002\242\341\220\017x\224\253_\354\240\256Z!\373\343\265"
+	.ascii	"5\354\263z\006\255v\241\3252fu\353\254\2169\253a\314j\326\211"
+	.ascii	"7jV\237\253j\363?\376\362G?YV\327\262\372\001\022\buQ@\230\212"
+	.ascii	"V*xU|\351r\241\310&\034'\376\366\375 '\302\363!\216\360\223*"
+	.ascii	"\022r\242\237\364!n\347@l\201\206E\237\321\275w\307\037\232\345"
+	.ascii	"\235\013G\330\354\202w\b\025J\341d\264\340\244%8-KR\361\246`"
+	.ascii	"l\214=\257\212ea\354\213\360\236\374%\177\262\022\203\342\275"
+	.ascii	"\027\302\211\316y\223\013\007~'\032\303\231d\020P<\351\033Iy"
+	.ascii	"\222eO\364\233\322\243I\351"
+	.string	"B\334\332\335\2333pZ\324\326\"\274\034\272\372\305\246=m\215\025\336\324\211\326p\247\r\346\275\273\007~\222+\341`\353\300\352\177`\366Io\220\023\016\371\200\377q\231Z\"\353\221j\3530\212\017Fe\242z\"c\264BK\267\3237\321\024\377\342\267\245H\313o\374\370\240\254m\345m\007$*\273\312\305\366\207+\005\006q\223\312b\267\327\214&\223\321`\003\322\233N\205[jK+\314b\"rF\350\360\270l\027RY\314\302m\226\326j;\260\230\034\324\260\033Z\215\347\303\313V\243\331f\251\3555\213\351\310^\260\232\355uC\3004\021i\355u\243\321j/V0w\234\234\325\235\245\225\322CS<\211\204U|\300 \363D\247\217\262\t(\236\350'U\245e\025\024\343\023\312\031\033\304B\207\217,Q.;ck\250|\274\310\330\322\272\354\211|\334!\305i\007\017a\016\035\205C\365\23026\302O\252\207\217"
+	.ascii	"\213~\245\025r\313\242\266\003\322S\214\rU\250q,e\f\202\f\032"
+	.ascii	"\211f\322\204I\232\003P\0021\306\360:\021\300546S\320\3022\006"
+	.ascii	"@\344\\P0E\022\017,Tm\017\276\177\204\221\256\001%\264)\237\367"
+	.ascii	"\267\214\321\225\f[\337_TX\304|\307\344\023\"\0313\264s\n \271"
+	.ascii	"\365\357\357y\373\f:\215.E\022T\244\363\375\230\205G\223\375"
+	.ascii	"\360\326.4\353%\313^D\203\210X\344\004\243P\252;\253IG\031\341"
+	.ascii	"\273\217\217h\306\340\312\177\314E\212>\335\371\007\003K\376"
+	.ascii	"\021n\0250\337`2\320\276Z\322x\267]\231\311]q\203\241\331\027"
+	.ascii	"\265G\206Q,\227f\360\017\222\241\242\321|\b\216\0353\335\350"
+	.ascii	"Wt\003\024\375\037\352(\317m\324"
+	.text
+	.section	.gnu.lto_filterGyro.182.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\265\b\215/"
+	.string	":Q\274\021G`^N:\311\202K\264c\232\314\004\356F\2667\231\322)\227L\314\201x?\276\251F\346\325M8\260q,\303\244\027\355\302\023\177\212\371\200\257\201\007\020\237\244EL_=u\340\251\354\231\310\262od\2334B\310\336I\006\004\001\370"
+	.string	"\n\001g\035@lJ\316\231\225\321\315>U_vf\263fTB\276\234\215T\230\\X\227\327\322\236\214j\255\322\262`\246\2063g-\244\247\275$\007\274\335\277r,\355\307f|\230s\030[[\316\313\244n\260>\355\345\203\324\247\353\177\324\247\335mw\233/\225\031B\022\032\31499g\"&\022l\377d}\215\217.\337\252\332\276'\310\003d\177B\337:\354\251)\212o\333\357-\021y=\217[U\357\t\022\007\344\006\207\304\270\276\316\323[\212{\n\206t3\204\353\353@\264\207\205C\311\037\3449\271\374\255\307e}\374\347\343BTXFK\211&p\363\272\276\336\222\030\027\217\2577\362\370\360\355Ce\264~\240B\314\0179\321*r{\2500\347\034\334\242\201&\3109\277\211u\325_\223\256\247"
+	.string	"\216\3468F\217\276\302\344\bn]\241As`l\316\374EnY\335\333[\3129\367=nq\275}\336}\254\356\206\321\335[\022\315\337)\347\316\320a\374\273\"c\306\373Dp2\335\374\333\203n\022\037C\3655:\023\027\303\264\346\234\035\204\301\200\342fJ$3\324\247\027\377\255\216\213\361>_$\206t\203q\262\225\336\244\036\247(\253\273\272y\335\377r0M}$\355\244\342\376\250B}z\214`\007\035/\343}v/\255.N:\335\340\3105\016\353fo\037\031\035 \022\372\330?"
+	.ascii	"\350p\357\237wi{\017\317\366\026\246\267{~\267\203\350m\036\337"
+	.ascii	"m\340z\233Mo\377z\267}\351\3555\275\335Ko\253\352\3554\275\215"
+	.ascii	"\246\267qz\373\242\267\237\244 \216\217\234\234q<\355d\271\224"
+	.ascii	"\313\222\303\375]\376\266\237\355'\373\315\256v?n\255\322Z\321"
+	.ascii	"\312\220o]\032n\310\032&\037V\2677\272\376Y\277\331l\177\355"
+	.ascii	"[\332\2635\034\232\323(\\\261\342\3149sX\237\n\241\377Q\325\210"
+	.ascii	"_\216\366\264n\266e<\276!&\302\254\030Z\321\375\341!fqw\013\245"
+	.ascii	"\225\222U\247\030l\251<\257\265\242\304\342\037\273\214\367Y"
+	.ascii	"b\375\341\273\375\002yB\347\312<g\333\372\007\312<\347\360O\352"
+	.ascii	"\321m\354\230{c\306n\300\275\363}\265#|\265\241\373\2633\333"
+	.ascii	",\f\224G\037\356\2260A\b\353o^\\\272cw\205\343]0\340\303g>H\211"
+	.ascii	"\225\032\265\256\001\367\346\fj?M\303\206\373c?\355C\2717Ln\334"
+	.ascii	"9\257pU\367p\262\337\274\221]j\204\033E\201\260\020#\223.\304"
+	.ascii	"\217Sfwu\363\216\217\311\320\274T\2518)\304F\330g\206L\326\227"
+	.ascii	"\325}\366\212\231\335\004\302\314#^\017\253x\305=4w\335\374\033"
+	.ascii	"\233\265\336\211\333u\323A\035\225\022]\221\212\241\202P\301"
+	.ascii	"\327\r\316\234\220\024'\373^\244\277\371\013hc\030\351@\030\331"
+	.ascii	"GS\234\246\203\322\317\034\215\207>\022\020 \216x(N\261*&k\f"
+	.ascii	"\306\027\243X\300]"
+	.string	"\226\023+\021/\323\001\335\244$`E\323T\261E*\365\024\003\005\232b\002\005\t\353\024\f\027S0\212\252\207_\257Pb\341\002\352\211)\312i\212\305S\n\246b\224\f\025D\251\250\242T\013')b\213'\024P\304\246()\242RQ\027]8E\021\247\212\305(\"\2734\036\207\265\205 rFlE\366S\2419\017\211p\263\237\371\241\223\354>{p\262}v<\0070\266\003\"\375\347\007?N\360\007\037\300\377\341\325\203\257\215n\026\265@.\222\212\200\362\036\231\202R4G<\343}\206xY7\327\036\374\270'i9\343IP\326f!\360\263 !-\030\363\2773\035rX@\234\354\005U~B85\"D\272\017F\372\340 \276J\312\306\360\340 >\215;\306\373L\336\253\246u\345\301\304:4\347\234Y\037,\204\027D!\203\340\036\356k\300\"\355\021\254\233\241z\304\237m\222\233)\333%\277\3236a"
+	.string	"\304\177{\20185\307.\214\346\005k\353'\304a\315\032Y\211pjd\210\364\341\020_\2619\2605\313\200\275\250a4\306\224R\212\215H\020I\222\244\320\001p\002\021\"\263z\021\300\245SG\322$\231\326 \355:;\272@\347t\216\343\235\271p\212?\257+}z\211\265\240\013\371\206'\263\025(\006\215M\026G\311\034\007\001\0211\367\013x\257y\tm#O\302.U\016\207\302\264^\244,\300W\241\376\202\245fkGfE\332\025y:!|c\002{f\272Wa3\344\205\233H\233\234\315^\213A\345d\023D\250\021D\\X"
+	.string	"\305\341L\270\312\211\277\325SJ\222\223\371-H@\233\272\245\024Vi\3414\200x\030\270\r\214\224\247\241\025A\305M\351\033\f\007\312\313\340\332\235\226\233\206\013\243\254\225<k)\203\236 \216\017ne{\025\211rA\337\224\r\326\227g\232\023z9\b\274\337\2047&N\371\272\025\0379\246l|V.\234a9\366\025"
+	.string	"\245s\177@k\305o^d\343\356\013\321nL~"
+	.ascii	"h\343L\003\017\217\b\220\204\236\b\274 \220\200\035\365\357\267"
+	.ascii	"]\217T\t\361\023\372K\356H\365\354Z\270\327\376\227/\310J.\344"
+	.ascii	"\320v&B\315a(\221\215\013\227\023H<p\023c\335\203\030\020\356"
+	.ascii	"\025m\033\320\310 \013_\0012\341\177\256C\331\037\331\3269\211"
+	.ascii	"X\301\342\202\272\261\221\250\325\033\350\237T-\3443\200\r\356"
+	.ascii	"VG!\244\253~\344\\\220@\3110\354Q\316\363\333\355\315\241\321"
+	.ascii	"wS\370\245\006"
+	.text
+	.section	.gnu.lto_filterGyroDebug.183.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\242\016\205B"
+	.ascii	"*m\354\027>@\350\316\030<J\037\354c\365\266o\035\206,e|a$\377"
+	.ascii	".\215ZF&\242\005\260`'mO/\332\241_\240n\257\257\270\233\024\b"
+	.ascii	"S->ky\362\227\215\355A\"\"B\244\224)\245\024q\001R\001t\001\334"
+	.ascii	"g\032\215\333i\270o}\365\300\274\324\t\276\357\273a\330,sme["
+	.ascii	"F\353\255\307\264\036\263\221kt\036?U1\326`66+l\274\246\262Q"
+	.ascii	"\214\031\223\370\276O\272\271\nC\273\016\343\366\235\331\360"
+	.ascii	"\214-\f\217\016\301\367e\353j\226%\374\035\333\231\333K\177q"
+	.ascii	"{j\243\223\357\353$\216\232\367\265#\300\n\206\315\262]/\333"
+	.ascii	"f\207\255l\233e\2279P\333I\337\006SpP\023\275\357\353\374'T\314"
+	.ascii	"\2562-\361\367j\327|\325\272]E5%\305\204zr\212jZ2)\233KI+\244"
+	.ascii	"R\022\322\321xE\034\n[\266\370\356r\013%X\275U\241mg]\265\"\301"
+	.ascii	"\254\005\336|q\2528\267iO\275i\026nmP\023\267iKy\361\343\342"
+	.ascii	"L\275\206\352\322O]\374\350\334I\257\243\352\272\251\216\212"
+	.ascii	"/W\241\232\017*}\207m\312\372\265H\220M\363Eq&)\255\224\322\315"
+	.ascii	"\025If-\260\006\212/\311u\262\237rmUW\306\221\322VR\342II\032"
+	.ascii	")\211\0256$~\\\231\322\225I=\342\306\025y\207\315\310Z\340}_"
+	.ascii	"5\277\352873M$\322C\"M+lo.\034\322mR\033\216\275\033\316\272"
+	.ascii	"\231.6\233\270\025\351_\005$\221\003\244\357\260\025Y\227v\340"
+	.ascii	"\3764\265}\255\r\315](\341}_vh\233[3V3\373\027f\226\301|,\021"
+	.ascii	"\356]\335{]a\314\364\273:\371k\334E\366\001\305\274zO\363\341"
+	.ascii	"\300\334\301\203\007\350\340\372\354\267sn\320\371\367_\037\n"
+	.ascii	"\320\r+h\037:\017\3575 )\236<\200\377\r\b\312\364\351\325\001"
+	.ascii	"m\207\367\232\357\213\031D\377\231\365\031\300\020]G\304\360"
+	.ascii	"}\337\005t\\\267\021-F*\305F\333\254\177\363\365a\363\364jk\305"
+	.ascii	"\255\r"
+	.string	"\372\217\262W\217\265\375'\360\372\244\371\"\346\206\323q\306\270\2450\t\023\336P\023m\263\375\003\206(z{z\225\331\016\315?*\270\306\320\037\277\023\346\243s\206\2433\206\013a`\021\036\364\264{\001W\273i\016\320}\315[\335\246Y\253\3254ga\261\316W\255\263\225\320\271\311:3W\347\252\326\231J\350<\305:K\255\316QFg\250\325\371\251\350\354Dt\006\300:7\r\235\227\2553\223\320Y\311:/u\232\346d\353\214\024:+\261\316I\2533R\353|\024:\033Y\347\"\353Ld\235\207\255\263\260ufY\347\225u~\326\331W\347\0263ph\t\321\373\372\2506z\377X6U\332Mw_w\233n5\335i\272\357\272\305\264\220\271\3370\323\220o\032\334\332\234\237\027F|m\270\257\211\2379\017\3035|\200\334y\334{l\fV]\235\225\365\036g\007\316\217\335R\326Gxc\334\030\036\340M\237\365"
+	.string	"\240\270Qn\274\265H\232\342C\334*^"
+	.string	"\276\241B\2604}\257iG\202E\321\267t\221\240\232\244\325;\361\2673\f\261\323\325\346\326\313\360\255\267\345\235\327T\367J\002\351\362\231\335,\356\026o(3\325\376\214\331\333\310\034\020\312\354\3229\233[\207\265|\017|\240B\236^E2yy\0171\005\200<\224\317\364B4K\312\245\207"
+	.ascii	"E)\331\201uI\310\367\034bN\307\241\364\310o\365$)=3\355\317\206"
+	.ascii	"I\317@\371C-\021\222R\217\265H?\303\237H\377\025\367%]$x\374"
+	.ascii	"(\243h1|S\273w\3748#\204'\260\351\376\272`Z\3562\023(xC1|\227"
+	.ascii	"\351\344\037\2419\036\200\004\323\376\214\215\037\345\336k\256"
+	.ascii	"@\342\205\347\265\230|\254_#\320X\337\207\360\002\323|Qw\377"
+	.ascii	"\335\0307gW\037\305\372\013O\304S\347F\0224\257:\361\350H\214"
+	.ascii	"\201\264\221\361\217/t\204\343\321\224\027\237\271\202\205\266"
+	.ascii	"\241\306o\203,I\373\263a\033\bW|*\3571=\025:H\374\341\027_\250"
+	.ascii	"\007\321!\342\264\020\357- d\346\0058\2505\374\026J\350\204\302"
+	.ascii	"\027\024S H\250\007:\350ji@bM\007C\377\321\320}R?g\204\337tx"
+	.ascii	"p\020\256M\313\324}\b\371\032Cv\230\260\037\345L\302\013*\005"
+	.ascii	"\211\030d.X\030*h\214\255'(\200M\030\306\220\361\"\206\f\262"
+	.ascii	"\266C\221Sx\261x\321B\305\2102\0231X\25081\202\254\254\006\n"
+	.ascii	"'\21422\030.L\300p\272P1\326\302I\242\f\206\323K\213\311^\230"
+	.ascii	"(s\306 "
+	.string	"#+s\032\355\236\375N8L\311\337\363\321\356\272\005\357\274\312f\353\3736\211\320b\272\251\235\024\274\253\372(\023\003\247\300\376\003\245\272:@\200\357CT\037\r\360`\337G\336\256\236\212s\341=-\267\315\267\230QI]\213\210%\253\207J\343]}\277i\002a\362\350~j\001\236{\205\252\363\226A\334!\336Pnj\027\363\202\374\251I\3715W T\330\363\032\305\365[[\314\255\017{\"\037(\253\36791\007U\232o\365Nh\230\3159\346w\036\224\247\217\362\367X[%W\365_SEoN\037eGv\2657uu\373u\205\275\351\262\253\271\242\250\b\270T\314)}2\365T\337\352\221\232\222z\006}\232>\212\326QpQ\316e\013\335\362\243\214\240\213\362\301\263r\315\256\326\3725\255\207z\247\202G\347\351\241\276\2118\223\261\341\360\351\235}\246O\257\256\357\373\276LZ\377\340\021h\251s\300\273\257\317"
+	.string	":!q\225 Y\221\004h\305\217\270LZ\214\264Yf\027\316\215\270\321\004N\337|}\345\307\007*\344\307\270QkS6\337\t\033\345\222\021\236\225\013\201;\250\2014%\031R\206F$\210$IRh\f\221\005\204 \305\250\274\003\021"
+	.ascii	")T\322\215\314$\005Ic\240\255\227\377\361ntT\235Lp\025\273\336"
+	.ascii	"X\234\371\333|\271\f2\272\242,\241\302\276h\232\243\r\036\271"
+	.ascii	"\026\221/\274\026\023\302\303#4\372\007"
+	.string	"\366\250\n\206\222\320\351\r\324|\205\237}\357\371\366\370h\3173\237us\205@9\344\204\f\322\244\215\272\f\217?aB\304i\326F\365@@\316&O\007\004\004\277|\\\316Kg_\223\231\352V\374Qx\203\374\275/\007i\221=<P/[\273%}O~\031P\256x\345\030\212%O48U\330\313\237\315\333=\310\0357$Rrq\355\243\035L\r\243\266v\324\255T3\346\211\201\026F&\306\207.\245\207\347\245\352)-\250\355\340\344\270\353nfa]\b>\337\345\212\265\333\366\362\271\371\2637\f^\245\226\301J\007\036\227)\032\256\362.\276\024\345\003\r_\003\360K7\345\201\204\020\006\3013\234S\211n\273\004\274\340\306\356\312\203\344-p\316\273\376%? \375C\243\340\275\330)\021}B\001>?\302\260\345{M\033\270\363\326z+\202F\225\004\007\201\270\233\3266;q\344\275c\377\241\b\346b\232F"
+	.string	"\267A\002d\213\3649\263@\220\223\3742\251\021\301\030\304\221\365R"
+	.ascii	"\n\250\304\352\315YR$\007\274\177\332\201F\333\272\214\027\027"
+	.ascii	"^X\257$\303\"\255\340?\213\201\336\356,\024\253\313\037t#\020"
+	.ascii	"\030V\203\b0\206#\001\334H2\006bI v4\3229\fq\002\363 \276P\003"
+	.ascii	"P\2507]`\253\016\213\330\271y\210i\232\035&\031\024\342s\231"
+	.ascii	"\370\030 \006\177\276"
+	.ascii	"\003b\227+\f\364\264)\3749\001\025\020\233\2103\f(\364>\222\337"
+	.ascii	"D\217\212\ba0 V@V@\213\205\364L\017\377[ \034.G\374\n\370\233"
+	.ascii	"r\313\206\016\254\327@|v\314\177\335cx<\246\300\215Y(-\351!4"
+	.ascii	"\243\221\376\037\3740\251\221\035\370E\350\347\326s\177!\202"
+	.ascii	"\220\230o%4\353\0344\231\210D8\241dtG\205\250\271\005\3255h\210"
+	.ascii	"\2041O\031\237\254\313\"\223\226\022G\3618\032\244\247\334\234"
+	.ascii	"X\316 \265\032"
+	.text
+	.section	.gnu.lto_gyroInterruptSyncActive.184.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\215\007"
+	.string	"\202N45Po\322\001 O\"\216\370\\\210P\241\203\020J\360\037t\245\333\255\212\265Xj\r\265\226x\240\r\341\"\337\232\310\314\224K\325\345\207A\253\004\200M\267M\344N)\346l`\254\026\236\214Pz:\362y\030\024\032\036'\312\267\0310t\350\304\007\001a|\231\271\247VO\252\004\"\275\354\1770WU\22722\271\f??\032\373\341!R`ew\021>\016\022\341k\334Y\242j'\335\371\025\346\356\252a\001\021\265\314\236\241\246\025\366\251\325\223\355fm\315\247n\321\202M\230N\221\355b\331\313\2428\022\016\333\267\r\262368"
+	.string	"\331\372\304\300\002J6F\".\273\363\351\305\2557\313\277\307]G\306\311\2452R\n\275\001$\354\256\033\251d\272\365\005\266g\013"
+	.ascii	"2\241\211\037\330\306\004\373*\312\313\245\331\264\3175|i\210"
+	.ascii	"\022\35626[\336uo"
+	.text
+	.section	.gnu.lto_gyroSampleReady.185.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`Y\001\275\016"
+	.string	"f]eC\360t\224\016\250#\306\272tQ\357\277\325\321P2.\"\342\326.\347\231\353\375\331\302\354Q\321\377\311\310\305\237\017BT\260\375l\332\242\244\225\354\374\005\267}\006#\230\017/T\034\341\324\212'\221\354-eJ\001T"
+	.string	"N"
+	.string	"S"
+	.string	"_\211\031`\217\233\037\270\036\341\013\\\217\266\375"
+	.ascii	"\302\310$\004,^\020\n:V-\254!\273_\246'Nz\204\232$\237\344D\205"
+	.ascii	"5\002\007*\345=b!\016\005\244XN\251\232\224\tnv\367/\236\037"
+	.ascii	"R\247L\222\223\335u\242R/\367"
+	.string	"u\333*\266-\330G\021$N\352\331\237\227\nc\037\356\356ZU\266\323\231\177?\026\3231\246!L+L\037\200\001!7^.\242\265\013\242Ud{\304\034*l\217l\215m\375V\340\200=\231p\211\331\335\022K\300\036\235i\277\305]\214\276\352\340\314n\211\0351\273\001\n5\201\221\226#\245l\031\236s\245\252.0\342a\205)[\266/\334\006\007\333\335\b>\215\327\350h\036\317\365\230z\037?V\245le\356\256\247&]We\021\003\310)\211X\223\207\361\031\033\266[:\312\227q\026\006?\305\243A[\364\267\r]\036u\235\020]\212\006\372\240pD\031\264\n\004\272\024\r\364A\021\2054\216\343\320\t\340\216\311\306\255x\262\216\333\272\220\326e\241\017\007\224u\270.3Q\340M\203\306e\242m\3432\315\267\207\253*\2476xB\007\217\352b;\243\233\222\232\0345\243\277\242\302\370W\250*c\nyh\031"
+	.string	"\026\223pA\323\301R\363\253\355&M\215\032l"
+	.ascii	"#\260[6\330\002\243\225B*\260\272\302\356!\306\236\214\021\255"
+	.ascii	"\327\226]\360\221\3330\032\033A\240J\304j\234\252\206\254\334"
+	.ascii	"\321\222ckK\031"
+	.text
+	.section	.gnu.lto_gyroSampleReadyAtUs.186.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \365\275\006"
+	.string	"\362L/3`m\322\001\300\2762\024\tSs\347\377\f\353\t\0260\355\\n\030\025\fi\326Z"
+	.string	"\320\261\230\2720\036\202\340\t*\205\200\3755c\315\352T\223M\244L)\306\\\334\333,4\370\034\324d`\3230(44\314\203\355R`\347\220y\355\301\271\327(\327^E\251\025J!\354s\374\212\376\2057\234|u\346s\246\263\324\200\t*G\366\345I\255\260/\255\212l\247S\007HD@\017\215\354J\214N6\204}`\330\356\330\024?\343\032\035\307\204\017eY@<\":Lv\257V9\301t&]`:S\213\307g\364\277q\204O\250\244\262<O\200\203\335uV\026\350\326\3336\260m\261M\021\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroReadSampleQueue.188.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\270\007u*"
+	.string	"\272I<\020FpZN:\337\035\361M0B\271\035\207\211\327\221\201a\252\235-\004\355}<\261\362\\\316\206\360\371\36637P,\331\265\234\310\206\035\237\2403 \364\007\343\005\253'\273\333ey\214:C\204\246\215l\223F\b\221;\311\367"
+	.string	"\331"
+	.string	"\361"
+	.ascii	"+\224\263I=\312\323/\fnM\335\275Y\030\300\004\325\240~\267\356"
+	.ascii	"e\334\301\321\325\335\2136t\224#\250\215v'RO\213:wn\325\017,"
+	.ascii	"\006\352\321\003\247\265\314g\362\245\324\317`\234\347^ k\254"
+	.ascii	"\334\213V\304\n\324\243\214\366\237\364\250z\237\364h\003\007"
+	.ascii	"R|\024`5ew\004\227\346j\355\356^4b\007\341\323\036\2773\024\352"
+	.ascii	"\004W\340O\365\245\350\331\366\310\237\372NJF\254\013\023\274"
+	.ascii	"\341\207\032F\204dY<\304d)\255\316\216\007wx\331U\307\201:\230"
+	.ascii	"\017\"\313\312a\177A>\266p\\\275\230,\034'\313\352\262\276/\270"
+	.ascii	"\2756>\266\302\236\236B\312.\\B\255\253\363'\314\0175\253V\f"
+	.ascii	"\213\236>+\254!B-\253\363(\257\356\355\314[\032ZT\3664\302\365"
+	.ascii	">\363'\0221=\2529)Z\\\267>\t\367^\266I\255\2553\317\231?\304"
+	.ascii	"\314\034\230}\013\002\314\307\3246\022\232*\233\307=\366R\316"
+	.ascii	"\034\221|3\223"
+	.string	"H\262O\332\206\360e\325S\314\254\3647\026\352\275\367\001\377\n\205\242*\004Fz\364}/1=\2633\344y\357\275'\377P\351O\013\265\0261\275'sP\224T\266\331lY\254\264\272\301\230\321\250\354\217\302\362\352\270\2010\263e\243\240\345\"\266L\024\264<$\364\264?\350g\277\001\266\f\364\263Z\006\260Z\366Y-\367\260e\236\325\362\316jy\250Z\026\372,\353\254\226\203@\313+\3202\360j\347\037\320\262\372\263\354S-\247\252eT\265|\252\226\233-[\237\3453\370\230\022\254\032[W\316\335\213\325\324\273`\3207\"W\373\243\334MA\263\353S\336\306\274\262\361Rx\303\030\233\222{\357jd^\217Zf)\376\332\231\034\266I\247\323_;s\006l06s_\367V\034\221_\260\231\271\350j\216K\007f\356\275G|4Osl\302\023\220\220\250$\355\326\016\002[\355\265\037\243\b\025\260\177\265\247\366"
+	.ascii	"\271\253=\244m>xEK\231\332`L|\205\324\327'^\346s\025,\\\270\220"
+	.ascii	"\036\365u\210\2615\263\256t\214]\223\264C2\2063\243"
+	.string	"\322~1\246\206w\206v\230'\355\206\315f\263y\250\364l\364\327\335g?\306\275\374\013T\006\r\032\322\243\335g\036AZ\334\227r\331\205\340\306\233;\037\007\260\006\232\207\232\250!|U\365\024\337\215;\234\313\007\036\352\273\035\001\231\233\236ry\206\264M\016j\276\226o\211\342\013a\020\"\354\223\"\322\243vb{x^H\037\033Vw\351y\376\364\257i`\371\257\033Y\205\315\2233U6\017m0\006J6Q\266P\017\223K:\3134\002E\025+\226\222\214i\013\246\247&\244\242\212\025KI\306\325\370\241\270\224\302C\013\246\242\223\323\223\222\216\213\"\005\037+\03159E\241 \032\235\232\214LE#\221)E\322\022Q\311\311H4\"\300M+\212N\304\026MMN\304\025\r\371\006\302*\344t\260U\031\376\307\024x\245\214\320\350\\\311&t)Q\003\0015K@6\025?\235\367\372\210\360(\177]\232m\356"
+	.string	"\350\244\235a\257"
+	.ascii	"P1\363i+[Ud\221>}$cmxo=m\357qY \214\310\233\3072U\030\326d\230"
+	.ascii	"\350s\216\313\">\0329\363X\226 \354h\317\020Y\034\030\345\362"
+	.ascii	"M\200\232\227\332\260\250\215\332\270\303\345\024\365\333X\330"
+	.ascii	"`|"
+	.string	"\271\363t\211'G\316<\362\364\2061(x:;F\277\213\263\023,[\207ws8o\316r\251\260\207\355\243r\265wL\3626G3\365\336\036\017\370u&\216KX\244G\205\3758\261\263\264\200\231\250a,\006\025S\210DD&\310HSH\007\220\002\221\251\262n\0210\271S\254FH\222J\215e;\330}c\335\036G\037B\202\346I:_\222\3441\271\213\355I\026\302u#\332\305p,+^X\0259\213\n\305\247\224\330\223-\205\227\346\241c\357\275\300F\273C\375\024\200\347&\202Lx\002\362\2559^\245I\325cS\305\022\345\177\307Q*\355B'\213{GA\354\031\227{\231(I\377V\016\257\312\307w\263P\342&\035A\342P=\211\324NS\030\021Gh\026\232&7\304t\371\034\023\3274\367\204\277\271\365\225\275\340\b-=\374\357HsDP\030\220\202\251T\354\336\364\355\025\355v\362\260\325k\204"
+	.string	"Jy\365A0^+le\275&\244B\212O\242\324\"\234\307\267\242\354,#na\212A_\026i\212\"\261\021\fw\360&\345\272\266\245\204\034'\263?5\317\263\324\212\030\374\225\366\036u\250yN\360()\r.|\372\tx4\260\273i0\031\343\246\211?\020\001\005\341\177\356\306"
+	.ascii	"\374P\265\007\202\346\355Z2\016\006K\314\030\215\264'F\373\242"
+	.ascii	"7a\034T\310\037\2543\177"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.189.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\346\013e8"
+	.string	"Z\\\204\024EPdR\007\223\344UX0\206\274y\357EJ@\031t\022\216\370\236%&\250\213P\032\315\250\322dS\004\240&\330\032C\007\001W\244\020"
+	.ascii	"D\004\216\006\002\274\006\325\340P\253Q}V\332\256A\270\355\336"
+	.ascii	"[\246\224\002,\001\"\001=\001\355s\277[\3377\013\364\275\272"
+	.ascii	"\337\331\367\375\355\267O=\301\221\342\301M\3112\233\267\270"
+	.ascii	"\253\332'\276c\353\212t\267\267c\361\271\030\016\327Nx\302b\\"
+	.ascii	"q9\031\016\327O\32302\272\201q^e\206\303u\376*\243\307\031%\216"
+	.ascii	"c\240\263\3353\272\201\316f`w\377\233O\201\235\n\215\225\030"
+	.ascii	"g\231\331`\340:\273\264\372w{\024\217\302\356V\303\213q<\204"
+	.ascii	"\314\2268~K\320\b\\g\373\315\205Zg]\017j\235m\270[\016\3212V"
+	.ascii	"2\230:\267\342\364\304q\034\225\321\034vc\2218\024\276A\340\017"
+	.ascii	"\310\365\265\354\232\037n\3775\225n,B\323\236\370\364\341SJ\366"
+	.ascii	"B\247\277\253\023\035.x\204\272\330\230.\007\344\203\316\261"
+	.ascii	"\007:\327%\2513!\361\022\373\037\023\220oJ\310\327\017wQ\200"
+	.ascii	"\301QG\310\027\324}h\274|\254Kq\034;\022\257\260o\205\315-\255"
+	.ascii	"g\327\325\311If\007\260\271\\\205\316\230\301q4^\320\317+\022"
+	.ascii	"\236\231%\302f\326\3324\026\004\213K\375\271\232X\377\276\251"
+	.ascii	"8\216\373\231\315/\357 \357v\252\356\236\320\r\314\020\316h\330"
+	.ascii	"\325W\273a)\216\346x\364<3t0\250\031'v\270\3349S\306\346\263"
+	.ascii	"/\336*=\233{\315m\216P\226e\367\002*\317L\0036\263tL\260\246"
+	.ascii	"\340d*\020\310\033s\364\\\263\177A\301P\237r{\030\027C\243}\255"
+	.ascii	"-P\2753\251Zg\221\320/\3241\227\003d\017m=\2669#\215\376)\177"
+	.ascii	"\356\276\200\341\235\231\363\3222+\273\335\313\213\341\223\331"
+	.ascii	"E\301g_\034T\013\023\354\233hn\204\311\371\254"
+	.string	"\335\252\365lB\352&\353\367t\267\006\337b\225\364\354\336\340Z:\270q\0347\310\002C=\b\345\255\325h\235\365\354R?@eZ\346\214\272]}\265\373\r\353\363Y\267\347j\265Z\355<\244[\370\r\301\375\226r\277\0278\025\367'wsw\n\372\036`\374n*~3\021\277\227\334o%\342w\022\361\033I\370}D\374\0260\3746\022~\027\001\277\211\336\357\241\367;\300\373-\024\374\006\360~\007\275\337\306\367\273\030\374&\276\337\303\367[\370~\277\301\357\340\357\033\b\374\376\375\276\201~\337\356\357\003m\236\354\313`\035<\340\036\357\314\036\255\263H\231\204\032][\230\324\027e\243\334\r\213\301@\336\231-U\266\374\261\022\256\030\214\006\225\367\203\200\321/\027e\227z\221n\353O\325U\264D\371\227\373\267\302\260\276J\366=\340 n\345\301$\020\345vL\r\216\3526\224w\274\216\377\n\220\205\362\220\327w}\216"
+	.string	""
+	.string	"\262\320\333\370\033\317\365L\357i\353,\200j[P\336z\255_\032s1\007%x\254\277z\245\221\230\213\t\274\372\307\017\221Z7\314|Z\213\0013\337\003\243%=\251qL=a~\363\320\bV\236\326\342q\316\034\017\214\346i\3568\031a\3668iu\301\374\346\"5Zt\256\276\n\345{p\232\317=\3438~\320\r\253\271\036LDB^\235`n\215@\377\264\325\271\035V\224\256\205\217\264\020r\030\017(\312=\2746E\\\016|\244@\336\\\303I<\016\274d\350\031\307Y\r\340\300P\270I\373\032\334\326:\013!\373\234#8\"g\315\031u\003f7\316\324\003\312n\006f\327r\346A\001\312\276\003\232\246-l\215\035u\314\227\237\262\233]\313\b\326W;\r\034\365\345\267n\252'V\035\252X\250\340"
+	.ascii	"\243E\025\022\031\343\304\273\341\327'\024\034\2213RDY!\217V"
+	.ascii	"-\252\254\242Z\250(\301\"\352\004\322*J\201Q\037]T!\243`\034"
+	.ascii	"\217\310(\340\333\225\257SW\031k\215\34386~x\246\334\224\007"
+	.ascii	"pIv\321\232\002\"\2307\375\267$\030\003\317\001\331\351\334D"
+	.ascii	"\270b>\232\034\3436e\242)\023\354\241\214\360/\3112\377$i\347"
+	.ascii	"vLy\3052\212\225\342\2029S\366\3600\374\307I\274\266\275JRM\222"
+	.ascii	"\315;sA\366*\3569\266\304b*\235\254\254$\266a\333\273[\312\315"
+	.ascii	"M\351\206k\276\364\346\227(Y*PW\346\316\031\025R\375Sv\312\355"
+	.ascii	"r\3119\311:rB\304\356\226YiL\302#\311+\345r\235\334\373#GW*\273"
+	.ascii	"\234\027@\002g\304\031up7'IP)?\023\251\033\266/rL\336I\346yg"
+	.ascii	"&\363\264\316*e\2504\007r\265II\352\253A\223r\b\265i\233\333"
+	.ascii	"\217\317\023\240|\366\311*\254t6&wYY\331s\246\230Y\343J\370\243"
+	.ascii	"\354\264\204\267\004\344\243\3546\376\f\346r\373\315~\b\214\243"
+	.ascii	"\033\356\202\233\315\326Y\001\331\351\250\305Q\335ZO\317\254"
+	.ascii	"\316\247\243E\312&\244\001\200\362\250q(\007\025cj&\020\021I"
+	.ascii	"\222\2440\034\240\002\021\241*\316\003\021 13\024\215\f1Hj\264"
+	.ascii	"\035\327\0250\343\245/\277&\266I[\372\177\264\r4\303\033d6)k"
+	.ascii	"d\266\3121[\224\305\301\226\244b\271p\232M\017\361\211b\337\260"
+	.ascii	"\226\343\235\247\372\320\355\301\214Q~\025\344G\b\262\fl\277"
+	.ascii	"\214\231\r\2375\230\034\312\270`\264\007\273\002\221kq\252_\305"
+	.ascii	"\2160\326c\266\3438\260b\241\t\321\2064\002c1\r(\bcd\241P\\u"
+	.ascii	"\321|\2210\270\b\255O\002\020\305\017\246<6W\263\211$\36798\262"
+	.ascii	"1\004\211\235\235RP\365\0340N\205\224\017\211\206+\3062\320\325"
+	.ascii	"\033\003\253A\016&)&\364p\253\025\344\350\207t\034o\315YBbx*"
+	.ascii	"F\"\237\020\200\n\356[\213lN\300"
+	.string	"\204g\331\007@\020FZ\264\312SQ\320\327\264\264X#\207\376\202L\331>(\315\363q\342y\240dq\330T\370\217|\227Ly\035!\3575\204\314\355\264\212<\034\261{2\236\267\216\303\231\311\352\354S\335\331\005m\333Fo\f\2468^k\306\330\252\276\035\21757\023v\340\252\242^.\231\007\272b\310\222\316g-\247\300\205=\3229w=a\3563\235z\362\004\333ue\006\240(\230X\3166\2240\362D\322kq\241\226QqH|kTf\374\275\r\236\351q\273\340\347\031\267\250\254\364\323@\311e=\307,\305v\232gw\365\322sbDs^\315\204\361*H\177\231\2357z\262a\322\353\205\211EA\365\237\226\302#4b\020\235LYp\322\020)\036\003c\266\210ci\313\237\334\177\303@\34753b,\2513\313\217\373\024\332sU\223\234&\356Hv\374W\276{Uha\323\271_\263\007D\367pI"
+	.ascii	"]\016\302\250\256\006"
+	.text
+	.section	.gnu.lto_gyroUpdate.190.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\331\005\375\037"
+	.string	"v8\302H\240VN:\304\227\233\3428\244|\301G\316\332\001\345p\260\377\302\354\305\216a\030\244\227\340\250\200G\326Ui\377\363\202XiW\257\260\263\303:\370wz\r\357\005ib\216\237|\"\214\360\\@\341P}X\315\222\275\345N)\243"
+	.string	"\243"
+	.string	"\265"
+	.string	"_\252\030\355\262\361\254\237h\337\207\257\225e/\236%b\035\312l\205qY\235I\260\235\376X\276\331&\226xmQ\337d\005\306\242\254\326\212\340\324\rl\247\266/\355[\275G\322\257L8\246V\030<\270j%\372\370\200\355\224\347\001\306\323y"
+	.string	"\343\251\223l\262\023\245\352\016\230\212\023[g\265\326\334\316\360~\022\357)\223N\347\2162\311\257=\210\021\016\225N\247M\255\225f\3104\027"
+	.string	"\345\224\301\341\364\2659}\324\272D1d\232<\265\326c]\256\030\006\245\254=\250\265Z\n\207-\356\332m\003mO\260\307\007\324\036v\273\361C\221\274\320R\210\016\"Z\031\323*y.\221\013\315~2m\347>\b\005\224i\026\302\333\275\323\324\020\264\247\234\rr\027SC\252^\310\325Y\t\346D\230o\316\312}\360\006\360?\016\304\204?e\021>y\341\251\357\033O\277\270.(VP=\236~2\315&*\311\215\252\265*yc\330='\336:\277\372s\236u\343L\351\233)m3\245k\2464\315\224\306M\351\231)}\233\3222T:\206J\333\246tmJ\217S\232\256\364\\\351]i\271\322'\340s\005\370D\013l\305N!V\026i\001E\333\301<\214\220?\365\3633\236\312\354\265N\237\250\244\354\356F\371\177\255\265\216F\032m\273?\262\031YU\226\244\027\307x\231"
+	.ascii	"\204\205\302\317\272\304\354\235\250\230\240]\331\326\337r.H"
+	.ascii	"\025\200\344\205@\243\205\233!\331\264\330\366.\250\226T]\325"
+	.ascii	"6\013\031\226O\271\225*T\306\344\3555\236\326\320\306\215\002"
+	.ascii	"\345\211\317\235\2105a2~U\321\rs1\300\205+\021\232\001{\222\240"
+	.ascii	"\f\0324\214\247\222\213\320\354g'\370\227\213\f\244j\255\016"
+	.ascii	"l\016?\"\344\323\341^C\005\306j\255\fN\215\320=\022\252#h]42"
+	.string	"g\357\343];[\255\277\013}\256\027\321\371S\017\276\335\210\241\351\013\032:\002\241\213\240\003\021\242h\310\207\363\005\351\212v\030\216\214t\275\036\022\021\316D\nx=\022\036r\276\036\317g\244\363\345\214vCE9\242\236/\247`\200y!t\275\334\021\217\327\313\335\210\365\033\003\353o\332\201C\354\267@\272Q\276\325\330\236\2455F\004\307Y\024\306Y)\343sn\024\316\366l\316V\330W\020\n\250\302\305\235\261\0248LaYnV\350\242\001)\331d\2632{\263tI\020\nX\274g\255?\0025kC\263\270\255\331\007s\350,\315\356l\005\313f\366\266\270\025@$\b\005\f\272\3700\311$\364\242\\\232\331\207\311\237T\202\360s\333o\321\330\3604\007x\250a8\211\0243b3#\222\244\2254\006\240\002\021\271\262m\020PV3Z\340\006R\0308\371\\\"\220\\\022\343K\\\262\345G\262\024\320^\254\214O"
+	.ascii	"H\314\231\262\243\246\357o\323\213\330\324V^i\331\202\207\005"
+	.ascii	"\226XC\243i\327\260\r\346o\270\305\034\220\220#\363\0079d\263"
+	.ascii	"\034\320\303\317\240\201\004\221\017@*\343`gf8 d\271\211\223"
+	.ascii	"\252%\302\212'/\0238\307\021\271\257$\334\254#'\027\210\024\320"
+	.ascii	"\203\242\303i\2231\277mDoE$\273\025[\206\302C\001\245\351\355"
+	.ascii	"\342\0256x\265\035\211\242/,\342i\005\260\236\203\332\224\374"
+	.ascii	"j-}\217na\346\221Q\222]+M\032B3\257\032\301\366N\314\332\342"
+	.ascii	"\016xuo\276\367L\341\356#\372\255\364\375\224\255\364\325\350"
+	.ascii	"\305\341$\016-\\\035\027\216k\316\360@\200\223:\206\250\254D"
+	.ascii	"\376\216x\355\013\243\006"
+	.text
+	.section	.gnu.lto_gyroGetAverage.191.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\313\002}\023"
+	.string	"\226\245\201H\300RN:\340+\366q\273\034P!~QE\2524\"\364m\325\371\364\241e\271\345\272(\200\352\315{T\315\254\255\177o\265~\374\207A\317\025C\370o\212\242@\3709\307\t\230@i\220:H\317X\350\227mdo)S\nl"
+	.string	"d"
+	.string	"t"
+	.string	"n\331V\265/\364\241\234\023\341|d\316\237\025\2749w)Fa]z\367\222\357\222\365"
+	.ascii	"\337\245m\037@\220c\332w zH\234\232,\024M\315\271\003\367\003"
+	.ascii	"Mi\227q\225\346\327.\257{$\n\252\352P\303(\347\363\310\362\371"
+	.ascii	"\306\222\236\020\341+\207\213\004\244\224z\\w\345\311\335TW-"
+	.ascii	"sNk\230\313p\177\267\315\300\266\001{W\002\353\232\357+\001\305"
+	.ascii	"\r\234\372\260o\342'j| \317l\364\341\245o\363]~\257;\n\215(\034"
+	.ascii	"\033\2064\330\264g\357j\272\036\354_\247\363\204\344\375\261"
+	.ascii	"O\364\217X-\022\325\257\250\016\211jWT\267\242\032$\252WQ\375"
+	.ascii	"E\265\214\352h\365F\265\256\372\002\006\310\340\t\235\007\323"
+	.ascii	"\234=\275\2529C.\211\260\235\343\337\245\213\252\265\366\313"
+	.ascii	"]\200lk\265 M\267\224+\361V:J,}k\303\216\2449\302\035\307\360"
+	.ascii	"\343\002\207i"
+	.string	"\263\364z=ps\332N\344~k\002\2653\"\256\256\334\3574\335\264\347o\334\017jG\312\246\275\002?J\340\263\270\021\214cd\364\241\314w\251{^P\024\325R\322\211=\363\024Nb\3159W\374\242\0071\022\033@8\337\245\203\240(\022Ss\316\0310\030\027\031\354F\301\r\313/*1Y\005\030p&\213\315h`3\220&\306e\006|\221\315@\025\023\307&\300d \205XL\006\266v\363\373\343\353\316\252r\232R\221\024}\332\347\335\025Y\036\333\"\353\026\333\336d\211\216\254\275\240\201>\264\353hH\212J\n\2675\026\235\247\026\021\200\332\020\"\350\303\335\335\232_k\273\334)d_\256\ry\361\0300\364f\n* \200\"\221c\353\001\336\004<\370\306[i\357C\215\261S\264v\257\226\317 \016\343\037HD\214\306] ya_;\234Ax\f\030\016\217\306=\020V\211\335i\335\232\177\0227\245\307F"
+	.ascii	"\020Xnp\333\211\376{\226FqZ(\307\362\n{\003\257\203*\222\261"
+	.ascii	"\352h\273=7A\235\016GH\271\326\253h\f\017\n"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.192.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\255\f"
+	.string	"V\226SA\360R5\035@\317#T\222\020Vy\356\323\025md\230R\354PB\003\251X#\372\013\356\367\212\217\326\b\355\212\034\314\b\033E\345\026\317I>\207IC\314\336\013\335\316n\232\024#\235\353\336d\357\224\002>"
+	.string	"A"
+	.string	"@"
+	.string	"\273\273\021\370D{\235\227h\2574\305\277gt~\376S\227\300\"m\204D\360Y\211\323L2r\301\006\210\237\314\001\314d\342\251O\021\242g\316\020\b\273\353\031\022Ew\275\355\b\266\037\330\347\004\224\344J\247\257QN\270D\347\341cwD\031\333W\315\261\302v\307\216\330\236\323\376\3510:G}x\201\335\220\274\261K\242\342\006"
+	.string	"^gi\027\274l\373.\376\242\343\217\001(\004\025\354\210\205`\375\b:\306\327\030U\227\301U\306\335}\350\342S\277\305\242|\201(8a\246\021\016jO;\255\260\352\361\231Alk\370\312;`sx\252\303\204\334\335\313\353)GE\331\342\024\316\322F\201\223\242\260\237m\035\347m2\023\002\030c\341:\017\0266\257\343\274M\306\3336\027(h6L\347m\026\003\3462d\272m\003\307u[\004\265\317\226\222*M\020R\217i|\bF\312X)\210R\f Yd^\365\026\006\001\244\3463\276\007\033"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"\273&\016M\264\225\006v\312\004I\352\032 \325\266U\202N)\324"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.193.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"m\t"
+	.string	"\326\320>:0\345(\035\200\317b\037\025S0D\020\017\nh\362F(\242\257/=\205\346\370(\350\332O\210\026\001\r\200`\366\230\252\002\002bThY\277\373\r\205\222A\030h\237\354-S\n+"
+	.string	"/"
+	.string	"-"
+	.string	"$/\273;c\307\273\313\250\235\177\221\013|\240wI\360\230\201#\211\260\273\003 IU\263\260\273\326\017<\335\330m+\330N\260/\003\321\301%\004\305\322\020\351\313\016G\0329\354\313\215)\373\352c_\241\230J\247\247\260\354\232^"
+	.string	"\326\205\231|\330~\346\316^y\250\332\202\026\306E\227R\2436W\241\377\034\243\027\240\332\214\335\335|\205ry\032@\243\0172\217\f*$\215\261\317\372\210\205\357aPH\377\035\363C\231c\017\356p\264\r\0041\271M\343>\036n~\"\036$fg\343&\307\300\332\204g\233\024\232\266\315,\024]nL\271\341\244\004\246E\024G\337\330V\td\303\335\004\023"
+	.ascii	"3\241\025(\006\213\001\217>\356 \0310Ak\3736&V \002qC\004\203"
+	.ascii	"2\204\355\232\210>\004\3622\204\270t1\333\351)\343\273\312\023"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.194.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001@\003\001Z\301\304\244!r\f\302Y\227M\363\331n8\030 B\254\265"
+	.string	"\240c1ua<\004\261\001\225B\300^\272\273\274\013?\221v\2232\245\276X\334\32344\370\034\314``\31380<\264\313\203\315b`\007\201y-\302\271\327\246k\257\240\324\203J%\354{\374\212~\2065\233\274u\346o\244\263\324\200\212*G\366E\245^\330\247\254\202l\247S\0134B>\027\201\354R\214N\266\204\215\204ls\354\311\3378\007\307\261\322\251(\004\222\320\304\207\311\3566\201\023Hg\371\001\351L1\036\237\321\177\307\027:\"\021\313C=\001\024v\327iy>\267\336v\202\355\212m\213\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.195.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"u\013"
+	.string	"f\326N= O]8#\352\371\221A\n\250"
+	.string	"\266\036\230\222\031h\001\324\304\275C"
+	.string	"\222gh\225\272?\341\352a3\256\204\335\325\b\t\002BH\245Y3\220\335\316b\300*\306\340w\340\322&R\246\024<"
+	.string	":"
+	.string	"@"
+	.string	"\006\034\317 \230m?u\225\307\237\002\"P\030A\241\032\261^\354.\247\361"
+	.string	"\332\263<"
+	.string	"\355\231^\370\347\371\361\337\341\tD-^b)|n\bv\327)\226L\267\3366\001\333\022\373]c\230j\301>\266Z\301\333\307_\303\322\230\246U\323\251\351;\236\322@\232`:\013\027\273\244\027\214M\221\2712\330\366\330\017\333\231\366W\347\340\371h\023\316\330\245\260\241\304\356J\034\022N\204,'\341V\205bw\037q\241\234B\\\004&\243\311\213\032\255\240V\366w\020nEN\273{\300\336\234\345\tX\261\273\024\017\377\320\300\307\360\314`'/>\363;\332\263k\004\345\002\345\313\016`\346\201\005s7\361>\b\030\016\374<\220s\0019N\306\262\341\272\017\344&\003\3541\270|\234\003\317\373\270\307\270\367\246\020\220\206\214\351\246\037\305\330HU[\301\002\355\"\246\220\b\032:\365\252z\025\001\023"
+	.ascii	"2\003\302\260K\273\232\307,\003\241!X\022^\016\002\252Scf\263"
+	.ascii	"\\\020z\314\346\".\2140c\315]Mw`\214\200&\214\224\024\3235\311"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.196.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016\244\004\276M\020P<J\335\215\266)fi\315\r\377\371\3077\354\337\355\325\243#\224~\361\317\316L1\020\211\342-<\f\b\352\251q\213d\313\024c.\356m\036\032\365\034\245\311PM\003\341\020\3210\217j\027\203\235D\346\265\t\347^\263\\Y6Bv\360a\024_\220\206T\227\343\r\007ku\272\234\200N\310\0060>X\372\313\203,\343\013\220l\364\343\310\n<FD%\241d\202J+y2\221t\374\235\267\254\260\320\271\352\265\001\"0)\261\020Q\311\274\032\323hU\254n?\332PAJ\261B\236\242"
+	.string	"Cf\216VH\324Y\177\204?\341\277\b\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroYawSpinDetected.197.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016\244\004\210.)\314h\314\236\237\245\235\27757\374\237~|\303\376\335^=:B\351\027\377\354\314\024\003\221(\336\302\303\200\240\236\032\267H\266L\001_,\356i\036\332\364\334\224\301L-\003\341\020\321.oj\026\203\235\004\346\265\t\347^\253XY&Bv\340a\024_\220\216\250\333\261f\203\255*\335M@%d\003\031\036\274\336\352 \323\370\002$\023\3758\262\202\321E\250&'\231\237+%I$\021\217\237\363\225\025\0268S\2658>\004#%\026!(\231Vc\033\245\212\324\355G\033*L\256\n\324)\n0d\346X\201B\235\365G\370\023~\214\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.198.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\265\t"
+	.string	"\326\322C<0\305*\035"
+	.string	"\360>\353\025\317\367u\036\3501\355\343\256Xl\224q\251\301p"
+	.string	"WDa\021U/\352\031\007h\321uve00Q\303\217*D\2765\346\207\207%0\252d\023)S\n3"
+	.string	"1"
+	.string	"1"
+	.string	"&\237:\252\024\252\323B #F\333\r\273\202\037p\217y\003\356Q;~z\236\374\227\334A5\233\261Z\250\347@\303\356:Y-\327\255\267\235`\333c\037\023\233\246S\323\3474\260\024\327g\001v5j\005\366%\312@l\233\354\214\355L\373$\207\231\036\232\305\004\273\033#+\273\353\261\002\346\221\263\331\366C.\022v\305Q\254\262\021\260\273\f\266\367\230\204\306cw\027L~\002\372\037\217\246(\345Y\217~\211{\274n\006\310RY\263CT*\207\375m\365\345\370\360\017\340\310\002\2649\364\361\276\213\207\016\374<\220$\002;\322\b\004\321\205>\260\373 \330\213\020}\335\204\347}]&\334o\253\257\250\234\224b85\352W.\327\324\003X\321\002\r"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\\\023M&\032\247\006\351\300"
+	.ascii	"\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_gyroReadRegister.199.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"E\n"
+	.string	"\026\224G:0\255\246\0033\022A\227\252\361#rD\3168\0071\026\300>\360\221\027\n\357Lq\272\231^a0\203\273\223O\323\001#<\261\230\022\320\354\326\001\253\230X\017\323\205%c\357\224\0026"
+	.string	"4"
+	.string	"7"
+	.string	"\037 \273\346\201\r\002\276\3316\202\206\344q\340T\242]f\023(\331\271kz\225\365\361t\364\257\361\205\3239+S\245\323\212\302\356\232\226)\325]o\033c{c\037\023"
+	.string	"[-lSs\177\375\365\260\237R\352W\004H(T?Ev+j(;\262\205\270l\337\243\233\336\270d\347\356v\267Ivg\303L4\224\3765\272\356\256\002\344\313\307\334y\307\347\322z\314\016\227\2016\254\222\325kw\0236\316\001\372\030\337\f!\322\227\337|\221\223\020\321\227\\-8\325\222i}=*\205\2445\3334\321za?\235/\254\f\036\316\307#\352\314\311\200\341\250\343\211!(\206>\321\013}\032@\036'\024\275\f\201\301\207/\364\"@0\364:\223\274\271\332\3212\316\023\262\232l\241\257\217\335\343\263\264v\003\017"
+	.ascii	"\306)Efh0\242\fs\237\232\263\332\0043\365\302pM\024d&\004(\f"
+	.ascii	"\f\001s}\006\236\236\007M\355|\002"
+	.text
+	.section	.gnu.lto_vStdDev.0.228.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375 CU\001"
+	.string	"\024\0026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\002"
+	.ascii	",\214\017\240\b"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.part.0.242.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\363\002\355\024"
+	.string	"f%\202I\320\362&\035\244"
+	.string	"\"\025\020\2670 p\253\203\004\336\277\n\013@3\222\336K\031\374Hw\207u<\315^'7&\201Q\"\333\362\217\033\226\337\360\023\274\020Z\302\224\203NI\2239\356b\321\264\314\276\0164\212\322h{\357\235Rg"
+	.string	"n"
+	.string	"l"
+	.string	"\337k\210\224\362c\370 \032\222qsn,\245\375\026\007\022\037D\363\001\2739\247\243\335q\301\253M\276W\217\037Y\275~'\260z\265\277\302vxc\321\326\361\021\305\222\350x\036\204z\354.\370:O\\\374\224T\364KvC8\234\232\3173=\202\211\240)\034\216\210K\221S\220\224\335\3657\342\256\267\355\300v\213=%\004K\277\322\237\364#\235\332\267o\024\372IW\372\322\231\314*\ny!Q\210\024\312\225\275\351\034Qyd&\221=\b\036:\036\213\350\023\235\367\"\263f\314\376\341Gg\324\333\035Ud\324\350\356\376\243\253\361\363\340{\365\207\276\023\037\243\366\315Y\231#\247k\352\355\256\202W\243|\257\007\250\251\274P8\356\ru\361\027\342a\330d\310r\260\331a\020\263\306\376S\214"
+	.ascii	")\234}\3418ZN\244\2344\270\370>4\253\327:\217\323\221s\316w\350"
+	.ascii	"\265\336\344\372v\267\201o\3437^|\237W\277`\344q\257>\314\352"
+	.ascii	"\365\023\245\004\225\017\240\233\254\242\361\361\254\311\353"
+	.ascii	"wSOP5\222J\316\036Oz\2723g\003\220\256\037\177\372I\317\013\375"
+	.ascii	"\022D\372\237\334I\260\263\033\242\352\307\362\324\244\024\017"
+	.ascii	".\031\033\215\322f\257\332\214m\202\255\005s\325f\\2\225\002"
+	.ascii	"4\b+\330\313\345\205nX\301 \223\241R\b\340\326ILf{\001g\262\330"
+	.ascii	"\f\346\232\201\260\227K\f\330\222\315\300\023\003\216\311\270"
+	.ascii	"d -\026\223\201,\333\362tg\316\337\016\034\250\333\264\211\032"
+	.ascii	"\021\244l\224\356\251\267\343\234=\266G\244_ae\243\253\270\261"
+	.ascii	"\200Z\323\335[\311\347\234u\332\026X\344q\246K\"C\250\221T\203"
+	.ascii	"\f2#F\301LFA\332\034\200\002\231+\2728\021\260\3012\n\264\311"
+	.ascii	"\260\006\232\312\332\331\361\215\bO\365R4/\365\212CM\266\262"
+	.ascii	"\334q\r<\\\226\302[\350\366\272\0330\245\275\001\316Xs\031\241"
+	.ascii	"!\274\210X\344'5\252\023%Q`\377LB\177H\017\024\206@yR\026E\252"
+	.ascii	"7-h/\313Sz\365\3135\234do\240\202\315\305\3217\245\266'\357F"
+	.ascii	"Q\235K\207\034\251\024\342Hm\340\262uZS\343\2540\200Ha\035\245"
+	.ascii	"\321\0231\032"
+	.text
+	.section	.gnu.lto_gyroGetAverage.part.0.277.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\316\001=\021"
+	.string	"&\341qG\340\262(\035\220\273\243N\220\b\0066\364I<\003\032 >\334(\003\3329\202\212ysY\375\353a=S6;V}\272gA\306Y`\306\203'\306\030c,~\324\357\357\246\313\251\343\034\n\262w\203\025\304\222\275\345N)_"
+	.string	"]"
+	.string	"Y"
+	.string	"\007\331X\366\350\363(l\"Y\315\230HXn=\224\311\030\250\325\270\300\023\264\033v\237*\302z\031\336\032[\237R\343\326\362#\314\253\345St\232]\346\334"
+	.string	"\335\300\341\342\305\341R\016\330\335"
+	.string	"\257\027\331`w\337\363\030\363rE\005@b\303#\3107\321iw\315u\270E\267\255b\333\201\035C\002\002`\2732C?\366\303\2341\342\264_\347\321\276\277\342;~\217G\264\225I/\341\276fx\316\202\365\026\246\361\325\260\317 \253\345\340\261\273&\356\223$\217s\037g\345\317<\322Y=d!)\206u\305J\237\326h?\347*X\017YN`\227\206\366\263\033\212|z\001\367\351\360\007\266O.\032c\333\"!vt\274D!\353\345\356\256j\3146\203_\243\206\360\330\360\261"
+	.ascii	"s\211C\266O\002\333\025\036\303>\nd\273\373\300\177q\030\240"
+	.ascii	"o\363\351\t+\3610\237\376\312\366\371\236\227J\354\220\301R\004"
+	.ascii	"\271\342\220\365\272\273-Qc\326\355_\245\261\035\255\361\264"
+	.ascii	"\373\234\254\t\005\340\t\005\224L\231\240\276\224\n\004\025\316"
+	.ascii	"%#\336\307b\322\201\237\007\242\244\300\016\345\004\245\352J"
+	.ascii	">\260\033A`/B\352\353$x\336\327\215\376U\032\177\366\002\362"
+	.ascii	"om\2521\352\223K]\246\306|\230\250\311\300h\253 \354\2536\377"
+	.ascii	"\3472T\276\215\275\224\224\331\247\207\033\240\023=.5\346Y\263"
+	.ascii	"\225>\252\211Q\037' P\002a\216r\033\257\216\201HF%P\200C\220"
+	.ascii	"\323a\001_\212\201Y&\3300\353\020f\202\b\335C|\2305\334\017\021"
+	.ascii	"\005\f\035\036\302]\237Yp\003\271\201\003\306\204\232\332X\227"
+	.ascii	"k\334\245\247\005\343z{V\226A\334\302\312\210\032\240\323\320"
+	.ascii	"p\\x\007\245\023\347\006\351\356\275V\341\001"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.part.0.279.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\177\002M\024"
+	.string	"\346b}I\300\322Q:dD\373;\265SL\346\221\255h\206\306L\252\341\r\266m\355\fD\321\246e\341\232Sp\245\201|\314.\323_\002\334"
+	.string	"\233\226\336:\237A\037A\021\0049\bP9\020\216\340P\0340\222\255r\372#\262\311\226)\005e"
+	.string	"g"
+	.string	"i"
+	.string	"\271}I\370\271\340\351#\341\354~\020\315^\255>\277\3026\315\3061\366\216\353p{\240W\263\201\347cw\305OY\3421\237\240\3240\306\327\\S\355\363A\007Q\344\220v8`\334@\034T\333\r\347\022\034\321A\202\022p\243\001\031@\375\2108\357\332\3416\243Z\340!\310\203\335\265*\304\rr\333-\333\rl\355\005\007ww-y\354P\255S}"
+	.ascii	"`\317g\300\210\335\017?\251\335\2312N|w#\232c\252U\"\341\220"
+	.ascii	"C\263'v\361\0273\307Bj\020\366\206\223\224"
+	.string	"\357S\344%>\213\363f\027\362\211~\223CR\261\273\253\317\035\355C\262\257\006\233\t\275\232\223OK\265\257{\213\331\207d+\273\332q\222\362\355\332\240|\332D\365\251\001\001r\264\316\024;\023\356I\270\242\317p\241\340l*\3227J\361{\312 k\226W\250\037\235%){l\267\204\227+;\0354\372\303\347\231\345J-\tx\256p\"\227\222\034\273\253\362yy\336\301\036>? \241'=\206\3147\341\021Fo\373\364a\302O\00292\372;\262M3Q\231|\352\321\222/\312W\323)\225=\226a\257\021\366\342\222\020\342V\312\370\222\261\210\260\327\b{q\301\304\227\026\226\213\330z\301\304\024\004\036-\270^\342\205q|\211\253\203+y\034\201I)\312'#gl\350\224dqz\036|\253\273NM\225\276\323k\304(\260\3646V\370)\247l<d\340.\t\007\337\375A\23779$ \337\220\376L#\246"
+	.ascii	"g@%\206\034Q\224\004E\364Eob\005? P\0021N!=\230Q\254\bgD8\213"
+	.ascii	"Fl \340\356\031\371\220\321\016t\335\037O\240i\222\306\001\266"
+	.ascii	"V\254Q\312\361fp\325\202\270\212\206\231\275\362\201\254c\004"
+	.ascii	"Ry\214#\353@\354\225\214\320\026\264\035;/\033\0301b\013\374"
+	.ascii	"}2\373\325e\307lF[\204h$\023\255a\266A\034!\326; F\024e\352\204"
+	.ascii	"\246\321bM\203\317\352\257v\315\327\365\305\277\033e\r1<^\320"
+	.ascii	"C[e\373m_AP\236x\303h\003FS4@\367\3329\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`>\013\r%"
+	.string	"\326<\330CP^N:\200\343\350\301e!\210\271\2079k\327\335\377\214\336\301\307\020\220\335mM\341#R\373\021F\265\212\304B\3241L\317\201\031\230\201\004L\002\274\221a+\027\260\244m\334\221;Y\261\325\032\261\233\244\035\304"
+	.string	"\275"
+	.string	"\310"
+	.string	"\37529\372aP}18\372`\351\202g=\275\251:\335Jm\352{a\352\177-\365\275n\364\267\244L\266\215\215\276\226\032\227\24228\025\032\235ZIg\374\211\332^F\247]\205b\364\273\fa\364\303\244/\372\316\002.\372\200i\213Oa\361V\315\354\212_\2518\226\232\007\007\007\007S\364\337\240\350\253I\361_4p\357D?Mj\342Q\022\374UK\234Ken\255}\221\350\237IG\034O\025\361\264\020\337R3\013\342Z\352\0040\301\277\017}7\351\303\344\302\346<\364\3014xU\207\376\263"
+	.string	"\207\267m\350syK\245\341]j\206\376\330\220e2Y6\0307\306mZ\027\262,\313b\350\243I1\306D\025\002Y\372t\260\364\331\256\364\337\254\364\243U\372p]\3758*};\\\375;S\372z\266\372{\264\372|\262\372}\244\364\363\242\364\365\260\372|W\375>(}<O\372{N\372y\254\372~M\372w\315~]\333\237\253\352\3231\373rT\375:g\373\320c\2141N\352\276\333\231\024\251\230j\311\253\250\030\037\211\232\222\322\001\245\344WT\214\227\246\226\234\246\236\244\236\242l@\005i\200\3376\223<\213\212\244\217v\244?\307H\377\254H\337%\322\2273\244o6\325/\223\352\307!k\342\265E\365\311R!\207\242\006\271\023 o\242\246,\313R\375\350\303\361\321o\323\243\317\206G\177\315\216\276\231TG\311,\300M\346\325]\237\311\234|\006h\215\311\\|\036\003\002~\211\303n\311\234\204C\346"
+	.ascii	"m\0342\033\353 s\361-\272r\310\\lq\0322\357p\327\216\031\352"
+	.ascii	"\245s\314PO\034n\323\373U\315\325\034\323{\"A\253\027C\217\231"
+	.ascii	"\251\375\321\240\2544\334v\314E\357\001\224\321Ua\267c6\276l"
+	.ascii	"\307ll\237\361\3331\023\333c\350\035\231:\034=\346d\340\211\242"
+	.ascii	"ubC\302\241\334W\256&\241!\341[\265\241l|\316!f\342\363\031\215"
+	.ascii	"\256\271\205\321\210y\350\3423b\036\2668\215\230\213\256\253"
+	.ascii	"f\342\373\203\t\376\275\34135\277=\366\0036\246\0136\313\031"
+	.ascii	"\301\205\254\234\234\271\364\377|\365\375x\365\355\266\364\325"
+	.ascii	"\264\364\327\002xC\237\205\354F\001IB\036\022AXt\177\241\211"
+	.ascii	"\007\305|\020r\321\371\023\200@\265>\330s\220\r(\025\034\260"
+	.ascii	"#\263\303yJ\231\330\267T\312CWO)\177\354\251\237\030\226(\222"
+	.ascii	"\260Hn)\024\360\342\273e^\315\276(\227i4\220\317\013\343-\363"
+	.ascii	"\235\205\3622\0271\211\312l\354+\232\251\312Lt\016\231G\312\354"
+	.ascii	"dGyG\231\213\314\001G\013\352\216\362\335glw\224\377t\007\344"
+	.ascii	"\341\330\017\310KP\230U\230\344\342\2715#=\323\326\214\304<V"
+	.ascii	"c\223\203~\315K\347\223b]bx\315Ff\3115\0339\217\003\225\345\371"
+	.ascii	"!\327l\304\204;\256y}\177\275\2527PL\267\3463\237n\365a\325\r"
+	.ascii	"\255\271\351\t\227\314I/Rk\364\006\200\256\250A\020F\321\022"
+	.ascii	"M )(H\251\003\320\002\241\031\342\346\021\260\020\205\210\031"
+	.ascii	"\221\210\004#\201\230\210\036\027\260\037\331\366X\b:fy\344d"
+	.ascii	"\366a\320J\3720\222'l\264\001\361\200\037\020\221\312\256h^4"
+	.ascii	"\324\266\206D\331\241\001)9/\242\322Z\342/\264\330\005\007\320"
+	.ascii	"\330\006\232g!@\325\255\264'dA\375\234L\245a\035Ev\016}@t\313"
+	.ascii	"\377c\t\355T\317\272\371\003\013{}\347L?d\224:h\365\275\3745"
+	.ascii	"\354\210\304o\224`8\211\006\275u!#v&.8\036\3539\"C\312\236C\016"
+	.ascii	"\375L]\317\372SJ\254\224@k\221\322\005\245\210Z\023t%(Z\324\224"
+	.ascii	"X\251J\024\324E\315D\366\357\034\324\306.\240\254\224\364\362"
+	.ascii	"\327\2737\373,\326UUP\253\264@k\305\267]\312\034^2\037\213\032"
+	.ascii	"+\347\262k\265\311B(n\352\\UYQ\301[\320$\243\200b\240\365-+\305"
+	.ascii	"\037\252\020\336\300\023\007o\n\230\020\311\003$;)\034\340@,"
+	.ascii	"\323Y,\261\241z[\216\374\370\310+xp\302x 8\344\3067+W\260\222"
+	.ascii	"\025a\277\304\235\263,\273NM\227`G]#a\016\0345"
+	.text
+	.section	.gnu.lto_.refs.d2494d2c117f74cb,"e",@progbits
+	.string	"(\265/\375`\261\001\225\r"
+	.string	"VcZ3Pk\223\341"
+	.string	"NX;\233QUUUUUUUU\243\021\n\242\362\343\343y*\237\277\215\340\357\217\033\251\315\306\244\021u\267F\244\355\266Dz\233%R\246J"
+	.string	"J"
+	.string	"N"
+	.string	"\2256\304q\266)\375\013\023\276\205\251_\201\302\204\211\277!}\202\376\004{\211>\004\373M\377r\034\323\236\261o\227L?\3075\216[\216S\332O\".Ex\213<\024\021\202\266\260o\035\362<aO\366\243?\016>\234u\362\033!3\364G\305yQ\323#\330g\372V\247\030]?Rf\"W}K\177\322\227\372\255\037\365\035="
+	.string	"\204\341e\003 \205\365\023}\002\375\316\345)\025\237\252\227(\356\250g\021-\221\337p\\\243}\206\343\030\355\037\034g\2608\336\034\003\354\331\351D\017\360\347=\245\rt\211\304\333\343\020\273\322\005\036\363-\021\3017\235\276y\334\241\323\337\373\353}\206\363\230\307/\026\257\274\237X?\275.=.y\334qxc=\2228t\341\354\302\237\366\205\030`\tx\330p\276:p\250\201\367\005?\350\022\332Bx\356\253\003jpZ\334\200\263\342\f\006\235\r/\340\344\254\200K\256\217\256w\\\317j\f\307\327\005\327\\\374\302\276\272x\352\372\212\005\247T\360\351\275\304\270\344\275c<z\017\275\016\251\370\243z\007\305IMA\315h\004\374\t\033"
+	.string	"9\3619tA#\311\340\321\333&a`#ceR\023i\323& \031y\004\331F\334,\\\003&\240]\244H\tz~\262\266-[#\302\356"
+	.ascii	"\330\205j[\221\t&v\026\362\256\205\006\b\261P\302\330\240\344"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.decls.d2494d2c117f74cb,"e",@progbits
+	.ascii	"(\265/\375`y\223]Z\002\332\303\207\324T JQ:\215\001\035\306\235"
+	.ascii	"\214\224\360{ct\216F_=\332\376\275\217Y\375\334a"
+	.string	"\374\3644\377P\346\321\277n%\236g\215\261m2`\032e\034\320y\213\266mQ\213\"(C\350\342\270\256\352\252\212\025;\303\227,[\222\272\355\by`$d\313\275\267\224R\246\200\013@\r\244\rfx\211\224!S\260\032f\263L\274\206\231\254\341&8\315\336\265\355%\032\033\3709\031r\243OGJ\037\234\033h^b'<PF`\024\201[\256\351\353#\372\f\243]+6\"z\353L\363\320\3271\264\315\262=(\036\263ym\336\304\270\371\351\033,\2266\365\323/\372\351\026\375\324M\177L\023\375\246\227\266}\226\003\372\224\207\306\\\371F]\220\257\233\237\326\320O_\350\243ft\006\016\350\321/:\247\314r@-\024\333\203bm\021\023\325\343\346\243U4\336\201u\004\301R\356\300/0\016\354\204\352\204 >\232x\007\276\272Y;M\313\255\224\"n\317\256\314\007\356\201yX&\336\201s\034+\341%\237"
+	.ascii	"\304)\227:\037\035\242\217\332\320G\2530\216\0377a'|\343\244"
+	.ascii	"kr\025w\263\215?\246=$7\037\215\241\377\201\214\0302\362\242"
+	.ascii	"f\\\016;\241\322O\266\244\232hO\330\nO\341*L\003\327\260LL\205"
+	.ascii	"\241\216\243\260\024\033\246\3020\266\323Z\001\220,\323\240\365"
+	.ascii	"\355\275S\037xZ\342r\362O=m\263,\007T\002<\375\223N\377\274\242"
+	.ascii	"\1772\365\317'\372g\232\306w\226\003J\202\355A\177\216\351\354"
+	.ascii	"f{P\273\264=( \317\027\023%\034\256\277\273\344\276\301N\250"
+	.ascii	" \220\327%\316\205c\231\367\357\242\375\216]\262\022!\334\277"
+	.ascii	"{v\305\360R\231B\331\262\343Y#\007\343\r\315\377m\362\373\346"
+	.ascii	"\277J\256\331\365\313kSf\320\334\334\027|\361\304\007\230\233"
+	.ascii	"\177\352\320\267mm.\224\253\306\336\265\235ypn.\237e\3366w\355"
+	.ascii	"\227\355>is\227W-/Js\357%\b\037\020\026\350P\246A\363Us\311\334"
+	.ascii	"4S\232b\356\021\267\246\232[w\303`'T,01\233w\315\335\273l,\363"
+	.ascii	"\252\271\232\333v\267`'T,\344\2755;\200P\201/LS0\2439\265\212"
+	.ascii	"@U\335\374\023J_3\367\356\314\231[\3062\257\231\253w;w\307\230"
+	.ascii	"\271"
+	.string	"vf\202\177q\242\234\241\371\371O?\367i\233\325\3500\377\245\273\\.\0304\212\231\037\222\233\277\370\004\253\214\3555o~\306\323\267mw\327m\247)\303n\332\352R\346]/\226y\361n\2276\274kw\335\266\270|@\\?2k\266\320\374|\247\237\251\350\347)\372yM\333-\277s;`n\024ar\263\226\224\rN\217\357\346\347$\372\247\213\021\272\353\246\325\025\007\346m\353\253Yw\335\264\226\330]7-%^\356\244l\031i\266q\271nZ=\354\334\233\335r\335\260\023*=e\353\253y\345.\334\305r\343\356\225k\345f\271Tn\025\313\274o\227\tB\347M\223?'\022\344\347,}\243\\)\226y\271;\245+\213R\327\315\317W\332\305\336{\333\313\241\351\345\320\347\031\372\031\206N\267\345\200\276\351w\323r\264\266\316\200\334|,\346:yN\313\322\301K7\352\340n>\306\323\227\311\317o\023\022\212"
+	.string	"1\273\031s\321\307o\372XM{\330\226\003\2121\231\366\220e9\240x\315\366\2407\311\005\263\314\013n\330K\204p\254\224\306\243\003\250\004\020\316\315\307G\364\355\005\250\r\264\027\240\307;\264\362\277:\356\216{\204\347\353\351\253\315\315_\030.n\211\345\346\343\030Z\213\335\335\025r\203\\\256;\344\022\271F.\220\353u\273,\363\026\271[Zupq^\306\374\232\367\007\035\221\270\253\305eG\\\0170mq\027k\313\315Zz\243\274El\227\233e\357\332\362\032\2773\nl\251)A\376u\243I\364\2407\353\277>,[\0275>\372n~\234\355As\306h\t\262,\007\364\256\331\036\364\214\263=(\016!\2337B"
+	.ascii	"o\376\225\323\267hQ\207\303N\250&x\221\007\325d\213q\241\260"
+	.ascii	"\023*\rE-\252\271\367\362\377\245\272U\327\306\275q\255.\r\313"
+	.ascii	"\2745\356\324\357\276J\037\314\210\241\2745\256\324\341v\232"
+	.ascii	"2l(&\031J/\367i\247)\303\336[R\227\351\326\260v\367\t;\241:\221"
+	.ascii	"7\243\271\367\006\001\302\007\004\b\020 p\333\226\036_v\362o"
+	.ascii	"\232\376E\323\277I\364\257\362\312P\303\354\365h\273\371w\210"
+	.ascii	"\376\335\241\357\323\177\233\256\323\341\256\2164_|\334|_\374"
+	.ascii	"\374\302\260Pj\\y\271\231\001\266\007\315\260-\007\364n\333\203"
+	.ascii	"^*\333\203\376Ji\r\266\345\200f*\333\203\352,\333\203\3328p\240"
+	.ascii	"H\205\001\274\371\366O\3372\355\037\034\241\330\336^\334\233"
+	.ascii	"[8\177\211\020\016\227\2637\332\336\333\203\016\232\035\215\247"
+	.ascii	"\233-\033\353\367_\345Y*\023\307\306\315\277\365\263}\370)*k"
+	.ascii	"\267\355\275\324\240\266Y\2732\273\331\215\220\f\255J\215\233"
+	.ascii	"o\367\364\177\313\264m,\337r\373\344\300\350\3022v\363\255\236"
+	.ascii	">\337\341\376\253V\354M\211\224\233o\351\364o\263\334\256\371"
+	.ascii	"\255\025{\305\252\271Y\024\b\205pysus\323G3\211l\221\335|\353"
+	.ascii	"\246o\321\376\237.vM;\307eG\034\032\035\223.?vvJ-`\354~\274\214"
+	.ascii	"\3315\331\266\034\316\336\265Y%\226.\315\017~;Ww\270\035uo-g"
+	.ascii	"q{\357\377\266\214%c\317X4v\2145c\323\3300V\3172\255\030\213"
+	.ascii	"w\233g\277</\367n\332{\337\266\375?\267b\354\335\341<\304\330"
+	.ascii	"[\013\026\005il\240r\364\355\275A\370\200\020^\305=\215\221 "
+	.ascii	"\337\376\3207\313r@7\260=\350\255\225\276\235\322\267Q\3726\206"
+	.ascii	"\276}\241o\231\364\355\326\017\201~\f:\203\355A3\260=\250\305"
+	.ascii	"\362s\233\345\267g\026\255\007\245\272Z\356\266\2757\017\216"
+	.ascii	"\303\362\342\357\346k{\320#5zg9\2407c{\320\034 }\024\332J\261"
+	.ascii	"S,\363\203}\273\205b\333\2566-\367\332\336K\236\234\245\033o"
+	.ascii	"^n~\nz\305\322\016\341\034\350\333\017(O```\240\375\200\336G"
+	.ascii	"g`9\240\331\366\240:Y\266\007\375\235\345\200Z\265k\323\354\332"
+	.string	"\255\232u\362\022!<\247i\243\355\275\264jy\357%k5\330\261V\203S\316\310\222\032\232\277A\377j\233\266\264\034P\037.\333\203\352(m\017\372\245\345\200j\333\203\376Y\203\217\325\222w4\006j\017_\272w\376\351\t\377y\374\317\365\356\317\025\f\375\026\004ME\305-\002\345\317,\f\233<\355l\004\026\003\0264\360\236_\223]\002X-G~\353f\231Y\204\207\353__\360_\022\377%\300\177a\334\365\277\037`k\265t\375\247\261\313\237\365ig1\300J\177;\245\244\023\374\232\347\317-`\247\033\007gl\001%^'\335\323\352\376\277\035\203_\347\370O\016\270`4%'\335\177\337d\f&/\353\334r\212\340\314\031b\016\312j\3010n\b\360\225S\313\177_d\371O,\354\364\016^8\261\374M\f\034&\342\016\374\370\350\307B?6\302\0348\257\334\026\377=\300\226\377\264\362g\272\377\254\362\337\027\327"
+	.string	"'\225\016\316\267\037\003\375M\216"
+	.string	"\177Z\344\224\362g\024\362\257\253\212Q\376\253\300I\362\0034\374\032\352\277/r\003\2244"
+	.ascii	"f\312)l;3@9;<9\001\360c'6\253\005\006\013\302\323N\037'\324="
+	.string	"X\f\362R(\200b7\316\177\337\370\254\245\275\303\237&\375\367\315\377\264\373\367\337\245\021\234\370~\303\237\"\375\331\356\3077\316%\031\357D\373\361\b~\274\364\343\375\343\0319\315y\226\367~,\3444\373q\b6\002u\247\222?\003\376g\331\217\3512\231?\353\375'\331\177\336s\354:\375\266\356\277P'*\366[\033\277\345\361\333\033\277\335\361[\f\260\013\016\262\031\r\334\347\f;\211\200\375'\327\177\"\301\367\030\370S\023\362\b\013\330\371u\bl\004,\326=\222\211\374'W&A'\215 \374\365\013\277\355q\331\374\330\305Ud\021\324_\027\375\030\356\351\257\211q\330\204)g\220\023?."
+	.string	"\233\023\310)\202{\204\204-\353\366\237\f\370-\363\277\007\016\360\375"
+	.string	"\376\324\315\237\327\376\314\366\237Z\377u\363[\n\376\354\366c\032\347\217\337\212\370\357\336oG\374\230\0029\356\267\3013\313\202\200\302\211\365\237>\356\241\307\177\356\370\361=\210?\375\361g\262\037\3238md\264\263F\007O;i\374\247\214\"n9~\334w\316\370\317\017\244\376\333\346\267\"8G\210\202\372\317\302)\343?c\374\267\b\276\257\340O\313\374\247\004~\334u\302xq_\\\021"
+	.string	"\236N\377\215\361[.\021\347\260\351\214\005\301\351\307\b\270G\231"
+	.string	"%~\235\342?M0\375\327\357\277j\376\333\367c\270s\351\277\"\370o\324o\307.\t\377\375\300E\272J?\246"
+	.ascii	">r*\375g\004\266\002\232\260\3329\202\377\306P\302\177\212\340"
+	.ascii	"\307a\347\013\377\031\202\337\206\375W\001\377;\370\257\342\036"
+	.ascii	"\376\023\0048p\204?\r\374\363\220\337\006\317\017\340\t\374\370"
+	.ascii	"\311\025\341\317D\376k\200\377ik\347\371\323\030\377\031\303"
+	.ascii	"\177e\374\366\311\231\264\302\177\302\360_\020\374\326\312\331"
+	.ascii	"\242\204\253\310\025\344\374:\204\377\\\357\231\374\037\374\265"
+	.ascii	"\007?.\361\343\007\374\330\203\037\033\340\307$\3748\304\217"
+	.ascii	"?\370\261\n?F\341\307)\374\370\204\037;\340\307#~l\342\307\r"
+	.ascii	"\370q\001~\214\200\037\207\360c\006\374\330\204\037\237\370q"
+	.ascii	"\002~\f\302\217G\370\361\002~\254\200\037\227\360c\021?\216\300"
+	.ascii	"\217E\3701\211\037C\340\317.\376k\360\353\275?\353\370s\217?"
+	.ascii	"\363\370s\216?\343\370\363\216?c\375\230\311\237\265\376\363"
+	.ascii	"\205?\277\370\363\215?\327\370s\322\177\036\375\347\371\325\022"
+	.ascii	"\376\323\350?=\360\237B\377\331\201\377l\341?U\370\317\007\374"
+	.ascii	"'\003\376S\001\377y\200\377\004\341?\013\360\237\035\374'\006"
+	.ascii	"\377Y\301\177j\370\317\234\377L\377\023\377\031\360\317l\376"
+	.ascii	"\334\374\263\336\237\363\376\334\345\317t\177\246\362g\346\237"
+	.ascii	"\331\376\274\344\317e\177&\362g\256?\003\371\263\326\237\263"
+	.ascii	"\376\234\364\347\241?\003\375y\370\347\r\374Y\003\177\266\300"
+	.ascii	"\237w\376\254\342\317\351\237[\3703\013\177^\341\317*\374\031"
+	.ascii	"\205??\340\317\r\370\363\002\376L\302\237G\370\263\b\177&\361"
+	.ascii	"g\021\177\016\361g\002\374\231\203?g\360\347\n\376<\301\2375"
+	.ascii	"\374\231\347\317\302?\253?\016\3741\234\037\363\375\330\357\307"
+	.ascii	"h~|\346\307e~L\346\307b~\f\346\307y?\366\362\343.?\376\361\343"
+	.ascii	"\272\037\323\375x\356\307Y~,\367\343\270\037\273\375\370\311"
+	.ascii	"\217\327~\314\344\307h?6\373\357\221"
+	.string	"\037\277\370-\006\377E\376\227\001?\236\361\333\b\374V\313\217[\374\370\310\217\305~\034\366\337\244\377J\360_\276\377N\375\330\3768\311\217\225\277\345\372\355\330\217\275~L\344\307B~\274\365\343\033?\246\361\333\340\177?\370\357\317\177\025\377=\300oA\370o\221\377i\377\337\376\263\360c\252\037O\3758\352\307P?\226\361\343\030?~\3721\214\037;\375\270\351\3071\3748\351\177\212\037\277\360c\030~\214\364\343\365\307\311\037#\177|\201\037\243\3701\013?^\341\307\347\217\363\217\361\217\357\377\025\376g\375\247\373\037\"000\360\357Q\361\373\344\370\207@\020;\352\305\336\025\354\345\336R{+\331}\267\367V\332{\247T<\226{\353\310\360\244\224\222\332\373\312Gj\363P\242\362b\357\333\246\027W\365\264\266\225\365C\345\311\232r\303X*\331\247\250\254\255\334c\264\250\364\232\222\223\035\265\367\266{ZYEc\315\315\267"
+	.string	"\214\266\221\336\2708\240\222Xi\261\221\322\300j\312\344\330\272\371\026\260\245V\313\265\2757O\216\236\224.|TS9f\340\2568\24532F\023\033B\345\346[`\246\377T*\211N\203C\0063\212\347\311\252\211\t\305\344\032aBfEFV\223\306\300bj[\314\226\236R\030G\263\345\230\2351\205\355\305\315b\"\225\343\351\346?uJ\233n\230\275!@\322\2352\245J\351\222e\246MwC\213\203\025\027\270\243\r\260G\\\332\204\376\245m@wwVU\341\362\n\346[P\246o\301\230\276\005a\372\026$\321?\n\247\203&+S\320\336\370%\251qFw\363\262\tL\310\f\"}nZ\\]1\271\331\215\315\332\273\215\006[\231\2166\350\235\016k\223c\b_.\263skU"
+	.string	"\331\234T(\031<\035K{kN.Vi\330\3264s\236@55\233h\030T\214\275k3aW\367\243gP5(\0324\215e\242\315\214\343h\031\324\314\263\036J\206N\271\267\227\207\320D\307\240d\354\335\025\t\\\2704\367\366\362\323D\267\240`\202S\260]\2303f0\343\245\345\200\216`{\320[`D\337\361\344"
+	.ascii	"\236\345\375\270\371\026p\335\361X.\272/pn\276\005X\032\005\203"
+	.ascii	"~\271Y;\244\316\342n\316SS\206\307\343\346[`\245\321;\224\016"
+	.ascii	"\333\355,-\267R\332\225G\026\326\207\336\241vV\r\355\332#\013"
+	.ascii	"\353\363\202\342\241],\023\275C\353\356P.\026.\212\025\262\260"
+	.ascii	">m\347E\245\244\363+\300\323\257@N\277\202)\372\025\254\351W"
+	.ascii	"\200\246\177t."
+	.string	"\013]\2312Hn\276mC\263`\274>T\013\212\3052\321,\250\\F\263\240W.\324N\323rW\245\314\275$c}\370\311\213\032\0224\277\0021\375\n\204\350\037\265R\345\352\005ys\212;Z\345G\251\234\314+f\255\262h\035\271\371\264=\250\205\362s4.\003i3\225\004\356\202\345\r) \350\033j\346\207F\351\307\315\017\341\267Z\250\372\224@\202\240q)QZ\241QjA\253\322(i\234i\372\330c\213\221\227d\254\017\275\201\203Ls\256\207\026e\r3L\214\244\211\362\252K\323\316\361\230kjEQr\331jSj\221\202\323\374\301:\275\324\336\232\230\213\016:4\t\n\206>A\277\3202t\t\352\205\206\241L4\n*\005mC\325P%\312\206:A\215\240g\350\030\272D\327P((\032*\206*A\233\240L\3204\364\b\352\206\222\241H\320)\226\211\232\241]G\211\240E~\227{7\375\3748"
+	.string	"X\222\261\262(\265$c}B\316\224;\360\334\326\226\346\336\373'\353\364rS\006\231:\275\030@#\311X\031\376\372\255\226\247\323\013/\3434\f\266\251\246\026\214\024LI\306B\030r\305v\2242l\246<3\345\234\r<\267\263\224a71\351)\201XI2\326\207\312\200\242b%\311X\237\235C\315\320\034\250\031:\343\364\262w\\{Ii\204&[I\306\372\366^\362<\331Cs2\2211\225\345\200\226\260=\350;"
+	.ascii	"\352w\330\323\357PE\277C\232~\007\245~\207+\375\0161\364}\342"
+	.ascii	"\350\373\234\321\367\341\242\357\003E\337\347K\337'\207\276\317"
+	.ascii	"\326\247\240\251O\001\236>\005q"
+	.ascii	"\372\024,\321\247\240\210~\233\345\200\236\202+}\n\266\376\004"
+	.ascii	"h\364'\300\242?\301\023\375\t\300\364'\300\322\237`\206>\207"
+	.ascii	"7\372\034\316\350s\360\242\037g9\240\347\200E\237\003\234>\207"
+	.ascii	"'\372G_t \243\202%\004uRK\317\260l\2655}\360\013\303Tv\363\217"
+	.ascii	"2\241K?\342\314\366\315\250\322N\036\231\233\346\315\347\240"
+	.ascii	"DW9\367\354\236\005\324\032a\216-\212\205\253\032\201n\357\331"
+	.ascii	"\365-Y\322Q\355\331\365=9\367,\025\013\307\306lV\331\263rv\r"
+	.ascii	"\211\271,\373\304\306\315\335\355\331\365-\371\271w\3268\327"
+	.ascii	"x`z\332\233F\006tq{v}9\316\275\213$\b\232\r\374\271w\227\356"
+	.ascii	"\025vB\305\202\023\223s\357\226\335"
+	.string	"@\354\204\n\002`\2244\361\017\254u\356\341\255\223\n/\225'\2001r\356a&\234\025\344Kys\354]\036Wi\357\332\366\266\"!K\334\236]\337\233\023\360\f<\341\234q\316?t\237}'\233\323\357ts\362\235m,\363\334;\253~Z\2354\356\243\352`s6\306CV\343g'Wu\3639\b9\333\334\3224\303\234UN+z\312\253\0357K\306\031\344\fs\0169\241x`z:\251\3424\177\264\314)\347\264\234aN,7k\214\356d\276\241\261\021\346\244;\353\3602\356\0045\251\363\352\fs\3468u`'T\021`\212\032s\2129\321\234`\316\273\363\314\371\345\314;\233'\231\323\313\231\346\264;\361N\275\263\313i\346,c\231g\230s\313-\023\333\204\007\326\2515\026\210\026\345\212\355\340\275}\3009\245L\351k\356\275<\303\234rv\215\275k\313Z\354\232g\033\234\331\231s\353\fs\0029\265"
+	.ascii	"\225g\2303\313\026\354\345\fs^I\215X\351]\365\371\354\204\241"
+	.ascii	"\231c\343\340\274q\3428\271\350\220!\231Rv\363\311\345\364\262"
+	.ascii	"l\214\274\361\272\371\022\370\351K\020F_\202-\372\022L\321\227"
+	.ascii	"@\211\276\004>\364%\200\322\357\361;\255\374g\334I\345\324R\n"
+	.ascii	"\024\243\343\346\367\200\321\277\333\226\003\232\3233\247\337"
+	.ascii	"\363\246?\250\351\367\220\351\021,\007\364=^Zg\333\036\364|\222"
+	.ascii	"$j\tu\363{\252\364\255\332\331\344t\022\304\006\227S\355\374"
+	.ascii	":\231\244\033o\253glla;\323\3165\313<\325\376\253u\nQ;\271l\320"
+	.ascii	"\201\360\001\261\023\246\210\223$:\377\247\223\345\216\327\222"
+	.ascii	">5"
+	.string	"%U\314\224\25727\277\247\351\\B|\243\242\272\371\033\320\350\377g\331yv*9\315,\363<\215\0349\221\210\321\3601vz\215 c\333\355G\203\307\211v&9\305\322\215\267m\225\022\032=\232'\332Ivzyp\332;\313\307\006\2607c:\372\366^\246f\252tq\n\346o(\323\337\200D,\214MJ\032%7\303\235`N\224{\357\f9{cT2n\376\206!\372\033|\350S\251\234bb\271y)\214\363\021\245\306\315\337P\245\277!J\337m9\240g\327I\3042;8\213,yn\2218Q\324n\376\006&}\333\001\212\003\003m\007\3505\364\351k0\243\361\266\034P\035*\r_\264\316\362\374q\3668}\034\016\233\265\341\270r\363\231\365\363\363\207\360\207\221\251*7?P\003\235\316`\333\036T\303\262\312\251\303\256!sB\343v\3635\230i\016K\016\350\006\333\203\372Pu\351\373\265-\007t"
+	.string	"w\266\007\275\006\036\372\234j*\242\364\306\306\315\327`\245o\321\300\016\207\327\224\023\274\310+\303^a\230\f\257)\365\024\246#\267\307\027,\\\206\225`(\037\304B\030\202\273\360\374\262ZN\203\327\224\021\330\232\321,\363\303rx\016\257)5\214-\257\346\336\373\307\215\234\203GsK\366\303u\330\016\004\261$C\312\3720\220\037\357\334\314{xM\251\245\250\265}@\244\212\027\274\233\265\253\n f\365u\304"
+	.string	"I\206\224\225\341-]\360\035^S\236\260E\244\331\303\017\2039\234\223\223\002\200\341\355\343 ?\336B\326X\266$\270\f\267\341+x\251Tg0\031ij9\313\313%%\022\253\266\001\231\326\220\262>\254g?\034&\333\300kJ\bl\365h\236N9\360\224q6\3456\347R\206\223\001\317\031\247\324\t\225\343\234O\347\213S\351d\312}g\324\271\363\233\023Ff\223\371\262\233\374w\306\260\314\354\227\275\262\021\374\003k5\261e?\234w\263\360\232\362D\036Ws\357\255%\226\315\266\n"
+	.ascii	"f\265<.\362c\257\354\207\215l%5 \220\245\r)\353\273Z]9\f\257"
+	.ascii	")\325\251<\035\367\207_\326\221\271,\336\325^\322\"\001,\311"
+	.ascii	"\220\262\276\275w\020L\312\2157\"\344\274\306:Q\203q\344\346"
+	.ascii	"g\350\222\325d\250\2423\232\016<@\206,\201\271\371\031\322\364"
+	.ascii	"Z\236\202\227\312\023L3\232z\371L.c\231\331\314\233\314d\267"
+	.ascii	"|7\302\013*\t0I5\315d2\347\342\201\351i/\375 \201\344\215\026"
+	.ascii	"\223\276\374\204k\016K\347g\200\241\217\271"
+	.string	"h\351`\357\270\032\220dJ[\235\222\346\336\313\273\314\314Y<0=\251\240\305\255\271\345rmJ.fM\272\017\366\256\315D\034Zs\357e\276\313v\227\373*\313wy\256\303\316\322rS\241]]\200Z\372\302\3441\331K\006\223\363\362\227,&\343Yf\276\313]\316'l}p6\344\363\244\351\363\234\351\363\200\351\363\024\321\347\321\322\347\331\241\317CC\237'\006\0267\2454xS7\177\247\317J\276b\231Y.\303\275e*@\316(\345r\225Le\303\0312{\177}\370\255\f\03364\177\207L\377\231J\234\020pI\017\300\270\f\267\303\344H\024\220\233\277\203\245\277s\245\277S\245\277#C\377\371\311\363\224?;\311iYJ\007\242\304\240\203qsn\313Q\236\245d(;K\001!k\357\245,\205\347o\357%\036k5\260V\203l\266uD\n\232\277\343\2443\333\317\363\023'\256(\253\233;\260=\350u"
+	.ascii	"\365u\374\364]Z\016\350\007\333\203\346&:\252Il\351\346\353\344"
+	.ascii	"e&y\211\255zS\344FF{^\202\233\274\361x\302%+\221S\342ayRv\262"
+	.ascii	"\0345q\224}c\317d;l\236\242T\335|>4\306\016\031`\232d\260\263"
+	.ascii	"\b\330\326\315\327\t\242o\2319IF\022\242l\352J\371\214\344/\021"
+	.ascii	"\202U\023Naz\351\2729\027\311Gr\340\300y\001\345\310\227\366"
+	.ascii	"\361\365\267\365\225\275\262\221\247\017\320 \023v\263\316\016"
+	.ascii	"}\276LDU\003\246\013\027\021<\027\004\311\333\331\315\327\221"
+	.ascii	"\322>|0\224&%W\210e\346!yG\333\220\314#\007\261wW\313m\265\003"
+	.ascii	"E\215\230+9;\206\037\225\034\004\210\2351\243\371ts\336R\271"
+	.ascii	"\324\2601w\363s\354\364\237\177Xf\326\372\360\003\314\352\346"
+	.ascii	"\363\345\254\377\352\035\002&\315\233\233\377\234\365\214E\265"
+	.ascii	"\241\344\270\331\007\232*\274\264\233\237\343\246{\344\035\367"
+	.ascii	"\307\322\227\252\233\237\023E?\207L?'I\216+\036\251-#QW\031G"
+	.ascii	"\272\3264\233\272\3719Y\37295r\215[f\t\216'7?\347I\377\317U\331"
+	.ascii	"\31223\r\\\346>\231\006\026\203\365\354]\233\t&n4\260\231<e\357"
+	.ascii	"\2562\354&4~\315\275\267\017\b\020\366\t\026\3005h\316;G\215"
+	.ascii	"Q\346\031Y*SYf\236z\236\302gp\233\035%\r{\013\351SNa7\030\320"
+	.ascii	"\336\265\241\320\001\004\baT\220\036J:\377\31722\224e\346\250"
+	.ascii	"\034\243)?y`zB\201\r\\\216\312J\231\311\003\323\023\nW\350\232"
+	.ascii	"\332\n\221+]h\276\360O\377\371\351\031\206N\f8017\347\027A\033"
+	.ascii	"WwWn\276\260\231\235ng q\242\273\371B1\372\226\3713y\351h\212"
+	.ascii	"p\271\261\344\346\013\361\364\205t\372\302,\200\270\017\303\261"
+	.ascii	"wm&\354\364\232{\35788\32021 \376\003\304h\256\230\275\273\""
+	.ascii	"aK\231\346\316\021\260\263%h\276p\212\316dMP\352n\306o\260\337"
+	.ascii	"\326\321A\323C.\354\346\013\235\350\013\315\364\205cl0\237e\342"
+	.ascii	"6x\317g\271\267[\033\234\006\257\361\300\364\224\202\0174\315"
+	.ascii	"\275\227%B\300m0\232+\266\243\264\334SB#j\314\372\372@\244@\252"
+	.ascii	"4!\202\346\013\241\364\217\327\034\253\3019\236\230\177\3133"
+	.ascii	"\313\325\027#\270\211\313\350\311\330hn\276\260I?\370\247\037"
+	.ascii	"\334\323\017\352\351\007\355\364\030L\006\212\026\223\262\233"
+	.ascii	"\037\2742&\350\246\037l\323\017\246\351\007\225\350\007\221\350"
+	.ascii	"\007\271\264\335\370\316\355\346\304\375\275\270q\363\2036\354"
+	.ascii	"~L\207\271\3409\233Z]qR\345\346\007eh\022\226\003\212\332\036"
+	.ascii	"\324R\331\036\024c\301Y,\263\003\326r\213\005\007\371\271\264"
+	.ascii	"\334\3135\\LU7?\270\244E\260\267\355\200\332\300@\333\001\275"
+	.ascii	"\332\306\212\216\217\246\r\0327_\315\323\3771\025\313\304Up\024"
+	.ascii	"<\305\236Y\264\333\345~j\253\202\335p\034^S\2522\300|5\367^\372"
+	.ascii	"\200\b\212\261\262\331r\306p(\2221]\2017_\225\303o\230\231\243"
+	.ascii	"\344\340\332:\3371\023\315\211\027\366%\345\346\253L\375c)"
+	.string	"\277\032\254s\223Cy\363\325'\372*\230\276\252\245\237\360\320\350\001\345\351\346\253R\372\037\004X\316\316\202K\002\241\342\372\242\\\241\365@{p\211\335\216\313S\301x\254l8Q\336|\017\236\004\307\202cA%gPqn\244\272\312\036T\002\307\314c\342us\220\354\364\022>\231\001\376\225}\375+\0306\344\t*NW\251{\332\022T>\030\026\004\203\203$N\013X\022\t\204\005\201\202&\r\"g\326\006\311\325\313V\204\350Xrs\360\210\n\246\303\303\357\005\224\007B\202]\301\256\240\227\265\222\322\263*\223z\373\213R\344A\257\203\231\351\221\346\346 \221\277\030uql~\374\b\016\251\242w\245\202\220\027yB\036\034\202\367\206\345\346`\220\340\325\016\230\024\333\330\315A *Y\026\276)L7\237/\270\2453%\260H^p+\250u\355\206\304\225A\3170\207\270}\341\301#\210\345\223\205\305DA\305\225\375\325"
+	.ascii	"\244\363\361 \226PF\222=\246\233\203=T\260\253 a\370\254\004"
+	.ascii	"i\004i\004u|\220D\357J\250u\206\310\224`\216\007u\240\021C#c"
+	.ascii	"\307\315A\033\301\253\"Pf\312\004\257\2028\332\270\362\232\250"
+	.ascii	"\321q\212\262R$x\343\334r\005\306W\226\233\2035.\247\327d\314"
+	.ascii	"I\223\0313\202U\226\215\016*\216GLo\352\n\325\203U;ll_\326n\016"
+	.ascii	"N\251d<_v\250a\026`H\214\030\301(\233\266\247\322/)\274\261\276"
+	.ascii	"\272%\232\032\250\007\243r\322\254\360\364n\016\312\370\233\222"
+	.ascii	"47<\376\246\221`\2111\026\307\311)\b\303fX2\345\275)O+}w]\202"
+	.ascii	"/\036\204\201fg\355\312\233Z\b6\301\035\334A&%\3154h>i`\304\004"
+	.ascii	"\227\036dj\202\351\2739\250\244\216\271geZl\2040\323\346\352"
+	.ascii	"_\033\0250\275\342\263\231\232\266\217\256\0368Rg}}\373\211\307"
+	.ascii	"\007\026B\260\270\304\271\n\310%\220-NK}s\025\316\257\246b\300"
+	.ascii	"\320\245\335\374\020aZ\355\273\352\367\253\347\016\032e\302n"
+	.ascii	"~\210#\372W\335\374j\016\027\027\27357?D\227~\b\2555kT6;X\244"
+	.ascii	"\314\250\316hUu\355]e\203\331X}1\207\374W)\b,\002#\317\214\031"
+	.ascii	"\265y\334\264}|\241<p\224\215+ajSM\203\306\256\313\226\233U4"
+	.ascii	":\317/\b\335\315\007\361\246\236\001Q\006\346`T=\233\266\247"
+	.ascii	"\022@\225"
+	.string	"\006\255L\277\350\203BF\346\252^\0321\345\227:\306\217\355\357\306\030UL\232\226\r*6r\356\224eN\302`(\276\260-l\266\274xQ\363l\332\236\362\240&+\r\032\027\023\2150\025\357j\236\226ZF\265\201\250\252\253S\273\370d)\265A\377\244\216\254\351\273:\366\354\210\330]\355\002\370B\315\024\034\377U\022zE\276\326X\271\025\225\316'\013\237\001#\013+;\235\272\346\316l\271Jw\327T\241qs\263\232E\235\343i\202c\215\333\234\252eg)l\315N\273\270\234q\"\343\346\363\251X\376\253B#>\356\300`Q\345\230<\241\302$/L]\023\254+h\335es\006\312\223.pp*\025\237,%>\364J\352\253\206N\027+\270*5\356*\025\253\306\307v\307\304\f\312\241\250L\237,\f\206\t\025W\226\343f\365\206\313\355*\023M\020\256\313\337\276Y\235\242\222\245\261\032\333\273Y\225\022\245\215"
+	.string	"B\2324Q\331l\332\236\362\001K\323\273B\255\274\360\244\326\256\262\251xB\307u\263\272T\325\242\240\001\222\345\252\245\201Q\263W\205\343\364\202\302\203R\235\334)\031_\306~\020\340\311\314L]b\301\230\005\273\200\350\311\251hW\227\344\037cr\f\271Y=;\334\233\2231En\356\363\362R\313\2040b@\305\331\037l\2504\251aW\313T2/ft\254!\033{\323\202c\372Z\3335\250\210\335\255\035\250\031g\376nV\225*\276c\343\004\216\n\246&\331K[\342"
+	.string	"\026\351\372\"\243\"\271h\372\214\314\314\352f\365\310\341\356\2267\244nV\277.\224W\020&7nV\215<\305\222\362\307W\343\277z\327\360\316\356\362\210\020\311d6mOI\360'\265\325L\333\216`\361r\363?t\251BT!*\227O\226R\233\024PJ+I\337\336W\037\204md\354=\r\271\312\225\327$\314\030\250\377*j7\365\367\346\346w"
+	.string	"\250\177\025\210\n\344B\251{k\351\b6\243"
+	.string	"\337`8[\204\\\271\371\0350\365\257j\251Z\251\030\n\031\366\336r\213\333TW!v\232hft\334\374\016\226\300\271\332\224\235\3444\313\324p\324\254\037\246\275\364E\302\036\352\346,\220\312\315X)T\216)m7\277\003\245\276EsRa\224\231{R_x`zB\001MO\206\032e\357\270\0320\326\245\251\316Pm\330\273\253\f\273\351-MS\315\201\321\250/\310(w\250>\324\036\252\016\365J\345a\231j\016U\352G\315\241\306h"
+	.string	"\332\230\346\336\3130|G\356v\262\352\3643\036\230\236P`r\246\251\332\310<\324\032\007\340\022\365\246\257O\275\241\342\260L\325\306;\350\300!\323\307\004\315\277ZC\245\021'c\007\214\233U\2535:( 7\277\003*\375\253T\226\251V\301H\022\347\353fu\352gb(\311\200\352@\206>\007q\264\n\245\3014{\330\335|\016\334\350s\260\247\317\001\032}\016\310\350_\205\241\276X\333\302\306N}q\305\362\352\242\230n>\007`\264\252\2442\361\230\305\t\231r\363\325\245\377*\013D\272L\2719\253\373\322\035QJ\335|\035\2703\346+\212\223\233\257\001\247\004\262\311q\263\216\243_p\220\245\203`\2177\254\035\372\357:\316\257\313`e\226\022C`\03477_\037?\327\177vX\232Mn>\007j\372V\211\325z\327}ZO\373}\270\332V$\002\357x\204\310m_X"
+	.ascii	"\325\2478+Mn\326lt\033\355\346WU+Qy<n>\007g\372\232\217\013\317"
+	.string	"\210\330\315\327^\016\325k\256\367~5E\243j\212r\3639\030\323\327M\255\346Wq\034.Vb\334|\016\276\364u\232\377\352\b\312\374Pr\263F\243_p\200\325\201\252\227v\246\2106s\215\346\327g\360W\226r\243v\\\245\271y\307\366\240\272\314\317\265\231{\244\215\216\356f\035\333\203\236\203&0`\364\230\f\276t\211\321\024JI5\305\211\271\036s\305\260\330\306H\335\254\303\\\2612i\350\252\f`\317\213\027\235W\007G{\361j\303\241\361\256\363N/&l\2628}\351\322Ew\325\305Y*^\374\356n\376"
+	.string	"\342t]\235\356R\367\246SJi\036\211\273\371\0038\323szN\323\251$\324\241)\365\022]\r3\275\345\232n\003P4l\\.\333\240rVw\363\007p\004\013\026\235E(\327\334\263+S\023f\317.\013\330\0227On\376"
+	.string	"xT\251\242\257<C\016a\223%\312\327f\f\206\225\353+x.X\006\356\307\324\315\347C\227\332z\300q\271\371\003X\212\213\273Y(\325\tj}\315\r\370\364o\227vi\325\024p\033g\343\366H8\213\223\"E\273\271\021V\305\361\250i\002\307k\312\265\333\016\232\\\323O\017\n\024\335v\263\366\336/\266\2131V\334\232\333\206U\233\2053\203%\360\357\346o\200E\247\3514\315\206\025$\273\3239\023\370'\267v\315\206\201'`kn\326j\026.J\253\212\017\260\377jP\fH\221\260\233\277\301\023\275\324K\335\205\202\330\335\236]Yp\353\316\215\333\027\023&\272K\345K\2634\321!c\246\242n\376\0062\314\3144\232\334\216\031\0346-W\243\035M\3562c\243\214\232\f++>n\276"
+	.string	"\370t\231.\323](()\271\333\263+\333WW\037T+gf\204\334|\001\320%y\022=vK\265\204\225*\241\322d\256\374\330\023\273\036;\2734\377\002\303\316(Wrb:L\203\355\270Y\261\302\261\363\206\367\304\351\346\013\340L\251\304\3146)\031\025O\025<&\252\233/\200\"\372\332\313\352\257\257+f\227{*\001\313=\273\262\037\372\366\212\241\277.\242\213,\331\002\240\322\\\\\272\313\356\315\207*\021\006\261q%\313\315]\002\200\241\245\245\205\300\025\351\321\f>yb3D\210\016\262\223\340\005\t\242\201\244\231j:y\002\347\314M\217-\314\344\373F\361\341\305\246\311\343<t\326\335{oe\372V\346\251\251\023D\314\033\245,,'\266\0328\260|\304\020\327\203\213\025<\245m\2031\"\305\245{\340(x\212N\233\262\25567?"
+	.string	"tW\277\322:\264\322\336J\0316\023\0312\312}\305\343\303USf\f\356f\255C\314\034X\221"
+	.string	"\260i\0324\364\r\273\367\232\237\034J\036\037r\270\310\326\374n\276\241m,\t\302\004\316\206\256\221\203w\246\213\224\\\003\214i\016\310\315\017"
+	.ascii	"\231\376u\225e\352*<\367a/-e@e\357\020\017\300\017)=%\205\231"
+	.ascii	"3f`f\033!\225e\005\220lAs\363\003 \245\257\301\032m\231\032\352"
+	.ascii	"f\341\247\275\253FX\322\324`\213V\322OZI\307\3201\220\200mE\351"
+	.ascii	"%\275\244a\360\t\317\262\256>`*d\376\200\274\270\206\221N\231"
+	.ascii	"\361\307\344\346\363i\247\277\254\033e\264\223n\372\341$\346"
+	.ascii	"%\235\261\231\370)\271Y3i0E_\003\2618q\322@\036(\215"
+	.string	"&\340\323@\225j\217\313\225\006B\340\300I\343\260\2504\240j\246m\232\251\037\272\267]fMQ\365=\365C\223l\341Qws\352&\305\322\221\261F\215\207\0325)\237\335TmP\277%\233\247|<vc\330P\2719\335K\261\230C\350\254nN\327\\\316\314\306\r\247\f\334\350g\220E\337:\261X\b\026b\325|\266\222\032\022V\236\2369s\305|\266\322\232\f\316\242\224)c\341\266\3742\360\"C\246IV\0063\304\210\261r\207A\0340`\3228\273\007\310\343\352L^^\020+\200<08\363\342\345py\271\275<4\211\323\311\362\004-\353\346c\300\245o\325l\332\245\213U\263\313=%\201\\\226\226\020\350\225\345_\214\233\217\001\f\375\247u\314\264\016u\363\263i\003)S\356}\025B\007\211\031\033\323\315\307@I\377)\0353\245\273b6mO\005a\320p\343\243oo-!r\2344a\272n>"
+	.string	"\352\346\346.T\316\260\233\202L)\337\364\237fa\246Y,\034\n{\311j\003*\313\020\007"
+	.string	"\223*UR\271\257\340\022\345\225\247r9d\270\250|\334\234ZI\323t\264\310a\205\001\200\310\333[\032\227\356P\356\331\225\301=\215K\345\302\222\310\335|\276\235!bt\2007\037"
+	.string	"Smm\251\033\016\252\324\315z\375Qi\2719\225\222b]5\275\361rs\032\245\003Z\362\264n>\337\351\325\004\354J\310\315\277"
+	.string	"\216\376\323'\226\231>A\253\330\264\255\024\214A\003\315\233\276\275\257B\330,k\220\3301\227\313t\315\356\275\367\325VZ\023\002Y\226\332\323\265\274w\262\241\n3\345\346\363\245i:\312\346\032\2164-ur\253\270\004ysN\t_\204-\237n\376\005i\372O\231\374(\021\264\210e\246LR1[\265\367\322\025\211\275\273\363F\017\031w7\377\002%\032Zj\246\367\336J\313=\025\334\321\334\263+\273 \213\214,5\203\023\247\344\251\231\216\222\206J\217\233\323\262,\006\314\310\226\233\317g\207rD\372n\376\005Uz\363\354\274\311\233rss\032\006\004\307\f\252\233\177AS\232\204'\013\037V\334\315\367\320\247\377\364\353\226\231~\245\312\363i\357\252\r\316\250\256B\b\225V\264"
+	.ascii	"\2719=\002$\n\215\032}\017f\364\237z\3352S/tI}\332\333\n\204"
+	.ascii	":\252=\273\276;\375\247\\\267\314\224+%\242~\240BE\025\"\355"
+	.ascii	"\262X\324\334\230r\363=\274\351{`\222\n\201a\r\221-7\337\003"
+	.ascii	"X\032\304*\261\351\325S\255t+\235\312\240\244\265m\216\277&="
+	.ascii	"\232\233\212*\304=\024\321Os\244:\236\356\370\216\364\3073\354"
+	.ascii	"\275\231\366\366\321#\235[\356\331\365\355+\252\017\177\232\365"
+	.ascii	"\364\307\345b3\306\312\315)\217\024\353\277\252\263\364\250\""
+	.ascii	"\006+\365\001e\305i\016U\242\222\246d\355\346\264\307Y\265\244"
+	.ascii	"\245\243\315\315\347\273b\377\325s\253\215\031\270\233\357\241"
+	.ascii	"\206\376o\177\177t/Q\355\275\255\316\345\246b\312A\177{{Z\373"
+	.ascii	"\341\327\261\330\006\340\177\376]\254\260"
+	.string	"\3340\326\274\366\336\226\215\006\203[\332\221\301>\357\366n\322Rj\200VU\223\026\216\2475\255*\rOkZ[\251\351KI\003\325\326RzZ\333[CS\223\222\211\254\252\247\265\245\255\341imWm'\274*\273\227ZJ\273)kk\330M{i\257eUe\360\324\244U\365\264\266T\245\341iM\253j\257i\355\f\273i\211*F\323\246\322\260\327\264\324\354\265\254\252\fOkYUOkZil\031\250&}7\002\275\214\304\261j\236\232\366\f)\036KT\031\356\236\226Y{\314\336\266\355\305\246\332w{\007`o\036YTc\226p\3308\246\273\031LnKYv\271\367\356 \305\264\225\265\233\356\224\354\276{\n\313\332;\214ihK\355\2757\bJ\313\273\335e\357\224\200\360\b0\030\021\t!\213-$\220aG\347C\"\212E\306\365\250\bH]\223H\"\342\321x\342(\201\244\361\202b\n\023X\034M"
+	.ascii	"@\322\310\341h$\"\325\030P(\256I$\017\004\225\260&\215H/$\261"
+	.ascii	"P\\"
+	.ascii	"\211DH@DD \fN\244\243\242\036\244\321\nT\254\300j<\246 A\322"
+	.ascii	"zT\364\200\344\004\037\022\301\342hD\256\311\t\210\210\220\216"
+	.string	"G\243c\272\016\2131\030\223\350ZL\026\025\213\320\325xL\241\270\022Q\254\305\024\253\361\230\202\317j<\032\207\302\325xL\201\347h$\236\240\363\263\266\020\024\244\341C\"\326c\261(\bI4Z\261A2\207'\211\350\350(\303P\022\251\205\236\237\023&(\370\220\210\341\221XDDtA\007I,\022\231\320\242\030\244\207\222H-\264(\006\021\021\021\201\206Vb\321\b\030\214\220C\253\3211\025\"\026\211\362\232<\032\001\235B\353\321\210$B?$\"\td\\\223\306\225\270\246p!IT\201,\022!\005\025\207\200\222\036\212C\242\004I\026D\242\023E\242\025\304\244\321D\221\005\007c\213\242\211 $1\350H\\S\264(\006I\240\341C\"F\030\031)@\217\214Z\030\341\241(\224\256\306c\n1$]\240g5\036S \256\304\013&\260\026\035\020\024T\202\004\037\022Qt\201(\004\342\204\242\013D\241\235\017\211"
+	.string	"\032\026\213\214\353\021\t9\002H\b\203\265\230\"\370!\021*\250H!\305\210\f\\"
+	.string	"2\"2\241\21042\201'\351\310\310\004\236\365C\"X\034\215`q\324\003tD:!<\223C\026G9\353\360\310\342\350<\2628\302\305\030\214\311\234td\004\224\221\353\021\276N\022r\230\006\025\223H9\231\236\270\022\203\206,\216D\354\f\213+\221\350\250\250\250\202\305Q\005\310\342\2324\262(\242\b\"\026QdH\256(\001\003\311#\023\305\225\210B\270\026O\330\320!\230\244\300ZBO\013\343\nT\002\3201)E\n,\216\306\343\021\t\305\211\244Q"
+	.ascii	"\035\212k\221\350\250\310\310\204\023\222F\f\222I\n\030\251p"
+	.ascii	"!I\\!itQ\202\236`\205$\007$\221\034\220Dr\200\016\207\036\025"
+	.ascii	"A\304\"\212$\005E\026Dd\261E\tk\361\204\235$\007\037\022\"V$"
+	.ascii	"\361H\204\320\221\n*`\240\203DJ\022\213+\004\025=$)\020T,2\252"
+	.ascii	"X\223D\025\216FF\342\005\024`\201\264\242h\202\347C\"\210\216"
+	.ascii	"\212\214C\016\214\220I'\004\223HDHAF"
+	.string	"+\030!\223Nh\261!\250\270\"\211k\212$\321\002,\216\306\"d\tk\022i\024\312\340\374\220\b\026H+\212A#\202\210\214H+\212AF+\260@ZQ\fR\203\212GGF\027R$wP\360\004\021\213(z\200\214E\304c\222\211\n>$\342\202$OQqM&\245\320\200\001\244\321\211\241\235\225\270\022\025M\024\213\214\253p5B&\261\310?\302\225\2478\fJ\301\205$Q\205\020P0=\241\bi$\204,\036Mp #\262x,\262\320\007A\004\017D\030\301E\372\021\020@\002\001$\320\217\200\200\237\037\004\210\360\243/\302\017&!\242E\321D\320\232\242\205Z\034\026\203\214V@\026\217\212\305\0259\033\216F\306#\262\270\022\221^\b\302`]\330$\033\203\r\"\026\2072\221\221\270\346\344\021\t\211,\2660\322\353\207Dt@\\\211&\222\304\24149\314IR`-!)\210XD\2520\020Q"
+	.string	"\005\021\321d\212\026\213\214\353\221\221\221\nk\221\005\222\270\356|HDr\250b=\026\213\212-\214V0B&\261\310\240\310\350X\f\032\002\035\223\222<\032\222H\303\235b\022ih\264\016c\030\342\211a(\303\317O\211a\fC\022\224\030\n\t\031\255H@\253\220Q\322\007\006b\322p-&\205\204\214x\\"
+	.string	"*\016\001\351\fK$\223\304#\030\214\210\206I\310b\013#\240\"RC\020\221\321P\262\210\034Z\2070\020\223LP\220\264\032\211\210H/hX\217E d\361h8\264\006\031a\240\200g\025\022\332\020\303\320\260'\206\241\341\321X4\034\036\223\2022"
+	.string	"\035\223\222\303\365\b\t\331\363\302p\bh5\036\345\2740$\"2B\n_\030\302@L\n\3020\024B*2\242\353\020\013c\021\206!R\257\037\022A\324"
+	.ascii	"Y\\\217E\240`r\270a\347\b\b\205\013b\221\006\244\321J"
+	.string	"$B*B\002\002*\001YlaTA2I<\n:\022\035\340\"(\005dQH\b\311\001H\"\021\022\020\322\b\244\201\270\022M\030!\223N\b:\302`\024\324\223t\001\310\250BxT\\S$\215.J\b\026Wb\320\021\2220\230$\n\rW!!\344\260\bI\254@\305\211\023(rJ| 4\034\256BB@\303\"$\221\303\207D\f\255\304\242a\021\222\230\302\210\026R\230\030\221\"\205\024+\230\260\302H4B\304\207\241\225\305\261\250\302\212\034\224hD$\244\026\211\202\202\2140\2508\322-\212(V\243\003\216r\326\2431E^\207\"\374\2508q\002\305\261\250\302*$\024La\025\022\022\246\304\225hb\025\022B\352\027\212\310\023.\020\213G:\t\350XDz\241\210<\021DAq%\256)\212\311$\"\3421Cr\375\220\210\001\344\254<\303\364C\"V $\344\232,\221\034\272(\256HE\032\\"
+	.string	"2\"\032\016\321\365\210d\0044\034\246\310\342\021\006\243\3410M\"\213I\244\343p\250\203\216F\027\206C4y4\036%\207\303\364hdL\032\211\212\303\241\272\016\327\244\221(\303\207D$\213GI\253\007AE$q(\351\301\210\344j\\1\002\351\310\302\003\027HG#\221\007 \2100\024a\004\027#\212AHD@G\343\bd\022i\304\001V\027\305#\021\361\210,\256G\3430\210XD\016\255G\303!\005-\212\310\243\341\020]\223F\242\341\020%\256\304\240\341\020E\022\207\200r1\006cr8D]"
+	.string	"2\"\312\253\361\230\302j<\0329\034O\004\021\213H\024\271\266"
+	.ascii	"tD:A\\\211&\202\210E\024F\310\244\023:$\207-\212&\216't>$\302"
+	.ascii	"\270\272(\"\213DAG\"\n\306\325E\261g=\n\335\344\020\250\210\302"
+	.ascii	"\005 \342\n\"\"\242\t\306\325EQ\203quQ\314\311a\212\"R\021i\002"
+	.ascii	"E\242\243\"bR\270&\207\306\243\024BE\023\305\243$\025\303\024"
+	.ascii	"ZH!,\002\035\211k\362h\324\353P\002)\344\243\261\205c\022\b5"
+	.ascii	"\036%qrhB\211\024\204&\224HAE\201J\030\361\207D$\221V\fW\b\312"
+	.ascii	"\200,\256Ib\021\232L\026\221AA\304\264\330\202H\224\002\351\250"
+	.ascii	"H#\r[\024\203\222H+trX\0042\266(\232H\"\255\020&\221V\250\305"
+	.ascii	"\243\2445\211\264\"M\"\255\300E\"\"P\3624B\0263\240M0Q\202\220"
+	.ascii	"N\"\031\031[\024\221-l\200\201\210\302\004\023\301u(\302\317"
+	.ascii	"z4\246E$\322JD\026\217\212\212\253pE\256-\2408\261\026\223Ed"
+	.ascii	"\032Tt\001\210x\204&\207\033\220X\030\205\216F& \035\025eX?$"
+	.ascii	"\002\351\250hh\204Lb\001\004D\034\221D\026[\030\221A\004(\016"
+	.ascii	"Q\220\b\201\204\bHGE=G#\343\212Dd\224,\"\203\311\241\004\305"
+	.ascii	"a\n\244\243\"!\272\022!%\213(\216FF\244\243\242\r\305\341\221"
+	.ascii	"\205\221\2108\3349\2620\022\225`\204Lb\241\306\200B\004\212+"
+	.ascii	"\021\205\0212\211\2050)\210XDA\\\211A*2)4\034ba\034\032\032!"
+	.ascii	"\223X\350\b\035\021\345\b\035\021\rc\030r\241\304\007\303\"\222"
+	.ascii	"\bC\020\2228\264!yd\2044\201,\006\031[\030M \035\025\361\254"
+	.ascii	"C\026D\025F\306\224\005Q\205qu\361"
+	.ascii	"\200\365\230\002\322Q\221\316\321\310\270\002\025W#d\013\022"
+	.ascii	"H\022Q0B&\261\350\320\242\270\236\305\321x4\022\213\212(\222"
+	.ascii	"E\"\240$ \236\344\320\004#d\022\013\rEHI\274~HDrh%\026Up\034"
+	.ascii	"\026\341\344\260E1hM\246+\254\220\"\210\310hX\204\246\200\241"
+	.ascii	"x\034\026\241Hb\013|42\256D\344\n#\021\021H\270\016\327\237\365"
+	.ascii	"\b\243\253\01369\f\341g\002?\353\321Nq%\256\3113\204\237\t\374"
+	.ascii	"\254G\350:$\361\301\004H|0\201\224\304\007\023P\321\344\2608"
+	.ascii	",\036%\251(\262 \256)4\024\217\222\326|&\207:E\026\3045\031<"
+	.ascii	"\032\211C&\b\327\341\b\353\321\210\224\256G$#\023z\326\3440\206"
+	.ascii	"\244\013h8&\231\330Y\223C\0266\304\200\302\321Xt\272(\006\035"
+	.ascii	"S0R\021\303\220:\001\273\016K|\260\036\215H\272\270\022Q\f%\213"
+	.ascii	"H\241\"RxL2Q$ZAT1\004\264\032\035u\220k\013\031\326\344P\037"
+	.ascii	"O$\021\035\035\225\260\263~H\204\320\210\243QQ\221\021\220\005"
+	.ascii	"7:*\"G\254FF\310\021\302\022I79D\026W\"\343\211 \"\322\013\306"
+	.ascii	"\025;$V\334\237\025\267\304\212\373C\274%\210\367\307\305-\341"
+	.ascii	"\342\376$\335c\222\t#d\022\213t\007\006#\"!d\261\205Q\206u\270"
+	.ascii	"\352\377\374\230\220\001\005X8A\003\2110B&\261\030\221D\032%"
+	.ascii	"\217\305\344\210\243\221X4\002\b\231\034!\242C\222\002\305\""
+	.ascii	"\243\n\035\"##\007\f\317\240\342\nT\\\213&\216\306\243\0240\020"
+	.ascii	"\223x\376\013\275\244\221A\006l\315\235\336NU\234/u]t\f\007\254"
+	.ascii	"\211\nrs\2525\246eU\027\034\202\336)]\361\343\222\232\331\b\023"
+	.ascii	"&\n]\372C\225j\013[\333\022\364\372\273\362\206\315\\*\007\002"
+	.ascii	"O\017\310\315\277P\213\322\217M\032.7c\301\222\232\005\336\375"
+	.ascii	"\304\320\277P\356B\351(h\356\240\256\240_t\226b\210Q\263\242"
+	.ascii	"\322q\2402\362\343fa\234\220\312\205U.\254r\205Up` \272\344\013"
+	.ascii	"\0244\013\335\204n\302\267gX:\243b^\370V\303\312\227&$\336\350"
+	.ascii	"_8\305\302\t\271\244\375a\221\022\006\013Qs\372\021%*\347I!\013"
+	.ascii	"\323\026\254\372Z\302\223\202\022\324Q'#.\207\360I\020\213\254"
+	.ascii	"F\233\265\265\324\254G0\007\025\t3M\232\b\323\366<\030\233!\344"
+	.ascii	"\212\223\013\323R0\275!r[n\026.-\034\036\240\0217$\332\364/d"
+	.ascii	"\322%\370\204\254L\333\222\274\240\326\220:34\265\231r\261\261"
+	.ascii	"Lr\246\262\361\361&\257n\031\006\245,\214\022\300\364I\337\233"
+	.ascii	"U\231^\025\034V\025\262 \023\352\343\312\\\233\261 \214 ]\226"
+	.ascii	")]b\370\306\235\235\025\276\233\205`B0!\022\024\224R*K\022D\274"
+	.ascii	"\356%DrK\325Dy!\022\341\027\023\353\312\315\347\023\036ycEL\354"
+	.ascii	"\210\360\253\t_`\r\254\245\266\022\266\204\023\032\3019p\020"
+	.ascii	"\2607fn>\211(!\021!\221%+T{\302!\302!B.\256\264Is\317\256O\310"
+	.ascii	"u\335\234\230p)\271\371#\256\350_($u\2635\362`P\005I\371\204"
+	.ascii	"\\F\366\276\200\004\227(a#\333b;{\220\201\262DKe\006\267\236"
+	.ascii	"\226\210\021\376P\251\214\311\n\022\225u\257\306\320\240\204"
+	.ascii	"X\367\210\025%3\2327\367\350\241\273\236\201G\232\343n\004\023"
+	.ascii	"-\304!\304!\334a\251\326\024 \313N\203\326\267\257j|\370\205"
+	.ascii	":.\334q\271\027f\330\340\335,\314q98Q\232|\271Yxu\271\224\316"
+	.ascii	"n\013kD\230\376\2057\3242?,2mB\033\352\022\260\245\262@!\225"
+	.ascii	"\220JH\343\226j\251+\255\312\022Z]H\343i\351\212\226\233\205"
+	.ascii	"U#j\350_8\225\372\355li\361\3122#\030\206rq\002{\"\245\004\320"
+	.ascii	"\013\206\2240\352\006*\233X;n^JpE6C\030C\217\r\263\355\346\217"
+	.ascii	"\230\241\177\341SJ\204\211G]\034\214`\335\230^\225\027i\240R"
+	.ascii	"\327T\225S\360\356\256I`WS\220\215\003C\226JLq;\226"
+	.string	"`\261YJ\225\024h[\202E\250\344\026E\366e)\334\351Z\334\222\036>n^\242MM\025\311\n\002\236k\206\244\251c\272\313*\277)V\177*W^3\343\027\007\016\206\2227\205F\371\306\317L\034\337\222\233\227mA\2666*0\372\360\025\2464Ob\270\t\266i\322\266\265\345\346\266\266)J\264\364\202|\331F\234\3004M6{;\226\340\216\334|\313z\220\211\022\\\223\212=\305\320c\022T\243\375^8\t\311\272\331\214\231`\032\237,%5\033\300\2412\344\006\007\320\274\221\021D\363`\232e\237\23007\007\317h\033j\336\323\035\025\021o\202c\202c\202z>j\226g^\016\245 \231\007\365\320\3446NR^\"\300\340\341\005\303\030Q#\013;\245\2149\013\022\004\363`\230\f\270\024\303\313\227\037q\342\202_\202yA1K\324\030\341\361b\366\367\345\255\312\203W\252\004\357p\030\273\334WYJj\016"
+	.string	"Gj\317\256o?]}\020:\201r\342\205\356\301\273\007\273\224\b\341g\312\306\302,\335\034\264\373\316U]\225\346\315\017r\t\326\375j\020,\310\032\331\315\027qD\337\203\264\033UU7\007\267\374\314\r;\023\245\346\346\340\334\345r\256\304\364\r\321b\267\225\307tsP.\210\3052O\027\314\362%\317N\025\030Q\350n\276\b.}{:t\004\366th\320\212Z\305G\020\255\233\237J\t\263Cy\363E\374x{\013\3061i\220\205\351"
+	.string	"\t\323\263\001\367`\234\206\241\326\254\233\003\323\262a\344\346\213\220\nB\tB\t\272\241\314=\2620\236$ZL\033\301)\017\272]\250\275%L\002o\016JIC\360\251y\2719\030\345\212\251\225\331Q\345\346`\333\025\003\234\221\243\311\0038A'A'A-\275+mU\346\214k\355A\266\023\266\362\352n\016\252\335\275\231\331rs0\355Ba\271\263\036Z<\300k\322\0043\2754\027$/\306\334|\017\002\212\277\250\224\244\215\326\006\213\212\222\034L\324 &\225djlh\032"
+	.string	"\203\025"
+	.string	"0@D \220J\266a\254\007\024"
+	.string	"\021]\276\222fH \216\2434\211\2243\003\002\003@@\002\200\200@\001"
+	.string	"\354!2\350\273\270\305\320t\241wR)\275n\340\005-\215\300B$\001\207\006\350p^\344\2171S"
+	.ascii	"\0242\3151\217\237c}cd\345Y"
+	.string	"\226aSd\342\340-\344\314\324\325\334n#h\275\032\216\213+\237\312\004(\323~V\244\001-]h\023q\245\023<\003y2\b\244\232\027\370\303k\300\220\301\266\225\016\245\353\253\327\371\233\374\324x\026:\364\214\346\213]\027\0067E1\021v\034\311\244W\351\344\020\261\342\314%\340Q\013\266,\253\342\272R\241\377\302\226\356\016\n\255K\331\232\326h\266\257\365h\255\3072\036\244ct\3544\332\214\347\221 M6fs\303\313\207\257'\271\024\301j\3502\337\213`\207\004\026\311\216(\177\025\345\356\033\207`\177\300\210\226n\331k\334\n\235\276\347\367\331\002C3}Y\261\225\006\301\\Ei\367z{l*\262\227z\274\246V\344\241\303\013\207\354\230\2262\372\245\355\355{\216Sg_\224\345\364~\006U\036\343!\200\266\020\016u\255\226s\366\013\300\2112+\020\322$\220\225\230G\023\321\352\241\017\373\326}\223\272ZL\277"
+	.ascii	"8\342\237\371\376\220\024,\260\303f\350\310\354Xv{#J)\020"
+	.string	"\341RK\007L\256\325gP\t\007vv\021gI\035\356\267$\002\036AA\205\234\034\324\3518\024\240\376\361qQ+O.\375\217\017s?\224Ob\246\210\207\243Z\304\030N\356\315W\007\261pHu\307\\q\320\333M\312\273Z\212\221\370h\265\221h\366\270\221\324% \230C.\332\357\320\263\035\036\354>O\201\274\0215\253\025\307#\375\030\325"
+	.string	"\006\313\225Z\330\277\020\313\024\213N\013\345\226y\213]2\021\034\316Ap\364\340\227(\360\\\021a\337\320\356L\307\343)\345\r\r\243\002t\b\300~\003\252\2063;\375:\255[(\240W\211\221.\260\366p\2523\202!qV\31120:q4\234\277\374\0036\325O\345\030\300\305\257\323\311\224\214\302SW\037,\260\300\017\227D"
+	.string	"\023c\234\200&\266\257:)J\3518\033Zx\"\307\207\247\250RN\347\005\303\254(\324\312\243\300>\236%\307\334\310\341\366\243x\305:\307\344up\330\310\0038\202\2525'X-hA\"\224\031\013}\243\351\351\274\322\376@2\347#\331w"
+	.string	"H\305\300\356\240\215=\363Q\243\3312\253\n\364Aw\rr\fbE\273\342\211\340\271\332F\002\"\364\351=)\330t\323I\245\231\316\336\023b\366\020\275|hD\t\301\002\b\236\333\360)\236PP[\272\241\263\246*p\177\210\222\204\323S\033R\356\347\006#\346r\351\tZ\316G\237\330\003\b\273\021\341\030\205\007,\366\tP`\271y\275\232\3465'k\003\r`\025\311yj\21336\305y1\001\271\177O\310\205?@\007q=\317\024-\314\021~6"
+	.string	"\013\365\215\302\300\325\245\337\036\020W"
+	.ascii	"\235&z\323\001\351@\262\315\020\342\323F_\307\002:\25722 \303"
+	.ascii	"\326\thd\365\234\232\006\001\034;E]Lb\004\246\352\023\235\022"
+	.ascii	"W\346t\232\276d\267\340\263n\210\276\t\007.\323DF\2642hAME\375"
+	.ascii	"\241\r\314j\223\343\363\314!/\253Cg\363\306\322E+\216\033\232"
+	.ascii	"\n1\n\003\227\200:*\323\023t\306&)H\016\212Y\372\344%C\027\363"
+	.ascii	"\253\354/\205\346T\007\235N\340\017\337\262\354\265=dd'\373\206"
+	.ascii	"0\242\223\204_\257A\003o\242\230S\035\263%\2332\255`C\202\224"
+	.ascii	":\216\b\317\364t\306\202\220\216\237\362(\260_\372\214\t\363"
+	.ascii	"H\364<\265\201\220\345K\217\346\340\232W\343L*\236;1\206\312"
+	.ascii	"\313\3268(\2444\224\271lrT\271\275+\0056F\357\206\233\346=\321"
+	.ascii	"@\316\334\007\034\262 .Y\031X1\245\003s\203s\361\033\313\017"
+	.ascii	"\374\210\240Rn\302\032C,\2314\343\374(x\315\227\320\211\203\226"
+	.ascii	"\301G[\274\316\303p\346\362@j!\373Lv\242'O\017\224#\004\305\327"
+	.ascii	"*p\245G\026\350\ryz\361\354\037te]u\356R=\216\274\026\267\322"
+	.ascii	"\225l\002\350\027\330\256>\257s\203H\327m\017\003 F\023\374\231"
+	.ascii	"\330\325\223\375\221\215\375\004\3234Yh\024\312N\367\315\241"
+	.ascii	"\3760\353Zvs\177b\3171\242\026 !\323\244\017h\221\037k\354\203"
+	.ascii	"KLN\216e\233!v\nB\260\034\302\02687\032\221i\242\034$\206\354"
+	.ascii	"\245\227\003]\033/\270\243!\363\031\272A.\214\233T:\0035\326"
+	.ascii	"\355d\356|<|q\267\327@\250e\020\337\006\364\305?\305\223m\243"
+	.ascii	"m\022\204\265\246w\tP\220o#\311(\232T\257Fc\267Mk;\221\223\264"
+	.ascii	"\255\310g\037\320]!F\\\0032\356\322\253\352c;\200\003\004R\021"
+	.ascii	"\363\351o\350\263\257E\270\213\236 \304\350\316%\230 \332\257"
+	.ascii	"\240CPW\253\326\333C\215\253\374\0179\217\027\341;\336h\n\302"
+	.ascii	"\020\027!\031#/\023\273\374\227\202 \377\002\204Z\314[\311\264"
+	.ascii	"\367\2456\270R\234\350\004\331\220\022\\\"P\233\246\274c.0\337"
+	.ascii	"\307\231\266\207\244\2635\f\273$\336\370\360\377\222A\b\243\261"
+	.ascii	"\201\2345\236\007C\004\212\242\264\006\304"
+	.string	"m\237\243\352\245\303\200<Y+8\204\0017\244#t\001\276i\322\340\344+\227\271\300\373e\334\035\277\227\177o:\201\215\r\360f\b\202\200\247;]\024\257d\352\260\230\276\207\242\003\220s|d\205\031\274\303\371\350ot\031\333\023\005\200\263'\235oL\245\"\366m\312\266\2110\300\370O\317\035\221\245\025'\017\3210\326\321\247\257C61\376b\027\b\017%\227F\344\372cg]\261%\367,\214M\034\374\243K\245\265\3229\025\345S\270\341\013r\213 \347\343)\004@\370R8Y&\035K\377\031\374\320\302\256\027W\321\205\210\t\343\306\321\317\033\244k\206P\261\321Q\3419YRj\023\227\352\340L5\001F\332\242\372I5\226\201\326\316@\337\364\255\202\377\331\027\252ojh\2673K\375\\Ih\200\237Z\021\035u\246c\032\222gX\374\354\362^c\340\030\210\343E9\273n\222\003\027\023\001,\252\353\300q\034\244"
+	.string	"\303P\260\320\331\007t\016\212\220\272\223\224\023\267E\230\345\023\216\253\214\245@\030t{g\3510\032\353\355\360\301&M\367'\020gD\352\340\266\2028\212\017K\260\2034\247,\211\003\354W\221\307\216\213\362\0068Z\274v2\262\255-%\300Nm\003\352\022\2604 G(\0374-\020cu\213\370\332w\022\236\307;V\351\262\350M\256\021c\276\343\020\2500\214^\237\225P\260<\376\361\372\304\304\200\365\f>r\333-\036N#\350\333H\336 %\033\274q\374@\263h\013\216l\236\027pEnVw\207\002w\306\315\262\331\373A\347\337\006_gtV\n\n\261\b\263m\036x\262\333\252\320\256\266ME\245\350\320\265\310b]f\0011\374\260^\312"
+	.string	"l\013C\271`\276*\363\030\312\364\257\326\224\\\350dM\332\251\rKZ\305\331?\255\241\215kR\263!0\214:'\rM\330\310\215\377z\017\316'\003\313\3005\257\275\032}\254\0171\b\211l\330\260\033\260\300N\351\352\0339\211\255b2<M<\311_;\313\200\022\b\305\367\234\330\b\3021\365\322L\002\354\220Fw!\360E\327\345lh\006>T\250K\220\234\362\335(=\334\340V\027["
+	.string	",\n\001\314\2747Q\023\016\341\027p=\227\356\361\376%I\254\310\253\233 \361BCD\253\310t\344f\004\035\202\361\"\357\200\203f0Jh\202#\364'\327\267\233@\200\006\373\021u\025\263<d]\303\352\025\nh\200:\327f\bA-\027]\226\004\343\032\253\210\347,\375\210\311\244\202\312\263\2779\020p-\\\b7\3109\361q\334\030\005\317\311\252\350\3457\332ezT\264j\255\3435\365\212=\361\3546\264\254\037\031\260P:\236\354\013\2221\277\262t\013\272\236]\022\371d\205h\204J\321\374\346\221s\352\247\305Q*\234~\342\305\223\013E\037Q"
+	.string	"\036\203\013\023\352\245Q\223\002\240\002\351\246\256\241G\362\332-\203\356\177}\017%\240a;\215\310<\237\264\001}\371\204\347\333,V\201\001\313\214D\373'-\3046\203L\214*|\363\357\232\030]&\226@\004\214\311E\225*\344\270w\332\330b\202'\027+\220\361*\262y\026\007-\013\265\223x"
+	.ascii	"^(\006\362\202\016\275\177\224!I9\"#\007rK6\367\0333x\307 \333"
+	.ascii	"\035\375\335\301\2568@\267\330\007\330\030\003\313\313\253\371"
+	.ascii	"\320e\f\261\301k\245\203\t\253.\323\306\243q6<Vg\276\363FB\343"
+	.ascii	"\3213\204\260|L)ax\262\017\221\"2\307\304Yo\362\327\216j\212"
+	.ascii	"\035C1\217\201\364J\243{<y\021\003\330\240\372\251"
+	.string	"Y\377G8\223\363%\303\347"
+	.string	"\313\300\021\377\255\250\030 !r\3371\337NG\353\363(\223\b\372ua\355\232\270\375sE\327\036\333|8\303H+c?siW\230\312\277\205\2503$\346C\216g\347\377G\336\357\b=\310\301m\317\355\335)o\224\367\367+1b\241*|\332\005V3\267\251\036'\211e\242\212\035tjj\265\007\261\311Y\306@>W"
+	.ascii	"`v~\n\241C\344\2414B{\315\376\314\304\320\376\366\201o\231<\r"
+	.ascii	"\362]\365\037\004\243\337\004I;\343;\347\021\036\314\323\b\375"
+	.ascii	"=~\264G\361\235\022D\n@\r(1&:X\003\t:\370\351\213?6\270\263o"
+	.ascii	"t\204\215\201v\034\235\003<%\032\266\247P\322\205\267\350\277"
+	.ascii	"\3703u<\202\203\271r\rF\362]\004\251O\344\326\f\251R\203\260"
+	.ascii	"\225\003W\366YJ\225\275:\362\244K\030\240.\322W \247\203\375"
+	.ascii	"\025'f\365s\354%);b\303\351\222eln\027\032j"
+	.string	"\f\003\323\376[\236\200\330\266\"\212{\f0{f\253x\023$\031\242H\242\177\307\201\256\350\345\367\177\002&\t\321/\313\362\013\247\320'\226\265\f\032\353X\374\n\203\201./.:;7\303\032\262\257Y\304\211\213U\030t\2101f\254[\fOij\204\310`\210\f\225\324\013\244\335\037X\354S\035\2749i\263\007\326\320\344\224\215Z\203F\255\212nV\262V\233\223\213\267\356\346oP\026g/K\370\215\373\n\217\030\353\213\342G\345\233Mz\246\314\b\320\ru\333\332\211D:\3200Q\234\016,M\016\275\360\003\243\327\345\362\222\320[\332\306q\017\332b\\\036j\n\276\247\b,t=\267\324rNp%\233\360\366F\305\276%H\n|\023\"\n\3629\317\354\343\355\030\343\355\365;\3463\275@\356\026\351\205R\337\263\300\f\031\322+ml?X[%\343t]\261`\244Jg\027\314\375\210\031K\267\006\202g;7"
+	.string	"0\002h\375t\341V\363,\220\bQ\303\340\0136Lm\256\227!\022\261bq\311\322?y\350> j\224\177\356\337\376\312"
+	.ascii	"\025r\377\370\306\230\336"
+	.string	"\262\263\353$z3\3703A\245\261\306\223\3248 \373_;\251e\340\027\202r\223\250f'\230\026\250A\001}\0225x\275\316\261\353\250\315\033\246q\204\033\205\320\244\ts\r\312=\206\333\305\272_\003\365\201Gjh\323\212\203\f\b\342\371\b\355p,d\273\027\326p,lT\326\256`+M\352\324\024\3229T\031\265\361\025\264,\264W\271\327\027\306\317%\320\037\375\327\310\372(m\275\021\206\250\006SGE\335\352\340\266\260,\362/\020!\375,\201\355\313D\261\310\344\267\250M\006%d1\313M\\\021[\366\223\204\242\237@\316\374'\365'[\2615*\207\314\262\375\257\n\372\231\307\266B\\\242\225j:Iy1\340L\241\372V\312\207\3771U\032\241\254\"\004*\372\026\215c\262i\302j\3144u\3376\f\276\330\337t\034\366\336\243R\315\313\266\2027\312\250\323\035b\336h\305X\\\267\315\336\341\034]\212}\345"
+	.string	"\3506\370>\364A.\350\034\367z\211\314,\035\362\343\260\003\306/\262\305\275\031pCjQ\035AjG\245Y:\024\337\231\304\205\222\357`\036V\304\235\201\007`\026d\264\315\223\214*E\364\023\234\342\223\251\301I\211\217\373;\257\342\371r\240\274T\306\347\036\023\367\336\372\237\037\344\246\356o\312\211\245Er\266\344\365\214\337?\025\242\214'\256rU\206E\351,\215\327\350"
+	.string	"\245\215\n\013\263Us~\037,\030\207\031\3070"
+	.string	"\330}\224\034\264\355\"'\311\323E>\307\001\201U\021Q\026\202\363O\"\337\345\312@c/\0067\344\024\242\220\343\363\356\001"
+	.string	"\263\217\230\212\026\374\371n\260D6\301\303P\352\327Haj\202!\241\337\3300\031@\273\254\017\302\016\223a\223\300\277\214\343\314\302&\265\230\231OUXc(\204u\374cEq\3543P)\237$\240\205r\261f\373\273u\256?\352g\024\210\211}shT\ft\005\236\265Nd\216E\3220F,Bg\356\242\n\266O'\032\026\365\3655\252\212\212*\262\246\270:AB\344\3730Y\236\242|\337\341q4\250\257R\277\305mA\007\342\340\337 \023\361\213R)\021\377:\\Y\022"
+	.string	"l\210\243\375\316\263U\247\0317\002$\330\\\375\366\334z\236\261\267\231\274\203\374\322\201F\315(\212Z>H&\330\316nnV %I;\"}\325\3728\024\366\324B2\367!\200\213\201\023\007;J\013\254lKRR\366b\324\332i\303<\264\244\356\216\237'`w\211\\'\212\022V\b\n\\\346f\366\233<\213<\352\246\302\243Z\325oe\321\367s@nA+\275l|\334\006g4\373O\311\360Fu\250\360N\304\347y\376\r\276B\213\307\240"
+	.string	"\377\204\007J\254\247\260\360\f\316\242\177zq\373\205\340\021q~\361Y\321\004\252\354\250\017Gn\237Vv\330\200\275\342A\001\031C-:ZP^\365\b\235\225\215\036\355%\303~c\025\375\301\235N\231;\211\023CM^\230J\213tt\247\030\352\314\254\026\316\322^q?D\245>"
+	.string	"k97o\034\233w\030\320\037\342)\"\213\307m\245\355\204\244\227qT\234\f\263\302\023$~\205\375p\213\210\003|\243^,<N&C\200\251\233\352\031b\355\274\227\203\3741\330\317\320\027\006\217\217pv\260\357\335RB\261\363)\354{\224$li"
+	.string	"\323\007\312^\306'\025x\2317\346'\\\027\203\0032\0345\f\252\355V\277\016RRHg\354\245\177\336\002\314a\206\034\275'\216g\304}.\253\264s\212\027\027[\226=\030]\bH\363\r\037\034\250]\252\277\355\274\r~\256\b\202bg\"\352}\244\234\233\247I-\206\246|\260F\3448\246T\033\n\263\275\364u\030\263\365@p\324\235!B\323\361Y\223|?&\226\215C\206g\323\017\265\266\275\203\247\256\261\356\"\323n7\033R\240\251\270*A\224\310JB\337'{\007\244Ps\034\002\035%\206\241\364FueS\335&y\245N\202\254\026\371\327\304\260v"
+	.ascii	"I}[\363\350v\253\354\274lvE\267\250\250\213\211\200\356=\030"
+	.ascii	"\307pT\0204W\n\335\302\031\375\374g6\333\245\232\271\313\370"
+	.ascii	"\274\023\r\3302\267\206(\267|P\037\243\020+Vc\020S\366K\253\263"
+	.ascii	"{\362\025Y\227\364\351\364\227\314\026\344\336e\212\365\231\332"
+	.ascii	"4Op\242\007/\313\247\321q\245\303\267a\037\022\005\303\033\005"
+	.ascii	"\310\240#G\353g\341\304\225\260\340\033\\\347(k\376F\322v\325"
+	.ascii	"l\301BR\252\263\327@\322&21BdTp\n\300\226 s\221-\354(\265\321"
+	.ascii	"v\206\266\002s\365fWe\004\231\367\256fA\300&.\340{\024\243\352"
+	.ascii	"\204\217\3312\271\2407\3150E_5\036G\262\256\0331\021'X\245\324"
+	.ascii	"m\224x\021t\326\272\b\003Zv\322\262\345[<\357\016\224o\006.\323"
+	.ascii	"\340\030\301\r\230\t\326[n\333\321\225\301\353\276\233\354\311"
+	.ascii	"\\\341\340\327\230\363\027\260f\376=m\257\326\277##)\356J\260"
+	.ascii	"\374\204{d\236+\022\020\372\245\307\030e\375&T\247\223\375a3"
+	.ascii	"\342lYm\262\227\207&\217Z\314\b7\360\352U\254\206\007\261\221"
+	.ascii	"\312z\2133\302\277\265b@\334\241\237\341\365\334n:Kq\306\367"
+	.ascii	"*\3628\366\340Ht\331 \336\304\345\020;9b\210AO\251D\2460j(7\200"
+	.ascii	"\t\344^8pd\370\031\341\027%\206\232\r#"
+	.ascii	"\355\264\201\260cl#\236\355\301]z\315\261\337\336\033\354\316"
+	.ascii	"\277L\372lB\241p$s\237|\013z#,\036$\300\351/QG \2529\320\025"
+	.ascii	"\004\3128\214\336^"
+	.string	"\262\367\\\211Y\253`\273\267\245\221<w\300\272\002\0317+\245[\317\227t\210\024I\276\003SY\343\\\347\035#[m\\\020\232\f\2322\351e\215g\262\026\2216g\374T\227\315\332\210\353+\374\026\370\270\330\335-\312\\\357\242\211\371\366\315\233\311\377\006\376\034\330\222\376f\212\t>\354\306\334\210U\363&\206\252\302\255\275I4\242\021\210\220U\307\006\026\013j\247=z\226RNk?QpjKPf\314\2140\313\210\305\341\332\263G\322\t_\223\322Q ;alf\321\202\236\317X\216\341f\241gs\353\355y\003In\263\247r\375\b\001b\033lb\004\254\341\256 \302\235\323\376m\320\001C\034\255\007}\261\237x\031.M3m`\300\306r[m#\002\023\365M\365\345\374\020$\315m\245\233\326\277i\370\263\267\202\324v\245-K\305\373\377\003\3674\374\246\342\0032w\363\207\330\023\252\343w\242\247\016\200\202"
+	.string	"\221\277pQ\020\351\241E\205\354\311\353\230}\343\344\237]\205/"
+	.ascii	"\003yH\376/\311\264o\013v\037\022^\340)\356\220)\313;\341\213"
+	.ascii	"\364\313pak\006\034\273\270\fo\344\003\366\247\246\233\t\366"
+	.ascii	"\232aE\346\016\277\241\370R|u\2006\310vh\366\224\205#\301\300"
+	.ascii	"s\233\274U\313\016\265\223\334\004-\021FATtK\345\26146AFK\330"
+	.ascii	"\310R^\321\r\350\211\270Y\254\020\206,\346~\330R\334\324\226"
+	.ascii	"\200\207\372\200J0\226\322"
+	.string	"^\220s\027(\n\356\215`\315p\354I\265\032\036\331\035\316U\270c\276J\202{\022\361\215\310nQ;:\210\371\364.R\340\366\320Cz4\257\257/\232?\274\215\021'\037\344{Vm\300\007M)\353\fUO\020/Y=\356\t\177\275S\372-U\350-~\375\365\r\331\b\240u\361\035\355k\276^n.\246\025#$V\277\241\007\236/\214xpi\307\361\017 \306E:\367\256\266\266D\277_\355\233\304a\274\237\021\206\256\214\360I\3678\006>\320\336\310\200\337\347\260\367T\356\342>~\325qU.7\365\267Nr\365\360\204\326\2001\362\037\215u\3601\377\214})\027\274\366;\356\327\374\037pLi\347\361\242O\260\205\3374k\371\253\277\3344\361O\203\377\205\210+\275\313\271\3602\337\301@\033\346\373\016\">\271\262\332\264\376\376\035\315i\t\016\341\267\266U\332z\032\211\347\\\272\221Px\354\260\t\377g\351"
+	.string	"\007"
+	.ascii	"$]\266L\324\277\223\231\234\035\343\363\337\231\316\314\253s"
+	.ascii	"Lw\205\350\t\303\207\332\214\227c\344\301\225\214pW\356G\343"
+	.ascii	"}\024\007k\341\356\3351}\004>\313\261O\030\360sNz\210x\245>\231"
+	.ascii	"P\360\371\263\356\"\376X\347\030\006p\352\374\020\235\347p\332"
+	.ascii	"\271\343\227\330\036k\027\2757|\236N\204\231\tv\214\236\362\254"
+	.ascii	"\351\005\237\357\361\004\236\277\207w\036%pY\017\336\037aG\335"
+	.ascii	"\300\350\272\362=\325\230\200\301[\242'B_DgB\013~\206\302}\004"
+	.ascii	"\344\337;\333)2\033\342\374B\237\207:~\203\277\375\351\036g\220"
+	.ascii	"\256;\017\234P\274\212\215\227\343\226c\332\356\372[\233\316"
+	.ascii	"\340\322\007U\312\017\361\212\325/\b\316\0062"
+	.string	"1\244\031)\276&\256#J\330\350|\274W\262\236\"\375\2474<O\243]dL\246\3038E\336\221Z\377!#,U\035\203\307\325lm\346\237\375h\346\353\\s\201\036\277\222~X:\355\373\2525\336\204\265\226\312\222\307\305\340?~\377k|\341\374O\332@V\374h\207\367\r\270\204\334\314\354\017Cm\353\250;z{\237\0340\227\347\334\216I\353\250\354x\266\260,\356v\351\r+:i\276\266\315\252\221\\?\270\034\374\034\234\270\367\232\017\024\037\\\374\004g{\344\331_xy)\332\263r\375.\332\257\344e\263\316IN#\031~\327|\307\354A\272\336\332}\230\215l\337\360\252\316^z\246E\300u\027>xv\322\036\313w2np\035\003\304^M\262i\244\257\\:^\3309\017\273\277,\323-\337g\377\b\266=\340\217\244\343\371\222\221t\317\007\370\321.\007\030\377\327\234\265z\337-\371g\316\372e\307X"
+	.ascii	"\227\307y\243\271%k6\355E\336\177\256\216\331\212\271{\336\257"
+	.ascii	"r\277\001:Y\326\362\027\325\025j\257_y\247J\314\343\254\\\307"
+	.ascii	"\352\333>8\234\372C$_\240\363\303\264/\3268\003\322\235\211\366"
+	.ascii	"\345\2270{\324\376K]\351|\315\314\274\205S\234\256\341\210\336"
+	.ascii	"\303\277\322\347]PG\0305\200\\\363\362(\317\274!\275\323\277"
+	.ascii	"\020\r\241\272\036\217\354\372\023\341\344\324\226V\221\355\222"
+	.ascii	",\331\035\347;\330?"
+	.text
+	.section	.gnu.lto_.symtab.d2494d2c117f74cb,"e",@progbits
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"firstArmingCalibrationWasStarted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"vGyroStdDevModulus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"gyroSensorBusByDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\004"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"gyroInterruptSyncActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"gyroSampleReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"gyroSampleReadyAtUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"gyroGetAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\004"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.string	"pgResetTemplate_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\004"
+	.string	""
+	.string	"filterChainAddBiquad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\004"
+	.string	""
+	.string	"gyroDataAnalyseInitNotchTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\004"
+	.string	""
+	.string	"biquadFilterXyzInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"gyroSampleQueuePop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"quaternionModulus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"kalman_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"biquadFilterXyzApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\005"
+	.string	""
+	.string	"gyroDataAnalysePush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\005"
+	.string	""
+	.string	"filterChainApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\005"
+	.string	""
+	.string	"gyroDataAnalyse"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\005"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\005"
+	.string	""
+	.string	"filterChainAddPt1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\005"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\005"
+	.string	""
+	.string	"filterChainInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\005"
+	.string	""
+	.string	"kalman_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"gyroDataAnalyseStateInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\005"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\005"
+	.string	""
+	.string	"gyroSampleQueueInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\005"
+	.string	""
+	.string	"gyroSampleQueueIsEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\005"
+	.string	""
+	.string	"quaternionInitVector"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\005"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d2494d2c117f74cb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1214 @@
+	.file	"gyroanalyse.c"
+	.section	.gnu.lto_.profile.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\372\0015\n"
+	.string	"t\n\356\002"
+	.string	"\030"
+	.string	"\331\316\211\225\001\022\002"
+	.string	"\001\002\001\240\342\234\212\n\002\206\234\330\324\016\003\004\005\232\341\362\265\003\006\345\327\241\353\0054\002"
+	.string	"\002\003\004\002\004\005\002\006\001\005\003\007\002\007\006\002\006\002\001\002\001\007\b\t\n\312\373\331\316\004t\003\002\b\002\t\n\002\013\f\002\013\002\007\003\005\007\005\002\r\002\016"
+	.string	""
+	.string	"\r\016\017\021\022\023\273\205\254\202\r \002"
+	.string	"\002\017\007\002\017\005\002\020\005\002\005\025\026\027\342\300\202\303\004\n\007\002\007\030\201\327\205\225\017\032"
+	.string	"\002\003\031\254\216\377\303\n\004\032\207\372\271\305\n(\003\033\240\342\234\212\n"
+	.string	"X\250A\272\300\2640\205\031\326\220\202\251\232\252\007\020@\207\244jRh\f\200\365\030Z\261m\200\202\236\226\203\223 \377\002\254\246:#!\036\347\007m\255\242\231,\203\004\301\031\317\032.Hn\274\253\216\340\005\034"
+	.ascii	"4\205\321\215\003 \211\371p~\230\245\337?|eyO\227\343|\203O\376"
+	.ascii	"\b\035K\035\362\025q\251\244\013\375\304\274)\277\r\276>\357"
+	.ascii	"\307\243\205\017\203\034\263\263)\035\375VP\311\034}\322\277"
+	.ascii	"\361_}\331\255\326\016\222\215l\364p_\037\245\276\264\3453\b"
+	.ascii	"Z\240M\317\242\244/\024"
+	.text
+	.section	.gnu.lto_.ipa_sra.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"\275\004"
+	.string	"2\304\f\024\300\2471\277;\361\377\377\327w\257\017\213\220\275\273I)S\n\227\3741\331alE\260\310@\021? \353m-\373\224\3577\372\351\307\344&\230Y\221/\001- \200\002\232\273z\021\tl\315"
+	.string	"Jn\202\344^\214.4%\271\210=\024\330m\205\210 \370\300\"a\036b\0040\324(\035\350\323bK#\250\007\217\b\323\032"
+	.ascii	"\202\004H\214-0\022 \026L\352\003\347\f\262~\247n\210\325\361"
+	.ascii	"\rn\301\214\321\023t\013\343\264\344\374f\263\001M\016\236ch"
+	.ascii	"Z\343C"
+	.text
+	.section	.gnu.lto_.inline.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\270\002}\017"
+	.string	"v\326MA"
+	.string	"\221&\35147`\034c\"\304\001\223\315?\306\320a\202\275\244+\375\314u\310\365^\363q)\314\026\377\256?|\377\330\254\324\377\017\373\362\267v\200Z\3713\361\361\034\b\366@\265?4k\237l\271S;"
+	.string	"<"
+	.string	"<"
+	.ascii	"\267\272#y$(\223\302\302\241\363%}\021\361\"\346P\264G'<\324"
+	.ascii	"\353\335\261\2443L,0\317xP\377\275W3\323\204\372\007XcD\206\032"
+	.ascii	"\006\375#5;T\270a\340\253\021D\035ET\254\354\376>\330?\216\266"
+	.ascii	"\225\211\250`\003\032+\243\376@\234\267\262\366\327\261\371\317"
+	.ascii	"\323\177T\031\0134+\n|\t1\234\250\330\320\223\236\r\024\r/'\343"
+	.ascii	"\316\213:!D\214\313&\231\024>O\252\213L\t\0136\275\217F\270\017"
+	.ascii	"\\\250\020\332\306\022&\013\023%\022\0342\206!}\034\341\207\314"
+	.ascii	"$p\200;\327\3060\251'a\213L\223\013@\2515\027ZN\257\374\361\357"
+	.ascii	"\tc\333\001\336&\302\024\030(+ O\202&\227\204Q\300\271\302C$"
+	.ascii	"L3'\020<\340\302\004\351\335\215\"\254\026p\036\324\345h\240"
+	.ascii	"\333H[h\304\360\320A_mWc=ef1L\021M\250\201%\203&\020\221\221"
+	.ascii	"\t\222\306Z\016@\002\202P\325\365\022 \005ANr\201!\033\246\255"
+	.ascii	"\377\035\235Xm\370\333\244\232\230\2412yc\b<\f\031v'\363\321"
+	.ascii	"\270\217\251\217\006!\240\357\357]\005\347\236x\252\273,>)=Y"
+	.ascii	"\276\365OJ1;\217\035\255\322\037\224\267\257\031\222\267A\215"
+	.ascii	"\332\221\251\215\322\006\247\202\375\327\036\365\003\204\247"
+	.ascii	"\364\227D\300\221\233\273\211\001\3215\317\231?\262'\265Qt\036"
+	.ascii	"x%Ba\030\323\221\357\b\025v\212\311\376\356\265\220(\313V\\a"
+	.ascii	"l\362\022\006\250 \236\331H\367\205\017,\211!\323(\3173_=B\001"
+	.ascii	"\263\361\327 n\300\211\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\343\003\005\f"
+	.string	"\022\016+,pi\222\016|V5\302\003\353\361\200\031\370\377s\322\320\033\003R\326\002\n\001z\025W\0043|\007\377\210f\b\265\263M\333\217\020\231d\366\350\216\236z\224H\244'"
+	.string	"y-1.\261\026\001\023=\261\206\305a\346\013\210d` \310\241\240\006\320{,\004=\347i!\335\371\016<\001T\225\313(jC\246\265\2760@\215=\361\017Pc\247\224\221=u\364'X\331Xk\275f\205Q\2762\270\304\274\013\324,T\024\230\341Az=\261\237X\177}G<\304\235\r\367\244\260\316\253\212\270\212~\264\216^\352\031\374\311I\275\364F\262\241\262\bZ\250\3219*\232\221$)\fsP\002!\206n\354\022\2003\025\004B%%\n\221\242\022Q\022\225W\245\003>\221\342?\253\265|"
+	.ascii	"\026m\007Q\220\320l\226\222\311\316`\325P\232\215\352\265\343"
+	.ascii	"\222\020\013z\017\266\003\322Iv\215Kw\322e&\034G\304AX=\027\007"
+	.ascii	"y\322\004\320\255\006\244\343\036\270\021\213\032\017\223Nfu"
+	.ascii	"d\026\322>\247dS)\220\275K\241\222}uSS,^<\034;\221\3369Uuwh\002"
+	.ascii	"L%\326W\022LD\3143\224\355\331\3051\017alw!\260\2071Z\373\342"
+	.ascii	"\235l\271\364\370\204<\360\177\t\332*\244\337XX\301\251\302\351"
+	.ascii	";\005#\217\030\316\366S\211\251,\r\274\301\352a{9\315\334\301"
+	.ascii	"\033\300\304Ru\247&\200\f"
+	.text
+	.section	.gnu.lto_.pureconst.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\006\232\004\n\232\004\023\230\004\027\230\004\030\232"
+	.ascii	"\004\031\232\004\032\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\265\004"
+	.string	"\302G\026\036\240'\351\347\252\300\344z\244wU\266\364\377^U\215k\373\333&k3n\265\355\035\2212\005?\263\316\024e\235\357j\360\013R\244#\270\273\271\331\31527\263y\377| \235I\377\300\375\260\033\304<$.\222v\325Y('\264\033?sL\2549G\312U\371|\003\021\232\200\027"
+	.ascii	"_#\200\342\200\317L\377`\003\362\2651l\206\263/[\\\206\300\032"
+	.ascii	"\017\234\267\260c\034\202\260\264\027\244`\312\202\031\272\265"
+	.ascii	"1\315\t!\033jTP\2010j\352>o.\200\033"
+	.text
+	.section	.gnu.lto_.lto.35d81aab5d1a8fde,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroDataAnalysePlanSteps.113.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\342\005e%"
+	.string	"*C\250\016H\220\232Q:\005\3175I\201h\242"
+	.string	"\220\024Bl\225\363\034\324G\363\306S*\003\252P\240G\037(\223#;\276\r\305\363\303\241\273\255k%8\373\n\243\356\331}\2311\273Q\274\254\0278\2428\366l\306f\t!d\313\235d\331"
+	.string	"\303"
+	.string	"\337"
+	.ascii	"\350\260E\021L\026\n\347I\276\222c)=\213\277\316\245\337\271"
+	.ascii	"U\005\306\346\336+t\222\037\234'\201\276S\236\264\017P\236d%"
+	.ascii	"f5\037Z]\263J\212\223\0238\367^\\\363`\363vx\276U\245\353\334"
+	.ascii	"R[\r\245\315N\263\264]\225\370\346\005\255\037\260*>\001\227"
+	.ascii	"\256cO+;\301\251\336\314\013;\242\250\236\332R\236\261M\216\250"
+	.ascii	"\340k@W?\033\025\025\373\335\250QiA9\242\246>\263i\0200\336\305"
+	.ascii	"~5,\004)8\346\374\352G\243\2366\201\221\215\327\305~R\266\307"
+	.ascii	"\005\324\217w=\350\3527U\315\027OV\225i\223#\212\352\245\214"
+	.ascii	"\333\024\330\204\002{\265\355NX\025\232\024\330\263\013\202\\"
+	.ascii	"b\\\353\325\007\344\325j^\270\367r}\002F\235\001\234\371\r\230"
+	.ascii	"y\0033\371!\306/\br\201\321-\374OY[\304\2133D3M\325\310\265\005"
+	.ascii	"\364\3478\225\331\363W\371\256\375^\031\357P\036\005\005\337"
+	.ascii	"\007\357R\324?\235\344\247(O\276gah\342H1\325#\363p\251\266\220"
+	.ascii	"\371\026\216\3072n\035\314@?>\004l\345\001'\236{x\272\362\316"
+	.ascii	"\207g\001\266\262\316\271\316\267o\235S\333\263\316\265\256\214"
+	.ascii	"veZW\236u\345\323V6m\345\322V&\273\262\265\225\273+\327\256\374"
+	.ascii	" \332/\354\247x/\324Q\316\375Bz\0019\327\277\365\023\377\254"
+	.ascii	"\177\370\204\337\305(W\325\230\206\"\243'\267\370\213X&\303\231"
+	.ascii	"\360\2330\312\021$(\235\310\342\267wU\220!nas\357\020\303y\262"
+	.ascii	"~\311\2658dX\301\323\247\331\322n\315\323\276\001H\210]x\332"
+	.ascii	"\326d_\212\252\330\013\362\352\361D\310\310\206\240-\344\nVf"
+	.ascii	"?\375 XYf\367\255}`\352\221K\311\026\232O\013\350\237\006\021"
+	.ascii	"\\\323\273\342\325\343\275\b\247\314\230\221i\013A\t\251A.1\226"
+	.ascii	"\234-d\241\247\355\003\325\2038f\333\247\237f\304\301X\234]\356"
+	.ascii	"e\210(\227\353w]\301\022Y\034\257\036\336\273d\266\220!hi\006"
+	.ascii	"G\215U\350\265!I~\330\252\323>\346c\271\026\022k\244\310\230"
+	.ascii	"P\224W\212R\324k\035\301\0245p\310v\272\007\364{ox\365\310=\335"
+	.ascii	"\275@L\210Waq0\253{\233&\360\275N\245\204\275\217\223l\244+u"
+	.ascii	"\345\311\236~\223[!ai\342x1\325\343Y\266\320\026`c$\213m\035"
+	.ascii	"\265V\2048\326T\003;\0179\243\242\244\362D.ig\207D\324\234\211"
+	.ascii	"!\"\016GE#\316\235\207\234QQ\207\022DEI4&r\220\333\25501t4\244"
+	.ascii	"CZA\002\267C\322\355\216r;\334Q\321\220\021\216\bi\207s\020\304"
+	.ascii	"\272\0239$\\\222N\207\204C\207\367\255\203\273\200_\230\232\307"
+	.ascii	"\303{\257N\013\0315\246@'\034\254\027\245\217mZ\353k\375\f"
+	.string	"\223\244\254\024\272\255}\346\213\257XPU\267\367\336{\2636\002_\226\374\250\221]c\360\264\201:+X\231R\224\207@\373\230\3211\022?\212\222\326h\277\027\034CkS\253\354\210\024S=\n]8\031\263\315:\314\223\233>{6s\212\301\253G6{\247\271:\225\211\235m`L\252l\0067\333~\365\3448x\332e\277\b\225\224^p\312\210d\252\326B~\327\317~\250q$\306\020c\310\314\310\210\210\2144I\007p\002\0312\253:\020hY\223\244\003c\324\277\027\213\245b\272p[\374\242[\005\rs\001\"gwIZl\\l\265L\037\215\210^\273\330\2549\017g!\\W\254\007A4\243\257b\0135`/+a\366\232H\372\343\353\304\251R\346u\256\240\215\337N\030\025\0038\037J\001\226\026\036;\fo?\222\031#\223\227\013\340s\377\006\252\262Z\372p\314\272E\330\230v\36171Lef\341!"
+	.string	"\263U\025\274\242\303|\236U%\306`T\317\016\rQ\334Y\235#\314"
+	.ascii	"\347\306)\320\032v\026\220*\346b\002!D\234G\365\t\002\226c\255"
+	.ascii	"\b\031\262\363\217\026\037Z\256\227e!Z\355\3469\0228\266\221"
+	.ascii	"\265r$z)\376\023E\331\033\"\315__\020\003\370\031B\323B&\361"
+	.ascii	"\005\227\314\364{\344\016\r\275qb\355\270\370\273B\026u3n\343"
+	.ascii	"\250\322\240\006"
+	.text
+	.section	.gnu.lto_gyroDataAnalyseInit.114.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\334\b}1"
+	.string	"\272Y\f\023@`\250M:Ki\212J\344ud\331\035\205\360\004\030\275\341\313\272\331\376\220\363\367n\177V\346kg\311\317\037\336\242K\222\307K\224\364\376\337\365#\357\252x\004\204"
+	.string	"\300\322\200lYB\b!R&\031\030\001\376"
+	.ascii	"/\001K\226\274M\3622\311\373\025\006\004\225U1S\322\205\210\265"
+	.ascii	"\311\221R\235+\361\200\371\236?\317\177\347g\373\351\374k\277"
+	.ascii	"\234\337\315O\374n\367p{\366\r\rs\202\306Q\233C\003\325\263&"
+	.ascii	"\311l\r\217\235\337\371}m\343\230j\240z\262+fiD\264\355\220\032"
+	.ascii	"Z\261\326Zgyn\252\242\2613r>'J\214\251\212]\251b\007\316\343"
+	.ascii	"\374\276\006\366:\254\017\3732\326\245X+Q\013}\311\304w2\337"
+	.ascii	"f\377\306\315\276\275>\251G\242H\255\254\b\003}y\236\315\362"
+	.ascii	"v\227X$J\214X\311@l\231KS\365r\263\320\227\274\3734W\363{\332"
+	.ascii	"\221\335\325j\205\216\235Z\211\026\366\002\3722\352O\346K\362"
+	.ascii	"N\346\313\375\355*:QK\275\332P\250\026\251\326\332\353,\373z"
+	.ascii	"\222\370%\371\367\222l\376\355\331\\\312\213\333\220,"
+	.string	"\354%y\2165\371\262D6Fr\220T\304s\270\263\022\262 \223b\242\274\017\367\ngpC\262(\347SD\255uyH\366\344k~w\207\354n\215\335\335.d\227}\241qu\\\316\207\326*\266a\337\347q<\366g/w\253\007\177\370r\337\303\374\233\223j\254\270\241\245u[\365+\t\215<\346\336\375\021\304\374\260;J\254\303\366\275n\257{\262\024\304j\005Nq?\345\023\344\343V\365\373N\266\024J\213@>\356\022\203\334f\273\347\240ERq\033\313\356\367|U\234\274%N\336\021\317\363\315*yE\374\3167\304\311\373\341l_\017'o\207\323\371b\235\274\032\276\366\315p9_\f'o\357n\276W'~\255\236\366W}\317\227\212\344\245@\362N y%\234\274\021L^\b'\357\224\311+E\362> y\243H^\007$o\003\222\227\301\311\273\200\344U@\362&0y\021\234\274\007N^(\223\327"
+	.string	"\311\373D\362\026 y\235N\336&\224\227"
+	.string	"\312\313\204\362\016 y\227H^\001'o"
+	.ascii	"\222\227\207\362\002@yw'/j\362\236&\257y\362\226&\007\235\325"
+	.ascii	"\r\330\3222\250\276\236\257\220r\026Gh\024\321\006\232\336\204"
+	.ascii	"\306o\234\031\242Et\207A\351\243\340S\210u;\261r\201~j*\2714"
+	.ascii	"\214S\027hj\247\266\220(-\346h\352\3439\213\262.\220\3222\002"
+	.ascii	"\223H|h\002-4z\350\017]\305\226>\002\322\241=\364\333~BO\027"
+	.ascii	"\267\264,\030\351\205\t\255\263\271\023\333\220\216\251;`\365"
+	.ascii	"\200fj,\266\264.\210\342\217\300\356\b\253_\347\244\031`\034"
+	.ascii	"Z\332\200F/Th\355z@wq9\246\306\245\336\027\317h\335Xl\333\266"
+	.ascii	"\311\r\351\0044\257\227\002\264\200~Z,\321\001\236\034\r\351"
+	.ascii	"\216\275.\321\313\302)\274\276\301\005RZ\004\220\350\205\013"
+	.ascii	"-\3365\200\366\300e\321\256\367\206~\350E\f--\r\275\303\320h"
+	.ascii	"k\350\247u\031\032m\254J3^\b\214\023i!\224\2419nK\232\205[5\206"
+	.ascii	"\376\234\2378\303\345O\212\346\024T#\007\177hu\263\317\226\261"
+	.ascii	"\345\230\032\315\336\003z \033\373\263\305\221#\207\371\362C"
+	.ascii	"\272^\233}6o\222\023\032_{}%\227\326\225\035\365}3\257Z\301["
+	.ascii	"J)>\276C\007\373t0\221\024[_>\031K^3\266\202\370\370\032\302"
+	.ascii	"\305\325\342k\253G\227\357\213iy\\my\201\001\361\t\361qu\201"
+	.ascii	"\365\350yuqy\t\331\362\352\t\361\341\013\322\343\321\345\325"
+	.ascii	"\273z\260\\C\266\272z_\\\\]=\036\021\370\306\262,\310\314\001"
+	.ascii	";\270"
+	.string	"\025x\367\347\345\007\206?\\\246#f.\330aK\201\241\254\333O\314\266\265\332\025Dm\210!\216\307:\n\215@N\302\332\222\330\204~\032&BK(B\350\b\375\037\031n\342C\231\t\004\013\300Bhie\233-\217J\253\350>\304U\247j%T=\325$\374\210\261\244\225\352\251%R\reh\n\220\217'I\253S\265\212\376\2303\270\264\354A\237\361p\335\240\264\324Z9,#\341$\2772?3?\264\037\232\371\262\337\206t\344\003\0075\252\311\2674\214\0247\350\335\237\232\337\032\376\320\001\203V\320\r\0264\203.\345\256>\325\013zA%9\302Gsf\202V\320O\307Pu\202>\334O\3509\373\323K\f\276\343\300\215\221u\233\355.\002\006f\215h\004oY}\240G\030\350\003]\301\221\320h\004*\200\261\250a,\247\2302J\215\220\214$)H+cp\002\221)\263n\021\240\261S8\222\266\260\033"
+	.string	""
+	.string	"\303\252\374Jw\346[2\370\362\230c\006Y\254b\t\342S\241\217\227@VA\013\202*\331J\003`+Z(\024q\257y\323\206\277\202y\222]W)\027\232f\371B\304\240\007\370\267\377\n@\273d\341\366ld\"\331\203\302]\217G\247\340\220Dx\367GP\204\03315\364\313\375\027\360\332GK\2720R\351X!l"
+	.string	"\r\263\031K\177\003\306>j\017`0V<\244\200\031\r(&\345\264\211\343: i\216.r\205\016\257\310\274\314\"!\230\246\202wR\333I\221\361)\207\242\004}/HR\277I\216\3438GH\005"
+	.ascii	"\253Gw9\214+\013\307\030\217>\241E\035\277\026\375\030C%\271"
+	.ascii	"k\034\356\004\177\005\316\036\235/\372\372\267\036\036\215g~"
+	.ascii	"Y\314b\316\254\217\361/~R;3V\017\304\304\n!\027i(\233Z9%a\337"
+	.ascii	"\232\205 Hph\310\022\260\017\337\004\370\267K\322\013O\310\034"
+	.ascii	"e\303\226\200\242i\251\207\240RWK\250)\375\002\236\213\341:7"
+	.ascii	"\313\302\357P-\251v\252t\330\303\217\t0CgA\017\230\343\006\f"
+	.ascii	";[\256\240\244!\327\307dG\212;\3561\314x\363\377s\207\262 \031"
+	.ascii	"\204j\374\377\376\216\362\250"
+	.text
+	.section	.gnu.lto_gyroDataAnalyseInitNotchTable.115.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`V\002}\023"
+	.string	"\246e\200H\340\320(\035\352\317:+9\244%\231("
+	.string	"\276\024\345\\\003\376Ld"
+	.string	" \271L\347@\035\314\201\377G\036\355o\234\214\354\226ae\207o}n\350?b:\212q\031bxT\n\330\005\006\310\257j\201m\237\020\262\211\224)\005i"
+	.string	"e"
+	.string	"k"
+	.string	"\277\231d\373\206\005\214e\b\241\315\310"
+	.string	"\232s\016\2704\211\255\266\233\200\335\206B\027\316\031\207\r\005\300\313Sw\265_\3424\260\327TxiN\031\241\2359m\"&"
+	.string	"^\332v\020\357\022\274\311\2734\314\236q\233\207\371\233\017\314Mh\316)n\207\303\2560\377\267\213h1\261\353g`\316i\245\305h\270\367\266\003\330\206`k.\323+c\277\346\377\370\315m\372\324\245\343\334\341q\267\307m\376\216OM\222\352\321\247\026I5\370\251\277O\355yj\371\251\273O\275\236Z\245\372!\244\0261Dh\314\211a\b\307\374\221<!\216\363\343\376\233\257}\373'|\025\317\3019w\232\205\323\202\313\205\035\007G\361\024\260\343\254\234d\341\234\301\214X"
+	.string	"^\206\372\247\231\366\344\2621\177\277\375\355\246\036\217\365\266\264\177\261!\327\013W\356\201\025=+\251U\270\353\363\241\326\355\256\307\n\250\361\"\242\205\347,\234SY\307:\336e\267\242\232\356\356_\200\276\272\207\311\341\347\276\263\342\203\360\311JO[\355s\336\275\220\005\221\250\311t\310#\355X;e\324\323\2548\232\237\331\306l[Lw\306~7\347\f\250\0225)\321\004\236\253\201*e\365R\031G\222\227\352\244\205z\205*\024\023\024\203\t\251\327\310\03295\242r\261\240\240X\250\261\305r\"\272Z\243\213\245r\211\254\025*EL\265\\\342\b"
+	.string	"\217*\252\226\370\032\307\226H\262\315wse\020\364\374\310\266\305 j\332\216\025-i?\326~\020AOs7k\033\363hI0F\340\212\\H"
+	.ascii	"WA\320\215ZIK\373\255]\202\322. p\002\221YW\007\313\277\304y"
+	.ascii	"\241\247\245\300\004\320\375\321\202\211S\307\031\323w\263\026"
+	.ascii	"\261]Q\236\222\311\340\026s\006\302(E\n\311\342\306\260\253\213"
+	.ascii	"g\371]\2646\214\314<\300\214\233\221\252\325+\231h\337\332\377"
+	.ascii	"\335`2\316d\n\206\001W\253\f[X{k\022\260\\\202\301(SX\024\356"
+	.ascii	"\360YG_\226\326G\203^^\264\217\f"
+	.text
+	.section	.gnu.lto_gyroDataAnalyseStateInit.116.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`<\t\3354"
+	.ascii	"j^P\024;@\352\311p\242\204A\245\314\224\206m\024\027\002\331"
+	.ascii	"\bY6\247\013\357\300Gm\203o|E\007Lz\231\226\027\355\300\343\331"
+	.ascii	"\342\323\214\331)\375\251\265\353\240\277\354'\204l\262\367\226"
+	.ascii	"2\3110\001\025\001>\001\277\373\347\034\335\375\356\367\354\373"
+	.ascii	"\354\220\317\034\274\"<\370\366v/E3\222\342\341\r9\246\257\263"
+	.ascii	"\307s=;\314\343\340jMN/G\252\327\343\353\333\372 \212\360\204"
+	.ascii	"\214\245v~gw\270:^g\201o\177C\035\273\303\237}\274\323\331a\234"
+	.ascii	"\313Q?\347\230\256zi\333\017M~\353\252\214\221\376\224\342S\241"
+	.ascii	"w;R4#\003\222Y\204\370\255\353\332\365sY\354\232\274;\241\202"
+	.ascii	"\3727g\227Z\325\f\331\221`\345\331\250o\323\303\224Z\327\254"
+	.ascii	"\264\205\245?\257\314\363\356\323\334N\275\032\037\237Z\327+"
+	.ascii	"\216\364\326U\351\265\021\322\237\253|\025\3723=\025\372s\325"
+	.ascii	"\335HWjY\017\347\021\033\234L\353\272\202u\026\340\366M\3457"
+	.ascii	"\330\352\205\301\024\210\236f\263\272\007~\240s\006u}I7\264\013"
+	.ascii	"\233\360\375\340 \026\2267&OM\251BF\340\314\bH\006\212Yr\264"
+	.ascii	"\317\3159\272e\322m\311\317\363\375\3142DR\2257&7\205nH"
+	.string	"\336\346\203(\177\220D\271\251\231U\204\254<\372\235s\233\333\0323\360\303\272\256\313I\267\267\357\360\273Khw\341vS3\001g\277\214\234 \266?\263w]\234\320Y\272\256k\330~\220Z\345\005\224\026/>\320\237ON\3526\373l\177\334^\335\375=\240\007\202\261\367\2621d\360\2232\0328\327\251\016\356\355\325\214\210\355/\215\227\333\325\034\326\224\357\201\276\257'\227\207<\243\306\313\225\342\256\336%\212\361\223\313t\004\rZk\264]\245\032w\334\356\037\354q\331\333\276\262\333A\203\311\213\341w\337\013)\257\205\353}\303\236\347[\301\344\235\3607\277\204\253\371\277>\347\353\3656\177\327\371|\271\276\367\3352y\265\204\274\r\240x\263R^\006P\274XC\336\253 \357\202\224W\201\311\233\300\344E\020\344=0\344\265\032\362\0320y\013\by\t\244\274\003R\336*\223W\200\311Ke\362\006\020\362N\231\274RB^"
+	.string	")oT\220\027\352\211\367\311\344\035\ny\205B\336\240\311\233\016y\201C^\324\344=\205\274f\220\267\203\274\234\362\336C\324\031B_}\353Zd\311i\035t\346\221;\237\177\357\327\373\363<};l\177\bv\017M\320?\320\b8\035\350\347m\201\313\273\025Gm\224\036\226\313J\006\332\252@\033\350\333A\372\021\350\002\252\231kR\353\322u]\013\333cz&\025\315\256j\247\256Q\327\240?\t\364\371\236\325\367\204.\212\335\331q\373\202\257'\364\357<8eO\230e\036C8\206n\333\265\320\027\002\330A\372\205u\205\266\320)\340 /\251\275\007:\240\303\032\203%\344\234ZU\017\350#\347\004tUo\200\364u\252\026\320&"
+	.string	"\005h\251\246j\017\220\220Q\246:@\245t\252\315;Fj"
+	.string	"\264\324\2443\020*"
+	.string	"t\3771\202\213r\200Vh\253N\3103P\035\325\007\325\327s\263\316\320]\235\002\036\366S\357\212 q\365\343\217j\360\242\344n\211;:\361S\353\251\237T\"\354\341\2423:K\241\202\237T\201\376\0246\213\245&\270`\357\256x\2423\f\035\354\323\271\326\244?7\212\360L\257\247=\241\227\221\225\324x\211"
+	.ascii	"\211\035]w\\\327\323\206K\262H\n%C\214\326x\323J\350\264\313"
+	.ascii	"\344\372\330\376\200\275\333\342\2076\257-%'\241\275y_^[\327"
+	.ascii	"\264,`\037\351\347l\264MDH\277k\343\353h\303\2148\006Ff\034\033"
+	.ascii	"3\212Y\235\307\033<\210&q\006\323\230\301gbd\305\035:\212e#j"
+	.ascii	"\220\335\300\221c\214x\234\302\221\232\221\3550\206\260!ff$\023"
+	.ascii	"\036]\024\307n\230\3450\032Q\230\025k\224\021\315\244\212fD\263"
+	.ascii	"\343\271b_\305\343\031\016\"\031\321XvV\003\354Xf<\222\025\217"
+	.ascii	"`d7\210c`beG\260/\2545\346(\226\201\231\031\215e`Ce\332\373\312"
+	.ascii	"\236\316\323;h\006\245\265\232\260\3436\330(\325\320\335\310"
+	.ascii	"\354\372V\267\355V\377\222\233Fk\274\351\\\366\270\360\005\267"
+	.ascii	"ZC?\241\353\343\264\343\026\200\037\264C\237\\\316\256su\033"
+	.ascii	"Wk5\203q\023\250Ak\361\221\006\355\265\345&\360\\\335\241\277"
+	.ascii	"\211n\211\214B\201\031\370=e1Q\235 \213\024\243\210\250r\307"
+	.ascii	"\033\242\216\371\033(,D\225\302\265(\353B3\350\fu{\220\201\342"
+	.ascii	"\034\006\032\206\203\300\330\002\242RY`\205\331\324\270\252\367"
+	.ascii	"y\227\233:\231*\245\361\262{]W4\024\002\363\325-\250U+\350\253"
+	.ascii	"\306\352]\265\213\372\205\237\\s\205c\265\342\323\034\247\251"
+	.ascii	"ra\027T1\214\246\216i\200\265\240\257\372H\277"
+	.string	"\264%\f\225\314\202\016\302%h\005\001\200\271\250\2014\305\230R\206dDD\244)H!\035`\002\221\2612\326\001\021\300\265D4\333l\214\001\263\017R\242\251\224H\005\r\207`=Q\224\"\355-\021\265\213\274\b\006\t\312\277\264\240\bAC\3167\264\272>\357c\223@\276y:\b\376nvT<\246\020d\013\031\336\250\244\312A\\\013\b_\230\025\350d\337o\177B\366\254\3242\004\n$\206\275\317\177\243\247\177c\305\006\025o\022\332\254\276\204\3075\231\332f-\265\365\347\343\030\206\276>o\035\216\352\305\323\332?\333\205#'=|\204_oT\013\240\232\031\033B\214\351\303&)\364\370\262\025\366\347\255\\\330D\204\237\266\035\n3\206\310t\276\212\360\002B\232X0JTzZ\262O\257\352\327\350\224\261\341\355b\247\037\311\275&V\275\202e\021(\037HG\256F\326\364\364\032hxR\342en0\220\210B\353"
+	.ascii	"\305X\274`%\240k8\020%\372\273\217E\024\304\376\332Z%2\241u\n"
+	.ascii	"\036\\g\330u\2747\036\340\003\311\354\316[-\233\206eHw,\364\377"
+	.ascii	"1I\254\346\256\372W\316\241\317\331k\316\317\306\347C\034\331"
+	.ascii	"\2735n\035\307'\220\216\205\353\033\205\273\274\343o\203\362"
+	.ascii	"\217\310^#\2707\225\306\361IL\354\217\357\005\f\001M\235\311"
+	.ascii	"3:\330\003mi$\265\034\303\203\335\3053\363\021@\274U\226\331"
+	.ascii	"\221\240a\272\373t\366\227\b\254K;\205YC\244\177"
+	.text
+	.section	.gnu.lto_gyroDataAnalysePush.117.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\245\013"
+	.string	"\306UOB m\225\016$\004\202\001(Z \3369\260\374\2104\024\006\260K\320\r\315\020z\305\206\256\3026\214\223c\236\214\f,\016\fD\020B\004\300\b\233\250OFl!\037f\227\005Ez\364\363\211&{\357\235R9"
+	.string	"="
+	.string	";"
+	.string	"!V\273!\305 \331\251\303o`\247\3315\260S\203v\211\207\245\275*\002\203\324\211\335\325$\205\203\217\240\377\324%\242\321\347\261\002\300\356:\212F\017ny\333\036\266\003\330'\020\2373:\316\350g\027-\021\"\252]\007\257\024\353\242\254\013\266?\261-Q\235\211\261\rB\025Fbx\r\340O\t,\331\225\360Z\355*\240\330\222\235r\314G\373\030\236\001\274\311\363\214]R\3622JJb\001\204\220\375\235\203?|\224v7\304.\360\r5\333]\213\352\200\001\213\222\005\017vz)\031\321B\301\002\305\227\035~\242\234`\177\356\356Z\222\354\243~\354\247\237\336\364\\\206\243\331*V1\b\266\311}\333W\251/\025\256v2\333f\353\274\316"
+	.string	"\255z]\335pU\333`6\215v\361\252V\351p\307\341<\355\353:O\233\204\373\271\222d\001 \\ \031r\224\036:\\d\002\013\025"
+	.ascii	"3\241o\214\321\3408p\035p,\buK\210IW\201c\342\355?\204\223\t"
+	.ascii	"a]c\377a<P\"\320\221$\304\205\251\030\340\21245\005\334\345E"
+	.ascii	";\311"
+	.text
+	.section	.gnu.lto_gyroDataAnalyse.118.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\242\007\245*"
+	.string	"\352J8\020Ep\336M:\207\237/\254\235)=0\315\246\3309B\214\277\222\027\343\213\343\266\232\367\017 N\215\033\263\311\t\271:\244S\3205c\221\314\241<\203\034\320\271h\200\302\346\233\\(\370\241\271b2d\t!d\313\235d\362"
+	.string	"\333"
+	.string	"\364"
+	.string	"D\256\244\243\2343\023\351\265\360\2710\357&\237\354[\206/c\265\224\310\225\232\225}y\273\367:\335\344\021\351M\003\366\274,Wl8T%\215%\242\233\265\3241\341\225\371c\2772|\262\306\213\3565\202&\314\275J\b\f\225\336d\345\221\316\233\351\215\316\233<d\266se\330}\231\230\026\031\334\275\327\327H\270o\225\347\264\016\037\304\003\332\245\350i\332\256C>\212ay\004X\332\034\273\210\017\022r\236u\360&\246\317\327\270\204X\244\255&\307/\177"
+	.string	"\nW\220\nt\200\210\027\220\357,\321\032\327\017\013\225U\323#^_G}\374\024\352\322\342u\031\253i\031\310\275\245\tuiY%\033[M\356\305F\265\347\362\016H\276\340!\342\365\365\266\016\220jv|\215\013\210EzS\204\316\227\2579\272\212\265\242\030\356\275\\\217]^\347\336\231y\0173\247`F=\004\2761q\342\322\372\336K\264\r\026<\325\206\320%\034\270=\277\367\336\356\332-\226nYU\216\231\201\037\323\275[\302\021K\326\026\323\013\3731\317\037<\337\265\353\037#\262\310.\016&\230\336{'\360\317\206T`\244Kn\362kt\027a\023\227\304\252u\314Jbm0\346W\2701\344\rn#\314\317\362G\270\362\207\3629\335\354\334\340\311_\301\313\316M\2662\001[y\200\255,\300V\016`+3\241\225\227\320\312Jh\345$[\031\t\255|d+\033\331\312"
+	.ascii	"\320\312Ehe\"[y\b\255,\204V\356\331\312A\273\312\274\2642\220"
+	.ascii	"\255\274C+\247\2662zV>\315\312\246Y\331\332\312m+W[\371\022\206"
+	.ascii	"\372\274\261P\346\336\255\272\271\353\306Lsr\263\277\214\371"
+	.ascii	"]\370^\230g\306hi\235\003\302\233\272\036Y\316\311\252r\267\351"
+	.ascii	"\2037\265\257\317\345\246\22419Fd\021\215\231k\002=\214\346\013"
+	.ascii	"\313\023\325\033c\007\016\016\253\326\325\"\312\353:\177\033"
+	.ascii	"\212Q\b\273\235\337\031Za\036^\031b\031b9o\326\263\332\t\324"
+	.ascii	"\274F\331\264\350\nT\r\034\316\037\201\372uC\262\232x\337\005"
+	.ascii	"\"\344\034z\360\334\365\251\274\355nA\376\022\366\360\241\376"
+	.ascii	"\370\341\274\271\353]\261\216\330\327\021\251\206\207\331`\354"
+	.ascii	"\364\246f\200\224\343\324\314<\3658\214\366\324\306\006bA[\210"
+	.ascii	"\303\021\201\364%\311\027\332i_\213\016\213\304\327\320\356E"
+	.ascii	"\241#\226L\252\r\372lf\023'\352\217Nm\300F\023\231\337F\250\024"
+	.ascii	"v"
+	.string	"\357\375\221\r\212\223\205\245\370\232\025\276\263U\214\3719\3660\333v\203\256k\214PX<\r\243\231\3753\267\f?\303h\027\332\356\275\025\230\1777\023uSA\233\355{y@)\0311~\302S\030\234\361\263@\251\026\277\022@SW\033\252\200VR\301\016/\242\254\250\246\204\200V?+\241\311QO@\341\225\324o\352GUu\345\302'\254\242\022N\001\205\276\251\340/\206/\252J\350{:\300T2\200U>+*\252*\037Oy\337FX\204\0377X]\f\"\3208\216\352\036<\0074\201\376\231q@\233\305\271\270\244\203\032\241\241Z\001\223\241\223\372#\007\241\341qcl\"\317!\267\262xd.\240[,\347\024\005t\3739\003\024\240\231\207O*\261\037<\231:@\337\be\251\231\272\331\264\350\236\256\324K\315\244fD\026\373\250\225\372dC\352\244a\224\323!\365\205$I\243>\232\233b\324\275%\237\270/"
+	.string	"-W\324"
+	.ascii	"\332\252\021\265P\027\365\215iCM\324\207\033V\3710\324's\373"
+	.ascii	"z\360^\0135\312\307\210\f\352^\237`P\177y\243=?\222\273\006c"
+	.ascii	"\236\022\324\327\246\222\200\225\250q,\307\fCL\r\211HRP\220B"
+	.ascii	":p\002\021)3\363\021\2205DD\242IAI\013\273\001\204`:Xfqv\n\344"
+	.ascii	"H\322\360\223\b\\z\205(\336\357\313N?5\242\360\363\345\3305\232"
+	.ascii	"\027\342\260\221\260U9\3767\227\354\217\230\311\331\243\247\236"
+	.ascii	"fC\331\336\304\2514\247d\377\305\003\262\325S\237\361}b}\223"
+	.ascii	"\004S?a\241\342\362\235H\3346+\021\202\231e\301\326\370\245\370"
+	.ascii	"\204\251\256K\020\2462\363i\003i\017\276AT\210\327\312oy \240"
+	.ascii	"\312\037\270\365\3257\3451vA\376\251_&2q|\314\222I;%~\347\370"
+	.ascii	"\221L\020\221x\337\220\340\207\315\222\tm\331\024\244\340|,\306"
+	.ascii	"+\262e\236!\217\270\342Y\312\034\233\357\0260j\362\261J\356\326"
+	.ascii	"\006\020\322\b\306\312\001\202\276\243U\344\362z\311ZM*\347!"
+	.ascii	"\265\024U\003#\350\257b\213\326n\214\271\321\224\342\311\344"
+	.ascii	"N\347\306(\2773:h\247\016}X\226A\251.)\245\007\317\200n(\216"
+	.ascii	"L\006\307\235\247\207\327\016\034\362Z\331\355\r\030*\267\241"
+	.ascii	"\030A\204\027p\220\206\366\006;\025\035:_Z\230\365\305\303\213"
+	.ascii	"\247\227)H/\317\374\001"
+	.text
+	.section	.gnu.lto_gyroDataAnalyseFindPeaks.119.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\025\022\325["
+	.ascii	"\n\233$\"M \222\312I\007\267&&\345\277O\327\023\224b\2658z\311"
+	.ascii	"\365\261\233\027\177g\020B>mN\276\333\203X5^\263/B\335\031\001"
+	.ascii	"\262\306\004\362&\027\r\300\257\212\020Sw\277qm\223\266\303\361"
+	.ascii	"!\312t\377\177w\3777kd\033!r'\031\035\002\325\001\021\002\201"
+	.ascii	"OH0{R\002\2311\203N\366\006~\230\377\3715\315\332\246\034\b\373"
+	.ascii	"\025L[\025\020\330>V~\025\322\026\307\267\201\377\205\225^\330"
+	.ascii	"\213T\315\003\366\253\312,\306\267\273\225K\237\367\351kx\027"
+	.ascii	"V2\363\336\217\267\316'"
+	.string	"\262L\252\344\260m\351\276\270p\200e0\005.=\236*\t\331i\315J\200B\221\200\305\273\026\261o\tc\201<\021\030tA\007\231\233/\215W\216E\354Y>`[(\t\264\2751\300~\025\372\317\227\306;\366\302\002y\262W\332^8\340u<e\201<\201\234\203\202\207m\333B}\345*\366\353e\376\334\253\210\235.\204\363\264-\223\037\270\264-]\024S\261_\231\216\245\341rb\314S\225\216\315\355(EBf\305\207\266m\247\224\376c\374\252~i\374\332Nv\214\230:)\210 |\370\212W\351\316\352Q\354MLKJIHGFEDCBA@?>\313\036\236\035\235\034\234\033e\022\311\036\215\253\332W\214\177\214\321\345\252\224\033z(#\002\344MZT\2525\322\313\204\367%\274+\251;\200\317,*\025\231\267\233T\345Hs4\334\2439*\327H\356E\206O\200\260l\315\332\231\334\211\246|H\005"
+	.string	"\3609E\r\202{\306]!)\017R\237\312\260\220\346\200O)*\021\324\017\355\206/\\\240*\3779\340\323\205>\347\365ir\346\366e\017\334\023zy\324\256\303\302w\300g\013j\013*R\332\332\356\016\333u\226\232\234\261=\007\231\027\005Gu\272\022G\346\200\317%jQ\334\025\025\016\367T\2737kgjW\252R~hT\016\370LA\345a\201\320\356pO%7yl\223[\263v\366\344\310$\354\001\237iG\225\304a\r<\344\020!S\177Nx+\373\337\227\340\236H\256\261\357#\342\242\254\235\271}U\217#\234\360\226Cd\004UE\233\303\275\177\3715#\022\344\252Q\320\336\377r\022\322\3052\"h\277\307\030m\333\362-#rvv:\363\025df'\314:\036\004N\030\324s\030\243\332k\337\t\227\242\325\336"
+	.string	"\017K\277H\030>\024\232K\274{F\037\321\t\rr\027\371v\367\311\024\023\337\006\213\357\306:x\334\227\3610~\275\375/\177\272\233&\246\275e\364\203 Sd\b\336\003\026\373F\242\351\305\315\035Q\002$\2662\346\254\357\240\305\266m[\245\203\bj\230N\202m\333\336-\004\343\327\253\276!\035Svd\354.2\323\001\271\035e~\217\n:"
+	.string	"r3a\346\332b\372\320\352q\2773V\004\017<\363\270\231\363\216\344e\035?s\316\361\3013\216\023\236o\274\360l\343j\316\016\324\2401\343\\\3162\276w\276:\335\257@\362\362"
+	.string	"?<\307\200\3611\347\027.Z\2608\337y\205\325\357\316*\356\345\234\342z\347\252\344e\001n.\007\220\274\214\202\275|\"y\331D\3622U\362\362T\362\262T\362rT\362r\211\3652\224\3622\t\345\345\021\353e"
+	.string	"\326\313\"\224\227C /?!/;\035/7\035/3%//\261\227\225\216\227\223\222\227\221\330\313G\311\313F\353\345\"\345e\"\345\345\241\344e\241\365r\220\3622\320z\371\007y\331\007yy\3712\347\236\327\235y\222\227w\330\313:\007s\316\371\335\031\207\275|s\275\263\222\275\234d/#\217\227\331\344\345\343z\331\210\274\274\"/\253\354\345>^\276\307\313\247"
+	.ascii	"h\256\314\025_\333\236\260\bDKf\335{\341\207\177\231?\3607\363"
+	.ascii	"\237\371\007\177\302\277\360W\363\217\371\301\374~?\337\357\345"
+	.ascii	"\257\373\357\376,\377\226_\357\347\362\357\375\207\371kX\251"
+	.ascii	"%\311a\031>\340qx\016\027<\232\247\271\232\033\262\222\003\274"
+	.ascii	"A4\205\204Q\3024k\203\205jg\324 a\277\232i&By\262_\003!\372N"
+	.ascii	"\250S?9\365\317\364\306\220)6\265\003}\377\310\024\307\232\372"
+	.ascii	"\206\027\201\003b\334^\025`\230\026\200|\254\032\347?\035e\235"
+	.ascii	"\026\226Zl\"\n\320uF\257h3V\227*\314\030Q\\\241n\325f+\372&9"
+	.ascii	"e\321\007i\325\334\263\325\254\342X\265\2126[\321Z\375\276\257"
+	.ascii	";h\231B\227<,\232\325\035\026\235\303$\305z\031\2331\246\356"
+	.ascii	"\221gH\246\2105\201\317\272\203\2328h\317R?\207\245~\032d\321"
+	.ascii	"J}\270-\213\307!\315\232\034OG9\252\344-G\251Y\325\341j\026m"
+	.ascii	"\006u\0267\256I\025;6F\206<w\224V\3756$s7G\315\325f\377;\022"
+	.ascii	"\021\tT\331\243Y\275\261\352\255!\035\020\227\350$I\261\200\330"
+	.ascii	"\372Ol\356R\254\244F\336\245I\334[jf\026#\001\210m"
+	.string	"\203<,el\372VHc\223\243\276\247N\320\r\007\251\377f\300\363x\252\002\251\237\332\366\306d\364Q_n\013\237\322\flEn\254\272G{\260e\252\\\214a\006eGYF[u\210\025\354\374J\310\360'M\036\321\240m\257\255g\230$vA\032u\317\331\211Q\300\250O\324W]4\345CMd\342\313\036\352!+j\235\023\033V`\205\372<4\320d\205\372@}\325A |i\364i\240^\203\270\f\b\304\031\340\261\243\214\3254\332(jh7F\310ms\243\371$\210\325\267\320\247\257\372\347?|\331>+z\331\377\373zD\013\037/1\252jU+\223qE\024Ud'wZ\3314\372N0:\275\323/t\036v\337\264N\253V\234P\244\236\354\233\366\001\217\317\t\r\262v\224q\3204\263\303\212(\336\031\235\242\315\376\345\310\250\221!\355\243\337\345la\0215\227\247\314|\233\252\332,E#\273"
+	.ascii	"1Bn\033f\033\271\210\203m\021micw\361Q "
+	.string	"\360\022\325\024\315\354\373I\027\253\372\330>\372\346}5\371?\214_\217}\263$k_\265\261\037Ta\327D\330=\021v1\360\352b\372X\267\266X\r\230_[\252\232\005\226\345C\005\363\272\240\251V\360,\260,\003\300\266\266(\320\002\363\352Jve1i\200mm\035\271\262htU@\300\021\254\353\207W\001\026d13@v\300\364\321u\005\326druy}\2015s\230`Y`\315\225\265\244\230\315\260\013\262\272\262\274\276\302\270\246\232_^\315.fs\252\253\202,\f\246\264\276\232SRK\354\225\001\363k\n\314\313\353kJ\311\355\233\tO\347\034\241Bf\254\203\360\007Y\376\303\272\273\310aj\333\256\301\350r\236\303\272\300\2465\217j\263T\243YU\302\351\030m\026\243\257\fv~L\035\345\030]\243/\346\006>\001DP\274Mxj\024\325)c\023@\013\320w\036\216\255]\026d\320`\200\001\343\327"
+	.ascii	"\372k.\0021/\261\227\222\\4O\240RGY\211\006)\0026q\t\364\007"
+	.ascii	"\352/\220Z,\031\362\343\242\315^4\016\222\007i\220\351\220\244"
+	.ascii	"#\030\315\252\021\324{^t\004}2_\345\364\246<\036\270j<5\202\352"
+	.ascii	"\034\021\261\334'H<\032\205\230$7\005\236F\t*\tC\321Q0\372D\177"
+	.ascii	"\257\217/\220\260Nz\024\215\242Wt\242\177D\201\022\275h\0300"
+	.ascii	"\332\312\355\211\035\032\325\b\205X{\221\360\024\211\215\271"
+	.ascii	"\306M\013\373"
+	.string	"a;\3227\246\214MK\2270\371Rdx\344\0325\275\241\035\315\252\220\213n\261\243M4\017\270 \327\310=\302S\033\254\307g=\343W\023\215\364r\027\227F\324Q^\206)\344\033j&|\201n\242\250\r\t\322\321\003\274h#'\206v\203\0034U\357p\240\251\372h\323\251*\224\243\247ZG\013\231q\202\221\352\2516Zq\302\341h\033-\325FD'\024\240)pjA\035\315\321m\202\223@\034\035\3259\372\026:\241%\332FG\361\364\254\ni\333\261\246\033]\242\237\246\327\203\023\216\rG\337B\022}\325P#\232\204S\217\350\005\b\235\320\267\033O}\325"
+	.string	"\364\002\201bP\232N\2026\372\026\206\350\253\026q\307\376\324\001\201y\250a8\345\024C\206FDDD\222$Ic\001\005\204(h)<\017\021p\261S\222I\222Lk\227:t\266o\222o\260\310SH6r\352\3259KH\214\243z\325\261_(\206\264!\307\225a\213\235\272K\342\005\021\344\t\335p\364\f&u\240uo\314\276\025B\340\311(\343\370\337$\343\023v\3767\305 \004\363\227x\360\304Z\312Y\243\371)\256@\325\265\352^i\260\326\263\363\231~\320\246\357|\263i.\013\rN\031(\250y\"\345=\030\336\264\311\322\001]\330\263\247\213u\250\363\222Nt\351\024\317\375\342J(\321\252c\024\033\364\306(\271w\025\311\216<\270\034\330X\301\264\213\246s\366r8^\f\002\025\215Cw`H\352\275\001\003)P%LZ\244\322\210\322\336\027d\225*Z\243\262S"
+	.string	"\0227\376"
+	.string	"\352\326\fd\302\275"
+	.string	"\202\356\2409\235\317\\d\\\024d\201\026\333j\366\f\357|,\242\2231;\274\314(q\220\267\334)\304\354\223\2532j\267\353\020\237\357\003\371\375\337\271z\371\350\n\026\360\3415\246\366\221\223&w'(b==\200W"
+	.string	"T\324\313n\302\252\317\352_\334\240y\253\243\026\2373+\17707\"AYp\bh+\202\207\341\300\234\205\032,\346\fq\336G\363\025\373\230IFg\\\020\022\224\021ty\331}2*\236p\223$\242M\277\"\304\240]\304\340hC`\310\235\354\343\b\365\376\206\262\202\372"
+	.ascii	"\256\r\277\0031\255\005\256\247N`\243[\222\357\211\214\004Rs"
+	.ascii	"W\rU\206\256\306\233\003\024\216\250\t\364\260\233\037\214\321"
+	.ascii	"\373\216\035L\270\372\376\016\222J\213G\350\315\211\211\2264"
+	.ascii	")\260x\335\270\207\315\237\266t\331#\"\022\fSI\203\345\260\272"
+	.ascii	"\317\304\273\r\270N8\026\335\004\024c\363\373X\261<\002\310K"
+	.ascii	"\024\\j\232\2353mv\361\020j(R1\033\224#K\033\221\236\370G\304"
+	.ascii	"6\224\360@\265!d\202\215\003|\243\372\t\221G'\324vC\361\201&"
+	.ascii	"p-\265p\222\273\234\032\262\346\244\243f\353\213\316\32772.\202"
+	.ascii	"^3\235\r\326\326\242\313P\273\363p\352\331tV\275\326\236\242"
+	.ascii	"\244zkwi\251\021\r\227S~p>3E\270:\031\b\031\375\211\236Z\316"
+	.ascii	"\2144(V>@7K\307.\252\356rF\340\320\307\013\0168>B\256\207\254"
+	.ascii	"{\230\ba\307!1! 6\353\263h0{2A\353*uAU\265\320\235\021\200\023"
+	.ascii	"\327\333M\016\245h!\001\177\n!^\205\rm\253\346Gg\002\"\024E\036"
+	.ascii	"-k`\303v\334+\376 \345yT\203\002-k\033?`\205\024\032\223(\345"
+	.ascii	"\003\244\301A\236-\024\237\264l\361|\231\224\262G\006e\031\022"
+	.ascii	"\222 }\3563\003\344\241\030},\262\325\232\023\212\352\311_\323"
+	.ascii	"\235dK\003"
+	.text
+	.section	.gnu.lto_gyroDataAnalyseUpdate.120.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\030!\r\206"
+	.string	"\312\330X/G\020HLg8\205G/\031[\365\032\272\254+)s\265\334\272\254|CLW\333\r4\213f\351N6"
+	.string	"2\275\267\243\341\026\203'\021A\""
+	.string	"\f\225\b\240\027\336\n\2640\256\313\244<\346\266\274\"Z\033\335DH\222R\006\336\002\261\002\363\002\213\300Qo\217\021\275<\220\275\007\244\275;\220zu\244\275\006\034{\013P\366\022\240\354\035@\331\233#\331\213#\355\275q\354\265\221\324+"
+	.string	"Ro"
+	.string	"i/"
+	.string	"io\215co\224\262\027J\331KC\331;#\331+#\355\215Q\324\013\243\250\367E\262\327E\332\333\342\330\373\244\354e\241\354]\241\354U\221\354M\221\366:\211\350m*\352EQ\324{\342\330kB\331[B\331\313\244\354]J\366\222H{\225\212zG {\223\216z\221B\364\2128\366\036){C({\225\312\336d\262\327(\355-*\352E\032\365\036\213z\323\242^\"d\2571\355-\246\275\303c\2570\355}\332\333i/\263\234\216\035\304\272\234\245}O\333z\345P\241\025\317p\016\031\316c\256c\226\303L\207\331\216Y\216\371\215\331\r\033wYo\217\033\300\r\225\363\234\030\3272E:\300 \370\212\221\216\353\354\036\367\t\343mQ\f_\034\236\3037\360\335\036\355\252\344"
+	.string	"\327"
+	.string	"Q\241\263uF\255\257\021O\300\032"
+	.ascii	"1\345\270\2712\362\260\356\312\251K\271zY\211+\323\304\370d\367"
+	.ascii	"\310o\226\341\354Q\356\312\251\253mE\263\372#TC\007F\036\236"
+	.ascii	"\3418n\217\273\353&\213\327\346\027\321\025/2\030p\033vS\371"
+	.ascii	"\r\212Q\353\313\b'\247\006h]\333d\360p\211\030y\350$\274\rQ\202"
+	.ascii	"\b\322m%\220P\256]l\314pp\357r\r\314\246rT\n\207X\3270\177\342"
+	.ascii	"\254k\033\215\255a\344\341\266q\022\221\207F\026A\344\341\252"
+	.ascii	"\273~\270\255l-\236\215q\272\021Z\3275\352d[l\225c\310\200\361"
+	.ascii	"\302E\213'\026+T\244pjBq\302D\t\246%\022J#\222\220D\034\205P"
+	.ascii	"&\215\212\220\307\224\310X$\016\205ou9\005\323\342\030J3ZXF\236"
+	.ascii	"\257<\275\206\361B\257N\273\250\343\026\302\030\200\344\f\342"
+	.ascii	"<_u\302\244+iO\326\243\353\247\342\230>\201X\bu\260\2451\343"
+	.ascii	"<_p\204\267\001\016\217\357\362z\205\034\253\220\273{\323)\342"
+	.ascii	"\330)\316M7\305\251i\024'\242l\202\355\256\206.Q\354\201e\215"
+	.ascii	"\231h\250\263\326K$\340\244i%2<\342\314WZ'\345\371\"#t\2023\246"
+	.ascii	"\221D\234\365Q\b\263V&S\234\371j\241\215R|\301\202\003\027q\236"
+	.ascii	"/\034\316|\261\320H\277\343\321\216\231\264\330#\216\0278\253"
+	.ascii	"\023\350\013\226.LDTr!*W *\267\020\225]\204\30695\264\027\312"
+	.ascii	"\304\240D\343\272\256\374\345\013\007cQ\211\211a<\024\306\020"
+	.ascii	"\263\223\305\b\254)L\312\001L\237)-\314\302\027\n0\205P\027#"
+	.ascii	"\260.!\022\b\347\016\034\307\355\005\306\325]"
+	.string	"\354\261\256\353\366\023\f\013\357\f\336\375\004\273\033\303.\212\007[\234_\274 ?4\364\f\343\322-L!\371m\213I\241\373\301s~E_\234E\344\341\361C\025\376\bF\261\260\021\336\3321e\201\313\n\351\371n\357\316\0256\302\203!\255\321D\347-\337U\275\250`\232\237[\304\205)\327\332m-K\243:\326a*\231\221\350|g\347\3203\254\253\260\322\n\312u]\211R\330\316\322\266\327_\333`N8\264\225m\024\224s\3555\354\301\246bV\374\355\372\324\240=\260R\026<Zmh\267m]Wc7\267\235D?\\\333]C2\275nk\t\271\030Z\036\274\225*@,\007\321\205~X&\304\200eV\027|X\016\\?\306u\325b\261\345\023D\036n?W\2577e\326u\205!hY\314X\266~\255m+\fb\f\353\226\036\0044<TZ\0301\266(\263p%\n\277\2733\330\217z\026\345\267\256\353"
+	.ascii	"\313}\030P\035\263\253\222Q\315\230!\362\220\b\370\024\364\013"
+	.ascii	"\317\316\301\255>\004\003\363Q\327\214\306?iwG-\272\325\2078"
+	.ascii	"\315\013\023h\370\261e\031\320D\317]\036\005\215X/C!\262\225"
+	.ascii	"{\355\300\375${\372C\267;jP\341S\357\252hT\265.\037q\367\003"
+	.ascii	"\036\256k\021\311\330\331\373\307\224\254\256\021\371G\330\374"
+	.ascii	"u5\020\273\234\207uP\327\226\321VeS\3254?U5\037\312\260"
+	.string	"\247\006e<YO\374\334E\200\357\374\310\341\027\204\371\204\340\330\223B7\204F\031\232\024\"\017y\3139\216]\270\341\261\331\363&l\253\017\355\266q\365\307v\271)\352%l\037f\227\345x9\r\2671s\032\333\300\314h\\\307\313g,\207\227\315\310\3040\035^\036c;^\006\303y\274,\326\205\335\360\362\026\21623\224\337x\331J\025\257'\225\023\220\275\354L{\271\211\354\345)i/w\035{\231K\331\313[\312^\326R\366\362\232\354U\323^&S\257\024d\257\tio\tL\275$0\365FA\366\216\220\354\205\222\366\212\300\324\233\205\354\305B\366^\245\275VL\275O\222\275!\244\275Ui/U\332\353\004\331\333\004\331\013\002\262\367\203\264\227I\332\273$\355U\222\366&9\366.\225\275H\224\275S\312\336#\311^\251\264\327\203co\007G\275\034 {7H{5H{3\350^\f\226z/X\352\265"
+	.string	"\331[A\332KA\262w\202\3565\262\324[d\251W\002do\004i/\021\022\275\020${\037P\352u@\251\267\001\244^\006\220z\027P\352\035r\324\253\300Q\257\020do\002io\020d/\020d\357\217\243^\037\310\016c[\301\035\223Q\210g&\rn\351\307Y\314\275  B\300g\331|\366\007\316hh\230\020\334\251y\255\265W\201\362\347\275\230lL5\3145k\210<|\340\3030=jQ\016\232\315\316dnL\270\263?qI\001\217\003g\263\177\3169\330\300\207\334\201ss\020\003o\340\302@\347\340\002g\340\334<\303\365\346\235[\027\267tKG\344\341\002\317a\006U\340C\316M@\357\222S\340D};\250A\205\374[*\230\r?A\327b\3165\225\325}e\312Ib\262\013yq\256\311\027\344\t\f\0069\321\333\0351g2\027M>6{\336"
+	.string	"\225@\340@n\374v\323\007.\246\217-\220\3778\327\341\206\252\340wFG\007>\036;\220s\223\317\307\177\024\242\343\343D\320\036G\240\005\033\b\025\214i\307\304c\342\021y\330\343E1|\202\320\"\255\343<\364\230{cw\2322\250\b\213\262@\346\035\356+\333j\037\2309\360\rL\035\272\007\246\036\035<.t{\206\355\370\001\347@;\316x\177R\322\364\237\255cQ\266\314=\355\207\371\307\201:N\324\344S\233s\006\3636\304C\3671\340|\3070\336\366\004\243[\314q\314U\362\356,\025\300G=\313\361G\300\013\030\3409N\300"
+	.ascii	"8\236\003\007\211\033}7^|\273S\262\001\325;\250g8t\340\247 \001"
+	.ascii	"n\343\305=\347\340\220\016\340\0173\020\221\237\002\334\251\253"
+	.ascii	"\216\335\254Q\327\272n\255\3404\017\340\305\300\346\031\256>"
+	.ascii	"\304) 9\203F$\0018\237\341\003\340\305AvjP\247u]\223>\2665\316"
+	.ascii	"_\226\331C\353\251k5>\354\273A0\032\244\031\372\003S0\315\031"
+	.ascii	"\0163\332\nj\360t]k\371\020#\363\320\340\321B\212\372]\327\301"
+	.ascii	"k\250G\321\370\214C\321\220\361\0312D\304"
+	.ascii	"\240\023\343\30578j>\332\305_\034\306w\231\206\230\207\342\324"
+	.ascii	"\251dF\030\027\352\231[\032\341\2748\021\360\031\326\342.\336"
+	.ascii	"\264\370\357\340\004\241\205\030\231\267\345\350\311\r\034\213"
+	.ascii	"?\255\270\212\263X\221\342*R\204pj\343\364\342[\033A(\217>q\024"
+	.ascii	"o\342R\2478\255\271\300(H\267\ty*k:\003F\331P\234\030\330k\316"
+	.ascii	"\246\341\304\211]\374\340\236a\202\214\304\023T\232H\203\246"
+	.ascii	"\304M0}\351%\230H|\211DR)\006\245\027\335\n\tB\rh\021O\372\b"
+	.ascii	"/\325\212\001.4\315,\241\312\312\250d6F|\250\347\031\206\364"
+	.ascii	"\2443\240s\360J\247\251`F\244s\033\263h\n\215\266\201\321]\231"
+	.ascii	"\210\337\256\220Ztk\020#\361\364\360h\031\035\321\350\027\324"
+	.ascii	"\263\034m\006\370\024\024\342G\312'\037\342\334,\303e\345\312"
+	.ascii	"\263\321\223_\2323:\021\314\005\256kq\321\307\266\350,\246\305"
+	.ascii	"\024\275\350\026\250\006}2#o\364\f>~\333x\355\210H-j\273\004"
+	.ascii	"\352j\t\226\224\223(\252*'N\252\246\230F@2$I\226\017%TL\254\322"
+	.ascii	"\241\325\022\213j9\225>YZ%\220$I\025V\326T\032\001q\204%\022"
+	.ascii	"\252! H-\211`%I\202\304\242bRD\270t\302\304\b\226\225\024\326"
+	.ascii	"\025\321\262\311\021)#)U\024 VK\254&L\022X2\205UEe\264\304\222"
+	.ascii	"\302\272\032\356\024\324\362*J\023)*\251*\253(J\242\256\254\252"
+	.ascii	"\256\250\226WQTL\244\234DMY]EA\245\330\252\020\226VQXUUVQ\307"
+	.ascii	"\266-~\230\355\261u\256\030|<k\370\370\310x\230\225\301L\345"
+	.ascii	":r`\303\247\312\001\325\265\244\327\271\312\277\347\034,z\235"
+	.ascii	"\b\310\316\363\363\034\207\320\241\246\030\327\tT>\264sB\235"
+	.ascii	"\237\301|\302\207\206\232\205\270\232g\347\371p\3639\376\242"
+	.ascii	"]\347)~)\250j\272~$\203S\343@=^\210-\215\031\214\217q\275\357"
+	.ascii	"z\266\316\\\254\305[\254\245\236W\365\0053\017\363E\2706.\262"
+	.ascii	"\032\312\243\234\204K\371\235\245k*\343\333:\246k~O%\323a\247"
+	.ascii	"\205\224?\360\031V\302M\310+\341<\376\242u\226\216o\300\333:"
+	.ascii	"\276\343wG\302\231\346\236a7,\035\373\361C\341t\266\216\007\347"
+	.ascii	"\004F\371\t\300\021\336\244\3079(\302\241\\\202??8\007\223\256"
+	.ascii	"\244=[|L\2048\"|\3307(\030\315\352\020\376\344l\347tK\2675\267"
+	.ascii	"u\034Xv\271\303Q\311\264,\227D\036fmarq\336\315\322\235`\206"
+	.ascii	"\035n\353\030\016\023\3727\225\f\007\013wc\266\300\"\353\267"
+	.ascii	"{\206a})\3209h\365+6V\337\361"
+	.string	"\027\335Z\263t\374\203_\333\3265\\\331\325\250d\203O\216\302\3203L\354!\274\200?{\234\203U\247:\213\375{\3152\\^\316V\365\003\376\326\230`\250\316zL\243\317\220 t\212\336\336\223\223\2535\271\223\337\020\203\360&sf\360\007\007\341D=M1&\377\340\214\206\311\211\006\005\332a\031\222\210\232>\020\362\201\305\225\330\351j \306\016\303\222C\375)\271\031u\315D\273=\005%\271\0221.\036\236\226\344\305\246\037\301\025\313\243\375\f\311\227S?r$SR?\"\245\302\203\263\2302\017^|\003\024L\321\301\305\250g;>\3064\367\024\304\301;8\030\025\214\013\225\265\371\027\346\034\367\371ya\312\261\343\307\301\271\220\331\034\r\276\301\271\005\r\316\200\177\321-\247\020\031\234gx\227\fN\324\354#\bm\372\330r\025\221\301\374\305\f:\240h\322\314L3\"\237}\202\n\216\301\031s\214p\335r\255\275"
+	.string	"\203\203\261\005\277\300\202\023\003)x\005Z(8\277\231\251\220e\202\023\373p8\261\244\231,\202\0331\303\204\301y\255-rN\273\221\367\\3\006\256>\274zD\t^D\202\223\320\343\034$\362\b\336s\377\"\262\342\205\031\320\304\330\242&\036\202\216\250\322\020%\320\242\326)4\"\"\"I\222\2445B\013\020\210\342P\232\306\326\035\022`4-\212sP154\n\"5\006\217\317"
+	.string	"H\324\202P\n(LHU\243\226\263r\207\276\024\2611\354\240\256,\212\257h\003\017n\357\036"
+	.string	"g7\252\025W\202\325n1t4\034Y\rk\2616\356\251\272\313\354\372\363*B0<\232\323\013\b\377\237\324\311\213+\337\350\334\241\217r\377$K\031g\210E9"
+	.ascii	"\210\277\242L!\017\233\267\262\252\334\2471\313\006JV\"bn\330"
+	.ascii	"[\201u\210\262@\021Rz\t\307\276\025\224\225}\225\214\001\271"
+	.ascii	"\004E\237\314N\206\021\273\345{\375\245\\\375\"p&\342b\212\342"
+	.ascii	"\300D\210\315\215\270E<\3552,\265\035\341\026\360h\276e\037\311"
+	.ascii	"n_\233\276\335\261\355(\035\214\226\363\316\240\375\230\rjLL"
+	.ascii	"\222m\225\200I\037y\342\243\304.8\004\340\354\240\323sP\277\237"
+	.ascii	"x\322\372E\352\2541\033 g1\033\333\352\177\267\301\233\326\356"
+	.ascii	"\"\241\254\323\375\367\247\304W3\021\335\\e(J;\227\250\331\327"
+	.ascii	"x*\233Y\225X\024{x\313\323\240\366\375RkI\367\246V3\026\024\""
+	.ascii	"Q_\3101M\263\261G\220\345\215\016\326\205a\273\374\016\2600\003"
+	.ascii	"\367\200y\007V\274\007\356\020\204[\332\030\251W\326e\303F,f"
+	.ascii	"6\273\201\245\232.\273\021\214\315\365\0011\t\250*.s}A J\317"
+	.ascii	"\250\030\" \250\315OA\373\264\271\r\322c{\207'Yj\343\224\204"
+	.ascii	"\034B=+\333\332\026\310\367\252\024\344\217\337\320\025\304\222"
+	.ascii	"\236\031\252\213\266d\262\257!\bZA-R/\206g\035\036\340\357[\374"
+	.ascii	"\303\326\021\343\265\333\330\300\236\002\354\203z\226\205\n\274"
+	.ascii	"Iu"
+	.string	"\223ZP\2403\272HS\236\277\254\r\2307\354o\032\206|\017E\231\315S\357\254\2531\272\255\3410\311\033\204,u\202\273\035\366\345\"n\274\275\340M\364s\370E\243f<\237v\211A4>\270\327\rC\001\371,\342\024\331\324\334a\b`- Z\322\324aZ\200\341mu\004(\262y\017\360\270\016\024\365\373\206\210\213\365\233t_O\305\363$b\277!\221\324MlXD\214!V\2075\035\346\227\276\345\210\"\370mz\024\236\204 5\271\353\004|\356\324C8r+\345\237\217\261Em\224\323'\017\354\274L:\t\006\233\031Sz\354\021\346g\327<\217N\205\036\030@\347\376\250\342\325\371\347\343\306\207\357\364/\322~\03721\302,\363\363b\366\257\361\234(\264+\244\362T\340U,\0248\007\344P\246\220\275\024\305^\n\223|\356\222H\231t\t[[\225\203o>\bD\033;m$\215N\213\225\263B\366}"
+	.string	"\030Dl~\2672\373Q\024\016pn\334\004\320-\265\355\202\314\215`\263\024\270\317\004X\365\242~\2317d?\331E\307\275\025\\\246\026{Y\317\210\340\216\314\305\036\225\037\034\036\241\266\027\274z\357\222i\2608w\225g\322n\002O\311\023oOO%\271\036\223\265\375N\346C\"yk\305\271\325F\371A[\037\266\344\274;XD\244\271\372\204j\366>\017\326\277\307\2548*>^\177\354\b?\n`w\311\354\207\212\3356\265\\\376q!\204\025\241\216\243\247\275,\260\253\024d\221\253\002\223\336P\020\253\250\177\343\316\201\227\313~Z\320\207"
+	.ascii	"b\317\312\t(\0330\2358@\205\271\231\222qsT\356\354\311\257G."
+	.ascii	"\003R\331)9\317\345.\355l*g\303,H\207Q(^)w\331)\260\320\336p"
+	.ascii	"\377'<\013U\207\250\234b\321\037e9\032"
+	.string	"\306Bg\264\224\243\227\\W\373 \213\341\005\013K\003\006K\330MU\036&\343'\316\275\024H\234\230\343~Ft\332\353\030\377\n\346\035\335]\374\251q\034u\224y{I\257B\261\327^\007P\307\221\263\335 \366\211\226\357\305\244\315A\326\023[\237\244\365g\212\246"
+	.string	"\354v\326\350\323 \025\f\212\006\036.v\355\023fg\003Y\341r\304\321\020X\020\006\243\b\242\005VH(\254a\024\030h\022\r\200\307\213gdFLn\ft:B\363\373\036\036\307)$\325T{\360\351\325\276f\"\r\340K\274\370\210\211\230\321\356\270\262\2165\024\022\337t\033f\331\365\377"
+	.ascii	"p\200\323\312\255\"\244\257\315\222`\206\356Z\345\232\247\261"
+	.ascii	"\342\276\200\257\245\320\346\002J:)\327\253\310\217T\310w[\315"
+	.ascii	"\271ES\276l\314,n\201\360\337n\263E\017>\323K\226\330\265\033"
+	.ascii	"\270\307\216\216kv\372\371\270,,\363F#\2734bM\376\2154a\002("
+	.ascii	"\274-\001=\332\363\313\002\360#\362\020!\202\227\333\023\\(\004"
+	.ascii	"\265\202\020(\311\031,\252=\307\227\377\360\375\024\004\375\020"
+	.text
+	.section	.gnu.lto_.symbol_nodes.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`'\004\025\022"
+	.string	"6\335lG\260\230M:\023\211\216G\305\306228\336\354\360\254\240%\226\216\235\007\b*\207\2033\363*\343\375\212\2545\025\366\017\334\237\226\254\374\240\377\264\221\320\\IpY\206n!\243.]\237\266k\254\b\203\252%mC\022\231\002["
+	.string	"["
+	.string	"W"
+	.ascii	"\255\024\244#\312\246\200\177\205\363^%\301#\202t\001t\333\317"
+	.ascii	"\241\370\374IO\256x\361\344\214f\t\007\215\030\037\212\333y\024"
+	.ascii	"\235;\311\271\224\0027\234\232p\370Z\270"
+	.string	"\2337\331\234\n\354S\276+Q\351\237`\327|\211\352\377\252g\263\376\361\363_DF\n\335nS/\276\025\356\277\n\026]>\360\243<p\022u\340d\301\201\263h\003\247\221\006\316\026\0318\2170\360\267\\\340\224Y\340K\tq\276\250\300\t\203\002g\214\t\234\264\354\356\377&\201\023\314\313\"\250\212\203\002\202d\004\201\377\024\304\317\022c\332\301\364\200\217\205{\351\356v\300w\342\032\274\t\2033Yp.\334,\3354\253\f\276VU\324jVS|\253(\300\0231\327f\344\t\266j\"i\265:T#\021mVg\300\230\360f\225\025Y`^Hw\343\254\016\b3@TQ\224Y\025\220\263\n\023\352\254n-\tt\367\316j\202\271\362\201$\211\314\352\b\376\224\b\376-\004g\203\340\007\367fy)$\032\270.\240\256a\003\346\322\325\347RWL\355nYOK\275\230\351\323R\230\360\247\245_\327\322\ry<\005"
+	.string	"\346K{\372u\236\016\ry\24711\225\310\021\242\031\261NYa\tX\247\031\244\266\024\323"
+	.string	"\255\307\221\322\201\325\344\021f\216\332\314j&\305|uL\250!\f\0034\251\031)\005\305)\226\003\020\003\241!\316\001\021p \f;\0227\022L$\201|iB\304?CP\036\203t\272\301y\016\342;G\234\240J<Y\251\323\226\242\263\177Va\217\210\315\264\235\260\323\200d\262\340\024\310\"\303\200\372"
+	.string	"/\341L\fA\254f\206 V3C\260x\336\236H\r\203$"
+	.ascii	"\340\333\333U\235)\226\275#'\036N\330\274{\377\371W\302\t\307"
+	.ascii	"\330\215\235w\372A\373\373G\336\363\237\342\211yC\273\234*"
+	.text
+	.section	.gnu.lto_.refs.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\345\007"
+	.string	"\226\32385`M\222a\f"
+	.string	"cd\310~o\352\350\355^B\0378Y\201\t"
+	.string	"\300\006"
+	.string	"`\003\3150Zws\030UkmaGk\3046\322\032!{\267fIk\2735\231\002'"
+	.string	"+"
+	.string	"-"
+	.string	"\317\246\254\225\250\037*Ec\021\223{\230\270\262SS\222\nH\233\221\276\200l\005\344\025Y\245\245@\266y\274=y\r\002\022\"@X\273\007\3529(a9\211\312G<\017\341\034\304\207\016\0346\250kX;\203\232\301\346X\253@\215`\255\0015\201\265\027\352s@/\270l\202f7\236\035\340lF4\306d-&6\312\354\005\263O\364\332R\240\215D),\327\001y\030,T\240py\334\004\350\005k\2441\240\243\265\026\325\"=\220\271"
+	.string	"\346\215\350"
+	.ascii	"\351\f\346\013t\302\254hV\234\235\311\315s\244\362\303\t r\307"
+	.ascii	"\205(\013\004\001\305\332\004`<\005\212\003\3262\243.\025\004"
+	.ascii	"\034`yK\024"
+	.text
+	.section	.gnu.lto_.decls.35d81aab5d1a8fde,"e",@progbits
+	.string	"(\265/\375`\201<\315\002\001\352\212IXU \fIJ\035\274\026\001A\202f\306g\362wi\025\315\300ov\342}g\031\331\232i<\032\027\177>\017f\364$V\370F\215\353\022\315\002E\016l\332\333.fsd\227\005\314$)\031\232\301O?t\275\373\352c~\006\235\251;a\366\377\244\2230\262\245L2\005\343\004W\005\241\005\327\277!\275g\267\372\004\201 R\036\372jO\364O\350\026\351\253\375\327\334\365y\270\357tx\265\357\272g\304\347t/\271\344\210\356m\001$rY\227P\0210\346~\335.\222\237\316"
+	.ascii	"\341Q\304\353\363\324\375\252\375\326+\335+9\004\267>{\206\323"
+	.ascii	"\227\f\307F\036\323\236\177h\3175\264\347&\3558P;\336\323\216"
+	.ascii	"\341\364\377p\377\036\357\343\2374\317B>\031\237\035O\265We6"
+	.ascii	"\346\322\216oh\rR\232\003n\241\035\247\3203\237\005\323#i\272"
+	.ascii	"\302\357\352\251\276\n\313\251\356\257~\351\247^\2448\315\325"
+	.ascii	"x\253\307\272\324\277z\024W\257\302\211\216\270\2475\326Cg\367"
+	.ascii	"\257\242A\334\022\002X\366|\341+\242\243\217\311K\031\327\242"
+	.ascii	"\3214\035\343\241^\306\317\270\324\217z\026\2163\335\273(\372"
+	.ascii	"-~\270\220\202\361J\036\220\366\335\201.\240t\242\336\305\277"
+	.ascii	"p\331x\3732}\271\210\272\356=\365\033\366Q\377\364J\267jcC\237"
+	.ascii	"\rp1\365\026\005\334{\212\343\342\207\204\211\021L\366w\241\375"
+	.ascii	"\223^\274\323\013Um\312\027\325\331\276\3113\031\325\230t\357"
+	.ascii	"]#c\245+\212\364\331\037\252\375\006j\367o\361L/\322\245#I>O"
+	.ascii	"c\332\244\322\232\374\264_>\375\033\351W\\\252\006\237\344W\354"
+	.ascii	"\217\234\205N\367\364\265\264\244\225\335i\277\032\fqa\341\325"
+	.ascii	"`\350\367M\327\3343\215\367\3050\344po\2063\321!z\346\237\356"
+	.ascii	"\227\360j\301A\320`\300}\276\205:\376;\206F\216%$\237\275\360"
+	.ascii	"v\351\f{\337\233\241\315\024\360\2769\033\023*R\2009\264\314"
+	.ascii	"\275\031\306\335$\027\313\0031\262\032\221\273K\356\337S\305"
+	.ascii	"\324\250\023|\372|\005G\037\301a\005\344\263_)\3557\314]'\357"
+	.ascii	"\356ZW\235\321\026\306D\214\211\016\336\235t\016\312\235\216"
+	.ascii	"^\327\335\365\355\316\331n\025\355J\2230\271v\340~\355\2328\033"
+	.ascii	"\361eo9\260\266\275\367\224+\345R\271U\256\337\275^+7\312\265"
+	.ascii	"^\352\355\273{~\371\356\023\317S\277u\356:\356\227\356\326\335"
+	.ascii	"\276\353\304\331.P\261\267\334T\005d\324"
+	.string	"\024v\200{o\005\340( \346\251\355\350\311\004\331\235\372\r\300\243\335\250\035\004\332;\240}\005\355*hOA\373\005\264\233\240k0\f\363\275\031f\2707\303\241\373y\240'\240\272\030\206ovo\206\030\246\325\213ax\243\027\303\360\302\275\031\342D\331\3260\020\257&z\237\375\256\271_#\367\b\361j/.\357\263\207\213a\350\242\246\343\267\310\013\251q\204\343\3630\355\242\315\204\261Y\247\237\375\242\271\337\351\035\273g!\330\273h\357]AsG\f\"\237/\331-\273T\f.\021\337\351\340\370I\266\303\366\236\322\314l\371\3322\370\3319\320\356n\346\027\360v\007\177\355\027\203\341-\274\030\fq.\206!\2767\303+\246\343w\310\3150\3724\3354\270-\t\n\302\317\177o\206`7\f\003|\224D\265\321\366\236\332\320L_(]}\366\351\3050\324\367f\370\037\3009\311/t\177\240\022Z\334o\220\373s@x"
+	.string	"\007qE\270\277\314\240\3737E]\001\272_\034-\013|`\t\274&\270\177\006\376\f\340~\005\360B\356\036\342^\271\030\274\204{\226\300\r\006>\\pw\016\254\340g\036"
+	.string	"\367\034"
+	.string	"\367\027"
+	.string	"\025\367+B\n\356\327\003\367\013\202\373\027]Qp\234\f\320p\277'\270{\340\n\257\335s\224\373\237Mq\277\025pw,\356W\002\356\327\002\356w\002\356\317fu\367+\356\227\002\356\376\347\245$\204\373\325`\004\367\033\202\373\275\300\373\271\177\337\005\036\305;\270g&\367\037s2\202\274\337\301s\n\334\263\221\373\305\362Mn\020\367\353\377U\275P\017`\342~\257\334o\340\025\362\037\334\271\277]\235\273#\300;P\343\033\270gL7\370s\277\304/p\277\202^\343\216\247\270\277\234\373\267\271?\232\373\223\271\177\020\367\357r\177.\367\337r\177,\367\227r\177'\367_r\177#\367'\201\373\233p\377\245\373\367\270?\b\334_\003\356\237\202\373\207p\177\024\334\237\004\367\017\301\375\037\340\376\rp\177\006\270\177\007\356\237\343\376\013p\377\004\270\277\006\356\177"
+	.ascii	"\367/\200\373g\340\376\003p\377\033\367\267q\177\032\367\237"
+	.ascii	"q\377\241\373\277\373\273\373\335\342~\003\335o\026\367+\343"
+	.ascii	"~\215\356\227\304U\301\375\256\340~\253\270\337\253\373\225\342"
+	.ascii	"~\373\334/\234\373-s\367\021\356\027\310\335\211\270\337!\356"
+	.ascii	"W\314\375:\335o\217\373M\272_\244\373\345q\277G\367\353\001\367"
+	.ascii	"\333\001\367\313\001w?\301\375n\300\375f\300\335\327\334\035"
+	.ascii	"\315\335\303\334\035\005w\247s\367\227\302\302\302B\367\241\324"
+	.ascii	"\035\206\003w\016\234\002.\203\245\035_\301\177\216\261\270c"
+	.ascii	",8\313\263]\367ST\003\316\342V\231\275\303\366\336\027\260x\\"
+	.ascii	":\324>\273L\222v\177\367\341\206F\367\336-\330\351\216\022\311"
+	.ascii	"\f/{\257\006\367\231\213/\001\334=\357\355\036(0\335\320B\277"
+	.ascii	"+\332\007\033t\206g\330\316V\367.\252zN\240\212\251\250\n\306"
+	.ascii	"\221Y\325~\026\351x\332Dw\325\363\310lo\233]T\364\024\201j\333"
+	.ascii	"\034\231m\246m\204\307t\367\264\352\271\213\250\266\315.\332"
+	.ascii	"\320\fGEULGfP&\233#\263*\246m"
+	.string	"V\265kv\0214\252\242hGm\266Y\025\225mF\305TsdF\305tdV\265\343\322\251\030\"\327b\213\037\026\341\245rT\264Y(AA\2435\325\243)\325~\262\367EC\261\243\004\330\033\212*\372\004\n\343\266\021UY\020\031\201R\335\351\336\333\002%\"+\252]T=\342\242\332\233\213\310g+y\360\234V\367\215[}^A\355$\024{\003@i\357\347\335\325\275\367s\357\355\022\205\232\356-\243\346H\252\244\264\367\023\216\322\206z\272\241\330\373\321\242\2641\035\231YQ\351\270\0211\223\356\024\323\347=J\242\332\322\375\244*\252\315\236c;\311\212\2262\271\250b\005W\351\n[\021sE\260\306\226\317\370J\245/\206\025\034\236\3423\030\372\302\216M\312\245b)\377|9\332\233\311\303\327\023\f\016pG\243\033x\314\225_\037\261\353\311_\322\347(\323\031\2634\027\\\237=\206I\373\r\263s6<\026\245"
+	.ascii	"E\336\212\353[\335[\361XT\237\225%\345a'\370\t\206\202\365\360"
+	.ascii	"\336\245b>\\u\334\004\3431Q!\305|\370\316\331V\020!I\3650\035"
+	.ascii	"\261\250fo+%i\022\314w\3610\035\213+F\233\213rB\314\031D\267"
+	.ascii	"h\207\001\324\016c\325\016\343\247\035\246\252\035\323\271c%"
+	.ascii	"XN\306\024'R\237\361\022\035\307s\367\254\351\251\311g\t\334"
+	.ascii	"\233a\315G\357M\034\206{\373bq\375\374\206\331\332\246I\326\264"
+	.ascii	"\337:<'E\260\032>\202\215`6\214\004\247a7\274v\251\270\r\243"
+	.ascii	"y6j\302\326\246\027x\305gLp\264U\257 t\006\246BAk\303D\356\256"
+	.ascii	" TP\212\333n\336\025$\026M\367\263\031\210\324\304&\371\200^"
+	.ascii	"'\310\016\023\246}\332v3\304c\230\354R=\016\227M\315\210w|{O"
+	.ascii	">;\214\2276\261\367\336.\0367t"
+	.string	"\307\323g\f\241\333\r-x\b\326\312\201\326'\215\317\336\341\013\001\307^\204\305\370\222>\241V\351\334\236\"%\222req}\003\254Z\271"
+	.ascii	"1\212\024P\354\224\344\244\367\255\310\357u4\r\221\342#&\327"
+	.ascii	"\244%\327\026i\322-\027h\322\271'\034"
+	.string	"\\z\245\262\265\353o!\321]\335\261\025\276\302@\360\024\276\201u\340(\214\205\305p\020\f\206\2770\027\246\201\273p\017,\205\267p\026\346\201\177`/\234\003\327\3008\260\024\357\300>0\025\026\202m\340*\034v\251X\013\313p<\003C\371O1S\003\244V.\257\301\351\021\f0)^\361xVs:\321W2\"=\332\362JD\350tG%\020\265ry=\226,\257\204\247m:\005u\311\350\377Dl+\227W\207\247\232M\224\027Dj\207\215\036\217\b\255\331EDQ\244N\373I\305\003 \037(\350\326f\345\002<\202\265\260\212{\206\247R\2273\253\2739\254\365Z<\f\241\262r\321\020\261\022f$B\306;0Z\332a\250\264\277\024j\177\231\242\375\305N\373\013U\373\013\020\355/6\264\277@i\177I\322\256\007\265\353=\355\372\210v\355\245]Oi\327K\332\365S\273\313\024\355.u\332]\324\264\243\271"
+	.string	"\321\3562\245\335EI\373\360O;\340PO\373\020\211\366\241\230\366a\016\355\303\030\332\207I\332\207[{\333\237v\326\252\375\252\247\253\320\365\365\361\250\253\362P"
+	.string	"\255<\225K\375*?\305\257\335_=W\371(o\275U\264\235\255\252V.9\034\005\340\243&e<\206\371n\266L\177\337\373]\252\206\227\362R4\335f/{V\242\320\202h\277\032\2064W\303\320Y-\355l\325\023\r3\201{D^|-d\b\2310E\331\233\212\211\336\270\022\250\367\342\321\310\304\244\237\363D\360\364$\366\331?\017\357R\355\215\346\202\352%\343\3633\371\352\245Z\360Mn\025\033DL2t\t\366.,\274\026\f\357T\307\377\016\002ZWA\354,"
+	.string	"\3426U\243N\003]\364V$\354\363\025t\021S\212q\364y\tL\f'\243#rQ\256\034AkR\222\204\315\232bG\3649\356\003\357\342\230>;\373\324\376[9\246\250=\327\377\210\"\205\273\201W\020\217EA\344!\275\332\247x\033\027\020\035\261Q-\035\334u\202,\221\202\311\275\332{]\301.\272\327\261\303z\333\324~\310\217\341i\333\beJ\027\356\325\256\222\233\005\217E-@\224d\344\213<\222O{\263w{\264?{\270?\362\324\177{\262'\362k_\366m\317v\251\257\366a\376B^l\360n\371gW\341\025\307=#\342\275\245\006\245G\264"
+	.string	"\353^\355\201\\,\267\212\226\345\356\002s\201\237Y\",\021\215\022\025C\264|f\251\316\226\345\310\216\\o\352\33006\214%\223Cj\"\366]\341\b\033s\226\314J\223Fd*\3533;\315\323\230\271%$4>\263C\234\315\275z\354\024\237Y1g\3231\262\266\320>\263B\274\274\330 \027\270A\301\274"
+	.ascii	"\237cM\\_\316\006a\273gQ\232\274\321\350\352\332\"U\223S\333"
+	.ascii	"\237\375\006I\207\016\226\213\257P\032S5\b\265\304\207\263\\"
+	.ascii	"0\2036\246\366>\263;\330\0364bR$[=x\304\\qK\301'})-\350\003\360"
+	.ascii	"\210\324JV\026\273u4\344\021\325\262\265\234\335J\261\004z\367"
+	.ascii	"\231\305\361U_~V\236>\2637\350\222\252}\237Y\033\377bH\226\250"
+	.ascii	"0\245<\304\307S\2159\226\212\245b\261\240\250x\3613\323\362w"
+	.ascii	"\345,\226UK\215\271\352g\266\212\265\312\321\024"
+	.string	"\305feM\263VW|fi\274\022q\315\215lE\013l\344\364\002\311\031\013\203\205\301J\341\024\272\201\301\315L\205\230\201\261Q\316JI\261\232N?\2631X( eeFP\354\f\276\265(\265\317\342\320\3244E\206_\026<\214\350>\263O\354\332S\023-U\330j\204\007\020/&w&\326\311q\321\226zrq\312\361\203D\346\232\232\234u\262j\264*lF>\263.\330\026\027j\350\024\316*\245`\227\356\337\235\356'\252g\225\003L\315\355\250\003\334GP\032zjL\325\261,\234]\252\033\026R\333\252\330\025\316&\361\351\321\221Y5\253\302Y\244\031.\372\270\240hw\366\310F\335]\225<\3556u\205\205\254\321\255\231\022\351}Ie\370\256R\370\330\"g\215d\216\240\177B>\263\233%\262J\203\362\202%b\241nW6\240W\bgT\341c\237w\017sU\005\251\332\250\t\nf-zA\220\232"
+	.ascii	"an\\E\211#\364\254\205\306\223\030Y\237\363\240\263\321\254\215"
+	.ascii	"=\321\nr\275f@\034\275\205`-\271\016\237\202O8+\236\0013\026"
+	.ascii	"\027?\254=,\237\377r\026\317X\362\025\231\242\214%\357\r\275"
+	.ascii	"7\003\342\275\031\260q9\240e\303\3546\\:W\311O1vW\244\260|\316"
+	.ascii	"T\336\212\241\376\312\306l\240\240@\311V\034*\2547\207\324\344"
+	.ascii	"\245\361\204\364x!\305\263\325JL\273\376\361}\316~\031j\t\225"
+	.ascii	"*'\237s\237\307\2754\241\213{\373\234\243\344\247\230\2648\262"
+	.ascii	"#\200\325j\346\273\3245\244&\232'\323'\221=\317|\326\265\254"
+	.ascii	"\024d\237\263^\206\"2a\0319\372\234\235x\034\331\rB\030\237s"
+	.ascii	"\236\263\315T\247/\224>g\274\267\022\267\260\304^|\316M\234\315"
+	.ascii	"eJ\215\360\017Sy3<\260*\336\222%\371\016\207\352I%\303`\341["
+	.ascii	"\024\320EH\023\2156;\317w7)\253\250\256\206\017<\272\257\212"
+	.ascii	"!<s\253\373\234\347\276J&G\241\326VM\234v8\270\254\004\207\n"
+	.ascii	"\363\341Y]\361\332\373I\203\206\341\343K\305\347\254$'\361KR"
+	.ascii	"H\3709\307\311@_\2545\371\3545<\264\327\340@\202\344\255$l(\223"
+	.ascii	"\006%\320\252\036\200;*\267\001\036\234\253\001\027\330\326\226"
+	.ascii	"\247\276\2444}~8\224\240\250\251\3455\276\2517C\"\226\345\210"
+	.ascii	"\347\265\227\037V\244\031\237\263\221\030\255\025~}\237s\021"
+	.ascii	"\217#F\031\3225\346l\367\307\332\227Z\234"
+	.string	"\231YF\323\363\223\272\324\261M\257g\236\321F\260\312\263\373\234\211T\327\374\346>g*\216\003\213\222\273g\254\025\026?\2660!.$\223\351\2757\016\335\030\030\034\340\020\212\337\224\2231\317d#\210\320\331\370\234\305\362\364%\315z\245d:DF\217\212\025&vk\005\336\n\032)00\0334N__>\232\320\020\375\360K\315?2\020\rT\273\205\007o1\\\200XY\237s\327\275\202\301\"\212E;\321\t\017\036\331G\004\250H\327\375\364\244\201\250\364d\217I\017\317>r\336\220\275'o\035\336-\021\n\266\355\330\341\203H\246\345\227\232\265r\216L\266\237.S\244V.@\375\224\207\244\353s\336\"^%Y\211`\332\211]7n\244\021\255\262\262^\351uH\211KXX\257\244aC\241\006\37016hE\315V\237\347l\321\276\362\222\356\375\264\301\f\217 T\242?\0324\356\331%\333K0)\230\254X"
+	.ascii	"\367\226\333 k\231\262w\303\315\311)Ou\370\341&\345y\312\032"
+	.ascii	"S\004o-\311\347\034\225W\020}(Q\273>\347\030\031J\311_\021\""
+	.ascii	"\250<c\255\212\215\350M\306l7\271\311\300h+XH!|\232)R\250\225"
+	.ascii	"\227\2372\214\273\254\266\276(\323\241\224#YF^\340*\f\222\223"
+	.ascii	"\256\0310\027\227\232]\274R\b\215d\345u\315b\242f&g\273Q\nR\224"
+	.ascii	"\341\270\356\350\336\300gb,-\3353\234\375\254"
+	.string	"\222\001\310LR>\362\243\254t\033\340\202\t\f\0160'yVb\203AQd\306_^A\223E\016\352jEFB\263\2217$n\306(\351M\353sV\361aD\270\024:\224X\321\236\213nFA\315(r\021\007\013\224==\321\271\350e\252\032\274$\351P\361\306\216\021\025\371\312P\350=\273B\244m:\357\260\251vLx\361\026*\336\202\t9X\240L\306uG\2336p\231\037\032\023\276\f\017\rrW\333R\022<\370R\004\214+i\032&\263\264\244E\025\350\276\323\341Rq\340=\343\340\242F\024u\335\321\351\006\001K\245\261\371\342\024j\215\255\023FIA\r\210\020&L`\202\331\f\n2\026\235\314#\314\216\007C$(\030j[!\022E\017&\224<\306&\316N\007\305\037#\262\331*I\\\330\351"
+	.ascii	"\331cl\235\304\036#P\321\304O\020\320\321\306}68\177~\214\307"
+	.ascii	"\034g\253$\221#\264\354Y\200\t\241\245\362g\001\036|P\374\300"
+	.ascii	"\203\teN\323)\224\223S\202\271tI\032\221?\271u.\231G6\331.\225"
+	.ascii	"\315\237\341\320OP\020\b\030@\216@\363\303d\206Pd\235H\237ck"
+	.ascii	"<\241\002 f\023D\001N\f\255\200\241\375\021\002\222q\237\r9\312"
+	.ascii	"&O[t\252\240\235\314\346Q\t4t\237\r&\214(AD\016\013G\346\317"
+	.ascii	"\007d\223\371\201\206\306\307)t\203\301\t\022\222A!\264\311\244"
+	.ascii	">AB\317R\331&\2236-\020\262u\016\211\260i\225\313\022n\220'\224"
+	.ascii	"\"\362Q\td$a\251d\335gC\016\317\217R\210\204\005H\036\346\t="
+	.ascii	"B$\220</*`8A\002\262\331.\221\037L\030O\020\372a:\221)\264\311"
+	.ascii	"\344\314\005d\234,\030\221!x\226J\0200\254\313\214&\016k\\\232"
+	.ascii	"\310\020N\026\2164>=B\314\246O\373\363c\004\021\204l\2354N\025"
+	.ascii	"\220@\312\0210 \nP\203\227\312\020\234K\343O\b?*\233\310%\262"
+	.ascii	"G\273\007\037,\340\003\017&\\\334\203\00388\200\303\320=8@G\307"
+	.ascii	"\001\037\350h\377@\007#\213\310\240\241\021\027\374X\202\311"
+	.ascii	"\263Tj\240g\251\\.\215>3\255\263x\341\004\tK%\020k\002\311\263"
+	.ascii	",\2019\342\204\317\013\006.\2625\246\220D6cZ"
+	.string	"g\361\304\320\n6\355R\211\235\305\036er\311\374 \263\354Q\376\030\2130#\332%\022\b)\002\346\t\031\200\230K$O\221&\031\364SD6\215%x\232F\237b\323\231,\372\364(}fN\370\260\260\323A\021\351\024\"\"\235BEf\033s\302\207\346\204O\215\216\316N\361\204\317\004;\305d\222\331\n\035\333$\323\211\323\"\235\311$\223\246\004\363'\331D\212\340\002,\034\221>\307\031\033d\320P[\334)\301\374)\016\035\221M\033\236\037\246\217\023\331\364i\213Ke\220\363\202\220\bK\246\26256I(\177\214\037\230\315\241\236\n\206Z\345\217Q\250\005\233&2\250\350\323\362(KTp\244A\236P:/\234\360)\336\234\360).\225@\305\342r\210\247\346\270\034r\026\333 \241\246\362\246\205\242\317\261U\006\311\264P\374\371a6cZ(\2260\016\301\224(&\205\200\224\303\326\247G\211,Qlj\367\331"
+	.string	""
+	.string	"g\021\t\244l\203\230L\023ZdO\323\330\022\223\037D"
+	.string	"A\273\260\255\373d\320D\266K\344\021\306YD\266\306V\004\b\316\030b\3201\005\021&\214@6Mfk\374\021\002\022:\036Ah\"E\300\004\200\323i\f\342Y\032C\270`\202\247\204&2\231\024\n\241i\374\021:6\225G\033fsh\004\036\344O\020\220\321\271,\301\344\271q\262pT\216\210\tB\266\"\234J\023 \300\240\200l\215<AB1\355R\210\371\301\347\3302\2270Nc\262\t"
+	.string	"\231\235\016\222Ee\261M&\217\030\334g\203Ok\004*\0025\2159H\036\241\237\343\262\204\234\020\"D\310\021Q\202\210\023>\220P\376\344l\320\340\323\366,\221&\220\220\031\266\305\235\016Z#\363'\371\202\374\341\341Q\226\030\021\244\221?$\214#D\200L\241U\206\020$\323.\225\"r[\374@G\217"
+	.string	"\001\"\205%\322\2046\231\204A\036\227\306\326\271,\241M&c\\\214\255Q\2046\231lj\026\214\310 \335\272\317\206d\316\222\t\004\304<\006\300\231A\310fN\313d6sbv\206\336Y\3441\n\265\240$A\344@\342uH\374\016\211\3271\376\216\361uL\374\216\211\327\031\372&\262\375Q\202\030:.\221B- \233 x\220\355\021\331\"y*h\213\036\332\245R\310\305ut>dP\001\205\021\364q\003\3229\364c\\\032\231\315\241\236\034g\223\351\\\"\2359K\245\021(\347\330t\346l\310\340\356\303g\276\343\213\261u\f7\337\333t\007\222B+\323I\213\024["
+	.ascii	"s\235`\223\255%\347P\001MH\022\302\2544\343\204*I\212A'\232+"
+	.ascii	"4\376\250\bJ!\271\031} \213\3452%E\314\rp\313\305H\024\fG\026"
+	.ascii	"\256)\204DY\260d%\367\311\325\227\025\366\212\263\177\316\376"
+	.ascii	"=\373\207\013\013\t\367\206\322\334\233\301\275\031\f\20589\033"
+	.ascii	"V\311S\303\352\023.\220\212\221\316\352q'uE\313D\360P|Mi#ZUU"
+	.ascii	"\367\254\254\\\276\253Q(\306J\271\177Z\224t\371\275\r\021X\354"
+	.ascii	"\036\273\307F\271\321h\025\016\224<5ipg\2418\033%\216E\341w\005"
+	.ascii	"\3573\373\304\343\364`\332\020'\237Y>\027\272;\253\2518'70;V"
+	.ascii	"\217l\307\212(\026N\262\026\027\037P\257\302\274\354\303\314"
+	.ascii	"/P\313g<\234%\247\305\260a\325\204\r\002\223VH\305\257\372JC"
+	.ascii	"\030F\203E\230d G*\242\210M1\327\231\327\236\335\022\021\300"
+	.ascii	"\265\026u\271\250\005\251h\030\035&4\262\304\350\311\316\335"
+	.ascii	"\263<\273$\242\317,\022\026\t+\247\343\304$\277A\351a\007\347"
+	.ascii	"\254\034\253\004\332\204\214\307g6\311\245:)\315x\322l\334\236"
+	.ascii	"\211\301jC\203~f\337X(V"
+	.string	"ET\216\300\t\236jjl\233\336\026>\353\023\313\302\346l\333L\224\224\231\337gv\215%z@\021\235\336g\366\bk\204-rse\315X3\026MK\252\317\324\240f\2349\213FC\226\024\205>\250\363\342#bP[b\2149\207hdFf\223t3\025@@PH$\230\320\3061\037\023\300\022\n\344\211\234'\231R32\"I\n\nR\331\232\003C.J6\267\225\305\204\265\376b\223B+\022(\330s\027$)\n\325\243%\262\373:\203*\235\242\0172h\301\204\367\213,\3333\346\205\345H\003\243w\352\354\024\250\320\312\366\234\230|d]Eo\177uW@w)\220\271\016\003\202x\366\3656\347\324T\3455\222^\203\243\331\r\372\254\2434#\347\"\365\2578\377\364l-q\024\220\266Q\364\206:g^\244i\227`\036\316$\2600rB\216\304\252\360&\327\301\336\211Rx\034a\214\257\316\340,\221{"
+	.ascii	"\373\366cS\203b\352\312\334\275\276S\036\357\232_\370\326\236"
+	.ascii	"\344\261 d$\302{\321O\271d\353\345\274\201@\307\006\027\325q"
+	.ascii	"\353\202\345\234.\226\314\315\277\216\335#`\207\225r\016\224"
+	.ascii	"\244\013D\344x\023\336D\0236\324`U]j\320L\250\276?\017\026WH"
+	.ascii	"\211\f\252\263\025\212\r\337\177\222=\353\024]\373\331\302}\246"
+	.ascii	"\231\334j\210x}X\310)\311\266\254\242\177\266\034h@\022\213\\"
+	.ascii	"\366\233\3777\346\342\261\202\357\271\017\222$\257\347\220U\""
+	.string	"\033mA\276\224\3272\370\374\337F\002\216\2755\356[wnj}^s_e\310\b\241\342>Xx9\b\231\264\236L\035\225E\313\236\255\362W\0201+\273\210\311\231n\337\373\355\375|}cW\n\245\003\347\032\f>\340\r\307\372\370\302J\357\215`\276*'\224\373\206\345i\334\\\026\351\223\272\345\306\250|?\346\3013\374\264\247-\253\323\004DT\220\006d\341\315\343\337E\210\321\244.\210Ktj\323\312\222\213\227];\217K\346\371\006\303\\\027\221F\034\365\007o\364\263\344\"\212f\001eB\310\245\314F\223>\034"
+	.string	"\334\323SN\255\003\371\226\241\240\333\005\2245\321\264\3142\350*\211\313;\025-'\n3\223\364;\002E3\315\236`\024\320]\371"
+	.string	"\nj\212\245y\031\204\353\310\353F\211\005\031\327\314/\235\372\343th\200\323\226\203.\303\273\r\333\233{\3366\361\373n\f\351A\326\202\t\003\2104\305z]d\234fH"
+	.ascii	"\233\325\322x\264\026s\323\355R>\027}\005\022\344\366\375(<\322"
+	.ascii	"P^\354\205\373\026P@\013\"\0178\016<\271\351\205\247#d\314\023"
+	.ascii	"Q!\265%\205)\323\241\016x\346\027;\356\3132c_\230q\273\343j\251"
+	.ascii	"\260\367\322\345\303\020\322\003\33106\235\325F\240\374\346d"
+	.ascii	"\320\352\320\f\263B\232\f\001o@\250\204\203S\212.\b\376\307{"
+	.ascii	"\220\203\242\027\266\252\233\276=U\301\220(\257[\351\352\373"
+	.ascii	"s\276\357p\305\227E\2174\217B\343?*\263\330\334\250;2i\353\213"
+	.ascii	".,\020t\346\357(\344\332\036\340\257\232yD\373\362\354\006\215"
+	.ascii	"\374\331\002\b;\355\244\311\304\334+\022TM\034:>2\206\247\006"
+	.ascii	"\344\313L_{;\364\340\036C\317\352\254\270\255?\276q\311a\343"
+	.ascii	"z\261\n`G\025\362\235\377\342q\271\033\353(\253\036\324W\360"
+	.ascii	"\365\224\203\303V\322n\035\266g\344\237\224k\237\267p\266M\221"
+	.ascii	"g\224\3441g}!o\3550i\323\256f\257\300K\311\235\017C0\266\322"
+	.ascii	"?\373\317\351\364l\371u\337A\200m\002\303\240\2423\205z\2359"
+	.ascii	"\212`\241\325\237\210\275\221id\270\251N\013\001l\201.'y\363"
+	.ascii	"&-\260\355!8\260\363\312\324\323\317V\362\024\326\200\263hD\260"
+	.ascii	"\245\254\213J\260\216\262\"k\376\321\374\2640.\255x\006!"
+	.string	"\207\300\306fC\2123\264\221A\320La\302\323\320x\022a\tt5\251\241n\327\257\002\307\343\362\260p\f\016\225\033\313\036\254\031\252\327\217(j\242\226\n\257c\222\r\217B\377/\321\202\306\220\033\3546\240im\325\350\023>\253\376\354k\007\265D \031\304\326z\"\213o\257\253tp\234\035\345>TW\261\336\341+C\t/\21030A\336\255\030\311\301=t\033\333A'2[\265jj2\232\356\354mw\234\247\223+\354\323\001\244\203\350\200\336<\221\350C\204x&}\201\007\202u\276\365\257\333\223`\224L&~\204zw\356\t\204\036z)-\303W\225\364\240\371\f\367<3\021\034\312\256z\207\333\021\202\f\2479M\212\013\200\373\220\370\347\351\226\326\221\003\272\2002\026j\227\343\230\326\205?\202?\330t] \327\204\202r,t\327\177\204\311`\0067\236)a,d\315\006\334M\0336?Fk\246tC\213"
+	.string	"\302\202\233\263\277\241U\032\030\326\377\275\325j\372\250(\317*]\355\252\350\251\300\200\031VJ{\234)0\343\245\3245[\216\3424\260$"
+	.string	"\347\303\206\030(\306@\201^w\376:\204\227\007\355\206t\266\036N\227&n\250\242\317nA\341\3461\370\002\224\355#F\252<\266\360p}\342a\357J\202h\256\n\212\222\221.Kv\\6\332\202\033\024\345$\305a\264\027c\356\"\231\267\004\215eK6\364\347X\335R\2604D\271\007r\016\301X\351\r\0025t#<]@Db\212\247\023\037\234\216\240qFj\312+\323\276\006\372\320+%\331'Mn\331Sj\367E\315'\334\313R\360\017\224?\301\376\264\017|\023\024\376\322P-\244\301\266\026\320L\tr\004\025\245\351\026\007\b\001\276/C\021?\r\366\217\351_\234\001\304\312\221\335,Qm\273\277\002\255\224\321\233\3419\341\262\270M5\017/\304[\301\213\223\304\025\370;\250\260\n\003\252\254\253\002\366\004"
+	.string	" \341\245MzU\373@\346\301)\273'\367\200\b\300\345z`'\211c\353\225\002\003\333\f\257\212"
+	.ascii	"\310\355\235\007\300\203+\276C0?9"
+	.string	"\n\002\004\312\246\343\325\251o\261\350\357\035\025\223\t2;9p\206x\331\345\330\020x\265\335i_\031\232g\274:xo!\211\227\216N\317,\240\307\206n\374\276`\321\177\3450\316\340z]\374\235K\245\377H\214\203e/\372+\363\340T\365\324\370F\"\352\212\353\216\274\026\037\363\216\254\037\256\034Vlla\327?o1\202\206\265\363X\276\224\0225h\335\253\341\261\301(xY\336\t\374(%Mh%w\037\2268^\031\244\035\224\351x3\310o\246\331\314\244-[$.\360\0240\273cM\037Mx\227\002\271V\016\327\334b\324\221\035'-=\255\207\212\n5\026\214Y\213\237\314\205t$\322\315\003x\035:V\n\344\206\200\025y\206\025\005/s\2564\310\034\242\201\242\237\220\031\324Z\213\r\fir\032{E\231\344\301\371j$^V\027\0174\333\323\002t\020C\260m\0226\376~\373\247\316\330L0)^l"
+	.ascii	"\020\305n\344\245\004J\225B\314\006<\352\320,\270!\266\275F\374"
+	.ascii	"j\002\323QfO\260\342Z*\240a\300k\213\374*\2011\241\020v\317\267"
+	.ascii	"\336\260\265i<\321\007\220\311\206\003\277\255;\304\227\340\367"
+	.ascii	"\315oB\340\205\325\007\307\364\207z\323Y\f$\250\265[\303'sC\260"
+	.ascii	"\\6S$.V2\346_\200\225C\347\375\205LA|y`X\303-\352\264\340\344"
+	.ascii	"]\225y\235\226\237\r\352'\016\335,\r\300\023\352\266\336ju'\350"
+	.ascii	"\b-\300\036s\237\344\007\005\270T[a.\201\350q\362\206\335V\367"
+	.ascii	"geP\202/@\267\203\330\363kZ \243\024[g\263E\bAJ\020\375\275b"
+	.ascii	"\007\200\301\375\311\231:t'=i\227\361a\307\370\365Yb%}\265\006"
+	.ascii	"\303Z\340Z\262\320\245:\232=\355]gD\336\022Ryv2J8yd0=\025\205"
+	.ascii	"\300\273\341\326\241])\020\235bX\360\204\374\242Jy\301n1f\251"
+	.ascii	"\343&\2341\034\\y\027\243\032\3157Q"
+	.string	"X\374w\002s\033\204\3267\2072{\362)\217\027E\325\226\311\321\256R[\267\257~`4\267\037\004[`\266[!!\314*c\371O\2146T\252\003\260\333\271\0036\266)fV\221r\372\027\371\233\331<\274\"Qc\276\310\240\234KwH~\206\321\255\017V\303\277\f\fn\267E\n\032e1\275\256<\305\264\210\200\201<\313\346\365\330\300\004\273}\037\221\352\307&o\200\222h\237\271\016<2b5\211\331\314k5\323\342\373 5\207O\246\236\035PMK\344\0227\\\\2\303\251(\366D\"\037\203\241\343\357\235\272\272\212\035\020;GA\321\271\036l\250+\230\305&\\\022c\244b\273(}\204*I\202\017\217G\233(@~_\250\016\022uZy[\024\350\310\315\205\027\347\241\360V\374O\246\372\252\355b\342\r\277y\257\027\177m\177\206;\373a\037\f\236\355Fh\037u\266\324z\177/\323\235\206\002\035\246\373"
+	.ascii	"\271\263dv\252\373\206\277OBV\302_!:H\345\242\2409\"\316\350"
+	.ascii	"\370{7|\344\364\006\3540"
+	.ascii	"\307\177\346\272!\374\312|\364\375\267\"\374:\027\227\264\233"
+	.ascii	"\262x#\343\022\372:\325\037\364\f\304O\237\276\360\336\230\263"
+	.ascii	"<\335\230\201\0250\214P\344\274\006\177 s\032\335\250\004N\013"
+	.ascii	"\273\002q\250\r\365<\256\037\324zr\303\026\205s\214\323\372M"
+	.ascii	"\"\277\327\363y6\204;}9\306\333\355\035w\265\377\357_\263\367"
+	.ascii	"\354\354\004\220>\375\231\347\317\331\360\033\343\005\372\271"
+	.ascii	"\362\344\327WqbvB\261\036\377\006\332U\355_?\262\301\177\364"
+	.ascii	"\233\316c\230;\323\337\317\331\017\213u[\344\202\354\243N?{Y"
+	.ascii	"d\346\273g\326\320\237\021;(\377D^X\322\333Ke\315\350\201\221"
+	.ascii	"\021\265\325}3\275\016\216\202\227\314<\\u\3265\336\364\327\360"
+	.ascii	"\333\372\004\230\241\026\0367\263\353\312\201\224\225\300\t;"
+	.ascii	"n\336\331\276\303|&\317[Dk\376_\233\327~k\203\265H\226D\236R"
+	.ascii	"\277)\375\205h\3670\374\376\322\017dn\352j\222.\214\025+\017"
+	.ascii	"z\344\362\320\357\301y\006\370\270\307\027\266\301\363u\271\007"
+	.ascii	"\327w4\206r8\351R\334\177\"]\001"
+	.text
+	.section	.gnu.lto_.symtab.35d81aab5d1a8fde,"e",@progbits
+	.string	"gyroDataAnalyseInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"gyroDataAnalyseInitNotchTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"gyroDataAnalyseStateInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"gyroDataAnalysePush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"gyroDataAnalyse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"arm_mult_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"biquadFilterXyzUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"biquadFilterXyzUpdateNotchFromTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"biquadNotchTableMatches"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"arm_cmplx_mag_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"stage_rfft_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"arm_bitreversal_32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"arm_radix8_butterfly_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"arm_cfft_radix8by4_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"arm_cfft_radix8by2_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"biquadNotchTableInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"arm_rfft_fast_init_f32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.35d81aab5d1a8fde,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
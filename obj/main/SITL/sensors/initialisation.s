@@ -0,0 +1,419 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 +E\001"
+	.string	"\024\002\037"
+	.string	"\004"
+	.string	"\364\223\237\242\006\002\002"
+	.string	"\002\001\003\247\243\326\333\005\004\247\243\326\333\005\005\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 O\025\002"
+	.string	"$\003C"
+	.string	"\001"
+	.string	""
+	.string	"\r\315\231\263\312\002h\001"
+	.string	""
+	.string	"\002\006\200\200\200\200\003d"
+	.string	""
+	.string	"\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	"\220N"
+	.string	"\001\n\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	")\003h\206\326\022?\313m\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 I\375\001"
+	.string	"d\003="
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\0036"
+	.string	"{yw"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006u\001\001\006u\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\312Y\336\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\001"
+	.string	"\001\002\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	" \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.1367e92efc740494,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.35.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375`\026\001\215\r"
+	.string	"6\231\\D"
+	.string	"\2216\035\363K\244%\260O\364\300\375\357\211]\205\370YQ\203$\205\337\202f\246;\321\002\236\341\325\376\277\262f`\202\034t\273fv\363\200\330\240Z\377\333\022\276\316\300\006\342j\306\222a\036q\215l)S\nI"
+	.string	"F"
+	.string	"K"
+	.string	"\245\003\267\254\300\343\226\023,0\3617\340DS4P\\p\354\206\230\222\370\367\250\371\3717=\252\020\001\003\222@\217\037\256\321\200*\306\215\017\322(\202\244\234"
+	.string	"ozr \2112\0014\330]'H\362p[\267\375\3006\003\373\240\327\245?\275\234R\243\224\361\225v\006\ry\360\322\217\016\250\225J\244 ;\024\245\256\330\217\253*\366K\367\245\351\314\364\003tF\324\230\221R\230pSft,\312\222\201\342\245\3376\361M\326\274\364\305\r\261\372\002B\025.$\204\304\354\356\b\213\267\230@\201\204\344\272eo8\004N\024\344k*\002\224\035vv\227\216\307\356h\304?\275E\363M\334\262\005O\036\274\345{\256[W\315\212\226\025K(g6\220\034\250\210\301\231\r\324K\310\250`\250\256\370_\0252\217\223y\231\203\215\333\320\021`\216\310g\323\274M\247]\330h\236\366\321\260\216\333\272O\326a\037m\343\3018\\\207\211\024\360V\222q\230\267m\034\246\tC\217\253*\227\226\244\bW\252\220\212\034\222\251g\371\013\b\031\263\033:hGx\030"
+	.string	"2\241\017)\360\233/\236\315@\300\300_\2233\301\222\245\262\002\232\030*\314\025\356\206\212"
+	.ascii	"w\251\262\344*\235J\314}.\303\003Q\036&@\242\210\006\0251\334"
+	.ascii	"e\253\032\235\242\251="
+	.text
+	.section	.gnu.lto_.symbol_nodes.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 \335\355\003"
+	.string	"\224\005\331"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002#\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005)\b (\003\"\t\201\204\001!\n\003\013\001'\177\f\377\037"
+	.string	""
+	.string	"\200\200\200\001&\177\r%\177\016$\177\017\003"
+	.string	"\t$\003"
+	.string	"\b\320\360\372\250\001\001d\003"
+	.string	"\204\001\003"
+	.string	"\006\344\001"
+	.string	"\016"
+	.string	"B\2076\264\374_f\030\240\036"
+	.ascii	"\034>@\016\\\212`\301p\371\201\321@6\026{\240[\264\0262"
+	.text
+	.section	.gnu.lto_.refs.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\005"
+	.string	"\002\002\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1367e92efc740494,"e",@progbits
+	.string	"(\265/\375`\273\023\305b"
+	.string	"\212\245\220$R@\316J\352\324\3070\360?(=\023FA\b\007\035\232Ut\3072q\311\264\236\334\200\345\242\034\235\253c\020\2236R\370"
+	.ascii	"\2253\270\301D\236\001\346B\253\2014\007\324R\271\246b\002\231"
+	.ascii	"\274\017~W\304\251\371BI\377\037Z!\r\265\342\022\3336I)\005\t"
+	.ascii	"\002:\002)\002f\216\270\224#y\330h\374\233\247\254\003rY\267"
+	.ascii	"\343\262.yY'\343\262\273q\250\237/fW\0234\327\237\374\330OG\201"
+	.ascii	"\331\213\315\205\323)\313w\376\267=:c\2161bC\352O\017\251\354"
+	.ascii	"k7\355\rj\277\227\271-\024\346\262\217]\240\257\313\336\336\017"
+	.ascii	"\316\244\323\304)\341Z\342(re\210\273F\230XXh\270\343\370M\303"
+	.ascii	"\177\207\016SXP<e5\035ef\235\23556\210\260\351(\\\267\275`F\316"
+	.ascii	"\323g\303\365\033\267/\324_F\343\223\247\354?.\273\362\216h{"
+	.ascii	"\003[\243i\200[\301\214\017\260*d\242^\276\224q\351b\326%E\355"
+	.ascii	"L\2575\264_h3\235\326j\rC\223\3512\375l\264\026\303=\246\317"
+	.ascii	"\330\333\377\343\377sk\331\"\246%\3530a\232%\314z\314G\367\357"
+	.ascii	"C\254y%\254\307\032\252\204\340\311\230\336j\264\266\322_\r%"
+	.ascii	"\"\301\326Y\364\277e\023\314F\314$L4Z\227\365X\207\247\177\037"
+	.ascii	"V\002<\275\241r\"\367\337\n\021\375\240\255\265E\t\220r\2649"
+	.ascii	"\250>]v\271\261\\n\256\013&\3151FH\226\247\334-\\n\"\227[y\205"
+	.ascii	"Z\306\375\020\343\016a\351,\375\364\320bL\302\004\353\212S~\253"
+	.ascii	"'\216\2238n<e\022.\267\007\265\347\332\203\312\274;\202\305\345"
+	.ascii	"\243\313c\315A\355)M\245\237 \332\213;J\267\2743\266\337\376"
+	.ascii	"\267?\216\005\247\n\025O\371\201\313\355\344\002\246\274\t\366"
+	.ascii	"\271\334 T\335\334\\\203P\331/PsP\035\332\034\270\230\033Joy"
+	.ascii	"\320!\243\226\017\366\337\006\375\2649\244\256<\345\2669\250"
+	.ascii	"\2677\250\314}B{P\203\0063\303\300\3343\2200d0\267\t\314\334"
+	.ascii	"\001\211\231"
+	.string	"\007`v1\346\206b\356#s\033\231\373\231\333\211\271\205\314\035d\356\037s'1w\b\314\r\002s\273`\356\017\230\033\003f^c\346-f\006bf3f\366\271\271\2719fn2\247G\314?L\002]o\242\377\312\020\351\030\224c\022O\313v\224O-\034R.\227\350\302\246\3315\346N|t\376\231ra\034\214\177q/\375t2\347\302\216\305\263\264\221\271\026w\362\004.\352d\276\305\257\024#x\243\212\312\375\377\217X\223-\312N\312;\255\313\273#\227wE.\357\200\\\336UmPw`vQ\327\255\b\245U~\\\035=\345\235\361\272W\317\271V\207'd\272%J\233\2273\3616\013\230\233\376\362\331\375/\253\200\271\323\251\270\024\237\342_\376\364*\375t\257~co\301]`\241-\367\3527`Q7,1\254\tc\323j\256\2544{\006\257\226k5\rU\266ocg\255y&\3723\307\002\221-"
+	.ascii	"R\217b&\371\\C\305\273\234\253\347\313L\005\243o\261siX\003\365"
+	.ascii	"\306\212\247\016\305\237\350\310\300\031b\364'=]\315\264/\376"
+	.ascii	"\304\211#\231B\242\306S\366\342Mt\216\355O\027!+\026\201r9Mr"
+	.ascii	"\323\026\2547\250K\274\215K\207\227\220\333\364$\375t%\216\344"
+	.ascii	"\206\323qXH\211\033]FW\230\022\237\341Y\rU\002\375\361\215M\224"
+	.ascii	"\210\250\275\276\304\211S\323\037\216\245\326<\342,8\222~z\026"
+	.ascii	"{\226\323\360\033>\305\240\377!r\315,O\301\255\032\nv\201\013"
+	.ascii	"1\020\021@D\304\023%\304\252x\323\"n\244\237\216\345D\202\370"
+	.ascii	"\ni\304\260|\351\314\016O\310\013\272\230E/\027#]\212\250)\247"
+	.ascii	";V`\037\3223ClI\332\225\013\331\301\241\204v\221\272W<\225\004"
+	.ascii	"\0053O9=\262\233\003\341\267\024KL\016\256\271\313:\271\313\272"
+	.ascii	"4\327\255\034\207\253\320P\260\2433\266\350\377\367p\037\375"
+	.ascii	"t+\347\301i\373"
+	.string	"\357V^\243\254-*D\344\203d\t\024.\265\23329~\215\361\324s\270\216~\372\016W~O\317\233\225\027\255\263kB\016{QYGvY\307\345V\271\215~\372\rOr\267\361g\241\366?\254\004\263\321\r\217r\252\016O\310\025>\336\374\206\327\3501\237b\373T\036\300\361\210\023\"\"\312\271\332\022\305\210\232\262\216\310ev*\366)\335\016$\2267\355\216L\031\376\306\343\354\274\246\202xy\034\207\263\243%\254\0054n\245\007\255M\n\351f\247G\227\0238O\275M\332&I\222+\n\233\034\2554\375\3644\276\346\2027V\r\221}\233/r\237\004\023B\347\246lH\027O\207\\\215\316\031\031\254\300<\345\034\032\227\3256\227=\332\036\027\347n\254\3737\2365s\220\030\331\222\254\271[;\334\323\341\334\255\333/\252X\321\2442\304\316/\231J\013s\335\315U. v\226\\\324\334\215\331ch-=&\302"
+	.ascii	"m\203\214\211\304\323]oP\275h\304\336\266AM*\333\007K\257\326"
+	.ascii	"P)\3615\356\247\2579\031\237\362E\266M\031\302\247L\231E\335"
+	.ascii	"\272\354P\177\201\275\f3\227\361\264\373\377}$\031w&\367J\345"
+	.ascii	"\220\016\223%B\234\260\032\3664G\323I\262$H\224\247\216\346n"
+	.ascii	"\306\317\260\2439\f\032\216\277\365\337:Z\372o\354F\300\247\033"
+	.ascii	"\201\235\227#F*j\312j\325\345\335\334evf\365\215\311\377\267"
+	.ascii	"\261k?\371\244\201{\327=\304\334\323\272N\200\231\323\3271\033"
+	.ascii	"P\302\177\361L.\315]\"f\344\301\037\236w\320\377#\263(\001\263"
+	.ascii	"\352\310\324\201t2\277x\314*\006%\237YD:\377\203\376x,\036-?"
+	.ascii	"\b\351\374\252G\241LU\177\313,\376q\371A\177|\343\007\344\221"
+	.ascii	"Y\205t\032\253\202\220Nf\325;\231\017\364Gcr\306\361\223A\357"
+	.ascii	"d\242y\347\262\n"
+	.string	"\b\351\\V!\235L\036\335\205\204\363Q5F.\b\224\006\202<\376\224T\017c\022\b\212l\227\257\366\337`P\237L\340\277\3072\251f\324\321cO\320\251\2470\343\262\t\220z\n\262\374#\024\251\265\374\327zRz)\007\212-\364\2134\264x\325\343\243\240\376\013\220\372/\366C\377\277\370\3779\311\036\355\277\n@\310\246\224\324\277RH\352{\024\265@\375;\030\333X\025\322\031di\244\305\313\331|\031m\261\233\257\306L^gQ\312G\311p\233U7\342<\365\263\024\342\324\264`c\256\354\266\312\316X\t\343~z\230\233\351\220\367\217\001\254T\024\024\306H* (\214\221tYii\365\371z\t\370|\275\034V*\362\300\376\200+\206\303^\023S\320\307\263\362\216vX\251(\003\027+Z\210`\327$a\217\3750\202/\270\244b\025\006U\374\fW\"\t\253\020\250\005\322\372\303\335\315;\246\225\035\306h!"
+	.string	"/\260\024\fR\300\333\261\276\225]\221\202,q\202 \366\375\204+pM\272\354\300\211\006N\2400!\207Q\244\030\221b\204\312(R\030\031\2458at\371\204\221\216\rbW!\221\305\220\247:\255H:vi\202\240\260GA\316*$\262=\341\332\304\264\272HYV*b@E"
+	.ascii	",\217D\t\026\370\313Y\331\336\022\321\267\324\363\351\260C\336"
+	.ascii	"\257\251\005\214\365\210\267\202E\013\236\325\007\354\261C\340"
+	.ascii	"\357\262<\016V\244\300\037\013\340\320\247\376\232\206\272!O"
+	.ascii	"\005\211\025<*H\254\320Q}$~:V*\032\022W\247\237\020\211\200!"
+	.string	"O\003 \341\312\016{Lj\316\352\324[jAlb\272D\336\035\362\216\206\304\027<+om\212\341bH|\241\223\343\264\"\r\211/T\226xc\364\226V$^\023\361\262\254\260\307\016\257\220e\341\003\022+h\342`\310sZ\217t\232\210<vMRY\251\350"
+	.string	"\0166\255B\021l0(\024\3013\344%\375`"
+	.ascii	"\203*\204+\2732\255M1\330!\361\305\017\313K\352\271\b\376r\200"
+	.ascii	"C\037\357\3274\324\260\372~N+\322\317p\270\n\221\220z<\037\211"
+	.ascii	"\037\320*\354\225\200$\354)\365\260<\0249,\220\030\364\361\326"
+	.ascii	"\245&\246\3360\bF\323\022o\035\376\202@\237\245\325\211\345\235"
+	.ascii	"0b\201?\342e##\025\037:\330\300\202\353+\002\006\177lo\370[\352"
+	.ascii	"\375\330\037\360'b(\f\016\201\353P\004\360\327c\022\341\023\016"
+	.ascii	"E\024)\300.\365x0|\274\240\260\367\202'\312\315 \240!\007\246"
+	.ascii	"\253\241{3X\224?<m\2674PQa-u3\310\350\230\245\311*\363\024\231"
+	.ascii	"FA\\\224\020O\241\240Z\240\t\242\2256\261BE\214\247|\201\034"
+	.ascii	"\217&\306\346\336\374\270%\261<Ys\331\310:\243\247\365\224\247"
+	.ascii	"2Z\306\2116\351+E7\310\260\313rr\272\027Z\352\330\342\fq\300"
+	.ascii	"&\243\215\247\254{\037\255,-[\236\006\201\206\250\201 \311\224"
+	.ascii	"3HfFDd$I\322\001\361\004\304 \352 \204v\021 )\204\206jd$\005"
+	.ascii	"I%\215\0018o\\\374\270\200\024\253\230j\024\271"
+	.string	" \006\016\020-\227\b\034\322\3048\355`\351p\361\357L\241W\352\311\310\340(\332\245\241Y\252\270LzJ\221d\310\377\026r\245\247\363\302\370\344\330oJ\212m\017bAQ\363k\201\255f$\245\2401f<\242\204$\371&\r\341\344\r[\331Q>\0174B\262\322\274\225\214\363\006\261n\270\265\345\306a@\027\301\0368\3405\267\016\241\3678/\302\0223\263A=\255\224\362\3256\355}\304E\034\002\306\310X\304i\275#\232\355t\2463bjt\244\205\302h\031\304@?\tX\240\360\374.h\213Yk\276R0O\300\313\221\311\217\214_\236$\235\3045T\313\233\255\321\324\202\346\320\246\370z\323\300\303\016\003N\327\316N\317ku\005\213v\300\t\357\031\273\"\206\306\023\271bNU\256\036p\023\f\235\001?\2364\341\266\333m@\3450\252\3445\307k0\217\b+%\252a\257m\356\367\323tp\275'\004\207\205"
+	.ascii	"\\\365Iam\233Q\027\035\026\336\326\032\335\257|\303\035\004^"
+	.ascii	"\20703\265\221\235\271o\356~\006\213\260\323H\362\247\333T\016"
+	.ascii	"\002v\202w\310L!\367\245\t\270\222}\254Z \3779\275*\231=\321"
+	.ascii	"\310\265\366\0266K9\251\257\nUU\2168\340\253\177\361\0201\356"
+	.ascii	"\303,C\337\307\347j\032I\315\016\354\2343\240\217"
+	.string	"\177K\301\303\001U\230\366\351\344\242\006o\020z\035\242u4fx\337\232\320\313\310\275B\351\3168\216m\302\265\2474\205Z\036\260W\026Y\202G!\207vms\212\352\035:\005\001@8+\323\202\317(8\370\216i\332L\347d\\\375\222\203\301\277\212\304\241o\354np\345\fk\212\2721\363\226\206\201\243\234\20101\034\200*Un\022\2300)\202a\001r\312r|\241X:\321?hO\025\261p\352\275y\240\320\217\362\016\315;\250\207\037$\356EK\355\274=\016\304\035\177)P\325\335\353\262\212/\300\021\342\315\020\200\026\324P\002\3600QA\267\325\367DI\370b\324wT\352\216\017\306z4v\214\341\200]\212\272\220\273\264\203?\242\244k[\251j\217\200\254\221\244\234\336\363\377\201\366\177\334\305\345\354\204$\366q%\r\007\263\321\307\353\t\345\023\017\371\310\307Q\311GJ\360.Y`\204\317\2205\023\365tz"
+	.string	"\334\310h\203~|v\302P\314\007\232\030`\367\300\262Ew\237|\013\354\227\265Pf\220\350\233\275O\fRm\311\257\374k\031\324\255\377"
+	.ascii	"\213\223\346\374Z\213`m\017\342\322xp\244AF\222\375\201\255a"
+	.ascii	"\200\246\030\226\202\204\021S6\346\26101\266\003I\206\276\317"
+	.ascii	"\322\316\t\020o\260\301\240\277g\030\347\371\353<\270\334e~\212"
+	.ascii	"\r\210(\335\202#\363;\270|MQ\357\244\200\231\370\375O\360\216"
+	.ascii	"\230\226\210\321\037\027E?\222\017\256\344Z\374@\233\304\357"
+	.ascii	"\342#\337p\363r6I\025"
+	.text
+	.section	.gnu.lto_.symtab.1367e92efc740494,"e",@progbits
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1367e92efc740494,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
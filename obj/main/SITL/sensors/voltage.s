@@ -0,0 +1,832 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 \361m\005"
+	.string	"\224\b\345"
+	.string	"\026"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\241\355\342\223\n\004\001\002\001\007\333\326\241\250\n\b\355\320\377\372\005\002\002\004\002\005\n\274\205\242\255\006"
+	.string	"\013\f\357\313\212\236\006\r\016\244\310\245\335\004\017\314\251\277\367\n\020\374\322\374l\021\022\023\242\302\263\302\013\024\025\225\254\310\321\004\026\240\342\234\212\n"
+	.string	"\r"
+	.ascii	"@\211\245\356ZLKA\265:C^,\350R5\204\"L\331)\001y\336\177\205"
+	.ascii	"\260\334@\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 i%\002"
+	.string	"t\002]"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\001\n"
+	.string	"\001\013"
+	.string	"\001\f\001\r\016\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"\270"
+	.ascii	" \240\3120pb\247\231\234%NQ\201{`0\225i/\301m\240\r"
+	.text
+	.section	.gnu.lto_.inline.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`<\001\315\006"
+	.string	"bK!&\220\027&\035W\235D|\337\313\331:\035H?\273\201\254\215\377\337h\273\325\177\337\375:\321\3326B\2104B\344N\001\2570xz\243_v\231@\035\036\247\351\t\361\267\342\217\r\330\232\360\027x\240Z\021F\315\3430\264\001\220\303(\036W\230G\217H*(\372\310\240\017\231\231\314\376\323\256\t\375\214\240\355\245\0242s\341\227C\023\003m\211\023{\207\372\272\32753S\375R\326_\025\307qA\357\275\267\376\270\001\001# \240\302c\303\007Q\005\001\250(F\004\240\025\344\n\302\232s\362\300\210d\016\244\364\264"
+	.ascii	"\221\255a\003\001\306\253\275fa\335PP-\2018k4-\b\271]\321*\234"
+	.ascii	"}\030\227\033\233!\335\305\316\t\201\363\264\277\321\275a\276"
+	.ascii	"\206\272|uhE\031\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 \372\365\004"
+	.string	"\022\211\034%\200EI\007\265#f\203n\336\030+\247\007.\242\233\270\f\036\002DF\224TA\002b\026\375\217Z\333\215\020\231d$\257\177\253\252'0\024T\217)\235\257C\022\310\301\363\314\200\021\367\312Sfb\200E$\035I3\254$yC\366\220u*\272\246\365\232&\227<i\360\b\035\217\016yYS\300^\224\221\215\3525\275\303\227!\215Y\226\252\365\324\323\341@\021"
+	.ascii	"G\220\243\331\270\212f\0028A\323\244\340us\276\003w\205\3004"
+	.ascii	"D\001%\fH*\220\031\352\016h\002 Vi\007\006X"
+	.text
+	.section	.gnu.lto_.pureconst.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\270\004\n\200\004\013\200\004\f\232\004\r\232\004"
+	.ascii	"\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\255\003"
+	.string	"\242\004\017\030\260'\035\200$y\220\230S$\355\340\256Bh\322\004\331\232\221mD\312\024'\312\202\004\263U\025d\233\022\303\243\034\276#j\025z\007\374\255\347|\225\033Ue\237\261'\033N\214\236'\027"
+	.string	"\220Ei\031H\254\230\207i\007\006\203A\274\001\365J\220\257\202T\016\240\275Y"
+	.string	"-\002\0063<$J\210\236\022\354J\027(\003;;v\016\326e\3662\362"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.2b9c37dd2c207356,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.23.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\264\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\370\257\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.26.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\205\b"
+	.string	"f\320;6@\223\032\003\030oj/0\364\026\323J$\324\036\212\236\311\2532\327\f\265\t\326^@\371\215vp\333\036\3354\\\006\004\206\252^\345\317\337\177\003\357d\254$R\246\024)"
+	.string	","
+	.string	","
+	.string	"\231e\275\366\305\337\352n}d\270`\377g\354\260g\350\325&q"
+	.string	"*e2\004h\370_\210Jm\270\321m\021\332.\264u\t\252\326,\033\312,\246\305\200\346\327\210\325\374%S@:m\r[\213x\3043\253\344\201_\265r\362\177\nM\340X\366sAf\3111A-\267\023vI\030\226\020\223\262\266\302&$\316\177\206\272\304\342B`\345aY\2272K\211\242\002\2339\301X\373\231`\344h\275\371\377\306\2346\322B\262 \217\366\360\031El\024\263\343\266N\244uS\004\361\tM\020\327M\317A7\t\215\233\243m\343f\347\2737\217\252:\310\274N\021\243\016\013"
+	.string	"2\241!\034\030.XIQ\362)\262!cY\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.28.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\035\t"
+	.string	"\306Q@80\221\322\001#T\234\207\207\033(f\022GX\235\213\334\305\361\373\240\262Cg\250\326p\363Jk\003F\316\345e\263a`\240\020\205\330\255Y)%\340A\233\263\3266\221;\245/"
+	.string	"0"
+	.string	"."
+	.string	"-P\207l\245R\263\033N\207\017\340\\z\016\300\271\324\217\177\217\237\377\222k\".\032\220\225z\3548\354\256#\310j\335z\333\007\266\025l\313\004Q\243/;.0\0043\273\0333\233}\221,!\266Q\366\307\266F{\201\001\365\030\206u\327%[\331\r\023\214\340\271\264\355\217\234\004\345O \204\005\3168\n\205\001lw\033L~\342\371 \227\2568\305\203\227\376I\037\003rD\275j-\253\033U\234\331a*\252\207}m\365e;Z\037\373\003\027\333C\211$=\nm\020\"S\004g1\275\216\363J\2337K$\221\304\034u\336\f\r\230\233\330\272i\342\270n~\302\275\266\372\262\026\250T\303~\312\007\202\201v\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.32.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\374\321\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\030us\350\355\007uq"
+	.string	"\005\001\006'\001\003\202\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.33.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`'\001\225\r"
+	.string	"\346\031\\C\020\221\223\016|\272\260/\360P\251\004\221v\360j\2663\310\327"
+	.string	".\306\256\367\003\203\t\005\3758\351/\302Z\214:\030\330 \230\\)\306PUU\272r\335n<\004\223\241\202\1778\274\332q\251\265\275\245L)G"
+	.string	"H"
+	.string	"H"
+	.string	"3\356\241\354\277\034\032R7v\367\322\020\376\241w\303\334\036\241\346\346kBX~"
+	.string	"\005\206\353H\217\220\263\273"
+	.string	":\f\220\223\246n$\241\b\223\353[\236\340\204\006\327\231<5!\273\353\344\272\016w\346\2663\333\f\354k\001\273%+\035\353\022W\250d\376\263\237\272\347\267x\363h\227\270\211\355\237YX$\016\226\352\333Qcw;\217^`=r\3407i\177\304Il_\271@ \300\222|\033T\354z\n\374a=\332\373\200\314\243u\001\231Gov\273PQ\252\243\020\201O\371\211\n\022\362\005\306n\206s\217\276\312\202\210\237\342S\310<\"x1\201(\345\312Q\257O\275A\213\223\030\316F)W\252\212\262=R\352iwI\326\223\375\225?\376\273\363\351k<<\2740"
+	.string	"\023\241\203>\"\317H\023\205,\177@@\016<\243\007\330\204K\3130M\004\322.Q\310\003\341\372d\332\005R\300X\004Pv\2150,\2736\336^Of\271\225\342\203KIG\034\025e\215\013\375\270\312H\223mw\236\252R\022\363\305 I\034\207\273\001\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.36.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`&\001\335\f"
+	.string	"V\227UB"
+	.string	"Q5\035\200\232,\250[\243\203\252\225\365k\315\304o\321\214\b\266\351"
+	.string	"AxAd\016\347\030\300hy\200\r\325\230\217\221 \231h\342n\b"
+	.string	""
+	.string	"(AK\341\033p#\371\235j\365\305FK\233\354\235RA"
+	.string	"@"
+	.string	"G"
+	.string	"\037E\354\311\327\005\262\334]\216\206\2606\301W\215N\320\177}\246n\220^\265\313\356\002\b-h\027Th\232Z\t\325\351c\237\036/:>f\241\352S\222`w=Oa\352\336n\273\201m\002\366M\001eHi\216PJY\366H\232swI\246+\373\342\375m\201\253\254\201\371\330\3050\"\2620\252G\353\342\355\313\016\363c\256\274\0260"
+	.string	"^\034M\326%\231\221\"\310\356\210yuf\362\372\212A{F\255\0176b\310\2500s\\\333\335\325|\362\366\347,B\226\r\036V\250\240\200\b1a?\264\331\335S\204,\032D\016\330\316\274\343\0033\224\035`\273\213\340\304Q@\360I\274Z\302\204\371\323\253Oa{\275\354\003J4\002\236\233\243\3510\330\210\034t\021\270\317\353>P\347\343@\236\315\207\343x\037\247\021\340\356A\307\343D]\347q\225qOW\257+p\341\302\001R\242&W\3122\205\003\375G[\0351?\373)\312\036m\247\217=@\213\033"
+	.string	"2\003\006j\214\250\303\213\232j\212\212"
+	.ascii	"\001sLx`0@\004\021B4\201\2513e\315fx0\213\201\271s\271\24732"
+	.ascii	"U;&%\343\345\212 3\334N`\264\253\302\357\231uPD^\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.37.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`\r\001m\f"
+	.string	"f\226RC"
+	.string	"q\234\016@\300d\274\341\244P\222\222\233\351\360v n\3110\312PL\022\034\330_\fO\362\277Tp.)\212\233 >J\tUUA\301H\377\230\227l\022\216)\035\321A7\335\212J\035\271\355\336)\005<"
+	.string	";"
+	.string	"E"
+	.string	"\330n\206\026+v\313"
+	.string	"\006p\275\232|\304z\245<\304z\365h\313x\311a_\212A\241dcw3\272\341\343\347\350\237t\214\364p>9\n\354\256'\351\261p\323\333>\261}\261\217!\032\354SvwM?\366G\177\275\350\247tz\322\351_\225\032.,\250\335\n\253\324\236\252\251\203\355Wl\317\362\"\306\2176$ ;\201ta\300\365\352\362\372\264\017\342!\306\213\"8&\225\207\024(&\305L\252\017\2476\346'\272\353&\304\214\b\f\320\306z\245/\310\031V\360\022\035\026J\t\260\r\341$\276\217\020\212@\351#\030\370\240W\207\r\346\311\007\326\353)\026J\335\020u\346\312.9\223\006 'r\007<4\234\347i\t.\033\002\255\303\233\205\303h\242\346s\220\205\340\027z\\\230y\031\255\31360\314,%\376\026p`&~\037\230U\312=e\351\307\006P\247\016\225\340I\355\355,(\r\356*:,\032"
+	.ascii	"\2263\241\214\351\3043\f\267\352\030h\003/\002M\240\273i\310"
+	.ascii	"\362\0069M\2572\226]\250\306\215\320\\f\235\373\226\265\331\312"
+	.ascii	"\360\2265\027\336b\230\027\204\337\324\024\270\027LM\001wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.38.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`x\001\345\016"
+	.string	"\026\\bD\360\222(\035R\207_\212:\371\207\030\335\346V\271*\361Q}\353H]\335us\256\256]4\003\313\317\366\277\"\353O\320 -\200~\375\002H\0308\003\263\223J\037\242\221Z\334\247\211\237\347\005\310'{K\231RN"
+	.string	"K"
+	.string	"O"
+	.string	"\256\221G\037\320\036\3371\311\326qW\211\375\013\310\312\213\307\356nJ\3020I\217P\223\344sJV\037\240\342\363T\245G\350\331]\021\325\006\350I\026\325)a\212\226\353[7 \363y\252\226'\247dw\235\236\312\303\235\3356\005\333\b\354\323\b\030\362\336\243\335e\310{\376\314\317\001\346\022KiIUcl\327)swKV\030\373\254;\3024\204i\325tf\372"
+	.string	"DB\334\330v\354v\370~l,\316\2209\353\366g\276\302o\271\363\270\200\001\351,\025mQp^\274\276\233\335\020\340\235#{\264#H\360\244\264dU\307\370\2135\324\256\211"
+	.string	"\324\247j\234\362s\252\352mR7\327\324\257\004\261'\334\305G\333E5\360k\336\002\024\022]\224=^\025\214\250\351\3212\345\347N\026\270md#\367i*$8\213\023\377\304\243\271&7\210$$\372\244X\3404l\335\210\353PB\335\206b\3629\331@\243n#\021`\356Bh\264\245p\334h\353\270LW\230\3255\230\210\230IO\216\032\343\220\017z\023y\031\217\312\342\253dQW.\037\r\016T\3728\204\016\220\007\361r\007\031T\037\366"
+	.ascii	"\306m\002! @\002\205\222\255\007b\300\357\030P\007\312\2508="
+	.ascii	"8\215\242\2548\271\3051\t\266\354\2508_\331c\347\375\2043\027"
+	.ascii	"\260\213\r\303vYv1p\326q\345\302\203,\206\271\342\037TF\346\355"
+	.ascii	"\230T\306sEg\006W\331-kGy\211t.\363\004"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.39.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 \302E\005"
+	.string	"\262I$-pU\323\001\032\345^?\003~\r\035p\277k\260T\025\216\021\023\250\221Q\333\251_\247b\233PU\261Z\034e\332\037\334%\344\026\355-S\266\250\253Qe\2209\221\225\316\212]Ub\217*\"-Z%u\360\224\\TfsR9}\337\350!(\261b\177\033\214\031{\005\377\357\350\331\320 @Z\210\376\313@\300G\203\020\307\366N\326\354\322~\233/\250c\371"
+	.string	"\374\227Q\263\332B\315\273\236-p\335\266\220\300\370o\310u\230u\\\333\t\333\n\333\216\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.40.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240{\375l\201#.\300\232\350@S\303\325\201\375\330\274\250\355\224\255\314\331\335\375\377\316\253\234y{\361T\336\217ho\231\002\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\227\177\001\035\275\037\0226\243D\250\273r2\265("
+	.string	"\322\374_\352\332O\332/\323\353\371P:\245\356\346\210Ym\241\366]\316\016\270n[(Pt\367!\327Y\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.41.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\265\n"
+	.string	"f\324JB \347(\035\220\305\021\264o"
+	.string	"\300\024"
+	.string	"\007\t\016\256\317\311N\210\353\001D\303\256\260\001\373aU\274\250i\274?:>\201\030[\356\221\333\020\200,@)\265\"\n\3421\f\0069\213\2418\177\260#\331)\0056"
+	.string	"6"
+	.string	"8"
+	.string	"o\231x\333M\0250\260KRxbs\352\321NpR\265\207\305R\002\320v\327\333`>~\216\376]O8\241N>\0214v\327\363\204j\271\267\333\216\260\335\261/\021,\265\006\213\200\036\230\261}\377\365rt"
+	.string	"\356\230\261v\267;\265Gvw\372\316\3666\355\323\274f<Iz`X\224\227\n\006y\007\356t\363\006\356\324s\332\025\026c\365\004\250,\306z\310\275\364\310a\341\202jw/|\001%\"?\346\324'q\247/?eVZ\251\326\2544k6i\232\333\213\375\203\335\\\354\223\377\244\343\212&\313P\260\033\340'~\033\n\340\347\001\022q\200U\254\240\316\037\316\367\341\021C*\211\027\2025\f}\241\027\002\361\200\274\017\030z\034\bW\221\017\364\304ZA\257#Kw\275S[1XP\332L\376\200\277t\017"
+	.ascii	"\2473\241L\2130\334GX\023\023\260\243&\t\2510t\r\237\320\304"
+	.ascii	"\0034\032*\334\006s\277T<p\347\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.42.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\235\t"
+	.string	"\206RC< \005)\035`\305\330q\004\034T\017A\260\320&\272ui"
+	.string	"\034\326X\253$J(\232\353Wl\267\254V\202@\256\321\310$\240P\360\270\255\t\367\032\202 \240\317bHZe3\262S\n0"
+	.string	"0"
+	.string	"1"
+	.string	"W\330>=O\330>-\3325\257\253\275K"
+	.string	"\220\230\316\356R\355\344\342\245\350\377\365\001T\352\343R@bw-Q\251\221[\273m\006\333\020\366\r\0023\0219\273\"3"
+	.string	"+3aT|\226\217\244WW\300X\273\313}\332$\233\373<g\373\322~\353+\342]\245\037\354\252hd\273\325\301\r\236O\327\254\217\266\217\336xlT\260\332\335\007\037\346\321\341\243|\372\245\355\363\343eJH\253\244\205c\2223\273\236\244fb?`w\327\232\312\276\353\227\023\201$_\027v\024\004\016}:\013P\210\341qP\360\363@Q\007R\321\005(\203\206>\220~\026\354it\037\r=\357\243\\5\375\365\211\224l\307\306\244\235\374\226\1774\370\227y\023\023\r"
+	.string	"s\311\"\3236\030\351#"
+	.ascii	"\211\t\330Q\223\204T\030\326e\036S\241\001\025\255Y]\001\327"
+	.ascii	"\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.44.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`+\001\325\r"
+	.string	"6\332^E"
+	.string	"\223\223\016S-;&e\223\315Mi\351\333y'\342\254Y\241\351*\366;\343\004r!\305\317\330\266\336\276\366\243\bVu+\371T!\0304\350\256\252j\360\252\277\247S!\245R\262\205f2N\"\331{\357\224\002K"
+	.string	"E"
+	.string	"L"
+	.string	"\233\235\3435f\337\302\343`\343cwi\204\371\366)#\334|\323\013\004\021\245N\034\313\347\277\213\240L\251\023\347ri\271<J\005\035*\304"
+	.string	"\256E\216\340\230\300q\323a\007N\004a\310\203\3355\034q \356\352\266#\330n`\237\013:{3g\310\330\276o\363/\345,l"
+	.string	"\306F\347\355\356\365i\247\330\327\347/\333\260\276f{I\345\"\273/:\324\372t\265\016\355{\237\331N\263b"
+	.string	"\273%h\304\330\255\f\274\300\372D\360\221\352S\236@\365\351\325\347\277\303\024\036\274\316\343\021\202;PF\017\034\022\262\2021\332\0304\300\217,#\313U\214\272\233\030I\016\360\225\352\361%\231\232\035\251\033-\020\210]E0\222\354\313\335]\307\027\373\245?\236\346\277\225 \247\023qb&\326\250\373a'\032\006\302<S\302\t\264\t\t6\241\004T!\313@?Z\366A\301>\024\345\244\304CM\264\017%9\340\314\002\246QP\226i\364\252\241\233\016aD\375\221\023\212\242\031I/\376\317\024\016c\352@\255xV\375\263\347.2\0011\273\353\300?m\270\340\243P\t\030"
+	.string	"2\003\302p\323\204\365\t\250\364;\236\306\342GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031\314\244y)\215A\355\001"
+	.text
+	.section	.gnu.lto__reset_template_126.0.45.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.53.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`\324\001]\020"
+	.string	"f\235hG\360\262&\035\242\203*r\r\313\b\027\316R\302\251\031\325\327\376\244\336\235aX"
+	.string	"\330\022[\313\356\3417D\336zDSQ\363M\352\210\362\216\320\246\204A\315\200\225\377\210\266\"\257\325x<wh\033H\325\026\311&r\247\024Q"
+	.string	"S"
+	.string	"T"
+	.string	"\255\031\317\256\270\340\323\nB\237\026/`\373\f=\300\366i\377\205m\325\213C\333\307\305\025\373\235\032\020\257!\273\333}\252\314\303\253\324B\037v\223\"->1\230\017\327\217/\001\302\361\211\301\214\270,\2716\022aw\035\"q\317\333\206`\273\201-)\004\037U\256\343\0033\326\211\335U\261\277\363\230\315y\345:& \363\303\252\331]nE\3720T>\314\234\355\347\250\376b\221\023vU\"\301\247\025\3471\302\277X,\332U\321\303 \364i@\343,\345E\325oR\003\304\025\361b)\355\333\334\025\376&u"
+	.ascii	"\273\001\237\332\303\005\310G\223n\303\023\321\314"
+	.string	"\034|\264O\3432\024\022\032!\017x^\243\344\317|~\314`\222w\3716\016\333\347\365\343\245\f\023<X6\256\225\f\222\032c\325\256\255\266\354MZ/\376r\223\376\b\202\031\tk7D\320lSL\031\213\347\374\366\375\031\001\030J\022\364P\236i\232t\342\241\214P\032\276\016\335\t\374N)\336\251K)\215L\035\t<u'\005\374m\360\300\016\365}`\307][m\331\260K@!\022\371\261\322\026\253j\214m\255\360\035\032\304\302ux\"\031P\213\034=\252\"\031\220\013\227/\034\207g\362\343\337\3600\362gR[- \220\002\231\033\225\007\344$\206\233\004A\334\220\002\030S0\312'F3\006\243\023\353m\030`\307\214:\343s\343\025\206P\332\007b\314\221\201lm\237\265\222\247#\354\030t\223(\302\307\024t\356f\027\023\264\267\312\213L\211\327\360\037H=\206h\206&\fi\274\364$-\3546S\026\032"
+	.ascii	"\264w\364$-=\301\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"\235\007"
+	.string	"\244\n\346\001"
+	.string	""
+	.string	""
+	.string	"\002!\177\022\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005-\023\200\204\001"
+	.string	""
+	.string	"\003\0025\177\024\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\033\013\201"
+	.string	"\002\032\177\025\272\200\002\034\177\026$\177\027%\177\030&\177\031\0050\032\002'\177\033(\177\034)\177\035*\177\036,\177\037\005+ \005 !\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\035\"\036#\031$\030%\027&\003'\001/\177(\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001.\177)\003\b\030$\003\b\304\001\003\016\002\340\236\212\256\001\001B"
+	.string	"\035"
+	.string	"]\233\307\324\032\206O\231\3763\254[\202\341\362\003\243\201\334@n 7\226\334\b\232\361\300\032\034\240\035\370\034\370\334\316\317i\375\2740\326"
+	.ascii	"\364\230\352\017d\340\016rv\276\300\353\221#\\\030\234fT\370"
+	.ascii	"'\204*\003"
+	.text
+	.section	.gnu.lto_.refs.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\001\005\002\003\002"
+	.string	"\002\006\001\003\001"
+	.string	"\001\003\002"
+	.string	"\002\007"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\003\b\002\003\001"
+	.string	""
+	.string	"\t\002"
+	.string	"\002\003\006"
+	.string	"\003\020\002\021\002\022\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2b9c37dd2c207356,"e",@progbits
+	.string	"(\265/\375`\254#\025\240"
+	.string	":\377L8R0\222\312I\007\016\212\303\232\316;\ts%L\257\2248r\203g\025\024\005\327\242x\032+\357L|\265\300\254;\n\032\332\326\207\235<C\345\225e\263\377\220\215\353\347\337u3\313\241Z \273\016\203\230q%\273\256A\254\250\210\367\272\317!\321\264F\266\224)\361\002z\003\231\003\347\355\001=\276\343\003zo7\350\317x\204\214\003\202V\034SA:F#\177\304\242\212d\365\331OV\006\215-&}\276\313\240wm\354\313\314>r\234\363\034\017\361\226\362\206\313\200x\367f\201Q\336\273\366\221\341\254\267\n\203/*(\350#\313a; \343z\251T\204\301\2015w\357J\342\304\211\0236\307\024.J\364d\273\346:\236s\266c:\037\344\312v'+"
+	.string	"\304\254"
+	.string	"\217\313\221c\224\025}s\241\021\360\210^\257\263\320w\016\364-\205\376,\347"
+	.string	"\212\324\302\374b7qw\025\201\002\362\f[\237m\202|@!!{\203^\002+\\\006t\024\272\310\2470J\226\302kx\n\227\331\325\f\235\021E\f\334\275\353\033\263a8f\362\032\276r6c,\274\206\263\260\032 \344z\215=Oh5\322t\322 \347\252\240\247\033\t\264\214\310\226\020}\236\307\320\363\327\357\023\223\006\027\366\205\207\331\327\331\0235_\2304\245\226f\232/mI\032s\361\362+\334\034ce\02758\t\300\374\n\320\316\275gM\314\356\275g\270\f\263q\032&\303h\270\215\307\260\031f\362\032\253\235\243\360\362\347z/\362\336\353\373y\013\207\361\032\243\375J\t\250{\317~\f\020\266&\312j\356\336{\202\304\211\236+\263$["
+	.string	"\347\271\007z\256\201\236\243\320s\022=\307@\317G\3649\240\307\001=\f\364/P\241&\217\350\235C\264\211\\@\037\002\312cL\306L\007\270\312Y\214\245\234w\\\357z\357\032\324E\354\310\242\364y\rP\003\302.\005'"
+	.ascii	"=;\320\263ww\354@\357:h\363PO\210G\364:\213G\364\030\340\241"
+	.ascii	"\236\t\036\321\204\277x\265I\251\254;v\223\253\bFrU\t\353\223"
+	.ascii	"\2370\330ye'WA\301\2551\354~\335{y\235 \353\336#\257Au\367\036"
+	.ascii	"\203\230\025`V\340d\262\305E\245w\256<\242\207\362P\317\004u"
+	.ascii	"\350\3574?\177\360\263\b?\207\360\263\322\177,\305\376y\317\337"
+	.ascii	"d\256\363[\bl\370\316o\037H\300\032\360s[\373t\321\317W\315\363"
+	.ascii	"s]\357\374/\341%>\300o\207\336@\320\3775\377\331\304\235\347"
+	.ascii	"\267\274\277u\310~\226\362\363\330\317S~^\376\034\366\263\330"
+	.ascii	"\317T\272\3673\327\317\353\317`\315\373\037\364\333\034\377U"
+	.ascii	"\270\n\350\337w?\377\377\335{\177\253\375}\376m\377\376\317w"
+	.ascii	"\377y\277\205\362\263\335\317k?7\177\356\362\263\226\237\315"
+	.ascii	"~\266\3623\363g\254\237i\370\031\307\3176~\246\372y\352\347\250"
+	.ascii	"\237\241~\236\361\363\361\347\034~\266\341g\365\347\245\237\223"
+	.ascii	"~\206\341\177\225\237\355\3776?\277\360\337\355\347\026~^\341"
+	.ascii	"\347\024~6\341\347\236\237G\370y\203\237y?\237\377\335\374\217"
+	.ascii	"\373\277\376?\361?\314\177\241\273\273\273\273\337\306\360\353"
+	.ascii	"\024\360\027\320@5\322\346\332\213\232\0217\270w\233\346\"\244"
+	.ascii	"\310\016}6\233\326\202f\261\241\003\332\032K\343\007,A\326\274"
+	.ascii	"\375P\361aEFM?\235I\266hUQ\303qzdn\350\306\324\240G\267\240g"
+	.ascii	"/\3563o3\215\246\331\320\253l\201\314\034\270[e\003\305\212\334"
+	.ascii	"\211\302Ag\267\242G\211\240o\264N{\253]\255\313\360U\006Q\350"
+	.ascii	"\340\356\325\025\021\217V\225\264%}v\231\257\361\271%z\346\270"
+	.ascii	"\331j\366\3717\275v&\211#\304\306\332\030\037C\300\332\230\274"
+	.ascii	"\037\242t\351\352\363\335\354\345\377\373\343\005j\213X\237G"
+	.ascii	"\241\320\377\347\336=V\335{u\340\255\267\352\311\247\307<f\242"
+	.ascii	"\377\207-/p\211V\334k\274k\312\241A\\9\362h\023\367o\336\213"
+	.ascii	"\3242n\240e\205\324\312\221\\j]#\022\211QD\325\3252&\227\367"
+	.ascii	"\212\270H\244qE\326\025\221\\^\253\033c\315\212\357\252e\274"
+	.ascii	"\310\254+\342\"\357\321D\022\251e\225\\\036\255D$\227ZVw\251"
+	.ascii	"u\205.\362X\005\205\274U\"\356R\253\315]fY\t%\227YV\311\245\326"
+	.ascii	"\017>K\336e\261\232\323\334\252c(I\344\2551\205u\254\022j&\327"
+	.ascii	"\254\313v/\217\311\270U\013\334\213\225U\305v\314\301fO\315\032"
+	.ascii	"OU\216Y\274\336{\t\230z\332\312\272\310f2I\326\275I\236\226\356"
+	.ascii	"\324\004\306\265y}\340\2461\b\326\225\222qo\001S\367\032\371"
+	.ascii	"6\357\275\306{\257N\025\326z\357\016\241\244rj\352\336+\022S"
+	.ascii	"\027\313\210E\306\275=\326ff\225\\ne\371\260\210-\225w\306jd"
+	.ascii	"\345e\323\252B\227F(W\312\r\252\264\332!\256\3170V\274\334\314"
+	.ascii	"\266\020\365\227\035\344z\227;g\334\364\030cza\266\227\346\022"
+	.ascii	"\302z\215@OmUW(\230\312\216N\224t\341\"\f[\246\365\371\346r\216"
+	.ascii	"\353\254\001xu?\310\350\372\364\371\336[\206zUW\353\rb0:(^\260"
+	.ascii	"t\026kD\00763\202`\261\322W\232M\331\026\035++eU\224\214\250"
+	.ascii	"\305\351\223\351\323\345\244Ko\016=\005aH\224Q\216(\2474\225"
+	.ascii	"&cf\217\365\362-\245\257\316\276\261\026#\303\205\003+\270D\002"
+	.ascii	"\004=\337#\203Z*\350{+\372\036\020P\332\213\247\210\026R\tUU"
+	.ascii	"K\371\252\342\316\272(\370}>`\300\004\315\253yp\0317{\330\340"
+	.ascii	"\353\215\210\030\345\220\226\3229\242\243JJ\017\315\026\242\203"
+	.ascii	"\350\265\225\315\325K\032\210N\322M\272\253\237\264\222\376\241"
+	.ascii	"\277\032I3i\260v\302\314\366\352\"o#}\344\347\016\266\353q\335"
+	.ascii	"\270\263\271\031\311(\036\302\206\031\027\254\006\262\206\345"
+	.ascii	"h) {\257\0179\312\236\252A\343\006\016.e{\265V\013\261\002*\253"
+	.ascii	"\212;\233\343/\253\226\0022\n\335'2I\245\016;\264\0247\257\256"
+	.ascii	"e\003\027w\326\325W^\315CK\351\024\201\213;;q\342\304\271\366"
+	.ascii	"E\t\220\006N.\321C\242\347\265A\317KC\317\233\202\236w\004=\357"
+	.ascii	"\307V\007\371i\346HC\245\317\363hl\305\351,\236\222\023\262\244"
+	.ascii	"\317\237kh\367h\037\314\354\037?\303\262\356\362\336\365\307"
+	.ascii	"\036q\240]!\352\0051Q\357\347\025\364'\030\372\363\007\364'\026"
+	.ascii	"J\342\016\275\205C\211\304\240\267b\250\005]\350-\021\364cv\007"
+	.ascii	"\364fPM\203\231\007t\324\317\034\2579t\035>\204h\275\255\371"
+	.ascii	"wt\250\234\341\241dC\3773\006}\231\227\261n\034V$\252\213\b\235"
+	.ascii	"B\005\213G\333\255[\230\024\230!\372\264gl\232{\201\002\263K"
+	.ascii	"\303\246\203%H\017G7\237:\036qh,\032V\263I\264\2304\373\264f"
+	.ascii	"~\345,\254\f\016L/\215\252NN\331\332\327\032L\b\367hE\344\305"
+	.ascii	"\350\3265w\253\316PX:0C\266\364\371\037\2543f\3323\333\344%\317"
+	.ascii	"\26348\240\246\031\036sj:F\346P\345\020\263\366\\%\313\236\364"
+	.ascii	"y\233\366\333/\026\214E\3639\321F\307\231E\263b\232\330\030b"
+	.ascii	"d\007\013\235\222\033}\262\230\3576\2145\353\"\243\256O&\361"
+	.ascii	"\203Do\267\260\355\322\005\201\266\032i]?H'9\344\310aa\253E\213"
+	.ascii	"\325A\306\207\030\024\250\\\222\"<\276\240\314VG\357\267ffBz"
+	.ascii	"p\342\326\264\2562f\3322k\205\205\356\335\252b\366\263\005H\234"
+	.ascii	"1+U"
+	.string	"d\270w"
+	.ascii	"\236\245\215\266\0357\254\217\333#\326\207e\332\344\325\265\201"
+	.ascii	"\202\314\020}E\353:\351\223\212N\224\016\246\317\027\022\253"
+	.ascii	"t\353\362\203\345\372j\203Kb\227,Q\323\322eWn^\t]\244\0256pK"
+	.ascii	"\013\204\345\0022\212\2707H\0321Kf\307\254\024\033\305Na\246"
+	.ascii	"]Z!H\330\245\r\202\355\314\033\256&\320\211\344o%\236\222!<Y"
+	.ascii	"\255\227\005\343\346\325zu\350)\033\003v6g\303\230i\327\223X"
+	.ascii	"\357\035#\340\207.\315\334\223\036\230}bF\203\307\214>\255\023"
+	.ascii	"^\206\211\n\302\326\204\231\366+h\006\020vH\372\264L\376\006"
+	.ascii	"e\244\021u.7\2604A3\203\276G\r}O\026\253\0045\003\327#\255\n"
+	.ascii	"\372\2361\364=Q\320\3674A\337\263Di\271xK0ri\226K\252\311\240"
+	.ascii	"I=\001\201Z\037l\021k\344\337\tbb6\204I\244\004\"j\314>O>\227"
+	.ascii	"\236\345\341\266\207\177\247\303p)\247\204\240\267B\354\220\177"
+	.ascii	"\007\210\r\t\031\224>\337\323\003\275\r\302\274\223\323\321\247"
+	.ascii	"\335Be\364P9\300\323\303\312\017\273\365[ V\213W\031\356E\336"
+	.ascii	"pg\307\306#z?<\324\263?|\267Y=i]\340\300\372\364\341a\203\336"
+	.ascii	"\356`\213\305L\213ewp\232\037UX(xu:\330t\235\241vG\363tq\240"
+	.ascii	"\335(\351\321\304\352\320\231\201Fw\243\317\365\313\207\212\252"
+	.ascii	"H\326\226\333+)\031\356\375\n\342r\343\302\364iqX\034\027\215"
+	.ascii	"]\215\264.-C\326\274\230XYY\033b\224\250\034\0171\263\035nmh"
+	.ascii	"\215Yo\237V\207\226\362\261[\243\\y\200PQ\241!S\3760\241\244"
+	.ascii	"\244\351\363<4\354\224\235\262G\236\342\305\223E\371\305\r\016"
+	.ascii	"\372\333\2503\323F\265\230\020\262\356\016&~\270B\341s\246M\234"
+	.ascii	"\2161PPf\354\224<)6t1\312,\322\"\355\f3o5\322"
+	.string	"\272v\306n\370\240\306\312\270\235\201\022!\263&\244O\033\243\315\370\f\254\207*;^\2505Z\243=\242WJ\223\032is\275:\034Sq\177s{\344\255%ABE\013\225#\247\357\320\013\264\245\006\213H\007\215\0166I\350\336w='H\2229\2619v>Sb\330@\266\351\266,F\272\324\361\025\0366\345\032$R\274-8jv\250\340\034N\317\361\255\272\367H\215\264\256\240\035gMe\234\367\234][\307\265\265\\\357^^\263\250\252\356U\025\321\337n\336r?T\336\226\274qs\3536\250\361^&\373\n_J\241$\004\022\325bQ\232\344\024D\022\002\213\210E\247\"\001\202A'\241p(\324Q\217z5\f\211K\352P\250\343\342\227\006O5-2\245L\275\017N\030a\350K)FPA\004\026Ej\252D\374\251&f@\032\006\215R\342\320(\250\2302\375J(&\211\220\224\252\304aS\223S\261"
+	.string	"\030MC#\0230~D\"\007\013\250_J\241\324T\244\3244\204$t\352\021\272h^\361\310G=\022*5\361\204JM6\275\001X<\213\305\224\230\224\364\323\201\3214D:\211j\223MJ\205J\300\340O')-:\235HiQ\347\304#\245\246\024?0\210j\021\250\224\246p\224@\323\217\204\025\"\fU\243\025\034\360pR*\004\266`\032\032%\375\f \016\325!\tI?\022,<`\341\001\023\213"
+	.string	"T\240P\204\244\337\320R1%\272HS0Z\301\001\013j\252\004@\004)T\342\257)E\322/Ma\200\241\bRT\240\302\027lbJ\325#\365h\304\221\360\0035-\246)(5\2318\022\220\230\nS%\364\023T"
+	.string	"A\005\026\330\240s\013.\210\340\202\bz\267\340\002\237\357\202\n|\350+\360YU=R!AqDz\224$\202Pz\244\022S`\260\t\250\006\235\230\0020Z\301\001\013\022i\360\207T\334\t\376^\274"
+	.string	"&\025S\342\227R\024\217\224\200.\204C\033~B \023"
+	.string	"5\b\240\n\323bJlR\207B\002\220^\004\177\322#"
+	.string	"\322\243"
+	.string	"R$\242\323\220\205*L\211D'$"
+	.string	"`\250@\244_\323\257E\220\372\353\200\205\264\350\364ST\211i\220\003\243\264\350\024\2000E\"\246'419\025\205C\244\022E`\261\bc\t(\030L\221\202A'\027C\252\320ih\024\f\246F0\210\251\252\376:H\221\210C\027#^\374$\r\201\304\364\004\027M#\250\277\026\300\037%!PH\374\265 \200zd\201N\360\207\004T\201D#\342\360\003\341\020\250\376\210N+\324_\213\027\003\250G@_\n\016\207\035\034\361\\\270\030\252NF,\3240\f\n\025\217\200P'\036\365\007\250_JQ$\03421\r\221\f\370\260)%\026\251\303!\261\250G\005\214.\036%\375\234h"
+	.string	"\266"
+	.string	"\212\240E\373Z\264\212\026\355\373\265\212_\373lh\0256\264\017F\367\212G\251\372SY\030\255\340\200\230\252)\t\002|\020\244\036U\340S\205@'\364>\237\221\211\025J"
+	.string	"\001EJQT$\016\213\302\264X$\004\376\230\212\220\210\305\242\024%\222Rb\252\006\201.\204+\244J?58|!\202\370[B:k\264\034\232!\344@\231b5C\330yY\"e\335\304\326dx\235Q-&\231\345\346\212\206\035P\023\354\316\207\023\252\331./\306W\034\333\231<"
+	.string	"\2066WKfX+k|\260*#\243\313\234F\271c[\fd\017\03211d}\376D\376\347S\337\340\325\307\n\232\224!}\362x\250\307[|?\217g\0208T@\234\306\363\356"
+	.ascii	"\"\204F\237?\357r\307J\017D\340\372l)\276\333;\f\212\004a\322"
+	.ascii	"\347\333m\2337kg\317\370\\c\330\245\322\271\362%\356j\356&\257"
+	.ascii	"\210z\240DA\0313wkw[\247\202\202\277u-9s\354\323\322\335\312"
+	.ascii	"\271B\313\0027\204\225\363\357\360\004!d)D\035z\b\302pXY\365"
+	.ascii	"i\343\374\355I\336\244\332\364i\341\234\213\317\025\2329\036"
+	.ascii	"\354\233\264-2O}\3328\353\206\231\017c\345\016\224e\006Y\230"
+	.ascii	"7\350s\340\207\351Y6\267p\377\316N\226\202\336\250b\3318I\322"
+	.ascii	"\030C\306\324\214\bI\222$\035R\n\020\204\203a\034\350\255\036"
+	.ascii	"\022\300\0049N:\306\020\232\221\021\221$\005\005\205,\233\001"
+	.ascii	"\324\304\256\321)\202o\225\277$v\f\206\275\007\001\351\232\221"
+	.ascii	"]\277\327\213\355n\002oN/\220`)\r1\2401Z\240\352\230\217s\\\222"
+	.ascii	"\305\353\272-\037\355\256\231\035;G\340\200\362W\370\303e\b!"
+	.ascii	"\"\360\324L\243\236\030a\2745\317\3042\324_\334\205\250\353\017"
+	.ascii	"CHkg\330\017\033\361\0058\305\370y\036\334+HYv%Z\034\310\300"
+	.ascii	"A\027\344\371\312\214F\021\005\203n\312\35612\260\377\230\020"
+	.ascii	"SGJ\224\243\035\363`c6\264A\245\2650\323\033~\233\245\253>\260"
+	.ascii	"k\335at\037\3101\013\013\246\352\244\356\261\220f\252\326.\220"
+	.ascii	"\202(\002\232a\\\367Y\313%\324\"M\375\214\335\207\220\360\333"
+	.ascii	"`D\271\362\372\201\343\022j\364\315\364\322\263\237'\321#$\034"
+	.ascii	"\367\373\223q\201\003\344\216\013@\357\3248\237? b\202V\035\304"
+	.ascii	"\261\016Yv\342HBz\026\215pDw\304FM\007\201\312\363\373\225\241"
+	.ascii	"\211\224\243C\315t\237\246\275.V\200K\3307\005\256au\037\356"
+	.ascii	"\231\325\306H\232]j\005/\f\006\337w*;\361\\g\027\320\233\211"
+	.ascii	"\t\020dG\017\237 \371\347\274d\177\265\330\372\350\372\317PY"
+	.ascii	"\306.\202\b\211\371\320_\027\354\217;\217r\245BR\206\253"
+	.string	"\274zI\034\225HY\342\272\307O\001\315\t\354\203\026{G\364\234\274\240\303\t\306b\372\241\002\304\365\032\334\353"
+	.string	"\246Z\007\376B\370\202B[v\244\243\317\213\240\367f\300\340\226\347A\330\325o@\t\337Dn\030\360J#G\232\351E\201a\017\365LGv3a\374g/<^Ew\317:eO\243\020\013P\234&\314\261\226NL\221\"\350\332G\220Xi9\321\316\235\001\332\3524\253\302\003\t\336\r^\n\262\221\335nn\310\300\300\204>z2\314\266\020\340\340\261H\245\257\301\377\305\231-\314\355\t)\265\216\333\263\373\376\007\027\311\323\205\357\376\237\004\242\034\215\347\035\272\222L\254\226\032\\\272\272\374\216\356\357\263\342\026\033\004\221\202T\001vU\325P\260\003\341s\006\345\2206\347]\002\370s4\241J\363\301\203\374<\244\330\300\321[\005*X\273\355\030a4\350e\357V\355\0359)\201C\272\204\311\276\314x2\037\222\nJM\033s\307\261\201\025\244\331\321\326\033\205h"
+	.string	"\2661}\206\206\007\027A/\360\3321\344\nv\030bg\254\016\243\205\255;\003<\247\016\201G\bv\326\177\364\315\264\320\317\350@\0346\037\367\006\360\343)&\rL~3F\220\321\342f*C^u\344\021\243eA\354%$w\232I\316\223\023\215\334\306I\223W\017Y+\241\376D\352\237N\037\300\317\331\235Z\365\242\231_0^<9\bBCCx\331\264\237\035C\310v\266\3500ra\031\260c\261h\345W\020+\034\034Z4\274\302\252\304\271\312\336\314K\366\200\013!\247p\320\232\206\200\035\274\233\222\254"
+	.string	"\f"
+	.string	"'\270\030\305\265E\207X\177\214\255\235x!\262n\240\332\326r\202I\213c\277B1e\033!\352\331\302/\207\276\245\001!\323\252\220\035)\345\330\347\357\327\006\254\006\200\"\205@@\313`\fi\202\031|\337\013\341\224\236\212\264(\226\252\252\227S\320u`\f\363\377q`\200h\336\335\373\317\251\013&\323\273t\261\301\351\375\207Wc\262\334\004\037\325NA\357\373\210\240|\300\347?H`\262\376A\262{\016j\227\n\247A8\225\334w\216\350O\327'i\222OK\213\322\3601\270:4d[!\245u\351\206u\363\224\252\322\026\b\321\262\006\300\036\366u|IU\336_\355\320\245BLO H\177\314\026\032b`\324%"
+	.string	"\005\263(w\353N\026Z\230*\345.`\227y\222\007\3325\335\357\355I\227\354\237\f\271=?\313v\335\b\211\255&\370F\315\222\211\363Aq\301\336\346\327\310\370\303p\256\021{\266iU\377\315/\237\316\271]F \313\020\022i\345B\001\274\322\321p\232c\245\2421\331U`\211+\300\360C\347\371\342R{C\364I[\334\224\205\316\225\277\204V\036$\244\275^\024Ws\253\247\031\2312\2179\344}\273\361\225!\242\016t\301L\377\315!1<\n\200\007BsAT\020\300F\374\307\240\032\256\330b\003\353\204\334\350\323\252u\007\005\231\306\203\355\325\260\205\360+K\260\350\254\320\345~\375\237\006z\376P\224\310\036\035s\005\200\375DG\353\331\365\327\0210\243L\312\007>\3470xxYJ\201?\301\330\253\323"
+	.string	"\305\036n\313\343\035\300\310g\246\306\256\254\274n\374\025E\263o\001\311\307o0\300\3139;\316\003\027\346\2562\245\211s\241\334\006\036:\003\242h\211\263\210\230\003\310\274\"t@\352e\305\316\337G\222<bJ&p\013\263\003\353<\217\233\302\336@\322\036\251\325\332\375\321\0171\006\033\024C`y4\025\200\361H\366\253L\303"
+	.string	"\235\207\343pB"
+	.string	"\027\330}\201\343\347\221|PI\320i8\205|\352\bX4\370\260z\003\350N\3635\314\271\227\217\304u\202\352<\377\027\345\323\006\376\217\335Wf\023\\~\274\223\243\315\017i\263Zx\224\261\307\227\373\315\273\230\373\313\363\220\271\027<(X0\340\362jp\215\023\322\356\332\245\273"
+	.ascii	"\350\341\331\307.\f|\334\016,2\016\354\017Y\377\374\300\202\267"
+	.ascii	"A\343\234G\366\022A\271\230W\311{Z\270\255\217\360a}\346pa?\362"
+	.ascii	"\035v\221\036\314U\334:\352\307\351\300\261\323W\336\266\221"
+	.ascii	"\370k\033l\350G\201\354\203\204G\016\347\346\374\244\025"
+	.text
+	.section	.gnu.lto_.symtab.2b9c37dd2c207356,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2b9c37dd2c207356,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2791 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`j\003\025\024"
+	.string	"\264\034^\004"
+	.string	"Q"
+	.string	"\226\234\261\244\006\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\256\234\262\364\013"
+	.string	"\003\240\342\234\212\n\004\005\342\246\207\300\013\022\002\001\001\002\001\006\352\263\360\321\b\007\t\310\373\201\350\r\002\n\305\374\200\211\r"
+	.string	"\013\223\273\300\245\013\002\002\003\002\003\f\234\362\341N"
+	.string	"\r\016\251\306\315\231\b"
+	.string	"\017\304\207\321\361\006\f\002\004\004\002\004\020\021\022\023\024\025\337\332\311\206\001\026\301\325\215\205\016"
+	.string	"\027\274\205\242\255\006"
+	.string	"\030\225\221\315\200\006"
+	.string	"\031\210\377\206\247\006"
+	.string	"\032\271\303\275\241\r\n\002\005\002\006\006\002\006\033\034\230\336\335\312\001\035\272\302\257\305\007@\002\007\002\b\002\007\002\007\b\002\t\002\t\n\002\n\036\037\"#\315\343\301\244\013$%\247\333\250\364\n&'(\263\330\307\313)\261\213\233\205\b\n\004\002\004*+,\264\251\257\307\f-./\367\267\311\301\004"
+	.string	"01\222\321\201\352\t\b\006\002\0062\355\313\374\334\016*\013\002\0133\275\264\355\300\f\b\002\f\002\r"
+	.string	"\002"
+	.string	"5\211\307\340\277\f\0026\314\345\244\232\005"
+	.string	"7\362\357\204\233\017"
+	.string	"8\202\220\306\317\004\0209\201\226\204\312\r\006\002\016\002\016\002"
+	.string	"\002\017:;<=\333\217\352\217\004\017>?\313\322\375\213\007"
+	.string	"@\236\376\250\313\b"
+	.string	"A\350\300\306\254\005B\222\252\354\340\007"
+	.string	"C\202\321\322\374\007\004\016\002\020DE\360\251\206\306\017F\243\205\305\376\016\020\002\021\002\022G\310\342\324\f\002HI\317\253\250\341\002"
+	.string	"J\351\361\317\236\016\004K\246\240\370\222\002\004\002\f\002\fLM\227\227\247\303\t\bN\373\312\320\373\001"
+	.string	"O\265\300\331\214\001"
+	.string	"P\324\226\242\363\f"
+	.string	"Q\202\275\352\302\f"
+	.string	"RST\240\342\234\212\n"
+	.string	"V\250\0015c\224and\024D%\205\034p\002Rd6\017\022`$#\003\235`LE\025C\263-\32631E\342\356\203\343"
+	.ascii	"\035-(\333q\036/\006B\267\031]\257\253\212\023\330n\317\236\357"
+	.ascii	"\311#\177\f\023Mh\\0[\027\275.`\311Jf\264\r\216E\\%\303\262\324"
+	.ascii	"\232t\033\314\016B\346\226!\222\034t\001\242\266\260\245\025"
+	.ascii	"\227\347\356\214q@\241Z[\311\215\022\237so\366\326x\364(\234"
+	.ascii	"\252c\250\3555\305fr\207\332\330Z&\024\344\366\304\037F\315\223"
+	.ascii	"|\342\257\365\027+ j\003X\344\236Y\017e\024\246\243\320\330r"
+	.ascii	"\263&\004\037\2400\210P\201\346\027"
+	.text
+	.section	.gnu.lto_.ipa_sra.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`t\001\365\007"
+	.string	"\242\t\035\037\360n\2451\314\3003\251\340AQb\003\255\325\216V\336\357f\214\250\277\235QVm\"eJ\001R\354\204\355-\341E\354\020\373\260\30350\270\240`\t'\302y\260\006g\301\023,\224x\0037\351\024\265\214bS.\233\230\th"
+	.ascii	"\300~i\322\310EU\b\244\347\307cg\342l\366\324d\3541{\261T\"\020"
+	.ascii	"\363|\254{;\376n0|\331\336R\267\322*\002E\250\001a\314\246\251"
+	.ascii	"\326\030\003\200\0021F\325\003\020H\206\304j2\215\001\364\n\271"
+	.ascii	"\355\312\265\227|\214?(z\005\304{^6\347)/\233\021\334H\256\265"
+	.ascii	"\367\275\200\0205\244\025\221ZU\004\"Q\037\036\241T=5 \256\262"
+	.ascii	"\225\202\377,\2674!$\352\241\034_\005l\026R\350f\004\221\013"
+	.ascii	"5VZ\235|\026X\306\bg\370\310h\223\200\031b\206\273\215\323&$"
+	.ascii	"\240\205H\207@\336\":\f#\260+\206\363\305\252R,Q"
+	.text
+	.section	.gnu.lto_.inline.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\325\013\025!"
+	.string	"Fd\200J\260TN\032\003D\353\241\025\216\350M\363E\223"
+	.string	"\201\363?\346\266\264\341\205\253\277b,\034\237\022@hW1\210\352\302\235\322\037\037\252\247*\376Y\277\205 \t8\266\356\244\r\034\223\022g\351\251\367\231hk\333Ib2\310\226;\005]"
+	.string	"p"
+	.string	"n"
+	.string	"\223%N\374\344g\331\371\034o\026\267e\255\325d\223\311r\227\225L\226?\013'K\262\234\224,7\027>\316\2265H\025\240\263T_E\230~\272\344\351\037\003E\324Zs\217C\253j\255"
+	.string	"\3369\316q\376\374Ov_\333\326Zk\3708\232\264\343\r\t\367\347\316\366v<!\263\257\031\346\024\276!)Y\213\211\255\235\016\205\206\240\346\003\006\236QkU\271"
+	.ascii	"\315\357,\374\223-\021\276\316^\345\270q4\362\354\326OOM"
+	.string	"\231\300\374\266K\276.!\225\317Y\032B_^\323H\207\352rMH\356\242\005\220\211\252\265\262\320b\3461\373\024\267B\203y\2515\033\335\345\242Zk\311-,;\237\340\337\250\325\n\243'\032\021\226\327\013\230g\313^\t\026CX\234>\341\347\254\217\313J\227R\333\351\262s\3563g\177pY\351`?\250\231\231yi\264\027&[\024_p\360\005\261\3636\376mG\330\252\354\234\273\r}e\347\004[v0w\250\217\227u\005\273\001\203\311\262h\301\362P\242\035\357'cC\253G\244\266\002\024q\006\005\355\320(\030,\250>\204\330\035S'|\373\266(A\f\034(L\022{\370\016\223e\212\032G\277\330\034&K\033\225\261\304\344C\314Q\024F\224\216\300&\347\263\207\244\002\007,\013\013\251E\355\r\377\317\033\372\325#\351\267#\244\274\272\006\354MN1\200>\262\006\033\345i\371\270\020\367!\036=$bg\300"
+	.string	"\212/;'\275\255\322\205q\322,\220\236\216\237\314\026*\324p\266R\230 \301\006n\023\341\257Q?PS\343^\365\0035%\006\200\365\250\341\271\251\031!i2\355\006P\002!SDG\017\022\34021E\303$3\006)D\242\tD$\020\t&\020\t\242\260\031\326<\037\317a\204\244'\205k\206\032w\274\001\223D`\226\3229\351\271,J\330YF~\346\212.xk\033G\337\322\200$\032\212YI\324Z+6\035\376v\224A\334\370\324\344DD\227\007\2068\347\350\206\206\267N\034\213l\326V\310\322\023\344>,@\277f(O\013\274\222\332\375_i\022\243+\037\327[\024\362/\312\350\305O\324\"\374\224\255l\227t<\335\024"
+	.string	"AI\271\374\023\005\241\f\245\026\226\377\002\260I uocL\310\022\204\016\265\265\001j3"
+	.string	"\274\002A\214\367}\301\0223\360J\300q\275,?)\216u{l\252P\304\363\245\373m'I\037cE\032\244\377YL\224HH\305\272\305\201\240\023\342\201\362S\375u\236\373h\b]\347Vc\334\226l3\202%\207\033\247&\277\nP\213_\323\330&r\215\264\031aa\\\215\222\370\n\314\250fCK,\260S\315\255\226\264\203\274\262\334\006\360Jz\035j\244\030fq\3512\3311&\306Z\314\317\023K\201\233\356EP\0251Y\200\220\235 6\234rL\303\371\304H\374\022\304\024t\023\267\220M\275E$"
+	.string	"dlX>Z\207y\005;\323N3E\253\332\250\315\343:"
+	.string	"\305x\24259 \200\324Y\240b\277\fr(3-\325\231\231\006v\267\347\005K\367\331(\331\265o\265\327M4$\204u\203\001J\355z\326\241\377\205\364\023\233\202O\223\372\215Eh\355\311}lT\036Wa~\273\347G\237?\037\"\265\247H"
+	.string	"\362\225\365.7\314@\n\350\361\252W\237\257-\006\305r\020\325\273\354\333\2164\310\033nM\231.\263\020X\311\357\244b\240e+!wXp\021\033\312H\177\343\003\362\007\004I"
+	.string	"Y\221I\364\215s\007\261\031nJ0\216\274y'\300\032LQ\363o\026y!E;~4\274\220D\350\207\371\252"
+	.ascii	"\310"
+	.text
+	.section	.gnu.lto_.jmpfuncs.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`&\025=:"
+	.string	":L`\020E\200jm\016\362\342-D\363\313GvM\274\f\3560\367\366Kzb\233I\\\301p&\260d1\205\321\b\232\250\305\365\253\252sw\357\303g\202\357\377]y\206W\334\020\213\376\243\"\003^ [\264K\254\3352\245\024\344"
+	.string	"\356"
+	.string	"\373"
+	.string	"Zdf\242\232I=r\327w\342e\\\367H\300\377\272\335\203\034\213\0238z\373\335\002:\250\327\353\365\324\257]\375\036z\367V\225\334\365\201\204\026\034zU\366j\220\373\007\350\313\273<W\247\364z\262W\255{\f\002\004?"
+	.string	"\376\222\377\222\273z\235\320\336n"
+	.string	"L\356\352_T\347\342\337\344\256n$\264N\344\311]c\204\026\214rW\024\241\365.\376\\R\356\352 \344\361x\274vW\247\200\317\305s\360\366\376{\223\001\275\317\200\337\240\225\273\032\205VU\257\334\325@h\277nX\013\ty\177\201\257k\360\326\255\270W\361\367va\364\026\354\376\006\003\347\t\021\017\275\236\237\033c\234\327\375\361x5\036\374w\253\376\004\272?\201\357\255\376\207\245\375\303\342HN%\252\231\244\356\352\241\303\354'\370n\367Vj{\247\333\300Q\356z\\\304\333<\356\324'\252\231\272\372\334\025\026\344\317]a7B\373]\275\273\302\274B\253z\335\365s\023\332O\227\344\257\272\2536\272\232\336\346"
+	.ascii	"\237\303\333\213\347\363\362\237\223\320~ \350*\017\260\004\306"
+	.ascii	"\237\217&!\025\205y\230\327PDOE\257\0229u\207\350\006\321\375"
+	.ascii	"\241\333\203\206&\242W\021\274\312\364\335AC\203\257zpw\313\324"
+	.ascii	".\307\377;\303\017a\2700\347\307]-\237\n@q\200\3428\025\370\317"
+	.ascii	"\245\002\271\253\225\023Z\253%\264\037\205\241\245\356V\352\356"
+	.ascii	"\244\356\236 \241\333\215\033\247\322\241\343\302\333k"
+	.string	"\341\355\267\261Mhk\334\325x\257\347E`\027\317\313\213\300w\325\325\333\267\273\302\333\277\337\326\235\301\002$\377\257;\001\227\220\273\332\033\241\375\226\276\277H\375\206\334\365\355\204\366Kz\177w\242n\004h\322\204\016\033\372*r\327\017iFs\212\253\\N\321\031\250UP\307\270\230\224t\264\253\3614W\344\304S\313<oF\035\033\363\016\247f\211Q\022\333h\035CixCN\311S\306\254c\021\372H\206\355X*\346\023kB\307\314\024\217\031G\212Y\020:\226\204G\034\r7\341L\203D1R\210\322B<\346Q4q\370j\013\313\304\225*Z\214\240\002a\203\262\252\365\321i\273$_\324r\346\251\3139@\317fc\231\361(\346\023F\225\016+\025j2w\005b\023\332\257B\001$&\264Ou\373\200\222\204\366\033z\227\275\032\300\375\247\270\276\356\n\264\206\366;\261\305\277\233\013\232\273\202t\332\304\355\355\367"
+	.ascii	"\277Z\367:\374\373\035k\356\nfi\003\376\3679\300#&l\217\003\354"
+	.ascii	"\321GI\222\310\271+\350\025Z\2439w\205\275\t\355\327EI\027%]"
+	.ascii	"u\300o\325\357\334\025\026&\264_\024\324\037=w\205A\361=\001"
+	.ascii	"=\226d\210\334\356L\267\262\016\035\320\371\334i\221Y\245\351"
+	.ascii	"T\222\267\364\024w\005fY\253\024O\234e\342tgf-\361\226Q\361|"
+	.ascii	"z\320\261\030\"Z$\224Sq\324\025\351L\323V\222b\016+]\252)\325"
+	.ascii	"\224j\031(,\305\266J\022\267\233*e\334pJ\226\244\202Z\255v\346"
+	.ascii	"\030gF\361M\204\n\234\236b\212\"\320\215;\"\006\315\002\204\355"
+	.ascii	"\366\224\242\305T\n\026Q-lURT\005\372\374\216\2414\\f\335\324"
+	.ascii	"\202\236\235\346yf|\346\255\323\\\341\244 g\236YX\3261\233M\305"
+	.ascii	"\t\3344\303#\024\231r=\311\032)\013G\023\352\030\232q\272\234"
+	.ascii	"\210\342\035\r#\345\322\03416\317\031ZW3D\234.\237V\021\306\235"
+	.ascii	"\020\336p\232Y\030\006*\342\262\260\210'\033\206B\352\330"
+	.string	"H\303\263\331\354*\217\246\211|\356\254d]\253\325R\262\224\272:s\216L\255\202zv\246\246\031\302\254R\320\263\201_\250\3418\250\220\232\031\021\221$I2\254\001\221\004\2048\t\245\203\353\001\022\240\301X\220cI\216\342\2242\310 F\244FFD\024\024\244\245\031\016\311\017M\370\001X%\321Q\266nF=\374\004\225\024@c\034\356\261UBB\370\331\220\226\201u\365+\2339\376\177\007@\036\231A\262\254@\246\351#Sn \032\376\357L\210\266\031p`LS\257^A\3622eQ\b\004\251{Ej\347\301<\306\370\177\247g\007\267\301\326\004\037\376_!\235\370H#\247\322\371Ne.\016\273\026\232)-\245U\220\023\025\313\232k\023\266NG\244X\330\001\"\2265\027p^\223\\\303%\223\025^\3431\355\021\251\365\334\005\227s\332 \331-D\026\247\325\320k\257A\030\002\310\267AlU\327K*\325:"
+	.string	"\272\252\365{\027\301\210b+x<\031u\ns<\360\371\304\324Nf\302\201\3061\374\331E;F\016B\037\334PI\321\272\210\240\332e\372\2025\213\322\031\0211\263\301(z>\302\274es\304\324\342/\n\013\220\364\nr\206\001\206v\033\325\321\3573=\306^@A\022@\226\346t\007\215\215\240\375\202\372\230)ug\376N\375\340|k|v\304\022R\005\216\300\f\267\260\356\025\240\337\2408QE\t\234XI\274\026B!"
+	.ascii	"\016\327\253\334\231\340h\006\342h\333\313\342\322]\324\305$"
+	.ascii	"-\252x\0012\360\375s\363\264P\343\317\271L\275"
+	.string	";\036ZD\306\327A:N<\007{\331\252\037\251\3403\323R\001\003N\246\240\246\023\360\325\346H\034\022b\3068\325H\275\232j\360\234\245\005\275\020B!\366\020\211\217\262\330\266\221\004\235\035\254\336\372\322\327\251\245@\"\251=U\266\344\264)\305a\nd\271J\b>\313I\355O\016\261\350\300\325 Zos0\253\3378\347:<\254&p<<\374\310\343\347N\231\353-\310\215\255\237(?a\374n\313\265\336\214\331\023\300\207\323\323\206\017\370%\210H\236i\235Y\343\266\0259\374I\311\262U\305N\210\323\005\002&\355\264i\323L\332\334i\273\367\371\331\225\337s>1\232@\215\322\271\261\264q\331\007\272%\373\313\314K\0206vO\356\027\024\024\255\354\327\341\245\3718\263\3579*:\327s\356s\326\334F\230\rb\320\347\306$W\317[!\260?E\206\225\266\324p\276C\013[\263Q\252e\033\201\320\237A!\303"
+	.ascii	"\335\231\227\021J\021\2638\332\367G\316\211\345a\241\333\013"
+	.ascii	"\244\356z\f\177\262),'m\030g\b\231A\246\224\nW\232\206\216\351"
+	.ascii	"\242\346-\365\245\270\244\0064\204\223\364@\376\362\232\\\214"
+	.ascii	"\222\211\354\253\272\366\364\271\323\016\261,.\tB\321\366\371"
+	.ascii	"\006\303Z\245\035U\313[\320\035\343\323\3451\2246\207\033\325"
+	.ascii	"\025\212N\023\312Cm(\216J\235\250Mn\220I<\207\016\334\030\361"
+	.ascii	"!\177\2447\331Y\361\331\fV\220{\316-\275\225\261xSc8i\017,\223"
+	.ascii	"\0038s\232\245\305\007\356{V6U\344\\\001@\265\377\264\273\226"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.pureconst.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \225\r\004"
+	.string	"RI\037'@ge8a\035\303\316\021U-n-\232\242(\212r`f\034\355\217\"\310\260\325V\220\322|J9\271\340\216D\261\003l\001K\300\016\260\002l"
+	.string	"\013pW;\325M]\324=]\323\256\264\001\351\216v\242\033\272\240\263\317\317s;\227\303\267\341\323\234\220\271\326\305\334\313\265\334\n\037elr%7\302B\210\360\3309\330\006/\006\257\305U\334\0043\304=\\\0031\336\002_\263Zk\007\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`4\0035\r"
+	.string	"\226\02045P\247h90333\223K!\264333\215\354\314D\215\335Y\323\246\263|\3021\306\201Bg\353\314\365G\264_\273\337\343\360\320\2218\215E\3767Bv\222)%"
+	.string	"\""
+	.string	"'"
+	.string	"\016\364\004\275\203\r2d\336B\305Aj\001\203\006\017\246`\202\272\353y\355>\317\317[\236\347\251\317\f/Z\241\b\317\321N\364\024mA\211\3229\021<\017\354B\317\320\027\325\332\204\204Z;\314k\340E\270f!2\017\001W!j-\006\263(\267\265:\035\204T\005\362\207\036\353H\260Y+\034\353.740\276\260\250\250t\226#=I\273Qn8\247\313b\001\002r\034 @=\200"
+	.string	"\226\342(\232\247\202w\3421\361\364\334%J2b\022Q\323\256\364,]\031h\250QQ\250LZ\220l\354\031P\202A\312\252x\021@\035cT\226$)\264\377\006\216\\\335Me\212\341-\332\021\"\317\030\330\205x\373D\036\360\023\023%\316Bt\247\354\374\374\230\027\371\265\245\nv\fx\364\230S\216\334P\207\210\231VJU1\347\037"
+	.ascii	"\023\377\231V\330\335\216B\0245\003~\2219\t\302`\3065\275\300"
+	.ascii	"^\031\221*\030\225#r\347\200\007\231\307\331M;9\315\3162j@N\024"
+	.ascii	"\030K\304m\312\244\225\2632qQ\223\350\207\301\353W;\004\325\203"
+	.ascii	"\037\237\333\374Q\035\235I\276\022t\262\202\016\254\\\362\360"
+	.ascii	"\320#\276P\2500\325f1AQE\007 (\232\232T\"\371\223\3537\r\234"
+	.ascii	"\207\035%\272H.+\304L\304b'\362\321o2\345]4"
+	.text
+	.section	.gnu.lto_.lto.66cc2d38379d943c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.82.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"-\007"
+	.string	"BN23`M\323\001H\001\220$\243\005\263\332\036,\007!P\007C\004hEZ\372m{\034\3407\364|\327\226E`\033\017!;\260\235\305\350f\201\006i{K\231R\316L\007\t\006\b\320\322(T\030\0136,`\030`\246\332\300I2\345\240\251\240EQ\025\274l{\267\352Q\2258*\341(\037\362\221\013`\227\363\350o\027\331\370\034\177~\270\362\361\317\277\240?\033\"\"\037U\245\t\315\354-K\315\260\357V=\366\323\352\006.\236\302\262[\321\262\262(\257\344c\033\263/\276\307?0\333\304m\033\3321:\024$*\273\013\245\013@\177\356\001\320\237j\034{b\376A\356::'Q\313\236Q\301\356:\243fq\353m\023\330\236l\177\002\t"
+	.ascii	"{\311'cz\366\206}\017\026\272\206\357F\f-D&\356\212\251\235d"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.83.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\225\007"
+	.string	"2\31636Po\322\001 [\236(O\211\t`\264\"\021\362Z\202\215d\252\226\226^\206Y\202\030\211\037\004bH\031\255w\265\001\3245c\372\301\3645\f\032<\006\355&eJ\001\356P\b\n\007\t\020\363,X\034\f:0p\032`\307\272 E\340\352\301cA\254\252,\250\341\366\230\325\220\001J\367\321\ngR\340N\231>\372\3105\260\"rR\005q]\323\337G\347\262\200\335\317\243\017\362\220\b\277\343\317\022Y>\376\371\331\364gOP\344\243\223\344\244\263\320\315\346\266T\r\373\230\325\220\255\033\216\253\224v1^\\\266{&\036\266\257\261f\263\234\023\355I\242\213R\313\356B\335\270\366\324\374\177<\023A\333\023\240`w\235\021\224q\353molS\266K\002\f"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225\241k8Y\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateState.84.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`4\020%O"
+	.string	"\232\212\034\036Q0T\312I\007Cq\357\2402v'\0365\036T\271\204,\374"
+	.ascii	"\323\356Tr\332\323\237mRF\244\244\007\347\017\246\333\347\377"
+	.ascii	"c\002 \230\240\340\354\260\003\tq\302\275\351\341@\355*\243\027"
+	.ascii	"0\214o\235\304J\234\265\224\237\277R\343\344Ek\226H\223R\246"
+	.ascii	"\270\001\235\001\351\001&\237\004\345\023Q\276\217\362\207L\276"
+	.ascii	"\020\345\007Q>\020\345\233&\377\307\344S\312\367\241\374\036"
+	.ascii	"\345\363(\177G\371%\345\223\224\257\243\374\376\3413\345o\224"
+	.ascii	"\217\316\030\033\017W\2704\233\261F9\032Q\335\220i,,\234\335"
+	.ascii	"7\273l\273\306]3\273d\353\303=\346q\357\337o\020\313\366m;\005"
+	.ascii	"\342\334\265}\363\205\263qN\333\234l\316\016V\210\033\225\020"
+	.ascii	"G\f[\263\237\356\332\027\b7\337\201g\265\305+\3632\367Vk]\342"
+	.ascii	"u\360e\263mN\325\220\216\260\204*\226\027=_\200"
+	.string	"\364\260>t\260? \035a\031+\327\217:k\214\025\360\226<\322-Q\311\303\252\221Z\263\233F\020\251H\375:`I\013\002#RA\253s\303\0324\353\346\2654l\r?\275\007kv#\2557\304\260%\177\017~\272$o\313\354\330\226\235\316\260g\316%s\"%\310\227q\213\007o\311\255BKT\232\371`kp\253\007\005H\346\255Vc\003F*]\3652V/?\250\254\t\203\261\344i\360\226\377\r[\261s\213 \354P\255X\320\240\325j\224\361\037o\311\033\267D\271$o\211\312%\177\376t\326\250\245\356\030\027\341\231<\265\326_\253\260\347R\237\036oW\222\272\346\363\353\303e\265\324\247lWX\351\372\332\336\356\001+]',o\205\225.\257\335y\305\021r\271Al\235\240;\252\265R\256 \223\272\026\302\271\025\200\270\262t(\362X\245-\230-\024X7\203\2121L\316J\027\n\333:\032Yy\250"
+	.ascii	"qa\351~\364\b\337l\3312\024. \363\356\201Z\353y\310\325\265\377"
+	.ascii	"\331\377d\376\327?\310-k\326\210\223\f\257\326+=\273\347\024"
+	.ascii	"\363s\314I\206wx\222)\325\234b\247\fj\366G\230-\271\267`[\035"
+	.ascii	"G\343!\213X\033\343E\3667n\355<\r\324\321x\207G+\227\3543C\270"
+	.ascii	"C\260pT\274Z\261j|\213\250\312\023A\027\020\312%\311\336\245"
+	.ascii	"i#W\274\342\343\331\320\212`\335Y\256\353m#cm\260X\317\237f\343"
+	.ascii	"\272j\255w\201U\353\025\213n]o\220\b\344\343\271\2737\370\366"
+	.ascii	"u[::\276]\356\264\203w\270\243\\\222\373\305\026/\034\275-\344"
+	.ascii	"\213-\370v\305\307\247\340\337\007\005\274C\034\315]\304|\221"
+	.ascii	"{\003\266\325O\360\232m\231\005\274a\214\375/\300\200w\370-\333"
+	.ascii	"\037b\266\344\336\262\332\3527\002\271\263\374\253\253\215\345"
+	.ascii	"7\371ML>\224\311\1772\371N&\237\211\217\277\304\307\347`\337"
+	.ascii	"\354\225\370\370I||$>\376\006\013g\337\344\343\037\361\361\231"
+	.ascii	"||#$\370K&_\203e\333\027!\342"
+	.string	"\023!\342\017\361\361\205\370\370\031\370\370A|| &\337\207\311\357a\362y\230\374\035&_\002\223\257c\215\373\034[\334\215`\315\354q\370\3707||\006~\370\013P\276\r\312W\200\362kP~\002\224\257D\3714\206\3703\206\370\b\f\361\017\020\342\377(?I\210/\203\362c\b\361aP\276\001B\374\002(\037)\210\377\302\344\2730\371-L>\001&\237\005\345\017@\371+(\377\310\344\013@\371\001P\276\n\312\007\300\344\247\240|\024\224o\004\304?a\362\213L\276\t\223_\"}&\364\002\362\021\201\326\271\t\303\250\366\n\021f\312\324dE\371R\177\007\216\307;9\372\200&\255\250\001\331\312``\200\013\350\337\bg\224\244\376\205\241RzAER+\305h\031`\250\026\207\026\032\210\321\213\203\001\r\203\005\252\245\263\202\032\003z\351\310A\352\002Z\206p.\211\273P\361Y\033\027s9\245\354\035\244&\277J"
+	.string	"#\212%\300\004t\213v\321/\246\234'\250\300Z\226\276\316\024R(\227|\341\243]\360\350\026\0224\001vt\264\004,ZG\257\016\0034\213\025=@\357\354\034\365\n,W\216\260\354h\036\002\364\216\336\264"
+	.string	"Z"
+	.string	"\025\035@\357\354"
+	.string	"\320*\300\250\224\332\252"
+	.ascii	" '\n\030Q,\255G\373H\321=z\321Pt\212!\342\344\334P\345\216\321"
+	.ascii	"X\177\022F\215\242wnA0@*TJU\370K\213Q\233Vu\344\322~\\\242Mt"
+	.ascii	"Q\237\350\377\274rf9\022\362\024\366b:U8\267l)\227<\321=/\247"
+	.ascii	".\372i\023\275C8\250.\221\206\016\220\255\006\270\247\206\"\321"
+	.ascii	"O\2757\0205\t_\023\r\265\217\273\230\004)\274\344\320\034\021"
+	.ascii	"\266I\3770\224\025\352&\275h\202Z\b\250\203\314\006\222\301Q"
+	.ascii	"\264\3149ZmD\261\264\252j\305\244\235\372\034\274\263\307\343"
+	.ascii	"~\207\2226\223\336\032V\027\003\0277c\330\310\342|\232\366\236"
+	.ascii	"\005\333\\\361\021\215\210*C\240\t^\201\325\337\247\327>\275"
+	.ascii	";\023\004\303\353^\263Z0\006?\241\252\241\245V,\033\377\311\205"
+	.ascii	"C8\275,Y\324\306k\263\314\034\271\264\235S\024S$;\313\323\374"
+	.ascii	"g\0269\372\204\226\013clv]v\216\346\035\202_\200q\234\265\353"
+	.ascii	"\244-^\f,\333L\253\013Q\254\275X(\003\204\016\211\205\366?\224"
+	.ascii	"\273\206\353\031\246\250mn\217g\013.\234a\302\224KnO\222$\225"
+	.ascii	"dj\311\351\367\004\345\344\004\305\204\202\251I\352I\267\373"
+	.ascii	" *j\211\251\210\324\023Oj\252\210\023\250\247\322\t\324S\221"
+	.ascii	"&'%SL\226\232\242~\234\224\\\2604\305\244\351\bojI\223>S\322"
+	.ascii	"\004?x\\\360\233jB\022\2654\365{R\262\344\364c\212\222\372%\035"
+	.ascii	"\035\252IS\324o\n\n*\352G\215W\253\253\215\345\017\\5\220\251"
+	.ascii	"\221\026\030QlYJ\031\2631\037'\272Z\2558\260d\273of\370x\035"
+	.ascii	"\274f\254V\265\347\007fS\205\247J\256jO\325\236\262\352\210\252"
+	.ascii	"#\357\360lC\013n"
+	.string	"\260\332\3527\372k\316'j\334n\364.\215mL\361\252\257\303\231\005\244%\007\006zg&\216\\q\001Fc\265!\334\002m\302\206)nl\360\031\234!\234\r6\306\230\240\205(\266\275\316\362\265;\273\245\336\226\265b\3114\254\222\206\262m\333\313R\204\326\216H\2173=B\034\312/R\331\324P~\005\332\354i\254\216\306gC\270\032\235\243\025\350\206\023\364\001\3304\272F\223nO`\230\322&%L\032\032\231R'\320\033\004\263\244\225\272T\013\"i\032\275A,\214\2645 \033\331\033\007\235\244\227(i\016\232<\"I/\ty\352l\320G\032IoSo\320$\034\341\034S\033\351#\255;\003\3443g\326\fL\335\002\270eg\226\221\3368\333\002\017\331\030\236\006\275\324[\2445\350\335\252s\f\202!\322Ez\335\204s\013\244\034\322D\204\364\220\336\251\t\347\232\r\021$\324=\237\224\031\264\220&\355\004c"
+	.string	"\322A:\203\336\266%\267\352\340\t~\001\336\210r\366\266\013\322@\332\b\027\317a,\346d\211\005\026\224K\006\351\"9\305\2537?\205[v>\341\325Zk"
+	.ascii	"i\024\304\304\021\305\212\277S\345k\255\334!\345\214626\004\002"
+	.ascii	"}@\317\350\201(\250a$d\221c\210FDD4I\ni\ra\005\204(\346\2503"
+	.ascii	"\036\021P\261b\f\215\320$)d\332\f\333b\214'\367\337e\312\244"
+	.ascii	"\342*\371U\332\224{\275\313\243\320\270b"
+	.string	"T\323\373\363:\335*\341\220\310^\336\321\002\347\334\005\335C\303x\271\273\377\352jx6\216\036\245\027\323\330\204@\020\357U\211\310\036_~\214\217\312\003i-\267j9\247 \207\344\021\361O\022\310o\366\234\004\032\315\335\211\035\346\214P\001\370)\033\033\261\2364\321\256:\rY\030E\302\003\003"
+	.ascii	"\re\355\024f\206\303\226]{S\206\200k\350\035\335\177\347\224"
+	.ascii	"\\\374\253\237,XM\213+\335\217\262\013\b\232X\020\264\264\242"
+	.ascii	"\340eF~D@\r\"Ij\357Vb[Hr\255=(\211\006\246\223\036\317J\323\302"
+	.ascii	"w\320[\344\03497\347f\347\177\274#\022\2769,z$\206\322\332\361"
+	.ascii	"\326\360\321\366S\275`X\271\363\270\177\300`\320\263L\300\003"
+	.ascii	"\r\237\003zaH\267\337\200\267\200\354\260\317\256\302\370c\016"
+	.ascii	"\330\322\031\002\bq]\224H \335f\nN\033<;Y\213e\360\244\036\234"
+	.ascii	"\304dY\346\201i>\350"
+	.string	"5\206\310\243\036\233\3423/\263\004P\036\363\314\220D\344\213\266\370\2053M\013d\345\350\226\337.z7$A'\201\350\n\356\327\274P^9\316ia\323\f\212/F\342\227\250^\035\207D\200\237P\224\306\270\275\031\021\263\377\371\272\204\322\232\343\3445\232\373\222\002\204\347\323\360\243\261\377\262\177&|\277M\347\315\f\030\013\201Y\227\027@i+\036Kt\261%\342\312\303[W3h\321\024\373W\243\251\245\260-\0374'3\202\325\013\204G%g\341\026\f\007\307\230\366#*Jo\253,f\266\253v\327\224\273\244\036\350\214\246\361t\224\247\307\251\013\374o\"\376&K\036\332(H]\222\211\260\030\332\013\213d#\201\202\202'\"\377J\025\275*@\370yt\212\346&G\2023\341sG\270O\373>+%\263'zo\377\304\235\032d\327\223\315o\362\232M\360v_D\366\214{0\212\034u\212\2314!\305S7\201"
+	.ascii	"\325\346\220&\257\366_>w\360B\340F\"<\264_\361Ut\b1\335a`\204"
+	.ascii	"2\245\310\373\324"
+	.text
+	.section	.gnu.lto_udpThread.85.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\027\002\365\022"
+	.string	"6\342}I\320R\2471R\nw^\363a<|A\245\360O\375\301\310\276W\246h \310l\340C\034\345:V*"
+	.string	"\270\267-\223\326GR\231gX\007'0\022:-\035\304\270\032\336\230\347\311\f\002\177\314NVVd\266\367\226[\312\224\002h"
+	.string	"f"
+	.string	"g"
+	.ascii	"&\213\234\260(\252\246("
+	.string	"\310\275\346h\363\005\300[\361\004\300\333\272\302\240m\275=\004\355'Vz\363\351\020\025TJ%\356\341HY\323;-Q\322P\260\334\271\005\360\243\363\217\344g\347\342\027A(\250\305\247px\276z\036\335p\2259Z\337{\002\030X\275\035J\245\316i(\341\336k\252+sn\221\333Fa\233\202M\031\004\"F\320\353\302Z\313af]\325T\\\245\362q&\325\312\263M\034}\231\020\002r\335\331?\357\220R_\304\202\326M\n&\223\255{o\266\204\\)\333\364\342\347o\337\374\236]\266\371\031\267\237v\022q8\242\021\257\352\352\336\333\340\326\017\304[\330G?d\253\017\270w7T\343^\323\304\243x\373\030\227q\263\255\016\004<3t\313\377w\357\275 \312\024\224\013k\001\364D\267A\276\232\3142\243\327yd)J*\207\200F\317\217\257\362\374\327\244\236\335\223Xw6\267\023\030\326\327\t\240^U\216j9"
+	.ascii	"\265\216\267\200\267\271\241\300\023\235\211T\300C\351K\037\\"
+	.ascii	"H\022\274=\321\221l\342\2753\327\371F?\n\341\373\334:\306F\257"
+	.ascii	"\273\365m\001.)\221\275\314`\262\330\214\346A\005Ff#yy\254\026"
+	.ascii	"\223}f9\271\240R!e\254\315:\320b\265\361\245%\3462\262\320b\306"
+	.ascii	"\023\230I\230\031m\254\221$mt\335\327\335x\020QHYW3\225\306\006"
+	.ascii	"\250\017\225b;8\016\f\206p\233A$\201\262@\303\006\272\004D*W"
+	.ascii	"qAa\345Y\006|\235\320\303w\372\223\214\357c\016++\265\236XY\001"
+	.ascii	"* p\002\031:\353\001{\371\023\264\213,c\242\261\260Q\217\326"
+	.ascii	"\330\260]$\372\262)\035B\236\027n-B\263\202[_Y7\370\256\364\344"
+	.ascii	"b\016\204~\220r\336\300=\346\023A\253P\241uB\215.\035m\304qe"
+	.ascii	"D\024\035\220\355\005\220\254Q\373\334\306pkd\223\001\302\301"
+	.ascii	"\034\261\230\274\276\232\t3^\227!\003"
+	.text
+	.section	.gnu.lto_gyroReplayThread.86.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`&\n\2655"
+	.ascii	"\032_\234\024C`\250Q\007\255\213\314\"\301\246`\261y\001\224"
+	.ascii	"-b\fP#\252n\207\254\253^\325\340\016\254\376\232:\343\304\240"
+	.ascii	"/\357\207\256\344\363\367\253\235dD\362\345\f\036\022\230\007"
+	.ascii	"XM\222\030\2455\262\233\354\275SJ)8\001'\0016\001dm\216]!\330"
+	.ascii	"\033\334jz\214Y\3078Z\214\177\310X\227{\257\016\007\263\256U"
+	.ascii	"\225\231\310\315\3543\035\306:4\335$v\232*\366^\361\320\314r"
+	.ascii	"\2737\371\201m\325w\375\232ag_cr@\363\b\304\355\336\333\304."
+	.ascii	"\273\f\261\301v\260\305$\333l\006q\273w\031\241U\236\300\266"
+	.ascii	"\372K\275\307\360\236.\272\327kM\331\275K\t\fd[m0\035\206\310"
+	.ascii	"\274\247\300\362k\013\327\374q<3\350\336%\220\227m\264\266\312"
+	.ascii	"v\200\265\325\177\302=N\237\330>\242\036o\247\313\265,nU\323"
+	.ascii	"w\"\367k\221C\207ML\253\330\276\243\023\365Z\362K\211\367\214"
+	.ascii	"[\312\346\241\365\016\332\255\305d\253\253u)\0047g #!U\220\235"
+	.ascii	"%\211\304s\351\001e\032\221^Kv\245\r\3464\321s\304\333#&[I\232"
+	.ascii	"M\177q\324\216\275\2264\2222\360R\362\326h}\224%\311\345\270"
+	.ascii	"\266R\366\252\323\272r5}\260\346\263\247eL\233\304t\201\322a"
+	.ascii	"\355YZ=<\035k/\262\207\311&\206\205H\177\207u\222\226&\223ML"
+	.ascii	"\213H;N\303\275\227\035\251\265\325\\\324\314\275\201\231\253"
+	.ascii	"0\267\020\002Y\314\035e\265\261\372s\300c\247\331l\250X\261\342"
+	.ascii	"\333\246\223\007l\214\372Nx\270\366\267\035f\033\226\023b\356"
+	.ascii	"\265\2463\344\236\302,\\x#]\254\255"
+	.string	"\366wu\205Q\212\341\262\362h4\032\005\224\262\317qwz\307\312=\026|\341\215\344\036\353\024q\226\274\271a}\361\303\222x\215\375;a^^ySX\213\003\205\337\2139\347\354\304:k`\23514\261\316\027,0-=`\235\225\220\216v\316?\2363\203\235\363\002\234\263\202\3259\001\353\214\200u6\320:\027h\235\t\260\316\003\032\254\331\210u\026\320:\007h\235\001\260\316Em\246\331\227s&b\235{\2553\257u\336\351\234u\254s.\347\334\266\316l\353\214k\235W\326Ym\235S\326\371q\316\276:\367\206\021I!\3128\025\310\356\025\0225t\325\3246V\232\254\333\331m\326}\326\r\326m\246;M\343\230\033\212\343\214+\355\371\006N\032\327\275\227M\277\271\321O~\263\264A-\306]\326m\332M\243\261\356\354+\205Y\027\023\254\223\235\277b\321\275p\302\224\215`\003\005\314\232\300\343\232<\3370\374"
+	.string	"/\366\205\307\340\267\005\374\205o8\001^"
+	.string	"\200\017\340l"
+	.ascii	"^\2704|Q\322\220\347\025\233X\037\036\267\230{\r\201\242\321"
+	.ascii	"\336\347\276\337\264KQ\003c\206\206\367\275og_\031\031\263\243"
+	.ascii	"\305\310\230\332e\316\355\236\367m\314rE\326\273\3075I{[\362"
+	.ascii	")I\256 \331\351\236\033\nuz\335\036#\324\352^'z\247_\003\221"
+	.ascii	"5\363\013\t\253}\242g7\376a\277\375\264\316\361\020\356\327g"
+	.ascii	"\277\215p\232P\027b'\b."
+	.string	"\343\262\265U\3347\232\266\365\033\372\345i\274r\345Q\226P\346\250F\367N\370\350\323\357@Lh\237u\372Jm\375\303\317\233A9'3{\322\321'H\362\204)\007\313\tu\0334y\244%s\232u\313\316\364^&\031\372\254\337\214\314\213\033\230G9U\336g\322r\310\020\371\302\362\331\372?\305\304s\300\373\331em\334\240qY?\233\217\b\366^c#G\260\306\026J\255\366\263\303J\260H\346\023)\274\221\377\215\326Emla\256\2213\\\332x\232U\356\035\353\203\317\342\264\333\232S\225\235}\231\335\353^\253\244\246\017\374\273\321\340\267$\244!\005\343\367\223\232\252zrQ\025\204\252!\234b\341\200e0\reP\005\243\2004\244\242\242\244^\034\340\245\030P\r|Tk\216'\257zr\035O.\2441\003*\035\246\020F\315@A5\fB\345\206B\250\032Q\301!.H\025\204\221\362\013\246\020(@\234"
+	.string	"R\t\237\246\202T@\0323\202Q\300\027SC \323\217\245j\b\247\200TRRS@\335\322JJ\023!=\247=\244\267"
+	.ascii	"l(A\203\336\334\254\376\212\253\322tGp\013\337b~\204(\245\367"
+	.ascii	"E\244\302\032\333\207R[!b\351\031R\353\361Ev\340\277g&n!r\301"
+	.ascii	"*\362\373\023\3207)>\341\312 \311\027\274\337\026#\202!\212\361"
+	.ascii	"F2\370\237\361\213\314.\304\223OD2NNk\253\013\276\303\272\225"
+	.ascii	"mi\210xF\317\353\203G\372,\346\371\236\323\265\351\217>\253\357"
+	.ascii	"\264\202o<L\017\242\340\231k\336\270\254\322^\312\"\265K\004"
+	.ascii	"U\3311\275\021{\364}\005\020\233\335\322\373>\213\271\321x\335"
+	.ascii	"\335n`\275cEz\246'\001\346iT.\360\242\037\360\b>\3013w\370\360"
+	.ascii	";~\321{$\370V}\004J\257\032x\245\357\264\002o\200\300\007\200"
+	.ascii	"\305\250Q,*\215R\244DdD$I\223\326\220\002\021\252\"n\003\021"
+	.ascii	"\2001S\252f6\255\354g\364y\331\177)\262c\343\227\241Iu\377\213"
+	.ascii	"\034\227kr\241\r\300\3524\021y\333\331\204\001I\237\374\345G"
+	.ascii	"Y\314\342\215=3\3736\214U\260Q0`4\255\022\222\205A\034.\377%"
+	.ascii	"5c\243\232*g\272\277\b\221\310D\262}\0264\210\245h\214|\034\r"
+	.ascii	"l\032\337W\332\350\203\n!\241#\333\244\f/u'\022\200\333\273\256"
+	.ascii	"\332.{W]\217\224\362\251\261/\252'54\375X\324\355m\033\332\274"
+	.ascii	"\335\344\243\306\334`\020E\346\263^gx\032\035}\335n\001f\b[3"
+	.ascii	"\025\256\330\251\310?kc\226\23106\376\2424\327=T\016E\364\002"
+	.ascii	"\300c\351\330W\256\240\035\263BKH\251\033;\253\233\016\221&\336"
+	.ascii	"\300BE9\315\307l\366\201\035D\332\177\217\004\220\373\005\001"
+	.ascii	"VZ\fYMo\b~\304\007\2377\326\257\t*\202\301=\031O\362\221>\177"
+	.ascii	";\"\371\203\276]pjm\334\244\320\315\021\372c-\342\347\215&\374"
+	.ascii	"\353\272\252\202Uo\317\343\344\335)c2^\032\034\234/\217\023\315"
+	.ascii	"o\332$\221\336Nq\024\260\366\032\204\267t\336\026\031}\032}\311"
+	.ascii	"\312L\225\331kt\n\246\367\241\372$\334T\360)'\242`\001E\033]"
+	.ascii	"\007\034\0168\361\3542\313\231rEBk\255\1775\032\263pJ\236\266"
+	.ascii	"\024\347\234s\216\316HH;\260\363\004\355\257\204\376\001"
+	.text
+	.section	.gnu.lto_gyroExtiThread.87.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`%\003\275\030"
+	.string	"\206\355\237I\300VQ:U\272\302;\021\374\"\206\257y\371\223\032g\274\021J\350\016LE`\027\\Jq,\217\277\232\214\375\327\203/\372\327^\301\024*0\267\271\372\362E\201\200D\b\344\232"
+	.string	"\022\351\0025\235\271\311Z#d\357-\245L\001\215"
+	.string	"\177"
+	.string	"\211"
+	.string	"YV@\255\273\244_\255c\203\213\341\316\025\262Cf\177\026\002#\216\034x\224\264\302\bL\255\243\370qg\350\316p\007\320\235}\343\341\301\236\255*\004\351j\312\346\331\267\26589!\341|V\265M-f\024\251q\bN\260\221\013Z\260\207\214\245\267\\\320\256\244\204\336P\216mjACv\321Q\023\026\356\306s\205\203\261\262\205S!i\210\226\201p6\356-\262\n|<\325\236\220p2\226\301\t\265\326\363\017.\267g\355\377\361\177\315\337\001\002"
+	.string	"\244|Vl\034\346\177\316\036\301\302Z+\204\257\321\032\321\371\356\330\371\021;\274?;\277;t\347\266\023\335\020]\217\b\215\247\332\351J\321\221n\336?\326x\r\274\350\001y\357\376\311\227\231\374V\310_\201|\025\345\207\224\0176\237N\376\224|)\371-\371\334\374\035\240\341\307B\347D\202\224ZYL\215\251Ls\t\217/\321\372z\266\350\355\002\313P\255u\307\237\325\363\263v\356?\373Y\274D\036B;&\253\336\235\033\254\2620\n`L\224\224\334^5\020\017\005;\266\277U\302\003\"D\b\272\023d!\035\025]/("
+	.string	"\323\376\372\\7\274?_\337vX\252\021\005ek\237\3134\355%Z\001HnQh\265r\253e\232~QZ\037\216'\260\325JS0\273\325\347[\027\331\263\245\321\n\251nn\331{{R\343\251\177\2216\351J\276;\376\372\357\277V\005\255\232{\241\364\216nP4\236\222\263y\273[\274L\331\311\303\350vG\200"
+	.string	"\247\304\213\006\307\365\212\211\340\240#CQ\001\026K\2213\343\222\271p\344o\034`\340Pc#\312^91\227L,\241\343\332\021ob<\242\003\232\303L\274b\242\f\006\213\211\254\221\266\275\023\227\204\0300QP\264\256\375"
+	.ascii	"\177\241X\370\031\354R\315#\354\274\020\336\036,\310\240\201"
+	.ascii	"\225zL\266\366\031R5\357'\250\252)0\331&'6\330\330\320\235\252"
+	.ascii	"\366=\005\331\225!\204\246%\035`\363\336\023c\202\0356\320?\303"
+	.ascii	"a\377\036>\264\224~0\025H\"\304\2056\357\273}$A\250A\034H9\214"
+	.ascii	"\314L \"2\023\024\030\032\016@\002b\220\203\325\001\020\210G"
+	.ascii	"\325\001\373`d\"\333\023>\214\274Gn\217\302\375\326\227G\260"
+	.ascii	"\236b\342\361\324\241\321\020\237\254\216fs\343D\276\214\037"
+	.ascii	"F\b\234\013,*\335\253[\316\323\232\347\207\206.\374q\n\2516K"
+	.ascii	"D\006_*\250\374Y\205\343\324\216\206\326E\374@Z\250\024;\022"
+	.ascii	"\360\002\001\323\315\312V\253\270\236\024\310d\001\222F\335\270"
+	.ascii	"\364R\274_\"\272K\177\335\t&\253\032\352w\354\336H\221\375\345"
+	.ascii	"\025\025"
+	.text
+	.section	.gnu.lto_tcpThread.88.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\\\001\335\016"
+	.string	"\206\231`G\360\260(\035@^6\355\257\242i\324*\343\003D\241*W\201g&\3149F\247'fNB\236\341\246j\337\372r\236\216@X'\\P\262\r\250N\273\272\006\312\016yE\273\365\234\344\372%d\220]\266\226\354\275eJ\001H"
+	.string	"K"
+	.string	"N"
+	.string	"\324\337\017d\237\237{d\237\221\204\345\226>e\334\222\037\303\234\234\032\317\364)=\252\025\023\002<\225\004\305^8\227\371~\360P+Q\264<^\346!/\340\f\215\032\257\345\353qPk\365\256<\226;\273\355\013\266!\330\037\021\373\225\r\344\270\201\275P\321d\177\246\215\"\354\203\\b/G\226\275\353\003X\232\017\3465d\324\272\022\202\3255qN\330.\331\035\373\030\357\274@\255\254\230\233Z\277\005\246\237\317\2478L\311\336A\360\271\260xZ:\036T\334\250\365\01368\\S%{|\240\223\332\230\375\326iT\374\022&\031\355W\237\376(\373|\2143 \f\304iC)3\244\004\260\261\341\212\255\027*/\312\222\030\237\265\213\257\230\361\022\242V7\bC0U\353)\304\336\2002"
+	.string	"\206+\025M\236ksH\t\006\001\021\231l\037\"m\3430\214\234\204:\002Z\247\211\244C\"\022F\"L\240\335F\302i\0355\031i%4\304\241P\221\017\223N6\216v$\022G;\276\372\310\242\327\020\336\200\275N\021e\217\365[P\260\025\234E\005\203>-|:0H\240\205\300m\003% p\002\221Z\346\001{\362\205\206\327c\226]\030oMj\265\213<\025\300]Q-A\307'\270\303\336\256B\212L\343\b\"\300\035\276[\022\237\nv"
+	.string	"\006\fp\316\347`\214X8\017.S\0216\207\246K\316&i1"
+	.ascii	"\277\205c\021\204\364I\344P\312\257\013?\001"
+	.text
+	.section	.gnu.lto_systemInit.89.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\206\t]/"
+	.string	"JO \022EP^R\007\355\fL\215\340\314s\360\303(\214imPd\375kP\263\316\341\200\257\006{\336G\262\337\2139\210\245+M\234\303\265Fr ed\234"
+	.string	"\007\264e`\340m(@\236\367a\306\314|[\357&R\246\024\377"
+	.ascii	"\013\001\017\001\233\351\036e\352\315\346\376Ay\003qWz'\357I"
+	.ascii	"HG\304\241\267{\027n\355[k\327Z\373\033\251\366\330\340\001\227"
+	.ascii	"\201O\226mT\003\345y\235\302\275\223\177\273\327\356\377O\376"
+	.ascii	"\316\203\242\017%~;\327+6\2432\264\001\225Y\216\320\376Z\f\372"
+	.ascii	"7\371\272\370\235\300\b\312gQ\231l\n\013\265\311\237,G\025\374"
+	.ascii	"\352\307\366W\217\376\021\373k\373F\354\257\036\273\277\371\250"
+	.ascii	"\233\374x2\302\242\374\311\262|\334m\037?\261\210hh(\024\n\002"
+	.ascii	"\372i}\3305\270u\354\377w\377\363\2042\237\210\340\007\331\333"
+	.ascii	"\0279\221\0207=\344C5\036Z\0304B\273\222\346\315\214\275\005"
+	.ascii	"\233\322\034I{\271\261\035Z\310\203t\344\320@\376\223&7\206\246"
+	.ascii	"[\367y3cga\232\365\325\031\004\005\323A\337A\t\201c\360\206\320"
+	.ascii	"fp\257\321\375\335k\031\320/\255}&\310\262\354\372\t%{7zw\357"
+	.ascii	"s\377\027\356\355\200\302)`\\\034\231V\016\025\216\220\326\371"
+	.ascii	"bB\3238\363\331\354#\334o7\244\314\2343\t\364\361_\032\027\211"
+	.ascii	"\341\342861\335\232\367\213\217\314\305t1\035\033/\211\231\350"
+	.ascii	"\177\n\267pJf\016\263R\245\216\365\202\346L\\\327:\263n\364H"
+	.ascii	"\233\261\352\337\373\227\376\314\027?\221\322\377\324\2338\235"
+	.ascii	"\301v\265\017\r^\360\200\266\340Dl277SL\030\f\255\223\312-\333"
+	.ascii	"\002Hm\016\310\241do6W\360\277K\334\261ij<N@\373s`_\372^\244"
+	.ascii	"\272\274^\007())\226\352\303\026\232.\231\001hw\021#\364tn\376"
+	.ascii	"\332L\3777sU\344\257b\375\263\274\226*\177\"N\002\211d\177]\273"
+	.ascii	"\\\371\243\343\245\253>\324\376W`\2707\275\025\327!\374\212\242"
+	.ascii	"uV`\372\325\375\nKC\251\177\324\346f\372\217~\351SQ\266\262\354"
+	.ascii	"\365O\177)?%\351O\344W_\241\324\377\374\325_\311\376\332\364"
+	.ascii	"\356\\-\364?\375\b:\003R\301\002D\267\032\303\315\346\337\305"
+	.ascii	"\356]\240\255\355\316oo\327>\364\217.X\r\354\007\373\261\277"
+	.ascii	"\356(O9^\272\352\033\324`7-\234\326\251\337\230~M\332\356p\034"
+	.ascii	"x\216\376\347\336Je\\t\337\336\235,\334l\256\231\237\264\005"
+	.ascii	"\004\251\3369\351\227j\035\360\235\24650`\353\324gLp\036X\217"
+	.ascii	"\376g\322^*\253\233\233{\3644\325\204\222\234\231\301\325\326"
+	.ascii	"\371x\346p\210\005!\355\267K\342\203YF\366\205\264\205yqfin@"
+	.ascii	"Fi\272\206\246Q&\017\315l\356\347h\277\235\034\330\267\371\227"
+	.ascii	"j1\035#,\246\323\377<\332\302\274\033\304\375R\r\026\213\311"
+	.ascii	"h\235\217\207&7\275K\031\342\017\203}\251\226\2534\3425\375O"
+	.ascii	"\342\026N\253s\330f:\004=\264_\372\2011t\350V\326:\277\b\323"
+	.ascii	"\215\330\314l\013 \325\201V\360.\345\355]\357/\316a`\215,;"
+	.string	"\377\031\357h\235\377\203\351\327\227\276\235x\215\316\327\211\325|\304kklq\233\376\347\320\016\016\244\\*f%\337\023G@\312\245\342[\324r\267\240\n\370\253]\004\205\247(\247)\022PS\"0\220(\272Z\272pR2\301\365\272,^W\371\"\227J$\0072\261d4\032\261\264\256T\024\243.|(.\271\240\264ZD\025\227WZW\004\234\201q\201q\201\361A\003\006@\257\213\365&ClY-\005l%\223O\004\034\301\233|_\267\210e\225|r\227H\023[\\Ew\211t_\013In4\032\227WZ\032\252\262\334\245\262K9\202h\351\276;\305\022\031\325\205T\261\345N%\337.\024C\2672>y\320@u\\\272(^\344\362\250u\205\314:Z\275\312\243\261\350\311-\367=.\223\311\367\030\024\225\177\003\241\252\316^\373\313A\350\377*\226}X\217u\207\367`0yzf\260/H\002\211H`1"
+	.string	"`2\255S\247\2513\203\311\315\031SdD\325F4\234\256\302Gl\303A\244\264\337\f\023(0\337\2207\270\214\322\036\312\0233\207EI\2233\26477\223\202\300g\002\300}\255S\027\031\346\351\005\200\273\250Q0\310 sfd$)H\222$\035\340\002\221\031\262:\0200\205\212J\222$\035\376\f\302\313h\032\215\002\216R\025\301\001\341H\007\366\357\030\\\255\032@\2120y\033d\201Ff\372\307bE\361p\030\307\226\320p\325.\343"
+	.string	"\026\373\021\352\210\374\315(\372\313\005\"p\320\216\252\252~2.i\303T\340\352!\177;X\234\265\021\214\016\203\243\3544}\371\230\337\356@\244W\2314\274\326\316=\230\214\"\366\361>-\3125`\224\370M\223\334\231i\036V\337@\225i\003Pd4I\207\003f\306\244Pk'\262J\353\206\353Z8\333\242$\177\203\022\365\263`=\362\316\2027^\273lx!X\341\263`\013\232\353?C\364\250\021\330\365\242\007\201\373I"
+	.ascii	"/\262\3315\034H\252\013<\216\022&\240\006\335\t\2141g\027,\275"
+	.ascii	"\227)\rJ\264\233\327\\!c\264xp}\214\346@\243\211\247\255\203"
+	.ascii	"\375\005\235\335\217\370\320\240\254\245 E[\037\352!\303\025"
+	.ascii	"?[\363\201\017\275\342=\352\344\215?(\316bcJ8\202S\204\221\364"
+	.ascii	"3\3551\275\252<\021\232Q\255c\2409{\b\251sf\b/\213\343\013\270"
+	.ascii	"\374\374f\036\300\327\237L\377\020\3315o\257t\177\025\220\007"
+	.ascii	"\002\201\360\346=\252L\376\276\313\f@5"
+	.text
+	.section	.gnu.lto_systemReset.90.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`v\001\025\016"
+	.string	"\226X[D\360v\223\016\204\325\r>\370\2515\rn\034\244D=\343\377\307;\247\331\361\243[:\017\323\320\310\340\377\364\367\350!\250\226\232M\022I&\th\255\321\343e\2600\365\243C\247\277\333\311\032.\215\265do)S\nH"
+	.string	"C"
+	.string	"I"
+	.string	"U\3464\321\2422\223\304\"2l?\344\223\335\344:1\346wF\210`\365\3149\345\302\370\351p\365\344\033\242\370B\002K\220\330\254|(h@E\213\235\337\\I|\037T?\f\346\234\326\324w\342\216\267\255\300\366\002\373O\002\337\256\307h\303\352\211B\243-\203\324\327\301\301\026=G\347\004\217\035@!\344\201G\333C\214>\345\337|D\203\205\024'\250\235\261uft_\330\207s]\330WGU\303\253\367j\275\372,\312s\004\347P\002=\230\240t\212\375!'\"\3632\032]\217p\005\254pT9+\204\302\256\350\306\177\\\201T\320\025\331P\255"
+	.ascii	"\240>\314\365\265/\220Z@\234u\037X\246i\327\3437\256f\250rj\374"
+	.ascii	"\322\345\3578\217\222\277r\206M\237zt.\340e]&\001f\313\274.\246"
+	.ascii	"\263\300b\314\305\301\204\006/\322\3134\216\344I\r%\322&1\256"
+	.ascii	"\223.-6m\3108\351\231L\234\f}|\017P\004\267\037@\bP\003F#X\004"
+	.ascii	"-\356\246\b\202\243\206F[\372))\301\263\226\271\340b\b# \240"
+	.ascii	"\002\031\271\262\003\273\363\275\263\321\211\035\376-t\033\262"
+	.ascii	"\240`\244\f\254\232\267\254uZ\227\324K\342\376*V\001o\314\356"
+	.ascii	"\306r\321.0\231\027\304\017\215\321\021n4\315\272-o\237\253)"
+	.ascii	";\3259\253\301\264\264\213\321\207\260\372}\bp~S\n\017\005"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.91.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\202\001u\016"
+	.string	"VY^E\340VI:\200ir:\206R\320O\254(\013+\251I\272F$o\332\302\016\025\336U:\253nU\306\370\347r\020\004-A\255A\220H\310\030\237\222\304"
+	.string	"\022\203*b2\006\200\366\363\b\002\261\305Gdo)S\nJ"
+	.string	"D"
+	.string	"N"
+	.string	"7>\304dN\025\253\242\231$\016\241a\373+.\331N\356\2433\017\204s\342\007\312\234S\256\214\227\016WK\276!\213/4\260\004\211\212\005e\202\bp`"
+	.string	"\235\347\212\002EB5\305\301\234\323zB\255\270\343m7\260\035\301\376\223\372\323\243\277Y\217Q\025\304\306\220\215\256\254\242~\216\020\366\202\343\360\314\340Q\204\212\t\231\340\321\0361\243?\371<\037\325\b\"\0222m\215\355S\243\033\303>\234\233c_\035U\r\257\336\253\365\352\003\320#B\001)\214\254i,\270\033x41i\024\373A\027B\0033\032Y\217p\007\314\320I\365,\220\013\273.9\367q\375\201A\327\345E\312E"
+	.ascii	"\365e\254\257\255\341j)\361\237\367\3002M\263\036\277q\247(\325"
+	.ascii	"s\343\223,_\307w\220\374\035w\330\002>\320e\034.\316\303\307"
+	.ascii	"q\017\270\230/\3632\0132[\366y3^\206\002\306^$\304@\200\221_"
+	.ascii	"\246u\327'?\220\256Mb\235'_Z\314\201\310:\371q\\'WR|\023P\005"
+	.ascii	"\267'P\020\240\202\221\bVA\213\273-\212\020\335\330\350JQJ\002"
+	.ascii	"# \240\002\031\271\262\003\273\363\275\263\321\211\035\376-t"
+	.ascii	"\033\262\240`\244\f\254\232\267\254uZ\227\324K\342\376*V\001"
+	.ascii	"o\314\356\306r\321.0\231\027\304\017\215\321\021n4\315\272-o"
+	.ascii	"\237\253);\3259\253\301\264\264\213\321\207\260\372}\bp~S\n\017"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_timerInit.92.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21404`O\322\030\024\254\006"
+	.string	"\022P\r\310\201\2522\210\277]\250\313\220\277\031\203\300\237a\366*\"\207\330d\253\230p\244\353\336\b\226\343\335\003\032\245/\204\b\331[\246C\bg\005\342HH\352S\315\b\202=\260\341\201\343\020'5!;3\202\252\316'zdE\204\005[\024\224\214\323\262d\334h\253\322>\021\304h\333x\034\003\270u\305\342\023T\345b\005\2350\004<\342\201N\237\241\3414\333\275\310l\035\017{\rso\344U\332'\372\207\200\2420\243]\220\032\232\335&\027\223_7_\037\243Z\311j\313\311\007\313\314\356\306G\242\227\272k\325\024\035\310B\230\272"
+	.string	"\206\335\335e\241\020\375\351o\360/\374\"\001\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.93.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \305-\005"
+	.string	"2I\"*pm:(Y8\b\313\212q\304"
+	.string	"\252+\377,rK-6\237\222\0233\201H\b5\235\022\350\3039\357S\305\006\212\342\336)\005\306,\204\342\220\320-[\314k\323G\343r(6#jU\326 \331\324M\323\246R\341^\202\225DN\354\260\213\362b\037\260\022\264c\241s\221i\267r*m("
+	.string	"\322\330>e\316\036=\314\354?\034\212\207\264\273*1\347\0369\377\233\017\274\257{\024\030v\327\321\373,\267\274m\202m\3136#\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.94.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"-\t"
+	.string	"\346QA9@\217\322\001\230>B\237'\223\\\005\301\314\231\261\272\367\027\324\2121\021\232\0010\rr\252\263\200\341\370F`s\231hR\211\034&0_Zs\016\313s\235\023\366\223\275\367N)-"
+	.string	"1"
+	.string	"/"
+	.string	"\247\376l\230\207\260\375\212L\343dfw\253\f\261\214\337\247\214\237\177\360\372\364\270\334\\\257\307\215hw\035[\256\216\233\336\266\310\366\310vJt#\306\304\022\264\037\373\343,P\371\213\314.G\r\315\316h\213H\307\366\243\375\221\223|\217a\030`\367\003\205e74p\345\234~\356\321N\347\005\264\276\004\375)\301\317\335])A\333Z\214\362\341KT\001\260]\326[\025\034\026\002\301\251mq\021\337\362e\337\\\\\263\f\271\262\303U\224 \366\003\336L\003\037\020\b\344\300\231:\005\316SE\234H\017\r\036\316\324\241\246K\241\004\206\321BMq\020\036)U%N$T-y\0245\364q7\301y5\325u^\355\330\366&\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.95.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"u\n"
+	.string	"\266\023KC \307*\035\220\b\026\023\b\206\231\304\241V\374"
+	.string	"t\361)8@R\bRP\252L\021\006\t6\215\320\243\001\220T`\255\260\001F\310F\2161f\202\034\224\360\004\367cZ\001O\022\022\035l[#d\357\224\0023"
+	.string	"5"
+	.string	"9"
+	.string	"us\256;C\346\334\366\205\3149\217v\203\227\261\275\201\031J\201\007\273[\251\313\307\317\321\277\200s\310W\353S\023\332]O\362\245r\323\333v\260}\262\255 \333\356\256)\314\276\354\237[\003\f\003\017\007\273)\021 l\215;\360b\373\035\333\2634\202\005\264\335\375Xbs\316\237\366\001<\300x\031\2119\273,3\332n\371q\253\n\352\f\252\276\260\212 \030\326N\271\337\226\302\314\021S+\241&\326\314I?\340\004V\n\261]\327I\326\306\025\2028g\213\214\314\223\236\tVj'\264e\227\255I[\354\007N =t\036\217\347\343#\201\031\245\216n\"\004K]\310\312;\225\272\n\013Q\367\205\254\223\311\273\210\020S,\220B\364>\325\027v>\022\210\332<\002\211604\252\370\201\204\236XS&\017UGa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.96.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\227\001%\017"
+	.string	"\006\035eD"
+	.string	"\221(\035\260\027\244\333}E\212"
+	.string	"u\2508\221\223\221\2643\363\310\334TvI"
+	.string	"\024G\300>\200$\376\253\037FY\373\352\255\305\217\366z\206\266\227ybf\365T\370\372\312ktP\266o\373\204\220\275\245L)P"
+	.string	"K"
+	.string	"Q"
+	.ascii	"\207\231\363\372\211\324?\324\327;\321\300x\210\311vO\b<\272"
+	.ascii	"\343\036\277\037\277\345%RVy|\035R4\230\030\031P\340\330\375"
+	.ascii	":\177\357\320\036\271\007\320\036\225\303UO\225\177\330#Kl\326"
+	.ascii	"BY=7\006\273\353l\241\244\334z\333"
+	.string	"\003l\033\260\363@\005n\233,\344[\356h\221\311!\303\240+\373[\245n\260\017WUl\247?0\355\201\351\016Ls4\275\201i\rLs\232\336`Z\203\351\250i\b\323\n\323\251\351\003\210\320\302\304EB\302\214]\223\331\314\312\304\027!\376\375v\312\001W\201\362?<\032D\312\267\036}\222\366\270i\202\225WTUM\357\271\240F\325\030\311a!\250\0374^.nc\304\313\256\025\\\330e\tHU\275\307R\2223_S\363\206'\263'\034&\342v\027\301\365\003\304\214\313\304\213\2253sy\227\303H\\+\246Sz$\304\001\204\006\017\272\023\210\244$r\352(\204DD\335H\311\324\205\200xT\001T\352N\243Q\251\343|{\270\252\362Q\020\226\226\030\005w5,\220\271\344\314\036\375\350=\031\035\325\324\2431\306\023\301Q\215v6\312Q\017\030+B1\033=\213\025N5\233r\272\325x\021\371)\002\037"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\341\302H]\315\242\302\330\222T\343\340"
+	.ascii	"n\251\026\210\223b\272&\031"
+	.text
+	.section	.gnu.lto_micros64_real.97.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\306\036lF\340\262(\035\240C\201n\377a\\\006\246=\232\333,\023eO\"/(%R\020\212\021E\333\020\273\321\307F\312\240\334\3260M\247\013\356B\351A\f\303\347r8\3024,\204\002e\032\340\257Y\373\2374\262\267\224)\005V"
+	.string	"P"
+	.string	"["
+	.string	"\336o\257\3702\217p\256b\345\236\312\267\203\t\355\204\3101\333\2059\360hn{\374\002\360Q<\305\212Y\002x\037d\264\035\034\030t|\354z\234\275\213h\217\333C\264G\365p\226'\213\177\331a\017\215\035\261\230\226'h\301\356:c12\267\336v\001\333\t\354L\005\336\3629\227\241l1\004\267S*\344c\026\271\361~\314.h\213\355\265\244v\260\017Wil\247O0m\202\351\022L\223`z\004\323\"M\207`z\3234\b\2465\230\2160\r5\2550\235\232~\b\004\031/3'\"\374\354\276|@\266F\354\251y \335t\304\307\005\313g\361\026*\276\210G\253P\362\261G\037E{\004\351u@DM\325f\\b<\203\211\r64\224\350\201\261v\311\367\255\260\260\013\033"
+	.string	"5\352;\033\227\374\254\n5\3168\271l\245J\340\006\3165U{t3[\302e\254mw\025\\Q5$fnp`\371\005)\257\264\t\252\301\003\006\016\270\227\352\304\225zq\023V)\026g\342J\341P$nQP\271\270W\253\345\342F\336\036\256\322\234\224\004\246.V\201\273\034Jf9\371\331\244'}G\003\306Cfwm\240\244&M\236\316\206\244\232\226T\323\321\215\030\351\246$\035\361\021\351(\244\"\025\020\204g\365\"\244\377\t\" p\002\2312\332\003{\362\211M\327\3210\177\332\327\215\375\335\216V\35308\315\203E\321\257\274;~%$\210i\354F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W\315\235\267mn\030\333\022G\221"
+	.ascii	"\223O\336\311:\r\020I1]\217\f"
+	.text
+	.section	.gnu.lto_millis64_real.98.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\206\236kF\340\222*\035P\re_\023\020t"
+	.string	"\345u\324L\004%]ZD\262C\321\373/\211G\250\027:\304@\364F\336\3150\007*\325T\372,\006\365y\3648>\217\343:\2061\020\022 b7X\030\256-ido)S\nU"
+	.string	"P"
+	.string	"Z"
+	.ascii	"\277\375\362m\376\270\374\345u\320\365\371\241tdD\360\270\315"
+	.ascii	"\211r\340\322^w\371\t\300G\361\024/\303\004\200 T8\231\033\f"
+	.ascii	"17s\202\236\301\207p\227\335A\270\313\375p\330\025\346\337\366"
+	.ascii	"HccCK\211]9\013\346\234VZ\212\312\275\267m\300v\002[K\001z\230"
+	.ascii	"\333T\035\r\301mV\005=\315!/\034x\334.l\314\006c\272\036\354"
+	.ascii	"\307\271+\266\325\243\250\026Eu(\252AQ\375\211j\317\252;Q\335"
+	.ascii	"\255\232\023\325\\T\313\250\216\253\336\250\326U\037\004\302"
+	.ascii	"\315I\355D\004\026s\236\204>\246\rI\303r0+R\363\002\345\267\270"
+	.ascii	"\013\227?\342\322&\225\236v\351\253\270K\316>&\204\\]\2566\223"
+	.ascii	"\361\f&6\334\320P\202&\306\264I\302p\205\2059e\004\342\312\375"
+	.ascii	"\3272\323\320\273q%\r\223\333N\273\005p\270|uw\307w\263%\334"
+	.ascii	"\206\352\346\234\n\276$\226\0345\025.2\r\335\005\254\226\272"
+	.ascii	"\204\324\340\001\003\007^\313d\262*\265\274\t\247\022\312+Y\261"
+	.ascii	"<\322\210S\024L+\257\225J\255\274\0178\037\347\256\214vD\266"
+	.ascii	"3\273\342\234\035Hn0\032Z\264\243\375WC\326\303\001B+Z\235\371"
+	.ascii	"Z@\313mh9\035\037\211\317v\013Z\221\032\317~:\353\331\001?fN"
+	.ascii	"0:\373\031\234\355\002# `\2021e\264\007{\362\211M\327\3210\177"
+	.ascii	"\332\327\215\375n\017\243\260j\035\006\247y\260(\372\225\373"
+	.ascii	"\016^\t\001\"\032\273\2209\\\032]l\353\315M\024\0359\360\343"
+	.ascii	"\302\203\310\200\323\207\361\265\346\316\30767\214m\211\243H"
+	.ascii	"\200\311'\363dm\003DRL\327#\003"
+	.text
+	.section	.gnu.lto_micros64.99.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`f\001\225\016"
+	.string	"v\033`C\020\221\223\016K\377*\242naW"
+	.string	"(0c\330\233\323\244[\201yN\362$\240^\350\023;\306J\2635k\001\211\261T7\362}\200+"
+	.string	"O\263\t7A\300uic\243\360\363\265Z\322\2104\262w\222)\005L"
+	.string	"F"
+	.string	"J"
+	.ascii	"u\252\232Q\"G\216Cv\262Ba\305\330!0\354\206\031\326,\334\302"
+	.ascii	"\244\242\002]\t\225\213F\217\023\325L\214\335\326\316\003.C\314"
+	.ascii	"\001.\303\223\260\310)\252\235\362C\305\310\230RFN\r\203\030"
+	.ascii	"c\323\224\242\342\336m\017\264M\320f\006%i\023\347\004>t\200"
+	.ascii	")}\324v\243\374\210\326/~\245m\266c\224\313\201Y\rf7/\233\301"
+	.ascii	",\006\263\032\230\275`\026\276\354{\331\303l\276\254\001h,!N"
+	.ascii	"D\220\211qC\213G\204\201/(\214\3623\363\255I\234\r\315\363\330"
+	.ascii	"\275\342D\\\207\327\334\234\212R\f\313\250\013\205\266\264\345"
+	.ascii	"2\274\236\235\336\341\277\342X?\347\357\346R\224T\031~\0017N"
+	.ascii	"~\336\034\253v\341\027\242\332D1x\322&\303\332s\031\372\367\240"
+	.ascii	"\332q\"e\253X\266\026\002\027>$\257\b\210\003\b\r\036l\241\021"
+	.ascii	"\t\240\220\320F2!\304\263\211\200J6\220\217~*\214\200\266\320"
+	.ascii	"\347\003\332\264.\372\305\257t\376Az\251\332;uq\t\005\304\313"
+	.ascii	"\f\216T\027\333\005\255V\016\r1\222\fl\256m\256 F\206cq^\203"
+	.ascii	"\005\306\212S\366\0316\351xv\007  P\002A\352\262\016{\362\211"
+	.ascii	"1m \031v\326\"\347hX\235eo\363^\304\3120\\F\bt\300Be\267\252"
+	.ascii	"!\220\355\300B\243\242\305\303\b?\3173\256f\261y4\206\206\317"
+	.ascii	"\263\215E\026Z\303\224\2628}\002\\\304\n\302\246MB'\003"
+	.text
+	.section	.gnu.lto_millis64.100.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`f\001\225\016"
+	.string	"v\033`C"
+	.string	"\223\223\016p\207\306Y#\004l1\177\356Bt\3000\035\264\2012\025~[\266FaD\372\262\203^\267\336f\033\350*0\312\344\217\367\177\3228\201\026U\n\331\254\204b\351\236\315Cb\2114\262w\222)\005L"
+	.string	"F"
+	.string	"J"
+	.string	"\365K5\243D\216\234\206,%\345\201\025c\207\300\260\033fX\273\270\005JE\005:\022+W\212%\005\206G\214\335\326\316\003.C\314\001.\303\217\260\310)\252\375\342\207\312\2612\251\214\234\032\0061\306\246Ie\305\275\333\036h\233\240\315\f'i\023\347\004X\\fJ\037\265\335(\037\242\365\213oi\233\355\030\345r`V\203\331\315\313f0\213\301\254\006f/\230\205/\373^\3660\233/k"
+	.string	"Z\211\016'JV1fh\375\2103\260\006\n\243\374\314|\213\022\334\r\315\363\330\235\342>\\\207\327\334\334\212\022\f\307h\214\204\252\252\272\f\257g\247w\370\2478\326\317\371\273\271\024%\230\013\277"
+	.ascii	"\034'?o\216U\273\360\013Qm\242\026<i\223a\355\271\f\375o\240"
+	.ascii	"\321\343D\312V\261l)\004\025>&\357H\210\003\b\r\036l!\222\b "
+	.ascii	"\221\320fR\"\342\331F@'[\bH?\023H@[\350\363\001mZ\027\375\342"
+	.ascii	"[:\007!\275T\355\235\306\230\343\240\003\204\214\017\025\252"
+	.ascii	"\330.h\265d0\304H2\260\271\266\271\202\034+\216\305\371\f\021"
+	.ascii	"6X\234\262\313\260i\307\263;  P\002A\352\262\016{\362\2111m "
+	.ascii	"\031v\326\"\347hX\235eo\363^\304\3120\\F\bt\300Be\267\252!\220"
+	.ascii	"\355\300B\243\242\305\303\b?\3173\256f\261y4\206\206\317\263"
+	.ascii	"\215E\026Z\303\224\2628}\002\\\304\n\302\246MB'\003"
+	.text
+	.section	.gnu.lto_micros.101.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\030\376W\365\252\245\031B\036\362\306B\f\017\004l9Am\215 \243\206\344\230\231\200\264&\342\223\007\2778g\354\260\373n\262D\262\267\224)\005\266H\b\n\007\t\217\272,\300\n\365\034\030*\r\317\002!\236\024yz\270\300GM\023|P\334+\247i\224Q\215\257M\263\263I\311df\227v\204D\376\272\026Xh\324\262\243\225za\277\255rl\247[\246\357\b8^\322\331\235\310P\226\304\211l\330\306\330\220\337q\017\214\253\0263\260'Dc\003r\262\033_t\201\347\256=\340\271S\214W\317\312\377\307\333\210Iva\326\023\300`w\235\027Fq\353m\017\330\226lW\004\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_millis.102.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\030\376\367 \226}Hx\n\035\340>\223>\200\330r\202\332\032AF\r\31113\001iM\304'\017~q\316\330a\367\335\244\245\221\275\245L)\266L\007\t\006\b\257\272(\300J\365\032\026*\f\317\002\037\336$\231r\270\300WQ\024|Q\334+\247\251\224Q\215\257M\323\2639\311\344\307.m\210\210<v%\250\320\350e\307+\325\302~[\345\330N\267L\337\rt>\342\331\225\370\230\254\210\373\310\260\215\261#\177\343\035\214\255\02612\310Cc\323Q\262\033\237\364"
+	.string	"\350\256\035"
+	.string	"\272\323\213[O\313?\307\033\bI\b\226]OJ\301\356:\261l\342\326\333\026\260=\331\246\b\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_microsleep.103.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\266\001\315\020"
+	.string	"F rF\340\360&\035\302\262N\201\272i\360\361ks\316(\273\323GW\216\312\f\353\017\206\307oO0O\367X\362\254\3307\346\\\301\246\317\036\007\347A,\210\207v\210/4 \2748\"Nf\304\323\236\204\371\263\275\267\224)\005]"
+	.string	"X"
+	.string	"_"
+	.string	"k+`\016\344\260\344\001\342\341;I<4\314\306q[\317\376h\250\246h\307\356r\332\301\232\260\303\3704a~\3460uMF\264\330\341\b\t\234G\232|Oo)b\254h3\357\200\220\t\017*\232L\352\273\017\370a\2225\031\321p\236\037\tv\3279\243]\270?n\233\202\355\023\373R\001\266-\226\312c\377\204F\322\007k\315\376\320/\002\3231\246!L\277\227VM\247\246\277r\220c\243\243\202E\307\256\315\224\324*\301\027#~\373\355\277\263\312\266\235\b\366\033\314\227\346&\204\205\210\023O\2737\004\016m"
+	.string	"\344\360;\362\264\037t!\330\207*8dw\007\310\305\006Q>2\215]\227l\334\214\236\362\330\344O\023\250\253!\223<\274\312\243x\307\002\231\331*+\371\331\323\225\006\fJ3\032\313\267\273\253\312\2436\313\273\226,\232A\245\252\276\246\307\207\323\235\024\257\251\247)!\313)\213\350\365\301\215\0265=\356\022\355\326;\027u\332\335\023\001?\034t\202r\304\344T/\257La\275LxN1Y\320@\001\003\356\305Rq\241\274\270\b+(-\\\212\353\2053)qK\002\313\305\275Z-\027\247\262\355\265f8\303'\352)Fe\206y\273;\b\236n \240\362\370\327\025\033j2\242\326\374n\244\030\225\204\bj\311?z\031)\204o\030\3610*<\262\220\001@\332\020P\342gPU=\001\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\031D\272a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\267?\020"
+	.ascii	"D\204A\007\315^\355|\002"
+	.text
+	.section	.gnu.lto_delayMicroseconds.104.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\025\t"
+	.string	"v\322?6@\217\322\001\230\365\037\f\333\030\276\236QJ\b\312\230\257wo\223\322w\236[\240m\037N\372m\032cT\377\034e\354w\276\342\350]\276S\001\006\206\332O\366\2262\245-"
+	.string	"/"
+	.string	"/"
+	.string	"\017\310\016\337\001\262Cov\313\273\215\275\31351\002\263\273Q5\276=7\377 \337p\253\3233C\260\273NnUq\353m\013\330\036\260\357\312\262\337\372\241\246_\2465\323\231\351k<%Wa\331\245\210\305,\f\236tpl?\355{\374c{+\302\233]\f\222\327n\347q\324\034v\002\252O=\252\224\324\253\352U(\251\207\\\304&>\207!\374\312s\207\276_\331a\352\306\002\3525a\345E\345\202\312\230\335\235R3\354\277\335]\007$S:\3641@(8\210%\321\202\006*E\007\006PC\fi\244\370\351x\364 \322bi4\322\"\247\333\277U\226\025.`(M9\223Om\222)\317\271#\241'\007\f"
+	.ascii	"{\311'c\232\200\032\006\316\0360\224T\346\300\264\253\300\200"
+	.ascii	"K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.105.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\035\007"
+	.string	"\362\r24Po\322\001 [\256\225\300\200\261\234*\322\371\363\006\022H1\263\26489C$1V&\021!e\264\336\303\036T\020\321\b\226\247*\225\314,\263A\366\3362\245\241\210\354\247\203\240p\220\020-\020C\345\261\342C\203\307!~\252P\354lJA\200\252hQT\0255\332\375\356F]\020\331*\234E_\246k%&\322Y\263\024\262]8\254\325\260t\034\255\337\377\327\215Z\223\354|\234\222[V\376\214\030\230oP\005D\323\326\331z\304$\227I\024\315\374\033()\277\306i\f0\334x`2|\026\230\f{\265.\326<\356\023\026\f\223\227\377\321u\370r^\265K\234\311D\230\023\300\340\1773\023i\270\316m\t\332\026\264\375\b\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delay.106.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\020\001\r\r"
+	.string	"\346\230YC\020\2176\035\023\256\b\314Q\021R\354Gp\374t@\341\266\325\347$\037n01@\241@\371\201\326\307\243\265i\275\230i3\2607\024\240\213\212%\324AI\b\206Zb\001#"
+	.string	"VD4\352'mo)S\nE"
+	.string	"E"
+	.string	"D"
+	.string	"\367P\366\244\025\241\025\030\273{)\007\303\324\036\241\246\346g\251\005\327}\036a\005\"\361\220\321\201 \307\311\324\362\321\363B\267%\fQr\375\350PD\211\205\353J\236\025\202\335ur]\206\233\272\355\007\266\017\330\377\b\234\027\273$10\373\305\226\017\027\375\366?\262\306\366nB\273\310\302w\004\203\025\"\2610\355z\004\036m \363h/\363\264_\342)\332U@l\355n\350pb\327+\340+\363\250q\001\324#|"
+	.string	"\352\321\232]\n(\276\r\356\356B++\027\007\241\354\316\204<g"
+	.string	"/)>\021eq\001uj*m\n\025\362\\\245\0034\244|\233~l\357\223zb\237\003\345d\262\232\330W\371\255\213\356J\323\252\351\324\3645\032\0220#\002\031\266\311<\321\303Iwl,h\240\200\301\225y@\3006\331\025\341c\303\271:0\317\265\241\341\216\004\017\354\312:\035\354\322x{5\261\003\227/D\267\250'\232@\205H\236l\251*$\205b\204d\214+\275\246\352\312\b\210-c\256\031/\001\026"
+	.string	"{\311'\323\260\316&9\253H\236\016n"
+	.ascii	"&\263o\t\333\200,\222j\254(/\211Z\255[\002\321p\245\247\314A"
+	.ascii	"\273p\352\225@\\\334R\245j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_timeval_sub.107.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\263\003\205\030"
+	.string	"\266m\234G\240\330M:\301\365\003\203g\362+\022O\236\370\202\353\374sC\310\253\341\250\303a\207W\033\315\240\242\253\376\357\313Phi\333 C:Oa\\ \177\030z\234\034\243'@\016'IM\237g\372\341\0335i\204\220$S\n\213"
+	.string	"t"
+	.string	"\213"
+	.string	"R\205E\335\314r\262\230[\242\302\324\300O7a\220Q8\205\243\n\223\030w\006\374uAh\003(\200,\346\234J(\250Q%\201\263u\223i\334\274\0032L\214IS;b\334\035(-\364\327]\330\266\226\341\031\267\326\312\333\2418\362\322\224\241\033Rb\214\264\231i@\177\236e@\177?\341\233\275\347\255v1\360\256\246@\021\035\005\331C\362cG9o\026c\264\224\263\350\b\227\351b\020cl\022\035\215p?\267}\320vB\353\305\002Wj\355\305\030c\237\324zY\033\357l\001\246rkl\303\016\340\0326"
+	.string	"?\2714\216rg\300\254Lfc2\013\223YYf_2\033\313\254Kf[2\013\313,Kf__6\364\262\256g\301g\277\314z\231}f3\263&\340\031G\234T\324t\304(b\313J$\362\365ha*\373\311\216\362[\267\236\252\253\n\243\252\025\324\222\026\223\030#\204\320\267\032\312\001:\246\231\267\37432\244\305\362\327a\367n\350\230p@vX^@\203}\354Px\335R.\020\345\t\206\347zx\327\n\254\271\3536\312\332\322\271"
+	.ascii	"_s/\031\322\022\362\017\370\035\274u$\274\177w\t\031\322\372"
+	.ascii	"\225\022\244\350\032\370{\377\236\350b\340r\253~\376w\225?\243"
+	.ascii	"\254(:&\\\306\030\203~\245\346}\fNW\271\244\302CB\036@\222r\260"
+	.ascii	"\216Z\202:\007\005\017a\214\321+\200@\177\376MhMi\022\312\255"
+	.ascii	"v\027\224\0019:=<\236\353\307f\303\311\271\320\303\023\376\030"
+	.ascii	"\204}6|\350\321\261\201\315A\020\301\202\203"
+	.string	"\n4\037\235\f6\034\037\032\217\006\034\016\264\034[\017\r\301\254\265\016:6\232O\255f\243\301v\321O*\026\224\207\257\024XM\351\"\246y\221\253\374Rj\022\"\005\026\213\254o\300\231\027\265\265\371L\350\270\312\334\346\2169\314e\236O\206^\020\211\371\200!0\377\217*\030M\262_\325\226\0209yy\3542\232\277\374\273\022\273\221\244d\271<\310\316\003\017.H\214\0209i9\354.wD\250Q,\347\0302F\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/!D\020H7_\311\227Jb\206\221M\263\237\234\321\32543M^\361\234\310\016\374[>\302\261\245\2111k\027S\235\224ai5\313+\337\310/$\007N(s\246H\274\021\035\177\002(K\300\236\373%\207!A\2100S\377n\005I\215I\242l\201}\334\032\2557\371\333\207H\207\347\032K\274\2661\212|."
+	.ascii	"\2211\255l\310\212n\177\n\002h\235M*\025m/i\335\226\340?"
+	.text
+	.section	.gnu.lto_motorDevInit.114.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`=\002\365\023"
+	.string	"v\244\202J\260\022R:\242Pb \030xK\025\314gN\250p5\"3\224\034\371O@i\323\316\2030x\024\262)\017\372\321\267rFX\255\361\246\263\016\374\037\264\207${S\363B>\3111Y\274\374\300\357\244]\305Y\013\261d\023\271S\nl"
+	.string	"j"
+	.string	"l"
+	.string	"C\265\362\022x\024O\315{\201\360T<\201\360\3246\033\307y%\352\205xf\202\250j\255\343\222\260x\220w\203\323\366\220\202;m~\320'\b\246\333Cp\177zH\r|T\230p\351p\223\202,\233\033\033\001t2`\211\216\034!jt1\023L\201\363\375\357\023I\t\327\364\323\341|\262\034\324Z=s\272\0177\353\266clW\260\347I^\035\273u\240_\374\317O\357\273w\247'\235>"
+	.ascii	"\027\324m\307\222o\303T\255\036\256|\324\032\264\b\305}\267\377"
+	.ascii	"\302\377\331\345\367\016\303v\237\215\304\333\215\330\023\352"
+	.ascii	"y\252\265\212\234\372D<\r\001\357\262\025\220\330\016\244\341"
+	.ascii	" \025\267t\002\302\362\336\302\366\037\016\023\244\302\340h\030"
+	.ascii	"\210\247 \363\323~\317}lg\321\341\003j\325\241\021\266\305\333"
+	.ascii	"(\334\235R.\234`\246\325\301Zk\005wg\033\301w[\033\036\365h\222"
+	.ascii	"\311\301\315+\377dh\247\274\2104\260\300\266\313\211V\004\334"
+	.ascii	"\250\265\226\b}\b\346\357\234\372B,\366\373\201\236\022U\324"
+	.ascii	"\313\274\002\227''\305\264\273[?\306e\224\376\2163\320\346s\264"
+	.ascii	"\034\024\335\357N%\341\232z?^\346\225\315\273\315\335\021\361"
+	.ascii	"\240\021\021.\244\212\314\244&ki\2214\226\026\t$\213\n\f\245"
+	.ascii	"\265\002\263 +\037\314\312Z\031s9e$\002\005\223\tc\215\\\231"
+	.ascii	"\275j\243\f\366\212\215)3\3328\022\342\022\0039\033ke9\033]\274"
+	.ascii	"\372\3251\255\252UO/\213\363g\334?:\022\211\362z\205\247<>>r"
+	.ascii	"z\242F\204\273S\202\231V\026w.+if{6UDtw&Y\261\255]\247)\362\335"
+	.ascii	"\032\0071 `\0022Gg\007~\214\265\363\330\221d\264\255\310d\304"
+	.ascii	"\021\344\013\315g3\013\211U\364dB\031T\210\001\276e\364v1q\027"
+	.ascii	"\233/\t\257R\272\262~/\326\007/\367\330n\334{=-&\275\202\201"
+	.ascii	"n\300\244%M\033\223\"\3134\321\221\333\353\206\333\222x\t\214"
+	.ascii	"\205\375\f\243\275,\r\243\367^4\005\274\005\360%XT5\321\266/"
+	.ascii	"\200\362\353\022O"
+	.text
+	.section	.gnu.lto_servoDevInit.115.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`C\001\245\016"
+	.string	"6\033cF\360\260(\035r\317\\\275\335)\355`\264\230\2549\311\243\331v\204\270\365\352\032\035\307<\377\020`j\254\271^\213\200l\007\205\026\225|\237\303Ec\030}\370\032\321\266~E\0309\246\037|FP{\260I#\233l\231RM"
+	.string	"L"
+	.string	"N"
+	.string	"\266\361Pfo#z\250y\355.'Gx{\026\336\231~\237\231\324\317\247\271\206\030W\243\b\252|f\035\227\017\255"
+	.string	"`\207\354\203sCD\013h\322\354\004\314\345U\327\233\226i\024A\230k\347\301\356ZY@\020\267v\333'\266A\354\223\002R\375\016\205\323\313\351E\272\331}\211\345\354\214\031\303\304S\267\037\372*{\274\200\301\367T\312\2663\035\321\306\205k7L\360i\007\333\347=\266\257\366S\\\305\367\025\033.`7F\306\213\335P\201\271\355\323\341\th\237\333\007h\237\376\0349\343\312\311\2441\377\235f\233\234\325\025h`\233\364\026\030<h\354\356\207\305kD~\211Og@\321\263|\372(\332\347\001\031\034%\215Y\345\345UG\200\242\265\032Y;J\032\223\222\345\002\203!%\312\016U\364\203\2632c\031c?\225\2725\032@\025B!"
+	.string	"HJ,\204:\b\335\211\007\022y<\362\021aB\210\004n\004\"\361DF\\\250D\304\204\033\361D\334\207\001w\027@\0367\352:\217\363\204{\232\203\300\\0WI\232\246D\331C\224\232\234$\324-\232cU\203\203\352x\266\273\233I\324S4\225\232\374+\034"
+	.ascii	"\200X{\311\027\323\020\232\253\266v\211\205\274\214\276\253q"
+	.ascii	"\322\022\013\364x\035\306\021\033s`\232\002\233\006aZ\202v[\342"
+	.ascii	"sX\341tq\306\305hV\247\203vqXD\331\253\253f\364\f/(\312\257k"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_pwmGetMotors.116.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\262\314.4@o\222\016\320\236\256\372*\212\300~\223\013Q&#\353\321\301\031`\233\352\377\315N\271\232\212\002\316\354\307\325\177\311\204\3215\207\035M"
+	.string	"\206@\255nb\t\221)w&\004\205\203\004hy\026*\216\005\035\0308\r\260SA\300i3\365\340\251\240EQ\025\324\304\254\273x\221+\223\031jvC\032#\356F\337\022Wk\326w/\251o\023r\023\037A\315a|1\351.\276A\224\252\254dV\274\264d\312+\341\370?\257\271\036\375\370\214\021D\215Q"
+	.string	"\311\t\305\bKf\204\307\016H}\231\nH}.\243X\033v\013RL\207\213I&\002\265\001\030d\346-\023\215\272\353_\360O\277E\t"
+	.ascii	"{\311'\323\342\255\243c\205P\\\023\253\021B\013\221\211\273b"
+	.ascii	"j'\031"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.117.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \360e\006"
+	.string	"\342\013,1PM\324\001<V\346BA*T\375\254D!A\002Y?\321\222\021\212\"1\254\355'\006\026p\312&\224\tLEU\365AMg\334+\332\375\367N)v\246\001B\301\001\215\236\204\332D\224A\241Y\240Nu\240S\300P\303Si\004A\2252\334>f\362\2443\351\254\b\341_Z|\216o\222\237\341\207\t\376\272\364\247\345rn^\205Vb\301\317\346*\030-\354W6fv\204)\236v\022\221]\211\017eC\344\207\206\3553\246\354\221s\030{\017\220\210\016owi\2748uH\371\337x\300\205U\207"
+	.string	"\004\273kxa\023w\274\355\001\333\3236E\t"
+	.string	"{\3117c\261\2003\202\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmAreMotorsEnabled.118.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \353m\006"
+	.string	"\342K,3Pm\222\016'!\202&\002\212[\252j\035-\302i\024\255\306\336\222]\265\177\267\303\274)\270\221\306\2763\214\232\002\021\211\342\035<g\006g\0076\273\267L\001g&\004\205\203\204fi\026*\214\325\034\0300\r-SA\264\3512\365\240\251\232EQU\263dY\f\035^<(\361\355\250\307u5\216\330\\\261Jw\003P\351P\300\302s\243\317:\207\027\337Jb\350\277\017[IGP2?\243\223\024\221@D?\347-\023\024p\276\232e|*\"\231\3700\311\314\032b\364\352]\267\034\255l\244\204`\240N/\300 3?\fT\321\261\377\300?\375\024\001\t"
+	.ascii	"{\311'\323\342\2543b\206P\\\023\377\"\360\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.119.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \315\305\005"
+	.string	"\304\tl"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\367\267#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\355\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367~\361\370\200\377\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\n"
+	.ascii	"{\311'\323\"\030>*lV\001\271\206\347E\f&D\016w\356\325\316'"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.120.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"5\013"
+	.string	"\306\026O> O\225\016c\3009\325\003\032F\004\016\310\324\221\177Q\226\nG\327\255Q\210\351\020\367\244\0265\234:\327\226V\232\272\003\206\b8\363\215\346"
+	.string	"0\247\230\213 55 \330\330H\320&R\246\024:"
+	.string	":"
+	.string	"="
+	.string	"\320\2316\201J\367\024\005\353.\206\024k\367\2338f\207\356\354\025\377N\373\325\013\222\312\305\356F\325\360\356\331\371\377p\210W\002=\261\003\273\353\364J\026n\275\355\001\266\r\330W\020\317\376\375\330\225\206\231\2764\255\232\316+\375\214\330\361\024\252\335\n\255\216\325\200%6\330~\304\266\246\375\016\367\320\375\363\312\220]\023'X\273;q%;\224\\\300\343\360z\200\307\003\333\346\265P\205\232\033#\024\231^\372\rR\214TLU?\342 \312\226\257\251\037\2618\210\207\330\370(s<y\357\320\367<\016\257\230\n\030\034\027B\331\262?Pj\006\373\327\252\311~\352\001\232'\202\345\003'h\0164\030\350\013%\001\003\004\013bG{\300Y:Q\203\261d\342\205\343D\212\304\233\004\215\213\235m\343b\344\333\253\311\r84B*2T\333\237\223\330"
+	.string	"8\355n\001_\304G@\360Q\207\316\004\017"
+	.ascii	"{\311'c1\347\315(.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\215g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.121.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\215\007"
+	.string	"\242N56Po\322\001\243\243\346,C/:\306P\224w\342\032\265h~W\2157\210F\333\f\330\367\3543\270]\261\267\2732\001\2517\301(\254\212u\231\005?\334z\267\275S\nsd\305\004\031g\024\t\030\344apXh\2003\364 ?\023\216 >\"\b\222\022\3203\340\030\021\222p\306(!\247\3563\353PV\3002^VL\256\302\276\245\361C^-\377\303\023\244\366\353\317'i\376^\212\310\306)c1\265\225]K\315q\330\317\254C\331\256s1\222\275E\265\213\261\202Y\224g\222\262}\216\355\326\354\002\003\372\214\302n\367tR\262[\t\f\001\376Lm\225W\217=I\214\205\312ew\241\3538}\243\376A\036pa\245\267\r\302\356\272]\230\306\355n\273c\373\300v*\t"
+	.ascii	"{\311'cz\366\f\017\316B\327p\355\020\206JM\006wy\321N2"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.122.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\343\003u\027"
+	.string	"V*\221E\300\332(\035\340@\366m]\3600\363\036D\030\004l\251VK\200\224\377\374@\365k\362\317\357\230\317\306\257/\n\232O\224\250\325\256O\313\2002HY\017\321\"\334@\27564\036\210\366]\374G7\220\277\367\226R\246|"
+	.string	"o"
+	.string	"\204"
+	.string	"\352\363\222\n\321!3\325\335\t\252\205z\207\210z\314 \352\356\004*\037A\247\001\246\312OWs\367o\340`\246AT\234\273k\3744\351\326-8\370\251\374\354\007\243\272\034=\240\307\216\216\0211\335\r2\016\235\351\224\221wv%\345h:?\031*\343\001\036\033E\247\334\212\310\262\022\244s\333\030C\371\224\263EVw\253\217\356N.gw$\241\273\277\270\334\013\375H\377\303\376O\370#\203\335Mc\346y\212\251\034\242\310\027\333\2169iY\2558\363\017M\254\342\224\325GS;!\037A6\246\375:\332r\317\257\261\231\347\327 \252"
+	.string	"T\247_\355^5\367)\271G\311}M\334\237\346\336$\3674r_\212{\322\334\317\310\375'\367\243\270\237s/\345>\312=\307\375\362^\r\244\214"
+	.string	"\371\311)\013-\335.zd:H\362x\250N\365\327\\\243%\313\t\312\017\236\211\257X\251B\303\246\022\323\220\270$E\251LY}\224\251\222T4\303P\236\360>\236\031\3617y\264@\233"
+	.string	"M\240\037<\311\377m\364\347@\002\206\336A\227x0\ru\367\203$\252\344\003\b\227k\252d,\2700\221%\253N\231\0253G\326[\225\234\355}\231YF\271\021\325\266\247@w\257\257\273!\\\217(\022\330U\207\312\213\270\221\327\233\251rYi\314`R\304\253m/r\317\006\260\021\256WK\206\"\374d$P\204\024b\241,\304!\375esAC\205\026(\203\211\210\271d \211\033\027\016\370\212\235"
+	.string	"mX\017K\300b\240,\fc`I\327\032UB\215s\346\013\354_\301\302*\356\3144\035s\243\267\223\334\363"
+	.string	"7\030;Xu\272\301h\261w\242c\016\300\326]C\260\342\235\004\252\"\260JD\207Z_wMq\327.\352\005C\206\326*\256\265\201\303*N\305\272\023\232\222b.B[P\234\252a\324)M\250Q<\344\221\t\204fF\202\tZ\020C\213\001\260\002\221\031\273\035\021\360DG\230\311`t\317{CB\037\022E\340\3154o;w\226\022\036\274\370\030PNu\332\350Mr\275\275W\233\264\247\342\376\223=\013y:u\035\243\355\002\005\t"
+	.string	"\304\340M\224\202\020\3672\207#\023\205i<\335\220\0067\013\372$\020\234E\206}Y\240\313B\240[/\377(G\300\213"
+	.ascii	"\005dD~\333al\246*\271[\f\303T!\320\251\342\240\036?\371\220"
+	.ascii	")w\007\366\203\342\366\016\271\263\345E\220\233\200\322\307n"
+	.ascii	"\026\300\245X\204gC\272\032"
+	.text
+	.section	.gnu.lto_pwmWriteServo.123.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\355\t"
+	.string	"\006\324F=0\305*\035\236\213~\334\364\341\262_\374\370/"
+	.string	"_\235S>\242\245\352?o\r\274\005\224o\266\206\331)\321\312\020w\234\301\260\241\370\342\306\250\302z\233\177\312FyC\335\307o\233l\231R3"
+	.string	"4"
+	.string	"3"
+	.string	"\034\216\273\".\331n\330\361\314\\\372\263\013<dmB\353$\005;\260\2733\222\374\273~\376W\256\001U\247+\306aw\255\240*\344\216\267\255`\273\301~A\252>fk\241\234"
+	.string	"l\027\244\206`g\262\305\304\3667\266\243\332O\271\312\367\3201kv\001\004\220\355n\307\237\314%\347\b\227\313\355\007\227K\253\332\013\237\357\256\f\376\353,\030~\311\245I&=x\351\233.\227\007\rlQ\243\322<\004\304\370\210y}\304R\tPZ\263\303\223\306\021\373\333\306\225\375\360\337\356\372\343\246\326\234\251\002\224!5\270\211\221H:\344\201\220x\210\230%\216\302\003\225\346H\004\262\230!\2174=\034w\027\2347K]\347\315M\270\3376\256\234\031@\233\241b\2075\332\3368\2543`\355n\013"
+	.ascii	"{\311'c\032\202\032&\234\301\027\343c\332\345\032\276\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.124.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375 \374\005\007"
+	.string	"\002\r16@o\222\016\230\016\243\237lr>\025\030\022\314\034]q\237:\247'1`\366ong\333\322\0050\3236\313\207\334i}\002<\263\353\230\351\017\220\244\361\273YBd\n\022\027\206U\020Vf\253\303\340\260\320\020\267\353A\253\266\210ET\023\321\322*bgsFqiq\3132-j\272,Gm@0\364\335\347\301\217/&\241\307?\f\251T\026\224L\215\027\227\\\231TB~\317k~\370\336\340\300\323\022\213afG)%\263+8\002t\372\257HG<s\234\013\320\207C\"\3018i\311\354b@\007\250N\257\002T'\bR\256\217\2735\251B(\343E4\372\364e\0222\363'\032mt\330\237\340G\3709\002\t"
+	.ascii	"{\311'\323\"\030>*,V\001\271\206/\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.129.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\205\f"
+	.string	"\206\226VE"
+	.string	"\2614\035;?\332\335\026\376\247=\365G\370E \374s1N\327D\001\216\215vcI\024\220\327\215\351\315\200V3U\312\215d\223_\177\3526X\252\304Z\252\307\024\344T\017\\P\301\342\330j\263nD\312\224\002B"
+	.string	">"
+	.string	"C"
+	.string	";`\005\215\024\214\237\335\215z\342\250[\225&\312\027}\335\255P\314+\0052=95d|1\327\212@\252G\212"
+	.string	"\337KU\340\247\333\271\315\323\303\347\222\t\002\331]\247\367\211\270\257\333\216`\033\202\375R\257q\207\225\274w\313_\271n]o\363\003%tp\314\340\310\264dh\203]\252\t\373\032\206ah\245\261\237\316\247\0172@\"\306\315u\314\330\005\021\362X\036kG\205\355\217\214\262{\016\242\bi\227\230\250v\267\321\"\207O\365\221\251\330\005\\\t\376\233\277\330\3163S\263\013sOC\b&\"\270e\253l\310{\306R\332\271\340\220\252\237\216O\216"
+	.string	"?\204P\263\\W\01397^r\207}\234\263`q\026e\331\310\003l\001\t\273\020r\262q)\232\206Q01m\031PF*4\020a\220\205L \331T\312$8\020\211'\r\003Gr\212(%$'\321\304\251\304\022\346-E\343\342i\333\2708\002\367Jc\220\026uy\265\273k\001\b\025"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\031\027\256\200"
+	.ascii	"&@\334\257F\001+$\342\026\033\002\264\313(/C\214Kw\263i\251\220"
+	.ascii	"(j\025\024"
+	.text
+	.section	.gnu.lto_FLASH_Lock.130.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\227\001\025\020"
+	.string	"\346\234jH\340\260*\035\260\376\202\026\347\221p\\\307W\017\270I\327q\314\365d\3679\312^\347\032\273\362A\003\255\252\243q$\006K\240\220\004\037`\263\030\035\221\372|\tZV\035`\230\357\262"
+	.string	"\241\344B\377\302n\2145O6\221;\245U"
+	.string	"Q"
+	.string	"U"
+	.string	"\264\357\350Q\253\210\036\236\212\2439+l\037\344\226\255\3435\231\212`V\242\005\306N\255\025\\\025o\235z;[\376k\036\240\214\221\247\037\227{\0371\227\257W@f\313\r\210\275<\007\271\331\313k>C\304X\346\004"
+	.ascii	"\241\326\352Y\306F\334\337mW\260m\262\177#<0&\276\331\340\276"
+	.ascii	"m|_\233\203\207\371\322 83\334N\007[r\346f2\032\353\225\357["
+	.ascii	"r\223\3435y\330\267\271\213\025\177\306\037T\346\313S_\345;\375"
+	.ascii	"R\0246\035\030\033\022\256\331c\327\310\271)\354{uc\354O{"
+	.string	"\237\336O\037d\301\213.\037\230\210\350\364\264\347\\\200\275\304\360\201\201\242S{\204\204\346\304N\007bI\377\305g\230d\267\035\035\002\323[\373\204z-i{ \273\265\0200wg\255w\215\3577\371N\273\f\321\200L\255\256\227>\316c\244\374\231S\237\210\342wj\217\033B-K\336\354\336\026FI\225\214\304Q\225\022\206 \177\210V\fD!\ra\207\323*Dr\202\032I\031$\224\"\220BF\022\0305\"\231DJ +4Q\235X J\352$\202(\325\n\034\205<\246\204*\2205\216*\020T\253\337\030\207\320\340v:\327\262P\005\323\236@a/\263\345Xx\007\346i\277\225F8,\004# `\2021e\311\003{\362\211-n\233\201\302\301m/\270\313\340\272p%Br\214.\t\320*d\307\t\230\003?\270E\020\315A\b\256\013Z6\222\320V\376{\304[\211\300\266y#\336\334R\205q\245\365"
+	.ascii	"\315p\253\036\3768\356,\335\262\2356\222\032m\206\002"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.131.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\225\001}\020"
+	.string	"\206\237pG\340\322&\035\223E\302\200[\277o\320;@0M\007^\3225\fm\313Y\265yn\244"
+	.string	"\037\355\236\253c[;\240\260&u\207\335z\374\254\032\362\017\307\315s\"\221icv\250d\022\206t\b\252\204l\203\354-wJ\001["
+	.string	"S"
+	.string	"]"
+	.ascii	"\266o\342'j\354R\211\301>\024\240\0229D?v\301M\273I\366)\037"
+	.ascii	" \373"
+	.string	"T\020w=\233R\243\313\177\320\037\330\360\204\336\367z&\362\355|\232v.I\276\330\351\273\211*MtDx$_L&\330\021\303\307\203\0363|61\2060\330]G\357\333p\207\334\366\213m\224\375\241~\210O\257Z\361\336\247\337\312>\257'$\236\0279K\260\030\332\340+\252\217}\r\3030\264\366\330\007\177)\243U\243\243F\037\200\004*zR\217]\2350\310\036M\031#l\327\330'\3331\332G\361\0245\0071\274d\267\307\006\214]P\2017\323\247A\223\003\013\020|\332-\234\026\323\227\245\252f\036xtX5\344XB\232#Q\252\035c!\336\263\324\227\315\203\303\253\203\214\252\037\204\214Z\310|\306\317\212\263P\335HiwQ>\213\342\356}#\373\214:\200\306c\215\230\016\tU\037K\275V\020\302q\023\201\330'j\035P\332\205\335\363\205>t!\026!\300\301\314\244:\355E\245\261Z*\215\306"
+	.string	"\005n\225\352\032\240TXRV\034L(\260Zq\235\213K\n\212\203IE\030q\313\311\212\004\b,\033\213\203\351R\254m&&%\263\265t\253\355D\263\212\206\3536\226J\325m'p/W{\356\312~\224\024\036\301\324F\356\356f%Q\365*\356\002%\340g\027\347^\312\204\023\036"
+	.string	"\361\fn\257|\0203\315\274\206\303\246y\2202\021n\214\312\0364\203\005\t\214"
+	.ascii	"\bp\214\002\305\230\017\343\254\240\261\007\213\205\202|\020"
+	.ascii	"\366\204\210\217\013\273\\\263;4A\300\tA\252A\232\222\276\272"
+	.ascii	"\272\252!=oT\333\002\005"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.132.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\270\001%\021"
+	.string	"\366\240uG\340\322&\035R\033B\300}\226`\261\354\223\271Y\0255N\323\361.\017\362zeF\210\037\330J\367\\\035\333\332\005\345\330`\247\231\310\356\020\370\200\332\317\321\204@\301\363\034\203)#\204e\250\3262\317\346\326\222M\266L)_"
+	.string	"Z"
+	.string	"b"
+	.string	"\237\026Q\266}\242\237\260\361+E\026\013O\206\220t\216~\354\212\234\352$\333\247v\002\333\247\034\361\327\267\251I}\371\237\035\302\215\017\f0\204}K\205<\237(\236k#\241L$\304Q\251\221\354\b\201#\241LS\300#\206\217\317\256\035\302\033\325\223\203\335\265\202\341\207\373t\3330\266[\3543\005\323\031Zz\360\323om\237\227\247\245\236\034:Cb:\332\"L%\220}9\216\343h\371c\277\350G]\374\267\251\236\232Z5\365S(DB\006\216vwF!\2534e\224\260mc\213\330\226\372\242\r\006\260\033\002\b\003U\373(\236\302\346\"\207\013\330\375\251\221\264+.0\207\n\r\022|\332\235\213J&a\336\344\224'\021=\243\245\007\035C\226f"
+	.ascii	"E\311M\332\254\030=\350)av\017\0200\037M\245\356\230\341pq\341"
+	.ascii	"FA,\336B\346/\232v\367\344\023Iwo\033\333\247\312m\306\225\206"
+	.ascii	"l\307\204\224@\336\344\245\205\331\r\034\rb\177E\353@\323n\354"
+	.ascii	"\240\177t\025\236O\342\001N!X\261f\272O\005\343\251\\5\236\212"
+	.ascii	"\246\204\345\345\363(\310t\037\313\373$\264\244\254<PA\251P\262"
+	.ascii	"\252\301\320i\230\337\313K\247\331\305DeB\204\025\316\265b}\235"
+	.ascii	"\213\233\211\351d8\227\257\305\231\250\354\321\254>\316\345y"
+	.ascii	"\037'\"\356\265\225?\332_\333\225\230\206\224b\362F\333\335\335"
+	.ascii	"\006\350\2247z\022K\201\240\335\234\203-\250\234  \240\002\031"
+	.ascii	"2\365\273\363\3112\375\036\303\203,\325\312\004e\234\307;\006"
+	.ascii	"\203\b\267}\301Q\032\212\317\2078\253\230}\026\013!?a\017\213"
+	.ascii	"\370|\330i\317\006\023dB\226\215\020\030\376\273\202\240AR\322"
+	.ascii	"\317\325\265\206\264\334\250\266\006\n"
+	.text
+	.section	.gnu.lto_uartPinConfigure.133.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\255\b"
+	.string	"f\320=9Po\322\001\340D\361\233\265\271\302[C\276\360]\220Z\2426j\351\357df\326\020\347\275\311b\013\033jC\215\242\026\n\233\2052&\326\t\224(\301\346c1aD\332\336)\005*"
+	.string	"-"
+	.string	"."
+	.string	"\330/\2036\314kj\017L\\<TdvwJ\222\203\217\240\377\325\003\302S\351\021\340\263\273\216\341)\344\226\267\235`;\302\266*k\211\262\245\300\314\307\351\"1\273 54\313\272ZJ8\266\037\355\253~\002\036E\343\235]\324\313\312ne\360\314~\271\336"
+	.string	"\373\225\275 u\277Y\211r\326bamH\016c\361\365)\244\201\324\256\351\341Ef\372(\374\26212\342C/\264V\254\016Y\262k)\312\021\373\233\335\r\336(\351\243\032\251#\342&:\257\241\343 (4\216n\240\021\201C\236\007\t\007\320\3746\021\325\276\331qZ\305\fQ\213\351A\2607\332\350\374<\217NN\n"
+	.ascii	"\305,c/Id\354\001\237\265\300\331-0\344\022l\263\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_spektrumBind.134.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\235\b"
+	.string	"6\320=9@s\322\001@\244\t\210\345Gc\203\027\3335\327\377\340\257\232\223\323T\233\035G\003\312\2077\271\305Rk\262E\332\022\301\265\3626Ic\313C\372\025\033~\206\223A\244\355\235R*"
+	.string	"-"
+	.string	"."
+	.string	"\307\f\3325\257\253EH\241\021i\261\331\335)O\016>\202\376[\017\bS\247G\200\207\335u\fS$\267\274m\005\333\022\266Y\001ReK\201\033\227\324KfvGrp\326\205\301\240xl?\332g]\005\374\212\307\013vU\255\227\335\332\340\251\035s\375AvL\273A\026\235\225*k/\031\327\207\004q\026_\317b\"X\355\242\036jh(\207\205c6GG|h\206W\214+D\236\354z\212\322\304~gw\327\001\276\3508\210\221\211~\031\033\2514 \3420:/b\203j\016}(,&*\346\267\211(\350\233\035\007\032\315\020-\315O\202=\322F\347\347ytz\352>\t"
+	.string	"{\311'c\032\370\f\007\316B\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.199.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\016\001u\f"
+	.string	"\026\227R@\020Q\225\016(\b\022q\345\204\360\004\3075;\315};c\020\026G\332q\206*\217\237Z^\233ErL\334\b0\356H)3\252r\226\237\310\207\024I\31432Q\004\243\324\004{I$\233\354\235R<"
+	.string	"@"
+	.string	"C"
+	.string	"\323T\373t\370\001\331\247v\001\331\347C\330\3760\030\264g<L\355DE\272\340\252\261\273\364Sv8x\0311\320\017]B2hx\fp\214\003\263\273\3266\334\363\266\017\330N`\277\024\321\276\375\022\237\337\272\313\221\360c\331r\371\276\002\305\311\206h\260\330\re\264-\027\360+P\266\024@\250H\257\335\320\300\247\021h\237\017\035\371\264\210\217"
+	.string	"O\302-$\353\261\361\343\2452\275v\227\362\004>R\\E\347\301\266e\237\3578\212N\333\025\231\370\211\352{\370\264\204.~\364\351w\331gB\374\310w\375)\217\0272,\310P\224(K\354\330\312\223-\243\211\022c\267t\303\306r\230.>\274\365\263\036\236\347S\025p\325\253\033\204\003A\263\311x\237\252ySa\320`A\206z\034\007\234\306\243\236\216f\243\033\256\243\225\002\256\0218\034\365j\345h\304v\274<\031#\222\025,\245D\331\006\020%7\214\354\035_\261\005\033"
+	.string	"\177\311\017\347\f\374\032\n3\030\310\004\f\354\250\374\207\032\333\007\273"
+	.string	"Q0\314\025.\027+\264P!p\035\030\024\022\301\013$\326]a\031I%Eg\2006Sv\032"
+	.ascii	"\256=\340F\213\350w\2251"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.200.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\235\006\025&"
+	.string	"zC\254\016F\200\236\321pe\207\205\340\036~\341\200\317\nM<\270\225CI\233\003fk`\016,\370\363\034\202?\"\331\324\263\302\352A\313\017\217\240\326\240\217P\"\263o\005\200\266\273yN\r.|b\251W%\351\266{o)\223\f\325"
+	.string	"\302"
+	.string	"\340"
+	.string	"\017\373\215\347\335\357\235\234\270\217\362\343\336\302\300\300\242\210\246`l\360bc\344\001z\323\370\342P\242\370@q\265aU\374\023\365P\242\312UX\\m\330\246j\024\277\350\254kQ\350\346\346\320\233[<\201\363&z\001\347\207\337\017_\354\336n7\337dw_X\255\272\333\346E\256\365\200\227\027 \030\235u]s7[\310\325\333j(\3554\313\346\233\272\267]\371n\003\252\225\351\0271\340\307\254\260J\005Az\230\375\210\225\016F[\330\345\213\tm\314J\370!\220O\032\221\221V\r\262/3\223F4<\020\020\033X/}\256\252\312t]\327\037\251\270\313\326R\342s\365+/\234\201\221\362\3419\306\325\024s\200\337hD\353\272\356\245v|y\276\273\305\335\003\3305\213\001\315`\300;\006\230{\367(\004?\330\235R\265o\271p\323|\307$YC\341"
+	.ascii	"\346/\227s\277`\316\367\356\b\022\374\340\376\370\313\b\343Q"
+	.ascii	"4+\373\265o\373\2354S\346\330\275\265\273-\316w\373\216C\214"
+	.ascii	"j\250\270\316\276\367V~\245\305\276kK \231{\244\363\346\343\004"
+	.ascii	"\337Hqr\177\370\304WQ\322\241\277\f\270\233'~\n\023\272\256\277"
+	.ascii	"\007w\350O\002\016E\n~\360\375\341\217\343\307\303\312\254\254"
+	.ascii	"\252}\334[\333\267w2\231Ln\007\331m\336\037\224\327\207\306\333"
+	.ascii	"s\362\362\230\274\267\346\2655o\255y\321\033\277\264\346=\233"
+	.ascii	"\327|\330\267,y\273y\271y\017T\"\321\361\223\265\2565\222g\253"
+	.ascii	"\017SK\221\374\340\255O`\211\001\261d\240cgD\366%\325\037Z\350"
+	.ascii	"\357Rp7mg\266\356,U\270\262\206]\264\336\302\362Z\367j]\307\016"
+	.ascii	"\235\203\311\251u#\317\334\020\253j\337\211\207\303d\201\314"
+	.ascii	"\215\2725\200K\b\372\373\216\341\001 \317\\\211\375\020\354X"
+	.ascii	"r&\220\341\344\013\2716\220\025\342#\337\206\351ak\324!/\313"
+	.ascii	"\352\"\202\376V\340v\325\"\252W\032\025\t\332\024\204w\314 \376"
+	.ascii	"\330\313>\362h\230~\344:\362fT%\005\270T&\350\317\b\2476Q\207"
+	.ascii	"LF&\216\030\360\3117o\264\312\336ZZ\227\335O\216h\214iR>\233"
+	.ascii	"\327\365\373\345\374\243\316#/V\224\200k]\245\302\\\f\206}\327"
+	.ascii	"\315\315PTt\032q\340\007i\235\002\277\234-Bx\206\200\315\336"
+	.ascii	"\365\360\241\213\331\020\204s\230\b\273\313k{\nJ)\350\240v=\026"
+	.ascii	"@kc\260B,zmPI\272\236R\203\265\361\240\322%]\323.\351\304\202"
+	.ascii	"\265\345\322\245\246\240\264B\252s\261{J\035\340\236\202p\351"
+	.ascii	"\222n)\211\327\224\226@\241\304kr\n\201\264\341\bC\007\r$\206"
+	.ascii	"V\250\327\353\26431\224\202\327S\241\323\335t.vGM\246\323Wi\250"
+	.ascii	"\003\b\016G9(\035S/\t*\347\264KJ\221S\352=\345\206\322\345\251"
+	.ascii	"\320\365rP<^/w\333]~\271v\220%\222\352\251\355\227\253\020\373"
+	.ascii	"\364\211LC\2151\003\375\275\fw\363\207c\374tM8\201{\256\324\033"
+	.ascii	"\374\240O\247T\f\343\304r\371n9o\366\264\217\321\f\025\254\b"
+	.ascii	"\274\253\346Pu\234\017\362\364\255\374\274\310\314\312\246x\320"
+	.ascii	"\020kc~\353\236Q\r\004\256\365\307\234\253\212P\246Z\225\207"
+	.ascii	"\332#|\250\201\030\346\0204H)\022\021Q\320$I\007P\0021\350\214"
+	.ascii	"l\003\021P\265T$#3\242JZ\003P\217\032\324\301\267\314\226\301"
+	.ascii	"\242\376a\246 MM\217\353\227+GD\265\322\325\357a8\230\316\272"
+	.ascii	"\345\022A\274\fQ\264\024n\245\244\377\307}\3758\006Kd\241\321"
+	.ascii	"\206\243b\213\322\256'\202\bly\370K\336\222\215yjnI\241\367\235"
+	.ascii	"\344O\244\227\034\021~$\277C,\322\036$\241\233\035\322\336o4"
+	.ascii	"$\322\303\021\311E*%\2136\b\275\270\naD\320\364\004>\347\332"
+	.ascii	"d\314\370Ix\230\326\231G\0179\367B\355Tu\231h\024\242\235>\005"
+	.ascii	"\362\005 v\257\341\367\2113\223G\201 \334lXp\243}\f\224\326\027"
+	.ascii	"\2766f\310\327\230\304\211sUd.\005\300\246\025\247l\bfU\331k"
+	.ascii	"\251\362\300\233_D\344\370\340\370\206\350\2540\3609\325\031"
+	.ascii	")\255\321\314\354\2748\354al\366s\302h\004t+\346r\265\034,]\003"
+	.ascii	"\346\026\347\022\357\315%\030\373lVi"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.201.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"5\n"
+	.string	"\346RF<0\345\2521\200\213\037\027_4\300 D\022^\016XC\177\251\177\002H\223)cp\266\352\352"
+	.string	"\273\233\276n\266\301\275\207\036l\023 \335\0360\003\003\332}\311Ed\226\306\266\245\224)\0053"
+	.string	"4"
+	.string	"4"
+	.string	"Vqxe\003\370m\344\032\324@^+\002\356\275\365\335\024\371\352S\322\225\177\3335#\214\365\271\201u\\\022\234\n0\334{\235\361\270\273\333^\260\r\262\035 \247\031#%?\276\363S\230w\237\023\306b\022\263}\264dN\316\231'=\275SfK\351SZ#\031\210\335\273\221\033pC\272\226\022\3736\225\315\341\274\373\211\035\225c[\236\336)s\346\305\005\327\232\032s\316lk\344\347\301\0130\n?\312U\354q1\332\275\256\217\027\031WMxg\237P\362\243\275\327d\331O\371-\303\001\336P\200\243\317Z\224P\236hK\336I\344\221lh\002AOb\364Y\317\304\303\247\301\343\020\201\340\257\343\001A|\252\bV\204!\261\226D!R\375\302S\355x\266&0\254\242\265a\021"
+	.ascii	"ze\321\033k\270\215\025\030H\004D\3010W8 &0\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.part.0.202.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\005\013"
+	.string	"\246\224J@ \307*\035\227\b\"\002!\020\334\304\005\274\375\002l\234\201-\304\330\265\242\013\030\361\343\034\025\331\217\261\022\006\002\351\363A\"\354\200\021\002(n\345\323!\300\244\002\200\340\316\202\206[2\310&{\247\0247"
+	.string	"7"
+	.string	"8"
+	.string	"_\340N\273+p\247\026m\004\233]T\007&F5K\260\273u\266\\\374\224\233\350\243>/\273\004\313\211\201U\213\3442\341\233\201gw\335\225\334\364\266;\266!\354?\004-\326\356\310`\001\037`r)\263\264\225\224z\352m\366e\242\255\261M\266\346\3621\361\260\323f\334\021\226/\355\003x"
+	.string	"\323a\247#\354\272\016\320v\307\206S\327\356\324c\265\273"
+	.string	"'\247\035z\310\257\354\205L\224?\345\274\354\031\325\202\224\254\311\371\362\334\276\355\356z\272\354MZ>\366\237J\023\007\224]\221\232\202U\241\004^f\242K\366@F\227a\370\201\241P\004\306'\372T\034\030\304\241\270\230\260\250\244O\004~Hu#\343\243QA`X9\236G\034\037XI\243\021X5\266\345\267\235.{R\363\303s\316\227\355Nv\373\016\356\001\025"
+	.string	"zeAZ\326\360\266\017\005\\"
+	.ascii	"y`\304\\\342y\306\225\363jV\233V\260\204\306\\\020K\017\205\204"
+	.ascii	"#9\373p\347*\342D6*\035\315F\237P\360"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.203.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`5\001\025\016"
+	.string	"V\232_F"
+	.string	"\261&\035\233\241\256\235>2_^9Q\274\327\030\201\031\242\251QU'\306\247\017\354\022\307eA[\204\267{N\355\034\020Ki\270F\326y\013\273\2054\204\003\2624\237m\376\302`\366\341\"\261fd\333\336r\247\024H"
+	.string	"K"
+	.string	"J"
+	.ascii	"\267q\371\307n\214F\317\356g\340\3223\273\364\367\001\240\313"
+	.ascii	"\354\001@\227\366l\034 \273\254\322\n\036\030\030:vw\352\211"
+	.ascii	"{W\030=\237u\275\316KL\300"
+	.string	"r\270^!\016\001<\206Hv\327\231\210[\336v\311\266\004\3732\001?<\266\204\234\241\302\366w\334b\315\303W\363\212\331\375\n\330n\021m\317\f\211yi_\307\263I\366\312&)|\216w\034U\374\366\245.\376bu\034\225E\2733;\020d\227Z<\374\215w\033\027\220oA\304\370\320>\213\267X\005Pc\\\006J@\315n\353..k) pigX\201w\371;>#l\264\224eU\237\207\203\312O\341\263\200.CP\300\256Po\300|`z\274\300\037\2504\326\030ww\2551\3739\277Jh\370\233\377!(\223\240\306\356\207\036m(\035\020\321\026h*\"\024L\035\027\001\265u)\\\367\240B\203\023\006&%\023BN,\0276\r\2623\231\266h\224\021\023\b\016Nf\352\224\322m\251\211\301\302\206\232(\335\312\034\321\314\251\234\272\231\342\270n\222l\303\307\325\230I^\264\203U\225\306\366(\033"
+	.ascii	"zeY]\326\360\266\361\300cB0Hcd\211Z\016\210\202at\271:\214\212"
+	.ascii	"Dn\206\261A7\2450\215\344\024\f\206\205\360\213@\n\227\031ar"
+	.ascii	"\316;\334iE\\\313F9GS\350\273\n\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`>\017\345."
+	.string	"\252I\370\017B`^N:\313\2420\274'\206\322\271/pC\241\372\237\255\334\017\223U\374I\341\350\276\241\313+\252Qk\006f`6\370\213\264\341/\005\215\220[_\030\235P\346F\t[i\0069\227\367\252\217dn\222R\347"
+	.string	"\341"
+	.string	"\370"
+	.string	"F\326xE\326w\314K\035\n\324\372\315\274\262a\r\307\302\034\034\226\023Y\337\231C\326v\246\220u]\220gA\217\005\310:5\211\277r>\352^\347\207k\272]\317\231\024l<+XMi\311\231\260\017\353\244\371d\266\0376\363q\253\036\247Z\300\343S\347\216\0339u\274H\216\365\033\034k\245)\302e\347\215\265\035\033\353:\346I\204\217\261\306\232\016\215\265\2349c\035g\312X\303\231\032|\214a\267\016Fz0\332\t\302g\304!\031\030\3539\346\213\265\233\007n3\211C2.\326mZ\354\221,\366Gs\305\036\315T\361.\247\243\230>L\341e].\227K\024\373\263%\2639\025xm\301\220HD\307"
+	.ascii	"\030\016\207\303\023{3\263\332G\207&\234v\332\376\r\211\3044"
+	.ascii	"b\366\332kU\307\340\325\247\027b\035\307\264= Cs\\\333\366K\330"
+	.ascii	"\366Xk\373,\265\375U\332~\013\271\347r\334GA\333;9\333s\231\355"
+	.ascii	"\237\224\355\265\260\331K1\356\217\254\331#!\333W\251\331'I\263"
+	.ascii	"\227B\263\2672\266grf?\304\314^\254\314\376\213\314>l\314~\213"
+	.ascii	"\330^L\330>\214\230}\2230{0`\366_\276\354\275x\331\203\201\355"
+	.ascii	"\265\276\366D\272\354\273\270\354\247l\331\027\265\354\251d\331"
+	.ascii	"W\371p8\264\227\260\354\225\374\212\320\313\206N+>tV\331\013"
+	.ascii	"\241\262\017R\334\243S\366@\272\366D\363R\224\242\254\345\034"
+	.ascii	"\312>\352\311\272\020\227\365N'kB[\353>\255\365\240,\3639\233"
+	.ascii	"\254\005a\255\003]\255\0011Y\377Y\262\366\243\304{\366\204|="
+	.ascii	"\311\272\217\225\363\234U\326\203\304{\247\335\376H99\325\232"
+	.ascii	"\357\310:\357Sk<\001U[\336\343T\201]\217\240f\b2i?N\225\351\025"
+	.ascii	"\215\253\230&t\252?\364\350T\270'\2040\301\201\004\b\225)\311"
+	.ascii	"A\203z\243\230\223\f\352\210'\255q\365\t2\240\313#C\263\036\203"
+	.string	"\212#O\260\322 S\nV\022E=\301\272\204\356\t\326\002\306?\317X\330\230\371\004}\3276\026\305p\301\312A)\230\027\314S\312K\252M\tj\223\225\b\f !!!!!U\242\"\336Q%BoZ\315M\311\371\241\306\243x\222Gp\300\332tG@-\2414\272+\252Pv\001j\323\353Q\271\263\336H\347\254\277b\235\263\376\322\327e]jf;g%*\022\245\377\222\217oJQQy\326\"\343\223\266\304\034wV#\343\257\005\210>Ik\312tg\005\032\323\263\036\241ug=2^\300\335\230\347\316\332\364C\223\256O\341\270\036}5{\013b\3457\327\022q\\\241\344\27069vs\033\233\221\331*U\335!:+\275\346=\255(\256\"\257\325\037\331\237\225f\367\025\300j\365WT\246|V\253/\322Y\255\226\270i\367%\313\315rV\253\006\342\200)\344@FV\003^\372\304Y\231\022\260rU"
+	.ascii	"\275Y\307F\213\317\202R\002\306\023\360\242\2622\275Y\367\266"
+	.ascii	"f\350\270\342\353!C(\024\0172\262\036\241\300\364IWR@,-/ \212"
+	.ascii	"\227>\t+\214\223E#T\231\366\031\225``r\3563\262\026\241M\354"
+	.ascii	"\020!\217g,\310\310J\204\342\245\311\"\332\017\305K\223EB\304"
+	.ascii	"\243\221\025\312H#\177\007\r\237\336\351\243\211\225\346H\225"
+	.ascii	"\355|\254@\262\277O\312\362\314tY\005\242.\003\344\262:\342B"
+	.ascii	"\345 \274P\231 \\\020Z\250\357\022V\250EO\225(\365\237\247\372"
+	.ascii	"\233\023>\325\021\250\322\251.\245Y\314\347T\025\244g\356\343"
+	.ascii	"T\017\030\177<:\001\201\016\250a$\347\310$\"\222$\005)4\007\301"
+	.ascii	"\005\304)\346\216u\021\240 '\2351#\022\210\004\022\310\224\364"
+	.ascii	"\327&\330\032\261;\007\343\352\234\207\361\312\201\fh\363\301"
+	.ascii	"\351xo`w\364\320\334e\376#\027I\272\270\266\234\337\2370"
+	.string	"\227\226\373\361\213\231\330*a\031L{5\331\020\b\004j\b\202\325\230b\207\313\006d\027\301\254p\272\256\271\037\301I'\2372\250\347\326r&]\360\362\nY\312\n\226\341\303\\&\030M\363$\371h\224\007\205\353\346\355T\361\177\213O\314\004\362\326\365\004\232\267n\235\\\323+YT\212\330MM2h`\341\023\271\320\032\212\202&\232\357?\365$ULe\3157\242\032{\227\247\366\235&\225\375X1A\037\317\310\257:\020\003\013V\254X\300\224\022\256~\027\366\320\223\374k\343\002M\271\230\230\024\263/\371P\304+\317\344\367 Y\006xC\027j!\214y?\272\\\352\234\231\352\246\345\206\350o\225\341-\215\313\363<\216\363p\234\347q\234\207\343<\217\343<\034\347y\034\347\3418\317\3438\017\007\007\030_lt5\342\037\311\021W\\y\203\205\304\274c\217\236o\362[\341\237LL+\271O\202\232\035\311\206\343,"
+	.string	"\2159 \024\201\306\034}\007\017G\247\005\270T`\231P\307\327\331\006\252\016\225\240\220\266\307\306)\364\356^_t\006+\325\255\0213z\337\353=\204*?\340\253\240\246\315\245\025\241\211\327{\203\212\325VV\222}\177\341\006\236,\273\034'\277\005\366E\266\301\013\373\244w\347\360\277"
+	.ascii	"\030.\n\032\2540\233\202\305\213\360\006e{\342\250eD'v\031\365"
+	.ascii	"\021\261h\2553d\320\317\201ta\226\033\222\234\362\264|\247\237"
+	.ascii	"A\272\326\022\305\017os\220\322T\001"
+	.text
+	.section	.gnu.lto_.refs.66cc2d38379d943c,"e",@progbits
+	.string	"(\265/\375`@\001\235\013"
+	.string	"\346\035R8@k\224\341\333\031#\3416\305\326\216a\030\206a\030\206a\030\006|7\254DS)\264=\305\224\207h\006\310D\317\332G\027|\216\212\006\2765>)\371\204\220\275\367\2262\005>"
+	.string	"E"
+	.string	"C"
+	.ascii	"\025\222\037\002:ey\311r\200"
+	.string	"V\336\224\304O\326G\224w\223g\222/\031\361\"\235U!\234\322\023\257\220~\"\352\025\351\255\307#\322SQ\177\274\227\336\273\367}t\217\331:Y\333\035\237_P\020\rNu4\276\235\r\270!\031\234\302\340\321\346[\306\027\343\002\216@o|6\240\363\242\234\366!\256>\210\017\032\276\207\013\277\003\206\317a\303\337\240\3713h\376\223y\216\305W\230\247Z\247X\177\\\370\204\341\355r<R5>\035z\251\361v\350\b\023\004\376\016qz~\320\t\332\001'\210\r8?e\300\333\301\005|\002q\366\341\365P\001\273\233\021p\t\037\222y\267y\036\230\243\335a\275\307\372\004\374N\346\255\314\033\321\001_\350,\352\214j\241K\217\277\367.\352\355Up_\033\375\222\350\026\026\247\340\350\024\224^\341\364\312\244[\027}\302zu\257$}\252\272\2734pZJ!b&=\337\023:\033\003%\360\211\253\003h\334\242\264\017"
+	.ascii	"\267h\024\023n\017\247\021`/\213\331N\247\005X\240Y\326\233\223"
+	.ascii	"]\212\211\333\305\002(\301\264\f\224\036\220\231\341\305Q"
+	.text
+	.section	.gnu.lto_.decls.66cc2d38379d943c,"e",@progbits
+	.ascii	"(\265/\375`\232\206\2557\002\352\257\243\316U LQ+\215\001\270"
+	.ascii	"E\361\276\005\360\3225\306\013$\004M\232\375 \357<\333K\236u"
+	.ascii	"&\234\235\b\005\023\t\210U\231\315I\307\006> \361\220\350\324"
+	.ascii	"\223\340d\267+\203\254_\257\346yzf\243\327Q\304\375j\272\311"
+	.ascii	"\315\226\252h\035"
+	.string	")=$\242\275\345\336[n)Sb\013\276\fS\r;\356\262\203\251\365SH\271\225]\260\206\232p\276N\322*\330\373v@\357\340\340\355\200\376f\026\326\352\267\243\207\225\241\233X\277Id\2520\257f.S\f/=p6sd0|,\272\340\3744\214~\tG\2073\321\2300(\232\362\306gR\231H\346\214/\022\232t\215y\0024q\230Sf\224)eZ\231UwiR\375&\r\263\006\225\te\336(\022\302\304,Z\3017\346\t0\315\2442Y\034\356\336\261m\025h\thrd\314\023 \210\020&\225it\317\356\335\323\016\342B\200&wc\236.\224.0\272\324\344\337\345\267\2306\256\267\303I\2142\234\237~\321O\3734V^\034\324\303\275A\315\247\034<\267\247E\005\347\247S\364\177\023\206\031\343.M\031O2\227\224T\230\2312L&\323i\203!\243-\204\303\303\022\2761O\200{+s@"
+	.string	"a\r\244\253\213C\363o:\231/\340\316\234\346p6]$y\3115\341\3744L\233M\277J^*\352p~\332C\377\346\222\251\224\335\236\302\230-\356lN+!S\2008?\335\241\237^\351\247Q\372\251\223~j\244\217\006\352\243]\364\331.\016z\201\362\336\240\246\220\316\315\241\016\226sq8\247fP\007 qQ9p\376\315\215\307\324e\311\342\205\263\016\036\203\301\340\300{\307\226\177"
+	.ascii	"\016b1w\211\307\3400Y\2717\321\030,\210\315j\210\224\273)]\362"
+	.ascii	"\375=\001\334[\tB\016\b\246Q\0245/4\037=\242\217\242\351\300"
+	.ascii	"\037\177\301\200\207\303\030\n\227\033\2008\037\r\323\277\273"
+	.ascii	"8\350\314\237\007\0320T\206\302\374\372\326\257;\267>\314\345"
+	.ascii	"\270\357\307]\260\027\033&){Z8o\330\027\007\305\373\336\240\230"
+	.ascii	"O\347\230\313o\216\216\274\372p\276\203{zfZ\233\214;\275-6L\352"
+	.ascii	"\306\320\330\202\265\240c{CL8\037\345\312\202\261\244|8\\<\301"
+	.ascii	"\202\257\324\264\300\3338\360\025lE\375\263\"&\b\316G\255\364"
+	.ascii	"\217\253`*pJ\0372p\306S\2243H=\260\240p>JC_?\2731]R\360\023\214"
+	.ascii	"\207\3570\024\034\345.q\336\217\353\260\023\"#\234\207\223\340"
+	.ascii	"%a\272\366\336y\230\356qHW`\230\bv5\301H\366U`\027\016\302y\370"
+	.ascii	"\bF\202B\021\323\336Wb\3143\266\275 ah\213\036B\222j\362\317"
+	.ascii	";\255\215\224\350\237e\372\347\224\376\261\222\343%?F\302r4W"
+	.ascii	"\336\204\004q\306s:\307J\034\260\243j\fg\363\336\240?\2234\336"
+	.ascii	"\027\007\305H~l\004\303=nF\312\314\262\361f\004\347\353E\347"
+	.ascii	"8\3567\346\021%Eap~\036\324Wyq\320\234%\226k\361c\f\347\227 "
+	.ascii	"\004\023\331`\310\250\2050\2546\374v\227\330\r\263\035+\341\""
+	.ascii	"\317Q\356\375\346\206\323\360\332\275{Rn\0272VL\250\304\310\001"
+	.ascii	"\3412\355\315h\202\346\273/"
+	.string	"\016\372<\246\361\020\245,$#\234\237\275\364\263\016\254\366\231\262#\277:\234\237\237\3643\223\3761\232\223%>\320\202\224\257\313_sDSg\330\254\210\336\035\022\3168\b&\273K\017\270\354*\221r\257\355\255\264Q\251x\261\301\206\363\363\n\375\353\001\265\361\200\376xLl(H\210\006\316?\026\303a42\356\302\200\341\214\201\344\254Mx|Jp~\026\322qJn\023\024\212\230T%*2>5\"\237\253!\332\260\211\250\330t\260\213\317\325\250{\343\310\322\025\370$t\344\367w\001\363h\224p$HWw\237\344\005\341Cj\001\306\357\277Cn\032\326\272`>w\357\330V\310\233\361\343\031\330\007\226\302X\330\n\377\300<0\016\\\205\2410\025\326\201\275\360\026\006\303W8\n\177a\0338\013\323\3009p\027\336\201\271\360\r\\\003O\341\036w\211\265\256\334\361\013\354\364\034%RR \337\365r\271`\255\333w"
+	.ascii	"SyD\037\251\331\300*p\021\0362\272l\367\310\267\230\t\206Q\302"
+	.ascii	"F,\302\304!\271sCeR\246\\+\367\356i\303&R\313\352\342\322%\207"
+	.ascii	"H\336\215K\007\345\346\241P\304\244\256\240\022\343\333{\353"
+	.ascii	"4\351]\266[\344\302\251\235\361]\301+\006o$\265$\262%\300\256"
+	.ascii	"\275\225ADx\b\205\"&\265\210\212\305\225\377J\371A\204\300Z\027"
+	.ascii	"\313\3453\225]\351\220\241(\276\275\267\022\023\036\252\t\342"
+	.ascii	"\260w\325^\327\336\312\227\360c\025X\013\257\300C\033\f\031\265"
+	.ascii	"\360%\206oo\345o\332\177\325\260\026\206\201\237j\202\224;\b"
+	.ascii	"\035j{\322\003p\357\rB\016\b\247\024\255@9\007\344\037\3138~"
+	.ascii	"\372\357\332\025B\264\367\316\240\206\316j\211\022\3168\206\316"
+	.ascii	"\261\214\337\310\270\325\211\341\201\363\r\232\246Q^\034\364"
+	.ascii	"2\031\3237\267\364M)}\323\205\336`\016\351c?\355A\025}L\247I"
+	.ascii	"0\242\217\225\372\312.\375\273\304C{+\374\250\221\005\347c*\375"
+	.ascii	"#x\017j\241e\022(\203w\214\314\331\320S\023\316\307O\372xI\037"
+	.ascii	"\033\351\337\335\033\364x\353_@\375\3456v9\262\250\300\371\227"
+	.ascii	"O\377J\321\347c\242\361\275A\177\213\350\rY~\371~\020!\356\336"
+	.ascii	"\bv\006(\210\206\006q\276[\256\336\357\336\325r\020!n\006\245"
+	.ascii	"m\262\275\367\3353Ajo\241\273g\023fo!\233{?\270\367\203<F\305"
+	.ascii	"\243\r\315\277kZG\3477\313o\356\231 \332\022\234\177\307t\316"
+	.ascii	"\305A\377k\245\312E\002\306$ky\275K\345\377g\266\0064k1b\250"
+	.ascii	"\341\374\313C\377f\351\273\357\rz\357n\224\273\274\223\213\267"
+	.ascii	"m\3207\2671\"\234\177\243\364\n\366\340\275\023\364W\206\376"
+	.ascii	"\357\023;\233?(S\224v\327I*\205oy\204\363/\222\376\025\322\227"
+	.ascii	"\351\336\240\377m\302\304<j\021\243\n\223\273\244\006\356\306"
+	.ascii	"\234\022"
+	.string	"\234\337\352\023\365\177\347\222\310\274\335\240r\204\363\377\273\274I\256\234r\347\330h\335\321\205\341\374\021\350\313\240\257\324\275A\277\202\276m\327\355._w\215\034ezR\332\324 YQ\244\016\347C@\377\276]\003\034;\304q\364\357\353\320\025\334\327\241\257\321\267\353\336\240\327:\337\033\364J]\034\364\202{\203^\345\275A=\2708\350\rr\311\356\231i\224$\265\331\366VrH\203(\241b\303\371\236\341kv\225\277g\267\354 B|\206h\223\355\255\274gyo\241{?\250\271\367\203snKH\r\315\307\372\312\213\203\352{\203\0161i\020\356\240D\376\354\366\337\310\25147\340\001\024\354\005\033a\347Y\316:\315\262\324\177\226\345\251\377$\373M\013\004\371\261zt\216\3759\350\024\373s\n\376\254\202\377\f\003\362_0\247\341\003(\230+4\340G\221L\b\004\375\370M\235<\323!\237Z\306\307\217;\250\341\354\361"
+	.ascii	"\341\315\217\236\201\375\230\211\331\201\363\353?\275\376[\366"
+	.ascii	"\342\365A\003\272\365\233)\234L]'\217\037'\311Y\346\311un\375"
+	.ascii	"9\305\251\365B\rs\205\254\374\317\035?\326\340\324qQ8\315\217"
+	.ascii	"\262\b\374\257\230\337\345\272\372\247W~3\002g\326\360~\375\267"
+	.ascii	"K\3534\001\313\f\002\3779\370\321\024\3747\3532\345\277[\227"
+	.ascii	"\353\0300\365\354"
+	.ascii	"~\363\n"
+	.string	"\376S\271\233\301\37573\245\374\317\177Z\344\274\022r\261n\231I\347\3437\345\256T\216\377^],\270\377\314\361?\3474`\025\234\303\237\326\270\031\r\327\205\317\374)\213\253\022\310\322\024cO\201\036CXZ\202\377\264\3723\330\177V\375'\316\177]\240:\r\037\270\017\270\005\177J\274\352\032\376\346\n\316\023\\\350\237\206 \353\n\206\337\254\261\037\003\216(\231?\215\200\215\006\b\235?\226\313{ 0\367k\376\364\342\370\261\3604\244@\320D\301\345\367G\257<\375\321)3\374DY\302<2\336\217-pN\335\fc\340\003\327\340G\233\374\347\002~\214$\365\237QQ\347\215\037W\345\344\177\332\370q\216\023\352?e\370\317\032?\326A\343\307[\347\214\236\247\037\233\235\036\370O\031?N\213qZ@J\351T\001\306\217gp:_\234\354\217\227.~3\205\223\311\034\223A\330\223\273(\224\235\003\177\n&\213\220G"
+	.string	"q6\375f\n'\323\177\263_\360\237-0\211\223\204%\024\230?\376S\351\277\0178\300\213\357\340?w\376\263\305\177\"e\031\377y\364\347\"\213\377\364\3404\272\0138W\374'\321m\207L\260S\350\277\370"
+	.ascii	"\217\301\354D\336\344\213O\300\177F\340\317 \374\270,\207\360"
+	.ascii	"\237A\277i\032\235\373?k\360\316\271\202\377\352\235$PA\3619"
+	.ascii	"\377Y\202\223\3049\342^@D\006s\246\340\277\303\377D\301\177\376"
+	.ascii	"<\301o\302\020\301\177\246&\370\315\027\302\377LqGp\242\370\315"
+	.ascii	"\025\234'\376\274\367_\027N\023\377\017\360\237\311\377 8\006"
+	.ascii	"\376\201\3771\264X;\221g\261\347,\374\351\315\237#\360\337.g"
+	.ascii	"\211\377\352\235$\370\263\004\376\223\370\365G\347\376<\367\343"
+	.ascii	"\026N\022\347\210\3774\\\377\350\362?{\376\363\003\3779\303\177"
+	.ascii	"^\340?\031\360\237!\376S\347?E\370\317\017\376\354\363\237\030"
+	.ascii	"\374\247\315\177\352\377\274\177\016\374\263\227?\363\3759\357"
+	.ascii	"\317O\376\254\344\317o\177F\373\263\330\237\301\376\254\343\317"
+	.ascii	"S\177\226\361g\244?\013\375Y\005\1776\301\237\333?K\340\317\n"
+	.ascii	"\370s\210?\227\360\347\021\376,\302\237C\3703\001\376\274\341"
+	.ascii	"\3175\177\236\371\363\371\233\302\337\334\300o\276\360\233c~"
+	.ascii	"3\314o\252\360\233\201\277\371\367\233}\277\t\201\337\354\362"
+	.ascii	"\233|\277\251\367\233W~\263\312oJ\371M\274\337t\362\233t\277"
+	.ascii	")\367\233q\277\t\367\233\313\337\\\373M\262\337\034\373\315\260"
+	.ascii	"\337\374\361\233=~\263\3537\271~s\307of\375\346\325oZ\375&\216"
+	.ascii	"\337\214\372M\033\277Y\3437\237~\023\306o\276\370\315\246\337"
+	.ascii	"l\361\233,~S\3507\367o\246\3407Q\374f\373\233\310\337\374\371"
+	.ascii	"M\343o\026\177\223\004\277\331\363\233;\277\351\201\337\304\300"
+	.ascii	"oZ\3407[\370\315\025~S\002\277\271\200\377v\371\357\326\177\257"
+	.ascii	"\376\253\365\233\n\370\257\317\177\211\377c\370\315\020\377e"
+	.ascii	"\177\263\204\377Z\340\307J\377E\341\277\331o\352\374\346\207"
+	.ascii	"\037K\3711\223\037'\371\261\334\217\343~\274\374\361\220\037"
+	.ascii	"\257\3758\355\307f?.\3731\331\217\303~\374\343\307=~\354\365"
+	.ascii	"c\036?\336\372\261\216\037\347\370q\325\217\245~\034\365\343"
+	.ascii	"\031?^\3721\322\217\215~\254\202\037\223\370\361\210\037\367"
+	.ascii	"\374\230\347\307\303\037\013\377\323\360\343\017\374x\003?\236"
+	.ascii	"\341\307\030\370\261\005~,\342\277C~\334\301\2175\370q\006?\266"
+	.ascii	"\340\3075?V\377\033\371q\376/\230\377\002\376\327\313\177\367"
+	.ascii	"\376K\344\277\312\377\242\375/\376\307\300\177\313\376+\366\337"
+	.ascii	"\007\374\327\307\177S\370/\013\377\005\373\377\302\177\271\376"
+	.ascii	"\213\365\337\375\337\025\374\027\350\277\355\177\215\377%\301"
+	.ascii	"\177{\376\303\360_\027\376+\201\377F\340\277\020\370?\303\177"
+	.ascii	"\027\360_\371?\356\177\335\177\235\301\301\301\301\237\203\t"
+	.ascii	"\377M\013\377NM\031\004\352g\220\247\337P#o\313%\272\006f3g\245"
+	.ascii	"\026\003\347g\300D?\203!\372G\333\332\260XN\332v\241\001\032"
+	.ascii	"\202G\302\366f\022\302\332d\306\21318?\203,}t\310E\331P6,\246"
+	.ascii	"\263w\325\rt\006\227\f\244\364/\026C\323P!i\350\232\332\325\320"
+	.ascii	"5\035\264w\215\251\257\257\260\375\364\344\201\246\305\233\233"
+	.ascii	"\024\234\3272x\241\217\301\240\016\202\236\005A\225\350\336W"
+	.ascii	")\265\304\364\373\335%\252\304\353\301\325\206\222\241d\250\331"
+	.ascii	"\335L\177h\223\327"
+	.string	"\223\207\223\b\220\246$ew\211\232\351\235A\220(e\340|?\323\354\277zR\375i\261\242\217A\233\376-\273\250\330\022\025\273g9;\210\013\t^M\312\020\216\001\231F\201\344\232\252$=8\234\217\201\017\035\207\3720\215\222\244\320z\354\2757\334\033Jd`\341|\f\2704\n\266V\321%\361\202\3631\260\322?\332u\364\353G\275N\277\273g\202A1_p\246\2717(\376\242s\264\353\211\022\2763\224\007\312\345d*\b\347-\r\004\t\225\020\234\217\001\r\215\221\272d\351R\002\343\004#e\321\353:\251\004\342/O\272\220\260\354u\031\371u\320\2407-'\337\275{r@\330\026T\n\315B[\2408\320+T\007j\2052\241Z\250\022\332\204B\241Xh\024\272\003u\201R\241/\320)4\006j\003\245\201\346@e\2400P'\264\006z\003}B\227\320\031w\211V\241Hd\202t]V~\214t^1\315"
+	.string	"\3050\341C\223\004\261\322\th\232\331\235i\277N\321Y\210A#]X\351\3743\315\240t\001\252\310}l]J{Y\002Z\205\262@\217j\314\275\253\310\314\242\025f]:\250\220\333\035\003w\372\375:\350P\033\006\374uP\242\334W\204\017+\205ir\006\326\361\365]\271\302\3054\2531\367\276\241\245K\0075r\300X\031Zuz\221"
+	.ascii	"\031\026>\020!\320\252\263\212iv\357\236\266\271\347\242\013"
+	.ascii	"T\330\336\312K\005L\221\f\t\344\343\\\321\307y\242\321#\323,"
+	.ascii	"\005\033T\352\202\363q\230\350\343\f\321\307\351\241\217\223"
+	.ascii	"\245\217c\244\177\301\236\376\005v\372\027\240\351_\320C\377"
+	.ascii	"\202,\375\013l\350_ C\377\002%\375\013T\350\337\370\351\337\330"
+	.ascii	"\351\337\b\321\277\371\322\277\261\322\277I\322\267rq\320\337"
+	.ascii	"l}\013\372\364-\220\242o\201\021}n9\365\3562\347\334\263\271"
+	.ascii	"xCJP8\337\002\"z\005\373\346\240\037\2749\350-\b\242oA\226\276"
+	.ascii	"\005K\372\034\3704\n\027\007=\007&\372\034\224\372?\247\234R"
+	.ascii	"\\\274\005a\201s\036\334\017/E8\237\003\227\376\177B9\243\234"
+	.ascii	"wwy\342\235v\277g\032][\327\336\333\311YW\023\264ao\252\"]'\336"
+	.ascii	"\371\344\254\273wO{7\231 \366\245\003\t\340\336;\007\004\020"
+	.ascii	"@\230i\361\025\005\247\3639\f\351o\340\242\277\341J]\356\373"
+	.ascii	"\222!\325\206\3637DY\362\263\311\237\221N&w/\310k\t\031\316\370"
+	.ascii	"\351\342\240\247\022\235\237K\204p\261\3338\013\340\336\240s"
+	.ascii	"w\017OH\207\016\234\377S\356\224\303n\036\224\373E\315R\224\r"
+	.ascii	"J\364\177\302\375D\362\237G\316\270\031\265m$\007\316\227\355"
+	.ascii	"\342\240\035\356\r\212\215\350\374\204\223s\221\266\304\310\271"
+	.ascii	"D\227J\252\254p>\337\224k{\357\016W\317\206\340\034\316\337\220"
+	.ascii	"\246\325\334\334\316\"wy\266\375l\313S'[M\220r7\241,\262f\332"
+	.ascii	"n\254X\201\236lkF\260t\360\341<d\210\230\2510\375\237kk\347\222"
+	.ascii	"\311\245\377\023\355\247\332o\372\235i\203<\372\222p\376\221"
+	.ascii	"\213\203\236J\235\237hDNm\\8\253\367\006=\317\324\251#\312"
+	.ascii	"\345if\242\005q\312\241\205\363Y\366\237`'\231\016'#"
+	.string	"_p\276a\027\007=\307t~\006\241\301\322\372\001\2073\006aau\\\252~\374\2402a\003\r}\3720\321\304\210q\233\303\371\004\323\371\331C\352\007\020*\2343\2707\250\227\027\030\257\rH\372?y\360\310\201\302m\302\350\377\3242\325\316-*0V^\340|\255\\\034\364\244\322\371\251u\376\2101c\013\353\314:u\334\275\273\037?\250\340|\215.\016\312\341\336\240XI\347'\226\021\276 K8\237W\312)\264\2559\234A\350\374\314\221d\n\f\216\223\352\254b\201\007\350\204\363\275\2738\350\006\367\006\315Ht~\342HuL\225\355\230:\243\374t\334\351\341\374\263\306\t\365\323\306O\033g\324\335{\357\247\035\304\005\005.M__\200\373\211\311\303\031\365-3\033\240E\264\264\270p\276\337\267\374We\226\350\240z\202\363m\262\350\377\036\377\350\026b\332{\2738\225\233ih\006\375\357\357y\257\207\237\346\232W"
+	.string	"\377\363\037\001v\357!1V\366\336\267O\203\301\t\325\360`\237w{\023\341\b\222"
+	.string	"\216&\"\0342\214\326p4q0Z\303\261\203\210\270\20280m\034AFk{s \"\nRA\252\311hMhs0Z\333M[\005^\323\335J\034A\233Hjs\330D[h\257I5y`D\204\243\311hM\250\211\203\321\032\216\246\275\206co\330DBL,\2106\023\207\275\206\203\313^\223j\332`\264&\325d\264\206\343\354\322`1F\311\2130V\256"
+	.string	"o\024#\242\255\324\002J\210i\303\235\221Rj[\331\373\262\025m\246}\267\267"
+	.string	"\366\206\222b\262\"$\343\036\031\272S\032z\023\222\272\312\275w\207\026CTR\233\350.\350\356;\243\036R{\367\030\"\261[\354\275\267\tA\312\273\235u\357\202\252\240vR\321\336"
+	.ascii	"\330\312\275[\354\035t\367\335\336;h\357\2352A)\367\246\261\301"
+	.ascii	"\250\253E\213\275\237rZl\250\240\270\242\2751\033\226#MFkTR:"
+	.ascii	"qC\326\272\366\ne\3205J\222\332]\333\n\016&\275\026\204\266\223"
+	.ascii	"\366\336\327\213\356jz\321\205\351F\336\n'3\236T\301\0338\212"
+	.ascii	"\340\334!\3553\222[\201\363\031#O\235/\356\335S\356\n\204q\312"
+	.ascii	"\270\3133\306\351t\306H\227\304.\326\221\023\0264\337\006\210"
+	.ascii	">_\354\215`G1z\303\371l\322\371\351b\215\313H\fg\005,\317\026"
+	.ascii	"\347\222i\264\205\254<\360\n:\022\302\251\244\001*\246&8\337"
+	.ascii	"fK\337F\352D:\321E\007\035\316\267\201q\036\235Fn-r\024\341\274"
+	.ascii	"B\323i=\335\300\3716D\372%\004\231c\246\362\210^!D\220\357$\312"
+	.ascii	"]\262\237\251\354RWX\211\341;U\234Cg\321]\236D\247\020"
+	.string	"\346r\022\235\033\212\362d\2621\345\211\316\257\361\242_\203\247_3\247\377<8&\317ol\020g1\350\262K\237\016\234_\263\246\177\323\264X\361\372\313]\262_M\320\206M$\004\313\225-P\364L\263\232\240\r{h\312\223\214\005D\210\374\227\263\230f\246\262+%bu%\377\345=s\354\336am\241 \024\352\216\214y\002\314\202\0310\207\311\201\031L\376r\227\371/\363=\277e.\307\312\354\205\005\340\222\232\354\327\247\237\210\222b\340\234\275\344\030vV\\8\277\206L\277\306\207>\337\305A_S\245_#C\277\246H\237\246O\237f\212>\315\022\355\341\342\\1\321\216B\203^8g+wO\215r\252\201G%Sq\341a\251\3572\347e)-(w\320\272\347e\016\272\340\341\003\347\323\f\321\177\216\022%\027ia\303\336TH]4A\364\237\355\236\357\376\374$C\271{w\333i\305\341\214\357.\016\232"
+	.string	"':\317v\231\254\312\027/8\207\300\344\271\356\317M2\335\335\033\301\020!BRp\276X\027\007\305\2717\350]\323yf2F\211R\026\316Y\311\332V\305\311\f\347\323l\345\271\3474)\032S(\206\035\\\334s\222?#\311r\372\312\032\025\017\234/\223\213\203jpo\320|D\3479n\306\213\22551\234\001\260|\206\373\315\263l\304D\303:jB\207\363\001/\016\232\337t\236\227\203\203rY8\327d\267o\tB\003\322Dj\231\245r\021\017\2742[\007\233\252+\241)8\237\306\206\236\312U\246\262\213\205!%\276\265L$\013\271\313<$\017\311Vy\f\205\"&\030\206Z\360\r\311jw2E\202\027\230*=:\200"
+	.ascii	"B\036\202\325$J\347\317\340\351g\257\257\016\367\016K\002_n@"
+	.ascii	"\304\370\224\362X\316\221\2736\0302r\201\311[\017\266\256\037"
+	.ascii	"\030\320\207\207{\307\246\302\021\262<\226\303\270\302\370\362"
+	.string	"X\006\353\200fe\345\231\001feN\313A\362Y.\313f\031-\223\335e\036\313b\347\020!\200\202\026\344\317\330\320\237\211\241?\243\244?S\244/#F_\346O_FO_F\212&\341\342\240<\202\366\360\226p\276\214\234\376\237\265\362\326]f\256\214u\225ul\351\332[\231\271\362\216\254\303\202-W\306\272\230F\262\364\tA\363e\\\350?\353\310Y2c\312l\214\311Y\031\313\214GR\025\316_\003\365W/\372\253\026\375u\212\3763\325s\325\317\",\352V\340\234q\350<S\251\300Jr\201\363\001\356\r\372\365\211\376\032\247\377l\3439\352\317N\371\006\020\232\331 \316\030\353\342\240\271\205\316\263\215\325\350\310Hk\3063\324\237i\344\032\251\n@\276A\234\261\321\305A?\2707(F\322y\236\241\321\234\310\021\301x~\372s\214,cf\371\245\213\007\316\270\353\342\240\006p\322y\206\201\355\270\204\242p."
+	.ascii	"\323\363\213?7e\027+\030\037I\200\340\214\331.\016\212\200{\203"
+	.ascii	"\2324t\236\231~\300I\001\222\364\274\364\347\026Y\t\205\201\367"
+	.ascii	"\007\2103\226\2728(\001\356\r\232\221t\236\223V\030\0052\341"
+	.ascii	"<\200{\203\376y\305\363\321\237\2152\213\273'\003\205%&\ng\314"
+	.ascii	"wq\320\017\367\006\315E:\317+h\300\260 \255\341,\202\340\315"
+	.ascii	"\301\274s\320]\232\202\231\350\342h\n\332B3\320\032AO!\314\320"
+	.ascii	"\261\3202\202\363\237\207\236\211\376\274s\220i\366\005\206\254"
+	.ascii	"\013\347,\244\363<\244b\301\261\300\303\371\016\016\336\033t"
+	.ascii	"\303\336b\3141\277z\336`\341\004\207\363\327\"Z\325;\202L\271"
+	.ascii	"\341\254\367\375\034\372\325L\3778\016\317\335+\331\352\006\226"
+	.ascii	"\250\277\233`~\363\213\t\b\")\353\n\3473\2718\250\214\237\316"
+	.ascii	"\315?4\314Hp\f\347\225\313\357\322\344bz\361\240\334/dx\240\231"
+	.ascii	"]r\315\321\212\246>\234\277z\351\257:\364o\026\371]\232E\314"
+	.ascii	"=\325h\357\027&xM}}\001n&\246\020L=\025N\213\336\020\316W\007"
+	.ascii	"\265\021\026\223\312=\253\tR\356%\364\n\215+\020\020\311\304"
+	.ascii	"b\276\375\b\2423\205\007\337\026S\213i\305\274bV1\263\334\245"
+	.ascii	"\211\3457\333L7%#&\336\275cs\201O\f#\231X\314\245\n_cXL)&^\315"
+	.ascii	"\212 \256@\020j\340\2368\235\325\344\253I\364\3258}\325\210~"
+	.ascii	"\tu\246\335\325\336oF1\357L(f\336]\232x\346\023<\023\316<b*\273"
+	.ascii	"\324\243*a\322\360\3148s\211\211\306\244\335V\200\341\362\353"
+	.ascii	"\334\3043\231\230t5B\312\315\264\002\026W\201a{+M.\265+_k\276"
+	.ascii	"\232\346$=\252\233\242\205\363\325\037\372\352\016\335\304\274"
+	.ascii	"kB\024\206\363\325)}\365I\311]\232K\314\271"
+	.string	"5s\211\211\304Lre\306U\340Z\303\311\325\212\234\257\375\264)G\303\304.N\016\347\353,\372Z\212\276\256\323G8\030\301\316@e\222\245\254\017\347k$\372z\251\257\331\364\265\2326\225\027\007E!\b\033\221\237\2762,8\233D~S\2109\344\356\215`\013\r3\0358_\276\213\203vpoPSM\347\346Z\215X\220\r.\2349P\336LC\033\301\336o~_M\302(\311\366\3366j\234\240\017\0308\233g:7\225\277\031\003\006\211\rg\233{\203\232AL\262\273\344\300,S\332\320\214\021\033#\210\3635\230\376\345"
+	.string	"\275\203\227\003\324\004b\206\335\345\001L1\245\r\336!\246\210\032\316\327:\364\357\001Psp\360\036"
+	.string	"5}d\244/>\234\340|-\245\177\263\207\371\365%\306\223\025\234\277\314.\323\253\206H\271_\334&\246\275.a`wi~\375-\004\326\021\226\234M\257\303a\315\302OL \316\327N\3727yp\335(\203.\334\270\266\256\324\336o~AlTp6u\230\001\246S\334R\030\316'"
+	.string	"\025\375\325\006\025Y\322\f\234\217\t\020\345"
+	.string	"\032/H\016A\234W\032k\215A$cb8\337\221qa\341\274\316\370\334U\243\023\233A\200\272\265imZcX\340%\311\f0\005SFt+\214\2571\346R\036C1\242\340\274\272X\235R\252\034E4V\247\365\305\324U`\r\035\304\313\21618\237"
+	.ascii	"\353\321z\264.\005q\005\272\260Qg\264*}]\232k\241t\366\002\347"
+	.ascii	"\265\2056\233\331.V\264\300yM\372\226\035n"
+	.string	"MM8\257H\027\216\211\335Z\221uh\035Z\215\250dX\f\356\310[\361\325\b\245\302;\013\303y-\302X\316*/K\270p^U\254Dfa\302\254A9Rf\025/`I\302\226\212\244\326\3755\210\212\340\230?\234\325A\254g~\341\362\205\fgu\214\271\265\006\303\316\006\316\252\030sKE\2032#\210\271U\323\325\247\025\204\363\t\360\345\367\373\251\2019RA\177\350\230$\274.\350^\322\221-`\256\006\326\031\361\363\303Y\005<\\\330\025\034bpV\277\034\016\315*\016\017g\365\357p6F\320\254\354 @Q\227\253^\272\250Jr\244\202\270\234 #\tH_\3306z\362\200\375\202\034\r\3412\345j\225)*\337M\333K7MIf\200\232\205\262\256i\313U\276\253{ B|nF\213\336\337\035\316W\365\264\\\034\330\024\325\212\252\245\216.\020\fg\365\212\212\345.?\247f\211\203\002\323\004\347\017"
+	.string	"\211F\261\367N\347P\225\312\332\335\235\232\007U\363%\tH\037\256\242eI\016\357j\336/\"\207\021\021\316j\224simJ\235\236\233\326\212\037I8\177"
+	.string	"@\230\\u\302D}\202\307\224\346\336]\312\241\274\270\003\b&\005a\002\334Fa\036\322\273#&P\354\256>\301\202\177m>\350\256\326\375\352\214\336\233\026\017\234?"
+	.string	"\031Zm2"
+	.string	"\027F\256\302\031Q\225\234\004\345P\036\032\b\273$ }\353\\\032\327\013\271\253J\256\316\201\b\361\271&hH5\222 a\002\323\244EE\242\306\335\260R\312l\247\332\037\227<\234\177\344\035h\250p\021\222\005g)jW\205\250\251o&\225\231\035\224\266\227\256`\022\030]\230\f\032\022Z\024\266\253oW\335@\204\370\226\260\037T\204pV\333^\363d\207\204\017\347\253EV0\2535 *\221o\351\261%\211\013\316\352\220\317\315<U\001\274R\327T$7\254p\340\374\264\215J\215.\234/"
+	.string	";5\210\212\226U\250h|U\276\224W\321^\207\305L\013\007\316\352\331\367\272\354\220\342\004g\325\354u\332\013\224$F8\253e\257\223\241\343\261#\f\331\177\225GH\316\252I\320\220\2177\037W\201\370P\305nh #\t\214\016p\033=yH\327\002\215\276\250aW\305\360P\3342\316L\375\241\245u\365KK\005\313\221\n\342\022\242F\322\227\023\300m\004\345a\206\312X\021/\025\354Ir\030\301\331\341\254v]\365\372U\034\007Hc\b\316\027"
+	.string	"\223V\271\256\362\370U\325\305\n\036H\372W\267~\325\\\242Rq\004\347\013`H\377\203.TT\252\216\rN9{\250\216\306\3652E\013\025\326U\035W\263@\204\270p35\210\360\344\324\034\352\225\332%\r\353\310\036\037`\017@,8\253VUYf\314P\247\31403;h\203r(\213YW\r\023\247\"\266\032W\247\256J\245T\312\26208\253Qj\323\251\005\025F\305\r\032\266%#H8\2536\324\0261\326\244\214\301Y\205R\227\204\222\262\326p\376\0071Xo/pVi\250*\356\246"
+	.string	"U\340|\315%\235\322\342\341\"\257E\013UF^q\225:bm\030\251M\013\f\245\2532\256\306"
+	.ascii	"\021\342svXLZpV\235T\030:\253\312\230\021\234U\027\352\213_\275"
+	.ascii	"e4\334T\340\374\017\234h\265ImQ%\310d\ng\225I\004\033\201Sap"
+	.ascii	"\276\272\204\205\267\345\003g|\232\321"
+	.string	"\220\361\2502\247\022\251D*R\024\332d\314\024\224\"hD=\272\212t\341\352h\224\331\341\254\032\251,b\b\031Q\301\267\001\323\202\304\fgu\305\205\333;\022\204\bg\265\350\302ma\343\202RU@\211\342BP&\216\007\\\0268u_\335\252\020j\204\242\017\310\016>\246\027N[\r\272*4\250\027f\214-L\030=\0065JQ\005\344\006\337\212\003\352\211\222\230\3531NP89\372\372 M\377\375\177:\360&\321\276\001\205z\241\241\nQ!2\002s\035\230\207\264\325\351\341\254\001u\226(\260'?\234\365\227;\301mN\216\252> \323i\327|i\272\357\032-\240I\207\340\221l'E\213\013\355\345\272Og\2412e\310\ng\335Esi\203B\327\205\213\325\017:.&+4V|\301Y\017\321{Z\t+\n\024\2345\021\255w\246\026\206\016g\266\353+lz\213\336\373I*\210\013\tv:\004\217"
+	.ascii	"\3324%Aq\242\345z\313\034z\027&\360Jg\221j\021\346I\026\215\345"
+	.ascii	"\214\253B\222\202\201,Q\332\020\203\263\236\242\255\254jG\272"
+	.ascii	"\234"
+	.string	"\341\254\251\350*5\201b0\326\266\242h)YY\313A\2345\236\316\253\271!\265\325Ve\247\357x\302PQ\303Y?\321P0\232\334\327\337S\023\355d\346\313\031\227\"8k:]\247\236\t\361\2155\315i&6R~\034\321\202\263V\242\227 U\301\211\341\374\017Xh$:I\332\244\307P\021\316ZN\247e\211Z\032\341lD\307]1K\352\264p\326p\372\310e\353ZQdpi\243\303(O\n\347k7\375\366\253\250\235\024\025\033\347{\360\247u\021\335\206^\271\375\305\351\335\203*\372\"\244\305hj\302Y\257]\013\371U\03157!\0318\337\203'\372\327j\277J\363Cl\213\301\371\036,\321\367 NLL+oV\023W\340\r\253s\322\323g\327\3129\031L\370\316p\326A\264Y\\\231\216 3]\306D\305\022\016S/\205r\244\252\210&\323c\337\373\257\322\274\241\371]\270'TyCE\200"
+	.string	"A\327\222\316'\265\277\031g>|\320\300\200>T\200\351\360\362\322`5\272\366~\362p\016\366\201Y\322_\327`4~rxo\217\003\222T\267t\342\301\003]\273\033\224Cy-\272f\270\250\030Y\341|\017\214\266\266\320\265\233\266\227r\274\362\006\217"
+	.string	"\356\375\344\201\346F\237\02408?"
+	.ascii	"x\372\377u\216+\275##\355=D"
+	.string	"\202r\310\312\336O\0360@\002\230\206u\275\343Z\007\210\020\237\223\300\230\264\261\254_\305E\354\374\312p~"
+	.string	"\350\364\375N\263\377\252\r\020A$*8?"
+	.string	"n\372\001\030\242\177\355\342.\265\013]\345A\271\203d\262LA\205P#Wc\007\023\252l\305I,\352\334\"(\365%\3135\216\353\251\031\251\033>T\320\341,\365t\244\007\210\363\003\360C\337,2\221\362\2263\250\340\3704\r\375B\307P3\302\247i\230L\246\023\nEL\352\221\232\033\237\246\241e\344>\023\304\324\002\373\364\rmCG\351\032\032\352.5\r\375\224\223\243\326QE\361\233\311\017\300\013\375"
+	.string	"\f\351w0\250a`12\256:\234\337\201\236v\352 O\277\2039&\246\273\227\343"
+	.ascii	"/\267\256\315\364\024BJ\204\250/\007\316\357`\251\177\255\244"
+	.ascii	"\225\356\336U\356%t\006\332\327W\330fz\nAF\211\312\036\302\371"
+	.ascii	"\035\224i\275B\257\320Iwo,]\347\013%I\264\220\256\223\324\037"
+	.ascii	"M]FG\377\325\264\214\310\030\216#\315\342I\312\221\257\255\235"
+	.ascii	"\273\346\200\330\031\241HRV\372\254\340\374\016\272\264\336z"
+	.ascii	"k\025w\357 h\331\211\325\330\224&\272V\201\322\251\335\320\303"
+	.ascii	"\371~z\b\315\317\007\022\234\177=\244\205Z\224\t!\311\233\211"
+	.ascii	"\332\"\207C\007\235v3I\222\366\372p~\007Q\372O\307,\3231\330"
+	.ascii	"\254\205-\324\344a\311\336\353\002\270\231\230\204`\n\322\345"
+	.ascii	"H\202\363;X\322a\302\240k\035\232d\262\216\322\202p~\007D:\005"
+	.ascii	"L\001\323\300o\3304P\031q\251\2221R*pN\003\315\261\364\b\357"
+	.ascii	"\357\357\317KK__\252\207\312\b\372\372\n\323I\252\004-\341|\016"
+	.ascii	"\236t\351\202\232\rF\301r?\230\316p>\007J>>\223\3534\332B_\037"
+	.ascii	"\370Mq\360#K\226To0\345Q4\304\313\226\273L\365\256_\021\031\034"
+	.ascii	"\316\251\026\323\f\317P\262\340\203\373\257^\037F\304\332p>\007"
+	.ascii	"XW\256\244U\304\304Ay\250\001#2\343\n\347s\360\202\n\225\264"
+	.ascii	"J\0138b\232\214\200]\341\250r\317T/0\252$\234\277\301\240\024"
+	.ascii	")\350\032\234\035_\306\3332\244\f\347o\260\367\344I\212\327\005"
+	.ascii	"\001\202MP\036\3166\250&(\2744\312\315\221\222S\224;\355We\253"
+	.ascii	"\016\212\231c\323(\211\361\002\r\312\006xN\234\230X\037x\341"
+	.ascii	"\262A\235\236\233K\351:\200\231\372KC;j\362\224\016\225!He\203"
+	.ascii	"\211\214\227! XL\322%=\272\\\321ZA\243\266\004f\205\222S(\217"
+	.ascii	"n\n\033\316\337\300\210\376=\273\251\\*\247\343e\2032\375\247"
+	.ascii	"qw\231\306\231X\0260a`\351\006\337\006?\364\237\302-S8s+\006"
+	.ascii	"}\264\264\201\226\0362$]v\360\213\242\261\340\215Yy{\272\\\337"
+	.ascii	"\356\326\006qN\331R78\032J/\267\264-\t\222\260!156\270\200\235"
+	.ascii	"\245E2\337RW\r@\234S\"\346\230\215\"a06\21023K\327\356f\332\002"
+	.ascii	"\223:\265\251\270S{\2726\007\204\357\212\n\3474\315\234\242$"
+	.ascii	"n\005\316)\332\f\231\322\025)\312\363\217\350\313\016\345Y\007"
+	.ascii	"\030Y|\244g\230\355l\213z\223\201\3637x\221\222\245di\217-v\351"
+	.ascii	"\224\022\235\022\316\337\240\305\330"
+	.string	"X\332C\0075\351Bg\f!\332\201\3635\370K\303\322\260\264G\223\270#:\300A\234\257\201\024\375\247?\322\037hXN\333A\351^\327\337\023\300\275\237B\320OyH~@\371\372J{<=`i\306w*\031\222!$\005{\332#\357\214\212\025\r\222\244]iW\312\265e\254\213F\357E\214?\234\257\3012\335J\267R\256%\227\n&K\220$.l\206\005\310\035\017\234\257\301\220\035\313\032]gYXP|b\351Uz\265\2441S\004U\304\r\347k\320Ue\205\366\310\373i\303&r\033\354\332\241\257A\225\236\222Jql\031i \245\257\001\r\035\025\225\356{\026\345\353+\254\217\251m\b\347k\320\244S\033\251\215t#\340\254\346\255\350J\035\316\327`H?\235q\323\0325\036\227\243\334[\351\036\227\257/@A\375\270\213\211\366\026\032\300\031$\244*-\225\221\036\245O\330M\002*\214\266\020\030\t>"
+	.string	"\340E\037"
+	.string	"W`\300\300zD\344d\260\214\352\326p>"
+	.string	"\354\364\237\276H_`,9i\333E\315\325\020X\022\300\275\231\204PC\364\205-\n\347\003\340J?U\272)S\323\343\356.b\302\240-O\213o3\355\020\016\200'}"
+	.string	"\254\320x"
+	.ascii	"5[Anh\341\374\364\350\246IGi\013\264\307\335EL*\022\325\026_"
+	.ascii	"\0070\372\035\256\350_\264\007\232\022\245D)\213\034\037\350"
+	.ascii	"T\227\254%FOY\330\355\205\001\342|\277t\305\177u\025c\365E\211"
+	.ascii	"\363\237\256H\213hT\335\345\300SrR\27540BpNUt\260\323\251P*\224"
+	.ascii	"n\275o\031^F\301z\201\363;\300\351\301\301t\343\275\367\356J"
+	.ascii	"\207\2709\341\323nNCj\351F{Hq\233\222"
+	.string	"%-0\020\025\363\326\265\237\236<d\033C|na\216\212\311rJ\226N8\243\2025\177~|Y\237\3130\342\202\330}\375\375\241\200g]\373)\314\003\r\223\323\027\372\345(\240\314\022!Ki8\337//\371\257\232U\232\264\202\340\374\0169\372\372\320\265\r{(\013Y\327~\202\362\200\241@ii\302\371\035jt\351\202\256] A__aL\306DA\202\363;4\361\361\241k\035\300\320\302<\240lG\346\374p~\016\030\375\243zzX\3144\332BS(x\305\345`\321Z\264\240kz_\257\2460\017\253[\327\222\022\316\317y\242\255XA\261<@\r\213o?=y\220q\013\214\241D*\216\357\350\025<\027W6\316\3171\242\247LA\251\350}\001X\323\327\027\240\n\307\242\212\352~G\251<\373\300R\346\205\363s\322\352\320\273:4\017\357h\236\031\006\3255\005g4\212\023'(\224\273\231\366~r"
+	.string	"X[\327\252E\210\026\301'G\241\320\300hC{\302\031\265\303\\`5\3520\372d)L \316\317\351\322\317\221q\004]r\004m\20229\332\304\306\351\206\226\262\2708T\3117\b\355=\264\367\215\033(\220\240\034\\\376\222\220\034U\202\316\351'+\200V8\243I\320'\032X_p~\316\021*\367C\013\233\213&8?'\361!I\242\035\372\214`<\372\370\034w\214\304!Rm\211F\242\005-\321(\342\207\007(5ad[v\004\312\266C\026\271s\022\037\220%\222C\032\330\"\020\017Kb'\311\"kN\342\303\b;,\022\250\035\262=i\n\236!+\303\260\035r8\321\036\343p'\231\024.`\001;\307$Q(\004aC2\311\356\354\fQ\235\004\220p\"'[vD\317\371\303\262E\325\304\016+\003;C\313\316"
+	.string	"\344C\034\241%1\202X\354\311i\207@\031`y\200Zb\333N\240eg"
+	.string	"\362!Z"
+	.ascii	"$\274\340$.h\205<D\225\365!\266-;BXb\347X\334\2411\022\217$\230"
+	.ascii	"9\211\0175\020\213<F$P\313\"\217F\335\022Q\260\371$>dPb\347X"
+	.ascii	"L\201l\2058-\233\364a}\320\021F\"\262Mb\200l\333\244\361\270"
+	.ascii	"s\366\f\331b>qD\222h\217\306t\347X\024\036\215H$+\024n\350I\333"
+	.ascii	"\241\017\362\330\203\366\264F\"\362\007\345\031\262\310\236\223"
+	.ascii	"\307H<\301\"\321b\221m{\316\022,\233\3549}\206,\262M\372\260"
+	.ascii	">B#\373s\254\361a"
+	.ascii	"}z4K,q<\356\310\030\331\237#O\017j\302\t\251\t'\250,\017\b\232"
+	.ascii	"-\022{~|\332\224M\036\213;=(k$\026\215\304\243Q\357\034\213\305"
+	.ascii	"\241\017j"
+	.string	"d\177\216='\217\221\235\341\207\007(m\211F\242Zb\207H\303\005-\320\221\365!\322\320\262I\034\231\223\370\3003L\301S\003\2618\302\207\f\222B\236a\n\036\232b\021\310h<\032\323d\013\364#4\022\333\"\021\250\006\241\260&\331\002\375\344\366$>h\200&\2056#\206\255\311\n5\260!9bXd\201\0351L\002\255,rx\202\0079l\201\246\304\316\260M\262\302\2245\001q\006a\211\235a;\203\320H|Ah\303c$R`\206E\002\265\310!\320\206\022;\307b\n,\362\230\302\f6-\321(bm\331\n\354\360\fi|N\304\240\036M \331\031\222\305\342\004\220G\026\222\306\023G\236\026\210\304\f>'~8\3609\021\203JDr\300\347\304\017M\222x\001\213\234\200\317\211\237\033\237\023?6-[\001\237\023?3I\264%\032E\314\254\220\3649\361\263!\211\262E\036\242\332\022\215\"fj"
+	.ascii	"J\n\213C\023\254\017\261\22591H\362\030\217;\354\013)\206E\226"
+	.ascii	"\207\303\021\231bD\376a\331\342\212\242$\350\350\f\342C\233\034"
+	.ascii	"\026\321\026\350h"
+	.string	"\226\360\241\005:\236\232X,\022}h\330v(\203\0171\231\246&|H\252\025\2209\211\017l\211a\217\360\210L1bgg\b\302\004\330\022\303\236\265&\304\207\r4'|`}\210m\233\034\026m\330v\330\316 \203\334!\372\320\024\207,Rh\302\t\311\243qh\234a\201m\207;D\036#\321F\246E\016\333\031\326\226h\024\201D\262<\303c\261=\036)p\244!\003\266Hd\241\246e\223\254\f>l\233L\221\224\3411\262I\033\025D\304`$\016_(\261s,\312p\340A\0369\3403D\2168\"c\310I\002\265\303v\006\233\021\303\030\330\344\020\271\002\006%v\216.\254.p8\211\017G\"O\233\304A\"Y\2366\211\362\260\240gJ\354\034\213F\r\b[\230a\002.\260p\203\001\t\037Z\344\360\347\203\006\220\307\366\370\002\333\262\305\037\237c\n>'~8\030a$\032\215@2\234\240i\2135"
+	.ascii	"\035y\320Vh\302\t'\361\001\005r\204\021?7\354O\212v\003\024\310"
+	.ascii	"\365g\350\263\203<\221,\017\321\304\021\371\303\303\242@\262"
+	.ascii	"\305\037 \025z\212C\022+\313CD\"Y\023G\241\221\350\201p\004P"
+	.ascii	"\361'\207C\313&Y\344\261\005\032\ny\214\304\032\204\3550)\364"
+	.ascii	"\001B\266%\330\237\244\0063lq\270\263\266H\326\204\221\270\203"
+	.ascii	"\344!\372\234F\242\217.\261\303\222\330A1\364\3216\311\342\320"
+	.ascii	"D\361\370\203d[\243\210\035d\006I\226E\216`U`\213#\214\023\360"
+	.ascii	"\031\246`\342\247\307\202\023C\017\354\020\333\241\017k$\356"
+	.ascii	"\314\360\024\217$\222,\222\004\rl;4Alw&\300\362\034_@\022\207"
+	.ascii	"9F\342\016\233\004\022\242\030\372\bQ e\204(\200\206B\024C\037"
+	.ascii	"\233$\362\210D\262B\326g\210\354\021\356 \2238(1\231D\312\260"
+	.ascii	"?)Z\016\035zz\216-\320\216\2205Al\207&\210\310\016\222D\024C"
+	.ascii	"\341\b\240\032X\036\366'E+l\201~\214D\341\b#\221D{<\372$\205"
+	.ascii	";\310\f\332\223\370\260\001\222mi\214\304\030\212C\"\222Mr@A"
+	.ascii	"\003\n\031\220\3036\271\336\354\264;\355\017\017\220\372\303"
+	.ascii	"\003\244\022[\024+\034\221)F\324\320 \303\021\231b\304\206\357"
+	.ascii	"\020\221\254\221\035\241o\302\t\"\234\200\002\212\364(0\200\004"
+	.ascii	"\006\220\200\036\005\006\350\3500\340\004\035\375\023t\314V\210"
+	.ascii	"l\333aM\253\"\331\022\310#\007R\f\213?,r\206\025\362\210(\221"
+	.ascii	"\034\322\320\263\263\266\311\"P\fH\2665\262)\264\30249bH\303"
+	.ascii	"\221\210&\205#\210"
+	.string	"=\306c\n&X\025\330v(\303L\361\270sl\217\310\0306\030\217\304$\2225a\024\341s\"\006\016>'b\340aw\214)\222F\r\260I\240\232\366H\"\251B\233D\002Q\200M\002\321\2240\022]`\333a\233T\333\0221\370\360\364\260\355\220\347\007he\205,\317\361\005\026\tT$\016{hZ\033\2410=\211\017 \222B\024l\013\344\303A\210\266F\240\343\216P\230\"Y\343\211\243P\230&\221l\022\310(\024j\036#\261\204P\210&\215\304\237\244P\230\032\217\304$\261\310\n\205j+l\223\304\342\206\223\370 \002\017\213\034\222H\212\260\200\026\005k,\016\215H\2665\022I\264?Ba\006&X\344\217P\210\nQ!\312\232\200\230\024\n\321\022;G\027~\216G\027\214\304\241\317\f\017k\034A,\016\323a;T\301\347\210\374a\331\365h\002\311&g\332\0221\370\234\370A\337\nK\030\211.\374\360"
+	.string	"\251'\361\241\204\221X\374\341\001\372"
+	.ascii	"\311\232@\2623$\211\232\247\007\023\223\330H\024\"yx\206%v\216"
+	.ascii	"I\231V8L\312\244(\022}\206=B#1\271\266B\265E\036\177N\342\203"
+	.ascii	"\2218B\313\032\211-k\004\200\232D\221<<\303#\2225\201\320HLj"
+	.ascii	"\023;,2\267\310\343OF\362\360\fs\t#\321\005\237\023?i+D\2415"
+	.ascii	"\022\201\322Vx\202N+D\266?\255\221\b\244\362\260\354OR\210<\266"
+	.ascii	"G\037\231Vx\202Nk$\246\255\260E\036c\200\301\347\304\217M+\204"
+	.ascii	"AD>\022q+L\001\311\372\020\333\032\240\237\026\350(\3649\361"
+	.ascii	"3B\022\311\232 \"yzX\025\330\237\0244\b_\020A\203\214\017\261"
+	.ascii	"5[\241\f)\244\340Cl5rg\307,\262F\343\220\304N\312\026\207;3\254"
+	.ascii	"0\260\311\"\320\217\314\211c\261\007\311\232\200\201\335A\036"
+	.ascii	"{hx\330b\rC#\233\236\304\207#2\305\210\021\222\310c\322\310&"
+	.ascii	"\001\220\024\036\221)F\240\254\017\261\3759\036]\250\351IA\205"
+	.ascii	"\t\350#2\305\b5)4\301\252\260\2633\324-[bg\370#\364\341\351Y"
+	.ascii	"O\302\203\037\177X\344\b\355\361\210\034A\206\230<\376\314\374"
+	.ascii	"\370\f[5\305\017R\210\034\026\201F\030\207B \037b\216\tR\240"
+	.ascii	"@\262Evgg(D\016Y#\261(\004\362!j\320\016\201J 4\036\211\355\260"
+	.ascii	"5\262D\344Q\b\344C\274\300\004)P\bS\264\304\235c\22151s\022\037"
+	.ascii	"\032\260\303\376$Y\037b\253[!\353Cl\205B\275\303&\205&Z\264\025"
+	.ascii	"\2160\036\213Ia\2618\334I\246H\n\205\034v\330\244Qh\242M[!\210"
+	.ascii	"\022Z#\021H\257\340\202\b\026\362I|hw\200\220mr\204$\373\223"
+	.ascii	"\242\035!\331\022k\030\001\3108B\004\024@FbQ\004\023N\020\236"
+	.ascii	"\200\002\212\021X\036\240\342\216\2218\0022\t4\202\002@\360\260"
+	.ascii	"I #\220P\243\310\366g\206g\310\"k\220\355\017MKD\236\230\341"
+	.ascii	"1\262\302\036\240\032\330\344\260\006\03269\254A\370\003TbgX"
+	.ascii	"\203\020\006\021B\033\036#+dM\f\223B\030D\bg\222H\266\004r\350"
+	.ascii	"#\324F\342\220\304\216\020=\032\331\"\261G\230\202H\216\030\026"
+	.ascii	"{\204i+Ly\212G\241\214\321\007\250x\334\021\"\201v\2042l\261"
+	.ascii	"\206akBX\203\034\222\330\311=@5\264\310#\211\244Pm\2050\210\020"
+	.ascii	"\256%v\216E\341\331\nM8\241\247\347(\024\252-\233\354\3519\n"
+	.ascii	"S\030D\beZ\023;,\317qG\250a\020!\244\031\266C\036!\313C<"
+	.ascii	"!\\WpA\004\013B\030D\bu\233$\026iz\200j\020&Y$\313\"{\2043\255"
+	.ascii	"\2205\0011\211^G'\005\0174\200\201\n\350\235\017.\320 b\206\021"
+	.ascii	"Zv\004r\330\216`$\016}F\330A&G\370\020\200\020<\303\037\241\020"
+	.ascii	"ey\216>"
+	.string	"\302\263x<R@x\376\227A{\253\271;\033\314R\252bT-\366Y~\221\337\270\330\366\314\362\222M\230\025\332\2172u\252\246\307\233`\030Y>\222\221\032\332\n\242\"]\t\223f4&dC\026(e\213\330\230\333b/*(\314\f\304@\320\252\212\200\240_29\204\264\301\370\221\243f\204\212<\021\343\003\315\303\261\022\003\353q6\311OJ0\\`h\023T\254F\236\212/\234g\2274\344e\202\231A[z\321\243\353\234\313RRQUx\020\311\020\311\021\311\340Ru\250I\330\200\204\331\322\2019k\t\323\026\255\f\205&iyS\261CE[\303\240\254\226\350Pf\255>\254HY%a\231W/\006\333\256\314-+/#A\2245OU\306p\261\002\323X\274\270\rU\305\300:\244rD\241\272\233)\002\346\345\004\207\232w\326\301\020\3234\265\216\315<\275U\325I\345\272\2320\031slQV4a\372"
+	.string	"\301\310\3348\257\344\324\272l\350\276\034C\334\224P;h\360\252\220L\251\261\312e%gkah\234e&\215,Kz\3148\317\260\212\275\301\261\247SMF\005\223\023\0252V\272,I\340\004eb\254n/\264\212 \221\332"
+	.ascii	"\335qd\254\313I}\302\203H\024\224\027+\025\032\030Z\222\270\320"
+	.ascii	"`\271\357mG\\\023\272Vd\006\026\225\f\323\352e\352\340\273\322"
+	.ascii	"\265\204\206i\200\255LI\213\313(]\215\221\257\004\031uIz\272"
+	.ascii	"1\270\362\242\220T\0316odPZGz\313L\023+Bb,\326\251\" \177t2+"
+	.ascii	".c\364U\253\257i\307\025\3162E\232\213i\026f\265E\205\025\033"
+	.ascii	"*9\314\236\310\020m\235A\220n$\311\f\245=\326\264\200\021##\244"
+	.ascii	"w\320(\241\224 \221\tb\241\233\376\260v\310\354,E0\256\315\312"
+	.ascii	":\270.}\021\202\344j\214\032\230\307\226UV8\243?f\244\360\304"
+	.ascii	"\224\300\205\tB\342\025\365\265\n\256FH\236\366x\340\214\376"
+	.ascii	"\230\221r\323\022\203\013\f\332CE\215=.+`\272\243\222V\340}Q"
+	.ascii	"\371\240\264\260\246p^\373\314\025\f\016\016\016\206\331[h\355"
+	.ascii	"\303\353\337"
+	.string	"\352\367\265\3576\251\2250#!4\257z\253\336\332\345\026\b\355X\371\222\274\220\001\356''\017\377\312\345k\227\263HK\037\036\316+\337\347\264`\2213)8\257{\237K\353\236PE\031\240J\211R\241\262rE\213\351e\005\002\006\312S\026so\005oiyX\264R\375\2027\007u%\027\3019\004\313\206V+\252\222\244\2435 8\257N\276>Y\235\254T\202\320\345x\033\314\373J\345\353\024\020!>\267$H\251M\312\212\247\"\201j\022\246\306\032%\310\215\256-Q\326;\241(eb\347\2332=\263\201\264W(\253]\323\334\334Jw\305\205+P3\251\220{k\362\225\356\204\036W\035\316+\023m\206\304l\214\b\347u\311\211\036AYq\201\363\252\344sq:\264\234\035\271\220\273\201\363\r\300b]~]\227\253\\\024\020\312\222\2020\251J\374\254\266\216|\225\373\212\004D\b<T\201)\033k\334j\304"
+	.string	"Bd_\313V\262\325\315\207\315\331\231\025\024\"_\335\276\266\201\b\361\271\030Q\\h8\204\234\350p^\331D0\261\204\262\264\326\265u\210 \237\013\267\036?\266\354V!\347\022\0210ZBp^\317V51^XH\231!\202E\220J\332\212F$J\214\227\016\350\f\255)#\253\362tR\331\204\274\341\341\274\232\235S\377\325\f\264\306\020a!\205\n\025\221\027 @\326\261\034\251\240\277\032\263$=$i\033\037\032\225\330\3271T\210\027\215$8\257ag\222\330\226+;\322\300\300V\0379RA~\350SR\026\032\2004P\\\3005\255=\276\372\270gB\356\314\n`c\345\261\362X\275n\332^\272E\206\300\222\344+Sz\304X\273\276z\005eq\253\202\365\356\331\023\f8\234_"
+	.string	"$\252\257Vk\216u+3\331\005\n\036\341\223\321\345j\305\372\272\365UK\346\313\035\016;\234\327\035*\223M\225\326\020.8\177\325\201o\320\bd\302Y\265\261f\r\201bt\005\347\027@\205^\257N\252\"K&\234\t0F\257U[\236\236\326\251\033\250\217#\301# \274\304\232@}\235\372*\005\"\004\036R\341\004%\210\363\327\033k\324\257\006\211\247\250T\243\216\225\306\t\255\242H\020\313A\220S\2221\306\2128\003S\026"
+	.string	"@@@ \220\211\322\354\336\024"
+	.string	"\022p\304\214Z\237\320\265(\r*\306\f\200"
+	.string	""
+	.string	"\001"
+	.string	"\"\020\001"
+	.ascii	"\332g\275\260vd\207!\370\373\317\b\250\262\264\031\223\356\353"
+	.ascii	"\354\016\036\316\017\300\205\326\304\304t\b)A,%\3334`\323\032"
+	.ascii	"\2110\330\334\246\b\262\353\323\034\331h\260C\321g\230\375\n"
+	.ascii	"\370@\245\226\324\333.4Lo\nbN(\311\".\204\204,\301\267z\t=\325"
+	.ascii	"[\270$C\031\234\237\226c\214Y\277\335o\n\336\253\322\342\247"
+	.ascii	"m\225\310\330Ef\3070\3124b%\251\305\250z\346f\266\222\376\023"
+	.ascii	"\242\341\375D\214'\\,\373\262\331\344kn\330\035\225F\024tN\344"
+	.ascii	"\270d\325\353\341Ul\312W3HK\323\321xL\224*\245v9\271\nF\362\250"
+	.ascii	"\037l\251WH\306\377\363\370\376\200\342\0062\364\234\363\236"
+	.ascii	"\3012\233_\021o_\\\253v\374\215\310\2226\366)\362V\246\022\255"
+	.ascii	"\257\025U\351\330(\310\200\231XMGB\200\202r!\204\342\177\270"
+	.ascii	"\331\247}@\245\332\350\337\337\235\211\236\024\261_\344'AWuZ"
+	.ascii	"f\216\342G\255\201\241\361\214Y\242HV\330\004aQ\305_\310\\t\264"
+	.ascii	"o\222j'\266\005\321\335\002\274H\006\335\034\224r\340%\335H\323"
+	.ascii	"\b\241R\002\264\375Ap\303z#I\r\313|\276\257H9\347A\206*O\024"
+	.ascii	"\r3k\007}\245\374}D\276O\3604$?1\351vo\323\300\262\020\364\360"
+	.ascii	"\320\b\304'\342\201\357&\305\330r\277\216t\356K\t\205\001?}\357"
+	.ascii	"\030e\0251\345\267\r\\\2409\353%\036\244\005\211\217\335\266"
+	.ascii	"\320\277A\320U\265E\213\260O\013\201\336\255O\221B<\350\234u"
+	.ascii	"\374\275\305q\0032,L\240\231\270\305]\037\313\016\037%\013\373"
+	.ascii	"\035\245\227=/L\240\323kt\260@\024\364\274\302\005\203k\313."
+	.ascii	"\031V\007\230\236\220F\275\374\251\023fe\263\022\343$\f\340\260"
+	.ascii	"A$'L\347@\217\227\354\004%\226\360FuJ=\016\213Y{\220\200\373"
+	.ascii	"M\247\3043\355}\326y\030\251\211\305\3609\254\fTM\023Y\321\202"
+	.ascii	"P.]\301\243\027V\237JG\237\217\233\214\320\177t=\026\311o\366"
+	.ascii	"\271\322\034\fv\217\335?>\333\220B\3552\331\0059\036\210\312"
+	.ascii	"Z\354y\200\364\351\201\202\362\303\032BBL,&\311\277\233&\242"
+	.ascii	"\325\221s\247>\275X\312\231!\177\032<\025\212\026\352\303\350"
+	.ascii	"v\264^\3118\235\233\303&Gf\265@\303\214B\260W\276D1\024\361\263"
+	.ascii	"\336\314|^t\276c\304b#>V\347\360\256gL!G\334\245\350\031\377"
+	.ascii	"\260qX$@'\227G\304rS\003\375\275D\343\377\r(\007\356\357C\204"
+	.ascii	"_1@\005\245\277c5K\263\250F\021\210\262\365\202\326KQ\030\334"
+	.ascii	"x\2218\355\0240\337"
+	.string	"6\363\336j\036\273\275\201\304\242w1/\235)\242\006PD\024\330TwcxQM\327\nZ\342\363\305S*\240V\265\355\203a\t\231\232(c\310\265c\365e"
+	.ascii	"\300\250U\363\213\034\016/\223\022@\260\361.S$\n;\031b\216cB"
+	.ascii	"]C\3646\2000\004\035\230pf\263A\212$\356\017\322BUN1\312\222"
+	.ascii	"\177\325\002\361H^>\240u\031\005?Z5I.<\367\310\026\177R\214g"
+	.ascii	"\336\003\344\233.\377\021\017:\220h\333\375\210\272\013\fB\212"
+	.ascii	"\020\336\350\227\210\372O\334\254\277\366\360\341\204\034\202"
+	.ascii	"\261\247Y$\033%\027\252(\221J\316f"
+	.string	"\374\247pW\243\220\322\232\024\261\255[\373,\001e \305X\031Y\371\200\363}zJwQO\224\266\276\023\032Q\370J\373\270B\342J\354,\352+\235+\242\201L\013-\262>X\325Ph\200\235\247\370\205\217. (,\201)#A\335\300\201\254O\037\031K\304\206\367\372\326\203\024\215\207cpl\301\211\210\202\001\221\246x\240\334L\3009Qj\310\td\367\nN\"\007\020x2S\300b\003q~\262(5r\347\321\022\340\351lB+B\325\277&\306cM\322\374,Hi$Ax\177\320w\023\026\311<T\236\356\343\370\225\367\024\303\362H\320\321\344&\364\004\243\037\301\373\226\211\3174/\236\266O$\264\345\353\034ZG\354\304\3365f\023\211\036\350\204|\362\354\272B\356:v%\200n\214\326\377\fj6X:v-\020|W\273\267\bjc|\2632\220\306\004+\346\260\314\177\001\323\363:\362\002(\337\341O"
+	.ascii	"\nILQG.\266\226\275*\005JD\200v\224\352x\016\200L\222t\346{$"
+	.ascii	"\377\206\373\361\305\306O\211\272\204\017\302-0~\333\343\273"
+	.ascii	"\262\266\032\237\211|E\374\256N\037\263DF\373\263JeB+\007.\372"
+	.ascii	"'\r\265\021\353\373\220\203\272\360\bR\036\242\336\201\314\217"
+	.ascii	"\350\032U\017\216\242\2450\225\213fO\332s\331\225}\327f\007\313"
+	.ascii	"\347!\337g\020\334<\2414Y\263\207"
+	.string	"/\304\336\352_$It}I@\f\247\353\306\223r\244r\035\345\303;L\005\2338\245\202\003#\272\n\371#\036P\336\272\220\223\301<\3658\241\320\375d\002\270~\333\347b\232\023V\235\310l\207\25552/\271\255\361O\002\306C\303\343\204B6\355Q\311=\322\357\020\214\nxTB'\023X:\274\347\013\230\346t\251K\314\0160\007\007\345|\317\b\n\272p\256\236\356\324\345t\353^P:d\246;\203y.$\350H\354/\277\216>\253\243\321\026Ma\024\007\337\226\347\217\322x&\2115V\247\273\302BGz\236/\340X B\356\317\345\363\376\357:\377$\325v\030\b,<\301\277\257^\342)cH`m\207\225&\013\244\275\241\222\225\250\352,\331>\277&e\314@\3215\022Qf\304\357G\316\247\\\n\343\2043\347f\202/~\257\242\212\373\366\367\317\032r\035\332\250\036\035\212X\231\034\213\365\257i\352#"
+	.ascii	"\355Y-D\271'\213^\037\370Sk\316P\303\301\3621\326\030\022\301"
+	.ascii	"\377+0\337\257\370\323\302"
+	.string	"\002\352\312\261\307\024\344(\267\377jv\345\022\312\f\334]%Y\226\242\243\245V\336\265\210\344\355\353#\361`r\302_\034\353\276\206\330\314\211\0022\270\2344!?Z\314y~\251`\n\212\205\222-\207\370\320\370\321\305%\321:Z\367\357\350\013\330(\232\310\261R\013<3ma\204N1|\250g\210\35035;\312\207\031P\2201uV?\325@C\275\303\364\2377\313\271xy<\307\215\230\261^\365\267\214X`\032\262\337t\363\215\300\026\341\235W\225\2740\206i\245\272\324\004\017\307n\327kA\013\251\344\241\361\345\325\017.\f\330^\332\024\025\370\370\"\311\262\304R\030;<p\315E\237\247rof[\314\350\232\302\005H\277\024\342\231\257\210i;\364\216\020\254\346\274!\232]>\2363\373\004\2634h!X\346\256\230\303\323\3329\031\341\220\323c\376\035aO\334qy\020\360\375\231J4\347\225~U\263\354\214\r"
+	.string	"\310\262\035V\374\245\225\037\373W\321t\310\270Wi\371c\273\225\020\225\236dP}\202,\2506\273\276\200\331\024uKl\304\352+\202J\354i\377:1\325$\335\330R\353\352\330&\033\242\351\222\222b\331\222>\001\355\033:sY\242\225\317Z\325\254\034\030\235\035#\353l_,\206\220\025\\\311\315iD\254\216\246\251@\373\346\013@b0\213q\307WL\204tU,\306b&\357E\2661\006\225\307x\267\306\202J&\262\250\337E\322\3507\200@\304A\2721\321L\036k\024\212s\0051\271\376@\033\362M\265\326\004_\361K\004\304\034\223\341\331\235r\334\303y\013\200.]f/\372\036\346\004\304\240\334\271_\031\212\261\023>\306b\330\bny\222\244C\2307\177'\205mjdEP\375\265\221\204\330\356 (\341\033\226/\204\303\020\363\024\2355\375"
+	.ascii	"\305q\270\3417\271\207TD\013Z\230\307$\305\223\211FjW\365\375"
+	.ascii	" \237[xR\037\214e$v\003\004\b\240\272\240,\306mp&\016\242\215"
+	.ascii	"P\254G\327y\033\341\005\376\247X\250\363\200K\005\263r\220\311"
+	.ascii	"U$\350\246<\307(\003\372Q\">$\211n\315\350\026\247\355\377G\317"
+	.ascii	"\277\272O&\317^\274\025\205\236\272\311A\243\034\2427\221\251"
+	.ascii	"k4z\301\311a!\320W\311t\360\375\272;5\341\313'\225\275\177j\257"
+	.ascii	"\007\006C\374Z\317\204\335A\3725\224\222f\022\205\273^\341\200"
+	.ascii	"\020yS\257\233|r\324n\325a\274\274\316\372i\025J\3326\221\376"
+	.ascii	"\201~6\006 \243Yvw\201\003\327\326\342\001\306\3538\377q\260"
+	.ascii	"72c\017\316\305\241\245\331\030jc3\2557\231\337\227V\342\364"
+	.ascii	"\253\245_\313\277L.P\330\265\254\200\356(\364\352A\307\027\207"
+	.ascii	"\215\031\037\224\303\306\235;\221\234;\330\221G\335}\305\237"
+	.ascii	"\226[\250\307\275P\013\205\353X\352\357\366\301\225\300\"Yo\216"
+	.ascii	"&?\320\341Nl\321i!\254\342\223h\247.[\316\263o\207\242r\3257"
+	.ascii	"R\003p\253>\352\n\366\350\365\006\3211G\213\n\303\245L\266\033"
+	.ascii	"H\327u,\022\322\370\035\362\366\n,l\222\251\035\2455\227X}:%"
+	.ascii	"\254\205 \343\305D\243\311\253\004<\240\fJ\247>1\205S\345\022"
+	.ascii	"\226'\346\277\342\f\322\362\006N0\345Q;X\003\217@N'A\327.\330"
+	.ascii	"\006]\003\312\270\361\304\271\0053X\333\360'#x\305~\362\270h"
+	.ascii	"\275\252\004rM\204\264\251\336k\345\335!\322\203\277re\005e#"
+	.ascii	"\337\"\t\264\352\004\261\333\362\357\361\177\200\032[\221\365"
+	.ascii	"\201\341\2675$G[E\013\016\264\013\263\240\347\217Y\330v\333\241"
+	.ascii	"\250{N.x\232rS\032~\035N\323\250\271\263\332;\344\343\246\247"
+	.ascii	"\244\f\030p}J\341v\324\342W\036?\270\206\302G\214O\"\324\203"
+	.ascii	"OO\375\201\005\303_\3368B\251\307 \013\330E\321-:D\245\357\361"
+	.ascii	"wPu\313L\267=\031y6\331\265\260jI\221C%\301\365\031\fF@W\003"
+	.ascii	"l\007\373\210\n*\032\364\237\214S{6\026\3141\277\367)\230\f\342"
+	.ascii	"T4|~\304\240-\340'P\361NG\211\021\0079\f\236r\234:L!\304Q\203"
+	.ascii	"\306\236\310C{=Y\342\275\251\247\362\350\376\244\212\214y\343"
+	.ascii	"\024\204O\241L\262\305\231,f\321e\353T\321\217\371\346\006\330"
+	.ascii	"a?L\264\033I\315#\326>IX\234\312\313MJuz\324\311&H\311\231\376"
+	.string	"x0.l\215#T<\356\262\231\0130\217\034\303j:-\376|\305\257\274\320 \024\bVF8*\300\375\243$j\013T;\232\341-_\355.Se\217{\300%\241o\347\030X\377}m\355<s\3545\201\3435\231\r}\234\021\263\252*\271Ks3WC\271\"\265\037n4\241\307>M\205\2157\207\371\t\334\355\333\2439\340\272\337\"\017jW'\207\024\210\"e\227\222~\204\356t8\002\215V\347(\324"
+	.string	"\016\026\030\311>\217\223?\257\373\325\323S\244\267\235\317\220\321\303\354\370\256.U\002\245\363-\363N\244p\005h\203\255\263h"
+	.string	"yG\0246\177\215\237R\264(\030]\360\331\205_\314\340\360\374T\262\200\315\355\377\247\017\226\277\241O\225\275\305#\367c\326kG3\2722\356{N+\227b{\326!4\345\374\220\025\226\003B\022\235;+&\316:\037\031\251\323\263\232\274/\317\217\204\217\315J\036\300]\215vOQc)\357\"\033XO\013\t\013J\272\f\3252\357 \036 \b\026\344*\236\243L\356\030R\355\200\376\201\317\212a\201\fy`i\204\270r.Ac\222\"t\b\005%zP~\"\205le\257\341\300H\300\336\307\222b\f\343\242\003\342\276\226\2042\257\376\330\3522\310\005@\3278&\303\257\366\211\265jy\234\317\236`w\n\025\\(T\200"
+	.ascii	"\023\2648\360\215\233\226\321\027\356wr\027\361\027\233\303e"
+	.ascii	"5\255\214h\243r\311dA\207u\033'\332\2242\200\033q\315\271:1\240"
+	.ascii	"\305\234\264\f\021\227\007l\210L\240\230\305\242\340\321\365"
+	.ascii	"s\337B\004\321\207A\230\331RH\005\270!b\364N\367\356_\266z\377"
+	.ascii	"\375\253i^.+\017+w\222\325\216}R\346*\252F2j\274\222Eo\310\330"
+	.ascii	"f#\005.D\233\265\306-F\322w\301\301\216\001\310\227R`\376\313"
+	.ascii	"\322\211!\343\321,:\364?D\345\007 \366=\273 Q5-\357\360\337O"
+	.ascii	"%\t\335\02480\250uGwfB\036\251\226\025\242\273f4\f|\240\346!"
+	.ascii	"4\246\\\342\\@\257~\337\270\220\364j=/\007\353\341U\326\355\317"
+	.ascii	"\301_\267\031*k\311l\n\231\316&\235\222m&\321\311\314\306Ia\252"
+	.ascii	"O(\351\264c\343\034\347\332\246\355RLr\2509\313\013+\226G\205"
+	.ascii	"a\fh\031;\027M\n9!\367\355\275M\255\241\350\024\324\276*\306"
+	.ascii	"\217/\007R\241*z\203\204\025F\354\360\214\267XF!"
+	.string	"\266\271\251N\246\251\233\024\340l\235~\265\300\371\343\003M5\006\264\001\\hz\020\r\021IX\016VYd\374\033M\266\344\254\250\351\302TM\321z+P<\342\022\204\254\375\331:\300\367\241\300T\363Q\255I\251\016\372&\225\005J\311\201C\343+x\003\222\220\353O7\n+\212\021\034\301Mn\231\312\200\344\272\0236\346\3378.l\247\007\263%T>>\357\312\254h]v\364\021\267\017\317\243G@\320\301\305\272{h\342Y_\025\346\221\326\317\314\276\330\273-\250?0_\343z\004\255\221\215\352E\345/\027333\273b_\230r\356=\305\361!\t}\332kX\213L;\325\007xbjR\270$E\226TR\037^)\243\312\360\316\025\030n\203D\233}\243\273\235\020\027H\224g\214iO\005]\370\205\206\317zU\206H\370\206LA\261U\3748t\323\030\304A\027\357\002\321}\314.SE\342\374 1?\217"
+	.string	"\246\273N\353\027\242\367\352\300\\\030c\303jZ%\254\263\316J\303\177=x\335\343\226N\2167<\033I\272\331r\335\245%\246,)\341c\226\2672\017u\372\275\034\306w\231\377\372s\213=6\244\"A\331\r\r,\020\323 \203=\311g0\\\333\017K>\f"
+	.string	"0\260-\204\365\212J\021\005\013\033\375"
+	.ascii	"g\036\257\317>\372\305\315\274\365\357\205\305UR\007\t\243l\031"
+	.ascii	"M:\231\tvZ\270\007cz\305e\226-D\363\022\245\300\263\260\332h"
+	.ascii	"|{\203\3648\363T\274\303D)\264\245z\030P7\f\333\342\250(\032"
+	.string	"\232D\370\331\313\230\367\234\230CY\013t\300\007|}\340\372\251b\306\203\227\020\362\243u\344\023\322E*.~\323\207\344\\]\205\355\217\275\360\244A~Fz\357/\355\353FLbObC3(\367\223W\340\307\021\341\203\374y\343Y\"V\277v9\030\225\360\037\357\3528\235\255~v9\204\rK\005\321B\r(\031i<\246\027\2662\306\234\322\237\352\356\372\243\t\216\2072\351\316x\232D\201\255\205\032\327j3\253\001\317\342\256R\320\337E\2703\362\340F\004\301\302H\005\367\376\230)\005\341\025\314=\311`\326\001\320c\365\331qhY+\\ \200o\231\372&\t\210g 3\005\313\211)\200\001\034c6\347\365\261\253\035t,\361\357\333\036(*k\207B\002?N\266\245\3572\361i3E\221\206\316}K\217\027\362\270\366y\273(y\266k\"\262\f-\251\255G\201\247\272T~0\250\022\273\242\214~-}\374"
+	.ascii	"P.\345\231\200D\361\030\353\266 \305\271\2345\027{\324Y\n\365"
+	.ascii	"<\377>\244\363k\036\251\006\033\302\265\233D\377\347u\231\270"
+	.ascii	"\207\270h\022\013<=\240\305}\237\210\022\277\227\317,\257\354"
+	.ascii	"P\307\036\262\311p\034\"/\n\201\3543\036X\177\274S\363\271X\327"
+	.ascii	"~\347\n\331\260\305$\300\367\027{\2671}M\266\342\314\204\302"
+	.ascii	"K=\2101$\013\005(\271\024\312\361tu!+\361\257\b\271\317\351\233"
+	.ascii	">h\013Q(P\254\253e\016\2535\341\265\267Dkh\320\212/1\n\336\220"
+	.ascii	"\016\370\364:g\274u\346\025\264=\314iC\r\207\275\375\036\355"
+	.ascii	"Z|\277<\305.`\333\2373\224\265&\253\264\371\231\261\227.\375"
+	.ascii	"\333\365K78\352l\264^\234J\367!Z\273T\006\217O\346\357\207\265"
+	.ascii	"X\023\242\\T\314Rwt\250\r\201\3534\034`\277w>\377\367\351M\023"
+	.ascii	"\303<\034\240f\345\367l\353\026\371\265)\235w\337\233\362\371"
+	.ascii	"\217.:`\002g\364\336\271Ge\227\217\367\270\021\213\250_\357\257"
+	.ascii	"J\251\273:\361O\002\037\247\272\367A\031\304\271\360\033\345"
+	.ascii	"\177\027\277\331\3633\373?\372\313y\333\262G\\\273\255\202\331"
+	.ascii	"\222gjw_S\212\017\371\257\037;\217#\017\214\303C\374YKn\317\336"
+	.ascii	"|v<\241\214\023\343f\323\341\351\004#\243\261\276\277@sBav\034"
+	.ascii	"\362\216\207\345,h\325\315\254.\027\343\240\303\221\245w\353"
+	.ascii	"\n\275\203\332\367W\365/VX\002\367\374\253\374X\2164\364\365"
+	.ascii	"\220\272\2174\033\n<@\370\357^\376\303\270\206\376\253\245\366"
+	.ascii	"\226\3412}\327\276\233N}\034\352\352\346\224/G\355\331\334;\305"
+	.ascii	"\310\021\345\333\324\377'\236\337\311\374\1771\303\024\3316\366"
+	.ascii	"\301\0178!\177T+A]\257\352&\371\253?\207\230l\343\242\017\240"
+	.ascii	"\317\034\363\370\327\365\304Q\255\007z\306v\251\264\021\330\r"
+	.ascii	"\367\332\333k\360~\345\337\340\236\357\"\235+\361\3140\177\004"
+	.ascii	"\345w\220d6 d\207\244GZ\344DB\360,h\364F\333)\364\326\247MK\263"
+	.ascii	"\2636an\265KTr\3131\210*S\230\261\315\244\307\311=\264L\222w"
+	.ascii	"[\270\033n*\202\007z\r_\237\005\275\203\367E\001\235L\353Y7\316"
+	.ascii	"\334\352\033-C\177\363\260\206\017Y\313\027I\360\310\371U\227"
+	.ascii	"\276T\337\241\257cs\f\021\357w\334 \363\312\233\027\247\257\031"
+	.ascii	"\032\361!\027\210~_\372A\246\363\335\354\033C^\177|\304\3323"
+	.ascii	"\357\273C\316\205r\257\204\277v9\240+?\354\203'\263\333\\}"
+	.string	"\225\270>\327\345\356\330M\363\301L\210\205d\307\256\307\312\207\271\006v\375{\0018I8\273Q\237t\314\326\346\232\301\336\024\304\251\220K;\274/\220\027\376\335\317n\0316\246\025\356\307\026\b\277\324x"
+	.ascii	"[\363d\277\373\236\0056\261\305\361\206vX\250\253|\0374\366-"
+	.ascii	"A\233dd\203\317\002{\016'??\276\232m\247\346\316\033<\365\275"
+	.ascii	"\n\316\023\317!\206\333\240\250\327\364<\204\206\247k_\020\006"
+	.ascii	"\372\032\262\263\316\234\221\277\374\353&\351\353L\r.\032l\373"
+	.ascii	"\371mi\3319\005\346\307\322\035\257\316\305\313<\274\247\337"
+	.ascii	"\013\267\364|\2723\230\335|\021\353?"
+	.text
+	.section	.gnu.lto_.symtab.66cc2d38379d943c,"e",@progbits
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\004"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\004"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\005"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\004"
+	.string	""
+	.string	"fgets"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\005"
+	.string	""
+	.string	"fakeGyroDataReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\005"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\005"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\005"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\005"
+	.string	""
+	.string	"getenv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\005"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\005"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.66cc2d38379d943c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,203 @@
+	.file	"ibus_shared.c"
+	.section	.gnu.lto_.profile.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 +\335"
+	.string	""
+	.string	"\230\037"
+	.string	"\002"
+	.string	"\303\370\326\315\t\b\002"
+	.string	"\001\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 z\345\002"
+	.string	"\"\305\021\035\240'\351\237c(\340\223\306\272<\227\343\370\350\352\302BUU\227\200%\032\361{K\231\002\277a\333^;\200l\230\030\016\212\2726D\263\346`s\022\330\266\345\017-\022\b\207\240p\34367\275C\217\204\321"
+	.string	"\374.\004\007"
+	.string	"-\245^\302p\271\226b\270(\323R\354\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 $\325"
+	.string	""
+	.string	"\220\030"
+	.string	"\001"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\3427\200\005"
+	.text
+	.section	.gnu.lto_.lto.53a887546909d0e3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isChecksumOkIa6b.36.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375`Z\004e\035"
+	.string	"vw\276I\240VN:\021H\247\217\354\016'\006\370\363\250r\306=dvn\2768\244\003\273\036,|9\345\273\001\267W\366\237\306-V\216qqE\206u\230f]\205q\3517\374%\221\247^\025\027\267\034\371?\030\335\332&\204\020\271S\n\251"
+	.string	"\240"
+	.string	"\254"
+	.ascii	"\024\350\305\333C\366\314v8\357\023\362\326\332+\177\265R)p\204"
+	.ascii	"9\355C\275\307\320\243H\334\245V\246\254_\255>\005n@/\332\367"
+	.ascii	"\230\361\"=m\274\330\300\301\220\211\356\223\221\004\363tbW\005"
+	.ascii	"V\253\257\2661\314R\226e\371\320w\207\223\350\224\034\305p'\221"
+	.ascii	"/\365\220\307\222\325\024\020\213Wt:\340\305\212\245\2239T,\315"
+	.ascii	"1<\3203\242\264\302\333\2051J`4\271\224n\212!y\224dc\205w\024"
+	.ascii	">\b\373\332B\342\345f\370\244\364=\327\247\327\224\034\020\213"
+	.ascii	"\247\364IJ\250\265z\242\340\255\270c\267\255\303\266\006;\244"
+	.ascii	"\020\206\271\326M\363\364\013\235v\241\323-\367\375,\262\351"
+	.ascii	"\225G\375*\341\364L6-\233\323\261\3304\375\357&\351\364(\233"
+	.ascii	"\026\347t\030\233\336\330\364\244\323\027\260'\246L<\241X\240"
+	.ascii	"\257&\225Rj\022q\353\306\177\277\326\277\365\265\357\023\371"
+	.ascii	"\226\317\345Y\326\320\203\\\313\377\275\210gWCT\267\377p\354"
+	.ascii	"\211\312\251\007Uk\235=\210\237\205u!\267\017)@\213TP\254'a\031"
+	.ascii	"\350\305\233\360\346S\375\312\263W\035\310\355V!h\375\321\235"
+	.ascii	"\026\330W\005z\261e\336>\025tS\344\253I\020\312+(\004\027\035"
+	.ascii	"\242\213%\253\034\020H0'n\223g-j\2246"
+	.string	"\246\221\316\365\330\2142jkh\2242\305\334\262|\210\221f\221l\026f'\03011\303L[\233\335%a\255\265\206/0\302l\200}\216\322K\327\233Y\232\255\331\331\245\303!\2633\373]\320\350\202\314\036)fU\026\300^\267#7K\303l\314\236\353a\260D\262\013\256\225\327\021o\267)\370\240qei{'\272^\356]:B\276\223Ob\274\270\262/r\0031\244L\001\205\2640\232\245\355\313\315m\262\377@F\330\227\227\311\236M\333\004\250\241\241\3233\262i\2319\r 6\035\363\255\007<\367\t\272y\310\261\355\344P\333\b\036\f88\034\035\272\203\353\360\301\3263\342l\036rp,\310\234\263@\307\006\204\263s\333p\013\342\300S\023\002\302\331|l=6\\\355\003\017\216O-\007\350V[@\300? l@5\334\317\017Pm\3463\3722y\222\b>\307\004\237\275\354\215\321\346<\333\227\221nS\310"
+	.string	"\230E\203\\&\273l\013\205\"[\227\365\354\221\321U\331X\t*S\245\353\235\334\226%\227r\263<\215\305\021\330\030\2064K\216\373])*\037SL\304\035E\b\321Z\353\235\304]\225\r\211N\033\347\356\236e\347\216GvAzw\215\344~/\365P\250Q4c\020D\002e\024\tj\002\022\205\205i\fp\002\021\252\354\001\020XVT\222Bk!R\312\007O\325\204\r\307\\\t\004\307`9\233\241.\236\323\214\r`\363\0333\031H\375G\272\241\236mE\3266\024\334\214\243\210\t&\247)\033\247\023\376j\023\350\370v$"
+	.string	"\277\311\257\262\311\2077\023kJ\\\372%\017\202\251I#\210\245\033\027\002\321\027\203\331\232\253f"
+	.ascii	"\026\300}\362\246\027:\256Z\356\310\fO\013\030\272\327W,\302"
+	.ascii	"\277e\340\312{\347\307\305`%^/\016\341\003\372\277\215DU\006"
+	.ascii	"\263\267G;\363\312.\2228mx\320\345k\2754"
+	.text
+	.section	.gnu.lto_.symbol_nodes.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002$\177\002\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\016\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.53a887546909d0e3,"e",@progbits
+	.string	"(\265/\375`\354\003U\036"
+	.string	"6}\323F\240\\\321p\374\371c\025q>\016Ng^\200\366\263\343\263\337\177\254\037v\331]V\316\371\255\240\365#z\337\345\305\201v\226\255\200\334\235\342k\0076\277\300\3606\025-\023\f-\024\b\302\233O b6\267m\262e\n\255"
+	.string	"\264"
+	.string	"\305"
+	.string	"\345\177"
+	.ascii	"\350\222\372\323\3209\233z\275_)A\357Ke\025\244?\214:3\225\236"
+	.ascii	"+\223OV\005jm\372"
+	.string	"\n\265\334\246S\375Pr-\231<\351\377\262!\233\322\030kB\321^'{\217,\222m\262:\223|\217\372\325\327\212E\222**\241\270IV\311\252\r\226\211)\\\360\252l\242\"\371\325\002\256\027/|\370B\321>\244w\211\017\374~\301!\351m0np\033\214V\027\301H\356\201\321v\217m\006\266\r\330\206`;\214m\240m(\333 \242\330v\331k\303\266\026\333Sl3\261\335\304\266h\333\213\3550\030\f\006m\203\260\355\306^\301\bG\217\\\243\275^\326.\314\036\260\253\345\371m\257\006\354\370\223\250\252H!T\314\032\341\316Y\300\223\253\371\253\277\224\367\233\361:\327\207\347\0273E\377+_\347\237\222\247\371\257\276\247\347\372T\300\372+\257\376JR}z\336M\337\353\344\375\322s\375\245{\256G\3173Q\003\347}\351\327\237\232=\325\037z\256\276\364u>U\245OOU2v\314\311\273\213\336\222\211\352"
+	.string	"O\325w\252\177\243\220\216\362\374K>\224\312\234\261SG@\027GR\246o\325\377\nzGL\276\363\200\347\020\337?\344h\350=\013\245\n<\217\005\2269\226\236\204\364/\270\372\367\376r\017\374\037a\032\322\3333\256\202\301\355\031\335F"
+	.ascii	"\023\0302`\276\220\366Ny\325\235Z-\242\372t|*\322\302\315\233"
+	.ascii	"\243"
+	.string	"[\"\254\340t\321\201%\024\367\312bY\025\266Y\274U\326\212[<\365k\253\f\033\033Q\241\350\rBzac\201`0\030\\\330\270\263\bFq\177\244w\335'/\224\272P;\2455\341Gg\224xp\004Wdys%%\230\353F*\246\351\211w\212M\341\302J\271~\006\255\037D\306 \205\342J\205\033e\245x\245\026\212\213\367\225\022\177s\327\001\201]\007\254,?L\247Q\364\215\334\250uj-\365X#'\024\335f\235\330n\261\230\334\240\371\2009F\346\300\tE\213 C{\274\211\376\207\301R\003;\241\231\314\266\243\335\214j7Z\355\345!\037\016 6|\210\355l%r\264\235\235\020\205\n\244\211\032\356\026d\313\341\202\212l;\235\212\017\005\374\3008\024\266\\l\207\303\345b\002n8\034\006!\326\210\031m\203\t\017EF:\0235\333P\220\216H\3075\242\234\355\204\255\004i\0133\t\263\237\024"
+	.string	"\374\0034\001h\302\350\037 \231\fh&#=\223\255vB?\273\023DF"
+	.string	",\223\005\355\204\350\220\201\254\371\220\260\345hC:!\235\321\b\242\230\212\334\316Vd\273\331v\261\023D\264\242X-\247\213\371\360x\313\226\005j(\377R\375\213"
+	.ascii	"@\322\254\210\363\346J(\314^.^\240\230\245\322\242\304L(n\227"
+	.ascii	"\365\262j\317~\361\202\3310f\231\352\325\320\207\234'N\241\250"
+	.ascii	"\263\b\306/ @\002b\220\262\344\001_\001,\220\374/C\300\254\035"
+	.ascii	"`\005\377\227\0133c\035\231ib\370?`\026\rH\250\264F/\013s\366"
+	.ascii	"\025\232a9V6m\261a\020\023\232]\\\017\033\356\017\t\\0\260HQ"
+	.ascii	"\335\213\3266@\231x\030d\024\r\340\212\202da\360\031\030\260"
+	.ascii	"\203\347\246@\276z\202m\345\326\347\355\n\314\316\322-7\255\235"
+	.ascii	"\034\354P\353\026o+G\005\f\223P\227)("
+	.text
+	.section	.gnu.lto_.symtab.53a887546909d0e3,"e",@progbits
+	.string	"isChecksumOkIa6b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.53a887546909d0e3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
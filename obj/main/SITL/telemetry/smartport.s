@@ -0,0 +1,119 @@
+	.file	"smartport.c"
+	.section	.gnu.lto_.profile.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.c6dd7303710f918f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\016"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c6dd7303710f918f,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"]\007"
+	.string	"\202M47Pm\323\001\250"
+	.string	"\f\330\002\240\363\304\372\301\365\330\252J\257\b\201\363\341r\326\230\227\225\361\373=3\264\032&\204\364\353\331H\022\230\205\357\244l\212\tu\254\373^[\"S\237\300\032\036\0302\262\247\004k\247\235\311\262)e\t\320\021\007\b\315\321x\3421\230\314\202pX\210\033\326L;\315\032\327\311\017\367\344\346f\266\344h4Nn\334I\314\242\330\350&\233L3nv\367\311T\242\357hEK\332P\005id`\026%\221\013\225\032\"1\260\254\224l\224&j\275\375\330\321\265 _\216\355\370\005\344\325\220Z\275\352\202\222\20212QW\210\337\013V{\301\377\036/8\251\t\027\210\326\022@j\007\340\247\370\237\364\337\344\377~\337\367\375\017\370_\361\337\023\b"
+	.ascii	"\257\f\037!\316p!\032\341\324E\255\254\020e\004\256\031[\313"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_.symtab.c6dd7303710f918f,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c6dd7303710f918f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
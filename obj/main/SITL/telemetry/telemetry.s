@@ -0,0 +1,659 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 n\035\003"
+	.string	"T\005b"
+	.string	"\r"
+	.string	"\307\223\202\247\n"
+	.string	"\001\342\270\360\367\001\002\002"
+	.string	"\002\001\003\274\205\242\255\006"
+	.string	"\004\355\211\236b"
+	.string	"\006\275\267\374\234\005\002\002\002\002\003\007\b\354\301\314\336\005"
+	.string	"\t\352\263\360\321\b\n\333\300\354\234\n\013\214\341\321\317\016\f\240\342\234\212\n\r\016\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"H\021\317\317\371\323\fn\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 >\315\001"
+	.string	"\004\0032"
+	.string	"\007"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\003\003"
+	.string	"\001\004\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\006\001\001\002\004\002\002"
+	.string	"\002\001\020\002\006\003"
+	.string	"\002\007"
+	.string	"\001\b\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002"
+	.string	":\203\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"5\006"
+	.string	"rJ!(\200)I\0073\nC\023F8b\21721p\312\003\270\266\f\200\f\265\220\310\300\f\200\024\213\001<\346\013i\273\355-w\n\243\344\017-\337\200-\247\344.\267i!o_\353S(\207\232Q\f\216M\265]\fb\0136\210\314G\031O\321\277\246\217\004\206\005\032\235\354~\244-\003DJp\027\023\217\006\200/53\323~\360\235>\216F\204@\037\034\r\211\200\372\025\373\246\346Af\"|\277\034cd&~r-\004\031"
+	.ascii	"\216\222\202\337\210F\230\326u\233\261\262\216\301b{\240\323"
+	.ascii	"&\2707\371\302n\311\226IfY\252\204X\032?\261+ \214J\031|\226"
+	.ascii	"X\315\024B\016\316?uEg\334\246%o\016V\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 R-\002"
+	.string	"\224\003F"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002\002\006q\001\022"
+	.string	"\001\300\004\001\022\300\004\001"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\004\001\001\003\177\002\005"
+	.string	"\002\002\001\272\001\006\001\001\003"
+	.string	"\002\003\b\001\001"
+	.string	""
+	.string	"\002\b"
+	.string	"\003"
+	.ascii	"^\005\203\240L\331@\033"
+	.text
+	.section	.gnu.lto_.pureconst.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\204\004\003\200\004\004\230\004\006\205\004\007"
+	.ascii	"\200\004\b\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 W\315\001"
+	.string	"\004\002K"
+	.string	"\005"
+	.string	"\001\001\002\t"
+	.string	"\004\001\374\007"
+	.string	"\006\001\300\001\002\n"
+	.string	"\001\002\004"
+	.string	"\001\020\020\b\001\002"
+	.string	"\t"
+	.ascii	"B\240\3413\260\3168K\005r3\365J\017\313\272@\343\r`\001"
+	.text
+	.section	.gnu.lto_.lto.c9d0749248710251,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.42.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 \234]\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\276\375\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\007us\350\334\006uq"
+	.string	"\005\001\006'\001$\237\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.ascii	"\335\2620\245%\230\217\203(\361\006P\004"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.44.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 g\005\003"
+	.string	"4\005U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\005\001\006\035\001"
+	.string	"\005\001'\002\002\177\005\005\001\006}\006{\035\001\001\005\001\006\031\001"
+	.string	"?\202\210\200\340\001yw\301\001u\301\001s\273\001q\300\001o\277\001m\276\001k\273\001i\275\001g\273\001e\273\001c\274\001a\273\001"
+	.string	"\004\001\002\003"
+	.string	"\004"
+	.string	")\202k\206~\271i"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_telemetryInit.45.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 \307E\005"
+	.string	"\"\t#-pU\323\001"
+	.string	"\355U\032J\206\013\207\207.Vx\204\177\215c\304A\202\354s\262|?\tl\257\252\256\204\003\366\360\201\n\035\337\332\275S\n\236\244\310\274d%\033\362R\007\305\250t\232\020\225\020\266\036r\352eYS#/{\354\016Y\324lO\203\321b_\260\261\263\241\002\340\0130|v)\003\002\013\032x4\266\037\031\263C\3670{Nf\322\371vW\343\345\330!\346\177\363\302\306I\016\t\213\3355\334\270\312\035o;a[mS\001\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.46.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375`\201\001M\020"
+	.string	"\266^nG"
+	.string	"\261&\035\2778%C\353\314Mi0\240\347\210\377\231\344n\2471\256\361]\326c\2147B\222M\223\2511m-\323\037l9h\025w\364\b\232K\177\351w\0224\277[\320\003y\322\375r\200N\2215K\366\336r\247\024Z"
+	.string	"U"
+	.string	"^"
+	.string	"\266]j\300r\353!M\35426`8?\265\206\334zx\353t\312\215-\377\263K\0224=\037\350:\035\201,\237!\226K\211@\206\016\r\022\250\"=b!\276\rL\211+\031\250\374\274\220@\f\022"
+	.string	"\020\354\305g\217+\340+F\355A\255\325\361\0033\334\332mO\260\r\301>\213\276\254\265V\357\214\275\321\333\350\241\354\247\363\341\275\033\375"
+	.string	"\003j`^d\200\266'\254\261\240\033\225g\356\210x\370\333,\177\346\315\017[\037\256\260\306J1-l\022|\332A(F\3736/\301\272\354\304\242Z9\370\344\324\032*\360\202\320\347\307=\350\247\274"
+	.string	"\372\031\260\226\253\370\212\316\377\340\221\323\364O\3643\256\350\004\n\033-(1\bg\204\006\020s\024m\224*\376\333\335u\035p\221\231!\337\242_\357\306G\213\0357\241v\005\013\361\337\227\224\002\007O\312\272\334\223#\333\260\004b5n`\244D \377'\224\256\266\245\030\027\260\235W\f\262CW\334\016\016\"\035\211\004S\252\323FR'\317D!\302\312S\225l\016\001\271\340\255:TG\322\255\270\324\311\204\342B<\023\016\304\200U%\235\307\255T*\217\333\302zYw\306\237]T\243\0033Gk)wEL\310\242\266sWl\317%}.<(\373\242\333\216\366\263w\304\200\345\370\013\320\270\333:\006\036"
+	.ascii	"i\355\213\231\351S\257}\253\355\235B\373\252+\241L|/\302\252"
+	.ascii	"\302h@O\241\241\025\253\rV-\247\325j@\212j\300\311\004H\346u"
+	.ascii	"\\\206\241b\030\254 (a\310\303Y-\230&21\301\212q\252\031\232"
+	.ascii	"B\277\272\317\250\203\212\002"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.47.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375`\021\001\225\f"
+	.string	"\206XT@ o\233\0160D&\320\364\272\001\315\021\335\251O\033\207db\301\312OL\210\240\316\347\t\265\376\246\333\030\200Rh\220\2402\335\240:\257\001\240Q\020~\346\230\227\206\300d\241\003V\255\355\275\245L)A"
+	.string	"="
+	.string	"C"
+	.string	"\322\007\304C\333V\260"
+	.ascii	"\343\354\335"
+	.string	"\007\316=\034\021\024'\273\035\245\036\236\035>\315\314\257l\231Ci\303\337\264mR\003l\031^\201\335=\350I\262i\231Q\306\356:G6\rw\274m\b\266\033\330\007\t\177\273\273\326\216\255\351\350\334\037\235~N\253\246S\323\227\"\230\234\3008\020\332\345\244\304X\023\270B\204m\214=\331\316\264?\342\037\314\271\220\013\330\355\240\250\330\355\0208\201t\350\356\004\342a\252\031\377\251\347\304s\342^I>w7\243\266\304H\017\272\304\302\304\213M\242\330\335-\361\032\251S\204\203\346\217\227\270 \355n\030\370$.\020)\304\241\037\022\017\257 JZt\370p\232L\261;-\325c\007\0246&tX\016\260\313\362\250X\343\202\341\302*\216\252B\205Q\035\033\0228(\215\353\203\272\030\260\345Q]\024fY\0275u\232\277\325\216S\037\372A\177\340\342\023J\221~\026\375Hl\253:C\243\032\004\220\266e!?\3624\031"
+	.string	"i\355\023\303t\241\261\266\324:\315\226\235BW\260\242\2525"
+	.ascii	"\016`1\030\004\227YE\002\242\310\210\033\306\204\0235V\333\302"
+	.ascii	"\013\233\360\33350\215L\234\257\356\253j\3105OoW)\003"
+	.text
+	.section	.gnu.lto_telemetryCheckState.49.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 \3075\005"
+	.string	"\"\211\",pU\323\001"
+	.string	"\355m\352\340\337\376:\276\352\302-~\237c\304\004j\3669Y\276\237\004\266\343\377\377\252\001\335\201\006\200\212a\377\336)\005\236$\310\274d%\031\362\322\006\265\250t\232\017\225\f\266\034r\352eYS\243n\037\271B$J\354.\203\321b?\260\221\263\241\002\364\205\020\235]J"
+	.string	"\300z\004\234\214\355G\306\354\317;\314\336\333L\274ow5^\216\035b\3765'h[v8H\354\256\241\266U\356x\333\007\333j\233\n\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.50.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.1pm\032\003\240}C\321\202\330\207n=\326EI\361\376Y\022\b\373\261I\201 \262D\354\326\224\034\212\376\335[\020\246\211|\262\334l\033\250%\2212\245\217\332,D\316\203\020b\222:i:0>\3525\274\3508\033\006\312M\360\301i\bZ9<\350bUA'\315\233\211\232\221`\023\355\364,\226\321\332\362\377e\242vu.F)\b&\277\305\212\312OZ\t\207\324\326\253u\207=\244?\"\212\3711FH\376i\320\203"
+	.string	"\267\214\007.n\026\013\\\334*[\024\317\215[\244\202\"d\364\3371\rK/Y\033\304\230\017\310\343\005\240\360\277\353\003\n\271\314m\013\332&\264\r\005\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.55.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\235\013"
+	.string	"\246\024LA0\247*\035\005\217\177\250\t+v\305\271\203\366\373\315|x\236\2548\275e\317_\250t=$\260\366Q\306.1I\032\260\312`\245`\007\372\210a\030+\003\201<c,\004\231DA\204\221\335D\356\224\0027"
+	.string	"<"
+	.string	"7"
+	.string	"\232R\210mg4&\217/]\251\007x\360QsPk\351\235\256\200\217\337\311\215\376\306\325\200T\235\276\257}\222*\221O\3139\212D\255\325\225\221\233\336\366\306\366\204}\213\260Y\3512\322\244\250(\222\004;\355\2277`\272\214\304\225U\365\005+\004\020\247\336TN/_\230\234rW\230\230|\230\273S\277\300x9\2255\225Y1x=\234:\242rz\002\316\004\250\355\360\356\266lS\246\345\243\211\275\3011O~\031\016\334l\036{\232\333\362r\\]\226=O\273O-\016\257ZS7\b\025"
+	.string	"U0\340\264\177v\373\261\222O{\315]\031!O\310\321\250\020CP\324a|\237\013N\350\243\270\203!\205\342\007\372>\237\350\205<\034\220\327\tG\036\246\301\240\350\013=\021\004C\257;W\227\345\277b\021\346w.\210\355\271\td\211-\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.part.0.63.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375`\251\003%\025"
+	.string	"F\344\206I\260\022VcpX\237\033\007\031>\tRI~<\360\306\301\347?\035\220\365\3018\242|eu\310C)h\036\275\224P\233\245d\323E\220~\200\357\007\375\207\364\017\203\367\t\372\252\375(\332\"\276\360\300R\345\373\333-\267\224)\005r"
+	.string	"p"
+	.string	"n"
+	.string	"NQ\271\371\331v\212\n\216s?\022\371N\364\365R(\357=\316n\353\207\347.\213\301^\256\323\232\225\202\344|\272\003\244p\331\202\242*$\255 \037\240\307\200`\032^\227\361\023\272zg\005\233c\232)L@'\021 \317\f\031\201\343\350\32540\254\n\212"
+	.ascii	"wf\211\225\320\215#or\364\333@i\200\203\270V\356\275\276\216"
+	.ascii	"\303\035r\3331l;\260\253-\267\203}\nA\177+<\263\262\323\3111"
+	.ascii	"\231\210\224H\312\313;\236\3304\236\031p$\362Q\020\245\203\307"
+	.ascii	"\223\016\263\037\324T\242IJ\350$%LJQ(\241i\256\344\352\003\245"
+	.ascii	"\274\367\312^~\361\306GZ\226t\363\243\r\201\252su\304\223[Wj"
+	.ascii	"\337x\0248?\332\034\300\275C[,\356=\036\2705\202\327\255\217"
+	.ascii	"/9o_'9ql\331\355O\004\246\200,\0173z.\234\265&\270\343.z?S\226"
+	.ascii	"\352\004s\360\364L`0_-\004m\324\323\026YV\303Z\211\266_\316W"
+	.ascii	";\025\244\241T\203G\267l\273<\352\345u//\201\377\3420`|\243["
+	.ascii	"\327d\350wn}\231\363\366\365\310S\243 \326\260h\324\321%\255"
+	.ascii	"DW\220\327\345r\371\303u\31065=\251o\0260\216\f\357\365-}\004"
+	.ascii	"\216\200Rs\233\265\330HZ\\ \304\324\030\340n5[\314,(67\034\r"
+	.ascii	"\206&\201\206\233\305\270<\200\231\261\334&\314PL\\\263\321n"
+	.ascii	"3\\\255v\233\311^\207\354\272\002\261\224\214\375\271\363\310"
+	.ascii	"7\270*.%a~\356\244\225\247zEWw\2567\357\275W6\302\024\345\033"
+	.ascii	"\252\2705\310\365\325\330\243H\025s\365d\020z*\"\221\004;s\301"
+	.ascii	"\245\261~\250\222/\253\265\303\372!\302\025E\2501`\305\fc\022"
+	.ascii	"\215\004\022L\230\260\260-\006\020\2431\312\003\022\340\023U"
+	.ascii	"\225R\271\375\377\377\f\020\217\351\247+\b\234x\032\273\250]"
+	.ascii	"6\277\315\016\r!U\017\006\025\263\201r\351;D]\004PT\204\023\212"
+	.ascii	"\217\031,\377bU\227\247P\324[\302\342\221^+^b\261}N\256\230\177"
+	.ascii	"\356\343;{\351\307*0\230\224<\330\346u\347\350\253\212\250\254"
+	.ascii	"\022\373\007\313\222\354\335\240\b\241\363\326\022ni\204\317"
+	.ascii	"Ig\227\343\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\215\006"
+	.string	"\324\tj\001"
+	.string	""
+	.string	""
+	.string	"\0027\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 ?\177\f\375\377\377\377\003\0056\r-\177\016\272\200\202\002.\177\017\0055\020/\177\0211\177\022\0022\177\0230\024\201\204\005,\025\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005*\026gistry"
+	.string	""
+	.string	"\005'\027(\030\003\031\0014\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\0013\177\033\003"
+	.string	"\017$\003\004\020\240\276\320\347"
+	.string	"\001d\003\004"
+	.string	"\363\243\231\"\001\242\001\003\006\001\201\200\200\200\001\001\302\001"
+	.string	"\024"
+	.ascii	"\0373\f\237\"\324g\n\261\004\303\345\007Fc\311\355\252<\313Y"
+	.ascii	"l|+K\341#\200\036\340\207V\355\330I\203+\226xu\203\250k\200\341"
+	.ascii	"4;\235"
+	.text
+	.section	.gnu.lto_.refs.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\001"
+	.string	"\001\004"
+	.string	"\005\006"
+	.string	"\003\013\002\f\002\r\002\n"
+	.text
+	.section	.gnu.lto_.decls.c9d0749248710251,"e",@progbits
+	.string	"(\265/\375`\346&\345\257"
+	.string	"*\033\261>X0\nY:\035\321#\024n\355\217\324\273\205m\312\017*\267Qq$\037]\203#\242c8\365w\214\227\312\202\230\203T>p\263m\335[\356(:\274\236\325\27292\377\346\377_EY\304\314\\\325(\332\226 HH\364\264\350!(\213"
+	.ascii	"\207\326P\310\177w]n_\312$S\211\003\342\003\352\003)x\026\372"
+	.ascii	"\255\337\361ZX\211QGY\362\302T\001H]\027\216\033\206\223H\033"
+	.ascii	"\261+9\346\326\373\270k8Y\246O\200ua\212\345\350\331Km_\266^"
+	.ascii	"\307\r\343\r\223\033J\001ec\214F\366N\376p\340\331Bf\314\n/\373"
+	.ascii	"\016K\353\354^h\337\025\377\204\253\024\333Q3\247\237\307g]\345"
+	.ascii	"\367p\177\254[\346\371\353\270\225{\357\235\034\034ec\304\317"
+	.ascii	"J6\327\251\354\274f\213\316S\264\327|i\257\311\272\221\201f:"
+	.ascii	"k\302\365\331\375\257\356\022\0302G+]\220l\\\256@\211\362\005"
+	.ascii	"\3515ffK\026\244\327\0239!0N\274\314.\025#q\314\2757\214\257"
+	.ascii	"\361K/\3653\376\3702\276\351\255\236\351O<\213\247\361/\336\306"
+	.ascii	"\027\177\352Q|\214w\372\026o\374\252\177z\025\237\342\243\336"
+	.ascii	"\305\257x\023\017u\225O\365\333\177\370D\377\344\336L\\]\322"
+	.ascii	"\220L\232\334\260:fY\034ZW\362\314\033\226\333\345.T\306\353"
+	.ascii	"\003\271\033\006\005\351v\303\326\256\n\356Bu\227\314\030\222"
+	.ascii	"\215\371\004)\364T\027\315m\336\340B\356\275\375\212\231\351"
+	.ascii	"Z\206\271aM\320\276Da\266\271\013\211a\202L\301]\210\356\222"
+	.ascii	"!s\342\305\212\030\234\332\322\375\262i\341\202B\225\033\306"
+	.ascii	"\303{\323\360\202\024:s\303\356R*\001G\222t\360TW\355\256\335"
+	.ascii	"%\026\003\270\340\230{'\375r\271_/w\016>x\252Kv\303<4\355\315"
+	.ascii	"u\244\f\346Q\007W\244n\357$\207\037\016wK\231\246\030\f\310o"
+	.ascii	"\200\232\255\3756o\030\0076\006\233 \315\025`>\3374"
+	.string	"B~W\260\2603J%\367X\005O\250\230}\266\311f\264\3477\355\031\005\355\271\211\366\314C\217\3110\260\340\320\372\354\331J{F\241\035\223\321\216\325\264c(\332\3530\230v\\D;\376\241\035ci\3075\264c(\355OF\373\257i\177'\332\321\274\264/sh\177{*\335\303\274r\261\\e\0067\213\337\264\213\3465\304\344N~V\0322\260\317\376Q\332o\006;\334l\336\fv\376&\364_:\335\263\246\177\244\334\263\253\374\271S6\317\325\262\264\242\352\263_4\035\202\335\274?;\277N\364\206#\032\350\2507\270C\355A\325^\001\355c\367\302\356*\271_WI\301]\342\034|\340x\370\265\271\366N\362\354\254\260\265\302\231\317\016B\273;\230\217 \356\017\334\002\355\227\202\335m^\nv\376zC\331\275\220\344rQ\200\213N\307=\266w\322\207'\t\343\351\306gO\336\013;}-\354\334ov\277I\277"
+	.ascii	"wW\200\373#@\307\375\275\202\264\373g\275\0253\367\273\201\377"
+	.ascii	"\300\375z\340\376H\334}\t\224\373\025\361\036\270\377\001:(\301"
+	.ascii	"\335y\356\257\303\257\373\223\271_/\356\267\213\373\225s\277"
+	.ascii	"c\334o\234\373\245s\277`\334\357\027\367;\347~\303\270_8\367"
+	.ascii	"\313t\277u\3567\213\373Ms\277S\334\275\307\035\207q\177\n\334"
+	.ascii	"\177\203\373[\340\376\032\334\177\002\367\257\300\375\005\300"
+	.ascii	"\201\373\333\270\177\006\367\307\360B\356\316\343\236\037\340"
+	.ascii	"\376\033\270\177\220\373sp\177 \367\307\300\375\313\270_$\356"
+	.ascii	"\367\347~\215\334\257\006\334/\221\373\r\341~}\356\027u\277\247"
+	.ascii	"\373\265\200\373\r\301\375\222\340~Gp\277\037\334\035\003\367"
+	.ascii	"+\202\373M\200\373E\200\373\035\200\373\025\200\273s\271\273"
+	.ascii	"\006wWsw\234f\263\331t\177w\327t\356\032\330\0028\007\306\261"
+	.ascii	"\353j\303Jk\242=Gi\003[\361\220y\022\263e\013\333\020\202i\350"
+	.ascii	"\ba\001\245\225\003\317\310\241\241=\347\205\366\034'-5,\353"
+	.ascii	"2\326\324+^\214+\215\351\204\237x7{[\251!\367fs\201a\340\030"
+	.ascii	"\270\305U\342\0278\3121\n\234\302\177:\300/0\013\374t\227c\037"
+	.ascii	"\262\\a\356\315\206_`(l\274K\251\344fa\323$\212\b\232,\367\303"
+	.ascii	"\353\tNv\034+\332q\234hwl\3746,NKK\264\343$u\330\222\347b\251"
+	.ascii	"\271\235A\242\035\007\210\276?\327\302n\203ka\207\233\262\211"
+	.ascii	"\2633\254)\355W\211M8f\332iI\262\303\360\222c\246\023\240\260"
+	.ascii	"\335\370\214\211w\255\t\345\n\225\3178+\264'\257\205\335\257"
+	.ascii	"\200\206\215\315\013\225:\235\006MN\r7(5\376\214?\032^\021 V"
+	.ascii	"\366\3477\363u\231\f\020\035ej\232Y\340\252|\3761_\207\303\004"
+	.ascii	"\305\262\216\fN\221DL\224\317I.(\250\254\343\347\247\273k\032"
+	.ascii	"\210\013'L>?\230\027\363@\312\316\246>\207\321!\302\200\302&"
+	.ascii	"\247\235\316\343r\252\360\270\312\242E\373\315\231\366\262\345"
+	.ascii	"\265\260\203\203{/zw \312\212\312H\315\327\0246\345w\361\367"
+	.ascii	"\222\333\274\266\274\211e\201Bc\346\353\355\355\335\364\320\312"
+	.ascii	"W\231j\016\321\332r\225\277\345\206\335\257\r\205s\202\215\007"
+	.ascii	"W\335\336h\032\360\214!2#\353\263\337\020u[\333\273\351\3753"
+	.ascii	"\304F\025\320\216\017\023e\302>\273\371\227\032-B\264\230\210"
+	.ascii	"\321\356\317\346W\371lO\366_{\210#\267\204\313R\267\267\224\006"
+	.ascii	"\034\020M\310p\253\362Y\252\374\032\006khh\217\205\204\n\314"
+	.ascii	"YQ\031\311\200\224'<\256\370c\341\221J\263\262\365\331\351^m"
+	.ascii	"gEL\227\243ZZ\3152\r\206\325\221d\206\261\264\250\317V\036\031"
+	.ascii	"\200\270\342\223\317\256\311\264k\035\332\311Oq\362Tv{\337\344"
+	.ascii	"\021\312\270\245\214@\356N\347O\345\346G\220+'&\337\304\377\211"
+	.ascii	"\362\237\374\231\036\356\035\201W\224\025U\335\226\222\002\342"
+	.ascii	"E\351(\222\006\305\377\314Lgk\330\331z\241\345\307\3477\373/"
+	.ascii	"{)\376f\037E\207\351\315\362\336\304{/\340\335{A\r\225\023\210"
+	.ascii	"`\273\3546M\355t\377\345\3567\257\205\207Rl\251\335\346\210v"
+	.ascii	"\277\273M4\356\275Y\324$\267qIgwk\356\005r\337\2718o\354^A\233"
+	.ascii	"\334\3031nbt\220(D\031\276a{\315ro&\253!\003\254\242\230\254"
+	.ascii	"b\024\225V{\310\2445\3641n\253aQ\271\267\317fb\032~8n\237\242"
+	.ascii	"rGm\023Z\242\356NZ\r7\323q\373l\246M\334Pd\262\212**\211Q>E\245"
+	.ascii	"U\324VZ\355\236\315D4\242`\332F\237\255\264\232\333\312cTOQy"
+	.ascii	"\214**\255h\334\255\342\031\027QtnWp\327\254\310\264W<U\021\215"
+	.ascii	"=\313b\362\270\337\366\276cM\333(\200\275\253\216\3067b\214["
+	.ascii	"\266\264\\\261\344\204x\274\311\275w\206\247\245\253\343fZ\026"
+	.ascii	"\205\034\367\026\262d\264\237<\030&\227{\307]\016oTm\247\246"
+	.ascii	"\275'x\332{x\367r\357=\334{\333\030\253\222{S\365\024\221OO{"
+	.ascii	"K\375<\355\252\241Y\323\336?\006W\026UT^\035\205\314\302\224"
+	.ascii	"\310}\"9\274\310\375fe\324\312\241\222\355\024F#\243Z\200\371"
+	.ascii	"<\366\243\213H\271Z\222\002\350\303n\230\222[y\263%\314\214\261"
+	.ascii	"\317n3\324`\257\2749R\201\021\313\200\275\222\235\333\0163\270"
+	.ascii	".\372\273\336\353*?\351\311\035L\204\201%\n\320\216\007(\231"
+	.ascii	"\314)\243A\346\202\013\to\033\227A>\037I\376\334%\3103G>\373"
+	.ascii	"\016M\027y\"/\344\203\274\221\037"
+	.ascii	"r\225\277\365H\377\0377sG\306\364\b\222s\240y:\343\361@p\031"
+	.ascii	"\2605\"o\237\221\310\n|eM1\202\263`Dis"
+	.string	"\242\275G\356\221\265\356\227\224\254)@\274\266\034)T\344\023<k-\r\351\361d\311\216\221\270\024\246>\273\317\221\307Uf\036/F\302&F\001U!\352X\001\237I\3131E\016\013+\315\2071^QK\303\341\236q\344\034$\364\354}\225U\266\215R\032\344\220\231\2512\265u\254\322$\315\200\235\361\314t\225\370L\276\302E\251\335\"(\212Y\026\233+\243\361\331\312F\305T\2231\"\332/\327\211\\\354\302\206\002\033\271\340\230Ny\005\2215c\226\272K\251\236\315\004E\216Y\225S`#o\350\263\367\r.H\032\331F>\346\031YF\256q\225\271*Cy6\221\233\374'We\025oL\0169[\350|,y\371\204\307iX*\222\320\025\227\245rT\216\221\363D\313\225\213\251Lu\225Y\312\177\222{\217e\3309\303\245\256k\227\335s\214\fC\247,\205\214\023\237\363\213\253TSq\003F\213\253\314.N"
+	.ascii	"I\243\3659\263\3608\024\303\024*\234\312\0133$X>{O\013\355=O"
+	.ascii	"\332{\266\316O:\005\346\f3\332y\306h\347\231\323\316\303E;\217"
+	.ascii	"\233v\317ElT\246\211\311\262\324\017t-\354\3620/\361\034)\313"
+	.ascii	"\321\2048\001\036kM>\347\274\0353Q\363\201|j\362\336\264\310"
+	.ascii	"\224|v\274B\223\246\230\251\3178\215n\342"
+	.string	"\221\222\001\316\f(5d|v\234\306\035w\3356\254\374@3\r\231\317\377C\3101\232\234,(0\275\266\264\337\255\213\2238\216r\2258\t.\223\225$\207<\037sU\032\\7\031J\276>\327\345T\231\211C\341\263\363\350\320~\321p\225\2708\354\00531\031\374\005\217\301a\260\034\006\203\305\340.x\356*1\035\346\342\270\f\233iYK!\rc\221\002\307\024zC\276a\025x5{\037\261\240\200\302\027:\234\005\263\215\341\302D\303t\030\256\016\211\351\360\031\246B\224C\242a:\334\206U\340\021\223\333h\223\305f\206\n\003\343\327\327\004\331y\\\264\363\252h\347\205i\354\206S\270\312\fx\013\030\254\245\250.\r\202\275o\206\335m6o\206\235\363zh\347M\255\341e\236\353\322R\361\331yKk]\360\025\2344KR\244\326\324v\246h\337\361\322\276\203\245}\247\205v\235\246vL\305\035K\271s7\354"
+	.string	"nO1>\343\244\220\343)\272\331<\333\301\324<\327\302\356\217\367\302\216"
+	.ascii	"M\360\023\f\305\375\346\346\314\251\255\352"
+	.string	"M;v\202\245\345\204!\237\037\2239f\342~c\303ed\"k\323\216\305\360\230\373\rNs\345\fEX\b\272\330\330\372\214\227\350&\035'\031\334\300}\305e}v\274\304\035'\357\022+9\2607\323;\311\220\222\373\214\2770\230c%V\202\225\036\034\367&b%\017\232\275\211<\367^p\357\005\371\310\225\017&\273\354:b\232w-\354p\227\220c\257\3671\246\246\366yGG\207v\274u1\022%F\202\267pq\023m$\300\312\320\212\252n\033\3214\320\251\373A\246\256\205\366\213\267v\356x\013\033a\352 \263\345s\221\033\272/4V>\273N\223\306E\025x\312C\223\021\002`3\360\306C|\002\n\254F\nU\270F\033\024S\306\213\211\201M\375\027\334\343wd\341\033\030\253\305\222\323\3347W\264a\275\\\217gz\234\207&\343MS\333\016\334\003\037\361\025\223\245\025L\334\003S\341)\rK\305\275Y"
+	.string	"\005Q\342\005\244n\357\r\004\373\300H<\004\023\301'\340 X\b\326\302?\256\022\367\300;\034\363\300Y\0348`\0247\226\216\022\344\235\277\345\\\301\3221\246\304\013\\\006\242B\024\037\001E*\02108\004,A\365\001\203C\300\240\312\252\033\334(\210={\031\034p\001\020\"\206D8\035\360\201\002\0228\207L8C\200\210\200\b\020!:\264i\321\212\266$z\301\337P\272\006\207xJ\b\203C\021H\320\n{@\244\021\332\224\315\001\022}\r{\352\264'\260HX\003,\022\342\364\003*\233Y6]}>\324\246\2040\330\313k+\304\276SbmY\265(5\341\247=}\334\b][\245\364LY\244vE\217\330"
+	.string	"\370\264h\217M\352Cj\325\"`0\002J\352\b\301\t\260\302\""
+	.string	"\244\347\bC\254\360\001\027Z\364h\r\022\001U\337\032\f\366N\f\351\331\252@\013 \341"
+	.ascii	"\203*\253\366\322Ux\262(Q\322J\024\201\017\210\024\fq\264\242"
+	.ascii	"?\021\3326h$\201\bV\0046E\372\241\027\360\251\302\b\322\"\264"
+	.ascii	"\375\005\223\316\337/\355\235"
+	.string	"\355j\201]\203,0e\317\022$\330\022?\"\236/\005\026\251?\324\306\227\262H9em\034mQ\337Y$\f\342\255\250Q/\237i\213\376\204G\251\b\023\212\204\026\264\247\016\273\246I\352\352\323\300\236:\027\350\021\221\264KO\234\324\027<\312\351I\001V\030\264I[\324\004\037\022:B\257\272u\243\240\263\0030xt\024\354\375T\264\315\354\2513bG\202E\217\262\017M\215\362\232\022\021!5@\251\325Ij\332KM\370\301Y\333\022@\\hO\326\002:\375\371T\035\264E?\220\350\241#~?tHi\345\261l\332\013\256%\364Xp\243\240\336\231\036\251-\020i\355\320#\262\200-B\177#\024\2419\255\n\004\261s\224\266l\211\020<\023\370R%\023\206.\360\013~\301`\003\316\232\n6\bjWT\030\224\266h\033\302\227\376F\240@\007\244@\365hM\333\364C\001\274\247\256)0-\322\356\001\b\007"
+	.string	"\301\203\222\215{\ba\203\0206\330\271\207\020\204\204B"
+	.string	"AH;\bB\270mO\016:HO\037\b\245\340\b\233tE\215B\264kP\270\323\272QP\207\240\212\001\003"
+	.string	"H\260\250\004z@$\"\235\364\004\321\256\301\022$XS\225Hm\201\251O\305\021\262G\254\260\310G)\365\001A\244-\272\372\220\320\021\247Rp\004\211\036\372\033!\201\033\005)\255\035\212\204\026<(L\327\016m0\270v\310a\317\"\225\b\030\034RZq\204\350Qo\255YS\237\232\024\\\205\276Ti\375\241\352\232\262>J\351O\210\364\201\350\207\032\341\244>u]\323\244\340\tT7\264\247M\021*\"\250\236EH?\341\217O\233\262\351\032l\221\320\323\007TG\234-\312\236GHkK\"\025\262\001\320I\177h\017\247]\323$\240\332[}\352Q\rP=\322$z\251QO\t=\322<\354\320\017M\002\006\325\026\375\005\205k\332\002A\364V\fl\232\256E\351\207\364W\004\024\341\b\035J\022\022\001\300\003(\006zj\213\036\245@\265\247\343\373\005\215\330t5\022\221\266=\021R_P\002\253\212\376"
+	.ascii	"\325\366\004AH\367R\026\351TZs~)\020\210\032\365N%$\364TB\217"
+	.ascii	"x\3305\270\256\351\231\036\241+\321\331[\331\013\2736e\211\210"
+	.ascii	"\202\247\312\262k\216O\006\"\242`\213\324\253\200U\225\320\263"
+	.ascii	"\biD\352k\221\204@\025C{zh\201*\222\215\013\t\rm\260\300\004"
+	.ascii	"\036\240{A%\3266=J\177i\333\001\250\242G\035z+\333!hC*,\321\236"
+	.ascii	"i\222\332\242I\352\232\372\316\"\240j\324\006\203G\354\331[5"
+	.ascii	"x\221]\2611\354J\202#d\005\231\331\347\261\020lf[.\342E2\222"
+	.ascii	"k4\356-\265\207s\035\370\220r\221\221\344#\232\253\207\f\031"
+	.ascii	"G\362V\221\"lmc"
+	.string	"?_Ahd#\277u\216ob\336\342\210\254\ry*\r"
+	.string	"\343\204C\210\326N\203\007\250B\031-J\302\212\031dhFD4I\323\0012\n\020\206\344Y\034\327P\017\022 4=\321I\307\f\t\211\210$IQ\241\2605\007d\007\256\314O\006\206z2\211\354\234\3003`\361\371\203\213gNH\312\360\033l\021u\246\237\355\032\262\225]\213\267\253\216\315\226|"
+	.ascii	"'\362\004&n3\241\216\211\354\304r\376\241@\004\372\340\271\233"
+	.ascii	"p\026\270\260\210\200<\210!\323\326\322\215\027\273\374\030j"
+	.ascii	"\225W\036\231-_\033eH\322\377,c\nL\255\216xF\220\262\245.%Q\243"
+	.ascii	"\243\370N\247\252\370\213\241\270\233I\036\225\354@\350nLn54"
+	.ascii	"\032\230\"\326Z:\304&\210Fv\306\355\337\276$+QX\374\274>${\311"
+	.ascii	"\246\235:\332\257\331\306\251\317\b\325\303\177\273\377x2$\316"
+	.ascii	"\007i\254\257\331\307\261\365=\331LL\370\33776)\224)\375\364"
+	.ascii	"K\230t\306a~\244\024\242\323\325i\305\024-V\376)>\244\034\t\300"
+	.ascii	"\201\334\247\337:\037\004\271\262\261\304\344\274R\247\006O\231"
+	.ascii	"cHkG\236al\256\007k%z\251\334\373\001\202\224'\324"
+	.string	"\322\373 !z\016\365\251o\205=\364\036\370(\352e:\257,)\310\205\0312\255\247ZW\243\227\230-\264f\335\031\233\335\005\00328\313a\234\r\367\375Ux\264\220\311\221\243\211\245Y\364b\033\033q\007\203\271D\227&\361A\375\213`\n\334(\273J#\277\221\350\020JS\331\223\237\314\223/wg]\321{\336\234B}\334D\305\222\013\002\371\213\r\f\003\202/\b8\222\252\242 \033\313\255\032\303\347Qw\215A\352\262\215\031g\207\0012{<\211\337;'\003\226\n']p\212\302\273\311\333FG._\3122e\327\233\236\305\253\233R\021h\177\263\223R6@\363\307;\232\226h\r\017\021s\370\037\n\331\241H\224d\031?\203\356\274\352.\002~#<E\024\315\266\235\210YP\203\005\370\330\245O\233\377\207.\325\316\372[\020\205\200\272\276oW\244\250\272\340nf\200*\226\302)l2b\001[\034qQ\034"
+	.string	"H\233\213\270e\2703\336\024\303E%j\244R\320\246\274a\346\324\234\374\254\233\265-;<i(\266\"\023Bb\375@\3442\336\025\277\0333\367\030\244\376D\257m\334\n\365\030\350q8\367\004c\034e>7\026\006\373f\037\264\357\341\321\203$\310%\034\264$K\253\004v\371C\021;\330\024\004A1\006\320+\347\f\361\026\365a\004\317\277n\234;\340\bv0\334\260*\232\211\020o\305\262l\337\366f\345\016N)V\301>\316\225\0071\241\3002\270\313\366\265\302\323<\272a[\016N\244\321\314Ih`\032\201.i\260i\367h\024\b\326\322l\224{q\351\2263n6(\035\006\272\274\365\374\254\016}\250p\205.y3%/\364\245E\023T\222\234\020"
+	.string	"\206\267\036\234\357W\020\325\336\255\274\216\257\232\024U\b,%Rz\223a\332\022j5\307\250)\322zC\013+\334h\347\030\301\347\310P\350\342\250\212\367\361\r\345$\"\334\\8h\350\021~7\376J\t&\245\320\b\365\301\301\324\024\343U\207\213\312\316\327\343\200V\344\277\344mz+\215\261-\246\303k\357\033\334\027MiX\260i\036\274\002;kb\023\n\376\216o\256\215\272\375\212\246'\3370V\006gL\242\371\023\203\362`\345GZ\016\306g\277\374s\324\276\210,\306\345D+S\325\2571\020R\035\320\235\315\217(\253/\344P\32347\177S\\.!\256\211Zk\006Xf\342\363\243Q_\204\374\365\340\236\264\334\032\266r\272\217aM-\300\235\032\037\253\230\312\013O\3651\324N\305\334\fn\333x\023\265\312\023\277\300\320/\023\220\265\334\214\344\251\365bu"
+	.ascii	"B\277\021l!C(*\337\344q\360=%\037\006\026F\202\251\247\273it"
+	.ascii	"uP\032\nf\322Sz\007\bO\036\252\235\300RF\3033\036\343\204\317"
+	.ascii	"t<\240*\240s4{\363\315\312\243\313\374B\354\216\300\006\222\345"
+	.ascii	"\225e=\315\306\2235\023\347\";\361\254\206gx)\270\306\214x\316"
+	.ascii	"^o\347\017!J:W\347\233$<>\247D_U\t\222\351~\210\277F\371\312"
+	.ascii	"\177\2408\244\003F\375\007(3\315\357\276zP\250\230.?\361I\370"
+	.ascii	"\313T\220Y\023\306\366I\256>HW\224\244;\221\031\232\230S4l\214"
+	.ascii	"\2534\201\325\3327\310\320\334\fJs\022\021\017\f\223\315["
+	.string	"\317$U\222\311\n1e\367\034\246\265\024\234f\026;2\234\344@\242\371b\020\275F>\324\262\345\363\330\r\330\027%\307\365Cf\221+\313\r\354\034\3020;\234\341'A\256\025\006\250\032\245\344t\026\2071\274\033%h\314>\317T\250 \231U\220\371gi\204\t\224\342\016\233\307\322\t'\370T0y\272\356\364x`\204\341U<\242\320^\033\362\021\242c\204f\260.<\232\314\215D\246\031\240\210/\32022\314\257J`\222,9\0325\215\t\005\231\236m\237\275\200\341\033?\332\227\313?\245\362\002W\001\007\370\360s*:'\336\302\034\212\3367\247\324\375+g\227\223#T#\225{\223K\3575\253&y\307\301\236r\202s\004\2305\340\266\363\013\335\343h\177\005\375\337\307\270\022\253\362-n\263\223\234\207Pw\353#\322\354\304\377\226\300\201\332z\227\035\3054\223\016\b-H\205\242\351\2424\200R\361\376nM\f"
+	.ascii	"9`\310<;o[\225M\374\357\305\305\246\024\344\314\031\275\340\177"
+	.ascii	"\003i$\216\276n&\b\223qg\203\343\370\"\200\253P\265\231\242\321"
+	.ascii	"\027P\210\260\3718\016\331)3\252\251\314\003Q\350\340\3313\336"
+	.ascii	"r\216u\021\324!y\342\227\035&(\202\r\262\245\367b\361~x\352\300"
+	.ascii	"|\003 \254\227\230\346q.\263vw\034w\222\317`\356\212\230\307"
+	.ascii	"\253I\345|\357\307\231\271\247C\367\236l;\242\371svH\352\nz\347"
+	.ascii	"\342\210\366$j\002r0\315-\350\007N\264\300z\220\273k\033\351"
+	.ascii	">X\214m\213S\237\273\273Qf7f\351\264x*\346Z\001"
+	.text
+	.section	.gnu.lto_.symtab.c9d0749248710251,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c9d0749248710251,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -88,15 +88,30 @@
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 4);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .p_ratio = 32,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .record_acc = 1,
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .compression = BLACKBOX_COMPRESSION_NONE,
+    .profile = BLACKBOX_PROFILE_CUSTOM,
+    .group_rate_div = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    .flash_erase_ahead = 0
 );
 
+/*
+ * Field group rates of the named profiles, as divisors of the P-frame rate. A group that is not logged in a P-frame
+ * holds its last value, which costs about a byte per frame instead of the full deltas. 0 leaves the group out of the log.
+ */
+static const uint8_t blackboxProfileRateDiv[BLACKBOX_PROFILE_COUNT][BLACKBOX_FIELD_GROUP_COUNT] = {
+    //                           PID RC  SP  BAT MAG ALT RSSI GYRO ACC DBG MOTOR
+    [BLACKBOX_PROFILE_TUNING]     = { 1,  8,  8,  8,  8,  8,  8,   1,   8,  8,  1 },
+    [BLACKBOX_PROFILE_LONG_RANGE] = { 4,  2,  2,  1,  1,  1,  1,   4,   4,  0,  2 },
+    [BLACKBOX_PROFILE_MINIMAL]    = { 0,  1,  0,  1,  0,  0,  1,   1,   0,  0,  1 },
+};
+
 #define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
 
 // Some macros to make writing FLIGHT_LOG_FIELD_* constants shorter:
@@ -117,7 +132,8 @@ static const char* const blackboxFieldHeaderNames[] = {
     "predictor",
     "encoding",
     "predictor",
-    "encoding"
+    "encoding",
+    "decimation"
 };
 
 /* All field definition structs should look like this (but with longer arrs): */
@@ -130,7 +146,8 @@ typedef struct blackboxFieldDefinition_s {
     uint8_t arr[1];
 } blackboxFieldDefinition_t;
 
-#define BLACKBOX_DELTA_FIELD_HEADER_COUNT       ARRAYLEN(blackboxFieldHeaderNames)
+#define BLACKBOX_MAIN_FIELD_HEADER_COUNT        ARRAYLEN(blackboxFieldHeaderNames)
+#define BLACKBOX_DELTA_FIELD_HEADER_COUNT       (BLACKBOX_MAIN_FIELD_HEADER_COUNT - 1)
 #define BLACKBOX_SIMPLE_FIELD_HEADER_COUNT      (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)
 #define BLACKBOX_CONDITIONAL_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)
 
@@ -176,31 +193,31 @@ static const blackboxDeltaFieldDefinition_t blackboxMainFields[] = {
     {"loopIteration",-1, UNSIGNED, .Ipredict = PREDICT(0),     .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(INC),           .Pencode = FLIGHT_LOG_FIELD_ENCODING_NULL, CONDITION(ALWAYS)},
     /* Time advances pretty steadily so the P-frame prediction is a straight line */
     {"time",       -1, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(STRAIGHT_LINE), .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisP",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisP",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisP",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
+    {"axisP",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(PID)},
+    {"axisP",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(PID)},
+    {"axisP",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(PID)},
     /* I terms get special packed encoding in P frames: */
-    {"axisI",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
-    {"axisI",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
-    {"axisI",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
+    {"axisI",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(PID)},
+    {"axisI",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(PID)},
+    {"axisI",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(PID)},
     {"axisD",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_0)},
     {"axisD",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_1)},
     {"axisD",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_2)},
-    {"axisF",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisF",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisF",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
+    {"axisF",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(PID)},
+    {"axisF",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(PID)},
+    {"axisF",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(PID)},
     /* rcCommands are encoded together as a group in P-frames: */
-    {"rcCommand",   0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
-    {"rcCommand",   1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
-    {"rcCommand",   2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"rcCommand",   0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(RC_COMMANDS)},
+    {"rcCommand",   1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(RC_COMMANDS)},
+    {"rcCommand",   2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(RC_COMMANDS)},
     /* Throttle is always in the range [minthrottle..maxthrottle]: */
-    {"rcCommand",   3, UNSIGNED, .Ipredict = PREDICT(MINTHROTTLE), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"rcCommand",   3, UNSIGNED, .Ipredict = PREDICT(MINTHROTTLE), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_4S16), CONDITION(RC_COMMANDS)},
 
     // setpoint - define 4 fields like rcCommand to use the same encoding. setpoint[4] contains the mixer throttle
-    {"setpoint",    0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
-    {"setpoint",    1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
-    {"setpoint",    2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
-    {"setpoint",    3, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"setpoint",    0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(SETPOINT)},
+    {"setpoint",    1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(SETPOINT)},
+    {"setpoint",    2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(SETPOINT)},
+    {"setpoint",    3, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(SETPOINT)},
 
     {"vbatLatest",    -1, UNSIGNED, .Ipredict = PREDICT(VBATREF),  .Iencode = ENCODING(NEG_14BIT),   .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_VBAT},
     {"amperageLatest",-1, SIGNED,   .Ipredict = PREDICT(0),        .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC},
@@ -219,9 +236,9 @@ static const blackboxDeltaFieldDefinition_t blackboxMainFields[] = {
     {"rssi",       -1, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_RSSI},
 
     /* Gyros and accelerometers base their P-predictions on the average of the previous 2 frames to reduce noise impact */
-    {"gyroADC",     0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"gyroADC",     1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"gyroADC",     2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
+    {"gyroADC",     0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(GYRO)},
+    {"gyroADC",     1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(GYRO)},
+    {"gyroADC",     2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(GYRO)},
     {"accSmooth",   0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC},
     {"accSmooth",   1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC},
     {"accSmooth",   2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC},
@@ -363,10 +380,15 @@ static uint32_t blackboxConditionCache;
 
 STATIC_ASSERT((sizeof(blackboxConditionCache) * 8) >= FLIGHT_LOG_FIELD_CONDITION_LAST, too_many_flight_log_conditions);
 
+// Field group rate divisors, fixed for the whole log like the condition cache
+STATIC_UNIT_TESTED uint8_t blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_COUNT];
+
 static uint32_t blackboxIteration;
 static uint16_t blackboxLoopIndex;
 static uint16_t blackboxPFrameIndex;
 static uint16_t blackboxIFrameIndex;
+// P-frames logged since the last I-frame, decides which decimated groups are refreshed
+STATIC_UNIT_TESTED uint16_t blackboxPFramesSinceIFrame;
 // number of flight loop iterations before logging I-frame
 // typically 32 for 1kHz loop, 64 for 2kHz loop etc
 STATIC_UNIT_TESTED int16_t blackboxIInterval = 0;
@@ -407,6 +429,19 @@ static bool blackboxIsOnlyLoggingIntraframes(void)
     return blackboxConfig()->p_ratio == 0;
 }
 
+uint8_t blackboxGetFieldGroupRateDiv(BlackboxFieldGroup_e group)
+{
+    if (blackboxConfig()->profile != BLACKBOX_PROFILE_CUSTOM && blackboxConfig()->profile < BLACKBOX_PROFILE_COUNT) {
+        return blackboxProfileRateDiv[blackboxConfig()->profile][group];
+    }
+    return blackboxConfig()->group_rate_div[group];
+}
+
+static bool isFieldGroupLogged(BlackboxFieldGroup_e group)
+{
+    return blackboxGroupRateDiv[group] != 0;
+}
+
 static bool testBlackboxConditionUncached(FlightLogFieldCondition condition)
 {
     switch (condition) {
@@ -421,7 +456,7 @@ static bool testBlackboxConditionUncached(FlightLogFieldCondition condition)
     case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6:
     case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7:
     case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8:
-        return getMotorCount() >= condition - FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1 + 1;
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_MOTOR) && getMotorCount() >= condition - FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1 + 1;
 
     case FLIGHT_LOG_FIELD_CONDITION_TRICOPTER:
         return mixerConfig()->mixerMode == MIXER_TRI || mixerConfig()->mixerMode == MIXER_CUSTOM_TRI;
@@ -429,46 +464,58 @@ static bool testBlackboxConditionUncached(FlightLogFieldCondition condition)
     case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0:
     case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1:
     case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2:
-        return currentPidProfile->pid[condition - FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0].D != 0;
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_PID) && currentPidProfile->pid[condition - FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0].D != 0;
 
     case FLIGHT_LOG_FIELD_CONDITION_MAG:
 #ifdef USE_MAG
-        return sensors(SENSOR_MAG);
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_MAG) && sensors(SENSOR_MAG);
 #else
         return false;
 #endif
 
     case FLIGHT_LOG_FIELD_CONDITION_BARO:
 #ifdef USE_BARO
-        return sensors(SENSOR_BARO);
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_ALTITUDE) && sensors(SENSOR_BARO);
 #else
         return false;
 #endif
 
     case FLIGHT_LOG_FIELD_CONDITION_VBAT:
-        return batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE;
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_BATTERY) && batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE;
 
     case FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC:
-        return (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) && (batteryConfig()->currentMeterSource != CURRENT_METER_VIRTUAL);
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_BATTERY) && (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) && (batteryConfig()->currentMeterSource != CURRENT_METER_VIRTUAL);
 
     case FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER:
 #ifdef USE_RANGEFINDER
-        return sensors(SENSOR_RANGEFINDER);
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_ALTITUDE) && sensors(SENSOR_RANGEFINDER);
 #else
         return false;
 #endif
 
     case FLIGHT_LOG_FIELD_CONDITION_RSSI:
-        return isRssiConfigured();
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_RSSI) && isRssiConfigured();
 
     case FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME:
         return blackboxConfig()->p_ratio != 1;
 
     case FLIGHT_LOG_FIELD_CONDITION_ACC:
-        return sensors(SENSOR_ACC) && blackboxConfig()->record_acc;
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_ACC) && sensors(SENSOR_ACC) && blackboxConfig()->record_acc;
 
     case FLIGHT_LOG_FIELD_CONDITION_DEBUG:
-        return debugMode != DEBUG_NONE;
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_DEBUG) && debugMode != DEBUG_NONE;
+
+    case FLIGHT_LOG_FIELD_CONDITION_PID:
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_PID);
+
+    case FLIGHT_LOG_FIELD_CONDITION_RC_COMMANDS:
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_RC_COMMANDS);
+
+    case FLIGHT_LOG_FIELD_CONDITION_SETPOINT:
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_SETPOINT);
+
+    case FLIGHT_LOG_FIELD_CONDITION_GYRO:
+        return isFieldGroupLogged(BLACKBOX_FIELD_GROUP_GYRO);
 
     case FLIGHT_LOG_FIELD_CONDITION_NEVER:
         return false;
@@ -493,6 +540,52 @@ static bool testBlackboxCondition(FlightLogFieldCondition condition)
     return (blackboxConditionCache & (1 << condition)) != 0;
 }
 
+/**
+ * The rate divisor of the group a main frame field belongs to, found from the field's condition. Fields outside of
+ * the groups are logged in every frame.
+ */
+static uint8_t blackboxConditionRateDiv(FlightLogFieldCondition condition)
+{
+    switch (condition) {
+    case FLIGHT_LOG_FIELD_CONDITION_PID:
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0:
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1:
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_PID];
+    case FLIGHT_LOG_FIELD_CONDITION_RC_COMMANDS:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_RC_COMMANDS];
+    case FLIGHT_LOG_FIELD_CONDITION_SETPOINT:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_SETPOINT];
+    case FLIGHT_LOG_FIELD_CONDITION_VBAT:
+    case FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_BATTERY];
+    case FLIGHT_LOG_FIELD_CONDITION_MAG:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_MAG];
+    case FLIGHT_LOG_FIELD_CONDITION_BARO:
+    case FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_ALTITUDE];
+    case FLIGHT_LOG_FIELD_CONDITION_RSSI:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_RSSI];
+    case FLIGHT_LOG_FIELD_CONDITION_GYRO:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_GYRO];
+    case FLIGHT_LOG_FIELD_CONDITION_ACC:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_ACC];
+    case FLIGHT_LOG_FIELD_CONDITION_DEBUG:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_DEBUG];
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8:
+        return blackboxGroupRateDiv[BLACKBOX_FIELD_GROUP_MOTOR];
+    default:
+        return 1;
+    }
+}
+
 static void blackboxSetState(BlackboxState newState)
 {
     //Perform initial setup required for the new state
@@ -520,6 +613,11 @@ static void blackboxSetState(BlackboxState newState)
         break;
     case BLACKBOX_STATE_SHUTTING_DOWN:
         xmitState.u.startTime = millis();
+        blackboxCompressionEnd();
+        break;
+    case BLACKBOX_STATE_STOPPED:
+        // the log may stop without shutting down, when the device is full
+        blackboxCompressionEnd();
         break;
     default:
         ;
@@ -531,34 +629,41 @@ static void writeIntraframe(void)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
 
+    blackboxFrameBegin();
     blackboxWrite('I');
 
     blackboxWriteUnsignedVB(blackboxIteration);
     blackboxWriteUnsignedVB(blackboxCurrent->time);
 
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_PID)) {
+        blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
+        blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
 
-    // Don't bother writing the current D term if the corresponding PID setting is zero
-    for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
-        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
-            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x]);
+        // Don't bother writing the current D term if the corresponding PID setting is zero
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+                blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x]);
+            }
         }
-    }
 
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_F, XYZ_AXIS_COUNT);
+        blackboxWriteSignedVBArray(blackboxCurrent->axisPID_F, XYZ_AXIS_COUNT);
+    }
 
-    // Write roll, pitch and yaw first:
-    blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RC_COMMANDS)) {
+        // Write roll, pitch and yaw first:
+        blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
 
-    /*
-     * Write the throttle separately from the rest of the RC data so we can apply a predictor to it.
-     * Throttle lies in range [minthrottle..maxthrottle]:
-     */
-    blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE] - motorConfig()->minthrottle);
+        /*
+         * Write the throttle separately from the rest of the RC data so we can apply a predictor to it.
+         * Throttle lies in range [minthrottle..maxthrottle]:
+         */
+        blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE] - motorConfig()->minthrottle);
+    }
 
-    // Write setpoint roll, pitch, yaw, and throttle
-    blackboxWriteSigned16VBArray(blackboxCurrent->setpoint, 4);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_SETPOINT)) {
+        // Write setpoint roll, pitch, yaw, and throttle
+        blackboxWriteSigned16VBArray(blackboxCurrent->setpoint, 4);
+    }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
         /*
@@ -597,7 +702,9 @@ static void writeIntraframe(void)
         blackboxWriteUnsignedVB(blackboxCurrent->rssi);
     }
 
-    blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_GYRO)) {
+        blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
+    }
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
         blackboxWriteSigned16VBArray(blackboxCurrent->accADC, XYZ_AXIS_COUNT);
     }
@@ -606,13 +713,15 @@ static void writeIntraframe(void)
         blackboxWriteSigned16VBArray(blackboxCurrent->debug, DEBUG16_VALUE_COUNT);
     }
 
-    //Motors can be below minimum output when disarmed, but that doesn't happen much
-    blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - motorOutputLow);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1)) {
+        //Motors can be below minimum output when disarmed, but that doesn't happen much
+        blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - motorOutputLow);
 
-    //Motors tend to be similar to each other so use the first motor's value as a predictor of the others
-    const int motorCount = getMotorCount();
-    for (int x = 1; x < motorCount; x++) {
-        blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+        //Motors tend to be similar to each other so use the first motor's value as a predictor of the others
+        const int motorCount = getMotorCount();
+        for (int x = 1; x < motorCount; x++) {
+            blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+        }
     }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
@@ -620,6 +729,8 @@ static void writeIntraframe(void)
         blackboxWriteSignedVB(blackboxCurrent->servo[5] - 1500);
     }
 
+    blackboxFrameEnd();
+
     //Rotate our history buffers:
 
     //The current state becomes the new "before" state
@@ -651,6 +762,7 @@ static void writeInterframe(void)
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
     blackboxMainState_t *blackboxLast = blackboxHistory[1];
 
+    blackboxFrameBegin();
     blackboxWrite('P');
 
     //No need to store iteration count since its delta is always 1
@@ -664,28 +776,30 @@ static void writeInterframe(void)
     int32_t deltas[8];
     int32_t setpointDeltas[4];
 
-    arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_PID)) {
+        arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
+        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
 
-    /*
-     * The PID I field changes very slowly, most of the time +-2, so use an encoding
-     * that can pack all three fields into one byte in that situation.
-     */
-    arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
-    blackboxWriteTag2_3S32(deltas);
+        /*
+         * The PID I field changes very slowly, most of the time +-2, so use an encoding
+         * that can pack all three fields into one byte in that situation.
+         */
+        arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
+        blackboxWriteTag2_3S32(deltas);
 
-    /*
-     * The PID D term is frequently set to zero for yaw, which makes the result from the calculation
-     * always zero. So don't bother recording D results when PID D terms are zero.
-     */
-    for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
-        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
-            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
+        /*
+         * The PID D term is frequently set to zero for yaw, which makes the result from the calculation
+         * always zero. So don't bother recording D results when PID D terms are zero.
+         */
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+                blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
+            }
         }
-    }
 
-    arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+        arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, XYZ_AXIS_COUNT);
+        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    }
 
     /*
      * RC tends to stay the same or fairly small for many frames at a time, so use an encoding that
@@ -696,8 +810,12 @@ static void writeInterframe(void)
         setpointDeltas[x] = blackboxCurrent->setpoint[x] - blackboxLast->setpoint[x];
     }
 
-    blackboxWriteTag8_4S16(deltas);
-    blackboxWriteTag8_4S16(setpointDeltas);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RC_COMMANDS)) {
+        blackboxWriteTag8_4S16(deltas);
+    }
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_SETPOINT)) {
+        blackboxWriteTag8_4S16(setpointDeltas);
+    }
 
     //Check for sensors that are updated periodically (so deltas are normally zero)
     int optionalFieldCount = 0;
@@ -737,19 +855,25 @@ static void writeInterframe(void)
     blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
 
     //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_GYRO)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC), XYZ_AXIS_COUNT);
+    }
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
         blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
     }
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
         blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
     }
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor), getMotorCount());
+    }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
         blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
     }
 
+    blackboxFrameEnd();
+
     //Rotate our history buffers
     blackboxHistory[2] = blackboxHistory[1];
     blackboxHistory[1] = blackboxHistory[0];
@@ -764,6 +888,7 @@ static void writeSlowFrame(void)
 {
     int32_t values[3];
 
+    blackboxFrameBegin();
     blackboxWrite('S');
 
     blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
@@ -777,6 +902,8 @@ static void writeSlowFrame(void)
     values[2] = slowHistory.rxFlightChannelsValid ? 1 : 0;
     blackboxWriteTag2_3S32(values);
 
+    blackboxFrameEnd();
+
     blackboxSlowFrameIterationTimer = 0;
 }
 
@@ -849,6 +976,7 @@ static void blackboxResetIterationTimers(void)
     blackboxLoopIndex = 0;
     blackboxIFrameIndex = 0;
     blackboxPFrameIndex = 0;
+    blackboxPFramesSinceIFrame = 0;
     blackboxSlowFrameIterationTimer = 0;
 }
 
@@ -879,6 +1007,9 @@ static void blackboxStart(void)
      * must always agree with the logged data, the results of these tests must not change during logging. So
      * cache those now.
      */
+    for (int group = 0; group < BLACKBOX_FIELD_GROUP_COUNT; group++) {
+        blackboxGroupRateDiv[group] = blackboxGetFieldGroupRateDiv(group);
+    }
     blackboxBuildConditionCache();
 
     blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
@@ -967,18 +1098,22 @@ static bool inMotorTestMode(void) {
 #ifdef USE_GPS
 static void writeGPSHomeFrame(void)
 {
+    blackboxFrameBegin();
     blackboxWrite('H');
 
     blackboxWriteSignedVB(GPS_home[0]);
     blackboxWriteSignedVB(GPS_home[1]);
     //TODO it'd be great if we could grab the GPS current time and write that too
 
+    blackboxFrameEnd();
+
     gpsHistory.GPS_home[0] = GPS_home[0];
     gpsHistory.GPS_home[1] = GPS_home[1];
 }
 
 static void writeGPSFrame(timeUs_t currentTimeUs)
 {
+    blackboxFrameBegin();
     blackboxWrite('G');
 
     /*
@@ -999,6 +1134,8 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
     blackboxWriteUnsignedVB(gpsSol.groundSpeed);
     blackboxWriteUnsignedVB(gpsSol.groundCourse);
 
+    blackboxFrameEnd();
+
     gpsHistory.GPS_numSat = gpsSol.numSat;
     gpsHistory.GPS_coord[LAT] = gpsSol.llh.lat;
     gpsHistory.GPS_coord[LON] = gpsSol.llh.lon;
@@ -1075,6 +1212,78 @@ static void loadMainState(timeUs_t currentTimeUs)
     #endif // UNIT_TEST
 }
 
+/**
+ * Is the field group not due in the current P-frame, so that it should hold its value from the last frame?
+ */
+STATIC_UNIT_TESTED bool blackboxFieldGroupHeld(BlackboxFieldGroup_e group)
+{
+    const uint8_t rateDiv = blackboxGroupRateDiv[group];
+    return rateDiv > 1 && blackboxPFramesSinceIFrame % rateDiv != 0;
+}
+
+/**
+ * Give the field groups that are not due in this P-frame their values from the last frame, so their deltas are zero.
+ */
+static void holdDecimatedFieldGroups(void)
+{
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+    const blackboxMainState_t *blackboxLast = blackboxHistory[1];
+
+    for (int group = 0; group < BLACKBOX_FIELD_GROUP_COUNT; group++) {
+        if (!blackboxFieldGroupHeld(group)) {
+            continue;
+        }
+        switch (group) {
+        case BLACKBOX_FIELD_GROUP_PID:
+            memcpy(blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, sizeof(blackboxCurrent->axisPID_P));
+            memcpy(blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, sizeof(blackboxCurrent->axisPID_I));
+            memcpy(blackboxCurrent->axisPID_D, blackboxLast->axisPID_D, sizeof(blackboxCurrent->axisPID_D));
+            memcpy(blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, sizeof(blackboxCurrent->axisPID_F));
+            break;
+        case BLACKBOX_FIELD_GROUP_RC_COMMANDS:
+            memcpy(blackboxCurrent->rcCommand, blackboxLast->rcCommand, sizeof(blackboxCurrent->rcCommand));
+            break;
+        case BLACKBOX_FIELD_GROUP_SETPOINT:
+            memcpy(blackboxCurrent->setpoint, blackboxLast->setpoint, sizeof(blackboxCurrent->setpoint));
+            break;
+        case BLACKBOX_FIELD_GROUP_BATTERY:
+            blackboxCurrent->vbatLatest = blackboxLast->vbatLatest;
+            blackboxCurrent->amperageLatest = blackboxLast->amperageLatest;
+            break;
+#ifdef USE_MAG
+        case BLACKBOX_FIELD_GROUP_MAG:
+            memcpy(blackboxCurrent->magADC, blackboxLast->magADC, sizeof(blackboxCurrent->magADC));
+            break;
+#endif
+        case BLACKBOX_FIELD_GROUP_ALTITUDE:
+#ifdef USE_BARO
+            blackboxCurrent->BaroAlt = blackboxLast->BaroAlt;
+#endif
+#ifdef USE_RANGEFINDER
+            blackboxCurrent->surfaceRaw = blackboxLast->surfaceRaw;
+#endif
+            break;
+        case BLACKBOX_FIELD_GROUP_RSSI:
+            blackboxCurrent->rssi = blackboxLast->rssi;
+            break;
+        case BLACKBOX_FIELD_GROUP_GYRO:
+            memcpy(blackboxCurrent->gyroADC, blackboxLast->gyroADC, sizeof(blackboxCurrent->gyroADC));
+            break;
+        case BLACKBOX_FIELD_GROUP_ACC:
+            memcpy(blackboxCurrent->accADC, blackboxLast->accADC, sizeof(blackboxCurrent->accADC));
+            break;
+        case BLACKBOX_FIELD_GROUP_DEBUG:
+            memcpy(blackboxCurrent->debug, blackboxLast->debug, sizeof(blackboxCurrent->debug));
+            break;
+        case BLACKBOX_FIELD_GROUP_MOTOR:
+            memcpy(blackboxCurrent->motor, blackboxLast->motor, sizeof(blackboxCurrent->motor));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
 /**
  * Transmit the header information for the given field definitions. Transmitted header lines look like:
  *
@@ -1087,6 +1296,9 @@ static void loadMainState(timeUs_t currentTimeUs)
  * Provide an array 'conditions' of FlightLogFieldCondition enums if you want these conditions to decide whether a field
  * should be included or not. Otherwise provide NULL for this parameter and NULL for secondCondition.
  *
+ * The main frame (the one with a deltaFrameChar) gets one more line, "H Field P decimation", giving for each field the
+ * divisor of the P-frame rate it is sampled at. In the P-frames between samples the field repeats its last value.
+ *
  * Set xmitState.headerIndex to 0 and xmitState.u.fieldIndex to -1 before calling for the first time.
  *
  * secondFieldDefinition and secondCondition element pointers need to be provided in order to compute the stride of the
@@ -1104,7 +1316,7 @@ static bool sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const v
     size_t conditionsStride = (char*) secondCondition - (char*) conditions;
 
     if (deltaFrameChar) {
-        headerCount = BLACKBOX_DELTA_FIELD_HEADER_COUNT;
+        headerCount = BLACKBOX_MAIN_FIELD_HEADER_COUNT;
     } else {
         headerCount = BLACKBOX_SIMPLE_FIELD_HEADER_COUNT;
     }
@@ -1173,6 +1385,8 @@ static bool sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const v
                 if (def->fieldNameIndex != -1) {
                     blackboxPrintf("[%d]", def->fieldNameIndex);
                 }
+            } else if (xmitState.headerIndex == BLACKBOX_DELTA_FIELD_HEADER_COUNT) {
+                blackboxPrintf("%d", blackboxConditionRateDiv(conditions[conditionsStride * xmitState.u.fieldIndex]));
             } else {
                 //The other headers are integers
                 blackboxPrintf("%d", def->arr[xmitState.headerIndex - 1]);
@@ -1426,6 +1640,13 @@ static bool blackboxWriteSysinfo(void)
             BLACKBOX_PRINT_HEADER_LINE("IMUF w", " %d",                     gyroConfig()->imuf_w);
 
         BLACKBOX_PRINT_HEADER_LINE("Actual Version Number", "%s %s (%s) %s",    FC_FIRMWARE_NAME, FC_VERSION_STRING, shortGitRevision, targetName);
+#ifdef USE_HUFFMAN
+        BLACKBOX_PRINT_HEADER_LINE_CUSTOM(
+            if (blackboxConfig()->compression == BLACKBOX_COMPRESSION_HUFFMAN) {
+                blackboxPrintfHeaderLine("Data compression", "%s", "huffman");
+            }
+            );
+#endif
 
 
         default:
@@ -1448,6 +1669,7 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
     }
 
     //Shared header for event frames
+    blackboxFrameBegin();
     blackboxWrite('E');
     blackboxWrite(event);
 
@@ -1478,6 +1700,8 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
         blackboxWrite(0);
         break;
     }
+
+    blackboxFrameEnd();
 }
 
 /* If an arming beep has played since it was last logged, write the time of the arming beep to the log as a synchronization point */
@@ -1563,6 +1787,7 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 
         loadMainState(currentTimeUs);
         writeIntraframe();
+        blackboxPFramesSinceIFrame = 0;
     } else {
         blackboxCheckAndLogArmingBeep();
         blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
@@ -1575,6 +1800,8 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
             writeSlowFrameIfNeeded();
 
             loadMainState(currentTimeUs);
+            blackboxPFramesSinceIFrame++;
+            holdDecimatedFieldGroups();
             writeInterframe();
         }
 #ifdef USE_GPS
@@ -1689,6 +1916,11 @@ void blackboxUpdate(timeUs_t currentTimeUs)
              * could wipe out the end of the header if we weren't careful)
              */
             if (blackboxDeviceFlushForce()) {
+#ifdef USE_HUFFMAN
+                if (blackboxConfig()->compression == BLACKBOX_COMPRESSION_HUFFMAN) {
+                    blackboxCompressionBegin();
+                }
+#endif
                 blackboxSetState(BLACKBOX_STATE_RUNNING);
             }
         }
@@ -1741,9 +1973,8 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         break;
     case BLACKBOX_STATE_ERASING:
         if (isBlackboxErased()) {
-            //Done erasing
+            //Done erasing, the erase task beeps
             blackboxSetState(BLACKBOX_STATE_ERASED);
-            beeper(BEEPER_BLACKBOX_ERASE);
         }
         break;
     case BLACKBOX_STATE_ERASED:
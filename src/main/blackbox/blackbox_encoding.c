@@ -32,8 +32,160 @@
 #include "blackbox_io.h"
 
 #include "common/encoding.h"
+#include "common/huffman.h"
+#include "common/maths.h"
 #include "common/printf.h"
 
+blackboxFrameBuffer_t blackboxFrameBuffer;
+
+#ifdef USE_HUFFMAN
+/*
+ * Optional compression of the log data that follows the headers. Each write to the device becomes one block:
+ *
+ *     unsigned variable byte count of the uncompressed bytes, then the codes for those bytes from the static
+ *     huffmanTable (the table the MSP dataflash read uses), padded with zero bits to a whole byte.
+ *
+ * A block with a count of zero ends the compressed data. Blocks are independent, so a block the device drops only
+ * loses the frame in it, as it would without compression.
+ *
+ * The encoder does a table lookup and a shift per byte, and a block is at most BLACKBOX_FRAME_BUFFER_SIZE bytes, so
+ * the time spent per frame is bounded and small.
+ */
+#define BLACKBOX_COMPRESSION_MAX_BLOCK BLACKBOX_FRAME_BUFFER_SIZE
+#define BLACKBOX_COMPRESSION_MAX_CODE_LEN 16
+
+static bool blackboxCompressionActive;
+static uint8_t blackboxCompressedBlock[5 + BLACKBOX_COMPRESSION_MAX_BLOCK * BLACKBOX_COMPRESSION_MAX_CODE_LEN / 8 + 1];
+
+static int blackboxCompressBlock(uint8_t *out, const uint8_t *data, int length)
+{
+    int outLength = 0;
+
+    // Count of uncompressed bytes
+    unsigned int count = length;
+    while (count > 127) {
+        out[outLength++] = (uint8_t)(count | 0x80);
+        count >>= 7;
+    }
+    out[outLength++] = count;
+
+    uint32_t bits = 0;
+    int bitCount = 0;
+
+    for (int i = 0; i < length; i++) {
+        const huffmanTable_t *entry = &huffmanTable[data[i]];
+
+        bits = (bits << entry->codeLen) | (entry->code >> (16 - entry->codeLen));
+        bitCount += entry->codeLen;
+
+        while (bitCount >= 8) {
+            bitCount -= 8;
+            out[outLength++] = bits >> bitCount;
+        }
+        bits &= (1 << bitCount) - 1;
+    }
+
+    if (bitCount > 0) {
+        out[outLength++] = bits << (8 - bitCount);
+    }
+
+    return outLength;
+}
+
+/**
+ * Compress everything written to the device from now on, until blackboxCompressionEnd().
+ */
+void blackboxCompressionBegin(void)
+{
+    blackboxCompressionActive = true;
+}
+
+void blackboxCompressionEnd(void)
+{
+    if (blackboxCompressionActive) {
+        const uint8_t endBlock = 0;
+        blackboxDeviceWriteBuf(&endBlock, sizeof(endBlock));
+        blackboxCompressionActive = false;
+    }
+}
+
+bool blackboxCompressionIsActive(void)
+{
+    return blackboxCompressionActive;
+}
+#else
+void blackboxCompressionBegin(void)
+{
+}
+
+void blackboxCompressionEnd(void)
+{
+}
+
+bool blackboxCompressionIsActive(void)
+{
+    return false;
+}
+#endif // USE_HUFFMAN
+
+/**
+ * Write to the device, through the compression stage if it is active.
+ */
+void blackboxWriteBuf(const uint8_t *data, int length)
+{
+#ifdef USE_HUFFMAN
+    if (blackboxCompressionActive) {
+        while (length > 0) {
+            const int blockLength = MIN(length, BLACKBOX_COMPRESSION_MAX_BLOCK);
+
+            blackboxDeviceWriteBuf(blackboxCompressedBlock, blackboxCompressBlock(blackboxCompressedBlock, data, blockLength));
+
+            data += blockLength;
+            length -= blockLength;
+        }
+        return;
+    }
+#endif
+    blackboxDeviceWriteBuf(data, length);
+}
+
+static void blackboxFrameFlush(void)
+{
+    if (blackboxFrameBuffer.length) {
+        blackboxWriteBuf(blackboxFrameBuffer.data, blackboxFrameBuffer.length);
+        blackboxFrameBuffer.length = 0;
+    }
+}
+
+/**
+ * Slow path of blackboxWrite(), taken outside of a frame or when a frame has outgrown the scratch buffer.
+ */
+void blackboxWriteSlow(uint8_t value)
+{
+    if (blackboxFrameBuffer.limit) {
+        blackboxFrameFlush();
+        blackboxFrameBuffer.data[blackboxFrameBuffer.length++] = value;
+    } else if (blackboxCompressionIsActive()) {
+        blackboxWriteBuf(&value, sizeof(value));
+    } else {
+        blackboxDeviceWrite(value);
+    }
+}
+
+/**
+ * Bytes written between these calls are collected and passed to the device in one write.
+ */
+void blackboxFrameBegin(void)
+{
+    blackboxFrameBuffer.length = 0;
+    blackboxFrameBuffer.limit = BLACKBOX_FRAME_BUFFER_SIZE;
+}
+
+void blackboxFrameEnd(void)
+{
+    blackboxFrameFlush();
+    blackboxFrameBuffer.limit = 0;
+}
 
 static void _putc(void *p, char c)
 {
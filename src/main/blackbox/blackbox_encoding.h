@@ -20,6 +20,40 @@
 
 #pragma once
 
+/*
+ * Frames are encoded into a scratch buffer and handed to the device in a single write once complete, rather than
+ * dispatching every encoded byte to the device. Large enough for a full I-frame.
+ */
+#define BLACKBOX_FRAME_BUFFER_SIZE 256
+
+typedef struct blackboxFrameBuffer_s {
+    uint16_t length;
+    uint16_t limit;     // BLACKBOX_FRAME_BUFFER_SIZE while a frame is being encoded, otherwise 0
+    uint8_t data[BLACKBOX_FRAME_BUFFER_SIZE];
+} blackboxFrameBuffer_t;
+
+extern blackboxFrameBuffer_t blackboxFrameBuffer;
+
+void blackboxWriteSlow(uint8_t value);
+
+static inline void blackboxWrite(uint8_t value)
+{
+    if (blackboxFrameBuffer.length < blackboxFrameBuffer.limit) {
+        blackboxFrameBuffer.data[blackboxFrameBuffer.length++] = value;
+    } else {
+        blackboxWriteSlow(value);
+    }
+}
+
+void blackboxFrameBegin(void);
+void blackboxFrameEnd(void);
+
+void blackboxWriteBuf(const uint8_t *data, int length);
+
+void blackboxCompressionBegin(void);
+void blackboxCompressionEnd(void);
+bool blackboxCompressionIsActive(void);
+
 int blackboxPrintf(const char *fmt, ...);
 void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...);
 
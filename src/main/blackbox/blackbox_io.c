@@ -29,9 +29,11 @@
 #ifdef USE_BLACKBOX
 
 #include "blackbox.h"
+#include "blackbox_encoding.h"
 #include "blackbox_io.h"
 
 #include "common/maths.h"
+#include "common/time.h"
 
 #include "flight/pid.h"
 
@@ -75,6 +77,15 @@ static struct {
 
 #endif // USE_SDCARD
 
+// Frames lost to a full device buffer since the log began
+static uint32_t blackboxDroppedFrameCount;
+#ifdef USE_FLASHFS
+static uint32_t blackboxFlashStallsAtLogStart;
+
+// With blackbox_flash_erase_ahead, enough erased flash for a few seconds of logging at high rates
+#define BLACKBOX_FLASH_ERASE_AHEAD (256 * 1024)
+#endif
+
 void blackboxOpen(void)
 {
     serialPort_t *sharedBlackboxAndMspPort = findSharedSerialPort(FUNCTION_BLACKBOX, FUNCTION_MSP);
@@ -83,7 +94,7 @@ void blackboxOpen(void)
     }
 }
 
-void blackboxWrite(uint8_t value)
+void blackboxDeviceWrite(uint8_t value)
 {
     switch (blackboxConfig()->device) {
 #ifdef USE_FLASHFS
@@ -103,39 +114,45 @@ void blackboxWrite(uint8_t value)
     }
 }
 
-// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
-int blackboxWriteString(const char *s)
+void blackboxDeviceWriteBuf(const uint8_t *data, int length)
 {
-    int length;
-    const uint8_t *pos;
-
     switch (blackboxConfig()->device) {
-
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        length = strlen(s);
-        flashfsWrite((const uint8_t*) s, length, false); // Write asynchronously
+        // Write asynchronously
+        if (!flashfsWrite(data, length, false)) {
+            blackboxDroppedFrameCount++;
+        }
         break;
-#endif // USE_FLASHFS
-
+#endif
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
-        length = strlen(s);
-        afatfs_fwrite(blackboxSDCard.logFile, (const uint8_t*) s, length); // Ignore failures due to buffers filling up
+        // Don't retry if the buffers are full, but count it
+        if (afatfs_fwrite(blackboxSDCard.logFile, data, length) < (uint32_t)length) {
+            blackboxDroppedFrameCount++;
+        }
         break;
-#endif // USE_SDCARD
-
+#endif
     case BLACKBOX_DEVICE_SERIAL:
     default:
-        pos = (uint8_t*) s;
-        while (*pos) {
-            serialWrite(blackboxPort, *pos);
-            pos++;
-        }
-
-        length = pos - (uint8_t*) s;
+        serialWriteBuf(blackboxPort, data, length);
         break;
     }
+}
+
+// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
+int blackboxWriteString(const char *s)
+{
+    const int length = strlen(s);
+
+    if (blackboxFrameBuffer.limit) {
+        // Part of a frame being assembled
+        for (int i = 0; i < length; i++) {
+            blackboxWrite(s[i]);
+        }
+    } else {
+        blackboxWriteBuf((const uint8_t*) s, length);
+    }
 
     return length;
 }
@@ -154,7 +171,8 @@ void blackboxDeviceFlush(void)
          * devices will progressively write in the background without Blackbox calling anything.
          */
     case BLACKBOX_DEVICE_FLASH:
-        flashfsFlushAsync();
+        // Whole pages only, the rest waits for the next frames
+        flashfsFlushAsync(false);
         break;
 #endif // USE_FLASHFS
 
@@ -177,7 +195,7 @@ bool blackboxDeviceFlushForce(void)
 
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        return flashfsFlushAsync();
+        return flashfsFlushAsync(true);
 #endif // USE_FLASHFS
 
 #ifdef USE_SDCARD
@@ -473,11 +491,36 @@ static bool blackboxSDCardBeginLog(void)
  */
 bool blackboxDeviceBeginLog(void)
 {
+    blackboxDroppedFrameCount = 0;
+
     switch (blackboxConfig()->device) {
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
         return blackboxSDCardBeginLog();
 #endif // USE_SDCARD
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH: {
+        // Wait for an erase in progress, unless the sectors are erased as the log reaches them
+        if (blackboxConfig()->flash_erase_ahead) {
+            flashfsSetEraseAhead(BLACKBOX_FLASH_ERASE_AHEAD);
+        } else if (flashfsIsErasing()) {
+            return false;
+        }
+
+        uint32_t timestamp = 0;
+#ifdef USE_RTC_TIME
+        rtcTime_t now;
+        if (rtcGet(&now)) {
+            timestamp = rtcTimeGetSeconds(&now);
+        }
+#endif
+        if (!flashfsLogBegin(timestamp)) {
+            return false;
+        }
+        blackboxFlashStallsAtLogStart = flashfsGetStallCount();
+        return true;
+    }
+#endif // USE_FLASHFS
     default:
         return true;
     }
@@ -512,6 +555,12 @@ bool blackboxDeviceEndLog(bool retainLog)
         }
         return false;
 #endif // USE_SDCARD
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsLogEnd();
+        flashfsSetEraseAhead(0);
+        return true;
+#endif // USE_FLASHFS
     default:
         return true;
     }
@@ -546,6 +595,26 @@ unsigned int blackboxGetLogNumber(void)
     return 0;
 }
 
+uint32_t blackboxGetDroppedFrameCount(void)
+{
+    return blackboxDroppedFrameCount;
+}
+
+/**
+ * The number of times the device was still busy when the next block of the log was ready to be written to it.
+ */
+uint32_t blackboxGetDeviceStallCount(void)
+{
+    switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        return flashfsGetStallCount() - blackboxFlashStallsAtLogStart;
+#endif
+    default:
+        return 0;
+    }
+}
+
 /**
  * Call once every loop iteration in order to maintain the global blackboxHeaderBudget with the number of bytes we can
  * transmit this iteration.
@@ -602,10 +671,9 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         /*
-         * One byte of the tx buffer isn't available for user data (due to its circular list implementation),
-         * hence the -1. Note that the USB VCP implementation doesn't use a buffer and has txBufferSize set to zero.
+         * Note that the USB VCP implementation doesn't use the port's tx buffer, and leaves it without storage.
          */
-        if (blackboxPort->txBufferSize && bytes > (int32_t) blackboxPort->txBufferSize - 1) {
+        if (blackboxPort->txBuffer.buffer && bytes > (int32_t) ringBufferSize(&blackboxPort->txBuffer)) {
             return BLACKBOX_RESERVE_PERMANENT_FAILURE;
         }
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
@@ -622,7 +690,7 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
              * that the Blackbox header writing code doesn't have to guess about the best time to ask flashfs to
              * flush, and doesn't stall waiting for a flush that would otherwise not automatically be called.
              */
-            flashfsFlushAsync();
+            flashfsFlushAsync(true);
         }
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
 #endif // USE_FLASHFS
@@ -41,7 +41,8 @@ typedef enum {
 extern int32_t blackboxHeaderBudget;
 
 void blackboxOpen(void);
-void blackboxWrite(uint8_t value);
+void blackboxDeviceWrite(uint8_t value);
+void blackboxDeviceWriteBuf(const uint8_t *data, int length);
 int blackboxWriteString(const char *s);
 
 void blackboxDeviceFlush(void);
@@ -58,6 +59,8 @@ bool blackboxDeviceEndLog(bool retainLog);
 bool isBlackboxDeviceFull(void);
 bool isBlackboxDeviceWorking(void);
 unsigned int blackboxGetLogNumber(void);
+uint32_t blackboxGetDroppedFrameCount(void);
+uint32_t blackboxGetDeviceStallCount(void);
 
 void blackboxReplenishHeaderBudget(void);
 blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
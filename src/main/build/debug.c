@@ -78,4 +78,5 @@ const char * const debugModeNames[DEBUG_COUNT] = {
     "ANTI_GRAVITY",
     "IMU",
     "KALMAN",
+    "GYRO_LATENCY",
 };
@@ -48,6 +48,27 @@ extern uint32_t sectionTimes[2][4];
 
 #endif
 
+// pipeline stage probes, only compiled in by the host replay harness (src/test/replay)
+typedef enum {
+    STAGE_FILTER,
+    STAGE_KALMAN,
+    STAGE_GYRO_ANALYSE,
+    STAGE_COUNT
+} pipelineStage_e;
+
+#ifdef USE_STAGE_TIMING
+void stageTimingBegin(pipelineStage_e stage);
+void stageTimingEnd(pipelineStage_e stage);
+
+#define STAGE_TIMING_BEGIN(stage) { stageTimingBegin(stage); }
+#define STAGE_TIMING_END(stage) { stageTimingEnd(stage); }
+#else
+
+#define STAGE_TIMING_BEGIN(stage) {}
+#define STAGE_TIMING_END(stage) {}
+
+#endif
+
 typedef enum {
     DEBUG_NONE,
     DEBUG_CYCLETIME,
@@ -96,6 +117,7 @@ typedef enum {
     DEBUG_ANTI_GRAVITY,
     DEBUG_IMU,
     DEBUG_KALMAN,
+    DEBUG_GYRO_LATENCY,
     DEBUG_COUNT
 } debugType_e;
 
@@ -124,11 +124,14 @@ static void cmsx_Blackbox_GetDeviceStatus(void)
 
         storageDeviceIsWorking = flashfsIsSupported();
         if (storageDeviceIsWorking) {
-            tfp_sprintf(cmsx_BlackboxStatus, "READY");
+            if (flashfsIsErasing()) {
+                tfp_sprintf(cmsx_BlackboxStatus, "ER %d%%", flashfsGetEraseProgress());
+            } else {
+                tfp_sprintf(cmsx_BlackboxStatus, "READY");
+            }
 
-            const flashGeometry_t *geometry = flashfsGetGeometry();
             storageUsed = flashfsGetOffset() / 1024;
-            storageFree = (geometry->totalSize / 1024) - storageUsed;
+            storageFree = (flashfsGetSize() / 1024) - storageUsed;
         } else {
             tfp_sprintf(cmsx_BlackboxStatus, "FAULT");
         }
@@ -154,18 +157,10 @@ static long cmsx_EraseFlash(displayPort_t *pDisplay, const void *ptr)
         return 0;
     }
 
-    displayClearScreen(pDisplay);
-    displayWrite(pDisplay, 5, 3, "ERASING FLASH...");
-    displayResync(pDisplay); // Was max7456RefreshAll(); Why at this timing?
+    UNUSED(pDisplay);
 
+    // The sectors are erased by a background task, the status shows the progress and it beeps when it is done
     flashfsEraseCompletely();
-    while (!flashfsIsReady()) {
-        delay(100);
-    }
-
-    beeper(BEEPER_BLACKBOX_ERASE);
-    displayClearScreen(pDisplay);
-    displayResync(pDisplay); // Was max7456RefreshAll(); wedges during heavy SPI?
 
     // Update storage device status to show new used space amount
     cmsx_Blackbox_GetDeviceStatus();
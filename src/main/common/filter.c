@@ -33,7 +33,6 @@
 
 #define M_LN2_FLOAT 	0.69314718055994530942f
 #define M_PI_FLOAT  	3.14159265358979323846f
-#define BIQUAD_Q 		(1.0f / sqrtf(2.0f))     /* quality factor - 2nd order butterworth*/
 
 // NULL filter
 
@@ -109,7 +108,11 @@ void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refr
     biquadFilterInit(filter, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
 }
 
-void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+typedef struct biquadCoefficients_s {
+    float b0, b1, b2, a1, a2;
+} biquadCoefficients_t;
+
+static void biquadFilterCoefficients(biquadCoefficients_t *coeffs, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
 {
     // setup variables
     const float omega = 2.0f * M_PI_FLOAT * filterFreq * refreshRate * 0.000001f;
@@ -149,11 +152,23 @@ void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refresh
     }
 
     // precompute the coefficients
-    filter->b0 = b0 / a0;
-    filter->b1 = b1 / a0;
-    filter->b2 = b2 / a0;
-    filter->a1 = a1 / a0;
-    filter->a2 = a2 / a0;
+    coeffs->b0 = b0 / a0;
+    coeffs->b1 = b1 / a0;
+    coeffs->b2 = b2 / a0;
+    coeffs->a1 = a1 / a0;
+    coeffs->a2 = a2 / a0;
+}
+
+void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadCoefficients_t coeffs;
+    biquadFilterCoefficients(&coeffs, filterFreq, refreshRate, Q, filterType);
+
+    filter->b0 = coeffs.b0;
+    filter->b1 = coeffs.b1;
+    filter->b2 = coeffs.b2;
+    filter->a1 = coeffs.a1;
+    filter->a2 = coeffs.a2;
 
     // zero initial samples
     filter->x1 = filter->x2 = 0;
@@ -215,3 +230,328 @@ void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize,
     filter->buf = buf;
     filter->primed = false;
 }
+
+// Three-axis filters, all axes share one call and loop so the compiler can keep them in registers
+
+void pt1FilterXyzInit(pt1FilterXyz_t *filter, float k)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        filter->state[axis] = 0.0f;
+    }
+    filter->k = k;
+}
+
+FAST_CODE void pt1FilterXyzApply(pt1FilterXyz_t *filter, float *xyz)
+{
+    const float k = filter->k;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        filter->state[axis] = filter->state[axis] + k * (xyz[axis] - filter->state[axis]);
+        xyz[axis] = filter->state[axis];
+    }
+}
+
+void biquadFilterXyzInit(biquadFilterXyz_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterXyzUpdate(filter, axis, filterFreq, refreshRate, Q, filterType);
+        filter->x1[axis] = filter->x2[axis] = 0;
+        filter->y1[axis] = filter->y2[axis] = 0;
+    }
+}
+
+// retune a single axis, sample history is preserved
+FAST_CODE void biquadFilterXyzUpdate(biquadFilterXyz_t *filter, int axis, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadCoefficients_t coeffs;
+    biquadFilterCoefficients(&coeffs, filterFreq, refreshRate, Q, filterType);
+
+    filter->b0[axis] = coeffs.b0;
+    filter->b1[axis] = coeffs.b1;
+    filter->b2[axis] = coeffs.b2;
+    filter->a1[axis] = coeffs.a1;
+    filter->a2[axis] = coeffs.a2;
+}
+
+// sample the notch coefficients once so retuning at run time needs no sin/cos
+void biquadNotchTableInit(biquadNotchTable_t *table, float minHz, float maxHz, uint32_t refreshRate, float Q)
+{
+    const float stepHz = MAX(maxHz - minHz, 1.0f) / (BIQUAD_NOTCH_TABLE_SIZE - 1);
+
+    table->minHz = minHz;
+    table->hzToIndex = 1.0f / stepHz;
+    table->Q = Q;
+    table->refreshRate = refreshRate;
+
+    for (int i = 0; i < BIQUAD_NOTCH_TABLE_SIZE; i++) {
+        biquadCoefficients_t coeffs;
+        biquadFilterCoefficients(&coeffs, minHz + i * stepHz, refreshRate, Q, FILTER_NOTCH);
+        table->b0[i] = coeffs.b0;
+        table->a1[i] = coeffs.a1;
+    }
+}
+
+bool biquadNotchTableMatches(const biquadNotchTable_t *table, uint32_t refreshRate, float Q)
+{
+    return table->refreshRate == refreshRate && fabsf(table->Q - Q) < 0.001f;
+}
+
+// retune a single axis by interpolating between table entries, sample history is preserved
+FAST_CODE void biquadFilterXyzUpdateNotchFromTable(biquadFilterXyz_t *filter, int axis, const biquadNotchTable_t *table, float filterFreq)
+{
+    const float position = constrainf((filterFreq - table->minHz) * table->hzToIndex, 0.0f, BIQUAD_NOTCH_TABLE_SIZE - 1);
+    const int index = MIN((int)position, BIQUAD_NOTCH_TABLE_SIZE - 2);
+    const float fraction = position - index;
+
+    const float b0 = table->b0[index] + fraction * (table->b0[index + 1] - table->b0[index]);
+    const float a1 = table->a1[index] + fraction * (table->a1[index + 1] - table->a1[index]);
+
+    filter->b0[axis] = b0;
+    filter->b1[axis] = a1;
+    filter->b2[axis] = b0;
+    filter->a1[axis] = a1;
+    filter->a2[axis] = 2.0f * b0 - 1.0f;
+}
+
+FAST_CODE void biquadFilterXyzApply(biquadFilterXyz_t *filter, float *xyz)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        const float input = xyz[axis];
+        const float result = filter->b0[axis] * input + filter->x1[axis];
+        filter->x1[axis] = filter->b1[axis] * input - filter->a1[axis] * result + filter->x2[axis];
+        filter->x2[axis] = filter->b2[axis] * input - filter->a2[axis] * result;
+        xyz[axis] = result;
+    }
+}
+
+FAST_CODE void biquadFilterXyzApplyDF1(biquadFilterXyz_t *filter, float *xyz)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        const float input = xyz[axis];
+        const float result = filter->b0[axis] * input + filter->b1[axis] * filter->x1[axis] + filter->b2[axis] * filter->x2[axis]
+            - filter->a1[axis] * filter->y1[axis] - filter->a2[axis] * filter->y2[axis];
+
+        filter->x2[axis] = filter->x1[axis];
+        filter->x1[axis] = input;
+
+        filter->y2[axis] = filter->y1[axis];
+        filter->y1[axis] = result;
+
+        xyz[axis] = result;
+    }
+}
+
+// Fixed-point filters, the float entry points match filterApplyFnPtr and only convert at the boundary
+
+static int32_t filterFloatToQ16(float value)
+{
+    return lrintf(value * FILTER_Q16_ONE);
+}
+
+static float filterQ16ToFloat(int32_t value)
+{
+    return value * (1.0f / FILTER_Q16_ONE);
+}
+
+static int32_t filterFloatToQ30(float value)
+{
+    // Q2.30 holds [-2, 2), +2 saturates one step short
+    return (int32_t)constrainf(value * (float)(1 << 30), (float)INT32_MIN, 2147483520.0f);
+}
+
+void pt1FilterQ15Init(pt1FilterQ15_t *filter, float k)
+{
+    filter->state = 0;
+    pt1FilterQ15UpdateCutoff(filter, k);
+}
+
+void pt1FilterQ15UpdateCutoff(pt1FilterQ15_t *filter, float k)
+{
+    filter->k = lrintf(constrainf(k, 0.0f, 1.0f) * (1 << 15));
+}
+
+FAST_CODE int32_t pt1FilterQ15ApplyFixed(pt1FilterQ15_t *filter, int32_t input)
+{
+    filter->state += (int32_t)(((int64_t)(input - filter->state) * filter->k + (1 << 14)) >> 15);
+    return filter->state;
+}
+
+FAST_CODE float pt1FilterQ15Apply(pt1FilterQ15_t *filter, float input)
+{
+    return filterQ16ToFloat(pt1FilterQ15ApplyFixed(filter, filterFloatToQ16(input)));
+}
+
+void biquadFilterQ30InitLPF(biquadFilterQ30_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterQ30Init(filter, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+void biquadFilterQ30Init(biquadFilterQ30_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadFilterQ30Update(filter, filterFreq, refreshRate, Q, filterType);
+
+    // zero initial samples
+    filter->x1 = filter->x2 = 0;
+    filter->y1 = filter->y2 = 0;
+}
+
+// sample history is preserved
+FAST_CODE void biquadFilterQ30Update(biquadFilterQ30_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadCoefficients_t coeffs;
+    biquadFilterCoefficients(&coeffs, filterFreq, refreshRate, Q, filterType);
+
+    filter->b0 = filterFloatToQ30(coeffs.b0);
+    filter->b1 = filterFloatToQ30(coeffs.b1);
+    filter->b2 = filterFloatToQ30(coeffs.b2);
+    filter->a1 = filterFloatToQ30(coeffs.a1);
+    filter->a2 = filterFloatToQ30(coeffs.a2);
+}
+
+FAST_CODE void biquadFilterQ30UpdateLPF(biquadFilterQ30_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterQ30Update(filter, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+// DF1 keeps full precision history, preferred when the coefficients change at run time
+FAST_CODE int32_t biquadFilterQ30ApplyDF1Fixed(biquadFilterQ30_t *filter, int32_t input)
+{
+    const int64_t acc = (int64_t)filter->b0 * input + (int64_t)filter->b1 * filter->x1 + (int64_t)filter->b2 * filter->x2
+        - (int64_t)filter->a1 * filter->y1 - (int64_t)filter->a2 * filter->y2;
+    const int32_t result = (int32_t)((acc + (1 << 29)) >> 30);
+
+    filter->x2 = filter->x1;
+    filter->x1 = input;
+
+    filter->y2 = filter->y1;
+    filter->y1 = result;
+
+    return result;
+}
+
+// DF2T, the two state variables are kept in x1 and x2
+FAST_CODE int32_t biquadFilterQ30ApplyFixed(biquadFilterQ30_t *filter, int32_t input)
+{
+    const int32_t result = (int32_t)(((int64_t)filter->b0 * input + (1 << 29)) >> 30) + filter->x1;
+    filter->x1 = (int32_t)(((int64_t)filter->b1 * input - (int64_t)filter->a1 * result + (1 << 29)) >> 30) + filter->x2;
+    filter->x2 = (int32_t)(((int64_t)filter->b2 * input - (int64_t)filter->a2 * result + (1 << 29)) >> 30);
+    return result;
+}
+
+FAST_CODE float biquadFilterQ30ApplyDF1(biquadFilterQ30_t *filter, float input)
+{
+    return filterQ16ToFloat(biquadFilterQ30ApplyDF1Fixed(filter, filterFloatToQ16(input)));
+}
+
+FAST_CODE float biquadFilterQ30Apply(biquadFilterQ30_t *filter, float input)
+{
+    return filterQ16ToFloat(biquadFilterQ30ApplyFixed(filter, filterFloatToQ16(input)));
+}
+
+void laggedMovingAverageQ16Init(laggedMovingAverageQ16_t *filter, uint16_t windowSize, int32_t *buf)
+{
+    filter->movingWindowIndex = 0;
+    filter->windowSize = windowSize;
+    filter->movingSum = 0;
+    filter->buf = buf;
+    filter->primed = false;
+}
+
+FAST_CODE int32_t laggedMovingAverageQ16UpdateFixed(laggedMovingAverageQ16_t *filter, int32_t input)
+{
+    if (filter->primed) {
+        filter->movingSum -= filter->buf[filter->movingWindowIndex];
+    }
+    filter->buf[filter->movingWindowIndex] = input;
+    filter->movingSum += input;
+
+    if (++filter->movingWindowIndex == filter->windowSize) {
+        filter->movingWindowIndex = 0;
+        filter->primed = true;
+    }
+
+    const int32_t denom = filter->primed ? filter->windowSize : filter->movingWindowIndex;
+    return filter->movingSum / denom;
+}
+
+FAST_CODE float laggedMovingAverageQ16Update(laggedMovingAverageQ16_t *filter, float input)
+{
+    return filterQ16ToFloat(laggedMovingAverageQ16UpdateFixed(filter, filterFloatToQ16(input)));
+}
+
+// Filter chain, only enabled stages are added so disabled filters cost nothing at run time
+
+void filterChainInit(filterChain_t *chain)
+{
+    chain->stageCount = 0;
+}
+
+pt1FilterXyz_t *filterChainAddPt1(filterChain_t *chain, float k)
+{
+    if (chain->stageCount >= FILTER_CHAIN_MAX_STAGES) {
+        return NULL;
+    }
+    filterStage_t *stage = &chain->stage[chain->stageCount++];
+    stage->type = FILTER_STAGE_PT1;
+    pt1FilterXyzInit(&stage->filter.pt1, k);
+    return &stage->filter.pt1;
+}
+
+biquadFilterXyz_t *filterChainAddBiquad(filterChain_t *chain, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    if (chain->stageCount >= FILTER_CHAIN_MAX_STAGES) {
+        return NULL;
+    }
+    filterStage_t *stage = &chain->stage[chain->stageCount++];
+    stage->type = FILTER_STAGE_BIQUAD;
+    biquadFilterXyzInit(&stage->filter.biquad, filterFreq, refreshRate, Q, filterType);
+    return &stage->filter.biquad;
+}
+
+void filterChainAddPt1Q15(filterChain_t *chain, float k)
+{
+    if (chain->stageCount >= FILTER_CHAIN_MAX_STAGES) {
+        return;
+    }
+    filterStage_t *stage = &chain->stage[chain->stageCount++];
+    stage->type = FILTER_STAGE_PT1_Q15;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pt1FilterQ15Init(&stage->filter.pt1Q15[axis], k);
+    }
+}
+
+void filterChainAddBiquadQ30(filterChain_t *chain, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    if (chain->stageCount >= FILTER_CHAIN_MAX_STAGES) {
+        return;
+    }
+    filterStage_t *stage = &chain->stage[chain->stageCount++];
+    stage->type = FILTER_STAGE_BIQUAD_Q30;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterQ30Init(&stage->filter.biquadQ30[axis], filterFreq, refreshRate, Q, filterType);
+    }
+}
+
+FAST_CODE void filterChainApply(filterChain_t *chain, float *xyz)
+{
+    for (int i = 0; i < chain->stageCount; i++) {
+        filterStage_t *stage = &chain->stage[i];
+        switch (stage->type) {
+        case FILTER_STAGE_PT1:
+            pt1FilterXyzApply(&stage->filter.pt1, xyz);
+            break;
+        case FILTER_STAGE_BIQUAD:
+            biquadFilterXyzApply(&stage->filter.biquad, xyz);
+            break;
+        case FILTER_STAGE_PT1_Q15:
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                xyz[axis] = pt1FilterQ15Apply(&stage->filter.pt1Q15[axis], xyz[axis]);
+            }
+            break;
+        case FILTER_STAGE_BIQUAD_Q30:
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                xyz[axis] = biquadFilterQ30Apply(&stage->filter.biquadQ30[axis], xyz[axis]);
+            }
+            break;
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include "arm_math.h"
 
 #include "kalman.h"
+#include "common/stats.h"
 #include "fc/fc_rc.h"
 #include "build/debug.h"
 
@@ -9,40 +10,6 @@
 
 float r_weight = 0.67f;
 
-typedef struct variance
-{
-    float xVar;
-    float yVar;
-    float zVar;
-    float xyCoVar;
-    float xzCoVar;
-    float yzCoVar;
-
-    uint32_t windex;
-    float xWindow[MAX_KALMAN_WINDOW_SIZE];
-    float yWindow[MAX_KALMAN_WINDOW_SIZE];
-    float zWindow[MAX_KALMAN_WINDOW_SIZE];
-
-    float xSumMean;
-    float ySumMean;
-    float zSumMean;
-
-    float xMean;
-    float yMean;
-    float zMean;
-
-    float xSumVar;
-    float ySumVar;
-    float zSumVar;
-    float xySumCoVar;
-    float xzSumCoVar;
-    float yzSumCoVar;
-
-    float inverseN;
-    uint32_t w;
-} variance_t;
-
-
 typedef struct kalman
 {
     float q;     //process noise covariance
@@ -55,9 +22,12 @@ typedef struct kalman
 } kalman_t;
 
 
-kalman_t    kalmanFilterStateRate[XYZ_AXIS_COUNT];
-variance_t  varStruct;
-float       setPoint[XYZ_AXIS_COUNT];
+kalman_t        kalmanFilterStateRate[XYZ_AXIS_COUNT];
+streamStats_t   varStruct;
+float           setPoint[XYZ_AXIS_COUNT];
+
+// fixed point samples, half the size of a float window
+static int16_t  kalmanWindow[MAX_KALMAN_WINDOW_SIZE * XYZ_AXIS_COUNT];
 
 
 
@@ -79,14 +49,16 @@ void kalman_init(void)
     setPoint[Y] = 0.0f;
     setPoint[Z] = 0.0f;
 
-    memset(&varStruct, 0, sizeof(varStruct));
-
     init_kalman(&kalmanFilterStateRate[X],  gyroConfig()->imuf_roll_q);
     init_kalman(&kalmanFilterStateRate[Y],  gyroConfig()->imuf_pitch_q);
     init_kalman(&kalmanFilterStateRate[Z],  gyroConfig()->imuf_yaw_q);
 
-    varStruct.w = gyroConfig()->imuf_w;
-    varStruct.inverseN = 1.0f/(float)(varStruct.w);
+    // windows longer than the buffer fall back to exponential weighting of equivalent length
+    if (gyroConfig()->imuf_w <= MAX_KALMAN_WINDOW_SIZE) {
+        streamStatsInit(&varStruct, STATS_MODE_WINDOW_FIXED, gyroConfig()->imuf_w, kalmanWindow);
+    } else {
+        streamStatsInit(&varStruct, STATS_MODE_EXPONENTIAL, gyroConfig()->imuf_w, NULL);
+    }
 }
 
 
@@ -94,53 +66,23 @@ void kalman_init(void)
 #pragma GCC optimize("O3")
 void update_kalman_covariance(float *gyroRateData)
 {
-     varStruct.xWindow[ varStruct.windex] = gyroRateData[X];
-     varStruct.yWindow[ varStruct.windex] = gyroRateData[Y];
-     varStruct.zWindow[ varStruct.windex] = gyroRateData[Z];
-
-     varStruct.xSumMean +=  varStruct.xWindow[ varStruct.windex];
-     varStruct.ySumMean +=  varStruct.yWindow[ varStruct.windex];
-     varStruct.zSumMean +=  varStruct.zWindow[ varStruct.windex];
-     varStruct.xSumVar =  varStruct.xSumVar + ( varStruct.xWindow[ varStruct.windex] *  varStruct.xWindow[ varStruct.windex]);
-     varStruct.ySumVar =  varStruct.ySumVar + ( varStruct.yWindow[ varStruct.windex] *  varStruct.yWindow[ varStruct.windex]);
-     varStruct.zSumVar =  varStruct.zSumVar + ( varStruct.zWindow[ varStruct.windex] *  varStruct.zWindow[ varStruct.windex]);
-     varStruct.xySumCoVar =  varStruct.xySumCoVar + ( varStruct.xWindow[ varStruct.windex] *  varStruct.yWindow[ varStruct.windex]);
-     varStruct.xzSumCoVar =  varStruct.xzSumCoVar + ( varStruct.xWindow[ varStruct.windex] *  varStruct.zWindow[ varStruct.windex]);
-     varStruct.yzSumCoVar =  varStruct.yzSumCoVar + ( varStruct.yWindow[ varStruct.windex] *  varStruct.zWindow[ varStruct.windex]);
-     varStruct.windex++;
-    if ( varStruct.windex >= varStruct.w)
-    {
-         varStruct.windex = 0;
-    }
-     varStruct.xSumMean -=  varStruct.xWindow[ varStruct.windex];
-     varStruct.ySumMean -=  varStruct.yWindow[ varStruct.windex];
-     varStruct.zSumMean -=  varStruct.zWindow[ varStruct.windex];
-     varStruct.xSumVar =  varStruct.xSumVar - ( varStruct.xWindow[ varStruct.windex] *  varStruct.xWindow[ varStruct.windex]);
-     varStruct.ySumVar =  varStruct.ySumVar - ( varStruct.yWindow[ varStruct.windex] *  varStruct.yWindow[ varStruct.windex]);
-     varStruct.zSumVar =  varStruct.zSumVar - ( varStruct.zWindow[ varStruct.windex] *  varStruct.zWindow[ varStruct.windex]);
-     varStruct.xySumCoVar =  varStruct.xySumCoVar - ( varStruct.xWindow[ varStruct.windex] *  varStruct.yWindow[ varStruct.windex]);
-     varStruct.xzSumCoVar =  varStruct.xzSumCoVar - ( varStruct.xWindow[ varStruct.windex] *  varStruct.zWindow[ varStruct.windex]);
-     varStruct.yzSumCoVar =  varStruct.yzSumCoVar - ( varStruct.yWindow[ varStruct.windex] *  varStruct.zWindow[ varStruct.windex]);
-
-     varStruct.xMean =  varStruct.xSumMean *  varStruct.inverseN;
-     varStruct.yMean =  varStruct.ySumMean *  varStruct.inverseN;
-     varStruct.zMean =  varStruct.zSumMean *  varStruct.inverseN;
-
-     varStruct.xVar =  ABS(varStruct.xSumVar *  varStruct.inverseN - ( varStruct.xMean *  varStruct.xMean));
-     varStruct.yVar =  ABS(varStruct.ySumVar *  varStruct.inverseN - ( varStruct.yMean *  varStruct.yMean));
-     varStruct.zVar =  ABS(varStruct.zSumVar *  varStruct.inverseN - ( varStruct.zMean *  varStruct.zMean));
-     varStruct.xyCoVar =  ABS(varStruct.xySumCoVar *  varStruct.inverseN - ( varStruct.xMean *  varStruct.yMean));
-     varStruct.xzCoVar =  ABS(varStruct.xzSumCoVar *  varStruct.inverseN - ( varStruct.xMean *  varStruct.zMean));
-     varStruct.yzCoVar =  ABS(varStruct.yzSumCoVar *  varStruct.inverseN - ( varStruct.yMean *  varStruct.zMean));
+    streamStatsPush(&varStruct, gyroRateData);
+
+    const float xVar = streamStatsVariance(&varStruct, X);
+    const float yVar = streamStatsVariance(&varStruct, Y);
+    const float zVar = streamStatsVariance(&varStruct, Z);
+    const float xyCoVar = ABS(streamStatsCovariance(&varStruct, STATS_XY));
+    const float xzCoVar = ABS(streamStatsCovariance(&varStruct, STATS_XZ));
+    const float yzCoVar = ABS(streamStatsCovariance(&varStruct, STATS_YZ));
 
     float squirt;
-    arm_sqrt_f32(varStruct.xVar +  varStruct.xyCoVar +  varStruct.xzCoVar, &squirt);
+    arm_sqrt_f32(xVar + xyCoVar + xzCoVar, &squirt);
     kalmanFilterStateRate[X].r = squirt * r_weight;
 
-    arm_sqrt_f32(varStruct.yVar +  varStruct.xyCoVar +  varStruct.yzCoVar, &squirt);
+    arm_sqrt_f32(yVar + xyCoVar + yzCoVar, &squirt);
     kalmanFilterStateRate[Y].r = squirt * r_weight;
 
-    arm_sqrt_f32(varStruct.zVar +  varStruct.yzCoVar +  varStruct.xzCoVar, &squirt);
+    arm_sqrt_f32(zVar + yzCoVar + xzCoVar, &squirt);
     kalmanFilterStateRate[Z].r = squirt * r_weight;
 }
 
@@ -0,0 +1,113 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/maths.h"
+
+#include "ring_buffer.h"
+
+/**
+ * size must be a power of two.
+ */
+void ringBufferInit(ringBuffer_t *rb, uint8_t *buffer, uint32_t size)
+{
+    rb->buffer = buffer;
+    rb->mask = size - 1;
+    ringBufferReset(rb);
+}
+
+void ringBufferReset(ringBuffer_t *rb)
+{
+    rb->head = 0;
+    rb->tail = 0;
+}
+
+/**
+ * The contiguous data at the tail, returns its length which is zero when the buffer is empty.
+ */
+uint32_t ringBufferPeekSpan(const ringBuffer_t *rb, uint8_t **data)
+{
+    const uint32_t tail = rb->tail;
+    const uint32_t offset = tail & rb->mask;
+
+    *data = &rb->buffer[offset];
+
+    return MIN(rb->head - tail, ringBufferSize(rb) - offset);
+}
+
+/**
+ * The contiguous free space at the head, returns its length which is zero when the buffer is full.
+ */
+uint32_t ringBufferWriteSpan(const ringBuffer_t *rb, uint8_t **data)
+{
+    const uint32_t head = rb->head;
+    const uint32_t offset = head & rb->mask;
+
+    *data = &rb->buffer[offset];
+
+    return MIN(ringBufferSize(rb) - (head - rb->tail), ringBufferSize(rb) - offset);
+}
+
+/**
+ * Copy in as much of data as fits, in at most two spans. Returns the number of bytes copied.
+ */
+uint32_t ringBufferPushN(ringBuffer_t *rb, const uint8_t *data, uint32_t count)
+{
+    uint32_t pushed = 0;
+
+    while (pushed < count) {
+        uint8_t *span;
+        const uint32_t length = MIN(ringBufferWriteSpan(rb, &span), count - pushed);
+
+        if (length == 0) {
+            break;
+        }
+        memcpy(span, data + pushed, length);
+        ringBufferCommit(rb, length);
+        pushed += length;
+    }
+
+    return pushed;
+}
+
+/**
+ * Copy out up to count bytes, in at most two spans. Returns the number of bytes copied.
+ */
+uint32_t ringBufferPopN(ringBuffer_t *rb, uint8_t *data, uint32_t count)
+{
+    uint32_t popped = 0;
+
+    while (popped < count) {
+        uint8_t *span;
+        const uint32_t length = MIN(ringBufferPeekSpan(rb, &span), count - popped);
+
+        if (length == 0) {
+            break;
+        }
+        memcpy(data + popped, span, length);
+        ringBufferConsume(rb, length);
+        popped += length;
+    }
+
+    return popped;
+}
@@ -0,0 +1,123 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Single producer, single consumer byte ring buffer, shared by the serial drivers.
+ *
+ * The producer only writes the head and the consumer only writes the tail, so one side can run in an interrupt handler
+ * without any locking. The indices run freely and are masked on access, which needs a power of two size and lets the
+ * whole buffer be used.
+ *
+ * Besides single bytes, data can be moved in bulk, or in place through the contiguous span at either end for DMA and
+ * parsers: peek the span, use it, then consume or commit what was used.
+ */
+
+// Orders the buffer accesses before the index update that hands them to the other side
+#define RING_BUFFER_BARRIER() __asm__ volatile ("" ::: "memory")
+
+typedef struct ringBuffer_s {
+    uint8_t *buffer;
+    uint32_t mask;              // size - 1
+    volatile uint32_t head;     // written by the producer only
+    volatile uint32_t tail;     // written by the consumer only
+} ringBuffer_t;
+
+void ringBufferInit(ringBuffer_t *rb, uint8_t *buffer, uint32_t size);
+void ringBufferReset(ringBuffer_t *rb);
+
+uint32_t ringBufferPushN(ringBuffer_t *rb, const uint8_t *data, uint32_t count);
+uint32_t ringBufferPopN(ringBuffer_t *rb, uint8_t *data, uint32_t count);
+
+uint32_t ringBufferPeekSpan(const ringBuffer_t *rb, uint8_t **data);
+uint32_t ringBufferWriteSpan(const ringBuffer_t *rb, uint8_t **data);
+
+static inline uint32_t ringBufferSize(const ringBuffer_t *rb)
+{
+    return rb->mask + 1;
+}
+
+static inline uint32_t ringBufferUsed(const ringBuffer_t *rb)
+{
+    return rb->head - rb->tail;
+}
+
+static inline uint32_t ringBufferFree(const ringBuffer_t *rb)
+{
+    return ringBufferSize(rb) - ringBufferUsed(rb);
+}
+
+static inline bool ringBufferIsEmpty(const ringBuffer_t *rb)
+{
+    return rb->head == rb->tail;
+}
+
+/*
+ * Producer side
+ */
+
+// Returns false, dropping the byte, if the buffer is full
+static inline bool ringBufferPush(ringBuffer_t *rb, uint8_t byte)
+{
+    const uint32_t head = rb->head;
+
+    if (head - rb->tail > rb->mask) {
+        return false;
+    }
+    rb->buffer[head & rb->mask] = byte;
+    RING_BUFFER_BARRIER();
+    rb->head = head + 1;
+
+    return true;
+}
+
+// Publish count bytes written to the span from ringBufferWriteSpan()
+static inline void ringBufferCommit(ringBuffer_t *rb, uint32_t count)
+{
+    RING_BUFFER_BARRIER();
+    rb->head += count;
+}
+
+/*
+ * Consumer side
+ */
+
+// The buffer must not be empty
+static inline uint8_t ringBufferPop(ringBuffer_t *rb)
+{
+    const uint32_t tail = rb->tail;
+    const uint8_t byte = rb->buffer[tail & rb->mask];
+
+    RING_BUFFER_BARRIER();
+    rb->tail = tail + 1;
+
+    return byte;
+}
+
+// Release count bytes read from the span from ringBufferPeekSpan()
+static inline void ringBufferConsume(ringBuffer_t *rb, uint32_t count)
+{
+    RING_BUFFER_BARRIER();
+    rb->tail += count;
+}
@@ -0,0 +1,182 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/stats.h"
+
+static void statsMomentsReset(statsMoments_t *moments)
+{
+    memset(moments, 0, sizeof(statsMoments_t));
+}
+
+/*
+ * Welford's update for a growing sample set
+ */
+static FAST_CODE void statsMomentsAdd(statsMoments_t *moments, const float *x)
+{
+    float delta[XYZ_AXIS_COUNT];
+    float deltaNew[XYZ_AXIS_COUNT];
+
+    moments->n++;
+    const float inverseN = 1.0f / moments->n;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        delta[axis] = x[axis] - moments->mean[axis];
+        moments->mean[axis] += delta[axis] * inverseN;
+        deltaNew[axis] = x[axis] - moments->mean[axis];
+        moments->m2[axis] += delta[axis] * deltaNew[axis];
+    }
+    moments->c2[STATS_XY] += delta[X] * deltaNew[Y];
+    moments->c2[STATS_XZ] += delta[X] * deltaNew[Z];
+    moments->c2[STATS_YZ] += delta[Y] * deltaNew[Z];
+}
+
+/*
+ * Fixed size window update, sample y leaves as sample x enters
+ */
+static FAST_CODE void statsMomentsSlide(statsMoments_t *moments, const float *x, const float *y, float inverseN)
+{
+    float deltaX[XYZ_AXIS_COUNT];
+    float deltaY[XYZ_AXIS_COUNT];
+    float deltaXNew[XYZ_AXIS_COUNT];
+    float deltaYNew[XYZ_AXIS_COUNT];
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        deltaX[axis] = x[axis] - moments->mean[axis];
+        deltaY[axis] = y[axis] - moments->mean[axis];
+        moments->mean[axis] += (x[axis] - y[axis]) * inverseN;
+        deltaXNew[axis] = x[axis] - moments->mean[axis];
+        deltaYNew[axis] = y[axis] - moments->mean[axis];
+        moments->m2[axis] += deltaX[axis] * deltaXNew[axis] - deltaY[axis] * deltaYNew[axis];
+    }
+    moments->c2[STATS_XY] += deltaX[X] * deltaXNew[Y] - deltaY[X] * deltaYNew[Y];
+    moments->c2[STATS_XZ] += deltaX[X] * deltaXNew[Z] - deltaY[X] * deltaYNew[Z];
+    moments->c2[STATS_YZ] += deltaX[Y] * deltaXNew[Z] - deltaY[Y] * deltaYNew[Z];
+}
+
+/*
+ * Exponentially weighted update, m2 and c2 hold the variance and covariance directly
+ */
+static FAST_CODE void statsMomentsDecay(statsMoments_t *moments, const float *x, float alpha)
+{
+    float delta[XYZ_AXIS_COUNT];
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        delta[axis] = x[axis] - moments->mean[axis];
+        moments->mean[axis] += alpha * delta[axis];
+        moments->m2[axis] = (1.0f - alpha) * (moments->m2[axis] + alpha * delta[axis] * delta[axis]);
+    }
+    moments->c2[STATS_XY] = (1.0f - alpha) * (moments->c2[STATS_XY] + alpha * delta[X] * delta[Y]);
+    moments->c2[STATS_XZ] = (1.0f - alpha) * (moments->c2[STATS_XZ] + alpha * delta[X] * delta[Z]);
+    moments->c2[STATS_YZ] = (1.0f - alpha) * (moments->c2[STATS_YZ] + alpha * delta[Y] * delta[Z]);
+}
+
+/*
+ * windowBuf must hold windowSize * XYZ_AXIS_COUNT floats (STATS_MODE_WINDOW) or int16_t (STATS_MODE_WINDOW_FIXED),
+ * it is not used for STATS_MODE_EXPONENTIAL where windowSize sets the equivalent averaging length
+ */
+void streamStatsInit(streamStats_t *stats, statsMode_e mode, uint16_t windowSize, void *windowBuf)
+{
+    memset(stats, 0, sizeof(streamStats_t));
+
+    stats->mode = mode;
+    stats->windowSize = MAX(windowSize, 1);
+
+    switch (mode) {
+    case STATS_MODE_WINDOW:
+        stats->window.f = windowBuf;
+        memset(windowBuf, 0, stats->windowSize * XYZ_AXIS_COUNT * sizeof(float));
+        break;
+    case STATS_MODE_WINDOW_FIXED:
+        stats->window.fixed = windowBuf;
+        memset(windowBuf, 0, stats->windowSize * XYZ_AXIS_COUNT * sizeof(int16_t));
+        break;
+    case STATS_MODE_EXPONENTIAL:
+        break;
+    }
+
+    // window starts out full of zeros, same as the running moments
+    stats->running.n = stats->windowSize;
+    stats->inverseN = (mode == STATS_MODE_EXPONENTIAL) ? 1.0f : 1.0f / stats->windowSize;
+    stats->alpha = 2.0f / (stats->windowSize + 1);
+}
+
+FAST_CODE void streamStatsPush(streamStats_t *stats, const float *xyz)
+{
+    float x[XYZ_AXIS_COUNT];
+    float y[XYZ_AXIS_COUNT];
+    const int offset = stats->windex * XYZ_AXIS_COUNT;
+
+    switch (stats->mode) {
+    case STATS_MODE_WINDOW:
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            x[axis] = xyz[axis];
+            y[axis] = stats->window.f[offset + axis];
+            stats->window.f[offset + axis] = x[axis];
+        }
+        break;
+    case STATS_MODE_WINDOW_FIXED:
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            // use the stored value for the statistics too, so removing it later exactly undoes adding it
+            const int16_t sample = constrain(lrintf(xyz[axis] * STATS_FIXED_SCALE), INT16_MIN, INT16_MAX);
+            x[axis] = sample * (1.0f / STATS_FIXED_SCALE);
+            y[axis] = stats->window.fixed[offset + axis] * (1.0f / STATS_FIXED_SCALE);
+            stats->window.fixed[offset + axis] = sample;
+        }
+        break;
+    case STATS_MODE_EXPONENTIAL:
+    default:
+        statsMomentsDecay(&stats->running, xyz, stats->alpha);
+        return;
+    }
+
+    statsMomentsSlide(&stats->running, x, y, stats->inverseN);
+    statsMomentsAdd(&stats->shadow, x);
+
+    stats->windex++;
+    if (stats->windex >= stats->windowSize) {
+        stats->windex = 0;
+        // shadow now covers exactly the samples in the window
+        stats->running = stats->shadow;
+        statsMomentsReset(&stats->shadow);
+    }
+}
+
+float streamStatsMean(const streamStats_t *stats, int axis)
+{
+    return stats->running.mean[axis];
+}
+
+FAST_CODE float streamStatsVariance(const streamStats_t *stats, int axis)
+{
+    return MAX(stats->running.m2[axis] * stats->inverseN, 0.0f);
+}
+
+FAST_CODE float streamStatsCovariance(const streamStats_t *stats, statsPair_e pair)
+{
+    return stats->running.c2[pair] * stats->inverseN;
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/axis.h"
+
+// fixed point window samples are stored in 1/8 units, +-4096 deg/s fits in int16
+#define STATS_FIXED_SCALE 8.0f
+
+typedef enum {
+    STATS_MODE_WINDOW = 0,      // sliding window of float samples
+    STATS_MODE_WINDOW_FIXED,    // sliding window of int16 samples, half the memory
+    STATS_MODE_EXPONENTIAL,     // exponentially weighted, no window needed
+} statsMode_e;
+
+typedef enum {
+    STATS_XY = 0,
+    STATS_XZ,
+    STATS_YZ,
+    STATS_PAIR_COUNT
+} statsPair_e;
+
+typedef struct statsMoments_s {
+    uint16_t n;
+    float mean[XYZ_AXIS_COUNT];
+    float m2[XYZ_AXIS_COUNT];       // sum of squared deviations from the mean
+    float c2[STATS_PAIR_COUNT];     // sum of co-deviations
+} statsMoments_t;
+
+// streaming mean, variance and covariance of three axes
+typedef struct streamStats_s {
+    statsMode_e mode;
+    uint16_t windowSize;
+    uint16_t windex;
+    float inverseN;
+    float alpha;
+    statsMoments_t running;
+    // exact moments of the samples added since the window last wrapped,
+    // replaces the running moments on wrap so rounding errors never build up
+    statsMoments_t shadow;
+    union {
+        float *f;
+        int16_t *fixed;
+    } window;                       // windowSize samples, X/Y/Z interleaved
+} streamStats_t;
+
+void streamStatsInit(streamStats_t *stats, statsMode_e mode, uint16_t windowSize, void *windowBuf);
+void streamStatsPush(streamStats_t *stats, const float *xyz);
+float streamStatsMean(const streamStats_t *stats, int axis);
+float streamStatsVariance(const streamStats_t *stats, int axis);
+float streamStatsCovariance(const streamStats_t *stats, statsPair_e pair);
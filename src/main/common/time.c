@@ -73,7 +73,7 @@ static rtcTime_t dateTimeToRtcTime(dateTime_t *dt)
     return rtcTimeMake(unixTime, dt->millis);
 }
 
-static void rtcTimeToDateTime(dateTime_t *dt, rtcTime_t t)
+void rtcTimeToDateTime(dateTime_t *dt, rtcTime_t t)
 {
     int32_t unixTime = t / MILLIS_PER_SECOND - EPOCH_2000_OFFSET;
     dt->seconds = unixTime % 60;
@@ -92,6 +92,8 @@ bool rtcHasTime(void);
 bool rtcGet(rtcTime_t *t);
 bool rtcSet(rtcTime_t *t);
 
+void rtcTimeToDateTime(dateTime_t *dt, rtcTime_t t);
+
 bool rtcGetDateTime(dateTime_t *dt);
 bool rtcSetDateTime(dateTime_t *dt);
 
@@ -26,6 +26,7 @@
 
 #include "build/build_config.h"
 
+#include "common/bitarray.h"
 #include "common/crc.h"
 #include "common/utils.h"
 
@@ -41,6 +42,17 @@ extern uint8_t __config_start;   // configured via linker script when building b
 extern uint8_t __config_end;
 #endif
 
+// Targets with room for more than one erase unit of config can set this in target.h, compaction
+// then writes the config to the next bank while the active one still holds the last save
+#ifndef EEPROM_BANK_COUNT
+#define EEPROM_BANK_COUNT 1
+#endif
+
+#define EEPROM_BANK_SIZE ((&__config_end - &__config_start) / EEPROM_BANK_COUNT)
+
+// PGs past this many registry entries are written on every save
+#define EEPROM_TRACKED_PG_COUNT 128
+
 static uint16_t eepromConfigSize;
 
 typedef enum {
@@ -56,6 +68,10 @@ typedef enum {
 typedef struct {
     uint8_t eepromConfigVersion;
     uint8_t magic_be;           // magic number, should be 0xBE
+#if EEPROM_BANK_COUNT > 1
+    // Only banked targets need it, keeping the header of a single bank as it was saved by earlier firmware
+    uint16_t generation;        // one more than the bank it was compacted from
+#endif
 } PG_PACKED configHeader_t;
 
 // Header for each stored PG.
@@ -77,6 +93,22 @@ typedef struct {
 } PG_PACKED configFooter_t;
 // checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
 
+// Each bank holds a log of segments. The first one starts after the header and holds every PG,
+// the ones appended after it hold only the PGs that changed since the last save. A segment is a
+// run of records closed by a footer and its own checksum, padded out to the flash word.
+typedef struct {
+    const uint8_t *bank;    // start of the active bank, NULL if no bank holds a valid config
+    const uint8_t *end;     // end of the last valid segment, where the next one is appended
+    bool appendable;        // the rest of the bank is erased and the header is current
+    uint16_t generation;    // generation of the active bank
+} configLog_t;
+
+static configLog_t configLog;
+
+// CRC of the record each PG was last loaded from or saved to
+static uint16_t pgRecordCrc[EEPROM_TRACKED_PG_COUNT];
+static uint32_t pgRecordStored[(EEPROM_TRACKED_PG_COUNT + 31) / 32];
+
 // Used to check the compiler packing at build time.
 typedef struct {
     uint8_t byte;
@@ -90,67 +122,144 @@ void initEEPROM(void)
     BUILD_BUG_ON(offsetof(packingTest_t, word) != 1);
     BUILD_BUG_ON(sizeof(packingTest_t) != 5);
 
+#if EEPROM_BANK_COUNT > 1
+    BUILD_BUG_ON(sizeof(configHeader_t) != 4);
+#else
+    BUILD_BUG_ON(sizeof(configHeader_t) != 2);
+#endif
     BUILD_BUG_ON(sizeof(configFooter_t) != 2);
     BUILD_BUG_ON(sizeof(configRecord_t) != 6);
 }
 
-bool isEEPROMVersionValid(void)
+static const uint8_t *bankStart(int bank)
 {
-    const uint8_t *p = &__config_start;
-    const configHeader_t *header = (const configHeader_t *)p;
+    return &__config_start + bank * EEPROM_BANK_SIZE;
+}
 
-    if (header->eepromConfigVersion != EEPROM_CONF_VERSION) {
-        return false;
+static const uint8_t *alignToWord(const uint8_t *bank, const uint8_t *p)
+{
+    return bank + ((p - bank + 3) & ~3);
+}
+
+// Returns the end of the segment at p, or NULL if no complete segment starts there.
+// The checksum covers everything from crcStart, which lets the first segment include the header.
+static const uint8_t *scanSegment(const uint8_t *bank, const uint8_t *p, const uint8_t *crcStart)
+{
+    const uint8_t *bankEnd = bank + EEPROM_BANK_SIZE;
+
+    for (;;) {
+        if (p + sizeof(configFooter_t) + sizeof(uint16_t) > bankEnd) {
+            return NULL;
+        }
+
+        const configRecord_t *record = (const configRecord_t *)p;
+
+        if (record->size == 0) {
+            // Found the footer.
+            break;
+        }
+        if (record->size == 0xFFFF              // erased flash, the log ends here
+            || p + record->size >= bankEnd
+            || record->size < sizeof(*record)) {
+            return NULL;
+        }
+
+        p += record->size;
     }
 
-    return true;
+    // include stored CRC in the CRC calculation
+    p += sizeof(configFooter_t) + sizeof(uint16_t);
+
+    // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
+    if (crc16_ccitt_update(CRC_START_VALUE, crcStart, p - crcStart) != CRC_CHECK_VALUE) {
+        return NULL;
+    }
+
+    return alignToWord(bank, p);
 }
 
-// Scan the EEPROM config. Returns true if the config is valid.
-bool isEEPROMStructureValid(void)
+static bool scanBank(const uint8_t *bank, configLog_t *log)
 {
-    const uint8_t *p = &__config_start;
-    const configHeader_t *header = (const configHeader_t *)p;
+    const configHeader_t *header = (const configHeader_t *)bank;
 
     if (header->magic_be != 0xBE) {
         return false;
     }
 
-    uint16_t crc = CRC_START_VALUE;
-    crc = crc16_ccitt_update(crc, header, sizeof(*header));
-    p += sizeof(*header);
+    const uint8_t *end = scanSegment(bank, bank + sizeof(*header), bank);
+    if (!end) {
+        return false;
+    }
 
-    for (;;) {
-        const configRecord_t *record = (const configRecord_t *)p;
+    const uint8_t *next;
+    while ((next = scanSegment(bank, end, end))) {
+        end = next;
+    }
 
-        if (record->size == 0) {
-            // Found the end.  Stop scanning.
-            break;
+    log->bank = bank;
+    log->end = end;
+#if EEPROM_BANK_COUNT > 1
+    log->generation = header->generation;
+#else
+    log->generation = 0;
+#endif
+
+    // A torn write leaves programmed bytes after the end, and a header from another
+    // config version has to be rewritten before the version check passes
+    log->appendable = header->eepromConfigVersion == EEPROM_CONF_VERSION;
+    for (const uint8_t *p = end; p < bank + EEPROM_BANK_SIZE && log->appendable; p++) {
+        if (*p != 0xFF) {
+            log->appendable = false;
         }
-        if (p + record->size >= &__config_end
-            || record->size < sizeof(*record)) {
-            // Too big or too small.
-            return false;
+    }
+
+    return true;
+}
+
+// Finds the bank holding the config. Compaction retires the old bank once the new one is written,
+// a reset in between leaves both valid and the old one misses the save that compacted it, so the
+// newest generation wins. Generations wrap, they are compared by their difference.
+static void scanEEPROM(void)
+{
+    configLog.bank = NULL;
+    configLog.end = NULL;
+    configLog.appendable = false;
+    configLog.generation = 0;
+
+    for (int bank = 0; bank < EEPROM_BANK_COUNT; bank++) {
+        configLog_t candidate;
+        if (scanBank(bankStart(bank), &candidate)
+            && (!configLog.bank || (int16_t)(candidate.generation - configLog.generation) > 0)) {
+            configLog = candidate;
         }
+    }
 
-        crc = crc16_ccitt_update(crc, p, record->size);
+    eepromConfigSize = configLog.bank ? configLog.end - configLog.bank : 0;
+}
 
-        p += record->size;
+bool isEEPROMVersionValid(void)
+{
+    scanEEPROM();
+
+    if (!configLog.bank) {
+        return false;
     }
 
-    const configFooter_t *footer = (const configFooter_t *)p;
-    crc = crc16_ccitt_update(crc, footer, sizeof(*footer));
-    p += sizeof(*footer);
+    const configHeader_t *header = (const configHeader_t *)configLog.bank;
 
-    // include stored CRC in the CRC calculation
-    const uint16_t *storedCrc = (const uint16_t *)p;
-    crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
+    if (header->eepromConfigVersion != EEPROM_CONF_VERSION) {
+        return false;
+    }
 
-    eepromConfigSize = p - &__config_start;
+    return true;
+}
 
-    // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
-    return crc == CRC_CHECK_VALUE;
+// Scan the EEPROM config. Returns true if the config is valid.
+bool isEEPROMStructureValid(void)
+{
+    scanEEPROM();
+
+    return configLog.bank != NULL;
 }
 
 uint16_t getEEPROMConfigSize(void)
@@ -158,26 +267,81 @@ uint16_t getEEPROMConfigSize(void)
     return eepromConfigSize;
 }
 
-// find config record for reg + classification (profile info) in EEPROM
+// find the latest config record for reg + classification (profile info) in EEPROM
 // return NULL when record is not found
-// this function assumes that EEPROM content is valid
+// this function assumes that configLog was scanned
 static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
 {
-    const uint8_t *p = &__config_start;
+    const configRecord_t *found = NULL;
+
+    if (!configLog.bank) {
+        return NULL;
+    }
+
+    const uint8_t *p = configLog.bank;
     p += sizeof(configHeader_t);             // skip header
-    while (true) {
+    while (p < configLog.end) {
         const configRecord_t *record = (const configRecord_t *)p;
-        if (record->size == 0
-            || p + record->size >= &__config_end
-            || record->size < sizeof(*record))
-            break;
+        if (record->size == 0) {
+            // skip the footer and CRC to the next segment
+            p = alignToWord(configLog.bank, p + sizeof(configFooter_t) + sizeof(uint16_t));
+            continue;
+        }
         if (pgN(reg) == record->pgn
             && (record->flags & CR_CLASSIFICATION_MASK) == classification)
-            return record;
+            found = record;
         p += record->size;
     }
-    // record not found
-    return NULL;
+
+    return found;
+}
+
+static unsigned pgIndex(const pgRegistry_t *reg)
+{
+    return reg - __pg_registry_start;
+}
+
+static void pgRecordSetStored(const pgRegistry_t *reg, uint16_t crc)
+{
+    const unsigned index = pgIndex(reg);
+
+    if (index < EEPROM_TRACKED_PG_COUNT) {
+        pgRecordCrc[index] = crc;
+        bitArraySet(pgRecordStored, index);
+    }
+}
+
+static void pgRecordClearStored(void)
+{
+    memset(pgRecordStored, 0, sizeof(pgRecordStored));
+}
+
+static void pgRecordHeader(configRecord_t *record, const pgRegistry_t *reg)
+{
+    record->size = sizeof(configRecord_t) + pgSize(reg);
+    record->pgn = pgN(reg);
+    record->version = pgVersion(reg);
+    record->flags = 0;
+
+    record->flags |= CR_CLASSICATION_SYSTEM;
+}
+
+static uint16_t pgRecordCrcInRam(const pgRegistry_t *reg)
+{
+    configRecord_t record;
+    pgRecordHeader(&record, reg);
+
+    uint16_t crc = crc16_ccitt_update(CRC_START_VALUE, (uint8_t *)&record, sizeof(record));
+    return crc16_ccitt_update(crc, reg->address, pgSize(reg));
+}
+
+static bool pgRecordIsDirty(const pgRegistry_t *reg)
+{
+    const unsigned index = pgIndex(reg);
+
+    return index >= EEPROM_TRACKED_PG_COUNT
+        || !bitArrayGet(pgRecordStored, index)
+        || pgRecordCrc[index] != pgRecordCrcInRam(reg);
 }
 
 // Initialize all PG records from EEPROM.
@@ -187,6 +351,9 @@ bool loadEEPROM(void)
 {
     bool success = true;
 
+    scanEEPROM();
+    pgRecordClearStored();
+
     PG_FOREACH(reg) {
         const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
         if (rec) {
@@ -194,6 +361,8 @@ bool loadEEPROM(void)
             if (!pgLoad(reg, rec->pg, rec->size - offsetof(configRecord_t, pg), rec->version)) {
                 success = false;
             }
+            // a record pgLoad reset from won't match what is in RAM, so it is written on the next save
+            pgRecordSetStored(reg, crc16_ccitt_update(CRC_START_VALUE, rec, rec->size));
         } else {
             pgReset(reg);
 
@@ -204,35 +373,49 @@ bool loadEEPROM(void)
     return success;
 }
 
-static bool writeSettingsToEEPROM(void)
+// Writes a segment at base holding the dirty PGs, or the header and every PG when base starts the bank
+static bool writeSegment(const uint8_t *bank, const uint8_t *base, uint16_t generation)
 {
+#if EEPROM_BANK_COUNT == 1
+    UNUSED(generation);
+#endif
+    const bool startOfBank = base == bank;
+
     config_streamer_t streamer;
     config_streamer_init(&streamer);
 
-    config_streamer_start(&streamer, (uintptr_t)&__config_start, &__config_end - &__config_start);
-
-    configHeader_t header = {
-        .eepromConfigVersion =  EEPROM_CONF_VERSION,
-        .magic_be =             0xBE,
-    };
+    config_streamer_start(&streamer, (uintptr_t)base, bank + EEPROM_BANK_SIZE - base);
 
-    config_streamer_write(&streamer, (uint8_t *)&header, sizeof(header));
     uint16_t crc = CRC_START_VALUE;
-    crc = crc16_ccitt_update(crc, (uint8_t *)&header, sizeof(header));
+
+    if (startOfBank) {
+        configHeader_t header = {
+            .eepromConfigVersion =  EEPROM_CONF_VERSION,
+            .magic_be =             0xBE,
+#if EEPROM_BANK_COUNT > 1
+            .generation =           generation,
+#endif
+        };
+
+        config_streamer_write(&streamer, (uint8_t *)&header, sizeof(header));
+        crc = crc16_ccitt_update(crc, (uint8_t *)&header, sizeof(header));
+    }
+
     PG_FOREACH(reg) {
+        if (!startOfBank && !pgRecordIsDirty(reg)) {
+            continue;
+        }
+
+        configRecord_t record;
+        pgRecordHeader(&record, reg);
         const uint16_t regSize = pgSize(reg);
-        configRecord_t record = {
-            .size = sizeof(configRecord_t) + regSize,
-            .pgn = pgN(reg),
-            .version = pgVersion(reg),
-            .flags = 0
-        };
 
-        record.flags |= CR_CLASSICATION_SYSTEM;
         config_streamer_write(&streamer, (uint8_t *)&record, sizeof(record));
         crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
         config_streamer_write(&streamer, reg->address, regSize);
         crc = crc16_ccitt_update(crc, reg->address, regSize);
+
+        pgRecordSetStored(reg, pgRecordCrcInRam(reg));
     }
 
     configFooter_t footer = {
@@ -248,11 +431,84 @@ static bool writeSettingsToEEPROM(void)
 
     config_streamer_flush(&streamer);
 
+    if (startOfBank) {
+        // leave the rest of the bank erased for the segments appended later
+        config_streamer_erase_rest(&streamer);
+    }
+
     const bool success = config_streamer_finish(&streamer) == 0;
 
+    if (!success) {
+        pgRecordClearStored();
+    }
+
     return success;
 }
 
+// Streaming to the start of a bank erases its first page, which takes the header with it
+static bool retireBank(const uint8_t *bank)
+{
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+
+    config_streamer_start(&streamer, (uintptr_t)bank, EEPROM_BANK_SIZE);
+
+    const uint32_t invalidHeader = 0;
+    config_streamer_write(&streamer, (uint8_t *)&invalidHeader, sizeof(invalidHeader));
+    config_streamer_flush(&streamer);
+
+    return config_streamer_finish(&streamer) == 0;
+}
+
+// Writes the whole config to the bank after the active one, with one bank it is rewritten in place
+static bool compactEEPROM(void)
+{
+    const uint8_t *target = bankStart(0);
+    if (configLog.bank) {
+        const int active = (configLog.bank - bankStart(0)) / EEPROM_BANK_SIZE;
+        target = bankStart((active + 1) % EEPROM_BANK_COUNT);
+    }
+
+    const uint16_t generation = configLog.bank ? configLog.generation + 1 : 0;
+    if (!writeSegment(target, target, generation)) {
+        return false;
+    }
+
+    if (configLog.bank && configLog.bank != target) {
+        return retireBank(configLog.bank);
+    }
+
+    return true;
+}
+
+static bool writeSettingsToEEPROM(void)
+{
+    scanEEPROM();
+
+    if (!configLog.bank || !configLog.appendable) {
+        return compactEEPROM();
+    }
+
+    uint32_t segmentSize = 0;
+    PG_FOREACH(reg) {
+        if (pgRecordIsDirty(reg)) {
+            segmentSize += sizeof(configRecord_t) + pgSize(reg);
+        }
+    }
+
+    if (segmentSize == 0) {
+        // nothing changed since the last load or save
+        return true;
+    }
+
+    segmentSize += sizeof(configFooter_t) + sizeof(uint16_t);
+    if (configLog.end + segmentSize > configLog.bank + EEPROM_BANK_SIZE) {
+        return compactEEPROM();
+    }
+
+    return writeSegment(configLog.bank, configLog.end, configLog.generation);
+}
+
 void writeConfigToEEPROM(void)
 {
     bool success = false;
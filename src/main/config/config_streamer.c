@@ -26,11 +26,6 @@
 
 #include "config/config_streamer.h"
 
-#ifndef EEPROM_IN_RAM
-extern uint8_t __config_start;   // configured via linker script when building binaries.
-extern uint8_t __config_end;
-#endif
-
 #if !defined(FLASH_PAGE_SIZE)
 // F1
 # if defined(STM32F10X_MD)
@@ -73,8 +68,9 @@ void config_streamer_init(config_streamer_t *c)
 
 void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
 {
-    // base must start at FLASH_PAGE_SIZE boundary
+    // pages are erased as the stream enters them, a base inside a page must point at erased flash
     c->address = base;
+    c->base = base;
     c->size = size;
     if (!c->unlocked) {
 #if defined(STM32F7)
@@ -113,23 +109,23 @@ Sector 6    0x08080000 - 0x080BFFFF 256 Kbytes
 Sector 7    0x080C0000 - 0x080FFFFF 256 Kbytes
 */
 
-static uint32_t getFLASHSectorForEEPROM(void)
+static uint32_t getFLASHSectorForEEPROM(uint32_t address)
 {
-    if ((uint32_t)&__config_start <= 0x08007FFF)
+    if (address <= 0x08007FFF)
         return FLASH_SECTOR_0;
-    if ((uint32_t)&__config_start <= 0x0800FFFF)
+    if (address <= 0x0800FFFF)
         return FLASH_SECTOR_1;
-    if ((uint32_t)&__config_start <= 0x08017FFF)
+    if (address <= 0x08017FFF)
         return FLASH_SECTOR_2;
-    if ((uint32_t)&__config_start <= 0x0801FFFF)
+    if (address <= 0x0801FFFF)
         return FLASH_SECTOR_3;
-    if ((uint32_t)&__config_start <= 0x0803FFFF)
+    if (address <= 0x0803FFFF)
         return FLASH_SECTOR_4;
-    if ((uint32_t)&__config_start <= 0x0807FFFF)
+    if (address <= 0x0807FFFF)
         return FLASH_SECTOR_5;
-    if ((uint32_t)&__config_start <= 0x080BFFFF)
+    if (address <= 0x080BFFFF)
         return FLASH_SECTOR_6;
-    if ((uint32_t)&__config_start <= 0x080FFFFF)
+    if (address <= 0x080FFFFF)
         return FLASH_SECTOR_7;
 
     // Not good
@@ -150,23 +146,23 @@ Sector 6    0x08040000 - 0x0805FFFF 128 Kbytes
 Sector 7    0x08060000 - 0x0807FFFF 128 Kbytes
 */
 
-static uint32_t getFLASHSectorForEEPROM(void)
+static uint32_t getFLASHSectorForEEPROM(uint32_t address)
 {
-    if ((uint32_t)&__config_start <= 0x08003FFF)
+    if (address <= 0x08003FFF)
         return FLASH_SECTOR_0;
-    if ((uint32_t)&__config_start <= 0x08007FFF)
+    if (address <= 0x08007FFF)
         return FLASH_SECTOR_1;
-    if ((uint32_t)&__config_start <= 0x0800BFFF)
+    if (address <= 0x0800BFFF)
         return FLASH_SECTOR_2;
-    if ((uint32_t)&__config_start <= 0x0800FFFF)
+    if (address <= 0x0800FFFF)
         return FLASH_SECTOR_3;
-    if ((uint32_t)&__config_start <= 0x0801FFFF)
+    if (address <= 0x0801FFFF)
         return FLASH_SECTOR_4;
-    if ((uint32_t)&__config_start <= 0x0803FFFF)
+    if (address <= 0x0803FFFF)
         return FLASH_SECTOR_5;
-    if ((uint32_t)&__config_start <= 0x0805FFFF)
+    if (address <= 0x0805FFFF)
         return FLASH_SECTOR_6;
-    if ((uint32_t)&__config_start <= 0x0807FFFF)
+    if (address <= 0x0807FFFF)
         return FLASH_SECTOR_7;
 
     // Not good
@@ -191,31 +187,31 @@ Sector 10   0x080C0000 - 0x080DFFFF 128 Kbytes
 Sector 11   0x080E0000 - 0x080FFFFF 128 Kbytes
 */
 
-static uint32_t getFLASHSectorForEEPROM(void)
+static uint32_t getFLASHSectorForEEPROM(uint32_t address)
 {
-    if ((uint32_t)&__config_start <= 0x08003FFF)
+    if (address <= 0x08003FFF)
         return FLASH_Sector_0;
-    if ((uint32_t)&__config_start <= 0x08007FFF)
+    if (address <= 0x08007FFF)
         return FLASH_Sector_1;
-    if ((uint32_t)&__config_start <= 0x0800BFFF)
+    if (address <= 0x0800BFFF)
         return FLASH_Sector_2;
-    if ((uint32_t)&__config_start <= 0x0800FFFF)
+    if (address <= 0x0800FFFF)
         return FLASH_Sector_3;
-    if ((uint32_t)&__config_start <= 0x0801FFFF)
+    if (address <= 0x0801FFFF)
         return FLASH_Sector_4;
-    if ((uint32_t)&__config_start <= 0x0803FFFF)
+    if (address <= 0x0803FFFF)
         return FLASH_Sector_5;
-    if ((uint32_t)&__config_start <= 0x0805FFFF)
+    if (address <= 0x0805FFFF)
         return FLASH_Sector_6;
-    if ((uint32_t)&__config_start <= 0x0807FFFF)
+    if (address <= 0x0807FFFF)
         return FLASH_Sector_7;
-    if ((uint32_t)&__config_start <= 0x0809FFFF)
+    if (address <= 0x0809FFFF)
         return FLASH_Sector_8;
-    if ((uint32_t)&__config_start <= 0x080DFFFF)
+    if (address <= 0x080DFFFF)
         return FLASH_Sector_9;
-    if ((uint32_t)&__config_start <= 0x080BFFFF)
+    if (address <= 0x080BFFFF)
         return FLASH_Sector_10;
-    if ((uint32_t)&__config_start <= 0x080FFFFF)
+    if (address <= 0x080FFFFF)
         return FLASH_Sector_11;
 
     // Not good
@@ -225,40 +221,47 @@ static uint32_t getFLASHSectorForEEPROM(void)
 }
 #endif
 
+static int erase_page(uintptr_t address)
+{
+#if defined(STM32F7)
+    FLASH_EraseInitTypeDef EraseInitStruct = {
+        .TypeErase     = FLASH_TYPEERASE_SECTORS,
+        .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
+        .NbSectors     = 1
+    };
+    EraseInitStruct.Sector = getFLASHSectorForEEPROM(address);
+    uint32_t SECTORError;
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
+    if (status != HAL_OK) {
+        return -1;
+    }
+#else
+#if defined(STM32F4)
+    const FLASH_Status status = FLASH_EraseSector(getFLASHSectorForEEPROM(address), VoltageRange_3); //0x08080000 to 0x080A0000
+#else
+    const FLASH_Status status = FLASH_ErasePage(address);
+#endif
+    if (status != FLASH_COMPLETE) {
+        return -1;
+    }
+#endif
+    return 0;
+}
+
 static int write_word(config_streamer_t *c, uint32_t value)
 {
     if (c->err != 0) {
         return c->err;
     }
-#if defined(STM32F7)
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-        FLASH_EraseInitTypeDef EraseInitStruct = {
-            .TypeErase     = FLASH_TYPEERASE_SECTORS,
-            .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
-            .NbSectors     = 1
-        };
-        EraseInitStruct.Sector = getFLASHSectorForEEPROM();
-        uint32_t SECTORError;
-        const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
-        if (status != HAL_OK) {
-            return -1;
-        }
+    if (c->address % FLASH_PAGE_SIZE == 0 && erase_page(c->address) != 0) {
+        return -1;
     }
+#if defined(STM32F7)
     const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, c->address, value);
     if (status != HAL_OK) {
         return -2;
     }
 #else
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-#if defined(STM32F4)
-        const FLASH_Status status = FLASH_EraseSector(getFLASHSectorForEEPROM(), VoltageRange_3); //0x08080000 to 0x080A0000
-#else
-        const FLASH_Status status = FLASH_ErasePage(c->address);
-#endif
-        if (status != FLASH_COMPLETE) {
-            return -1;
-        }
-    }
     const FLASH_Status status = FLASH_ProgramWord(c->address, value);
     if (status != FLASH_COMPLETE) {
         return -2;
@@ -296,6 +299,21 @@ int config_streamer_flush(config_streamer_t *c)
     return c-> err;
 }
 
+// Erases the pages the stream hasn't reached yet, up to the size given to config_streamer_start
+int config_streamer_erase_rest(config_streamer_t *c)
+{
+    const uintptr_t end = c->base + c->size;
+
+    // the page holding the write position was erased when the stream entered it
+    uintptr_t page = c->address + FLASH_PAGE_SIZE - 1;
+    page -= page % FLASH_PAGE_SIZE;
+
+    for (; page < end && c->err == 0; page += FLASH_PAGE_SIZE) {
+        c->err = erase_page(page);
+    }
+    return c->err;
+}
+
 int config_streamer_finish(config_streamer_t *c)
 {
     if (c->unlocked) {
@@ -73,6 +73,7 @@ typedef struct gyroDev_s {
     sensorGyroReadFuncPtr readFn;                             // read 3 axis data function
     sensorGyroReadDataFuncPtr temperatureFn;                  // read temperature if available
     extiCallbackRec_t exti;
+    struct gyroSampleQueue_s *sampleQueue;                  // set when the gyro task is driven by the data ready interrupt
     busDevice_t bus;
     float scale;                                            // scalefactor
     float gyroZero[XYZ_AXIS_COUNT];
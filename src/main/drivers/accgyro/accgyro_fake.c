@@ -37,6 +37,8 @@
 
 #include "drivers/accgyro/accgyro.h"
 #include "drivers/accgyro/accgyro_fake.h"
+#include "drivers/accgyro/gyro_sync.h"
+#include "drivers/time.h"
 
 static int16_t fakeGyroADC[XYZ_AXIS_COUNT];
 gyroDev_t *fakeGyroDev;
@@ -64,6 +66,22 @@ void fakeGyroSet(gyroDev_t *gyro, int16_t x, int16_t y, int16_t z)
     gyroDevUnLock(gyro);
 }
 
+// Models the data ready interrupt of a real gyro, the sample is handed to the gyro task through the sample queue
+void fakeGyroDataReady(gyroDev_t *gyro)
+{
+    if (!gyro->sampleQueue) {
+        return;
+    }
+    gyroSample_t sample = { .hasData = true };
+    gyroDevLock(gyro);
+    sample.adcRaw[X] = fakeGyroADC[X];
+    sample.adcRaw[Y] = fakeGyroADC[Y];
+    sample.adcRaw[Z] = fakeGyroADC[Z];
+    gyroDevUnLock(gyro);
+    sample.readyAtUs = micros();
+    gyroSampleQueuePush(gyro->sampleQueue, &sample);
+}
+
 STATIC_UNIT_TESTED bool fakeGyroRead(gyroDev_t *gyro)
 {
     gyroDevLock(gyro);
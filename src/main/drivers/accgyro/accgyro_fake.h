@@ -29,3 +29,4 @@ struct gyroDev_s;
 extern struct gyroDev_s *fakeGyroDev;
 bool fakeGyroDetect(struct gyroDev_s *gyro);
 void fakeGyroSet(struct gyroDev_s *gyro, int16_t x, int16_t y, int16_t z);
+void fakeGyroDataReady(struct gyroDev_s *gyro);
@@ -59,6 +59,7 @@
 #include "drivers/accgyro/accgyro_spi_mpu6500.h"
 #include "drivers/accgyro/accgyro_spi_mpu9250.h"
 #include "drivers/accgyro/accgyro_mpu.h"
+#include "drivers/accgyro/gyro_sync.h"
 #ifdef USE_GYRO_IMUF9001
 #include "drivers/accgyro/accgyro_imuf9001.h"
 #include "rx/rx.h"
@@ -136,6 +137,11 @@ FAST_CODE static void mpuIntExtiHandler(extiCallbackRec_t *cb)
 #endif
     gyroDev_t *gyro = container_of(cb, gyroDev_t, exti);
     gyro->dataReady = true;
+    if (gyro->sampleQueue) {
+        // the gyro task reads the sensor, only hand over the time the data became ready
+        const gyroSample_t sample = { .readyAtUs = micros(), .hasData = false };
+        gyroSampleQueuePush(gyro->sampleQueue, &sample);
+    }
 #ifdef DEBUG_MPU_DATA_READY_INTERRUPT
     const uint32_t now2Us = micros();
     debug[1] = (uint16_t)(now2Us - nowUs);
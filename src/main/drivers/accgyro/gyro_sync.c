@@ -27,6 +27,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -35,6 +36,46 @@
 #include "drivers/accgyro/gyro_sync.h"
 
 
+void gyroSampleQueueInit(gyroSampleQueue_t *queue)
+{
+    memset(queue, 0, sizeof(*queue));
+}
+
+/*
+ * Called from interrupt context. The sample is written before head is published,
+ * so the consumer never sees a partially written sample.
+ */
+FAST_CODE bool gyroSampleQueuePush(gyroSampleQueue_t *queue, const gyroSample_t *sample)
+{
+    const uint8_t head = queue->head;
+    if ((uint8_t)(head - queue->tail) >= GYRO_SAMPLE_QUEUE_SIZE) {
+        queue->overruns++;
+        return false;
+    }
+    queue->samples[head & (GYRO_SAMPLE_QUEUE_SIZE - 1)] = *sample;
+    __sync_synchronize();
+    queue->head = head + 1;
+    return true;
+}
+
+FAST_CODE bool gyroSampleQueuePop(gyroSampleQueue_t *queue, gyroSample_t *sample)
+{
+    const uint8_t tail = queue->tail;
+    if (tail == queue->head) {
+        return false;
+    }
+    __sync_synchronize();
+    *sample = queue->samples[tail & (GYRO_SAMPLE_QUEUE_SIZE - 1)];
+    __sync_synchronize();
+    queue->tail = tail + 1;
+    return true;
+}
+
+FAST_CODE bool gyroSampleQueueIsEmpty(const gyroSampleQueue_t *queue)
+{
+    return queue->tail == queue->head;
+}
+
 bool gyroSyncCheckUpdate(gyroDev_t *gyro)
 {
     bool ret;
@@ -27,7 +27,29 @@
 
 #pragma once
 
+#include "common/time.h"
 #include "drivers/accgyro/accgyro.h"
 
+// Single producer (data ready interrupt or DMA completion), single consumer (gyro task) sample queue
+#define GYRO_SAMPLE_QUEUE_SIZE 4    // must be a power of 2
+
+typedef struct gyroSample_s {
+    timeUs_t readyAtUs;                 // time of the data ready interrupt or DMA completion
+    int16_t adcRaw[XYZ_AXIS_COUNT];
+    bool hasData;                       // false if only the data ready event was captured and the sensor still has to be read
+} gyroSample_t;
+
+typedef struct gyroSampleQueue_s {
+    volatile uint8_t head;              // only written by the producer
+    volatile uint8_t tail;              // only written by the consumer
+    volatile uint32_t overruns;         // samples dropped because the queue was full
+    gyroSample_t samples[GYRO_SAMPLE_QUEUE_SIZE];
+} gyroSampleQueue_t;
+
+void gyroSampleQueueInit(gyroSampleQueue_t *queue);
+bool gyroSampleQueuePush(gyroSampleQueue_t *queue, const gyroSample_t *sample);
+bool gyroSampleQueuePop(gyroSampleQueue_t *queue, gyroSample_t *sample);
+bool gyroSampleQueueIsEmpty(const gyroSampleQueue_t *queue);
+
 bool gyroSyncCheckUpdate(gyroDev_t *gyro);
 uint32_t gyroSetSampleRate(gyroDev_t *gyro, uint8_t lpf, uint8_t gyroSyncDenominator, bool gyro_use_32khz);
@@ -204,6 +204,10 @@ uint16_t maxScreenSize = VIDEO_BUFFER_CHARS_PAL;
 static uint8_t screenBuffer[VIDEO_BUFFER_CHARS_PAL+40]; // For faster writes we use memcpy so we need some space to don't overwrite buffer
 static uint8_t shadowBuffer[VIDEO_BUFFER_CHARS_PAL];
 
+// Rows of screenBuffer changed since they were last sent, the others match shadowBuffer
+static uint32_t dirtyRows;
+#define ALL_ROWS_DIRTY  ((1 << VIDEO_LINES_PAL) - 1)
+
 //Max chars to update in one idle
 
 #define MAX_CHARS2UPDATE    100
@@ -211,7 +215,8 @@ static uint8_t shadowBuffer[VIDEO_BUFFER_CHARS_PAL];
 volatile bool dmaTransactionInProgress = false;
 #endif
 
-static uint8_t spiBuff[MAX_CHARS2UPDATE*6];
+// Rows are always sent whole, so there is room for one beyond the limit
+static uint8_t spiBuff[(MAX_CHARS2UPDATE + CHARS_PER_LINE) * 6];
 
 static uint8_t  videoSignalCfg;
 static uint8_t  videoSignalReg  = OSD_ENABLE; // OSD_ENABLE required to trigger first ReInit
@@ -405,6 +410,7 @@ void max7456ReInit(void)
 
     // Clear shadow to force redraw all screen in non-dma mode.
     memset(shadowBuffer, 0, maxScreenSize);
+    dirtyRows = ALL_ROWS_DIRTY;
     if (firstInit) {
         max7456DrawScreenSlow();
         firstInit = false;
@@ -529,6 +535,7 @@ void max7456Brightness(uint8_t black, uint8_t white)
 void max7456ClearScreen(void)
 {
     memset(screenBuffer, 0x20, VIDEO_BUFFER_CHARS_PAL);
+    dirtyRows = ALL_ROWS_DIRTY;
 }
 
 uint8_t* max7456GetScreenBuffer(void)
@@ -538,14 +545,18 @@ uint8_t* max7456GetScreenBuffer(void)
 
 void max7456WriteChar(uint8_t x, uint8_t y, uint8_t c)
 {
-    screenBuffer[y*CHARS_PER_LINE+x] = c;
+    uint8_t *cell = &screenBuffer[y*CHARS_PER_LINE+x];
+    if (*cell != c) {
+        *cell = c;
+        dirtyRows |= 1 << y;
+    }
 }
 
 void max7456Write(uint8_t x, uint8_t y, const char *buff)
 {
     for (int i = 0; *(buff+i); i++) {
         if (x+i < CHARS_PER_LINE) {// Do not write over screen
-            screenBuffer[y*CHARS_PER_LINE+x+i] = *(buff+i);
+            max7456WriteChar(x + i, y, *(buff+i));
         }
     }
 }
@@ -561,6 +572,10 @@ bool max7456DmaInProgress(void)
 
 bool max7456BuffersSynced(void)
 {
+    if (!dirtyRows) {
+        return true;
+    }
+
     for (int i = 0; i < maxScreenSize; i++) {
         if (screenBuffer[i] != shadowBuffer[i]) {
             return false;
@@ -621,7 +636,7 @@ void max7456ReInitIfRequired(void)
 
 void max7456DrawScreen(void)
 {
-    static uint16_t pos = 0;
+    static uint8_t row = 0;
 
     if (!max7456Lock && !fontIsLoading) {
 
@@ -631,22 +646,34 @@ void max7456DrawScreen(void)
 
         max7456ReInitIfRequired();
 
+        // Only rows written since they were sent are compared, starting where the last call stopped
+        const uint8_t rowCount = maxScreenSize / CHARS_PER_LINE;
+        dirtyRows &= (1 << rowCount) - 1;
+
         int buff_len = 0;
-        for (int k = 0; k < MAX_CHARS2UPDATE; k++) {
-            if (screenBuffer[pos] != shadowBuffer[pos]) {
-                spiBuff[buff_len++] = MAX7456ADD_DMAH;
-                spiBuff[buff_len++] = pos >> 8;
-                spiBuff[buff_len++] = MAX7456ADD_DMAL;
-                spiBuff[buff_len++] = pos & 0xff;
-                spiBuff[buff_len++] = MAX7456ADD_DMDI;
-                spiBuff[buff_len++] = screenBuffer[pos];
-                shadowBuffer[pos] = screenBuffer[pos];
+        for (int k = 0; dirtyRows && k < rowCount && buff_len < MAX_CHARS2UPDATE * 6; k++) {
+            if (row >= rowCount) {
+                row = 0;
             }
 
-            if (++pos >= maxScreenSize) {
-                pos = 0;
-                break;
+            if (dirtyRows & (1 << row)) {
+                dirtyRows &= ~(1 << row);
+
+                const uint16_t rowEnd = (row + 1) * CHARS_PER_LINE;
+                for (uint16_t pos = row * CHARS_PER_LINE; pos < rowEnd; pos++) {
+                    if (screenBuffer[pos] != shadowBuffer[pos]) {
+                        spiBuff[buff_len++] = MAX7456ADD_DMAH;
+                        spiBuff[buff_len++] = pos >> 8;
+                        spiBuff[buff_len++] = MAX7456ADD_DMAL;
+                        spiBuff[buff_len++] = pos & 0xff;
+                        spiBuff[buff_len++] = MAX7456ADD_DMDI;
+                        spiBuff[buff_len++] = screenBuffer[pos];
+                        shadowBuffer[pos] = screenBuffer[pos];
+                    }
+                }
             }
+
+            row++;
         }
 
         if (buff_len) {
@@ -683,6 +710,7 @@ static void max7456DrawScreenSlow(void)
         }
         shadowBuffer[xx] = screenBuffer[xx];
     }
+    dirtyRows = 0;
 
     max7456Send(MAX7456ADD_DMDI, END_STRING);
     max7456Send(MAX7456ADD_DMM, displayMemoryModeReg);
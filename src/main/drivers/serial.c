@@ -69,11 +69,34 @@ uint32_t serialTxBytesFree(const serialPort_t *instance)
     return instance->vTable->serialTotalTxFree(instance);
 }
 
+// The most serialTxBytesFree() reports, when the transmit buffer is empty
+uint32_t serialTxBufferSize(const serialPort_t *instance)
+{
+    if (instance->vTable->serialTxBufferSize) {
+        return instance->vTable->serialTxBufferSize(instance);
+    }
+    return ringBufferSize(&instance->txBuffer);
+}
+
 uint8_t serialRead(serialPort_t *instance)
 {
     return instance->vTable->serialRead(instance);
 }
 
+uint32_t serialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
+{
+    if (instance->vTable->readBuf) {
+        return instance->vTable->readBuf(instance, data, count);
+    }
+
+    uint32_t read = 0;
+    while (read < count && serialRxBytesWaiting(instance)) {
+        data[read++] = serialRead(instance);
+    }
+
+    return read;
+}
+
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
     instance->vTable->serialSetBaudRate(instance, baudRate);
@@ -107,6 +130,15 @@ void serialSetBaudRateCb(serialPort_t *serialPort, void (*cb)(serialPort_t *cont
     }
 }
 
+bool serialSetIdleCallback(serialPort_t *serialPort, serialIdleCallbackPtr cb)
+{
+    // Ports that can't tell where a frame ends keep calling the byte callback
+    if (serialPort->vTable->setIdleCallback) {
+        return serialPort->vTable->setIdleCallback(serialPort, cb);
+    }
+    return false;
+}
+
 void serialWriteBufShim(void *instance, const uint8_t *data, int count)
 {
     serialWriteBuf((serialPort_t *)instance, data, count);
@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include "common/ring_buffer.h"
+#include "common/time.h"
+
 #include "drivers/io.h"
 #include "pg/pg.h"
 
@@ -56,6 +59,9 @@ typedef enum {
 #define CTRL_LINE_STATE_RTS (1 << 1)
 
 typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);   // used by serial drivers to return frames to app
+// used by serial drivers to return whole frames, delimited by an idle line, frameTimeUs is when the line went idle
+// a frame that wraps around the end of the receive buffer continues in wrapData, wrapLength is zero otherwise
+typedef void (*serialIdleCallbackPtr)(const uint8_t *data, uint16_t length, const uint8_t *wrapData, uint16_t wrapLength, timeUs_t frameTimeUs, void *rxCallbackData);
 
 typedef struct serialPort_s {
 
@@ -66,16 +72,12 @@ typedef struct serialPort_s {
 
     uint32_t baudRate;
 
-    uint32_t rxBufferSize;
-    uint32_t txBufferSize;
-    volatile uint8_t *rxBuffer;
-    volatile uint8_t *txBuffer;
-    uint32_t rxBufferHead;
-    uint32_t rxBufferTail;
-    uint32_t txBufferHead;
-    uint32_t txBufferTail;
+    // rx is filled by the driver and emptied by the application, tx the other way around
+    ringBuffer_t rxBuffer;
+    ringBuffer_t txBuffer;
 
     serialReceiveCallbackPtr rxCallback;
+    serialIdleCallbackPtr idleCallback;
     void *rxCallbackData;
 
     uint8_t identifier;
@@ -120,17 +122,29 @@ struct serialPortVTable {
     // Optional functions used to buffer large writes.
     void (*beginWrite)(serialPort_t *instance);
     void (*endWrite)(serialPort_t *instance);
+
+    // Optional, reads up to count bytes and returns the number read
+    uint32_t (*readBuf)(serialPort_t *instance, uint8_t *data, uint32_t count);
+
+    // Optional, switches the receiver to whole frame delivery, returns false if the port can't detect an idle line
+    bool (*setIdleCallback)(serialPort_t *instance, serialIdleCallbackPtr cb);
+
+    // Optional, for ports that don't keep their transmit data in txBuffer
+    uint32_t (*serialTxBufferSize)(const serialPort_t *instance);
 };
 
 void serialWrite(serialPort_t *instance, uint8_t ch);
 uint32_t serialRxBytesWaiting(const serialPort_t *instance);
 uint32_t serialTxBytesFree(const serialPort_t *instance);
+uint32_t serialTxBufferSize(const serialPort_t *instance);
 void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
 uint8_t serialRead(serialPort_t *instance);
+uint32_t serialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count);
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
 void serialSetMode(serialPort_t *instance, portMode_e mode);
 void serialSetCtrlLineStateCb(serialPort_t *instance, void (*cb)(void *context, uint16_t ctrlLineState), void *context);
 void serialSetBaudRateCb(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+bool serialSetIdleCallback(serialPort_t *instance, serialIdleCallbackPtr cb);
 bool isSerialTransmitBufferEmpty(const serialPort_t *instance);
 void serialPrint(serialPort_t *instance, const char *str);
 uint32_t serialGetBaudRate(serialPort_t *instance);
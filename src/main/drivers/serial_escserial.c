@@ -71,9 +71,9 @@ typedef struct escSerial_s {
     IO_t txIO;
 
     const timerHardware_t *rxTimerHardware;
-    volatile uint8_t rxBuffer[ESCSERIAL_BUFFER_SIZE];
+    uint8_t rxBuffer[ESCSERIAL_BUFFER_SIZE];
     const timerHardware_t *txTimerHardware;
-    volatile uint8_t txBuffer[ESCSERIAL_BUFFER_SIZE];
+    uint8_t txBuffer[ESCSERIAL_BUFFER_SIZE];
 
 #ifdef USE_HAL_DRIVER
     const TIM_HandleTypeDef *txTimerHandle;
@@ -210,7 +210,7 @@ static bool isTimerPeriodTooLarge(uint32_t timerPeriod)
 static bool isEscSerialTransmitBufferEmpty(const serialPort_t *instance)
 {
     // start listening
-    return instance->txBufferHead == instance->txBufferTail;
+    return ringBufferIsEmpty(&instance->txBuffer);
 }
 
 static void escSerialOutputPortConfig(const timerHardware_t *timerHardwarePtr)
@@ -234,10 +234,7 @@ static void processTxStateBL(escSerial_t *escSerial)
         }
 
         // data to send
-        byteToSend = escSerial->port.txBuffer[escSerial->port.txBufferTail++];
-        if (escSerial->port.txBufferTail >= escSerial->port.txBufferSize) {
-            escSerial->port.txBufferTail = 0;
-        }
+        byteToSend = ringBufferPop(&escSerial->port.txBuffer);
 
         // build internal buffer, MSB = Stop Bit (1) + data bits (MSB to LSB) + start bit(0) LSB
         escSerial->internalTxBuffer = (1 << (TX_TOTAL_BITS - 1)) | (byteToSend << 1);
@@ -289,8 +286,7 @@ static void extractAndStoreRxByteBL(escSerial_t *escSerial)
     if (escSerial->port.rxCallback) {
         escSerial->port.rxCallback(rxByte, escSerial->port.rxCallbackData);
     } else {
-        escSerial->port.rxBuffer[escSerial->port.rxBufferHead] = rxByte;
-        escSerial->port.rxBufferHead = (escSerial->port.rxBufferHead + 1) % escSerial->port.rxBufferSize;
+        ringBufferPush(&escSerial->port.rxBuffer, rxByte);
     }
 }
 
@@ -465,10 +461,7 @@ reload:
         }
         else{
             // data to send
-            byteToSend = escSerial->port.txBuffer[escSerial->port.txBufferTail++];
-            if (escSerial->port.txBufferTail >= escSerial->port.txBufferSize) {
-                escSerial->port.txBufferTail = 0;
-            }
+            byteToSend = ringBufferPop(&escSerial->port.txBuffer);
         }
 
 
@@ -565,8 +558,7 @@ static void extractAndStoreRxByteEsc(escSerial_t *escSerial)
     if (escSerial->port.rxCallback) {
         escSerial->port.rxCallback(rxByte, escSerial->port.rxCallbackData);
     } else {
-        escSerial->port.rxBuffer[escSerial->port.rxBufferHead] = rxByte;
-        escSerial->port.rxBufferHead = (escSerial->port.rxBufferHead + 1) % escSerial->port.rxBufferSize;
+        ringBufferPush(&escSerial->port.rxBuffer, rxByte);
     }
 }
 
@@ -646,15 +638,8 @@ static void escSerialTimerRxConfig(const timerHardware_t *timerHardwarePtr, uint
 
 static void resetBuffers(escSerial_t *escSerial)
 {
-    escSerial->port.rxBufferSize = ESCSERIAL_BUFFER_SIZE;
-    escSerial->port.rxBuffer = escSerial->rxBuffer;
-    escSerial->port.rxBufferTail = 0;
-    escSerial->port.rxBufferHead = 0;
-
-    escSerial->port.txBuffer = escSerial->txBuffer;
-    escSerial->port.txBufferSize = ESCSERIAL_BUFFER_SIZE;
-    escSerial->port.txBufferTail = 0;
-    escSerial->port.txBufferHead = 0;
+    ringBufferInit(&escSerial->port.rxBuffer, escSerial->rxBuffer, ESCSERIAL_BUFFER_SIZE);
+    ringBufferInit(&escSerial->port.txBuffer, escSerial->txBuffer, ESCSERIAL_BUFFER_SIZE);
 }
 
 static serialPort_t *openEscSerial(escSerialPortIndex_e portIndex, serialReceiveCallbackPtr callback, uint16_t output, uint32_t baud, portOptions_e options, uint8_t mode)
@@ -780,15 +765,11 @@ static uint32_t escSerialTotalBytesWaiting(const serialPort_t *instance)
         return 0;
     }
 
-    escSerial_t *s = (escSerial_t *)instance;
-
-    return (s->port.rxBufferHead - s->port.rxBufferTail) & (s->port.rxBufferSize - 1);
+    return ringBufferUsed(&instance->rxBuffer);
 }
 
 static uint8_t escSerialReadByte(serialPort_t *instance)
 {
-    uint8_t ch;
-
     if ((instance->mode & MODE_RX) == 0) {
         return 0;
     }
@@ -797,9 +778,16 @@ static uint8_t escSerialReadByte(serialPort_t *instance)
         return 0;
     }
 
-    ch = instance->rxBuffer[instance->rxBufferTail];
-    instance->rxBufferTail = (instance->rxBufferTail + 1) % instance->rxBufferSize;
-    return ch;
+    return ringBufferPop(&instance->rxBuffer);
+}
+
+static uint32_t escSerialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
+{
+    if ((instance->mode & MODE_RX) == 0) {
+        return 0;
+    }
+
+    return ringBufferPopN(&instance->rxBuffer, data, count);
 }
 
 static void escSerialWriteByte(serialPort_t *s, uint8_t ch)
@@ -808,8 +796,22 @@ static void escSerialWriteByte(serialPort_t *s, uint8_t ch)
         return;
     }
 
-    s->txBuffer[s->txBufferHead] = ch;
-    s->txBufferHead = (s->txBufferHead + 1) % s->txBufferSize;
+    ringBufferPush(&s->txBuffer, ch);
+}
+
+static void escSerialWriteBuf(serialPort_t *s, const void *data, int count)
+{
+    if ((s->mode & MODE_TX) == 0) {
+        return;
+    }
+
+    // The timer interrupt drains the buffer, wait for it when the buffer is full
+    const uint8_t *p = data;
+    while (count > 0) {
+        const uint32_t written = ringBufferPushN(&s->txBuffer, p, count);
+        p += written;
+        count -= written;
+    }
 }
 
 static void escSerialSetBaudRate(serialPort_t *s, uint32_t baudRate)
@@ -829,11 +831,7 @@ static uint32_t escSerialTxBytesFree(const serialPort_t *instance)
         return 0;
     }
 
-    escSerial_t *s = (escSerial_t *)instance;
-
-    uint8_t bytesUsed = (s->port.txBufferHead - s->port.txBufferTail) & (s->port.txBufferSize - 1);
-
-    return (s->port.txBufferSize - 1) - bytesUsed;
+    return ringBufferFree(&instance->txBuffer);
 }
 
 const struct serialPortVTable escSerialVTable[] = {
@@ -847,9 +845,10 @@ const struct serialPortVTable escSerialVTable[] = {
         .setMode = escSerialSetMode,
         .setCtrlLineStateCb = NULL,
         .setBaudRateCb = NULL,
-        .writeBuf = NULL,
+        .writeBuf = escSerialWriteBuf,
         .beginWrite = NULL,
-        .endWrite = NULL
+        .endWrite = NULL,
+        .readBuf = escSerialReadBuf
     }
 };
 
@@ -976,13 +975,12 @@ void escEnablePassthrough(serialPort_t *escPassthroughPort, uint16_t output, uin
     while (1) {
         if (mode!=2)
         {
-            if (serialRxBytesWaiting(escPort)) {
+            uint8_t buf[64];
+            uint32_t count;
+            while ((count = serialReadBuf(escPort, buf, sizeof(buf))))
+            {
                 LED0_ON;
-                while (serialRxBytesWaiting(escPort))
-                {
-                    ch = serialRead(escPort);
-                    serialWrite(escPassthroughPort, ch);
-                }
+                serialWriteBuf(escPassthroughPort, buf, count);
                 LED0_OFF;
             }
         }
@@ -75,8 +75,8 @@ typedef struct softSerial_s {
 #endif
     const timerHardware_t *exTimerHardware;
 
-    volatile uint8_t rxBuffer[SOFTSERIAL_BUFFER_SIZE];
-    volatile uint8_t txBuffer[SOFTSERIAL_BUFFER_SIZE];
+    uint8_t rxBuffer[SOFTSERIAL_BUFFER_SIZE];
+    uint8_t txBuffer[SOFTSERIAL_BUFFER_SIZE];
 
     uint8_t          isSearchingForStartBit;
     uint8_t          rxBitIndex;
@@ -222,15 +222,8 @@ static void serialTimerConfigureTimebase(const timerHardware_t *timerHardwarePtr
 
 static void resetBuffers(softSerial_t *softSerial)
 {
-    softSerial->port.rxBufferSize = SOFTSERIAL_BUFFER_SIZE;
-    softSerial->port.rxBuffer = softSerial->rxBuffer;
-    softSerial->port.rxBufferTail = 0;
-    softSerial->port.rxBufferHead = 0;
-
-    softSerial->port.txBuffer = softSerial->txBuffer;
-    softSerial->port.txBufferSize = SOFTSERIAL_BUFFER_SIZE;
-    softSerial->port.txBufferTail = 0;
-    softSerial->port.txBufferHead = 0;
+    ringBufferInit(&softSerial->port.rxBuffer, softSerial->rxBuffer, SOFTSERIAL_BUFFER_SIZE);
+    ringBufferInit(&softSerial->port.txBuffer, softSerial->txBuffer, SOFTSERIAL_BUFFER_SIZE);
 }
 
 serialPort_t *openSoftSerial(softSerialPortIndex_e portIndex, serialReceiveCallbackPtr rxCallback, void *rxCallbackData, uint32_t baud, portMode_e mode, portOptions_e options)
@@ -368,10 +361,7 @@ void processTxState(softSerial_t *softSerial)
         }
 
         // data to send
-        uint8_t byteToSend = softSerial->port.txBuffer[softSerial->port.txBufferTail++];
-        if (softSerial->port.txBufferTail >= softSerial->port.txBufferSize) {
-            softSerial->port.txBufferTail = 0;
-        }
+        uint8_t byteToSend = ringBufferPop(&softSerial->port.txBuffer);
 
         // build internal buffer, MSB = Stop Bit (1) + data bits (MSB to LSB) + start bit(0) LSB
         softSerial->internalTxBuffer = (1 << (TX_TOTAL_BITS - 1)) | (byteToSend << 1);
@@ -453,8 +443,7 @@ void extractAndStoreRxByte(softSerial_t *softSerial)
     if (softSerial->port.rxCallback) {
         softSerial->port.rxCallback(rxByte, softSerial->port.rxCallbackData);
     } else {
-        softSerial->port.rxBuffer[softSerial->port.rxBufferHead] = rxByte;
-        softSerial->port.rxBufferHead = (softSerial->port.rxBufferHead + 1) % softSerial->port.rxBufferSize;
+        ringBufferPush(&softSerial->port.rxBuffer, rxByte);
     }
 }
 
@@ -566,9 +555,7 @@ uint32_t softSerialRxBytesWaiting(const serialPort_t *instance)
         return 0;
     }
 
-    softSerial_t *s = (softSerial_t *)instance;
-
-    return (s->port.rxBufferHead - s->port.rxBufferTail) & (s->port.rxBufferSize - 1);
+    return ringBufferUsed(&instance->rxBuffer);
 }
 
 uint32_t softSerialTxBytesFree(const serialPort_t *instance)
@@ -577,17 +564,11 @@ uint32_t softSerialTxBytesFree(const serialPort_t *instance)
         return 0;
     }
 
-    softSerial_t *s = (softSerial_t *)instance;
-
-    uint8_t bytesUsed = (s->port.txBufferHead - s->port.txBufferTail) & (s->port.txBufferSize - 1);
-
-    return (s->port.txBufferSize - 1) - bytesUsed;
+    return ringBufferFree(&instance->txBuffer);
 }
 
 uint8_t softSerialReadByte(serialPort_t *instance)
 {
-    uint8_t ch;
-
     if ((instance->mode & MODE_RX) == 0) {
         return 0;
     }
@@ -596,9 +577,16 @@ uint8_t softSerialReadByte(serialPort_t *instance)
         return 0;
     }
 
-    ch = instance->rxBuffer[instance->rxBufferTail];
-    instance->rxBufferTail = (instance->rxBufferTail + 1) % instance->rxBufferSize;
-    return ch;
+    return ringBufferPop(&instance->rxBuffer);
+}
+
+static uint32_t softSerialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
+{
+    if ((instance->mode & MODE_RX) == 0) {
+        return 0;
+    }
+
+    return ringBufferPopN(&instance->rxBuffer, data, count);
 }
 
 void softSerialWriteByte(serialPort_t *s, uint8_t ch)
@@ -607,8 +595,22 @@ void softSerialWriteByte(serialPort_t *s, uint8_t ch)
         return;
     }
 
-    s->txBuffer[s->txBufferHead] = ch;
-    s->txBufferHead = (s->txBufferHead + 1) % s->txBufferSize;
+    ringBufferPush(&s->txBuffer, ch);
+}
+
+static void softSerialWriteBuf(serialPort_t *s, const void *data, int count)
+{
+    if ((s->mode & MODE_TX) == 0) {
+        return;
+    }
+
+    // The timer interrupt drains the buffer, wait for it when the buffer is full
+    const uint8_t *p = data;
+    while (count > 0) {
+        const uint32_t written = ringBufferPushN(&s->txBuffer, p, count);
+        p += written;
+        count -= written;
+    }
 }
 
 void softSerialSetBaudRate(serialPort_t *s, uint32_t baudRate)
@@ -627,7 +629,7 @@ void softSerialSetMode(serialPort_t *instance, portMode_e mode)
 
 bool isSoftSerialTransmitBufferEmpty(const serialPort_t *instance)
 {
-    return instance->txBufferHead == instance->txBufferTail;
+    return ringBufferIsEmpty(&instance->txBuffer);
 }
 
 static const struct serialPortVTable softSerialVTable = {
@@ -640,9 +642,10 @@ static const struct serialPortVTable softSerialVTable = {
     .setMode = softSerialSetMode,
     .setCtrlLineStateCb = NULL,
     .setBaudRateCb = NULL,
-    .writeBuf = NULL,
+    .writeBuf = softSerialWriteBuf,
     .beginWrite = NULL,
-    .endWrite = NULL
+    .endWrite = NULL,
+    .readBuf = softSerialReadBuf
 };
 
 #endif
@@ -35,6 +35,8 @@
 
 #include "common/utils.h"
 
+#include "drivers/time.h"
+
 #include "io/serial.h"
 #include "serial_tcp.h"
 
@@ -129,15 +131,12 @@ serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, void *rxCa
     s->port.vTable = &tcpVTable;
 
     // common serial initialisation code should move to serialPort::init()
-    s->port.rxBufferHead = s->port.rxBufferTail = 0;
-    s->port.txBufferHead = s->port.txBufferTail = 0;
-    s->port.rxBufferSize = RX_BUFFER_SIZE;
-    s->port.txBufferSize = TX_BUFFER_SIZE;
-    s->port.rxBuffer = s->rxBuffer;
-    s->port.txBuffer = s->txBuffer;
+    ringBufferInit(&s->port.rxBuffer, s->rxBuffer, RX_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, s->txBuffer, TX_BUFFER_SIZE);
 
     // callback works for IRQ-based RX ONLY
     s->port.rxCallback = rxCallback;
+    s->port.idleCallback = NULL;
     s->port.rxCallbackData = rxCallbackData;
     s->port.mode = mode;
     s->port.baudRate = baudRate;
@@ -149,13 +148,8 @@ serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, void *rxCa
 uint32_t tcpTotalRxBytesWaiting(const serialPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t*)instance;
-    uint32_t count;
     pthread_mutex_lock(&s->rxLock);
-    if (s->port.rxBufferHead >= s->port.rxBufferTail) {
-        count = s->port.rxBufferHead - s->port.rxBufferTail;
-    } else {
-        count = s->port.rxBufferSize + s->port.rxBufferHead - s->port.rxBufferTail;
-    }
+    uint32_t count = ringBufferUsed(&s->port.rxBuffer);
     pthread_mutex_unlock(&s->rxLock);
 
     return count;
@@ -164,15 +158,8 @@ uint32_t tcpTotalRxBytesWaiting(const serialPort_t *instance)
 uint32_t tcpTotalTxBytesFree(const serialPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t*)instance;
-    uint32_t bytesUsed;
-
     pthread_mutex_lock(&s->txLock);
-    if (s->port.txBufferHead >= s->port.txBufferTail) {
-        bytesUsed = s->port.txBufferHead - s->port.txBufferTail;
-    } else {
-        bytesUsed = s->port.txBufferSize + s->port.txBufferHead - s->port.txBufferTail;
-    }
-    uint32_t bytesFree = (s->port.txBufferSize - 1) - bytesUsed;
+    uint32_t bytesFree = ringBufferFree(&s->port.txBuffer);
     pthread_mutex_unlock(&s->txLock);
 
     return bytesFree;
@@ -182,80 +169,99 @@ bool isTcpTransmitBufferEmpty(const serialPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
     pthread_mutex_lock(&s->txLock);
-    bool isEmpty = s->port.txBufferTail == s->port.txBufferHead;
+    bool isEmpty = ringBufferIsEmpty(&s->port.txBuffer);
     pthread_mutex_unlock(&s->txLock);
     return isEmpty;
 }
 
 uint8_t tcpRead(serialPort_t *instance)
 {
-    uint8_t ch;
     tcpPort_t *s = (tcpPort_t *)instance;
     pthread_mutex_lock(&s->rxLock);
-
-    ch = s->port.rxBuffer[s->port.rxBufferTail];
-    if (s->port.rxBufferTail + 1 >= s->port.rxBufferSize) {
-        s->port.rxBufferTail = 0;
-    } else {
-        s->port.rxBufferTail++;
-    }
+    uint8_t ch = ringBufferPop(&s->port.rxBuffer);
     pthread_mutex_unlock(&s->rxLock);
 
     return ch;
 }
 
+static uint32_t tcpReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    pthread_mutex_lock(&s->rxLock);
+    count = ringBufferPopN(&s->port.rxBuffer, data, count);
+    pthread_mutex_unlock(&s->rxLock);
+
+    return count;
+}
+
 void tcpWrite(serialPort_t *instance, uint8_t ch)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
     pthread_mutex_lock(&s->txLock);
-
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
-        s->port.txBufferHead = 0;
-    } else {
-        s->port.txBufferHead++;
-    }
+    ringBufferPush(&s->port.txBuffer, ch);
     pthread_mutex_unlock(&s->txLock);
 
     tcpDataOut(s);
 }
 
+static void tcpWriteBuf(serialPort_t *instance, const void *data, int count)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    const uint8_t *p = data;
+
+    while (count > 0) {
+        pthread_mutex_lock(&s->txLock);
+        const uint32_t written = ringBufferPushN(&s->port.txBuffer, p, count);
+        pthread_mutex_unlock(&s->txLock);
+        p += written;
+        count -= written;
+
+        tcpDataOut(s);
+        if (!written && s->conn == NULL) {
+            // Nobody to send the rest to
+            break;
+        }
+    }
+}
+
 void tcpDataOut(tcpPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
     if (s->conn == NULL) return;
     pthread_mutex_lock(&s->txLock);
 
-    if (s->port.txBufferHead < s->port.txBufferTail) {
-        // send data till end of buffer
-        int chunk = s->port.txBufferSize - s->port.txBufferTail;
-        dyad_write(s->conn, (const void *)&s->port.txBuffer[s->port.txBufferTail], chunk);
-        s->port.txBufferTail = 0;
+    // at most two spans, up to the end of the buffer and from its start
+    uint8_t *span;
+    uint32_t chunk;
+    while ((chunk = ringBufferPeekSpan(&s->port.txBuffer, &span))) {
+        dyad_write(s->conn, span, chunk);
+        ringBufferConsume(&s->port.txBuffer, chunk);
     }
-    int chunk = s->port.txBufferHead - s->port.txBufferTail;
-    if (chunk)
-        dyad_write(s->conn, (const void*)&s->port.txBuffer[s->port.txBufferTail], chunk);
-    s->port.txBufferTail = s->port.txBufferHead;
 
     pthread_mutex_unlock(&s->txLock);
 }
 
-void tcpDataIn(tcpPort_t *instance, uint8_t* ch, int size)
+static bool tcpSetIdleCallback(serialPort_t *instance, serialIdleCallbackPtr cb)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
     pthread_mutex_lock(&s->rxLock);
+    s->port.idleCallback = cb;
+    pthread_mutex_unlock(&s->rxLock);
+    return true;
+}
 
-    while (size--) {
-//        printf("%c", *ch);
-        s->port.rxBuffer[s->port.rxBufferHead] = *(ch++);
-        if (s->port.rxBufferHead + 1 >= s->port.rxBufferSize) {
-            s->port.rxBufferHead = 0;
-        } else {
-            s->port.rxBufferHead++;
-        }
+void tcpDataIn(tcpPort_t *instance, uint8_t* ch, int size)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    pthread_mutex_lock(&s->rxLock);
+    if (s->port.idleCallback) {
+        // Emulates the idle line receiver, every write from the client is one frame
+        s->port.idleCallback(ch, size, NULL, 0, micros(), s->port.rxCallbackData);
+        pthread_mutex_unlock(&s->rxLock);
+        return;
     }
+    ringBufferPushN(&s->port.rxBuffer, ch, size);
     pthread_mutex_unlock(&s->rxLock);
-//    printf("\n");
 }
 
 static const struct serialPortVTable tcpVTable = {
@@ -268,7 +274,9 @@ static const struct serialPortVTable tcpVTable = {
         .setMode = NULL,
         .setCtrlLineStateCb = NULL,
         .setBaudRateCb = NULL,
-        .writeBuf = NULL,
+        .writeBuf = tcpWriteBuf,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = tcpReadBuf,
+        .setIdleCallback = tcpSetIdleCallback,
 };
@@ -24,8 +24,8 @@
 #include <pthread.h>
 #include "dyad.h"
 
-#define RX_BUFFER_SIZE    1400
-#define TX_BUFFER_SIZE    1400
+#define RX_BUFFER_SIZE    2048
+#define TX_BUFFER_SIZE    2048
 
 typedef struct {
     serialPort_t port;
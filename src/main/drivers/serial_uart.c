@@ -43,6 +43,7 @@
 #include "drivers/serial.h"
 #include "drivers/serial_uart.h"
 #include "drivers/serial_uart_impl.h"
+#include "drivers/time.h"
 
 static void uartSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
@@ -80,7 +81,12 @@ void uartTryStartTxDMA(uartPort_t *s)
 
         // DMA_Cmd(s->txDMAStream, DISABLE); // XXX It's already disabled.
 
-        if (s->port.txBufferHead == s->port.txBufferTail) {
+        // The previous transaction has finished, its span of the buffer can be reused.
+        ringBufferConsume(&s->port.txBuffer, s->txDMALength);
+
+        uint8_t *span;
+        s->txDMALength = ringBufferPeekSpan(&s->port.txBuffer, &span);
+        if (!s->txDMALength) {
             // No more data to transmit.
             s->txDMAEmpty = true;
             return;
@@ -88,16 +94,8 @@ void uartTryStartTxDMA(uartPort_t *s)
 
         // Start a new transaction.
 
-        DMA_MemoryTargetConfig(s->txDMAStream, (uint32_t)&s->port.txBuffer[s->port.txBufferTail], DMA_Memory_0);
-        //s->txDMAStream->M0AR = (uint32_t)&s->port.txBuffer[s->port.txBufferTail];
-        if (s->port.txBufferHead > s->port.txBufferTail) {
-            s->txDMAStream->NDTR = s->port.txBufferHead - s->port.txBufferTail;
-            s->port.txBufferTail = s->port.txBufferHead;
-        }
-        else {
-            s->txDMAStream->NDTR = s->port.txBufferSize - s->port.txBufferTail;
-            s->port.txBufferTail = 0;
-        }
+        DMA_MemoryTargetConfig(s->txDMAStream, (uint32_t)span, DMA_Memory_0);
+        s->txDMAStream->NDTR = s->txDMALength;
         s->txDMAEmpty = false;
 
     reenable:
@@ -117,7 +115,12 @@ void uartTryStartTxDMA(uartPort_t *s)
             goto reenable;
         }
 
-        if (s->port.txBufferHead == s->port.txBufferTail) {
+        // The previous transaction has finished, its span of the buffer can be reused.
+        ringBufferConsume(&s->port.txBuffer, s->txDMALength);
+
+        uint8_t *span;
+        s->txDMALength = ringBufferPeekSpan(&s->port.txBuffer, &span);
+        if (!s->txDMALength) {
             // No more data to transmit.
             s->txDMAEmpty = true;
             return;
@@ -125,14 +128,8 @@ void uartTryStartTxDMA(uartPort_t *s)
 
         // Start a new transaction.
 
-        s->txDMAChannel->CMAR = (uint32_t)&s->port.txBuffer[s->port.txBufferTail];
-        if (s->port.txBufferHead > s->port.txBufferTail) {
-            s->txDMAChannel->CNDTR = s->port.txBufferHead - s->port.txBufferTail;
-            s->port.txBufferTail = s->port.txBufferHead;
-        } else {
-            s->txDMAChannel->CNDTR = s->port.txBufferSize - s->port.txBufferTail;
-            s->port.txBufferTail = 0;
-        }
+        s->txDMAChannel->CMAR = (uint32_t)span;
+        s->txDMAChannel->CNDTR = s->txDMALength;
         s->txDMAEmpty = false;
 
     reenable:
@@ -141,71 +138,50 @@ void uartTryStartTxDMA(uartPort_t *s)
     }
 }
 
-static uint32_t uartTotalRxBytesWaiting(const serialPort_t *instance)
+// The circular RX DMA is the producer, the head follows its position in the buffer
+static uint32_t uartRxDMAHead(const uartPort_t *s)
+{
+#ifdef STM32F4
+    const uint32_t position = ringBufferSize(&s->port.rxBuffer) - s->rxDMAStream->NDTR;
+#else
+    const uint32_t position = ringBufferSize(&s->port.rxBuffer) - s->rxDMAChannel->CNDTR;
+#endif
+    const uint32_t head = s->port.rxBuffer.head;
+
+    return head + ((position - head) & s->port.rxBuffer.mask);
+}
+
+static void uartUpdateRxHead(uartPort_t *s)
 {
-    const uartPort_t *s = (const uartPort_t*)instance;
 #ifdef STM32F4
     if (s->rxDMAStream) {
-        uint32_t rxDMAHead = s->rxDMAStream->NDTR;
 #else
     if (s->rxDMAChannel) {
-        uint32_t rxDMAHead = s->rxDMAChannel->CNDTR;
 #endif
-        if (rxDMAHead >= s->rxDMAPos) {
-            return rxDMAHead - s->rxDMAPos;
-        } else {
-            return s->port.rxBufferSize + rxDMAHead - s->rxDMAPos;
-        }
-    }
-
-    if (s->port.rxBufferHead >= s->port.rxBufferTail) {
-        return s->port.rxBufferHead - s->port.rxBufferTail;
-    } else {
-        return s->port.rxBufferSize + s->port.rxBufferHead - s->port.rxBufferTail;
+        s->port.rxBuffer.head = uartRxDMAHead(s);
     }
 }
 
-static uint32_t uartTotalTxBytesFree(const serialPort_t *instance)
+static uint32_t uartTotalRxBytesWaiting(const serialPort_t *instance)
 {
     const uartPort_t *s = (const uartPort_t*)instance;
-
-    uint32_t bytesUsed;
-
-    if (s->port.txBufferHead >= s->port.txBufferTail) {
-        bytesUsed = s->port.txBufferHead - s->port.txBufferTail;
-    } else {
-        bytesUsed = s->port.txBufferSize + s->port.txBufferHead - s->port.txBufferTail;
-    }
-
 #ifdef STM32F4
-    if (s->txDMAStream) {
-        /*
-         * When we queue up a DMA request, we advance the Tx buffer tail before the transfer finishes, so we must add
-         * the remaining size of that in-progress transfer here instead:
-         */
-        bytesUsed += s->txDMAStream->NDTR;
+    if (s->rxDMAStream) {
 #else
-    if (s->txDMAChannel) {
-        /*
-         * When we queue up a DMA request, we advance the Tx buffer tail before the transfer finishes, so we must add
-         * the remaining size of that in-progress transfer here instead:
-         */
-        bytesUsed += s->txDMAChannel->CNDTR;
+    if (s->rxDMAChannel) {
 #endif
-        /*
-         * If the Tx buffer is being written to very quickly, we might have advanced the head into the buffer
-         * space occupied by the current DMA transfer. In that case the "bytesUsed" total will actually end up larger
-         * than the total Tx buffer size, because we'll end up transmitting the same buffer region twice. (So we'll be
-         * transmitting a garbage mixture of old and new bytes).
-         *
-         * Be kind to callers and pretend like our buffer can only ever be 100% full.
-         */
-        if (bytesUsed >= s->port.txBufferSize - 1) {
-            return 0;
-        }
+        return uartRxDMAHead(s) - s->port.rxBuffer.tail;
     }
 
-    return (s->port.txBufferSize - 1) - bytesUsed;
+    return ringBufferUsed(&s->port.rxBuffer);
+}
+
+static uint32_t uartTotalTxBytesFree(const serialPort_t *instance)
+{
+    const uartPort_t *s = (const uartPort_t*)instance;
+
+    // An in-progress DMA transfer keeps its span until it has finished, so it is already accounted for
+    return ringBufferFree(&s->port.txBuffer);
 }
 
 static bool isUartTransmitBufferEmpty(const serialPort_t *instance)
@@ -218,44 +194,64 @@ static bool isUartTransmitBufferEmpty(const serialPort_t *instance)
 #endif
         return s->txDMAEmpty;
     else
-        return s->port.txBufferTail == s->port.txBufferHead;
+        return ringBufferIsEmpty(&s->port.txBuffer);
 }
 
 static uint8_t uartRead(serialPort_t *instance)
 {
-    uint8_t ch;
     uartPort_t *s = (uartPort_t *)instance;
 
-#ifdef STM32F4
-    if (s->rxDMAStream) {
-#else
-    if (s->rxDMAChannel) {
-#endif
-        ch = s->port.rxBuffer[s->port.rxBufferSize - s->rxDMAPos];
-        if (--s->rxDMAPos == 0)
-            s->rxDMAPos = s->port.rxBufferSize;
-    } else {
-        ch = s->port.rxBuffer[s->port.rxBufferTail];
-        if (s->port.rxBufferTail + 1 >= s->port.rxBufferSize) {
-            s->port.rxBufferTail = 0;
-        } else {
-            s->port.rxBufferTail++;
-        }
-    }
+    uartUpdateRxHead(s);
 
-    return ch;
+    return ringBufferPop(&s->port.rxBuffer);
 }
 
-static void uartWrite(serialPort_t *instance, uint8_t ch)
+static uint32_t uartReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
 {
     uartPort_t *s = (uartPort_t *)instance;
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
-        s->port.txBufferHead = 0;
-    } else {
-        s->port.txBufferHead++;
+
+    uartUpdateRxHead(s);
+
+    return ringBufferPopN(&s->port.rxBuffer, data, count);
+}
+
+static bool uartSetIdleCallback(serialPort_t *instance, serialIdleCallbackPtr cb)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    if (!(s->port.mode & MODE_RX)) {
+        return false;
+    }
+
+    USART_ITConfig(s->USARTx, USART_IT_IDLE, DISABLE);
+    s->port.idleCallback = cb;
+    if (cb) {
+        USART_ITConfig(s->USARTx, USART_IT_IDLE, ENABLE);
     }
 
+    return true;
+}
+
+// Called from the USART interrupt when the line goes idle, everything received since the last time is one frame
+void uartIdleHandler(uartPort_t *s)
+{
+    const timeUs_t frameTimeUs = micros();
+    ringBuffer_t *rxBuffer = &s->port.rxBuffer;
+
+    uartUpdateRxHead(s);
+
+    const uint32_t length = ringBufferUsed(rxBuffer);
+    if (length) {
+        // A frame that wraps around the end of the buffer goes to the parser as two spans, the second at the start
+        uint8_t *frame;
+        const uint32_t spanLength = ringBufferPeekSpan(rxBuffer, &frame);
+        s->port.idleCallback(frame, spanLength, rxBuffer->buffer, length - spanLength, frameTimeUs, s->port.rxCallbackData);
+        ringBufferConsume(rxBuffer, length);
+    }
+}
+
+static void uartStartTx(uartPort_t *s)
+{
 #ifdef STM32F4
     if (s->txDMAStream)
 #else
@@ -268,6 +264,28 @@ static void uartWrite(serialPort_t *instance, uint8_t ch)
     }
 }
 
+static void uartWrite(serialPort_t *instance, uint8_t ch)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    ringBufferPush(&s->port.txBuffer, ch);
+    uartStartTx(s);
+}
+
+static void uartWriteBuf(serialPort_t *instance, const void *data, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    const uint8_t *p = data;
+
+    while (count > 0) {
+        // Waits for the transmitter to make room when the buffer is full
+        const uint32_t written = ringBufferPushN(&s->port.txBuffer, p, count);
+        p += written;
+        count -= written;
+        uartStartTx(s);
+    }
+}
+
 const struct serialPortVTable uartVTable[] = {
     {
         .serialWrite = uartWrite,
@@ -279,9 +297,11 @@ const struct serialPortVTable uartVTable[] = {
         .setMode = uartSetMode,
         .setCtrlLineStateCb = NULL,
         .setBaudRateCb = NULL,
-        .writeBuf = NULL,
+        .writeBuf = uartWriteBuf,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = uartReadBuf,
+        .setIdleCallback = uartSetIdleCallback,
     }
 };
 
@@ -31,6 +31,7 @@
 #include "platform.h"
 
 #include "build/build_config.h"
+#include "build/atomic.h"
 
 #include "common/utils.h"
 #include "drivers/io.h"
@@ -42,6 +43,7 @@
 #include "drivers/serial.h"
 #include "drivers/serial_uart.h"
 #include "drivers/serial_uart_impl.h"
+#include "drivers/time.h"
 
 static void usartConfigurePinInversion(uartPort_t *uartPort) {
     bool inverted = uartPort->port.options & SERIAL_INVERTED;
@@ -136,10 +138,8 @@ void uartReconfigure(uartPort_t *uartPort)
             /* Associate the initialized DMA handle to the UART handle */
             __HAL_LINKDMA(&uartPort->Handle, hdmarx, uartPort->rxDMAHandle);
 
-            HAL_UART_Receive_DMA(&uartPort->Handle, (uint8_t*)uartPort->port.rxBuffer, uartPort->port.rxBufferSize);
-
-            uartPort->rxDMAPos = __HAL_DMA_GET_COUNTER(&uartPort->rxDMAHandle);
-
+            ringBufferReset(&uartPort->port.rxBuffer);
+            HAL_UART_Receive_DMA(&uartPort->Handle, uartPort->port.rxBuffer.buffer, ringBufferSize(&uartPort->port.rxBuffer));
         }
         else
         {
@@ -152,6 +152,12 @@ void uartReconfigure(uartPort_t *uartPort)
             /* Enable the UART Data Register not empty Interrupt */
             SET_BIT(uartPort->USARTx->CR1, USART_CR1_RXNEIE);
         }
+
+        // HAL_UART_Init() cleared it
+        if (uartPort->port.idleCallback) {
+            __HAL_UART_CLEAR_IDLEFLAG(&uartPort->Handle);
+            __HAL_UART_ENABLE_IT(&uartPort->Handle, UART_IT_IDLE);
+        }
     }
 
     // Transmit DMA or IRQ
@@ -202,10 +208,12 @@ serialPort_t *uartOpen(UARTDevice_e device, serialReceiveCallbackPtr callback, v
     s->txDMAEmpty = true;
 
     // common serial initialisation code should move to serialPort::init()
-    s->port.rxBufferHead = s->port.rxBufferTail = 0;
-    s->port.txBufferHead = s->port.txBufferTail = 0;
+    ringBufferReset(&s->port.rxBuffer);
+    ringBufferReset(&s->port.txBuffer);
+    s->txDMALength = 0;
     // callback works for IRQ-based RX ONLY
     s->port.rxCallback = callback;
+    s->port.idleCallback = NULL;
     s->port.rxCallbackData = callbackData;
     s->port.mode = mode;
     s->port.baudRate = baudRate;
@@ -232,80 +240,53 @@ void uartSetMode(serialPort_t *instance, portMode_e mode)
 
 void uartStartTxDMA(uartPort_t *s)
 {
-    uint16_t size = 0;
-    uint32_t fromwhere=0;
-    HAL_UART_StateTypeDef state = HAL_UART_GetState(&s->Handle);
-    if ((state & HAL_UART_STATE_BUSY_TX) == HAL_UART_STATE_BUSY_TX)
-        return;
-
-    if (s->port.txBufferHead > s->port.txBufferTail) {
-        size = s->port.txBufferHead - s->port.txBufferTail;
-        fromwhere = s->port.txBufferTail;
-        s->port.txBufferTail = s->port.txBufferHead;
-    } else {
-        size = s->port.txBufferSize - s->port.txBufferTail;
-        fromwhere = s->port.txBufferTail;
-        s->port.txBufferTail = 0;
+    // Called from uartWrite and from the TC interrupt, both consume the finished span
+    ATOMIC_BLOCK(NVIC_PRIO_SERIALUART_TXDMA) {
+        HAL_UART_StateTypeDef state = HAL_UART_GetState(&s->Handle);
+        if ((state & HAL_UART_STATE_BUSY_TX) == HAL_UART_STATE_BUSY_TX)
+            return;
+
+        // The previous transaction has finished, its span of the buffer can be reused.
+        ringBufferConsume(&s->port.txBuffer, s->txDMALength);
+
+        uint8_t *span;
+        s->txDMALength = ringBufferPeekSpan(&s->port.txBuffer, &span);
+        if (!s->txDMALength) {
+            s->txDMAEmpty = true;
+            return;
+        }
+        s->txDMAEmpty = false;
+        // No cache clean, the port buffers are in DTCM (FAST_RAM) which the data cache doesn't cover
+        HAL_UART_Transmit_DMA(&s->Handle, span, s->txDMALength);
     }
-    s->txDMAEmpty = false;
-    //HAL_CLEANCACHE((uint8_t *)&s->port.txBuffer[fromwhere],size);
-    HAL_UART_Transmit_DMA(&s->Handle, (uint8_t *)&s->port.txBuffer[fromwhere], size);
+}
+
+// The circular RX DMA is the producer, the head follows its position in the buffer
+static uint32_t uartRxDMAHead(const uartPort_t *s)
+{
+    const uint32_t position = ringBufferSize(&s->port.rxBuffer) - __HAL_DMA_GET_COUNTER(s->Handle.hdmarx);
+    const uint32_t head = s->port.rxBuffer.head;
+
+    return head + ((position - head) & s->port.rxBuffer.mask);
 }
 
 uint32_t uartTotalRxBytesWaiting(const serialPort_t *instance)
 {
-    uartPort_t *s = (uartPort_t*)instance;
+    const uartPort_t *s = (const uartPort_t*)instance;
 
     if (s->rxDMAStream) {
-        uint32_t rxDMAHead = __HAL_DMA_GET_COUNTER(s->Handle.hdmarx);
-
-        if (rxDMAHead >= s->rxDMAPos) {
-            return rxDMAHead - s->rxDMAPos;
-        } else {
-            return s->port.rxBufferSize + rxDMAHead - s->rxDMAPos;
-        }
+        return uartRxDMAHead(s) - s->port.rxBuffer.tail;
     }
 
-    if (s->port.rxBufferHead >= s->port.rxBufferTail) {
-        return s->port.rxBufferHead - s->port.rxBufferTail;
-    } else {
-        return s->port.rxBufferSize + s->port.rxBufferHead - s->port.rxBufferTail;
-    }
+    return ringBufferUsed(&s->port.rxBuffer);
 }
 
 uint32_t uartTotalTxBytesFree(const serialPort_t *instance)
 {
-    uartPort_t *s = (uartPort_t*)instance;
-
-    uint32_t bytesUsed;
+    const uartPort_t *s = (const uartPort_t*)instance;
 
-    if (s->port.txBufferHead >= s->port.txBufferTail) {
-        bytesUsed = s->port.txBufferHead - s->port.txBufferTail;
-    } else {
-        bytesUsed = s->port.txBufferSize + s->port.txBufferHead - s->port.txBufferTail;
-    }
-
-    if (s->txDMAStream) {
-        /*
-         * When we queue up a DMA request, we advance the Tx buffer tail before the transfer finishes, so we must add
-         * the remaining size of that in-progress transfer here instead:
-         */
-        bytesUsed += __HAL_DMA_GET_COUNTER(s->Handle.hdmatx);
-
-        /*
-         * If the Tx buffer is being written to very quickly, we might have advanced the head into the buffer
-         * space occupied by the current DMA transfer. In that case the "bytesUsed" total will actually end up larger
-         * than the total Tx buffer size, because we'll end up transmitting the same buffer region twice. (So we'll be
-         * transmitting a garbage mixture of old and new bytes).
-         *
-         * Be kind to callers and pretend like our buffer can only ever be 100% full.
-         */
-        if (bytesUsed >= s->port.txBufferSize - 1) {
-            return 0;
-        }
-    }
-
-    return (s->port.txBufferSize - 1) - bytesUsed;
+    // An in-progress DMA transfer keeps its span until it has finished, so it is already accounted for
+    return ringBufferFree(&s->port.txBuffer);
 }
 
 bool isUartTransmitBufferEmpty(const serialPort_t *instance)
@@ -314,40 +295,71 @@ bool isUartTransmitBufferEmpty(const serialPort_t *instance)
     if (s->txDMAStream)
         return s->txDMAEmpty;
     else
-        return s->port.txBufferTail == s->port.txBufferHead;
+        return ringBufferIsEmpty(&s->port.txBuffer);
 }
 
 uint8_t uartRead(serialPort_t *instance)
 {
-    uint8_t ch;
     uartPort_t *s = (uartPort_t *)instance;
 
     if (s->rxDMAStream) {
-        ch = s->port.rxBuffer[s->port.rxBufferSize - s->rxDMAPos];
-        if (--s->rxDMAPos == 0)
-            s->rxDMAPos = s->port.rxBufferSize;
-    } else {
-        ch = s->port.rxBuffer[s->port.rxBufferTail];
-        if (s->port.rxBufferTail + 1 >= s->port.rxBufferSize) {
-            s->port.rxBufferTail = 0;
-        } else {
-            s->port.rxBufferTail++;
-        }
+        s->port.rxBuffer.head = uartRxDMAHead(s);
     }
 
-    return ch;
+    return ringBufferPop(&s->port.rxBuffer);
 }
 
-void uartWrite(serialPort_t *instance, uint8_t ch)
+static uint32_t uartReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
 {
     uartPort_t *s = (uartPort_t *)instance;
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
-        s->port.txBufferHead = 0;
-    } else {
-        s->port.txBufferHead++;
+
+    if (s->rxDMAStream) {
+        s->port.rxBuffer.head = uartRxDMAHead(s);
     }
 
+    return ringBufferPopN(&s->port.rxBuffer, data, count);
+}
+
+static bool uartSetIdleCallback(serialPort_t *instance, serialIdleCallbackPtr cb)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    if (!(s->port.mode & MODE_RX)) {
+        return false;
+    }
+
+    __HAL_UART_DISABLE_IT(&s->Handle, UART_IT_IDLE);
+    s->port.idleCallback = cb;
+    if (cb) {
+        __HAL_UART_CLEAR_IDLEFLAG(&s->Handle);
+        __HAL_UART_ENABLE_IT(&s->Handle, UART_IT_IDLE);
+    }
+
+    return true;
+}
+
+// Called from the USART interrupt when the line goes idle, everything received since the last time is one frame
+void uartIdleHandler(uartPort_t *s)
+{
+    const timeUs_t frameTimeUs = micros();
+    ringBuffer_t *rxBuffer = &s->port.rxBuffer;
+
+    if (s->rxDMAStream) {
+        rxBuffer->head = uartRxDMAHead(s);
+    }
+
+    const uint32_t length = ringBufferUsed(rxBuffer);
+    if (length) {
+        // A frame that wraps around the end of the buffer goes to the parser as two spans, the second at the start
+        uint8_t *frame;
+        const uint32_t spanLength = ringBufferPeekSpan(rxBuffer, &frame);
+        s->port.idleCallback(frame, spanLength, rxBuffer->buffer, length - spanLength, frameTimeUs, s->port.rxCallbackData);
+        ringBufferConsume(rxBuffer, length);
+    }
+}
+
+static void uartStartTx(uartPort_t *s)
+{
     if (s->txDMAStream) {
         if (!(s->txDMAStream->CR & 1))
             uartStartTxDMA(s);
@@ -356,6 +368,28 @@ void uartWrite(serialPort_t *instance, uint8_t ch)
     }
 }
 
+void uartWrite(serialPort_t *instance, uint8_t ch)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    ringBufferPush(&s->port.txBuffer, ch);
+    uartStartTx(s);
+}
+
+static void uartWriteBuf(serialPort_t *instance, const void *data, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    const uint8_t *p = data;
+
+    while (count > 0) {
+        // Waits for the transmitter to make room when the buffer is full
+        const uint32_t written = ringBufferPushN(&s->port.txBuffer, p, count);
+        p += written;
+        count -= written;
+        uartStartTx(s);
+    }
+}
+
 const struct serialPortVTable uartVTable[] = {
     {
         .serialWrite = uartWrite,
@@ -367,9 +401,11 @@ const struct serialPortVTable uartVTable[] = {
         .setMode = uartSetMode,
         .setCtrlLineStateCb = NULL,
         .setBaudRateCb = NULL,
-        .writeBuf = NULL,
+        .writeBuf = uartWriteBuf,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = uartReadBuf,
+        .setIdleCallback = uartSetIdleCallback,
     }
 };
 
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "common/utils.h"
+
 // Configuration constants
 
 #if defined(STM32F1)
@@ -62,6 +64,10 @@
 #error unknown MCU family
 #endif
 
+// The buffers back ring buffers
+STATIC_ASSERT((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) == 0, uart_rx_buffer_size_not_power_of_two);
+STATIC_ASSERT((UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) == 0, uart_tx_buffer_size_not_power_of_two);
+
 // Count number of configured UARTs
 
 #ifdef USE_UART1
@@ -155,8 +161,8 @@ typedef struct uartDevice_s {
     const uartHardware_t *hardware;
     ioTag_t rx;
     ioTag_t tx;
-    volatile uint8_t rxBuffer[UART_RX_BUFFER_SIZE];
-    volatile uint8_t txBuffer[UART_TX_BUFFER_SIZE];
+    uint8_t rxBuffer[UART_RX_BUFFER_SIZE];
+    uint8_t txBuffer[UART_TX_BUFFER_SIZE];
 } uartDevice_t;
 
 extern uartDevice_t *uartDevmap[];
@@ -172,5 +178,6 @@ void uartTryStartTxDMA(uartPort_t *s);
 uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode, portOptions_e options);
 
 void uartIrqHandler(uartPort_t *s);
+void uartIdleHandler(uartPort_t *s);
 
 void uartReconfigure(uartPort_t *uartPort);
@@ -132,10 +132,8 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
 
     s->port.baudRate = baudRate;
 
-    s->port.rxBuffer = uartdev->rxBuffer;
-    s->port.txBuffer = uartdev->txBuffer;
-    s->port.rxBufferSize = ARRAYLEN(uartdev->rxBuffer);
-    s->port.txBufferSize = ARRAYLEN(uartdev->txBuffer);
+    ringBufferInit(&s->port.rxBuffer, uartdev->rxBuffer, sizeof(uartdev->rxBuffer));
+    ringBufferInit(&s->port.txBuffer, uartdev->txBuffer, sizeof(uartdev->txBuffer));
 
     const uartHardware_t *hardware = uartdev->hardware;
 
@@ -175,16 +173,14 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
         }
     }
 
-    // RX/TX Interrupt
-    if (!hardware->rxDMAChannel || !hardware->txDMAChannel) {
-        NVIC_InitTypeDef NVIC_InitStructure;
+    // RX/TX Interrupt, also needed with DMA in both directions for the idle line interrupt
+    NVIC_InitTypeDef NVIC_InitStructure;
 
-        NVIC_InitStructure.NVIC_IRQChannel = hardware->irqn;
-        NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = NVIC_PRIORITY_BASE(hardware->rxPriority);
-        NVIC_InitStructure.NVIC_IRQChannelSubPriority = NVIC_PRIORITY_SUB(hardware->rxPriority);
-        NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-        NVIC_Init(&NVIC_InitStructure);
-    }
+    NVIC_InitStructure.NVIC_IRQChannel = hardware->irqn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = NVIC_PRIORITY_BASE(hardware->rxPriority);
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = NVIC_PRIORITY_SUB(hardware->rxPriority);
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
 
     return s;
 }
@@ -195,21 +191,20 @@ void uartIrqHandler(uartPort_t *s)
 
     if (SR & USART_FLAG_RXNE && !s->rxDMAChannel) {
         // If we registered a callback, pass crap there
-        if (s->port.rxCallback) {
+        if (s->port.rxCallback && !s->port.idleCallback) {
             s->port.rxCallback(s->USARTx->DR, s->port.rxCallbackData);
         } else {
-            s->port.rxBuffer[s->port.rxBufferHead++] = s->USARTx->DR;
-            if (s->port.rxBufferHead >= s->port.rxBufferSize) {
-                s->port.rxBufferHead = 0;
-            }
+            ringBufferPush(&s->port.rxBuffer, s->USARTx->DR);
         }
     }
+    if (SR & USART_FLAG_IDLE && s->port.idleCallback) {
+        // Reading DR after SR clears the flag
+        (void)s->USARTx->DR;
+        uartIdleHandler(s);
+    }
     if (SR & USART_FLAG_TXE) {
-        if (s->port.txBufferTail != s->port.txBufferHead) {
-            s->USARTx->DR = s->port.txBuffer[s->port.txBufferTail++];
-            if (s->port.txBufferTail >= s->port.txBufferSize) {
-                s->port.txBufferTail = 0;
-            }
+        if (!ringBufferIsEmpty(&s->port.txBuffer)) {
+            s->USARTx->DR = ringBufferPop(&s->port.txBuffer);
         } else {
             USART_ITConfig(s->USARTx, USART_IT_TXE, DISABLE);
         }
@@ -217,10 +217,8 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
 
     s->port.baudRate = baudRate;
 
-    s->port.rxBuffer = uartDev->rxBuffer;
-    s->port.txBuffer = uartDev->txBuffer;
-    s->port.rxBufferSize = sizeof(uartDev->rxBuffer);
-    s->port.txBufferSize = sizeof(uartDev->txBuffer);
+    ringBufferInit(&s->port.rxBuffer, uartDev->rxBuffer, sizeof(uartDev->rxBuffer));
+    ringBufferInit(&s->port.txBuffer, uartDev->txBuffer, sizeof(uartDev->txBuffer));
 
     const uartHardware_t *hardware = uartDev->hardware;
 
@@ -244,15 +242,14 @@ uartPort_t *serialUART(UARTDevice_e device, uint32_t baudRate, portMode_e mode,
 
     serialUARTInitIO(IOGetByTag(uartDev->tx), IOGetByTag(uartDev->rx), mode, options, hardware->af, device);
 
-    if (!s->rxDMAChannel || !s->txDMAChannel) {
-        NVIC_InitTypeDef NVIC_InitStructure;
+    // Also needed with DMA in both directions for the idle line interrupt
+    NVIC_InitTypeDef NVIC_InitStructure;
 
-        NVIC_InitStructure.NVIC_IRQChannel = hardware->irqn;
-        NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = NVIC_PRIORITY_BASE(hardware->rxPriority);
-        NVIC_InitStructure.NVIC_IRQChannelSubPriority = NVIC_PRIORITY_SUB(hardware->rxPriority);
-        NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-        NVIC_Init(&NVIC_InitStructure);
-    }
+    NVIC_InitStructure.NVIC_IRQChannel = hardware->irqn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = NVIC_PRIORITY_BASE(hardware->rxPriority);
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = NVIC_PRIORITY_SUB(hardware->rxPriority);
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
 
     return s;
 }
@@ -262,22 +259,21 @@ void uartIrqHandler(uartPort_t *s)
     uint32_t ISR = s->USARTx->ISR;
 
     if (!s->rxDMAChannel && (ISR & USART_FLAG_RXNE)) {
-        if (s->port.rxCallback) {
+        if (s->port.rxCallback && !s->port.idleCallback) {
             s->port.rxCallback(s->USARTx->RDR, s->port.rxCallbackData);
         } else {
-            s->port.rxBuffer[s->port.rxBufferHead++] = s->USARTx->RDR;
-            if (s->port.rxBufferHead >= s->port.rxBufferSize) {
-                s->port.rxBufferHead = 0;
-            }
+            ringBufferPush(&s->port.rxBuffer, s->USARTx->RDR);
         }
     }
 
+    if ((ISR & USART_FLAG_IDLE) && s->port.idleCallback) {
+        USART_ClearITPendingBit(s->USARTx, USART_IT_IDLE);
+        uartIdleHandler(s);
+    }
+
     if (!s->txDMAChannel && (ISR & USART_FLAG_TXE)) {
-        if (s->port.txBufferTail != s->port.txBufferHead) {
-            USART_SendData(s->USARTx, s->port.txBuffer[s->port.txBufferTail++]);
-            if (s->port.txBufferTail >= s->port.txBufferSize) {
-                s->port.txBufferTail = 0;
-            }
+        if (!ringBufferIsEmpty(&s->port.txBuffer)) {
+            USART_SendData(s->USARTx, ringBufferPop(&s->port.txBuffer));
         } else {
             USART_ITConfig(s->USARTx, USART_IT_TXE, DISABLE);
         }
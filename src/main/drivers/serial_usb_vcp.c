@@ -122,6 +122,13 @@ static uint8_t usbVcpRead(serialPort_t *instance)
     }
 }
 
+static uint32_t usbVcpReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
+{
+    UNUSED(instance);
+
+    return CDC_Receive_DATA(data, count);
+}
+
 static void usbVcpWriteBuf(serialPort_t *instance, const void *data, int count)
 {
     UNUSED(instance);
@@ -192,6 +199,12 @@ static uint32_t usbTxBytesFree(const serialPort_t *instance)
     return CDC_Send_FreeBytes();
 }
 
+static uint32_t usbVcpTxBufferSize(const serialPort_t *instance)
+{
+    UNUSED(instance);
+    return CDC_Send_BufferSize();
+}
+
 static void usbVcpEndWrite(serialPort_t *instance)
 {
     vcpPort_t *port = container_of(instance, vcpPort_t, port);
@@ -212,7 +225,9 @@ static const struct serialPortVTable usbVTable[] = {
         .setBaudRateCb = usbVcpSetBaudRateCb,
         .writeBuf = usbVcpWriteBuf,
         .beginWrite = usbVcpBeginWrite,
-        .endWrite = usbVcpEndWrite
+        .endWrite = usbVcpEndWrite,
+        .readBuf = usbVcpReadBuf,
+        .serialTxBufferSize = usbVcpTxBufferSize
     }
 };
 
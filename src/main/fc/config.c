@@ -59,6 +59,8 @@
 
 #include "rx/rx.h"
 
+#include "scheduler/scheduler.h"
+
 #include "sensors/acceleration.h"
 #include "sensors/battery.h"
 #include "sensors/gyro.h"
@@ -83,7 +85,7 @@ PG_RESET_TEMPLATE(pilotConfig_t, pilotConfig,
     .name = { 0 }
 );
 
-PG_REGISTER_WITH_RESET_TEMPLATE(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 2);
+PG_REGISTER_WITH_RESET_TEMPLATE(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 3);
 
 PG_RESET_TEMPLATE(systemConfig_t, systemConfig,
     .pidProfileIndex = 0,
@@ -92,6 +94,7 @@ PG_RESET_TEMPLATE(systemConfig_t, systemConfig,
     .task_statistics = true,
     .cpu_overclock = 0,
     .powerOnArmingGraceTime = 5,
+    .scheduler_mode = SCHEDULER_MODE_PRIORITY,
     .boardIdentifier = TARGET_BOARD_IDENTIFIER
 );
 
@@ -475,6 +478,10 @@ void validateAndFixGyroConfig(void)
     if (gyro.targetLooptime > DYNAMIC_FILTER_MAX_SUPPORTED_LOOP_TIME) {
         featureClear(FEATURE_DYNAMIC_FILTER);
     }
+#ifdef STM32F3
+    // Only the smallest window fits the F3 analyser buffers
+    gyroConfigMutable()->dyn_notch_fft_size = DYN_NOTCH_FFT_SIZE_32;
+#endif
 #endif
 
 #ifdef USE_GYRO_IMUF9001
@@ -972,6 +972,8 @@ static FAST_CODE void subTaskMotorUpdate(timeUs_t currentTimeUs)
 
     writeMotors();
 
+    // gyro sample ready to motor output
+    DEBUG_SET(DEBUG_GYRO_LATENCY, 0, micros() - gyroSampleReadyAtUs());
     DEBUG_SET(DEBUG_PIDLOOP, 2, micros() - startTime);
 }
 
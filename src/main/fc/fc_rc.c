@@ -238,7 +238,9 @@ static void scaleRcCommandToFpvCamAngle(void)
 
 static void checkForThrottleErrorResetState(uint16_t rxRefreshRate)
 {
-    currentRxRefreshRate = constrain(getTaskDeltaTime(TASK_RX),1000,20000);
+    // Prefer the receiver's own frame timestamps, the task runs later than the frame arrives by a varying amount
+    const timeDelta_t rxFrameDeltaUs = rxGetFrameDelta();
+    currentRxRefreshRate = constrain(rxFrameDeltaUs ? rxFrameDeltaUs : getTaskDeltaTime(TASK_RX),1000,20000);
 
     static int index;
     static int16_t rcCommandThrottlePrevious[THROTTLE_BUFFER_MAX];
@@ -364,20 +366,36 @@ FAST_CODE_NOINLINE void rcSmoothingSetFilterCutoffs(rcSmoothingFilter_t *smoothi
                 switch (rxConfig()->rc_smoothing_input_type) {
 
                     case RC_SMOOTHING_INPUT_PT1:
+#ifdef USE_FIXED_POINT_FILTERS
+                        if (!smoothingData->filterInitialized) {
+                            pt1FilterQ15Init(&smoothingData->filter[i].pt1FilterQ15, pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
+                        } else {
+                            pt1FilterQ15UpdateCutoff(&smoothingData->filter[i].pt1FilterQ15, pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
+                        }
+#else
                         if (!smoothingData->filterInitialized) {
                             pt1FilterInit((pt1Filter_t*) &smoothingData->filter[i], pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
                         } else {
                             pt1FilterUpdateCutoff((pt1Filter_t*) &smoothingData->filter[i], pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
                         }
+#endif
                         break;
 
                     case RC_SMOOTHING_INPUT_BIQUAD:
                     default:
+#ifdef USE_FIXED_POINT_FILTERS
+                        if (!smoothingData->filterInitialized) {
+                            biquadFilterQ30InitLPF(&smoothingData->filter[i].biquadFilterQ30, smoothingData->inputCutoffFrequency, targetPidLooptime);
+                        } else {
+                            biquadFilterQ30UpdateLPF(&smoothingData->filter[i].biquadFilterQ30, smoothingData->inputCutoffFrequency, targetPidLooptime);
+                        }
+#else
                         if (!smoothingData->filterInitialized) {
                             biquadFilterInitLPF((biquadFilter_t*) &smoothingData->filter[i], smoothingData->inputCutoffFrequency, targetPidLooptime);
                         } else {
                             biquadFilterUpdateLPF((biquadFilter_t*) &smoothingData->filter[i], smoothingData->inputCutoffFrequency, targetPidLooptime);
                         }
+#endif
                         break;
                 }
             }
@@ -557,12 +575,20 @@ FAST_CODE uint8_t processRcSmoothingFilter(void)
             if (rcSmoothingData.filterInitialized) {
                 switch (rxConfig()->rc_smoothing_input_type) {
                     case RC_SMOOTHING_INPUT_PT1:
+#ifdef USE_FIXED_POINT_FILTERS
+                        rcCommand[updatedChannel] = pt1FilterQ15Apply(&rcSmoothingData.filter[updatedChannel].pt1FilterQ15, lastRxData[updatedChannel]);
+#else
                         rcCommand[updatedChannel] = pt1FilterApply((pt1Filter_t*) &rcSmoothingData.filter[updatedChannel], lastRxData[updatedChannel]);
+#endif
                         break;
 
                     case RC_SMOOTHING_INPUT_BIQUAD:
                     default:
+#ifdef USE_FIXED_POINT_FILTERS
+                        rcCommand[updatedChannel] = biquadFilterQ30ApplyDF1(&rcSmoothingData.filter[updatedChannel].biquadFilterQ30, lastRxData[updatedChannel]);
+#else
                         rcCommand[updatedChannel] = biquadFilterApplyDF1((biquadFilter_t*) &rcSmoothingData.filter[updatedChannel], lastRxData[updatedChannel]);
+#endif
                         break;
                 }
             } else {
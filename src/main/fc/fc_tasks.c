@@ -70,6 +70,7 @@
 #include "io/asyncfatfs/asyncfatfs.h"
 #include "io/beeper.h"
 #include "io/dashboard.h"
+#include "io/flashfs.h"
 #include "io/gps.h"
 #include "io/ledstrip.h"
 #include "io/osd.h"
@@ -253,6 +254,17 @@ static void taskCameraControl(uint32_t currentTime)
 }
 #endif
 
+#ifdef USE_FLASHFS
+static void taskFlashErase(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+    if (flashfsEraseUpdate()) {
+        beeper(BEEPER_BLACKBOX_ERASE);
+    }
+}
+#endif
+
 void fcTasksInit(void)
 {
     schedulerInit();
@@ -286,6 +298,9 @@ void fcTasksInit(void)
 #else
     if (sensors(SENSOR_GYRO)) {
         rescheduleTask(TASK_GYROPID, gyro.targetLooptime);
+        if (gyroInterruptSyncActive()) {
+            cfTasks[TASK_GYROPID].checkFunc = gyroSampleReady;
+        }
         setTaskEnabled(TASK_GYROPID, true);
     }
 
@@ -350,6 +365,9 @@ void fcTasksInit(void)
 #ifdef USE_PINIOBOX
     setTaskEnabled(TASK_PINIOBOX, true);
 #endif
+#ifdef USE_FLASHFS
+    setTaskEnabled(TASK_FLASH_ERASE, flashfsIsSupported());
+#endif
 #ifdef USE_CMS
 #ifdef USE_MSP_DISPLAYPORT
     setTaskEnabled(TASK_CMS, true);
@@ -369,6 +387,8 @@ void fcTasksInit(void)
     setTaskEnabled(TASK_RCDEVICE, rcdeviceIsEnabled());
 #endif
 #endif
+
+    schedulerSetMode(systemConfig()->scheduler_mode);
 }
 
 FAST_RAM cfTask_t cfTasks[TASK_COUNT] = {
@@ -644,5 +664,14 @@ FAST_RAM cfTask_t cfTasks[TASK_COUNT] = {
         .staticPriority = TASK_PRIORITY_IDLE
     },
 #endif
+
+#ifdef USE_FLASHFS
+    [TASK_FLASH_ERASE] = {
+        .taskName = "FLASH_ERASE",
+        .taskFunc = taskFlashErase,
+        .desiredPeriod = TASK_PERIOD_HZ(50),        // at most one sector erase started per run
+        .staticPriority = TASK_PRIORITY_LOW
+    },
+#endif
 #endif
 };
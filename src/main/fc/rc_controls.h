@@ -117,6 +117,8 @@ typedef struct rcSmoothingFilterTraining_s {
 typedef union rcSmoothingFilterTypes_u {
     pt1Filter_t pt1Filter;
     biquadFilter_t biquadFilter;
+    pt1FilterQ15_t pt1FilterQ15;
+    biquadFilterQ30_t biquadFilterQ30;
 } rcSmoothingFilterTypes_t;
 
 typedef struct rcSmoothingFilter_s {
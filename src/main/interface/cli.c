@@ -561,15 +561,7 @@ static uint8_t getRateProfileIndexToUse()
 
 static uint16_t getValueOffset(const clivalue_t *value)
 {
-    switch (value->type & VALUE_SECTION_MASK) {
-    case MASTER_VALUE:
-        return value->offset;
-    case PROFILE_VALUE:
-        return value->offset + sizeof(pidProfile_t) * getPidProfileIndexToUse();
-    case PROFILE_RATE_VALUE:
-        return value->offset + sizeof(controlRateConfig_t) * getRateProfileIndexToUse();
-    }
-    return 0;
+    return settingGetValueOffset(value, getPidProfileIndexToUse(), getRateProfileIndexToUse());
 }
 
 void *cliGetValuePointer(const clivalue_t *value)
@@ -615,17 +607,6 @@ static void dumpPgValue(const clivalue_t *value, uint8_t dumpMask)
     }
 }
 
-static void dumpAllValues(uint16_t valueSection, uint8_t dumpMask)
-{
-    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-        const clivalue_t *value = &valueTable[i];
-        bufWriterFlush(cliWriter);
-        if ((value->type & VALUE_SECTION_MASK) == valueSection) {
-            dumpPgValue(value, dumpMask);
-        }
-    }
-}
-
 static void cliPrintVar(const clivalue_t *var, bool full)
 {
     const void *ptr = cliGetValuePointer(var);
@@ -786,37 +767,35 @@ static bool isEmpty(const char *string)
     return (string == NULL || *string == '\0') ? true : false;
 }
 
-static void printRxFailsafe(uint8_t dumpMask, const rxFailsafeChannelConfig_t *rxFailsafeChannelConfigs, const rxFailsafeChannelConfig_t *defaultRxFailsafeChannelConfigs)
+static void printRxFailsafeEntry(uint8_t dumpMask, uint32_t channel, const rxFailsafeChannelConfig_t *rxFailsafeChannelConfigs, const rxFailsafeChannelConfig_t *defaultRxFailsafeChannelConfigs)
 {
-    // print out rxConfig failsafe settings
-    for (uint32_t channel = 0; channel < MAX_SUPPORTED_RC_CHANNEL_COUNT; channel++) {
-        const rxFailsafeChannelConfig_t *channelFailsafeConfig = &rxFailsafeChannelConfigs[channel];
-        const rxFailsafeChannelConfig_t *defaultChannelFailsafeConfig = &defaultRxFailsafeChannelConfigs[channel];
-        const bool equalsDefault = !memcmp(channelFailsafeConfig, defaultChannelFailsafeConfig, sizeof(*channelFailsafeConfig));
-        const bool requireValue = channelFailsafeConfig->mode == RX_FAILSAFE_MODE_SET;
-        if (requireValue) {
-            const char *format = "rxfail %u %c %d";
-            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
-                channel,
-                rxFailsafeModeCharacters[defaultChannelFailsafeConfig->mode],
-                RXFAIL_STEP_TO_CHANNEL_VALUE(defaultChannelFailsafeConfig->step)
-            );
-            cliDumpPrintLinef(dumpMask, equalsDefault, format,
-                channel,
-                rxFailsafeModeCharacters[channelFailsafeConfig->mode],
-                RXFAIL_STEP_TO_CHANNEL_VALUE(channelFailsafeConfig->step)
-            );
-        } else {
-            const char *format = "rxfail %u %c";
-            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
-                channel,
-                rxFailsafeModeCharacters[defaultChannelFailsafeConfig->mode]
-            );
-            cliDumpPrintLinef(dumpMask, equalsDefault, format,
-                channel,
-                rxFailsafeModeCharacters[channelFailsafeConfig->mode]
-            );
-        }
+    // print out rxConfig failsafe settings of one channel
+    const rxFailsafeChannelConfig_t *channelFailsafeConfig = &rxFailsafeChannelConfigs[channel];
+    const rxFailsafeChannelConfig_t *defaultChannelFailsafeConfig = &defaultRxFailsafeChannelConfigs[channel];
+    const bool equalsDefault = !memcmp(channelFailsafeConfig, defaultChannelFailsafeConfig, sizeof(*channelFailsafeConfig));
+    const bool requireValue = channelFailsafeConfig->mode == RX_FAILSAFE_MODE_SET;
+    if (requireValue) {
+        const char *format = "rxfail %u %c %d";
+        cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+            channel,
+            rxFailsafeModeCharacters[defaultChannelFailsafeConfig->mode],
+            RXFAIL_STEP_TO_CHANNEL_VALUE(defaultChannelFailsafeConfig->step)
+        );
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            channel,
+            rxFailsafeModeCharacters[channelFailsafeConfig->mode],
+            RXFAIL_STEP_TO_CHANNEL_VALUE(channelFailsafeConfig->step)
+        );
+    } else {
+        const char *format = "rxfail %u %c";
+        cliDefaultPrintLinef(dumpMask, equalsDefault, format,
+            channel,
+            rxFailsafeModeCharacters[defaultChannelFailsafeConfig->mode]
+        );
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            channel,
+            rxFailsafeModeCharacters[channelFailsafeConfig->mode]
+        );
     }
 }
 
@@ -902,44 +881,49 @@ static void cliRxFailsafe(char *cmdline)
     }
 }
 
-static void printAux(uint8_t dumpMask, const modeActivationCondition_t *modeActivationConditions, const modeActivationCondition_t *defaultModeActivationConditions)
+static void printAuxEntry(uint8_t dumpMask, uint32_t i, const modeActivationCondition_t *modeActivationConditions, const modeActivationCondition_t *defaultModeActivationConditions)
 {
     const char *format = "aux %u %u %u %u %u %u %u";
-    // print out aux channel settings
-    for (uint32_t i = 0; i < MAX_MODE_ACTIVATION_CONDITION_COUNT; i++) {
-        const modeActivationCondition_t *mac = &modeActivationConditions[i];
-        bool equalsDefault = false;
-        if (defaultModeActivationConditions) {
-            const modeActivationCondition_t *macDefault = &defaultModeActivationConditions[i];
-            equalsDefault = !memcmp(mac, macDefault, sizeof(*mac));
-            const box_t *box = findBoxByBoxId(macDefault->modeId);
-            const box_t *linkedTo = findBoxByBoxId(macDefault->linkedTo);
-            if (box) {
-                cliDefaultPrintLinef(dumpMask, equalsDefault, format,
-                    i,
-                    box->permanentId,
-                    macDefault->auxChannelIndex,
-                    MODE_STEP_TO_CHANNEL_VALUE(macDefault->range.startStep),
-                    MODE_STEP_TO_CHANNEL_VALUE(macDefault->range.endStep),
-                    macDefault->modeLogic,
-                    linkedTo ? linkedTo->permanentId : 0
-                );
-            }
-        }
-        const box_t *box = findBoxByBoxId(mac->modeId);
-        const box_t *linkedTo = findBoxByBoxId(mac->linkedTo);
+    const modeActivationCondition_t *mac = &modeActivationConditions[i];
+    bool equalsDefault = false;
+    if (defaultModeActivationConditions) {
+        const modeActivationCondition_t *macDefault = &defaultModeActivationConditions[i];
+        equalsDefault = !memcmp(mac, macDefault, sizeof(*mac));
+        const box_t *box = findBoxByBoxId(macDefault->modeId);
+        const box_t *linkedTo = findBoxByBoxId(macDefault->linkedTo);
         if (box) {
-            cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
                 i,
                 box->permanentId,
-                mac->auxChannelIndex,
-                MODE_STEP_TO_CHANNEL_VALUE(mac->range.startStep),
-                MODE_STEP_TO_CHANNEL_VALUE(mac->range.endStep),
-                mac->modeLogic,
+                macDefault->auxChannelIndex,
+                MODE_STEP_TO_CHANNEL_VALUE(macDefault->range.startStep),
+                MODE_STEP_TO_CHANNEL_VALUE(macDefault->range.endStep),
+                macDefault->modeLogic,
                 linkedTo ? linkedTo->permanentId : 0
             );
         }
     }
+    const box_t *box = findBoxByBoxId(mac->modeId);
+    const box_t *linkedTo = findBoxByBoxId(mac->linkedTo);
+    if (box) {
+        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+            i,
+            box->permanentId,
+            mac->auxChannelIndex,
+            MODE_STEP_TO_CHANNEL_VALUE(mac->range.startStep),
+            MODE_STEP_TO_CHANNEL_VALUE(mac->range.endStep),
+            mac->modeLogic,
+            linkedTo ? linkedTo->permanentId : 0
+        );
+    }
+}
+
+static void printAux(uint8_t dumpMask, const modeActivationCondition_t *modeActivationConditions, const modeActivationCondition_t *defaultModeActivationConditions)
+{
+    // print out aux channel settings
+    for (uint32_t i = 0; i < MAX_MODE_ACTIVATION_CONDITION_COUNT; i++) {
+        printAuxEntry(dumpMask, i, modeActivationConditions, defaultModeActivationConditions);
+    }
 }
 
 static void cliAux(char *cmdline)
@@ -1261,40 +1245,45 @@ static void cliSerialPassthrough(char *cmdline)
 }
 #endif
 
-static void printAdjustmentRange(uint8_t dumpMask, const adjustmentRange_t *adjustmentRanges, const adjustmentRange_t *defaultAdjustmentRanges)
+static void printAdjustmentRangeEntry(uint8_t dumpMask, uint32_t i, const adjustmentRange_t *adjustmentRanges, const adjustmentRange_t *defaultAdjustmentRanges)
 {
     const char *format = "adjrange %u %u %u %u %u %u %u %u %u";
-    // print out adjustment ranges channel settings
-    for (uint32_t i = 0; i < MAX_ADJUSTMENT_RANGE_COUNT; i++) {
-        const adjustmentRange_t *ar = &adjustmentRanges[i];
-        bool equalsDefault = false;
-        if (defaultAdjustmentRanges) {
-            const adjustmentRange_t *arDefault = &defaultAdjustmentRanges[i];
-            equalsDefault = !memcmp(ar, arDefault, sizeof(*ar));
-            cliDefaultPrintLinef(dumpMask, equalsDefault, format,
-                i,
-                arDefault->adjustmentIndex,
-                arDefault->auxChannelIndex,
-                MODE_STEP_TO_CHANNEL_VALUE(arDefault->range.startStep),
-                MODE_STEP_TO_CHANNEL_VALUE(arDefault->range.endStep),
-                arDefault->adjustmentFunction,
-                arDefault->auxSwitchChannelIndex,
-                arDefault->adjustmentCenter,
-                arDefault->adjustmentScale
-            );
-        }
-        cliDumpPrintLinef(dumpMask, equalsDefault, format,
+    const adjustmentRange_t *ar = &adjustmentRanges[i];
+    bool equalsDefault = false;
+    if (defaultAdjustmentRanges) {
+        const adjustmentRange_t *arDefault = &defaultAdjustmentRanges[i];
+        equalsDefault = !memcmp(ar, arDefault, sizeof(*ar));
+        cliDefaultPrintLinef(dumpMask, equalsDefault, format,
             i,
-            ar->adjustmentIndex,
-            ar->auxChannelIndex,
-            MODE_STEP_TO_CHANNEL_VALUE(ar->range.startStep),
-            MODE_STEP_TO_CHANNEL_VALUE(ar->range.endStep),
-            ar->adjustmentFunction,
-            ar->auxSwitchChannelIndex,
-            ar->adjustmentCenter,
-            ar->adjustmentScale
+            arDefault->adjustmentIndex,
+            arDefault->auxChannelIndex,
+            MODE_STEP_TO_CHANNEL_VALUE(arDefault->range.startStep),
+            MODE_STEP_TO_CHANNEL_VALUE(arDefault->range.endStep),
+            arDefault->adjustmentFunction,
+            arDefault->auxSwitchChannelIndex,
+            arDefault->adjustmentCenter,
+            arDefault->adjustmentScale
         );
     }
+    cliDumpPrintLinef(dumpMask, equalsDefault, format,
+        i,
+        ar->adjustmentIndex,
+        ar->auxChannelIndex,
+        MODE_STEP_TO_CHANNEL_VALUE(ar->range.startStep),
+        MODE_STEP_TO_CHANNEL_VALUE(ar->range.endStep),
+        ar->adjustmentFunction,
+        ar->auxSwitchChannelIndex,
+        ar->adjustmentCenter,
+        ar->adjustmentScale
+    );
+}
+
+static void printAdjustmentRange(uint8_t dumpMask, const adjustmentRange_t *adjustmentRanges, const adjustmentRange_t *defaultAdjustmentRanges)
+{
+    // print out adjustment ranges channel settings
+    for (uint32_t i = 0; i < MAX_ADJUSTMENT_RANGE_COUNT; i++) {
+        printAdjustmentRangeEntry(dumpMask, i, adjustmentRanges, defaultAdjustmentRanges);
+    }
 }
 
 static void cliAdjustmentRange(char *cmdline)
@@ -1568,22 +1557,27 @@ static void cliRxRange(char *cmdline)
 }
 
 #ifdef USE_LED_STRIP
-static void printLed(uint8_t dumpMask, const ledConfig_t *ledConfigs, const ledConfig_t *defaultLedConfigs)
+static void printLedEntry(uint8_t dumpMask, uint32_t i, const ledConfig_t *ledConfigs, const ledConfig_t *defaultLedConfigs)
 {
     const char *format = "led %u %s";
     char ledConfigBuffer[20];
     char ledConfigDefaultBuffer[20];
+    ledConfig_t ledConfig = ledConfigs[i];
+    generateLedConfig(&ledConfig, ledConfigBuffer, sizeof(ledConfigBuffer));
+    bool equalsDefault = false;
+    if (defaultLedConfigs) {
+        ledConfig_t ledConfigDefault = defaultLedConfigs[i];
+        equalsDefault = ledConfig == ledConfigDefault;
+        generateLedConfig(&ledConfigDefault, ledConfigDefaultBuffer, sizeof(ledConfigDefaultBuffer));
+        cliDefaultPrintLinef(dumpMask, equalsDefault, format, i, ledConfigDefaultBuffer);
+    }
+    cliDumpPrintLinef(dumpMask, equalsDefault, format, i, ledConfigBuffer);
+}
+
+static void printLed(uint8_t dumpMask, const ledConfig_t *ledConfigs, const ledConfig_t *defaultLedConfigs)
+{
     for (uint32_t i = 0; i < LED_MAX_STRIP_LENGTH; i++) {
-        ledConfig_t ledConfig = ledConfigs[i];
-        generateLedConfig(&ledConfig, ledConfigBuffer, sizeof(ledConfigBuffer));
-        bool equalsDefault = false;
-        if (defaultLedConfigs) {
-            ledConfig_t ledConfigDefault = defaultLedConfigs[i];
-            equalsDefault = ledConfig == ledConfigDefault;
-            generateLedConfig(&ledConfigDefault, ledConfigDefaultBuffer, sizeof(ledConfigDefaultBuffer));
-            cliDefaultPrintLinef(dumpMask, equalsDefault, format, i, ledConfigDefaultBuffer);
-        }
-        cliDumpPrintLinef(dumpMask, equalsDefault, format, i, ledConfigBuffer);
+        printLedEntry(dumpMask, i, ledConfigs, defaultLedConfigs);
     }
 }
 
@@ -1613,18 +1607,23 @@ static void cliLed(char *cmdline)
     }
 }
 
-static void printColor(uint8_t dumpMask, const hsvColor_t *colors, const hsvColor_t *defaultColors)
+static void printColorEntry(uint8_t dumpMask, uint32_t i, const hsvColor_t *colors, const hsvColor_t *defaultColors)
 {
     const char *format = "color %u %d,%u,%u";
+    const hsvColor_t *color = &colors[i];
+    bool equalsDefault = false;
+    if (defaultColors) {
+        const hsvColor_t *colorDefault = &defaultColors[i];
+        equalsDefault = !memcmp(color, colorDefault, sizeof(*color));
+        cliDefaultPrintLinef(dumpMask, equalsDefault, format, i,colorDefault->h, colorDefault->s, colorDefault->v);
+    }
+    cliDumpPrintLinef(dumpMask, equalsDefault, format, i, color->h, color->s, color->v);
+}
+
+static void printColor(uint8_t dumpMask, const hsvColor_t *colors, const hsvColor_t *defaultColors)
+{
     for (uint32_t i = 0; i < LED_CONFIGURABLE_COLOR_COUNT; i++) {
-        const hsvColor_t *color = &colors[i];
-        bool equalsDefault = false;
-        if (defaultColors) {
-            const hsvColor_t *colorDefault = &defaultColors[i];
-            equalsDefault = !memcmp(color, colorDefault, sizeof(*color));
-            cliDefaultPrintLinef(dumpMask, equalsDefault, format, i,colorDefault->h, colorDefault->s, colorDefault->v);
-        }
-        cliDumpPrintLinef(dumpMask, equalsDefault, format, i, color->h, color->s, color->v);
+        printColorEntry(dumpMask, i, colors, defaultColors);
     }
 }
 
@@ -2082,6 +2081,18 @@ static void cliSdInfo(char *cmdline)
         break;
     }
     cliPrintLinefeed();
+
+    const afatfsCacheStats_t *cacheStats = afatfs_getCacheStats();
+    // Write amplification is the bytes sent to the card per byte written to files, in percent
+    const uint32_t writeAmplification = cacheStats->bytesWritten ? (uint32_t)((uint64_t)cacheStats->sectorsWritten * 512 * 100 / cacheStats->bytesWritten) : 0;
+
+    cliPrintLinef("Cache: hits=%u, misses=%u, sectorsWritten=%u, combinedWrites=%u, writeAmplification=%u%%",
+        cacheStats->hits,
+        cacheStats->misses,
+        cacheStats->sectorsWritten,
+        cacheStats->combinedWrites,
+        writeAmplification
+    );
 }
 
 #endif
@@ -2096,6 +2107,14 @@ static void cliFlashInfo(char *cmdline)
 
     cliPrintLinef("Flash sectors=%u, sectorSize=%u, pagesPerSector=%u, pageSize=%u, totalSize=%u, usedSize=%u",
             layout->sectors, layout->sectorSize, layout->pagesPerSector, layout->pageSize, layout->totalSize, flashfsGetOffset());
+    if (flashfsLogDirectoryIsValid()) {
+        cliPrintLinef("Volume size=%u, logs=%d", flashfsGetSize(), flashfsGetLogCount());
+    } else {
+        cliPrintLinef("Volume size=%u, logs=unknown", flashfsGetSize());
+    }
+    if (flashfsIsErasing()) {
+        cliPrintLinef("Erasing, %d%% done", flashfsGetEraseProgress());
+    }
 }
 
 
@@ -2107,31 +2126,14 @@ static void cliFlashErase(char *cmdline)
         return;
     }
 
-#ifndef MINIMAL_CLI
-    uint32_t i = 0;
-    cliPrintLine("Erasing, please wait ... ");
-#else
-    cliPrintLine("Erasing,");
-#endif
-
-    bufWriterFlush(cliWriter);
+    // The sectors are erased by a background task, which beeps when it is done
     flashfsEraseCompletely();
 
-    while (!flashfsIsReady()) {
 #ifndef MINIMAL_CLI
-        cliPrintf(".");
-        if (i++ > 120) {
-            i=0;
-            cliPrintLinefeed();
-        }
-
-        bufWriterFlush(cliWriter);
+    cliPrintLine("Erasing in the background, flash_info shows the progress");
+#else
+    cliPrintLine("Erasing");
 #endif
-        delay(100);
-    }
-    beeper(BEEPER_BLACKBOX_ERASE);
-    cliPrintLinefeed();
-    cliPrintLine("Done.");
 }
 
 #ifdef USE_FLASH_TOOLS
@@ -3440,40 +3442,6 @@ static void cliRateProfile(char *cmdline)
     }
 }
 
-static void cliDumpPidProfile(uint8_t pidProfileIndex, uint8_t dumpMask)
-{
-    if (pidProfileIndex >= PID_PROFILE_COUNT) {
-        // Faulty values
-        return;
-    }
-
-    pidProfileIndexToUse = pidProfileIndex;
-
-    cliPrintHashLine("profile");
-    cliProfile("");
-    cliPrintLinefeed();
-    dumpAllValues(PROFILE_VALUE, dumpMask);
-
-    pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
-}
-
-static void cliDumpRateProfile(uint8_t rateProfileIndex, uint8_t dumpMask)
-{
-    if (rateProfileIndex >= CONTROL_RATE_PROFILE_COUNT) {
-        // Faulty values
-        return;
-    }
-
-    rateProfileIndexToUse = rateProfileIndex;
-
-    cliPrintHashLine("rateprofile");
-    cliRateProfile("");
-    cliPrintLinefeed();
-    dumpAllValues(PROFILE_RATE_VALUE, dumpMask);
-
-    rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
-}
-
 static void cliSave(char *cmdline)
 {
     UNUSED(cmdline);
@@ -3532,6 +3500,67 @@ void cliPrintVarDefault(const clivalue_t *value)
     }
 }
 
+static bool valueNameIndexBuilt = false;
+
+static void buildValueNameIndex(void)
+{
+    for (uint16_t i = 0; i < valueTableEntryCount; i++) {
+        valueTableNameIndex[i] = i;
+    }
+
+    // shell sort, qsort costs more flash than the whole index
+    for (uint16_t gap = valueTableEntryCount / 2; gap > 0; gap /= 2) {
+        for (uint16_t i = gap; i < valueTableEntryCount; i++) {
+            const uint16_t entry = valueTableNameIndex[i];
+            uint16_t j = i;
+            for (; j >= gap && strcasecmp(valueTable[valueTableNameIndex[j - gap]].name, valueTable[entry].name) > 0; j -= gap) {
+                valueTableNameIndex[j] = valueTableNameIndex[j - gap];
+            }
+            valueTableNameIndex[j] = entry;
+        }
+    }
+
+    valueNameIndexBuilt = true;
+}
+
+// Position in valueTableNameIndex of the first name that doesn't sort before prefix,
+// or with past set of the first name after all those starting with prefix
+static uint16_t valueNameIndexBound(const char *prefix, size_t length, bool past)
+{
+    if (!valueNameIndexBuilt) {
+        buildValueNameIndex();
+    }
+
+    uint16_t low = 0;
+    uint16_t high = valueTableEntryCount;
+    while (low < high) {
+        const uint16_t mid = (low + high) / 2;
+        const int cmp = strncasecmp(valueTable[valueTableNameIndex[mid]].name, prefix, length);
+        if (cmp < 0 || (past && cmp == 0)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+STATIC_UNIT_TESTED const clivalue_t *cliFindValue(const char *name, size_t length)
+{
+    const uint16_t position = valueNameIndexBound(name, length, false);
+
+    if (position < valueTableEntryCount) {
+        // a name sorts before any longer name it is a prefix of
+        const clivalue_t *value = &valueTable[valueTableNameIndex[position]];
+        if (strncasecmp(value->name, name, length) == 0 && value->name[length] == '\0') {
+            return value;
+        }
+    }
+
+    return NULL;
+}
+
 STATIC_UNIT_TESTED void cliGet(char *cmdline)
 {
     const clivalue_t *val;
@@ -3830,127 +3859,123 @@ STATIC_UNIT_TESTED void cliSet(char *cmdline)
         eqptr++;
         eqptr = skipSpace(eqptr);
 
-        for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-            const clivalue_t *val = &valueTable[i];
+        const clivalue_t *val = cliFindValue(cmdline, variableNameLength);
+        if (!val) {
+            cliPrintErrorLinef("Invalid name");
 
-            // ensure exact match when setting to prevent setting variables with shorter names
-            if (strncasecmp(cmdline, val->name, strlen(val->name)) == 0 && variableNameLength == strlen(val->name)) {
+            return;
+        }
 
-                bool valueChanged = false;
-                int16_t value  = 0;
-                switch (val->type & VALUE_MODE_MASK) {
-                case MODE_DIRECT: {
-                        int16_t value = atoi(eqptr);
+        bool valueChanged = false;
+        int16_t value  = 0;
+        switch (val->type & VALUE_MODE_MASK) {
+        case MODE_DIRECT: {
+                int16_t value = atoi(eqptr);
 
-                        if (value >= val->config.minmax.min && value <= val->config.minmax.max) {
-                            cliSetVar(val, value);
-                            valueChanged = true;
-                        }
-                    }
+                if (value >= val->config.minmax.min && value <= val->config.minmax.max) {
+                    cliSetVar(val, value);
+                    valueChanged = true;
+                }
+            }
 
-                    break;
-                case MODE_LOOKUP:
-                case MODE_BITSET: {
-                        int tableIndex;
-                        if ((val->type & VALUE_MODE_MASK) == MODE_BITSET) {
-                            tableIndex = TABLE_OFF_ON;
-                        } else {
-                            tableIndex = val->config.lookup.tableIndex;
-                        }
-                        const lookupTableEntry_t *tableEntry = &lookupTables[tableIndex];
-                        bool matched = false;
-                        for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
-                            matched = tableEntry->values[tableValueIndex] && strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
+            break;
+        case MODE_LOOKUP:
+        case MODE_BITSET: {
+                int tableIndex;
+                if ((val->type & VALUE_MODE_MASK) == MODE_BITSET) {
+                    tableIndex = TABLE_OFF_ON;
+                } else {
+                    tableIndex = val->config.lookup.tableIndex;
+                }
+                const lookupTableEntry_t *tableEntry = &lookupTables[tableIndex];
+                bool matched = false;
+                for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
+                    matched = tableEntry->values[tableValueIndex] && strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
 
-                            if (matched) {
-                                value = tableValueIndex;
+                    if (matched) {
+                        value = tableValueIndex;
 
-                                cliSetVar(val, value);
-                                valueChanged = true;
-                            }
-                        }
+                        cliSetVar(val, value);
+                        valueChanged = true;
                     }
+                }
+            }
 
-                    break;
-
-                case MODE_ARRAY: {
-                        const uint8_t arrayLength = val->config.array.length;
-                        char *valPtr = eqptr;
-
-                        int i = 0;
-                        while (i < arrayLength && valPtr != NULL) {
-                            // skip spaces
-                            valPtr = skipSpace(valPtr);
-
-                            // process substring starting at valPtr
-                            // note: no need to copy substrings for atoi()
-                            //       it stops at the first character that cannot be converted...
-                            switch (val->type & VALUE_TYPE_MASK) {
-                            default:
-                            case VAR_UINT8:
-                                {
-                                    // fetch data pointer
-                                    uint8_t *data = (uint8_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (uint8_t)atoi((const char*) valPtr);
-                                }
+            break;
 
-                                break;
-                            case VAR_INT8:
-                                {
-                                    // fetch data pointer
-                                    int8_t *data = (int8_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (int8_t)atoi((const char*) valPtr);
-                                }
+        case MODE_ARRAY: {
+                const uint8_t arrayLength = val->config.array.length;
+                char *valPtr = eqptr;
 
-                                break;
-                            case VAR_UINT16:
-                                {
-                                    // fetch data pointer
-                                    uint16_t *data = (uint16_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (uint16_t)atoi((const char*) valPtr);
-                                }
+                int i = 0;
+                while (i < arrayLength && valPtr != NULL) {
+                    // skip spaces
+                    valPtr = skipSpace(valPtr);
 
-                                break;
-                            case VAR_INT16:
-                                {
-                                    // fetch data pointer
-                                    int16_t *data = (int16_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (int16_t)atoi((const char*) valPtr);
-                                }
+                    // process substring starting at valPtr
+                    // note: no need to copy substrings for atoi()
+                    //       it stops at the first character that cannot be converted...
+                    switch (val->type & VALUE_TYPE_MASK) {
+                    default:
+                    case VAR_UINT8:
+                        {
+                            // fetch data pointer
+                            uint8_t *data = (uint8_t *)cliGetValuePointer(val) + i;
+                            // store value
+                            *data = (uint8_t)atoi((const char*) valPtr);
+                        }
 
-                                break;
-                            }
+                        break;
+                    case VAR_INT8:
+                        {
+                            // fetch data pointer
+                            int8_t *data = (int8_t *)cliGetValuePointer(val) + i;
+                            // store value
+                            *data = (int8_t)atoi((const char*) valPtr);
+                        }
 
-                            // find next comma (or end of string)
-                            valPtr = strchr(valPtr, ',') + 1;
+                        break;
+                    case VAR_UINT16:
+                        {
+                            // fetch data pointer
+                            uint16_t *data = (uint16_t *)cliGetValuePointer(val) + i;
+                            // store value
+                            *data = (uint16_t)atoi((const char*) valPtr);
+                        }
 
-                            i++;
+                        break;
+                    case VAR_INT16:
+                        {
+                            // fetch data pointer
+                            int16_t *data = (int16_t *)cliGetValuePointer(val) + i;
+                            // store value
+                            *data = (int16_t)atoi((const char*) valPtr);
                         }
-                    }
 
-                    // mark as changed
-                    valueChanged = true;
+                        break;
+                    }
 
-                    break;
+                    // find next comma (or end of string)
+                    valPtr = strchr(valPtr, ',') + 1;
 
+                    i++;
                 }
+            }
 
-                if (valueChanged) {
-                    cliPrintf("%s set to ", val->name);
-                    cliPrintVar(val, 0);
-                } else {
-                    cliPrintErrorLinef("Invalid value");
-                    cliPrintVarRange(val);
-                }
+            // mark as changed
+            valueChanged = true;
+
+            break;
 
-                return;
-            }
         }
-        cliPrintErrorLinef("Invalid name");
+
+        if (valueChanged) {
+            cliPrintf("%s set to ", val->name);
+            cliPrintVar(val, 0);
+        } else {
+            cliPrintErrorLinef("Invalid value");
+            cliPrintVarRange(val);
+        }
     } else {
         // no equals, check for matching variables.
         cliGet(cmdline);
@@ -4044,15 +4069,48 @@ static void cliStatus(char *cmdline)
 }
 
 #ifndef SKIP_TASK_STATISTICS
+static void cliTasksPrintHistogram(const char *name, const uint16_t *histogram)
+{
+    cliPrintf("     %-8s", name);
+    for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKET_COUNT; bucket++) {
+        cliPrintf("%6d", histogram[bucket]);
+    }
+    cliPrintLinefeed();
+}
+
+static void cliTasksHistogram(void)
+{
+    cliPrint("Task histogram   >=us");
+    for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKET_COUNT; bucket++) {
+        cliPrintf("%6d", bucket == 0 ? 0 : 1 << (bucket - 1));
+    }
+    cliPrintLinefeed();
+    for (cfTaskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+        cfTaskInfo_t taskInfo;
+        getTaskInfo(taskId, &taskInfo);
+        if (taskInfo.isEnabled) {
+            cfTaskHistogram_t histogram;
+            getTaskHistogram(taskId, &histogram);
+            cliPrintLinef("%02d - (%15s)", taskId, taskInfo.taskName);
+            cliTasksPrintHistogram("exec", histogram.executionTime);
+            cliTasksPrintHistogram("late", histogram.lateness);
+        }
+    }
+}
+
 static void cliTasks(char *cmdline)
 {
-    UNUSED(cmdline);
     int maxLoadSum = 0;
     int averageLoadSum = 0;
 
+    if (strncasecmp(cmdline, "histogram", 9) == 0) {
+        cliTasksHistogram();
+        return;
+    }
+
 #ifndef MINIMAL_CLI
     if (systemConfig()->task_statistics) {
-        cliPrintLine("Task list             rate/hz  max/us  avg/us maxload avgload     total/ms");
+        cliPrintLine("Task list             rate/hz  max/us  avg/us maxload avgload     total/ms  late");
     } else {
         cliPrintLine("Task list");
     }
@@ -4083,9 +4141,9 @@ static void cliTasks(char *cmdline)
                 averageLoadSum += averageLoad;
             }
             if (systemConfig()->task_statistics) {
-                cliPrintLinef("%6d %7d %7d %4d.%1d%% %4d.%1d%% %9d",
+                cliPrintLinef("%6d %7d %7d %4d.%1d%% %4d.%1d%% %9d %5d",
                         taskFrequency, taskInfo.maxExecutionTime, taskInfo.averageExecutionTime,
-                        maxLoad/10, maxLoad%10, averageLoad/10, averageLoad%10, taskInfo.totalExecutionTime / 1000);
+                        maxLoad/10, maxLoad%10, averageLoad/10, averageLoad%10, taskInfo.totalExecutionTime / 1000, taskInfo.deadlineMisses);
             } else {
                 cliPrintLinef("%6d", taskFrequency);
             }
@@ -4100,6 +4158,10 @@ static void cliTasks(char *cmdline)
         cfCheckFuncInfo_t checkFuncInfo;
         getCheckFuncInfo(&checkFuncInfo);
         cliPrintLinef("RX Check Function %19d %7d %25d", checkFuncInfo.maxExecutionTime, checkFuncInfo.averageExecutionTime, checkFuncInfo.totalExecutionTime / 1000);
+        cfSchedulerInfo_t schedulerInfo;
+        getSchedulerInfo(&schedulerInfo);
+        cliPrintLinef("Scheduler (%8s) %17d %7d", schedulerInfo.mode == SCHEDULER_MODE_EDF ? "EDF" : "PRIORITY", schedulerInfo.maxOverheadTime, schedulerInfo.averageOverheadTime);
+        schedulerResetMaxOverheadTime();
         cliPrintLinef("Total (excluding SERIAL) %25d.%1d%% %4d.%1d%%", maxLoadSum/10, maxLoadSum%10, averageLoadSum/10, averageLoadSum%10);
     }
 }
@@ -4291,45 +4353,51 @@ static ioTag_t *getIoTag(const cliResourceValue_t value, uint8_t index)
     return CONST_CAST(ioTag_t *, rec->address + value.stride * index + value.offset);
 }
 
-static void printResource(uint8_t dumpMask)
+// Prints the pins of one resourceTable entry, a line per index
+static void printResourceEntry(uint8_t dumpMask, unsigned int i)
 {
-    for (unsigned int i = 0; i < ARRAYLEN(resourceTable); i++) {
-        const char* owner = ownerNames[resourceTable[i].owner];
-        const pgRegistry_t* pg = pgFind(resourceTable[i].pgn);
-        const void *currentConfig;
-        const void *defaultConfig;
-        if (configIsInCopy) {
-            currentConfig = pg->copy;
-            defaultConfig = pg->address;
-        } else {
-            currentConfig = pg->address;
-            defaultConfig = NULL;
-        }
+    const char* owner = ownerNames[resourceTable[i].owner];
+    const pgRegistry_t* pg = pgFind(resourceTable[i].pgn);
+    const void *currentConfig;
+    const void *defaultConfig;
+    if (configIsInCopy) {
+        currentConfig = pg->copy;
+        defaultConfig = pg->address;
+    } else {
+        currentConfig = pg->address;
+        defaultConfig = NULL;
+    }
 
-        for (int index = 0; index < MAX_RESOURCE_INDEX(resourceTable[i].maxIndex); index++) {
-            const ioTag_t ioTag = *(ioTag_t *)((const uint8_t *)currentConfig + resourceTable[i].stride * index + resourceTable[i].offset);
-            ioTag_t ioTagDefault = NULL;
-            if (defaultConfig) {
-                ioTagDefault = *(ioTag_t *)((const uint8_t *)defaultConfig + resourceTable[i].stride * index + resourceTable[i].offset);
-            }
+    for (int index = 0; index < MAX_RESOURCE_INDEX(resourceTable[i].maxIndex); index++) {
+        const ioTag_t ioTag = *(ioTag_t *)((const uint8_t *)currentConfig + resourceTable[i].stride * index + resourceTable[i].offset);
+        ioTag_t ioTagDefault = NULL;
+        if (defaultConfig) {
+            ioTagDefault = *(ioTag_t *)((const uint8_t *)defaultConfig + resourceTable[i].stride * index + resourceTable[i].offset);
+        }
 
-            const bool equalsDefault = ioTag == ioTagDefault;
-            const char *format = "resource %s %d %c%02d";
-            const char *formatUnassigned = "resource %s %d NONE";
-            if (ioTagDefault) {
-                cliDefaultPrintLinef(dumpMask, equalsDefault, format, owner, RESOURCE_INDEX(index), IO_GPIOPortIdxByTag(ioTagDefault) + 'A', IO_GPIOPinIdxByTag(ioTagDefault));
-            } else if (defaultConfig) {
-                cliDefaultPrintLinef(dumpMask, equalsDefault, formatUnassigned, owner, RESOURCE_INDEX(index));
-            }
-            if (ioTag) {
-                cliDumpPrintLinef(dumpMask, equalsDefault, format, owner, RESOURCE_INDEX(index), IO_GPIOPortIdxByTag(ioTag) + 'A', IO_GPIOPinIdxByTag(ioTag));
-            } else if (!(dumpMask & HIDE_UNUSED)) {
-                cliDumpPrintLinef(dumpMask, equalsDefault, formatUnassigned, owner, RESOURCE_INDEX(index));
-            }
+        const bool equalsDefault = ioTag == ioTagDefault;
+        const char *format = "resource %s %d %c%02d";
+        const char *formatUnassigned = "resource %s %d NONE";
+        if (ioTagDefault) {
+            cliDefaultPrintLinef(dumpMask, equalsDefault, format, owner, RESOURCE_INDEX(index), IO_GPIOPortIdxByTag(ioTagDefault) + 'A', IO_GPIOPinIdxByTag(ioTagDefault));
+        } else if (defaultConfig) {
+            cliDefaultPrintLinef(dumpMask, equalsDefault, formatUnassigned, owner, RESOURCE_INDEX(index));
+        }
+        if (ioTag) {
+            cliDumpPrintLinef(dumpMask, equalsDefault, format, owner, RESOURCE_INDEX(index), IO_GPIOPortIdxByTag(ioTag) + 'A', IO_GPIOPinIdxByTag(ioTag));
+        } else if (!(dumpMask & HIDE_UNUSED)) {
+            cliDumpPrintLinef(dumpMask, equalsDefault, formatUnassigned, owner, RESOURCE_INDEX(index));
         }
     }
 }
 
+static void printResource(uint8_t dumpMask)
+{
+    for (unsigned int i = 0; i < ARRAYLEN(resourceTable); i++) {
+        printResourceEntry(dumpMask, i);
+    }
+}
+
 static void printResourceOwner(uint8_t owner, uint8_t index)
 {
     cliPrintf("%s", ownerNames[resourceTable[owner].owner]);
@@ -4630,175 +4698,473 @@ error:
 }
 #endif
 
-static void printConfig(char *cmdline, bool doDiff)
+static void dumpVersion(uint8_t dumpMask)
 {
-    uint8_t dumpMask = DUMP_MASTER;
-    char *options;
-    if ((options = checkCommand(cmdline, "master"))) {
-        dumpMask = DUMP_MASTER; // only
-    } else if ((options = checkCommand(cmdline, "profile"))) {
-        dumpMask = DUMP_PROFILE; // only
-    } else if ((options = checkCommand(cmdline, "rates"))) {
-        dumpMask = DUMP_RATES; // only
-    } else if ((options = checkCommand(cmdline, "all"))) {
-        dumpMask = DUMP_ALL;   // all profiles and rates
-    } else {
-        options = cmdline;
-    }
-
-    if (doDiff) {
-        dumpMask = dumpMask | DO_DIFF;
-    }
-
-    backupAndResetConfigs();
-    if (checkCommand(options, "defaults")) {
-        dumpMask = dumpMask | SHOW_DEFAULTS;   // add default values as comments for changed values
-    }
-
-    if ((dumpMask & DUMP_MASTER) || (dumpMask & DUMP_ALL)) {
-        cliPrintHashLine("version");
-        cliVersion(NULL);
-        cliPrintLinefeed();
+    cliPrintHashLine("version");
+    cliVersion(NULL);
+    cliPrintLinefeed();
 
 #if defined(USE_BOARD_INFO)
-        cliBoardName("");
-        cliManufacturerId("");
+    cliBoardName("");
+    cliManufacturerId("");
 #endif
 
-        if (dumpMask & DUMP_ALL) {
-            cliMcuId(NULL);
+    if (dumpMask & DUMP_ALL) {
+        cliMcuId(NULL);
 #if defined(USE_BOARD_INFO) && defined(USE_SIGNATURE)
         cliSignature("");
 #endif
-        }
+    }
 
-        if ((dumpMask & (DUMP_ALL | DO_DIFF)) == (DUMP_ALL | DO_DIFF)) {
-            cliPrintHashLine("reset configuration to default settings");
-            cliPrint("defaults nosave");
-            cliPrintLinefeed();
-        }
+    if ((dumpMask & (DUMP_ALL | DO_DIFF)) == (DUMP_ALL | DO_DIFF)) {
+        cliPrintHashLine("reset configuration to default settings");
+        cliPrint("defaults nosave");
+        cliPrintLinefeed();
+    }
+}
 
-        cliPrintHashLine("name");
-        printName(dumpMask, &pilotConfig_Copy);
+static void dumpName(uint8_t dumpMask)
+{
+    cliPrintHashLine("name");
+    printName(dumpMask, &pilotConfig_Copy);
+}
 
 #ifdef USE_RESOURCE_MGMT
+static void dumpResourcesEntry(uint8_t dumpMask, uint8_t entry)
+{
+    if (entry == 0) {
         cliPrintHashLine("resources");
-        printResource(dumpMask);
+    }
+    printResourceEntry(dumpMask, entry);
+}
 #endif
 
 #ifndef USE_QUAD_MIXER_ONLY
-        cliPrintHashLine("mixer");
-        const bool equalsDefault = mixerConfig_Copy.mixerMode == mixerConfig()->mixerMode;
-        const char *formatMixer = "mixer %s";
-        cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
-        cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
+static void dumpMixer(uint8_t dumpMask)
+{
+    cliPrintHashLine("mixer");
+    const bool equalsDefault = mixerConfig_Copy.mixerMode == mixerConfig()->mixerMode;
+    const char *formatMixer = "mixer %s";
+    cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
+    cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
 
-        cliDumpPrintLinef(dumpMask, customMotorMixer(0)->throttle == 0.0f, "\r\nmmix reset\r\n");
+    cliDumpPrintLinef(dumpMask, customMotorMixer(0)->throttle == 0.0f, "\r\nmmix reset\r\n");
 
-        printMotorMix(dumpMask, customMotorMixer_CopyArray, customMotorMixer(0));
+    printMotorMix(dumpMask, customMotorMixer_CopyArray, customMotorMixer(0));
+}
 
 #ifdef USE_SERVOS
-        cliPrintHashLine("servo");
-        printServo(dumpMask, servoParams_CopyArray, servoParams(0));
+static void dumpServo(uint8_t dumpMask)
+{
+    cliPrintHashLine("servo");
+    printServo(dumpMask, servoParams_CopyArray, servoParams(0));
+}
 
-        cliPrintHashLine("servo mix");
-        // print custom servo mixer if exists
-        cliDumpPrintLinef(dumpMask, customServoMixers(0)->rate == 0, "smix reset\r\n");
-        printServoMix(dumpMask, customServoMixers_CopyArray, customServoMixers(0));
+static void dumpServoMix(uint8_t dumpMask)
+{
+    cliPrintHashLine("servo mix");
+    // print custom servo mixer if exists
+    cliDumpPrintLinef(dumpMask, customServoMixers(0)->rate == 0, "smix reset\r\n");
+    printServoMix(dumpMask, customServoMixers_CopyArray, customServoMixers(0));
+}
 #endif
 #endif
 
-        cliPrintHashLine("feature");
-        printFeature(dumpMask, &featureConfig_Copy, featureConfig());
+static void dumpFeature(uint8_t dumpMask)
+{
+    cliPrintHashLine("feature");
+    printFeature(dumpMask, &featureConfig_Copy, featureConfig());
+}
 
 #if defined(USE_BEEPER)
-        cliPrintHashLine("beeper");
-        printBeeper(dumpMask, beeperConfig_Copy.beeper_off_flags, beeperConfig()->beeper_off_flags, "beeper", BEEPER_ALLOWED_MODES);
+static void dumpBeeper(uint8_t dumpMask)
+{
+    cliPrintHashLine("beeper");
+    printBeeper(dumpMask, beeperConfig_Copy.beeper_off_flags, beeperConfig()->beeper_off_flags, "beeper", BEEPER_ALLOWED_MODES);
+}
 
 #if defined(USE_DSHOT)
-        cliPrintHashLine("beacon");
-        printBeeper(dumpMask, beeperConfig_Copy.dshotBeaconOffFlags, beeperConfig()->dshotBeaconOffFlags, "beacon", DSHOT_BEACON_ALLOWED_MODES);
+static void dumpBeacon(uint8_t dumpMask)
+{
+    cliPrintHashLine("beacon");
+    printBeeper(dumpMask, beeperConfig_Copy.dshotBeaconOffFlags, beeperConfig()->dshotBeaconOffFlags, "beacon", DSHOT_BEACON_ALLOWED_MODES);
+}
 #endif
 #endif // USE_BEEPER
 
-        cliPrintHashLine("map");
-        printMap(dumpMask, &rxConfig_Copy, rxConfig());
+static void dumpMap(uint8_t dumpMask)
+{
+    cliPrintHashLine("map");
+    printMap(dumpMask, &rxConfig_Copy, rxConfig());
+}
 
-        cliPrintHashLine("serial");
-        printSerial(dumpMask, &serialConfig_Copy, serialConfig());
+static void dumpSerial(uint8_t dumpMask)
+{
+    cliPrintHashLine("serial");
+    printSerial(dumpMask, &serialConfig_Copy, serialConfig());
+}
 
 #ifdef USE_LED_STRIP
+static void dumpLedEntry(uint8_t dumpMask, uint8_t entry)
+{
+    if (entry == 0) {
         cliPrintHashLine("led");
-        printLed(dumpMask, ledStripConfig_Copy.ledConfigs, ledStripConfig()->ledConfigs);
+    }
+    printLedEntry(dumpMask, entry, ledStripConfig_Copy.ledConfigs, ledStripConfig()->ledConfigs);
+}
 
+static void dumpColorEntry(uint8_t dumpMask, uint8_t entry)
+{
+    if (entry == 0) {
         cliPrintHashLine("color");
-        printColor(dumpMask, ledStripConfig_Copy.colors, ledStripConfig()->colors);
+    }
+    printColorEntry(dumpMask, entry, ledStripConfig_Copy.colors, ledStripConfig()->colors);
+}
 
-        cliPrintHashLine("mode_color");
-        printModeColor(dumpMask, &ledStripConfig_Copy, ledStripConfig());
+static void dumpModeColor(uint8_t dumpMask)
+{
+    cliPrintHashLine("mode_color");
+    printModeColor(dumpMask, &ledStripConfig_Copy, ledStripConfig());
+}
 #endif
 
+static void dumpAuxEntry(uint8_t dumpMask, uint8_t entry)
+{
+    if (entry == 0) {
         cliPrintHashLine("aux");
-        printAux(dumpMask, modeActivationConditions_CopyArray, modeActivationConditions(0));
+    }
+    printAuxEntry(dumpMask, entry, modeActivationConditions_CopyArray, modeActivationConditions(0));
+}
 
+static void dumpAdjustmentRangeEntry(uint8_t dumpMask, uint8_t entry)
+{
+    if (entry == 0) {
         cliPrintHashLine("adjrange");
-        printAdjustmentRange(dumpMask, adjustmentRanges_CopyArray, adjustmentRanges(0));
+    }
+    printAdjustmentRangeEntry(dumpMask, entry, adjustmentRanges_CopyArray, adjustmentRanges(0));
+}
 
-        cliPrintHashLine("rxrange");
-        printRxRange(dumpMask, rxChannelRangeConfigs_CopyArray, rxChannelRangeConfigs(0));
+static void dumpRxRange(uint8_t dumpMask)
+{
+    cliPrintHashLine("rxrange");
+    printRxRange(dumpMask, rxChannelRangeConfigs_CopyArray, rxChannelRangeConfigs(0));
+}
 
 #ifdef USE_VTX_CONTROL
-        cliPrintHashLine("vtx");
-        printVtx(dumpMask, &vtxConfig_Copy, vtxConfig());
+static void dumpVtx(uint8_t dumpMask)
+{
+    cliPrintHashLine("vtx");
+    printVtx(dumpMask, &vtxConfig_Copy, vtxConfig());
+}
 #endif
 
+static void dumpRxFailsafeEntry(uint8_t dumpMask, uint8_t entry)
+{
+    if (entry == 0) {
         cliPrintHashLine("rxfail");
-        printRxFailsafe(dumpMask, rxFailsafeChannelConfigs_CopyArray, rxFailsafeChannelConfigs(0));
+    }
+    printRxFailsafeEntry(dumpMask, entry, rxFailsafeChannelConfigs_CopyArray, rxFailsafeChannelConfigs(0));
+}
 
-        cliPrintHashLine("master");
-        dumpAllValues(MASTER_VALUE, dumpMask);
+typedef void dumpSectionFn(uint8_t dumpMask);
+typedef void dumpEntryFn(uint8_t dumpMask, uint8_t entry);
 
-        if (dumpMask & DUMP_ALL) {
-            for (uint32_t pidProfileIndex = 0; pidProfileIndex < PID_PROFILE_COUNT; pidProfileIndex++) {
-                cliDumpPidProfile(pidProfileIndex, dumpMask);
-            }
-            cliPrintHashLine("restore original profile selection");
+// A section is either written in a single step, or an entry per step with the first one writing its heading
+typedef struct dumpSection_s {
+    dumpSectionFn *dump;
+    dumpEntryFn *dumpEntry;
+    uint8_t entryCount;
+} dumpSection_t;
+
+// Sections of a master dump, in output order. The long tables are written an entry per
+// step so a single step never fills more than a few lines of the output buffer.
+static const dumpSection_t dumpMasterSections[] = {
+    { .dump = dumpVersion },
+    { .dump = dumpName },
+#ifdef USE_RESOURCE_MGMT
+    { .dumpEntry = dumpResourcesEntry, .entryCount = ARRAYLEN(resourceTable) },
+#endif
+#ifndef USE_QUAD_MIXER_ONLY
+    { .dump = dumpMixer },
+#ifdef USE_SERVOS
+    { .dump = dumpServo },
+    { .dump = dumpServoMix },
+#endif
+#endif
+    { .dump = dumpFeature },
+#if defined(USE_BEEPER)
+    { .dump = dumpBeeper },
+#if defined(USE_DSHOT)
+    { .dump = dumpBeacon },
+#endif
+#endif
+    { .dump = dumpMap },
+    { .dump = dumpSerial },
+#ifdef USE_LED_STRIP
+    { .dumpEntry = dumpLedEntry, .entryCount = LED_MAX_STRIP_LENGTH },
+    { .dumpEntry = dumpColorEntry, .entryCount = LED_CONFIGURABLE_COLOR_COUNT },
+    { .dump = dumpModeColor },
+#endif
+    { .dumpEntry = dumpAuxEntry, .entryCount = MAX_MODE_ACTIVATION_CONDITION_COUNT },
+    { .dumpEntry = dumpAdjustmentRangeEntry, .entryCount = MAX_ADJUSTMENT_RANGE_COUNT },
+    { .dump = dumpRxRange },
+#ifdef USE_VTX_CONTROL
+    { .dump = dumpVtx },
+#endif
+    { .dumpEntry = dumpRxFailsafeEntry, .entryCount = MAX_SUPPORTED_RC_CHANNEL_COUNT },
+};
+
+// A dump is only continued while the CLI port can take a whole output buffer without waiting
+#define CLI_DUMP_TX_ROOM CLI_OUT_BUFFER_SIZE
+// Longest a dump may run within one pass of the CLI task
+#define CLI_DUMP_SLICE_US 200
+
+typedef enum {
+    DUMP_PHASE_IDLE = 0,
+    DUMP_PHASE_MASTER_SECTIONS,
+    DUMP_PHASE_MASTER_VALUES,
+    DUMP_PHASE_PID_PROFILE,
+    DUMP_PHASE_PID_PROFILE_RESTORE,
+    DUMP_PHASE_RATE_PROFILE,
+    DUMP_PHASE_RATE_PROFILE_RESTORE,
+} dumpPhase_e;
+
+// Position of a dump or diff that is written out over several passes of the CLI task
+typedef struct cliDumpState_s {
+    dumpPhase_e phase;
+    uint8_t dumpMask;
+    uint8_t section;        // next entry of dumpMasterSections
+    uint8_t sectionEntry;   // next entry of a section written an entry per step
+    uint8_t profileIndex;   // profile dumped by the profile phases
+    int16_t valueIndex;     // next valueTable entry, -1 when the phase header is due
+} cliDumpState_t;
+
+static cliDumpState_t cliDumpState;
+
+static bool cliDumpInProgress(void)
+{
+    return cliDumpState.phase != DUMP_PHASE_IDLE;
+}
+
+static void cliDumpStartPhase(dumpPhase_e phase, uint8_t profileIndex)
+{
+    cliDumpState.phase = phase;
+    cliDumpState.profileIndex = profileIndex;
+    cliDumpState.valueIndex = -1;
+}
+
+// Dumps the next value of the section, returns false once all its values are written
+static bool cliDumpNextValue(uint16_t valueSection)
+{
+    while (cliDumpState.valueIndex < valueTableEntryCount) {
+        const clivalue_t *value = &valueTable[cliDumpState.valueIndex++];
+        if ((value->type & VALUE_SECTION_MASK) == valueSection) {
+            dumpPgValue(value, cliDumpState.dumpMask);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void cliDumpPidProfileStep(void)
+{
+    const uint8_t dumpMask = cliDumpState.dumpMask;
 
-            pidProfileIndexToUse = systemConfig_Copy.pidProfileIndex;
+    if (cliDumpState.profileIndex < PID_PROFILE_COUNT) {
+        pidProfileIndexToUse = cliDumpState.profileIndex;
 
+        if (cliDumpState.valueIndex < 0) {
+            cliPrintHashLine("profile");
             cliProfile("");
+            cliPrintLinefeed();
+            cliDumpState.valueIndex = 0;
+        }
+        const bool valuesPending = cliDumpNextValue(PROFILE_VALUE);
 
-            pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
+        pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
 
-            for (uint32_t rateIndex = 0; rateIndex < CONTROL_RATE_PROFILE_COUNT; rateIndex++) {
-                cliDumpRateProfile(rateIndex, dumpMask);
-            }
-            cliPrintHashLine("restore original rateprofile selection");
+        if (valuesPending) {
+            return;
+        }
+    }
 
-            rateProfileIndexToUse = systemConfig_Copy.activeRateProfile;
+    if (dumpMask & DUMP_ALL) {
+        if (cliDumpState.profileIndex + 1 < PID_PROFILE_COUNT) {
+            cliDumpStartPhase(DUMP_PHASE_PID_PROFILE, cliDumpState.profileIndex + 1);
+        } else {
+            cliDumpStartPhase(DUMP_PHASE_PID_PROFILE_RESTORE, 0);
+        }
+    } else if (dumpMask & DUMP_MASTER) {
+        cliDumpStartPhase(DUMP_PHASE_RATE_PROFILE, systemConfig_Copy.activeRateProfile);
+    } else {
+        cliDumpStartPhase(DUMP_PHASE_IDLE, 0);
+    }
+}
 
+static void cliDumpRateProfileStep(void)
+{
+    const uint8_t dumpMask = cliDumpState.dumpMask;
+
+    if (cliDumpState.profileIndex < CONTROL_RATE_PROFILE_COUNT) {
+        rateProfileIndexToUse = cliDumpState.profileIndex;
+
+        if (cliDumpState.valueIndex < 0) {
+            cliPrintHashLine("rateprofile");
             cliRateProfile("");
+            cliPrintLinefeed();
+            cliDumpState.valueIndex = 0;
+        }
+        const bool valuesPending = cliDumpNextValue(PROFILE_RATE_VALUE);
+
+        rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
 
-            rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
+        if (valuesPending) {
+            return;
+        }
+    }
 
-            cliPrintHashLine("save configuration");
-            cliPrint("save");
+    if (dumpMask & DUMP_ALL) {
+        if (cliDumpState.profileIndex + 1 < CONTROL_RATE_PROFILE_COUNT) {
+            cliDumpStartPhase(DUMP_PHASE_RATE_PROFILE, cliDumpState.profileIndex + 1);
         } else {
-            cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+            cliDumpStartPhase(DUMP_PHASE_RATE_PROFILE_RESTORE, 0);
+        }
+    } else {
+        cliDumpStartPhase(DUMP_PHASE_IDLE, 0);
+    }
+}
 
-            cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+// Writes the next piece of the dump, at most one section, one section entry or one value
+static void cliDumpStep(void)
+{
+    switch (cliDumpState.phase) {
+    case DUMP_PHASE_MASTER_SECTIONS: {
+        const dumpSection_t *section = &dumpMasterSections[cliDumpState.section];
+        if (section->dumpEntry) {
+            section->dumpEntry(cliDumpState.dumpMask, cliDumpState.sectionEntry++);
+            if (cliDumpState.sectionEntry < section->entryCount) {
+                break;
+            }
+        } else {
+            section->dump(cliDumpState.dumpMask);
+        }
+        cliDumpState.sectionEntry = 0;
+        if (++cliDumpState.section >= ARRAYLEN(dumpMasterSections)) {
+            cliDumpStartPhase(DUMP_PHASE_MASTER_VALUES, 0);
+        }
+        break;
+    }
+    case DUMP_PHASE_MASTER_VALUES:
+        if (cliDumpState.valueIndex < 0) {
+            cliPrintHashLine("master");
+            cliDumpState.valueIndex = 0;
         }
+        if (!cliDumpNextValue(MASTER_VALUE)) {
+            cliDumpStartPhase(DUMP_PHASE_PID_PROFILE, (cliDumpState.dumpMask & DUMP_ALL) ? 0 : systemConfig_Copy.pidProfileIndex);
+        }
+        break;
+    case DUMP_PHASE_PID_PROFILE:
+        cliDumpPidProfileStep();
+        break;
+    case DUMP_PHASE_PID_PROFILE_RESTORE:
+        cliPrintHashLine("restore original profile selection");
+
+        pidProfileIndexToUse = systemConfig_Copy.pidProfileIndex;
+
+        cliProfile("");
+
+        pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
+
+        cliDumpStartPhase(DUMP_PHASE_RATE_PROFILE, 0);
+        break;
+    case DUMP_PHASE_RATE_PROFILE:
+        cliDumpRateProfileStep();
+        break;
+    case DUMP_PHASE_RATE_PROFILE_RESTORE:
+        cliPrintHashLine("restore original rateprofile selection");
+
+        rateProfileIndexToUse = systemConfig_Copy.activeRateProfile;
+
+        cliRateProfile("");
+
+        rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
+
+        cliPrintHashLine("save configuration");
+        cliPrint("save");
+
+        cliDumpStartPhase(DUMP_PHASE_IDLE, 0);
+        break;
+    default:
+        cliDumpStartPhase(DUMP_PHASE_IDLE, 0);
+        break;
     }
+}
 
-    if (dumpMask & DUMP_PROFILE) {
-        cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+// Continues a dump for as long as the port has room and the slice allows, then hands
+// back to the scheduler. The configuration is swapped for its defaults only while
+// steps run, so the rest of the firmware never sees it between passes.
+static void cliDumpResume(void)
+{
+    // nothing to do until the port has drained, so don't swap the configuration for nothing
+    if (serialTxBytesFree(cliPort) < CLI_DUMP_TX_ROOM) {
+        return;
     }
 
-    if (dumpMask & DUMP_RATES) {
-        cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+    const timeUs_t startTime = micros();
+
+    backupAndResetConfigs();
+
+    while (cliDumpInProgress() && serialTxBytesFree(cliPort) >= CLI_DUMP_TX_ROOM) {
+        cliDumpStep();
+
+        if (cmpTimeUs(micros(), startTime) >= CLI_DUMP_SLICE_US) {
+            break;
+        }
     }
+
     // restore configs from copies
     restoreConfigs();
+
+    if (!cliDumpInProgress()) {
+        cliPrompt();
+    }
+}
+
+static void printConfig(char *cmdline, bool doDiff)
+{
+    uint8_t dumpMask = DUMP_MASTER;
+    char *options;
+    if ((options = checkCommand(cmdline, "master"))) {
+        dumpMask = DUMP_MASTER; // only
+    } else if ((options = checkCommand(cmdline, "profile"))) {
+        dumpMask = DUMP_PROFILE; // only
+    } else if ((options = checkCommand(cmdline, "rates"))) {
+        dumpMask = DUMP_RATES; // only
+    } else if ((options = checkCommand(cmdline, "all"))) {
+        dumpMask = DUMP_ALL;   // all profiles and rates
+    } else {
+        options = cmdline;
+    }
+
+    if (doDiff) {
+        dumpMask = dumpMask | DO_DIFF;
+    }
+
+    if (checkCommand(options, "defaults")) {
+        dumpMask = dumpMask | SHOW_DEFAULTS;   // add default values as comments for changed values
+    }
+
+    // the dump is written out by cliProcess() as the port drains
+    cliDumpState.dumpMask = dumpMask;
+    cliDumpState.section = 0;
+    cliDumpState.sectionEntry = 0;
+    if (dumpMask & (DUMP_MASTER | DUMP_ALL)) {
+        cliDumpStartPhase(DUMP_PHASE_MASTER_SECTIONS, 0);
+    } else if (dumpMask & DUMP_PROFILE) {
+        cliDumpStartPhase(DUMP_PHASE_PID_PROFILE, systemConfig()->pidProfileIndex);
+    } else {
+        cliDumpStartPhase(DUMP_PHASE_RATE_PROFILE, systemConfig()->activeRateProfile);
+    }
 }
 
 static void cliDump(char *cmdline)
@@ -4806,7 +5172,7 @@ static void cliDump(char *cmdline)
     printConfig(cmdline, false);
 }
 
-static void cliDiff(char *cmdline)
+STATIC_UNIT_TESTED void cliDiff(char *cmdline)
 {
     printConfig(cmdline, true);
 }
@@ -4988,7 +5354,7 @@ const clicmd_t cmdTable[] = {
 #endif
     CLI_COMMAND_DEF("status", "show status", NULL, cliStatus),
 #ifndef SKIP_TASK_STATISTICS
-    CLI_COMMAND_DEF("tasks", "show task stats", NULL, cliTasks),
+    CLI_COMMAND_DEF("tasks", "show task stats", "[histogram]", cliTasks),
 #endif
 #ifdef USE_TIMER_MGMT
     CLI_COMMAND_DEF("timer", "show timer configuration", NULL, cliTimer),
@@ -5026,6 +5392,60 @@ static void cliHelp(char *cmdline)
     }
 }
 
+// Completes the setting name after "set " or "get ", returns false if the line is anything else
+static bool cliCompleteValueName(void)
+{
+    const uint32_t nameStart = 4;
+
+    if (bufferIndex < nameStart || (strncasecmp(cliBuffer, "set ", nameStart) != 0 && strncasecmp(cliBuffer, "get ", nameStart) != 0)) {
+        return false;
+    }
+
+    const char *name = cliBuffer + nameStart;
+    const size_t length = bufferIndex - nameStart;
+    if (memchr(name, '=', length) || memchr(name, ' ', length)) {
+        return false;
+    }
+
+    const uint16_t first = valueNameIndexBound(name, length, false);
+    const uint16_t end = valueNameIndexBound(name, length, true);
+    uint32_t i = bufferIndex;
+
+    if (first < end) {
+        const char *firstName = valueTable[valueTableNameIndex[first]].name;
+        const char *lastName = valueTable[valueTableNameIndex[end - 1]].name;
+        for (; bufferIndex < sizeof(cliBuffer) - 2; bufferIndex++) {
+            const char ch = firstName[bufferIndex - nameStart];
+            if (!ch) {
+                if (first + 1 == end) {
+                    /* Unambiguous -- append a space */
+                    cliBuffer[bufferIndex++] = ' ';
+                }
+                break;
+            }
+            if (tolower(ch) != tolower(lastName[bufferIndex - nameStart])) {
+                break;
+            }
+            cliBuffer[bufferIndex] = ch;
+        }
+        cliBuffer[bufferIndex] = '\0';
+    }
+    if (end - first > 1) {
+        /* Print list of ambiguous matches */
+        cliPrint("\r\033[K");
+        for (uint16_t position = first; position < end; position++) {
+            cliPrint(valueTable[valueTableNameIndex[position]].name);
+            cliWrite('\t');
+        }
+        cliPrompt();
+        i = 0;    /* Redraw prompt */
+    }
+    for (; i < bufferIndex; i++)
+        cliWrite(cliBuffer[i]);
+
+    return true;
+}
+
 void cliProcess(void)
 {
     if (!cliWriter) {
@@ -5035,11 +5455,21 @@ void cliProcess(void)
     // Be a little bit tricky.  Flush the last inputs buffer, if any.
     bufWriterFlush(cliWriter);
 
+    if (cliDumpInProgress()) {
+        // further input waits in the port until the dump has been written out
+        cliDumpResume();
+        return;
+    }
+
     while (serialRxBytesWaiting(cliPort)) {
 
         uint8_t c = serialRead(cliPort);
 
         if (c == '\t' || c == '?') {
+            if (cliCompleteValueName()) {
+                continue;
+            }
+
             // do tab completion
             const clicmd_t *cmd, *pstart = NULL, *pend = NULL;
             uint32_t i = bufferIndex;
@@ -5122,6 +5552,12 @@ void cliProcess(void)
             if (!cliMode)
                 return;
 
+            // a dump prints the prompt once it has been written out
+            if (cliDumpInProgress()) {
+                cliDumpResume();
+                return;
+            }
+
             cliPrompt();
         } else if (c == 127) {
             // backspace
@@ -35,6 +35,7 @@
 #include "common/axis.h"
 #include "common/bitarray.h"
 #include "common/color.h"
+#include "common/crc.h"
 #include "common/maths.h"
 #include "common/streambuf.h"
 #include "common/huffman.h"
@@ -47,6 +48,7 @@
 #include "drivers/camera_control.h"
 #include "drivers/compass/compass.h"
 #include "drivers/flash.h"
+#include "drivers/time.h"
 #include "drivers/io.h"
 #include "drivers/max7456.h"
 #include "drivers/pwm_output.h"
@@ -78,7 +80,10 @@
 
 #include "interface/msp.h"
 #include "interface/msp_box.h"
+#include "interface/msp_dataflash_bulk.h"
 #include "interface/msp_protocol.h"
+#include "interface/msp_protocol_v2_emuflight.h"
+#include "interface/msp_settings.h"
 
 #include "io/asyncfatfs/asyncfatfs.h"
 #include "io/beeper.h"
@@ -161,7 +166,8 @@ typedef enum {
 
 typedef enum {
     MSP_FLASHFS_FLAG_READY       = 1,
-    MSP_FLASHFS_FLAG_SUPPORTED  = 2
+    MSP_FLASHFS_FLAG_SUPPORTED  = 2,
+    MSP_FLASHFS_FLAG_ERASING    = 4
 } mspFlashFsFlags_e;
 
 #define RATEPROFILE_MASK (1 << 7)
@@ -322,11 +328,13 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
     if (flashfsIsSupported()) {
         uint8_t flags = MSP_FLASHFS_FLAG_SUPPORTED;
         flags |= (flashfsIsReady() ? MSP_FLASHFS_FLAG_READY : 0);
+        flags |= (flashfsIsErasing() ? MSP_FLASHFS_FLAG_ERASING : 0);
         const flashGeometry_t *geometry = flashfsGetGeometry();
         sbufWriteU8(dst, flags);
         sbufWriteU32(dst, geometry->sectors);
-        sbufWriteU32(dst, geometry->totalSize);
+        sbufWriteU32(dst, flashfsGetSize()); // The volume, without the sector reserved for the log directory
         sbufWriteU32(dst, flashfsGetOffset()); // Effectively the current number of bytes stored on the volume
+        sbufWriteU8(dst, flashfsGetEraseProgress()); // Percent done of the background erase
     } else
 #endif
 
@@ -336,6 +344,7 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
         sbufWriteU32(dst, 0);
         sbufWriteU32(dst, 0);
         sbufWriteU32(dst, 0);
+        sbufWriteU8(dst, 0);
     }
 }
 
@@ -1502,6 +1511,26 @@ static mspResult_e mspFcProcessOutCommandWithArg(uint8_t cmdMSP, sbuf_t *src, sb
             serializeBoxReply(dst, page, &serializeBoxPermanentIdFn);
         }
         break;
+#endif
+#ifndef SKIP_TASK_STATISTICS
+    case MSP_TASK_HISTOGRAM:
+        {
+            const cfTaskId_e taskId = sbufBytesRemaining(src) ? sbufReadU8(src) : TASK_COUNT;
+            if (taskId >= TASK_COUNT) {
+                return MSP_RESULT_ERROR;
+            }
+            cfTaskHistogram_t histogram;
+            getTaskHistogram(taskId, &histogram);
+            sbufWriteU8(dst, taskId);
+            sbufWriteU8(dst, TASK_HISTOGRAM_BUCKET_COUNT);
+            for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKET_COUNT; bucket++) {
+                sbufWriteU16(dst, histogram.executionTime[bucket]);
+            }
+            for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKET_COUNT; bucket++) {
+                sbufWriteU16(dst, histogram.lateness[bucket]);
+            }
+        }
+        break;
 #endif
     case MSP_REBOOT:
         if (sbufBytesRemaining(src)) {
@@ -1564,7 +1593,48 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
 
     serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, allowCompression);
 }
+
+static void dataflashBulkStart(serialPort_t *port)
+{
+    mspSerialStartStream(port, dataflashBulkStream);
+}
+#endif
+
+static mspResult_e mspFcProcessV2Command(uint16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(src);
+    UNUSED(dst);
+    UNUSED(mspPostProcessFn);
+
+    switch (cmdMSP) {
+#ifdef USE_FLASHFS
+    case MSP2_EMUF_DATAFLASH_BULK_READ:
+        if (sbufBytesRemaining(src) < (int)(sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t))) {
+            return MSP_RESULT_ERROR;
+        }
+        dataflashBulkRead(dst, src, mspSerialStreamPayloadMax());
+        if (dataflashBulkIsActive() && mspPostProcessFn) {
+            *mspPostProcessFn = dataflashBulkStart;
+        }
+        return MSP_RESULT_ACK;
+    case MSP2_EMUF_DATAFLASH_BULK_ACK:
+        dataflashBulkAck(src);
+        return MSP_RESULT_NO_REPLY;
 #endif
+#ifndef USE_OSD_SLAVE
+    case MSP2_EMUF_SETTINGS_INFO:
+        mspSettingsInfo(dst, src);
+        return MSP_RESULT_ACK;
+    case MSP2_EMUF_SETTINGS_READ:
+        mspSettingsRead(dst, src);
+        return MSP_RESULT_ACK;
+    case MSP2_EMUF_SETTINGS_WRITE:
+        return mspSettingsWrite(dst, src);
+#endif
+    default:
+        return MSP_RESULT_CMD_UNKNOWN;
+    }
+}
 
 #ifdef USE_OSD_SLAVE
 static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
@@ -2650,7 +2720,13 @@ mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostPro
     // initialize reply by default
     reply->cmd = cmd->cmd;
 
-    if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
+    if (MSP2_IS_V2_COMMAND(cmd->cmd)) {
+        // v2 commands do not fit in cmdMSP
+        ret = mspFcProcessV2Command(cmd->cmd, src, dst, mspPostProcessFn);
+        if (ret == MSP_RESULT_CMD_UNKNOWN) {
+            ret = MSP_RESULT_ERROR;
+        }
+    } else if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
         ret = MSP_RESULT_ACK;
     } else if (mspProcessOutCommand(cmdMSP, dst)) {
         ret = MSP_RESULT_ACK;
@@ -59,6 +59,15 @@ typedef void (*mspPostProcessFnPtr)(struct serialPort_s *port); // msp post proc
 typedef mspResult_e (*mspProcessCommandFnPtr)(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
 typedef void (*mspProcessReplyFnPtr)(mspPacket_t *cmd);
 
+typedef enum {
+    MSP_STREAM_SEND,    // the packet holds a frame to send
+    MSP_STREAM_WAIT,    // nothing to send now, call again later
+    MSP_STREAM_DONE     // the stream has ended
+} mspStreamResult_e;
+
+// fills the packet with the next frame of a stream of replies, sbufBytesRemaining() of the packet is what the port can take now
+typedef mspStreamResult_e (*mspStreamFnPtr)(mspPacket_t *packet);
+
 
 void mspInit(void);
 mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
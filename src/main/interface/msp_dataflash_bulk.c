@@ -0,0 +1,204 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_FLASHFS
+
+#include "common/crc.h"
+#include "common/maths.h"
+#include "common/streambuf.h"
+
+#include "drivers/time.h"
+
+#include "interface/msp_dataflash_bulk.h"
+#include "interface/msp_protocol_v2_emuflight.h"
+
+#include "io/flashfs.h"
+
+#include "msp/msp_serial.h"
+
+/*
+ * Bulk dataflash read, see MSP2_EMUF_DATAFLASH_BULK_READ. Chunk n always covers address + n * chunkSize, so a chunk
+ * that has to be sent again is read from the flash again and nothing is buffered.
+ */
+#define DATAFLASH_BULK_MAX_WINDOW       32
+#define DATAFLASH_BULK_MIN_CHUNK_SIZE   16
+#define DATAFLASH_BULK_RESEND_MS        100     // send the oldest chunks again when no ack came for this long
+#define DATAFLASH_BULK_TIMEOUT_MS       2000    // give up when the host has gone quiet
+#define DATAFLASH_BULK_CHUNK_OVERHEAD   (sizeof(uint16_t) + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint16_t))
+
+static struct {
+    uint32_t address;
+    uint32_t length;
+    uint16_t chunkSize;
+    uint16_t chunkCount;
+    uint8_t window;
+    uint16_t base;          // first chunk not acknowledged
+    uint16_t next;          // first chunk never sent
+    uint32_t acked;         // bit i, chunk base + i has been acknowledged
+    uint32_t resend;        // bit i, chunk base + i has to be sent again
+    uint32_t resent;        // bit i, chunk base + i was sent again, only the resend timer sends it once more
+    timeMs_t lastAckMs;
+    timeMs_t lastResendMs;
+    bool active;
+} dataflashBulk;
+
+void dataflashBulkRead(sbuf_t *dst, sbuf_t *src, uint16_t payloadMax)
+{
+    const uint32_t address = sbufReadU32(src);
+    uint32_t length = sbufReadU32(src);
+    uint16_t chunkSize = sbufReadU16(src);
+    uint8_t window = sbufReadU8(src);
+
+    const uint32_t flashfsSize = flashfsGetSize();
+    if (address >= flashfsSize) {
+        length = 0;
+    } else if (length > flashfsSize - address) {
+        length = flashfsSize - address;
+    }
+    // a chunk bigger than the port can take in one frame would never be sent
+    const int chunkSizeMax = MIN(MSP_PORT_DATAFLASH_BUFFER_SIZE, payloadMax - (int)DATAFLASH_BULK_CHUNK_OVERHEAD);
+    if (chunkSizeMax < DATAFLASH_BULK_MIN_CHUNK_SIZE) {
+        length = 0;
+    }
+    chunkSize = constrain(chunkSize, DATAFLASH_BULK_MIN_CHUNK_SIZE, MAX(chunkSizeMax, DATAFLASH_BULK_MIN_CHUNK_SIZE));
+    window = constrain(window, 1, DATAFLASH_BULK_MAX_WINDOW);
+    const uint32_t chunkCount = MIN((length + chunkSize - 1) / chunkSize, (uint32_t)UINT16_MAX);
+    length = MIN(length, chunkCount * chunkSize);
+
+    dataflashBulk.address = address;
+    dataflashBulk.length = length;
+    dataflashBulk.chunkSize = chunkSize;
+    dataflashBulk.chunkCount = chunkCount;
+    dataflashBulk.window = window;
+    dataflashBulk.base = 0;
+    dataflashBulk.next = 0;
+    dataflashBulk.acked = 0;
+    dataflashBulk.resend = 0;
+    dataflashBulk.resent = 0;
+    dataflashBulk.lastAckMs = millis();
+    dataflashBulk.lastResendMs = dataflashBulk.lastAckMs;
+    dataflashBulk.active = length > 0;
+
+    sbufWriteU32(dst, address);
+    sbufWriteU32(dst, length);
+    sbufWriteU16(dst, chunkSize);
+    sbufWriteU8(dst, window);
+    sbufWriteU16(dst, chunkCount);
+}
+
+void dataflashBulkAck(sbuf_t *src)
+{
+    if (!dataflashBulk.active || sbufBytesRemaining(src) < (int)(sizeof(uint16_t) + sizeof(uint32_t))) {
+        return;
+    }
+    const uint16_t firstMissing = sbufReadU16(src);
+    const uint32_t receivedAfter = sbufReadU32(src);
+
+    if (firstMissing > dataflashBulk.next) {
+        return; // acks a chunk that was never sent
+    }
+
+    const uint16_t advance = firstMissing - dataflashBulk.base;
+    if (firstMissing > dataflashBulk.base) {
+        dataflashBulk.acked = advance < 32 ? dataflashBulk.acked >> advance : 0;
+        dataflashBulk.resend = advance < 32 ? dataflashBulk.resend >> advance : 0;
+        dataflashBulk.resent = advance < 32 ? dataflashBulk.resent >> advance : 0;
+        dataflashBulk.base = firstMissing;
+    }
+    if (firstMissing == dataflashBulk.base) {
+        dataflashBulk.acked |= receivedAfter << 1;
+    }
+
+    // everything sent before the last chunk received and still missing was lost
+    const int inFlight = dataflashBulk.next - dataflashBulk.base;
+    const uint32_t sentMask = inFlight >= 32 ? 0xFFFFFFFF : (1U << inFlight) - 1;
+    const uint32_t acked = dataflashBulk.acked & sentMask;
+    if (acked) {
+        const uint32_t belowHighest = (1U << (31 - __builtin_clz(acked))) - 1;
+        dataflashBulk.resend |= belowHighest & ~acked & ~dataflashBulk.resent;
+    }
+    dataflashBulk.lastAckMs = millis();
+    dataflashBulk.lastResendMs = dataflashBulk.lastAckMs;
+}
+
+mspStreamResult_e dataflashBulkStream(mspPacket_t *packet)
+{
+    if (!dataflashBulk.active || dataflashBulk.base >= dataflashBulk.chunkCount) {
+        dataflashBulk.active = false;
+        return MSP_STREAM_DONE;
+    }
+
+    const timeMs_t now = millis();
+    if (now - dataflashBulk.lastAckMs > DATAFLASH_BULK_TIMEOUT_MS) {
+        dataflashBulk.active = false;
+        return MSP_STREAM_DONE;
+    }
+    if (now - dataflashBulk.lastResendMs > DATAFLASH_BULK_RESEND_MS && !dataflashBulk.resend && dataflashBulk.next > dataflashBulk.base) {
+        // the acks stopped, send the oldest chunk not acknowledged again
+        dataflashBulk.resend = 1;
+        dataflashBulk.lastResendMs = now;
+    }
+
+    sbuf_t *dst = &packet->buf;
+    if (sbufBytesRemaining(dst) < (int)(dataflashBulk.chunkSize + DATAFLASH_BULK_CHUNK_OVERHEAD)) {
+        return MSP_STREAM_WAIT;
+    }
+
+    uint16_t sequence;
+    if (dataflashBulk.resend) {
+        const int index = __builtin_ctz(dataflashBulk.resend);
+        dataflashBulk.resend &= ~(1U << index);
+        dataflashBulk.resent |= 1U << index;
+        sequence = dataflashBulk.base + index;
+    } else if (dataflashBulk.next < dataflashBulk.chunkCount && dataflashBulk.next - dataflashBulk.base < dataflashBulk.window) {
+        sequence = dataflashBulk.next++;
+    } else {
+        return MSP_STREAM_WAIT;
+    }
+
+    const uint32_t offset = (uint32_t)sequence * dataflashBulk.chunkSize;
+    const uint16_t length = MIN(dataflashBulk.chunkSize, dataflashBulk.length - offset);
+
+    packet->cmd = MSP2_EMUF_DATAFLASH_BULK_CHUNK;
+    sbufWriteU16(dst, sequence);
+    sbufWriteU32(dst, dataflashBulk.address + offset);
+    sbufWriteU16(dst, length);
+    uint8_t *data = sbufPtr(dst);
+    const int bytesRead = flashfsReadAbs(dataflashBulk.address + offset, data, length);
+    if (bytesRead < length) {
+        memset(data + bytesRead, 0, length - bytesRead);
+    }
+    sbufAdvance(dst, length);
+    sbufWriteU16(dst, crc16_ccitt_update(0, data, length));
+
+    return MSP_STREAM_SEND;
+}
+
+bool dataflashBulkIsActive(void)
+{
+    return dataflashBulk.active;
+}
+#endif
@@ -352,3 +352,4 @@
 #define MSP_IMUF_INFO            229    //out message
 #define MSP_EMUF                 231    //out message
 #define MSP_SET_EMUF             232    //in message
+#define MSP_TASK_HISTOGRAM       233    //out message         execution time and lateness histograms of one task
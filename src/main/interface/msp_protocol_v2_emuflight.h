@@ -0,0 +1,69 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// MSP v2 commands, these only fit in the 16 bit command field of MSP v2 frames
+
+#define MSP2_IS_V2_COMMAND(cmd)                 ((cmd) > 255)
+
+/*
+ * Bulk dataflash read, the FC streams the requested range as chunks without waiting for a request per chunk.
+ *
+ * in:    u32 address, u32 length, u16 chunk size, u8 window (chunks in flight). A length of 0 cancels a transfer.
+ * reply: u32 address, u32 length (truncated to the volume), u16 chunk size, u8 window, u16 chunk count
+ *        The chunk size is cut down to what the port sends in one frame, 228 bytes on a UART.
+ *
+ * Then one MSP2_EMUF_DATAFLASH_BULK_CHUNK reply per chunk: u16 sequence, u32 address, u16 length, data,
+ * u16 CRC16-CCITT of the data.
+ */
+#define MSP2_EMUF_DATAFLASH_BULK_READ           0x3000
+#define MSP2_EMUF_DATAFLASH_BULK_CHUNK          0x3001
+/*
+ * in:    u16 first sequence not received yet, u32 bit mask of the chunks received after it (bit 0 is the sequence
+ *        one after the first). There is no reply. Chunks missing below the highest received one are sent again.
+ */
+#define MSP2_EMUF_DATAFLASH_BULK_ACK            0x3002
+
+/*
+ * Bulk settings transfer by position in the CLI settings table. The metadata is read once per firmware, the table
+ * hash tells the host when its cached copy is stale. Values travel in runs of consecutive settings, each value in
+ * little endian at its size from the metadata. PROFILE_VALUE and PROFILE_RATE_VALUE settings are those of the
+ * current profiles, see MSP_SELECT_SETTING.
+ *
+ * in:    u16 first setting
+ * reply: u16 setting count, u32 table hash, u16 first setting, u8 entries, then per entry:
+ *        u32 FNV-1a hash of the lower case name, u8 type (cliValueFlag_e), u8 value size, i16 min, i16 max,
+ *        u16 pgn, u16 offset in the PG. As many entries follow as fit in the reply.
+ */
+#define MSP2_EMUF_SETTINGS_INFO                 0x3010
+/*
+ * in:    runs of u16 first setting, u8 count
+ * reply: the same runs, each followed by its values. A run that doesn't fit is cut short and ends the reply.
+ */
+#define MSP2_EMUF_SETTINGS_READ                 0x3011
+/*
+ * in:    u8 flags (bit 0 saves to EEPROM after the values are applied), then runs of u16 first setting, u8 count
+ *        and the values. Nothing is applied unless every value is in range.
+ * reply: u16 settings applied, or u16 first setting rejected with an error reply
+ */
+#define MSP2_EMUF_SETTINGS_WRITE                0x3012
+
+#define MSP2_EMUF_SETTINGS_WRITE_SAVE           (1 << 0)
@@ -0,0 +1,304 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifndef USE_OSD_SLAVE
+
+#include "common/maths.h"
+#include "common/streambuf.h"
+
+#include "fc/config.h"
+#include "fc/runtime_config.h"
+
+#include "interface/msp_protocol_v2_emuflight.h"
+#include "interface/msp_settings.h"
+#include "interface/settings.h"
+
+#include "pg/pg.h"
+
+/*
+ * Bulk settings transfer, see MSP2_EMUF_SETTINGS_INFO. Settings are addressed by their position in valueTable.
+ */
+#define SETTINGS_INFO_ENTRY_SIZE    (sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint8_t) + 2 * sizeof(int16_t) + 2 * sizeof(uint16_t))
+#define SETTINGS_RUN_SIZE           (sizeof(uint16_t) + sizeof(uint8_t))
+
+static uint32_t settingNameHash(const char *name)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261U;
+    while (*name) {
+        hash ^= (uint8_t)tolower((unsigned char)*name++);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static uint8_t settingElementSize(const clivalue_t *value)
+{
+    switch (value->type & VALUE_TYPE_MASK) {
+    case VAR_UINT32:
+        return 4;
+    case VAR_UINT16:
+    case VAR_INT16:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+static uint8_t settingSize(const clivalue_t *value)
+{
+    switch (value->type & VALUE_MODE_MASK) {
+    case MODE_ARRAY:
+        return settingElementSize(value) * value->config.array.length;
+    case MODE_BITSET:
+        return 1;
+    default:
+        return settingElementSize(value);
+    }
+}
+
+static void settingRange(const clivalue_t *value, int16_t *min, int16_t *max)
+{
+    switch (value->type & VALUE_MODE_MASK) {
+    case MODE_DIRECT:
+        *min = value->config.minmax.min;
+        *max = value->config.minmax.max;
+        break;
+    case MODE_LOOKUP:
+        *min = 0;
+        *max = lookupTables[value->config.lookup.tableIndex].valueCount - 1;
+        break;
+    case MODE_BITSET:
+        *min = 0;
+        *max = 1;
+        break;
+    default:
+        // array elements take any value of their type
+        *min = 0;
+        *max = 0;
+        break;
+    }
+}
+
+static uint8_t *settingPointer(const clivalue_t *value)
+{
+    return pgFind(value->pgn)->address + settingGetValueOffset(value, getCurrentPidProfileIndex(), getCurrentControlRateProfileIndex());
+}
+
+static uint32_t settingsTableHash(void)
+{
+    static uint32_t tableHash = 0;
+
+    if (!tableHash) {
+        tableHash = 2166136261U;
+        for (uint16_t i = 0; i < valueTableEntryCount; i++) {
+            const clivalue_t *value = &valueTable[i];
+            tableHash = (tableHash ^ settingNameHash(value->name)) * 16777619U;
+            tableHash = (tableHash ^ (value->type | value->pgn << 8)) * 16777619U;
+            tableHash = (tableHash ^ value->offset) * 16777619U;
+        }
+    }
+
+    return tableHash;
+}
+
+void mspSettingsInfo(sbuf_t *dst, sbuf_t *src)
+{
+    const uint16_t first = sbufBytesRemaining(src) >= (int)sizeof(uint16_t) ? sbufReadU16(src) : 0;
+
+    sbufWriteU16(dst, valueTableEntryCount);
+    sbufWriteU32(dst, settingsTableHash());
+    sbufWriteU16(dst, first);
+    uint8_t *entriesPtr = sbufPtr(dst);
+    sbufWriteU8(dst, 0);
+
+    uint8_t entries = 0;
+    for (uint16_t i = first; i < valueTableEntryCount && entries < UINT8_MAX && sbufBytesRemaining(dst) >= (int)SETTINGS_INFO_ENTRY_SIZE; i++) {
+        const clivalue_t *value = &valueTable[i];
+        int16_t min, max;
+        settingRange(value, &min, &max);
+
+        sbufWriteU32(dst, settingNameHash(value->name));
+        sbufWriteU8(dst, value->type);
+        sbufWriteU8(dst, settingSize(value));
+        sbufWriteU16(dst, min);
+        sbufWriteU16(dst, max);
+        sbufWriteU16(dst, value->pgn);
+        sbufWriteU16(dst, value->offset);
+        entries++;
+    }
+    *entriesPtr = entries;
+}
+
+void mspSettingsRead(sbuf_t *dst, sbuf_t *src)
+{
+    while (sbufBytesRemaining(src) >= (int)SETTINGS_RUN_SIZE && sbufBytesRemaining(dst) >= (int)SETTINGS_RUN_SIZE) {
+        const uint16_t first = sbufReadU16(src);
+        const uint8_t count = sbufReadU8(src);
+
+        sbufWriteU16(dst, first);
+        uint8_t *countPtr = sbufPtr(dst);
+        sbufWriteU8(dst, 0);
+
+        uint8_t done = 0;
+        for (uint16_t i = first; done < count && i < valueTableEntryCount; i++) {
+            const clivalue_t *value = &valueTable[i];
+            const uint8_t size = settingSize(value);
+            if (sbufBytesRemaining(dst) < size) {
+                break;
+            }
+            const uint8_t *ptr = settingPointer(value);
+            if ((value->type & VALUE_MODE_MASK) == MODE_BITSET) {
+                uint32_t word = 0;
+                memcpy(&word, ptr, settingElementSize(value));
+                sbufWriteU8(dst, (word >> value->config.bitpos) & 1);
+            } else {
+                sbufWriteData(dst, ptr, size);
+            }
+            done++;
+        }
+        *countPtr = done;
+
+        if (done < count) {
+            break;
+        }
+    }
+}
+
+static bool settingValueIsValid(const clivalue_t *value, const uint8_t *data)
+{
+    switch (value->type & VALUE_MODE_MASK) {
+    case MODE_BITSET:
+        return data[0] <= 1;
+    case MODE_ARRAY:
+        return true;
+    }
+
+    int32_t v;
+    switch (value->type & VALUE_TYPE_MASK) {
+    case VAR_INT8:
+        v = (int8_t)data[0];
+        break;
+    case VAR_UINT16:
+        v = data[0] | data[1] << 8;
+        break;
+    case VAR_INT16:
+        v = (int16_t)(data[0] | data[1] << 8);
+        break;
+    case VAR_UINT32:
+        v = MIN((uint32_t)data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24, (uint32_t)INT32_MAX);
+        break;
+    default:
+        v = data[0];
+        break;
+    }
+
+    if ((value->type & VALUE_MODE_MASK) == MODE_LOOKUP) {
+        const lookupTableEntry_t *tableEntry = &lookupTables[value->config.lookup.tableIndex];
+        return v >= 0 && v < tableEntry->valueCount && tableEntry->values[v];
+    }
+
+    return v >= value->config.minmax.min && v <= value->config.minmax.max;
+}
+
+static void settingApply(const clivalue_t *value, const uint8_t *data)
+{
+    uint8_t *ptr = settingPointer(value);
+
+    if ((value->type & VALUE_MODE_MASK) == MODE_BITSET) {
+        uint32_t word = 0;
+        memcpy(&word, ptr, settingElementSize(value));
+        if (data[0]) {
+            word |= 1U << value->config.bitpos;
+        } else {
+            word &= ~(1U << value->config.bitpos);
+        }
+        memcpy(ptr, &word, settingElementSize(value));
+    } else {
+        memcpy(ptr, data, settingSize(value));
+    }
+}
+
+// Walks the runs in src, checking every value or applying them. Returns the number of settings, or -1 with the
+// first bad setting in badSetting.
+static int settingsWriteRuns(sbuf_t src, bool apply, uint16_t *badSetting)
+{
+    int settings = 0;
+
+    while (sbufBytesRemaining(&src) > 0) {
+        if (sbufBytesRemaining(&src) < (int)SETTINGS_RUN_SIZE) {
+            *badSetting = UINT16_MAX;
+            return -1;
+        }
+        const uint16_t first = sbufReadU16(&src);
+        const uint8_t count = sbufReadU8(&src);
+
+        for (uint16_t i = first; i < first + count; i++) {
+            if (i >= valueTableEntryCount) {
+                *badSetting = i;
+                return -1;
+            }
+            const clivalue_t *value = &valueTable[i];
+            const uint8_t size = settingSize(value);
+            if (sbufBytesRemaining(&src) < size || !settingValueIsValid(value, sbufPtr(&src))) {
+                *badSetting = i;
+                return -1;
+            }
+            if (apply) {
+                settingApply(value, sbufPtr(&src));
+            }
+            sbufAdvance(&src, size);
+            settings++;
+        }
+    }
+
+    return settings;
+}
+
+mspResult_e mspSettingsWrite(sbuf_t *dst, sbuf_t *src)
+{
+    if (ARMING_FLAG(ARMED) || sbufBytesRemaining(src) < (int)sizeof(uint8_t)) {
+        return MSP_RESULT_ERROR;
+    }
+    const uint8_t flags = sbufReadU8(src);
+
+    uint16_t badSetting;
+    if (settingsWriteRuns(*src, false, &badSetting) < 0) {
+        sbufWriteU16(dst, badSetting);
+        return MSP_RESULT_ERROR;
+    }
+    const int settings = settingsWriteRuns(*src, true, &badSetting);
+
+    if (flags & MSP2_EMUF_SETTINGS_WRITE_SAVE) {
+        writeEEPROM();
+        readEEPROM();
+    }
+
+    sbufWriteU16(dst, settings);
+    return MSP_RESULT_ACK;
+}
+#endif
@@ -198,6 +198,14 @@ static const char * const lookupTableBlackboxDevice[] = {
 static const char * const lookupTableBlackboxMode[] = {
     "NORMAL", "MOTOR_TEST", "ALWAYS"
 };
+
+static const char * const lookupTableBlackboxCompression[] = {
+    "NONE", "HUFFMAN"
+};
+
+static const char * const lookupTableBlackboxProfile[] = {
+    "CUSTOM", "TUNING", "LONG_RANGE", "MINIMAL"
+};
 #endif
 
 #ifdef USE_SERIAL_RX
@@ -317,6 +325,10 @@ static const char * const lookupTableRatesType[] = {
     "BETAFLIGHT", "RACEFLIGHT"
 };
 
+static const char * const lookupTableSchedulerMode[] = {
+    "PRIORITY", "EDF"
+};
+
 #ifdef USE_OVERCLOCK
 static const char * const lookupOverclock[] = {
     "OFF",
@@ -382,6 +394,17 @@ static const char * const lookupTableRcSmoothingDerivativeType[] = {
 };
 #endif // USE_RC_SMOOTHING_FILTER
 
+#ifdef USE_GYRO_DATA_ANALYSE
+static const char * const lookupTableDynNotchFftSize[] = {
+#ifdef STM32F3
+    // the analyser buffers only hold FFT_WINDOW_SIZE_MAX samples on F3
+    "32"
+#else
+    "32", "64", "128"
+#endif
+};
+#endif
+
 #define LOOKUP_TABLE_ENTRY(name) { name, ARRAYLEN(name) }
 
 const lookupTableEntry_t lookupTables[] = {
@@ -398,6 +421,8 @@ const lookupTableEntry_t lookupTables[] = {
 #ifdef USE_BLACKBOX
     LOOKUP_TABLE_ENTRY(lookupTableBlackboxDevice),
     LOOKUP_TABLE_ENTRY(lookupTableBlackboxMode),
+    LOOKUP_TABLE_ENTRY(lookupTableBlackboxCompression),
+    LOOKUP_TABLE_ENTRY(lookupTableBlackboxProfile),
 #endif
     LOOKUP_TABLE_ENTRY(currentMeterSourceNames),
     LOOKUP_TABLE_ENTRY(voltageMeterSourceNames),
@@ -447,6 +472,7 @@ const lookupTableEntry_t lookupTables[] = {
     LOOKUP_TABLE_ENTRY(lookupTableGyroOverflowCheck),
 #endif
     LOOKUP_TABLE_ENTRY(lookupTableRatesType),
+    LOOKUP_TABLE_ENTRY(lookupTableSchedulerMode),
 #ifdef USE_OVERCLOCK
     LOOKUP_TABLE_ENTRY(lookupOverclock),
 #endif
@@ -473,6 +499,9 @@ const lookupTableEntry_t lookupTables[] = {
     LOOKUP_TABLE_ENTRY(lookupTableRcSmoothingInputType),
     LOOKUP_TABLE_ENTRY(lookupTableRcSmoothingDerivativeType),
 #endif // USE_RC_SMOOTHING_FILTER
+#ifdef USE_GYRO_DATA_ANALYSE
+    LOOKUP_TABLE_ENTRY(lookupTableDynNotchFftSize),
+#endif
 };
 
 #undef LOOKUP_TABLE_ENTRY
@@ -488,6 +517,7 @@ const clivalue_t valueTable[] = {
     { "gyro_high_range",            VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_high_fsr) },
 #endif
     { "gyro_sync_denom",            VAR_UINT8  | MASTER_VALUE, .config.minmax = { 1, 32 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_sync_denom) },
+    { "gyro_interrupt_sync",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_interrupt_sync) },
 
     { "gyro_lowpass_type",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_lowpass_type) },
     { "gyro_lowpass_hz",            VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_lowpass_hz) },
@@ -517,7 +547,7 @@ const clivalue_t valueTable[] = {
     { "imuf_roll_q",                VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, imuf_roll_q) },
     { "imuf_pitch_q",               VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, imuf_pitch_q) },
     { "imuf_yaw_q",                 VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, imuf_yaw_q) },
-    { "imuf_w",                     VAR_UINT16 | MASTER_VALUE, .config.minmax = { 3, 512   }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, imuf_w) },
+    { "imuf_w",                     VAR_UINT16 | MASTER_VALUE, .config.minmax = { 3, 1024  }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, imuf_w) },
 #endif
 #ifdef USE_GYRO_OVERFLOW_CHECK
     { "gyro_overflow_detect",       VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_OVERFLOW_CHECK }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, checkOverflow) },
@@ -536,6 +566,10 @@ const clivalue_t valueTable[] = {
 #if defined(USE_GYRO_DATA_ANALYSE)
     { "dyn_notch_quality",          VAR_UINT8 | MASTER_VALUE, .config.minmax = { 1, 70 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_quality) },
     { "dyn_notch_width_percent",    VAR_UINT8  | MASTER_VALUE, .config.minmax = { 1, 99 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_width_percent) },
+    { "dyn_notch_count",            VAR_UINT8  | MASTER_VALUE, .config.minmax = { 1, DYN_NOTCH_COUNT_MAX }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_count) },
+    { "dyn_notch_fft_size",         VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYN_NOTCH_FFT_SIZE }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_fft_size) },
+    { "dyn_notch_sample_hz",        VAR_UINT16 | MASTER_VALUE, .config.minmax = { 500, 2000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_sample_hz) },
+    { "dyn_notch_min_hz",           VAR_UINT16 | MASTER_VALUE, .config.minmax = { 60, 250 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_min_hz) },
 #endif
 
 // PG_ACCELEROMETER_CONFIG
@@ -632,6 +666,22 @@ const clivalue_t valueTable[] = {
     { "blackbox_device",            VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, device) },
     { "blackbox_record_acc",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, record_acc) },
     { "blackbox_mode",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_MODE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, mode) },
+    { "blackbox_compression",       VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_COMPRESSION }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, compression) },
+    { "blackbox_profile",           VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_PROFILE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, profile) },
+    { "blackbox_rate_div_pid",      VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_PID]) },
+    { "blackbox_rate_div_rc",       VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_RC_COMMANDS]) },
+    { "blackbox_rate_div_setpoint", VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_SETPOINT]) },
+    { "blackbox_rate_div_battery",  VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_BATTERY]) },
+    { "blackbox_rate_div_mag",      VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_MAG]) },
+    { "blackbox_rate_div_altitude", VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_ALTITUDE]) },
+    { "blackbox_rate_div_rssi",     VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_RSSI]) },
+    { "blackbox_rate_div_gyro",     VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_GYRO]) },
+    { "blackbox_rate_div_acc",      VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_ACC]) },
+    { "blackbox_rate_div_debug",    VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_DEBUG]) },
+    { "blackbox_rate_div_motor",    VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, BLACKBOX_GROUP_RATE_DIV_MAX }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, group_rate_div[BLACKBOX_FIELD_GROUP_MOTOR]) },
+#ifdef USE_FLASHFS
+    { "blackbox_flash_erase_ahead", VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, flash_erase_ahead) },
+#endif
 #endif
 
 // PG_MOTOR_CONFIG
@@ -980,6 +1030,9 @@ const clivalue_t valueTable[] = {
 #ifdef USE_ADC_INTERNAL
     { "osd_warn_core_temp",         VAR_UINT16  | MASTER_VALUE | MODE_BITSET, .config.bitpos = OSD_WARNING_CORE_TEMPERATURE, PG_OSD_CONFIG, offsetof(osdConfig_t, enabledWarnings)},
 #endif
+#ifdef USE_FLASHFS
+    { "osd_warn_flash_erase",       VAR_UINT16  | MASTER_VALUE | MODE_BITSET, .config.bitpos = OSD_WARNING_FLASH_ERASE,      PG_OSD_CONFIG, offsetof(osdConfig_t, enabledWarnings)},
+#endif
 
     { "osd_rssi_alarm",             VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 100 }, PG_OSD_CONFIG, offsetof(osdConfig_t, rssi_alarm) },
     { "osd_cap_alarm",              VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 20000 }, PG_OSD_CONFIG, offsetof(osdConfig_t, cap_alarm) },
@@ -1073,6 +1126,7 @@ const clivalue_t valueTable[] = {
     { "cpu_overclock",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OVERCLOCK }, PG_SYSTEM_CONFIG, offsetof(systemConfig_t, cpu_overclock) },
 #endif
     { "pwr_on_arm_grace",           VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 30 }, PG_SYSTEM_CONFIG, offsetof(systemConfig_t, powerOnArmingGraceTime) },
+    { "scheduler_mode",             VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SCHEDULER_MODE }, PG_SYSTEM_CONFIG, offsetof(systemConfig_t, scheduler_mode) },
 
 // PG_VTX_CONFIG
 #ifdef USE_VTX_COMMON
@@ -1180,6 +1234,11 @@ const clivalue_t valueTable[] = {
 
 const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
 
+#ifdef USE_CLI
+// valueTable positions in case insensitive name order, filled in by the CLI on its first lookup
+uint16_t valueTableNameIndex[ARRAYLEN(valueTable)];
+#endif
+
 void settingsBuildCheck() {
     BUILD_BUG_ON(LOOKUP_TABLE_COUNT != ARRAYLEN(lookupTables));
 }
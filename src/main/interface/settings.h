@@ -23,6 +23,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "pg/pg.h"
+#include "fc/controlrate_profile.h"
+#include "flight/pid.h"
 
 
 typedef enum {
@@ -39,6 +41,8 @@ typedef enum {
 #ifdef USE_BLACKBOX
     TABLE_BLACKBOX_DEVICE,
     TABLE_BLACKBOX_MODE,
+    TABLE_BLACKBOX_COMPRESSION,
+    TABLE_BLACKBOX_PROFILE,
 #endif
     TABLE_CURRENT_METER,
     TABLE_VOLTAGE_METER,
@@ -88,6 +92,7 @@ typedef enum {
     TABLE_GYRO_OVERFLOW_CHECK,
 #endif
     TABLE_RATES_TYPE,
+    TABLE_SCHEDULER_MODE,
 #ifdef USE_OVERCLOCK
     TABLE_OVERCLOCK,
 #endif
@@ -114,6 +119,9 @@ typedef enum {
     TABLE_RC_SMOOTHING_INPUT_TYPE,
     TABLE_RC_SMOOTHING_DERIVATIVE_TYPE,
 #endif // USE_RC_SMOOTHING_FILTER
+#ifdef USE_GYRO_DATA_ANALYSE
+    TABLE_DYN_NOTCH_FFT_SIZE,
+#endif
     LOOKUP_TABLE_COUNT
 } lookupTableIndex_e;
 
@@ -181,11 +189,24 @@ typedef struct clivalue_s {
     uint16_t offset;
 } __attribute__((packed)) clivalue_t;
 
+// Offset of the value in its PG, PROFILE_VALUE and PROFILE_RATE_VALUE values are those of the given profiles
+static inline uint16_t settingGetValueOffset(const clivalue_t *value, uint8_t pidProfileIndex, uint8_t rateProfileIndex)
+{
+    switch (value->type & VALUE_SECTION_MASK) {
+    case PROFILE_VALUE:
+        return value->offset + sizeof(pidProfile_t) * pidProfileIndex;
+    case PROFILE_RATE_VALUE:
+        return value->offset + sizeof(controlRateConfig_t) * rateProfileIndex;
+    default:
+        return value->offset;
+    }
+}
 
 extern const lookupTableEntry_t lookupTables[];
 extern const uint16_t valueTableEntryCount;
 
 extern const clivalue_t valueTable[];
+extern uint16_t valueTableNameIndex[];
 //extern const uint8_t lookupTablesEntryCount;
 
 extern const char * const lookupTableGyroHardware[];
@@ -58,7 +58,14 @@
     #define ONLY_EXPOSE_FOR_TESTING static
 #endif
 
+// Targets can define a larger cache in target.h, high rate logging benefits from more sectors to combine into one write
+#ifndef AFATFS_NUM_CACHE_SECTORS
+#if defined(STM32F4) || defined(STM32F7)
+#define AFATFS_NUM_CACHE_SECTORS 16
+#else
 #define AFATFS_NUM_CACHE_SECTORS 8
+#endif
+#endif
 
 // FAT filesystems are allowed to differ from these parameters, but we choose not to support those weird filesystems:
 #define AFATFS_SECTOR_SIZE  512
@@ -103,6 +110,8 @@
 #define AFATFS_CACHE_DISCARDABLE  8
 // Increase the retain counter of the cache sector to prevent it from being discarded when in the in-sync state
 #define AFATFS_CACHE_RETAIN       16
+// The sector holds directory entries, keep it cached in preference to file data (FAT sectors are recognised by index)
+#define AFATFS_CACHE_METADATA     32
 
 // Turn the largest free block on the disk into one contiguous file for efficient fragment-free allocation
 #define AFATFS_USE_FREEFILE
@@ -211,6 +220,12 @@ typedef struct afatfsCacheBlockDescriptor_t {
      * is overridden by the locked and retainCount flags.
      */
     unsigned discardable:1;
+
+    /*
+     * This block is a FAT or directory sector. These are evicted after file data, and written back after any dirty file
+     * data so that runs of data sectors can be combined into multi-block writes.
+     */
+    unsigned metadata:1;
 } afatfsCacheBlockDescriptor_t;
 
 typedef enum {
@@ -464,6 +479,12 @@ typedef struct afatfs_t {
     int cacheDirtyEntries; // The number of cache entries in the AFATFS_CACHE_STATE_DIRTY state
     bool cacheFlushInProgress;
 
+    // The multi-block write the card is in the middle of, so the next flush can continue it
+    uint32_t cacheWriteRunNextSector;
+    uint32_t cacheWriteRunRemaining;
+
+    afatfsCacheStats_t cacheStats;
+
     afatfsFile_t openFiles[AFATFS_MAX_OPEN_FILES];
 
 #ifdef AFATFS_USE_FREEFILE
@@ -635,6 +656,7 @@ static void afatfs_cacheSectorInit(afatfsCacheBlockDescriptor_t *descriptor, uin
     descriptor->locked = locked;
     descriptor->retainCount = 0;
     descriptor->discardable = 0;
+    descriptor->metadata = 0;
 }
 
 /**
@@ -694,53 +716,97 @@ static void afatfs_sdcardWriteComplete(sdcardBlockOperation_e operation, uint32_
     }
 }
 
+/**
+ * Find a sector in the cache which corresponds to the given physical sector index, or NULL if the sector isn't
+ * cached. Note that the cached sector could be in any state including completely empty.
+ */
+static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex)
+{
+    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
+        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
+            return &afatfs.cacheDescriptor[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Count the dirty, flushable sectors in the cache which are consecutive on disk starting from the given sector.
+ */
+static uint32_t afatfs_cacheDirtyRunLength(uint32_t sectorIndex)
+{
+    uint32_t runLength = 0;
+    afatfsCacheBlockDescriptor_t *descriptor;
+
+    while ((descriptor = afatfs_findCacheSector(sectorIndex + runLength)) != NULL
+        && descriptor->state == AFATFS_CACHE_STATE_DIRTY && !descriptor->locked) {
+        runLength++;
+    }
+
+    return runLength;
+}
+
 /**
  * Attempt to flush the dirty cache entry with the given index to the SDcard.
+ *
+ * If the sectors after it on disk are dirty too, they are written in the same multi-block write.
  */
 static void afatfs_cacheFlushSector(int cacheIndex)
 {
     afatfsCacheBlockDescriptor_t *cacheDescriptor = &afatfs.cacheDescriptor[cacheIndex];
 
+    const bool continuingRun = afatfs.cacheWriteRunRemaining > 0 && cacheDescriptor->sectorIndex == afatfs.cacheWriteRunNextSector;
+
+    if (!continuingRun) {
+        uint32_t blockCount = afatfs_cacheDirtyRunLength(cacheDescriptor->sectorIndex);
+        const bool combined = blockCount > 1;
+
 #ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
-    if (cacheDescriptor->consecutiveEraseBlockCount) {
-        sdcard_beginWriteBlocks(cacheDescriptor->sectorIndex, cacheDescriptor->consecutiveEraseBlockCount);
-    }
+        blockCount = MAX(blockCount, cacheDescriptor->consecutiveEraseBlockCount);
 #endif
 
+        afatfs.cacheWriteRunRemaining = 0;
+
+        if (blockCount > 1) {
+            if (sdcard_beginWriteBlocks(cacheDescriptor->sectorIndex, blockCount) != SDCARD_OPERATION_SUCCESS) {
+                return;
+            }
+
+            afatfs.cacheWriteRunNextSector = cacheDescriptor->sectorIndex;
+            afatfs.cacheWriteRunRemaining = blockCount;
+            if (combined) {
+                afatfs.cacheStats.combinedWrites++;
+            }
+        }
+    }
+
     switch (sdcard_writeBlock(cacheDescriptor->sectorIndex, afatfs_cacheSectorGetMemory(cacheIndex), afatfs_sdcardWriteComplete, 0)) {
         case SDCARD_OPERATION_IN_PROGRESS:
             // The card will call us back later when the buffer transmission finishes
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_WRITING;
             afatfs.cacheFlushInProgress = true;
+            afatfs.cacheStats.sectorsWritten++;
             break;
 
         case SDCARD_OPERATION_SUCCESS:
             // Buffer is already transmitted
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_IN_SYNC;
+            afatfs.cacheStats.sectorsWritten++;
             break;
 
         case SDCARD_OPERATION_BUSY:
         case SDCARD_OPERATION_FAILURE:
         default:
-            ;
+            return;
     }
-}
 
-/**
- * Find a sector in the cache which corresponds to the given physical sector index, or NULL if the sector isn't
- * cached. Note that the cached sector could be in any state including completely empty.
- */
-static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex)
-{
-    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
-            return &afatfs.cacheDescriptor[i];
-        }
+    if (afatfs.cacheWriteRunRemaining > 0) {
+        afatfs.cacheWriteRunNextSector = cacheDescriptor->sectorIndex + 1;
+        afatfs.cacheWriteRunRemaining--;
     }
-
-    return NULL;
 }
 
 /**
@@ -750,7 +816,8 @@ static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex
  * - The requested sector that already exists in the cache
  * - The index of an empty sector
  * - The index of a synced discardable sector
- * - The index of the oldest synced sector
+ * - The index of the oldest synced file data sector
+ * - The index of the oldest synced FAT or directory sector
  *
  * Otherwise it returns -1 to signal failure (cache is full!)
  */
@@ -761,6 +828,8 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
 
     uint32_t oldestSyncedSectorLastUse = 0xFFFFFFFF;
     int oldestSyncedSectorIndex = -1;
+    uint32_t oldestSyncedMetadataLastUse = 0xFFFFFFFF;
+    int oldestSyncedMetadataIndex = -1;
 
     if (
         !afatfs_assert(
@@ -796,6 +865,11 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
                 if (!afatfs.cacheDescriptor[i].locked && afatfs.cacheDescriptor[i].retainCount == 0) {
                     if (afatfs.cacheDescriptor[i].discardable) {
                         discardableIndex = i;
+                    } else if (afatfs.cacheDescriptor[i].metadata) {
+                        if (afatfs.cacheDescriptor[i].accessTimestamp < oldestSyncedMetadataLastUse) {
+                            oldestSyncedMetadataLastUse = afatfs.cacheDescriptor[i].accessTimestamp;
+                            oldestSyncedMetadataIndex = i;
+                        }
                     } else if (afatfs.cacheDescriptor[i].accessTimestamp < oldestSyncedSectorLastUse) {
                         // This is older than last block we decided to evict, so evict this one in preference
                         oldestSyncedSectorLastUse = afatfs.cacheDescriptor[i].accessTimestamp;
@@ -814,6 +888,8 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
         allocateIndex = discardableIndex;
     } else if (oldestSyncedSectorIndex > -1) {
         allocateIndex = oldestSyncedSectorIndex;
+    } else if (oldestSyncedMetadataIndex > -1) {
+        allocateIndex = oldestSyncedMetadataIndex;
     } else {
         allocateIndex = -1;
     }
@@ -826,26 +902,61 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
 }
 
 /**
- * Attempt to flush dirty cache pages out to the sdcard, returning true if all flushable data has been flushed.
+ * Choose the dirty cache entry to flush next, in descending order of preference:
+ *
+ * - The next sector of the multi-block write the card is in the middle of
+ * - The oldest dirty file data sector
+ * - The oldest dirty FAT or directory sector
+ *
+ * FAT and directory sectors are written ahead of file data when they're filling up the cache, so they can't starve
+ * file writes of cache entries.
+ *
+ * Returns -1 if there is nothing that can be flushed.
  */
-bool afatfs_flush(void)
+static int afatfs_cacheFindSectorToFlush(void)
 {
-    if (afatfs.cacheDirtyEntries > 0) {
-        // Flush the oldest flushable sector
-        uint32_t earliestSectorTime = 0xFFFFFFFF;
-        int earliestSectorIndex = -1;
+    uint32_t earliestDataTime = 0xFFFFFFFF, earliestMetadataTime = 0xFFFFFFFF;
+    int earliestDataIndex = -1, earliestMetadataIndex = -1;
 
-        for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && !afatfs.cacheDescriptor[i].locked
-                && (earliestSectorIndex == -1 || afatfs.cacheDescriptor[i].writeTimestamp < earliestSectorTime)
-            ) {
-                earliestSectorIndex = i;
-                earliestSectorTime = afatfs.cacheDescriptor[i].writeTimestamp;
+    for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
+        const afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[i];
+
+        if (descriptor->state != AFATFS_CACHE_STATE_DIRTY || descriptor->locked) {
+            continue;
+        }
+
+        if (afatfs.cacheWriteRunRemaining > 0 && descriptor->sectorIndex == afatfs.cacheWriteRunNextSector) {
+            return i;
+        }
+
+        if (descriptor->metadata) {
+            if (descriptor->writeTimestamp < earliestMetadataTime) {
+                earliestMetadataIndex = i;
+                earliestMetadataTime = descriptor->writeTimestamp;
             }
+        } else if (descriptor->writeTimestamp < earliestDataTime) {
+            earliestDataIndex = i;
+            earliestDataTime = descriptor->writeTimestamp;
         }
+    }
 
-        if (earliestSectorIndex > -1) {
-            afatfs_cacheFlushSector(earliestSectorIndex);
+    if (earliestMetadataIndex > -1 && (earliestDataIndex == -1 || afatfs.cacheDirtyEntries > AFATFS_NUM_CACHE_SECTORS / 2)) {
+        return earliestMetadataIndex;
+    }
+
+    return earliestDataIndex;
+}
+
+/**
+ * Attempt to flush dirty cache pages out to the sdcard, returning true if all flushable data has been flushed.
+ */
+bool afatfs_flush(void)
+{
+    if (afatfs.cacheDirtyEntries > 0) {
+        const int flushIndex = afatfs_cacheFindSectorToFlush();
+
+        if (flushIndex > -1) {
+            afatfs_cacheFlushSector(flushIndex);
 
             // That flush will take time to complete so we may as well tell caller to come back later
             return false;
@@ -929,6 +1040,17 @@ static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex,
         return AFATFS_OPERATION_IN_PROGRESS;
     }
 
+    afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[cacheSectorIndex];
+
+    if (descriptor->state == AFATFS_CACHE_STATE_EMPTY) {
+        afatfs.cacheStats.misses++;
+
+        descriptor->metadata = (sectorFlags & AFATFS_CACHE_METADATA) != 0
+            || (physicalSectorIndex >= afatfs.fatStartSector && physicalSectorIndex < afatfs.clusterStartSector);
+    } else if (descriptor->state != AFATFS_CACHE_STATE_READING) {
+        afatfs.cacheStats.hits++;
+    }
+
     switch (afatfs.cacheDescriptor[cacheSectorIndex].state) {
         case AFATFS_CACHE_STATE_READING:
             return AFATFS_OPERATION_IN_PROGRESS;
@@ -1456,7 +1578,7 @@ static afatfsOperationStatus_e afatfs_saveDirectoryEntry(afatfsFilePtr_t file, a
         return AFATFS_OPERATION_SUCCESS; // Root directories don't have a directory entry
     }
 
-    result = afatfs_cacheSector(file->directoryEntryPos.sectorNumberPhysical, &sector, AFATFS_CACHE_READ | AFATFS_CACHE_WRITE, 0);
+    result = afatfs_cacheSector(file->directoryEntryPos.sectorNumberPhysical, &sector, AFATFS_CACHE_READ | AFATFS_CACHE_WRITE | AFATFS_CACHE_METADATA, 0);
 
 #ifdef AFATFS_DEBUG_VERBOSE
     fprintf(stderr, "Saving directory entry to sector %u...\n", file->directoryEntryPos.sectorNumberPhysical);
@@ -1832,10 +1954,16 @@ static uint8_t* afatfs_fileRetainCursorSectorForRead(afatfsFilePtr_t file)
 
         afatfs_assert(physicalSector > 0); // We never read the root sector using files
 
+        uint8_t cacheFlags = AFATFS_CACHE_READ | AFATFS_CACHE_RETAIN;
+
+        if (file->type != AFATFS_FILE_TYPE_NORMAL) {
+            cacheFlags |= AFATFS_CACHE_METADATA;
+        }
+
         afatfsOperationStatus_e status = afatfs_cacheSector(
             physicalSector,
             &result,
-            AFATFS_CACHE_READ | AFATFS_CACHE_RETAIN,
+            cacheFlags,
             0
         );
 
@@ -2235,7 +2363,7 @@ static afatfsOperationStatus_e afatfs_extendSubdirectoryContinue(afatfsFile_t *d
             physicalSector = afatfs_fileGetCursorPhysicalSector(directory);
 
             while (1) {
-                status = afatfs_cacheSector(physicalSector, &sectorBuffer, AFATFS_CACHE_WRITE, 0);
+                status = afatfs_cacheSector(physicalSector, &sectorBuffer, AFATFS_CACHE_WRITE | AFATFS_CACHE_METADATA, 0);
 
                 if (status != AFATFS_OPERATION_SUCCESS) {
                     return status;
@@ -2663,7 +2791,7 @@ static void afatfs_createFileContinue(afatfsFile_t *file)
                 status = afatfs_cacheSector(
                     file->directoryEntryPos.sectorNumberPhysical,
                     &directorySector,
-                    AFATFS_CACHE_READ | AFATFS_CACHE_RETAIN,
+                    AFATFS_CACHE_READ | AFATFS_CACHE_RETAIN | AFATFS_CACHE_METADATA,
                     0
                 );
 
@@ -3049,6 +3177,7 @@ void afatfs_fputc(afatfsFilePtr_t file, uint8_t c)
     if (cacheIndex != -1 && cursorOffsetInSector != AFATFS_SECTOR_SIZE - 1) {
         afatfs_cacheSectorGetMemory(cacheIndex)[cursorOffsetInSector] = c;
         file->cursorOffset++;
+        afatfs.cacheStats.bytesWritten++;
     } else {
         // Slow path
         afatfs_fwrite(file, &c, sizeof(c));
@@ -3094,6 +3223,7 @@ uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len
         memcpy(sectorBuffer + cursorOffsetInSector, buffer, bytesToWriteThisSector);
 
         writtenBytes += bytesToWriteThisSector;
+        afatfs.cacheStats.bytesWritten += bytesToWriteThisSector;
 
         /*
          * If the seek doesn't complete immediately then we'll break and wait for that seek to complete by waiting for
@@ -3692,3 +3822,11 @@ uint32_t afatfs_getFreeBufferSpace(void)
     }
     return result;
 }
+
+/**
+ * Get the sector cache and card write counters since startup.
+ */
+const afatfsCacheStats_t *afatfs_getCacheStats(void)
+{
+    return &afatfs.cacheStats;
+}
@@ -60,6 +60,14 @@ typedef enum {
     AFATFS_SEEK_END
 } afatfsSeek_e;
 
+typedef struct afatfsCacheStats_s {
+    uint32_t hits;              // sector requests served from the cache
+    uint32_t misses;            // sector requests that needed a new cache entry
+    uint32_t sectorsWritten;    // sectors sent to the card
+    uint32_t combinedWrites;    // multi-block writes made from consecutive dirty sectors
+    uint32_t bytesWritten;      // bytes written by the application, for the write amplification
+} afatfsCacheStats_t;
+
 typedef void (*afatfsFileCallback_t)(afatfsFilePtr_t file);
 typedef void (*afatfsCallback_t)(void);
 
@@ -88,6 +96,7 @@ bool afatfs_destroy(bool dirty);
 void afatfs_poll(void);
 
 uint32_t afatfs_getFreeBufferSpace(void);
+const afatfsCacheStats_t *afatfs_getCacheStats(void);
 uint32_t afatfs_getContiguousFreeSpace(void);
 bool afatfs_isFull(void);
 
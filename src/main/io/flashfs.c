@@ -30,16 +30,86 @@
  *
  * In future, we can add support for multiple different flash chips by adding a flash device driver vtable
  * and make calls through that, at the moment flashfs just calls m25p16_* routines explicitly.
+ *
+ * The last sector of the device is reserved for a directory of the logs on the volume, see flashfsLogBegin().
+ *
+ * Erasing is done in the background a sector at a time by flashfsEraseUpdate(), see flashfsEraseCompletely().
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
 
+#include "common/crc.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
 #include "drivers/flash.h"
 
 #include "io/flashfs.h"
 
+/*
+ * Logs are found by the blackbox header at their start, used when the log directory has to be rebuilt
+ */
+#define FLASHFS_LOG_START_MARKER "H Product:Blackbox"
+#define FLASHFS_LOG_START_MARKER_LENGTH (sizeof(FLASHFS_LOG_START_MARKER) - 1)
+
+/*
+ * Free space is found, and new logs are started, on a boundary of this size.
+ */
+#define FLASHFS_FREE_BLOCK_SIZE 2048 // XXX This can't be smaller than page size for underlying flash device.
+
+#define FLASHFS_LOG_DIRECTORY_VERSION 1
+#define FLASHFS_LOG_DIRECTORY_TIMEOUT_MS 1000
+#define FLASHFS_ERASE_TIMEOUT_MS 3000
+
+typedef enum {
+    LOG_RECORD_HEADER = 0x4448,     // first record of the directory, offset holds the directory version
+    LOG_RECORD_BEGIN = 0x4742,      // a log starts at offset
+    LOG_RECORD_END = 0x4445,        // the open log ends at offset
+    LOG_RECORD_OVERFLOW = 0x564F,   // the directory is full, logs after this have to be found by scanning
+    LOG_RECORD_ERASE = 0x5245,      // the volume up to offset is being erased, data sectors beyond the last log are not
+    LOG_RECORD_ERASE_END = 0x4545,  // the erase is complete
+    LOG_RECORD_ERASED = 0xFFFF
+} flashfsLogRecordType_e;
+
+typedef struct flashfsLogRecord_s {
+    uint16_t type;
+    uint16_t crc;       // crc16_ccitt of the rest of the record
+    uint32_t offset;
+    uint32_t timestamp;
+    uint32_t reserved;
+} flashfsLogRecord_t;
+
+static struct {
+    flashfsLogEntry_t logs[FLASHFS_LOG_DIRECTORY_MAX_LOGS];
+    uint32_t sectorAddress;     // start of the reserved sector
+    uint32_t nextRecord;        // offset of the next erased record slot in the sector
+    uint16_t recordStride;      // a whole page on NAND, where a page can only be programmed once
+    uint16_t logCount;          // complete logs
+    bool logOpen;               // logs[logCount] has begun but not ended
+    bool valid;
+} logDirectory;
+
+typedef enum {
+    ERASE_IDLE = 0,
+    ERASE_DIRECTORY,    // erase the directory sector
+    ERASE_RECORD,       // record the erase in the new directory, so it is resumed after a power loss
+    ERASE_DATA,         // erase the data sectors one at a time
+} flashfsErasePhase_e;
+
+static struct {
+    flashfsErasePhase_e phase;
+    uint32_t start;     // the sectors [start, end) are erased, those before next already have been
+    uint32_t next;
+    uint32_t end;
+    uint32_t ahead;     // when not zero only the sectors this far ahead of the write position are erased
+    bool recorded;      // the erase is recorded in the log directory
+} eraseJob;
+
+STATIC_ASSERT(FLASHFS_WRITE_BUFFER_SIZE <= UINT16_MAX, FLASHFS_WRITE_BUFFER_SIZE_too_large);
+
 static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
 
 /* The position of our head and tail in the circular flash write buffer.
@@ -48,12 +118,21 @@ static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
  * oldest byte that has yet to be written to flash.
  *
  * When the circular buffer is empty, head == tail
+ *
+ * Asynchronous flushes only program whole pages, so the page at the tail goes to the chip in one program operation
+ * while the writer keeps filling the buffer behind it.
  */
-static uint8_t bufferHead = 0, bufferTail = 0;
+static uint16_t bufferHead = 0, bufferTail = 0;
 
 // The position of the buffer's tail in the overall flash address space:
 static uint32_t tailAddress = 0;
 
+// Pages that were ready to program but had to wait for the chip to finish the previous one
+static uint32_t stallCount;
+static bool stalled;
+// Asynchronous writes discarded because they didn't fit in the buffer
+static uint32_t droppedWriteCount;
+
 static void flashfsClearBuffer(void)
 {
     bufferTail = bufferHead = 0;
@@ -69,40 +148,179 @@ static void flashfsSetTailAddress(uint32_t address)
     tailAddress = address;
 }
 
-void flashfsEraseCompletely(void)
+static uint32_t flashfsTransmitBufferUsed(void);
+static uint32_t flashfsGetFlushThreshold(void);
+static void flashfsLogDirectoryAppend(flashfsLogRecordType_e type, uint32_t offset, uint32_t timestamp);
+
+static void flashfsLogDirectoryReset(void)
+{
+    logDirectory.nextRecord = 0;
+    logDirectory.logCount = 0;
+    logDirectory.logOpen = false;
+    logDirectory.valid = true;
+}
+
+static uint32_t flashfsRoundUpToSector(uint32_t address)
 {
-    flashEraseCompletely();
+    const uint32_t sectorSize = flashGetGeometry()->sectorSize;
 
+    return (address + sectorSize - 1) / sectorSize * sectorSize;
+}
+
+static uint32_t flashfsRoundUpToFreeBlock(uint32_t address)
+{
+    return MIN((address + FLASHFS_FREE_BLOCK_SIZE - 1) & ~(FLASHFS_FREE_BLOCK_SIZE - 1), flashfsGetSize());
+}
+
+/**
+ * Returns true if the bytes [start...end) can be programmed, i.e. no erase of them is outstanding.
+ */
+static bool flashfsRangeIsErased(uint32_t start, uint32_t end)
+{
+    switch (eraseJob.phase) {
+    case ERASE_IDLE:
+        return true;
+    case ERASE_DATA:
+        return MIN(end, eraseJob.end) <= eraseJob.next || start >= eraseJob.end;
+    default:
+        return end <= eraseJob.start || start >= eraseJob.end;
+    }
+}
+
+/**
+ * Erase the whole volume along with the log directory.
+ *
+ * The volume is empty as soon as this returns and can be written straight away, the sectors are erased in the
+ * background by flashfsEraseUpdate() and writes wait for the sector they are in. The directory sector goes first, then
+ * the erase is recorded in it so an erase cut short by a power loss is resumed by flashfsInit().
+ */
+void flashfsEraseCompletely(void)
+{
     flashfsClearBuffer();
 
     flashfsSetTailAddress(0);
+
+    // An erased directory sector is an empty directory, the header is written along with the first record
+    flashfsLogDirectoryReset();
+
+    eraseJob.phase = ERASE_DIRECTORY;
+    eraseJob.start = 0;
+    eraseJob.next = 0;
+    eraseJob.end = flashfsGetSize();
+    eraseJob.recorded = true;
 }
 
 /**
  * Start and end must lie on sector boundaries, or they will be rounded out to sector boundaries such that
  * all the bytes in the range [start...end) are erased.
+ *
+ * The sectors are erased in the background by flashfsEraseUpdate(). Returns false if another erase is in progress.
  */
-void flashfsEraseRange(uint32_t start, uint32_t end)
+bool flashfsEraseRange(uint32_t start, uint32_t end)
 {
     const flashGeometry_t *geometry = flashGetGeometry();
 
-    if (geometry->sectorSize <= 0)
-        return;
+    if (geometry->sectorSize <= 0 || eraseJob.phase != ERASE_IDLE)
+        return false;
+
+    // Round the start down to a sector boundary, and the end upward, but never erase the log directory
+    eraseJob.start = start / geometry->sectorSize * geometry->sectorSize;
+    eraseJob.next = eraseJob.start;
+    eraseJob.end = MIN(flashfsRoundUpToSector(end), flashfsGetSize());
+    eraseJob.recorded = false;
+
+    if (eraseJob.start < eraseJob.end) {
+        eraseJob.phase = ERASE_DATA;
+    }
+
+    return true;
+}
 
-    // Round the start down to a sector boundary
-    int startSector = start / geometry->sectorSize;
+/**
+ * Only erase the sectors that the next `length` bytes written will go to, or the whole range when zero.
+ *
+ * Logging keeps the erase ahead of itself this way rather than having the chip busy with sectors it doesn't need yet.
+ */
+void flashfsSetEraseAhead(uint32_t length)
+{
+    eraseJob.ahead = length;
+}
 
-    // And the end upward
-    int endSector = end / geometry->sectorSize;
-    int endRemainder = end % geometry->sectorSize;
+bool flashfsIsErasing(void)
+{
+    return eraseJob.phase != ERASE_IDLE;
+}
 
-    if (endRemainder > 0) {
-        endSector++;
+/**
+ * The percentage of the sectors being erased that are done.
+ */
+uint8_t flashfsGetEraseProgress(void)
+{
+    if (eraseJob.phase == ERASE_IDLE) {
+        return 100;
+    }
+    if (eraseJob.phase != ERASE_DATA || eraseJob.end == eraseJob.start) {
+        return 0;
     }
+    return (uint64_t)(eraseJob.next - eraseJob.start) * 100 / (eraseJob.end - eraseJob.start);
+}
 
-    for (int i = startSector; i < endSector; i++) {
-        flashEraseSector(i * geometry->sectorSize);
+/**
+ * Start the next step of the erase in progress if the chip is free, returns true when the erase has just completed.
+ *
+ * urgent: a write is waiting for the next sector, so erase it even if it is not yet needed or pages are buffered.
+ */
+static bool flashfsEraseStep(bool urgent)
+{
+    if (eraseJob.phase == ERASE_IDLE || !flashIsReady()) {
+        return false;
+    }
+
+    switch (eraseJob.phase) {
+    case ERASE_DIRECTORY:
+        flashEraseSector(logDirectory.sectorAddress);
+        eraseJob.phase = eraseJob.recorded ? ERASE_RECORD : ERASE_DATA;
+        return false;
+
+    case ERASE_RECORD:
+        flashfsLogDirectoryAppend(LOG_RECORD_ERASE, eraseJob.end, 0);
+        eraseJob.phase = ERASE_DATA;
+        return false;
+
+    default:
+        break;
     }
+
+    if (eraseJob.next < eraseJob.end) {
+        // Pages ready to be programmed go first, and with erase ahead only the sectors soon to be written are erased
+        const bool pagesReady = flashfsTransmitBufferUsed() >= flashfsGetFlushThreshold() && flashfsRangeIsErased(tailAddress, tailAddress + 1);
+        if (!urgent && (pagesReady || (eraseJob.ahead && eraseJob.next >= tailAddress + eraseJob.ahead))) {
+            return false;
+        }
+
+        flashEraseSector(eraseJob.next);
+        eraseJob.next += flashGetGeometry()->sectorSize;
+        return false;
+    }
+
+    // The last sector erase has finished
+    if (eraseJob.recorded) {
+        flashfsLogDirectoryAppend(LOG_RECORD_ERASE_END, eraseJob.end, 0);
+    }
+    eraseJob.phase = ERASE_IDLE;
+
+    return true;
+}
+
+/**
+ * Run the background erase, called periodically by a low priority task. Each call starts at most one sector erase, and
+ * never waits for the chip.
+ *
+ * Returns true when the erase has just completed.
+ */
+bool flashfsEraseUpdate(void)
+{
+    return flashfsEraseStep(false);
 }
 
 /**
@@ -112,7 +330,7 @@ bool flashfsIsReady(void)
 {
     // Check for flash chip existence first, then check if ready.
 
-    return (flashfsIsSupported() && flashIsReady());
+    return (flashfsIsSupported() && flashIsReady() && !flashfsIsErasing());
 }
 
 bool flashfsIsSupported(void)
@@ -120,9 +338,17 @@ bool flashfsIsSupported(void)
     return flashfsGetSize() > 0;
 }
 
+/**
+ * The size of the volume, which excludes the sector reserved for the log directory.
+ */
 uint32_t flashfsGetSize(void)
 {
-    return flashGetGeometry()->totalSize;
+    const flashGeometry_t *geometry = flashGetGeometry();
+
+    if (geometry->sectors > 1) {
+        return geometry->totalSize - geometry->sectorSize;
+    }
+    return geometry->totalSize;
 }
 
 static uint32_t flashfsTransmitBufferUsed(void)
@@ -133,6 +359,19 @@ static uint32_t flashfsTransmitBufferUsed(void)
     return FLASHFS_WRITE_BUFFER_SIZE - bufferTail + bufferHead;
 }
 
+/**
+ * The amount of buffered data worth an asynchronous program operation: the rest of the page at the tail address.
+ */
+static uint32_t flashfsGetFlushThreshold(void)
+{
+    const uint16_t pageSize = flashGetGeometry()->pageSize;
+
+    if (pageSize == 0) {
+        return FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN;
+    }
+    return MIN(pageSize - tailAddress % pageSize, FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN);
+}
+
 /**
  * Get the size of the largest single write that flashfs could ever accept without blocking or data loss.
  */
@@ -160,8 +399,9 @@ const flashGeometry_t* flashfsGetGeometry(void)
  *
  * In synchronous mode, waits for the flash to become ready before writing so that every byte requested can be written.
  *
- * In asynchronous mode, if the flash is busy, then the write is aborted and the routine returns immediately.
- * In this case the returned number of bytes written will be less than the total amount requested.
+ * In asynchronous mode, if the flash is busy, or the sector at the tail address is still to be erased, then the write is
+ * aborted and the routine returns immediately. In this case the returned number of bytes written will be less than
+ * the total amount requested. In synchronous mode the erase of that sector is done first.
  *
  * Modifies the supplied buffer pointers and sizes to reflect how many bytes remain in each of them.
  *
@@ -183,9 +423,22 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
         bytesTotal += bufferSizes[i];
     }
 
-    if (!sync && !flashIsReady()) {
+    if (sync) {
+        while (!flashfsRangeIsErased(tailAddress, tailAddress + bytesTotal)) {
+            if (!flashWaitForReady(FLASHFS_ERASE_TIMEOUT_MS)) {
+                return 0;
+            }
+            flashfsEraseStep(true);
+        }
+    } else if (!flashIsReady() || !flashfsRangeIsErased(tailAddress, tailAddress + 1)) {
+        // An asynchronous write programs part of a single page, which lies within one sector
+        if (!stalled && bytesTotal >= flashfsGetFlushThreshold()) {
+            stalled = true;
+            stallCount++;
+        }
         return 0;
     }
+    stalled = false;
 
     uint32_t bytesTotalRemaining = bytesTotal;
 
@@ -313,15 +566,22 @@ static void flashfsAdvanceTailInBuffer(uint32_t delta)
 /**
  * If the flash is ready to accept writes, flush the buffer to it.
  *
+ * force: false to leave a partial page in the buffer until the rest of the page has been written, true to write
+ *        whatever is buffered.
+ *
  * Returns true if all data in the buffer has been flushed to the device, or false if
  * there is still data to be written (call flush again later).
  */
-bool flashfsFlushAsync(void)
+bool flashfsFlushAsync(bool force)
 {
     if (flashfsBufferIsEmpty()) {
         return true; // Nothing to flush
     }
 
+    if (!force && flashfsTransmitBufferUsed() < flashfsGetFlushThreshold()) {
+        return false;
+    }
+
     uint8_t const * buffers[2];
     uint32_t bufferSizes[2];
     uint32_t bytesWritten;
@@ -374,24 +634,31 @@ void flashfsSeekRel(int32_t offset)
  */
 void flashfsWriteByte(uint8_t byte)
 {
+    if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_USABLE) {
+        droppedWriteCount++;
+        return;
+    }
+
     flashWriteBuffer[bufferHead++] = byte;
 
     if (bufferHead >= FLASHFS_WRITE_BUFFER_SIZE) {
         bufferHead = 0;
     }
 
-    if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
-        flashfsFlushAsync();
+    if (flashfsTransmitBufferUsed() >= flashfsGetFlushThreshold()) {
+        flashfsFlushAsync(false);
     }
 }
 
 /**
  * Write the given buffer to the flash either synchronously or asynchronously depending on the 'sync' parameter.
  *
- * If writing asynchronously, data will be silently discarded if the buffer overflows.
+ * If writing asynchronously, data will be discarded if the buffer overflows.
  * If writing synchronously, the routine will block waiting for the flash to become ready so will never drop data.
+ *
+ * Returns false if the data was discarded.
  */
-void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
+bool flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
 {
     uint8_t const * buffers[3];
     uint32_t bufferSizes[3];
@@ -407,7 +674,7 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
      * Would writing this data to our buffer cause our buffer to reach the flush threshold? If so try to write through
      * to the flash now
      */
-    if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
+    if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] >= flashfsGetFlushThreshold()) {
         uint32_t bytesWritten;
 
         // Attempt to write all three buffers through to the flash asynchronously
@@ -419,7 +686,7 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
 
             if (bufferSizes[2] == 0) {
                 // And we wrote all the data the user supplied! Job done!
-                return;
+                return true;
             }
         } else {
             // We only wrote a portion of the old data, so advance the tail to remove the bytes we did write from the buffer
@@ -434,12 +701,14 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
                 flashfsClearBuffer();
             } else {
                 /*
-                 * Silently drop the data the user asked to write (i.e. no-op) since we can't buffer it and they
+                 * Drop the data the user asked to write (i.e. no-op) since we can't buffer it and they
                  * requested async.
                  */
+                droppedWriteCount++;
+                return false;
             }
 
-            return;
+            return true;
         }
 
         // Fall through and add the remainder of the incoming data to our buffer
@@ -467,6 +736,18 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
 
         bufferHead = len;
     }
+
+    return true;
+}
+
+uint32_t flashfsGetStallCount(void)
+{
+    return stallCount;
+}
+
+uint32_t flashfsGetDroppedWriteCount(void)
+{
+    return droppedWriteCount;
 }
 
 /**
@@ -493,24 +774,24 @@ int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
 }
 
 /**
- * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ * Find the offset of the start of the free space on the device at or after the given offset (or the size of the
+ * device if it is full).
  */
-int flashfsIdentifyStartOfFreeSpace(void)
+static uint32_t flashfsScanForStartOfFreeSpace(uint32_t from)
 {
     /* Find the start of the free space on the device by examining the beginning of blocks with a binary search,
      * looking for ones that appear to be erased. We can achieve this with good accuracy because an erased block
      * is all bits set to 1, which pretty much never appears in reasonable size substrings of blackbox logs.
      *
-     * To do better we might write a volume header instead, which would mark how much free space remains. But keeping
-     * a header up to date while logging would incur more writes to the flash, which would consume precious write
-     * bandwidth and block more often.
+     * The log directory normally records where the free space starts, this search is the fallback for when the
+     * directory can't be trusted, and for finding the end of a log that was never closed.
      */
 
     enum {
         /* We can choose whatever power of 2 size we like, which determines how much wastage of free space we'll have
          * at the end of the last written data. But smaller blocksizes will require more searching.
          */
-        FREE_BLOCK_SIZE = 2048, // XXX This can't be smaller than page size for underlying flash device.
+        FREE_BLOCK_SIZE = FLASHFS_FREE_BLOCK_SIZE,
 
         /* We don't expect valid data to ever contain this many consecutive uint32_t's of all 1 bits: */
         FREE_BLOCK_TEST_SIZE_INTS = 4, // i.e. 16 bytes
@@ -524,7 +805,7 @@ int flashfsIdentifyStartOfFreeSpace(void)
         uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
     } testBuffer;
 
-    int left = 0; // Smallest block index in the search region
+    int left = from / FREE_BLOCK_SIZE; // Smallest block index in the search region
     int right = flashfsGetSize() / FREE_BLOCK_SIZE; // One past the largest block index in the search region
     int mid;
     int result = right;
@@ -563,6 +844,24 @@ int flashfsIdentifyStartOfFreeSpace(void)
     return result * FREE_BLOCK_SIZE;
 }
 
+/**
+ * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ *
+ * New logs start on a FLASHFS_FREE_BLOCK_SIZE boundary, so this is the end of the last log rounded up.
+ */
+int flashfsIdentifyStartOfFreeSpace(void)
+{
+    if (logDirectory.valid && !logDirectory.logOpen) {
+        if (logDirectory.logCount == 0) {
+            return 0;
+        }
+        const flashfsLogEntry_t *last = &logDirectory.logs[logDirectory.logCount - 1];
+        return flashfsRoundUpToFreeBlock(last->start + last->length);
+    }
+
+    return flashfsScanForStartOfFreeSpace(0);
+}
+
 /**
  * Returns true if the file pointer is at the end of the device.
  */
@@ -588,14 +887,307 @@ void flashfsClose(void)
     }
 }
 
+/*
+ * Log directory
+ *
+ * The reserved last sector holds an append only list of records, each programmed once into an erased slot: a header,
+ * then a begin record when a log starts and an end record when it is closed. The directory is read once at startup so
+ * the logs on the volume and the start of free space are known without scanning the volume.
+ *
+ * If the directory is found corrupt it is rebuilt by scanning the volume for log headers. A log left open by a power
+ * loss is closed at startup at the end of its data.
+ */
+
+static void flashfsLogRecordRead(uint32_t slot, flashfsLogRecord_t *record)
+{
+    if (flashReadBytes(logDirectory.sectorAddress + slot, (uint8_t *)record, sizeof(*record)) < (int)sizeof(*record)) {
+        record->type = LOG_RECORD_ERASED;
+    }
+}
+
+static uint16_t flashfsLogRecordCrc(const flashfsLogRecord_t *record)
+{
+    return crc16_ccitt_update(0, &record->offset, sizeof(*record) - offsetof(flashfsLogRecord_t, offset));
+}
+
+static void flashfsLogRecordProgram(flashfsLogRecordType_e type, uint32_t offset, uint32_t timestamp)
+{
+    flashfsLogRecord_t record = {
+        .type = type,
+        .offset = offset,
+        .timestamp = timestamp,
+        .reserved = 0xFFFFFFFF,
+    };
+    record.crc = flashfsLogRecordCrc(&record);
+
+    flashWaitForReady(FLASHFS_LOG_DIRECTORY_TIMEOUT_MS);
+    flashPageProgram(logDirectory.sectorAddress + logDirectory.nextRecord, (const uint8_t *)&record, sizeof(record));
+    logDirectory.nextRecord += logDirectory.recordStride;
+}
+
+static void flashfsLogDirectoryAppend(flashfsLogRecordType_e type, uint32_t offset, uint32_t timestamp)
+{
+    if (!logDirectory.valid) {
+        return;
+    }
+
+    if (logDirectory.nextRecord == 0) {
+        flashfsLogRecordProgram(LOG_RECORD_HEADER, FLASHFS_LOG_DIRECTORY_VERSION, 0);
+    }
+
+    // The last slot is kept for the overflow record
+    const bool full = logDirectory.nextRecord + 2 * logDirectory.recordStride > flashGetGeometry()->sectorSize
+        || (type == LOG_RECORD_BEGIN && logDirectory.logCount == FLASHFS_LOG_DIRECTORY_MAX_LOGS);
+    if (full) {
+        flashfsLogRecordProgram(LOG_RECORD_OVERFLOW, 0, 0);
+        logDirectory.valid = false;
+        return;
+    }
+
+    flashfsLogRecordProgram(type, offset, timestamp);
+}
+
+static void flashfsLogDirectoryBegin(uint32_t timestamp)
+{
+    if (!logDirectory.valid || logDirectory.logOpen) {
+        return;
+    }
+
+    const uint32_t start = flashfsGetOffset();
+
+    flashfsLogDirectoryAppend(LOG_RECORD_BEGIN, start, timestamp);
+
+    if (logDirectory.valid) {
+        flashfsLogEntry_t *log = &logDirectory.logs[logDirectory.logCount];
+        log->start = start;
+        log->length = 0;
+        log->timestamp = timestamp;
+        logDirectory.logOpen = true;
+    }
+}
+
+/**
+ * Record the start of a log at the next FLASHFS_FREE_BLOCK_SIZE boundary from the current write position.
+ *
+ * Returns false if the directory can't be written yet, because it is being erased or the chip is busy. Keep calling
+ * until it returns true.
+ */
+bool flashfsLogBegin(uint32_t timestamp)
+{
+    if (eraseJob.phase == ERASE_DIRECTORY || eraseJob.phase == ERASE_RECORD || !flashIsReady()) {
+        return false;
+    }
+
+    if (!logDirectory.logOpen) {
+        // A rebuild of the directory only looks for logs on free block boundaries
+        const uint32_t offset = flashfsGetOffset();
+        const uint32_t start = flashfsRoundUpToFreeBlock(offset);
+        if (start != offset) {
+            flashfsSeekAbs(start);
+        }
+    }
+
+    flashfsLogDirectoryBegin(timestamp);
+
+    return true;
+}
+
+/**
+ * Record the end of the current log at the current write position.
+ */
+void flashfsLogEnd(void)
+{
+    if (!logDirectory.valid || !logDirectory.logOpen) {
+        return;
+    }
+
+    // The directory must not claim data that isn't on the device yet
+    flashfsFlushSync();
+
+    const uint32_t end = flashfsGetOffset();
+
+    flashfsLogDirectoryAppend(LOG_RECORD_END, end, 0);
+
+    if (logDirectory.valid) {
+        logDirectory.logs[logDirectory.logCount].length = end - logDirectory.logs[logDirectory.logCount].start;
+        logDirectory.logCount++;
+        logDirectory.logOpen = false;
+    }
+}
+
+bool flashfsLogDirectoryIsValid(void)
+{
+    return logDirectory.valid;
+}
+
+int flashfsGetLogCount(void)
+{
+    return logDirectory.valid ? logDirectory.logCount : 0;
+}
+
+const flashfsLogEntry_t *flashfsGetLog(int index)
+{
+    return &logDirectory.logs[index];
+}
+
+/**
+ * Find the logs on the volume by their headers and write a new directory for them into the erased directory sector.
+ */
+static void flashfsLogDirectoryRebuild(void)
+{
+    const uint32_t limit = flashfsScanForStartOfFreeSpace(0);
+    uint8_t buffer[FLASHFS_LOG_START_MARKER_LENGTH];
+
+    flashfsLogDirectoryReset();
+
+    for (uint32_t offset = 0; offset < limit && logDirectory.valid; offset += FLASHFS_FREE_BLOCK_SIZE) {
+        flashReadBytes(offset, buffer, FLASHFS_LOG_START_MARKER_LENGTH);
+
+        if (memcmp(buffer, FLASHFS_LOG_START_MARKER, FLASHFS_LOG_START_MARKER_LENGTH) && offset != 0) {
+            continue;
+        }
+
+        if (logDirectory.logOpen) {
+            flashfsSetTailAddress(offset);
+            flashfsLogEnd();
+        }
+        flashfsSetTailAddress(offset);
+        flashfsLogDirectoryBegin(0);
+    }
+
+    if (logDirectory.logOpen) {
+        flashfsSetTailAddress(limit);
+        flashfsLogEnd();
+    }
+    flashfsSetTailAddress(0);
+}
+
+/**
+ * Replace a directory that can't be used, the sector is known to hold one so it is safe to erase.
+ */
+static void flashfsLogDirectoryReplace(void)
+{
+    flashEraseSector(logDirectory.sectorAddress);
+    flashfsLogDirectoryRebuild();
+}
+
+static bool flashfsLogDirectoryIsBlank(void)
+{
+    uint32_t buffer[16];
+
+    for (uint32_t offset = 0; offset < flashGetGeometry()->sectorSize; offset += sizeof(buffer)) {
+        if (flashReadBytes(logDirectory.sectorAddress + offset, (uint8_t *)buffer, sizeof(buffer)) < (int)sizeof(buffer)) {
+            return false;
+        }
+        for (unsigned i = 0; i < ARRAYLEN(buffer); i++) {
+            if (buffer[i] != 0xFFFFFFFF) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Loads the directory, returns the end of an erase that was in progress when the power went, or zero.
+ */
+static uint32_t flashfsLogDirectoryLoad(void)
+{
+    const flashGeometry_t *geometry = flashGetGeometry();
+    flashfsLogRecord_t record;
+    uint32_t eraseEnd = 0;
+
+    logDirectory.sectorAddress = flashfsGetSize();
+    logDirectory.recordStride = geometry->flashType == FLASH_TYPE_NAND ? geometry->pageSize : sizeof(flashfsLogRecord_t);
+    flashfsLogDirectoryReset();
+
+    flashfsLogRecordRead(0, &record);
+    if (record.type != LOG_RECORD_HEADER || record.crc != flashfsLogRecordCrc(&record)) {
+        if (!flashfsLogDirectoryIsBlank()) {
+            // A volume written before the directory existed reaches into its sector, leave the logs there alone and
+            // find the free space by scanning until the next full erase
+            logDirectory.valid = false;
+        } else if (flashfsScanForStartOfFreeSpace(0) != 0) {
+            // Erased along with the volume, or a volume written before the directory existed that stops short of it
+            flashfsLogDirectoryRebuild();
+        }
+        return 0;
+    }
+    if (record.offset != FLASHFS_LOG_DIRECTORY_VERSION) {
+        flashfsLogDirectoryReplace();
+        return 0;
+    }
+
+    uint32_t slot;
+    for (slot = logDirectory.recordStride; slot + logDirectory.recordStride <= geometry->sectorSize; slot += logDirectory.recordStride) {
+        flashfsLogRecordRead(slot, &record);
+
+        if (record.type == LOG_RECORD_ERASED) {
+            break;
+        }
+        if (record.type == LOG_RECORD_OVERFLOW) {
+            logDirectory.valid = false;
+            return 0;
+        }
+        if (record.type == LOG_RECORD_ERASE || record.type == LOG_RECORD_ERASE_END) {
+            if (record.crc != flashfsLogRecordCrc(&record)) {
+                flashfsLogDirectoryReplace();
+                return 0;
+            }
+            eraseEnd = record.type == LOG_RECORD_ERASE ? record.offset : 0;
+            continue;
+        }
+
+        flashfsLogEntry_t *log = &logDirectory.logs[logDirectory.logCount];
+        const bool recordValid = record.crc == flashfsLogRecordCrc(&record)
+            && ((record.type == LOG_RECORD_BEGIN && !logDirectory.logOpen && logDirectory.logCount < FLASHFS_LOG_DIRECTORY_MAX_LOGS)
+                || (record.type == LOG_RECORD_END && logDirectory.logOpen && record.offset >= log->start));
+        if (!recordValid) {
+            flashfsLogDirectoryReplace();
+            return 0;
+        }
+
+        if (record.type == LOG_RECORD_BEGIN) {
+            log->start = record.offset;
+            log->length = 0;
+            log->timestamp = record.timestamp;
+            logDirectory.logOpen = true;
+        } else {
+            log->length = record.offset - log->start;
+            logDirectory.logCount++;
+            logDirectory.logOpen = false;
+        }
+    }
+    logDirectory.nextRecord = slot;
+
+    if (logDirectory.logOpen) {
+        // The log was never closed, it ends where its data does
+        flashfsSetTailAddress(flashfsScanForStartOfFreeSpace(logDirectory.logs[logDirectory.logCount].start));
+        flashfsLogEnd();
+    }
+
+    return eraseEnd;
+}
+
 /**
  * Call after initializing the flash chip in order to set up the filesystem.
  */
 void flashfsInit(void)
 {
+    eraseJob.phase = ERASE_IDLE;
+    eraseJob.ahead = 0;
+
     // If we have a flash chip present at all
     if (flashfsGetSize() > 0) {
+        const uint32_t eraseEnd = flashfsLogDirectoryLoad();
+
         // Start the file pointer off at the beginning of free space so caller can start writing immediately
         flashfsSeekAbs(flashfsIdentifyStartOfFreeSpace());
+
+        // Logs are only written to erased sectors, so the sectors after the last one are the ones left to erase
+        if (eraseEnd > 0 && flashfsEraseRange(flashfsRoundUpToSector(flashfsGetOffset()), eraseEnd)) {
+            eraseJob.recorded = true;
+        }
     }
 }
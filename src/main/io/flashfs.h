@@ -20,14 +20,33 @@
 
 #pragma once
 
-#define FLASHFS_WRITE_BUFFER_SIZE 128
+// Targets logging at high rates can define a larger buffer in target.h, it should hold at least two flash pages
+#ifndef FLASHFS_WRITE_BUFFER_SIZE
+#if defined(STM32F4) || defined(STM32F7)
+#define FLASHFS_WRITE_BUFFER_SIZE 1024
+#else
+#define FLASHFS_WRITE_BUFFER_SIZE 256
+#endif
+#endif
 #define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
 
-// Automatically trigger a flush when this much data is in the buffer
-#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
+// Automatically trigger a flush when this much data is in the buffer, if it doesn't reach the end of a page first
+#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN (FLASHFS_WRITE_BUFFER_SIZE / 2)
+
+#define FLASHFS_LOG_DIRECTORY_MAX_LOGS 64
+
+typedef struct flashfsLogEntry_s {
+    uint32_t start;
+    uint32_t length;
+    uint32_t timestamp; // seconds since 1970, 0 if the time wasn't known when the log started
+} flashfsLogEntry_t;
 
 void flashfsEraseCompletely(void);
-void flashfsEraseRange(uint32_t start, uint32_t end);
+bool flashfsEraseRange(uint32_t start, uint32_t end);
+void flashfsSetEraseAhead(uint32_t length);
+bool flashfsEraseUpdate(void);
+bool flashfsIsErasing(void);
+uint8_t flashfsGetEraseProgress(void);
 
 uint32_t flashfsGetSize(void);
 uint32_t flashfsGetOffset(void);
@@ -41,16 +60,25 @@ void flashfsSeekAbs(uint32_t offset);
 void flashfsSeekRel(int32_t offset);
 
 void flashfsWriteByte(uint8_t byte);
-void flashfsWrite(const uint8_t *data, unsigned int len, bool sync);
+bool flashfsWrite(const uint8_t *data, unsigned int len, bool sync);
 
 int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
 
-bool flashfsFlushAsync(void);
+bool flashfsFlushAsync(bool force);
 void flashfsFlushSync(void);
 
+uint32_t flashfsGetStallCount(void);
+uint32_t flashfsGetDroppedWriteCount(void);
+
 void flashfsClose(void);
 void flashfsInit(void);
 bool flashfsIsSupported(void);
 
 bool flashfsIsReady(void);
 bool flashfsIsEOF(void);
+
+bool flashfsLogBegin(uint32_t timestamp);
+void flashfsLogEnd(void);
+bool flashfsLogDirectoryIsValid(void);
+int flashfsGetLogCount(void);
+const flashfsLogEntry_t *flashfsGetLog(int index);
@@ -119,6 +119,35 @@ static uint32_t blinkBits[(OSD_ITEM_COUNT + 31)/32];
 #define IS_BLINK(item) (blinkBits[(item) / 32] & (1 << ((item) % 32)))
 #define BLINK(item) (IS_BLINK(item) && blinkState)
 
+// Element cache
+//
+// Each element remembers what it last put on screen, so a refresh only writes the elements
+// whose content changed and blanks just the cells they vacate. Elements drawn under or over
+// a changed one are redrawn too, keeping the stacking of overlapping elements as it was.
+
+typedef struct osdElementCache_s {
+    uint32_t hash;      // of the drawn content and its position, 0 when nothing is on screen
+    int8_t x;           // area covered on screen
+    int8_t y;
+    uint8_t width;
+    uint8_t height;
+} osdElementCache_t;
+
+static osdElementCache_t osdElementCache[OSD_ITEM_COUNT];
+static bool osdScreenNeedsClear = true;
+
+#define OSD_ELEMENT_INACTIVE 0xff
+static uint8_t osdElementOrder[OSD_ITEM_COUNT];     // position in this refresh's drawing order
+static uint8_t osdActiveElements[OSD_ITEM_COUNT];
+static uint8_t osdActiveElementCount;
+static uint8_t osdCurrentOrder;
+static bool osdRedrawEarlierElements;
+
+static uint32_t redrawBits[(OSD_ITEM_COUNT + 31)/32];
+#define SET_REDRAW(item) (redrawBits[(item) / 32] |= (1 << ((item) % 32)))
+#define CLR_REDRAW(item) (redrawBits[(item) / 32] &= ~(1 << ((item) % 32)))
+#define IS_REDRAW(item) (redrawBits[(item) / 32] & (1 << ((item) % 32)))
+
 // Things in both OSD and CMS
 
 #define IS_HI(X)  (rcData[X] > 1750)
@@ -143,7 +172,6 @@ timeUs_t resumeRefreshAt = 0;
 #define REFRESH_1S    1000 * 1000
 
 static uint8_t armState;
-static bool lastArmState;
 
 static displayPort_t *osdDisplayPort;
 
@@ -449,9 +477,154 @@ bool osdWarnGetState(uint8_t warningIndex)
     return osdConfig()->enabledWarnings & (1 << warningIndex);
 }
 
+static uint32_t osdElementHash(uint32_t hash, const uint8_t *data, size_t length)
+{
+    // FNV-1a
+    while (length--) {
+        hash ^= *data++;
+        hash *= 16777619;
+    }
+    return hash ? hash : 1;
+}
+
+static uint32_t osdElementHashStart(uint16_t pos)
+{
+    return osdElementHash(2166136261U, (const uint8_t *)&pos, sizeof(pos));
+}
+
+static void osdInvalidateElements(void)
+{
+    memset(osdElementCache, 0, sizeof(osdElementCache));
+    memset(redrawBits, 0, sizeof(redrawBits));
+}
+
+// Marks the other elements sharing cells with the area for redrawing. Erasing damages the
+// elements on both sides of the stacking order, drawing only those meant to be on top.
+static void osdDamageArea(uint8_t item, int x, int y, int width, int height, bool erased)
+{
+    for (unsigned i = 0; i < OSD_ITEM_COUNT; i++) {
+        const osdElementCache_t *other = &osdElementCache[i];
+        if (i == item || !other->hash || osdElementOrder[i] == OSD_ELEMENT_INACTIVE) {
+            continue;
+        }
+        if (x >= other->x + other->width || other->x >= x + width || y >= other->y + other->height || other->y >= y + height) {
+            continue;
+        }
+
+        if (osdElementOrder[i] > osdCurrentOrder) {
+            SET_REDRAW(i);
+        } else if (erased) {
+            SET_REDRAW(i);
+            osdRedrawEarlierElements = true;
+        }
+    }
+}
+
+static void osdEraseCell(int x, int y)
+{
+    // off screen cells would land on the next row
+    if (x >= 0 && y >= 0 && x < osdDisplayPort->cols && y < osdDisplayPort->rows) {
+        displayWriteChar(osdDisplayPort, x, y, SYM_BLANK);
+    }
+}
+
+static void osdEraseSidebars(const osdElementCache_t *cache)
+{
+    const int8_t hudwidth = AH_SIDEBAR_WIDTH_POS;
+    const int8_t hudheight = AH_SIDEBAR_HEIGHT_POS;
+    const int x = cache->x + hudwidth;
+    const int y = cache->y + hudheight;
+
+    for (int dy = -hudheight; dy <= hudheight; dy++) {
+        osdEraseCell(x - hudwidth, y + dy);
+        osdEraseCell(x + hudwidth, y + dy);
+    }
+    osdEraseCell(x - hudwidth + 1, y);
+    osdEraseCell(x + hudwidth - 1, y);
+}
+
+// Position of the horizon line drawn in each column, in glyph steps from the top, -1 where a column is empty
+static int8_t ahDrawnY[AH_SYMBOL_COUNT];
+
+static void osdEraseElement(uint8_t item)
+{
+    osdElementCache_t *cache = &osdElementCache[item];
+
+    CLR_REDRAW(item);
+    if (!cache->hash) {
+        return;
+    }
+
+    switch (item) {
+    case OSD_ARTIFICIAL_HORIZON:
+        for (int i = 0; i < AH_SYMBOL_COUNT; i++) {
+            if (ahDrawnY[i] >= 0) {
+                osdEraseCell(cache->x + i, cache->y + ahDrawnY[i] / AH_SYMBOL_COUNT);
+            }
+        }
+        break;
+
+    case OSD_HORIZON_SIDEBARS:
+        osdEraseSidebars(cache);
+        break;
+
+    default:
+        for (int i = 0; i < cache->width; i++) {
+            osdEraseCell(cache->x + i, cache->y);
+        }
+        break;
+    }
+
+    osdDamageArea(item, cache->x, cache->y, cache->width, cache->height, true);
+    cache->hash = 0;
+}
+
+static void osdElementWrite(uint8_t item, uint8_t x, uint8_t y, const char *buff)
+{
+    osdElementCache_t *cache = &osdElementCache[item];
+    const int length = strlen(buff);
+    // the display drops what runs past the last column
+    const int width = MIN(length, MAX(osdDisplayPort->cols - x, 0));
+
+    if (!length) {
+        osdEraseElement(item);
+        return;
+    }
+
+    const uint32_t hash = osdElementHash(osdElementHashStart(osdConfig()->item_pos[item]), (const uint8_t *)buff, length);
+    if (hash == cache->hash && !IS_REDRAW(item)) {
+        return;
+    }
+    CLR_REDRAW(item);
+
+    // blank what the previous content covered and this doesn't
+    if (cache->hash) {
+        bool erased = false;
+        for (int i = cache->x; i < cache->x + cache->width; i++) {
+            if (cache->y != y || i < x || i >= x + width) {
+                osdEraseCell(i, cache->y);
+                erased = true;
+            }
+        }
+        if (erased) {
+            osdDamageArea(item, cache->x, cache->y, cache->width, 1, true);
+        }
+    }
+
+    displayWrite(osdDisplayPort, x, y, buff);
+    osdDamageArea(item, x, y, width, 1, false);
+
+    cache->hash = hash;
+    cache->x = x;
+    cache->y = y;
+    cache->width = width;
+    cache->height = 1;
+}
+
 static bool osdDrawSingleElement(uint8_t item)
 {
     if (!VISIBLE(osdConfig()->item_pos[item]) || BLINK(item)) {
+        osdEraseElement(item);
         return false;
     }
 
@@ -632,9 +805,6 @@ static bool osdDrawSingleElement(uint8_t item)
         }
 
     case OSD_CRAFT_NAME:
-        // This does not strictly support iterative updating if the craft name changes at run time. But since the craft name is not supposed to be changing this should not matter, and blanking the entire length of the craft name string on update will make it impossible to configure elements to be displayed on the right hand side of the craft name.
-        //TODO: When iterative updating is implemented, change this so the craft name is only printed once whenever the OSD 'flight' screen is entered.
-
         if (strlen(pilotConfig()->name) == 0) {
             strcpy(buff, "CRAFT_NAME");
         } else {
@@ -693,18 +863,62 @@ static bool osdDrawSingleElement(uint8_t item)
             }
             pitchAngle -= 41; // 41 = 4 * AH_SYMBOL_COUNT + 5
 
+            int8_t lineY[AH_SYMBOL_COUNT];
             for (int x = -4; x <= 4; x++) {
                 const int y = ((-rollAngle * x) / 64) - pitchAngle;
-                if (y >= 0 && y <= 81) {
-                    displayWriteChar(osdDisplayPort, elemPosX + x, elemPosY + (y / AH_SYMBOL_COUNT), (SYM_AH_BAR9_0 + (y % AH_SYMBOL_COUNT)));
+                lineY[x + 4] = (y >= 0 && y <= 81) ? y : -1;
+            }
+
+            osdElementCache_t *cache = &osdElementCache[item];
+            const uint32_t hash = osdElementHash(osdElementHashStart(osdConfig()->item_pos[item]), (const uint8_t *)lineY, sizeof(lineY));
+            if (hash == cache->hash && !IS_REDRAW(item)) {
+                return true;
+            }
+            const bool redraw = IS_REDRAW(item);
+            CLR_REDRAW(item);
+
+            if (cache->hash && (cache->x != elemPosX - 4 || cache->y != elemPosY)) {
+                osdEraseElement(item);
+            }
+
+            for (int i = 0; i < AH_SYMBOL_COUNT; i++) {
+                const int x = elemPosX - 4 + i;
+                if (cache->hash && ahDrawnY[i] >= 0 && (lineY[i] < 0 || ahDrawnY[i] / AH_SYMBOL_COUNT != lineY[i] / AH_SYMBOL_COUNT)) {
+                    const int y = cache->y + ahDrawnY[i] / AH_SYMBOL_COUNT;
+                    osdEraseCell(x, y);
+                    osdDamageArea(item, x, y, 1, 1, true);
+                }
+                if (lineY[i] >= 0 && (redraw || !cache->hash || lineY[i] != ahDrawnY[i])) {
+                    const int y = elemPosY + lineY[i] / AH_SYMBOL_COUNT;
+                    displayWriteChar(osdDisplayPort, x, y, SYM_AH_BAR9_0 + (lineY[i] % AH_SYMBOL_COUNT));
+                    osdDamageArea(item, x, y, 1, 1, false);
                 }
+                ahDrawnY[i] = lineY[i];
             }
 
+            cache->hash = hash;
+            cache->x = elemPosX - 4;
+            cache->y = elemPosY;
+            cache->width = AH_SYMBOL_COUNT;
+            cache->height = 81 / AH_SYMBOL_COUNT + 1;
+
             return true;
         }
 
     case OSD_HORIZON_SIDEBARS:
         {
+            // The sidebars never change, only their position does
+            osdElementCache_t *cache = &osdElementCache[item];
+            const uint32_t hash = osdElementHashStart(osdConfig()->item_pos[item]);
+            if (hash == cache->hash && !IS_REDRAW(item)) {
+                return true;
+            }
+            CLR_REDRAW(item);
+
+            if (hash != cache->hash) {
+                osdEraseElement(item);
+            }
+
             // Draw AH sides
             const int8_t hudwidth = AH_SIDEBAR_WIDTH_POS;
             const int8_t hudheight = AH_SIDEBAR_HEIGHT_POS;
@@ -717,6 +931,13 @@ static bool osdDrawSingleElement(uint8_t item)
             displayWriteChar(osdDisplayPort, elemPosX - hudwidth + 1, elemPosY, SYM_AH_LEFT);
             displayWriteChar(osdDisplayPort, elemPosX + hudwidth - 1, elemPosY, SYM_AH_RIGHT);
 
+            cache->hash = hash;
+            cache->x = elemPosX - hudwidth;
+            cache->y = elemPosY - hudheight;
+            cache->width = 2 * hudwidth + 1;
+            cache->height = 2 * hudheight + 1;
+            osdDamageArea(item, cache->x, cache->y, cache->width, cache->height, false);
+
             return true;
         }
 
@@ -891,6 +1112,16 @@ static bool osdDrawSingleElement(uint8_t item)
                 break;
             }
 
+#ifdef USE_FLASHFS
+            // Show the progress of a background flash erase before arming
+            if (osdWarnGetState(OSD_WARNING_FLASH_ERASE) && !ARMING_FLAG(ARMED) && flashfsIsErasing()) {
+                char eraseProgressMsg[OSD_FORMAT_MESSAGE_BUFFER_SIZE];
+                tfp_sprintf(eraseProgressMsg, "ERASE %3d%%", flashfsGetEraseProgress());
+                osdFormatMessage(buff, OSD_FORMAT_MESSAGE_BUFFER_SIZE, eraseProgressMsg);
+                break;
+            }
+#endif
+
             // Visual beeper
             if (osdWarnGetState(OSD_WARNING_VISUAL_BEEPER) && showVisualBeeper) {
                 osdFormatMessage(buff, OSD_FORMAT_MESSAGE_BUFFER_SIZE, "  * * * *");
@@ -950,10 +1181,6 @@ static bool osdDrawSingleElement(uint8_t item)
     case OSD_DISARMED:
         if (!ARMING_FLAG(ARMED)) {
             tfp_sprintf(buff, "DISARMED");
-        } else {
-            if (!lastArmState) {  // previously disarmed - blank out the message one time
-                tfp_sprintf(buff, "        ");
-            }
         }
         break;
 
@@ -1023,62 +1250,103 @@ static bool osdDrawSingleElement(uint8_t item)
 #endif
 
     default:
+        osdEraseElement(item);
         return false;
     }
 
-    displayWrite(osdDisplayPort, elemPosX, elemPosY, buff);
+    osdElementWrite(item, elemPosX, elemPosY, buff);
 
     return true;
 }
 
-static void osdDrawElements(void)
+static void osdAddActiveElement(uint8_t item)
 {
-    displayClearScreen(osdDisplayPort);
+    osdElementOrder[item] = osdActiveElementCount;
+    osdActiveElements[osdActiveElementCount++] = item;
+}
 
-    // Hide OSD when OSDSW mode is active
-    if (IS_RC_MODE_ACTIVE(BOXOSD)) {
-        return;
+static void osdDrawElements(void)
+{
+    if (osdScreenNeedsClear) {
+        displayClearScreen(osdDisplayPort);
+        osdScreenNeedsClear = false;
     }
 
-    if (sensors(SENSOR_ACC)) {
-        osdDrawSingleElement(OSD_ARTIFICIAL_HORIZON);
-        osdDrawSingleElement(OSD_G_FORCE);
+    // Whoever cleared the screen took the elements with it
+    if (osdDisplayPort->cleared) {
+        osdInvalidateElements();
+        osdDisplayPort->cleared = false;
     }
 
+    memset(osdElementOrder, OSD_ELEMENT_INACTIVE, sizeof(osdElementOrder));
+    osdActiveElementCount = 0;
 
-    for (unsigned i = 0; i < sizeof(osdElementDisplayOrder); i++) {
-        osdDrawSingleElement(osdElementDisplayOrder[i]);
-    }
+    // Hide OSD when OSDSW mode is active
+    if (!IS_RC_MODE_ACTIVE(BOXOSD)) {
+        if (sensors(SENSOR_ACC)) {
+            osdAddActiveElement(OSD_ARTIFICIAL_HORIZON);
+            osdAddActiveElement(OSD_G_FORCE);
+        }
+
+        for (unsigned i = 0; i < sizeof(osdElementDisplayOrder); i++) {
+            osdAddActiveElement(osdElementDisplayOrder[i]);
+        }
 
 #ifdef USE_GPS
-    if (sensors(SENSOR_GPS)) {
-        osdDrawSingleElement(OSD_GPS_SATS);
-        osdDrawSingleElement(OSD_GPS_SPEED);
-        osdDrawSingleElement(OSD_GPS_LAT);
-        osdDrawSingleElement(OSD_GPS_LON);
-        osdDrawSingleElement(OSD_HOME_DIST);
-        osdDrawSingleElement(OSD_HOME_DIR);
-    }
+        if (sensors(SENSOR_GPS)) {
+            osdAddActiveElement(OSD_GPS_SATS);
+            osdAddActiveElement(OSD_GPS_SPEED);
+            osdAddActiveElement(OSD_GPS_LAT);
+            osdAddActiveElement(OSD_GPS_LON);
+            osdAddActiveElement(OSD_HOME_DIST);
+            osdAddActiveElement(OSD_HOME_DIR);
+        }
 #endif // GPS
 
 #ifdef USE_ESC_SENSOR
-    if (feature(FEATURE_ESC_SENSOR)) {
-        osdDrawSingleElement(OSD_ESC_TMP);
-        osdDrawSingleElement(OSD_ESC_RPM);
-    }
+        if (feature(FEATURE_ESC_SENSOR)) {
+            osdAddActiveElement(OSD_ESC_TMP);
+            osdAddActiveElement(OSD_ESC_RPM);
+        }
 #endif
 
 #ifdef USE_RTC_TIME
-    osdDrawSingleElement(OSD_RTC_DATETIME);
+        osdAddActiveElement(OSD_RTC_DATETIME);
 #endif
 
 #ifdef USE_OSD_ADJUSTMENTS
-    osdDrawSingleElement(OSD_ADJUSTMENT_RANGE);
+        osdAddActiveElement(OSD_ADJUSTMENT_RANGE);
 #endif
 
 #ifdef USE_ADC_INTERNAL
-    osdDrawSingleElement(OSD_CORE_TEMPERATURE);
+        osdAddActiveElement(OSD_CORE_TEMPERATURE);
 #endif
+    }
+
+    // Elements no longer drawn give up their cells before anything is drawn over them
+    osdCurrentOrder = 0;
+    for (unsigned i = 0; i < OSD_ITEM_COUNT; i++) {
+        if (osdElementOrder[i] == OSD_ELEMENT_INACTIVE && osdElementCache[i].hash) {
+            osdEraseElement(i);
+        }
+    }
+    osdRedrawEarlierElements = false;
+
+    for (unsigned i = 0; i < osdActiveElementCount; i++) {
+        osdCurrentOrder = i;
+        osdDrawSingleElement(osdActiveElements[i]);
+    }
+
+    // Erasing reached elements drawn before, repaint those in order so the stacking holds
+    if (osdRedrawEarlierElements) {
+        for (unsigned i = 0; i < osdActiveElementCount; i++) {
+            const uint8_t item = osdActiveElements[i];
+            if (IS_REDRAW(item)) {
+                osdCurrentOrder = i;
+                osdDrawSingleElement(item);
+            }
+        }
+    }
 }
 
 void pgResetFn_osdConfig(osdConfig_t *osdConfig)
@@ -1159,6 +1427,7 @@ void osdInit(displayPort_t *osdDisplayPortToUse)
     memset(blinkBits, 0, sizeof(blinkBits));
 
     displayClearScreen(osdDisplayPort);
+    osdScreenNeedsClear = true;
 
     osdDrawLogo(3, 1);
 
@@ -1374,8 +1643,7 @@ static void osdGetBlackboxStatusString(char * buff)
     case BLACKBOX_DEVICE_FLASH:
         storageDeviceIsWorking = flashfsIsSupported();
         if (storageDeviceIsWorking) {
-            const flashGeometry_t *geometry = flashfsGetGeometry();
-            storageTotal = geometry->totalSize / 1024;
+            storageTotal = flashfsGetSize() / 1024;
             storageUsed = flashfsGetOffset() / 1024;
         }
         break;
@@ -1423,6 +1691,7 @@ static void osdShowStats(uint16_t endBatteryVoltage)
     char buff[OSD_ELEMENT_BUFFER_LENGTH];
 
     displayClearScreen(osdDisplayPort);
+    osdScreenNeedsClear = true;
     displayWrite(osdDisplayPort, 2, top++, "  --- STATS ---");
 
     if (osdStatGetState(OSD_STAT_RTC_DATE_TIME)) {
@@ -1500,6 +1769,13 @@ static void osdShowStats(uint16_t endBatteryVoltage)
     if (osdStatGetState(OSD_STAT_BLACKBOX) && blackboxConfig()->device && blackboxConfig()->device != BLACKBOX_DEVICE_SERIAL) {
         osdGetBlackboxStatusString(buff);
         osdDisplayStatisticLabel(top++, "BLACKBOX", buff);
+
+        const uint32_t droppedFrames = blackboxGetDroppedFrameCount();
+        const uint32_t stalls = blackboxGetDeviceStallCount();
+        if (droppedFrames || stalls) {
+            tfp_sprintf(buff, "%u/%u", droppedFrames, stalls);
+            osdDisplayStatisticLabel(top++, "BB DROP/STALL", buff);
+        }
     }
 
     if (osdStatGetState(OSD_STAT_BLACKBOX_NUMBER) && blackboxConfig()->device && blackboxConfig()->device != BLACKBOX_DEVICE_SERIAL) {
@@ -1512,6 +1788,7 @@ static void osdShowStats(uint16_t endBatteryVoltage)
 static void osdShowArmed(void)
 {
     displayClearScreen(osdDisplayPort);
+    osdScreenNeedsClear = true;
     displayWrite(osdDisplayPort, 12, 7, "ARMED");
 }
 
@@ -1603,7 +1880,12 @@ STATIC_UNIT_TESTED void osdRefresh(timeUs_t currentTimeUs)
         osdDrawElements();
         displayHeartbeat(osdDisplayPort);
     }
-    lastArmState = ARMING_FLAG(ARMED);
+#ifdef USE_CMS
+    else {
+        // whatever the menu leaves behind goes before the elements are back
+        osdScreenNeedsClear = true;
+    }
+#endif
 }
 
 /*
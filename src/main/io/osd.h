@@ -163,6 +163,7 @@ typedef enum {
     OSD_WARNING_ESC_FAIL,
     OSD_WARNING_CORE_TEMPERATURE,
     OSD_WARNING_RC_SMOOTHING,
+    OSD_WARNING_FLASH_ERASE,
     OSD_WARNING_COUNT // MUST BE LAST
 } osdWarningsFlags_e;
 
@@ -26,6 +26,7 @@
 
 #include "build/build_config.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "pg/pg.h"
@@ -512,6 +513,22 @@ static void nopConsumer(uint8_t data)
     UNUSED(data);
 }
 
+// Moves what has been received, as far as the other side has room for it
+static void serialPassthroughSpan(serialPort_t *from, serialPort_t *to, serialConsumer *consumer)
+{
+    uint8_t buf[64];
+
+    const uint32_t count = serialReadBuf(from, buf, MIN(sizeof(buf), serialTxBytesFree(to)));
+    if (count) {
+        LED0_ON;
+        serialWriteBuf(to, buf, count);
+        for (uint32_t i = 0; i < count; i++) {
+            consumer(buf[i]);
+        }
+        LED0_OFF;
+    }
+}
+
 /*
  A high-level serial passthrough implementation. Used by cli to start an
  arbitrary serial passthrough "proxy". Optional callbacks can be given to allow
@@ -531,31 +548,15 @@ void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *
     LED1_OFF;
 
     // Either port might be open in a mode other than MODE_RXTX. We rely on
-    // serialRxBytesWaiting() to do the right thing for a TX only port. No
+    // serialReadBuf() to do the right thing for a TX only port. No
     // special handling is necessary OR performed.
     while (1) {
         // TODO: maintain a timestamp of last data received. Use this to
         // implement a guard interval and check for `+++` as an escape sequence
         // to return to CLI command mode.
         // https://en.wikipedia.org/wiki/Escape_sequence#Modem_control
-        if (serialRxBytesWaiting(left)) {
-            LED0_ON;
-            uint8_t c = serialRead(left);
-            // Make sure there is space in the tx buffer
-            while (!serialTxBytesFree(right));
-            serialWrite(right, c);
-            leftC(c);
-            LED0_OFF;
-         }
-         if (serialRxBytesWaiting(right)) {
-             LED0_ON;
-             uint8_t c = serialRead(right);
-             // Make sure there is space in the tx buffer
-             while (!serialTxBytesFree(left));
-             serialWrite(left, c);
-             rightC(c);
-             LED0_OFF;
-         }
+        serialPassthroughSpan(left, right, leftC);
+        serialPassthroughSpan(right, left, rightC);
      }
  }
  #endif
@@ -22,8 +22,10 @@
  * Author: jflyper@github.com
  */
 
+#include "common/maths.h"
 #include "common/utils.h"
 #include "common/printf.h"
+#include "common/time.h"
 
 #include "emfat.h"
 #include "emfat_file.h"
@@ -277,23 +279,44 @@ static char logNames[EMFAT_MAX_LOG_ENTRY][8+3];
 
 emfat_t emfat;
 
-static void emfat_add_log(emfat_entry_t *entry, int number, uint32_t offset, uint32_t size)
+static void emfat_add_log(emfat_entry_t *entry, int number, uint32_t offset, uint32_t size, uint32_t timestamp)
 {
     tfp_sprintf(logNames[number], "EMUF_%03d.BBL", number + 1);
 
+    uint32_t cmaTime = CMA_TIME;
+#ifdef USE_RTC_TIME
+    if (timestamp) {
+        dateTime_t dt;
+        rtcTimeToDateTime(&dt, rtcTimeMake(timestamp, 0));
+        cmaTime = emfat_encode_cma_time(dt.day, dt.month, dt.year, dt.hours, dt.minutes, dt.seconds);
+    }
+#else
+    UNUSED(timestamp);
+#endif
+
     entry->name = logNames[number];
     entry->level = 1;
     entry->offset = offset;
     entry->curr_size = size;
     entry->max_size = entry->curr_size;
-    entry->cma_time[0] = CMA_TIME;
-    entry->cma_time[1] = CMA_TIME;
-    entry->cma_time[2] = CMA_TIME;
+    entry->cma_time[0] = cmaTime;
+    entry->cma_time[1] = cmaTime;
+    entry->cma_time[2] = cmaTime;
     entry->readcb = bblog_read_proc;
 }
 
 static int emfat_find_log(emfat_entry_t *entry, int maxCount)
 {
+    if (flashfsLogDirectoryIsValid()) {
+        const int logCount = MIN(flashfsGetLogCount(), maxCount);
+        for (int i = 0; i < logCount; i++) {
+            const flashfsLogEntry_t *log = flashfsGetLog(i);
+            emfat_add_log(entry++, i, log->start, log->length, log->timestamp);
+        }
+        return logCount;
+    }
+
+    // No directory, find the logs by their headers
     uint32_t limit  = flashfsIdentifyStartOfFreeSpace();
     uint32_t lastOffset = 0;
     uint32_t currOffset = 0;
@@ -310,7 +333,7 @@ static int emfat_find_log(emfat_entry_t *entry, int maxCount)
         }
 
         if (lastOffset != currOffset) {
-            emfat_add_log(entry, fileNumber, lastOffset, currOffset - lastOffset);
+            emfat_add_log(entry, fileNumber, lastOffset, currOffset - lastOffset, 0);
 
             ++fileNumber;
             ++logCount;
@@ -324,7 +347,7 @@ static int emfat_find_log(emfat_entry_t *entry, int maxCount)
     }
 
     if (fileNumber != maxCount && lastOffset != currOffset) {
-        emfat_add_log(entry, fileNumber, lastOffset, currOffset - lastOffset);
+        emfat_add_log(entry, fileNumber, lastOffset, currOffset - lastOffset, 0);
         ++logCount;
     }
     return logCount;
@@ -24,6 +24,7 @@
 #include "platform.h"
 #include "build/debug.h"
 #include "common/streambuf.h"
+#include "common/maths.h"
 #include "common/utils.h"
 #include "common/crc.h"
 #include "drivers/system.h"
@@ -41,6 +42,17 @@
 
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
 
+// replies and stream frames are built here, one at a time
+static uint8_t mspSerialOutBuf[MSP_PORT_OUTBUF_SIZE];
+
+// at most this many stream frames are sent per call of mspSerialProcess(), bounding the time the MSP task takes
+#define MSP_STREAM_FRAMES_PER_PROCESS 4
+// largest header and checksum mspSerialEncode() adds to a frame
+#define MSP_STREAM_FRAME_OVERHEAD 18
+
+// port of the command being processed
+static mspPort_t *mspSerialCommandPort;
+
 static void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort, bool sharedWithTelemetry)
 {
     memset(mspPortToReset, 0, sizeof(mspPort_t));
@@ -258,6 +270,42 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint32_t c)
     return true;
 }
 
+// Reads as much of the payload as has arrived straight into the input buffer, never past the end of the frame
+static bool mspSerialReceivePayload(mspPort_t *mspPort)
+{
+    mspState_e checksumState;
+
+    switch (mspPort->c_state) {
+    case MSP_PAYLOAD_V1:
+        checksumState = MSP_CHECKSUM_V1;
+        break;
+    case MSP_PAYLOAD_V2_OVER_V1:
+        checksumState = MSP_CHECKSUM_V2_OVER_V1;
+        break;
+    case MSP_PAYLOAD_V2_NATIVE:
+        checksumState = MSP_CHECKSUM_V2_NATIVE;
+        break;
+    default:
+        return false;
+    }
+
+    uint8_t *payload = &mspPort->inBuf[mspPort->offset];
+    const uint32_t count = serialReadBuf(mspPort->port, payload, mspPort->dataSize - mspPort->offset);
+
+    if (mspPort->c_state != MSP_PAYLOAD_V2_NATIVE) {
+        mspPort->checksum1 = crc8_xor_update(mspPort->checksum1, payload, count);
+    }
+    if (mspPort->c_state != MSP_PAYLOAD_V1) {
+        mspPort->checksum2 = crc8_dvb_s2_update(mspPort->checksum2, payload, count);
+    }
+    mspPort->offset += count;
+    if (mspPort->offset == mspPort->dataSize) {
+        mspPort->c_state = checksumState;
+    }
+
+    return true;
+}
+
 static uint8_t mspSerialChecksumBuf(uint8_t checksum, const uint8_t *data, int len)
 {
     while (len-- > 0) {
@@ -382,10 +430,8 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
 
 static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
 {
-    static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
-
     mspPacket_t reply = {
-        .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
+        .buf = { .ptr = mspSerialOutBuf, .end = ARRAYEND(mspSerialOutBuf), },
         .cmd = -1,
         .flags = 0,
         .result = 0,
@@ -402,7 +448,9 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     };
 
     mspPostProcessFnPtr mspPostProcessFn = NULL;
+    mspSerialCommandPort = msp;
     const mspResult_e status = mspProcessCommandFn(&command, &reply, &mspPostProcessFn);
+    mspSerialCommandPort = NULL;
 
     if (status != MSP_RESULT_NO_REPLY) {
         sbufSwitchToReader(&reply.buf, outBufHead); // change streambuf direction
@@ -412,6 +460,73 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     return mspPostProcessFn;
 }
 
+/*
+ * Send the frames of an active stream for as long as the port's transmit buffer has room for them.
+ */
+static void mspSerialProcessStream(mspPort_t *msp)
+{
+    for (int i = 0; i < MSP_STREAM_FRAMES_PER_PROCESS; i++) {
+        const int bytesFree = (int)serialTxBytesFree(msp->port) - MSP_STREAM_FRAME_OVERHEAD;
+        if (bytesFree <= 0) {
+            return;
+        }
+
+        mspPacket_t packet = {
+            .buf = { .ptr = mspSerialOutBuf, .end = mspSerialOutBuf + MIN(bytesFree, (int)sizeof(mspSerialOutBuf)), },
+            .cmd = -1,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+
+        switch (msp->streamFn(&packet)) {
+        case MSP_STREAM_SEND:
+            sbufSwitchToReader(&packet.buf, mspSerialOutBuf);
+            mspSerialEncode(msp, &packet, msp->streamVersion);
+            break;
+        case MSP_STREAM_DONE:
+            msp->streamFn = NULL;
+            return;
+        case MSP_STREAM_WAIT:
+        default:
+            return;
+        }
+    }
+}
+
+/*
+ * Largest stream frame payload the port of the command being processed can take in one piece. A stream only sends
+ * a frame once the port has room for all of it, so bigger frames would never be sent. 0 outside of a command.
+ */
+uint16_t mspSerialStreamPayloadMax(void)
+{
+    if (!mspSerialCommandPort) {
+        return 0;
+    }
+    const uint32_t txBufferSize = serialTxBufferSize(mspSerialCommandPort->port);
+    if (txBufferSize <= MSP_STREAM_FRAME_OVERHEAD) {
+        return 0;
+    }
+    return MIN(txBufferSize - MSP_STREAM_FRAME_OVERHEAD, sizeof(mspSerialOutBuf));
+}
+
+/*
+ * Attach a stream of replies to the MSP port on serialPort, in the MSP version of the last command received on it.
+ * A stream runs on one port at a time, so starting it again moves it to the new port.
+ */
+void mspSerialStartStream(serialPort_t *serialPort, mspStreamFnPtr streamFn)
+{
+    for (uint8_t portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t *mspPort = &mspPorts[portIndex];
+        if (mspPort->port == serialPort) {
+            mspPort->streamFn = streamFn;
+            mspPort->streamVersion = mspPort->mspVersion;
+        } else if (mspPort->streamFn == streamFn) {
+            mspPort->streamFn = NULL;
+        }
+    }
+}
+
 static void mspEvaluateNonMspData(mspPort_t * mspPort, uint8_t receivedChar)
 {
 #ifdef USE_CLI
@@ -492,6 +607,10 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
             mspPort->pendingRequest = MSP_PENDING_NONE;
 
             while (serialRxBytesWaiting(mspPort->port)) {
+                if (mspSerialReceivePayload(mspPort)) {
+                    continue;
+                }
+
                 const uint8_t c = serialRead(mspPort->port);
                 const bool consumed = mspSerialProcessReceivedData(mspPort, c);
 
@@ -519,6 +638,10 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
         else {
             mspProcessPendingRequest(mspPort);
         }
+
+        if (mspPort->streamFn) {
+            mspSerialProcessStream(mspPort);
+        }
     }
 }
 
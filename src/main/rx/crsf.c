@@ -46,6 +46,8 @@
 #include "rx/rx.h"
 #include "rx/crsf.h"
 
+#include "scheduler/scheduler.h"
+
 #include "telemetry/crsf.h"
 
 #define CRSF_TIME_NEEDED_PER_FRAME_US   1100 // 700 ms + 400 ms for potential ad-hoc request
@@ -62,6 +64,8 @@ STATIC_UNIT_TESTED uint32_t crsfChannelData[CRSF_MAX_CHANNEL];
 
 static serialPort_t *serialPort;
 static uint32_t crsfFrameStartAtUs = 0;
+static uint8_t crsfFramePosition = 0;
+static timeUs_t crsfRcFrameTimeUs = 0;
 static uint8_t telemetryBuf[CRSF_FRAME_SIZE_MAX];
 static uint8_t telemetryBufLen = 0;
 
@@ -124,37 +128,21 @@ STATIC_UNIT_TESTED uint8_t crsfFrameCRC(void)
     return crc;
 }
 
-// Receive ISR callback, called back from serial port
-STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
+static void crsfDataProcess(uint8_t c)
 {
-    UNUSED(data);
-
-    static uint8_t crsfFramePosition = 0;
-    const uint32_t currentTimeUs = micros();
-
-#ifdef DEBUG_CRSF_PACKETS
-    debug[2] = currentTimeUs - crsfFrameStartAtUs;
-#endif
-
-    if (currentTimeUs > crsfFrameStartAtUs + CRSF_TIME_NEEDED_PER_FRAME_US) {
-        // We've received a character after max time needed to complete a frame,
-        // so this must be the start of a new frame.
-        crsfFramePosition = 0;
-    }
-
-    if (crsfFramePosition == 0) {
-        crsfFrameStartAtUs = currentTimeUs;
-    }
     // assume frame is 5 bytes long until we have received the frame length
     // full frame length includes the length of the address and framelength fields
     const int fullFrameLength = crsfFramePosition < 3 ? 5 : crsfFrame.frame.frameLength + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH;
 
     if (crsfFramePosition < fullFrameLength) {
-        crsfFrame.bytes[crsfFramePosition++] = (uint8_t)c;
+        crsfFrame.bytes[crsfFramePosition++] = c;
         crsfFrameDone = crsfFramePosition < fullFrameLength ? false : true;
         if (crsfFrameDone) {
             crsfFramePosition = 0;
-            if (crsfFrame.frame.type != CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+            schedulerSignalTask(TASK_RX);
+            if (crsfFrame.frame.type == CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+                crsfRcFrameTimeUs = crsfFrameStartAtUs;
+            } else {
                 const uint8_t crc = crsfFrameCRC();
                 if (crc == crsfFrame.bytes[fullFrameLength - 1]) {
                     switch (crsfFrame.frame.type)
@@ -188,6 +176,50 @@ STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
     }
 }
 
+// Receive ISR callback, called back from serial port
+STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
+{
+    UNUSED(data);
+
+    const uint32_t currentTimeUs = micros();
+
+#ifdef DEBUG_CRSF_PACKETS
+    debug[2] = currentTimeUs - crsfFrameStartAtUs;
+#endif
+
+    if (currentTimeUs > crsfFrameStartAtUs + CRSF_TIME_NEEDED_PER_FRAME_US) {
+        // We've received a character after max time needed to complete a frame,
+        // so this must be the start of a new frame.
+        crsfFramePosition = 0;
+    }
+
+    if (crsfFramePosition == 0) {
+        crsfFrameStartAtUs = currentTimeUs;
+    }
+
+    crsfDataProcess((uint8_t)c);
+}
+
+// Idle line ISR callback, the serial port hands over everything received before the line went quiet
+STATIC_UNIT_TESTED void crsfFrameReceive(const uint8_t *data, uint16_t length, const uint8_t *wrapData, uint16_t wrapLength, timeUs_t frameTimeUs, void *callbackData)
+{
+    UNUSED(callbackData);
+
+    crsfFramePosition = 0;
+    crsfFrameStartAtUs = frameTimeUs;
+
+    for (int i = 0; i < length + wrapLength; i++) {
+        crsfDataProcess(i < length ? data[i] : wrapData[i - length]);
+    }
+}
+
+static timeUs_t crsfFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    UNUSED(rxRuntimeConfig);
+
+    return crsfRcFrameTimeUs;
+}
+
 STATIC_UNIT_TESTED uint8_t crsfFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
 {
     UNUSED(rxRuntimeConfig);
@@ -265,6 +297,7 @@ bool crsfRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 
     rxRuntimeConfig->rcReadRawFn = crsfReadRawRC;
     rxRuntimeConfig->rcFrameStatusFn = crsfFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = crsfFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
@@ -280,6 +313,10 @@ bool crsfRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
         CRSF_PORT_OPTIONS | (rxConfig->serialrx_inverted ? SERIAL_INVERTED : 0)
         );
 
+    if (serialPort) {
+        serialSetIdleCallback(serialPort, crsfFrameReceive);
+    }
+
     return serialPort != NULL;
 }
 
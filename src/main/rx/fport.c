@@ -130,6 +130,7 @@ static const smartPortPayload_t emptySmartPortFrame = { .frameId = 0, .valueId =
 typedef struct fportBuffer_s {
     uint8_t data[BUFFER_SIZE];
     uint8_t length;
+    timeUs_t frameTimeUs;
 } fportBuffer_t;
 
 static fportBuffer_t rxBuffer[NUM_RX_BUFFERS];
@@ -141,9 +142,13 @@ static volatile timeUs_t lastTelemetryFrameReceivedUs;
 static volatile bool clearToSend = false;
 
 static volatile uint8_t framePosition = 0;
+static timeUs_t frameStartAt = 0;
+static bool escapedCharacter = false;
+static bool telemetryFrame = false;
 
 static smartPortPayload_t *mspPayload = NULL;
 static timeUs_t lastRcFrameReceivedMs = 0;
+static timeUs_t lastRcFrameTimeUs = 0;
 
 static serialPort_t *fportPort;
 #ifdef USE_TELEMETRY_SMARTPORT
@@ -159,33 +164,16 @@ static void reportFrameError(uint8_t errorReason) {
     DEBUG_SET(DEBUG_FPORT, DEBUG_FPORT_FRAME_LAST_ERROR, errorReason);
 }
 
-// Receive ISR callback
-static void fportDataReceive(uint16_t c, void *data)
+static void fportDataProcess(uint8_t val, timeUs_t currentTimeUs)
 {
-    UNUSED(data);
-
-    static timeUs_t frameStartAt = 0;
-    static bool escapedCharacter = false;
     static timeUs_t lastFrameReceivedUs = 0;
-    static bool telemetryFrame = false;
-
-    const timeUs_t currentTimeUs = micros();
-
-    clearToSend = false;
-
-    if (framePosition > 1 && cmpTimeUs(currentTimeUs, frameStartAt) > FPORT_TIME_NEEDED_PER_FRAME_US + 500) {
-        reportFrameError(DEBUG_FPORT_ERROR_TIMEOUT);
-
-        framePosition = 0;
-     }
-
-    uint8_t val = (uint8_t)c;
 
     if (val == FPORT_FRAME_MARKER) {
         if (framePosition > 1) {
             const uint8_t nextWriteIndex = (rxBufferWriteIndex + 1) % NUM_RX_BUFFERS;
             if (nextWriteIndex != rxBufferReadIndex) {
                 rxBuffer[rxBufferWriteIndex].length = framePosition - 1;
+                rxBuffer[rxBufferWriteIndex].frameTimeUs = currentTimeUs;
                 rxBufferWriteIndex = nextWriteIndex;
             }
 
@@ -228,6 +216,44 @@ static void fportDataReceive(uint16_t c, void *data)
     }
 }
 
+// Receive ISR callback
+static void fportDataReceive(uint16_t c, void *data)
+{
+    UNUSED(data);
+
+    const timeUs_t currentTimeUs = micros();
+
+    clearToSend = false;
+
+    if (framePosition > 1 && cmpTimeUs(currentTimeUs, frameStartAt) > FPORT_TIME_NEEDED_PER_FRAME_US + 500) {
+        reportFrameError(DEBUG_FPORT_ERROR_TIMEOUT);
+
+        framePosition = 0;
+     }
+
+    fportDataProcess((uint8_t)c, currentTimeUs);
+}
+
+// Idle line ISR callback, the serial port hands over everything received before the line went quiet
+static void fportFrameReceive(const uint8_t *data, uint16_t length, const uint8_t *wrapData, uint16_t wrapLength, timeUs_t frameTimeUs, void *callbackData)
+{
+    UNUSED(callbackData);
+
+    clearToSend = false;
+    framePosition = 0;
+
+    for (int i = 0; i < length + wrapLength; i++) {
+        fportDataProcess(i < length ? data[i] : wrapData[i - length], frameTimeUs);
+    }
+}
+
+static timeUs_t fportFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    UNUSED(rxRuntimeConfig);
+
+    return lastRcFrameTimeUs;
+}
+
 #if defined(USE_TELEMETRY_SMARTPORT)
 static void smartPortWriteFrameFport(const smartPortPayload_t *payload)
 {
@@ -285,6 +311,7 @@ static uint8_t fportFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
                         setRssi(scaleRange(frame->data.controlData.rssi, 0, 100, 0, RSSI_MAX_VALUE), RSSI_SOURCE_RX_PROTOCOL);
 
                         lastRcFrameReceivedMs = millis();
+                        lastRcFrameTimeUs = rxBuffer[rxBufferReadIndex].frameTimeUs;
                     }
 
                     break;
@@ -400,6 +427,7 @@ bool fportRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 
     rxRuntimeConfig->rcFrameStatusFn = fportFrameStatus;
     rxRuntimeConfig->rcProcessFrameFn = fportProcessFrame;
+    rxRuntimeConfig->rcFrameTimeUsFn = fportFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
@@ -416,6 +444,8 @@ bool fportRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
     );
 
     if (fportPort) {
+        serialSetIdleCallback(fportPort, fportFrameReceive);
+
 #if defined(USE_TELEMETRY_SMARTPORT)
         telemetryEnabled = initSmartPortTelemetryExternal(smartPortWriteFrameFport);
 #endif
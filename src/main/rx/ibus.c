@@ -69,7 +69,9 @@ static uint8_t ibusChannelOffset;
 static uint8_t rxBytesToIgnore;
 static uint16_t ibusChecksum;
 
+static uint8_t ibusFramePosition;
 static bool ibusFrameDone = false;
+static timeUs_t ibusFrameTimeUs;
 static uint32_t ibusChannelData[IBUS_MAX_CHANNEL];
 
 static uint8_t ibus[IBUS_BUFFSIZE] = { 0, };
@@ -81,6 +83,39 @@ static bool isValidIa6bIbusPacketLength(uint8_t length)
 }
 
 
+// Returns true when c completes a frame
+static bool ibusDataProcess(uint8_t c, timeUs_t currentTimeUs)
+{
+    if (ibusFramePosition == 0) {
+        if (isValidIa6bIbusPacketLength(c)) {
+            ibusModel = IBUS_MODEL_IA6B;
+            ibusSyncByte = c;
+            ibusFrameSize = c;
+            ibusChannelOffset = 2;
+            ibusChecksum = 0xFFFF;
+        } else if ((ibusSyncByte == 0) && (c == 0x55)) {
+            ibusModel = IBUS_MODEL_IA6;
+            ibusSyncByte = 0x55;
+            ibusFrameSize = 31;
+            ibusChecksum = 0x0000;
+            ibusChannelOffset = 1;
+        } else if (ibusSyncByte != c) {
+            return false;
+        }
+    }
+
+    ibus[ibusFramePosition] = (uint8_t)c;
+
+    if (ibusFramePosition == ibusFrameSize - 1) {
+        ibusFrameDone = true;
+        ibusFrameTimeUs = currentTimeUs;
+        return true;
+    }
+
+    ibusFramePosition++;
+    return false;
+}
+
 // Receive ISR callback
 static void ibusDataReceive(uint16_t c, void *data)
 {
@@ -88,7 +123,6 @@ static void ibusDataReceive(uint16_t c, void *data)
 
     uint32_t ibusTime;
     static uint32_t ibusTimeLast;
-    static uint8_t ibusFramePosition;
 
     ibusTime = micros();
 
@@ -102,31 +136,29 @@ static void ibusDataReceive(uint16_t c, void *data)
 
     ibusTimeLast = ibusTime;
 
-    if (ibusFramePosition == 0) {
-        if (isValidIa6bIbusPacketLength(c)) {
-            ibusModel = IBUS_MODEL_IA6B;
-            ibusSyncByte = c;
-            ibusFrameSize = c;
-            ibusChannelOffset = 2;
-            ibusChecksum = 0xFFFF;
-        } else if ((ibusSyncByte == 0) && (c == 0x55)) {
-            ibusModel = IBUS_MODEL_IA6;
-            ibusSyncByte = 0x55;
-            ibusFrameSize = 31;
-            ibusChecksum = 0x0000;
-            ibusChannelOffset = 1;
-        } else if (ibusSyncByte != c) {
-            return;
+    ibusDataProcess((uint8_t)c, ibusTime);
+}
+
+// Idle line ISR callback, the serial port hands over everything received before the line went quiet
+static void ibusFrameReceive(const uint8_t *data, uint16_t length, const uint8_t *wrapData, uint16_t wrapLength, timeUs_t frameTimeUs, void *callbackData)
+{
+    UNUSED(callbackData);
+
+    ibusFramePosition = 0;
+
+    // Anything after the first frame would overwrite its last byte
+    for (int i = 0; i < length + wrapLength; i++) {
+        if (ibusDataProcess(i < length ? data[i] : wrapData[i - length], frameTimeUs)) {
+            break;
         }
     }
+}
 
-    ibus[ibusFramePosition] = (uint8_t)c;
+static timeUs_t ibusGetFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    UNUSED(rxRuntimeConfig);
 
-    if (ibusFramePosition == ibusFrameSize - 1) {
-        ibusFrameDone = true;
-    } else {
-        ibusFramePosition++;
-    }
+    return ibusFrameTimeUs;
 }
 
 
@@ -208,6 +240,7 @@ bool ibusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 
     rxRuntimeConfig->rcReadRawFn = ibusReadRawRC;
     rxRuntimeConfig->rcFrameStatusFn = ibusFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = ibusGetFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
@@ -232,6 +265,11 @@ bool ibusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
         (rxConfig->serialrx_inverted ? SERIAL_INVERTED : 0) | (rxConfig->halfDuplex || portShared ? SERIAL_BIDIR : 0)
         );
 
+    // Telemetry on a shared port reads the receive buffer itself
+    if (ibusPort && !portShared) {
+        serialSetIdleCallback(ibusPort, ibusFrameReceive);
+    }
+
 #if defined(USE_TELEMETRY) && defined(USE_TELEMETRY_IBUS)
     if (portShared) {
         initSharedIbusTelemetry(ibusPort);
@@ -89,6 +89,8 @@ static bool rxIsInFailsafeMode = true;
 static uint8_t rxChannelCount;
 
 static timeUs_t rxNextUpdateAtUs = 0;
+static timeUs_t rxFrameTimeUs = 0;
+static timeDelta_t rxFrameDeltaUs = 0;
 static uint32_t needRxSignalBefore = 0;
 static uint32_t needRxSignalMaxDelayUs;
 static uint32_t suspendRxSignalUntil = 0;
@@ -240,6 +242,7 @@ void rxInit(void)
     rxRuntimeConfig.rcReadRawFn = nullReadRawRC;
     rxRuntimeConfig.rcFrameStatusFn = nullFrameStatus;
     rxRuntimeConfig.rcProcessFrameFn = nullProcessFrame;
+    rxRuntimeConfig.rcFrameTimeUsFn = NULL;
     rcSampleIndex = 0;
     needRxSignalMaxDelayUs = DELAY_10_HZ;
 
@@ -274,6 +277,7 @@ void rxInit(void)
             featureClear(FEATURE_RX_SERIAL);
             rxRuntimeConfig.rcReadRawFn = nullReadRawRC;
             rxRuntimeConfig.rcFrameStatusFn = nullFrameStatus;
+            rxRuntimeConfig.rcFrameTimeUsFn = NULL;
         }
     }
 #endif
@@ -292,6 +296,7 @@ void rxInit(void)
             featureClear(FEATURE_RX_SPI);
             rxRuntimeConfig.rcReadRawFn = nullReadRawRC;
             rxRuntimeConfig.rcFrameStatusFn = nullFrameStatus;
+            rxRuntimeConfig.rcFrameTimeUsFn = NULL;
         }
     }
 #endif
@@ -380,6 +385,12 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
                 needRxSignalBefore = currentTimeUs + needRxSignalMaxDelayUs;
             }
 
+            if (rxRuntimeConfig.rcFrameTimeUsFn) {
+                const timeUs_t frameTimeUs = rxRuntimeConfig.rcFrameTimeUsFn(&rxRuntimeConfig);
+                rxFrameDeltaUs = cmpTimeUs(frameTimeUs, rxFrameTimeUs);
+                rxFrameTimeUs = frameTimeUs;
+            }
+
             if (frameStatus & (RX_FRAME_FAILSAFE | RX_FRAME_DROPPED)) {
             	// No (0%) signal
             	setRssi(0, RSSI_SOURCE_FRAME_ERRORS);
@@ -701,6 +712,12 @@ uint16_t rxGetRefreshRate(void)
     return rxRuntimeConfig.rxRefreshRate;
 }
 
+// Time between the last two frames as timestamped by the receiver driver, 0 if it doesn't
+timeDelta_t rxGetFrameDelta(void)
+{
+    return rxRuntimeConfig.rcFrameTimeUsFn ? rxFrameDeltaUs : 0;
+}
+
 bool isRssiConfigured(void)
 {
     return rssiSource != RSSI_SOURCE_NONE;
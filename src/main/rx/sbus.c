@@ -44,6 +44,8 @@
 #include "rx/sbus.h"
 #include "rx/sbus_channels.h"
 
+#include "scheduler/scheduler.h"
+
 /*
  * Observations
  *
@@ -102,12 +104,34 @@ typedef union sbusFrame_u {
 typedef struct sbusFrameData_s {
     sbusFrame_t frame;
     uint32_t startAtUs;
+    timeUs_t frameTimeUs;
     uint16_t stateFlags;
     uint8_t position;
     bool done;
 } sbusFrameData_t;
 
 
+static bool sbusDataProcess(sbusFrameData_t *sbusFrameData, uint8_t c)
+{
+    if (sbusFrameData->position == 0 && c != SBUS_FRAME_BEGIN_BYTE) {
+        return false;
+    }
+
+    if (sbusFrameData->position < SBUS_FRAME_SIZE) {
+        sbusFrameData->frame.bytes[sbusFrameData->position++] = c;
+        if (sbusFrameData->position < SBUS_FRAME_SIZE) {
+            sbusFrameData->done = false;
+        } else {
+            sbusFrameData->frameTimeUs = sbusFrameData->startAtUs;
+            sbusFrameData->done = true;
+            schedulerSignalTask(TASK_RX);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // Receive ISR callback
 static void sbusDataReceive(uint16_t c, void *data)
 {
@@ -128,17 +152,31 @@ static void sbusDataReceive(uint16_t c, void *data)
         sbusFrameData->startAtUs = nowUs;
     }
 
-    if (sbusFrameData->position < SBUS_FRAME_SIZE) {
-        sbusFrameData->frame.bytes[sbusFrameData->position++] = (uint8_t)c;
-        if (sbusFrameData->position < SBUS_FRAME_SIZE) {
-            sbusFrameData->done = false;
-        } else {
-            sbusFrameData->done = true;
-            DEBUG_SET(DEBUG_SBUS, DEBUG_SBUS_FRAME_TIME, sbusFrameTime);
-        }
+    if (sbusDataProcess(sbusFrameData, c)) {
+        DEBUG_SET(DEBUG_SBUS, DEBUG_SBUS_FRAME_TIME, sbusFrameTime);
+    }
+}
+
+// Idle line ISR callback, the serial port hands over everything received before the line went quiet
+static void sbusFrameReceive(const uint8_t *data, uint16_t length, const uint8_t *wrapData, uint16_t wrapLength, timeUs_t frameTimeUs, void *callbackData)
+{
+    sbusFrameData_t *sbusFrameData = callbackData;
+
+    sbusFrameData->position = 0;
+    sbusFrameData->startAtUs = frameTimeUs;
+
+    for (int i = 0; i < length + wrapLength; i++) {
+        sbusDataProcess(sbusFrameData, i < length ? data[i] : wrapData[i - length]);
     }
 }
 
+static timeUs_t sbusFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    const sbusFrameData_t *sbusFrameData = rxRuntimeConfig->frameData;
+
+    return sbusFrameData->frameTimeUs;
+}
+
 static uint8_t sbusFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
 {
     sbusFrameData_t *sbusFrameData = rxRuntimeConfig->frameData;
@@ -176,6 +214,7 @@ bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
     rxRuntimeConfig->rxRefreshRate = 11000;
 
     rxRuntimeConfig->rcFrameStatusFn = sbusFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = sbusFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
@@ -197,6 +236,11 @@ bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
         SBUS_PORT_OPTIONS | (rxConfig->serialrx_inverted ? 0 : SERIAL_INVERTED) | (rxConfig->halfDuplex ? SERIAL_BIDIR : 0)
         );
 
+    // Telemetry on a shared port reads the receive buffer itself
+    if (sBusPort && !portShared) {
+        serialSetIdleCallback(sBusPort, sbusFrameReceive);
+    }
+
     if (rxConfig->rssi_src_frame_errors) {
         rssiSource = RSSI_SOURCE_FRAME_ERRORS;
     }
@@ -53,6 +53,11 @@ static FAST_RAM_ZERO_INIT uint32_t totalWaitingTasksSamples;
 static FAST_RAM_ZERO_INIT bool calculateTaskStatistics;
 FAST_RAM_ZERO_INIT uint16_t averageSystemLoadPercent = 0;
 
+static FAST_RAM_ZERO_INIT schedulerMode_e schedulerMode;
+// one bit per task, set by schedulerSignalTask(), possibly from interrupt context
+static volatile uint32_t signalledTasks;
+STATIC_ASSERT(TASK_COUNT <= 32, too_many_tasks_for_signal_mask);
+
 
 static FAST_RAM_ZERO_INIT int taskQueuePos = 0;
 STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT int taskQueueSize = 0;
@@ -61,11 +66,117 @@ STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT int taskQueueSize = 0;
 
 STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT cfTask_t* taskQueueArray[TASK_COUNT + 1]; // extra item for NULL pointer at end of queue
 
+// Queued tasks below TASK_PRIORITY_REALTIME are also kept in a binary min-heap on deadlineAt.
+// Membership follows the queue, the keys are only maintained in SCHEDULER_MODE_EDF.
+
+STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT cfTask_t* taskHeap[TASK_COUNT];
+STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT int taskHeapSize = 0;
+
+static bool isRealtimeTask(const cfTask_t *task)
+{
+    return task->staticPriority >= TASK_PRIORITY_REALTIME;
+}
+
+static FAST_CODE bool heapContains(const cfTask_t *task)
+{
+    return task->heapIndex < taskHeapSize && taskHeap[task->heapIndex] == task;
+}
+
+static FAST_CODE void heapSet(int index, cfTask_t *task)
+{
+    taskHeap[index] = task;
+    task->heapIndex = index;
+}
+
+static FAST_CODE void heapSiftUp(int index)
+{
+    cfTask_t *task = taskHeap[index];
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (cmpTimeUs(taskHeap[parent]->deadlineAt, task->deadlineAt) <= 0) {
+            break;
+        }
+        heapSet(index, taskHeap[parent]);
+        index = parent;
+    }
+    heapSet(index, task);
+}
+
+static FAST_CODE void heapSiftDown(int index)
+{
+    cfTask_t *task = taskHeap[index];
+    while (true) {
+        int child = 2 * index + 1;
+        if (child >= taskHeapSize) {
+            break;
+        }
+        if (child + 1 < taskHeapSize && cmpTimeUs(taskHeap[child + 1]->deadlineAt, taskHeap[child]->deadlineAt) < 0) {
+            child++;
+        }
+        if (cmpTimeUs(task->deadlineAt, taskHeap[child]->deadlineAt) <= 0) {
+            break;
+        }
+        heapSet(index, taskHeap[child]);
+        index = child;
+    }
+    heapSet(index, task);
+}
+
+static FAST_CODE void heapSetDeadline(cfTask_t *task, timeUs_t deadlineAt)
+{
+    const timeUs_t previousDeadlineAt = task->deadlineAt;
+    task->deadlineAt = deadlineAt;
+    if (cmpTimeUs(deadlineAt, previousDeadlineAt) < 0) {
+        heapSiftUp(task->heapIndex);
+    } else {
+        heapSiftDown(task->heapIndex);
+    }
+}
+
+// Adds the task keeping its deadlineAt
+static FAST_CODE void heapPush(cfTask_t *task)
+{
+    heapSet(taskHeapSize, task);
+    ++taskHeapSize;
+    heapSiftUp(taskHeapSize - 1);
+}
+
+static void heapInsert(cfTask_t *task)
+{
+    task->deadlineAt = task->lastExecutedAt + task->desiredPeriod;
+    heapPush(task);
+}
+
+static FAST_CODE void heapRemove(cfTask_t *task)
+{
+    if (!heapContains(task)) {
+        return;
+    }
+    const int index = task->heapIndex;
+    cfTask_t *lastTask = taskHeap[--taskHeapSize];
+    if (lastTask != task) {
+        heapSet(index, lastTask);
+        heapSiftUp(index);
+        heapSiftDown(lastTask->heapIndex);
+    }
+}
+
+static void heapRebuild(void)
+{
+    for (int ii = 0; ii < taskHeapSize; ++ii) {
+        taskHeap[ii]->deadlineAt = taskHeap[ii]->lastExecutedAt + taskHeap[ii]->desiredPeriod;
+    }
+    for (int ii = taskHeapSize / 2 - 1; ii >= 0; --ii) {
+        heapSiftDown(ii);
+    }
+}
+
 void queueClear(void)
 {
     memset(taskQueueArray, 0, sizeof(taskQueueArray));
     taskQueuePos = 0;
     taskQueueSize = 0;
+    taskHeapSize = 0;
 }
 
 bool queueContains(cfTask_t *task)
@@ -88,6 +199,9 @@ bool queueAdd(cfTask_t *task)
             memmove(&taskQueueArray[ii+1], &taskQueueArray[ii], sizeof(task) * (taskQueueSize - ii));
             taskQueueArray[ii] = task;
             ++taskQueueSize;
+            if (!isRealtimeTask(task)) {
+                heapInsert(task);
+            }
             return true;
         }
     }
@@ -100,6 +214,7 @@ bool queueRemove(cfTask_t *task)
         if (taskQueueArray[ii] == task) {
             memmove(&taskQueueArray[ii], &taskQueueArray[ii+1], sizeof(task) * (taskQueueSize - ii));
             --taskQueueSize;
+            heapRemove(task);
             return true;
         }
     }
@@ -143,6 +258,8 @@ void taskSystemLoad(timeUs_t currentTimeUs)
 timeUs_t checkFuncMaxExecutionTime;
 timeUs_t checkFuncTotalExecutionTime;
 timeUs_t checkFuncMovingSumExecutionTime;
+static timeUs_t schedulerMaxOverheadTime;
+static timeUs_t schedulerMovingSumOverheadTime;
 
 void getCheckFuncInfo(cfCheckFuncInfo_t *checkFuncInfo)
 {
@@ -162,17 +279,46 @@ void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t * taskInfo)
     taskInfo->totalExecutionTime = cfTasks[taskId].totalExecutionTime;
     taskInfo->averageExecutionTime = cfTasks[taskId].movingSumExecutionTime / MOVING_SUM_COUNT;
     taskInfo->latestDeltaTime = cfTasks[taskId].taskLatestDeltaTime;
+    taskInfo->deadlineMisses = cfTasks[taskId].deadlineMisses;
+}
+
+void getSchedulerInfo(cfSchedulerInfo_t *schedulerInfo)
+{
+    schedulerInfo->mode = schedulerMode;
+    schedulerInfo->maxOverheadTime = schedulerMaxOverheadTime;
+    schedulerInfo->averageOverheadTime = schedulerMovingSumOverheadTime / MOVING_SUM_COUNT;
+}
+
+void getTaskHistogram(cfTaskId_e taskId, cfTaskHistogram_t *histogram)
+{
+    *histogram = cfTasks[taskId].histogram;
+}
+
+static FAST_CODE void taskHistogramAdd(uint16_t *histogram, timeDelta_t valueUs)
+{
+    const int bucket = valueUs <= 0 ? 0 : MIN(32 - __builtin_clz(valueUs), TASK_HISTOGRAM_BUCKET_COUNT - 1);
+    if (++histogram[bucket] == UINT16_MAX) {
+        // halve the whole histogram rather than saturate, so the distribution stays meaningful
+        for (int ii = 0; ii < TASK_HISTOGRAM_BUCKET_COUNT; ii++) {
+            histogram[ii] >>= 1;
+        }
+    }
 }
 #endif
 
 void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros)
 {
+    cfTask_t *task;
     if (taskId == TASK_SELF) {
-        cfTask_t *task = currentTask;
-        task->desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, (timeDelta_t)newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+        task = currentTask;
     } else if (taskId < TASK_COUNT) {
-        cfTask_t *task = &cfTasks[taskId];
-        task->desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, (timeDelta_t)newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+        task = &cfTasks[taskId];
+    } else {
+        return;
+    }
+    task->desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, (timeDelta_t)newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+    if (schedulerMode == SCHEDULER_MODE_EDF && heapContains(task)) {
+        heapSetDeadline(task, task->lastExecutedAt + task->desiredPeriod);
     }
 }
 
@@ -213,10 +359,14 @@ void schedulerResetTaskStatistics(cfTaskId_e taskId)
         currentTask->movingSumExecutionTime = 0;
         currentTask->totalExecutionTime = 0;
         currentTask->maxExecutionTime = 0;
+        currentTask->deadlineMisses = 0;
+        memset(&currentTask->histogram, 0, sizeof(currentTask->histogram));
     } else if (taskId < TASK_COUNT) {
         cfTasks[taskId].movingSumExecutionTime = 0;
         cfTasks[taskId].totalExecutionTime = 0;
         cfTasks[taskId].maxExecutionTime = 0;
+        cfTasks[taskId].deadlineMisses = 0;
+        memset(&cfTasks[taskId].histogram, 0, sizeof(cfTasks[taskId].histogram));
     }
 #endif
 }
@@ -234,13 +384,111 @@ void schedulerResetTaskMaxExecutionTime(cfTaskId_e taskId)
 #endif
 }
 
+void schedulerResetMaxOverheadTime(void)
+{
+#ifndef SKIP_TASK_STATISTICS
+    schedulerMaxOverheadTime = 0;
+#endif
+}
+
+void schedulerSetMode(schedulerMode_e mode)
+{
+    if (mode == SCHEDULER_MODE_EDF && schedulerMode != SCHEDULER_MODE_EDF) {
+        __sync_fetch_and_and(&signalledTasks, 0);
+        heapRebuild();
+    }
+    schedulerMode = mode;
+}
+
+/*
+ * Tell the scheduler an event-driven task has work, may be called from interrupt context.
+ * In SCHEDULER_MODE_EDF the task's checkFunc is only called when signalled or when desiredPeriod
+ * has passed without a signal.
+ */
+void schedulerSignalTask(cfTaskId_e taskId)
+{
+    if (taskId < TASK_COUNT) {
+        __sync_fetch_and_or(&signalledTasks, 1u << taskId);
+    }
+}
+
 void schedulerInit(void)
 {
     calculateTaskStatistics = true;
+    schedulerMode = SCHEDULER_MODE_PRIORITY;
     queueClear();
     queueAdd(&cfTasks[TASK_SYSTEM]);
 }
 
+/*
+ * Update taskAgeCycles and dynamicPriority, returns true if the task became ready to run on this pass
+ */
+static FAST_CODE bool taskUpdateDynamicPriority(cfTask_t *task, timeUs_t currentTimeUs)
+{
+    // Task has checkFunc - event driven
+    if (task->checkFunc) {
+#if defined(SCHEDULER_DEBUG)
+        const timeUs_t currentTimeBeforeCheckFuncCall = micros();
+#else
+        const timeUs_t currentTimeBeforeCheckFuncCall = currentTimeUs;
+#endif
+        // Increase priority for event driven tasks
+        if (task->staticPriority == TASK_PRIORITY_TRIGGER)
+        {
+            if (task->checkFunc(currentTimeBeforeCheckFuncCall, currentTimeBeforeCheckFuncCall - task->lastExecutedAt)) {
+                task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
+                if (task->taskAgeCycles > 0) {
+                    task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+                    return true;
+                }
+            }
+            else
+            {
+                task->taskAgeCycles = 0;
+            }
+        }
+        else if (task->dynamicPriority > 0) 
+        {
+            task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAt) / task->desiredPeriod);
+            task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+        } else if (task->checkFunc(currentTimeBeforeCheckFuncCall, currentTimeBeforeCheckFuncCall - task->lastExecutedAt)) {
+#if defined(SCHEDULER_DEBUG)
+            DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCall);
+#endif
+#ifndef SKIP_TASK_STATISTICS
+            if (calculateTaskStatistics) {
+                const uint32_t checkFuncExecutionTime = micros() - currentTimeBeforeCheckFuncCall;
+                checkFuncMovingSumExecutionTime += checkFuncExecutionTime - checkFuncMovingSumExecutionTime / MOVING_SUM_COUNT;
+                checkFuncTotalExecutionTime += checkFuncExecutionTime;   // time consumed by scheduler + task
+                checkFuncMaxExecutionTime = MAX(checkFuncMaxExecutionTime, checkFuncExecutionTime);
+            }
+#endif
+            task->lastSignaledAt = currentTimeBeforeCheckFuncCall;
+            task->taskAgeCycles = 1;
+            task->dynamicPriority = 1 + task->staticPriority;
+            return true;
+        } else {
+            task->taskAgeCycles = 0;
+        }
+    } else {
+        // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
+        // Task age is calculated from last execution
+        task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
+        if (task->taskAgeCycles > 0) {
+            task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+            return true;
+        }
+    }
+    return false;
+}
+
+static FAST_CODE bool taskCanBeChosenForScheduling(const cfTask_t *task, bool outsideRealtimeGuardInterval)
+{
+    return (outsideRealtimeGuardInterval) ||
+        (task->taskAgeCycles > 1) ||
+        (task->staticPriority == TASK_PRIORITY_REALTIME);
+}
+
 FAST_CODE void scheduler(void)
 {
     // Cache currentTime
@@ -259,72 +507,64 @@ FAST_CODE void scheduler(void)
     // The task to be invoked
     cfTask_t *selectedTask = NULL;
     uint16_t selectedTaskDynamicPriority = 0;
-
-    // Update task dynamic priorities
     uint16_t waitingTasks = 0;
-    for (cfTask_t *task = queueFirst(); task != NULL; task = queueNext()) {
-        // Task has checkFunc - event driven
-        if (task->checkFunc) {
-#if defined(SCHEDULER_DEBUG)
-            const timeUs_t currentTimeBeforeCheckFuncCall = micros();
-#else
-            const timeUs_t currentTimeBeforeCheckFuncCall = currentTimeUs;
-#endif
-            // Increase priority for event driven tasks
-            if (task->staticPriority == TASK_PRIORITY_TRIGGER)
-            {
-                if (task->checkFunc(currentTimeBeforeCheckFuncCall, currentTimeBeforeCheckFuncCall - task->lastExecutedAt)) {
-                    task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
-                    if (task->taskAgeCycles > 0) {
-                        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
-                        waitingTasks++;
-                    }
-                }
-                else
-                {
-                    task->taskAgeCycles = 0;
-                }
-            }
-            else if (task->dynamicPriority > 0) 
-            {
-                task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAt) / task->desiredPeriod);
-                task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+
+    if (schedulerMode == SCHEDULER_MODE_EDF) {
+        // Realtime tasks are at the head of the queue and are checked on every call, as in priority mode
+        for (cfTask_t *task = queueFirst(); task != NULL && isRealtimeTask(task); task = queueNext()) {
+            if (taskUpdateDynamicPriority(task, currentTimeUs)) {
                 waitingTasks++;
-            } else if (task->checkFunc(currentTimeBeforeCheckFuncCall, currentTimeBeforeCheckFuncCall - task->lastExecutedAt)) {
-#if defined(SCHEDULER_DEBUG)
-                DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCall);
-#endif
-#ifndef SKIP_TASK_STATISTICS
-                if (calculateTaskStatistics) {
-                    const uint32_t checkFuncExecutionTime = micros() - currentTimeBeforeCheckFuncCall;
-                    checkFuncMovingSumExecutionTime += checkFuncExecutionTime - checkFuncMovingSumExecutionTime / MOVING_SUM_COUNT;
-                    checkFuncTotalExecutionTime += checkFuncExecutionTime;   // time consumed by scheduler + task
-                    checkFuncMaxExecutionTime = MAX(checkFuncMaxExecutionTime, checkFuncExecutionTime);
+            }
+            if (task->dynamicPriority > selectedTaskDynamicPriority && taskCanBeChosenForScheduling(task, outsideRealtimeGuardInterval)) {
+                selectedTaskDynamicPriority = task->dynamicPriority;
+                selectedTask = task;
+            }
+        }
+
+        // Signalled tasks are due now
+        for (uint32_t signals = __sync_fetch_and_and(&signalledTasks, 0); signals; signals &= signals - 1) {
+            cfTask_t *task = &cfTasks[__builtin_ctz(signals)];
+            if (heapContains(task) && cmpTimeUs(task->deadlineAt, currentTimeUs) > 0) {
+                heapSetDeadline(task, currentTimeUs);
+            }
+        }
+
+        // Of the other tasks the due heap root, the earliest deadline, is considered. Event-driven tasks without an
+        // event are moved back by desiredPeriod, those the realtime guard holds back are popped until the pass is over
+        // so the next deadline becomes the root and they don't hold up the tasks behind them.
+        cfTask_t *passedOver[TASK_COUNT];
+        int passedOverCount = 0;
+        const int heapCount = taskHeapSize;
+        for (int checked = 0; checked < heapCount && taskHeapSize > 0 && cmpTimeUs(currentTimeUs, taskHeap[0]->deadlineAt) >= 0; ++checked) {
+            cfTask_t *task = taskHeap[0];
+            taskUpdateDynamicPriority(task, currentTimeUs);
+            if (task->dynamicPriority == 0) {
+                // Event-driven task without an event, check it again after desiredPeriod unless it is signalled
+                heapSetDeadline(task, currentTimeUs + task->desiredPeriod);
+                continue;
+            }
+            waitingTasks++;
+            if (taskCanBeChosenForScheduling(task, outsideRealtimeGuardInterval)) {
+                if (task->dynamicPriority > selectedTaskDynamicPriority) {
+                    selectedTaskDynamicPriority = task->dynamicPriority;
+                    selectedTask = task;
                 }
-#endif
-                task->lastSignaledAt = currentTimeBeforeCheckFuncCall;
-                task->taskAgeCycles = 1;
-                task->dynamicPriority = 1 + task->staticPriority;
-                waitingTasks++;
-            } else {
-                task->taskAgeCycles = 0;
+                break;
             }
-        } else {
-            // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
-            // Task age is calculated from last execution
-            task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
-            if (task->taskAgeCycles > 0) {
-                task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+            heapRemove(task);
+            passedOver[passedOverCount++] = task;
+        }
+        while (passedOverCount > 0) {
+            heapPush(passedOver[--passedOverCount]);
+        }
+    } else {
+        // Update task dynamic priorities
+        for (cfTask_t *task = queueFirst(); task != NULL; task = queueNext()) {
+            if (taskUpdateDynamicPriority(task, currentTimeUs)) {
                 waitingTasks++;
             }
-        }
 
-        if (task->dynamicPriority > selectedTaskDynamicPriority) {
-            const bool taskCanBeChosenForScheduling =
-                (outsideRealtimeGuardInterval) ||
-                (task->taskAgeCycles > 1) ||
-                (task->staticPriority == TASK_PRIORITY_REALTIME);
-            if (taskCanBeChosenForScheduling) {
+            if (task->dynamicPriority > selectedTaskDynamicPriority && taskCanBeChosenForScheduling(task, outsideRealtimeGuardInterval)) {
                 selectedTaskDynamicPriority = task->dynamicPriority;
                 selectedTask = task;
             }
@@ -348,16 +588,28 @@ FAST_CODE void scheduler(void)
 #else
         if (calculateTaskStatistics) {
             const timeUs_t currentTimeBeforeTaskCall = micros();
+            const timeUs_t overheadTime = currentTimeBeforeTaskCall - currentTimeUs;
+            schedulerMovingSumOverheadTime += overheadTime - schedulerMovingSumOverheadTime / MOVING_SUM_COUNT;
+            schedulerMaxOverheadTime = MAX(schedulerMaxOverheadTime, overheadTime);
+            if (selectedTask->taskAgeCycles > 1) {
+                selectedTask->deadlineMisses++;
+            }
+
             selectedTask->taskFunc(currentTimeBeforeTaskCall);
             const timeUs_t taskExecutionTime = micros() - currentTimeBeforeTaskCall;
             selectedTask->movingSumExecutionTime += taskExecutionTime - selectedTask->movingSumExecutionTime / MOVING_SUM_COUNT;
             selectedTask->totalExecutionTime += taskExecutionTime;   // time consumed by scheduler + task
             selectedTask->maxExecutionTime = MAX(selectedTask->maxExecutionTime, taskExecutionTime);
+            taskHistogramAdd(selectedTask->histogram.executionTime, taskExecutionTime);
+            taskHistogramAdd(selectedTask->histogram.lateness, selectedTask->taskLatestDeltaTime - selectedTask->desiredPeriod);
         } else {
             selectedTask->taskFunc(currentTimeUs);
         }
 
 #endif
+        if (schedulerMode == SCHEDULER_MODE_EDF && heapContains(selectedTask)) {
+            heapSetDeadline(selectedTask, selectedTask->lastExecutedAt + selectedTask->desiredPeriod);
+        }
 #if defined(SCHEDULER_DEBUG)
         DEBUG_SET(DEBUG_SCHEDULER, 2, micros() - currentTimeUs - taskExecutionTime); // time spent in scheduler
     } else {
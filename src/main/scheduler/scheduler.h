@@ -38,12 +38,24 @@ typedef enum {
     TASK_PRIORITY_MAX = 255
 } cfTaskPriority_e;
 
+typedef enum {
+    SCHEDULER_MODE_PRIORITY = 0,    // every task is aged and compared on every call
+    SCHEDULER_MODE_EDF,             // time-driven tasks in a heap ordered by next deadline, event-driven tasks are signalled
+    SCHEDULER_MODE_COUNT
+} schedulerMode_e;
+
 typedef struct {
     timeUs_t     maxExecutionTime;
     timeUs_t     totalExecutionTime;
     timeUs_t     averageExecutionTime;
 } cfCheckFuncInfo_t;
 
+typedef struct {
+    schedulerMode_e mode;
+    timeUs_t     maxOverheadTime;       // time from scheduler entry to task start
+    timeUs_t     averageOverheadTime;
+} cfSchedulerInfo_t;
+
 typedef struct {
     const char * taskName;
     const char * subTaskName;
@@ -54,8 +66,17 @@ typedef struct {
     timeUs_t     maxExecutionTime;
     timeUs_t     totalExecutionTime;
     timeUs_t     averageExecutionTime;
+    uint32_t     deadlineMisses;
 } cfTaskInfo_t;
 
+// log2 buckets: bucket 0 counts 0us, bucket n counts [2^(n-1), 2^n) us, the last bucket also counts everything above
+#define TASK_HISTOGRAM_BUCKET_COUNT 16
+
+typedef struct {
+    uint16_t     executionTime[TASK_HISTOGRAM_BUCKET_COUNT];
+    uint16_t     lateness[TASK_HISTOGRAM_BUCKET_COUNT];     // start time minus desired start time
+} cfTaskHistogram_t;
+
 typedef enum {
     /* Actual tasks */
     TASK_SYSTEM = 0,
@@ -136,6 +157,10 @@ typedef enum {
     TASK_PINIOBOX,
 #endif
 
+#ifdef USE_FLASHFS
+    TASK_FLASH_ERASE,
+#endif
+
     /* Count of real tasks */
     TASK_COUNT,
 
@@ -159,12 +184,16 @@ typedef struct {
     timeDelta_t taskLatestDeltaTime;
     timeUs_t lastExecutedAt;        // last time of invocation
     timeUs_t lastSignaledAt;        // time of invocation event for event-driven tasks
+    timeUs_t deadlineAt;            // heap key in SCHEDULER_MODE_EDF
+    uint8_t heapIndex;
 
 #ifndef SKIP_TASK_STATISTICS
     // Statistics
     timeUs_t movingSumExecutionTime;  // moving sum over 32 samples
     timeUs_t maxExecutionTime;
     timeUs_t totalExecutionTime;    // total time consumed by task since boot
+    uint32_t deadlineMisses;        // executions more than one desiredPeriod late
+    cfTaskHistogram_t histogram;
 #endif
 } cfTask_t;
 
@@ -172,13 +201,19 @@ extern cfTask_t cfTasks[TASK_COUNT];
 extern uint16_t averageSystemLoadPercent;
 
 void getCheckFuncInfo(cfCheckFuncInfo_t *checkFuncInfo);
+void getSchedulerInfo(cfSchedulerInfo_t *schedulerInfo);
 void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t *taskInfo);
+void getTaskHistogram(cfTaskId_e taskId, cfTaskHistogram_t *histogram);
 void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros);
 void setTaskEnabled(cfTaskId_e taskId, bool newEnabledState);
 timeDelta_t getTaskDeltaTime(cfTaskId_e taskId);
 void schedulerSetCalulateTaskStatistics(bool calculateTaskStatistics);
 void schedulerResetTaskStatistics(cfTaskId_e taskId);
 void schedulerResetTaskMaxExecutionTime(cfTaskId_e taskId);
+void schedulerResetMaxOverheadTime(void);
+
+void schedulerSetMode(schedulerMode_e mode);
+void schedulerSignalTask(cfTaskId_e taskId);
 
 void schedulerInit(void);
 void scheduler(void);
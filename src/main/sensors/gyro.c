@@ -127,6 +127,13 @@ float FAST_RAM_ZERO_INIT vGyroStdDevModulus;
 
 static FAST_RAM_ZERO_INIT int16_t gyroSensorTemperature;
 
+// the gyro task is considered late and polls the sensor when no sample arrives for this many loop times
+#define GYRO_SAMPLE_TIMEOUT_LOOPS 4
+
+static FAST_RAM_ZERO_INIT gyroSampleQueue_t gyroSampleQueue;
+static FAST_RAM_ZERO_INIT timeUs_t sampleReadyAtUs;
+static FAST_RAM_ZERO_INIT uint32_t samplesSkipped;
+
 
 static bool gyroHasOverflowProtection = true;
 
@@ -138,32 +145,17 @@ typedef struct gyroCalibration_s {
 
 bool firstArmingCalibrationWasStarted = false;
 
-typedef union gyroLowpassFilter_u {
-    pt1Filter_t pt1FilterState;
-    biquadFilter_t biquadFilterState;
-} gyroLowpassFilter_t;
-
 typedef struct gyroSensor_s {
     gyroDev_t gyroDev;
     gyroCalibration_t calibration;
 
-    // lowpass gyro soft filter
-    filterApplyFnPtr lowpassFilterApplyFn;
-    gyroLowpassFilter_t lowpassFilter[XYZ_AXIS_COUNT];
-
-    // lowpass2 gyro soft filter
-    filterApplyFnPtr lowpass2FilterApplyFn;
-    gyroLowpassFilter_t lowpass2Filter[XYZ_AXIS_COUNT];
-
-    // notch filters
-    filterApplyFnPtr notchFilter1ApplyFn;
-    biquadFilter_t notchFilter1[XYZ_AXIS_COUNT];
-
-    filterApplyFnPtr notchFilter2ApplyFn;
-    biquadFilter_t notchFilter2[XYZ_AXIS_COUNT];
+    // static lowpass and notch filters, only the enabled ones are in the chain
+    filterChain_t filterChain;
 
-    filterApplyFnPtr notchFilterDynApplyFn;
-    biquadFilter_t notchFilterDyn[XYZ_AXIS_COUNT];
+    // dynamic notches, one per tracked peak, retuned per axis by gyroDataAnalyse
+    uint8_t notchFilterDynCount;
+    biquadFilterXyz_t notchFilterDyn[DYN_NOTCH_COUNT_MAX];
+    biquadNotchTable_t notchTableDyn;
 
     // dyn filters
     filterApplyFnPtr gyroDynApplyFn;
@@ -194,7 +186,7 @@ STATIC_UNIT_TESTED gyroDev_t * const gyroDevPtr = &gyroSensor1.gyroDev;
 
 static void gyroInitSensorFilters(gyroSensor_t *gyroSensor);
 #ifndef USE_GYRO_IMUF9001
-static void gyroInitLowpassFilterLpf(gyroSensor_t *gyroSensor, int slot, int type, uint16_t lpfHz);
+static void gyroInitLowpassFilterLpf(gyroSensor_t *gyroSensor, int type, uint16_t lpfHz);
 #endif
 
 #define DEBUG_GYRO_CALIBRATION 3
@@ -211,7 +203,7 @@ static void gyroInitLowpassFilterLpf(gyroSensor_t *gyroSensor, int slot, int typ
 #define GYRO_OVERFLOW_TRIGGER_THRESHOLD 31980  // 97.5% full scale (1950dps for 2000dps gyro)
 #define GYRO_OVERFLOW_RESET_THRESHOLD 30340    // 92.5% full scale (1850dps for 2000dps gyro)
 
-PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 4);
+PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 7);
 
 #ifndef GYRO_CONFIG_USE_GYRO_DEFAULT
 #define GYRO_CONFIG_USE_GYRO_DEFAULT GYRO_CONFIG_USE_GYRO_1
@@ -241,6 +233,11 @@ PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .yaw_spin_threshold = 1950,
     .dyn_notch_quality = 70,
     .dyn_notch_width_percent = 25,
+    .dyn_notch_count = 1,
+    .dyn_notch_fft_size = DYN_NOTCH_FFT_SIZE_32,
+    .dyn_notch_sample_hz = 1333,
+    .dyn_notch_min_hz = 125,
+    .gyro_interrupt_sync = false,
     .imuf_mode = GTBCM_GYRO_ACC_FILTER_F,
     .imuf_rate = IMUF_RATE_16K,
     .imuf_roll_q = IMUF_DEFAULT_ROLL_Q,
@@ -282,6 +279,11 @@ PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .yaw_spin_threshold = 1950,
     .dyn_notch_quality = 70,
     .dyn_notch_width_percent = 50,
+    .dyn_notch_count = 1,
+    .dyn_notch_fft_size = DYN_NOTCH_FFT_SIZE_32,
+    .dyn_notch_sample_hz = 1333,
+    .dyn_notch_min_hz = 125,
+    .gyro_interrupt_sync = false,
 );
 #endif //USE_GYRO_IMUF9001
 
@@ -601,7 +603,7 @@ static bool gyroInitSensor(gyroSensor_t *gyroSensor)
     gyroInitSensorFilters(gyroSensor);
 
 #ifdef USE_GYRO_DATA_ANALYSE
-    gyroDataAnalyseStateInit(&gyroSensor->gyroAnalyseState, gyro.targetLooptime);
+    gyroDataAnalyseStateInit(&gyroSensor->gyroAnalyseState, gyro.targetLooptime, gyroSensor->notchFilterDynCount);
 #endif
 
     return true;
@@ -704,6 +706,20 @@ bool gyroInit(void)
     }
 #endif // USE_DUAL_GYRO
 
+    // Interrupt driven gyro task needs a data ready interrupt, dual gyro setups keep polling
+    gyroSensor1.gyroDev.sampleQueue = NULL;
+    if (ret && gyroConfig()->gyro_interrupt_sync && gyroToUse == GYRO_CONFIG_USE_GYRO_1) {
+#if defined(USE_DMA_SPI_DEVICE)
+        const bool dataReadyInterrupt = true;
+#else
+        const bool dataReadyInterrupt = gyroSensor1.gyroDev.mpuIntExtiTag != IO_TAG_NONE || gyroSensor1.gyroDev.gyroHardware == GYRO_FAKE;
+#endif
+        if (dataReadyInterrupt) {
+            gyroSampleQueueInit(&gyroSampleQueue);
+            gyroSensor1.gyroDev.sampleQueue = &gyroSampleQueue;
+        }
+    }
+
 #ifdef USE_DUAL_GYRO
     // Only allow using both gyros simultaneously if they are the same hardware type.
     // If the user selected "BOTH" and they are not the same type, then reset to using only the first gyro.
@@ -721,26 +737,8 @@ bool gyroInit(void)
 }
 
 #ifndef USE_GYRO_IMUF9001
-void gyroInitLowpassFilterLpf(gyroSensor_t *gyroSensor, int slot, int type, uint16_t lpfHz)
+void gyroInitLowpassFilterLpf(gyroSensor_t *gyroSensor, int type, uint16_t lpfHz)
 {
-    filterApplyFnPtr *lowpassFilterApplyFn;
-    gyroLowpassFilter_t *lowpassFilter = NULL;
-
-    switch (slot) {
-    case FILTER_LOWPASS:
-        lowpassFilterApplyFn = &gyroSensor->lowpassFilterApplyFn;
-        lowpassFilter = gyroSensor->lowpassFilter;
-        break;
-
-    case FILTER_LOWPASS2:
-        lowpassFilterApplyFn = &gyroSensor->lowpass2FilterApplyFn;
-        lowpassFilter = gyroSensor->lowpass2Filter;
-        break;
-
-    default:
-        return;
-    }
-
     // Establish some common constants
     const uint32_t gyroFrequencyNyquist = 1000000 / 2 / gyro.targetLooptime;
     const float gyroDt = gyro.targetLooptime * 1e-6f;
@@ -748,24 +746,22 @@ void gyroInitLowpassFilterLpf(gyroSensor_t *gyroSensor, int slot, int type, uint
     // Gain could be calculated a little later as it is specific to the pt1/bqrcf2/fkf branches
     const float gain = pt1FilterGain(lpfHz, gyroDt);
 
-    // Dereference the pointer to null before checking valid cutoff and filter
-    // type. It will be overridden for positive cases.
-    *lowpassFilterApplyFn = &nullFilterApply;
-
-    // If lowpass cutoff has been specified and is less than the Nyquist frequency
+    // Only add a stage if lowpass cutoff has been specified and is less than the Nyquist frequency
     if (lpfHz && lpfHz <= gyroFrequencyNyquist) {
         switch (type) {
         case FILTER_PT1:
-            *lowpassFilterApplyFn = (filterApplyFnPtr) pt1FilterApply;
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt1FilterInit(&lowpassFilter[axis].pt1FilterState, gain);
-            }
+#ifdef USE_FIXED_POINT_FILTERS
+            filterChainAddPt1Q15(&gyroSensor->filterChain, gain);
+#else
+            filterChainAddPt1(&gyroSensor->filterChain, gain);
+#endif
             break;
         case FILTER_BIQUAD:
-            *lowpassFilterApplyFn = (filterApplyFnPtr) biquadFilterApply;
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                biquadFilterInitLPF(&lowpassFilter[axis].biquadFilterState, lpfHz, gyro.targetLooptime);
-            }
+#ifdef USE_FIXED_POINT_FILTERS
+            filterChainAddBiquadQ30(&gyroSensor->filterChain, lpfHz, gyro.targetLooptime, BIQUAD_Q, FILTER_LPF);
+#else
+            filterChainAddBiquad(&gyroSensor->filterChain, lpfHz, gyro.targetLooptime, BIQUAD_Q, FILTER_LPF);
+#endif
             break;
         }
     }
@@ -794,33 +790,13 @@ void gyroInitSlewLimiter(gyroSensor_t *gyroSensor) {
 }
 #endif
 
-static void gyroInitFilterNotch1(gyroSensor_t *gyroSensor, uint16_t notchHz, uint16_t notchCutoffHz)
+static void gyroInitFilterNotch(gyroSensor_t *gyroSensor, uint16_t notchHz, uint16_t notchCutoffHz)
 {
-    gyroSensor->notchFilter1ApplyFn = nullFilterApply;
-
     notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
 
     if (notchHz != 0 && notchCutoffHz != 0) {
-        gyroSensor->notchFilter1ApplyFn = (filterApplyFnPtr)biquadFilterApply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyroSensor->notchFilter1[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
-    }
-}
-
-static void gyroInitFilterNotch2(gyroSensor_t *gyroSensor, uint16_t notchHz, uint16_t notchCutoffHz)
-{
-    gyroSensor->notchFilter2ApplyFn = nullFilterApply;
-
-    notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
-
-    if (notchHz != 0 && notchCutoffHz != 0) {
-        gyroSensor->notchFilter2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
-        const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyroSensor->notchFilter2[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
+        filterChainAddBiquad(&gyroSensor->filterChain, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
     }
 }
 #endif //USE_GYRO_IMUF9001
@@ -834,14 +810,14 @@ static bool isDynamicFilterActive(void)
 
 static void gyroInitFilterDynamicNotch(gyroSensor_t *gyroSensor)
 {
-    gyroSensor->notchFilterDynApplyFn = nullFilterApply;
+    gyroSensor->notchFilterDynCount = constrain(gyroConfig()->dyn_notch_count, 1, DYN_NOTCH_COUNT_MAX);
 
     if (isDynamicFilterActive()) {
-        gyroSensor->notchFilterDynApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1; // must be this function, not DF2
         const float notchQ = filterGetNotchQ(400, 390); //just any init value
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyroSensor->notchFilterDyn[axis], 400, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+        for (int notch = 0; notch < gyroSensor->notchFilterDynCount; notch++) {
+            biquadFilterXyzInit(&gyroSensor->notchFilterDyn[notch], 400, gyro.targetLooptime, notchQ, FILTER_NOTCH);
         }
+        gyroDataAnalyseInitNotchTable(&gyroSensor->notchTableDyn, gyro.targetLooptime);
     }
 }
 #endif
@@ -855,22 +831,23 @@ static void gyroInitSensorFilters(gyroSensor_t *gyroSensor)
 
     kalman_init();
 
+    // stages are added in the order they are applied
+    filterChainInit(&gyroSensor->filterChain);
+
     gyroInitLowpassFilterLpf(
       gyroSensor,
-      FILTER_LOWPASS,
-      gyroConfig()->gyro_lowpass_type,
-      gyroConfig()->gyro_lowpass_hz
+      gyroConfig()->gyro_lowpass2_type,
+      gyroConfig()->gyro_lowpass2_hz
     );
 
     gyroInitLowpassFilterLpf(
       gyroSensor,
-      FILTER_LOWPASS2,
-      gyroConfig()->gyro_lowpass2_type,
-      gyroConfig()->gyro_lowpass2_hz
+      gyroConfig()->gyro_lowpass_type,
+      gyroConfig()->gyro_lowpass_hz
     );
 
-    gyroInitFilterNotch1(gyroSensor, gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
-    gyroInitFilterNotch2(gyroSensor, gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
+    gyroInitFilterNotch(gyroSensor, gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
+    gyroInitFilterNotch(gyroSensor, gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
     #endif //USE_GYRO_IMUF9001
 #ifdef USE_GYRO_DATA_ANALYSE
     gyroInitFilterDynamicNotch(gyroSensor);
@@ -1130,13 +1107,76 @@ static FAST_CODE void checkForYawSpin(gyroSensor_t *gyroSensor, timeUs_t current
 #endif // USE_GYRO_IMUF9001
 
 
+bool gyroInterruptSyncActive(void)
+{
+    return gyroSensor1.gyroDev.sampleQueue != NULL;
+}
+
+/*
+ * checkFunc of the gyro task when gyroInterruptSyncActive()
+ */
+FAST_CODE bool gyroSampleReady(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs)
+{
+    UNUSED(currentTimeUs);
+    return !gyroSampleQueueIsEmpty(&gyroSampleQueue) || currentDeltaTimeUs >= (timeDelta_t)(GYRO_SAMPLE_TIMEOUT_LOOPS * gyro.targetLooptime);
+}
+
+timeUs_t gyroSampleReadyAtUs(void)
+{
+    return sampleReadyAtUs;
+}
+
+static FAST_CODE bool gyroReadSensor(gyroDev_t *gyroDev)
+{
+#ifdef USE_DMA_SPI_DEVICE
+    UNUSED(gyroDev);
+    return true; // data is read into gyroDev by the DMA completion interrupt
+#else
+    return gyroDev->readFn(gyroDev);
+#endif
+}
+
+static FAST_CODE bool gyroReadSampleQueue(gyroDev_t *gyroDev, timeUs_t currentTimeUs)
+{
+    gyroSample_t sample;
+    uint32_t sampleCount = 0;
+    // only the newest sample is used if the task fell behind
+    while (gyroSampleQueuePop(gyroDev->sampleQueue, &sample)) {
+        sampleCount++;
+    }
+    if (sampleCount == 0) {
+        // no data ready interrupt within GYRO_SAMPLE_TIMEOUT_LOOPS, poll the sensor
+        sampleReadyAtUs = currentTimeUs;
+        return gyroReadSensor(gyroDev);
+    }
+    samplesSkipped += sampleCount - 1;
+    sampleReadyAtUs = sample.readyAtUs;
+    DEBUG_SET(DEBUG_GYRO_LATENCY, 1, currentTimeUs - sample.readyAtUs);
+    DEBUG_SET(DEBUG_GYRO_LATENCY, 2, gyroDev->sampleQueue->overruns);
+    DEBUG_SET(DEBUG_GYRO_LATENCY, 3, samplesSkipped);
+    if (!sample.hasData) {
+        return gyroReadSensor(gyroDev);
+    }
+    gyroDev->gyroADCRaw[X] = sample.adcRaw[X];
+    gyroDev->gyroADCRaw[Y] = sample.adcRaw[Y];
+    gyroDev->gyroADCRaw[Z] = sample.adcRaw[Z];
+    return true;
+}
+
 static FAST_CODE_NOINLINE void gyroUpdateSensor(gyroSensor_t* gyroSensor, timeUs_t currentTimeUs)
 {
+    if (gyroSensor->gyroDev.sampleQueue) {
+        if (!gyroReadSampleQueue(&gyroSensor->gyroDev, currentTimeUs)) {
+            return;
+        }
+    } else {
+        sampleReadyAtUs = currentTimeUs;
     #ifndef USE_DMA_SPI_DEVICE
         if (!gyroSensor->gyroDev.readFn(&gyroSensor->gyroDev)) {
-        return;
-    }
+            return;
+        }
     #endif
+    }
     gyroSensor->gyroDev.dataReady = false;
 
     const timeDelta_t sampleDeltaUs = currentTimeUs - accumulationLastTimeSampledUs;
@@ -1204,7 +1244,9 @@ static FAST_CODE_NOINLINE void gyroUpdateSensor(gyroSensor_t* gyroSensor, timeUs
 
 #ifdef USE_GYRO_DATA_ANALYSE
     if (isDynamicFilterActive()) {
-        gyroDataAnalyse(&gyroSensor->gyroAnalyseState, gyroSensor->notchFilterDyn);
+        STAGE_TIMING_BEGIN(STAGE_GYRO_ANALYSE);
+        gyroDataAnalyse(&gyroSensor->gyroAnalyseState, gyroSensor->notchFilterDyn, &gyroSensor->notchTableDyn);
+        STAGE_TIMING_END(STAGE_GYRO_ANALYSE);
     }
 #endif
 
@@ -1219,6 +1261,17 @@ FAST_CODE_NOINLINE void gyroDmaSpiFinishRead(void)
 {
     //called by dma callback
     mpuGyroDmaSpiReadFinish(&gyroSensor1.gyroDev);
+    if (gyroSensor1.gyroDev.sampleQueue) {
+        gyroSample_t sample = { .readyAtUs = micros(), .hasData = false };
+#ifndef USE_GYRO_IMUF9001
+        // IMUF9001 delivers filtered float data, it stays in gyroDev
+        sample.adcRaw[X] = gyroSensor1.gyroDev.gyroADCRaw[X];
+        sample.adcRaw[Y] = gyroSensor1.gyroDev.gyroADCRaw[Y];
+        sample.adcRaw[Z] = gyroSensor1.gyroDev.gyroADCRaw[Z];
+        sample.hasData = true;
+#endif
+        gyroSampleQueuePush(gyroSensor1.gyroDev.sampleQueue, &sample);
+    }
 
 }
 
@@ -68,10 +68,6 @@ typedef enum {
 #define GYRO_CONFIG_USE_GYRO_2      1
 #define GYRO_CONFIG_USE_GYRO_BOTH   2
 
-typedef enum {
-    FILTER_LOWPASS = 0,
-    FILTER_LOWPASS2
-} filterSlots;
 #if defined(USE_GYRO_IMUF9001)
 typedef enum {
     IMUF_RATE_32K = 0,
@@ -83,6 +79,12 @@ typedef enum {
 } imufRate_e;
 #endif
 
+typedef enum {
+    DYN_NOTCH_FFT_SIZE_32 = 0,
+    DYN_NOTCH_FFT_SIZE_64,
+    DYN_NOTCH_FFT_SIZE_128
+} dynNotchFftSize_e;
+
 typedef struct gyroConfig_s {
     uint8_t  gyro_align;                       // gyro alignment
     uint8_t  gyroMovementCalibrationThreshold; // people keep forgetting that moving model while init results in wrong gyro offsets. and then they never reset gyro. so this is now on by default.
@@ -114,6 +116,11 @@ typedef struct gyroConfig_s {
     uint16_t gyroCalibrationDuration;  // Gyro calibration duration in 1/100 second
     uint8_t dyn_notch_quality; // bandpass quality factor, 100 for steep sided bandpass
     uint8_t dyn_notch_width_percent;
+    uint8_t dyn_notch_count; // number of noise peaks tracked per axis
+    uint8_t dyn_notch_fft_size; // FFT window length, see dynNotchFftSize_e
+    uint16_t dyn_notch_sample_hz; // rate the gyro is downsampled to for the FFT, limited to a third of the gyro rate
+    uint16_t dyn_notch_min_hz; // lowest notch centre frequency
+    uint8_t gyro_interrupt_sync; // run the gyro task from the data ready interrupt instead of polling
 #if defined(USE_GYRO_IMUF9001)
     uint16_t imuf_mode;
     uint16_t imuf_rate;
@@ -131,6 +138,8 @@ typedef struct gyroConfig_s {
 
 PG_DECLARE(gyroConfig_t, gyroConfig);
 
+#define DYN_NOTCH_COUNT_MAX 3
+
 bool gyroInit(void);
 
 void gyroInitFilters(void);
@@ -144,6 +153,9 @@ void gyroDmaSpiFinishRead(void);
 void gyroDmaSpiStartRead(void);
 #endif
 void gyroUpdate(timeUs_t currentTimeUs);
+bool gyroInterruptSyncActive(void);
+bool gyroSampleReady(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
+timeUs_t gyroSampleReadyAtUs(void);
 bool gyroGetAverage(quaternion *vAverage);
 const busDevice_t *gyroSensorBus(void);
 struct mpuConfiguration_s;
@@ -44,36 +44,89 @@
 // The FFT splits the frequency domain into an number of bins
 // A sampling frequency of 1000 and max frequency of 500 at a window size of 32 gives 16 frequency bins each with a width 31.25Hz
 // Eg [0,31), [31,62), [62, 93) etc
+// Larger windows and lower sampling rates give narrower bins at the cost of a longer window and more work per analysis
 
-#define FFT_BIN_COUNT             (FFT_WINDOW_SIZE / 2)
-// for gyro loop >= 4KHz, analyse up to 666Hz, 16 bins each 41.625 Hz wide
-#define FFT_SAMPLING_RATE_HZ      1333
-// following bin must be at least 2 times previous to indicate start of peak
-#define FFT_MIN_BIN_RISE          2
-// the desired approimate lower frequency when calculating bin offset
-#define FFT_BIN_OFFSET_DESIRED_HZ 90
+// the lowest bin used in the peak search sits this far below the minimum notch centre
+#define FFT_BIN_OFFSET_BELOW_MIN_HZ 35
 // lowpass frequency for smoothing notch centre point
 #define DYN_NOTCH_SMOOTH_FREQ_HZ  60
-// notch centre point will not go below this, must be greater than cutoff, mid of bottom bin
-#define DYN_NOTCH_MIN_CENTRE_HZ   125
-// lowest allowed notch cutoff frequency
-#define DYN_NOTCH_MIN_CUTOFF_HZ   105
-// we need 4 steps for each axis
-#define DYN_NOTCH_CALC_TICKS      (XYZ_AXIS_COUNT * 4)
-
+// lowest allowed notch cutoff frequency is this far below the minimum notch centre
+#define DYN_NOTCH_MIN_CUTOFF_BELOW_MIN_HZ 20
+// worst case tick of the 32 sample window, larger windows are bounded by their FFT step instead
+#define DYN_NOTCH_TICK_BUDGET_US  21
+// the step plan covers one update, each further notch needs one more tick per axis
+#define DYN_NOTCH_CALC_TICKS(notchCount) (XYZ_AXIS_COUNT * (fftTicksPerAxis + (notchCount) - 1))
+
+enum {
+    STEP_ARM_CFFT_F32,
+    STEP_BITREVERSAL,
+    STEP_STAGE_RFFT_F32,
+    STEP_ARM_CMPLX_MAG_F32,
+    STEP_CALC_FREQUENCIES,
+    STEP_UPDATE_FILTERS,
+    STEP_HANNING,
+    STEP_COUNT
+};
+
+// measured step time for 16 bins on F4, all but the update scale with the bin count
+static const uint8_t stepTimeUs[STEP_COUNT] = { 16, 6, 14, 8, 13, 7, 5 };
+// complex FFT for 16, 32 and 64 bins, does not scale linearly
+static const uint8_t cfftTimeUs[] = { 16, 35, 70 };
+
+static uint8_t FAST_RAM_ZERO_INIT  fftWindowSize;
+static uint8_t FAST_RAM_ZERO_INIT  fftBinCount;
 static uint16_t FAST_RAM_ZERO_INIT fftSamplingRateHz;
 // centre frequency of bandpass that constrains input to FFT
 static uint16_t FAST_RAM_ZERO_INIT fftBpfHz;
 // Hz per bin
 static float FAST_RAM_ZERO_INIT    fftResolution;
+// notch centre point will not go below this, must be greater than cutoff
+static uint16_t FAST_RAM_ZERO_INIT dynNotchMinCentreHz;
+// lowest allowed notch cutoff frequency
+static uint16_t FAST_RAM_ZERO_INIT dynNotchMinCutoffHz;
 // maximum notch centre frequency limited by Nyquist
 static uint16_t FAST_RAM_ZERO_INIT dynNotchMaxCentreHz;
 static uint8_t  FAST_RAM_ZERO_INIT fftBinOffset;
 
+// bit n set => step n is followed by step n + 1 in the same tick
+static uint8_t FAST_RAM_ZERO_INIT  stepFallthrough;
+static uint8_t FAST_RAM_ZERO_INIT  fftTicksPerAxis;
+
 // Hanning window, see https://en.wikipedia.org/wiki/Window_function#Hann_.28Hanning.29_window
-static FAST_RAM_ZERO_INIT float hanningWindow[FFT_WINDOW_SIZE];
+static FAST_RAM_ZERO_INIT float hanningWindow[FFT_WINDOW_SIZE_MAX];
 static FAST_RAM_ZERO_INIT float dynamicNotchCutoff;
 
+/*
+ * Group the steps into ticks so no tick takes longer than the complex FFT, which can't be split,
+ * or the worst tick of the 32 sample window, whichever is larger.
+ */
+static void gyroDataAnalysePlanSteps(void)
+{
+    const int binScale = fftBinCount / 16;
+    const int cfftIndex = (binScale == 1) ? 0 : (binScale == 2) ? 1 : 2;
+    const int budgetUs = MAX(cfftTimeUs[cfftIndex], DYN_NOTCH_TICK_BUDGET_US);
+
+    stepFallthrough = 0;
+    fftTicksPerAxis = 0;
+    int tickTimeUs = 0;
+    for (int step = 0; step < STEP_COUNT; step++) {
+        int timeUs = stepTimeUs[step];
+        if (step == STEP_ARM_CFFT_F32) {
+            timeUs = cfftTimeUs[cfftIndex];
+        } else if (step != STEP_UPDATE_FILTERS) {
+            timeUs *= binScale;
+        }
+
+        if (step > 0 && tickTimeUs + timeUs <= budgetUs) {
+            stepFallthrough |= 1 << (step - 1);
+            tickTimeUs += timeUs;
+        } else {
+            fftTicksPerAxis++;
+            tickTimeUs = timeUs;
+        }
+    }
+}
+
 void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
 {
 #ifdef USE_DUAL_GYRO
@@ -86,27 +139,45 @@ void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
 
     const int gyroLoopRateHz = lrintf((1.0f / targetLooptimeUs) * 1e6f);
 
-    // If we get at least 3 samples then use the default FFT sample frequency
+    fftWindowSize = MIN(32 << gyroConfig()->dyn_notch_fft_size, FFT_WINDOW_SIZE_MAX);
+    fftBinCount = fftWindowSize / 2;
+
+    // If we get at least 3 samples then use the configured FFT sample frequency
     // otherwise we need to calculate a FFT sample frequency to ensure we get 3 samples (gyro loops < 4K)
-    fftSamplingRateHz = MIN((gyroLoopRateHz / 3), FFT_SAMPLING_RATE_HZ);
+    fftSamplingRateHz = MIN((gyroLoopRateHz / 3), gyroConfig()->dyn_notch_sample_hz);
 
     fftBpfHz = fftSamplingRateHz / 4;
-    fftResolution = (float)fftSamplingRateHz / FFT_WINDOW_SIZE;
+    fftResolution = (float)fftSamplingRateHz / fftWindowSize;
     dynNotchMaxCentreHz = fftSamplingRateHz / 2;
+    dynNotchMinCentreHz = MIN(gyroConfig()->dyn_notch_min_hz, dynNotchMaxCentreHz);
+    dynNotchMinCutoffHz = MAX(dynNotchMinCentreHz - DYN_NOTCH_MIN_CUTOFF_BELOW_MIN_HZ, 1);
 
     // Calculate the FFT bin offset to try and get the lowest bin used
-    // in the center calc close to 90hz
-    // > 1333hz = 1, 889hz (2.67K) = 2, 666hz (2K) = 3
-    fftBinOffset = MAX(1, lrintf(FFT_BIN_OFFSET_DESIRED_HZ / fftResolution - 1.5f));
-
-    for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
-        hanningWindow[i] = (0.5f - 0.5f * cos_approx(2 * M_PIf * i / (FFT_WINDOW_SIZE - 1)));
+    // in the center calc close to the minimum notch centre
+    // with the defaults: > 1333hz = 1, 889hz (2.67K) = 2, 666hz (2K) = 3
+    fftBinOffset = MAX(1, lrintf((dynNotchMinCentreHz - FFT_BIN_OFFSET_BELOW_MIN_HZ) / fftResolution - 1.5f));
+    // leave at least a few bins for the peak search
+    fftBinOffset = MIN(fftBinOffset, fftBinCount - 4);
+
+    for (int i = 0; i < fftWindowSize; i++) {
+        hanningWindow[i] = (0.5f - 0.5f * cos_approx(2 * M_PIf * i / (fftWindowSize - 1)));
     }
 
     dynamicNotchCutoff = (100.0f - gyroConfig()->dyn_notch_width_percent) / 100;
+
+    gyroDataAnalysePlanSteps();
+}
+
+// coefficients for the whole centre frequency range the notches are constrained to
+void gyroDataAnalyseInitNotchTable(biquadNotchTable_t *notchTable, uint32_t targetLooptimeUs)
+{
+    gyroDataAnalyseInit(targetLooptimeUs);
+
+    const float notchQ = filterGetNotchQ(dynNotchMinCentreHz, MAX(dynNotchMinCentreHz * dynamicNotchCutoff, dynNotchMinCutoffHz));
+    biquadNotchTableInit(notchTable, dynNotchMinCentreHz, dynNotchMaxCentreHz, targetLooptimeUs, notchQ);
 }
 
-void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptimeUs)
+void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptimeUs, uint8_t notchCount)
 {
     // initialise even if FEATURE_DYNAMIC_FILTER not set, since it may be set later
     gyroDataAnalyseInit(targetLooptimeUs);
@@ -115,17 +186,21 @@ void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptime
     state->maxSampleCount = samplingFrequency / fftSamplingRateHz;
     state->maxSampleCountRcp = 1.f / state->maxSampleCount;
 
-    arm_rfft_fast_init_f32(&state->fftInstance, FFT_WINDOW_SIZE);
+    state->notchCount = constrain(notchCount, 1, DYN_NOTCH_COUNT_MAX);
 
-    // recalculation of filters takes 4 calls per axis => each filter gets updated every DYN_NOTCH_CALC_TICKS calls
-    // at 4khz gyro loop rate this means 4khz / 4 / 3 = 333Hz => update every 3ms
+    arm_rfft_fast_init_f32(&state->fftInstance, fftWindowSize);
+
+    // recalculation of filters takes fftTicksPerAxis + notchCount - 1 calls per axis => each filter gets updated every DYN_NOTCH_CALC_TICKS calls
+    // at 4khz gyro loop rate with the 32 sample window and one notch this means 4khz / 4 / 3 = 333Hz => update every 3ms
     // for gyro rate > 16kHz, we have update frequency of 1kHz => 1ms
-    const float looptime = MAX(1000000u / fftSamplingRateHz, targetLooptimeUs * DYN_NOTCH_CALC_TICKS);
+    const float looptime = MAX(1000000u / fftSamplingRateHz, targetLooptimeUs * DYN_NOTCH_CALC_TICKS(state->notchCount));
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        // any init value
-        state->centerFreq[axis] = 200;
         biquadFilterInit(&state->gyroBandpassFilter[axis], fftBpfHz, 1000000 / fftSamplingRateHz, 0.01f * gyroConfig()->dyn_notch_quality, FILTER_BPF);
-        biquadFilterInitLPF(&state->detectedFrequencyFilter[axis], DYN_NOTCH_SMOOTH_FREQ_HZ, looptime);
+        for (int notch = 0; notch < state->notchCount; notch++) {
+            // any init value
+            state->centerFreq[axis][notch] = 200;
+            biquadFilterInitLPF(&state->detectedFrequencyFilter[axis][notch], DYN_NOTCH_SMOOTH_FREQ_HZ, looptime);
+        }
     }
 }
 
@@ -134,12 +209,12 @@ void gyroDataAnalysePush(gyroAnalyseState_t *state, const int axis, const float
     state->oversampledGyroAccumulator[axis] += sample;
 }
 
-static void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn);
+static void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilterXyz_t *notchFilterDyn, const biquadNotchTable_t *notchTable);
 
 /*
  * Collect gyro data, to be analysed in gyroDataAnalyseUpdate function
  */
-void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn)
+void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilterXyz_t *notchFilterDyn, const biquadNotchTable_t *notchTable)
 {
     // samples should have been pushed by `gyroDataAnalysePush`
     // if gyro sampling is > 1kHz, accumulate multiple samples
@@ -162,15 +237,15 @@ void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn)
             state->oversampledGyroAccumulator[axis] = 0;
         }
 
-        state->circularBufferIdx = (state->circularBufferIdx + 1) % FFT_WINDOW_SIZE;
+        state->circularBufferIdx = (state->circularBufferIdx + 1) % fftWindowSize;
 
         // We need DYN_NOTCH_CALC_TICKS tick to update all axis with newly sampled value
-        state->updateTicks = DYN_NOTCH_CALC_TICKS;
+        state->updateTicks = DYN_NOTCH_CALC_TICKS(state->notchCount);
     }
 
     // calculate FFT and update filters
     if (state->updateTicks > 0) {
-        gyroDataAnalyseUpdate(state, notchFilterDyn);
+        gyroDataAnalyseUpdate(state, notchFilterDyn, notchTable);
         --state->updateTicks;
     }
 }
@@ -182,21 +257,89 @@ void arm_radix8_butterfly_f32(float32_t *pSrc, uint16_t fftLen, const float32_t
 void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTable);
 
 /*
- * Analyse last gyro data from the last FFT_WINDOW_SIZE milliseconds
+ * Find the notchCount strongest local maxima of the magnitude spectrum, ignoring bins below the mean level.
+ * Each peak is refined by fitting a parabola through the peak bin and its neighbours, and the result is
+ * stored in ascending frequency so every notch keeps tracking the same harmonic.
+ * Returns the interpolated bin index of the strongest peak, or 0 if none was found.
  */
-static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn)
+static FAST_CODE float gyroDataAnalyseFindPeaks(gyroAnalyseState_t *state)
 {
-    enum {
-        STEP_ARM_CFFT_F32,
-        STEP_BITREVERSAL,
-        STEP_STAGE_RFFT_F32,
-        STEP_ARM_CMPLX_MAG_F32,
-        STEP_CALC_FREQUENCIES,
-        STEP_UPDATE_FILTERS,
-        STEP_HANNING,
-        STEP_COUNT
-    };
+    const float *fftData = state->fftData;
+    const int notchCount = state->notchCount;
+
+    float fftMean = 0;
+    for (int i = 1 + fftBinOffset; i < fftBinCount; i++) {
+        fftMean += fftData[i];
+    }
+    fftMean /= fftBinCount - 1 - fftBinOffset;
+
+    // peaks in descending magnitude
+    float peakMag[DYN_NOTCH_COUNT_MAX];
+    uint8_t peakBin[DYN_NOTCH_COUNT_MAX];
+    int peakCount = 0;
+
+    for (int i = 1 + fftBinOffset; i < fftBinCount - 1; i++) {
+        const float data = fftData[i];
+        if (data <= fftMean || data <= fftData[i - 1] || data < fftData[i + 1]) {
+            continue;
+        }
+
+        int slot;
+        if (peakCount < notchCount) {
+            slot = peakCount++;
+        } else if (data > peakMag[notchCount - 1]) {
+            slot = notchCount - 1;
+        } else {
+            continue;
+        }
+        while (slot > 0 && peakMag[slot - 1] < data) {
+            peakMag[slot] = peakMag[slot - 1];
+            peakBin[slot] = peakBin[slot - 1];
+            slot--;
+        }
+        peakMag[slot] = data;
+        peakBin[slot] = i;
+    }
+
+    float strongestIndex = 0;
+    for (int peak = 0; peak < peakCount; peak++) {
+        const int i = peakBin[peak];
+        const float y0 = fftData[i - 1];
+        const float y1 = fftData[i];
+        const float y2 = fftData[i + 1];
+        const float denom = y0 - 2 * y1 + y2;
+        // vertex of the parabola, within half a bin of the peak bin
+        const float delta = (denom < 0) ? 0.5f * (y0 - y2) / denom : 0;
+        const float fftIndex = i + delta;
+
+        if (peak == 0) {
+            strongestIndex = fftIndex;
+        }
 
+        // insert in ascending frequency order
+        const float freq = fftIndex * fftResolution;
+        int slot = peak;
+        while (slot > 0 && state->peakFreq[slot - 1] > freq) {
+            state->peakFreq[slot] = state->peakFreq[slot - 1];
+            slot--;
+        }
+        state->peakFreq[slot] = freq;
+    }
+
+    // if no peak, go to highest point to minimise delay
+    for (int peak = peakCount; peak < notchCount; peak++) {
+        state->peakFreq[peak] = dynNotchMaxCentreHz;
+    }
+
+    return strongestIndex;
+}
+
+/*
+ * Analyse last gyro data from the last fftWindowSize samples
+ * times below are for 16 bins, see stepTimeUs
+ */
+static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilterXyz_t *notchFilterDyn, const biquadNotchTable_t *notchTable)
+{
     arm_cfft_instance_f32 *Sint = &(state->fftInstance.Sint);
 
     uint32_t startTime = 0;
@@ -205,10 +348,12 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
     }
 
     DEBUG_SET(DEBUG_FFT_TIME, 0, state->updateStep);
-    switch (state->updateStep) {
+    bool nextStepInTick;
+    do {
+        switch (state->updateStep) {
         case STEP_ARM_CFFT_F32:
         {
-            switch (FFT_BIN_COUNT) {
+            switch (fftBinCount) {
             case 16:
                 // 16us
                 arm_cfft_radix8by2_f32(Sint, state->fftData);
@@ -219,7 +364,7 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
                 break;
             case 64:
                 // 70us
-                arm_radix8_butterfly_f32(state->fftData, FFT_BIN_COUNT, Sint->pTwiddle, 1);
+                arm_radix8_butterfly_f32(state->fftData, fftBinCount, Sint->pTwiddle, 1);
                 break;
             }
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
@@ -230,8 +375,7 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
             // 6us
             arm_bitreversal_32((uint32_t*) state->fftData, Sint->bitRevLength, Sint->pBitRevTable);
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
-            state->updateStep++;
-            FALLTHROUGH;
+            break;
         }
         case STEP_STAGE_RFFT_F32:
         {
@@ -244,91 +388,71 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
         case STEP_ARM_CMPLX_MAG_F32:
         {
             // 8us
-            arm_cmplx_mag_f32(state->rfftData, state->fftData, FFT_BIN_COUNT);
+            arm_cmplx_mag_f32(state->rfftData, state->fftData, fftBinCount);
             DEBUG_SET(DEBUG_FFT_TIME, 2, micros() - startTime);
-            state->updateStep++;
-            FALLTHROUGH;
+            break;
         }
         case STEP_CALC_FREQUENCIES:
         {
             // 13us
-            // calculate FFT centreFreq
-            float fftSum = 0;
-            float fftWeightedSum = 0;
-            bool fftIncreasing = false;
-
-            // iterate over fft data and calculate weighted indices
-            for (int i = 1 + fftBinOffset; i < FFT_BIN_COUNT; i++) {
-                const float data = state->fftData[i];
-                const float prevData = state->fftData[i - 1];
-
-                if (fftIncreasing || data > prevData * FFT_MIN_BIN_RISE) {
-                    float cubedData = data * data * data;
-
-                    // add previous bin before first rise
-                    if (!fftIncreasing) {
-                        cubedData += prevData * prevData * prevData;
-
-                        fftIncreasing = true;
-                    }
-
-                    fftSum += cubedData;
-                    // calculate weighted index starting at 1, not 0
-                    fftWeightedSum += cubedData * (i + 1);
-                }
-            }
-
-            // get weighted center of relevant frequency range (this way we have a better resolution than 31.25Hz)
-            // if no peak, go to highest point to minimise delay
-            float centerFreq = dynNotchMaxCentreHz;
-            float fftMeanIndex = 0;
-
-            if (fftSum > 0) {
-                // idx was shifted by 1 to start at 1, not 0
-                fftMeanIndex = (fftWeightedSum / fftSum) - 1;
-                // the index points at the center frequency of each bin so index 0 is actually 16.125Hz
-                centerFreq = constrain(fftMeanIndex * fftResolution, DYN_NOTCH_MIN_CENTRE_HZ, dynNotchMaxCentreHz);
-            }
-
-            centerFreq = biquadFilterApply(&state->detectedFrequencyFilter[state->updateAxis], centerFreq);
-            centerFreq = constrain(centerFreq, DYN_NOTCH_MIN_CENTRE_HZ, dynNotchMaxCentreHz);
-            state->centerFreq[state->updateAxis] = centerFreq;
+            // find the strongest peaks, the notches are smoothed and updated one per tick afterwards
+            const float fftPeakIndex = gyroDataAnalyseFindPeaks(state);
 
             if (state->updateAxis == 0) {
-               DEBUG_SET(DEBUG_FFT, 3, lrintf(fftMeanIndex * 100));
+               DEBUG_SET(DEBUG_FFT, 3, lrintf(fftPeakIndex * 100));
             }
-            DEBUG_SET(DEBUG_FFT_FREQ, state->updateAxis, state->centerFreq[state->updateAxis]);
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
             break;
         }
         case STEP_UPDATE_FILTERS:
         {
             // 7us
-            // calculate cutoffFreq and notch Q, update notch filter
-            const float cutoffFreq = fmax(state->centerFreq[state->updateAxis] * dynamicNotchCutoff, DYN_NOTCH_MIN_CUTOFF_HZ);
-            const float notchQ = filterGetNotchQ(state->centerFreq[state->updateAxis], cutoffFreq);
-            biquadFilterUpdate(&notchFilterDyn[state->updateAxis], state->centerFreq[state->updateAxis], gyro.targetLooptime, notchQ, FILTER_NOTCH);
+            // smooth centre frequency, calculate cutoffFreq and notch Q, update notch filter
+            const int notch = state->updateNotch;
+            float centerFreq = biquadFilterApply(&state->detectedFrequencyFilter[state->updateAxis][notch], state->peakFreq[notch]);
+            centerFreq = constrain(centerFreq, dynNotchMinCentreHz, dynNotchMaxCentreHz);
+            state->centerFreq[state->updateAxis][notch] = centerFreq;
+
+            const float cutoffFreq = fmax(centerFreq * dynamicNotchCutoff, dynNotchMinCutoffHz);
+            const float notchQ = filterGetNotchQ(centerFreq, cutoffFreq);
+            if (biquadNotchTableMatches(notchTable, gyro.targetLooptime, notchQ)) {
+                biquadFilterXyzUpdateNotchFromTable(&notchFilterDyn[notch], state->updateAxis, notchTable, centerFreq);
+            } else {
+                biquadFilterXyzUpdate(&notchFilterDyn[notch], state->updateAxis, centerFreq, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+            }
+
+            if (notch == 0) {
+                DEBUG_SET(DEBUG_FFT_FREQ, state->updateAxis, state->centerFreq[state->updateAxis][0]);
+            }
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
 
+            if (++state->updateNotch < state->notchCount) {
+                // stay on this step, the next notch is updated on the next tick
+                return;
+            }
+            state->updateNotch = 0;
+
             state->updateAxis = (state->updateAxis + 1) % XYZ_AXIS_COUNT;
-            state->updateStep++;
-            FALLTHROUGH;
+            break;
         }
         case STEP_HANNING:
         {
             // 5us
             // apply hanning window to gyro samples and store result in fftData
             // hanning starts and ends with 0, could be skipped for minor speed improvement
-            const uint8_t ringBufIdx = FFT_WINDOW_SIZE - state->circularBufferIdx;
+            const uint8_t ringBufIdx = fftWindowSize - state->circularBufferIdx;
             arm_mult_f32(&state->downsampledGyroData[state->updateAxis][state->circularBufferIdx], &hanningWindow[0], &state->fftData[0], ringBufIdx);
             if (state->circularBufferIdx > 0) {
                 arm_mult_f32(&state->downsampledGyroData[state->updateAxis][0], &hanningWindow[ringBufIdx], &state->fftData[ringBufIdx], state->circularBufferIdx);
             }
 
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+            break;
+        }
         }
-    }
 
-    state->updateStep = (state->updateStep + 1) % STEP_COUNT;
+        nextStepInTick = stepFallthrough & (1 << state->updateStep);
+        state->updateStep = (state->updateStep + 1) % STEP_COUNT;
+    } while (nextStepInTick);
 }
 #endif // USE_GYRO_DATA_ANALYSE
@@ -25,8 +25,15 @@
 #include "common/time.h"
 #include "common/filter.h"
 
+#include "sensors/gyro.h"
+
+// window size is set at runtime by dyn_notch_fft_size, buffers are sized for the largest one
+#ifdef STM32F3
 // max for F3 targets
-#define FFT_WINDOW_SIZE 32
+#define FFT_WINDOW_SIZE_MAX 32
+#else
+#define FFT_WINDOW_SIZE_MAX 128
+#endif
 
 typedef struct gyroAnalyseState_s {
     // accumulator for oversampled data => no aliasing and less noise
@@ -40,23 +47,31 @@ typedef struct gyroAnalyseState_s {
 
     // downsampled gyro data circular buffer for frequency analysis
     uint8_t circularBufferIdx;
-    float downsampledGyroData[XYZ_AXIS_COUNT][FFT_WINDOW_SIZE];
+    float downsampledGyroData[XYZ_AXIS_COUNT][FFT_WINDOW_SIZE_MAX];
 
     // update state machine step information
     uint8_t updateTicks;
     uint8_t updateStep;
     uint8_t updateAxis;
+    uint8_t updateNotch;
+
+    // number of peaks tracked per axis, one dynamic notch each
+    uint8_t notchCount;
 
     arm_rfft_fast_instance_f32 fftInstance;
-    float fftData[FFT_WINDOW_SIZE];
-    float rfftData[FFT_WINDOW_SIZE];
+    float fftData[FFT_WINDOW_SIZE_MAX];
+    float rfftData[FFT_WINDOW_SIZE_MAX];
+
+    // interpolated peaks of the axis being analysed, in ascending frequency
+    float peakFreq[DYN_NOTCH_COUNT_MAX];
 
-    biquadFilter_t detectedFrequencyFilter[XYZ_AXIS_COUNT];
-    uint16_t centerFreq[XYZ_AXIS_COUNT];
+    biquadFilter_t detectedFrequencyFilter[XYZ_AXIS_COUNT][DYN_NOTCH_COUNT_MAX];
+    uint16_t centerFreq[XYZ_AXIS_COUNT][DYN_NOTCH_COUNT_MAX];
 } gyroAnalyseState_t;
 
-STATIC_ASSERT(FFT_WINDOW_SIZE <= (uint8_t) -1, window_size_greater_than_underlying_type);
+STATIC_ASSERT(FFT_WINDOW_SIZE_MAX <= (uint8_t) -1, window_size_greater_than_underlying_type);
 
-void gyroDataAnalyseStateInit(gyroAnalyseState_t *gyroAnalyse, uint32_t targetLooptime);
+void gyroDataAnalyseStateInit(gyroAnalyseState_t *gyroAnalyse, uint32_t targetLooptime, uint8_t notchCount);
 void gyroDataAnalysePush(gyroAnalyseState_t *gyroAnalyse, int axis, float sample);
-void gyroDataAnalyse(gyroAnalyseState_t *gyroAnalyse, biquadFilter_t *notchFilterDyn);
+void gyroDataAnalyseInitNotchTable(biquadNotchTable_t *notchTable, uint32_t targetLooptimeUs);
+void gyroDataAnalyse(gyroAnalyseState_t *gyroAnalyse, biquadFilterXyz_t *notchFilterDyn, const biquadNotchTable_t *notchTable);
@@ -43,6 +43,7 @@ const timerHardware_t timerHardware[1]; // unused
 
 #include "drivers/accgyro/accgyro_fake.h"
 #include "flight/imu.h"
+#include "sensors/gyro.h"
 
 #include "config/feature.h"
 #include "fc/config.h"
@@ -60,11 +61,12 @@ static servo_packet pwmPkt;
 
 static struct timespec start_time;
 static double simRate = 1.0;
-static pthread_t tcpWorker, udpWorker;
+static pthread_t tcpWorker, udpWorker, replayWorker, gyroExtiWorker;
 static bool workerRunning = true;
 static udpLink_t stateLink, pwmLink;
 static pthread_mutex_t updateLock;
 static pthread_mutex_t mainLoopLock;
+static FILE *gyroReplayFile;
 
 int timeval_sub(struct timespec *result, struct timespec *x, struct timespec *y);
 
@@ -186,6 +188,57 @@ static void* udpThread(void* data) {
     return NULL;
 }
 
+// replay recorded gyro data, one "time_us,gyroX,gyroY,gyroZ" line (deg/s) per sample
+// lines that do not start with a number, like a csv header, are skipped
+static void* gyroReplayThread(void* data) {
+    UNUSED(data);
+    char line[256];
+    double lastTimeUs = -1;
+    uint32_t samples = 0;
+
+    while (!fakeGyroDev && workerRunning) { // wait for gyro init
+        delayMicroseconds_real(1000);
+    }
+
+    while (workerRunning && fgets(line, sizeof(line), gyroReplayFile)) {
+        double timeUs, gx, gy, gz;
+        if (sscanf(line, "%lf,%lf,%lf,%lf", &timeUs, &gx, &gy, &gz) != 4) {
+            continue;
+        }
+
+        if (lastTimeUs >= 0 && timeUs > lastTimeUs) {
+            delayMicroseconds_real(constrainf((timeUs - lastTimeUs) / simRate, 1, 100000));
+        }
+        lastTimeUs = timeUs;
+
+        fakeGyroSet(fakeGyroDev,
+            constrain(gx * GYRO_SCALE, -32767, 32767),
+            constrain(gy * GYRO_SCALE, -32767, 32767),
+            constrain(gz * GYRO_SCALE, -32767, 32767));
+        samples++;
+    }
+
+    fclose(gyroReplayFile);
+    printf("[replay]gyro replay done, %u samples\n", samples);
+    return NULL;
+}
+
+// data ready interrupt of the gyro at its sample rate, feeds the sample queue when gyro_interrupt_sync is on
+static void* gyroExtiThread(void* data) {
+    UNUSED(data);
+
+    while (workerRunning) {
+        const uint32_t looptimeUs = gyro.targetLooptime ? gyro.targetLooptime : 1000; // gyro not initialised yet
+        delayMicroseconds_real(constrainf(looptimeUs / simRate, 1, 100000));
+        if (fakeGyroDev) {
+            fakeGyroDataReady(fakeGyroDev);
+        }
+    }
+
+    printf("gyroExtiThread end!!\n");
+    return NULL;
+}
+
 static void* tcpThread(void* data) {
     UNUSED(data);
 
@@ -240,6 +293,27 @@ void systemInit(void) {
         exit(1);
     }
 
+    ret = pthread_create(&gyroExtiWorker, NULL, gyroExtiThread, NULL);
+    if (ret != 0) {
+        printf("Create gyroExtiWorker error!\n");
+        exit(1);
+    }
+
+    const char *gyroReplayPath = getenv("SITL_GYRO_REPLAY");
+    if (gyroReplayPath) {
+        gyroReplayFile = fopen(gyroReplayPath, "r");
+        if (!gyroReplayFile) {
+            printf("Open gyro replay %s error!\n", gyroReplayPath);
+            exit(1);
+        }
+        ret = pthread_create(&replayWorker, NULL, gyroReplayThread, NULL);
+        if (ret != 0) {
+            printf("Create replayWorker error!\n");
+            exit(1);
+        }
+        printf("replay gyro from %s\n", gyroReplayPath);
+    }
+
     // serial can't been slow down
     rescheduleTask(TASK_SERIAL, 1);
 }
@@ -249,6 +323,10 @@ void systemReset(void){
     workerRunning = false;
     pthread_join(tcpWorker, NULL);
     pthread_join(udpWorker, NULL);
+    pthread_join(gyroExtiWorker, NULL);
+    if (gyroReplayFile) {
+        pthread_join(replayWorker, NULL);
+    }
     exit(0);
 }
 void systemResetToBootloader(void) {
@@ -256,6 +334,10 @@ void systemResetToBootloader(void) {
     workerRunning = false;
     pthread_join(tcpWorker, NULL);
     pthread_join(udpWorker, NULL);
+    pthread_join(gyroExtiWorker, NULL);
+    if (gyroReplayFile) {
+        pthread_join(replayWorker, NULL);
+    }
     exit(0);
 }
 
@@ -467,7 +549,7 @@ char _Min_Stack_Size;
 
 // fake EEPROM
 static FILE *eepromFd = NULL;
-uint8_t eepromData[EEPROM_SIZE];
+uint8_t eepromData[EEPROM_SIZE] __attribute__((aligned(FLASH_PAGE_SIZE)));
 
 void FLASH_Unlock(void) {
     if (eepromFd != NULL) {
@@ -516,8 +598,12 @@ void FLASH_Lock(void) {
 }
 
 FLASH_Status FLASH_ErasePage(uintptr_t Page_Address) {
-    UNUSED(Page_Address);
-//    printf("[FLASH_ErasePage]%x\n", Page_Address);
+    if ((Page_Address >= (uintptr_t)eepromData) && (Page_Address < (uintptr_t)ARRAYEND(eepromData))) {
+        memset((void*)Page_Address, 0xFF, FLASH_PAGE_SIZE);
+//        printf("[FLASH_ErasePage]%p\n", (void*)Page_Address);
+    } else {
+        printf("[FLASH_ErasePage]%p out of range!\n", (void*)Page_Address);
+    }
     return FLASH_COMPLETE;
 }
 
@@ -44,6 +44,8 @@
 #define EEPROM_FILENAME "eeprom.bin"
 #define EEPROM_IN_RAM
 #define EEPROM_SIZE     32768
+#define EEPROM_BANK_COUNT 2
+#define FLASH_PAGE_SIZE (0x400)
 
 #define U_ID_0 0
 #define U_ID_1 1
@@ -62,6 +64,7 @@
 
 #define USE_GYRO
 #define USE_FAKE_GYRO
+#define USE_GYRO_DATA_ANALYSE
 
 #define USE_MAG
 #define USE_FAKE_MAG
@@ -36,6 +36,7 @@
 
 #ifdef STM32F1
 #define MINIMAL_CLI
+#define USE_FIXED_POINT_FILTERS
 // Using RX DMA disables the use of receive callbacks
 #define USE_UART1_RX_DMA
 #define USE_UART1_TX_DMA
@@ -322,6 +322,11 @@ uint32_t CDC_Send_FreeBytes(void)
     return 255;
 }
 
+uint32_t CDC_Send_BufferSize(void)
+{
+    return CDC_Send_FreeBytes();
+}
+
 /*******************************************************************************
  * Function Name  : Receive DATA .
  * Description    : receive the data from the PC to STM32 and send it through USB
@@ -46,6 +46,8 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
+
 #include "drivers/serial_usb_vcp.h"
 #include "drivers/time.h"
 
@@ -57,7 +59,8 @@
 #include "stdbool.h"
 
 #include "drivers/nvic.h"
-#include "build/atomic.h"
+#include "common/maths.h"
+#include "common/ring_buffer.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -77,12 +80,10 @@ USBD_CDC_LineCodingTypeDef LineCoding =
 };
 
 volatile uint8_t UserRxBuffer[APP_RX_DATA_SIZE];/* Received Data over USB are stored in this buffer */
-volatile uint8_t UserTxBuffer[APP_TX_DATA_SIZE];/* Received Data over UART (CDC interface) are stored in this buffer */
+uint8_t UserTxBuffer[APP_TX_DATA_SIZE];/* Received Data over UART (CDC interface) are stored in this buffer */
 uint32_t BuffLength;
-volatile uint32_t UserTxBufPtrIn = 0;/* Increment this pointer or roll it back to
-                               start address when data are received over USART */
-volatile uint32_t UserTxBufPtrOut = 0; /* Increment this pointer or roll it back to
-                                 start address when data are sent over USB */
+/* Filled by CDC_Send_DATA and emptied by the timer callback as data are sent over USB */
+static ringBuffer_t UserTxRing = { .buffer = UserTxBuffer, .mask = APP_TX_DATA_SIZE - 1 };
 
 uint32_t rxAvailable = 0;
 uint8_t* rxBuffPtr = NULL;
@@ -259,23 +260,17 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
         // endpoint has finished transmitting previous block
         if (lastBuffsize) {
             // move the ring buffer tail based on the previous succesful transmission
-            UserTxBufPtrOut += lastBuffsize;
-            if (UserTxBufPtrOut == APP_TX_DATA_SIZE) {
-                UserTxBufPtrOut = 0;
-            }
+            ringBufferConsume(&UserTxRing, lastBuffsize);
             lastBuffsize = 0;
         }
-        if (UserTxBufPtrOut != UserTxBufPtrIn) {
-            if (UserTxBufPtrOut > UserTxBufPtrIn) { /* Roll-back */
-                buffsize = APP_TX_DATA_SIZE - UserTxBufPtrOut;
-            } else {
-                buffsize = UserTxBufPtrIn - UserTxBufPtrOut;
-            }
+        uint8_t *span;
+        buffsize = ringBufferPeekSpan(&UserTxRing, &span);
+        if (buffsize) {
             if (buffsize > APP_TX_BLOCK_SIZE) {
                 buffsize = APP_TX_BLOCK_SIZE;
             }
 
-            USBD_CDC_SetTxBuffer(&USBD_Device, (uint8_t*)&UserTxBuffer[UserTxBufPtrOut], buffsize);
+            USBD_CDC_SetTxBuffer(&USBD_Device, span, buffsize);
 
             if (USBD_CDC_TransmitPacket(&USBD_Device) == USBD_OK) {
                 lastBuffsize = buffsize;
@@ -349,17 +344,14 @@ static void Error_Handler(void)
 uint32_t CDC_Receive_DATA(uint8_t* recvBuf, uint32_t len)
 {
     uint32_t count = 0;
-    if ( (rxBuffPtr != NULL))
+    if ((rxBuffPtr != NULL) && rxAvailable > 0)
     {
-        while ((rxAvailable > 0) && count < len)
-        {
-            recvBuf[count] = rxBuffPtr[0];
-            rxBuffPtr++;
-            rxAvailable--;
-            count++;
-            if (rxAvailable < 1)
-                USBD_CDC_ReceivePacket(&USBD_Device);
-        }
+        count = MIN(rxAvailable, len);
+        memcpy(recvBuf, rxBuffPtr, count);
+        rxBuffPtr += count;
+        rxAvailable -= count;
+        if (rxAvailable < 1)
+            USBD_CDC_ReceivePacket(&USBD_Device);
     }
     return count;
 }
@@ -371,20 +363,13 @@ uint32_t CDC_Receive_BytesAvailable(void)
 
 uint32_t CDC_Send_FreeBytes(void)
 {
-    /*
-        return the bytes free in the circular buffer
-
-        functionally equivalent to:
-        (APP_Rx_ptr_out > APP_Rx_ptr_in ? APP_Rx_ptr_out - APP_Rx_ptr_in : APP_RX_DATA_SIZE - APP_Rx_ptr_in + APP_Rx_ptr_in)
-        but without the impact of the condition check.
-    */
-    uint32_t freeBytes;
-
-    ATOMIC_BLOCK(NVIC_BUILD_PRIORITY(6, 0)) {
-        freeBytes = ((UserTxBufPtrOut - UserTxBufPtrIn) + (-((int)(UserTxBufPtrOut <= UserTxBufPtrIn)) & APP_TX_DATA_SIZE)) - 1;
-    }
+    /* return the bytes free in the circular buffer */
+    return ringBufferFree(&UserTxRing);
+}
 
-    return freeBytes;
+uint32_t CDC_Send_BufferSize(void)
+{
+    return ringBufferSize(&UserTxRing);
 }
 
 /**
@@ -397,15 +382,14 @@ uint32_t CDC_Send_FreeBytes(void)
  */
 uint32_t CDC_Send_DATA(const uint8_t *ptrBuffer, uint32_t sendLength)
 {
-    for (uint32_t i = 0; i < sendLength; i++) {
-        while (CDC_Send_FreeBytes() == 0) {
+    uint32_t sent = 0;
+    while (sent < sendLength) {
+        const uint32_t written = ringBufferPushN(&UserTxRing, ptrBuffer + sent, sendLength - sent);
+        if (!written) {
             // block until there is free space in the ring buffer
             delay(1);
         }
-        ATOMIC_BLOCK(NVIC_BUILD_PRIORITY(6, 0)) { // Paranoia
-            UserTxBuffer[UserTxBufPtrIn] = ptrBuffer[i];
-            UserTxBufPtrIn = (UserTxBufPtrIn + 1) % APP_TX_DATA_SIZE;
-        }
+        sent += written;
     }
     return sendLength;
 }
@@ -83,6 +83,7 @@ extern USBD_CDC_ItfTypeDef  USBD_CDC_fops;
 
 uint32_t CDC_Send_DATA(const uint8_t *ptrBuffer, uint32_t sendLength);
 uint32_t CDC_Send_FreeBytes(void);
+uint32_t CDC_Send_BufferSize(void);
 uint32_t CDC_Receive_DATA(uint8_t* recvBuf, uint32_t len);
 uint32_t CDC_Receive_BytesAvailable(void);
 uint8_t usbIsConfigured(void);
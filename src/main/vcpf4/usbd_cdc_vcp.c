@@ -27,6 +27,7 @@
 #include "usbd_cdc_vcp.h"
 #include "stm32f4xx_conf.h"
 #include "stdbool.h"
+#include "common/ring_buffer.h"
 #include "drivers/time.h"
 
 LINE_CODING g_lc;
@@ -49,8 +50,7 @@ extern uint32_t APP_Rx_ptr_in;
     to the USB device (flight controller).
 */
 static uint8_t APP_Tx_Buffer[APP_TX_DATA_SIZE];
-static uint32_t APP_Tx_ptr_out = 0;
-static uint32_t APP_Tx_ptr_in = 0;
+static ringBuffer_t APP_Tx_Ring = { .buffer = APP_Tx_Buffer, .mask = APP_TX_DATA_SIZE - 1 };
 
 /* Private function prototypes -----------------------------------------------*/
 static uint16_t VCP_Init(void);
@@ -192,6 +192,12 @@ uint32_t CDC_Send_FreeBytes(void)
     return ((APP_Rx_ptr_out - APP_Rx_ptr_in) + (-((int)(APP_Rx_ptr_out <= APP_Rx_ptr_in)) & APP_RX_DATA_SIZE)) - 1;
 }
 
+uint32_t CDC_Send_BufferSize(void)
+{
+    /* one byte of the circular buffer is always left free */
+    return APP_RX_DATA_SIZE - 1;
+}
+
 /**
  * @brief  VCP_DataTx
  *         CDC data to be sent to the Host (app) over USB
@@ -229,20 +235,13 @@ static uint16_t VCP_DataTx(const uint8_t* Buf, uint32_t Len)
  *******************************************************************************/
 uint32_t CDC_Receive_DATA(uint8_t* recvBuf, uint32_t len)
 {
-    uint32_t count = 0;
-
-    while (APP_Tx_ptr_out != APP_Tx_ptr_in && count < len) {
-        recvBuf[count] = APP_Tx_Buffer[APP_Tx_ptr_out];
-        APP_Tx_ptr_out = (APP_Tx_ptr_out + 1) % APP_TX_DATA_SIZE;
-        count++;
-    }
-    return count;
+    return ringBufferPopN(&APP_Tx_Ring, recvBuf, len);
 }
 
 uint32_t CDC_Receive_BytesAvailable(void)
 {
     /* return the bytes available in the receive circular buffer */
-    return APP_Tx_ptr_out > APP_Tx_ptr_in ? APP_TX_DATA_SIZE - APP_Tx_ptr_out + APP_Tx_ptr_in : APP_Tx_ptr_in - APP_Tx_ptr_out;
+    return ringBufferUsed(&APP_Tx_Ring);
 }
 
 /**
@@ -262,14 +261,11 @@ uint32_t CDC_Receive_BytesAvailable(void)
  */
 static uint16_t VCP_DataRx(uint8_t* Buf, uint32_t Len)
 {
-    if (CDC_Receive_BytesAvailable() + Len > APP_TX_DATA_SIZE) {
+    if (ringBufferFree(&APP_Tx_Ring) < Len) {
         return USBD_FAIL;
     }
 
-    for (uint32_t i = 0; i < Len; i++) {
-        APP_Tx_Buffer[APP_Tx_ptr_in] = Buf[i];
-        APP_Tx_ptr_in = (APP_Tx_ptr_in + 1) % APP_TX_DATA_SIZE;
-    }
+    ringBufferPushN(&APP_Tx_Ring, Buf, Len);
 
     return USBD_OK;
 }
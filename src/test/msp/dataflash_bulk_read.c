@@ -0,0 +1,341 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Reference client for MSP2_EMUF_DATAFLASH_BULK_READ. Connects over TCP, downloads the dataflash and reports the
+ * throughput. The SITL target has no dataflash, so run it against a flight controller behind a TCP to serial
+ * bridge, for example socat tcp-listen:5761,reuseaddr /dev/ttyACM0,raw,echo=0
+ *
+ *   dataflash_bulk_read [-h host] [-p port] [-a address] [-l length] [-c chunk size] [-w window] [-d drop %] [file]
+ *
+ * Without -l the used part of the volume is read. The FC cuts the chunk size down to what its port sends in one
+ * frame, 228 bytes on a UART. -d throws away that share of the chunks received, to exercise
+ * the selective acks and resends.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+#include "common/crc.h"
+
+#include "interface/msp_protocol.h"
+#include "interface/msp_protocol_v2_emuflight.h"
+
+#define MSP_MAX_PAYLOAD 65535
+#define ACK_IDLE_MS     20
+
+typedef struct mspFrame_s {
+    uint16_t cmd;
+    bool error;
+    uint16_t size;
+    uint8_t payload[MSP_MAX_PAYLOAD];
+} mspFrame_t;
+
+static int sock = -1;
+static uint8_t rxBuf[1 << 16];
+static size_t rxLength;
+
+static uint32_t framesBad;
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void putU16(uint8_t *p, uint16_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void putU32(uint8_t *p, uint32_t v)
+{
+    putU16(p, v);
+    putU16(p + 2, v >> 16);
+}
+
+static uint16_t getU16(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static uint32_t getU32(const uint8_t *p)
+{
+    return getU16(p) | (uint32_t)getU16(p + 2) << 16;
+}
+
+static bool mspSend(uint16_t cmd, const uint8_t *payload, uint16_t size)
+{
+    uint8_t frame[9 + 64];
+    if (size > sizeof(frame) - 9) {
+        return false;
+    }
+    frame[0] = '$';
+    frame[1] = 'X';
+    frame[2] = '<';
+    frame[3] = 0;
+    putU16(&frame[4], cmd);
+    putU16(&frame[6], size);
+    memcpy(&frame[8], payload, size);
+    frame[8 + size] = crc8_dvb_s2_update(0, &frame[3], 5 + size);
+    return send(sock, frame, 9 + size, 0) == 9 + size;
+}
+
+// returns 1 with a frame, 0 on timeout, -1 when the connection is gone
+static int mspReceive(mspFrame_t *frame, int timeoutMs)
+{
+    for (;;) {
+        // look for a complete v2 frame in what has been received
+        size_t start = 0;
+        while (start < rxLength) {
+            if (rxBuf[start] != '$') {
+                start++;
+                continue;
+            }
+            if (rxLength - start < 8) {
+                break;
+            }
+            if (rxBuf[start + 1] != 'X' || (rxBuf[start + 2] != '>' && rxBuf[start + 2] != '!')) {
+                start++;
+                continue;
+            }
+            const uint16_t size = getU16(&rxBuf[start + 6]);
+            if (rxLength - start < 9u + size) {
+                break;
+            }
+            const uint8_t crc = crc8_dvb_s2_update(0, &rxBuf[start + 3], 5 + size);
+            if (crc != rxBuf[start + 8 + size]) {
+                framesBad++;
+                start++;
+                continue;
+            }
+            frame->cmd = getU16(&rxBuf[start + 4]);
+            frame->error = rxBuf[start + 2] == '!';
+            frame->size = size;
+            memcpy(frame->payload, &rxBuf[start + 8], size);
+            start += 9 + size;
+            memmove(rxBuf, &rxBuf[start], rxLength - start);
+            rxLength -= start;
+            return 1;
+        }
+        memmove(rxBuf, &rxBuf[start], rxLength - start);
+        rxLength -= start;
+
+        struct pollfd pfd = { .fd = sock, .events = POLLIN };
+        const int ready = poll(&pfd, 1, timeoutMs);
+        if (ready <= 0) {
+            return ready < 0 ? -1 : 0;
+        }
+        const ssize_t got = recv(sock, &rxBuf[rxLength], sizeof(rxBuf) - rxLength, 0);
+        if (got <= 0) {
+            return -1;
+        }
+        rxLength += got;
+    }
+}
+
+static int mspRequest(uint16_t cmd, const uint8_t *payload, uint16_t size, mspFrame_t *reply)
+{
+    if (!mspSend(cmd, payload, size)) {
+        return -1;
+    }
+    for (;;) {
+        const int status = mspReceive(reply, 1000);
+        if (status <= 0) {
+            return status;
+        }
+        if (reply->cmd == cmd) {
+            return reply->error ? -1 : 1;
+        }
+    }
+}
+
+static int connectTo(const char *host, int port)
+{
+    struct sockaddr_in addr = { .sin_family = AF_INET, .sin_port = htons(port) };
+    if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) {
+        return -1;
+    }
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return fd;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *host = "127.0.0.1";
+    int port = 5761;
+    uint32_t address = 0;
+    int64_t length = -1;
+    int chunkSize = 1024;
+    int window = 16;
+    int dropPercent = 0;
+    const char *outPath = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "h:p:a:l:c:w:d:")) != -1) {
+        switch (opt) {
+        case 'h': host = optarg; break;
+        case 'p': port = atoi(optarg); break;
+        case 'a': address = strtoul(optarg, NULL, 0); break;
+        case 'l': length = strtoll(optarg, NULL, 0); break;
+        case 'c': chunkSize = atoi(optarg); break;
+        case 'w': window = atoi(optarg); break;
+        case 'd': dropPercent = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-h host] [-p port] [-a address] [-l length] [-c chunk size] [-w window] [-d drop %%] [file]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind < argc) {
+        outPath = argv[optind];
+    }
+
+    sock = connectTo(host, port);
+    if (sock < 0) {
+        fprintf(stderr, "cannot connect to %s:%d: %s\n", host, port, strerror(errno));
+        return 1;
+    }
+
+    static mspFrame_t frame;
+    if (length < 0) {
+        if (mspRequest(MSP_DATAFLASH_SUMMARY, NULL, 0, &frame) <= 0 || frame.size < 13) {
+            fprintf(stderr, "no reply to MSP_DATAFLASH_SUMMARY\n");
+            return 1;
+        }
+        length = getU32(&frame.payload[9]) - address;
+    }
+
+    uint8_t request[11];
+    putU32(&request[0], address);
+    putU32(&request[4], length);
+    putU16(&request[8], chunkSize);
+    request[10] = window;
+    if (mspRequest(MSP2_EMUF_DATAFLASH_BULK_READ, request, sizeof(request), &frame) <= 0 || frame.size < 13) {
+        fprintf(stderr, "no reply to MSP2_EMUF_DATAFLASH_BULK_READ\n");
+        return 1;
+    }
+    address = getU32(&frame.payload[0]);
+    length = getU32(&frame.payload[4]);
+    chunkSize = getU16(&frame.payload[8]);
+    window = frame.payload[10];
+    const int chunkCount = getU16(&frame.payload[11]);
+
+    uint8_t *data = calloc(length ? length : 1, 1);
+    bool *received = calloc(chunkCount ? chunkCount : 1, sizeof(bool));
+    int firstMissing = 0;
+    int sinceAck = 0;
+    uint32_t chunksBad = 0;
+    uint32_t chunksDuplicate = 0;
+    uint32_t chunksDropped = 0;
+    const int ackEvery = window / 4 > 0 ? window / 4 : 1;
+    const double start = nowSeconds();
+
+    while (firstMissing < chunkCount) {
+        const int status = mspReceive(&frame, ACK_IDLE_MS);
+        if (status < 0) {
+            fprintf(stderr, "connection lost\n");
+            return 1;
+        }
+        bool gap = false;
+        if (status > 0 && frame.cmd == MSP2_EMUF_DATAFLASH_BULK_CHUNK && frame.size >= 10) {
+            const int sequence = getU16(&frame.payload[0]);
+            const uint16_t chunkLength = getU16(&frame.payload[6]);
+            if (frame.size != 10 + chunkLength || sequence >= chunkCount
+                || getU16(&frame.payload[8 + chunkLength]) != crc16_ccitt_update(0, &frame.payload[8], chunkLength)) {
+                chunksBad++;
+                continue;
+            }
+            if (dropPercent && rand() % 100 < dropPercent) {
+                chunksDropped++;
+                continue;
+            }
+            if (received[sequence]) {
+                chunksDuplicate++;
+                continue;
+            }
+            memcpy(&data[(size_t)sequence * chunkSize], &frame.payload[8], chunkLength);
+            received[sequence] = true;
+            gap = sequence > firstMissing;
+            while (firstMissing < chunkCount && received[firstMissing]) {
+                firstMissing++;
+            }
+            sinceAck++;
+        } else if (status > 0) {
+            continue;
+        }
+
+        // ack regularly, straight away when a chunk is missing and when the stream goes quiet
+        if (status == 0 || gap || sinceAck >= ackEvery || firstMissing == chunkCount) {
+            uint32_t mask = 0;
+            for (int i = 0; i < 32 && firstMissing + 1 + i < chunkCount; i++) {
+                if (received[firstMissing + 1 + i]) {
+                    mask |= 1U << i;
+                }
+            }
+            uint8_t ack[6];
+            putU16(&ack[0], firstMissing);
+            putU32(&ack[2], mask);
+            mspSend(MSP2_EMUF_DATAFLASH_BULK_ACK, ack, sizeof(ack));
+            sinceAck = 0;
+        }
+    }
+
+    const double elapsed = nowSeconds() - start;
+    printf("%lld bytes in %d chunks of %d, window %d: %.2f s, %.1f KiB/s\n",
+        (long long)length, chunkCount, chunkSize, window, elapsed, elapsed > 0 ? length / 1024.0 / elapsed : 0);
+    printf("%u bad, %u dropped, %u duplicate chunks, %u bad frames\n", chunksBad, chunksDropped, chunksDuplicate, framesBad);
+
+    if (outPath) {
+        FILE *out = fopen(outPath, "wb");
+        if (!out || fwrite(data, 1, length, out) != (size_t)length) {
+            fprintf(stderr, "cannot write %s\n", outPath);
+            return 1;
+        }
+        fclose(out);
+    }
+
+    free(data);
+    free(received);
+    close(sock);
+    return 0;
+}
@@ -0,0 +1,483 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host side replay of a blackbox log through the gyro -> filter -> PID -> mixer pipeline.
+ *
+ * The unfiltered gyro is taken from the debug fields when the log was recorded with
+ * debug_mode GYRO_SCALED or GYRO_RAW, the logged gyroADC is already filtered and is only
+ * used as a fallback. Setpoints and throttle are replayed from the log, the configuration
+ * is rebuilt from the log header and can be overridden with --set.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+
+#include "pg/pg.h"
+
+#include "drivers/accgyro/accgyro_fake.h"
+
+#include "fc/config.h"
+#include "fc/rc_controls.h"
+#include "fc/runtime_config.h"
+
+#include "flight/mixer.h"
+#include "flight/pid.h"
+
+#include "sensors/acceleration.h"
+#include "sensors/gyro.h"
+
+#include "replay_decoder.h"
+#include "replay.h"
+
+// LSB per deg/s of a 2000deg/s gyro, the range every supported gyro is run at
+#define REPLAY_GYRO_LSB_PER_DPS     16.4f
+#define REPLAY_OVERRIDE_COUNT_MAX   32
+
+typedef enum {
+    REPLAY_STAGE_GYRO = STAGE_COUNT,
+    REPLAY_STAGE_PID,
+    REPLAY_STAGE_MIXER,
+    REPLAY_STAGE_COUNT
+} replayStage_e;
+
+typedef struct replayStageStats_s {
+    const char *name;
+    uint64_t startNs;
+    uint64_t totalNs;
+    uint64_t maxNs;
+    uint32_t calls;
+} replayStageStats_t;
+
+static replayStageStats_t stageStats[REPLAY_STAGE_COUNT] = {
+    [STAGE_FILTER]       = { .name = "filter" },
+    [STAGE_KALMAN]       = { .name = "kalman" },
+    [STAGE_GYRO_ANALYSE] = { .name = "gyro_analyse" },
+    [REPLAY_STAGE_GYRO]  = { .name = "gyro_update" },
+    [REPLAY_STAGE_PID]   = { .name = "pid" },
+    [REPLAY_STAGE_MIXER] = { .name = "mixer" },
+};
+
+replayInput_t replayInput;
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void stageBegin(int stage)
+{
+    stageStats[stage].startNs = nowNs();
+}
+
+static void stageEnd(int stage)
+{
+    const uint64_t elapsed = nowNs() - stageStats[stage].startNs;
+    stageStats[stage].totalNs += elapsed;
+    stageStats[stage].maxNs = MAX(stageStats[stage].maxNs, elapsed);
+    stageStats[stage].calls++;
+}
+
+void stageTimingBegin(pipelineStage_e stage)
+{
+    stageBegin(stage);
+}
+
+void stageTimingEnd(pipelineStage_e stage)
+{
+    stageEnd(stage);
+}
+
+static uint8_t *loadFile(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    const long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint8_t *data = malloc(length > 0 ? length : 1);
+    if (data && fread(data, 1, length, f) != (size_t)length) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *size = length;
+    return data;
+}
+
+// parses up to count comma separated integers of a header line, returns the number parsed
+static int headerInts(const bblLog_t *log, const char *name, int *values, int count)
+{
+    char buf[128];
+    const char *s = bblHeaderValue(log, name, buf, sizeof(buf));
+    int parsed = 0;
+    while (s && *s && parsed < count) {
+        char *end;
+        values[parsed++] = strtol(s, &end, 10);
+        s = (*end == ',') ? end + 1 : NULL;
+    }
+    return parsed;
+}
+
+static void applyPid(const bblLog_t *log, const char *name, pidf_t *pid)
+{
+    int values[3];
+    if (headerInts(log, name, values, 3) == 3) {
+        pid->P = values[0];
+        pid->I = values[1];
+        pid->D = values[2];
+    }
+}
+
+static void applyHeaderConfig(const bblLog_t *log)
+{
+    gyroConfig_t *gyroCfg = gyroConfigMutable();
+    pidProfile_t *profile = pidProfilesMutable(0);
+    int values[2];
+
+    pidConfigMutable()->pid_process_denom = bblHeaderInt(log, "pid_process_denom", pidConfig()->pid_process_denom);
+
+    gyroCfg->gyro_lowpass_type = bblHeaderInt(log, "gyro_lowpass_type", gyroCfg->gyro_lowpass_type);
+    gyroCfg->gyro_lowpass_hz = bblHeaderInt(log, "gyro_lowpass_hz", gyroCfg->gyro_lowpass_hz);
+    gyroCfg->gyro_lowpass2_type = bblHeaderInt(log, "gyro_lowpass2_type", gyroCfg->gyro_lowpass2_type);
+    gyroCfg->gyro_lowpass2_hz = bblHeaderInt(log, "gyro_lowpass2_hz", gyroCfg->gyro_lowpass2_hz);
+    if (headerInts(log, "gyro_notch_hz", values, 2) == 2) {
+        gyroCfg->gyro_soft_notch_hz_1 = values[0];
+        gyroCfg->gyro_soft_notch_hz_2 = values[1];
+    }
+    if (headerInts(log, "gyro_notch_cutoff", values, 2) == 2) {
+        gyroCfg->gyro_soft_notch_cutoff_1 = values[0];
+        gyroCfg->gyro_soft_notch_cutoff_2 = values[1];
+    }
+
+    applyPid(log, "rollPID", &profile->pid[PID_ROLL]);
+    applyPid(log, "pitchPID", &profile->pid[PID_PITCH]);
+    applyPid(log, "yawPID", &profile->pid[PID_YAW]);
+    profile->dterm_filter_type = bblHeaderInt(log, "dterm_filter_type", profile->dterm_filter_type);
+    profile->dterm_lowpass_hz = bblHeaderInt(log, "dterm_lowpass_hz", profile->dterm_lowpass_hz);
+    profile->dterm_lowpass2_hz = bblHeaderInt(log, "dterm_lowpass2_hz", profile->dterm_lowpass2_hz);
+    profile->yaw_lowpass_hz = bblHeaderInt(log, "yaw_lowpass_hz", profile->yaw_lowpass_hz);
+    profile->dterm_notch_hz = bblHeaderInt(log, "dterm_notch_hz", profile->dterm_notch_hz);
+    profile->dterm_notch_cutoff = bblHeaderInt(log, "dterm_notch_cutoff", profile->dterm_notch_cutoff);
+    profile->itermWindupPointPercent = bblHeaderInt(log, "iterm_windup", profile->itermWindupPointPercent);
+    profile->pidSumLimit = bblHeaderInt(log, "pidsum_limit", profile->pidSumLimit);
+    profile->pidSumLimitYaw = bblHeaderInt(log, "pidsum_limit_yaw", profile->pidSumLimitYaw);
+    profile->vbatPidCompensation = 0;
+
+    // replay with analog endpoints at the logged output range so replayed and logged motors compare directly
+    if (headerInts(log, "motorOutput", values, 2) == 2) {
+        motorConfigMutable()->dev.motorPwmProtocol = PWM_TYPE_STANDARD;
+        motorConfigMutable()->minthrottle = values[0];
+        motorConfigMutable()->maxthrottle = values[1];
+        motorConfigMutable()->mincommand = values[0];
+    }
+}
+
+// --set name=value, a small set of the settings that shape the pipeline
+static bool applyOverride(const char *setting)
+{
+    char name[32];
+    const char *eq = strchr(setting, '=');
+    if (!eq || (size_t)(eq - setting) >= sizeof(name)) {
+        return false;
+    }
+    memcpy(name, setting, eq - setting);
+    name[eq - setting] = '\0';
+    const int value = atoi(eq + 1);
+
+    gyroConfig_t *gyroCfg = gyroConfigMutable();
+    pidProfile_t *profile = pidProfilesMutable(0);
+
+    if (!strcmp(name, "gyro_lowpass_type")) {
+        gyroCfg->gyro_lowpass_type = value;
+    } else if (!strcmp(name, "gyro_lowpass_hz")) {
+        gyroCfg->gyro_lowpass_hz = value;
+    } else if (!strcmp(name, "gyro_lowpass2_type")) {
+        gyroCfg->gyro_lowpass2_type = value;
+    } else if (!strcmp(name, "gyro_lowpass2_hz")) {
+        gyroCfg->gyro_lowpass2_hz = value;
+    } else if (!strcmp(name, "gyro_notch1_hz")) {
+        gyroCfg->gyro_soft_notch_hz_1 = value;
+    } else if (!strcmp(name, "gyro_notch1_cutoff")) {
+        gyroCfg->gyro_soft_notch_cutoff_1 = value;
+    } else if (!strcmp(name, "gyro_notch2_hz")) {
+        gyroCfg->gyro_soft_notch_hz_2 = value;
+    } else if (!strcmp(name, "gyro_notch2_cutoff")) {
+        gyroCfg->gyro_soft_notch_cutoff_2 = value;
+    } else if (!strcmp(name, "dyn_notch_count")) {
+        gyroCfg->dyn_notch_count = value;
+    } else if (!strcmp(name, "dyn_notch_min_hz")) {
+        gyroCfg->dyn_notch_min_hz = value;
+    } else if (!strcmp(name, "dyn_notch_quality")) {
+        gyroCfg->dyn_notch_quality = value;
+    } else if (!strcmp(name, "imuf_w")) {
+        gyroCfg->imuf_w = value;
+    } else if (!strcmp(name, "pid_process_denom")) {
+        pidConfigMutable()->pid_process_denom = value;
+    } else if (!strcmp(name, "dterm_lowpass_hz")) {
+        profile->dterm_lowpass_hz = value;
+    } else if (!strcmp(name, "dterm_lowpass2_hz")) {
+        profile->dterm_lowpass2_hz = value;
+    } else if (!strcmp(name, "dterm_notch_hz")) {
+        profile->dterm_notch_hz = value;
+    } else if (!strcmp(name, "dterm_notch_cutoff")) {
+        profile->dterm_notch_cutoff = value;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+typedef struct replayFields_s {
+    int time;
+    int gyro;
+    int setpoint;
+    int rcCommand;
+    int motor;
+    int motorCount;
+} replayFields_t;
+
+static void findFields(const bblLog_t *log, replayFields_t *fields, bool fromDebug)
+{
+    fields->time = bblFieldIndex(log, "time");
+    fields->gyro = bblFieldIndex(log, fromDebug ? "debug[0]" : "gyroADC[0]");
+    fields->setpoint = bblFieldIndex(log, "setpoint[0]");
+    fields->rcCommand = bblFieldIndex(log, "rcCommand[0]");
+    fields->motor = bblFieldIndex(log, "motor[0]");
+    fields->motorCount = 0;
+    if (fields->motor >= 0) {
+        char name[16];
+        do {
+            snprintf(name, sizeof(name), "motor[%d]", ++fields->motorCount);
+        } while (fields->motorCount < MAX_SUPPORTED_MOTORS && bblFieldIndex(log, name) >= 0);
+    }
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: replay [-l logIndex] [-o motors.csv] [--set name=value]... file.bbl\n"
+        "  replays the unfiltered gyro and setpoints of a blackbox log through the flight pipeline\n"
+        "  and prints the time spent per stage, -o writes replayed and logged motor outputs\n");
+}
+
+static void printStageStats(uint32_t loops)
+{
+    printf("%-14s %10s %10s %10s\n", "stage", "calls", "mean ns", "max ns");
+    for (int i = 0; i < REPLAY_STAGE_COUNT; i++) {
+        const replayStageStats_t *s = &stageStats[i];
+        printf("%-14s %10u %10.1f %10llu\n", s->name, s->calls,
+            s->calls ? (double)s->totalNs / s->calls : 0.0, (unsigned long long)s->maxNs);
+    }
+    printf("%u gyro loops replayed\n", loops);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *logPath = NULL;
+    const char *csvPath = NULL;
+    const char *overrides[REPLAY_OVERRIDE_COUNT_MAX];
+    int overrideCount = 0;
+    int logIndex = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-l") && i + 1 < argc) {
+            logIndex = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            csvPath = argv[++i];
+        } else if (!strcmp(argv[i], "--set") && i + 1 < argc && overrideCount < REPLAY_OVERRIDE_COUNT_MAX) {
+            overrides[overrideCount++] = argv[++i];
+        } else if (argv[i][0] != '-' && !logPath) {
+            logPath = argv[i];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (!logPath) {
+        usage();
+        return 1;
+    }
+
+    size_t size;
+    uint8_t *data = loadFile(logPath, &size);
+    if (!data) {
+        fprintf(stderr, "replay: cannot read %s\n", logPath);
+        return 1;
+    }
+
+    static bblLog_t log;
+    if (!bblOpen(&log, data, size, logIndex)) {
+        fprintf(stderr, "replay: %s holds %d log(s), log %d not found\n", logPath, bblLogCount(data, size), logIndex);
+        return 1;
+    }
+
+    const int looptime = bblHeaderInt(&log, "looptime", 0);
+    const int logDebugMode = bblHeaderInt(&log, "debug_mode", DEBUG_NONE);
+    const bool gyroFromDebug = logDebugMode == DEBUG_GYRO_SCALED || logDebugMode == DEBUG_GYRO_RAW;
+    if (looptime <= 0) {
+        fprintf(stderr, "replay: log header has no looptime\n");
+        return 1;
+    }
+    if (!gyroFromDebug) {
+        fprintf(stderr, "replay: log was not recorded with debug_mode GYRO_SCALED or GYRO_RAW, replaying the filtered gyroADC\n");
+    }
+
+    replayFields_t fields;
+    findFields(&log, &fields, gyroFromDebug);
+    if (fields.time < 0 || fields.gyro < 0 || fields.setpoint < 0 || fields.rcCommand < 0) {
+        fprintf(stderr, "replay: log lacks the time, gyro, setpoint or rcCommand fields\n");
+        return 1;
+    }
+
+    pgResetAll();
+    currentPidProfile = pidProfilesMutable(0);
+    replayInput.features = bblHeaderInt(&log, "features", 0);
+    applyHeaderConfig(&log);
+    for (int i = 0; i < overrideCount; i++) {
+        if (!applyOverride(overrides[i])) {
+            fprintf(stderr, "replay: unknown setting %s\n", overrides[i]);
+            return 1;
+        }
+    }
+
+    gyroInit();
+    fakeGyroDev->scale = 1.0f / REPLAY_GYRO_LSB_PER_DPS;
+    gyro.targetLooptime = looptime;
+    gyroInitFilters();
+
+    pidInit(currentPidProfile);
+    pidStabilisationState(PID_STABILISATION_ON);
+    mixerInit(mixerConfig()->mixerMode);
+    mixerConfigureOutput();
+    ENABLE_ARMING_FLAG(ARMED);
+
+    FILE *csv = NULL;
+    if (csvPath) {
+        csv = fopen(csvPath, "w");
+        if (!csv) {
+            fprintf(stderr, "replay: cannot write %s\n", csvPath);
+            return 1;
+        }
+        fprintf(csv, "time");
+        for (int i = 0; i < fields.motorCount; i++) {
+            fprintf(csv, ",motor[%d]", i);
+        }
+        for (int i = 0; i < fields.motorCount; i++) {
+            fprintf(csv, ",logged_motor[%d]", i);
+        }
+        fprintf(csv, "\n");
+    }
+
+    static int32_t previous[BBL_FIELD_COUNT_MAX];
+    static int32_t current[BBL_FIELD_COUNT_MAX];
+    if (!bblReadMainFrame(&log, previous)) {
+        fprintf(stderr, "replay: log has no main frames\n");
+        return 1;
+    }
+
+    const float gyroToCounts = logDebugMode == DEBUG_GYRO_RAW ? 1.0f : REPLAY_GYRO_LSB_PER_DPS;
+    const int pidDenom = MAX(pidConfig()->pid_process_denom, 1);
+    const rollAndPitchTrims_t angleTrims = { .raw = { 0, 0 } };
+    timeUs_t loopTimeUs = (uint32_t)previous[fields.time];
+    uint32_t loops = 0;
+
+    while (bblReadMainFrame(&log, current)) {
+        const timeUs_t fromUs = (uint32_t)previous[fields.time];
+        const timeUs_t toUs = (uint32_t)current[fields.time];
+        if (cmp32(toUs, fromUs) <= 0) {
+            memcpy(previous, current, sizeof(previous));
+            continue;
+        }
+
+        // setpoints and throttle are held from the earlier frame, as the RX task would between updates
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            replayInput.setpoint[axis] = previous[fields.setpoint + axis];
+        }
+        for (int i = 0; i < 4; i++) {
+            rcCommand[i] = previous[fields.rcCommand + i];
+        }
+
+        for (; cmp32(toUs, loopTimeUs) > 0; loopTimeUs += looptime) {
+            const float t = (float)(loopTimeUs - fromUs) / (toUs - fromUs);
+            int16_t adc[XYZ_AXIS_COUNT];
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                const float value = previous[fields.gyro + axis] + t * (current[fields.gyro + axis] - previous[fields.gyro + axis]);
+                adc[axis] = constrainf(lrintf(value * gyroToCounts), INT16_MIN, INT16_MAX);
+            }
+            fakeGyroSet(fakeGyroDev, adc[X], adc[Y], adc[Z]);
+            replayInput.timeUs = loopTimeUs;
+
+            stageBegin(REPLAY_STAGE_GYRO);
+            gyroUpdate(loopTimeUs);
+            stageEnd(REPLAY_STAGE_GYRO);
+
+            if (loops++ % pidDenom == 0) {
+                stageBegin(REPLAY_STAGE_PID);
+                pidController(currentPidProfile, &angleTrims, loopTimeUs);
+                stageEnd(REPLAY_STAGE_PID);
+
+                stageBegin(REPLAY_STAGE_MIXER);
+                mixTable(loopTimeUs, currentPidProfile->vbatPidCompensation);
+                stageEnd(REPLAY_STAGE_MIXER);
+            }
+        }
+
+        if (csv) {
+            fprintf(csv, "%u", toUs);
+            for (int i = 0; i < fields.motorCount; i++) {
+                fprintf(csv, ",%ld", lrintf(motor[i]));
+            }
+            for (int i = 0; i < fields.motorCount; i++) {
+                fprintf(csv, ",%d", current[fields.motor + i]);
+            }
+            fprintf(csv, "\n");
+        }
+        memcpy(previous, current, sizeof(previous));
+    }
+
+    if (csv) {
+        fclose(csv);
+    }
+    printStageStats(loops);
+    if (log.framesCorrupt) {
+        printf("%u frames decoded, %u corrupt\n", log.framesDecoded, log.framesCorrupt);
+    }
+    bblClose(&log);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,659 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Decoder for the log format written by blackbox.c and blackbox_encoding.c.
+ * Only what the replay needs is kept: main frames are fully decoded, slow, GPS and event frames are skipped.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "blackbox/blackbox.h"
+#include "blackbox/blackbox_fielddefs.h"
+
+#include "common/huffman.h"
+
+#include "replay_decoder.h"
+
+#define BBL_LOG_START_MARKER "H Product:"
+#define BBL_EOF -1
+
+
+static int readByte(bblLog_t *log)
+{
+    if (log->pos >= log->end) {
+        return BBL_EOF;
+    }
+    return log->data[log->pos++];
+}
+
+static uint32_t readUnsignedVB(bblLog_t *log)
+{
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        const int c = readByte(log);
+        if (c == BBL_EOF) {
+            return 0;
+        }
+        result |= (uint32_t)(c & 0x7F) << shift;
+        if (!(c & 0x80)) {
+            break;
+        }
+    }
+    return result;
+}
+
+static int32_t readSignedVB(bblLog_t *log)
+{
+    const uint32_t value = readUnsignedVB(log);
+    // ZigZag decode
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static int32_t signExtend(uint32_t value, int bits)
+{
+    const uint32_t signBit = 1u << (bits - 1);
+    value &= (1u << bits) - 1;
+    return (int32_t)((value ^ signBit) - signBit);
+}
+
+static void readTag2_3S32(bblLog_t *log, int32_t *values)
+{
+    const int lead = readByte(log);
+
+    switch (lead >> 6) {
+    case 0:
+        values[0] = signExtend(lead >> 4, 2);
+        values[1] = signExtend(lead >> 2, 2);
+        values[2] = signExtend(lead, 2);
+        break;
+    case 1: {
+        values[0] = signExtend(lead, 4);
+        const int c = readByte(log);
+        values[1] = signExtend(c >> 4, 4);
+        values[2] = signExtend(c, 4);
+        break;
+    }
+    case 2:
+        values[0] = signExtend(lead, 6);
+        values[1] = signExtend(readByte(log), 6);
+        values[2] = signExtend(readByte(log), 6);
+        break;
+    case 3: {
+        int selector = lead;
+        for (int i = 0; i < 3; i++, selector >>= 2) {
+            const int byteCount = (selector & 0x03) + 1;
+            uint32_t value = 0;
+            for (int b = 0; b < byteCount; b++) {
+                value |= (uint32_t)readByte(log) << (8 * b);
+            }
+            values[i] = byteCount == 4 ? (int32_t)value : signExtend(value, 8 * byteCount);
+        }
+        break;
+    }
+    }
+}
+
+static void readTag2_3SVariable(bblLog_t *log, int32_t *values)
+{
+    const int lead = readByte(log);
+
+    switch (lead >> 6) {
+    case 1: {
+        // 554 bits per field  ss11 1112 2222 3333
+        const int c = readByte(log);
+        values[0] = signExtend(lead >> 1, 5);
+        values[1] = signExtend(((lead & 0x01) << 4) | (c >> 4), 5);
+        values[2] = signExtend(c, 4);
+        break;
+    }
+    case 2: {
+        // 877 bits per field  ss11 1111 1122 2222 2333 3333
+        const int c1 = readByte(log);
+        const int c2 = readByte(log);
+        values[0] = signExtend(((lead & 0x3F) << 2) | (c1 >> 6), 8);
+        values[1] = signExtend(((c1 & 0x3F) << 1) | (c2 >> 7), 7);
+        values[2] = signExtend(c2, 7);
+        break;
+    }
+    default:
+        // the 2 and 32 bit layouts are shared with TAG2_3S32
+        log->pos--;
+        readTag2_3S32(log, values);
+        break;
+    }
+}
+
+static void readTag8_4S16(bblLog_t *log, int32_t *values)
+{
+    int selector = readByte(log);
+    bool nibblePending = false;
+    int buffer = 0;
+
+    // a pending low nibble belongs to the next field, the encoder fills high nibbles first
+    for (int i = 0; i < 4; i++, selector >>= 2) {
+        switch (selector & 0x03) {
+        case 0:
+            values[i] = 0;
+            break;
+        case 1:
+            if (!nibblePending) {
+                buffer = readByte(log);
+                values[i] = signExtend(buffer >> 4, 4);
+                nibblePending = true;
+            } else {
+                values[i] = signExtend(buffer, 4);
+                nibblePending = false;
+            }
+            break;
+        case 2:
+            if (!nibblePending) {
+                values[i] = signExtend(readByte(log), 8);
+            } else {
+                const int high = buffer & 0x0F;
+                buffer = readByte(log);
+                values[i] = signExtend((high << 4) | (buffer >> 4), 8);
+            }
+            break;
+        case 3:
+            if (!nibblePending) {
+                const int high = readByte(log);
+                values[i] = signExtend((high << 8) | readByte(log), 16);
+            } else {
+                const int high = buffer & 0x0F;
+                const int middle = readByte(log);
+                buffer = readByte(log);
+                values[i] = signExtend((high << 12) | (middle << 4) | (buffer >> 4), 16);
+            }
+            break;
+        }
+    }
+}
+
+static void readTag8_8SVB(bblLog_t *log, int32_t *values, int count)
+{
+    if (count == 1) {
+        values[0] = readSignedVB(log);
+        return;
+    }
+    int header = readByte(log);
+    for (int i = 0; i < count; i++, header >>= 1) {
+        values[i] = (header & 0x01) ? readSignedVB(log) : 0;
+    }
+}
+
+static int32_t applyPrediction(const bblLog_t *log, int field, int predictor, int32_t value, const int32_t *current, const int32_t *previous, const int32_t *previous2)
+{
+    switch (predictor) {
+    case FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS:
+        return previous ? value + previous[field] : value;
+    case FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE:
+        return previous ? value + 2 * previous[field] - previous2[field] : value;
+    case FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2:
+        return previous ? value + (previous[field] + previous2[field]) / 2 : value;
+    case FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE:
+        return value + log->minthrottle;
+    case FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0:
+        return log->motor0Index >= 0 ? value + current[log->motor0Index] : value;
+    case FLIGHT_LOG_FIELD_PREDICTOR_1500:
+        return value + 1500;
+    case FLIGHT_LOG_FIELD_PREDICTOR_VBATREF:
+        return value + log->vbatref;
+    case FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME:
+        return value + (int32_t)log->lastMainFrameTime;
+    case FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR:
+        return value + log->minmotor;
+    default:
+        return value;
+    }
+}
+
+/*
+ * Decode one frame body into current. previous and previous2 are the history used by the predictors
+ * and may be NULL for frames that do not reference history.
+ */
+static void parseFrame(bblLog_t *log, const bblFrameDef_t *def, int32_t *current, const int32_t *previous, const int32_t *previous2)
+{
+    int i = 0;
+    while (i < def->fieldCount) {
+        int32_t values[8];
+        int count = 1;
+
+        if (def->predictor[i] == FLIGHT_LOG_FIELD_PREDICTOR_INC) {
+            // frames are pInterval loop iterations apart
+            current[i] = (previous ? previous[i] : 0) + (log->pInterval > 0 ? log->pInterval : 1);
+            i++;
+            continue;
+        }
+
+        switch (def->encoding[i]) {
+        case FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB:
+            values[0] = readSignedVB(log);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB:
+            values[0] = (int32_t)readUnsignedVB(log);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT:
+            values[0] = -signExtend(readUnsignedVB(log), 14);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16:
+            readTag8_4S16(log, values);
+            count = 4;
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32:
+            readTag2_3S32(log, values);
+            count = 3;
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE:
+            readTag2_3SVariable(log, values);
+            count = 3;
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB:
+            // consecutive fields with this encoding are grouped, up to 8
+            while (count < 8 && i + count < def->fieldCount && def->encoding[i + count] == FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB) {
+                count++;
+            }
+            readTag8_8SVB(log, values, count);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NULL:
+        default:
+            values[0] = 0;
+            break;
+        }
+
+        for (int j = 0; j < count && i < def->fieldCount; j++, i++) {
+            current[i] = applyPrediction(log, i, def->predictor[i], values[j], current, previous, previous2);
+        }
+    }
+}
+
+static void skipEvent(bblLog_t *log)
+{
+    switch (readByte(log)) {
+    case FLIGHT_LOG_EVENT_SYNC_BEEP:
+        readUnsignedVB(log);
+        break;
+    case FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT:
+        if (readByte(log) & 0x80) {
+            log->pos += 4;
+        } else {
+            readSignedVB(log);
+        }
+        break;
+    case FLIGHT_LOG_EVENT_LOGGING_RESUME:
+        // iterations and time jump, the history is no longer valid for P-frames
+        readUnsignedVB(log);
+        readUnsignedVB(log);
+        log->historyValid = false;
+        break;
+    case FLIGHT_LOG_EVENT_FLIGHTMODE:
+        readUnsignedVB(log);
+        readUnsignedVB(log);
+        break;
+    case FLIGHT_LOG_EVENT_LOG_END:
+    default:
+        log->pos = log->end;
+        break;
+    }
+}
+
+#define BBL_HUFFMAN_MAX_CODE_LEN 12
+
+/*
+ * Inflates the blocks written by blackbox_encoding.c when the log has "Data compression:huffman", returns the
+ * uncompressed length or -1 if the data is damaged. A damaged block ends the log, the frames before it are kept.
+ */
+static int inflateBlocks(const uint8_t *in, size_t inLength, uint8_t *out, size_t outSize)
+{
+    static int16_t decodeTable[1 << BBL_HUFFMAN_MAX_CODE_LEN];
+    static bool decodeTableReady;
+
+    if (!decodeTableReady) {
+        // every BBL_HUFFMAN_MAX_CODE_LEN bit value starting with a code maps to that code's symbol
+        for (int sym = 0; sym < HUFFMAN_TABLE_SIZE; sym++) {
+            const int codeLen = huffmanTable[sym].codeLen;
+            const int first = (huffmanTable[sym].code >> (16 - codeLen)) << (BBL_HUFFMAN_MAX_CODE_LEN - codeLen);
+            for (int i = 0; i < 1 << (BBL_HUFFMAN_MAX_CODE_LEN - codeLen); i++) {
+                decodeTable[first + i] = sym;
+            }
+        }
+        decodeTableReady = true;
+    }
+
+    size_t inPos = 0;
+    size_t outLength = 0;
+    while (inPos < inLength) {
+        uint32_t count = 0;
+        for (int shift = 0; inPos < inLength && shift < 32; shift += 7) {
+            const uint8_t b = in[inPos++];
+            count |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) {
+                break;
+            }
+        }
+        if (count == 0) {
+            // end of the compressed data
+            return outLength;
+        }
+        if (outLength + count > outSize) {
+            return -1;
+        }
+
+        uint32_t bits = 0;
+        int bitCount = 0;
+        while (count > 0) {
+            while (bitCount < BBL_HUFFMAN_MAX_CODE_LEN) {
+                bits = (bits << 8) | (inPos < inLength ? in[inPos] : 0);
+                inPos++;
+                bitCount += 8;
+            }
+            const int sym = decodeTable[(bits >> (bitCount - BBL_HUFFMAN_MAX_CODE_LEN)) & ((1 << BBL_HUFFMAN_MAX_CODE_LEN) - 1)];
+            if (sym >= 256) {
+                return outLength;
+            }
+            bitCount -= huffmanTable[sym].codeLen;
+            out[outLength++] = sym;
+            count--;
+        }
+        // the block is padded to a whole byte, return the whole bytes not used yet
+        inPos -= bitCount / 8;
+        if (inPos > inLength) {
+            return outLength;
+        }
+    }
+    return outLength;
+}
+
+static size_t findLogStart(const uint8_t *data, size_t size, size_t from)
+{
+    const size_t markerLength = strlen(BBL_LOG_START_MARKER);
+    for (size_t i = from; i + markerLength <= size; i++) {
+        if (data[i] == 'H' && memcmp(&data[i], BBL_LOG_START_MARKER, markerLength) == 0) {
+            return i;
+        }
+    }
+    return size;
+}
+
+int bblLogCount(const uint8_t *data, size_t size)
+{
+    int count = 0;
+    for (size_t pos = findLogStart(data, size, 0); pos < size; pos = findLogStart(data, size, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+static void parseList(const char *value, size_t length, void (*store)(bblFrameDef_t *, int, const char *, size_t), bblFrameDef_t *def)
+{
+    int index = 0;
+    size_t start = 0;
+    for (size_t i = 0; i <= length && index < BBL_FIELD_COUNT_MAX; i++) {
+        if (i == length || value[i] == ',') {
+            store(def, index++, &value[start], i - start);
+            start = i + 1;
+        }
+    }
+}
+
+static void storeName(bblFrameDef_t *def, int index, const char *value, size_t length)
+{
+    length = length < BBL_FIELD_NAME_LENGTH - 1 ? length : BBL_FIELD_NAME_LENGTH - 1;
+    memcpy(def->name[index], value, length);
+    def->name[index][length] = '\0';
+    def->fieldCount = index + 1;
+}
+
+static void storeSigned(bblFrameDef_t *def, int index, const char *value, size_t length)
+{
+    (void)length;
+    def->isSigned[index] = atoi(value);
+}
+
+static void storePredictor(bblFrameDef_t *def, int index, const char *value, size_t length)
+{
+    (void)length;
+    def->predictor[index] = atoi(value);
+}
+
+static void storeEncoding(bblFrameDef_t *def, int index, const char *value, size_t length)
+{
+    (void)length;
+    def->encoding[index] = atoi(value);
+}
+
+static bblFrameDef_t *frameDefForType(bblLog_t *log, char frameType)
+{
+    switch (frameType) {
+    case 'I': return &log->frameDefI;
+    case 'P': return &log->frameDefP;
+    case 'S': return &log->frameDefS;
+    case 'G': return &log->frameDefG;
+    case 'H': return &log->frameDefH;
+    default: return NULL;
+    }
+}
+
+static void parseFieldHeader(bblLog_t *log, const char *name, const char *value, size_t length)
+{
+    // "Field X property"
+    bblFrameDef_t *def = frameDefForType(log, name[6]);
+    if (!def) {
+        return;
+    }
+    const char *property = &name[8];
+    if (strcmp(property, "name") == 0) {
+        parseList(value, length, storeName, def);
+    } else if (strcmp(property, "signed") == 0) {
+        parseList(value, length, storeSigned, def);
+    } else if (strcmp(property, "predictor") == 0) {
+        parseList(value, length, storePredictor, def);
+    } else if (strcmp(property, "encoding") == 0) {
+        parseList(value, length, storeEncoding, def);
+    }
+}
+
+bool bblOpen(bblLog_t *log, const uint8_t *data, size_t size, int logIndex)
+{
+    memset(log, 0, sizeof(*log));
+    log->data = data;
+
+    size_t start = findLogStart(data, size, 0);
+    for (int i = 0; i < logIndex && start < size; i++) {
+        start = findLogStart(data, size, start + 1);
+    }
+    if (start >= size) {
+        return false;
+    }
+    log->end = findLogStart(data, size, start + 1);
+    log->headerStart = start;
+    log->pos = start;
+
+    // header lines run up to the first frame
+    while (log->pos < log->end && data[log->pos] == 'H') {
+        const char *line = (const char *)&data[log->pos + 2];
+        const char *lineEnd = memchr(line, '\n', log->end - log->pos - 2);
+        if (!lineEnd) {
+            return false;
+        }
+        const char *colon = memchr(line, ':', lineEnd - line);
+        if (colon) {
+            char name[64];
+            const size_t nameLength = (size_t)(colon - line) < sizeof(name) - 1 ? (size_t)(colon - line) : sizeof(name) - 1;
+            memcpy(name, line, nameLength);
+            name[nameLength] = '\0';
+            if (strncmp(name, "Field ", 6) == 0 && nameLength > 8) {
+                parseFieldHeader(log, name, colon + 1, lineEnd - colon - 1);
+            }
+        }
+        log->pos = (const uint8_t *)lineEnd - data + 1;
+    }
+    log->headerEnd = log->pos;
+
+    char compression[16];
+    if (bblHeaderValue(log, "Data compression", compression, sizeof(compression))) {
+        if (strcmp(compression, "huffman") != 0) {
+            return false;
+        }
+        // the codes are at least one bit, so the data inflates to at most eight times its size
+        const size_t headerLength = log->headerEnd - log->headerStart;
+        const size_t maxLength = (log->end - log->headerEnd) * 8;
+        log->inflated = malloc(headerLength + maxLength);
+        if (!log->inflated) {
+            return false;
+        }
+        memcpy(log->inflated, &data[log->headerStart], headerLength);
+        const int length = inflateBlocks(&data[log->headerEnd], log->end - log->headerEnd, &log->inflated[headerLength], maxLength);
+        if (length < 0) {
+            bblClose(log);
+            return false;
+        }
+        log->data = log->inflated;
+        log->headerStart = 0;
+        log->headerEnd = headerLength;
+        log->pos = headerLength;
+        log->end = headerLength + length;
+    }
+
+    if (log->frameDefI.fieldCount == 0) {
+        return false;
+    }
+    // P-frames carry the same fields as I-frames
+    log->frameDefP.fieldCount = log->frameDefI.fieldCount;
+    memcpy(log->frameDefP.name, log->frameDefI.name, sizeof(log->frameDefP.name));
+    memcpy(log->frameDefP.isSigned, log->frameDefI.isSigned, sizeof(log->frameDefP.isSigned));
+
+    log->minthrottle = bblHeaderInt(log, "minthrottle", 1150);
+    log->minmotor = bblHeaderInt(log, "motorOutput", log->minthrottle);
+    log->vbatref = bblHeaderInt(log, "vbatref", 0);
+    log->pInterval = bblHeaderInt(log, "P interval", 1);
+    log->motor0Index = bblFieldIndex(log, "motor[0]");
+    log->timeIndex = bblFieldIndex(log, "time");
+
+    return true;
+}
+
+void bblClose(bblLog_t *log)
+{
+    free(log->inflated);
+    log->inflated = NULL;
+}
+
+const char *bblHeaderValue(const bblLog_t *log, const char *name, char *buf, size_t bufSize)
+{
+    const size_t nameLength = strlen(name);
+    size_t pos = log->headerStart;
+
+    while (pos < log->headerEnd) {
+        const char *line = (const char *)&log->data[pos + 2];
+        const char *lineEnd = memchr(line, '\n', log->headerEnd - pos - 2);
+        if (!lineEnd) {
+            break;
+        }
+        if ((size_t)(lineEnd - line) > nameLength && memcmp(line, name, nameLength) == 0 && line[nameLength] == ':') {
+            const char *value = line + nameLength + 1;
+            size_t length = lineEnd - value;
+            length = length < bufSize - 1 ? length : bufSize - 1;
+            memcpy(buf, value, length);
+            buf[length] = '\0';
+            return buf;
+        }
+        pos = (const uint8_t *)lineEnd - log->data + 1;
+    }
+    return NULL;
+}
+
+int bblHeaderInt(const bblLog_t *log, const char *name, int defaultValue)
+{
+    char buf[64];
+    const char *value = bblHeaderValue(log, name, buf, sizeof(buf));
+    return value ? (int)strtol(value, NULL, 0) : defaultValue;
+}
+
+int bblFieldIndex(const bblLog_t *log, const char *name)
+{
+    for (int i = 0; i < log->frameDefI.fieldCount; i++) {
+        if (strcmp(log->frameDefI.name[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Decode up to the next main frame and copy its fields to values, in frameDefI order.
+ * Returns false at the end of the log.
+ */
+bool bblReadMainFrame(bblLog_t *log, int32_t *values)
+{
+    int32_t scratch[BBL_FIELD_COUNT_MAX];
+
+    while (log->pos < log->end) {
+        const int frameType = readByte(log);
+
+        switch (frameType) {
+        case 'I':
+            parseFrame(log, &log->frameDefI, log->history[0], NULL, NULL);
+            memcpy(log->history[1], log->history[0], sizeof(log->history[0]));
+            memcpy(log->history[2], log->history[0], sizeof(log->history[0]));
+            log->historyValid = true;
+            break;
+        case 'P':
+            if (!log->historyValid) {
+                // no keyframe to predict from, decode and drop it
+                parseFrame(log, &log->frameDefP, scratch, log->history[1], log->history[2]);
+                log->framesCorrupt++;
+                continue;
+            }
+            memmove(log->history[2], log->history[1], sizeof(log->history[0]));
+            memmove(log->history[1], log->history[0], sizeof(log->history[0]));
+            parseFrame(log, &log->frameDefP, log->history[0], log->history[1], log->history[2]);
+            break;
+        case 'S':
+        case 'G':
+        case 'H':
+            parseFrame(log, frameDefForType(log, frameType), scratch, NULL, NULL);
+            continue;
+        case 'E':
+            skipEvent(log);
+            continue;
+        default:
+            // lost sync, wait for the next keyframe
+            if (log->historyValid) {
+                log->historyValid = false;
+                log->framesCorrupt++;
+            }
+            continue;
+        }
+
+        if (log->timeIndex >= 0) {
+            log->lastMainFrameTime = log->history[0][log->timeIndex];
+        }
+        log->framesDecoded++;
+        memcpy(values, log->history[0], sizeof(int32_t) * log->frameDefI.fieldCount);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BBL_FIELD_COUNT_MAX     128
+#define BBL_FIELD_NAME_LENGTH   32
+
+typedef struct bblFrameDef_s {
+    int fieldCount;
+    char name[BBL_FIELD_COUNT_MAX][BBL_FIELD_NAME_LENGTH];
+    uint8_t isSigned[BBL_FIELD_COUNT_MAX];
+    uint8_t predictor[BBL_FIELD_COUNT_MAX];
+    uint8_t encoding[BBL_FIELD_COUNT_MAX];
+} bblFrameDef_t;
+
+// decoder for one log of a file written by blackbox.c, the file may hold several logs
+typedef struct bblLog_s {
+    const uint8_t *data;
+    size_t end;
+    size_t pos;
+    size_t headerStart;
+    size_t headerEnd;
+
+    bblFrameDef_t frameDefI;
+    bblFrameDef_t frameDefP;
+    bblFrameDef_t frameDefS;
+    bblFrameDef_t frameDefG;
+    bblFrameDef_t frameDefH;
+
+    // header values used by the predictors
+    int32_t minthrottle;
+    int32_t minmotor;
+    int32_t vbatref;
+    int32_t pInterval;
+    int32_t motor0Index;
+    int32_t timeIndex;
+
+    // main frame history, [0] is the latest frame
+    int32_t history[3][BBL_FIELD_COUNT_MAX];
+    bool historyValid;
+    uint32_t lastMainFrameTime;
+
+    uint32_t framesDecoded;
+    uint32_t framesCorrupt;
+
+    // headers and inflated data of a compressed log, data points here when set
+    uint8_t *inflated;
+} bblLog_t;
+
+int bblLogCount(const uint8_t *data, size_t size);
+bool bblOpen(bblLog_t *log, const uint8_t *data, size_t size, int logIndex);
+void bblClose(bblLog_t *log);
+const char *bblHeaderValue(const bblLog_t *log, const char *name, char *buf, size_t bufSize);
+int bblHeaderInt(const bblLog_t *log, const char *name, int defaultValue);
+int bblFieldIndex(const bblLog_t *log, const char *name);
+bool bblReadMainFrame(bblLog_t *log, int32_t *values);
@@ -0,0 +1,122 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Stand ins for the RX, scheduler, beeper and motor output code the replayed pipeline links
+ * against. RX inputs come from the log through replayInput and rcCommand.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+#include "pg/rx.h"
+
+#include "drivers/pwm_esc_detect.h"
+#include "drivers/pwm_output.h"
+#include "drivers/sound_beeper.h"
+#include "drivers/time.h"
+#include "drivers/timer.h"
+
+#include "fc/controlrate_profile.h"
+#include "fc/fc_core.h"
+#include "fc/fc_rc.h"
+#include "fc/rc_controls.h"
+#include "fc/rc_modes.h"
+
+#include "flight/failsafe.h"
+#include "flight/imu.h"
+#include "flight/mixer.h"
+#include "flight/pid.h"
+
+#include "io/beeper.h"
+
+#include "rx/rx.h"
+
+#include "scheduler/scheduler.h"
+
+#include "sensors/battery.h"
+#include "sensors/sensors.h"
+
+#include "replay.h"
+
+PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
+
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+uint8_t hardwareMotorType = MOTOR_BRUSHLESS;
+uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+attitudeEulerAngles_t attitude;
+
+float rcCommand[4];
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+volatile bool isSetpointNew = true;
+
+static controlRateConfig_t replayControlRateProfile = {
+    .throttle_limit_type = THROTTLE_LIMIT_TYPE_OFF,
+    .throttle_limit_percent = 100,
+};
+controlRateConfig_t *currentControlRateProfile = &replayControlRateProfile;
+pidProfile_t *currentPidProfile;
+
+timeUs_t micros(void) { return replayInput.timeUs; }
+void delay(timeMs_t ms) { UNUSED(ms); }
+void delayMicroseconds(timeUs_t us) { UNUSED(us); }
+
+float getSetpointRate(int axis) { return replayInput.setpoint[axis]; }
+float getRcDeflection(int axis) { return constrainf(rcCommand[axis] / 500.0f, -1.0f, 1.0f); }
+float getRcDeflectionAbs(int axis) { return fabsf(getRcDeflection(axis)); }
+// TPA is not replayed, the harness compares the pipeline at unity PID attenuation
+float getThrottlePAttenuation(void) { return 1.0f; }
+float getThrottleIAttenuation(void) { return 1.0f; }
+float getThrottleDAttenuation(void) { return 1.0f; }
+
+bool feature(uint32_t mask) { return replayInput.features & mask; }
+bool IS_RC_MODE_ACTIVE(boxId_e boxId) { UNUSED(boxId); return false; }
+bool getBoxIdState(boxId_e boxid) { UNUSED(boxid); return false; }
+// logs are replayed as flown in airmode, so idle throttle still mixes full authority
+bool isAirmodeActive(void) { return true; }
+bool isFlipOverAfterCrashMode(void) { return false; }
+bool failsafeIsActive(void) { return false; }
+float calculateVbatPidCompensation(void) { return 1.0f; }
+
+void beeper(beeperMode_e mode) { UNUSED(mode); }
+void beeperConfirmationBeeps(uint8_t beepCount) { UNUSED(beepCount); }
+void systemBeep(bool on) { UNUSED(on); }
+void schedulerResetTaskStatistics(cfTaskId_e taskId) { UNUSED(taskId); }
+
+bool isMotorProtocolDshot(void) { return false; }
+bool isMotorsReversed(void) { return false; }
+bool pwmAreMotorsEnabled(void) { return true; }
+void pwmWriteMotor(uint8_t index, float value) { UNUSED(index); UNUSED(value); }
+void pwmCompleteMotorUpdate(uint8_t motorCount) { UNUSED(motorCount); }
+void pwmShutdownPulsesForAllMotors(uint8_t motorCount) { UNUSED(motorCount); }
+ioTag_t timerioTagGetByUsage(timerUsageFlag_e usageFlag, uint8_t index) { UNUSED(usageFlag); UNUSED(index); return IO_TAG_NONE; }
@@ -15,13 +15,16 @@
  */
 
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 extern "C" {
     #include "platform.h"
 
     #include "blackbox/blackbox.h"
     #include "blackbox/blackbox_encoding.h"
+    #include "common/huffman.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -39,14 +42,23 @@ static serialPort_t *blackboxPort;
 static int serialWritePos = 0;
 static int serialReadPos = 0;
 static int serialReadEnd = 0;
-#define SERIAL_BUFFER_SIZE 256
+#define SERIAL_BUFFER_SIZE 512
 static uint8_t serialReadBuffer[SERIAL_BUFFER_SIZE];
 static uint8_t serialWriteBuffer[SERIAL_BUFFER_SIZE];
 
 serialPort_t serialTestInstance;
 
+static int serialWriteBufCalls = 0;
+// when set the serial stubs only fold the bytes into a checksum, for the write speed benchmark
+static bool serialBenchmarkSink = false;
+static uint32_t serialSinkChecksum = 0;
+
 void serialWrite(serialPort_t *instance, uint8_t ch)
 {
+    if (serialBenchmarkSink) {
+        serialSinkChecksum += ch;
+        return;
+    }
     EXPECT_EQ(instance, &serialTestInstance);
     EXPECT_LT(serialWritePos, sizeof(serialWriteBuffer));
     serialWriteBuffer[serialWritePos++] = ch;
@@ -54,6 +66,13 @@ void serialWrite(serialPort_t *instance, uint8_t ch)
 
 void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count)
 {
+    serialWriteBufCalls++;
+    if (serialBenchmarkSink) {
+        while (count--) {
+            serialSinkChecksum += *data++;
+        }
+        return;
+    }
     while(count--)
         serialWrite(instance, *data++);
 }
@@ -105,6 +124,7 @@ void serialTestResetBuffers()
     serialReadEnd = 0;
     memset(&serialWriteBuffer, 0, sizeof(serialWriteBuffer));
     serialWritePos = 0;
+    serialWriteBufCalls = 0;
 }
 
 TEST(BlackboxEncodingTest, TestWriteUnsignedVB)
@@ -240,12 +260,246 @@ TEST(BlackboxTest, TestWriteTag2_3SVariable_BITS887)
     EXPECT_EQ(0, buf[3]); // ensure next byte has not been written
     buf += 3;
 }
+// Encodes a frame shaped like a P-frame: iteration/time, PID terms, setpoints, gyro and motors
+static void writeTestFrame(int i)
+{
+    int32_t values[8];
+
+    blackboxWrite('P');
+    blackboxWriteSignedVB(i & 7);
+    for (int axis = 0; axis < 3; axis++) {
+        values[axis] = (i * (axis + 3)) % 200 - 100;
+    }
+    blackboxWriteSignedVBArray(values, 3);
+    blackboxWriteTag2_3S32(values);
+    for (int j = 0; j < 8; j++) {
+        values[j] = ((i + j) * 37) % 64 - 32;
+    }
+    blackboxWriteTag8_8SVB(values, 8);
+    blackboxWriteTag8_4S16(values);
+    for (int j = 0; j < 6; j++) {
+        blackboxWriteSignedVB(((i + j) * 101) % 2000 - 1000);
+    }
+    for (int motor = 0; motor < 4; motor++) {
+        blackboxWriteUnsignedVB(1000 + ((i + motor) * 13) % 1000);
+    }
+}
+
+TEST(BlackboxEncodingTest, TestFrameWrittenInOneCall)
+{
+    serialTestResetBuffers();
+    writeTestFrame(5);
+    const int frameLength = serialWritePos;
+    uint8_t expected[SERIAL_BUFFER_SIZE];
+    memcpy(expected, serialWriteBuffer, frameLength);
+    EXPECT_EQ(0, serialWriteBufCalls);
+
+    serialTestResetBuffers();
+    blackboxFrameBegin();
+    writeTestFrame(5);
+    EXPECT_EQ(0, serialWritePos); // nothing reaches the device until the frame is complete
+    blackboxFrameEnd();
+
+    EXPECT_EQ(1, serialWriteBufCalls);
+    EXPECT_EQ(frameLength, serialWritePos);
+    EXPECT_EQ(0, memcmp(expected, serialWriteBuffer, frameLength));
+
+    // outside of a frame bytes go straight to the device again
+    blackboxWrite(0x55);
+    EXPECT_EQ(frameLength + 1, serialWritePos);
+    EXPECT_EQ(1, serialWriteBufCalls);
+}
+
+TEST(BlackboxEncodingTest, TestFrameLargerThanScratchBuffer)
+{
+    serialTestResetBuffers();
+    blackboxFrameBegin();
+    for (int i = 0; i < BLACKBOX_FRAME_BUFFER_SIZE + 20; i++) {
+        blackboxWrite(i * 7);
+    }
+    blackboxFrameEnd();
+
+    EXPECT_EQ(2, serialWriteBufCalls);
+    EXPECT_EQ(BLACKBOX_FRAME_BUFFER_SIZE + 20, serialWritePos);
+    for (int i = 0; i < BLACKBOX_FRAME_BUFFER_SIZE + 20; i++) {
+        EXPECT_EQ((i * 7) & 0xFF, serialWriteBuffer[i]);
+    }
+}
+
+// decodes the blocks written while compression is active, returns the number of bytes decoded or -1
+static int decompressBlocks(const uint8_t *in, int inLength, uint8_t *out, int outSize, bool *endSeen)
+{
+    int inPos = 0;
+    int outLength = 0;
+    *endSeen = false;
+    while (inPos < inLength) {
+        int count = 0;
+        int shift = 0;
+        uint8_t b;
+        do {
+            b = in[inPos++];
+            count |= (b & 0x7F) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        if (count == 0) {
+            *endSeen = true;
+            return outLength;
+        }
+
+        uint32_t code = 0;
+        int codeLen = 0;
+        int bit = 7;
+        while (count > 0) {
+            if (inPos >= inLength) {
+                return -1;
+            }
+            code = (code << 1) | ((in[inPos] >> bit) & 1);
+            codeLen++;
+            if (--bit < 0) {
+                bit = 7;
+                inPos++;
+            }
+            for (int sym = 0; sym < HUFFMAN_TABLE_SIZE; sym++) {
+                if (huffmanTable[sym].codeLen == codeLen && (huffmanTable[sym].code >> (16 - codeLen)) == code) {
+                    if (outLength >= outSize) {
+                        return -1;
+                    }
+                    out[outLength++] = sym;
+                    count--;
+                    code = 0;
+                    codeLen = 0;
+                    break;
+                }
+            }
+        }
+        if (bit != 7) {
+            inPos++;
+        }
+    }
+    return outLength;
+}
+
+TEST(BlackboxEncodingTest, TestCompressedFramesRoundTrip)
+{
+    serialTestResetBuffers();
+    uint8_t expected[SERIAL_BUFFER_SIZE];
+    int expectedLength = 0;
+    for (int i = 0; i < 3; i++) {
+        writeTestFrame(i);
+    }
+    blackboxWrite(0x55);
+    expectedLength = serialWritePos;
+    memcpy(expected, serialWriteBuffer, expectedLength);
+
+    serialTestResetBuffers();
+    blackboxCompressionBegin();
+    for (int i = 0; i < 3; i++) {
+        blackboxFrameBegin();
+        writeTestFrame(i);
+        blackboxFrameEnd();
+    }
+    blackboxWrite(0x55);
+    EXPECT_TRUE(blackboxCompressionIsActive());
+    blackboxCompressionEnd();
+    EXPECT_FALSE(blackboxCompressionIsActive());
+
+    // one block per frame, one for the byte written outside a frame and the end marker
+    EXPECT_EQ(5, serialWriteBufCalls);
+
+    uint8_t decoded[SERIAL_BUFFER_SIZE];
+    bool endSeen;
+    EXPECT_EQ(expectedLength, decompressBlocks(serialWriteBuffer, serialWritePos, decoded, sizeof(decoded), &endSeen));
+    EXPECT_TRUE(endSeen);
+    EXPECT_EQ(0, memcmp(expected, decoded, expectedLength));
+
+    // runs of small values, as in the deltas of a quiet log, get much shorter
+    serialTestResetBuffers();
+    blackboxCompressionBegin();
+    blackboxFrameBegin();
+    for (int i = 0; i < 100; i++) {
+        blackboxWrite(0);
+    }
+    blackboxFrameEnd();
+    EXPECT_LT(serialWritePos, 50);
+    blackboxCompressionEnd();
+
+    // once ended nothing more is compressed
+    serialTestResetBuffers();
+    blackboxWrite(0x55);
+    EXPECT_EQ(1, serialWritePos);
+    EXPECT_EQ(0x55, serialWriteBuffer[0]);
+}
+
+TEST(BlackboxEncodingTest, TestBatchedFramesMatchUnbatched)
+{
+    // every frame shape the encoders produce for the test values, each written to the device in one call
+    for (int i = 0; i < 2000; i++) {
+        serialTestResetBuffers();
+        writeTestFrame(i);
+        const int frameLength = serialWritePos;
+        uint8_t expected[SERIAL_BUFFER_SIZE];
+        memcpy(expected, serialWriteBuffer, frameLength);
+
+        serialTestResetBuffers();
+        blackboxFrameBegin();
+        writeTestFrame(i);
+        blackboxFrameEnd();
+
+        ASSERT_EQ(1, serialWriteBufCalls) << "frame " << i;
+        ASSERT_EQ(frameLength, serialWritePos) << "frame " << i;
+        ASSERT_EQ(0, memcmp(expected, serialWriteBuffer, frameLength)) << "frame " << i;
+    }
+}
+
+static uint64_t nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+TEST(BlackboxEncodingTest, TestFrameWriteSpeed)
+{
+    static const int FRAME_COUNT = 100000;
+    serialTestResetBuffers();
+    serialBenchmarkSink = true;
+
+    uint32_t checksum[2];
+    int deviceCalls[2];
+    uint64_t elapsedNs[2];
+    for (int batched = 0; batched < 2; batched++) {
+        serialSinkChecksum = 0;
+        serialWriteBufCalls = 0;
+        const uint64_t startNs = nanos();
+        for (int i = 0; i < FRAME_COUNT; i++) {
+            if (batched) {
+                blackboxFrameBegin();
+            }
+            writeTestFrame(i);
+            if (batched) {
+                blackboxFrameEnd();
+            }
+        }
+        elapsedNs[batched] = nanos() - startNs;
+        checksum[batched] = serialSinkChecksum;
+        deviceCalls[batched] = serialWriteBufCalls;
+    }
+    serialBenchmarkSink = false;
+
+    EXPECT_EQ(checksum[0], checksum[1]);
+    EXPECT_EQ(FRAME_COUNT, deviceCalls[1]);
+
+    printf("blackbox frames, %d frames: per byte device writes %.1fns/frame, batched frame writes %.1fns/frame\n",
+        FRAME_COUNT, (double)elapsedNs[0] / FRAME_COUNT, (double)elapsedNs[1] / FRAME_COUNT);
+}
+
 // STUBS
 extern "C" {
 PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
 int32_t blackboxHeaderBudget;
 void mspSerialAllocatePorts(void) {}
-void blackboxWrite(uint8_t value) {serialWrite(blackboxPort, value);}
+void blackboxDeviceWrite(uint8_t value) {serialWrite(blackboxPort, value);}
+void blackboxDeviceWriteBuf(const uint8_t *data, int length) {serialWriteBuf(blackboxPort, data, length);}
 int blackboxWriteString(const char *s)
 {
     const uint8_t *pos = (uint8_t*)s;
@@ -352,6 +352,84 @@ TEST(BlackboxTest, Test_CalculateRates)
 
 }
 
+static void cacheFieldGroupRateDivs(void)
+{
+    // as blackboxStart() does at the start of a log
+    for (int group = 0; group < BLACKBOX_FIELD_GROUP_COUNT; group++) {
+        blackboxGroupRateDiv[group] = blackboxGetFieldGroupRateDiv((BlackboxFieldGroup_e)group);
+    }
+}
+
+TEST(BlackboxTest, TestFieldGroupRateDivFromProfile)
+{
+    // custom takes the group_rate_div settings
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_CUSTOM;
+    memset(blackboxConfigMutable()->group_rate_div, 1, sizeof(blackboxConfig()->group_rate_div));
+    blackboxConfigMutable()->group_rate_div[BLACKBOX_FIELD_GROUP_RC_COMMANDS] = 4;
+    blackboxConfigMutable()->group_rate_div[BLACKBOX_FIELD_GROUP_DEBUG] = 0;
+    EXPECT_EQ(4, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_RC_COMMANDS));
+    EXPECT_EQ(0, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_DEBUG));
+    EXPECT_EQ(1, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_GYRO));
+
+    // named profiles ignore the settings
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_TUNING;
+    EXPECT_EQ(1, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_PID));
+    EXPECT_EQ(8, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_RC_COMMANDS));
+    EXPECT_EQ(8, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_DEBUG));
+    EXPECT_EQ(1, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_MOTOR));
+
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_MINIMAL;
+    EXPECT_EQ(0, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_PID));
+    EXPECT_EQ(1, blackboxGetFieldGroupRateDiv(BLACKBOX_FIELD_GROUP_RC_COMMANDS));
+
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_CUSTOM;
+    memset(blackboxConfigMutable()->group_rate_div, 1, sizeof(blackboxConfig()->group_rate_div));
+}
+
+TEST(BlackboxTest, TestDecimatedFieldGroupsHeld)
+{
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_CUSTOM;
+    memset(blackboxConfigMutable()->group_rate_div, 1, sizeof(blackboxConfig()->group_rate_div));
+    blackboxConfigMutable()->group_rate_div[BLACKBOX_FIELD_GROUP_RC_COMMANDS] = 4;
+    blackboxConfigMutable()->group_rate_div[BLACKBOX_FIELD_GROUP_DEBUG] = 0;
+    cacheFieldGroupRateDivs();
+
+    for (int frame = 0; frame < 12; frame++) {
+        blackboxPFramesSinceIFrame = frame;
+        // logged in every 4th P-frame, held in the others
+        EXPECT_EQ(frame % 4 != 0, blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_RC_COMMANDS));
+        // logged in every P-frame
+        EXPECT_FALSE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_GYRO));
+        // not in the log at all, so there is nothing to hold
+        EXPECT_FALSE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_DEBUG));
+    }
+
+    // the profile decides which groups are held for the same frame
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_TUNING;
+    cacheFieldGroupRateDivs();
+    blackboxPFramesSinceIFrame = 2;
+    EXPECT_FALSE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_PID));
+    EXPECT_TRUE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_RC_COMMANDS));
+    EXPECT_TRUE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_ACC));
+    EXPECT_FALSE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_MOTOR));
+
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_LONG_RANGE;
+    cacheFieldGroupRateDivs();
+    EXPECT_TRUE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_PID));
+    EXPECT_FALSE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_RC_COMMANDS));
+    EXPECT_FALSE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_BATTERY));
+    EXPECT_FALSE(blackboxFieldGroupHeld(BLACKBOX_FIELD_GROUP_MOTOR));
+
+    // every group is logged in the frame after an I-frame
+    blackboxPFramesSinceIFrame = 0;
+    for (int group = 0; group < BLACKBOX_FIELD_GROUP_COUNT; group++) {
+        EXPECT_FALSE(blackboxFieldGroupHeld((BlackboxFieldGroup_e)group));
+    }
+
+    blackboxConfigMutable()->profile = BLACKBOX_PROFILE_CUSTOM;
+    memset(blackboxConfigMutable()->group_rate_div, 1, sizeof(blackboxConfig()->group_rate_div));
+}
+
 
 // STUBS
 extern "C" {
@@ -392,6 +470,7 @@ bool isModeActivationConditionPresent(boxId_e) {return false;}
 uint32_t millis(void) {return 0;}
 bool sensors(uint32_t) {return false;}
 void serialWrite(serialPort_t *, uint8_t) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
 uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
 bool feature(uint32_t) {return false;}
@@ -15,14 +15,19 @@
  * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdarg.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <strings.h>
+#include <time.h>
 
 #include <limits.h>
 
 #include <math.h>
 
+#include <string>
+
 extern "C" {
     #include "platform.h"
     #include "target.h"
@@ -55,11 +60,28 @@ extern "C" {
 
     void cliSet(char *cmdline);
     void cliGet(char *cmdline);
+    void cliDiff(char *cmdline);
+    const clivalue_t *cliFindValue(const char *name, size_t length);
+
+    typedef struct cliTestConfig_s {
+        uint8_t first;
+        uint8_t mid;
+        uint8_t midLong;
+        uint16_t last;
+    } cliTestConfig_t;
+
+    PG_DECLARE(cliTestConfig_t, cliTestConfig);
 
+    // not in name order, so lookups can't rely on it
     const clivalue_t valueTable[] = {
-        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, .config.array.length = 3, PG_RESERVED_FOR_TESTING_1, 0 }
+        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, .config = { .array = { .length = 3 } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "zz_last_value",               VAR_UINT16 | MASTER_VALUE, .config = { .minmax = { 0, 2000 } }, PG_RESERVED_FOR_TESTING_2, offsetof(cliTestConfig_t, last) },
+        { "mid_value_long",              VAR_UINT8 | MASTER_VALUE, .config = { .minmax = { 0, 200 } }, PG_RESERVED_FOR_TESTING_2, offsetof(cliTestConfig_t, midLong) },
+        { "AA_first_value",              VAR_UINT8 | MASTER_VALUE, .config = { .minmax = { 0, 200 } }, PG_RESERVED_FOR_TESTING_2, offsetof(cliTestConfig_t, first) },
+        { "mid_value",                   VAR_UINT8 | MASTER_VALUE, .config = { .minmax = { 0, 200 } }, PG_RESERVED_FOR_TESTING_2, offsetof(cliTestConfig_t, mid) },
     };
     const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
+    uint16_t valueTableNameIndex[ARRAYLEN(valueTable)];
     const lookupTableEntry_t lookupTables[] = {};
 
 
@@ -82,8 +104,14 @@ extern "C" {
     PG_REGISTER(pidConfig_t, pidConfig, PG_PID_CONFIG, 0);
 
     PG_REGISTER_WITH_RESET_FN(int8_t, unitTestData, PG_RESERVED_FOR_TESTING_1, 0);
+    PG_REGISTER(cliTestConfig_t, cliTestConfig, PG_RESERVED_FOR_TESTING_2, 0);
 }
 
+static bool cliOutputQuiet = false;
+static std::string cliOutput;
+static uint32_t cliTxBytesFree = 1024;
+static uint32_t fakeMicros;
+
 #include "unittest_macros.h"
 #include "gtest/gtest.h"
 TEST(CLIUnittest, TestCliSet)
@@ -115,6 +143,162 @@ TEST(CLIUnittest, TestCliSet)
     //EXPECT_EQ(false, false);
 }
 
+TEST(CLIUnittest, TestCliSetFindsNamesOutOfOrder)
+{
+    memset(cliTestConfigMutable(), 0, sizeof(cliTestConfig_t));
+
+    cliSet((char *)"zz_last_value = 1500");
+    cliSet((char *)"mid_value=7");
+    cliSet((char *)"MID_VALUE_LONG = 9");
+    cliSet((char *)"aa_first_value = 3");
+
+    EXPECT_EQ(1500, cliTestConfig()->last);
+    EXPECT_EQ(7, cliTestConfig()->mid);
+    EXPECT_EQ(9, cliTestConfig()->midLong);
+    EXPECT_EQ(3, cliTestConfig()->first);
+
+    // a prefix of a name is not a name
+    cliSet((char *)"mid_val = 5");
+    EXPECT_EQ(7, cliTestConfig()->mid);
+    EXPECT_EQ(9, cliTestConfig()->midLong);
+
+    EXPECT_EQ(NULL, cliFindValue("mid", 3));
+    EXPECT_EQ(NULL, cliFindValue("zz_last_value_more", 18));
+    EXPECT_EQ(NULL, cliFindValue("aaa", 3));
+    EXPECT_EQ(&valueTable[4], cliFindValue("mid_value", 9));
+    EXPECT_EQ(&valueTable[0], cliFindValue("array_unit_test", 15));
+}
+
+TEST(CLIUnittest, TestCliSetBatchAppliesEveryLine)
+{
+    // about the size of a diff pasted from the configurator, each line only changes its own value
+    static const char *names[] = { "aa_first_value", "mid_value", "mid_value_long", "zz_last_value" };
+    int expected[ARRAYLEN(names)] = { 0 };
+
+    cliTestConfigMutable()->first = 0;
+    cliTestConfigMutable()->mid = 0;
+    cliTestConfigMutable()->midLong = 0;
+    cliTestConfigMutable()->last = 0;
+
+    cliOutputQuiet = true;
+    for (int i = 0; i < 600; i++) {
+        char line[48];
+        const int name = i % ARRAYLEN(names);
+        expected[name] = (i * 7) % 100;
+        snprintf(line, sizeof(line), "%s = %d", names[name], expected[name]);
+        cliSet(line);
+
+        EXPECT_EQ(expected[0], cliTestConfig()->first);
+        EXPECT_EQ(expected[1], cliTestConfig()->mid);
+        EXPECT_EQ(expected[2], cliTestConfig()->midLong);
+        EXPECT_EQ(expected[3], cliTestConfig()->last);
+    }
+    cliOutputQuiet = false;
+}
+
+static uint64_t nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// the lookup cliSet() did before the name index, a scan of the whole table
+static const clivalue_t *cliFindValueLinear(const char *name, size_t length)
+{
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        const clivalue_t *val = &valueTable[i];
+        if (strncasecmp(name, val->name, strlen(val->name)) == 0 && length == strlen(val->name)) {
+            return val;
+        }
+    }
+    return NULL;
+}
+
+// Only a handful of settings live in this test's table, where the scan still wins. The index pays off with the
+// several hundred settings of a firmware build, as the scan grows with the table and the index with its logarithm.
+TEST(CLIUnittest, TestCliSetBatchThroughput)
+{
+    // about the size of a diff pasted from the configurator
+    const int lineCount = 600;
+    static const char *names[] = { "aa_first_value", "mid_value", "mid_value_long", "zz_last_value" };
+    char lines[lineCount][48];
+    for (int i = 0; i < lineCount; i++) {
+        snprintf(lines[i], sizeof(lines[i]), "%s = %d", names[i % ARRAYLEN(names)], (int)(i / ARRAYLEN(names)));
+    }
+
+    const clivalue_t *found[2][lineCount];
+    uint64_t lookupNs[2];
+    for (int indexed = 0; indexed < 2; indexed++) {
+        const uint64_t startNs = nanos();
+        for (int i = 0; i < lineCount; i++) {
+            const char *name = names[i % ARRAYLEN(names)];
+            found[indexed][i] = indexed ? cliFindValue(name, strlen(name)) : cliFindValueLinear(name, strlen(name));
+        }
+        lookupNs[indexed] = nanos() - startNs;
+    }
+    for (int i = 0; i < lineCount; i++) {
+        EXPECT_NE((const clivalue_t *)NULL, found[1][i]);
+        EXPECT_EQ(found[0][i], found[1][i]);
+    }
+
+    cliOutputQuiet = true;
+    const uint64_t startNs = nanos();
+    for (int i = 0; i < lineCount; i++) {
+        cliSet(lines[i]);
+    }
+    const uint64_t setNs = nanos() - startNs;
+    cliOutputQuiet = false;
+
+    const int lastValue = (lineCount - 1) / (int)ARRAYLEN(names);
+    EXPECT_EQ(lastValue, cliTestConfig()->first);
+    EXPECT_EQ(lastValue, cliTestConfig()->mid);
+    EXPECT_EQ(lastValue, cliTestConfig()->midLong);
+    EXPECT_EQ(lastValue, cliTestConfig()->last);
+
+    printf("cli set, %d lines over %d settings: table scan %.1fns/lookup, name index %.1fns/lookup, %.1fus/line set\n",
+        lineCount, valueTableEntryCount, (double)lookupNs[0] / lineCount, (double)lookupNs[1] / lineCount,
+        (double)setNs / lineCount / 1000);
+}
+
+TEST(CLIUnittest, TestCliDiffWaitsForTxRoom)
+{
+    cliOutputQuiet = true;
+    cliEnter(NULL);
+
+    // a port with no room gets nothing, not even the start of the dump
+    cliTxBytesFree = 0;
+    cliOutput.clear();
+    cliDiff((char *)"all");
+    cliProcess();
+    cliProcess();
+    EXPECT_EQ("", cliOutput);
+
+    // with room the dump is written out a slice per pass, ending with the prompt
+    cliTxBytesFree = 1024;
+    int passes = 0;
+    while (cliOutput.find("\r\nsave\r\n# ") == std::string::npos && passes < 1000) {
+        cliProcess();
+        passes++;
+    }
+    cliOutputQuiet = false;
+
+    EXPECT_GT(passes, 1);
+    EXPECT_LT(passes, 1000);
+    EXPECT_EQ(0u, cliOutput.find("\r\n# version"));
+    EXPECT_NE(std::string::npos, cliOutput.find("\r\n# master"));
+    // the sections written an entry per step keep their heading
+    EXPECT_NE(std::string::npos, cliOutput.find("\r\n# aux"));
+    EXPECT_NE(std::string::npos, cliOutput.find("\r\n# adjrange"));
+    EXPECT_NE(std::string::npos, cliOutput.find("\r\n# rxfail"));
+    EXPECT_NE(std::string::npos, cliOutput.find("\r\n# restore original rateprofile selection"));
+
+    // once done, further passes are back to reading input
+    const size_t length = cliOutput.size();
+    cliProcess();
+    EXPECT_EQ(length, cliOutput.size());
+}
+
 // STUBS
 extern "C" {
 
@@ -124,7 +308,8 @@ uint16_t batteryWarningVoltage;
 uint8_t useHottAlarmSoundPeriod (void) { return 0; }
 const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000}; // see baudRate_e
 
-uint32_t micros(void) {return 0;}
+// every reading moves time on, so the CLI's time slices run out
+uint32_t micros(void) { return fakeMicros += 10; }
 
 int32_t getAmperage(void) {
     return 100;
@@ -152,6 +337,10 @@ void setPrintfSerialPort(struct serialPort_s) {}
 void tfp_printf(const char * expectedFormat, ...) {
     va_list args;
 
+    if (cliOutputQuiet) {
+        return;
+    }
+
     va_start(args, expectedFormat);
     vprintf(expectedFormat, args);
     va_end(args);
@@ -159,7 +348,9 @@ void tfp_printf(const char * expectedFormat, ...) {
 
 
 void tfp_format(void *, void (*) (void *, char), const char * expectedFormat, va_list va) {
-    vprintf(expectedFormat, va);
+    if (!cliOutputQuiet) {
+        vprintf(expectedFormat, va);
+    }
 }
 
 static const box_t boxes[] = { { 0, "DUMMYBOX", 0 } };
@@ -239,7 +430,10 @@ const char *armingDisableFlagNames[]= {
 };
 
 void getTaskInfo(cfTaskId_e, cfTaskInfo_t *) {}
+void schedulerResetMaxOverheadTime(void) {}
 void getCheckFuncInfo(cfCheckFuncInfo_t *) {}
+void getSchedulerInfo(cfSchedulerInfo_t *) {}
+void getTaskHistogram(cfTaskId_e, cfTaskHistogram_t *) {}
 void schedulerResetTaskMaxExecutionTime(cfTaskId_e) {}
 
 const char * const targetName = "UNITTEST";
@@ -248,11 +442,18 @@ const char * const buildTime = "00:00:00";
 const char * const shortGitRevision = "MASTER";
 
 uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
+uint32_t serialTxBytesFree(const serialPort_t *) {return cliTxBytesFree;}
 uint8_t serialRead(serialPort_t *){return 0;}
 
-void bufWriterAppend(bufWriter_t *, uint8_t ch){ printf("%c", ch); }
+void bufWriterAppend(bufWriter_t *, uint8_t ch)
+{
+    cliOutput += (char)ch;
+    if (!cliOutputQuiet) {
+        printf("%c", ch);
+    }
+}
 void serialWriteBufShim(void *, const uint8_t *, int) {}
-bufWriter_t *bufWriterInit(uint8_t *, int, bufWrite_t, void *) {return NULL;}
+bufWriter_t *bufWriterInit(uint8_t *b, int, bufWrite_t, void *) {return (bufWriter_t *)b;}
 void schedulerSetCalulateTaskStatistics(bool) {}
 void setArmingDisabled(armingDisableFlags_e) {}
 
@@ -21,9 +21,13 @@
 #include <limits.h>
 
 #include <math.h>
+#include <time.h>
+#include <complex>
 
 extern "C" {
     #include "common/filter.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
 }
 
 #include "unittest_macros.h"
@@ -114,3 +118,275 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+static float biquadMagnitude(const biquadFilterXyz_t *filter, int axis, float freqHz, uint32_t refreshRate)
+{
+    const float omega = 2.0f * M_PIf * freqHz * refreshRate * 0.000001f;
+    const std::complex<float> z1 = std::polar(1.0f, -omega);
+    const std::complex<float> z2 = z1 * z1;
+    const std::complex<float> num = filter->b0[axis] + filter->b1[axis] * z1 + filter->b2[axis] * z2;
+    const std::complex<float> den = 1.0f + filter->a1[axis] * z1 + filter->a2[axis] * z2;
+    return std::abs(num / den);
+}
+
+TEST(FilterUnittest, TestBiquadNotchTableResponse)
+{
+    const uint32_t refreshRate = 125; // 8kHz
+    const float Q = filterGetNotchQ(400, 390);
+    biquadNotchTable_t table;
+    biquadNotchTableInit(&table, 80, 1000, refreshRate, Q);
+    EXPECT_TRUE(biquadNotchTableMatches(&table, refreshRate, Q));
+    EXPECT_FALSE(biquadNotchTableMatches(&table, 250, Q));
+    EXPECT_FALSE(biquadNotchTableMatches(&table, refreshRate, 2 * Q));
+
+    biquadFilterXyz_t exact;
+    biquadFilterXyz_t lookup;
+    biquadFilterXyzInit(&exact, 400, refreshRate, Q, FILTER_NOTCH);
+    biquadFilterXyzInit(&lookup, 400, refreshRate, Q, FILTER_NOTCH);
+
+    // centres between table entries, responses compared from DC to Nyquist
+    float maxError = 0;
+    for (float centerHz = 83.3f; centerHz < 1000; centerHz += 17.1f) {
+        biquadFilterXyzUpdate(&exact, 0, centerHz, refreshRate, Q, FILTER_NOTCH);
+        biquadFilterXyzUpdateNotchFromTable(&lookup, 0, &table, centerHz);
+        for (float freqHz = 10; freqHz < 4000; freqHz += 10) {
+            const float error = fabsf(biquadMagnitude(&lookup, 0, freqHz, refreshRate) - biquadMagnitude(&exact, 0, freqHz, refreshRate));
+            maxError = fmaxf(maxError, error);
+        }
+    }
+    EXPECT_LT(maxError, 0.01f);
+
+    // out of range centres are clamped to the table ends
+    biquadFilterXyzUpdate(&exact, 1, 1000, refreshRate, Q, FILTER_NOTCH);
+    biquadFilterXyzUpdateNotchFromTable(&lookup, 1, &table, 2000);
+    EXPECT_NEAR(exact.b0[1], lookup.b0[1], 1e-4f);
+    EXPECT_NEAR(exact.a1[1], lookup.a1[1], 1e-4f);
+    EXPECT_NEAR(exact.a2[1], lookup.a2[1], 1e-4f);
+}
+
+TEST(FilterUnittest, TestBiquadNotchTableKeepsState)
+{
+    biquadNotchTable_t table;
+    biquadNotchTableInit(&table, 80, 1000, 125, filterGetNotchQ(400, 390));
+
+    biquadFilterXyz_t filter;
+    biquadFilterXyzInit(&filter, 400, 125, filterGetNotchQ(400, 390), FILTER_NOTCH);
+    float xyz[XYZ_AXIS_COUNT] = { 100, 200, 300 };
+    biquadFilterXyzApplyDF1(&filter, xyz);
+
+    const float x1 = filter.x1[2];
+    const float y1 = filter.y1[2];
+    biquadFilterXyzUpdateNotchFromTable(&filter, 2, &table, 250);
+    EXPECT_EQ(x1, filter.x1[2]);
+    EXPECT_EQ(y1, filter.y1[2]);
+}
+
+// deterministic test signal, a slow step plus two tones and some broadband noise in deg/s
+static float filterTestSignal(int i)
+{
+    const float t = i * 0.000125f;
+    const float step = (i / 2000) % 2 ? 500.0f : -300.0f;
+    const float noise = ((i * 1103515245 + 12345) >> 16 & 0x7fff) / 32768.0f - 0.5f;
+    return step + 200.0f * sinf(2 * M_PIf * 80 * t) + 50.0f * sinf(2 * M_PIf * 600 * t) + 20.0f * noise;
+}
+
+#define FILTER_TEST_SAMPLES 16000
+
+TEST(FilterUnittest, TestPt1FilterQ15Accuracy)
+{
+    const float k = pt1FilterGain(100, 0.000125f);
+    pt1Filter_t reference;
+    pt1FilterQ15_t fixed;
+    pt1FilterInit(&reference, k);
+    pt1FilterQ15Init(&fixed, k);
+
+    float maxError = 0;
+    for (int i = 0; i < FILTER_TEST_SAMPLES; i++) {
+        const float input = filterTestSignal(i);
+        const float expected = pt1FilterApply(&reference, input);
+        maxError = fmaxf(maxError, fabsf(pt1FilterQ15Apply(&fixed, input) - expected));
+    }
+    // limited by the Q15 gain resolution, 0.05% of the step
+    EXPECT_LT(maxError, 0.5f);
+
+    // settles on a constant input
+    for (int i = 0; i < 2000; i++) {
+        pt1FilterQ15Apply(&fixed, 1234.5f);
+    }
+    EXPECT_NEAR(1234.5f, pt1FilterQ15Apply(&fixed, 1234.5f), 0.01f);
+}
+
+TEST(FilterUnittest, TestBiquadFilterQ30Accuracy)
+{
+    const biquadFilterType_e types[] = { FILTER_LPF, FILTER_NOTCH };
+    const float freqs[] = { 150, 300 };
+    const float qs[] = { BIQUAD_Q, filterGetNotchQ(300, 200) };
+
+    for (int t = 0; t < 2; t++) {
+        biquadFilter_t reference;
+        biquadFilterQ30_t fixedDF1;
+        biquadFilterQ30_t fixedDF2T;
+        biquadFilterInit(&reference, freqs[t], 125, qs[t], types[t]);
+        biquadFilterQ30Init(&fixedDF1, freqs[t], 125, qs[t], types[t]);
+        biquadFilterQ30Init(&fixedDF2T, freqs[t], 125, qs[t], types[t]);
+
+        float maxErrorDF1 = 0;
+        float maxErrorDF2T = 0;
+        for (int i = 0; i < FILTER_TEST_SAMPLES; i++) {
+            const float input = filterTestSignal(i);
+            const float expected = biquadFilterApplyDF1(&reference, input);
+            maxErrorDF1 = fmaxf(maxErrorDF1, fabsf(biquadFilterQ30ApplyDF1(&fixedDF1, input) - expected));
+            maxErrorDF2T = fmaxf(maxErrorDF2T, fabsf(biquadFilterQ30Apply(&fixedDF2T, input) - expected));
+        }
+        EXPECT_LT(maxErrorDF1, 0.01f);
+        EXPECT_LT(maxErrorDF2T, 0.01f);
+    }
+}
+
+TEST(FilterUnittest, TestLaggedMovingAverageQ16)
+{
+    int32_t buf[4];
+    laggedMovingAverageQ16_t filter;
+    laggedMovingAverageQ16Init(&filter, 4, buf);
+
+    // averages over the samples seen until the window is full
+    EXPECT_FLOAT_EQ(100.0f, laggedMovingAverageQ16Update(&filter, 100.0f));
+    EXPECT_FLOAT_EQ(150.0f, laggedMovingAverageQ16Update(&filter, 200.0f));
+    EXPECT_FLOAT_EQ(200.0f, laggedMovingAverageQ16Update(&filter, 300.0f));
+    EXPECT_FLOAT_EQ(250.0f, laggedMovingAverageQ16Update(&filter, 400.0f));
+    EXPECT_FLOAT_EQ(350.0f, laggedMovingAverageQ16Update(&filter, 500.0f));
+    EXPECT_FLOAT_EQ(50.0f, laggedMovingAverageQ16Update(&filter, -1000.0f));
+}
+
+TEST(FilterUnittest, TestFilterChainFixedStages)
+{
+    filterChain_t chain;
+    filterChainInit(&chain);
+    filterChainAddPt1Q15(&chain, pt1FilterGain(200, 0.000125f));
+    filterChainAddBiquadQ30(&chain, 250, 125, BIQUAD_Q, FILTER_LPF);
+    EXPECT_EQ(2, chain.stageCount);
+
+    pt1Filter_t pt1[XYZ_AXIS_COUNT];
+    biquadFilter_t biquad[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pt1FilterInit(&pt1[axis], pt1FilterGain(200, 0.000125f));
+        biquadFilterInit(&biquad[axis], 250, 125, BIQUAD_Q, FILTER_LPF);
+    }
+
+    for (int i = 0; i < 1000; i++) {
+        float xyz[XYZ_AXIS_COUNT] = { filterTestSignal(i), -filterTestSignal(i), 0.5f * filterTestSignal(i + 100) };
+        float expected[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            expected[axis] = biquadFilterApply(&biquad[axis], pt1FilterApply(&pt1[axis], xyz[axis]));
+        }
+        filterChainApply(&chain, xyz);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            EXPECT_NEAR(expected[axis], xyz[axis], 0.5f);
+        }
+    }
+}
+
+TEST(FilterUnittest, TestFixedPointFilterErrorBounds)
+{
+    // full scale gyro input, across the usual range of cutoffs
+    const float cutoffs[] = { 30, 80, 150, 300, 500 };
+
+    for (unsigned c = 0; c < ARRAYLEN(cutoffs); c++) {
+        const float k = pt1FilterGain(cutoffs[c], 0.000125f);
+        pt1Filter_t pt1;
+        pt1FilterQ15_t pt1Q15;
+        pt1FilterQ15_t pt1Q15Fixed;
+        pt1FilterInit(&pt1, k);
+        pt1FilterQ15Init(&pt1Q15, k);
+        pt1FilterQ15Init(&pt1Q15Fixed, k);
+
+        biquadFilter_t biquad;
+        biquadFilterQ30_t biquadQ30;
+        biquadFilterQ30_t biquadQ30Fixed;
+        biquadFilterInitLPF(&biquad, cutoffs[c], 125);
+        biquadFilterQ30InitLPF(&biquadQ30, cutoffs[c], 125);
+        biquadFilterQ30InitLPF(&biquadQ30Fixed, cutoffs[c], 125);
+
+        float pt1Error = 0;
+        float biquadError = 0;
+        for (int i = 0; i < FILTER_TEST_SAMPLES; i++) {
+            const float input = 3.5f * filterTestSignal(i);
+            const int32_t inputQ16 = lrintf(input * FILTER_Q16_ONE);
+
+            const float pt1Out = pt1FilterQ15Apply(&pt1Q15, input);
+            pt1Error = fmaxf(pt1Error, fabsf(pt1Out - pt1FilterApply(&pt1, input)));
+            // the float entry points are only a conversion around the fixed-point ones
+            EXPECT_EQ(pt1Out, pt1FilterQ15ApplyFixed(&pt1Q15Fixed, inputQ16) / FILTER_Q16_ONE);
+
+            const float biquadOut = biquadFilterQ30Apply(&biquadQ30, input);
+            biquadError = fmaxf(biquadError, fabsf(biquadOut - biquadFilterApply(&biquad, input)));
+            EXPECT_EQ(biquadOut, biquadFilterQ30ApplyFixed(&biquadQ30Fixed, inputQ16) / FILTER_Q16_ONE);
+        }
+        // bounded by the Q15 gain and Q30 coefficient resolution, which matter most at low cutoffs, and well under
+        // 0.1% of the input range
+        EXPECT_LT(pt1Error, 1.0f) << cutoffs[c] << "Hz";
+        EXPECT_LT(biquadError, 0.15f) << cutoffs[c] << "Hz";
+    }
+}
+
+static uint64_t nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Times each fixed-point kernel against its float counterpart on the same input. Host timings are only indicative,
+// the fixed-point kernels pay off on F1 targets, which have no FPU.
+TEST(FilterUnittest, TestFixedPointFilterSpeed)
+{
+    static const int repeatCount = 20;
+    static float input[FILTER_TEST_SAMPLES];
+    static float output[2][FILTER_TEST_SAMPLES];
+    for (int i = 0; i < FILTER_TEST_SAMPLES; i++) {
+        input[i] = filterTestSignal(i);
+    }
+
+    const float k = pt1FilterGain(100, 0.000125f);
+    pt1Filter_t pt1;
+    pt1FilterQ15_t pt1Q15;
+    biquadFilter_t biquad;
+    biquadFilterQ30_t biquadQ30;
+
+    const filterApplyFnPtr applyFn[][2] = {
+        { (filterApplyFnPtr)pt1FilterApply, (filterApplyFnPtr)pt1FilterQ15Apply },
+        { (filterApplyFnPtr)biquadFilterApplyDF1, (filterApplyFnPtr)biquadFilterQ30ApplyDF1 },
+        { (filterApplyFnPtr)biquadFilterApply, (filterApplyFnPtr)biquadFilterQ30Apply },
+    };
+    filter_t *filter[][2] = {
+        { (filter_t *)&pt1, (filter_t *)&pt1Q15 },
+        { (filter_t *)&biquad, (filter_t *)&biquadQ30 },
+        { (filter_t *)&biquad, (filter_t *)&biquadQ30 },
+    };
+    const char *name[] = { "pt1", "biquad DF1", "biquad DF2T" };
+    const float errorBound[] = { 1.0f, 0.15f, 0.15f };
+
+    for (unsigned f = 0; f < ARRAYLEN(applyFn); f++) {
+        uint64_t elapsedNs[2];
+        for (int kernel = 0; kernel < 2; kernel++) {
+            const uint64_t startNs = nanos();
+            for (int repeat = 0; repeat < repeatCount; repeat++) {
+                pt1FilterInit(&pt1, k);
+                pt1FilterQ15Init(&pt1Q15, k);
+                biquadFilterInitLPF(&biquad, 150, 125);
+                biquadFilterQ30InitLPF(&biquadQ30, 150, 125);
+                for (int i = 0; i < FILTER_TEST_SAMPLES; i++) {
+                    output[kernel][i] = applyFn[f][kernel](filter[f][kernel], input[i]);
+                }
+            }
+            elapsedNs[kernel] = nanos() - startNs;
+        }
+
+        for (int i = 0; i < FILTER_TEST_SAMPLES; i++) {
+            ASSERT_NEAR(output[0][i], output[1][i], errorBound[f]) << name[f] << " sample " << i;
+        }
+
+        printf("%-12s float %.2fns/sample, fixed-point %.2fns/sample\n", name[f],
+            (double)elapsedNs[0] / (repeatCount * FILTER_TEST_SAMPLES), (double)elapsedNs[1] / (repeatCount * FILTER_TEST_SAMPLES));
+    }
+}
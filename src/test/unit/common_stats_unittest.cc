@@ -0,0 +1,172 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <limits.h>
+
+#include <math.h>
+
+extern "C" {
+    #include "common/axis.h"
+    #include "common/stats.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define WINDOW_SIZE 64
+
+// reference two pass computation over the last WINDOW_SIZE samples
+static void exactMoments(const float history[][XYZ_AXIS_COUNT], int count, float *variance, float *covariance)
+{
+    double mean[XYZ_AXIS_COUNT] = { 0, 0, 0 };
+    for (int i = count - WINDOW_SIZE; i < count; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            mean[axis] += history[i][axis];
+        }
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        mean[axis] /= WINDOW_SIZE;
+    }
+
+    double m2[XYZ_AXIS_COUNT] = { 0, 0, 0 };
+    double c2[STATS_PAIR_COUNT] = { 0, 0, 0 };
+    for (int i = count - WINDOW_SIZE; i < count; i++) {
+        const double dx = history[i][X] - mean[X];
+        const double dy = history[i][Y] - mean[Y];
+        const double dz = history[i][Z] - mean[Z];
+        m2[X] += dx * dx;
+        m2[Y] += dy * dy;
+        m2[Z] += dz * dz;
+        c2[STATS_XY] += dx * dy;
+        c2[STATS_XZ] += dx * dz;
+        c2[STATS_YZ] += dy * dz;
+    }
+    for (int i = 0; i < XYZ_AXIS_COUNT; i++) {
+        variance[i] = m2[i] / WINDOW_SIZE;
+        covariance[i] = c2[i] / WINDOW_SIZE;
+    }
+}
+
+static void sample(int i, float *xyz)
+{
+    // large offsets and small noise is the worst case for naive running sums
+    xyz[X] = 900.0f + 5.0f * sinf(i * 0.37f);
+    xyz[Y] = -700.0f + 3.0f * sinf(i * 0.11f) + 2.0f * sinf(i * 0.37f);
+    xyz[Z] = 40.0f * sinf(i * 0.013f) + (i % 7) * 0.5f;
+}
+
+TEST(StatsUnittest, TestWindowMatchesExact)
+{
+    static float history[20000][XYZ_AXIS_COUNT];
+    float window[WINDOW_SIZE * XYZ_AXIS_COUNT];
+    streamStats_t stats;
+    streamStatsInit(&stats, STATS_MODE_WINDOW, WINDOW_SIZE, window);
+
+    for (int i = 0; i < 20000; i++) {
+        sample(i, history[i]);
+        streamStatsPush(&stats, history[i]);
+
+        if (i >= WINDOW_SIZE && (i % 997) == 0) {
+            float variance[XYZ_AXIS_COUNT];
+            float covariance[STATS_PAIR_COUNT];
+            exactMoments(history, i + 1, variance, covariance);
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                EXPECT_NEAR(variance[axis], streamStatsVariance(&stats, axis), 0.01f + variance[axis] * 1e-3f);
+            }
+            for (int pair = 0; pair < STATS_PAIR_COUNT; pair++) {
+                EXPECT_NEAR(covariance[pair], streamStatsCovariance(&stats, (statsPair_e)pair), 0.01f + fabsf(covariance[pair]) * 1e-3f);
+            }
+        }
+    }
+    EXPECT_NEAR(900.0f, streamStatsMean(&stats, X), 1.0f);
+}
+
+TEST(StatsUnittest, TestWindowNoDrift)
+{
+    // roughly half an hour at 8kHz, the variance of a constant signal must stay at zero
+    float window[WINDOW_SIZE * XYZ_AXIS_COUNT];
+    streamStats_t stats;
+    streamStatsInit(&stats, STATS_MODE_WINDOW, WINDOW_SIZE, window);
+
+    float xyz[XYZ_AXIS_COUNT];
+    for (int i = 0; i < 15000000; i++) {
+        sample(i, xyz);
+        streamStatsPush(&stats, xyz);
+    }
+    for (int i = 0; i < WINDOW_SIZE; i++) {
+        xyz[X] = 1234.5f;
+        xyz[Y] = -321.0f;
+        xyz[Z] = 0.25f;
+        streamStatsPush(&stats, xyz);
+    }
+    EXPECT_FLOAT_EQ(1234.5f, streamStatsMean(&stats, X));
+    EXPECT_NEAR(0.0f, streamStatsVariance(&stats, X), 1e-6f);
+    EXPECT_NEAR(0.0f, streamStatsVariance(&stats, Y), 1e-6f);
+    EXPECT_NEAR(0.0f, streamStatsVariance(&stats, Z), 1e-6f);
+    EXPECT_NEAR(0.0f, streamStatsCovariance(&stats, STATS_XY), 1e-6f);
+}
+
+TEST(StatsUnittest, TestFixedWindow)
+{
+    static float history[5000][XYZ_AXIS_COUNT];
+    int16_t window[WINDOW_SIZE * XYZ_AXIS_COUNT];
+    streamStats_t stats;
+    streamStatsInit(&stats, STATS_MODE_WINDOW_FIXED, WINDOW_SIZE, window);
+
+    for (int i = 0; i < 5000; i++) {
+        sample(i, history[i]);
+        streamStatsPush(&stats, history[i]);
+    }
+
+    float variance[XYZ_AXIS_COUNT];
+    float covariance[STATS_PAIR_COUNT];
+    exactMoments(history, 5000, variance, covariance);
+    // quantisation to 1/STATS_FIXED_SCALE adds a little noise
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_NEAR(variance[axis], streamStatsVariance(&stats, axis), 0.05f + variance[axis] * 0.01f);
+    }
+    EXPECT_NEAR(covariance[STATS_XY], streamStatsCovariance(&stats, STATS_XY), 0.05f + fabsf(covariance[STATS_XY]) * 0.01f);
+
+    // out of range samples saturate rather than wrap
+    float big[XYZ_AXIS_COUNT] = { 10000.0f, -10000.0f, 0.0f };
+    streamStatsPush(&stats, big);
+    EXPECT_EQ(INT16_MAX, window[(stats.windex + WINDOW_SIZE - 1) % WINDOW_SIZE * XYZ_AXIS_COUNT + X]);
+    EXPECT_EQ(INT16_MIN, window[(stats.windex + WINDOW_SIZE - 1) % WINDOW_SIZE * XYZ_AXIS_COUNT + Y]);
+}
+
+TEST(StatsUnittest, TestExponential)
+{
+    streamStats_t stats;
+    streamStatsInit(&stats, STATS_MODE_EXPONENTIAL, WINDOW_SIZE, NULL);
+
+    // alternating +-1 has a variance of 1
+    float xyz[XYZ_AXIS_COUNT];
+    for (int i = 0; i < 2000; i++) {
+        const float v = (i & 1) ? 1.0f : -1.0f;
+        xyz[X] = 100.0f + v;
+        xyz[Y] = 100.0f - v;
+        xyz[Z] = 0.0f;
+        streamStatsPush(&stats, xyz);
+    }
+    EXPECT_NEAR(100.0f, streamStatsMean(&stats, X), 0.05f);
+    EXPECT_NEAR(1.0f, streamStatsVariance(&stats, X), 0.05f);
+    EXPECT_NEAR(-1.0f, streamStatsCovariance(&stats, STATS_XY), 0.05f);
+    EXPECT_NEAR(0.0f, streamStatsVariance(&stats, Z), 1e-6f);
+}
@@ -0,0 +1,278 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "config/config_eeprom.h"
+    #include "drivers/system.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    typedef struct smallConfig_s {
+        uint16_t value;
+        uint8_t flags;
+    } smallConfig_t;
+
+    typedef struct bigConfig_s {
+        uint8_t data[600];
+    } bigConfig_t;
+
+    PG_DECLARE(smallConfig_t, smallConfig);
+    PG_DECLARE(bigConfig_t, bigConfig);
+
+    PG_REGISTER_WITH_RESET_TEMPLATE(smallConfig_t, smallConfig, PG_RESERVED_FOR_TESTING_1, 0);
+    PG_RESET_TEMPLATE(smallConfig_t, smallConfig,
+        .value = 1234,
+        .flags = 5,
+    );
+
+    PG_REGISTER(bigConfig_t, bigConfig, PG_RESERVED_FOR_TESTING_2, 0);
+
+    uint8_t eepromData[EEPROM_SIZE] __attribute__((aligned(0x400)));
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define BANK_SIZE (EEPROM_SIZE / EEPROM_BANK_COUNT)
+#define HEADER_SIZE 4 // with the generation of a banked EEPROM
+#define RECORD_HEADER_SIZE 6
+#define SEGMENT_END_SIZE 4 // footer and CRC
+
+static int eraseCount;
+static int programCount;
+static bool flashFailed;
+
+static int alignToWord(int size)
+{
+    return (size + 3) & ~3;
+}
+
+static int fullConfigSize(void)
+{
+    return alignToWord(HEADER_SIZE + RECORD_HEADER_SIZE + sizeof(smallConfig_t) + RECORD_HEADER_SIZE + sizeof(bigConfig_t) + SEGMENT_END_SIZE);
+}
+
+static void saveFreshConfig(void)
+{
+    memset(eepromData, 0, sizeof(eepromData));
+    pgResetAll();
+    writeConfigToEEPROM();
+    loadEEPROM();
+
+    eraseCount = 0;
+    programCount = 0;
+}
+
+static bool bankIsValid(int bank)
+{
+    return eepromData[bank * BANK_SIZE + 1] == 0xBE;
+}
+
+TEST(ConfigEepromTest, SaveToBlankWritesWholeConfig)
+{
+    saveFreshConfig();
+
+    EXPECT_FALSE(flashFailed);
+    EXPECT_TRUE(isEEPROMStructureValid());
+    EXPECT_TRUE(isEEPROMVersionValid());
+    EXPECT_EQ(fullConfigSize(), getEEPROMConfigSize());
+
+    smallConfigMutable()->value = 0;
+    bigConfigMutable()->data[10] = 0x55;
+    EXPECT_TRUE(loadEEPROM());
+
+    EXPECT_EQ(1234, smallConfig()->value);
+    EXPECT_EQ(5, smallConfig()->flags);
+    EXPECT_EQ(0, bigConfig()->data[10]);
+}
+
+TEST(ConfigEepromTest, AppendsOnlyChangedGroups)
+{
+    saveFreshConfig();
+
+    smallConfigMutable()->value = 4321;
+    writeConfigToEEPROM();
+
+    EXPECT_FALSE(flashFailed);
+    EXPECT_EQ(0, eraseCount);
+    EXPECT_EQ(alignToWord(RECORD_HEADER_SIZE + sizeof(smallConfig_t) + SEGMENT_END_SIZE) / 4, programCount);
+    EXPECT_EQ(fullConfigSize() + alignToWord(RECORD_HEADER_SIZE + sizeof(smallConfig_t) + SEGMENT_END_SIZE), getEEPROMConfigSize());
+
+    // the latest record of a PG wins
+    smallConfigMutable()->value = 0;
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(4321, smallConfig()->value);
+    EXPECT_EQ(5, smallConfig()->flags);
+}
+
+TEST(ConfigEepromTest, UnchangedSaveWritesNothing)
+{
+    saveFreshConfig();
+
+    writeConfigToEEPROM();
+
+    EXPECT_FALSE(flashFailed);
+    EXPECT_EQ(0, eraseCount);
+    EXPECT_EQ(0, programCount);
+    EXPECT_EQ(fullConfigSize(), getEEPROMConfigSize());
+}
+
+TEST(ConfigEepromTest, CompactsIntoOtherBankWhenFull)
+{
+    saveFreshConfig();
+    EXPECT_TRUE(bankIsValid(0));
+
+    const int appendSize = alignToWord(RECORD_HEADER_SIZE + sizeof(bigConfig_t) + SEGMENT_END_SIZE);
+    const int appends = (BANK_SIZE - fullConfigSize()) / appendSize;
+
+    for (int i = 1; i <= appends; i++) {
+        bigConfigMutable()->data[0] = i;
+        writeConfigToEEPROM();
+        EXPECT_TRUE(bankIsValid(0));
+        EXPECT_EQ(fullConfigSize() + i * appendSize, getEEPROMConfigSize());
+    }
+
+    bigConfigMutable()->data[0] = 0xAA;
+    smallConfigMutable()->flags = 7;
+    writeConfigToEEPROM();
+
+    EXPECT_FALSE(flashFailed);
+    EXPECT_FALSE(bankIsValid(0));
+    EXPECT_TRUE(bankIsValid(1));
+    EXPECT_EQ(fullConfigSize(), getEEPROMConfigSize());
+
+    memset(bigConfigMutable(), 0, sizeof(bigConfig_t));
+    smallConfigMutable()->flags = 0;
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(0xAA, bigConfig()->data[0]);
+    EXPECT_EQ(7, smallConfig()->flags);
+    EXPECT_EQ(1234, smallConfig()->value);
+}
+
+TEST(ConfigEepromTest, ResetBeforeRetireKeepsNewestBank)
+{
+    static uint8_t oldBank[BANK_SIZE];
+
+    for (int newBank = 1; newBank >= 0; newBank--) {
+        const int oldBankIndex = 1 - newBank;
+
+        if (newBank == 1) {
+            saveFreshConfig();
+        }
+        // fill the active bank so the next save compacts into the other one
+        const int appendSize = alignToWord(RECORD_HEADER_SIZE + sizeof(bigConfig_t) + SEGMENT_END_SIZE);
+        const int appends = (BANK_SIZE - fullConfigSize()) / appendSize;
+        for (int i = 1; i <= appends; i++) {
+            bigConfigMutable()->data[0] = i;
+            writeConfigToEEPROM();
+        }
+        EXPECT_TRUE(bankIsValid(oldBankIndex));
+        memcpy(oldBank, &eepromData[oldBankIndex * BANK_SIZE], BANK_SIZE);
+
+        bigConfigMutable()->data[0] = 0xAA;
+        smallConfigMutable()->value = 1000 + newBank;
+        writeConfigToEEPROM();
+        EXPECT_FALSE(flashFailed);
+        EXPECT_TRUE(bankIsValid(newBank));
+
+        // a reset before the old bank was retired leaves it valid
+        memcpy(&eepromData[oldBankIndex * BANK_SIZE], oldBank, BANK_SIZE);
+        EXPECT_TRUE(bankIsValid(oldBankIndex));
+
+        smallConfigMutable()->value = 0;
+        EXPECT_TRUE(loadEEPROM());
+        EXPECT_EQ(1000 + newBank, smallConfig()->value);
+        EXPECT_EQ(fullConfigSize(), getEEPROMConfigSize());
+    }
+}
+
+TEST(ConfigEepromTest, TornAppendForcesCompaction)
+{
+    saveFreshConfig();
+
+    // a segment cut short by a reset leaves programmed bytes that don't checksum
+    eepromData[fullConfigSize()] = 0x12;
+    EXPECT_TRUE(isEEPROMStructureValid());
+    EXPECT_EQ(fullConfigSize(), getEEPROMConfigSize());
+
+    smallConfigMutable()->value = 99;
+    writeConfigToEEPROM();
+
+    EXPECT_FALSE(flashFailed);
+    EXPECT_FALSE(bankIsValid(0));
+    EXPECT_TRUE(bankIsValid(1));
+    EXPECT_EQ(fullConfigSize(), getEEPROMConfigSize());
+
+    smallConfigMutable()->value = 0;
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(99, smallConfig()->value);
+}
+
+TEST(ConfigEepromTest, CorruptConfigIsInvalid)
+{
+    saveFreshConfig();
+
+    eepromData[HEADER_SIZE + RECORD_HEADER_SIZE] ^= 0x01;
+    EXPECT_FALSE(isEEPROMStructureValid());
+
+    pgResetAll();
+    smallConfigMutable()->value = 0;
+    EXPECT_FALSE(loadEEPROM());
+    EXPECT_EQ(1234, smallConfig()->value);
+}
+
+// STUBS
+
+extern "C" {
+
+void FLASH_Unlock(void) {}
+void FLASH_Lock(void) {}
+
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address)
+{
+    memset((void *)Page_Address, 0xFF, 0x400);
+    eraseCount++;
+    return FLASH_COMPLETE;
+}
+
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data)
+{
+    // programming can only clear bits
+    uint32_t word;
+    memcpy(&word, (void *)addr, sizeof(word));
+    word &= Data;
+    memcpy((void *)addr, &word, sizeof(word));
+    programCount++;
+    return FLASH_COMPLETE;
+}
+
+void failureMode(failureMode_e mode)
+{
+    UNUSED(mode);
+    flashFailed = true;
+}
+
+}
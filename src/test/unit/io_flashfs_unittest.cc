@@ -0,0 +1,506 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/flash.h"
+
+    #include "io/flashfs.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_PAGE_SIZE 256
+#define TEST_SECTOR_SIZE 4096
+#define TEST_SECTORS 64
+#define TEST_FLASH_SIZE (TEST_SECTOR_SIZE * TEST_SECTORS)
+
+static uint8_t flashMemory[TEST_FLASH_SIZE];
+static uint32_t flashProgramAddress;
+static int flashProgramCount;
+static int flashEraseCount;
+static bool flashBusy;
+
+static const flashGeometry_t testGeometry = {
+    .sectors = TEST_SECTORS,
+    .pageSize = TEST_PAGE_SIZE,
+    .sectorSize = TEST_SECTOR_SIZE,
+    .totalSize = TEST_FLASH_SIZE,
+    .pagesPerSector = TEST_SECTOR_SIZE / TEST_PAGE_SIZE,
+    .flashType = FLASH_TYPE_NOR,
+};
+
+static void writeLog(uint32_t timestamp, const char *header, int length)
+{
+    flashfsLogBegin(timestamp);
+    flashfsWrite((const uint8_t *)header, strlen(header), true);
+    for (int i = strlen(header); i < length; i++) {
+        flashfsWriteByte(i & 0x7F);
+    }
+    flashfsFlushSync();
+    flashfsLogEnd();
+}
+
+static void resetFlash(void)
+{
+    memset(flashMemory, 0xFF, sizeof(flashMemory));
+    flashBusy = false;
+    flashfsInit();
+    flashProgramCount = 0;
+    flashEraseCount = 0;
+}
+
+static void runErase(void)
+{
+    while (flashfsIsErasing()) {
+        flashfsEraseUpdate();
+    }
+}
+
+#define LOG_HEADER "H Product:Blackbox flight data recorder\n"
+
+TEST(FlashfsUnittest, TestVolumeExcludesDirectory)
+{
+    resetFlash();
+
+    EXPECT_EQ((uint32_t)(TEST_FLASH_SIZE - TEST_SECTOR_SIZE), flashfsGetSize());
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    EXPECT_EQ(0, flashfsGetLogCount());
+    EXPECT_EQ(0, flashfsIdentifyStartOfFreeSpace());
+}
+
+TEST(FlashfsUnittest, TestLogsRecordedAndReloaded)
+{
+    resetFlash();
+
+    // the second log starts on the free block after the first without a seek
+    writeLog(1500000000, LOG_HEADER, 1000);
+    writeLog(1500000100, LOG_HEADER, 5000);
+
+    EXPECT_EQ(2, flashfsGetLogCount());
+
+    // the directory survives a reboot
+    flashfsInit();
+
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    ASSERT_EQ(2, flashfsGetLogCount());
+    EXPECT_EQ(0u, flashfsGetLog(0)->start);
+    EXPECT_EQ(1000u, flashfsGetLog(0)->length);
+    EXPECT_EQ(1500000000u, flashfsGetLog(0)->timestamp);
+    EXPECT_EQ(2048u, flashfsGetLog(1)->start);
+    EXPECT_EQ(5000u, flashfsGetLog(1)->length);
+    EXPECT_EQ(1500000100u, flashfsGetLog(1)->timestamp);
+
+    // and new logs start on the next free block after the last one
+    EXPECT_EQ(8192, flashfsIdentifyStartOfFreeSpace());
+    EXPECT_EQ(8192u, flashfsGetOffset());
+}
+
+TEST(FlashfsUnittest, TestOpenLogClosedAtStartup)
+{
+    resetFlash();
+
+    flashfsLogBegin(1500000000);
+    flashfsWrite((const uint8_t *)LOG_HEADER, strlen(LOG_HEADER), true);
+    for (int i = 0; i < 3000; i++) {
+        flashfsWriteByte(0x55);
+    }
+    flashfsFlushSync();
+
+    // power lost before flashfsLogEnd()
+    flashfsInit();
+
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    ASSERT_EQ(1, flashfsGetLogCount());
+    EXPECT_EQ(0u, flashfsGetLog(0)->start);
+    // the end is found on a free block boundary
+    EXPECT_EQ(4096u, flashfsGetLog(0)->length);
+    EXPECT_EQ(1500000000u, flashfsGetLog(0)->timestamp);
+}
+
+TEST(FlashfsUnittest, TestCorruptDirectoryRebuilt)
+{
+    resetFlash();
+
+    writeLog(1500000000, LOG_HEADER, 1000);
+    writeLog(1500000100, LOG_HEADER, 3000);
+
+    // damage the first begin record
+    flashMemory[TEST_FLASH_SIZE - TEST_SECTOR_SIZE + 16 + 8] ^= 0x01;
+
+    flashfsInit();
+
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    ASSERT_EQ(2, flashfsGetLogCount());
+    EXPECT_EQ(0u, flashfsGetLog(0)->start);
+    EXPECT_EQ(2048u, flashfsGetLog(0)->length);
+    EXPECT_EQ(0u, flashfsGetLog(0)->timestamp);
+    EXPECT_EQ(2048u, flashfsGetLog(1)->start);
+    EXPECT_EQ(4096u, flashfsGetLog(1)->length);
+}
+
+TEST(FlashfsUnittest, TestOldFormatFullChipSurvivesFirstBoot)
+{
+    // a volume written before the directory existed, the last log runs to the end of the chip
+    memcpy(flashMemory, LOG_HEADER, strlen(LOG_HEADER));
+    for (int i = strlen(LOG_HEADER); i < TEST_FLASH_SIZE; i++) {
+        flashMemory[i] = i & 0x7F;
+    }
+    static uint8_t lastSector[TEST_SECTOR_SIZE];
+    memcpy(lastSector, &flashMemory[TEST_FLASH_SIZE - TEST_SECTOR_SIZE], TEST_SECTOR_SIZE);
+    flashEraseCount = 0;
+    flashProgramCount = 0;
+
+    flashfsInit();
+
+    // the logs are left alone and the free space is found by scanning
+    EXPECT_FALSE(flashfsLogDirectoryIsValid());
+    EXPECT_EQ(0, flashEraseCount);
+    EXPECT_EQ(0, flashProgramCount);
+    EXPECT_EQ(0, memcmp(lastSector, &flashMemory[TEST_FLASH_SIZE - TEST_SECTOR_SIZE], TEST_SECTOR_SIZE));
+    EXPECT_EQ((int)flashfsGetSize(), flashfsIdentifyStartOfFreeSpace());
+
+    // until the next full erase, which starts a directory
+    flashfsEraseCompletely();
+    runErase();
+    flashfsInit();
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    EXPECT_EQ(0, flashfsGetLogCount());
+}
+
+TEST(FlashfsUnittest, TestOldFormatVolumeGetsDirectory)
+{
+    resetFlash();
+
+    // logs written before the directory existed that stop short of its sector
+    memcpy(flashMemory, LOG_HEADER, strlen(LOG_HEADER));
+    memcpy(&flashMemory[2048], LOG_HEADER, strlen(LOG_HEADER));
+
+    flashfsInit();
+
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    ASSERT_EQ(2, flashfsGetLogCount());
+    EXPECT_EQ(2048u, flashfsGetLog(1)->start);
+    EXPECT_EQ(4096, flashfsIdentifyStartOfFreeSpace());
+}
+
+TEST(FlashfsUnittest, TestEraseCompletelyEmptiesDirectory)
+{
+    resetFlash();
+
+    writeLog(1500000000, LOG_HEADER, 1000);
+    flashfsEraseCompletely();
+    runErase();
+    flashfsInit();
+
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    EXPECT_EQ(0, flashfsGetLogCount());
+    EXPECT_EQ(0, flashfsIdentifyStartOfFreeSpace());
+}
+
+TEST(FlashfsUnittest, TestDirectoryOverflowFallsBackToScan)
+{
+    resetFlash();
+
+    for (int i = 0; i < FLASHFS_LOG_DIRECTORY_MAX_LOGS + 1 && flashfsLogDirectoryIsValid(); i++) {
+        writeLog(0, LOG_HEADER, 100);
+    }
+
+    EXPECT_FALSE(flashfsLogDirectoryIsValid());
+    EXPECT_EQ(0, flashfsGetLogCount());
+
+    // the free space is still found by searching the volume
+    flashfsInit();
+    EXPECT_FALSE(flashfsLogDirectoryIsValid());
+    EXPECT_EQ((FLASHFS_LOG_DIRECTORY_MAX_LOGS + 1) * 2048, flashfsIdentifyStartOfFreeSpace());
+}
+
+TEST(FlashfsUnittest, TestAsyncWritesProgramWholePages)
+{
+    resetFlash();
+
+    uint8_t data[TEST_PAGE_SIZE];
+    memset(data, 0x55, sizeof(data));
+
+    // less than the flush threshold stays in the buffer
+    EXPECT_TRUE(flashfsWrite(data, FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN / 2, false));
+    EXPECT_EQ(0, flashProgramCount);
+    EXPECT_FALSE(flashfsFlushAsync(false));
+    EXPECT_EQ(0, flashProgramCount);
+    EXPECT_EQ(0xFF, flashMemory[0]);
+
+    // reaching it programs everything buffered in one operation
+    EXPECT_TRUE(flashfsWrite(data, FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN / 2, false));
+    EXPECT_EQ(1, flashProgramCount);
+    EXPECT_EQ(0x55, flashMemory[FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN - 1]);
+
+    // a forced flush writes a partial page
+    flashfsWriteByte(0xAA);
+    EXPECT_TRUE(flashfsFlushAsync(true));
+    EXPECT_EQ(2, flashProgramCount);
+    EXPECT_EQ(0xAA, flashMemory[FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN]);
+}
+
+TEST(FlashfsUnittest, TestBusyChipCountsStallsAndDrops)
+{
+    resetFlash();
+
+    uint8_t data[FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN];
+    memset(data, 0x55, sizeof(data));
+
+    const uint32_t stalls = flashfsGetStallCount();
+    const uint32_t drops = flashfsGetDroppedWriteCount();
+
+    flashBusy = true;
+
+    // the first write fills the threshold but the chip is busy, that is one stall however long it lasts
+    EXPECT_TRUE(flashfsWrite(data, sizeof(data), false));
+    EXPECT_FALSE(flashfsFlushAsync(false));
+    EXPECT_FALSE(flashfsFlushAsync(false));
+    EXPECT_EQ(stalls + 1, flashfsGetStallCount());
+    EXPECT_EQ(0, flashProgramCount);
+
+    // once the buffer is full writes are dropped
+    EXPECT_FALSE(flashfsWrite(data, sizeof(data), false));
+    EXPECT_EQ(drops + 1, flashfsGetDroppedWriteCount());
+
+    // and nothing already buffered is lost when the chip is free again
+    flashBusy = false;
+    EXPECT_TRUE(flashfsFlushAsync(true));
+    EXPECT_EQ((uint32_t)sizeof(data), flashfsGetOffset());
+    EXPECT_EQ(0x55, flashMemory[sizeof(data) - 1]);
+    EXPECT_EQ(0xFF, flashMemory[sizeof(data)]);
+}
+
+TEST(FlashfsUnittest, TestEraseRunsInBackground)
+{
+    resetFlash();
+
+    writeLog(1500000000, LOG_HEADER, 3 * TEST_SECTOR_SIZE);
+
+    flashfsEraseCompletely();
+
+    // the volume is empty straight away, but nothing has been erased yet
+    EXPECT_TRUE(flashfsIsErasing());
+    EXPECT_FALSE(flashfsIsReady());
+    EXPECT_EQ(0, flashfsGetLogCount());
+    EXPECT_EQ(0u, flashfsGetOffset());
+    EXPECT_EQ(0, flashEraseCount);
+
+    // one sector at a time, and only while the chip is free
+    flashBusy = true;
+    EXPECT_FALSE(flashfsEraseUpdate());
+    EXPECT_EQ(0, flashEraseCount);
+    flashBusy = false;
+
+    flashfsEraseUpdate();   // directory
+    flashfsEraseUpdate();   // erase record
+    EXPECT_EQ(1, flashEraseCount);
+    EXPECT_EQ(0, flashfsGetEraseProgress());
+
+    flashfsEraseUpdate();
+    EXPECT_EQ(2, flashEraseCount);
+    EXPECT_EQ(0xFF, flashMemory[0]);
+    EXPECT_EQ(0x7F, flashMemory[TEST_SECTOR_SIZE + 0x7F]);
+    EXPECT_EQ(100 / (TEST_SECTORS - 1), flashfsGetEraseProgress());
+
+    int updates = 0;
+    while (!flashfsEraseUpdate()) {
+        updates++;
+    }
+    EXPECT_EQ(TEST_SECTORS - 2, updates);
+    EXPECT_EQ(TEST_SECTORS, flashEraseCount);
+    EXPECT_FALSE(flashfsIsErasing());
+    EXPECT_TRUE(flashfsIsReady());
+    EXPECT_EQ(100, flashfsGetEraseProgress());
+
+    flashfsInit();
+    EXPECT_FALSE(flashfsIsErasing());
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    EXPECT_EQ(0, flashfsGetLogCount());
+}
+
+TEST(FlashfsUnittest, TestWritesWaitForTheirSector)
+{
+    resetFlash();
+
+    writeLog(1500000000, LOG_HEADER, 3 * TEST_SECTOR_SIZE);
+    flashfsEraseCompletely();
+
+    // the directory has to be erased before a log can begin
+    EXPECT_FALSE(flashfsLogBegin(1500000100));
+    flashfsEraseUpdate();
+    flashfsEraseUpdate();
+    EXPECT_TRUE(flashfsLogBegin(1500000100));
+    flashProgramCount = 0;
+
+    uint8_t data[FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN];
+    memset(data, 0x55, sizeof(data));
+
+    // an asynchronous write into a sector still to be erased is held in the buffer
+    EXPECT_TRUE(flashfsWrite(data, sizeof(data), false));
+    EXPECT_FALSE(flashfsFlushAsync(false));
+    EXPECT_EQ(0, flashProgramCount);
+
+    flashfsEraseUpdate();
+    EXPECT_TRUE(flashfsFlushAsync(false));
+    EXPECT_EQ(0x55, flashMemory[0]);
+
+    // a synchronous one erases the sector itself
+    const uint32_t next = TEST_SECTOR_SIZE - 16;
+    flashfsSeekAbs(next);
+    EXPECT_TRUE(flashfsWrite(data, sizeof(data), false));
+    flashfsFlushSync();
+    EXPECT_EQ(0x55, flashMemory[next + sizeof(data) - 1]);
+    EXPECT_EQ(0xFF, flashMemory[TEST_SECTOR_SIZE + 0x7F]);
+}
+
+TEST(FlashfsUnittest, TestEraseAheadOfWrites)
+{
+    resetFlash();
+
+    writeLog(1500000000, LOG_HEADER, 8 * TEST_SECTOR_SIZE);
+    flashfsEraseCompletely();
+    flashfsSetEraseAhead(2 * TEST_SECTOR_SIZE);
+
+    for (int i = 0; i < 10; i++) {
+        flashfsEraseUpdate();
+    }
+    // the directory and the two sectors ahead of the write position
+    EXPECT_EQ(3, flashEraseCount);
+    EXPECT_TRUE(flashfsIsErasing());
+
+    flashfsSeekAbs(TEST_SECTOR_SIZE);
+    flashfsEraseUpdate();
+    EXPECT_EQ(4, flashEraseCount);
+    flashfsEraseUpdate();
+    EXPECT_EQ(4, flashEraseCount);
+
+    // and the rest once logging stops
+    flashfsSetEraseAhead(0);
+    runErase();
+    EXPECT_EQ(TEST_SECTORS, flashEraseCount);
+}
+
+TEST(FlashfsUnittest, TestInterruptedEraseResumed)
+{
+    resetFlash();
+
+    writeLog(1500000000, LOG_HEADER, 8 * TEST_SECTOR_SIZE);
+    flashfsEraseCompletely();
+    flashfsSetEraseAhead(2 * TEST_SECTOR_SIZE);
+    for (int i = 0; i < 4; i++) {
+        flashfsEraseUpdate();
+    }
+    writeLog(1500000100, LOG_HEADER, 1000);
+
+    // power lost with the old log still on most of the volume
+    flashfsInit();
+
+    EXPECT_TRUE(flashfsLogDirectoryIsValid());
+    ASSERT_EQ(1, flashfsGetLogCount());
+    EXPECT_EQ(1000u, flashfsGetLog(0)->length);
+    EXPECT_EQ(1500000100u, flashfsGetLog(0)->timestamp);
+
+    // the erase carries on after the sectors already in use
+    EXPECT_TRUE(flashfsIsErasing());
+    EXPECT_FALSE(flashfsIsReady());
+    flashEraseCount = 0;
+    runErase();
+    EXPECT_EQ(TEST_SECTORS - 2, flashEraseCount);
+    EXPECT_EQ(0xFF, flashMemory[3 * TEST_SECTOR_SIZE + 0x7F]);
+    EXPECT_EQ('H', flashMemory[0]);
+
+    // and is not done again once complete
+    flashfsInit();
+    EXPECT_FALSE(flashfsIsErasing());
+    EXPECT_EQ(1, flashfsGetLogCount());
+}
+
+// STUBS
+
+extern "C" {
+
+const flashGeometry_t *flashGetGeometry(void)
+{
+    return &testGeometry;
+}
+
+bool flashIsReady(void)
+{
+    return !flashBusy;
+}
+
+bool flashWaitForReady(uint32_t timeoutMillis)
+{
+    UNUSED(timeoutMillis);
+    return true;
+}
+
+void flashEraseSector(uint32_t address)
+{
+    flashEraseCount++;
+    memset(&flashMemory[address - address % TEST_SECTOR_SIZE], 0xFF, TEST_SECTOR_SIZE);
+}
+
+void flashEraseCompletely(void)
+{
+    memset(flashMemory, 0xFF, sizeof(flashMemory));
+}
+
+void flashPageProgramBegin(uint32_t address)
+{
+    flashProgramAddress = address;
+    flashProgramCount++;
+}
+
+void flashPageProgramContinue(const uint8_t *data, int length)
+{
+    // programming can only clear bits
+    for (int i = 0; i < length; i++) {
+        flashMemory[flashProgramAddress++] &= data[i];
+    }
+}
+
+void flashPageProgramFinish(void)
+{
+}
+
+void flashPageProgram(uint32_t address, const uint8_t *data, int length)
+{
+    flashPageProgramBegin(address);
+    flashPageProgramContinue(data, length);
+    flashPageProgramFinish();
+}
+
+int flashReadBytes(uint32_t address, uint8_t *buffer, int length)
+{
+    memcpy(buffer, &flashMemory[address], length);
+    return length;
+}
+
+void flashFlush(void)
+{
+}
+
+}
@@ -17,12 +17,17 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 #include <limits.h>
 
 extern "C" {
     #include "platform.h"
 
+    #include "common/ring_buffer.h"
+
     #include "drivers/serial.h"
     #include "drivers/serial_softserial.h"
     #include "drivers/serial_uart.h"
@@ -47,6 +52,212 @@ TEST(IoSerialTest, TestFindPortConfig)
     EXPECT_EQ(NULL, portConfig);
 }
 
+TEST(IoSerialTest, TestRingBufferPushPop)
+{
+    uint8_t storage[8];
+    ringBuffer_t rb;
+    ringBufferInit(&rb, storage, sizeof(storage));
+
+    EXPECT_TRUE(ringBufferIsEmpty(&rb));
+    EXPECT_EQ(8U, ringBufferSize(&rb));
+    EXPECT_EQ(8U, ringBufferFree(&rb));
+
+    // the whole buffer can be used
+    for (int i = 0; i < 8; i++) {
+        EXPECT_TRUE(ringBufferPush(&rb, i));
+    }
+    EXPECT_FALSE(ringBufferPush(&rb, 0xff));
+    EXPECT_EQ(8U, ringBufferUsed(&rb));
+    EXPECT_EQ(0U, ringBufferFree(&rb));
+
+    for (int i = 0; i < 8; i++) {
+        EXPECT_EQ(i, ringBufferPop(&rb));
+    }
+    EXPECT_TRUE(ringBufferIsEmpty(&rb));
+
+    // single bytes wrap around many times
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(ringBufferPush(&rb, i));
+        EXPECT_TRUE(ringBufferPush(&rb, i + 1));
+        EXPECT_EQ(i, ringBufferPop(&rb));
+        EXPECT_EQ(i + 1, ringBufferPop(&rb));
+    }
+    EXPECT_TRUE(ringBufferIsEmpty(&rb));
+}
+
+TEST(IoSerialTest, TestRingBufferBulk)
+{
+    uint8_t storage[16];
+    ringBuffer_t rb;
+    ringBufferInit(&rb, storage, sizeof(storage));
+
+    uint8_t in[32];
+    uint8_t out[32];
+    for (unsigned i = 0; i < sizeof(in); i++) {
+        in[i] = i + 1;
+    }
+
+    // only what fits is taken
+    EXPECT_EQ(16U, ringBufferPushN(&rb, in, 20));
+    EXPECT_EQ(0U, ringBufferPushN(&rb, in, 1));
+    EXPECT_EQ(10U, ringBufferPopN(&rb, out, 10));
+    EXPECT_EQ(0, memcmp(in, out, 10));
+
+    // this copy wraps around the end of the storage
+    EXPECT_EQ(10U, ringBufferPushN(&rb, &in[16], 10));
+    EXPECT_EQ(16U, ringBufferUsed(&rb));
+    EXPECT_EQ(16U, ringBufferPopN(&rb, out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(&in[10], out, 16));
+    EXPECT_EQ(0U, ringBufferPopN(&rb, out, sizeof(out)));
+
+    // mixes of single and bulk accesses keep the order
+    ringBufferPush(&rb, 0xaa);
+    EXPECT_EQ(5U, ringBufferPushN(&rb, in, 5));
+    EXPECT_EQ(0xaa, ringBufferPop(&rb));
+    EXPECT_EQ(5U, ringBufferPopN(&rb, out, 5));
+    EXPECT_EQ(0, memcmp(in, out, 5));
+}
+
+TEST(IoSerialTest, TestRingBufferSpans)
+{
+    uint8_t storage[16];
+    ringBuffer_t rb;
+    ringBufferInit(&rb, storage, sizeof(storage));
+
+    uint8_t *span;
+    EXPECT_EQ(0U, ringBufferPeekSpan(&rb, &span));
+    EXPECT_EQ(16U, ringBufferWriteSpan(&rb, &span));
+    EXPECT_EQ(storage, span);
+
+    // data written in place is only visible once committed
+    memset(span, 0x11, 12);
+    EXPECT_TRUE(ringBufferIsEmpty(&rb));
+    ringBufferCommit(&rb, 12);
+    EXPECT_EQ(12U, ringBufferPeekSpan(&rb, &span));
+    EXPECT_EQ(storage, span);
+    ringBufferConsume(&rb, 12);
+
+    // at the end of the storage the spans stop at its end, the rest follows from the start
+    EXPECT_EQ(4U, ringBufferWriteSpan(&rb, &span));
+    EXPECT_EQ(&storage[12], span);
+    uint8_t in[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    EXPECT_EQ(10U, ringBufferPushN(&rb, in, sizeof(in)));
+
+    EXPECT_EQ(4U, ringBufferPeekSpan(&rb, &span));
+    EXPECT_EQ(&storage[12], span);
+    EXPECT_EQ(0, memcmp(in, span, 4));
+    ringBufferConsume(&rb, 4);
+
+    EXPECT_EQ(6U, ringBufferPeekSpan(&rb, &span));
+    EXPECT_EQ(storage, span);
+    EXPECT_EQ(0, memcmp(&in[4], span, 6));
+    EXPECT_EQ(10U, ringBufferWriteSpan(&rb, &span));
+    EXPECT_EQ(&storage[6], span);
+}
+
+TEST(IoSerialTest, TestRingBufferIndexOverflow)
+{
+    uint8_t storage[16];
+    ringBuffer_t rb;
+    ringBufferInit(&rb, storage, sizeof(storage));
+
+    // the indices run freely, used and free stay right when they wrap
+    rb.head = rb.tail = UINT32_MAX - 5;
+
+    uint8_t in[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    uint8_t out[12];
+    EXPECT_EQ(12U, ringBufferPushN(&rb, in, sizeof(in)));
+    EXPECT_EQ(12U, ringBufferUsed(&rb));
+    EXPECT_EQ(4U, ringBufferFree(&rb));
+    EXPECT_EQ(12U, ringBufferPopN(&rb, out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(in, out, sizeof(in)));
+    EXPECT_TRUE(ringBufferIsEmpty(&rb));
+}
+
+TEST(IoSerialTest, TestRingBufferBulkMatchesSingleBytes)
+{
+    uint8_t storage[16];
+    ringBuffer_t rb;
+
+    uint8_t in[16];
+    uint8_t out[16];
+    for (unsigned i = 0; i < sizeof(in); i++) {
+        in[i] = i * 7 + 1;
+    }
+
+    // every length from every position in the storage, so each way a copy can be split is covered
+    for (unsigned start = 0; start < sizeof(storage); start++) {
+        for (unsigned length = 1; length <= sizeof(storage); length++) {
+            ringBufferInit(&rb, storage, sizeof(storage));
+            rb.head = rb.tail = start;
+
+            EXPECT_EQ(length, ringBufferPushN(&rb, in, length));
+            for (unsigned i = 0; i < length; i++) {
+                EXPECT_EQ(in[i], ringBufferPop(&rb)) << start << " " << length;
+            }
+            EXPECT_TRUE(ringBufferIsEmpty(&rb));
+
+            for (unsigned i = 0; i < length; i++) {
+                EXPECT_TRUE(ringBufferPush(&rb, in[i]));
+            }
+            memset(out, 0, sizeof(out));
+            EXPECT_EQ(length, ringBufferPopN(&rb, out, sizeof(out)));
+            EXPECT_EQ(0, memcmp(in, out, length)) << start << " " << length;
+            EXPECT_TRUE(ringBufferIsEmpty(&rb));
+        }
+    }
+}
+
+static uint64_t nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+TEST(IoSerialTest, TestRingBufferThroughput)
+{
+    static const uint32_t TRANSFER_SIZE = 4 * 1024 * 1024;
+    static const uint32_t CHUNK_SIZE = 48; // not a divisor of the buffer size, so copies wrap
+    static uint8_t storage[256];
+    ringBuffer_t rb;
+
+    uint8_t in[CHUNK_SIZE];
+    uint8_t out[CHUNK_SIZE];
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        in[i] = i * 7;
+    }
+
+    uint32_t checksum[2];
+    uint64_t elapsedNs[2];
+    for (int bulk = 0; bulk < 2; bulk++) {
+        ringBufferInit(&rb, storage, sizeof(storage));
+        checksum[bulk] = 0;
+        const uint64_t startNs = nanos();
+        for (uint32_t moved = 0; moved < TRANSFER_SIZE; moved += CHUNK_SIZE) {
+            if (bulk) {
+                ringBufferPushN(&rb, in, CHUNK_SIZE);
+                ringBufferPopN(&rb, out, CHUNK_SIZE);
+            } else {
+                for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+                    ringBufferPush(&rb, in[i]);
+                }
+                for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+                    out[i] = ringBufferPop(&rb);
+                }
+            }
+            checksum[bulk] = checksum[bulk] * 31 + out[moved % CHUNK_SIZE];
+        }
+        elapsedNs[bulk] = nanos() - startNs;
+        EXPECT_TRUE(ringBufferIsEmpty(&rb));
+        EXPECT_EQ(0, memcmp(in, out, CHUNK_SIZE));
+    }
+    EXPECT_EQ(checksum[0], checksum[1]);
+
+    printf("ring buffer, %u bytes: single byte push/pop %.3fns/byte, bulk push/pop %.3fns/byte\n",
+        TRANSFER_SIZE, (double)elapsedNs[0] / TRANSFER_SIZE, (double)elapsedNs[1] / TRANSFER_SIZE);
+}
+
 
 // STUBS
 extern "C" {
@@ -60,7 +271,9 @@ extern "C" {
 
     uint32_t serialRxBytesWaiting(const serialPort_t *) { return 0; }
     uint8_t serialRead(serialPort_t *) { return 0; }
+    uint32_t serialReadBuf(serialPort_t *, uint8_t *, uint32_t) { return 0; }
     void serialWrite(serialPort_t *, uint8_t) {}
+    void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
 
     serialPort_t *usbVcpOpen(void) { return NULL; }
 
@@ -0,0 +1,329 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/maths.h"
+    #include "common/streambuf.h"
+    #include "common/utils.h"
+
+    #include "drivers/time.h"
+
+    #include "interface/msp.h"
+    #include "interface/msp_dataflash_bulk.h"
+    #include "interface/msp_protocol_v2_emuflight.h"
+
+    #include "msp/msp_serial.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_FLASH_SIZE     4096
+#define TEST_CHUNK_SIZE     16
+#define TEST_PAYLOAD_MAX    1024
+
+static uint8_t flashMemory[TEST_FLASH_SIZE];
+static timeMs_t testMillis;
+
+typedef struct {
+    uint32_t address;
+    uint32_t length;
+    uint16_t chunkSize;
+    uint8_t window;
+    uint16_t chunkCount;
+} bulkReply_t;
+
+typedef struct {
+    mspStreamResult_e result;
+    uint16_t sequence;
+    uint32_t address;
+    uint16_t length;
+} bulkChunk_t;
+
+static bulkReply_t bulkRead(uint32_t address, uint32_t length, uint16_t chunkSize, uint8_t window, uint16_t payloadMax)
+{
+    uint8_t request[11];
+    sbuf_t src = { request, ARRAYEND(request) };
+    sbufWriteU32(&src, address);
+    sbufWriteU32(&src, length);
+    sbufWriteU16(&src, chunkSize);
+    sbufWriteU8(&src, window);
+    sbufSwitchToReader(&src, request);
+
+    uint8_t reply[13];
+    sbuf_t dst = { reply, ARRAYEND(reply) };
+    dataflashBulkRead(&dst, &src, payloadMax);
+    sbufSwitchToReader(&dst, reply);
+
+    bulkReply_t result;
+    result.address = sbufReadU32(&dst);
+    result.length = sbufReadU32(&dst);
+    result.chunkSize = sbufReadU16(&dst);
+    result.window = sbufReadU8(&dst);
+    result.chunkCount = sbufReadU16(&dst);
+    return result;
+}
+
+static void bulkAck(uint16_t firstMissing, uint32_t receivedAfter)
+{
+    uint8_t ack[6];
+    sbuf_t src = { ack, ARRAYEND(ack) };
+    sbufWriteU16(&src, firstMissing);
+    sbufWriteU32(&src, receivedAfter);
+    sbufSwitchToReader(&src, ack);
+    dataflashBulkAck(&src);
+}
+
+static bulkChunk_t bulkStream(void)
+{
+    static uint8_t frame[TEST_PAYLOAD_MAX];
+    mspPacket_t packet;
+    memset(&packet, 0, sizeof(packet));
+    packet.buf.ptr = frame;
+    packet.buf.end = ARRAYEND(frame);
+
+    bulkChunk_t chunk;
+    memset(&chunk, 0, sizeof(chunk));
+    chunk.result = dataflashBulkStream(&packet);
+    if (chunk.result != MSP_STREAM_SEND) {
+        return chunk;
+    }
+    EXPECT_EQ(MSP2_EMUF_DATAFLASH_BULK_CHUNK, (uint16_t)packet.cmd);
+
+    sbufSwitchToReader(&packet.buf, frame);
+    chunk.sequence = sbufReadU16(&packet.buf);
+    chunk.address = sbufReadU32(&packet.buf);
+    chunk.length = sbufReadU16(&packet.buf);
+    const uint8_t *data = sbufPtr(&packet.buf);
+    EXPECT_EQ(0, memcmp(data, &flashMemory[chunk.address], chunk.length));
+    sbufAdvance(&packet.buf, chunk.length);
+    EXPECT_EQ(crc16_ccitt_update(0, data, chunk.length), sbufReadU16(&packet.buf));
+    return chunk;
+}
+
+class DataflashBulkTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        for (int i = 0; i < TEST_FLASH_SIZE; i++) {
+            flashMemory[i] = i * 7 + (i >> 8);
+        }
+        testMillis = 1000;
+    }
+};
+
+TEST_F(DataflashBulkTest, TestChunkSizeFitsThePort)
+{
+    // UART, 256 byte transmit buffer less the frame overhead
+    bulkReply_t reply = bulkRead(0, TEST_FLASH_SIZE, 4096, 8, 256 - 18);
+    EXPECT_EQ(228, reply.chunkSize);
+    EXPECT_EQ((TEST_FLASH_SIZE + 227) / 228, reply.chunkCount);
+
+    // the requested size when it fits
+    reply = bulkRead(0, TEST_FLASH_SIZE, 100, 8, 256 - 18);
+    EXPECT_EQ(100, reply.chunkSize);
+
+    // the flash buffer is the limit on ports with a big transmit buffer
+    reply = bulkRead(0, TEST_FLASH_SIZE, 8192, 8, UINT16_MAX);
+    EXPECT_EQ(MSP_PORT_DATAFLASH_BUFFER_SIZE, reply.chunkSize);
+
+    // not even the smallest chunk fits, nothing is sent
+    reply = bulkRead(0, TEST_FLASH_SIZE, 4096, 8, 20);
+    EXPECT_EQ(0, reply.length);
+    EXPECT_EQ(0, reply.chunkCount);
+    EXPECT_FALSE(dataflashBulkIsActive());
+    EXPECT_EQ(MSP_STREAM_DONE, bulkStream().result);
+}
+
+TEST_F(DataflashBulkTest, TestLengthTruncatedToTheVolume)
+{
+    const bulkReply_t reply = bulkRead(TEST_FLASH_SIZE - 40, 1000, TEST_CHUNK_SIZE, 4, TEST_PAYLOAD_MAX);
+    EXPECT_EQ(40, reply.length);
+    EXPECT_EQ(3, reply.chunkCount);
+
+    EXPECT_EQ(16, bulkStream().length);
+    EXPECT_EQ(16, bulkStream().length);
+    const bulkChunk_t last = bulkStream();
+    EXPECT_EQ(2, last.sequence);
+    EXPECT_EQ(TEST_FLASH_SIZE - 8, last.address);
+    EXPECT_EQ(8, last.length);
+}
+
+TEST_F(DataflashBulkTest, TestWindowLimitsChunksInFlight)
+{
+    bulkRead(0, 10 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE, 4, TEST_PAYLOAD_MAX);
+
+    for (int i = 0; i < 4; i++) {
+        const bulkChunk_t chunk = bulkStream();
+        EXPECT_EQ(MSP_STREAM_SEND, chunk.result);
+        EXPECT_EQ(i, chunk.sequence);
+        EXPECT_EQ(i * TEST_CHUNK_SIZE, chunk.address);
+    }
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+
+    // two chunks acknowledged, two more may go
+    bulkAck(2, 0);
+    EXPECT_EQ(4, bulkStream().sequence);
+    EXPECT_EQ(5, bulkStream().sequence);
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+}
+
+TEST_F(DataflashBulkTest, TestDroppedChunkIsSentAgain)
+{
+    bulkRead(0, 10 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE, 4, TEST_PAYLOAD_MAX);
+    for (int i = 0; i < 4; i++) {
+        bulkStream();
+    }
+
+    // chunk 1 was lost, 2 and 3 arrived
+    bulkAck(1, 0x3);
+    bulkChunk_t chunk = bulkStream();
+    EXPECT_EQ(MSP_STREAM_SEND, chunk.result);
+    EXPECT_EQ(1, chunk.sequence);
+    EXPECT_EQ(TEST_CHUNK_SIZE, chunk.address);
+
+    // chunks 2 and 3 hold their place in the window until 1 is acknowledged
+    EXPECT_EQ(4, bulkStream().sequence);
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+
+    bulkAck(5, 0);
+    EXPECT_EQ(5, bulkStream().sequence);
+}
+
+TEST_F(DataflashBulkTest, TestRepeatedAckDoesNotResendAgain)
+{
+    bulkRead(0, 10 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE, 8, TEST_PAYLOAD_MAX);
+    for (int i = 0; i < 4; i++) {
+        bulkStream();
+    }
+
+    bulkAck(1, 0x1);
+    EXPECT_EQ(1, bulkStream().sequence);
+
+    // acks already on their way report the same loss, the resent chunk is not sent a third time
+    bulkAck(1, 0x1);
+    bulkAck(1, 0x3);
+    EXPECT_EQ(4, bulkStream().sequence);
+    EXPECT_EQ(5, bulkStream().sequence);
+}
+
+TEST_F(DataflashBulkTest, TestReorderedAcks)
+{
+    bulkRead(0, 10 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE, 4, TEST_PAYLOAD_MAX);
+    for (int i = 0; i < 4; i++) {
+        bulkStream();
+    }
+
+    // the newer ack overtakes an older one, which then must not move the window back or resend anything
+    bulkAck(3, 0x0);
+    bulkAck(1, 0x1);
+    EXPECT_EQ(4, bulkStream().sequence);
+    EXPECT_EQ(5, bulkStream().sequence);
+    EXPECT_EQ(6, bulkStream().sequence);
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+
+    // an ack for chunks never sent is ignored
+    bulkAck(9, 0x0);
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+
+    bulkAck(7, 0x0);
+    EXPECT_EQ(7, bulkStream().sequence);
+}
+
+TEST_F(DataflashBulkTest, TestResendWhenAcksStop)
+{
+    bulkRead(0, 10 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE, 4, TEST_PAYLOAD_MAX);
+    for (int i = 0; i < 4; i++) {
+        bulkStream();
+    }
+    bulkAck(1, 0x0);
+    EXPECT_EQ(4, bulkStream().sequence);
+
+    testMillis += 100;
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+
+    // the oldest chunk not acknowledged goes again, once per resend period
+    testMillis += 1;
+    EXPECT_EQ(1, bulkStream().sequence);
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+    testMillis += 101;
+    EXPECT_EQ(1, bulkStream().sequence);
+    EXPECT_TRUE(dataflashBulkIsActive());
+}
+
+TEST_F(DataflashBulkTest, TestTimeoutEndsTransfer)
+{
+    bulkRead(0, 10 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE, 4, TEST_PAYLOAD_MAX);
+    bulkStream();
+
+    testMillis += 2001;
+    EXPECT_EQ(MSP_STREAM_DONE, bulkStream().result);
+    EXPECT_FALSE(dataflashBulkIsActive());
+
+    // late acks don't bring it back
+    bulkAck(1, 0x0);
+    EXPECT_EQ(MSP_STREAM_DONE, bulkStream().result);
+}
+
+TEST_F(DataflashBulkTest, TestTransferEndsWhenAllAcknowledged)
+{
+    const bulkReply_t reply = bulkRead(0, 3 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE, 8, TEST_PAYLOAD_MAX);
+    EXPECT_EQ(3, reply.chunkCount);
+    EXPECT_EQ(0, bulkStream().sequence);
+    EXPECT_EQ(1, bulkStream().sequence);
+    EXPECT_EQ(2, bulkStream().sequence);
+    EXPECT_EQ(MSP_STREAM_WAIT, bulkStream().result);
+
+    bulkAck(3, 0x0);
+    EXPECT_EQ(MSP_STREAM_DONE, bulkStream().result);
+    EXPECT_FALSE(dataflashBulkIsActive());
+}
+
+// STUBS
+
+extern "C" {
+
+timeMs_t millis(void)
+{
+    return testMillis;
+}
+
+uint32_t flashfsGetSize(void)
+{
+    return TEST_FLASH_SIZE;
+}
+
+int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len)
+{
+    if (offset >= TEST_FLASH_SIZE) {
+        return 0;
+    }
+    len = MIN(len, TEST_FLASH_SIZE - offset);
+    memcpy(data, &flashMemory[offset], len);
+    return len;
+}
+
+}
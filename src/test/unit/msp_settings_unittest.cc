@@ -0,0 +1,316 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/streambuf.h"
+    #include "common/utils.h"
+
+    #include "fc/config.h"
+    #include "fc/controlrate_profile.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/pid.h"
+
+    #include "interface/msp.h"
+    #include "interface/msp_protocol_v2_emuflight.h"
+    #include "interface/msp_settings.h"
+    #include "interface/settings.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    typedef struct mspSettingsTestConfig_s {
+        uint8_t mid;
+        uint16_t last;
+        uint8_t mode;
+        uint8_t flags;
+    } mspSettingsTestConfig_t;
+
+    PG_DECLARE(mspSettingsTestConfig_t, mspSettingsTestConfig);
+    PG_REGISTER(mspSettingsTestConfig_t, mspSettingsTestConfig, PG_RESERVED_FOR_TESTING_1, 0);
+    PG_REGISTER_ARRAY(pidProfile_t, PID_PROFILE_COUNT, pidProfiles, PG_PID_PROFILE, 0);
+    PG_REGISTER_ARRAY(controlRateConfig_t, CONTROL_RATE_PROFILE_COUNT, controlRateProfiles, PG_CONTROL_RATE_PROFILES, 0);
+
+    static const char * const lookupTableMode[] = { "OFF", "LOW", "HIGH" };
+    const lookupTableEntry_t lookupTables[] = {
+        { lookupTableMode, ARRAYLEN(lookupTableMode) },
+    };
+
+    const clivalue_t valueTable[] = {
+        { "mid_value",      VAR_UINT8 | MASTER_VALUE, .config = { .minmax = { 0, 200 } }, PG_RESERVED_FOR_TESTING_1, offsetof(mspSettingsTestConfig_t, mid) },
+        { "last_value",     VAR_UINT16 | MASTER_VALUE, .config = { .minmax = { 0, 2000 } }, PG_RESERVED_FOR_TESTING_1, offsetof(mspSettingsTestConfig_t, last) },
+        { "mode",           VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config = { .lookup = { (lookupTableIndex_e)0 } }, PG_RESERVED_FOR_TESTING_1, offsetof(mspSettingsTestConfig_t, mode) },
+        { "flag_bit",       VAR_UINT8 | MASTER_VALUE | MODE_BITSET, .config = { .bitpos = 2 }, PG_RESERVED_FOR_TESTING_1, offsetof(mspSettingsTestConfig_t, flags) },
+        { "p_pitch",        VAR_UINT8 | PROFILE_VALUE, .config = { .minmax = { 0, 200 } }, PG_PID_PROFILE, offsetof(pidProfile_t, pid[PID_PITCH].P) },
+        { "roll_rc_rate",   VAR_UINT8 | PROFILE_RATE_VALUE, .config = { .minmax = { 1, 255 } }, PG_CONTROL_RATE_PROFILES, offsetof(controlRateConfig_t, rcRates[FD_ROLL]) },
+    };
+    const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
+
+    uint8_t armingFlags;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static uint8_t currentPidProfileIndex;
+static uint8_t currentRateProfileIndex;
+static int writeEEPROMCount;
+
+static uint8_t reply[256];
+static sbuf_t replyBuf;
+
+static sbuf_t *runCommand(mspResult_e *result, uint16_t cmd, const uint8_t *request, int requestLength)
+{
+    sbuf_t src = { const_cast<uint8_t *>(request), const_cast<uint8_t *>(request) + requestLength };
+    replyBuf.ptr = reply;
+    replyBuf.end = ARRAYEND(reply);
+
+    switch (cmd) {
+    case MSP2_EMUF_SETTINGS_INFO:
+        mspSettingsInfo(&replyBuf, &src);
+        *result = MSP_RESULT_ACK;
+        break;
+    case MSP2_EMUF_SETTINGS_READ:
+        mspSettingsRead(&replyBuf, &src);
+        *result = MSP_RESULT_ACK;
+        break;
+    default:
+        *result = mspSettingsWrite(&replyBuf, &src);
+        break;
+    }
+    sbufSwitchToReader(&replyBuf, reply);
+    return &replyBuf;
+}
+
+static uint32_t nameHash(const char *name)
+{
+    uint32_t hash = 2166136261U;
+    while (*name) {
+        hash ^= (uint8_t)tolower((unsigned char)*name++);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+// Looks the setting up by name in the metadata, the way a host does. Returns its position, or -1.
+static int findSetting(const char *name, int16_t *min = NULL, int16_t *max = NULL)
+{
+    const uint8_t request[] = { 0, 0 };
+    mspResult_e result;
+    sbuf_t *dst = runCommand(&result, MSP2_EMUF_SETTINGS_INFO, request, sizeof(request));
+
+    EXPECT_EQ(MSP_RESULT_ACK, result);
+    EXPECT_EQ(valueTableEntryCount, sbufReadU16(dst));
+    sbufReadU32(dst);
+    EXPECT_EQ(0, sbufReadU16(dst));
+    const uint8_t entries = sbufReadU8(dst);
+    EXPECT_EQ(valueTableEntryCount, entries);
+
+    for (int i = 0; i < entries; i++) {
+        const uint32_t hash = sbufReadU32(dst);
+        sbufReadU8(dst);
+        sbufReadU8(dst);
+        const int16_t entryMin = sbufReadU16(dst);
+        const int16_t entryMax = sbufReadU16(dst);
+        sbufReadU16(dst);
+        sbufReadU16(dst);
+        if (hash == nameHash(name)) {
+            if (min) {
+                *min = entryMin;
+                *max = entryMax;
+            }
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int readSetting(int setting)
+{
+    const uint8_t request[] = { (uint8_t)setting, (uint8_t)(setting >> 8), 1 };
+    mspResult_e result;
+    sbuf_t *dst = runCommand(&result, MSP2_EMUF_SETTINGS_READ, request, sizeof(request));
+
+    EXPECT_EQ(setting, sbufReadU16(dst));
+    EXPECT_EQ(1, sbufReadU8(dst));
+    return sbufBytesRemaining(dst) == 2 ? sbufReadU16(dst) : sbufReadU8(dst);
+}
+
+static mspResult_e writeSettings(const uint8_t *request, int requestLength, uint16_t *replyValue)
+{
+    mspResult_e result;
+    sbuf_t *dst = runCommand(&result, MSP2_EMUF_SETTINGS_WRITE, request, requestLength);
+    *replyValue = sbufBytesRemaining(dst) >= 2 ? sbufReadU16(dst) : 0xFFFF;
+    return result;
+}
+
+class MspSettingsTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        memset(mspSettingsTestConfigMutable(), 0, sizeof(mspSettingsTestConfig_t));
+        memset(pidProfilesMutable(0), 0, sizeof(pidProfile_t) * PID_PROFILE_COUNT);
+        memset(controlRateProfilesMutable(0), 0, sizeof(controlRateConfig_t) * CONTROL_RATE_PROFILE_COUNT);
+        currentPidProfileIndex = 0;
+        currentRateProfileIndex = 0;
+        writeEEPROMCount = 0;
+        armingFlags = 0;
+    }
+};
+
+TEST_F(MspSettingsTest, TestLookupByName)
+{
+    EXPECT_EQ(0, findSetting("mid_value"));
+    EXPECT_EQ(4, findSetting("P_PITCH"));
+    EXPECT_EQ(-1, findSetting("mid"));
+
+    int16_t min, max;
+    EXPECT_EQ(1, findSetting("last_value", &min, &max));
+    EXPECT_EQ(0, min);
+    EXPECT_EQ(2000, max);
+    EXPECT_EQ(2, findSetting("mode", &min, &max));
+    EXPECT_EQ(0, min);
+    EXPECT_EQ(2, max);
+
+    mspSettingsTestConfigMutable()->last = 1234;
+    EXPECT_EQ(1234, readSetting(findSetting("last_value")));
+}
+
+TEST_F(MspSettingsTest, TestWriteAppliesValues)
+{
+    // one run of mid_value, last_value, mode and flag_bit
+    const uint8_t request[] = { MSP2_EMUF_SETTINGS_WRITE_SAVE, 0, 0, 4, 150, 0xD2, 0x04, 2, 1 };
+    uint16_t applied;
+    EXPECT_EQ(MSP_RESULT_ACK, writeSettings(request, sizeof(request), &applied));
+
+    EXPECT_EQ(4, applied);
+    EXPECT_EQ(150, mspSettingsTestConfig()->mid);
+    EXPECT_EQ(1234, mspSettingsTestConfig()->last);
+    EXPECT_EQ(2, mspSettingsTestConfig()->mode);
+    EXPECT_EQ(1 << 2, mspSettingsTestConfig()->flags);
+    EXPECT_EQ(1, writeEEPROMCount);
+    EXPECT_EQ(1, readSetting(3));
+}
+
+TEST_F(MspSettingsTest, TestOutOfRangeRejected)
+{
+    mspSettingsTestConfigMutable()->mid = 10;
+    mspSettingsTestConfigMutable()->last = 20;
+    uint16_t badSetting;
+
+    // the valid first value isn't applied when a later one is out of range
+    const uint8_t overMax[] = { MSP2_EMUF_SETTINGS_WRITE_SAVE, 0, 0, 2, 100, 0xD1, 0x07 };
+    EXPECT_EQ(MSP_RESULT_ERROR, writeSettings(overMax, sizeof(overMax), &badSetting));
+    EXPECT_EQ(1, badSetting);
+    EXPECT_EQ(10, mspSettingsTestConfig()->mid);
+    EXPECT_EQ(20, mspSettingsTestConfig()->last);
+    EXPECT_EQ(0, writeEEPROMCount);
+
+    const uint8_t overLookup[] = { 0, 2, 0, 1, 3 };
+    EXPECT_EQ(MSP_RESULT_ERROR, writeSettings(overLookup, sizeof(overLookup), &badSetting));
+    EXPECT_EQ(2, badSetting);
+
+    const uint8_t badBit[] = { 0, 3, 0, 1, 2 };
+    EXPECT_EQ(MSP_RESULT_ERROR, writeSettings(badBit, sizeof(badBit), &badSetting));
+    EXPECT_EQ(3, badSetting);
+
+    const uint8_t underMin[] = { 0, 5, 0, 1, 0 };
+    EXPECT_EQ(MSP_RESULT_ERROR, writeSettings(underMin, sizeof(underMin), &badSetting));
+    EXPECT_EQ(5, badSetting);
+
+    // past the end of the table
+    const uint8_t pastEnd[] = { 0, 5, 0, 2, 10, 10 };
+    EXPECT_EQ(MSP_RESULT_ERROR, writeSettings(pastEnd, sizeof(pastEnd), &badSetting));
+    EXPECT_EQ(6, badSetting);
+    EXPECT_EQ(0, controlRateProfiles(0)->rcRates[FD_ROLL]);
+
+    // a value cut short
+    const uint8_t truncated[] = { 0, 1, 0, 1, 0xD2 };
+    EXPECT_EQ(MSP_RESULT_ERROR, writeSettings(truncated, sizeof(truncated), &badSetting));
+    EXPECT_EQ(1, badSetting);
+
+    // nothing is written while armed
+    ENABLE_ARMING_FLAG(ARMED);
+    const uint8_t valid[] = { 0, 0, 0, 1, 100 };
+    EXPECT_EQ(MSP_RESULT_ERROR, writeSettings(valid, sizeof(valid), &badSetting));
+    EXPECT_EQ(10, mspSettingsTestConfig()->mid);
+}
+
+TEST_F(MspSettingsTest, TestProfileValuesOfCurrentProfile)
+{
+    const int pPitch = findSetting("p_pitch");
+    const int rollRcRate = findSetting("roll_rc_rate");
+    pidProfilesMutable(0)->pid[PID_PITCH].P = 40;
+    pidProfilesMutable(2)->pid[PID_PITCH].P = 60;
+    controlRateProfilesMutable(0)->rcRates[FD_ROLL] = 100;
+    controlRateProfilesMutable(3)->rcRates[FD_ROLL] = 130;
+
+    EXPECT_EQ(40, readSetting(pPitch));
+    EXPECT_EQ(100, readSetting(rollRcRate));
+
+    currentPidProfileIndex = 2;
+    currentRateProfileIndex = 3;
+    EXPECT_EQ(60, readSetting(pPitch));
+    EXPECT_EQ(130, readSetting(rollRcRate));
+
+    const uint8_t request[] = { 0, (uint8_t)pPitch, 0, 2, 65, 140 };
+    uint16_t applied;
+    EXPECT_EQ(MSP_RESULT_ACK, writeSettings(request, sizeof(request), &applied));
+    EXPECT_EQ(2, applied);
+    EXPECT_EQ(65, pidProfiles(2)->pid[PID_PITCH].P);
+    EXPECT_EQ(140, controlRateProfiles(3)->rcRates[FD_ROLL]);
+
+    // the other profiles keep their values
+    EXPECT_EQ(40, pidProfiles(0)->pid[PID_PITCH].P);
+    EXPECT_EQ(0, pidProfiles(1)->pid[PID_PITCH].P);
+    EXPECT_EQ(100, controlRateProfiles(0)->rcRates[FD_ROLL]);
+}
+
+// STUBS
+
+extern "C" {
+
+uint8_t getCurrentPidProfileIndex(void)
+{
+    return currentPidProfileIndex;
+}
+
+uint8_t getCurrentControlRateProfileIndex(void)
+{
+    return currentRateProfileIndex;
+}
+
+void writeEEPROM(void)
+{
+    writeEEPROMCount++;
+}
+
+bool readEEPROM(void)
+{
+    return true;
+}
+
+}
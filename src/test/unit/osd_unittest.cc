@@ -562,6 +562,116 @@ TEST(OsdTest, TestElementRssi)
     displayPortTestBufferSubstring(8, 1, "%c50", SYM_RSSI);
 }
 
+/*
+ * Tests that an element is only written again once its content changes.
+ */
+TEST(OsdTest, TestElementRedrawnOnlyWhenChanged)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_RSSI_VALUE] = OSD_POS(8, 1) | VISIBLE_FLAG;
+    osdConfigMutable()->rssi_alarm = 0;
+
+    rssi = 1024;
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    displayPortTestBufferSubstring(8, 1, "%c99", SYM_RSSI);
+
+    // when
+    testDisplayPortBuffer[1 * UNITTEST_DISPLAYPORT_COLS + 9] = 'X';
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(8, 1, "%cX9", SYM_RSSI);
+
+    // when
+    rssi = 0;
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(8, 1, "%c 0", SYM_RSSI);
+}
+
+/*
+ * Tests that the cells an element no longer covers are blanked, and overlapped elements repainted.
+ */
+TEST(OsdTest, TestElementVacatedCellsBlanked)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(10, 4) | VISIBLE_FLAG;
+    strcpy(pilotConfigMutable()->name, "LONGNAME");
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    displayPortTestBufferSubstring(10, 4, "LONGNAME");
+
+    // when
+    strcpy(pilotConfigMutable()->name, "AB");
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(10, 4, "AB      ");
+
+    // when
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(10, 5) | VISIBLE_FLAG;
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(10, 4, "  ");
+    displayPortTestBufferSubstring(10, 5, "AB");
+
+    // when
+    // the power element is drawn over the middle of the craft name
+    simulationBatteryAmperage = 0;
+    strcpy(pilotConfigMutable()->name, "LONGNAME");
+    osdConfigMutable()->item_pos[OSD_POWER] = OSD_POS(12, 5) | VISIBLE_FLAG;
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(10, 5, "LO   0WE");
+
+    // when
+    osdConfigMutable()->item_pos[OSD_POWER] = OSD_POS(12, 5);
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(10, 5, "LONGNAME  ");
+
+    // when
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(10, 5);
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(10, 5, "          ");
+}
+
+/*
+ * Tests that an element running past the last column is only erased up to it, and not into the next row.
+ */
+TEST(OsdTest, TestElementClippedAtRightEdge)
+{
+    // given
+    const int x = UNITTEST_DISPLAYPORT_COLS - 4;
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(x, 6) | VISIBLE_FLAG;
+    osdConfigMutable()->item_pos[OSD_RSSI_VALUE] = OSD_POS(0, 7) | VISIBLE_FLAG;
+    strcpy(pilotConfigMutable()->name, "LONGNAME");
+    rssi = 1024;
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    displayPortTestBufferSubstring(x, 6, "LONG");
+    displayPortTestBufferSubstring(0, 7, "%c99", SYM_RSSI);
+
+    // when
+    strcpy(pilotConfigMutable()->name, "AB");
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(x, 6, "AB  ");
+    displayPortTestBufferSubstring(0, 7, "%c99", SYM_RSSI);
+
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(x, 6);
+    osdConfigMutable()->item_pos[OSD_RSSI_VALUE] = OSD_POS(0, 7);
+    osdRefresh(simulationTime);
+}
+
 /*
  * Tests the instantaneous battery current OSD element.
  */
@@ -1030,6 +1140,14 @@ extern "C" {
         return 0;
     }
 
+    uint32_t blackboxGetDroppedFrameCount(void) {
+        return 0;
+    }
+
+    uint32_t blackboxGetDeviceStallCount(void) {
+        return 0;
+    }
+
     bool isSerialTransmitBufferEmpty(const serialPort_t *) {
         return false;
     }
@@ -39,9 +39,12 @@ extern "C" {
     #include "rx/rx.h"
     #include "rx/crsf.h"
 
+    #include "scheduler/scheduler.h"
+
     #include "telemetry/msp_shared.h"
 
     void crsfDataReceive(uint16_t c);
+    void crsfFrameReceive(const uint8_t *data, uint16_t length, const uint8_t *wrapData, uint16_t wrapLength, timeUs_t frameTimeUs, void *callbackData);
     uint8_t crsfFrameCRC(void);
     uint8_t crsfFrameStatus(void);
     uint16_t crsfReadRawRC(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
@@ -277,6 +280,37 @@ TEST(CrossFireTest, TestCrsfDataReceive)
     EXPECT_EQ(crc, crsfFrame.frame.payload[CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE]);
 }
 
+TEST(CrossFireTest, TestCrsfFrameReceive)
+{
+    // a partial frame received byte by byte is dropped when a whole frame arrives
+    crsfFrameDone = false;
+    crsfDataReceive(capturedData[0]);
+    crsfDataReceive(capturedData[1]);
+
+    crsfFrameReceive(capturedData, sizeof(crsfRcChannelsFrame_t), NULL, 0, 1234, NULL);
+    EXPECT_EQ(true, crsfFrameDone);
+    EXPECT_EQ(CRSF_FRAMETYPE_RC_CHANNELS_PACKED, crsfFrame.frame.type);
+    for (int ii = 0; ii < CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_CRC; ++ii) {
+        EXPECT_EQ(capturedData[ii + 3], crsfFrame.frame.payload[ii]);
+    }
+
+    // two frames received back to back leave the last one
+    crsfFrameDone = false;
+    crsfFrameReceive(capturedData, sizeof(capturedData), NULL, 0, 5678, NULL);
+    EXPECT_EQ(true, crsfFrameDone);
+    for (int ii = 0; ii < CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_CRC; ++ii) {
+        EXPECT_EQ(capturedData[sizeof(crsfRcChannelsFrame_t) + ii + 3], crsfFrame.frame.payload[ii]);
+    }
+
+    // a frame that wraps around the end of the receive buffer arrives in two spans
+    crsfFrameDone = false;
+    crsfFrameReceive(capturedData, 10, &capturedData[10], sizeof(crsfRcChannelsFrame_t) - 10, 9012, NULL);
+    EXPECT_EQ(true, crsfFrameDone);
+    for (int ii = 0; ii < CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_CRC; ++ii) {
+        EXPECT_EQ(capturedData[ii + 3], crsfFrame.frame.payload[ii]);
+    }
+}
+
 // STUBS
 
 extern "C" {
@@ -292,4 +326,5 @@ void crsfScheduleMspResponse(void) {};
 bool bufferMspFrame(uint8_t *, int) {return true;}
 bool isBatteryVoltageAvailable(void) { return true; }
 bool isAmperageAvailable(void) { return true; }
+void schedulerSignalTask(cfTaskId_e) {}
 }
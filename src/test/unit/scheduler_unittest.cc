@@ -51,7 +51,8 @@ extern "C" {
     void taskUpdateAccelerometer(timeUs_t) { simulatedTime += TEST_UPDATE_ACCEL_TIME; }
     void taskHandleSerial(timeUs_t) { simulatedTime += TEST_HANDLE_SERIAL_TIME; }
     void taskUpdateBatteryVoltage(timeUs_t) { simulatedTime += TEST_UPDATE_BATTERY_TIME; }
-    bool rxUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_RX_CHECK_TIME; return false; }
+    bool rxFrameReady = false;
+    bool rxUpdateCheck(timeUs_t, timeDelta_t) { simulatedTime += TEST_UPDATE_RX_CHECK_TIME; return rxFrameReady; }
     void taskUpdateRxMain(timeUs_t) { simulatedTime += TEST_UPDATE_RX_MAIN_TIME; }
     void imuUpdateAttitude(timeUs_t) { simulatedTime += TEST_IMU_UPDATE_TIME; }
     void dispatchProcess(timeUs_t) { simulatedTime += TEST_DISPATCH_TIME; }
@@ -393,3 +394,173 @@ TEST(SchedulerUnittest, TestTwoTasks)
     scheduler();
     EXPECT_EQ(&cfTasks[TASK_ACCEL], unittest_scheduler_selectedTask);
 }
+
+TEST(SchedulerUnittest, TestEdfEarliestDeadlineFirst)
+{
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_ACCEL, true);
+    setTaskEnabled(TASK_SERIAL, true);
+
+    // TASK_SERIAL has the earlier deadline, but the lower priority
+    cfTasks[TASK_ACCEL].lastExecutedAt = 80000;
+    cfTasks[TASK_SERIAL].lastExecutedAt = 75000;
+    cfTasks[TASK_SERIAL].deadlineMisses = 0;
+    schedulerSetMode(SCHEDULER_MODE_EDF);
+
+    // neither deadline has been reached
+    simulatedTime = 84000;
+    scheduler();
+    EXPECT_EQ(static_cast<cfTask_t*>(0), unittest_scheduler_selectedTask);
+    EXPECT_EQ(0, unittest_scheduler_waitingTasks);
+
+    // both deadlines have passed, the earliest runs first and is late by more than one period
+    simulatedTime = 100000;
+    scheduler();
+    // only the tasks up to the first one that can run are checked
+    EXPECT_EQ(&cfTasks[TASK_SERIAL], unittest_scheduler_selectedTask);
+    EXPECT_EQ(1, unittest_scheduler_waitingTasks);
+    EXPECT_EQ(1U, cfTasks[TASK_SERIAL].deadlineMisses);
+    EXPECT_EQ(100000 + cfTasks[TASK_SERIAL].desiredPeriod, cfTasks[TASK_SERIAL].deadlineAt);
+
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+
+    scheduler();
+    EXPECT_EQ(static_cast<cfTask_t*>(0), unittest_scheduler_selectedTask);
+
+    schedulerSetMode(SCHEDULER_MODE_PRIORITY);
+}
+
+TEST(SchedulerUnittest, TestEdfSignalledTask)
+{
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_RX, true);
+    cfTasks[TASK_RX].lastExecutedAt = 100000;
+    cfTasks[TASK_RX].dynamicPriority = 0;
+    schedulerSetMode(SCHEDULER_MODE_EDF);
+
+    // not signalled and desiredPeriod has not elapsed, so the checkFunc is not called
+    rxFrameReady = true;
+    simulatedTime = 101000;
+    scheduler();
+    EXPECT_EQ(static_cast<cfTask_t*>(0), unittest_scheduler_selectedTask);
+    EXPECT_EQ(101000U, simulatedTime);
+
+    // a signal makes the task due immediately
+    schedulerSignalTask(TASK_RX);
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_RX], unittest_scheduler_selectedTask);
+
+    // a signal without data re-arms the task for desiredPeriod later
+    rxFrameReady = false;
+    simulatedTime = 102000;
+    schedulerSignalTask(TASK_RX);
+    scheduler();
+    EXPECT_EQ(static_cast<cfTask_t*>(0), unittest_scheduler_selectedTask);
+    EXPECT_EQ(102000 + cfTasks[TASK_RX].desiredPeriod, cfTasks[TASK_RX].deadlineAt);
+
+    schedulerSetMode(SCHEDULER_MODE_PRIORITY);
+}
+
+TEST(SchedulerUnittest, TestEdfBlockedHeadPassedOver)
+{
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_GYROPID, true);
+    setTaskEnabled(TASK_ACCEL, true);
+    setTaskEnabled(TASK_ATTITUDE, true);
+
+    // TASK_GYROPID is due, so only tasks more than a period late can run. TASK_ACCEL has the earliest deadline but is
+    // only one period late, TASK_ATTITUDE behind it is three periods late.
+    simulatedTime = 100000;
+    cfTasks[TASK_GYROPID].lastExecutedAt = simulatedTime - cfTasks[TASK_GYROPID].desiredPeriod;
+    cfTasks[TASK_ACCEL].lastExecutedAt = 86000;
+    cfTasks[TASK_ATTITUDE].lastExecutedAt = 96500;
+    schedulerSetMode(SCHEDULER_MODE_EDF);
+
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_ATTITUDE], unittest_scheduler_selectedTask);
+    EXPECT_EQ(3, unittest_scheduler_waitingTasks);
+
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_GYROPID], unittest_scheduler_selectedTask);
+
+    // once the realtime task has run the head goes next
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+
+    schedulerSetMode(SCHEDULER_MODE_PRIORITY);
+}
+
+TEST(SchedulerUnittest, TestMaxOverheadTimeReset)
+{
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_RX, true);
+    schedulerResetMaxOverheadTime();
+
+    // the RX checkFunc is part of the scheduler overhead
+    rxFrameReady = true;
+    cfTasks[TASK_RX].dynamicPriority = 0;
+    simulatedTime = 200000;
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_RX], unittest_scheduler_selectedTask);
+
+    // reading the maximum leaves it alone
+    cfSchedulerInfo_t schedulerInfo;
+    getSchedulerInfo(&schedulerInfo);
+    EXPECT_EQ((timeUs_t)TEST_UPDATE_RX_CHECK_TIME, schedulerInfo.maxOverheadTime);
+    getSchedulerInfo(&schedulerInfo);
+    EXPECT_EQ((timeUs_t)TEST_UPDATE_RX_CHECK_TIME, schedulerInfo.maxOverheadTime);
+
+    schedulerResetMaxOverheadTime();
+    getSchedulerInfo(&schedulerInfo);
+    EXPECT_EQ(0U, schedulerInfo.maxOverheadTime);
+    rxFrameReady = false;
+}
+
+TEST(SchedulerUnittest, TestTaskHistogram)
+{
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<cfTaskId_e>(taskId), false);
+    }
+    setTaskEnabled(TASK_GYROPID, true);
+    schedulerResetTaskStatistics(TASK_GYROPID);
+
+    // TASK_GYROPID runs 300us after its desired start, taking TEST_PID_LOOP_TIME
+    cfTasks[TASK_GYROPID].lastExecutedAt = 1000;
+    simulatedTime = 1000 + cfTasks[TASK_GYROPID].desiredPeriod + 300;
+    scheduler();
+    EXPECT_EQ(&cfTasks[TASK_GYROPID], unittest_scheduler_selectedTask);
+
+    cfTaskHistogram_t histogram;
+    getTaskHistogram(TASK_GYROPID, &histogram);
+    // 650us is in [512, 1024), 300us is in [256, 512)
+    EXPECT_EQ(1, histogram.executionTime[10]);
+    EXPECT_EQ(1, histogram.lateness[9]);
+
+    // on time
+    simulatedTime = cfTasks[TASK_GYROPID].lastExecutedAt + cfTasks[TASK_GYROPID].desiredPeriod;
+    scheduler();
+    getTaskHistogram(TASK_GYROPID, &histogram);
+    EXPECT_EQ(2, histogram.executionTime[10]);
+    EXPECT_EQ(1, histogram.lateness[0]);
+
+    schedulerResetTaskStatistics(TASK_GYROPID);
+    getTaskHistogram(TASK_GYROPID, &histogram);
+    for (int bucket = 0; bucket < TASK_HISTOGRAM_BUCKET_COUNT; ++bucket) {
+        EXPECT_EQ(0, histogram.executionTime[bucket]);
+        EXPECT_EQ(0, histogram.lateness[bucket]);
+    }
+}
@@ -19,6 +19,8 @@
 #include <stdbool.h>
 
 #include <limits.h>
+#include <math.h>
+#include <time.h>
 #include <algorithm>
 
 extern "C" {
@@ -27,10 +29,12 @@ extern "C" {
     #include "build/build_config.h"
     #include "build/debug.h"
     #include "common/axis.h"
+    #include "common/filter.h"
     #include "common/maths.h"
     #include "common/utils.h"
     #include "drivers/accgyro/accgyro_fake.h"
     #include "drivers/accgyro/accgyro_mpu.h"
+    #include "drivers/accgyro/gyro_sync.h"
     #include "drivers/sensor.h"
     #include "io/beeper.h"
     #include "pg/pg.h"
@@ -150,6 +154,150 @@ TEST(SensorGyro, Update)
     EXPECT_FLOAT_EQ(90 * gyroDevPtr->scale, gyro.gyroADCf[Z]);
 }
 
+TEST(SensorGyro, SampleQueue)
+{
+    gyroSampleQueue_t queue;
+    gyroSampleQueueInit(&queue);
+    EXPECT_TRUE(gyroSampleQueueIsEmpty(&queue));
+
+    gyroSample_t sample = { .readyAtUs = 0, .adcRaw = { 0, 0, 0 }, .hasData = true };
+    for (int ii = 0; ii < GYRO_SAMPLE_QUEUE_SIZE; ii++) {
+        sample.readyAtUs = ii;
+        EXPECT_TRUE(gyroSampleQueuePush(&queue, &sample));
+    }
+    // full, the newest sample is dropped
+    EXPECT_FALSE(gyroSampleQueuePush(&queue, &sample));
+    EXPECT_EQ(1U, queue.overruns);
+
+    // samples come out in order, also across index wrap
+    for (int ii = 0; ii < 3 * GYRO_SAMPLE_QUEUE_SIZE; ii++) {
+        gyroSample_t popped;
+        EXPECT_TRUE(gyroSampleQueuePop(&queue, &popped));
+        EXPECT_EQ((timeUs_t)ii, popped.readyAtUs);
+        sample.readyAtUs = ii + GYRO_SAMPLE_QUEUE_SIZE;
+        EXPECT_TRUE(gyroSampleQueuePush(&queue, &sample));
+    }
+    EXPECT_FALSE(gyroSampleQueueIsEmpty(&queue));
+}
+
+TEST(SensorGyro, InterruptSync)
+{
+    pgResetAll();
+    gyroConfigMutable()->gyro_lowpass_hz = 0;
+    gyroConfigMutable()->gyro_lowpass2_hz = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    gyroConfigMutable()->gyro_interrupt_sync = true;
+    gyroInit();
+    EXPECT_TRUE(gyroInterruptSyncActive());
+    gyroDevPtr->readFn = fakeGyroRead;
+    gyroStartCalibration(false);
+    while (!isGyroCalibrationComplete()) {
+        fakeGyroSet(gyroDevPtr, 5, 6, 7);
+        fakeGyroDataReady(gyroDevPtr);
+        gyroUpdate(0);
+    }
+
+    // no data ready interrupt yet, the task waits until the timeout
+    EXPECT_FALSE(gyroSampleReady(0, 0));
+    EXPECT_TRUE(gyroSampleReady(0, 4 * gyro.targetLooptime));
+
+    // the sensor changes, but the sample taken at the interrupt is used
+    fakeGyroSet(gyroDevPtr, 15, 26, 97);
+    fakeGyroDataReady(gyroDevPtr);
+    fakeGyroSet(gyroDevPtr, 0, 0, 0);
+    EXPECT_TRUE(gyroSampleReady(0, 0));
+    gyroUpdate(0);
+    EXPECT_FALSE(gyroSampleReady(0, 0));
+    EXPECT_FLOAT_EQ(10 * gyroDevPtr->scale, gyro.gyroADCf[X]);
+    EXPECT_FLOAT_EQ(20 * gyroDevPtr->scale, gyro.gyroADCf[Y]);
+    EXPECT_FLOAT_EQ(90 * gyroDevPtr->scale, gyro.gyroADCf[Z]);
+
+    pgResetAll();
+    gyroInit();
+    EXPECT_FALSE(gyroInterruptSyncActive());
+}
+
+static uint64_t nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+TEST(SensorGyro, FilterChainBenchmark)
+{
+    static const uint32_t looptime = 125; // 8kHz
+    static const int sampleCount = 200000;
+    const float k = pt1FilterGain(150, looptime * 1e-6f);
+    const float notchQ = filterGetNotchQ(260, 160);
+
+    // reference: one indirect call per stage per axis
+    pt1Filter_t lowpass2[XYZ_AXIS_COUNT];
+    biquadFilter_t lowpass[XYZ_AXIS_COUNT];
+    biquadFilter_t notch1[XYZ_AXIS_COUNT];
+    biquadFilter_t notch2[XYZ_AXIS_COUNT];
+    const filterApplyFnPtr lowpass2ApplyFn = (filterApplyFnPtr)pt1FilterApply;
+    const filterApplyFnPtr lowpassApplyFn = (filterApplyFnPtr)biquadFilterApply;
+    const filterApplyFnPtr notch1ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+    const filterApplyFnPtr notch2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pt1FilterInit(&lowpass2[axis], k);
+        biquadFilterInitLPF(&lowpass[axis], 200, looptime);
+        biquadFilterInit(&notch1[axis], 260, looptime, notchQ, FILTER_NOTCH);
+        biquadFilterInit(&notch2[axis], 180, looptime, notchQ, FILTER_NOTCH);
+    }
+
+    filterChain_t chain;
+    filterChainInit(&chain);
+    EXPECT_NE((void *)NULL, filterChainAddPt1(&chain, k));
+    EXPECT_NE((void *)NULL, filterChainAddBiquad(&chain, 200, looptime, BIQUAD_Q, FILTER_LPF));
+    EXPECT_NE((void *)NULL, filterChainAddBiquad(&chain, 260, looptime, notchQ, FILTER_NOTCH));
+    EXPECT_NE((void *)NULL, filterChainAddBiquad(&chain, 180, looptime, notchQ, FILTER_NOTCH));
+    EXPECT_EQ(NULL, filterChainAddPt1(&chain, k));
+    EXPECT_EQ(4, chain.stageCount);
+
+    static float input[sampleCount][XYZ_AXIS_COUNT];
+    static float expected[sampleCount][XYZ_AXIS_COUNT];
+    static float output[sampleCount][XYZ_AXIS_COUNT];
+    for (int i = 0; i < sampleCount; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            input[i][axis] = 300.0f * sinf(0.01f * i * (axis + 1)) + 50.0f * sinf(0.2f * i) + (rand() % 100) - 50;
+        }
+    }
+
+    uint64_t startNs = nanos();
+    for (int i = 0; i < sampleCount; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            float gyroADCf = input[i][axis];
+            gyroADCf = lowpass2ApplyFn((filter_t *)&lowpass2[axis], gyroADCf);
+            gyroADCf = lowpassApplyFn((filter_t *)&lowpass[axis], gyroADCf);
+            gyroADCf = notch1ApplyFn((filter_t *)&notch1[axis], gyroADCf);
+            gyroADCf = notch2ApplyFn((filter_t *)&notch2[axis], gyroADCf);
+            expected[i][axis] = gyroADCf;
+        }
+    }
+    const uint64_t referenceNs = nanos() - startNs;
+
+    startNs = nanos();
+    for (int i = 0; i < sampleCount; i++) {
+        output[i][X] = input[i][X];
+        output[i][Y] = input[i][Y];
+        output[i][Z] = input[i][Z];
+        filterChainApply(&chain, output[i]);
+    }
+    const uint64_t chainNs = nanos() - startNs;
+
+    for (int i = 0; i < sampleCount; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            ASSERT_NEAR(expected[i][axis], output[i][axis], 1e-3f);
+        }
+    }
+
+    printf("gyro filter, %d samples: per-axis dispatch %.1fns/sample, filter chain %.1fns/sample\n",
+        sampleCount, (double)referenceNs / sampleCount, (double)chainNs / sampleCount);
+}
+
 // STUBS
 
 extern "C" {
@@ -161,4 +309,11 @@ timeDelta_t getGyroUpdateRate(void) {return gyro.targetLooptime;}
 void sensorsSet(uint32_t) {}
 void schedulerResetTaskStatistics(cfTaskId_e) {}
 int getArmingDisableFlags(void) {return 0;}
+void kalman_init(void) {}
+void kalman_update(float *input, float *output)
+{
+    output[X] = input[X];
+    output[Y] = input[Y];
+    output[Z] = input[Z];
+}
 }
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <stdarg.h>
 #include <string.h>
 
 extern "C" {
@@ -70,7 +71,7 @@ static int displayPortTestScreenSize(const displayPort_t *displayPort)
 static int displayPortTestWriteString(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *s)
 {
     UNUSED(displayPort);
-    for (unsigned int i = 0; i < strlen(s); i++) {
+    for (unsigned int i = 0; i < strlen(s) && x + i < UNITTEST_DISPLAYPORT_COLS; i++) {
         testDisplayPortBuffer[(y * UNITTEST_DISPLAYPORT_COLS) + x + i] = s[i];
     }
     return 0;
@@ -139,6 +139,7 @@ extern "C" {
     bool calculateRxChannelsAndUpdateFailsafe(timeUs_t) { return true; }
     bool isMixerUsingServos(void) { return false; }
     void gyroUpdate(timeUs_t) {}
+    timeUs_t gyroSampleReadyAtUs(void) { return 0; }
     timeDelta_t getTaskDeltaTime(cfTaskId_e) { return 0; }
     void updateRSSI(timeUs_t) {}
     bool failsafeIsMonitoring(void) { return false; }